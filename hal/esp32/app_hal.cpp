@@ -45,31 +45,32 @@
 
 #include "ui/custom_face.h"
 #include "common/api.h"
+#include "common/log_ring/log_ring.h"
+#include "common/delta_patch/delta_patch.h"
+#include "common/glyph_font/glyph_font.h"
 
 #include "main.h"
 #include "displays/pins.h"
+#include "board_profile.h"
 #include "splash.h"
 
 #include "FS.h"
 #include "FFat.h"
+#include "esp_heap_caps.h"
+#ifdef ENABLE_DELTA_OTA
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#endif
 
 #ifdef M5_STACK_DIAL
 #include "M5Dial.h"
 #define tft M5Dial.Display
-#define buf_size 10
 #elif defined(VIEWE_SMARTRING) || defined(VIEWE_KNOB_15)
 #include "displays/viewe.hpp"
-#define buf_size 32
-#define SW_ROTATION
 #else
 #include "displays/generic.hpp"
-#define buf_size 10
 #endif
 
-#ifdef VIEWE_KNOB_15
-#include <Encoder.h>
-Encoder myEnc(ENCODER_A, ENCODER_B);
-#endif
 
 #ifdef ENABLE_APP_QMI8658C
 #include "FastIMU.h"
@@ -98,53 +99,104 @@ GyroData gyro;
 static const uint32_t screenWidth = SCREEN_WIDTH;
 static const uint32_t screenHeight = SCREEN_HEIGHT;
 
-#define buf_size 40  // Increase from 10 to 40 lines (about 25% of your screen height)
-const unsigned int lvBufferSize = screenWidth * buf_size;
+// pixels in one draw buffer, the static ones are left empty when PSRAM holds them
+static constexpr uint32_t lvBufferSize = screenWidth * board.bufferLines;
+static constexpr uint32_t lvStaticSize = board.bufferPsram ? 1 : lvBufferSize;
 // Make sure buffers are DMA-compatible (32-bit aligned)
-DRAM_ATTR static lv_color_t lvBuffer[2][lvBufferSize] __attribute__((aligned(32)));
-
-bool weatherUpdate = true, notificationsUpdate = true, weatherUpdateFace = true;
+DRAM_ATTR static lv_color_t lvBuffer[2][lvStaticSize] __attribute__((aligned(32)));
 
 ChronosTimer screenTimer;
 ChronosTimer alertTimer;
 ChronosTimer searchTimer;
 
 Navigation nav;
-bool navChanged = false;
-bool navIcChanged = false;
 uint32_t navIcCRC = 0xFFFFFFFF;
 
 lv_obj_t *lastActScr;
+lv_indev_t *lvInput;
 
 // bool circular = false;
 bool alertSwitch = false;
 bool gameActive = false;
 bool readIMU = false;
-bool updateSeconds = false;
 bool hasUpdatedSec = false;
 bool navSwitch = false;
 
-static long oldPosition = 0;
+#if defined(ENCODER_A) && defined(ENCODER_B)
+// quadrature decoding, 4 counts per detent
+static volatile long encoderPosition = 0;
+static volatile uint8_t encoderState = 0;
+static const int8_t encoderSteps[16] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+#endif
 
 String customFacePaths[15];
 int customFaceIndex;
 static bool transfer = false;
-#ifdef ENABLE_CUSTOM_FACE
-#error "Custom Watchface has not been migrated to LVGL 9 yet"
-// watchface transfer
+
+enum FsState
+{
+  FS_PENDING = 0,
+  FS_MOUNTED,
+  FS_FAILED
+};
+static volatile FsState fsMountState = FS_PENDING;
+
+// boot continues in hal_loop after the home face is on screen
+enum BootState
+{
+  BOOT_SCREENS = 0,
+  BOOT_SETTINGS,
+  BOOT_FS,
+  BOOT_BLE,
+  BOOT_DONE
+};
+static BootState bootState = BOOT_SCREENS;
+static uint32_t bootLast = 0;
+
+#if defined(ENABLE_CUSTOM_FACE) || defined(ENABLE_DELTA_OTA)
+// chunked file transfer from the app, a watchface dial or a firmware delta
 int cSize, pos, recv;
 uint32_t total, currentRecv;
 bool last;
-String fName;
 uint8_t buf1[1024];
 uint8_t buf2[1024];
 static bool writeFile = false, wSwitch = true;
 static int wLen1 = 0, wLen2 = 0;
 bool start = false;
+#endif
+
+#ifdef ENABLE_CUSTOM_FACE
+#error "Custom Watchface has not been migrated to LVGL 9 yet"
+// watchface transfer
+String fName;
 int lastCustom;
 #endif
 
+#ifdef ENABLE_DELTA_OTA
+// a transfer that starts with DELTA_MAGIC is a firmware delta, see common/delta_patch
+static bool otaTransfer = false;
+static uint8_t otaAck[5];
+// set by the BLE task when it drops an update, hal_loop releases the slot
+static volatile bool otaDropped = false;
+#endif
+
+#ifdef ENABLE_FONT_FILE
+// -D ENABLE_FONT_FILE=1 draws notification text with glyphs from an LVGL binary font on FFat
+#ifndef FONT_FILE_PATH
+#define FONT_FILE_PATH "/font.bin"
+#endif
+static File fontFile;
+static SemaphoreHandle_t fontMutex; // cache and fontFile, prewarm runs on the BLE task
+static glyph_font_t glyphFont;
+static lv_font_t notifyFont; // message and list, over the default font
+static lv_font_t alertFont;  // alert popup, over montserrat 16
+static bool fontReady = false;
+#endif
+
 TaskHandle_t gameHandle = NULL;
+#ifdef ENABLE_GAME_TASK
+SemaphoreHandle_t gameMutex = NULL;
+#endif
 
 void showAlert();
 bool isDay();
@@ -156,6 +208,22 @@ void hal_loop(void);
 void update_faces();
 void updateQrLinks();
 
+void setupInput();
+void bootStage(const char *name);
+void *allocDrawBuffer();
+void *psramAlloc(size_t size);
+void logBoardProfile();
+void logFeedbackStats();
+void bootStep();
+void loadSettings();
+void startBLE();
+void startFSMount();
+void restartDevice();
+void publishClock();
+void setupStateStore();
+void onNotificationsChanged(state_topic_t topic, const state_value_t *value);
+void onForecastChanged(state_topic_t topic, const state_value_t *value);
+
 void flashDrive_cb(lv_event_t *e);
 void driveList_cb(lv_event_t *e);
 
@@ -171,6 +239,15 @@ bool readDialBytes(const char *path, uint8_t *data, size_t offset, size_t size);
 bool isKnown(uint8_t id);
 void parseDial(const char *path, bool restart = false);
 bool lvImgHeader(uint8_t *byteArray, uint8_t cf, uint16_t w, uint16_t h, uint16_t stride);
+#ifdef ENABLE_FONT_FILE
+void loadFontFile();
+#endif
+#ifdef ENABLE_DELTA_OTA
+void otaChunk(const uint8_t *data, int len);
+void otaAbort();
+#endif
+
+extern log_ring_t logRing;
 
 
 lv_display_rotation_t getRotation(uint8_t rotation)
@@ -213,8 +290,147 @@ void rounder_event_cb(lv_event_t *e)
 }
 
 /*Read the touchpad*/
+#ifdef TOUCH_IRQ_MODE
+#define CST816S_ADDR 0x15
+#define CST816S_REG_GESTURE 0x01
+#define CST816S_REG_MOTION_MASK 0xEC
+#define CST816S_REG_IRQ_CTL 0xFA
+
+static volatile bool touchIrq = false;
+static bool touchDown = false;
+static bool gestureSent = false;
+
+void IRAM_ATTR touchISR()
+{
+  touchIrq = true;
+}
+
+bool touchWriteReg(uint8_t reg, uint8_t value)
+{
+  uint8_t data[2] = {reg, value};
+  return !lgfx::i2c::transactionWrite(0, CST816S_ADDR, data, 2, 400000).has_error();
+}
+
+void setupTouchIrq()
+{
+  // double tap gesture, interrupt on touch, change and motion
+  touchWriteReg(CST816S_REG_MOTION_MASK, 0x01);
+  touchWriteReg(CST816S_REG_IRQ_CTL, 0x70);
+  attachInterrupt(digitalPinToInterrupt(TP_INT), touchISR, FALLING);
+  input_bus_use_hw_gestures(true);
+}
+
+// map a panel swipe to screen coordinates so it follows the display rotation
+input_gesture_t rotateGesture(input_gesture_t gesture)
+{
+  int dx = 0, dy = 0;
+  switch (gesture)
+  {
+  case INPUT_GESTURE_SWIPE_UP:
+    dy = -1;
+    break;
+  case INPUT_GESTURE_SWIPE_DOWN:
+    dy = 1;
+    break;
+  case INPUT_GESTURE_SWIPE_LEFT:
+    dx = -1;
+    break;
+  case INPUT_GESTURE_SWIPE_RIGHT:
+    dx = 1;
+    break;
+  default:
+    return gesture;
+  }
+  lgfx::touch_point_t tp[2];
+  tp[0].x = SCREEN_WIDTH / 2;
+  tp[0].y = SCREEN_HEIGHT / 2;
+  tp[1].x = tp[0].x + dx * 16;
+  tp[1].y = tp[0].y + dy * 16;
+  tft.convertRawXY(tp, 2);
+  dx = tp[1].x - tp[0].x;
+  dy = tp[1].y - tp[0].y;
+  if (abs(dx) > abs(dy))
+  {
+    return dx < 0 ? INPUT_GESTURE_SWIPE_LEFT : INPUT_GESTURE_SWIPE_RIGHT;
+  }
+  return dy < 0 ? INPUT_GESTURE_SWIPE_UP : INPUT_GESTURE_SWIPE_DOWN;
+}
+
+input_gesture_t toGesture(uint8_t code)
+{
+  switch (code)
+  {
+  case 0x01:
+    return rotateGesture(INPUT_GESTURE_SWIPE_UP);
+  case 0x02:
+    return rotateGesture(INPUT_GESTURE_SWIPE_DOWN);
+  case 0x03:
+    return rotateGesture(INPUT_GESTURE_SWIPE_LEFT);
+  case 0x04:
+    return rotateGesture(INPUT_GESTURE_SWIPE_RIGHT);
+  case 0x0B:
+    return INPUT_GESTURE_DOUBLE_TAP;
+  case 0x0C:
+    return INPUT_GESTURE_LONG_PRESS;
+  default:
+    return INPUT_GESTURE_NONE;
+  }
+}
+
+void my_touchpad_read(lv_indev_t *indev_driver, lv_indev_data_t *data)
+{
+  if (!touchIrq && !touchDown)
+  {
+    // no finger on the panel, skip the I2C read
+    data->state = LV_INDEV_STATE_RELEASED;
+    return;
+  }
+  touchIrq = false;
+
+  // gesture, finger count, x high, x low, y high, y low
+  uint8_t reg = CST816S_REG_GESTURE;
+  uint8_t raw[6];
+  if (lgfx::i2c::transactionWriteRead(0, CST816S_ADDR, &reg, 1, raw, 6, 400000).has_error())
+  {
+    touchDown = false;
+    data->state = LV_INDEV_STATE_RELEASED;
+    return;
+  }
+
+  bool wasDown = touchDown;
+  touchDown = raw[1] > 0;
+
+  input_gesture_t gesture = toGesture(raw[0]);
+  if (gesture != INPUT_GESTURE_NONE && !gestureSent)
+  {
+    gestureSent = true;
+    input_bus_post_gesture(gesture, millis());
+  }
+
+  if (!touchDown)
+  {
+    gestureSent = false;
+    data->state = LV_INDEV_STATE_RELEASED;
+    return;
+  }
+
+  lgfx::touch_point_t tp;
+  tp.x = ((raw[2] & 0x0F) << 8) | raw[3];
+  tp.y = ((raw[4] & 0x0F) << 8) | raw[5];
+  tft.convertRawXY(&tp, 1);
+
+  data->state = LV_INDEV_STATE_PRESSED;
+  data->point.x = tp.x;
+  data->point.y = tp.y;
+  if (!wasDown)
+  {
+    screen_on();
+  }
+}
+#else
 void my_touchpad_read(lv_indev_t *indev_driver, lv_indev_data_t *data)
 {
+  static bool wasTouched = false;
   bool touched;
   uint8_t gesture;
   uint16_t touchX, touchY;
@@ -244,9 +460,14 @@ void my_touchpad_read(lv_indev_t *indev_driver, lv_indev_data_t *data)
     /*Set the coordinates*/
     data->point.x = touchX;
     data->point.y = touchY;
-    screen_on();
+    if (!wasTouched)
+    {
+      screen_on();
+    }
   }
+  wasTouched = touched;
 }
+#endif
 
 void screen_on(long extra)
 {
@@ -580,19 +801,39 @@ void deleteFile(const char *path)
   }
 }
 
-bool setupFS()
+void fsMountTask(void *param)
 {
+  bool mounted = FLASH.begin(true, "/ffat", MAX_FILE_OPEN);
+  if (!mounted)
+  {
+    FLASH.format();
+  }
+  fsMountState = mounted ? FS_MOUNTED : FS_FAILED;
+  vTaskDelete(NULL);
+}
 
-#ifndef ENABLE_CUSTOM_FACE
-  return false;
+// mount in the background, setupFS picks up the result
+void startFSMount()
+{
+#if defined(ENABLE_CUSTOM_FACE) || defined(ENABLE_FONT_FILE) || defined(LOG_FILE)
+  xTaskCreatePinnedToCore(fsMountTask, "fsMount", 4096, nullptr, 1, nullptr, 0);
+#else
+  fsMountState = FS_FAILED;
 #endif
+}
 
-  if (!FLASH.begin(true, "/ffat", MAX_FILE_OPEN))
+bool setupFS()
+{
+  static bool ready = false;
+  if (ready)
+  {
+    return true;
+  }
+  if (fsMountState != FS_MOUNTED)
   {
-    FLASH.format();
-
     return false;
   }
+  ready = true;
 
   static lv_fs_drv_t sd_drv;
   lv_fs_drv_init(&sd_drv);
@@ -606,6 +847,10 @@ bool setupFS()
   sd_drv.tell_cb = sd_tell_cb;
   lv_fs_drv_register(&sd_drv);
 
+#ifdef ENABLE_FONT_FILE
+  loadFontFile();
+#endif
+
   checkLocal(true); // parse new faces
 
   checkLocal(); // register the local faces
@@ -808,8 +1053,8 @@ void onCustomDelete(lv_event_t *e)
   showError("Delete", "The watchface will be deleted from storage, ESP32 will restart after deletion");
   if (deleteCustomFace(customFacePaths[index]))
   {
-    lv_screen_load_anim(ui_appListScreen, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0, false);
-    ESP.restart();
+    screen_transition_load(ui_appListScreen, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500, 0);
+    restartDevice();
   }
   else
   {
@@ -911,30 +1156,40 @@ void simonTone(int type, int pitch)
     feedbackVibrate(v_notif, 2, true);
     break;
   case 2:
-  {
-    Note note[] = {pitch, 200};
-    feedbackTone(note, 1, T_USER);
-  }
-  break;
+    feedbackNote(pitch, 200, T_USER);
+    break;
   }
 }
 
+// tones scheduled by the sequencer, in step with its visuals
+void sequencerTone(uint16_t pitch, uint16_t duration)
+{
+  feedbackNote(pitch, duration, T_USER);
+}
+
+/*
+  Holds the lvgl lock for a scope. Chronos callbacks can run on the BLE task,
+  which must not touch lvgl while the loop task renders. Without
+  LV_RENDER_THREADS the lock does nothing.
+*/
+struct LvglLock
+{
+  LvglLock() { lv_lock(); }
+  ~LvglLock() { lv_unlock(); }
+};
+
 void connectionCallback(bool state)
 {
+  LvglLock lock;
   Timber.d(state ? "Connected" : "Disconnected");
-  if (state)
-  {
-    lv_obj_remove_state(ui_btStateButton, LV_STATE_CHECKED);
-  }
-  else
-  {
-    lv_obj_add_state(ui_btStateButton, LV_STATE_CHECKED);
-  }
-  lv_label_set_text_fmt(ui_appConnectionText, "Status\n%s", state ? "Connected" : "Disconnected");
+  state_value_t value;
+  value.connected = state;
+  state_store_publish(STATE_TOPIC_CONNECTION, &value);
 }
 
 void ringerCallback(String caller, bool state)
 {
+  LvglLock lock;
   lv_disp_t *display = lv_display_get_default();
   lv_obj_t *actScr = lv_display_get_screen_active(display);
 
@@ -947,16 +1202,16 @@ void ringerCallback(String caller, bool state)
     Serial.print("Ringer: Incoming call from ");
     Serial.println(caller);
     lv_label_set_text(ui_callName, caller.c_str());
-    lv_screen_load_anim(ui_callScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
+    screen_transition_load(ui_callScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
   }
   else
   {
-    feedbackTone(tone_off, 1, T_USER, true);
+    feedbackStop();
     Serial.println("Ringer dismissed");
     // load last active screen
     if (actScr == ui_callScreen && lastActScr != nullptr)
     {
-      lv_screen_load_anim(lastActScr, LV_SCR_LOAD_ANIM_FADE_OUT, 500, 0, false);
+      screen_transition_load(lastActScr, LV_SCR_LOAD_ANIM_FADE_OUT, 500, 0);
     }
   }
   screenTimer.active = true;
@@ -964,9 +1219,18 @@ void ringerCallback(String caller, bool state)
 
 void notificationCallback(Notification notification)
 {
-  Timber.d("Notification Received from " + notification.app + " at " + notification.time);
-  Timber.d(notification.message);
-  notificationsUpdate = true;
+  LvglLock lock;
+  log_ring_printf(&logRing, LOG_LEVEL_DEBUG, "Notification Received from %s at %s\n%s\n",
+                  notification.app.c_str(), notification.time.c_str(), notification.message.c_str());
+  state_store_bump(STATE_TOPIC_NOTIFICATIONS);
+#ifdef ENABLE_FONT_FILE
+  // read the glyphs now so the alert shows without waiting on FFat
+  if (fontReady)
+  {
+    uint32_t loaded = glyph_font_prewarm(&glyphFont, notification.message.c_str());
+    log_ring_defer(&logRing, LOG_LEVEL_DEBUG, "Font: %u glyphs read for the notification\n", loaded, 0, 0, 0);
+  }
+#endif
   // onNotificationsOpen(click);
   feedbackRun(T_NOTIFICATION);
   showAlert();
@@ -974,6 +1238,7 @@ void notificationCallback(Notification notification)
 
 void configCallback(Config config, uint32_t a, uint32_t b)
 {
+  LvglLock lock;
   switch (config)
   {
   case CF_TIME:
@@ -987,7 +1252,7 @@ void configCallback(Config config, uint32_t a, uint32_t b)
     if (!hasUpdatedSec)
     {
       hasUpdatedSec = true;
-      updateSeconds = true;
+      state_store_bump(STATE_TOPIC_TIME_SYNC);
     }
 
     break;
@@ -1000,18 +1265,21 @@ void configCallback(Config config, uint32_t a, uint32_t b)
     Serial.println("Reset request, formating storage");
     FLASH.format();
     delay(2000);
-    ESP.restart();
+    restartDevice();
 
     break;
   case CF_WEATHER:
 
     if (a)
     {
-      weatherUpdateFace = true;
+      state_value_t value;
+      value.weather.temp = watch.getWeatherAt(0).temp;
+      value.weather.icon = watch.getWeatherAt(0).icon;
+      state_store_publish(STATE_TOPIC_WEATHER, &value);
     }
     if (a == 2)
     {
-      weatherUpdate = true;
+      state_store_bump(STATE_TOPIC_FORECAST);
     }
 
     break;
@@ -1047,14 +1315,14 @@ void configCallback(Config config, uint32_t a, uint32_t b)
     {
       screenTimer.time = millis() + 50;
       lastActScr = actScr;
-      lv_screen_load_anim(ui_cameraScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
+      screen_transition_load(ui_cameraScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
       screenTimer.active = true;
     }
     else
     {
       if (actScr == ui_cameraScreen && lastActScr != nullptr)
       {
-        lv_screen_load_anim(lastActScr, LV_SCR_LOAD_ANIM_FADE_OUT, 500, 0, false);
+        screen_transition_load(lastActScr, LV_SCR_LOAD_ANIM_FADE_OUT, 500, 0);
       }
       screenTimer.active = true;
     }
@@ -1076,13 +1344,13 @@ void configCallback(Config config, uint32_t a, uint32_t b)
     }
     break;
   case CF_NAV_DATA:
-    navChanged = true;
+    state_store_bump(STATE_TOPIC_NAVIGATION);
     break;
   case CF_NAV_ICON:
     if (a == 2)
     {
-      navIcChanged = true;
-      Timber.w("Navigation icon received. CRC 0x%04X", b);
+      state_store_bump(STATE_TOPIC_NAV_ICON);
+      log_ring_defer(&logRing, LOG_LEVEL_WARN, "Navigation icon received. CRC 0x%04X\n", b, 0, 0, 0);
     }
     break;
   case CF_CONTACT:
@@ -1155,7 +1423,7 @@ void onForecastOpen(lv_event_t *e)
 
 void onScrollMode(lv_event_t *e)
 {
-  prefs.putBool("circular", circular);
+  prefs_set_bool(PREF_CIRCULAR, circular);
 }
 
 void onAlertState(lv_event_t *e)
@@ -1169,7 +1437,7 @@ void onAlertState(lv_event_t *e)
 void on_alert_state_change(int32_t states)
 {
   alert_states = states;
-  prefs.putInt("alert_states", alert_states);
+  prefs_set_int(PREF_ALERT_STATES, alert_states);
 
   feedbackTone(tone_button, 1, T_SYSTEM);
   feedbackVibrate(pattern, 2, true);
@@ -1180,27 +1448,63 @@ void onNavState(lv_event_t *e)
   lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
   navSwitch = lv_obj_has_state(obj, LV_STATE_CHECKED);
 
-  prefs.putBool("autonav", navSwitch);
+  prefs_set_bool(PREF_AUTONAV, navSwitch);
+}
+
+// NVS storage behind the preference cache
+bool nvsPrefRead(const char *name, pref_type_t type, pref_value_t *value)
+{
+  if (!prefs.isKey(name))
+  {
+    return false;
+  }
+  switch (type)
+  {
+  case PREF_TYPE_INT:
+    value->i = prefs.getInt(name, value->i);
+    break;
+  case PREF_TYPE_BOOL:
+    value->b = prefs.getBool(name, value->b);
+    break;
+  case PREF_TYPE_STR:
+    prefs.getString(name, value->s, PREF_STR_MAX);
+    break;
+  }
+  return true;
 }
 
-void savePrefInt(const char *key, int value)
+void nvsPrefWrite(const char *name, pref_type_t type, const pref_value_t *value)
 {
-  prefs.putInt(key, value);
+  switch (type)
+  {
+  case PREF_TYPE_INT:
+    prefs.putInt(name, value->i);
+    break;
+  case PREF_TYPE_BOOL:
+    prefs.putBool(name, value->b);
+    break;
+  case PREF_TYPE_STR:
+    prefs.putString(name, value->s);
+    break;
+  }
 }
 
-int getPrefInt(const char *key, int def_value)
+const prefs_backend_t nvsPrefs = {nvsPrefRead, nvsPrefWrite, NULL};
+
+// pending settings go to flash before the device restarts
+void restartDevice()
 {
-  return prefs.getInt(key, def_value);
+  prefs_flush();
+  ESP.restart();
 }
 
 void onNotificationsOpen(lv_event_t *e)
 {
-  if (!notificationsUpdate)
-  {
-    return;
-  }
-  notificationsUpdate = false;
+  state_store_flush_screen(ui_notificationScreen);
+}
 
+void onNotificationsChanged(state_topic_t topic, const state_value_t *value)
+{
   lv_obj_clean(ui_messageList);
   int c = watch.getNotificationCount();
   for (int i = 0; i < c; i++)
@@ -1220,12 +1524,11 @@ void onWeatherLoad(lv_event_t *e)
   lv_obj_add_flag(ui_forecastList, LV_OBJ_FLAG_HIDDEN);
   lv_obj_add_flag(ui_hourlyList, LV_OBJ_FLAG_HIDDEN);
 
-  if (!weatherUpdate)
-  {
-    return;
-  }
-  weatherUpdate = false;
+  state_store_flush_screen(ui_weatherScreen);
+}
 
+void onForecastChanged(state_topic_t topic, const state_value_t *value)
+{
   if (watch.getWeatherCount() > 0)
   {
     String updateTime = "Updated at\n" + watch.getWeatherTime();
@@ -1273,14 +1576,15 @@ void onBrightnessChange(lv_event_t *e)
   int v = lv_slider_get_value(slider);
   screenBrightness(v);
 
-  prefs.putInt("brightness", v);
+  prefs_set_int(PREF_BRIGHTNESS, v);
 }
 
 void onFaceSelected(lv_event_t *e)
 {
   feedbackVibrate(v_notif, 2, true);
   int index = (int)lv_event_get_user_data(e);
-  prefs.putInt("watchface", index);
+  prefs_set_int(PREF_WATCHFACE, index);
+  state_store_refresh(STATE_TOPIC_CLOCK);
 }
 
 void on_watchface_list_open()
@@ -1295,7 +1599,7 @@ void onCustomFaceSelected(int pathIndex)
 
   if (pathIndex < 0)
   {
-    prefs.putString("custom", "");
+    prefs_set_str(PREF_CUSTOM_FACE, "");
     return;
   }
   if (lv_obj_get_child_count(face_custom_root) > 0 && lastCustom == pathIndex)
@@ -1308,9 +1612,9 @@ void onCustomFaceSelected(int pathIndex)
     ui_home = face_custom_root;
   }
 
-  lv_screen_load_anim(ui_home, LV_SCR_LOAD_ANIM_FADE_ON, 500, 0, false);
+  screen_transition_load(ui_home, LV_SCR_LOAD_ANIM_FADE_ON, 500, 0);
 
-  prefs.putString("custom", customFacePaths[pathIndex]);
+  prefs_set_str(PREF_CUSTOM_FACE, customFacePaths[pathIndex].c_str());
 #endif
 }
 
@@ -1359,7 +1663,7 @@ void onTimeoutChange(lv_event_t *e)
   Timber.i("Selected index: %d", sel);
 
   setTimeout(sel);
-  prefs.putInt("timeout", sel);
+  prefs_set_int(PREF_TIMEOUT, sel);
 }
 
 void onRotateChange(lv_event_t *e)
@@ -1368,14 +1672,17 @@ void onRotateChange(lv_event_t *e)
   uint16_t sel = lv_dropdown_get_selected(obj);
   Timber.i("Selected index: %d", sel);
 
-  prefs.putInt("rotate", sel);
-#ifdef SW_ROTATION
-  lv_display_set_rotation(lv_display_get_default(), getRotation(sel));
-#else
-  tft.setRotation(sel);
-  // screen rotation has changed, invalidate to redraw
-  lv_obj_invalidate(lv_screen_active());
-#endif
+  prefs_set_int(PREF_ROTATE, sel);
+  if (board.swRotation)
+  {
+    lv_display_set_rotation(lv_display_get_default(), getRotation(sel));
+  }
+  else
+  {
+    tft.setRotation(sel);
+    // screen rotation has changed, invalidate to redraw
+    lv_obj_invalidate(lv_screen_active());
+  }
 }
 
 void onLanguageChange(lv_event_t *e)
@@ -1440,13 +1747,28 @@ void onRTWState(bool state)
 {
 }
 
+#ifdef ENABLE_GAME_TASK
+void gameLock()
+{
+  xSemaphoreTake(gameMutex, portMAX_DELAY);
+}
+
+void gameUnlock()
+{
+  xSemaphoreGive(gameMutex);
+}
+#endif
+
 void gameLoop(void *pvParameters)
 {
-  for (;;)
+  // simulation only, the runtime draws from the lvgl timer
+  while (gameActive)
   {
     ui_games_update();
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    vTaskDelay(5 / portTICK_PERIOD_MS);
   }
+  gameHandle = NULL;
+  vTaskDelete(NULL);
 }
 
 void onGameOpened()
@@ -1464,14 +1786,8 @@ void onGameOpened()
 
 void onGameClosed()
 {
+  // the game task sees this and exits on its own, never while holding the lock
   gameActive = false;
-#ifdef ENABLE_GAME_TASK
-  if (gameHandle != NULL)
-  {
-    vTaskDelete(gameHandle);
-    gameHandle = NULL;
-  }
-#endif
   screenTimer.active = true;
 }
 
@@ -1520,11 +1836,28 @@ void showAlert()
   }
 }
 
+#if defined(ENABLE_CUSTOM_FACE) || defined(ENABLE_DELTA_OTA)
+// a packet that does not fit the chunk buffers ends the transfer
+static void dropTransfer(const char *why)
+{
+  Timber.w("Transfer dropped: %s", why);
+  writeFile = false;
+  transfer = false;
+#ifdef ENABLE_DELTA_OTA
+  if (otaTransfer)
+  {
+    otaDropped = true;
+  }
+  otaTransfer = false;
+#endif
+}
+#endif
+
 void rawDataCallback(uint8_t *data, int len)
 {
 
-#ifdef ENABLE_CUSTOM_FACE
-  if (data[0] == 0xB0)
+#if defined(ENABLE_CUSTOM_FACE) || defined(ENABLE_DELTA_OTA)
+  if (len >= 12 && data[0] == 0xB0)
   {
     // this is a chunk header data command
     cSize = data[1] * 256 + data[2];                                                           // data chunk size
@@ -1532,6 +1865,11 @@ void rawDataCallback(uint8_t *data, int len)
     last = data[7] == 1;                                                                       // whether this is the last chunk (1) or not (0)
     total = (data[8] * 256 * 256 * 256) + (data[9] * 256 * 256) + (data[10] * 256) + data[11]; // total size of the whole file
     recv = 0;                                                                                  // counter for the chunk data
+    if (cSize > (int)sizeof(buf1))
+    {
+      dropTransfer("chunk larger than the buffer");
+      return;
+    }
 
     start = pos == 0;
     if (pos == 0)
@@ -1540,14 +1878,21 @@ void rawDataCallback(uint8_t *data, int len)
       transfer = true;
       currentRecv = 0;
 
+#ifdef ENABLE_CUSTOM_FACE
       fName = "/" + String(total, HEX) + "-" + String(total) + ".cbn";
+#endif
     }
   }
-  if (data[0] == 0xAF)
+  if (len >= 5 && data[0] == 0xAF)
   {
     // this is the chunk data, line by line. The complete chunk will have several of these
     // actual data starts from index 5
     int ln = ((data[1] * 256 + data[2]) - 5); // byte 1 and 2 make up the (total size of data - 5)
+    if (ln < 0 || ln > len - 5 || recv + ln > cSize)
+    {
+      dropTransfer("bad chunk data length");
+      return;
+    }
 
     if (wSwitch)
     {
@@ -1585,6 +1930,24 @@ void rawDataCallback(uint8_t *data, int len)
       // notify if save successful, otherwise ignore
       uint8_t lst = last ? 0x01 : 0x00;
       uint8_t cmd[5] = {0xB0, 0x02, highByte(pos), lowByte(pos), lst};
+#ifdef ENABLE_DELTA_OTA
+      if (start)
+      {
+        otaTransfer = delta_is_patch(wSwitch ? buf2 : buf1, cSize);
+      }
+      if (otaTransfer)
+      {
+        // patching a chunk can take a while, hal_loop acks once it is applied
+        memcpy(otaAck, cmd, 5);
+        return;
+      }
+#ifndef ENABLE_CUSTOM_FACE
+      // not a firmware delta, nothing else is received without custom faces
+      writeFile = false;
+      transfer = false;
+      return;
+#endif
+#endif
       watch.sendCommand(cmd, 5); // notify the app that we received the chunk, this will trigger transfer of next chunk
     }
 
@@ -1670,69 +2033,251 @@ void calendar_app_launched(void)
 
 int32_t read_encoder_position()
 {
-#ifdef M5_STACK_DIAL
-  M5Dial.update();
-  return M5Dial.Encoder.read();
-#elif defined(VIEWE_KNOB_15)
-  return myEnc.read();
+#if defined(ENCODER_A) && defined(ENCODER_B)
+  return encoderPosition;
 #endif
   return 0;
 }
 
-void logCallback(Level level, unsigned long time, String message)
+#if defined(ENCODER_A) && defined(ENCODER_B)
+void IRAM_ATTR encoderISR()
 {
-  Serial.print(message);
-  Serial1.print(message);
+  uint8_t state = (encoderState << 2) | (digitalRead(ENCODER_A) << 1) | digitalRead(ENCODER_B);
+  encoderState = state & 0x03;
+  int8_t step = encoderSteps[state & 0x0F];
+  if (step)
+  {
+    encoderPosition += step;
+    input_bus_post_encoder(encoderPosition, millis());
+  }
 }
+#endif
 
-// void lv_log_register_print_cb(lv_log_print_g_cb_t print_cb) {
-//   // Do nothing, not needed here!
-// }
-
-// void my_log_cb(lv_log_level_t level, const char *buf)
-// {
-//   Serial.write(buf, strlen(buf));
-//   Serial1.write(buf, strlen(buf));
-// }
-
-int putchar(int ch)
+#ifdef BUTTON_PIN
+void IRAM_ATTR buttonISR()
 {
-  Serial.write(ch); // Send character to Serial
-  return ch;
+  static uint32_t lastPress = 0;
+  uint32_t now = millis();
+  if (digitalRead(BUTTON_PIN) != LOW || now - lastPress < 50)
+  {
+    return;
+  }
+  lastPress = now;
+  input_bus_post_button(true, now);
+#if defined(ENCODER_A) && defined(ENCODER_B)
+  // pressing the knob re-zeroes the encoder
+  encoderPosition = 0;
+  input_bus_reset_encoder(0, now);
+#endif
 }
+#endif
 
-void loadSplash()
+void setupInput()
 {
-  int w = 122;
-  int h = 130;
-  int x = (SCREEN_WIDTH - w) / 2;
-  int y = (SCREEN_HEIGHT - h) / 2;
-  tft.fillScreen(TFT_BLACK);
-  screenBrightness(200);
-  tft.pushImage(x, y, w, h, (uint16_t *)splash);
-  delay(2000);
+#if defined(ENCODER_A) && defined(ENCODER_B)
+  pinMode(ENCODER_A, INPUT_PULLUP);
+  pinMode(ENCODER_B, INPUT_PULLUP);
+  encoderState = (digitalRead(ENCODER_A) << 1) | digitalRead(ENCODER_B);
+  attachInterrupt(digitalPinToInterrupt(ENCODER_A), encoderISR, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(ENCODER_B), encoderISR, CHANGE);
+#endif
+#ifdef BUTTON_PIN
+  pinMode(BUTTON_PIN, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(BUTTON_PIN), buttonISR, FALLING);
+#endif
 }
 
-static uint32_t my_tick(void)
+// Logs are queued in logRing and written out by logTask, so a burst of logs
+// from BLE callbacks or the render path never waits on the UART.
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE 8192
+#endif
+// -D LOG_FILE=1 also appends the logs to /log.txt on FFat, kept to two files
+#define LOG_FILE_PATH "/log.txt"
+#define LOG_FILE_OLD "/log.1.txt"
+#ifndef LOG_FILE_MAX
+#define LOG_FILE_MAX (64 * 1024)
+#endif
+
+static uint8_t logBuffer[LOG_RING_SIZE] __attribute__((aligned(4)));
+log_ring_t logRing;
+
+static uint32_t logMillis(void)
 {
   return millis();
 }
 
-void hal_setup()
-{
-
-  Serial.begin(115200); /* prepare for possible serial debug */
-  Serial1.begin(115200);
-
-  Timber.setLogCallback(logCallback);
-
-  Timber.i("Starting up device");
-
-  prefs.begin("my-app");
+#ifdef LOG_FILE
+static File logFile;
 
-  int rt = prefs.getInt("rotate", 0);
+static void logToFile(const char *line, size_t len)
+{
+  if (fsMountState != FS_MOUNTED)
+  {
+    return;
+  }
+  if (!logFile)
+  {
+    logFile = FLASH.open(LOG_FILE_PATH, FILE_APPEND);
+    if (!logFile)
+    {
+      return;
+    }
+  }
+  if (logFile.size() + len > LOG_FILE_MAX)
+  {
+    logFile.close();
+    FLASH.remove(LOG_FILE_OLD);
+    FLASH.rename(LOG_FILE_PATH, LOG_FILE_OLD);
+    logFile = FLASH.open(LOG_FILE_PATH, FILE_WRITE);
+    if (!logFile)
+    {
+      return;
+    }
+  }
+  logFile.write((const uint8_t *)line, len);
+}
+#endif
 
-#ifdef ELECROW_C3
+void logTask(void *param)
+{
+  static char line[LOG_RING_LINE];
+  while (true)
+  {
+    size_t len;
+    bool wrote = false;
+    while ((len = log_ring_pop(&logRing, line, sizeof(line), nullptr)) > 0)
+    {
+      Serial.write((const uint8_t *)line, len);
+      Serial1.write((const uint8_t *)line, len);
+#ifdef LOG_FILE
+      logToFile(line, len);
+#endif
+      wrote = true;
+    }
+#ifdef LOG_FILE
+    if (wrote && logFile)
+    {
+      logFile.flush();
+    }
+#endif
+    vTaskDelay(pdMS_TO_TICKS(wrote ? 5 : 20));
+  }
+}
+
+void startLogTask()
+{
+  log_ring_init(&logRing, logBuffer, sizeof(logBuffer), logMillis);
+  // chatty levels are capped, warnings and errors always get through
+  log_ring_set_limit(&logRing, LOG_LEVEL_VERBOSE, 20);
+  log_ring_set_limit(&logRing, LOG_LEVEL_DEBUG, 50);
+  log_ring_set_limit(&logRing, LOG_LEVEL_INFO, 100);
+  xTaskCreate(logTask, "log", 3072, nullptr, tskIDLE_PRIORITY + 1, nullptr);
+}
+
+void logCallback(Level level, unsigned long time, String message)
+{
+  log_ring_put(&logRing, (log_level_t)level, message.c_str(), message.length());
+}
+
+void lvLogCallback(lv_log_level_t level, const char *buf)
+{
+  static const log_level_t levels[] = {LOG_LEVEL_VERBOSE, LOG_LEVEL_INFO, LOG_LEVEL_WARN, LOG_LEVEL_ERROR, LOG_LEVEL_INFO};
+  log_ring_put(&logRing, level < 5 ? levels[level] : LOG_LEVEL_INFO, buf, strlen(buf));
+}
+
+// printf output, queued a line at a time. Each task fills its own line, a
+// slot is taken on the first character and given back at the newline.
+#define PUTCHAR_SLOTS 4
+
+struct PutcharLine
+{
+  TaskHandle_t owner;
+  size_t len;
+  char text[LOG_RING_LINE];
+};
+
+static PutcharLine putcharLines[PUTCHAR_SLOTS];
+static portMUX_TYPE putcharMux = portMUX_INITIALIZER_UNLOCKED;
+
+int putchar(int ch)
+{
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  PutcharLine *line = nullptr;
+
+  portENTER_CRITICAL(&putcharMux);
+  for (int i = 0; i < PUTCHAR_SLOTS && !line; i++)
+  {
+    if (putcharLines[i].owner == task)
+    {
+      line = &putcharLines[i];
+    }
+  }
+  for (int i = 0; i < PUTCHAR_SLOTS && !line; i++)
+  {
+    if (putcharLines[i].owner == nullptr)
+    {
+      line = &putcharLines[i];
+      line->owner = task;
+      line->len = 0;
+    }
+  }
+  portEXIT_CRITICAL(&putcharMux);
+
+  if (!line)
+  {
+    // more tasks mid-line than slots, the character goes out on its own
+    char c = ch;
+    log_ring_put(&logRing, LOG_LEVEL_INFO, &c, 1);
+    return ch;
+  }
+
+  // only the owner touches the slot until it is given back
+  line->text[line->len++] = ch;
+  if (ch == '\n' || line->len == sizeof(line->text))
+  {
+    log_ring_put(&logRing, LOG_LEVEL_INFO, line->text, line->len);
+    line->len = 0;
+    portENTER_CRITICAL(&putcharMux);
+    line->owner = nullptr;
+    portEXIT_CRITICAL(&putcharMux);
+  }
+  return ch;
+}
+
+void loadSplash()
+{
+  int w = 122;
+  int h = 130;
+  int x = (SCREEN_WIDTH - w) / 2;
+  int y = (SCREEN_HEIGHT - h) / 2;
+  tft.fillScreen(TFT_BLACK);
+  screenBrightness(200);
+  tft.pushImage(x, y, w, h, (uint16_t *)splash);
+}
+
+static uint32_t my_tick(void)
+{
+  return millis();
+}
+
+void hal_setup()
+{
+
+  Serial.begin(115200); /* prepare for possible serial debug */
+  Serial1.begin(115200);
+
+  startLogTask();
+  Timber.setLogCallback(logCallback);
+
+  Timber.i("Starting up device");
+
+  prefs.begin("my-app");
+  prefs_init(&nvsPrefs);
+
+  int rt = prefs_get_int(PREF_ROTATE);
+
+#ifdef ELECROW_C3
   Wire.begin(4, 5);
   init_IO_extender();
   delay(100);
@@ -1744,15 +2289,19 @@ void hal_setup()
 
 #ifdef M5_STACK_DIAL
   auto cfg = M5.config();
-  M5Dial.begin(cfg, true, false);
+  // encoder and button are read by setupInput
+  M5Dial.begin(cfg, false, false);
 #endif
+  setupInput();
   alert_states = 0x0F; // set default
-#if !defined(BUZZER_PIN) || (BUZZER_PIN == -1)
-  alert_states &= ~0x04;
-#endif
-#if !defined(VIBRATION_PIN) || (VIBRATION_PIN == -1)
-  alert_states &= ~0x08;
-#endif
+  if (!board.buzzer)
+  {
+    alert_states &= ~0x04;
+  }
+  if (!board.vibration)
+  {
+    alert_states &= ~0x08;
+  }
 
   tft.init();
   tft.initDMA();
@@ -1761,76 +2310,88 @@ void hal_setup()
   tft.setRotation(rt);
 
   loadSplash();
+  logBoardProfile();
+  bootStage("display");
 
+  startFSMount();
 
-  alert_states = prefs.getInt("alert_states", alert_states);
+  // alerts without the hardware stay off
+  alert_states &= prefs_get_int(PREF_ALERT_STATES);
 
   startToneSystem();
   startVibrationSystem();
+  sequencer_set_tone_cb(sequencerTone);
 
   feedbackTone(tone_startup, 3, T_SYSTEM);
   feedbackVibrate(pattern, 4);
 
   lv_init();
+  lv_log_register_print_cb(lvLogCallback);
 
   lv_tick_set_cb(my_tick);
+  // screen change frames go to PSRAM, without it screens animate live
+  screen_transition_set_alloc(psramAlloc, heap_caps_free);
+
+#ifdef ENABLE_GAME_TASK
+  // game simulation steps on its own task, render stays on the lvgl one
+  gameMutex = xSemaphoreCreateMutex();
+  game_runtime_set_lock(gameLock, gameUnlock);
+#endif
 
   // Setup double buffering for LVGL
   lv_display_t *display = lv_display_create(screenWidth, screenHeight);
-  lv_display_set_buffers(display, lvBuffer[0], lvBuffer[1], lvBufferSize, LV_DISPLAY_RENDER_MODE_DIRECT);
+  void *buf1 = lvBuffer[0];
+  void *buf2 = lvBuffer[1];
+  if (board.bufferPsram)
+  {
+    buf1 = allocDrawBuffer();
+    buf2 = allocDrawBuffer();
+  }
+  lv_display_set_buffers(display, buf1, buf2, lvBufferSize * sizeof(lv_color_t), board.renderMode);
   lv_display_set_flush_cb(display, my_disp_flush);
 
-#ifdef SW_ROTATION
-  lv_display_set_rotation(display, getRotation(rt));
-#endif
+  if (board.swRotation)
+  {
+    lv_display_set_rotation(display, getRotation(rt));
+  }
 
-  static auto *lvInput = lv_indev_create();
+  lvInput = lv_indev_create();
   lv_indev_set_type(lvInput, LV_INDEV_TYPE_POINTER);
   lv_indev_set_read_cb(lvInput, my_touchpad_read);
-
-  // lv_log_register_print_cb(my_log_cb);
+#ifdef TOUCH_IRQ_MODE
+  // read from the loop only when the touch interrupt fired
+  lv_indev_set_mode(lvInput, LV_INDEV_MODE_EVENT);
+  setupTouchIrq();
+#endif
+  // enabled once the other screens exist
+  lv_indev_enable(lvInput, false);
+  bootStage("lvgl");
 
   // _lv_fs_init();
 
-  ui_init();
-
-  bool fsState = setupFS();
-  if (fsState)
-  {
-    // driveList_cb(NULL);
-    Serial.println("Setup FS success");
+  ui_init_home();
 
-    Timber.i("Flash: Total %d => Used %d", FLASH.totalBytes(), FLASH.usedBytes());
-  }
-  else
-  {
-    Serial.println("Setup FS failed");
-    // showError(F_NAME, "Failed to mount the partition");
-  }
-
-  int wf = prefs.getInt("watchface", 0);
-#ifdef ENABLE_CUSTOM_FACE
-  String custom = prefs.getString("custom", "");
+  int wf = prefs_get_int(PREF_WATCHFACE);
   if (wf >= numFaces)
   {
     wf = 0; // default
   }
   currentIndex = wf;
-  if (custom != "" && fsState && loadCustomFace(custom))
-  {
-    ui_home = face_custom_root;
-  }
-  else
-  {
-    ui_home = *faces[wf].watchface; // load saved watchface power on
-  }
-#else
-  if (wf >= numFaces)
+  ui_home = *faces[wf].watchface; // load saved watchface power on
+#ifdef ENABLE_CUSTOM_FACE
+  String custom = prefs_get_str(PREF_CUSTOM_FACE);
+  if (custom != "")
   {
-    wf = 0; // default
+    // the custom face lives on FFat, wait for the mount
+    while (fsMountState == FS_PENDING)
+    {
+      delay(1);
+    }
+    if (setupFS() && loadCustomFace(custom))
+    {
+      ui_home = face_custom_root;
+    }
   }
-  currentIndex = wf;
-  ui_home = *faces[wf].watchface; // load saved watchface power on
 #endif
   lv_screen_load(ui_home);
 
@@ -1840,52 +2401,112 @@ void hal_setup()
     lv_obj_scroll_to_view(lv_obj_get_child(ui_faceSelect, wf), LV_ANIM_OFF);
   }
 
-#ifdef ESPS3_1_69
-  watch.setScreen(CS_240x296_191_RTF);
-#elif defined(VIEWE_SMARTRING) || defined(VIEWE_KNOB_15)
-  watch.setScreen(CS_466x466_143_CTF);
-#endif
-  String chip = String(ESP.getChipModel());
-  watch.setName(chip);
-  watch.setConnectionCallback(connectionCallback);
-  watch.setNotificationCallback(notificationCallback);
-  watch.setConfigurationCallback(configCallback);
-  watch.setRingerCallback(ringerCallback);
-  watch.setDataCallback(dataCallback);
-  watch.setRawDataCallback(rawDataCallback);
-  watch.begin();
-  watch.set24Hour(true);
-  watch.setBattery(85);
+#ifdef ENABLE_RTC
+  Rtc.Begin();
 
-  String about = String(ui_info_text) + "\n" + chip + "\n" + watch.getAddress();
-  lv_label_set_text(ui_aboutText, about.c_str());
+  if (!Rtc.GetIsRunning())
+  {
+    uint8_t error = Rtc.LastError();
+    if (error != 0)
+    {
+      showError("RTC", "Error on RTC");
+    }
+    Rtc.SetIsRunning(true);
+  }
 
-#if LV_USE_QRCODE == 1
-  String address = watch.getAddress();
-  address.toUpperCase();
-  String qrCode = "{\"Name\":\"" + chip + "\", \"Mac\":\"" + address + "\"}";
-  lv_qrcode_update(ui_connectImage, qrCode.c_str(), qrCode.length());
-  lv_label_set_text(ui_connectText, "Scan to connect");
+  RtcDateTime now = Rtc.GetDateTime();
+
+  watch.setTime(now.Second(), now.Minute(), now.Hour(), now.Day(), now.Month(), now.Year());
+
+  Rtc.StopAlarm();
+  Rtc.StopTimer();
+  Rtc.SetSquareWavePin(PCF8563SquareWavePinMode_None);
 #endif
-  // bool intro = prefs.getBool("intro", true);
 
-  // if (intro)
-  // {
-  //   showAlert();
-  //   prefs.putBool("intro", false);
-  // }
-  // else
-  // {
-  //   lv_obj_add_flag(ui_alertPanel, LV_OBJ_FLAG_HIDDEN);
-  // }
+  ui_update_seconds(watch.getSecond());
+
+  setupStateStore();
+  publishClock();
+  state_store_dispatch();
 
+  // first frame of the home face replaces the splash
+  screenBrightness(prefs_get_int(PREF_BRIGHTNESS));
+  lv_refr_now(NULL);
+  bootStage("home");
+}
+
+void *psramAlloc(size_t size)
+{
+  return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+
+// draw buffer for boards that keep them in PSRAM, internal RAM if there is none
+void *allocDrawBuffer()
+{
+  size_t bytes = lvBufferSize * sizeof(lv_color_t);
+  void *buf = heap_caps_aligned_alloc(32, bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (buf == NULL)
+  {
+    Timber.w("Draw buffer: no PSRAM, using internal RAM");
+    buf = heap_caps_aligned_alloc(32, bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  }
+  return buf;
+}
+
+static const char *renderModeName(lv_display_render_mode_t mode)
+{
+  switch (mode)
+  {
+  case LV_DISPLAY_RENDER_MODE_PARTIAL:
+    return "partial";
+  case LV_DISPLAY_RENDER_MODE_DIRECT:
+    return "direct";
+  case LV_DISPLAY_RENDER_MODE_FULL:
+    return "full";
+  default:
+    return "unknown";
+  }
+}
+
+// goes out with the boot timings so a log says which setup produced them
+void logBoardProfile()
+{
+  Timber.i("Board: %s %dx%d, %d buffer lines in %s, %s render", board.name, board.width, board.height,
+           board.bufferLines, board.bufferPsram ? "PSRAM" : "DRAM", renderModeName(board.renderMode));
+  Timber.i("Board: spi %dMHz dma %d, sw rotation %d, buzzer %d, vibration %d, encoder %d, button %d, touch irq %d, rtc %d, imu %d",
+           board.freqWrite / 1000000, board.dmaChannel, board.swRotation, board.buzzer, board.vibration,
+           board.encoder, board.button, board.touchIrq, board.rtc, board.imu);
+}
+
+void logFeedbackStats()
+{
+  FeedbackStats tone, vibration;
+  feedbackStats(&tone, &vibration);
+  Timber.i("Feedback: tone %d started, %d preempted, %d dropped, latency %dus max %dus, jitter max %dus",
+           tone.started, tone.preempted, tone.dropped, tone.lastLatencyUs, tone.maxLatencyUs, tone.maxJitterUs);
+  Timber.i("Feedback: vibration %d started, %d preempted, %d dropped, latency %dus max %dus, jitter max %dus",
+           vibration.started, vibration.preempted, vibration.dropped, vibration.lastLatencyUs, vibration.maxLatencyUs,
+           vibration.maxJitterUs);
+}
+
+void bootStage(const char *name)
+{
+  uint32_t now = millis();
+  Timber.i("Boot: %s took %dms, %dms since reset", name, now - bootLast, now);
+  bootLast = now;
+}
+
+// UI state that lives on the non-home screens
+void loadSettings()
+{
   // load saved preferences
-  int tm = prefs.getInt("timeout", 0);
+  int tm = prefs_get_int(PREF_TIMEOUT);
+  int rt = prefs_get_int(PREF_ROTATE);
 
-  int br = prefs.getInt("brightness", 100);
-  circular = prefs.getBool("circular", false);
-  alertSwitch = prefs.getBool("alerts", false);
-  navSwitch = prefs.getBool("autonav", false);
+  int br = prefs_get_int(PREF_BRIGHTNESS);
+  circular = prefs_get_bool(PREF_CIRCULAR);
+  alertSwitch = prefs_get_bool(PREF_ALERTS);
+  navSwitch = prefs_get_bool(PREF_AUTONAV);
 
   lv_obj_scroll_to_y(ui_settingsList, 1, LV_ANIM_ON);
   lv_obj_scroll_to_y(ui_appList, 1, LV_ANIM_ON);
@@ -1901,8 +2522,6 @@ void hal_setup()
     tm = 0;
   }
 
-  screenBrightness(br);
-
   lv_dropdown_set_selected(ui_timeoutSelect, tm);
   lv_dropdown_set_selected(ui_rotateSelect, rt);
   lv_slider_set_value(ui_brightnessSlider, br, LV_ANIM_OFF);
@@ -1934,53 +2553,13 @@ void hal_setup()
 
   setTimeout(tm);
 
-#ifdef ENABLE_CUSTOM_FACE
-  if (!fsState)
-  {
-    showError(F_NAME, "Failed to mount the partition");
-  }
-#endif
-  if (lv_fs_is_ready('S'))
-  {
-    Serial.println("Drive S is ready");
-  }
-  else
-  {
-    Serial.println("Drive S is not ready");
-  }
-
   imu_init();
 
-#ifdef ENABLE_RTC
-  Rtc.Begin();
-
-  if (!Rtc.GetIsRunning())
-  {
-    uint8_t error = Rtc.LastError();
-    if (error != 0)
-    {
-      showError("RTC", "Error on RTC");
-    }
-    Rtc.SetIsRunning(true);
-  }
-
-  RtcDateTime now = Rtc.GetDateTime();
-
-  watch.setTime(now.Second(), now.Minute(), now.Hour(), now.Day(), now.Month(), now.Year());
-
-  Rtc.StopAlarm();
-  Rtc.StopTimer();
-  Rtc.SetSquareWavePin(PCF8563SquareWavePinMode_None);
-#endif
-
-  ui_update_seconds(watch.getSecond());
-
   lv_rand_set_seed(millis());
 
   navigateInfo("Navigation", "Chronos", "Start navigation on Google maps");
 
   watch.clearNotifications();
-  notificationsUpdate = false;
   lv_obj_clean(ui_messageList);
   lv_obj_t *info = lv_label_create(ui_messageList);
   lv_obj_set_width(info, 180);
@@ -1990,159 +2569,156 @@ void hal_setup()
   lv_obj_set_style_text_font(info, &lv_font_montserrat_14, LV_PART_MAIN | LV_STATE_DEFAULT);
   lv_label_set_text(info, "No notifications available. Connect Chronos app to receive phone notifications");
 
-#if !defined(BUZZER_PIN) || (BUZZER_PIN == -1)
-  lv_obj_add_state(ui_soundsAlert, LV_STATE_DISABLED);
-#endif
-#if !defined(VIBRATION_PIN) || (VIBRATION_PIN == -1)
-  lv_obj_add_state(ui_vibrateAlert, LV_STATE_DISABLED);
-#endif
+  if (!board.buzzer)
+  {
+    lv_obj_add_state(ui_soundsAlert, LV_STATE_DISABLED);
+  }
+  if (!board.vibration)
+  {
+    lv_obj_add_state(ui_vibrateAlert, LV_STATE_DISABLED);
+  }
 
   ui_setup();
+}
 
-  Serial.println(heapUsage());
+void startBLE()
+{
+  if (board.chronosScreen >= 0)
+  {
+    watch.setScreen((ChronosScreen)board.chronosScreen);
+  }
+  String chip = String(ESP.getChipModel());
+  watch.setName(chip);
+  watch.setConnectionCallback(connectionCallback);
+  watch.setNotificationCallback(notificationCallback);
+  watch.setConfigurationCallback(configCallback);
+  watch.setRingerCallback(ringerCallback);
+  watch.setDataCallback(dataCallback);
+  watch.setRawDataCallback(rawDataCallback);
+  watch.begin();
+  watch.set24Hour(true);
+  watch.setBattery(85);
+
+  String about = String(ui_info_text) + "\n" + chip + "\n" + watch.getAddress();
+  lv_label_set_text(ui_aboutText, about.c_str());
+
+#if LV_USE_QRCODE == 1
+  String address = watch.getAddress();
+  address.toUpperCase();
+  String qrCode = "{\"Name\":\"" + chip + "\", \"Mac\":\"" + address + "\"}";
+  lv_qrcode_update(ui_connectImage, qrCode.c_str(), qrCode.length());
+  lv_label_set_text(ui_connectText, "Scan to connect");
+#endif
 
-  Timber.i("Setup done");
   Timber.i(about);
 }
 
-void hal_loop()
+// one stage per loop pass so the home face keeps rendering in between
+void bootStep()
 {
-
-  if (!transfer)
+  switch (bootState)
   {
-    lv_timer_handler(); // Update the UI-
-    delay(5);
-
-    watch.loop();
-
-#if defined(M5_STACK_DIAL) || defined(VIEWE_KNOB_15)
-    long newPosition = read_encoder_position();
-    if (newPosition != oldPosition)
+  case BOOT_SCREENS:
+    if (ui_init_step())
     {
-      input_bus_emit_encoder_event(newPosition, newPosition - oldPosition);
-      oldPosition = newPosition;
+      bootStage("screens");
+      bootState = BOOT_SETTINGS;
     }
-#endif
-#ifdef M5_STACK_DIAL
-    M5Dial.update();
-    if (M5Dial.BtnA.wasPressed())
+    break;
+  case BOOT_SETTINGS:
+    loadSettings();
+    lv_indev_enable(lvInput, true);
+    bootStage("settings");
+    Timber.i("Interactive after %dms", millis());
+    bootState = BOOT_FS;
+    break;
+  case BOOT_FS:
+  {
+    if (fsMountState == FS_PENDING)
     {
-      input_bus_emit_button_event(true);
-      M5Dial.Encoder.readAndReset();
+      break;
     }
-#endif
-
-    if (updateSeconds)
+    bool fsState = setupFS();
+    if (fsState)
     {
-      updateSeconds = false;
-      ui_update_seconds(watch.getSecond());
-    }
+      Serial.println("Setup FS success");
 
-    if (ui_home == ui_clockScreen)
-    {
-      lv_label_set_text(ui_hourLabel, watch.getHourZ().c_str());
-      lv_label_set_text(ui_dayLabel, watch.getTime("%A").c_str());
-      lv_label_set_text(ui_minuteLabel, watch.getTime("%M").c_str());
-      lv_label_set_text(ui_dateLabel, watch.getTime("%d\n%b").c_str());
-      lv_label_set_text(ui_amPmLabel, watch.getAmPmC(false).c_str());
+      Timber.i("Flash: Total %d => Used %d", FLASH.totalBytes(), FLASH.usedBytes());
     }
     else
     {
-      update_faces();
+      Serial.println("Setup FS failed");
     }
-
-    lv_disp_t *display = lv_display_get_default();
-    lv_obj_t *actScr = lv_display_get_screen_active(display);
-    if (actScr != ui_home)
+#ifdef ENABLE_CUSTOM_FACE
+    if (!fsState)
     {
+      showError(F_NAME, "Failed to mount the partition");
     }
-
-    if (weatherUpdateFace)
+#endif
+    if (lv_fs_is_ready('S'))
     {
-      lv_label_set_text_fmt(ui_weatherTemp, "%d°C", watch.getWeatherAt(0).temp);
-      // set icon ui_weatherIcon
-      setWeatherIcon(ui_weatherIcon, watch.getWeatherAt(0).icon, isDay());
-      weatherUpdateFace = false;
+      Serial.println("Drive S is ready");
     }
-
-    if (navChanged)
+    else
     {
-      navChanged = false;
-      nav = watch.getNavigation();
-      if (!nav.active)
-      {
-        nav.directions = "Start navigation on Google maps";
-        nav.title = "Chronos";
-        nav.duration = watch.isConnected() ? "Inactive" : "Disconnected";
-        nav.eta = "Navigation";
-        nav.distance = "";
-        navIcCRC = 0xFFFFFFFF;
-      }
+      Serial.println("Drive S is not ready");
+    }
+    bootStage("fs");
+    bootState = BOOT_BLE;
+  }
+  break;
+  case BOOT_BLE:
+    startBLE();
+    bootStage("ble");
 
-      if (!nav.isNavigation)
-      {
-        nav.directions = nav.title;
-        nav.title = "";
-      }
+    Serial.println(heapUsage());
+    Timber.i("Setup done");
+    bootState = BOOT_DONE;
+    break;
+  default:
+    break;
+  }
+}
 
-      String navText = nav.eta + "\n" + nav.duration + " " + nav.distance;
+void hal_loop()
+{
 
-#ifdef ENABLE_APP_NAVIGATION
-      if (actScr != get_nav_screen() && nav.active && navSwitch)
-      {
-        lastActScr = actScr;
-        if (!get_nav_screen())
-        {
-          ui_navScreen_screen_init();
-        }
-        lv_screen_load_anim(get_nav_screen(), LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
-        gameActive = true;
-        screenTimer.active = true;
-      }
-      if (actScr == get_nav_screen() && !nav.active && navSwitch && lastActScr != nullptr)
-      {
-        screenTimer.active = true;
-        lv_screen_load_anim(lastActScr, LV_SCR_LOAD_ANIM_FADE_OUT, 500, 0, false);
-      }
-#endif
-      navIconState(nav.active && nav.hasIcon);
-      navigateInfo(navText.c_str(), nav.title.c_str(), nav.directions.c_str());
+  if (!transfer)
+  {
+    lv_timer_handler(); // Update the UI-
+    delay(5);
+
+    // released only for the delay, callbacks from other tasks get in there
+    lv_lock();
+
+    if (bootState != BOOT_DONE)
+    {
+      bootStep();
     }
-    if (navIcChanged)
+    else
     {
-      navIcChanged = false;
-      nav = watch.getNavigation();
-
-      if (nav.iconCRC != navIcCRC)
-      {
-        navIcCRC = nav.iconCRC;
-        navIconState(nav.active && nav.hasIcon);
-        for (int y = 0; y < 48; y++)
-        {
-          for (int x = 0; x < 48; x++)
-          {
-            int byte_index = (y * 48 + x) / 8;
-            int bit_pos = 7 - (x % 8);
-            bool px_on = (nav.icon[byte_index] >> bit_pos) & 0x01;
-            setNavIconPx(x, y, px_on);
-          }
-        }
-      }
+      watch.loop();
     }
 
-    if (actScr == ui_appInfoScreen)
+#ifdef TOUCH_IRQ_MODE
+    if (touchIrq || touchDown)
     {
-      lv_label_set_text_fmt(ui_appBatteryText, "Battery - %d%%", watch.getPhoneBattery());
-      lv_bar_set_value(ui_appBatteryLevel, watch.getPhoneBattery(), LV_ANIM_OFF);
-      if (watch.isPhoneCharging())
-      {
-        lv_image_set_src(ui_appBatteryIcon, &ui_img_battery_plugged_png);
-      }
-      else
-      {
-        lv_image_set_src(ui_appBatteryIcon, &ui_img_battery_state_png);
-      }
+      lv_indev_read(lvInput);
     }
+#endif
+#ifdef M5_STACK_DIAL
+    M5Dial.update();
+#endif
+    input_bus_dispatch();
+
+    publishClock();
+
+    state_value_t battery;
+    battery.battery.level = watch.getPhoneBattery();
+    battery.battery.charging = watch.isPhoneCharging();
+    state_store_publish(STATE_TOPIC_PHONE_BATTERY, &battery);
+
+    state_store_dispatch();
 
     if (alertTimer.active)
     {
@@ -2171,13 +2747,29 @@ void hal_loop()
       {
         Timber.w("Screen timeout");
         screenTimer.active = false;
+        prefs_flush();
+        logFeedbackStats();
 
         screenBrightness(0);
         lv_screen_load(ui_home);
       }
     }
+    lv_unlock();
   }
 
+#ifdef ENABLE_DELTA_OTA
+  if (otaDropped)
+  {
+    otaDropped = false;
+    otaAbort();
+  }
+  if (writeFile && transfer && otaTransfer)
+  {
+    writeFile = false;
+    otaChunk(wSwitch ? buf2 : buf1, wSwitch ? wLen2 : wLen1);
+  }
+#endif
+
 #ifdef ENABLE_CUSTOM_FACE
   if (writeFile && transfer)
   {
@@ -2247,7 +2839,7 @@ void hal_loop()
 
       transfer = false;
 
-      ESP.restart();
+      restartDevice();
     }
   }
 
@@ -2259,6 +2851,173 @@ bool isDay()
   return watch.getHour(true) > 7 && watch.getHour(true) < 21;
 }
 
+void publishClock()
+{
+  tm t = watch.getTimeStruct();
+  state_value_t value;
+  value.clock.second = t.tm_sec;
+  value.clock.minute = t.tm_min;
+  value.clock.hour = t.tm_hour;
+  value.clock.day = t.tm_mday;
+  value.clock.month = t.tm_mon;
+  value.clock.weekday = t.tm_wday;
+  value.clock.year = t.tm_year + 1900;
+  state_store_publish(STATE_TOPIC_CLOCK, &value);
+}
+
+void onTimeSynced(state_topic_t topic, const state_value_t *value)
+{
+  ui_update_seconds(watch.getSecond());
+}
+
+void onHomeChanged(state_topic_t topic, const state_value_t *value)
+{
+  if (ui_home == ui_clockScreen)
+  {
+    if (topic != STATE_TOPIC_CLOCK)
+    {
+      return;
+    }
+    lv_label_set_text(ui_hourLabel, watch.getHourZ().c_str());
+    lv_label_set_text(ui_dayLabel, watch.getTime("%A").c_str());
+    lv_label_set_text(ui_minuteLabel, watch.getTime("%M").c_str());
+    lv_label_set_text(ui_dateLabel, watch.getTime("%d\n%b").c_str());
+    lv_label_set_text(ui_amPmLabel, watch.getAmPmC(false).c_str());
+  }
+  else
+  {
+    update_faces();
+  }
+}
+
+void onWeatherChanged(state_topic_t topic, const state_value_t *value)
+{
+  lv_label_set_text_fmt(ui_weatherTemp, "%d°C", value->weather.temp);
+  setWeatherIcon(ui_weatherIcon, value->weather.icon, isDay());
+}
+
+void onNavigationChanged(state_topic_t topic, const state_value_t *value)
+{
+  lv_obj_t *actScr = lv_screen_active();
+  nav = watch.getNavigation();
+  if (!nav.active)
+  {
+    nav.directions = "Start navigation on Google maps";
+    nav.title = "Chronos";
+    nav.duration = watch.isConnected() ? "Inactive" : "Disconnected";
+    nav.eta = "Navigation";
+    nav.distance = "";
+    navIcCRC = 0xFFFFFFFF;
+  }
+
+  if (!nav.isNavigation)
+  {
+    nav.directions = nav.title;
+    nav.title = "";
+  }
+
+  String navText = nav.eta + "\n" + nav.duration + " " + nav.distance;
+
+#ifdef ENABLE_APP_NAVIGATION
+  if (actScr != get_nav_screen() && nav.active && navSwitch)
+  {
+    lastActScr = actScr;
+    if (!get_nav_screen())
+    {
+      ui_navScreen_screen_init();
+    }
+    screen_transition_load(get_nav_screen(), LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
+    gameActive = true;
+    screenTimer.active = true;
+  }
+  if (actScr == get_nav_screen() && !nav.active && navSwitch && lastActScr != nullptr)
+  {
+    screenTimer.active = true;
+    screen_transition_load(lastActScr, LV_SCR_LOAD_ANIM_FADE_OUT, 500, 0);
+  }
+#endif
+  navIconState(nav.active && nav.hasIcon);
+  navigateInfo(navText.c_str(), nav.title.c_str(), nav.directions.c_str());
+}
+
+void onNavIconChanged(state_topic_t topic, const state_value_t *value)
+{
+  nav = watch.getNavigation();
+
+  if (nav.iconCRC != navIcCRC)
+  {
+    navIcCRC = nav.iconCRC;
+    navIconState(nav.active && nav.hasIcon);
+    for (int y = 0; y < 48; y++)
+    {
+      for (int x = 0; x < 48; x++)
+      {
+        int byte_index = (y * 48 + x) / 8;
+        int bit_pos = 7 - (x % 8);
+        bool px_on = (nav.icon[byte_index] >> bit_pos) & 0x01;
+        setNavIconPx(x, y, px_on);
+      }
+    }
+  }
+}
+
+void onPhoneBatteryChanged(state_topic_t topic, const state_value_t *value)
+{
+  lv_label_set_text_fmt(ui_appBatteryText, "Battery - %d%%", value->battery.level);
+  lv_bar_set_value(ui_appBatteryLevel, value->battery.level, LV_ANIM_OFF);
+  if (value->battery.charging)
+  {
+    lv_image_set_src(ui_appBatteryIcon, &ui_img_battery_plugged_png);
+  }
+  else
+  {
+    lv_image_set_src(ui_appBatteryIcon, &ui_img_battery_state_png);
+  }
+}
+
+void onConnectionChanged(state_topic_t topic, const state_value_t *value)
+{
+  if (value->connected)
+  {
+    lv_obj_remove_state(ui_btStateButton, LV_STATE_CHECKED);
+  }
+  else
+  {
+    lv_obj_add_state(ui_btStateButton, LV_STATE_CHECKED);
+  }
+  lv_label_set_text_fmt(ui_appConnectionText, "Status\n%s", value->connected ? "Connected" : "Disconnected");
+}
+
+// BLE callbacks publish on their own task, hal_loop dispatches
+static portMUX_TYPE stateMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void stateLock()
+{
+  portENTER_CRITICAL(&stateMux);
+}
+
+static void stateUnlock()
+{
+  portEXIT_CRITICAL(&stateMux);
+}
+
+void setupStateStore()
+{
+  state_store_set_lock(stateLock, stateUnlock);
+  state_store_add_sub(STATE_TOPIC_TIME_SYNC, onTimeSynced, NULL);
+  state_store_add_sub(STATE_TOPIC_CLOCK, onHomeChanged, &ui_home);
+  state_store_add_sub(STATE_TOPIC_WEATHER, onHomeChanged, &ui_home);
+  state_store_add_sub(STATE_TOPIC_PHONE_BATTERY, onHomeChanged, &ui_home);
+  state_store_add_sub(STATE_TOPIC_CONNECTION, onHomeChanged, &ui_home);
+  state_store_add_sub(STATE_TOPIC_WEATHER, onWeatherChanged, &ui_clockScreen);
+  state_store_add_sub(STATE_TOPIC_FORECAST, onForecastChanged, &ui_weatherScreen);
+  state_store_add_sub(STATE_TOPIC_NOTIFICATIONS, onNotificationsChanged, &ui_notificationScreen);
+  state_store_add_sub(STATE_TOPIC_NAVIGATION, onNavigationChanged, NULL);
+  state_store_add_sub(STATE_TOPIC_NAV_ICON, onNavIconChanged, NULL);
+  state_store_add_sub(STATE_TOPIC_PHONE_BATTERY, onPhoneBatteryChanged, &ui_appInfoScreen);
+  state_store_add_sub(STATE_TOPIC_CONNECTION, onConnectionChanged, NULL);
+}
+
 void update_faces()
 {
   int second = watch.getSecond();
@@ -2760,18 +3519,187 @@ void parseDial(const char *path, bool restart)
     deleteFile(path);
     Serial.println("Watchface parsed successfully");
 
-    prefs.putString("custom", jsnFile);
+    prefs_set_str(PREF_CUSTOM_FACE, jsnFile.c_str());
   }
 
   if (restart)
   {
     delay(500);
-    ESP.restart();
+    restartDevice();
+  }
+
+#endif
+}
+
+#ifdef ENABLE_DELTA_OTA
+// firmware delta from the app, patched into the other app slot as it arrives
+struct OtaUpdate
+{
+  const esp_partition_t *running;
+  const esp_partition_t *target;
+  esp_ota_handle_t handle;
+  bool begun;
+};
+
+static OtaUpdate ota;
+static delta_patch_t otaPatch;
+static delta_status_t otaStatus;
+
+static bool otaReadOld(void *ctx, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+  return esp_partition_read(ota.running, offset, buf, len) == ESP_OK;
+}
+
+static bool otaBegin(void *ctx, const delta_header_t *header)
+{
+  if (header->new_size > ota.target->size)
+  {
+    return false;
   }
+  ota.begun = esp_ota_begin(ota.target, header->new_size, &ota.handle) == ESP_OK;
+  return ota.begun;
+}
+
+static bool otaWrite(void *ctx, const uint8_t *data, uint32_t len)
+{
+  return esp_ota_write(ota.handle, data, len) == ESP_OK;
+}
+
+static const delta_io_t otaIo = {otaReadOld, otaBegin, otaWrite, nullptr};
+
+static void otaScreen(uint16_t color, const char *text)
+{
+  screenBrightness(200);
+  tft.fillScreen(color);
+  tft.setTextColor(TFT_WHITE, color);
+  tft.setTextSize(2);
+  tft.setCursor(60, 80);
+  tft.print(text);
+}
+
+static void otaFinish()
+{
+  transfer = false;
+  otaTransfer = false;
+  if (otaStatus == DELTA_DONE)
+  {
+    // esp_ota_end checks the image itself before it can be booted
+    if (esp_ota_end(ota.handle) == ESP_OK && esp_ota_set_boot_partition(ota.target) == ESP_OK)
+    {
+      Timber.i("Update verified, booting %s", ota.target->label);
+      otaScreen(TFT_GREEN, "Updated");
+      delay(500);
+      restartDevice();
+      return;
+    }
+    Timber.e("Update: image rejected");
+  }
+  else
+  {
+    if (ota.begun)
+    {
+      esp_ota_abort(ota.handle);
+      ota.begun = false;
+    }
+    Timber.e("Update failed: %s", delta_status_text(otaStatus));
+  }
+  otaScreen(TFT_RED, "Update failed");
+  delay(1500);
+
+  LvglLock lock;
+  lv_obj_invalidate(lv_screen_active());
+}
+
+// a malformed packet ended the transfer part way
+void otaAbort()
+{
+  otaStatus = DELTA_ERR_CORRUPT;
+  otaFinish();
+}
+
+void otaChunk(const uint8_t *data, int len)
+{
+  if (start)
+  {
+    memset(&ota, 0, sizeof(ota));
+    ota.running = esp_ota_get_running_partition();
+    ota.target = esp_ota_get_next_update_partition(nullptr);
+    delta_patch_begin(&otaPatch, &otaIo);
+    otaStatus = DELTA_MORE;
 
+    otaScreen(TFT_BLUE, "Updating");
+    tft.drawRoundRect(70, 120, 100, 20, 5, TFT_WHITE);
+    if (ota.target == nullptr || ota.target == ota.running)
+    {
+      Timber.e("Update: no second app slot, flash once with partitions_16M_ota.csv");
+      otaStatus = DELTA_ERR_IO;
+      otaFinish();
+      return;
+    }
+  }
+
+  // the first chunk also hashes the running image, a second or so
+  otaStatus = delta_patch_feed(&otaPatch, data, len);
+  if (otaStatus == DELTA_MORE || otaStatus == DELTA_DONE)
+  {
+    watch.sendCommand(otaAck, 5);
+  }
+  if (total > 0)
+  {
+    int progress = (100 * currentRecv) / total;
+    tft.fillRoundRect(70, 120, progress, 20, 5, TFT_WHITE);
+  }
+  if (otaStatus != DELTA_MORE || last)
+  {
+    otaFinish();
+  }
+}
 #endif
+
+#ifdef ENABLE_FONT_FILE
+static bool fontRead(void *ctx, uint32_t offset, void *buf, uint32_t len)
+{
+  return fontFile.seek(offset) && fontFile.read((uint8_t *)buf, len) == len;
+}
+
+static void fontLock(void *ctx)
+{
+  xSemaphoreTake(fontMutex, portMAX_DELAY);
+}
+
+static void fontUnlock(void *ctx)
+{
+  xSemaphoreGive(fontMutex);
 }
 
+void loadFontFile()
+{
+  fontFile = FLASH.open(FONT_FILE_PATH, "r");
+  if (!fontFile)
+  {
+    Timber.w("Font: no %s, notifications use the built-in fonts", FONT_FILE_PATH);
+    return;
+  }
+  fontMutex = xSemaphoreCreateMutex();
+  static const glyph_font_io_t io = {fontRead, nullptr, fontLock, fontUnlock};
+  glyph_font_status_t status = glyph_font_open(&glyphFont, &io, board.glyphCache * 1024);
+  if (status != GLYPH_FONT_OK)
+  {
+    Timber.e("Font: %s %s", FONT_FILE_PATH, glyph_font_status_text(status));
+    fontFile.close();
+    return;
+  }
+  // letters the file lacks come from the fonts the labels had
+  glyph_font_bind(&glyphFont, &notifyFont, LV_FONT_DEFAULT);
+  glyph_font_bind(&glyphFont, &alertFont, &lv_font_montserrat_16);
+  lv_obj_set_style_text_font(ui_messageContent, &notifyFont, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_text_font(ui_messageList, &notifyFont, LV_PART_MAIN | LV_STATE_DEFAULT); // inherited by the items
+  lv_obj_set_style_text_font(ui_alertText, &alertFont, LV_PART_MAIN | LV_STATE_DEFAULT);
+  fontReady = true;
+  Timber.i("Font: %s, %d KB glyph cache", FONT_FILE_PATH, board.glyphCache);
+}
+#endif
+
 bool lvImgHeader(uint8_t *byteArray, uint8_t cf, uint16_t w, uint16_t h, uint16_t stride)
 {
 
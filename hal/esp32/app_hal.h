@@ -6,6 +6,8 @@
 
 #elif ESPS3_1_69
 // 240x280 watchfaces
+#define FACE_RES_W 240
+#define FACE_RES_H 280
 
 #define ENABLE_FACE_174 // (174)
 // #define ENABLE_FACE_228 // (228)
@@ -18,9 +20,12 @@
 
 
 #elif defined(VIEWE_SMARTRING) || defined(VIEWE_KNOB_15)
+// 466x466, faces from 240 sources are drawn at their size
+#define FACE_RES_W 466
+#define FACE_RES_H 466
 
-#define ENABLE_FACE_756_2_466 // (Red)
-#define ENABLE_FACE_RADAR_466 // (Radar)
+#define ENABLE_FACE_756_2 // (Red)
+#define ENABLE_FACE_RADAR // (Radar)
 #define ENABLE_FACE_75_2 // (Analog)
 #define ENABLE_FACE_34_2 // (Shadow) 
 
@@ -58,7 +63,7 @@
 
 #define ENABLE_APP_CALENDAR
 #define ENABLE_APP_SAMPLE
-// #define ENABLE_GAME_TASK
+// #define ENABLE_GAME_TASK // step games on a separate task, optional
 // #define ENABLE_GAME_RACING
 
 #define ENABLE_GAME_SIMON
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <ChronosESP32.h>
+
+#include "app_hal.h"
+#include "displays/pins.h"
+
+/*
+  Everything the HAL needs to know about the board it runs on, picked once at
+  compile time from the board define in platformio.ini. Code that only differs
+  in a value reads it from `board` instead of growing another #ifdef, so a new
+  board is one entry here plus its pins.
+
+  Pin numbers stay in pins.h, and code that needs a board only library or pin
+  symbol (M5Dial, encoder, RTC) still uses the preprocessor.
+*/
+
+// capabilities that follow from the pins
+#if defined(BUZZER_PIN) && (BUZZER_PIN != -1)
+#define BOARD_HAS_BUZZER true
+#else
+#define BOARD_HAS_BUZZER false
+#endif
+
+#if defined(VIBRATION_PIN) && (VIBRATION_PIN != -1)
+#define BOARD_HAS_VIBRATION true
+#else
+#define BOARD_HAS_VIBRATION false
+#endif
+
+#if defined(ENCODER_A) && defined(ENCODER_B)
+#define BOARD_HAS_ENCODER true
+#else
+#define BOARD_HAS_ENCODER false
+#endif
+
+#ifdef BUTTON_PIN
+#define BOARD_HAS_BUTTON true
+#else
+#define BOARD_HAS_BUTTON false
+#endif
+
+#if defined(TP_INT) && (TP_INT >= 0)
+// CST816S interrupt line is wired, read touch only while it is active
+#define TOUCH_IRQ_MODE
+#define BOARD_HAS_TOUCH_IRQ true
+#else
+#define BOARD_HAS_TOUCH_IRQ false
+#endif
+
+#ifdef ENABLE_RTC
+#define BOARD_HAS_RTC true
+#else
+#define BOARD_HAS_RTC false
+#endif
+
+#ifdef ENABLE_APP_QMI8658C
+#define BOARD_HAS_IMU true
+#else
+#define BOARD_HAS_IMU false
+#endif
+
+struct BoardProfile
+{
+  const char *name;
+  uint16_t width;
+  uint16_t height;
+
+  // display bus, unused by drivers that set up their own
+  spi_host_device_t spiHost;
+  uint32_t freqWrite; // 0 keeps the driver default
+  uint32_t freqRead;
+  int dmaChannel;
+
+  // lvgl draw buffers, two of bufferLines rows each
+  uint16_t bufferLines;
+  bool bufferPsram; // falls back to internal RAM when PSRAM is missing
+  lv_display_render_mode_t renderMode;
+  bool swRotation; // the panel cannot rotate, lvgl does it
+
+  int chronosScreen; // ChronosScreen reported to the app, -1 for the default
+  uint16_t glyphCache; // KB of RAM for glyphs of the font file (ENABLE_FONT_FILE)
+
+  bool buzzer;
+  bool vibration;
+  bool encoder;
+  bool button;
+  bool touchIrq;
+  bool rtc;
+  bool imu;
+};
+
+#define BOARD_CAPABILITIES BOARD_HAS_BUZZER, BOARD_HAS_VIBRATION, BOARD_HAS_ENCODER, BOARD_HAS_BUTTON, \
+                           BOARD_HAS_TOUCH_IRQ, BOARD_HAS_RTC, BOARD_HAS_IMU
+
+// --- Boards ---
+#ifdef ELECROW_C3
+static constexpr BoardProfile board = {
+    "Elecrow C3 1.28", SCREEN_WIDTH, SCREEN_HEIGHT,
+    SPI2_HOST, 80000000, 20000000, 1,
+    40, false, LV_DISPLAY_RENDER_MODE_PARTIAL, false,
+    -1,
+    12,
+    BOARD_CAPABILITIES};
+#elif ESPC3
+static constexpr BoardProfile board = {
+    "ESP32 C3 1.28", SCREEN_WIDTH, SCREEN_HEIGHT,
+    SPI2_HOST, 80000000, 20000000, 1,
+    40, false, LV_DISPLAY_RENDER_MODE_PARTIAL, false,
+    -1,
+    12,
+    BOARD_CAPABILITIES};
+#elif ESPS3_1_28
+static constexpr BoardProfile board = {
+    "ESP32 S3 1.28", SCREEN_WIDTH, SCREEN_HEIGHT,
+    SPI2_HOST, 80000000, 20000000, 1,
+    40, false, LV_DISPLAY_RENDER_MODE_PARTIAL, false,
+    -1,
+    32,
+    BOARD_CAPABILITIES};
+#elif ESPS3_1_69
+static constexpr BoardProfile board = {
+    "ESP32 S3 1.69", SCREEN_WIDTH, SCREEN_HEIGHT,
+    SPI2_HOST, 80000000, 20000000, 1,
+    40, false, LV_DISPLAY_RENDER_MODE_PARTIAL, false,
+    CS_240x296_191_RTF,
+    32,
+    BOARD_CAPABILITIES};
+#elif M5_STACK_DIAL
+static constexpr BoardProfile board = {
+    "M5 Dial", SCREEN_WIDTH, SCREEN_HEIGHT,
+    SPI2_HOST, 0, 0, 0,
+    40, false, LV_DISPLAY_RENDER_MODE_PARTIAL, false,
+    -1,
+    32,
+    BOARD_CAPABILITIES};
+#elif VIEWE_SMARTRING
+static constexpr BoardProfile board = {
+    "Viewe SmartRing", SCREEN_WIDTH, SCREEN_HEIGHT,
+    SPI2_HOST, 0, 0, 0,
+    40, false, LV_DISPLAY_RENDER_MODE_PARTIAL, true,
+    CS_466x466_143_CTF,
+    64,
+    BOARD_CAPABILITIES};
+#elif VIEWE_KNOB_15
+static constexpr BoardProfile board = {
+    "Viewe Knob 1.5", SCREEN_WIDTH, SCREEN_HEIGHT,
+    SPI2_HOST, 0, 0, 0,
+    40, false, LV_DISPLAY_RENDER_MODE_PARTIAL, true,
+    CS_466x466_143_CTF,
+    64,
+    BOARD_CAPABILITIES};
+#else
+static constexpr BoardProfile board = {
+    "ESP32", SCREEN_WIDTH, SCREEN_HEIGHT,
+    SPI2_HOST, 80000000, 20000000, 1,
+    40, false, LV_DISPLAY_RENDER_MODE_PARTIAL, false,
+    -1,
+    16,
+    BOARD_CAPABILITIES};
+#endif
@@ -5,6 +5,7 @@
 #include <LovyanGFX.hpp>
 
 #include "pins.h"
+#include "../board_profile.h"
 
 
 class LGFX : public lgfx::LGFX_Device
@@ -22,12 +23,12 @@ public:
       auto cfg = _bus_instance.config();
 
       // SPI bus settings for DMA - use only properties supported in LovyanGFX 1.1.16
-      cfg.spi_host = SPI2_HOST;  // For ESP32-S3
+      cfg.spi_host = board.spiHost;
       cfg.spi_mode = 0;
-      cfg.freq_write = 80000000;  // Maximum frequency for good stability
-      cfg.freq_read = 20000000;
+      cfg.freq_write = board.freqWrite;
+      cfg.freq_read = board.freqRead;
       cfg.use_lock = true;
-      cfg.dma_channel = 1;       // Use explicit DMA channel
+      cfg.dma_channel = board.dmaChannel;
       cfg.pin_sclk = SCLK;
       cfg.pin_mosi = MOSI;
       cfg.pin_miso = MISO;
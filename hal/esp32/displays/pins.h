@@ -164,6 +164,10 @@
 
 #define BUZZER_PIN 3
 
+#define ENCODER_A 41
+#define ENCODER_B 40
+#define BUTTON_PIN 42
+
 #define MAX_FILE_OPEN 10
 
 #elif VIEWE_SMARTRING
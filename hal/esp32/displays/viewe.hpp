@@ -5,6 +5,7 @@
 #include "TouchDrvCSTXXX.hpp"
 
 #include "pins.h"
+#include "../board_profile.h"
 
 #define TFT_BLACK 0x00000
 
@@ -41,7 +42,7 @@ public:
         pinMode(LCD_EN, OUTPUT);
         digitalWrite(LCD_EN, HIGH);
 #endif
-        bool state = gfx->begin();
+        bool state = board.freqWrite ? gfx->begin(board.freqWrite) : gfx->begin();
         touch.setPins(TOUCH_RST, TOUCH_IRQ);
         touch.begin(Wire, 0x15, TOUCH_SDA, TOUCH_SCL);
         return state;
@@ -4,29 +4,39 @@
 #include "app_hal.h"
 #include "displays/pins.h"
 
-// A struct to hold a sequence of notes
-struct NoteSequence
+#include "esp_timer.h"
+
+// A queued sequence, notes and steps are referenced, not copied
+struct FeedbackItem
 {
-    Note notes[MAX_NOTES_PER_SEQUENCE];
+    const Note *notes;
+    const Vibration *steps;
+    Note single; // used by feedbackNote when notes is null
     int count;
     int repeat;
+    ToneType type;
+    int64_t queuedAt;
 };
 
-struct VibPattern
+struct FeedbackChannel
 {
-    Vibration steps[MAX_VIB_PATTERN_LENGTH];
-    int count;
+    esp_timer_handle_t timer;
+    FeedbackItem current;
+    FeedbackItem queue[MAX_QUEUE_SIZE];
+    int queued;
+    bool active;
+    bool starting;
+    int index;
+    int round;
+    int64_t due;
+    uint32_t generation; // bumped by submit and stop, a step in flight checks it
+    FeedbackStats stats;
 };
 
-QueueHandle_t noteQueue;
-TaskHandle_t toneTaskHandle = nullptr;
-volatile bool playing = false;
-volatile ToneType currentToneType = T_USER;
-volatile bool forceInterrupt = false;
+static portMUX_TYPE feedbackMux = portMUX_INITIALIZER_UNLOCKED;
 
-QueueHandle_t vibQueue;
-TaskHandle_t vibTaskHandle = nullptr;
-volatile bool vibrating = false;
+static FeedbackChannel toneChannel;
+static FeedbackChannel vibChannel;
 
 Note tone_melody[] = {
     {440, 300}, // A4
@@ -119,119 +129,294 @@ Vibration pattern[] = {
     {false, 200}, // OFF for 200ms
 };
 
-void toneTask(void *param)
+// lower ToneType value is higher priority
+static bool outranks(ToneType a, ToneType b)
+{
+    return a < b;
+}
+
+static void applyTone(const FeedbackItem *item, int index)
 {
 #if defined(BUZZER_PIN) && (BUZZER_PIN != -1)
+    const Note *note = item->notes ? &item->notes[index] : &item->single;
+    ledcWriteTone(BUZZER_CHANNEL, note->pitch > 0 ? note->pitch : 0);
+#endif
+}
 
-    NoteSequence sequence;
+static void applyVibration(const FeedbackItem *item, int index)
+{
+#if defined(VIBRATION_PIN) && (VIBRATION_PIN != -1)
+#ifndef ELECROW_C3
+    // the ELECROW motor sits behind the I2C expander, it stays on for the whole pattern
+    vibratePin(item->steps[index].on);
+#endif
+#endif
+}
 
-    while (true)
+static int stepDuration(const FeedbackItem *item, int index)
+{
+    if (item->steps)
     {
-        if (xQueueReceive(noteQueue, &sequence, portMAX_DELAY) == pdTRUE)
-        {
-            playing = true;
+        return item->steps[index].duration;
+    }
+    return item->notes ? item->notes[index].duration : item->single.duration;
+}
 
+static void channelOutput(FeedbackChannel *ch, bool on)
+{
+    if (ch == &toneChannel)
+    {
+#if defined(BUZZER_PIN) && (BUZZER_PIN != -1)
+        if (on)
+        {
             ledcAttachPin(BUZZER_PIN, BUZZER_CHANNEL);
+        }
+        else
+        {
+            ledcWriteTone(BUZZER_CHANNEL, 0);
+            ledcDetachPin(BUZZER_PIN);
+        }
+#endif
+    }
+    else
+    {
+#if defined(VIBRATION_PIN) && (VIBRATION_PIN != -1)
+#ifdef ELECROW_C3
+        vibratePin(on);
+#else
+        if (!on)
+        {
+            vibratePin(false);
+        }
+#endif
+#endif
+    }
+}
 
-            if (sequence.repeat == 0)
-            {
-                sequence.repeat = 1;
-            }
+// runs in the esp_timer task, one call per step
+static void channelStep(void *arg)
+{
+    FeedbackChannel *ch = (FeedbackChannel *)arg;
+    int64_t now = esp_timer_get_time();
+    bool start = false, stop = false;
+    FeedbackItem item;
+    int index = 0;
+    uint32_t generation;
+
+    portENTER_CRITICAL(&feedbackMux);
+    if (!ch->active)
+    {
+        portEXIT_CRITICAL(&feedbackMux);
+        return;
+    }
+    if (ch->starting)
+    {
+        ch->starting = false;
+        start = true;
+        uint32_t latency = now - ch->current.queuedAt;
+        ch->stats.lastLatencyUs = latency;
+        if (latency > ch->stats.maxLatencyUs)
+        {
+            ch->stats.maxLatencyUs = latency;
+        }
+        ch->stats.started++;
+    }
+    else
+    {
+        uint32_t jitter = now > ch->due ? now - ch->due : 0;
+        if (jitter > ch->stats.maxJitterUs)
+        {
+            ch->stats.maxJitterUs = jitter;
+        }
+    }
 
-            for (int r = 0; r < sequence.repeat; r++)
+    if (ch->index >= ch->current.count)
+    {
+        ch->index = 0;
+        ch->round++;
+        if (ch->round >= ch->current.repeat)
+        {
+            if (ch->queued > 0)
             {
-                for (int n = 0; n < sequence.count; n++)
+                // next sequence, already sorted by priority
+                ch->current = ch->queue[0];
+                memmove(&ch->queue[0], &ch->queue[1], (ch->queued - 1) * sizeof(FeedbackItem));
+                ch->queued--;
+                ch->round = 0;
+                uint32_t latency = now - ch->current.queuedAt;
+                ch->stats.lastLatencyUs = latency;
+                if (latency > ch->stats.maxLatencyUs)
                 {
-                    if (forceInterrupt)
-                    {
-                        forceInterrupt = false;
-                        break;
-                    }
-
-                    int pitch = sequence.notes[n].pitch;
-                    int duration = sequence.notes[n].duration;
-
-                    if (pitch > 0)
-                    {
-                        ledcWriteTone(BUZZER_CHANNEL, pitch);
-                    }
-                    else
-                    {
-                        ledcWriteTone(BUZZER_CHANNEL, 0); // Rest
-                    }
-                    vTaskDelay(pdMS_TO_TICKS(duration));
+                    ch->stats.maxLatencyUs = latency;
                 }
+                ch->stats.started++;
+            }
+            else
+            {
+                ch->active = false;
+                stop = true;
             }
+        }
+    }
+    if (!stop)
+    {
+        item = ch->current;
+        index = ch->index++;
+    }
+    generation = ch->generation;
+    portEXIT_CRITICAL(&feedbackMux);
 
-            ledcDetachPin(BUZZER_PIN);
+    if (stop)
+    {
+        channelOutput(ch, false);
+        return;
+    }
+    if (start)
+    {
+        channelOutput(ch, true);
+    }
 
-            playing = false;
+    if (ch == &toneChannel)
+    {
+        applyTone(&item, index);
+    }
+    else
+    {
+        applyVibration(&item, index);
+    }
+
+    int64_t duration = (int64_t)stepDuration(&item, index) * 1000;
+    portENTER_CRITICAL(&feedbackMux);
+    bool current = ch->generation == generation;
+    bool active = ch->active;
+    if (current)
+    {
+        ch->due = now + duration;
+    }
+    portEXIT_CRITICAL(&feedbackMux);
+
+    if (!current)
+    {
+        // stopped or preempted while the pin was driven, the stop may have
+        // switched the output off before this step switched it on again
+        if (!active)
+        {
+            channelOutput(ch, false);
         }
+        return;
     }
-#endif
+    esp_timer_start_once(ch->timer, duration > 0 ? duration : 1);
 }
 
-void vibrationTask(void *param)
+static void channelInit(FeedbackChannel *ch, const char *name)
 {
-#if defined(VIBRATION_PIN) && (VIBRATION_PIN != -1)
-#ifndef ELECROW_C3
-    pinMode(VIBRATION_PIN, OUTPUT);
-#endif
-    VibPattern pattern;
+    if (ch->timer)
+    {
+        return;
+    }
+    esp_timer_create_args_t args = {};
+    args.callback = channelStep;
+    args.arg = ch;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = name;
+    esp_timer_create(&args, &ch->timer);
+}
 
-    while (true)
+static void channelSubmit(FeedbackChannel *ch, const FeedbackItem *item, bool preemptEqual)
+{
+    if (!ch->timer || item->count <= 0)
     {
-        if (xQueueReceive(vibQueue, &pattern, portMAX_DELAY) == pdTRUE)
-        {
-            vibrating = true;
+        return;
+    }
 
-#ifdef ELECROW_C3
-            vibratePin(true);
-            for (int i = 0; i < pattern.count; i++)
-            {
-                delay(pattern.steps[i].duration);
-            }
-#else
-            for (int i = 0; i < pattern.count; i++)
+    bool kick = false;
+    portENTER_CRITICAL(&feedbackMux);
+    bool preempt = !ch->active || outranks(item->type, ch->current.type) ||
+                   (preemptEqual && item->type == ch->current.type);
+    if (preempt)
+    {
+        if (ch->active)
+        {
+            ch->stats.preempted++;
+        }
+        // drop anything still waiting, like the old queue reset
+        ch->stats.dropped += ch->queued;
+        ch->queued = 0;
+        ch->current = *item;
+        ch->index = 0;
+        ch->round = 0;
+        ch->starting = true;
+        ch->active = true;
+        ch->generation++;
+        kick = true;
+    }
+    else
+    {
+        // keep the queue ordered by priority, FIFO within one priority
+        int pos = ch->queued;
+        while (pos > 0 && outranks(item->type, ch->queue[pos - 1].type))
+        {
+            pos--;
+        }
+        if (ch->queued == MAX_QUEUE_SIZE)
+        {
+            ch->stats.dropped++;
+            if (pos == MAX_QUEUE_SIZE)
             {
-                vibratePin(pattern.steps[i].on);
-                delay(pattern.steps[i].duration);
+                portEXIT_CRITICAL(&feedbackMux);
+                return;
             }
-#endif
-
-            vibratePin(false);
-            vibrating = false;
+            ch->queued--;
         }
+        memmove(&ch->queue[pos + 1], &ch->queue[pos], (ch->queued - pos) * sizeof(FeedbackItem));
+        ch->queue[pos] = *item;
+        ch->queued++;
+    }
+    portEXIT_CRITICAL(&feedbackMux);
+
+    if (kick)
+    {
+        // the first step runs in the timer task like every other step
+        esp_timer_stop(ch->timer);
+        esp_timer_start_once(ch->timer, 1);
     }
-#endif
 }
 
-void startToneSystem()
+static void channelStop(FeedbackChannel *ch)
 {
-#if defined(BUZZER_PIN) && (BUZZER_PIN != -1)
-
-    if (!noteQueue)
+    if (!ch->timer)
     {
-        noteQueue = xQueueCreate(MAX_QUEUE_SIZE, sizeof(NoteSequence));
+        return;
     }
-    if (!toneTaskHandle)
+    portENTER_CRITICAL(&feedbackMux);
+    bool wasActive = ch->active;
+    ch->stats.dropped += ch->queued;
+    ch->queued = 0;
+    ch->active = false;
+    ch->generation++;
+    portEXIT_CRITICAL(&feedbackMux);
+
+    esp_timer_stop(ch->timer);
+    if (wasActive)
     {
-        xTaskCreatePinnedToCore(toneTask, "toneTask", 2048, nullptr, 1, &toneTaskHandle, 0);
+        channelOutput(ch, false);
     }
+}
+
+void startToneSystem()
+{
+#if defined(BUZZER_PIN) && (BUZZER_PIN != -1)
+    channelInit(&toneChannel, "tone");
 #endif
 }
 
 void startVibrationSystem()
 {
 #if defined(VIBRATION_PIN) && (VIBRATION_PIN != -1)
-    if (!vibQueue)
-    {
-        vibQueue = xQueueCreate(MAX_QUEUE_SIZE, sizeof(VibPattern));
-    }
-    if (!vibTaskHandle)
-    {
-        xTaskCreatePinnedToCore(vibrationTask, "vibrationTask", 2048, nullptr, 1, &vibTaskHandle, 0);
-    }
+#ifndef ELECROW_C3
+    pinMode(VIBRATION_PIN, OUTPUT);
+#endif
+    channelInit(&vibChannel, "vibration");
 #endif
 }
 
@@ -240,53 +425,74 @@ void feedbackTone(Note *notes, int count, ToneType type, int repeat)
 #if defined(BUZZER_PIN) && (BUZZER_PIN != -1)
     if (check_alert_state(ALERT_SOUND))
     {
-        if (!noteQueue)
-            startToneSystem();
-
-        if (count > MAX_NOTES_PER_SEQUENCE)
-            count = MAX_NOTES_PER_SEQUENCE;
-
-        if (playing && currentToneType >= type)
-        {
-            // If the current tone is of the same or higher priority, reset the queue
-            forceInterrupt = true;
-            xQueueReset(noteQueue);
-        }
-
-        NoteSequence sequence;
-        sequence.count = count;
-        sequence.repeat = repeat;
-        memcpy(sequence.notes, notes, count * sizeof(Note));
+        startToneSystem();
+
+        FeedbackItem item = {};
+        item.notes = notes;
+        item.count = count;
+        item.repeat = repeat > 0 ? repeat : 1;
+        item.type = type;
+        item.queuedAt = esp_timer_get_time();
+        channelSubmit(&toneChannel, &item, true);
+    }
+#endif
+}
 
-        xQueueSend(noteQueue, &sequence, 0);
-        currentToneType = type;
+void feedbackNote(int pitch, int duration, ToneType type)
+{
+#if defined(BUZZER_PIN) && (BUZZER_PIN != -1)
+    if (check_alert_state(ALERT_SOUND))
+    {
+        startToneSystem();
+
+        FeedbackItem item = {};
+        item.single.pitch = pitch;
+        item.single.duration = duration;
+        item.count = 1;
+        item.repeat = 1;
+        item.type = type;
+        item.queuedAt = esp_timer_get_time();
+        channelSubmit(&toneChannel, &item, true);
     }
 #endif
 }
 
-void feedbackVibrate(Vibration *steps, int count, bool force)
+void feedbackVibrate(Vibration *steps, int count, bool force, ToneType type)
 {
 #if defined(VIBRATION_PIN) && (VIBRATION_PIN != -1)
     if (check_alert_state(ALERT_VIBRATE))
     {
-        if (!vibQueue)
-            startVibrationSystem();
-
-        if (count > MAX_VIB_PATTERN_LENGTH)
-            count = MAX_VIB_PATTERN_LENGTH;
-
-        if (force && vibrating)
-        {
-            xQueueReset(vibQueue);
-        }
+        startVibrationSystem();
+
+        FeedbackItem item = {};
+        item.steps = steps;
+        item.count = count;
+        item.repeat = 1;
+        item.type = type;
+        item.queuedAt = esp_timer_get_time();
+        channelSubmit(&vibChannel, &item, force);
+    }
+#endif
+}
 
-        VibPattern pattern;
-        pattern.count = count;
-        memcpy(pattern.steps, steps, count * sizeof(Vibration));
+void feedbackStop()
+{
+    channelStop(&toneChannel);
+    channelStop(&vibChannel);
+}
 
-        xQueueSend(vibQueue, &pattern, 0);
+void feedbackStats(FeedbackStats *tone, FeedbackStats *vibration)
+{
+    portENTER_CRITICAL(&feedbackMux);
+    if (tone)
+    {
+        *tone = toneChannel.stats;
     }
-#endif
+    if (vibration)
+    {
+        *vibration = vibChannel.stats;
+    }
+    portEXIT_CRITICAL(&feedbackMux);
 }
 
 void feedbackRun(ToneType type)
@@ -295,23 +501,23 @@ void feedbackRun(ToneType type)
     {
     case T_CALLS:
         feedbackTone(tone_call, 8, T_CALLS, 3);
-        feedbackVibrate(pattern, 4, true);
+        feedbackVibrate(pattern, 4, true, T_CALLS);
         break;
     case T_NOTIFICATION:
         feedbackTone(tone_notification, 3, T_NOTIFICATION, 2);
-        feedbackVibrate(v_notif, 2, true);
+        feedbackVibrate(v_notif, 2, true, T_NOTIFICATION);
         break;
     case T_TIMER:
         feedbackTone(tone_alarm, 7, T_TIMER);
-        feedbackVibrate(pattern, 4, true);
+        feedbackVibrate(pattern, 4, true, T_TIMER);
         break;
     case T_ALARM:
         feedbackTone(tone_timer, 6, T_TIMER, 3);
-        feedbackVibrate(pattern, 4, true);
+        feedbackVibrate(pattern, 4, true, T_TIMER);
         break;
     case T_SYSTEM:
         feedbackTone(tone_button, 1, T_SYSTEM);
-        feedbackVibrate(pattern, 2, true);
+        feedbackVibrate(pattern, 2, true, T_SYSTEM);
         break;
     default:
         break;
@@ -3,6 +3,8 @@
 #ifndef FEEDBACK_H
 #define FEEDBACK_H
 
+#include <stdint.h>
+
 #define TONE_AN 220 // 440 Hz
 #define TONE_AS 233 // 466 Hz
 #define TONE_BN 247 // 493 Hz
@@ -19,9 +21,6 @@
 #define BUZZER_CHANNEL 0
 
 #define MAX_QUEUE_SIZE 8
-#define MAX_NOTES_PER_SEQUENCE 16
-
-#define MAX_VIB_PATTERN_LENGTH 16
 
 enum ToneType
 {
@@ -45,6 +44,17 @@ struct Vibration
     int duration;
 };
 
+// Per channel counters, times in microseconds
+struct FeedbackStats
+{
+    uint32_t started;      // sequences that started playing
+    uint32_t preempted;    // sequences cut short by a higher priority one
+    uint32_t dropped;      // queued sequences discarded
+    uint32_t lastLatencyUs; // request to first step of the last sequence
+    uint32_t maxLatencyUs;
+    uint32_t maxJitterUs;  // worst late step
+};
+
 enum AlertType
 {
     ALERT_POPUP = 0x01,
@@ -70,8 +80,12 @@ extern Note tone_simonsays_gameover[];
 void startToneSystem();
 void startVibrationSystem();
 
+// notes and steps are played by reference, they must outlive playback
 void feedbackTone(Note *notes, int count, ToneType type, int repeat = 0);
-void feedbackVibrate(Vibration *steps, int count, bool force = false);
+void feedbackNote(int pitch, int duration, ToneType type);
+void feedbackVibrate(Vibration *steps, int count, bool force = false, ToneType type = T_USER);
+void feedbackStop();
+void feedbackStats(FeedbackStats *tone, FeedbackStats *vibration);
 
 void screen_on(long extra = 0);
 
@@ -34,6 +34,11 @@
 #include "Arduino.h"
 #include <LovyanGFX.hpp>
 #include <Timber.h>
+// the mbed core (pipico env) has no LittleFS, settings stay in RAM there
+#ifndef ARDUINO_ARCH_MBED
+#define PREFS_LITTLEFS
+#include <LittleFS.h>
+#endif
 #include "app_hal.h"
 
 #include <lvgl.h>
@@ -52,6 +57,8 @@
 
 #define buf_size 20
 
+#define PREFS_FILE "/prefs.txt"
+
 class LGFX : public lgfx::LGFX_Device
 {
 public:
@@ -340,6 +347,8 @@ void onBrightnessChange(lv_event_t *e)
   lv_obj_t *slider = (lv_obj_t *)lv_event_get_target(e);
   int v = lv_slider_get_value(slider);
   screenBrightness(v);
+
+  prefs_set_int(PREF_BRIGHTNESS, v);
 }
 
 void onScrollMode(lv_event_t *e) {}
@@ -348,12 +357,14 @@ void onTimeoutChange(lv_event_t *e) {
   lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
   uint16_t sel = lv_dropdown_get_selected(obj);
   setTimeout(sel);
+  prefs_set_int(PREF_TIMEOUT, sel);
 }
 
 void onRotateChange(lv_event_t *e)
 {
   lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
   uint16_t sel = lv_dropdown_get_selected(obj);
+  prefs_set_int(PREF_ROTATE, sel);
   tft.setRotation(sel);
   // screen rotation has changed, invalidate to redraw
   lv_obj_invalidate(lv_screen_active());
@@ -369,13 +380,13 @@ void onMusicPlay(lv_event_t *e)
 void onMusicPrevious(lv_event_t *e)
 {
   lv_label_set_text(ui_callName, "World");
-  lv_screen_load_anim(ui_callScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
+  screen_transition_load(ui_callScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
 }
 
 void onMusicNext(lv_event_t *e)
 {
   lv_label_set_text(ui_cameraLabel, "Click capture to close to close");
-  lv_screen_load_anim(ui_cameraScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
+  screen_transition_load(ui_cameraScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
 }
 
 void onStartSearch(lv_event_t *e) {}
@@ -417,12 +428,32 @@ void onRTWState(bool state)
 {
 }
 
-void savePrefInt(const char *key, int value) {}
+#ifdef PREFS_LITTLEFS
+// preferences are kept as a text file on the LittleFS partition
+size_t loadPrefsFile(char *buf, size_t size)
+{
+  File file = LittleFS.open(PREFS_FILE, "r");
+  if (!file)
+  {
+    return 0;
+  }
+  size_t len = file.readBytes(buf, size);
+  file.close();
+  return len;
+}
 
-int getPrefInt(const char *key, int def_value)
+bool savePrefsFile(const char *buf, size_t len)
 {
-  return def_value;
+  File file = LittleFS.open(PREFS_FILE, "w");
+  if (!file)
+  {
+    return false;
+  }
+  size_t written = file.write((const uint8_t *)buf, len);
+  file.close();
+  return written == len;
 }
+#endif
 
 void toneOut(int pitch, int duration) {}
 
@@ -454,7 +485,7 @@ void onMessageClick(lv_event_t *e)
 
 void onCaptureClick(lv_event_t *e)
 {
-  lv_screen_load_anim(ui_home, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
+  screen_transition_load(ui_home, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
 }
 
 void addFaceList(lv_obj_t *parent, Face face) {}
@@ -631,14 +662,28 @@ void hal_setup()
 
   Timber.i("Starting up device");
 
+#ifdef PREFS_LITTLEFS
+  if (LittleFS.begin())
+  {
+    prefs_init(prefs_text_backend(loadPrefsFile, savePrefsFile));
+  }
+  else
+  {
+    Timber.w("LittleFS mount failed, settings will not be saved");
+    prefs_init(NULL);
+  }
+#else
+  prefs_init(NULL);
+#endif
+
+  int rt = prefs_get_int(PREF_ROTATE);
+
   tft.init();
   tft.initDMA();
   tft.startWrite();
   tft.fillScreen(TFT_BLACK);
 
-  
-
-  // tft.setRotation(rt);
+  tft.setRotation(rt);
   loadSplash();
 
   printf("Hello from printf!\n");
@@ -685,7 +730,15 @@ void hal_setup()
   screenTimer.active = true;
   screenTimer.time = millis();
 
-  setTimeout(0);
+  int tm = prefs_get_int(PREF_TIMEOUT);
+  if (tm < 0 || tm > 4)
+  {
+    tm = 0;
+  }
+  setTimeout(tm);
+  lv_dropdown_set_selected(ui_timeoutSelect, tm);
+  lv_dropdown_set_selected(ui_rotateSelect, rt);
+  lv_slider_set_value(ui_brightnessSlider, prefs_get_int(PREF_BRIGHTNESS), LV_ANIM_OFF);
 
   imu_init();
 
@@ -753,6 +806,7 @@ void hal_loop()
     else if (screenTimer.time + screenTimer.duration < millis())
     {
       screenTimer.active = false;
+      prefs_flush();
 
       screenBrightness(0);
       lv_screen_load(ui_home);
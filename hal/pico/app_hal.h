@@ -5,6 +5,8 @@
 
 #elif PICO_1_69
 // 240x280 watchfaces
+#define FACE_RES_W 240
+#define FACE_RES_H 280
 
 #define ENABLE_FACE_174 // (174)
 #define ENABLE_FACE_228 // (228)
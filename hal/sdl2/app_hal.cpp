@@ -2,6 +2,7 @@
 #include <ctime>
 #include <cstring>
 #include <stdio.h>
+#include <stdlib.h>
 #define SDL_MAIN_HANDLED /*To fix SDL's "undefined reference to WinMain" issue*/
 #include SDL_INCLUDE_PATH
 #include "drivers/sdl/lv_sdl_mouse.h"
@@ -10,12 +11,16 @@
 
 #include "app_hal.h"
 #include "ui/ui.h"
+#include "common/glyph_font/glyph_font.h"
 
 static lv_display_t *lvDisplay;
 static lv_indev_t *lvMouse;
 static lv_indev_t *lvMousewheel;
 static lv_indev_t *lvKeyboard;
 
+// emulator settings, saved in the working directory
+#define PREFS_FILE "prefs.txt"
+
 struct Notification
 {
     int icon;
@@ -50,6 +55,9 @@ void hal_loop(void);
 void update_faces();
 void setupContacts();
 void setupWeather();
+void renderBench(int frames);
+void watchSim(double hours);
+void setupFont();
 
 // some pre-generated data just for preview
 Notification notifications[10] = {
@@ -64,6 +72,11 @@ Notification notifications[10] = {
     {.icon = 0x0F, .app = "Twitter", .time = "18:00", .message = "Breaking news: SpaceX launches its latest satellite into orbit. The advancements in space exploration never cease to amaze us. Let's stay updated on the latest developments and continue to support the incredible work being done in the field of aerospace engineering."},
     {.icon = 0x07, .app = "Tencent", .time = "13:40", .message = "Your gaming buddy is online. Ready for a match? It's time to put our skills to the test and embark on another thrilling gaming adventure together. Let's strategize, communicate, and emerge victorious as a team!"}};
 
+// shown in place of two of the above while a font file is loaded
+Notification fontSamples[2] = {
+    {.icon = 0x18, .app = "Telegram", .time = "16:45", .message = "Новое сообщение от Ивана: «Ты видел последние новости? Давай обсудим их вечером»"},
+    {.icon = 0x13, .app = "Weibo", .time = "07:30", .message = "热门话题：#旅行星期二。分享你最近的旅行吧！无论是壮丽的风景还是当地美食，你的故事总能吸引大家。"}};
+
 Weather weather[7] = {
     {.icon = 0, .day = 0, .temp = 21, .high = 22, .low = 18},
     {.icon = 4, .day = 1, .temp = 25, .high = 26, .low = 24},
@@ -134,13 +147,25 @@ void onWeatherLoad(lv_event_t *e)
 
 void onNotificationsOpen(lv_event_t *e) {}
 
-void onBrightnessChange(lv_event_t *e) {}
+void onBrightnessChange(lv_event_t *e)
+{
+    lv_obj_t *slider = (lv_obj_t *)lv_event_get_target(e);
+    prefs_set_int(PREF_BRIGHTNESS, lv_slider_get_value(slider));
+}
 
 void onScrollMode(lv_event_t *e) {}
 
-void onTimeoutChange(lv_event_t *e) {}
+void onTimeoutChange(lv_event_t *e)
+{
+    lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
+    prefs_set_int(PREF_TIMEOUT, lv_dropdown_get_selected(obj));
+}
 
-void onRotateChange(lv_event_t *e) {}
+void onRotateChange(lv_event_t *e)
+{
+    lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
+    prefs_set_int(PREF_ROTATE, lv_dropdown_get_selected(obj));
+}
 
 void onBatteryChange(lv_event_t *e) {}
 
@@ -152,13 +177,13 @@ void onMusicPlay(lv_event_t *e)
 void onMusicPrevious(lv_event_t *e)
 {
     lv_label_set_text(ui_callName, "World");
-    lv_screen_load_anim(ui_callScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
+    screen_transition_load(ui_callScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
 }
 
 void onMusicNext(lv_event_t *e)
 {
     lv_label_set_text(ui_cameraLabel, "Click capture to close to close");
-    lv_screen_load_anim(ui_cameraScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
+    screen_transition_load(ui_cameraScreen, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
 }
 
 void onStartSearch(lv_event_t *e) {}
@@ -200,11 +225,28 @@ void onRTWState(bool state)
 {
 }
 
-void savePrefInt(const char *key, int value) {}
+size_t loadPrefsFile(char *buf, size_t size)
+{
+    FILE *file = fopen(PREFS_FILE, "r");
+    if (file == NULL)
+    {
+        return 0;
+    }
+    size_t len = fread(buf, 1, size, file);
+    fclose(file);
+    return len;
+}
 
-int getPrefInt(const char *key, int def_value)
+bool savePrefsFile(const char *buf, size_t len)
 {
-    return def_value;
+    FILE *file = fopen(PREFS_FILE, "w");
+    if (file == NULL)
+    {
+        return false;
+    }
+    size_t written = fwrite(buf, 1, len, file);
+    fclose(file);
+    return written == len;
 }
 
 void toneOut(int pitch, int duration) {}
@@ -237,7 +279,7 @@ void onMessageClick(lv_event_t *e)
 
 void onCaptureClick(lv_event_t *e)
 {
-    lv_screen_load_anim(ui_home, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0, false);
+    screen_transition_load(ui_home, LV_SCR_LOAD_ANIM_FADE_IN, 500, 0);
 }
 
 void addFaceList(lv_obj_t *parent, Face face) {}
@@ -277,6 +319,69 @@ void setupWeather()
     }
 }
 
+// WATCH_FONT=<file> draws the notifications with glyphs read from an LVGL
+// binary font, as ENABLE_FONT_FILE does on the watch
+#define FONT_CACHE_KB 32
+
+static FILE *fontFile;
+static glyph_font_t glyphFont;
+static lv_font_t notifyFont;
+static lv_font_t alertFont;
+
+static bool fontRead(void *ctx, uint32_t offset, void *buf, uint32_t len)
+{
+    return fseek(fontFile, offset, SEEK_SET) == 0 && fread(buf, 1, len, fontFile) == len;
+}
+
+static void printFontStats()
+{
+    glyph_font_stats_t stats = glyph_font_stats(&glyphFont);
+    printf("font: %u hits, %u glyphs read, %u evicted, %u glyphs in %u bytes\n",
+           stats.hits, stats.misses, stats.evictions, stats.glyphs, stats.bytes);
+}
+
+void setupFont()
+{
+    const char *path = getenv("WATCH_FONT");
+    if (path == NULL)
+    {
+        return;
+    }
+    fontFile = fopen(path, "rb");
+    if (fontFile == NULL)
+    {
+        printf("font: cannot open %s\n", path);
+        return;
+    }
+    // WATCH_FONT_CACHE=<KB> tries the cache size of a board
+    const char *cache = getenv("WATCH_FONT_CACHE");
+    uint32_t cacheKb = cache != NULL && atoi(cache) > 0 ? atoi(cache) : FONT_CACHE_KB;
+    glyph_font_io_t io = {fontRead, NULL};
+    glyph_font_status_t status = glyph_font_open(&glyphFont, &io, cacheKb * 1024);
+    if (status != GLYPH_FONT_OK)
+    {
+        printf("font: %s %s\n", path, glyph_font_status_text(status));
+        fclose(fontFile);
+        return;
+    }
+    glyph_font_bind(&glyphFont, &notifyFont, LV_FONT_DEFAULT);
+    glyph_font_bind(&glyphFont, &alertFont, &lv_font_montserrat_16);
+    lv_obj_set_style_text_font(ui_messageContent, &notifyFont, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_messageList, &notifyFont, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ui_alertText, &alertFont, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+    notifications[3] = fontSamples[0];
+    notifications[6] = fontSamples[1];
+    for (int i = 0; i < 10; i++)
+    {
+        // as the watch does when a notification arrives
+        uint32_t loaded = glyph_font_prewarm(&glyphFont, notifications[i].message);
+        printf("font: %u glyphs read for the %s sample\n", loaded, notifications[i].app);
+    }
+    printf("font: %s, %u KB glyph cache\n", path, cacheKb);
+    atexit(printFontStats);
+}
+
 void setupNotifications()
 {
     lv_obj_clean(ui_messageList);
@@ -326,7 +431,13 @@ void hal_setup(void)
     setenv("DBUS_FATAL_WARNINGS", "0", 1);
 #endif
 
+    prefs_init(prefs_text_backend(loadPrefsFile, savePrefsFile));
+    // the window can close at any time, keep what is still pending
+    atexit(prefs_flush);
+
     lv_init();
+    // the host has memory to spare, frames stay cached like with PSRAM
+    screen_transition_set_alloc(malloc, free);
 
     lvDisplay = lv_sdl_window_create(SDL_HOR_RES, SDL_VER_RES);
     lv_sdl_window_set_title(lvDisplay, "C3 Mini");
@@ -336,6 +447,7 @@ void hal_setup(void)
 
     ui_init();
 
+    setupFont();
     setupNotifications();
     // setupWeather();
 
@@ -352,6 +464,10 @@ void hal_setup(void)
 
     set_alert_states(3);
 
+    lv_dropdown_set_selected(ui_timeoutSelect, prefs_get_int(PREF_TIMEOUT));
+    lv_dropdown_set_selected(ui_rotateSelect, prefs_get_int(PREF_ROTATE));
+    lv_slider_set_value(ui_brightnessSlider, prefs_get_int(PREF_BRIGHTNESS), LV_ANIM_OFF);
+
     lv_label_set_text_fmt(ui_aboutText, "%s\nLVGL Simulator\nA1:B2:C3:D4:E5:F6", ui_info_text);
 
     time_t now = time(0);
@@ -370,6 +486,21 @@ void hal_setup(void)
 
 void hal_loop(void)
 {
+    // WATCH_BENCH=<frames> times the faces and exits instead of running the UI
+    const char *bench = getenv("WATCH_BENCH");
+    if (bench != NULL)
+    {
+        renderBench(atoi(bench) > 0 ? atoi(bench) : 100);
+        return;
+    }
+    // WATCH_SIM=<hours> runs every face through that much watch time and ranks them
+    const char *sim = getenv("WATCH_SIM");
+    if (sim != NULL)
+    {
+        watchSim(atof(sim) > 0 ? atof(sim) : 24);
+        return;
+    }
+
     uint32_t lastTick = SDL_GetTicks();
     while (1)
     {
@@ -403,9 +534,6 @@ void hal_loop(void)
         {
             update_faces();
         }
-
-        // this works just okay on native, esp32 implementation is different
-        ui_games_update();
     }
 }
 
@@ -470,3 +598,202 @@ void update_faces()
     ui_update_watchfaces(second, minute, hour, mode, am, day, month, year, weekday,
                          temp, icon, battery, connection, steps, distance, kcal, bpm, oxygen);
 }
+
+static double benchMs(uint64_t start)
+{
+    return (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+/*
+    Render timings of every built in face, to compare a default build against
+    one with LV_RENDER_THREADS. "full" redraws the whole face each frame,
+    "hands" moves the time so only the rotated hands and changed digits are
+    redrawn, which is what the watch does every second.
+*/
+void renderBench(int frames)
+{
+    printf("bench: %dx%d, %d draw units, %d frames\n", SDL_HOR_RES, SDL_VER_RES, LV_DRAW_SW_DRAW_UNIT_CNT, frames);
+    double totalFull = 0;
+    double totalHands = 0;
+    int count = 0;
+
+    for (int i = 0; i < numFaces; i++)
+    {
+        if (faces[i].custom || faces[i].watchface == NULL || *faces[i].watchface == NULL)
+        {
+            continue;
+        }
+        // the face updates only run for the home face
+        ui_home = *faces[i].watchface;
+        lv_screen_load(ui_home);
+        lv_refr_now(lvDisplay);
+
+        uint64_t start = SDL_GetPerformanceCounter();
+        for (int f = 0; f < frames; f++)
+        {
+            lv_obj_invalidate(*faces[i].watchface);
+            lv_refr_now(lvDisplay);
+        }
+        double full = benchMs(start) / frames;
+
+        start = SDL_GetPerformanceCounter();
+        for (int f = 0; f < frames; f++)
+        {
+            // a different angle for every hand each frame
+            ui_update_watchfaces(f % 60, (f * 7) % 60, (f / 3) % 24, true, true, 1 + f % 28, 1 + f % 12, 2024, f % 7,
+                                 22, 1, 75, true, 2735, 17, 348, 76, 97);
+            lv_refr_now(lvDisplay);
+        }
+        double hands = benchMs(start) / frames;
+
+        printf("bench: %-16s full %7.3f ms  hands %7.3f ms\n", faces[i].name, full, hands);
+        totalFull += full;
+        totalHands += hands;
+        count++;
+    }
+
+    if (count > 0)
+    {
+        printf("bench: average          full %7.3f ms  hands %7.3f ms\n", totalFull / count, totalHands / count);
+    }
+}
+
+/*
+    Watch time in fast forward, to see what a face costs over a day without
+    waiting for one. LVGL runs on a virtual clock that jumps to the next
+    second, or by one refresh period while an animation runs, so a face gets
+    exactly the updates and frames it would get on the watch, in the same
+    order on every run.
+
+    Per face it counts the frames rendered, the pixels invalidated and the
+    bytes flushed to the display, and the CPU time of the updates, timers and
+    rendering. The energy proxy adds the time those bytes keep an 80 MHz SPI
+    bus busy to the CPU time, scaled by WATCH_SIM_CPU_SCALE (default 1) to
+    account for the watch CPU being slower than the host.
+*/
+struct SimStats
+{
+    uint32_t frames;
+    uint64_t invalidated; // pixels
+    uint64_t flushed;     // bytes
+    double cpuMs;
+};
+
+struct SimResult
+{
+    const char *name;
+    SimStats stats;
+    double busMs;
+    double proxy;
+};
+
+// RGB565 over a 1-bit SPI bus at 80 MHz
+#define SIM_BUS_BYTES_PER_MS 10000.0
+
+static SimStats simStats;
+static uint32_t simTick;
+
+static uint32_t simTickGet(void)
+{
+    return simTick;
+}
+
+static void simDisplayEvent(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_INVALIDATE_AREA)
+    {
+        simStats.invalidated += lv_area_get_size((lv_area_t *)lv_event_get_param(e));
+    }
+    else if (code == LV_EVENT_FLUSH_START)
+    {
+        uint32_t px = lv_area_get_size((lv_area_t *)lv_event_get_param(e));
+        simStats.flushed += (uint64_t)px * lv_color_format_get_size(lv_display_get_color_format(lvDisplay));
+    }
+    else if (code == LV_EVENT_RENDER_START)
+    {
+        simStats.frames++;
+    }
+}
+
+// the face update for second s of the simulated day, which starts Monday 1 January 2024 at 00:00
+static void simUpdate(uint32_t s)
+{
+    int day = s / 86400;
+    int hour = (s / 3600) % 24;
+    ui_update_watchfaces(s % 60, (s / 60) % 60, hour, true, hour < 12, 1 + day % 28, 1, 2024, (1 + day) % 7,
+                         22, 1, 75, true, 2735, 17, 348, 76, 97);
+}
+
+static int simCompare(const void *a, const void *b)
+{
+    double pa = ((const SimResult *)a)->proxy;
+    double pb = ((const SimResult *)b)->proxy;
+    return (pa > pb) - (pa < pb);
+}
+
+void watchSim(double hours)
+{
+    uint32_t seconds = (uint32_t)(hours * 3600);
+    const char *scaleEnv = getenv("WATCH_SIM_CPU_SCALE");
+    double cpuScale = scaleEnv != NULL && atof(scaleEnv) > 0 ? atof(scaleEnv) : 1.0;
+    printf("sim: %dx%d, %.2f h of watch time per face, cpu scale %.2f\n", SDL_HOR_RES, SDL_VER_RES, hours, cpuScale);
+
+    SimResult *results = (SimResult *)calloc(numFaces, sizeof(SimResult));
+    int count = 0;
+
+    simTick = lv_tick_get();
+    lv_tick_set_cb(simTickGet);
+    lv_display_add_event_cb(lvDisplay, simDisplayEvent, LV_EVENT_ALL, NULL);
+
+    for (int i = 0; i < numFaces; i++)
+    {
+        if (faces[i].custom || faces[i].watchface == NULL || *faces[i].watchface == NULL)
+        {
+            continue;
+        }
+        // the face updates only run for the home face
+        ui_home = *faces[i].watchface;
+        lv_screen_load(ui_home);
+        simUpdate(0);
+        lv_refr_now(lvDisplay);
+        // the first full frame is the same for every face and not counted
+        memset(&simStats, 0, sizeof(simStats));
+
+        uint32_t base = simTick;
+        for (uint32_t s = 1; s <= seconds; s++)
+        {
+            uint64_t start = SDL_GetPerformanceCounter();
+            simUpdate(s);
+            uint32_t end = base + s * 1000;
+            while (simTick != end)
+            {
+                uint32_t step = lv_anim_count_running() > 0 ? LV_DEF_REFR_PERIOD : end - simTick;
+                simTick += LV_MIN(step, end - simTick);
+                lv_timer_handler();
+            }
+            simStats.cpuMs += benchMs(start);
+        }
+
+        SimResult *r = &results[count++];
+        r->name = faces[i].name;
+        r->stats = simStats;
+        r->busMs = simStats.flushed / SIM_BUS_BYTES_PER_MS;
+        r->proxy = r->busMs + simStats.cpuMs * cpuScale;
+        printf("sim: %-16s done\n", r->name);
+    }
+
+    lv_display_remove_event_cb_with_user_data(lvDisplay, simDisplayEvent, NULL);
+    lv_tick_set_cb(NULL);
+
+    // cheapest first
+    qsort(results, count, sizeof(SimResult), simCompare);
+    printf("\nsim: %-16s %9s %12s %10s %10s %10s %10s\n", "face", "frames", "inval Mpx", "flush MB", "cpu ms", "bus ms", "proxy");
+    for (int i = 0; i < count; i++)
+    {
+        SimResult *r = &results[i];
+        printf("sim: %-16s %9u %12.2f %10.2f %10.1f %10.1f %10.1f\n", r->name, r->stats.frames,
+               r->stats.invalidated / 1e6, r->stats.flushed / 1e6, r->stats.cpuMs, r->busMs, r->proxy);
+    }
+    free(results);
+}
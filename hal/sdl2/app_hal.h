@@ -1,6 +1,9 @@
 #ifndef DRIVER_H
 #define DRIVER_H
 
+#define FACE_RES_W SDL_HOR_RES
+#define FACE_RES_H SDL_VER_RES
+
 #if SDL_VER_RES == 240
 
 #define ENABLE_FACE_ELECROW // elecrow analog
@@ -29,12 +32,14 @@
 #define ENABLE_FACE_2051 // (2051)
 #define ENABLE_FACE_2151 // (2151)
 #define ENABLE_FACE_3589 // (3589)
+#define ENABLE_FACE_756_2 // (Red)
+#define ENABLE_FACE_RADAR // (Radar)
 
 #endif
 
 #if SDL_VER_RES == 466
-#define ENABLE_FACE_756_2_466 // (Red)
-#define ENABLE_FACE_RADAR_466 // (Radar)
+#define ENABLE_FACE_756_2 // (Red)
+#define ENABLE_FACE_RADAR // (Radar)
 
 #endif
 
@@ -97,7 +97,29 @@
  * - LV_OS_RTTHREAD
  * - LV_OS_WINDOWS
  * - LV_OS_CUSTOM */
-#define LV_USE_OS   LV_OS_NONE
+
+/* Threaded render, off by default. Build with -D LV_RENDER_THREADS=n (n > 1) to
+ * render with n SW draw units on their own threads: pthreads in the emulator,
+ * FreeRTOS tasks on the ESP32 (only useful on the dual core S3 boards).
+ * Code outside the LVGL task must then hold lv_lock() while it calls LVGL. */
+#ifndef LV_RENDER_THREADS
+    #define LV_RENDER_THREADS 1
+#endif
+
+#if LV_RENDER_THREADS > 1
+    #if defined(ESP_PLATFORM)
+        #define LV_USE_OS   LV_OS_FREERTOS
+    #else
+        #define LV_USE_OS   LV_OS_PTHREAD
+    #endif
+#else
+    #define LV_USE_OS   LV_OS_NONE
+#endif
+
+#if LV_USE_OS == LV_OS_FREERTOS
+    /*Wake the draw tasks with task notifications instead of semaphores*/
+    #define LV_USE_FREERTOS_TASK_NOTIFY 1
+#endif
 
 #if LV_USE_OS == LV_OS_CUSTOM
     #define LV_OS_CUSTOM_INCLUDE <stdint.h>
@@ -118,7 +140,12 @@
     /* Set the number of draw unit.
      * > 1 requires an operating system enabled in `LV_USE_OS`
      * > 1 means multiply threads will render the screen in parallel */
-    #define LV_DRAW_SW_DRAW_UNIT_CNT    1
+    #define LV_DRAW_SW_DRAW_UNIT_CNT    LV_RENDER_THREADS
+
+    #if LV_RENDER_THREADS > 1
+        /*Stack of each draw unit thread*/
+        #define LV_DRAW_THREAD_STACK_SIZE    (8 * 1024)   /*[bytes]*/
+    #endif
 
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
@@ -227,8 +254,15 @@
     #define LV_LOG_LEVEL LV_LOG_LEVEL_ERROR
 
     /*1: Print the log with 'printf';
-    *0: User need to register a callback with `lv_log_register_print_cb()`*/
-    #define LV_LOG_PRINTF 1
+    *0: User need to register a callback with `lv_log_register_print_cb()`
+    *The ESP32 HAL registers one that queues the logs for its log task*/
+    #ifndef LV_LOG_PRINTF
+        #if defined(ESP_PLATFORM)
+            #define LV_LOG_PRINTF 0
+        #else
+            #define LV_LOG_PRINTF 1
+        #endif
+    #endif
 
     /*1: Enable print timestamp;
      *0: Disable print timestamp*/
@@ -748,7 +782,7 @@
  *==================*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /*1: Enable system monitor component*/
 #define LV_USE_SYSMON   0
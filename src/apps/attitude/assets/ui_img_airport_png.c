@@ -3,150 +3,19 @@
 
 
 #include "../attitude.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_airport_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xBF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x33,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0x5F,0x5C,0xDF,0x6C,0x3F,0x75,0xBF,0x85,0x1F,0x8E,0x3F,0x8E,
-0x3F,0x8E,0x1F,0x8E,0xDF,0x85,0x7F,0x7D,0xFF,0x6C,0x5F,0x5C,0x9F,0x43,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x2A,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0x53,0xFF,0x6C,0xFF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0x1F,0x75,0xFF,0x4B,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x3B,0x7F,0x5C,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0x9F,0x64,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x5A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x33,0x9F,0x64,0x1F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,
-0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x8E,0x9F,0x64,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x2A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x53,0xFF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x8E,0x1F,0x75,0x7F,0x5C,0xDF,0x4B,0x5F,0x43,0x1F,0x3B,0xFF,0x32,0xDF,0x32,0x1F,0x3B,0x7F,0x43,0xBF,0x4B,0x5F,0x5C,0x1F,0x75,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0xDF,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x23,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0xDF,0x6C,0xBF,0x4B,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x43,0xBF,0x64,0xFF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,
-0xFF,0x6C,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x3B,0x9F,0x7D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0x9F,0x64,0x1F,0x33,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x3F,0x5C,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x7D,0x3F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,
-0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x64,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x9F,0x64,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0x7F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0xFF,0x8D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xBF,0x85,0x9F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0xFF,0x95,0x5F,0x9E,0x7F,0xA6,0xFF,0x95,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0x9F,0x7D,0x3F,0x8E,
-0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x85,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x3B,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x6D,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x3B,0xFF,0x7C,0x9F,0x74,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x5C,0x9F,0xA6,
-0x9F,0xA6,0xFF,0x53,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x74,0xFF,0x7C,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x1F,0x75,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0x3F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x9F,0x7D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x6C,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x3B,0x5F,0x8D,0x1F,0xCF,0x5F,0xD7,0x3F,0xD7,0x3F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x64,0x7F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x64,0x3F,0xD7,0x5F,0xD7,0x1F,0xCF,0x5F,0x8D,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x64,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x7D,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xBF,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x5C,0xDF,0xC6,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x1F,0xCF,0xBF,0x53,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x53,0x1F,0xCF,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0xC6,0x1F,0x5C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xBF,0x64,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x53,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x75,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x6C,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0xC6,0x7F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0xDF,0xC6,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x6D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x33,0xFF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xBF,0x85,0x1F,0x3B,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0xA5,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x9F,0xBE,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x3B,0x9F,0xBE,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xFF,0xA5,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x9F,0x7D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xFF,0x3A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x64,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x7F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x53,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x3F,0xAE,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x3F,0xAE,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x9F,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0x1F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x3B,0x1F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x6C,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x5B,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xFF,0xA5,0x5F,0x43,
-0x5F,0x43,0xFF,0xA5,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0x53,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x7F,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x5C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x8E,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x5C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x64,
-0x5F,0xD7,0xFF,0xA5,0xBF,0x53,0xFF,0x5B,0x9F,0xBE,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x9F,0xBE,0xDF,0x5B,0xBF,0x53,0xFF,0xA5,0x5F,0xD7,0x3F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x7F,0x5C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,
-0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x7F,0x5C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x3B,0xFF,0xC6,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0xFF,0xC6,0x3F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x54,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x53,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x8E,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x8D,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x8D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xBF,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0x1F,0xCF,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x1F,0xCF,0x3F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x64,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x6D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,
-0xBF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xBF,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x85,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x3F,0x85,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x8E,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0xBE,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xBF,0xBE,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x5C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x5F,0x75,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x53,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xBF,0x53,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x5F,0x5C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x7F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x7C,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0x7C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x5C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x75,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x54,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x9D,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xBF,0x9D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x4B,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x7F,0x7D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0xB6,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x7F,0xB6,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x3B,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0xFF,0xA5,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0xA5,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0x1F,0xA6,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xFF,0xA5,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0xFF,0xA5,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0xA5,0x5F,0x43,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0x5F,0x43,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0xC6,0x5F,0xD7,0x5F,0xD7,0xDF,0xC6,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x8E,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0xFF,0xA5,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0xA5,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x64,0xDF,0xC6,0xDF,0xC6,0x3F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0xFF,0xA5,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0xA5,0x5F,0x43,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x7F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0xB6,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x9F,0x95,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x95,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x7F,0xB6,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x3B,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x7D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x9D,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x3F,0xD7,0xBF,0x53,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x53,0x3F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xBF,0x9D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x4B,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x7F,0x7D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x5F,0x5C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x7C,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xFF,0xCE,0xBF,0x53,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x53,0xFF,0xCE,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xDF,0x7C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x5C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x5C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x53,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x3F,0xD7,0x9F,0x95,0xDF,0x5B,0x3F,0x3B,
-0xFF,0x32,0xDF,0x53,0x9F,0x95,0x3F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xBF,0x53,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x5F,0x5C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x4B,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0xC6,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xBF,0xC6,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xBF,0x2A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0x8D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x85,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x1F,0x85,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x75,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xBF,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0x3F,0xCF,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x3F,0xD7,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x75,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x4B,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x8D,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x8D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0x8D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,
-0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0x8D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x5F,0x5C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x3B,0xFF,0xC6,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0xDF,0xC6,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x5C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x00,0x00,0x00,0x00,0x1F,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x64,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x6C,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x3B,0x1F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0x7F,0x95,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0x8D,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x64,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x8E,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1F,0x33,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x64,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x7F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xFF,0xA5,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xFF,0xA5,0xFF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x64,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x33,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x7D,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x1F,0xA6,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,
-0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0xFF,0xA5,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x33,0xBF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x4B,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x75,0xFF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xFF,0x32,0x5F,0x8D,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x5F,0xD7,0x9F,0x95,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x75,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x6C,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x5A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x9F,0x7D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x6C,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x7D,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x3B,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,
-0x7F,0x7D,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x33,0x3F,0x75,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0x3F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x7F,0x43,0xFF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xBF,0x85,0x9F,0x43,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x4B,0xBF,0x85,0x3F,0x8E,
-0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x85,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x43,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,
-0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0x5F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x5A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x3F,0x3B,0x9F,0x7D,0x3F,0x8E,
-0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x9F,0x7D,0x3F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x2A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0xDF,0x6C,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,
-0xDF,0x6C,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x2A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x4B,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,
-0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xDF,0x85,0xDF,0x4B,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x5F,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x5A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xFF,0x32,0x9F,0x64,0x1F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x1F,0x8E,0x9F,0x64,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x3B,0x7F,0x5C,0xDF,0x85,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0x9F,0x64,0x1F,0x3B,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x4B,0x1F,0x6D,0xFF,0x8D,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,
-0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0x3F,0x8E,0xFF,0x8D,0x1F,0x75,0xDF,0x4B,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xFF,0x32,0x9F,0x43,0x5F,0x5C,0xFF,0x6C,0x7F,0x7D,0xDF,0x85,0xFF,0x8D,0x3F,0x8E,0x1F,0x8E,0xFF,0x8D,0xDF,0x85,0x5F,0x7D,0xDF,0x6C,0x5F,0x5C,0x9F,0x43,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x33,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x2A,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x3A,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,
-0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x9F,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xDF,0x32,0xBF,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x53,0x82,0xAD,0xC9,0xE6,0xEE,0xFE,0xFA,0xEE,0xDE,0xCD,0xA6,0x7E,0x53,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x8D,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xD3,0x8D,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x72,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0x74,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x83,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x80,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x61,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC4,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5E,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA5,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB4,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA4,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x5C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xC4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC2,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x6A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x00,0x00,0x00,
-0x00,0x00,0x0E,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x0D,0x00,0x00,0x00,0x00,0x71,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x72,0x00,0x00,0x00,0x00,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0x00,0x00,
-0x00,0x37,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x31,0x00,0x00,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8B,0x00,0x00,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,
-0x1B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x14,0x51,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x52,0x85,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,
-0xAA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA4,0xCC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,
-0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
-0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xCC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,
-0xAB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x81,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4F,
-0x18,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x17,0x00,0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x00,0x00,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8B,0x00,
-0x00,0x3A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x33,0x00,0x00,0x01,0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x00,0x00,0x00,0x00,0x74,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x00,0x00,
-0x00,0x00,0x10,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x0D,0x00,0x00,0x00,0x00,0x00,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x0D,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x68,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC3,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x25,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xB6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB1,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xAA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8C,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0xC3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x65,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE8,0x65,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x82,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x81,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x70,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x71,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x88,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x89,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x51,0x80,0xA9,0xC7,0xE1,0xEE,0xFB,0xFF,0xEF,0xE1,0xCA,0xA8,0x82,0x4E,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_airport_png_data, "ui_img_airport_png_data.bin"); // LVGL_9 compatible
 
 const lv_img_dsc_t  ui_img_airport_png = {
   .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
   .header.magic = LV_IMAGE_HEADER_MAGIC,
   .header.w = 64,
   .header.h = 64,
-  .data_size = sizeof(ui_img_airport_png_data),
+  .data_size = 12288,
   .data =  ui_img_airport_png_data,
 };
@@ -4,1823 +4,19 @@
 // Project name: Altimeter_Project
 
 #include "../attitude.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/Dial bg.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_dial_bg_png_data[] = {
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x2D,0x43,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,
-0x89,0x43,0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x2D,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x2D,0x43,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,
-0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,
-0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,
-0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,
-0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,0xFC,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,
-0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,
-0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,
-0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,
-0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,0x03,0x62,0x66,0x52,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,
-0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x2D,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x2D,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x2D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x0A,0x1B,0x33,0x33,0x33,0x4B,0x4B,0x4B,0x60,0x60,0x60,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x60,0x60,0x4B,0x4B,0x4B,0x33,0x33,0x33,0x1B,0x1B,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x1B,0x1B,0x33,0x33,0x33,0x4B,0x4B,0x4B,0x4B,0x60,0x60,0x60,0x60,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x4B,0x4B,0x4B,0x4B,0x33,0x33,0x33,0x1B,0x1B,0x1B,
-0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x0A,0x1B,0x1B,0x1B,0x33,
-0x33,0x4B,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x4B,0x33,0x33,0x1B,0x1B,0x1B,0x0A,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x0A,0x0A,0x1B,0x33,0x33,0x4B,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x60,0x4B,0x33,0x33,0x1B,0x0A,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x33,0x4B,0x4B,0x60,0x60,0x60,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x60,0x4B,0x4B,0x33,0x1B,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x1B,0x33,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x33,0x33,0x1B,0x0A,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x0A,0x0A,0x33,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x33,0x1B,0x1B,0x0A,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x33,0x4B,0x60,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x4B,0x33,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x1B,0x33,0x4B,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x4B,0x33,0x33,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x1B,0x33,0x33,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x33,0x1B,0x1B,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x33,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x4B,0x33,0x1B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x1B,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,0x1B,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x1B,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x1B,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x33,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x1B,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x1B,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x33,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0A,0x1B,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x1B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,0x0A,0x03,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x03,0x1B,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x1B,0x0A,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,
-0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,
-0x33,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x33,0x4B,0x60,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x33,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x4B,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x33,0x60,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x60,0x60,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x1B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x33,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x33,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x0A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0A,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x1B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x33,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x0A,0x1B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x1B,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x1B,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0A,0x33,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x03,0x00,0x00,0x00,
-0x00,0x00,0x00,0x03,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x0A,0x00,0x00,0x00,
-0x00,0x00,0x00,0x0A,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x0A,0x00,0x00,0x00,0x00,0x00,0x03,0x1B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x1B,0x03,0x00,0x00,
-0x00,0x00,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,0x00,0x03,0x0A,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x0A,0x00,0x00,
-0x00,0x00,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,0x00,0x00,0x00,0x1B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x1B,0x00,0x00,
-0x00,0x00,0x1B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x1B,0x00,0x00,0x00,0x0A,0x33,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x0A,0x00,
-0x00,0x1B,0x33,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x1B,0x00,0x00,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,
-0x00,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x00,0x00,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x00,
-0x00,0x33,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x00,0x03,0x33,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x33,0x03,
-0x0A,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x0A,0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x0A,
-0x1B,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x1B,0x33,0x4B,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x4B,0x33,
-0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,0x33,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x33,
-0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,
-0x4B,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x4B,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,
-0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,
-0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,0x60,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x60,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,
-0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,
-0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x59,
-0x45,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x45,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,
-0x45,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,
-0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x19,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,
-0x19,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,0x0B,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x0B,
-0x03,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x03,0x00,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x2E,0x00,
-0x00,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x00,0x00,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x00,
-0x00,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x00,0x00,0x0B,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x00,
-0x00,0x0B,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x2E,0x0B,0x00,0x00,0x03,0x19,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x2E,0x00,0x00,
-0x00,0x00,0x19,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x19,0x00,0x00,0x00,0x00,0x19,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x19,0x00,0x00,
-0x00,0x00,0x0B,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x0B,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,
-0x00,0x00,0x03,0x19,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x19,0x03,0x00,0x00,0x00,0x00,0x03,0x0B,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x0B,0x00,0x00,0x00,
-0x00,0x00,0x00,0x0B,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x03,0x00,0x00,0x00,
-0x00,0x00,0x00,0x03,0x19,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x2E,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x0B,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x2E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x19,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x45,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x45,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x45,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x2E,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x19,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x19,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,0x59,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x68,0x2E,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2E,0x45,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x59,0x45,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,
-0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x2E,
-0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-0x0B,0x2E,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x45,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x45,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x45,0x19,0x03,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x03,0x0B,0x2E,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x19,0x2E,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x19,0x0B,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x2E,0x45,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,0x2E,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x19,0x45,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,0x19,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x2E,0x45,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,0x2E,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x59,0x2E,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x19,0x2E,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x19,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x0B,0x19,0x2E,0x45,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x59,0x45,0x2E,0x19,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x2E,0x45,0x45,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x45,0x2E,0x19,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x2E,0x45,0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,0x68,0x59,0x2E,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x19,0x19,0x45,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x2E,0x2E,0x19,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x2E,0x2E,0x45,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x45,0x2E,0x2E,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x2E,0x45,0x59,0x68,0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,0x68,0x59,0x45,0x2E,0x19,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x0B,0x19,0x2E,0x45,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x45,0x2E,0x0B,0x0B,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x0B,0x19,0x2E,0x45,0x45,0x59,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x59,0x45,0x2E,0x2E,0x19,0x19,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x0B,0x19,0x2E,0x45,0x59,0x59,0x59,0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,
-0x70,0x70,0x70,0x68,0x68,0x59,0x59,0x45,0x45,0x2E,0x19,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x0B,0x19,0x2E,0x45,0x59,0x68,0x68,0x68,
-0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,0x68,0x68,0x59,0x59,0x45,0x2E,0x19,0x0B,0x0B,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0x0B,0x19,0x19,0x2E,0x2E,0x45,0x45,0x59,0x59,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,0x59,0x45,0x45,
-0x2E,0x19,0x19,0x19,0x0B,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,
-0x19,0x19,0x2E,0x2E,0x2E,0x45,0x45,0x45,0x45,0x59,0x59,0x59,0x59,0x59,0x68,0x68,0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,0x68,0x68,0x68,0x59,0x59,0x59,0x59,0x59,0x45,0x45,0x45,0x45,0x2E,0x2E,0x2E,0x19,0x19,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x19,0x19,0x2E,0x2E,0x45,0x45,0x45,0x59,0x59,0x59,0x68,0x68,0x68,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x68,0x68,0x68,0x68,0x59,0x59,0x45,0x45,0x45,0x2E,0x2E,0x19,0x0B,0x0B,0x03,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_dial_bg_png_data, "ui_img_dial_bg_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_dial_bg_png = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 240,
-    .data_size = sizeof(ui_img_dial_bg_png_data),
+    .data_size = 172800,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = ui_img_dial_bg_png_data
 };
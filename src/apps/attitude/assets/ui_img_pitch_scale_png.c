@@ -4,1823 +4,19 @@
 // Project name: Altimeter_Project
 
 #include "../attitude.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/Pitch Scale.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_pitch_scale_png_data[] = {
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x25,0x5A,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x15,0x24,0x15,0x24,0x15,0x24,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x15,0x24,0x15,0x24,0x15,0x24,0x15,0x24,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x25,0x5A,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x15,0x24,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x5C,0x2D,0x3D,0x6E,0x7D,0x86,0x3D,0x6E,0x9C,0x45,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0x3D,0x6E,0x7D,0x86,0x3D,0x6E,0x1B,0x1D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x9C,0x45,0x3D,0x6E,0x7D,0x86,0x3D,0x6E,0x5C,0x2D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0x9C,0x45,0x3D,0x6E,0x7D,0x86,0xDC,0x55,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0x9E,0x96,0x5E,0xC7,0x7F,0xD7,0x7F,0xD7,0x1E,0xB7,0x3D,0x6E,0xFB,0x0C,0xFB,0x0C,0x9C,0x45,0xDE,0x9E,0x7F,0xD7,0x7F,0xD7,0x5E,0xC7,0xDE,0x9E,0x9C,0x45,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x9C,0x45,0xDE,0x9E,0x5E,0xC7,0x7F,0xD7,0x7F,0xD7,0x1E,0xB7,0xDC,0x55,0xFB,0x0C,0xFB,0x0C,0xDC,0x55,0x1E,0xB7,0x7F,0xD7,0x7F,0xD7,0x5E,0xC7,0x9E,0x96,0x5C,0x2D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x1B,0x1D,0x3D,0x6E,0x9F,0xDF,0x9F,0xDF,0x1E,0xB7,0x7F,0xD7,0xDF,0xEF,0x5E,0xC7,0x5C,0x2D,0x5C,0x2D,0x9E,0x96,0xFF,0xFF,0x7F,0xD7,0x5E,0xC7,0x7F,0xD7,0xFF,0xFF,0x9E,0x96,0x5C,0x2D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x7D,0x86,0xDF,0xEF,0x9F,0xDF,0x1E,0xB7,0x9F,0xDF,0xFF,0xFF,0x1E,0xB7,0x1B,0x1D,0x5C,0x2D,0xDE,0x9E,0xFF,0xFF,0x5E,0xC7,0x5E,0xC7,0x9F,0xDF,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0x9F,0xDF,0xDE,0x9E,0x1B,0x1D,0xDC,0x55,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0x3D,0x6E,0x1E,0xB7,0xDF,0xEF,0xDC,0x55,0x5C,0x2D,0x3D,0x6E,0xDF,0xEF,0x1E,0xB7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x9C,0x45,0xDE,0x9E,0x9F,0xDF,0x7D,0x86,0x1B,0x1D,0x3D,0x6E,0x7F,0xD7,0x5E,0xC7,0x9C,0x45,0x3D,0x6E,0x5E,0xC7,0x9F,0xDF,0x9C,0x45,0x5C,0x2D,0x7D,0x86,0xDF,0xEF,0xDE,0x9E,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x1B,0x1D,0x3D,0x6E,0xDE,0x9E,0x3D,0x6E,0xFB,0x0C,0x9C,0x45,0x1E,0xB7,0x7F,0xD7,0xDC,0x55,0x3D,0x6E,0x5E,0xC7,0x9F,0xDF,0x9C,0x45,0xBB,0x04,0x9C,0x45,0x9F,0xDF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x3D,0x6E,0xDE,0x9E,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x7F,0xD7,0x5E,0xC7,0xDC,0x55,0x7D,0x86,0x7F,0xD7,0x7F,0xD7,0x1B,0x1D,0xBB,0x04,0xDC,0x55,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0x9C,0x45,0x5C,0x2D,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0x7F,0xD7,0x9C,0x45,0x3D,0x6E,0x5E,0xC7,0x9F,0xDF,0x9C,0x45,0xBB,0x04,0x5C,0x2D,0x9F,0xDF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,
-0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0x9C,0x45,0x1B,0x1D,0x1B,0x1D,0x3D,0x6E,0x9F,0xDF,0x1E,0xB7,0x9C,0x45,0x7D,0x86,0x9F,0xDF,0x7F,0xD7,0x1B,0x1D,0xBB,0x04,0xDC,0x55,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0x7D,0x86,0x9F,0xDF,0x5E,0xC7,0x5C,0x2D,0x3D,0x6E,0x7F,0xD7,0x9F,0xDF,0x9C,0x45,0xBB,0x04,0x5C,0x2D,0x9F,0xDF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,
-0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,
-0x1B,0x1D,0xFB,0x0C,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xDB,0x04,0x1B,0x1D,0xDE,0x9E,0xDF,0xEF,0xDE,0x9E,0x1B,0x1D,0x7D,0x86,0x9F,0xDF,0x7F,0xD7,0x1B,0x1D,0xBB,0x04,0xDC,0x55,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x5C,0x2D,0x5E,0xC7,0x9F,0xDF,0x9E,0x96,0x1B,0x1D,0xDC,0x55,0x7F,0xD7,0x9F,0xDF,0x9C,0x45,0xBB,0x04,0x5C,0x2D,0x9F,0xDF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x3D,0x6E,
-0x1E,0xB7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,
-0x5E,0xC7,0x9E,0x96,0x9C,0x45,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x9C,0x45,0x7F,0xD7,0x7F,0xD7,0x3D,0x6E,0x1B,0x1D,0x3D,0x6E,0x9F,0xDF,0x7F,0xD7,0x1B,0x1D,0xBB,0x04,0xDC,0x55,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x1B,0x1D,0x3D,0x6E,0x9F,0xDF,0x1E,0xB7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x7F,0xD7,0x9F,0xDF,0x9C,0x45,0xBB,0x04,0x5C,0x2D,0x9F,0xDF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0xDE,0x9E,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x7D,0x86,0xDF,0xEF,0xDE,0x9E,0x5C,0x2D,0xFB,0x0C,0x3D,0x6E,0x9F,0xDF,0x7F,0xD7,0x1B,0x1D,0xBB,0x04,0xDC,0x55,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xDC,0x55,0x1E,0xB7,0x7F,0xD7,0x3D,0x6E,0xFB,0x0C,0xFB,0x0C,0xDC,0x55,0x7F,0xD7,0x9F,0xDF,0x9C,0x45,0xBB,0x04,0x5C,0x2D,0x9F,0xDF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x3D,0x6E,
-0x5E,0xC7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,
-0x7F,0xD7,0xDE,0x9E,0x9C,0x45,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x3D,0x6E,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xDB,0x04,0xFB,0x0C,0x7D,0x86,0x9F,0xDF,0x7F,0xD7,0x1B,0x1D,0xBB,0x04,0xDC,0x55,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x5C,0x2D,0xDE,0x9E,0x9F,0xDF,0x9E,0x96,0x9C,0x45,0xDB,0x04,0xDB,0x04,0x3D,0x6E,0x7F,0xD7,0x9F,0xDF,0x9C,0x45,0xBB,0x04,0x5C,0x2D,0x9F,0xDF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,
-0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,
-0x1B,0x1D,0x1B,0x1D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x9C,0x45,0x1E,0xB7,0x9F,0xDF,0x7D,0x86,0x5C,0x2D,0xBB,0x04,0xFB,0x0C,0x7D,0x86,0x9F,0xDF,0x7F,0xD7,0x1B,0x1D,0xBB,0x04,0xDC,0x55,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xDB,0x04,0x3D,0x6E,0x7F,0xD7,0x7F,0xD7,0x9C,0x45,0xFB,0x0C,0xBB,0x04,0xDB,0x04,0x3D,0x6E,0x7F,0xD7,0x9F,0xDF,0x5C,0x2D,0xBB,0x04,0x5C,0x2D,0x9F,0xDF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,
-0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,
-0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xFB,0x0C,0x9E,0x96,0x9F,0xDF,0x5E,0xC7,0x5C,0x2D,0xDB,0x04,0xBB,0x04,0xFB,0x0C,0x7D,0x86,0x9F,0xDF,0x7F,0xD7,0x1B,0x1D,0xBB,0x04,0xDC,0x55,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x5C,0x2D,0x1E,0xB7,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0x1B,0x1D,0x1B,0x1D,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0xDF,0xEF,0xDC,0x55,0x1B,0x1D,0xDC,0x55,0x9F,0xDF,0x1E,0xB7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x9C,0x45,0x5E,0xC7,0xDF,0xEF,0xDE,0x9E,0x5C,0x2D,0x1B,0x1D,0x1B,0x1D,0x1B,0x1D,0x3D,0x6E,0x7F,0xD7,0x9F,0xDF,0x9C,0x45,0x1B,0x1D,0x3D,0x6E,0xDF,0xEF,0xDE,0x9E,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x1B,0x1D,0x3D,0x6E,0x7F,0xD7,0x9F,0xDF,0xDE,0x9E,0x7D,0x86,0x7D,0x86,0x3D,0x6E,0x5C,0x2D,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0xDE,0x9E,0x7D,0x86,0xDE,0x9E,0xDF,0xEF,0xDE,0x9E,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x5C,0x2D,0x7D,0x86,0x9F,0xDF,0x7F,0xD7,0xDE,0x9E,0x7D,0x86,0x7D,0x86,0xDC,0x55,0x5C,0x2D,0xDC,0x55,0x1E,0xB7,0x9F,0xDF,0x9E,0x96,0x7D,0x86,0x1E,0xB7,0xDF,0xEF,0x7D,0x86,0x5C,0x2D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0x5E,0xC7,0x9C,0x45,0x1B,0x1D,0xDC,0x55,0x5E,0xC7,0x9F,0xDF,0xDF,0xEF,0xDF,0xEF,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0x1E,0xB7,0x9C,0x45,0x5C,0x2D,0x3D,0x6E,0x7F,0xD7,0x9F,0xDF,0xDF,0xEF,0xDF,0xEF,0x5E,0xC7,0x9C,0x45,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xDC,0x55,0x7D,0x86,0x9E,0x96,0x9E,0x96,0x9E,0x96,0xDE,0x9E,0x7D,0x86,0x5C,0x2D,0xFB,0x0C,0x1B,0x1D,0x3D,0x6E,0x9E,0x96,0xDE,0x9E,0xDE,0x9E,0x3D,0x6E,0x1B,0x1D,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0xDC,0x55,0x7D,0x86,0x9E,0x96,0x9E,0x96,0x9E,0x96,0xDE,0x9E,0x3D,0x6E,0x5C,0x2D,0xFB,0x0C,0x5C,0x2D,0x3D,0x6E,0x9E,0x96,0xDE,0x9E,0x9E,0x96,0x3D,0x6E,0x1B,0x1D,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x1B,0x1D,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x1B,0x1D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0xDC,0x55,0xDE,0x9E,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x1E,0xB7,0x7D,0x86,0x5C,0x2D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0xB7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x1B,0x1D,0x3D,0x6E,0x5E,0xC7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xDE,0x9E,0x9C,0x45,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x1B,0x1D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x5C,0x2D,0x1B,0x1D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0x9C,0x45,0x5C,0x2D,0xFB,0x0C,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0xDC,0x55,0x3D,0x6E,0xDC,0x55,0x5C,0x2D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0x9C,0x45,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0xDC,0x55,0x3D,0x6E,0xDC,0x55,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x1B,0x1D,0x9C,0x45,0x3D,0x6E,0xDE,0x9E,0x3D,0x6E,0xFB,0x0C,0xDB,0x04,0x9C,0x45,0x7D,0x86,0x1E,0xB7,0x5E,0xC7,0x1E,0xB7,0x7D,0x86,0x5C,0x2D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x1B,0x1D,0x9C,0x45,0x3D,0x6E,0xDE,0x9E,0xDC,0x55,0xFB,0x0C,0xFB,0x0C,0x9C,0x45,0x9E,0x96,0x5E,0xC7,0x5E,0xC7,0x1E,0xB7,0x3D,0x6E,0x5C,0x2D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0xDC,0x55,0xDE,0x9E,0x9F,0xDF,0xFF,0xFF,0x9E,0x96,0xFB,0x0C,0xFB,0x0C,0x9E,0x96,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0xDF,0xEF,0x9F,0xDF,0x9E,0x96,0x5C,0x2D,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0x3D,0x6E,0x1E,0xB7,0xDF,0xEF,0xDF,0xEF,0x3D,0x6E,0xFB,0x0C,0x1B,0x1D,0x1E,0xB7,0xDF,0xEF,0x9F,0xDF,0x7F,0xD7,0xDF,0xEF,0x7F,0xD7,0x7D,0x86,0x1B,0x1D,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x1B,0x1D,0x3D,0x6E,0x1E,0xB7,0x9F,0xDF,0xDF,0xEF,0xFF,0xFF,0x9E,0x96,0x1B,0x1D,0x5C,0x2D,0x1E,0xB7,0x9F,0xDF,0x7D,0x86,0x9C,0x45,0x7D,0x86,0x9F,0xDF,0x7F,0xD7,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x7D,0x86,0x5E,0xC7,0x9F,0xDF,0xFF,0xFF,0xFF,0xFF,0x3D,0x6E,0x1B,0x1D,0x9C,0x45,0x7F,0xD7,0x7F,0xD7,0x7D,0x86,0x9C,0x45,0xDE,0x9E,0x9F,0xDF,0x5E,0xC7,0x5C,0x2D,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0x9C,0x45,0x3D,0x6E,0x9E,0x96,0x5E,0xC7,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x7F,0xD7,0x9F,0xDF,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0xDC,0x55,0x3D,0x6E,0xDE,0x9E,0x7F,0xD7,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x9F,0xDF,0x5E,0xC7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x9F,0xDF,0x7F,0xD7,0x9C,0x45,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0x9F,0xDF,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x7F,0xD7,0x5E,0xC7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x7F,0xD7,0x7F,0xD7,0x9C,0x45,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0x9F,0xDF,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x7F,0xD7,0x5E,0xC7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x7F,0xD7,0x7F,0xD7,0x9C,0x45,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0x9F,0xDF,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0xDC,0x55,0x9E,0x96,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0xDE,0x9E,0x3D,0x6E,0x5C,0x2D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x7F,0xD7,0x5E,0xC7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x7F,0xD7,0x7F,0xD7,0x5C,0x2D,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0x9F,0xDF,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5E,0xC7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x7F,0xD7,0x5E,0xC7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x7F,0xD7,0x7F,0xD7,0x9C,0x45,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0x9F,0xDF,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x5C,0x2D,0x7D,0x86,0x9F,0xDF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDF,0xEF,0xDE,0x9E,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x7F,0xD7,0x5E,0xC7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x7F,0xD7,0x7F,0xD7,0x5C,0x2D,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0x9F,0xDF,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x1B,0x1D,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x9C,0x45,0x5C,0x2D,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x7F,0xD7,0x5E,0xC7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x7F,0xD7,0x7F,0xD7,0x9C,0x45,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0xDC,0x55,0xFB,0x0C,0xDC,0x55,0x5E,0xC7,0x9F,0xDF,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x9F,0xDF,0x1E,0xB7,0x9C,0x45,0xFB,0x0C,0x3D,0x6E,0x7F,0xD7,0x7F,0xD7,0x9C,0x45,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x9C,0x45,0x5E,0xC7,0x7F,0xD7,0x3D,0x6E,0x1B,0x1D,0xDC,0x55,0x7F,0xD7,0x7F,0xD7,0xDC,0x55,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0x1B,0x1D,0x9C,0x45,0x7F,0xD7,0x5E,0xC7,0xDC,0x55,0x1B,0x1D,0x7D,0x86,0x7F,0xD7,0x5E,0xC7,0x9C,0x45,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0x1B,0x1D,0x1B,0x1D,0x1E,0xB7,0xDF,0xEF,0x1E,0xB7,0xDC,0x55,0x9E,0x96,0x9F,0xDF,0x5E,0xC7,0x9C,0x45,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0xFB,0x0C,0x5C,0x2D,0x7F,0xD7,0x9F,0xDF,0xDE,0x9E,0xDC,0x55,0xDE,0x9E,0x9F,0xDF,0x1E,0xB7,0x5C,0x2D,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0x9E,0x96,0xFB,0x0C,0xFB,0x0C,0x7D,0x86,0x7F,0xD7,0xDF,0xEF,0x7F,0xD7,0x7F,0xD7,0x7F,0xD7,0x3D,0x6E,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x9C,0x45,0xDE,0x9E,0xDF,0xEF,0x3D,0x6E,0xFB,0x0C,0x1B,0x1D,0x9E,0x96,0x9F,0xDF,0xDF,0xEF,0x5E,0xC7,0x9F,0xDF,0x5E,0xC7,0x3D,0x6E,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0x3D,0x6E,0x1E,0xB7,0x3D,0x6E,0xFB,0x0C,0xDB,0x04,0x5C,0x2D,0x7D,0x86,0x5E,0xC7,0x5E,0xC7,0x5E,0xC7,0x9E,0x96,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x5C,0x2D,0x3D,0x6E,0x1E,0xB7,0xDC,0x55,0xFB,0x0C,0xFB,0x0C,0x9C,0x45,0x9E,0x96,0x5E,0xC7,0x5E,0xC7,0x1E,0xB7,0x3D,0x6E,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,
-0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xFB,0x0C,0x1B,0x1D,0x5C,0x2D,0x1B,0x1D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0xFB,0x0C,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x1B,0x1D,0x5C,0x2D,0x1B,0x1D,0xFB,0x0C,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,0x89,0x43,
-0x89,0x43,0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x25,0x5A,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x1B,0x1D,0x9C,0x45,0x3D,0x6E,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0x7D,0x86,0xDC,0x55,0x5C,0x2D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x89,0x43,
-0x89,0x43,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x9E,0x96,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0xB7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0x15,0x24,
-0x15,0x24,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0x5C,0x2D,0x7D,0x86,0x9F,0xDF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0x1E,0xB7,0xDC,0x55,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xFB,0x0C,0x5C,0x2D,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0xDC,0x55,0x9C,0x45,0x1B,0x1D,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,
-0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,
-0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,
-0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,
-0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,
-0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,0xBB,0x04,
-0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,
-0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,
-0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,
-0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,
-0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,0x3D,0x6E,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,
-0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,
-0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,
-0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,
-0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,0xAF,0xAC,
-0xE2,0x61,0xE2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,
-0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,
-0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,
-0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,
-0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xE2,0x61,0xE2,0x61,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x08,0x83,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x0D,0x9C,0x8A,0x8B,0xA6,0x72,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xC2,0x61,0x08,0x83,0x32,0xBD,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x37,0xD6,0x0D,0x9C,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x37,0xD6,0x0D,0x9C,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0x8A,0x8B,0xAF,0xAC,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x0D,0x9C,0x08,0x83,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xC2,0x61,0xE2,0x61,0xE2,0x61,0xC2,0x61,0xE2,0x61,0xE2,0x61,0xC2,0x61,0xE2,0x61,0xE2,0x61,0xC2,0x61,0xE2,0x61,0xE2,0x61,0xC2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,
-0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x03,0x62,0x44,0x6A,0xA6,0x72,0xA6,0x72,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x08,0x83,0x08,0x83,0x08,0x83,0xA6,0x72,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x03,0x62,0x44,0x6A,0xA6,0x72,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0xA6,0x72,0x08,0x83,0x08,0x83,0xA6,0x72,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xA6,0x72,0x08,0x83,0xAF,0xAC,0x8A,0x8B,0x44,0x6A,0x03,0x62,0xA6,0x72,0x0D,0x9C,0x32,0xBD,0xB4,0xC5,0x32,0xBD,0x0D,0x9C,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xA6,0x72,0x8A,0x8B,0xAF,0xAC,0x8A,0x8B,0x03,0x62,0x03,0x62,0xA6,0x72,0x0D,0x9C,0x32,0xBD,0xB4,0xC5,0x32,0xBD,0x8A,0x8B,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xA6,0x72,0x8A,0x8B,0xAF,0xAC,0x37,0xD6,0xFA,0xE6,0x32,0xBD,0x44,0x6A,0x03,0x62,0xAF,0xAC,0xB9,0xDE,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x78,0xD6,0xAF,0xAC,0xA6,0x72,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xA6,0x72,0x8A,0x8B,0x32,0xBD,0x78,0xD6,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x44,0x6A,0x32,0xBD,0xB9,0xDE,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x37,0xD6,0x0D,0x9C,0xA6,0x72,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0x0D,0x9C,0x32,0xBD,0xB9,0xDE,0x9D,0xF7,0xFF,0xFF,0x32,0xBD,0xA6,0x72,0xA6,0x72,0x37,0xD6,0x9D,0xF7,0x78,0xD6,0x32,0xBD,0x78,0xD6,0x5C,0xEF,0x37,0xD6,0x8A,0x8B,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0x0D,0x9C,0xB4,0xC5,0xFA,0xE6,0xFF,0xFF,0xFF,0xFF,0xAF,0xAC,0x44,0x6A,0x08,0x83,0xB9,0xDE,0x5C,0xEF,0x37,0xD6,0x32,0xBD,0xB9,0xDE,0x5C,0xEF,0xB4,0xC5,0x08,0x83,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0xAF,0xAC,0x37,0xD6,0xB9,0xDE,0x5C,0xEF,0xFF,0xFF,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0xAF,0xAC,0x44,0x6A,0x0D,0x9C,0xFA,0xE6,0x5C,0xEF,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x37,0xD6,0xFA,0xE6,0x9D,0xF7,0xDF,0xEF,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0xB9,0xDE,0x0D,0x9C,0x44,0x6A,0xAF,0xAC,0x5C,0xEF,0xFA,0xE6,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xA6,0x72,0xA6,0x72,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0xA6,0x72,0xA6,0x72,0x0D,0x9C,0x37,0xD6,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0xAF,0xAC,0xFA,0xE6,0xFA,0xE6,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xC2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xC2,0x61,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0xAF,0xAC,0xFA,0xE6,0xB9,0xDE,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0xA6,0x72,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x8A,0x8B,0x08,0x83,0xA6,0x72,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0xAF,0xAC,0xFA,0xE6,0xFA,0xE6,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0xFA,0xE6,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x37,0xD6,0x0D,0x9C,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0xAF,0xAC,0xFA,0xE6,0xB9,0xDE,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0xB4,0xC5,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x78,0xD6,0x0D,0x9C,0x44,0x6A,0xE2,0x61,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0xAF,0xAC,0xFA,0xE6,0xFA,0xE6,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0x0D,0x9C,0x32,0xBD,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xB4,0xC5,0xAF,0xAC,0x08,0x83,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0xAF,0xAC,0xFA,0xE6,0xB9,0xDE,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0xAF,0xAC,0xFA,0xE6,0xFA,0xE6,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x8A,0x8B,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0xAF,0xAC,0xFA,0xE6,0xFA,0xE6,0x8A,0x8B,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x08,0x83,0x78,0xD6,0x5C,0xEF,0x32,0xBD,0x8A,0x8B,0xAF,0xAC,0xFA,0xE6,0xFA,0xE6,0x0D,0x9C,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0xA6,0x72,0x8A,0x8B,0xFA,0xE6,0xFA,0xE6,0xAF,0xAC,0x8A,0x8B,0x32,0xBD,0xFA,0xE6,0xB9,0xDE,0x08,0x83,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0x32,0xBD,0xA6,0x72,0x44,0x6A,0xB4,0xC5,0x5C,0xEF,0xB9,0xDE,0xB4,0xC5,0x37,0xD6,0xFA,0xE6,0xB4,0xC5,0x8A,0x8B,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xAF,0xAC,0x44,0x6A,0xA6,0x72,0x37,0xD6,0x5C,0xEF,0xB9,0xDE,0x32,0xBD,0x78,0xD6,0xFA,0xE6,0xB4,0xC5,0x08,0x83,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x5C,0xEF,0x32,0xBD,0x44,0x6A,0x44,0x6A,0x0D,0x9C,0x37,0xD6,0x9D,0xF7,0x9D,0xF7,0x5C,0xEF,0x78,0xD6,0x8A,0x8B,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x8A,0x8B,0xB4,0xC5,0x5C,0xEF,0xAF,0xAC,0x44,0x6A,0x44,0x6A,0xAF,0xAC,0x78,0xD6,0x9D,0xF7,0x9D,0xF7,0x5C,0xEF,0xB4,0xC5,0x08,0x83,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x08,0x83,0x0D,0x9C,0x08,0x83,0x44,0x6A,0x03,0x62,0xA6,0x72,0x8A,0x8B,0xAF,0xAC,0xAF,0xAC,0x0D,0x9C,0x8A,0x8B,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0x08,0x83,0x0D,0x9C,0x08,0x83,0x03,0x62,0x03,0x62,0xA6,0x72,0x8A,0x8B,0xAF,0xAC,0xAF,0xAC,0x0D,0x9C,0x08,0x83,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xC2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0x03,0x62,0x44,0x6A,0x03,0x62,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xC2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0xE2,0x61,0x03,0x62,0x03,0x62,0x44,0x6A,0x03,0x62,0xC2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0xA6,0x72,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0xA6,0x72,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xA6,0x72,0xAF,0xAC,0xB9,0xDE,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0xB4,0xC5,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0x0D,0x9C,0xB4,0xC5,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0x37,0xD6,0xAF,0xAC,0x08,0x83,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x44,0x6A,0xA6,0x72,0xA6,0x72,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0xA6,0x72,0xA6,0x72,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x44,0x6A,0xA6,0x72,0xA6,0x72,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0xA6,0x72,0xA6,0x72,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x08,0x83,0xAF,0xAC,0x32,0xBD,0x32,0xBD,0x8A,0x8B,0x44,0x6A,0x03,0x62,0xE2,0x61,0x44,0x6A,0x8A,0x8B,0xAF,0xAC,0x32,0xBD,0xAF,0xAC,0x08,0x83,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x44,0x6A,0x8A,0x8B,0xAF,0xAC,0x32,0xBD,0xAF,0xAC,0x8A,0x8B,0x44,0x6A,0x03,0x62,0x03,0x62,0xA6,0x72,0x8A,0x8B,0x32,0xBD,0x32,0xBD,0x0D,0x9C,0xA6,0x72,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x08,0x83,0xB4,0xC5,0xB9,0xDE,0xFA,0xE6,0xFA,0xE6,0x78,0xD6,0xAF,0xAC,0xA6,0x72,0x44,0x6A,0x8A,0x8B,0x37,0xD6,0xFA,0xE6,0xFA,0xE6,0xB9,0xDE,0xB4,0xC5,0x8A,0x8B,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x8A,0x8B,0xB4,0xC5,0xB9,0xDE,0xFA,0xE6,0xFA,0xE6,0x37,0xD6,0x0D,0x9C,0x44,0x6A,0x44,0x6A,0x0D,0x9C,0x78,0xD6,0xFA,0xE6,0xFA,0xE6,0xB9,0xDE,0xB4,0xC5,0x8A,0x8B,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0xAF,0xAC,0x5C,0xEF,0x5C,0xEF,0x37,0xD6,0xFA,0xE6,0x9D,0xF7,0xB9,0xDE,0x08,0x83,0x08,0x83,0x32,0xBD,0xFF,0xFF,0xFA,0xE6,0x78,0xD6,0xFA,0xE6,0xFF,0xFF,0xB4,0xC5,0x08,0x83,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0xFA,0xE6,0x37,0xD6,0xFA,0xE6,0xDF,0xEF,0x37,0xD6,0x08,0x83,0x8A,0x8B,0x37,0xD6,0xFF,0xFF,0xB9,0xDE,0x78,0xD6,0xFA,0xE6,0xDF,0xEF,0xAF,0xAC,0xA6,0x72,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xC2,0x61,0x08,0x83,0x32,0xBD,0x5C,0xEF,0xB4,0xC5,0xA6,0x72,0x0D,0x9C,0x78,0xD6,0xFA,0xE6,0x0D,0x9C,0xAF,0xAC,0x78,0xD6,0x9D,0xF7,0x0D,0x9C,0x08,0x83,0x0D,0x9C,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xC2,0x61,0x8A,0x8B,0xB4,0xC5,0x5C,0xEF,0xAF,0xAC,0xA6,0x72,0xAF,0xAC,0xFA,0xE6,0x78,0xD6,0x8A,0x8B,0xAF,0xAC,0xB9,0xDE,0xFA,0xE6,0x8A,0x8B,0x08,0x83,0xAF,0xAC,0x9D,0xF7,0xB4,0xC5,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0xAF,0xAC,0xB4,0xC5,0x0D,0x9C,0x44,0x6A,0x8A,0x8B,0x78,0xD6,0xFA,0xE6,0x0D,0x9C,0xAF,0xAC,0xB9,0xDE,0x5C,0xEF,0x8A,0x8B,0xC2,0x61,0x8A,0x8B,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0xAF,0xAC,0xB4,0xC5,0x8A,0x8B,0x44,0x6A,0x0D,0x9C,0xFA,0xE6,0x78,0xD6,0x0D,0x9C,0x32,0xBD,0xFA,0xE6,0xFA,0xE6,0xA6,0x72,0xC2,0x61,0x0D,0x9C,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x08,0x83,0x8A,0x8B,0x08,0x83,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0xFA,0xE6,0x8A,0x8B,0xAF,0xAC,0xB9,0xDE,0x5C,0xEF,0x8A,0x8B,0xC2,0x61,0x08,0x83,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,
-0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,
-0xC2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x44,0x6A,0x08,0x83,0x8A,0x8B,0xA6,0x72,0xA6,0x72,0xAF,0xAC,0x5C,0xEF,0x78,0xD6,0x8A,0x8B,0x32,0xBD,0x5C,0xEF,0xFA,0xE6,0xA6,0x72,0xC2,0x61,0x0D,0x9C,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0x32,0xBD,0x5C,0xEF,0x78,0xD6,0x08,0x83,0xAF,0xAC,0xB9,0xDE,0x5C,0xEF,0x8A,0x8B,0xC2,0x61,0x08,0x83,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x44,0x6A,0x44,0x6A,
-0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,
-0xA6,0x72,0xA6,0x72,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x08,0x83,0xB4,0xC5,0x5C,0xEF,0xB4,0xC5,0xA6,0x72,0xAF,0xAC,0x5C,0xEF,0xFA,0xE6,0xA6,0x72,0xC2,0x61,0x0D,0x9C,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x08,0x83,0xB9,0xDE,0x5C,0xEF,0x32,0xBD,0xA6,0x72,0x0D,0x9C,0xB9,0xDE,0x5C,0xEF,0x8A,0x8B,0xC2,0x61,0x08,0x83,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x08,0x83,0xAF,0xAC,
-0x78,0xD6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,0xFA,0xE6,
-0xFA,0xE6,0xB4,0xC5,0x8A,0x8B,0x44,0x6A,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x8A,0x8B,0xFA,0xE6,0xFA,0xE6,0xAF,0xAC,0xA6,0x72,0xAF,0xAC,0x5C,0xEF,0xFA,0xE6,0xA6,0x72,0xC2,0x61,0x0D,0x9C,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0xAF,0xAC,0x5C,0xEF,0x37,0xD6,0x8A,0x8B,0x44,0x6A,0x0D,0x9C,0xB9,0xDE,0x5C,0xEF,0x8A,0x8B,0xC2,0x61,0x08,0x83,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x08,0x83,0xB4,0xC5,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xB9,0xDE,0x0D,0x9C,0x44,0x6A,0xE2,0x61,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0x32,0xBD,0x9D,0xF7,0xB4,0xC5,0x08,0x83,0x44,0x6A,0xAF,0xAC,0x5C,0xEF,0xFA,0xE6,0xA6,0x72,0xC2,0x61,0x0D,0x9C,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x0D,0x9C,0x78,0xD6,0xFA,0xE6,0xAF,0xAC,0x44,0x6A,0x44,0x6A,0xAF,0xAC,0xB9,0xDE,0x5C,0xEF,0x8A,0x8B,0xC2,0x61,0x08,0x83,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x08,0x83,0xAF,0xAC,
-0x78,0xD6,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,0xB9,0xDE,
-0xB9,0xDE,0xB4,0xC5,0x8A,0x8B,0x44,0x6A,0xE2,0x61,0x03,0x62,0x03,0x62,0x44,0x6A,0xAF,0xAC,0xB9,0xDE,0xB9,0xDE,0x0D,0x9C,0x03,0x62,0x44,0x6A,0xAF,0xAC,0x5C,0xEF,0xFA,0xE6,0xA6,0x72,0xC2,0x61,0x0D,0x9C,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x8A,0x8B,0xB4,0xC5,0x5C,0xEF,0x32,0xBD,0x08,0x83,0xE2,0x61,0x03,0x62,0xAF,0xAC,0xB9,0xDE,0x5C,0xEF,0x8A,0x8B,0xC2,0x61,0x08,0x83,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x03,0x62,0x44,0x6A,
-0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xA6,0x72,
-0xA6,0x72,0x44,0x6A,0x44,0x6A,0x03,0x62,0x03,0x62,0xE2,0x61,0x44,0x6A,0x8A,0x8B,0x37,0xD6,0x5C,0xEF,0x32,0xBD,0x08,0x83,0xC2,0x61,0x44,0x6A,0xAF,0xAC,0x5C,0xEF,0xFA,0xE6,0xA6,0x72,0xC2,0x61,0x0D,0x9C,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xAF,0xAC,0xFA,0xE6,0xFA,0xE6,0x8A,0x8B,0x03,0x62,0xC2,0x61,0x03,0x62,0xAF,0xAC,0xFA,0xE6,0x5C,0xEF,0x08,0x83,0xC2,0x61,0x08,0x83,0x5C,0xEF,0x78,0xD6,0x0D,0x9C,0x03,0x62,0xE2,0x61,0x03,0x62,0xE2,0x61,
-0xE2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,0xC2,0x61,
-0xC2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0xC2,0x61,0x44,0x6A,0x32,0xBD,0x5C,0xEF,0xB9,0xDE,0x08,0x83,0x03,0x62,0xC2,0x61,0x44,0x6A,0xAF,0xAC,0x5C,0xEF,0xFA,0xE6,0xA6,0x72,0xC2,0x61,0x0D,0x9C,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x08,0x83,0x37,0xD6,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0xA6,0x72,0xA6,0x72,0x44,0x6A,0x0D,0x9C,0x78,0xD6,0x9D,0xF7,0x0D,0x9C,0xA6,0x72,0x0D,0x9C,0x5C,0xEF,0x37,0xD6,0x0D,0x9C,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x8A,0x8B,0xB9,0xDE,0x5C,0xEF,0xB4,0xC5,0x08,0x83,0xA6,0x72,0xA6,0x72,0xA6,0x72,0xAF,0xAC,0xFA,0xE6,0xFA,0xE6,0x8A,0x8B,0x08,0x83,0xAF,0xAC,0x9D,0xF7,0xB4,0xC5,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0xAF,0xAC,0xFA,0xE6,0x5C,0xEF,0x37,0xD6,0x32,0xBD,0x32,0xBD,0xAF,0xAC,0x08,0x83,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xB4,0xC5,0x32,0xBD,0x37,0xD6,0x9D,0xF7,0xB4,0xC5,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xC2,0x61,0x08,0x83,0x32,0xBD,0x5C,0xEF,0xFA,0xE6,0xB4,0xC5,0x32,0xBD,0x32,0xBD,0x0D,0x9C,0x08,0x83,0x0D,0x9C,0x37,0xD6,0x5C,0xEF,0xB4,0xC5,0x32,0xBD,0x78,0xD6,0x9D,0xF7,0x32,0xBD,0x08,0x83,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x08,0x83,0xB4,0xC5,0x9D,0xF7,0xFF,0xFF,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0xB9,0xDE,0x8A,0x8B,0xA6,0x72,0x0D,0x9C,0xB9,0xDE,0x5C,0xEF,0x9D,0xF7,0x9D,0xF7,0xFA,0xE6,0x0D,0x9C,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x8A,0x8B,0xB4,0xC5,0x9D,0xF7,0xFF,0xFF,0x9D,0xF7,0x9D,0xF7,0x9D,0xF7,0x37,0xD6,0x8A,0x8B,0xA6,0x72,0xAF,0xAC,0xB9,0xDE,0x5C,0xEF,0x9D,0xF7,0x5C,0xEF,0xB9,0xDE,0x8A,0x8B,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xC2,0x61,0xA6,0x72,0x0D,0x9C,0xAF,0xAC,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0xAF,0xAC,0x08,0x83,0x44,0x6A,0xA6,0x72,0x0D,0x9C,0x32,0xBD,0xB4,0xC5,0x32,0xBD,0xAF,0xAC,0xA6,0x72,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xA6,0x72,0x0D,0x9C,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0x32,0xBD,0xAF,0xAC,0xA6,0x72,0x44,0x6A,0x08,0x83,0xAF,0xAC,0x32,0xBD,0xB4,0xC5,0x32,0xBD,0x0D,0x9C,0xA6,0x72,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0xE2,0x61,0x03,0x62,0x03,0x62,0xE2,0x61,0xE2,0x61,0x44,0x6A,0x44,0x6A,0x44,0x6A,0x03,0x62,0x03,0x62,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x03,0x62,0x44,0x6A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0xE2,0x61,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x15,0x24,0x89,0x43,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x89,0x43,
-0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,
-0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x25,0x5A,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x15,0x24,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x15,0x24,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x25,0x5A,0x25,0x5A,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x25,0x5A,0x25,0x5A,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x25,0x5A,0x15,0x24,0x15,0x24,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x15,0x24,0x15,0x24,0x15,0x24,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x25,0x5A,0x25,0x5A,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,
-0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x25,0x5A,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x03,0x62,0x25,0x5A,0x25,0x5A,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x15,0x24,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,
-
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x04,0x11,0x23,0x23,0x3D,0x3D,0x3D,0x56,0x56,0x56,0x56,0x72,0x72,0x72,0x72,0x72,0x92,0x92,0x72,0x92,0x92,0x72,0x92,0x92,0x72,0x92,0x72,0x72,0x72,0x72,0x72,0x56,0x56,0x56,0x56,0x3D,0x3D,0x3D,0x23,0x23,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x11,0x23,0x23,0x23,0x23,0x3D,0x3D,0x56,0x56,0x72,0x92,0x92,0x92,0xAE,0xAE,0xCD,0xCD,0xCD,0xE7,0xE7,0xE7,0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xE7,0xE7,0xCD,0xCD,0xCD,0xAE,0xAE,0x92,0x92,0x72,0x72,0x56,0x3D,0x3D,0x3D,0x23,
-0x23,0x23,0x11,0x11,0x0B,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x04,0x04,0x04,0x23,0x3D,0x56,0x72,0x92,0xAE,
-0xCD,0xCD,0xE7,0xE7,0xE7,0xE7,0xF6,0xF6,0xF6,0xF6,0xF6,0xF6,0xF6,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xF6,0xFF,0xFF,0xF6,0xF6,0xF6,0xF6,0xF6,0xF6,0xE7,0xF6,0xE7,0xE7,0xCD,0xAE,0xAE,0x92,0x72,0x56,0x3D,0x23,0x04,0x04,0x04,0x04,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x23,0x3D,0x56,0x72,0x92,0xAE,0xAE,0xCD,0xCD,0xCD,0xE7,0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,
-0xE7,0xE7,0xCD,0xCD,0xAE,0xAE,0xAE,0x92,0x72,0x56,0x3D,0x23,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x23,0x23,0x3D,0x56,0x56,0x72,0x92,0xAE,0xCD,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xCD,0xAE,0x92,0x92,0x72,0x56,0x3D,0x23,0x23,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x11,0x11,0x23,0x3D,0x72,0x92,0xCD,0xE7,0xF6,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xF6,0xE7,0xCD,0x92,0x72,0x3D,0x23,0x11,0x11,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x23,0x3D,0x72,0xAE,0xCD,0xCD,0xE7,0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE7,0xE7,0xCD,0xAE,0x92,0x72,0x56,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x3D,0x56,0x72,0x92,0xAE,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0xAE,0x92,0x72,0x56,0x3D,0x23,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x11,0x23,0x3D,0x72,0xAE,0xCD,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x92,0x72,0x3D,0x23,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3D,0x72,0xAE,0xCD,0xE7,0xF6,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xF6,0xE7,0xE7,0xAE,0x72,0x3D,0x11,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0x72,0x92,0xAE,0xCD,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xCD,0xAE,0x92,0x72,0x56,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x23,0x3D,0x56,0x92,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE7,0xAE,0x72,0x3D,0x23,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x11,0x3D,0x92,0xCD,0xF6,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xF6,0xF6,0xCD,0x92,0x3D,0x23,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,0x72,0x92,0xCD,0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE7,0xCD,0xAE,0x72,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x23,0x3D,0x72,0x92,0xCD,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x92,0x72,0x3D,0x11,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x0B,0x11,0x3D,0x72,0xAE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xAE,0x56,0x23,0x11,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,0x72,0xCD,0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xF6,0xE7,0xAE,0x72,0x23,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x23,
-0x72,0xAE,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0xAE,0x72,0x3D,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x11,0x23,0x56,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,
-0x92,0x56,0x23,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x11,0x3D,0x92,0xCD,0xF6,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xFF,0xF6,0xE7,0x92,0x3D,0x11,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0x72,0xCD,0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xE7,0xAE,0x72,0x3D,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x23,0x56,0x92,0xCD,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x56,0x23,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x11,0x3D,0x72,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x92,0x3D,0x11,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x72,0xAE,0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE7,0xAE,0x72,0x23,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x3D,0x92,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x92,0x3D,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x56,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE7,0xAE,0x56,0x23,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x72,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x72,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x56,0x92,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x92,0x56,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x11,0x56,0xAE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xAE,0x56,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x23,0x56,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xCD,0x56,0x23,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0x92,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x92,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x3D,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0x92,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x56,0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xAE,0x56,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x3D,0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xAE,0x3D,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xAE,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x56,0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xAE,0x56,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x3D,0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xAE,0x3D,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xAE,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x23,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x56,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE7,0x72,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x56,0xAE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x56,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x56,0xAE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xF6,0xAE,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0xAE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x23,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x72,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x72,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x56,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x92,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x56,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0x56,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x56,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x56,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,0xAE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xAE,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x11,0x72,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x11,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0xAE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x11,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x11,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x72,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x72,0x23,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x3D,0xAE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x72,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x72,0x11,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x04,0x3D,0x92,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x3D,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x72,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0x72,0x04,0x00,0x00,0x00,
-0x00,0x00,0x00,0x0B,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xAE,0x11,0x00,0x00,0x00,0x00,0x00,0x04,0x3D,0xAE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x23,0x04,0x00,0x00,
-0x00,0x00,0x11,0x72,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0x56,0x11,0x00,0x00,0x00,0x04,0x23,0x92,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x92,0x23,0x00,0x00,
-0x00,0x00,0x3D,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x3D,0x00,0x00,0x00,0x04,0x56,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x56,0x0B,0x00,
-0x00,0x23,0x72,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x72,0x23,0x00,0x00,0x3D,0xAE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xAE,0x3D,0x00,
-0x00,0x56,0xCD,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xCD,0x56,0x00,0x00,0x72,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE7,0x72,0x04,
-0x04,0x92,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x11,0x23,0x92,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x23,
-0x3D,0xAE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x3D,0x56,0xAE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x56,
-0x72,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0x92,0xAE,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0x92,
-0xAE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCD,0xAE,0xCD,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xCD,
-0xCD,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xCD,0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE7,
-0xE7,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xF4,
-0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE5,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,
-0xCA,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xCA,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,
-0x8F,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0xA9,0x8F,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x8F,
-0x70,0xA9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x51,0x3A,0xA9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x51,
-0x1F,0xA9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x1F,0x0B,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8F,0x00,
-0x04,0x70,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x70,0x00,0x00,0x51,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x51,0x00,
-0x00,0x3A,0xA9,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xA9,0x3A,0x00,0x04,0x1F,0x70,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x70,0x1F,0x00,
-0x00,0x0B,0x51,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x51,0x04,0x00,0x00,0x04,0x3A,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x3A,0x00,0x00,
-0x00,0x00,0x1F,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x1F,0x00,0x00,0x00,0x00,0x1F,0x51,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x70,0x1F,0x00,0x00,
-0x00,0x00,0x0B,0x3A,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x0B,0xA9,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x8F,0x0B,0x00,0x00,0x00,
-0x00,0x00,0x00,0x0B,0x70,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x70,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3A,0xA9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8F,0x3A,0x04,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0B,0x70,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x70,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xA9,0x3A,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x1F,0x70,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x70,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0xA9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x8F,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x70,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0xA9,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xA9,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x51,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x51,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x51,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x51,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3A,0xA9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x51,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x70,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x70,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x1F,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3A,0xA9,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xA9,0x51,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0B,0x51,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x51,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x70,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x51,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0xA9,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,0x3A,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x51,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x51,0xA9,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,0x51,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0xA9,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xA9,0x51,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0B,0x51,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,0x51,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xA9,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3A,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0x8F,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x8F,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x8F,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x51,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x51,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x51,0xA9,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xA9,0x51,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x51,0x8F,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x8F,0x51,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x70,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x70,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x51,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x51,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x3A,0x8F,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x8F,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x70,0xA9,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE5,0xA9,0x70,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0B,0x3A,0x8F,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x70,0x3A,0x0B,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0x70,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xE5,0x8F,0x51,0x1F,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0x70,0xCA,0xE5,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE5,0xCA,0x8F,0x3A,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0B,0x3A,0x8F,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xF4,0xCA,0x8F,0x51,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x1F,0x51,0x8F,
-0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x8F,0x51,0x1F,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3A,0x70,0xA9,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0xA9,0x70,
-0x1F,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
-0x04,0x1F,0x70,0xA9,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE5,0xCA,0x70,0x3A,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x0B,0x1F,0x51,0xA9,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0x70,0x3A,0x1F,0x0B,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x04,0x00,0x1F,0x3A,0x70,0x8F,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xCA,0x8F,0x70,0x51,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3A,0x70,0xA9,0xCA,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE5,0xCA,0x8F,0x70,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0B,0x1F,0x51,0x8F,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xF4,0xCA,0x8F,0x51,0x1F,0x0B,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x1F,0x3A,0x70,0xA9,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x8F,0x51,0x3A,0x1F,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x0B,0x51,0x70,0x8F,0xA9,0xCA,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xCA,0xA9,0x8F,0x70,0x3A,0x0B,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x0B,0x3A,0x70,0xA9,0xE5,0xE5,0xF4,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xF4,0xE5,0xCA,0xA9,0x70,0x3A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x1F,0x3A,0x70,0x8F,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0xA9,0x70,0x3A,0x1F,0x1F,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x3A,0x51,0x70,0x8F,0xA9,0xCA,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xCA,0xA9,0x8F,0x70,0x51,0x3A,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x51,0x70,0xA9,0xCA,0xCA,0xE5,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE5,0xE5,0xCA,0xCA,0xA9,0x70,0x3A,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0B,0x0B,0x0B,0x1F,0x51,0x70,0x8F,0xCA,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xF4,0xE5,0xCA,0x8F,0x70,0x3A,0x1F,0x0B,0x0B,0x0B,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0B,0x1F,0x3A,0x3A,0x51,0x70,0x8F,0xA9,0xCA,0xCA,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0xCA,0xA9,0x8F,0x70,0x70,0x51,0x3A,0x3A,0x1F,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x1F,0x3A,0x51,0x70,0x8F,0xA9,0xA9,0xCA,0xCA,0xCA,0xE5,0xE5,
-0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE5,0xE5,0xCA,0xCA,0xCA,0xA9,0x8F,0x8F,0x70,0x51,0x3A,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0B,0x04,0x04,0x0B,0x1F,0x3A,0x51,0x70,0x8F,0xA9,0xA9,0xCA,0xE5,0xE5,0xE5,0xF4,0xF4,0xF4,0xF4,0xF4,0xF4,0xF4,0xF4,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xF4,0xF4,0xF4,0xF4,0xF4,0xF4,0xF4,0xE5,0xE5,0xE5,0xCA,0xCA,
-0xA9,0x8F,0x70,0x51,0x3A,0x1F,0x0B,0x04,0x04,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0B,0x0B,0x1F,0x1F,0x1F,
-0x3A,0x3A,0x3A,0x51,0x51,0x70,0x70,0x8F,0x8F,0xA9,0xA9,0xCA,0xCA,0xCA,0xE5,0xE5,0xE5,0xE5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xE5,0xE5,0xE5,0xE5,0xCA,0xCA,0xCA,0xA9,0xA9,0x8F,0x8F,0x8F,0x70,0x51,0x51,0x3A,0x3A,0x3A,0x1F,0x1F,0x1F,0x0B,0x0B,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x3A,0x3A,0x3A,0x51,0x51,0x70,0x51,0x70,0x70,0x70,0x70,0x70,0x8F,0x8F,0x8F,0x8F,0x8F,0x8F,0x8F,0x8F,0x8F,0x70,0x70,0x70,0x70,0x70,0x70,0x70,0x51,0x51,0x51,0x3A,0x3A,0x3A,0x1F,0x1F,0x0B,0x0B,0x00,0x00,0x00,
-0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_pitch_scale_png_data, "ui_img_pitch_scale_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_pitch_scale_png = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 240,
-    .data_size = sizeof(ui_img_pitch_scale_png_data),
+    .data_size = 172800,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = ui_img_pitch_scale_png_data
 };
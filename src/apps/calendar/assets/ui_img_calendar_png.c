@@ -4,148 +4,18 @@
 // Project name: lv_9_16bit
 
 #include "../calendar.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/calendar.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_calendar_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x2C,0x5F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x43,0x7F,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x2C,0x5F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x43,0x7F,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x2C,0x5F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x43,0x7F,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x2C,0x5F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x43,0x7F,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x00,0x00,0x00,0x00,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x7F,0x2C,0x5F,0x2C,0x00,0x00,0x00,0x00,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x00,0x00,0x00,0x00,0x7F,0x43,0x7F,0x43,0x00,0x00,0x00,0x00,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x00,0x00,0x00,0x00,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x7F,0x2C,0x5F,0x2C,0x00,0x00,0x00,0x00,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x00,0x00,0x00,0x00,0x7F,0x43,0x7F,0x43,0x00,0x00,0x00,0x00,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x00,0x00,0x00,0x00,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x7F,0x2C,0x5F,0x2C,0x00,0x00,0x00,0x00,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x00,0x00,0x00,0x00,0x7F,0x43,0x7F,0x43,0x00,0x00,0x00,0x00,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x00,0x00,0x5F,0x15,0x5F,0x15,0x00,0x00,0x1F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x7F,0x2C,0x00,0x00,0x7F,0x2C,0x5F,0x2C,0x00,0x00,0x3F,0x34,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x00,0x00,0x7F,0x43,0x7F,0x43,0x00,0x00,0x3F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x0D,0x5F,0x1D,0x5F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x9F,0x2C,0x9F,0x24,0x3F,0x34,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x3B,0x7F,0x4B,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x24,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x24,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x1F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x3F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x2C,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x3B,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x05,0xBF,0x05,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0xBF,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xDF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x1F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x05,0xBF,0x05,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0xBF,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0x3F,0x2C,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0x7F,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xDF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x1F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0x1F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x05,0xBF,0x05,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0xBF,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0x3F,0x2C,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0x7F,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x4B,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x7F,0x4B,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xDF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x0D,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0x00,0x00,0x00,0x00,0xBF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x1F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x24,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0x1F,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x4B,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0xBF,0x52,0x00,0x00,0x00,0x00,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x06,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x4A,0xFF,0x52,0xFF,0x52,0xDF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0x1F,0x4B,0xFF,0x52,0xFF,0x52,0xDF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x0D,0xBF,0x0D,0x9F,0x0D,0x9F,0x0D,0x7F,0x0D,0x7F,0x15,0x5F,0x15,0x5F,0x15,0x3F,0x15,0x3F,0x15,0x1F,0x1D,0x1F,0x1D,0x1F,0x1D,0xFF,0x1C,0xFF,0x1C,0xDF,0x1C,0xDF,0x24,0xBF,0x24,0xBF,0x24,0x9F,0x24,0x9F,0x24,0x7F,0x2C,0x7F,0x2C,0x5F,0x2C,0x5F,0x2C,0x3F,0x2C,0x3F,0x34,0x3F,0x34,0x1F,0x34,0x1F,0x34,0xFF,0x33,0xFF,0x33,0xDF,0x3B,0xDF,0x3B,0xBF,0x3B,0xBF,0x3B,0x9F,0x3B,0x9F,0x43,0x7F,0x43,0x7F,0x43,0x7F,0x43,0x5F,0x43,0x5F,0x4B,0x3F,0x4B,0x3F,0x4B,0x1F,0x4B,0xFF,0x4A,0xFF,0x52,0xFF,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-    //alpha channel data:
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xC0,0xF4,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xF4,0xBF,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x88,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x85,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4C,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0x00,0xBF,0xBF,0x00,0x19,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0x00,0xC3,0xC2,0x00,0x19,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0x00,0xC3,0xC2,0x00,0x19,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x00,0x00,0x00,0x00,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x00,0x00,0x00,0x00,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x00,0x00,0x00,0x00,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x6C,0x15,0x15,0x6C,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x6C,0x15,0x15,0x6C,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x6C,0x15,0x15,0x6C,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB3,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xB4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB5,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0xB4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0x00,0x00,0x07,0xAC,0xF9,0xFF,0xFF,0xFF,0xF9,0xAB,0x07,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0x00,0x00,0x07,0xAA,0xF9,0xFF,0xFF,0xFF,0xF9,0xA9,0x06,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xF3,0xFF,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0xFF,0xF1,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xBF,0xFF,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xFF,0xBD,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x4D,0xFF,0xF9,0x78,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x79,0xF9,0xFF,0x4B,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x85,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x83,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0xBE,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xBD,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(ui_img_calendar_png_data, "ui_img_calendar_png_data.bin");
 const lv_image_dsc_t ui_img_calendar_png = {
    .header.w = 64,
    .header.h = 64,
-   .data_size = sizeof(ui_img_calendar_png_data),
+   .data_size = 12288,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .data = ui_img_calendar_png_data};
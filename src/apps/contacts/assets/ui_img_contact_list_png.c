@@ -4,150 +4,19 @@
 // Project name: nav
 
 #include "../contacts.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/contact_list.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_contact_list_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,
-0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xDF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x07,0x1F,0x06,0xFF,0x05,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,
-0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x06,0x1F,0x06,0xFF,0x05,0xFF,0x05,0xFF,0x05,0xDF,0x05,
-0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x06,0x1F,0x06,0xFF,0x05,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,
-0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x05,0x1F,0x06,0xFF,0x05,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,
-0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x06,0xFF,0x05,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x05,0xFF,0x05,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,
-0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x06,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,
-0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x7F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,
-0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,
-0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,
-0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x5F,0x04,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x04,0x1F,0x04,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,
-0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x5F,0x04,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x05,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,
-0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x9F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xDF,0x05,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x5F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,
-0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x05,0xBF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x5F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x05,0xBF,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,
-0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x7F,0x05,0x7F,0x05,0x7F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x3F,0x05,0xDF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x03,0x5F,0x03,0x5F,0x03,
-0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x05,0x5F,0x05,0x5F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xDF,0x04,
-0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x05,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x03,0x3F,0x03,0x3F,0x03,
-0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x05,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x05,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,
-0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x3F,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x05,0x1F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,
-0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x05,0x1F,0x05,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xBF,0x03,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x02,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x04,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,
-0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x02,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,
-0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,
-0x9F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x04,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,
-0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xFF,0x04,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,
-0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x04,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,
-0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x04,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,
-0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x5F,0x03,0x5F,0x03,0xBF,0x02,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xDF,0x04,0xDF,0x04,0xDF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0xBF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x03,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,
-0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x05,0xBF,0x04,0xBF,0x04,0x9F,0x04,0x9F,0x04,0x9F,0x04,0x7F,0x04,0x7F,0x04,0x7F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x02,0xBF,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,
-0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x02,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x02,0x5F,0x02,
-0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x04,0x7F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x03,
-0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x04,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,
-0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x9F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x9F,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x04,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x3F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,
-0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x04,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,
-0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x3F,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,
-0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,
-0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x04,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,
-0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x04,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,
-0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1F,0x04,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xBF,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0xFF,0x03,0xFF,0x03,0xDF,0x03,0xDF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0x1F,0x00,0x00,0x00,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,
-0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0x00,0x00,0x00,0x00,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x03,0xDF,0x03,0xFF,0x03,0xDF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x3F,0x03,
-0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,
-0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x03,0x9F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,
-0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x03,0x9F,0x03,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,
-0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x03,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,
-0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x03,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,
-0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x03,0x5F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,
-0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0x5F,0x03,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,
-0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x03,0x3F,0x03,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,
-0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x9F,0x00,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x02,0x3F,0x03,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,
-0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x9F,0x00,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x03,0x1F,0x03,0xFF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,
-0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x9F,0x00,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x02,0xFF,0x02,0xDF,0x02,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,
-0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x9F,0x00,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x04,0xDF,0x02,0xDF,0x02,0xBF,0x02,0xBF,0x02,
-0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x9F,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x02,0xBF,0x02,0x9F,0x02,0x9F,0x02,0x7F,0x02,0x7F,0x02,0x7F,0x02,0x5F,0x02,0x5F,0x02,0x3F,0x02,0x3F,0x02,0x1F,0x02,0x1F,0x02,0x1F,0x02,0xFF,0x01,0xFF,0x01,0xDF,0x01,0xDF,0x01,0xDF,0x01,0xBF,0x01,0xBF,0x01,0x9F,0x01,0x9F,0x01,0x7F,0x01,0x7F,0x01,0x7F,0x01,0x5F,0x01,0x5F,0x01,0x3F,0x01,0x3F,0x01,0x1F,0x01,0x1F,0x01,0x1F,0x01,0xFF,0x00,0xFF,0x00,
-0xDF,0x00,0xDF,0x00,0xBF,0x00,0xBF,0x00,0xBF,0x00,0x9F,0x00,0x9F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4F,0x9E,0xD3,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xE1,0xC2,0x7B,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x60,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xAD,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xB1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0xD3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x11,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xB1,0x89,0x76,0x85,0xAA,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB4,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x6E,0x0A,0x00,0x00,0x00,0x00,0x00,0x05,0x5C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x0E,0x3F,0x44,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC4,0x16,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x28,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC4,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xA7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6E,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x28,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x89,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x0D,0x3F,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x1C,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x89,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x66,0x66,0x66,0x66,0x66,0x66,0x6B,0xA1,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x0B,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x88,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,
-0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x15,0x4F,0x55,0x6E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0x8E,0x65,0x50,0x60,0x87,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x30,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x98,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xAE,0x60,0x36,0x1B,0x06,0x18,0x31,0x58,0xA4,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x21,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x7A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x79,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x67,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x06,0x2E,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x12,0x11,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAB,0x13,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x92,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x77,0x77,0x77,0x77,0x77,0x77,0x7B,0xAF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x53,0x66,0x57,0x34,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA5,0x01,0x00,0x00,0x00,0x00,0x09,
-0x76,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0x87,0x10,0x00,0x00,0x00,0x00,0x00,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x0C,0x00,0x00,0x00,0x00,0x2C,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x3F,0x00,0x00,0x00,0x00,0x02,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x68,0x00,0x00,0x00,0x00,0x30,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x4A,0x00,0x00,0x00,0x00,0x46,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0x05,0x00,0x00,0x00,0x10,0xE1,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x22,0x00,0x00,0x00,0x00,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x94,0x00,0x00,0x00,0x00,0x87,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x00,0x00,0x00,0x00,0x72,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x46,0x00,0x00,0x00,0x07,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x1E,0x00,0x00,0x00,0x23,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0x00,0x00,0x00,0x48,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6A,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x01,0x00,0x00,0x00,0x75,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x97,0x00,0x00,0x00,0x00,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x0E,0x3F,0x44,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x00,0x00,0x00,0x00,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x28,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x00,0x00,0x00,0x00,0x91,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0xB6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x00,0x00,0x00,0x00,0x91,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0xB6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x03,0x00,0x00,0x00,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x28,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x89,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x01,0x00,0x3F,0xFA,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5E,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x0D,0x3F,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x1C,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xCA,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x66,0x66,0x66,0x66,0x66,0x66,0x6B,0xA1,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x06,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xB4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x4E,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xD2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x5D,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xAA,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x4C,0x9C,0xD1,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xDF,0xC0,0x79,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_contact_list_png_data, "ui_img_contact_list_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_contact_list_png = {
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .header.w = 64,
    .header.h = 64,
-   .data_size = sizeof(ui_img_contact_list_png_data),
+   .data_size = 12288,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .data = ui_img_contact_list_png_data};
 
@@ -4,54 +4,19 @@
 // Project name: nav
 
 #include "../contacts.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/contact.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_contact_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x87,0xAF,0x6F,0xAF,0x6F,0xAF,0x67,0x8F,0x67,0x8F,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xFC,0xB6,0xFB,0xB6,0xFB,0x95,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0x6F,0xAF,0x6F,0xAF,0x6F,0xAF,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB7,0xFB,0xB6,0xFB,0x96,0xFB,0x95,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0x6F,0xAF,0x6F,0xAF,0x6F,0xAF,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x5F,0x8E,0x5F,0xED,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xFB,0x96,0xFB,0x95,0xFB,0x74,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xAF,0x67,0xAF,0x6F,0xAF,0x6F,0xAF,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xFB,0x95,0xFB,0x74,0xFB,0x74,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0x6F,0xAF,0x6F,0xAF,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x57,0x6E,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xFB,0x74,0xFB,0x74,0xFB,0x53,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0x6F,0xAF,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x57,0x6E,0x57,0x6E,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xFC,0xB7,0xFB,0xB6,0xFB,0x96,0xFB,0x95,0xFB,0x74,0xFB,0x74,0xFB,0x53,0xFB,0x53,0xFB,0x33,0xFB,0x32,0xFB,0x12,0xFB,0x11,0xFB,0x11,0xFB,
-0xAF,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x57,0x6E,0x57,0x4E,0x57,0x4E,0x57,0x4D,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xFB,0xB6,0xFB,0x96,0xFB,0x95,0xFB,0x74,0xFB,0x74,0xFB,0x53,0xFB,0x53,0xFB,0x33,0xFB,0x32,0xFB,0x12,0xFB,0x11,0xFB,0x11,0xFB,0xF0,0xFA,0x8F,0x67,0x8F,0x67,0x8F,0x67,0x8F,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x57,0x6E,0x57,0x4E,0x57,0x4E,0x57,0x4E,0x4F,0x4D,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xB7,0xFB,0x96,0xFB,0x95,0xFB,0x74,0xFB,0x74,0xFB,0x53,0xFB,0x53,0xFB,0x33,0xFB,0x32,0xFB,0x12,0xFB,0x11,0xFB,0x11,0xFB,0xF0,0xFA,0xF0,0xFA,0x8F,0x67,0x8F,0x67,0x8F,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x57,0x6E,0x57,0x4E,0x57,0x4E,0x57,0x4E,0x4F,0x4E,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0xFB,0x74,0xFB,0x74,0xFB,0x54,0xFB,0x53,0xFB,0x33,0xFB,0x32,0xFB,0x12,0xFB,0x31,0xFB,0xF0,0xFA,0xF0,0xFA,0xD0,0xFA,0x10,0xFC,
-0x8F,0x67,0x8F,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x57,0x6E,0x57,0x4E,0x57,0x4E,0x57,0x4E,0x4F,0x4E,0x4F,0x0E,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xFB,0x32,0xFB,0x12,0xFB,0x11,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x5F,0x6E,0x57,0x6E,0x57,0x4E,0x57,0x4E,0x57,0x4E,0x4F,0x2E,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xFB,0x12,0xFB,0x11,0xFB,0x11,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x57,0x6E,0x5F,0x6E,0x5F,0x6E,0x57,0x6E,0x57,0x4E,0x57,0x4E,0x57,0x4E,0x4F,0x4E,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0xFB,0x11,0xFB,0x11,0xFB,0xF0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x6E,0x57,0x6E,0x57,0x6E,0x57,0x4E,0x57,0x4E,0x57,0x4E,0x4F,0x4D,0x4F,0x4D,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xFB,0x10,0xFB,0xF0,0xFA,0xD0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4E,0x57,0x6E,0x57,0x4E,0x57,0x4E,0x57,0x4E,0x4F,0x4D,0x4F,0x2D,0x4F,0x2D,0x4F,0x4E,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xFB,0xF0,0xFA,0xAA,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6E,0x57,0x4E,0x57,0x4E,0x4F,0x4D,0x4F,0x2D,0x4F,0x2D,0x4F,0x2D,0x47,0x2D,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x4E,0x57,0x4E,0x4F,0x4D,0x4F,0x2D,0x4F,0x2D,0x4F,0x2D,0x47,0x2D,0x47,0x0D,0x47,0x0D,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4E,0x4F,0x2D,0x4F,0x2D,0x4F,0x2D,0x47,0x2D,0x47,0x0D,0x47,0x0D,0x47,0x0C,0x3F,0x0D,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x57,0x2D,0x4F,0x2D,0x47,0x2D,0x47,0x0D,0x47,0x0D,0x47,0x0C,0x3F,0x0C,0x3F,0xEC,0x3E,0xEC,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x47,0x2D,0x47,0x0D,0x47,0x0D,0x47,0x0C,0x3F,0x0C,0x3F,0xEC,0x3E,0xEC,0x3E,0xEC,0x36,0xAB,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0x47,0x0D,0x47,0x0C,0x3F,0x0C,0x3F,0xEC,0x3E,0xEC,0x3E,0xEC,0x36,0xEC,0x36,0xCC,0x36,0xAC,0x36,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x1E,0x6A,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x46,0x0C,0x3F,0x0C,0x3F,0xEC,0x3E,0xEC,0x3E,0xEC,0x36,0xEC,0x36,0xCC,0x36,0xCC,0x36,0xCB,0x36,0xCB,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2E,0x8A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x4A,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x3E,0xEC,0x3E,0xEC,0x3E,0xEC,0x36,0xEC,0x36,0xCC,0x36,0xCC,0x36,0xCB,0x36,0xCB,0x2E,0xAB,0x2E,0xAB,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x69,0x16,0xC9,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x36,0xEC,0x36,0xEC,0x36,0xCC,0x36,0xCC,0x36,0xCB,0x36,0xCB,0x2E,0xAB,0x2E,0xAB,0x2E,
-0xAB,0x2E,0x8B,0x26,0x8B,0x2E,0x00,0x00,0x00,0x00,0x8A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x29,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x36,0xCC,0x36,0xCC,0x36,0xCB,0x36,0xCB,0x2E,0xAB,0x2E,0xAB,0x2E,0xAB,0x2E,0xAB,0x26,0x8B,0x26,0x8B,0x26,0x8A,0x1E,0x4B,0x26,0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x49,0x0E,0x29,0x0E,0x29,0x0E,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x36,0xCB,0x36,0xCB,0x2E,0xAB,0x2E,0xAB,0x2E,0xAB,0x2E,0xAB,0x26,0x8B,0x26,0x8B,0x26,0x8A,0x26,0x8A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x49,0x0E,0x29,0x0E,0x29,0x0E,0x29,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0x36,0xAB,0x2E,0xAB,0x2E,0xAB,0x2E,0xAB,0x26,0x8B,0x26,
-0x8B,0x26,0x8A,0x26,0x8A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x49,0x0E,0x29,0x0E,0x29,0x0E,0x29,0x06,0x28,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2E,0xAB,0x26,0xAB,0x26,0x8B,0x26,0x8B,0x26,0x8A,0x26,0x8A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x49,0x0E,0x29,0x0E,0x29,0x0E,0x29,0x06,0x29,0x06,0x08,0x06,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8B,0x26,0x8B,0x26,0x8A,0x26,0x8A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x49,0x0E,0x29,0x0E,0x29,0x0E,0x29,0x06,0x29,0x06,0x08,0x06,0x08,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x26,0x8A,0x1E,
-0x6A,0x1E,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x49,0x0E,0x29,0x0E,0x29,0x0E,0x29,0x06,0x29,0x06,0x08,0x06,0x08,0x06,0xAA,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x1E,0x6A,0x1E,0x6A,0x16,0x4A,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x49,0x0E,0x29,0x0E,0x29,0x0E,0x29,0x06,0x29,0x06,0x08,0x06,0x08,0x06,0xE8,0x05,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x16,0x49,0x16,0x49,0x16,0x49,0x0E,0x49,0x0E,0x29,0x0E,0x29,0x0E,0x29,0x06,0x29,0x06,0x08,0x06,0x08,0x06,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x06,0x49,0x0E,0x29,0x0E,0x29,0x0E,0x29,0x06,0x29,0x06,0x28,0x06,0x08,0x06,0xE8,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
-
-0x00,0x00,0x00,0x06,0x77,0xD8,0xEE,0xBF,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xAB,0xF1,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xD6,0xFF,0xFF,0xFF,0xFF,0xF4,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B,0xFF,0xFF,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xFF,0xFF,0xEC,0x00,0x00,0x00,0x00,0x00,
-0x19,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xFF,0xFF,0xEC,0x00,0x00,0x00,0x00,0x00,0x95,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xFF,0xFF,0xEC,0x00,0x00,0x00,0x00,0x00,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xA6,0xEB,0xEE,0xEE,0xF1,0xFF,0xFF,0xFE,0xEE,0xEE,0xEE,0xE5,0x6D,
-0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2E,0x00,0x00,0x00,0x00,0x00,0x38,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x31,0x00,0x00,0x00,0x00,0x00,0x0F,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x31,0x33,0x33,0x5C,0xFF,0xFF,0xF0,0x33,0x33,0x33,0x2A,0x02,
-0x92,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x90,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xFF,0xFF,0xEC,0x00,0x00,0x00,0x00,0x00,0x4C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xFF,0xFF,0xEC,0x00,0x00,0x00,0x00,0x00,0x06,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xFF,0xFF,0xEA,0x00,0x00,0x00,0x00,0x00,
-0x00,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xE0,0xFF,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x37,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x23,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x4F,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xC0,0xFF,0xFF,0xC3,0x2B,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x4D,0x00,0x00,0x00,0x00,0x00,0x97,0xFF,0xFF,0xFF,0xFF,0xF9,0x81,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x98,0x0B,0x00,0x00,0x3C,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0x39,0x0E,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x38,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xC3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xE4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0x9E,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xAA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x30,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x89,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x3E,0x7E,0xBD,0xE9,0xF3,0xD2,0x85,0x18,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_contact_png_data, "ui_img_contact_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_contact_png = {
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .header.w = 32,
    .header.h = 32,
-   .data_size = sizeof(ui_img_contact_png_data),
+   .data_size = 3072,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .data = ui_img_contact_png_data};
 
@@ -4,54 +4,19 @@
 // Project name: nav
 
 #include "../contacts.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/sos_contact.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_sos_contact_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x7F,0xDF,0x9F,0xE7,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x9F,0xE7,0x9F,0xE7,0x3F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x9F,0xDF,0x9F,0xE7,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x3F,0xCF,0x1F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xE7,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x9F,0xE7,0x5F,0xDF,0x3F,0xCF,0x1F,0xCF,0x1F,0xCF,0x3F,0xCF,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xDF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x5F,0xD7,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x3F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x7F,0xE7,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xDD,0xD6,0x78,0xE5,0x5B,0xD6,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x5F,0xD7,0xB4,0xEC,0x6F,0xFB,0x90,0xFB,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x3F,0xCF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE7,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x9F,0xE7,0x1F,0xCF,0x94,0xEC,0x6F,0xFB,0x6F,0xFB,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xBE,0x1F,0xCF,0xFF,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xDF,
-0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x7F,0xEF,0x32,0xF4,0xB0,0xFB,0x6F,0xFB,0x6F,0xFB,0x6F,0xFB,0xB0,0xFB,0xD0,0xFB,0x3B,0xDE,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xC6,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xFF,0xC6,0x3F,0xAE,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xDF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xFC,0xF6,0x6F,0xFB,0x6F,0xFB,0x6F,0xFB,0x6F,0xFB,0x6F,0xFB,0x6F,0xFB,0x6F,0xFB,0x37,0xE5,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x3F,0xCF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x8D,0xFF,0x9D,0x3F,0xD7,0xBF,0xEF,0xBF,0xEF,0x3F,0xCF,0xDF,0xC6,0x1F,0xAE,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x9F,0xEF,0xD5,0xEC,0x73,0xF4,0xB0,0xFB,0x6F,0xFB,0x6F,0xFB,0x73,0xF4,0x74,0xF4,0x9C,0xD6,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x3F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x95,0xFF,0x9D,0xFF,0x9D,0x7F,0xB6,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0xDF,0xBE,0xFF,0xBD,0x00,0x00,0x00,0x00,
-0x9F,0xE7,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x1F,0xCF,0x1F,0xCF,0x94,0xEC,0x6F,0xFB,0x6F,0xFB,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x3F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xAD,0xDF,0x9D,0xFF,0x9D,0xFF,0x9D,0x9F,0x8D,0xBF,0x8D,0x1F,0xC7,0x1F,0xCF,0x1F,0xCF,0x7F,0xAE,0x00,0x00,0x00,0x00,0x7F,0xE7,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x3F,0xCF,0x1F,0xCF,0xF5,0xEC,0x6F,0xFB,0xD0,0xFB,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x8D,0xFF,0x9D,0xFF,0x9D,0xDF,0x9D,0x5F,0x85,0x5F,0x85,0xDF,0x95,0x1F,0xCF,0x1F,0xCF,0xBF,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xE7,0xBF,0xEF,0xBF,0xEF,0x7F,0xDF,0x1F,0xCF,0xFE,0xCE,0x3B,0xDE,0xBD,0xD6,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x95,0xFF,0x9D,0xFF,0x9D,0xBF,0x95,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x1F,0xA6,0x1F,0xCF,0x9F,0xB6,0x00,0x00,0x00,0x00,
-0x00,0x00,0xFF,0xFF,0x9F,0xE7,0xBF,0xEF,0x9F,0xEF,0x3F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x95,0xFF,0x9D,0xFF,0x9D,0x9F,0x8D,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0xAE,0xFF,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xE7,0xBF,0xEF,0xBF,0xEF,0x7F,0xDF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x95,0xFF,0x9D,0xFF,0x9D,0x7F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0xFF,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0xBF,0xEF,0x5F,0xDF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0xFF,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x8D,0xFF,0x9D,0xFF,0x9D,0x7F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x9F,0xE7,0x9F,0xEF,0xBF,0xE7,0x9F,0xEF,0x9F,0xE7,0x1F,0xCF,0x1F,0xCF,0xFF,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x95,0xDF,0x9D,0xFF,0x9D,0x9F,0x8D,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x95,0xFF,0x9D,0xBF,0x95,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x95,0xFF,0x9D,0xDF,0x9D,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x84,0xDF,0x9D,0xFF,0x9D,0x7F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xC6,0x9F,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x95,0xFF,0x9D,0xBF,0x95,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x3F,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xD7,0xBF,0xEF,0xBF,0xEF,0x1F,0xCF,0x7F,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x95,0xFF,0x9D,0x7F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,
-0x3F,0x85,0x00,0x00,0xDF,0x8D,0xBF,0x95,0x3F,0xD7,0xBF,0xEF,0xBF,0xEF,0x7F,0xDF,0xDF,0xBE,0x7F,0xAE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x95,0xDF,0x9D,0xDF,0x95,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0xDF,0x9D,0xFF,0x9D,0xFF,0x9D,0xBF,0xBE,0x7F,0xDF,0x1F,0xCF,0x1F,0xCF,0xDF,0xBE,0x3F,0xAE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x95,0xDF,0x9D,0xBF,0x8D,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x9F,0x8D,0x9F,0x8D,0x7F,0x85,0xBF,0x95,0x1F,0xC7,0x1F,0xCF,0x1F,0xCF,0x9F,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xB6,0x9F,0xB6,0x00,0x00,0x00,0x00,0xBF,0x8D,0x9F,0x8D,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,
-0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0xBF,0x95,0x1F,0xCF,0x1F,0xCF,0x1F,0xCF,0xFF,0x9D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0x00,0x00,0x00,0x00,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0xFF,0x9D,0x1F,0xCF,0x1F,0xC7,0x9F,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xB6,0xBE,0xB6,0xBE,0xAE,0xBE,0xB6,0xDE,0xB6,0x00,0x00,0x00,0x00,0xFF,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x7F,0xB6,0x7F,0xAE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xB6,0xBE,0xB6,0x00,0x00,0x00,0x00,0xBE,0xB6,0xBE,0xB6,0x1F,0xAF,0xBE,0xB6,0xDE,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x9D,0xBF,0x8D,0x5F,0x85,
-0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x7F,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xB6,0xBE,0xB6,0xBF,0xB6,0x00,0x00,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xB6,0xBE,0xB6,0xBE,0xB6,0x7F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x85,0x5F,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBF,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x85,0x5F,0x8D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0xBE,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0xE1,0xFB,0xFE,0xFD,0xEC,0xA7,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x55,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x14,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xC5,0x95,0x00,0x00,0x00,0x00,0x00,0x38,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xEA,0x1B,0x00,0x00,0x00,0x23,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x66,
-0x00,0x00,0x00,0x00,0x00,0x14,0xF7,0xFF,0xFF,0xFF,0xFF,0xF6,0x21,0x00,0x00,0x00,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4B,0x00,0x00,0x00,0x00,0x00,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x04,0x00,0x00,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x15,0x00,0x00,0x00,0x00,0x06,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x00,0x00,0x5A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB5,0x00,
-0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x00,0x00,0x00,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x33,0x00,0x00,0x00,0x00,0x00,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC4,0x00,0x00,0x00,0x04,0xD9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0x0C,0x00,0x00,0x00,0x00,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x5A,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xA1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x08,0x00,0x00,0x00,0x00,0x00,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x92,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF0,0xF5,0xEF,0xD6,0x7E,0x48,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0x20,0x00,0x00,0x00,0x00,0x00,0xCB,0xFF,0xFF,0xE1,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x6E,0x11,0x00,0x19,0xBC,0xFF,0xFF,0xFF,0xFF,0xF4,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x12,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x22,0x00,0x00,0x42,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xF4,0xEF,0xA5,0x00,0x00,0x15,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x0A,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xBA,0x70,0x13,0xF9,0x1B,0x00,0x00,0x04,0x7C,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x91,0x00,0x00,0x00,0x00,0x00,0x20,0x35,0x00,0x00,0xB2,0x6C,0x09,0xF6,0x1B,0x00,0x00,0x00,0x00,0x4A,0xE5,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xEF,0x25,0x00,0x57,0xDE,0x9A,0xC2,0x00,0x00,0x00,0x00,0x21,0xD8,0x7F,0x22,0x77,0xC2,0xF4,0xFF,0xFF,0xED,0xC2,0x6A,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x7E,0xF1,0x99,0x89,0xF7,0xFF,0x98,0x36,0x26,0x3B,0x84,0xEF,0x85,0x01,0x00,0x00,0x00,0x00,0x0A,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x88,0x92,0x4F,0x49,0xAF,0xE8,0xF8,0xE1,0xA0,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_sos_contact_png_data, "ui_img_sos_contact_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_sos_contact_png = {
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .header.w = 32,
    .header.h = 32,
-   .data_size = sizeof(ui_img_sos_contact_png_data),
+   .data_size = 3072,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .data = ui_img_sos_contact_png_data};
 
@@ -33,7 +33,7 @@ void ui_event_contactScreen(lv_event_t *e)
         
     }
 
-    if (event_code == LV_EVENT_GESTURE && lv_indev_get_gesture_dir(lv_indev_active()) == LV_DIR_RIGHT)
+    if (event_code == LV_EVENT_GESTURE && input_bus_gesture_dir() == LV_DIR_RIGHT)
     {
         ui_app_exit();
     }
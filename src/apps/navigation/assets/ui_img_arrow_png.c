@@ -4,150 +4,19 @@
 // Project name: nav
 
 #include "../navigation.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/arrow.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_arrow_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xDF,0xFF,0xBF,0xFF,0xDF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,
-0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x9F,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x9F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x1E,0x7F,0x16,0x7F,0x1E,0x7F,0x1E,0xDF,0x1D,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0x9F,0xFF,0x9F,0xFF,
-0x9F,0xFF,0xBF,0xFF,0x5F,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x1E,0x9F,0x1E,0x7F,0x1E,0x7F,0x1E,0x7F,0x1E,0x9F,0x26,0xBE,0x1D,0x5D,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xFF,0x9F,0xF7,0x9F,0xFF,0x9F,0xFF,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x3F,0xB7,0x7F,0x1E,0x7F,0x1E,0x7F,0x1E,0x7F,0x1E,0x9F,0x26,0xBE,0x36,0xDD,0x3E,0xFC,0x3D,0x1C,0x25,0x3D,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xFF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xF7,0x7F,0xDF,0x1F,0x97,0xBF,0x4E,0x7F,0x1E,0x7F,0x1E,0x9F,0x1E,0xBE,0x2E,0xBD,0x3E,0xDD,0x3E,0xDD,0x3E,0x1C,0x36,0x3C,0x2D,0x1D,0x1D,0x7D,0x1D,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0x9F,0xDF,0x3F,0x97,0xDF,0x4E,
-0x7F,0x1E,0x7F,0x1E,0x9F,0x26,0xBE,0x2E,0xBD,0x3E,0xBD,0x3E,0xBD,0x3E,0xDD,0x3E,0xBD,0x3E,0x1D,0x36,0x5C,0x2D,0x3C,0x25,0x3D,0x25,0xFE,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0x9F,0xDF,0x3F,0x97,0xDF,0x4E,0x7F,0x1E,0x7F,0x1E,0x9F,0x26,0xBE,0x2E,0xBD,0x3E,0xBD,0x3E,0xBD,0x3E,0xBD,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0x1D,0x2E,0x5C,0x2D,0x5C,0x2D,0x5D,0x25,0x5D,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF7,
-0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xFF,0x9F,0xD7,0x1F,0x8F,0xBF,0x46,0x7F,0x1E,0x7F,0x1E,0x9F,0x26,0x9E,0x2E,0xBE,0x36,0xBD,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x2E,0xFD,0x2D,0x7C,0x2D,0x5C,0x2D,0x5D,0x2D,0x5D,0x25,0x9D,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xD7,0x1F,0x8F,0x9F,0x3E,0x7F,0x1E,0x7F,0x1E,0x7F,0x26,0x9E,0x2E,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,
-0xBE,0x36,0xBE,0x2E,0xBE,0x2E,0xBE,0x2E,0x9E,0x2E,0xBE,0x2E,0x1D,0x2E,0x7D,0x2D,0x7D,0x2D,0x7D,0x2D,0x7D,0x25,0x7D,0x25,0xBE,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0x9F,0xD7,0x1F,0x8F,0x9F,0x3E,0x5F,0x1E,0x5F,0x1E,0x7F,0x26,0x9E,0x2E,0x9E,0x36,0x9E,0x36,0xBE,0x36,0x9E,0x36,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x1E,0x2E,0x9D,0x2D,0x9D,0x25,0x9D,0x25,0x7D,0x25,0x7D,0x25,0x9E,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xD7,0x1F,0x8F,0x9F,0x3E,0x5F,0x1E,0x5F,0x1E,0x5F,0x26,0x7E,0x2E,0x9E,0x36,0x9E,0x36,0x9E,0x36,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x26,0x9E,0x26,0x9E,0x26,0x9E,0x26,0x1E,0x26,0x9D,0x25,0x9D,0x25,0x9D,0x25,0x9D,0x25,0x9D,0x25,0x9E,0x25,0xBE,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xD7,0x1F,0x8F,0x7F,0x3E,0x3F,0x1E,0x3F,0x1E,0x5F,0x26,0x7E,0x2E,0x9E,0x36,0x9E,0x36,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x9E,0x2E,0x7E,0x2E,0x7E,0x26,0x9E,0x26,0x7E,0x26,0x7E,0x26,
-0x7E,0x26,0x9F,0x26,0x7F,0x26,0x1E,0x26,0x9D,0x25,0x9D,0x25,0x9D,0x25,0x9D,0x25,0x9E,0x25,0x9E,0x25,0x9E,0x25,0x1D,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x7F,0xCF,0x1F,0x8F,0x7F,0x3E,0x3F,0x26,0x3F,0x26,0x5F,0x26,0x7E,0x2E,0x9E,0x2E,
-0x9E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x26,0x7E,0x26,0x7E,0x26,0x7F,0x26,0x7F,0x26,0x7F,0x26,0x7F,0x26,0x7F,0x26,0x7F,0x26,0x1E,0x26,0xBE,0x25,0x9E,0x25,0x9E,0x25,0x9E,0x25,0x9E,0x25,0xBE,0x25,0xBE,0x25,0x9D,0x4D,0xBB,0xC5,0xFD,0xEE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x7F,0xC7,0xDF,0x7E,0x5F,0x3E,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x5E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x26,0x7E,0x26,0x7E,0x26,0x7E,0x26,0x7E,0x26,0x7F,0x26,0x7F,0x26,0x7F,0x26,0x5F,0x26,0x7F,0x26,0x7F,0x26,0x5F,0x26,0x7F,0x26,0x1E,0x26,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0x9B,0x8D,0xBB,0xC5,0x9D,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x7F,0xCF,0xDF,0x86,0x3F,0x3E,0x1F,0x26,0x3F,0x26,0x3F,0x26,0x5E,0x2E,0x5E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x7E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5E,0x26,0x5E,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x1E,
-0x1E,0x26,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0x7A,0xB5,0xFC,0xCD,0x9D,0xDE,0xDE,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0x7F,0xCF,0xDF,0x86,0x3F,0x3E,0x1F,0x26,0x1F,0x26,0x3F,0x26,0x5E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5F,0x2E,0x5E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5E,0x26,0x5E,0x26,
-0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x5F,0x26,0x1E,0x26,0xDE,0x25,0xDE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBD,0x4D,0x7A,0xBD,0x3C,0xD6,0xBE,0xE6,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xBF,0xFF,0xBF,0xF7,0x5F,0xC7,0xDF,0x86,0x3F,0x3E,0xFF,0x25,
-0x1F,0x26,0x3F,0x2E,0x3E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5E,0x2E,0x5F,0x2E,0x5F,0x2E,0x5F,0x2E,0x3F,0x26,0x3F,0x26,0x5F,0x26,0x5F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x5F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x5F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x1E,0x1F,0x26,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBE,0x25,0xBC,0x8D,0xBB,0xC5,0x5D,0xD6,0xDE,0xE6,0x3F,0xF7,0xDF,0xFE,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x05,0xBF,0x86,0xBF,0x86,0x1F,0x3E,0xFF,0x2D,0xFF,0x2D,0x1F,0x2E,0x3E,0x2E,0x3E,0x2E,0x3E,0x2E,0x3E,0x2E,0x3E,0x2E,0x3F,0x2E,0x3F,0x2E,0x3F,0x2E,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x1F,0x26,0xFE,0x25,0xDE,0x25,
-0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0x7A,0xAD,0xFB,0xCD,0x9D,0xDE,0xFE,0xEE,0x5F,0xF7,0x7F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x25,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0x1E,0x2E,0x3E,0x2E,0x3E,0x2E,0x3F,0x2E,0x3F,0x2E,0x3E,0x2E,0x3F,0x2E,0x3F,0x2E,0x3F,0x2E,0x3F,0x2E,0x3F,0x26,0x1F,0x26,0x1F,0x26,0x3F,0x26,0x3F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x3F,0x26,0x1F,0x26,
-0x1F,0x26,0x3F,0x26,0x1F,0x26,0x3F,0x26,0x1F,0x26,0x3F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x3F,0x26,0x3F,0x26,0x3F,0x26,0x1F,0x26,0xFE,0x2D,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xBD,0x4D,0x7A,0xBD,0x3C,0xD6,0xBD,0xE6,0x1F,0xEF,0x5F,0xF7,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x25,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0x1F,0x2E,0x3F,0x2E,0x1F,0x2E,0x1E,0x2E,0x1E,0x2E,0x1E,0x2E,0x1F,0x2E,
-0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xFE,0x2D,0xFE,0x25,0xFE,0x25,0xDE,0x25,0xDF,0x25,0xDF,0x25,0xDE,0x25,0xDE,0x25,0xDE,0x25,0xDF,0x25,0xDF,0x25,0xDE,0x25,0xBC,0x8D,0xBB,0xC5,0x5C,0xD6,0xDE,0xE6,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0xFF,0xFF,
-0xBF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0xFF,0x2D,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x26,0xFF,0x25,0x1F,0x26,0xFF,0x2D,0x1F,0x26,0xFF,0x25,0xFF,0x25,0xFF,0x25,0xFF,0x25,0x1F,0x26,0xFF,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x2E,0xFE,0x2D,0xFF,0x2D,0xFE,0x2D,0xFF,0x2D,0xDF,0x25,
-0xDF,0x25,0xDF,0x25,0xDF,0x25,0xDF,0x25,0xDF,0x25,0xDF,0x25,0xDF,0x25,0xDF,0x25,0x7A,0xAD,0xFB,0xCD,0x9D,0xDE,0xFE,0xEE,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0xBF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0x1F,0x2E,0xFF,0x2D,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x25,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x25,0xFF,0x25,0xFF,0x25,
-0xFF,0x25,0xFF,0x25,0xFF,0x25,0xFF,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1E,0x2E,0x1E,0x2E,0xFF,0x2D,0xFF,0x2D,0xFE,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x25,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x25,0xDF,0x25,0xDF,0x25,0xDE,0x4D,0x7A,0xBD,0x3C,0xCE,0xBD,0xE6,0x1E,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0xBF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,
-0xFF,0x2D,0xDF,0x2D,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x25,0xFF,0x25,0xFF,0x25,0xFF,0x25,0xFF,0x25,0xFF,0x25,0x1F,0x26,0x1E,0x2E,0x1E,0x2E,0x1E,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x25,0xFF,0x25,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x25,0xBC,0x8D,0xBB,0xC5,0x5C,0xD6,0xDE,0xE6,0x3F,0xEF,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,
-0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x25,0xFF,0x25,0x1F,0x2E,0x3E,0x2E,0x1E,0x2E,0x1E,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,
-0xDF,0x2D,0xDF,0x2D,0xDF,0x25,0xDF,0x25,0xFF,0x25,0xFF,0x25,0xFF,0x25,0x7A,0xAD,0xFB,0xCD,0x9D,0xDE,0xFE,0xEE,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x00,0x00,0xBF,0x2D,0xBF,0x35,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,
-0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0x1E,0x2E,0x3E,0x36,0x1E,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDE,0x4D,0x7A,0xBD,0x1C,0xCE,0xBD,0xDE,0x1E,0xEF,0x5F,0xF7,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0x2D,0xBF,0x35,0xBF,0x35,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,
-0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBE,0x2D,0xBF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0x1E,0x2E,0x3E,0x36,0x3E,0x2E,0x1E,0x2E,0x1E,0x2E,0x1E,0x2E,0x1F,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xBC,0x8D,0xBB,0xC5,0x5D,0xD6,0xDE,0xE6,0x3F,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x35,0x5D,0xA6,0xDD,0x75,0xBF,0x35,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9E,0x35,0x7E,0x35,0x7E,0x35,0x7E,0x2D,0x5E,0x2D,0x5E,0x2D,0x3E,0x2D,0x3E,0x2D,0x3D,0x2D,0x1D,0x2D,0x1D,0x2D,0x1D,0x2D,0x5E,0x2D,0xBE,0x2D,0x1E,0x36,0x3E,0x36,0x3E,0x36,0x3E,0x2E,0x1E,0x2E,0x1E,0x2E,0x1F,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,
-0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0x9B,0xB5,0xFB,0xCD,0x7D,0xDE,0xFE,0xE6,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xFB,0xC5,0x19,0xAD,0x9B,0xA5,0xDD,0x85,0xBF,0x3D,0xBF,0x35,0xBF,0x2D,0xBF,0x2D,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x7E,0x35,0x7E,0x35,0x7E,0x35,0x5E,0x35,0x5E,0x2D,0x5E,0x2D,0x3E,0x2D,0x3E,0x2D,0x1D,0x2D,
-0x1D,0x2D,0xFD,0x2C,0xFD,0x2C,0xFD,0x2C,0x1E,0x36,0x3E,0x36,0x3E,0x36,0x1E,0x2E,0x1E,0x2E,0x1E,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDE,0x4D,0x7A,0xBD,0x1C,0xCE,0xBD,0xDE,0x1E,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0x1B,0xCE,0x39,0xB5,0x39,0xB5,0x5A,0xB5,0xBB,0xAD,0xDD,0x85,
-0xDF,0x45,0xBF,0x35,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x7E,0x35,0x7E,0x35,0x7E,0x35,0x5E,0x35,0x5E,0x2D,0x5E,0x2D,0x3E,0x2D,0x3E,0x2D,0x1D,0x2D,0x1D,0x2D,0x1D,0x2D,0xFD,0x2C,0x7E,0x2D,0x3E,0x36,0x3E,0x36,0x3E,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xBC,0x8D,0xBB,0xC5,0x5C,0xD6,0xDE,0xE6,0x3F,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5C,0xCE,0x7A,0xBD,0x9A,0xBD,0x9A,0xBD,0xBB,0xBD,0xBB,0xC5,0xFC,0xB5,0x1D,0x8E,0xDE,0x4D,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x7E,0x35,0x7E,0x35,0x7E,0x35,0x5E,0x35,0x5E,0x35,0x3E,0x35,0x3E,0x2D,0x3E,0x2D,0x1D,0x2D,0x1D,0x2D,0xFD,0x2C,0x3D,0x2D,0x3E,0x36,0x3E,0x36,0x1E,0x2E,0x1F,0x2E,0x1F,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,
-0xDF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0x7B,0xAD,0xDB,0xC5,0x7D,0xDE,0xFE,0xE6,0x3F,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x7C,0xD6,0xBB,0xC5,0xDB,0xC5,0xDB,0xC5,0xFB,0xC5,0xFB,0xC5,0xFB,0xC5,0xFB,0xC5,0x1C,0xBE,0x1D,0x96,0xDE,0x55,0x9F,0x35,0x9F,0x35,0x7F,0x35,0x7E,0x35,0x7E,0x35,0x7E,0x35,0x5E,0x35,0x5E,0x35,0x3E,0x35,
-0x3E,0x2D,0x3E,0x2D,0x1D,0x2D,0x1D,0x2D,0x3D,0x2D,0x3E,0x36,0x3E,0x36,0x1E,0x2E,0x1F,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDE,0x4D,0x7A,0xBD,0x1C,0xCE,0x9D,0xDE,0x1E,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0x9D,0xDE,0xFB,0xCD,0x1B,0xCE,
-0x1C,0xCE,0x1C,0xCE,0x1C,0xCE,0x3C,0xCE,0x3C,0xD6,0x5C,0xD6,0x5C,0xD6,0x5D,0xC6,0x3D,0x96,0xBE,0x55,0x7F,0x35,0x7E,0x35,0x7E,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x3E,0x35,0x3E,0x35,0x1E,0x2D,0x1D,0x2D,0x1D,0x2D,0x3E,0x36,0x1E,0x36,0x1E,0x2E,0x1F,0x2E,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xBC,0x8D,0xBB,0xC5,0x3C,0xD6,0xDE,0xE6,0x1F,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xDF,0xFF,0xBF,0xF7,0xBD,0xDE,0x3C,0xCE,0x3C,0xD6,0x5C,0xD6,0x5C,0xD6,0x5C,0xD6,0x7C,0xD6,0x7C,0xD6,0x9D,0xD6,0x9D,0xDE,0x9D,0xDE,0x9D,0xDE,0x7D,0xC6,0xFE,0x6D,0x7E,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x3E,0x35,0x3E,0x35,0x1E,0x2D,0x1D,0x2D,0x1E,0x36,0x1E,0x36,0x1E,0x2E,0xFE,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,
-0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0x7B,0xAD,0xDB,0xC5,0x7D,0xDE,0xFE,0xE6,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0xDD,0xE6,0x7C,0xD6,0x7D,0xD6,0x9D,0xDE,0x9D,0xDE,0x9D,0xDE,0x9D,0xDE,0xBD,0xDE,0xBD,0xDE,0xBD,0xDE,0xBD,0xDE,0xDD,0xDE,0xDD,0xE6,0x7E,0xA6,0x7E,0x3D,0x5E,0x35,0x5E,0x35,
-0x5E,0x35,0x5E,0x35,0x3E,0x35,0x3E,0x35,0x1E,0x2D,0x1E,0x36,0x1E,0x36,0x1F,0x36,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDE,0x4D,0x7A,0xBD,0x1C,0xCE,0x9D,0xDE,0x1E,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,
-0xFE,0xE6,0xBD,0xDE,0xBD,0xDE,0xBD,0xDE,0xBD,0xDE,0xDD,0xDE,0xDD,0xE6,0xDD,0xE6,0xDD,0xE6,0xFE,0xE6,0xFE,0xE6,0xFE,0xE6,0xFE,0xE6,0x7E,0xA6,0x7E,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x3E,0x35,0x3E,0x35,0xFE,0x35,0x1E,0x36,0xFF,0x35,0xFF,0x2D,0xFF,0x2D,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0x9C,0x8D,0x9B,0xBD,0x3C,0xD6,0xDE,0xE6,0x1F,0xEF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0x1E,0xE7,0xDD,0xE6,0xDD,0xE6,0xFD,0xE6,0xDD,0xE6,0xFE,0xE6,0xFE,0xE6,0xFE,0xE6,0x1E,0xE7,0x1E,0xEF,0x1E,0xEF,0x1E,0xEF,0x1E,0xEF,0xFE,0x6D,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x3E,0x35,0x3E,0x35,0xDE,0x35,0xFE,0x35,0xFF,0x35,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,
-0xBF,0x2D,0xBF,0x2D,0xBF,0x2D,0x7B,0xAD,0xDB,0xC5,0x7D,0xDE,0xFE,0xE6,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0x3E,0xEF,0xFE,0xE6,0x1E,0xE7,0x1E,0xE7,0x1E,0xEF,0x1E,0xEF,0x1E,0xEF,0x3E,0xEF,0x3E,0xEF,0x3E,0xEF,0x3E,0xEF,0x3E,0xEF,0xDE,0xC6,0x7E,0x35,
-0x5E,0x35,0x5E,0x35,0x5E,0x35,0x3E,0x35,0x3E,0x35,0xDE,0x35,0xFE,0x35,0xFE,0x35,0xFF,0x2D,0xDF,0x2D,0xDF,0x2D,0xDF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x35,0xBF,0x35,0xBF,0x2D,0xBF,0x2D,0xBE,0x4D,0x7A,0xBD,0x1C,0xCE,0x9D,0xDE,0xFE,0xEE,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xFF,0x9F,0xFF,0x9F,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,
-0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0x5E,0xEF,0x1E,0xEF,0x3E,0xEF,0x3E,0xEF,0x3E,0xEF,0x3E,0xEF,0x5E,0xEF,0x3E,0xEF,0x5E,0xEF,0x5E,0xEF,0x5F,0xEF,0x5F,0xF7,0xBE,0x55,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x3E,0x35,0xDE,0x35,0xFE,0x35,0xFF,0x35,0xDF,0x35,0xDF,0x2D,0xDF,0x2D,0xBF,0x2D,0xBF,0x2D,0xBF,0x35,0xBF,0x35,0xBF,0x35,0xBF,0x35,0xBF,0x35,0xBC,0x8D,0x9B,0xBD,0x3C,0xD6,0xBE,0xE6,0x1E,0xEF,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0xFF,0xFF,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,0x9F,0xFF,0x9F,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0x9F,0xF7,0x9F,0xF7,0x5F,0xEF,0x5E,0xEF,0x5E,0xEF,0x5E,0xEF,0x5F,0xEF,0x5E,0xEF,0x5F,0xEF,0x5F,0xF7,0x7F,0xF7,0x5F,0xF7,0x7F,0xF7,0x5F,0x96,0x7F,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0xBE,0x35,0xFE,0x35,0xDF,0x35,0xDF,0x35,0xDF,0x35,0xBF,0x35,0xBF,0x35,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,
-0x9F,0x35,0xBF,0x35,0x7B,0xAD,0xDB,0xC5,0x7D,0xDE,0xDE,0xE6,0x3F,0xEF,0x5F,0xF7,0x3F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9F,0xFF,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0xFF,0xCE,
-0x7F,0x35,0x5F,0x35,0x5E,0x35,0x5E,0x35,0x5E,0x35,0x9E,0x35,0xDE,0x35,0xDF,0x35,0xDF,0x35,0xDF,0x35,0xBF,0x35,0xBF,0x35,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9E,0x4D,0x5A,0xB5,0xFC,0xCD,0x9D,0xDE,0xFE,0xEE,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0xFF,0xEE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,
-0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0x4D,0x5F,0x35,0x5F,0x3D,0x5E,0x35,0x5E,0x35,0x9E,0x35,0xDE,0x35,0xDF,0x35,0xDF,0x35,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9C,0x8D,0x9B,0xBD,0x3C,0xD6,0xBE,0xE6,0x1F,0xEF,0x3F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x5F,0x86,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5E,0x35,0x9E,0x35,0xDE,0x35,0xDF,0x35,0xBF,0x35,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,
-0x9F,0x35,0x7B,0xAD,0xDB,0xC5,0x7D,0xDE,0xDE,0xE6,0x1F,0xEF,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0xDF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,
-0xFF,0xC6,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x9E,0x3D,0xDF,0x35,0xDF,0x35,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x7F,0x35,0x7F,0x35,0x9F,0x35,0x9E,0x4D,0x5A,0xBD,0xFC,0xCD,0x9D,0xDE,0xFE,0xEE,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,
-0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0x4D,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x7F,0x3D,0xDF,0x35,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x7F,0x35,0x7F,0x35,0x7F,0x35,0x7F,0x35,0x9C,0x8D,0x9B,0xBD,0x3C,0xD6,0xBE,0xE6,0x1F,0xEF,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x3F,0x86,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5E,0x35,0xBF,0x35,0xBF,0x35,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x7F,0x35,0x7F,0x35,0x7F,0x35,0x7F,0x35,
-0x7B,0xAD,0xBB,0xC5,0x5D,0xDE,0xDE,0xE6,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,
-0x7F,0xF7,0xDF,0xBE,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5E,0x3D,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x7F,0x35,0x7F,0x35,0x7F,0x3D,0x7F,0x35,0x7F,0x35,0x7E,0x4D,0x5A,0xB5,0xFC,0xCD,0x9D,0xDE,0xFE,0xEE,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,
-0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x5F,0xF7,0x7F,0x45,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x9F,0x35,0x7F,0x35,0x7F,0x3D,0x5F,0x35,0x7F,0x3D,0x7F,0x3D,0x9C,0x8D,0x7B,0xBD,0x3C,0xD6,0xBE,0xE6,0x1F,0xEF,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x1F,0x7E,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0xBF,0x35,0x9F,0x35,0x9F,0x35,0x7F,0x35,0x7F,0x3D,0x5F,0x35,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x7B,0xAD,
-0xBB,0xC5,0x5D,0xDE,0xDE,0xE6,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,
-0x7F,0xF7,0x7F,0xF7,0xBF,0xBE,0x3F,0x3D,0x5F,0x3D,0x5F,0x3D,0x9F,0x3D,0x9E,0x35,0x7F,0x3D,0x7F,0x3D,0x7F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x7E,0x4D,0x5A,0xB5,0xFC,0xCD,0x7D,0xDE,0xDE,0xEE,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x1F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xFF,0xFF,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x5F,0xEF,0x5F,0x45,0x3F,0x3D,0x3F,0x3D,0x9E,0x3D,0x7E,0x3D,0x7F,0x3D,0x7F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x7C,0x85,0x7B,0xBD,0x1C,0xD6,0x9E,0xE6,0x1F,0xEF,0x3F,0xF7,0x3F,0xF7,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0xDF,0x75,0x3F,0x3D,0x3F,0x3D,0x7E,0x3D,0x7E,0x3D,0x7F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x7B,0xAD,0xBB,0xC5,
-0x5D,0xD6,0xBE,0xE6,0x1F,0xF7,0x3F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,
-0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x9F,0xB6,0x3F,0x3D,0x3F,0x3D,0x7F,0x3D,0x7E,0x3D,0x7F,0x3D,0x5F,0x3D,0x5F,0x3D,0x3F,0x3D,0x3F,0x3D,0x5E,0x4D,0x5A,0xB5,0xFC,0xCD,0x7D,0xDE,0xFE,0xEE,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x7F,0xF7,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xEF,0x3F,0x45,0x3F,0x3D,0x5F,0x3D,0x7F,0x3D,0x5F,0x3D,0x5F,0x3D,0x3E,0x3D,0x3F,0x3D,0x3F,0x3D,0x7C,0x85,0x9B,0xC5,0x5D,0xDE,0xDD,0xEE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0xBF,0x75,0x1F,0x45,0x5F,0x3D,0x5F,0x3D,0x5F,0x3D,0x3F,0x3D,0x3F,0x3D,0x3F,0x3D,0x3F,0x3D,0x9D,0x85,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,
-0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xA6,0x1F,0x45,0x5F,0x3D,0x5F,0x3D,0x3F,0x3D,0x3F,0x3D,0x3F,0x3D,0x3F,0x3D,0x3F,0x3D,0x5F,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x45,0x1F,0x45,0x3F,0x3D,0x5F,0x3D,0x3F,0x3D,0x3F,0x3D,0x1F,0x3D,0x1F,0x45,0x1F,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x45,0x3F,0x45,0x3F,0x3D,0x3F,0x3D,0x1E,0x3D,0x1F,0x45,0x1F,0x45,0x1F,0x45,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x44,0x1E,0x45,0x3F,0x3D,0x3F,0x3D,0x1F,0x45,0x1F,0x45,0x1F,0x45,0xFF,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0x44,0x1E,0x45,0x3F,0x3D,0x1F,0x45,0x1F,0x45,0x1F,0x45,0x1E,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x45,0x1F,0x45,0x1F,0x45,0x1F,0x45,0xFF,0x44,0xFF,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x44,0x1F,0x45,0x1F,0x45,0xFF,0x44,0xFF,0x44,0x5F,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0x3C,0x1F,0x45,0xFE,0x44,0xFE,0x44,0xFE,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x44,0xFF,0x44,0xDF,0x44,0xDE,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x33,0x70,0x99,0xC0,0xDD,0xEE,0xF9,0xFA,0xEE,0xDE,0xC4,0x9C,0x75,0x39,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x4C,0xA8,0xEF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xB0,0x54,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x7C,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x87,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0x6E,0xB2,0x90,0x12,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x7E,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x8A,0x0D,0x00,0x00,0x00,0x1E,0x71,0xC5,0xFD,0xFF,0xFF,0xFF,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0x69,0x74,0xC8,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x80,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8F,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8E,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA3,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x07,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x4D,0x99,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAD,0x00,0x00,0x00,0x08,0x4D,0xA2,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x04,
-0x23,0xA5,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x37,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x72,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,
-0x7C,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC2,0x00,0x26,0x79,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x00,0x00,0x00,0x00,0x1D,0x66,0xB3,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0x02,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x04,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7A,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x87,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC2,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xC4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x6F,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x91,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xC7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD8,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x64,0xE1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x7F,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x62,0xD3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x8E,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x8D,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x56,0x7F,
-0xA7,0xC6,0xD2,0xDE,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x70,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xFE,0xFF,0xFF,0xFF,0xFF,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0xFF,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xFF,0xFF,0xFF,0xF3,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xFE,0xFF,0xFF,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xF2,0xCD,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_arrow_png_data, "ui_img_arrow_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_arrow_png = {
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .header.w = 64,
    .header.h = 64,
-   .data_size = sizeof(ui_img_arrow_png_data),
+   .data_size = 12288,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .data = ui_img_arrow_png_data};
 
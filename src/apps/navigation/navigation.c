@@ -46,7 +46,7 @@ void ui_event_navScreen(lv_event_t *e)
         onGameClosed();
     }
 
-    if (event_code == LV_EVENT_GESTURE && lv_indev_get_gesture_dir(lv_indev_active()) == LV_DIR_RIGHT)
+    if (event_code == LV_EVENT_GESTURE && input_bus_gesture_dir() == LV_DIR_RIGHT)
     {
         ui_app_exit();
     }
@@ -126,6 +126,7 @@ void ui_navScreen_screen_init()
     lv_obj_set_y(ui_navIcon, 68);
     lv_obj_set_align(ui_navIcon, LV_ALIGN_TOP_MID);
     lv_obj_remove_flag(ui_navIcon, LV_OBJ_FLAG_SCROLLABLE); /// Flags
+    lv_obj_set_style_image_recolor(ui_navIcon, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
 
     // ui_navTitle = lv_label_create(ui_navPanel);
     // lv_obj_set_width(ui_navTitle, LV_SIZE_CONTENT);  /// 1
@@ -4,60 +4,19 @@
 // Project name: nav
 
 #include "../piobot.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/pio_ear_l.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_pio_ear_l_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x20,0xFB,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x20,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFB,0xE0,0xFB,
-0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0x00,0xFC,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x60,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFA,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x20,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xFA,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFA,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xC0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFB,
-0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,
-0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFC,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xA0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xC0,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x16,0x27,0x3A,0x54,0x57,0x3F,0x2C,0x1C,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x0F,0x4D,0x9F,0xDE,0xFC,0xFF,0xFF,0xFF,0xE7,0xB2,0x5C,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x88,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xA6,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xA2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x94,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xBC,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x54,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0xBC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x32,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x60,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x7B,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x7C,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xB6,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x67,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3C,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,0x49,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x09,0x78,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xAE,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x43,0xD9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x05,0x4C,0xCA,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xDC,0x6B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x33,0x9B,0xD7,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x8F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x46,0x78,0x9C,0xC0,0xF1,0xFF,0xFF,0xFF,0xFA,0x9B,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x06,0x2C,0xC3,0xFF,0xFF,0xFF,0xFE,0xD4,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xF9,0xFF,0xFF,0xFF,0xEC,0x36,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xE5,0xFF,0xFF,0xFF,0xF3,0x73,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0xD1,0xFF,
-0xFF,0xFF,0xFB,0xAE,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xB9,0xFF,0xFF,0xFF,0xFF,0xD8,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0xF3,0xFF,0xFF,0xFF,0xE8,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4E,0xE4,0xFF,0xFF,0xFF,0xF3,0x84,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xD3,0xFF,0xFF,0xFF,0xFE,0xBC,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xAE,0xFB,0xFF,0xFF,0xFF,0xD7,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0xF1,0xFF,0xFF,0xFF,0xE7,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xE6,0xFF,0xFF,0xFF,0xF6,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xD2,0xFF,0xFF,0xFF,0xFF,0xC0,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x9F,0xF9,0xFF,0xFF,0xFF,0xD6,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x64,0xF1,0xFF,0xFF,0xFF,0xE9,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x2A,0xE9,0xFF,0xFF,0xFF,0xFC,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xC8,0xFD,0xFF,0xFF,0xFF,0xC0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x8E,0xFD,0xF8,0xCA,0x98,0x58,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3F,0x83,0x59,0x35,0x13,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_pio_ear_l_png_data, "ui_img_pio_ear_l_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_pio_ear_l_png = {
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .header.w = 30,
    .header.h = 40,
-   .data_size = sizeof(ui_img_pio_ear_l_png_data),
+   .data_size = 3600,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .data = ui_img_pio_ear_l_png_data};
 
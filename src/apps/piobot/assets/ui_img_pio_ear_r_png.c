@@ -4,60 +4,19 @@
 // Project name: nav
 
 #include "../piobot.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/pio_ear_r.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_pio_ear_r_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x80,0xE3,0x60,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xE3,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xCB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0xA0,0xE3,0x00,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xDB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xA0,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0xD4,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xE0,0xFF,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x40,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xA0,0xEB,0xA0,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xEB,0x80,0xE3,0x80,0xE3,0x00,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x1F,0x29,0x2F,0x2D,0x25,0x19,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x14,0x44,0x89,0xBF,0xE2,0xF6,0xF0,0xD3,0xA8,0x67,0x29,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x8F,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x54,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xBC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0x6F,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xBB,0xFE,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0x5C,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x90,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x76,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFE,0xCF,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xB1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x30,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x52,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xC1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,
-0x65,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x56,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x31,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xC9,0x15,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x28,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x71,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCB,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xA5,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x4A,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x25,0xA3,0xED,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0x5F,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x95,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xB2,0x4B,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x72,0xF6,0xFF,0xFF,0xFF,0xFF,0xE9,0xBC,0xA2,0x69,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xBA,0xFC,0xFF,
-0xFF,0xFF,0xF9,0x9D,0x26,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE4,0xFF,0xFF,0xFF,0xFF,0xE2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x57,0xF0,0xFF,0xFF,0xFF,0xFF,0xC8,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x96,0xF8,0xFF,0xFF,0xFF,0xFF,0xAB,0x01,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0xCD,0xFF,0xFF,0xFF,0xFF,0xEF,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xE5,0xFF,0xFF,0xFF,0xFF,0xDA,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xF0,0xFF,0xFF,0xFF,0xFF,0xC4,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xB3,0xFD,0xFF,0xFF,0xFF,0xF8,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0xD5,0xFF,0xFF,0xFF,0xFF,0xE8,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xE5,0xFF,0xFF,0xFF,0xFF,0xD7,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0xF5,0xFF,0xFF,0xFF,0xFD,0xB8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xBE,0xFF,0xFF,0xFF,0xFF,0xF2,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xD6,0xFF,0xFF,0xFF,0xFF,0xE7,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,
-0xEB,0xFF,0xFF,0xFF,0xFF,0xD1,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xFF,0xFF,0xFF,0xFF,0xF9,0x9F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x8D,0xE2,0xFF,0xFF,0xFF,0xF2,0x5F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x23,0x4B,0x70,0x9C,0xCB,0xDC,0x23,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x36,0x47,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_pio_ear_r_png_data, "ui_img_pio_ear_r_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_pio_ear_r_png = {
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .header.w = 30,
    .header.h = 40,
-   .data_size = sizeof(ui_img_pio_ear_r_png_data),
+   .data_size = 3600,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .data = ui_img_pio_ear_r_png_data};
 
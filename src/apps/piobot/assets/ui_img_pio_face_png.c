@@ -5,635 +5,19 @@
 
 
 #include "../piobot.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/pio_face.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_pio_face_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x40,0xFD,0x00,0xFC,0xA0,0xFA,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0x00,0xFC,
-0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0x80,0xEB,0x80,0xE3,0xA0,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFB,0x20,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x20,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFC,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xC0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xEB,0x80,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0xFC,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xA0,0xFA,0xC0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0xDC,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xE3,0x20,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFD,0x20,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x20,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xDB,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x40,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,
-0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xDB,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x40,0xE3,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xDB,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xEB,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xC0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xC0,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x40,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0xFC,0xE0,0xFB,0x00,0xFC,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xC0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x40,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFD,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x40,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xDC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xEB,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x40,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x80,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x20,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xC0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFB,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x60,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFD,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x40,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFD,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xDB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,
-0x80,0xE3,0x60,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFB,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFB,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0xA0,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0xF8,0xC0,0xFB,0x00,0xFC,0x00,0xFC,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFA,0x00,0xFC,
-0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xEB,0xA0,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0xFC,0xE0,0xFB,0xE0,0xFB,
-0x00,0xFC,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x40,0xE3,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xE0,0xFF,0xE0,0xFB,0xE0,0xFB,0x00,0xFC,0xE0,0xFB,
-0xE0,0xFB,0xE0,0xFB,0xA0,0xEB,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0xA0,0xE3,0x00,0xF8,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xE0,0xFB,0xC0,0xF3,0xA0,0xEB,0x80,0xE3,
-0x80,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x04,0x03,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x18,0x24,0x2F,0x38,0x41,0x4A,0x52,0x5B,0x62,0x66,0x67,0x66,0x63,0x5D,0x54,0x4B,0x43,0x3C,0x33,0x29,0x1D,0x12,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x1D,0x2F,0x44,0x5E,0x6A,0x83,0x9C,0xB3,0xC8,0xDA,0xEB,0xFD,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xE1,0xD0,0xBB,0xA5,0x8F,0x76,0x61,0x5C,0x3C,0x29,0x16,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x38,0x5B,0x6F,0x89,0xA5,0xC1,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0xB7,0x9B,0x80,0x69,0x4F,0x32,0x1A,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x2F,0x4F,0x6F,0x8F,0xAD,0xC9,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0xC3,0xA7,0x88,0x69,0x45,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x41,0x71,0xA0,0xC1,0xDD,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0xD4,0xB1,0x87,0x5A,0x2D,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x4C,0x83,0xB2,0xD2,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xE3,0xC5,0xA3,0x68,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x7B,0xB9,0xDB,
-0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0xC9,0x9A,0x4C,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x4C,0xA7,0xD5,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xE0,0xB6,0x6B,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x62,0xB8,0xE5,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEC,0xDA,0x91,0x25,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x1B,0x7C,0xD6,0xEE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xE3,0x95,0x2E,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x1B,0x78,0xD5,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xEA,0x94,0x2E,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x6F,0xCF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xF9,0xE9,0x88,0x1A,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x47,0xB7,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xC6,0x53,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x1B,0x7D,0xF1,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xEF,0x83,0x1B,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x41,0xAE,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xB3,0x45,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x66,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x65,0x10,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x85,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x81,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x30,0xA1,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x99,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x4F,0xC4,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xBB,0x42,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x5D,0xDA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x4E,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x67,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x54,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x66,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0x47,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x06,0x55,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCB,0x2C,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3A,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xB5,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xCB,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x82,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x8F,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0x5B,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x68,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xD8,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x9F,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xA2,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xEA,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xBC,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0xBE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x71,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6E,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCC,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x65,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xB1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9B,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8F,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xBB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x94,0x01,0x00,0x00,0x00,0x00,0x00,0x89,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x23,0x00,0x00,0x00,0x00,0x13,0xA9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD8,0x49,0x00,0x00,0x00,0x00,0x37,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFB,0x72,0x00,0x00,0x00,0x00,0x5D,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x09,0x00,0x00,0x00,0x7C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0x23,0x00,
-0x00,0x0E,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCC,0x3B,0x00,0x00,0x20,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0x4D,0x00,0x00,0x30,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x60,0x00,0x00,0x3D,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x00,0x00,0x55,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x77,0x00,0x00,0x67,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x85,0x07,0x00,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x0F,0x00,0x6E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x16,0x00,0x71,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA4,0x1C,0x00,0x77,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAB,0x20,0x00,0x79,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xAD,0x22,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA3,0x1B,0x00,0x68,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0x13,0x00,0x5E,0xF4,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x87,0x08,0x00,0x49,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x78,0x00,0x00,0x3A,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6A,0x00,0x00,0x29,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE8,0x53,0x00,0x00,0x16,0xA2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x41,0x00,0x00,0x01,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBC,0x2D,0x00,0x00,0x00,0x72,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA3,0x17,0x00,0x00,0x00,0x56,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8A,0x00,0x00,0x00,0x00,0x39,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xF6,0x6B,0x00,0x00,0x00,0x00,0x1B,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD9,0x4B,0x00,0x00,0x00,0x00,0x00,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0x2A,0x00,0x00,
-0x00,0x00,0x00,0x6D,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x09,0x00,0x00,0x00,0x00,0x00,0x43,0xD3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0xB1,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE8,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC8,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xBB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFC,0xA8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xB3,0x0E,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xE4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xB8,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x01,0x27,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x8E,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xB8,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x22,0xDD,0xFE,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x53,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x7F,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xA5,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xC2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0x33,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x53,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x74,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x8F,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xB7,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x43,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x75,0x0C,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x91,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x57,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x6B,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0x7E,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x94,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xD3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0x56,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x04,0x65,0xE4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0x76,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x85,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x94,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0xA2,0xF8,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xB3,
-0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xBF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x39,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD9,0x46,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x49,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x54,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x56,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x60,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x61,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0x6A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x6A,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0x73,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x71,0xE8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x79,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x76,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x7D,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x79,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xEF,0x83,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0x7C,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x81,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x7A,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x7E,0x0F,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x75,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE8,0x77,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x0C,0x6A,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x6C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x5D,0xDB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0x5F,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x4E,0xD5,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x50,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x3C,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x3F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x29,0xBB,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xBD,0x2B,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x9A,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xEF,0x9C,0x14,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x73,0xE4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x76,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x59,0xDA,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xDB,0x5D,0x07,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x3B,0xB5,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0xBA,0x40,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x8E,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE8,0x90,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x69,0xD2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0x6B,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x3B,0xA1,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xA5,0x3F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x76,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x79,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x4D,0xAD,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xB8,0x51,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x78,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xE4,0x7F,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x3F,0xA5,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xAC,0x46,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x6C,0xD0,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xD7,0x73,0x1F,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x09,0x29,0x8B,0xEE,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF6,0x93,0x2C,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x3A,0xA4,0xF8,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF8,0xAC,0x44,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x01,0x13,0x4A,0xB2,0xF6,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xF6,0xBA,0x54,0x16,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x12,0x4E,0xB4,0xEF,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0xF1,0xBC,0x59,0x16,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0C,0x42,0x9B,
-0xD8,0xEF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xF1,0xDE,0xA7,0x4D,0x11,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x25,0x69,0xAC,0xD3,0xE1,0xEF,0xEB,0xE2,0xD6,0xB6,0x74,0x2C,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x45,0x78,0x69,0x48,
-0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_pio_face_png_data, "ui_img_pio_face_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_pio_face_png = {
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .header.w = 140,
    .header.h = 140,
-   .data_size = sizeof(ui_img_pio_face_png_data),
+   .data_size = 58800,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .data = ui_img_pio_face_png_data};
 
@@ -115,7 +115,7 @@ void ui_event_pioScreen(lv_event_t *e)
         ui_pioScreen = NULL;
     }
 
-    if (event_code == LV_EVENT_GESTURE && lv_indev_get_gesture_dir(lv_indev_active()) == LV_DIR_RIGHT)
+    if (event_code == LV_EVENT_GESTURE && input_bus_gesture_dir() == LV_DIR_RIGHT)
     {
         ui_app_exit();
     }
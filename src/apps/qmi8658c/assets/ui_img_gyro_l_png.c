@@ -4,150 +4,19 @@
 // Project name: Test
 
 #include "../qmi8658c.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/gyro_l.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_gyro_l_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0xFF,0xAB,0x1F,0xAC,0x1F,0xAC,0x1F,0xAC,0x1F,0xAC,0x1F,0xAC,0x1F,0xAC,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0xFF,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0x1F,0xAC,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,
-0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0xFF,0xAB,0x1F,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xDF,0x9F,0xDF,0x9F,0xD7,0xFF,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xBF,0xB3,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x3F,0xB7,0xFE,0x9E,0xFF,0x9E,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0x7F,0xB4,0xBF,0xBC,0xDF,0xBC,0xDF,0xBC,0xBF,0xBC,0x7F,0xB4,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x3F,0xB7,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x84,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0xDF,0xBC,0xBF,0xCD,0x9F,0xE6,0x3F,0xEF,0xBF,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x3F,0xEF,0x9F,0xE6,0xBF,0xCD,0xDF,0xBC,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0xFF,0xAB,0x1F,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x3F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0x1F,0xAC,0xFF,0xAB,
-0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0x3F,0xDE,0x7F,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x7F,0xF7,0x3F,0xDE,0xDF,0xBC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xC4,0xBF,0xE6,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xE6,0x1F,0xC5,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,
-0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0xFF,0xAB,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x84,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0xFF,0xEE,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xEE,0xBF,0xBC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0x7F,0xD7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x3F,0xB4,
-0x3F,0xDE,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x3F,0xDE,0x3F,0xB4,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xB4,0x7F,0xD7,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xBC,0x3F,0xEF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0x3F,0xEF,0x9F,0xBC,0xFF,0xAB,0xBF,0xB4,0x5F,0xD7,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x84,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xC5,0xBF,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xF7,0x9F,0xC5,0x5F,0xD7,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xDE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x7F,0xCD,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xDE,0x9E,0x7F,0x93,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x7F,0xCD,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBD,0xFF,0x76,0xF7,0x31,0xF7,0x0F,0xF7,0x0E,0xF7,0x10,0xF7,0x32,0xF7,0x76,0xF7,0xBC,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDD,0xF7,0x98,0xE7,0x74,0xDF,0x72,0xD7,0x50,0xCF,0x71,0xCF,0x73,0xD7,0x97,0xE7,0xDD,0xF7,0xDF,0xFF,
-0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xDE,0x9E,0x7F,0x93,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xC5,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBD,0xFF,0x30,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xEB,0xF6,0x53,0xF7,0xBB,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDD,0xF7,0x95,0xDF,0x4E,0xC7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2C,0xBF,0x75,0xD7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0xBF,0xA4,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x9F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x84,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xBC,0xBF,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9B,0xFF,0xCA,0xF6,
-0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x0F,0xF7,0x99,0xF7,0xDF,0xFF,0xDF,0xFF,0xBA,0xEF,0x72,0xD7,0x2C,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x4F,0xC7,0x9E,0xD7,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x5F,0xD7,0x5F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xB4,0x1F,0xEF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBD,0xFF,0xCA,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x0E,0xF7,0x50,0xD7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x4F,0xC7,0x9E,0xD7,0x9F,0xDF,
-0x5F,0xBF,0xFE,0x9E,0x1E,0x9F,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0xBF,0xCE,0xBF,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x3F,0xDE,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x31,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x31,0xF7,0x99,0xFF,0xBD,0xFF,0xBD,0xFF,0xBB,0xFF,0x99,0xFF,0x54,0xF7,0x0D,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,
-0xC8,0xF6,0xEA,0xDE,0x2B,0xC7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x50,0xCF,0x95,0xDF,0xB9,0xEF,0xBC,0xF7,0xDE,0xF7,0xBD,0xF7,0x9B,0xE7,0x9E,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0xD7,0x66,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5F,0xBD,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x9F,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBD,0xFF,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,
-0xC8,0xF6,0x78,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBC,0xFF,0x53,0xF7,0xCA,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xEE,0x2C,0xCF,0x73,0xD7,0xBC,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0x92,0x36,0x6E,0x06,0x7D,0xC7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0x7F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1F,0xA4,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xEE,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x76,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x31,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x96,0xDF,0x2C,0xC7,0x0A,0xDF,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC9,0xF6,0x55,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,
-0x72,0x26,0x4E,0x06,0x4E,0x06,0x18,0x87,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xCE,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xC5,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x31,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x99,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBD,0xF7,0x71,0xCF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xC7,0xE9,0xE6,
-0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x0F,0xF7,0xBD,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x3C,0xA7,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xD5,0x5E,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xDF,0xA3,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xE6,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x0F,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,
-0xBD,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDD,0xF7,0x4F,0xCF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x4D,0xC7,0xB9,0xEF,0x98,0xFF,0xCA,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xEC,0xF6,0xBC,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x7E,0xC7,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xB3,0x46,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5F,0xC6,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,
-0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x0E,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBC,0xF7,0x4E,0xC7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x50,0xCF,0xDD,0xF7,0xDF,0xFF,0xDF,0xFF,0xBD,0xFF,0x0E,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x0F,0xEF,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x7E,0xCF,
-0x4E,0x06,0x4E,0x06,0x4E,0x06,0xB3,0x46,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x8A,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x3F,0xDE,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x10,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xBC,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBB,0xEF,0x4D,0xC7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x95,0xDF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x32,0xF7,0xC8,0xF6,0xC8,0xF6,0xED,0xEE,0x7D,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0x5C,0xB7,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xD4,0x4E,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3F,0xBD,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0x7F,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x32,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,
-0x99,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBC,0xF7,0x4D,0xC7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2C,0xBF,0x97,0xE7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x55,0xF7,0xED,0xEE,0x7D,0xDF,0x9F,0xDF,0x5E,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3A,0x9F,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xF6,0x66,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x1F,0xD7,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,
-0xDF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x76,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x54,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDD,0xF7,0x4E,0xC7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x4C,0xC7,0x98,0xE7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9E,0xDF,0x9F,0xDF,0x3E,0xBF,0xFE,0x9E,0xFD,0xA6,0x4D,0xDE,0x5C,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xF6,0x6E,
-0x4E,0x06,0x4E,0x06,0x4E,0x06,0x39,0x97,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x8A,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xCD,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBC,0xFF,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x0D,0xF7,0xDF,0xFF,0xDF,0xFF,0xBD,0xF7,0x4F,0xCF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x4C,0xC7,0xBA,0xEF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x3E,0xBF,0xFE,0x9E,0xFD,0xA6,0x2B,0xDE,0xE5,0xED,0x2A,0xEE,0x7D,0xDF,0x9F,0xDF,0x9F,0xDF,0x92,0x2E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x7D,0xC7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xBF,0xB4,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x8A,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x9F,0xE6,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xEB,0xF6,0xC8,0xF6,0xC8,0xF6,
-0xC8,0xF6,0xBC,0xFF,0xDF,0xFF,0x71,0xD7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2C,0xBF,0x99,0xE7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xF7,0x9F,0xD7,0x7F,0xC7,0x7F,0xCF,0x9F,0xD7,0xBF,0xEF,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0xA6,0x2B,0xDE,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x6D,0xE6,0x9F,0xDF,0x5C,0xB7,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x91,0x26,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xFF,0xC5,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,
-0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x3F,0xEF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x53,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x33,0xF7,0x96,0xDF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x97,0xE7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xD7,0x5F,0xAF,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0x5F,0xAF,0x7F,0xC7,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0xF6,0xDE,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xD3,0xE6,0xD5,0x5E,0x4E,0x06,
-0x4E,0x06,0x4E,0x06,0xF6,0x6E,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xBF,0xCE,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0xBF,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBB,0xFF,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC9,0xF6,0x2B,0xC7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x95,0xDF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xD7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,
-0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0x1F,0x9F,0xFE,0x96,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0xB2,0xE6,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE6,0xDD,0x6F,0x0E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x7D,0xBF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0x9F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0x7F,0xB4,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x0F,0xF7,0xC8,0xF6,
-0xC8,0xF6,0xC8,0xF6,0xEA,0xDE,0x2B,0xBF,0x2B,0xBF,0x51,0xCF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xF7,0x5F,0xAF,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0xFF,0x96,0xBE,0x7E,0xBE,0x86,0x5F,0xC7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x4C,0xE6,0xE5,0xED,0xE5,0xED,0x2A,0x76,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xB3,0x46,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x1F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,
-0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x99,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x2B,0xC7,0x4D,0xC7,0xDD,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xD7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0x3F,0x9F,0xDE,0x86,0xDE,0x86,0xBF,0x8E,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0x3F,0xB7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7D,0xDF,0x08,0xEE,0xE6,0xD5,0x4E,0x0E,0x4E,0x06,0x4E,0x06,
-0x4E,0x06,0x5B,0xA7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x0E,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xE9,0xE6,0xBA,0xEF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x7F,0xC7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0xDE,0x86,0xBE,0x7E,
-0xBF,0x65,0x1F,0x55,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0x1E,0xA7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x18,0xDF,0x2B,0x4E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xB2,0x3E,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xA3,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x50,0xD7,
-0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x98,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x7F,0xC7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0xDE,0x86,0xBF,0x65,0x9F,0x44,0x1F,0x55,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0x1E,0xA7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3A,0x9F,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x6D,0xC6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,
-0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBA,0xEF,0x2B,0xBF,0xEA,0xDE,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xCA,0xF6,0xBD,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xD7,0x5F,0xA7,0x5F,0xA7,0x5F,0xA7,0xBF,0x8E,0x1F,0x55,0x1F,0x55,0x5E,0x76,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0x3F,0xB7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7D,0xC7,0x70,0x16,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x2A,0x6E,
-0xE5,0xED,0x39,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x7F,0xB4,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x72,0xD7,0x2B,0xBF,0x2B,0xC7,0xC8,0xEE,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x0F,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xEF,0x5F,0xAF,0x5F,0xA7,0xFF,0x96,0xBE,0x7E,0xBE,0x7E,
-0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0xBE,0x86,0x7F,0xD7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xD7,0xB3,0x3E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4D,0x26,0xE5,0xE5,0xE5,0xED,0x6D,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xDF,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0xBF,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDD,0xF7,0x2C,0xBF,0x2B,0xBF,
-0x2B,0xBF,0x2B,0xCF,0xC9,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x53,0xF7,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x7F,0xC7,0x1F,0x9F,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0x3F,0xB7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xF6,0x6E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x6E,0x06,0x29,0xB6,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x5B,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0x9F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,
-0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x3F,0xEF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x95,0xDF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x74,0xD7,0x55,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0x77,0xF7,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xDE,0x96,0xBE,0x86,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0xBE,0x7E,0xBE,0x86,0x3F,0xB7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x18,0x87,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x17,0x77,0xB1,0xE6,0xE5,0xED,
-0xE5,0xED,0xE5,0xED,0xB2,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xBF,0xCE,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x9F,0xE6,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x4E,0xC7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0xBC,0xF7,0xDF,0xFF,0x0F,0xF7,0xC8,0xF6,0xC8,0xF6,0xC8,0xF6,0xED,0xEE,0x9E,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x5F,0xC7,0x3F,0xB7,0x1E,0xA7,
-0x1E,0xA7,0x3F,0xB7,0x7F,0xD7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3A,0x97,0x6E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xB3,0x46,0x9F,0xD7,0x5C,0xDF,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x29,0xEE,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xBF,0xBD,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xCD,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDD,0xF7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,
-0x50,0xCF,0xDF,0xFF,0xDF,0xFF,0xBD,0xFF,0xEC,0xF6,0xC8,0xF6,0xED,0xEE,0x7D,0xDF,0x9F,0xDF,0x5E,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5B,0xA7,0x6F,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x91,0x2E,0x7E,0xCF,0x9F,0xDF,0x9F,0xDF,0x4B,0xE6,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x7D,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xDF,0xB4,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,
-0xDF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x98,0xE7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0x95,0xDF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBC,0xFF,0x0F,0xEF,0x7D,0xDF,0x9F,0xDF,0x3D,0xBF,0xFE,0x9E,0xFE,0xA6,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3A,0x97,0x6F,0x0E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x90,0x16,0x7D,0xBF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xB2,0xE6,
-0xE5,0xED,0xE5,0xED,0xE5,0xED,0x16,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xA3,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x8A,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0x1F,0xAC,0x7F,0xF7,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x74,0xDF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0xB9,0xEF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x3E,0xBF,0xFE,0x9E,0xFD,0xA6,0x2B,0xDE,0xF6,0xDE,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,
-0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x18,0x87,0x6E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x70,0x16,0x5C,0xB7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x18,0xDF,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xB1,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xFF,0xCE,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xDE,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x72,0xD7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,
-0xBC,0xF7,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5E,0xBF,0xFE,0x9E,0xFD,0xA6,0x4B,0xDE,0xE5,0xED,0xE5,0xED,0xB1,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xD7,0xF6,0x6E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x70,0x16,0x5C,0xB7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5B,0xDF,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x8F,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3F,0xBD,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,
-0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xDF,0xBC,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x71,0xCF,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0xDE,0xF7,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x4D,0xDE,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x4C,0xE6,0x5C,0xDF,0x9F,0xDF,0x9F,0xDF,0x7D,0xC7,0xB2,0x36,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x70,0x1E,0x5C,0xB7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7E,0xDF,
-0xE5,0xED,0xE5,0xED,0xE5,0xED,0x6D,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x9F,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xDF,0xE6,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x71,0xD7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,0xBD,0xF7,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x5C,0xDF,0x29,0xEE,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x07,0xEE,0xF5,0xE6,
-0x3A,0x9F,0x70,0x16,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x91,0x26,0x7D,0xC7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5C,0xDF,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x6D,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3F,0xC6,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xC5,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x73,0xD7,0x2B,0xBF,0x2B,0xBF,0x2B,0xBF,
-0x9B,0xE7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0x7E,0xDF,0x6D,0xE6,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE6,0xD5,0x2B,0x4E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xB3,0x46,0x7E,0xCF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x38,0xDF,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x90,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xDF,0xA3,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xBF,0xB3,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xE6,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x97,0xE7,0x2B,0xBF,0x2B,0xBF,0x4F,0xC7,0x9E,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xD2,0xE6,0xE6,0xDD,0x2A,0x76,0x4E,0x0E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x6E,0x06,0xF7,0x6E,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x8F,0xE6,
-0xE5,0xED,0xE5,0xED,0xE5,0xED,0xF5,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xCE,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xBC,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDD,0xF7,0x2C,0xBF,0x4F,0xC7,0x9E,0xD7,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5C,0xB7,0xD5,0x5E,0x6F,0x0E,0x4E,0x06,0x4E,0x06,0x4E,0x06,
-0x4E,0x06,0x4E,0x06,0x4D,0x26,0x08,0xB6,0x90,0xE6,0x5B,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x17,0xDF,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x7D,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0x7F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x3F,0xDE,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x75,0xD7,0x9E,0xD7,0x9F,0xDF,
-0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0x3C,0xA7,0x7E,0xC7,0x7E,0xCF,0x5C,0xB7,0x3A,0x9F,0xF6,0x6E,0x92,0x2E,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x2A,0x6E,0xE6,0xE5,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x2A,0xEE,0xB2,0xE6,0x38,0xDF,0x7C,0xDF,0x7D,0xDF,0x7E,0xDF,0x39,0xDF,0x8F,0xE6,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x8F,0xE6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3F,0xB5,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x1F,0xB4,0x1F,0xEF,0xDF,0xFF,0xDF,0xFF,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFD,0x9E,0x72,0x26,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x91,0x3E,0x4D,0xBE,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,
-0xE5,0xED,0x08,0xEE,0x7D,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xBF,0xCE,0xBF,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x84,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x9F,0xBC,0x9F,0xF7,0xBF,0xF7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xFE,0x9E,0x91,0x36,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0xB3,0x3E,0x5B,0xA7,0x9F,0xDF,
-0x9F,0xDF,0x39,0xDF,0x4C,0xE6,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0x28,0xEE,0x5B,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3F,0xD7,0x3F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xAC,0x1F,0xAC,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0x7F,0xC5,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,
-0xD7,0x66,0x6E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x4E,0x06,0x91,0x1E,0xF6,0x66,0x7D,0xBF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5B,0xDF,0xB1,0xE6,0x08,0xEE,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE5,0xED,0xE6,0xED,0x90,0xE6,0x7E,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0xFF,0xA3,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7E,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xAB,0xFF,0xAB,0xFF,0xAB,0xBF,0xB4,0x5F,0xD7,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x7E,0xC7,0x19,0x87,0xD5,0x5E,0xB3,0x46,0xD4,0x46,0xD4,0x4E,0xF6,0x66,0x19,0x8F,0x7D,0xBF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x5C,0xDF,0xF5,0xE6,0xB1,0xE6,0x8F,0xE6,0x6C,0xE6,0x6E,0xE6,0xB0,0xE6,0xF5,0xDE,0x7D,0xDF,0x9F,0xDF,
-0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0x5F,0xAC,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xAB,0xBF,0xB4,0x5F,0xD7,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0x1E,0xA7,0x7F,0xCF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,
-0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0x1F,0xA4,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xDF,0x7F,0xD7,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xBE,0x9E,0x9F,0xA4,0x5F,0xD7,0x9F,0xDF,
-0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x3F,0xD7,0xDF,0xA3,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xBE,0x9E,0x7F,0x93,0x7F,0x92,0x5F,0x9B,0xBF,0xCE,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,
-0x7F,0xCE,0x1F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x5F,0xBF,0xFE,0x9E,0xDE,0x9E,0x7F,0x93,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x92,0x5F,0xBD,0x7F,0xD7,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,
-0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0x3F,0xB5,0x9F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x3F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,
-0x7F,0x92,0x7F,0x9B,0x5F,0xCE,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x1F,0xC6,0x3F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x3F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xDF,0xA3,0x5F,0xC6,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xD7,0x1F,0xC6,0xDF,0xA3,0x7F,0x92,0x7F,0x92,0x7F,0x92,
-0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x3F,0xBF,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x8A,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x9B,0x3F,0xB5,0xFF,0xCE,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,
-0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0xDF,0xCE,0x3F,0xBD,0x3F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7E,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x3E,0xB7,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x84,0x7F,0x92,
-0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x9F,0xA3,0xBF,0xB4,0xDF,0xBD,0xDF,0xCE,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x9F,0xDF,0x7F,0xD7,0xBF,0xCE,0xDF,0xBD,0xDF,0xB4,0x5F,0x9B,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x1F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x9F,0xD7,0x9F,0xDF,0x9F,0xDF,0x3F,0xB7,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x8A,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x9F,0x92,0xFF,0x92,0x5F,0x9B,0xBF,0xA3,0x7F,0x9B,0x5F,0x9B,0xFF,0x9A,0x9F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x9A,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xD7,0x9F,0xDF,0x3E,0xB7,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,
-0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xB7,0xFE,0x9E,0xFE,0x9E,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x8A,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xDF,0x96,0xFE,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xBF,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x53,0x83,0xA7,0xCC,0xE1,0xEE,0xFC,0xFC,0xEE,0xE2,0xCC,0xA8,0x83,0x53,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x8E,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x8D,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xF0,0xB4,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0x74,0xD9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD9,0x73,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xCD,0xB7,0x08,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x86,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x85,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xDB,0xFF,0xF1,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x65,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x63,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xE9,0xFF,0xF1,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x23,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xF2,0xFF,0xF1,0x38,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x5B,0x00,0x00,0x33,0xEE,0xFF,0xF9,0xFF,0xF1,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8E,0x35,0xEE,0xFF,0xFE,0xFF,0xF1,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xA6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xFF,0xFF,0xFF,0xF1,0x38,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xA7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xC9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x02,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x66,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE9,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x84,0x00,0x00,0x00,
-0x00,0x00,0x0E,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x0D,0x00,0x00,0x00,0x00,0x74,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x00,0x00,0x00,0x00,0xD9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD8,0x00,0x00,
-0x00,0x35,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x32,0x00,0x00,0x8E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8A,0x00,0x00,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x00,
-0x15,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x14,0x53,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x82,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,
-0xA7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA3,0xCC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC8,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,
-0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,
-0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xCC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,
-0xA7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA2,0x82,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0x53,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4F,
-0x15,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x12,0x00,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x00,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x88,0x00,
-0x00,0x33,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x00,0x00,0x00,0x00,0x72,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,
-0x00,0x00,0x0D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0x0C,0x00,0x00,0x00,0x00,0x00,0x85,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE8,0x0F,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC5,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x21,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA5,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xFC,0xFF,0xFA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA5,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xF9,0xFF,0xF0,0x3A,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8B,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x33,0xEE,0xFF,0xF3,0xFF,0xF0,0x38,0x00,0x00,0x58,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xEA,0xFF,0xF0,0x38,0x00,0x00,0x00,0x00,0x22,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC5,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xEE,0xFF,0xE3,0xFF,0xF0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x62,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x60,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x2C,0xF0,0xFF,0xD5,0xFF,0xF0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0x81,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xB1,0xC9,0xFF,0xF0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x71,0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x70,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xB4,0xF0,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x8A,0xD3,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xD2,0x88,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x07,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x4F,0x7F,0xA4,0xC8,0xDD,0xEE,0xF8,0xF8,0xEC,0xDD,0xC7,0xA2,0x7D,0x4F,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_gyro_l_png_data, "ui_img_gyro_l_png_data.bin"); // LVGL_9 compatible
 const lv_image_dsc_t ui_img_gyro_l_png = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 64,
     .header.h = 64,
-    .data_size = sizeof(ui_img_gyro_l_png_data),
+    .data_size = 12288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = ui_img_gyro_l_png_data
 };
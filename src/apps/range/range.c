@@ -95,7 +95,7 @@ void range_screen_event_cb(lv_event_t *e)
         range_screen_main = NULL;
     }
 
-    if (event_code == LV_EVENT_GESTURE && lv_indev_get_gesture_dir(lv_indev_active()) == LV_DIR_RIGHT)
+    if (event_code == LV_EVENT_GESTURE && input_bus_gesture_dir() == LV_DIR_RIGHT)
     {
         ui_app_exit(); /* exit to app list */
         /* Call this function to close the app, you can even use button instead of gesture */
@@ -1,148 +1,18 @@
 
 
 #include "../sample.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/sample.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_sample_png_data[] = {
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x14,0x3E,0x0C,0x7F,0x0C,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x7F,0x0C,0x3E,0x0C,0xBD,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x14,0x3E,0x0C,0x7F,0x0C,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x7F,0x0C,0x3E,0x0C,0xBD,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x13,0xFD,0x0B,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x1E,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x13,0xFD,0x0B,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x1E,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x7E,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0xBD,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x7E,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0xBD,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x3E,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x3E,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xFD,0x0B,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xFD,0x0B,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x13,0x7B,0x13,0x7B,0x13,0x9C,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x3E,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x13,0x7B,0x13,0x7B,0x13,0x9C,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x3E,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0xFD,0x0B,0x7E,0x0C,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x7E,0x0C,0xFD,0x0B,0x1D,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0xFD,0x0B,0x7E,0x0C,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x7E,0x0C,0xFD,0x0B,0x1D,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x9C,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x9C,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x5B,0x13,0x5B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x39,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x5B,0x13,0x5B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x39,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x14,0x3E,0x0C,0x7F,0x0C,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x7F,0x0C,0x3E,0x0C,0xBD,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xD7,0x1D,0xDF,0x3E,0xDF,0x3E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x3E,0xDF,0x3E,0xDF,0x1D,0xDF,0xBD,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x13,0xFD,0x0B,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x1E,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xFD,0xD6,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x3E,0xDF,0x3D,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x7E,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0xBD,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xDC,0xCE,0x3E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x3E,0xDF,0xBD,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x3E,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0xCE,0xDC,0xCE,0x3E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x1D,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x3E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x3E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x3E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0x3E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0xFD,0x0B,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0xFD,0xD6,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x3E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x7F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBC,0xCE,0xDC,0xCE,0xDC,0xCE,0x3E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x3E,0xDF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5B,0x13,0x7B,0x13,0x7B,0x13,0x9C,0x13,0x7F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x3E,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0x3E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x1D,0xD7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0xFD,0x0B,0x7E,0x0C,0x9F,0x0C,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0xBF,0x04,0x9F,0x0C,0x7E,0x0C,0xFD,0x0B,0x1D,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xBC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xFD,0xD6,0x3E,0xDF,0x3E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x5E,0xDF,0x3E,0xDF,0x3E,0xDF,0xFD,0xD6,0x5D,0xD7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x9C,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xBC,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x04,0x7B,0x13,0x5B,0x13,0x5B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x7B,0x13,0x39,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0xDC,0xCE,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-    //alpha channel data:
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xA2,0xF2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xA9,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xA2,0xF2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xA9,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xC9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x0C,0x00,0x00,0x00,0x00,0x06,0xC9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x00,0x00,0x00,0x00,0x67,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,0x00,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0x0C,0x00,0x00,0x00,0x00,0x06,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x6A,0xC5,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xC3,0x65,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x6A,0xC5,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xC3,0x65,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xA2,0xF2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xA9,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xA2,0xF2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xA9,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xC9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x0C,0x00,0x00,0x00,0x00,0x06,0xC9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x00,0x00,0x00,0x00,0x67,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,0x00,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0x0C,0x00,0x00,0x00,0x00,0x06,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x6A,0xC5,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xC3,0x65,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x6A,0xC5,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0xC3,0x65,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(ui_img_sample_png_data, "ui_img_sample_png_data.bin");
 const lv_image_dsc_t ui_img_sample_png = {
    .header.w = 64,
    .header.h = 64,
-   .data_size = sizeof(ui_img_sample_png_data),
+   .data_size = 12288,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .data = ui_img_sample_png_data};
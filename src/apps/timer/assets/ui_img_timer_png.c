@@ -4,148 +4,18 @@
 // Project name: lv_9_16bit
 
 #include "../timer.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets/timer.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_timer_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x27,0xFE,0xE6,0xFD,0xC6,0xFD,0xE4,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xF0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x27,0xFE,0xE6,0xFD,0xC6,0xFD,0xA5,0xFD,0x65,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0xBD,0xF9,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x27,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x65,0xFD,0x25,0xFD,0xE4,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0xAD,0x77,0xAD,0x77,0xAD,0x77,0xAD,0x77,0xAD,0x77,0xAD,0x77,0xAD,0x77,0xAD,0x77,0xAD,0x77,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xE0,0xFF,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x07,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x65,0xFD,0x24,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD5,0x9C,0xD5,0x9C,0xD5,0x9C,0xD5,0x9C,0xD5,0x9C,0xD5,0x9C,0xD5,0x9C,0xD5,0x9C,0xD5,0x9C,0xD5,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x07,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x65,0xFD,0x24,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x8C,0xD1,0x8B,0x70,0x83,0x70,0x83,0x70,0x83,0x70,0x83,0x70,0x83,0x70,0x83,0xD1,0x8B,0x12,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x00,0x00,
-    0xF0,0xFF,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x07,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x65,0xFD,0x24,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x83,0x90,0x83,0x90,0x83,0xAF,0x8B,0xAF,0x8B,0x90,0x83,0x90,0x83,0x70,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xEA,0xFF,
-    0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x07,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x65,0xFD,0x24,0xFD,0x24,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xFD,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xEA,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,
-    0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x07,0xFE,0xE6,0xFD,0xA6,0xFD,0x85,0xFD,0x65,0xFD,0x24,0xFD,0x05,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,
-    0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x06,0xFE,0xE6,0xFD,0xA6,0xFD,0x85,0xFD,0x65,0xFD,0x24,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,
-    0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x27,0xFE,0x06,0xFE,0xE6,0xFD,0xA6,0xFD,0x85,0xFD,0x26,0xF5,0x8C,0x9B,0x00,0x00,0xE8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x47,0xFE,0x27,0xFE,0x06,0xFE,0x06,0xFE,0x06,0xFE,0x07,0xFE,0x47,0xFE,0x67,0xFE,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x00,0x00,0x4E,0xA4,0x28,0xF6,0x47,0xFE,0x47,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,
-    0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x27,0xFE,0x06,0xFE,0xE6,0xFD,0xA6,0xFD,0x85,0xFD,0xAC,0x9B,0x0E,0x73,0xE9,0xDD,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x67,0xFE,0xC6,0xFD,0x65,0xFD,0x24,0xFD,0x45,0xFD,0x45,0xFD,0x45,0xFD,0x65,0xFD,0x65,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0xA6,0xFD,0xC6,0xFD,0x27,0xFE,0x88,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x0A,0xE6,0xD1,0x8B,0x6E,0xAC,0x27,0xFE,0x27,0xFE,0x27,0xFE,0x27,0xFE,0x27,0xFE,0x27,0xFE,0x27,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,
-    0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x27,0xFE,0x06,0xFE,0xE6,0xFD,0xA6,0xFD,0x2B,0xB4,0x4E,0x83,0xAA,0xD5,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x27,0xFE,0x65,0xFD,0x04,0xFD,0x24,0xFD,0x24,0xFD,0x45,0xFD,0x45,0xFD,0xA8,0xFD,0xEA,0xFD,0x0C,0xFE,0x0C,0xFE,0x0B,0xFE,0xC8,0xFD,0xA6,0xFD,0xA6,0xFD,0xC6,0xFD,0xC6,0xFD,0xC6,0xFD,0x06,0xFE,0x67,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xCA,0xDD,0xF0,0x8B,0x8D,0xB4,0x06,0xFE,0x06,0xFE,0x06,0xFE,0x06,0xFE,0x06,0xFE,0x06,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x07,0xFE,0x27,0xFE,0x27,0xFE,0x27,0xFE,
-    0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x27,0xFE,0x06,0xFE,0xC6,0xFD,0x8A,0xC4,0x8E,0x8B,0x09,0xE6,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x67,0xFE,0x65,0xFD,0x04,0xFD,0x04,0xFD,0x24,0xFD,0x88,0xFD,0x71,0xFE,0x18,0xFF,0x9E,0xFF,0xBF,0xFF,0x9F,0xF7,0x3D,0xDE,0x5D,0xDE,0xBF,0xFF,0xBF,0xFF,0x9E,0xFF,0x38,0xFF,0xB2,0xFE,0x2A,0xFE,0xE6,0xFD,0xE6,0xFD,0x06,0xFE,0x27,0xFE,0x88,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0x09,0xEE,0xCF,0x93,0xCB,0xC4,0xC6,0xFD,0xC6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,
-    0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x27,0xFE,0x06,0xFE,0xCB,0xC4,0xCF,0x8B,0x49,0xEE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC6,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0xEC,0xFD,0x19,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x9E,0xE6,0x19,0x9B,0xF9,0x9A,0xDE,0xE6,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x59,0xFF,0x6D,0xFE,0x07,0xFE,0x07,0xFE,0x27,0xFE,0x67,0xFE,0xA8,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x09,0xEE,0xAF,0x8B,0x8A,0xC4,0xA6,0xFD,0xA6,0xFD,0xA6,0xFD,0xA6,0xFD,0xA6,0xFD,0xA6,0xFD,0xC6,0xFD,0xC6,0xFD,0xC6,0xFD,0xC6,0xFD,0xC6,0xFD,0xC6,0xFD,
-    0x07,0xFF,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x88,0xFE,0x47,0xFE,0x27,0xFE,0xAC,0xBC,0xD0,0x8B,0x0A,0xE6,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x65,0xFD,0x04,0xFD,0x04,0xFD,0x89,0xFD,0x39,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x1E,0xEF,0x59,0x9B,0xB9,0x92,0x3E,0xEF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x59,0xFF,0x6B,0xFE,0x27,0xFE,0x47,0xFE,0x47,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0xE9,0xED,0x6F,0x83,0x0B,0xAC,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x86,0xFD,
-    0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x08,0xF6,0x6E,0xAC,0xB0,0x8B,0xCB,0xDD,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x88,0xFE,0x45,0xFD,0x04,0xFD,0x04,0xFD,0x30,0xFE,0xBE,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x7F,0xF7,0x7F,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xF3,0xFE,0x47,0xFE,0x47,0xFE,0x67,0xFE,0x88,0xFE,0x88,0xFE,0x67,0xFE,0x67,0xFE,0x69,0xD5,0x2F,0x7B,0xAC,0x9B,0x26,0xF5,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x88,0xFE,0x4E,0xA4,0xD1,0x8B,0x0D,0xBD,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x45,0xFD,0x04,0xFD,0x25,0xFD,0xD6,0xFE,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x7F,0xF7,0x3F,0xF7,0x1F,0xF7,0xFF,0xF6,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x5F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0x9F,0xF7,0x37,0xFF,0x68,0xFE,0x67,0xFE,0x67,0xFE,0x68,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x6B,0xB4,0xEE,0x72,0x8C,0x93,0x24,0xFD,0x24,0xFD,0x24,0xFD,0x24,0xFD,0x24,0xFD,0x24,0xFD,0x24,0xFD,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x07,0xFF,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x00,0x00,0x00,0x00,0xED,0xB4,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x65,0xFD,0x04,0xFD,0x25,0xFD,0xF7,0xFE,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xD8,0xEE,0x95,0xEE,0xDD,0xEE,0xFF,0xF6,0xFF,0xF6,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x7F,0xF7,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x38,0xFF,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x67,0xFE,0x67,0xFE,0x47,0xFE,0x27,0xFE,0x0B,0xA4,0x00,0x00,0x00,0x00,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x43,0xFD,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC6,0xFD,0x04,0xFD,0x04,0xFD,0xD6,0xFE,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5F,0xF7,0xFF,0xF6,0x8C,0xF6,0xC8,0xFE,0xA9,0xFE,0x8F,0xF6,0xDC,0xEE,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x36,0xFF,0x88,0xFE,0x88,0xFE,0x87,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,0x27,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x67,0xFE,0x24,0xFD,0x04,0xFD,0x50,0xFE,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x3F,0xF7,0xFF,0xEE,0xBA,0xEE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x89,0xFE,0x1A,0xD6,0xFF,0xEE,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0xF2,0xFE,0x88,0xFE,0xA8,0xFE,0x67,0xFE,0x27,0xFE,0x27,0xFE,0x27,0xFE,0x07,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x65,0xFD,0x04,0xFD,0x89,0xFD,0xBE,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x1F,0xF7,0xFF,0xEE,0xFF,0xEE,0x72,0xEE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x89,0xFE,0x1B,0xD6,0x5D,0xDE,0xB9,0xC6,0x99,0xBE,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7E,0xF7,0xCB,0xFE,0xA8,0xFE,0x88,0xFE,0x27,0xFE,0x27,0xFE,0x07,0xFE,0x07,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x47,0xFE,0x04,0xFD,0x24,0xFD,0x18,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x3F,0xF7,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xBB,0xEE,0x32,0xE6,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x32,0xEE,0x5D,0xD6,0x73,0x96,0x13,0x86,0xDE,0xE6,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x39,0xF7,0xA8,0xFE,0xA8,0xFE,0x47,0xFE,0x07,0xFE,0x06,0xFE,0x06,0xFE,0x07,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x65,0xFD,0x24,0xFD,0xEC,0xFD,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5F,0xF7,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xFF,0xF6,0xFF,0xF6,0xDE,0xEE,0xAB,0xF6,0xA8,0xFE,0x68,0xFE,0x29,0xFE,0x5C,0xDE,0xB1,0x86,0x30,0x76,0x3C,0xD6,0x1E,0xEF,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0xEE,0xFE,0xC8,0xFE,0xA8,0xFE,0x06,0xFE,0x06,0xFE,0xE6,0xFD,0xE6,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x87,0xFE,0x24,0xFD,0x24,0xFD,0x18,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xF6,0xFF,0xF6,0x1F,0xF7,0x1F,0xF7,0xB5,0xEE,0xA8,0xFE,0x47,0xFE,0x07,0xFE,0x33,0xE6,0xEF,0x7E,0x4F,0x66,0xFB,0xCD,0x9D,0xDE,0x3E,0xEF,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x39,0xF7,0xC8,0xFE,0xC8,0xFE,0x27,0xFE,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xE6,0xFD,0x24,0xFD,0x88,0xFD,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5F,0xF7,0xFF,0xEE,0xFF,0xF6,0xFF,0xF6,0xFF,0xF6,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1E,0xF7,0x8A,0xFE,0x67,0xFE,0xC7,0xFD,0xC9,0xFD,0xEF,0x7E,0x2E,0x5E,0x1A,0xBE,0x7D,0xDE,0xFE,0xEE,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0x9F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0xCB,0xFE,0xC8,0xFE,0x67,0xFE,0xE6,0xFD,0xE6,0xFD,0xC6,0xFD,0xE6,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x85,0xFD,0x45,0xFD,0x70,0xFE,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0xFF,0xF6,0xFF,0xF6,0xFF,0xF6,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0xB3,0xF6,0x67,0xFE,0xC7,0xFD,0x66,0xFD,0x4B,0xAE,0xCD,0x55,0x19,0xB6,0x9D,0xDE,0xDE,0xE6,0x3E,0xEF,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0xF2,0xFE,0xC8,0xFE,0xA8,0xFE,0xE6,0xFD,0xC6,0xFD,0xC6,0xFD,0xC6,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x45,0xFD,0x45,0xFD,0x17,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x7F,0xF7,0xFF,0xF6,0xFF,0xF6,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3E,0xF7,0x69,0xFE,0x27,0xFE,0x26,0xFD,0x47,0xED,0x8B,0x55,0xF7,0xA5,0x9D,0xE6,0xFE,0xE6,0x3E,0xEF,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x7F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x18,0xF7,0xC8,0xFE,0xC8,0xFE,0xE6,0xFD,0xC6,0xFD,0xC6,0xFD,0xA6,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x67,0xFE,0x45,0xFD,0x65,0xFD,0x9D,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x3F,0xF7,0xFF,0xF6,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x92,0xF6,0x27,0xFE,0x46,0xFD,0xC5,0xFC,0x29,0x85,0xD5,0x8D,0xDE,0xE6,0xFE,0xEE,0x3F,0xEF,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x9F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x1D,0xF7,0xC8,0xFE,0xC8,0xFE,0x06,0xFE,0xC6,0xFD,0xA6,0xFD,0xA6,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x27,0xFE,0x65,0xFD,0x87,0xFD,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3D,0xF7,0x27,0xFE,0xA6,0xFD,0x6A,0xFC,0x8A,0xE4,0xB4,0x8D,0xDE,0xE6,0x1E,0xEF,0x5F,0xF7,0x7F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0xC9,0xFE,0xC8,0xFE,0x27,0xFE,0xA6,0xFD,0xA6,0xFD,0xA5,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x27,0xFE,0x65,0xFD,0xE9,0xFD,0x9F,0xF7,0x7E,0xE6,0xDE,0xEE,0xBF,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x70,0xF6,0x70,0xFC,0x13,0xFC,0x13,0xFC,0x53,0xF4,0xDE,0xE6,0x3E,0xEF,0x5F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x3F,0xF7,0x7E,0xE6,0x5E,0xE6,0x3F,0xF7,0xCC,0xFE,0xC8,0xFE,0x27,0xFE,0xA6,0xFD,0xA5,0xFD,0x85,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x27,0xFE,0x85,0xFD,0x0B,0xFE,0x5E,0xE6,0x19,0x9B,0x19,0x9B,0x5E,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0xD8,0xED,0x13,0xFC,0x13,0xFC,0xF3,0xFB,0x92,0xFB,0x9A,0xE5,0x3E,0xEF,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBE,0xEE,0x39,0x9B,0xF9,0x9A,0x7E,0xE6,0xCD,0xFE,0xC8,0xFE,0x27,0xFE,0xA5,0xFD,0x85,0xFD,0x85,0xFD,0xE8,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xFD,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x27,0xFE,0x85,0xFD,0x0B,0xFE,0xBE,0xE6,0xF9,0x9A,0xB9,0x92,0x5F,0xF7,0x1F,0xF7,0x1F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x3B,0xEE,0x13,0xFC,0xF3,0xFB,0x92,0xFB,0xD1,0xFA,0x7A,0xE5,0x1E,0xEF,0x7F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xFF,0xEE,0x59,0x9B,0x98,0x92,0x9E,0xE6,0xCD,0xFE,0xC8,0xFE,0x27,0xFE,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x4A,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x27,0xFE,0xA5,0xFD,0x09,0xFE,0xBF,0xFF,0x3E,0xEF,0x5E,0xF7,0xBF,0xFF,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0xB6,0xF4,0x72,0xFB,0xB1,0xFA,0x53,0xEB,0xDE,0xE6,0x3E,0xEF,0x7F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x1F,0xF7,0x1E,0xEF,0xDE,0xEE,0x1F,0xF7,0xCC,0xFE,0xC8,0xFE,0x07,0xFE,0x85,0xFD,0x65,0xFD,0x65,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x67,0xFE,0xA6,0xFD,0xC7,0xFD,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x7F,0xF7,0xFB,0xE5,0xBA,0xE5,0xDE,0xE6,0x1E,0xEF,0x5F,0xF7,0x9F,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x9F,0xF7,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0xFF,0xF6,0xC9,0xFE,0xC8,0xFE,0x06,0xFE,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x88,0xFE,0xA6,0xFD,0xC6,0xFD,0x7C,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x3E,0xEF,0x3E,0xEF,0x5E,0xF7,0x7F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x7F,0xF7,0x1F,0xF7,0x1F,0xF7,0xFF,0xF6,0xFC,0xF6,0xC8,0xFE,0xC8,0xFE,0xA6,0xFD,0x65,0xFD,0x65,0xFD,0x45,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC6,0xFD,0xC6,0xFD,0x17,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x9F,0xF7,0x3F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x3F,0xF7,0x1F,0xF7,0xFF,0xF6,0xFF,0xF6,0xF7,0xF6,0xC8,0xFE,0xC8,0xFE,0x65,0xFD,0x65,0xFD,0x45,0xFD,0x45,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x06,0xFE,0xE6,0xFD,0xB0,0xFE,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x1F,0xF7,0xFF,0xF6,0xFF,0xF6,0xFF,0xF6,0xD1,0xFE,0xC8,0xFE,0x67,0xFE,0x65,0xFD,0x45,0xFD,0x45,0xFD,0x45,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x47,0xFE,0xE6,0xFD,0x08,0xFE,0xBE,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5F,0xF7,0xFF,0xF6,0xFF,0xF6,0xFF,0xF6,0xFE,0xEE,0xCA,0xFE,0xC8,0xFE,0x06,0xFE,0x45,0xFD,0x45,0xFD,0x25,0xFD,0x24,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0xE6,0xFD,0x06,0xFE,0x37,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x1F,0xF7,0xFF,0xF6,0xFF,0xF6,0xFF,0xEE,0xD7,0xF6,0xC8,0xFE,0xC8,0xFE,0x85,0xFD,0x45,0xFD,0x25,0xFD,0x24,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x27,0xFE,0x07,0xFE,0x6B,0xFE,0xBF,0xFF,0xBF,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x3F,0xF7,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xCD,0xFE,0xC8,0xFE,0x67,0xFE,0x45,0xFD,0x24,0xFD,0x24,0xFD,0x24,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x88,0xFE,0x27,0xFE,0x27,0xFE,0x37,0xFF,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5F,0xF7,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xD7,0xF6,0xC8,0xFE,0xC8,0xFE,0xA5,0xFD,0x24,0xFD,0x24,0xFD,0x24,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0xA8,0xFE,0x47,0xFE,0x27,0xFE,0x6A,0xFE,0x9E,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x9F,0xF7,0x9F,0xF7,0x9F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x7F,0xF7,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xFE,0xF6,0xCB,0xFE,0xC8,0xFE,0x47,0xFE,0x24,0xFD,0x24,0xFD,0x24,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0x88,0xFE,0x47,0xFE,0x47,0xFE,0xCF,0xFE,0x9F,0xF7,0x9F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0xBF,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x5F,0xF7,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xD0,0xFE,0xC8,0xFE,0xC8,0xFE,0x65,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xFE,0xA8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x14,0xFF,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0x9F,0xF7,0x3F,0xF7,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xD4,0xF6,0xC8,0xFE,0xC8,0xFE,0xE6,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xFE,0xA8,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x67,0xFE,0x67,0xFE,0x88,0xFE,0x16,0xFF,0x7F,0xF7,0x7F,0xF7,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x7F,0xF7,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xFF,0xBF,0xF7,0x5F,0xF7,0xFF,0xF6,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xD6,0xF6,0xC8,0xFE,0xC8,0xFE,0x47,0xFE,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x87,0xFE,0x88,0xFE,0x88,0xFE,0x88,0xFE,0x14,0xFF,0x7F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x5F,0xF7,0x7F,0xF7,0x9F,0xF7,0xBF,0xFF,0xBF,0xF7,0xBF,0xF7,0xBF,0xFF,0x9F,0xF7,0x7F,0xF7,0x3F,0xF7,0xFF,0xF6,0xFF,0xF6,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xD4,0xF6,0xC8,0xFE,0xC8,0xFE,0x67,0xFE,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFE,0x88,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x88,0xFE,0x88,0xFE,0xA8,0xFE,0xF0,0xFE,0x5E,0xF7,0x5F,0xF7,0x5F,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x9E,0xEE,0xDE,0xEE,0x1F,0xF7,0x1F,0xF7,0x1F,0xF7,0xFF,0xF6,0xFF,0xF6,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xFD,0xF6,0xD0,0xFE,0xC8,0xFE,0xC8,0xFE,0x67,0xFE,0x25,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xC8,0xFE,0x88,0xFE,0x67,0xFE,0x67,0xFE,0x67,0xFE,0x47,0xFE,0x88,0xFE,0xA8,0xFE,0xA8,0xFE,0xCA,0xFE,0x17,0xF7,0x5F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x3F,0xF7,0x9E,0xE6,0x39,0x9B,0x39,0x9B,0xDE,0xEE,0x1F,0xF7,0xFF,0xF6,0xFF,0xF6,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFF,0xEE,0xD7,0xF6,0xCA,0xFE,0xC8,0xFE,0xC8,0xFE,0x47,0xFE,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x85,0xFD,0xC8,0xFE,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x67,0xFE,0x67,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,0x67,0xFE,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xEC,0xFE,0x17,0xF7,0x3E,0xF7,0x3F,0xF7,0x3F,0xF7,0x1F,0xF7,0x1F,0xF7,0x9E,0xE6,0x19,0x9B,0x98,0x92,0xBE,0xE6,0xFF,0xF6,0xFF,0xF6,0xFF,0xEE,0xFF,0xEE,0xFE,0xF6,0xD7,0xF6,0xCC,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0xE6,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x65,0xFD,0x88,0xFE,0xC8,0xFE,0xC8,0xFE,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x47,0xFE,0x47,0xFE,0x47,0xFE,0x27,0xFE,0x27,0xFE,0x27,0xFE,0x88,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xCA,0xFE,0xF0,0xFE,0x16,0xF7,0x1B,0xF7,0x1E,0xF7,0x1F,0xF7,0xBE,0xE6,0x9E,0xE6,0x1F,0xF7,0xFE,0xF6,0xFB,0xF6,0xF6,0xF6,0xD0,0xFE,0xC9,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x47,0xFE,0x65,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x65,0xFD,0x47,0xFE,0x88,0xFE,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x27,0xFE,0xE6,0xFD,0x06,0xFE,0x27,0xFE,0x27,0xFE,0x27,0xFE,0x07,0xFE,0x06,0xFE,0x27,0xFE,0x88,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC9,0xFE,0xCA,0xFE,0xCB,0xFE,0xCB,0xFE,0xCA,0xFE,0xC9,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0x47,0xFE,0x85,0xFD,0x24,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x65,0xFD,0xE6,0xFD,0x27,0xFE,0x67,0xFE,0x88,0xFE,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFE,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x27,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0xA5,0xFD,0x07,0xFE,0x07,0xFE,0x06,0xFE,0x06,0xFE,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0x47,0xFE,0x88,0xFE,0xA8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xC8,0xFE,0xA8,0xFE,0x67,0xFE,0xE6,0xFD,0x65,0xFD,0x24,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x45,0xFD,0x85,0xFD,0xC6,0xFD,0xE6,0xFD,0x27,0xFE,0x67,0xFE,0x88,0xFE,0xA8,0xFE,0xC8,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xFE,0x88,0xFE,0x67,0xFE,0x27,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x45,0xFD,0x04,0xFD,0xE6,0xFD,0x07,0xFE,0x06,0xFE,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xC6,0xFD,0xC6,0xFD,0xC6,0xFD,0xA6,0xFD,0xC6,0xFD,0x06,0xFE,0x06,0xFE,0x07,0xFE,0x06,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x65,0xFD,0x45,0xFD,0x45,0xFD,0x24,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x05,0xFD,0x04,0xFD,0x45,0xFD,0x85,0xFD,0xC6,0xFD,0xE6,0xFD,0x27,0xFE,0x67,0xFE,0x88,0xFE,0xA8,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xFE,0x67,0xFE,0x27,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x45,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xFD,0xE6,0xFD,0xE6,0xFD,0xC6,0xFD,0xC6,0xFD,0xC6,0xFD,0xA6,0xFD,0xA6,0xFD,0xA5,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x45,0xFD,0x45,0xFD,0x45,0xFD,0x24,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x24,0xFD,0x24,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFD,0x45,0xFD,0x85,0xFD,0xC6,0xFD,0xE6,0xFD,0x27,0xFE,0x67,0xFE,0x88,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x27,0xFE,0xE6,0xFD,0xC6,0xFD,0x85,0xFD,0x45,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xFD,0xC6,0xFD,0xC6,0xFD,0xA6,0xFD,0xA6,0xFD,0xA5,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x45,0xFD,0x45,0xFD,0x45,0xFD,0x24,0xFD,0x24,0xFD,0x04,0xFD,0x04,0xFD,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFD,0x45,0xFD,0x85,0xFD,0xC6,0xFD,0xE6,0xFD,0x27,0xFE,0xE0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xFD,0x85,0xFD,0x45,0xFD,0xE4,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xFD,0xA6,0xFD,0x85,0xFD,0x85,0xFD,0x85,0xFD,0x65,0xFD,0x65,0xFD,0x65,0xFD,0x45,0xFD,0x45,0xFD,0x25,0xFD,0x24,0xFD,0x04,0xFD,0xE4,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xFC,0x65,0xFD,0x85,0xFD,0xC6,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    
-    //alpha channel data:
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x02,0x4C,0x9A,0xD4,0xEB,0xF1,0xD7,0xA7,0x5A,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x5A,0xA7,0xD7,0xF1,0xEB,0xD3,0x9A,0x4B,0x02,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x46,0xD2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE2,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xCE,0xDD,0xDD,0xDD,0xDD,0xDD,0xDD,0xCD,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x44,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x6F,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA4,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x80,0x01,0x00,0x00,
-    0x00,0x00,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7A,0x00,0x00,
-    0x00,0x47,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1A,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8F,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x46,0x00,
-    0x02,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0x03,
-    0x4F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x38,0x79,0xAC,0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD8,0xAB,0x78,0x37,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4F,
-    0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x26,0x00,0x00,0x00,0x00,0x37,0x96,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0x94,0x37,0x00,0x00,0x00,0x00,0x27,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9C,
-    0xD8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0x00,0x00,0x00,0x4A,0xC4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC3,0x48,0x00,0x00,0x00,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,
-    0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x4F,0x00,0x24,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0x2A,0x00,0x4B,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,
-    0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x98,0xF9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x92,0xF3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,
-    0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,
-    0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,
-    0x60,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,
-    0x09,0xE4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0x0A,
-    0x00,0x67,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x65,0x00,
-    0x00,0x00,0xA5,0xFF,0xFF,0xFF,0xFF,0xFC,0x9C,0x52,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x59,0x9D,0xFC,0xFF,0xFF,0xFF,0xFF,0xA4,0x00,0x00,
-    0x00,0x00,0x09,0x91,0xDA,0xCD,0x8C,0x28,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x63,0x00,0x00,0x28,0x8D,0xCD,0xDA,0x90,0x09,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x91,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x98,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0xF1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xF8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x44,0x14,0x9C,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x9A,0x13,0x44,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0x44,0x00,0x00,0x00,0x2B,0xA2,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xAA,0x2A,0x00,0x00,0x00,0x44,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xA5,0xFF,0xFF,0xFF,0xE9,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x76,0xD1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x75,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xEA,0xFF,0xFF,0xFF,0xA5,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x7E,0x67,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x5A,0x8C,0xB4,0xD7,0xE6,0xF3,0xF3,0xE6,0xD7,0xB4,0x8C,0x59,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x68,0x7E,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(ui_img_timer_png_data, "ui_img_timer_png_data.bin");
 const lv_image_dsc_t ui_img_timer_png = {
    .header.w = 64,
    .header.h = 64,
-   .data_size = sizeof(ui_img_timer_png_data),
+   .data_size = 12288,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .data = ui_img_timer_png_data};
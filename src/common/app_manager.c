@@ -8,117 +8,44 @@
  *********************/
 
 #include "app_manager.h"
+#include "app_hal.h"
 
-#include <stdlib.h>
-#include <string.h>
+/* app_table, generated by support/header_gen.py */
+#include "generated_apps.h"
 
 /*********************
  *      DEFINES
  *********************/
 
-/**********************
- *      TYPEDEFS
- **********************/
-
-typedef struct app_node
-{
-    const app_info_t *info;
-    struct app_node *next;
-} app_node_t;
-
-/**********************
- *  STATIC PROTOTYPES
- **********************/
-
-static int compare(const void *a, const void *b);
-
-/**********************
- *  STATIC VARIABLES
- **********************/
-
-static app_node_t *head = NULL;
-static int app_count = 0;
+#define APP_TABLE_COUNT ((int)(sizeof(app_table) / sizeof(app_table[0])) - 1)
 
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
-void app_registry_register(const app_info_t *info)
-{
-    app_node_t *node = malloc(sizeof(app_node_t));
-    if (node == NULL)
-        return; /* Handle malloc failure */
-    node->info = info;
-    node->next = head;
-    head = node;
-}
-
-void app_registry_iterate_unsorted(app_register_cb cb)
+void app_registry_iterate(app_register_cb cb)
 {
-    app_node_t *current = head;
-    app_count = 0;
-    while (current != NULL)
+    /* the table is in launcher order already, priority then name */
+    for (int i = 0; i < APP_TABLE_COUNT; i++)
     {
-        const app_info_t *info = current->info;
+        const app_info_t *info = app_table[i];
         cb(info->name, info->icon, info->callback);
-        current = current->next;
-        app_count++;
     }
 }
 
-void app_registry_iterate(app_register_cb cb)
+void app_registry_iterate_unsorted(app_register_cb cb)
 {
-    /* Count the apps */
-    int count = 0;
-    app_node_t *current = head;
-    while (current != NULL)
-    {
-        count++;
-        current = current->next;
-    }
-
-    /* Copy pointers to array */
-    if (count == 0)
-        return;
-
-    const app_info_t **array = malloc(count * sizeof(app_info_t *));
-    if (!array)
-        return;
-
-    current = head;
-    for (int i = 0; i < count; i++)
-    {
-        array[i] = current->info;
-        current = current->next;
-    }
-
-    /* Sort the array by name */
-    qsort(array, count, sizeof(app_info_t *), compare);
-
-    app_count = 0;
-    /* Call callback in sorted order */
-    for (int i = 0; i < count; i++)
-    {
-        cb(array[i]->name, array[i]->icon, array[i]->callback);
-        app_count++;
-    }
-
-    /* Cleanup */
-    free(array);
+    app_registry_iterate(cb);
 }
 
 int app_registry_get_count()
 {
-    return app_count;
+    return APP_TABLE_COUNT;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
-static int compare(const void *a, const void *b)
+const app_info_t *app_registry_get(int index)
 {
-    const app_info_t *appA = *(const app_info_t **)a;
-    const app_info_t *appB = *(const app_info_t **)b;
-    return strcmp(appA->name, appB->name);
+    if (index < 0 || index >= APP_TABLE_COUNT)
+        return NULL;
+    return app_table[index];
 }
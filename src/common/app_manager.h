@@ -15,6 +15,7 @@ extern "C"
  *      INCLUDES
  *********************/
 #include "lvgl.h"
+#include "input_bus/input_bus.h"
 
 /*********************
  *      DEFINES
@@ -23,11 +24,19 @@ extern "C"
 /**********************
  *      TYPEDEFS
  **********************/
+/* app_info_t.flags */
+#define APP_FLAG_PRELOAD 0x01 /* build the screen with the app list, not on first launch */
+
 typedef struct
 {
     const char *name;
     const lv_image_dsc_t *icon;
     void (*callback)(lv_event_t *e);
+    lv_obj_t **screen;
+    void (*screen_init)(void);
+    int8_t priority;     /* higher first in the app list, same priority by name */
+    uint8_t flags;       /* APP_FLAG_x */
+    uint32_t mem_budget; /* LVGL heap the screen needs in bytes, 0 if unknown */
 } app_info_t;
 
 typedef void (*app_register_cb)(const char *name, const lv_image_dsc_t *icon, void (*callback)(lv_event_t *e));
@@ -36,10 +45,10 @@ typedef void (*app_register_cb)(const char *name, const lv_image_dsc_t *icon, vo
  * GLOBAL PROTOTYPES
  **********************/
 
-void app_registry_register(const app_info_t *info);
 void app_registry_iterate(app_register_cb cb);
 void app_registry_iterate_unsorted(app_register_cb cb);
 int app_registry_get_count();
+const app_info_t *app_registry_get(int index);
 
 /**********************
  *      MACROS
@@ -53,22 +62,34 @@ int app_registry_get_count();
  * @param _screen_init_fn The function to initialize the screen
  * @note This macro should be used in the source file where the app is implemented.
  *       It will automatically create a static variable for the screen and a callback function
- *       to launch the app. The callback function will be registered with the app manager.
+ *       to launch the app. support/header_gen.py finds the macro at build time and lists the
+ *       app in src/common/generated_apps.h, already in launcher order.
  */
-#define REGISTER_APP(_title, _icon, _screen_var, _screen_init_fn)      \
+#define REGISTER_APP(_title, _icon, _screen_var, _screen_init_fn) \
+    REGISTER_APP_EX(_title, _icon, _screen_var, _screen_init_fn, 0, 0, 0)
+
+/**
+ * @brief Register an app with launcher metadata
+ * @param _priority Position in the app list, higher first. Must be a number literal,
+ *        the list is sorted when it is generated
+ * @param _flags APP_FLAG_x
+ * @param _mem_budget LVGL heap the screen needs in bytes, 0 if unknown
+ */
+#define REGISTER_APP_EX(_title, _icon, _screen_var, _screen_init_fn, _priority, _flags, _mem_budget) \
 static lv_obj_t *_screen_var;                                          \
 static void _screen_var##_launch_cb(lv_event_t *e)                     \
 {                                                                      \
     ui_app_load(&_screen_var, _screen_init_fn);                        \
 }                                                                      \
-static app_info_t _app_info_##_screen_var = {                          \
+const app_info_t app_info_##_screen_var = {                            \
     .name = _title,                                                    \
     .icon = _icon,                                                     \
-    .callback = _screen_var##_launch_cb};                              \
-static void __attribute__((constructor)) _register_##_screen_var(void) \
-{                                                                      \
-    app_registry_register(&_app_info_##_screen_var);                   \
-}
+    .callback = _screen_var##_launch_cb,                               \
+    .screen = &_screen_var,                                            \
+    .screen_init = _screen_init_fn,                                    \
+    .priority = _priority,                                             \
+    .flags = _flags,                                                   \
+    .mem_budget = _mem_budget};
 
 
 
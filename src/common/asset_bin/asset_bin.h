@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Image payloads stored as raw .bin files next to their descriptor instead of
+ * C arrays of hex literals. ASSET_BIN(sym, "file.bin") defines
+ * `const uint8_t sym[]` holding the bytes of the file, pulled in by the
+ * assembler with .incbin so the compiler never parses the pixels.
+ *
+ * The file is found through the assembler include path. support/asset_bin.py
+ * adds the folder of each descriptor to it and makes the descriptor depend on
+ * its .bin files, so a changed payload only rebuilds that one object. The
+ * descriptor keeps the size as a number, the symbol has no sizeof.
+ *
+ * Payloads that several faces carry (digits, weather icons) are kept once in
+ * src/faces/asset_pool by support/asset_pool.py. ASSET_POOL(sym, pooled)
+ * makes sym another name for the pooled bytes, so the descriptor is the same
+ * as for a payload of its own.
+ */
+
+#define ASSET_BIN_STR_(x) #x
+#define ASSET_BIN_STR(x) ASSET_BIN_STR_(x)
+// assembler name of a C symbol, "_" in front on mach-o
+#define ASSET_BIN_NAME(sym) ASSET_BIN_STR(__USER_LABEL_PREFIX__) #sym
+
+#if defined(__APPLE__)
+#define ASSET_BIN_SECTION(sym) ".const_data\n"
+#define ASSET_BIN_TYPE(sym)
+#define ASSET_BIN_SIZE(sym)
+#define ASSET_BIN_END ".text\n"
+#elif defined(_WIN32)
+#define ASSET_BIN_SECTION(sym) ".pushsection .rdata,\"dr\"\n"
+#define ASSET_BIN_TYPE(sym)
+#define ASSET_BIN_SIZE(sym)
+#define ASSET_BIN_END ".popsection\n"
+#else
+// a section per payload, so --gc-sections drops unused ones like -fdata-sections did
+#define ASSET_BIN_SECTION(sym) ".pushsection .rodata." #sym ",\"a\",%progbits\n"
+#define ASSET_BIN_TYPE(sym) ".type " ASSET_BIN_NAME(sym) ", %object\n"
+#define ASSET_BIN_SIZE(sym) ".size " ASSET_BIN_NAME(sym) ", . - " ASSET_BIN_NAME(sym) "\n"
+#define ASSET_BIN_END ".popsection\n"
+#endif
+
+#ifdef __cplusplus
+#define ASSET_BIN_EXTERN extern "C"
+#else
+#define ASSET_BIN_EXTERN extern
+#endif
+
+// LV_DRAW_BUF_ALIGN, same as the arrays had
+#define ASSET_BIN(sym, file)                      \
+    __asm__(ASSET_BIN_SECTION(sym)                \
+            ".balign 4\n"                         \
+            ".globl " ASSET_BIN_NAME(sym) "\n"    \
+            ASSET_BIN_TYPE(sym)                   \
+            ASSET_BIN_NAME(sym) ":\n"             \
+            ".incbin \"" file "\"\n"              \
+            ASSET_BIN_SIZE(sym)                   \
+            ASSET_BIN_END);                       \
+    ASSET_BIN_EXTERN const uint8_t sym[]
+
+// sym names the payload ASSET_BIN(pooled, ...) defines in the asset pool
+#define ASSET_POOL(sym, pooled) \
+    ASSET_BIN_EXTERN const uint8_t sym[] __asm__(ASSET_BIN_NAME(pooled))
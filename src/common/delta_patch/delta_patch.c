@@ -0,0 +1,332 @@
+#include "delta_patch.h"
+
+#include <string.h>
+
+// --- SHA-256 ---
+static const uint32_t sha_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+#define ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void sha_block(delta_sha256_t *s, const uint8_t *b) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)b[i * 4] << 24) | ((uint32_t)b[i * 4 + 1] << 16) | ((uint32_t)b[i * 4 + 2] << 8) | b[i * 4 + 3];
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ROR(w[i - 15], 7) ^ ROR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ROR(w[i - 2], 17) ^ ROR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = s->state[0], b1 = s->state[1], c = s->state[2], d = s->state[3];
+    uint32_t e = s->state[4], f = s->state[5], g = s->state[6], h = s->state[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ROR(e, 6) ^ ROR(e, 11) ^ ROR(e, 25)) + ((e & f) ^ (~e & g)) + sha_k[i] + w[i];
+        uint32_t t2 = (ROR(a, 2) ^ ROR(a, 13) ^ ROR(a, 22)) + ((a & b1) ^ (a & c) ^ (b1 & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b1;
+        b1 = a;
+        a = t1 + t2;
+    }
+    s->state[0] += a;
+    s->state[1] += b1;
+    s->state[2] += c;
+    s->state[3] += d;
+    s->state[4] += e;
+    s->state[5] += f;
+    s->state[6] += g;
+    s->state[7] += h;
+}
+
+void delta_sha256_init(delta_sha256_t *s) {
+    static const uint32_t init[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                     0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    memcpy(s->state, init, sizeof(init));
+    s->count = 0;
+}
+
+void delta_sha256_update(delta_sha256_t *s, const uint8_t *data, size_t len) {
+    size_t used = s->count & 63;
+    s->count += len;
+    if (used) {
+        size_t n = 64 - used < len ? 64 - used : len;
+        memcpy(s->buf + used, data, n);
+        data += n;
+        len -= n;
+        if (used + n < 64) return;
+        sha_block(s, s->buf);
+    }
+    for (; len >= 64; data += 64, len -= 64) sha_block(s, data);
+    memcpy(s->buf, data, len);
+}
+
+void delta_sha256_final(delta_sha256_t *s, uint8_t out[32]) {
+    uint64_t bits = s->count * 8;
+    uint8_t pad[72] = {0x80};
+    size_t used = s->count & 63;
+    size_t n = used < 56 ? 56 - used : 120 - used;
+    for (int i = 0; i < 8; i++) pad[n + i] = (uint8_t)(bits >> (56 - i * 8));
+    delta_sha256_update(s, pad, n + 8);
+    for (int i = 0; i < 8; i++) {
+        out[i * 4] = s->state[i] >> 24;
+        out[i * 4 + 1] = s->state[i] >> 16;
+        out[i * 4 + 2] = s->state[i] >> 8;
+        out[i * 4 + 3] = s->state[i];
+    }
+}
+
+// --- Output ---
+static uint32_t u32le(const uint8_t *b) {
+    return b[0] | (b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+static void fail(delta_patch_t *p, delta_status_t status) {
+    if (p->status == DELTA_MORE) p->status = status;
+}
+
+static void flush(delta_patch_t *p) {
+    if (p->out_len == 0) return;
+    delta_sha256_update(&p->sha, p->out, p->out_len);
+    if (!p->io->write_new(p->io->ctx, p->out, p->out_len)) fail(p, DELTA_ERR_IO);
+    p->out_len = 0;
+}
+
+static void out_byte(delta_patch_t *p, uint8_t b) {
+    p->out[p->out_len++] = b;
+    p->written++;
+    if (p->out_len == DELTA_OUT_CHUNK) flush(p);
+}
+
+static void finish(delta_patch_t *p) {
+    flush(p);
+    if (p->status != DELTA_MORE) return;
+    if (p->written != p->header.new_size) {
+        fail(p, DELTA_ERR_CORRUPT);
+        return;
+    }
+    uint8_t hash[32];
+    delta_sha256_final(&p->sha, hash);
+    p->status = memcmp(hash, p->header.new_hash, 32) == 0 ? DELTA_DONE : DELTA_ERR_HASH;
+}
+
+// --- Ops ---
+static uint8_t old_byte(delta_patch_t *p) {
+    if (p->old_used == p->old_avail) {
+        uint32_t n = p->header.old_size - p->old_pos;
+        if (n > DELTA_OLD_CHUNK) n = DELTA_OLD_CHUNK;
+        if (!p->io->read_old(p->io->ctx, p->old_pos, p->old, n)) {
+            fail(p, DELTA_ERR_IO);
+            return 0;
+        }
+        p->old_avail = n;
+        p->old_used = 0;
+    }
+    p->old_pos++;
+    return p->old[p->old_used++];
+}
+
+// COPY goes around the old buffer, SEEK moves away from it
+static void old_drop(delta_patch_t *p) {
+    p->old_avail = 0;
+    p->old_used = 0;
+}
+
+static void copy_old(delta_patch_t *p, uint32_t n) {
+    old_drop(p);
+    while (n > 0 && p->status == DELTA_MORE) {
+        uint32_t k = DELTA_OUT_CHUNK - p->out_len;
+        if (k > n) k = n;
+        if (!p->io->read_old(p->io->ctx, p->old_pos, p->out + p->out_len, k)) {
+            fail(p, DELTA_ERR_IO);
+            return;
+        }
+        p->out_len += k;
+        p->written += k;
+        p->old_pos += k;
+        n -= k;
+        if (p->out_len == DELTA_OUT_CHUNK) flush(p);
+    }
+}
+
+static void run_op(delta_patch_t *p) {
+    uint32_t n = p->arg;
+    bool fits = n <= p->header.new_size - p->written;
+    bool old_fits = n <= p->header.old_size - p->old_pos;
+    switch (p->op) {
+    case DELTA_OP_COPY:
+        if (!fits || !old_fits) break;
+        copy_old(p, n);
+        p->op = 0;
+        return;
+    case DELTA_OP_ADD:
+        if (!fits || !old_fits) break;
+        p->remaining = n;
+        if (n == 0) p->op = 0;
+        return;
+    case DELTA_OP_INSERT:
+        if (!fits) break;
+        p->remaining = n;
+        if (n == 0) p->op = 0;
+        return;
+    case DELTA_OP_SEEK: {
+        int64_t to = (int64_t)p->old_pos + ((n & 1) ? -(int64_t)(n >> 1) - 1 : (int64_t)(n >> 1));
+        if (to < 0 || to > p->header.old_size) break;
+        p->old_pos = (uint32_t)to;
+        old_drop(p);
+        p->op = 0;
+        return;
+    }
+    }
+    fail(p, DELTA_ERR_CORRUPT);
+}
+
+static void op_byte(delta_patch_t *p, uint8_t b) {
+    if (p->op == 0) {
+        if (b == DELTA_OP_END) {
+            finish(p);
+        } else if (b >= DELTA_OP_COPY && b <= DELTA_OP_SEEK) {
+            p->op = b;
+            p->in_arg = true;
+            p->arg = 0;
+            p->arg_shift = 0;
+        } else {
+            fail(p, DELTA_ERR_CORRUPT);
+        }
+        return;
+    }
+    if (p->in_arg) {
+        if (p->arg_shift > 28) {
+            fail(p, DELTA_ERR_CORRUPT);
+            return;
+        }
+        p->arg |= (uint32_t)(b & 0x7F) << p->arg_shift;
+        p->arg_shift += 7;
+        if (b & 0x80) return;
+        p->in_arg = false;
+        run_op(p);
+        return;
+    }
+
+    // ADD or INSERT payload
+    if (p->op == DELTA_OP_ADD) b += old_byte(p);
+    out_byte(p, b);
+    if (--p->remaining == 0) p->op = 0;
+}
+
+// --- LZSS ---
+static void lz_out(delta_patch_t *p, uint8_t b) {
+    p->window[p->window_pos++ & (DELTA_WINDOW - 1)] = b;
+    op_byte(p, b);
+}
+
+static void lz_byte(delta_patch_t *p, uint8_t b) {
+    if (p->flag_bits == 0) {
+        p->flags = b;
+        p->flag_bits = 8;
+        return;
+    }
+    if (p->flags & 1) {
+        lz_out(p, b);
+    } else {
+        p->token[p->token_len++] = b;
+        bool extended = (p->token[1] & 0x0F) == 15;
+        if (p->token_len < 2 || (extended && p->token_len < 3)) return;
+
+        uint32_t dist = (p->token[0] | ((uint32_t)(p->token[1] >> 4) << 8)) + 1;
+        uint32_t len = (p->token[1] & 0x0F) + DELTA_MIN_MATCH + (extended ? p->token[2] : 0);
+        p->token_len = 0;
+        if (dist > p->window_pos) {
+            fail(p, DELTA_ERR_CORRUPT);
+            return;
+        }
+        for (uint32_t i = 0; i < len && p->status == DELTA_MORE; i++) {
+            lz_out(p, p->window[(p->window_pos - dist) & (DELTA_WINDOW - 1)]);
+        }
+    }
+    p->flags >>= 1;
+    p->flag_bits--;
+}
+
+// --- Patch ---
+static void read_header(delta_patch_t *p) {
+    const uint8_t *h = p->head;
+    if (memcmp(h, DELTA_MAGIC, 4) != 0) {
+        fail(p, DELTA_ERR_MAGIC);
+        return;
+    }
+    p->header.old_size = u32le(h + 4);
+    p->header.new_size = u32le(h + 8);
+    p->header.flags = u32le(h + 12);
+    memcpy(p->header.old_hash, h + 16, 32);
+    memcpy(p->header.new_hash, h + 48, 32);
+    if (p->header.flags != 0) {
+        fail(p, DELTA_ERR_CORRUPT);
+        return;
+    }
+
+    // the patch only fits the image it was made from
+    uint8_t hash[32];
+    delta_sha256_init(&p->sha);
+    for (uint32_t at = 0; at < p->header.old_size; at += DELTA_OUT_CHUNK) {
+        uint32_t n = p->header.old_size - at < DELTA_OUT_CHUNK ? p->header.old_size - at : DELTA_OUT_CHUNK;
+        if (!p->io->read_old(p->io->ctx, at, p->out, n)) {
+            fail(p, DELTA_ERR_IO);
+            return;
+        }
+        delta_sha256_update(&p->sha, p->out, n);
+    }
+    delta_sha256_final(&p->sha, hash);
+    if (memcmp(hash, p->header.old_hash, 32) != 0) {
+        fail(p, DELTA_ERR_BASE);
+        return;
+    }
+
+    delta_sha256_init(&p->sha);
+    if (p->io->begin && !p->io->begin(p->io->ctx, &p->header)) fail(p, DELTA_ERR_IO);
+}
+
+void delta_patch_begin(delta_patch_t *p, const delta_io_t *io) {
+    memset(p, 0, sizeof(*p));
+    p->io = io;
+    p->status = DELTA_MORE;
+}
+
+delta_status_t delta_patch_feed(delta_patch_t *p, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len && p->status == DELTA_MORE; i++) {
+        if (p->head_len < DELTA_HEADER_SIZE) {
+            p->head[p->head_len++] = data[i];
+            if (p->head_len == DELTA_HEADER_SIZE) read_header(p);
+        } else {
+            lz_byte(p, data[i]);
+        }
+    }
+    return p->status;
+}
+
+bool delta_is_patch(const uint8_t *data, size_t len) {
+    return len >= 4 && memcmp(data, DELTA_MAGIC, 4) == 0;
+}
+
+const char *delta_status_text(delta_status_t status) {
+    switch (status) {
+    case DELTA_MORE: return "incomplete";
+    case DELTA_DONE: return "done";
+    case DELTA_ERR_MAGIC: return "not a patch";
+    case DELTA_ERR_BASE: return "made for another firmware";
+    case DELTA_ERR_CORRUPT: return "corrupt patch";
+    case DELTA_ERR_IO: return "read or write failed";
+    case DELTA_ERR_HASH: return "hash mismatch";
+    }
+    return "unknown";
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Firmware updates sent as a delta against the running image. The patch is
+ * made on a PC by support/delta_tool and applied here as it arrives, chunk by
+ * chunk, with a fixed amount of RAM (delta_patch_t, about 6 KB).
+ *
+ * Patch file, numbers little endian:
+ *   header   "WDP1", old size, new size, flags (0), SHA-256 of the old image,
+ *            SHA-256 of the new image (80 bytes)
+ *   body     LZSS compressed ops
+ *
+ * LZSS: a flag byte covers the next 8 tokens, low bit first. Set is a literal
+ * byte, clear a match of two bytes: distance - 1 in 12 bits (4 KB window) and
+ * length - 3 in the low nibble, 15 meaning a third byte adds to it.
+ *
+ * Ops, counts as LEB128:
+ *   COPY n      n bytes of the old image
+ *   ADD n ...   n bytes, each the old byte plus the patch byte
+ *   INSERT n .. n bytes from the patch
+ *   SEEK d      move in the old image, d zigzag signed
+ *   END
+ * COPY and ADD move through the old image too. Unchanged assets become long
+ * COPYs and recompiled code becomes ADD runs that are mostly zeros, which
+ * LZSS squeezes.
+ *
+ * Before anything is written the old image is hashed through io->read_old
+ * and has to match the header. The new image is hashed as it is written, so
+ * delta_patch_feed only returns DELTA_DONE once it matches too.
+ */
+
+#define DELTA_MAGIC "WDP1"
+#define DELTA_HEADER_SIZE 80
+#define DELTA_WINDOW_BITS 12
+#define DELTA_WINDOW (1 << DELTA_WINDOW_BITS)
+#define DELTA_MIN_MATCH 3
+#define DELTA_OLD_CHUNK 256
+#define DELTA_OUT_CHUNK 1024
+
+enum {
+    DELTA_OP_COPY = 1,
+    DELTA_OP_ADD,
+    DELTA_OP_INSERT,
+    DELTA_OP_SEEK,
+    DELTA_OP_END
+};
+
+typedef enum {
+    DELTA_MORE = 0,    // feed the next bytes
+    DELTA_DONE,        // new image written and verified
+    DELTA_ERR_MAGIC,   // not a patch
+    DELTA_ERR_BASE,    // made for another firmware
+    DELTA_ERR_CORRUPT, // bad ops or sizes
+    DELTA_ERR_IO,      // a callback failed
+    DELTA_ERR_HASH     // new image does not match the header
+} delta_status_t;
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t count;
+    uint8_t buf[64];
+} delta_sha256_t;
+
+void delta_sha256_init(delta_sha256_t *s);
+void delta_sha256_update(delta_sha256_t *s, const uint8_t *data, size_t len);
+void delta_sha256_final(delta_sha256_t *s, uint8_t out[32]);
+
+typedef struct {
+    uint32_t old_size;
+    uint32_t new_size;
+    uint32_t flags;
+    uint8_t old_hash[32];
+    uint8_t new_hash[32];
+} delta_header_t;
+
+typedef struct {
+    // len bytes of the running image at offset
+    bool (*read_old)(void *ctx, uint32_t offset, uint8_t *buf, uint32_t len);
+    // the old image matched, new_size bytes follow through write_new
+    bool (*begin)(void *ctx, const delta_header_t *header);
+    bool (*write_new)(void *ctx, const uint8_t *data, uint32_t len);
+    void *ctx;
+} delta_io_t;
+
+typedef struct {
+    const delta_io_t *io;
+    delta_status_t status;
+    delta_header_t header;
+    uint8_t head[DELTA_HEADER_SIZE];
+    uint32_t head_len;
+
+    // lzss
+    uint8_t window[DELTA_WINDOW];
+    uint32_t window_pos;
+    uint8_t flags;
+    uint8_t flag_bits;
+    uint8_t token[3];
+    uint8_t token_len;
+
+    // ops
+    uint8_t op;
+    uint32_t arg;
+    uint8_t arg_shift;
+    bool in_arg;
+    uint32_t remaining;
+    uint32_t old_pos;
+    uint8_t old[DELTA_OLD_CHUNK];
+    uint32_t old_avail;
+    uint32_t old_used;
+
+    uint8_t out[DELTA_OUT_CHUNK];
+    uint32_t out_len;
+    uint32_t written;
+    delta_sha256_t sha;
+} delta_patch_t;
+
+void delta_patch_begin(delta_patch_t *p, const delta_io_t *io);
+// the next bytes of the patch, in any chunk size
+delta_status_t delta_patch_feed(delta_patch_t *p, const uint8_t *data, size_t len);
+
+// true when data starts like a patch
+bool delta_is_patch(const uint8_t *data, size_t len);
+const char *delta_status_text(delta_status_t status);
+
+#ifdef __cplusplus
+}
+#endif
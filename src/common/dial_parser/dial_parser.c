@@ -0,0 +1,221 @@
+#include "dial_parser.h"
+
+#include <string.h>
+
+// --- Helpers ---
+static uint16_t u16le(const uint8_t *b) {
+    return b[0] | (b[1] << 8);
+}
+
+static uint32_t u32le(const uint8_t *b) {
+    return b[0] | (b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+// name of one image, the same numbers earlier firmware used for its files
+static uint32_t asset_key(int element, uint32_t table, int frame) {
+    return (uint32_t)element * 10000 + table * 10 + frame;
+}
+
+static uint32_t io_read(dial_parser_t *p, const dial_io_t *io, uint32_t offset, uint8_t *buf, uint32_t len) {
+    uint32_t n = io->read(io->ctx, offset, buf, len);
+    if (n > len) n = len;
+    p->stats.bytes_in += n;
+    return n;
+}
+
+static bool io_write(dial_parser_t *p, const dial_io_t *io, const uint8_t *data, uint32_t len) {
+    p->stats.bytes_out += len;
+    return io->asset_data(io->ctx, data, len);
+}
+
+// the first element with this colour table owns the images drawn from it
+static int table_owner(dial_parser_t *p, uint32_t offset) {
+    for (int i = 0; i < p->tables; i++) {
+        if (p->table_offset[i] == offset) return p->table_owner[i];
+    }
+    return -1;
+}
+
+static void table_add(dial_parser_t *p, uint32_t offset, int owner) {
+    if (p->tables >= DIAL_MAX_ELEMENTS) return;
+    p->table_offset[p->tables] = offset;
+    p->table_owner[p->tables] = (uint8_t)owner;
+    p->tables++;
+}
+
+// --- Images ---
+// pixels of one frame, false when the sink refused them
+static bool expand(dial_parser_t *p, const dial_io_t *io, uint8_t id, bool alpha, uint32_t offset, uint32_t pixels) {
+    if (id == 0x19) {
+        // a plain colour, kept in the table offset field
+        for (uint32_t i = 0; i < DIAL_CHUNK; i++) {
+            p->out[i * 2] = p->item[13];
+            p->out[i * 2 + 1] = p->item[12];
+        }
+        while (pixels > 0) {
+            uint32_t n = pixels < DIAL_CHUNK ? pixels : DIAL_CHUNK;
+            if (!io_write(p, io, p->out, n * 2)) return false;
+            pixels -= n;
+        }
+        return true;
+    }
+
+    while (pixels > 0) {
+        uint32_t want = pixels < DIAL_CHUNK ? pixels : DIAL_CHUNK;
+        uint32_t n = io_read(p, io, offset, p->in, want);
+        uint8_t *o = p->out;
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t *c = &p->table[p->in[i] * 2];
+            if (alpha) {
+                // black is transparent
+                *o++ = (c[0] == 0 && c[1] == 0) ? 0x00 : 0xFF;
+            }
+            *o++ = c[0];
+            *o++ = c[1];
+        }
+        if (n > 0 && !io_write(p, io, p->out, (uint32_t)(o - p->out))) return false;
+        if (n < want) {
+            p->stats.truncated++;
+            return true;
+        }
+        offset += n;
+        pixels -= n;
+    }
+    return true;
+}
+
+static void save_images(dial_parser_t *p, const dial_io_t *io, int index, int owner, uint8_t frames) {
+    uint8_t id = p->item[0];
+    uint16_t w = u16le(&p->item[8]);
+    uint16_t h = u16le(&p->item[10]);
+    uint32_t table = u32le(&p->item[12]);
+    uint32_t data = u32le(&p->item[16]);
+
+    // the background and plain colours are opaque
+    uint8_t cf = (id == 0x09 && index == 0) || id == 0x19 ? DIAL_CF_RGB565 : DIAL_CF_RGB565A8;
+    uint16_t bpp = cf == DIAL_CF_RGB565 ? 2 : 3;
+
+    // the stride has to fit the image header
+    if ((uint32_t)w * bpp > UINT16_MAX) {
+        p->stats.errors++;
+        return;
+    }
+    if (id != 0x19 && io_read(p, io, table, p->table, DIAL_TABLE_SIZE) != DIAL_TABLE_SIZE) {
+        p->stats.errors++;
+        return;
+    }
+
+    uint16_t frame_h = frames ? h / frames : 0;
+    uint32_t pixels = (uint32_t)w * frame_h;
+    for (int f = 0; f < frames; f++) {
+        dial_asset_t asset = {asset_key(owner, table, f), id, cf, w, frame_h, (uint16_t)(w * bpp)};
+        uint8_t header[DIAL_IMG_HEADER_SIZE];
+        dial_image_header(header, cf, w, frame_h, asset.stride);
+        if (!io->asset_begin(io->ctx, &asset, header)) {
+            p->stats.errors++;
+            continue;
+        }
+        p->stats.assets++;
+        p->stats.bytes_out += DIAL_IMG_HEADER_SIZE;
+
+        uint64_t offset = (uint64_t)data + (uint64_t)pixels * f;
+        bool ok = offset <= UINT32_MAX ? expand(p, io, id, bpp == 3, (uint32_t)offset, pixels) : true;
+        if (offset > UINT32_MAX) p->stats.truncated++;
+        io->asset_end(io->ctx);
+        if (!ok) {
+            p->stats.errors++;
+            return;
+        }
+    }
+}
+
+// --- Parser ---
+bool dial_is_known(uint8_t id) {
+    // every id below 0x1E is drawn, earlier firmware meant to skip
+    // 0x04, 0x05, 0x12 and 0x18 here but never did
+    return id < 0x1E || id == 0xFA || id == 0xFD;
+}
+
+int dial_parse(dial_parser_t *p, const dial_io_t *io) {
+    memset(&p->stats, 0, sizeof(p->stats));
+    p->tables = 0;
+
+    uint8_t count;
+    if (io_read(p, io, 0, &count, 1) != 1) {
+        p->stats.errors++;
+        return p->stats.errors;
+    }
+
+    int lan = 0; // position in a run of language variants
+    int weather = 0;
+    for (int i = 0; i < count && i < DIAL_MAX_ELEMENTS; i++) {
+        uint8_t *item = p->item;
+        if (io_read(p, io, 4 + i * DIAL_ITEM_SIZE, item, DIAL_ITEM_SIZE) != DIAL_ITEM_SIZE) {
+            p->stats.errors++;
+            break;
+        }
+
+        uint8_t id = item[0];
+        uint16_t w = u16le(&item[8]);
+        uint16_t h = u16le(&item[10]);
+        uint32_t table = u32le(&item[12]);
+        bool group = (item[1] & 0x80) || id == 0x08;
+        uint8_t frames = group ? (item[1] & 0x7F) : 1;
+        int pivot = item[2];
+        bool multi = (item[3] & 0x80) != 0;
+        uint8_t variants = multi ? (item[3] & 0x7F) : 1;
+
+        if (!dial_is_known(id)) continue;
+        // weather (-) label
+        if (id == 0x16 && (item[1] == 0x06 || item[1] == 0x00)) continue;
+        if (multi) lan++;
+        if (w == 0 || h == 0) continue;
+
+        // one language of the month and weekday names
+        bool drawable = id == 0x0d ? (lan == 1 || lan == 17 || lan == 33) : true;
+        int owner = table_owner(p, table);
+        bool create = false;
+        if (owner < 0) {
+            owner = i;
+            if (drawable) {
+                table_add(p, table, i);
+                create = true;
+            }
+        }
+
+        if (multi) {
+            if (lan == variants) {
+                lan = 0;
+            } else if (!(id == 0x0d && (lan == 1 || lan == 32 || lan == 40 || lan == 17 || lan == 33))) {
+                continue;
+            }
+        }
+        // only the first weather icon
+        if (id == 0x17 && ++weather != 1) continue;
+
+        if (drawable) {
+            dial_element_t element = {
+                id, u16le(&item[4]), u16le(&item[6]), pivot, h - pivot,
+                asset_key(owner, table, 0), (uint8_t)(frames > 1 ? frames : 0)};
+            p->stats.elements++;
+            if (io->element) io->element(io->ctx, &element);
+        }
+        if (create) save_images(p, io, i, owner, frames);
+    }
+    return p->stats.errors;
+}
+
+void dial_image_header(uint8_t *out, uint8_t cf, uint16_t w, uint16_t h, uint16_t stride) {
+    out[0] = 0x19; // LV_IMAGE_HEADER_MAGIC
+    out[1] = cf;
+    out[2] = 0;
+    out[3] = 0;
+    out[4] = w & 0xFF;
+    out[5] = w >> 8;
+    out[6] = h & 0xFF;
+    out[7] = h >> 8;
+    out[8] = stride & 0xFF;
+    out[9] = stride >> 8;
+    out[10] = 0;
+    out[11] = 0;
+}
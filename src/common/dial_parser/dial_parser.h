@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Reader for the watchface dial .bin files the Chronos app sends, the same
+ * format src/faces/bin2lvgl.kt converts offline. It has no platform code and
+ * runs on the host in support/dial_tool. parseDial in the esp32 HAL keeps its
+ * own decoding until the custom faces are ported to LVGL 9.
+ *
+ * Layout, all numbers little endian:
+ *   0            element count (one byte is used)
+ *   4 + 20 * i   element i: id, frames (bit 7 set), pivot, language group
+ *                (bit 7 set), x, y, w, h (u16), colour table offset, pixel
+ *                data offset (u32)
+ *   table        256 RGB565 colours, high byte first
+ *   data         one table index per pixel, the frames of a group stacked
+ *                vertically
+ *
+ * Parsing streams: bytes are pulled through io->read in small chunks and
+ * every image goes out to io->asset_* as an LVGL image file (12 byte header
+ * then pixels) a chunk at a time. All state is in dial_parser_t, nothing is
+ * allocated.
+ */
+
+#define DIAL_MAX_ELEMENTS 60
+#define DIAL_ITEM_SIZE 20
+#define DIAL_TABLE_SIZE 512
+#define DIAL_IMG_HEADER_SIZE 12
+// table indices read per io->read
+#define DIAL_CHUNK 256
+
+// LVGL colour formats of the images
+#define DIAL_CF_RGB565 0x12
+#define DIAL_CF_RGB565A8 0x13
+
+typedef struct {
+    uint8_t id;
+    uint16_t x;
+    uint16_t y;
+    int32_t pivot_x;
+    int32_t pivot_y; // from the top of the whole group, as the watch expects
+    uint32_t image;  // asset key of the first frame
+    uint8_t frames;  // images in the group, 0 for a single image
+} dial_element_t;
+
+typedef struct {
+    // files are named from the key, keys of a group follow each other
+    uint32_t key;
+    uint8_t id;
+    uint8_t cf;
+    uint16_t w;
+    uint16_t h;
+    uint16_t stride;
+} dial_asset_t;
+
+typedef struct {
+    // copies up to len bytes at offset into buf, returns how many it copied
+    uint32_t (*read)(void *ctx, uint32_t offset, uint8_t *buf, uint32_t len);
+    // an element to draw, in file order
+    void (*element)(void *ctx, const dial_element_t *element);
+    // an image file, header then data in chunks, false stops it as an error
+    bool (*asset_begin)(void *ctx, const dial_asset_t *asset, const uint8_t *header);
+    bool (*asset_data)(void *ctx, const uint8_t *data, uint32_t len);
+    void (*asset_end)(void *ctx);
+    void *ctx;
+} dial_io_t;
+
+typedef struct {
+    int errors;
+    int elements;
+    int assets;
+    int truncated;       // images cut short by the end of the file
+    uint32_t bytes_in;   // read through io->read
+    uint32_t bytes_out;  // written to io->asset_data, headers included
+} dial_stats_t;
+
+typedef struct {
+    dial_stats_t stats;
+    uint8_t item[DIAL_ITEM_SIZE];
+    uint8_t table[DIAL_TABLE_SIZE];
+    uint8_t in[DIAL_CHUNK];
+    uint8_t out[DIAL_CHUNK * 3];
+    // colour table offset and the element that first used it
+    uint32_t table_offset[DIAL_MAX_ELEMENTS];
+    uint8_t table_owner[DIAL_MAX_ELEMENTS];
+    int tables;
+} dial_parser_t;
+
+// parses the whole dial, returns the number of errors (also in p->stats)
+int dial_parse(dial_parser_t *p, const dial_io_t *io);
+
+// element ids the watch knows how to draw
+bool dial_is_known(uint8_t id);
+
+// header of an LVGL 9 image file
+void dial_image_header(uint8_t *out, uint8_t cf, uint16_t w, uint16_t h, uint16_t stride);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,103 @@
+#include "face_compositor.h"
+
+static lv_obj_t *composed_face = NULL;
+static lv_obj_t *layer = NULL;
+static lv_draw_buf_t *layer_buf = NULL;
+static uint32_t layer_count = 0;
+// children that were visible before the compositor hid them
+static bool hidden_here[FACE_COMPOSITOR_MAX_CHILDREN];
+
+static bool is_static(lv_obj_t *obj) {
+    return lv_obj_has_flag(obj, FACE_STATIC_FLAG);
+}
+
+/*
+ * Static children that are drawn below every dynamic one. A static child
+ * above a dynamic one (a cap over the hands) stays a live object so the
+ * stacking order does not change.
+ */
+static uint32_t static_bottom(lv_obj_t *face) {
+    uint32_t count = lv_obj_get_child_count(face);
+    uint32_t n = 0;
+    while (n < count && is_static(lv_obj_get_child(face, n))) n++;
+    return n;
+}
+
+// children the face hid itself stay hidden
+static void hide_range(lv_obj_t *face, uint32_t from, uint32_t to) {
+    for (uint32_t i = from; i < to; i++) {
+        lv_obj_t *child = lv_obj_get_child(face, i);
+        hidden_here[i] = !lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN);
+        if (hidden_here[i]) lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void show_range(lv_obj_t *face, uint32_t from, uint32_t to) {
+    for (uint32_t i = from; i < to; i++) {
+        if (hidden_here[i]) lv_obj_remove_flag(lv_obj_get_child(face, i), LV_OBJ_FLAG_HIDDEN);
+        hidden_here[i] = false;
+    }
+}
+
+static void face_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *face = lv_event_get_current_target(e);
+
+    if (code == LV_EVENT_SCREEN_LOAD_START) {
+        face_compositor_compose(face);
+    } else if (code == LV_EVENT_SCREEN_UNLOADED && face == composed_face) {
+        face_compositor_release();
+    }
+}
+
+// --- Faces ---
+void face_compositor_static(lv_obj_t *obj) {
+    lv_obj_add_flag(obj, FACE_STATIC_FLAG);
+}
+
+void face_compositor_attach(lv_obj_t *face) {
+    if (face == NULL) return;
+    lv_obj_add_event_cb(face, face_event_cb, LV_EVENT_ALL, NULL);
+}
+
+// --- Layer ---
+void face_compositor_compose(lv_obj_t *face) {
+    if (face == NULL || face == composed_face) return;
+    face_compositor_release();
+
+    uint32_t count = lv_obj_get_child_count(face);
+    uint32_t bottom = static_bottom(face);
+    if (bottom == 0 || count > FACE_COMPOSITOR_MAX_CHILDREN) return;
+
+    // the layer gets the screen background and the static children only
+    lv_obj_update_layout(face);
+    hide_range(face, bottom, count);
+    layer_buf = lv_snapshot_take(face, LV_COLOR_FORMAT_RGB565);
+    show_range(face, bottom, count);
+    if (layer_buf == NULL) {
+        LV_LOG_WARN("face_compositor: no memory for the layer");
+        return;
+    }
+
+    hide_range(face, 0, bottom);
+    layer = lv_image_create(face);
+    lv_image_set_src(layer, layer_buf);
+    lv_obj_set_pos(layer, 0, 0);
+    lv_obj_add_flag(layer, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_remove_flag(layer, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    // right above the children it replaces, their indexes stay the same
+    lv_obj_move_to_index(layer, (int32_t)bottom);
+    layer_count = bottom;
+    composed_face = face;
+}
+
+void face_compositor_release(void) {
+    if (composed_face == NULL) return;
+    show_range(composed_face, 0, layer_count);
+    lv_obj_delete(layer);
+    lv_draw_buf_destroy(layer_buf);
+    layer = NULL;
+    layer_buf = NULL;
+    layer_count = 0;
+    composed_face = NULL;
+}
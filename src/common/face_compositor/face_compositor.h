@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// marks the static children of a face
+#define FACE_STATIC_FLAG LV_OBJ_FLAG_USER_1
+// children of one face the compositor handles, larger faces are left as is
+#define FACE_COMPOSITOR_MAX_CHILDREN 128
+
+/*
+ * Flattens the static parts of a watchface into one background image while
+ * it is shown. Generated faces mark every child that their update functions
+ * never touch (backgrounds, labels, fixed icons) with face_compositor_static.
+ * When the face loads, the static children below the first dynamic one are
+ * drawn once into an RGB565 buffer of the screen size and hidden. A redraw
+ * of a digit or hand then blends one image below it instead of every layer
+ * of the face. The buffer only exists for the face on screen and is freed
+ * when it unloads.
+ */
+void face_compositor_static(lv_obj_t *obj);
+
+// compose on every load of this face, done for each registered face
+void face_compositor_attach(lv_obj_t *face);
+
+/*
+ * Draws the static children into the background layer and hides them.
+ * Composing another face releases the previous one first. Without memory
+ * for the buffer the face stays as it is.
+ */
+void face_compositor_compose(lv_obj_t *face);
+// shows the static children again and frees the layer
+void face_compositor_release(void);
+
+#ifdef __cplusplus
+}
+#endif
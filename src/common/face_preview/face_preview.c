@@ -0,0 +1,205 @@
+#include "face_preview.h"
+
+// time between two renders, lets the picker scroll in between
+#define RENDER_PERIOD 20
+
+typedef struct {
+    lv_obj_t *image;
+    lv_obj_t **face;
+    int8_t slot;        // -1 while it has no buffer
+} preview_entry_t;
+
+typedef struct {
+    lv_draw_buf_t *buf;
+    int8_t owner;       // entry index, -1 when free
+    uint32_t used;      // last update the owner was visible
+} preview_slot_t;
+
+static preview_entry_t entries[FACE_PREVIEW_MAX];
+static uint8_t entry_count = 0;
+static preview_slot_t slots[FACE_PREVIEW_SLOTS];
+static bool slots_ready = false;
+static uint32_t update_count = 0;
+static lv_timer_t *render_timer = NULL;
+
+static void slots_init(void) {
+    if (slots_ready) return;
+    for (int i = 0; i < FACE_PREVIEW_SLOTS; i++) {
+        slots[i].buf = NULL;
+        slots[i].owner = -1;
+        slots[i].used = 0;
+    }
+    slots_ready = true;
+}
+
+static bool entry_visible(const preview_entry_t *entry) {
+    return entry->image && lv_obj_is_visible(entry->image);
+}
+
+static uint16_t average4(uint16_t a, uint16_t b, uint16_t c, uint16_t d) {
+    uint32_t r = ((a >> 11) + (b >> 11) + (c >> 11) + (d >> 11)) >> 2;
+    uint32_t g = (((a >> 5) & 0x3F) + ((b >> 5) & 0x3F) + ((c >> 5) & 0x3F) + ((d >> 5) & 0x3F)) >> 2;
+    uint32_t bl = ((a & 0x1F) + (b & 0x1F) + (c & 0x1F) + (d & 0x1F)) >> 2;
+    return (uint16_t)(r << 11 | g << 5 | bl);
+}
+
+// RGB565 downscale, each pixel averages the 2x2 block at its source position
+static void downscale(const lv_draw_buf_t *src, lv_draw_buf_t *dst) {
+    int32_t sw = src->header.w;
+    int32_t sh = src->header.h;
+    int32_t dw = dst->header.w;
+    int32_t dh = dst->header.h;
+    for (int32_t y = 0; y < dh; y++) {
+        int32_t sy = y * sh / dh;
+        int32_t sy1 = LV_MIN(sy + 1, sh - 1);
+        const uint16_t *row0 = (const uint16_t *)(src->data + sy * src->header.stride);
+        const uint16_t *row1 = (const uint16_t *)(src->data + sy1 * src->header.stride);
+        uint16_t *out = (uint16_t *)(dst->data + y * dst->header.stride);
+        for (int32_t x = 0; x < dw; x++) {
+            int32_t sx = x * sw / dw;
+            int32_t sx1 = LV_MIN(sx + 1, sw - 1);
+            out[x] = average4(row0[sx], row0[sx1], row1[sx], row1[sx1]);
+        }
+    }
+}
+
+static bool render(lv_obj_t *face, lv_draw_buf_t *dst) {
+    if (face == NULL) return false;
+    // faces that were never shown have no layout yet
+    lv_obj_update_layout(face);
+    lv_draw_buf_t *snapshot = lv_snapshot_take(face, LV_COLOR_FORMAT_RGB565);
+    if (snapshot == NULL) {
+        LV_LOG_WARN("face_preview: no memory for the snapshot");
+        return false;
+    }
+    downscale(snapshot, dst);
+    lv_draw_buf_destroy(snapshot);
+    return true;
+}
+
+static void detach_slot(preview_slot_t *slot) {
+    if (slot->owner < 0) return;
+    preview_entry_t *entry = &entries[slot->owner];
+    entry->slot = -1;
+    lv_image_set_src(entry->image, NULL);
+    slot->owner = -1;
+}
+
+// a free slot, else the one unused the longest whose owner is off screen
+static int pick_slot(void) {
+    int best = -1;
+    for (int i = 0; i < FACE_PREVIEW_SLOTS; i++) {
+        if (slots[i].owner < 0) return i;
+        if (entry_visible(&entries[slots[i].owner])) continue;
+        if (best < 0 || slots[i].used < slots[best].used) best = i;
+    }
+    return best;
+}
+
+static int next_missing(void) {
+    for (int i = 0; i < entry_count; i++) {
+        const preview_entry_t *entry = &entries[i];
+        // faces that are not built yet stay empty
+        if (entry->slot < 0 && entry->face && *entry->face && entry_visible(entry)) return i;
+    }
+    return -1;
+}
+
+static void render_timer_cb(lv_timer_t *timer) {
+    int index = next_missing();
+    int s = index < 0 ? -1 : pick_slot();
+    if (s < 0) {
+        lv_timer_pause(timer);
+        return;
+    }
+
+    preview_slot_t *slot = &slots[s];
+    detach_slot(slot);
+    if (slot->buf == NULL) {
+        slot->buf = lv_draw_buf_create(FACE_PREVIEW_SIZE, FACE_PREVIEW_SIZE, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+        if (slot->buf == NULL) {
+            LV_LOG_WARN("face_preview: no memory for slot %d", s);
+            lv_timer_pause(timer);
+            return;
+        }
+    }
+
+    preview_entry_t *entry = &entries[index];
+    if (!render(*entry->face, slot->buf)) {
+        lv_timer_pause(timer);
+        return;
+    }
+    slot->owner = index;
+    slot->used = update_count;
+    entry->slot = s;
+    // same buffer may be shown again with new pixels
+    lv_image_set_src(entry->image, NULL);
+    lv_image_set_src(entry->image, slot->buf);
+}
+
+static void picker_event_cb(lv_event_t *e) {
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_SCREEN_LOADED || code == LV_EVENT_SCROLL || code == LV_EVENT_SCROLL_END) {
+        face_preview_update();
+    } else if (code == LV_EVENT_SCREEN_UNLOADED) {
+        face_preview_release();
+    }
+}
+
+// --- Picker ---
+void face_preview_attach(lv_obj_t *picker) {
+    slots_init();
+    lv_obj_add_event_cb(picker, picker_event_cb, LV_EVENT_ALL, NULL);
+}
+
+lv_obj_t *face_preview_create(lv_obj_t *parent, lv_obj_t **face, const lv_image_dsc_t *fixed) {
+    lv_obj_t *image = lv_image_create(parent);
+    lv_obj_set_size(image, FACE_PREVIEW_SIZE, FACE_PREVIEW_SIZE);
+    if (fixed) {
+        lv_image_set_src(image, fixed);
+        return image;
+    }
+    if (entry_count >= FACE_PREVIEW_MAX) {
+        LV_LOG_WARN("face_preview: too many faces");
+        return image;
+    }
+    preview_entry_t *entry = &entries[entry_count++];
+    entry->image = image;
+    entry->face = face;
+    entry->slot = -1;
+    return image;
+}
+
+// --- Buffers ---
+void face_preview_update(void) {
+    slots_init();
+    update_count++;
+    bool missing = false;
+    for (int i = 0; i < entry_count; i++) {
+        if (!entry_visible(&entries[i])) continue;
+        if (entries[i].slot >= 0) {
+            slots[entries[i].slot].used = update_count;
+        } else {
+            missing = true;
+        }
+    }
+    if (!missing) return;
+
+    if (render_timer == NULL) {
+        render_timer = lv_timer_create(render_timer_cb, RENDER_PERIOD, NULL);
+    }
+    lv_timer_resume(render_timer);
+}
+
+void face_preview_release(void) {
+    slots_init();
+    if (render_timer) lv_timer_pause(render_timer);
+    for (int i = 0; i < FACE_PREVIEW_SLOTS; i++) {
+        detach_slot(&slots[i]);
+        if (slots[i].buf) {
+            lv_draw_buf_destroy(slots[i].buf);
+            slots[i].buf = NULL;
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// side of the square preview shown in the face picker
+#define FACE_PREVIEW_SIZE 160
+// previews held in RAM, the centred face and one neighbour on each side
+#define FACE_PREVIEW_SLOTS 3
+#define FACE_PREVIEW_MAX 16
+
+/*
+ * Face picker previews drawn from the face screens instead of bitmaps in
+ * flash. An entry stays empty until it scrolls into view, then its face is
+ * rendered offscreen, downscaled into one of FACE_PREVIEW_SLOTS buffers and
+ * shown. Entries that scroll away hand their buffer to the next visible one.
+ * One face is rendered per timer tick so scrolling stays responsive.
+ */
+void face_preview_attach(lv_obj_t *picker);
+
+/*
+ * Image object showing the face at *face. When `fixed` is not NULL it is
+ * shown as is, e.g. for custom faces that share one screen.
+ */
+lv_obj_t *face_preview_create(lv_obj_t *parent, lv_obj_t **face, const lv_image_dsc_t *fixed);
+
+// render the entries that are visible now
+void face_preview_update(void);
+// free every buffer, done when the picker is unloaded
+void face_preview_release(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "app_hal.h"
+
+/*
+ * Resolution independent watchfaces. Faces generated with targets (see
+ * bin2lvgl.kt) store positions as fractions of the dial side and carry one
+ * pre-scaled asset set per dial side, under assets/<side>/. Only the set
+ * matching FACE_SIDE is compiled, the others cost no flash.
+ *
+ * The dial is square. On screens that are not, it fills the short side and
+ * is centred on the long one, so 240x240 and 240x280 share the 240 assets.
+ */
+
+// screen the face assets are built for, the HAL defines it per board
+#ifndef FACE_RES_W
+#define FACE_RES_W 240
+#endif
+#ifndef FACE_RES_H
+#define FACE_RES_H FACE_RES_W
+#endif
+
+// positions in generated faces are in 1/FACE_NORM of the dial side
+#define FACE_NORM 4096
+
+// side of the dial on this screen, selects the asset set
+#define FACE_SIDE (FACE_RES_W < FACE_RES_H ? FACE_RES_W : FACE_RES_H)
+
+// rounded to the nearest pixel, the same way for negative offsets
+#define FACE_SCALE_ABS(n) (((n) * FACE_SIDE + FACE_NORM / 2) / FACE_NORM)
+#define FACE_SCALE(n) ((n) < 0 ? -FACE_SCALE_ABS(-(n)) : FACE_SCALE_ABS(n))
+
+#define FACE_X(n) ((FACE_RES_W - FACE_SIDE) / 2 + FACE_SCALE(n))
+#define FACE_Y(n) ((FACE_RES_H - FACE_SIDE) / 2 + FACE_SCALE(n))
@@ -0,0 +1,72 @@
+// Auto-generated app table
+// DO NOT EDIT this file
+// It will be overwritten
+// Apps from REGISTER_APP in src/apps and src/games, in launcher order
+
+#pragma once
+
+#if defined(ENABLE_APP_ATTITUDE)
+extern const app_info_t app_info_ui_attiudeScreen;
+#endif
+#if defined(ENABLE_APP_CALENDAR)
+extern const app_info_t app_info_calendar_screen_main;
+#endif
+#if defined(ENABLE_APP_CONTACTS)
+extern const app_info_t app_info_ui_contactScreen;
+#endif
+#if defined(ENABLE_APP_NAVIGATION)
+extern const app_info_t app_info_ui_navScreen;
+#endif
+extern const app_info_t app_info_ui_pioScreen;
+#if defined(ENABLE_APP_QMI8658C)
+extern const app_info_t app_info_ui_imuScreen;
+#endif
+#if defined(ENABLE_GAME_RACING)
+extern const app_info_t app_info_ui_raceScreen;
+#endif
+#if defined(ENABLE_APP_RANGE)
+extern const app_info_t app_info_range_screen_main;
+#endif
+#if defined(ENABLE_APP_SAMPLE)
+extern const app_info_t app_info_sample_screen_main;
+#endif
+#if defined(ENABLE_GAME_SIMON)
+extern const app_info_t app_info_ui_simonScreen;
+#endif
+#if defined(ENABLE_APP_TIMER)
+extern const app_info_t app_info_ui_timerScreen;
+#endif
+
+static const app_info_t *const app_table[] = {
+#if defined(ENABLE_APP_ATTITUDE)
+    &app_info_ui_attiudeScreen, // Attitude
+#endif
+#if defined(ENABLE_APP_CALENDAR)
+    &app_info_calendar_screen_main, // Calendar
+#endif
+#if defined(ENABLE_APP_CONTACTS)
+    &app_info_ui_contactScreen, // Contacts
+#endif
+#if defined(ENABLE_APP_NAVIGATION)
+    &app_info_ui_navScreen, // Navigation
+#endif
+    &app_info_ui_pioScreen, // PIO Bot
+#if defined(ENABLE_APP_QMI8658C)
+    &app_info_ui_imuScreen, // QMI8658C
+#endif
+#if defined(ENABLE_GAME_RACING)
+    &app_info_ui_raceScreen, // Racing
+#endif
+#if defined(ENABLE_APP_RANGE)
+    &app_info_range_screen_main, // Range
+#endif
+#if defined(ENABLE_APP_SAMPLE)
+    &app_info_sample_screen_main, // Sample App
+#endif
+#if defined(ENABLE_GAME_SIMON)
+    &app_info_ui_simonScreen, // Simon Says
+#endif
+#if defined(ENABLE_APP_TIMER)
+    &app_info_ui_timerScreen, // Timer
+#endif
+    NULL};
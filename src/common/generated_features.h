@@ -29,7 +29,6 @@
 #include "../faces/34_2/34_2.h"
 #include "../faces/3589/3589.h"
 #include "../faces/756_2/756_2.h"
-#include "../faces/756_2_466/756_2_466.h"
 #include "../faces/75_2/75_2.h"
 #include "../faces/79_2/79_2.h"
 #include "../faces/b_w_resized/b_w_resized.h"
@@ -37,7 +36,6 @@
 #include "../faces/kenya/kenya.h"
 #include "../faces/pixel_resized/pixel_resized.h"
 #include "../faces/radar/radar.h"
-#include "../faces/radar_466/radar_466.h"
 #include "../faces/smart_resized/smart_resized.h"
 #include "../faces/tix_resized/tix_resized.h"
 #include "../faces/wfb_resized/wfb_resized.h"
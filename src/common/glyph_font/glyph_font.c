@@ -0,0 +1,507 @@
+#include "glyph_font.h"
+
+#include <string.h>
+
+#define NONE 0xFFFF
+// RAM of the cache given to each slot, the rest holds bitmaps
+#define SLOT_BYTES 128
+#define MIN_SLOTS 16
+#define MAX_SLOTS 4096
+#define MAX_CMAPS 4096
+#define MAX_SECTIONS 8
+
+// lv_font_conv cmap formats
+#define CMAP_FORMAT0_FULL 0
+#define CMAP_SPARSE_FULL 1
+#define CMAP_FORMAT0_TINY 2
+#define CMAP_SPARSE_TINY 3
+
+struct glyph_entry {
+    uint32_t letter;
+    uint8_t *bitmap; // packed at the font bpp, rows back to back
+    uint32_t size;
+    uint16_t prev; // lru
+    uint16_t next;
+    uint16_t chain; // bucket, or free list
+    uint16_t stamp;
+    uint32_t adv_w; // 1/16 px, like lv_font_fmt_txt_glyph_dsc_t
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    bool found;
+};
+
+struct glyph_cmap {
+    uint32_t data; // file offset of the lists
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_start;
+    uint16_t entries;
+    uint8_t type;
+};
+
+static uint16_t le16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t le32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+static bool rd(glyph_font_t *gf, uint32_t offset, void *buf, uint32_t len) {
+    return gf->io.read(gf->io.ctx, offset, buf, len);
+}
+
+// msb first, as lv_font_conv packs them
+static uint32_t bits(const uint8_t *buf, uint32_t *pos, uint8_t n) {
+    uint32_t v = 0;
+    while (n--) {
+        v = (v << 1) | ((buf[*pos >> 3] >> (7 - (*pos & 7))) & 1);
+        (*pos)++;
+    }
+    return v;
+}
+
+static int32_t sbits(const uint8_t *buf, uint32_t *pos, uint8_t n) {
+    uint32_t v = bits(buf, pos, n);
+    if (n && (v & (1u << (n - 1)))) v |= ~0u << n;
+    return (int32_t)v;
+}
+
+// --- File ---
+static uint32_t find_glyph(glyph_font_t *gf, uint32_t letter) {
+    for (uint32_t i = 0; i < gf->cmap_count; i++) {
+        const glyph_cmap_t *c = &gf->cmaps[i];
+        uint32_t rcp = letter - c->range_start;
+        if (letter < c->range_start || rcp >= c->range_length) continue;
+
+        if (c->type == CMAP_FORMAT0_TINY) return c->glyph_start + rcp;
+        if (c->type == CMAP_FORMAT0_FULL) {
+            uint8_t ofs;
+            if (rcp >= c->entries || !rd(gf, c->data + rcp, &ofs, 1)) return 0;
+            // 0 past the first letter marks a gap in the range
+            if (ofs == 0 && rcp != 0) continue;
+            return c->glyph_start + ofs;
+        }
+
+        // sparse, a sorted list of letters relative to the range
+        uint32_t lo = 0, hi = c->entries;
+        while (lo < hi) {
+            uint32_t mid = (lo + hi) / 2;
+            uint8_t v[2];
+            if (!rd(gf, c->data + mid * 2, v, 2)) return 0;
+            uint16_t u = le16(v);
+            if (u == rcp) {
+                if (c->type == CMAP_SPARSE_TINY) return c->glyph_start + mid;
+                if (!rd(gf, c->data + c->entries * 2 + mid * 2, v, 2)) return 0;
+                return c->glyph_start + le16(v);
+            }
+            if (u < rcp) lo = mid + 1;
+            else hi = mid;
+        }
+    }
+    return 0;
+}
+
+static bool load_glyph(glyph_font_t *gf, uint32_t id, glyph_entry_t *e) {
+    if (id == 0 || id >= gf->loca_count) return false;
+
+    uint8_t loca[8];
+    uint32_t w = gf->loca_long ? 4 : 2;
+    uint32_t n = id + 1 < gf->loca_count ? 2 : 1;
+    if (!rd(gf, gf->loca_start + 12 + id * w, loca, n * w)) return false;
+    uint32_t start = w == 4 ? le32(loca) : le16(loca);
+    uint32_t end = n == 1 ? gf->glyf_size : (w == 4 ? le32(loca + 4) : le16(loca + 2));
+    if (end <= start || end > gf->glyf_size || end - start > gf->budget) return false;
+
+    uint32_t len = end - start;
+    uint8_t *rec = lv_malloc(len);
+    if (rec == NULL) return false;
+    if (!rd(gf, gf->glyf_start + start, rec, len)) {
+        lv_free(rec);
+        return false;
+    }
+
+    uint32_t head = gf->adv_bits + 2 * gf->xy_bits + 2 * gf->wh_bits;
+    if (head > len * 8) {
+        lv_free(rec);
+        return false;
+    }
+    uint32_t pos = 0;
+    uint32_t adv = gf->adv_bits ? bits(rec, &pos, gf->adv_bits) : gf->default_adv;
+    e->adv_w = gf->adv_fixed ? adv : adv * 16;
+    e->ofs_x = (int16_t)sbits(rec, &pos, gf->xy_bits);
+    e->ofs_y = (int16_t)sbits(rec, &pos, gf->xy_bits);
+    e->box_w = (uint16_t)bits(rec, &pos, gf->wh_bits);
+    e->box_h = (uint16_t)bits(rec, &pos, gf->wh_bits);
+
+    uint32_t pixels = (uint32_t)e->box_w * e->box_h * gf->bpp;
+    if (pixels > len * 8 - head) {
+        lv_free(rec);
+        return false;
+    }
+    e->size = (pixels + 7) / 8;
+    if (e->size == 0) {
+        lv_free(rec);
+        e->bitmap = NULL;
+        return true;
+    }
+
+    // move the bitmap to the start of the record, in place
+    uint32_t skip = head / 8, shift = head % 8;
+    for (uint32_t i = 0; i < e->size; i++) {
+        uint8_t low = shift && i + skip + 1 < len ? rec[i + skip + 1] >> (8 - shift) : 0;
+        rec[i] = (uint8_t)(rec[i + skip] << shift) | low;
+    }
+    uint8_t *bitmap = lv_realloc(rec, e->size);
+    e->bitmap = bitmap ? bitmap : rec;
+    return true;
+}
+
+// --- Cache ---
+static uint16_t bucket(const glyph_font_t *gf, uint32_t letter) {
+    return (uint16_t)((letter * 2654435761u) >> 16) & gf->mask;
+}
+
+static uint16_t find(glyph_font_t *gf, uint32_t letter) {
+    uint16_t i = gf->buckets[bucket(gf, letter)];
+    while (i != NONE && gf->entries[i].letter != letter) i = gf->entries[i].chain;
+    return i;
+}
+
+static void lru_remove(glyph_font_t *gf, uint16_t i) {
+    glyph_entry_t *e = &gf->entries[i];
+    if (e->prev != NONE) gf->entries[e->prev].next = e->next;
+    else gf->head = e->next;
+    if (e->next != NONE) gf->entries[e->next].prev = e->prev;
+    else gf->tail = e->prev;
+}
+
+static void push_front(glyph_font_t *gf, uint16_t i) {
+    glyph_entry_t *e = &gf->entries[i];
+    e->prev = NONE;
+    e->next = gf->head;
+    if (gf->head != NONE) gf->entries[gf->head].prev = i;
+    gf->head = i;
+    if (gf->tail == NONE) gf->tail = i;
+}
+
+static void touch(glyph_font_t *gf, uint16_t i) {
+    if (gf->head == i) return;
+    lru_remove(gf, i);
+    push_front(gf, i);
+}
+
+static void evict(glyph_font_t *gf, uint16_t i) {
+    glyph_entry_t *e = &gf->entries[i];
+    lru_remove(gf, i);
+
+    uint16_t *link = &gf->buckets[bucket(gf, e->letter)];
+    while (*link != i) link = &gf->entries[*link].chain;
+    *link = e->chain;
+
+    lv_free(e->bitmap);
+    gf->stats.bytes -= e->size;
+    gf->stats.glyphs--;
+    gf->stats.evictions++;
+    memset(e, 0, sizeof(*e));
+    e->chain = gf->free;
+    gf->free = i;
+}
+
+/*
+ * Reads letter from the file into a slot, evicting from the tail. With
+ * protect set the glyphs of the current prewarm are kept, NONE when only
+ * they are left.
+ */
+static uint16_t insert(glyph_font_t *gf, uint32_t letter, bool protect) {
+    glyph_entry_t e;
+    memset(&e, 0, sizeof(e));
+    e.letter = letter;
+    uint32_t id = find_glyph(gf, letter);
+    e.found = id != 0 && load_glyph(gf, id, &e);
+    if (!e.found) {
+        lv_free(e.bitmap);
+        e.bitmap = NULL;
+        e.size = 0;
+    }
+    gf->stats.misses++;
+
+    while (gf->free == NONE || gf->stats.bytes + e.size > gf->budget) {
+        uint16_t t = gf->tail;
+        if (t == NONE || (protect && gf->entries[t].stamp == gf->stamp)) {
+            lv_free(e.bitmap);
+            return NONE;
+        }
+        evict(gf, t);
+    }
+
+    uint16_t i = gf->free;
+    gf->free = gf->entries[i].chain;
+    uint16_t b = bucket(gf, letter);
+    e.chain = gf->buckets[b];
+    gf->buckets[b] = i;
+    gf->entries[i] = e;
+    push_front(gf, i);
+    gf->stats.bytes += e.size;
+    gf->stats.glyphs++;
+    return i;
+}
+
+static uint16_t lookup(glyph_font_t *gf, uint32_t letter) {
+    uint16_t i = find(gf, letter);
+    if (i == NONE) return insert(gf, letter, false);
+    gf->stats.hits++;
+    touch(gf, i);
+    return i;
+}
+
+// --- Locking ---
+static void cache_lock(glyph_font_t *gf) {
+    if (gf->io.lock) gf->io.lock(gf->io.ctx);
+    else lv_mutex_lock(&gf->lock);
+}
+
+static void cache_unlock(glyph_font_t *gf) {
+    if (gf->io.unlock) gf->io.unlock(gf->io.ctx);
+    else lv_mutex_unlock(&gf->lock);
+}
+
+// --- LVGL ---
+static bool get_glyph_dsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, uint32_t letter, uint32_t letter_next) {
+    LV_UNUSED(letter_next);
+    glyph_font_t *gf = (glyph_font_t *)font->dsc;
+    bool tab = letter == '\t';
+    if (tab) letter = ' ';
+
+    cache_lock(gf);
+    uint16_t i = lookup(gf, letter);
+    bool found = i != NONE && gf->entries[i].found;
+    if (found) {
+        const glyph_entry_t *e = &gf->entries[i];
+        uint32_t adv = tab ? e->adv_w * 2u : e->adv_w;
+        dsc->adv_w = (uint16_t)((adv + 8) >> 4);
+        dsc->box_w = e->box_w;
+        dsc->box_h = e->box_h;
+        dsc->ofs_x = e->ofs_x;
+        dsc->ofs_y = e->ofs_y;
+        dsc->format = (lv_font_glyph_format_t)gf->bpp;
+        dsc->is_placeholder = 0;
+        dsc->gid.index = letter;
+        dsc->resolved_font = font;
+    }
+    cache_unlock(gf);
+    return found;
+}
+
+// expanded to A8, like the built-in fonts
+static const void *get_glyph_bitmap(lv_font_glyph_dsc_t *dsc, lv_draw_buf_t *draw_buf) {
+    glyph_font_t *gf = (glyph_font_t *)dsc->resolved_font->dsc;
+    if (draw_buf == NULL || dsc->req_raw_bitmap) return NULL;
+
+    const void *out = NULL;
+    cache_lock(gf);
+    // evicted since get_glyph_dsc when another thread drew a lot of text
+    uint16_t i = lookup(gf, dsc->gid.index);
+    if (i != NONE && gf->entries[i].bitmap) {
+        const glyph_entry_t *e = &gf->entries[i];
+        uint8_t *row = draw_buf->data;
+        uint32_t max = (1u << gf->bpp) - 1;
+        uint32_t pos = 0;
+        for (uint32_t y = 0; y < e->box_h; y++) {
+            for (uint32_t x = 0; x < e->box_w; x++) {
+                uint32_t v = bits(e->bitmap, &pos, gf->bpp);
+                row[x] = (uint8_t)(gf->bpp == 8 ? v : (v * 255 + max / 2) / max);
+            }
+            row += draw_buf->header.stride;
+        }
+        out = draw_buf;
+    }
+    cache_unlock(gf);
+    return out;
+}
+
+void glyph_font_bind(glyph_font_t *gf, lv_font_t *font, const lv_font_t *fallback) {
+    memset(font, 0, sizeof(*font));
+    font->get_glyph_dsc = get_glyph_dsc;
+    font->get_glyph_bitmap = get_glyph_bitmap;
+    font->line_height = gf->line_height;
+    font->base_line = gf->base_line;
+    font->subpx = LV_FONT_SUBPX_NONE;
+    font->underline_position = gf->underline_position;
+    font->underline_thickness = gf->underline_thickness;
+    font->dsc = gf;
+    font->fallback = fallback;
+}
+
+// --- Open ---
+static glyph_font_status_t read_tables(glyph_font_t *gf) {
+    uint32_t head = 0, cmap = 0, loca = 0;
+    bool has_head = false, has_cmap = false, has_loca = false, has_glyf = false;
+    uint32_t offset = 0;
+    for (int i = 0; i < MAX_SECTIONS && !has_glyf; i++) {
+        uint8_t sec[8];
+        if (!rd(gf, offset, sec, sizeof(sec))) return GLYPH_FONT_ERR_IO;
+        uint32_t len = le32(sec);
+        if (len < 8) return GLYPH_FONT_ERR_FORMAT;
+        if (memcmp(sec + 4, "head", 4) == 0) {
+            head = offset;
+            has_head = true;
+        } else if (memcmp(sec + 4, "cmap", 4) == 0) {
+            cmap = offset;
+            has_cmap = true;
+        } else if (memcmp(sec + 4, "loca", 4) == 0) {
+            loca = offset;
+            has_loca = true;
+        } else if (memcmp(sec + 4, "glyf", 4) == 0) {
+            gf->glyf_start = offset;
+            gf->glyf_size = len;
+            has_glyf = true;
+        }
+        offset += len;
+    }
+    if (!has_head || !has_cmap || !has_loca || !has_glyf) return GLYPH_FONT_ERR_FORMAT;
+
+    uint8_t h[40];
+    if (!rd(gf, head + 8, h, sizeof(h))) return GLYPH_FONT_ERR_IO;
+    uint16_t ascent = le16(h + 8);
+    int16_t descent = (int16_t)le16(h + 10);
+    gf->default_adv = le16(h + 22);
+    gf->loca_long = h[26] != 0;
+    gf->adv_fixed = h[28] != 0;
+    gf->bpp = h[29];
+    gf->xy_bits = h[30];
+    gf->wh_bits = h[31];
+    gf->adv_bits = h[32];
+    gf->line_height = ascent - descent;
+    gf->base_line = -descent;
+    gf->underline_position = (int8_t)le16(h + 36);
+    gf->underline_thickness = (int8_t)le16(h + 38);
+    if (h[33] != 0) return GLYPH_FONT_ERR_COMPRESSED;
+    if (gf->bpp == 0 || gf->bpp > 8 || (gf->bpp > 4 && gf->bpp != 8)) return GLYPH_FONT_ERR_FORMAT;
+    if (gf->xy_bits > 16 || gf->wh_bits > 16 || gf->adv_bits > 16) return GLYPH_FONT_ERR_FORMAT;
+
+    uint8_t count[4];
+    if (!rd(gf, cmap + 8, count, 4)) return GLYPH_FONT_ERR_IO;
+    gf->cmap_count = le32(count);
+    if (gf->cmap_count == 0 || gf->cmap_count > MAX_CMAPS) return GLYPH_FONT_ERR_FORMAT;
+    gf->cmap_start = cmap;
+    gf->cmaps = lv_malloc(gf->cmap_count * sizeof(glyph_cmap_t));
+    if (gf->cmaps == NULL) return GLYPH_FONT_ERR_MEMORY;
+    for (uint32_t i = 0; i < gf->cmap_count; i++) {
+        uint8_t c[16];
+        if (!rd(gf, cmap + 12 + i * 16, c, sizeof(c))) return GLYPH_FONT_ERR_IO;
+        glyph_cmap_t *m = &gf->cmaps[i];
+        m->data = cmap + le32(c);
+        m->range_start = le32(c + 4);
+        m->range_length = le16(c + 8);
+        m->glyph_start = le16(c + 10);
+        m->entries = le16(c + 12);
+        m->type = c[14];
+        if (m->type > CMAP_SPARSE_TINY) return GLYPH_FONT_ERR_FORMAT;
+    }
+
+    if (!rd(gf, loca + 8, count, 4)) return GLYPH_FONT_ERR_IO;
+    gf->loca_start = loca;
+    gf->loca_count = le32(count);
+    return GLYPH_FONT_OK;
+}
+
+glyph_font_status_t glyph_font_open(glyph_font_t *gf, const glyph_font_io_t *io, uint32_t cache_size) {
+    memset(gf, 0, sizeof(*gf));
+    gf->io = *io;
+
+    uint32_t slots = cache_size / SLOT_BYTES;
+    if (slots < MIN_SLOTS) slots = MIN_SLOTS;
+    if (slots > MAX_SLOTS) slots = MAX_SLOTS;
+    uint32_t buckets = 1;
+    while (buckets < slots) buckets <<= 1;
+    uint32_t overhead = slots * sizeof(glyph_entry_t) + buckets * sizeof(uint16_t);
+    gf->budget = cache_size > overhead ? cache_size - overhead : 0;
+
+    glyph_font_status_t status = read_tables(gf);
+    if (status == GLYPH_FONT_OK) {
+        gf->entries = lv_malloc(slots * sizeof(glyph_entry_t));
+        gf->buckets = lv_malloc(buckets * sizeof(uint16_t));
+        if (gf->entries == NULL || gf->buckets == NULL) status = GLYPH_FONT_ERR_MEMORY;
+    }
+    if (status != GLYPH_FONT_OK) {
+        lv_free(gf->cmaps);
+        lv_free(gf->entries);
+        lv_free(gf->buckets);
+        memset(gf, 0, sizeof(*gf));
+        return status;
+    }
+
+    memset(gf->entries, 0, slots * sizeof(glyph_entry_t));
+    memset(gf->buckets, 0xFF, buckets * sizeof(uint16_t));
+    gf->slots = (uint16_t)slots;
+    gf->mask = (uint16_t)(buckets - 1);
+    for (uint32_t i = 0; i < slots; i++) gf->entries[i].chain = i + 1 < slots ? (uint16_t)(i + 1) : NONE;
+    gf->free = 0;
+    gf->head = NONE;
+    gf->tail = NONE;
+    lv_mutex_init(&gf->lock);
+    return GLYPH_FONT_OK;
+}
+
+void glyph_font_close(glyph_font_t *gf) {
+    if (gf->entries == NULL) return;
+    for (uint32_t i = 0; i < gf->slots; i++) lv_free(gf->entries[i].bitmap);
+    lv_free(gf->entries);
+    lv_free(gf->buckets);
+    lv_free(gf->cmaps);
+    lv_mutex_delete(&gf->lock);
+    memset(gf, 0, sizeof(*gf));
+}
+
+// --- Prewarm ---
+static uint32_t next_letter(const char **text) {
+    const uint8_t *p = (const uint8_t *)*text;
+    uint32_t c = *p++;
+    int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+    if (extra) c &= 0x3F >> extra;
+    while (extra-- && (*p & 0xC0) == 0x80) c = (c << 6) | (*p++ & 0x3F);
+    *text = (const char *)p;
+    return c;
+}
+
+uint32_t glyph_font_prewarm(glyph_font_t *gf, const char *text) {
+    if (gf->entries == NULL || text == NULL) return 0;
+    uint32_t loaded = 0;
+
+    cache_lock(gf);
+    if (++gf->stamp == 0) gf->stamp = 1; // 0 is never a prewarm
+    while (*text) {
+        uint32_t letter = next_letter(&text);
+        if (letter < 0x20) continue;
+        uint16_t i = find(gf, letter);
+        if (i == NONE) {
+            i = insert(gf, letter, true);
+            if (i == NONE) break; // the rest would push out this text
+            loaded++;
+        } else {
+            touch(gf, i);
+        }
+        gf->entries[i].stamp = gf->stamp;
+    }
+    cache_unlock(gf);
+    return loaded;
+}
+
+glyph_font_stats_t glyph_font_stats(glyph_font_t *gf) {
+    glyph_font_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    if (gf->entries == NULL) return stats;
+    cache_lock(gf);
+    stats = gf->stats;
+    cache_unlock(gf);
+    return stats;
+}
+
+const char *glyph_font_status_text(glyph_font_status_t status) {
+    switch (status) {
+    case GLYPH_FONT_OK: return "ok";
+    case GLYPH_FONT_ERR_IO: return "read failed";
+    case GLYPH_FONT_ERR_FORMAT: return "not an LVGL binary font";
+    case GLYPH_FONT_ERR_COMPRESSED: return "compressed, convert with --no-compress";
+    case GLYPH_FONT_ERR_MEMORY: return "out of memory";
+    }
+    return "unknown";
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * An LVGL font read from a file one glyph at a time, for scripts that are
+ * too big to build into the firmware (CJK, Cyrillic and so on). The file is
+ * an LVGL binary font made with
+ *   lv_font_conv --format bin --no-compress --bpp 4 --size 16 --font <ttf> -r <ranges> -o font.bin
+ * but unlike lv_binfont_create only the header and the cmap ranges are kept
+ * in RAM. A glyph is read through io->read the first time it is drawn and
+ * its bitmap stays in an LRU cache of a fixed byte budget. Letters the file
+ * lacks are cached too, so they go to the fallback font without file reads.
+ *
+ * glyph_font_prewarm loads the glyphs of a text before it is shown, a new
+ * notification for instance, so the first frame does not wait on the file.
+ * To call it from a task other than the renderer give io a lock.
+ *
+ * One glyph_font_t can back several lv_font_t (glyph_font_bind), each with
+ * its own fallback, for labels that use different built-in fonts.
+ */
+
+typedef enum {
+    GLYPH_FONT_OK = 0,
+    GLYPH_FONT_ERR_IO,         // io->read failed
+    GLYPH_FONT_ERR_FORMAT,     // not an LVGL binary font
+    GLYPH_FONT_ERR_COMPRESSED, // made without --no-compress
+    GLYPH_FONT_ERR_MEMORY
+} glyph_font_status_t;
+
+typedef struct {
+    // len bytes of the font file at offset
+    bool (*read)(void *ctx, uint32_t offset, void *buf, uint32_t len);
+    void *ctx;
+    // optional, held around every cache access and read. Without them an
+    // lv_mutex_t is used, which does nothing unless LV_USE_OS is set
+    void (*lock)(void *ctx);
+    void (*unlock)(void *ctx);
+} glyph_font_io_t;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;    // glyph looked up in the file
+    uint32_t evictions;
+    uint32_t bytes;     // bitmaps in the cache
+    uint32_t glyphs;    // letters in the cache, missing ones included
+} glyph_font_stats_t;
+
+typedef struct glyph_entry glyph_entry_t;
+typedef struct glyph_cmap glyph_cmap_t;
+
+typedef struct {
+    glyph_font_io_t io;
+    lv_mutex_t lock; // draw threads share the cache, unless io has a lock
+
+    // header
+    uint8_t bpp;
+    uint8_t xy_bits;
+    uint8_t wh_bits;
+    uint8_t adv_bits;
+    bool adv_fixed;  // advances carry 4 fraction bits
+    bool loca_long;  // 32 bit glyph offsets
+    uint16_t default_adv;
+    int32_t line_height;
+    int32_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+
+    // tables, offsets in the file
+    uint32_t cmap_start;
+    glyph_cmap_t *cmaps;
+    uint32_t cmap_count;
+    uint32_t loca_start;
+    uint32_t loca_count;
+    uint32_t glyf_start;
+    uint32_t glyf_size;
+
+    // cache
+    glyph_entry_t *entries;
+    uint16_t *buckets;
+    uint16_t slots;
+    uint16_t mask;
+    uint16_t free; // unused slots, linked through chain
+    uint16_t head; // most recent
+    uint16_t tail;
+    uint32_t budget; // bitmap bytes
+    uint16_t stamp;  // current prewarm
+    glyph_font_stats_t stats;
+} glyph_font_t;
+
+/*
+ * Reads the header and cmaps through io, whose ctx has to stay valid until
+ * glyph_font_close. cache_size is the RAM for the cache in bytes, slots and
+ * bitmaps together.
+ */
+glyph_font_status_t glyph_font_open(glyph_font_t *gf, const glyph_font_io_t *io, uint32_t cache_size);
+void glyph_font_close(glyph_font_t *gf);
+
+// font draws from gf, letters gf lacks from fallback (may be NULL)
+void glyph_font_bind(glyph_font_t *gf, lv_font_t *font, const lv_font_t *fallback);
+
+/*
+ * Loads the glyphs of a UTF-8 text into the cache, the number read from the
+ * file. Stops before it would evict a glyph of the same text.
+ */
+uint32_t glyph_font_prewarm(glyph_font_t *gf, const char *text);
+
+glyph_font_stats_t glyph_font_stats(glyph_font_t *gf);
+const char *glyph_font_status_text(glyph_font_status_t status);
+
+#ifdef __cplusplus
+}
+#endif
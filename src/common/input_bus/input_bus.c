@@ -1,10 +1,61 @@
 #include "input_bus.h"
+#include "lvgl.h"
 
 
 #define MAX_SUBS 8
 
+// ring sizes, power of two
+#define ENCODER_QUEUE 32
+#define BUTTON_QUEUE 8
+#define GESTURE_QUEUE 8
+
+// fast scrolling, gain grows by one for every ACCEL_STEP counts/s
+#define ACCEL_STEP 200.0f
+#define ACCEL_MAX_GAIN 8
+// velocity is reset when the knob has been idle for this long
+#define VELOCITY_IDLE_MS 150
+
+typedef struct {
+    long position;
+    uint32_t timestamp;
+    bool reset; // the encoder was re-zeroed to position, not turned
+} encoder_sample_t;
+
+typedef struct {
+    bool pressed;
+    uint32_t timestamp;
+} button_sample_t;
+
+typedef struct {
+    input_gesture_t gesture;
+    uint32_t timestamp;
+} gesture_sample_t;
+
 static encoder_event_cb_t encoder_subs[MAX_SUBS] = {0};
 static button_event_cb_t button_subs[MAX_SUBS] = {0};
+static input_event_cb_t event_subs[MAX_SUBS] = {0};
+
+// single producer / single consumer rings, the producer only writes head
+static encoder_sample_t encoder_queue[ENCODER_QUEUE];
+static uint32_t encoder_head = 0, encoder_tail = 0;
+static button_sample_t button_queue[BUTTON_QUEUE];
+static uint32_t button_head = 0, button_tail = 0;
+static gesture_sample_t gesture_queue[GESTURE_QUEUE];
+static uint32_t gesture_head = 0, gesture_tail = 0;
+
+static bool hw_gestures = false;
+static lv_dir_t hw_gesture_dir = LV_DIR_NONE;
+
+// last sample seen by the producer, kept even when the ring is full
+static volatile long encoder_latest = 0;
+static volatile uint32_t encoder_latest_time = 0;
+// a reset that did not fit in the ring
+static volatile bool encoder_reset_lost = false;
+static volatile long encoder_reset_position = 0;
+
+static long last_position = 0;
+static uint32_t last_time = 0;
+static float velocity = 0;
 
 // --- Encoder subscriptions ---
 void input_bus_add_encoder_sub(encoder_event_cb_t cb) {
@@ -44,15 +95,251 @@ void input_bus_remove_button_sub(button_event_cb_t cb) {
     }
 }
 
-// --- Emit events ---
-void input_bus_emit_encoder_event(long pos, int32_t change) {
+// --- Event subscriptions ---
+void input_bus_add_event_sub(input_event_cb_t cb) {
+    for (int i = 0; i < MAX_SUBS; i++) {
+        if (event_subs[i] == NULL) {
+            event_subs[i] = cb;
+            break;
+        }
+    }
+}
+
+void input_bus_remove_event_sub(input_event_cb_t cb) {
     for (int i = 0; i < MAX_SUBS; i++) {
-        if (encoder_subs[i]) encoder_subs[i](pos, change);
+        if (event_subs[i] == cb) {
+            event_subs[i] = NULL;
+            break;
+        }
     }
 }
 
+// --- Producers ---
+static void post_encoder(long position, uint32_t timestamp, bool reset) {
+    encoder_latest = position;
+    encoder_latest_time = timestamp;
+
+    uint32_t head = __atomic_load_n(&encoder_head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&encoder_tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= ENCODER_QUEUE) {
+        // full, the consumer picks up encoder_latest instead
+        if (reset) {
+            encoder_reset_position = position;
+            encoder_reset_lost = true;
+        }
+        return;
+    }
+    encoder_queue[head & (ENCODER_QUEUE - 1)].position = position;
+    encoder_queue[head & (ENCODER_QUEUE - 1)].timestamp = timestamp;
+    encoder_queue[head & (ENCODER_QUEUE - 1)].reset = reset;
+    __atomic_store_n(&encoder_head, head + 1, __ATOMIC_RELEASE);
+}
+
+void input_bus_post_encoder(long position, uint32_t timestamp) {
+    post_encoder(position, timestamp, false);
+}
+
+void input_bus_reset_encoder(long position, uint32_t timestamp) {
+    post_encoder(position, timestamp, true);
+}
+
+void input_bus_post_button(bool pressed, uint32_t timestamp) {
+    uint32_t head = __atomic_load_n(&button_head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&button_tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= BUTTON_QUEUE) {
+        return;
+    }
+    button_queue[head & (BUTTON_QUEUE - 1)].pressed = pressed;
+    button_queue[head & (BUTTON_QUEUE - 1)].timestamp = timestamp;
+    __atomic_store_n(&button_head, head + 1, __ATOMIC_RELEASE);
+}
+
+void input_bus_post_gesture(input_gesture_t gesture, uint32_t timestamp) {
+    uint32_t head = __atomic_load_n(&gesture_head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&gesture_tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= GESTURE_QUEUE) {
+        return;
+    }
+    gesture_queue[head & (GESTURE_QUEUE - 1)].gesture = gesture;
+    gesture_queue[head & (GESTURE_QUEUE - 1)].timestamp = timestamp;
+    __atomic_store_n(&gesture_head, head + 1, __ATOMIC_RELEASE);
+}
+
+void input_bus_emit_encoder_event(long pos, int32_t change) {
+    (void)change;
+    input_bus_post_encoder(pos, lv_tick_get());
+}
+
 void input_bus_emit_button_event(bool pressed) {
+    input_bus_post_button(pressed, lv_tick_get());
+}
+
+// --- Dispatch ---
+static void deliver(const input_event_t *event) {
     for (int i = 0; i < MAX_SUBS; i++) {
-        if (button_subs[i]) button_subs[i](pressed);
+        if (event_subs[i]) event_subs[i](event);
+    }
+    if (event->type == INPUT_EVENT_ENCODER) {
+        for (int i = 0; i < MAX_SUBS; i++) {
+            if (encoder_subs[i]) encoder_subs[i](event->position, event->change);
+        }
+    } else if (event->type == INPUT_EVENT_BUTTON) {
+        for (int i = 0; i < MAX_SUBS; i++) {
+            if (button_subs[i]) button_subs[i](event->pressed);
+        }
+    }
+}
+
+static void dispatch_encoder(void) {
+    uint32_t head = __atomic_load_n(&encoder_head, __ATOMIC_ACQUIRE);
+    uint32_t tail = encoder_tail;
+    bool full = head - tail >= ENCODER_QUEUE;
+    if (head == tail) {
+        return;
+    }
+
+    // a reset moves the base, turns after it count from there
+    for (uint32_t i = tail; i != head; i++) {
+        const encoder_sample_t *queued = &encoder_queue[i & (ENCODER_QUEUE - 1)];
+        if (queued->reset) last_position = queued->position;
+    }
+    // only the newest sample matters, earlier ones are merged into it
+    encoder_sample_t sample = encoder_queue[(head - 1) & (ENCODER_QUEUE - 1)];
+    __atomic_store_n(&encoder_tail, head, __ATOMIC_RELEASE);
+    if (full) {
+        // samples were dropped while full, the producer kept the newest one
+        if (encoder_reset_lost) {
+            encoder_reset_lost = false;
+            last_position = encoder_reset_position;
+        }
+        sample.position = encoder_latest;
+        sample.timestamp = encoder_latest_time;
+    }
+
+    int32_t change = (int32_t)(sample.position - last_position);
+    if (change == 0) {
+        return;
+    }
+
+    uint32_t dt = sample.timestamp - last_time;
+    float prev = velocity;
+    if (dt >= VELOCITY_IDLE_MS) {
+        velocity = 0;
+        prev = 0;
+    } else {
+        float instant = change * 1000.0f / (dt ? dt : 1);
+        velocity = (velocity + instant) / 2;
+    }
+
+    input_event_t event = {0};
+    event.type = INPUT_EVENT_ENCODER;
+    event.timestamp = sample.timestamp;
+    event.position = sample.position;
+    event.change = change;
+    event.velocity = velocity;
+    event.acceleration = dt ? (velocity - prev) * 1000.0f / dt : 0;
+
+    float speed = velocity < 0 ? -velocity : velocity;
+    int32_t gain = 1 + (int32_t)(speed / ACCEL_STEP);
+    if (gain > ACCEL_MAX_GAIN) gain = ACCEL_MAX_GAIN;
+    event.scaled_change = change * gain;
+
+    last_position = sample.position;
+    last_time = sample.timestamp;
+
+    deliver(&event);
+}
+
+static void dispatch_buttons(void) {
+    uint32_t head = __atomic_load_n(&button_head, __ATOMIC_ACQUIRE);
+    while (button_tail != head) {
+        button_sample_t sample = button_queue[button_tail & (BUTTON_QUEUE - 1)];
+        __atomic_store_n(&button_tail, button_tail + 1, __ATOMIC_RELEASE);
+
+        input_event_t event = {0};
+        event.type = INPUT_EVENT_BUTTON;
+        event.timestamp = sample.timestamp;
+        event.pressed = sample.pressed;
+        deliver(&event);
+    }
+}
+
+static lv_dir_t gesture_to_dir(input_gesture_t gesture) {
+    switch (gesture) {
+    case INPUT_GESTURE_SWIPE_UP: return LV_DIR_TOP;
+    case INPUT_GESTURE_SWIPE_DOWN: return LV_DIR_BOTTOM;
+    case INPUT_GESTURE_SWIPE_LEFT: return LV_DIR_LEFT;
+    case INPUT_GESTURE_SWIPE_RIGHT: return LV_DIR_RIGHT;
+    default: return LV_DIR_NONE;
+    }
+}
+
+// the object under the last touch, found the way LVGL picks a gesture target
+static lv_obj_t *gesture_target(void) {
+    lv_indev_t *indev = lv_indev_get_next(NULL);
+    while (indev && lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) {
+        indev = lv_indev_get_next(indev);
+    }
+    lv_obj_t *screen = lv_screen_active();
+    if (!indev) {
+        return screen;
+    }
+
+    lv_point_t point;
+    lv_indev_get_point(indev, &point);
+    lv_obj_t *obj = lv_indev_search_obj(lv_layer_sys(), &point);
+    if (!obj) {
+        obj = lv_indev_search_obj(lv_layer_top(), &point);
+    }
+    if (!obj && screen) {
+        obj = lv_indev_search_obj(screen, &point);
+    }
+    while (obj && lv_obj_has_flag(obj, LV_OBJ_FLAG_GESTURE_BUBBLE)) {
+        obj = lv_obj_get_parent(obj);
+    }
+    return obj ? obj : screen;
+}
+
+static void dispatch_gestures(void) {
+    uint32_t head = __atomic_load_n(&gesture_head, __ATOMIC_ACQUIRE);
+    while (gesture_tail != head) {
+        gesture_sample_t sample = gesture_queue[gesture_tail & (GESTURE_QUEUE - 1)];
+        __atomic_store_n(&gesture_tail, gesture_tail + 1, __ATOMIC_RELEASE);
+
+        input_event_t event = {0};
+        event.type = INPUT_EVENT_GESTURE;
+        event.timestamp = sample.timestamp;
+        event.gesture = sample.gesture;
+        deliver(&event);
+
+        lv_dir_t dir = gesture_to_dir(sample.gesture);
+        if (!hw_gestures || dir == LV_DIR_NONE) {
+            continue;
+        }
+        lv_obj_t *target = gesture_target();
+        if (target) {
+            hw_gesture_dir = dir;
+            lv_obj_send_event(target, LV_EVENT_GESTURE, NULL);
+            hw_gesture_dir = LV_DIR_NONE;
+        }
+    }
+}
+
+void input_bus_dispatch(void) {
+    dispatch_encoder();
+    dispatch_buttons();
+    dispatch_gestures();
+}
+
+// --- Gestures ---
+void input_bus_use_hw_gestures(bool enable) {
+    hw_gestures = enable;
+}
+
+lv_dir_t input_bus_gesture_dir(void) {
+    if (hw_gestures) {
+        return hw_gesture_dir;
     }
+    lv_indev_t *indev = lv_indev_active();
+    return indev ? lv_indev_get_gesture_dir(indev) : LV_DIR_NONE;
 }
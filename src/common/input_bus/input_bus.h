@@ -4,6 +4,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "lvgl.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -11,12 +13,72 @@ extern "C" {
 typedef void (*encoder_event_cb_t)(long position, int32_t change);
 typedef void (*button_event_cb_t)(bool pressed);
 
+typedef enum {
+    INPUT_EVENT_ENCODER = 0,
+    INPUT_EVENT_BUTTON,
+    INPUT_EVENT_GESTURE
+} input_event_type_t;
+
+// gestures classified by the touch controller
+typedef enum {
+    INPUT_GESTURE_NONE = 0,
+    INPUT_GESTURE_SWIPE_UP,
+    INPUT_GESTURE_SWIPE_DOWN,
+    INPUT_GESTURE_SWIPE_LEFT,
+    INPUT_GESTURE_SWIPE_RIGHT,
+    INPUT_GESTURE_DOUBLE_TAP,
+    INPUT_GESTURE_LONG_PRESS
+} input_gesture_t;
+
+typedef struct {
+    input_event_type_t type;
+    uint32_t timestamp;     // ms, time of the last sample in this event
+    // encoder, all samples since the previous frame merged into one event
+    long position;
+    int32_t change;
+    int32_t scaled_change;  // change with the fast-spin gain applied
+    float velocity;         // counts per second, smoothed
+    float acceleration;     // counts per second^2
+    // button
+    bool pressed;
+    // gesture
+    input_gesture_t gesture;
+} input_event_t;
+
+typedef void (*input_event_cb_t)(const input_event_t *event);
+
 void input_bus_add_encoder_sub(encoder_event_cb_t cb);
 void input_bus_remove_encoder_sub(encoder_event_cb_t cb);
 
 void input_bus_add_button_sub(button_event_cb_t cb);
 void input_bus_remove_button_sub(button_event_cb_t cb);
 
+void input_bus_add_event_sub(input_event_cb_t cb);
+void input_bus_remove_event_sub(input_event_cb_t cb);
+
+/*
+ * Producers. Safe to call from an interrupt, events are queued and
+ * delivered to subscribers by input_bus_dispatch.
+ */
+void input_bus_post_encoder(long position, uint32_t timestamp);
+// the encoder count was set to position, subscribers see no turn
+void input_bus_reset_encoder(long position, uint32_t timestamp);
+void input_bus_post_button(bool pressed, uint32_t timestamp);
+void input_bus_post_gesture(input_gesture_t gesture, uint32_t timestamp);
+
+/*
+ * With hardware gestures enabled, swipes posted by the touch driver are sent
+ * as LV_EVENT_GESTURE to the object under the last touch, or the first parent
+ * without LV_OBJ_FLAG_GESTURE_BUBBLE, and gestures detected by LVGL are
+ * ignored. Gesture handlers read the direction with input_bus_gesture_dir.
+ */
+void input_bus_use_hw_gestures(bool enable);
+lv_dir_t input_bus_gesture_dir(void);
+
+/* Call once per frame from the UI thread */
+void input_bus_dispatch(void);
+
+/* Queue with the current LVGL tick, not for interrupts */
 void input_bus_emit_encoder_event(long position, int32_t change);
 void input_bus_emit_button_event(bool pressed);
 
@@ -0,0 +1,160 @@
+#include "log_ring.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// record header, one word written last: size, level and type
+#define REC_TEXT 1
+#define REC_DEFER 2
+#define REC_PAD 3
+#define REC_HEADER 4
+
+#define ALIGN4(n) (((n) + 3u) & ~3u)
+
+typedef struct {
+    const char *fmt;
+    uint32_t args[4];
+} deferred_t;
+
+void log_ring_init(log_ring_t *ring, uint8_t *buf, uint32_t size, uint32_t (*now_ms)(void)) {
+    memset(ring, 0, sizeof(*ring));
+    memset(buf, 0, size);
+    ring->buf = buf;
+    ring->size = size;
+    ring->now_ms = now_ms;
+}
+
+void log_ring_set_limit(log_ring_t *ring, log_level_t level, uint16_t per_second) {
+    if (level < LOG_LEVEL_COUNT) ring->limit[level] = per_second;
+}
+
+// --- Writers ---
+// racy between writers, close enough for a limit
+static bool allowed(log_ring_t *ring, log_level_t level) {
+    uint16_t limit = ring->limit[level];
+    if (limit == 0 || ring->now_ms == NULL) return true;
+    uint32_t now = ring->now_ms();
+    if (now - ring->window[level] >= 1000) {
+        ring->window[level] = now;
+        ring->count[level] = 0;
+    }
+    if (ring->count[level] >= limit) return false;
+    ring->count[level]++;
+    return true;
+}
+
+static void publish(uint8_t *rec, uint32_t size, log_level_t level, uint8_t type) {
+    uint32_t word = size | ((uint32_t)level << 16) | ((uint32_t)type << 24);
+    __atomic_store_n((uint32_t *)rec, word, __ATOMIC_RELEASE);
+}
+
+// room for one record, never split over the end of the buffer
+static uint8_t *reserve(log_ring_t *ring, uint32_t size) {
+    uint32_t mask = ring->size - 1;
+    uint32_t head, next, pad;
+    do {
+        head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+        uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        uint32_t off = head & mask;
+        pad = off + size > ring->size ? ring->size - off : 0;
+        next = head + pad + size;
+        if (next - tail > ring->size) {
+            __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+            return NULL;
+        }
+    } while (!__atomic_compare_exchange_n(&ring->head, &head, next, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    if (pad) publish(ring->buf + (head & mask), pad, LOG_LEVEL_VERBOSE, REC_PAD);
+    return ring->buf + ((head + pad) & mask);
+}
+
+static log_level_t clamp(log_level_t level) {
+    return level < LOG_LEVEL_COUNT ? level : LOG_LEVEL_ERROR;
+}
+
+bool log_ring_put(log_ring_t *ring, log_level_t level, const char *text, size_t len) {
+    level = clamp(level);
+    if (!allowed(ring, level)) {
+        __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+    if (len > LOG_RING_LINE - 1) len = LOG_RING_LINE - 1;
+    uint32_t size = ALIGN4(REC_HEADER + 2 + len);
+    uint8_t *rec = reserve(ring, size);
+    if (rec == NULL) return false;
+
+    uint16_t n = (uint16_t)len;
+    memcpy(rec + REC_HEADER, &n, 2);
+    memcpy(rec + REC_HEADER + 2, text, len);
+    publish(rec, size, level, REC_TEXT);
+    return true;
+}
+
+bool log_ring_printf(log_ring_t *ring, log_level_t level, const char *fmt, ...) {
+    char line[LOG_RING_LINE];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if (n < 0) return false;
+    return log_ring_put(ring, level, line, (size_t)n < sizeof(line) ? (size_t)n : sizeof(line) - 1);
+}
+
+bool log_ring_defer(log_ring_t *ring, log_level_t level, const char *fmt,
+                    uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+    level = clamp(level);
+    if (!allowed(ring, level)) {
+        __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+    uint32_t size = ALIGN4(REC_HEADER + sizeof(deferred_t));
+    uint8_t *rec = reserve(ring, size);
+    if (rec == NULL) return false;
+
+    deferred_t body = {fmt, {a, b, c, d}};
+    memcpy(rec + REC_HEADER, &body, sizeof(body));
+    publish(rec, size, level, REC_DEFER);
+    return true;
+}
+
+// --- Drain ---
+size_t log_ring_pop(log_ring_t *ring, char *out, size_t len, log_level_t *level) {
+    if (len == 0) return 0;
+    uint32_t dropped = __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+    if (dropped != ring->reported) {
+        int n = snprintf(out, len, "log: %u lines dropped\n", (unsigned)(dropped - ring->reported));
+        ring->reported = dropped;
+        if (level) *level = LOG_LEVEL_WARN;
+        return n < 0 ? 0 : ((size_t)n < len ? (size_t)n : len - 1);
+    }
+
+    for (;;) {
+        uint32_t tail = ring->tail;
+        if (tail == __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE)) return 0;
+        uint8_t *rec = ring->buf + (tail & (ring->size - 1));
+        uint32_t word = __atomic_load_n((uint32_t *)rec, __ATOMIC_ACQUIRE);
+        if (word == 0) return 0; // reserved, still being written
+
+        uint32_t size = word & 0xFFFF;
+        uint8_t type = word >> 24;
+        size_t n = 0;
+        if (type == REC_TEXT) {
+            uint16_t text;
+            memcpy(&text, rec + REC_HEADER, 2);
+            n = text < len - 1 ? text : len - 1;
+            memcpy(out, rec + REC_HEADER + 2, n);
+            out[n] = 0;
+        } else if (type == REC_DEFER) {
+            deferred_t body;
+            memcpy(&body, rec + REC_HEADER, sizeof(body));
+            int r = snprintf(out, len, body.fmt, body.args[0], body.args[1], body.args[2], body.args[3]);
+            n = r < 0 ? 0 : ((size_t)r < len ? (size_t)r : len - 1);
+        }
+        if (level) *level = (log_level_t)((word >> 16) & 0xFF);
+
+        // writers find zeroed headers when the space comes around again
+        memset(rec, 0, size);
+        __atomic_store_n(&ring->tail, tail + size, __ATOMIC_RELEASE);
+        if (type != REC_PAD) return n;
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Log lines queued in a byte ring so logging never waits on the UART. Any
+ * task can write, without locks: a writer reserves its record with a
+ * compare-and-swap on the head and publishes it by writing the record header
+ * last. One task drains the ring with log_ring_pop and does the slow output.
+ *
+ * A full ring drops the new line, and each level can be limited to a number
+ * of lines per second. The drain reports how many were dropped.
+ *
+ * log_ring_defer keeps the format and up to four integer arguments and
+ * formats them when the line is drained. That is the cheapest call, for hot
+ * paths such as BLE callbacks and rendering. The format must be a string
+ * literal, and "%s" arguments are not allowed because a string can be gone
+ * by the time the line is drained.
+ */
+
+// levels in the same order as Timber
+typedef enum {
+    LOG_LEVEL_VERBOSE = 0,
+    LOG_LEVEL_DEBUG,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_COUNT
+} log_level_t;
+
+// longest line, longer ones are cut
+#define LOG_RING_LINE 192
+
+typedef struct {
+    uint8_t *buf;
+    uint32_t size; // power of two
+    uint32_t head; // reserved by writers
+    uint32_t tail; // released by the drain
+    uint32_t (*now_ms)(void);
+    // lines per second for each level, 0 for no limit
+    uint16_t limit[LOG_LEVEL_COUNT];
+    uint32_t window[LOG_LEVEL_COUNT];
+    uint16_t count[LOG_LEVEL_COUNT];
+    uint32_t dropped;
+    uint32_t reported;
+} log_ring_t;
+
+// buf is used as the ring, size must be a power of two
+void log_ring_init(log_ring_t *ring, uint8_t *buf, uint32_t size, uint32_t (*now_ms)(void));
+void log_ring_set_limit(log_ring_t *ring, log_level_t level, uint16_t per_second);
+
+// false when the line was dropped
+bool log_ring_put(log_ring_t *ring, log_level_t level, const char *text, size_t len);
+bool log_ring_printf(log_ring_t *ring, log_level_t level, const char *fmt, ...);
+bool log_ring_defer(log_ring_t *ring, log_level_t level, const char *fmt,
+                    uint32_t a, uint32_t b, uint32_t c, uint32_t d);
+
+// next line into out (NUL terminated), its length or 0 when nothing is ready
+size_t log_ring_pop(log_ring_t *ring, char *out, size_t len, log_level_t *level);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,125 @@
+#include "prefs.h"
+
+#include <string.h>
+
+typedef struct {
+    const char *name;
+    pref_type_t type;
+    pref_value_t def;
+} pref_def_t;
+
+static const pref_def_t defs[PREF_COUNT] = {
+    [PREF_ROTATE] = {"rotate", PREF_TYPE_INT, {.i = 0}},
+    [PREF_TIMEOUT] = {"timeout", PREF_TYPE_INT, {.i = 0}},
+    [PREF_BRIGHTNESS] = {"brightness", PREF_TYPE_INT, {.i = 100}},
+    [PREF_WATCHFACE] = {"watchface", PREF_TYPE_INT, {.i = 0}},
+    [PREF_CUSTOM_FACE] = {"custom", PREF_TYPE_STR, {.s = ""}},
+    [PREF_CIRCULAR] = {"circular", PREF_TYPE_BOOL, {.b = false}},
+    [PREF_ALERTS] = {"alerts", PREF_TYPE_BOOL, {.b = false}},
+    [PREF_AUTONAV] = {"autonav", PREF_TYPE_BOOL, {.b = false}},
+    [PREF_ALERT_STATES] = {"alert_states", PREF_TYPE_INT, {.i = 0x0F}},
+    [PREF_RACING_HIGH] = {"racing_high", PREF_TYPE_INT, {.i = 0}},
+    [PREF_SIMON_HIGH] = {"simon_high", PREF_TYPE_INT, {.i = 0}},
+};
+
+static const prefs_backend_t *backend = NULL;
+static pref_value_t values[PREF_COUNT];
+static bool dirty[PREF_COUNT];
+static bool pending = false;
+static lv_timer_t *write_timer = NULL;
+
+static void write_timer_cb(lv_timer_t *timer) {
+    (void)timer;
+    prefs_flush();
+}
+
+// restart the write delay, a burst of changes ends in one write
+static void mark_dirty(pref_key_t key) {
+    dirty[key] = true;
+    pending = true;
+    if (write_timer == NULL) {
+        write_timer = lv_timer_create(write_timer_cb, PREFS_WRITE_DELAY, NULL);
+        lv_timer_set_auto_delete(write_timer, false);
+    }
+    lv_timer_set_repeat_count(write_timer, 1);
+    lv_timer_reset(write_timer);
+    lv_timer_resume(write_timer);
+}
+
+static bool valid(pref_key_t key, pref_type_t type) {
+    if (key >= PREF_COUNT || defs[key].type != type) {
+        LV_LOG_WARN("prefs: bad key %d", key);
+        return false;
+    }
+    return true;
+}
+
+// --- Lifecycle ---
+void prefs_init(const prefs_backend_t *store) {
+    backend = store;
+    for (int i = 0; i < PREF_COUNT; i++) {
+        values[i] = defs[i].def;
+        dirty[i] = false;
+        if (backend && !backend->read(defs[i].name, defs[i].type, &values[i])) {
+            values[i] = defs[i].def;
+        }
+        if (defs[i].type == PREF_TYPE_STR) values[i].s[PREF_STR_MAX - 1] = '\0';
+    }
+    pending = false;
+}
+
+void prefs_flush(void) {
+    if (!pending) return;
+    pending = false;
+    if (write_timer) lv_timer_pause(write_timer);
+    if (backend == NULL) return;
+
+    for (int i = 0; i < PREF_COUNT; i++) {
+        if (!dirty[i]) continue;
+        dirty[i] = false;
+        backend->write(defs[i].name, defs[i].type, &values[i]);
+    }
+    if (backend->commit) backend->commit();
+}
+
+bool prefs_pending(void) {
+    return pending;
+}
+
+// --- Get ---
+int32_t prefs_get_int(pref_key_t key) {
+    return valid(key, PREF_TYPE_INT) ? values[key].i : 0;
+}
+
+bool prefs_get_bool(pref_key_t key) {
+    return valid(key, PREF_TYPE_BOOL) ? values[key].b : false;
+}
+
+const char *prefs_get_str(pref_key_t key) {
+    return valid(key, PREF_TYPE_STR) ? values[key].s : "";
+}
+
+// --- Set ---
+void prefs_set_int(pref_key_t key, int32_t value) {
+    if (!valid(key, PREF_TYPE_INT) || values[key].i == value) return;
+    values[key].i = value;
+    mark_dirty(key);
+}
+
+void prefs_set_bool(pref_key_t key, bool value) {
+    if (!valid(key, PREF_TYPE_BOOL) || values[key].b == value) return;
+    values[key].b = value;
+    mark_dirty(key);
+}
+
+void prefs_set_str(pref_key_t key, const char *value) {
+    if (!valid(key, PREF_TYPE_STR)) return;
+    if (value == NULL) value = "";
+    if (strncmp(values[key].s, value, PREF_STR_MAX - 1) == 0) return;
+    if (strlen(value) >= PREF_STR_MAX) {
+        LV_LOG_WARN("prefs: %s truncated", defs[key].name);
+    }
+    strncpy(values[key].s, value, PREF_STR_MAX - 1);
+    values[key].s[PREF_STR_MAX - 1] = '\0';
+    mark_dirty(key);
+}
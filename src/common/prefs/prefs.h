@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// changes are written this long after the last one
+#define PREFS_WRITE_DELAY 3000
+// longest string value, including the terminator
+#define PREF_STR_MAX 64
+
+typedef enum {
+    PREF_TYPE_INT = 0,
+    PREF_TYPE_BOOL,
+    PREF_TYPE_STR
+} pref_type_t;
+
+/*
+ * Every stored setting. The name, type and default of each key are in the
+ * table in prefs.c, names are the NVS keys used by earlier firmware.
+ */
+typedef enum {
+    PREF_ROTATE = 0,        // int, display rotation index
+    PREF_TIMEOUT,           // int, screen timeout index
+    PREF_BRIGHTNESS,        // int, backlight slider value
+    PREF_WATCHFACE,         // int, built-in face index
+    PREF_CUSTOM_FACE,       // str, custom face path, empty for none
+    PREF_CIRCULAR,          // bool, circular scrolling
+    PREF_ALERTS,            // bool
+    PREF_AUTONAV,           // bool, open navigation automatically
+    PREF_ALERT_STATES,      // int, alert bitmask
+    PREF_RACING_HIGH,       // int
+    PREF_SIMON_HIGH,        // int
+    PREF_COUNT
+} pref_key_t;
+
+typedef union {
+    int32_t i;
+    bool b;
+    char s[PREF_STR_MAX];
+} pref_value_t;
+
+/*
+ * Storage behind the cache. read returns false for keys that were never
+ * stored so the default is used. commit is called after a flush wrote its
+ * keys and may be NULL.
+ */
+typedef struct {
+    bool (*read)(const char *name, pref_type_t type, pref_value_t *value);
+    void (*write)(const char *name, pref_type_t type, const pref_value_t *value);
+    void (*commit)(void);
+} prefs_backend_t;
+
+/*
+ * Loads every key into RAM, call once before the first get. Can run before
+ * lv_init, the write timer is only created on the first change.
+ */
+void prefs_init(const prefs_backend_t *backend);
+
+int32_t prefs_get_int(pref_key_t key);
+bool prefs_get_bool(pref_key_t key);
+const char *prefs_get_str(pref_key_t key);
+
+/*
+ * Update the cached value. Storage is written PREFS_WRITE_DELAY after the
+ * last change, so a slider drag costs one write. Setting the current value
+ * does nothing.
+ */
+void prefs_set_int(pref_key_t key, int32_t value);
+void prefs_set_bool(pref_key_t key, bool value);
+void prefs_set_str(pref_key_t key, const char *value);
+
+// write pending changes now, call before the screen turns off or a restart
+void prefs_flush(void);
+bool prefs_pending(void);
+
+/*
+ * Backend keeping all keys as "name=value" lines in one file, for HALs
+ * without NVS. load fills buf and returns the length, 0 when there is no
+ * file. save replaces the file and returns false on failure.
+ */
+const prefs_backend_t *prefs_text_backend(size_t (*load)(char *buf, size_t size),
+                                          bool (*save)(const char *buf, size_t len));
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,123 @@
+#include "prefs.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// keys kept from the file, unknown names are written back unchanged
+#define TEXT_MAX_ENTRIES 32
+#define TEXT_NAME_MAX 16
+#define TEXT_FILE_MAX (TEXT_MAX_ENTRIES * (TEXT_NAME_MAX + PREF_STR_MAX + 2))
+
+typedef struct {
+    char name[TEXT_NAME_MAX];
+    char value[PREF_STR_MAX];
+} text_entry_t;
+
+static text_entry_t entries[TEXT_MAX_ENTRIES];
+static uint8_t entry_count = 0;
+static char file_buf[TEXT_FILE_MAX];
+
+static size_t (*load_cb)(char *buf, size_t size) = NULL;
+static bool (*save_cb)(const char *buf, size_t len) = NULL;
+
+// copy up to a delimiter, always terminated
+static const char *copy_until(char *dst, size_t size, const char *src, char end) {
+    size_t n = 0;
+    while (*src && *src != end && *src != '\n' && *src != '\r') {
+        if (n < size - 1) dst[n++] = *src;
+        src++;
+    }
+    dst[n] = '\0';
+    return src;
+}
+
+static void parse(const char *text) {
+    entry_count = 0;
+    while (*text && entry_count < TEXT_MAX_ENTRIES) {
+        text_entry_t *entry = &entries[entry_count];
+        text = copy_until(entry->name, sizeof(entry->name), text, '=');
+        if (*text == '=') {
+            text = copy_until(entry->value, sizeof(entry->value), text + 1, '\n');
+            if (entry->name[0]) entry_count++;
+        }
+        while (*text && *text != '\n') text++;
+        if (*text) text++;
+    }
+}
+
+static text_entry_t *find(const char *name) {
+    for (int i = 0; i < entry_count; i++) {
+        if (strcmp(entries[i].name, name) == 0) return &entries[i];
+    }
+    return NULL;
+}
+
+// --- Backend ---
+static bool text_read(const char *name, pref_type_t type, pref_value_t *value) {
+    const text_entry_t *entry = find(name);
+    if (entry == NULL) return false;
+    switch (type) {
+    case PREF_TYPE_INT:
+        value->i = (int32_t)strtol(entry->value, NULL, 0);
+        break;
+    case PREF_TYPE_BOOL:
+        value->b = strcmp(entry->value, "1") == 0 || strcmp(entry->value, "true") == 0;
+        break;
+    case PREF_TYPE_STR:
+        strncpy(value->s, entry->value, PREF_STR_MAX - 1);
+        value->s[PREF_STR_MAX - 1] = '\0';
+        break;
+    }
+    return true;
+}
+
+static void text_write(const char *name, pref_type_t type, const pref_value_t *value) {
+    text_entry_t *entry = find(name);
+    if (entry == NULL) {
+        if (entry_count >= TEXT_MAX_ENTRIES) return;
+        entry = &entries[entry_count++];
+        strncpy(entry->name, name, TEXT_NAME_MAX - 1);
+        entry->name[TEXT_NAME_MAX - 1] = '\0';
+    }
+    switch (type) {
+    case PREF_TYPE_INT:
+        snprintf(entry->value, sizeof(entry->value), "%ld", (long)value->i);
+        break;
+    case PREF_TYPE_BOOL:
+        snprintf(entry->value, sizeof(entry->value), "%d", value->b ? 1 : 0);
+        break;
+    case PREF_TYPE_STR:
+        // values are single lines
+        copy_until(entry->value, sizeof(entry->value), value->s, '\0');
+        break;
+    }
+}
+
+static void text_commit(void) {
+    size_t len = 0;
+    for (int i = 0; i < entry_count; i++) {
+        int n = snprintf(file_buf + len, sizeof(file_buf) - len, "%s=%s\n", entries[i].name, entries[i].value);
+        if (n < 0 || len + n >= sizeof(file_buf)) break;
+        len += n;
+    }
+    if (save_cb && !save_cb(file_buf, len)) {
+        LV_LOG_WARN("prefs: failed to save");
+    }
+}
+
+static const prefs_backend_t text_backend = {
+    .read = text_read,
+    .write = text_write,
+    .commit = text_commit,
+};
+
+const prefs_backend_t *prefs_text_backend(size_t (*load)(char *buf, size_t size),
+                                          bool (*save)(const char *buf, size_t len)) {
+    load_cb = load;
+    save_cb = save;
+
+    size_t len = load_cb ? load_cb(file_buf, sizeof(file_buf) - 1) : 0;
+    file_buf[len < sizeof(file_buf) ? len : sizeof(file_buf) - 1] = '\0';
+    parse(file_buf);
+    return &text_backend;
+}
@@ -0,0 +1,242 @@
+#include "screen_transition.h"
+
+// progress of one transition, 0 shows the old screen, STEPS the new one
+#define STEPS 1024
+#define CF LV_COLOR_FORMAT_RGB565
+
+typedef struct {
+    lv_draw_buf_t buf;
+    void *raw;
+    uint32_t size;
+} frame_t;
+
+static void *(*alloc_cb)(size_t size) = NULL;
+static void (*free_cb)(void *ptr) = NULL;
+
+static frame_t from_frame;
+static frame_t to_frame;
+
+static lv_obj_t *stage = NULL;
+static lv_obj_t *from_img = NULL;
+static lv_obj_t *to_img = NULL;
+static lv_screen_load_anim_t mode;
+
+static void frame_release(frame_t *frame) {
+    if (frame->raw) free_cb(frame->raw);
+    lv_memzero(frame, sizeof(frame_t));
+}
+
+// a failed transition gives its memory back, only complete pairs stay cached
+static void frames_release(void) {
+    lv_image_cache_drop(&from_frame.buf);
+    lv_image_cache_drop(&to_frame.buf);
+    frame_release(&from_frame);
+    frame_release(&to_frame);
+}
+
+// sized for the display as it is now, rotation can swap the sides
+static bool frame_prepare(frame_t *frame, int32_t w, int32_t h) {
+    uint32_t stride = lv_draw_buf_width_to_stride(w, CF);
+    uint32_t size = stride * h;
+    if (frame->size < size) {
+        if (frame->raw) free_cb(frame->raw);
+        frame->raw = alloc_cb(size + LV_DRAW_BUF_ALIGN);
+        frame->size = frame->raw ? size : 0;
+        if (frame->raw == NULL) return false;
+    }
+    // the image cache must not keep the size or content of the last one
+    lv_image_cache_drop(&frame->buf);
+    return lv_draw_buf_init(&frame->buf, w, h, CF, stride, lv_draw_buf_align(frame->raw, CF), size) == LV_RESULT_OK;
+}
+
+static bool supported(lv_screen_load_anim_t anim) {
+    switch (anim) {
+    case LV_SCR_LOAD_ANIM_OVER_LEFT:
+    case LV_SCR_LOAD_ANIM_OVER_RIGHT:
+    case LV_SCR_LOAD_ANIM_OVER_TOP:
+    case LV_SCR_LOAD_ANIM_OVER_BOTTOM:
+    case LV_SCR_LOAD_ANIM_MOVE_LEFT:
+    case LV_SCR_LOAD_ANIM_MOVE_RIGHT:
+    case LV_SCR_LOAD_ANIM_MOVE_TOP:
+    case LV_SCR_LOAD_ANIM_MOVE_BOTTOM:
+    case LV_SCR_LOAD_ANIM_OUT_LEFT:
+    case LV_SCR_LOAD_ANIM_OUT_RIGHT:
+    case LV_SCR_LOAD_ANIM_OUT_TOP:
+    case LV_SCR_LOAD_ANIM_OUT_BOTTOM:
+    case LV_SCR_LOAD_ANIM_FADE_IN:
+    case LV_SCR_LOAD_ANIM_FADE_OUT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// --- Animation ---
+static void place(int32_t p) {
+    int32_t w = lv_obj_get_width(stage);
+    int32_t h = lv_obj_get_height(stage);
+    // offset of a screen coming in, and of one going out
+    int32_t in_x = 0, in_y = 0, out_x = 0, out_y = 0;
+
+    switch (mode) {
+    case LV_SCR_LOAD_ANIM_MOVE_LEFT:
+        out_x = -w * p / STEPS;
+        in_x = w + out_x;
+        break;
+    case LV_SCR_LOAD_ANIM_MOVE_RIGHT:
+        out_x = w * p / STEPS;
+        in_x = out_x - w;
+        break;
+    case LV_SCR_LOAD_ANIM_MOVE_TOP:
+        out_y = -h * p / STEPS;
+        in_y = h + out_y;
+        break;
+    case LV_SCR_LOAD_ANIM_MOVE_BOTTOM:
+        out_y = h * p / STEPS;
+        in_y = out_y - h;
+        break;
+    case LV_SCR_LOAD_ANIM_OVER_LEFT:
+        in_x = w - w * p / STEPS;
+        break;
+    case LV_SCR_LOAD_ANIM_OVER_RIGHT:
+        in_x = w * p / STEPS - w;
+        break;
+    case LV_SCR_LOAD_ANIM_OVER_TOP:
+        in_y = h - h * p / STEPS;
+        break;
+    case LV_SCR_LOAD_ANIM_OVER_BOTTOM:
+        in_y = h * p / STEPS - h;
+        break;
+    case LV_SCR_LOAD_ANIM_OUT_LEFT:
+        out_x = -w * p / STEPS;
+        break;
+    case LV_SCR_LOAD_ANIM_OUT_RIGHT:
+        out_x = w * p / STEPS;
+        break;
+    case LV_SCR_LOAD_ANIM_OUT_TOP:
+        out_y = -h * p / STEPS;
+        break;
+    case LV_SCR_LOAD_ANIM_OUT_BOTTOM:
+        out_y = h * p / STEPS;
+        break;
+    case LV_SCR_LOAD_ANIM_FADE_IN:
+        lv_obj_set_style_image_opa(to_img, (lv_opa_t)(LV_OPA_COVER * p / STEPS), 0);
+        break;
+    case LV_SCR_LOAD_ANIM_FADE_OUT:
+        lv_obj_set_style_image_opa(from_img, (lv_opa_t)(LV_OPA_COVER - LV_OPA_COVER * p / STEPS), 0);
+        break;
+    default:
+        break;
+    }
+    lv_obj_set_pos(from_img, out_x, out_y);
+    lv_obj_set_pos(to_img, in_x, in_y);
+}
+
+static void anim_cb(void *var, int32_t v) {
+    LV_UNUSED(var);
+    place(v);
+}
+
+static void anim_completed_cb(lv_anim_t *a) {
+    LV_UNUSED(a);
+    screen_transition_finish();
+}
+
+// the new screen was deleted with the stage on it
+static void stage_delete_cb(lv_event_t *e) {
+    if (lv_event_get_target(e) != stage) return;
+    stage = NULL;
+    from_img = NULL;
+    to_img = NULL;
+}
+
+static lv_obj_t *frame_image(lv_obj_t *parent, frame_t *frame) {
+    lv_obj_t *img = lv_image_create(parent);
+    lv_image_set_src(img, &frame->buf);
+    lv_obj_add_flag(img, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_remove_flag(img, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    return img;
+}
+
+// --- Transitions ---
+void screen_transition_load(lv_obj_t *target, lv_screen_load_anim_t anim, uint32_t time, uint32_t delay) {
+    if (target == NULL) return;
+    screen_transition_finish();
+
+    lv_display_t *disp = lv_obj_get_display(target);
+    lv_obj_t *active = lv_display_get_screen_active(disp);
+    // lvgl is animating a screen change of its own
+    bool busy = lv_display_get_screen_prev(disp) != NULL;
+    if (!supported(anim) || time == 0 || target == active || active == NULL || busy || alloc_cb == NULL) {
+        lv_screen_load_anim(target, anim, time, delay, false);
+        return;
+    }
+
+    int32_t w = lv_display_get_horizontal_resolution(disp);
+    int32_t h = lv_display_get_vertical_resolution(disp);
+    if (!frame_prepare(&from_frame, w, h) || !frame_prepare(&to_frame, w, h) ||
+        lv_snapshot_take_to_draw_buf(active, CF, &from_frame.buf) != LV_RESULT_OK) {
+        LV_LOG_WARN("screen_transition: no memory for the frames");
+        frames_release();
+        lv_screen_load_anim(target, anim, time, delay, false);
+        return;
+    }
+
+    // load handlers fill the new screen before it is captured
+    lv_screen_load(target);
+    lv_obj_update_layout(target);
+    if (lv_snapshot_take_to_draw_buf(target, CF, &to_frame.buf) != LV_RESULT_OK) {
+        frames_release();
+        return;
+    }
+
+    stage = lv_obj_create(target);
+    lv_obj_remove_style_all(stage);
+    lv_obj_set_size(stage, w, h);
+    lv_obj_set_style_bg_color(stage, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(stage, LV_OPA_COVER, 0);
+    lv_obj_add_flag(stage, LV_OBJ_FLAG_FLOATING);
+    lv_obj_remove_flag(stage, LV_OBJ_FLAG_SCROLLABLE);
+    // presses during the animation land here instead of the hidden widgets
+    lv_obj_add_flag(stage, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(stage, stage_delete_cb, LV_EVENT_DELETE, NULL);
+    lv_obj_move_foreground(stage);
+
+    from_img = frame_image(stage, &from_frame);
+    to_img = frame_image(stage, &to_frame);
+    // screens going out or fading out stay on top
+    bool out = anim == LV_SCR_LOAD_ANIM_FADE_OUT || (anim >= LV_SCR_LOAD_ANIM_OUT_LEFT && anim <= LV_SCR_LOAD_ANIM_OUT_BOTTOM);
+    if (out) lv_obj_move_foreground(from_img);
+    if (anim == LV_SCR_LOAD_ANIM_FADE_IN) lv_obj_set_style_image_opa(to_img, LV_OPA_TRANSP, 0);
+    mode = anim;
+    place(0);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, stage);
+    lv_anim_set_values(&a, 0, STEPS);
+    lv_anim_set_duration(&a, time);
+    lv_anim_set_delay(&a, delay);
+    lv_anim_set_exec_cb(&a, anim_cb);
+    lv_anim_set_completed_cb(&a, anim_completed_cb);
+    lv_anim_start(&a);
+}
+
+void screen_transition_finish(void) {
+    if (stage == NULL) return;
+    lv_anim_delete(stage, anim_cb);
+    // this can run from an event of the stage itself, so it goes later,
+    // hidden it is already out of the next snapshot
+    lv_obj_add_flag(stage, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_delete_async(stage);
+    stage = NULL;
+    from_img = NULL;
+    to_img = NULL;
+}
+
+void screen_transition_set_alloc(void *(*alloc)(size_t size), void (*free)(void *ptr)) {
+    screen_transition_finish();
+    if (free_cb) frames_release();
+    alloc_cb = free ? alloc : NULL;
+    free_cb = alloc ? free : NULL;
+}
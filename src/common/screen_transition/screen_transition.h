@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Screen changes that animate two bitmaps instead of two live screens. The
+ * outgoing screen and the incoming one are each drawn once into an RGB565
+ * buffer of the display size, then an opaque layer on top of the new screen
+ * slides or fades the two images. The renderer starts from that layer, so a
+ * frame is two image copies however heavy the screens below are. The layer
+ * is removed when the animation ends and the live screen shows again.
+ *
+ * The new screen is loaded right away (all load and unload events are sent
+ * before the animation, its content is what gets captured), so updates that
+ * arrive during the animation show once it ends.
+ */
+
+// loads target like lv_screen_load_anim, which it falls back to when the
+// animation is not a move, over, out or fade one, no allocator is set or
+// there is no memory
+void screen_transition_load(lv_obj_t *target, lv_screen_load_anim_t anim, uint32_t time, uint32_t delay);
+
+// ends a running transition on its last frame
+void screen_transition_finish(void);
+
+/*
+ * Where the two buffers come from. Two full screen frames are too much for
+ * the LVGL heap, so there is no default and screens animate live until the
+ * HAL sets one, PSRAM on the boards that have it. The buffers are kept for
+ * later transitions once both are in place, a failed transition frees them.
+ */
+void screen_transition_set_alloc(void *(*alloc)(size_t size), void (*free)(void *ptr));
+
+#ifdef __cplusplus
+}
+#endif
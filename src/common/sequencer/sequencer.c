@@ -0,0 +1,150 @@
+#include "sequencer.h"
+
+typedef enum {
+    SEQ_STATE_ON = 0,
+    SEQ_STATE_OFF,
+    SEQ_TONE,
+    SEQ_CALL
+} seq_type_t;
+
+typedef struct {
+    uint32_t at;
+    seq_type_t type;
+    union {
+        struct {
+            lv_obj_t *obj;
+            lv_state_t state;
+        } state;
+        struct {
+            uint16_t pitch;
+            uint16_t duration;
+        } tone;
+        struct {
+            sequencer_call_cb_t cb;
+            void *user_data;
+        } call;
+    };
+} seq_action_t;
+
+static seq_action_t actions[SEQUENCER_MAX_ACTIONS];
+static uint16_t action_count = 0;
+static uint16_t next_action = 0;
+
+static lv_timer_t *timer = NULL;
+static uint32_t start_tick = 0;
+static bool playing = false;
+// bumped on start/clear so a call action can rebuild the timeline
+static uint32_t generation = 0;
+static sequencer_tone_cb_t tone_cb = NULL;
+
+static void run_action(const seq_action_t *action) {
+    switch (action->type) {
+    case SEQ_STATE_ON:
+        lv_obj_add_state(action->state.obj, action->state.state);
+        break;
+    case SEQ_STATE_OFF:
+        lv_obj_remove_state(action->state.obj, action->state.state);
+        break;
+    case SEQ_TONE:
+        if (tone_cb) tone_cb(action->tone.pitch, action->tone.duration);
+        break;
+    case SEQ_CALL:
+        action->call.cb(action->call.user_data);
+        break;
+    }
+}
+
+// arm the timer for the next pending action, or park it
+static void schedule(void) {
+    if (!playing || next_action >= action_count) {
+        playing = false;
+        lv_timer_pause(timer);
+        return;
+    }
+    uint32_t elapsed = lv_tick_elaps(start_tick);
+    uint32_t at = actions[next_action].at;
+    lv_timer_set_period(timer, at > elapsed ? at - elapsed : 0);
+    lv_timer_reset(timer);
+    lv_timer_resume(timer);
+}
+
+static void timer_cb(lv_timer_t *t) {
+    (void)t;
+    uint32_t elapsed = lv_tick_elaps(start_tick);
+    uint32_t gen = generation;
+    // everything that is due fires in the same frame
+    while (playing && next_action < action_count && actions[next_action].at <= elapsed) {
+        run_action(&actions[next_action++]);
+        if (gen != generation) return; // restarted or cleared, already scheduled
+    }
+    schedule();
+}
+
+static seq_action_t *add_action(uint32_t at, seq_type_t type) {
+    if (action_count >= SEQUENCER_MAX_ACTIONS) {
+        LV_LOG_WARN("sequencer: action dropped");
+        return NULL;
+    }
+    if (action_count > 0 && at < actions[action_count - 1].at) {
+        LV_LOG_WARN("sequencer: actions must be added in time order");
+        return NULL;
+    }
+    seq_action_t *action = &actions[action_count++];
+    action->at = at;
+    action->type = type;
+    return action;
+}
+
+void sequencer_set_tone_cb(sequencer_tone_cb_t cb) {
+    tone_cb = cb;
+}
+
+// --- Timeline ---
+bool sequencer_add_state(uint32_t at, lv_obj_t *obj, lv_state_t state, bool on) {
+    seq_action_t *action = add_action(at, on ? SEQ_STATE_ON : SEQ_STATE_OFF);
+    if (action == NULL) return false;
+    action->state.obj = obj;
+    action->state.state = state;
+    return true;
+}
+
+bool sequencer_add_tone(uint32_t at, uint16_t pitch, uint16_t duration) {
+    seq_action_t *action = add_action(at, SEQ_TONE);
+    if (action == NULL) return false;
+    action->tone.pitch = pitch;
+    action->tone.duration = duration;
+    return true;
+}
+
+bool sequencer_add_call(uint32_t at, sequencer_call_cb_t cb, void *user_data) {
+    if (cb == NULL) return false;
+    seq_action_t *action = add_action(at, SEQ_CALL);
+    if (action == NULL) return false;
+    action->call.cb = cb;
+    action->call.user_data = user_data;
+    return true;
+}
+
+// --- Playback ---
+void sequencer_start(void) {
+    if (timer == NULL) {
+        timer = lv_timer_create(timer_cb, 0, NULL);
+    }
+    start_tick = lv_tick_get();
+    next_action = 0;
+    playing = true;
+    generation++;
+    schedule();
+}
+
+void sequencer_clear(void) {
+    playing = false;
+    action_count = 0;
+    next_action = 0;
+    generation++;
+    if (timer) lv_timer_pause(timer);
+}
+
+bool sequencer_busy(void) {
+    return playing;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// actions in the shared pool, a 50 step Simon round takes 2 + 3 * 50
+#define SEQUENCER_MAX_ACTIONS 160
+
+typedef void (*sequencer_tone_cb_t)(uint16_t pitch, uint16_t duration);
+typedef void (*sequencer_call_cb_t)(void *user_data);
+
+/*
+ * Timeline of actions played back by one persistent lv_timer. Actions are
+ * stored in a static pool and fire in the LVGL thread at their offset (ms)
+ * from sequencer_start. They must be added in time order.
+ *
+ * Only one timeline plays at a time, it belongs to the foreground game/app.
+ * Clear it before building a new one and when the screen that owns the
+ * objects is unloaded. A call action may clear and start a new timeline.
+ */
+void sequencer_set_tone_cb(sequencer_tone_cb_t cb);
+
+bool sequencer_add_state(uint32_t at, lv_obj_t *obj, lv_state_t state, bool on);
+bool sequencer_add_tone(uint32_t at, uint16_t pitch, uint16_t duration);
+bool sequencer_add_call(uint32_t at, sequencer_call_cb_t cb, void *user_data);
+
+void sequencer_start(void);
+// stop playback and drop all actions
+void sequencer_clear(void);
+bool sequencer_busy(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,161 @@
+#include <string.h>
+#include "state_store.h"
+
+
+#define MAX_STATE_SUBS 24
+
+typedef struct {
+    state_event_cb_t cb;
+    lv_obj_t **screen;
+    state_topic_t topic;
+    bool pending;
+} state_sub_t;
+
+static state_sub_t subs[MAX_STATE_SUBS] = {0};
+static state_value_t values[STATE_TOPIC_COUNT] = {0};
+
+static bool dirty = false;
+static lv_obj_t *last_screen = NULL;
+
+static void (*lock_cb)(void) = NULL;
+static void (*unlock_cb)(void) = NULL;
+
+static void lock(void) {
+    if (lock_cb) lock_cb();
+}
+
+static void unlock(void) {
+    if (unlock_cb) unlock_cb();
+}
+
+// compared bytes per topic, the rest of the union is ignored
+static const uint8_t topic_size[STATE_TOPIC_COUNT] = {
+    [STATE_TOPIC_CLOCK] = sizeof(state_clock_t),
+    [STATE_TOPIC_TIME_SYNC] = sizeof(uint32_t),
+    [STATE_TOPIC_WEATHER] = sizeof(state_weather_t),
+    [STATE_TOPIC_FORECAST] = sizeof(uint32_t),
+    [STATE_TOPIC_NOTIFICATIONS] = sizeof(uint32_t),
+    [STATE_TOPIC_NAVIGATION] = sizeof(uint32_t),
+    [STATE_TOPIC_NAV_ICON] = sizeof(uint32_t),
+    [STATE_TOPIC_PHONE_BATTERY] = sizeof(state_battery_t),
+    [STATE_TOPIC_CONNECTION] = sizeof(bool),
+};
+
+static void mark_pending(state_topic_t topic) {
+    for (int i = 0; i < MAX_STATE_SUBS; i++) {
+        if (subs[i].cb && subs[i].topic == topic) {
+            subs[i].pending = true;
+            dirty = true;
+        }
+    }
+}
+
+static bool is_live(const state_sub_t *sub, lv_obj_t *active) {
+    return sub->screen == NULL || (*sub->screen != NULL && *sub->screen == active);
+}
+
+// takes the pending change under the lock, calls the subscriber outside it
+static void deliver(state_sub_t *sub) {
+    lock();
+    bool pending = sub->pending;
+    state_value_t value = values[sub->topic];
+    sub->pending = false;
+    unlock();
+    if (pending) sub->cb(sub->topic, &value);
+}
+
+// --- Subscriptions ---
+void state_store_set_lock(void (*lock)(void), void (*unlock)(void)) {
+    lock_cb = lock;
+    unlock_cb = unlock;
+}
+
+void state_store_add_sub(state_topic_t topic, state_event_cb_t cb, lv_obj_t **screen) {
+    lock();
+    for (int i = 0; i < MAX_STATE_SUBS; i++) {
+        if (subs[i].cb == NULL) {
+            subs[i].cb = cb;
+            subs[i].screen = screen;
+            subs[i].topic = topic;
+            subs[i].pending = false;
+            break;
+        }
+    }
+    unlock();
+}
+
+void state_store_remove_sub(state_topic_t topic, state_event_cb_t cb) {
+    lock();
+    for (int i = 0; i < MAX_STATE_SUBS; i++) {
+        if (subs[i].cb == cb && subs[i].topic == topic) {
+            subs[i].cb = NULL;
+            subs[i].pending = false;
+            break;
+        }
+    }
+    unlock();
+}
+
+// --- Publish ---
+void state_store_publish(state_topic_t topic, const state_value_t *value) {
+    if (topic >= STATE_TOPIC_COUNT) return;
+    lock();
+    if (memcmp(&values[topic], value, topic_size[topic]) != 0) {
+        memcpy(&values[topic], value, topic_size[topic]);
+        mark_pending(topic);
+    }
+    unlock();
+}
+
+void state_store_bump(state_topic_t topic) {
+    if (topic >= STATE_TOPIC_COUNT) return;
+    lock();
+    values[topic].revision++;
+    mark_pending(topic);
+    unlock();
+}
+
+void state_store_refresh(state_topic_t topic) {
+    if (topic >= STATE_TOPIC_COUNT) return;
+    lock();
+    mark_pending(topic);
+    unlock();
+}
+
+state_value_t state_store_get(state_topic_t topic) {
+    state_value_t value;
+    memset(&value, 0, sizeof(value));
+    if (topic >= STATE_TOPIC_COUNT) return value;
+    lock();
+    value = values[topic];
+    unlock();
+    return value;
+}
+
+// --- Dispatch ---
+void state_store_dispatch(void) {
+    lv_obj_t *active = lv_screen_active();
+    lock();
+    bool changed = dirty;
+    dirty = false;
+    unlock();
+    if (!changed && active == last_screen) return;
+
+    last_screen = active;
+    for (int i = 0; i < MAX_STATE_SUBS; i++) {
+        if (subs[i].cb && subs[i].pending) {
+            if (is_live(&subs[i], active)) {
+                deliver(&subs[i]);
+            }
+        }
+    }
+}
+
+void state_store_flush_screen(lv_obj_t *screen) {
+    if (screen == NULL) return;
+    for (int i = 0; i < MAX_STATE_SUBS; i++) {
+        if (subs[i].cb && subs[i].pending && subs[i].screen && *subs[i].screen == screen) {
+            deliver(&subs[i]);
+        }
+    }
+}
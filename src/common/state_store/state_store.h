@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Data topics published by the HAL. Each topic keeps its last value and
+ * subscribers are only called when a publish actually changes it.
+ */
+typedef enum {
+    STATE_TOPIC_CLOCK = 0,      // clock (local time, second resolution)
+    STATE_TOPIC_TIME_SYNC,      // revision, bumped when time is synced from the phone
+    STATE_TOPIC_WEATHER,        // weather (current conditions)
+    STATE_TOPIC_FORECAST,       // revision, bumped when the full forecast is received
+    STATE_TOPIC_NOTIFICATIONS,  // revision, bumped on every received notification
+    STATE_TOPIC_NAVIGATION,     // revision, bumped when navigation data changes
+    STATE_TOPIC_NAV_ICON,       // revision, bumped when a navigation icon is received
+    STATE_TOPIC_PHONE_BATTERY,  // battery
+    STATE_TOPIC_CONNECTION,     // connected
+    STATE_TOPIC_COUNT
+} state_topic_t;
+
+typedef struct {
+    uint8_t second;
+    uint8_t minute;
+    uint8_t hour;
+    uint8_t day;
+    uint8_t month;
+    uint8_t weekday;
+    uint16_t year;
+} state_clock_t;
+
+typedef struct {
+    int16_t temp;
+    int16_t icon;
+} state_weather_t;
+
+typedef struct {
+    uint8_t level;
+    bool charging;
+} state_battery_t;
+
+typedef union {
+    state_clock_t clock;
+    state_weather_t weather;
+    state_battery_t battery;
+    bool connected;
+    uint32_t revision;
+} state_value_t;
+
+typedef void (*state_event_cb_t)(state_topic_t topic, const state_value_t *value);
+
+/*
+ * screen: address of the screen pointer the subscriber draws on, or NULL to
+ * always deliver. Changes published while that screen is not active are held
+ * and delivered once it becomes active. Subscribers only see changes made
+ * after they were added, use state_store_refresh to get the current value.
+ */
+void state_store_add_sub(state_topic_t topic, state_event_cb_t cb, lv_obj_t **screen);
+void state_store_remove_sub(state_topic_t topic, state_event_cb_t cb);
+
+/*
+ * Publishing can happen on another task than dispatch (BLE callbacks on the
+ * watch). The HAL passes a lock that is held while values and pending flags
+ * change and while dispatch copies them out; subscribers are called with
+ * the copy and without the lock. Without a lock everything runs on one task.
+ */
+void state_store_set_lock(void (*lock)(void), void (*unlock)(void));
+
+void state_store_publish(state_topic_t topic, const state_value_t *value);
+void state_store_bump(state_topic_t topic);
+void state_store_refresh(state_topic_t topic);
+// a copy of the current value
+state_value_t state_store_get(state_topic_t topic);
+
+void state_store_dispatch(void);
+void state_store_flush_screen(lv_obj_t *screen);
+
+#ifdef __cplusplus
+}
+#endif
@@ -78,9 +78,10 @@ void init_face_1041(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_add_flag(face_1041_33_205280, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_1041_33_205280, LV_OBJ_FLAG_SCROLLABLE );
 	lv_image_set_pivot(face_1041_33_205280, 14, 115);
+	face_compositor_static(face_1041_0_984);
 
 
-    callback("1041", &face_1041_dial_img_preview_0, &face_1041, &face_1041_33_205280);
+    callback("1041", NULL, &face_1041, &face_1041_33_205280);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_1041 // (1041) uncomment to enable or define it elsewhere
 
@@ -29,8 +30,6 @@ extern "C"
 	LV_IMG_DECLARE(face_1041_dial_img_1_70612_0);
 	LV_IMG_DECLARE(face_1041_dial_img_17_117033_0);
 	LV_IMG_DECLARE(face_1041_dial_img_33_205280_0);
-	LV_IMG_DECLARE(face_1041_dial_img_preview_0);
-	LV_IMG_DECLARE(face_1041_dial_img_preview_0);
 
 
 #endif
@@ -5,6 +5,7 @@
 // Watchface: 1041
 
 #include "../1041.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,2173 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1041_dial_img_0_984_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x43,0x10,0x48,0x39,0x6E,0x51,0xB4,0x6A,0x58,0x83,0x58,0x83,0xBD,0xA3,0xBD,0xA3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,
-	0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0xFD,0x9A,0xBD,0x8A,0x5B,0x82,0x59,0x92,0x17,0x82,0x59,0x92,0x17,0x82,0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0xFA,0xBA,0x3C,0xCB,0x5D,0xD3,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x3E,0xA3,0xFD,0x9A,0x17,0x82,0x95,0x59,0x6E,0x51,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x0E,0x41,
-	0x6E,0x51,0x6E,0x51,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x95,0x59,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x39,0x72,0xF5,0x69,0x39,0x72,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x95,0x59,0x14,0x4A,0xB1,0x49,0xB1,0x49,0x0E,0x41,0x0B,0x39,0xCA,0x28,0xA8,0x18,0x66,0x10,0x25,0x08,0x23,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x4A,0x29,0xB4,0x6A,0x58,0x83,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,
-	0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0x5C,0x92,0x5B,0x82,0x59,0x92,0x5B,0x82,0x59,0x92,
-	0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0xFA,0xBA,0x3B,0xC3,0x3C,0xCB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,
-	0x5F,0xB3,0x5F,0xB3,0xFD,0x9A,0xFD,0x9A,0xF5,0x69,0x90,0x61,0x6E,0x51,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0xB1,0x49,0x90,0x61,0x95,0x59,0xB2,0x71,0x95,0x59,0x95,0x59,0xF5,0x69,0xF5,0x69,0xD9,0x61,0xF5,0x69,0x39,0x72,0xF5,0x69,0x39,0x72,0xD9,0x61,
-	0xF5,0x69,0xF5,0x69,0xF5,0x69,0x14,0x4A,0x14,0x4A,0xB1,0x49,0xB1,0x49,0x8E,0x31,0x0B,0x39,0xCA,0x28,0xA8,0x18,0x66,0x10,0x24,0x08,0x23,0x08,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x4B,0x49,0xB4,0x6A,0xBD,0xA3,0xBD,0xA3,0xBD,0xA3,
-	0xDF,0xB3,0xBD,0xA3,0xDF,0xAB,0xBD,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0x5F,0xB4,0xDF,0xCB,0x5F,0xC4,0x5F,0xC4,0xDF,0xCB,0x5F,0xC4,0x5F,0xC4,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,
-	0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0xDF,0x92,0xFD,0x9A,0xBC,0x9A,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0xDB,0xB2,0xFA,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0x5F,0xCB,0xDF,0xB3,0x5F,0xA3,0xFD,0x9A,0x39,0x72,0xF5,0x69,0xB1,0x49,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x4B,0x49,0x6E,0x51,
-	0x6E,0x51,0x90,0x61,0xB1,0x49,0xB2,0x71,0x95,0x59,0x95,0x59,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x14,0x4A,0xB1,0x49,0x51,0x41,0x8E,0x31,0xED,0x28,0xCA,0x28,0xA7,0x18,0x65,0x10,0x24,0x08,0x22,0x08,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x61,0x08,0x61,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x10,0xB4,0x6A,0xBD,0xA3,0xBF,0x9B,0xDF,0xAB,0x5F,0xA3,0xBD,0xA3,0xBD,0xA3,0xBD,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,
-	0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xBC,0x9A,0x5C,0x92,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,
-	0x99,0xAA,0xDB,0xB2,0xFA,0xBA,0x3B,0xC3,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,
-	0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xBF,0xDB,0xDF,0xCB,0xDF,0xB3,
-	0x5F,0xB3,0x3E,0xA3,0xBC,0x9A,0x17,0x82,0x95,0x59,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x4B,0x49,0x6E,0x51,0x6E,0x51,0xB1,0x49,0xB1,0x49,0xB2,0x71,0x95,0x59,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,
-	0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x14,0x4A,0xB1,0x49,0x6E,0x51,0x8E,0x31,0xCA,0x28,0xA8,0x18,0x66,0x10,0x24,0x08,0x23,0x08,0x22,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x18,0xB4,0x6A,0xBD,0xA3,0xBF,0x9B,0xBF,0x9B,0xDF,0xAB,0xBF,0x9B,0xDF,0xAB,0xBD,0xA3,0xDF,0xAB,
-	0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0x5F,0xB4,0x5F,0xC4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,
-	0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xFD,0x9A,0x5C,0x92,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x5C,0x92,0x59,0x92,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0x3B,0xC3,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0x3F,0xFD,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x5F,0xCB,0x5F,0xB3,0x3E,0xBB,0xFD,0x9A,0x17,0x82,0xF5,0x69,0x90,0x61,0x6E,0x51,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x4B,0x49,0x8E,0x31,0x6E,0x51,0x6E,0x51,
-	0x90,0x61,0xB1,0x49,0xB1,0x49,0x95,0x59,0xB2,0x71,0xF5,0x69,0xF5,0x69,0x39,0x72,0xF5,0x69,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x5B,0x82,0x39,0x72,0x5B,0x82,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,0xF5,0x69,0x95,0x59,0x14,0x4A,0xB1,0x49,0xB1,0x49,0x0E,0x41,0x0B,0x39,0xCA,0x28,0xA7,0x18,
-	0x65,0x10,0x23,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0xB4,0x6A,0xBD,0xA3,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0x5F,0xC4,0xDF,0xB3,
-	0x5F,0xB4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0x5F,0xB4,0x5F,0xC4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0xFD,0x9A,0xBC,0x9A,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xFA,0xBA,
-	0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,
-	0x3F,0xFD,0x3F,0xFD,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0x5F,0xCB,0xDF,0xCB,0x5F,0xB3,
-	0x3E,0xA3,0x59,0x92,0xF5,0x69,0xB2,0x71,0xB1,0x49,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0xB2,0x71,0xB2,0x71,0x95,0x59,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x39,0x72,0x39,0x72,0x39,0x72,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0xBC,0x7A,
-	0x5B,0x82,0xBC,0x7A,0x5B,0x82,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,0xF5,0x69,0xF5,0x69,0x95,0x59,0x14,0x4A,0xB1,0x49,0xB1,0x49,0x8E,0x31,0xCA,0x28,0xA8,0x18,0x65,0x10,0x24,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x3A,0xBD,0xA3,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,
-	0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,
-	0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xFD,0x9A,0x5C,0x92,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xFA,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0x5F,0xCB,0x5F,0xCB,0x3E,0xBB,0x3E,0xA3,0x59,0x92,0x17,0x82,0xF5,0x69,0x90,0x61,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x4B,0x49,0x0B,0x39,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,
-	0xB1,0x49,0xB1,0x49,0xB2,0x71,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x39,0x72,0x17,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0xBD,0x8A,0xBD,0x8A,0xBD,0x8A,0xBD,0x8A,0x5B,0x82,0xBC,0x7A,0x5B,0x82,0xBC,0x7A,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x14,0x4A,0xB1,0x49,0x6E,0x51,
-	0x0B,0x39,0xCA,0x28,0x66,0x10,0x24,0x08,0x23,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x63,0x08,0x58,0x83,0x3F,0x9C,0xBD,0xA3,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0xBF,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,
-	0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0xBC,0x9A,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0xBC,0x9A,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xFA,0xBA,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,
-	0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0x5F,0xCB,0x3E,0xBB,0x3E,0xA3,0x59,0x92,
-	0x17,0x82,0xB2,0x71,0x90,0x61,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x90,0x61,0xB1,0x49,0xB1,0x49,0xB2,0x71,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0xBD,0x8A,0xBD,0x8A,0xBD,0x8A,0xBD,0x8A,0x5E,0x82,0xBD,0x8A,
-	0x5E,0x82,0xBD,0x8A,0xBD,0x8A,0x5E,0x82,0x1C,0x7A,0x5B,0x82,0xBC,0x7A,0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,0x39,0x72,0x14,0x4A,0xF5,0x69,0xB4,0x6A,0xB1,0x49,0x6E,0x51,0x8E,0x31,0x4A,0x29,0xA7,0x18,0x25,0x08,0x23,0x08,0x22,0x08,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x29,0xBD,0xA3,0x3F,0x94,0xBD,0xA3,0x3F,0x94,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xBD,0xA3,0x3F,0x9C,0xDF,0xAB,0xBD,0xA3,0x5F,0xB4,0xBD,0xA3,
-	0x5F,0xB4,0xBD,0xA3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,
-	0xBC,0x9A,0x5C,0x92,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0xBC,0x9A,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xFA,0xBA,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0x3E,0xBB,0x3E,0xBB,0xDB,0xB2,0x59,0x92,0x17,0x82,0xB2,0x71,0xB2,0x71,0xB1,0x49,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0xB1,0x49,
-	0xB2,0x71,0x95,0x59,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x39,0x72,0x5B,0x82,0x5B,0x82,0x5B,0x82,0xBD,0x8A,0xFD,0x9A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x82,0xBD,0x8A,0xBD,0x8A,0xBD,0x8A,0x1C,0x7A,0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0xF5,0x69,0x95,0x59,0xB4,0x6A,
-	0x14,0x4A,0xB1,0x49,0x8E,0x31,0x0B,0x39,0xA8,0x18,0x66,0x10,0x24,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB1,0x49,
-	0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xBD,0xA3,0xDF,0xAB,0xBD,0xA3,0xBD,0xA3,0x5F,0xB4,0xDF,0xAB,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,
-	0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0xBC,0x9A,0xBD,0x8A,0x59,0x92,0x59,0x92,0x59,0x92,0x5C,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xFA,0xBA,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0x3F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0x3E,0xBB,0x3E,0xBB,0xDB,0xB2,0x59,0x92,0x59,0x92,0x17,0x82,0xB2,0x71,
-	0xB2,0x71,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0x90,0x61,0xB1,0x49,0xB2,0x71,0x95,0x59,0xB2,0x71,0xF5,0x69,0xF5,0x69,0x17,0x82,0x39,0x72,0x5B,0x82,0x5B,0x82,0xBC,0x9A,0x5E,0x82,0xDF,0x92,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,
-	0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xBD,0x8A,0xBD,0x8A,0xBD,0x8A,0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x39,0x72,0x9B,0x5A,0x39,0x72,0xD9,0x61,0x95,0x59,0x14,0x4A,0x14,0x4A,0xB1,0x49,0x6E,0x51,0x8E,0x31,0xA8,0x18,0x66,0x10,0x24,0x08,0x23,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xB4,0x6A,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xBD,0xA3,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0x3F,0x9C,
-	0x5F,0xB4,0xBD,0xA3,0x5F,0xB4,0xBD,0xA3,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0xFD,0x9A,0x59,0x92,0x5B,0x82,0x59,0x92,
-	0x5C,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xFA,0xBA,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,
-	0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x5F,0xCB,0x3C,0xCB,0xDB,0xB2,0xDB,0xB2,0x59,0x92,0x17,0x82,0x17,0x82,0xF5,0x69,0xB2,0x71,0xB2,0x71,0x90,0x61,0x6E,0x51,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0xB1,0x49,0x90,0x61,0x95,0x59,0xB2,0x71,
-	0xF5,0x69,0xF5,0x69,0xF5,0x69,0x39,0x72,0x17,0x82,0x5B,0x82,0x5B,0x82,0x5C,0x92,0xBD,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xBD,0x8A,0xBD,0x8A,0xBC,0x7A,0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,
-	0xF5,0x69,0xF5,0x69,0x14,0x4A,0xB1,0x49,0x6E,0x51,0x8E,0x31,0xCA,0x28,0x66,0x10,0x24,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x58,0x83,0x3F,0x9C,0x3F,0x9C,
-	0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0xBD,0xA3,0x5F,0xB4,0xBD,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,
-	0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0xBC,0x9A,0xBC,0x9A,0x5C,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xFA,0xBA,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xBF,0xDB,0x5F,0xCB,0x3C,0xCB,0x3E,0xBB,0xDB,0xB2,0x99,0xAA,0x59,0x92,0x17,0x82,0x17,0x82,0xF5,0x69,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x51,0x41,
-	0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0x90,0x61,0x90,0x61,0x95,0x59,0xB2,0x71,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,0x5B,0x82,0x5B,0x82,0xBD,0x8A,0xBC,0x9A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDE,0xAA,0xDF,0x92,0xDE,0xAA,
-	0x5F,0x9B,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xBD,0x8A,0xBC,0x7A,0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x9B,0x5A,0x39,0x72,0x19,0x52,0x14,0x4A,0x14,0x4A,0xB1,0x49,0x6E,0x51,0x8E,0x31,0xCA,0x28,0x66,0x10,0x23,0x08,0x23,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x58,0x83,0xBD,0xA3,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0xBD,0xA3,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,
-	0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0xBC,0x9A,0xBC,0x9A,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,
-	0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xFA,0xBA,0x3B,0xC3,0x3C,0xCB,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0x5F,0xCB,
-	0x5F,0xCB,0x3C,0xCB,0x3E,0xBB,0xDB,0xB2,0xDB,0xB2,0x59,0x92,0x59,0x92,0x17,0x82,0x17,0x82,0x17,0x82,0xF3,0x81,0xB2,0x71,0xB2,0x71,0x95,0x59,0x90,0x61,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0x90,0x61,0x90,0x61,0x6E,0x51,0x90,0x61,0x90,0x61,0x90,0x61,0x95,0x59,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xF5,0x69,
-	0xF5,0x69,0x17,0x82,0x39,0x72,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5C,0x92,0xDF,0x92,0x5C,0xA2,0xDF,0x92,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0xBC,0x7A,0xBC,0x7A,0x39,0x72,
-	0x39,0x72,0x19,0x52,0xF5,0x69,0x14,0x4A,0x14,0x4A,0xB1,0x49,0x8E,0x31,0x0B,0x39,0xA8,0x18,0x65,0x10,0x24,0x08,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x58,0x83,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xBD,0xA3,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0x3F,0x9C,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0xBD,0xA3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,
-	0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0x3E,0xA3,0xFD,0x9A,0xBC,0x9A,0x59,0x92,0x59,0x92,0x5C,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xFA,0xBA,0xFA,0xBA,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,
-	0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x5D,0xD3,0x3C,0xCB,0xDD,0xBA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0x99,0xAA,0x59,0x92,0x17,0x82,0x17,0x82,0x17,0x82,0xF3,0x81,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0x90,0x61,
-	0x90,0x61,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0xB2,0x71,0x95,0x59,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x17,0x82,0x39,0x72,0x59,0x92,0x5B,0x82,0x5C,0x92,0x5C,0x92,0xFD,0x9A,0xDF,0x92,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDE,0xAA,0x5F,0xA3,0xDE,0xAA,0x5F,0xA3,0x5F,0xA3,
-	0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0xBC,0x7A,0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x19,0x52,0xF5,0x69,0x14,0x4A,0x14,0x4A,0xB1,0x49,0x8E,0x31,0x4A,0x29,0xA8,0x18,0x65,0x10,0x22,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xB4,0x6A,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0xBD,0xA3,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,
-	0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0xBC,0x9A,0xBC,0x9A,0x5C,0x92,0x5C,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,
-	0xFA,0xBA,0x3B,0xC3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x5D,0xD3,0x3C,0xCB,0x3C,0xCB,0xDD,0xBA,0xFA,0xBA,0xDB,0xB2,0xDB,0xB2,0x99,0xAA,0x99,0xAA,0x99,0xAA,
-	0x59,0x92,0x59,0x92,0x17,0x82,0x17,0x82,0x17,0x82,0xF3,0x81,0xF5,0x69,0xF5,0x69,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0x95,0x59,0xB2,0x71,0x95,0x59,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,
-	0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5C,0x92,0xBC,0x9A,0xFD,0x9A,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0x5F,0xA3,0xDE,0xAA,0x5F,0xA3,0x5F,0xA3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,
-	0xBC,0x7A,0x39,0x72,0x39,0x72,0xD9,0x61,0xF5,0x69,0xF5,0x69,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xCA,0x28,0x66,0x10,0x23,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xB1,0x49,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x5F,0xA3,
-	0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0xBC,0x9A,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xFA,0xBA,0xFA,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,
-	0x7E,0xDB,0x5D,0xD3,0x5F,0xCB,0x3C,0xCB,0x3B,0xC3,0xDD,0xBA,0xDB,0xB2,0xDB,0xB2,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0xF3,0x81,0x17,0x82,0xF3,0x81,0xF3,0x81,0xF5,0x69,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0xB2,0x71,0x90,0x61,
-	0x90,0x61,0x90,0x61,0xB2,0x71,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,0x17,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5C,0x92,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0xDE,0xAA,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,
-	0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDF,0xB3,0x5F,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x19,0x52,0xF5,0x69,0x14,0x4A,0xB1,0x49,0x6E,0x51,0x0B,0x39,0xC6,0x28,0x24,0x08,0x22,0x08,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x29,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,
-	0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0xBC,0x9A,0x5C,0x92,0x5C,0x92,0x59,0x92,0x5C,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0x99,0xAA,0xFA,0xBA,0xFA,0xBA,0x3C,0xCB,0x3C,0xCB,
-	0x5D,0xD3,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,0x3C,0xCB,0x3C,0xCB,0xDD,0xBA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0x55,0x9A,0x17,0x82,0x17,0x82,0x55,0x9A,
-	0x17,0x82,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5C,0x92,
-	0x5C,0x92,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDF,0xB3,0x5F,0xB3,0xDF,0xAB,0xDF,0xB3,0x5F,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0x3E,0x83,
-	0xBD,0x8A,0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x39,0x72,0xD9,0x61,0x95,0x59,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xCA,0x28,0x65,0x10,0x22,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x18,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xB3,0x5F,0xB4,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,
-	0x5C,0x92,0x5C,0x92,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x5C,0xA2,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xFA,0xBA,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,
-	0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x5D,0xD3,0x3C,0xCB,0x3C,0xCB,0xDD,0xBA,0xFA,0xBA,0xDB,0xB2,0xDB,0xB2,0x99,0xAA,0x99,0xAA,
-	0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x55,0x9A,0x59,0x92,0x55,0x9A,0x17,0x82,0x55,0x9A,0x17,0x82,0x55,0x9A,0xF3,0x81,0xF3,0x81,0x17,0x82,0xF3,0x81,0x17,0x82,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,
-	0xB2,0x71,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x5C,0x92,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,
-	0xDF,0xB3,0x5F,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xBD,0x8A,0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x39,0x72,0x95,0x59,0x14,0x4A,0xB1,0x49,0x8E,0x31,0x4A,0x29,0x66,0x10,0x23,0x08,0x21,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x83,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,
-	0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xFD,0x9A,0xBC,0x9A,0x5C,0x92,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xFA,0xBA,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,
-	0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,
-	0xDF,0xEB,0xBF,0xDB,0x5D,0xD3,0x5D,0xD3,0x3C,0xCB,0x3C,0xCB,0xFA,0xBA,0xDB,0xB2,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0x17,0x82,0x17,0x82,0x55,0x9A,0x17,0x82,0x55,0x9A,0x17,0x82,0x55,0x9A,0x17,0x82,0xF3,0x81,0xF3,0x81,0x17,0x82,0xF3,0x81,
-	0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x5B,0x82,0x59,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0xBC,0x9A,0x5C,0xA2,0xBC,0x9A,0x5C,0xA2,
-	0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,
-	0x3F,0x8B,0xDF,0x8A,0x5E,0x82,0xBC,0x7A,0x9B,0x5A,0x39,0x72,0xD9,0x61,0xF5,0x69,0xB1,0x49,0x6E,0x51,0xCA,0x28,0xA7,0x18,0x23,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x3A,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xFD,0x9A,0xFD,0x9A,0x5C,0x92,0x5B,0x82,0x5B,0x82,
-	0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xBF,0xDB,0x7E,0xDB,0x5D,0xD3,0x3C,0xCB,0xDD,0xBA,0xFA,0xBA,0xDB,0xB2,0xDB,0xB2,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x59,0x92,0x99,0xAA,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,
-	0x59,0x92,0x55,0x9A,0x55,0x9A,0x59,0x92,0x55,0x9A,0x55,0x9A,0x59,0x92,0x55,0x9A,0x17,0x82,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0xF3,0x81,0x55,0x9A,0x17,0x82,0xF3,0x81,0x17,0x82,0xF3,0x81,0x17,0x82,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x17,0x82,0xF3,0x81,0xF3,0x81,0x17,0x82,0x17,0x82,0x17,0x82,
-	0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x59,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xCB,0x5F,0xB3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,
-	0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0x5B,0x82,0x9B,0x5A,0x39,0x72,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xCA,0x28,0x66,0x10,0x23,0x08,0x21,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0xBD,0xA3,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xBD,0xA3,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,
-	0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xFD,0x9A,0x5C,0x92,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xFA,0xBA,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x3C,0xCB,0x3C,0xCB,0xFA,0xBA,0xDB,0xB2,
-	0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x59,0x92,0x59,0x92,0x99,0xAA,0x59,0x92,0x55,0x9A,0x59,0x92,0x59,0x92,0x55,0x9A,0x59,0x92,0x59,0x92,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x17,0x82,0x55,0x9A,0x55,0x9A,0x17,0x82,0x55,0x9A,
-	0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x17,0x82,0x55,0x9A,0x17,0x82,0x55,0x9A,0x17,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0xBC,0x9A,0x5C,0x92,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,
-	0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xCB,0x5F,0xB3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,
-	0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,0x39,0x72,0x39,0x72,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xCA,0x28,0x65,0x10,0x22,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0x6A,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xFD,0x9A,0x5C,0x92,0x5C,0x92,0x5B,0x82,0x5C,0x92,0x59,0x92,0x5B,0x82,0x59,0x92,
-	0x59,0x92,0x5C,0xA2,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x5D,0xD3,0x5D,0xD3,0xFA,0xBA,0xDB,0xB2,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x59,0x92,0x99,0xAA,0x99,0xAA,0x59,0x92,0x59,0x92,0x99,0xAA,0x59,0x92,0x59,0x92,0x99,0xAA,
-	0x59,0x92,0x99,0xAA,0x99,0xAA,0x59,0x92,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x59,0x92,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x55,0x9A,0x59,0x92,0x55,0x9A,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x59,0x92,0x99,0xAA,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0x59,0x92,0x99,0xAA,0x59,0x92,0x99,0xAA,0x59,0x92,0x99,0xAA,0xBC,0x9A,0x99,0xAA,
-	0xBC,0x9A,0xBC,0x9A,0xDB,0xB2,0xBC,0x9A,0xDB,0xB2,0x5C,0xA2,0xDB,0xB2,0xDE,0xAA,0xDE,0xAA,0xDD,0xBA,0xDE,0xAA,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x5F,0xB3,0x3E,0xBB,0x5F,0xB3,0x5F,0xB3,0x5F,0xCB,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0x5F,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,
-	0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,0xBD,0x6A,0x39,0x72,0xF5,0x69,0xB1,0x49,0xED,0x28,0x66,0x10,0x24,0x08,0x22,0x08,0x21,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x18,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0xBD,0xA3,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xBD,0xA3,0xDF,0xAB,0xDF,0xAB,0xBD,0xA3,
-	0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xFD,0x9A,0x5C,0x92,0x5C,0x92,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x5C,0x92,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0x3C,0xCB,0x3C,0xCB,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x7E,0xDB,0x5D,0xD3,0x3B,0xC3,0x3B,0xC3,0xFA,0xBA,0x99,0xAA,0x99,0xAA,0x55,0x9A,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,
-	0x59,0x92,0x59,0x92,0x99,0xAA,0x55,0x9A,0x59,0x92,0x99,0xAA,0x59,0x92,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xFA,0xBA,0x99,0xAA,0x99,0xAA,0x99,0xAA,
-	0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDE,0xAA,0xDD,0xBA,0xDE,0xAA,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x5F,0xB3,0x5F,0xCB,0x5F,0xB3,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,
-	0x5F,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0x5F,0xA3,0x5F,0x9B,
-	0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xBC,0x7A,0x39,0x72,0x39,0x72,0x14,0x4A,0x6E,0x51,0xCA,0x28,0x66,0x10,0x24,0x08,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x61,0x08,0x62,0x08,0x62,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0x6A,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0x3F,0x9C,0xBD,0xA3,0x3F,0x9C,0xDF,0xAB,0xBF,0x9B,0xBD,0xA3,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xFD,0x9A,0xBD,0x8A,0x5C,0x92,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5C,0x92,0x59,0x92,0x59,0x92,0x5C,0x92,0x99,0xAA,0x99,0xAA,
-	0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,
-	0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x3B,0xC3,0xFA,0xBA,0xFA,0xBA,0x99,0xAA,0x99,0xAA,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xFA,0xBA,0x99,0xAA,0xFA,0xBA,0x99,0xAA,0xDB,0xB2,
-	0xFA,0xBA,0xDB,0xB2,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xDB,0xB2,0xFA,0xBA,0xDD,0xBA,0xFA,0xBA,0xDD,0xBA,0xDB,0xB2,0x3E,0xBB,0xDD,0xBA,0x3E,0xBB,0x3E,0xBB,
-	0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0xDF,0xCB,0x5F,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xFF,0xD3,0xDF,0xCB,0xFF,0xD3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xFF,0xD3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x5F,0xC4,0x5F,0xC4,
-	0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xBD,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0x3E,0x83,0xBC,0x7A,0x39,0x72,0x14,0x4A,0xB1,0x49,0xED,0x28,0xAB,0x10,0x66,0x10,0x24,0x08,0x22,0x08,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x62,0x08,0xA2,0x10,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x18,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xBF,0x9B,0xBD,0xA3,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0xFD,0x9A,0xBD,0x8A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x5C,0xA2,0x99,0xAA,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x3B,0xC3,0xFA,0xBA,0xFA,0xBA,0x99,0xAA,0x99,0xAA,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x99,0xAA,0x99,0xAA,0x99,0xAA,
-	0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0x3B,0xC3,0xFA,0xBA,0x3B,0xC3,0x3C,0xCB,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3C,0xCB,0x3B,0xC3,0x3C,0xCB,0x3C,0xCB,
-	0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x5F,0xCB,0x3C,0xCB,0x3C,0xCB,0x5F,0xCB,0x3C,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0x7E,0xDB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,
-	0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x5F,0xC4,0xFF,0xD3,0x5F,0xC4,0xFF,0xD3,0xFF,0xD3,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,
-	0x5F,0x9B,0xDF,0x8A,0xBD,0x8A,0xBC,0x7A,0x39,0x72,0xF5,0x69,0x14,0x4A,0x0E,0x41,0xED,0x28,0xA8,0x18,0x66,0x10,0x24,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB4,0x6A,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xBF,0x9B,0x3F,0x9C,0xBF,0x9B,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBD,0xA3,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0xFD,0x9A,0xBD,0x8A,0xBD,0x8A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x17,0x82,0x5B,0x82,0x59,0x92,0x5C,0x92,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,
-	0x3C,0xCB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x5D,0xD3,0x3B,0xC3,0x3B,0xC3,0xFA,0xBA,
-	0x99,0xAA,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x99,0xAA,0x55,0x9A,0x99,0xAA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3C,0xCB,0x3B,0xC3,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,
-	0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x3C,0xCB,0x5D,0xD3,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x5D,0xD3,0x5F,0xCB,0x7E,0xDB,
-	0x5D,0xD3,0x7E,0xDB,0x5F,0xCB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0xFF,0xD3,0x3F,0xE4,0xFF,0xD3,0x9F,0xD4,0x9F,0xD4,0xFF,0xD3,0x9F,0xD4,0x9F,0xD4,0xFF,0xD3,0x5F,0xC4,0x5F,0xC4,
-	0x9F,0xD4,0x5F,0xC4,0xDF,0xCB,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xBD,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xBD,0x8A,0xBC,0x7A,0x39,0x72,0x19,0x52,0xB1,0x49,0x31,0x31,0xED,0x28,0xCA,0x28,0xA8,0x18,0xC6,0x28,0x65,0x10,0x23,0x08,0x22,0x08,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x00,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0xBF,0x9B,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBD,0xA3,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,
-	0xBD,0x8A,0x5B,0x82,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x5D,0xD3,0x3B,0xC3,0x3B,0xC3,0xFA,0xBA,0x99,0xAA,0x99,0xAA,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xFA,0xBA,
-	0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0x3B,0xC3,0x3B,0xC3,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,
-	0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,
-	0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x9F,0xD4,0xFF,0xD3,0xFF,0xD3,0x9F,0xD4,0xFF,0xD3,0x9F,0xD4,0xFF,0xD3,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0xBD,0x8A,
-	0xBC,0x7A,0xBC,0x7A,0x39,0x72,0x95,0x59,0xB1,0x49,0x31,0x31,0xED,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xA7,0x18,0x65,0x10,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x62,0x08,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x3A,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,
-	0x3F,0x9C,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3E,0x83,0xBD,0x8A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,
-	0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x5D,0xD3,0x3B,0xC3,0x3B,0xC3,0xFA,0xBA,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,
-	0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0xFA,0xBA,0x55,0x9A,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,
-	0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,
-	0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xFF,0xD3,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xBF,0xDB,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0xFF,0xD3,0x9F,0xD4,0xFF,0xD3,0x9F,0xD4,0xFF,0xD3,0x5F,0xC4,0x5F,0xC4,
-	0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0x5F,0x9B,0xFD,0x9A,0x3E,0x83,0xBD,0x8A,0xBC,0x7A,0x39,0x72,0x95,0x59,0x14,0x4A,0xB1,0x49,0x51,0x41,0xED,0x28,0xCA,0x28,0xCA,0x28,0xA8,0x18,0x68,0x18,0xC6,0x28,0x65,0x10,0x65,0x10,0x65,0x10,0x43,0x10,0x43,0x10,
-	0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x62,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x58,0x83,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBD,0xA3,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xFD,0x9A,0xBD,0x8A,0xBD,0x8A,0x5B,0x82,0x5B,0x82,
-	0x5B,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x59,0x92,0x5C,0x92,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,
-	0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x7E,0xDB,0x5D,0xD3,0x3B,0xC3,0xFA,0xBA,0x99,0xAA,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x55,0x9A,0xF3,0x81,0x55,0x9A,0x0F,0xA3,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x99,0xAA,0x99,0xAA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,
-	0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,
-	0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,
-	0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0x3F,0xE4,0x9F,0xD4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x5F,0xC4,0xFF,0xD3,0x5F,0xC4,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3E,0x83,0xBC,0x7A,0x39,0x72,0x19,0x52,
-	0x95,0x59,0x74,0x41,0x51,0x41,0x31,0x31,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0x68,0x18,0xC6,0x28,0x66,0x10,0xA7,0x18,0xC6,0x28,0xC5,0x18,0x83,0x20,0x43,0x10,0x43,0x10,0x22,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x08,0xA2,0x10,0xE3,0x18,0x62,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,
-	0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x83,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3E,0x83,0xBD,0x8A,0x5E,0x82,0x5B,0x82,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x5C,0x92,0x59,0x92,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,
-	0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x5D,0xD3,0x5D,0xD3,0x3B,0xC3,0xFA,0xBA,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x55,0x9A,0x55,0x9A,0x0F,0xA3,
-	0xF3,0x81,0x0F,0xA3,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0xFA,0xBA,0x55,0x9A,0xFA,0xBA,0x55,0x9A,0xFA,0xBA,0x55,0x9A,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0x3B,0xC3,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3C,0xCB,0x3C,0xCB,
-	0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,
-	0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x9F,0xD4,0xFF,0xD3,0x9F,0xD4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x9F,0xD4,0xFF,0xD3,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,
-	0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xBD,0x8A,0xBC,0x7A,0x39,0x72,0x9B,0x5A,0xD9,0x61,0x95,0x59,0x74,0x41,0x51,0x41,0x31,0x31,0x0E,0x41,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x68,0x18,0x68,0x18,0xC6,0x28,0x66,0x10,0xC6,0x28,0x65,0x10,0xC5,0x18,0x65,0x10,
-	0xA2,0x10,0x43,0x10,0x22,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x4A,0x29,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x83,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xBD,0x8A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5B,0x82,
-	0x5C,0x92,0x59,0x92,0x5C,0x92,0x99,0xAA,0x5C,0xA2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,
-	0x7E,0xDB,0x5D,0xD3,0x3B,0xC3,0x99,0xAA,0x55,0x9A,0x55,0x9A,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x0F,0xA3,0x55,0x9A,0x55,0x9A,0x0F,0xA3,0x55,0x9A,0xFA,0xBA,0x0F,0xA3,0xFA,0xBA,0x55,0x9A,0xFA,0xBA,0x55,0x9A,0xFA,0xBA,0x55,0x9A,0x55,0x9A,
-	0x99,0xAA,0x55,0x9A,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x55,0x9A,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xFA,0xBA,0xDB,0xB2,0xDB,0xB2,0xFA,0xBA,0xDD,0xBA,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,
-	0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x3F,0xE4,0xBF,0xDB,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0x3F,0xE4,0xBF,0xDB,0x3F,0xE4,0xFF,0xD3,0x3F,0xE4,0xFF,0xD3,0x3F,0xE4,
-	0xFF,0xD3,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xBC,0x7A,0xBC,0x7A,0x9B,0x5A,0xD9,0x61,0x19,0x52,0x95,0x59,0x74,0x41,0x74,0x41,
-	0x51,0x41,0x31,0x31,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xA8,0x18,0x68,0x18,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x83,0x20,0x65,0x10,0x43,0x10,0x22,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x43,0x10,0xE3,0x18,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0xB4,0x6A,0x3F,0x9C,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,
-	0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xBD,0x8A,0xBD,0x8A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x5C,0x92,0x59,0x92,0x5C,0xA2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5F,0xCB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x5D,0xD3,0x5D,0xD3,0x3B,0xC3,0xFA,0xBA,0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x0F,0xA3,0xF3,0x81,0xF3,0x81,0x0F,0xA3,0x55,0x9A,0x0F,0xA3,
-	0x55,0x9A,0x0F,0xA3,0x55,0x9A,0x55,0x9A,0x0F,0xA3,0x99,0xAA,0x55,0x9A,0x0F,0xA3,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x0F,0xA3,0x55,0x9A,0x0F,0xA3,0x55,0x9A,0x55,0x9A,0xF3,0x81,0x55,0x9A,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,
-	0xF3,0x81,0xF3,0x81,0x17,0x82,0x55,0x9A,0x17,0x82,0x55,0x9A,0x59,0x92,0x55,0x9A,0x99,0xAA,0x59,0x92,0x99,0xAA,0x59,0x92,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0x3C,0xCB,0x3C,0xCB,0x5F,0xCB,0x7E,0xDB,0x5F,0xCB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,
-	0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,
-	0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0x5E,0x7A,0xBC,0x7A,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0x77,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,
-	0xC6,0x28,0xC6,0x28,0x83,0x20,0x43,0x10,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x08,0x62,0x08,0xE3,0x18,0xE3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x3E,0x83,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x83,0x3F,0x94,0xBF,0x83,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5C,0x92,0x5C,0x92,0x5C,0x92,
-	0x5C,0xA2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x3C,0xCB,0x5F,0xCB,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x5D,0xD3,0x3B,0xC3,0xFA,0xBA,
-	0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x0F,0xA3,0xF3,0x81,0x55,0x9A,0x0F,0xA3,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x0F,0xA3,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x0F,0xA3,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,
-	0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x17,0x82,0xF3,0x81,0x17,0x82,0xF3,0x81,0x17,0x82,0x17,0x82,0x59,0x92,0x59,0x92,
-	0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x59,0x92,0x5C,0xA2,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0xDF,0xCB,0xDF,0xCB,0xBF,0xDB,0xDF,0xCB,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,
-	0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0xDC,0x59,0xD9,0x61,0x9A,0x49,0x77,0x41,0x77,0x41,0x74,0x41,0x74,0x41,0x13,0x29,0x31,0x31,
-	0x31,0x31,0x31,0x31,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x65,0x10,0x43,0x10,0x22,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x62,0x08,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x00,0x00,0xA2,0x10,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x83,0xBF,0x9B,0xBF,0x9B,0xBF,0x83,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x3F,0x8B,
-	0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x92,0xDF,0x8A,0xBC,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5C,0x92,0x5C,0x92,0x59,0x92,0x5C,0xA2,0x99,0xAA,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5F,0xCB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x5D,0xD3,0x3B,0xC3,0xFA,0xBA,0x99,0xAA,0x55,0x9A,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x0F,0xA3,0xF3,0x81,0x0F,0xA3,0xF3,0x81,0xF3,0x81,0x55,0x9A,0x0F,0xA3,0xF3,0x81,0xF3,0x81,0x0F,0xA3,
-	0xF3,0x81,0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x4C,0x7A,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x4C,0x7A,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0xB2,0x71,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,
-	0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x17,0x82,0xF3,0x81,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x5C,0x92,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0xDE,0xAA,0x5C,0xA2,
-	0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x3E,0xBB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0x3E,0xA3,0x3E,0xA3,0xDE,0xAA,0x3E,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x82,0xDF,0x8A,0x5E,0x7A,
-	0x5E,0x7A,0x5E,0x7A,0xDD,0x69,0xDD,0x69,0xDC,0x59,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x77,0x41,0x77,0x41,0x74,0x41,0x35,0x31,0x13,0x29,0x51,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x4A,0x29,0xCA,0x28,
-	0x4A,0x29,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x65,0x10,0x43,0x10,0x21,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x08,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x20,0x00,
-	0x4A,0x29,0x3F,0x94,0x3F,0x94,0xBF,0x83,0xBF,0x9B,0x3F,0x94,0xBF,0x9B,0xBF,0x83,0xBF,0x9B,0xBF,0x83,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x83,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0xBD,0x8A,0x5E,0x82,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0xA2,0xDB,0xB2,
-	0xDD,0xBA,0xDD,0xBA,0x3C,0xCB,0x5F,0xCB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x5D,0xD3,0x3B,0xC3,0xFA,0xBA,0x55,0x9A,0x55,0x9A,0xF3,0x81,
-	0xF3,0x81,0xF3,0x81,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0xF3,0x81,0x0F,0xA3,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x4B,0x49,0x90,0x61,0x4B,0x49,0x90,0x61,0x4B,0x49,0x90,0x61,0xCA,0x59,0x90,0x61,0xCA,0x59,0x90,0x61,0xCA,0x59,
-	0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF3,0x81,0xF5,0x69,0x17,0x82,
-	0x17,0x82,0xF3,0x81,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x59,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0xA2,0x5C,0x92,0x5C,0x92,0x5C,0xA2,0x5E,0x82,0x5C,0xA2,0xDF,0x92,0x5C,0xA2,0xDF,0x92,0x5E,0x82,0x5C,0xA2,
-	0x5E,0x82,0xBD,0x8A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0xBD,0x8A,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDC,0x59,0xDC,0x59,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x74,0x41,0x74,0x41,0x13,0x29,0x51,0x41,
-	0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x4A,0x29,0x0B,0x39,0x4A,0x29,0xC6,0x28,0xC6,0x28,0x65,0x10,0x22,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x62,0x08,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x20,0x00,0x6E,0x51,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x83,0xBF,0x9B,0xBF,0x83,0xBF,0x83,0xBF,0x9B,0xBF,0x83,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,
-	0x3F,0x8B,0xDF,0x8A,0x5E,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5C,0x92,0x5C,0x92,0x5C,0x92,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0x5F,0xCB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x3C,0xCB,0x3C,0xCB,0xFA,0xBA,0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0x0F,0xA3,0xF3,0x81,0x4C,0x7A,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x90,0x61,
-	0x4B,0x49,0x90,0x61,0x4B,0x49,0xCA,0x59,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x90,0x61,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x90,0x61,0x6E,0x51,0x6E,0x51,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0x90,0x61,0xB2,0x71,
-	0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x17,0x82,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x5B,0x82,0x17,0x82,0x5B,0x82,0x5B,0x82,0x39,0x72,0x5B,0x82,0x1C,0x7A,0x5B,0x82,
-	0x1C,0x7A,0x5B,0x82,0x1C,0x7A,0x5C,0x92,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x1C,0x7A,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x5E,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x1C,0x7A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDC,0x59,0xDD,0x69,
-	0xDC,0x59,0xDC,0x59,0xDC,0x59,0x9A,0x49,0x7D,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x74,0x41,0x13,0x29,0x13,0x29,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0xED,0x28,0x0B,0x39,
-	0x0B,0x39,0x0B,0x39,0xCA,0x28,0x48,0x39,0xC6,0x28,0xC5,0x18,0x43,0x10,0x22,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x63,0x08,0xA2,0x10,0x46,0x21,0x61,0x08,
-	0xB4,0x6A,0x3F,0x94,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x9B,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5C,0x92,0x5C,0x92,0x5C,0xA2,0x5C,0xA2,0xDB,0xB2,0xDE,0xAA,0x3E,0xBB,0x5F,0xCB,
-	0x5F,0xCB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x7E,0xDB,0x5D,0xD3,0x3C,0xCB,0xFA,0xBA,0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0x4C,0x7A,
-	0xB2,0x71,0x4C,0x7A,0xF3,0x81,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0xB2,0x71,0x90,0x61,0xCA,0x59,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,
-	0x0B,0x39,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0xB1,0x49,0x90,0x61,0x90,0x61,0xB1,0x49,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x17,0x82,0xF5,0x69,
-	0x17,0x82,0x17,0x82,0xF5,0x69,0x17,0x82,0xD9,0x61,0x17,0x82,0x39,0x72,0x39,0x72,0x17,0x82,0x1C,0x7A,0x17,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x39,0x72,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0x1C,0x7A,
-	0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0x7D,0x41,0xDC,0x59,0x9A,0x49,0x7D,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x78,0x31,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x74,0x41,
-	0x74,0x41,0x35,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x0E,0x41,0x8E,0x31,0x0E,0x41,0x8E,0x31,0x0E,0x41,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x4A,0x29,0xC6,0x28,0x65,0x10,0x22,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x62,0x08,0xE3,0x18,0xE3,0x18,0xA2,0x10,0xB4,0x6A,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x9B,0xBF,0x83,0x3F,0x8B,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,
-	0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5C,0x92,0x5C,0x92,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x5F,0xCB,0x5F,0xCB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,
-	0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x3C,0xCB,0x3B,0xC3,0x99,0xAA,0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x4B,0x49,0xCA,0x59,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,
-	0x4B,0x49,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0xCA,0x28,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x48,0x39,0xCA,0x28,0x48,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0xCA,0x28,0x0B,0x39,0x0B,0x39,0xCA,0x28,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,
-	0x6E,0x51,0x6E,0x51,0x6E,0x51,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x39,0x72,0x17,0x82,0xD9,0x61,0x17,0x82,0x39,0x72,0x17,0x82,0x39,0x72,0x39,0x72,0x5B,0x82,0x5B,0x82,0x39,0x72,0x39,0x72,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,
-	0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0xDD,0x69,0x3E,0x62,0xDD,0x69,0xDD,0x69,0x3E,0x62,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xFE,0x51,0xDD,0x69,0xFE,0x51,0xDC,0x59,0xFE,0x51,0xDD,0x69,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,
-	0xDC,0x59,0x7D,0x41,0xDC,0x59,0x7D,0x41,0x9A,0x49,0x7D,0x41,0x7A,0x41,0x7A,0x41,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x8E,0x31,0x0E,0x41,
-	0x8E,0x31,0x8E,0x31,0x0B,0x39,0x0B,0x39,0x4A,0x29,0xC6,0x28,0xC5,0x18,0x43,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x62,0x08,0xE3,0x18,0xE3,0x18,0xA2,0x10,
-	0x58,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3E,0x83,0xDF,0x8A,0xBC,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5C,0x92,0x5C,0x92,0xBC,0x9A,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0xBF,0xDB,
-	0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,0x5F,0xCB,0x3C,0xCB,0xFA,0xBA,0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xB2,0x71,
-	0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x48,0x39,0x48,0x39,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,
-	0xCA,0x28,0xC6,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x51,0x41,0x51,0x41,0xB1,0x49,0xB1,0x49,0x95,0x59,0x95,0x59,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,
-	0x39,0x72,0xF5,0x69,0xD9,0x61,0x17,0x82,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x5B,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x3E,0x62,0xDD,0x69,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xDD,0x69,0xFE,0x51,0xDC,0x59,0xFE,0x51,0xDC,0x59,0xFE,0x51,0xFE,0x51,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x49,0xDC,0x59,0x7D,0x41,0x9A,0x49,0x7D,0x41,0x7A,0x41,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x9A,0x49,0x7A,0x41,0x9A,0x49,
-	0x9A,0x49,0x77,0x41,0x19,0x52,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0xB1,0x49,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x0E,0x41,0x8E,0x31,0x0B,0x39,0x0B,0x39,0xCA,0x28,0xC6,0x28,0x63,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x08,0x62,0x08,0xC5,0x18,0xE3,0x18,0xE3,0x18,0x3E,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3E,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xBC,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,
-	0x3C,0x6A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5C,0x92,0x5E,0x82,0xBC,0x9A,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0xBF,0xDB,0xFF,0xD3,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xFF,0xD3,0xBF,0xDB,
-	0x7E,0xDB,0xDF,0xCB,0x5F,0xCB,0xFA,0xBA,0x99,0xAA,0x59,0x92,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x4C,0x7A,0x90,0x61,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x48,0x39,0x48,0x39,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,
-	0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,
-	0xCA,0x28,0xED,0x28,0x0B,0x39,0xED,0x28,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x51,0x41,0x51,0x41,0xB1,0x49,0xB1,0x49,0x95,0x59,0x95,0x59,0x95,0x59,0xF5,0x69,0xF5,0x69,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x5B,0x82,0x5B,0x82,0x1C,0x7A,0x5B,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,
-	0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x3E,0x62,0x5E,0x7A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0xFE,0x51,0xFE,0x51,0xDD,0x69,0xDD,0x69,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xDC,0x59,0xFE,0x51,
-	0xFE,0x51,0xDC,0x59,0xDD,0x49,0xDC,0x59,0xDD,0x49,0xDD,0x49,0xDC,0x59,0xDD,0x49,0xDC,0x59,0xDD,0x49,0x7D,0x41,0xDD,0x49,0x9A,0x49,0xDD,0x49,0x9A,0x49,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x19,0x52,0x19,0x52,0x77,0x41,0x19,0x52,0x77,0x41,0x95,0x59,0x95,0x59,0x74,0x41,0x74,0x41,0x74,0x41,0xB1,0x49,0xB1,0x49,
-	0xB1,0x49,0x6E,0x51,0x8E,0x31,0x0B,0x39,0x4A,0x29,0x48,0x39,0xC6,0x28,0x43,0x10,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0xA2,0x10,0xE3,0x18,0xE3,0x18,
-	0x3E,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x7B,0xDF,0x8A,0xDF,0x7A,0x5E,0x7A,0x3C,0x6A,0xDD,0x69,0x3C,0x6A,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0x5C,0x92,0xBC,0x9A,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x3E,0xBB,0x5F,0xCB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,
-	0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0xBF,0xDB,0x7E,0xDB,0xDF,0xCB,0x3C,0xCB,0xFA,0xBA,0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x4C,0x7A,0xB2,0x71,0x4C,0x7A,0xF3,0x81,0x4C,0x7A,0xB2,0x71,
-	0x4C,0x7A,0x90,0x61,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x48,0x39,0x48,0x39,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,0xA8,0x18,0xC6,0x28,0x66,0x10,0x66,0x10,0x66,0x10,
-	0x66,0x10,0x65,0x10,0x66,0x10,0x65,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x18,0xC6,0x28,0xA8,0x18,0xA8,0x18,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0xED,0x28,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x95,0x59,
-	0x95,0x59,0x95,0x59,0xD9,0x61,0xF5,0x69,0xD9,0x61,0x39,0x72,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0xBC,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x3E,0x62,0x5E,0x7A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xDD,0x69,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xDD,0x69,0xFE,0x51,0xDC,0x59,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xDD,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xDC,0x59,0xDD,0x49,0xFE,0x51,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xFE,0x51,0xDC,0x59,
-	0x3D,0x5A,0x3D,0x5A,0x3D,0x5A,0x3C,0x6A,0xDC,0x59,0xD9,0x61,0xDC,0x59,0xD9,0x61,0x19,0x52,0x19,0x52,0x95,0x59,0x95,0x59,0x95,0x59,0x74,0x41,0x74,0x41,0xB1,0x49,0xB1,0x49,0x51,0x41,0x8E,0x31,0x0E,0x41,0x0B,0x39,0x4A,0x29,0xC5,0x18,0x43,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0xA2,0x10,0xE3,0x18,0xC5,0x18,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0xDD,0x69,0x1C,0x7A,0x5E,0x7A,
-	0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0xBC,0x9A,0xDF,0x92,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x3E,0xBB,0x7E,0xDB,0x7E,0xDB,0xFF,0xD3,0xDF,0xEB,0x3F,0xE4,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0xDF,0xEB,0xFF,0xD3,0xBF,0xDB,0xBF,0xDB,0xDF,0xCB,0x5F,0xCB,
-	0x3B,0xC3,0xDB,0xB2,0x59,0x92,0x55,0x9A,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x48,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,
-	0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,0xA8,0x18,0xC6,0x28,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x25,0x08,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,
-	0xA8,0x18,0x68,0x18,0x68,0x18,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x31,0x31,0x0E,0x41,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x39,0x72,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x7A,
-	0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,
-	0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3D,0x5A,0x3E,0x62,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0x19,0x52,0x19,0x52,0x95,0x59,0x95,0x59,0x95,0x59,0x74,0x41,
-	0xB1,0x49,0xB1,0x49,0x6E,0x51,0x8E,0x31,0x4A,0x29,0xC6,0x28,0x65,0x10,0x22,0x08,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x62,0x08,0xE3,0x18,0x46,0x21,
-	0xBF,0x83,0xBF,0x83,0x3F,0x7B,0xBF,0x83,0x3F,0x7B,0x3F,0x8B,0x3F,0x7B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xBC,0x9A,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x3E,0xBB,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xDF,0xEB,0x3F,0xE4,0x3F,0xE4,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0x5F,0xCB,0x5F,0xCB,0xDD,0xBA,0x99,0xAA,0x59,0x92,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xB2,0x71,0x4C,0x7A,0xB2,0x71,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x90,0x61,0x4B,0x49,
-	0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x48,0x39,0x0B,0x39,0xCA,0x28,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x68,0x18,0xA8,0x18,0x66,0x10,0xA7,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x08,0x66,0x08,
-	0x66,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x24,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x10,0x64,0x08,0x64,0x08,0x65,0x08,0x65,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x31,0x31,0x31,0x31,0x31,0x31,
-	0x13,0x29,0x51,0x41,0x74,0x41,0x35,0x31,0x74,0x41,0x77,0x41,0xD9,0x61,0x9A,0x49,0xD9,0x61,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0x1C,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0x5E,0x7A,0xDF,0x8A,0x5E,0x7A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x7F,0x6A,0x5E,0x7A,0x3E,0x62,
-	0x5E,0x7A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0x19,0x52,0x95,0x59,0x74,0x41,0xB1,0x49,0x51,0x41,0x8E,0x31,0x0B,0x39,0x4A,0x29,0xC6,0x28,0x43,0x10,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x62,0x08,0xE3,0x18,0x46,0x21,0xBF,0x83,0x3F,0x7B,0xBF,0x83,0x3F,0x7B,0x3F,0x8B,0x3F,0x7B,0x3F,0x8B,0xDF,0x7A,0x5E,0x7A,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0xDD,0x69,0x5E,0x7A,0x5E,0x82,
-	0x5E,0x82,0x5E,0x82,0xDF,0x92,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xDF,0xEB,0x3F,0xE4,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0xBF,0xDB,0xBF,0xDB,0x5D,0xD3,0x5F,0xCB,0x3C,0xCB,0x3B,0xC3,0x99,0xAA,
-	0x59,0x92,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x4C,0x7A,0xB2,0x71,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,
-	0xED,0x28,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xA8,0x18,0x68,0x18,0x66,0x10,0x68,0x18,0xA7,0x18,0x68,0x18,0x66,0x10,0x66,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x65,0x08,0x66,0x08,0x25,0x08,0x65,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x65,0x08,0x64,0x08,
-	0x65,0x08,0x65,0x08,0x26,0x08,0x26,0x08,0x66,0x10,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x6D,0x18,0x6D,0x18,0xED,0x28,0xED,0x28,0xED,0x28,0xF1,0x20,0x31,0x31,0x51,0x41,0x13,0x29,0x13,0x29,0x74,0x41,0x35,0x31,0x77,0x41,0x77,0x41,0x77,0x41,0x9A,0x49,0x9A,0x49,0xD9,0x61,0xDD,0x69,0x3C,0x6A,0x3E,0x62,0x5E,0x7A,0xDF,0x7A,
-	0x5E,0x7A,0xDF,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0xDF,0x7A,0x5E,0x7A,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x3E,0x62,0x5E,0x7A,0x3E,0x62,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0x19,0x52,0x95,0x59,0x74,0x41,
-	0x51,0x41,0x8E,0x31,0x8E,0x31,0xCA,0x28,0xC6,0x28,0x65,0x10,0x22,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x62,0x08,0xE3,0x18,0xE3,0x18,
-	0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0xDD,0x69,0x3E,0x62,0xDD,0x69,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0xDF,0x92,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xBF,0xDB,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,
-	0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,0xDF,0xCB,0x5D,0xD3,0x3C,0xCB,0xFA,0xBA,0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xF3,0x81,0x4C,0x7A,0xF3,0x81,0xB2,0x71,0x4C,0x7A,0x90,0x61,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,
-	0x0B,0x39,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0x0B,0x39,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,0xAB,0x10,0xAB,0x10,0x68,0x18,0x68,0x18,0xA8,0x18,0x68,0x18,0x68,0x18,0x68,0x08,0x68,0x08,0x67,0x08,0x67,0x08,0x67,0x08,
-	0x67,0x08,0x66,0x08,0x66,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x24,0x08,0x64,0x08,0x24,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x27,0x08,0x68,0x18,0x68,0x18,0x68,0x18,0x6B,0x10,0x6D,0x18,0x6D,0x18,0xED,0x28,0xAF,0x18,0x31,0x31,
-	0x13,0x29,0x51,0x41,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,0x77,0x41,0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDC,0x59,0xDC,0x59,0xDD,0x69,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,
-	0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0xBD,0x6A,
-	0x7F,0x6A,0x7F,0x6A,0x5E,0x7A,0x7F,0x6A,0xDF,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x3D,0x5A,0x19,0x52,0x19,0x52,0x95,0x59,0x74,0x41,0x51,0x41,0xED,0x28,0xCA,0x28,0xA7,0x18,0x25,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x62,0x08,0xE3,0x18,0x46,0x21,0x3F,0x7B,0x3F,0x8B,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0x3C,0x6A,0xDD,0x69,0x3E,0x62,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,
-	0xDF,0x92,0xDF,0x92,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xBF,0xDB,0xFF,0xD3,0x7E,0xDB,0x5F,0xCB,0x5D,0xD3,0x3E,0xBB,0xDB,0xB2,0x99,0xAA,0x59,0x92,0xF3,0x81,
-	0xF3,0x81,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x0B,0x39,0x0E,0x41,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x8E,0x31,
-	0xED,0x28,0xED,0x28,0xAD,0x18,0xAD,0x18,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x68,0x18,0xA8,0x18,0x68,0x18,0x69,0x08,0xA8,0x18,0x69,0x08,0xA8,0x18,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x67,0x08,0x67,0x08,0x66,0x08,0x65,0x08,0x64,0x08,0x63,0x08,0x23,0x00,0x63,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x24,0x08,0x64,0x08,0x64,0x08,
-	0x64,0x08,0x64,0x08,0x65,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x28,0x08,0x68,0x18,0x68,0x18,0x6B,0x10,0x6D,0x18,0x6D,0x18,0x6D,0x18,0xED,0x28,0xF1,0x20,0x13,0x29,0x13,0x29,0x74,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x77,0x41,0x77,0x41,0x7A,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x7D,0x41,0xDC,0x59,
-	0xDC,0x59,0x3E,0x62,0x3E,0x62,0x7F,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0xDF,0x7A,
-	0xDF,0x7A,0x5E,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0x7F,0x6A,0xDF,0x7A,0x7F,0x6A,0xDF,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0x77,0x41,0x74,0x41,0x51,0x41,
-	0xED,0x28,0xCA,0x28,0x68,0x18,0x25,0x08,0x23,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0xA2,0x10,0xC5,0x18,
-	0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0x3E,0x62,0xDD,0x69,0x3E,0x62,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDE,0xAA,0xDE,0xAA,0x3E,0xBB,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xFC,0x3F,0xE4,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,
-	0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0x3F,0xE4,0xBF,0xDB,0xFF,0xD3,0x7E,0xDB,0x5F,0xCB,0xDF,0xCB,0x3C,0xCB,0xDB,0xB2,0x99,0xAA,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0x6E,0x51,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x0B,0x39,
-	0xED,0x28,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x31,0x31,0x31,0x31,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0xAF,0x18,0xAD,0x18,0xAD,0x18,0x6D,0x18,0xAB,0x10,0xAB,0x10,0x6B,0x10,0xAB,0x10,0xAB,0x10,0x6B,0x10,0xAB,0x10,0x6B,0x08,0xAB,0x10,0xAB,0x00,0xAB,0x10,0xAB,0x10,
-	0xAB,0x10,0xAB,0x10,0x69,0x08,0x68,0x08,0x67,0x08,0x67,0x08,0x65,0x08,0x64,0x08,0x63,0x08,0x63,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x24,0x00,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x25,0x08,0x25,0x08,0x66,0x08,0x66,0x10,0x27,0x08,0x28,0x08,0x68,0x18,0x29,0x08,0x6B,0x10,0x6D,0x18,0x6D,0x18,0x6F,0x10,
-	0xF1,0x20,0x31,0x31,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,0x77,0x41,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7D,0x41,0x9A,0x49,0x7D,0x41,0x7D,0x41,0x7D,0x41,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,
-	0xDF,0x8A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,
-	0xDF,0x7A,0x7F,0x6A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3C,0x6A,0x3E,0x62,0x3D,0x5A,0xD9,0x61,0x19,0x52,0x77,0x41,0x74,0x41,0x51,0x41,0xED,0x28,0xCA,0x28,0x68,0x18,0x25,0x08,0x24,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0xE3,0x18,0xE3,0x18,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0x7F,0x6A,0x3E,0x62,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDE,0xAA,
-	0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0x5F,0xCB,0x5F,0xCB,0x3E,0xBB,0xDB,0xB2,0x99,0xAA,0x17,0x82,0xF3,0x81,0xF3,0x81,0xB2,0x71,
-	0xF3,0x81,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x13,0x29,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0xF1,0x20,
-	0xAF,0x18,0xAF,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0x6D,0x18,0xAD,0x18,0x6C,0x08,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xCD,0x00,0xAB,0x10,0xAB,0x00,0xAB,0x10,0xAB,0x10,0x69,0x08,0xA8,0x18,0x66,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x63,0x00,0x23,0x00,0x63,0x08,0x23,0x00,0x63,0x08,0x64,0x00,
-	0x23,0x08,0x64,0x00,0x24,0x08,0x64,0x08,0x24,0x08,0x25,0x08,0x66,0x08,0x66,0x08,0x27,0x08,0x27,0x08,0x68,0x08,0x29,0x08,0x6A,0x08,0x6B,0x10,0x6D,0x18,0x6D,0x18,0xAF,0x18,0xD1,0x18,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7D,0x41,0x7A,0x41,0x7D,0x41,0x7D,0x41,
-	0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0x7F,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x7B,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x3E,0x83,0xDF,0x8A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,0xDF,0x8A,0xDF,0x7A,
-	0xDF,0x7A,0xDF,0x7A,0x3F,0x7B,0xDF,0x7A,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0x7F,0x6A,0xDF,0x7A,0xBF,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3D,0x5A,0x3D,0x5A,0xDC,0x59,0x19,0x52,0x77,0x41,0x74,0x41,0x31,0x31,0xED,0x28,0x6D,0x18,
-	0x68,0x18,0x66,0x10,0x25,0x08,0x23,0x08,0x22,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x08,0xA2,0x10,0xC5,0x18,
-	0xDF,0x7A,0xBF,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDE,0xAA,0x5F,0xB3,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,
-	0x3F,0xE4,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0x5F,0xCB,0x3E,0xBB,0x3E,0xBB,0xDB,0xB2,0x59,0x92,0x17,0x82,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,
-	0xAD,0x18,0xED,0x28,0xED,0x28,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x13,0x29,0x74,0x41,0x74,0x41,0x74,0x41,0x13,0x29,0x13,0x29,0x31,0x31,0xF1,0x20,0xAF,0x18,0xAF,0x18,0x6F,0x10,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xAF,0x18,0xB1,0x08,0xD1,0x18,0xCF,0x08,0xAF,0x18,
-	0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAB,0x00,0xAB,0x10,0xA8,0x00,0xA7,0x18,0x66,0x08,0xA4,0x08,0x64,0x00,0x23,0x08,0x63,0x08,0x63,0x00,0x63,0x08,0x24,0x00,0x63,0x08,0x64,0x00,0x63,0x08,0x24,0x00,0x24,0x08,0x24,0x08,0x65,0x08,0x65,0x08,0x26,0x08,0x66,0x08,0x67,0x08,0x68,0x08,0x69,0x08,0x6B,0x10,0x6B,0x08,0x6D,0x18,0xAF,0x18,
-	0x6F,0x10,0xAF,0x18,0xD1,0x18,0x13,0x29,0x13,0x29,0x35,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x5C,0x31,0x7A,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0xDE,0x49,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0x7F,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,
-	0xDF,0x7A,0x3F,0x7B,0xDF,0x8A,0xDF,0x8A,0x3F,0x7B,0xDF,0x8A,0x3F,0x7B,0x3F,0x7B,0x3F,0x8B,0xDF,0x7A,0x3F,0x7B,0xDF,0x8A,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x8B,0x3F,0x7B,0xDF,0x7A,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0x3F,0x7B,0xBF,0x6A,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xDF,0x7A,
-	0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3D,0x5A,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x77,0x41,0x74,0x41,0x13,0x29,0xF1,0x20,0xED,0x28,0x6D,0x18,0x68,0x18,0x68,0x18,0x26,0x08,0x65,0x10,0x23,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0xA2,0x10,0xE3,0x18,0xBF,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDE,0xAA,0x5F,0xB3,
-	0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xFC,0x3F,0xE4,0xDF,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0x3E,0xBB,0x3E,0xBB,0xDB,0xB2,0x59,0x92,0x55,0x9A,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xF3,0x81,0xF3,0x81,
-	0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0x90,0x61,0x0E,0x41,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x74,0x41,0x13,0x29,0x74,0x41,0x74,0x41,0x35,0x31,0x74,0x41,0x35,0x31,0x74,0x41,0x13,0x29,0x13,0x29,0xF1,0x20,0xD1,0x18,
-	0x70,0x10,0xD1,0x18,0x70,0x10,0xD1,0x18,0xD1,0x18,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0x34,0x19,0xD1,0x18,0x72,0x09,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAB,0x10,0xAB,0x10,0xA8,0x00,0x66,0x08,0x65,0x08,0x64,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x64,0x00,0x23,0x08,0x64,0x08,0x24,0x08,0x65,0x08,0x65,0x08,0x26,0x08,0x27,0x08,0x68,0x08,0x69,0x08,0x6B,0x08,0x6D,0x18,0x6F,0x10,0x6F,0x10,0x6F,0x10,0x70,0x10,0x70,0x10,0x72,0x10,0x13,0x29,0xD5,0x18,0x35,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x5C,0x31,0x7D,0x41,0x7D,0x41,0x5C,0x31,0x7D,0x41,0x7D,0x41,
-	0xBD,0x39,0x7D,0x41,0x7D,0x41,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xDF,0x8A,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x8B,0x3F,0x7B,0x3F,0x7B,
-	0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0x3D,0x5A,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x77,0x41,0x35,0x31,0x13,0x29,0xF1,0x20,0xAF,0x18,0x6D,0x18,0x6B,0x10,0x68,0x18,0x68,0x18,
-	0x66,0x10,0x66,0x10,0x65,0x10,0x24,0x08,0x23,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA2,0x10,0xE3,0x18,
-	0x3C,0x6A,0x3E,0x62,0x3D,0x5A,0x3E,0x62,0x3E,0x62,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0x3E,0xA3,0x5F,0xB3,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,
-	0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x3E,0xBB,0xDB,0xB2,0x59,0x92,0x17,0x82,0xF5,0x69,0xF5,0x69,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0xB2,0x71,0x90,0x61,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0xF1,0x20,0xF1,0x20,
-	0x31,0x31,0x13,0x29,0x13,0x29,0x74,0x41,0x35,0x31,0x74,0x41,0x35,0x31,0x35,0x31,0x77,0x41,0x74,0x41,0x35,0x31,0x13,0x29,0x13,0x29,0xD1,0x18,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0xD3,0x10,0xD3,0x10,0x34,0x19,0xD5,0x18,0xD5,0x18,0xD5,0x18,0x37,0x19,0xD7,0x18,0xD7,0x18,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,
-	0x34,0x19,0x72,0x09,0xF1,0x20,0xF1,0x20,0x2E,0x09,0xAB,0x10,0xA8,0x18,0xA7,0x00,0x65,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x66,0x08,0x68,0x08,0x69,0x08,0xAB,0x10,0x6D,0x18,0xAF,0x18,0xAF,0x18,
-	0x70,0x10,0x70,0x10,0x70,0x10,0x72,0x10,0xD3,0x10,0xD5,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,0x5C,0x31,0x7A,0x41,0x5C,0x31,0x5C,0x31,0xBD,0x39,0xBD,0x39,0x7D,0x41,0x5E,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0x5E,0x31,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xFE,0x51,
-	0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0x3F,0x7B,0xDF,0x7A,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0xBD,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,
-	0xFE,0x51,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x78,0x31,0x78,0x31,0x35,0x31,0x13,0x29,0xD3,0x10,0xF1,0x20,0x6F,0x10,0x6D,0x18,0x6B,0x10,0x6B,0x10,0x68,0x18,0x66,0x10,0x66,0x10,0x25,0x08,0x65,0x10,0x65,0x10,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0xFE,0x51,0xDC,0x59,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDE,0xAA,0x5F,0xA3,0x5F,0xB3,0x5F,0xB3,
-	0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x3E,0xBB,0x3E,0xA3,0x99,0xAA,0x17,0x82,0x17,0x82,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,
-	0xF3,0x81,0xF3,0x81,0xF3,0x81,0xB2,0x71,0x90,0x61,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x78,0x31,0x35,0x31,0x13,0x29,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD3,0x10,
-	0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD5,0x18,0x37,0x19,0xD7,0x18,0xD7,0x18,0x39,0x19,0x19,0x21,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0x72,0x09,0xF1,0x20,0xAF,0x18,0xAD,0x18,0xA8,0x18,0xA7,0x00,0x65,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x67,0x08,0x68,0x08,0x69,0x08,0x6B,0x08,0x6D,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0x70,0x10,0x72,0x10,0xD3,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,0x5C,0x29,0x5C,0x31,0x5C,0x31,0xBD,0x39,0x5E,0x31,0xDF,0x31,
-	0xDF,0x31,0x5E,0x31,0xDE,0x49,0xDF,0x31,0xDE,0x49,0xDE,0x49,0xDF,0x31,0xDF,0x31,0xDE,0x49,0x5E,0x31,0xDF,0x31,0xDF,0x31,0x7D,0x41,0xBD,0x39,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0x3D,0x5A,0x3D,0x5A,0x3F,0x5A,0x3D,0x5A,0x3F,0x5A,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,
-	0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x3D,0x5A,0x3D,0x5A,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x7A,0x41,0x78,0x31,0x19,0x21,0x78,0x31,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD1,0x18,0xAF,0x18,0x6D,0x18,0x6D,0x18,0x6B,0x10,0x6B,0x10,0x68,0x18,0x66,0x10,
-	0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x24,0x08,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x08,0xE3,0x18,
-	0xDC,0x59,0xDD,0x69,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDE,0xAA,0x5F,0xA3,0x5F,0xB3,0xDF,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x9F,0xD4,0xFF,0xD3,0xFF,0xD3,
-	0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x3E,0xBB,0x3E,0xA3,0x59,0x92,0x17,0x82,0x17,0x82,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF3,0x81,0x17,0x82,0xF3,0x81,0xF5,0x69,0xB2,0x71,0xB2,0x71,0xB1,0x49,0x6E,0x51,0x6E,0x51,0x51,0x41,0x0E,0x41,0x51,0x41,0x31,0x31,0xF1,0x20,0x31,0x31,0x31,0x31,0x13,0x29,0x13,0x29,
-	0x35,0x31,0x77,0x41,0x77,0x41,0x7A,0x41,0x77,0x41,0x7A,0x41,0x19,0x52,0x7A,0x41,0x78,0x31,0x35,0x31,0x37,0x19,0x37,0x19,0xD5,0x18,0xD5,0x18,0x37,0x19,0xD7,0x18,0x37,0x19,0x37,0x19,0x39,0x19,0x39,0x19,0x19,0x21,0x3B,0x19,0x5C,0x29,0x3B,0x19,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x3B,0x19,0x19,0x21,
-	0x37,0x19,0x37,0x19,0x13,0x29,0x72,0x09,0x2E,0x09,0xAB,0x10,0x2A,0x01,0xA7,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x68,0x08,0x69,0x08,0x6D,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,
-	0xD1,0x18,0x72,0x10,0xD3,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0xFB,0x18,0x5C,0x31,0x5C,0x31,0x5E,0x31,0xDF,0x31,0xDF,0x31,0x7D,0x41,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDE,0x49,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDE,0x49,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xBD,0x39,0xDF,0x31,
-	0xBD,0x39,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xDD,0x49,0xFE,0x51,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3C,0x4A,0xDE,0x49,0xDD,0x49,0xDD,0x49,0xBD,0x39,0xBD,0x39,0xBD,0x39,0x5C,0x31,0x5C,0x31,
-	0x19,0x21,0x19,0x21,0x19,0x21,0xD7,0x18,0xD5,0x18,0xD5,0x18,0x13,0x29,0x72,0x10,0xD1,0x18,0x6F,0x10,0xAD,0x18,0x6D,0x18,0xAB,0x10,0x6B,0x10,0x68,0x18,0x68,0x18,0x67,0x08,0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x43,0x10,0x63,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x08,0xE3,0x18,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0xA3,0x5F,0xB3,0xDF,0xB3,0xDF,0xCB,0xDF,0xCB,
-	0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xFC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x9F,0xD4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x3E,0xBB,0xBC,0x9A,0x59,0x92,0x17,0x82,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF3,0x81,0x17,0x82,0xF3,0x81,0x17,0x82,
-	0xF3,0x81,0xF5,0x69,0xB2,0x71,0x6E,0x51,0x6E,0x51,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x77,0x41,0x7A,0x41,0x7A,0x41,0x9A,0x49,0x3C,0x4A,0x7A,0x41,0x19,0x52,0x78,0x31,0x78,0x31,0x78,0x31,0x37,0x19,0xD7,0x18,0xD7,0x18,0x37,0x19,0x19,0x21,0x39,0x19,
-	0x19,0x21,0x3B,0x19,0x19,0x21,0x5C,0x29,0x5C,0x29,0x5C,0x29,0xBD,0x29,0xBE,0x29,0xBD,0x29,0x5E,0x29,0xBE,0x29,0x5E,0x29,0xBD,0x29,0xBD,0x29,0xBD,0x29,0xBD,0x29,0x78,0x31,0x37,0x19,0x34,0x19,0xF1,0x20,0x2E,0x09,0xCA,0x00,0xA8,0x00,0x65,0x08,0x64,0x00,0x64,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x67,0x08,0x69,0x08,0x6B,0x08,0xAD,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x5C,0x31,0x5E,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xDF,0x31,0xDE,0x49,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xDD,0x49,
-	0xBD,0x39,0xDD,0x49,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0x5C,0x31,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x19,0x21,0xFB,0x18,0x19,0x21,0x19,0x21,0x19,0x21,0xD7,0x18,0x13,0x29,0xD5,0x18,0xD3,0x10,0xD1,0x18,0xAF,0x18,0x6F,0x10,0x6D,0x18,0xAD,0x18,0x6B,0x10,0xAB,0x10,0x68,0x18,0xA8,0x18,
-	0x68,0x18,0xA7,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x64,0x08,0x64,0x08,0x23,0x08,0x22,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,
-	0xDD,0x69,0xDD,0x69,0x3E,0x62,0x7F,0x6A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0x3E,0xA3,0x5F,0xA3,0x3E,0xA3,0x5F,0xB3,0xDF,0xCB,0x5F,0xC4,0xFF,0xD3,0x9F,0xD4,0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,
-	0xDF,0xCB,0xDF,0xCB,0x3E,0xBB,0x3E,0xA3,0xBC,0x9A,0x17,0x82,0x17,0x82,0x17,0x82,0xF5,0x69,0xF3,0x81,0x17,0x82,0xF3,0x81,0x17,0x82,0x55,0x9A,0x17,0x82,0xF3,0x81,0xF5,0x69,0xB2,0x71,0x90,0x61,0x51,0x41,0x51,0x41,0x6E,0x51,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0xF1,0x20,0x13,0x29,0x13,0x29,0x35,0x31,0x77,0x41,0x78,0x31,
-	0x7A,0x41,0x7A,0x41,0xDD,0x49,0xDD,0x49,0x3C,0x4A,0x7A,0x41,0xBD,0x39,0x78,0x31,0x37,0x19,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x3B,0x19,0x5C,0x29,0xBD,0x29,0x5C,0x29,0xBD,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBD,0x29,0xBD,0x29,
-	0x78,0x31,0xB6,0x11,0x34,0x19,0xAF,0x18,0xAB,0x00,0xA8,0x00,0xA7,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x25,0x00,0x27,0x00,0x69,0x08,0x6B,0x08,0x6D,0x18,0xAF,0x18,0xD1,0x18,
-	0xD3,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x3C,0x11,0x5C,0x29,0x5E,0x31,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x31,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xBD,0x39,0x5E,0x31,0x5E,0x31,0xBD,0x29,0x5E,0x31,0x5C,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,
-	0xFB,0x18,0x19,0x21,0xD7,0x18,0xD7,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0x6D,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0x69,0x08,0xA8,0x18,0x68,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x64,0x08,0x63,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x08,0xE3,0x18,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0xA3,0x5F,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0xFF,0xD3,0x9F,0xD4,
-	0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0x9F,0xD4,0xDF,0xFC,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x3E,0xBB,0xBD,0xA3,0xBC,0x9A,0x59,0x92,0x17,0x82,0x17,0x82,0xF5,0x69,0xF3,0x81,0x17,0x82,0x17,0x82,0x55,0x9A,0x17,0x82,0x55,0x9A,0x17,0x82,0xF5,0x69,
-	0xB2,0x71,0x90,0x61,0x51,0x41,0x90,0x61,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x78,0x31,0x77,0x41,0x7A,0x41,0xDD,0x49,0x3C,0x4A,0x3F,0x42,0xDD,0x49,0xDD,0x49,0xBD,0x39,0xBD,0x39,0x19,0x21,0x3B,0x19,0x19,0x21,0x19,0x21,0x3B,0x19,0xFB,0x18,0x3B,0x19,0x5C,0x29,0xBD,0x29,
-	0xBD,0x29,0xBD,0x29,0xBD,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBD,0x29,0xBD,0x29,0xB9,0x11,0x37,0x19,0xD3,0x10,0xCD,0x00,0xCA,0x00,0x67,0x00,0x66,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x28,0x00,0x6A,0x08,0x6C,0x08,0xAF,0x18,0xD1,0x18,0xD3,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFC,0x10,0x3C,0x11,0x3C,0x11,0x3E,0x19,0x3E,0x19,0x5E,0x29,
-	0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBD,0x39,0xDF,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,
-	0xBD,0x29,0x5E,0x31,0xBD,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0xBD,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0xFB,0x18,0xFB,0x18,0x19,0x21,0x19,0x21,0xD7,0x18,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xCD,0x00,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,
-	0xAB,0x10,0xA8,0x18,0xA8,0x18,0x68,0x18,0xA7,0x18,0xA7,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0xC5,0x18,0x64,0x08,0x63,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x08,0xE3,0x18,
-	0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x3E,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0xDF,0xFC,0x3F,0xE4,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0x3E,0xBB,
-	0xDF,0xB3,0x3E,0xBB,0xDB,0xB2,0x59,0x92,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0xF3,0x81,0x17,0x82,0x55,0x9A,0x17,0x82,0x17,0x82,0xB2,0x71,0x95,0x59,0x51,0x41,0x74,0x41,0x51,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0xDD,0x49,
-	0xDD,0x49,0x3C,0x4A,0xDE,0x49,0x3F,0x42,0xBD,0x39,0x5C,0x31,0x5C,0x29,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0xBD,0x29,0xBD,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0x3F,0x22,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBD,0x29,
-	0x37,0x19,0x34,0x19,0xB1,0x08,0xAB,0x00,0x69,0x00,0x66,0x00,0x65,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0x62,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x29,0x00,0x6B,0x08,0x6F,0x10,0xD1,0x18,
-	0xD3,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3C,0x11,0xFC,0x10,0x3C,0x11,0xFC,0x10,0x3E,0x19,0xFB,0x18,0x3E,0x19,0x3C,0x11,0x5C,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDE,0x49,0xDF,0x31,0x3F,0x42,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xBD,0x39,
-	0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x31,0xBD,0x29,0xDF,0x31,0xBD,0x29,0xBE,0x29,0x5E,0x31,0xBD,0x29,0x5E,0x29,0xBD,0x29,0x5E,0x29,0xBD,0x29,0x5E,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,
-	0x3B,0x19,0x19,0x21,0x39,0x19,0xD7,0x18,0x37,0x19,0xD5,0x18,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x65,0x10,0x64,0x08,0x63,0x08,0x22,0x08,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x3E,0xA3,0x5F,0xA3,0xDF,0xB3,0xDF,0xCB,0xDF,0xCB,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,
-	0x9F,0xD4,0x3F,0xE4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x3F,0xE4,0x3F,0xE4,0x9F,0xD4,0xFF,0xD3,0x9F,0xD4,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0x5F,0xB3,0x3E,0xBB,0xFD,0x9A,0x59,0x92,0x17,0x82,0x17,0x82,0xF5,0x69,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0xF5,0x69,0xB2,0x71,
-	0x74,0x41,0x90,0x61,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0xDD,0x49,0xDD,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0xDF,0x31,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x3C,0x11,0x5C,0x29,0x5C,0x29,0x3E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBD,0x29,0x39,0x19,0x37,0x19,0xB3,0x08,0xCF,0x08,0x6B,0x00,0xA8,0x00,0x66,0x00,0x64,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0xA1,0x00,0x62,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,
-	0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x29,0x00,0x2A,0x00,0x6C,0x08,0xD1,0x18,0xD3,0x10,0xD5,0x18,0x37,0x19,0x19,0x21,0xFB,0x18,0xFB,0x18,0x3C,0x11,0x3E,0x19,0x3E,0x19,0x3C,0x11,0x3E,0x19,0xFC,0x10,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,
-	0x3E,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0x3F,0x42,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xBD,0x29,
-	0xDF,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x3B,0x19,0x19,0x21,0x19,0x21,0x37,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,
-	0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x64,0x08,0x63,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x08,0xE3,0x18,
-	0x5E,0x7A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0x3E,0xA3,0x5F,0xA3,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0x5F,0xC4,0xFF,0xD3,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0x9F,0xD4,0x3F,0xE4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0xDF,0xB3,0x3E,0xBB,
-	0x3E,0xA3,0xBC,0x9A,0x39,0x72,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0x17,0x82,0x95,0x59,0x90,0x61,0x95,0x59,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7D,0x41,0xDD,0x49,0x3C,0x4A,0xFE,0x51,
-	0x3F,0x42,0x3F,0x42,0xDE,0x49,0x5E,0x31,0x5C,0x29,0x3E,0x19,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x3E,0x22,0xDF,0x31,0x3E,0x22,0x5F,0x2A,0x3F,0x42,0xDF,0x31,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0xBE,0x29,0xBD,0x29,0x3B,0x19,0x39,0x19,
-	0x34,0x01,0xB1,0x08,0xCF,0x08,0xAB,0x00,0xA7,0x00,0x66,0x00,0x64,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x28,0x00,0x2A,0x00,0x6B,0x00,0x6E,0x08,
-	0xD1,0x18,0xD5,0x18,0xD7,0x18,0x39,0x19,0x3B,0x19,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x3F,0x42,0xDF,0x31,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xDF,0x31,0x3F,0x42,0xDF,0x31,
-	0xBD,0x39,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x29,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,
-	0x5C,0x29,0x5C,0x29,0x3B,0x19,0x19,0x21,0x19,0x21,0x37,0x19,0xD5,0x18,0x34,0x19,0x34,0x19,0xD3,0x10,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xED,0x28,0xAD,0x18,0xED,0x28,0xAD,0x18,0xAB,0x10,0xCA,0x28,0xCA,0x28,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x66,0x10,0x64,0x08,0x63,0x08,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0x3E,0xA3,0x3E,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,
-	0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0xFF,0xD3,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x3E,0xBB,0x3E,0xA3,0xBC,0x9A,0x59,0x92,0x17,0x82,0x17,0x82,0x39,0x72,0x17,0x82,0x17,0x82,0x17,0x82,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0xF5,0x69,0x95,0x59,0x95,0x59,
-	0x74,0x41,0x74,0x41,0x95,0x59,0x74,0x41,0x74,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x19,0x21,0x7A,0x41,0x7A,0x41,0x7D,0x41,0xDD,0x49,0xDE,0x49,0xFE,0x51,0x3F,0x42,0x3F,0x42,0xDE,0x49,0x5E,0x31,0x5E,0x31,0x5E,0x29,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,
-	0x5F,0x2A,0x5F,0x2A,0x3F,0x42,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x3F,0x42,0x5F,0x2A,0xDF,0x31,0xBE,0x29,0xBD,0x29,0x3C,0x11,0x39,0x19,0xD7,0x08,0x34,0x01,0xB1,0x08,0xCD,0x00,0xAB,0x00,0xA8,0x00,0xA7,0x00,0xA4,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x2A,0x00,0x6C,0x08,0x71,0x08,0xD3,0x10,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x3E,0x19,0x3F,0x19,
-	0x3E,0x19,0x3F,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xBD,0x39,0x3F,0x42,0x3F,0x42,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBE,0x29,
-	0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x29,0xBD,0x29,0x5E,0x29,0xBD,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x19,0x21,0x19,0x21,0x37,0x19,0x37,0x19,0x34,0x19,0x13,0x29,0x34,0x19,0xD1,0x18,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,
-	0xAD,0x18,0xED,0x28,0xAB,0x10,0xED,0x28,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xCA,0x28,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x65,0x10,0x64,0x08,0x63,0x08,0x22,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,
-	0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xFD,0x9A,0x5F,0x9B,0x5F,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0xFF,0xD3,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0xFF,0xD3,0x5F,0xC4,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0x3E,0xA3,0xFD,0x9A,
-	0x59,0x92,0x39,0x72,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x5B,0x82,0x59,0x92,0x5B,0x82,0x59,0x92,0x59,0x92,0x17,0x82,0x17,0x82,0x95,0x59,0x95,0x59,0x51,0x41,0x95,0x59,0x95,0x59,0x74,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7D,0x41,0xDD,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x42,0x3F,0x5A,
-	0x3F,0x42,0xDF,0x31,0x5E,0x31,0x5C,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0xBE,0x29,0xBE,0x29,0x3C,0x11,0x3B,0x19,0x59,0x09,0x37,0x09,
-	0xD5,0x08,0x31,0x09,0xCF,0x08,0xCD,0x00,0xA8,0x00,0xA7,0x00,0x65,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2C,0x00,
-	0x6E,0x08,0x71,0x08,0xD5,0x18,0xD9,0x08,0x3B,0x19,0x3E,0x19,0x3E,0x19,0x3F,0x19,0x3F,0x19,0x3E,0x19,0x3E,0x19,0x7E,0x19,0x3E,0x19,0x3E,0x19,0x1E,0x11,0x3F,0x19,0x7E,0x19,0x3F,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,
-	0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x5F,0x2A,0xBD,0x39,0x5F,0x2A,0xBD,0x39,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x29,
-	0xBD,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x78,0x31,0x19,0x21,0x37,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xED,0x28,0xAF,0x18,0xED,0x28,0xAD,0x18,0xED,0x28,0xCA,0x28,0xCA,0x28,0xAB,0x10,0xAB,0x10,0xA8,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x66,0x08,0xC5,0x18,0x64,0x08,
-	0x63,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,0x3E,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,
-	0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0xFF,0xD3,0x5F,0xC4,0x5F,0xC4,0xFF,0xD3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0x5F,0xA3,0x3E,0xA3,0x5B,0x82,0x39,0x72,0x17,0x82,0x39,0x72,0x17,0x82,0x5B,0x82,0x5B,0x82,0x59,0x92,0x5B,0x82,0xBC,0x9A,0x5B,0x82,0x5B,0x82,0x17,0x82,0xF5,0x69,0x95,0x59,0x95,0x59,0x74,0x41,
-	0x74,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x78,0x31,0x35,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7D,0x41,0xDD,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0xDF,0x31,0x5E,0x31,0x5E,0x29,0x5C,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5F,0x2A,0xDF,0x31,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,
-	0x9F,0x3A,0x3C,0x4A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0xDF,0x31,0x3F,0x22,0xBE,0x29,0x7E,0x19,0x3C,0x11,0x3B,0x19,0xD9,0x08,0x37,0x09,0x34,0x01,0xB3,0x08,0x31,0x09,0xCD,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0xA4,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA4,0x08,0xA3,0x00,0xA4,0x08,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2C,0x00,0x6E,0x08,0x71,0x08,0x72,0x08,0xD7,0x18,0xFB,0x18,0x5C,0x29,0x7E,0x19,0x5E,0x29,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x3E,0x19,
-	0x3E,0x19,0x7E,0x19,0x3F,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x5F,0x2A,0x3F,0x42,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0xDF,0x31,
-	0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xBD,0x29,0xBE,0x29,0xBD,0x29,0x5C,0x29,0xBD,0x29,0x5C,0x29,0x78,0x31,0x19,0x21,0x35,0x31,0x37,0x19,0x34,0x19,0x34,0x19,0xF1,0x20,0xF1,0x20,0xF1,0x20,
-	0xF1,0x20,0xED,0x28,0xAF,0x18,0xED,0x28,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xCA,0x28,0xAB,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0x66,0x10,0x66,0x10,0x65,0x10,0x64,0x08,0x62,0x08,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,
-	0xDF,0x8A,0xFD,0x9A,0x5F,0x9B,0x3E,0xA3,0xBD,0xA3,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0xFF,0xD3,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0x5F,0xB3,0x5F,0xA3,0xFD,0x9A,0xBC,0x9A,0x5B,0x82,
-	0x17,0x82,0x39,0x72,0x17,0x82,0x39,0x72,0x17,0x82,0x5B,0x82,0x5B,0x82,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0x5B,0x82,0xF5,0x69,0x95,0x59,0x95,0x59,0x74,0x41,0x95,0x59,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x78,0x31,0x19,0x21,0x7A,0x41,0x7A,0x41,0x7D,0x41,0xDD,0x49,0x3F,0x42,0xFE,0x51,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,
-	0xDF,0x31,0xBE,0x29,0x5C,0x29,0x5E,0x29,0x5E,0x29,0xBD,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0xBE,0x29,0xBE,0x29,0x7E,0x19,0x1E,0x11,0xFC,0x10,0xFC,0x10,0x3B,0x19,0x39,0x19,
-	0x37,0x09,0x34,0x01,0x31,0x09,0x2E,0x09,0xAB,0x00,0xA8,0x00,0xA7,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0x23,0x09,0xA4,0x08,0x23,0x09,0xA4,0x08,0xA3,0x00,0x23,0x09,0xA3,0x00,0xA4,0x08,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x67,0x00,0x28,0x00,0x2A,0x00,
-	0x2C,0x00,0x6E,0x08,0x72,0x08,0x75,0x00,0xD9,0x08,0x3B,0x19,0x5C,0x29,0x7F,0x19,0x5E,0x29,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0xDF,0x42,
-	0x3F,0x42,0xDF,0x42,0x3F,0x42,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x5F,0x2A,0x3F,0x42,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0xDF,0x31,0x9F,0x3A,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBE,0x29,
-	0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0xBD,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x78,0x31,0x19,0x21,0x35,0x31,0x34,0x19,0x34,0x19,0x34,0x19,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xED,0x28,0xAF,0x18,0xED,0x28,0xED,0x28,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0x66,0x08,0xC5,0x18,
-	0x64,0x08,0x63,0x08,0x23,0x08,0x22,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0xDF,0x8A,0x5F,0x9B,0x3E,0xA3,0xBD,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,
-	0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0x5B,0x82,0x39,0x72,0x39,0x72,0x17,0x82,0x39,0x72,0x5B,0x82,0x5B,0x82,0xBC,0x9A,0xBC,0x9A,0xFD,0x9A,0xBC,0x9A,0x5B,0x82,0x39,0x72,0x95,0x59,0x95,0x59,0x74,0x41,0x95,0x59,0x77,0x41,
-	0x77,0x41,0x77,0x41,0x35,0x31,0x19,0x21,0x19,0x21,0x7A,0x41,0x7D,0x41,0x7D,0x41,0xDE,0x49,0xDE,0x49,0x3F,0x5A,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0xDE,0x49,0xDF,0x31,0xBD,0x29,0x5E,0x29,0x5C,0x29,0x5E,0x29,0xBD,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,
-	0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0xBE,0x29,0xBE,0x29,0x7E,0x19,0x1E,0x11,0x1E,0x11,0x5C,0x09,0x3C,0x11,0xFC,0x10,0x5A,0x09,0x39,0x19,0x37,0x19,0x72,0x09,0x31,0x09,0x2E,0x09,0x2A,0x01,0xA8,0x00,0xA7,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0x23,0x09,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,
-	0x23,0x09,0xA4,0x08,0xA4,0x08,0xA4,0x08,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x65,0x00,0x65,0x00,0x26,0x00,0x66,0x00,0x27,0x00,0x29,0x00,0x2A,0x00,0x2C,0x00,0x6E,0x08,0x71,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0x3C,0x11,0x5E,0x29,0xBE,0x29,0xBE,0x29,0x7E,0x19,0xBE,0x29,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,
-	0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x42,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,
-	0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x5F,0x2A,0x3F,0x42,0x3F,0x42,0x5F,0x2A,0xDF,0x31,0x3E,0x22,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x29,0xBD,0x29,0x5C,0x29,0xBD,0x29,0x3B,0x19,0x78,0x31,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0xF1,0x20,
-	0xF1,0x20,0xF1,0x20,0xF1,0x20,0xED,0x28,0xAF,0x18,0xAD,0x18,0xED,0x28,0xAB,0x10,0xAB,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0x68,0x18,0xA7,0x18,0xA7,0x18,0x66,0x08,0x65,0x08,0x65,0x10,0x63,0x08,0x63,0x08,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,
-	0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,0xFD,0x9A,0x5B,0x82,0x39,0x72,0x39,0x72,
-	0x5B,0x82,0x39,0x72,0x5B,0x82,0x5B,0x82,0x5C,0x92,0xBC,0x9A,0xFD,0x9A,0xFD,0x9A,0xBD,0x8A,0x5B,0x82,0xF5,0x69,0x95,0x59,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x78,0x31,0x19,0x21,0x78,0x31,0x7A,0x41,0x7D,0x41,0x7D,0x41,0xDD,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xDF,0x31,
-	0x5E,0x29,0xBD,0x29,0x5E,0x29,0xBD,0x29,0xBD,0x29,0xBE,0x29,0xDF,0x31,0x3E,0x22,0xDF,0x31,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0xDF,0x31,0xBE,0x29,0x7E,0x19,0x7E,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x5C,0x09,0x3B,0x19,
-	0x39,0x19,0x59,0x09,0x34,0x19,0x72,0x09,0x2E,0x09,0xAB,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x27,0x00,0x67,0x00,0x69,0x00,0x6A,0x00,
-	0x2C,0x00,0x6E,0x08,0x71,0x08,0x72,0x08,0xD7,0x08,0xD9,0x08,0x3C,0x11,0x7E,0x19,0x7F,0x19,0xBF,0x19,0xBE,0x29,0xBF,0x19,0xBE,0x29,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,
-	0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0xDF,0x42,0x3F,0x42,0xDF,0x42,0x3F,0x42,0xDF,0x42,0x9F,0x3A,0xDF,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x5F,0x2A,0x3F,0x42,0xDF,0x31,0x3F,0x42,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xBE,0x29,
-	0xBE,0x29,0xDF,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0xBD,0x29,0x5C,0x29,0x19,0x21,0x19,0x21,0x39,0x19,0x35,0x31,0x34,0x19,0x34,0x19,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xED,0x28,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xA8,0x18,0xAB,0x10,0x68,0x18,0x68,0x18,0xA7,0x18,0x67,0x08,0x66,0x08,
-	0x65,0x10,0x65,0x08,0x64,0x08,0x64,0x08,0x22,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x5F,0x9B,0xBD,0xA3,0xDF,0xAB,0xDF,0xB3,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,
-	0x9F,0xD4,0x5F,0xC4,0x9F,0xD4,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0x5B,0x82,0x39,0x72,0x39,0x72,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0xBC,0x9A,0xFD,0x9A,0xFD,0x9A,0xFD,0x9A,0x5B,0x82,0x39,0x72,0x95,0x59,0x77,0x41,0x95,0x59,0x77,0x41,0x9A,0x49,0x9A,0x49,
-	0x77,0x41,0x78,0x31,0x7A,0x41,0x5C,0x31,0x5C,0x31,0x5C,0x31,0xDD,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0x5E,0x31,0x5E,0x31,0xBD,0x29,0x5E,0x29,0xBD,0x29,0xDF,0x31,0xDF,0x31,0xBD,0x39,0xDF,0x31,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,
-	0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0xBE,0x29,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7F,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x5C,0x09,0x3C,0x11,0xBB,0x11,0x37,0x19,0x72,0x09,0xCF,0x08,0xCD,0x00,0x2A,0x01,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,
-	0xA7,0x00,0xA7,0x00,0xA7,0x00,0x2A,0x01,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0x67,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6E,0x08,0x71,0x08,0x75,0x00,0x75,0x00,0xD9,0x08,0xFC,0x10,0x3C,0x11,0x7E,0x19,0x7E,0x19,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x19,0xBE,0x29,
-	0xBE,0x19,0xBE,0x29,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x9F,0x3A,0x3F,0x42,0x3F,0x42,0x9F,0x3A,0xDF,0x42,0x3F,0x42,0xDF,0x42,0x3F,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x3F,0x42,
-	0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x29,0xBE,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0x19,0x21,0x78,0x31,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0xF1,0x20,
-	0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xA8,0x18,0xA8,0x18,0x69,0x08,0xA8,0x18,0x67,0x08,0x66,0x08,0x66,0x08,0x65,0x08,0x65,0x10,0x64,0x08,0x63,0x08,0x22,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0xA2,0x10,
-	0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x9F,0xD4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xA3,0x3E,0xA3,0xFD,0x9A,0x5B,0x82,0x5B,0x82,0x39,0x72,0x5B,0x82,
-	0x39,0x72,0x5B,0x82,0x5B,0x82,0xBD,0x8A,0xFD,0x9A,0xFD,0x9A,0xDF,0x92,0xBD,0x8A,0x39,0x72,0xD9,0x61,0x95,0x59,0x77,0x41,0x77,0x41,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x19,0x21,0x7A,0x41,0x7D,0x41,0xBD,0x39,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0xDF,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x29,
-	0x5E,0x31,0xBD,0x29,0xBE,0x29,0xBD,0x39,0x3E,0x22,0xDF,0x31,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBE,0x29,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x11,0x7F,0x11,0x7F,0x11,0x7E,0x09,0x7E,0x11,0xBD,0x19,
-	0xBD,0x19,0xBB,0x11,0x39,0x19,0x75,0x09,0x31,0x09,0xCD,0x00,0xCA,0x00,0x2A,0x01,0x2A,0x01,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x2A,0x01,0xA7,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,
-	0x2C,0x00,0x6E,0x08,0x71,0x08,0x72,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x5C,0x09,0x7E,0x11,0x7E,0x19,0xBF,0x19,0xBF,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x5E,0x29,0x5E,0x29,
-	0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0x3F,0x42,0x3F,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x3F,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0xDF,0x42,0x3F,0x42,0xDF,0x42,0x3F,0x42,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x3F,0x42,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,
-	0xDF,0x31,0x5E,0x29,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0xBD,0x29,0x19,0x21,0x39,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0xD3,0x10,0xF1,0x20,0xD1,0x18,0xF1,0x20,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0x69,0x08,0xA8,0x18,0x69,0x08,0x68,0x18,0x68,0x08,0xA7,0x18,0x66,0x08,
-	0x66,0x08,0x66,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0xA2,0x10,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x9F,0xD4,0x9F,0xD4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x5F,0xC4,
-	0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0xFD,0x9A,0xBD,0x8A,0x5B,0x82,0x5B,0x82,0x39,0x72,0x5B,0x82,0x5B,0x82,0x5C,0x92,0xBD,0x8A,0xBC,0x9A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5B,0x82,0xD9,0x61,0x95,0x59,0x77,0x41,0x77,0x41,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x78,0x31,
-	0x7A,0x41,0xFB,0x18,0x5C,0x31,0x7D,0x41,0xBD,0x39,0xDD,0x49,0xDE,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0x5E,0x31,0xBD,0x29,0x5E,0x29,0x5E,0x29,0xBD,0x29,0xBD,0x29,0xBD,0x29,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,
-	0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0xBE,0x29,0xBD,0x29,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x11,0xBF,0x19,0xBE,0x09,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBD,0x19,0xB9,0x11,0x75,0x09,0xB1,0x08,0x2E,0x09,0xCD,0x00,0x2A,0x01,0xA7,0x00,0x2A,0x01,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,
-	0x2A,0x01,0x2A,0x01,0x2A,0x01,0xCA,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x6A,0x00,0x6B,0x00,0x6E,0x08,0x71,0x08,0x75,0x00,0x75,0x00,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x7E,0x11,0x7F,0x19,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x29,
-	0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0x7E,0x19,0xBE,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x5E,0x29,0x7E,0x19,0x7F,0x19,0x5E,0x29,0x7F,0x19,0x7F,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0xDF,0x42,0x9F,0x3A,0x3F,0x42,0xDF,0x42,
-	0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x3F,0x42,0x9F,0x3A,0x3F,0x42,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0x3B,0x19,0x19,0x21,0x39,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0xD1,0x18,0xD1,0x18,0xAF,0x18,
-	0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0x69,0x08,0x69,0x08,0x68,0x08,0x68,0x18,0x68,0x08,0x68,0x08,0x67,0x08,0x67,0x08,0x66,0x08,0x66,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x23,0x08,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0xA2,0x10,
-	0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xBD,0x8A,0x5B,0x82,0x5B,0x82,0x39,0x72,0x1C,0x7A,0x5B,0x82,
-	0x5B,0x82,0x5E,0x82,0xFD,0x9A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xBD,0x8A,0x1C,0x7A,0xD9,0x61,0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x5C,0x31,0x5C,0x31,0x7D,0x41,0xBD,0x39,0xDE,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDE,0x49,0x5E,0x31,0x5C,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x29,
-	0xBE,0x29,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0x9F,0x3A,0x3C,0x4A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0xBD,0x29,0xBE,0x19,0xBE,0x19,0x7E,0x19,0xBF,0x19,0xBF,0x19,0xBF,0x19,0xBF,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,
-	0xBE,0x19,0xBD,0x29,0x39,0x19,0x75,0x09,0x31,0x09,0xCF,0x08,0x2E,0x09,0x2A,0x01,0x2A,0x01,0xA8,0x00,0xA7,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x6A,0x00,
-	0x6B,0x00,0x6C,0x08,0x71,0x08,0xB3,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x7E,0x09,0x1E,0x11,0x7F,0x11,0x7F,0x19,0xBE,0x19,0xBE,0x29,0x3F,0x22,0xBE,0x29,0xBF,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,
-	0x7F,0x19,0x7E,0x19,0x7F,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0x9F,0x3A,0x3F,0x42,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0xBE,0x29,0xBE,0x29,0x5E,0x29,
-	0x5E,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x3B,0x19,0x39,0x19,0x19,0x21,0x37,0x19,0x37,0x19,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0x6F,0x10,0xCF,0x08,0x6C,0x08,0x6B,0x08,0xAB,0x00,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x67,0x08,0x68,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,
-	0x66,0x10,0x66,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x23,0x08,0x22,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0xA2,0x10,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,
-	0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0xFD,0x9A,0xBD,0x8A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xBD,0x8A,0xD9,0x61,0xD9,0x61,0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x5C,0x31,0x19,0x21,
-	0x5C,0x31,0x5C,0x31,0x5C,0x31,0xDF,0x31,0xBD,0x39,0xDE,0x49,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xBD,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0x3E,0x22,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,
-	0x3E,0x22,0x3E,0x22,0xBD,0x19,0xBD,0x19,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBF,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x09,0x3F,0x22,0xBE,0x19,0x3F,0x22,0x3F,0x22,0xBD,0x19,0xBD,0x19,0xB9,0x11,0x37,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0x2A,0x01,0x2A,0x01,0xA7,0x00,0xA7,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2A,0x01,0x2E,0x09,0x2A,0x01,0xAB,0x00,0x2A,0x01,0xAB,0x10,0x2A,0x01,0xA8,0x18,0xA8,0x00,0xA8,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6E,0x08,0x71,0x08,0xB3,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x7E,0x09,0x7F,0x11,0x7F,0x11,0xBF,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,
-	0xBE,0x29,0x3E,0x22,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0x7E,0x19,0xBE,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x29,0x7E,0x19,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,
-	0xDF,0x31,0x3E,0x22,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0x3C,0x11,0xFB,0x18,0x3B,0x19,0xFB,0x18,0xD9,0x08,0x39,0x19,0xD7,0x18,0xD7,0x08,0xD5,0x18,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,
-	0x6B,0x08,0x2A,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x67,0x08,0x27,0x08,0x27,0x08,0x26,0x08,0x67,0x08,0x66,0x08,0x67,0x08,0x66,0x08,0x66,0x08,0x25,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x60,0x08,0xA2,0x10,
-	0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5E,0x82,0x5B,0x82,0x39,0x72,0x5B,0x82,0x1C,0x7A,0x5C,0x92,0x5E,0x82,
-	0xFD,0x9A,0xFD,0x9A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xBD,0x8A,0x1C,0x7A,0xD9,0x61,0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDD,0x49,0x7A,0x41,0x7A,0x41,0x5C,0x31,0x5C,0x31,0xBD,0x39,0xBD,0x39,0xDE,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xDF,0x31,0x5C,0x29,0x5C,0x29,0xBD,0x29,0x5E,0x29,0xBE,0x29,0xDF,0x31,
-	0xBE,0x29,0xBD,0x39,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBD,0x29,0xBD,0x19,0x7E,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBF,0x19,0xBF,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0xBE,0x19,0x3F,0x22,0x3F,0x22,0xBE,0x19,
-	0x3E,0x22,0xBB,0x11,0x59,0x09,0x75,0x09,0x34,0x01,0x31,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xCA,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2E,0x09,0x2A,0x01,0x2E,0x09,0x2A,0x01,0x2E,0x09,0x2A,0x01,0xAB,0x00,0x2A,0x01,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0xA8,0x00,0x68,0x00,0x6A,0x00,
-	0x6B,0x00,0x6C,0x08,0x71,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xFC,0x10,0x5C,0x09,0x1E,0x11,0x1E,0x11,0x3F,0x11,0x7F,0x11,0x7E,0x11,0xBF,0x19,0xBE,0x29,0xBE,0x29,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0xBE,0x29,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x29,0x7E,0x19,0xBE,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,
-	0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0xFC,0x10,0xFB,0x18,0xD9,0x08,
-	0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0x75,0x10,0x75,0x10,0xD5,0x08,0x72,0x08,0xB3,0x08,0x71,0x08,0x71,0x08,0xCF,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x2C,0x00,0x2A,0x00,0x29,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x08,0x66,0x08,0x66,0x08,
-	0x66,0x08,0x66,0x08,0x66,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x64,0x08,0x63,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0xA2,0x10,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,
-	0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0xDF,0x8A,0x5B,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xBD,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x82,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDD,0x49,0x7A,0x41,0x5C,0x31,0x5C,0x29,0x5C,0x31,
-	0x5C,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xBD,0x29,0x5C,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0x9F,0x3A,0xDF,0x42,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,
-	0xBD,0x19,0xBD,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBD,0x19,0xBD,0x19,0xBB,0x11,0xB9,0x09,0x37,0x09,0x75,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0x2A,0x01,0x2A,0x01,0xA8,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,
-	0x2A,0x01,0x2E,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0xB3,0x08,0xD5,0x08,0xD9,0x08,0x5A,0x09,0xFC,0x10,0x1E,0x11,0x7E,0x09,0x3F,0x11,0x7E,0x09,0x1E,0x11,0xBE,0x19,0xBF,0x19,0x3F,0x22,
-	0x3E,0x22,0xBE,0x29,0x3E,0x22,0xBE,0x29,0x3E,0x22,0x3E,0x22,0xBE,0x29,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x29,0x7E,0x19,0xBE,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3C,0x11,0x7E,0x19,0x7E,0x19,
-	0x7E,0x19,0x7E,0x19,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x1E,0x11,0x3C,0x11,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD7,0x18,0xD7,0x08,0xD7,0x08,0x75,0x10,0x75,0x00,0xB3,0x08,0x72,0x08,0xB3,0x08,0x71,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,
-	0x6A,0x00,0x69,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x66,0x08,0x66,0x08,0x25,0x08,0x66,0x08,0x25,0x00,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,
-	0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x9F,0xD4,0x5F,0xC4,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xBD,0x8A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5C,0x92,0xDF,0x92,
-	0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x8A,0x39,0x72,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDD,0x49,0x7A,0x41,0x7D,0x41,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0xDF,0x31,0xDE,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0x5E,0x31,0x5C,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,
-	0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBD,0x19,0xBD,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBD,0x19,
-	0xBD,0x09,0x5A,0x09,0x59,0x09,0x37,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x69,0x00,
-	0x2A,0x00,0x6C,0x08,0x6E,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x5C,0x09,0x1E,0x11,0x3F,0x11,0x3F,0x11,0x3F,0x11,0x7E,0x09,0x7E,0x11,0xBF,0x19,0xBE,0x29,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0xBE,0x29,0x3F,0x22,0xBE,0x19,0xBE,0x29,0xBE,0x29,0xBF,0x19,0xBF,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x19,
-	0x7F,0x19,0xBF,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x19,0x7E,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x1E,0x11,0x3C,0x11,0x1E,0x11,0x7E,0x11,0x1E,0x11,0x1E,0x11,0x3C,0x11,0x1E,0x11,0x1E,0x11,0x3C,0x11,0x1E,0x11,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD7,0x08,
-	0xD7,0x08,0xD7,0x08,0x75,0x10,0xD5,0x08,0x75,0x00,0xB3,0x08,0x72,0x10,0xB1,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0xCD,0x00,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x00,0x29,0x00,0x28,0x00,0x67,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
-	0x25,0x00,0x65,0x08,0x25,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x63,0x08,0x22,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0xE3,0x18,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,
-	0xDF,0xB3,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0xBD,0x8A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xBC,0x7A,0xDD,0x69,0x9A,0x49,0x77,0x41,0x9A,0x49,0x9A,0x49,0xDD,0x49,0x7D,0x41,0x5C,0x31,0x5C,0x31,0x5C,0x29,0x5C,0x31,
-	0x5C,0x31,0xDF,0x31,0xDE,0x49,0xDF,0x31,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xDF,0x31,0x5C,0x29,0x5E,0x29,0xBD,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x3E,0x22,0xBD,0x29,0xBD,0x19,0xBE,0x19,
-	0xBE,0x19,0xBE,0x19,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBD,0x09,0xBB,0x09,0x5A,0x09,0x59,0x09,0xB9,0x09,0x37,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,
-	0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x69,0x00,0x6A,0x00,0x6C,0x08,0x6E,0x08,0xB1,0x08,0xB3,0x08,0xD7,0x08,0xD9,0x08,0x5C,0x09,0x5C,0x09,0x3F,0x11,0x3F,0x11,0x3F,0x11,0x1E,0x11,0x7E,0x11,0x7E,0x11,0xBF,0x19,
-	0xBE,0x29,0x3F,0x22,0xBE,0x29,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0xBE,0x29,0x3F,0x22,0xBF,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x19,0xBF,0x19,0x7F,0x19,0xBE,0x19,0x7F,0x11,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x1E,0x11,0x7E,0x19,
-	0x7E,0x19,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x1E,0x11,0xFC,0x10,0x1E,0x11,0xFC,0x10,0x1E,0x11,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD7,0x18,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0x72,0x08,0xB3,0x08,0x71,0x08,0xB1,0x08,0x6E,0x08,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x00,
-	0x6B,0x00,0x69,0x00,0x68,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x65,0x08,0x65,0x08,0x25,0x08,0x64,0x08,0x65,0x08,0x63,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0xDF,0x8A,0x5E,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDF,0x92,
-	0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x1C,0x7A,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x7A,0x41,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x5C,0x31,0x5C,0x29,0x5C,0x31,0x5C,0x31,0xBD,0x39,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xDF,0x31,0x5E,0x29,0x5C,0x29,0x5E,0x29,0x5E,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0x3E,0x22,0x3F,0x42,
-	0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x3E,0x22,0x3E,0x22,0xBD,0x19,0xBE,0x19,0xBD,0x19,0x3E,0x22,0xBE,0x19,0xBE,0x19,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0xBE,0x09,0xBD,0x09,
-	0xBB,0x09,0x5A,0x09,0x5A,0x09,0xB9,0x09,0xB7,0x09,0xB7,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x69,0x00,
-	0x6B,0x00,0x6B,0x00,0xCF,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0xD9,0x08,0xFC,0x10,0x3C,0x11,0x7E,0x09,0x3F,0x11,0x3F,0x11,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x29,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x29,0x3F,0x22,0xBE,0x19,0xBE,0x29,0xBE,0x19,
-	0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBF,0x19,0xBE,0x19,0x7F,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x11,0x7F,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x1E,0x11,0x7E,0x11,0x7E,0x19,0x7E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD7,0x08,
-	0xD7,0x08,0x75,0x10,0xD5,0x08,0x75,0x00,0xD5,0x18,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x25,0x00,0x25,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,
-	0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x8A,0x5E,0x82,0x3C,0x6A,0x9A,0x49,0x77,0x41,0x7A,0x41,0x7A,0x41,0xDD,0x49,0x5C,0x31,0x5C,0x31,0x5C,0x29,0x5C,0x31,0x5C,0x29,0x5C,0x31,
-	0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xDF,0x31,0xBD,0x29,0x5C,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,
-	0x3E,0x22,0xBE,0x19,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x09,0xBD,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0xBB,0x09,0xB9,0x09,0xB9,0x09,0xB7,0x09,0xB7,0x09,0xB6,0x11,0x72,0x09,0x2E,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,
-	0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA7,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x69,0x00,0x6A,0x00,0x6C,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0x5A,0x09,0x5C,0x09,0x7E,0x11,0x3F,0x11,0x7E,0x09,0x3F,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,
-	0xBE,0x19,0xBE,0x19,0xBE,0x29,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0xBE,0x19,0x3F,0x22,0xBE,0x19,0x3F,0x22,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x7F,0x19,0xBF,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,
-	0x7E,0x19,0x3E,0x19,0x7F,0x11,0x1E,0x11,0x7F,0x19,0x3E,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0xFC,0x10,0x1E,0x11,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0xB1,0x08,0x71,0x08,0x71,0x08,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,
-	0x6B,0x08,0x6B,0x08,0x69,0x00,0x68,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x25,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x23,0x00,0x21,0x00,0x21,0x00,0x61,0x08,0xA2,0x10,
-	0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xBD,0xA3,0xDF,0xAB,0xBD,0xA3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0x5E,0x82,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,
-	0x5F,0xA3,0xDF,0x92,0xDF,0x8A,0x1C,0x7A,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7D,0x41,0xBD,0x39,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x3F,0x42,0xDF,0x31,0xBD,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,
-	0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x3E,0x22,0xBD,0x29,0xBE,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x09,0xBE,0x09,0x5C,0x09,0x5C,0x09,
-	0xBB,0x09,0xBB,0x09,0x5A,0x09,0xBB,0x09,0xB9,0x09,0xB9,0x09,0xB7,0x09,0xB7,0x09,0xB6,0x11,0x72,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA7,0x00,0x2A,0x01,0x2A,0x01,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x69,0x00,
-	0x6B,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x3B,0x19,0x3C,0x11,0x7E,0x11,0x7F,0x11,0x7E,0x11,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0xBE,0x19,
-	0x3F,0x22,0xBE,0x19,0x3F,0x22,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBF,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x11,0x7E,0x19,0x7F,0x19,0x3F,0x19,0x1E,0x11,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x1E,0x11,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD9,0x08,
-	0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x18,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0x71,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x00,0x69,0x00,0x67,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x61,0x08,0xA2,0x10,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,
-	0xDF,0xAB,0xBF,0x9B,0x5F,0xA3,0x5F,0x9B,0x3F,0x8B,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xBC,0x7A,0x3C,0x6A,0x9A,0x49,0x9A,0x49,0x7A,0x41,0xDD,0x49,0x7D,0x41,0xBD,0x39,0x5C,0x31,0x5C,0x31,0x5C,0x29,0x5E,0x31,0x5E,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5C,0x29,0x3E,0x19,0x5E,0x29,0xBE,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0x5F,0x2A,0xDF,0x31,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBD,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,
-	0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x09,0xBE,0x09,0xBD,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x09,0xB9,0x11,0xB7,0x09,0xB6,0x11,0x72,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,
-	0x2A,0x01,0x84,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x84,0x09,0x2A,0x01,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x69,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x3C,0x11,0x1E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x1E,0x11,0x7E,0x09,
-	0x7E,0x09,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0xBE,0x19,0x3E,0x22,0x3F,0x22,0xBE,0x19,0x3F,0x22,0xBF,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,
-	0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x3C,0x11,0x3C,0x11,0x3B,0x19,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x18,0xD5,0x08,0xD5,0x08,0xB3,0x08,0x72,0x08,0xB1,0x08,0x71,0x08,0xB1,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,
-	0x6C,0x08,0x6C,0x08,0x6A,0x00,0x69,0x00,0x68,0x00,0x67,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x24,0x08,0x23,0x00,0x21,0x00,0x61,0x08,0xA2,0x10,
-	0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5F,0x9B,
-	0xDF,0x92,0xDF,0x8A,0x1C,0x7A,0xD9,0x61,0x9A,0x49,0x7A,0x41,0x7A,0x41,0xDD,0x49,0xBD,0x39,0x5C,0x31,0x5C,0x31,0x5C,0x29,0x5C,0x31,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x29,0x5E,0x29,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0x3E,0x22,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,
-	0xDF,0x42,0x9F,0x3A,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBD,0x19,0xBD,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0xBD,0x09,
-	0x5C,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x11,0xB6,0x11,0xB6,0x11,0x72,0x09,0x2E,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x84,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x84,0x09,0x2A,0x01,0xA8,0x00,0x2A,0x01,0x2A,0x01,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x69,0x00,
-	0xAB,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0x3C,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x1E,0x11,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x11,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x3F,0x22,0x3F,0x22,
-	0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0xBE,0x19,0x3F,0x22,0xBF,0x19,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBF,0x19,0xBE,0x19,0x7F,0x19,0xBE,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x3E,0x19,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3B,0x19,
-	0x5A,0x09,0x5A,0x09,0x59,0x09,0xD9,0x08,0x39,0x19,0xD7,0x08,0xD7,0x18,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0x71,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x69,0x00,0x68,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x65,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x00,0x23,0x08,0x21,0x00,0x61,0x08,0xA2,0x10,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,0xBD,0xA3,0xDF,0xAB,0xBF,0x9B,
-	0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0x5E,0x7A,0x3C,0x6A,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0xDD,0x49,0x5E,0x31,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5E,0x31,0xDF,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x29,0x7E,0x19,0x5C,0x29,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0x3E,0x22,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBD,0x29,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3E,0x22,
-	0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x09,0xBE,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x11,0xBB,0x11,0xB9,0x11,0xB9,0x11,0xB9,0x11,0xB6,0x11,0x72,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA7,0x00,0x2A,0x01,
-	0x2A,0x01,0x2A,0x01,0xA7,0x00,0x2A,0x01,0x2A,0x01,0x84,0x09,0x2A,0x01,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA4,0x08,0xA7,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x6A,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0x5A,0x09,0x3C,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x1E,0x11,
-	0x7E,0x09,0x7E,0x09,0x7E,0x11,0x7F,0x11,0x7F,0x11,0xBF,0x19,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,
-	0xBE,0x29,0xBE,0x19,0x7E,0x19,0xBF,0x19,0xBE,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x5C,0x09,0xFC,0x10,0x5A,0x09,0x3B,0x19,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0x71,0x08,0x71,0x08,
-	0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x08,0x65,0x00,0x64,0x08,0x65,0x08,0x64,0x08,0x23,0x08,0x22,0x08,0x61,0x08,0xA2,0x10,
-	0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x92,
-	0xDF,0x8A,0x1C,0x7A,0xD9,0x61,0x9A,0x49,0x7A,0x41,0x7A,0x41,0xBD,0x39,0xBD,0x39,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x29,0x7E,0x19,0x5C,0x29,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x3E,0x22,0x5F,0x2A,0x3F,0x42,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,
-	0xDF,0x42,0x9F,0x3A,0xDF,0x42,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,
-	0xBB,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x11,0xB9,0x09,0xB9,0x11,0xB7,0x09,0xB6,0x11,0x75,0x09,0x72,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA7,0x00,0x2A,0x01,0xA7,0x00,0x84,0x09,0x2A,0x01,0xA7,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x68,0x00,0x6A,0x00,
-	0xCD,0x00,0xCF,0x08,0x31,0x09,0xB3,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xD5,0x08,0x37,0x09,0xD9,0x08,0x5A,0x09,0xBD,0x19,0x3C,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x09,0x7F,0x11,0x7F,0x11,0x7E,0x09,0x7F,0x11,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,
-	0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0xBE,0x19,0xBE,0x29,0x3E,0x22,0xBE,0x29,0xBE,0x29,0xBF,0x19,0xBF,0x19,0xBF,0x19,0xBF,0x19,0xBE,0x19,0xBF,0x19,0x7E,0x19,0xBF,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x5C,0x09,
-	0x3C,0x11,0x5C,0x09,0xFC,0x10,0x5A,0x09,0x3B,0x19,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0x72,0x08,0x72,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x65,0x08,0x64,0x08,0x65,0x08,0x65,0x08,0x63,0x08,0x22,0x08,0x62,0x08,0xA2,0x10,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0x5E,0x7A,0x1C,0x7A,0x3C,0x6A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0x5E,0x82,0x3C,0x6A,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0xDD,0x49,0xBD,0x39,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x3E,0x19,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,
-	0xDF,0x31,0xBE,0x29,0x5E,0x29,0x3E,0x19,0x7E,0x19,0x5E,0x29,0x7E,0x19,0xBE,0x29,0xBE,0x29,0x3E,0x22,0xDF,0x31,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0xDF,0x42,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0xBE,0x19,0x3F,0x22,0x3E,0x22,0x3F,0x22,
-	0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBF,0x19,0x7E,0x11,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0xB9,0x09,0x59,0x09,0xB9,0x09,0xB7,0x09,0xB7,0x09,0xB6,0x11,0x75,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0xA7,0x00,0xA7,0x00,0x2A,0x01,
-	0x2A,0x01,0x2A,0x01,0xA7,0x00,0x2A,0x01,0xA7,0x00,0x2A,0x01,0xA7,0x00,0x2A,0x01,0xA7,0x00,0x2A,0x01,0xA7,0x00,0xA7,0x00,0x66,0x00,0xA7,0x00,0x68,0x00,0xAB,0x00,0xCF,0x08,0x31,0x09,0xD3,0x10,0x34,0x01,0x34,0x01,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x3B,0x19,0xBD,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,
-	0x7F,0x11,0x1E,0x11,0x7F,0x11,0x7F,0x11,0x7F,0x11,0x7F,0x11,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x5F,0x2A,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,
-	0x3E,0x22,0xBE,0x29,0x3F,0x22,0xBE,0x29,0xBF,0x19,0xBE,0x29,0xBF,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x5C,0x09,0x3C,0x11,0x5C,0x09,0x3B,0x19,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0x72,0x08,0x71,0x08,
-	0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x27,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x65,0x08,0x24,0x08,0x64,0x08,0x63,0x08,0x61,0x08,0xA2,0x10,
-	0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0x5E,0x7A,0x1C,0x7A,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0xA3,0xDF,0x92,0x5F,0x9B,0xDF,0x8A,
-	0x1C,0x7A,0xD9,0x61,0x9A,0x49,0x7A,0x41,0x7A,0x41,0xBD,0x39,0xBD,0x39,0x5E,0x31,0x5C,0x29,0x3E,0x19,0x5C,0x29,0x5E,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x29,0x7E,0x19,0x5C,0x29,0x7E,0x19,0x7E,0x19,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,
-	0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0xBE,0x29,0xBE,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBF,0x19,0x7E,0x11,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,
-	0x37,0x09,0x37,0x09,0x37,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0x2A,0x01,0x2A,0x01,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x2A,0x01,0x84,0x09,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xAB,0x00,
-	0xCF,0x08,0x31,0x09,0x72,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xD7,0x08,0xD7,0x08,0x59,0x09,0x3B,0x19,0x3C,0x11,0xBD,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x7F,0x11,0x7F,0x11,0x7F,0x11,0x7F,0x11,0x7F,0x11,0x7F,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,
-	0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBF,0x19,0xBE,0x29,0xBF,0x19,0xBE,0x29,0xBF,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,
-	0x7E,0x11,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x3C,0x11,0xFC,0x10,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0x72,0x08,0xB3,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6A,0x08,0x6A,0x08,0x68,0x08,0x27,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x65,0x08,0x64,0x08,0x63,0x08,0x62,0x08,0xA2,0x10,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xDF,0xAB,0xBF,0x9B,0xDF,0xAB,0xBF,0x9B,0x5F,0x9B,
-	0x3F,0x8B,0xDF,0x8A,0x5E,0x7A,0x3C,0x6A,0xDD,0x69,0x1C,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0x3C,0x6A,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0xBD,0x39,0xBD,0x39,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0xBE,0x29,0xDF,0x31,0x5E,0x29,
-	0x5E,0x29,0x3E,0x19,0x3E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3F,0x22,0xBE,0x29,0xBE,0x19,0x7E,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x29,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x5F,0x2A,
-	0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBF,0x19,0x7E,0x19,0x5C,0x09,0xFC,0x10,0xFC,0x10,0x5A,0x09,0xD9,0x08,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x75,0x09,0x34,0x01,0x72,0x09,0x34,0x01,0xB3,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,
-	0x2A,0x01,0xA7,0x00,0x2A,0x01,0xA8,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0x34,0x19,0x75,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x3B,0x19,0x3C,0x11,0xBD,0x19,0x7E,0x11,
-	0x7E,0x11,0x7F,0x11,0x7E,0x11,0x7F,0x11,0x7F,0x11,0x7E,0x11,0x7F,0x11,0x7E,0x09,0x7E,0x11,0xBE,0x09,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x5F,0x2A,0x3E,0x22,0x3E,0x22,
-	0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0xBE,0x19,0x3F,0x22,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x19,0x7F,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x5C,0x09,0x3C,0x11,0xFC,0x10,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0x75,0x00,0xB3,0x08,0x72,0x08,
-	0x72,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x69,0x08,0x68,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x64,0x08,0x64,0x08,0x62,0x08,0x62,0x08,0xA2,0x10,
-	0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0x3F,0x9C,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0x5E,0x7A,
-	0xD9,0x61,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x7D,0x41,0xBD,0x39,0xBD,0x39,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,
-	0x5F,0x2A,0x3F,0x22,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0x3E,0x22,0xBE,0x29,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0xBE,0x29,0xBE,0x29,0x7E,0x19,0x7E,0x19,0x3B,0x19,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD7,0x08,0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0x34,0x01,0x34,0x01,
-	0xB3,0x08,0x31,0x09,0xB1,0x08,0x31,0x09,0x2E,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA4,0x08,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x2A,0x01,0xA7,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xA8,0x00,0x2A,0x01,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCD,0x00,
-	0xCF,0x08,0x72,0x09,0x75,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD7,0x08,0x37,0x09,0x59,0x09,0x5A,0x09,0x3B,0x19,0x5C,0x09,0x7E,0x11,0x7E,0x11,0xBE,0x19,0x7F,0x11,0x7E,0x11,0x7F,0x11,0x7F,0x11,0xBE,0x09,0x7F,0x11,0xBE,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x5F,0x2A,
-	0x3F,0x22,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x19,0x7F,0x11,0xBE,0x19,0x7E,0x11,0x7F,0x11,
-	0xBE,0x09,0x7E,0x11,0x7E,0x11,0x1E,0x11,0x5C,0x09,0xFC,0x10,0xFC,0x10,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0x75,0x00,0x75,0x00,0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x68,0x08,0x26,0x00,0x25,0x08,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x64,0x08,0x64,0x08,0x63,0x08,0x62,0x08,0xA2,0x10,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,
-	0xDF,0x8A,0x5E,0x7A,0x3C,0x6A,0x5E,0x7A,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x1C,0x7A,0xDC,0x59,0x9A,0x49,0x7A,0x41,0x7A,0x41,0xBD,0x39,0xBD,0x39,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0x5E,0x29,0x7E,0x19,
-	0x3E,0x19,0x3E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x19,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0xBE,0x29,0xBE,0x19,0x7E,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x29,0x3F,0x22,0xBE,0x29,
-	0x3E,0x22,0xBE,0x29,0xBE,0x19,0x3C,0x11,0x3B,0x19,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0x34,0x01,0xB3,0x08,0x31,0x09,0x31,0x09,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0xA4,0x08,0xA7,0x00,
-	0xA7,0x00,0xA7,0x00,0xA7,0x00,0x2A,0x01,0xA7,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xCA,0x00,0xCA,0x00,0x2A,0x01,0xAB,0x00,0xCD,0x00,0x31,0x09,0x31,0x09,0x75,0x09,0xB6,0x11,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x37,0x09,0xD7,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5C,0x09,0xBD,0x19,
-	0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x09,0x7F,0x11,0x7F,0x11,0xBE,0x09,0x7E,0x09,0x7E,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,
-	0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0xBE,0x19,0x3E,0x22,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7F,0x11,0x7E,0x11,0x7E,0x09,0x7E,0x11,0x7E,0x11,0x1E,0x11,0x5C,0x09,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD5,0x08,0x75,0x00,0xD5,0x08,0xB3,0x08,
-	0x72,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x67,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x08,0x64,0x08,0x63,0x08,0x61,0x08,0xE3,0x18,
-	0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0x3C,0x6A,0xDD,0x69,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x92,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x8A,0x5E,0x7A,0x3C,0x6A,
-	0x9A,0x49,0x7A,0x41,0x7A,0x41,0x7A,0x41,0xBD,0x39,0xBD,0x39,0x5C,0x29,0xFB,0x18,0x5C,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,
-	0x3E,0x22,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x29,0xBF,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0xBE,0x29,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3E,0x22,0xBE,0x29,0xBE,0x29,0xBD,0x19,0x3B,0x19,0x3B,0x19,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0x31,0x09,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,
-	0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA4,0x08,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xAB,0x00,0x2E,0x09,
-	0xCF,0x08,0x31,0x09,0x75,0x09,0xB9,0x11,0xB9,0x11,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x37,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x5A,0x09,0x5C,0x09,0x7E,0x11,0xBE,0x19,0xBE,0x09,0xBE,0x19,0x7F,0x11,0xBE,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x09,0xBE,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x09,0xBD,0x09,
-	0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x19,0x7E,0x19,0xBE,0x19,0x7F,0x19,0xBE,0x19,0x7F,0x11,
-	0x7E,0x09,0x7F,0x11,0x7E,0x11,0x7E,0x09,0x1E,0x11,0x1E,0x11,0xFC,0x10,0xFC,0x10,0x5A,0x09,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0x75,0x00,0x75,0x00,0x75,0x00,0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6A,0x08,0x69,0x08,0x68,0x08,0x26,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x08,0x64,0x08,0x62,0x08,0x62,0x08,0xA2,0x10,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,
-	0x5E,0x7A,0x3C,0x6A,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x8A,0xDF,0x8A,0x1C,0x7A,0xDC,0x59,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x5C,0x31,0xBD,0x39,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3F,0x19,0x3E,0x19,0x3C,0x11,
-	0x3E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x29,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0xBD,0x19,0xBE,0x19,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0xBE,0x19,0xBE,0x29,0x3F,0x22,0x3F,0x22,0xBE,0x29,0x3E,0x22,0xBE,0x29,0xBD,0x19,
-	0xBD,0x19,0x3B,0x19,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,
-	0x66,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0x2A,0x01,0xCA,0x00,0x2A,0x01,0xAB,0x00,0xCA,0x00,0xCA,0x00,0x2A,0x01,0xAB,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0x75,0x09,0xB9,0x11,0xB9,0x11,0xB9,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x59,0x09,0x59,0x09,0x5A,0x09,0x5A,0x09,
-	0x5C,0x09,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x09,0x7F,0x11,0xBE,0x09,0x7F,0x11,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,
-	0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x29,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x11,0x7E,0x11,0x7F,0x11,0x7E,0x11,0x7F,0x11,0x1E,0x11,0x1E,0x11,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0x75,0x00,0x72,0x08,
-	0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x08,0x6A,0x08,0x28,0x08,0x67,0x08,0x26,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x23,0x08,0x62,0x08,0x62,0x08,0xA2,0x10,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0x5E,0x7A,0x3C,0x6A,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xDF,0x7A,0x3C,0x6A,0x9A,0x49,
-	0x9A,0x49,0x7A,0x41,0x7A,0x41,0x5C,0x31,0x5C,0x31,0x5C,0x29,0xFB,0x18,0x3C,0x11,0x5C,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3F,0x19,0x3F,0x19,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0xBD,0x19,
-	0xBD,0x19,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x29,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0xBE,0x19,0xBD,0x19,0xBD,0x19,0x3B,0x19,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0x71,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0xCD,0x00,0x6B,0x00,0xAB,0x00,0x6A,0x00,0x69,0x00,
-	0x69,0x00,0x69,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0x2E,0x09,
-	0x2E,0x09,0x31,0x09,0x75,0x09,0xB7,0x09,0xB9,0x11,0x59,0x09,0xB9,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x59,0x09,0xD9,0x08,0x5A,0x09,0x5C,0x09,0xBD,0x19,0x7E,0x11,0xBE,0x19,0x7F,0x11,0xBE,0x19,0xBE,0x09,0x7F,0x11,0xBE,0x09,0x7F,0x11,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,
-	0xBE,0x19,0xBE,0x19,0xBE,0x09,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x29,0xBF,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x29,0xBE,0x19,0x7E,0x19,0xBE,0x19,0x7E,0x19,0xBE,0x19,0x7E,0x11,
-	0x7E,0x11,0x7E,0x11,0x7E,0x11,0x1E,0x11,0x7E,0x11,0x3C,0x11,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0x75,0x00,0x75,0x00,0x75,0x00,0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x68,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x22,0x08,0x62,0x08,0xE3,0x18,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0x5E,0x7A,
-	0x3C,0x6A,0xDD,0x69,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x3F,0x8B,0xDF,0x8A,0x5E,0x7A,0x3C,0x6A,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x5C,0x31,0x5C,0x31,0x5C,0x29,0xFB,0x18,0xFB,0x18,0x3E,0x19,0x5E,0x29,0x3F,0x19,0x3F,0x19,0x3F,0x19,0x3E,0x19,0x1E,0x11,0x1E,0x11,
-	0x7E,0x11,0x7E,0x19,0xBE,0x19,0xBE,0x29,0xBE,0x29,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0xBD,0x19,0xBD,0x19,0x5C,0x09,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0xBF,0x19,0x3E,0x22,0xBE,0x29,0xBE,0x29,0x3F,0x22,0xBE,0x29,0xBE,0x29,0xBD,0x19,0x3B,0x19,
-	0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0xCF,0x08,0x6C,0x08,0xCD,0x00,0x6B,0x00,0x6B,0x00,0x6A,0x00,0x69,0x00,0xA8,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x64,0x00,
-	0x64,0x00,0x65,0x00,0x65,0x08,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0x2E,0x09,0xCF,0x08,0x31,0x09,0x34,0x01,0xB7,0x09,0xB9,0x11,0xB9,0x11,0xB9,0x09,0xB9,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x59,0x09,0xD7,0x08,0x59,0x09,0x59,0x09,
-	0x5A,0x09,0x5C,0x09,0xBD,0x19,0xBE,0x19,0xBE,0x09,0xBF,0x19,0xBF,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,
-	0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x19,0xBE,0x29,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBD,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x5C,0x09,0x5C,0x09,0x3C,0x11,0x5C,0x09,0x3C,0x11,0xFC,0x10,0x3C,0x11,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0x75,0x10,0x75,0x00,0xD5,0x08,
-	0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0xCF,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x00,0x6A,0x08,0x69,0x08,0x68,0x08,0x27,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x61,0x08,0xA2,0x10,
-	0x3F,0x9C,0x3F,0x9C,0x5F,0xB4,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0x7F,0x6A,0xDD,0x69,0x3E,0x62,0x7F,0x6A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x7A,0x9A,0x49,0x9A,0x49,
-	0x78,0x31,0x7A,0x41,0x7A,0x41,0x5C,0x31,0x7A,0x41,0x19,0x21,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x3F,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0xBE,0x19,0xBD,0x19,0x7E,0x11,
-	0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x29,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x29,0xBE,0x29,0xBD,0x29,0x3C,0x11,0x3B,0x19,0xD9,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0xCF,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x00,0x6A,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x66,0x00,
-	0x66,0x00,0x26,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,
-	0x2E,0x09,0xCF,0x08,0x31,0x09,0x75,0x09,0xB9,0x11,0xB9,0x11,0xBB,0x11,0x5A,0x09,0xB9,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5A,0x09,0x5C,0x09,0x7E,0x11,0xBE,0x19,0xBF,0x19,0xBE,0x09,0x7F,0x11,0xBF,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x19,0xBD,0x09,
-	0x7E,0x11,0xBE,0x09,0x7E,0x11,0xBE,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x11,0xBE,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x5C,0x09,0x3C,0x11,0x5C,0x09,0x3C,0x11,0x5C,0x09,0x3B,0x19,0xFC,0x10,
-	0x5A,0x09,0x5A,0x09,0xD9,0x08,0x5A,0x09,0xD9,0x08,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0x75,0x10,0xD5,0x08,0x75,0x00,0xB3,0x08,0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x26,0x08,0x25,0x00,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x22,0x08,0x61,0x08,0xA2,0x10,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x9B,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0x5E,0x7A,0x3C,0x6A,
-	0xDD,0x69,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x3C,0x6A,0x9A,0x49,0x78,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x3B,0x19,0x19,0x21,0x19,0x21,0xFB,0x18,0x3E,0x19,0x5E,0x29,0x3F,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x7E,0x11,
-	0x7E,0x19,0xBE,0x19,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x9F,0x3A,0x5F,0x2A,0x3F,0x22,0xBE,0x19,0xBE,0x19,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x29,0xBE,0x29,0xBD,0x19,0x3C,0x11,0x3B,0x19,0xD9,0x08,0xD9,0x08,
-	0xD5,0x18,0xD5,0x08,0xB3,0x08,0x71,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0xCA,0x00,0x69,0x08,0x68,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0x2E,0x09,0x31,0x09,0x31,0x09,0x75,0x09,0xB7,0x09,0xB9,0x11,0xBB,0x11,0xBB,0x09,0xB9,0x09,0x37,0x09,0xB9,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD7,0x08,
-	0x59,0x09,0x5A,0x09,0x5C,0x09,0x7E,0x11,0xBE,0x19,0xBE,0x09,0xBE,0x09,0xBF,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x7E,0x11,0xBD,0x09,0xBE,0x09,0x7E,0x11,0xBE,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x11,0xBE,0x09,0xBD,0x09,0xBE,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x7E,0x09,
-	0x7E,0x11,0x7E,0x09,0x7E,0x11,0x5C,0x09,0x1E,0x11,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0xFC,0x10,0x5A,0x09,0x5A,0x09,0xD9,0x08,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0x75,0x10,0x75,0x00,0x75,0x00,0x75,0x10,0xD5,0x08,
-	0x72,0x08,0xB3,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0xCF,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x2A,0x08,0x69,0x08,0x68,0x08,0x27,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x21,0x00,0x61,0x08,0xA2,0x10,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x7A,0xDC,0x59,0x9A,0x49,0x77,0x41,
-	0x78,0x31,0x78,0x31,0x7A,0x41,0x19,0x21,0x19,0x21,0x19,0x21,0xD9,0x08,0xFB,0x18,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x1E,0x11,0xFC,0x10,0x1E,0x11,0x3E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x19,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x9F,0x3A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0xBE,0x29,0xBE,0x19,0x7E,0x11,0x7E,0x11,0xBE,0x19,
-	0xBE,0x19,0xBF,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBD,0x19,0x5C,0x29,0x3B,0x19,0xD9,0x08,0xD7,0x08,0xD5,0x18,0xD5,0x08,0x72,0x08,0xB1,0x08,0x6E,0x08,0xCF,0x08,0x6C,0x08,0xAB,0x00,0x6A,0x08,0x68,0x08,0x68,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x62,0x00,0x23,0x00,0x62,0x00,0x23,0x00,0x64,0x00,0x24,0x00,0x25,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x00,0x2E,0x09,
-	0x2E,0x09,0xCF,0x08,0x31,0x09,0x34,0x01,0xB7,0x09,0xB9,0x11,0xBB,0x11,0xBB,0x09,0xB9,0x09,0xB9,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD7,0x08,0x37,0x09,0x37,0x09,0x59,0x09,0x5A,0x09,0x5A,0x09,0x5C,0x09,0xBE,0x19,0xBF,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x7E,0x11,0xBE,0x09,
-	0xBD,0x09,0x7E,0x11,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x1E,0x11,0x5C,0x09,0x5C,0x09,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x5A,0x09,0xD9,0x08,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,
-	0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0x75,0x00,0xD7,0x08,0x75,0x00,0x75,0x00,0x75,0x00,0x75,0x00,0x72,0x08,0x75,0x00,0xB3,0x08,0x72,0x08,0x72,0x08,0x72,0x10,0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x67,0x08,0x26,0x00,0x25,0x00,
-	0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x21,0x00,0x61,0x08,0xA2,0x10,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x83,0xBF,0x9B,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0x5E,0x7A,0x3E,0x62,0xDD,0x69,
-	0x3E,0x62,0x5E,0x7A,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0x3F,0x8B,0xDF,0x8A,0x3C,0x6A,0xD9,0x61,0x77,0x41,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x19,0x21,0x19,0x21,0xD7,0x18,0x19,0x21,0xFB,0x18,0x3C,0x11,0x3C,0x11,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x7E,0x19,
-	0x7E,0x19,0xBE,0x19,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0xBE,0x29,0xBE,0x19,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBF,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x3F,0x22,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x19,0xBD,0x19,0x3B,0x19,0x3B,0x19,0x37,0x09,0xD7,0x18,0xD5,0x08,0xB3,0x08,
-	0xB3,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x69,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x26,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0xA8,0x00,0xAB,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x31,0x09,0x34,0x01,0x75,0x09,0xB9,0x11,0xBB,0x11,0xBB,0x11,0xBB,0x09,0xB9,0x09,0xB9,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x37,0x09,
-	0xD7,0x08,0x37,0x09,0x59,0x09,0x5A,0x09,0x5A,0x09,0xBD,0x09,0xBE,0x19,0xBF,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x7E,0x11,0xBE,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x7E,0x09,
-	0x5C,0x09,0x5C,0x09,0x5C,0x09,0xFC,0x10,0xFC,0x10,0x5A,0x09,0x5A,0x09,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0x75,0x00,0xD5,0x08,0x75,0x00,0xD5,0x08,0x75,0x00,0xD5,0x08,0x72,0x08,0x72,0x08,0x72,0x08,0x72,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0xB3,0x08,
-	0x72,0x10,0x72,0x10,0x72,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x68,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x21,0x00,0x61,0x08,0xA2,0x10,
-	0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x7B,0xDF,0x7A,0x3E,0x62,0x3D,0x5A,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xBC,0x7A,0x3C,0x6A,0x9A,0x49,0x77,0x41,0x35,0x31,
-	0x78,0x31,0x78,0x31,0x78,0x31,0x19,0x21,0x19,0x21,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3E,0x19,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7E,0x19,0x7E,0x19,0xBE,0x19,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0xBE,0x29,0xBE,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x19,0xBF,0x19,
-	0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0xBF,0x19,0xBE,0x29,0xBD,0x29,0x3B,0x19,0x3B,0x19,0xD7,0x18,0xD7,0x08,0xD5,0x08,0xB3,0x08,0x72,0x08,0xB1,0x08,0x6E,0x08,0xCD,0x00,0x6C,0x08,0xAB,0x00,0x6A,0x08,0x68,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x23,0x00,
-	0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0xA8,0x00,0x2A,0x01,0xCD,0x00,
-	0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x75,0x09,0xB7,0x09,0xB9,0x11,0xB9,0x11,0xB9,0x11,0xB9,0x09,0xB7,0x09,0xB7,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0xBB,0x09,0xBD,0x09,0xBE,0x09,0xBF,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBF,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,
-	0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x7E,0x09,0xBE,0x09,0xBE,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0xFC,0x10,0x5C,0x09,0xFC,0x10,0x5A,0x09,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,
-	0xD5,0x08,0xD5,0x08,0xD5,0x08,0x75,0x00,0xB3,0x08,0xB3,0x08,0x72,0x08,0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x72,0x10,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x68,0x08,0x66,0x00,0x25,0x00,
-	0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x22,0x00,0x61,0x08,0xA2,0x10,0x3F,0x94,0x3F,0x9C,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0x7F,0x6A,0xDD,0x69,0x3E,0x62,0xDD,0x69,
-	0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x7A,0xD9,0x61,0x77,0x41,0x35,0x31,0x78,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x37,0x19,0xD7,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0xFB,0x18,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x3E,0x19,0x7E,0x19,0x7E,0x19,
-	0xBE,0x29,0xBD,0x29,0xBE,0x19,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0xBE,0x19,0xBE,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x29,0xBE,0x19,0xBD,0x19,0x3B,0x19,0x37,0x09,0xD7,0x08,0xD5,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,
-	0x6E,0x08,0xCF,0x08,0x6C,0x08,0x6B,0x08,0x69,0x00,0x69,0x00,0x67,0x00,0x66,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x64,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x63,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x67,0x00,0xA8,0x00,0xCA,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x75,0x09,0xB9,0x09,0xB9,0x11,0xB9,0x09,0xB9,0x09,0xB7,0x09,0x37,0x09,0x75,0x09,0x34,0x01,0x34,0x01,0x34,0x01,
-	0x34,0x01,0x34,0x01,0xD5,0x08,0x37,0x09,0x37,0x09,0x5A,0x09,0x5C,0x09,0xBD,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x09,0x7E,0x09,0xBD,0x09,0xBE,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,
-	0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0xD9,0x08,0x59,0x09,0xD9,0x08,0x59,0x09,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,
-	0x6E,0x08,0x71,0x08,0x70,0x10,0x71,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x68,0x08,0x27,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x23,0x08,0x22,0x00,0x61,0x08,0xA2,0x10,
-	0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x83,0xBF,0x9B,0xBF,0x83,0x3F,0x8B,0x3F,0x7B,0xDF,0x7A,0x3E,0x62,0x3E,0x62,0xDC,0x59,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x3C,0x6A,0x19,0x52,0x77,0x41,0x35,0x31,0x35,0x31,
-	0x78,0x31,0x35,0x31,0x37,0x19,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x3E,0x19,0x7E,0x19,0xBE,0x19,0xBE,0x29,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0xBE,0x19,0x7E,0x11,0x5C,0x09,0x7E,0x11,0x7E,0x11,0x7E,0x19,0xBE,0x19,0xBF,0x19,
-	0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0xBF,0x19,0xBE,0x19,0xBE,0x19,0xBD,0x19,0x3B,0x19,0x59,0x09,0xD7,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x00,0x69,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x00,
-	0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0xB7,0x09,0xB9,0x11,0xB9,0x11,0xB9,0x09,0xB7,0x09,0xB7,0x09,0x37,0x09,0x75,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0x37,0x09,0x59,0x09,0xB9,0x09,0xBB,0x09,0xBD,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,
-	0xBE,0x09,0xBE,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0x7E,0x09,0xBD,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,0xD9,0x08,0xD9,0x08,0x59,0x09,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0x37,0x09,0xD5,0x08,0x37,0x09,0x34,0x01,0xD5,0x08,
-	0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x2C,0x00,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x70,0x10,0x70,0x10,0x70,0x10,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x69,0x08,0x68,0x08,0x67,0x00,0x26,0x00,
-	0x25,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x23,0x08,0x62,0x08,0x61,0x00,0xA2,0x10,0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0x3F,0x94,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x7B,0xDF,0x7A,0x7F,0x6A,0x3C,0x6A,0xDC,0x59,0x3E,0x62,0x3E,0x62,
-	0x7F,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x3F,0x8B,0xDF,0x92,0xDF,0x8A,0xBC,0x7A,0x3C,0x6A,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x37,0x19,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7E,0x19,0x7E,0x19,
-	0xBE,0x29,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0xBE,0x19,0x5C,0x09,0x5C,0x09,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7F,0x19,0xBF,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0xBE,0x19,0xBE,0x19,0x3F,0x22,0xBE,0x19,0xBD,0x19,0x3B,0x19,0x59,0x09,0xD7,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,
-	0x6C,0x08,0xAB,0x00,0x6A,0x00,0x69,0x00,0x67,0x00,0x67,0x00,0x26,0x00,0x65,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x25,0x00,0x25,0x00,0x65,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x65,0x00,0x25,0x00,0x64,0x00,
-	0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x64,0x00,0x66,0x00,0xA7,0x00,0x2A,0x01,0xAB,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x75,0x09,0xB7,0x09,0xB9,0x11,0xB7,0x09,0xB9,0x09,0xB7,0x09,0x75,0x09,0x75,0x09,0x34,0x01,0x31,0x09,
-	0x34,0x01,0xB3,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x59,0x09,0x5A,0x09,0xBD,0x09,0xBD,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0x7E,0x09,0xBD,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,
-	0x5C,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD7,0x08,0x37,0x09,0xD5,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x2C,0x00,0x2C,0x00,0x2C,0x00,0x2C,0x00,
-	0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6F,0x10,0x71,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x68,0x00,0x67,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x22,0x00,0x61,0x08,0xA2,0x10,
-	0x3F,0x94,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0xDF,0x7A,0x3E,0x62,0xFE,0x51,0xDC,0x59,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,0xD9,0x61,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,
-	0x35,0x31,0x35,0x31,0x34,0x19,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x3C,0x11,0x7E,0x11,0x7E,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,
-	0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3E,0x22,0xBD,0x19,0xBD,0x19,0x3B,0x19,0x59,0x09,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0x6B,0x08,0x6A,0x00,0x69,0x00,0x68,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,
-	0x25,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x66,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x25,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0x66,0x00,0xA7,0x00,0xCA,0x00,0x2A,0x01,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x75,0x09,0xB6,0x11,0xB7,0x09,0xB7,0x09,0xB7,0x09,0xB7,0x09,0x75,0x09,0x34,0x01,0x72,0x09,0x34,0x01,0x31,0x09,0x31,0x09,0x31,0x09,0xB3,0x08,0x34,0x01,0xD5,0x08,0x37,0x09,0x59,0x09,0xB9,0x09,0xBD,0x09,0xBD,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,
-	0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0x5C,0x09,0xBD,0x09,0xBD,0x09,0x5C,0x09,0xBB,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x37,0x09,0xD5,0x08,0x34,0x01,
-	0x34,0x01,0x34,0x01,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x2C,0x00,0x2C,0x00,0x2C,0x00,0x2C,0x00,0x2C,0x08,0x2C,0x08,0x6E,0x08,0x6F,0x10,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x00,0x6A,0x08,0x69,0x08,0x29,0x08,0x67,0x00,0x26,0x00,
-	0x26,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x08,0x24,0x00,0x63,0x08,0x62,0x08,0xA2,0x10,0x3F,0x94,0x3F,0x94,0x3F,0x94,0xBF,0x9B,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x7B,0xBF,0x6A,0x3E,0x62,0x3D,0x5A,0x3D,0x5A,0x3E,0x62,0x7F,0x6A,
-	0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0x3F,0x8B,0xDF,0x92,0xDF,0x92,0x3F,0x8B,0xDF,0x8A,0xBD,0x8A,0x3C,0x6A,0x9A,0x49,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x34,0x19,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0x75,0x10,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0x3C,0x11,0x1E,0x11,0x7E,0x19,0xBE,0x19,
-	0xBE,0x29,0xBE,0x29,0xBE,0x29,0x3F,0x22,0xBE,0x29,0xBE,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0xBD,0x19,0xBD,0x19,0xBB,0x11,0x59,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xAD,0x18,0x6C,0x08,
-	0x6A,0x00,0x69,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x66,0x00,0x27,0x00,0x67,0x00,0x67,0x00,0x67,0x08,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x65,0x00,
-	0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0xAB,0x10,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x75,0x09,0xB6,0x11,0xB7,0x09,0xB7,0x09,0xB7,0x09,0x75,0x09,0x72,0x09,0x34,0x01,0x31,0x09,
-	0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xB3,0x08,0x34,0x01,0x34,0x01,0x37,0x09,0x59,0x09,0x5A,0x09,0xBB,0x11,0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0x5C,0x09,
-	0xBD,0x09,0xBB,0x09,0xBB,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x37,0x09,0xD5,0x08,0x34,0x01,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x2C,0x00,0x2C,0x00,0x2A,0x00,
-	0x2A,0x00,0x2C,0x00,0x2C,0x08,0x2C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x00,0x6A,0x08,0x68,0x08,0x68,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x25,0x08,0x24,0x00,0x63,0x08,0x62,0x08,0xE3,0x18,
-	0x3F,0x94,0x3F,0x94,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0x7F,0x6A,0x3D,0x5A,0xDC,0x59,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0xDF,0x92,0x3F,0x8B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x7A,0x3C,0x6A,0x19,0x52,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,
-	0x13,0x29,0x34,0x19,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0x75,0x10,0x75,0x00,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x3C,0x11,0x7E,0x11,0x7E,0x19,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0xBF,0x19,0xBF,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,
-	0xBE,0x19,0x3F,0x22,0xBD,0x19,0xBD,0x19,0xBB,0x11,0x59,0x09,0x37,0x09,0xD7,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xAF,0x18,0xCD,0x00,0x6B,0x08,0x6A,0x00,0x68,0x00,0x67,0x00,0x26,0x00,0x65,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x66,0x00,
-	0x27,0x00,0x67,0x00,0x68,0x00,0x68,0x08,0x68,0x08,0x68,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x27,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x24,0x00,0x65,0x00,0x66,0x00,0xA8,0x00,0x2A,0x01,
-	0xAB,0x00,0x2E,0x09,0x2E,0x09,0x31,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x75,0x09,0xB7,0x09,0xB6,0x11,0xB7,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xB1,0x08,0x31,0x09,0xB3,0x08,0x34,0x01,0x37,0x09,0x37,0x09,0xB9,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,
-	0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0x5A,0x09,0x5A,0x09,0xB9,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x37,0x09,0x34,0x01,
-	0x34,0x01,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x2C,0x00,0x2A,0x00,0x2A,0x00,0x2A,0x00,0x2A,0x00,0x2A,0x00,0x2C,0x08,0x2C,0x08,0x2C,0x08,0x2C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x69,0x08,0x69,0x00,0x28,0x08,0x67,0x08,
-	0x66,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x64,0x08,0x63,0x08,0x62,0x08,0xE3,0x18,0x3F,0x94,0xBF,0x83,0x3F,0x94,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3D,0x5A,0x3D,0x5A,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x5E,0x7A,
-	0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0xDF,0x92,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,0xD9,0x61,0x77,0x41,0x35,0x31,0x13,0x29,0x13,0x29,0x35,0x31,0x13,0x29,0x13,0x29,0xD1,0x18,0x72,0x10,0xD3,0x10,0x72,0x10,0xB3,0x08,0x75,0x00,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x5C,0x09,0x7E,0x11,0x7E,0x19,0xBF,0x19,
-	0xBF,0x19,0xBF,0x19,0xBF,0x19,0xBF,0x19,0x7F,0x11,0x7E,0x09,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0xBE,0x19,0x3F,0x22,0xBE,0x19,0xBD,0x19,0xBB,0x11,0x5A,0x09,0x59,0x09,0x37,0x09,0x34,0x01,0xB3,0x08,0xB3,0x08,0x31,0x09,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,
-	0x69,0x00,0x68,0x00,0x66,0x00,0x66,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x66,0x00,0x27,0x00,0x27,0x00,0x68,0x00,0x68,0x00,0x69,0x08,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x08,0x68,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x66,0x00,
-	0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0xA8,0x00,0xCA,0x00,0x2A,0x01,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x75,0x09,0xB7,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x31,0x09,
-	0x31,0x09,0x31,0x09,0xCF,0x08,0x31,0x09,0xB1,0x08,0x31,0x09,0x31,0x09,0xB3,0x08,0x34,0x01,0x37,0x09,0x37,0x09,0xB9,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,
-	0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0x5A,0x09,0xB9,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0x6E,0x08,0x6C,0x08,0x2A,0x00,0x2A,0x00,
-	0x29,0x00,0x29,0x00,0x2A,0x00,0x2A,0x08,0x2C,0x00,0x2C,0x08,0x2C,0x08,0x6C,0x08,0x2C,0x00,0x6C,0x08,0x6B,0x00,0x2A,0x00,0x6A,0x08,0x68,0x08,0x68,0x08,0x27,0x00,0x67,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x26,0x00,0x25,0x00,0x64,0x08,0x63,0x08,0xE3,0x18,
-	0x3F,0x94,0x3F,0x94,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x7B,0x7F,0x6A,0x3D,0x5A,0xDC,0x59,0x3D,0x5A,0x3E,0x62,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xBD,0x6A,0xD9,0x61,0x77,0x41,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,
-	0x34,0x19,0xF1,0x20,0xD1,0x18,0xD1,0x18,0x70,0x10,0x70,0x10,0x72,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x3C,0x11,0x7E,0x11,0x7E,0x19,0x7F,0x19,0xBF,0x19,0xBF,0x19,0xBF,0x19,0x7F,0x11,0x7E,0x09,0x7E,0x09,0x1E,0x11,0x7E,0x09,0x7E,0x11,0x7F,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,
-	0x3E,0x22,0xBD,0x19,0xBD,0x19,0x5A,0x09,0x59,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0xB3,0x08,0x31,0x09,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0x6A,0x00,0x68,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x68,0x00,
-	0x28,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x27,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x67,0x00,0xA8,0x00,
-	0xCA,0x00,0xAD,0x18,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x31,0x09,0x72,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0xCF,0x08,0x2E,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB1,0x08,0x34,0x01,0x34,0x01,0x37,0x09,0xB9,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x11,
-	0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBD,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x09,0x59,0x09,0xB9,0x09,0x59,0x09,0xB9,0x09,0x37,0x09,0x37,0x09,
-	0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0x71,0x08,0xB1,0x08,0xCF,0x08,0x6E,0x08,0x6B,0x00,0x2A,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x2A,0x00,0x2A,0x08,0x2C,0x00,0x2C,0x08,0x6C,0x08,0x2C,0x00,0x6B,0x00,0x6A,0x00,0x69,0x00,0x29,0x00,0x68,0x08,0x68,0x08,
-	0x67,0x08,0x26,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x66,0x00,0x25,0x00,0x63,0x08,0x63,0x08,0xA2,0x10,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3E,0x62,0x3D,0x5A,0x3D,0x5A,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0x5E,0x7A,
-	0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0xDF,0x92,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x3C,0x6A,0xD9,0x61,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0xF1,0x20,0xD1,0x18,0x6F,0x10,0x6F,0x10,0x71,0x08,0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x5C,0x09,0x1E,0x11,0x7F,0x19,0x7F,0x19,
-	0xBE,0x29,0xBF,0x19,0xBF,0x19,0x7E,0x11,0x1E,0x11,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7F,0x11,0x7F,0x11,0xBE,0x09,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x3F,0x22,0x3F,0x22,0xBD,0x19,0xBD,0x19,0x59,0x09,0x59,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0x34,0x01,0xB3,0x08,0x31,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0x69,0x00,
-	0x68,0x00,0x66,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x68,0x00,0x28,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,
-	0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0xA8,0x00,0xCA,0x00,0x2A,0x01,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x31,0x09,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCF,0x08,0x2E,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0x34,0x01,0x75,0x09,0x37,0x09,0xB7,0x09,0xB9,0x09,0xBB,0x11,0xBB,0x11,0xBB,0x11,0xBB,0x11,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,
-	0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x09,0xB9,0x09,0x59,0x09,0xB9,0x09,0xB7,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0x6E,0x08,0x6C,0x08,0x2A,0x00,
-	0x29,0x00,0x29,0x00,0x28,0x00,0x28,0x08,0x29,0x00,0x29,0x00,0x2A,0x08,0x6B,0x00,0x2C,0x00,0x2C,0x00,0x6B,0x00,0x2A,0x00,0x69,0x00,0x29,0x00,0x68,0x08,0x28,0x08,0x27,0x08,0x66,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x66,0x08,0x64,0x08,0x63,0x08,0xA2,0x10,
-	0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3D,0x5A,0x3D,0x5A,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBC,0x7A,0x3C,0x6A,0x19,0x52,0x35,0x31,0x13,0x29,0xF1,0x20,0x13,0x29,0xF1,0x20,
-	0xF1,0x20,0xD1,0x18,0xAF,0x18,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0xFC,0x10,0x7E,0x11,0x7E,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x11,0xFC,0x10,0x5C,0x09,0x7E,0x09,0x1E,0x11,0x7E,0x09,0x7E,0x09,0xBE,0x09,0xBE,0x19,0xBE,0x09,0xBF,0x19,0x3F,0x22,0xBE,0x19,0xBD,0x19,
-	0xBD,0x19,0xB9,0x09,0x59,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0x31,0x09,0x31,0x09,0xB1,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0x6A,0x08,0x68,0x00,0x67,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x69,0x00,0x69,0x08,
-	0x2A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0xCA,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0xA4,0x08,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x68,0x00,
-	0xCA,0x00,0xAB,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0x31,0x09,0x31,0x09,0x34,0x01,0x75,0x09,0x37,0x09,0xB9,0x11,
-	0xB9,0x09,0xBB,0x11,0xBB,0x09,0xBB,0x09,0xBB,0x11,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x09,0xB9,0x09,0x59,0x09,
-	0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xCF,0x08,0x6C,0x08,0x6B,0x00,0x2A,0x00,0x29,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x2A,0x00,0x2A,0x00,0x2C,0x00,0x6B,0x00,0x6B,0x00,0x6A,0x00,0x29,0x00,0x69,0x08,0x28,0x08,0x28,0x08,
-	0x27,0x00,0x27,0x00,0x66,0x08,0x66,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x67,0x08,0x66,0x08,0x64,0x08,0x63,0x08,0xA2,0x10,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0xBF,0x83,0x3F,0x7B,0xDF,0x7A,0x7F,0x6A,0x3D,0x5A,0xFE,0x51,0x3D,0x5A,0x3E,0x62,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,
-	0xDF,0x8A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xBC,0x7A,0x3C,0x6A,0x77,0x41,0x13,0x29,0x13,0x29,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAD,0x18,0x6F,0x10,0x6E,0x08,0x6C,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x3C,0x11,0x7E,0x19,0x7E,0x19,
-	0x3C,0x11,0x3C,0x11,0x5A,0x09,0xFC,0x10,0xFC,0x10,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x7F,0x11,0xBE,0x09,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBD,0x19,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0xB3,0x08,0x34,0x01,0xD1,0x18,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0x69,0x00,0x68,0x00,
-	0x66,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x29,0x08,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6A,0x00,0xAB,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,
-	0xA8,0x00,0x68,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0xAB,0x10,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,
-	0x2E,0x09,0xCD,0x00,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0x31,0x09,0x34,0x01,0x75,0x09,0x75,0x09,0xB7,0x09,0xB7,0x09,0xB9,0x11,0xB9,0x09,0xB9,0x11,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,
-	0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x09,0xB9,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0x6E,0x08,0x6C,0x08,
-	0x2A,0x00,0x28,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x2A,0x00,0x6B,0x00,0x6B,0x00,0x6A,0x00,0x69,0x00,0x69,0x08,0x29,0x00,0x28,0x08,0x27,0x00,0x67,0x08,0x67,0x00,0x66,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x66,0x08,0x27,0x00,0x27,0x00,0x28,0x08,0x67,0x08,0x65,0x08,0x64,0x08,0xE3,0x18,
-	0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3E,0x62,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xBD,0x6A,0xD9,0x61,0x77,0x41,0x13,0x29,0xF1,0x20,0xF1,0x20,0x31,0x31,0xF1,0x20,
-	0xAF,0x18,0xAD,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0xD7,0x08,0xD9,0x08,0x3B,0x19,0x3B,0x19,0x3C,0x11,0x3B,0x19,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0x5A,0x09,0xFC,0x10,0x5C,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBD,0x19,0xBB,0x11,0x59,0x09,
-	0x59,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x31,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCA,0x00,0x69,0x00,0x67,0x00,0x66,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x6A,0x08,0x2A,0x00,
-	0x6A,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6B,0x08,0xAB,0x00,0x6B,0x08,0x6B,0x00,0x6A,0x00,0xCA,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x66,0x00,
-	0xA8,0x00,0xCA,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2E,0x09,0x2A,0x01,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0x34,0x01,
-	0x34,0x01,0x75,0x09,0xB6,0x11,0xB7,0x09,0xB7,0x09,0xB7,0x09,0xB9,0x09,0xB9,0x09,0xB9,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBE,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x09,
-	0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xCF,0x08,0x6C,0x08,0x6B,0x00,0x29,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x6B,0x00,0x6B,0x08,0x6A,0x00,0x2A,0x00,0x69,0x00,0x28,0x08,0x68,0x08,
-	0x28,0x00,0x67,0x08,0x67,0x00,0x66,0x08,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x67,0x08,0x28,0x00,0x69,0x00,0x68,0x08,0xA7,0x18,0xC5,0x18,0xC5,0x18,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x7F,0x6A,0x3D,0x5A,0xFE,0x51,0xFE,0x51,0x3D,0x5A,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,
-	0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x92,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBC,0x7A,0x3C,0x6A,0x19,0x52,0x74,0x41,0x13,0x29,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAD,0x18,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x2C,0x00,0x6E,0x08,0x71,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x3B,0x19,0x39,0x19,0xD9,0x08,
-	0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0x5C,0x09,0x5C,0x09,0x7E,0x11,0x7E,0x11,0xBD,0x19,0xBD,0x19,0xBD,0x19,0xBB,0x11,0x3B,0x19,0x59,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x31,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0xAB,0x00,0x6A,0x08,0x68,0x00,0x67,0x00,
-	0x65,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x68,0x00,0x69,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6B,0x08,0xAB,0x00,0x6B,0x00,0xCA,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x69,0x00,0xA8,0x00,
-	0x69,0x00,0x69,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0x2E,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,
-	0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x72,0x09,0x34,0x01,0x34,0x01,0x75,0x09,0x75,0x09,0xB6,0x11,0xB7,0x09,0xB9,0x09,0xB7,0x09,0xB9,0x09,0xB9,0x09,0xB9,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x11,
-	0xBB,0x11,0xBB,0x11,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0xD5,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xD1,0x18,0xB1,0x08,0x6E,0x08,
-	0x6C,0x08,0x29,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x2A,0x00,0x2A,0x00,0x6A,0x00,0x2A,0x00,0x69,0x00,0x69,0x08,0x29,0x08,0x28,0x08,0x28,0x08,0x68,0x00,0x67,0x08,0x67,0x00,0x66,0x08,0x26,0x00,0x26,0x00,0x27,0x00,0x67,0x08,0x68,0x08,0x29,0x00,0x6A,0x08,0xAB,0x10,0xA7,0x18,0xC5,0x18,0xE3,0x18,
-	0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBC,0x7A,0x3C,0x6A,0x19,0x52,0x35,0x31,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xED,0x28,0xF1,0x20,
-	0xAD,0x18,0xAB,0x10,0x6A,0x08,0x6A,0x08,0x6A,0x00,0x2A,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0xB1,0x08,0xB3,0x08,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x08,0xD5,0x08,0x75,0x00,0x75,0x00,0x75,0x00,0xD7,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0x5C,0x09,0x5C,0x09,0xBD,0x19,0x5C,0x09,0xBB,0x11,0x3B,0x19,0x59,0x09,0x37,0x09,0x37,0x09,
-	0xD5,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0x75,0x09,0x34,0x01,0x34,0x19,0x72,0x09,0xB3,0x08,0x31,0x09,0xCF,0x08,0xCD,0x00,0xAB,0x00,0x69,0x00,0x68,0x00,0x66,0x00,0x65,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x68,0x00,0x29,0x00,0x6A,0x00,0x6A,0x00,
-	0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x66,0x00,
-	0xA7,0x00,0xA8,0x00,0x2A,0x01,0xAB,0x10,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xAB,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,
-	0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x75,0x09,0x37,0x09,0x75,0x09,0x37,0x09,0x37,0x09,0xB7,0x09,0x59,0x09,0xB9,0x09,0xBB,0x09,0xB9,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,
-	0x59,0x09,0xB9,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xAF,0x18,0x6C,0x08,0x2A,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x29,0x00,0x2A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x29,0x08,0x29,0x08,0x68,0x00,
-	0x28,0x08,0x68,0x08,0x68,0x08,0x67,0x08,0x27,0x00,0x26,0x00,0x66,0x00,0x67,0x08,0x68,0x00,0x69,0x00,0x6A,0x08,0x6B,0x08,0xAB,0x10,0xA8,0x18,0xC5,0x18,0xC5,0x18,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3D,0x5A,0x3D,0x5A,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,
-	0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xBC,0x7A,0x9B,0x5A,0x77,0x41,0x74,0x41,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xED,0x28,0xAD,0x18,0x6A,0x08,0x69,0x08,0x69,0x00,0x29,0x00,0x29,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0xCF,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,
-	0x71,0x08,0x72,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0x59,0x09,0x39,0x19,0x3B,0x19,0x3B,0x19,0x3B,0x19,0x3B,0x19,0x59,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0x75,0x09,0x75,0x09,0x34,0x01,0x75,0x09,0x34,0x01,0x34,0x01,0x72,0x09,0x31,0x09,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xA8,0x00,0x67,0x00,0x65,0x00,
-	0x64,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x28,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0xAB,0x00,0x6B,0x00,0xAB,0x00,0xAB,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0xCA,0x00,0x6A,0x00,
-	0xAB,0x00,0x6A,0x00,0xCA,0x00,0x69,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xAB,0x00,
-	0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x69,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,
-	0x34,0x01,0x37,0x09,0x37,0x09,0x37,0x09,0x59,0x09,0xB9,0x09,0xB9,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0xB3,0x08,0xD3,0x10,0xB1,0x08,
-	0x6C,0x08,0x2A,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x69,0x00,0x69,0x00,0x69,0x08,0x69,0x08,0x29,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x00,0x67,0x08,0x27,0x00,0x27,0x00,0x68,0x00,0x69,0x08,0x69,0x00,0x6B,0x08,0x6C,0x08,0xAD,0x18,0x4A,0x29,0xA7,0x18,0xC5,0x18,
-	0xBF,0x83,0x3F,0x7B,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x5A,0x3D,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBD,0x6A,0xD9,0x61,0x77,0x41,0x13,0x29,0xF1,0x20,0xED,0x28,0xF1,0x20,0xED,0x28,0xED,0x28,
-	0xAB,0x10,0x69,0x08,0x68,0x08,0x68,0x00,0x28,0x00,0x29,0x00,0x69,0x08,0x6B,0x08,0x6C,0x08,0x6D,0x18,0xCF,0x08,0xAF,0x18,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x08,0x37,0x19,0x37,0x09,0x39,0x19,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0xD5,0x08,0xB3,0x08,0x34,0x01,
-	0x34,0x01,0x34,0x01,0x34,0x01,0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x34,0x01,0x31,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0xCA,0x00,0xA8,0x00,0x66,0x00,0x65,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,
-	0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x08,0xAB,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0xCA,0x00,0x6B,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0x69,0x00,0xA8,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x65,0x00,
-	0x65,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0xCA,0x00,0x2A,0x01,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0x2A,0x01,0x2E,0x09,0xAB,0x00,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x69,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,
-	0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x37,0x09,0x37,0x09,0x59,0x09,0x59,0x09,0x5A,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBB,0x09,
-	0xBB,0x09,0x5A,0x09,0xBB,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0xD5,0x08,0x34,0x01,0x34,0x01,0xB3,0x08,0x31,0x09,0xD1,0x18,0xCF,0x08,0x6B,0x00,0x29,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x29,0x00,0x69,0x00,0x6A,0x08,0x69,0x08,0x69,0x08,0x68,0x08,
-	0x29,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x08,0x67,0x00,0x28,0x08,0x69,0x00,0x69,0x08,0x6A,0x08,0x6C,0x08,0xAF,0x18,0xAD,0x18,0x4A,0x29,0x46,0x21,0xC5,0x18,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,
-	0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0xBC,0x7A,0x19,0x52,0x74,0x41,0x13,0x29,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xED,0x28,0xAD,0x18,0xAB,0x10,0x68,0x08,0x67,0x00,0x27,0x00,0x27,0x00,0x67,0x08,0x69,0x00,0x6A,0x08,0x6A,0x08,0xAB,0x00,0x6C,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x00,0x2A,0x00,0x6A,0x00,
-	0x6C,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0xD1,0x18,0x34,0x01,0xD5,0x18,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0x72,0x09,0x34,0x01,0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0xD1,0x18,0xCF,0x08,0xAB,0x00,0xCA,0x00,0x67,0x00,0x66,0x00,0x64,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6A,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0xAB,0x00,
-	0xAB,0x00,0xAB,0x00,0xAB,0x00,0x6A,0x00,0xA8,0x00,0x69,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x10,0xA8,0x00,0xA8,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0x2A,0x01,0x2E,0x09,0xAB,0x00,0x2A,0x01,0x2A,0x01,0xCA,0x00,
-	0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0xA7,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0xCF,0x08,0x2E,0x09,0xCF,0x08,0xB1,0x08,0x31,0x09,
-	0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x37,0x09,0x37,0x09,0x59,0x09,0x5A,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xB3,0x08,0xD1,0x18,
-	0xCF,0x08,0x6B,0x08,0x29,0x00,0x28,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x69,0x00,0x69,0x00,0x6A,0x08,0x69,0x08,0x29,0x08,0x69,0x08,0x69,0x00,0x69,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x69,0x00,0x69,0x08,0x6A,0x00,0x6B,0x08,0x6C,0x08,0xAF,0x18,0xAF,0x18,0x4A,0x29,0xA7,0x18,0xC5,0x18,
-	0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x5A,0x3D,0x5A,0xFE,0x51,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBC,0x7A,0x3C,0x6A,0x19,0x52,0x74,0x41,0x13,0x29,0xF1,0x20,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,
-	0xA8,0x18,0x67,0x08,0x26,0x00,0x25,0x00,0x26,0x00,0x67,0x00,0x68,0x08,0x68,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x68,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x69,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0xD3,0x10,
-	0x31,0x09,0x34,0x01,0x75,0x09,0x75,0x09,0xB6,0x11,0x75,0x09,0x75,0x09,0x34,0x01,0x31,0x09,0x31,0x09,0xCD,0x00,0xAB,0x00,0xA8,0x00,0x67,0x00,0x65,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x26,0x00,0x67,0x00,0x27,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,
-	0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0x69,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0x66,0x00,0x65,0x00,0x65,0x00,
-	0x65,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x2A,0x01,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xAB,0x00,0x2A,0x01,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0xA8,0x00,0x67,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,
-	0xA8,0x00,0xCA,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x37,0x09,0x37,0x09,0xB9,0x09,0xB9,0x09,0xBB,0x09,0xBB,0x09,
-	0xBB,0x09,0xBB,0x09,0xBB,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x37,0x09,0x34,0x01,0x34,0x01,0xD3,0x10,0x31,0x09,0xB1,0x08,0xCD,0x00,0x6A,0x00,0x28,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,
-	0x69,0x08,0x69,0x08,0x69,0x00,0x68,0x08,0xA8,0x00,0x69,0x08,0x69,0x08,0x69,0x00,0x6B,0x00,0x6C,0x08,0x6F,0x10,0xD1,0x18,0xF1,0x20,0x8E,0x31,0xA7,0x18,0xC5,0x18,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x5A,0xFE,0x51,0xDD,0x49,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,
-	0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0x3F,0x8B,0xDF,0x7A,0xBC,0x7A,0x9B,0x5A,0x19,0x52,0x74,0x41,0x31,0x31,0xF1,0x20,0xAF,0x18,0xED,0x28,0xAD,0x18,0xAB,0x10,0xA8,0x18,0x66,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x67,0x08,0x67,0x08,0x68,0x08,0x67,0x00,0x67,0x08,0x67,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,
-	0x67,0x00,0x67,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0xCF,0x08,0xB1,0x08,0x31,0x09,0x31,0x09,0x34,0x01,0x75,0x09,0x75,0x09,0x75,0x09,0xB7,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0xCA,0x00,0x68,0x00,0x66,0x00,0x64,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x67,0x00,0x67,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x69,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,
-	0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x10,0x2A,0x01,0xA8,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,
-	0xA8,0x00,0xA8,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0xCF,0x08,
-	0xCF,0x08,0xCF,0x08,0x31,0x09,0xB1,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x37,0x09,0x37,0x09,0xB9,0x09,0x59,0x09,0xB9,0x09,0x5A,0x09,0xBB,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xD3,0x10,
-	0x31,0x09,0xAF,0x18,0xAB,0x00,0x69,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6A,0x08,0x6A,0x08,0x69,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x69,0x00,0x69,0x08,0x69,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x08,0xD1,0x18,0xF1,0x20,0x8E,0x31,0xA7,0x18,0xC5,0x18,
-	0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0x3F,0x5A,0xDD,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x7F,0x6A,0x7F,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0x5E,0x7A,0x9B,0x5A,0x77,0x41,0x13,0x29,0xF1,0x20,0xF1,0x20,0xED,0x28,0xED,0x28,0xED,0x28,0xAB,0x10,
-	0x68,0x08,0x66,0x08,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x65,0x08,0x66,0x00,0x66,0x08,0x66,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x65,0x00,0x65,0x00,0x26,0x00,0x67,0x00,0x69,0x00,0x29,0x00,0x69,0x00,0x6A,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,
-	0x72,0x09,0x75,0x09,0x75,0x09,0xB6,0x11,0xB6,0x11,0xB6,0x11,0x75,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0xAB,0x00,0xA8,0x00,0x67,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x27,0x00,0x67,0x00,0x27,0x00,0x68,0x00,0x28,0x00,
-	0x69,0x00,0x69,0x00,0x29,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0x66,0x00,0x65,0x00,0x65,0x00,
-	0x64,0x00,0x65,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0x2A,0x01,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,
-	0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x37,0x09,0x37,0x09,
-	0x59,0x09,0xB9,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x72,0x09,0xD1,0x18,0xCF,0x08,0xCD,0x00,0x6A,0x00,0x28,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x69,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,
-	0x6A,0x08,0x6A,0x08,0x69,0x00,0x6A,0x08,0x6A,0x08,0xCA,0x00,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6E,0x08,0x70,0x10,0xD3,0x10,0xF1,0x20,0x8E,0x31,0xA7,0x18,0xC5,0x18,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0xDD,0x49,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBD,0x6A,0x9B,0x5A,0x77,0x41,0x51,0x41,0xF1,0x20,0xED,0x28,0xED,0x28,0xAD,0x18,0x4A,0x29,0xCA,0x28,0xA7,0x18,0x65,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x23,0x00,0x24,0x00,0x64,0x00,
-	0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0xCA,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x34,0x01,0x75,0x09,0x75,0x09,0xB6,0x11,0xB6,0x11,0x75,0x09,0x34,0x19,0x72,0x09,0x2E,0x09,0xCD,0x00,0xCA,0x00,0x67,0x00,0x65,0x00,0x65,0x00,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x27,0x00,0x27,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,
-	0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0x2E,0x09,0x2A,0x01,0xAB,0x00,0xCA,0x00,0xA7,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,
-	0x66,0x00,0x67,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,
-	0xCD,0x00,0x2E,0x09,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0xB3,0x08,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x34,0x01,0x37,0x09,0x37,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0xD3,0x10,
-	0x31,0x09,0xD1,0x18,0xCF,0x08,0xAB,0x00,0x28,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x29,0x00,0x6A,0x00,0x69,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x00,0x6A,0x08,0xCA,0x00,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0x70,0x10,0xD3,0x10,0x31,0x31,0x8E,0x31,0xA8,0x18,0xC5,0x18,
-	0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x5A,0xBD,0x6A,0x3D,0x5A,0xDD,0x49,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0x9B,0x5A,0x14,0x4A,0x31,0x31,0xF1,0x20,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,0x4A,0x29,
-	0x67,0x08,0x24,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x25,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x00,0x2E,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,
-	0x75,0x09,0x75,0x09,0xB6,0x11,0xB6,0x11,0xB6,0x11,0x75,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0xAB,0x00,0x68,0x00,0x66,0x00,0x65,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x66,0x00,0x26,0x00,0x67,0x00,0x27,0x00,0x67,0x00,0x27,0x00,0x67,0x00,0x68,0x00,0x28,0x00,
-	0x68,0x00,0x29,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x2A,0x01,0x2E,0x09,0xCA,0x00,0xA8,0x00,0x67,0x00,0x66,0x00,0x65,0x00,0x65,0x00,
-	0x64,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,
-	0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0x2E,0x09,0xCD,0x00,0xCF,0x08,0x2E,0x09,0x31,0x09,0xB1,0x08,0x31,0x09,0x31,0x09,0xB3,0x08,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,
-	0x34,0x01,0x37,0x09,0x59,0x09,0xBB,0x09,0x59,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x19,0x34,0x01,0xD3,0x10,0x31,0x09,0xAF,0x18,0xCD,0x00,0x69,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x69,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,
-	0x6A,0x08,0x6A,0x00,0x6A,0x00,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6D,0x18,0x6F,0x10,0x70,0x10,0xD3,0x10,0x13,0x29,0x8E,0x31,0xA8,0x18,0xC5,0x18,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x5A,0x3D,0x5A,0x3D,0x5A,0xDE,0x49,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0x5F,0x9B,
-	0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBD,0x6A,0xD9,0x61,0x77,0x41,0x31,0x31,0xED,0x28,0xAF,0x18,0xED,0x28,0xAD,0x18,0x4A,0x29,0xA8,0x18,0xA7,0x18,0x64,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,
-	0x23,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0xA8,0x00,0xAB,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x31,0x09,0x72,0x09,0x34,0x01,0x75,0x09,0x75,0x09,0xB6,0x11,0xB6,0x11,0x75,0x09,0x72,0x09,0xF1,0x20,0x2E,0x09,0xCA,0x00,0x67,0x00,0x65,0x00,0x65,0x00,0x24,0x00,0x63,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x26,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,
-	0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCD,0x00,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xAB,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,
-	0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x27,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,
-	0xCD,0x00,0x2E,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0xB1,0x08,0x31,0x09,0x31,0x09,0xB3,0x08,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x37,0x09,0xB9,0x09,0x5A,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,
-	0x34,0x19,0x31,0x09,0xB1,0x08,0xCD,0x00,0x6A,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x69,0x00,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6A,0x00,0x6A,0x00,0x6B,0x08,0x6B,0x08,0xAD,0x18,0xAD,0x18,0x6C,0x08,0x6F,0x10,0x72,0x10,0xD3,0x10,0x13,0x29,0x8E,0x31,0xA8,0x18,0xC5,0x18,
-	0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0x3D,0x5A,0xDD,0x49,0xDD,0x49,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0xBD,0x6A,0x9B,0x5A,0x74,0x41,0x31,0x31,0xAF,0x18,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,0xCA,0x28,
-	0xA7,0x18,0x64,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x24,0x00,0x25,0x00,0x65,0x00,0x66,0x00,0xA8,0x00,0xCA,0x00,0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x72,0x09,
-	0x72,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0xB6,0x11,0x75,0x09,0x72,0x09,0x2E,0x09,0xCD,0x00,0xA8,0x00,0x67,0x00,0x65,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x68,0x00,0x28,0x00,0x68,0x00,0x68,0x00,
-	0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x65,0x00,
-	0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x26,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0x6A,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,
-	0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0xCF,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0x31,0x09,0xB3,0x08,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0xB3,0x08,
-	0xB3,0x08,0x34,0x01,0x37,0x09,0x59,0x09,0xB9,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x37,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x19,0x37,0x09,0x34,0x01,0x34,0x01,0x72,0x09,0xD1,0x18,0xCF,0x08,0x6B,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x69,0x08,0x6A,0x08,0x6B,0x08,
-	0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0xAF,0x18,0x6F,0x10,0x72,0x10,0xD5,0x18,0x34,0x19,0x8E,0x31,0x4A,0x29,0xC5,0x18,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBD,0x6A,0x3D,0x5A,0xDD,0x49,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,
-	0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0xBD,0x6A,0x19,0x52,0x74,0x41,0x31,0x31,0xED,0x28,0xAF,0x18,0xED,0x28,0xAD,0x18,0x4A,0x29,0x4A,0x29,0xA7,0x18,0x64,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,
-	0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0xCA,0x00,0xAB,0x00,0x2E,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0xCA,0x00,0xA8,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x26,0x00,0x67,0x00,0x27,0x00,0x67,0x00,0x68,0x00,0x28,0x00,0x68,0x00,0x68,0x00,0x29,0x00,0x69,0x00,0x29,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xCD,0x00,
-	0xCD,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2A,0x01,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,
-	0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xAB,0x00,0x6A,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,
-	0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xB1,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0x31,0x09,0xB3,0x08,0x34,0x01,0xD5,0x08,0x37,0x09,0x59,0x09,0xB9,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,
-	0x34,0x01,0xD3,0x10,0x31,0x09,0xCF,0x08,0x6B,0x00,0x68,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x6C,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0xAD,0x18,0x6F,0x10,0x70,0x10,0x72,0x10,0xD5,0x18,0x35,0x31,0x8E,0x31,0xA8,0x18,0xC5,0x18,
-	0x3F,0x7B,0xBF,0x6A,0xBD,0x6A,0x3D,0x5A,0x3C,0x4A,0xDD,0x49,0xFE,0x51,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0x3F,0x7B,0xDF,0x7A,0xBD,0x6A,0xD9,0x61,0x74,0x41,0x31,0x31,0xF1,0x20,0xED,0x28,0xAD,0x18,0xED,0x28,0x4A,0x29,0xAB,0x10,
-	0xA7,0x18,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0xA8,0x00,0xAB,0x00,0x2E,0x09,0x2E,0x09,0x72,0x09,0x72,0x09,
-	0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x2E,0x09,0xCD,0x00,0xCA,0x00,0x67,0x00,0x66,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,
-	0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x64,0x00,0x64,0x00,
-	0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x6C,0x08,0xCD,0x00,0x6C,0x08,0xCD,0x00,0x6B,0x00,0xCD,0x00,0xAB,0x00,
-	0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0x66,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0xCF,0x08,0x31,0x09,0xB1,0x08,0x31,0x09,0xB3,0x08,0x31,0x09,0x34,0x01,0x34,0x01,0x31,0x09,
-	0xB3,0x08,0x34,0x01,0x34,0x01,0x37,0x09,0x59,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x19,0x34,0x01,0x31,0x09,0xD1,0x18,0xCD,0x00,0x69,0x00,0x28,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x69,0x08,0x6B,0x08,0x6B,0x08,
-	0x6B,0x08,0x6C,0x08,0xCD,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6D,0x18,0xCF,0x08,0xAF,0x18,0xB1,0x08,0xD3,0x10,0xD7,0x18,0x35,0x31,0x8E,0x31,0x4A,0x29,0xC5,0x18,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3D,0x5A,0xDC,0x59,0xDD,0x49,0xFE,0x51,0x3D,0x5A,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,
-	0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0xBD,0x6A,0x19,0x52,0x74,0x41,0xF1,0x20,0xAF,0x18,0xED,0x28,0xED,0x28,0xAD,0x18,0xED,0x28,0x4A,0x29,0xA8,0x18,0x64,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0xA8,0x00,0x2A,0x01,0x2E,0x09,0x2E,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0xAB,0x00,0xA8,0x00,0x66,0x00,0x65,0x00,0x24,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x63,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x66,0x00,0x27,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x6C,0x08,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCD,0x00,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,
-	0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x27,0x00,0x68,0x00,0x68,0x00,0x69,0x00,
-	0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0xAB,0x00,0x6C,0x08,0xCD,0x00,0x6C,0x08,0xCF,0x08,0xCD,0x00,0x6E,0x08,0xCD,0x00,0x6E,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,
-	0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x31,0x09,0x34,0x01,0x34,0x01,0xB3,0x08,0xB3,0x08,0x34,0x01,0x37,0x09,0x59,0x09,0xB9,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,
-	0x37,0x09,0x34,0x19,0x34,0x01,0xB1,0x08,0xCD,0x00,0x6A,0x00,0x28,0x00,0x68,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6F,0x10,0x6F,0x10,0xCF,0x08,0x70,0x10,0x75,0x10,0xD7,0x18,0x35,0x31,0x31,0x31,0xC7,0x21,0xC5,0x18,
-	0x3F,0x7B,0xBD,0x6A,0xBF,0x5A,0x3D,0x5A,0xDD,0x49,0xDD,0x49,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0xDF,0x8A,0x5F,0x9B,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0xBD,0x6A,0x19,0x52,0x74,0x41,0x31,0x31,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xED,0x28,0xED,0x28,0xCA,0x28,
-	0xA8,0x18,0x65,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xCA,0x00,0xCD,0x00,0x2E,0x09,0x31,0x09,0x72,0x09,
-	0x72,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0xCD,0x00,0xA8,0x00,0x67,0x00,0x66,0x00,0x65,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x26,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,
-	0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x65,0x00,0x64,0x00,0x65,0x00,
-	0x24,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x6E,0x08,0xCF,0x08,0x6E,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,
-	0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0x68,0x00,0xA8,0x00,0x6A,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0xB3,0x08,0x31,0x09,0x31,0x09,
-	0x34,0x01,0xB3,0x08,0x34,0x01,0x37,0x09,0x37,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x19,0xD1,0x18,0xCF,0x08,0x6B,0x00,0x29,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6A,0x08,0x6B,0x08,0x6B,0x08,
-	0xAD,0x18,0x6C,0x08,0xCD,0x00,0x6C,0x08,0x6C,0x08,0x6F,0x10,0xCF,0x08,0x6F,0x10,0xD1,0x18,0x70,0x10,0xD5,0x18,0xD7,0x18,0x35,0x31,0x31,0x31,0x4A,0x29,0xC5,0x18,0xBF,0x6A,0xBF,0x6A,0x3D,0x5A,0xDC,0x59,0xDD,0x49,0xDC,0x59,0xFE,0x51,0x3D,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x5F,0x9B,
-	0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0xBD,0x6A,0x19,0x52,0x74,0x41,0x31,0x31,0xAF,0x18,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x4A,0x29,0xA8,0x18,0x65,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0x2E,0x09,0x2E,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xA8,0x00,0x67,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x63,0x00,
-	0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x25,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCD,0x00,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,
-	0xCD,0x00,0x2E,0x09,0x2E,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0x2A,0x01,0xA8,0x00,0xA8,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,
-	0xCF,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xD3,0x10,0x34,0x01,0x34,0x19,0x34,0x01,0x34,0x19,0x72,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x66,0x00,0xA7,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,
-	0xA8,0x00,0xCA,0x00,0x6A,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xB1,0x08,0x31,0x09,0x31,0x09,0x34,0x01,0x31,0x09,0x34,0x01,0x31,0x09,0xB3,0x08,0x34,0x01,0x34,0x01,0x59,0x09,0x59,0x09,0xBB,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,
-	0x37,0x09,0x37,0x09,0x34,0x01,0x31,0x09,0xCF,0x08,0x6B,0x00,0x69,0x00,0x28,0x00,0x27,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0xCD,0x00,0x6F,0x10,0x6E,0x08,0x6F,0x10,0x6F,0x10,0xAF,0x18,0x6F,0x10,0xAF,0x18,0xB3,0x08,0x75,0x10,0xD7,0x18,0x78,0x31,0x51,0x41,0x46,0x21,0xC5,0x18,
-	0xBF,0x6A,0xBF,0x5A,0x3D,0x5A,0xDD,0x49,0xDD,0x49,0x3D,0x5A,0xFE,0x51,0x3E,0x62,0x3E,0x62,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0x3C,0x6A,0x19,0x52,0x74,0x41,0xF1,0x20,0xF1,0x20,0xED,0x28,0xAF,0x18,0xED,0x28,0xED,0x28,0x4A,0x29,
-	0xA8,0x18,0x65,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x66,0x00,0xA8,0x00,0xAB,0x00,0x2E,0x09,0x2E,0x09,0x31,0x09,
-	0x72,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xA8,0x00,0x67,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0xCA,0x00,
-	0x6B,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x25,0x00,
-	0x25,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x18,0xD5,0x18,0x75,0x09,0x37,0x19,0xD5,0x18,0x75,0x09,0x37,0x19,0x75,0x09,0x37,0x19,0x75,0x09,0xD5,0x18,0x75,0x09,
-	0x34,0x01,0x31,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0x68,0x00,0xA7,0x00,0x67,0x00,0x66,0x00,0xA7,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0x69,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,
-	0x34,0x01,0x34,0x01,0xB3,0x08,0x34,0x01,0x37,0x09,0x59,0x09,0x5A,0x09,0x5A,0x09,0xBB,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0xD5,0x18,0x34,0x01,0xD1,0x18,0xCD,0x00,0x2A,0x00,0x28,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6A,0x08,0x6B,0x08,0x6C,0x08,
-	0x6C,0x08,0x6D,0x18,0x6F,0x10,0xCF,0x08,0x6F,0x10,0x6F,0x10,0xAF,0x18,0xB1,0x08,0xB1,0x08,0x72,0x10,0xD5,0x18,0x19,0x21,0x78,0x31,0x8E,0x31,0x4A,0x29,0xC5,0x18,0xBF,0x6A,0xBF,0x5A,0x3D,0x5A,0xDD,0x49,0xDC,0x59,0xDD,0x49,0xFE,0x51,0x3D,0x5A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,
-	0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0xBD,0x6A,0x19,0x52,0x74,0x41,0x31,0x31,0xF1,0x20,0xAF,0x18,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xA8,0x18,0x66,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x60,0x00,
-	0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x66,0x00,0xA7,0x00,0xCA,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0xCA,0x00,0xA8,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x63,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x25,0x00,0x26,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0xCA,0x00,0x6B,0x00,0xAB,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x6C,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0xCF,0x08,
-	0x2E,0x09,0x31,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x27,0x00,0x68,0x08,0x68,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0xCF,0x08,0x71,0x08,0xB1,0x08,
-	0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x18,0x37,0x09,0x37,0x19,0xD7,0x18,0x37,0x09,0x37,0x19,0x37,0x09,0x37,0x09,0x37,0x19,0x37,0x09,0x75,0x09,0x34,0x01,0x34,0x19,0x34,0x01,0x34,0x19,0x31,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,
-	0x68,0x00,0xA8,0x00,0x6A,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0xB3,0x08,0x34,0x01,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,
-	0x59,0x09,0x37,0x09,0x37,0x09,0x34,0x19,0xB1,0x08,0xCD,0x00,0x6B,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0xCD,0x00,0x6F,0x10,0x6F,0x10,0xCF,0x08,0x70,0x10,0xD1,0x18,0xD1,0x18,0xB3,0x08,0x75,0x10,0xD9,0x08,0x78,0x31,0x8E,0x31,0xC7,0x21,0xC5,0x18,
-	0xBF,0x6A,0x3F,0x5A,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xFE,0x51,0x3D,0x5A,0x3E,0x62,0x7F,0x6A,0xBC,0x7A,0xDF,0x8A,0xDF,0x8A,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBF,0x6A,0x3D,0x5A,0x19,0x52,0x74,0x41,0x31,0x31,0xF1,0x20,0x8E,0x31,0xAF,0x18,0xED,0x28,0xED,0x28,0x4A,0x29,
-	0xCA,0x28,0x66,0x08,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0x2E,0x09,0x2E,0x09,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCA,0x00,0xA8,0x00,0x67,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x25,0x00,0x26,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,
-	0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x26,0x00,
-	0x67,0x00,0x67,0x00,0x68,0x08,0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0xCD,0x00,0xCF,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x18,0x39,0x19,0x37,0x09,0x39,0x19,0x59,0x09,0x39,0x19,0x59,0x09,0x37,0x19,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,
-	0x34,0x01,0x34,0x01,0x34,0x01,0xD3,0x10,0x31,0x09,0x31,0x09,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0xA7,0x00,0xA8,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0x31,0x09,0x31,0x09,
-	0x34,0x01,0x31,0x09,0x34,0x01,0xB3,0x08,0xD5,0x08,0x59,0x09,0x5A,0x09,0xBB,0x09,0xBB,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x75,0x09,0xD3,0x10,0xCF,0x08,0x6B,0x00,0x29,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x2A,0x00,0x6B,0x08,0x6C,0x08,
-	0x6C,0x08,0xAF,0x18,0x6F,0x10,0x6E,0x08,0x6F,0x10,0x6F,0x10,0xD1,0x18,0xD1,0x18,0x72,0x10,0xD3,0x10,0xD7,0x18,0x39,0x19,0x78,0x31,0x31,0x31,0x4A,0x29,0xC5,0x18,0xBF,0x5A,0x3D,0x5A,0xDD,0x49,0xDE,0x49,0xDC,0x59,0xFE,0x51,0x3D,0x5A,0x7F,0x6A,0x5E,0x7A,0xDF,0x7A,0x3E,0x83,0x3F,0x8B,0x5F,0x9B,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,
-	0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0x5E,0x7A,0x9B,0x5A,0x19,0x52,0x13,0x29,0xF1,0x20,0xED,0x28,0xF1,0x20,0xAF,0x18,0x8E,0x31,0xED,0x28,0x8E,0x31,0xAB,0x10,0xA7,0x18,0x64,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0xA8,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x26,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0xA8,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,
-	0x31,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x67,0x00,0x68,0x00,0x68,0x08,0x69,0x08,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0xCF,0x08,0x6E,0x08,0xB1,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x08,0xD7,0x08,
-	0xD7,0x18,0x39,0x19,0x39,0x19,0x39,0x19,0xD9,0x08,0x39,0x19,0xD9,0x08,0x59,0x09,0xD7,0x08,0x37,0x09,0xD7,0x08,0xD7,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB3,0x08,0x31,0x09,0x31,0x09,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x67,0x00,
-	0x67,0x00,0x68,0x00,0xA8,0x00,0x69,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x31,0x09,0x34,0x01,0xB3,0x08,0xB3,0x08,0xD5,0x08,0x37,0x09,0x5A,0x09,0xBB,0x09,0x5C,0x09,0x5A,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,
-	0x59,0x09,0x59,0x09,0x37,0x09,0xD5,0x18,0x72,0x09,0xB1,0x08,0x6C,0x08,0x6A,0x00,0x28,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x29,0x08,0x2A,0x00,0x6B,0x08,0x6C,0x08,0x6F,0x10,0x6F,0x10,0xCF,0x08,0x6F,0x10,0x6F,0x10,0x70,0x10,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x75,0x00,0xD7,0x18,0x39,0x19,0x78,0x31,0x51,0x41,0xC7,0x21,0xC5,0x18,
-	0xBF,0x5A,0x3D,0x5A,0xDE,0x49,0xDD,0x49,0xFE,0x51,0x3D,0x5A,0x3E,0x62,0x7F,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0x3C,0x6A,0x77,0x41,0x13,0x29,0x31,0x31,0xF1,0x20,0xED,0x28,0x8E,0x31,0xED,0x28,0x8E,0x31,0xED,0x28,
-	0x4A,0x29,0xA7,0x18,0x64,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x65,0x00,0x66,0x00,0xA8,0x00,0xCA,0x00,0x2A,0x01,0x2E,0x09,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2A,0x01,0xA8,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x25,0x00,0x25,0x00,0x66,0x00,0x26,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,
-	0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x66,0x00,0x67,0x00,0x67,0x00,
-	0x68,0x08,0x6A,0x08,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x18,0x39,0x19,0xD9,0x08,0x3B,0x19,0xD9,0x08,0xD9,0x08,0x39,0x19,0xD9,0x08,0xD9,0x08,0xD7,0x08,0x37,0x09,0xD7,0x08,0xD5,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,
-	0xB3,0x08,0xB3,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0xD1,0x18,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xCA,0x00,0xCA,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0xB1,0x08,0x31,0x09,0x31,0x09,0xB3,0x08,
-	0x34,0x01,0x31,0x09,0x34,0x01,0xB3,0x08,0xD5,0x08,0x59,0x09,0x59,0x09,0x5A,0x09,0xBD,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5C,0x09,0x5A,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0xD7,0x08,0x37,0x09,0x34,0x19,0xB1,0x08,0xCF,0x08,0x6B,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x68,0x08,0x69,0x00,0x2A,0x00,0x2C,0x00,0x6C,0x08,
-	0xAF,0x18,0xCF,0x08,0x6F,0x10,0x6F,0x10,0xB1,0x08,0x70,0x10,0xB1,0x08,0x72,0x10,0xB3,0x08,0xD5,0x18,0xD7,0x08,0xFB,0x18,0x78,0x31,0x8E,0x31,0x4A,0x29,0xC5,0x18,0x3F,0x5A,0xFE,0x51,0xDD,0x49,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xBC,0x7A,0xDF,0x7A,0x3E,0x83,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,
-	0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0x9B,0x5A,0x77,0x41,0x51,0x41,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xED,0x28,0xED,0x28,0xED,0x28,0xAB,0x10,0xA7,0x18,0x65,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x64,0x00,0x66,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCA,0x00,0x68,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x63,0x00,
-	0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0xCA,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x72,0x09,
-	0x72,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x28,0x00,0x69,0x00,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x18,0x39,0x19,0xD9,0x08,0x3B,0x19,
-	0x3B,0x19,0xD9,0x08,0x3B,0x19,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0x68,0x00,
-	0x67,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x31,0x09,0x31,0x09,0x34,0x01,0xD5,0x08,0xD7,0x08,0x5A,0x09,0x5C,0x09,0xBD,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,
-	0x5A,0x09,0xD9,0x08,0x59,0x09,0x37,0x09,0xD5,0x18,0x31,0x09,0x6E,0x08,0x6B,0x00,0x29,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x29,0x08,0x6B,0x08,0x2C,0x08,0x6C,0x08,0x6F,0x10,0x6F,0x10,0xCF,0x08,0x70,0x10,0xAF,0x18,0x70,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0x75,0x10,0xD7,0x18,0xFB,0x18,0x78,0x31,0x31,0x31,0xC7,0x21,0xC5,0x18,
-	0x3F,0x5A,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xFE,0x51,0x3D,0x5A,0x7F,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0xBF,0x9B,0x3F,0x8B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3E,0x83,0xDF,0x7A,0xBF,0x6A,0x3C,0x6A,0x77,0x41,0x13,0x29,0x31,0x31,0xED,0x28,0xF1,0x20,0x8E,0x31,0xF1,0x20,0x8E,0x31,0x8E,0x31,
-	0x4A,0x29,0xA8,0x18,0x65,0x08,0x24,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0xAB,0x00,0x2A,0x01,
-	0x2A,0x01,0x2E,0x09,0x2E,0x09,0xCA,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x25,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,
-	0x6A,0x00,0xCA,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,
-	0x6B,0x00,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x08,0xD7,0x08,0x39,0x19,0x3B,0x19,0xD9,0x08,0x3B,0x19,0xD9,0x08,0xFC,0x10,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0x34,0x01,0xB3,0x08,0xB3,0x08,0xB3,0x08,
-	0xB3,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0x31,0x09,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xAB,0x00,0x69,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0x34,0x01,
-	0x31,0x09,0x34,0x01,0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5C,0x09,0xBD,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x3B,0x19,0x5A,0x09,0x59,0x09,0xD9,0x08,0x37,0x09,0x75,0x09,0xD3,0x10,0xCF,0x08,0x6C,0x08,0x29,0x00,0x28,0x00,0x28,0x00,0x69,0x00,0x29,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,
-	0x6E,0x08,0xAF,0x18,0x70,0x10,0xD1,0x18,0x70,0x10,0xD1,0x18,0x72,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD9,0x08,0x3B,0x19,0x78,0x31,0x31,0x31,0x4A,0x29,0xC5,0x18,0x3D,0x5A,0xDE,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3E,0x83,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0x9B,0x5A,0x77,0x41,0x13,0x29,0x31,0x31,0xF1,0x20,0x31,0x31,0xED,0x28,0xF1,0x20,0x8E,0x31,0xED,0x28,0xED,0x28,0xA8,0x18,0x66,0x10,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0x2A,0x01,0x2E,0x09,0x2E,0x09,0x2A,0x01,0xCA,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0xA7,0x00,0x65,0x00,0x65,0x00,0xA7,0x00,0x65,0x00,0xA4,0x08,0x64,0x00,0x64,0x00,
-	0x64,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x69,0x08,0x6A,0x00,0xCA,0x00,0x6B,0x00,0xAB,0x00,0x6C,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,
-	0x31,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x69,0x08,0x6A,0x00,0x2A,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x39,0x19,0x3B,0x19,0xD9,0x08,0x3B,0x19,0xD9,0x08,0xFC,0x10,
-	0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB1,0x08,0x72,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xCA,0x00,0x69,0x00,
-	0xA8,0x00,0xA8,0x00,0x68,0x00,0xA7,0x00,0x68,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x31,0x09,0x34,0x01,0x34,0x01,0xD5,0x08,0xD7,0x08,0x5A,0x09,0x5C,0x09,0xBD,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,
-	0x5A,0x09,0x5A,0x09,0x59,0x09,0x37,0x09,0xD7,0x18,0x34,0x19,0xB1,0x08,0x6C,0x08,0x29,0x00,0x29,0x00,0x69,0x08,0x29,0x08,0x2A,0x00,0x2A,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6F,0x10,0xB1,0x08,0x70,0x10,0xD1,0x18,0x72,0x10,0xB3,0x08,0xD3,0x10,0xD5,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0x78,0x31,0x51,0x41,0xC7,0x21,0xC5,0x18,
-	0xDE,0x49,0xDD,0x49,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xBC,0x7A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBD,0x6A,0x3C,0x6A,0x77,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0xF1,0x20,0x31,0x31,0x8E,0x31,0x31,0x31,0xED,0x28,
-	0xED,0x28,0xA8,0x18,0x66,0x10,0x24,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0xCA,0x00,0x2A,0x01,
-	0xCD,0x00,0x2A,0x01,0x2E,0x09,0xCA,0x00,0xA8,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x67,0x08,0x68,0x08,0x69,0x08,0xCA,0x00,0xAB,0x00,0x6B,0x00,0xAB,0x00,
-	0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x08,0x6A,0x00,0x6B,0x00,0x2C,0x00,
-	0x6C,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x3B,0x19,0x3C,0x11,0x3B,0x19,0x3C,0x11,0xFC,0x10,0xFC,0x10,0x5A,0x09,0xD9,0x08,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,
-	0xB3,0x08,0xB3,0x08,0x71,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xAF,0x18,0xCD,0x00,0xAD,0x18,0xAB,0x00,0xCA,0x00,0x69,0x00,0xA8,0x00,0x68,0x00,0x67,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0xB1,0x08,0xB3,0x08,
-	0x34,0x01,0x34,0x01,0x31,0x09,0x34,0x01,0xD5,0x08,0xD7,0x08,0x5A,0x09,0x5A,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x3B,0x19,0x5A,0x09,0xD9,0x08,0x39,0x19,0x37,0x19,0x34,0x01,0xB1,0x08,0x6C,0x08,0x2A,0x00,0x29,0x00,0x69,0x00,0x29,0x08,0x6A,0x00,0x6B,0x08,0x6C,0x08,0x6E,0x08,
-	0x6F,0x10,0xB1,0x08,0x70,0x10,0xD1,0x18,0xD3,0x10,0xD3,0x10,0x72,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x78,0x31,0xB1,0x49,0x2A,0x01,0xC5,0x18,0xDD,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0x3D,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3E,0x83,0x3F,0x8B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0x9B,0x5A,0x77,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0xF1,0x20,0xED,0x28,0x8E,0x31,0x8E,0x31,0xED,0x28,0x4A,0x29,0x67,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2E,0x09,0x2A,0x01,0xCA,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0xA7,0x00,0xA4,0x08,0xA7,0x00,0x65,0x08,0x65,0x00,
-	0x65,0x00,0x64,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x66,0x00,0x67,0x08,0xA8,0x00,0x69,0x08,0x6A,0x08,0xAB,0x00,0xAB,0x00,0x6C,0x08,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x31,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x2E,0x09,
-	0xCF,0x08,0xCD,0x00,0xCD,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6B,0x08,0x6B,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x75,0x00,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x39,0x19,0x3B,0x19,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3B,0x19,0xFC,0x10,0xFC,0x10,
-	0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,
-	0xCA,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0xB3,0x08,0xD7,0x08,0xD7,0x08,0x59,0x09,0x5C,0x09,0xBD,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x3C,0x11,
-	0x3C,0x11,0x5A,0x09,0x5A,0x09,0x59,0x09,0x37,0x19,0xD5,0x18,0xB3,0x08,0x6E,0x08,0x2A,0x00,0x29,0x00,0x29,0x08,0x2A,0x00,0x2A,0x08,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x6F,0x10,0xB1,0x08,0xB1,0x08,0x72,0x10,0xD3,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0x78,0x31,0xB1,0x49,0xC7,0x21,0xC5,0x18,
-	0xDE,0x49,0xDD,0x49,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3E,0x83,0x3E,0x83,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3E,0x83,0xDF,0x7A,0x5E,0x7A,0x9B,0x5A,0x77,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0xF1,0x20,0x31,0x31,0x31,0x31,0x31,0x31,0x8E,0x31,
-	0xED,0x28,0xCA,0x28,0xA7,0x18,0x65,0x08,0x24,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0xCA,0x00,0x2A,0x01,
-	0xAB,0x00,0x2A,0x01,0xCD,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA4,0x08,0xA7,0x00,0xA4,0x08,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x67,0x08,0xA8,0x00,0x69,0x08,0xCA,0x00,0x6B,0x08,0xCD,0x00,0xCD,0x00,
-	0xCD,0x00,0xCF,0x08,0xCF,0x08,0xD1,0x18,0xCF,0x08,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x71,0x08,
-	0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD7,0x18,0xD9,0x08,0x3B,0x19,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x1E,0x11,0x3C,0x11,0xFC,0x10,0x3C,0x11,0xFC,0x10,0xD9,0x08,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,
-	0xD7,0x18,0xD7,0x18,0xD5,0x18,0xD5,0x18,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xAD,0x18,0xCD,0x00,0xAB,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0xA8,0x00,0x6A,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0xB3,0x08,
-	0x34,0x01,0x31,0x09,0x34,0x01,0x34,0x01,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x3B,0x19,0xD9,0x08,0x59,0x09,0x37,0x19,0xD3,0x10,0x6E,0x08,0x6B,0x00,0x29,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x08,0x2C,0x00,0x6C,0x08,0x6F,0x10,
-	0xB1,0x08,0x70,0x10,0xB1,0x08,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD5,0x18,0x75,0x10,0xD7,0x18,0xD7,0x18,0x19,0x21,0x5C,0x29,0x78,0x31,0x31,0x31,0x4A,0x29,0xC5,0x18,0xDD,0x49,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBF,0x6A,0x9B,0x5A,0x77,0x41,0x13,0x29,0x31,0x31,0xF1,0x20,0x31,0x31,0x31,0x31,0x31,0x31,0x8E,0x31,0x31,0x31,0x8E,0x31,0xCA,0x28,0xA8,0x18,0x66,0x08,0x25,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA7,0x00,0x2A,0x01,0xAB,0x00,0x2A,0x01,0x2A,0x01,0x2E,0x09,0x2A,0x01,0xCA,0x00,0x2A,0x01,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,
-	0xA4,0x08,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x65,0x00,0x66,0x00,0x68,0x08,0xA8,0x00,0x6A,0x08,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0x2E,0x09,0xAF,0x18,0x2E,0x09,0x31,0x09,0x31,0x09,0xD1,0x18,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCD,0x00,
-	0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0x69,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0x75,0x10,0xD9,0x08,0xD9,0x08,0x3B,0x19,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3C,0x11,0x3C,0x11,0xFC,0x10,0xFC,0x10,
-	0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFB,0x18,0xD9,0x08,0xFB,0x18,0x3B,0x19,0xFB,0x18,0x3B,0x19,0x3B,0x19,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x3B,0x19,0x3B,0x19,0x39,0x19,0x39,0x19,0x37,0x19,0x37,0x19,0xD5,0x18,0xB3,0x08,0xB1,0x08,0xB1,0x08,0x71,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,
-	0xAB,0x00,0xCA,0x00,0xA8,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x69,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0xB3,0x08,0x34,0x01,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5C,0x09,0xBD,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x11,
-	0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x39,0x19,0x37,0x09,0xB3,0x08,0x6E,0x08,0x6B,0x00,0x2A,0x00,0x2A,0x00,0x6A,0x08,0x2A,0x08,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x6F,0x10,0xB1,0x08,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD5,0x18,0x75,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xFB,0x18,0x3B,0x19,0x78,0x31,0xB1,0x49,0x4A,0x29,0xC5,0x18,
-	0xDE,0x49,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0x3E,0x83,0xDF,0x8A,0x3E,0x83,0x5F,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBC,0x7A,0x3C,0x6A,0x77,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0xF1,0x20,0x31,0x31,0x31,0x31,0x31,0x31,0x8E,0x31,
-	0xED,0x28,0xED,0x28,0xA8,0x18,0x66,0x08,0x65,0x08,0x24,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0x2A,0x01,
-	0xCA,0x00,0xAB,0x00,0x2A,0x01,0xAB,0x00,0x2A,0x01,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA4,0x08,0xA7,0x00,0xA7,0x00,0xA4,0x08,0x65,0x00,0x65,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0xAB,0x00,0xAB,0x00,
-	0xCD,0x00,0xCD,0x00,0x2E,0x09,0xCF,0x08,0xAF,0x18,0x2E,0x09,0x2E,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x75,0x00,
-	0xD7,0x08,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x3C,0x11,0x3C,0x11,0x3E,0x19,0x3C,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3C,0x11,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFB,0x18,0x3B,0x19,0x3C,0x11,0x5C,0x29,0x5C,0x29,0xBD,0x29,0xBD,0x29,0xBE,0x29,0xBD,0x29,0xBE,0x29,0xBD,0x29,0xBD,0x29,0xBD,0x29,0xBD,0x29,
-	0xBD,0x29,0x5C,0x29,0x3B,0x19,0x19,0x21,0x39,0x19,0x37,0x19,0x34,0x19,0xB3,0x08,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x69,0x00,0xA8,0x00,0xA8,0x00,0x6A,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0xB1,0x08,0xB3,0x08,
-	0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0xD7,0x08,0x5A,0x09,0x5A,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x5C,0x09,0x5C,0x09,0xFC,0x10,0x3B,0x19,0xD9,0x08,0xD7,0x18,0xD5,0x08,0x6E,0x08,0x2C,0x00,0x2A,0x08,0x6A,0x08,0x2A,0x00,0x2A,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,
-	0xB1,0x08,0xD1,0x18,0xB3,0x08,0xD3,0x10,0xD5,0x18,0x75,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x78,0x31,0xB1,0x49,0xC7,0x21,0xC5,0x18,0xDE,0x49,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBD,0x6A,0x9B,0x5A,0x77,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x8E,0x31,0xED,0x28,0xA8,0x18,0x66,0x10,0x66,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0x2A,0x01,0xAB,0x00,0xAB,0x00,0x2A,0x01,0xCD,0x00,0x2A,0x01,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,
-	0xA7,0x00,0xA7,0x00,0xA4,0x08,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0xCA,0x00,0xAB,0x00,0xAD,0x18,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,
-	0xAB,0x00,0xCA,0x00,0x69,0x00,0x69,0x00,0x29,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xD9,0x08,0x3C,0x11,0x3C,0x11,0x3E,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3C,0x11,0xFC,0x10,0x3B,0x19,0xFC,0x10,
-	0x3B,0x19,0x3C,0x11,0x5C,0x29,0x5C,0x29,0xBD,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBD,0x29,0x5E,0x29,0xBD,0x29,0xBD,0x29,0xBD,0x29,0xBD,0x29,0x3B,0x19,0x39,0x19,0x37,0x19,0xD5,0x18,0x34,0x01,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,
-	0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0x69,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x34,0x01,0x31,0x09,0x34,0x01,0x34,0x01,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5C,0x09,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,
-	0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x3B,0x19,0x59,0x09,0xD5,0x18,0xB1,0x08,0x6B,0x08,0x2A,0x00,0x2A,0x00,0x6B,0x08,0x2A,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x71,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x18,0xD5,0x08,0xD5,0x18,0xD7,0x18,0xD7,0x08,0xD7,0x18,0xD7,0x18,0xFB,0x18,0xFB,0x18,0x78,0x31,0x14,0x4A,0xA8,0x18,0xC5,0x18,
-	0xDE,0x49,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3E,0x83,0x3E,0x83,0x5F,0x9B,0xBF,0x9B,0x5F,0xA3,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0x9B,0x5A,0x77,0x41,0x13,0x29,0x31,0x31,0xF1,0x20,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x31,0x31,
-	0x8E,0x31,0xED,0x28,0xA8,0x18,0x66,0x10,0x66,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0xA8,0x00,
-	0xCA,0x00,0x2A,0x01,0x2A,0x01,0xCD,0x00,0xAB,0x00,0x2E,0x09,0xCD,0x00,0x2A,0x01,0xA8,0x00,0xA8,0x00,0x67,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA4,0x08,0x65,0x00,0x65,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x69,0x00,
-	0x6A,0x00,0x6A,0x08,0xAB,0x00,0x6B,0x08,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0x69,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,
-	0xD9,0x08,0x3C,0x11,0x3E,0x19,0x3E,0x19,0x3F,0x19,0x3F,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3C,0x11,0xFC,0x10,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3E,0x19,0x5C,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x7E,0x19,0xBD,0x29,0x7E,0x19,
-	0xBD,0x29,0x7E,0x19,0xBD,0x19,0x5C,0x29,0xBD,0x29,0x3B,0x19,0xB9,0x11,0x37,0x19,0xD5,0x18,0x34,0x01,0xB3,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0x6A,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0xB3,0x08,
-	0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0xD5,0x08,0x59,0x09,0x5A,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x5A,0x09,0x39,0x19,0xD5,0x08,0x71,0x08,0x6C,0x08,0x2A,0x00,0x2A,0x08,0x2A,0x00,0x6B,0x00,0x2C,0x00,0x6E,0x08,0x6E,0x08,
-	0xD1,0x18,0xB3,0x08,0xD3,0x10,0xD5,0x08,0xD5,0x18,0xD7,0x18,0x75,0x10,0xD7,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x29,0x78,0x31,0x51,0x41,0x4A,0x29,0xC5,0x18,0xDE,0x49,0xDE,0x49,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,
-	0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x3E,0x83,0xDF,0x7A,0xBD,0x6A,0x9B,0x5A,0x77,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x8E,0x31,0x8E,0x31,0xCA,0x28,0x68,0x18,0x66,0x08,0x25,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x2E,0x09,0x2A,0x01,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0xA7,0x00,
-	0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x65,0x08,0x65,0x00,0x65,0x00,0x64,0x00,0x24,0x00,0x65,0x00,0x25,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0x69,0x00,0x69,0x08,0x6A,0x08,0x6B,0x08,0xAB,0x00,0x6B,0x08,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0x69,0x00,
-	0x68,0x00,0x28,0x00,0x29,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFB,0x18,0x3C,0x11,0x3E,0x19,0x3E,0x19,0x3F,0x19,0x3F,0x19,0x3F,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x5C,0x29,0x5E,0x29,
-	0xBD,0x29,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x29,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5C,0x29,0xBD,0x19,0x5C,0x29,0xBB,0x11,0x78,0x31,0x39,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0xB3,0x08,0xB1,0x08,0x6E,0x08,0xCF,0x08,0xCD,0x00,
-	0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0x69,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0xD7,0x08,0xD7,0x08,0x5A,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x09,0x7F,0x11,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,
-	0x1E,0x11,0x5C,0x09,0x5C,0x09,0x3C,0x11,0x5A,0x09,0xD9,0x08,0x37,0x09,0xB1,0x08,0x6C,0x08,0x2A,0x08,0x6B,0x00,0x2A,0x00,0x6B,0x00,0x2C,0x00,0x6E,0x08,0x6E,0x08,0xB1,0x08,0xD3,0x10,0xB3,0x08,0xD5,0x18,0xD5,0x18,0xD7,0x08,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x5C,0x29,0x78,0x31,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0x3E,0x83,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0xDF,0xAB,0xBF,0x9B,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBC,0x7A,0x3D,0x5A,0x74,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0xF1,0x20,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,
-	0x31,0x31,0x8E,0x31,0xCA,0x28,0x68,0x18,0x66,0x10,0x25,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,
-	0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0x2A,0x01,0xAB,0x00,0x2E,0x09,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x67,0x00,0xA7,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x66,0x08,0x65,0x00,0x65,0x00,0x65,0x00,0x25,0x00,0x66,0x00,0x65,0x00,0x26,0x00,0x26,0x00,0x66,0x00,0x67,0x00,
-	0x68,0x00,0x68,0x08,0x69,0x08,0x69,0x08,0xCA,0x00,0x6A,0x08,0xCA,0x00,0xCA,0x00,0x6A,0x08,0xCA,0x00,0xCA,0x00,0x69,0x00,0xCA,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFB,0x18,
-	0x3E,0x19,0x7E,0x19,0x3F,0x19,0x3F,0x19,0x3F,0x11,0x7F,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3C,0x11,0x1E,0x11,0x3C,0x11,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xBE,0x29,0x5E,0x29,0xBE,0x29,0x5E,0x29,0x7E,0x19,0xBD,0x29,
-	0x7E,0x19,0x5C,0x29,0xBD,0x19,0x3C,0x11,0x3B,0x19,0x5C,0x29,0x3B,0x19,0xBB,0x11,0x39,0x19,0x37,0x19,0x37,0x19,0x34,0x01,0xD3,0x10,0xB1,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,
-	0xB3,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0xD7,0x08,0x37,0x09,0x5A,0x09,0x5C,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x59,0x09,0xD7,0x18,0xB1,0x08,0x6C,0x08,0x2C,0x00,0x2C,0x00,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,0xCF,0x08,
-	0xB1,0x08,0xB3,0x08,0xD3,0x10,0xD5,0x08,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x7A,0x41,0x14,0x4A,0xC7,0x21,0xC5,0x18,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xBF,0x9B,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBD,0x6A,0x9B,0x5A,0x77,0x41,0x13,0x29,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x8E,0x31,0xCA,0x28,0xA8,0x18,0x67,0x08,0x65,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0x2A,0x01,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x67,0x00,0x67,0x00,
-	0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x67,0x00,0x68,0x08,0x68,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x69,0x00,0x68,0x08,0x69,0x00,0x69,0x00,0x29,0x00,0x29,0x00,0x69,0x00,0x69,0x00,
-	0x69,0x00,0x6A,0x00,0x6B,0x00,0xCD,0x00,0x6E,0x08,0x6E,0x08,0xB1,0x08,0x71,0x08,0xB3,0x08,0x75,0x00,0x75,0x10,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3C,0x11,0x3E,0x19,0x7F,0x19,0x3F,0x19,0x3F,0x19,0x3F,0x19,0x3F,0x11,0x3F,0x19,0x1E,0x11,0x3E,0x19,0x3E,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBD,0x29,0x7E,0x19,0x5C,0x29,0x5C,0x29,0xBD,0x19,0x3B,0x19,0x3B,0x19,0x19,0x21,0xB9,0x11,0x39,0x19,0x37,0x19,0x37,0x19,0x72,0x09,0xB1,0x08,0xCF,0x08,0xCD,0x00,
-	0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,0x6A,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0xB3,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xD7,0x08,0xD7,0x08,0x59,0x09,0x5C,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,
-	0x7E,0x09,0x7E,0x09,0x1E,0x11,0x5C,0x09,0x5A,0x09,0x5A,0x09,0x37,0x09,0xD3,0x10,0x6C,0x08,0x2C,0x00,0x6B,0x00,0x2C,0x00,0x2C,0x00,0x2C,0x00,0x6E,0x08,0x6E,0x08,0x70,0x10,0xB3,0x08,0xB3,0x08,0xD5,0x18,0xD5,0x08,0xD7,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0xD9,0x08,0xFB,0x18,0x5C,0x29,0x3C,0x4A,0x51,0x41,0x4A,0x29,0xC5,0x18,
-	0xFE,0x51,0xFE,0x51,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,0xBF,0x9B,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3E,0x83,0x5E,0x7A,0x19,0x52,0x77,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x31,0x31,
-	0x51,0x41,0x8E,0x31,0xED,0x28,0xA8,0x18,0x66,0x10,0x66,0x08,0x25,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x66,0x00,0x66,0x00,
-	0xA7,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0x2A,0x01,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0xA7,0x00,0xA7,0x00,0x67,0x08,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
-	0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x29,0x00,0x2A,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0x75,0x00,0x75,0x10,0xD7,0x08,0xD9,0x08,0xFB,0x18,0x3B,0x19,0x3E,0x19,0x7E,0x19,
-	0x7F,0x19,0x3F,0x19,0x7F,0x19,0x3F,0x19,0x3F,0x19,0x1E,0x11,0x1E,0x11,0x3E,0x19,0x3C,0x11,0x7E,0x19,0x5C,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x3F,0x42,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBD,0x29,0x5E,0x29,0xBD,0x29,0x7E,0x19,0x5C,0x29,
-	0x5C,0x29,0x3C,0x11,0x5C,0x29,0x3B,0x19,0x3B,0x19,0x5C,0x29,0x3B,0x19,0xBB,0x11,0x19,0x21,0xB9,0x11,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0xD1,0x18,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,
-	0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x3B,0x19,0x37,0x09,0xB3,0x08,0x6E,0x08,0x6B,0x00,0x2C,0x00,0x2C,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,
-	0xB1,0x08,0x72,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xBD,0x29,0x7A,0x41,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3E,0x83,0x5F,0x9B,0x5F,0x9B,0x5F,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,
-	0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBD,0x6A,0xD9,0x61,0x77,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x8E,0x31,0xED,0x28,0xA8,0x18,0x66,0x10,0x66,0x08,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0x2A,0x01,0xCD,0x00,0x2A,0x01,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,
-	0x68,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x67,0x08,0x67,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x67,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x29,0x00,0x2A,0x00,0x6B,0x00,0x6B,0x00,
-	0x6C,0x08,0xCD,0x00,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB1,0x08,0x72,0x08,0xD5,0x08,0x75,0x10,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3E,0x19,0x7E,0x19,0x5E,0x29,0x7F,0x19,0x3F,0x19,0x3F,0x19,0x7F,0x19,0x3F,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x7E,0x19,0xBD,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x5F,0x2A,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xBD,0x29,0x5E,0x31,0x5E,0x29,0xBD,0x29,0x5E,0x29,0x7E,0x19,0x5C,0x29,0x5C,0x29,0x5C,0x29,0xBD,0x19,0x5C,0x29,0x3B,0x19,0x3B,0x19,0x3B,0x19,0x3B,0x19,0x3B,0x19,0x19,0x21,0x39,0x19,0x39,0x19,0x39,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0x72,0x09,0xB1,0x08,
-	0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0x6B,0x00,0xAB,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0x37,0x09,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,
-	0x7E,0x09,0x7E,0x11,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x37,0x09,0xD3,0x10,0x6C,0x08,0x2C,0x00,0x2C,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0xCF,0x08,0x71,0x08,0xB3,0x08,0xD3,0x10,0xD5,0x08,0x75,0x10,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,
-	0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0x3E,0x83,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xDF,0xAB,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBC,0x7A,0x9B,0x5A,0x35,0x31,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,
-	0x51,0x41,0x8E,0x31,0xED,0x28,0xCA,0x28,0x68,0x18,0x26,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x65,0x00,
-	0x66,0x00,0x66,0x00,0x67,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0x2A,0x01,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x26,0x00,0x26,0x00,
-	0x25,0x00,0x25,0x00,0x26,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x29,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB1,0x08,0x72,0x08,0xB3,0x08,0x75,0x00,0x75,0x10,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x7F,0x19,0x3F,0x19,
-	0x3F,0x19,0x3F,0x19,0x3F,0x19,0x3F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x5F,0x2A,0x3F,0x42,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x29,0xBD,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x3C,0x11,0x3B,0x19,
-	0x3B,0x19,0x3B,0x19,0x3B,0x19,0x3B,0x19,0x19,0x21,0x3B,0x19,0x39,0x19,0x3B,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x37,0x19,0x37,0x19,0xB6,0x11,0xD3,0x10,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xAB,0x00,0x6B,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0xB3,0x08,
-	0xB3,0x08,0x34,0x01,0x34,0x01,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5C,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x3B,0x19,0x39,0x19,0xB3,0x08,0x6E,0x08,0x2C,0x00,0x2C,0x00,0x6C,0x08,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,
-	0x71,0x08,0xB3,0x08,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5E,0x31,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xBC,0x7A,0x3E,0x83,0x3F,0x8B,0x5F,0x9B,0x5F,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBD,0x6A,0x19,0x52,0x77,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x8E,0x31,0xCA,0x28,0x68,0x08,0x66,0x10,0x25,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0x2A,0x01,0xAB,0x10,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,
-	0xA8,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x66,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x27,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,
-	0x6E,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x7F,0x19,0x3F,0x19,0x3F,0x19,0x3F,0x19,0x3F,0x19,0x7E,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x3F,0x42,0xDF,0x31,0x3F,0x42,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x3C,0x11,0x3B,0x19,0x5C,0x29,0x3B,0x19,0x3B,0x19,0x19,0x21,0x3B,0x19,0x19,0x21,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0xD3,0x10,
-	0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0x6A,0x00,0x6A,0x00,0xCA,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x31,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5C,0x09,0x7E,0x09,0xBE,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0xBE,0x09,
-	0x7E,0x09,0x7E,0x09,0x7E,0x11,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x39,0x19,0xB3,0x08,0x6C,0x08,0x2C,0x00,0x2C,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0xCF,0x08,0xB1,0x08,0x72,0x10,0xB3,0x08,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x3C,0x11,0x5E,0x31,0x7A,0x41,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xBF,0x6A,0xDF,0x8A,0x3E,0x83,0x5F,0x9B,0x5F,0x9B,0xBF,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBC,0x7A,0x19,0x52,0x74,0x41,0x51,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x74,0x41,0x51,0x41,
-	0x51,0x41,0x8E,0x31,0x8E,0x31,0xCA,0x28,0x68,0x18,0x26,0x08,0x65,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,
-	0x25,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0x2A,0x01,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x27,0x00,0x67,0x00,0x27,0x00,
-	0x67,0x00,0x27,0x00,0x27,0x00,0x67,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x29,0x00,0x6A,0x00,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0xB3,0x08,0x75,0x00,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x3B,0x19,0x3E,0x19,0x5E,0x29,0x7E,0x19,0x5E,0x29,0x3F,0x19,0x7F,0x19,0x3F,0x19,
-	0x3F,0x19,0x3F,0x19,0x3F,0x19,0x7E,0x19,0x5E,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0x3F,0x42,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5E,0x29,0x5C,0x29,0x3C,0x11,0x5C,0x29,0xFB,0x18,0x3B,0x19,0xFB,0x18,
-	0x19,0x21,0x3B,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x37,0x19,0x37,0x09,0x37,0x19,0x37,0x19,0x75,0x09,0x34,0x19,0xD3,0x10,0xB1,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,
-	0xB3,0x08,0x34,0x01,0x37,0x09,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0x5C,0x09,0xBE,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x11,0x5C,0x09,0x3B,0x19,0x59,0x09,0xD3,0x10,0x6E,0x08,0x2C,0x00,0x6C,0x08,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,
-	0x70,0x10,0xB3,0x08,0xD5,0x18,0x75,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x5C,0x29,0xBD,0x29,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0xBC,0x7A,0x3E,0x83,0x3E,0x83,0xBF,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xBC,0x7A,0xBD,0x6A,0xD9,0x61,0x74,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x0E,0x41,0xED,0x28,0x68,0x18,0x67,0x08,0x26,0x08,0x24,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x25,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,
-	0xCA,0x00,0xCA,0x00,0xA8,0x00,0xA8,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x28,0x00,0x68,0x00,0x28,0x00,0x68,0x00,0x28,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x2A,0x00,0x6A,0x00,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6F,0x10,0x71,0x08,0x72,0x08,
-	0x72,0x08,0xD5,0x08,0x75,0x10,0xD7,0x08,0xD7,0x18,0xD9,0x08,0x3B,0x19,0x3C,0x11,0x3E,0x19,0x5E,0x29,0x7E,0x19,0x7F,0x19,0x3F,0x19,0x7F,0x19,0x3F,0x19,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0x3F,0x42,0xDF,0x31,0xDF,0x31,0xDF,0x31,
-	0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5C,0x29,0x5C,0x29,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x3B,0x19,0x19,0x21,0x39,0x19,0x39,0x19,0x39,0x19,0xD7,0x18,0x37,0x19,0xD7,0x18,0x37,0x19,0xD7,0x18,0x37,0x09,0x37,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,
-	0x72,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0x6B,0x00,0xCA,0x00,0x6A,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,0x34,0x01,0x34,0x01,0xD5,0x08,0x34,0x01,0x37,0x09,0xD5,0x08,0xD7,0x08,0xD7,0x08,0x5A,0x09,0x5C,0x09,0x7E,0x11,0xBE,0x09,0xBE,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x09,
-	0x7E,0x09,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x5A,0x09,0x39,0x19,0xB3,0x08,0x6E,0x08,0x2C,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0xB1,0x08,0xB1,0x08,0xD3,0x10,0xD5,0x08,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5E,0x31,0xBD,0x39,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x3E,0x62,0x7F,0x6A,0x5E,0x7A,0xDF,0x7A,0x3E,0x83,0x3F,0x8B,0x5F,0x9B,0xBD,0xA3,0x5F,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xBC,0x7A,0x19,0x52,0x74,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x74,0x41,0x51,0x41,
-	0xB1,0x49,0x51,0x41,0x8E,0x31,0xED,0x28,0x68,0x18,0x66,0x10,0x26,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x24,0x00,0x25,0x00,0x25,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,0x69,0x00,0xCA,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,
-	0x6A,0x00,0x6A,0x00,0x6A,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0x75,0x10,0xD7,0x08,0xD9,0x08,0xD9,0x08,0x3B,0x19,0x3B,0x19,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x7E,0x19,0x7F,0x19,0x5E,0x29,0x7F,0x19,0x5E,0x29,0x5E,0x29,0x3F,0x19,
-	0x5E,0x29,0x5E,0x29,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x29,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5E,0x29,0x5C,0x29,0x5C,0x29,0xFB,0x18,0x3B,0x19,0x3B,0x19,
-	0x19,0x21,0x39,0x19,0x39,0x19,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x08,0x37,0x09,0xD7,0x18,0x37,0x09,0x37,0x19,0x37,0x19,0x37,0x09,0x37,0x19,0x75,0x09,0x34,0x19,0x34,0x19,0xD3,0x10,0x31,0x09,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,
-	0x34,0x01,0xD5,0x08,0x34,0x01,0x37,0x09,0xD5,0x08,0xD7,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5C,0x09,0x7E,0x11,0x7E,0x11,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x11,0x7E,0x09,0x7E,0x11,0x5C,0x09,0x3C,0x11,0x39,0x19,0xD3,0x10,0x6E,0x08,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x2C,0x00,0x6E,0x08,0x6E,0x08,0xCF,0x08,
-	0x71,0x08,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x3E,0x19,0xDF,0x31,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,0x3E,0x62,0x7F,0x6A,0xBF,0x6A,0xDF,0x7A,0x3E,0x83,0x3F,0x8B,0xBF,0x9B,0xBF,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,
-	0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xBC,0x7A,0xBD,0x6A,0x19,0x52,0x74,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0x51,0x41,0xB1,0x49,0x8E,0x31,0xED,0x28,0xA8,0x18,0x66,0x10,0x26,0x08,0x25,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,
-	0x6B,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x08,0x6A,0x08,0x6B,0x08,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0x75,0x10,0xD7,0x08,
-	0xD7,0x18,0xD9,0x08,0x19,0x21,0xFB,0x18,0x3C,0x11,0x5C,0x29,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x7E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDE,0x49,0x3F,0x42,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xDF,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0xFB,0x18,0xFB,0x18,0x3B,0x19,0xFB,0x18,0x39,0x19,0x39,0x19,0x39,0x19,0xD7,0x18,0xD5,0x18,0xD7,0x18,0xD5,0x08,0xD7,0x18,0x37,0x09,0xD5,0x18,0x37,0x19,0x34,0x01,0xD5,0x18,0x75,0x09,
-	0x34,0x19,0x72,0x09,0xD1,0x18,0xCF,0x08,0xCF,0x08,0xCD,0x00,0x6B,0x00,0xAB,0x00,0x6A,0x00,0xAB,0x00,0xAB,0x00,0x6C,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xD7,0x08,0x34,0x01,0xD7,0x08,0xD7,0x08,0xD9,0x08,0x5C,0x09,0xBD,0x09,0x7E,0x11,0xBE,0x09,0x7E,0x09,0xBE,0x09,0x7E,0x11,
-	0x7E,0x11,0xBE,0x09,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x3B,0x19,0x59,0x09,0xD3,0x10,0x6E,0x08,0x2C,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0xB3,0x08,0x72,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0xDF,0x31,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,
-	0x7F,0x6A,0x7F,0x6A,0xDF,0x7A,0x3E,0x83,0x3E,0x83,0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xBC,0x7A,0x39,0x72,0x19,0x52,0x74,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,
-	0xB1,0x49,0xB1,0x49,0xB1,0x49,0xED,0x28,0xCA,0x28,0x68,0x18,0x66,0x10,0x65,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0xCA,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x08,0xCA,0x00,0x6B,0x08,0x6A,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x6B,0x00,
-	0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0xD5,0x08,0xD5,0x18,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3C,0x11,0x3C,0x11,0x5C,0x29,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x5C,0x29,0xBD,0x29,
-	0xBD,0x39,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDF,0x31,0xDE,0x49,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0xFB,0x18,
-	0x19,0x21,0xFB,0x18,0x19,0x21,0x39,0x19,0x39,0x19,0xD7,0x18,0x37,0x09,0xD5,0x18,0x37,0x09,0xD5,0x18,0x34,0x01,0xD5,0x18,0x34,0x01,0x37,0x09,0x34,0x19,0x34,0x01,0x34,0x19,0xD3,0x10,0x31,0x09,0xB1,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,
-	0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0x7E,0x11,0xBE,0x19,0x7E,0x11,0x7E,0x09,0x7E,0x11,0xBE,0x09,0x7E,0x11,0x7F,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x3B,0x19,0x39,0x19,0xB3,0x08,0x6E,0x08,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x6F,0x10,
-	0xB1,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x3C,0x11,0x5C,0x29,0x5E,0x29,0xBD,0x39,0xBD,0x39,0x14,0x4A,0x4A,0x29,0xC5,0x18,0x7F,0x6A,0xBF,0x6A,0xBC,0x7A,0xDF,0x8A,0x3E,0x83,0x5F,0x9B,0xBD,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,
-	0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xBC,0x7A,0x39,0x72,0x19,0x52,0x74,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0xB1,0x49,0xB1,0x49,0x51,0x41,0x8E,0x31,0xCA,0x28,0x68,0x18,0x66,0x10,0x66,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x66,0x00,0x27,0x00,0x27,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,
-	0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x3B,0x19,
-	0x3C,0x11,0x3E,0x19,0x5C,0x29,0x3E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x5E,0x29,0x5C,0x29,0xBD,0x29,0xBD,0x39,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0x3D,0x5A,0x3F,0x42,0x3C,0x4A,0xDD,0x49,0x3F,0x42,0xDD,0x49,0xDE,0x49,0xDE,0x49,0xBD,0x39,0xDF,0x31,0xDE,0x49,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x31,0xDF,0x31,0x5E,0x31,0xBD,0x39,0x5E,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x19,0x21,0x19,0x21,0x39,0x19,0x39,0x19,0xD7,0x18,0x37,0x09,0xD7,0x18,0xD5,0x08,0xD5,0x18,0xD5,0x08,0x34,0x01,0xD5,0x18,0x34,0x01,0x34,0x01,
-	0xD3,0x10,0x72,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0xB3,0x08,0x34,0x01,0xD5,0x08,0x34,0x01,0xD5,0x08,0x37,0x09,0xD5,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0x5C,0x09,0x7E,0x11,0x7E,0x11,0xBE,0x09,0xBE,0x09,0x7E,0x11,
-	0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x3B,0x19,0x39,0x19,0xD3,0x10,0x6E,0x08,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0xDF,0x31,0x3C,0x4A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3E,0x83,0x3F,0x8B,0x5F,0x9B,0xBF,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xBC,0x7A,0xBD,0x6A,0x95,0x59,0x74,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x74,0x41,0x51,0x41,
-	0x51,0x41,0xB1,0x49,0xB1,0x49,0x0E,0x41,0xCA,0x28,0x68,0x18,0x67,0x08,0x26,0x08,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,
-	0x64,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x28,0x00,0x68,0x00,0x29,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,
-	0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0x72,0x08,0x75,0x00,0x75,0x10,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x3B,0x19,0x5C,0x29,0x5E,0x29,0x7E,0x19,0x5E,0x29,0x7E,0x19,0x5E,0x29,0x5E,0x29,0x7E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBD,0x29,0x5E,0x31,0xDF,0x31,0xDE,0x49,0x3F,0x42,
-	0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3C,0x4A,0xDE,0x49,0x3F,0x42,0xDE,0x49,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xBD,0x39,0xDE,0x49,0xBD,0x39,0xDE,0x49,0x5E,0x31,0xDE,0x49,0xBD,0x39,0xDE,0x49,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xDD,0x49,0xDE,0x49,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,
-	0xBD,0x39,0x7A,0x41,0x5C,0x29,0x19,0x21,0x19,0x21,0x39,0x19,0x37,0x19,0xD7,0x18,0xD5,0x18,0xD5,0x08,0xD5,0x08,0xD5,0x18,0x34,0x01,0x34,0x01,0xD3,0x10,0x34,0x01,0x34,0x01,0x31,0x09,0xD3,0x10,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,
-	0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0xD5,0x08,0x34,0x01,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0x5C,0x09,0x7E,0x11,0xBE,0x09,0xBE,0x19,0x7E,0x11,0xBE,0x09,0x7E,0x11,0xBE,0x09,0x7F,0x11,0x7E,0x11,0xBD,0x19,0x3B,0x19,0x39,0x19,0xB3,0x08,0x6E,0x08,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,
-	0xB1,0x08,0xD3,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0xFB,0x18,0x3C,0x11,0x3E,0x19,0x5E,0x31,0xDF,0x31,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,0x7F,0x6A,0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,0xBD,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,
-	0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xBD,0x8A,0x39,0x72,0x19,0x52,0x74,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0xB1,0x49,0xB1,0x49,0x51,0x41,0x8E,0x31,0xED,0x28,0xA8,0x18,0x66,0x10,0x26,0x08,0x25,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x67,0x00,0x27,0x00,0x27,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,
-	0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0xB3,0x08,0x75,0x10,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x7E,0x19,0x5E,0x29,
-	0x7F,0x19,0x5E,0x29,0x7F,0x19,0x5E,0x29,0x7E,0x19,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x31,0xDF,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3D,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xBD,0x39,0xDE,0x49,0xDE,0x49,
-	0xDE,0x49,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x42,0x3D,0x5A,0x3F,0x5A,0x3F,0x5A,0x3D,0x5A,0x3C,0x4A,0x3C,0x4A,0xDD,0x49,0xBD,0x39,0xBD,0x39,0x78,0x31,0x19,0x21,0x39,0x19,0xD7,0x18,0xD7,0x18,0xD5,0x18,0xD5,0x08,0xD5,0x08,0xD3,0x10,0xB3,0x08,0x34,0x01,0xD3,0x10,
-	0x34,0x19,0x72,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,0x34,0x01,0x34,0x01,0x37,0x09,0x34,0x01,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0x5A,0x09,0x5A,0x09,0x5C,0x09,0xBE,0x19,0xBE,0x09,0xBE,0x19,0x7E,0x11,
-	0x7F,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x3B,0x19,0x39,0x19,0xB3,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,0xB1,0x08,0xD3,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3E,0x19,0x5E,0x31,0xDF,0x31,0x3C,0x4A,0x14,0x4A,0xC7,0x21,0xC5,0x18,
-	0x7F,0x6A,0xDF,0x7A,0xDF,0x8A,0x3E,0x83,0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0x3F,0x8B,0xBC,0x7A,0x39,0x72,0x95,0x59,0x74,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x74,0x41,0xB1,0x49,
-	0x51,0x41,0xB1,0x49,0xB1,0x49,0x0E,0x41,0xED,0x28,0xA8,0x18,0x66,0x10,0x26,0x08,0x65,0x08,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x65,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,
-	0x66,0x00,0x27,0x00,0x27,0x00,0x67,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x68,0x00,0x69,0x00,0x29,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x6B,0x00,0x2C,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x72,0x08,
-	0x72,0x08,0x72,0x08,0x72,0x08,0xD5,0x08,0x75,0x10,0xD7,0x08,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x7F,0x19,0x5E,0x29,0x7F,0x19,0x7F,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5E,0x29,0xBD,0x39,0xDF,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,
-	0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3D,0x5A,0x3F,0x42,0xFE,0x51,0x3F,0x42,0xFE,0x51,0x3F,0x42,0xDE,0x49,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xDD,0x49,0xDD,0x49,0xFE,0x51,0x3D,0x5A,0x3F,0x5A,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,
-	0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x3C,0x4A,0x3C,0x4A,0xBD,0x39,0x78,0x31,0x39,0x19,0xD7,0x18,0xD7,0x18,0xD5,0x18,0xD5,0x08,0xD5,0x08,0xB3,0x08,0xD3,0x10,0x34,0x01,0x31,0x09,0xD3,0x10,0x72,0x09,0xD1,0x18,0x31,0x09,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0xB3,0x08,
-	0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x34,0x01,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0x5A,0x09,0x5C,0x09,0x7E,0x11,0xBE,0x19,0x7F,0x11,0xBE,0x19,0x7E,0x11,0x7F,0x11,0x7E,0x11,0x7E,0x19,0xBD,0x19,0x3B,0x19,0xD7,0x18,0xB3,0x08,0x6C,0x08,0x6B,0x00,0x6C,0x08,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,
-	0x70,0x10,0x72,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0x39,0x19,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x5E,0x31,0xDF,0x31,0x3C,0x4A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xBF,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,
-	0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xBC,0x7A,0x39,0x72,0x77,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0xB1,0x49,0x51,0x41,0xB1,0x49,0xB1,0x49,0x51,0x41,0x6E,0x51,0xED,0x28,0xCA,0x28,0x68,0x18,0x26,0x08,0x25,0x08,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x65,0x08,0x66,0x08,0x66,0x08,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x67,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,
-	0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0x72,0x08,0x72,0x08,0x75,0x00,0x75,0x10,0xD5,0x08,0x75,0x10,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3E,0x19,
-	0x3F,0x19,0x3F,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3D,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x42,0xFE,0x51,0x3F,0x42,0xFE,0x51,0xFE,0x51,0x3D,0x5A,0xFE,0x51,0x3D,0x5A,
-	0x3D,0x5A,0x3D,0x5A,0x3E,0x62,0xBD,0x6A,0xBF,0x6A,0xDF,0x7A,0x3F,0x7B,0x3F,0x7B,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0x3D,0x5A,0x3C,0x4A,0x7A,0x41,0x19,0x21,0x37,0x19,0xD7,0x18,0xD5,0x18,0xD3,0x10,0xB3,0x08,0xD3,0x10,0xB3,0x08,
-	0xD3,0x10,0x31,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x34,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x37,0x09,0x34,0x01,0xD5,0x08,0x34,0x01,0xD7,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5C,0x09,0x7E,0x11,0xBE,0x09,0xBE,0x19,0x7F,0x11,
-	0x7F,0x11,0xBE,0x19,0x7F,0x11,0x7E,0x11,0x3C,0x11,0x3B,0x19,0xD7,0x18,0xB3,0x08,0x6C,0x08,0x2C,0x00,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0xB1,0x08,0x72,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3E,0x19,0x5C,0x29,0x5E,0x31,0x3F,0x42,0x3C,0x4A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDF,0x7A,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xBD,0x8A,0x39,0x72,0x95,0x59,0x74,0x41,0x31,0x31,0x0E,0x41,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0xB1,0x49,
-	0xB1,0x49,0xB1,0x49,0xB1,0x49,0x8E,0x31,0x8E,0x31,0xCA,0x28,0x66,0x10,0x26,0x08,0x65,0x08,0x24,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x66,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x68,0x08,0x68,0x08,0x28,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,
-	0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0xCD,0x00,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x6E,0x08,0x71,0x08,0x70,0x10,0x71,0x08,0x70,0x10,0x72,0x10,0x72,0x10,0x72,0x10,0xD5,0x08,0x75,0x10,0x75,0x10,0x75,0x10,0x75,0x10,0xD7,0x08,
-	0xD7,0x18,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xBD,0x39,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,
-	0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3D,0x5A,0x3D,0x5A,0x3D,0x5A,0x3C,0x6A,0x7F,0x6A,0xBD,0x6A,0xDF,0x7A,0x3F,0x7B,0x3F,0x8B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0xBF,0x83,0x3F,0x7B,
-	0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3C,0x4A,0x7A,0x41,0x78,0x31,0x37,0x19,0xD7,0x18,0xD5,0x08,0xD3,0x10,0xB3,0x08,0x31,0x09,0x31,0x09,0xD3,0x10,0x31,0x09,0xD1,0x18,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0x34,0x01,
-	0x34,0x01,0x37,0x09,0x75,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0xD5,0x08,0xD5,0x08,0x37,0x09,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5C,0x09,0xBE,0x19,0x7F,0x11,0x7F,0x11,0x7F,0x11,0x7F,0x11,0x7E,0x11,0x7E,0x19,0x3C,0x11,0x3B,0x19,0x37,0x19,0xB1,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,
-	0xB1,0x08,0xD3,0x10,0xD3,0x10,0xD7,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0xFB,0x18,0x3E,0x19,0x5C,0x29,0xDF,0x31,0xDF,0x31,0x3C,0x4A,0x14,0x4A,0xC7,0x21,0xC5,0x18,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,
-	0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xBC,0x7A,0x39,0x72,0x95,0x59,0x51,0x41,0x31,0x31,0x31,0x31,0x0E,0x41,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x6E,0x51,0x8E,0x31,0xCA,0x28,0x68,0x18,0x66,0x10,0x24,0x08,0x64,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x24,0x08,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x67,0x08,0x27,0x08,0x68,0x08,0x68,0x08,0x69,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0xCD,0x00,0x6E,0x08,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0xB1,0x08,0xB1,0x08,0x71,0x08,
-	0xB1,0x08,0x72,0x08,0x72,0x08,0x72,0x10,0x72,0x08,0x72,0x10,0xB3,0x08,0xD5,0x08,0xD5,0x18,0x75,0x10,0xD7,0x18,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,
-	0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xBD,0x39,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3D,0x5A,0x3C,0x6A,0x7F,0x6A,0xBC,0x7A,
-	0x3E,0x83,0x3F,0x8B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x83,0x3F,0x8B,0xBF,0x83,0x3E,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x5A,0x3D,0x5A,0x3C,0x4A,0xBD,0x39,0x78,0x31,0x37,0x19,0xD5,0x18,0xD5,0x18,0xB3,0x08,0xB3,0x08,
-	0xB3,0x08,0x31,0x09,0xD3,0x10,0x31,0x09,0xD1,0x18,0xCF,0x08,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x34,0x01,0x34,0x01,0x75,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0xD5,0x08,0xD7,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x5C,0x09,0x7E,0x11,0xBE,0x19,0x7F,0x11,
-	0x7E,0x11,0x7F,0x11,0x7F,0x11,0x3C,0x11,0x3B,0x19,0x39,0x19,0xD7,0x18,0xB1,0x08,0x6C,0x08,0x6B,0x00,0x2C,0x00,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x70,0x10,0x72,0x10,0xD5,0x08,0x75,0x10,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3E,0x19,0x5E,0x29,0xDF,0x31,0x3F,0x42,0x3C,0x4A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDF,0x7A,0xDF,0x8A,0x3E,0x83,0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xBC,0x7A,0xD9,0x61,0x74,0x41,0x51,0x41,0x31,0x31,0xED,0x28,0xED,0x28,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0xB1,0x49,
-	0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x0E,0x41,0xCA,0x28,0xA8,0x18,0x66,0x10,0x65,0x08,0x24,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x25,0x00,0x25,0x08,0x26,0x00,0x27,0x00,0x68,0x08,0x68,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0xCF,0x08,
-	0xAF,0x18,0xAF,0x18,0xCF,0x08,0xCF,0x08,0x6E,0x08,0xCF,0x08,0xCF,0x08,0x71,0x08,0xB1,0x08,0x71,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0xB3,0x08,0x75,0x00,0xB3,0x08,0x75,0x00,0xD5,0x08,0x75,0x10,0xD7,0x18,0x75,0x10,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,
-	0x5C,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5C,0x29,0x5E,0x29,0x5C,0x29,0x5E,0x31,0x5C,0x31,0x5E,0x31,0xDF,0x31,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,
-	0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0x3D,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xBC,0x7A,0xDF,0x8A,0x3F,0x8B,0xBF,0x9B,0xBF,0x9B,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x3F,0x9C,0xDF,0xAB,0x3F,0x9C,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x3F,0x8B,
-	0xBF,0x83,0x3E,0x83,0x3E,0x83,0x3E,0x83,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3C,0x4A,0x7A,0x41,0x78,0x31,0x37,0x19,0xD5,0x18,0xD3,0x10,0xB3,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0xB1,0x08,0x31,0x09,0x31,0x09,0xCF,0x08,0xCD,0x00,0xCD,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xB1,0x08,0x31,0x09,0x34,0x01,
-	0x75,0x09,0x37,0x09,0xB7,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0xB3,0x08,0x34,0x01,0x34,0x01,0xD7,0x08,0xD7,0x08,0x5A,0x09,0x5C,0x09,0x7E,0x11,0x7E,0x11,0xBE,0x19,0x7F,0x11,0x7F,0x11,0x7E,0x19,0xBD,0x19,0x3B,0x19,0x39,0x19,0xD5,0x08,0xB1,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,
-	0x71,0x08,0xD3,0x10,0xD3,0x10,0xD7,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5E,0x29,0xDF,0x31,0x3F,0x42,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x5F,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,
-	0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xBC,0x7A,0xD9,0x61,0x74,0x41,0x51,0x41,0xED,0x28,0xED,0x28,0x0E,0x41,0x31,0x31,0x0E,0x41,0x51,0x41,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x6E,0x51,0x8E,0x31,0x0B,0x39,0xA8,0x18,0x66,0x10,0x25,0x08,0x65,0x08,0x24,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x24,0x08,0x24,0x00,
-	0x24,0x08,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x08,0x67,0x08,0x29,0x08,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0xCF,0x08,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xB3,0x08,0xB3,0x08,0xD3,0x10,0xB3,0x08,0xD3,0x10,0xD5,0x08,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD7,0x18,
-	0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0x19,0x21,0xD9,0x08,0xFB,0x18,0x3B,0x19,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5C,0x29,0x5E,0x31,0x5C,0x29,
-	0x5C,0x31,0x5E,0x31,0xBD,0x39,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3D,0x5A,0x3F,0x5A,0xFE,0x51,0x3D,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0xDF,0x7A,0xDF,0x8A,0x3F,0x8B,0xBF,0x9B,0xDF,0xAB,
-	0xDF,0xAB,0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,0x5F,0xB4,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x3E,0x83,0xBF,0x83,0x3E,0x83,0x3E,0x83,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3C,0x4A,0x7A,0x41,0x78,0x31,0xD5,0x18,0xD5,0x18,0xB3,0x08,
-	0xB3,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0x31,0x09,0x34,0x01,0x75,0x09,0xB7,0x09,0x75,0x09,0x75,0x09,0x34,0x01,0x31,0x09,0x31,0x09,0x34,0x01,0x34,0x01,0xD7,0x08,0xD7,0x08,0x5A,0x09,0x5A,0x09,0x3C,0x11,0xBE,0x19,0x7F,0x11,
-	0x7E,0x19,0x7E,0x19,0x7E,0x11,0x3C,0x11,0x3B,0x19,0x39,0x19,0xD3,0x10,0x71,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x00,0x2A,0x00,0x6B,0x08,0x2C,0x00,0x6C,0x08,0x6E,0x08,0xD1,0x18,0x72,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x5E,0x31,0xDF,0x31,0x3F,0x42,0x19,0x52,0x14,0x4A,0x4A,0x29,0xE3,0x18,
-	0xDF,0x7A,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0xBD,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0x5B,0x82,0xD9,0x61,0x74,0x41,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0x0E,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0xB1,0x49,
-	0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x0E,0x41,0xED,0x28,0xCA,0x28,0x66,0x10,0x25,0x08,0x65,0x10,0x64,0x08,0x23,0x08,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x08,0x26,0x00,0x26,0x08,0x27,0x00,0x28,0x00,0x69,0x08,0x69,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x6F,0x10,0xB1,0x08,0xB1,0x08,
-	0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD5,0x18,0x37,0x19,0xD7,0x18,0x37,0x19,0xD7,0x18,0x37,0x19,0xD7,0x18,0x39,0x19,0x39,0x19,0xD9,0x08,0x39,0x19,0xFB,0x18,0x3B,0x19,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x3C,0x11,0x5C,0x29,0x5C,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3F,0x19,
-	0x5E,0x29,0x3F,0x19,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5E,0x31,0x5C,0x29,0x5E,0x31,0xBD,0x39,0xDE,0x49,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3D,0x5A,0x3F,0x5A,0x3E,0x62,
-	0xFE,0x51,0x3D,0x5A,0x3E,0x62,0xFE,0x51,0x3D,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x5E,0x7A,0x3E,0x83,0x3F,0x8B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0xBF,0x83,
-	0xBF,0x9B,0x3F,0x8B,0x3E,0x83,0x3E,0x83,0x3E,0x83,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3D,0x5A,0x3C,0x4A,0x78,0x31,0x37,0x19,0xD5,0x18,0xD3,0x10,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0x31,0x09,0x34,0x01,
-	0x75,0x09,0xB7,0x09,0xB7,0x09,0x75,0x09,0x34,0x01,0x31,0x09,0x31,0x09,0xB3,0x08,0x34,0x01,0xD5,0x08,0xD7,0x08,0x59,0x09,0x5A,0x09,0x3C,0x11,0xBE,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x3C,0x11,0x39,0x19,0x37,0x19,0xB3,0x08,0x6E,0x08,0x2C,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,
-	0x70,0x10,0xD3,0x10,0xD3,0x10,0xD7,0x18,0xD7,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5E,0x31,0xDF,0x31,0x3F,0x42,0x3C,0x4A,0x14,0x4A,0x46,0x21,0xC5,0x18,0xDF,0x7A,0x3F,0x8B,0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,
-	0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0x39,0x72,0xF5,0x69,0x74,0x41,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0x31,0x31,0x0E,0x41,0x51,0x41,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x6E,0x51,0x0B,0x39,0xCA,0x28,0x66,0x10,0x65,0x10,0x25,0x08,0x25,0x08,0x24,0x08,0x24,0x00,0x24,0x08,0x25,0x00,0x24,0x08,
-	0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x08,0x69,0x08,0x2A,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x70,0x10,0xB1,0x08,0xD3,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0x37,0x19,0xD7,0x18,0x37,0x19,0x37,0x19,0x39,0x19,0x39,0x19,0x19,0x21,0x3B,0x19,0xFB,0x18,0x3B,0x19,0x5C,0x29,0xFB,0x18,
-	0x5C,0x29,0x5C,0x29,0x5C,0x29,0x3E,0x19,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5C,0x29,0x5C,0x31,0x5C,0x31,0x7D,0x41,0xDE,0x49,
-	0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0xBF,0x5A,0x3F,0x5A,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x3C,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,
-	0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xBD,0xA3,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x3F,0x8B,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3C,0x4A,0xBD,0x39,0x78,0x31,0x37,0x19,0xD5,0x18,
-	0xB3,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0x6C,0x08,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x34,0x01,0x34,0x01,0x75,0x09,0x75,0x09,0xB6,0x11,0x75,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xB3,0x08,0x34,0x01,0xD7,0x08,0xD7,0x08,0x5A,0x09,0x5A,0x09,0x3C,0x11,0xBD,0x19,
-	0x7E,0x19,0x3C,0x11,0x3C,0x11,0x3B,0x19,0x39,0x19,0x34,0x19,0xB3,0x08,0x6E,0x08,0x6B,0x00,0x2A,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x08,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x70,0x10,0x72,0x10,0xD5,0x18,0xD5,0x18,0x39,0x19,0x19,0x21,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x5E,0x31,0xDF,0x31,0x3F,0x42,0x9B,0x5A,0xB1,0x49,0x4A,0x29,0xE3,0x18,
-	0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x5F,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xBD,0x8A,0xBC,0x7A,0x95,0x59,0x51,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x51,0x41,0xB1,0x49,
-	0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x6E,0x51,0x8E,0x31,0xCA,0x28,0x66,0x10,0x26,0x08,0x66,0x10,0x65,0x08,0x25,0x08,0x25,0x08,0x25,0x00,0x25,0x08,0x25,0x00,0x25,0x08,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x08,0x28,0x00,0x29,0x08,0x69,0x00,0x6A,0x00,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x10,
-	0xB3,0x08,0xB3,0x08,0xD5,0x18,0x37,0x09,0xD7,0x18,0xD7,0x18,0x39,0x19,0x39,0x19,0x39,0x19,0xFB,0x18,0x3B,0x19,0xFB,0x18,0x3B,0x19,0x5C,0x29,0x3C,0x11,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x7E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x3F,0x19,0x5E,0x29,0x3F,0x19,0x3F,0x19,0x3F,0x19,0x5E,0x29,
-	0x3F,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x31,0x3E,0x19,0x5C,0x29,0x5E,0x29,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0xFE,0x51,0x3E,0x62,
-	0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x3E,0x62,0xBC,0x7A,0xDF,0x7A,0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xB3,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBD,0xA3,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,
-	0xBF,0x9B,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3E,0x83,0x3F,0x7B,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3C,0x4A,0x7A,0x41,0x78,0x31,0xD5,0x18,0xD3,0x10,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0x31,0x09,0x34,0x01,
-	0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0x59,0x09,0x3B,0x19,0xBB,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3B,0x19,0x3B,0x19,0x37,0x19,0x34,0x19,0xB1,0x08,0x6E,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x2A,0x08,0x6B,0x00,0x6B,0x08,0x6C,0x08,0x6C,0x08,
-	0x70,0x10,0xD1,0x18,0x75,0x10,0xD7,0x18,0xD7,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x19,0x52,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xDF,0x8A,0x3F,0x8B,0x5F,0x9B,0x5F,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,
-	0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xBD,0x8A,0x39,0x72,0x95,0x59,0x51,0x41,0x31,0x31,0xED,0x28,0xED,0x28,0x0E,0x41,0xED,0x28,0x0E,0x41,0x51,0x41,0x51,0x41,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x6E,0x51,0x6E,0x51,0x0E,0x41,0xCA,0x28,0x68,0x18,0x66,0x10,0x66,0x10,0x26,0x08,0x66,0x08,0x25,0x08,0x25,0x08,0x26,0x00,0x26,0x08,
-	0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x08,0x29,0x00,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0x19,0x21,0xD9,0x08,0x3B,0x19,0xFB,0x18,0xFB,0x18,0x3C,0x11,0x3C,0x11,0x5C,0x29,0x3E,0x19,
-	0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x3F,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x3E,0x19,0x5E,0x31,0x3E,0x19,0x3E,0x19,0x5E,0x31,0x5E,0x31,0x5C,0x29,0x5C,0x31,0x5E,0x31,0xBD,0x39,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,
-	0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x8A,0x5F,0x9B,0x5F,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,
-	0x5F,0xC4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x83,0xBF,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0x7F,0x6A,0x3F,0x5A,0x3D,0x5A,0x3F,0x42,0x3C,0x4A,0x78,0x31,0x37,0x19,
-	0x34,0x19,0xB3,0x08,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0x31,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x75,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,0xB3,0x08,0x34,0x01,0xD5,0x08,0xD7,0x08,0x59,0x09,0x3B,0x19,0x3B,0x19,
-	0x3B,0x19,0x3B,0x19,0x3B,0x19,0x39,0x19,0x37,0x19,0xD3,0x10,0xB1,0x08,0x6C,0x08,0x6B,0x00,0x2A,0x00,0x6A,0x00,0x6B,0x08,0x2A,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x70,0x10,0x71,0x08,0xD5,0x18,0x75,0x10,0x19,0x21,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0xDF,0x31,0xDE,0x49,0x3F,0x42,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xE3,0x18,
-	0x3E,0x83,0x5F,0x9B,0x5F,0x9B,0xBD,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xBD,0x8A,0x39,0x72,0x95,0x59,0x51,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x31,0x31,0x0E,0x41,0x51,0x41,0xB1,0x49,
-	0xB1,0x49,0xB1,0x49,0x90,0x61,0xB1,0x49,0x6E,0x51,0x6E,0x51,0x0B,0x39,0x68,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x27,0x08,0x27,0x00,0x27,0x08,0x28,0x00,0x28,0x08,0x69,0x08,0x6A,0x00,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB1,0x08,
-	0x72,0x08,0xB3,0x08,0xD5,0x18,0xD5,0x08,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3B,0x19,0x3C,0x11,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3F,0x19,0x3F,0x19,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x5E,0x29,0x5C,0x29,
-	0x5E,0x29,0x5E,0x31,0x3E,0x19,0x5C,0x31,0x5E,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x7D,0x41,0x3F,0x42,0x3F,0x5A,0xBF,0x5A,0xBF,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3C,0x6A,0x5E,0x7A,0x5E,0x7A,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0xBF,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x83,0x3F,0x8B,
-	0x3F,0x8B,0x3F,0x8B,0xBF,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3C,0x4A,0xBD,0x39,0x78,0x31,0x37,0x19,0xD3,0x10,0xB1,0x08,0xCF,0x08,0xB1,0x08,0xAF,0x18,0x2E,0x09,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x31,0x09,0x31,0x09,0x34,0x01,
-	0x72,0x09,0x75,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,0xB1,0x08,0x31,0x09,0xB3,0x08,0xD5,0x08,0x37,0x09,0xD7,0x08,0x3B,0x19,0x3B,0x19,0x3B,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x34,0x19,0x31,0x09,0x6E,0x08,0x6C,0x08,0x6B,0x00,0x6A,0x00,0x6A,0x08,0x6A,0x08,0x6B,0x00,0x2C,0x08,0x6C,0x08,0x6E,0x08,
-	0x6F,0x10,0x72,0x10,0xD5,0x18,0xD7,0x18,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x19,0x52,0x14,0x4A,0xC7,0x21,0x83,0x20,0xDF,0x8A,0x5F,0x9B,0x5F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB4,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,
-	0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xBC,0x7A,0x39,0x72,0x14,0x4A,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x0E,0x41,0x51,0x41,0x6E,0x51,0x51,0x41,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x6E,0x51,0x6E,0x51,0x0B,0x39,0xCA,0x28,0x68,0x18,0x26,0x08,0x26,0x08,0x26,0x08,0x66,0x08,0x26,0x08,0x67,0x08,0x27,0x08,
-	0x67,0x08,0x68,0x08,0x68,0x08,0x28,0x08,0x29,0x08,0x29,0x00,0x2A,0x00,0x2A,0x08,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x70,0x10,0x72,0x08,0xD3,0x10,0xB3,0x08,0xD5,0x18,0x75,0x10,0xD7,0x08,0xD7,0x18,0xD7,0x18,0xD9,0x08,0x39,0x19,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x3C,0x11,0x5C,0x29,
-	0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x31,0x3E,0x19,0x5E,0x31,0x5C,0x29,0x5E,0x31,0x5C,0x31,0x5E,0x31,0x5C,0x31,0x5E,0x31,0x7D,0x41,0xDE,0x49,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0xBF,0x6A,0x7F,0x6A,
-	0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0xBC,0x7A,0xDF,0x8A,0x5F,0x9B,0x5F,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,
-	0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0xBF,0x83,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3E,0x83,0x3E,0x83,0x3E,0x83,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3C,0x4A,0xBD,0x39,0x7A,0x41,
-	0x37,0x19,0x34,0x19,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x31,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x2E,0x09,0x2E,0x09,0xCF,0x08,0x31,0x09,0xB1,0x08,0x31,0x09,0xB3,0x08,0xD5,0x08,0x37,0x09,0x37,0x09,0x39,0x19,
-	0x39,0x19,0x39,0x19,0x39,0x19,0x37,0x19,0x34,0x19,0xD1,0x18,0x6E,0x08,0x6B,0x00,0x6A,0x00,0x2A,0x08,0x6A,0x00,0x2A,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0xB1,0x08,0x72,0x10,0x75,0x10,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x5C,0x31,0xDF,0x31,0x3F,0x42,0x3F,0x42,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xBD,0x8A,0x5F,0x9B,0x5F,0xA3,0xBD,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xB4,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xBD,0x8A,0xBD,0x8A,0x39,0x72,0x74,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x51,0x41,
-	0xB1,0x49,0x6E,0x51,0xB1,0x49,0x90,0x61,0xB1,0x49,0x6E,0x51,0x0B,0x39,0xCA,0x28,0x68,0x18,0x66,0x10,0x66,0x10,0x26,0x08,0x26,0x08,0x67,0x08,0x67,0x08,0x68,0x08,0x68,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x00,0x2A,0x08,0x2A,0x00,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6F,0x10,0x71,0x08,0x70,0x10,0xB1,0x08,
-	0xB3,0x08,0x72,0x10,0xD5,0x08,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0x19,0x21,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x31,0x3E,0x19,0x3E,0x19,0x5E,0x31,0x5C,0x29,0x5E,0x31,
-	0x5E,0x31,0x5E,0x31,0x5E,0x31,0x7D,0x41,0xDE,0x49,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x1C,0x7A,
-	0x5E,0x7A,0xDF,0x8A,0xDF,0x92,0x5F,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0x9B,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3E,0x83,
-	0x3E,0x83,0x3E,0x83,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3C,0x4A,0xBD,0x39,0x78,0x31,0x34,0x19,0xD3,0x10,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x31,0x09,0x31,0x09,
-	0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0x2E,0x09,0xCF,0x08,0xB1,0x08,0xB1,0x08,0x31,0x09,0xB3,0x08,0xD5,0x08,0xD7,0x08,0x39,0x19,0x59,0x09,0x37,0x19,0x37,0x19,0xD5,0x18,0xD3,0x10,0x70,0x10,0x6C,0x08,0x6B,0x00,0x6A,0x00,0x69,0x00,0x29,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,
-	0x70,0x10,0x72,0x10,0xD5,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x48,0x39,0xC5,0x18,0x3E,0x83,0x5F,0x9B,0xBD,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0x5F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,
-	0x5F,0x9B,0xDF,0x92,0xBD,0x8A,0xBC,0x7A,0xD9,0x61,0xB1,0x49,0xED,0x28,0xED,0x28,0xED,0x28,0xCA,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x0E,0x41,0x51,0x41,0x6E,0x51,0x6E,0x51,0xB1,0x49,0x6E,0x51,0xB1,0x49,0x6E,0x51,0x6E,0x51,0x0E,0x41,0xCA,0x28,0x68,0x18,0x66,0x10,0x27,0x08,0x26,0x08,0x27,0x08,0x67,0x08,0x68,0x08,0x68,0x08,
-	0x69,0x08,0x6B,0x10,0xAB,0x10,0x6B,0x10,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6D,0x18,0x6E,0x08,0x6F,0x10,0x6E,0x08,0x70,0x10,0xB1,0x08,0x72,0x10,0x72,0x10,0xB3,0x08,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD9,0x08,0xD7,0x18,0xD9,0x08,0x19,0x21,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x3C,0x11,
-	0xFB,0x18,0x5C,0x29,0xFB,0x18,0x3E,0x19,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5E,0x31,0x5C,0x29,0x5E,0x31,0x3E,0x19,0x5E,0x31,0x5E,0x31,0x5C,0x31,0x5E,0x31,0x5E,0x31,0x7D,0x41,0xDE,0x49,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0xBF,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,
-	0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xBD,0x8A,0xDF,0x92,0x5F,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xCB,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,
-	0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0x9B,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3E,0x83,0x3F,0x8B,0x3E,0x83,0x3E,0x83,0x3E,0x83,0x3F,0x7B,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3C,0x4A,0xBD,0x39,
-	0x78,0x31,0x37,0x19,0xD3,0x10,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x2E,0x09,0x31,0x09,0x31,0x09,0x72,0x09,0x72,0x09,0x31,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCF,0x08,0xCF,0x08,0x2E,0x09,0xCF,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xD5,0x18,0x37,0x09,
-	0xD7,0x18,0x37,0x09,0xD5,0x18,0x34,0x19,0xD1,0x18,0x6E,0x08,0x6C,0x08,0x2A,0x00,0x29,0x08,0x69,0x08,0x29,0x00,0x2A,0x00,0x2A,0x08,0x6C,0x08,0x6C,0x08,0x6F,0x10,0x70,0x10,0xD3,0x10,0x75,0x10,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x29,0x5C,0x31,0x5C,0x31,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDF,0x8A,0xFD,0x9A,0x5F,0xA3,0xDF,0xAB,0x5F,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x8A,0xBD,0x8A,0x5B,0x82,0xF5,0x69,0x51,0x41,0x0E,0x41,0xED,0x28,0xED,0x28,0x0B,0x39,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,
-	0x51,0x41,0x6E,0x51,0xB1,0x49,0x6E,0x51,0x90,0x61,0x6E,0x51,0x0E,0x41,0x0B,0x39,0xCA,0x28,0x68,0x18,0x26,0x08,0x26,0x08,0x66,0x10,0x68,0x18,0x68,0x08,0x68,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAD,0x18,0xAD,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,0x6F,0x10,0x6F,0x10,0x6F,0x10,0x6F,0x10,0x70,0x10,0x70,0x10,0x72,0x10,0x72,0x10,
-	0xD3,0x10,0xD5,0x18,0x75,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,0xD9,0x08,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5E,0x31,0x5E,0x31,0x7D,0x41,0xDE,0x49,0xFE,0x51,
-	0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0xBD,0x8A,
-	0x3E,0xA3,0x5F,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x3E,0x83,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,
-	0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3C,0x4A,0xBD,0x39,0x78,0x31,0xB6,0x11,0x34,0x19,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0x6B,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xCF,0x08,0x6C,0x08,0x6B,0x08,0x2A,0x08,0x69,0x00,0x29,0x08,0x29,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0x6E,0x08,
-	0xD3,0x10,0xD3,0x10,0xD7,0x18,0xD7,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x31,0x7D,0x41,0x3F,0x42,0x3F,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xDF,0x8A,0x5F,0x9B,0x3E,0xA3,0xBD,0xA3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,
-	0xDF,0x92,0xDF,0x92,0xBD,0x8A,0x39,0x72,0x95,0x59,0x51,0x41,0xED,0x28,0xED,0x28,0xCA,0x28,0xED,0x28,0x0B,0x39,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x51,0x41,0x6E,0x51,0x6E,0x51,0xB1,0x49,0x6E,0x51,0x0E,0x41,0x0B,0x39,0x68,0x18,0x68,0x18,0x66,0x10,0x27,0x08,0x67,0x08,0x68,0x08,0x68,0x18,0x69,0x08,
-	0xAB,0x10,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,0xD7,0x18,0x19,0x21,0x19,0x21,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x5C,0x29,
-	0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x7D,0x41,0x5E,0x31,0x7D,0x41,0x7D,0x41,0xDE,0x49,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0xBF,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x7F,0x6A,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xFD,0x9A,0x5F,0xA3,0x5F,0xB3,0xDF,0xB3,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0xDF,0xAB,
-	0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3E,0x83,0x3E,0x83,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xBD,0x39,
-	0xBD,0x39,0x78,0x31,0x34,0x19,0xB1,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xCA,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,
-	0x34,0x01,0xD3,0x10,0xB3,0x08,0xD1,0x18,0x6F,0x10,0x6B,0x08,0x2A,0x00,0x29,0x08,0x29,0x08,0x69,0x08,0x69,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x70,0x10,0x72,0x10,0xD5,0x18,0x75,0x10,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x29,0x5C,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xBD,0x8A,0x5F,0x9B,0x5F,0x9B,0x5F,0xA3,0x5F,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0x5F,0x9B,0xBD,0x8A,0xBD,0x8A,0x39,0x72,0x95,0x59,0x51,0x41,0xED,0x28,0xCA,0x28,0xED,0x28,0xCA,0x28,0xED,0x28,0x0B,0x39,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,
-	0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0B,0x39,0xCA,0x28,0x68,0x18,0x27,0x08,0x66,0x10,0x27,0x08,0x68,0x08,0x69,0x08,0x6A,0x08,0x6B,0x10,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xD3,0x10,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x37,0x19,
-	0x35,0x31,0x37,0x19,0x37,0x19,0x37,0x19,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x5C,0x31,0x19,0x21,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x7D,0x41,0x5E,0x31,0x7D,0x41,0x7D,0x41,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,
-	0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0xBD,0x8A,0xDF,0x92,0x5F,0xB3,0xDF,0xB3,
-	0xDF,0xCB,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0x5F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0xDF,0xB3,0x5F,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,
-	0xBD,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xBD,0x39,0x3C,0x4A,0x78,0x31,0x78,0x31,0x34,0x19,0xD1,0x18,0xCF,0x08,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0x2E,0x09,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0xB1,0x08,0xD1,0x18,0xB1,0x08,0xD1,0x18,0xB1,0x08,0xCF,0x08,0x6C,0x08,0x6A,0x08,0x29,0x00,0x29,0x00,0x28,0x00,0x69,0x08,0x6A,0x08,0x2A,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0xB1,0x08,
-	0x70,0x10,0xD5,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0xBF,0x5A,0xBD,0x6A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xDF,0x8A,0xDF,0x92,0x3E,0xA3,0x5F,0xA3,0xDF,0xAB,0xDF,0xB3,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0x9B,
-	0xDF,0x92,0xBD,0x8A,0xBC,0x7A,0x39,0x72,0xB1,0x49,0x0E,0x41,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0B,0x39,0xCA,0x28,0xA8,0x18,0x66,0x10,0x27,0x08,0x27,0x08,0x68,0x08,0x68,0x18,0x6B,0x10,
-	0x6B,0x10,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x37,0x19,0x35,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0xDE,0x49,0xDE,0x49,
-	0xDE,0x49,0xDE,0x49,0x3F,0x42,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x7A,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x5E,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0x3E,0xA3,0x5F,0xB3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0x5F,0xB3,0xDF,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,
-	0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBD,0x6A,0x7F,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xBD,0x39,
-	0xBD,0x39,0x78,0x31,0x34,0x19,0x31,0x09,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0x6A,0x00,0xA8,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0x2E,0x09,0x2A,0x01,0x2E,0x09,0x2A,0x01,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0x6E,0x08,0xB1,0x08,
-	0xD1,0x18,0xB1,0x08,0xCF,0x08,0x6F,0x10,0x6B,0x08,0x29,0x08,0x28,0x00,0x28,0x08,0x28,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6D,0x18,0x6E,0x08,0x70,0x10,0x72,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x31,0x7D,0x41,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDF,0x8A,0xFD,0x9A,0x5F,0x9B,0x5F,0xA3,0x5F,0xA3,0x5F,0xB3,0xDF,0xB3,0xDF,0xB3,0x5F,0xCB,0xDF,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xBD,0x8A,0x5B,0x82,0xF5,0x69,0x51,0x41,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0x0B,0x39,0xED,0x28,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x0E,0x41,
-	0x0E,0x41,0x6E,0x51,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0B,0x39,0x0B,0x39,0xA8,0x18,0x68,0x18,0x27,0x08,0x27,0x08,0x68,0x18,0x69,0x08,0x6B,0x10,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x31,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x78,0x31,
-	0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7D,0x41,0xBD,0x39,0xDD,0x49,0xDD,0x49,0xDE,0x49,0xDD,0x49,0xDD,0x49,0xFE,0x51,0x3F,0x42,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x7A,
-	0x7F,0x6A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDE,0xAA,0x3E,0xA3,0xDF,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,
-	0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0x5F,0xB3,0xDF,0xB3,0x3E,0xBB,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0xDF,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,
-	0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xBD,0x39,0xBD,0x39,0x78,0x31,0xB6,0x11,0xD3,0x10,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xCA,0x00,0x69,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,
-	0x2A,0x01,0xAB,0x00,0x2A,0x01,0x2A,0x01,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x6A,0x00,0xAB,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6F,0x10,0x6F,0x10,0x6E,0x08,0x6D,0x18,0x6C,0x08,0x6A,0x08,0x28,0x00,0x28,0x08,0x28,0x00,0x68,0x08,0x69,0x08,0x6A,0x08,0x6B,0x08,0x2C,0x08,0x6C,0x08,0x6F,0x10,0x70,0x10,
-	0xD3,0x10,0xD5,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x31,0x5C,0x31,0x7D,0x41,0xFE,0x51,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0xBD,0x6A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x5F,0xA3,0x5F,0xA3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDF,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,
-	0xFD,0x9A,0x5B,0x82,0x39,0x72,0xF5,0x69,0x51,0x41,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0xED,0x28,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x8E,0x31,0x4A,0x29,0xCA,0x28,0x66,0x10,0x68,0x18,0x68,0x08,0x68,0x18,0x69,0x08,0x6B,0x10,
-	0x6B,0x10,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0xBD,0x39,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,
-	0x3F,0x5A,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x7F,0x6A,0x3F,0x5A,0x7F,0x6A,0x3E,0x62,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xFD,0x9A,0xDE,0xAA,0x5F,0xB3,0xDF,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x92,
-	0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xDF,0x31,0xBD,0x39,0xBD,0x39,
-	0x3C,0x4A,0x78,0x31,0xB6,0x11,0x34,0x19,0xAF,0x18,0xCD,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0x69,0x00,0xA8,0x00,0x69,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCA,0x00,0x2A,0x01,0xAB,0x00,0x2A,0x01,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x6A,0x00,0xCA,0x00,0xCA,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x08,0xCD,0x00,
-	0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x69,0x08,0x27,0x00,0x67,0x08,0x28,0x08,0x69,0x08,0x69,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0x6F,0x10,0x70,0x10,0x72,0x10,0xD5,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x29,0x5C,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0xBD,0x6A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDF,0x8A,0xDF,0x92,0xDF,0x92,0x3E,0xA3,0x3E,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDE,0xAA,0xDF,0x92,0xFD,0x9A,0x5B,0x82,0x39,0x72,0x95,0x59,0x0E,0x41,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x0E,0x41,
-	0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0B,0x39,0xCA,0x28,0x68,0x18,0x27,0x08,0x68,0x18,0x68,0x18,0x69,0x08,0x6B,0x10,0xAB,0x10,0x6D,0x18,0xED,0x28,0xAF,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x34,0x19,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x78,0x31,
-	0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7D,0x41,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDE,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x5A,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0xBD,0x8A,0xDF,0x92,0x5F,0xB3,0x5F,0xB3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,
-	0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0xDF,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0x5E,0x7A,0xDF,0x7A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,
-	0x3F,0x5A,0xFE,0x51,0x3F,0x42,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xBD,0x39,0x3E,0x22,0x78,0x31,0x35,0x31,0x34,0x19,0xB1,0x08,0xCD,0x00,0xAB,0x00,0xCA,0x00,0x69,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,
-	0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x69,0x00,0x69,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x00,0x6B,0x08,0x6C,0x08,0xAD,0x18,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x29,0x08,0x28,0x00,0x27,0x08,0x68,0x08,0x69,0x08,0x69,0x08,0x2A,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x70,0x10,0x70,0x10,
-	0xD3,0x10,0x75,0x10,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x29,0x5C,0x31,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0x5E,0x82,0xDF,0x8A,0xFD,0x9A,0xDF,0x92,0x5F,0xA3,0x3E,0xA3,0x3E,0xA3,0x5F,0xA3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDE,0xAA,0xDF,0x92,0xDF,0x92,
-	0xBD,0x8A,0x39,0x72,0xF5,0x69,0xB1,0x49,0x0E,0x41,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x8E,0x31,0x0B,0x39,0xCA,0x28,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x6B,0x10,0x6B,0x10,
-	0x6B,0x10,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7D,0x41,0x7D,0x41,0xDD,0x49,0xDE,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,
-	0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x3E,0x62,0xDD,0x69,
-	0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDE,0xAA,0x5F,0xB3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0x5F,0xB3,0xDF,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,
-	0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x3E,0x62,0x3E,0x62,0x3F,0x5A,0x3D,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x42,0xDE,0x49,0x3F,0x42,0xDE,0x49,0xDE,0x49,0x3F,0x42,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBD,0x39,
-	0xBD,0x39,0x78,0x31,0xB6,0x11,0x34,0x19,0xAF,0x18,0xCD,0x00,0xAB,0x00,0x6A,0x00,0x69,0x00,0x68,0x00,0xA8,0x00,0x6A,0x00,0xCA,0x00,0x6B,0x00,0xCA,0x00,0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x08,0xCA,0x00,0x69,0x08,0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x08,0x6B,0x08,
-	0x6B,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x28,0x08,0x27,0x08,0x28,0x08,0x68,0x08,0x69,0x08,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0x6F,0x10,0x72,0x10,0xD3,0x10,0x75,0x10,0x19,0x21,0x19,0x21,0xFB,0x18,0x5C,0x31,0x5C,0x31,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0xBF,0x5A,0xBD,0x6A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDF,0x8A,0xBD,0x8A,0xDF,0x92,0xDF,0x92,0x3E,0xA3,0xDF,0x92,0xDE,0xAA,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDE,0xAA,0xDF,0x92,0xFD,0x9A,0xBD,0x8A,0xBD,0x8A,0x39,0x72,0xF5,0x69,0xB1,0x49,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0xCA,0x28,0x0B,0x39,0x0E,0x41,0x0B,0x39,
-	0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0B,0x39,0xCA,0x28,0x6B,0x10,0x68,0x18,0x68,0x18,0x6A,0x08,0x6B,0x10,0x6B,0x10,0x6B,0x08,0x6D,0x18,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x77,0x41,0x78,0x31,
-	0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7D,0x41,0x7D,0x41,0xDD,0x49,0xDD,0x49,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xFE,0x51,0xDE,0x49,0xFE,0x51,0xDC,0x59,0xFE,0x51,0x3D,0x5A,0xFE,0x51,0x3D,0x5A,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xFD,0x9A,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,
-	0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x7F,0x6A,0x3E,0x62,0x3C,0x6A,0x3E,0x62,0x3D,0x5A,0xDC,0x59,0xDC,0x59,0xFE,0x51,0xDC,0x59,0xFE,0x51,0x3C,0x4A,0xDE,0x49,0x3C,0x4A,0xDD,0x49,
-	0xDD,0x49,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xBD,0x39,0xBD,0x29,0xBD,0x39,0x78,0x31,0xB6,0x11,0x34,0x19,0x31,0x09,0xCD,0x00,0xAB,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,
-	0xAB,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xA8,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x2A,0x00,0x2A,0x00,0x6A,0x00,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x69,0x00,0x28,0x08,0x28,0x08,0x28,0x08,0x69,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,0x2C,0x08,0x6C,0x08,0x6F,0x10,0xB1,0x08,0x70,0x10,
-	0xD5,0x18,0x75,0x10,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0x46,0x21,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDE,0xAA,0xDF,0x92,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0xFD,0x9A,0x5C,0x92,
-	0x5B,0x82,0xF5,0x69,0x95,0x59,0x6E,0x51,0xED,0x28,0xCA,0x28,0xCA,0x28,0xA8,0x18,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0xED,0x28,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x8E,0x31,0x0E,0x41,0xCA,0x28,0xCA,0x28,0x68,0x18,0x68,0x18,0x68,0x18,0x6B,0x10,0x6B,0x10,
-	0x6B,0x10,0x6D,0x18,0x6D,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x77,0x41,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7D,0x41,0x7D,0x41,0xDD,0x49,0x7D,0x41,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDC,0x59,0xDD,0x49,0xDC,0x59,
-	0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3D,0x5A,0xFE,0x51,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x5E,0x7A,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,
-	0x5E,0x82,0xBD,0x8A,0xDF,0x92,0xDE,0xAA,0x5F,0xB3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,0x5F,0xB3,0xDF,0xAB,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,
-	0x5E,0x7A,0x3E,0x62,0x3C,0x6A,0x3E,0x62,0x3D,0x5A,0x3D,0x5A,0x3D,0x5A,0xDC,0x59,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xBD,0x39,0xDD,0x49,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xDF,0x31,0xBD,0x39,0xBD,0x29,
-	0xBD,0x29,0x78,0x31,0x78,0x31,0x34,0x19,0xD1,0x18,0xCD,0x00,0xAB,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x6A,0x00,0xAB,0x00,0xAB,0x00,0xCD,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x2A,0x00,0x2A,0x00,0x6B,0x00,0x6B,0x08,
-	0x6B,0x08,0x6A,0x08,0x69,0x00,0x29,0x00,0x28,0x08,0x27,0x00,0x28,0x08,0x28,0x08,0x69,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6F,0x10,0x70,0x10,0x72,0x10,0xD5,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,0x5C,0x31,0x5C,0x31,0x7D,0x41,0x3F,0x42,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xBD,0x8A,0x5B,0x82,0x39,0x72,0xF5,0x69,0xB1,0x49,0x0E,0x41,0xCA,0x28,0xCA,0x28,0xA8,0x18,0xCA,0x28,0xA8,0x18,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0x0B,0x39,0x0B,0x39,
-	0x4B,0x49,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0xED,0x28,0xCA,0x28,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0xAD,0x18,0x6D,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,0x78,0x31,
-	0x77,0x41,0x7A,0x41,0x7A,0x41,0x9A,0x49,0x7A,0x41,0x9A,0x49,0x7D,0x41,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDC,0x59,0xFE,0x51,0xDC,0x59,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3D,0x5A,0xFE,0x51,0x3D,0x5A,0xFE,0x51,0xFE,0x51,0x3E,0x62,0xFE,0x51,0xFE,0x51,0x3E,0x62,0xFE,0x51,0xDC,0x59,0xFE,0x51,
-	0x3E,0x62,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x3E,0x62,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xBC,0x9A,0xDE,0xAA,0x3E,0xA3,0x5F,0xB3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,
-	0xDF,0xCB,0xDF,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0x9A,0x49,0xDD,0x49,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,
-	0xBD,0x39,0x7A,0x41,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x29,0xBD,0x39,0xBD,0x29,0x78,0x31,0x78,0x31,0xB6,0x11,0x34,0x19,0xD1,0x18,0xCD,0x00,0xAB,0x00,0x6B,0x00,0xCA,0x00,0x6A,0x00,0x6B,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0x2E,0x09,
-	0xCF,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0x6B,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0xCD,0x00,0x6B,0x08,0x6B,0x08,0x69,0x00,0x28,0x00,0x28,0x00,0x27,0x08,0x68,0x08,0x28,0x08,0x29,0x08,0x29,0x08,0x6B,0x08,0x2C,0x08,0x6E,0x08,0x70,0x10,0x70,0x10,0xD3,0x10,
-	0x75,0x10,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x29,0x5C,0x31,0xDF,0x31,0xFE,0x51,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5E,0x82,0xBD,0x8A,0x5B,0x82,0x5B,0x82,
-	0xF5,0x69,0x95,0x59,0x0E,0x41,0xED,0x28,0xCA,0x28,0x68,0x18,0x68,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xCA,0x28,0xCA,0x28,0x4A,0x29,0xCA,0x28,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x8E,0x31,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0B,0x39,0xED,0x28,0xCA,0x28,0x68,0x18,0x6B,0x10,0x6B,0x10,0xAD,0x18,
-	0x6D,0x18,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x13,0x29,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,0x78,0x31,0x77,0x41,0x7A,0x41,0x7A,0x41,0x9A,0x49,0xDD,0x49,0x9A,0x49,0x7D,0x41,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xFE,0x51,0xDD,0x49,
-	0xDC,0x59,0xFE,0x51,0x3D,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3E,0x62,0xFE,0x51,0xFE,0x51,0x3E,0x62,0xFE,0x51,0xFE,0x51,0xDD,0x69,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xBC,0x9A,0xFD,0x9A,
-	0x3E,0xA3,0x5F,0xB3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,
-	0x3C,0x6A,0xDC,0x59,0xDC,0x59,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x78,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x5C,0x31,0xBD,0x39,0x5C,0x31,0xBD,0x29,0x5C,0x31,0xBD,0x29,0x5C,0x31,0xBD,0x29,0x7A,0x41,0x5C,0x29,
-	0x78,0x31,0xB9,0x11,0x35,0x31,0x34,0x19,0xD1,0x18,0xCD,0x00,0xAB,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xD1,0x18,0x31,0x09,0x31,0x09,0x31,0x09,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xCD,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0xCF,0x08,0xCF,0x08,
-	0x6C,0x08,0x6B,0x08,0x6A,0x00,0x28,0x00,0x28,0x00,0x28,0x08,0x28,0x08,0x29,0x08,0x29,0x00,0x2A,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0x70,0x10,0x70,0x10,0xD5,0x18,0x75,0x10,0x19,0x21,0x19,0x21,0xFB,0x18,0x5C,0x31,0x5C,0x31,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5E,0x82,0x5C,0x92,0x5E,0x82,0x5C,0x92,0x5B,0x82,0x39,0x72,0xF5,0x69,0xF5,0x69,0x6E,0x51,0x0E,0x41,0xCA,0x28,0x68,0x18,0x68,0x18,0xA7,0x18,0x66,0x10,0xC6,0x28,0xA8,0x18,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0x0B,0x39,0x0B,0x39,
-	0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,0xED,0x28,0xCA,0x28,0x6D,0x18,0xCA,0x28,0x6D,0x18,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xED,0x28,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,
-	0x78,0x31,0x77,0x41,0x78,0x31,0x77,0x41,0x9A,0x49,0x7A,0x41,0x9A,0x49,0x9A,0x49,0xDD,0x49,0x9A,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDC,0x59,0xDD,0x49,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xFE,0x51,0xDC,0x59,0xDC,0x59,0xFE,0x51,0xDD,0x69,0xFE,0x51,0xFE,0x51,0x3E,0x62,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xFE,0x51,
-	0x3E,0x62,0xDD,0x69,0x3E,0x62,0xDD,0x69,0x3E,0x62,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0x5C,0x92,0xFD,0x9A,0xDE,0xAA,0x5F,0xB3,0xDF,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xDF,0xEB,0x3F,0xE4,0xBF,0xDB,0x3F,0xE4,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0x5F,0xCB,0xDF,0xB3,
-	0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0xBC,0x7A,0x3C,0x6A,0x3C,0x6A,0xDC,0x59,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x77,0x41,0x78,0x31,0x77,0x41,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,
-	0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x19,0x21,0x78,0x31,0x78,0x31,0x5C,0x29,0x78,0x31,0x7A,0x41,0x78,0x31,0x5C,0x31,0x78,0x31,0x5C,0x29,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0xB6,0x11,0x34,0x19,0xD1,0x18,0xCF,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xB1,0x08,0x72,0x09,0x72,0x09,0xD3,0x10,
-	0x72,0x09,0xD1,0x18,0x31,0x09,0xCF,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB1,0x08,0xB3,0x08,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xAF,0x18,0x6C,0x08,0x6B,0x00,0x2A,0x00,0x28,0x08,0x28,0x08,0x68,0x08,0x69,0x08,0x2A,0x08,0x6B,0x08,0x2C,0x08,0x6D,0x18,0x6F,0x10,0x70,0x10,0xD3,0x10,0xD5,0x18,
-	0xD7,0x18,0x19,0x21,0x19,0x21,0x5C,0x31,0x5C,0x31,0x7D,0x41,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0x46,0x21,0xDF,0x8A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5E,0x82,0xDF,0x92,0x5E,0x82,0xBD,0x8A,0x5B,0x82,0x39,0x72,0xF5,0x69,0xF5,0x69,
-	0xB1,0x49,0x0E,0x41,0xCA,0x28,0x68,0x18,0xC6,0x28,0x66,0x10,0x66,0x10,0xA7,0x18,0x68,0x18,0xC6,0x28,0xA8,0x18,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x4A,0x29,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,0xED,0x28,0xCA,0x28,0x6D,0x18,0x6D,0x18,0x6D,0x18,
-	0x6D,0x18,0xED,0x28,0xD1,0x18,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,0x35,0x31,0x77,0x41,0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDD,0x49,0x9A,0x49,0xDC,0x59,0x9A,0x49,0xDD,0x49,0xDC,0x59,0xDD,0x49,
-	0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xFE,0x51,0xDD,0x69,0xFE,0x51,0xDD,0x69,0xFE,0x51,0x3E,0x62,0xDD,0x69,0x3E,0x62,0xDD,0x69,0x3E,0x62,0x3E,0x62,0xDD,0x69,0x3E,0x62,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0xFD,0x9A,0xDE,0xAA,0x5F,0xB3,0xDF,0xCB,0xFF,0xD3,
-	0xFF,0xD3,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xBF,0xDB,0x3F,0xE4,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x3E,0xA3,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x7A,0xDF,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xDC,0x59,
-	0x19,0x52,0x9A,0x49,0x19,0x52,0x9A,0x49,0x77,0x41,0x77,0x41,0x77,0x41,0x78,0x31,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x35,0x31,0x78,0x31,0x37,0x19,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x19,0x21,0x78,0x31,0x5C,0x29,0x78,0x31,0x78,0x31,0x78,0x31,0x3B,0x19,0x78,0x31,
-	0x3B,0x19,0x78,0x31,0x35,0x31,0x34,0x19,0x31,0x09,0xCF,0x08,0xCD,0x00,0xCD,0x00,0x6C,0x08,0xCD,0x00,0xCF,0x08,0xB1,0x08,0xD3,0x10,0xD3,0x10,0x34,0x19,0x75,0x09,0x34,0x19,0x72,0x09,0xB1,0x08,0xB1,0x08,0x71,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB3,0x08,0xD5,0x18,0xD5,0x18,0xD7,0x18,0x37,0x19,0x37,0x19,0x34,0x19,
-	0xD3,0x10,0xAF,0x18,0x6C,0x08,0x6B,0x08,0x2A,0x00,0x29,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x6F,0x10,0x70,0x10,0x72,0x10,0xD5,0x18,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x31,0x5C,0x31,0x7D,0x41,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xE3,0x18,
-	0x5E,0x82,0x5E,0x82,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0x5E,0x82,0x5E,0x82,0xDF,0x92,0x5E,0x82,0x5E,0x82,0x5B,0x82,0x5B,0x82,0x39,0x72,0xD9,0x61,0xF5,0x69,0xB1,0x49,0x6E,0x51,0xCA,0x28,0x68,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x18,0xA8,0x18,0xC6,0x28,0xC6,0x28,0x4A,0x29,0xCA,0x28,0xCA,0x28,0x0B,0x39,
-	0x0B,0x39,0x0B,0x39,0x8E,0x31,0x0E,0x41,0x0E,0x41,0x6E,0x51,0xB1,0x49,0x6E,0x51,0xB1,0x49,0x6E,0x51,0x0E,0x41,0xED,0x28,0xED,0x28,0x6D,0x18,0xED,0x28,0x6D,0x18,0xED,0x28,0x6F,0x10,0xF1,0x20,0x31,0x31,0x13,0x29,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,
-	0x35,0x31,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x7A,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDC,0x59,0x9A,0x49,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x69,0xFE,0x51,0xDD,0x69,0xFE,0x51,0xDD,0x69,0xFE,0x51,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0xDD,0x69,0xDD,0x69,0x5E,0x7A,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5C,0xA2,0xDE,0xAA,0x5F,0xB3,0xDF,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xCB,0x5F,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,
-	0x5F,0xA3,0x3E,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xDC,0x59,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x77,0x41,0x77,0x41,0x78,0x31,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,
-	0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x78,0x31,0x37,0x19,0x78,0x31,0x78,0x31,0x19,0x21,0x78,0x31,0x78,0x31,0x19,0x21,0x19,0x21,0x78,0x31,0x78,0x31,0x78,0x31,0xB6,0x11,0x35,0x31,0x34,0x19,0xD1,0x18,0xCF,0x08,0xCD,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,0xB1,0x08,0xB3,0x08,0x34,0x01,0x75,0x09,0x37,0x19,0x37,0x19,
-	0x37,0x09,0xD5,0x18,0xB3,0x08,0xB3,0x08,0xB1,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0xD5,0x08,0xD7,0x18,0x39,0x19,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x37,0x19,0xD5,0x18,0xD1,0x18,0x6F,0x10,0x6C,0x08,0x6B,0x08,0x2A,0x08,0x2A,0x08,0x2A,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0x6F,0x10,0x70,0x10,0x72,0x10,0xD3,0x10,0x75,0x10,
-	0xD7,0x18,0x19,0x21,0x5C,0x31,0x5C,0x31,0x7D,0x41,0xBD,0x39,0xFE,0x51,0xBF,0x5A,0x7F,0x6A,0xBF,0x5A,0xBF,0x5A,0x3D,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0x5E,0x82,0x5B,0x82,0x5B,0x82,0x39,0x72,0x39,0x72,0xF5,0x69,0xB1,0x49,0x51,0x41,
-	0xED,0x28,0x68,0x18,0x66,0x10,0x66,0x10,0x26,0x08,0x65,0x10,0x65,0x10,0x65,0x10,0xA7,0x18,0xA7,0x18,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x4A,0x29,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x51,0x41,0x0E,0x41,0xED,0x28,0x6D,0x18,0xED,0x28,0x6D,0x18,
-	0xED,0x28,0xF1,0x20,0x31,0x31,0x31,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x74,0x41,0x35,0x31,0x35,0x31,0x77,0x41,0x35,0x31,0x77,0x41,0x77,0x41,0x78,0x31,0x77,0x41,0x7A,0x41,0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDC,0x59,0x9A,0x49,0xDC,0x59,0xDC,0x59,0xDC,0x59,
-	0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x69,0xFE,0x51,0xDD,0x69,0xFE,0x51,0xDD,0x69,0x3E,0x62,0xDD,0x69,0x3E,0x62,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5C,0xA2,0xDE,0xAA,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x3F,0xE4,0xDF,0xEB,
-	0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x3F,0xE4,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xBD,0x8A,0xDF,0x8A,0xBD,0x8A,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0xDD,0x69,0xDC,0x59,0xD9,0x61,0x9A,0x49,0x9A,0x49,
-	0x9A,0x49,0x9A,0x49,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x35,0x31,0x13,0x29,0x13,0x29,0x34,0x19,0x13,0x29,0x34,0x19,0x13,0x29,0x34,0x19,0x13,0x29,0x34,0x19,0x37,0x19,0x35,0x31,0x37,0x19,0x78,0x31,0x37,0x19,0x78,0x31,0x39,0x19,0x78,0x31,0x39,0x19,0x78,0x31,0x39,0x19,
-	0x37,0x19,0x35,0x31,0x37,0x19,0x34,0x19,0xD1,0x18,0xCF,0x08,0xCD,0x00,0x6E,0x08,0x6E,0x08,0x6E,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x18,0xD7,0x18,0x37,0x19,0x37,0x09,0xD7,0x18,0x37,0x09,0xD5,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0x72,0x08,0xD5,0x08,0xD7,0x18,0x39,0x19,0x19,0x21,0x3B,0x19,0x5C,0x29,0x3B,0x19,0x19,0x21,0x19,0x21,
-	0x37,0x19,0xD3,0x10,0xB1,0x08,0x6C,0x08,0x6C,0x08,0x2A,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6D,0x18,0x6F,0x10,0x70,0x10,0x70,0x10,0xD3,0x10,0x75,0x10,0xD7,0x18,0x19,0x21,0xFB,0x18,0x5C,0x31,0x5C,0x31,0xBD,0x39,0xDE,0x49,0xFE,0x51,0xBF,0x5A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x5E,0x82,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5B,0x82,0x39,0x72,0x39,0x72,0x39,0x72,0xF5,0x69,0xB1,0x49,0x51,0x41,0x0B,0x39,0xCA,0x28,0x68,0x18,0x65,0x10,0x65,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x65,0x08,0x65,0x10,0x66,0x10,0xA7,0x18,0xC6,0x28,0xC6,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,
-	0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0xB1,0x49,0xB1,0x49,0x6E,0x51,0x6E,0x51,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xF1,0x20,0x31,0x31,0x31,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x77,0x41,0x35,0x31,0x77,0x41,
-	0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDC,0x59,0x9A,0x49,0xDC,0x59,0x9A,0x49,0xDC,0x59,0x9A,0x49,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x69,0xDD,0x69,0xDC,0x59,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,
-	0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5C,0x92,0x5C,0xA2,0x5C,0xA2,0xDE,0xAA,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xFF,0xD3,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x3F,0xE4,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,
-	0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xDD,0x69,0xDC,0x59,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,
-	0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x34,0x19,0x35,0x31,0x34,0x19,0x35,0x31,0x37,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0x78,0x31,0x37,0x19,0xB6,0x11,0x34,0x19,0xD1,0x18,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB1,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0x39,0x19,0x39,0x19,0x39,0x19,
-	0x59,0x09,0xD7,0x18,0xD5,0x08,0xD5,0x08,0x75,0x00,0x75,0x00,0xD5,0x08,0xD9,0x08,0x3B,0x19,0xFB,0x18,0x5C,0x29,0x3E,0x19,0x3E,0x19,0x5C,0x29,0x3B,0x19,0x39,0x19,0xD7,0x18,0xD3,0x10,0xB1,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x2C,0x08,0x6C,0x08,0x6D,0x18,0x6F,0x10,0x70,0x10,0x70,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,
-	0x19,0x21,0xFB,0x18,0x5C,0x31,0x5E,0x31,0x7D,0x41,0xDD,0x49,0x3F,0x42,0xBF,0x5A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x48,0x39,0xE3,0x18,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xBC,0x7A,0x1C,0x7A,0x39,0x72,0x39,0x72,0xF5,0x69,0xF5,0x69,0xB1,0x49,0x51,0x41,0x0B,0x39,0x6B,0x10,
-	0x68,0x18,0x66,0x10,0x25,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x65,0x10,0x65,0x10,0xA7,0x18,0xA7,0x18,0xC6,0x28,0xCA,0x28,0xCA,0x28,0x4A,0x29,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x51,0x41,0x0E,0x41,0x31,0x31,0x31,0x31,
-	0x31,0x31,0x31,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x74,0x41,0x35,0x31,0x74,0x41,0x35,0x31,0x74,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xDC,0x59,0x9A,0x49,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,
-	0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5C,0xA2,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0x5F,0xCB,0x5F,0xCB,0x7E,0xDB,0xFF,0xD3,0xDF,0xEB,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,
-	0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xBF,0xDB,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5E,0x82,0x5E,0x82,0xBC,0x7A,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0xDD,0x69,0xDC,0x59,0xD9,0x61,0xDC,0x59,0x9A,0x49,0x19,0x52,0x9A,0x49,
-	0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x34,0x19,0x34,0x19,0x35,0x31,0x34,0x19,0x35,0x31,0x37,0x19,0x35,0x31,0x37,0x19,0x35,0x31,0x37,0x19,
-	0x37,0x19,0x35,0x31,0x34,0x19,0x34,0x19,0xB1,0x08,0xB1,0x08,0xCF,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x18,0xD9,0x08,0x59,0x09,0xD9,0x08,0xD9,0x08,0x59,0x09,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0x39,0x19,0x5C,0x29,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x3C,0x11,0x3B,0x19,0x39,0x19,
-	0xD7,0x18,0xD5,0x18,0xB1,0x08,0xB1,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x70,0x10,0xD1,0x18,0x72,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,0x5C,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0xC7,0x21,0xC5,0x18,
-	0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x5B,0x82,0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,0x95,0x59,0xB1,0x49,0x0E,0x41,0xED,0x28,0xCA,0x28,0x66,0x10,0x66,0x10,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x08,0x24,0x08,0x65,0x10,0x65,0x10,0x66,0x10,0xA7,0x18,0xC6,0x28,
-	0xCA,0x28,0xCA,0x28,0x0B,0x39,0x0B,0x39,0x4B,0x49,0x8E,0x31,0x6E,0x51,0x90,0x61,0xB1,0x49,0x90,0x61,0x90,0x61,0xB1,0x49,0xB1,0x49,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x13,0x29,0x74,0x41,0x35,0x31,0x74,0x41,0x74,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,
-	0x77,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xD9,0x61,0x9A,0x49,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5C,0xA2,0x5C,0xA2,
-	0x5C,0xA2,0xDE,0xAA,0x5F,0xB3,0x5F,0xCB,0xDF,0xCB,0xBF,0xDB,0xFF,0xD3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0xFF,0xD3,0xBF,0xDB,0xDF,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,
-	0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xDC,0x59,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0xF1,0x20,0x13,0x29,0xF1,0x20,0xF1,0x20,
-	0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x34,0x19,0xD5,0x18,0x34,0x19,0x34,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0xB3,0x08,0xB1,0x08,0xCF,0x08,0x71,0x08,0x72,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x39,0x19,0x3B,0x19,0x3B,0x19,
-	0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD9,0x08,0xD9,0x08,0x3B,0x19,0x3C,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5C,0x29,0x3B,0x19,0x39,0x19,0xD7,0x18,0xD5,0x08,0xD3,0x10,0xB1,0x08,0x6F,0x10,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x70,0x10,0x72,0x10,0xD3,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,
-	0x5C,0x29,0x5C,0x31,0x5E,0x31,0xDE,0x49,0xBD,0x39,0xDE,0x49,0x3F,0x5A,0xBF,0x6A,0xBF,0x5A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x39,0x72,0xD9,0x61,0xD9,0x61,0xF5,0x69,0x95,0x59,0x95,0x59,0xB1,0x49,0x0E,0x41,0xED,0x28,0x68,0x18,0x68,0x18,0x26,0x08,
-	0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x24,0x08,0x65,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xCA,0x28,0xCA,0x28,0x0B,0x39,0x0B,0x39,0x4B,0x49,0x6E,0x51,0x6E,0x51,0x90,0x61,0x90,0x61,0xB1,0x49,0x95,0x59,0xB2,0x71,0x95,0x59,0x95,0x59,0x95,0x59,
-	0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x95,0x59,0x74,0x41,0x95,0x59,0x77,0x41,0x77,0x41,0x77,0x41,0x95,0x59,0x77,0x41,0xD9,0x61,0x77,0x41,0xD9,0x61,0x9A,0x49,0xD9,0x61,0x9A,0x49,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xDC,0x59,0xDC,0x59,0xDD,0x69,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,
-	0x1C,0x7A,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0xDE,0xAA,0x3E,0xBB,0x5F,0xCB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,
-	0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0x5F,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0xDD,0x69,0xD9,0x61,0x9A,0x49,0xD9,0x61,0x19,0x52,0x9A,0x49,0x19,0x52,0x9A,0x49,
-	0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x77,0x41,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0xF1,0x20,0x13,0x29,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xF1,0x20,0xD3,0x10,0xF1,0x20,0xD3,0x10,0x34,0x19,0x13,0x29,0xD5,0x18,0x34,0x19,0x34,0x19,0x34,0x19,0x37,0x19,
-	0x34,0x19,0x35,0x31,0x34,0x19,0x34,0x19,0xD3,0x10,0xCF,0x08,0x71,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0x5A,0x09,0x3B,0x19,0x5A,0x09,0xD9,0x08,0xD9,0x08,0xD9,0x08,0x5A,0x09,0x3B,0x19,0x3C,0x11,0x3C,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x3C,0x11,0x3B,0x19,0xD9,0x08,
-	0x37,0x09,0xD5,0x08,0xD3,0x10,0xB3,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x70,0x10,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,0xFB,0x18,0x5C,0x31,0x5E,0x31,0xDE,0x49,0x5E,0x31,0xDD,0x49,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0xBF,0x5A,0x9B,0x5A,0xB1,0x49,0x4A,0x29,0xE3,0x18,
-	0x95,0x59,0xF5,0x69,0x95,0x59,0xF5,0x69,0x95,0x59,0x95,0x59,0x95,0x59,0x14,0x4A,0xB1,0x49,0x51,0x41,0xED,0x28,0xED,0x28,0x68,0x18,0x68,0x18,0x66,0x10,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x08,0x24,0x08,0x24,0x08,0x65,0x10,
-	0x66,0x10,0x66,0x10,0xC6,0x28,0xCA,0x28,0xCA,0x28,0x0B,0x39,0x0E,0x41,0x6E,0x51,0x6E,0x51,0xB1,0x49,0xB2,0x71,0xB4,0x6A,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x95,0x59,0x95,0x59,0x95,0x59,0xD9,0x61,0x95,0x59,0x95,0x59,0xD9,0x61,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,
-	0xD9,0x61,0xD9,0x61,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5C,0x92,0x5C,0x92,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0xDD,0xBA,0x5F,0xCB,0x7E,0xDB,0xBF,0xDB,
-	0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0xBF,0xDB,0xBF,0xDB,0xDF,0xCB,0x5F,0xCB,0xDF,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,
-	0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x3C,0x6A,0xDD,0x69,0xD9,0x61,0xD9,0x61,0xDC,0x59,0xD9,0x61,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x77,0x41,0x9A,0x49,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0xF1,0x20,0xD1,0x18,0xD1,0x18,
-	0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xF1,0x20,0xD3,0x10,0x13,0x29,0x34,0x19,0x34,0x19,0x34,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0xB3,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x3B,0x19,0x3B,0x19,0xFC,0x10,0xFC,0x10,
-	0xFC,0x10,0x5A,0x09,0x5A,0x09,0x5A,0x09,0xFC,0x10,0x3C,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x19,0x3C,0x11,0x3C,0x11,0x3B,0x19,0xD9,0x08,0xD7,0x18,0xD5,0x18,0xD5,0x08,0xD3,0x10,0x72,0x10,0x71,0x08,0x70,0x10,0xD3,0x10,0xD5,0x18,0x35,0x31,0x37,0x19,0x19,0x21,0x19,0x21,0x19,0x21,0xFB,0x18,0x5C,0x31,
-	0x5C,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0xDD,0x49,0xBF,0x5A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0xC7,0x21,0xC5,0x18,0xB1,0x49,0x51,0x41,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x51,0x41,0x51,0x41,0x0E,0x41,0xED,0x28,0x6B,0x10,0x68,0x18,0x68,0x18,0x26,0x08,0x25,0x08,0x24,0x08,
-	0x24,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x66,0x10,0xCA,0x28,0xCA,0x28,0x0B,0x39,0x0E,0x41,0x6E,0x51,0x90,0x61,0xB1,0x49,0xF5,0x69,0xF5,0x69,0x17,0x82,0x17,0x82,0x5B,0x82,
-	0x5B,0x82,0x17,0x82,0x17,0x82,0x1C,0x7A,0x17,0x82,0xD9,0x61,0x17,0x82,0xD9,0x61,0x17,0x82,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x17,0x82,0xD9,0x61,0x1C,0x7A,0xD9,0x61,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5B,0x82,0x1C,0x7A,0x5B,0x82,0x1C,0x7A,0x5C,0x92,0x5E,0x82,0x5C,0x92,0x5C,0x92,0x5C,0x92,
-	0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0xDE,0xAA,0xDE,0xAA,0x5F,0xB3,0x5F,0xCB,0x5F,0xCB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xFF,0xD3,
-	0xBF,0xDB,0xFF,0xD3,0x5F,0xCB,0xDF,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x3C,0x6A,0x1C,0x7A,0xDD,0x69,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0xD9,0x61,0xDC,0x59,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,
-	0x9A,0x49,0x9A,0x49,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0xD3,0x10,0xF1,0x20,0xF1,0x20,0xD1,0x18,0xF1,0x20,0x6F,0x10,0xAF,0x18,0x6F,0x10,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0xD3,0x10,0x34,0x19,0x34,0x19,0x34,0x19,0xD5,0x18,0x34,0x19,
-	0x34,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0xB3,0x08,0xB1,0x08,0x71,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x3C,0x11,0x3C,0x11,0x7E,0x11,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3C,0x11,0x3B,0x19,0x39,0x19,
-	0xD9,0x08,0xD7,0x08,0xD5,0x18,0xD5,0x08,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD5,0x18,0x37,0x19,0x19,0x21,0x78,0x31,0x19,0x21,0x19,0x21,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5E,0x31,0xDE,0x49,0xDF,0x31,0xDE,0x49,0xDE,0x49,0xFE,0x51,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0x9B,0x5A,0xB1,0x49,0x48,0x39,0xC5,0x18,
-	0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x6D,0x18,0x6B,0x10,0x68,0x18,0x68,0x18,0x26,0x08,0x66,0x08,0x25,0x08,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x08,0x24,0x08,0x24,0x08,
-	0x24,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x66,0x10,0x68,0x18,0xCA,0x28,0xCA,0x28,0x0E,0x41,0x6E,0x51,0x90,0x61,0xF5,0x69,0xF5,0x69,0x59,0x92,0x5B,0x82,0x59,0x92,0xBC,0x9A,0x5C,0xA2,0x5C,0x92,0x5C,0xA2,0x5C,0x92,0x5C,0xA2,0x5C,0xA2,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0xA2,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,
-	0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0xA2,0x5C,0x92,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0x5C,0xA2,0xDE,0xAA,0xDD,0xBA,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xFF,0xD3,0x5F,0xCB,0xDF,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x82,
-	0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xD9,0x61,0xDC,0x59,0xD9,0x61,0xDC,0x59,0xDC,0x59,0xD9,0x61,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x72,0x10,0xF1,0x20,
-	0xD1,0x18,0xAF,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xF1,0x20,0xD1,0x18,0xD3,0x10,0xD3,0x10,0x34,0x19,0x34,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0xD5,0x18,0xB3,0x08,0xB1,0x08,0xB3,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0x3B,0x19,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x5C,0x09,
-	0xFC,0x10,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x3C,0x11,0x3C,0x11,0x3B,0x19,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0x75,0x10,0xD7,0x18,0xD7,0x18,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x5C,0x31,0x19,0x21,0xFB,0x18,0x5C,0x31,0x5E,0x31,
-	0x5E,0x31,0xDE,0x49,0x5E,0x31,0x7D,0x41,0xDD,0x49,0x3D,0x5A,0x7F,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x27,0x08,0x26,0x08,0x25,0x08,0x25,0x08,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0xCA,0x28,0x0B,0x39,0x0E,0x41,0xB1,0x49,0xF5,0x69,0x17,0x82,0x59,0x92,0x59,0x92,0xFD,0x9A,
-	0xDE,0xAA,0x3E,0xA3,0x5F,0xB3,0x5F,0xB3,0x3E,0xBB,0x3E,0xBB,0xDD,0xBA,0x3E,0xBB,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0x5C,0xA2,0xDD,0xBA,0x5C,0xA2,0x5C,0xA2,0xDD,0xBA,0x5C,0xA2,0xDD,0xBA,0x5C,0xA2,0xDD,0xBA,0x5C,0xA2,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,
-	0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x5F,0xCB,
-	0xDF,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x3E,0xA3,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x3C,0x6A,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xD9,0x61,0xDC,0x59,0xDD,0x69,0xD9,0x61,0xDC,0x59,0xDC,0x59,0xDC,0x59,
-	0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x77,0x41,0x78,0x31,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0xF1,0x20,0xD1,0x18,0x70,0x10,0xAF,0x18,0x6F,0x10,0x6F,0x10,0x6F,0x10,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xF1,0x20,0xD3,0x10,0xD3,0x10,0x34,0x19,0x34,0x19,
-	0x34,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0xB3,0x08,0xB3,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x3C,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x19,0x7E,0x19,0xBE,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x3E,0x19,0x3E,0x19,0x3C,0x11,0xFC,0x10,0xFC,0x10,
-	0xD9,0x08,0xD9,0x08,0xD7,0x18,0xD9,0x08,0x39,0x19,0x19,0x21,0x5C,0x29,0x78,0x31,0x5C,0x31,0x19,0x21,0x5C,0x31,0xFB,0x18,0x5C,0x29,0x5C,0x31,0x5C,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0x5E,0x31,0xDD,0x49,0xDD,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x7F,0x6A,0x9B,0x5A,0xB1,0x49,0x4A,0x29,0xE3,0x18,
-	0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x27,0x08,0x27,0x08,0x68,0x18,0x68,0x18,0x27,0x08,0x27,0x08,0x26,0x08,0x26,0x08,0x65,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x24,0x08,0x24,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xED,0x28,0x6E,0x51,0xB2,0x71,0xF5,0x69,0x17,0x82,0xBC,0x9A,0xDB,0xB2,0x3E,0xBB,0x3E,0xBB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0xDF,0xCB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,
-	0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0xFF,0xD3,0xBF,0xDB,0x7E,0xDB,0xDF,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0x3E,0xA3,0x3E,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,
-	0x1C,0x7A,0x1C,0x7A,0xDD,0x69,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xDC,0x59,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDC,0x59,0xDD,0x69,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x69,0xDC,0x59,0xDC,0x59,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,
-	0x72,0x10,0xF1,0x20,0x70,0x10,0x6F,0x10,0xAF,0x18,0x6F,0x10,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x34,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0xD5,0x18,0xB3,0x08,0x72,0x08,0xB3,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0x5C,0x09,0xFC,0x10,0xFC,0x10,0x1E,0x11,
-	0x1E,0x11,0x7E,0x11,0x7E,0x19,0x7E,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0xBE,0x29,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x1E,0x11,0x3C,0x11,0xFC,0x10,0xFC,0x10,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,0xFB,0x18,0x5C,0x31,0x5C,0x29,0x5C,0x31,0x5C,0x31,0x7D,0x41,
-	0xDE,0x49,0xDF,0x31,0x7D,0x41,0x7D,0x41,0x3C,0x4A,0x3F,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x48,0x39,0xC5,0x18,0x25,0x08,0x25,0x08,0x25,0x00,0x25,0x00,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x66,0x10,0x27,0x08,0x26,0x08,0x26,0x08,0x26,0x00,0x26,0x00,0x25,0x08,0x25,0x00,
-	0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x08,0x25,0x08,0x25,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xED,0x28,0x0E,0x41,0xB1,0x49,0xF5,0x69,0x17,0x82,0xBC,0x9A,0xDB,0xB2,
-	0x3E,0xBB,0x5F,0xCB,0x5F,0xCB,0xDF,0xCB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xE4,0xDF,0xEB,0xDF,0xEB,0xFF,0xD3,0xBF,0xDB,0xBF,0xDB,0xFF,0xD3,0xDF,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,
-	0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0xDD,0x69,0x1C,0x7A,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,
-	0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x3C,0x6A,0xDC,0x59,0x3C,0x6A,0xDC,0x59,0x9A,0x49,0x77,0x41,0x35,0x31,0x35,0x31,0x13,0x29,0x72,0x10,0xD1,0x18,0x6F,0x10,0x6F,0x10,0x6F,0x10,0xAF,0x18,0xCF,0x08,0xAF,0x18,0xCF,0x08,0xD1,0x18,0xB1,0x08,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x34,0x19,
-	0xD5,0x18,0xD5,0x18,0xD5,0x18,0xB3,0x08,0xD5,0x08,0x72,0x08,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x5C,0x09,0x1E,0x11,0x7E,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0xBE,0x29,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x3E,0x19,0x3C,0x11,0xFC,0x10,0xFC,0x10,
-	0xFC,0x10,0xFC,0x10,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x31,0x5C,0x29,0x5C,0x31,0x5C,0x29,0xFB,0x18,0x5C,0x31,0x5C,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x5E,0x31,0xDD,0x49,0xDD,0x49,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0x7F,0x6A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0x46,0x21,
-	0x25,0x08,0x25,0x08,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x66,0x08,0x26,0x08,0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x24,0x00,0x24,0x00,0x65,0x08,0x25,0x08,0x26,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0xCA,0x28,0xCA,0x28,0xED,0x28,0x6E,0x51,0xB2,0x71,0x17,0x82,0x59,0x92,0xDB,0xB2,0xDD,0xBA,0x5F,0xCB,0x5F,0xCB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,
-	0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0xDF,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,
-	0x3C,0x6A,0x1C,0x7A,0x3C,0x6A,0xDD,0x69,0x3C,0x6A,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x7A,0xBC,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBD,0x6A,0x3C,0x6A,0x9B,0x5A,0xDC,0x59,0x9A,0x49,0x77,0x41,
-	0x35,0x31,0x13,0x29,0xD3,0x10,0xD1,0x18,0x6F,0x10,0x6F,0x10,0x6E,0x08,0x6F,0x10,0x6E,0x08,0xCF,0x08,0xCF,0x08,0xD1,0x18,0x31,0x09,0xD3,0x10,0xD3,0x10,0xD3,0x10,0x34,0x19,0x34,0x19,0xD5,0x18,0xD5,0x08,0xB3,0x08,0xB3,0x08,0x75,0x00,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7E,0x11,
-	0x7E,0x11,0x7E,0x19,0x7F,0x19,0x7E,0x19,0xBE,0x19,0x7E,0x19,0x7F,0x19,0x5E,0x29,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x1E,0x11,0x1E,0x11,0x3C,0x11,0x3C,0x11,0xFC,0x10,0xFC,0x10,0xFB,0x18,0x3C,0x11,0xBD,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5E,0x31,0xDE,0x49,0xDE,0x49,
-	0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0x3D,0x5A,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0x65,0x08,0x24,0x08,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x66,0x08,0x26,0x08,0x26,0x08,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,
-	0x67,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x65,0x08,0x66,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xCA,0x28,0x0E,0x41,0xB1,0x49,0xF5,0x69,0x59,0x92,0xBC,0x9A,
-	0xDD,0xBA,0x5F,0xCB,0x5F,0xCB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0xFF,0xD3,0xFF,0xD3,0x7E,0xDB,0xDF,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDE,0xAA,
-	0xDE,0xAA,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xDD,0x69,0x3C,0x6A,0xDD,0x69,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,
-	0x5E,0x82,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x7F,0x6A,0x7F,0x6A,0x3D,0x5A,0x3D,0x5A,0x9A,0x49,0x7A,0x41,0x78,0x31,0x13,0x29,0xD3,0x10,0xD1,0x18,0x6F,0x10,0xCF,0x08,0x6E,0x08,0xCF,0x08,0x6E,0x08,0x6F,0x10,0xB1,0x08,0xD1,0x18,0xB1,0x08,0xB3,0x08,0xD3,0x10,
-	0xD3,0x10,0xD5,0x18,0xB3,0x08,0xB3,0x08,0xD5,0x08,0x75,0x00,0x75,0x00,0xD7,0x08,0xD9,0x08,0x5A,0x09,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x7E,0x19,0x7F,0x19,0x7F,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x1E,0x11,0x3E,0x19,0x1E,0x11,0xFC,0x10,0xFC,0x10,
-	0x3C,0x11,0x3C,0x11,0x5C,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x3E,0x19,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x5E,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDD,0x49,0x3D,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x66,0x08,0x25,0x08,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x66,0x08,0x26,0x08,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x67,0x00,0x67,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x24,0x00,0x24,0x00,0x65,0x08,0x25,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xCA,0x28,0x0E,0x41,0x6E,0x51,0xF5,0x69,0x59,0x92,0x99,0xAA,0xDD,0xBA,0xDD,0xBA,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,
-	0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0xFF,0xD3,0xBF,0xDB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xDD,0x69,0x3C,0x6A,
-	0x3C,0x6A,0xD9,0x61,0xDD,0x69,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x1C,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3D,0x5A,0x3D,0x5A,
-	0x9A,0x49,0x77,0x41,0x35,0x31,0x13,0x29,0xD3,0x10,0x70,0x10,0x6F,0x10,0x6E,0x08,0x6E,0x08,0x6E,0x08,0xCF,0x08,0xB1,0x08,0xB1,0x08,0xD1,0x18,0xD3,0x10,0xD3,0x10,0x34,0x01,0xD3,0x10,0xD5,0x08,0xB3,0x08,0x75,0x00,0xD5,0x08,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x5C,0x09,0xFC,0x10,0x7E,0x09,0x7E,0x11,0x7F,0x19,
-	0x7E,0x19,0xBF,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0xBF,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x3E,0x19,0x5E,0x29,0x5E,0x29,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x3E,0x19,0x5C,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0xDE,0x49,
-	0xDE,0x49,0x7D,0x41,0x7D,0x41,0xDD,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x48,0x39,0xC6,0x28,0x67,0x08,0x66,0x08,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x66,0x08,0x67,0x08,0x67,0x08,0x28,0x08,0x68,0x08,0x28,0x08,0x68,0x00,
-	0x68,0x00,0x68,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x65,0x08,0x66,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xED,0x28,0x0E,0x41,0xB2,0x71,0x17,0x82,0x59,0x92,
-	0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5F,0xCB,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xCB,0x5F,0xCB,0xDF,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDE,0xAA,0xDF,0x92,
-	0xDF,0x92,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0x3C,0x6A,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,
-	0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0x3F,0x8B,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0x3D,0x5A,0x3C,0x4A,0x7A,0x41,0x78,0x31,0x35,0x31,0xD3,0x10,0x70,0x10,0xCF,0x08,0x6E,0x08,0x6E,0x08,0xCF,0x08,0x6E,0x08,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xD3,0x10,0xB3,0x08,
-	0xD3,0x10,0xB3,0x08,0xB3,0x08,0xD5,0x08,0x75,0x00,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x7E,0x09,0x1E,0x11,0x7E,0x19,0x7F,0x19,0x7E,0x19,0xBE,0x19,0x7E,0x19,0xBF,0x19,0x7E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x1E,0x11,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x3C,0x11,0x3E,0x19,
-	0x3E,0x19,0xBE,0x29,0xDF,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x3E,0x19,0x5C,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDD,0x49,0x3F,0x5A,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x68,0x18,0x67,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x66,0x08,0x66,0x08,0x68,0x08,0x28,0x08,0x28,0x08,0x69,0x08,0x69,0x00,0x29,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x67,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x65,0x08,0x66,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xCA,0x28,0x0E,0x41,0x90,0x61,0xF5,0x69,0x59,0x92,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,
-	0xBF,0xDB,0xDF,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0x5E,0x82,0xDF,0x92,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0x3C,0x6A,0xD9,0x61,0x3C,0x6A,0xD9,0x61,0x3C,0x6A,
-	0xD9,0x61,0xD9,0x61,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0x5E,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x7F,0x6A,0x3E,0x62,0x3F,0x5A,0x3D,0x5A,0xDD,0x49,
-	0xDD,0x49,0x3C,0x4A,0x78,0x31,0x35,0x31,0x34,0x19,0xD1,0x18,0xAF,0x18,0xCF,0x08,0x6E,0x08,0x6E,0x08,0xCF,0x08,0x6F,0x10,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xD3,0x10,0xB3,0x08,0xD3,0x10,0xB3,0x08,0xB3,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0xFC,0x10,0x1E,0x11,0x7F,0x11,0x7F,0x19,0xBF,0x19,
-	0x7E,0x19,0x7F,0x19,0xBE,0x19,0x7E,0x19,0xBF,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x3C,0x11,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x3E,0x19,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x3E,0x19,0x5E,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,
-	0xDE,0x49,0x7D,0x41,0xDD,0x49,0xDC,0x59,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xAB,0x10,0x68,0x18,0x66,0x08,0x25,0x08,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x67,0x08,0x68,0x08,0x68,0x08,0x69,0x08,0x69,0x08,0x6A,0x08,
-	0x69,0x00,0x69,0x00,0x69,0x00,0x29,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x25,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0x6B,0x10,0xCA,0x28,0x0E,0x41,0x51,0x41,0xB2,0x71,0x17,0x82,
-	0x59,0x92,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x5F,0xCB,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0x5E,0x82,0x5E,0x82,0x5E,0x82,
-	0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x39,0x72,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xDD,0x69,0xD9,0x61,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,0x5F,0xA3,0xDF,0xAB,0x5F,0xA3,
-	0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0x7F,0x6A,0x5E,0x7A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x78,0x31,0x78,0x31,0x34,0x19,0xD3,0x10,0xD1,0x18,0xCF,0x08,0x6E,0x08,0xCF,0x08,0x6E,0x08,0xCF,0x08,0xB1,0x08,0xB1,0x08,0xD1,0x18,0xB3,0x08,
-	0xB3,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x08,0x75,0x00,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x5C,0x09,0x1E,0x11,0x7F,0x11,0x7E,0x19,0x7F,0x19,0x7E,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x29,0x7E,0x19,0xBE,0x29,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x1E,0x11,0x1E,0x11,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDD,0x49,0x3D,0x5A,0xBF,0x5A,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0x9B,0x5A,0x14,0x4A,0x48,0x39,0xC5,0x18,
-	0xAB,0x10,0xAB,0x10,0xA7,0x18,0x66,0x08,0x65,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x66,0x08,0x28,0x08,0x69,0x08,0x69,0x08,0x6A,0x08,0x6A,0x00,0x6A,0x00,0x6A,0x08,0x6A,0x00,0x69,0x00,0x69,0x00,0x29,0x00,0x69,0x00,0x68,0x00,0x28,0x00,0x28,0x00,0x27,0x00,0x67,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x25,0x08,0x25,0x08,0x66,0x08,0x66,0x10,0xA7,0x18,0x68,0x18,0xCA,0x28,0xCA,0x28,0xED,0x28,0x0E,0x41,0x90,0x61,0x17,0x82,0x59,0x92,0x99,0xAA,0xDD,0xBA,0x3E,0xBB,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,
-	0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,
-	0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0x5C,0x92,0x5E,0x82,0xBD,0x8A,0x5E,0x82,0x5B,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x39,0x72,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,
-	0xD9,0x61,0xDD,0x69,0xDD,0x69,0x1C,0x7A,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x92,0xDF,0x92,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0xBD,0x6A,0x7F,0x6A,0x3E,0x62,0x3F,0x5A,0x3E,0x62,0xFE,0x51,0xDD,0x49,0x3C,0x4A,
-	0x7A,0x41,0x7A,0x41,0x78,0x31,0x78,0x31,0x35,0x31,0xD3,0x10,0xD1,0x18,0xCF,0x08,0x6F,0x10,0x6E,0x08,0x6E,0x08,0x71,0x08,0x6F,0x10,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0x75,0x00,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x7E,0x11,0x7E,0x11,0xBF,0x19,0xBF,0x19,0xBE,0x19,
-	0x7F,0x19,0x7E,0x19,0x7F,0x19,0xBF,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x1E,0x11,0x3E,0x19,0x3C,0x11,0x3E,0x19,0x3E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xFE,0x51,0xDE,0x49,
-	0xDE,0x49,0xDD,0x49,0xDD,0x49,0xFE,0x51,0x7F,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xED,0x28,0xCA,0x28,0xAB,0x10,0xA8,0x18,0x26,0x08,0x66,0x08,0x65,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x08,0x68,0x08,0x69,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,
-	0x6B,0x08,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x29,0x00,0x68,0x00,0x28,0x00,0x27,0x00,0x67,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x66,0x08,0x66,0x08,0x66,0x10,0xA7,0x18,0x68,0x18,0x68,0x18,0xCA,0x28,0x0E,0x41,0x51,0x41,0xB2,0x71,
-	0x17,0x82,0x59,0x92,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x5F,0xCB,0x5F,0xCB,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,
-	0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x3E,0xBB,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xDF,0x92,0xFD,0x9A,0x5C,0x92,0xBD,0x8A,0x5E,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x1C,0x7A,
-	0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xDD,0x69,0xD9,0x61,0x1C,0x7A,0xD9,0x61,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0x5F,0xA3,0x5F,0x9B,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,
-	0xDF,0x92,0x3F,0x8B,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0xDF,0x7A,0x5E,0x7A,0x7F,0x6A,0x3E,0x62,0x3E,0x62,0x3F,0x5A,0x3D,0x5A,0xDD,0x49,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x7A,0x41,0x78,0x31,0x78,0x31,0x35,0x31,0x34,0x19,0x34,0x19,0xD1,0x18,0xCF,0x08,0x6E,0x08,0xCF,0x08,0x6E,0x08,0xCF,0x08,0xB1,0x08,0x70,0x10,0xB1,0x08,0xB1,0x08,
-	0x71,0x08,0xB3,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x5C,0x09,0x1E,0x11,0x7E,0x11,0xBF,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0xBE,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0xBE,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x3E,0x19,0x1E,0x11,0x3C,0x11,0x3E,0x19,0x7E,0x19,0xBE,0x29,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5C,0x29,0x5E,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDC,0x59,0x3F,0x5A,0xBF,0x6A,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0x46,0x21,
-	0xED,0x28,0xED,0x28,0xCA,0x28,0xA8,0x18,0x68,0x18,0x26,0x08,0x26,0x08,0x65,0x08,0x25,0x00,0x25,0x00,0x26,0x00,0x68,0x08,0x69,0x08,0x6B,0x10,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x29,0x08,0x68,0x00,0x67,0x08,0x66,0x08,0x26,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x08,0x25,0x08,0x25,0x08,0x66,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xED,0x28,0x0E,0x41,0xB2,0x71,0x17,0x82,0x59,0x92,0xBC,0x9A,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,
-	0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x3E,0xBB,0xDE,0xAA,
-	0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5C,0xA2,0xDF,0x92,0xFD,0x9A,0xBC,0x9A,0xFD,0x9A,0x5E,0x82,0xBD,0x8A,0x5E,0x82,0x5B,0x82,0x5B,0x82,0x1C,0x7A,0x1C,0x7A,0x39,0x72,0x39,0x72,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,
-	0xDD,0x69,0xD9,0x61,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x92,0x5F,0x9B,0x5F,0xA3,0x5F,0x9B,0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0x7F,0x6A,0x3E,0x62,0x3D,0x5A,0x3D,0x5A,0x3D,0x5A,0xDC,0x59,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x7A,0x41,
-	0x78,0x31,0x78,0x31,0x35,0x31,0x37,0x19,0x35,0x31,0xF1,0x20,0xD1,0x18,0xAF,0x18,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0xB1,0x08,0x71,0x08,0xB1,0x08,0xB1,0x08,0x72,0x08,0x75,0x00,0x75,0x00,0x75,0x00,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7E,0x19,0xBE,0x19,0xBF,0x19,0xBF,0x19,0x7E,0x19,
-	0x7F,0x19,0x7F,0x19,0xBE,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x11,0x3E,0x19,0x3C,0x11,0x3E,0x19,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x42,0xFE,0x51,0xDE,0x49,0xDE,0x49,
-	0xDE,0x49,0xDD,0x49,0xDD,0x49,0x3F,0x5A,0xBF,0x6A,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,0x68,0x18,0x68,0x08,0x26,0x08,0x26,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x67,0x08,0x69,0x08,0xAB,0x10,0xAB,0x10,0x6B,0x08,
-	0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0xAB,0x00,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x6A,0x00,0x69,0x08,0x69,0x00,0x68,0x08,0x27,0x00,0x66,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x25,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x0E,0x41,0x51,0x41,
-	0xB2,0x71,0x17,0x82,0x59,0x92,0x99,0xAA,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0x5F,0xCB,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0x7E,0xDB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xDF,0xEB,0x7E,0xDB,0xBF,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,
-	0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDF,0x92,0xBC,0x9A,0xFD,0x9A,0x5C,0x92,0x5E,0x82,0x5E,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,
-	0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xDD,0x69,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x5E,0x82,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0x5F,0x9B,0x5F,0xA3,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,
-	0xDF,0x8A,0xDF,0x7A,0x5E,0x7A,0x5E,0x7A,0xBD,0x6A,0x3E,0x62,0x3E,0x62,0x3D,0x5A,0x3D,0x5A,0xDC,0x59,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x7A,0x41,0x78,0x31,0x78,0x31,0x78,0x31,0x37,0x19,0x35,0x31,0x34,0x19,0x34,0x19,0xF1,0x20,0xD1,0x18,0xAF,0x18,0x6E,0x08,0x6C,0x08,0xCF,0x08,0x6E,0x08,0xCF,0x08,0x6E,0x08,0xB1,0x08,0xB1,0x08,
-	0x72,0x08,0x72,0x08,0xB3,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0x5C,0x09,0x1E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x29,0xDF,0x31,0xDF,0x31,0x5F,0x2A,
-	0xDF,0x31,0xDF,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5C,0x31,0x7D,0x41,0xDE,0x49,0x3F,0x42,0xFE,0x51,0x3F,0x42,0xFE,0x51,0xDE,0x49,0xDE,0x49,0xDD,0x49,0xDD,0x49,0x7F,0x6A,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0x46,0x21,
-	0xF1,0x20,0x31,0x31,0xED,0x28,0xED,0x28,0xAB,0x10,0x68,0x18,0x28,0x08,0x27,0x00,0x26,0x00,0x25,0x00,0x26,0x00,0x67,0x08,0x69,0x08,0xAB,0x10,0xAB,0x10,0xCD,0x00,0xAD,0x18,0x6C,0x08,0xCD,0x00,0x6C,0x08,0xCD,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x08,0x6A,0x00,0x69,0x08,0x29,0x00,0x68,0x08,0x67,0x00,0x26,0x00,
-	0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x65,0x10,0x66,0x10,0xA7,0x18,0x68,0x18,0x68,0x18,0xCA,0x28,0xED,0x28,0x0E,0x41,0xB2,0x71,0xF5,0x69,0x59,0x92,0x59,0x92,0xBC,0x9A,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0x3C,0xCB,0x5F,0xCB,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,
-	0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x5F,0xCB,0x7E,0xDB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xB3,0x5F,0xB3,0x3E,0xBB,0x5F,0xB3,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0x5C,0xA2,0x5C,0xA2,
-	0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5E,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x1C,0x7A,0x39,0x72,0x39,0x72,0xD9,0x61,0x39,0x72,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x95,0x59,0xD9,0x61,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xD9,0x61,0x95,0x59,0xD9,0x61,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,
-	0x1C,0x7A,0xD9,0x61,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0xDF,0x92,0xDF,0x92,0x5F,0x9B,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0x3E,0x62,0x3D,0x5A,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x49,0x7A,0x41,0x7A,0x41,0x78,0x31,0x77,0x41,0x78,0x31,0x78,0x31,
-	0x35,0x31,0x35,0x31,0x34,0x19,0x34,0x19,0x13,0x29,0xF1,0x20,0xF1,0x20,0xCF,0x08,0xCF,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0xB1,0x08,0x71,0x08,0x72,0x08,0x75,0x00,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x7E,0x09,0x7E,0x11,0xBE,0x19,0x7E,0x11,0x7E,0x11,0xBE,0x19,0x7F,0x19,
-	0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3C,0x11,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5C,0x29,0x5C,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0xDE,0x49,
-	0xDD,0x49,0x7D,0x41,0xDC,0x59,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0x46,0x21,0x31,0x31,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xAD,0x18,0x69,0x08,0x27,0x08,0x27,0x08,0x66,0x08,0x26,0x00,0x27,0x00,0x67,0x08,0x69,0x08,0xAB,0x10,0x6C,0x08,
-	0xCD,0x00,0xAF,0x18,0xCD,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0xCD,0x00,0x6C,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x08,0x6A,0x00,0x69,0x08,0x29,0x08,0x67,0x08,0x26,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x25,0x08,0x25,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0xC6,0x28,0x68,0x18,0xCA,0x28,0xCA,0x28,0x0E,0x41,
-	0x6E,0x51,0xB2,0x71,0x17,0x82,0x59,0x92,0x99,0xAA,0xBC,0x9A,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0x3C,0xCB,0x3E,0xBB,0x5F,0xCB,0x3E,0xBB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x7E,0xDB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,
-	0x5F,0xCB,0x5F,0xCB,0x3E,0xBB,0x3E,0xBB,0x5F,0xB3,0x3E,0xBB,0xDE,0xAA,0x3E,0xBB,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0xAA,0xBC,0x9A,0xBC,0x9A,0x5C,0x92,0x5C,0x92,0xBD,0x8A,0x5C,0x92,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x5B,0x82,0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xF5,0x69,0x95,0x59,0x95,0x59,
-	0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xD9,0x61,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0x5F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,
-	0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xDC,0x59,0xDC,0x59,0xDC,0x59,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x77,0x41,0x78,0x31,0x78,0x31,0x78,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x34,0x19,0x35,0x31,0x34,0x19,0xF1,0x20,0xF1,0x20,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xCD,0x00,0x6C,0x08,0xCF,0x08,0x6E,0x08,0xCF,0x08,0x71,0x08,0x71,0x08,
-	0xB1,0x08,0x72,0x08,0xB3,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7F,0x11,0xBE,0x19,0xBF,0x19,0x7F,0x19,0xBF,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x3C,0x11,0x3E,0x19,0x7E,0x19,0xBE,0x29,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5C,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0xDE,0x49,0xFE,0x51,0xDE,0x49,0xDD,0x49,0xDD,0x49,0xDC,0x59,0x7F,0x6A,0xDF,0x7A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x31,0x31,0x31,0x31,0x31,0x31,0xF1,0x20,0xED,0x28,0xED,0x28,0xAB,0x10,0x69,0x08,0x28,0x08,0x67,0x08,0x26,0x08,0x26,0x00,0x27,0x08,0x68,0x08,0x6B,0x08,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xCF,0x08,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x00,0x68,0x08,0x27,0x00,
-	0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x24,0x08,0x65,0x08,0x65,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xCA,0x28,0x0E,0x41,0x90,0x61,0xB4,0x6A,0x17,0x82,0x59,0x92,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,
-	0x3E,0xBB,0xDD,0xBA,0x3E,0xBB,0xDD,0xBA,0x5F,0xCB,0x5F,0xCB,0x5F,0xCB,0x3C,0xCB,0x5F,0xCB,0x3E,0xBB,0x5F,0xCB,0x5F,0xCB,0x3E,0xBB,0x5F,0xCB,0x3E,0xBB,0xDD,0xBA,0x3E,0xBB,0xDD,0xBA,0xDE,0xAA,0xDD,0xBA,0xDE,0xAA,0xDE,0xAA,0xDB,0xB2,0xDE,0xAA,0xDB,0xB2,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0x5C,0x92,0x5C,0x92,0x5B,0x82,0x5B,0x82,
-	0x5B,0x82,0x5B,0x82,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0xD9,0x61,0xF5,0x69,0xD9,0x61,0xF5,0x69,0xF5,0x69,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xD9,0x61,0x95,0x59,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,
-	0xD9,0x61,0x39,0x72,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x5E,0x82,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0x3D,0x5A,0xDC,0x59,0x19,0x52,0x9A,0x49,0x19,0x52,0x7A,0x41,0x77,0x41,0x77,0x41,0x78,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,
-	0x34,0x19,0x13,0x29,0x13,0x29,0x13,0x29,0x72,0x09,0xF1,0x20,0xAF,0x18,0xAF,0x18,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0xCF,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x5C,0x09,0x7E,0x11,0x7E,0x11,0xBE,0x19,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBF,0x19,
-	0xBE,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x11,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3C,0x11,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5C,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0xDE,0x49,
-	0xDD,0x49,0xDD,0x49,0x3D,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0x31,0x31,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0xF1,0x20,0xED,0x28,0x6B,0x10,0x69,0x08,0x68,0x08,0x27,0x08,0x27,0x00,0x26,0x00,0x68,0x08,0xAB,0x10,0xCD,0x00,
-	0xAD,0x18,0xCF,0x08,0xAF,0x18,0xCF,0x08,0xCF,0x08,0x6E,0x08,0x6F,0x10,0xCF,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x28,0x08,0x27,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x24,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0xC6,0x28,0x68,0x18,0xCA,0x28,0xCA,0x28,
-	0x0E,0x41,0x6E,0x51,0xF5,0x69,0xF3,0x81,0x17,0x82,0x59,0x92,0xBC,0x9A,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0xDD,0xBA,0x3E,0xBB,0xDD,0xBA,0xDD,0xBA,0x3E,0xBB,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0x3E,0xBB,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDD,0xBA,0xDE,0xAA,
-	0xDB,0xB2,0xDE,0xAA,0xDB,0xB2,0xDB,0xB2,0x5C,0xA2,0xDB,0xB2,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0x5C,0x92,0x59,0x92,0x5B,0x82,0x5B,0x82,0x59,0x92,0x39,0x72,0x17,0x82,0x39,0x72,0x17,0x82,0x39,0x72,0xF5,0x69,0xD9,0x61,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,
-	0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x8A,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,
-	0x3D,0x5A,0xD9,0x61,0x9A,0x49,0x19,0x52,0x9A,0x49,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x34,0x19,0x31,0x31,0x34,0x19,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xCD,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,
-	0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD7,0x08,0xFC,0x10,0xFC,0x10,0x3C,0x11,0x1E,0x11,0x7E,0x19,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBF,0x19,0xBE,0x19,0x7F,0x19,0x7F,0x11,0x7F,0x19,0x7F,0x11,0x7E,0x19,0x1E,0x11,0x7E,0x19,0x3C,0x11,0x3C,0x11,0x5C,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5C,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDD,0x49,0xDC,0x59,0xFE,0x51,0x7F,0x6A,0x3F,0x7B,0xBF,0x6A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x13,0x29,0x51,0x41,0x13,0x29,0x13,0x29,0x31,0x31,0x31,0x31,0xF1,0x20,0xAD,0x18,0x6B,0x10,0x68,0x18,0x27,0x08,0x27,0x08,0x26,0x08,0x28,0x08,0x69,0x08,0x6B,0x08,0xAF,0x18,0xAF,0x18,0xCF,0x08,0xD1,0x18,0x70,0x10,0xB1,0x08,0xCF,0x08,0x6F,0x10,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x28,0x00,
-	0x27,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x65,0x08,0x65,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0xCA,0x28,0xCA,0x28,0x0E,0x41,0x90,0x61,0xF5,0x69,0x17,0x82,0x55,0x9A,0x59,0x92,0x59,0x92,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,
-	0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDD,0xBA,0xDB,0xB2,0xDD,0xBA,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xBC,0x9A,0xDB,0xB2,0xBC,0x9A,0xDB,0xB2,0xBC,0x9A,0xDB,0xB2,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0x59,0x92,0x5C,0x92,0x59,0x92,0x5B,0x82,0x59,0x92,0x39,0x72,0x17,0x82,0x17,0x82,0x39,0x72,0x17,0x82,
-	0x39,0x72,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x74,0x41,0x95,0x59,0xB1,0x49,0x74,0x41,0xB1,0x49,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x77,0x41,0xD9,0x61,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,
-	0x1C,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0xDC,0x59,0xD9,0x61,0x19,0x52,0x19,0x52,0x19,0x52,0x77,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x31,0x31,0xF1,0x20,0x31,0x31,0xF1,0x20,0xF1,0x20,
-	0xF1,0x20,0xF1,0x20,0xF1,0x20,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xCD,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7F,0x19,
-	0x7F,0x11,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5C,0x31,0xBD,0x39,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x49,
-	0xDD,0x49,0xDD,0x49,0x3D,0x5A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x3F,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0xC7,0x21,0x46,0x21,0x74,0x41,0x35,0x31,0x74,0x41,0x74,0x41,0x35,0x31,0x51,0x41,0x31,0x31,0xF1,0x20,0xAD,0x18,0x6A,0x08,0x28,0x08,0x28,0x08,0x67,0x00,0x67,0x08,0x69,0x08,0xAB,0x00,
-	0xAD,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xB1,0x08,0xB1,0x08,0xB1,0x08,0xAF,0x18,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x28,0x08,0x27,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x24,0x08,0x24,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,
-	0xCA,0x28,0x0B,0x39,0x6E,0x51,0xB2,0x71,0xF5,0x69,0x17,0x82,0x55,0x9A,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x59,0x92,0x99,0xAA,0xBC,0x9A,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xDB,0xB2,0xBC,0x9A,0xDB,0xB2,0xBC,0x9A,0xDB,0xB2,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0xBC,0x9A,0x99,0xAA,0xBC,0x9A,0x99,0xAA,0x59,0x92,
-	0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0x17,0x82,0x39,0x72,0x17,0x82,0x39,0x72,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x74,0x41,
-	0xB1,0x49,0x74,0x41,0xB1,0x49,0x74,0x41,0xB1,0x49,0x74,0x41,0x74,0x41,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x1C,0x7A,0x5B,0x82,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0x19,0x52,0x9A,0x49,
-	0x77,0x41,0x77,0x41,0x77,0x41,0x74,0x41,0x74,0x41,0x35,0x31,0x74,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0x6B,0x08,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,
-	0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7F,0x19,0x7E,0x11,0x7E,0x11,0x7F,0x19,0x7E,0x19,0x3E,0x19,0x7E,0x11,0x3E,0x19,0x7E,0x19,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,
-	0xDF,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xDE,0x49,0xDD,0x49,0x7D,0x41,0xDD,0x49,0xDC,0x59,0x3F,0x5A,0xBF,0x6A,0xDF,0x7A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x74,0x41,0x74,0x41,0x35,0x31,0x35,0x31,0x74,0x41,0x35,0x31,0x74,0x41,0x31,0x31,0xED,0x28,0x6B,0x10,0x69,0x08,0x28,0x08,0x67,0x08,0x28,0x08,0x69,0x00,0x6B,0x08,0xCD,0x00,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xB1,0x08,0xAF,0x18,0xAF,0x18,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,
-	0x69,0x08,0x27,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x24,0x08,0x65,0x10,0x25,0x08,0x66,0x10,0x66,0x10,0xC6,0x28,0x68,0x18,0x68,0x18,0x0B,0x39,0x0E,0x41,0x90,0x61,0xB2,0x71,0xB4,0x6A,0x17,0x82,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x59,0x92,0x59,0x92,0x59,0x92,0x99,0xAA,0x59,0x92,0x59,0x92,
-	0x99,0xAA,0x99,0xAA,0x99,0xAA,0x59,0x92,0x99,0xAA,0x59,0x92,0x99,0xAA,0x59,0x92,0x99,0xAA,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0x59,0x92,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,
-	0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xB1,0x49,0x95,0x59,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x51,0x41,0xB1,0x49,0x51,0x41,0xB1,0x49,0x51,0x41,0xB1,0x49,0x51,0x41,0x51,0x41,0xB1,0x49,0x51,0x41,0x74,0x41,0x51,0x41,0x74,0x41,0x74,0x41,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xD9,0x61,0xD9,0x61,0x1C,0x7A,
-	0xBC,0x7A,0x5E,0x82,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x1C,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0x19,0x52,0x77,0x41,0x77,0x41,0x77,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAF,0x18,
-	0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0x6C,0x08,0x6B,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x75,0x00,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x19,0xBE,0x19,0xBE,0x09,0xBE,0x19,0x7E,0x19,0x7E,0x19,
-	0x7F,0x11,0x7E,0x19,0x1E,0x11,0x7E,0x11,0x3F,0x19,0x7E,0x11,0x3E,0x19,0x7E,0x19,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x7D,0x41,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDC,0x59,0xDE,0x49,0xDD,0x49,
-	0xDD,0x49,0xDC,0x59,0x3E,0x62,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0x74,0x41,0x35,0x31,0x74,0x41,0x74,0x41,0x77,0x41,0x35,0x31,0x74,0x41,0x13,0x29,0x31,0x31,0xAF,0x18,0x6B,0x10,0x69,0x08,0x68,0x08,0x68,0x08,0x28,0x00,0x6A,0x00,
-	0x6B,0x08,0x2E,0x09,0xD1,0x18,0xD1,0x18,0xF1,0x20,0x72,0x09,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xCF,0x08,0x6F,0x10,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x69,0x08,0x28,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x65,0x08,0x65,0x10,0x26,0x08,0x66,0x10,0x66,0x10,
-	0xCA,0x28,0xCA,0x28,0x0E,0x41,0x6E,0x51,0xB2,0x71,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x17,0x82,0x55,0x9A,0x55,0x9A,0x59,0x92,0x55,0x9A,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x17,0x82,0x17,0x82,
-	0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0xF5,0x69,0x17,0x82,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xB2,0x71,0x95,0x59,0x95,0x59,0xB1,0x49,0x90,0x61,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,
-	0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0x74,0x41,0x95,0x59,0x95,0x59,0x95,0x59,0xD9,0x61,0xD9,0x61,0x39,0x72,0x1C,0x7A,0xBC,0x7A,0x5E,0x82,0xBC,0x7A,0xBC,0x7A,0x1C,0x7A,0x3C,0x6A,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x77,0x41,0x77,0x41,0x95,0x59,0x74,0x41,0x74,0x41,
-	0x74,0x41,0x74,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xED,0x28,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xCD,0x00,0x6B,0x08,0x6A,0x08,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0x71,0x08,
-	0x71,0x08,0x72,0x08,0x75,0x00,0xD9,0x08,0xD9,0x08,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7E,0x11,0x7E,0x11,0x7F,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x1E,0x11,0x1E,0x11,0x7E,0x11,0x3E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,
-	0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xBD,0x39,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDD,0x49,0xDD,0x49,0xFE,0x51,0x7F,0x6A,0xBF,0x6A,0xDF,0x7A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,
-	0x74,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x14,0x4A,0x77,0x41,0x77,0x41,0x74,0x41,0x13,0x29,0x31,0x31,0xAD,0x18,0x6B,0x10,0x68,0x08,0x27,0x08,0x28,0x00,0x69,0x00,0x6B,0x08,0xCD,0x00,0xAF,0x18,0xF1,0x20,0x72,0x09,0x34,0x19,0xD3,0x10,0x72,0x09,0xD3,0x10,0xD3,0x10,0xB1,0x08,0x70,0x10,0xCF,0x08,0x6F,0x10,0x6C,0x08,0x6B,0x08,
-	0x6A,0x08,0x69,0x08,0x27,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x08,0x24,0x08,0x24,0x08,0x65,0x08,0x25,0x08,0x65,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0xCA,0x28,0xCA,0x28,0x0E,0x41,0x90,0x61,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x55,0x9A,0x17,0x82,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,
-	0x55,0x9A,0x55,0x9A,0x17,0x82,0x55,0x9A,0x17,0x82,0x59,0x92,0x17,0x82,0x59,0x92,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xB2,0x71,0x95,0x59,0xB2,0x71,0xB1,0x49,0x95,0x59,0xB1,0x49,0x90,0x61,
-	0xB1,0x49,0xB1,0x49,0xB1,0x49,0x90,0x61,0x51,0x41,0xB1,0x49,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x6E,0x51,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0x51,0x41,0x95,0x59,0x74,0x41,0x95,0x59,0x95,0x59,0xD9,0x61,0xD9,0x61,0x39,0x72,0x1C,0x7A,
-	0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x77,0x41,0x77,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0xF1,0x20,0xF1,0x20,0xED,0x28,0xED,0x28,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,
-	0xAD,0x18,0x6B,0x08,0xAD,0x18,0x6B,0x08,0x6B,0x08,0x6B,0x08,0xAB,0x10,0x6A,0x08,0x6A,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x75,0x00,0x75,0x00,0xD7,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7E,0x19,0x7E,0x11,0x7E,0x19,0xBE,0x19,0x7E,0x11,0xBE,0x19,0x7F,0x19,0x7E,0x11,
-	0x7E,0x19,0x1E,0x11,0x7E,0x19,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xDE,0x49,0x7D,0x41,0xFE,0x51,
-	0xDD,0x49,0xFE,0x51,0x7F,0x6A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBD,0x6A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xE3,0x18,0x74,0x41,0x14,0x4A,0x14,0x4A,0x78,0x31,0x77,0x41,0x77,0x41,0x77,0x41,0x14,0x4A,0x35,0x31,0x13,0x29,0xF1,0x20,0xAB,0x10,0x69,0x08,0x28,0x00,0x28,0x00,0x69,0x00,
-	0x6A,0x08,0x6C,0x08,0xCF,0x08,0xD1,0x18,0xF1,0x20,0x34,0x19,0x34,0x19,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0x6F,0x10,0x6F,0x10,0x6E,0x08,0x6C,0x08,0x6B,0x10,0x69,0x08,0x67,0x08,0x26,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x24,0x08,0x24,0x08,0x64,0x08,0x65,0x08,0x25,0x08,0x66,0x10,0x66,0x10,
-	0xC6,0x28,0x68,0x18,0x0B,0x39,0x0B,0x39,0x6E,0x51,0x90,0x61,0xB2,0x71,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x17,0x82,0x55,0x9A,0x17,0x82,0x55,0x9A,0x17,0x82,0x17,0x82,0x55,0x9A,0x17,0x82,0xF3,0x81,0x17,0x82,0xB4,0x6A,0x17,0x82,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF5,0x69,0xF3,0x81,
-	0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xB2,0x71,0x95,0x59,0xB2,0x71,0xB2,0x71,0x95,0x59,0x90,0x61,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x90,0x61,0xB1,0x49,0xB1,0x49,0x51,0x41,0x6E,0x51,0x6E,0x51,0x51,0x41,0x6E,0x51,0x51,0x41,0x6E,0x51,0x51,0x41,0x6E,0x51,0x51,0x41,0x0E,0x41,0x51,0x41,0x0E,0x41,
-	0x0E,0x41,0x51,0x41,0x0E,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0x74,0x41,0x95,0x59,0xD9,0x61,0xD9,0x61,0x39,0x72,0x39,0x72,0x1C,0x7A,0x39,0x72,0x3C,0x6A,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x95,0x59,0x77,0x41,0x95,0x59,0x74,0x41,0x74,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,
-	0x31,0x31,0x31,0x31,0xF1,0x20,0xED,0x28,0xED,0x28,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x00,0x6B,0x08,0xAB,0x10,0x6B,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x69,0x00,0x29,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x2C,0x00,0x6E,0x08,0x6E,0x08,
-	0x71,0x08,0x72,0x08,0xD7,0x08,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x7E,0x19,0x7F,0x11,0x7E,0x19,0xBE,0x19,0x7F,0x11,0x7E,0x19,0x7E,0x19,0x7F,0x11,0x7E,0x19,0x1E,0x11,0x3C,0x11,0x3E,0x19,0x3E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0x5E,0x31,
-	0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5C,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0x7D,0x41,0x7D,0x41,0xDC,0x59,0x3D,0x5A,0x7F,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0x46,0x21,
-	0x74,0x41,0x77,0x41,0x14,0x4A,0x77,0x41,0x14,0x4A,0x19,0x52,0x77,0x41,0x78,0x31,0x14,0x4A,0x74,0x41,0x31,0x31,0xAF,0x18,0x6B,0x10,0x69,0x08,0x28,0x00,0x69,0x08,0x69,0x08,0x6A,0x08,0xCD,0x00,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x34,0x19,0x34,0x19,0x72,0x09,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0x6F,0x10,0x6D,0x18,
-	0x6B,0x08,0x6A,0x08,0x28,0x08,0x26,0x00,0x25,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x24,0x00,0x24,0x08,0x24,0x08,0x65,0x10,0x65,0x10,0x66,0x10,0x66,0x10,0xC6,0x28,0x68,0x18,0xCA,0x28,0x4B,0x49,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,
-	0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xB4,0x6A,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xB2,0x71,0x95,0x59,0xB2,0x71,0x95,0x59,0xB2,0x71,0x90,0x61,0xB1,0x49,0xB1,0x49,0x90,0x61,0xB1,0x49,0xB1,0x49,0x90,0x61,0xB1,0x49,
-	0x51,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x51,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x51,0x41,0x0E,0x41,0x0E,0x41,0x51,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x31,0x31,0x0E,0x41,0x31,0x31,0x0E,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0x74,0x41,0x95,0x59,0xD9,0x61,0xD9,0x61,0x3C,0x6A,0x39,0x72,
-	0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x95,0x59,0x77,0x41,0x95,0x59,0x74,0x41,0x74,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0xF1,0x20,0xED,0x28,0xED,0x28,0xAF,0x18,0xAD,0x18,0xED,0x28,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0x6A,0x08,0x69,0x08,0x6A,0x08,
-	0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x68,0x00,0x29,0x00,0x29,0x00,0x2A,0x00,0x6B,0x00,0x2C,0x00,0x6C,0x08,0x71,0x08,0x71,0x08,0x75,0x00,0x75,0x00,0xD9,0x08,0xD9,0x08,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x7F,0x19,0x7F,0x19,0x7E,0x19,0x7F,0x11,0x7E,0x11,0x7F,0x19,0x7F,0x11,0x7E,0x19,
-	0x1E,0x11,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x7E,0x11,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5C,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0xFE,0x51,0xDE,0x49,0x7D,0x41,
-	0xDE,0x49,0x3D,0x5A,0x7F,0x6A,0xDF,0x7A,0x3F,0x7B,0xDF,0x7A,0x3F,0x7B,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0xBF,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0xC5,0x18,0x74,0x41,0x14,0x4A,0x77,0x41,0x77,0x41,0x19,0x52,0x19,0x52,0x77,0x41,0x19,0x52,0x77,0x41,0x35,0x31,0x13,0x29,0xF1,0x20,0xAB,0x10,0x6A,0x08,0x69,0x08,0x68,0x08,
-	0x69,0x00,0x6A,0x00,0x6B,0x08,0xAD,0x18,0x31,0x09,0xF1,0x20,0x34,0x19,0x34,0x19,0xD3,0x10,0x34,0x19,0x31,0x09,0xD3,0x10,0xD1,0x18,0xD1,0x18,0x6F,0x10,0xCD,0x00,0x6D,0x18,0x6B,0x10,0x69,0x08,0x27,0x08,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x24,0x00,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x65,0x10,
-	0x66,0x10,0x68,0x18,0xC6,0x28,0xCA,0x28,0x0B,0x39,0x6E,0x51,0x90,0x61,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF5,0x69,0xF3,0x81,0xF5,0x69,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,
-	0xB2,0x71,0x90,0x61,0xB2,0x71,0xB1,0x49,0x90,0x61,0x90,0x61,0xB1,0x49,0x90,0x61,0xB1,0x49,0xB1,0x49,0x90,0x61,0xB1,0x49,0xB1,0x49,0x6E,0x51,0x51,0x41,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x31,0x31,0x0E,0x41,0x0E,0x41,0x31,0x31,0x0E,0x41,0xED,0x28,0x31,0x31,0xED,0x28,
-	0x0E,0x41,0xED,0x28,0x0E,0x41,0x0E,0x41,0x31,0x31,0x0E,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x95,0x59,0x95,0x59,0xD9,0x61,0x39,0x72,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0x95,0x59,0x95,0x59,0x95,0x59,0x74,0x41,0x74,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,
-	0xED,0x28,0xED,0x28,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0x6A,0x08,0x69,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x00,0x28,0x00,0x69,0x00,0x2A,0x00,0x6B,0x00,0x2C,0x00,0x6E,0x08,0x6E,0x08,
-	0x71,0x08,0x72,0x08,0x75,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x3F,0x19,0x3F,0x11,0x7F,0x19,0x7E,0x19,0x7F,0x11,0x7F,0x11,0x7F,0x19,0x7F,0x11,0x3F,0x19,0x1E,0x11,0x1E,0x11,0x3C,0x11,0x3E,0x19,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,
-	0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5C,0x31,0xDD,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0xFE,0x51,0xDE,0x49,0x7D,0x41,0xDE,0x49,0xDC,0x59,0x3D,0x5A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0xB1,0x49,0x4A,0x29,0x46,0x21,
-	0xB1,0x49,0x74,0x41,0x14,0x4A,0x19,0x52,0x19,0x52,0x77,0x41,0x19,0x52,0x78,0x31,0x19,0x52,0x77,0x41,0x74,0x41,0x31,0x31,0xAF,0x18,0xAB,0x10,0x69,0x08,0x68,0x08,0x68,0x00,0x29,0x00,0x6A,0x00,0x6C,0x08,0xAF,0x18,0xF1,0x20,0x34,0x19,0xF1,0x20,0x34,0x19,0x34,0x19,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0x6F,0x10,
-	0x6C,0x08,0xAB,0x10,0x6A,0x08,0x68,0x08,0x26,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x08,0x24,0x00,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x65,0x10,0x66,0x10,0x66,0x10,0xCA,0x28,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x90,0x61,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF3,0x81,0xB2,0x71,0xF3,0x81,
-	0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xF5,0x69,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB1,0x49,0x90,0x61,0xB1,0x49,0x90,0x61,0xB1,0x49,0x90,0x61,0xB1,0x49,0x90,0x61,0xB1,0x49,0x90,0x61,0xB1,0x49,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,
-	0x0E,0x41,0x0E,0x41,0x0E,0x41,0x8E,0x31,0x0E,0x41,0x0E,0x41,0x0E,0x41,0xED,0x28,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0xED,0x28,0x31,0x31,0x0E,0x41,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x74,0x41,0x95,0x59,0x95,0x59,0xD9,0x61,0xF5,0x69,0xD9,0x61,0x95,0x59,
-	0x19,0x52,0x95,0x59,0x77,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0x6B,0x10,0x68,0x18,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,
-	0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x00,0x68,0x00,0x68,0x00,0x29,0x00,0x2A,0x00,0x2A,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0x75,0x00,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x3F,0x19,0x1E,0x11,0x3F,0x19,0x7F,0x19,0x7F,0x19,0x7F,0x11,0x7F,0x19,0x7F,0x11,0x3F,0x19,
-	0x1E,0x11,0x1E,0x11,0x3E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xBD,0x29,0xDF,0x31,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5C,0x31,0x5C,0x31,0xBD,0x39,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDE,0x49,0x7D,0x41,
-	0xFE,0x51,0x3F,0x5A,0xBF,0x6A,0xDF,0x7A,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x9B,0x5A,0x14,0x4A,0x4A,0x29,0x46,0x21,0xB1,0x49,0x14,0x4A,0x74,0x41,0x77,0x41,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x77,0x41,0x77,0x41,0x74,0x41,0xF1,0x20,0xAD,0x18,0x6B,0x10,0x69,0x08,
-	0x68,0x08,0x28,0x00,0x69,0x00,0x6A,0x00,0xCD,0x00,0xAF,0x18,0x72,0x09,0x34,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAB,0x10,0x69,0x08,0x66,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,
-	0x65,0x10,0x65,0x10,0x66,0x10,0xC6,0x28,0xC6,0x28,0x0B,0x39,0x4B,0x49,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x90,0x61,0xB1,0x49,0x90,0x61,0x90,0x61,
-	0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB1,0x49,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x51,0x41,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x8E,0x31,0xED,0x28,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,
-	0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x0E,0x41,0x31,0x31,0x51,0x41,0x51,0x41,0x95,0x59,0x95,0x59,0x95,0x59,0x19,0x52,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x74,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAF,0x18,0xED,0x28,
-	0xAD,0x18,0xCA,0x28,0xAB,0x10,0xCA,0x28,0xAB,0x10,0xAB,0x10,0x6B,0x10,0x68,0x18,0x69,0x08,0x68,0x18,0x69,0x08,0x68,0x18,0x69,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x00,0x68,0x00,0x28,0x00,0x68,0x00,0x29,0x00,0x29,0x00,0x6A,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,
-	0x71,0x08,0x72,0x08,0x75,0x00,0x75,0x10,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x3F,0x19,0x3F,0x11,0x7F,0x19,0x7F,0x11,0x1E,0x11,0x3F,0x11,0x1E,0x11,0x3F,0x19,0x1E,0x11,0x3E,0x19,0x7E,0x19,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0x5F,0x2A,0xDF,0x31,0xBD,0x39,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,
-	0x5C,0x29,0x5C,0x31,0x5C,0x31,0xDD,0x49,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDD,0x49,0x3C,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0x3F,0x5A,0x9B,0x5A,0xB1,0x49,0x4A,0x29,0x46,0x21,
-	0xB1,0x49,0x74,0x41,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x7A,0x41,0x19,0x52,0x19,0x52,0x19,0x52,0x14,0x4A,0x31,0x31,0xED,0x28,0xAB,0x10,0x69,0x08,0x69,0x08,0x68,0x00,0x68,0x00,0x69,0x00,0x6B,0x08,0xCF,0x08,0xF1,0x20,0x34,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,
-	0xAF,0x18,0xAF,0x18,0xAB,0x10,0x69,0x08,0x67,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x65,0x10,0x65,0x10,0x66,0x10,0xC6,0x28,0xCA,0x28,0x0B,0x39,0x4B,0x49,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,
-	0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB1,0x49,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x8E,0x31,0x0E,0x41,
-	0xED,0x28,0x0E,0x41,0xED,0x28,0x0B,0x39,0xED,0x28,0xED,0x28,0x0B,0x39,0xED,0x28,0xED,0x28,0xED,0x28,0xCA,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x74,0x41,
-	0x74,0x41,0x74,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAF,0x18,0xED,0x28,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAD,0x18,0xAB,0x10,0x6B,0x10,0x6B,0x10,0x68,0x18,0x68,0x18,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x28,0x08,0x68,0x08,
-	0x68,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x68,0x08,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x29,0x00,0x2A,0x00,0x2C,0x00,0x2C,0x00,0x6E,0x08,0x71,0x08,0x72,0x08,0x75,0x10,0x75,0x10,0xD9,0x08,0xFB,0x18,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x7F,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,
-	0x1E,0x11,0x3E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5C,0x31,0x5C,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDE,0x49,0x7D,0x41,0xDE,0x49,
-	0xDC,0x59,0x3D,0x5A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x19,0x52,0x14,0x4A,0x4A,0x29,0x46,0x21,0x51,0x41,0x74,0x41,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x9A,0x49,0x19,0x52,0x3C,0x4A,0x19,0x52,0x19,0x52,0x77,0x41,0x74,0x41,0x31,0x31,0xAD,0x18,0x6B,0x10,
-	0x69,0x08,0x68,0x08,0x68,0x00,0x68,0x00,0x6A,0x00,0x6B,0x08,0xCF,0x08,0xF1,0x20,0x34,0x19,0x34,0x19,0x34,0x19,0x34,0x19,0x72,0x09,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0x6A,0x08,0x67,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x22,0x08,0x23,0x08,
-	0x24,0x08,0x43,0x10,0x65,0x10,0x65,0x10,0x66,0x10,0xC6,0x28,0xCA,0x28,0x0B,0x39,0x4B,0x49,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0x90,0x61,0xB2,0x71,0x90,0x61,0xB2,0x71,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x6E,0x51,
-	0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0B,0x39,0xED,0x28,0x0B,0x39,0xED,0x28,0xED,0x28,0xED,0x28,0x0B,0x39,0xED,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0xCA,0x28,0xCA,0x28,
-	0xCA,0x28,0xED,0x28,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x31,0x31,0x31,0x31,0x51,0x41,0xB1,0x49,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x74,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,
-	0x6B,0x10,0x6B,0x10,0x6B,0x10,0x68,0x18,0x69,0x08,0x68,0x18,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x67,0x08,0x27,0x00,0x67,0x08,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x08,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x67,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,
-	0x71,0x08,0x72,0x08,0x75,0x00,0x75,0x10,0xD7,0x08,0xD9,0x08,0xFB,0x18,0xFC,0x10,0x3C,0x11,0x1E,0x11,0x3E,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x31,
-	0x5C,0x31,0x5C,0x31,0xBD,0x39,0xDE,0x49,0x3F,0x5A,0xBF,0x5A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDE,0x49,0xDD,0x49,0xDD,0x49,0x3D,0x5A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0x9B,0x5A,0xB1,0x49,0x4A,0x29,0xC5,0x18,
-	0x8E,0x31,0xB1,0x49,0x14,0x4A,0x77,0x41,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x9A,0x49,0x19,0x52,0x19,0x52,0x14,0x4A,0x74,0x41,0xF1,0x20,0xAB,0x10,0x6A,0x08,0x68,0x08,0x67,0x00,0x67,0x00,0x28,0x00,0x6A,0x00,0xCD,0x00,0xAF,0x18,0x72,0x09,0x34,0x19,0x34,0x19,0x34,0x19,0xD3,0x10,0x34,0x19,0xD3,0x10,0xD1,0x18,
-	0xD1,0x18,0xAF,0x18,0xAD,0x18,0x6B,0x08,0x68,0x08,0x66,0x08,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x24,0x08,0x65,0x10,0x65,0x10,0x66,0x10,0xC6,0x28,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,
-	0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x6E,0x51,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0B,0x39,0x0E,0x41,0x0B,0x39,0xED,0x28,0x0B,0x39,
-	0xED,0x28,0x0B,0x39,0xED,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xAB,0x10,0xCA,0x28,0xAB,0x10,0xCA,0x28,0xCA,0x28,0x6B,0x10,0xCA,0x28,0xCA,0x28,0x6D,0x18,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x51,0x41,0x74,0x41,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x51,0x41,0x51,0x41,
-	0x51,0x41,0x51,0x41,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0x6D,0x18,0x6B,0x10,0x6B,0x10,0xAB,0x10,0x6B,0x10,0x6B,0x10,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x67,0x08,0x68,0x08,0x67,0x08,0x27,0x00,0x67,0x00,
-	0x27,0x00,0x67,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6B,0x00,0x2C,0x00,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB3,0x08,0x75,0x10,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x1E,0x11,
-	0x3E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x5E,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0xDE,0x49,0x7D,0x41,0x7D,0x41,
-	0xDD,0x49,0x3D,0x5A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0x3F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x19,0x52,0xB1,0x49,0x4A,0x29,0xC5,0x18,0xED,0x28,0x51,0x41,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x3C,0x4A,0x19,0x52,0x3D,0x5A,0x19,0x52,0x19,0x52,0x19,0x52,0x74,0x41,0x31,0x31,0xAD,0x18,
-	0xAB,0x10,0x69,0x08,0x68,0x00,0x67,0x00,0x68,0x00,0x29,0x00,0x6A,0x00,0xCD,0x00,0xD1,0x18,0xF1,0x20,0x34,0x19,0x34,0x19,0x34,0x19,0xF1,0x20,0x34,0x19,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAD,0x18,0xAB,0x10,0x6A,0x08,0x67,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,
-	0x22,0x08,0x23,0x08,0x23,0x08,0x43,0x10,0x65,0x10,0x65,0x10,0xC6,0x28,0xCA,0x28,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x6E,0x51,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,
-	0x6E,0x51,0x4B,0x49,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x0B,0x39,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x0B,0x39,0xED,0x28,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xAB,0x10,0xCA,0x28,0xAB,0x10,0xCA,0x28,0xAB,0x10,0xCA,0x28,0x68,0x18,0x6B,0x10,0xCA,0x28,0xCA,0x28,
-	0x6B,0x10,0xCA,0x28,0xCA,0x28,0x6D,0x18,0xCA,0x28,0x6D,0x18,0xED,0x28,0xED,0x28,0x31,0x31,0x0E,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x0E,0x41,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,0xED,0x28,0xAD,0x18,0xAD,0x18,0x6D,0x18,0xAB,0x10,0xAD,0x18,0x6B,0x10,
-	0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x69,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x28,0x08,0x28,0x00,0x28,0x08,0x27,0x00,0x27,0x00,0x67,0x00,0x26,0x00,0x67,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x2C,0x00,0x6E,0x08,
-	0x6E,0x08,0x71,0x08,0x72,0x08,0x75,0x00,0x75,0x10,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xFB,0x18,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x1E,0x11,0x3E,0x19,0x7E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xDF,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x31,0x5E,0x31,0x5E,0x29,0x5C,0x29,0x5E,0x31,
-	0x5C,0x31,0x5C,0x31,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x5E,0x31,0x7D,0x41,0xDE,0x49,0xDD,0x49,0xDD,0x49,0x3C,0x6A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x3F,0x5A,0xFE,0x51,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,
-	0xAB,0x10,0x8E,0x31,0x74,0x41,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x3D,0x5A,0x19,0x52,0x9B,0x5A,0x19,0x52,0x19,0x52,0x14,0x4A,0x51,0x41,0xED,0x28,0xAD,0x18,0x6A,0x08,0x68,0x08,0x67,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x6B,0x08,0xCD,0x00,0x31,0x09,0xF1,0x20,0xF1,0x20,0x34,0x19,0x34,0x19,0x34,0x19,0xD3,0x10,
-	0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAB,0x10,0x68,0x08,0x66,0x08,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x24,0x08,0x43,0x10,0x65,0x10,0x66,0x10,0xC6,0x28,0xCA,0x28,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x90,0x61,0x4B,0x49,0x90,0x61,0x90,0x61,
-	0x90,0x61,0x90,0x61,0x90,0x61,0x6E,0x51,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x0B,0x39,0x0E,0x41,0x0B,0x39,0x0B,0x39,0xED,0x28,0x0B,0x39,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,
-	0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0xA8,0x18,0x68,0x18,0x6B,0x10,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x6D,0x18,0xED,0x28,0xED,0x28,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x31,0x31,
-	0x0E,0x41,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,0xED,0x28,0xAD,0x18,0xED,0x28,0x6D,0x18,0xAD,0x18,0x6D,0x18,0x6D,0x18,0x6B,0x10,0x6D,0x18,0x6D,0x18,0x6B,0x10,0x6B,0x08,0x6B,0x10,0x6B,0x08,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6A,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x69,0x00,0x68,0x08,0x68,0x00,
-	0x67,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x28,0x00,0x69,0x00,0x2A,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0xB3,0x08,0x75,0x00,0x75,0x10,0x75,0x10,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x10,0xFC,0x10,0x3C,0x11,
-	0x3E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x29,0xDF,0x31,0x5E,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0x7D,0x41,0xDD,0x49,
-	0xDD,0x49,0x3D,0x5A,0xBF,0x6A,0xBF,0x6A,0x3F,0x7B,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0x19,0x52,0xB1,0x49,0x4A,0x29,0xC5,0x18,0x68,0x18,0xED,0x28,0x8E,0x31,0x14,0x4A,0x77,0x41,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x9B,0x5A,0x3D,0x5A,0x19,0x52,0x19,0x52,0x19,0x52,0x74,0x41,0x31,0x31,
-	0xAD,0x18,0xAB,0x10,0x69,0x08,0x67,0x08,0x67,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x6B,0x00,0xAD,0x18,0xD1,0x18,0xF1,0x20,0x34,0x19,0xF1,0x20,0x34,0x19,0xF1,0x20,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAB,0x10,0x68,0x08,0x67,0x08,0x26,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x43,0x10,0x65,0x10,0x65,0x10,0xC6,0x28,0xC6,0x28,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x90,0x61,0x4B,0x49,0x90,0x61,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x90,0x61,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x6E,0x51,0x4B,0x49,
-	0x6E,0x51,0x4B,0x49,0x0E,0x41,0x4B,0x49,0x0E,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xA8,0x18,0xCA,0x28,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0xA8,0x18,0x68,0x18,0x68,0x18,
-	0x68,0x18,0x68,0x18,0x68,0x18,0xCA,0x28,0xAB,0x10,0xAB,0x10,0xCA,0x28,0xCA,0x28,0xED,0x28,0x0E,0x41,0x8E,0x31,0x0E,0x41,0x0E,0x41,0x31,0x31,0x0E,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x18,0xED,0x28,0xAD,0x18,0xAD,0x18,0xAD,0x18,0x6D,0x18,0xAD,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,
-	0x6D,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,0x6D,0x18,0xAD,0x18,0x6D,0x18,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x68,0x00,0x68,0x00,0x67,0x00,0x26,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x2A,0x00,0x6B,0x00,0x2C,0x00,
-	0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0xB3,0x08,0x75,0x10,0xD7,0x08,0xD7,0x18,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x3C,0x11,0x7E,0x19,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x5E,0x31,
-	0x5C,0x31,0xDE,0x49,0x3F,0x42,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0x5E,0x31,0x7D,0x41,0x7D,0x41,0xDC,0x59,0x3D,0x5A,0xBF,0x6A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0x3C,0x4A,0xB1,0x49,0x4A,0x29,0xC5,0x18,
-	0x68,0x08,0xAB,0x10,0xED,0x28,0x51,0x41,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x9B,0x5A,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x14,0x4A,0x13,0x29,0xF1,0x20,0xAD,0x18,0x69,0x08,0x68,0x08,0x68,0x08,0x67,0x08,0x67,0x00,0x28,0x00,0x69,0x00,0x6B,0x00,0xAD,0x18,0xAF,0x18,0xF1,0x20,0x72,0x09,0xF1,0x20,0x34,0x19,
-	0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0x27,0x08,0x26,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x43,0x10,0x43,0x10,0x65,0x10,0x65,0x10,0xC6,0x28,0xC6,0x28,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x90,0x61,
-	0x4B,0x49,0x6E,0x51,0x4B,0x49,0x90,0x61,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,
-	0xCA,0x28,0xA8,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0xC6,0x28,0x68,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0x66,0x10,0x68,0x18,0x68,0x18,0xA8,0x18,0xCA,0x28,0x6B,0x10,0xCA,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0xED,0x28,0x31,0x31,0xED,0x28,0xED,0x28,0xED,0x28,
-	0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x6D,0x18,0x6D,0x18,0xED,0x28,0x6D,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0x6D,0x18,0x6D,0x18,0xAD,0x18,0x6F,0x10,0x6F,0x10,0x6F,0x10,0x6F,0x10,0xD1,0x18,0xAF,0x18,0xD1,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0x6B,0x08,0x6A,0x08,
-	0x69,0x08,0x68,0x08,0x68,0x00,0x66,0x00,0x26,0x00,0x26,0x00,0x65,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x2C,0x00,0x6C,0x08,0x6E,0x08,0x71,0x08,0x71,0x08,0x72,0x08,0xB3,0x08,0xD5,0x08,0x75,0x10,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0x3E,0x19,
-	0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5C,0x29,0x5E,0x31,0x5C,0x31,0x5E,0x31,0xDE,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x5E,0x31,0x5E,0x31,0x7D,0x41,0x7D,0x41,0xDD,0x49,
-	0xDD,0x49,0x3F,0x5A,0xBF,0x6A,0xBF,0x6A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0x19,0x52,0xB1,0x49,0xA8,0x18,0xE3,0x18,0x26,0x08,0x68,0x08,0xAD,0x18,0x8E,0x31,0xB1,0x49,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x9B,0x5A,0x9B,0x5A,0x19,0x52,0x19,0x52,0x19,0x52,0x14,0x4A,
-	0x31,0x31,0xAD,0x18,0xAB,0x10,0x69,0x08,0x67,0x08,0x67,0x08,0x66,0x08,0x67,0x00,0x67,0x00,0x68,0x00,0xAB,0x00,0x2E,0x09,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x34,0x19,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAB,0x10,0x68,0x08,0x26,0x08,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x43,0x10,0x65,0x10,0x65,0x10,0xC6,0x28,0x48,0x39,0x48,0x39,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,
-	0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0x68,0x18,0xC6,0x28,0xC6,0x28,0x68,0x18,0xC6,0x28,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,
-	0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0x68,0x18,0xA8,0x18,0xAB,0x10,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x6D,0x18,0xED,0x28,0xED,0x28,0x6D,0x18,0xAD,0x18,0xAD,0x18,0x6D,0x18,0xAD,0x18,0x6D,0x18,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,
-	0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x13,0x29,0xD3,0x10,0x13,0x29,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAB,0x10,0x6B,0x08,0x6A,0x08,0x68,0x08,0x67,0x00,0x67,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x29,0x00,0x6A,0x00,0x6B,0x00,
-	0x2C,0x00,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB1,0x08,0x72,0x10,0xB3,0x08,0xD5,0x08,0x75,0x10,0xD5,0x08,0xD7,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xFB,0x18,0x3E,0x19,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5C,0x29,0x3E,0x19,0x5C,0x29,0x5E,0x31,
-	0xDE,0x49,0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0x3F,0x42,0xDE,0x49,0xDE,0x49,0xDE,0x49,0x5E,0x31,0x7D,0x41,0x7D,0x41,0x7D,0x41,0x7D,0x41,0xDD,0x49,0xDD,0x49,0x3D,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xDE,0x49,0x3C,0x4A,0xB1,0x49,0xC7,0x21,0xC5,0x18,
-	0x25,0x08,0x66,0x08,0xA8,0x18,0xED,0x28,0x31,0x31,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x9B,0x5A,0x19,0x52,0x19,0x52,0x14,0x4A,0x13,0x29,0xED,0x28,0xAB,0x10,0xA8,0x18,0x68,0x08,0x66,0x08,0x66,0x08,0x26,0x00,0x66,0x00,0x27,0x00,0x68,0x00,0x6A,0x08,0x2E,0x09,0xAF,0x18,0xF1,0x20,0xF1,0x20,
-	0x72,0x09,0xD1,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0x6A,0x08,0x67,0x08,0x26,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x43,0x10,0x43,0x10,0x65,0x10,0x83,0x20,0xC6,0x28,0x48,0x39,0x48,0x39,0x4B,0x49,0x4B,0x49,0x4B,0x49,
-	0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x4B,0x49,0x6E,0x51,0x4B,0x49,0x0B,0x39,0x4B,0x49,0x0B,0x39,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0xCA,0x28,0x0B,0x39,0xCA,0x28,0x48,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0x68,0x18,0xC6,0x28,0x68,0x18,
-	0xC6,0x28,0x68,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x10,0x66,0x10,0x26,0x08,0x65,0x10,0x66,0x10,0x65,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0x68,0x18,0x68,0x18,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,
-	0xED,0x28,0x6D,0x18,0xED,0x28,0x6D,0x18,0x6D,0x18,0x6D,0x18,0xAD,0x18,0x6D,0x18,0xAD,0x18,0x6F,0x10,0xAF,0x18,0xAF,0x18,0x70,0x10,0xD1,0x18,0xD1,0x18,0xD3,0x10,0xD3,0x10,0x13,0x29,0xD5,0x18,0x13,0x29,0x34,0x19,0x35,0x31,0x34,0x19,0x34,0x19,0x13,0x29,0x34,0x19,0xF1,0x20,0xF1,0x20,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,
-	0xAB,0x10,0x6A,0x08,0x69,0x08,0x68,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0xB1,0x08,0x71,0x08,0xB3,0x08,0xB3,0x08,0xD5,0x08,0x75,0x10,0x75,0x10,0xD9,0x08,0xD9,0x08,0xFB,0x18,0x3E,0x19,
-	0x5E,0x29,0x5E,0x29,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x31,0x5E,0x31,0xDE,0x49,0x3F,0x5A,0x3F,0x42,0x3F,0x5A,0xFE,0x51,0xDD,0x49,0xFE,0x51,0xDE,0x49,0xDE,0x49,0x5E,0x31,0x7D,0x41,0x7D,0x41,0x5C,0x31,0x5C,0x31,0x7D,0x41,0xDD,0x49,
-	0xDD,0x49,0x3D,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0x7F,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0xFE,0x51,0x19,0x52,0x51,0x41,0xC6,0x28,0xE3,0x18,0x24,0x00,0x25,0x00,0x67,0x00,0xA8,0x18,0x8E,0x31,0x51,0x41,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x9B,0x5A,0x19,0x52,0x9B,0x5A,0x19,0x52,0x19,0x52,0x19,0x52,
-	0x14,0x4A,0x31,0x31,0xAD,0x18,0xAB,0x10,0x68,0x08,0x67,0x08,0x66,0x08,0x66,0x08,0x65,0x00,0x25,0x00,0x26,0x00,0x68,0x00,0x6A,0x08,0xAD,0x18,0x2E,0x09,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0x68,0x08,0x66,0x08,0x25,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x83,0x20,0x65,0x10,0x66,0x10,0xC6,0x28,0x48,0x39,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x0B,0x39,
-	0x0B,0x39,0x0B,0x39,0x0B,0x39,0x48,0x39,0xCA,0x28,0x48,0x39,0xCA,0x28,0x48,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x68,0x18,0xC6,0x28,0x66,0x10,0xC6,0x28,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x10,0x66,0x10,0x65,0x10,0x25,0x08,0x25,0x08,0x25,0x08,0x65,0x10,0x25,0x08,0x65,0x10,0x25,0x08,
-	0x65,0x08,0x65,0x10,0x65,0x08,0x66,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0xA8,0x18,0xAB,0x10,0xCA,0x28,0xCA,0x28,0xED,0x28,0xCA,0x28,0xED,0x28,0xAD,0x18,0x6D,0x18,0xED,0x28,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0x6D,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x13,0x29,0x13,0x29,0x35,0x31,
-	0x37,0x19,0x35,0x31,0x37,0x19,0x35,0x31,0x37,0x19,0x35,0x31,0x37,0x19,0x35,0x31,0x34,0x19,0x34,0x19,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0x6C,0x08,0xAB,0x10,0x69,0x08,0x68,0x08,0x67,0x00,0x26,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,
-	0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0xB1,0x08,0x72,0x10,0xB3,0x08,0x72,0x08,0xD5,0x08,0xD7,0x08,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x31,0xBD,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x31,0x5E,0x31,
-	0xDE,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xDE,0x49,0xDD,0x49,0xDE,0x49,0xDE,0x49,0x7D,0x41,0x7D,0x41,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x7D,0x41,0x7A,0x41,0xDD,0x49,0x3D,0x5A,0xBF,0x5A,0xBF,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0xFE,0x51,0xDE,0x49,0x19,0x52,0x51,0x41,0x46,0x21,0xE3,0x18,
-	0x23,0x08,0x24,0x08,0x25,0x00,0x67,0x08,0xAB,0x10,0x8E,0x31,0xB1,0x49,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x14,0x4A,0x31,0x31,0xED,0x28,0xAB,0x10,0x69,0x08,0x67,0x08,0x66,0x08,0x25,0x08,0x65,0x08,0x25,0x00,0x25,0x00,0x26,0x00,0x67,0x00,0xCA,0x00,0xAD,0x18,0xAF,0x18,
-	0xF1,0x20,0xAF,0x18,0xF1,0x20,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0x69,0x08,0x67,0x08,0x25,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x23,0x08,0x43,0x10,0x83,0x20,0xC6,0x28,0xC6,0x28,0x48,0x39,0x48,0x39,0x0B,0x39,
-	0x4B,0x49,0x4B,0x49,0x0B,0x39,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x48,0x39,0x0B,0x39,0x48,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x68,0x18,0xC6,0x28,0x66,0x10,0x66,0x10,
-	0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x25,0x08,0x65,0x10,0x25,0x08,0x65,0x10,0x65,0x10,0x24,0x08,0x24,0x08,0x65,0x10,0x64,0x08,0x65,0x10,0x64,0x08,0x64,0x08,0x25,0x08,0x65,0x08,0x66,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0xA8,0x18,0xCA,0x28,0xCA,0x28,0xAD,0x18,0xCA,0x28,0xAD,0x18,0xAD,0x18,0xCA,0x28,
-	0xED,0x28,0x6D,0x18,0xED,0x28,0x6D,0x18,0xED,0x28,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD3,0x10,0x13,0x29,0x35,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x19,0x21,0x78,0x31,0x78,0x31,0x78,0x31,0x19,0x21,0x37,0x19,0x37,0x19,0xD5,0x18,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0x6C,0x08,
-	0xAB,0x00,0x6B,0x08,0x6A,0x08,0x69,0x08,0x68,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6A,0x00,0x6B,0x08,0x6B,0x00,0x6C,0x08,0x6C,0x08,0xCF,0x08,0x6E,0x08,0xB1,0x08,0x71,0x08,0x72,0x08,0x75,0x10,0x75,0x10,0xD7,0x18,0xD9,0x08,0xFB,0x18,0x5C,0x29,
-	0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0xBD,0x29,0x5E,0x31,0xBD,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x31,0x7D,0x41,0x3F,0x42,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0x3F,0x42,0xDD,0x49,0xDD,0x49,0xDE,0x49,0x7D,0x41,0xBD,0x39,0x7D,0x41,0x5C,0x31,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x5C,0x31,
-	0xDD,0x49,0x3D,0x5A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0xBF,0x5A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0x3F,0x42,0xFE,0x51,0x19,0x52,0x8E,0x31,0x46,0x21,0xC5,0x18,0x23,0x08,0x24,0x08,0x24,0x00,0x25,0x00,0x68,0x08,0xAB,0x10,0x8E,0x31,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,
-	0x19,0x52,0x14,0x4A,0xF1,0x20,0xAD,0x18,0xA8,0x18,0x68,0x08,0x67,0x08,0x66,0x08,0x64,0x00,0x24,0x00,0x65,0x00,0x25,0x00,0x25,0x00,0x67,0x00,0xCA,0x00,0xCD,0x00,0xAF,0x18,0x2E,0x09,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0x6A,0x08,0x67,0x08,0x26,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x43,0x10,0x65,0x10,0x65,0x10,0xC6,0x28,0xC6,0x28,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x0B,0x39,0x48,0x39,0x0B,0x39,0x48,0x39,0x4B,0x49,0x0B,0x39,0x4B,0x49,0x0B,0x39,0x48,0x39,0x0B,0x39,0x0B,0x39,0x48,0x39,0x0B,0x39,0x0B,0x39,
-	0x48,0x39,0xCA,0x28,0x48,0x39,0x48,0x39,0xCA,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x68,0x18,0xC6,0x28,0x66,0x10,0x66,0x10,0xC6,0x28,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x25,0x08,0x64,0x08,0x24,0x08,0x24,0x08,0x65,0x10,0x24,0x08,0x24,0x08,0x65,0x10,0x24,0x08,0x24,0x08,0x64,0x08,0x24,0x08,
-	0x64,0x08,0x64,0x08,0x64,0x08,0x24,0x08,0x65,0x08,0x65,0x08,0x66,0x08,0x66,0x10,0x66,0x10,0x68,0x18,0xA8,0x18,0xCA,0x28,0xCA,0x28,0xED,0x28,0xAD,0x18,0x6D,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x13,0x29,0x35,0x31,0x37,0x19,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,
-	0x19,0x21,0x19,0x21,0x19,0x21,0x78,0x31,0x19,0x21,0x37,0x19,0x35,0x31,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0x6F,0x10,0xAF,0x18,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x67,0x00,0x66,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x28,0x00,
-	0x69,0x00,0x6A,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0xB1,0x08,0x71,0x08,0xB3,0x08,0x75,0x10,0xD7,0x18,0x19,0x21,0x3B,0x19,0x5C,0x29,0x5E,0x29,0x5C,0x29,0xBD,0x29,0x5C,0x31,0xBD,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x19,0x21,0x19,0x21,0x19,0x21,0xFB,0x18,0x19,0x21,0xFB,0x18,0x5C,0x31,0xDE,0x49,
-	0x3F,0x42,0x3F,0x5A,0x3F,0x42,0xFE,0x51,0xFE,0x51,0xDE,0x49,0xDD,0x49,0xDD,0x49,0xBD,0x39,0x7D,0x41,0x7A,0x41,0x7A,0x41,0x5C,0x31,0x7A,0x41,0x5C,0x31,0x7A,0x41,0xDD,0x49,0x3D,0x5A,0x3F,0x5A,0x7F,0x6A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0xFE,0x51,0xDE,0x49,0x19,0x52,0x51,0x41,0x46,0x21,0xE3,0x18,
-	0x22,0x08,0x63,0x08,0x23,0x08,0x24,0x00,0x66,0x08,0xA8,0x18,0xED,0x28,0x31,0x31,0x14,0x4A,0x19,0x52,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x14,0x4A,0x51,0x41,0xED,0x28,0xAB,0x10,0x68,0x18,0x67,0x08,0x26,0x08,0x65,0x08,0x24,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x67,0x00,0xCA,0x00,
-	0xAD,0x18,0xAD,0x18,0x2E,0x09,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0x68,0x08,0x26,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x65,0x10,0x83,0x20,0x65,0x10,0xC6,0x28,0xC6,0x28,0xC6,0x28,
-	0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x0B,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x0B,0x39,0x48,0x39,0x48,0x39,0x0B,0x39,0x48,0x39,0x4A,0x29,0x48,0x39,0x48,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,
-	0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x24,0x08,0x65,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x24,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x25,0x08,0x65,0x08,0x66,0x08,0x66,0x10,0x68,0x18,0x68,0x18,0xA8,0x18,0x6B,0x10,0xCA,0x28,0xAD,0x18,0xED,0x28,
-	0x6D,0x18,0xED,0x28,0x6F,0x10,0xAF,0x18,0x70,0x10,0xF1,0x20,0x13,0x29,0x13,0x29,0x37,0x19,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x5C,0x31,0x19,0x21,0x5C,0x31,0x19,0x21,0x78,0x31,0x19,0x21,0xD7,0x18,0x37,0x19,0xD7,0x18,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,0x70,0x10,0xAF,0x18,0xCF,0x08,0x6D,0x18,0x6C,0x08,
-	0x6B,0x08,0x6B,0x08,0x6A,0x08,0x69,0x08,0x69,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x68,0x00,0x69,0x00,0x6A,0x08,0x6A,0x00,0x6B,0x08,0x6C,0x08,0xCD,0x00,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x08,0xD3,0x10,0xD7,0x18,0x19,0x21,0x19,0x21,0x5C,0x29,
-	0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x5C,0x31,0xDE,0x49,0xFE,0x51,0x3F,0x42,0xFE,0x51,0x3F,0x42,0xFE,0x51,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,
-	0x7A,0x41,0x3D,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0x3F,0x42,0xDD,0x49,0x19,0x52,0x8E,0x31,0x46,0x21,0xE3,0x18,0x22,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x24,0x08,0x66,0x00,0xA8,0x18,0xED,0x28,0x51,0x41,0x14,0x4A,0x14,0x4A,0x19,0x52,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,
-	0x19,0x52,0x14,0x4A,0x14,0x4A,0x8E,0x31,0xAD,0x18,0xAB,0x10,0x68,0x08,0x66,0x08,0x65,0x08,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x26,0x00,0x27,0x00,0xA8,0x00,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xCD,0x00,0xAD,0x18,0xAB,0x10,0x69,0x08,0x67,0x08,0x25,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x65,0x10,0x65,0x10,0x65,0x10,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xCA,0x28,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x0B,0x39,0x48,0x39,0x0B,0x39,0x0B,0x39,0x48,0x39,0x0B,0x39,0x4A,0x29,0x48,0x39,0x48,0x39,
-	0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x64,0x08,0x24,0x08,0x43,0x10,0x24,0x08,0x23,0x08,0x24,0x08,0x43,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x23,0x08,
-	0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x67,0x08,0x68,0x18,0x68,0x18,0x68,0x18,0x6B,0x10,0xAD,0x18,0xAD,0x18,0xED,0x28,0xAF,0x18,0x70,0x10,0xF1,0x20,0x13,0x29,0x13,0x29,0x37,0x19,0x78,0x31,0x78,0x31,0x78,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x78,0x31,0x5C,0x31,0x19,0x21,
-	0x19,0x21,0x19,0x21,0x19,0x21,0xD7,0x18,0x35,0x31,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xAF,0x18,0x6F,0x10,0x6D,0x18,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x69,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x66,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x67,0x00,
-	0x68,0x00,0x68,0x08,0x69,0x08,0x69,0x08,0x6A,0x00,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x70,0x10,0xD3,0x10,0xD5,0x18,0x37,0x19,0x19,0x21,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x19,0x21,0x19,0x21,0x39,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0xD7,0x18,0x19,0x21,0x19,0x21,0x5C,0x31,0xDE,0x49,
-	0x3F,0x42,0xFE,0x51,0x3F,0x42,0xFE,0x51,0xDE,0x49,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x7A,0x41,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0xDD,0x49,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x42,0xFE,0x51,0xDD,0x49,0x19,0x52,0x31,0x31,0x46,0x21,0x46,0x21,
-	0x43,0x10,0x22,0x08,0x62,0x08,0x23,0x08,0x64,0x00,0x25,0x08,0x67,0x08,0xA8,0x18,0x8E,0x31,0x51,0x41,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x19,0x52,0x14,0x4A,0x31,0x31,0xED,0x28,0xAB,0x10,0x68,0x08,0x67,0x08,0x65,0x08,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,
-	0x27,0x00,0x69,0x00,0xCA,0x00,0xAD,0x18,0xCD,0x00,0xAD,0x18,0xAB,0x10,0xCA,0x00,0x69,0x08,0x68,0x08,0x66,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x65,0x10,0x83,0x20,0xC6,0x28,
-	0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x4A,0x29,0x48,0x39,0x48,0x39,0xCA,0x28,0xC6,0x28,0x48,0x39,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x43,0x10,
-	0x24,0x08,0x43,0x10,0x23,0x08,0x43,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x64,0x08,0x25,0x08,0x65,0x08,0x66,0x10,0x26,0x08,0x66,0x10,0x68,0x18,0x68,0x18,0x6B,0x10,0xAD,0x18,0xAD,0x18,
-	0xAF,0x18,0xAF,0x18,0xF1,0x20,0x13,0x29,0x13,0x29,0x78,0x31,0x78,0x31,0x7A,0x41,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x5C,0x31,0x19,0x21,0x5C,0x31,0x19,0x21,0x78,0x31,0x19,0x21,0x19,0x21,0xD7,0x18,0x35,0x31,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,0x70,0x10,0x6F,0x10,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,
-	0x6A,0x08,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x66,0x00,0x67,0x00,0x27,0x00,0x67,0x00,0x68,0x00,0x68,0x08,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0xD1,0x18,0xD3,0x10,0xD5,0x18,0x37,0x19,0x19,0x21,0x19,0x21,
-	0x19,0x21,0x78,0x31,0x19,0x21,0x78,0x31,0x19,0x21,0x37,0x19,0x37,0x19,0x37,0x19,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0xD7,0x18,0x19,0x21,0x7A,0x41,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xDE,0x49,0xFE,0x51,0xDD,0x49,0xDD,0x49,0x7A,0x41,0x7A,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x19,0x21,
-	0x78,0x31,0x7A,0x41,0xDD,0x49,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x3F,0x42,0xFE,0x51,0xFE,0x51,0xDE,0x49,0xDD,0x49,0x77,0x41,0x8E,0x31,0x4A,0x29,0xE3,0x18,0x43,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x63,0x08,0x24,0x00,0x25,0x00,0x67,0x00,0xAB,0x10,0x8E,0x31,0xB1,0x49,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,
-	0x19,0x52,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x31,0x31,0xAB,0x10,0xA8,0x18,0x68,0x08,0x66,0x08,0x65,0x08,0x24,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x68,0x00,0xA8,0x00,0xAB,0x10,0xAB,0x00,0xAB,0x10,0xAB,0x10,0xCA,0x00,0x68,0x08,0x67,0x08,0x25,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x43,0x10,0x43,0x10,0x65,0x10,0x65,0x10,0xC6,0x28,0x83,0x20,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,
-	0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xA7,0x18,0x66,0x10,0xC6,0x28,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x43,0x10,0x65,0x10,0x23,0x08,0x43,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x00,
-	0x22,0x08,0x22,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x25,0x08,0x65,0x08,0x66,0x08,0x67,0x08,0x27,0x08,0x28,0x08,0x68,0x18,0x6B,0x10,0x6B,0x10,0x6D,0x18,0xAF,0x18,0xF1,0x20,0x13,0x29,0x35,0x31,0x19,0x21,0x78,0x31,0x7A,0x41,0x5C,0x31,0x7A,0x41,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,
-	0x19,0x21,0x35,0x31,0xD7,0x18,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD1,0x18,0x70,0x10,0x70,0x10,0x6F,0x10,0x6E,0x08,0x6D,0x18,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x00,0x69,0x08,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,
-	0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x6B,0x00,0x6C,0x08,0x6E,0x08,0xD1,0x18,0xD3,0x10,0xD5,0x18,0xD5,0x18,0x37,0x19,0x78,0x31,0x19,0x21,0x19,0x21,0x19,0x21,0x37,0x19,0x37,0x19,0x37,0x19,0xD5,0x18,0xD5,0x18,0x34,0x19,0xD3,0x10,0xD5,0x18,0xD5,0x18,0xD7,0x18,0x78,0x31,0x7A,0x41,0xDD,0x49,
-	0x3C,0x4A,0xDE,0x49,0x3C,0x4A,0xDE,0x49,0x3C,0x4A,0x7A,0x41,0x7A,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x74,0x41,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x37,0x19,0x78,0x31,0xDD,0x49,0xFE,0x51,0x3F,0x5A,0x3F,0x42,0xFE,0x51,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xDD,0x49,0x77,0x41,0x8E,0x31,0x46,0x21,0x46,0x21,
-	0x43,0x10,0x43,0x10,0x62,0x08,0x22,0x00,0x63,0x08,0x63,0x08,0x24,0x08,0x25,0x00,0x68,0x08,0xAB,0x10,0x8E,0x31,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x19,0x52,0x19,0x52,0x19,0x52,0x14,0x4A,0x14,0x4A,0x31,0x31,0xED,0x28,0x6B,0x10,0x67,0x08,0x66,0x08,0x65,0x08,0x64,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x24,0x00,0x25,0x00,0x67,0x00,0xA8,0x00,0x6A,0x08,0xAB,0x00,0xAB,0x10,0x69,0x08,0xA8,0x18,0x67,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x43,0x10,0x23,0x08,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x83,0x20,0x65,0x10,0xC5,0x18,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xA7,0x18,0xC6,0x28,0xA7,0x18,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x24,0x08,0x43,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x08,0x24,0x08,0x24,0x08,0x26,0x08,0x66,0x08,0x27,0x08,0x68,0x08,0x68,0x18,0x29,0x08,0x6B,0x10,0x6D,0x18,0x6F,0x10,
-	0xF1,0x20,0xD3,0x10,0x35,0x31,0x35,0x31,0x78,0x31,0x7A,0x41,0x7A,0x41,0x5C,0x31,0x5C,0x31,0x5C,0x29,0x5C,0x31,0x78,0x31,0x19,0x21,0x78,0x31,0x37,0x19,0x35,0x31,0x37,0x19,0xD5,0x18,0x13,0x29,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xD1,0x18,0x6F,0x10,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x00,0x6A,0x08,
-	0x6A,0x00,0x69,0x00,0x29,0x08,0x69,0x00,0x68,0x00,0x69,0x00,0x68,0x08,0x68,0x00,0x67,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x66,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x6B,0x08,0x6E,0x08,0x6F,0x10,0xD1,0x18,0xD3,0x10,0xD5,0x18,0x37,0x19,0x37,0x19,
-	0x37,0x19,0x37,0x19,0x37,0x19,0x37,0x19,0x34,0x19,0x34,0x19,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD1,0x18,0x72,0x10,0xD3,0x10,0xD5,0x18,0x37,0x19,0x7A,0x41,0xDD,0x49,0xDD,0x49,0x3D,0x5A,0xDD,0x49,0xDD,0x49,0x3C,0x4A,0x7A,0x41,0x77,0x41,0x35,0x31,0x74,0x41,0x51,0x41,0x13,0x29,0x13,0x29,0x31,0x31,0xF1,0x20,0xF1,0x20,0x72,0x10,
-	0xD3,0x10,0x35,0x31,0x78,0x31,0xDD,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xDE,0x49,0xDD,0x49,0xDD,0x49,0x9A,0x49,0x74,0x41,0x8E,0x31,0xC6,0x28,0xE3,0x18,0x43,0x10,0x43,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x63,0x00,0x65,0x08,0x66,0x08,0x68,0x08,0xAD,0x18,0x8E,0x31,0x14,0x4A,0x14,0x4A,0x77,0x41,0x14,0x4A,
-	0x19,0x52,0x19,0x52,0x19,0x52,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xAB,0x10,0x68,0x18,0x66,0x08,0x65,0x08,0x65,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x68,0x08,0x69,0x08,0x69,0x08,0xA8,0x18,0x68,0x08,0x67,0x08,0x66,0x08,0x25,0x08,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x43,0x10,0x65,0x10,0x43,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,
-	0x65,0x10,0x43,0x10,0x65,0x10,0x43,0x10,0x24,0x08,0x43,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x08,0x24,0x00,0x25,0x08,0x66,0x08,0x26,0x08,0x67,0x08,0x28,0x08,0x29,0x08,0x6A,0x08,0x6D,0x18,0x6D,0x18,0x6F,0x10,0xF1,0x20,0x13,0x29,0x35,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x5C,0x29,0x7A,0x41,0x5C,0x29,0x78,0x31,0x19,0x21,0x19,0x21,0x19,0x21,0xD7,0x18,0x35,0x31,0xD5,0x18,
-	0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0x6F,0x10,0x6E,0x08,0x6F,0x10,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x2C,0x08,0x6B,0x08,0x2A,0x00,0x2A,0x00,0x69,0x00,0x29,0x00,0x69,0x00,0x69,0x00,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x00,0x67,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,
-	0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x6A,0x08,0x6B,0x08,0x6C,0x08,0xAF,0x18,0xD1,0x18,0xD3,0x10,0x13,0x29,0x34,0x19,0x35,0x31,0x34,0x19,0x13,0x29,0x34,0x19,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xCF,0x08,0x70,0x10,0x70,0x10,0xD5,0x18,0x35,0x31,0x7A,0x41,0xDD,0x49,
-	0x3C,0x4A,0xDD,0x49,0xDD,0x49,0x3C,0x4A,0x7A,0x41,0x77,0x41,0x35,0x31,0x74,0x41,0x13,0x29,0x31,0x31,0x31,0x31,0xED,0x28,0xED,0x28,0xAF,0x18,0x6F,0x10,0xAF,0x18,0x70,0x10,0xD3,0x10,0x35,0x31,0x7A,0x41,0xDD,0x49,0xDD,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0xDD,0x49,0xDD,0x49,0x19,0x52,0x74,0x41,0xED,0x28,0x46,0x21,0xE3,0x18,
-	0x65,0x10,0x43,0x10,0x62,0x08,0x62,0x08,0x22,0x08,0x62,0x08,0x22,0x08,0x64,0x08,0x24,0x08,0x66,0x00,0x68,0x08,0xAD,0x18,0x8E,0x31,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x19,0x52,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x31,0x31,0xED,0x28,0xA8,0x18,0x67,0x08,0x65,0x08,0x24,0x08,0x24,0x00,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x26,0x00,0x67,0x00,0xA8,0x00,0xA8,0x18,0x67,0x08,0xA7,0x18,0x66,0x08,0x65,0x08,0x64,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x43,0x10,
-	0x43,0x10,0x23,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x24,0x08,0x43,0x10,0x23,0x08,0x43,0x10,0x23,0x08,0x43,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x08,0x25,0x00,0x27,0x08,0x27,0x08,0x29,0x08,0x6A,0x08,0x2C,0x08,0x6D,0x18,0xAF,0x18,0xF1,0x20,
-	0x13,0x29,0x35,0x31,0x78,0x31,0x19,0x21,0x78,0x31,0x19,0x21,0x78,0x31,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x37,0x19,0x35,0x31,0x34,0x19,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xD1,0x18,0x6F,0x10,0x6F,0x10,0x6F,0x10,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x2C,0x08,0x6B,0x08,0x2A,0x08,0x2A,0x00,0x2A,0x00,0x6A,0x00,
-	0x29,0x00,0x29,0x00,0x69,0x00,0x28,0x00,0x68,0x00,0x69,0x00,0x68,0x08,0x68,0x00,0x67,0x08,0x66,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x6A,0x08,0x6B,0x08,0x6D,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x34,0x19,0xF1,0x20,
-	0x34,0x19,0xF1,0x20,0xD1,0x18,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xCD,0x00,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6F,0x10,0xD3,0x10,0x35,0x31,0x7A,0x41,0x3C,0x4A,0xDD,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x77,0x41,0x77,0x41,0x35,0x31,0x13,0x29,0x51,0x41,0x8E,0x31,0xED,0x28,0xAD,0x18,0xAB,0x10,0x6B,0x10,0x6B,0x10,0x6D,0x18,
-	0x6D,0x18,0x70,0x10,0x13,0x29,0x35,0x31,0x9A,0x49,0xDD,0x49,0xDC,0x59,0x3C,0x4A,0xDD,0x49,0x9A,0x49,0x9A,0x49,0x77,0x41,0x74,0x41,0x4A,0x29,0x46,0x21,0xE3,0x18,0x65,0x10,0x43,0x10,0x43,0x10,0x62,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x63,0x08,0x64,0x08,0x24,0x00,0x66,0x08,0xA8,0x18,0xAD,0x18,0x8E,0x31,0x14,0x4A,0x14,0x4A,
-	0x14,0x4A,0x19,0x52,0x19,0x52,0x14,0x4A,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xAB,0x10,0x67,0x08,0x66,0x08,0x65,0x08,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x66,0x08,0x66,0x08,0x67,0x08,0x66,0x10,0x66,0x10,0x65,0x08,0x24,0x08,0x23,0x08,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x22,0x10,0x23,0x08,0x22,0x08,0x43,0x10,0x23,0x08,0x43,0x10,0x23,0x08,0x43,0x10,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,
-	0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x08,0x24,0x00,0x25,0x00,0x66,0x08,0x27,0x08,0x28,0x08,0x29,0x08,0x6B,0x08,0x6D,0x18,0xD1,0x18,0xD1,0x18,0x13,0x29,0x35,0x31,0x37,0x19,0x35,0x31,0x78,0x31,0x19,0x21,0x19,0x21,0x19,0x21,0x19,0x21,0x37,0x19,0x37,0x19,0x37,0x19,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD1,0x18,
-	0xD1,0x18,0x70,0x10,0x6F,0x10,0x6F,0x10,0x6F,0x10,0x6E,0x08,0x6C,0x08,0x6D,0x18,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x08,0x2A,0x08,0x2A,0x00,0x2A,0x00,0x29,0x00,0x69,0x00,0x29,0x00,0x68,0x00,0x68,0x00,0x28,0x08,0x68,0x00,0x68,0x00,0x67,0x08,0x27,0x00,0x66,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x28,0x00,0x69,0x00,0x6A,0x08,0xCD,0x00,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xF1,0x20,0xD1,0x18,0xF1,0x20,0xAF,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xCD,0x00,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6F,0x10,0xD1,0x18,0x35,0x31,0x77,0x41,0x7A,0x41,
-	0x19,0x52,0x7A,0x41,0x19,0x52,0x78,0x31,0x74,0x41,0x35,0x31,0x51,0x41,0x31,0x31,0x8E,0x31,0xED,0x28,0xAB,0x10,0x6B,0x10,0x68,0x18,0x69,0x08,0x69,0x08,0x6B,0x10,0x6D,0x18,0x6D,0x18,0x70,0x10,0x13,0x29,0x35,0x31,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x19,0x52,0x19,0x52,0x77,0x41,0x74,0x41,0x31,0x31,0x4A,0x29,0xC6,0x28,0xE3,0x18,
-	0x83,0x20,0x65,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x63,0x08,0x63,0x08,0x24,0x00,0x65,0x00,0xA8,0x18,0x2E,0x09,0x31,0x31,0x35,0x31,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x77,0x41,0x14,0x4A,0x14,0x4A,0x31,0x31,0xED,0x28,0xA8,0x18,0x66,0x08,0x65,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x65,0x08,0x66,0x08,0x66,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x23,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x43,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x08,0x25,0x00,0x26,0x00,0x28,0x08,0x69,0x08,0x6B,0x08,0x6F,0x10,0xAF,0x18,0xD3,0x10,0x13,0x29,0x35,0x31,
-	0x35,0x31,0x35,0x31,0x19,0x21,0x35,0x31,0x37,0x19,0x35,0x31,0x37,0x19,0x37,0x19,0x37,0x19,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0x70,0x10,0xAF,0x18,0x6F,0x10,0x6E,0x08,0x6C,0x08,0x6D,0x18,0x2C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x08,0x2A,0x08,0x69,0x08,0x2A,0x00,0x29,0x00,
-	0x29,0x00,0x29,0x00,0x29,0x00,0x68,0x00,0x68,0x00,0x68,0x08,0x68,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x68,0x08,0x6A,0x08,0x6B,0x08,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,
-	0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0x6A,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x69,0x00,0x69,0x08,0x6B,0x08,0x6C,0x08,0xAF,0x18,0x13,0x29,0x77,0x41,0x19,0x52,0x7A,0x41,0x77,0x41,0x78,0x31,0x14,0x4A,0x35,0x31,0xB1,0x49,0x31,0x31,0x8E,0x31,0xAD,0x18,0xAB,0x10,0x68,0x18,0x27,0x08,0x27,0x08,0x27,0x08,0x67,0x08,0x67,0x08,
-	0x69,0x08,0x6B,0x10,0x6D,0x18,0xAF,0x18,0x13,0x29,0x35,0x31,0x77,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x74,0x41,0x74,0x41,0x8E,0x31,0xCA,0x28,0x46,0x21,0xE3,0x18,0xC5,0x18,0x65,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x21,0x08,0x21,0x00,0x22,0x08,0x22,0x00,0x62,0x00,0x23,0x00,0x64,0x00,0x66,0x08,0xA8,0x18,0x8E,0x31,0x8E,0x31,
-	0x14,0x4A,0x14,0x4A,0x77,0x41,0x14,0x4A,0x74,0x41,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xCA,0x28,0x67,0x08,0x66,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x64,0x08,0x65,0x08,0x65,0x10,0x64,0x08,0x24,0x08,0x23,0x00,
-	0x22,0x08,0x22,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x43,0x10,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,
-	0x23,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x25,0x00,0x26,0x00,0x67,0x08,0x29,0x08,0x6B,0x08,0xAD,0x18,0xAF,0x18,0xF1,0x20,0x13,0x29,0x35,0x31,0x35,0x31,0x35,0x31,0x37,0x19,0x35,0x31,0x37,0x19,0x37,0x19,0xD5,0x18,0xD5,0x18,0x13,0x29,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xAF,0x18,
-	0x6F,0x10,0x6F,0x10,0x6F,0x10,0x6C,0x08,0x2C,0x08,0x2C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x2A,0x08,0x2A,0x08,0x6A,0x00,0x29,0x08,0x29,0x00,0x69,0x00,0x29,0x00,0x29,0x00,0x69,0x00,0x28,0x08,0x68,0x00,0x28,0x00,0x68,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x67,0x00,0x68,0x08,0x69,0x08,0x6A,0x08,0x6B,0x08,0xCD,0x00,0xAD,0x18,0xCD,0x00,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0x69,0x08,0x68,0x08,0x67,0x08,0x67,0x08,0x26,0x08,0x27,0x00,0x27,0x00,0x28,0x08,0x69,0x08,0x6A,0x08,0xAF,0x18,0x31,0x31,0x74,0x41,0x77,0x41,
-	0x35,0x31,0x14,0x4A,0x35,0x31,0x74,0x41,0x31,0x31,0x8E,0x31,0xED,0x28,0xAB,0x10,0x68,0x18,0x66,0x08,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x08,0x25,0x08,0x65,0x08,0x27,0x08,0x29,0x08,0x2A,0x08,0x6D,0x18,0x6D,0x18,0xD1,0x18,0xF1,0x20,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0xAD,0x18,0xC6,0x28,0xE3,0x18,0xE3,0x18,
-	0xC6,0x28,0x83,0x20,0x65,0x10,0x43,0x10,0x22,0x10,0x62,0x08,0x21,0x08,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x66,0x08,0xA8,0x00,0xED,0x28,0x31,0x31,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x14,0x4A,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xAD,0x18,0xA8,0x18,0x66,0x08,0x66,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x62,0x08,0x23,0x08,0x22,0x08,
-	0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x22,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x22,0x08,0x63,0x08,0x23,0x00,0x63,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x26,0x08,0x67,0x08,0x29,0x08,0x6B,0x10,0xAD,0x18,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,
-	0x37,0x19,0x35,0x31,0xD5,0x18,0x13,0x29,0xD5,0x18,0x13,0x29,0x34,0x19,0xD3,0x10,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0x70,0x10,0xAF,0x18,0x6F,0x10,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x2C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x08,0x2A,0x08,0x2A,0x08,0x2A,0x08,0x69,0x08,0x29,0x08,0x29,0x00,0x69,0x00,0x29,0x00,
-	0x29,0x00,0x68,0x08,0x29,0x08,0x68,0x00,0x68,0x08,0x68,0x00,0x68,0x08,0x67,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x67,0x08,0x68,0x08,0x69,0x08,0xCA,0x00,0x6B,0x10,0x6B,0x08,0x6B,0x08,0xCA,0x00,0x68,0x08,
-	0xA8,0x00,0x67,0x08,0x66,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x66,0x08,0x66,0x08,0x68,0x08,0x69,0x08,0x6B,0x10,0xAF,0x18,0x31,0x31,0x31,0x31,0x31,0x31,0x13,0x29,0x31,0x31,0xF1,0x20,0x2E,0x09,0xAB,0x10,0x2A,0x01,0x68,0x08,0x66,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,
-	0x26,0x00,0x67,0x08,0x68,0x08,0x29,0x08,0x2A,0x08,0x6B,0x10,0x6D,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xA8,0x18,0xC5,0x18,0xE3,0x18,0x46,0x21,0xC6,0x28,0x65,0x10,0x83,0x20,0x43,0x10,0x43,0x10,0x22,0x08,0x62,0x08,0x62,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x66,0x08,0xA8,0x00,
-	0x4A,0x29,0x31,0x31,0xB1,0x49,0x74,0x41,0x14,0x4A,0x14,0x4A,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xA8,0x18,0xA8,0x18,0x66,0x08,0x65,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x08,0x23,0x08,0x22,0x00,
-	0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x63,0x08,0x22,0x08,0x23,0x00,0x62,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x00,0x23,0x08,
-	0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x67,0x08,0x69,0x08,0xAB,0x10,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x34,0x19,0x13,0x29,0xD3,0x10,0xD3,0x10,0xF1,0x20,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xAF,0x18,0x6F,0x10,0xAF,0x18,0x6E,0x08,0x6F,0x10,
-	0x6D,0x18,0x6C,0x08,0x6D,0x18,0x6C,0x08,0x2C,0x08,0x6B,0x08,0x2A,0x08,0x6B,0x08,0x2A,0x08,0x6A,0x00,0x2A,0x00,0x6A,0x08,0x69,0x08,0x69,0x08,0x29,0x08,0x69,0x08,0x69,0x00,0x69,0x08,0x68,0x08,0x28,0x00,0x68,0x08,0x28,0x08,0x67,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x67,0x00,0x68,0x08,0x69,0x08,0x69,0x08,0xA8,0x00,0x69,0x08,0x67,0x08,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x25,0x00,0x25,0x00,0x66,0x08,0x66,0x08,0x67,0x08,0x68,0x08,0xAB,0x10,0xAB,0x10,0xAD,0x18,
-	0xED,0x28,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xA8,0x18,0x67,0x08,0x66,0x08,0x65,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x66,0x08,0x26,0x08,0x67,0x08,0x67,0x08,0x27,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0xA7,0x18,0x68,0x18,0xA7,0x18,0xC5,0x18,0xE3,0x18,0x46,0x21,
-	0x48,0x39,0xC6,0x28,0x65,0x10,0x65,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x62,0x08,0x62,0x08,0x21,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x23,0x00,0x65,0x00,0xA8,0x18,0x2E,0x09,0x31,0x31,0xB1,0x49,0x14,0x4A,0x51,0x41,0x14,0x4A,0xB1,0x49,0x8E,0x31,0xED,0x28,0xA8,0x18,0x67,0x08,0x66,0x08,0x65,0x00,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x08,
-	0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x22,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x63,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x25,0x00,0x26,0x08,0x68,0x18,0xAB,0x10,0xAD,0x18,0xED,0x28,0x31,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x35,0x31,0x13,0x29,0x13,0x29,
-	0x13,0x29,0x34,0x19,0x13,0x29,0xF1,0x20,0xD3,0x10,0xF1,0x20,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xCF,0x08,0x6F,0x10,0x6F,0x10,0x6F,0x10,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x2C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x08,0x6A,0x00,0x29,0x08,0x2A,0x00,0x29,0x08,0x29,0x00,0x69,0x00,0x69,0x00,0x69,0x00,
-	0x29,0x08,0x68,0x00,0x28,0x08,0x68,0x08,0x28,0x08,0x67,0x00,0x67,0x00,0x26,0x00,0x65,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x25,0x00,
-	0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x67,0x08,0xA8,0x00,0xA8,0x18,0xA8,0x00,0xA7,0x18,0x67,0x08,0x66,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x65,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x65,0x08,0x65,0x08,0x66,0x08,0x66,0x08,0x64,0x08,0xE3,0x18,0xE3,0x18,0x46,0x21,0x4B,0x49,0xC6,0x28,0x65,0x10,0x83,0x20,0x43,0x10,0x43,0x10,0x43,0x10,0x62,0x08,0x22,0x08,0x62,0x08,0x22,0x08,0x21,0x08,0x22,0x00,0x22,0x00,0x23,0x00,0x64,0x00,
-	0xA7,0x00,0xA8,0x18,0x8E,0x31,0x31,0x31,0x31,0x31,0x14,0x4A,0x51,0x41,0xB1,0x49,0x8E,0x31,0x8E,0x31,0xAB,0x10,0xA8,0x18,0x66,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x63,0x00,0x23,0x00,0x23,0x08,0x63,0x00,0x23,0x08,0x23,0x00,0x63,0x08,0x22,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x63,0x08,
-	0x23,0x00,0x63,0x08,0x23,0x00,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x24,0x00,0x25,0x08,0x68,0x08,0x6B,0x10,0xAD,0x18,0xF1,0x20,0x31,0x31,0x31,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x34,0x19,0x13,0x29,0x34,0x19,0x13,0x29,0xD3,0x10,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xD1,0x18,0x6F,0x10,0xAF,0x18,0x6F,0x10,0x6E,0x08,0xAD,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,
-	0x6D,0x18,0x6C,0x08,0x2C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x08,0x2A,0x00,0x6A,0x08,0x2A,0x08,0x29,0x00,0x69,0x08,0x69,0x00,0x29,0x08,0x69,0x08,0x28,0x00,0x68,0x00,0x68,0x08,0x68,0x08,0x68,0x00,0x67,0x08,0x67,0x00,0x26,0x00,0x66,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x66,0x08,
-	0x66,0x08,0x66,0x08,0x66,0x08,0x65,0x08,0x65,0x08,0x64,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x63,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x63,0x08,0xA2,0x10,0xE3,0x18,0x46,0x21,
-	0xCA,0x59,0x48,0x39,0xC6,0x28,0x83,0x20,0x65,0x10,0x43,0x10,0x23,0x08,0x43,0x10,0x63,0x08,0x62,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0xA7,0x00,0xAB,0x10,0xED,0x28,0x8E,0x31,0xB1,0x49,0xB1,0x49,0x8E,0x31,0xB1,0x49,0x8E,0x31,0x8E,0x31,0xA8,0x18,0x68,0x08,0x66,0x08,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x63,0x00,0x23,0x08,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x08,0x23,0x08,0x24,0x00,0x64,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x24,0x00,0x24,0x00,0x24,0x08,0x24,0x00,0x23,0x08,0x63,0x00,0x22,0x08,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x08,0x67,0x08,0x69,0x08,0xAB,0x10,0xED,0x28,0xF1,0x20,0x31,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x34,0x19,0x13,0x29,0x13,0x29,
-	0xF1,0x20,0xD1,0x18,0xF1,0x20,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0x6F,0x10,0xAF,0x18,0x6E,0x08,0x6C,0x08,0x6D,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x00,0x2A,0x08,0x6A,0x00,0x6A,0x08,0x6A,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x68,0x00,
-	0x68,0x00,0x28,0x00,0x68,0x00,0x27,0x00,0x67,0x00,0x27,0x00,0x66,0x00,0x26,0x00,0x25,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x64,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0xA2,0x10,0xE3,0x18,0x46,0x21,0xCA,0x59,0x4B,0x49,0x48,0x39,0xC6,0x28,0x65,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x62,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x00,0x22,0x00,0x62,0x00,
-	0x63,0x00,0x24,0x00,0x66,0x00,0xCA,0x00,0xAD,0x18,0x8E,0x31,0x8E,0x31,0x14,0x4A,0x8E,0x31,0x8E,0x31,0x8E,0x31,0xED,0x28,0xA8,0x18,0x67,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x24,0x00,0x24,0x08,0x23,0x08,0x23,0x00,0x24,0x00,0x64,0x08,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x64,0x08,0x24,0x08,
-	0x24,0x00,0x64,0x08,0x64,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x08,0x25,0x00,0x67,0x08,0xAB,0x10,0xAD,0x18,0xAF,0x18,0x31,0x31,0xF1,0x20,0x31,0x31,0x13,0x29,0xF1,0x20,0x13,0x29,0xF1,0x20,0x34,0x19,0xF1,0x20,0xD3,0x10,0xF1,0x20,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xCF,0x08,0x6C,0x08,0x6D,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,
-	0x6C,0x08,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6B,0x00,0x6A,0x08,0x2A,0x00,0x6A,0x08,0x2A,0x00,0x69,0x00,0x29,0x08,0x69,0x00,0x29,0x00,0x68,0x00,0x28,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x08,0x64,0x08,
-	0xA4,0x08,0x64,0x08,0x64,0x08,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x62,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0x62,0x08,0x63,0x08,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0xE3,0x18,0xE3,0x18,0x46,0x21,
-	0xCA,0x59,0xCA,0x59,0x4B,0x49,0x48,0x39,0x65,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x25,0x00,0x66,0x00,0xA8,0x18,0x2E,0x09,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x8E,0x31,0xAB,0x10,0x68,0x08,0x66,0x08,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x08,0x63,0x00,0x23,0x08,0x23,0x00,0x23,0x08,
-	0x23,0x08,0x24,0x00,0x24,0x08,0x24,0x08,0x24,0x00,0x24,0x08,0x64,0x08,0x24,0x00,0x24,0x08,0x64,0x08,0x24,0x08,0x64,0x08,0x24,0x00,0x24,0x08,0x24,0x08,0x64,0x08,0x24,0x08,0x24,0x00,0x64,0x08,0x64,0x08,0x63,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x08,0x66,0x08,0x68,0x08,0xAB,0x10,0xED,0x28,0xED,0x28,0xF1,0x20,0x31,0x31,0xF1,0x20,0x13,0x29,0xF1,0x20,0x34,0x19,0xF1,0x20,0xF1,0x20,0xF1,0x20,
-	0xF1,0x20,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0x6F,0x10,0xCF,0x08,0x6D,0x18,0x6E,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x00,0x6B,0x00,0x6A,0x00,0x2A,0x00,0x6A,0x08,0x6A,0x00,0x6A,0x08,0x29,0x00,0x69,0x00,0x69,0x08,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,
-	0x28,0x00,0x68,0x00,0x67,0x00,0x27,0x00,0x66,0x00,0x26,0x00,0x66,0x00,0x25,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x63,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x08,0x62,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0x62,0x08,0xA3,0x00,0x62,0x08,0x62,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0xE3,0x18,0x46,0x21,0x46,0x21,0x4B,0x49,0xCA,0x59,0x4B,0x49,0x48,0x39,0xC6,0x28,0x65,0x10,0x65,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x00,0x21,0x00,0x61,0x00,
-	0x22,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x66,0x00,0x68,0x08,0xAB,0x10,0x8E,0x31,0x8E,0x31,0x51,0x41,0x2D,0x3A,0x8E,0x31,0xED,0x28,0xA8,0x18,0x66,0x08,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x24,0x00,0x24,0x00,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x64,0x08,0x24,0x08,0x24,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x64,0x08,0x24,0x08,0x65,0x08,0x65,0x08,0x25,0x08,
-	0x65,0x08,0x65,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x64,0x08,0x67,0x08,0xA8,0x18,0xAD,0x18,0xED,0x28,0xF1,0x20,0x31,0x31,0xF1,0x20,0x13,0x29,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xD3,0x10,0xF1,0x20,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0x6F,0x10,0xCF,0x08,0x6D,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6C,0x08,0x6B,0x08,0x2C,0x08,0x6B,0x00,
-	0x6B,0x08,0x2A,0x00,0x6B,0x00,0x6A,0x08,0x2A,0x08,0x6A,0x08,0x2A,0x00,0x29,0x08,0x29,0x00,0x69,0x08,0x69,0x00,0x29,0x08,0x68,0x00,0x28,0x00,0x68,0x08,0x28,0x00,0x67,0x08,0x67,0x00,0x67,0x08,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,
-	0x63,0x08,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x08,0xA3,0x00,0xA2,0x10,0x62,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x62,0x08,0xE3,0x18,0x46,0x21,0x46,0x21,
-	0x48,0x39,0xCA,0x59,0xCA,0x59,0x4B,0x49,0x48,0x39,0xC6,0x28,0x65,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x26,0x00,0x68,0x08,0xAB,0x10,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x8E,0x31,0xAB,0x10,0xA8,0x18,0x66,0x08,
-	0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x08,0x23,0x00,0x23,0x08,0x24,0x00,0x64,0x08,
-	0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x65,0x08,0x25,0x08,0x24,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x65,0x08,0x24,0x08,0x64,0x08,0x23,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x65,0x08,0x67,0x08,0xAB,0x10,0xED,0x28,0xED,0x28,0xF1,0x20,0xF1,0x20,0x31,0x31,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,
-	0xD1,0x18,0xAF,0x18,0xAF,0x18,0x6F,0x10,0xAF,0x18,0x6D,0x18,0xCD,0x00,0x6C,0x08,0x6D,0x18,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x00,0x6B,0x08,0x2A,0x08,0x6A,0x00,0x6A,0x08,0x2A,0x00,0x2A,0x08,0x69,0x00,0x29,0x08,0x69,0x00,0x29,0x08,0x69,0x00,0x28,0x08,0x68,0x08,0x28,0x00,0x67,0x00,
-	0x67,0x00,0x27,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x24,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x08,0x63,0x08,0x64,0x08,0x63,0x08,0xA4,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x08,0x62,0x08,0xA2,0x10,0xA2,0x10,0x62,0x08,0x62,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x62,0x08,0xE3,0x18,0x46,0x21,0x46,0x21,0x48,0x39,0x4B,0x49,0xCA,0x59,0xCA,0x59,0x4B,0x49,0x48,0x39,0xC5,0x18,0x65,0x10,0x43,0x10,0x23,0x08,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x67,0x00,0xA8,0x18,0xED,0x28,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x4A,0x29,0xAB,0x10,0xA7,0x18,0x65,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x23,0x08,0x64,0x00,0x64,0x08,0x24,0x08,0x64,0x08,0x24,0x08,0x65,0x08,0x24,0x08,0x65,0x08,0x65,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x08,0x66,0x08,0x66,0x08,
-	0x66,0x10,0x66,0x08,0x65,0x08,0x65,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,
-	0x23,0x00,0x65,0x08,0x68,0x18,0xAB,0x10,0xED,0x28,0xF1,0x20,0x31,0x31,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xD1,0x18,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xCF,0x08,0xAD,0x18,0x6E,0x08,0x6D,0x18,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6C,0x08,0x6B,0x08,0x2C,0x00,0x6B,0x08,0x6B,0x00,0x2A,0x08,
-	0x6B,0x08,0x6A,0x00,0x6A,0x00,0x2A,0x08,0x6A,0x00,0x6A,0x08,0x2A,0x00,0x29,0x08,0x69,0x00,0x29,0x08,0x69,0x00,0x69,0x08,0x68,0x00,0x68,0x00,0x68,0x00,0x28,0x08,0x67,0x00,0x67,0x08,0x67,0x00,0x66,0x08,0x66,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0xA2,0x10,0x63,0x08,0x63,0x08,0x62,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x08,0xA2,0x10,0xA3,0x00,0x62,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0xA2,0x10,0xE3,0x18,0x46,0x21,0x46,0x21,
-	0xC5,0x18,0x48,0x39,0xCA,0x59,0x2D,0x3A,0xCA,0x59,0x48,0x39,0xC6,0x28,0x65,0x10,0x65,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0x4A,0x29,0x4A,0x29,0x8E,0x31,0xED,0x28,0x4A,0x29,0xA8,0x18,
-	0x66,0x08,0x65,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x64,0x08,0x64,0x08,0x24,0x00,0x24,0x08,
-	0x25,0x08,0x25,0x08,0x65,0x10,0x65,0x08,0x65,0x10,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x08,0x65,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x66,0x10,0x66,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x08,0x64,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x08,0x65,0x08,0xA8,0x18,0xAB,0x10,0xAD,0x18,0xED,0x28,0xED,0x28,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,
-	0xAF,0x18,0xAF,0x18,0x6F,0x10,0xAD,0x18,0x6E,0x08,0xAD,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x2A,0x08,0x6A,0x00,0x2A,0x00,0x6A,0x08,0x2A,0x00,0x6A,0x08,0x2A,0x00,0x6A,0x08,0x69,0x00,0x69,0x00,0x69,0x08,0x69,0x00,0x29,0x08,0x69,0x00,0x68,0x08,0x68,0x08,0x68,0x00,0x67,0x00,
-	0x27,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x63,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0xA4,0x08,0x64,0x08,0x63,0x08,0x63,0x08,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,
-	0x62,0x00,0x62,0x08,0xA2,0x10,0xA3,0x00,0xA2,0x10,0xA2,0x10,0x62,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x60,0x00,0xA2,0x10,0xE3,0x18,0x48,0x39,0xE3,0x18,0x43,0x10,0xC6,0x28,0x48,0x39,0xCA,0x59,0x4B,0x49,0xCA,0x59,0x48,0x39,0xC6,0x28,0x65,0x10,0x43,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x61,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x65,0x08,0xA8,0x18,0xAB,0x10,0xAD,0x18,0x4A,0x29,0x4A,0x29,0xAB,0x10,0xA7,0x18,0x66,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x08,0x24,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x25,0x08,0x65,0x10,0x65,0x08,0x65,0x10,0x25,0x08,0x65,0x08,0x65,0x10,0x26,0x08,0x66,0x10,0x66,0x08,0x66,0x10,0x66,0x08,0x66,0x10,0x66,0x08,0x66,0x10,0x66,0x10,
-	0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x08,0x64,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,
-	0x24,0x00,0x66,0x08,0xA8,0x18,0xAB,0x10,0xAD,0x18,0xED,0x28,0xF1,0x20,0xAF,0x18,0xF1,0x20,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xCF,0x08,0xAD,0x18,0x6E,0x08,0xAD,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x2A,0x08,0x6A,0x00,0x2A,0x08,
-	0x6A,0x00,0x2A,0x08,0x6A,0x00,0x69,0x08,0x6A,0x00,0x69,0x08,0x69,0x00,0x29,0x00,0x69,0x00,0x29,0x08,0x68,0x00,0x68,0x08,0x68,0x00,0x68,0x08,0x67,0x00,0x27,0x00,0x67,0x08,0x67,0x00,0x67,0x08,0x66,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0xA4,0x08,0xA4,0x08,0xA2,0x10,0x63,0x08,0x62,0x08,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xE3,0x18,0xA2,0x10,0x62,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x46,0x21,0x46,0x21,0xE3,0x18,
-	0x21,0x08,0x65,0x10,0xC6,0x28,0x48,0x39,0x4B,0x49,0xCA,0x59,0x4A,0x29,0x48,0x39,0xC6,0x28,0x43,0x10,0x23,0x08,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x64,0x00,0x65,0x00,0xA7,0x00,0xA8,0x18,0x4A,0x29,0xED,0x28,0x4A,0x29,
-	0xA8,0x18,0xA7,0x18,0x65,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x24,0x08,0x65,0x08,
-	0x24,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x65,0x08,0x65,0x10,0x66,0x08,0x66,0x10,0x66,0x08,0x66,0x10,0x66,0x10,0x66,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x64,0x08,0x24,0x08,0x23,0x08,0x22,0x08,0x22,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x65,0x08,0xA8,0x18,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xED,0x28,0xAF,0x18,0xED,0x28,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,0xAF,0x18,
-	0xAD,0x18,0x6D,0x18,0x6E,0x08,0xAD,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x2A,0x08,0x6A,0x00,0x6A,0x08,0x6A,0x00,0x69,0x08,0x6A,0x00,0x69,0x08,0x69,0x00,0x29,0x08,0x69,0x00,0x29,0x00,0x69,0x08,0x28,0x00,0x69,0x08,0x68,0x00,0x68,0x08,0x68,0x08,0x68,0x00,0x28,0x00,0x67,0x08,
-	0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x64,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0xA4,0x08,0xC5,0x18,0xA4,0x08,0xA2,0x10,0x64,0x08,0x62,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,
-	0xA2,0x10,0xE3,0x18,0xA2,0x10,0xA3,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x46,0x21,0x46,0x21,0xE3,0x18,0x00,0x00,0x22,0x10,0x65,0x10,0xC6,0x28,0x48,0x39,0x4B,0x49,0xCA,0x59,0x48,0x39,0xC6,0x28,0xC5,0x18,0x43,0x10,0x23,0x08,0x62,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x61,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x65,0x00,0x66,0x08,0xA8,0x18,0xA8,0x18,0x4A,0x29,0x4A,0x29,0xA8,0x18,0xA7,0x18,0x64,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x25,0x00,0x64,0x08,0x25,0x08,0x65,0x08,0x65,0x10,0x25,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x66,0x10,0x66,0x10,0x66,0x08,0x66,0x10,0xA7,0x18,0x66,0x08,0xA7,0x18,0xA7,0x18,0x68,0x08,
-	0xA7,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x65,0x08,0x64,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
-	0x24,0x00,0x25,0x08,0x67,0x08,0xA8,0x18,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xAF,0x18,0xED,0x28,0xAF,0x18,0xAF,0x18,0xED,0x28,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAF,0x18,0xAD,0x18,0xCD,0x00,0xAD,0x18,0x6C,0x08,0xAD,0x18,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x00,0x6A,0x08,0x6A,0x08,0x6A,0x00,0x29,0x08,
-	0x69,0x00,0x69,0x08,0x69,0x00,0x69,0x08,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x08,0x28,0x00,0x68,0x08,0x68,0x00,0x68,0x08,0x67,0x00,0x67,0x00,0x27,0x00,0x67,0x00,0x27,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0xA4,0x08,0xC5,0x18,0xC5,0x18,0x65,0x10,0x64,0x08,0x63,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0xA4,0x08,0xC5,0x18,0x23,0x09,0xC5,0x18,0x23,0x09,0x61,0x08,0x61,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0xA2,0x10,0xE3,0x18,0x46,0x21,0x48,0x39,0x60,0x08,
-	0x00,0x00,0x21,0x00,0x22,0x10,0x65,0x10,0x46,0x21,0x48,0x39,0x4A,0x29,0xCA,0x59,0x48,0x39,0xC6,0x28,0x65,0x10,0x43,0x10,0x22,0x08,0x62,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0xA7,0x18,0xA8,0x18,
-	0x4A,0x29,0x4A,0x29,0xA7,0x18,0x66,0x08,0x24,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x25,0x08,
-	0x65,0x08,0x26,0x08,0x66,0x08,0x65,0x08,0x66,0x10,0x65,0x08,0x66,0x10,0x67,0x08,0x66,0x10,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA7,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0x66,0x10,0x65,0x08,0x64,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x63,0x08,0x63,0x08,0x23,0x00,0x23,0x00,0x63,0x00,0x63,0x00,
-	0x23,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x65,0x08,0x67,0x08,0xA8,0x18,0xA8,0x18,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAF,0x18,0xAD,0x18,0xAF,0x18,0xAD,0x18,0xAF,0x18,0xAD,0x18,0xAF,0x18,0xAD,0x18,
-	0xAD,0x18,0xCD,0x00,0xAD,0x18,0x6C,0x08,0xAD,0x18,0x6C,0x08,0x6C,0x08,0x6C,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x6A,0x00,0x6A,0x08,0x69,0x00,0x69,0x08,0x69,0x08,0x69,0x00,0x69,0x08,0x29,0x08,0x68,0x00,0x68,0x08,0x68,0x00,0x28,0x08,0x67,0x00,0x68,0x00,0x27,0x00,0x67,0x00,0x67,0x08,
-	0x67,0x00,0x66,0x08,0x66,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,
-	0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0xC5,0x18,0xA4,0x08,0xC5,0x18,0xA4,0x08,0x64,0x08,0x63,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x46,0x21,
-	0x46,0x21,0xE3,0x18,0xA2,0x10,0xA1,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0xE3,0x18,0x83,0x20,0x46,0x21,0x46,0x21,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x08,0x43,0x10,0x83,0x20,0xC6,0x28,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0xC5,0x18,0x43,0x10,0x63,0x08,0x62,0x08,0x22,0x08,0x21,0x08,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x66,0x08,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA7,0x18,0x65,0x10,0x23,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x08,0x23,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x65,0x10,0x66,0x10,0x65,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA7,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,
-	0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x65,0x10,0x64,0x08,0x63,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x64,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
-	0x23,0x00,0x24,0x00,0x66,0x08,0x67,0x08,0xA8,0x18,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xCD,0x00,0xAD,0x18,0x6C,0x08,0xAD,0x18,0x6B,0x08,0x6C,0x08,0xAB,0x10,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x00,0x6A,0x08,0x6A,0x08,0x69,0x00,0x6A,0x08,0x69,0x08,
-	0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x00,0x69,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x67,0x00,0x67,0x08,0x67,0x00,0x67,0x08,0x66,0x00,0x66,0x00,0x66,0x08,0x65,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x08,0x64,0x08,0x64,0x08,0xA4,0x08,0xC5,0x18,0x65,0x08,0xC5,0x18,0xA4,0x08,0x63,0x08,0x63,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x08,0x46,0x21,0x46,0x21,0xC5,0x18,0xE3,0x18,0xA1,0x00,0xA1,0x00,0x61,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x46,0x21,0x46,0x21,0x48,0x39,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x23,0x08,0x65,0x10,0xC6,0x28,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0xC5,0x18,0x43,0x10,0x22,0x08,0x22,0x08,0x62,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x65,0x08,0xA7,0x18,0xA7,0x18,0x46,0x21,0xA7,0x18,0xC5,0x18,0x23,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x65,0x08,0x65,0x08,
-	0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xCA,0x28,0xA8,0x18,0x4A,0x29,0xA8,0x18,0x4A,0x29,0xA7,0x18,0xC5,0x18,0x65,0x10,0x64,0x08,0x63,0x08,0x63,0x08,0x64,0x00,0x23,0x08,0x64,0x08,0x64,0x08,0x63,0x00,0x63,0x00,
-	0x63,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x65,0x08,0x66,0x08,0x67,0x08,0xA8,0x18,0xAB,0x10,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,
-	0xAD,0x18,0xAB,0x10,0xAD,0x18,0xAB,0x00,0xAB,0x10,0xAD,0x18,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x00,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x67,0x00,0x27,0x00,0x67,0x08,0x66,0x00,0x66,0x08,0x66,0x00,
-	0x66,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0xA4,0x08,
-	0xA4,0x08,0xC5,0x18,0xC5,0x18,0xC5,0x18,0xA4,0x08,0x64,0x08,0x63,0x08,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x23,0x09,0xC5,0x18,0x46,0x21,0x46,0x21,0x46,0x21,0x23,0x09,
-	0xA3,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x46,0x21,0x48,0x39,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x43,0x10,0x43,0x10,0xC6,0x28,0x48,0x39,0x48,0x39,0x48,0x39,0xC6,0x28,0xC5,0x18,0x43,0x10,0x22,0x08,0x22,0x08,
-	0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x64,0x08,0x65,0x08,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x65,0x10,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x08,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x18,0xA8,0x18,0xA7,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0x4A,0x29,0xCA,0x28,0x4A,0x29,
-	0xCA,0x28,0x4A,0x29,0x4A,0x29,0xA8,0x18,0xC6,0x28,0xA7,0x18,0x65,0x10,0x64,0x08,0x23,0x08,0x63,0x08,0x64,0x08,0x24,0x00,0x64,0x00,0x23,0x08,0x64,0x00,0x23,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x24,0x00,0x24,0x08,0x65,0x08,0x66,0x08,0x68,0x08,0xA8,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x00,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x00,0xAB,0x10,0xAB,0x10,0x6B,0x08,0x6B,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,
-	0x69,0x08,0x69,0x08,0x69,0x08,0x68,0x00,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x67,0x00,0x67,0x08,0x67,0x08,0x26,0x00,0x66,0x08,0x26,0x00,0x65,0x00,0x25,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,
-	0x62,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x08,0xA4,0x08,0xC5,0x18,0xA4,0x08,0xC5,0x18,0xA4,0x08,0x64,0x08,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0x46,0x21,0x84,0x09,0x46,0x21,0x84,0x09,0xE3,0x18,0xE3,0x18,0x61,0x08,0x60,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0x46,0x21,0x48,0x39,0x60,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x43,0x10,0x46,0x21,0x48,0x39,0x48,0x39,0x48,0x39,0xC6,0x28,0x65,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x23,0x00,0x64,0x08,0x65,0x10,0x65,0x10,0xC5,0x18,0x64,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x10,0x65,0x08,0x65,0x08,
-	0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xCA,0x28,0x4A,0x29,0xA8,0x18,0x4A,0x29,0xCA,0x28,0x4A,0x29,0xCA,0x28,0x4A,0x29,0x4A,0x29,0xC6,0x28,0xA7,0x18,0xC5,0x18,0x64,0x08,0x63,0x08,0x63,0x08,0x23,0x00,0x64,0x08,0x63,0x00,0x64,0x08,0x64,0x00,0x63,0x08,
-	0x64,0x00,0x63,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x66,0x08,0x67,0x08,0x68,0x08,0xA8,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,
-	0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x67,0x08,0x67,0x00,0x67,0x08,0x67,0x08,0x66,0x08,0x66,0x08,0x66,0x00,0x65,0x00,0x65,0x00,0x25,0x00,
-	0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,
-	0xA4,0x08,0xC5,0x18,0xA4,0x08,0x64,0x08,0x63,0x08,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0x23,0x09,0x84,0x09,0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0xE3,0x18,0x62,0x00,
-	0x61,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0xA2,0x10,0x46,0x21,0x46,0x21,0x46,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x43,0x10,0xC6,0x28,0xC7,0x21,0x48,0x39,0x48,0x39,0xC5,0x18,0x43,0x10,0x22,0x08,
-	0x22,0x08,0x22,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x08,0x65,0x08,0x65,0x10,0xC5,0x18,0x63,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x08,0x64,0x08,0x64,0x08,0x65,0x10,0x65,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x18,0x68,0x18,0xC6,0x28,0xA8,0x18,0xA8,0x18,0x4A,0x29,0xCA,0x28,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,
-	0xCA,0x28,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xC6,0x28,0xC5,0x18,0x65,0x10,0x63,0x08,0x23,0x08,0x64,0x08,0x64,0x08,0x24,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x67,0x08,0x67,0x08,0x68,0x08,0xA8,0x18,0xA8,0x18,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xA8,0x18,0xAB,0x10,0x69,0x08,0x69,0x08,0x69,0x08,0xA8,0x18,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,
-	0x68,0x08,0x68,0x08,0x68,0x00,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x26,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,
-	0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0x63,0x08,0x63,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA3,0x00,0x23,0x09,0x46,0x21,0x46,0x21,0x46,0x21,0x84,0x09,0xC5,0x18,0xE3,0x18,0xA3,0x00,0x61,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x60,0x00,0x61,0x08,0xE3,0x18,0x83,0x20,0x46,0x21,0x46,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x43,0x10,0xC5,0x18,0xC6,0x28,0x48,0x39,0x46,0x21,0xC5,0x18,0x64,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x08,0x64,0x08,0x65,0x10,0x63,0x08,0x62,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x63,0x00,0x23,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x65,0x10,0x66,0x10,0x65,0x10,
-	0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x18,0x66,0x10,0xA7,0x18,0xA8,0x18,0xA8,0x18,0xCA,0x28,0xCA,0x28,0x4A,0x29,0x4A,0x29,0xCA,0x28,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xA8,0x18,0x46,0x21,0xA7,0x18,0xC5,0x18,0x63,0x08,0x63,0x08,0x64,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,
-	0x63,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x65,0x08,0x66,0x08,0x66,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0xA8,0x18,0xA8,0x18,0xA8,0x18,
-	0xA8,0x18,0x68,0x08,0xA8,0x18,0x68,0x08,0xA8,0x18,0xA8,0x18,0x68,0x08,0xA8,0x18,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x66,0x08,0x66,0x08,0x66,0x00,0x66,0x08,0x26,0x00,0x65,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xC5,0x18,0xA4,0x08,
-	0xA4,0x08,0x64,0x08,0x63,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0x23,0x09,0x46,0x21,0x46,0x21,0x46,0x21,0x84,0x09,0xC5,0x18,0x23,0x09,0xA3,0x00,0x62,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0xA2,0x10,0xE3,0x18,0x46,0x21,0x48,0x39,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x43,0x10,0xC5,0x18,0xC6,0x28,0x48,0x39,0xC6,0x28,0xC5,0x18,
-	0x63,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x08,0x63,0x08,0x63,0x08,0x22,0x08,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0x63,0x00,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x10,0x65,0x08,0xA7,0x18,0x66,0x10,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xC6,0x28,0xA8,0x18,0xA8,0x18,0xC6,0x28,0xCA,0x28,0xA8,0x18,0x4A,0x29,0xCA,0x28,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xED,0x28,
-	0x4A,0x29,0xED,0x28,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x46,0x21,0xC5,0x18,0x64,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x08,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x65,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x66,0x08,0x66,0x08,0x66,0x08,
-	0x66,0x08,0x66,0x08,0x65,0x08,0x65,0x00,0x65,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x25,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x61,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x63,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xC5,0x18,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xE3,0x18,0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0xE3,0x18,0x62,0x08,0x62,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0xA2,0x10,0x46,0x21,0x46,0x21,0x46,0x21,0x60,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x43,0x10,0x65,0x10,0x46,0x21,0x48,0x39,0xC6,0x28,0x65,0x10,0x63,0x08,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x08,0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x62,0x08,0x23,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x65,0x10,0xC5,0x18,0xA7,0x18,
-	0xA7,0x18,0xA7,0x18,0x66,0x10,0xA7,0x18,0xC6,0x28,0xA8,0x18,0xA8,0x18,0xA8,0x18,0x4A,0x29,0xCA,0x28,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xC6,0x28,0xC5,0x18,0xC5,0x18,0x64,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,
-	0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x24,0x00,0x24,0x00,0x23,0x08,0x64,0x08,0x24,0x00,
-	0x64,0x08,0x65,0x08,0x64,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x66,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA4,0x08,0x23,0x09,0xC5,0x18,0xA4,0x08,
-	0xA4,0x08,0x63,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0xA3,0x00,0x63,0x08,0x23,0x09,0x46,0x21,0x46,0x21,0x46,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0xA2,0x10,0xA3,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0xA1,0x00,0xE3,0x18,0x46,0x21,0x46,0x21,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x43,0x10,0xC6,0x28,0xC6,0x28,0x46,0x21,
-	0xC5,0x18,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0x65,0x10,0xC5,0x18,0x65,0x10,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA8,0x18,0xCA,0x28,0x4A,0x29,0xCA,0x28,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xED,0x28,0x4A,0x29,0x8E,0x31,0x4A,0x29,
-	0x8E,0x31,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xC7,0x21,0xA7,0x18,0xC5,0x18,0xA4,0x08,0x63,0x08,0x63,0x08,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0x23,0x09,0xA4,0x08,0xA4,0x08,0x23,0x09,0xA4,0x08,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x62,0x00,0x63,0x08,0x63,0x08,
-	0x63,0x08,0xA4,0x08,0xC5,0x18,0x46,0x21,0x46,0x21,0x46,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0xA2,0x10,0x62,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x48,0x39,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x43,0x10,0xC5,0x18,0xC6,0x28,0xC5,0x18,0xC5,0x18,0x63,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x08,0x43,0x10,0x43,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0xA7,0x18,0xC5,0x18,
-	0xA7,0x18,0xC6,0x28,0xA7,0x18,0xC6,0x28,0xC6,0x28,0xA8,0x18,0xC6,0x28,0xCA,0x28,0x4A,0x29,0xCA,0x28,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x46,0x21,0xA7,0x18,0x64,0x08,0xA4,0x08,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA3,0x00,0xA4,0x08,0x23,0x09,0xA4,0x08,0x23,0x09,0x23,0x09,0xA4,0x08,
-	0x23,0x09,0xA4,0x08,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x08,0x63,0x08,0xA4,0x08,0xC5,0x18,0x46,0x21,0x46,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0xA2,0x10,0x62,0x08,0x61,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x60,0x00,
-	0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x08,0xE3,0x18,0x46,0x21,0x46,0x21,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x22,0x08,0x21,0x08,0xA2,0x10,
-	0xC5,0x18,0xC5,0x18,0xA2,0x10,0x43,0x10,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x62,0x08,0x62,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0xA2,0x10,0x65,0x10,0xC5,0x18,0xC5,0x18,0x66,0x10,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xA8,0x18,0xC6,0x28,0xA8,0x18,0x4A,0x29,0xA8,0x18,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xED,0x28,0x4A,0x29,0x4A,0x29,0x8E,0x31,0x8E,0x31,
-	0x8E,0x31,0x2D,0x3A,0x8E,0x31,0x4A,0x29,0x2D,0x3A,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xC5,0x18,0xC5,0x18,0x64,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA4,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA4,0x08,0x23,0x09,0xA4,0x08,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x63,0x08,0xA2,0x10,0xC5,0x18,
-	0x46,0x21,0x46,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0xE3,0x18,0x62,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0x60,0x00,0x21,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0x62,0x08,0xA2,0x10,0xE3,0x18,0x46,0x21,0x46,0x21,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x62,0x08,0xA2,0x10,0xE3,0x18,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x62,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x83,0x20,0xC5,0x18,0x83,0x20,0xC6,0x28,0x83,0x20,0xC6,0x28,0xC6,0x28,
-	0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x4A,0x29,0xCA,0x28,0xCA,0x28,0x4A,0x29,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x0B,0x39,0x4A,0x29,0x8E,0x31,0x8E,0x31,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xA7,0x18,0xC5,0x18,0xA4,0x08,0xA4,0x08,0x63,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA1,0x00,0x62,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,
-	0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0x63,0x08,0xA2,0x10,0xA4,0x08,0x46,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0xC7,0x21,0x46,0x21,0xE3,0x18,0xA3,0x00,0x62,0x00,0x61,0x00,0x60,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x60,0x00,0x61,0x00,
-	0x60,0x00,0x60,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0xA2,0x10,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x46,0x21,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x62,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0xC6,0x28,0x83,0x20,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0xC6,0x28,0x4A,0x29,0xC6,0x28,0x4A,0x29,0xCA,0x28,0x4A,0x29,0x4A,0x29,0x0B,0x39,0x0B,0x39,0x4A,0x29,0x8E,0x31,0x8E,0x31,0x2D,0x3A,
-	0x8E,0x31,0x2D,0x3A,0x8E,0x31,0x8E,0x31,0x0B,0x39,0x2D,0x3A,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xA7,0x18,0xC5,0x18,0xA4,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0x62,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,
-	0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x23,0x09,0x84,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA1,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x08,0x63,0x08,0xA4,0x08,0x46,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,
-	0x46,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0xC5,0x18,0xA3,0x00,0x62,0x08,0x61,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0xA2,0x10,0xA1,0x00,0xE3,0x18,0xE3,0x18,0x46,0x21,0x83,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x43,0x10,0x43,0x10,0x22,0x10,0x43,0x10,0x83,0x20,0xC6,0x28,0xC6,0x28,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,
-	0x48,0x39,0xC6,0x28,0x48,0x39,0xC6,0x28,0x48,0x39,0x4A,0x29,0x48,0x39,0xC6,0x28,0x4A,0x29,0x0B,0x39,0x4A,0x29,0x4A,0x29,0x8E,0x31,0x0B,0x39,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x8E,0x31,0x2D,0x3A,0x4A,0x29,0x4A,0x29,0xC7,0x21,0xC5,0x18,0xA4,0x08,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,
-	0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0x62,0x00,0xA3,0x00,0x63,0x08,0xA4,0x08,0xC5,0x18,0x46,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0xC5,0x18,0xA3,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,
-	0x60,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0xA2,0x10,0xA1,0x00,0xA2,0x10,0xE3,0x18,0x83,0x20,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0xA2,0x10,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x10,0x43,0x10,0x43,0x10,0x83,0x20,0xC6,0x28,0x48,0x39,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x48,0x39,0x48,0x39,0x48,0x39,0xC6,0x28,0x48,0x39,0x48,0x39,0x4A,0x29,0x48,0x39,0x4A,0x29,0x4A,0x29,0x2D,0x3A,0x4A,0x29,0x8E,0x31,0x4A,0x29,0x8E,0x31,
-	0x2D,0x3A,0x8E,0x31,0x8E,0x31,0x8E,0x31,0x2D,0x3A,0x2D,0x3A,0x8E,0x31,0x2D,0x3A,0x4A,0x29,0x4A,0x29,0x46,0x21,0xA4,0x08,0xA4,0x08,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x61,0x00,
-	0x22,0x00,0x61,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xC5,0x18,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x48,0x39,0xC7,0x21,0x48,0x39,
-	0xC7,0x21,0x46,0x21,0xC5,0x18,0xA3,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x23,0x09,0xE3,0x18,0xA1,0x00,0xA2,0x10,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x62,0x08,0x22,0x10,0x83,0x20,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,
-	0xCA,0x59,0xCA,0x59,0x4B,0x49,0x48,0x39,0x48,0x39,0xC6,0x28,0x48,0x39,0x48,0x39,0x4A,0x29,0x48,0x39,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x2D,0x3A,0x8E,0x31,0x2D,0x3A,0x6E,0x51,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x6E,0x51,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x4A,0x29,0xC7,0x21,0xC5,0x18,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,
-	0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,
-	0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA4,0x08,0xA3,0x00,0xA4,0x08,0xA4,0x08,0x46,0x21,0x46,0x21,0xC7,0x21,0x48,0x39,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0xA2,0x10,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,
-	0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA1,0x00,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x10,0x43,0x10,0x83,0x20,0x48,0x39,0x48,0x39,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0xCA,0x59,0x48,0x39,0x48,0x39,0x48,0x39,0xC6,0x28,0x48,0x39,0x4A,0x29,0x48,0x39,0x4A,0x29,0x2D,0x3A,0x4A,0x29,0x2D,0x3A,0x8E,0x31,
-	0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0xB1,0x49,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x8E,0x31,0x2D,0x3A,0x4A,0x29,0xC7,0x21,0x46,0x21,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,
-	0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA4,0x08,0x23,0x09,0xA4,0x08,0xA4,0x08,0x46,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x48,0x39,0x46,0x21,0xC5,0x18,
-	0x62,0x08,0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x84,0x09,0x84,0x09,0xE3,0x18,0xA1,0x00,0xA2,0x10,0xE3,0x18,0xE3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x22,0x10,0xA2,0x10,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,
-	0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0xCA,0x59,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0x4A,0x29,0x4A,0x29,0x4A,0x29,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0xB1,0x49,0x2D,0x3A,0x2D,0x3A,0xB1,0x49,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x4A,0x29,0xC7,0x21,0xA7,0x00,0x84,0x09,0x84,0x09,0x84,0x09,
-	0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA1,0x00,0x23,0x09,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x23,0x09,0x23,0x09,
-	0x23,0x09,0x23,0x09,0xA4,0x08,0x23,0x09,0xA4,0x08,0x46,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x4A,0x29,0xC7,0x21,0x48,0x39,0x46,0x21,0x46,0x21,0xC5,0x18,0xA2,0x10,0x62,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x84,0x09,0x84,0x09,
-	0x46,0x21,0xE3,0x18,0xA1,0x00,0xA2,0x10,0xA2,0x10,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x22,0x10,0x83,0x20,0xC6,0x28,0x48,0x39,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0xCA,0x59,0x48,0x39,0x48,0x39,0x48,0x39,0x48,0x39,0xC7,0x21,0x48,0x39,0x4A,0x29,0x4A,0x29,0x2D,0x3A,
-	0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0xC7,0x21,0xC7,0x21,0x84,0x09,0x23,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x23,0x09,0x84,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA1,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,
-	0x63,0x08,0x64,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x63,0x08,0x64,0x00,0x63,0x00,0x63,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x84,0x09,0xC7,0x21,0x46,0x21,0xC7,0x21,0x46,0x21,0x4A,0x29,0xC7,0x21,0x48,0x39,0x46,0x21,0x46,0x21,0xA2,0x10,0x62,0x08,0x62,0x00,
-	0x61,0x00,0x62,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x84,0x09,0xC7,0x21,0xC7,0x21,0x84,0x09,0xA1,0x00,0x61,0x08,0xA2,0x10,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x22,0x10,0x83,0x20,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,
-	0x0F,0xA3,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0x4C,0x7A,0xCA,0x59,0xCA,0x59,0x48,0x39,0x48,0x39,0x48,0x39,0xC7,0x21,0xC7,0x21,0x4A,0x29,0x4A,0x29,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0xC7,0x21,0xC7,0x21,0x84,0x09,0x84,0x09,0x84,0x09,
-	0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x00,0x62,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,
-	0x21,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,
-	0x23,0x09,0x84,0x09,0x46,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0xC5,0x18,0x63,0x08,0x62,0x08,0x62,0x00,0x61,0x08,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x84,0x09,0x84,0x09,0xC7,0x21,0x84,0x09,0x84,0x09,
-	0xA1,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x08,0x83,0x20,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0xCA,0x59,0xCA,0x59,0x48,0x39,0x46,0x21,0x48,0x39,0xC7,0x21,0x4A,0x29,0xC7,0x21,
-	0xC7,0x21,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0xA7,0x12,0x2D,0x3A,0xA7,0x12,0xA7,0x12,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA4,0x08,
-	0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x66,0x08,0xA7,0x18,0xA7,0x18,0x66,0x10,0xC5,0x18,0x66,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0xA4,0x08,0x64,0x08,0x64,0x08,0xA4,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x00,0x61,0x00,
-	0x61,0x00,0x60,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0xC7,0x21,0x4A,0x29,0x46,0x21,0xC5,0x18,0x63,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x61,0x00,0x61,0x00,
-	0x21,0x00,0x61,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x84,0x09,0x84,0x09,0xA7,0x12,0xC7,0x21,0x84,0x09,0xA1,0x00,0x61,0x00,0x61,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x61,0x08,0x22,0x10,0x83,0x20,0x48,0x39,0x48,0x39,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,
-	0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0xCA,0x59,0x48,0x39,0x48,0x39,0x46,0x21,0x48,0x39,0xC7,0x21,0xC7,0x21,0x2D,0x3A,0xC7,0x21,0xA7,0x12,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0xA7,0x12,0xC7,0x21,0xC7,0x21,0x84,0x09,0x84,0x09,
-	0x84,0x09,0xA7,0x12,0x84,0x09,0xA7,0x12,0x84,0x09,0xA7,0x12,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x23,0x09,0x23,0x09,0xA4,0x08,0xC5,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xC5,0x18,0x65,0x08,0xC5,0x18,
-	0xA4,0x08,0x64,0x08,0xA4,0x08,0xA3,0x00,0x63,0x08,0x63,0x08,0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x21,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,
-	0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA4,0x08,0x23,0x09,0xA4,0x08,0x46,0x21,
-	0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0xC5,0x18,0x62,0x08,0x62,0x08,0x21,0x08,0x22,0x08,0x62,0x08,0x21,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x84,0x09,0x84,0x09,0xC7,0x21,0x46,0x21,0xE3,0x18,0xA1,0x00,0x60,0x00,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x22,0x10,0xA2,0x10,0x83,0x20,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0xCA,0x59,0xCA,0x59,0x46,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,
-	0xC7,0x21,0xC7,0x21,0xC7,0x21,0xA7,0x12,0xA7,0x12,0x2D,0x3A,0x67,0x0B,0x2D,0x3A,0x67,0x0B,0x2D,0x3A,0x67,0x0B,0x2D,0x3A,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x84,0x09,0x84,0x09,0x84,0x09,0x67,0x0B,0x84,0x09,0x67,0x0B,0x84,0x09,0xA7,0x12,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x23,0x09,0x84,0x09,0x46,0x21,0x2A,0x01,
-	0xC7,0x21,0xA8,0x18,0x2A,0x01,0xA8,0x18,0xA8,0x18,0xA7,0x18,0xA8,0x18,0xA7,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA4,0x08,0xC5,0x18,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,
-	0x61,0x00,0x61,0x00,0x60,0x00,0x21,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0xA3,0x00,0xA1,0x00,0x62,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,
-	0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x46,0x21,0x84,0x09,0x46,0x21,0x46,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0xC5,0x18,0xA3,0x00,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x21,0x00,0x21,0x08,0x61,0x00,0x61,0x00,
-	0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x84,0x09,0xA7,0x12,0xC7,0x21,0x84,0x09,0xE3,0x18,0xA1,0x00,0x60,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x22,0x10,0x83,0x20,0x83,0x20,0x48,0x39,0x48,0x39,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,
-	0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0xCA,0x59,0x48,0x39,0x48,0x39,0x46,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xA7,0x12,0x2D,0x3A,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x2D,0x3A,0x67,0x0B,0x2D,0x3A,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,
-	0xA7,0x12,0xA7,0x12,0x84,0x09,0x67,0x0B,0x84,0x09,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0xA7,0x00,0xC7,0x21,0x46,0x21,0xC7,0x21,0x4A,0x29,0x4A,0x29,0xC7,0x21,0x2A,0x01,0x4A,0x29,0xA8,0x18,0xC7,0x21,0xA8,0x18,0xA8,0x18,0xC7,0x21,0xA7,0x18,0xA7,0x18,0x46,0x21,0xA7,0x18,0xA7,0x18,
-	0xA7,0x18,0xC5,0x18,0xC5,0x18,0xA4,0x08,0xA3,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0xA1,0x00,0x62,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x60,0x00,0x61,0x00,0x21,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,
-	0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0xC5,0x18,0x84,0x09,0x46,0x21,0x46,0x21,
-	0xC7,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0xC5,0x18,0xC5,0x18,0x63,0x08,0x62,0x08,0x62,0x00,0x61,0x00,0x62,0x08,0x61,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x23,0x09,0x84,0x09,0x84,0x09,0xC7,0x21,0xC7,0x21,0x84,0x09,0x23,0x09,0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x22,0x10,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0xCA,0x59,0x48,0x39,0x46,0x21,0x46,0x21,
-	0xC7,0x21,0xA7,0x12,0xC7,0x21,0xA7,0x12,0xA7,0x12,0x2D,0x3A,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x84,0x09,0xA7,0x12,0x84,0x09,0xA7,0x12,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0x84,0x09,0xA7,0x12,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0xC7,0x21,
-	0x2A,0x01,0x4A,0x29,0x2A,0x01,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xC7,0x21,0x4A,0x29,0xA8,0x18,0xC7,0x21,0xA8,0x18,0x2A,0x01,0x46,0x21,0x2A,0x01,0xA7,0x18,0x46,0x21,0x84,0x09,0xC5,0x18,0xA4,0x08,0xA4,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,
-	0x60,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,
-	0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x46,0x21,0x84,0x09,0x46,0x21,0x46,0x21,0xC7,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0xC5,0x18,0xA2,0x10,0x62,0x08,0x62,0x00,0x62,0x08,0x61,0x00,0x62,0x08,0x21,0x00,0x21,0x00,0x61,0x08,0x62,0x08,0x61,0x00,0x61,0x00,
-	0x61,0x00,0xA1,0x00,0xA1,0x00,0xA3,0x00,0x23,0x09,0x84,0x09,0xC7,0x21,0xA7,0x12,0xC7,0x21,0x84,0x09,0xA1,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x08,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x22,0x10,0x22,0x10,0x83,0x20,0x83,0x20,0x48,0x39,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,
-	0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0xCA,0x59,0x48,0x39,0xC7,0x21,0x46,0x21,0xC7,0x21,0x84,0x09,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,
-	0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0x84,0x09,0xA7,0x12,0x2A,0x01,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0x4A,0x29,0xC7,0x21,0x4A,0x29,0xC7,0x21,0x4A,0x29,0x2A,0x01,0xC7,0x21,0x4A,0x29,0xC7,0x21,0xC7,0x21,0xA8,0x18,0x46,0x21,0x46,0x21,0xA7,0x00,
-	0x46,0x21,0xA4,0x08,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0x62,0x08,0xA1,0x00,0x62,0x08,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,
-	0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xC5,0x18,0x84,0x09,0x46,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,
-	0x46,0x21,0xA4,0x08,0xA2,0x10,0x63,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x61,0x00,0x22,0x08,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x84,0x09,0xA7,0x12,0xC7,0x21,0x46,0x21,0xE3,0x18,0xA1,0x00,0x60,0x08,0x60,0x00,0x20,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x08,0x20,0x08,0x22,0x10,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0x4C,0x7A,0x48,0x39,0xC7,0x21,
-	0x46,0x21,0x84,0x09,0xC7,0x21,0x84,0x09,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0x67,0x0B,0x67,0x0B,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x84,0x09,0xA7,0x12,0xC7,0x21,0xC7,0x21,
-	0xC7,0x21,0xC7,0x21,0x4A,0x29,0xC7,0x21,0x2D,0x3A,0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0x84,0x09,0xA4,0x08,0x84,0x09,0xA4,0x08,0xA3,0x00,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,
-	0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0x61,0x00,0xA1,0x00,0x62,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,
-	0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x46,0x21,0x84,0x09,0x46,0x21,0x46,0x21,0x84,0x09,0x46,0x21,0x46,0x21,0x23,0x09,0xA4,0x08,0xA2,0x10,0xA3,0x00,0x62,0x08,0x62,0x08,0x62,0x00,0x61,0x08,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0xA1,0x00,0xA1,0x00,
-	0xA3,0x00,0xA3,0x00,0x84,0x09,0x84,0x09,0xC7,0x21,0x84,0x09,0x84,0x09,0x23,0x09,0xA1,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x22,0x10,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x48,0x39,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,
-	0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0xCA,0x59,0x48,0x39,0xC7,0x21,0xC7,0x21,0x84,0x09,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x67,0x0B,0x67,0x0B,0x67,0x0B,0xA7,0x12,0x67,0x0B,0x67,0x0B,
-	0x67,0x0B,0x67,0x0B,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xC7,0x21,0xA7,0x12,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xA7,0x18,0xC7,0x21,0x46,0x21,
-	0x84,0x09,0xC5,0x18,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,
-	0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0xA1,0x00,0x23,0x09,0xA1,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x46,0x21,0x84,0x09,0xC5,0x18,0x23,0x09,0x46,0x21,0x84,0x09,0x46,0x21,0x46,0x21,0x84,0x09,0xC5,0x18,0xC5,0x18,
-	0xA3,0x00,0x62,0x00,0x62,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0xA1,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x84,0x09,0x84,0x09,0xC7,0x21,0x84,0x09,0x84,0x09,0xA1,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0xCA,0x59,
-	0x48,0x39,0xC7,0x21,0x84,0x09,0xC7,0x21,0x84,0x09,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xC7,0x21,0xA7,0x12,
-	0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x2A,0x01,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0x46,0x21,0x84,0x09,0xC5,0x18,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x20,0x00,
-	0x60,0x00,0x20,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0xA3,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,
-	0x23,0x09,0x23,0x09,0x84,0x09,0x23,0x09,0x84,0x09,0x23,0x09,0x23,0x09,0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0x46,0x21,0x23,0x09,0xC5,0x18,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x08,0x62,0x00,0xA3,0x00,0x62,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA3,0x00,0x23,0x09,0x84,0x09,
-	0x84,0x09,0xC7,0x21,0x84,0x09,0x84,0x09,0x23,0x09,0xA1,0x00,0x60,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x48,0x39,0x48,0x39,0xCA,0x59,
-	0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0x4C,0x7A,0xA7,0x12,0x48,0x39,0x84,0x09,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,
-	0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xC7,0x21,0xC7,0x21,0xA7,0x12,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0xC7,0x21,0x84,0x09,0x46,0x21,0x84,0x09,
-	0xA4,0x08,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,
-	0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA3,0x00,0x23,0x09,0xA1,0x00,0x23,0x09,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0xE3,0x18,0x84,0x09,0xC5,0x18,0x46,0x21,0x46,0x21,0x46,0x21,0x84,0x09,0x46,0x21,0x84,0x09,0x23,0x09,0xA4,0x08,0xA3,0x00,0x62,0x08,0x62,0x00,
-	0x62,0x00,0x62,0x08,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x84,0x09,0x84,0x09,0x46,0x21,0x23,0x09,0xE3,0x18,0xA1,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x83,0x20,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x48,0x39,0xCA,0x59,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,
-	0x4C,0x7A,0xA7,0x12,0x46,0x21,0x46,0x21,0x84,0x09,0xA7,0x12,0xA7,0x12,0xA7,0x12,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0xA7,0x12,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xC7,0x21,0xA7,0x12,
-	0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x2A,0x01,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0xC5,0x18,0x23,0x09,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0x61,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x60,0x00,0x60,0x00,
-	0x60,0x00,0x60,0x00,0x60,0x00,0x61,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0xA1,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x84,0x09,0x23,0x09,
-	0x84,0x09,0x23,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x46,0x21,0x84,0x09,0x46,0x21,0x84,0x09,0xC5,0x18,0x23,0x09,0xE3,0x18,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x08,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0x61,0x00,0xA1,0x00,0xA3,0x00,0x23,0x09,0xE3,0x18,0xE3,0x18,0x23,0x09,
-	0xA1,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x83,0x20,0x22,0x10,0x22,0x10,0x83,0x20,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,
-	0xC6,0x28,0x48,0x39,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x4C,0x7A,0x4C,0x7A,0xCA,0x59,0x48,0x39,0xC7,0x21,0xA7,0x12,0x84,0x09,0xA7,0x12,0x67,0x0B,0xA7,0x12,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,
-	0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xC7,0x21,0xA7,0x12,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0xC7,0x21,0x46,0x21,0xC7,0x21,0xC7,0x21,
-	0x46,0x21,0xA4,0x08,0xE3,0x18,0xA3,0x00,0xA2,0x10,0xA3,0x00,0xA2,0x10,0xA3,0x00,0xA1,0x00,0x61,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x21,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,
-	0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x46,0x21,0x84,0x09,0x46,0x21,0x46,0x21,0x84,0x09,0x23,0x09,0xA4,0x08,0x23,0x09,0x23,0x09,0xA4,0x08,0xA3,0x00,0xA3,0x00,0x62,0x08,0xA1,0x00,0x62,0x08,
-	0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0x62,0x08,0xA1,0x00,0x62,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x21,0x08,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x22,0x10,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x83,0x20,0x48,0x39,0x48,0x39,0x48,0x39,0xCA,0x59,0xCA,0x59,0x4C,0x7A,0x4C,0x7A,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0x0F,0xA3,0xB4,0x6A,0x0F,0xA3,
-	0x4C,0x7A,0x4C,0x7A,0xCA,0x59,0xA7,0x12,0x84,0x09,0x84,0x09,0xA7,0x12,0xA7,0x12,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0x67,0x0B,0xA7,0x12,0xA7,0x12,0xA7,0x12,0xC7,0x21,0xA7,0x12,
-	0xC7,0x21,0xC7,0x21,0x2D,0x3A,0xC7,0x21,0x2D,0x3A,0x2D,0x3A,0x2D,0x3A,0x4A,0x29,0xC7,0x21,0x4A,0x29,0x4A,0x29,0x4A,0x29,0xC7,0x21,0x4A,0x29,0xC7,0x21,0x46,0x21,0x46,0x21,0xC5,0x18,0xA4,0x08,0xC5,0x18,0x23,0x09,0xA2,0x10,0xA2,0x10,0xA3,0x00,0x62,0x08,0xA1,0x00,0xA1,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x60,0x00,0x61,0x00,
-	0x61,0x00,0x60,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA1,0x00,0xA3,0x00,0xA1,0x00,0xA3,0x00,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x23,0x09,0x84,0x09,0x23,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,
-	0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x84,0x09,0x23,0x09,0xE3,0x18,0x23,0x09,0xA2,0x10,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x61,0x00,0x62,0x08,0x62,0x08,0x62,0x08,0x61,0x00,0x61,0x00,0x60,0x00,0x61,0x00,0x61,0x00,0xA1,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_1041_dial_img_0_984_data_0, "face_1041_dial_img_0_984_data_0.bin");
         
 
 
@@ -2186,7 +21,7 @@ const lv_img_dsc_t face_1041_dial_img_0_984_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 288,
-    .data_size = sizeof(face_1041_dial_img_0_984_data_0),
+    .data_size = 138240,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_1041_dial_img_0_984_data_0};
 
@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 1041
-
-#include "../1041.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1041_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFC,0xDF,0xFC,0x1F,0xFD,0xFF,0xFC,0x1F,0xFD,0xDF,0xFC,0x1F,0xFD,0xFF,0xFC,0x1F,0xFD,0xDF,0xFC,0xDF,0xFC,0xFF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x9F,0xFC,0x9F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xFF,0xFC,0xDF,0xFC,0x1F,0xFD,0x1F,0xFD,0xFF,0xFC,0xFF,0xFC,0x1F,0xFD,0xFF,0xFC,0x1F,0xFD,0xFF,0xFC,0x1F,0xFD,0xDF,0xFC,0xFF,0xFC,0xDF,0xFC,0xFF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xBF,0xFC,0x9F,0xFC,0x9F,0xFC,0x3F,0xEC,0x3F,0xE4,0x1F,0xDC,0xFF,0xD3,0xBF,0xD3,0xBF,0xB3,
-	0x3E,0xAB,0xBB,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xFC,0xBF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xFF,0xFC,0xDF,0xFC,0x1F,0xFD,0x1F,0xFD,0xFF,0xFC,0xFF,0xFC,0x1F,0xFD,0x1F,0xFD,0xFF,0xFC,0x1F,0xFD,0x1F,0xFD,0xDF,0xFC,0xFF,0xFC,0x1F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xBF,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xDF,0xCB,0x7F,0xCB,0x5F,0xB3,
-	0xFD,0xA2,0x16,0x72,0xB2,0x61,0x6E,0x51,0x0D,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x3F,0xFC,0x5F,0xFC,0x7F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xFF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x1F,0xFD,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xFF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xBF,0xFC,0x9F,0xFC,0x5F,0xFC,0x3F,0xF4,0x3F,0xE4,0x3F,0xDC,0xFF,0xD3,0xDF,0xCB,0x7F,0xCB,0x3E,0xC3,0xFD,0xA2,
-	0x37,0x8A,0xD4,0x69,0x6F,0x59,0x4E,0x49,0x0C,0x41,0x0B,0x39,0x0C,0x41,0x0D,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xE3,0xDF,0xEB,0x1F,0xF4,0x3F,0xFC,0x7F,0xFC,0x5F,0xFC,0x7F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xFF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0x5F,0xFC,0x3F,0xFC,0x7F,0xFC,0x3F,0xEC,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0xDF,0xCB,0xBE,0xC3,0x3E,0xBB,0xDB,0xAA,0x38,0x8A,
-	0xB3,0x71,0x91,0x51,0x6E,0x51,0x4E,0x49,0x0C,0x41,0x0D,0x41,0x2D,0x41,0x4E,0x49,0x6E,0x51,0x6F,0x59,0xB1,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xD3,0xBE,0xDB,0xDF,0xEB,0x1F,0xF4,0x3F,0xFC,0x5F,0xFC,0x9F,0xFC,0x9F,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xFF,0xFC,0xFF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xBF,0xFC,0xBF,0xFC,0x9F,0xFC,0x9F,0xFC,0x5F,0xFC,0x5F,0xFC,0x7F,0xF4,0x3F,0xE4,0x3F,0xE4,0x1F,0xDC,0x1F,0xDC,0xDF,0xD3,0xBE,0xCB,0x3D,0xBB,0xDC,0xAA,0x58,0x92,0x17,0x82,0xB3,0x71,
-	0x91,0x69,0x6E,0x51,0x6E,0x51,0x4C,0x49,0x4D,0x49,0x4D,0x49,0x6E,0x51,0x6E,0x51,0x90,0x59,0x91,0x51,0xB2,0x69,0xB3,0x69,0xF5,0x69,0x16,0x7A,0x39,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xD3,0x9E,0xE3,0xBF,0xE3,0xFF,0xF3,0x1F,0xF4,0x3F,0xFC,0x5F,0xFC,0x7F,0xFC,0xBF,0xFC,0xBF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xBF,0xFC,0x5F,0xFC,0x5F,0xEC,0x5F,0xFC,0x3F,0xFC,0x3F,0xEC,0x3F,0xF4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xFF,0xD3,0x9F,0xCB,0x5D,0xC3,0x1C,0xBB,0x99,0xAA,0x58,0x8A,0x17,0x7A,0xD3,0x71,0xB2,0x69,0x71,0x51,
-	0x6F,0x59,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6D,0x51,0x6D,0x51,0x6E,0x51,0x8F,0x59,0x91,0x59,0x93,0x61,0xD4,0x69,0xF5,0x69,0x16,0x7A,0x39,0x7A,0x5B,0x82,0x9C,0x92,0xBE,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xCB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x5F,0xFC,0x9F,0xFC,0xBF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0xDF,0xFC,0xBF,0xFC,0xBF,0xFC,0xBF,0xFC,0x9F,0xFC,0x9F,0xFC,0x7F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xF4,0x3F,0xF4,0x3F,0xE4,0x1F,0xEC,0x1F,0xE4,0x1F,0xDC,0xDE,0xE3,0xBE,0xE3,0x9E,0xD3,0x5E,0xCB,0x3E,0xC3,0x1C,0xBB,0xBB,0xAA,0x79,0x9A,0x38,0x8A,0xF6,0x79,0xF6,0x79,0xD3,0x79,0xB2,0x71,0x92,0x59,0x90,0x61,
-	0x6E,0x51,0x6E,0x51,0x6E,0x51,0x8F,0x59,0x6F,0x59,0x6F,0x59,0x90,0x61,0x93,0x61,0xB2,0x69,0xD4,0x69,0xF5,0x69,0x17,0x7A,0x39,0x7A,0x5B,0x82,0x5B,0x8A,0xBE,0x92,0x7D,0x9A,0xDE,0x9A,0xDE,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xCB,0x5D,0xD3,0xBE,0xE3,0xBF,0xE3,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x7F,0xFC,0x7F,0xFC,0xBF,0xFC,0x9F,0xFC,0xBF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,0xDF,0xFC,
-	0xDF,0xFC,0x7F,0xFC,0xBF,0xFC,0x7F,0xFC,0x7F,0xFC,0x5F,0xFC,0x3F,0xFC,0x5F,0xEC,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x1F,0xE4,0xBE,0xDB,0x9E,0xDB,0x5D,0xD3,0x3D,0xCB,0x1B,0xC3,0xFB,0xBA,0xBA,0xB2,0x99,0xAA,0x79,0x9A,0x59,0x92,0x17,0x82,0xF6,0x81,0xF5,0x71,0xF4,0x71,0xB2,0x71,0xB2,0x69,0xB2,0x71,0x90,0x61,0x90,0x61,
-	0x90,0x61,0x6F,0x59,0x6F,0x59,0x8F,0x59,0x90,0x61,0x93,0x59,0x92,0x69,0xD4,0x61,0xD5,0x61,0xF6,0x71,0x17,0x7A,0x3A,0x7A,0x5A,0x82,0x7C,0x92,0xBC,0x9A,0xBD,0xA2,0xDE,0xAA,0x1E,0xAB,0x1E,0xA3,0x1E,0xA3,0x5F,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xD3,0x9E,0xDB,0xDF,0xEB,0xFF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x7F,0xFC,0x7F,0xFC,0xBF,0xFC,0x7F,0xFC,0xBF,0xFC,0xBF,0xFC,0xBF,0xFC,0xBF,0xFC,0xBF,0xFC,0x9F,0xFC,0x9F,0xFC,0x9F,0xFC,0x5F,0xFC,0x5F,0xFC,
-	0x3F,0xF4,0x3F,0xF4,0x3F,0xF4,0x3F,0xE4,0x1F,0xEC,0x1F,0xE4,0x1F,0xDC,0xFE,0xDB,0x9E,0xDB,0x7E,0xD3,0x3D,0xCB,0x3C,0xCB,0x1D,0xC3,0xFA,0xBA,0xBB,0xB2,0xBA,0xAA,0x79,0xA2,0x79,0xA2,0x58,0x9A,0x38,0x8A,0x38,0x8A,0x16,0x82,0xF6,0x81,0xF6,0x81,0xF3,0x81,0xD3,0x79,0xD3,0x79,0xB2,0x69,0xB2,0x71,0x90,0x61,0x90,0x61,0x90,0x61,
-	0x90,0x61,0x91,0x69,0x91,0x61,0xB2,0x69,0xD3,0x69,0xD3,0x71,0xF5,0x69,0xF6,0x79,0x18,0x82,0x3A,0x82,0x5B,0x82,0x5B,0x8A,0xBC,0x9A,0xBC,0x9A,0xDE,0xAA,0xDE,0xAA,0xFE,0xAA,0x3E,0xAB,0xFE,0xAA,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0xCB,0x5D,0xD3,0xBE,0xE3,0xDF,0xEB,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x5F,0xFC,0x5F,0xFC,0x9F,0xFC,0x9F,0xFC,0x9F,0xFC,0xBF,0xFC,0x7F,0xFC,0x7F,0xFC,0x9F,0xFC,0x9F,0xFC,0x7F,0xFC,0x9F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xF4,0x3F,0xF4,
-	0x3F,0xE4,0x3F,0xE4,0xDF,0xE3,0xDF,0xDB,0x7D,0xD3,0x5D,0xD3,0x3D,0xCB,0x1B,0xC3,0xDB,0xB2,0xBA,0xAA,0x99,0xA2,0x79,0x9A,0x59,0x92,0x59,0x92,0x59,0x92,0x56,0x92,0x58,0x92,0x37,0x8A,0x35,0x8A,0x35,0x8A,0xF3,0x81,0x16,0x82,0xF3,0x81,0xF3,0x81,0xF4,0x71,0xD2,0x79,0xD2,0x79,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB1,0x69,0xD3,0x69,
-	0xB2,0x69,0xD4,0x69,0xF4,0x69,0xF4,0x69,0xF6,0x79,0x16,0x7A,0x17,0x82,0x3A,0x82,0x5A,0x8A,0x7B,0x92,0x9C,0x92,0x7C,0x9A,0xBD,0xA2,0xDD,0xA2,0xDE,0xAA,0x1E,0xAB,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x9F,0xB3,0x5F,0xB3,0xBF,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xC3,0x5D,0xD3,0x7E,0xDB,0x9E,0xDB,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x5F,0xFC,0x9F,0xFC,0x3F,0xFC,0x7F,0xFC,0x7F,0xFC,0xBF,0xFC,0xBF,0xFC,0x7F,0xFC,0x7F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0x1F,0xF4,0x3F,0xEC,0x3F,0xEC,0x1F,0xDC,0xFE,0xDB,
-	0x9E,0xDB,0x3C,0xCB,0x1C,0xC3,0x1B,0xC3,0xDA,0xB2,0x99,0xA2,0x99,0xA2,0x79,0xA2,0x79,0x9A,0x59,0x92,0x59,0x92,0x58,0x92,0x37,0x8A,0x16,0x82,0x36,0x8A,0x36,0x8A,0x35,0x8A,0x35,0x92,0x15,0x82,0xF3,0x81,0x15,0x82,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF4,0x71,0xF3,0x81,0xF3,0x81,0xF4,0x79,0xF3,0x79,0xF5,0x69,0xF4,0x79,
-	0xF5,0x69,0xF6,0x79,0x17,0x82,0x18,0x82,0x39,0x82,0x5A,0x8A,0x5C,0x92,0x5C,0x92,0x9C,0x9A,0x9C,0x9A,0x7C,0xA2,0xDE,0xAA,0xDE,0xAA,0xFE,0xAA,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x5F,0xB3,0x7F,0xB3,0xDF,0xBB,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xC3,0x5D,0xD3,0x9E,0xD3,0xBE,0xE3,0xBF,0xE3,0x1F,0xF4,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x7F,0xFC,0x5F,0xFC,0x3F,0xFC,0x3F,0xFC,0x5F,0xFC,0x5F,0xFC,0x9F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xEC,0x3F,0xF4,0x3F,0xE4,0xDF,0xEB,0xDF,0xDB,0xBE,0xDB,0x7D,0xD3,0x3C,0xCB,0xFB,0xBA,
-	0xB9,0xAA,0x99,0xAA,0x99,0xA2,0x59,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x79,0x9A,0x59,0x92,0x79,0x9A,0x58,0x92,0x57,0x92,0x57,0x92,0x57,0x92,0x57,0x92,0x55,0x9A,0x35,0x92,0x55,0x9A,0x36,0x8A,0x55,0x9A,0x16,0x8A,0x34,0x92,0x35,0x92,0x35,0x92,0x34,0x92,0x34,0x92,0x15,0x82,0x15,0x82,0x35,0x8A,0x37,0x8A,0x38,0x8A,0x38,0x8A,
-	0x38,0x8A,0x38,0x8A,0x7A,0x92,0x7B,0x92,0x9C,0x92,0x7C,0x9A,0xBD,0xA2,0xBD,0xA2,0xDE,0xAA,0xDE,0xAA,0x3E,0xAB,0x3E,0xAB,0x3E,0xAB,0x5F,0xB3,0x5F,0xB3,0x5F,0xBB,0x5F,0xB3,0xBF,0xC3,0xBF,0xBB,0xDF,0xC3,0xDF,0xBB,0xDF,0xC3,0xDF,0xBB,0xDF,0xBB,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0xBA,0x3C,0xCB,0x7E,0xDB,0xBF,0xDB,0xDF,0xEB,0xFF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x5F,0xFC,0x5F,0xFC,0x5F,0xFC,0x7F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xF4,0x3F,0xF4,0x1F,0xE4,0x1F,0xE4,0xFE,0xDB,0x9E,0xDB,0x7D,0xD3,0x1C,0xC3,0xD9,0xB2,0x99,0xA2,0x79,0xA2,0x79,0xA2,
-	0x79,0x9A,0x59,0x92,0x58,0x92,0x56,0x9A,0x79,0x9A,0x79,0xA2,0x79,0xA2,0x59,0x92,0x79,0xA2,0x59,0x92,0x79,0xA2,0x79,0xA2,0x79,0xA2,0x79,0xA2,0x76,0x9A,0x79,0x9A,0x78,0xA2,0x78,0xA2,0x56,0x9A,0x56,0x9A,0x78,0xA2,0x78,0xA2,0x79,0x9A,0x79,0x9A,0x59,0x92,0x79,0xA2,0x79,0xA2,0x79,0xA2,0x79,0x9A,0x79,0x9A,0x9A,0xA2,0x9A,0xA2,
-	0xBC,0x9A,0xBB,0xAA,0xBC,0xA2,0x9C,0xAA,0xDC,0xB2,0xDE,0xAA,0xDD,0xB2,0x1E,0xBB,0x3E,0xBB,0x3E,0xBB,0x3E,0xBB,0x5F,0xB3,0x7F,0xC3,0x7F,0xC3,0xBF,0xCB,0xBF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xC3,0xDF,0xCB,0xFF,0xC3,0xFF,0xC3,0xFF,0xC3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x1C,0xC3,0x5D,0xD3,0x9E,0xDB,0xBF,0xE3,0xDF,0xEB,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x7F,0xFC,0x5F,0xFC,0x5F,0xFC,0x3F,0xFC,0x5F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xDB,0x9E,0xDB,0x5C,0xCB,0x1B,0xC3,0xD9,0xB2,0x98,0xAA,0x56,0x9A,0x55,0x9A,0x55,0x92,0x56,0x92,0x78,0x9A,
-	0x79,0xA2,0x99,0xA2,0x78,0xA2,0x99,0xA2,0x79,0xA2,0x99,0xAA,0x99,0xAA,0xB9,0xB2,0x99,0xAA,0x99,0xAA,0xBA,0xB2,0xBA,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xD9,0xB2,0xBA,0xB2,0xDA,0xB2,0xDA,0xB2,0xDC,0xB2,0xFC,0xB2,0xDC,0xB2,0x1D,0xB3,
-	0x1D,0xB3,0x1D,0xB3,0x1E,0xB3,0x3E,0xBB,0x3E,0xC3,0x3E,0xC3,0x5E,0xC3,0x5F,0xC3,0xBF,0xC3,0xBF,0xCB,0xBF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xFF,0xCB,0x3F,0xC4,0xFF,0xC3,0x3F,0xC4,0xFF,0xBB,0x1F,0xBC,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xBD,0xA3,0x5F,0x9B,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x5D,0xD3,0x7E,0xDB,0xBE,0xDB,0xDF,0xEB,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0x1F,0xF4,0xBE,0xE3,0x9E,0xD3,0x7D,0xD3,0x1B,0xBB,0xB8,0xB2,0x98,0xA2,0x77,0xA2,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x78,0xA2,0x78,0xA2,
-	0x99,0xAA,0x99,0xAA,0x99,0xAA,0x99,0xAA,0xB9,0xB2,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0xFA,0xBA,0x1B,0xC3,0x1B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3E,0xCB,0x3C,0xCB,
-	0x5E,0xCB,0x5E,0xCB,0x5E,0xCB,0x5F,0xCB,0x7F,0xCB,0xBF,0xCB,0xDE,0xD3,0xDE,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0x1F,0xD4,0xFF,0xD3,0x5F,0xC4,0x3F,0xC4,0xFF,0xCB,0x3F,0xC4,0x3F,0xC4,0x3F,0xC4,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDE,0xAB,0x7E,0xA3,0x7F,0x9B,0x3F,0x93,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x7D,0xD3,0xBE,0xE3,0xBF,0xE3,0xDF,0xEB,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBE,0xE3,0x5C,0xCB,0x3B,0xC3,0xD9,0xB2,0x98,0xAA,0x56,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x78,0xA2,0x78,0xA2,0xB8,0xAA,
-	0xD9,0xB2,0xFA,0xBA,0xFA,0xBA,0x1A,0xBB,0x1B,0xC3,0x3B,0xC3,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x7E,0xD3,0x7E,0xD3,0x9E,0xD3,0x7E,0xDB,0x9E,0xDB,0x9E,0xDB,0x9E,0xD3,0x7E,0xD3,
-	0x7E,0xD3,0x9F,0xD3,0x9E,0xDB,0xBF,0xDB,0xBF,0xD3,0xBF,0xD3,0xDF,0xD3,0xDF,0xD3,0xDF,0xD3,0xFF,0xD3,0x1F,0xDC,0x1F,0xDC,0x1F,0xDC,0x3F,0xDC,0x1F,0xDC,0x1F,0xDC,0x3F,0xDC,0x5F,0xD4,0x1F,0xD4,0x5F,0xD4,0x1F,0xCC,0x3F,0xCC,0x3F,0xC4,0xFF,0xBB,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xBE,0xA3,0x9E,0x9B,0x3F,0x93,0xDD,0x8A,
-	0xBC,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0xDB,
-	0x9E,0xDB,0xDF,0xEB,0xFF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0x1F,0xF4,0xDF,0xE3,0xBE,0xE3,0x9E,0xDB,0x5C,0xCB,0xFA,0xBA,0xD9,0xB2,0x55,0x9A,0x34,0x92,0x34,0x92,0x34,0x92,0x34,0x92,0x73,0x9A,0x55,0x9A,0x55,0x9A,0x55,0x9A,0x56,0x9A,0x97,0xA2,0x97,0xA2,0xFA,0xBA,0xFA,0xBA,
-	0xFA,0xBA,0x1A,0xBB,0x3B,0xC3,0x3C,0xCB,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x7E,0xDB,0x9E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBE,0xDB,0xBF,0xDB,0xBF,0xE3,0xBF,0xDB,0xBF,0xDB,0xBF,0xE3,0xBF,0xE3,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xDB,
-	0xBF,0xE3,0xBF,0xDB,0xBF,0xE3,0xDF,0xE3,0xDF,0xDB,0xDF,0xE3,0xFF,0xE3,0xFF,0xE3,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0x1F,0xD4,0x5F,0xD4,0x1F,0xDC,0x5F,0xD4,0x1F,0xD4,0x1F,0xCC,0x3F,0xC4,0x3F,0xC4,0x3F,0xBC,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xBF,0xA3,0xBF,0xA3,0x7F,0x93,0x1D,0x93,0xFD,0x7A,0x7B,0x72,
-	0xD7,0x61,0xB3,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xD3,0xBE,0xE3,0xBF,0xE3,
-	0xDF,0xEB,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x7D,0xD3,0x3C,0xCB,0xD9,0xB2,0x76,0xA2,0x55,0x9A,0x13,0x8A,0xF3,0x81,0x34,0x8A,0x53,0x92,0x32,0x8A,0x91,0x9A,0x73,0x9A,0x55,0x9A,0x55,0x9A,0x76,0x9A,0x77,0xA2,0xD9,0xB2,0xD9,0xB2,0x97,0xA2,0xFA,0xBA,
-	0xFA,0xBA,0xFA,0xBA,0x1B,0xC3,0xFA,0xBA,0x1B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3B,0xC3,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x3C,0xCB,0x5C,0xCB,0x5D,0xD3,0x7E,0xD3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,
-	0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xE3,0xFF,0xE3,0xDF,0xE3,0xFF,0xDB,0x1F,0xE4,0x3F,0xE4,0x3F,0xE4,0x1F,0xD4,0x1F,0xD4,0xFF,0xD3,0x5F,0xD4,0x1F,0xD4,0x1F,0xD4,0xFF,0xD3,0x5F,0xD4,0xFF,0xCB,0xFF,0xC3,0xDF,0xCB,0xDF,0xBB,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x7F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDD,0x8A,0x7A,0x72,0x7A,0x62,0xB6,0x59,
-	0x73,0x41,0x31,0x31,0x0E,0x31,0xCB,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xDB,0xBF,0xE3,0xDF,0xEB,0x1F,0xF4,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0xDF,0xEB,0xDF,0xEB,0xDF,0xE3,0xBE,0xE3,0x7E,0xD3,0x3C,0xCB,0xD9,0xB2,0x35,0x92,0x34,0x92,0xF3,0x81,0xF3,0x81,0x12,0x82,0x14,0x8A,0x12,0x82,0x13,0x8A,0x54,0x9A,0x92,0x9A,0x73,0x9A,0x93,0x9A,0x74,0x9A,0xF5,0xAA,0xD6,0xAA,0x75,0x9A,0x75,0x9A,0xD6,0xAA,0x55,0x9A,
-	0x56,0x9A,0x77,0xA2,0x35,0x92,0x35,0x92,0x56,0x9A,0x56,0x9A,0x35,0x92,0x35,0x92,0x57,0x9A,0x57,0x9A,0x57,0x9A,0x57,0x9A,0x78,0xA2,0x78,0xA2,0x98,0xA2,0xB9,0xAA,0xBA,0xAA,0xBB,0xB2,0xFB,0xBA,0xFB,0xC2,0x1B,0xC3,0x3C,0xCB,0x3D,0xCB,0x7E,0xD3,0x9E,0xD3,0x9E,0xD3,0x9E,0xD3,0x9E,0xD3,0xBE,0xE3,0xBE,0xE3,0xBF,0xE3,0xBF,0xE3,
-	0xDF,0xE3,0xDF,0xE3,0xDF,0xDB,0xBF,0xDB,0xBF,0xD3,0xBF,0xD3,0xFF,0xDB,0xFF,0xDB,0xFF,0xD3,0xFF,0xD3,0x1F,0xDC,0x1F,0xDC,0xFF,0xD3,0xFF,0xD3,0xFF,0xCB,0xFF,0xCB,0xFF,0xCB,0xDF,0xC3,0xDF,0xC3,0xDF,0xC3,0xDF,0xB3,0xBF,0xAB,0xBF,0xA3,0xBF,0xA3,0x3F,0x9B,0x1E,0x93,0xBD,0x82,0x7B,0x72,0x3A,0x5A,0xD8,0x49,0x74,0x49,0x53,0x41,
-	0x31,0x39,0x0E,0x39,0xED,0x28,0xCC,0x28,0xCA,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xE3,0xBF,0xE3,0xFF,0xF3,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xFF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xE3,0xBF,0xDB,0x7D,0xD3,0x3C,0xCB,0xFA,0xBA,0x77,0xA2,0x14,0x8A,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x12,0x82,0x90,0x92,0x53,0x92,0xB1,0x9A,0x54,0x9A,0x92,0x9A,0x73,0x9A,0x74,0x9A,0xB1,0x9A,0x32,0x8A,0xF3,0x81,0xD2,0x79,0xD2,0x79,0xF1,0x79,0xD2,0x79,
-	0xB2,0x71,0xD2,0x79,0xD2,0x71,0xD2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xD2,0x79,0xD2,0x79,0xD2,0x79,0xF4,0x71,0xF4,0x71,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0x16,0x8A,0x16,0x8A,0x15,0x82,0x37,0x8A,0x59,0x92,0x79,0x9A,0x79,0x9A,0x9A,0xAA,0x7A,0xA2,0xBA,0xAA,0xFB,0xBA,0xFB,0xBA,0xFD,0xC2,0xFD,0xC2,0x5F,0xCB,0x5F,0xCB,
-	0x7F,0xCB,0x7F,0xCB,0x7F,0xCB,0x5F,0xCB,0x9F,0xCB,0xDF,0xCB,0xBF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xC3,0xDF,0xC3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0x7F,0xB3,0xBF,0xAB,0x7F,0xA3,0x5F,0x9B,0xFF,0x92,0xFF,0x8A,0x9E,0x82,0x7D,0x7A,0x3C,0x6A,0xFB,0x61,0xB9,0x51,0x77,0x41,0x74,0x41,0x53,0x39,0x31,0x31,
-	0x31,0x31,0x0E,0x39,0xED,0x28,0xCC,0x28,0xCB,0x28,0xCA,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xDB,0xDF,0xEB,0xFF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x3F,0xFC,0x1F,0xF4,0x1F,0xF4,0xDF,0xEB,0xBF,0xE3,0xBF,0xDB,0x7E,0xD3,0x3C,0xCB,0xFA,0xBA,0x98,0xA2,0x34,0x92,0xF3,0x81,0xF2,0x81,0xF2,0x81,0x31,0x82,0x31,0x82,0x90,0x92,0x12,0x82,0x53,0x92,0x12,0x82,0x30,0x82,0x30,0x82,0x0E,0x72,0x0E,0x72,0xB0,0x69,0xB0,0x69,0xEC,0x69,0xEC,0x69,0x8F,0x61,0x8F,0x61,0x8E,0x59,0x8E,0x59,
-	0xAF,0x61,0xAF,0x61,0x90,0x61,0x91,0x69,0x91,0x69,0x91,0x69,0x91,0x69,0xB1,0x69,0x91,0x69,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x69,0xD3,0x69,0xB2,0x71,0xF3,0x71,0xD2,0x71,0xF3,0x79,0xF3,0x79,0xF3,0x79,0xF5,0x79,0xF6,0x81,0xF6,0x81,0x17,0x82,0x17,0x82,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x3A,0x92,0x5B,0x9A,0x5C,0x9A,0x5C,0x9A,
-	0xBD,0xA2,0xBD,0xA2,0xBD,0xA2,0xBD,0xA2,0xBD,0xA2,0xFE,0xAA,0x1E,0xA3,0x1E,0xAB,0x1E,0xAB,0x1E,0xA3,0x1E,0xA3,0x1E,0x9B,0xFE,0x9A,0xFE,0x9A,0xBE,0x9A,0xDE,0x92,0xBE,0x8A,0xBE,0x8A,0x9E,0x8A,0x5D,0x82,0x7E,0x7A,0x3D,0x72,0x1D,0x6A,0xDC,0x61,0xBB,0x51,0x9A,0x49,0x99,0x49,0x77,0x41,0x76,0x39,0x34,0x31,0x32,0x31,0x12,0x31,
-	0x31,0x31,0x0E,0x29,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xCC,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xDB,0xBF,0xE3,0xDF,0xEB,0xFF,0xF3,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x1F,0xF4,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0x9E,0xD3,0x5D,0xCB,0x3B,0xC3,0xD9,0xB2,0x55,0x9A,0xF3,0x81,0xD2,0x79,0xD2,0x79,0x2E,0x7A,0xF2,0x81,0x2D,0x7A,0x8F,0x92,0xF1,0x79,0x6D,0x82,0xD1,0x71,0x2D,0x7A,0x0D,0x72,0x8C,0x59,0x6F,0x59,0x8B,0x51,0x4C,0x49,0x4C,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x6B,0x49,0x6B,0x49,
-	0x6F,0x59,0x6E,0x51,0x6D,0x51,0x6E,0x51,0x6E,0x51,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x69,0xD3,0x69,0xB2,0x71,0xB3,0x69,0xD4,0x69,0xD4,0x69,0xF3,0x71,0xF4,0x69,0xF5,0x69,0xF5,0x71,0xF5,0x71,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x3A,0x82,0x3A,0x7A,0x3B,0x82,0x3B,0x82,
-	0x3B,0x82,0x3B,0x82,0x3C,0x8A,0x1C,0x82,0x5D,0x82,0x5D,0x82,0x5D,0x82,0x5E,0x82,0x5D,0x82,0x5D,0x82,0x3D,0x82,0x5D,0x82,0x1C,0x7A,0x1C,0x7A,0x1C,0x72,0x3C,0x7A,0xFD,0x69,0xFD,0x69,0xDC,0x69,0xDC,0x69,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xBA,0x49,0x7B,0x41,0x9A,0x49,0x79,0x41,0x77,0x41,0x76,0x39,0x35,0x31,0x34,0x31,0x32,0x31,
-	0x12,0x29,0x31,0x39,0x30,0x31,0x10,0x31,0x0F,0x31,0xED,0x38,0xED,0x38,0xED,0x38,0x0D,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBF,0xDB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xF4,0x1F,0xF4,0x1F,0xF4,0xDF,0xEB,0xDF,0xEB,
-	0xDF,0xEB,0xBF,0xE3,0xBE,0xE3,0x7D,0xD3,0x3C,0xCB,0xDA,0xB2,0x77,0xA2,0xF3,0x81,0xD2,0x79,0xD1,0x71,0x0E,0x72,0x0E,0x7A,0xF1,0x79,0x2D,0x7A,0xF1,0x79,0xD0,0x69,0xEC,0x69,0x8F,0x59,0x8A,0x51,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x2B,0x41,0x2B,0x41,0x2B,0x41,0x2A,0x41,0x2B,0x41,0x2A,0x41,0x09,0x39,0x09,0x39,0x29,0x41,0x2A,0x41,
-	0x0A,0x39,0x2A,0x41,0x0A,0x39,0x0A,0x39,0x2B,0x41,0xED,0x38,0x4D,0x49,0x4D,0x49,0x4E,0x49,0x6F,0x59,0x90,0x49,0x6F,0x59,0x90,0x51,0xB1,0x61,0xB2,0x61,0xD4,0x69,0xD4,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF6,0x71,0xF6,0x71,0x17,0x7A,0xF7,0x71,0xF8,0x69,0x18,0x72,0x18,0x72,0x1A,0x7A,0x18,0x7A,0x1B,0x72,0x1B,0x72,0x1B,0x72,
-	0x1C,0x7A,0x1C,0x7A,0x1C,0x72,0x1C,0x72,0xFC,0x71,0xDC,0x69,0x1C,0x72,0xFC,0x71,0xDC,0x69,0xFD,0x69,0xFC,0x71,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x61,0xDD,0x61,0xDD,0x61,0xDD,0x61,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xBC,0x49,0xBC,0x49,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x78,0x39,0x77,0x41,0x77,0x41,0x35,0x31,0x55,0x39,
-	0x55,0x39,0x32,0x39,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x30,0x31,0x4E,0x31,0x2E,0x39,0x2E,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE3,0x1F,0xF4,0x3F,0xEC,0x3F,0xFC,0x3F,0xF4,0x1F,0xF4,0xFF,0xEB,0xDF,0xEB,0xFF,0xE3,
-	0xBF,0xDB,0x9E,0xDB,0x5E,0xCB,0x1B,0xC3,0x98,0xAA,0x14,0x8A,0xF3,0x81,0xD2,0x71,0x0E,0x7A,0x2D,0x7A,0xD0,0x71,0xF1,0x79,0x2D,0x72,0x2D,0x72,0x8F,0x61,0x6C,0x51,0x4B,0x49,0x4B,0x49,0x2B,0x41,0x0B,0x39,0x0B,0x39,0x29,0x39,0x09,0x31,0xCA,0x28,0xC8,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC8,0x28,0xC8,0x28,0xC6,0x28,0xC6,0x28,
-	0xC8,0x28,0xC7,0x28,0xC9,0x28,0xC9,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xEB,0x30,0x0B,0x39,0x0C,0x41,0x0E,0x41,0x2E,0x41,0x2E,0x41,0x6F,0x49,0x51,0x49,0xB1,0x51,0x93,0x59,0xB5,0x59,0xF5,0x69,0xF5,0x69,0x17,0x6A,0xF6,0x69,0xF7,0x71,0x18,0x72,0x18,0x72,0x39,0x72,0x39,0x72,0x39,0x72,0x1B,0x7A,0x1C,0x7A,0x1C,0x7A,
-	0x1C,0x7A,0xFC,0x69,0xFD,0x69,0x1D,0x6A,0x3D,0x72,0x1D,0x62,0xFD,0x69,0x1E,0x62,0x1D,0x62,0xFD,0x61,0x1D,0x62,0x1D,0x62,0x1D,0x62,0xFD,0x59,0xDD,0x51,0xDD,0x51,0xDD,0x59,0xDC,0x51,0xDD,0x51,0xDD,0x51,0xDD,0x51,0xDC,0x59,0xBC,0x51,0xBC,0x49,0xBB,0x49,0x7A,0x41,0x7B,0x41,0x7A,0x41,0x79,0x41,0x79,0x41,0x79,0x41,0x79,0x41,
-	0x78,0x41,0xB7,0x41,0x76,0x41,0x76,0x41,0x75,0x41,0x53,0x41,0x53,0x41,0x53,0x41,0x71,0x41,0x50,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xEB,0x3F,0xF4,0x3F,0xF4,0x3F,0xEC,0x3F,0xF4,0x3F,0xF4,0x1F,0xE4,0x1F,0xE4,0xDF,0xDB,0xBE,0xD3,
-	0x9E,0xD3,0x5D,0xC3,0xB9,0xB2,0x37,0x92,0xF3,0x79,0xD2,0x79,0xB1,0x71,0xB1,0x71,0xD1,0x71,0x2D,0x72,0xD0,0x71,0xAF,0x61,0xEC,0x69,0x4C,0x49,0x4B,0x41,0x4A,0x41,0x0A,0x31,0x08,0x31,0x08,0x31,0xC7,0x28,0xC9,0x28,0xC9,0x28,0xCA,0x28,0xC7,0x28,0xC9,0x28,0xC9,0x28,0xC7,0x28,0xC7,0x28,0xC6,0x20,0xC6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0xA6,0x20,0xA5,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA9,0x20,0xA9,0x20,0xC9,0x20,0xA9,0x20,0xCA,0x28,0xCB,0x28,0xEB,0x30,0xEC,0x28,0xED,0x38,0x0E,0x39,0x0E,0x41,0x30,0x41,0x91,0x41,0x73,0x49,0x74,0x51,0xB5,0x61,0xD6,0x61,0x18,0x6A,0x19,0x6A,0x19,0x72,0x3B,0x7A,0x1B,0x7A,0x3B,0x7A,0x1C,0x7A,0x3C,0x7A,0x1C,0x7A,
-	0x5E,0x7A,0x5E,0x7A,0x3D,0x72,0x3D,0x72,0x3E,0x72,0x3E,0x62,0x3E,0x72,0x3E,0x72,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xDD,0x59,0xFD,0x51,0xDD,0x61,0xDD,0x51,0xDD,0x51,0xDD,0x51,0xFE,0x51,0xFE,0x51,0xDC,0x51,0xFE,0x51,0xDC,0x51,0xDC,0x51,0xDD,0x49,0xDC,0x51,0xDC,0x49,0xDD,0x49,0x9C,0x49,0xBB,0x49,0xBC,0x49,0xBB,0x51,
-	0xBA,0x49,0xBA,0x49,0xBA,0x51,0xF9,0x51,0x98,0x49,0xB7,0x49,0x95,0x51,0x74,0x49,0x74,0x41,0x92,0x41,0xB1,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xEC,0x3F,0xEC,0x3F,0xFC,0x3F,0xF4,0x3F,0xEC,0x3F,0xEC,0x3F,0xEC,0xDF,0xE3,0xBF,0xDB,0xBF,0xD3,0x7E,0xCB,
-	0x3B,0xBB,0x99,0xA2,0x35,0x92,0xD2,0x79,0xB2,0x71,0xB2,0x71,0xB1,0x71,0x0E,0x7A,0xF1,0x79,0x2D,0x72,0x8F,0x61,0x6C,0x51,0x4B,0x49,0x2B,0x39,0x0A,0x39,0xE9,0x28,0xC9,0x28,0xC7,0x28,0xC9,0x28,0xC9,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC9,0x28,0xC7,0x28,0xC9,0x28,0xA7,0x18,0xA6,0x20,0x66,0x10,0x65,0x10,0x65,0x10,
-	0x65,0x10,0x65,0x10,0x45,0x08,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x87,0x18,0x88,0x18,0x88,0x18,0xCA,0x28,0xCB,0x28,0xED,0x28,0xED,0x28,0x0F,0x31,0x0F,0x39,0x31,0x39,0x51,0x41,0x73,0x41,0x74,0x41,0x95,0x51,0xD9,0x61,0xD9,0x61,0x1A,0x72,0x1B,0x7A,0x1C,0x7A,0x3D,0x7A,0x5D,0x7A,0x5E,0x7A,
-	0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x72,0x3E,0x6A,0x3E,0x72,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x1E,0x5A,0x1D,0x62,0x1E,0x5A,0x1E,0x5A,0xFD,0x59,0x1D,0x5A,0xFE,0x51,0xFE,0x51,0x1E,0x5A,0xFE,0x51,0xFE,0x51,0xDD,0x49,0xFE,0x51,0xFE,0x51,0xDD,0x51,0xFE,0x51,0x1E,0x52,0x1E,0x52,0x1E,0x5A,0x1E,0x5A,
-	0x3D,0x5A,0x3D,0x5A,0x1D,0x5A,0x1B,0x62,0x1B,0x62,0xF9,0x59,0xD8,0x59,0xF8,0x51,0x95,0x51,0x74,0x51,0x92,0x41,0x91,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xEC,0x3F,0xFC,0x3F,0xF4,0x3F,0xFC,0x3F,0xF4,0x3F,0xE4,0xDF,0xEB,0xFF,0xE3,0x9E,0xDB,0x9E,0xD3,0x3E,0xCB,0xDC,0xBA,
-	0x78,0x9A,0xF4,0x81,0xD2,0x79,0xD2,0x79,0xB2,0x71,0xD1,0x71,0xEE,0x71,0xD0,0x71,0xED,0x69,0x6E,0x59,0x4B,0x41,0x2B,0x41,0x0B,0x39,0x09,0x31,0xEA,0x30,0xEA,0x30,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCC,0x28,0xCA,0x28,0xCA,0x28,0xC9,0x20,0xA9,0x20,0x67,0x10,0x66,0x10,0x87,0x10,0x66,0x08,0x66,0x08,0x66,0x08,
-	0x65,0x08,0x45,0x08,0x64,0x08,0x24,0x08,0x44,0x08,0x63,0x08,0x44,0x08,0x44,0x08,0x44,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x46,0x10,0x67,0x10,0x68,0x18,0x89,0x20,0xCC,0x20,0xCD,0x20,0xED,0x28,0x0F,0x29,0x11,0x29,0x12,0x29,0x32,0x39,0x34,0x31,0x55,0x39,0x98,0x51,0x99,0x49,0xFB,0x59,0x1B,0x62,0x1C,0x72,0x3E,0x72,0x5E,0x7A,
-	0x9E,0x82,0x9E,0x82,0x7E,0x7A,0x7E,0x7A,0x7E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x5E,0x72,0x5E,0x72,0x3E,0x6A,0x3E,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x1E,0x52,0x3E,0x62,0x1E,0x52,0x1E,0x52,0x3E,0x5A,0x3E,0x5A,0x3E,0x5A,0x3E,0x5A,0x5E,0x62,0x5E,0x62,0x5E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3D,0x62,0x3E,0x62,0x3C,0x6A,0xFA,0x61,0xD9,0x59,0xB6,0x51,0x73,0x41,0x70,0x39,0x6D,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xEC,0x3F,0xEC,0x3F,0xEC,0x3F,0xEC,0x3F,0xE4,0x1F,0xEC,0xDF,0xE3,0xBF,0xDB,0x9E,0xDB,0x9E,0xCB,0x3C,0xCB,0xFA,0xBA,0x76,0xA2,
-	0xF4,0x81,0xD2,0x71,0xB2,0x71,0xB2,0x71,0xF1,0x79,0x10,0x7A,0xD0,0x71,0xCE,0x69,0x4C,0x49,0x2B,0x39,0x0B,0x39,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xEA,0x30,0xEB,0x28,0xCC,0x28,0xEC,0x28,0xED,0x28,0xED,0x30,0xED,0x28,0xED,0x28,0xED,0x28,0xAC,0x18,0xAA,0x10,0x68,0x10,0x67,0x10,0x67,0x18,0x67,0x10,0x67,0x08,0x66,0x08,0x66,0x08,
-	0x66,0x08,0x45,0x08,0x65,0x08,0x44,0x08,0x43,0x08,0x43,0x08,0x23,0x08,0x23,0x08,0x44,0x08,0x64,0x08,0x44,0x08,0x44,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x47,0x10,0x68,0x18,0x6B,0x10,0x8D,0x18,0xCD,0x20,0xCF,0x20,0x12,0x29,0x31,0x31,0x34,0x31,0x35,0x31,0x56,0x39,0x77,0x41,0x79,0x41,0x9A,0x49,0xDB,0x59,0xDC,0x59,0x3E,0x6A,
-	0x3E,0x6A,0x5E,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x82,0xBE,0x82,0xBF,0x7A,0xBF,0x7A,0xBE,0x7A,0xBE,0x7A,0xBE,0x7A,0xBE,0x7A,0x9E,0x72,0x9E,0x72,0x5E,0x72,0x5E,0x72,0x5E,0x72,0x5E,0x62,0x5E,0x6A,0x5E,0x62,0x5E,0x62,0x5E,0x62,0x5E,0x62,0x5E,0x62,0x5E,0x62,0x5E,0x62,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7D,0x62,
-	0x5E,0x62,0x5E,0x72,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x3E,0x62,0x3D,0x62,0x3C,0x5A,0xF9,0x51,0xB6,0x51,0x53,0x41,0x0E,0x31,0xEA,0x20,0x65,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xF4,0x3F,0xEC,0x3F,0xE4,0x1F,0xEC,0x1F,0xE4,0x1F,0xE4,0xDF,0xDB,0xBE,0xD3,0x7E,0xCB,0x3C,0xCB,0xDB,0xB2,0x77,0x9A,0xF4,0x81,
-	0xD2,0x79,0xD2,0x79,0xB2,0x71,0xB2,0x71,0xD2,0x79,0x91,0x69,0x8F,0x59,0x4C,0x49,0x0D,0x41,0x0C,0x39,0x0C,0x39,0xCA,0x28,0xCA,0x28,0xCC,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x39,0x31,0x31,0x31,0x31,0x30,0x31,0xED,0x20,0xCD,0x20,0x8D,0x18,0x6B,0x10,0x6B,0x10,0x88,0x10,0x68,0x10,0x69,0x08,0x69,0x08,0x89,0x10,0x69,0x08,
-	0x68,0x08,0x67,0x08,0x67,0x08,0x65,0x08,0x64,0x08,0x43,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x44,0x00,0x63,0x08,0x64,0x08,0x44,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x27,0x08,0x68,0x10,0x4B,0x10,0x6C,0x18,0x6D,0x18,0xD0,0x20,0x12,0x29,0x54,0x31,0x35,0x31,0x35,0x31,0x77,0x31,0x77,0x39,0x7A,0x41,0x7A,0x41,0x7B,0x41,0x9C,0x49,
-	0xBC,0x51,0x1E,0x5A,0x3E,0x62,0x9E,0x72,0xBF,0x72,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x82,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0x7E,0x7A,0xDF,0x7A,0x7E,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x72,0xBF,0x6A,0x9F,0x6A,0xBF,0x6A,0xBF,0x6A,0xBF,0x72,0xBF,0x72,
-	0x9F,0x6A,0x7E,0x6A,0x7F,0x6A,0x5E,0x72,0x7E,0x6A,0x3E,0x62,0x1C,0x62,0x1B,0x62,0x98,0x51,0x54,0x41,0x0F,0x31,0xAA,0x20,0x46,0x10,0x23,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xEC,0x7F,0xF4,0x3F,0xE4,0x3F,0xE4,0x1F,0xE4,0x1F,0xE4,0xFF,0xD3,0xDF,0xCB,0x5E,0xCB,0x5E,0xBB,0xDA,0xB2,0x58,0x92,0xF3,0x81,0xD2,0x71,
-	0xD2,0x79,0xD2,0x79,0xB2,0x71,0xB2,0x71,0x91,0x69,0x90,0x61,0x4C,0x49,0x0E,0x41,0x0D,0x41,0xED,0x30,0xEC,0x28,0xCC,0x28,0xED,0x28,0x0F,0x29,0x10,0x29,0x10,0x29,0x10,0x31,0x31,0x39,0x51,0x39,0x31,0x31,0x11,0x29,0xAF,0x18,0x8E,0x18,0x6D,0x18,0x8C,0x10,0x8C,0x10,0x8C,0x10,0x8C,0x10,0x6C,0x08,0xAC,0x10,0xAC,0x10,0xAC,0x08,
-	0xAB,0x08,0x8A,0x08,0x89,0x08,0x88,0x10,0x65,0x08,0x64,0x08,0x63,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x44,0x08,0x24,0x08,0x25,0x08,0x66,0x08,0x27,0x08,0x47,0x08,0x29,0x08,0x6B,0x10,0x6D,0x18,0xAF,0x18,0xF1,0x20,0x13,0x29,0x35,0x31,0x57,0x31,0x77,0x31,0x79,0x39,0x7A,0x41,0x7B,0x41,0x7B,0x41,0x7C,0x41,
-	0x7D,0x41,0x7D,0x41,0x9D,0x41,0xFE,0x51,0x1E,0x5A,0x7E,0x6A,0x9F,0x6A,0xBF,0x72,0xDF,0x7A,0xFF,0x7A,0xDF,0x7A,0xDF,0x82,0xDF,0x82,0xDF,0x82,0xDF,0x7A,0xDF,0x82,0xDE,0x82,0xDE,0x82,0xDF,0x7A,0xDF,0x7A,0xDF,0x82,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xFF,0x7A,0xDF,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0xBF,0x72,0x9F,0x6A,
-	0xBF,0x72,0x7E,0x6A,0x7F,0x6A,0x7F,0x6A,0x3D,0x62,0x3D,0x5A,0xFB,0x51,0xB7,0x49,0x54,0x39,0x0F,0x31,0x8B,0x18,0x67,0x10,0x24,0x08,0x22,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xEC,0x5F,0xF4,0x3F,0xE4,0x3F,0xE4,0x3F,0xE4,0xDF,0xD3,0xFF,0xD3,0xDF,0xCB,0x5E,0xC3,0x1D,0xBB,0xBB,0xAA,0x37,0x8A,0xF3,0x81,0xD2,0x79,0xD2,0x79,
-	0xF3,0x81,0xF3,0x81,0xD2,0x79,0xB2,0x71,0x6F,0x59,0x4C,0x49,0x0E,0x41,0x0E,0x41,0xED,0x30,0xED,0x28,0xCD,0x20,0xCE,0x20,0xEE,0x28,0x31,0x31,0x31,0x31,0x32,0x31,0x54,0x39,0x54,0x39,0x13,0x29,0x11,0x29,0xD0,0x18,0x8F,0x10,0x8F,0x10,0xAF,0x18,0xB0,0x18,0xB0,0x10,0xB0,0x10,0xB0,0x10,0xB1,0x10,0xB1,0x08,0xD1,0x10,0xAF,0x10,
-	0xCF,0x10,0xAE,0x18,0xAB,0x08,0xA9,0x00,0x87,0x10,0x84,0x08,0x43,0x00,0x43,0x00,0x43,0x00,0x23,0x00,0x43,0x00,0x43,0x00,0x24,0x00,0x24,0x08,0x44,0x08,0x45,0x08,0x46,0x08,0x67,0x08,0x69,0x08,0x6B,0x08,0x6D,0x10,0x6F,0x10,0x8F,0x10,0xD2,0x18,0x13,0x29,0x56,0x29,0x78,0x31,0x79,0x39,0x5B,0x39,0x5B,0x39,0x5C,0x39,0x7D,0x41,
-	0x7D,0x39,0x7D,0x41,0x7D,0x41,0x7D,0x41,0xBD,0x41,0xDE,0x49,0x1E,0x52,0x3E,0x62,0x5E,0x62,0xBF,0x72,0xBF,0x72,0xFF,0x7A,0xDF,0x82,0x1F,0x7B,0xFF,0x82,0x1F,0x7B,0x1F,0x83,0x1F,0x7B,0xFF,0x82,0x3F,0x7B,0x3F,0x7B,0x3F,0x83,0x1F,0x7B,0x1F,0x7B,0xDF,0x7A,0xFF,0x72,0xDF,0x6A,0xDF,0x72,0xBF,0x72,0xBF,0x6A,0xBF,0x72,0xBF,0x72,
-	0x7F,0x6A,0x5F,0x62,0x5E,0x62,0x1C,0x52,0xBB,0x51,0x78,0x41,0x55,0x39,0x12,0x29,0xCF,0x18,0x6C,0x18,0x67,0x18,0x46,0x08,0x44,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xE4,0x5F,0xE4,0x5F,0xE4,0x3F,0xE4,0x3F,0xE4,0x1F,0xD4,0xDF,0xCB,0xDF,0xCB,0xBF,0xC3,0x3E,0xBB,0xBB,0xAA,0x38,0x8A,0xF4,0x71,0xF3,0x79,0xD2,0x79,0xF3,0x81,
-	0xF3,0x81,0xF3,0x81,0xB2,0x71,0x90,0x61,0x6E,0x51,0x2E,0x41,0x0E,0x41,0x0E,0x41,0xED,0x28,0xEF,0x20,0xF0,0x20,0x12,0x29,0x12,0x29,0x34,0x31,0x54,0x39,0x34,0x31,0x55,0x39,0x34,0x31,0x13,0x29,0xF1,0x18,0xD2,0x10,0xB0,0x10,0xB1,0x10,0xB2,0x10,0xD2,0x10,0xD4,0x10,0xD4,0x10,0xF5,0x10,0xD6,0x10,0xF6,0x10,0x15,0x11,0x13,0x19,
-	0x33,0x11,0xF0,0x18,0xEF,0x18,0xAB,0x08,0xA7,0x08,0x65,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x26,0x00,0x67,0x08,0x69,0x08,0x6C,0x10,0x8F,0x10,0x6F,0x10,0x70,0x10,0x71,0x10,0xD3,0x10,0xD6,0x18,0x18,0x21,0x5A,0x31,0x5B,0x39,0x5C,0x31,0x9C,0x31,0x7D,0x39,
-	0x7E,0x31,0x7E,0x31,0x7E,0x31,0x7E,0x31,0x9D,0x41,0xBE,0x41,0xDE,0x49,0x9D,0x41,0xDD,0x49,0xFE,0x49,0x1E,0x5A,0x5F,0x62,0x7F,0x6A,0xBF,0x6A,0xDF,0x6A,0xBF,0x6A,0xDF,0x7A,0x1F,0x7B,0xFF,0x7A,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x3F,0x7B,0x1F,0x73,0xFF,0x72,0xDF,0x6A,0xBF,0x6A,0xBF,0x62,0xBD,0x62,0x9F,0x5A,0x3F,0x5A,
-	0xFE,0x51,0xFD,0x49,0x9A,0x41,0x78,0x31,0x35,0x31,0xF3,0x18,0xD1,0x18,0x6E,0x10,0x6B,0x10,0x68,0x10,0x66,0x10,0x45,0x08,0x65,0x10,0x43,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xE4,0x7F,0xEC,0x3F,0xE4,0x3F,0xE4,0x3F,0xDC,0x1F,0xDC,0xFF,0xD3,0xDF,0xCB,0xBF,0xC3,0x3E,0xB3,0xFD,0xA2,0x58,0x92,0xF6,0x81,0xF3,0x81,0xF3,0x79,0xF3,0x81,0xF3,0x81,
-	0xF3,0x79,0xD3,0x79,0x91,0x69,0x6E,0x51,0x4E,0x49,0x0E,0x41,0x0E,0x39,0xEE,0x28,0xEE,0x28,0xF1,0x20,0xF2,0x20,0x35,0x31,0x35,0x31,0x56,0x39,0x77,0x41,0x77,0x41,0x77,0x39,0x36,0x29,0xF4,0x20,0xD3,0x10,0xD4,0x10,0xD5,0x10,0xD5,0x18,0xD6,0x18,0x17,0x19,0xF8,0x18,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x39,0x19,0x18,0x19,
-	0x36,0x19,0x52,0x11,0xF0,0x18,0xAD,0x10,0xA8,0x08,0x65,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x67,0x08,0x69,0x08,0x6D,0x10,0xAF,0x18,0xD1,0x18,0xB1,0x10,0x71,0x10,0xD3,0x10,0xD6,0x18,0xD7,0x18,0xF9,0x18,0x3B,0x21,0x5C,0x31,0x9D,0x31,0xBE,0x31,
-	0x9E,0x31,0xBE,0x39,0xDE,0x31,0xDE,0x41,0xBE,0x31,0xBE,0x39,0x7E,0x31,0xBE,0x31,0x9D,0x39,0xBD,0x41,0xDD,0x41,0xDD,0x41,0xDD,0x49,0x1D,0x52,0x1E,0x52,0x1E,0x52,0x7E,0x5A,0x7E,0x62,0x9F,0x62,0x9F,0x62,0x9F,0x62,0x9F,0x62,0xDF,0x6A,0x9F,0x62,0x9F,0x62,0x9F,0x5A,0x7E,0x52,0x7E,0x52,0x5E,0x52,0x1D,0x52,0xFD,0x49,0xBC,0x41,
-	0x59,0x39,0x58,0x29,0x18,0x21,0xF5,0x18,0xD4,0x18,0xB1,0x10,0x8E,0x10,0x6D,0x18,0x6B,0x10,0x68,0x10,0x66,0x10,0x66,0x10,0x65,0x10,0x44,0x08,0x43,0x08,0x22,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xEC,0x5F,0xE4,0x3F,0xE4,0x3F,0xE4,0x3F,0xDC,0x3F,0xD4,0xFF,0xD3,0xDF,0xCB,0xDF,0xC3,0xBF,0xB3,0x1D,0xB3,0x79,0x92,0xF6,0x79,0xF3,0x79,0xF4,0x71,0xF3,0x79,0xF5,0x81,0xF6,0x81,
-	0xF3,0x79,0xB2,0x69,0x6F,0x51,0x4F,0x41,0x50,0x41,0x30,0x41,0x31,0x31,0x11,0x29,0x12,0x29,0x14,0x29,0x35,0x31,0x78,0x39,0x79,0x41,0xDA,0x41,0x99,0x41,0x98,0x39,0x77,0x31,0x37,0x19,0xD6,0x18,0xF6,0x18,0x18,0x19,0x18,0x19,0x19,0x19,0x3A,0x21,0x3B,0x21,0x7C,0x21,0x9D,0x21,0x5D,0x29,0x7D,0x29,0x7D,0x29,0x9C,0x21,0x7C,0x21,
-	0x57,0x21,0x14,0x19,0x10,0x11,0xCB,0x00,0xA7,0x00,0x64,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x42,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x47,0x00,0x69,0x08,0x8D,0x10,0xB0,0x18,0xD2,0x10,0xB2,0x10,0xD4,0x10,0xD5,0x18,0xD6,0x18,0xD7,0x10,0xFA,0x10,0xFB,0x18,0x5C,0x29,0x5D,0x31,0xBE,0x31,
-	0xBE,0x31,0xDE,0x39,0xDE,0x31,0xDE,0x31,0xBE,0x39,0x7E,0x31,0xDF,0x31,0xBE,0x31,0xDF,0x31,0xBE,0x31,0xDE,0x39,0xBD,0x39,0xBE,0x39,0xBE,0x39,0xDD,0x49,0xDD,0x49,0xBD,0x39,0xBD,0x39,0xDD,0x41,0xDD,0x41,0xDD,0x41,0xDD,0x41,0xDD,0x49,0xDD,0x39,0xDD,0x39,0xDD,0x39,0xBC,0x39,0xBD,0x39,0x7C,0x31,0x5C,0x29,0x5B,0x29,0x1A,0x21,
-	0x19,0x21,0x19,0x21,0xD6,0x18,0xD4,0x18,0xD2,0x10,0xB0,0x18,0x6E,0x10,0x8D,0x18,0x6B,0x10,0x68,0x10,0x88,0x10,0x87,0x10,0x66,0x10,0x65,0x10,0x64,0x10,0x64,0x08,0x43,0x08,0x22,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xDC,0x5F,0xDC,0x3F,0xDC,0x5F,0xD4,0x1F,0xDC,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x9E,0xC3,0x1D,0xA3,0x7A,0x92,0x17,0x82,0xF6,0x71,0xF4,0x79,0x16,0x82,0x16,0x82,0x35,0x92,0xF4,0x79,
-	0xD3,0x69,0x70,0x59,0x50,0x41,0x4F,0x49,0x51,0x39,0x31,0x31,0x11,0x29,0x13,0x29,0x14,0x29,0x56,0x39,0x79,0x39,0x9A,0x41,0xDD,0x41,0xFC,0x49,0x9B,0x39,0x79,0x29,0x18,0x19,0x19,0x21,0x19,0x19,0x19,0x19,0x19,0x21,0x3B,0x19,0x7C,0x29,0x7C,0x29,0xBD,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBD,0x29,0xBD,0x29,
-	0x77,0x21,0x34,0x11,0xAD,0x08,0x88,0x00,0x86,0x00,0x64,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x26,0x00,0x49,0x00,0x6C,0x10,0xAF,0x18,0xD2,0x10,0xD4,0x10,0xD5,0x18,0xD7,0x10,0xD7,0x10,0xD9,0x08,0xFB,0x18,0xFB,0x10,0x1B,0x11,0x3C,0x21,0x5E,0x29,
-	0xBE,0x31,0xDF,0x31,0xDF,0x31,0xDE,0x39,0xDF,0x31,0xDE,0x31,0xDE,0x31,0xDE,0x31,0xBE,0x31,0xBE,0x31,0x7E,0x31,0xDF,0x31,0xDF,0x31,0xBD,0x31,0xDF,0x31,0xBD,0x31,0xDE,0x31,0xBD,0x31,0x9D,0x31,0x9D,0x31,0x9D,0x31,0xBE,0x31,0x9D,0x31,0x9D,0x31,0x7D,0x31,0x5D,0x29,0x7D,0x29,0x5C,0x29,0x5D,0x29,0x5C,0x29,0x5C,0x29,0x3B,0x21,
-	0xFA,0x18,0xF7,0x18,0xD6,0x18,0xD3,0x10,0xD2,0x10,0xAF,0x18,0xAE,0x18,0x8D,0x10,0xAB,0x10,0xAB,0x10,0x89,0x08,0x88,0x18,0xA7,0x18,0xA7,0x18,0x66,0x10,0x65,0x10,0x65,0x08,0x63,0x08,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xEC,0x5F,0xDC,0x7F,0xDC,0x3F,0xDC,0x1F,0xD4,0xFF,0xD3,0xDF,0xCB,0xBE,0xC3,0xBE,0xBB,0x1D,0xB3,0x9A,0x9A,0x17,0x82,0x17,0x82,0xF6,0x79,0x16,0x82,0xF4,0x81,0x35,0x8A,0x16,0x82,0xD3,0x71,
-	0x73,0x59,0x52,0x41,0x51,0x41,0x51,0x41,0x31,0x39,0x12,0x29,0x13,0x29,0x56,0x31,0x57,0x31,0x79,0x39,0xBC,0x41,0x1C,0x4A,0xFE,0x41,0xDD,0x39,0x5C,0x31,0x1B,0x19,0xFA,0x18,0x3B,0x21,0x3B,0x21,0x3B,0x21,0x9C,0x29,0xBD,0x29,0xBD,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x1E,0x2A,0x1E,0x2A,0xDF,0x29,0xDF,0x29,0xBE,0x29,0xBD,0x29,
-	0x36,0x11,0xD2,0x08,0xAB,0x00,0x67,0x00,0x64,0x00,0x83,0x00,0x62,0x00,0x82,0x00,0x82,0x00,0x81,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x27,0x00,0x4A,0x00,0x8F,0x10,0xD2,0x10,0xD5,0x18,0xD7,0x18,0xD9,0x08,0xDA,0x10,0x1B,0x11,0x1B,0x11,0xFC,0x10,0x1B,0x11,0x3D,0x11,0x3C,0x21,
-	0x5E,0x29,0x7E,0x29,0xDF,0x31,0xDE,0x39,0xDF,0x31,0xDE,0x39,0xDE,0x39,0xDE,0x39,0xBE,0x31,0xBE,0x31,0xBD,0x31,0xBD,0x31,0xDF,0x31,0x7E,0x31,0xDF,0x31,0x7E,0x31,0xBE,0x31,0xBE,0x31,0x5D,0x29,0x9E,0x29,0x9D,0x29,0x7D,0x29,0x9D,0x29,0x9D,0x29,0x5D,0x29,0x7D,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5D,0x29,0x3B,0x21,
-	0x1A,0x19,0x19,0x19,0xD6,0x18,0xD5,0x18,0xD2,0x10,0xD1,0x18,0xAF,0x18,0xAE,0x10,0xAC,0x18,0xAC,0x10,0xAB,0x10,0xAA,0x10,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x86,0x10,0x86,0x10,0x65,0x10,0x63,0x08,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xD4,0x7F,0xD4,0x3F,0xDC,0x3F,0xD4,0x3F,0xD4,0xDF,0xCB,0xBF,0xC3,0xBF,0xB3,0x3E,0xB3,0xBB,0x92,0x17,0x82,0xF6,0x79,0xF6,0x79,0x17,0x82,0x17,0x82,0x59,0x92,0x38,0x8A,0xF6,0x79,0xB2,0x69,
-	0x73,0x49,0x73,0x41,0x74,0x41,0x53,0x39,0x13,0x29,0x14,0x29,0x56,0x31,0x79,0x39,0x7A,0x41,0xDC,0x41,0xFD,0x49,0x3F,0x4A,0xFE,0x39,0x5D,0x29,0x3C,0x21,0x3C,0x19,0x3C,0x21,0x3D,0x19,0x5E,0x19,0x9E,0x29,0xBE,0x29,0xDE,0x29,0xDE,0x29,0x3F,0x2A,0x3F,0x2A,0x1F,0x32,0x3F,0x2A,0x3F,0x2A,0xFF,0x29,0xBE,0x29,0x9D,0x21,0x39,0x19,
-	0x15,0x11,0xAF,0x08,0x8A,0x00,0x66,0x00,0x63,0x00,0xA3,0x00,0x61,0x00,0x81,0x00,0xA1,0x00,0xA2,0x00,0xA1,0x00,0x82,0x00,0x62,0x00,0x42,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x27,0x00,0x29,0x00,0x6C,0x08,0xB2,0x10,0xD5,0x18,0x18,0x19,0xFB,0x18,0x1C,0x11,0x3E,0x19,0x3C,0x11,0x1D,0x11,0x1D,0x11,0x1E,0x11,0x3E,0x19,
-	0x3E,0x19,0x3E,0x21,0x5E,0x29,0xBF,0x31,0xDF,0x31,0x1F,0x3A,0x1F,0x3A,0xFF,0x31,0xFF,0x39,0xDF,0x31,0xDE,0x31,0xBE,0x31,0xBD,0x31,0xBD,0x31,0xBE,0x31,0xDF,0x31,0xBE,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0x7E,0x29,0xBE,0x29,0x9E,0x29,0x9E,0x29,0x7E,0x29,0x7E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5D,0x29,0x5C,0x29,
-	0x3B,0x21,0x1A,0x19,0xD2,0x30,0xCF,0x20,0x14,0x19,0xF2,0x18,0xD1,0x10,0xAF,0x18,0xAF,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0xAB,0x10,0xA9,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x86,0x10,0x63,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xD4,0x7F,0xD4,0x9F,0xD4,0x9F,0xD4,0xFF,0xCB,0xFF,0xCB,0xDF,0xC3,0xBF,0xB3,0x5E,0xB3,0xDC,0x9A,0x59,0x8A,0x17,0x7A,0x18,0x72,0x17,0x82,0x17,0x82,0x58,0x8A,0x59,0x92,0x17,0x82,0xD5,0x69,0x94,0x59,
-	0x74,0x41,0x74,0x49,0x74,0x41,0x34,0x31,0x14,0x29,0x17,0x21,0x79,0x39,0x7B,0x41,0xBD,0x41,0xFD,0x49,0x1E,0x42,0xFE,0x41,0x5E,0x31,0x5D,0x29,0x3C,0x21,0x3D,0x19,0x3E,0x21,0x7E,0x29,0xBE,0x29,0xBE,0x29,0xDE,0x29,0x1F,0x2A,0x3E,0x2A,0x3F,0x32,0x5F,0x32,0x9F,0x32,0x7F,0x32,0x3F,0x2A,0xDE,0x29,0xBD,0x29,0x3B,0x11,0xF8,0x08,
-	0x13,0x01,0xAE,0x00,0xAA,0x00,0x87,0x00,0x83,0x00,0xA3,0x00,0x82,0x00,0xA2,0x00,0xA2,0x00,0xA2,0x00,0xA3,0x00,0xA3,0x00,0x83,0x00,0x62,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x28,0x00,0x4A,0x00,0x6F,0x08,0xD4,0x10,0xF8,0x18,0x1B,0x19,0x3D,0x19,0x3E,0x19,0x3E,0x19,0x1E,0x11,0x1E,0x11,0x1E,0x11,0x3E,0x19,
-	0x3E,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x21,0xBE,0x29,0xDF,0x31,0x1F,0x3A,0xFF,0x31,0x1F,0x3A,0x1F,0x3A,0xDD,0x39,0x1E,0x3A,0xBD,0x31,0xBD,0x31,0xBE,0x31,0xDF,0x31,0xBE,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x5E,0x29,0x9E,0x29,0x7E,0x29,0x5D,0x29,0x5D,0x29,
-	0x7C,0x29,0x8C,0x28,0x00,0xC8,0x00,0x68,0x16,0x19,0x34,0x19,0xF3,0x20,0xD1,0x18,0xF0,0x20,0xD0,0x18,0xAE,0x18,0xCD,0x20,0xAB,0x10,0xAB,0x18,0xAA,0x10,0xA9,0x20,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x65,0x10,0x63,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD4,0x7F,0xD4,0x5F,0xCC,0x3F,0xC4,0x1F,0xC4,0xDF,0xC3,0xBF,0xB3,0x5F,0xAB,0x1D,0x9B,0x59,0x8A,0x18,0x72,0x17,0x7A,0x18,0x82,0x39,0x82,0x5A,0x8A,0x5A,0x8A,0x38,0x8A,0xF6,0x79,0x95,0x59,0x52,0x41,
-	0x75,0x51,0x75,0x41,0x56,0x39,0x35,0x31,0x78,0x31,0x79,0x39,0x7B,0x41,0xBD,0x41,0xFE,0x41,0x3F,0x42,0x1F,0x4A,0xBE,0x31,0x5D,0x29,0x5D,0x29,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xBE,0x29,0xDF,0x29,0x3F,0x2A,0x5F,0x32,0x9F,0x3A,0x7E,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x7F,0x32,0x3F,0x22,0xBE,0x21,0x5C,0x11,0x3A,0x11,0x37,0x09,
-	0xF4,0x00,0xF0,0x08,0xAB,0x00,0xA7,0x00,0x65,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x83,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x26,0x00,0x27,0x00,0x29,0x00,0x4D,0x00,0x71,0x08,0xB7,0x08,0x1B,0x19,0x3D,0x19,0x3E,0x19,0x3E,0x19,0x5E,0x19,0x5E,0x19,0x3E,0x11,0x1E,0x11,
-	0x5E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x21,0x9E,0x29,0xBE,0x29,0xFF,0x39,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x42,0x3F,0x3A,0xFD,0x31,0x3E,0x32,0x3E,0x32,0xDF,0x29,0x1F,0x2A,0xDF,0x29,0xDF,0x29,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xDF,0x31,0xBE,0x29,0xBE,0x29,0x7E,0x29,0x9E,0x29,0x5E,0x29,
-	0xF0,0x30,0x00,0xB8,0x01,0xC0,0x67,0x30,0x19,0x21,0x37,0x19,0x36,0x19,0x34,0x19,0xF1,0x18,0xF1,0x20,0xCF,0x18,0xCE,0x18,0xCD,0x20,0xCD,0x20,0xAA,0x20,0xAA,0x18,0xAA,0x10,0xA8,0x18,0xA7,0x18,0x66,0x08,0x85,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD4,0x9F,0xD4,0x7F,0xD4,0x5F,0xC4,0x3F,0xC4,0xDF,0xBB,0xDF,0xB3,0x5F,0xAB,0x1D,0x9B,0xBC,0x92,0x18,0x7A,0x18,0x72,0x18,0x72,0x38,0x82,0x5A,0x82,0x9B,0x92,0x9B,0x92,0x39,0x7A,0xB5,0x61,0x74,0x51,0x74,0x49,
-	0x76,0x41,0x77,0x41,0x35,0x31,0x38,0x21,0x79,0x39,0x7B,0x41,0xDD,0x41,0xFE,0x49,0x3F,0x42,0x3F,0x42,0x1F,0x3A,0x9E,0x29,0x5C,0x29,0x5D,0x29,0x9D,0x29,0x9E,0x29,0xBE,0x29,0x1E,0x2A,0xFF,0x29,0x3F,0x2A,0x7F,0x3A,0xBF,0x3A,0x9E,0x42,0xBF,0x3A,0xBF,0x3A,0x9F,0x3A,0x3E,0x2A,0xBE,0x21,0x5E,0x19,0xFC,0x10,0xFB,0x10,0x19,0x11,
-	0x15,0x01,0x11,0x01,0xED,0x00,0xA8,0x00,0xA6,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xE3,0x00,0xE3,0x00,0xA3,0x00,0xE3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x43,0x00,0x44,0x00,0x25,0x00,0x26,0x00,0x47,0x00,0x28,0x00,0x2C,0x00,0x6F,0x08,0x74,0x00,0xFA,0x10,0x5C,0x21,0x5E,0x19,0x5E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x19,
-	0x5E,0x19,0x5E,0x19,0x5E,0x19,0x3E,0x19,0x5E,0x19,0x5E,0x19,0x7E,0x29,0xBE,0x29,0xFF,0x31,0x3F,0x42,0x7F,0x42,0x7F,0x42,0x3F,0x42,0x7F,0x3A,0x3F,0x3A,0x3F,0x3A,0x5F,0x3A,0x5F,0x3A,0x3F,0x3A,0x5F,0x3A,0x3F,0x32,0x3F,0x32,0x1F,0x2A,0x5F,0x3A,0xFF,0x31,0xFF,0x31,0x1F,0x2A,0xBE,0x29,0xDF,0x31,0xBE,0x29,0xBE,0x29,0xCD,0x20,
-	0x00,0xA0,0x00,0xD0,0x67,0x38,0x7C,0x29,0x5B,0x29,0x59,0x29,0x17,0x21,0x34,0x19,0x33,0x19,0xF1,0x18,0xF1,0x20,0xF0,0x20,0xCD,0x20,0xCD,0x20,0xCD,0x20,0xAB,0x10,0xAA,0x10,0xA8,0x18,0xA8,0x18,0x87,0x10,0x65,0x08,0x64,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD4,0x7F,0xCC,0x5F,0xC4,0x1F,0xC4,0xDF,0xC3,0xDF,0xB3,0x7F,0xAB,0x3E,0xA3,0xDC,0x92,0x3A,0x7A,0x39,0x72,0x18,0x7A,0x3A,0x7A,0x5B,0x8A,0xBC,0x9A,0xDC,0x92,0x5B,0x82,0xF7,0x69,0x75,0x51,0x75,0x41,0x76,0x41,
-	0x77,0x39,0x36,0x31,0x18,0x21,0x5A,0x39,0x7D,0x41,0xBD,0x41,0xFE,0x49,0x3F,0x4A,0x3F,0x4A,0xDE,0x41,0xBE,0x29,0x7D,0x29,0x5C,0x29,0x9D,0x29,0xBE,0x29,0xDE,0x29,0xDE,0x29,0x3F,0x2A,0x7F,0x2A,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x9F,0x32,0x3F,0x2A,0xBE,0x21,0x7E,0x19,0x1E,0x11,0x3C,0x09,0x1C,0x11,0x3A,0x09,
-	0x38,0x11,0x53,0x09,0x30,0x09,0x0B,0x01,0xA7,0x00,0xA5,0x00,0xA4,0x08,0xE3,0x08,0xA4,0x08,0xA4,0x08,0xA3,0x08,0xA3,0x08,0xA4,0x00,0x84,0x00,0x64,0x00,0x64,0x00,0x44,0x00,0x65,0x00,0x26,0x00,0x26,0x00,0x29,0x00,0x2B,0x00,0x6E,0x08,0x73,0x00,0xD7,0x08,0x1B,0x09,0x5E,0x21,0xBE,0x21,0x9E,0x19,0x9E,0x19,0x7E,0x19,0x7E,0x19,
-	0x7E,0x19,0x7E,0x19,0x5E,0x19,0x5E,0x19,0x5E,0x19,0x5E,0x21,0x5E,0x19,0x9E,0x21,0x9E,0x29,0x1E,0x2A,0x1F,0x3A,0x3F,0x3A,0x3F,0x3A,0x5F,0x42,0x9F,0x42,0x7F,0x3A,0x5F,0x42,0x7F,0x3A,0x5F,0x3A,0x5F,0x3A,0x7F,0x3A,0x7F,0x3A,0x5F,0x3A,0x5F,0x3A,0x7F,0x3A,0x3F,0x32,0x3F,0x3A,0x3F,0x32,0xDE,0x29,0xDE,0x29,0x77,0x31,0x00,0xA0,
-	0x00,0xD8,0x45,0x30,0x7E,0x29,0x7D,0x29,0x7C,0x29,0x3B,0x19,0x58,0x21,0x36,0x19,0x34,0x19,0x13,0x19,0xF1,0x20,0xF1,0x20,0xCF,0x20,0xAE,0x18,0xAD,0x18,0xAB,0x10,0xAA,0x10,0xA8,0x10,0x88,0x18,0x87,0x18,0x86,0x10,0x65,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xD4,0x7F,0xC4,0x5F,0xCC,0x3F,0xC4,0xDF,0xBB,0xDF,0xB3,0xBF,0xAB,0x5F,0xA3,0x1E,0x9B,0x7B,0x82,0x39,0x72,0x3A,0x7A,0x3A,0x7A,0x5B,0x82,0x9C,0x92,0xFD,0x9A,0xDC,0x92,0x3A,0x7A,0x95,0x51,0x75,0x49,0x77,0x41,0x79,0x41,
-	0x77,0x39,0x59,0x31,0x5B,0x31,0x5C,0x31,0xBD,0x41,0xFE,0x41,0x3F,0x42,0x3F,0x42,0x1F,0x3A,0x9E,0x31,0x7E,0x29,0x7D,0x29,0x9D,0x29,0xBE,0x29,0xBD,0x31,0x1E,0x2A,0x3F,0x3A,0x7F,0x3A,0xBF,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x9F,0x3A,0x3E,0x2A,0xBE,0x21,0x7E,0x19,0x7E,0x11,0x5E,0x11,0x5E,0x11,0x5D,0x11,0x5C,0x09,
-	0x3B,0x11,0x37,0x11,0x51,0x09,0xCD,0x00,0xE8,0x00,0xA7,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x87,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x69,0x00,0x4B,0x00,0x6E,0x08,0x73,0x00,0x96,0x00,0xFB,0x08,0x5D,0x11,0x7E,0x19,0xBE,0x21,0xBE,0x21,0xBE,0x21,0x9E,0x21,
-	0x9E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x19,0x5E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x29,0x5E,0x29,0xBE,0x29,0xDF,0x31,0x1F,0x32,0x5F,0x3A,0x5F,0x3A,0x9F,0x3A,0x7F,0x42,0x7F,0x42,0xBF,0x3A,0xBF,0x3A,0x9F,0x42,0x9F,0x42,0x7F,0x3A,0x7F,0x3A,0x7F,0x3A,0x7F,0x3A,0x3F,0x3A,0x7F,0x32,0x1F,0x2A,0xCD,0x18,0x65,0x90,0x00,0xD8,
-	0x45,0x50,0x7C,0x29,0x5E,0x29,0x5D,0x29,0x5C,0x29,0x19,0x21,0x58,0x21,0x36,0x19,0x34,0x19,0x13,0x19,0xF1,0x20,0xCF,0x18,0xAF,0x18,0xAE,0x18,0xAD,0x18,0xAB,0x10,0xAA,0x10,0xA9,0x10,0x88,0x10,0x88,0x10,0x66,0x08,0x65,0x08,0x65,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xCC,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x3F,0xBC,0xDF,0xB3,0xDF,0xAB,0x9F,0xA3,0x3E,0x9B,0xBC,0x8A,0x5B,0x82,0x39,0x72,0x39,0x72,0x5B,0x82,0x9C,0x8A,0xDD,0x92,0xDE,0x92,0x7B,0x82,0xD8,0x61,0x75,0x49,0x77,0x41,0x9A,0x49,0x79,0x39,
-	0x5A,0x39,0x39,0x29,0x7B,0x41,0x9D,0x39,0xDE,0x49,0xDE,0x41,0x3F,0x42,0x1F,0x42,0x9E,0x31,0x5E,0x29,0x5E,0x29,0x9D,0x29,0xBD,0x29,0xFE,0x29,0xFF,0x29,0x3F,0x3A,0x9F,0x3A,0xBF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x9F,0x32,0x3E,0x2A,0xFD,0x21,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7F,0x11,0x7E,0x11,0x7E,0x09,0x9D,0x11,
-	0xBC,0x11,0x59,0x11,0x54,0x09,0xEE,0x00,0xCA,0x00,0x09,0x01,0xA7,0x00,0xA7,0x00,0xE8,0x00,0x09,0x01,0x2A,0x01,0x2A,0x01,0x0A,0x01,0x0A,0x01,0xE9,0x00,0xA8,0x00,0xA8,0x00,0x87,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x4B,0x00,0x6E,0x08,0x72,0x00,0xB7,0x00,0xDB,0x08,0x3C,0x09,0x5E,0x11,0x9F,0x19,0xBE,0x21,0xBE,0x19,0xBE,0x19,
-	0xBE,0x21,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x19,0x7E,0x19,0x5E,0x21,0x5E,0x21,0x7E,0x21,0xBE,0x29,0xBE,0x29,0x1F,0x2A,0x1F,0x3A,0xBF,0x3A,0xBF,0x3A,0x9F,0x42,0x9F,0x3A,0x9F,0x3A,0xBF,0x3A,0x5F,0x3A,0x5F,0x3A,0x7F,0x3A,0x7F,0x3A,0x5F,0x3A,0xFF,0x31,0x77,0x29,0x65,0x70,0x00,0xE8,0x45,0x68,
-	0xBE,0x29,0x9E,0x29,0x5D,0x29,0x5C,0x29,0x5B,0x21,0x39,0x21,0x38,0x19,0x36,0x19,0x13,0x19,0xD2,0x10,0xD0,0x18,0xD0,0x18,0xAE,0x18,0xAD,0x18,0xAC,0x10,0xAB,0x10,0x8A,0x08,0x88,0x10,0x68,0x08,0x68,0x08,0x86,0x10,0x66,0x08,0x65,0x08,0x64,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xC4,0x5F,0xC4,0x5F,0xC4,0x3F,0xBC,0xDF,0xB3,0xDF,0xAB,0x7F,0xA3,0x3E,0xA3,0xDD,0x92,0x5B,0x82,0x39,0x72,0x1B,0x7A,0x5B,0x82,0x7D,0x8A,0xDE,0x92,0xDF,0x92,0xBD,0x8A,0x1B,0x72,0x97,0x49,0x79,0x41,0x99,0x49,0x7A,0x41,0x79,0x39,
-	0x5B,0x31,0x5C,0x39,0x9D,0x39,0xDD,0x41,0x1E,0x42,0x1F,0x42,0x1E,0x42,0x9E,0x31,0x5C,0x29,0x5E,0x29,0x5E,0x29,0xBD,0x29,0xDE,0x29,0x5F,0x32,0x3D,0x3A,0xBF,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x9F,0x3A,0x3E,0x2A,0xBD,0x19,0x9D,0x19,0x9E,0x19,0x9E,0x19,0x9F,0x11,0xBE,0x11,0xBE,0x11,0xBE,0x19,0xBE,0x19,
-	0xBD,0x19,0x5A,0x19,0x54,0x09,0xEF,0x08,0x0C,0x01,0x09,0x01,0xA8,0x00,0xE8,0x00,0x09,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x0A,0x01,0xCA,0x00,0xEA,0x00,0xA9,0x00,0xA9,0x00,0xA8,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x6A,0x00,0x6D,0x08,0x92,0x00,0xB7,0x00,0xDB,0x08,0xFC,0x08,0x3E,0x09,0x7F,0x11,0x9E,0x19,0xBE,0x21,0xBE,0x21,
-	0xBE,0x19,0xBE,0x19,0xBE,0x21,0xBE,0x21,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x19,0x7E,0x19,0x5E,0x19,0x7E,0x19,0x5E,0x19,0x7E,0x19,0x9E,0x29,0xBE,0x29,0xBE,0x29,0xDE,0x29,0x3F,0x2A,0x5F,0x2A,0x7F,0x32,0x7F,0x3A,0x7F,0x32,0x5F,0x3A,0x9F,0x3A,0x3F,0x3A,0x5F,0x2A,0x3F,0x2A,0xFF,0x29,0x00,0x60,0x00,0xE8,0x45,0x70,0x5C,0x29,
-	0x5D,0x29,0x5C,0x29,0x3C,0x21,0x3A,0x19,0x19,0x19,0x37,0x19,0xD5,0x10,0xD3,0x10,0xD1,0x18,0x8F,0x10,0xAE,0x08,0x6B,0x08,0x8B,0x08,0x6A,0x08,0x6A,0x08,0x69,0x08,0x68,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x67,0x08,0x66,0x08,0x65,0x08,0x64,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xC4,0x5F,0xC4,0x5F,0xBC,0x5F,0xBC,0xFF,0xB3,0xDF,0xB3,0xBF,0xAB,0x5F,0xA3,0x3E,0x9B,0x9C,0x8A,0x1B,0x72,0x3B,0x7A,0x5B,0x82,0x7D,0x82,0xDE,0x92,0xDF,0x92,0xDE,0x92,0x9D,0x82,0xB8,0x59,0x78,0x49,0x9A,0x49,0x9A,0x49,0x5A,0x39,0x3A,0x29,
-	0x5C,0x31,0x5C,0x31,0xBE,0x39,0xDE,0x41,0x3F,0x42,0x1F,0x3A,0xFE,0x39,0x9D,0x29,0x5D,0x29,0x5E,0x29,0xBE,0x29,0xFD,0x21,0x3F,0x2A,0x7F,0x3A,0xBF,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x7F,0x32,0x1E,0x22,0xFD,0x19,0xBD,0x19,0x9E,0x11,0xBE,0x19,0xBF,0x19,0xBE,0x19,0xDE,0x11,0xFE,0x19,0xDE,0x19,0x1E,0x1A,
-	0xBD,0x19,0x99,0x11,0x35,0x09,0x31,0x09,0x0D,0x01,0xEB,0x00,0xE9,0x00,0xC7,0x00,0x2A,0x01,0x2A,0x01,0x2B,0x01,0x2D,0x09,0x2C,0x01,0x2C,0x01,0xEA,0x00,0x0A,0x01,0xCA,0x08,0xA8,0x08,0xA8,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6E,0x08,0x92,0x08,0xD7,0x08,0xDB,0x08,0xFC,0x08,0x3E,0x09,0x5F,0x11,0x9E,0x11,0xBE,0x19,0x1E,0x22,
-	0xDE,0x21,0xDE,0x21,0xBE,0x19,0xBE,0x19,0x9E,0x21,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x9E,0x21,0x9E,0x21,0x9E,0x21,0x9E,0x21,0x9E,0x21,0xBE,0x29,0xDE,0x21,0x9E,0x21,0x9E,0x21,0x9E,0x21,0x7C,0x21,0x45,0x60,0x00,0xD8,0x25,0x80,0x6C,0x10,0x1B,0x11,
-	0xFA,0x10,0xFA,0x10,0xD8,0x08,0xB6,0x10,0xB6,0x08,0xB3,0x08,0x92,0x08,0xB0,0x08,0x6D,0x08,0x6C,0x08,0x4B,0x00,0x2A,0x00,0x48,0x00,0x48,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x46,0x08,0x66,0x08,0x66,0x08,0x45,0x08,0x45,0x08,0x44,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x5F,0xB4,0xDF,0xB3,0xDF,0xAB,0xBF,0xA3,0x5F,0x9B,0xBE,0x8A,0x3B,0x7A,0x1B,0x72,0x3D,0x7A,0x5D,0x82,0xBE,0x8A,0xDE,0x92,0xDF,0x92,0xBE,0x8A,0xFA,0x69,0x99,0x49,0x99,0x49,0x9A,0x49,0x9B,0x41,0x5B,0x31,0x5B,0x31,
-	0x5C,0x31,0xBE,0x31,0xDE,0x39,0x1F,0x42,0x3F,0x42,0xDF,0x31,0x9D,0x29,0x5D,0x29,0x7D,0x29,0xBE,0x29,0xBE,0x29,0x1E,0x2A,0x9F,0x32,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x7F,0x32,0x3E,0x22,0xDD,0x19,0xBD,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x1E,0x1A,0x3F,0x22,0x1E,0x1A,0x3F,0x22,0xDD,0x19,
-	0xBC,0x19,0x99,0x09,0x36,0x09,0x32,0x09,0x2F,0x09,0xCC,0x00,0x0A,0x01,0xC8,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2D,0x01,0x2C,0x01,0x2A,0x01,0xC8,0x31,0x97,0xA5,0x77,0xA5,0xC8,0x31,0x67,0x00,0x67,0x00,0x68,0x00,0x6A,0x00,0x6C,0x08,0x91,0x08,0xD5,0x08,0x1A,0x09,0xFC,0x08,0x3E,0x09,0x3E,0x09,0x3E,0x09,0xBE,0x19,0xFE,0x21,
-	0x1E,0x22,0x1E,0x22,0xDE,0x21,0x1E,0x22,0xBE,0x21,0xBE,0x19,0x9E,0x19,0x7E,0x19,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5C,0x11,0x7E,0x19,0x7E,0x19,0x5D,0x11,0x3C,0x11,0x3C,0x11,0x3C,0x11,0x45,0x40,0x00,0xD8,0x00,0x98,0xB5,0x18,0xDB,0x08,0xD9,0x08,
-	0xD7,0x10,0xD7,0x08,0x75,0x08,0x93,0x08,0x92,0x08,0x71,0x08,0x90,0x08,0x6E,0x08,0x6D,0x08,0x6C,0x08,0x4B,0x00,0x49,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x46,0x00,0x66,0x08,0x45,0x08,0x45,0x00,0x45,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xC4,0x5F,0xB4,0x5F,0xB4,0x3F,0xB4,0xDF,0xB3,0xDF,0xAB,0xBF,0xA3,0x5F,0x9B,0xDE,0x92,0x5C,0x82,0x1C,0x7A,0x1C,0x7A,0x5E,0x82,0x7D,0x92,0xDF,0x92,0xDF,0x92,0x1F,0x93,0x9D,0x7A,0xD9,0x59,0x79,0x41,0x9A,0x49,0xBC,0x41,0x5C,0x39,0x5C,0x31,0x5C,0x31,
-	0x7C,0x31,0xDE,0x41,0xDE,0x41,0x3F,0x42,0xFF,0x39,0x7D,0x29,0x5C,0x29,0x5E,0x29,0x7E,0x29,0xBE,0x29,0xFF,0x29,0x5F,0x2A,0x9F,0x3A,0xBF,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x7F,0x32,0x1E,0x22,0xBD,0x19,0xBD,0x19,0xBE,0x19,0xDE,0x19,0xDE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xDD,0x11,
-	0x9B,0x09,0x59,0x09,0x57,0x09,0x75,0x09,0x51,0x09,0x2E,0x09,0xCB,0x00,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0xE8,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xC7,0x31,0x66,0x00,0x68,0x00,0x49,0x00,0x6C,0x08,0x91,0x08,0xB5,0x08,0xD8,0x08,0x3C,0x09,0x3E,0x11,0x3F,0x11,0x5E,0x09,0x7E,0x11,0xBE,0x21,
-	0xDE,0x21,0x1E,0x22,0x3E,0x22,0xDE,0x21,0x1E,0x1A,0xDE,0x21,0xBE,0x21,0xBF,0x19,0xBE,0x21,0xBE,0x19,0x9E,0x19,0x9F,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x5E,0x11,0x3E,0x11,0x1C,0x11,0x3E,0x11,0xFC,0x10,0x25,0x30,0x00,0xD8,0x00,0x98,0xFD,0x10,0xFC,0x10,0xDB,0x08,0xD7,0x08,
-	0xD7,0x08,0x95,0x08,0xB4,0x00,0x93,0x00,0x72,0x08,0x71,0x08,0x6F,0x08,0x6E,0x08,0x8D,0x00,0x6C,0x08,0x6B,0x00,0x49,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x45,0x00,0x45,0x00,0x45,0x08,0x45,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xBC,0x5F,0xB4,0xFF,0xB3,0x3F,0xB4,0xDF,0xAB,0xDF,0xAB,0x7F,0xA3,0x3F,0x93,0x7E,0x82,0x1C,0x7A,0x1C,0x7A,0x3D,0x7A,0x9E,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x1B,0x72,0x9A,0x49,0x79,0x41,0xBB,0x41,0xBC,0x41,0x5B,0x31,0x5C,0x29,0x5C,0x31,
-	0x9D,0x31,0xDE,0x31,0x1F,0x3A,0xFF,0x31,0xBE,0x29,0x5C,0x29,0x5E,0x29,0x9E,0x29,0xBE,0x29,0xFE,0x21,0x3F,0x3A,0x9F,0x32,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x9F,0x3A,0x3E,0x22,0xDD,0x19,0xBD,0x19,0xFD,0x19,0xBE,0x19,0x1E,0x1A,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x1E,0x1A,0xBD,0x09,
-	0x9A,0x09,0x59,0x09,0x98,0x09,0x96,0x09,0x74,0x09,0x51,0x09,0x2D,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x97,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x56,0xA5,0x66,0x00,0x67,0x00,0x6A,0x00,0x6C,0x00,0x90,0x08,0xB3,0x08,0xD8,0x08,0x1C,0x09,0x5D,0x09,0x3F,0x11,0x5E,0x09,0x7E,0x09,0x7E,0x11,
-	0xBE,0x19,0xFE,0x21,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x1E,0x22,0xDE,0x21,0xFE,0x19,0xBE,0x21,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x9E,0x19,0x7E,0x19,0x9E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x5E,0x11,0x3E,0x11,0x5E,0x11,0x5E,0x11,0x25,0x30,0x00,0xC8,0x00,0xA8,0x90,0x20,0xFC,0x10,0xFC,0x10,0xDB,0x08,0xD7,0x08,
-	0xB6,0x08,0xB5,0x08,0x94,0x00,0x93,0x08,0xB2,0x08,0xB1,0x08,0x6F,0x08,0x6E,0x08,0x6D,0x08,0x6C,0x08,0x6B,0x00,0x6A,0x00,0x68,0x00,0x47,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x45,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xB4,0x5F,0xB4,0x3E,0xAC,0x3E,0xAC,0xBE,0xA3,0xDF,0xAB,0x9F,0xA3,0x5F,0x9B,0xBF,0x8A,0x5D,0x7A,0x1C,0x7A,0x3D,0x7A,0x5E,0x82,0xBE,0x8A,0xDF,0x92,0xDF,0x92,0x1F,0x93,0x5D,0x82,0xFB,0x59,0x78,0x41,0x7A,0x41,0xBC,0x41,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,
-	0xDF,0x31,0xFF,0x39,0x1F,0x3A,0xBE,0x29,0x7D,0x21,0x5D,0x29,0x7E,0x29,0xBE,0x29,0xBE,0x29,0x3F,0x2A,0x9F,0x3A,0xBF,0x3A,0xDF,0x42,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x7F,0x32,0x1E,0x22,0xBE,0x21,0xBE,0x19,0xBE,0x19,0x1E,0x1A,0xDE,0x19,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x3F,0x22,0x3F,0x22,0x1E,0x1A,0x9D,0x09,0x5C,0x09,
-	0x5B,0x09,0x9A,0x09,0xB9,0x09,0xB7,0x09,0xB6,0x09,0x93,0x09,0x2E,0x09,0x2B,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x39,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x67,0x00,0x6A,0x00,0x8D,0x00,0xB0,0x08,0xB3,0x08,0xD6,0x08,0x3A,0x09,0x5D,0x09,0x5E,0x09,0x5E,0x09,0x7E,0x09,0x7E,0x11,
-	0x9E,0x11,0xBE,0x21,0x1E,0x1A,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0xDE,0x19,0xDE,0x19,0xFE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x9F,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,0x3C,0x11,0xD6,0x20,0x00,0xB0,0x00,0xD0,0x6D,0x28,0xFC,0x10,0xFD,0x10,0xFC,0x10,0xDB,0x08,0xD7,0x08,
-	0xD7,0x08,0xD7,0x08,0xD5,0x08,0xB3,0x08,0x92,0x08,0x91,0x08,0x71,0x08,0x8F,0x08,0x6E,0x08,0x6E,0x08,0x6B,0x08,0x6B,0x08,0x69,0x00,0x47,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x45,0x00,0x65,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xB4,0x5F,0xB4,0x3E,0xAC,0xDE,0xAB,0xBE,0xA3,0xBF,0x9B,0x5F,0x9B,0x3F,0x8B,0x5E,0x82,0x1C,0x7A,0x1C,0x7A,0x5E,0x7A,0xBE,0x8A,0xDF,0x92,0xDF,0x92,0xFF,0x92,0xBE,0x8A,0x5C,0x72,0x99,0x49,0x7A,0x41,0x9C,0x41,0x9D,0x39,0x5C,0x31,0x5C,0x29,0x5D,0x31,0x9E,0x31,
-	0xDF,0x31,0xDF,0x31,0xDE,0x31,0x7C,0x29,0x3E,0x19,0x7E,0x29,0x7E,0x29,0xBE,0x29,0x1F,0x2A,0x5F,0x32,0x9F,0x3A,0xDF,0x42,0xDF,0x42,0xBF,0x3A,0x9F,0x3A,0x7F,0x32,0x1E,0x22,0xBD,0x19,0xBE,0x19,0xBE,0x19,0xDE,0x19,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x1E,0x1A,0xBE,0x09,0x9D,0x09,0x5C,0x09,
-	0x7B,0x09,0x9A,0x09,0xBA,0x09,0xB9,0x09,0xB8,0x09,0xB6,0x09,0x51,0x09,0x2B,0x01,0x2A,0x01,0x2A,0x01,0x2A,0x01,0x46,0x01,0x2A,0x01,0x39,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x67,0x00,0x6A,0x00,0xCD,0x00,0xB0,0x08,0xB3,0x08,0xB6,0x08,0x39,0x09,0x3B,0x09,0x3E,0x11,0x7E,0x11,0x5E,0x09,0x5E,0x09,
-	0x7E,0x09,0x7E,0x11,0xBE,0x19,0x1F,0x22,0x3F,0x22,0x5F,0x2A,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x1E,0x1A,0x1E,0x1A,0xDE,0x19,0x1E,0x1A,0xBE,0x19,0xBE,0x19,0xBE,0x21,0xBE,0x21,0xBE,0x19,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x16,0x21,0x00,0xB8,0x00,0xD8,0xD0,0x38,0x5E,0x19,0x1E,0x11,0x1D,0x11,0x1C,0x11,0x1B,0x11,0xD9,0x08,
-	0xD8,0x08,0xD7,0x08,0xD6,0x08,0xD6,0x10,0xB4,0x08,0xB3,0x08,0x71,0x08,0x71,0x08,0x90,0x08,0x6E,0x08,0x6D,0x08,0x6B,0x08,0x69,0x00,0x68,0x00,0x46,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x65,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xB4,0x5F,0xB4,0x1E,0xAC,0xDE,0xAB,0xBF,0xA3,0xBF,0xA3,0x3F,0x93,0xDE,0x8A,0x3D,0x7A,0x1C,0x7A,0x5E,0x7A,0x5E,0x82,0xDF,0x92,0xDF,0x92,0xFF,0x92,0xDF,0x92,0x7E,0x82,0xDA,0x61,0x7A,0x41,0x7A,0x41,0xBD,0x41,0x5C,0x31,0x5C,0x29,0x5C,0x29,0x7E,0x31,0xDF,0x31,
-	0xDF,0x31,0xDF,0x31,0x9E,0x29,0x5D,0x21,0x5E,0x19,0x9E,0x29,0xBE,0x29,0xDE,0x29,0x5E,0x2A,0x9F,0x3A,0xBF,0x3A,0xBF,0x3A,0xBF,0x3A,0x9F,0x3A,0x7F,0x32,0x1E,0x22,0xBD,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x1E,0x1A,0xBE,0x09,0x7D,0x09,0x5D,0x09,0x7C,0x09,
-	0x5B,0x09,0xBB,0x09,0xBB,0x09,0xBA,0x09,0xB8,0x11,0xB6,0x11,0x51,0x09,0x2D,0x01,0x2A,0x01,0x09,0x01,0x46,0x01,0x2A,0x01,0x08,0x01,0x58,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x67,0x00,0x8B,0x00,0xCF,0x08,0xB1,0x08,0xB3,0x08,0xD4,0x08,0xD7,0x08,0x39,0x09,0x3C,0x11,0x7E,0x11,0x7E,0x11,0x1E,0x11,
-	0x7E,0x09,0x7E,0x09,0x7E,0x11,0xBE,0x19,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0xDE,0x19,0x1F,0x1A,0xDE,0x19,0xBE,0x21,0xBE,0x21,0xBE,0x19,0x67,0x10,0x00,0x98,0x00,0xD0,0x67,0x40,0x39,0x11,0x7E,0x19,0x7E,0x11,0x5E,0x11,0x3C,0x11,0x3C,0x11,0x3B,0x11,
-	0x3A,0x09,0x39,0x09,0xF9,0x08,0xD7,0x08,0xD6,0x10,0xD5,0x08,0xB3,0x08,0xB3,0x08,0x72,0x08,0x91,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x69,0x00,0x48,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xB4,0xFF,0xAB,0xDE,0xAB,0xDE,0xAB,0x9F,0x9B,0x5F,0x9B,0x3F,0x93,0x5D,0x7A,0x1C,0x7A,0x3D,0x7A,0x5E,0x7A,0xBF,0x8A,0xDF,0x92,0x3F,0x93,0xDF,0x92,0xDF,0x8A,0x1B,0x72,0x9A,0x49,0x7A,0x41,0x9B,0x39,0x9C,0x39,0x5C,0x29,0x5C,0x29,0x5D,0x29,0x7E,0x31,0xDF,0x31,
-	0xDF,0x31,0x7E,0x29,0x5D,0x19,0x5D,0x19,0x5E,0x21,0x9E,0x29,0xBE,0x21,0x3E,0x22,0x5F,0x3A,0x9F,0x3A,0xDF,0x42,0xBF,0x3A,0xBF,0x3A,0x7F,0x2A,0x3E,0x22,0xDD,0x19,0xBD,0x19,0xBE,0x19,0xBE,0x19,0x1F,0x22,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x1E,0x1A,0x9E,0x09,0x7D,0x09,0x5C,0x09,0x5B,0x09,0x5A,0x09,
-	0x9A,0x09,0xBB,0x09,0xB9,0x09,0xB9,0x09,0xB7,0x09,0x95,0x09,0x51,0x09,0x2B,0x01,0x2A,0x01,0xC7,0x00,0x09,0x01,0x46,0x01,0xE8,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x66,0x00,0x68,0x00,0xAC,0x00,0xCF,0x08,0xB2,0x08,0xF4,0x00,0xF4,0x00,0xD5,0x08,0xF8,0x08,0x5B,0x09,0x5C,0x11,0x7E,0x11,0x5E,0x11,
-	0x7E,0x09,0x7E,0x11,0x7E,0x09,0x9E,0x11,0xDE,0x19,0x1F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x3E,0x22,0xBE,0x19,0xFE,0x21,0x58,0x29,0x01,0x88,0x00,0xE0,0x00,0x50,0xBE,0x19,0x7E,0x19,0x9E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x5D,0x11,0x3C,0x09,
-	0x3B,0x09,0x1B,0x11,0x3A,0x09,0xD9,0x08,0xD8,0x08,0xD6,0x08,0xD5,0x08,0xB4,0x08,0x92,0x08,0x71,0x08,0x70,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x69,0x00,0x27,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xB4,0x3F,0xAC,0x3F,0x9C,0xDF,0xA3,0xBF,0xA3,0x9F,0x9B,0x3F,0x93,0xBE,0x82,0x1C,0x7A,0x1C,0x6A,0x5E,0x7A,0x7E,0x82,0xDF,0x8A,0xDF,0x92,0x1F,0x93,0xDF,0x92,0x5D,0x82,0xFB,0x59,0x7A,0x41,0x7A,0x41,0xBC,0x41,0x7D,0x31,0x3C,0x21,0x3C,0x21,0x5E,0x29,0xBE,0x31,0xDF,0x31,
-	0xBE,0x29,0x5E,0x21,0x3D,0x19,0x5E,0x21,0x9E,0x19,0xBE,0x29,0x1E,0x22,0x3F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x7F,0x32,0x3E,0x2A,0xFE,0x19,0xBE,0x19,0xBE,0x19,0xFE,0x19,0x1E,0x1A,0x1E,0x1A,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x1F,0x22,0xFE,0x19,0x9E,0x11,0x5C,0x09,0x5B,0x09,0x5A,0x09,0x59,0x09,0x38,0x09,
-	0x58,0x09,0x58,0x09,0x97,0x09,0x96,0x09,0x94,0x09,0x52,0x09,0x2D,0x09,0x2A,0x01,0xE8,0x00,0xA7,0x00,0x09,0x01,0x09,0x01,0xE8,0x00,0x39,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x87,0x00,0x88,0x00,0xAE,0x00,0x11,0x09,0x13,0x01,0x14,0x01,0xD4,0x00,0xD6,0x00,0x18,0x09,0x3A,0x09,0x7C,0x11,0x7D,0x11,0x7E,0x11,
-	0x5E,0x11,0x5E,0x11,0x7F,0x11,0x7F,0x11,0x9E,0x11,0xBE,0x19,0x1E,0x1A,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3E,0x22,0x3E,0x22,0xB8,0x19,0x00,0x70,0x00,0xE8,0x87,0x58,0xDE,0x21,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,
-	0x5C,0x09,0x3C,0x09,0x3B,0x11,0xFA,0x08,0xD9,0x08,0xD7,0x08,0xD6,0x08,0xD5,0x08,0xB4,0x08,0x72,0x08,0x71,0x08,0x6F,0x08,0x6D,0x08,0x6C,0x08,0x6B,0x08,0x69,0x08,0x27,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x9C,0x3F,0x9C,0xFF,0xA3,0xBF,0x9B,0xBF,0x9B,0x5F,0x93,0xFF,0x8A,0x5D,0x7A,0xFC,0x69,0x1C,0x72,0x9E,0x82,0xBE,0x82,0xDF,0x8A,0xDF,0x92,0x1F,0x93,0xDF,0x92,0x5C,0x72,0x99,0x49,0x7A,0x41,0x7A,0x39,0xBD,0x39,0x5C,0x29,0x3C,0x21,0x5D,0x29,0x5E,0x29,0x9E,0x29,0x7E,0x29,
-	0x5E,0x21,0x3E,0x19,0x5D,0x19,0x9E,0x21,0xBE,0x29,0xFE,0x29,0x5F,0x2A,0x7F,0x32,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x7F,0x2A,0x1E,0x22,0xBE,0x19,0x9E,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x21,0x3F,0x22,0x3E,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xBE,0x19,0x5D,0x09,0xFC,0x08,0x3A,0x09,0xF9,0x08,0x38,0x09,0x37,0x09,0x35,0x01,
-	0x55,0x01,0x53,0x01,0x14,0x01,0x12,0x09,0x31,0x09,0x2F,0x09,0xCB,0x00,0xC8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x09,0x01,0x39,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0xA8,0x00,0xAA,0x00,0xCE,0x00,0x31,0x09,0x54,0x09,0x36,0x01,0xF5,0x00,0xD5,0x00,0xD7,0x08,0x59,0x09,0x3B,0x11,0x5C,0x11,0x7D,0x11,
-	0x7E,0x11,0x7E,0x11,0x7F,0x11,0x7E,0x11,0x7E,0x09,0x7E,0x11,0xBE,0x11,0x1E,0x1A,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x7F,0x32,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0xD9,0x21,0x21,0x70,0x00,0xD8,0x00,0x60,0xB8,0x21,0x1E,0x1A,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x9E,0x19,0x7E,0x19,0x7E,0x11,0x7E,0x11,
-	0x7D,0x11,0x5D,0x09,0x3C,0x09,0xFC,0x10,0x39,0x09,0xD9,0x08,0xD7,0x08,0xD6,0x08,0xB5,0x00,0x93,0x00,0x72,0x08,0x71,0x08,0x6E,0x08,0x6D,0x08,0x6B,0x08,0x6A,0x08,0x68,0x08,0x26,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xA4,0x1F,0x9C,0xFF,0x9B,0xBF,0xA3,0x5F,0x9B,0x3F,0x93,0xBE,0x7A,0x1C,0x72,0x1C,0x6A,0x5E,0x7A,0x5E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x92,0xBE,0x82,0xFA,0x61,0x7A,0x41,0x7A,0x41,0x9D,0x39,0x9C,0x31,0x3C,0x21,0x3D,0x19,0x5E,0x29,0x5E,0x29,0x9E,0x29,0x5E,0x21,
-	0x3E,0x19,0x7E,0x19,0x7E,0x19,0x9E,0x21,0xDE,0x21,0x3E,0x22,0x7F,0x2A,0x9F,0x3A,0x9F,0x3A,0x9F,0x3A,0x7F,0x32,0x1E,0x22,0xBE,0x21,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xDF,0x19,0x1F,0x22,0x1E,0x22,0xFE,0x21,0x3F,0x22,0x1E,0x22,0xBE,0x21,0x7D,0x19,0x5C,0x11,0x1A,0x09,0xD8,0x08,0xD7,0x08,0x16,0x09,0xD5,0x08,0x33,0x01,0x13,0x01,
-	0xD1,0x08,0xD0,0x08,0x0F,0x01,0xCE,0x00,0xAD,0x00,0xAB,0x00,0xA9,0x00,0xA7,0x00,0x86,0x00,0xA4,0x00,0xA7,0x00,0xA7,0x00,0xE8,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0xA8,0x00,0xAB,0x00,0xCE,0x00,0x52,0x09,0x56,0x09,0x37,0x09,0x37,0x09,0x16,0x09,0xF6,0x08,0x17,0x09,0x39,0x09,0x3B,0x11,0x7D,0x11,
-	0x7E,0x11,0x7E,0x11,0x7E,0x09,0x7F,0x11,0x9E,0x09,0x9E,0x09,0xBE,0x11,0xBE,0x11,0xBE,0x11,0x1E,0x1A,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x7F,0x32,0x5F,0x2A,0x7F,0x2A,0x5F,0x2A,0xD9,0x21,0x51,0x59,0x00,0xD8,0x22,0x90,0xD8,0x21,0x3E,0x22,0x3E,0x22,0x1E,0x1A,0xBE,0x21,0xBE,0x19,0xBE,0x19,0x9E,0x19,0x7E,0x11,0x9E,0x11,0x7E,0x11,
-	0x9E,0x09,0x7E,0x11,0x3D,0x09,0x1C,0x09,0xFB,0x08,0xD9,0x08,0xD8,0x08,0xD7,0x08,0xB6,0x00,0x75,0x00,0x72,0x08,0x71,0x08,0x70,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x69,0x08,0x46,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x9C,0x3F,0x9C,0x1F,0x9C,0xBF,0x9B,0x9F,0x9B,0x3F,0x8B,0xDF,0x82,0x5D,0x72,0xFD,0x69,0x3D,0x72,0x5E,0x7A,0xBE,0x82,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x8A,0x5D,0x7A,0xBA,0x51,0x7A,0x41,0x7A,0x41,0xBD,0x39,0x5C,0x29,0x1B,0x19,0x3D,0x21,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x3E,0x19,
-	0x1E,0x11,0x5E,0x19,0x7E,0x19,0xBE,0x21,0xFE,0x21,0x5F,0x2A,0x7F,0x2A,0x9F,0x3A,0x9F,0x3A,0x7F,0x2A,0x3E,0x22,0xDE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x21,0xBE,0x19,0x1F,0x22,0xDE,0x21,0x3E,0x22,0x1E,0x22,0x1E,0x22,0xBE,0x21,0x9C,0x19,0x3B,0x11,0xD9,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD3,0x08,0xD1,0x08,0xD0,0x08,0xCF,0x08,
-	0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0x69,0x00,0x68,0x00,0x87,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0xA5,0x00,0xA7,0x00,0xA7,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0xCA,0x00,0xAB,0x00,0xEF,0x08,0x32,0x09,0x97,0x09,0x78,0x09,0x37,0x09,0x16,0x09,0xF5,0x08,0x17,0x09,0x38,0x09,0x59,0x09,0x5B,0x09,
-	0x7E,0x11,0xBE,0x09,0x9E,0x11,0x9E,0x09,0x7E,0x09,0x7E,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x11,0xBE,0x09,0xDD,0x11,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x5F,0x2A,0x7F,0x32,0x7F,0x2A,0xA7,0x50,0x00,0xE0,0x00,0x88,0xD9,0x29,0x5F,0x2A,0x3E,0x22,0x3E,0x22,0x3E,0x22,0x1E,0x1A,0xBE,0x19,0xBE,0x19,0x9E,0x19,0x9E,0x19,0x9E,0x19,0x7E,0x11,
-	0x7E,0x09,0x7E,0x11,0x5E,0x09,0x1D,0x09,0xFC,0x10,0x1A,0x09,0xD8,0x08,0xD7,0x08,0xB6,0x00,0x75,0x00,0x73,0x00,0x71,0x08,0x70,0x08,0x6E,0x08,0x6D,0x08,0x6B,0x08,0x69,0x08,0x68,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x9C,0x3F,0x9C,0xFF,0x9B,0xBF,0x9B,0x7F,0x93,0x1F,0x8B,0x9E,0x72,0x3C,0x6A,0xFD,0x69,0x5E,0x7A,0x7E,0x7A,0xDF,0x8A,0xDF,0x8A,0xFF,0x92,0x1F,0x93,0xDF,0x82,0xFB,0x69,0x9A,0x49,0x7A,0x41,0x5B,0x31,0x7C,0x31,0x3B,0x21,0x3C,0x21,0x3D,0x19,0x5E,0x29,0x3E,0x21,0x3E,0x19,0x1C,0x11,
-	0x3E,0x19,0x7E,0x19,0xBE,0x29,0x1E,0x22,0x3E,0x22,0x5F,0x2A,0x7F,0x32,0x7F,0x32,0x7F,0x32,0x3E,0x22,0xFD,0x19,0x9D,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xFE,0x19,0xDE,0x19,0x1E,0x22,0x1E,0x22,0xFE,0x21,0xBD,0x21,0x9C,0x19,0xFA,0x10,0xD8,0x08,0xD6,0x08,0xB5,0x08,0x92,0x08,0x90,0x08,0xAF,0x08,0xAE,0x00,0xAC,0x00,0x8A,0x00,
-	0x6A,0x00,0x69,0x00,0x68,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x86,0x00,0xA7,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0xEA,0x00,0xAB,0x00,0xCE,0x00,0x32,0x09,0x97,0x09,0x99,0x09,0x79,0x09,0x38,0x09,0x37,0x09,0x37,0x09,0x38,0x09,0x39,0x09,0x3A,0x09,
-	0x5C,0x09,0x7E,0x11,0xBE,0x11,0x7E,0x11,0x9E,0x09,0x9E,0x09,0x9E,0x09,0xBE,0x09,0xBE,0x09,0xBD,0x09,0xBE,0x09,0xBE,0x09,0x1E,0x1A,0x3F,0x22,0x3F,0x22,0x5F,0x2A,0x00,0x38,0x00,0xD8,0x22,0xA8,0x87,0x20,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0x1E,0x22,0x1E,0x1A,0xBE,0x21,0xBE,0x19,0xBE,0x21,0x7E,0x19,0x7E,0x19,0x7E,0x11,
-	0x7E,0x11,0x7E,0x11,0x5E,0x11,0x1D,0x11,0xFC,0x10,0xDB,0x08,0xD9,0x08,0xD8,0x08,0xB6,0x08,0x75,0x00,0x72,0x00,0x72,0x08,0x71,0x08,0x6F,0x08,0x6D,0x08,0x6B,0x00,0x6A,0x08,0x48,0x08,0x47,0x08,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x94,0xDF,0x93,0xBF,0x9B,0xBF,0x9B,0x3F,0x8B,0xDF,0x7A,0x3D,0x72,0xFD,0x61,0x3E,0x62,0x5E,0x7A,0xBE,0x82,0xDF,0x8A,0xDF,0x92,0xFF,0x92,0xFF,0x8A,0x7E,0x7A,0xFB,0x61,0x7A,0x41,0x7A,0x41,0x5B,0x31,0x5C,0x29,0xFB,0x18,0x1B,0x19,0x3D,0x21,0x3E,0x19,0x3F,0x19,0x1E,0x11,0x1E,0x11,
-	0x5E,0x11,0x9E,0x19,0xBE,0x29,0x1E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0x3E,0x22,0xDD,0x19,0x9C,0x11,0x9D,0x11,0x9E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x1E,0x22,0xDE,0x21,0x1E,0x22,0xBE,0x21,0x9C,0x19,0xFA,0x08,0xD7,0x08,0xD6,0x08,0xB3,0x08,0x91,0x08,0x8F,0x08,0x8D,0x00,0x6B,0x00,0x6A,0x00,0x69,0x00,0x68,0x00,
-	0x67,0x00,0x67,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x44,0x00,0x64,0x00,0x63,0x00,0x43,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x85,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0xCA,0x00,0xCB,0x00,0xEE,0x08,0x31,0x01,0x96,0x01,0x99,0x11,0x99,0x09,0x79,0x09,0x37,0x09,0x37,0x09,0x38,0x09,0xF7,0x08,0x39,0x09,
-	0x5B,0x09,0x9D,0x11,0xBE,0x11,0xBE,0x11,0xBE,0x11,0xBE,0x09,0x9E,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x11,0xBE,0x09,0xDE,0x09,0xDE,0x19,0xED,0x38,0x00,0xC8,0x00,0xB8,0x87,0x20,0x3F,0x22,0x3F,0x22,0x3F,0x22,0x3F,0x22,0xDE,0x19,0xBE,0x21,0xBE,0x19,0xBE,0x19,0xBD,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x11,0x5C,0x09,
-	0x5C,0x09,0x5C,0x09,0x1C,0x11,0x1C,0x11,0xDB,0x08,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xB6,0x08,0x75,0x00,0x94,0x00,0x72,0x08,0x71,0x08,0x71,0x08,0x8E,0x08,0x6C,0x08,0x6A,0x00,0x69,0x08,0x47,0x08,0x26,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x94,0x1F,0x94,0x1F,0x94,0xBF,0x93,0x5F,0x8B,0x1F,0x83,0xBE,0x7A,0x3E,0x6A,0x1D,0x62,0x5E,0x6A,0x5E,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5D,0x7A,0x99,0x41,0x78,0x31,0x79,0x39,0x5B,0x31,0x5A,0x31,0xFA,0x18,0x3C,0x21,0x3E,0x21,0x3E,0x21,0x1E,0x11,0x1E,0x11,0x3E,0x11,
-	0x7E,0x19,0x9E,0x21,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x7F,0x32,0x3F,0x22,0xFE,0x19,0x9D,0x11,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xDE,0x19,0x1E,0x22,0x1F,0x22,0xBE,0x21,0x9D,0x21,0x3C,0x11,0xFA,0x10,0xD7,0x08,0xD4,0x08,0x93,0x08,0x90,0x08,0x8E,0x08,0x6B,0x08,0x6A,0x00,0x69,0x00,0x68,0x00,0x67,0x00,0x46,0x00,
-	0x45,0x00,0x45,0x00,0x24,0x00,0x44,0x00,0x44,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x43,0x00,0x43,0x00,0x44,0x00,0x18,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0xC9,0x00,0xAB,0x00,0x0D,0x01,0xEF,0x08,0x54,0x09,0xB8,0x09,0xBA,0x11,0x7A,0x09,0x58,0x09,0x37,0x09,0x37,0x09,0x17,0x09,0x18,0x09,
-	0x59,0x09,0x5B,0x09,0x7E,0x11,0xBE,0x11,0x9E,0x09,0x9E,0x11,0xBE,0x09,0xBE,0x09,0x9E,0x09,0xBE,0x11,0x9D,0x09,0x9E,0x09,0x7E,0x09,0x9E,0x11,0xF0,0x20,0x00,0xC8,0x00,0xC0,0x36,0x21,0x9E,0x11,0x9E,0x11,0x9E,0x11,0x9E,0x11,0x9E,0x11,0x9D,0x11,0x5D,0x11,0x5D,0x09,0x5D,0x09,0x3C,0x09,0x3B,0x09,0x3B,0x09,0x3B,0x09,0xFB,0x10,
-	0x39,0x09,0xD9,0x08,0x19,0x09,0x19,0x09,0xD8,0x08,0xD8,0x08,0xD7,0x08,0xB7,0x08,0x96,0x08,0x95,0x08,0x94,0x00,0x72,0x08,0x71,0x08,0x71,0x08,0x6E,0x08,0x6C,0x08,0x6A,0x08,0x49,0x08,0x68,0x08,0x26,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x94,0xDF,0x93,0xBF,0x8B,0x9F,0x83,0x3F,0x8B,0x1F,0x83,0x7E,0x6A,0x1D,0x62,0x1E,0x62,0x5E,0x7A,0xBF,0x7A,0xDF,0x8A,0xDF,0x92,0x1F,0x93,0xDF,0x8A,0xBE,0x82,0xFC,0x61,0x79,0x41,0x77,0x31,0x78,0x31,0x39,0x29,0x19,0x19,0xF9,0x10,0xFB,0x18,0x3E,0x19,0x1E,0x11,0xFC,0x10,0x1E,0x11,0x5E,0x11,
-	0x7E,0x19,0xBE,0x21,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x5F,0x2A,0x5F,0x2A,0xDE,0x21,0x9E,0x11,0x7E,0x11,0x9E,0x11,0xBE,0x19,0xBE,0x19,0xFE,0x19,0x3F,0x22,0xDE,0x21,0xBE,0x21,0xBD,0x19,0x5C,0x21,0xFA,0x08,0xD7,0x08,0xD5,0x08,0x92,0x08,0x6F,0x08,0x8E,0x08,0x8B,0x00,0x69,0x08,0x68,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x25,0x00,
-	0x24,0x00,0x24,0x00,0x23,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x42,0x00,0x22,0x00,0x22,0x00,0x44,0x00,0xF8,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0xA9,0x00,0xAB,0x00,0x0E,0x09,0xEF,0x08,0x33,0x01,0xB7,0x09,0xBA,0x11,0xBA,0x09,0x98,0x09,0x37,0x09,0x37,0x09,0x17,0x09,0x17,0x09,
-	0x38,0x09,0x5A,0x09,0x5B,0x09,0x9D,0x11,0xBE,0x11,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x9E,0x09,0x9E,0x09,0x9D,0x09,0x7D,0x09,0x9E,0x09,0x8D,0x18,0x00,0xB0,0x00,0xC0,0x45,0x28,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x3C,0x09,0x3C,0x09,0xFC,0x08,0x1B,0x09,0xFA,0x08,0x1A,0x09,0xF9,0x08,0xD9,0x08,0xD8,0x08,
-	0xD7,0x08,0xD6,0x08,0xD7,0x08,0x96,0x00,0xB7,0x00,0x75,0x00,0x75,0x00,0x73,0x08,0x74,0x00,0x73,0x08,0x72,0x08,0x72,0x08,0x71,0x08,0x71,0x08,0x6F,0x08,0x6C,0x08,0x6B,0x00,0x4A,0x08,0x69,0x08,0x47,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x94,0xFF,0x8B,0xBF,0x8B,0x9F,0x83,0x3F,0x83,0xBE,0x72,0x3D,0x62,0xFD,0x61,0x3E,0x72,0x7E,0x6A,0xDF,0x82,0xDF,0x8A,0x1F,0x93,0xDF,0x92,0xFF,0x8A,0x9D,0x7A,0xDA,0x59,0x77,0x39,0x77,0x31,0x78,0x31,0x18,0x21,0xF8,0x18,0xF8,0x18,0xFB,0x10,0x3C,0x11,0xFC,0x10,0xFD,0x10,0x1E,0x11,0x5E,0x11,
-	0x9E,0x19,0xBE,0x21,0x3E,0x22,0x3E,0x22,0x5F,0x2A,0x3F,0x22,0xFE,0x21,0x9E,0x19,0x7E,0x11,0x9E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xDE,0x19,0x1F,0x22,0x1E,0x22,0x9D,0x19,0x3B,0x19,0x19,0x11,0xD6,0x10,0xB4,0x08,0xB2,0x08,0x8F,0x08,0x6D,0x08,0x6B,0x00,0x69,0x00,0x67,0x00,0x46,0x00,0x25,0x00,0x24,0x00,0x44,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0xF8,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x87,0x00,0xCB,0x00,0x0D,0x01,0x2E,0x09,0x32,0x01,0x75,0x09,0xBA,0x11,0xBA,0x09,0xB9,0x09,0x98,0x09,0x37,0x09,0x34,0x01,0x35,0x01,
-	0xF6,0x00,0x18,0x09,0x59,0x09,0x9B,0x09,0xBE,0x11,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x16,0x19,0x45,0x90,0x00,0xD8,0x45,0x38,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x3C,0x09,0x1C,0x09,0xFB,0x08,0x3A,0x09,0x19,0x09,0xD9,0x08,0xD8,0x08,0xD8,0x08,0xD7,0x08,0xD7,0x08,
-	0xD6,0x08,0x95,0x00,0x94,0x00,0xB4,0x00,0x74,0x00,0x72,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x92,0x08,0x71,0x08,0x71,0x08,0x71,0x08,0x70,0x08,0x6C,0x08,0x6B,0x00,0x6A,0x08,0x69,0x08,0x68,0x08,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x3F,0x94,0xDF,0x93,0xBF,0x83,0xBF,0x83,0x3F,0x83,0xFF,0x7A,0x5E,0x6A,0x1D,0x62,0xFD,0x61,0x5E,0x6A,0xBE,0x7A,0xDF,0x82,0xDF,0x8A,0x1F,0x93,0xDF,0x92,0xDF,0x8A,0x3C,0x72,0x98,0x49,0x36,0x31,0x36,0x31,0x78,0x31,0x37,0x21,0xD7,0x18,0xF8,0x18,0xFB,0x18,0xFC,0x10,0xFC,0x10,0x1D,0x11,0x3E,0x11,0x7E,0x19,
-	0xBD,0x21,0xBD,0x19,0x3E,0x22,0x5F,0x2A,0x3F,0x22,0xDE,0x19,0x9E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0x1F,0x22,0x1E,0x22,0xBE,0x19,0x9C,0x19,0x38,0x09,0xD6,0x08,0xB4,0x08,0xB1,0x08,0x6F,0x08,0xAE,0x08,0x6B,0x08,0x69,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x44,0x00,0x24,0x00,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0xF8,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x87,0x00,0xCA,0x00,0x0D,0x01,0x2E,0x09,0x31,0x09,0x54,0x01,0x98,0x09,0xB9,0x09,0xB9,0x09,0x97,0x09,0x55,0x09,0x34,0x01,0x34,0x01,
-	0x14,0x01,0xD5,0x00,0x37,0x09,0x59,0x09,0x7C,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x00,0x88,0x00,0xE8,0x45,0x48,0x9C,0x09,0x7E,0x09,0x7E,0x09,0x5D,0x09,0x5D,0x09,0x5C,0x09,0x5C,0x09,0x3C,0x09,0x3A,0x09,0x3A,0x09,0xF9,0x08,0x19,0x09,0x19,0x09,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,
-	0xD5,0x08,0xB3,0x08,0x93,0x00,0xB3,0x08,0x72,0x08,0x91,0x08,0x71,0x08,0x6F,0x08,0x6E,0x08,0x6E,0x08,0x6E,0x08,0x70,0x08,0x70,0x08,0x71,0x08,0x70,0x08,0x6C,0x08,0x6B,0x00,0x6B,0x00,0x6A,0x08,0x68,0x08,0x26,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x21,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x1F,0x94,0x1F,0x94,0xBF,0x83,0x9F,0x83,0x1F,0x83,0xDF,0x72,0x1D,0x62,0xFC,0x59,0x3E,0x62,0x5E,0x72,0xDF,0x7A,0xDF,0x8A,0xDF,0x8A,0xFF,0x92,0xDF,0x8A,0xBE,0x82,0x1B,0x62,0x97,0x41,0x35,0x31,0x56,0x31,0x35,0x29,0xD6,0x18,0xD6,0x18,0xD7,0x18,0xD9,0x08,0xDB,0x10,0xFC,0x10,0xFD,0x10,0x1E,0x11,0x5E,0x19,
-	0xBE,0x19,0x1E,0x22,0x3E,0x22,0x5F,0x2A,0x1F,0x22,0xBD,0x11,0x5D,0x09,0x5D,0x09,0x7E,0x11,0x9E,0x19,0xBE,0x19,0xBE,0x19,0x1E,0x1A,0xDF,0x19,0xBE,0x19,0x9C,0x19,0x3A,0x11,0xD7,0x08,0xB4,0x08,0xB2,0x08,0x8F,0x08,0xAE,0x08,0x6B,0x00,0x6A,0x00,0x68,0x00,0x46,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x44,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x44,0x00,0x24,0x00,0x24,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x64,0x00,0x44,0x00,0x18,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x87,0x00,0xCA,0x00,0x0D,0x01,0x2E,0x09,0x30,0x09,0x31,0x01,0x75,0x01,0xB8,0x09,0xB8,0x09,0xB7,0x09,0x56,0x09,0x54,0x01,0x33,0x01,
-	0x14,0x01,0x14,0x01,0xF5,0x00,0x38,0x09,0x99,0x09,0x9C,0x11,0xBD,0x09,0xBE,0x09,0xBE,0x09,0xBE,0x09,0x36,0x11,0x00,0x80,0x00,0xE0,0x45,0x58,0xBD,0x09,0xBD,0x09,0x9D,0x09,0x9D,0x09,0x7D,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5B,0x09,0x5A,0x09,0xF9,0x08,0x39,0x09,0xF7,0x08,0xD7,0x08,0xF7,0x08,0xF5,0x08,0x15,0x01,0xD4,0x00,
-	0xD4,0x00,0xB3,0x08,0xB3,0x08,0x92,0x08,0xB2,0x08,0x91,0x08,0x90,0x08,0x6E,0x08,0x4D,0x00,0x4D,0x00,0x4D,0x00,0x6D,0x08,0x6F,0x08,0x70,0x08,0x70,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x68,0x00,0x46,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x23,0x00,0x41,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x1F,0x94,0xBF,0x8B,0xBF,0x83,0x9F,0x83,0x1F,0x7B,0x5E,0x6A,0xFD,0x51,0x1D,0x5A,0x3E,0x62,0x9E,0x72,0xDF,0x7A,0xDF,0x8A,0x1F,0x93,0xDF,0x8A,0xDF,0x8A,0xBC,0x7A,0xB9,0x59,0x55,0x31,0x35,0x31,0x35,0x31,0x35,0x29,0xD5,0x18,0xD5,0x18,0xD6,0x18,0xD7,0x10,0xD9,0x08,0xFC,0x10,0x1C,0x11,0x5E,0x11,0x9E,0x19,
-	0xBE,0x19,0x1E,0x1A,0x3E,0x22,0x3F,0x22,0xBE,0x19,0x7D,0x09,0x5D,0x09,0x7E,0x11,0x9E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xDD,0x19,0x9C,0x19,0x3A,0x09,0xD7,0x08,0xD5,0x08,0xB2,0x08,0xB0,0x08,0xAE,0x00,0x6B,0x00,0x6A,0x00,0x68,0x00,0x46,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
-	0x25,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x65,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x64,0x00,0x64,0x00,0x44,0x00,0x18,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x86,0x00,0xEA,0x00,0x0D,0x01,0x2E,0x09,0x30,0x09,0x31,0x09,0x54,0x09,0xB6,0x09,0xB7,0x09,0xB7,0x09,0x75,0x09,0x33,0x01,0x33,0x01,
-	0x11,0x01,0x11,0x01,0xD3,0x00,0xF5,0x00,0x38,0x09,0x99,0x09,0xBD,0x09,0xBD,0x11,0xBE,0x09,0xBE,0x09,0x45,0x58,0x00,0xE8,0x00,0x78,0x36,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0x9D,0x09,0x7C,0x09,0x9C,0x09,0x5B,0x09,0x5B,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x58,0x09,0x37,0x09,0x17,0x09,0x15,0x01,0x16,0x09,0x14,0x01,
-	0x14,0x01,0xD4,0x00,0xB3,0x08,0xB3,0x08,0xB2,0x08,0xB1,0x08,0x90,0x08,0x6E,0x08,0x4D,0x00,0x2C,0x00,0x2C,0x00,0x2C,0x00,0x4D,0x08,0x6F,0x08,0x6E,0x08,0x6E,0x08,0x6C,0x08,0x6B,0x00,0x69,0x08,0x48,0x00,0x46,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x42,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBF,0x8B,0xBF,0x83,0x9F,0x83,0x3F,0x83,0xFF,0x72,0x5E,0x62,0x1C,0x5A,0x3D,0x5A,0x5E,0x6A,0x7E,0x7A,0xDF,0x8A,0x1F,0x8B,0xDF,0x8A,0xFF,0x8A,0xBE,0x82,0x3C,0x6A,0x99,0x41,0x35,0x31,0x14,0x29,0x14,0x29,0x14,0x19,0xD3,0x10,0xD3,0x10,0xB4,0x10,0x75,0x08,0xD8,0x08,0xD9,0x08,0x1C,0x11,0x3E,0x11,0x9E,0x19,
-	0xBE,0x21,0xDE,0x21,0xFE,0x21,0x9E,0x19,0x7E,0x11,0x7E,0x11,0x7E,0x09,0x7E,0x11,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xFE,0x19,0xBC,0x11,0x7A,0x09,0x17,0x09,0xF6,0x08,0xB3,0x08,0xB1,0x08,0xAF,0x08,0x8C,0x10,0x6A,0x00,0x68,0x00,0x46,0x00,0x45,0x00,0x44,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,
-	0x26,0x00,0x47,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x26,0x00,0x66,0x00,0x26,0x00,0x65,0x00,0x65,0x00,0x45,0x00,0x18,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x86,0x00,0xA8,0x00,0xEC,0x08,0x2E,0x09,0x2E,0x09,0x30,0x09,0x31,0x09,0x74,0x09,0xB6,0x09,0xB6,0x09,0x75,0x09,0x52,0x01,0x31,0x01,
-	0x31,0x09,0x31,0x09,0x11,0x09,0x13,0x01,0x14,0x01,0x38,0x09,0x59,0x09,0xBC,0x09,0x9B,0x09,0x45,0x50,0x00,0xF0,0x00,0x78,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0x9C,0x09,0x9C,0x09,0xBB,0x09,0x7A,0x09,0x59,0x09,0x59,0x09,0x38,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x35,0x01,0x35,0x01,
-	0xF4,0x00,0xD4,0x00,0xB3,0x00,0xB3,0x08,0xB2,0x08,0xB1,0x08,0x90,0x08,0x6E,0x08,0x4D,0x00,0x2B,0x00,0x2A,0x00,0x2B,0x00,0x2B,0x00,0x4D,0x08,0x4D,0x08,0x6D,0x08,0x6C,0x08,0x6B,0x00,0x6A,0x00,0x68,0x00,0x47,0x00,0x26,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x24,0x00,0x62,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBF,0x83,0xBF,0x83,0x3F,0x83,0x3F,0x7B,0x9E,0x6A,0x3D,0x5A,0xFD,0x51,0x3E,0x62,0x5E,0x72,0xDF,0x7A,0xDF,0x8A,0x1F,0x8B,0xFF,0x8A,0xDF,0x8A,0xBE,0x82,0x1A,0x6A,0x76,0x39,0x13,0x29,0x13,0x29,0x13,0x29,0xF2,0x20,0x92,0x10,0xB2,0x10,0x93,0x08,0x75,0x00,0xB6,0x00,0xD9,0x08,0x3C,0x09,0x7E,0x11,0x9E,0x19,
-	0xBF,0x19,0xDF,0x19,0x9F,0x11,0x7E,0x09,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x9E,0x11,0xBE,0x19,0xFE,0x19,0xDE,0x19,0xDE,0x19,0xBC,0x11,0x7A,0x09,0x38,0x09,0x15,0x01,0xB3,0x08,0xF1,0x08,0xB0,0x08,0xAF,0x08,0xAC,0x00,0x69,0x00,0x67,0x00,0x46,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x46,0x00,0x26,0x00,
-	0x47,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x66,0x00,0x65,0x00,0x45,0x00,0x18,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0xA8,0x00,0xEA,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x31,0x09,0x51,0x09,0x74,0x09,0x96,0x09,0x75,0x09,0x72,0x09,0x31,0x09,
-	0x31,0x09,0xEF,0x08,0x11,0x09,0x11,0x09,0xF2,0x08,0x14,0x01,0x37,0x09,0x99,0x09,0x45,0x48,0x00,0xD8,0x00,0x88,0xF0,0x10,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBC,0x09,0xBC,0x09,0xBB,0x09,0x9A,0x09,0x7A,0x09,0x79,0x09,0x38,0x09,0x38,0x09,0x37,0x09,0x36,0x01,0x36,0x01,
-	0x35,0x01,0x14,0x01,0xF4,0x00,0xB3,0x00,0xB3,0x08,0xB2,0x08,0x90,0x08,0xAF,0x08,0x6D,0x08,0x2A,0x00,0x29,0x00,0x29,0x00,0x2A,0x00,0x2B,0x00,0x2C,0x08,0x4C,0x08,0x4C,0x00,0x6B,0x00,0x4A,0x00,0x68,0x00,0x47,0x00,0x46,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x45,0x00,0x25,0x00,0x63,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBF,0x83,0xBF,0x83,0x7F,0x83,0x1F,0x7B,0x5E,0x62,0xFC,0x59,0x1D,0x5A,0x3E,0x62,0x7E,0x6A,0xDF,0x82,0xFF,0x8A,0x3F,0x93,0xFF,0x8A,0xDF,0x8A,0xBE,0x72,0xFA,0x61,0x55,0x31,0x13,0x29,0x13,0x29,0x13,0x19,0xD1,0x18,0xB0,0x10,0x6F,0x10,0x71,0x08,0x72,0x00,0xB6,0x00,0xD9,0x08,0x1C,0x09,0x5E,0x11,0x7E,0x19,
-	0xBE,0x19,0xBF,0x19,0x5E,0x09,0x5E,0x09,0x3E,0x09,0x7E,0x09,0x7E,0x11,0xBE,0x11,0xBE,0x19,0xBE,0x19,0x1E,0x22,0xBD,0x19,0x7B,0x11,0x38,0x09,0x16,0x09,0x14,0x01,0xD2,0x08,0xD1,0x08,0xCF,0x08,0xCD,0x00,0x8A,0x00,0x68,0x00,0x66,0x00,0x25,0x00,0x44,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x48,0x00,
-	0x48,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x47,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x18,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x67,0x00,0xA9,0x00,0xCC,0x10,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x30,0x09,0x73,0x09,0x74,0x09,0x72,0x09,0x51,0x09,0x31,0x09,
-	0x2F,0x09,0xEE,0x08,0x0E,0x09,0xCF,0x08,0xAF,0x08,0xB0,0x08,0x12,0x01,0x23,0x28,0x00,0xC8,0x00,0xA0,0xAC,0x10,0xBC,0x09,0xBC,0x09,0xBC,0x09,0xBC,0x09,0xBC,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBC,0x09,0xBB,0x09,0xBB,0x09,0xB9,0x09,0x79,0x09,0x79,0x09,0x78,0x09,0x57,0x09,
-	0x37,0x09,0xF5,0x08,0x14,0x01,0x14,0x01,0xB3,0x00,0xB3,0x08,0x92,0x08,0x91,0x08,0xAF,0x08,0x6C,0x00,0x29,0x00,0x29,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x2B,0x00,0x4C,0x00,0x4B,0x00,0x49,0x00,0x29,0x00,0x68,0x08,0x47,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x26,0x00,0x25,0x00,0x63,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBF,0x83,0x5F,0x7B,0x3F,0x7B,0xDF,0x6A,0x3D,0x5A,0x1D,0x52,0x1E,0x5A,0x5E,0x62,0xBE,0x7A,0xDF,0x82,0xFF,0x8A,0x3F,0x93,0xFF,0x8A,0xDF,0x7A,0x9C,0x72,0x19,0x5A,0x14,0x29,0xF1,0x20,0xF2,0x20,0xF1,0x20,0xD0,0x18,0xAF,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0xB6,0x08,0xD9,0x08,0x1B,0x09,0x5E,0x11,0x7E,0x19,
-	0x7E,0x19,0x7E,0x11,0x1C,0x09,0x5D,0x09,0x3E,0x09,0x7E,0x09,0x9E,0x09,0xBE,0x09,0xBE,0x19,0xDE,0x19,0xBD,0x19,0xBA,0x09,0x38,0x09,0xF6,0x08,0x14,0x01,0x34,0x01,0x11,0x09,0xD1,0x08,0xCE,0x00,0xAC,0x00,0x69,0x00,0x67,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x69,0x00,
-	0x49,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x89,0x00,0x69,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x66,0x00,0xA9,0x00,0xCB,0x00,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x2E,0x09,0x30,0x09,0x72,0x09,0x72,0x09,0x30,0x09,0x2E,0x09,
-	0x0E,0x09,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAF,0x00,0x8C,0x20,0x00,0xC8,0x00,0xB8,0xAD,0x18,0xB9,0x09,0xBA,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBC,0x09,0xBC,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBC,0x09,0xBB,0x09,0xBA,0x09,0xBA,0x09,0x99,0x09,0x78,0x09,
-	0x37,0x09,0x37,0x09,0x16,0x01,0x14,0x01,0xF4,0x00,0xB3,0x00,0xB3,0x08,0xB2,0x08,0xB0,0x08,0x6C,0x08,0x4A,0x00,0x29,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x2A,0x00,0x2B,0x00,0x6B,0x00,0x49,0x00,0x49,0x00,0x28,0x08,0x27,0x00,0x26,0x00,0x45,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x66,0x08,0x63,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x9F,0x7B,0x7F,0x7B,0x1F,0x73,0x7E,0x6A,0x1D,0x52,0x1D,0x52,0x3E,0x62,0x5E,0x6A,0xDF,0x7A,0xDF,0x82,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xDF,0x7A,0x7C,0x72,0x98,0x49,0x12,0x29,0xF1,0x20,0xF1,0x20,0xD0,0x18,0xAE,0x10,0x6D,0x10,0x6D,0x08,0x6D,0x08,0x70,0x08,0x93,0x08,0xD7,0x08,0xFB,0x10,0x3C,0x11,0x5D,0x19,
-	0x3B,0x09,0x1A,0x09,0xFB,0x08,0x3B,0x09,0x5D,0x09,0x7E,0x09,0x7E,0x09,0xBE,0x11,0xBE,0x19,0xBD,0x11,0x7B,0x11,0x38,0x09,0x16,0x09,0x14,0x01,0x34,0x01,0xD3,0x00,0x12,0x01,0xCF,0x08,0xCE,0x00,0xAB,0x00,0x68,0x00,0x66,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x26,0x00,0x27,0x00,0x49,0x00,0x49,0x00,
-	0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x87,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x66,0x00,0xA7,0x00,0xEA,0x00,0x0C,0x09,0xCC,0x00,0xCC,0x00,0xCD,0x00,0x2F,0x09,0x51,0x09,0x72,0x09,0x30,0x09,0x2E,0x09,
-	0x0D,0x01,0xED,0x00,0xAC,0x00,0xAC,0x00,0xAC,0x00,0x23,0x20,0x00,0xB8,0x00,0xB8,0x67,0x28,0x53,0x01,0x75,0x01,0x96,0x09,0xB8,0x09,0xB8,0x09,0xBA,0x09,0xBA,0x09,0xBA,0x09,0xBB,0x09,0xBC,0x09,0xBC,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBC,0x09,0xBB,0x09,0xBA,0x09,0xB9,0x09,
-	0x38,0x09,0x37,0x09,0x37,0x09,0xF5,0x08,0x14,0x01,0x14,0x01,0xF4,0x00,0xB3,0x08,0xB1,0x08,0x8F,0x08,0x4B,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x6B,0x00,0x69,0x00,0x69,0x00,0x28,0x00,0x27,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x47,0x08,0x65,0x08,0x00,0x00,
-	0x00,0x00,0xBF,0x83,0x5F,0x7B,0x3F,0x7B,0xFF,0x72,0x3D,0x5A,0xFE,0x51,0x1D,0x52,0x3E,0x62,0x9E,0x72,0xDF,0x7A,0x1F,0x83,0x1F,0x8B,0x1F,0x8B,0xDF,0x82,0xBD,0x7A,0x3B,0x62,0x95,0x41,0xF2,0x20,0xF1,0x20,0xF1,0x20,0xAF,0x18,0x8C,0x10,0x6B,0x08,0x6B,0x00,0x4C,0x00,0x6E,0x08,0x71,0x08,0xD6,0x08,0xD9,0x08,0x3A,0x19,0xF9,0x08,
-	0xD8,0x08,0xD7,0x08,0xD8,0x08,0x1A,0x09,0x5C,0x09,0x5D,0x09,0x7D,0x11,0xBD,0x19,0xBC,0x11,0x5B,0x11,0x38,0x09,0x35,0x01,0x14,0x01,0x14,0x01,0x34,0x01,0x34,0x01,0x31,0x09,0xCF,0x08,0xAE,0x00,0x8A,0x00,0x68,0x00,0x65,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x47,0x00,0x69,0x00,0x4A,0x00,
-	0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x8B,0x00,0x8A,0x00,0x69,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x88,0x00,0x68,0x00,0xA8,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x65,0x00,0x87,0x00,0xC8,0x00,0x2C,0x01,0xCC,0x00,0xCB,0x00,0xAB,0x00,0x0D,0x01,0x30,0x09,0x2F,0x09,0x2E,0x09,0xED,0x00,
-	0xCC,0x00,0xAB,0x00,0xAA,0x00,0xAA,0x00,0x22,0x18,0x00,0xA8,0x00,0xD8,0x00,0x30,0xCE,0x00,0xCF,0x08,0x31,0x01,0x52,0x09,0x54,0x01,0x75,0x01,0x95,0x09,0xB7,0x09,0xB8,0x09,0xB9,0x09,0xB9,0x09,0xBA,0x09,0xBB,0x09,0xBB,0x09,0xBB,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBD,0x09,0xBC,0x09,0xBA,0x09,
-	0x79,0x09,0x38,0x09,0x38,0x09,0x37,0x09,0x16,0x01,0xF4,0x00,0x14,0x01,0xF4,0x00,0xB2,0x08,0xB0,0x08,0x6D,0x08,0x29,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x2A,0x00,0x4A,0x00,0x29,0x00,0x69,0x00,0x28,0x08,0x28,0x00,0x67,0x00,0x66,0x00,0x45,0x00,0x26,0x00,0x26,0x00,0x67,0x08,0x29,0x00,0x8A,0x08,0xA6,0x18,0xC3,0x18,
-	0x00,0x00,0x3F,0x7B,0x7F,0x7B,0x3F,0x7B,0x9E,0x62,0x1E,0x52,0xFE,0x51,0x1E,0x5A,0x5E,0x62,0xBF,0x72,0xDF,0x7A,0x1F,0x8B,0x3F,0x8B,0x1F,0x8B,0xDF,0x82,0xBC,0x7A,0x3B,0x5A,0x55,0x39,0xF1,0x20,0xF1,0x20,0xEE,0x20,0xAD,0x18,0x8A,0x08,0x69,0x00,0x49,0x00,0x4A,0x00,0x6C,0x08,0x8F,0x08,0xB2,0x08,0xB4,0x10,0xB5,0x10,0xB4,0x08,
-	0x74,0x00,0x74,0x00,0xD6,0x08,0xD8,0x08,0x3A,0x09,0x3B,0x09,0x7C,0x11,0x7A,0x09,0x39,0x11,0x17,0x09,0x15,0x01,0x14,0x01,0x34,0x01,0x54,0x01,0x34,0x01,0x52,0x09,0xF2,0x08,0xCF,0x08,0xAC,0x00,0x89,0x00,0x67,0x00,0x65,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x27,0x00,0x47,0x00,0x49,0x00,0x6A,0x00,
-	0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0xAA,0x00,0xA9,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x65,0x00,0x65,0x00,0x86,0x00,0xA8,0x00,0xCA,0x08,0x0A,0x01,0x0A,0x01,0xEA,0x00,0xAC,0x00,0x2E,0x09,0x2E,0x09,0x0D,0x01,0xAC,0x00,
-	0xAB,0x00,0xAA,0x00,0xC9,0x00,0x88,0x08,0x00,0x98,0x00,0xE0,0x22,0x38,0xAA,0x00,0xAB,0x00,0xAC,0x00,0xCE,0x00,0xF0,0x08,0x10,0x09,0x51,0x09,0x12,0x01,0x33,0x01,0x33,0x01,0x35,0x09,0x54,0x09,0x36,0x01,0x76,0x01,0x77,0x01,0x99,0x09,0x99,0x09,0x9A,0x09,0xBB,0x09,0xBC,0x09,0xBC,0x09,0xBD,0x09,0xBD,0x09,0xBC,0x09,0xBB,0x09,
-	0x79,0x09,0x59,0x09,0x38,0x09,0x37,0x09,0x37,0x09,0x35,0x01,0x14,0x01,0x14,0x01,0xB3,0x00,0xB1,0x08,0x8E,0x10,0x2A,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x27,0x00,0x29,0x00,0x49,0x00,0x69,0x00,0x49,0x00,0x28,0x00,0x28,0x00,0x68,0x00,0x67,0x00,0x26,0x00,0x46,0x00,0x67,0x00,0x68,0x00,0x6A,0x08,0x8B,0x10,0xC7,0x18,0xC5,0x18,
-	0x00,0x00,0x7F,0x7B,0x3F,0x7B,0xDF,0x6A,0x9E,0x5A,0x1D,0x52,0xFE,0x51,0x1E,0x5A,0x7F,0x6A,0xBF,0x72,0xDF,0x7A,0x1F,0x8B,0x3F,0x8B,0x1F,0x8B,0xDF,0x82,0xBD,0x6A,0xD8,0x51,0x34,0x31,0xF0,0x20,0xF0,0x20,0xED,0x20,0xAB,0x18,0x69,0x08,0x68,0x00,0x28,0x00,0x49,0x00,0x6B,0x08,0x6D,0x10,0xAF,0x08,0xAF,0x08,0x6F,0x08,0x6E,0x08,
-	0x6F,0x08,0xB1,0x08,0xB4,0x08,0xD5,0x08,0x37,0x11,0x39,0x11,0x38,0x09,0x37,0x09,0x15,0x01,0xB4,0x08,0x34,0x01,0x34,0x01,0x54,0x01,0x54,0x01,0x75,0x09,0x34,0x01,0x31,0x09,0x0F,0x09,0xCC,0x00,0xA8,0x00,0x66,0x00,0x44,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x69,0x00,
-	0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x8A,0x00,0x8A,0x00,0xAA,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x66,0x00,0x65,0x00,0x65,0x00,0xA7,0x00,0x09,0x01,0xCA,0x00,0xC8,0x00,0xCA,0x00,0xAA,0x00,0xCB,0x00,0x2D,0x01,0xAB,0x00,0xEA,0x00,
-	0xAA,0x00,0xA8,0x00,0x86,0x08,0x00,0x98,0x00,0xD8,0x44,0x40,0x86,0x00,0x89,0x00,0xAA,0x00,0xAA,0x00,0xAB,0x00,0xAB,0x00,0xAC,0x00,0xCD,0x00,0x0E,0x09,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xD1,0x08,0x11,0x01,0x31,0x01,0x33,0x01,0x34,0x01,0x34,0x01,0x37,0x09,0x57,0x09,0x59,0x09,0x5A,0x09,0xBB,0x09,0xBC,0x09,0xBC,0x09,0xBB,0x09,
-	0x9A,0x09,0x7A,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x16,0x09,0x14,0x01,0x13,0x01,0xF1,0x08,0xB0,0x10,0x6B,0x00,0x28,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x28,0x00,0x29,0x00,0x69,0x00,0x69,0x08,0x68,0x08,0x28,0x08,0x68,0x00,0x68,0x00,0x67,0x00,0x27,0x00,0x68,0x00,0x69,0x00,0x6C,0x08,0xAD,0x10,0x29,0x21,0xC5,0x18,
-	0x00,0x00,0x3F,0x7B,0x3F,0x7B,0xDF,0x6A,0x1E,0x52,0xDE,0x49,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0xDF,0x7A,0xFF,0x8A,0x3F,0x8B,0x3F,0x8B,0x1F,0x8B,0xDE,0x7A,0x9C,0x72,0xD7,0x49,0x13,0x29,0xF0,0x20,0xCE,0x18,0xCD,0x20,0xAB,0x10,0x67,0x00,0x26,0x00,0x26,0x00,0x68,0x00,0x69,0x08,0x8A,0x00,0x6B,0x08,0x6A,0x00,0x4A,0x00,0x49,0x00,
-	0x6B,0x00,0xAE,0x00,0xF0,0x08,0xF2,0x00,0xD3,0x10,0x13,0x01,0x13,0x01,0xB2,0x00,0xD2,0x08,0xD2,0x08,0x32,0x09,0x54,0x01,0x75,0x09,0x75,0x09,0x75,0x09,0x53,0x01,0x31,0x09,0xCF,0x08,0xAA,0x00,0x67,0x00,0x65,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x68,0x00,0x69,0x00,
-	0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x8A,0x00,0xAB,0x00,0xAB,0x00,0x8A,0x00,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x87,0x00,0x65,0x00,0x65,0x00,0x86,0x00,0xA7,0x00,0xE9,0x00,0xA8,0x00,0xA8,0x00,0xA9,0x00,0x0B,0x01,0xCB,0x00,0x0A,0x01,0xCA,0x00,
-	0xA9,0x00,0x86,0x08,0x00,0x68,0x00,0xD8,0x00,0x60,0x46,0x00,0x67,0x00,0xA8,0x00,0xA8,0x00,0xA9,0x00,0xA9,0x00,0xC9,0x00,0xA9,0x00,0xAA,0x00,0xCC,0x00,0xCC,0x00,0xCD,0x00,0xEE,0x00,0xCE,0x00,0xCE,0x08,0xD0,0x08,0x10,0x09,0x31,0x01,0x33,0x01,0x33,0x01,0x34,0x01,0x36,0x01,0x36,0x09,0x38,0x09,0x9A,0x09,0xBA,0x09,0xBB,0x09,
-	0xBB,0x09,0x79,0x09,0x59,0x09,0x59,0x09,0x38,0x09,0x37,0x09,0x36,0x01,0x34,0x01,0x34,0x01,0xD3,0x08,0xD0,0x10,0x8C,0x00,0x29,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x69,0x00,0x49,0x08,0x49,0x08,0x69,0x00,0x68,0x08,0x68,0x00,0x68,0x00,0x69,0x00,0x6B,0x00,0x6D,0x08,0xAF,0x18,0x2A,0x21,0xA5,0x18,
-	0x00,0x00,0x3F,0x7B,0x1F,0x73,0xBF,0x5A,0xFD,0x51,0xDD,0x49,0x1E,0x5A,0x5E,0x62,0xBF,0x72,0xDF,0x7A,0x3F,0x8B,0x3F,0x8B,0x1F,0x8B,0x1F,0x8B,0xBE,0x7A,0x7B,0x62,0xD7,0x49,0x32,0x31,0xD0,0x18,0xCD,0x20,0xAC,0x18,0xA8,0x10,0x46,0x00,0x25,0x00,0x25,0x00,0x47,0x00,0x67,0x08,0x67,0x00,0x67,0x00,0x46,0x00,0x26,0x00,0x26,0x00,
-	0x67,0x00,0x88,0x00,0xAB,0x00,0xAD,0x00,0xAE,0x00,0xAE,0x00,0xAE,0x00,0xEF,0x08,0xCF,0x08,0x11,0x09,0x12,0x09,0x54,0x01,0x75,0x09,0x96,0x09,0x75,0x09,0x53,0x01,0x30,0x09,0xCD,0x00,0xA9,0x00,0x66,0x00,0x44,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x46,0x00,0x47,0x00,0x27,0x00,0x48,0x00,0x68,0x00,
-	0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x8B,0x00,0xAC,0x00,0xAC,0x00,0xAC,0x00,0xAB,0x00,0x1A,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x87,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xEA,0x00,0xCA,0x00,0xA9,0x00,0xA8,0x00,
-	0xA8,0x00,0x22,0x68,0x00,0xE8,0x00,0x60,0x85,0x00,0x67,0x00,0x67,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xAB,0x00,0xAB,0x00,0xAC,0x00,0xCD,0x00,0xEE,0x00,0xCE,0x08,0xCF,0x08,0xEF,0x08,0xD1,0x08,0x31,0x09,0x31,0x01,0x34,0x01,0x34,0x01,0x35,0x01,0x37,0x09,0x58,0x09,0x79,0x09,
-	0x99,0x09,0x9A,0x09,0x5A,0x09,0x59,0x09,0x58,0x09,0x37,0x09,0x36,0x09,0x35,0x01,0x34,0x01,0x13,0x01,0xF2,0x08,0xCF,0x10,0x8A,0x00,0x27,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x49,0x00,0x6A,0x08,0x69,0x08,0x69,0x08,0x69,0x00,0x68,0x00,0x68,0x00,0x69,0x08,0x6A,0x00,0x6B,0x08,0x6F,0x08,0xD1,0x18,0x4C,0x29,0xA5,0x18,
-	0x00,0x00,0x3F,0x7B,0xBF,0x62,0x5F,0x5A,0xDD,0x49,0xFE,0x51,0x1E,0x5A,0x7F,0x6A,0x7E,0x7A,0xDF,0x82,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0xDF,0x8A,0xBE,0x72,0x7B,0x5A,0x55,0x39,0xF1,0x20,0xEF,0x20,0xCD,0x20,0xEB,0x20,0x88,0x08,0x45,0x00,0x23,0x00,0x24,0x00,0x44,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x24,0x00,0x23,0x00,0x24,0x00,
-	0x44,0x00,0x25,0x00,0x47,0x00,0x28,0x00,0x68,0x00,0x8A,0x00,0xCC,0x00,0xCE,0x00,0x0E,0x09,0x10,0x09,0x31,0x09,0x74,0x09,0x75,0x09,0xB6,0x11,0x95,0x09,0x72,0x09,0x0F,0x09,0xCB,0x00,0x87,0x00,0x65,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x47,0x00,0x47,0x00,0x27,0x00,0x48,0x00,
-	0x68,0x00,0x29,0x00,0x49,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAC,0x00,0x1A,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x86,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0xA6,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA8,0x00,0xE9,0x00,0xA8,0x00,0xA7,0x00,
-	0x00,0x58,0x00,0xE0,0x00,0x80,0x45,0x08,0x67,0x00,0x67,0x00,0x87,0x00,0x67,0x00,0x88,0x00,0x88,0x00,0x88,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA9,0x00,0xAA,0x00,0xAA,0x00,0xAB,0x00,0xAC,0x00,0xCD,0x00,0xCE,0x00,0x0E,0x09,0xCF,0x08,0x31,0x09,0x31,0x09,0x12,0x01,0x33,0x01,0x34,0x01,0x34,0x01,0x36,0x09,0x36,0x09,
-	0x58,0x09,0x59,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x34,0x01,0x32,0x09,0xCF,0x08,0xAC,0x00,0x28,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x49,0x00,0x69,0x08,0x69,0x08,0x6A,0x08,0x69,0x00,0x69,0x00,0x8A,0x00,0x6A,0x00,0x6B,0x08,0x6D,0x08,0x70,0x10,0xF1,0x18,0x4C,0x29,0xA5,0x18,
-	0x00,0x00,0x3F,0x7B,0xBE,0x5A,0x5D,0x5A,0xDD,0x49,0xFE,0x51,0x3E,0x5A,0x5E,0x62,0xDF,0x7A,0x1F,0x83,0x3F,0x8B,0x3F,0x8B,0x3F,0x8B,0x1F,0x7B,0xDE,0x72,0x9B,0x5A,0xB3,0x41,0xF1,0x20,0xED,0x28,0xCD,0x20,0xEB,0x18,0xA7,0x10,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x24,0x00,0x44,0x00,0x45,0x00,0x66,0x00,0x88,0x00,0xAA,0x00,0x0D,0x01,0xEF,0x08,0x31,0x09,0x32,0x09,0x75,0x09,0x95,0x09,0xB6,0x11,0x74,0x09,0x31,0x09,0x0D,0x01,0x89,0x00,0x66,0x00,0x44,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x44,0x00,0x46,0x00,0x46,0x00,0x47,0x00,0x27,0x00,0x47,0x00,0x48,0x00,
-	0x48,0x00,0x48,0x00,0x49,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x8B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAC,0x00,0x1A,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x66,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x86,0x00,0xA7,0x00,0xA7,0x00,0x87,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0x66,0x00,0x21,0x40,
-	0x00,0xD8,0x00,0x90,0x45,0x08,0x66,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x87,0x00,0x88,0x00,0xA8,0x00,0x88,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA9,0x00,0xAA,0x00,0xAA,0x00,0xAB,0x00,0xED,0x00,0xCD,0x00,0xEE,0x08,0x11,0x09,0x11,0x09,0xF1,0x08,0x12,0x01,0x34,0x01,0x34,0x01,0x34,0x01,0x34,0x01,
-	0x35,0x01,0x38,0x09,0x7A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x11,0x13,0x01,0x11,0x09,0xAE,0x08,0x69,0x00,0x27,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x69,0x08,0x69,0x08,0x6A,0x08,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x08,0x6C,0x08,0x6E,0x10,0x70,0x10,0xF2,0x20,0x4C,0x29,0xA5,0x18,
-	0x00,0x00,0x1F,0x73,0x9E,0x5A,0x1D,0x52,0xDD,0x49,0xFE,0x51,0x3E,0x62,0x7E,0x72,0xDF,0x7A,0xDF,0x8A,0x3F,0x93,0x3F,0x93,0x3F,0x8B,0xDF,0x82,0xBE,0x72,0x3A,0x62,0x55,0x39,0xEE,0x20,0xCE,0x18,0xCD,0x18,0x0A,0x21,0xA7,0x18,0x43,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x62,0x00,0x23,0x00,0x24,0x00,0x45,0x00,0x66,0x00,0xA8,0x00,0xCC,0x00,0x2E,0x09,0x30,0x09,0x52,0x01,0x54,0x01,0x75,0x09,0xB6,0x11,0x74,0x09,0x10,0x11,0xEC,0x00,0x67,0x00,0x65,0x00,0x24,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x44,0x00,0x26,0x00,0x46,0x00,0x47,0x00,0x67,0x00,0x48,0x00,0x68,0x00,
-	0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x8B,0x00,0x8B,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x1A,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x86,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x87,0x00,0xA7,0x00,0x87,0x00,0x67,0x00,0x44,0x30,0x00,0xD8,
-	0x00,0xA8,0x45,0x08,0x47,0x00,0x47,0x00,0x67,0x00,0x88,0x00,0xA8,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xA9,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x87,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xC9,0x00,0xAA,0x00,0xAC,0x00,0xEE,0x00,0xCE,0x08,0xEF,0x08,0xB0,0x08,0x11,0x09,0xD2,0x08,0x12,0x01,0x33,0x01,0x34,0x01,0x13,0x01,
-	0x14,0x01,0x36,0x09,0x99,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x38,0x09,0x37,0x09,0x37,0x09,0x37,0x09,0x34,0x01,0x32,0x09,0xB0,0x08,0x6B,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x6A,0x08,0x6A,0x08,0x6A,0x00,0x6A,0x00,0x6B,0x08,0x8C,0x10,0x8C,0x10,0x6E,0x08,0x72,0x10,0xF3,0x20,0x4C,0x29,0xC5,0x18,
-	0x00,0x00,0xDF,0x6A,0x9D,0x62,0xDD,0x49,0xDD,0x49,0x1E,0x52,0x3E,0x62,0xBF,0x72,0xDF,0x82,0x1F,0x8B,0x3F,0x93,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBE,0x72,0x5A,0x5A,0x53,0x39,0xEE,0x20,0xCE,0x18,0xCD,0x18,0x0A,0x21,0xC7,0x18,0x43,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x42,0x00,
-	0x22,0x00,0x62,0x00,0x43,0x00,0x23,0x00,0x24,0x00,0x65,0x00,0x88,0x00,0xCB,0x00,0x2E,0x09,0x31,0x09,0x72,0x09,0x74,0x09,0x75,0x09,0x75,0x09,0x52,0x09,0x2E,0x09,0xAA,0x00,0x66,0x00,0x64,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x44,0x00,0x26,0x00,0x27,0x00,0x47,0x00,0x28,0x00,0x48,0x00,0x48,0x00,
-	0x49,0x00,0x49,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0xAC,0x00,0xCD,0x00,0xCD,0x00,0xCE,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xCD,0x00,0x1A,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x66,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x86,0x00,0x87,0x00,0xA7,0x00,0x67,0x00,0x23,0x30,0x00,0xD0,0x00,0xA8,
-	0x45,0x10,0x47,0x00,0x68,0x00,0x68,0x00,0xA9,0x00,0x8A,0x00,0xAA,0x00,0xAA,0x00,0xAA,0x00,0x8A,0x00,0xCA,0x00,0xA9,0x00,0xA9,0x00,0xA8,0x00,0xA7,0x00,0x87,0x00,0x87,0x00,0x87,0x00,0xA7,0x00,0xA8,0x00,0xA9,0x00,0xAA,0x00,0xAB,0x00,0xCD,0x00,0xCE,0x08,0xEE,0x08,0xD1,0x08,0x31,0x09,0x11,0x09,0x32,0x01,0x33,0x01,0xD2,0x08,
-	0xF4,0x00,0x16,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x38,0x09,0x59,0x09,0x38,0x09,0x37,0x09,0x35,0x01,0xF3,0x08,0xF0,0x08,0x6C,0x00,0x47,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x49,0x00,0x6A,0x08,0x6B,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x6C,0x08,0x8D,0x10,0x6F,0x10,0x72,0x10,0x14,0x21,0x4C,0x29,0xC5,0x18,
-	0xFF,0x72,0xBD,0x62,0x1C,0x52,0xDC,0x49,0xFE,0x51,0x1E,0x5A,0x5E,0x6A,0xBE,0x7A,0xDF,0x8A,0x1F,0x8B,0x3F,0x8B,0x3F,0x8B,0x1F,0x8B,0x1F,0x7B,0xBE,0x72,0x1A,0x5A,0x53,0x39,0xF0,0x20,0xCD,0x20,0xCD,0x20,0x0A,0x21,0xA8,0x18,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x62,0x00,0x22,0x00,0x42,0x00,0x63,0x00,0x64,0x00,0x66,0x00,0xAA,0x00,0x2E,0x09,0x51,0x09,0x72,0x09,0x74,0x09,0x74,0x09,0x74,0x09,0x51,0x09,0xCC,0x00,0xA8,0x00,0x66,0x00,0x44,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x26,0x00,0x46,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,
-	0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0xAB,0x00,0xAD,0x00,0xCD,0x00,0xCE,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0x3A,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x66,0x00,0x64,0x00,0x64,0x00,0x44,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x24,0x20,0x00,0xB8,0x00,0xC0,0x46,0x18,
-	0x68,0x00,0x69,0x00,0x69,0x00,0x8B,0x00,0xAB,0x00,0xAD,0x00,0x8C,0x00,0x8C,0x00,0xAC,0x00,0xAC,0x00,0xAB,0x00,0xAB,0x00,0xAA,0x00,0xA8,0x00,0xA7,0x00,0x87,0x00,0x86,0x00,0x86,0x00,0x67,0x00,0x87,0x00,0x88,0x00,0xC9,0x00,0xAB,0x00,0xCC,0x00,0xCD,0x00,0xCE,0x08,0xCF,0x08,0xD0,0x08,0x11,0x09,0x12,0x01,0x33,0x01,0x32,0x01,
-	0xB3,0x00,0x14,0x01,0x37,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x38,0x09,0x37,0x09,0x36,0x09,0x34,0x09,0x11,0x09,0xCE,0x00,0x49,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x69,0x00,0x6A,0x08,0x6B,0x08,0x6C,0x00,0x6C,0x00,0x6C,0x08,0x6D,0x10,0xAF,0x08,0x90,0x08,0xB4,0x10,0x15,0x29,0x6D,0x29,0xE6,0x18,
-	0x00,0x00,0xBE,0x5A,0x1D,0x52,0xDD,0x49,0xFE,0x51,0x3E,0x5A,0x7F,0x6A,0xDF,0x82,0x1F,0x8B,0x3F,0x93,0x3F,0x8B,0x3F,0x93,0x3F,0x8B,0xDF,0x7A,0xBE,0x72,0x3A,0x52,0x53,0x39,0xF0,0x20,0xAE,0x18,0xCD,0x20,0xEC,0x28,0xA8,0x18,0x44,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xC9,0x00,0xED,0x00,0x30,0x09,0x72,0x09,0x74,0x09,0x72,0x09,0x72,0x09,0x0E,0x01,0xA9,0x00,0x67,0x00,0x65,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x46,0x00,0x46,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,
-	0x6A,0x00,0x6B,0x00,0x6C,0x00,0xCD,0x00,0xAD,0x00,0xAD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCE,0x00,0x3A,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xBE,0x65,0x00,0x64,0x00,0x24,0x00,0x44,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x23,0x00,0x00,0xB0,0x00,0xC8,0x01,0x20,0x49,0x00,
-	0x6B,0x00,0xAC,0x00,0x8C,0x00,0x8E,0x08,0x8E,0x00,0xB0,0x08,0xB0,0x00,0xB0,0x00,0x90,0x08,0xB0,0x00,0xCE,0x00,0xCE,0x00,0xAC,0x00,0xAB,0x00,0xA9,0x00,0xA7,0x00,0x87,0x00,0x66,0x00,0x66,0x00,0x86,0x00,0x68,0x00,0x89,0x00,0xAA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xEE,0x08,0xCF,0x08,0x31,0x09,0x31,0x01,0xD2,0x08,0x31,0x01,
-	0xF3,0x00,0x13,0x01,0x37,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x38,0x09,0x37,0x09,0x34,0x01,0x13,0x11,0xCF,0x08,0x4A,0x00,0x28,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x49,0x00,0x6A,0x08,0x8C,0x10,0x6C,0x00,0x6C,0x00,0x6C,0x08,0x8E,0x08,0x6F,0x10,0x70,0x10,0xB5,0x10,0x15,0x29,0x2F,0x29,0xE6,0x18,
-	0x00,0x00,0x5D,0x5A,0xDC,0x51,0xDC,0x51,0xFD,0x51,0x5E,0x62,0x9F,0x6A,0xDF,0x82,0x3F,0x8B,0x3F,0x8B,0x3F,0x93,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBE,0x72,0x3A,0x52,0x53,0x39,0xCF,0x18,0xED,0x20,0xED,0x20,0xEC,0x28,0xC8,0x18,0x44,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x41,0x00,0x41,0x00,0x21,0x00,0x42,0x00,0x63,0x00,0x63,0x00,0x65,0x00,0xA7,0x00,0x0B,0x01,0x2E,0x09,0x51,0x09,0x72,0x09,0x71,0x09,0x2E,0x09,0xEC,0x00,0x88,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x45,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,
-	0x8B,0x00,0xAC,0x00,0xCD,0x00,0xCD,0x00,0xCE,0x00,0xCE,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xEE,0x00,0x0F,0x09,0x3B,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x65,0x00,0x25,0x00,0x65,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x46,0x10,0x00,0xA8,0x00,0xD0,0x02,0x38,0x6B,0x00,0xAD,0x00,
-	0xAF,0x08,0xAF,0x08,0xB1,0x08,0xB2,0x08,0xD3,0x08,0xB3,0x08,0xF3,0x08,0x34,0x11,0x34,0x09,0x33,0x09,0x32,0x09,0x31,0x09,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xA9,0x00,0x87,0x00,0x66,0x00,0x86,0x00,0x66,0x00,0x67,0x00,0x88,0x00,0xA9,0x00,0x8A,0x00,0xAC,0x00,0xCD,0x00,0xCE,0x00,0xEE,0x08,0xD1,0x08,0x31,0x09,0x32,0x01,0x33,0x01,
-	0x12,0x01,0xF3,0x00,0x35,0x01,0x58,0x09,0x7A,0x09,0x5A,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x59,0x09,0x38,0x09,0x37,0x09,0x13,0x01,0xD0,0x08,0x6B,0x00,0x28,0x00,0x26,0x00,0x26,0x00,0x28,0x00,0x49,0x00,0x6B,0x08,0x6B,0x08,0x8D,0x08,0x6E,0x08,0x6F,0x10,0x8F,0x10,0x8F,0x10,0x92,0x08,0x95,0x10,0x57,0x29,0x4E,0x31,0xE5,0x18,
-	0x00,0x00,0x5D,0x5A,0xDC,0x49,0xDC,0x49,0xFD,0x51,0x5E,0x62,0xDF,0x7A,0xFF,0x82,0x3F,0x8B,0x5F,0x93,0x3F,0x93,0x3F,0x8B,0x3F,0x8B,0xDF,0x7A,0xBE,0x72,0x3A,0x52,0x53,0x39,0xF1,0x20,0xAE,0x18,0xED,0x20,0xEC,0x28,0xA9,0x18,0x45,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x40,0x00,0x20,0x00,0x40,0x00,
-	0x41,0x00,0x61,0x00,0x21,0x00,0x42,0x00,0x62,0x00,0x63,0x00,0x64,0x00,0x87,0x00,0xCB,0x00,0x0D,0x01,0x2E,0x09,0x51,0x09,0x30,0x09,0xED,0x00,0xA9,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x44,0x00,0x25,0x00,0x46,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x69,0x00,
-	0x8A,0x00,0x8B,0x00,0x8B,0x00,0xAC,0x00,0xCD,0x00,0xCD,0x00,0x8C,0x00,0xCD,0x00,0xCD,0x00,0xEE,0x00,0xCE,0x00,0x10,0x09,0x2F,0x09,0x3B,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x65,0x00,0x65,0x00,0x45,0x00,0x47,0x00,0x67,0x00,0x68,0x00,0x23,0x08,0x01,0x88,0x00,0xE0,0x02,0x50,0x4C,0x08,0xAF,0x00,0xB0,0x08,
-	0xB2,0x08,0xB4,0x08,0xD5,0x10,0x16,0x11,0xF6,0x10,0x16,0x11,0x36,0x09,0x36,0x11,0x36,0x09,0x34,0x01,0x34,0x09,0x33,0x09,0x31,0x09,0x30,0x09,0xCE,0x00,0xAB,0x00,0xA9,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0x67,0x00,0x67,0x00,0x88,0x00,0xAA,0x00,0xAB,0x00,0xAC,0x00,0xCD,0x00,0xCE,0x08,0xEF,0x08,0x31,0x09,0x31,0x09,0x31,0x01,
-	0x32,0x01,0xD3,0x00,0x14,0x01,0x38,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x5A,0x09,0x59,0x09,0x58,0x09,0x37,0x09,0x15,0x09,0xD1,0x08,0xAC,0x00,0x28,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6B,0x08,0x6C,0x08,0x6D,0x08,0x8E,0x08,0x6F,0x08,0x8F,0x10,0xB1,0x10,0x92,0x08,0x96,0x10,0x58,0x29,0x8C,0x29,0xE5,0x18,
-	0x00,0x00,0xDD,0x49,0xDD,0x49,0xDD,0x49,0x3D,0x5A,0x5E,0x6A,0xBD,0x7A,0xDF,0x8A,0x5F,0x93,0x3F,0x8B,0x5F,0x9B,0x5F,0x93,0x3F,0x8B,0xDF,0x7A,0x7E,0x62,0x19,0x52,0x33,0x31,0xF0,0x20,0x2E,0x21,0xED,0x20,0x0C,0x29,0xEA,0x20,0x65,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x42,0x00,0x63,0x00,0x64,0x00,0x86,0x00,0xC8,0x00,0x2D,0x01,0x2E,0x09,0x2E,0x09,0x0D,0x09,0xCA,0x00,0x87,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x45,0x00,0x25,0x00,0x66,0x00,0x66,0x00,0x67,0x00,0x68,0x00,
-	0x69,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x8B,0x00,0xCD,0x00,0xCD,0x00,0xEF,0x08,0x31,0x09,0x31,0x09,0x72,0x09,0x3B,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xBD,0x66,0x00,0x46,0x00,0x47,0x00,0x67,0x00,0x68,0x00,0x48,0x00,0x01,0x78,0x00,0xE8,0x02,0x50,0xAE,0x00,0x91,0x08,0x92,0x08,0xB5,0x08,
-	0xD6,0x08,0xD7,0x10,0x18,0x11,0x18,0x11,0x39,0x09,0x38,0x09,0x17,0x11,0x17,0x09,0x16,0x01,0x16,0x01,0x14,0x01,0x13,0x01,0xF3,0x00,0x11,0x09,0x10,0x09,0xED,0x00,0xAB,0x00,0xA9,0x00,0xA8,0x00,0x87,0x00,0x87,0x00,0x67,0x00,0x88,0x00,0xA9,0x00,0xAA,0x00,0xAB,0x00,0xCD,0x00,0xEE,0x00,0xAF,0x08,0xB0,0x08,0x31,0x09,0x31,0x01,
-	0x32,0x01,0x13,0x01,0xB3,0x08,0x17,0x09,0x5A,0x09,0x9B,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x5A,0x09,0x59,0x09,0x37,0x09,0x36,0x09,0x13,0x09,0xAE,0x00,0x49,0x00,0x27,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x6B,0x08,0x6C,0x08,0x8F,0x10,0x6E,0x08,0x6F,0x10,0xB0,0x10,0xB1,0x10,0xB3,0x08,0xD7,0x18,0x58,0x29,0x2F,0x31,0xE6,0x18,
-	0x00,0x00,0xDD,0x49,0xDD,0x49,0x1D,0x52,0x3E,0x62,0x9E,0x6A,0xDF,0x7A,0x1F,0x8B,0x3F,0x8B,0x5F,0x93,0x7F,0x9B,0x3F,0x93,0x3F,0x8B,0xDF,0x7A,0x9E,0x72,0xB8,0x49,0x12,0x29,0xF0,0x20,0xEE,0x20,0x0D,0x29,0x4D,0x29,0x0B,0x21,0x86,0x10,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x66,0x00,0xA8,0x00,0x0A,0x01,0x2E,0x09,0x2E,0x09,0x0D,0x01,0xA8,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x44,0x00,0x44,0x00,0x25,0x00,0x45,0x00,0x26,0x00,0x67,0x00,0x67,0x00,0x68,0x00,
-	0x69,0x00,0x69,0x00,0x6A,0x00,0x8A,0x00,0x8B,0x00,0xAC,0x00,0xCD,0x00,0xCE,0x08,0xCF,0x08,0x10,0x09,0x31,0x09,0x72,0x09,0x51,0x09,0xB5,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x73,0x8C,0x46,0x00,0x46,0x00,0x67,0x00,0x69,0x00,0x6A,0x00,0x01,0x68,0x00,0xE8,0x03,0x68,0x8F,0x08,0xB2,0x08,0xB4,0x08,0xD6,0x08,0xF8,0x10,
-	0xD9,0x08,0xF9,0x08,0xF9,0x08,0xF9,0x08,0xD8,0x08,0x17,0x09,0xD6,0x08,0xF5,0x00,0xF4,0x00,0xD3,0x00,0xB3,0x08,0xB3,0x08,0x11,0x09,0x11,0x09,0xD0,0x10,0xCE,0x08,0xED,0x00,0xAC,0x00,0xC9,0x00,0x88,0x00,0x88,0x00,0x67,0x00,0x68,0x00,0x88,0x00,0xCA,0x00,0xAA,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xD0,0x08,0x31,0x09,0xD2,0x00,
-	0x32,0x01,0x13,0x01,0xB3,0x08,0x17,0x09,0x59,0x09,0x9C,0x09,0x5B,0x09,0x5A,0x09,0x5B,0x09,0x5B,0x09,0x5A,0x09,0x59,0x09,0xF6,0x08,0x34,0x11,0xB0,0x08,0x6B,0x00,0x28,0x00,0x28,0x00,0x48,0x00,0x29,0x00,0x4B,0x00,0x8E,0x10,0xAF,0x08,0x6F,0x10,0x90,0x08,0x90,0x08,0x92,0x10,0xB4,0x10,0xD7,0x08,0x58,0x29,0x6D,0x31,0xE6,0x18,
-	0x00,0x00,0xDD,0x49,0xDD,0x49,0x1E,0x52,0x3E,0x62,0x9D,0x72,0xDE,0x7A,0x3E,0x83,0x5F,0x93,0x5F,0x93,0x7F,0x9B,0x5F,0x93,0x1F,0x8B,0xDF,0x7A,0xBE,0x6A,0xB8,0x41,0x31,0x31,0xF0,0x20,0xF0,0x20,0xEE,0x20,0x0D,0x29,0xCB,0x18,0x86,0x10,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x42,0x00,0x63,0x00,0x65,0x00,0xA7,0x00,0xE9,0x00,0x2D,0x01,0x2D,0x09,0x0D,0x01,0x88,0x00,0x66,0x00,0x65,0x00,0x86,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x45,0x00,0x65,0x00,0x67,0x00,0x67,0x00,0x68,0x00,0x68,0x00,
-	0x69,0x00,0x6A,0x00,0xAA,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x10,0x09,0x31,0x09,0x51,0x09,0x72,0x09,0x51,0x09,0x2F,0x09,0x28,0x19,0x38,0xC6,0xBE,0xF7,0xBE,0xF7,0x38,0xC6,0xE6,0x10,0x67,0x00,0x48,0x00,0x6A,0x00,0x49,0x08,0x02,0x50,0x00,0xE0,0x00,0x80,0xB2,0x08,0xB3,0x08,0xD6,0x08,0xD7,0x10,0x19,0x11,0x1A,0x11,
-	0x1A,0x11,0x1A,0x11,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x00,0xB3,0x08,0xB2,0x08,0xB1,0x08,0xB2,0x08,0xB1,0x08,0xB0,0x08,0xEF,0x08,0xCE,0x08,0xED,0x00,0xCC,0x00,0xAA,0x00,0x88,0x00,0x67,0x00,0x67,0x00,0x88,0x00,0xA8,0x00,0xC9,0x00,0xAB,0x00,0xCD,0x00,0xCE,0x08,0xAF,0x08,0x11,0x09,0x31,0x01,
-	0x32,0x01,0x11,0x09,0xF4,0x00,0xD6,0x08,0x5A,0x09,0x9C,0x09,0x5C,0x09,0x5C,0x09,0x5C,0x09,0x5A,0x09,0x3A,0x09,0xF9,0x08,0x38,0x09,0xF5,0x10,0xF0,0x08,0x6C,0x00,0x28,0x00,0x27,0x00,0x29,0x00,0x4A,0x00,0x4C,0x08,0x6E,0x08,0x8F,0x10,0x90,0x10,0x8F,0x10,0xB2,0x10,0xD3,0x10,0x94,0x10,0xD8,0x10,0x58,0x29,0x4E,0x29,0xE5,0x18,
-	0x00,0x00,0xDD,0x49,0xDD,0x49,0x1E,0x52,0x7F,0x6A,0xBF,0x7A,0x1E,0x83,0x3F,0x93,0x7F,0x93,0x5F,0x93,0x9F,0x9B,0x3F,0x93,0x1F,0x8B,0xDF,0x7A,0xBE,0x6A,0xB8,0x41,0x12,0x29,0xF0,0x20,0x10,0x29,0xF0,0x20,0x6D,0x29,0x0C,0x29,0x87,0x10,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0xA7,0x00,0xE9,0x00,0x2A,0x01,0x2D,0x09,0x0A,0x01,0xA7,0x00,0x66,0x00,0x65,0x00,0x86,0x00,0x65,0x00,0x86,0x00,0x84,0x00,0x63,0x00,0x64,0x00,0x43,0x00,0x23,0x00,0x44,0x00,0x64,0x00,0x45,0x00,0x66,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,
-	0x8B,0x00,0xAC,0x00,0xAC,0x00,0xCE,0x00,0xCE,0x00,0xCF,0x08,0x10,0x09,0x10,0x09,0x51,0x09,0x72,0x09,0x51,0x09,0x2F,0x09,0x0D,0x01,0x0B,0x01,0x09,0x11,0x7A,0xC6,0x59,0xC6,0xC7,0x10,0x68,0x00,0x68,0x00,0x49,0x00,0x4B,0x00,0x02,0x38,0x00,0xE0,0x03,0x90,0x6E,0x10,0xB5,0x08,0xD7,0x08,0x19,0x11,0xF9,0x08,0x1A,0x11,0xDA,0x08,
-	0x1A,0x09,0xD9,0x08,0xD9,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xB3,0x00,0xB3,0x08,0xB2,0x08,0x91,0x08,0xB1,0x08,0xB1,0x08,0xB0,0x08,0xCF,0x08,0xCF,0x08,0xCE,0x08,0xED,0x00,0xAB,0x00,0x89,0x00,0x88,0x00,0x88,0x00,0x87,0x00,0x88,0x00,0xA9,0x00,0xAA,0x00,0xAC,0x00,0xCD,0x00,0xAF,0x08,0x11,0x09,0x31,0x01,
-	0x32,0x01,0x13,0x01,0xF4,0x00,0xD6,0x08,0x5A,0x09,0x9C,0x09,0x5D,0x09,0x5D,0x09,0x5C,0x09,0x5C,0x09,0x3B,0x09,0x59,0x09,0x38,0x09,0xF6,0x10,0xF3,0x10,0x6D,0x08,0x29,0x00,0x48,0x00,0x29,0x00,0x2A,0x00,0x6C,0x08,0x6D,0x08,0x6F,0x10,0x90,0x10,0xB1,0x10,0x92,0x08,0xD3,0x10,0xD6,0x18,0xF9,0x18,0x58,0x29,0x4E,0x31,0xE5,0x18,
-	0x00,0x00,0xDD,0x49,0xFE,0x51,0x3E,0x62,0x7F,0x6A,0xBD,0x7A,0xFE,0x82,0x5F,0x93,0x9F,0x9B,0x9F,0x9B,0x7F,0x9B,0x5F,0x8B,0x1F,0x8B,0xDF,0x7A,0x9D,0x6A,0x98,0x49,0x31,0x39,0x31,0x31,0xF1,0x20,0x4E,0x29,0x2F,0x29,0xED,0x28,0xA8,0x18,0x44,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0xA7,0x00,0xC9,0x00,0x0A,0x01,0x0B,0x01,0x0C,0x01,0xA8,0x00,0x86,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x43,0x00,0x23,0x00,0x44,0x00,0x65,0x00,0x66,0x00,0x68,0x00,0x89,0x00,0x8B,0x00,0x8B,0x00,
-	0xCD,0x00,0xCD,0x00,0xCF,0x08,0xCF,0x08,0xD0,0x08,0x31,0x09,0x31,0x09,0x51,0x09,0x51,0x09,0x31,0x09,0x0F,0x09,0x0D,0x01,0xCC,0x00,0xAA,0x00,0xA9,0x00,0x19,0xBE,0x19,0xBE,0x68,0x00,0x69,0x00,0x6A,0x00,0x4B,0x00,0x03,0x38,0x00,0xD0,0x00,0x98,0x49,0x10,0xD5,0x08,0xD8,0x08,0x1A,0x11,0x3B,0x11,0x3B,0x11,0xFB,0x10,0x1A,0x09,
-	0xD9,0x08,0xD9,0x08,0xD8,0x08,0xD7,0x08,0xD7,0x08,0xD7,0x08,0xD5,0x08,0xD5,0x08,0xD5,0x08,0xB4,0x08,0xB3,0x08,0xB3,0x08,0x71,0x08,0xB1,0x08,0xB0,0x08,0xCF,0x08,0xB0,0x08,0xCF,0x08,0xAE,0x10,0xAD,0x08,0xAB,0x00,0x89,0x00,0x88,0x00,0x67,0x00,0x88,0x00,0xA8,0x00,0xAA,0x00,0xAC,0x00,0xCD,0x00,0xCF,0x08,0xF1,0x08,0xD2,0x08,
-	0x33,0x01,0x32,0x01,0xF4,0x00,0xD6,0x08,0x5A,0x09,0x7D,0x09,0x7E,0x09,0x7E,0x09,0x5D,0x09,0x5C,0x09,0x3B,0x09,0x3A,0x09,0xF9,0x08,0x37,0x11,0xF3,0x00,0x6D,0x08,0x29,0x00,0x49,0x00,0x29,0x00,0x4B,0x00,0x6C,0x08,0x6E,0x08,0x90,0x08,0x91,0x10,0xD3,0x10,0x92,0x10,0xD5,0x18,0xD6,0x18,0xD9,0x10,0x58,0x29,0x8F,0x39,0xE6,0x10,
-	0x00,0x00,0xDD,0x49,0x1E,0x52,0x5E,0x62,0xBF,0x72,0xFE,0x82,0x3E,0x83,0x5F,0x93,0xBF,0x9B,0x5F,0x9B,0x9F,0x9B,0x5F,0x9B,0x1E,0x83,0xDE,0x7A,0x7D,0x72,0xB8,0x41,0x12,0x29,0x31,0x31,0xF1,0x20,0x10,0x29,0x4F,0x31,0x0D,0x29,0xC9,0x20,0x65,0x08,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x63,0x00,0x64,0x00,0xA7,0x00,0xC9,0x00,0x0A,0x01,0x0B,0x01,0xEB,0x00,0xC9,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0x66,0x00,0x86,0x00,0xA5,0x00,0x86,0x00,0x64,0x00,0x64,0x00,0x43,0x00,0x63,0x00,0x23,0x00,0x45,0x00,0x66,0x00,0x88,0x00,0x89,0x00,0x8B,0x00,0xAC,0x00,
-	0xCD,0x00,0xCF,0x08,0xD0,0x10,0x10,0x09,0x10,0x09,0x31,0x09,0x31,0x09,0x31,0x09,0x10,0x09,0xCF,0x08,0x0D,0x01,0xCD,0x00,0xCC,0x00,0xA9,0x00,0x88,0x00,0x19,0xBE,0x19,0xBE,0x69,0x00,0x6B,0x00,0x6B,0x00,0x03,0x28,0x00,0xC8,0x00,0xB8,0x6D,0x18,0xD7,0x10,0xFA,0x10,0x3B,0x11,0x3C,0x11,0x1D,0x11,0x1C,0x11,0x1B,0x11,0xDA,0x08,
-	0xDA,0x08,0xD9,0x08,0xD9,0x08,0xD9,0x08,0xD8,0x08,0xD8,0x08,0xD8,0x08,0xF8,0x10,0x18,0x11,0x18,0x11,0xF7,0x10,0xB6,0x10,0xB4,0x10,0xB3,0x08,0xB2,0x08,0xB0,0x08,0xB0,0x08,0xCF,0x08,0xCF,0x08,0xEE,0x00,0xAC,0x08,0xAB,0x00,0x88,0x00,0x88,0x00,0x68,0x00,0x88,0x00,0x8A,0x00,0xAB,0x00,0xCD,0x00,0xCF,0x08,0xD1,0x08,0xD2,0x08,
-	0x32,0x01,0x33,0x01,0xF4,0x00,0xD6,0x08,0x59,0x09,0x7D,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5D,0x09,0x3C,0x09,0x5B,0x09,0x1A,0x11,0x38,0x09,0xF5,0x10,0x6F,0x08,0x4A,0x00,0x49,0x00,0x4A,0x00,0x2B,0x00,0x6C,0x08,0x90,0x08,0x90,0x08,0xB2,0x08,0xD3,0x10,0xD4,0x10,0x95,0x10,0xD6,0x18,0x19,0x21,0x59,0x29,0x4F,0x31,0xE6,0x18,
-	0x00,0x00,0xFE,0x51,0x3F,0x5A,0x5F,0x62,0xDF,0x7A,0xDF,0x82,0x3E,0x8B,0x9F,0x9B,0xBF,0x9B,0x9F,0x9B,0x9F,0x9B,0x5F,0x9B,0x1F,0x8B,0xDF,0x7A,0x9D,0x6A,0xB8,0x41,0x12,0x29,0x11,0x21,0x11,0x29,0x31,0x31,0x6F,0x31,0x4E,0x29,0xCA,0x20,0x66,0x08,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x64,0x00,0xA7,0x00,0xE8,0x00,0xCA,0x00,0x0A,0x01,0x0C,0x01,0xEA,0x00,0xE9,0x00,0xA8,0x00,0xA7,0x00,0xA7,0x00,0x86,0x00,0x86,0x00,0xA6,0x00,0xA5,0x00,0x64,0x00,0x64,0x00,0x44,0x00,0x24,0x00,0x24,0x00,0x65,0x00,0x67,0x00,0x69,0x00,0x8A,0x00,0xAC,0x00,
-	0xCE,0x00,0xCE,0x10,0x0E,0x09,0x10,0x09,0xF0,0x10,0x10,0x09,0x10,0x09,0xCF,0x08,0xCE,0x08,0xEE,0x00,0xCC,0x00,0xAB,0x00,0xAA,0x00,0x69,0x00,0x68,0x00,0x19,0xBE,0x1A,0xBE,0x6B,0x00,0x6C,0x08,0x4B,0x18,0x00,0xC0,0x00,0xC0,0x49,0x18,0xB8,0x08,0xFA,0x08,0x3C,0x11,0x3C,0x11,0x1D,0x11,0x1D,0x11,0x1C,0x11,0x1C,0x11,0xFC,0x10,
-	0xDA,0x08,0xFB,0x10,0xFA,0x10,0xFA,0x18,0x3B,0x19,0x3B,0x19,0x5B,0x19,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5B,0x19,0x3A,0x19,0x39,0x19,0x37,0x19,0xD5,0x10,0xB2,0x08,0x91,0x08,0x91,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x00,0xAB,0x00,0xA9,0x00,0x88,0x00,0xA8,0x00,0xA8,0x00,0x89,0x00,0xAA,0x00,0xCD,0x00,0xCE,0x00,0xEF,0x08,0x11,0x09,
-	0x33,0x01,0xD3,0x00,0x14,0x01,0xD6,0x08,0x59,0x09,0x9C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5D,0x09,0x5C,0x09,0x3B,0x09,0x19,0x11,0xF6,0x08,0x6F,0x08,0x4B,0x00,0x2A,0x00,0x4A,0x00,0x2B,0x00,0x6C,0x08,0x6F,0x08,0xB1,0x08,0xD3,0x10,0xB3,0x10,0x95,0x10,0xD5,0x18,0xD7,0x10,0xFB,0x18,0x58,0x29,0x8F,0x41,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x3F,0x5A,0x7F,0x6A,0xDF,0x7A,0x1F,0x8B,0x3E,0x93,0x9F,0x9B,0xBF,0x9B,0x9F,0x9B,0x9F,0x9B,0x5F,0x9B,0x1F,0x8B,0xDF,0x7A,0x9C,0x6A,0xB8,0x41,0x12,0x29,0x31,0x31,0x11,0x29,0x31,0x31,0x30,0x31,0x4E,0x29,0xCB,0x20,0x66,0x10,0x45,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x41,0x00,0x62,0x00,0x64,0x00,0xA7,0x00,0xA7,0x00,0xC8,0x00,0xAA,0x00,0xCA,0x00,0xEB,0x00,0xEA,0x00,0xA9,0x00,0xA8,0x00,0xA7,0x00,0x86,0x00,0x86,0x00,0xA6,0x00,0xA7,0x00,0xA5,0x00,0x64,0x00,0x64,0x00,0x44,0x00,0x24,0x00,0x25,0x00,0x66,0x00,0x68,0x00,0x68,0x00,0xAA,0x00,
-	0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCE,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAA,0x00,0x69,0x00,0x49,0x00,0x6A,0x00,0x19,0xBE,0x1A,0xBE,0x6D,0x08,0x4B,0x18,0x00,0xB8,0x00,0xC8,0x6E,0x30,0xD9,0x08,0x1B,0x11,0x1D,0x11,0x1D,0x11,0x1D,0x11,0x1E,0x11,0x1D,0x11,0x1C,0x11,0xFB,0x10,0xFB,0x10,
-	0x1B,0x11,0x3B,0x19,0x5C,0x21,0x9D,0x21,0x9D,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBD,0x29,0xBD,0x29,0x7D,0x29,0x9C,0x29,0x9C,0x21,0x3A,0x19,0x38,0x19,0xD5,0x10,0xF3,0x00,0xB1,0x08,0xB0,0x08,0xCF,0x08,0xCE,0x00,0xAC,0x00,0xAB,0x00,0xA9,0x00,0x68,0x00,0xA8,0x00,0xA9,0x00,0xAA,0x00,0xCD,0x00,0xCE,0x00,0xEF,0x08,0x11,0x09,
-	0x32,0x01,0x33,0x01,0x14,0x01,0xD6,0x08,0x59,0x09,0x5C,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5C,0x09,0x5C,0x09,0x3B,0x09,0x1A,0x11,0x17,0x09,0xB1,0x08,0x4B,0x00,0x2A,0x00,0x4A,0x00,0x2B,0x00,0x6C,0x08,0x70,0x08,0xB2,0x08,0xB4,0x10,0xB5,0x08,0xB6,0x18,0xD7,0x08,0xD7,0x10,0xFB,0x18,0x58,0x29,0xB0,0x39,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x5F,0x5A,0xBF,0x72,0xDE,0x7A,0x1E,0x83,0x5F,0x9B,0x7F,0x9B,0xBF,0x9B,0x7F,0x9B,0x9F,0x9B,0x5F,0x9B,0x1F,0x8B,0xDF,0x7A,0xBD,0x6A,0xB8,0x41,0x12,0x29,0x11,0x21,0x31,0x31,0x31,0x31,0x31,0x39,0x6E,0x31,0xEC,0x20,0x67,0x10,0x45,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x42,0x00,0x63,0x00,0x65,0x00,0x86,0x00,0xA8,0x00,0xE9,0x00,0xEA,0x00,0xCB,0x00,0x0C,0x01,0x0A,0x01,0xA8,0x00,0x87,0x00,0xA7,0x00,0x87,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA5,0x00,0x65,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x46,0x00,0x67,0x00,0x68,0x00,
-	0x69,0x00,0x8A,0x00,0x6A,0x00,0xAB,0x00,0x8B,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAA,0x00,0x89,0x00,0x48,0x00,0x48,0x00,0x66,0x21,0x13,0x9D,0x5D,0xEF,0x5D,0xEF,0x8D,0x7B,0x00,0x90,0x00,0xD8,0x26,0x40,0xD9,0x08,0x3C,0x11,0x3E,0x19,0x3F,0x19,0x1E,0x11,0x1E,0x11,0x1D,0x11,0x1C,0x11,0x1C,0x11,0x3C,0x11,0x3C,0x11,
-	0x5D,0x21,0x5D,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0xBE,0x29,0x9E,0x29,0x9E,0x21,0x9D,0x21,0x7D,0x19,0x7D,0x19,0x9C,0x19,0x9C,0x21,0x5A,0x11,0x57,0x19,0xF5,0x10,0xD3,0x08,0xB1,0x08,0xAF,0x08,0xCE,0x00,0xCD,0x00,0xAC,0x00,0xAA,0x00,0xCA,0x00,0xA8,0x00,0x8A,0x00,0xAA,0x00,0xAB,0x00,0xCE,0x00,0xCF,0x08,0xD2,0x08,
-	0x32,0x01,0x34,0x01,0x14,0x01,0xD5,0x08,0x38,0x09,0x5D,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x7E,0x09,0x5E,0x09,0x5C,0x09,0x5B,0x09,0x5A,0x09,0x18,0x11,0x92,0x08,0x4B,0x00,0x2A,0x00,0x2A,0x00,0x2B,0x00,0x6E,0x08,0xB0,0x10,0xB3,0x08,0xD4,0x08,0xD5,0x10,0x95,0x10,0xD7,0x18,0xF8,0x18,0xFB,0x18,0x59,0x29,0x6F,0x39,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x7F,0x6A,0xBF,0x72,0x1E,0x83,0x3F,0x93,0x5F,0x9B,0xBF,0xA3,0xBF,0x9B,0xBF,0x9B,0x9F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x7A,0x9C,0x6A,0x96,0x41,0x12,0x29,0x31,0x31,0x11,0x21,0x31,0x31,0x31,0x39,0x30,0x31,0x4D,0x29,0x68,0x18,0x45,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x64,0x00,0x66,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0x0A,0x01,0xCB,0x00,0xCB,0x00,0xE9,0x00,0xA9,0x00,0xA7,0x00,0x67,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x86,0x00,0x65,0x00,0x64,0x00,0x25,0x00,0x45,0x00,0x45,0x00,0x46,0x00,0x67,0x00,
-	0x68,0x00,0x68,0x08,0x69,0x00,0x8A,0x00,0xAA,0x00,0x8A,0x00,0xAA,0x00,0x89,0x00,0xAA,0x00,0x68,0x00,0x69,0x00,0x48,0x00,0x46,0x21,0xFB,0xDE,0xE7,0x71,0xE7,0xE1,0xE7,0xE9,0x82,0xC0,0x00,0xE0,0x00,0x38,0xB4,0x08,0x1C,0x11,0x5E,0x19,0x3F,0x19,0x3F,0x11,0x30,0x21,0xB9,0x94,0x3E,0xBE,0x3E,0xBE,0x3E,0xBE,0x3E,0xC6,0x3E,0xC6,
-	0x5E,0xC6,0x5E,0xC6,0x5E,0xC6,0x5F,0xC6,0x5E,0xC6,0x5E,0xC6,0x5E,0xC6,0x5E,0xC6,0x5E,0xC6,0x3E,0xC6,0x5E,0xC6,0x5E,0xC6,0x5E,0xC6,0x5E,0xC6,0x5D,0xC6,0x3D,0xC6,0x3D,0xC6,0x3C,0xC6,0x1B,0xBE,0x1B,0xBE,0x1A,0xBE,0x1A,0xBE,0x1A,0xBE,0x1A,0xBE,0x19,0xBE,0x19,0xBE,0x19,0xBE,0x1A,0xBE,0x1A,0xBE,0x1A,0xBE,0x1B,0xBE,0x3B,0xBE,
-	0x3C,0xBE,0x3C,0xBE,0x3C,0xBE,0x1C,0xBE,0x3D,0xBE,0x5E,0xBE,0x5E,0xBE,0x5F,0xBE,0x5E,0xBE,0x5E,0xBE,0x3E,0xBE,0x3E,0xBE,0x3E,0xBE,0x3D,0xBE,0x3D,0xBE,0x1B,0xBE,0x1A,0xBE,0x1A,0xBE,0xF9,0xBD,0xFA,0xBD,0x1A,0xBE,0x1B,0xBE,0x1C,0xBE,0xFB,0xBD,0x72,0x6B,0xD3,0x18,0xD8,0x08,0xDA,0x10,0xFB,0x18,0x5A,0x31,0xF1,0x39,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x7F,0x6A,0xBF,0x72,0xFF,0x8A,0x3F,0x93,0x7F,0x9B,0xBF,0x9B,0xBF,0xA3,0xBF,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0xFE,0x7A,0x9C,0x62,0xB7,0x41,0x12,0x29,0x11,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x39,0x4D,0x29,0xA8,0x18,0x66,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0xA8,0x00,0xC9,0x00,0xCA,0x00,0xCA,0x00,0xAB,0x00,0xCA,0x00,0xA8,0x00,0x88,0x00,0x67,0x00,0x87,0x00,0x87,0x00,0xA7,0x00,0x87,0x00,0x86,0x00,0x66,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
-	0x26,0x00,0x47,0x00,0x47,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x68,0x00,0x48,0x00,0x28,0x00,0x49,0x00,0x49,0x00,0x6A,0x00,0x13,0x9D,0xE7,0x71,0x00,0xE8,0x20,0xC8,0x20,0xC8,0x00,0xF0,0x82,0x90,0x8D,0x73,0x1C,0x11,0x3D,0x11,0x5F,0x19,0x3F,0x19,0x79,0x21,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x8D,0x6B,0xD7,0x10,0xD9,0x10,0x1B,0x19,0xDB,0x39,0x6F,0x39,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x7F,0x6A,0xDF,0x82,0x3E,0x83,0x5F,0x93,0x7F,0xA3,0xDF,0xAB,0xBF,0xA3,0xBF,0x9B,0x9F,0x9B,0x3F,0x8B,0x3F,0x8B,0xFE,0x7A,0x5C,0x6A,0x97,0x41,0x12,0x29,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x39,0x51,0x39,0x4D,0x29,0xA9,0x18,0x66,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x45,0x00,0x66,0x00,0x87,0x00,0xA7,0x00,0xA9,0x00,0xCA,0x00,0xEB,0x00,0xEA,0x00,0xAA,0x00,0xAA,0x00,0xA8,0x00,0x88,0x00,0x68,0x00,0x87,0x00,0xA7,0x00,0x87,0x00,0x87,0x00,0x67,0x00,0x66,0x00,0x46,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
-	0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x47,0x00,0x28,0x00,0x28,0x00,0x29,0x00,0x4A,0x00,0x4B,0x00,0x8C,0x00,0x7D,0xEF,0xE7,0xE1,0x20,0xC8,0xE3,0x30,0xE3,0x30,0x20,0xC8,0xE7,0xE1,0x9D,0xEF,0x3E,0xC6,0x5F,0xC6,0x3F,0xC6,0x3F,0xC6,0x7E,0xCE,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xD9,0x08,0xFA,0x10,0x1B,0x19,0xDB,0x39,0x8F,0x41,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x9E,0x6A,0x1E,0x7B,0x3F,0x93,0x7F,0x9B,0xDF,0xAB,0xDF,0xAB,0xBF,0xA3,0xBF,0xA3,0x7F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x7A,0x9B,0x6A,0x96,0x39,0x31,0x39,0x31,0x31,0x31,0x31,0x31,0x39,0x51,0x41,0x51,0x41,0x4E,0x31,0xCA,0x28,0x47,0x10,0x45,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x45,0x00,0x66,0x00,0x67,0x00,0x88,0x00,0xA8,0x00,0xCA,0x00,0xAA,0x00,0xEA,0x00,0xAA,0x00,0xCA,0x00,0xA8,0x00,0x88,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x87,0x00,0x67,0x00,0x66,0x00,0x66,0x00,0x26,0x00,0x26,0x00,
-	0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x6A,0x00,0x6C,0x00,0x6C,0x08,0x6E,0x08,0x7D,0xEF,0xE7,0xE1,0x20,0xC8,0xE3,0x30,0xE3,0x30,0x20,0xC8,0xE7,0xE1,0x9D,0xEF,0x3F,0xC6,0x3F,0xC6,0x3F,0xC6,0x3E,0xC6,0x7E,0xCE,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xD9,0x08,0xFB,0x18,0x1C,0x19,0xDC,0x41,0x8F,0x41,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBE,0x72,0x1E,0x83,0x3F,0x93,0x7F,0x9B,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0xA3,0x7F,0x9B,0x5F,0x9B,0x3F,0x8B,0xDF,0x7A,0x7B,0x6A,0x95,0x41,0x31,0x31,0x11,0x29,0x31,0x31,0x31,0x31,0x52,0x41,0x51,0x41,0x6E,0x31,0xEB,0x28,0x47,0x10,0x45,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x45,0x00,0x66,0x00,0x67,0x00,0x88,0x00,0xA9,0x00,0xEA,0x00,0xAA,0x00,0xEA,0x00,0xCA,0x00,0xC9,0x00,0xA8,0x00,0x88,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x47,0x00,0x46,0x00,
-	0x46,0x00,0x26,0x00,0x46,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x08,0x6D,0x08,0x70,0x08,0x71,0x08,0x13,0x9D,0xE7,0xB1,0x00,0xF0,0x20,0xC8,0x20,0xD0,0x00,0xE8,0xE7,0x71,0x13,0x9D,0x5F,0x19,0x3F,0x19,0x3F,0x19,0x5E,0x19,0x98,0x29,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x8D,0x6B,0xD9,0x08,0xFB,0x18,0x5C,0x21,0xDC,0x39,0x8F,0x41,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x83,0x9E,0x9B,0x9E,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xA3,0xDF,0xAB,0x9F,0x9B,0x5F,0x9B,0x1F,0x8B,0xDD,0x7A,0x7B,0x6A,0x95,0x41,0x12,0x29,0x31,0x31,0x31,0x31,0x51,0x41,0x51,0x41,0x51,0x41,0x30,0x39,0xED,0x28,0x67,0x10,0x26,0x08,0x24,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x44,0x00,0x45,0x00,0x45,0x00,0x66,0x00,0x67,0x00,0x88,0x00,0x88,0x00,0xA9,0x00,0xCA,0x00,0xCA,0x00,0xAA,0x00,0xAA,0x00,0xA9,0x00,0xA8,0x00,0x68,0x00,0x68,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x68,0x00,0x68,0x00,
-	0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x4A,0x00,0x6B,0x00,0x6C,0x08,0x6D,0x08,0x6F,0x08,0x70,0x08,0x72,0x08,0xB4,0x08,0x00,0x30,0x00,0xD0,0x82,0xD0,0xE7,0xE9,0xE7,0xE1,0xE7,0x71,0xFB,0xDE,0x8A,0x31,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x7E,0x29,0xDF,0x31,0x90,0x31,0xF9,0x9C,0x7E,0xCE,0x5E,0xCE,0x5F,0xCE,0x5F,0xC6,0x5F,0xC6,
-	0x3E,0xC6,0x5F,0xC6,0x5E,0xC6,0x5E,0xC6,0x3E,0xC6,0x3E,0xC6,0x3E,0xC6,0x3E,0xC6,0x3E,0xC6,0x3E,0xC6,0x3D,0xC6,0x3D,0xC6,0x3D,0xC6,0x1D,0xC6,0x1D,0xBE,0x3D,0xBE,0x3D,0xBE,0x3D,0xBE,0x3D,0xBE,0x3D,0xBE,0x5C,0xBE,0x3C,0xC6,0x3B,0xBE,0x3B,0xBE,0x1A,0xBE,0x1A,0xBE,0x1A,0xBE,0x19,0xBE,0x1A,0xBE,0x1A,0xBE,0x1B,0xBE,0x1B,0xBE,
-	0x3C,0xBE,0x3C,0xBE,0x3C,0xBE,0x1C,0xBE,0x3D,0xBE,0x3D,0xBE,0x3E,0xBE,0x5E,0xBE,0x5E,0xBE,0x5E,0xBE,0x5E,0xBE,0x5E,0xBE,0x5E,0xBE,0x3E,0xBE,0x3E,0xBE,0x3C,0xBE,0x1A,0xBE,0x1A,0xBE,0x1A,0xBE,0x1A,0xBE,0x1A,0xBE,0x1B,0xBE,0x1C,0xBE,0xFC,0xBD,0x72,0x6B,0xD5,0x08,0xFB,0x18,0xFB,0x18,0x5D,0x21,0xBD,0x39,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x83,0x9E,0x9B,0xBE,0xA3,0xDF,0xAB,0xDF,0xAB,0xDF,0xA3,0xDF,0xAB,0xBF,0xA3,0x5F,0x9B,0x1F,0x8B,0xDD,0x7A,0x7B,0x62,0x95,0x41,0x11,0x29,0x31,0x31,0x31,0x31,0x51,0x41,0x52,0x41,0x51,0x41,0x90,0x41,0x0D,0x29,0x87,0x10,0x26,0x08,0x24,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x45,0x00,0x66,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0xA9,0x00,0x8A,0x00,0x8A,0x00,0xAA,0x00,0xAA,0x00,0xA9,0x00,0xA9,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,
-	0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x08,0x6C,0x08,0x6D,0x08,0x6E,0x08,0x70,0x08,0x71,0x08,0x73,0x08,0xB6,0x08,0x4A,0x28,0x00,0xD0,0x00,0xA8,0x8E,0x83,0x7D,0xEF,0x7D,0xEF,0x13,0x9D,0x8A,0x31,0x5C,0x19,0x5E,0x21,0x5E,0x21,0xBE,0x29,0xFF,0x39,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xFE,0x41,0xFE,0x39,0xDE,0x39,0xDF,0x31,0xDF,0x31,
-	0xBE,0x31,0x7E,0x31,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5D,0x29,0x5C,0x29,0x3C,0x21,0x1B,0x19,0xFA,0x18,0xFA,0x18,0x18,0x19,0x18,0x19,0xD6,0x10,0xD6,0x10,0xD5,0x08,0x17,0x09,0xF5,0x10,0x35,0x09,0x15,0x11,0x34,0x11,0x32,0x09,0xCF,0x08,0xCE,0x00,0x8B,0x00,0x8A,0x00,0xAA,0x00,0x8B,0x00,0xAE,0x08,0xAF,0x08,0xB2,0x08,
-	0xD3,0x00,0xF4,0x00,0x15,0x01,0xF5,0x00,0xD7,0x08,0xF8,0x08,0x5C,0x09,0x7D,0x09,0x9E,0x09,0x9E,0x09,0x7E,0x09,0x9E,0x09,0x7E,0x09,0x3C,0x09,0x3A,0x11,0xF4,0x08,0x4D,0x00,0x2C,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x91,0x08,0x93,0x10,0xD5,0x18,0xD7,0x18,0xD8,0x08,0xFB,0x18,0xFB,0x18,0x5D,0x21,0x1C,0x42,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x93,0x7E,0x9B,0xDF,0xAB,0xDF,0xAB,0x1F,0xAC,0xDF,0xAB,0xDF,0xAB,0xBF,0xA3,0x5F,0x9B,0x3F,0x8B,0xDC,0x7A,0x19,0x6A,0x95,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x39,0x51,0x41,0x91,0x41,0x91,0x49,0x2E,0x31,0xA9,0x20,0x66,0x10,0x45,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x47,0x00,0x68,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x8A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x08,0x6B,0x00,0x4B,0x00,0x6B,0x00,0x6B,0x00,
-	0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6D,0x08,0x6E,0x08,0x70,0x08,0x72,0x08,0xB4,0x08,0xD6,0x10,0xD7,0x10,0x6E,0x20,0x00,0xC0,0x01,0xC0,0x47,0x28,0x5E,0x19,0x5E,0x19,0x7E,0x19,0x7E,0x19,0x5D,0x19,0x5D,0x21,0x7C,0x29,0xBD,0x31,0x3F,0x42,0x3F,0x42,0x3E,0x42,0x3E,0x4A,0x1E,0x42,0xFE,0x41,0xDD,0x49,0xDE,0x39,0xBE,0x39,0xDE,0x31,
-	0x7E,0x31,0x7E,0x31,0xBE,0x29,0x5E,0x29,0x5E,0x31,0x5E,0x31,0x5D,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x1A,0x19,0x1A,0x19,0x19,0x19,0x39,0x19,0xF7,0x10,0xF5,0x10,0xF6,0x08,0xF4,0x08,0xD4,0x08,0x15,0x09,0x34,0x09,0x13,0x11,0xF2,0x08,0xD1,0x08,0xCE,0x00,0xAB,0x00,0xAA,0x00,0xAA,0x00,0xAB,0x00,0xCE,0x00,0xAF,0x08,0xB2,0x08,
-	0x14,0x01,0x14,0x01,0x16,0x09,0xD5,0x08,0xD7,0x08,0xD8,0x08,0x5A,0x09,0x9D,0x11,0x7E,0x09,0x7E,0x09,0x9E,0x09,0x7E,0x11,0x7E,0x11,0x5D,0x11,0x3A,0x19,0xD4,0x08,0x6D,0x00,0x2B,0x00,0x4C,0x00,0x4C,0x00,0x6E,0x08,0x90,0x08,0xB3,0x08,0xD6,0x10,0xD7,0x10,0xD8,0x08,0xFB,0x10,0x3C,0x21,0x5D,0x29,0xBD,0x39,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x9B,0xDF,0xAB,0xDF,0xAB,0x1F,0xAC,0xDF,0xAB,0xDF,0xAB,0xBF,0xA3,0x5F,0x9B,0x3F,0x93,0xBC,0x7A,0x5A,0x62,0x74,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x52,0x41,0x51,0x41,0x91,0x49,0x2E,0x39,0xA9,0x20,0x67,0x08,0x25,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x46,0x00,0x48,0x00,0x48,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x2C,0x00,0x6B,0x00,0x6D,0x08,
-	0x6D,0x08,0x6D,0x08,0x70,0x08,0x70,0x08,0x71,0x08,0x73,0x00,0x74,0x08,0xD6,0x10,0xD9,0x08,0x1A,0x11,0x00,0xA0,0x00,0xD0,0x47,0x38,0x5E,0x21,0x5E,0x21,0x5E,0x21,0x5E,0x21,0x5E,0x21,0x7D,0x29,0x9E,0x29,0xDE,0x41,0x1F,0x4A,0x3F,0x52,0x3F,0x52,0x3E,0x4A,0x3D,0x42,0xFD,0x41,0xFE,0x41,0xFE,0x41,0xDE,0x49,0xBD,0x41,0xBD,0x39,
-	0xBE,0x39,0xBE,0x39,0x7E,0x31,0xBD,0x39,0xBD,0x39,0x9D,0x31,0xBD,0x39,0xBD,0x41,0x9C,0x31,0x9C,0x31,0x9C,0x31,0x7B,0x39,0x3A,0x21,0x19,0x19,0x18,0x19,0xF7,0x10,0xD5,0x10,0xD5,0x08,0xD4,0x08,0x14,0x01,0xF3,0x08,0x13,0x01,0x11,0x09,0x11,0x09,0xCE,0x08,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xCE,0x00,0xAF,0x08,0xB2,0x08,
-	0x14,0x01,0x14,0x01,0x16,0x09,0x14,0x01,0xD5,0x08,0xD8,0x08,0x5A,0x09,0x5D,0x09,0x9E,0x09,0x9E,0x11,0x9E,0x09,0x9E,0x09,0x7E,0x11,0x7D,0x11,0x3A,0x19,0xD4,0x08,0x6D,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x90,0x08,0xD3,0x10,0xD6,0x18,0xD7,0x18,0xFA,0x10,0xFB,0x10,0x3D,0x19,0x7D,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xAB,0xDF,0xAB,0xDF,0xB3,0xFF,0xAB,0x1F,0xAC,0xDF,0xAB,0xBF,0xA3,0x5F,0x9B,0x3F,0x93,0xDD,0x82,0x18,0x6A,0x95,0x41,0x31,0x31,0x31,0x31,0x31,0x39,0x51,0x41,0x52,0x41,0x91,0x41,0x91,0x41,0x6E,0x39,0xCB,0x20,0x66,0x10,0x25,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x45,0x00,0x45,0x00,0x26,0x00,0x26,0x00,0x47,0x00,0x27,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x4B,0x00,0x2B,0x00,0x6B,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x6E,0x08,0x6F,0x08,
-	0x71,0x08,0x71,0x08,0x72,0x08,0x93,0x08,0x95,0x10,0xD7,0x08,0xD8,0x08,0xFA,0x18,0x3C,0x21,0x5D,0x19,0x45,0x78,0x45,0x28,0x5E,0x19,0x5E,0x19,0x5E,0x29,0x3D,0x19,0x5E,0x29,0x7E,0x29,0xDE,0x31,0x1F,0x42,0x3F,0x4A,0x3F,0x5A,0x3F,0x52,0x3D,0x4A,0x3E,0x52,0x1E,0x4A,0x3F,0x4A,0xFE,0x41,0xDE,0x49,0xDE,0x49,0xBD,0x39,0xDD,0x49,
-	0xDE,0x49,0xDD,0x49,0xDE,0x49,0xDD,0x49,0x1E,0x4A,0x1E,0x52,0x3E,0x52,0x5D,0x5A,0x5F,0x5A,0x5D,0x5A,0x5C,0x4A,0x1D,0x4A,0xDD,0x39,0xBA,0x39,0x39,0x21,0xF7,0x18,0xD6,0x18,0xD5,0x08,0xD4,0x08,0xB3,0x08,0x13,0x01,0x13,0x11,0x32,0x09,0x11,0x09,0x10,0x01,0xCD,0x00,0xAC,0x00,0x8B,0x00,0xAB,0x00,0xCE,0x00,0xCF,0x08,0xB2,0x08,
-	0x34,0x01,0x35,0x01,0x14,0x01,0xD5,0x08,0xD6,0x08,0xD7,0x08,0x39,0x09,0x5B,0x09,0x9E,0x11,0x9E,0x11,0x7E,0x11,0x7E,0x11,0x7E,0x11,0x5C,0x11,0x1A,0x19,0xB4,0x08,0x6B,0x00,0x6B,0x00,0x2B,0x00,0x4C,0x00,0x6E,0x08,0x90,0x08,0xB3,0x10,0xD6,0x18,0xD7,0x10,0xD9,0x08,0xFB,0x18,0x1D,0x19,0x7E,0x31,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xAB,0x1F,0xAC,0xDF,0xB3,0xFF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x3F,0x93,0xDC,0x7A,0xF8,0x61,0x53,0x41,0x31,0x31,0x31,0x31,0x31,0x31,0x51,0x41,0x91,0x41,0x91,0x41,0x91,0x41,0x4E,0x49,0xCC,0x20,0x68,0x18,0x25,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x45,0x00,0x45,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x47,0x00,0x27,0x00,0x28,0x00,0x48,0x00,0x48,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x00,0x6C,0x00,0x4D,0x00,0x6D,0x08,0x6D,0x08,0x6F,0x08,0x70,0x08,0x71,0x08,0x72,0x00,0x74,0x08,
-	0x94,0x08,0x95,0x10,0xB6,0x10,0xB8,0x08,0xD8,0x08,0xDA,0x10,0x3B,0x21,0x3D,0x19,0x3E,0x21,0x5E,0x21,0x1C,0x19,0x1D,0x19,0x5E,0x21,0x5E,0x29,0x5E,0x29,0x5D,0x29,0x7E,0x31,0xDE,0x41,0x1E,0x42,0x3F,0x52,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3D,0x52,0xFD,0x51,0xFE,0x49,0xFE,0x49,0xFE,0x49,0x1E,0x42,0xFE,0x49,0x1D,0x52,0x1D,0x52,
-	0x1D,0x52,0x1D,0x5A,0x7D,0x62,0x9E,0x6A,0x1F,0x73,0x5F,0x7B,0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,0x1F,0x73,0x1F,0x73,0x1F,0x73,0x9E,0x62,0x9E,0x52,0x1C,0x4A,0x7A,0x39,0xF8,0x18,0xD6,0x18,0xD4,0x10,0xB3,0x08,0xD3,0x08,0xD2,0x08,0x11,0x09,0x11,0x09,0x10,0x09,0xCE,0x00,0xAC,0x00,0xAB,0x00,0xAB,0x00,0xCE,0x00,0xCF,0x08,0xF3,0x00,
-	0x34,0x01,0x35,0x01,0x36,0x01,0xD4,0x00,0xF5,0x00,0xD7,0x08,0x39,0x09,0x5B,0x09,0x7E,0x09,0x9E,0x11,0x7E,0x11,0x9E,0x11,0x7E,0x11,0x5C,0x11,0x1A,0x19,0xB4,0x08,0x4C,0x00,0x4B,0x00,0x4B,0x00,0x4C,0x00,0x6C,0x08,0x90,0x08,0x72,0x10,0xD5,0x18,0xD7,0x10,0xFA,0x10,0xFB,0x18,0x3C,0x21,0x7E,0x31,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0x1F,0xB4,0xDF,0xAB,0x1F,0xAC,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0xBD,0x82,0xF8,0x69,0x73,0x41,0x10,0x31,0x0F,0x31,0x31,0x39,0x51,0x41,0x72,0x41,0xB1,0x49,0xB1,0x49,0x8E,0x39,0x4D,0x29,0x67,0x18,0x25,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x24,0x00,0x24,0x00,0x25,0x00,0x46,0x00,0x47,0x08,0x67,0x08,0x68,0x08,0x48,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6C,0x08,0x6C,0x00,0x8E,0x00,0x6E,0x08,0x6E,0x08,0x70,0x08,0x70,0x08,0x70,0x08,0x70,0x08,0x72,0x08,0x72,0x10,0xB5,0x08,0x75,0x10,0x76,0x08,0xB7,0x08,
-	0xD8,0x10,0xD9,0x08,0xFB,0x18,0xFB,0x18,0x3C,0x21,0x3E,0x21,0x5E,0x29,0x3E,0x21,0x3E,0x19,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5D,0x31,0xBD,0x39,0xFE,0x49,0x3F,0x52,0x5F,0x5A,0x9F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x49,0x1E,0x52,0x1E,0x4A,0xFE,0x51,0xFE,0x51,0x1D,0x52,0x3D,0x5A,0x5C,0x6A,
-	0xBE,0x6A,0xFE,0x7A,0x5F,0x83,0x9F,0x93,0xBF,0x9B,0xBF,0x9B,0xBF,0x93,0xBF,0x83,0x5F,0x8B,0x7F,0x83,0x3F,0x7B,0x3F,0x7B,0x1F,0x73,0xBF,0x6A,0x9F,0x5A,0x3D,0x4A,0x9A,0x39,0x57,0x21,0xD6,0x10,0xD3,0x10,0xB2,0x08,0x11,0x09,0xF2,0x08,0xF1,0x10,0xF0,0x08,0xCE,0x08,0xAC,0x00,0xAB,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x08,0x33,0x01,
-	0x34,0x01,0x55,0x09,0x35,0x01,0x34,0x01,0xD4,0x00,0xF6,0x08,0xF7,0x08,0x59,0x09,0x5C,0x09,0x7E,0x11,0x7F,0x11,0x7F,0x11,0x7E,0x11,0x3C,0x11,0x19,0x19,0xB2,0x08,0x6B,0x00,0x4B,0x00,0x2B,0x00,0x6B,0x00,0x6C,0x08,0x90,0x08,0xB3,0x10,0xB5,0x10,0xD7,0x18,0xFA,0x18,0xFB,0x18,0x3C,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xB4,0xDF,0xB3,0x1F,0xB4,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0x1F,0x93,0xBC,0x7A,0xD7,0x59,0x51,0x41,0x10,0x29,0xED,0x28,0x31,0x31,0x51,0x41,0x51,0x41,0xB1,0x49,0xB1,0x49,0x90,0x49,0x0D,0x31,0xA8,0x18,0x65,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x47,0x08,0x68,0x08,0x69,0x08,0x6A,0x08,0x6B,0x08,0x6B,0x08,0xAE,0x08,0x8E,0x10,0xAE,0x08,0x6D,0x08,0xAE,0x08,0x8F,0x00,0x90,0x08,0x90,0x08,0x90,0x08,0xB2,0x08,0x72,0x08,0x73,0x00,0x93,0x00,0x94,0x08,0x74,0x10,0x94,0x10,0xD6,0x10,0xB6,0x10,0xD8,0x08,0xDA,0x10,0xDA,0x10,0xDA,0x10,
-	0x3C,0x21,0x3D,0x21,0x5D,0x21,0x3E,0x19,0x5E,0x29,0x5E,0x29,0x3E,0x19,0x3E,0x21,0x3E,0x19,0x5C,0x29,0x5D,0x29,0x5D,0x29,0x5C,0x31,0x9E,0x31,0xDD,0x41,0x1E,0x52,0x7F,0x62,0x7F,0x62,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x1E,0x52,0x1D,0x52,0x3E,0x5A,0x3D,0x5A,0x9C,0x72,0xFE,0x82,
-	0x9E,0x93,0xBF,0xA3,0xFF,0x9B,0xBF,0xA3,0xFF,0xA3,0xDF,0xA3,0xFF,0x9B,0xBF,0x9B,0xBF,0x93,0x9F,0x93,0x5F,0x83,0x3E,0x7B,0x3E,0x7B,0x1E,0x7B,0xBF,0x62,0x9E,0x5A,0x1D,0x52,0x9A,0x39,0x57,0x21,0xD5,0x18,0xB3,0x08,0xB1,0x08,0xD1,0x08,0xD1,0x08,0x10,0x09,0xEF,0x08,0xCD,0x00,0x8B,0x00,0xCD,0x00,0xCD,0x00,0xD0,0x08,0x33,0x01,
-	0x55,0x01,0x76,0x09,0x35,0x01,0x34,0x01,0xD3,0x00,0x14,0x01,0xD7,0x08,0x39,0x09,0x5C,0x09,0x7E,0x11,0x9E,0x11,0x7F,0x11,0x7D,0x11,0x3B,0x19,0x18,0x11,0xB2,0x08,0x6B,0x00,0x4B,0x00,0x6B,0x00,0x2B,0x00,0x6C,0x08,0x70,0x08,0xB3,0x10,0xB5,0x10,0xD7,0x18,0xFA,0x18,0xFB,0x18,0x5D,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0x9B,0x5F,0x9B,0xDF,0x8A,0x9C,0x7A,0xB7,0x59,0x51,0x39,0xED,0x28,0xED,0x30,0x0F,0x31,0x30,0x41,0x91,0x41,0xB1,0x49,0xB1,0x49,0x8F,0x49,0x4D,0x31,0xC9,0x20,0x45,0x08,0x45,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x24,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x47,0x00,0x49,0x08,0x6A,0x08,0x6B,0x08,0x6D,0x08,0xAF,0x10,0xB1,0x10,0xD2,0x10,0xD3,0x10,0xD3,0x10,0xB3,0x08,0xD4,0x10,0xD4,0x08,0xD5,0x08,0xD5,0x18,0xD6,0x18,0xD6,0x10,0xD7,0x18,0xD8,0x18,0xD9,0x08,0x19,0x19,0xFA,0x18,0x1B,0x19,0xFB,0x18,0x5C,0x21,0x3D,0x19,0x3E,0x21,0x3E,0x21,
-	0x5E,0x21,0x5E,0x21,0x3E,0x21,0x3E,0x21,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5E,0x29,0x5D,0x29,0x5D,0x29,0x5C,0x29,0x7D,0x31,0xBD,0x41,0xFE,0x51,0x5F,0x5A,0x3F,0x5A,0x9F,0x5A,0x3F,0x5A,0x3E,0x5A,0x3E,0x5A,0x1E,0x5A,0x1E,0x5A,0x1D,0x52,0x1E,0x52,0x1D,0x52,0x3D,0x5A,0x3D,0x62,0x3D,0x62,0x9D,0x72,0xFF,0x8A,0x7F,0x93,0xBF,0xA3,
-	0xFF,0xAB,0x1F,0xAC,0x3F,0xB4,0xFF,0xAB,0x3F,0xB4,0xFF,0xAB,0xDF,0xAB,0xBF,0xA3,0xBF,0x9B,0xBF,0x9B,0x9E,0x8B,0x7E,0x83,0x3E,0x83,0x3E,0x7B,0x1F,0x73,0xBF,0x6A,0x9F,0x5A,0x3D,0x4A,0x99,0x39,0xF6,0x18,0xB4,0x10,0xB3,0x08,0xB1,0x08,0xF1,0x08,0xCF,0x08,0xCF,0x08,0xCE,0x00,0xCD,0x00,0xCD,0x00,0xCE,0x00,0xD1,0x08,0x33,0x01,
-	0x75,0x09,0x95,0x09,0x54,0x01,0x31,0x01,0x11,0x01,0x14,0x01,0xD6,0x08,0x39,0x09,0x3A,0x09,0x9D,0x11,0x7E,0x11,0x7E,0x11,0x5D,0x11,0x3A,0x11,0x17,0x11,0x71,0x08,0x4B,0x00,0x6B,0x00,0x4A,0x00,0x2B,0x00,0x6C,0x08,0x90,0x10,0x92,0x10,0xD6,0x18,0xD8,0x18,0xFB,0x18,0x3C,0x21,0x3D,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0x1F,0xB4,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0x5F,0xA3,0x5F,0x9B,0xDF,0x8A,0x5A,0x7A,0xB5,0x59,0x31,0x31,0xED,0x28,0xED,0x28,0x0F,0x31,0x30,0x41,0x91,0x41,0xB1,0x49,0xB1,0x49,0xB1,0x49,0x2D,0x41,0xCA,0x28,0x65,0x10,0x25,0x08,0x24,0x08,0x23,0x00,0x24,0x00,0x24,0x00,
-	0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x49,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x6F,0x08,0xB1,0x08,0xD3,0x10,0xD4,0x10,0xF6,0x18,0xD6,0x18,0x17,0x19,0x18,0x19,0x18,0x19,0x1A,0x19,0x1A,0x19,0x1B,0x19,0x1B,0x21,0x3B,0x21,0x1C,0x19,0x3C,0x21,0x3D,0x19,0x3D,0x19,0x3E,0x19,0x3E,0x21,0x3E,0x21,0x3E,0x19,0x3E,0x19,
-	0x3E,0x21,0x3E,0x21,0x3E,0x21,0x3E,0x21,0x3E,0x21,0x5E,0x29,0x5E,0x31,0x5C,0x29,0x5C,0x29,0x5C,0x39,0xBE,0x41,0x1E,0x4A,0x1E,0x52,0x5F,0x62,0x7F,0x62,0x5F,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x5A,0x3E,0x5A,0x3F,0x5A,0x1E,0x5A,0x3E,0x5A,0x1E,0x5A,0x3D,0x62,0x3C,0x62,0x5E,0x72,0xBE,0x82,0x5E,0x93,0xBF,0xA3,0xDF,0xAB,0xDF,0xB3,
-	0xFF,0xB3,0x1F,0xB4,0xDF,0xB3,0xDF,0xB3,0x1F,0xB4,0xDF,0xAB,0xBE,0xA3,0xBE,0xA3,0xBF,0x9B,0x7F,0x9B,0x9F,0x93,0x7F,0x83,0x3E,0x83,0x3E,0x7B,0x1F,0x7B,0xBF,0x6A,0x9F,0x62,0x3E,0x5A,0x1C,0x42,0x78,0x29,0xF6,0x18,0xB3,0x08,0xB1,0x08,0xAF,0x08,0xF0,0x08,0xCF,0x08,0xCE,0x00,0xCD,0x00,0x8C,0x00,0xCE,0x00,0xF0,0x00,0x33,0x01,
-	0x75,0x09,0x96,0x09,0x74,0x09,0x31,0x09,0x11,0x09,0xD2,0x00,0xF5,0x00,0xD7,0x08,0x5A,0x09,0x5C,0x11,0x9D,0x11,0x5C,0x11,0x3B,0x11,0x39,0x19,0x14,0x11,0x6F,0x08,0x4B,0x00,0x4A,0x00,0x6B,0x08,0x2B,0x00,0x6C,0x08,0x6F,0x08,0x92,0x10,0xD5,0x18,0x18,0x19,0xFA,0x18,0x3B,0x21,0x5D,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xBF,0xAB,0x5F,0x9B,0x5F,0x9B,0xBE,0x8A,0x9B,0x7A,0x74,0x51,0x0F,0x39,0xED,0x28,0xED,0x28,0xED,0x38,0x0E,0x41,0x51,0x41,0xB1,0x49,0xB1,0x49,0x90,0x49,0x6E,0x49,0xEB,0x28,0x46,0x10,0x46,0x08,0x45,0x08,0x25,0x08,0x25,0x00,0x25,0x00,
-	0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x29,0x00,0x69,0x00,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x70,0x08,0x72,0x08,0xB3,0x08,0xD5,0x10,0xD6,0x10,0xD7,0x10,0x19,0x19,0x19,0x11,0x1B,0x19,0xFB,0x18,0x3B,0x19,0x3C,0x19,0x3D,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x21,0x3E,0x19,0x3E,0x21,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x21,
-	0x3E,0x19,0x3E,0x21,0x3E,0x21,0x3C,0x21,0x5D,0x29,0x5C,0x29,0x5C,0x29,0x7D,0x31,0x9E,0x39,0x1E,0x4A,0x5F,0x5A,0x7F,0x62,0x9F,0x5A,0x9F,0x5A,0x7F,0x6A,0x7F,0x6A,0x3E,0x5A,0x3E,0x5A,0x3E,0x5A,0x3E,0x5A,0x1E,0x52,0x3E,0x5A,0x3E,0x62,0x3D,0x62,0x3D,0x6A,0x9D,0x72,0xFF,0x82,0x5F,0x9B,0xDF,0xAB,0x1F,0xB4,0x1F,0xB4,0x1F,0xB4,
-	0xFF,0xB3,0xFF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xBD,0xA3,0xBF,0x9B,0x9F,0x9B,0x7F,0x93,0x9F,0x83,0x7F,0x83,0x3E,0x83,0x3F,0x7B,0xDF,0x6A,0xBF,0x62,0x5F,0x5A,0x3E,0x52,0xBB,0x41,0x57,0x29,0xD3,0x10,0xB2,0x08,0xB0,0x08,0xCF,0x08,0xEE,0x08,0xCE,0x00,0xCD,0x00,0xCD,0x00,0xCE,0x00,0x31,0x09,0x33,0x01,
-	0x75,0x09,0x75,0x09,0x73,0x09,0x31,0x09,0x10,0x09,0xD2,0x08,0xB3,0x08,0xD6,0x08,0x39,0x09,0x7A,0x11,0x3B,0x11,0x3B,0x11,0x3A,0x19,0x37,0x19,0xF3,0x10,0x6E,0x08,0x6B,0x00,0x6A,0x00,0x2A,0x00,0x6B,0x00,0x6C,0x08,0x6F,0x08,0xB2,0x10,0xB6,0x10,0xD8,0x18,0xFB,0x18,0x1B,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xBF,0xA3,0x5F,0x9B,0xFF,0x92,0xBE,0x8A,0x5A,0x72,0x74,0x51,0x0F,0x39,0xED,0x28,0xED,0x28,0x0E,0x39,0x0F,0x39,0x51,0x41,0xB1,0x49,0x90,0x49,0x90,0x49,0x4E,0x49,0x0B,0x39,0x67,0x10,0x66,0x10,0x46,0x08,0x25,0x08,0x25,0x08,0x26,0x08,
-	0x26,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x49,0x00,0x6A,0x00,0x6B,0x08,0x6C,0x08,0x6E,0x08,0x70,0x08,0x91,0x08,0x92,0x08,0xD5,0x10,0xD6,0x10,0xD7,0x10,0xD9,0x08,0xD9,0x08,0xFB,0x18,0x1B,0x11,0x3C,0x19,0x3D,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x21,0x3E,0x19,0x3C,0x21,
-	0x5E,0x29,0x3E,0x21,0x3C,0x29,0x5C,0x29,0x5C,0x31,0x5C,0x31,0x9D,0x39,0x1E,0x4A,0x7E,0x52,0x7F,0x62,0x7F,0x62,0x7F,0x62,0x7F,0x6A,0x5F,0x5A,0x7F,0x6A,0x3F,0x5A,0x5E,0x62,0x3E,0x62,0x3E,0x5A,0x3E,0x5A,0x3E,0x62,0x3E,0x62,0x3C,0x6A,0x3D,0x72,0xBE,0x82,0x1F,0x93,0xBF,0xA3,0xBF,0xAB,0xDF,0xB3,0x3F,0xBC,0x1F,0xBC,0xDF,0xB3,
-	0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xBF,0xA3,0xBF,0x9B,0x9F,0x9B,0x9F,0x8B,0x5F,0x83,0x3F,0x8B,0x7F,0x83,0x3F,0x7B,0x1F,0x7B,0xBF,0x6A,0xBF,0x62,0x5F,0x5A,0x3E,0x52,0x3C,0x42,0x9A,0x31,0x36,0x19,0xB2,0x08,0xAF,0x08,0xB0,0x08,0xEE,0x08,0xCE,0x00,0xCD,0x00,0xCD,0x00,0xCE,0x08,0x31,0x09,0x33,0x01,
-	0x73,0x09,0x73,0x09,0x72,0x09,0x2F,0x09,0x10,0x09,0xD1,0x08,0xF2,0x08,0xD4,0x08,0x17,0x09,0x1A,0x11,0x3B,0x19,0x39,0x19,0x39,0x19,0x35,0x19,0xF0,0x08,0x6C,0x08,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x2B,0x00,0x6C,0x08,0x6F,0x08,0x72,0x10,0xB6,0x10,0xD9,0x10,0xFB,0x18,0x5C,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xBC,0xDF,0xB3,0xDF,0xB3,0x7F,0xA3,0x5F,0x9B,0xFF,0x92,0xBE,0x82,0x59,0x72,0xB3,0x41,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x41,0x2F,0x41,0x50,0x41,0x90,0x49,0x90,0x49,0x6E,0x49,0x0B,0x39,0xA9,0x20,0x46,0x08,0x26,0x08,0x46,0x08,0x46,0x08,0x47,0x08,
-	0x67,0x08,0x68,0x08,0x28,0x08,0x29,0x00,0x2A,0x00,0x4A,0x00,0x4C,0x00,0x6C,0x08,0x6E,0x08,0x6F,0x08,0x92,0x08,0x92,0x08,0xB5,0x10,0xB6,0x08,0xD7,0x18,0xD8,0x08,0xF9,0x10,0xDA,0x10,0xFB,0x18,0xFB,0x18,0x1B,0x11,0x1C,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x19,0x3E,0x21,0x3E,0x19,0x3E,0x19,0x3D,0x29,0x3D,0x29,
-	0x5C,0x29,0x5C,0x31,0x5D,0x31,0x7D,0x31,0x9D,0x41,0xDE,0x49,0x1E,0x5A,0x5F,0x62,0x7F,0x6A,0x9F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x62,0x3E,0x62,0x3E,0x5A,0x3E,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3D,0x62,0x3D,0x72,0x7D,0x7A,0xDE,0x8A,0x7F,0x9B,0xBF,0xAB,0xDF,0xB3,0x1F,0xBC,0xDF,0xC3,0xDF,0xC3,0x3F,0xC4,0x3F,0xBC,
-	0xDF,0xB3,0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0xBF,0xA3,0x9F,0x9B,0x9F,0x9B,0x5F,0x93,0x5F,0x93,0x3E,0x83,0x3E,0x83,0x3E,0x7B,0x3E,0x7B,0xFF,0x72,0xBF,0x6A,0x9F,0x62,0x5F,0x5A,0x3F,0x52,0x3D,0x42,0xBC,0x39,0x58,0x21,0x13,0x11,0xAF,0x08,0xCF,0x08,0xCE,0x00,0xCD,0x00,0x8B,0x00,0xAC,0x00,0xCE,0x00,0x30,0x09,0x51,0x09,
-	0x72,0x09,0x72,0x09,0x72,0x09,0x2F,0x09,0x0E,0x09,0x10,0x09,0xB1,0x08,0xD2,0x08,0xD5,0x08,0x16,0x09,0x39,0x11,0x38,0x11,0x18,0x19,0x14,0x11,0x90,0x10,0x6B,0x00,0x4A,0x00,0x49,0x00,0x4A,0x08,0x6B,0x08,0x6C,0x08,0x90,0x08,0x72,0x10,0xB6,0x10,0xF9,0x18,0x1B,0x21,0x5C,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0xBF,0xAB,0x7F,0xA3,0x5F,0x9B,0xFF,0x92,0xBC,0x82,0x19,0x6A,0x70,0x41,0xED,0x28,0xCC,0x28,0xEC,0x28,0xED,0x28,0x0E,0x41,0x2F,0x41,0x6E,0x49,0x8F,0x49,0x90,0x49,0x6E,0x49,0x0D,0x41,0xA9,0x20,0x66,0x10,0x26,0x08,0x26,0x08,0x67,0x08,0x68,0x08,
-	0x69,0x08,0x8A,0x08,0x6A,0x08,0x4A,0x08,0x4B,0x00,0x6B,0x08,0x6D,0x10,0x6E,0x08,0x6E,0x08,0x90,0x08,0x71,0x08,0x92,0x08,0xD5,0x10,0xD6,0x18,0xD7,0x18,0xD8,0x08,0xD7,0x10,0xF9,0x10,0xFB,0x18,0xFB,0x18,0xFB,0x10,0xFB,0x10,0x3C,0x21,0x1D,0x19,0x3C,0x21,0x3C,0x21,0x3D,0x29,0x3D,0x29,0x3E,0x21,0x3E,0x29,0x5C,0x31,0x5D,0x31,
-	0x7D,0x39,0xBE,0x41,0xDE,0x49,0x1E,0x52,0x3E,0x5A,0x5F,0x62,0x7F,0x6A,0x7F,0x6A,0x9F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x62,0x3E,0x62,0x3E,0x5A,0x3E,0x5A,0x3E,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x72,0x3D,0x72,0x7D,0x82,0xDF,0x92,0x9F,0xA3,0xDF,0xB3,0xDF,0xC3,0x1F,0xC4,0x1F,0xC4,0xDF,0xCB,0xDF,0xCB,0xDF,0xB3,0xDF,0xB3,
-	0xDF,0xB3,0xDF,0xAB,0xDF,0xAB,0xDF,0xAB,0x7F,0x9B,0x7F,0x9B,0x5F,0x93,0x3F,0x8B,0x3E,0x83,0x3E,0x83,0x3E,0x83,0x3E,0x7B,0x1F,0x7B,0xDF,0x7A,0xBF,0x6A,0xBF,0x6A,0x9F,0x62,0x5F,0x5A,0x3F,0x52,0x3F,0x42,0x1C,0x42,0x79,0x31,0x15,0x11,0xB1,0x08,0xCF,0x08,0xCD,0x00,0xAC,0x00,0x8B,0x00,0xAB,0x00,0xCE,0x00,0xEE,0x08,0x30,0x09,
-	0x51,0x09,0x72,0x09,0x30,0x09,0x2E,0x09,0x0E,0x09,0xCF,0x08,0xEF,0x08,0xD0,0x08,0xB2,0x08,0xB5,0x10,0x17,0x09,0x17,0x09,0xF5,0x18,0xD2,0x10,0x6D,0x08,0x4A,0x00,0x49,0x00,0x29,0x00,0x2A,0x00,0x4B,0x08,0x6C,0x08,0x6F,0x10,0xB3,0x10,0xB6,0x10,0xF9,0x18,0x1B,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDF,0xB3,0x9F,0xB3,0x5F,0xA3,0x3F,0x9B,0xDF,0x8A,0x9C,0x82,0xF6,0x69,0x30,0x39,0xED,0x28,0xEC,0x28,0xEC,0x28,0xED,0x38,0x0E,0x41,0x0E,0x41,0x2F,0x41,0x6F,0x49,0x6E,0x49,0x8F,0x59,0x0E,0x41,0xEA,0x30,0x68,0x18,0x26,0x08,0x46,0x08,0x68,0x10,0x68,0x10,
-	0xAB,0x10,0xAB,0x10,0xAD,0x18,0x8D,0x18,0x6D,0x18,0x6E,0x10,0x6F,0x10,0x6F,0x10,0x70,0x10,0x71,0x10,0x93,0x10,0xD4,0x10,0x95,0x10,0xD5,0x18,0xD7,0x18,0xD7,0x18,0xF8,0x18,0xF9,0x10,0xFB,0x18,0xFB,0x18,0xFB,0x18,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x29,0x5C,0x31,0x5C,0x31,0x7E,0x39,0x9D,0x41,0xFE,0x51,
-	0x1E,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x62,0x5E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xFD,0x69,0x3D,0x7A,0x5E,0x7A,0x9D,0x8A,0x1E,0x9B,0x7F,0xAB,0xDF,0xB3,0xDF,0xC3,0xFF,0xC3,0xDF,0xCB,0xDF,0xCB,0xDF,0xC3,0xDF,0xB3,0xBF,0xB3,0xBF,0xAB,
-	0xBF,0xA3,0xBF,0xA3,0x7F,0x9B,0x5F,0x9B,0x5F,0x93,0x3F,0x93,0x3E,0x83,0x1F,0x83,0x1E,0x7B,0xDF,0x7A,0xDF,0x72,0xDF,0x72,0xBF,0x72,0xBF,0x6A,0xBF,0x6A,0xBF,0x62,0x9F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0x1C,0x42,0x9A,0x31,0x75,0x19,0xD0,0x08,0xCE,0x00,0xCD,0x00,0xAC,0x00,0x6A,0x00,0x8B,0x00,0xCC,0x00,0x0D,0x01,0x2E,0x09,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0x0D,0x01,0xCD,0x00,0xCD,0x00,0xCD,0x00,0xCE,0x00,0xAF,0x08,0xB2,0x08,0xD4,0x10,0xD4,0x10,0xB2,0x08,0xAF,0x08,0x6B,0x08,0x2A,0x08,0x49,0x00,0x29,0x08,0x6A,0x08,0x6B,0x08,0x6E,0x08,0x91,0x08,0xB4,0x10,0xB6,0x18,0xFA,0x18,0x3B,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0xAB,0x5F,0xA3,0xFF,0x92,0xDD,0x8A,0x9C,0x82,0xB6,0x59,0x30,0x39,0xCB,0x28,0xCB,0x28,0xEC,0x28,0xEC,0x30,0xED,0x38,0x0E,0x41,0x0E,0x41,0x4E,0x49,0x6E,0x51,0x6E,0x49,0x4E,0x49,0xEA,0x30,0x68,0x18,0x26,0x08,0x26,0x08,0x68,0x08,0x69,0x08,
-	0x8B,0x10,0xAC,0x10,0xAD,0x18,0xAE,0x18,0xD0,0x18,0xD0,0x18,0xD1,0x18,0xF2,0x20,0xF3,0x20,0x14,0x29,0x16,0x19,0x16,0x19,0x16,0x19,0xF8,0x18,0xF8,0x18,0x19,0x21,0x19,0x21,0x19,0x21,0x3B,0x29,0x3C,0x29,0x5C,0x29,0x5C,0x31,0x5D,0x31,0x5C,0x39,0xBD,0x41,0xBD,0x41,0xBD,0x41,0xDD,0x49,0xDE,0x49,0x1E,0x52,0x5E,0x62,0x5F,0x62,
-	0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x72,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0xFD,0x61,0x3D,0x72,0x3D,0x7A,0x5D,0x82,0x9E,0x8A,0x5E,0xAB,0xBF,0xBB,0xDF,0xC3,0xFF,0xC3,0xDF,0xC3,0xFF,0xC3,0xDF,0xCB,0xDF,0xBB,0xBF,0xB3,0xBF,0xB3,0x7F,0xAB,0x7F,0xA3,
-	0x5F,0xA3,0x5F,0x9B,0x5F,0x9B,0x3F,0x8B,0x3F,0x8B,0xFF,0x8A,0xDE,0x7A,0xDF,0x7A,0xDF,0x7A,0xBF,0x6A,0xBE,0x6A,0xBE,0x6A,0xBF,0x6A,0xBF,0x6A,0x9F,0x5A,0x9F,0x5A,0x9F,0x5A,0x3F,0x5A,0x3F,0x42,0x3F,0x42,0xDD,0x39,0x9A,0x31,0x57,0x29,0xD1,0x10,0xCE,0x00,0xCD,0x00,0xAB,0x00,0x6A,0x00,0xAA,0x00,0xAB,0x00,0xCD,0x00,0x0D,0x01,
-	0x2E,0x09,0x2E,0x09,0x2E,0x09,0xCD,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0x8C,0x00,0x6D,0x08,0x90,0x08,0xB1,0x10,0xD1,0x10,0xB1,0x08,0x6D,0x08,0x4A,0x00,0x29,0x00,0x28,0x00,0x69,0x08,0x4A,0x08,0x6B,0x08,0x6F,0x08,0x70,0x08,0xB5,0x18,0xF8,0x18,0xFA,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xAB,0x5F,0xA3,0x1F,0x93,0xBD,0x8A,0x7A,0x72,0xB2,0x51,0xED,0x30,0xCC,0x28,0xCA,0x28,0xCA,0x28,0xED,0x28,0x0D,0x41,0x0E,0x41,0x2E,0x49,0x2E,0x41,0x4E,0x49,0x6E,0x51,0x2E,0x41,0xEA,0x30,0xA8,0x18,0x46,0x10,0x27,0x08,0x68,0x08,0x6A,0x10,
-	0x8B,0x10,0xAD,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0xF2,0x20,0x13,0x29,0x14,0x29,0x35,0x29,0x36,0x29,0x78,0x31,0x78,0x31,0x79,0x31,0x7A,0x39,0x7A,0x41,0x7B,0x41,0x7D,0x41,0x9D,0x41,0x9D,0x41,0x9D,0x41,0xDE,0x49,0xDE,0x49,0xFE,0x49,0x1E,0x4A,0x1E,0x5A,0x3E,0x5A,0x3F,0x5A,0x3F,0x5A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x6A,
-	0x7F,0x6A,0x7F,0x6A,0x5E,0x72,0x7F,0x6A,0x5E,0x6A,0x3E,0x62,0x5E,0x62,0x3E,0x62,0x3E,0x5A,0x3E,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x1D,0x6A,0x3D,0x72,0x3C,0x7A,0x5E,0x8A,0xFE,0x9A,0x5E,0xB3,0xDF,0xCB,0xDF,0xCB,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xBF,0xBB,0x7F,0xB3,0x9E,0xB3,0x5F,0xAB,0x5F,0xA3,0x5F,0x9B,
-	0x3F,0x93,0x3F,0x93,0xDF,0x8A,0xDF,0x82,0xBF,0x82,0xBF,0x7A,0xBF,0x72,0xBF,0x72,0x9F,0x6A,0x9D,0x6A,0x7F,0x62,0x7F,0x62,0x7F,0x5A,0x7F,0x5A,0x9F,0x5A,0x3F,0x5A,0x3F,0x52,0x3F,0x42,0x3F,0x4A,0x3F,0x42,0x1E,0x3A,0xBD,0x39,0x57,0x29,0x12,0x09,0xCE,0x00,0xAB,0x00,0x8A,0x00,0x88,0x00,0x69,0x00,0xAA,0x00,0xAB,0x00,0xAB,0x00,
-	0x0C,0x01,0x0C,0x01,0x0A,0x01,0xAA,0x00,0xAA,0x00,0xAA,0x00,0x8A,0x00,0x6A,0x00,0x6B,0x00,0x6D,0x00,0x90,0x08,0x90,0x08,0x8E,0x08,0x6B,0x08,0x28,0x00,0x28,0x00,0x48,0x08,0x69,0x08,0x6A,0x08,0x6C,0x10,0x6E,0x08,0x71,0x10,0xD5,0x18,0xD7,0x18,0xFB,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xA3,0xDE,0x92,0x7C,0x82,0x18,0x72,0x72,0x49,0xEC,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xEB,0x30,0xED,0x38,0x0E,0x41,0x0E,0x41,0x2E,0x41,0x4E,0x49,0x6E,0x51,0x6E,0x51,0x4C,0x31,0xC9,0x20,0x66,0x10,0x47,0x08,0x68,0x10,0x6A,0x08,
-	0x8B,0x10,0xAE,0x18,0xAF,0x18,0xF1,0x20,0xF1,0x20,0x13,0x29,0x14,0x29,0x35,0x31,0x35,0x31,0x78,0x31,0x79,0x39,0x7A,0x41,0x9C,0x39,0xBD,0x41,0xDD,0x49,0xDE,0x49,0xDD,0x49,0xFE,0x51,0x1E,0x52,0x1E,0x52,0x1E,0x52,0x3F,0x5A,0x3E,0x5A,0x3E,0x5A,0x5F,0x62,0x5F,0x62,0x5E,0x62,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x7F,0x6A,0x5E,0x6A,
-	0x5E,0x6A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x5A,0x3E,0x5A,0xFD,0x61,0x3E,0x62,0x3E,0x62,0x3E,0x72,0x3C,0x7A,0x5E,0x7A,0xBD,0x92,0x1E,0xAB,0xBE,0xC3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0xBF,0xB3,0x5F,0xB3,0x3E,0xA3,0x5F,0xA3,0x3F,0x9B,0xFF,0x92,
-	0xDF,0x8A,0xDF,0x8A,0xBE,0x7A,0x7E,0x7A,0x7E,0x72,0x7F,0x6A,0x7F,0x6A,0x5E,0x62,0x5F,0x62,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x5A,0x3F,0x52,0x3F,0x52,0x3F,0x42,0x3F,0x42,0x3F,0x42,0xFF,0x31,0xBD,0x39,0xFC,0x41,0x77,0x29,0x34,0x11,0xAE,0x08,0xAB,0x00,0xA9,0x00,0x68,0x00,0x88,0x00,0xA9,0x00,0xAA,0x00,0xAA,0x00,
-	0xEA,0x00,0xCA,0x00,0x0A,0x01,0xCA,0x00,0xAA,0x00,0xAA,0x00,0x8A,0x00,0x6A,0x00,0x6A,0x00,0x6B,0x00,0x8D,0x00,0x6C,0x08,0x6C,0x08,0x69,0x08,0x27,0x00,0x27,0x00,0x68,0x08,0x69,0x08,0x6B,0x08,0x6D,0x08,0x6F,0x10,0x71,0x10,0xD5,0x18,0xF8,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xA2,0xDE,0x92,0x7B,0x82,0xF7,0x69,0x2F,0x41,0xCC,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xEC,0x28,0x0B,0x31,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x4E,0x49,0x6E,0x51,0x6E,0x51,0x0D,0x39,0xCA,0x28,0x47,0x10,0x47,0x10,0x68,0x10,0x6A,0x08,
-	0x8B,0x10,0xAD,0x20,0xAF,0x18,0xD0,0x18,0xF1,0x20,0x13,0x29,0x14,0x21,0x35,0x31,0x35,0x31,0x78,0x31,0x78,0x31,0x7A,0x41,0x7B,0x41,0xBD,0x41,0xDD,0x49,0xDD,0x49,0xDE,0x49,0xFE,0x51,0xFE,0x51,0xFE,0x51,0x1E,0x52,0x1E,0x52,0x3F,0x5A,0x3E,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x3E,0x62,0x1E,0x62,0x1E,0x62,0x1D,0x62,0x3E,0x62,0x3D,0x7A,0x3D,0x7A,0x7E,0x82,0xDE,0x92,0x7F,0xB3,0xBF,0xC3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xBF,0xC3,0x7F,0xB3,0x5F,0xAB,0x5F,0xA3,0x3F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,
-	0xDF,0x82,0xBE,0x7A,0x5E,0x72,0x7E,0x6A,0x5E,0x6A,0x3E,0x62,0x3E,0x5A,0x1E,0x52,0x1E,0x52,0x1E,0x52,0xFE,0x49,0xFE,0x49,0x1E,0x42,0x1F,0x42,0x1F,0x42,0x1E,0x42,0x1E,0x42,0x1E,0x42,0x1E,0x42,0x1F,0x3A,0xFE,0x39,0xFD,0x29,0x57,0x29,0x34,0x19,0xAF,0x08,0xAB,0x00,0x89,0x00,0x68,0x00,0x68,0x00,0xA9,0x00,0xAA,0x00,0xAA,0x00,
-	0xAA,0x00,0xCA,0x00,0xCA,0x00,0xA9,0x00,0x89,0x00,0x69,0x00,0x6A,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x6C,0x08,0x6B,0x08,0x6A,0x08,0x29,0x08,0x27,0x00,0x47,0x08,0x69,0x08,0x4A,0x08,0x6B,0x08,0x6D,0x08,0x70,0x10,0xB2,0x10,0x95,0x10,0xF8,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBD,0x8A,0x5A,0x72,0xD4,0x61,0x0E,0x31,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xEA,0x30,0xEB,0x30,0x0D,0x39,0x0D,0x39,0x0E,0x41,0x4E,0x49,0x6E,0x51,0x6E,0x51,0x4D,0x41,0xCA,0x28,0x69,0x10,0x68,0x18,0x69,0x08,0x6B,0x10,
-	0x6B,0x08,0x8D,0x18,0xAF,0x18,0xD0,0x18,0xF1,0x20,0x13,0x29,0x13,0x29,0x35,0x31,0x35,0x31,0x77,0x39,0x78,0x31,0x7A,0x41,0x7B,0x41,0x7D,0x41,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDE,0x49,0xDE,0x49,0xDC,0x51,0xFD,0x51,0xFD,0x51,0x1D,0x52,0x1E,0x5A,0x1E,0x52,0x1E,0x52,0x3E,0x5A,0x3E,0x5A,0x3E,0x5A,0x3E,0x62,0x3E,0x62,0x3E,0x62,
-	0x3E,0x62,0x3E,0x62,0x1E,0x5A,0x1E,0x5A,0x1E,0x52,0x3E,0x62,0x3E,0x62,0xFD,0x61,0x3E,0x62,0x3E,0x72,0x3D,0x72,0x5E,0x7A,0x7D,0x82,0xBD,0x9A,0xDE,0xA2,0x9F,0xBB,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xCB,0x7F,0xBB,0x5F,0xB3,0x5F,0xB3,0x5F,0xA3,0xFF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x7E,0x7A,
-	0x7E,0x7A,0x5E,0x6A,0x3D,0x62,0x3D,0x62,0x1C,0x5A,0xDC,0x59,0xFD,0x51,0xFD,0x51,0x1C,0x4A,0x1C,0x4A,0xDD,0x41,0xDE,0x41,0xDD,0x49,0xDE,0x41,0xDE,0x41,0xBD,0x39,0xBD,0x39,0xDE,0x31,0xBD,0x39,0xBD,0x31,0xBD,0x31,0xBD,0x31,0x77,0x29,0x54,0x11,0xEF,0x08,0xAB,0x00,0x69,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x8B,0x00,0xAB,0x00,
-	0xAA,0x00,0xCA,0x00,0xA9,0x00,0x68,0x00,0x69,0x00,0x69,0x00,0x6A,0x00,0x69,0x00,0x29,0x00,0x4A,0x00,0x6B,0x08,0x6A,0x08,0x69,0x00,0x28,0x00,0x27,0x08,0x48,0x08,0x69,0x08,0x6A,0x08,0x4B,0x08,0x6E,0x08,0x90,0x08,0xB3,0x10,0x95,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF6,0x69,0x72,0x51,0xEC,0x30,0xC9,0x20,0xA8,0x18,0xA9,0x20,0xCA,0x28,0xCA,0x28,0xEC,0x28,0x0B,0x39,0x0D,0x41,0x0E,0x41,0x2E,0x41,0x6E,0x51,0x6E,0x51,0x4E,0x39,0xCB,0x28,0xA9,0x20,0x68,0x10,0x69,0x10,0x6B,0x10,
-	0x6B,0x10,0x6D,0x18,0xAF,0x18,0xF0,0x20,0xF1,0x20,0xF2,0x20,0x13,0x29,0x14,0x29,0x35,0x31,0x57,0x31,0x77,0x39,0x79,0x39,0x7A,0x41,0x7B,0x41,0x7C,0x41,0x9D,0x41,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDC,0x51,0xDC,0x49,0xDD,0x51,0xFE,0x51,0x1D,0x52,0xFD,0x51,0x1D,0x5A,0xFE,0x51,0xFE,0x51,0x1E,0x5A,0xFE,0x51,0x1D,0x5A,0x1D,0x5A,
-	0xFE,0x51,0xFE,0x51,0x1E,0x5A,0x3E,0x62,0x3E,0x62,0x1D,0x62,0x1E,0x62,0x3E,0x72,0xFD,0x69,0x1C,0x7A,0x5D,0x82,0x9D,0x8A,0xDE,0x9A,0x5E,0xB3,0xDF,0xCB,0xFF,0xD3,0xFF,0xD3,0x1F,0xDC,0xFF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xBF,0xBB,0xBF,0xB3,0x5F,0xAB,0x5F,0xA3,0x3F,0x9B,0xDF,0x92,0xDF,0x8A,0xBE,0x82,0x5E,0x7A,0x3D,0x72,
-	0x3D,0x72,0x3C,0x62,0x1D,0x5A,0x1C,0x5A,0xFC,0x51,0xDC,0x49,0xBC,0x49,0xBC,0x41,0xBC,0x41,0xBC,0x41,0xBC,0x41,0x9C,0x39,0xBD,0x41,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBD,0x39,0xBE,0x31,0xBE,0x31,0xBD,0x31,0x9C,0x29,0x77,0x29,0x34,0x19,0xD0,0x10,0xAB,0x00,0x6A,0x00,0x69,0x00,0x6A,0x00,0xAB,0x00,0xAD,0x00,0xCD,0x00,
-	0xAD,0x00,0xAB,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x2A,0x00,0x4B,0x00,0x6B,0x00,0x6A,0x08,0x49,0x00,0x28,0x00,0x27,0x00,0x28,0x08,0x49,0x08,0x6A,0x08,0x4C,0x08,0x6E,0x08,0x70,0x10,0xB4,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0x61,0x0E,0x39,0xCA,0x28,0x68,0x18,0x88,0x18,0xA8,0x18,0xA9,0x20,0xCA,0x28,0xEA,0x28,0x0B,0x39,0x0D,0x41,0x6E,0x39,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x4E,0x49,0xEC,0x30,0xCB,0x20,0x69,0x18,0x6B,0x10,0x8C,0x10,
-	0x6D,0x18,0xAE,0x18,0xAF,0x18,0xF0,0x20,0xF2,0x20,0xF2,0x20,0x13,0x29,0x14,0x29,0x35,0x31,0x35,0x31,0x56,0x31,0x78,0x31,0x78,0x41,0x7A,0x41,0x9A,0x49,0x9B,0x49,0x9D,0x41,0xDD,0x49,0xDD,0x49,0xDD,0x49,0xDD,0x51,0xDC,0x51,0xFD,0x51,0xFD,0x51,0xFD,0x51,0xFD,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xFE,0x51,0xDD,0x51,0x1D,0x5A,
-	0xFE,0x51,0x3E,0x5A,0x1E,0x5A,0x3E,0x62,0xFD,0x61,0x3D,0x6A,0x3E,0x72,0x3E,0x72,0x5D,0x7A,0x7C,0x8A,0xDD,0x92,0x1E,0xAB,0xBE,0xC3,0xDF,0xCB,0xFF,0xD3,0x1F,0xDC,0x1F,0xDC,0xDF,0xD3,0xFF,0xD3,0xDF,0xCB,0xDF,0xCB,0xDF,0xBB,0x5F,0xB3,0x5F,0xA3,0x5F,0xA3,0xFF,0x92,0xDF,0x92,0xDF,0x8A,0xBE,0x82,0x5E,0x7A,0x3D,0x72,0x3C,0x6A,
-	0x1C,0x62,0xDC,0x59,0xBB,0x51,0x9A,0x49,0x9A,0x49,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x7A,0x41,0x79,0x31,0x7A,0x39,0x7A,0x39,0x7B,0x39,0x9C,0x31,0x7C,0x31,0x7C,0x31,0x9C,0x29,0x9C,0x29,0x7B,0x39,0x79,0x29,0x97,0x19,0x34,0x19,0xD0,0x10,0xAB,0x00,0x6B,0x00,0x6A,0x00,0xAD,0x00,0xCE,0x00,0xD0,0x10,0x10,0x09,
-	0xF0,0x08,0xAE,0x00,0xAC,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x08,0x6B,0x00,0x6C,0x00,0x4D,0x00,0x8E,0x08,0xAD,0x00,0x6B,0x08,0x49,0x00,0x28,0x00,0x27,0x08,0x28,0x08,0x29,0x00,0x4A,0x08,0x4C,0x08,0x6F,0x10,0x71,0x10,0x74,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x30,0x88,0x18,0x67,0x10,0x66,0x10,0xA6,0x20,0xA9,0x20,0xCA,0x28,0xEA,0x30,0x0A,0x31,0x0C,0x39,0x0E,0x41,0x4E,0x49,0x6E,0x51,0x6E,0x51,0x4E,0x49,0x0E,0x41,0xEC,0x28,0x8B,0x18,0x8B,0x20,0x8D,0x18,
-	0x8D,0x18,0xCE,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x29,0x13,0x29,0x14,0x29,0x35,0x31,0x35,0x31,0x56,0x39,0x56,0x39,0x77,0x31,0x79,0x41,0x7A,0x41,0x9A,0x49,0xBB,0x49,0xBB,0x49,0xDC,0x49,0xDC,0x51,0xDC,0x49,0xDC,0x51,0xDC,0x59,0xDD,0x51,0xDC,0x59,0xDD,0x51,0xDD,0x59,0xFE,0x51,0x1D,0x5A,0x1E,0x5A,0x1D,0x62,0xFD,0x59,
-	0x1D,0x62,0x1D,0x62,0xFD,0x61,0xFD,0x69,0x5D,0x7A,0x5D,0x7A,0x5E,0x7A,0x7D,0x82,0x9C,0x9A,0x1E,0xAB,0x9F,0xBB,0xDF,0xCB,0xFF,0xD3,0xDF,0xE3,0x1F,0xDC,0xFF,0xDB,0xDF,0xDB,0xDF,0xD3,0xDF,0xCB,0xDF,0xCB,0x7F,0xC3,0x5F,0xB3,0x5F,0xAB,0x3E,0xA3,0x1E,0x9B,0xDF,0x92,0xDF,0x8A,0x7E,0x82,0x5E,0x7A,0x7C,0x72,0x3C,0x6A,0xDC,0x59,
-	0xDB,0x51,0x99,0x49,0x99,0x49,0x79,0x41,0x78,0x39,0x77,0x31,0x56,0x39,0x57,0x31,0x57,0x31,0x57,0x31,0x77,0x31,0x77,0x31,0x57,0x29,0x38,0x21,0x78,0x31,0x5A,0x29,0x58,0x31,0x59,0x31,0x5A,0x31,0x5A,0x29,0x58,0x29,0x58,0x29,0x77,0x29,0x34,0x19,0xD0,0x10,0x8C,0x00,0x6B,0x00,0xAC,0x00,0xCF,0x08,0xB1,0x08,0x52,0x09,0x13,0x09,
-	0x32,0x09,0xF1,0x08,0xAF,0x08,0x6C,0x08,0x6C,0x08,0x6E,0x08,0x70,0x08,0xB2,0x08,0xB4,0x08,0xD4,0x10,0xD1,0x18,0x8D,0x08,0x4B,0x00,0x29,0x00,0x28,0x08,0x69,0x08,0x4A,0x08,0x4B,0x08,0x6D,0x10,0x6F,0x10,0xB3,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0x87,0x18,0xA6,0x20,0xC7,0x28,0xCA,0x28,0xEA,0x28,0x0B,0x39,0x0C,0x39,0x0E,0x39,0x2E,0x41,0x8F,0x49,0x6E,0x49,0x4E,0x49,0xED,0x38,0xCC,0x28,0x6D,0x18,0x6D,0x18,
-	0xAD,0x20,0xD0,0x18,0x11,0x29,0xF1,0x20,0x13,0x29,0x13,0x29,0x13,0x29,0x14,0x29,0x35,0x31,0x35,0x31,0x56,0x39,0x56,0x39,0x77,0x41,0x77,0x41,0x7A,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9A,0x49,0x9B,0x49,0xDC,0x51,0xDC,0x51,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x59,0xDD,0x59,0xDD,0x59,0xFD,0x59,0x1D,0x62,0x1D,0x62,
-	0xDD,0x61,0x1D,0x72,0xFD,0x69,0x1C,0x7A,0x5D,0x7A,0x5D,0x82,0x5C,0x9A,0x1E,0xA3,0x9E,0xC3,0xDF,0xCB,0xFF,0xD3,0x3F,0xDC,0xDF,0xE3,0xDF,0xE3,0xFF,0xE3,0xBF,0xDB,0xDF,0xDB,0xBF,0xCB,0x9F,0xCB,0x7F,0xBB,0x5F,0xB3,0x5F,0xA3,0x1E,0x9B,0xDE,0x92,0xDF,0x8A,0xDF,0x8A,0xBE,0x7A,0x5E,0x7A,0x5D,0x72,0x3C,0x6A,0x1C,0x62,0xDA,0x59,
-	0x99,0x49,0x99,0x49,0x77,0x41,0x77,0x31,0x56,0x39,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x31,0x35,0x29,0x35,0x31,0x57,0x29,0x57,0x29,0x58,0x29,0x59,0x29,0x58,0x29,0x18,0x21,0x58,0x29,0x58,0x29,0x76,0x19,0x34,0x19,0xD0,0x10,0xCD,0x00,0x6C,0x00,0x6D,0x00,0xB1,0x08,0xF3,0x00,0x35,0x09,0x36,0x11,
-	0x15,0x09,0xB3,0x08,0xB2,0x08,0x70,0x08,0x70,0x08,0x93,0x08,0xD6,0x10,0xF8,0x18,0xF8,0x18,0x18,0x19,0x15,0x19,0xB1,0x18,0x6D,0x08,0x4B,0x00,0x29,0x08,0x2A,0x08,0x6B,0x08,0x6D,0x08,0x6F,0x08,0x71,0x10,0xB3,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x08,0x44,0x08,0x65,0x08,0x86,0x10,0xA6,0x20,0xC9,0x28,0xC9,0x28,0x0A,0x29,0x0B,0x31,0x0C,0x41,0x0D,0x41,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x6E,0x49,0x4F,0x41,0xED,0x30,0x8D,0x18,0x8D,0x18,
-	0xEE,0x20,0x11,0x29,0x11,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x13,0x29,0x54,0x39,0x35,0x31,0x56,0x39,0x55,0x31,0x77,0x41,0x77,0x31,0x78,0x41,0x78,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xBB,0x51,0xBB,0x51,0xDB,0x51,0xDB,0x51,0xDC,0x59,0xDC,0x59,0xDC,0x59,0xDD,0x59,0xDD,0x61,0xDD,0x61,0x1D,0x62,0x1D,0x62,0xFD,0x69,0xFD,0x69,
-	0x3C,0x7A,0x3C,0x7A,0x3C,0x82,0x5D,0x8A,0x7D,0x92,0xDD,0xAA,0x7F,0xBB,0xDF,0xCB,0xDF,0xD3,0x1F,0xDC,0xFF,0xE3,0xDF,0xE3,0xDF,0xE3,0xDF,0xDB,0xFF,0xDB,0xDF,0xD3,0xDF,0xCB,0xBF,0xCB,0x9F,0xBB,0x5F,0xB3,0x5F,0xAB,0x3F,0x9B,0xDF,0x92,0xBD,0x8A,0x9E,0x82,0x5D,0x7A,0x1C,0x72,0x3C,0x6A,0xFC,0x61,0xDC,0x59,0xB9,0x51,0x9A,0x49,
-	0x99,0x49,0x77,0x41,0x76,0x39,0x35,0x31,0x35,0x31,0x14,0x29,0x14,0x29,0x14,0x29,0x13,0x29,0x13,0x19,0x13,0x21,0x13,0x21,0x13,0x19,0x13,0x19,0x15,0x21,0x36,0x21,0x56,0x21,0x57,0x21,0x38,0x19,0x38,0x19,0x58,0x21,0x37,0x19,0x35,0x21,0x34,0x19,0xD0,0x10,0xAD,0x00,0x6E,0x08,0x6E,0x08,0xB3,0x08,0xB5,0x10,0xF7,0x18,0x37,0x09,
-	0xF7,0x10,0xD5,0x08,0xB3,0x08,0x73,0x00,0x93,0x08,0xD7,0x10,0x19,0x19,0x3B,0x19,0x3C,0x21,0x1A,0x19,0x18,0x19,0xD4,0x10,0x8F,0x08,0x6C,0x08,0x2A,0x08,0x6B,0x08,0x6C,0x08,0x6E,0x10,0x70,0x10,0xB2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x08,0x23,0x08,0x24,0x08,0x44,0x08,0x65,0x10,0xA6,0x18,0xA7,0x20,0xCA,0x28,0x0A,0x29,0x0B,0x39,0x0B,0x39,0x0E,0x41,0x6E,0x51,0x6E,0x51,0x90,0x49,0x90,0x49,0x50,0x41,0x0E,0x31,0x10,0x29,
-	0x11,0x29,0x12,0x29,0x13,0x29,0x33,0x31,0x34,0x31,0x34,0x31,0x54,0x39,0x56,0x39,0x56,0x39,0x56,0x39,0x77,0x41,0x77,0x41,0x77,0x41,0x79,0x41,0x9A,0x49,0x9A,0x49,0x9A,0x49,0xBB,0x51,0x9A,0x49,0xBB,0x51,0xDB,0x51,0xDC,0x61,0xDC,0x61,0xDD,0x61,0xDD,0x61,0xDD,0x61,0xDD,0x69,0x3D,0x72,0x3D,0x72,0x3D,0x7A,0x3C,0x7A,0x5E,0x82,
-	0x5D,0x82,0x5C,0x9A,0xBD,0xA2,0xFE,0xBA,0x3E,0xC3,0xBE,0xCB,0xDF,0xDB,0x3F,0xDC,0xFF,0xE3,0xDF,0xEB,0xDF,0xE3,0xDF,0xEB,0xFF,0xE3,0xBF,0xDB,0xDF,0xD3,0xDF,0xCB,0xDF,0xCB,0x7F,0xBB,0x5F,0xAB,0x5F,0xA3,0x3F,0x9B,0xDF,0x92,0xBE,0x8A,0x7E,0x82,0x7C,0x7A,0x3D,0x7A,0x3C,0x6A,0xFC,0x69,0xDB,0x59,0xDB,0x59,0x99,0x49,0x99,0x49,
-	0x77,0x41,0x77,0x41,0x35,0x31,0x35,0x31,0x35,0x31,0x13,0x29,0x13,0x29,0x13,0x29,0xF2,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x13,0x21,0x34,0x19,0x34,0x21,0x35,0x21,0x36,0x19,0x36,0x19,0x35,0x21,0x37,0x19,0x35,0x21,0x34,0x19,0xB0,0x08,0xAF,0x08,0x6E,0x08,0x71,0x08,0xB5,0x08,0xD6,0x10,0xF9,0x08,0xF9,0x08,
-	0xF8,0x08,0xD7,0x08,0xB6,0x08,0xB6,0x00,0xD8,0x08,0x3B,0x21,0x5D,0x19,0x5D,0x19,0x3D,0x19,0x3B,0x19,0x18,0x19,0xD5,0x10,0xB0,0x08,0x6E,0x08,0x6D,0x08,0x6D,0x08,0x6E,0x08,0x90,0x10,0x72,0x10,0xD6,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x44,0x08,0x65,0x10,0x86,0x18,0xA8,0x20,0xCA,0x28,0x0B,0x31,0x4B,0x41,0x6D,0x49,0x8F,0x59,0x90,0x59,0x90,0x51,0xB1,0x51,0x52,0x41,0x52,0x41,
-	0x51,0x41,0x51,0x41,0x33,0x31,0x54,0x39,0x74,0x41,0x76,0x41,0x76,0x41,0x76,0x41,0x77,0x41,0x77,0x41,0x77,0x41,0x99,0x49,0x99,0x49,0x99,0x49,0xB9,0x51,0xBA,0x51,0xDC,0x59,0xDB,0x59,0xDC,0x59,0xDA,0x61,0xDD,0x69,0xDC,0x69,0xDD,0x69,0xDC,0x69,0xDC,0x69,0xFC,0x71,0x3D,0x7A,0x3D,0x7A,0x5D,0x82,0x5D,0x8A,0x5D,0x8A,0x7C,0xA2,
-	0x9D,0xAA,0x5E,0xBB,0x7F,0xCB,0xBF,0xDB,0xFF,0xDB,0x1F,0xE4,0x1F,0xE4,0xDF,0xEB,0xDF,0xE3,0xDF,0xE3,0xDF,0xE3,0xDF,0xE3,0xDF,0xDB,0xFF,0xD3,0x9F,0xD3,0xBF,0xC3,0x5F,0xB3,0x5F,0xAB,0x3F,0x9B,0x3F,0x9B,0xDF,0x92,0xDF,0x8A,0xBF,0x82,0x5E,0x82,0x3D,0x7A,0x1C,0x72,0x1C,0x6A,0x1B,0x62,0xFB,0x59,0xD9,0x59,0x9A,0x49,0x9A,0x49,
-	0x77,0x41,0x77,0x41,0x56,0x39,0x35,0x31,0x34,0x31,0x13,0x29,0x12,0x29,0x12,0x29,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xD1,0x18,0xD1,0x18,0xD1,0x18,0xF1,0x18,0xF2,0x20,0x14,0x11,0x14,0x19,0x14,0x19,0x36,0x19,0x36,0x19,0x36,0x19,0x35,0x19,0x34,0x19,0xB2,0x08,0xAF,0x08,0x71,0x08,0x93,0x08,0xD6,0x08,0xD8,0x08,0x1A,0x11,0x3B,0x11,
-	0xD9,0x08,0xD9,0x08,0xD8,0x08,0xD9,0x08,0x3B,0x11,0x5D,0x11,0x7E,0x19,0x7E,0x19,0x5D,0x19,0x3B,0x19,0x18,0x11,0xD5,0x08,0xB2,0x08,0x70,0x08,0x6E,0x08,0x6E,0x08,0x71,0x10,0xB3,0x10,0xD5,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x08,0x44,0x08,0x65,0x10,0x87,0x18,0xC9,0x28,0xEA,0x30,0x0D,0x41,0x6E,0x51,0x90,0x51,0xD2,0x61,0xF4,0x69,0xD5,0x61,0x95,0x59,
-	0x74,0x51,0xB7,0x51,0x74,0x51,0xB7,0x59,0x95,0x59,0xB8,0x59,0xB8,0x59,0xB8,0x59,0xB8,0x59,0xB8,0x59,0xB9,0x59,0xB9,0x59,0xDB,0x61,0xDB,0x61,0xDC,0x61,0xDC,0x61,0xDD,0x69,0xFB,0x71,0xFC,0x71,0xFC,0x71,0xFC,0x71,0x1C,0x72,0x1C,0x72,0x3D,0x7A,0x3D,0x82,0x3C,0x8A,0x5C,0x9A,0x5C,0x9A,0xBD,0xA2,0xBD,0xAA,0x1E,0xC3,0x7E,0xCB,
-	0x9F,0xDB,0xBF,0xE3,0xBF,0xE3,0xDF,0xEB,0x1F,0xF4,0x1F,0xF4,0xFF,0xEB,0xFF,0xEB,0xFF,0xE3,0xFF,0xE3,0xDF,0xE3,0xBF,0xDB,0xBF,0xD3,0x9F,0xCB,0x9F,0xC3,0x5F,0xB3,0x5F,0xAB,0x5F,0xA3,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xDF,0x8A,0x5E,0x82,0x5E,0x7A,0x1C,0x72,0xFC,0x69,0xD9,0x61,0xDB,0x59,0xB9,0x59,0xB9,0x51,0x9A,0x49,0x78,0x41,
-	0x78,0x41,0x77,0x41,0x56,0x39,0x35,0x31,0x34,0x31,0x14,0x29,0x12,0x29,0x12,0x29,0xF2,0x20,0xD1,0x18,0xD1,0x18,0xAF,0x18,0xAF,0x18,0xB0,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x13,0x19,0x14,0x19,0x35,0x19,0x34,0x19,0x35,0x19,0x34,0x19,0x34,0x19,0xB2,0x08,0x90,0x08,0x91,0x08,0xB4,0x08,0xD7,0x08,0xFA,0x10,0x1B,0x11,0xFB,0x10,
-	0x1B,0x09,0x39,0x09,0x1A,0x09,0x1B,0x11,0x5D,0x11,0x7D,0x19,0x5E,0x19,0x5E,0x19,0x3C,0x11,0x3B,0x11,0xD8,0x08,0xD5,0x10,0xD4,0x08,0x72,0x08,0x70,0x08,0x91,0x10,0xD4,0x18,0x16,0x19,0xF8,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x46,0x08,0xA9,0x20,0xEA,0x30,0x0D,0x39,0x6F,0x59,0xB1,0x51,0xF5,0x69,0x17,0x82,0x39,0x82,
-	0x5A,0x82,0x18,0x82,0x1B,0x82,0xF9,0x71,0x18,0x82,0x18,0x7A,0xF9,0x69,0xF9,0x69,0xF9,0x71,0xF9,0x71,0x1B,0x7A,0x1B,0x7A,0x1C,0x7A,0x1C,0x7A,0x1C,0x7A,0x3B,0x82,0x3B,0x82,0x3B,0x82,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x5C,0x92,0x7C,0xA2,0x9C,0xAA,0xDD,0xAA,0x1E,0xB3,0x5E,0xCB,0x7E,0xD3,0xBE,0xDB,0xDF,0xE3,0xDF,0xEB,
-	0xFF,0xEB,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0xFF,0xEB,0xDF,0xEB,0x1F,0xF4,0xFF,0xE3,0xDF,0xE3,0xDF,0xE3,0xDF,0xD3,0xBF,0xD3,0x7F,0xCB,0x5F,0xC3,0x5F,0xAB,0x5F,0xAB,0x3F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xBE,0x82,0x5E,0x7A,0x3D,0x7A,0x1C,0x6A,0xFC,0x71,0xFC,0x69,0xDC,0x69,0xDA,0x61,0xDA,0x59,0xBA,0x51,0x99,0x49,0x9A,0x49,
-	0x9A,0x49,0x78,0x41,0x77,0x41,0x77,0x41,0x56,0x39,0x35,0x31,0x14,0x29,0x13,0x29,0xF3,0x20,0xD1,0x18,0xD1,0x18,0xD0,0x18,0x8F,0x10,0x8F,0x10,0xAF,0x18,0xD0,0x18,0xD1,0x10,0xD2,0x10,0x13,0x11,0x14,0x19,0xF4,0x18,0x34,0x19,0x35,0x19,0x14,0x19,0xB2,0x08,0x91,0x08,0xB3,0x08,0xD6,0x08,0xD8,0x10,0xFB,0x08,0xFC,0x10,0xFC,0x08,
-	0xFC,0x10,0xFC,0x10,0x3C,0x11,0x5D,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5D,0x11,0x3B,0x11,0xF9,0x10,0xD7,0x08,0xB5,0x10,0xB4,0x10,0xD5,0x18,0xD6,0x18,0x17,0x19,0x38,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x08,0x25,0x08,0x66,0x10,0x68,0x18,0xCA,0x28,0x0D,0x41,0xB1,0x51,0xF6,0x71,0x59,0x8A,0x9B,0x92,
-	0xDD,0xA2,0xFE,0xA2,0xFE,0xAA,0xFD,0xB2,0xBD,0xB2,0xBD,0xAA,0xBC,0xAA,0xBC,0xAA,0xBC,0xAA,0x5C,0xA2,0x9C,0xAA,0x5C,0x9A,0x9C,0xAA,0x9C,0xAA,0x5C,0xA2,0x5C,0xA2,0xBC,0xAA,0xBC,0xAA,0xBC,0xB2,0xBC,0xB2,0xBC,0xB2,0xFD,0xC2,0x3D,0xCB,0x3D,0xCB,0x7E,0xD3,0x9F,0xDB,0xBE,0xE3,0xBE,0xE3,0xDF,0xEB,0x1F,0xF4,0x3F,0xF4,0x3F,0xF4,
-	0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0xFF,0xE3,0xDF,0xE3,0xDF,0xDB,0xDF,0xD3,0xFF,0xD3,0x7F,0xCB,0x7F,0xCB,0x5F,0xC3,0x5F,0xB3,0x1E,0xA3,0xFE,0xA2,0xDF,0x92,0xDF,0x92,0xBE,0x8A,0x7E,0x82,0x5E,0x7A,0x5E,0x7A,0x3D,0x72,0xDC,0x69,0xFC,0x69,0xDC,0x69,0xDA,0x61,0xDA,0x61,0xDB,0x59,0xDA,0x61,0xDB,0x59,0xBB,0x51,
-	0x9A,0x49,0x9A,0x49,0x9A,0x49,0x79,0x41,0x78,0x41,0x77,0x31,0x56,0x39,0x14,0x29,0x14,0x29,0xF2,0x20,0xD1,0x18,0x90,0x10,0x8F,0x10,0x6F,0x10,0x8F,0x10,0xAF,0x18,0xAF,0x18,0xD1,0x18,0xD1,0x18,0xD3,0x10,0x34,0x19,0x34,0x19,0x35,0x19,0x14,0x19,0xB2,0x08,0x92,0x08,0xB4,0x08,0xD6,0x08,0xD9,0x08,0xFC,0x10,0xFC,0x10,0xFC,0x08,
-	0x3C,0x11,0x5D,0x11,0x5D,0x11,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x19,0x3D,0x11,0x1B,0x11,0xDA,0x08,0xD8,0x08,0xB7,0x10,0xF8,0x10,0x19,0x21,0x59,0x29,0x3A,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x08,0x25,0x08,0x46,0x08,0x67,0x10,0x68,0x18,0xCC,0x28,0x6F,0x51,0xD4,0x69,0x38,0x82,0xBB,0xAA,
-	0x3E,0xBB,0x3E,0xC3,0x7F,0xCB,0x5F,0xCB,0xBE,0xD3,0x7E,0xDB,0xBE,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x9E,0xDB,0x9E,0xDB,0x9E,0xE3,0x9E,0xE3,0x9E,0xE3,0xBE,0xE3,0xBE,0xE3,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,
-	0x1F,0xF4,0xFF,0xEB,0x1F,0xF4,0xDF,0xEB,0xFF,0xE3,0xDF,0xE3,0xDF,0xD3,0xBF,0xD3,0x7E,0xD3,0x5F,0xCB,0x5F,0xC3,0x5F,0xB3,0x3F,0xAB,0x1E,0x9B,0xFE,0x9A,0xDF,0x8A,0x9E,0x8A,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x5E,0x7A,0x3C,0x7A,0xFC,0x71,0x1C,0x6A,0xDD,0x69,0xDA,0x61,0xDC,0x61,0xDC,0x61,0xDD,0x69,0xDC,0x59,0xDC,0x61,0xDC,0x59,
-	0xDC,0x59,0xDC,0x59,0xDC,0x59,0xBB,0x51,0x9A,0x51,0xBA,0x51,0x9A,0x49,0x98,0x41,0x36,0x31,0x14,0x29,0xF3,0x20,0xB1,0x18,0x70,0x10,0x8F,0x10,0x6F,0x10,0xAF,0x10,0xAF,0x10,0xD0,0x10,0xB1,0x10,0xD2,0x10,0x13,0x11,0x14,0x19,0x14,0x19,0xD4,0x10,0x93,0x08,0x93,0x08,0x95,0x00,0xD8,0x08,0xDA,0x08,0x1C,0x09,0xFC,0x10,0x1D,0x11,
-	0x3E,0x11,0x7E,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x9E,0x21,0x7E,0x19,0x5E,0x19,0x1D,0x11,0xFC,0x10,0xDB,0x08,0xD9,0x08,0xD9,0x08,0xFB,0x18,0x5C,0x29,0x5C,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x08,0x46,0x08,0x66,0x10,0x68,0x18,0xCA,0x28,0x0D,0x31,0xB1,0x61,0x17,0x82,0xBA,0xAA,
-	0xFD,0xBA,0x5F,0xCB,0x9E,0xD3,0xBF,0xDB,0xBF,0xE3,0xBF,0xE3,0xDF,0xEB,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x3F,0xFC,0xFF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xFF,0xEB,
-	0x1F,0xF4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,0xBF,0xD3,0xBF,0xCB,0x7F,0xCB,0x5F,0xC3,0x5F,0xB3,0x5F,0xB3,0xFE,0xAA,0xDE,0xA2,0xDE,0x92,0xBE,0x8A,0xBE,0x82,0x5E,0x82,0x5E,0x7A,0x5E,0x7A,0x3C,0x7A,0x1C,0x7A,0x3C,0x6A,0xFC,0x71,0xFC,0x69,0x1C,0x6A,0xDC,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xDD,0x69,
-	0xDC,0x69,0xFC,0x71,0x1C,0x72,0x3D,0x72,0x7C,0x72,0x9E,0x72,0x9D,0x6A,0x3C,0x62,0x1A,0x52,0x79,0x41,0x56,0x39,0xF3,0x20,0xB2,0x10,0x6F,0x10,0x6E,0x08,0x6E,0x08,0x8E,0x08,0xCF,0x08,0xD1,0x10,0xD2,0x10,0xD3,0x10,0x14,0x11,0xF4,0x18,0xB4,0x08,0xB3,0x08,0x94,0x00,0xD6,0x08,0xD8,0x08,0xFC,0x10,0xFC,0x10,0x1D,0x11,0x3D,0x11,
-	0x7E,0x11,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x19,0x7E,0x19,0x3E,0x11,0x1D,0x11,0x1C,0x11,0xFC,0x10,0xFB,0x10,0x3C,0x11,0x5D,0x21,0x5D,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x44,0x00,0x45,0x08,0x66,0x10,0x68,0x18,0xA9,0x20,0xCB,0x28,0x6F,0x49,0xF6,0x71,0x9A,0x9A,
-	0xDD,0xBA,0x3E,0xCB,0x7E,0xDB,0x9E,0xDB,0xDF,0xEB,0xDF,0xEB,0xFF,0xEB,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0xDF,0xEB,
-	0xDF,0xE3,0xBF,0xE3,0xBF,0xD3,0xBF,0xD3,0xBE,0xD3,0x9E,0xCB,0x5F,0xC3,0x5F,0xB3,0x3E,0xAB,0x3E,0xAB,0xDE,0xA2,0xDE,0x92,0xBF,0x8A,0xBE,0x8A,0x5E,0x82,0x5E,0x7A,0x3D,0x7A,0x1C,0x72,0x1C,0x72,0x1C,0x6A,0x1C,0x6A,0xFC,0x69,0xFB,0x61,0xFC,0x69,0xDC,0x61,0xDD,0x69,0xDD,0x69,0xDD,0x69,0xFD,0x69,0xFD,0x69,0xFC,0x71,0x3C,0x7A,
-	0x7E,0x82,0xDF,0x8A,0xFF,0x8A,0x1F,0x8B,0x1F,0x8B,0xDF,0x7A,0xBF,0x7A,0x7F,0x6A,0x5E,0x62,0x3D,0x5A,0x9A,0x49,0x78,0x39,0xF3,0x20,0xD1,0x10,0x6F,0x08,0x6E,0x08,0x8E,0x08,0x6E,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xD3,0x08,0xB4,0x10,0xB3,0x08,0xB5,0x00,0x75,0x00,0xD7,0x08,0x1A,0x09,0xFC,0x10,0xFD,0x10,0x1E,0x09,0x5E,0x11,
-	0x7E,0x19,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x19,0x1E,0x11,0x1D,0x11,0xFC,0x10,0x1C,0x11,0x3C,0x11,0x5C,0x29,0x5E,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x45,0x08,0x66,0x08,0x66,0x10,0x68,0x18,0xCA,0x28,0x0D,0x39,0xD4,0x71,0x58,0x92,
-	0xDB,0xB2,0x1C,0xC3,0x5E,0xCB,0x7E,0xDB,0xDF,0xEB,0xDF,0xEB,0xFF,0xEB,0x1F,0xF4,0xFF,0xEB,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0xFF,0xEB,0x1F,0xF4,0xDF,0xEB,0xDF,0xEB,0xBF,0xDB,
-	0xBF,0xDB,0xBF,0xDB,0xBF,0xCB,0x9F,0xCB,0x5F,0xC3,0x5F,0xB3,0x3E,0xAB,0xFE,0xAA,0xDE,0xA2,0xDE,0xA2,0xDF,0x92,0x7E,0x82,0x5E,0x82,0x5E,0x82,0x3D,0x7A,0x1C,0x7A,0x1C,0x6A,0x1C,0x6A,0x3C,0x6A,0xFA,0x61,0x1C,0x6A,0xDC,0x69,0xDB,0x61,0xDC,0x61,0xDC,0x69,0xDC,0x69,0xFC,0x71,0x1D,0x72,0x1C,0x7A,0x5D,0x7A,0x9E,0x82,0x1F,0x93,
-	0x3F,0x93,0x3F,0x9B,0x5F,0x9B,0x3F,0x8B,0xFF,0x8A,0xDF,0x7A,0xBF,0x7A,0x7F,0x6A,0x5F,0x62,0x3E,0x5A,0x1C,0x52,0x99,0x41,0x56,0x31,0xD3,0x18,0x6F,0x08,0x6E,0x08,0x6E,0x08,0x8E,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xD3,0x08,0xB3,0x08,0xB4,0x08,0x75,0x00,0xD6,0x08,0xD8,0x08,0xDB,0x08,0xFC,0x10,0x3D,0x09,0x3E,0x11,0x7E,0x19,
-	0x7E,0x19,0x7E,0x19,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x1E,0x11,0x1E,0x11,0x1D,0x11,0x3C,0x11,0x3D,0x11,0x7E,0x21,0x9E,0x29,0x5E,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x45,0x08,0x66,0x08,0x66,0x10,0x67,0x18,0xAA,0x20,0xED,0x38,0x91,0x59,0x17,0x82,
-	0xBB,0xAA,0xDC,0xBA,0x3D,0xCB,0x5D,0xD3,0x7E,0xDB,0xBE,0xE3,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0x1F,0xF4,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x3F,0xFC,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0x1F,0xF4,0xDF,0xEB,0xDF,0xEB,0xDF,0xE3,0xBF,0xE3,0xBF,0xDB,0x9E,0xDB,
-	0x9F,0xD3,0x5F,0xCB,0x5F,0xC3,0x5F,0xC3,0x3F,0xB3,0x3E,0xAB,0xDE,0xAA,0xDE,0xA2,0xBE,0x9A,0x5E,0x82,0x9E,0x8A,0x9E,0x82,0x5D,0x7A,0x3D,0x7A,0x1B,0x7A,0x1B,0x6A,0x1B,0x62,0xFA,0x61,0xFA,0x61,0xFA,0x61,0xDA,0x61,0xDA,0x61,0xDA,0x61,0xDC,0x69,0xDD,0x69,0x1D,0x72,0x3C,0x7A,0x5E,0x7A,0x7E,0x82,0xDF,0x92,0x5F,0x9B,0x5F,0xA3,
-	0x5F,0xA3,0x5F,0x9B,0x3F,0x93,0x1F,0x8B,0xDF,0x82,0xBF,0x7A,0xBE,0x72,0x7F,0x6A,0x3E,0x5A,0x1D,0x52,0xDD,0x49,0xFB,0x41,0x57,0x31,0x34,0x19,0xB1,0x10,0xAF,0x08,0x6E,0x08,0xAE,0x08,0x8F,0x08,0xB1,0x08,0xB1,0x08,0xB3,0x08,0xB3,0x08,0xB3,0x08,0xB5,0x00,0xD7,0x08,0xD9,0x08,0xFC,0x10,0x1D,0x09,0x1D,0x11,0x7E,0x11,0x9E,0x19,
-	0x7E,0x19,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x1D,0x11,0x1D,0x11,0x1E,0x11,0x1E,0x11,0x5E,0x21,0xBE,0x29,0xDF,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x25,0x08,0x45,0x08,0x66,0x10,0x67,0x18,0xAA,0x20,0xEC,0x28,0x2F,0x49,0xF5,0x79,
-	0x59,0x92,0xBC,0xB2,0x3D,0xBB,0x3C,0xCB,0x5D,0xD3,0x7E,0xDB,0xBE,0xE3,0xBE,0xE3,0xDF,0xEB,0xDF,0xEB,0x1F,0xF4,0x1F,0xF4,0xFF,0xEB,0xFF,0xEB,0x1F,0xF4,0x1F,0xF4,0xFF,0xEB,0xFF,0xEB,0xFF,0xEB,0xFF,0xEB,0x1F,0xF4,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xE3,0x9E,0xDB,0x7E,0xDB,0x7E,0xDB,0x5F,0xCB,0x5E,0xCB,
-	0x5F,0xC3,0x5F,0xB3,0x3E,0xB3,0xFE,0xAA,0xDE,0xAA,0xDE,0xAA,0xDE,0x92,0x7D,0x92,0x7E,0x82,0x5D,0x82,0x3C,0x7A,0x1C,0x7A,0x1B,0x72,0x1B,0x6A,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xDC,0x69,0xFC,0x71,0xDC,0x69,0x1C,0x7A,0x5E,0x7A,0x9E,0x8A,0xDF,0x92,0x3F,0x9B,0x5F,0xA3,0x5F,0x9B,
-	0x5F,0x9B,0xFF,0x92,0xFF,0x8A,0xDF,0x7A,0xBE,0x7A,0x9D,0x6A,0x5E,0x6A,0x3E,0x5A,0x1E,0x5A,0xDD,0x49,0xFB,0x41,0x7A,0x41,0x78,0x31,0x35,0x29,0xD2,0x10,0xCF,0x08,0x6E,0x08,0x6E,0x08,0x70,0x08,0x90,0x08,0xB1,0x08,0xB2,0x08,0x92,0x08,0x74,0x00,0xB5,0x00,0xD8,0x08,0xDB,0x08,0xFC,0x10,0x3D,0x09,0x5E,0x11,0x9E,0x19,0x9E,0x19,
-	0x7E,0x19,0x7E,0x19,0x9E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x19,0x1E,0x11,0x3C,0x11,0x3E,0x19,0x3E,0x21,0x9E,0x29,0xDF,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x45,0x08,0x66,0x08,0x86,0x10,0x68,0x18,0xA9,0x20,0x0E,0x39,0x91,0x61,
-	0x17,0x82,0x9A,0xA2,0xDB,0xB2,0x1E,0xC3,0x3D,0xCB,0x5D,0xD3,0x7E,0xDB,0x9E,0xE3,0xBE,0xE3,0xBE,0xE3,0xBF,0xE3,0xDF,0xE3,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xDF,0xEB,0xBF,0xE3,0xBE,0xE3,0xBE,0xE3,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x5E,0xD3,0x5E,0xD3,0x5F,0xC3,0x5F,0xBB,0x3E,0xAB,
-	0xFE,0xB2,0xDE,0xAA,0xBD,0xA2,0xDD,0xA2,0xDE,0x92,0xDD,0x92,0x7C,0x8A,0x5D,0x82,0x5B,0x82,0x3B,0x7A,0x1A,0x72,0x19,0x6A,0xF9,0x69,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xDA,0x61,0xFA,0x69,0xDC,0x69,0x1C,0x7A,0x3D,0x7A,0x9E,0x8A,0xFF,0x92,0x5F,0x9B,0x5F,0x9B,0x5F,0x9B,0x3F,0x93,
-	0xDF,0x8A,0xDF,0x8A,0xBF,0x82,0xBE,0x7A,0x5E,0x72,0x3E,0x62,0x3E,0x5A,0x1D,0x5A,0xDD,0x49,0xBC,0x41,0x79,0x39,0x78,0x31,0x56,0x29,0x34,0x21,0x12,0x19,0xAF,0x08,0x8E,0x08,0x6E,0x08,0xAF,0x08,0x70,0x08,0x91,0x08,0x91,0x08,0x92,0x08,0x94,0x00,0xB6,0x00,0xD8,0x08,0xFC,0x10,0x3C,0x09,0x1E,0x11,0x9E,0x11,0x7E,0x19,0x7E,0x19,
-	0x9E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x11,0x3E,0x11,0x1C,0x11,0x3E,0x19,0x9E,0x21,0xDF,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x66,0x08,0x66,0x10,0x68,0x18,0xA9,0x20,0xCB,0x28,0x50,0x49,
-	0xD4,0x79,0x59,0x8A,0xB9,0xAA,0xDC,0xB2,0xDC,0xBA,0x3E,0xC3,0x5D,0xD3,0x5D,0xD3,0x7E,0xDB,0x9E,0xDB,0x9E,0xDB,0x9E,0xDB,0x7E,0xDB,0x7E,0xDB,0x9E,0xDB,0x9E,0xDB,0xBE,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xDB,0x7E,0xD3,0x5E,0xCB,0x5E,0xCB,0x5F,0xCB,0x5F,0xB3,0xFE,0xAA,0xFE,0xAA,0xDE,0xAA,
-	0xDE,0xA2,0xBD,0x9A,0xBC,0x9A,0x7D,0x8A,0x7D,0x82,0x5B,0x82,0x5B,0x82,0x3A,0x72,0x39,0x72,0x19,0x72,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xB6,0x59,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xD9,0x61,0xDC,0x69,0x1C,0x7A,0x3D,0x7A,0x9E,0x8A,0xFF,0x92,0x5F,0x9B,0x5F,0x9B,0xFF,0x92,0xFF,0x92,0xDF,0x8A,
-	0xDF,0x82,0x7E,0x7A,0x7E,0x72,0x5D,0x6A,0x3E,0x62,0x3D,0x5A,0xDC,0x51,0xDC,0x49,0x7A,0x41,0x79,0x39,0x78,0x31,0x57,0x21,0x35,0x29,0x34,0x19,0xD1,0x18,0xAF,0x18,0x6D,0x08,0x8E,0x08,0x6E,0x08,0x8E,0x08,0x91,0x08,0x91,0x08,0x72,0x08,0x74,0x00,0xB7,0x00,0xD9,0x08,0xFC,0x08,0x1D,0x09,0x5E,0x11,0xBE,0x19,0x9E,0x19,0x9E,0x19,
-	0x9E,0x19,0x7E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x11,0x5E,0x11,0x3D,0x11,0x5E,0x21,0xDF,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x25,0x08,0x65,0x10,0x87,0x18,0x67,0x18,0xCA,0x28,0xED,0x38,
-	0xB1,0x69,0x17,0x82,0x59,0x92,0xBB,0xA2,0xDC,0xB2,0xDC,0xBA,0x1C,0xC3,0x3D,0xCB,0x3D,0xCB,0x3D,0xCB,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5E,0xD3,0x5F,0xC3,0x3E,0xC3,0x5F,0xC3,0x3E,0xC3,0x3E,0xB3,0x1E,0xB3,0x1E,0xAB,0xBD,0xA2,0x9D,0xA2,0x5C,0x9A,
-	0x5C,0x8A,0x5B,0x8A,0x5C,0x82,0x5B,0x82,0x3A,0x7A,0x1B,0x7A,0x19,0x6A,0xD9,0x61,0xF8,0x69,0xB8,0x59,0xB8,0x59,0x95,0x59,0xB7,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xB7,0x59,0xB7,0x59,0xB6,0x59,0xD9,0x61,0xD9,0x61,0xFA,0x69,0xFA,0x69,0x1C,0x7A,0x7E,0x82,0xDF,0x92,0x3F,0x9B,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0xBE,0x82,0x5E,0x82,
-	0x5D,0x72,0x3C,0x6A,0x1C,0x62,0x1D,0x5A,0xDB,0x51,0xBB,0x51,0x9B,0x41,0x79,0x39,0x77,0x31,0x57,0x31,0x56,0x31,0x34,0x29,0x34,0x19,0x12,0x21,0xF1,0x20,0xCF,0x10,0xAE,0x08,0x6D,0x08,0x6E,0x08,0x6F,0x08,0x71,0x08,0x71,0x08,0x72,0x00,0x74,0x00,0xD7,0x08,0xDB,0x08,0xFC,0x10,0x5D,0x09,0x7E,0x11,0x9E,0x11,0x7E,0x11,0x7E,0x19,
-	0x7F,0x19,0x7E,0x19,0x7E,0x19,0x7E,0x19,0x5E,0x11,0x3D,0x11,0x3D,0x11,0x5D,0x21,0xBE,0x29,0xDF,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x65,0x08,0x66,0x10,0x67,0x18,0x88,0x18,0xCA,0x28,
-	0x2E,0x49,0x53,0x6A,0x37,0x8A,0x79,0xA2,0xB9,0xAA,0xDB,0xB2,0xDB,0xB2,0xDC,0xBA,0xDD,0xBA,0xDD,0xBA,0xFD,0xBA,0xFD,0xBA,0x1E,0xBB,0x3E,0xC3,0x5F,0xCB,0x3D,0xCB,0x5E,0xC3,0x5E,0xC3,0x3E,0xC3,0x3E,0xC3,0x1E,0xBB,0x1E,0xBB,0xFD,0xBA,0xDD,0xB2,0xFE,0xAA,0xDC,0xAA,0xDD,0xAA,0xBC,0xA2,0xBC,0x9A,0x7C,0x92,0x5B,0x8A,0x5B,0x82,
-	0x5B,0x82,0x3A,0x7A,0x39,0x72,0x39,0x72,0x19,0x6A,0xF6,0x69,0xD8,0x61,0xD6,0x61,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0xB7,0x59,0x96,0x59,0xB8,0x59,0xD9,0x61,0xD9,0x61,0x3A,0x72,0x9E,0x82,0xDF,0x8A,0xDF,0x92,0xDF,0x92,0xDF,0x8A,0x7E,0x82,0x7E,0x82,0x5E,0x7A,0x3C,0x6A,
-	0x3C,0x6A,0x3C,0x5A,0xFB,0x59,0xBA,0x49,0xD9,0x49,0x78,0x41,0x77,0x39,0x56,0x31,0x35,0x31,0x35,0x31,0x34,0x29,0x13,0x21,0x13,0x29,0x32,0x11,0xD0,0x18,0xAF,0x18,0x6C,0x08,0x6D,0x08,0x6E,0x08,0x6E,0x08,0x8F,0x08,0x71,0x08,0x72,0x00,0x96,0x00,0xD7,0x08,0xDB,0x08,0x3C,0x09,0x5E,0x11,0x9E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,
-	0x9E,0x19,0x7F,0x19,0x7E,0x19,0x7E,0x11,0x3E,0x11,0x3D,0x11,0x3C,0x11,0x9E,0x21,0xDF,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x44,0x08,0x65,0x10,0x86,0x18,0x68,0x18,0xA9,0x20,
-	0x0D,0x39,0xB2,0x61,0xF4,0x79,0x37,0x8A,0x9A,0x9A,0x99,0xA2,0xBA,0xAA,0xDA,0xB2,0xDB,0xB2,0xDC,0xB2,0xDC,0xB2,0xDC,0xB2,0xDC,0xB2,0xDD,0xBA,0xDC,0xB2,0xFD,0xB2,0xDC,0xB2,0xDC,0xB2,0xDC,0xB2,0xDC,0xB2,0xBC,0xAA,0xBB,0xAA,0xDC,0xAA,0xBB,0xAA,0x7B,0xA2,0x9B,0x9A,0x9B,0x92,0x9B,0x92,0x5A,0x8A,0x39,0x82,0x39,0x82,0x38,0x7A,
-	0x17,0x7A,0x16,0x72,0x17,0x6A,0xD7,0x61,0xD5,0x61,0xD5,0x61,0x95,0x59,0x95,0x59,0x95,0x51,0x95,0x51,0x94,0x51,0x94,0x51,0x74,0x51,0x74,0x51,0x74,0x51,0x95,0x59,0x95,0x59,0x75,0x51,0x96,0x59,0xD8,0x61,0xD9,0x61,0xFB,0x71,0x3D,0x7A,0xBE,0x82,0xDF,0x8A,0xDF,0x8A,0xBE,0x82,0x5E,0x82,0x3D,0x7A,0x3D,0x72,0x1C,0x72,0x1B,0x62,
-	0x1B,0x5A,0xB9,0x49,0xD8,0x49,0x77,0x41,0x56,0x39,0x56,0x39,0x14,0x29,0x34,0x31,0x13,0x29,0x12,0x21,0x12,0x19,0x12,0x19,0xF1,0x20,0xD1,0x18,0xD0,0x18,0xAE,0x10,0x8C,0x00,0x6C,0x08,0x6D,0x08,0x6E,0x08,0x6E,0x08,0x71,0x08,0x72,0x00,0xB6,0x00,0xD8,0x08,0xFC,0x10,0x1C,0x11,0x5E,0x11,0x7E,0x11,0xBE,0x19,0xBE,0x19,0x9E,0x19,
-	0x7F,0x11,0x7F,0x11,0x7E,0x11,0x3E,0x11,0x5D,0x11,0x3C,0x11,0x7D,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0x68,0x18,
-	0xCA,0x28,0x4D,0x49,0xD3,0x69,0x16,0x82,0x56,0x92,0x59,0x92,0x79,0x9A,0x79,0x9A,0x9A,0xA2,0xBB,0xAA,0xDB,0xB2,0xDB,0xB2,0xBB,0xA2,0xBC,0xA2,0xBB,0xAA,0xBB,0x9A,0xBB,0x9A,0xBB,0x9A,0xBB,0xA2,0xBB,0xA2,0x99,0xA2,0x59,0x92,0x79,0x92,0x59,0x92,0x59,0x92,0x59,0x92,0x39,0x8A,0x17,0x82,0x38,0x7A,0x18,0x72,0xF5,0x69,0xF5,0x69,
-	0xF5,0x69,0xB5,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x95,0x59,0x92,0x49,0x92,0x49,0x92,0x49,0x92,0x49,0x72,0x41,0x72,0x41,0x92,0x41,0x92,0x41,0x74,0x41,0x74,0x51,0x95,0x59,0x75,0x51,0x96,0x59,0xD8,0x61,0xD9,0x61,0x3B,0x7A,0x7E,0x82,0x7E,0x82,0xBE,0x82,0x7E,0x7A,0x3D,0x7A,0x1C,0x7A,0x1C,0x6A,0xFA,0x61,0xF9,0x59,0xB9,0x49,
-	0x97,0x41,0x97,0x41,0x74,0x41,0x55,0x31,0x54,0x39,0x12,0x29,0x11,0x29,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xCF,0x18,0xD0,0x18,0xAF,0x18,0xAE,0x18,0xAD,0x10,0x6B,0x00,0x6B,0x00,0x6C,0x08,0x6D,0x08,0x6E,0x08,0x71,0x08,0x72,0x00,0xB6,0x00,0xD9,0x08,0xFC,0x10,0x1E,0x11,0x5E,0x11,0x7E,0x11,0xBD,0x19,0xBE,0x19,0x9E,0x19,
-	0x7E,0x11,0x7E,0x11,0x7E,0x19,0x5E,0x19,0x5E,0x11,0x5E,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x08,0x45,0x08,0x66,0x10,0x67,0x18,
-	0x89,0x20,0x0D,0x39,0x90,0x61,0x53,0x6A,0x15,0x82,0x34,0x92,0x36,0x92,0x58,0x92,0x58,0x92,0x58,0x92,0x59,0x92,0x79,0xA2,0x79,0x9A,0x79,0x9A,0x59,0x92,0x59,0x92,0x79,0x9A,0x59,0x92,0x59,0x92,0x59,0x92,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x16,0x7A,0x16,0x7A,0xF6,0x79,0xF6,0x79,0xF6,0x71,0xF5,0x69,0xD4,0x69,0xD5,0x61,
-	0x94,0x51,0x94,0x51,0x93,0x51,0x93,0x51,0xB1,0x49,0xB1,0x49,0x91,0x49,0x51,0x41,0x71,0x41,0x71,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x52,0x41,0x53,0x41,0x74,0x41,0x95,0x59,0x95,0x59,0xB8,0x59,0xF9,0x69,0x7C,0x7A,0x7E,0x82,0x7D,0x82,0x3D,0x72,0x1C,0x72,0x1B,0x62,0x1B,0x62,0xB8,0x59,0xD8,0x49,0x76,0x41,0x76,0x41,
-	0x74,0x41,0x53,0x39,0x53,0x39,0x11,0x29,0x11,0x29,0x11,0x29,0xF0,0x20,0xD0,0x18,0xCF,0x18,0xAE,0x18,0xAE,0x18,0xAE,0x18,0xAE,0x18,0xAE,0x18,0xAD,0x10,0x6C,0x08,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6D,0x08,0x6E,0x08,0x70,0x08,0x74,0x00,0xB6,0x00,0xD9,0x08,0xFD,0x10,0x1E,0x11,0x7E,0x11,0x7E,0x11,0xBE,0x09,0x9E,0x19,0x7E,0x19,
-	0x7E,0x11,0x1E,0x11,0x5E,0x11,0x5E,0x11,0x3E,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x08,0x45,0x08,0x66,0x10,
-	0x88,0x18,0xCA,0x28,0x2E,0x49,0xB1,0x71,0xD2,0x71,0xF3,0x81,0x14,0x82,0x36,0x8A,0x55,0x92,0x55,0x92,0x56,0x92,0x56,0x92,0x37,0x8A,0x37,0x8A,0x38,0x8A,0x38,0x8A,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0x17,0x82,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xD3,0x69,0xB4,0x61,0xB2,0x59,0x93,0x59,0x91,0x59,
-	0xB1,0x49,0xB1,0x49,0x90,0x51,0x91,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x4F,0x49,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x52,0x41,0x74,0x49,0x74,0x51,0x96,0x59,0xD9,0x61,0x19,0x72,0x3C,0x7A,0x1C,0x7A,0x3C,0x7A,0xD9,0x61,0xD9,0x61,0xB8,0x59,0x77,0x49,0x75,0x41,0x74,0x41,0x74,0x41,0x33,0x31,
-	0x31,0x31,0x31,0x31,0x11,0x29,0xF1,0x20,0xEE,0x20,0xCF,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAD,0x18,0xAB,0x10,0x8B,0x08,0x8C,0x10,0x6B,0x08,0x8B,0x08,0x6A,0x08,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6B,0x00,0x6E,0x08,0x70,0x08,0x74,0x00,0xB6,0x00,0xDB,0x08,0xFD,0x10,0x1E,0x11,0x7E,0x11,0x7E,0x11,0x9E,0x11,0x9E,0x19,0x7E,0x11,
-	0x5E,0x11,0x5E,0x11,0x1E,0x11,0x1E,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x10,
-	0xA6,0x20,0xC9,0x28,0x0B,0x39,0x6F,0x59,0xB2,0x71,0xD2,0x79,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF5,0x81,0x34,0x8A,0x34,0x8A,0xF6,0x79,0x35,0x8A,0x15,0x7A,0xF5,0x79,0x54,0x72,0xF4,0x79,0xF4,0x69,0xF4,0x69,0xD4,0x69,0xD4,0x69,0xF3,0x71,0xD4,0x69,0xB3,0x69,0xB3,0x69,0x92,0x69,0x92,0x61,0x92,0x61,0x91,0x59,0xB1,0x49,0xB1,0x49,
-	0x70,0x51,0x90,0x49,0x4F,0x41,0x4E,0x49,0x2F,0x41,0x2F,0x41,0x4F,0x49,0x4E,0x49,0x30,0x41,0x2F,0x41,0x0E,0x39,0x2F,0x39,0x0F,0x39,0x50,0x41,0x51,0x41,0x51,0x41,0x51,0x41,0x74,0x41,0x96,0x59,0xD9,0x61,0x39,0x6A,0x1A,0x72,0x19,0x6A,0xD9,0x61,0xB8,0x59,0x95,0x59,0x75,0x41,0x74,0x41,0x53,0x41,0x51,0x39,0x31,0x39,0x31,0x31,
-	0x10,0x29,0xF0,0x20,0xCD,0x20,0xAE,0x18,0xAE,0x18,0xAD,0x18,0xAC,0x10,0xAB,0x10,0xAB,0x10,0x8A,0x00,0x6A,0x08,0x6A,0x08,0x8A,0x08,0x8A,0x08,0x6A,0x08,0x69,0x08,0x48,0x00,0x49,0x00,0x4A,0x00,0x2B,0x00,0x6D,0x08,0x70,0x08,0x73,0x00,0xB7,0x08,0xD9,0x08,0xFD,0x10,0x1E,0x11,0x5E,0x11,0x7E,0x11,0x9E,0x11,0x7E,0x11,0x7E,0x19,
-	0x5E,0x11,0x1E,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x66,0x10,0xA6,0x20,0xCA,0x28,0x4D,0x49,0x90,0x61,0x91,0x69,0xB2,0x71,0xD2,0x79,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF3,0x81,0xF4,0x71,0xF3,0x79,0x13,0x72,0xF3,0x71,0xD4,0x69,0xB2,0x69,0xB2,0x69,0xB2,0x69,0xB2,0x71,0xB2,0x71,0x91,0x61,0xB1,0x59,0x91,0x61,0x91,0x51,0x90,0x59,0xB1,0x49,0x90,0x51,0xB1,0x49,0x6F,0x49,0x6F,0x49,
-	0x4E,0x49,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0E,0x41,0x0F,0x31,0x0E,0x41,0x0F,0x31,0x0E,0x39,0x0F,0x31,0xED,0x30,0xED,0x30,0x0E,0x39,0x30,0x31,0x2F,0x41,0x51,0x41,0x51,0x41,0x74,0x49,0x96,0x59,0xF9,0x69,0xD9,0x61,0xD9,0x61,0xB8,0x59,0x96,0x59,0x75,0x51,0x74,0x41,0x53,0x41,0x51,0x41,0x31,0x31,0x31,0x31,0x10,0x29,0xEE,0x28,
-	0xED,0x20,0xCD,0x18,0xAD,0x18,0xAD,0x18,0xAC,0x10,0xAB,0x10,0xAB,0x10,0x8A,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x69,0x08,0x48,0x00,0x48,0x00,0x2A,0x00,0x2B,0x00,0x6D,0x08,0x70,0x08,0x73,0x00,0xB6,0x00,0xD9,0x08,0xFD,0x10,0x1E,0x11,0x3F,0x11,0x7E,0x19,0x7E,0x11,0x7F,0x11,0x7E,0x11,
-	0x1E,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x66,0x10,0xC9,0x28,0x2A,0x41,0x4C,0x49,0x90,0x61,0x91,0x69,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xD2,0x79,0xB2,0x71,0xB2,0x71,0xD3,0x69,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB1,0x69,0xB1,0x69,0x91,0x61,0x90,0x59,0x90,0x51,0x90,0x51,0x90,0x51,0x8F,0x59,0x90,0x49,0x90,0x49,0x4E,0x49,0x4E,0x49,0x2E,0x49,0x0E,0x41,
-	0x0E,0x39,0x0E,0x39,0x4D,0x31,0xED,0x38,0xED,0x30,0xED,0x30,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x30,0xED,0x28,0x0E,0x31,0x10,0x31,0x30,0x39,0x51,0x41,0x74,0x51,0x95,0x59,0xD6,0x61,0xB7,0x59,0xD7,0x51,0x75,0x51,0x74,0x41,0x53,0x41,0x51,0x41,0x31,0x39,0x31,0x31,0x10,0x29,0xED,0x28,0xED,0x20,0xED,0x20,
-	0xAC,0x18,0xAC,0x18,0xAC,0x18,0xAB,0x10,0x8A,0x10,0x6A,0x08,0x68,0x10,0x68,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x00,0x68,0x08,0x68,0x00,0x48,0x00,0x28,0x00,0x29,0x00,0x2B,0x00,0x6C,0x08,0x70,0x08,0x72,0x00,0x97,0x08,0xD9,0x08,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x5F,0x11,0x7F,0x11,0x5E,0x11,0x3E,0x11,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x86,0x18,0xC9,0x28,0x2B,0x41,0x6F,0x59,0x90,0x61,0x90,0x61,0x90,0x61,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0xB2,0x71,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x59,0x90,0x61,0x90,0x51,0x6F,0x59,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x4E,0x49,0x0E,0x41,0x0E,0x39,0x0E,0x39,
-	0x0D,0x29,0xED,0x30,0xEB,0x30,0xED,0x28,0xEB,0x30,0xED,0x28,0xCC,0x28,0xCC,0x28,0xCA,0x28,0xCC,0x28,0xCB,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x0E,0x39,0x51,0x41,0x73,0x41,0x95,0x59,0x95,0x51,0x74,0x51,0x74,0x41,0x74,0x41,0x52,0x41,0x31,0x39,0x31,0x31,0x10,0x29,0xEE,0x28,0xED,0x28,0xCE,0x18,0xCD,0x20,0xAD,0x18,
-	0xAB,0x10,0xAB,0x10,0x6A,0x10,0x69,0x10,0x68,0x10,0x68,0x08,0x68,0x08,0x68,0x08,0x68,0x08,0x48,0x08,0x68,0x00,0x67,0x00,0x68,0x00,0x68,0x00,0x67,0x00,0x67,0x00,0x47,0x00,0x48,0x00,0x29,0x00,0x2B,0x00,0x4C,0x00,0x70,0x08,0x72,0x08,0x75,0x08,0xD9,0x08,0xFB,0x10,0xFC,0x10,0x1E,0x11,0x1E,0x11,0x5E,0x11,0x1E,0x11,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x18,0xC9,0x28,0x2B,0x41,0x6F,0x59,0x90,0x61,0x90,0x61,0x91,0x69,0x90,0x61,0x90,0x61,0x91,0x69,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x8F,0x59,0x8F,0x59,0x6F,0x59,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x4E,0x49,0x4E,0x49,0x4E,0x49,0x0E,0x41,0x0D,0x41,0x0D,0x41,0x0D,0x39,0x0B,0x39,
-	0xEC,0x28,0xEC,0x28,0xCC,0x28,0xEB,0x30,0xCC,0x28,0xCA,0x28,0xCA,0x20,0xCA,0x20,0xCA,0x20,0xCA,0x28,0xAA,0x20,0xCB,0x28,0xAB,0x20,0xEC,0x28,0xED,0x28,0x0F,0x29,0x30,0x31,0x91,0x41,0x73,0x41,0x73,0x41,0x53,0x41,0x51,0x41,0x51,0x39,0x30,0x39,0x10,0x29,0xED,0x28,0xED,0x28,0xCD,0x20,0xCD,0x20,0xAD,0x18,0x8C,0x18,0x8C,0x10,
-	0x6B,0x10,0x6B,0x10,0x68,0x10,0x68,0x10,0x68,0x08,0x68,0x08,0x68,0x08,0x67,0x08,0x47,0x00,0x47,0x00,0x67,0x00,0x67,0x00,0x47,0x00,0x47,0x00,0x46,0x00,0x46,0x00,0x26,0x00,0x27,0x00,0x29,0x00,0x4A,0x00,0x4C,0x00,0x6F,0x08,0x72,0x00,0x74,0x08,0xD7,0x08,0xDA,0x10,0xFC,0x10,0x1D,0x11,0x1D,0x11,0x1D,0x11,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x39,0x4B,0x49,0x4C,0x49,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x90,0x61,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x6E,0x51,0x4C,0x49,0x4C,0x49,0x2D,0x41,0x0D,0x41,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x28,0xCA,0x28,
-	0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x20,0x69,0x10,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAB,0x20,0xAB,0x20,0x8D,0x18,0xED,0x28,0x0F,0x31,0x31,0x41,0x51,0x41,0x51,0x41,0x31,0x39,0x31,0x31,0x0F,0x39,0x10,0x29,0xED,0x28,0xED,0x28,0xCD,0x20,0xCD,0x20,0xAD,0x18,0x8D,0x18,0x8B,0x10,0x6B,0x10,
-	0x6B,0x10,0x6B,0x10,0x6A,0x08,0x69,0x08,0x69,0x08,0x68,0x08,0x68,0x08,0x47,0x08,0x28,0x00,0x27,0x00,0x27,0x00,0x26,0x00,0x46,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x28,0x00,0x2A,0x00,0x2C,0x00,0x6E,0x08,0x71,0x08,0x74,0x00,0x96,0x08,0xD8,0x08,0xDA,0x08,0xFB,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x49,0x6D,0x51,0x6E,0x59,0x6F,0x59,0x6F,0x59,0x6F,0x59,0x6F,0x59,0x6D,0x51,0x6D,0x51,0x6D,0x51,0x6D,0x51,0x4D,0x49,0x4D,0x49,0x4C,0x49,0x4C,0x49,0x4C,0x49,0x0C,0x41,0x2C,0x41,0x0B,0x39,0x0C,0x39,0x0B,0x39,0xEC,0x28,0xEA,0x30,0xCA,0x28,0xCA,0x28,
-	0xCA,0x28,0xA9,0x20,0xA9,0x20,0xA9,0x20,0x89,0x20,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x6A,0x18,0xAA,0x20,0xAA,0x20,0xCC,0x20,0xED,0x28,0x50,0x39,0x30,0x41,0x30,0x31,0x10,0x31,0x0E,0x31,0x0F,0x29,0xED,0x28,0xED,0x28,0xCD,0x20,0xAD,0x18,0xAD,0x18,0xAD,0x20,0x8D,0x18,0x6D,0x18,0x6B,0x10,
-	0x6D,0x18,0x6B,0x10,0x6B,0x08,0x6B,0x08,0x6B,0x10,0x6B,0x10,0x6A,0x08,0x69,0x08,0x69,0x00,0x68,0x00,0x68,0x00,0x47,0x00,0x26,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x28,0x00,0x29,0x00,0x6B,0x00,0x6D,0x08,0x70,0x08,0x92,0x08,0x74,0x00,0x75,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0x49,0x6E,0x51,0x4D,0x49,0x4C,0x49,0x4C,0x49,0x4D,0x49,0x4D,0x49,0x4C,0x49,0x4C,0x49,0x4C,0x49,0x4C,0x49,0x4B,0x49,0x4B,0x49,0x2B,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,
-	0xA9,0x20,0x88,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x86,0x20,0x67,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x68,0x18,0x88,0x18,0xAA,0x18,0xAA,0x20,0xED,0x28,0x0D,0x39,0xEE,0x30,0xEE,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0x8D,0x18,0xCD,0x20,0x8D,0x18,0xAD,0x18,0xAD,0x18,0x6D,0x18,0x6D,0x18,0x6E,0x10,
-	0x6E,0x10,0x6E,0x10,0xAF,0x18,0xAF,0x18,0x8E,0x18,0xB0,0x18,0xAE,0x18,0x8E,0x10,0x8C,0x10,0x6B,0x08,0x69,0x08,0x68,0x00,0x67,0x00,0x26,0x00,0x25,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x27,0x00,0x29,0x00,0x2A,0x00,0x4C,0x00,0x6E,0x08,0x71,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x41,0x4B,0x41,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x31,0x0B,0x31,0xC9,0x28,0xC9,0x28,0xCA,0x28,0xCA,0x28,0xA9,0x20,0xA7,0x20,
-	0x87,0x18,0xA6,0x20,0x67,0x18,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x46,0x08,0x66,0x10,0x65,0x10,0x66,0x10,0x66,0x10,0x67,0x10,0x68,0x18,0x89,0x10,0xCA,0x28,0xCC,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xED,0x28,0xAD,0x20,0xAD,0x20,0xAD,0x20,0x8D,0x18,0x8D,0x18,0x8D,0x10,0x8D,0x18,0x8E,0x10,0xAF,0x18,0xAF,0x10,
-	0xD1,0x18,0xD1,0x18,0xF3,0x18,0xF3,0x18,0x12,0x21,0xF1,0x20,0xF1,0x18,0xCF,0x18,0xAF,0x18,0xAD,0x18,0x8B,0x10,0x6A,0x08,0x68,0x00,0x67,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x27,0x00,0x28,0x00,0x4A,0x00,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x4B,0x49,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x39,0x29,0x39,0xE9,0x28,0xE9,0x28,0x08,0x31,0xC9,0x28,0xC9,0x28,0xC7,0x28,0xA6,0x20,0x67,0x18,
-	0xA6,0x20,0x86,0x18,0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x25,0x08,0x25,0x08,0x45,0x08,0x45,0x08,0x45,0x08,0x65,0x08,0x65,0x08,0x66,0x08,0x66,0x10,0x67,0x10,0xA9,0x18,0xAA,0x20,0xCB,0x28,0xCB,0x28,0xCD,0x20,0x8D,0x18,0xCD,0x20,0x8D,0x18,0x8D,0x18,0x6D,0x18,0x8E,0x18,0xB0,0x10,0xB0,0x18,0xB1,0x10,0xF2,0x20,0x14,0x21,
-	0x15,0x19,0x16,0x19,0x15,0x29,0x35,0x29,0x35,0x19,0x14,0x21,0x13,0x11,0xD1,0x18,0xB0,0x18,0xAF,0x18,0x8C,0x10,0x8B,0x08,0x68,0x08,0x67,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x39,0x0B,0x39,0x0B,0x39,0x0A,0x39,0x0B,0x39,0x0A,0x39,0x0A,0x39,0x09,0x39,0x08,0x31,0xE9,0x28,0xC9,0x28,0xC9,0x28,0xC6,0x28,0xC6,0x28,0xA6,0x20,0x67,0x18,0xA6,0x18,0x65,0x10,
-	0x65,0x10,0x65,0x10,0x65,0x10,0x64,0x08,0x24,0x08,0x25,0x08,0x44,0x08,0x24,0x08,0x24,0x08,0x64,0x08,0x44,0x08,0x64,0x08,0x24,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x88,0x18,0xA9,0x20,0xAB,0x18,0xAC,0x18,0xAC,0x18,0xCC,0x20,0x8D,0x18,0x8D,0x18,0xCE,0x20,0xAF,0x18,0xB0,0x18,0xD3,0x18,0x14,0x21,0x35,0x31,0x78,0x31,0x38,0x21,
-	0x58,0x29,0x58,0x29,0x18,0x21,0x37,0x19,0xD5,0x18,0xD5,0x18,0xD3,0x10,0xD1,0x10,0xB0,0x18,0xAF,0x18,0x6B,0x00,0x6B,0x00,0x69,0x08,0x68,0x00,0x67,0x00,0x66,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x39,0x09,0x39,0x28,0x39,0x09,0x39,0x29,0x31,0x48,0x31,0x08,0x31,0xE9,0x28,0xC9,0x28,0xC6,0x28,0xC8,0x28,0xC6,0x28,0xA6,0x20,0x66,0x10,0x65,0x10,0x65,0x10,
-	0x65,0x10,0x65,0x10,0x65,0x10,0x24,0x08,0x44,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x43,0x08,0x64,0x08,0x64,0x08,0x45,0x08,0x65,0x08,0x66,0x10,0x68,0x18,0xA9,0x18,0xAA,0x20,0xAD,0x18,0x8D,0x18,0xAD,0x20,0x8E,0x10,0x90,0x10,0xF2,0x20,0xF3,0x20,0x57,0x29,0x57,0x29,0x78,0x31,0x5A,0x29,0x5A,0x29,
-	0x18,0x21,0x18,0x21,0xF7,0x18,0xF7,0x18,0xD5,0x18,0xD3,0x10,0xD2,0x10,0x90,0x10,0xAF,0x10,0x8D,0x10,0x6B,0x08,0x6B,0x08,0x69,0x08,0x68,0x00,0x67,0x00,0x66,0x00,0x46,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x31,0x29,0x29,0x28,0x31,0xE9,0x28,0xC9,0x28,0xC6,0x28,0xC6,0x28,0xA6,0x20,0xA6,0x20,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x44,0x10,
-	0x44,0x08,0x44,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x26,0x08,0x67,0x10,0x68,0x18,0x6A,0x10,0xAD,0x18,0xCD,0x20,0x8F,0x10,0xD1,0x18,0x13,0x29,0x36,0x21,0x78,0x31,0x59,0x31,0x5C,0x31,0x3B,0x29,0x59,0x29,0x39,0x21,
-	0x19,0x21,0xF8,0x18,0xF6,0x20,0xD5,0x18,0xD4,0x10,0xD2,0x10,0xB0,0x10,0x8F,0x10,0x6D,0x10,0x6C,0x08,0x6B,0x08,0x6A,0x00,0x69,0x00,0x68,0x00,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x28,0xC6,0x28,0xA6,0x18,0xA6,0x18,0x65,0x10,0x65,0x10,0x65,0x10,0x43,0x10,0x44,0x08,0x43,0x08,
-	0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x23,0x08,0x23,0x08,0x24,0x08,0x45,0x08,0x66,0x08,0x26,0x08,0x48,0x08,0x6A,0x10,0x6B,0x10,0x8E,0x18,0xD1,0x20,0x14,0x29,0x17,0x21,0x79,0x39,0x5B,0x31,0x5B,0x31,0x5C,0x29,0x19,0x21,0x19,0x21,0x18,0x21,
-	0x18,0x21,0xD6,0x18,0xD5,0x18,0xD3,0x10,0xB1,0x10,0x70,0x10,0x6F,0x08,0x6D,0x10,0x6B,0x08,0x6B,0x08,0x4A,0x00,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x08,0x44,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x08,0x46,0x08,0x47,0x08,0x48,0x10,0x4B,0x10,0x6D,0x10,0xD0,0x18,0xF3,0x18,0x35,0x31,0x78,0x31,0x5A,0x39,0x5B,0x31,0x5B,0x29,0x3A,0x29,0x18,0x21,0x37,0x21,0x15,0x21,
-	0xF6,0x18,0xF3,0x18,0xD2,0x10,0xD1,0x10,0xB0,0x10,0x6F,0x10,0x6D,0x08,0x6C,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x25,0x00,0x26,0x08,0x28,0x08,0x4A,0x08,0x4C,0x10,0xAF,0x18,0xF2,0x20,0x35,0x29,0x38,0x21,0x58,0x29,0x59,0x29,0x19,0x21,0x19,0x21,0x18,0x19,0x16,0x29,0x14,0x19,0xD3,0x10,
-	0xD3,0x10,0xD1,0x10,0xB1,0x10,0x6F,0x10,0x6E,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x45,0x00,0x27,0x08,0x29,0x08,0x6C,0x08,0xB0,0x10,0xF2,0x20,0x14,0x29,0x36,0x21,0x57,0x29,0x18,0x21,0x18,0x21,0x18,0x19,0x16,0x19,0xF6,0x18,0xD4,0x10,0xD2,0x10,0xD1,0x10,
-	0x90,0x10,0x6F,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x25,0x00,0x46,0x00,0x29,0x08,0x8C,0x10,0xAF,0x18,0xF2,0x20,0x14,0x29,0x35,0x31,0x36,0x21,0x36,0x21,0x16,0x19,0xD5,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_1041_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_1041_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_1041_dial_img_preview_data_0};
-
-    
\ No newline at end of file
@@ -559,9 +559,16 @@ void init_face_1167(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_1167_46_146347, 62);
     lv_obj_add_flag(face_1167_46_146347, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_1167_46_146347, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_1167_0_25291);
+	face_compositor_static(face_1167_1_47159);
+	face_compositor_static(face_1167_6_25034);
+	face_compositor_static(face_1167_22_66711);
+	face_compositor_static(face_1167_31_68331);
+	face_compositor_static(face_1167_32_68523);
+	face_compositor_static(face_1167_41_66243);
 
 
-    callback("1167", &face_1167_dial_img_preview_0, &face_1167, NULL);
+    callback("1167", NULL, &face_1167, NULL);
 
 #endif
 }
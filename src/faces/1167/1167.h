@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_1167 // (1167) uncomment to enable or define it elsewhere
 
@@ -168,8 +169,6 @@ extern "C"
 	LV_IMG_DECLARE(face_1167_dial_img_52_150026_0);
 	LV_IMG_DECLARE(face_1167_dial_img_53_150589_0);
 	LV_IMG_DECLARE(face_1167_dial_img_54_151136_0);
-	LV_IMG_DECLARE(face_1167_dial_img_preview_0);
-	LV_IMG_DECLARE(face_1167_dial_img_preview_0);
 
 
 #endif
@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,13 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_22_66711_data_0[] = {
-	//RGB565 data 
-	0x30,0x84,0x14,0xA5,0x14,0xA5,0xE7,0x39,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x30,0x84,0x14,0xA5,0x14,0xA5,0xE7,0x39,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_22_66711_data_0, "face_1167_dial_img_22_66711_data_0.bin");
         
 
 
@@ -26,7 +21,7 @@ const lv_img_dsc_t face_1167_dial_img_22_66711_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 4,
     .header.h = 4,
-    .data_size = sizeof(face_1167_dial_img_22_66711_data_0),
+    .data_size = 48,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_22_66711_data_0};
 
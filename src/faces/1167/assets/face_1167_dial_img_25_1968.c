@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,19 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_25_1968_data_0[] = {
-	//RGB565 data 
-	0xCF,0x7B,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x2C,0x63,0x00,0x00,0x00,0x00,0xF7,0xBD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x59,0xCE,0xE7,0x39,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xAA,0x52,0xBA,0xD6,0xCF,0x7B,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,
-	0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x59,0xCE,0xFF,0xFF,0xBA,0xD6,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0xBE,0xF7,0xBE,0xF7,0xE7,0x39,0xB2,0x94,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xAA,0x52,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_25_1968_data_0, "face_1167_dial_img_25_1968_data_0.bin");
         
 
 
@@ -32,25 +21,13 @@ const lv_img_dsc_t face_1167_dial_img_25_1968_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 22,
     .header.h = 7,
-    .data_size = sizeof(face_1167_dial_img_25_1968_data_0),
+    .data_size = 462,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_25_1968_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_25_1968_data_1[] = {
-	//RGB565 data 
-	0x2C,0x63,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x24,0x21,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x2C,0x63,0x00,0x00,0x00,0x00,0x2C,0x63,0xF7,0xBD,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xF7,0xBD,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xFB,0xDE,0xFF,0xFF,0x14,0xA5,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,
-	0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xBA,0xD6,0xBE,0xF7,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xBE,0xF7,0x14,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFB,0xDE,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x2C,0x63,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_25_1968_data_1, "face_1167_dial_img_25_1968_data_1.bin");
         
 
 
@@ -58,7 +35,7 @@ const lv_img_dsc_t face_1167_dial_img_25_1968_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 22,
     .header.h = 7,
-    .data_size = sizeof(face_1167_dial_img_25_1968_data_1),
+    .data_size = 462,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_25_1968_data_1};
 
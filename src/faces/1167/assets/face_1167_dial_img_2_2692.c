@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,101 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_0[] = {
-	//RGB565 data 
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_0, "face_1167_dial_img_2_2692_data_0.bin");
         
 
 
@@ -114,107 +21,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_0),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_1[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_1, "face_1167_dial_img_2_2692_data_1.bin");
         
 
 
@@ -222,107 +35,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_1),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_2[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_2, "face_1167_dial_img_2_2692_data_2.bin");
         
 
 
@@ -330,107 +49,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_2),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_3[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_3, "face_1167_dial_img_2_2692_data_3.bin");
         
 
 
@@ -438,107 +63,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_3),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_4[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_4, "face_1167_dial_img_2_2692_data_4.bin");
         
 
 
@@ -546,107 +77,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_4),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_5[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_5, "face_1167_dial_img_2_2692_data_5.bin");
         
 
 
@@ -654,107 +91,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_5),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_6[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_6, "face_1167_dial_img_2_2692_data_6.bin");
         
 
 
@@ -762,107 +105,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_6),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_7[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_7, "face_1167_dial_img_2_2692_data_7.bin");
         
 
 
@@ -870,107 +119,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_7),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_8[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_8, "face_1167_dial_img_2_2692_data_8.bin");
         
 
 
@@ -978,107 +133,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_8),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_9[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xC5,0x00,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,
-	0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0x07,0x01,0xC5,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_9, "face_1167_dial_img_2_2692_data_9.bin");
         
 
 
@@ -1086,107 +147,13 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_9),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_9};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_2_2692_data_10[] = {
-	//RGB565 data 
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,
-	0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x00,0x00,0x00,0x00,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,0x00,0x00,0x00,0x00,0xF9,0x04,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,
-	0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0x3F,0x06,0xF9,0x04,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_2_2692_data_10, "face_1167_dial_img_2_2692_data_10.bin");
         
 
 
@@ -1194,7 +161,7 @@ const lv_img_dsc_t face_1167_dial_img_2_2692_10 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 158,
     .header.h = 12,
-    .data_size = sizeof(face_1167_dial_img_2_2692_data_10),
+    .data_size = 5688,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_2_2692_data_10};
 
@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,19 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_30_2330_data_0[] = {
-	//RGB565 data 
-	0x61,0x08,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0xE3,0x18,0x20,0x00,0x04,0x21,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x20,0x00,0x04,0x21,0x61,0x08,0x00,0x00,0x45,0x29,
-	0x45,0x29,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0xA2,0x10,0x45,0x29,0x04,0x21,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,
-	0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0xA2,0x10,0x45,0x29,0x04,0x21,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0xA2,0x10,0x45,0x29,0x04,0x21,
-	0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0xE3,0x18,0x45,0x29,0x04,0x21,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x04,0x21,0x45,0x29,0x82,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0x24,0x21,0x20,0x00,0x82,0x10,0x45,0x29,0xC3,0x18,0x00,0x00,0xC3,0x18,0x45,0x29,0x20,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_30_2330_data_0, "face_1167_dial_img_30_2330_data_0.bin");
         
 
 
@@ -32,25 +21,13 @@ const lv_img_dsc_t face_1167_dial_img_30_2330_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 22,
     .header.h = 7,
-    .data_size = sizeof(face_1167_dial_img_30_2330_data_0),
+    .data_size = 462,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_30_2330_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_30_2330_data_1[] = {
-	//RGB565 data 
-	0x41,0x08,0x24,0x21,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x04,0x21,0x45,0x29,0xC3,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x45,0x29,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,
-	0x45,0x29,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,
-	0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x45,0x29,0x45,0x29,0x41,0x08,0x04,0x21,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x41,0x08,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_30_2330_data_1, "face_1167_dial_img_30_2330_data_1.bin");
         
 
 
@@ -58,7 +35,7 @@ const lv_img_dsc_t face_1167_dial_img_30_2330_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 22,
     .header.h = 7,
-    .data_size = sizeof(face_1167_dial_img_30_2330_data_1),
+    .data_size = 462,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_30_2330_data_1};
 
@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,19 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x2C,0x63,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x30,0x84,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,
-	0x96,0xB5,0xBE,0xF7,0xFF,0xFF,0xCF,0x7B,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFB,0xDE,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,
-	0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x30,0x84,
-	0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xFB,0xDE,0xFF,0xFF,0xBE,0xF7,0xAA,0x52,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0xAA,0x52,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_0, "face_1167_dial_img_3_23560_data_0.bin");
         
 
 
@@ -32,25 +21,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_0),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x96,0xB5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFB,0xDE,0x24,0x21,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x24,0x21,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,
-	0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_1, "face_1167_dial_img_3_23560_data_1.bin");
         
 
 
@@ -58,25 +35,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_1),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x2C,0x63,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x14,0xA5,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,
-	0x96,0xB5,0xBE,0xF7,0xFF,0xFF,0x30,0x84,0xE7,0x39,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0x5D,0xEF,0xAA,0x52,0xBA,0xD6,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0xFF,0xFF,
-	0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xBE,0xF7,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0xFB,0xDE,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,
-	0xFF,0xFF,0x5D,0xEF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_2, "face_1167_dial_img_3_23560_data_2.bin");
         
 
 
@@ -84,25 +49,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_2),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xCF,0x7B,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xBA,0xD6,0x14,0xA5,
-	0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0xCF,0x7B,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xF7,0xBD,0x30,0x84,0xBA,0xD6,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x30,0x84,0xBE,0xF7,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x30,0x84,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x96,0xB5,0xBA,0xD6,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0x96,0xB5,0xFF,0xFF,0x59,0xCE,0x24,0x21,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x59,0xCE,0xE7,0x39,0xBE,0xF7,
-	0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0x5D,0xEF,0xFF,0xFF,0xBE,0xF7,0xAA,0x52,0x00,0x00,0xE7,0x39,0xF7,0xBD,0xBE,0xF7,0xFF,0xFF,0xBE,0xF7,0x59,0xCE,0xAA,0x52,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_3, "face_1167_dial_img_3_23560_data_3.bin");
         
 
 
@@ -110,25 +63,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_3),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,
-	0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x2C,0x63,0x2C,0x63,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xB5,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_4, "face_1167_dial_img_3_23560_data_4.bin");
         
 
 
@@ -136,25 +77,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_4),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAA,0x52,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x14,0xA5,
-	0x14,0xA5,0x14,0xA5,0x14,0xA5,0x30,0x84,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0xB2,0x94,0x14,0xA5,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x24,0x21,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xCF,0x7B,0xCF,0x7B,0xFB,0xDE,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x14,0xA5,0x14,0xA5,0x24,0x21,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x96,0xB5,
-	0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xFB,0xDE,0xFF,0xFF,0xBE,0xF7,0xAA,0x52,0x00,0x00,0x00,0x00,0x30,0x84,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0xAA,0x52,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_5, "face_1167_dial_img_3_23560_data_5.bin");
         
 
 
@@ -162,25 +91,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_5),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0x2C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,
-	0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x21,0xBE,0xF7,0xFF,0xFF,0xB2,0x94,0x2C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0x30,0x84,0xCF,0x7B,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xB2,0x94,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0xFF,0xFF,0xBE,0xF7,0xAA,0x52,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x59,0xCE,0x00,0x00,0xF7,0xBD,
-	0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x5D,0xEF,0xFF,0xFF,0xBE,0xF7,0xAA,0x52,0x00,0x00,0x00,0x00,0x14,0xA5,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0xAA,0x52,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_6, "face_1167_dial_img_3_23560_data_6.bin");
         
 
 
@@ -188,25 +105,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_6),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x14,0xA5,
-	0x14,0xA5,0x14,0xA5,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFB,0xDE,0xAA,0x52,0xBA,0xD6,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0x24,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,
-	0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE7,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_7, "face_1167_dial_img_3_23560_data_7.bin");
         
 
 
@@ -214,25 +119,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_7),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x2C,0x63,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x30,0x84,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,
-	0x96,0xB5,0xBE,0xF7,0xFF,0xFF,0xCF,0x7B,0xE7,0x39,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0x5D,0xEF,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,
-	0x59,0xCE,0xFF,0xFF,0x59,0xCE,0x2C,0x63,0xCF,0x7B,0xFB,0xDE,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x96,0xB5,0xBE,0xF7,0xFF,0xFF,0x30,0x84,0x2C,0x63,0xFF,0xFF,0x5D,0xEF,0x24,0x21,0x00,0x00,0x00,0x00,
-	0xAA,0x52,0xFF,0xFF,0xBE,0xF7,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xAA,0x52,0xFF,0xFF,0xBE,0xF7,0xAA,0x52,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0xF7,0xBD,
-	0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x30,0x84,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0x2C,0x63,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_8, "face_1167_dial_img_3_23560_data_8.bin");
         
 
 
@@ -240,25 +133,13 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_8),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_3_23560_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x30,0x84,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,
-	0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xCF,0x7B,0xCF,0x7B,0xFF,0xFF,0x5D,0xEF,0x24,0x21,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xFB,0xDE,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0xCF,0x7B,
-	0xFF,0xFF,0xBE,0xF7,0xE7,0x39,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x59,0xCE,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x30,0x84,0x00,0x00,0x24,0x21,0xF7,0xBD,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,
-	0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_3_23560_data_9, "face_1167_dial_img_3_23560_data_9.bin");
         
 
 
@@ -266,7 +147,7 @@ const lv_img_dsc_t face_1167_dial_img_3_23560_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 16,
-    .data_size = sizeof(face_1167_dial_img_3_23560_data_9),
+    .data_size = 432,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_3_23560_data_9};
 
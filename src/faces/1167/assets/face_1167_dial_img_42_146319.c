@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,13 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_42_146319_data_0[] = {
-	//RGB565 data 
-	0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,0x8F,0x3B,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_42_146319_data_0, "face_1167_dial_img_42_146319_data_0.bin");
         
 
 
@@ -26,7 +21,7 @@ const lv_img_dsc_t face_1167_dial_img_42_146319_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 6,
     .header.h = 3,
-    .data_size = sizeof(face_1167_dial_img_42_146319_data_0),
+    .data_size = 54,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_42_146319_data_0};
 
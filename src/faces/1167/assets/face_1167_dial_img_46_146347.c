@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,37 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_46_146347_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD2,0x02,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x01,0x69,0x01,0x00,0x00,0x00,0x00,0xA3,0x00,0xC5,0x00,0xC4,0x00,0x00,0x00,0x00,0x00,0xA4,0x00,0xD1,0x02,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x01,0xD1,0x02,0x34,0x03,0xD1,0x02,0x90,0x02,
-	0xE6,0x00,0x42,0x00,0x96,0x03,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x3A,0x04,0x89,0x01,0x00,0x00,0xE5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x01,0x7C,0x04,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x3A,0x04,0x9D,0x04,0x1F,0x05,0x1F,0x05,0x1F,0x05,
-	0x1F,0x05,0x1F,0x05,0x1F,0x05,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4E,0x02,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0xBD,0x04,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x01,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x48,0x01,0x00,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0x04,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0xAA,0x01,0x62,0x00,0xB1,0x02,0x00,0x00,0x00,0x00,0x21,0x00,0x4E,0x02,0x96,0x03,0x3A,0x04,0x1F,0x05,0x1F,0x05,
-	0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x27,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0xC5,0x00,0x9C,0x04,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,
-	0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x9C,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xBD,0x04,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,
-	0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x02,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x3A,0x04,0x27,0x01,
-	0x20,0x00,0x27,0x01,0x00,0x00,0x00,0x00,0x3A,0x04,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0xF8,0x03,0x00,0x00,0xA4,0x00,0xB0,0x02,0x41,0x00,0x00,0x00,0xFE,0x04,
-	0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7B,0x04,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,
-	0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x48,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x03,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,
-	0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x00,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,
-	0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x13,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x01,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x1F,0x05,0x3A,0x04,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0x00,0x55,0x03,0x7B,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0xDE,0x04,0x5B,0x04,0xD1,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,
-    };
+ASSET_BIN(face_1167_dial_img_46_146347_data_0, "face_1167_dial_img_46_146347_data_0.bin");
         
 
 
@@ -50,7 +21,7 @@ const lv_img_dsc_t face_1167_dial_img_46_146347_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 27,
     .header.h = 19,
-    .data_size = sizeof(face_1167_dial_img_46_146347_data_0),
+    .data_size = 1539,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_46_146347_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,28 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_51_149458_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x30,0x02,0x49,0x43,0x59,0x63,0x61,0x63,0x61,0x23,0x51,0xE2,0x40,0x81,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x51,0x46,0xAA,0x07,0xDB,0x89,0xFB,0x89,0xFB,0x48,0xEB,0x07,0xDB,0x07,0xDB,0x07,0xDB,0x28,0xE3,0x68,0xFB,
-	0x89,0xFB,0x69,0xFB,0xC7,0xCA,0xC4,0x79,0x61,0x18,0x00,0x00,0x20,0x08,0xA7,0xC2,0x68,0xF3,0x45,0xA2,0x43,0x59,0x81,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xE2,0x40,0xA4,0x79,0xC7,0xCA,0x68,0xF3,0x23,0x51,0x02,0x49,0x68,0xF3,0x61,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xA2,0xA6,0xBA,0x20,0x08,0xA6,0xC2,0x48,0xEB,0x05,0x92,0x23,0x51,0x81,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xE2,0x40,0xA4,0x71,0xC7,0xCA,0x68,0xF3,0x02,0x49,0x00,0x00,
-	0x00,0x00,0x02,0x49,0x45,0xA2,0x28,0xE3,0x89,0xFB,0x89,0xFB,0x48,0xEB,0x07,0xDB,0xE7,0xCA,0x07,0xDB,0x28,0xE3,0x68,0xF3,0x89,0xFB,0x68,0xF3,0xA7,0xC2,0xA4,0x71,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x30,0x00,0x00,0x00,0x00,0x20,0x08,0xA1,0x28,0xE2,0x40,0x23,0x51,0x23,0x51,0x22,0x51,0xE2,0x40,0xA1,0x30,0x61,0x18,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x22,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xF3,0x45,0xA2,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x18,0xA6,0xC2,0xC7,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x30,0x08,0xDB,0x28,0xEB,0xC4,0x81,0xC2,0x30,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x02,0x49,0x05,0x9A,0x68,0xF3,0xA6,0xBA,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x84,0x69,0xC7,0xCA,0x89,0xFB,0x89,0xFB,0x48,0xEB,0x07,0xDB,0x08,0xE3,0x48,0xF3,0x89,0xFB,0x68,0xF3,0x66,0xB2,0x02,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC2,0x38,0x23,0x51,0x43,0x61,0x23,0x51,0x02,0x49,0x81,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0xB2,0x43,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x66,0xB2,
-	0x43,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x59,0x68,0xF3,0x86,0xBA,0x43,0x59,0x81,0x20,0x40,0x10,0x40,0x18,0xC2,0x38,0xC4,0x79,0x28,0xE3,0xC7,0xCA,0x61,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0x05,0x92,0x28,0xE3,0x89,0xFB,
-	0x89,0xFB,0x89,0xFB,0x69,0xFB,0xA6,0xBA,0x43,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x20,0x08,0x61,0x20,0x40,0x18,0x00,0x00,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x38,0x68,0xF3,0x84,0x71,0x81,0x20,0xA1,0x30,0x05,0x92,0x68,0xF3,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x59,0xE7,0xD2,0x89,0xFB,0x89,0xFB,0xA7,0xC2,0xC2,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_51_149458_data_0, "face_1167_dial_img_51_149458_data_0.bin");
         
 
 
@@ -41,7 +21,7 @@ const lv_img_dsc_t face_1167_dial_img_51_149458_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 19,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_51_149458_data_0),
+    .data_size = 1026,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_51_149458_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,31 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_53_150589_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x28,0x89,0xFB,0xE4,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x18,0x86,0xB2,0x43,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x30,0xA4,0x71,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x40,0xC2,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xA2,0x89,0xFB,0xC2,0x30,0x00,0x00,0x00,0x00,0x02,0x49,0x05,0x92,0x66,0xAA,0x45,0xA2,0x63,0x69,0x40,0x10,0x00,0x00,0x20,0x08,0x28,0xE3,0x48,0xEB,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x20,
-	0x02,0x51,0x00,0x00,0xA1,0x30,0xC7,0xC2,0x68,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x08,0xE3,0x84,0x69,0x00,0x00,0x63,0x61,0x63,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x30,0x28,0xE3,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,
-	0x89,0xFB,0x89,0xFB,0xA4,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE7,0xCA,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0xE2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x61,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x66,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x18,0x00,0x00,0x00,0x00,0x86,0xB2,0x89,0xFB,0x89,0xFB,0x89,0xFB,
-	0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x68,0xFB,0x81,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x40,0x48,0xEB,0x43,0x59,0x20,0x08,0x07,0xDB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,
-	0xC1,0x30,0xA1,0x30,0x28,0xE3,0x23,0x51,0x00,0x00,0x00,0x00,0xA1,0x30,0x07,0xDB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0xC1,0x30,0xC1,0x30,0x28,0xE3,0x23,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x18,0x66,0xB2,
-	0x86,0xB2,0x66,0xAA,0x66,0xAA,0x66,0xAA,0x25,0x9A,0xE4,0x81,0xE4,0x81,0xE4,0x81,0xE4,0x81,0xE4,0x81,0xE4,0x81,0xE4,0x81,0xE4,0x81,0xA4,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x43,0x59,0x43,0x59,0x43,0x59,0x43,0x59,
-	0x43,0x59,0x43,0x59,0x43,0x59,0x43,0x59,0x43,0x61,0xA4,0x79,0xC4,0x81,0xC4,0x81,0xC4,0x81,0xC4,0x81,0x43,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x81,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,
-	0x89,0xFB,0x48,0xEB,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x81,0x20,0xC2,0x38,0xC2,0x38,0xC2,0x38,0xC2,0x38,0xC2,0x38,0xC2,0x38,0xC2,0x38,0xC2,0x38,0xA1,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x81,0x20,0x61,0x18,0x68,0xF3,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,
-	0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0x89,0xFB,0xC2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x18,0x08,0xE3,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,0x69,0xFB,
-	0x02,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_53_150589_data_0, "face_1167_dial_img_53_150589_data_0.bin");
         
 
 
@@ -44,7 +21,7 @@ const lv_img_dsc_t face_1167_dial_img_53_150589_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 23,
     .header.h = 17,
-    .data_size = sizeof(face_1167_dial_img_53_150589_data_0),
+    .data_size = 1173,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_53_150589_data_0};
 
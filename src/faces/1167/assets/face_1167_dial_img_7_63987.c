@@ -5,6 +5,7 @@
 // Watchface: 1167
 
 #include "../1167.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,22 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0x65,0x29,0x65,0x29,0x45,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0xC7,0x39,0xE7,0x39,0xC7,0x39,0x41,0x08,0x00,0x00,0x61,0x08,0xC7,0x39,0xE7,0x39,0xC7,0x39,0x00,0x00,0xA2,0x10,0x8A,0x52,0x8A,0x52,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x8A,0x52,
-	0x8A,0x52,0x20,0x00,0x24,0x21,0x2C,0x63,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0x24,0x21,0x65,0x29,0xEF,0x7B,0xEF,0x7B,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xEF,0x7B,0xEF,0x7B,0x65,0x29,0xC7,0x39,0xB2,0x94,0xB2,0x94,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,
-	0xB2,0x94,0xB2,0x94,0xC7,0x39,0x08,0x42,0x34,0xA5,0x34,0xA5,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x34,0xA5,0x34,0xA5,0x08,0x42,0x28,0x42,0xB6,0xB5,0xB6,0xB5,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xB6,0xB5,0xB6,0xB5,0x28,0x42,0x69,0x4A,0x38,0xC6,0x38,0xC6,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x69,0x4A,0x38,0xC6,0x38,0xC6,0x69,0x4A,0xAA,0x52,0xBA,0xD6,0xBA,0xD6,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xBA,0xD6,0xBA,0xD6,0xAA,0x52,0x49,0x4A,0x1C,0xE7,0x1C,0xE7,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0x1C,0xE7,0x1C,0xE7,0xE3,0x18,0x00,0x00,0x7D,0xEF,0x7D,0xEF,0xDB,0xDE,0x04,0x21,0x00,0x00,
-	0xC7,0x39,0x3C,0xE7,0x7D,0xEF,0x3C,0xE7,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0x79,0xCE,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x00,0x00,0x00,0x00,0x24,0x21,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0x14,0xA5,
-	0xBA,0xD6,0x14,0xA5,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_0, "face_1167_dial_img_7_63987_data_0.bin");
         
 
 
@@ -35,28 +21,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_0),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xE7,0x39,0xC7,0x39,0xE7,0x39,0xE7,0x39,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x28,0x42,0x20,0x00,0x8A,0x52,0x8A,0x52,0x86,0x31,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x41,0x08,0x00,0x00,0x2C,0x63,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xEF,0x7B,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0xEB,0x5A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0x34,0xA5,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xB6,0xB5,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0x38,0xC6,
-	0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xBA,0xD6,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0x1C,0xE7,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,
-	0x7D,0xEF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xBE,0xF7,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x14,0xA5,0x14,0xA5,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_1, "face_1167_dial_img_7_63987_data_1.bin");
         
 
 
@@ -64,28 +35,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_1),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0x65,0x29,0x65,0x29,0x45,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0xC7,0x39,0xE7,0x39,0xC7,0x39,0x41,0x08,0x00,0x00,0x41,0x08,0xC7,0x39,0xE7,0x39,0xE7,0x39,0x00,0x00,0x00,0x00,0x8A,0x52,0x8A,0x52,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x8A,0x52,
-	0x8A,0x52,0xE3,0x18,0x00,0x00,0x24,0x21,0x24,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x2C,0x63,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xEF,0x7B,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0xB2,0x94,
-	0xB2,0x94,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x34,0xA5,0x34,0xA5,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xB6,0xB5,0xB6,0xB5,0x34,0xA5,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xF7,0xBD,0x38,0xC6,0xF7,0xBD,
-	0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xD7,0xBD,0xBA,0xD6,0xBA,0xD6,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0x1C,0xE7,0x1C,0xE7,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0x7D,0xEF,0x7D,0xEF,0xD7,0xBD,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xDB,0xDE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x8A,0x52,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x14,0xA5,
-	0x14,0xA5,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x14,0xA5,0xE7,0x39,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_2, "face_1167_dial_img_7_63987_data_2.bin");
         
 
 
@@ -93,28 +49,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_2),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x24,0x21,0x65,0x29,0x65,0x29,0x65,0x29,0x24,0x21,0x65,0x29,0x65,0x29,0x65,0x29,0x82,0x10,0x00,0x00,0x61,0x08,0xE7,0x39,0xE7,0x39,0x86,0x31,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x39,0xE7,0x39,0xC7,0x39,0x00,0x00,0x24,0x21,0x8A,0x52,0x8A,0x52,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x8A,0x52,
-	0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x2C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xEF,0x7B,0xEF,0x7B,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x51,0x8C,0xB2,0x94,0xB2,0x94,
-	0x71,0x8C,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x30,0x84,0x75,0xAD,0xB6,0xB5,0xB6,0xB5,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x75,0xAD,0x38,0xC6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xBA,0xD6,0xBA,0xD6,0x28,0x42,0x92,0x94,0x1C,0xE7,0x1C,0xE7,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0x1C,0xE7,0x1C,0xE7,0xCB,0x5A,0x51,0x8C,0x7D,0xEF,0x7D,0xEF,0xD3,0x9C,0x00,0x00,0x00,0x00,
-	0x04,0x21,0xDB,0xDE,0x7D,0xEF,0x7D,0xEF,0x04,0x21,0xE7,0x39,0x7D,0xEF,0xBE,0xF7,0xBE,0xF7,0x1C,0xE7,0x79,0xCE,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0x18,0xC6,0x00,0x00,0x00,0x00,0x30,0x84,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xB2,0x94,0xF7,0xBD,
-	0xBA,0xD6,0x96,0xB5,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_3, "face_1167_dial_img_7_63987_data_3.bin");
         
 
 
@@ -122,28 +63,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_3),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x04,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x65,0x29,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xE7,0x39,0xE7,0x39,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x8A,0x52,0x8A,0x52,0xC7,0x39,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0x2C,0x63,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xEF,0x7B,0xEF,0x7B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0xB2,0x94,0xB2,0x94,0xC7,0x39,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x34,0xA5,0x34,0xA5,0x51,0x8C,0x00,0x00,0xAA,0x52,0x51,0x8C,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xB6,0xB5,0xB6,0xB5,0x28,0x42,0x00,0x00,0x8E,0x73,0xB6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,0x65,0x29,0x38,0xC6,0x38,0xC6,0x34,0xA5,0x00,0x00,0x00,0x00,0xEF,0x7B,
-	0x38,0xC6,0x38,0xC6,0x00,0x00,0x00,0x00,0xF3,0x9C,0xBA,0xD6,0xBA,0xD6,0x30,0x84,0xAA,0x52,0xAA,0x52,0xF3,0x9C,0xBA,0xD6,0xBA,0xD6,0xAA,0x52,0x28,0x42,0xD7,0xBD,0x1C,0xE7,0x1C,0xE7,0x1C,0xE7,0x1C,0xE7,0x1C,0xE7,0x1C,0xE7,0x1C,0xE7,0x1C,0xE7,0x1C,0xE7,0xD7,0xBD,0x38,0xC6,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,
-	0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x38,0xC6,0x8A,0x52,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0xB6,0xB5,0xBE,0xF7,0xBE,0xF7,0x0C,0x63,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x2C,0x63,0x14,0xA5,0x14,0xA5,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_4, "face_1167_dial_img_7_63987_data_4.bin");
         
 
 
@@ -151,28 +77,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_4),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,
-	0x00,0x00,0x00,0x00,0x24,0x21,0x65,0x29,0x45,0x29,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x86,0x31,0xE7,0x39,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x8A,0x52,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x2C,0x63,0xE7,0x39,0x00,0x00,0xE3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xEF,0x7B,0x6D,0x6B,0xCF,0x7B,0xEF,0x7B,0xEF,0x7B,0xCF,0x7B,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,
-	0xB2,0x94,0x69,0x4A,0x00,0x00,0x00,0x00,0x51,0x8C,0x34,0xA5,0x34,0xA5,0x49,0x4A,0x24,0x21,0x4D,0x6B,0xF3,0x9C,0x34,0xA5,0xD3,0x9C,0x00,0x00,0x00,0x00,0xEB,0x5A,0x8E,0x73,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xB6,0xB5,0xB6,0xB5,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x69,0x4A,0x38,0xC6,0x38,0xC6,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xBA,0xD6,0xBA,0xD6,0xAA,0x52,0x00,0x00,0xD7,0xBD,0xD7,0xBD,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x1C,0xE7,0x1C,0xE7,0x49,0x4A,0x00,0x00,0x3C,0xE7,0x7D,0xEF,0x9A,0xD6,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0x7D,0xEF,0x7D,0xEF,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0x1C,0xE7,0x18,0xC6,0x7D,0xEF,0xBE,0xF7,0xBE,0xF7,0xF3,0x9C,0x00,0x00,0x00,0x00,0x24,0x21,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0x14,0xA5,
-	0x59,0xCE,0x14,0xA5,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_5, "face_1167_dial_img_7_63987_data_5.bin");
         
 
 
@@ -180,28 +91,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_5),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0x65,0x29,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xE7,0x39,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x8A,0x52,0x8A,0x52,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x0C,0x63,0x2C,0x63,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xEF,0x7B,0xEF,0x7B,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xB2,0x94,0xB2,0x94,0x51,0x8C,0x71,0x8C,0xAE,0x73,
-	0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xF3,0x9C,0x86,0x31,0x00,0x00,0x00,0x00,0xF3,0x9C,0xB6,0xB5,0xB6,0xB5,0x30,0x84,0xEB,0x5A,0x71,0x8C,0xB6,0xB5,0xB6,0xB5,0x34,0xA5,0x00,0x00,0xC3,0x18,0x38,0xC6,0x38,0xC6,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xD3,0x9C,0x38,0xC6,0x38,0xC6,0x65,0x29,0xAA,0x52,0xBA,0xD6,0xBA,0xD6,0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0xBA,0xD6,0xBA,0xD6,0xAA,0x52,0xCB,0x5A,0x1C,0xE7,0x1C,0xE7,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0x1C,0xE7,0x1C,0xE7,0xCB,0x5A,0x04,0x21,0x7D,0xEF,0x7D,0xEF,0x9A,0xD6,0xC7,0x39,0x00,0x00,
-	0xC7,0x39,0xDB,0xDE,0x7D,0xEF,0x7D,0xEF,0x00,0x00,0x00,0x00,0xB6,0xB5,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0x79,0xCE,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x00,0x00,0x00,0x00,0x24,0x21,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x96,0xB5,
-	0xBA,0xD6,0x14,0xA5,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_6, "face_1167_dial_img_7_63987_data_6.bin");
         
 
 
@@ -209,28 +105,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_6),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,
-	0x82,0x10,0x00,0x00,0x65,0x29,0x65,0x29,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x65,0x29,0x65,0x29,0xC3,0x18,0x00,0x00,0xE7,0x39,0xE7,0x39,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xE7,0x39,0xE7,0x39,0x61,0x08,0x00,0x00,0x8A,0x52,0x8A,0x52,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0x8A,0x52,
-	0x49,0x4A,0x00,0x00,0x00,0x00,0x24,0x21,0x24,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xEF,0x7B,0xEF,0x7B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xB2,0x94,0xB2,0x94,
-	0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0x34,0xA5,0x34,0xA5,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xB6,0xB5,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x38,0xC6,0x38,0xC6,
-	0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xBA,0xD6,0xBA,0xD6,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xDB,0xDE,0x1C,0xE7,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0x7D,0xEF,0x7D,0xEF,
-	0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xBE,0xF7,0x7D,0xEF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0x14,0xA5,0x14,0xA5,
-	0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_7, "face_1167_dial_img_7_63987_data_7.bin");
         
 
 
@@ -238,28 +119,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_7),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0x65,0x29,0x65,0x29,0x65,0x29,0x45,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0xE7,0x39,0xE7,0x39,0xC7,0x39,0x41,0x08,0x00,0x00,0x61,0x08,0xC7,0x39,0xE7,0x39,0xC7,0x39,0x00,0x00,0xE3,0x18,0x8A,0x52,0x8A,0x52,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x8A,0x52,
-	0x8A,0x52,0xE3,0x18,0x41,0x08,0x2C,0x63,0x2C,0x63,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x2C,0x63,0x2C,0x63,0x41,0x08,0x00,0x00,0x6D,0x6B,0xEF,0x7B,0xAE,0x73,0x24,0x21,0x00,0x00,0x24,0x21,0xCF,0x7B,0xEF,0x7B,0x6D,0x6B,0x00,0x00,0x00,0x00,0x65,0x29,0x71,0x8C,0xB2,0x94,0xB2,0x94,0x51,0x8C,0xB2,0x94,0xB2,0x94,
-	0x71,0x8C,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xB6,0xB5,0xB6,0xB5,0x34,0xA5,0x30,0x84,0x34,0xA5,0xB6,0xB5,0xB6,0xB5,0x30,0x84,0x00,0x00,0x65,0x29,0x38,0xC6,0x38,0xC6,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xD3,0x9C,0x38,0xC6,0x38,0xC6,0xC3,0x18,0x6D,0x6B,0xBA,0xD6,0xBA,0xD6,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xBA,0xD6,0xBA,0xD6,0x6D,0x6B,0x92,0x94,0x1C,0xE7,0x1C,0xE7,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0x1C,0xE7,0x1C,0xE7,0x92,0x94,0x6D,0x6B,0x7D,0xEF,0x7D,0xEF,0x38,0xC6,0x04,0x21,0x00,0x00,
-	0x04,0x21,0x38,0xC6,0x7D,0xEF,0x7D,0xEF,0x69,0x4A,0x00,0x00,0xDB,0xDE,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0x79,0xCE,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xDB,0xDE,0x00,0x00,0x00,0x00,0xAA,0x52,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x96,0xB5,
-	0xBA,0xD6,0x14,0xA5,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_8, "face_1167_dial_img_7_63987_data_8.bin");
         
 
 
@@ -267,28 +133,13 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_8),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1167_dial_img_7_63987_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0x65,0x29,0x65,0x29,0x65,0x29,0x45,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0xE7,0x39,0xE7,0x39,0xC7,0x39,0x61,0x08,0x00,0x00,0x82,0x10,0xC7,0x39,0xE7,0x39,0xE7,0x39,0x00,0x00,0xE3,0x18,0x8A,0x52,0x8A,0x52,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x8A,0x52,
-	0x8A,0x52,0xE3,0x18,0x24,0x21,0x2C,0x63,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x2C,0x63,0x2C,0x63,0x24,0x21,0x24,0x21,0xEF,0x7B,0xEF,0x7B,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xEF,0x7B,0xEF,0x7B,0x00,0x00,0x00,0x00,0x51,0x8C,0xB2,0x94,0x71,0x8C,0x2C,0x63,0xC7,0x39,0x6D,0x6B,0xB2,0x94,
-	0xB2,0x94,0x10,0x84,0x00,0x00,0x00,0x00,0x49,0x4A,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xF3,0x9C,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x75,0xAD,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x38,0xC6,
-	0x38,0xC6,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xBA,0xD6,0x79,0xCE,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x1C,0xE7,0x1C,0xE7,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0x7D,0xEF,
-	0x3C,0xE7,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xBE,0xF7,0xBE,0xF7,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0x14,0xA5,
-	0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_1167_dial_img_7_63987_data_9, "face_1167_dial_img_7_63987_data_9.bin");
         
 
 
@@ -296,7 +147,7 @@ const lv_img_dsc_t face_1167_dial_img_7_63987_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 11,
     .header.h = 18,
-    .data_size = sizeof(face_1167_dial_img_7_63987_data_9),
+    .data_size = 594,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1167_dial_img_7_63987_data_9};
 
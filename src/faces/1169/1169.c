@@ -141,9 +141,10 @@ void init_face_1169(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_1169_6_129032, 194);
     lv_obj_add_flag(face_1169_6_129032, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_1169_6_129032, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_1169_0_144);
 
 
-    callback("1169", &face_1169_dial_img_preview_0, &face_1169, NULL);
+    callback("1169", NULL, &face_1169, NULL);
 
 #endif
 }
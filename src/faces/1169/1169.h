@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_1169 // (1169) uncomment to enable or define it elsewhere
 
@@ -59,8 +60,6 @@ extern "C"
 	LV_IMG_DECLARE(face_1169_dial_img_4_74398_7);
 	LV_IMG_DECLARE(face_1169_dial_img_4_74398_8);
 	LV_IMG_DECLARE(face_1169_dial_img_4_74398_9);
-	LV_IMG_DECLARE(face_1169_dial_img_preview_0);
-	LV_IMG_DECLARE(face_1169_dial_img_preview_0);
 
 
 #endif
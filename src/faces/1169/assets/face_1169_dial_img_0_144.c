@@ -5,6 +5,7 @@
 // Watchface: 1169
 
 #include "../1169.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,2173 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_0_144_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,0xC3,0x20,0x86,0x39,0x86,0x39,
-	0x82,0x18,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x00,0x08,0x00,0x08,0x45,0x29,0x69,0x42,0xE4,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xC3,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,0x55,0xAD,0x10,0x84,0x45,0x29,0xC7,0x39,0x25,0x29,0xC3,0x20,0x82,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x08,0x41,0x10,0x00,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0x45,0x31,0x62,0x10,0x21,0x08,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,0x2D,0x6B,0xC7,0x39,0x00,0x00,0x00,0x00,
-	0x21,0x08,0x41,0x10,0x21,0x08,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x04,0x21,0xC3,0x20,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x25,0x29,
-	0x66,0x31,0x04,0x29,0x04,0x29,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x04,0x29,0xE8,0x39,0xC3,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xA3,0x18,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x86,0x31,0x29,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x82,0x18,0x66,0x31,0x86,0x31,0x04,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x18,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x82,0x10,0x82,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x62,0x10,0x21,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x00,0x00,0xAF,0x7B,0x7A,0xD6,0x7A,0xD6,0x2D,0x6B,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0xA3,0x18,0xC3,0x18,0x62,0x10,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x18,0x01,0x08,0x82,0x10,0x04,0x29,0x42,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x45,0x29,0x6A,0x4A,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x62,0x10,0x21,0x08,0x42,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x00,0x41,0x00,0x62,0x00,0x00,0x00,0x25,0x19,0xAF,0x7B,0x92,0x9C,0xF0,0x83,0x6A,0x52,0xE8,0x39,0x41,0x08,0x00,0x00,0x00,0x00,0x01,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x62,0x10,0x62,0x10,0xC3,0x18,0x49,0x4A,0x92,0x8C,0x92,0x9C,0x0C,0x6B,0x08,0x42,0xC7,0x39,0xCB,0x5A,0xAB,0x52,0x62,0x10,0xB3,0x8C,
-	0x5D,0xEF,0x6E,0x73,0x41,0x10,0x00,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x04,0x21,0x45,0x29,0xA7,0x31,0xCB,0x5A,0x86,0x31,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x21,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x45,0x29,0x21,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x62,0x10,0x62,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x62,0x10,0xE4,0x20,0x21,0x08,0x41,0x10,0x41,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x41,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x41,0x00,0x62,0x08,0x62,0x18,0x42,0x30,0x42,0x48,0x42,0x48,0x82,0x38,0x92,0x8C,0x5D,0xEF,0x59,0xD6,0x14,0xAD,0xEF,0x8B,0x08,0x52,0x45,0x31,0xC3,0x20,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x10,0x21,0x08,0xA7,0x39,0x66,0x31,0xC3,0x18,0x69,0x42,0x6A,0x4A,0xA3,0x18,0xC7,0x39,0xCB,0x5A,0xE4,0x18,0xA3,0x10,0x62,0x08,0xC7,0x39,0xA7,0x29,0x00,0x00,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x42,0x10,0xA7,0x39,0x86,0x31,0x45,0x29,0xA3,0x18,
-	0x21,0x08,0x62,0x10,0x82,0x18,0x62,0x10,0x04,0x21,0xE4,0x20,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x10,0x62,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x10,0x41,0x08,0x00,0x08,0x82,0x18,0x21,0x08,0x41,0x10,0x04,0x29,0x04,0x29,0x86,0x39,0xC7,0x41,0x6A,0x62,0xEC,0x62,
-	0x04,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x41,0x08,0x41,0x10,0x49,0x52,0x6A,0x62,0x6A,0x52,0xAB,0x5A,0xA3,0x18,0x00,0x00,0x21,0x08,
-	0x00,0x08,0xE8,0x41,0xAB,0x5A,0x28,0x52,0x08,0x52,0x66,0x31,0x04,0x29,0x41,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x29,0x6A,0x52,0x00,0x00,0x61,0x00,0x42,0x30,0x42,0x60,0x42,0x60,0x42,0x60,0x42,0x60,0x42,0x48,0x42,0x60,0x42,0x60,0x21,0x70,0x21,0x70,0x21,0x88,
-	0x42,0x98,0x84,0xC8,0x84,0xC8,0x23,0xD0,0x02,0xD8,0x21,0x88,0x00,0x00,0x51,0x84,0x39,0xC6,0x18,0xCE,0x59,0xCE,0x39,0xCE,0x59,0xD6,0x18,0xCE,0x30,0x8C,0x6A,0x52,0xF0,0x83,0xEC,0x62,0x00,0x00,0x00,0x00,0xE4,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x08,0xA7,0x31,0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x00,
-	0x00,0x00,0x21,0x08,0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0xA3,0x18,0x04,0x21,0xE4,0x20,0x82,0x10,0xC3,0x18,0xA3,0x18,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x62,0x10,0x41,0x10,0x61,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x25,0x29,0x62,0x10,0x86,0x39,0x39,0xCE,0x18,0xC6,0xF8,0xC5,0x18,0xCE,0x7A,0xD6,0x5D,0xEF,0xCB,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0x00,0x08,0xC3,0x20,0x18,0xCE,0xDB,0xE6,0xBB,0xDE,0x5D,0xEF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0xB5,0xDB,0xE6,0x18,0xCE,0x39,0xCE,0xD7,0xC5,0x18,0xCE,0xF0,0x83,0x00,0x00,0x21,0x08,0x00,0x00,0xA7,0x39,0xB2,0xA4,0x92,0x9C,0xB2,0xA4,0x51,0x94,
-	0x62,0x10,0x04,0x29,0xA7,0x39,0x00,0x00,0x41,0x08,0x01,0xA0,0x02,0xD8,0x01,0xC8,0x02,0xD8,0x01,0xC8,0x02,0xD8,0x02,0xD8,0x01,0xC8,0x01,0xC8,0x02,0xD8,0x02,0xD8,0x23,0xD0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x02,0xD8,0x21,0x88,0x00,0x00,0xE8,0x39,0xDB,0xE6,0x18,0xC6,0xD3,0x9C,0xB3,0x8C,0xB3,0x8C,0x76,0xA5,0xBB,0xDE,0x1C,0xE7,
-	0x59,0xD6,0x18,0xCE,0x8E,0x83,0x4D,0x73,0x72,0x94,0xEC,0x62,0xC3,0x20,0xE8,0x41,0xC7,0x41,0x45,0x31,0xA7,0x39,0xCB,0x62,0x04,0x29,0x00,0x00,0x62,0x10,0x42,0x10,0x42,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x21,0x08,
-	0x82,0x10,0x62,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x42,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x82,0x10,0x49,0x52,0xBB,0xDE,0x18,0xC6,0xD7,0xBD,0xD7,0xBD,0xB7,0xBD,0xBB,0xDE,
-	0x49,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x29,0x21,0x08,0x42,0x10,0x76,0xAD,0x39,0xCE,0x76,0xAD,0xBB,0xDE,0x29,0x4A,0x00,0x00,0x00,0x00,
-	0xC3,0x20,0xB6,0xBD,0xF8,0xBD,0x96,0xB5,0xB7,0xBD,0x96,0xBD,0x7A,0xD6,0x14,0xA5,0x21,0x08,0xA3,0x18,0x00,0x00,0x6A,0x52,0x1C,0xE7,0x7A,0xD6,0xDB,0xE6,0x7A,0xD6,0x04,0x21,0x00,0x08,0x62,0x10,0x21,0x00,0x62,0x00,0x21,0x70,0x01,0xC8,0x00,0xB8,0x00,0xB8,0x01,0xC0,0x00,0xB8,0x00,0xB8,0x01,0xC8,0x01,0xC0,0x00,0xB8,0x02,0xA8,
-	0x00,0xB8,0x02,0xB8,0x00,0xB8,0x00,0xB8,0x23,0xC0,0x42,0x38,0x00,0x00,0x72,0x94,0x76,0xA5,0x4D,0x63,0xAF,0x7B,0xCB,0x62,0xE8,0x39,0x65,0x21,0x25,0x21,0xD0,0x73,0xBB,0xDE,0x39,0xCE,0x1C,0xE7,0x1C,0xE7,0xDB,0xE6,0x18,0xCE,0x55,0xB5,0xB7,0xBD,0xDB,0xE6,0x5D,0xEF,0xD7,0xC5,0xD7,0xC5,0x96,0xBD,0x62,0x10,0x00,0x00,0x41,0x10,
-	0x41,0x08,0x00,0x00,0x82,0x18,0xA3,0x18,0x62,0x10,0x21,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,
-	0x62,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x5A,0x59,0xD6,0xB7,0xBD,0xB7,0xBD,0xB7,0xB5,0x96,0xBD,0x7A,0xCE,0xEC,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0xA3,0x18,0x00,0x08,0x55,0xAD,0x39,0xC6,0x76,0xB5,0xBB,0xDE,0x08,0x42,0x00,0x00,0x00,0x00,0x66,0x31,0xF8,0xC5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x76,0xB5,0xF8,0xBD,0x14,0xAD,0x62,0x10,0x21,0x08,0x00,0x00,0xAB,0x5A,0x59,0xCE,0x55,0xAD,0xF8,0xC5,0xF4,0x9C,
-	0x41,0x08,0x00,0x00,0x61,0x10,0x62,0x18,0x41,0x00,0x42,0x60,0x01,0xC8,0x00,0xB8,0x00,0xB8,0x01,0xC8,0x42,0x60,0x21,0x28,0x01,0xA0,0x02,0xD8,0x21,0x88,0x42,0x48,0x23,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x00,0x28,0x25,0x19,0x35,0xAD,0xBB,0xDE,0xAB,0x5A,0x29,0x42,0xDB,0xE6,0x18,0xCE,0xB7,0xBD,0x55,0xB5,0x8E,0x83,0x86,0x39,
-	0x11,0x7C,0xF4,0x94,0x15,0x9D,0x15,0x9D,0x55,0xA5,0x96,0xBD,0xF8,0xC5,0x76,0xAD,0x6E,0x63,0xE7,0x31,0x6E,0x63,0x18,0xC6,0x7A,0xCE,0xB2,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xD7,0xC5,0x96,0xBD,0x35,0xAD,0xF4,0xA4,0xB2,0xA4,0x72,0x94,0x10,0x8C,0xAF,0x7B,0xCB,0x62,0x86,0x39,0xA2,0x20,0x21,0x08,0x00,0x00,0x00,0x00,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x08,0x42,0x59,0xD6,0xD7,0xBD,0xB7,0xB5,0xB7,0xBD,0x96,0xBD,0x7A,0xCE,
-	0xD0,0x73,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x08,0x42,0x29,0x42,0x00,0x00,0x8E,0x7B,0x39,0xC6,0x76,0xB5,0xBB,0xDE,0x29,0x4A,0x00,0x00,0x00,0x00,
-	0x49,0x52,0x39,0xCE,0x76,0xB5,0x76,0xB5,0x76,0xB5,0x96,0xB5,0xD7,0xBD,0xB7,0xBD,0xE4,0x20,0x00,0x00,0x00,0x00,0xCB,0x5A,0x39,0xCE,0x76,0xAD,0x59,0xD6,0x31,0x84,0x00,0x00,0x41,0x20,0x42,0x28,0xE4,0x38,0x82,0x08,0x01,0x98,0x01,0xC8,0x00,0xB8,0x01,0xC8,0x00,0xB8,0x82,0x38,0x62,0x18,0x21,0x70,0x02,0xD8,0x21,0x88,0x83,0x50,
-	0x23,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x00,0x08,0xA7,0x29,0xBB,0xDE,0xBB,0xDE,0xEC,0x62,0x0C,0x6B,0x59,0xCE,0x96,0xBD,0xB7,0xBD,0xF8,0xC5,0xDB,0xE6,0xEC,0x62,0x00,0x00,0x82,0x08,0x62,0x08,0x00,0x00,0x29,0x42,0xF8,0xC5,0x39,0xCE,0xB3,0x9C,0x00,0x00,0x00,0x00,0x29,0x42,0x39,0xC6,0xF8,0xBD,0x72,0x94,0x45,0x31,0xA3,0x18,
-	0x00,0x00,0x51,0x84,0xBB,0xDE,0xF8,0xBD,0xF8,0xC5,0x18,0xC6,0xDB,0xE6,0x1C,0xE7,0x1C,0xE7,0x1C,0xE7,0xDB,0xE6,0x39,0xCE,0x96,0xBD,0x34,0xB5,0xEB,0x72,0x62,0x10,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xE8,0x41,0x59,0xCE,0xF8,0xBD,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x59,0xCE,0x8A,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x29,0x86,0x31,0x00,0x00,0x45,0x31,0xF8,0xC5,0x96,0xB5,0x7A,0xCE,0xCB,0x62,0x00,0x00,0x00,0x00,0x31,0x8C,0x59,0xCE,0x96,0xB5,0x76,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xBD,0x59,0xD6,0xA7,0x39,0x00,0x00,0x00,0x00,0xF0,0x83,0x39,0xC6,0x55,0xB5,0x39,0xCE,0xE8,0x41,
-	0x00,0x00,0xA2,0x20,0xE4,0x38,0x83,0x50,0x62,0x00,0x21,0x88,0x01,0xC8,0x00,0xB8,0x00,0xB8,0x21,0x88,0x42,0x38,0x42,0x38,0x82,0x38,0x01,0xA0,0x00,0xB8,0x21,0x88,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x00,0x10,0x25,0x19,0x55,0xA5,0x59,0xD6,0xE8,0x41,0x8E,0x7B,0x39,0xCE,0x96,0xB5,0x96,0xB5,0x76,0xB5,0x39,0xCE,0xF0,0x83,
-	0x00,0x00,0x00,0x08,0x21,0x10,0x00,0x00,0x49,0x4A,0x59,0xC6,0xB7,0xB5,0x39,0xCE,0xEB,0x72,0x04,0x29,0x55,0xB5,0xF8,0xC5,0x96,0xBD,0x55,0xAD,0x59,0xD6,0x6E,0x73,0x00,0x00,0x0C,0x5B,0x59,0xCE,0x35,0xAD,0x96,0xB5,0xD7,0xBD,0x72,0x8C,0xD0,0x73,0x51,0x84,0xB3,0x8C,0xB3,0x8C,0xF4,0x94,0x59,0xC6,0x7A,0xD6,0xDB,0xE6,0x96,0xBD,
-	0xEF,0x8B,0x8A,0x5A,0x62,0x10,0x01,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x62,0x08,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x29,0x4A,0x7A,0xD6,0xD7,0xC5,0xB7,0xBD,0xB7,0xBD,0xB7,0xBD,0x59,0xCE,
-	0xAB,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x45,0x29,0x18,0xC6,0xF8,0xC5,0x59,0xCE,0xF0,0x7B,0x00,0x00,0x00,0x00,
-	0xB2,0xA4,0x39,0xC6,0x96,0xB5,0x96,0xAD,0x76,0xB5,0x76,0xB5,0x55,0xB5,0x59,0xD6,0xAB,0x5A,0x00,0x00,0x00,0x08,0xD3,0x9C,0x18,0xC6,0xF8,0xC5,0x14,0xA5,0x00,0x00,0x00,0x00,0xA2,0x20,0x42,0x30,0x62,0x18,0x41,0x00,0x01,0x98,0x01,0xC8,0x01,0xC0,0x01,0xC8,0x21,0x88,0x42,0x30,0x42,0x38,0x42,0x30,0x42,0x38,0x83,0x50,0xA3,0x90,
-	0x01,0xC0,0x01,0xC0,0x23,0xD0,0x22,0xA8,0x00,0x00,0x25,0x19,0xB7,0xAD,0x18,0xCE,0x45,0x31,0x92,0x94,0x59,0xCE,0x96,0xB5,0x96,0xBD,0x96,0xBD,0x18,0xCE,0xF4,0xAC,0x40,0x10,0x21,0x08,0x62,0x10,0x00,0x00,0x6E,0x73,0x59,0xCE,0x76,0xAD,0xB7,0xBD,0xF8,0xC5,0x14,0xA5,0x76,0xA5,0xD7,0xBD,0x76,0xB5,0xD7,0xBD,0xBB,0xDE,0x8A,0x5A,
-	0x00,0x00,0x55,0xA5,0xB7,0xBD,0x96,0xB5,0xF8,0xBD,0x76,0xB5,0x66,0x29,0x82,0x08,0x25,0x19,0xE4,0x18,0xA3,0x10,0x04,0x21,0xEC,0x4A,0x8A,0x4A,0x51,0x84,0x59,0xC6,0xDB,0xE6,0x1C,0xE7,0x29,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x42,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x42,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,
-	0x00,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x29,0x4A,0x7A,0xD6,0xD7,0xC5,0xB7,0xBD,0xB7,0xBD,0xB7,0xBD,0x59,0xCE,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0xA3,0x18,0x86,0x31,0x00,0x00,0x66,0x31,0xF8,0xBD,0xF4,0x9C,0xF8,0xC5,0x31,0x8C,0x00,0x00,0x00,0x00,0xB3,0x9C,0xF8,0xBD,0x96,0xB5,0x96,0xB5,0x96,0xBD,0x76,0xB5,0x55,0xAD,0x59,0xCE,0x0C,0x6B,0x00,0x00,0xE4,0x20,0x96,0xB5,0xD7,0xBD,0x39,0xCE,0xB3,0x9C,0x00,0x00,
-	0x00,0x00,0x62,0x18,0x42,0x60,0x82,0x38,0x41,0x00,0x42,0x98,0x01,0xC8,0x00,0xB8,0x02,0xB8,0x83,0x50,0x42,0x30,0x82,0x38,0x42,0x38,0x42,0x30,0x62,0x10,0x42,0x60,0x23,0xC0,0x01,0xC0,0x01,0xC8,0x42,0x98,0x21,0x00,0x00,0x00,0xF4,0xA4,0xB7,0xBD,0xC3,0x18,0xF4,0x9C,0x18,0xC6,0x96,0xBD,0x96,0xBD,0x96,0xB5,0xD7,0xBD,0xF8,0xC5,
-	0x83,0x39,0x00,0x00,0x61,0x10,0x00,0x00,0xD0,0x73,0x59,0xCE,0x76,0xB5,0xB7,0xB5,0x39,0xCE,0xC7,0x39,0x8A,0x4A,0x39,0xCE,0xB7,0xBD,0xB7,0xBD,0x18,0xCE,0xC7,0x41,0x00,0x00,0xF8,0xBD,0xD7,0xC5,0x96,0xB5,0x18,0xC6,0x35,0xAD,0xC3,0x20,0x62,0x10,0xE4,0x18,0x45,0x29,0x86,0x31,0x25,0x29,0xE4,0x18,0x82,0x08,0x04,0x21,0x66,0x21,
-	0xF4,0x94,0xD3,0x9C,0xE4,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x21,0x08,0x00,0x00,0x00,0x08,0x25,0x29,0x66,0x31,0xE4,0x18,0x82,0x38,0xE8,0x41,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x08,0x4A,0x59,0xD6,0xD7,0xBD,0xB7,0xBD,0x96,0xBD,0xB7,0xBD,0xF8,0xBD,
-	0x86,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x00,0x08,0x66,0x29,0x6A,0x4A,0x00,0x00,0x45,0x31,0xF4,0xA4,0xF4,0x9C,0x39,0xCE,0x92,0x94,0x00,0x00,0x00,0x00,
-	0xD3,0xA4,0xF8,0xBD,0x76,0xAD,0xB7,0xBD,0xF4,0x9C,0x76,0xB5,0x96,0xB5,0x59,0xD6,0x8A,0x5A,0x00,0x00,0x66,0x31,0xF8,0xC5,0xB7,0xBD,0x18,0xC6,0x92,0x94,0x00,0x00,0x00,0x08,0xA2,0x20,0x24,0x51,0x83,0x50,0x41,0x08,0x01,0xA0,0x01,0xC8,0x01,0xC8,0x01,0x98,0x42,0x38,0x42,0x38,0x82,0x38,0x42,0x38,0x42,0x48,0x42,0x30,0x42,0x30,
-	0x01,0xA0,0x01,0xC8,0x02,0xD8,0x42,0x98,0x21,0x00,0x00,0x00,0x55,0xAD,0x92,0x9C,0xA3,0x18,0x35,0xA5,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x59,0xD6,0x4D,0x73,0x00,0x00,0x21,0x08,0x00,0x08,0x51,0x84,0x39,0xCE,0x96,0xB5,0xD7,0xC5,0xD7,0xC5,0xA1,0x18,0x0C,0x5B,0x39,0xCE,0x76,0xB5,0x96,0xBD,0x18,0xC6,0xA7,0x39,
-	0x00,0x00,0xB3,0x94,0x39,0xC6,0x76,0xAD,0xF8,0xBD,0x34,0xB5,0x08,0x4A,0x86,0x39,0x66,0x31,0x45,0x29,0x66,0x29,0x66,0x29,0xE8,0x39,0x25,0x29,0xC3,0x18,0x00,0x00,0x6E,0x63,0x49,0x52,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x08,0xA7,0x39,0xAB,0x52,0xA7,0x31,
-	0x04,0x21,0x28,0x52,0x8A,0x4A,0xA7,0x31,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x00,0x00,0x49,0x52,0x7A,0xD6,0xD7,0xBD,0x76,0xB5,0x96,0xB5,0xF8,0xBD,0x18,0xC6,0x66,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0x41,0x08,0xC7,0x41,0xC3,0x18,0x21,0x08,0x14,0xAD,0x18,0xCE,0x18,0xC6,0xD3,0x9C,0x00,0x00,0x21,0x08,0x14,0xAD,0x18,0xC6,0x96,0xB5,0xD7,0xBD,0x92,0x94,0x55,0xAD,0x76,0xB5,0x7A,0xD6,0xAB,0x5A,0x00,0x00,0x29,0x4A,0x39,0xCE,0x96,0xBD,0x59,0xCE,0x31,0x84,0x00,0x00,
-	0xA3,0x18,0x24,0x51,0x83,0x50,0x82,0x38,0x42,0x30,0x02,0xB0,0x01,0xC0,0x01,0xC8,0x21,0x70,0x42,0x30,0x82,0x38,0x83,0x50,0x83,0x50,0x82,0x38,0x42,0x38,0x42,0x38,0x21,0x88,0x23,0xD0,0x01,0xC8,0x21,0x70,0x00,0x00,0x00,0x00,0xF8,0xC5,0xAF,0x7B,0x62,0x10,0x96,0xB5,0xD7,0xBD,0x96,0xBD,0x96,0xB5,0x96,0xB5,0x76,0xAD,0xF8,0xBD,
-	0x34,0xB5,0x00,0x10,0x00,0x00,0x00,0x00,0x55,0xAD,0x18,0xC6,0x76,0xB5,0x18,0xCE,0x55,0xB5,0x21,0x08,0x6E,0x73,0x59,0xCE,0x96,0xB5,0xD7,0xBD,0x18,0xC6,0x66,0x31,0x00,0x00,0x6E,0x63,0x59,0xCE,0x76,0xAD,0x96,0xB5,0xB7,0xBD,0xB7,0xBD,0xF8,0xC5,0x34,0xB5,0xA7,0x39,0xE4,0x20,0x66,0x29,0x66,0x29,0x45,0x29,0xA7,0x39,0xC3,0x20,
-	0xAF,0x7B,0x0C,0x6B,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x21,0x08,0x00,0x08,0x45,0x31,0x6E,0x73,0x8A,0x4A,0x62,0x10,0xE4,0x20,0xEC,0x5A,0xE7,0x31,0x82,0x08,0x00,0x00,0x00,0x00,0xA2,0x20,0xC7,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x28,0x52,0x7A,0xD6,0xD7,0xBD,0x96,0xB5,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,
-	0x45,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x08,0x42,0xC7,0x39,0x00,0x00,0x72,0x94,0x18,0xC6,0xB7,0xB5,0xB7,0xB5,0x62,0x10,0x62,0x10,
-	0x96,0xB5,0xD7,0xBD,0xD7,0xBD,0x14,0xA5,0xCB,0x5A,0x96,0xB5,0x55,0xAD,0x59,0xD6,0xAF,0x7B,0x00,0x00,0x8A,0x5A,0x7A,0xD6,0xB7,0xBD,0x7A,0xD6,0x0C,0x6B,0x00,0x00,0x86,0x39,0x24,0x51,0x42,0x60,0x41,0x10,0x42,0x10,0x01,0xC0,0x01,0xC8,0x01,0xC0,0x42,0x60,0xA2,0x20,0x42,0x38,0x82,0x38,0xE4,0x38,0x42,0x30,0x42,0x38,0xA2,0x20,
-	0x21,0x88,0x01,0xC8,0x23,0xD0,0x42,0x60,0x00,0x00,0xA7,0x39,0x1C,0xE7,0x6A,0x4A,0x41,0x08,0xB7,0xBD,0xD7,0xBD,0xD7,0xBD,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0xF8,0xC5,0x55,0xB5,0x4D,0x73,0xCB,0x62,0xD7,0xBD,0xB7,0xB5,0x76,0xB5,0x39,0xCE,0x72,0x94,0x00,0x00,0xB3,0x94,0xF8,0xBD,0x76,0xB5,0xF8,0xC5,0xD7,0xBD,0xE4,0x20,
-	0x00,0x00,0xAF,0x6B,0x39,0xC6,0xD7,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xB5,0x39,0xC6,0x14,0xAD,0x45,0x31,0xA3,0x10,0x66,0x29,0x65,0x21,0x51,0x84,0x18,0xCE,0x14,0xAD,0xF8,0xC5,0xEB,0x72,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x41,0x10,0x04,0x21,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x41,0x10,0x66,0x31,0x69,0x42,0xA7,0x29,0x00,0x00,0xA7,0x39,0x0C,0x5B,
-	0x25,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x62,0x10,0x84,0x69,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x08,0x4A,0x59,0xD6,0xD7,0xBD,0x96,0xBD,0xB7,0xBD,0x96,0xBD,0xF4,0x9C,0xE4,0x18,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x20,0x21,0x08,0x00,0x00,0x72,0x8C,0x59,0xCE,0x96,0xBD,0x59,0xCE,0x04,0x29,0xC3,0x18,0xB7,0xBD,0xB7,0xBD,0x18,0xCE,0x72,0x8C,0x86,0x31,0x96,0xBD,0x96,0xBD,0x39,0xC6,0x30,0x8C,0x00,0x00,0x2D,0x6B,0xBB,0xDE,0xB7,0xB5,0x59,0xCE,0xC7,0x39,0xC3,0x10,
-	0x10,0x8C,0x24,0x51,0xA3,0x90,0x83,0x50,0x21,0x28,0x01,0xC0,0x00,0xB8,0x01,0xC8,0x42,0x48,0xA2,0x20,0x82,0x38,0x83,0x50,0x83,0x50,0xE4,0x38,0x82,0x38,0x42,0x28,0x21,0x88,0x23,0xD0,0x02,0xD8,0x83,0x50,0x00,0x00,0x25,0x21,0x18,0xC6,0xE4,0x20,0xC3,0x18,0x18,0xC6,0xD7,0xBD,0x96,0xBD,0xB7,0xB5,0x76,0xB5,0x76,0xB5,0x96,0xBD,
-	0xF8,0xC5,0x76,0xB5,0xAF,0x6B,0xB7,0xB5,0xD7,0xC5,0x76,0xB5,0x76,0xB5,0x59,0xCE,0xF0,0x83,0xC3,0x18,0xD7,0xBD,0xD7,0xBD,0x35,0xAD,0xF8,0xC5,0x96,0xB5,0x00,0x08,0x42,0x10,0xB7,0xB5,0x96,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xB5,0x96,0xB5,0x18,0xC6,0x72,0x94,0x66,0x31,0x86,0x31,0xE7,0x31,0x25,0x19,0x92,0x8C,0x7A,0xD6,0x39,0xC6,
-	0x7A,0xD6,0xCB,0x62,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0xE8,0x41,0xE8,0x39,0x62,0x10,
-	0x21,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0x00,0x08,0x41,0x20,0x8E,0x7B,0x6A,0x4A,0x00,0x00,0x00,0x00,0x8A,0x5A,0x4D,0x63,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x8E,0x83,0xD0,0x73,0xC3,0x10,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x29,0x4A,0x59,0xD6,0x96,0xBD,0x76,0xB5,0x76,0xB5,0x18,0xCE,0xB7,0xB5,
-	0x82,0x10,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x00,0x08,0x62,0x10,0x6E,0x73,0x00,0x00,0x8A,0x5A,0x7A,0xCE,0x76,0xAD,0x59,0xCE,0x25,0x29,0xA7,0x39,
-	0x39,0xCE,0x96,0xB5,0x7A,0xCE,0xAF,0x7B,0xA3,0x18,0x96,0xBD,0xD7,0xBD,0xF8,0xC5,0x51,0x94,0x00,0x00,0x51,0x8C,0x39,0xC6,0xB7,0xBD,0xB7,0xBD,0xC3,0x18,0x00,0x00,0xE4,0x38,0x82,0x38,0xC4,0x70,0xE4,0x38,0x42,0x38,0x00,0xB8,0x01,0xC0,0x02,0xB8,0x42,0x38,0xE2,0x20,0x82,0x38,0xC4,0x70,0xC4,0x70,0x42,0x38,0x83,0x50,0x42,0x28,
-	0x21,0x88,0x02,0xD8,0x23,0xD0,0x42,0x30,0x00,0x00,0x8E,0x7B,0x14,0xAD,0x00,0x00,0xE8,0x39,0x39,0xC6,0x96,0xBD,0xB7,0xBD,0x96,0xBD,0x96,0xBD,0x96,0xAD,0x55,0xB5,0x59,0xCE,0xF0,0x83,0x00,0x00,0x4D,0x63,0x39,0xC6,0x76,0xB5,0x96,0xB5,0x59,0xCE,0x4D,0x73,0x25,0x21,0xD7,0xBD,0xB7,0xBD,0x76,0xB5,0x18,0xCE,0x35,0xAD,0x00,0x00,
-	0x4D,0x63,0x59,0xCE,0x96,0xBD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x59,0xCE,0xF0,0x83,0x82,0x18,0xE4,0x18,0xC3,0x18,0x25,0x19,0x15,0x9D,0x18,0xC6,0x96,0xB5,0x18,0xCE,0x28,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x04,0x29,0x29,0x42,0xE4,0x20,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x00,0x08,0x2D,0x6B,0x8A,0x4A,0x00,0x00,0x00,0x00,0xAB,0x5A,0x0C,0x5B,0x00,0x00,0x21,0x08,
-	0x00,0x00,0x82,0x38,0x51,0x94,0xEC,0x4A,0x00,0x00,0x00,0x00,0x41,0x10,0x62,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x49,0x52,0x7A,0xD6,0x96,0xBD,0x96,0xB5,0x96,0xBD,0x59,0xCE,0x35,0xAD,0x00,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x18,0xC6,0xCB,0x62,0xA7,0x39,0x7A,0xD6,0x96,0xB5,0x59,0xCE,0x66,0x31,0x08,0x42,0x59,0xD6,0x96,0xB5,0xBB,0xDE,0xCB,0x5A,0x00,0x00,0xB6,0xBD,0xD7,0xC5,0x18,0xC6,0xB3,0x9C,0x62,0x10,0xB3,0x9C,0xF8,0xC5,0x18,0xC6,0xD3,0xA4,0x00,0x00,0x62,0x10,
-	0x51,0x94,0xE7,0xA9,0x42,0x60,0x20,0x00,0x42,0x48,0x01,0xC8,0x01,0xC8,0x22,0xA8,0x42,0x38,0x82,0x38,0x42,0x38,0x66,0x89,0x24,0x51,0x42,0x30,0x42,0x48,0x82,0x38,0xA3,0x90,0x23,0xD0,0x23,0xD0,0x42,0x28,0x00,0x00,0x14,0xA5,0x35,0xAD,0x00,0x00,0x8A,0x52,0x59,0xD6,0x96,0xB5,0x96,0xB5,0xD7,0xBD,0xF8,0xC5,0x96,0xBD,0x55,0xB5,
-	0xF8,0xC5,0x55,0xB5,0x00,0x00,0xE8,0x39,0x59,0xCE,0x76,0xB5,0x96,0xB5,0xD7,0xC5,0x14,0xAD,0x31,0x8C,0xD7,0xBD,0xB7,0xB5,0x96,0xB5,0x39,0xCE,0x92,0x9C,0x00,0x00,0x72,0x8C,0x59,0xCE,0x76,0xAD,0xB7,0xB5,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0x39,0xCE,0x2D,0x6B,0xA3,0x10,0x66,0x31,0x25,0x29,0x04,0x21,0x15,0x9D,0x18,0xCE,0xB7,0xBD,
-	0xD7,0xC5,0xC3,0x20,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x04,0x21,0xC3,0x18,0x45,0x29,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x10,0x0C,0x5B,0xA7,0x31,0x00,0x00,0x00,0x00,0x86,0x39,0x6E,0x63,0x20,0x00,0x20,0x08,0x00,0x00,0xE4,0x38,0x15,0x9D,0x69,0x42,0x00,0x00,0x00,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x6A,0x52,0x7A,0xD6,0x96,0xBD,0xB7,0xBD,0xB7,0xBD,0x59,0xD6,0x92,0x94,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0xB2,0xA4,0x1C,0xE7,0xF8,0xC5,0xD7,0xBD,0x76,0xB5,0x7A,0xD6,0x6A,0x4A,0x49,0x52,
-	0xBB,0xDE,0x96,0xBD,0x7A,0xD6,0x29,0x42,0x00,0x00,0xF4,0xA4,0xF8,0xC5,0xF8,0xC5,0x14,0xA5,0x45,0x29,0x55,0xAD,0xF8,0xC5,0x18,0xC6,0x10,0x84,0x45,0x31,0x7A,0xD6,0xDB,0xD6,0xEB,0x72,0x41,0x20,0x61,0x00,0x21,0x88,0x01,0xC8,0x01,0xC8,0x21,0x88,0x82,0x38,0x42,0x30,0x82,0x38,0x83,0xA8,0x42,0x60,0x42,0x30,0x82,0x38,0x42,0x30,
-	0x42,0x98,0x02,0xD8,0x43,0xC0,0x00,0x08,0x41,0x00,0xD7,0xC5,0xB2,0xA4,0x00,0x00,0x4D,0x63,0x59,0xCE,0x96,0xBD,0xD7,0xBD,0x76,0xB5,0xD3,0x9C,0xF8,0xBD,0xB7,0xBD,0xB7,0xBD,0x39,0xCE,0x25,0x29,0x29,0x42,0x59,0xCE,0x96,0xB5,0x96,0xB5,0x18,0xC6,0x6E,0x73,0x0C,0x5B,0x39,0xC6,0x96,0xBD,0x55,0xB5,0x39,0xCE,0xF0,0x83,0x00,0x00,
-	0x6A,0x4A,0x18,0xC6,0xB7,0xBD,0x96,0xBD,0x96,0xBD,0x96,0xB5,0xB7,0xBD,0x18,0xCE,0x8A,0x5A,0xA3,0x18,0x45,0x31,0xA3,0x18,0xA7,0x29,0xD7,0xB5,0xF8,0xC5,0xD7,0xBD,0x96,0xBD,0x49,0x52,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x29,0x4A,0x86,0x31,0x66,0x31,0x66,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x00,0x00,0x6A,0x4A,0xCB,0x52,0x00,0x00,0x00,0x08,0xA3,0x18,0xEC,0x5A,0xA3,0x18,0x00,0x08,0x00,0x00,0xA2,0x20,
-	0x51,0x84,0xA7,0x29,0x00,0x00,0xA1,0x18,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xCB,0x62,0x7A,0xD6,0xB7,0xBD,0xD7,0xC5,0x96,0xBD,0x59,0xCE,0x10,0x84,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x41,0x10,0x30,0x8C,0xF4,0x94,0x76,0xA5,0xD7,0xBD,0x76,0xB5,0x59,0xCE,0x8A,0x52,0xAB,0x5A,0xBB,0xDE,0xD7,0xBD,0x18,0xC6,0xA3,0x18,0x00,0x00,0x92,0x9C,0x18,0xC6,0xD7,0xBD,0x14,0xA5,0x29,0x42,0xB6,0xBD,0xB7,0xBD,0x96,0xB5,0xD7,0xC5,0xBB,0xDE,0x1C,0xE7,
-	0x0C,0x5B,0x20,0x18,0x62,0x18,0x41,0x00,0x01,0x98,0x01,0xC8,0x01,0xC0,0x42,0x60,0x82,0x38,0xA2,0x20,0x42,0x60,0x22,0xA8,0x42,0x48,0x42,0x28,0x62,0x18,0xA3,0x18,0xA3,0x90,0x02,0xD8,0x22,0xA8,0x00,0x00,0x00,0x00,0x55,0xAD,0xF4,0xA4,0x00,0x00,0xAF,0x7B,0x39,0xCE,0x96,0xB5,0x18,0xC6,0xB3,0x9C,0x29,0x42,0x18,0xBE,0xD7,0xC5,
-	0x96,0xB5,0x59,0xCE,0x4D,0x73,0x6E,0x73,0x18,0xC6,0x76,0xB5,0xB7,0xBD,0x39,0xC6,0x66,0x31,0x29,0x42,0x59,0xCE,0x96,0xB5,0x76,0xAD,0x59,0xD6,0x2D,0x6B,0x00,0x00,0x29,0x4A,0x18,0xC6,0x96,0xB5,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0xD7,0xBD,0x18,0xCE,0x49,0x52,0x04,0x21,0x86,0x31,0xA3,0x18,0xE8,0x39,0x18,0xBE,0xD7,0xBD,0x76,0xB5,
-	0x39,0xC6,0x55,0xB5,0x41,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x42,0x10,0x62,0x08,0x41,0x10,0x42,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0xEC,0x5A,0x62,0x10,0xAB,0x5A,0x86,0x39,0x00,0x00,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x04,0x29,0x4D,0x63,0x41,0x08,0x00,0x08,0x00,0x00,0xA7,0x39,0xA7,0x31,0x00,0x00,0x00,0x00,0xA2,0x20,0x10,0x84,0xA7,0x29,0x00,0x00,0x45,0x31,0xA7,0x39,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x4D,0x73,0xBB,0xDE,0xD7,0xBD,0xF8,0xC5,0x96,0xBD,0xF8,0xC5,0x8E,0x7B,
-	0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA3,0x18,0x72,0x8C,0x08,0x42,0x00,0x00,0x31,0x8C,0x39,0xCE,0x39,0xCE,0x6E,0x73,0x4D,0x73,
-	0x59,0xCE,0xB7,0xBD,0xD7,0xBD,0xAF,0x7B,0x4D,0x73,0xB6,0xBD,0x96,0xB5,0xD7,0xBD,0x14,0xA5,0x8A,0x5A,0xB7,0xBD,0x96,0xB5,0xF8,0xC5,0x96,0xB5,0xF4,0x94,0x08,0x4A,0x00,0x00,0x00,0x28,0xE4,0x38,0x62,0x08,0x01,0x98,0x02,0xD8,0x01,0xA0,0xE4,0x38,0x82,0x38,0x42,0x30,0x42,0x60,0x21,0xA8,0x42,0x48,0x42,0x30,0x82,0x38,0x42,0x30,
-	0x21,0x88,0x02,0xD8,0x42,0x98,0x00,0x00,0x00,0x00,0x76,0xB5,0x92,0x9C,0x00,0x00,0x92,0x94,0x18,0xCE,0x96,0xB5,0x59,0xCE,0x31,0x8C,0x21,0x08,0x55,0xAD,0x39,0xC6,0x96,0xB5,0xD7,0xBD,0x55,0xB5,0x14,0xA5,0x96,0xBD,0x96,0xB5,0xD7,0xC5,0x18,0xC6,0xC3,0x20,0x8A,0x52,0x59,0xCE,0xB7,0xBD,0x96,0xB5,0x7A,0xCE,0xAB,0x5A,0x00,0x00,
-	0xD0,0x73,0x18,0xCE,0x96,0xB5,0xB7,0xBD,0xB7,0xB5,0xB7,0xB5,0xF8,0xBD,0x76,0xB5,0x86,0x39,0xE4,0x20,0x66,0x29,0xE4,0x20,0xAB,0x52,0x39,0xCE,0x96,0xBD,0x96,0xB5,0x59,0xD6,0x4D,0x73,0x00,0x00,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x10,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x04,0x29,0x82,0x18,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x45,0x29,0x00,0x00,0xEC,0x62,0xC7,0x41,0x82,0x10,0x00,0x08,0x00,0x08,0x62,0x10,0x41,0x08,0x20,0x08,0x86,0x31,0x66,0x29,0x00,0x00,0x62,0x10,0x41,0x10,0x82,0x18,0x41,0x10,0x00,0x00,0x00,0x08,0xF0,0x83,0x69,0x42,
-	0x00,0x00,0xE4,0x20,0xAB,0x52,0x62,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x6E,0x73,0x7A,0xD6,0xD7,0xC5,0xD7,0xBD,0x96,0xB5,0xD7,0xC5,0x8E,0x7B,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x21,0x08,0x00,0x00,0x10,0x84,0xB3,0x94,0x00,0x00,0xCB,0x5A,0x59,0xCE,0xB7,0xBD,0x55,0xAD,0x35,0xAD,0x96,0xBD,0xD7,0xBD,0x51,0x8C,0xE8,0x41,0x6A,0x4A,0xAF,0x7B,0xF8,0xC5,0x96,0xB5,0x35,0xA5,0x30,0x8C,0xB7,0xBD,0x18,0xC6,0x14,0xA5,0x82,0x10,0xA7,0x39,0x41,0x08,
-	0x00,0x00,0x21,0x70,0x42,0x48,0x62,0x18,0x00,0xA8,0x02,0xD8,0x21,0x70,0x42,0x28,0x42,0x38,0x42,0x30,0x42,0x98,0x01,0xC0,0x42,0x48,0x42,0x30,0x83,0x50,0x82,0x38,0x21,0x70,0x02,0xD8,0x21,0x88,0x00,0x00,0x00,0x00,0xB7,0xBD,0x92,0x9C,0x00,0x00,0x35,0xA5,0x18,0xC6,0x96,0xB5,0x59,0xCE,0x51,0x94,0x00,0x00,0x31,0x84,0x7A,0xCE,
-	0x96,0xB5,0x96,0xB5,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xF8,0xBD,0xD7,0xC5,0x41,0x10,0x4D,0x63,0x59,0xCE,0xB7,0xBD,0xB7,0xB5,0x59,0xD6,0x28,0x52,0x00,0x00,0xD0,0x73,0x39,0xC6,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xB5,0xF8,0xC5,0x14,0xAD,0x45,0x31,0x04,0x29,0x45,0x31,0xA3,0x10,0x6E,0x63,0x59,0xCE,0x55,0xB5,0xD7,0xBD,
-	0x18,0xCE,0x86,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x00,0x08,0xA7,0x39,0x25,0x29,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x08,0x4A,0xA7,0x39,0x00,0x00,0x49,0x4A,0x86,0x39,0xA3,0x18,
-	0x28,0x52,0x42,0x10,0x00,0x00,0x21,0x08,0x62,0x10,0x45,0x29,0x21,0x08,0x21,0x08,0x62,0x10,0x41,0x08,0x21,0x08,0x41,0x08,0x00,0x00,0xEC,0x62,0x6E,0x63,0x00,0x00,0x41,0x10,0xCB,0x5A,0x04,0x21,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x00,0x00,0xAF,0x7B,0x7A,0xD6,0xD7,0xC5,0xB7,0xBD,0x76,0xB5,0x18,0xCE,0xAF,0x6B,
-	0x00,0x00,0x42,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xCB,0x62,0xE8,0x41,0x00,0x00,0xC7,0x39,0x18,0xC6,0x96,0xBD,0xB7,0xBD,0xB7,0xBD,
-	0x76,0xB5,0x39,0xCE,0x6E,0x63,0x00,0x00,0x00,0x00,0xAB,0x5A,0xBB,0xDE,0x55,0xAD,0x76,0xB5,0xB7,0xBD,0x76,0xB5,0x7A,0xD6,0x31,0x8C,0x00,0x00,0xAB,0x5A,0x66,0x29,0x00,0x00,0xC4,0x70,0x41,0x20,0x42,0x28,0x01,0xC0,0x01,0xC0,0x83,0x50,0x42,0x30,0x42,0x30,0x42,0x28,0xA3,0x90,0x83,0xA8,0x42,0x38,0x82,0x38,0xA2,0x20,0xA2,0x20,
-	0x21,0x70,0x02,0xD8,0x42,0x60,0x00,0x00,0x41,0x08,0xF8,0xC5,0x31,0x8C,0x20,0x08,0x96,0xB5,0x18,0xC6,0x96,0xB5,0x39,0xCE,0x72,0x94,0x00,0x00,0x8A,0x4A,0x7A,0xCE,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0x96,0xBD,0x96,0xB5,0xB7,0xBD,0x18,0xC6,0x55,0xB5,0x21,0x08,0x72,0x8C,0x59,0xCE,0x76,0xB5,0xB7,0xB5,0x18,0xCE,0x66,0x31,0x00,0x00,
-	0xE8,0x39,0xF8,0xBD,0x96,0xB5,0x76,0xB5,0x96,0xB5,0xB7,0xBD,0x18,0xCE,0x72,0x94,0xA3,0x18,0x45,0x29,0x66,0x29,0xC3,0x18,0xF0,0x7B,0x39,0xCE,0x96,0xB5,0xD7,0xBD,0xF8,0xC5,0x66,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,0x00,0x00,0x08,0x4A,0xC7,0x39,0x00,0x00,0x41,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,0x00,0x08,0x6A,0x4A,0x86,0x39,0x00,0x00,0x66,0x31,0x8A,0x4A,0x00,0x00,0xE7,0x31,0xAB,0x52,0xE4,0x20,0x00,0x00,0x21,0x08,0x08,0x42,0x04,0x21,0x00,0x08,0x41,0x10,0x61,0x10,0x61,0x10,0x00,0x00,0x04,0x29,0xD0,0x73,0x82,0x08,0x00,0x00,
-	0x08,0x42,0x86,0x39,0x00,0x00,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x00,0x00,0xEF,0x8B,0x39,0xCE,0xD7,0xC5,0x96,0xBD,0x96,0xBD,0x18,0xCE,0xCB,0x5A,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x51,0x8C,0x18,0xC6,0x00,0x08,0xC3,0x20,0x18,0xC6,0xB7,0xBD,0x76,0xB5,0x96,0xB5,0x96,0xB5,0x59,0xCE,0x29,0x4A,0x00,0x00,0x00,0x00,0x8A,0x5A,0x7A,0xD6,0x76,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x7A,0xCE,0xEC,0x62,0x00,0x00,0xA3,0x18,0xA3,0x10,
-	0x00,0x10,0x42,0x60,0x62,0x00,0x21,0x28,0x01,0xC8,0x01,0xC0,0x82,0x38,0x42,0x30,0x82,0x38,0x82,0x38,0x83,0x50,0x83,0x50,0x42,0x30,0x83,0x50,0x82,0x38,0x62,0x18,0x21,0x88,0x23,0xD0,0x83,0x50,0x00,0x00,0x66,0x31,0xDB,0xE6,0xF0,0x83,0x66,0x29,0x18,0xC6,0xD7,0xC5,0x96,0xB5,0x7A,0xD6,0xAF,0x7B,0x00,0x00,0x82,0x10,0xD7,0xB5,
-	0xD7,0xC5,0x96,0xBD,0x96,0xBD,0x96,0xB5,0xB7,0xBD,0x96,0xBD,0x39,0xC6,0x51,0x94,0x00,0x00,0xD3,0x9C,0x7A,0xCE,0xB7,0xBD,0xF8,0xC5,0xD7,0xC5,0x82,0x18,0x00,0x00,0x31,0x8C,0x18,0xC6,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0x39,0xCE,0xAF,0x7B,0xE4,0x20,0xE8,0x39,0x25,0x21,0x66,0x29,0x55,0xA5,0xD7,0xBD,0x96,0xB5,0xF8,0xC5,
-	0xD7,0xC5,0x82,0x18,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xE4,0x20,0x49,0x4A,0x21,0x00,0x01,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x29,0x42,0x65,0x21,0x00,0x00,0x62,0x10,0x0C,0x6B,0xA3,0x18,
-	0x00,0x00,0xE4,0x18,0x28,0x3A,0xE8,0x41,0xE4,0x20,0x62,0x10,0x82,0x10,0x21,0x08,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x08,0x8E,0x7B,0x86,0x31,0x00,0x00,0x82,0x18,0xE4,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x2D,0x6B,0x00,0x00,0x00,0x00,0x8E,0x83,0x18,0xC6,0x96,0xB5,0x96,0xBD,0xB7,0xBD,0x39,0xC6,0x49,0x4A,
-	0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x51,0x94,0xFF,0xFF,0x0C,0x6B,0x00,0x00,0xB7,0xB5,0xD7,0xBD,0x76,0xB5,0x96,0xB5,
-	0x96,0xB5,0x59,0xCE,0x86,0x31,0x00,0x00,0x00,0x00,0xE8,0x41,0x59,0xCE,0xB7,0xBD,0x96,0xB5,0x55,0xAD,0x96,0xB5,0x59,0xCE,0x86,0x31,0x82,0x10,0x34,0xB5,0xA7,0x29,0x00,0x08,0x21,0x88,0x62,0x10,0x42,0x38,0x02,0xD8,0x42,0x98,0x82,0x38,0x82,0x38,0x82,0x38,0x83,0x50,0x82,0x38,0x42,0x30,0x24,0x51,0x24,0x51,0x82,0x38,0x82,0x38,
-	0x01,0xA0,0x23,0xD0,0x41,0x10,0x00,0x00,0x2D,0x6B,0x5D,0xEF,0x2D,0x6B,0x08,0x42,0x39,0xC6,0xB7,0xBD,0x76,0xB5,0x7A,0xD6,0x2D,0x6B,0x00,0x00,0x00,0x00,0x51,0x84,0x59,0xCE,0xB7,0xB5,0x96,0xB5,0x76,0xB5,0xD7,0xBD,0x96,0xBD,0x59,0xCE,0x8E,0x7B,0x00,0x00,0x35,0xA5,0x39,0xCE,0xB7,0xB5,0xF8,0xBD,0x55,0xAD,0x21,0x08,0xEC,0x62,
-	0x7A,0xD6,0xD7,0xBD,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0xF8,0xC5,0xEC,0x62,0x00,0x00,0xE4,0x20,0x62,0x10,0x69,0x42,0x18,0xBE,0xB7,0xBD,0x96,0xBD,0xB7,0xBD,0x39,0xC6,0xCB,0x62,0x00,0x00,0x00,0x08,0x62,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xCB,0x5A,0xC3,0x18,0x01,0x08,0x82,0x10,0x41,0x08,0x41,0x10,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0xC7,0x39,0xA7,0x31,0x00,0x08,0x00,0x00,0x66,0x29,0xAB,0x52,0x41,0x08,0x00,0x00,0x21,0x08,0x04,0x21,0x45,0x31,0x04,0x29,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x86,0x31,0xEC,0x5A,0x00,0x00,0x00,0x10,0x08,0x42,
-	0xC3,0x18,0x00,0x08,0x62,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x00,0x08,0xC3,0x20,0xF0,0x7B,0x00,0x00,0x00,0x00,0xEF,0x8B,0x39,0xCE,0x76,0xB5,0x96,0xB5,0x96,0xBD,0xF8,0xC5,0x69,0x42,0x00,0x00,0x62,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x86,0x31,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x6A,0x52,0xB7,0xBD,0x5D,0xEF,0x51,0x84,0x00,0x00,0xB3,0x9C,0x18,0xC6,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xF8,0xBD,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x29,0xF8,0xBD,0xF8,0xC5,0x76,0xB5,0x55,0xAD,0xD7,0xBD,0xD7,0xBD,0x41,0x08,0x72,0x94,0x51,0x84,0x00,0x00,
-	0x42,0x38,0x21,0x70,0x62,0x00,0x42,0x60,0x02,0xD8,0x21,0x70,0x42,0x30,0x82,0x38,0x42,0x38,0x42,0x38,0x82,0x38,0x82,0x38,0x83,0x50,0x83,0x50,0x82,0x38,0xC4,0x70,0x23,0xD0,0x23,0xC0,0x41,0x10,0x00,0x00,0x8E,0x7B,0x1C,0xE7,0xE8,0x41,0xAB,0x52,0x7A,0xCE,0x96,0xBD,0x76,0xB5,0x59,0xD6,0x6A,0x52,0x00,0x00,0x00,0x00,0x69,0x42,
-	0x7A,0xCE,0xB7,0xBD,0x96,0xB5,0xB7,0xBD,0x96,0xBD,0x96,0xB5,0x59,0xCE,0xEB,0x72,0x82,0x10,0xF8,0xBD,0x18,0xC6,0x76,0xAD,0x18,0xCE,0x92,0x94,0x00,0x00,0xF0,0x7B,0x59,0xCE,0x96,0xB5,0x96,0xBD,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xD7,0xC5,0x8E,0x83,0xAF,0x7B,0xEF,0x8B,0x82,0x18,0x11,0x7C,0x39,0xCE,0x96,0xB5,0x96,0xB5,0x76,0xB5,
-	0xD7,0xBD,0x5D,0xEF,0x51,0x94,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x39,0xCB,0x52,0x00,0x00,0x28,0x52,0xE4,0x20,0x00,0x08,0x41,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x00,0x08,0x04,0x29,0x04,0x29,0x00,0x08,0x00,0x00,0x00,0x08,0x41,0x08,0x62,0x10,0x04,0x29,0x42,0x10,0x21,0x08,0x00,0x00,0x66,0x29,
-	0xA7,0x39,0x62,0x10,0x21,0x08,0x21,0x08,0x00,0x08,0x21,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xCB,0x5A,0x04,0x21,0x00,0x00,0x62,0x08,0x04,0x21,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x20,0xD0,0x73,0x00,0x00,0x00,0x00,0x51,0x94,0x59,0xD6,0x96,0xBD,0x76,0xB5,0xB7,0xBD,0xB7,0xBD,0xE8,0x39,
-	0x00,0x00,0x62,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x62,0x10,0xF4,0xA4,0x7A,0xCE,0xA7,0x31,0x00,0x00,0x10,0x84,0x18,0xC6,0x76,0xB5,0x96,0xB5,
-	0xF8,0xC5,0x14,0xA5,0x41,0x10,0x00,0x00,0x00,0x00,0x82,0x18,0x96,0xB5,0xF8,0xC5,0x76,0xB5,0x76,0xAD,0x18,0xC6,0x92,0x94,0x00,0x00,0xB3,0x9C,0x8A,0x52,0x00,0x00,0x42,0x60,0x42,0x48,0x41,0x00,0x21,0x88,0x02,0xD8,0x42,0x60,0x42,0x38,0x42,0x38,0x21,0x28,0x42,0x60,0x42,0x98,0xC4,0x70,0x42,0x38,0x83,0x50,0xE4,0x38,0x24,0x51,
-	0x83,0xA8,0x23,0xB8,0x21,0x00,0x00,0x00,0xF0,0x7B,0x1C,0xE7,0x04,0x21,0x2D,0x6B,0x7A,0xD6,0x96,0xB5,0xB7,0xB5,0x18,0xC6,0x66,0x31,0x00,0x00,0x00,0x00,0xE4,0x18,0xF8,0xBD,0xF8,0xC5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x76,0xB5,0x7A,0xCE,0x6A,0x52,0x62,0x08,0xD7,0xB5,0x59,0xCE,0x76,0xAD,0x59,0xCE,0x8E,0x83,0xC3,0x18,0x18,0xC6,
-	0xD7,0xBD,0x96,0xB5,0x96,0xBD,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xD7,0xC5,0x6E,0x73,0xEC,0x4A,0xCB,0x5A,0xA3,0x18,0xD0,0x73,0xF8,0xC5,0x55,0xAD,0x76,0xAD,0xD7,0xBD,0xB7,0xBD,0xF4,0x9C,0xEC,0x62,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0xAB,0x5A,0xA7,0x31,0x00,0x00,0x0C,0x6B,0xE4,0x18,0x21,0x08,0x82,0x10,
-	0x00,0x00,0x00,0x08,0x62,0x10,0x00,0x08,0xC3,0x20,0xEF,0x8B,0x8A,0x52,0x45,0x31,0x04,0x29,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x00,0x08,0x82,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x20,0x08,0x04,0x21,0x8A,0x52,0x21,0x08,0x41,0x08,0x62,0x10,0x21,0x08,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x21,0x10,0x84,0x00,0x00,0x00,0x08,0x34,0xB5,0x59,0xD6,0x55,0xAD,0x76,0xB5,0x76,0xB5,0xB7,0xB5,0x86,0x39,0x00,0x00,0x62,0x10,0x00,0x00,0x45,0x31,0xAB,0x5A,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x72,0x94,0x51,0x8C,0x00,0x00,0x00,0x00,0x6E,0x73,0x39,0xCE,0x55,0xAD,0x55,0xB5,0x39,0xC6,0xF0,0x7B,0x00,0x00,0x21,0x08,0x00,0x08,0x00,0x08,0xF4,0x9C,0x18,0xC6,0x96,0xB5,0x76,0xB5,0x18,0xC6,0x6E,0x73,0x00,0x00,0x45,0x29,0x04,0x29,0x41,0x10,
-	0x42,0x60,0x42,0x60,0x62,0x08,0x01,0xA0,0x21,0xA8,0x82,0x38,0x42,0x38,0x42,0x38,0xA2,0x20,0x21,0x88,0x02,0xD8,0x23,0xC0,0x42,0x48,0xE4,0x38,0xE4,0x38,0xC3,0x18,0x21,0x88,0x42,0x98,0x21,0x00,0x42,0x38,0xB2,0xA4,0xD7,0xB5,0x41,0x10,0x92,0x8C,0x18,0xC6,0x96,0xB5,0xD7,0xBD,0xD7,0xC5,0xE4,0x20,0x00,0x00,0x21,0x10,0x00,0x00,
-	0x92,0x8C,0x39,0xCE,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0xB7,0xB5,0x59,0xCE,0x66,0x31,0x00,0x00,0x76,0xAD,0xF8,0xBD,0x76,0xB5,0xBB,0xDE,0x6E,0x73,0x00,0x00,0xD0,0x73,0xF8,0xC5,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0x76,0xB5,0xB7,0xBD,0xD7,0xC5,0x08,0x42,0x82,0x08,0x66,0x31,0x25,0x21,0xAF,0x6B,0xF8,0xBD,0x96,0xB5,0x96,0xB5,0x18,0xC6,
-	0xB7,0xBD,0x41,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x10,0x0C,0x6B,0xC3,0x18,0x21,0x08,0x66,0x29,0x62,0x08,0x00,0x00,0x25,0x29,0x6A,0x52,0xA3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x21,0x25,0x21,0x08,0x42,0x28,0x3A,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x39,0x66,0x31,0x00,0x00,0x41,0x10,0x82,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xE4,0x20,0x2D,0x6B,0x00,0x00,0x00,0x08,0x51,0x94,0x7A,0xD6,0x59,0xCE,0x59,0xCE,0x18,0xCE,0xB7,0xB5,0xC3,0x18,
-	0x00,0x00,0x62,0x10,0x00,0x00,0x04,0x29,0x51,0x8C,0x31,0x8C,0xA7,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x01,0x08,0x00,0x00,0x72,0x94,0x96,0xB5,0x41,0x08,0x00,0x00,0x8E,0x7B,0x5D,0xEF,0x39,0xC6,0x39,0xCE,
-	0x1C,0xE7,0xEC,0x62,0x00,0x00,0x62,0x10,0x42,0x10,0x00,0x00,0x10,0x8C,0x59,0xCE,0x76,0xB5,0x96,0xB5,0x39,0xCE,0x8A,0x52,0x00,0x00,0x00,0x08,0x00,0x00,0x82,0x08,0x42,0x30,0x42,0x30,0x42,0x28,0x01,0xC8,0x21,0x88,0x42,0x38,0x42,0x38,0x42,0x48,0x42,0x28,0x21,0x88,0x01,0xC8,0x23,0xB8,0x82,0x38,0x41,0x20,0x82,0x38,0x42,0x30,
-	0xC4,0x70,0x83,0xA8,0x21,0x70,0x01,0xC8,0x96,0xBD,0x11,0x7C,0xA3,0x18,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x18,0xC6,0x96,0xBD,0xA3,0x18,0x00,0x00,0x82,0x10,0x00,0x00,0xEC,0x5A,0x59,0xCE,0xB7,0xBD,0x96,0xBD,0x96,0xBD,0x96,0xBD,0xD7,0xC5,0x82,0x18,0x86,0x31,0x7A,0xCE,0xD7,0xBD,0xB7,0xB5,0x59,0xD6,0xCB,0x62,0x00,0x00,0xF0,0x83,
-	0x39,0xC6,0x96,0xB5,0x76,0xB5,0x96,0xB5,0x96,0xB5,0x18,0xC6,0x96,0xBD,0x86,0x39,0x25,0x29,0x66,0x31,0x04,0x29,0xB3,0x94,0x39,0xCE,0x96,0xB5,0x76,0xB5,0x59,0xCE,0x55,0xAD,0x21,0x10,0x00,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA3,0x18,0x4D,0x63,0x41,0x08,0xA3,0x18,0x08,0x42,0x00,0x00,0x21,0x10,0x21,0x10,
-	0xA7,0x31,0xEC,0x5A,0x49,0x52,0x62,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x45,0x29,0x82,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x00,0x08,0x62,0x10,0x86,0x31,0x49,0x4A,0x4D,0x63,0x31,0x84,0x11,0x7C,0x21,0x08,0x21,0x08,0x62,0x10,0x21,0x08,0x00,0x00,0x0C,0x6B,0xFF,0xFF,0x15,0x9D,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0xF4,0xA4,0x0C,0x5B,0x00,0x00,0x00,0x00,0xC3,0x18,0x4D,0x63,0x6E,0x63,0xAF,0x7B,0x72,0x8C,0x45,0x29,0x00,0x00,0x21,0x08,0x00,0x00,0x00,0x00,0x2D,0x6B,0xDB,0xE6,0x39,0xCE,0x59,0xCE,0x1C,0xE7,0x8A,0x52,0x00,0x00,0x45,0x29,0x41,0x10,0x00,0x08,
-	0x42,0x60,0x83,0x50,0x42,0x60,0x01,0xC8,0x42,0x60,0xA2,0x20,0xA2,0x20,0x82,0x38,0x42,0x38,0x01,0x98,0x01,0xC8,0x83,0xA8,0x82,0x38,0xE4,0x38,0x83,0x39,0xE4,0x38,0xC4,0x70,0x23,0xC0,0x01,0xC8,0x01,0xC0,0x18,0xCE,0x49,0x4A,0xA3,0x18,0xBB,0xDE,0x59,0xCE,0xD7,0xC5,0x7A,0xD6,0x34,0xB5,0x41,0x10,0x00,0x00,0x82,0x18,0x00,0x08,
-	0xA7,0x29,0x18,0xC6,0xF8,0xC5,0xB7,0xBD,0x96,0xB5,0xD7,0xBD,0x76,0xB5,0x04,0x29,0xF4,0xA4,0x59,0xCE,0x76,0xB5,0xB7,0xB5,0x39,0xCE,0x08,0x4A,0x00,0x00,0x10,0x8C,0x59,0xCE,0x96,0xB5,0x96,0xB5,0x96,0xBD,0xB7,0xBD,0xF8,0xBD,0x34,0xB5,0x25,0x29,0x45,0x29,0x45,0x29,0x66,0x29,0x15,0x9D,0x18,0xC6,0x76,0xB5,0x76,0xAD,0x39,0xC6,
-	0x55,0xB5,0x41,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x01,0x08,0x45,0x29,0xAB,0x5A,0x21,0x08,0x41,0x08,0x8A,0x52,0xC3,0x20,0x00,0x00,0x42,0x10,0x00,0x00,0x62,0x08,0xAB,0x52,0x0C,0x6B,0x29,0x4A,0xC3,0x20,0xA3,0x18,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0xA3,0x18,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0xC3,0x18,0x00,0x08,0x00,0x00,0x21,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,
-	0x00,0x08,0x21,0x08,0x00,0x00,0xC3,0x20,0x8E,0x7B,0xBB,0xDE,0x92,0x8C,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x42,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x08,0x86,0x31,0x86,0x31,0x00,0x08,0xC3,0x20,0x25,0x29,0x62,0x10,0x00,0x00,0x00,0x08,0x00,0x00,
-	0x21,0x08,0x00,0x00,0xA3,0x18,0x42,0x10,0xA3,0x18,0x00,0x08,0x00,0x00,0x04,0x21,0xE7,0x31,0x8A,0x52,0x4D,0x63,0x04,0x21,0x00,0x00,0x82,0x10,0xC7,0x41,0x04,0x29,0x21,0x70,0x21,0x70,0x42,0x98,0x01,0xC8,0x21,0x70,0x42,0x48,0x42,0x48,0x83,0x50,0x83,0x50,0x00,0xB8,0x01,0xC0,0x02,0xB0,0x83,0x50,0xE4,0x38,0x24,0x51,0xE4,0x38,
-	0x83,0x50,0x02,0xB8,0x01,0xC8,0xC4,0xA8,0x7A,0xD6,0xE8,0x41,0xA3,0x10,0x76,0xA5,0xD7,0xB5,0x18,0xBE,0xDB,0xD6,0x72,0x94,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x00,0x00,0xF4,0x9C,0x39,0xC6,0x76,0xB5,0x76,0xB5,0x39,0xCE,0x92,0x94,0x25,0x21,0xD7,0xBD,0xD7,0xBD,0x96,0xB5,0xB7,0xBD,0xD7,0xC5,0x2D,0x6B,0xF0,0x7B,0xF8,0xBD,
-	0xB7,0xBD,0xD7,0xBD,0xB7,0xBD,0x76,0xB5,0x96,0xB5,0x39,0xCE,0x92,0x9C,0xC3,0x20,0x66,0x29,0x04,0x21,0xA7,0x31,0x76,0xA5,0xD7,0xC5,0x76,0xAD,0x76,0xB5,0xF8,0xC5,0x96,0xB5,0x04,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x66,0x31,0xEC,0x62,0xC3,0x18,0x00,0x00,0x8A,0x5A,0x6E,0x73,0x00,0x00,0x21,0x10,
-	0x62,0x10,0x00,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x45,0x29,0x29,0x42,0x66,0x29,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,
-	0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x41,0x20,0xE4,0x38,0x83,0x39,0x08,0x52,0x6A,0x62,0xEB,0x72,0xEB,0x72,0x8E,0x83,0x8E,0x83,0x92,0x9C,0x49,0x52,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0xA3,0x18,0xCB,0x5A,0x45,0x31,0x86,0x31,0x66,0x31,0x08,0x4A,0xE8,0x41,0x62,0x10,0x62,0x18,0x41,0x10,0x62,0x10,0x82,0x18,0x00,0x08,0x00,0x00,0xE8,0x41,0xAF,0x7B,0x35,0xA5,0xA7,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x08,0x4D,0x63,0x35,0xA5,0x31,0x8C,0x31,0x8C,0x8E,0x7B,0xAF,0x7B,0xAF,0x7B,0x0C,0x6B,0x49,0x4A,0xE4,0x20,0x00,0x00,0x04,0x29,0xB7,0xBD,0x55,0xB5,0xEF,0x8B,0x2D,0x6B,0x86,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x94,0x55,0xA5,
-	0x82,0x38,0x00,0x08,0x42,0x60,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x00,0xB8,0x01,0xC0,0x02,0xB0,0x01,0xC0,0x00,0xB8,0x00,0xB8,0xC4,0xA8,0xAB,0xAA,0xAB,0xAA,0x48,0xD2,0x46,0xB1,0x02,0xB8,0x00,0xB8,0xAB,0xAA,0x7A,0xCE,0x86,0x31,0x00,0x00,0x41,0x08,0xC3,0x18,0x65,0x21,0x28,0x3A,0x45,0x29,0x00,0x08,0x62,0x10,0x82,0x10,0x62,0x10,
-	0x00,0x00,0x4D,0x63,0x1C,0xE7,0x39,0xCE,0x59,0xCE,0x1C,0xE7,0xAF,0x7B,0x25,0x21,0x18,0xC6,0x96,0xB5,0x55,0xAD,0xF8,0xC5,0xB7,0xBD,0xC7,0x41,0xA7,0x39,0xB7,0xB5,0xF8,0xC5,0xB7,0xBD,0xD7,0xBD,0x96,0xBD,0xB7,0xBD,0xBB,0xDE,0x8E,0x7B,0x41,0x10,0x04,0x21,0x61,0x10,0x65,0x21,0xB7,0xB5,0xB7,0xBD,0x96,0xB5,0x76,0xB5,0xF8,0xBD,
-	0xB7,0xBD,0xE4,0x20,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x21,0xE4,0x18,0x0C,0x6B,0x29,0x42,0x00,0x00,0xC3,0x20,0x55,0xAD,0x86,0x39,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0xA2,0x20,0xEB,0x72,0x6A,0x62,0x28,0x52,0xB3,0x9C,0x55,0xA5,0xF4,0xAC,0x34,0xB5,0xB6,0xBD,0xD7,0xC5,0xB6,0xBD,0xD7,0xC5,0xB7,0xBD,0xB6,0xBD,0xEF,0x8B,0x21,0x08,
-	0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0xA3,0x18,0x0C,0x6B,0x45,0x29,0xC3,0x18,0xE4,0x20,0x08,0x42,0x6E,0x73,0x29,0x4A,0xAB,0x5A,0x6E,0x73,0x49,0x4A,
-	0xEC,0x62,0x30,0x8C,0x6E,0x73,0xAB,0x52,0xC7,0x39,0x49,0x4A,0x2D,0x6B,0x6A,0x52,0xCB,0x5A,0xCB,0x62,0xC3,0x20,0x00,0x00,0x62,0x10,0xC3,0x18,0x45,0x29,0xE8,0x41,0x49,0x52,0x6A,0x52,0x6A,0x52,0xAB,0x5A,0x4D,0x73,0x8E,0x83,0x04,0x21,0x00,0x00,0xC3,0x18,0x41,0x08,0x6A,0x52,0xEF,0x8B,0x6E,0x73,0x8E,0x7B,0x31,0x84,0xB3,0x9C,
-	0xF4,0xAC,0xD3,0xA4,0x4D,0x73,0xEF,0x8B,0x18,0xCE,0x39,0xCE,0x59,0xD6,0xBB,0xDE,0x59,0xCE,0xD7,0xC5,0x92,0x9C,0xCB,0x62,0x86,0x31,0x45,0x31,0x4D,0x73,0x25,0x21,0x00,0x00,0x28,0x3A,0xB6,0xBD,0x8E,0xB3,0x01,0x98,0x46,0xB1,0x46,0xB1,0x02,0xA8,0x01,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x05,0xC9,0x0A,0xEB,0x0A,0xEB,0x0A,0xEB,
-	0x48,0xD2,0x85,0xC9,0x00,0xB8,0x71,0xBC,0xBA,0xCE,0x45,0x29,0x00,0x00,0x61,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x82,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x00,0x08,0xE4,0x18,0x6E,0x63,0xAF,0x6B,0x11,0x7C,0x55,0xA5,0xCB,0x5A,0x08,0x42,0x18,0xC6,0xB7,0xBD,0x76,0xAD,0xF8,0xBD,0x14,0xA5,0x10,0x84,0x2D,0x6B,0xF4,0x94,
-	0x39,0xCE,0xD7,0xC5,0xF8,0xBD,0xD7,0xC5,0xD7,0xBD,0x59,0xD6,0x51,0x94,0xE8,0x41,0xC7,0x41,0x66,0x31,0x08,0x42,0x76,0xAD,0x76,0xB5,0x76,0xB5,0x76,0xAD,0x96,0xBD,0xB7,0xBD,0x86,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0xA3,0x10,0x66,0x31,0x0C,0x5B,0x00,0x08,0x00,0x00,0x86,0x31,0xD3,0x94,0x6A,0x52,
-	0x00,0x08,0x00,0x00,0x62,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x62,0x08,0x62,0x10,0x42,0x10,0x61,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x82,0x18,0x42,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0x66,0x31,0x6A,0x62,0x8E,0x83,
-	0x34,0xB5,0x14,0xA5,0xAF,0x6B,0x8A,0x52,0xF0,0x7B,0xB2,0xA4,0x51,0x94,0xF4,0xA4,0xF4,0xA4,0xB3,0x9C,0xF4,0xAC,0x96,0xB5,0xD7,0xBD,0xD3,0xA4,0x31,0x84,0x45,0x29,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x6E,0x73,0x76,0xB5,0xF8,0xBD,0x20,0x08,0x00,0x00,0x41,0x10,0x7A,0xD6,0xDB,0xE6,0x1C,0xE7,0xBB,0xDE,0xD3,0xA4,0x72,0x94,0x76,0xB5,0x96,0xBD,0xD7,0xC5,0xF8,0xC5,
-	0xF8,0xBD,0x39,0xC6,0x39,0xCE,0x7A,0xCE,0x59,0xD6,0x7A,0xCE,0x49,0x4A,0x00,0x00,0x62,0x10,0xC7,0x41,0xF4,0xA4,0xDB,0xD6,0xB7,0xBD,0xB7,0xB5,0x96,0xB5,0xB7,0xBD,0x76,0xB5,0xB7,0xBD,0xF8,0xC5,0xF8,0xC5,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0x76,0xB5,0xB7,0xBD,0x18,0xC6,0x39,0xC6,0x18,0xCE,0x39,0xC6,0xD7,0xC5,0x92,0x9C,0x2D,0x6B,
-	0xCB,0x62,0x35,0xAD,0x5D,0xDF,0xF4,0x9C,0x20,0x18,0x8A,0x5A,0x8E,0x83,0x42,0x60,0x21,0x70,0x21,0x88,0x01,0x98,0x21,0xA8,0x84,0xC8,0x0A,0xEB,0x0A,0xEB,0x0A,0xEB,0x0A,0xEB,0x46,0xB1,0x02,0xA8,0x55,0xB5,0x7A,0xCE,0x45,0x31,0x00,0x00,0x62,0x10,0x62,0x10,0x62,0x10,0x82,0x10,0xA1,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x62,0x18,0x21,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x00,0x00,0x00,0xAF,0x6B,0x59,0xCE,0x76,0xAD,0x76,0xB5,0xF8,0xC5,0x35,0xAD,0xCB,0x5A,0x49,0x4A,0x49,0x4A,0xF8,0xBD,0x39,0xC6,0xD7,0xC5,0xD7,0xBD,0xF8,0xC5,0x18,0xC6,0xF8,0xC5,0xB7,0xBD,0xB6,0xBD,0x34,0xB5,0x34,0xB5,0x76,0xB5,0x55,0xAD,0x76,0xB5,0x76,0xAD,0xB7,0xB5,
-	0xF8,0xC5,0xC7,0x41,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x42,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x21,0x08,0x45,0x29,0x04,0x21,0x41,0x10,0xA3,0x10,0x00,0x00,0xCB,0x5A,0xC7,0x39,0x00,0x00,0x00,0x00,0xE4,0x18,0xEC,0x5A,0x8A,0x52,0xE4,0x20,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x08,0x41,0x10,0x62,0x10,0x21,0x08,0x62,0x08,0xE4,0x18,0x00,0x00,0x00,0x08,0xE4,0x38,0x08,0x52,0x8E,0x7B,0xF4,0xAC,0xB2,0xA4,0x6E,0x73,0xD7,0xC5,0x96,0xBD,0x34,0xB5,0x4D,0x73,0x6A,0x62,0x34,0xB5,0x39,0xC6,0xF4,0x94,0x6E,0x63,0x6E,0x63,0x51,0x84,0xB6,0xBD,0x11,0x7C,0x8A,0x4A,0xD0,0x73,0x8A,0x52,0x66,0x31,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0xCB,0x62,0xEC,0x62,0x30,0x8C,0x28,0x52,0xEB,0x72,0x6E,0x73,0x45,0x29,0xC3,0x20,0x45,0x29,0x45,0x31,0x61,0x10,0x45,0x31,
-	0x45,0x31,0x51,0x94,0xD7,0xBD,0xAB,0x5A,0x4D,0x73,0x49,0x52,0x55,0xAD,0xF8,0xC5,0x18,0xC6,0xD7,0xBD,0xD7,0xBD,0xD7,0xBD,0xD7,0xBD,0xB7,0xB5,0x55,0xAD,0x10,0x84,0x10,0x84,0x96,0xB5,0x96,0xBD,0xD7,0xBD,0x96,0xB5,0x59,0xCE,0x2D,0x6B,0x00,0x00,0x41,0x10,0xF0,0x83,0xBB,0xDE,0x1C,0xE7,0xF8,0xC5,0x96,0xB5,0x76,0xB5,0x55,0xB5,
-	0x55,0xB5,0x55,0xB5,0x55,0xAD,0x35,0xAD,0x76,0xB5,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0x76,0xB5,0x76,0xB5,0x96,0xBD,0x96,0xBD,0xD7,0xBD,0x18,0xC6,0xDB,0xD6,0x1C,0xE7,0xF8,0xC5,0x18,0xBE,0xF4,0xAC,0x22,0xB8,0xAB,0xAA,0x39,0xC6,0x46,0xB1,0x22,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x84,0xC8,0x0A,0xEB,0x0A,0xEB,0xE7,0xA9,
-	0x8E,0xB3,0xA4,0xB8,0x23,0xB8,0x39,0xC6,0x18,0xBE,0xA3,0x18,0x00,0x00,0xA1,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x40,0x10,0x04,0x21,0x08,0x52,0xC7,0x41,0xE4,0x20,0x41,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x72,0x8C,0x39,0xC6,0x55,0xAD,0x76,0xAD,0x39,0xCE,0xAF,0x7B,0x00,0x00,0xA3,0x10,0x86,0x39,
-	0x51,0x84,0x7A,0xD6,0xD7,0xBD,0xD7,0xBD,0xF8,0xC5,0xF8,0xC5,0xD7,0xBD,0x96,0xBD,0x96,0xB5,0x76,0xB5,0xB7,0xBD,0x96,0xB5,0x55,0xAD,0x55,0xB5,0x76,0xB5,0x96,0xB5,0xB7,0xBD,0x49,0x52,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0x82,0x10,0x21,0x08,0xC7,0x39,0x41,0x10,0x82,0x18,0xE8,0x41,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x00,
-	0x45,0x29,0x04,0x29,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0xEB,0x72,0xEB,0x72,0x51,0x94,0xD3,0xA4,0x14,0xAD,0xD3,0x9C,0xB3,0x9C,0x92,0x9C,0x51,0x94,0x76,0xAD,
-	0x14,0xA5,0x14,0xAD,0xF4,0xAC,0x34,0xB5,0xF0,0x7B,0x28,0x3A,0x28,0x3A,0x30,0x8C,0xF4,0xAC,0x55,0xB5,0x96,0xB5,0xB2,0xA4,0xEB,0x72,0x6A,0x52,0x8A,0x5A,0x28,0x52,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x00,0x00,0x6E,0x73,0x5D,0xEF,0x18,0xCE,0x18,0xCE,0x59,0xD6,0xBB,0xDE,0x59,0xD6,0x96,0xBD,0x55,0xB5,0x55,0xB5,0x96,0xBD,0xF8,0xC5,0xD7,0xC5,0x92,0x9C,0x55,0xAD,0x96,0xB5,0xD7,0xBD,0x7A,0xD6,0x18,0xC6,0x59,0xCE,0xDB,0xD6,0x7A,0xD6,0xF8,0xC5,0xB7,0xBD,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x59,0xCE,0xD7,0xBD,
-	0x96,0xB5,0xD7,0xC5,0xF8,0xC5,0xD7,0xBD,0xD7,0xBD,0x59,0xCE,0x4D,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0x73,0x6E,0x63,0x72,0x94,0xDB,0xD6,0x59,0xCE,0x18,0xC6,0xD7,0xBD,0xD7,0xBD,0xB7,0xBD,0x76,0xB5,0x96,0xBD,0xB7,0xBD,0x76,0xB5,0x96,0xB5,0x96,0xBD,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0x7A,0xD6,
-	0xBB,0xDE,0x7A,0xD6,0xBA,0xCE,0x8E,0xB3,0x23,0xD0,0x05,0xC9,0x39,0xCE,0x59,0xD6,0x55,0xB5,0x8E,0xB3,0xE7,0xA9,0xC4,0x70,0x42,0x38,0x66,0x89,0x82,0x38,0x00,0x00,0x51,0x84,0x05,0xC9,0x23,0xB8,0xBA,0xCE,0x72,0x8C,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x08,0x21,0x08,0x61,0x10,0x00,0x00,0x49,0x4A,0xDB,0xE6,0xDB,0xE6,0x55,0xB5,
-	0x62,0x10,0x20,0x08,0x62,0x10,0x62,0x10,0x62,0x10,0x60,0x08,0x21,0x08,0x15,0x9D,0x18,0xC6,0xB7,0xB5,0x96,0xB5,0x18,0xCE,0x0C,0x6B,0x00,0x00,0x82,0x10,0x00,0x00,0xC7,0x39,0xBB,0xDE,0xF8,0xC5,0xD7,0xBD,0xD7,0xC5,0x18,0xC6,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x76,0xB5,0xB7,0xBD,0x96,0xB5,0x55,0xAD,0x76,0xB5,0x96,0xB5,0x96,0xB5,
-	0x55,0xB5,0xCB,0x62,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x00,0x08,0x08,0x4A,0xE8,0x39,0x00,0x00,0x21,0x08,0xA7,0x31,0xC3,0x20,0x21,0x08,0x41,0x08,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x08,0x52,0x51,0x94,0x34,0xB5,0x14,0xAD,0x14,0xA5,0xF4,0x94,0xD3,0x9C,0xD3,0x94,0x92,0x8C,0x92,0x8C,0x14,0xA5,0xF4,0x9C,0xF4,0x9C,0x96,0xBD,0x96,0xAD,0x14,0xAD,0x6E,0x73,0x6A,0x62,0x51,0x94,0xB7,0xBD,0x76,0xB5,0x14,0xA5,0xD3,0x94,0x55,0xB5,0x96,0xBD,0x55,0xB5,0xB6,0xBD,0x6E,0x73,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x4D,0x73,0x5D,0xEF,0x39,0xCE,0x59,0xCE,0xBB,0xDE,0xBB,0xDE,0x59,0xD6,0x59,0xCE,0x18,0xC6,0x18,0xCE,0x39,0xCE,0x7A,0xD6,0xDB,0xD6,
-	0xBB,0xDE,0x39,0xCE,0xF8,0xC5,0x59,0xCE,0x7A,0xCE,0xFF,0xFF,0x55,0xA5,0x25,0x19,0x15,0x9D,0x1C,0xE7,0xB7,0xAD,0x6E,0x63,0xF0,0x83,0xF0,0x7B,0x0C,0x5B,0x31,0x84,0x76,0xA5,0xB7,0xB5,0xB7,0xB5,0x55,0xAD,0xD7,0xBD,0x39,0xC6,0x6E,0x73,0x00,0x00,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x10,0xAF,0x6B,0xEC,0x5A,0x6A,0x4A,
-	0x4D,0x63,0xF0,0x7B,0xD3,0x94,0xD7,0xBD,0x59,0xCE,0x59,0xD6,0xD7,0xC5,0x96,0xBD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xBD,0xF8,0xC5,0xF8,0xBD,0x35,0xA5,0x11,0x7C,0xD3,0x9C,0xB7,0xAD,0x71,0xBC,0x02,0xB0,0x42,0x48,0x00,0x28,0x82,0x38,0x25,0x29,0xC3,0x18,0xE8,0x39,0xEC,0x4A,0x82,0x00,0x82,0x08,0xC4,0x70,0x41,0x10,0x41,0x00,
-	0x4D,0x73,0x46,0xB1,0xAB,0xAA,0x59,0xC6,0x76,0xAD,0x6A,0x52,0x04,0x29,0xA2,0x20,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x8E,0x7B,0x7A,0xD6,0xBB,0xDE,0xB2,0xA4,0x00,0x00,0x41,0x08,0x62,0x10,0x61,0x10,0x82,0x10,0x00,0x08,0x04,0x21,0xB7,0xB5,0xD7,0xBD,0x96,0xB5,0x76,0xB5,0x7A,0xD6,0x51,0x94,0x00,0x00,0x21,0x08,0x00,0x00,
-	0x21,0x00,0xB7,0xB5,0x59,0xCE,0xB7,0xBD,0xF8,0xC5,0xF8,0xC5,0x96,0xBD,0x96,0xBD,0x96,0xB5,0x76,0xB5,0x76,0xB5,0x76,0xB5,0x76,0xB5,0x96,0xB5,0x76,0xB5,0xB7,0xBD,0x18,0xCE,0x08,0x42,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,0xA7,0x31,0x45,0x29,0x00,0x00,0x82,0x10,0xA3,0x18,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x82,0x10,0x00,0x00,0x00,0x10,0xC7,0x41,0x51,0x94,0x96,0xBD,0xF4,0x9C,0x92,0x8C,0x72,0x8C,0x51,0x8C,0x92,0x94,0x92,0x8C,0x10,0x8C,0x51,0x94,0x14,0xA5,0x55,0xA5,0x31,0x84,
-	0xB3,0x8C,0x51,0x84,0xF0,0x7B,0x8E,0x7B,0xD0,0x73,0x10,0x84,0x51,0x8C,0x30,0x8C,0xB3,0x9C,0xD3,0x94,0xB3,0x9C,0x35,0xA5,0x55,0xB5,0x35,0xAD,0x55,0xAD,0xF0,0x7B,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x00,0x00,0x04,0x21,0xAB,0x52,0x49,0x4A,0xAB,0x52,0xCB,0x5A,0x8E,0x7B,0xAF,0x6B,0x8E,0x7B,0xD0,0x73,0xF0,0x7B,0x72,0x8C,0x92,0x94,0xD3,0x9C,0x55,0xA5,0x96,0xAD,0x35,0xA5,0x55,0xA5,0x55,0xA5,0x18,0xBE,0xEC,0x62,0x00,0x00,0x62,0x08,0xC7,0x39,0x82,0x10,0x00,0x00,0x21,0x08,0x21,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x62,0x10,0x00,0x00,0xEC,0x62,0x7A,0xCE,0x59,0xC6,0x10,0x84,0x82,0x18,0x21,0x08,0x21,0x08,0x00,0x00,0x41,0x10,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x04,0x29,0x41,0x10,0x25,0x29,0xE8,0x41,0x4D,0x63,0xF0,0x7B,0x55,0xAD,0xD7,0xBD,0x96,0xB5,0x96,0xBD,0x96,0xB5,0x18,0xC6,0xF8,0xBD,0x15,0x9D,0x10,0x84,0x82,0x18,
-	0x00,0x08,0x41,0x00,0x21,0x28,0x42,0x60,0x41,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x18,0x66,0x31,0x21,0x08,0x04,0x29,0x45,0x71,0x66,0x31,0x65,0x21,0x21,0x70,0x46,0xB1,0xB7,0xB5,0xF8,0xBD,0xF8,0xC5,0x39,0xCE,0xD7,0xC5,0x96,0xBD,0x34,0xB5,0xB2,0xA4,0x92,0x9C,0xF0,0x83,0xB7,0xB5,0x7A,0xCE,0x1C,0xE7,0x51,0x94,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x6B,0x59,0xCE,0x76,0xB5,0x76,0xB5,0xB7,0xBD,0x96,0xB5,0xC3,0x20,0x00,0x00,0x62,0x10,0x41,0x10,0x00,0x00,0xEC,0x5A,0x1C,0xE7,0x18,0xCE,0xD7,0xC5,0xF8,0xC5,0xB7,0xBD,0x96,0xB5,0xB7,0xB5,0x76,0xB5,0x96,0xB5,0xB7,0xBD,0x96,0xB5,0x76,0xB5,0x76,0xB5,0x39,0xC6,
-	0x35,0xAD,0x00,0x00,0x00,0x00,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x10,0x62,0x08,0x41,0x10,0x42,0x10,0x62,0x10,0x42,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x62,0x10,0x86,0x31,0x82,0x10,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0xA3,0x18,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x00,0x00,
-	0x00,0x08,0x4D,0x73,0x76,0xB5,0x14,0xAD,0xB3,0x9C,0xB2,0xA4,0xD3,0xA4,0x51,0x8C,0x51,0x8C,0x72,0x8C,0x92,0x94,0x92,0x8C,0x11,0x7C,0x6E,0x63,0xCB,0x52,0xC7,0x41,0x49,0x52,0x0C,0x6B,0x6E,0x73,0xEF,0x8B,0xAF,0x7B,0x92,0x9C,0xF4,0xAC,0x55,0xB5,0x55,0xAD,0x14,0xAD,0x34,0xB5,0x55,0xAD,0x55,0xAD,0x34,0xB5,0x35,0xAD,0xF0,0x7B,
-	0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xEB,0x72,0x8E,0x7B,0x0C,0x6B,0xCB,0x62,0xEC,0x62,0x4D,0x73,0x0C,0x6B,0x6A,0x62,0x28,0x52,0x0C,0x6B,0x0C,0x6B,0x08,0x4A,0xE8,0x41,0xAB,0x5A,
-	0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x21,0x00,0x01,0x08,0x21,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x08,0x00,0x00,0xE4,0x20,0xAB,0x5A,0xA3,0x18,0x00,0x00,0x00,0x00,0xEC,0x62,0x7A,0xCE,0x59,0xD6,0x2D,0x6B,0x00,0x00,0x00,0x00,0x25,0x29,0x49,0x4A,0x41,0x08,0x00,0x08,0x62,0x10,0x66,0x31,0xC7,0x41,
-	0x04,0x21,0x82,0x10,0xCB,0x62,0x08,0x42,0x00,0x00,0x00,0x00,0x6E,0x73,0x59,0xD6,0x76,0xB5,0x96,0xBD,0x39,0xCE,0xCB,0x5A,0x82,0x10,0x62,0x08,0x00,0x00,0x00,0x10,0x01,0x08,0x00,0x00,0x21,0x10,0x62,0x18,0x41,0x08,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0xEC,0x62,0x49,0x52,0x61,0x10,0xA3,0x18,0x65,0x21,0xC3,0x18,0x66,0x21,
-	0x66,0x89,0x23,0xD0,0x8E,0xB3,0xDB,0xD6,0x59,0xCE,0x18,0xC6,0x96,0xB5,0xB7,0xBD,0xF8,0xBD,0x39,0xCE,0x7A,0xCE,0x6E,0x73,0xA7,0x31,0x28,0x3A,0x0C,0x6B,0xAF,0x7B,0x2D,0x6B,0x4D,0x73,0xEB,0x72,0xE8,0x41,0x62,0x18,0x49,0x4A,0xF8,0xBD,0x76,0xB5,0x55,0xAD,0x96,0xBD,0x59,0xCE,0xEC,0x62,0x00,0x00,0x21,0x08,0x62,0x10,0x21,0x08,
-	0x00,0x00,0xC3,0x18,0xF4,0x94,0x18,0xC6,0x59,0xCE,0x18,0xC6,0x59,0xCE,0x59,0xD6,0x39,0xCE,0x18,0xBE,0xF8,0xC5,0xD7,0xBD,0xF8,0xC5,0xD7,0xBD,0xF8,0xC5,0x7A,0xD6,0x8A,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x42,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x62,0x18,0xA3,0x18,0x25,0x29,0xC6,0x39,0x62,0x10,0x21,0x08,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x82,0x18,0x62,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x00,0x00,0xA2,0x20,0xEF,0x8B,0x55,0xAD,0xF4,0x9C,0xB2,0xA4,0xB6,0xBD,0x39,0xC6,0x76,0xA5,0x51,0x84,0xEC,0x4A,0x69,0x42,0x69,0x42,0xE7,0x31,0x28,0x52,0xCB,0x62,0x8E,0x83,0x51,0x94,
-	0x34,0xB5,0xB7,0xBD,0xD7,0xB5,0x14,0xAD,0xF4,0xAC,0xD7,0xBD,0x96,0xAD,0x55,0xAD,0x76,0xAD,0xB7,0xB5,0x55,0xB5,0x14,0xA5,0x72,0x8C,0xD3,0x94,0xB3,0x9C,0x8E,0x83,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x08,0x62,0x10,0x76,0xB5,0x1C,0xE7,0xDB,0xD6,0x39,0xCE,0x59,0xD6,0xBB,0xDE,0xBB,0xDE,0x7A,0xD6,0xF8,0xC5,0x18,0xCE,0xD7,0xC5,0x96,0xBD,0xB7,0xBD,0x1C,0xE7,0xCB,0x62,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x45,0x31,0x66,0x31,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x21,0x08,0xA7,0x39,0x4D,0x63,
-	0xE4,0x20,0x00,0x00,0x00,0x00,0xAF,0x7B,0x59,0xCE,0x59,0xCE,0x2D,0x6B,0x00,0x00,0x00,0x00,0x29,0x4A,0x6A,0x4A,0x00,0x08,0x01,0x08,0xA3,0x18,0x45,0x31,0xE8,0x41,0xE4,0x20,0x62,0x10,0x45,0x29,0xA7,0x39,0x41,0x10,0x00,0x00,0x30,0x8C,0xBB,0xDE,0x96,0xB5,0xB7,0xBD,0x59,0xD6,0xE4,0x20,0x00,0x00,0x00,0x08,0x21,0x08,0x62,0x08,
-	0x42,0x10,0x62,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x25,0x29,0x31,0x8C,0x08,0x42,0xA3,0x18,0x45,0x29,0xE4,0x20,0x62,0x10,0xA7,0x31,0xEB,0x72,0x42,0x60,0x21,0x70,0xEB,0x72,0xD0,0x73,0xB7,0xB5,0x59,0xD6,0x18,0xCE,0xF8,0xC5,0xB7,0xB5,0x96,0xB5,0x55,0xB5,0x55,0xAD,0x55,0xB5,0xEF,0x8B,0x08,0x4A,
-	0xE8,0x41,0x35,0xA5,0xDB,0xE6,0x39,0xCE,0x76,0xB5,0x55,0xAD,0xD7,0xBD,0x76,0xAD,0x76,0xB5,0x96,0xB5,0xF8,0xC5,0x4D,0x73,0x62,0x10,0x21,0x08,0x00,0x08,0x04,0x29,0xE8,0x41,0x00,0x00,0x00,0x00,0x41,0x08,0x08,0x42,0x51,0x84,0x8E,0x7B,0xAF,0x6B,0x92,0x94,0x10,0x84,0x92,0x94,0xD7,0xB5,0xB7,0xB5,0xD7,0xB5,0xD7,0xBD,0x7A,0xCE,
-	0x49,0x4A,0x00,0x00,0x41,0x10,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x62,0x10,0x42,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x21,0x08,0x21,0x08,0x82,0x18,0x41,0x10,0x6A,0x52,0xAB,0x52,0x66,0x31,0x25,0x29,0x20,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x18,0x21,0x10,0x86,0x39,0x55,0xB5,
-	0xD7,0xC5,0x31,0x84,0x30,0x8C,0xF8,0xBD,0xB7,0xAD,0x6E,0x63,0x66,0x21,0xE4,0x18,0x86,0x31,0xCB,0x62,0xEB,0x72,0x8E,0x83,0x92,0x9C,0x14,0xA5,0x14,0xAD,0xB3,0x94,0xF4,0x94,0xB3,0x9C,0x96,0xAD,0xD3,0x94,0x51,0x84,0xD3,0x94,0x72,0x8C,0x51,0x84,0xF0,0x7B,0xAF,0x6B,0x31,0x84,0x51,0x84,0x51,0x84,0x72,0x8C,0xB3,0x94,0xF0,0x7B,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x82,0x18,0xD3,0xA4,0x39,0xC6,0x7A,0xD6,0x18,0xC6,0x39,0xCE,0x7A,0xD6,0x7A,0xCE,0x39,0xCE,0x18,0xC6,0xB7,0xBD,0xD7,0xBD,0x18,0xCE,0x39,0xCE,0x5D,0xEF,
-	0x4D,0x63,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x82,0x18,0x82,0x18,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0xA7,0x39,0x49,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x08,0x00,0x00,0xAF,0x7B,0x18,0xC6,0x59,0xCE,0x0C,0x6B,0x00,0x00,0x41,0x10,0x01,0x08,0x00,0x00,0x41,0x10,0x41,0x08,0xA3,0x18,0x45,0x31,0x86,0x31,
-	0x82,0x10,0x00,0x08,0x62,0x10,0x45,0x31,0x00,0x00,0x00,0x00,0xB3,0x9C,0x7A,0xCE,0x76,0xAD,0xF8,0xBD,0x96,0xB5,0x62,0x10,0x00,0x00,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x18,0xAF,0x7B,0x72,0x94,0x66,0x31,0x41,0x08,0xC3,0x20,0xA3,0x18,0x82,0x18,0x08,0x42,
-	0x08,0x42,0x41,0x00,0x21,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x51,0x84,0xF4,0x9C,0xF4,0x9C,0xF8,0xBD,0x59,0xD6,0x59,0xCE,0xF8,0xBD,0xD7,0xBD,0xD7,0xBD,0x7A,0xCE,0x55,0xB5,0x96,0xBD,0x7A,0xD6,0x18,0xCE,0x76,0xAD,0x31,0x84,0xD7,0xBD,0x18,0xCE,0x18,0xC6,0x39,0xC6,0xF8,0xBD,0x8E,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,
-	0x66,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0x6E,0x73,0xE4,0x20,0x00,0x00,0x00,0x00,0x66,0x29,0xCB,0x5A,0x8A,0x52,0x25,0x29,0x25,0x19,0x49,0x4A,0x29,0x4A,0x25,0x29,0x00,0x00,0x62,0x10,0xE8,0x41,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x08,0xA3,0x18,0x62,0x18,0x66,0x29,0xC3,0x18,0xC3,0x10,0x6A,0x4A,0x8A,0x4A,0x86,0x31,0xC3,0x18,0x62,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x00,0x00,0x41,0x10,0xEB,0x72,0xEF,0x8B,0x35,0xA5,0x55,0xA5,0xF4,0xA4,0x76,0xA5,0x11,0x7C,0xE7,0x31,0x00,0x00,0x83,0x39,0xEB,0x72,0x4D,0x73,0xF4,0xA4,0xF4,0x9C,0x51,0x84,0x72,0x8C,0x92,0x94,0x31,0x8C,0x31,0x8C,
-	0xD3,0xA4,0x14,0xAD,0xAF,0x7B,0x8E,0x7B,0x30,0x8C,0x10,0x84,0xEF,0x8B,0x10,0x84,0x8E,0x83,0xF0,0x83,0x51,0x84,0x51,0x94,0x72,0x94,0x30,0x8C,0x51,0x84,0xF0,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x00,0x00,0xA3,0x18,0x55,0xB5,0xD7,0xB5,0x0C,0x5B,0x6A,0x4A,0xCB,0x5A,0xCB,0x52,0xCB,0x52,0x8A,0x52,0x8A,0x4A,0xCB,0x5A,0x8A,0x52,0x4D,0x63,0xD7,0xBD,0xD3,0x9C,0x82,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x01,0x08,0x00,0x00,0x21,0x08,0x82,0x18,0x29,0x4A,0x10,0x84,0x29,0x4A,0xC3,0x20,0x00,0x00,
-	0x21,0x08,0x42,0x10,0x00,0x00,0x6E,0x73,0x18,0xC6,0x7A,0xCE,0xEC,0x62,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0xC3,0x18,0xE4,0x20,0xA7,0x31,0x04,0x29,0x82,0x18,0xA3,0x18,0x01,0x08,0x00,0x08,0x82,0x18,0xEC,0x62,0x6E,0x73,0x6E,0x73,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x6A,0x52,0xA7,0x39,0x82,0x18,0x04,0x29,0xC3,0x20,0x41,0x10,0x62,0x10,0x82,0x10,0x01,0x08,0x62,0x08,0xC3,0x18,0x62,0x10,0x00,0x00,0x25,0x29,0x62,0x08,0x00,0x00,0x45,0x31,0x8E,0x7B,0xE8,0x39,0x21,0x08,0x62,0x10,0x41,0x08,0xC3,0x18,
-	0x6A,0x4A,0x72,0x8C,0x76,0xAD,0x59,0xC6,0xF8,0xC5,0x96,0xBD,0x31,0x8C,0x31,0x8C,0x72,0x8C,0xEC,0x62,0x66,0x31,0xAB,0x52,0x49,0x52,0x25,0x29,0x86,0x31,0x04,0x29,0x86,0x39,0xA3,0x18,0x82,0x10,0xE4,0x20,0x08,0x4A,0x45,0x29,0x41,0x10,0x21,0x08,0x21,0x08,0x6A,0x4A,0x45,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x08,0x4A,
-	0x66,0x31,0x00,0x08,0x04,0x21,0xF4,0x9C,0x8A,0x5A,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x41,0x08,0x00,0x00,0xA2,0x20,0x29,0x4A,0x8A,0x4A,0xE4,0x18,0x41,0x08,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x62,0x10,0xC3,0x20,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x62,0x10,0x4D,0x73,0xD7,0xC5,0xB7,0xB5,0x51,0x84,
-	0x51,0x8C,0x15,0x9D,0xEC,0x4A,0x00,0x00,0x08,0x52,0xEF,0x8B,0x92,0x9C,0x92,0x94,0x51,0x94,0xD3,0x9C,0xD3,0x94,0xD3,0x94,0x72,0x8C,0xD3,0x9C,0xF4,0x9C,0x51,0x94,0xF4,0x94,0xB3,0x94,0x10,0x8C,0xD3,0xA4,0x55,0xB5,0x55,0xAD,0x14,0xA5,0x14,0xAD,0x34,0xB5,0x34,0xB5,0xF4,0xAC,0xF4,0xAC,0xD3,0x9C,0x72,0x94,0x51,0x94,0x6E,0x73,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC3,0x20,0xD7,0xC5,0xF4,0x94,0x82,0x08,0x82,0x08,0xA3,0x18,0xC3,0x18,0xE4,0x18,0xE4,0x20,0x41,0x10,0x25,0x29,0x20,0x08,0x00,0x00,0xF0,0x83,0xEC,0x62,
-	0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x00,0x08,0x4A,0x34,0xB5,0xF8,0xC5,0x76,0xB5,0xB7,0xBD,0xB7,0xBD,0x55,0xAD,0xCB,0x5A,0x00,0x00,0x00,0x08,0x00,0x00,0xF0,0x83,0xF8,0xC5,0xF8,0xC5,0xCB,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x20,0x62,0x10,0xC3,0x20,
-	0x25,0x29,0x45,0x31,0xC3,0x18,0x82,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0x96,0xBD,0x96,0xBD,0x14,0xAD,0x14,0xA5,0xD3,0xA4,0xF0,0x7B,0x6E,0x73,0xCB,0x62,0x08,0x4A,0x66,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0xCB,0x5A,0x82,0x18,0x41,0x10,0xC3,0x18,0x25,0x21,0xC3,0x18,0xC3,0x20,
-	0xE4,0x20,0x00,0x00,0x41,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x4A,0xF8,0xBD,0x76,0xB5,0xEC,0x62,0x0C,0x6B,0x8E,0x7B,0x0C,0x6B,0x0C,0x6B,0x14,0xA5,0x39,0xCE,0xD7,0xC5,0x18,0xC6,0xD7,0xC5,
-	0xF8,0xC5,0x18,0xCE,0x18,0xCE,0xDB,0xE6,0xEF,0x8B,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x62,0x10,0x00,0x00,0x21,0x08,0x21,0x08,0x41,0x10,0xE4,0x18,0x62,0x10,0x41,0x08,0x21,0x08,0x62,0x08,0xC3,0x18,0xA3,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x00,0x08,0x21,0x10,0xA7,0x31,0xCB,0x52,0xA7,0x31,0x62,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x01,0x08,0x00,0x00,0x66,0x31,0xEF,0x8B,0x96,0xBD,0x11,0x7C,0x6E,0x63,0x10,0x8C,0x11,0x7C,0x66,0x21,0x04,0x29,0xEF,0x8B,0x34,0xB5,0x96,0xB5,0xD3,0xA4,0xF4,0x9C,0x15,0x9D,0x10,0x84,0xAF,0x7B,0x11,0x7C,0x0C,0x6B,0x6E,0x73,0xAF,0x7B,0x51,0x84,
-	0x30,0x8C,0x51,0x94,0x14,0xA5,0xD3,0x9C,0x14,0xAD,0x51,0x94,0x51,0x8C,0x96,0xB5,0xB7,0xB5,0xB7,0xB5,0x72,0x8C,0xD3,0x94,0x92,0x94,0xD3,0x9C,0x55,0xAD,0x30,0x8C,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x00,0x04,0x29,0xF8,0xC5,0xB3,0x94,0x04,0x21,0x65,0x21,0x66,0x31,0x66,0x29,0xE8,0x39,0xC7,0x39,0x25,0x21,0xC7,0x39,0x04,0x21,0x00,0x00,0x30,0x8C,0x2D,0x6B,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x08,0x00,0x00,0xF0,0x83,0xBB,0xDE,0x18,0xCE,0xB7,0xB5,0x96,0xB5,0x55,0xB5,0x96,0xB5,0x39,0xC6,0xF8,0xC5,
-	0x08,0x4A,0x00,0x00,0x00,0x00,0x31,0x84,0xF8,0xC5,0x18,0xC6,0x0C,0x6B,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x18,0xC3,0x18,0x62,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0xB7,0xBD,0xF8,0xBD,0xB7,0xBD,0xF8,0xC5,0x18,0xC6,0x18,0xCE,0x59,0xCE,0x59,0xD6,0x18,0xCE,
-	0x18,0xCE,0xF4,0xA4,0xEC,0x62,0xC3,0x18,0x00,0x08,0x00,0x00,0x62,0x10,0x82,0x10,0x45,0x29,0x8E,0x83,0xE8,0x41,0x45,0x29,0xC3,0x20,0x04,0x21,0xA3,0x18,0xE4,0x20,0x21,0x08,0x25,0x29,0xAF,0x7B,0x96,0xBD,0xF0,0x83,0xCB,0x62,0x8A,0x52,0x86,0x39,0x82,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x66,0x31,0x82,0x18,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x41,0x10,0x00,0x00,0x62,0x10,0x18,0xC6,0xD7,0xC5,0x18,0xCE,0x18,0xCE,0x18,0xCE,0x7A,0xD6,0x59,0xD6,0x96,0xBD,0x76,0xB5,0xD7,0xBD,0xD7,0xBD,0xF8,0xC5,0x18,0xC6,0x18,0xC6,0x18,0xCE,0x7A,0xD6,0x8A,0x52,0x00,0x00,0x41,0x10,0x42,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x45,0x29,0x66,0x31,0xA3,0x18,
-	0x21,0x08,0x62,0x10,0x41,0x10,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,
-	0x82,0x18,0x6A,0x4A,0x69,0x42,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA1,0x18,0x21,0x08,0x00,0x00,0x28,0x52,0x51,0x94,0x76,0xB5,0x35,0xA5,0x2D,0x6B,0x4D,0x73,0x6E,0x63,
-	0xA7,0x29,0x08,0x52,0xF4,0xAC,0xD7,0xC5,0xB7,0xBD,0x35,0xAD,0xF4,0x94,0x8A,0x52,0xCB,0x5A,0x4D,0x63,0x4D,0x63,0x6E,0x73,0x4D,0x73,0x72,0x8C,0x51,0x8C,0x72,0x8C,0xD3,0xA4,0xF4,0x9C,0x30,0x8C,0x14,0xA5,0xF8,0xC5,0xF4,0xAC,0xF4,0xAC,0x14,0xAD,0x35,0xAD,0x55,0xAD,0x92,0x94,0x92,0x9C,0xF4,0xAC,0xD3,0x9C,0xD3,0x94,0xAF,0x7B,
-	0x41,0x08,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x86,0x39,0xF8,0xC5,0xF4,0x94,0xA3,0x18,0x41,0x10,0xE4,0x20,0x04,0x21,0x86,0x31,0xE7,0x31,0xE4,0x18,0x04,0x21,0x82,0x18,0xA2,0x20,0xD3,0xA4,0x0C,0x5B,
-	0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x49,0x4A,0x1C,0xE7,0xD7,0xBD,0x35,0xAD,0x76,0xB5,0x96,0xBD,0x76,0xB5,0x55,0xAD,0x35,0xA5,0xF8,0xC5,0x14,0xA5,0x00,0x00,0x00,0x00,0x8A,0x52,0x59,0xCE,0x18,0xBE,0xEC,0x62,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0xE4,0x20,0x45,0x29,0xA3,0x18,0x45,0x31,
-	0x04,0x21,0xC3,0x18,0xE4,0x20,0x62,0x10,0x41,0x10,0x00,0x00,0xE4,0x20,0x76,0xB5,0xD7,0xBD,0x76,0xB5,0x76,0xB5,0x76,0xB5,0x76,0xB5,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0xD7,0xC5,0x18,0xC6,0x18,0xC6,0x96,0xBD,0x92,0x9C,0x28,0x52,0x41,0x08,0xCB,0x5A,0xB6,0xBD,0x39,0xCE,0x35,0xAD,0x86,0x39,0xA3,0x18,0xE4,0x20,0x21,0x08,0x41,0x08,
-	0x00,0x00,0xA7,0x39,0x14,0xAD,0xBB,0xDE,0xF8,0xC5,0x18,0xC6,0xF8,0xC5,0x39,0xCE,0xB2,0xA4,0x62,0x10,0x00,0x00,0x62,0x10,0xC3,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x62,0x08,0x15,0x9D,0xD7,0xC5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xD3,0x9C,0xD7,0xB5,0x96,0xB5,0x96,0xB5,0xD7,0xC5,0xD7,0xBD,0xD7,0xC5,
-	0xF8,0xC5,0xF8,0xC5,0x7A,0xCE,0x1C,0xE7,0xC6,0x39,0x00,0x00,0x62,0x10,0xA3,0x10,0xC3,0x20,0x82,0x10,0x21,0x08,0x41,0x10,0x00,0x00,0x08,0x42,0x49,0x4A,0x62,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x18,0x66,0x29,0xC3,0x18,0x00,0x00,0x21,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC7,0x41,0x92,0x9C,0xD7,0xB5,0x15,0x9D,0x4D,0x63,0x30,0x8C,0x51,0x94,0x2D,0x6B,0x34,0xB5,0x96,0xBD,0xD7,0xBD,0x76,0xA5,0xB3,0x8C,0x4D,0x63,0x69,0x42,0xC7,0x39,0xCB,0x5A,0xAF,0x6B,0x4D,0x73,0x30,0x8C,0x30,0x8C,0x51,0x94,0x92,0x94,0xF0,0x7B,
-	0xB2,0xA4,0x14,0xAD,0x35,0xAD,0x14,0xA5,0x11,0x7C,0x96,0xAD,0xD7,0xB5,0x96,0xAD,0xB7,0xBD,0xD7,0xBD,0xB7,0xAD,0xB7,0xB5,0x96,0xB5,0xD3,0x94,0xF0,0x7B,0xF0,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x00,0x08,0x4A,0x96,0xBD,0xD7,0xBD,0xF4,0x9C,0xF4,0xAC,0x72,0x94,0xE4,0x18,0xE4,0x20,0x45,0x31,0xA1,0x18,0x6E,0x73,0x92,0x9C,0x92,0x9C,0x59,0xD6,0xAB,0x52,0x00,0x00,0x62,0x10,0x42,0x10,0x41,0x10,0x00,0x00,0x21,0x08,0x14,0xA5,0x18,0xC6,0x55,0xB5,0x76,0xAD,0x18,0xCE,0xB7,0xB5,0xB7,0xB5,0x55,0xAD,0x55,0xAD,0x96,0xB5,
-	0x76,0xAD,0x8A,0x5A,0x86,0x39,0xAF,0x7B,0x76,0xB5,0x18,0xC6,0xEC,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xE4,0x20,0x04,0x21,0x45,0x31,0x25,0x29,0xE4,0x20,0x04,0x29,0x62,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0xD7,0xC5,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xB5,0x55,0xAD,0x55,0xB5,0x76,0xB5,0x76,0xB5,
-	0x55,0xB5,0x55,0xB5,0x55,0xB5,0x96,0xB5,0x59,0xCE,0x76,0xB5,0x00,0x00,0x25,0x29,0x51,0x8C,0x0C,0x6B,0x62,0x10,0x04,0x21,0x04,0x21,0x25,0x29,0x45,0x31,0x25,0x29,0x00,0x00,0x45,0x29,0x35,0xAD,0x96,0xBD,0x76,0xAD,0x55,0xAD,0x14,0xAD,0xD7,0xBD,0xB7,0xBD,0x86,0x31,0x00,0x00,0x41,0x08,0xA3,0x18,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x00,0x00,0xC3,0x18,0x62,0x10,0x21,0x08,0x14,0xA5,0xB7,0xBD,0x96,0xB5,0xF8,0xC5,0x35,0xAD,0x41,0x08,0x6A,0x4A,0xD7,0xBD,0x18,0xCE,0x28,0x52,0x4D,0x63,0x59,0xD6,0xD7,0xBD,0x18,0xC6,0x18,0xCE,0x92,0x94,0x82,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0xC3,0x18,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x41,0x10,0x49,0x4A,0x04,0x29,0x00,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x20,0x45,0x29,
-	0x21,0x08,0x00,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x00,0x08,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x10,0x00,0x00,0xC3,0x20,0x30,0x8C,0x51,0x84,0x8A,0x4A,0x4D,0x73,0x8E,0x7B,0x14,0xAD,0x96,0xAD,0x96,0xB5,
-	0x55,0xA5,0x96,0xB5,0x14,0xA5,0xCB,0x52,0xC7,0x39,0xAB,0x5A,0x6A,0x52,0xEB,0x72,0xEF,0x8B,0xF0,0x83,0x51,0x8C,0x55,0xB5,0x96,0xAD,0xD3,0x9C,0x0C,0x6B,0x51,0x94,0x55,0xAD,0x34,0xB5,0x59,0xD6,0x76,0xA5,0x82,0x08,0x45,0x29,0x6A,0x4A,0x6E,0x63,0x6E,0x73,0x4D,0x63,0xCB,0x5A,0x6E,0x73,0x4D,0x63,0x49,0x4A,0x8A,0x5A,0xF0,0x7B,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x5A,0x96,0xBD,0x18,0xC6,0x7A,0xCE,0x1C,0xE7,0xB7,0xB5,0x25,0x19,0x04,0x29,0x66,0x31,0xC3,0x18,0x14,0xAD,0xBB,0xDE,0x39,0xCE,0xBB,0xDE,0x8A,0x4A,
-	0x00,0x00,0x62,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x08,0x4A,0xBB,0xDE,0xF8,0xBD,0xB7,0xB5,0x39,0xCE,0x72,0x8C,0x62,0x10,0x2D,0x6B,0x18,0xC6,0x55,0xAD,0x55,0xB5,0x76,0xAD,0xF8,0xC5,0xF8,0xC5,0xD7,0xC5,0x14,0xAD,0xF8,0xBD,0xCB,0x62,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xC3,0x20,0x04,0x21,0xE4,0x18,0x45,0x31,
-	0x45,0x29,0x82,0x10,0x04,0x21,0x21,0x08,0x41,0x10,0x00,0x00,0x8A,0x5A,0x18,0xCE,0x76,0xB5,0x76,0xB5,0x96,0xB5,0xB7,0xBD,0xB7,0xBD,0x96,0xBD,0x76,0xB5,0xB7,0xBD,0x76,0xB5,0xB7,0xBD,0x76,0xB5,0x34,0xB5,0xB7,0xBD,0x55,0xAD,0x00,0x00,0xE8,0x41,0x34,0xB5,0x45,0x29,0x41,0x10,0xA3,0x18,0xC3,0x20,0x82,0x10,0x82,0x18,0xC3,0x20,
-	0x00,0x00,0xE8,0x39,0xB7,0xBD,0x96,0xB5,0x55,0xAD,0x35,0xAD,0x35,0xA5,0x96,0xB5,0xD3,0xA4,0x66,0x31,0x00,0x00,0x21,0x08,0xC3,0x18,0x62,0x10,0x41,0x08,0x41,0x10,0xE4,0x20,0x66,0x31,0x21,0x08,0x86,0x31,0x59,0xCE,0x96,0xBD,0x76,0xAD,0xB7,0xBD,0x6E,0x73,0x00,0x00,0x82,0x10,0x55,0xA5,0x7A,0xD6,0x04,0x29,0x4D,0x63,0x7A,0xD6,
-	0xD7,0xC5,0x7A,0xD6,0x8E,0x83,0x20,0x08,0x62,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x01,0x08,0x00,0x00,0x45,0x29,0x8A,0x52,0x04,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0xC3,0x18,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xA7,0x39,0x62,0x08,0x21,0x08,0x82,0x18,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0x62,0x10,0x04,0x29,0xA7,0x31,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x10,0x6A,0x62,0x92,0x94,0xD3,0x94,0x86,0x39,0xB2,0xA4,0xD7,0xBD,0xAF,0x6B,0xB3,0x9C,0x55,0xAD,0x76,0xB5,0x14,0xA5,0x0C,0x5B,0xEB,0x72,0x4D,0x73,0x72,0x94,0xB6,0xBD,0x55,0xAD,0x76,0xB5,0x76,0xB5,0xB7,0xB5,0x14,0xA5,0xF0,0x7B,0x10,0x84,0x92,0x9C,0x55,0xA5,
-	0x34,0xB5,0xD7,0xBD,0xB3,0x8C,0x24,0x09,0xE4,0x20,0xEB,0x72,0x8E,0x83,0x92,0x9C,0x51,0x94,0x51,0x94,0x14,0xA5,0xF4,0xAC,0xF4,0xAC,0x55,0xB5,0x96,0xBD,0x51,0x84,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x00,0x2D,0x6B,0xB7,0xBD,0xF8,0xC5,0xD7,0xBD,0x39,0xC6,0x55,0xA5,0xC3,0x10,0x25,0x19,0x25,0x21,0x82,0x18,0x30,0x8C,0xD7,0xC5,0xB7,0xBD,0x59,0xCE,0x49,0x4A,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xF0,0x83,0xBB,0xDE,0xF8,0xBD,0xF8,0xBD,0xD7,0xBD,0xA3,0x10,0x00,0x00,0x41,0x10,0x14,0xAD,0x76,0xAD,0x14,0xA5,
-	0x76,0xB5,0x35,0xA5,0x25,0x21,0x8E,0x7B,0x96,0xBD,0xD7,0xBD,0xAB,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0x04,0x29,0xA7,0x39,0xA3,0x18,0x00,0x08,0xE4,0x20,0x62,0x10,0xE4,0x20,0x62,0x10,0x21,0x08,0x00,0x00,0x8E,0x7B,0x59,0xCE,0x55,0xAD,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0xF4,0x9C,0x55,0xA5,0x18,0xC6,0xF8,0xC5,
-	0x35,0xAD,0x35,0xAD,0x55,0xAD,0x35,0xAD,0x34,0xB5,0xBB,0xDE,0x66,0x31,0x00,0x00,0x92,0x94,0x04,0x29,0x00,0x08,0x41,0x10,0xE4,0x20,0x04,0x21,0xC3,0x20,0xE4,0x20,0x00,0x00,0x29,0x42,0x18,0xC6,0x55,0xB5,0x14,0xA5,0x35,0xA5,0x55,0xB5,0x96,0xB5,0xF0,0x83,0x6E,0x73,0xA3,0x18,0x00,0x00,0xA3,0x18,0x62,0x10,0x21,0x08,0x62,0x10,
-	0x25,0x29,0x86,0x39,0x00,0x08,0x86,0x31,0x39,0xC6,0x96,0xBD,0xB7,0xB5,0xB7,0xBD,0x08,0x4A,0xC3,0x18,0xA3,0x18,0x4D,0x63,0xDB,0xD6,0x49,0x52,0xD0,0x73,0x59,0xD6,0x18,0xC6,0x1C,0xE7,0x0C,0x6B,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xAB,0x52,0x1C,0xE7,0xF8,0xC5,0x51,0x94,0x4D,0x73,0x04,0x29,
-	0x00,0x00,0x62,0x08,0x42,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x82,0x10,0xE4,0x20,0x00,0x00,0x25,0x29,
-	0xA7,0x39,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x25,0x21,0x82,0x10,0x45,0x31,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x08,0x4A,0xD3,0x9C,0x31,0x84,0x45,0x29,0xEB,0x72,0xB7,0xB5,0xF4,0x94,0xF0,0x83,0xF4,0x9C,0xB7,0xBD,
-	0x96,0xAD,0x51,0x84,0xF0,0x83,0x96,0xBD,0x34,0xB5,0xB7,0xBD,0xF4,0x9C,0x10,0x84,0x14,0xA5,0xD0,0x73,0x6E,0x63,0x14,0xAD,0x51,0x94,0x92,0x9C,0x34,0xB5,0x14,0xAD,0x76,0xB5,0x14,0xA5,0x60,0x08,0x83,0x39,0xD7,0xC5,0x39,0xCE,0xB7,0xBD,0xB6,0xBD,0x96,0xBD,0x55,0xB5,0x14,0xA5,0x35,0xA5,0x55,0xA5,0x76,0xAD,0xB6,0xBD,0x29,0x4A,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x8E,0x83,0x96,0xBD,0xF8,0xBD,0xF8,0xBD,0x18,0xCE,0xF4,0x9C,0xA3,0x18,0x04,0x29,0x04,0x21,0xA3,0x18,0x92,0x9C,0xD7,0xC5,0x96,0xBD,0x7A,0xCE,0x08,0x42,
-	0x00,0x00,0x62,0x10,0x41,0x10,0x00,0x08,0x41,0x08,0x35,0xAD,0x7A,0xD6,0x96,0xB5,0x96,0xB5,0xD7,0xBD,0x45,0x29,0x00,0x00,0x00,0x00,0xF0,0x7B,0xF8,0xC5,0x35,0xA5,0xD7,0xB5,0x14,0xA5,0x00,0x00,0xCB,0x62,0xB7,0xBD,0xD7,0xBD,0xCB,0x5A,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0xE4,0x20,0x29,0x42,0x25,0x29,0x62,0x10,
-	0x82,0x10,0x00,0x00,0xC7,0x41,0x10,0x8C,0x42,0x10,0x00,0x00,0x31,0x8C,0x59,0xD6,0x34,0xB5,0x55,0xB5,0x55,0xAD,0xF8,0xC5,0xCB,0x5A,0x00,0x00,0x65,0x21,0x10,0x84,0xB6,0xBD,0x34,0xB5,0x55,0xAD,0x14,0xAD,0x14,0xAD,0x18,0xCE,0xC3,0x18,0x21,0x08,0x30,0x8C,0x51,0x94,0x92,0x9C,0xA3,0x18,0x82,0x10,0x04,0x21,0x04,0x21,0xE4,0x20,
-	0x00,0x00,0x29,0x42,0x18,0xC6,0x35,0xAD,0x14,0xAD,0x35,0xAD,0x76,0xAD,0x96,0xBD,0xE8,0x41,0xAB,0x5A,0xE4,0x20,0x00,0x00,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0x25,0x29,0x25,0x29,0x00,0x00,0x66,0x29,0x39,0xC6,0x76,0xAD,0xF8,0xBD,0xD3,0xA4,0x82,0x10,0xC3,0x18,0xA3,0x18,0xA3,0x18,0x51,0x8C,0x8A,0x5A,0xAF,0x7B,0x39,0xCE,
-	0xF8,0xBD,0xBB,0xDE,0xEB,0x72,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0xE4,0x20,0x00,0x00,0xAB,0x52,0x39,0xC6,0x96,0xBD,0x39,0xC6,0x1C,0xE7,0x0C,0x6B,0x00,0x00,0x62,0x10,0x21,0x08,0x41,0x08,0x62,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x82,0x18,0x41,0x08,0x41,0x08,0x41,0x10,0x62,0x18,0xE4,0x20,0xA7,0x31,0x82,0x18,0x21,0x08,0x21,0x08,0x00,0x00,0x21,0x08,0xE4,0x20,0xC3,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x21,0x08,0x00,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x10,0x01,0x08,0x66,0x31,0x6A,0x4A,0xB3,0x8C,0x6A,0x4A,0x28,0x52,0xD3,0xA4,0xB3,0x8C,0x4D,0x63,0xB2,0xA4,0x35,0xA5,0x35,0xA5,0xF0,0x7B,0xF4,0x9C,0x96,0xBD,0x55,0xAD,0xB7,0xAD,0x76,0xB5,0x55,0xAD,0x14,0xAD,0x14,0xAD,0xAF,0x6B,0xEC,0x62,0x14,0xAD,0x14,0xA5,0xF4,0xAC,0x14,0xAD,0x55,0xB5,
-	0x76,0xB5,0xF4,0xAC,0xB2,0xA4,0x18,0xCE,0xD7,0xBD,0x14,0xAD,0xF4,0xAC,0x34,0xB5,0x96,0xB5,0xB7,0xBD,0x96,0xBD,0xB7,0xBD,0x18,0xC6,0x18,0xCE,0x18,0xC6,0xF0,0x7B,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0x00,0x00,0x8E,0x83,0x96,0xBD,0xF8,0xBD,0xD7,0xBD,0x39,0xCE,0xF4,0x9C,0x82,0x08,0x66,0x31,0x04,0x29,0x62,0x18,0x72,0x94,0x39,0xC6,0x96,0xBD,0xF8,0xBD,0xE8,0x39,0x00,0x00,0x41,0x10,0x62,0x10,0x00,0x00,0xC3,0x18,0x96,0xBD,0x18,0xC6,0x76,0xAD,0x96,0xB5,0x7A,0xD6,0xAF,0x6B,0x00,0x00,0x00,0x00,0x2D,0x6B,0x7A,0xCE,0x55,0xAD,
-	0x96,0xB5,0x18,0xBE,0x25,0x29,0xCB,0x62,0x96,0xB5,0x96,0xBD,0x8A,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x08,0x86,0x39,0x49,0x4A,0x29,0x4A,0xC3,0x20,0x00,0x00,0x08,0x4A,0x55,0xB5,0x21,0x08,0x00,0x00,0x14,0xAD,0x7A,0xD6,0x76,0xB5,0x35,0xAD,0x35,0xAD,0x18,0xC6,0xB6,0xBD,0x00,0x08,0x00,0x00,0xC3,0x20,
-	0x76,0xB5,0x55,0xB5,0x34,0xB5,0x34,0xB5,0x14,0xAD,0xF8,0xC5,0x66,0x31,0x25,0x29,0x2D,0x6B,0x0C,0x5B,0x6E,0x73,0x04,0x29,0x62,0x10,0xA3,0x10,0xE4,0x20,0xE4,0x20,0x00,0x08,0x2D,0x6B,0xD7,0xBD,0x14,0xAD,0x55,0xAD,0x14,0xA5,0x14,0xA5,0xB6,0xBD,0x82,0x18,0x00,0x00,0x62,0x10,0x21,0x08,0x82,0x18,0x62,0x10,0x00,0x00,0xC3,0x20,
-	0x25,0x29,0x45,0x29,0x00,0x00,0x45,0x29,0x59,0xCE,0x96,0xB5,0x18,0xC6,0x8E,0x7B,0x41,0x10,0x62,0x18,0xE4,0x20,0x04,0x21,0x62,0x10,0x45,0x29,0xB7,0xB5,0x39,0xCE,0xB7,0xBD,0xBB,0xDE,0x08,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x2D,0x6B,0x18,0xC6,0x76,0xB5,0x76,0xB5,0x59,0xCE,0x8A,0x5A,
-	0x00,0x00,0x41,0x08,0x00,0x00,0xAB,0x52,0xD7,0xBD,0x8E,0x83,0x08,0x4A,0xE4,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xA3,0x18,0x66,0x31,0xE4,0x20,0x00,0x08,0x0C,0x5B,0xA7,0x31,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA3,0x18,0x45,0x31,0xA7,0x39,0x29,0x4A,0xE4,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x28,0x52,0x92,0x9C,0x92,0x9C,0xF4,0xAC,0x76,0xB5,0xD0,0x73,0xE7,0x31,0x2D,0x6B,0x92,0x8C,0xF0,0x7B,0x6E,0x73,
-	0x92,0x94,0x35,0xAD,0x35,0xAD,0x55,0xAD,0x76,0xAD,0xF4,0x9C,0x14,0xA5,0xF4,0xA4,0x14,0xA5,0x35,0xAD,0xB2,0xA4,0xD3,0xA4,0x35,0xAD,0x76,0xAD,0x76,0xB5,0xF4,0xA4,0xD3,0x9C,0x96,0xBD,0x59,0xC6,0x18,0xBE,0xB7,0xBD,0x96,0xB5,0x15,0x9D,0x76,0xA5,0xD3,0x9C,0xF4,0x94,0xB3,0x8C,0xD0,0x73,0x4D,0x63,0x0C,0x5B,0xCB,0x52,0x8A,0x4A,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x31,0x8C,0xD7,0xBD,0xF8,0xC5,0xF8,0xBD,0x59,0xD6,0xD3,0x9C,0x41,0x00,0x25,0x21,0xC3,0x20,0xA1,0x18,0x51,0x94,0x59,0xD6,0x96,0xBD,0xF8,0xC5,0x76,0xAD,
-	0xA3,0x18,0x00,0x00,0x62,0x10,0x00,0x00,0x62,0x10,0x76,0xB5,0xF8,0xC5,0x76,0xAD,0x18,0xC6,0x92,0x8C,0x42,0x10,0x00,0x00,0x00,0x00,0x6E,0x73,0x59,0xD6,0x55,0xAD,0x55,0xAD,0x59,0xC6,0x45,0x31,0xEC,0x62,0xD7,0xC5,0xB7,0xBD,0x29,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0xA3,0x10,0x25,0x29,0x29,0x4A,0xCB,0x5A,
-	0xC7,0x39,0x45,0x29,0xA7,0x39,0xCB,0x5A,0x00,0x00,0x01,0x08,0x55,0xAD,0x7A,0xD6,0x96,0xBD,0x96,0xBD,0xD7,0xC5,0x14,0xA5,0x8A,0x5A,0x66,0x31,0x00,0x00,0x00,0x00,0x51,0x8C,0x96,0xBD,0xF4,0xA4,0xF4,0xAC,0x14,0xAD,0xB7,0xBD,0x86,0x39,0x6A,0x52,0x86,0x39,0x00,0x08,0x00,0x00,0xE4,0x20,0xC3,0x20,0x21,0x08,0xC3,0x20,0xE4,0x20,
-	0x00,0x00,0x51,0x94,0xF8,0xBD,0x14,0xAD,0x55,0xB5,0x14,0xA5,0x96,0xB5,0x72,0x94,0x00,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x00,0x00,0xA3,0x18,0x45,0x29,0x8A,0x5A,0x00,0x08,0x45,0x29,0x39,0xC6,0xB7,0xBD,0xF8,0xC5,0x8A,0x5A,0xA3,0x18,0xC3,0x18,0xE4,0x20,0x45,0x29,0xE4,0x20,0x00,0x00,0xF0,0x7B,0x7A,0xD6,
-	0xF8,0xC5,0x39,0xCE,0x04,0x29,0x00,0x00,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xD0,0x73,0x59,0xCE,0x96,0xBD,0x76,0xAD,0x39,0xCE,0x28,0x52,0x00,0x00,0x00,0x00,0x82,0x18,0x76,0xAD,0x59,0xCE,0x18,0xCE,0x1C,0xE7,0xF0,0x83,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0xA7,0x39,0x28,0x3A,0x00,0x00,0x00,0x00,0x41,0x20,0xC7,0x41,0x28,0x3A,0xE8,0x39,0x82,0x10,0x41,0x08,0x21,0x08,0x62,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x42,0x10,0x21,0x08,0x00,0x00,0x49,0x52,0xF4,0xAC,0x51,0x94,0x55,0xA5,0x11,0x7C,0x31,0x84,0xC7,0x39,0x2D,0x6B,0xEC,0x5A,0xC6,0x39,0xB6,0xBD,0x76,0xAD,0x6E,0x63,0x51,0x84,0x55,0xA5,0xF0,0x7B,0x30,0x8C,0x14,0xA5,0x14,0xAD,0xB2,0xA4,0x92,0x8C,0x14,0xA5,0xD7,0xBD,0xD3,0x94,0x31,0x84,0xB3,0x9C,0x55,0xA5,
-	0x15,0x9D,0xD3,0x94,0x51,0x84,0x6E,0x63,0xAB,0x52,0x69,0x42,0x28,0x3A,0xA7,0x31,0xC6,0x39,0x49,0x52,0x08,0x4A,0x8A,0x5A,0xCB,0x62,0x4D,0x63,0x8E,0x83,0x6E,0x73,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x01,0x08,
-	0x62,0x10,0x92,0x9C,0x96,0xBD,0xF8,0xBD,0xB7,0xB5,0x18,0xC6,0xB3,0x94,0x62,0x08,0x66,0x31,0x66,0x29,0xC3,0x20,0xF4,0xAC,0x39,0xCE,0x96,0xB5,0x39,0xCE,0x96,0xB5,0x41,0x08,0x00,0x00,0x62,0x10,0x00,0x00,0x82,0x18,0x35,0xAD,0xF8,0xC5,0x55,0xB5,0x39,0xC6,0x0C,0x5B,0x00,0x00,0x21,0x08,0x00,0x00,0x6E,0x73,0xF8,0xC5,0x35,0xA5,
-	0x35,0xAD,0xB7,0xBD,0xE8,0x39,0x2D,0x6B,0x76,0xB5,0xD7,0xBD,0x49,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xC3,0x18,0xA3,0x18,0x25,0x29,0xC7,0x39,0xE8,0x41,0x86,0x31,0x62,0x10,0x00,0x08,0x00,0x00,0x82,0x18,0x76,0xB5,0x18,0xCE,0x96,0xB5,0x76,0xB5,0x39,0xCE,0x2D,0x6B,0x00,0x00,0x10,0x8C,0xD7,0xC5,0xA7,0x39,
-	0x8E,0x7B,0x76,0xB5,0xF4,0xAC,0x14,0xA5,0xB7,0xBD,0x92,0x94,0x21,0x08,0x92,0x9C,0x8E,0x7B,0x41,0x10,0x04,0x29,0x04,0x29,0xC3,0x18,0x62,0x10,0xC3,0x18,0x04,0x21,0x00,0x00,0x72,0x94,0xF8,0xC5,0x14,0xA5,0x14,0xAD,0x14,0xA5,0xD7,0xC5,0x6E,0x73,0x00,0x00,0x21,0x08,0x62,0x10,0x00,0x08,0x86,0x31,0xC3,0x20,0x00,0x00,0x04,0x21,
-	0x04,0x21,0xE8,0x39,0xA3,0x18,0x6A,0x52,0x39,0xC6,0xD7,0xC5,0x76,0xB5,0x45,0x31,0xC3,0x18,0x45,0x29,0x66,0x31,0x45,0x29,0x45,0x29,0xE4,0x20,0xCB,0x5A,0x18,0xC6,0x39,0xCE,0xD7,0xC5,0xC3,0x20,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x6E,0x63,0x39,0xC6,0x76,0xB5,0xB7,0xB5,0xF8,0xC5,0xE8,0x41,
-	0x00,0x00,0x00,0x00,0xAF,0x6B,0x59,0xD6,0x76,0xAD,0xB7,0xB5,0x7A,0xD6,0x49,0x52,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xC7,0x39,0xA7,0x31,0x00,0x00,0x00,0x00,0xC7,0x41,
-	0x92,0x94,0x69,0x42,0x00,0x00,0x00,0x00,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x21,0x08,0x21,0x10,0x08,0x52,0x55,0xB5,0x6E,0x63,0x8E,0x7B,0xD3,0x94,0x6E,0x73,0xD0,0x73,0x41,0x00,0x04,0x29,0xEB,0x72,0xF0,0x83,0xB3,0x8C,
-	0xF0,0x7B,0x92,0x94,0x51,0x94,0x92,0x94,0xB3,0x9C,0x96,0xBD,0xB7,0xBD,0xD3,0x9C,0x92,0x94,0x14,0xA5,0xF4,0x9C,0xB3,0x94,0x92,0x94,0x92,0x9C,0x51,0x8C,0xAF,0x7B,0xAF,0x7B,0x0C,0x6B,0xE7,0x31,0xC6,0x39,0x8E,0x83,0x51,0x94,0xB2,0xA4,0xF4,0xAC,0x34,0xB5,0x55,0xB5,0x55,0xB5,0x55,0xB5,0x55,0xA5,0xB6,0xBD,0xB7,0xBD,0xD3,0xA4,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x04,0x29,0xB2,0xA4,0xB7,0xBD,0x18,0xC6,0x96,0xBD,0x39,0xCE,0xB3,0x94,0xA3,0x10,0x86,0x31,0x66,0x31,0xC3,0x18,0xF4,0xAC,0x59,0xD6,0x96,0xB5,0x59,0xCE,0x10,0x84,
-	0x00,0x00,0x62,0x10,0x62,0x10,0x00,0x00,0xC3,0x20,0x55,0xAD,0xD7,0xBD,0x55,0xAD,0x18,0xC6,0x2D,0x6B,0x00,0x00,0x41,0x10,0x00,0x00,0x8A,0x5A,0x18,0xCE,0x14,0xAD,0x55,0xA5,0xB7,0xBD,0xCB,0x5A,0xAF,0x7B,0x76,0xAD,0x35,0xAD,0xE8,0x39,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x04,0x21,0xE4,0x20,0xE4,0x20,0x82,0x18,
-	0x86,0x31,0x04,0x21,0x08,0x4A,0x45,0x29,0x00,0x00,0x41,0x08,0x14,0xAD,0x39,0xCE,0xB7,0xBD,0x76,0xB5,0x39,0xCE,0x4D,0x73,0x00,0x00,0x41,0x08,0x6A,0x4A,0xC3,0x18,0xAF,0x7B,0x96,0xBD,0xF4,0xA4,0xD3,0xA4,0xD7,0xC5,0x6E,0x73,0x00,0x00,0x31,0x8C,0x49,0x52,0x00,0x00,0xEC,0x5A,0x14,0xA5,0xF0,0x83,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x62,0x10,0x14,0xA5,0xB7,0xBD,0x14,0xA5,0x14,0xAD,0x35,0xAD,0xF8,0xC5,0xCB,0x62,0x00,0x00,0x41,0x08,0x21,0x08,0x21,0x08,0xAF,0x7B,0xCB,0x62,0x00,0x00,0xC3,0x20,0x25,0x29,0x45,0x31,0x41,0x08,0xCB,0x5A,0x59,0xCE,0x59,0xCE,0x92,0x9C,0xA3,0x18,0x82,0x18,0xC3,0x20,0x25,0x29,0xE4,0x20,0x25,0x29,0x45,0x29,0xAB,0x52,0x18,0xC6,
-	0x39,0xCE,0xF4,0xA4,0x60,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0xAB,0x52,0x18,0xC6,0x35,0xAD,0x96,0xB5,0xF8,0xC5,0x86,0x39,0x00,0x00,0x45,0x29,0xF8,0xBD,0xD7,0xC5,0x35,0xAD,0x18,0xC6,0x51,0x94,0x82,0x10,0xF0,0x83,0x86,0x39,0x00,0x00,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x66,0x31,0x8A,0x4A,0x00,0x00,0x00,0x08,0x8E,0x83,0xB3,0x8C,0x66,0x21,0x00,0x00,0x21,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x00,0x08,0x2D,0x6B,0x92,0x9C,0xB7,0xB5,0xF0,0x7B,0x51,0x8C,0xF0,0x83,0x55,0xAD,0xA7,0x31,0x00,0x00,0x8E,0x83,0x14,0xAD,0x31,0x84,0xEF,0x8B,0xB6,0xBD,0xD7,0xC5,0x76,0xB5,0x55,0xB5,0x18,0xC6,0xF8,0xBD,0x14,0xA5,0x92,0x94,0x92,0x94,0xF4,0xA4,0xB3,0x9C,0x92,0x94,0x92,0x94,0x51,0x8C,0x72,0x94,0x51,0x94,
-	0xF4,0xAC,0x14,0xAD,0x34,0xB5,0x96,0xBD,0x18,0xC6,0xD7,0xBD,0x96,0xBD,0x96,0xB5,0x55,0xAD,0x14,0xAD,0x34,0xB5,0x34,0xB5,0x14,0xAD,0x14,0xAD,0x35,0xAD,0x72,0x94,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0xA7,0x31,0x55,0xAD,0x96,0xBD,0x39,0xC6,0xD7,0xBD,0x7A,0xCE,0xB3,0x8C,0x00,0x00,0x45,0x29,0x45,0x29,0xE4,0x20,0x76,0xB5,0x59,0xCE,0xD7,0xBD,0x7A,0xD6,0x10,0x84,0x00,0x00,0x62,0x10,0x42,0x10,0x00,0x00,0x66,0x31,0xB7,0xBD,0x96,0xBD,0x55,0xAD,0x18,0xC6,0xAF,0x6B,0x00,0x00,0x41,0x10,0x00,0x00,0x6A,0x52,0x18,0xCE,0x55,0xB5,
-	0x35,0xA5,0xD7,0xBD,0x29,0x42,0xEC,0x62,0x76,0xB5,0x14,0xA5,0x45,0x29,0x00,0x00,0x42,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x66,0x29,0xE8,0x41,0x66,0x31,0xA7,0x39,0xC7,0x39,0xC7,0x41,0x6A,0x52,0x62,0x10,0x01,0x08,0x21,0x08,0x14,0xAD,0x39,0xCE,0x96,0xBD,0x96,0xBD,0xBB,0xDE,0x0C,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x72,0x94,0x34,0xB5,0xD3,0xA4,0xB3,0x9C,0xF8,0xC5,0x8A,0x52,0x21,0x08,0x72,0x94,0x86,0x39,0x21,0x08,0x86,0x31,0xD7,0xBD,0x55,0xB5,0x41,0x10,0x25,0x29,0x62,0x10,0x86,0x39,0xB7,0xBD,0x76,0xAD,0x35,0xAD,0x35,0xAD,0x55,0xAD,0x18,0xC6,0xC7,0x41,0x00,0x00,0x62,0x10,0x00,0x00,0xC3,0x18,0x39,0xC6,0x6E,0x73,0x00,0x00,0xA3,0x18,
-	0xC7,0x39,0xCB,0x5A,0x00,0x00,0x0C,0x6B,0x39,0xCE,0x59,0xCE,0x51,0x94,0x82,0x10,0xC3,0x20,0xE4,0x20,0x04,0x29,0xC3,0x20,0x45,0x29,0xE4,0x20,0xAB,0x52,0x39,0xC6,0xBB,0xDE,0x30,0x8C,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0xAB,0x52,0x39,0xC6,0x55,0xAD,0x96,0xB5,0x96,0xBD,0xA2,0x20,
-	0x00,0x00,0x72,0x8C,0x7A,0xCE,0x76,0xB5,0x55,0xAD,0x59,0xD6,0x49,0x52,0x00,0x00,0x6A,0x52,0x86,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0xE8,0x39,0x00,0x00,0x00,0x10,0xAF,0x7B,0x11,0x7C,0x41,0x00,
-	0x00,0x00,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x10,0xA3,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xA7,0x39,0xCB,0x5A,0x8E,0x7B,0x51,0x84,0x08,0x42,0x6E,0x73,0x35,0xAD,0x76,0xA5,0x61,0x00,0x08,0x52,0x15,0x9D,0xAF,0x7B,0xEF,0x8B,0x55,0xAD,
-	0x76,0xB5,0x96,0xB5,0x96,0xBD,0x76,0xAD,0x76,0xAD,0x35,0xA5,0xD3,0x94,0x51,0x8C,0xB3,0x9C,0xF4,0xA4,0xB3,0x9C,0x72,0x94,0x31,0x84,0x30,0x8C,0xF4,0xA4,0x14,0xA5,0x92,0x9C,0x14,0xAD,0x34,0xB5,0x76,0xAD,0x35,0xA5,0x55,0xB5,0x34,0xB5,0x14,0xAD,0x55,0xAD,0x55,0xB5,0x55,0xA5,0x35,0xA5,0x55,0xAD,0x55,0xAD,0x35,0xAD,0x72,0x94,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xA7,0x39,0x55,0xB5,0xD7,0xBD,0x18,0xC6,0x96,0xB5,0x59,0xCE,0x51,0x84,0x01,0x08,0x45,0x29,0x25,0x21,0xC3,0x20,0x96,0xBD,0x39,0xCE,0xD7,0xC5,0xBB,0xDE,0x51,0x8C,
-	0x00,0x00,0x42,0x10,0x62,0x10,0x00,0x00,0xC7,0x39,0x39,0xCE,0xB7,0xBD,0x35,0xAD,0x18,0xC6,0xAF,0x6B,0x00,0x00,0x41,0x10,0x00,0x00,0x28,0x52,0x18,0xCE,0x76,0xAD,0x35,0xAD,0xD7,0xBD,0x29,0x42,0x49,0x52,0x35,0xAD,0xF4,0x9C,0x04,0x21,0x00,0x00,0x42,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xE8,0x39,0xC7,0x41,0xA7,0x31,0x8A,0x52,
-	0x49,0x52,0x86,0x31,0xEC,0x62,0x21,0x08,0x00,0x00,0x41,0x10,0x34,0xB5,0x18,0xC6,0x55,0xB5,0x96,0xB5,0x59,0xCE,0x8E,0x7B,0x00,0x00,0x00,0x08,0x20,0x08,0xEF,0x8B,0xD7,0xC5,0xF4,0xAC,0xF4,0xAC,0x34,0xB5,0x55,0xB5,0xC3,0x20,0xCB,0x5A,0x92,0x9C,0xD3,0x9C,0x08,0x4A,0x00,0x00,0xF0,0x7B,0xD3,0xA4,0x82,0x10,0x0C,0x6B,0xA3,0x18,
-	0x6A,0x4A,0xF8,0xBD,0x14,0xAD,0x35,0xAD,0x35,0xAD,0x96,0xB5,0x34,0xB5,0x82,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x00,0x00,0xAF,0x7B,0x0C,0x6B,0x00,0x00,0xA3,0x18,0x08,0x42,0x51,0x8C,0xC3,0x20,0xAF,0x7B,0x39,0xCE,0x39,0xCE,0x8E,0x83,0x62,0x08,0x04,0x29,0x25,0x29,0x49,0x4A,0x04,0x21,0x04,0x21,0x41,0x10,0xCB,0x52,0x7A,0xD6,
-	0x7A,0xD6,0xF0,0x83,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xCB,0x5A,0x18,0xBE,0x35,0xAD,0x96,0xB5,0x35,0xAD,0x00,0x08,0xA3,0x10,0x18,0xC6,0x96,0xBD,0x76,0xB5,0x39,0xC6,0xD3,0xA4,0x00,0x00,0xA3,0x18,0x6A,0x52,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x20,0x41,0x08,0xA2,0x20,0x14,0xA5,0xEC,0x4A,0x00,0x00,0x00,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x00,0x00,0x30,0x8C,0x10,0x84,0xCB,0x52,0x31,0x84,0x8E,0x83,0x72,0x8C,0x6E,0x63,0x28,0x3A,0x00,0x00,0x08,0x4A,0xD3,0x9C,0xB2,0xA4,0xD7,0xC5,0x14,0xA5,0xD3,0x94,0xF4,0x9C,0x55,0xA5,0x76,0xAD,0x92,0x9C,0x51,0x8C,0xB2,0xA4,0x51,0x8C,0x55,0xAD,0xD3,0xA4,0x72,0x94,0xD3,0x9C,0xB3,0x9C,0xD3,0x94,0xF4,0xAC,0x51,0x94,
-	0x0C,0x6B,0x96,0xBD,0x55,0xAD,0x35,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x76,0xB5,0x76,0xB5,0x55,0xAD,0x14,0xAD,0x55,0xAD,0x35,0xAD,0x55,0xAD,0x92,0x94,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x86,0x39,0x34,0xB5,0xB7,0xBD,0x18,0xC6,0x96,0xB5,0x18,0xCE,0x6E,0x73,0x21,0x00,0x04,0x29,0x25,0x29,0x45,0x29,0x96,0xBD,0xF8,0xBD,0xB7,0xBD,0xBB,0xDE,0xD3,0x9C,0x00,0x00,0x00,0x00,0x62,0x10,0x00,0x00,0x25,0x29,0x96,0xBD,0x96,0xB5,0x55,0xAD,0x18,0xBE,0xF0,0x7B,0x00,0x00,0x21,0x08,0x00,0x00,0x08,0x4A,0xF8,0xC5,0x76,0xAD,
-	0xF4,0xA4,0xB7,0xBD,0xE8,0x41,0xE8,0x41,0xB7,0xBD,0x72,0x94,0xE4,0x20,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x18,0xC3,0x20,0xE4,0x20,0x66,0x31,0xA7,0x39,0xC7,0x39,0xA3,0x18,0x4D,0x73,0xC3,0x18,0x00,0x00,0x00,0x00,0xD3,0xA4,0x39,0xCE,0x96,0xBD,0x96,0xBD,0x96,0xBD,0xF8,0xC5,0xD7,0xBD,0xB6,0xBD,0x96,0xBD,0x7A,0xD6,
-	0xB7,0xBD,0x34,0xB5,0x55,0xB5,0xF8,0xC5,0x92,0x9C,0x00,0x00,0x8A,0x52,0xF0,0x83,0x45,0x29,0xA7,0x39,0x20,0x08,0xCB,0x5A,0xF0,0x83,0x41,0x08,0x25,0x29,0x00,0x00,0x0C,0x6B,0xD7,0xBD,0xD3,0xA4,0x34,0xB5,0x14,0xA5,0x96,0xBD,0xF0,0x83,0x00,0x00,0x41,0x08,0x41,0x10,0x62,0x10,0x00,0x00,0xA7,0x39,0xE8,0x41,0x00,0x00,0x82,0x18,
-	0x29,0x42,0x8A,0x52,0x00,0x00,0x10,0x84,0x39,0xCE,0x59,0xD6,0xEC,0x62,0x41,0x08,0x25,0x21,0x86,0x39,0x0C,0x6B,0x04,0x21,0x66,0x31,0x62,0x10,0x69,0x42,0x7A,0xCE,0x59,0xD6,0x8A,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x52,0xF8,0xC5,0x55,0xAD,0xD7,0xBD,0x55,0xB5,0x00,0x00,
-	0x0C,0x5B,0x7A,0xCE,0x96,0xB5,0xB7,0xBD,0x39,0xCE,0xA7,0x39,0x00,0x00,0x49,0x4A,0xE4,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE4,0x38,0xB3,0x8C,0x28,0x3A,0x00,0x00,0x00,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x00,0x00,0x25,0x29,0x96,0xBD,0x6E,0x63,0x6A,0x62,0x96,0xBD,0x76,0xAD,0xAF,0x6B,0x49,0x4A,0x00,0x00,0x00,0x00,0x8E,0x83,0xD7,0xBD,0x55,0xA5,0x76,0xB5,0xB3,0x94,
-	0xF0,0x83,0x31,0x8C,0x76,0xB5,0x39,0xCE,0xF8,0xBD,0xF8,0xC5,0xD7,0xBD,0x76,0xB5,0xF4,0x94,0xF4,0xA4,0x96,0xB5,0x76,0xB5,0x76,0xB5,0x55,0xAD,0x14,0xA5,0x14,0xA5,0xF4,0xA4,0x55,0xB5,0x55,0xAD,0x34,0xB5,0x55,0xB5,0x55,0xAD,0x55,0xAD,0x34,0xB5,0x55,0xA5,0x55,0xAD,0x55,0xAD,0x14,0xAD,0x55,0xAD,0x55,0xAD,0x35,0xA5,0x72,0x94,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x39,0xF8,0xBD,0xD7,0xBD,0x18,0xC6,0x96,0xBD,0x18,0xCE,0x0C,0x5B,0xC3,0x10,0x66,0x29,0x25,0x21,0x86,0x39,0x18,0xCE,0xB7,0xBD,0x96,0xB5,0xF8,0xC5,0xF8,0xC5,
-	0xE8,0x41,0x00,0x00,0x21,0x08,0x00,0x00,0x66,0x31,0xD7,0xC5,0x96,0xBD,0x55,0xB5,0xF8,0xC5,0x8E,0x7B,0x00,0x00,0x41,0x08,0x00,0x00,0xC7,0x41,0xD7,0xBD,0x55,0xAD,0x55,0xA5,0xF8,0xBD,0x49,0x4A,0x2D,0x6B,0xB7,0xBD,0x35,0xAD,0xC3,0x18,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x45,0x29,0xE4,0x20,0x82,0x18,
-	0xC3,0x10,0xE4,0x20,0x45,0x29,0x21,0x08,0x00,0x00,0x41,0x10,0x14,0xAD,0x39,0xCE,0xD7,0xBD,0xD7,0xBD,0x96,0xBD,0xB7,0xBD,0xF8,0xC5,0x18,0xC6,0xF8,0xC5,0xD7,0xBD,0x96,0xB5,0x76,0xB5,0xB7,0xBD,0xBB,0xDE,0x4D,0x73,0x00,0x00,0x2D,0x6B,0x76,0xB5,0xC3,0x20,0xC3,0x18,0xA3,0x18,0x25,0x29,0xC7,0x41,0xC3,0x18,0xA3,0x18,0x62,0x08,
-	0x72,0x8C,0x76,0xB5,0xF4,0x9C,0x14,0xA5,0xD3,0xA4,0x96,0xB5,0xCB,0x62,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x29,0xC7,0x41,0x00,0x08,0x62,0x10,0x08,0x4A,0x86,0x39,0x00,0x00,0xF4,0x9C,0x59,0xCE,0x59,0xD6,0x6A,0x52,0x41,0x10,0xC3,0x18,0xE8,0x41,0xCB,0x62,0xE4,0x20,0x25,0x21,0x41,0x10,0x08,0x42,0x7A,0xCE,
-	0x59,0xD6,0x08,0x4A,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x49,0x4A,0x18,0xC6,0x76,0xAD,0x18,0xBE,0x72,0x94,0x62,0x10,0xF4,0x9C,0x18,0xC6,0xB7,0xB5,0xBB,0xDE,0x10,0x84,0x00,0x00,0xC3,0x18,0xEC,0x62,0x01,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0xE4,0x38,0xB3,0x8C,0x66,0x21,0x00,0x00,0x41,0x08,0x82,0x18,0xC3,0x18,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xC3,0x20,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,
-	0x00,0x08,0x30,0x8C,0x14,0xAD,0x72,0x94,0xD7,0xC5,0x14,0xA5,0xD3,0x9C,0x92,0x94,0x69,0x42,0x00,0x00,0x42,0x28,0xF8,0xC5,0xD7,0xB5,0xF4,0x94,0x76,0xAD,0xF4,0x9C,0x51,0x8C,0xAF,0x6B,0x6E,0x63,0x6E,0x63,0xEC,0x5A,0xEC,0x4A,0x28,0x3A,0x66,0x31,0x28,0x3A,0x69,0x42,0x0C,0x5B,0x11,0x7C,0xAF,0x6B,0xAF,0x6B,0xB3,0x8C,0x96,0xAD,
-	0x96,0xBD,0xD7,0xC5,0x18,0xC6,0xD7,0xBD,0x96,0xBD,0x55,0xB5,0x35,0xA5,0x55,0xB5,0x30,0x8C,0xAF,0x7B,0x76,0xB5,0x55,0xAD,0x55,0xAD,0x76,0xB5,0x76,0xB5,0x72,0x94,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x49,0x52,0x55,0xB5,0xD7,0xC5,0x18,0xC6,0x96,0xBD,0x18,0xC6,0x0C,0x5B,0x00,0x00,0xA3,0x18,0x82,0x10,0x08,0x4A,0x59,0xD6,0xB7,0xBD,0x76,0xB5,0x76,0xB5,0x96,0xBD,0x1C,0xE7,0x51,0x94,0x00,0x00,0x00,0x00,0x45,0x29,0xD7,0xBD,0xB7,0xB5,0x55,0xAD,0x18,0xC6,0xD0,0x73,0x00,0x00,0x41,0x08,0x00,0x00,0x28,0x52,0x18,0xCE,0x14,0xAD,
-	0x14,0xAD,0xD7,0xBD,0x49,0x4A,0x21,0x08,0x45,0x31,0x6E,0x73,0xA3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x20,0x45,0x29,0x04,0x21,0x04,0x21,0x04,0x29,0xC3,0x20,0xC7,0x41,0xA7,0x39,0x00,0x00,0x00,0x00,0x62,0x10,0x34,0xB5,0x18,0xC6,0x96,0xB5,0xD7,0xC5,0x55,0xAD,0x55,0xAD,0x96,0xB5,0xB7,0xBD,0xF8,0xC5,0x96,0xBD,
-	0x96,0xBD,0x39,0xCE,0xBB,0xDE,0x51,0x8C,0x04,0x21,0xCB,0x5A,0xB3,0x9C,0x4D,0x73,0xC3,0x18,0xA3,0x18,0x66,0x31,0x45,0x29,0x41,0x10,0x04,0x21,0x41,0x10,0x04,0x21,0x35,0xAD,0x35,0xAD,0x14,0xA5,0xF4,0xA4,0xF4,0xA4,0xB7,0xBD,0x86,0x31,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0xC3,0x20,0x00,0x08,0x21,0x08,
-	0xE4,0x20,0x00,0x00,0x62,0x10,0x55,0xAD,0x59,0xCE,0xF4,0xAC,0xC3,0x18,0x82,0x10,0x82,0x18,0xEC,0x62,0xEC,0x62,0xC3,0x20,0x25,0x29,0x62,0x08,0xCB,0x5A,0x7A,0xCE,0xD7,0xC5,0x25,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE7,0x31,0x18,0xBE,0x76,0xB5,0x39,0xCE,0x4D,0x73,0x45,0x29,
-	0xD7,0xBD,0xB7,0xB5,0x7A,0xCE,0x18,0xCE,0xA3,0x18,0x00,0x00,0x82,0x10,0xE8,0x41,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x00,0x00,0x62,0x10,0x2D,0x6B,0x65,0x21,0x00,0x00,0x00,0x08,0x82,0x10,0x04,0x29,0xA3,0x18,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x00,0x00,0x45,0x29,0xD7,0xC5,0x76,0xB5,0x96,0xAD,0xF4,0xAC,0xB2,0xA4,0x51,0x84,0x6E,0x63,0x8E,0x7B,0x00,0x00,0x4D,0x73,0x18,0xBE,0x0C,0x5B,0x72,0x94,0x14,0xA5,0x4D,0x63,
-	0x6E,0x63,0x30,0x8C,0x8E,0x83,0x10,0x84,0xEF,0x8B,0x8E,0x83,0x8E,0x83,0x6A,0x62,0xCB,0x62,0x6A,0x62,0x08,0x52,0xC7,0x39,0xA7,0x31,0x86,0x31,0x49,0x4A,0x8A,0x5A,0x4D,0x63,0xF0,0x7B,0xD0,0x73,0x11,0x7C,0xF4,0x9C,0xD7,0xB5,0xD7,0xBD,0xD7,0xC5,0x34,0xB5,0x14,0xA5,0x35,0xA5,0x55,0xB5,0xD3,0x9C,0xD3,0x9C,0x76,0xB5,0x72,0x94,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x4D,0x73,0xD7,0xC5,0xB7,0xBD,0x18,0xC6,0x96,0xBD,0xD7,0xBD,0x2D,0x6B,0xCB,0x62,0x35,0xAD,0x04,0x29,0x8A,0x5A,0x59,0xD6,0xB7,0xBD,0x96,0xBD,0x55,0xB5,0x96,0xBD,
-	0x35,0xA5,0x6A,0x4A,0x00,0x00,0x00,0x00,0x62,0x10,0xF4,0xAC,0xD7,0xBD,0x35,0xA5,0xF8,0xC5,0xB3,0x94,0x00,0x00,0x00,0x08,0x00,0x00,0x6A,0x52,0x18,0xCE,0x55,0xAD,0x35,0xAD,0x76,0xB5,0xA7,0x39,0xC7,0x41,0x21,0x08,0x00,0x00,0x21,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x25,0x29,0x04,0x29,0xE4,0x20,0xE4,0x20,0xE4,0x20,
-	0x82,0x18,0x86,0x31,0x86,0x39,0x00,0x08,0x00,0x00,0xC3,0x20,0x55,0xB5,0xD7,0xC5,0x96,0xB5,0x96,0xB5,0x55,0xB5,0x96,0xBD,0xF8,0xBD,0xBB,0xDE,0xBB,0xDE,0x7A,0xD6,0x7A,0xD6,0x76,0xB5,0x6A,0x52,0x00,0x00,0x00,0x00,0xCB,0x5A,0x59,0xD6,0xF0,0x83,0x41,0x10,0x62,0x10,0x66,0x31,0xC3,0x20,0x21,0x08,0xA3,0x18,0x21,0x08,0xC7,0x39,
-	0x96,0xBD,0x55,0xB5,0xD3,0xA4,0xD3,0xA4,0x55,0xB5,0x35,0xAD,0xA3,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x21,0x08,0x62,0x10,0x25,0x29,0x00,0x00,0x25,0x21,0xB7,0xBD,0x7A,0xD6,0x0C,0x6B,0x62,0x08,0xA3,0x18,0x41,0x08,0x6E,0x73,0x0C,0x6B,0x82,0x18,0xC3,0x20,0x00,0x00,0x49,0x4A,0x39,0xCE,
-	0x14,0xAD,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x31,0xF8,0xBD,0x55,0xAD,0xD7,0xBD,0x31,0x8C,0xAF,0x6B,0x76,0xB5,0xD7,0xBD,0x1C,0xE7,0x8A,0x5A,0x00,0x00,0x21,0x08,0x82,0x10,0xE8,0x39,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x8A,0x52,0xA7,0x29,0x00,0x00,0xC3,0x18,0xE4,0x18,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,
-	0xE4,0x18,0x51,0x84,0xF8,0xC5,0xD3,0x94,0xB7,0xB5,0xB3,0x8C,0x08,0x4A,0x51,0x94,0xEC,0x4A,0x00,0x00,0x8E,0x83,0x55,0xAD,0x31,0x8C,0xB2,0xA4,0xB3,0x9C,0xB2,0xA4,0xEC,0x62,0x51,0x84,0x39,0xC6,0xB7,0xBD,0x55,0xAD,0xD7,0xBD,0x76,0xB5,0xB3,0x9C,0x72,0x8C,0xB6,0xBD,0x39,0xCE,0x96,0xBD,0x96,0xBD,0x55,0xAD,0x55,0xB5,0x92,0x9C,
-	0x30,0x8C,0x8E,0x7B,0xCB,0x5A,0xEB,0x72,0xEB,0x72,0x2D,0x6B,0xF0,0x7B,0x72,0x8C,0x35,0xA5,0x55,0xAD,0x55,0xA5,0x55,0xAD,0x34,0xB5,0x72,0x94,0xD3,0xA4,0x92,0x94,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,
-	0x8E,0x7B,0xD7,0xB5,0xB7,0xBD,0xD7,0xC5,0x96,0xB5,0xF8,0xBD,0x92,0x8C,0xEC,0x62,0xAF,0x6B,0x45,0x29,0x86,0x31,0xD7,0xC5,0xF8,0xC5,0x96,0xBD,0xB7,0xBD,0x18,0xCE,0x45,0x29,0x00,0x00,0x41,0x10,0x00,0x08,0x62,0x10,0xF4,0xAC,0xD7,0xBD,0x55,0xAD,0xD7,0xBD,0xB3,0x94,0x01,0x08,0x21,0x08,0x00,0x00,0x29,0x4A,0x39,0xCE,0x76,0xAD,
-	0x35,0xAD,0x14,0xAD,0x82,0x10,0x66,0x31,0x49,0x4A,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x66,0x29,0x04,0x21,0x25,0x29,0xE4,0x20,0x04,0x29,0x21,0x08,0x49,0x4A,0x49,0x52,0x00,0x00,0x00,0x00,0xC3,0x18,0x55,0xB5,0xB7,0xBD,0x55,0xB5,0x96,0xBD,0xF8,0xC5,0x08,0x4A,0x66,0x31,0x0C,0x5B,0x0C,0x6B,0xCB,0x5A,
-	0x08,0x4A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x20,0xBB,0xDE,0xB3,0x9C,0x66,0x31,0x45,0x29,0x45,0x31,0x04,0x29,0x25,0x29,0x45,0x31,0x41,0x08,0xAB,0x5A,0xD7,0xBD,0x14,0xA5,0xD3,0xA4,0xF4,0x9C,0x55,0xB5,0x72,0x94,0x01,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x42,0x10,0x21,0x08,0x62,0x10,
-	0x45,0x29,0x62,0x10,0x66,0x31,0x18,0xC6,0x7A,0xD6,0x28,0x52,0x82,0x18,0x25,0x29,0xA3,0x10,0x31,0x8C,0xEC,0x62,0x41,0x08,0x42,0x10,0x00,0x00,0x69,0x42,0xBB,0xDE,0xB2,0xA4,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x31,0xB7,0xB5,0x76,0xB5,0x76,0xB5,0xF4,0xAC,0x14,0xA5,
-	0xD3,0x9C,0x7A,0xD6,0x14,0xAD,0x00,0x00,0x00,0x08,0x62,0x10,0x41,0x10,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x08,0x04,0x21,0x29,0x42,0x00,0x00,0x62,0x10,0xE8,0x39,0xE4,0x18,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x82,0x18,0x28,0x52,0xEC,0x62,0xF4,0x94,0x72,0x8C,0xD0,0x73,0xF0,0x83,0xF4,0xA4,0xAF,0x7B,0x86,0x31,0x00,0x00,0xEF,0x8B,0xD7,0xBD,0xF4,0x9C,0xF4,0x9C,0xF4,0x9C,0x76,0xB5,
-	0xF0,0x7B,0x72,0x94,0xB7,0xBD,0x14,0xAD,0x14,0xA5,0x55,0xA5,0xB7,0xBD,0x35,0xAD,0xD3,0x9C,0x14,0xA5,0x72,0x8C,0xB3,0x9C,0x35,0xAD,0x34,0xB5,0x55,0xAD,0x96,0xB5,0xB7,0xBD,0x76,0xB5,0x14,0xA5,0xD3,0x94,0x14,0xA5,0x14,0xAD,0xB2,0xA4,0x51,0x8C,0x10,0x84,0x30,0x8C,0x51,0x94,0xD3,0x94,0x14,0xA5,0x14,0xAD,0x55,0xAD,0x72,0x94,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x08,0x42,0x10,0x10,0x8C,0x55,0xB5,0xF8,0xBD,0x18,0xC6,0x96,0xB5,0x39,0xC6,0x6E,0x73,0x00,0x00,0xA3,0x18,0xE4,0x20,0xC3,0x20,0x96,0xBD,0x39,0xCE,0xB7,0xBD,0xD7,0xBD,0x18,0xC6,
-	0x66,0x31,0x00,0x00,0x62,0x10,0x00,0x08,0x41,0x08,0xD3,0x9C,0x18,0xC6,0x55,0xAD,0xD7,0xBD,0xB3,0x94,0x21,0x08,0x21,0x08,0x00,0x00,0x49,0x52,0x39,0xCE,0x35,0xA5,0x55,0xAD,0xF4,0xA4,0x21,0x08,0xA3,0x18,0x8E,0x7B,0xE4,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xA3,0x18,0x82,0x18,0x25,0x29,0x45,0x29,0x25,0x29,
-	0x00,0x00,0x2D,0x6B,0x8A,0x5A,0x00,0x00,0x00,0x00,0x04,0x21,0x96,0xB5,0x96,0xBD,0x35,0xAD,0xD7,0xC5,0x14,0xA5,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x20,0xA3,0x18,0x00,0x00,0x25,0x21,0x51,0x8C,0xAF,0x7B,0x86,0x31,0x86,0x31,0xC7,0x39,0x66,0x31,0xC3,0x18,0x04,0x29,0x62,0x10,0x92,0x94,
-	0xF8,0xBD,0xB7,0xB5,0x35,0xAD,0xD3,0xA4,0x96,0xBD,0x2D,0x6B,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x20,0x6A,0x52,0x01,0x08,0xA7,0x39,0x7A,0xCE,0x39,0xCE,0x66,0x31,0x45,0x29,0x66,0x31,0xA7,0x31,0x55,0xAD,0x0C,0x6B,0x62,0x10,0x25,0x29,0x41,0x10,0xAB,0x52,0x1C,0xE7,
-	0x92,0x9C,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x29,0x96,0xBD,0x96,0xBD,0x35,0xAD,0xF4,0xAC,0xF4,0x94,0xF4,0x9C,0xF8,0xC5,0x86,0x39,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0xE8,0x39,0x82,0x10,0xA3,0x18,0x86,0x31,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x86,0x39,
-	0xD7,0xC5,0xB3,0x94,0xF0,0x83,0x6E,0x73,0x30,0x8C,0x14,0xA5,0xAF,0x6B,0xF4,0x94,0x45,0x29,0x00,0x00,0x92,0x9C,0x76,0xB5,0xF4,0x9C,0x76,0xB5,0x55,0xB5,0x76,0xB5,0x14,0xA5,0x76,0xB5,0x35,0xA5,0x35,0xA5,0x76,0xAD,0xF4,0xA4,0x31,0x8C,0x51,0x84,0x72,0x8C,0x51,0x8C,0x92,0x9C,0x35,0xAD,0x34,0xB5,0x14,0xA5,0x14,0xAD,0x55,0xAD,
-	0x14,0xAD,0xF4,0xAC,0x92,0x9C,0x72,0x8C,0x30,0x8C,0x30,0x8C,0x14,0xA5,0x76,0xB5,0x96,0xB5,0x55,0xAD,0x34,0xB5,0x35,0xA5,0x14,0xA5,0xF4,0xAC,0x96,0xB5,0x92,0x94,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x21,0x08,
-	0xF0,0x83,0xD7,0xBD,0xF8,0xBD,0xB7,0xB5,0x55,0xB5,0x18,0xCE,0x6E,0x63,0x62,0x08,0x86,0x31,0xA7,0x39,0x04,0x29,0x96,0xBD,0x39,0xCE,0x96,0xB5,0x76,0xB5,0x7A,0xD6,0x6A,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x00,0x00,0x8E,0x7B,0x18,0xCE,0x76,0xAD,0xD7,0xBD,0xB3,0x94,0x00,0x08,0x21,0x08,0x00,0x00,0x8A,0x5A,0x59,0xCE,0x14,0xA5,
-	0x35,0xAD,0xD3,0x9C,0x00,0x00,0x08,0x4A,0x59,0xC6,0x86,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0xA3,0x18,0xA3,0x18,0xC3,0x18,0x04,0x29,0x00,0x00,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x25,0x29,0x96,0xBD,0x96,0xB5,0x14,0xAD,0xF8,0xC5,0x31,0x8C,0x00,0x08,0x21,0x08,0x42,0x10,0x62,0x10,0x42,0x10,
-	0x21,0x08,0xC3,0x20,0xCB,0x62,0x41,0x10,0x21,0x08,0xA7,0x31,0xE4,0x20,0x29,0x42,0x66,0x31,0xA3,0x18,0xC3,0x20,0x82,0x18,0xE4,0x20,0xC3,0x18,0x45,0x31,0x76,0xB5,0x55,0xAD,0x51,0x8C,0x14,0xAD,0x35,0xAD,0xF8,0xC5,0xE8,0x41,0x00,0x00,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x25,0x29,
-	0x6A,0x52,0x00,0x00,0x29,0x42,0xDB,0xE6,0x51,0x94,0x61,0x10,0x82,0x10,0x41,0x10,0x29,0x42,0xF8,0xBD,0xCB,0x62,0xC3,0x18,0x45,0x31,0x82,0x10,0x8A,0x4A,0xDB,0xE6,0xF0,0x83,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xA7,0x29,0xB7,0xBD,0xB7,0xBD,0xF4,0xA4,0x92,0x9C,0xF4,0x9C,
-	0xB7,0xBD,0x8E,0x83,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0xE4,0x20,0x66,0x29,0x42,0x10,0x49,0x4A,0x82,0x10,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0xCB,0x62,0x76,0xA5,0x30,0x8C,0x55,0xAD,0x72,0x8C,0x72,0x8C,0xD3,0x94,0x11,0x7C,0x25,0x21,0xA3,0x18,0xA3,0x18,0xF0,0x83,0x18,0xC6,0xD7,0xC5,0x96,0xB5,0x76,0xB5,0x96,0xB5,
-	0x55,0xAD,0x35,0xAD,0x35,0xA5,0xF4,0xA4,0x55,0xAD,0x14,0xAD,0x10,0x84,0xEF,0x8B,0x8E,0x7B,0xB2,0xA4,0x96,0xB5,0x35,0xAD,0x14,0xAD,0x35,0xAD,0x34,0xB5,0x14,0xA5,0x14,0xAD,0x55,0xB5,0x55,0xAD,0xD7,0xBD,0x55,0xB5,0xF4,0xAC,0x92,0x94,0xD0,0x73,0x92,0x9C,0x34,0xB5,0x76,0xAD,0x34,0xB5,0x55,0xAD,0x55,0xAD,0x35,0xA5,0x72,0x94,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x62,0x10,0xD3,0xA4,0x55,0xB5,0xD7,0xBD,0xB7,0xBD,0x76,0xB5,0x39,0xCE,0xAF,0x6B,0x00,0x08,0x04,0x29,0x04,0x21,0x04,0x29,0x96,0xBD,0x18,0xCE,0xD7,0xBD,0x96,0xB5,0x7A,0xD6,
-	0xF0,0x83,0x00,0x08,0x21,0x08,0x62,0x10,0x00,0x00,0x49,0x52,0x18,0xCE,0x35,0xAD,0x55,0xB5,0x35,0xAD,0x82,0x10,0x00,0x00,0x00,0x00,0x2D,0x6B,0xF8,0xC5,0xB3,0x9C,0x76,0xB5,0x10,0x84,0x00,0x00,0x45,0x31,0x72,0x94,0xA3,0x18,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xE4,0x20,0xA3,0x18,0xE4,0x20,0x04,0x29,
-	0x00,0x00,0x66,0x31,0xC7,0x39,0x21,0x08,0x00,0x00,0x45,0x31,0xB7,0xBD,0x96,0xBD,0x14,0xAD,0x39,0xC6,0x31,0x8C,0x00,0x00,0x21,0x08,0x41,0x10,0x61,0x10,0x41,0x08,0x00,0x00,0x49,0x4A,0x6E,0x73,0x00,0x00,0x00,0x00,0xC7,0x41,0xF0,0x83,0xB3,0x9C,0x8A,0x52,0xC3,0x18,0x25,0x29,0xE4,0x20,0xE4,0x20,0x00,0x08,0xC7,0x39,0xF8,0xBD,
-	0x92,0x9C,0xAB,0x5A,0xD3,0xA4,0x96,0xB5,0xB7,0xBD,0x04,0x21,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x86,0x39,0x29,0x4A,0x00,0x00,0x4D,0x63,0x1C,0xE7,0x2D,0x6B,0x41,0x10,0xC3,0x20,0xA3,0x18,0x04,0x21,0x49,0x4A,0x25,0x29,0xC3,0x18,0xC3,0x18,0x21,0x08,0x6A,0x4A,0xDB,0xE6,
-	0x8A,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x29,0xB7,0xB5,0xB7,0xBD,0x14,0xAD,0x51,0x8C,0xF4,0xA4,0x76,0xAD,0xA3,0x18,0x00,0x00,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0xA7,0x39,0x45,0x29,0xA7,0x31,0x25,0x21,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x01,0x08,0x41,0x10,0x10,0x8C,
-	0x15,0x9D,0x10,0x84,0xF4,0x9C,0x92,0x8C,0x8E,0x83,0xD3,0x9C,0x8A,0x4A,0x49,0x52,0xEC,0x5A,0x62,0x10,0xEF,0x8B,0x39,0xC6,0x92,0x94,0x15,0x9D,0x96,0xB5,0x55,0xAD,0x96,0xBD,0x96,0xB5,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x76,0xB5,0x92,0x94,0x11,0x7C,0x51,0x84,0xF4,0xA4,0x55,0xB5,0xF4,0xAC,0x55,0xA5,0x14,0xAD,0x14,0xAD,0x55,0xAD,
-	0x55,0xAD,0x76,0xAD,0x55,0xB5,0x14,0xA5,0x55,0xAD,0xB7,0xB5,0x34,0xB5,0x51,0x94,0x51,0x94,0xD3,0x9C,0x14,0xA5,0x14,0xAD,0x14,0xAD,0x55,0xB5,0x55,0xAD,0x72,0x8C,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0xA3,0x18,
-	0xD3,0xA4,0x96,0xBD,0x18,0xC6,0xD7,0xBD,0x55,0xB5,0x39,0xC6,0xAF,0x6B,0x41,0x08,0x25,0x29,0x45,0x29,0x45,0x31,0x96,0xBD,0x18,0xC6,0xD7,0xC5,0x96,0xBD,0x18,0xC6,0x55,0xA5,0x21,0x08,0x00,0x00,0x62,0x10,0x00,0x00,0x04,0x29,0xB7,0xBD,0x55,0xAD,0x14,0xAD,0xF8,0xBD,0x2D,0x6B,0x00,0x00,0x82,0x18,0xF4,0xA4,0x76,0xB5,0xD3,0x9C,
-	0x96,0xB5,0x8A,0x52,0x00,0x00,0xE4,0x20,0x66,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x04,0x21,0xC3,0x18,0x04,0x21,0x04,0x21,0xA3,0x18,0xAB,0x5A,0x8E,0x7B,0x45,0x31,0x00,0x00,0xC6,0x39,0xD7,0xC5,0x96,0xB5,0x55,0xAD,0xF8,0xC5,0x31,0x84,0x01,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x00,0xA7,0x39,0x49,0x4A,0x00,0x00,0x42,0x10,0xC7,0x39,0x45,0x31,0x86,0x31,0xA3,0x18,0x62,0x10,0x04,0x29,0x25,0x29,0xC3,0x20,0x00,0x00,0xAB,0x5A,0xB7,0xBD,0x55,0xAD,0x55,0xAD,0x14,0xA5,0x96,0xBD,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x10,0x00,0x00,0x00,0x00,0x86,0x31,
-	0x45,0x29,0x00,0x00,0xF0,0x83,0xDB,0xE6,0x49,0x52,0x82,0x10,0xE4,0x20,0x25,0x29,0xC3,0x20,0x00,0x08,0xE4,0x20,0x25,0x29,0xE4,0x20,0x00,0x00,0x08,0x42,0x59,0xD6,0x25,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x45,0x29,0xD7,0xB5,0xB7,0xBD,0xF4,0xA4,0x92,0x94,0x35,0xAD,
-	0x0C,0x6B,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xC7,0x41,0x66,0x29,0x45,0x29,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0xE4,0x20,0x31,0x84,0xA7,0x31,0x0C,0x6B,0xAF,0x7B,0xEF,0x8B,0xF4,0x94,0x6A,0x4A,0x6A,0x52,0x92,0x8C,0xC3,0x10,0x00,0x00,0xF0,0x83,0x18,0xCE,0x72,0x8C,0x51,0x8C,0x14,0xAD,0xF4,0xA4,
-	0xB3,0x9C,0x76,0xAD,0xD3,0xA4,0x55,0xAD,0x96,0xB5,0x35,0xAD,0xF0,0x7B,0x4D,0x63,0xF0,0x7B,0x10,0x8C,0xF4,0xA4,0x35,0xAD,0x35,0xAD,0x35,0xA5,0x35,0xA5,0x55,0xAD,0x14,0xAD,0xB7,0xAD,0x92,0x94,0x92,0x9C,0x55,0xAD,0x35,0xAD,0x96,0xAD,0x76,0xB5,0x14,0xAD,0xD3,0x9C,0x55,0xAD,0x76,0xAD,0x35,0xAD,0x55,0xB5,0x55,0xAD,0x72,0x94,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x42,0x10,0x00,0x00,0x86,0x39,0x35,0xAD,0x76,0xB5,0x18,0xBE,0xD7,0xBD,0x96,0xB5,0x18,0xC6,0x4D,0x63,0x41,0x08,0x25,0x29,0x04,0x21,0x04,0x29,0x55,0xB5,0x18,0xC6,0xD7,0xC5,0xD7,0xC5,0xF8,0xBD,
-	0x39,0xC6,0x86,0x39,0x00,0x00,0x62,0x10,0x21,0x08,0x00,0x00,0xAF,0x7B,0x39,0xCE,0x14,0xA5,0x55,0xAD,0x96,0xBD,0xF0,0x83,0x92,0x9C,0x96,0xBD,0xF4,0xAC,0x55,0xA5,0x35,0xA5,0xC3,0x20,0x00,0x00,0xE8,0x41,0x72,0x94,0xC3,0x18,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0x04,0x29,0xE4,0x20,0x82,0x10,0xC3,0x20,
-	0x49,0x4A,0xE8,0x39,0x00,0x08,0x41,0x10,0x00,0x00,0x08,0x4A,0xF8,0xC5,0x14,0xAD,0x34,0xB5,0x96,0xBD,0x10,0x84,0x21,0x08,0x01,0x08,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x00,0x00,0x66,0x29,0x51,0x84,0x82,0x00,0x41,0x00,0xC3,0x10,0x82,0x08,0x00,0x00,0x82,0x08,0xC3,0x18,0x62,0x08,0x51,0x8C,0x18,0xBE,
-	0x76,0xAD,0x76,0xAD,0xF4,0xA4,0x76,0xAD,0xF4,0xAC,0xAB,0x5A,0xA7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0xCB,0x5A,0xAB,0x5A,0xF0,0x83,0x10,0x84,0x45,0x31,0x35,0xA5,0x39,0xCE,0x04,0x29,0xA3,0x18,0x04,0x29,0x04,0x21,0xA3,0x18,0xE4,0x20,0x25,0x29,0x04,0x21,0xA3,0x18,0xE4,0x20,0x51,0x84,0x96,0xB5,
-	0x41,0x10,0x00,0x00,0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0x00,0x08,0x41,0x10,0x00,0x00,0xC3,0x10,0x76,0xA5,0x96,0xBD,0x92,0x94,0xD3,0x9C,0x31,0x8C,0x41,0x10,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x20,0x08,0x4A,0x45,0x29,0x41,0x08,0x21,0x08,0x25,0x29,0xA3,0x18,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x01,0x08,0x21,0x08,0x66,0x31,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x41,0x10,0x61,0x10,0x61,0x10,0x00,0x08,0x82,0x18,0x66,0x31,
-	0x4D,0x73,0xB2,0xA4,0x96,0xBD,0x96,0xAD,0x4D,0x63,0xEC,0x62,0x8E,0x7B,0x0C,0x5B,0xE4,0x18,0x00,0x00,0x2D,0x6B,0xF8,0xC5,0x55,0xAD,0x96,0xBD,0x76,0xB5,0x14,0xA5,0xD3,0x9C,0x14,0xA5,0xF4,0x9C,0x72,0x8C,0x92,0x94,0x11,0x7C,0x6E,0x73,0x2D,0x6B,0xF0,0x83,0x92,0x9C,0x55,0xAD,0x55,0xAD,0x14,0xAD,0x14,0xAD,0x14,0xAD,0xF4,0xA4,
-	0x55,0xB5,0xF4,0x9C,0x51,0x84,0x34,0xB5,0xB6,0xBD,0xD3,0xA4,0xB2,0xA4,0x55,0xAD,0x55,0xAD,0x34,0xB5,0x34,0xB5,0x34,0xB5,0x55,0xA5,0x35,0xAD,0x55,0xAD,0x51,0x8C,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC3,0x20,
-	0x76,0xB5,0x96,0xB5,0xF8,0xC5,0xB7,0xBD,0x34,0xB5,0xD7,0xBD,0x8E,0x7B,0x62,0x18,0x25,0x29,0x04,0x21,0x45,0x31,0x96,0xBD,0xD7,0xBD,0xB7,0xBD,0xD7,0xBD,0xD7,0xC5,0x7A,0xD6,0x2D,0x6B,0x00,0x00,0x62,0x10,0x42,0x10,0x00,0x00,0x04,0x29,0xB7,0xBD,0xD7,0xC5,0x35,0xA5,0x14,0xA5,0xB7,0xBD,0x96,0xB5,0xF4,0xAC,0xB3,0x94,0x96,0xB5,
-	0x6E,0x73,0x00,0x00,0x00,0x08,0x21,0x08,0xCB,0x5A,0xC3,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x25,0x29,0xC3,0x20,0xC3,0x18,0xC3,0x20,0x62,0x10,0x21,0x08,0xF0,0x83,0x45,0x31,0x00,0x00,0x6A,0x52,0x1C,0xE7,0xF8,0xC5,0xB7,0xBD,0x18,0xCE,0x10,0x84,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x42,0x10,0x00,0x08,0x62,0x10,0x08,0x52,0xAB,0xAA,0x82,0x38,0xE4,0x38,0x24,0x51,0x24,0x51,0xA3,0x18,0xA3,0x18,0x82,0x08,0xA3,0x10,0xF4,0x94,0xF8,0xBD,0x96,0xAD,0xB7,0xAD,0xB7,0xAD,0xB7,0xAD,0xD7,0xB5,0xBA,0xCE,0x59,0xCE,0x35,0xAD,0x51,0x94,0xAF,0x7B,0x6A,0x52,0xA3,0x18,0x21,0x08,0x2D,0x6B,0x2D,0x6B,0x2D,0x6B,
-	0x66,0x31,0x25,0x21,0xF8,0xBD,0x35,0xAD,0xA3,0x18,0xE4,0x20,0x25,0x29,0xE4,0x20,0x86,0x31,0x66,0x31,0xC3,0x20,0xE4,0x20,0x04,0x21,0x6A,0x4A,0xB7,0xB5,0xF4,0xAC,0x41,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x62,0x10,0x62,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0xB7,0xAD,0x96,0xB5,0x72,0x94,0x35,0xAD,0x8A,0x52,
-	0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xA7,0x31,0xC3,0x18,0x01,0x08,0x86,0x31,0x66,0x31,0x62,0x10,0x00,0x00,0x62,0x10,0x41,0x10,0x62,0x10,
-	0x21,0x08,0x00,0x00,0x0C,0x6B,0xCB,0x52,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x42,0x10,0x62,0x10,0x41,0x10,0x00,0x00,0x6E,0x73,0xEF,0x8B,0x14,0xA5,0xF4,0x9C,0xF4,0x9C,0xEC,0x62,0x8E,0x7B,0x51,0x94,0xEC,0x5A,0x66,0x21,0x61,0x10,0x00,0x00,0x6A,0x52,0x18,0xCE,0x55,0xAD,0x55,0xAD,0x14,0xA5,0x76,0xAD,
-	0x96,0xB5,0x35,0xA5,0x10,0x84,0xF0,0x83,0x8E,0x7B,0x31,0x8C,0x2D,0x6B,0xEF,0x8B,0xB6,0xBD,0x76,0xB5,0xF4,0xA4,0x35,0xA5,0x14,0xAD,0x14,0xAD,0x35,0xA5,0x55,0xAD,0x14,0xAD,0x4D,0x73,0x55,0xAD,0x14,0xAD,0x35,0xA5,0x14,0xAD,0xB3,0x9C,0x76,0xB5,0x35,0xAD,0x55,0xAD,0xF4,0xAC,0x55,0xAD,0x35,0xAD,0x35,0xAD,0x35,0xAD,0x51,0x8C,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x25,0x29,0x92,0x9C,0x18,0xC6,0xF8,0xC5,0x76,0xB5,0x34,0xB5,0x96,0xBD,0xD7,0xBD,0x55,0xB5,0x55,0xB5,0xB6,0xBD,0xB6,0xBD,0xD7,0xC5,0xB7,0xBD,0xD7,0xC5,0xB7,0xBD,0x96,0xBD,
-	0x59,0xD6,0x51,0x84,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0x35,0xAD,0x18,0xCE,0xD7,0xC5,0xB7,0xBD,0xB7,0xBD,0x96,0xBD,0xF8,0xBD,0x92,0x94,0x62,0x10,0x00,0x00,0x00,0x08,0x04,0x21,0x08,0x42,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x25,0x21,0x82,0x10,0xC3,0x18,0xC3,0x18,
-	0x21,0x08,0xA7,0x39,0xCB,0x5A,0xA3,0x18,0x00,0x00,0x86,0x39,0xB3,0x9C,0xD3,0xA4,0x35,0xAD,0x7A,0xD6,0xD0,0x73,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x25,0x19,0xC4,0x70,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x22,0xB8,0x02,0xB8,0x22,0xA8,0x01,0xA0,0x01,0x98,0x21,0x88,0x46,0xB1,0x46,0xB1,
-	0x46,0xB1,0xE7,0xA9,0xE7,0xA9,0xAB,0xAA,0xAB,0xAA,0xAB,0xAA,0x92,0x94,0xB7,0xBD,0xD7,0xBD,0xD7,0xBD,0x96,0xBD,0x55,0xB5,0x51,0x94,0x8E,0x83,0x25,0x29,0x08,0x42,0xC3,0x20,0xC3,0x18,0x59,0xD6,0x6E,0x73,0x00,0x08,0xA3,0x18,0x41,0x10,0xA7,0x31,0x7A,0xD6,0x76,0xB5,0x04,0x29,0x82,0x10,0xE4,0x20,0x62,0x10,0x10,0x84,0x30,0x8C,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x00,0x08,0x00,0x00,0x31,0x84,0xD3,0xA4,0xCB,0x62,0x8A,0x5A,0xB3,0x94,0xB7,0xBD,0x14,0xA5,0xD3,0xA4,0x10,0x8C,0x21,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0xE4,0x18,0x04,0x29,0x25,0x29,0xA7,0x31,0x00,0x00,0x04,0x29,0xA7,0x39,0x21,0x08,0x41,0x08,0x00,0x08,0xCB,0x5A,0xAF,0x6B,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x51,0x94,0x92,0x8C,
-	0x4D,0x63,0xD7,0xBD,0xF0,0x7B,0xCB,0x52,0xD3,0x94,0x4D,0x63,0xA7,0x29,0x86,0x31,0x61,0x10,0x00,0x00,0x86,0x39,0xD7,0xC5,0x96,0xB5,0x55,0xAD,0x55,0xA5,0xB7,0xBD,0x8A,0x52,0xAF,0x6B,0x35,0xA5,0xD0,0x73,0xAF,0x7B,0xAF,0x6B,0xAF,0x7B,0x76,0xB5,0x55,0xAD,0x35,0xA5,0xB2,0xA4,0x14,0xA5,0x35,0xAD,0x35,0xA5,0x14,0xAD,0x96,0xAD,
-	0x8E,0x7B,0x51,0x94,0x96,0xBD,0x55,0xAD,0x55,0xAD,0x14,0xA5,0xD3,0x9C,0xF4,0xAC,0x55,0xAD,0x35,0xAD,0x35,0xAD,0x14,0xAD,0x14,0xA5,0x35,0xAD,0x14,0xAD,0x72,0x94,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x82,0x10,
-	0x8E,0x83,0x18,0xCE,0xF8,0xBD,0x96,0xBD,0x96,0xBD,0x55,0xB5,0x96,0xBD,0xF8,0xC5,0xF8,0xC5,0xD7,0xC5,0xD7,0xBD,0xB7,0xBD,0x96,0xBD,0x96,0xBD,0xD7,0xBD,0xD7,0xBD,0xF8,0xC5,0x92,0x94,0x45,0x29,0x00,0x00,0x41,0x10,0x42,0x10,0x41,0x10,0x00,0x00,0xA3,0x10,0x2D,0x6B,0x10,0x84,0x72,0x94,0x31,0x8C,0x8E,0x7B,0x8A,0x52,0x62,0x18,
-	0x00,0x00,0x41,0x10,0x41,0x08,0x82,0x18,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x18,0x04,0x29,0xC3,0x20,0xA3,0x18,0xE4,0x20,0x82,0x10,0xC7,0x39,0x41,0x08,0x00,0x00,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0x66,0x31,0x04,0x29,0x01,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,
-	0x21,0x08,0x00,0x08,0x21,0x08,0x41,0x00,0xC4,0x70,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0xAB,0xAA,0xAB,0xAA,0x01,0x98,0x00,0xA8,0xE7,0xA9,0x92,0x9C,0xF4,0x9C,0xF4,0xA4,0x55,0xA5,0x14,0xA5,0x14,0xAD,0x39,0xC6,0x96,0xB5,0x25,0x29,0x66,0x31,
-	0xA3,0x18,0xC7,0x39,0x18,0xC6,0x66,0x31,0x61,0x10,0x04,0x21,0x62,0x10,0x29,0x4A,0xBB,0xDE,0x18,0xCE,0xA7,0x39,0x00,0x00,0x01,0x08,0x00,0x00,0xF0,0x83,0x8E,0x7B,0x00,0x00,0x4D,0x73,0x28,0x52,0x00,0x08,0x00,0x00,0x25,0x29,0xB7,0xB5,0x96,0xBD,0xF8,0xC5,0xF8,0xC5,0x96,0xB5,0x55,0xAD,0xD3,0xA4,0xF4,0xA4,0x0C,0x6B,0x00,0x00,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0xC7,0x39,0xC3,0x20,0x04,0x21,0x82,0x08,0x04,0x29,0xAB,0x52,0xA3,0x18,0x21,0x08,0x00,0x00,
-	0x86,0x39,0x11,0x7C,0x62,0x08,0x00,0x08,0x86,0x31,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC3,0x20,0x51,0x94,0x6A,0x4A,0x08,0x4A,0x11,0x7C,0xE8,0x39,0xF0,0x83,0x6E,0x63,0xA7,0x29,0x29,0x42,0xE8,0x41,0x21,0x08,0x00,0x00,0x86,0x39,0xD7,0xC5,0x55,0xA5,0x14,0xA5,0x55,0xA5,0x18,0xC6,
-	0x4D,0x73,0x00,0x00,0x8E,0x7B,0xAF,0x7B,0x8E,0x7B,0x0C,0x6B,0x76,0xB5,0x76,0xB5,0x55,0xAD,0x55,0xAD,0x14,0xAD,0x14,0xAD,0x14,0xAD,0x14,0xA5,0x35,0xAD,0x14,0xA5,0x4D,0x73,0xB6,0xBD,0x96,0xAD,0x76,0xB5,0x55,0xAD,0xB3,0x9C,0xF4,0xA4,0xD3,0xA4,0xD3,0x9C,0x55,0xAD,0x14,0xAD,0x14,0xAD,0x55,0xA5,0x55,0xA5,0xF4,0xA4,0x51,0x94,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xCB,0x62,0x59,0xD6,0x18,0xBE,0x96,0xBD,0x55,0xB5,0x76,0xB5,0x55,0xB5,0x96,0xBD,0x96,0xBD,0x96,0xBD,0x96,0xBD,0x96,0xBD,0x96,0xBD,0x96,0xBD,0xB7,0xBD,0xD7,0xBD,
-	0x18,0xC6,0xB3,0x94,0x82,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x25,0x29,0xE4,0x20,0xC3,0x18,0xE4,0x20,
-	0xA7,0x39,0x2D,0x6B,0x45,0x29,0x08,0x4A,0x25,0x29,0x82,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x82,0x18,0xA3,0x18,0xC3,0x18,0x62,0x10,0xC3,0x10,0xA3,0x90,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x00,0xB8,
-	0x00,0xA8,0x71,0xBC,0xBA,0xCE,0x71,0xBC,0x71,0xBC,0xB6,0xBD,0xD7,0xC5,0x51,0x94,0xD3,0xA4,0x35,0xAD,0x14,0xA5,0xB2,0xA4,0x8E,0xB3,0x8E,0x7B,0x41,0x08,0xE8,0x41,0x00,0x00,0x0C,0x6B,0xB7,0xBD,0x04,0x21,0x62,0x10,0x45,0x31,0x82,0x18,0x29,0x4A,0x59,0xCE,0xB6,0xBD,0x86,0x39,0x21,0x08,0xC3,0x20,0x00,0x08,0x0C,0x6B,0x92,0x9C,
-	0xF0,0x7B,0x59,0xD6,0x8A,0x5A,0x00,0x00,0x00,0x00,0x6E,0x63,0xF8,0xBD,0x35,0xAD,0x76,0xAD,0x35,0xA5,0x35,0xAD,0x55,0xAD,0xD3,0xA4,0x14,0xAD,0x6E,0x73,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x25,0x29,0x04,0x29,0x00,0x00,0x00,0x00,0x25,0x29,0x49,0x4A,0xA3,0x18,0x00,0x08,0x21,0x08,0x00,0x00,0x04,0x29,0x41,0x08,0x00,0x00,0x8E,0x83,0x8A,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x86,0x39,0x14,0xA5,0x6E,0x73,
-	0x30,0x8C,0x69,0x42,0x00,0x10,0x8E,0x83,0x6E,0x73,0x49,0x4A,0x25,0x29,0xE4,0x20,0xC3,0x20,0x00,0x00,0xE2,0x20,0xD7,0xC5,0xB7,0xB5,0xF4,0xA4,0x96,0xB5,0xB3,0x94,0x55,0xB5,0xB2,0xA4,0xEC,0x5A,0xCB,0x5A,0x7A,0xCE,0x55,0xAD,0x14,0xAD,0x35,0xAD,0x55,0xAD,0xB3,0x94,0x76,0xAD,0x55,0xAD,0x14,0xAD,0x14,0xAD,0xB7,0xB5,0xAF,0x6B,
-	0x30,0x8C,0x96,0xBD,0x14,0xAD,0x34,0xB5,0xD3,0x94,0x14,0xA5,0xF4,0xAC,0xF4,0xAC,0xD3,0x9C,0x14,0xAD,0x14,0xA5,0x14,0xAD,0x55,0xAD,0x55,0xB5,0x14,0xAD,0x51,0x8C,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x00,0x08,0x76,0xB5,0x7A,0xD6,0x55,0xAD,0x76,0xB5,0x96,0xBD,0x76,0xB5,0x76,0xB5,0x96,0xBD,0x96,0xBD,0x96,0xBD,0x96,0xBD,0x76,0xB5,0x96,0xB5,0x96,0xBD,0x76,0xB5,0x59,0xD6,0x10,0x8C,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x62,0x10,0x00,0x00,0x21,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x41,0x10,0x82,0x18,0x41,0x10,
-	0x41,0x08,0x41,0x10,0xA3,0x18,0xC3,0x20,0x21,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0xE4,0x20,0xC3,0x20,0x04,0x21,0xE4,0x20,0xE8,0x41,0x29,0x4A,0x6A,0x52,0xEC,0x62,0x25,0x29,0x45,0x29,0x04,0x29,0x04,0x29,0x25,0x29,0xA3,0x18,0xC3,0x20,0x82,0x18,0x62,0x10,0x82,0x10,0x62,0x10,0x04,0x21,
-	0x04,0x29,0x86,0x39,0x25,0x29,0x25,0x19,0xA3,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0xC4,0x70,0x42,0x98,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x88,0xA7,0x29,0xEC,0x4A,0x11,0x7C,0x4D,0x73,0x51,0x94,0x76,0xB5,0xF8,0xC5,0xF8,0xC5,0x39,0xC6,0xD7,0xC5,0x8E,0xB3,0x86,0x39,0x62,0x10,0x6A,0x52,
-	0x04,0x29,0xB7,0xAD,0x76,0xAD,0x04,0x21,0x66,0x29,0xE7,0xA9,0x20,0x18,0xEC,0x5A,0xBB,0xDE,0x55,0xB5,0x04,0x29,0x82,0x10,0x04,0x29,0x82,0x10,0xAB,0x52,0x39,0xCE,0xF8,0xC5,0xD7,0xC5,0x0C,0x6B,0x00,0x00,0xE4,0x18,0xB7,0xBD,0xD7,0xC5,0x76,0xB5,0x76,0xAD,0x35,0xAD,0x76,0xB5,0x76,0xB5,0x55,0xAD,0x72,0x94,0xAB,0x5A,0x00,0x00,
-	0xA3,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x49,0x52,0x0C,0x5B,0x21,0x08,0x00,0x00,0x21,0x08,0xA3,0x18,0x04,0x21,
-	0x00,0x00,0x01,0x08,0x25,0x29,0x49,0x4A,0x42,0x10,0x21,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x82,0x18,0x62,0x10,0x6A,0x62,0xF8,0xC5,0xF0,0x83,0x92,0x94,0xF0,0x7B,0x8E,0x83,0x72,0x8C,0xD0,0x73,0x45,0x29,0xA3,0x18,0x2D,0x6B,0xC3,0x20,0x00,0x00,0xE8,0x41,0xB7,0xBD,0x51,0x8C,0x92,0x9C,0xD7,0xBD,0x14,0xA5,
-	0x76,0xAD,0x55,0xA5,0x51,0x94,0x6A,0x52,0x8A,0x4A,0xD7,0xB5,0xB6,0xBD,0xF4,0xAC,0x55,0xAD,0xAF,0x7B,0xB3,0x9C,0xB7,0xB5,0x14,0xAD,0x76,0xB5,0x55,0xA5,0xEC,0x62,0x14,0xAD,0x35,0xAD,0x55,0xAD,0x55,0xAD,0x51,0x94,0x92,0x9C,0x34,0xB5,0x55,0xAD,0x55,0xAD,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x76,0xB5,0x55,0xA5,0x15,0x9D,0xAF,0x6B,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x49,0x52,0x7A,0xD6,0x76,0xAD,0x76,0xB5,0x34,0xB5,0x55,0xB5,0x76,0xB5,0x55,0xB5,0x96,0xBD,0x96,0xB5,0x76,0xB5,0x96,0xBD,0x55,0xB5,0x55,0xB5,0x55,0xB5,
-	0xD7,0xBD,0x2D,0x6B,0xEC,0x62,0x08,0x42,0x00,0x00,0x00,0x08,0x45,0x31,0xCB,0x62,0x2D,0x6B,0x62,0x10,0x00,0x00,0x86,0x31,0x62,0x10,0xA3,0x18,0x76,0xAD,0xEC,0x4A,0x00,0x00,0x62,0x00,0xE8,0x39,0x69,0x42,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0xE4,0x18,0xC3,0x18,0xC3,0x20,0x45,0x29,0xE4,0x20,
-	0xA3,0x18,0xA3,0x10,0xE8,0x41,0x08,0x4A,0x2D,0x6B,0x45,0x29,0x62,0x10,0xA3,0x18,0xE4,0x20,0x82,0x10,0xC3,0x18,0xC3,0x20,0xC3,0x18,0xE4,0x18,0xC3,0x20,0x82,0x18,0xA3,0x18,0xE4,0x20,0x82,0x10,0x04,0x21,0xA3,0x90,0x01,0xC8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0xA3,0x90,0x21,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x01,0x98,
-	0x01,0xC8,0x21,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x41,0x10,0xE4,0x20,0xE8,0x41,0xCB,0x5A,0x51,0x84,0x55,0xAD,0x8E,0xB3,0x41,0x10,0x86,0x39,0xAF,0x7B,0x0C,0x5B,0xB7,0xAD,0xAB,0xAA,0x01,0x98,0x46,0xB1,0x6A,0x62,0x08,0x42,0x72,0x8C,0x59,0xCE,0x76,0xB5,0x08,0x52,0xA3,0x18,0xC3,0x20,0xC3,0x18,0xD0,0x73,0xF8,0xC5,
-	0xB7,0xBD,0xB7,0xBD,0xB7,0xBD,0x8A,0x5A,0x2D,0x6B,0x76,0xAD,0xD3,0x9C,0x96,0xBD,0xF8,0xC5,0xF8,0xC5,0x39,0xC6,0x59,0xCE,0x72,0x94,0x45,0x29,0xA7,0x31,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x00,0xEC,0x62,0xCB,0x5A,0x00,0x00,0x00,0x08,0x41,0x08,0x41,0x08,0x08,0x42,0xE4,0x18,0x00,0x10,0xF0,0x7B,0x65,0x21,0x00,0x00,0x21,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x82,0x10,0xA3,0x18,0xA3,0x18,0x04,0x29,0x41,0x08,0x6E,0x73,0x55,0xB5,0x31,0x8C,
-	0x11,0x7C,0xCB,0x62,0x92,0x94,0x72,0x8C,0x69,0x42,0xE4,0x20,0x2D,0x6B,0xA7,0x31,0x00,0x00,0x00,0x00,0x8A,0x5A,0xD7,0xC5,0xD3,0x94,0xF4,0x9C,0x96,0xB5,0x31,0x84,0x51,0x8C,0xB3,0x9C,0x34,0xB5,0xB2,0xA4,0xC3,0x20,0x25,0x21,0xB7,0xAD,0xD7,0xC5,0x96,0xBD,0x55,0xB5,0xCB,0x62,0x92,0x8C,0xB7,0xBD,0xB7,0xB5,0xF0,0x83,0x6E,0x73,
-	0xB7,0xBD,0x35,0xAD,0x55,0xAD,0x76,0xAD,0x35,0xAD,0x14,0xAD,0x55,0xAD,0x14,0xA5,0xF0,0x7B,0xAF,0x6B,0x0C,0x5B,0xEC,0x5A,0x8A,0x4A,0x86,0x31,0xAB,0x52,0xEB,0x72,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,
-	0x00,0x00,0x00,0x00,0x92,0x9C,0xBB,0xDE,0x7A,0xCE,0x18,0xCE,0xD7,0xC5,0x18,0xCE,0x39,0xCE,0x39,0xCE,0x59,0xCE,0xF8,0xC5,0xD7,0xC5,0xD7,0xBD,0x18,0xCE,0xF8,0xC5,0x39,0xC6,0xCB,0x52,0x45,0x31,0x66,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x10,0xAF,0x7B,0xA7,0x39,0x00,0x00,0x2D,0x6B,0x10,0x8C,0xAB,0x52,0xAB,0xAA,0x24,0x51,
-	0x00,0x28,0x00,0x28,0x08,0x52,0x08,0x52,0x41,0x10,0x41,0x20,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x21,0x08,0x25,0x21,0xE4,0x18,0x25,0x19,0x25,0x21,0xC3,0x18,0x24,0x09,0x04,0x21,0x4D,0x63,0x8A,0x52,0xCB,0x5A,0xE4,0x20,0x82,0x10,0x62,0x10,0x04,0x21,0x82,0x10,0xA3,0x18,0xE4,0x20,0xC3,0x18,0x25,0x29,0xC3,0x18,0x21,0x08,
-	0x21,0x08,0x41,0x08,0x62,0x10,0x25,0x19,0xA3,0x90,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x01,0xC0,0x01,0xC8,0x00,0xB8,0x00,0xB8,0x01,0xC8,0x01,0x98,0x42,0x98,0x01,0xC8,0x42,0x28,0x62,0x00,0x41,0x10,0x21,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x62,0x18,0x21,0x08,0xA7,0x39,0x29,0x4A,
-	0x82,0x00,0x66,0x89,0x01,0xC8,0x23,0xD0,0x02,0xD8,0x48,0xD2,0x5D,0xDF,0x7A,0xD6,0xF8,0xC5,0xF8,0xC5,0x76,0xB5,0xF4,0xA4,0xB3,0x9C,0x14,0xA5,0xB7,0xBD,0x96,0xBD,0x55,0xAD,0x34,0xB5,0x96,0xBD,0x18,0xCE,0x18,0xCE,0x76,0xA5,0x29,0x4A,0x86,0x31,0xCB,0x5A,0x31,0x84,0x10,0x84,0x49,0x52,0x62,0x10,0xC3,0x18,0x04,0x29,0x01,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x08,0x4D,0x73,0x4D,0x63,0x00,0x00,0x20,0x00,0x42,0x10,0x41,0x10,0x82,0x18,0x82,0x18,0x00,0x08,
-	0xCB,0x5A,0x28,0x3A,0x86,0x39,0xE8,0x41,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x01,0x08,0x00,0x00,0x4D,0x73,0x96,0xBD,0x51,0x8C,0x86,0x31,0x6A,0x62,0x51,0x84,0x8E,0x83,0xC6,0x39,0x4D,0x63,0x8A,0x4A,0xC3,0x18,0x82,0x10,0x00,0x00,0xC6,0x39,0x55,0xB5,0x14,0xAD,0x55,0xA5,0x6E,0x73,0x86,0x31,
-	0xEF,0x8B,0x96,0xB5,0x14,0xA5,0x76,0xAD,0xD7,0xC5,0x49,0x52,0x66,0x31,0x76,0xA5,0x76,0xAD,0x76,0xAD,0xD3,0xA4,0x4D,0x63,0x92,0x8C,0x76,0xAD,0x0C,0x6B,0x10,0x8C,0x76,0xB5,0x55,0xAD,0x76,0xB5,0x35,0xAD,0x35,0xAD,0x76,0xB5,0x55,0xAD,0x35,0xAD,0xB2,0xA4,0xEF,0x8B,0x0C,0x6B,0xEB,0x72,0x8E,0x83,0x92,0x9C,0xF4,0xAC,0xB2,0xA4,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x04,0x29,0x6A,0x52,0x2D,0x6B,0x51,0x84,0xB3,0x9C,0x72,0x94,0x92,0x9C,0xD3,0xA4,0x10,0x8C,0x51,0x94,0xD7,0xC5,0xB3,0x94,0xEC,0x5A,0xEC,0x62,
-	0x2D,0x6B,0xA7,0x31,0x00,0x00,0x00,0x00,0x49,0x4A,0xAB,0x5A,0x62,0x10,0x00,0x00,0x45,0x31,0x8A,0x52,0xC3,0x18,0x04,0x29,0xD7,0xB5,0xBB,0xDE,0x83,0xA8,0x00,0xA8,0x01,0xA0,0x00,0xA8,0x01,0x98,0x01,0x98,0x21,0x88,0x01,0x98,0x21,0xA8,0x01,0xA0,0x01,0xA0,0x85,0xC9,0xE7,0xA9,0x42,0x98,0x21,0x88,0x21,0x70,0x21,0x88,0x21,0x70,
-	0x45,0x71,0xE7,0xA9,0xAB,0xAA,0xB7,0xBD,0x4D,0x63,0x41,0x08,0x08,0x42,0x45,0x31,0xE4,0x20,0x82,0x18,0xA3,0x18,0xC3,0x18,0xE4,0x20,0x86,0x31,0xC3,0x18,0xA3,0x18,0x82,0x10,0x82,0x18,0xC3,0x18,0xC3,0x10,0x01,0x98,0x01,0xC8,0x00,0xA8,0x00,0xB8,0x01,0x98,0x42,0x48,0x00,0xA8,0x01,0xC8,0x21,0xA8,0x42,0x98,0x21,0x88,0xA3,0x90,
-	0x42,0x48,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x8E,0x7B,0xCB,0x62,0x00,0x00,0x01,0xA0,0x46,0xB1,0x8E,0x83,0x46,0xB1,0x05,0xC9,0xF0,0x83,0x92,0x8C,0x72,0x94,0x92,0x94,0x96,0xB5,0x18,0xC6,0x18,0xC6,0x18,0xCE,0xB7,0xBD,0x96,0xB5,
-	0x76,0xB5,0x76,0xB5,0x76,0xB5,0x55,0xA5,0x14,0xAD,0x55,0xB5,0xF4,0xAC,0xEF,0x8B,0xEC,0x62,0x6A,0x52,0x04,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0x82,0x18,0x41,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x08,0xF0,0x83,0xAF,0x6B,0x00,0x00,0x00,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0xE8,0x41,0xA7,0x29,0x00,0x00,0x0C,0x6B,0xC7,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,0xAF,0x7B,0xB7,0xB5,0x11,0x7C,
-	0xE8,0x41,0x51,0x84,0x10,0x84,0x4D,0x73,0x0C,0x6B,0x8A,0x4A,0x66,0x29,0x25,0x29,0x00,0x00,0x61,0x18,0x51,0x94,0x96,0xB5,0x35,0xAD,0x35,0xA5,0xC7,0x39,0x10,0x8C,0xD7,0xC5,0xD3,0xA4,0x35,0xA5,0xF4,0xA4,0x55,0xA5,0x18,0xCE,0xAF,0x6B,0xA7,0x39,0x92,0x94,0xAF,0x7B,0xF0,0x7B,0x14,0xA5,0xB3,0x94,0x55,0xAD,0x6E,0x73,0x96,0xBD,
-	0x14,0xAD,0x35,0xAD,0x76,0xB5,0x14,0xA5,0x35,0xA5,0x76,0xB5,0x14,0xAD,0x35,0xA5,0x76,0xB5,0xD7,0xC5,0xF8,0xC5,0xF8,0xBD,0xD7,0xC5,0x96,0xBD,0x55,0xAD,0x72,0x8C,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,
-	0x25,0x21,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x10,0xEC,0x62,0x86,0x31,0x00,0x00,0x00,0x00,0xA3,0x18,0x4D,0x73,0x29,0x4A,0x25,0x29,0x00,0x00,0xA3,0x18,0x49,0x52,0xE8,0x41,0x04,0x21,0x00,0x00,0x49,0x52,0x6E,0x73,0x04,0x21,0x00,0x00,0x45,0x29,0x92,0x94,0x10,0x84,0xCB,0x62,0xF4,0x94,0xF4,0xAC,0xC4,0xA8,0x01,0x98,
-	0x01,0xA0,0x00,0xA8,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0xA0,0x23,0xC0,0xA4,0xD8,0x0A,0xEB,0x0A,0xEB,0x02,0xD8,0x02,0xD8,0x01,0xC8,0x01,0xC8,0x01,0xA0,0xA4,0xD8,0x0A,0xEB,0x48,0xD2,0xB2,0xA4,0x6E,0x73,0x62,0x10,0x8A,0x52,0xAB,0x5A,0xE4,0x20,0x82,0x18,0xC3,0x18,0x62,0x10,0xA3,0x18,0x45,0x31,0xC3,0x20,0xC3,0x18,
-	0x45,0x31,0x04,0x29,0xE4,0x18,0x25,0x29,0x42,0x98,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x21,0x88,0x82,0x10,0x42,0x30,0x42,0x38,0xA3,0x18,0x24,0x09,0x82,0x00,0x00,0x00,0x62,0x00,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x00,0x08,0x21,0x08,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x39,0xB2,0xA4,0x86,0x39,
-	0x00,0x00,0x42,0x98,0x01,0xC0,0xC4,0x70,0xA4,0xB8,0x46,0xB1,0x29,0x42,0x0C,0x5B,0x10,0x84,0xB3,0x9C,0xF8,0xC5,0x59,0xCE,0x39,0xC6,0xB7,0xBD,0x96,0xAD,0x96,0xB5,0x96,0xBD,0x76,0xB5,0x55,0xAD,0x55,0xAD,0x35,0xAD,0x35,0xAD,0x96,0xB5,0xD7,0xBD,0xB7,0xBD,0x76,0xB5,0x76,0xB5,0xD3,0x9C,0xAB,0x5A,0x00,0x00,0x00,0x00,0x21,0x08,
-	0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x42,0x28,0x72,0x8C,0x6E,0x63,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0xA3,0x18,
-	0x00,0x08,0x42,0x10,0x62,0x08,0x00,0x08,0x41,0x10,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA2,0x20,0x51,0x94,0x76,0xA5,0x8A,0x4A,0x2D,0x6B,0x30,0x8C,0x31,0x84,0x4D,0x63,0x8A,0x4A,0x29,0x4A,0xE4,0x18,0x00,0x00,0x00,0x00,0x30,0x8C,0x18,0xCE,0x76,0xB5,0x96,0xB5,0xF4,0xAC,0xAB,0x5A,0xD3,0x9C,
-	0x14,0xA5,0xD3,0xA4,0xF4,0xA4,0x14,0xAD,0x35,0xA5,0x14,0xA5,0x76,0xB5,0xF0,0x83,0x8A,0x52,0xEF,0x8B,0x14,0xA5,0x6E,0x63,0xA7,0x31,0x69,0x42,0x6E,0x63,0x59,0xCE,0x18,0xBE,0xF8,0xBD,0xD7,0xC5,0xB6,0xBD,0x76,0xB5,0x76,0xB5,0x55,0xAD,0x34,0xB5,0x55,0xAD,0x14,0xA5,0x14,0xAD,0xF4,0xA4,0x14,0xA5,0xF4,0xA4,0x76,0xAD,0xD3,0x9C,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x08,0xE4,0x18,0x04,0x21,0x00,0x00,0x42,0x10,0x21,0x08,0x25,0x21,0x08,0x4A,0x04,0x29,0x00,0x00,0x00,0x00,0x25,0x29,0x66,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,
-	0x04,0x21,0x00,0x00,0x00,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x00,0x82,0x18,0x35,0xA5,0x8A,0x4A,0x01,0x08,0x21,0x00,0x41,0x10,0x21,0x88,0x02,0xA8,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x42,0x38,0x41,0x00,0x41,0x10,0x82,0x38,0x24,0x51,0x24,0x51,0x42,0x60,0x21,0x70,0x00,0xA8,0x00,0xA8,0x21,0x70,
-	0x85,0xC9,0xE6,0xE1,0x0A,0xEB,0x6E,0x73,0x8A,0x5A,0x08,0x4A,0x00,0x00,0x82,0x18,0x82,0x18,0x62,0x10,0xC3,0x20,0x82,0x18,0x82,0x18,0xE4,0x20,0x82,0x10,0x41,0x10,0xC3,0x18,0x62,0x10,0x00,0x00,0x04,0x29,0x22,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x01,0x98,0x21,0x70,0x83,0x50,0x24,0x51,0x83,0x50,0x42,0x48,
-	0x62,0x08,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0xE8,0x41,0x6A,0x52,0x25,0x29,0x00,0x08,0x82,0x10,0x04,0x29,0x8A,0x5A,0xEC,0x62,0xA7,0x31,0x86,0x39,0x00,0x10,0x24,0x09,0xAB,0xAA,0x01,0xC8,0x01,0xC8,0x23,0xC0,0x71,0xBC,0x5D,0xEF,0xDB,0xE6,0xF8,0xC5,0x96,0xBD,0xB2,0xA4,0x35,0xAD,0x51,0x94,0xC7,0x39,0xEC,0x62,0xB7,0xB5,
-	0x96,0xB5,0xB7,0xBD,0x55,0xAD,0x35,0xAD,0x76,0xB5,0x55,0xAD,0x35,0xAD,0x35,0xAD,0x55,0xAD,0x76,0xAD,0x14,0xAD,0x76,0xAD,0x55,0xB5,0x66,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x01,0x08,0x00,0x00,0x00,0x00,0x6A,0x62,0x35,0xA5,0xEC,0x4A,0x00,0x00,0x00,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x10,0x21,0x08,0x41,0x08,0x00,0x00,0x25,0x29,0xF4,0xA4,0x51,0x8C,0xAB,0x5A,
-	0x8E,0x7B,0x72,0x8C,0x30,0x8C,0x6E,0x73,0x66,0x21,0x61,0x00,0x00,0x00,0x08,0x52,0xEF,0x8B,0x34,0xB5,0x96,0xB5,0x55,0xAD,0x55,0xA5,0x35,0xAD,0xF4,0xAC,0x55,0xAD,0x55,0xAD,0x14,0xAD,0xB3,0x9C,0x14,0xA5,0x35,0xAD,0x14,0xAD,0x92,0x94,0x51,0x94,0x8E,0x7B,0x86,0x31,0x31,0x84,0x14,0xA5,0x4D,0x73,0xA2,0x20,0x62,0x08,0xE4,0x18,
-	0xE7,0x31,0x6E,0x63,0x51,0x84,0x76,0xA5,0xF8,0xBD,0x18,0xC6,0x39,0xC6,0x39,0xCE,0x7A,0xCE,0x39,0xC6,0xB7,0xB5,0x55,0xB5,0x14,0xAD,0x55,0xAD,0x92,0x94,0xCB,0x5A,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x04,0x21,
-	0xE8,0x41,0x66,0x31,0xA3,0x18,0x00,0x00,0x00,0x00,0x8A,0x5A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x21,0x08,0x25,0x29,0x66,0x31,0x29,0x4A,0x4D,0x73,0x8E,0x7B,0xB3,0x9C,0x2D,0x6B,0x00,0x00,0x00,0x08,0x00,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x25,0x21,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x98,0x02,0xA8,
-	0x01,0x98,0x01,0x98,0x21,0x88,0x01,0x98,0x00,0xA8,0x42,0x30,0x62,0x00,0x41,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x62,0x00,0x42,0x60,0x21,0xA8,0x42,0x48,0x48,0xD2,0x85,0xC9,0xE7,0xA9,0xC7,0x39,0xE4,0x18,0xC3,0x18,0xC3,0x20,0xC3,0x20,0xC3,0x18,0x82,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x18,0xE4,0x20,0x62,0x00,0x82,0x38,0x21,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x01,0xC8,0x01,0xC0,0x01,0xC8,0x21,0x88,0x21,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x21,0x08,0x82,0x10,0x45,0x31,0xA7,0x39,0x29,0x4A,0x29,0x4A,0x10,0x84,0xDB,0xD6,0x96,0xBD,0x0C,0x6B,0x08,0x52,0x20,0x18,
-	0x82,0x08,0x76,0xAD,0x71,0xBC,0x8E,0xB3,0x71,0xBC,0x39,0xC6,0xD3,0x9C,0x29,0x4A,0x01,0x08,0x00,0x08,0x00,0x00,0x86,0x39,0x72,0x94,0xB3,0x9C,0x72,0x94,0x96,0xB5,0xB7,0xBD,0xB7,0xB5,0xD7,0xBD,0x76,0xB5,0x55,0xAD,0x55,0xAD,0x55,0xB5,0x35,0xAD,0x55,0xAD,0x76,0xAD,0x14,0xA5,0xB3,0x94,0x92,0x9C,0x72,0x94,0x31,0x84,0x31,0x8C,
-	0x51,0x8C,0x8E,0x7B,0xCB,0x5A,0x08,0x4A,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x29,0x4A,0xE8,0x41,0x4D,0x63,0xE7,0x31,0x00,0x00,0x01,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x82,0x18,0x82,0x18,0x00,0x00,0x21,0x08,0x51,0x94,0x35,0xA5,0x29,0x42,0x8E,0x7B,0x6E,0x73,0xAF,0x6B,0x65,0x21,0x00,0x00,0x08,0x52,0x55,0xB5,0xD7,0xBD,0xF4,0x94,0xB3,0x94,0x76,0xB5,0x76,0xB5,0x76,0xB5,0x55,0xA5,0x14,0xAD,0x55,0xB5,
-	0x76,0xB5,0x55,0xAD,0x72,0x94,0x92,0x9C,0x35,0xAD,0x55,0xAD,0xD3,0x9C,0x72,0x94,0x14,0xAD,0xD3,0xA4,0x8E,0x83,0xF4,0x9C,0x39,0xCE,0x31,0x8C,0xB2,0xA4,0xEB,0x72,0xC7,0x41,0x25,0x29,0x45,0x31,0xE4,0x18,0x61,0x00,0x25,0x21,0xE7,0x31,0x49,0x4A,0xAB,0x52,0x0C,0x5B,0x11,0x7C,0xB3,0x94,0x14,0xA5,0x76,0xB5,0xB2,0xA4,0x4D,0x73,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0xE8,0x41,0x08,0x42,0x45,0x29,0x00,0x00,0x66,0x31,0x59,0xD6,0xF0,0x7B,0x29,0x4A,0xEC,0x62,0xF0,0x83,0x92,0x9C,0x14,0xAD,0xD7,0xC5,0xF8,0xC5,0x18,0xC6,0xF8,0xC5,
-	0xD7,0xC5,0x39,0xCE,0xF4,0x94,0x21,0x08,0x00,0x08,0x04,0x29,0xA3,0x18,0x41,0x08,0x41,0x10,0x00,0x00,0x21,0x08,0x62,0x10,0x62,0x08,0x42,0x10,0x01,0xA0,0x00,0xA8,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x21,0x28,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x20,0x42,0x28,0x61,0x00,0x21,0x70,0x21,0xA8,0x21,0x70,
-	0x46,0xB1,0x48,0xD2,0x66,0x89,0x24,0x09,0xC3,0x20,0x21,0x08,0x00,0x00,0x00,0x00,0xA3,0x18,0x04,0x21,0xE4,0x20,0x45,0x29,0xE8,0x41,0xCB,0x62,0x8E,0x83,0xEF,0x8B,0x51,0x94,0x34,0xB5,0x11,0x7C,0x24,0x51,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0x28,
-	0x00,0x00,0x62,0x10,0x62,0x10,0x21,0x08,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0xE8,0x41,0x21,0x08,0xC7,0x39,0xAF,0x7B,0x96,0xBD,0xAF,0x7B,0xAF,0x7B,0x82,0x38,0x00,0x00,0xD3,0x9C,0xF4,0x94,0x6A,0x4A,0xE7,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x08,0x00,0x00,0x25,0x29,0x96,0xB5,0x59,0xCE,0x35,0xAD,0x76,0xB5,
-	0x76,0xB5,0xD7,0xC5,0x6E,0x73,0xB3,0x8C,0x55,0xAD,0x14,0xAD,0x35,0xAD,0x55,0xAD,0x55,0xAD,0x76,0xAD,0x14,0xA5,0x92,0x94,0x92,0x9C,0x55,0xAD,0x14,0xA5,0x76,0xAD,0xF8,0xC5,0xAB,0x52,0xA7,0x31,0xA7,0x39,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,
-	0xA7,0x31,0x2D,0x6B,0xC7,0x39,0x00,0x00,0x00,0x00,0x41,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0xC3,0x20,0xC3,0x18,0x00,0x00,0x49,0x52,0x8E,0x7B,0x51,0x8C,0x6E,0x73,
-	0x30,0x8C,0xD3,0x9C,0x6A,0x52,0x86,0x39,0x30,0x8C,0xB6,0xBD,0xF8,0xC5,0xF0,0x7B,0xF0,0x83,0x55,0xB5,0x76,0xB5,0x55,0xAD,0x76,0xB5,0x55,0xAD,0x35,0xA5,0x55,0xB5,0x35,0xAD,0x35,0xAD,0xF4,0xA4,0xF4,0x9C,0xB3,0x9C,0x92,0x94,0x14,0xA5,0x55,0xB5,0x55,0xB5,0xB7,0xB5,0x96,0xBD,0x34,0xB5,0xB3,0x9C,0xF0,0x83,0x76,0xAD,0xF8,0xC5,
-	0x18,0xCE,0xB6,0xBD,0x14,0xAD,0x8E,0x83,0xEB,0x72,0x28,0x52,0xC6,0x39,0x08,0x52,0x08,0x52,0xAB,0x5A,0xEF,0x8B,0xF4,0xAC,0xD7,0xC5,0x18,0xC6,0x76,0xA5,0xF0,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,
-	0x49,0x52,0x29,0x4A,0x8A,0x52,0x14,0xA5,0x96,0xBD,0x96,0xBD,0x96,0xBD,0xD7,0xC5,0x39,0xCE,0x18,0xCE,0xD7,0xC5,0xB7,0xBD,0xF8,0xC5,0x76,0xB5,0x14,0xAD,0x34,0xB5,0x14,0xAD,0xF8,0xC5,0x92,0x9C,0x00,0x00,0x21,0x08,0x86,0x39,0xC3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x00,0x41,0x20,0x01,0x98,0x00,0xA8,
-	0x01,0x98,0x01,0x98,0x01,0x98,0x42,0x60,0x42,0x60,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x62,0x08,0x41,0x20,0x42,0x28,0x01,0x98,0x42,0x60,0x42,0x98,0xA3,0x90,0x48,0xD2,0x48,0xD2,0x00,0x00,0x00,0x00,0xC7,0x41,0x6E,0x73,0x6E,0x73,0x30,0x8C,0xF4,0xAC,0xD3,0xA4,0x51,0x94,0xB2,0xA4,0x55,0xB5,0x34,0xB5,0x55,0xB5,
-	0x55,0xAD,0xD7,0xC5,0xD3,0x94,0x24,0x51,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x42,0x98,0x00,0xA8,0x83,0xA8,0x21,0xA8,0x48,0xD2,0x51,0x94,0xB3,0x94,0x18,0xCE,0xAF,0x7B,0x20,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x82,0x10,0x21,0x08,0x00,0x08,0x00,0x00,0x86,0x39,0x82,0x08,0x24,0x51,0x82,0x38,
-	0x00,0x00,0xE8,0x41,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xC3,0x18,0x76,0xAD,0x18,0xCE,0xB7,0xBD,0x76,0xB5,0xB7,0xBD,0x96,0xBD,0x0C,0x6B,0x51,0x8C,0x76,0xB5,0x14,0xAD,0x14,0xA5,0x14,0xAD,0x55,0xAD,0x35,0xAD,0xF4,0xA4,0xB3,0x9C,0xD3,0xA4,0xAF,0x6B,0x00,0x00,0x00,0x00,
-	0xA3,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x92,0x9C,0x72,0x94,0x0C,0x6B,0x51,0x8C,0x51,0x8C,0x51,0x84,0x4D,0x73,0xD7,0xC5,0x18,0xBE,0xB2,0xA4,0xF4,0xA4,0x55,0xB5,0xB7,0xBD,0x35,0xAD,0x76,0xAD,0x76,0xAD,0x35,0xAD,0x35,0xAD,0x14,0xAD,0x35,0xAD,
-	0x35,0xAD,0x35,0xAD,0x35,0xAD,0xB3,0x9C,0x51,0x94,0x31,0x8C,0xF4,0xA4,0x55,0xAD,0x55,0xAD,0x34,0xB5,0x96,0xB5,0x96,0xB5,0x92,0x94,0x92,0x9C,0x55,0xAD,0xF4,0xA4,0x55,0xAD,0xB7,0xBD,0x14,0xA5,0x92,0x9C,0xB6,0xBD,0x39,0xCE,0xD7,0xC5,0xD7,0xC5,0xBB,0xDE,0xBB,0xDE,0xBA,0xCE,0x76,0xA5,0x11,0x7C,0x69,0x42,0x25,0x21,0x04,0x21,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x04,0x29,0x00,0x00,0xCB,0x62,0xDB,0xE6,0xB6,0xBD,0x55,0xB5,0x76,0xB5,0xD7,0xC5,0x76,0xB5,0xF8,0xC5,0x96,0xBD,0x55,0xAD,0xB2,0xA4,0xF4,0xAC,0x55,0xAD,0x14,0xAD,
-	0x34,0xB5,0x76,0xB5,0x49,0x4A,0x00,0x00,0x21,0x08,0x01,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x20,0x01,0x98,0x00,0xA8,0x01,0x98,0x01,0x98,0x21,0x88,0x20,0x18,0x42,0x28,0x42,0x28,0x41,0x08,0x41,0x08,0x62,0x18,0x45,0x71,0x83,0x50,0x41,0x00,0xA2,0x20,0x42,0x60,0x42,0x28,0xC4,0x70,
-	0xC4,0x70,0x66,0x89,0xE7,0xA9,0x00,0x00,0x21,0x08,0x14,0xAD,0x59,0xD6,0x96,0xBD,0x35,0xAD,0x34,0xB5,0x34,0xB5,0xB2,0xA4,0xB2,0xA4,0x34,0xB5,0xF4,0xAC,0x92,0x9C,0xB2,0xA4,0xF8,0xC5,0x15,0x9D,0x42,0x38,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x22,0xA8,0x00,0xA8,0x46,0xB1,0xEF,0x8B,0x76,0xA5,0xB3,0x8C,
-	0x8E,0x7B,0x2D,0x6B,0xE8,0x39,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x42,0x60,0x42,0x38,0x41,0x00,0x82,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x62,0x08,0x55,0xAD,0xD7,0xC5,0x96,0xBD,0x96,0xB5,
-	0xB7,0xBD,0x76,0xB5,0xB7,0xBD,0x76,0xAD,0x14,0xAD,0x55,0xAD,0x35,0xA5,0x14,0xAD,0x76,0xAD,0x14,0xA5,0xB3,0x9C,0xB3,0x9C,0x14,0xA5,0x10,0x8C,0x21,0x08,0x00,0x00,0xA3,0x18,0x45,0x29,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x18,0x45,0x29,0xE4,0x20,0x01,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0x2D,0x6B,0x51,0x8C,0x10,0x84,0x8E,0x7B,
-	0x11,0x7C,0xF0,0x83,0x96,0xBD,0xB7,0xAD,0x55,0xAD,0x96,0xAD,0x55,0xAD,0x14,0xA5,0x96,0xBD,0xD7,0xC5,0xB7,0xAD,0x76,0xB5,0x55,0xAD,0x14,0xAD,0x55,0xAD,0x35,0xAD,0x55,0xAD,0x76,0xB5,0x35,0xAD,0xF4,0xAC,0x55,0xAD,0x55,0xB5,0x35,0xAD,0x55,0xAD,0x76,0xB5,0x35,0xAD,0x14,0xA5,0x55,0xAD,0xB3,0x94,0xB3,0x9C,0x55,0xAD,0x14,0xAD,
-	0x55,0xB5,0x55,0xAD,0x14,0xA5,0xB2,0xA4,0x14,0xA5,0xB7,0xB5,0x14,0xAD,0xCB,0x5A,0x8A,0x4A,0x29,0x42,0x45,0x29,0xE4,0x18,0x86,0x39,0xEB,0x72,0xEF,0x8B,0x8E,0x83,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0xE4,0x18,0x62,0x08,0x21,0x10,0xF4,0xAC,0xB7,0xBD,0x55,0xB5,0x18,0xCE,0xF4,0x9C,0xE4,0x20,0xCB,0x62,0xD7,0xC5,0x76,0xB5,0x41,0x10,0x4D,0x73,0xD7,0xC5,0x14,0xA5,0xB7,0xBD,0xAB,0x52,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x20,0x00,0xA8,0x00,0xA8,
-	0x01,0x98,0x00,0xA8,0x00,0xA8,0x42,0x38,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x08,0xE4,0x38,0x45,0x71,0x20,0x18,0x41,0x00,0x42,0x30,0x41,0x20,0x62,0x08,0xE4,0x38,0xE7,0xA9,0x24,0x51,0x00,0x00,0x00,0x00,0x6E,0x73,0xB7,0xBD,0xB2,0xA4,0x34,0xB5,0x51,0x8C,0x6E,0x73,0xB2,0xA4,0x92,0x9C,0x0C,0x6B,0x51,0x94,0xD3,0x9C,
-	0xF4,0xAC,0x14,0xAD,0xEC,0x4A,0x00,0x28,0x01,0xC0,0x01,0xC8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x21,0x70,0x82,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x62,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x21,0x00,0x41,0x00,0x41,0x00,0x62,0x08,0x41,0x08,0x41,0x00,0x42,0x28,0x42,0x28,
-	0x61,0x00,0x21,0x08,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x62,0x08,0x00,0x00,0xE4,0x18,0x76,0xB5,0xB7,0xBD,0x34,0xB5,0x55,0xB5,0x76,0xB5,0x76,0xB5,0x55,0xB5,0x14,0xAD,0x35,0xA5,0x35,0xAD,0x35,0xAD,0x35,0xAD,0x55,0xB5,0xF4,0xA4,0x72,0x8C,0x72,0x94,0xB3,0x9C,0x76,0xB5,0x8E,0x7B,0x00,0x00,
-	0x45,0x31,0x08,0x42,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x86,0x39,0x8A,0x52,0xE8,0x39,0xE4,0x20,0xC7,0x41,0x08,0x4A,0xA7,0x39,0x86,0x31,0x45,0x29,0x62,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x08,0x61,0x10,0x41,0x10,0x62,0x10,0x00,0x08,0x82,0x18,0x10,0x84,0xF0,0x7B,0xCB,0x5A,0x0C,0x6B,0x72,0x94,0x72,0x8C,0xD3,0x94,0x35,0xAD,0x76,0xB5,0xB7,0xB5,0x15,0x9D,0xB3,0x94,0xF4,0x94,0xD3,0x9C,0x96,0xBD,0x96,0xBD,0xD7,0xBD,0x96,0xBD,0x35,0xAD,0x35,0xAD,
-	0x35,0xAD,0x55,0xA5,0xD7,0xBD,0x59,0xC6,0xD7,0xBD,0xF4,0xA4,0xD3,0x94,0x35,0xAD,0x96,0xBD,0x55,0xAD,0x35,0xAD,0x76,0xB5,0xF4,0x9C,0xF4,0xAC,0x34,0xB5,0x14,0xAD,0x55,0xA5,0x14,0xAD,0xF4,0xA4,0x76,0xAD,0x34,0xB5,0x34,0xB5,0x76,0xB5,0x14,0xA5,0x8E,0x83,0x6A,0x62,0xEB,0x72,0x92,0x9C,0x96,0xBD,0xF8,0xC5,0x76,0xB5,0x51,0x84,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x8A,0x5A,0x82,0x18,0x21,0x08,0x34,0xB5,0x18,0xCE,0x55,0xB5,0x39,0xCE,0xAF,0x6B,0x00,0x00,0x41,0x10,0x34,0xB5,0x7A,0xD6,0xE4,0x20,0x4D,0x73,0xD7,0xC5,0x14,0xAD,
-	0x96,0xBD,0x49,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x28,0x42,0x60,0x21,0x70,0x21,0x70,0x42,0x48,0x21,0x70,0x21,0x28,0x41,0x00,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x62,0x10,0x41,0x08,0x21,0x28,0x42,0x30,0x00,0x00,
-	0x66,0x89,0x48,0xD2,0x24,0x51,0x62,0x08,0x00,0x00,0xAB,0x5A,0x59,0xD6,0xB2,0xA4,0x34,0xB5,0x6A,0x4A,0x00,0x00,0x51,0x94,0x10,0x8C,0x61,0x10,0x51,0x94,0xF4,0xAC,0xB6,0xBD,0xCB,0x62,0x00,0x00,0x20,0x08,0x41,0x20,0x42,0x60,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x21,0x88,0x21,0x70,0x21,0x70,0x21,0x70,
-	0x21,0x88,0x21,0x70,0x21,0x70,0x21,0x70,0x21,0x70,0x42,0x60,0x42,0x38,0x83,0x50,0x83,0x50,0x82,0x38,0x41,0x20,0x41,0x10,0x41,0x08,0x41,0x00,0xA2,0x20,0x61,0x10,0x41,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x66,0x21,0x96,0xBD,0x96,0xBD,0x55,0xAD,0x76,0xAD,
-	0x34,0xB5,0x55,0xB5,0x34,0xB5,0x35,0xA5,0xF4,0xAC,0x14,0xAD,0x14,0xAD,0x35,0xA5,0x35,0xAD,0xD3,0xA4,0xB3,0x9C,0x92,0x9C,0xB3,0x94,0x14,0xA5,0x96,0xBD,0x45,0x31,0x00,0x00,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0xE4,0x18,0xAB,0x52,0x2D,0x6B,0x86,0x39,0x8A,0x4A,0x29,0x42,0xA3,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x45,0x29,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x00,0x08,0x82,0x18,0x66,0x31,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x04,0x29,0x4D,0x63,0xA7,0x31,0x4D,0x73,0xD3,0xA4,
-	0xF8,0xBD,0x14,0xA5,0xD3,0x94,0xD7,0xB5,0x14,0xA5,0xB3,0x94,0xB3,0x94,0x6E,0x73,0x51,0x84,0x51,0x8C,0xB7,0xAD,0xF4,0x94,0x15,0x9D,0x76,0xAD,0xD7,0xBD,0xF8,0xC5,0x76,0xAD,0x8A,0x4A,0x65,0x21,0x69,0x42,0x6E,0x63,0xF4,0x94,0xB3,0x94,0xF4,0x9C,0x14,0xA5,0x55,0xAD,0xD7,0xC5,0x55,0xAD,0xB3,0x94,0x14,0xA5,0x55,0xA5,0x96,0xBD,
-	0xB7,0xBD,0xB6,0xBD,0x14,0xAD,0x35,0xAD,0x34,0xB5,0x55,0xAD,0x76,0xB5,0x96,0xB5,0xD7,0xC5,0xF8,0xC5,0xF8,0xBD,0x96,0xB5,0x55,0xAD,0x35,0xA5,0x55,0xAD,0xB3,0x94,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0xE4,0x18,
-	0x08,0x4A,0x82,0x18,0xE4,0x20,0xF8,0xC5,0xB7,0xBD,0x96,0xBD,0x96,0xB5,0xEC,0x5A,0xE4,0x18,0xC3,0x18,0x6A,0x52,0x39,0xCE,0x6A,0x52,0x4D,0x73,0x76,0xB5,0xF4,0xAC,0x96,0xB5,0xCB,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x30,0x41,0x00,0x42,0x38,
-	0x42,0x48,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x00,0x83,0x50,0x42,0x38,0x20,0x00,0x83,0x50,0x24,0x51,0x24,0x51,0x25,0x29,0x00,0x00,0xF0,0x83,0xB7,0xBD,0xB2,0xA4,0xF4,0xAC,0xE8,0x41,0x00,0x00,0x8E,0x83,0xF4,0xAC,0x86,0x31,0x92,0x9C,0xB2,0xA4,
-	0x96,0xBD,0xEC,0x62,0x00,0x00,0x41,0x08,0x62,0x00,0x41,0x00,0x21,0x88,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x88,0x00,0xA8,0x00,0xB8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC0,0x23,0xD0,0x05,0xC9,0x83,0xA8,0x01,0xA0,0x00,0xA8,0x21,0x88,0x21,0x88,0x01,0x98,0x21,0x70,
-	0x21,0x70,0x21,0x70,0x21,0x70,0x42,0x60,0x42,0x60,0x42,0x60,0x83,0x50,0x83,0x50,0xC4,0x70,0x45,0x71,0x42,0x38,0x28,0x3A,0xD7,0xB5,0x96,0xB5,0x35,0xAD,0x55,0xB5,0x76,0xB5,0x55,0xB5,0x35,0xAD,0x96,0xB5,0x18,0xC6,0xF8,0xC5,0xD7,0xBD,0x96,0xBD,0x14,0xA5,0xF4,0x94,0x92,0x9C,0xB3,0x9C,0xF4,0x94,0xF4,0xA4,0xF8,0xC5,0xAF,0x7B,
-	0x00,0x00,0x82,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x86,0x31,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x18,0x08,0x4A,0xA7,0x39,0x41,0x08,0x01,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x01,0x08,0x00,0x08,0xC7,0x39,0x86,0x31,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x49,0x4A,0xC7,0x39,0xC7,0x41,0x92,0x8C,0x31,0x84,0x51,0x8C,0xD3,0x9C,0x72,0x94,0x72,0x94,0xD3,0x9C,0x35,0xAD,0x76,0xA5,0x69,0x42,0x08,0x42,0x8A,0x4A,0xE7,0x31,0x62,0x08,0x00,0x00,0x6A,0x4A,0xB3,0x8C,0xB3,0x8C,
-	0x18,0xC6,0xF4,0xA4,0x08,0x52,0x41,0x20,0x62,0x10,0x65,0x21,0xE4,0x18,0x8A,0x4A,0xD0,0x73,0x10,0x84,0x72,0x94,0x14,0xA5,0x35,0xA5,0x51,0x84,0xF0,0x7B,0xF0,0x7B,0x51,0x8C,0x96,0xB5,0x18,0xC6,0x96,0xBD,0xB7,0xBD,0x76,0xB5,0x55,0xB5,0x35,0xA5,0x14,0xAD,0xF4,0xA4,0x14,0xA5,0xF4,0xAC,0xD3,0x9C,0x55,0xB5,0x18,0xC6,0x55,0xAD,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x04,0x29,0x25,0x21,0x21,0x08,0x21,0x08,0xF4,0xAC,0xD7,0xC5,0xB7,0xBD,0x76,0xB5,0x08,0x42,0x82,0x10,0x25,0x29,0x20,0x08,0x49,0x4A,0x29,0x4A,0x30,0x8C,0x96,0xBD,0x35,0xAD,
-	0x18,0xCE,0x6A,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x21,0x00,0x82,0x38,0x62,0x10,0x42,0x48,0x42,0x38,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x60,0x42,0x48,0x41,0x00,
-	0x00,0x00,0xEB,0x72,0x6A,0x62,0xC3,0x18,0x00,0x00,0xEF,0x8B,0x76,0xB5,0xF4,0xA4,0x92,0x9C,0x66,0x31,0x00,0x00,0x45,0x31,0x31,0x8C,0x29,0x4A,0x51,0x94,0xD3,0xA4,0xD7,0xC5,0xCB,0x62,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x00,0x42,0x60,0x01,0xC8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xA8,
-	0x00,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x01,0xC0,0x23,0xB8,0x23,0xB8,0x02,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x02,0xD8,0x02,0xD8,0x01,0xC8,0x23,0xD0,0xA4,0xD8,0xE6,0xE1,0xE6,0xE1,0x85,0xC9,0xE7,0xA9,0xD7,0xB5,0xB7,0xB5,0x96,0xBD,0x76,0xB5,
-	0x76,0xB5,0xD7,0xBD,0xF8,0xC5,0xD3,0xA4,0x6E,0x73,0xF0,0x83,0xB3,0x9C,0x96,0xB5,0xF8,0xBD,0xF4,0xA4,0x92,0x9C,0x10,0x8C,0xD3,0x9C,0xF4,0xA4,0x96,0xB5,0x76,0xB5,0xA3,0x18,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x45,0x31,0xF0,0x83,0x66,0x31,0x00,0x08,0x21,0x10,0x86,0x39,0xEC,0x62,0x2D,0x6B,0x29,0x42,0x00,0x00,0x00,0x08,0xC3,0x20,0x82,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x82,0x18,0xA3,0x18,0x04,0x29,0x28,0x3A,0x04,0x21,0x21,0x08,0x21,0x08,0x62,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x8E,0x7B,0x2D,0x6B,0x86,0x39,0x6E,0x73,0xAF,0x7B,
-	0x0C,0x6B,0xCB,0x5A,0x51,0x84,0x31,0x84,0xAF,0x6B,0x6A,0x4A,0xC3,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0xA2,0x20,0x00,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0xE4,0x18,0x92,0x8C,0xD7,0xBD,0x96,0xB5,0x96,0xBD,0xF0,0x83,0x08,0x52,0x41,0x10,0x00,0x00,0x65,0x21,0x0C,0x5B,0x51,0x8C,0x72,0x94,0x92,0x9C,0xD3,0xA4,0x8E,0x7B,
-	0x49,0x4A,0x08,0x4A,0x8A,0x4A,0xD0,0x73,0xD7,0xB5,0x59,0xCE,0xD7,0xC5,0xD7,0xC5,0xF8,0xC5,0x96,0xB5,0x39,0xCE,0xB7,0xBD,0xB3,0x94,0xD7,0xB5,0xB3,0x8C,0xEC,0x5A,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0xE4,0x20,
-	0x25,0x21,0x21,0x08,0x00,0x00,0xD3,0xA4,0x18,0xCE,0x18,0xCE,0xB7,0xBD,0x25,0x29,0xA3,0x18,0xC7,0x39,0x25,0x29,0x62,0x08,0x00,0x00,0x8E,0x83,0xBB,0xDE,0x96,0xB5,0x59,0xCE,0x49,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x28,0x42,0x30,0x42,0x60,
-	0x21,0x10,0x61,0x00,0x61,0x00,0x62,0x00,0x41,0x20,0x41,0x20,0x41,0x20,0x62,0x10,0x62,0x00,0x21,0x00,0x41,0x08,0x62,0x10,0x41,0x08,0x42,0x48,0xA2,0x20,0x41,0x08,0x00,0x00,0x24,0x51,0xC7,0x41,0xA3,0x10,0x00,0x00,0xF0,0x83,0x34,0xB5,0x76,0xB5,0x31,0x84,0x21,0x08,0x41,0x08,0x00,0x08,0x04,0x29,0x6A,0x52,0xD3,0xA4,0xF4,0xA4,
-	0xB7,0xBD,0x49,0x52,0x00,0x00,0x41,0x10,0x62,0x10,0x62,0x00,0x21,0x70,0x01,0xC8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x21,0x70,0x41,0x20,0x42,0x28,0x42,0x28,0x42,0x28,0x41,0x20,0x41,0x20,0x41,0x20,0x42,0x38,0x02,0xB0,0x43,0xC0,0x23,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x01,0x98,0x42,0x48,0x42,0x60,0x42,0x48,
-	0x42,0x60,0x42,0x60,0x42,0x60,0x42,0x60,0x42,0x60,0x83,0xA8,0x23,0xC0,0x84,0xC8,0x85,0xC9,0x48,0xD2,0xE6,0xE1,0x48,0xD2,0xD7,0xBD,0xB7,0xB5,0xB7,0xBD,0x96,0xBD,0x55,0xB5,0xB7,0xB5,0x59,0xD6,0x6E,0x73,0x00,0x00,0x82,0x10,0xA3,0x18,0x86,0x31,0x4D,0x63,0xF0,0x83,0xB3,0x9C,0xB3,0x9C,0xB3,0x9C,0xF4,0xA4,0xD7,0xB5,0x59,0xD6,
-	0x08,0x52,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x31,0xAF,0x7B,0xF0,0x83,0xF0,0x83,0xF0,0x7B,0xEC,0x4A,0x41,0x08,0x00,0x00,0x82,0x18,0x28,0x52,0x25,0x29,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,
-	0xA3,0x18,0xE8,0x41,0x66,0x29,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x04,0x21,0xE4,0x20,0x00,0x00,0xE4,0x20,0xF4,0x94,0x29,0x42,0x45,0x29,0xAF,0x7B,0xF0,0x7B,0x31,0x84,0x2D,0x6B,0x69,0x42,0x41,0x08,0x00,0x00,0x00,0x00,0x21,0x10,0x66,0x31,0x49,0x52,0x4D,0x73,0xF0,0x83,0xD3,0xA4,0xF4,0xAC,0x0C,0x6B,0x25,0x29,0x21,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xE7,0x31,0x2D,0x6B,0x55,0xAD,0x59,0xC6,0xF8,0xC5,0x6E,0x73,0x62,0x18,0x20,0x08,0x8A,0x4A,0x14,0xA5,0x51,0x94,0x51,0x94,0xF4,0xA4,0x96,0xBD,0x92,0x9C,0x6A,0x52,0x62,0x08,0x41,0x08,0x8A,0x4A,0xF4,0x94,0xB3,0x8C,0x11,0x7C,0x11,0x7C,0xD0,0x73,0xCB,0x5A,0x8A,0x4A,0x28,0x3A,0x00,0x00,0x00,0x00,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0x04,0x29,0x41,0x10,0x00,0x00,0xB2,0xA4,0x39,0xCE,0x7A,0xD6,0x35,0xA5,0x21,0x00,0x04,0x29,0xC7,0x39,0x66,0x31,0x25,0x29,0x00,0x08,0x04,0x29,0xF8,0xC5,0xB7,0xBD,
-	0xF8,0xBD,0xCB,0x52,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x30,0x42,0x30,0x42,0x48,0x41,0x08,0x41,0x00,0x62,0x08,0x42,0x60,0x01,0xA0,0x21,0xA8,0x01,0xA0,0x01,0x98,0xC4,0x70,0xE4,0x38,0x41,0x00,0x41,0x00,0x41,0x00,0x42,0x60,0x21,0x88,0x41,0x08,
-	0x41,0x08,0xC3,0x18,0xE4,0x20,0xA3,0x18,0x00,0x00,0xAF,0x7B,0x76,0xB5,0xD7,0xC5,0x2D,0x6B,0x00,0x00,0xA3,0x18,0x04,0x29,0x00,0x08,0xE4,0x20,0xB3,0x9C,0xF4,0xAC,0x96,0xBD,0x08,0x42,0x00,0x00,0x41,0x10,0x61,0x10,0x61,0x00,0x21,0x70,0x01,0xC8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x01,0xC8,0x42,0x48,0x41,0x00,0x41,0x00,
-	0x41,0x00,0x41,0x00,0x62,0x00,0x62,0x00,0x41,0x00,0x41,0x00,0x42,0x98,0x23,0xD0,0x01,0x98,0x01,0x98,0x00,0xA8,0x01,0xC8,0x42,0x48,0x62,0x00,0x20,0x00,0x61,0x00,0x41,0x00,0x61,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0xC4,0x70,0x23,0xD0,0xA4,0xB8,0x85,0xC9,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x96,0xBD,0xD7,0xBD,0xB7,0xBD,0x76,0xB5,
-	0x76,0xB5,0x96,0xB5,0xF8,0xBD,0x6A,0x62,0x00,0x00,0xA3,0x18,0x41,0x10,0x82,0x18,0x00,0x08,0x00,0x00,0x08,0x42,0x14,0xA5,0x96,0xB5,0xD7,0xBD,0x18,0xC6,0x18,0xCE,0x29,0x4A,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x00,0x41,0x08,0xA7,0x29,0x66,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x20,0x4D,0x63,0x28,0x3A,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x66,0x29,0x62,0x10,0x00,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0xEB,0x72,0xB3,0x8C,0x00,0x00,0x6A,0x52,0xEC,0x62,0x6E,0x63,
-	0xE7,0x31,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x29,0xEC,0x62,0xAF,0x7B,0xEC,0x62,0xEC,0x5A,0xF0,0x83,0x72,0x8C,0x14,0xA5,0xD7,0xB5,0x96,0xB5,0x76,0xB5,0x92,0x9C,0x0C,0x6B,0x04,0x29,0x41,0x10,0x62,0x10,0x00,0x00,0x62,0x08,0xA7,0x31,0x92,0x94,0xDB,0xE6,0x59,0xD6,0x6A,0x62,0x00,0x00,0xA7,0x29,0x76,0xA5,0xD7,0xC5,0x14,0xAD,
-	0x35,0xAD,0xB7,0xBD,0xD7,0xC5,0xF4,0xAC,0xE8,0x41,0x00,0x00,0xE4,0x20,0x62,0x08,0x00,0x00,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x31,0xEB,0x72,0xEF,0x8B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x82,0x18,
-	0x66,0x29,0x45,0x29,0x00,0x00,0x10,0x8C,0x39,0xCE,0xBB,0xDE,0xD3,0x94,0x00,0x00,0xE4,0x20,0x25,0x29,0xE4,0x20,0x25,0x29,0x25,0x21,0xA3,0x18,0x10,0x8C,0x18,0xC6,0x18,0xC6,0xEC,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x42,0x30,0x42,0x38,0x42,0x38,
-	0x62,0x00,0x41,0x10,0x01,0x98,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x01,0xC0,0xA4,0xD8,0xE6,0xE1,0xC4,0xA8,0x42,0x28,0x41,0x00,0x42,0x38,0x02,0xB8,0x42,0x28,0x41,0x00,0x45,0x29,0x6A,0x4A,0x08,0x4A,0x00,0x00,0x4D,0x73,0xB7,0xBD,0xF8,0xC5,0x49,0x4A,0x00,0x08,0x04,0x21,0x04,0x21,0xE4,0x20,0x41,0x08,0xEC,0x62,0x55,0xB5,
-	0x96,0xBD,0xA7,0x39,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x00,0x21,0x70,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x42,0x38,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0xC4,0x70,0x23,0xD0,0x21,0xA8,0x00,0xA8,0x00,0xA8,0x21,0xA8,0x42,0x28,0x41,0x00,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x42,0x98,0x05,0xC9,0x85,0xC9,0x05,0xC9,0x48,0xD2,0x85,0xC9,0x8E,0xB3,0xD7,0xB5,0xD7,0xBD,0xB7,0xBD,0x96,0xB5,0x76,0xAD,0x76,0xB5,0x18,0xCE,0x28,0x52,0x62,0x08,0x45,0x29,0xE4,0x20,0x45,0x29,0xE4,0x20,0x00,0x00,0xA3,0x10,0x14,0xA5,0x8E,0x7B,0xA7,0x39,0x45,0x31,0xE4,0x18,
-	0x62,0x10,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x45,0x31,0x6E,0x73,0x29,0x4A,0x42,0x10,0x00,0x00,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x42,0x10,0x00,0x00,0x62,0x10,0xE8,0x41,0x82,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x00,0x00,0x61,0x10,0x14,0xAD,0x8A,0x4A,0x00,0x00,0xC7,0x41,0x45,0x31,0x6A,0x62,0x6E,0x73,0xF0,0x83,0xB2,0xA4,0xF4,0xAC,0x55,0xB5,0xD7,0xBD,0x14,0xA5,0x30,0x8C,0x30,0x8C,0x92,0x9C,0x51,0x94,0x92,0x9C,0x14,0xAD,0xB3,0x94,0xF4,0xA4,0x55,0xB5,
-	0x76,0xB5,0x96,0xBD,0x30,0x8C,0xAB,0x5A,0x25,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x4A,0xB7,0xB5,0x5D,0xEF,0x76,0xB5,0x66,0x31,0xA3,0x10,0x31,0x84,0x55,0xAD,0x31,0x84,0xB7,0xB5,0x76,0xB5,0xB7,0xBD,0x39,0xCE,0xB2,0xA4,0x4D,0x73,0x0C,0x6B,0x8E,0x83,0x4D,0x73,0x30,0x8C,0xCB,0x62,0xAB,0x5A,0xB6,0xBD,0xF8,0xC5,0xB3,0x94,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0x86,0x31,0xA7,0x31,0xA3,0x18,0xEF,0x8B,0x18,0xCE,0x7A,0xD6,0x31,0x84,0x21,0x08,0x04,0x29,0x45,0x29,0x45,0x29,0xE4,0x20,0x25,0x29,0x21,0x08,0x4D,0x73,0x18,0xCE,
-	0x39,0xC6,0x8A,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x28,0x42,0x38,0x42,0x48,0x61,0x00,0x21,0x70,0x00,0xA8,0x01,0x98,0x01,0x98,0x00,0xA8,0x00,0xA8,0x02,0xB8,0x43,0xC0,0x05,0xC9,0xA4,0xD8,0x01,0xC0,0x42,0x38,0x42,0x48,0x21,0x88,0x21,0x70,
-	0x42,0x10,0x45,0x71,0x6A,0x62,0x86,0x31,0x00,0x08,0x2D,0x6B,0x76,0xB5,0x96,0xBD,0xC7,0x39,0x41,0x08,0x04,0x21,0xA3,0x18,0xC3,0x20,0x41,0x10,0xE8,0x41,0x14,0xAD,0x55,0xB5,0x66,0x31,0x00,0x00,0x42,0x10,0x41,0x10,0x62,0x00,0x21,0x70,0x01,0xC8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x42,0x38,0x41,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x42,0x60,0x23,0xD0,0x01,0xA0,0x00,0xA8,0x00,0xB8,0x01,0xA0,0x21,0x10,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0xC4,0xA8,0x85,0xC9,0x85,0xC9,0x85,0xC9,0x48,0xD2,0x05,0xC9,0x8E,0x83,0x59,0xC6,0xD7,0xBD,0xB7,0xBD,0xB7,0xB5,
-	0x96,0xBD,0xD7,0xBD,0xF8,0xC5,0x66,0x31,0x21,0x08,0xE4,0x20,0xA3,0x18,0x41,0x10,0x82,0x10,0x21,0x08,0x29,0x42,0xD7,0xB5,0x25,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0xE8,0x41,0x6E,0x73,0x08,0x42,0x21,0x08,0x00,0x00,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x21,0x08,0x21,0x08,0xE8,0x41,0x04,0x21,0x00,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x00,0x00,0x4D,0x73,0xD7,0xB5,0x82,0x08,0x00,0x00,0x66,0x31,0x92,0x9C,0xF8,0xC5,
-	0x96,0xB5,0x35,0xA5,0x76,0xA5,0x35,0xA5,0xB3,0x9C,0xB3,0x94,0x51,0x84,0x72,0x94,0xF4,0xA4,0xB2,0xA4,0x14,0xAD,0x14,0xAD,0x14,0xA5,0x14,0xA5,0xD3,0xA4,0xD3,0x9C,0xF4,0x9C,0x35,0xAD,0x76,0xB5,0xB7,0xBD,0x14,0xA5,0xEB,0x72,0xC3,0x20,0x00,0x00,0x00,0x00,0x62,0x10,0xAF,0x6B,0x59,0xC6,0x59,0xD6,0xEF,0x8B,0xA7,0x39,0x6E,0x73,
-	0x8E,0x7B,0x8E,0x7B,0x35,0xA5,0x55,0xA5,0x76,0xB5,0xB7,0xBD,0xB7,0xBD,0x76,0xB5,0x76,0xB5,0xB6,0xBD,0xF8,0xBD,0x8E,0x7B,0x0C,0x6B,0x55,0xA5,0xF4,0x9C,0x31,0x84,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE4,0x20,
-	0x04,0x21,0xE4,0x20,0x62,0x10,0xF0,0x83,0xF8,0xC5,0x59,0xD6,0xAF,0x6B,0x21,0x08,0x25,0x29,0x04,0x29,0x04,0x21,0x25,0x29,0x45,0x31,0x00,0x00,0xEC,0x62,0x18,0xCE,0x18,0xC6,0x8A,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x21,0x28,0x42,0x38,0x21,0x28,
-	0x42,0x30,0x00,0xA8,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x02,0xA8,0x02,0xB8,0x84,0xC8,0x85,0xC9,0x84,0xC8,0x01,0xC8,0x01,0xC8,0x01,0x98,0x62,0x08,0x41,0x08,0xA1,0x18,0x08,0x52,0x24,0x51,0xE4,0x18,0x82,0x10,0x8E,0x7B,0x96,0xBD,0x34,0xB5,0x25,0x29,0x00,0x08,0xA3,0x18,0x41,0x10,0xA3,0x18,0x41,0x08,0xA7,0x39,0x14,0xAD,
-	0x55,0xB5,0x45,0x31,0x00,0x00,0x42,0x10,0x41,0x10,0x62,0x00,0x21,0x70,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x42,0x30,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x48,0x23,0xD0,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x01,0x98,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x42,0x98,0x23,0xD0,0x84,0xC8,0x05,0xC9,0x48,0xD2,0xE6,0xE1,0x8E,0xB3,0xD7,0xB5,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x76,0xB5,0xF8,0xC5,0x76,0xB5,0x25,0x29,0xA3,0x18,0xE4,0x20,0xA3,0x18,0x45,0x29,0x21,0x08,0x00,0x00,0xEC,0x62,0xD7,0xBD,0x86,0x39,0x00,0x00,0x62,0x10,0x41,0x10,
-	0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE4,0x20,0x41,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x41,0x10,0x41,0x10,
-	0x00,0x08,0x86,0x31,0xA7,0x39,0x00,0x00,0x62,0x08,0x42,0x10,0x41,0x10,0x00,0x00,0x41,0x10,0x31,0x8C,0xCB,0x52,0x41,0x10,0x8A,0x5A,0x96,0xBD,0xF8,0xBD,0x35,0xA5,0xB3,0x9C,0x10,0x84,0x30,0x8C,0xB2,0xA4,0xB3,0x94,0x92,0x9C,0xF4,0xAC,0xD3,0x9C,0x35,0xA5,0x76,0xAD,0x55,0xAD,0x14,0xAD,0x55,0xAD,0xF4,0xA4,0xD3,0xA4,0x14,0xA5,
-	0xF4,0xA4,0xF4,0x9C,0xF4,0x9C,0x14,0xA5,0x14,0xA5,0x55,0xB5,0x55,0xB5,0x51,0x94,0x08,0x4A,0x00,0x00,0x00,0x00,0x8A,0x52,0x15,0x9D,0xB7,0xAD,0x96,0xB5,0x31,0x8C,0xEF,0x8B,0xEC,0x62,0x49,0x4A,0x8A,0x52,0xF4,0x9C,0x35,0xA5,0x14,0xA5,0x55,0xB5,0x8E,0x7B,0xB2,0xA4,0x35,0xAD,0xEC,0x62,0xCB,0x5A,0x35,0xAD,0x35,0xA5,0x31,0x84,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x10,0x29,0x4A,0x29,0x4A,0x00,0x00,0x30,0x8C,0xF8,0xC5,0x39,0xCE,0x6E,0x73,0x41,0x08,0x66,0x29,0x45,0x31,0xC7,0x41,0x45,0x29,0x86,0x39,0x62,0x08,0x6A,0x52,0x18,0xC6,
-	0xB7,0xBD,0x08,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x28,0x21,0x28,0x42,0x38,0x21,0x70,0x00,0xA8,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x21,0xA8,0x23,0xB8,0x85,0xC9,0x85,0xC9,0x43,0xC0,0x02,0xB8,0x00,0xB8,0x01,0xC0,0x42,0x48,0x21,0x08,
-	0x24,0x51,0x66,0x89,0xEC,0x62,0x25,0x29,0x00,0x00,0xF0,0x83,0xB7,0xBD,0x35,0xAD,0x45,0x29,0x41,0x10,0xC3,0x20,0xC3,0x20,0xA3,0x18,0x82,0x10,0xC7,0x41,0x55,0xB5,0x92,0x9C,0xA3,0x18,0x00,0x00,0x41,0x10,0x41,0x08,0x61,0x00,0x21,0x88,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x42,0x38,0x62,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x82,0x38,0x23,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x70,0x62,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x88,0x01,0xC0,0x02,0xB8,0x02,0xB0,0xA4,0xB8,0x85,0xC9,0x8E,0xB3,0xD7,0xB5,0xB7,0xB5,0xB7,0xBD,0xB7,0xBD,
-	0x96,0xB5,0xF8,0xC5,0x55,0xB5,0xC3,0x20,0xC3,0x18,0x04,0x21,0xE4,0x18,0xAF,0x6B,0x8E,0x83,0xE8,0x41,0xF0,0x7B,0x96,0xBD,0x6E,0x73,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x00,0x00,0x00,0x08,0x00,0x08,0x01,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xC7,0x41,0x82,0x10,0x00,0x08,0x62,0x10,0x08,0x42,0x62,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x66,0x31,0x8A,0x5A,0xE8,0x41,0xEF,0x8B,0xD7,0xC5,0xF8,0xBD,0x31,0x8C,0xC7,0x39,
-	0xAB,0x5A,0xD3,0x9C,0x51,0x94,0xF0,0x7B,0xB7,0xB5,0x18,0xC6,0x96,0xB5,0x14,0xA5,0x92,0x9C,0x55,0xAD,0x15,0x9D,0x51,0x84,0xB3,0x94,0xD7,0xC5,0x35,0xAD,0xF4,0x9C,0x14,0xA5,0x55,0xA5,0x14,0xAD,0xB3,0x94,0x35,0xA5,0xD3,0xA4,0x35,0xAD,0x55,0xB5,0x59,0xD6,0x92,0x9C,0x4D,0x73,0x45,0x31,0x00,0x00,0xA7,0x31,0x8A,0x52,0x72,0x8C,
-	0xB7,0xB5,0x55,0xB5,0xAF,0x7B,0xCB,0x62,0x31,0x84,0x14,0xAD,0xD3,0x9C,0x96,0xB5,0xEC,0x62,0xAF,0x7B,0x35,0xA5,0xEC,0x5A,0xCB,0x5A,0x14,0xAD,0xF4,0xA4,0xF0,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,
-	0x29,0x4A,0x2D,0x6B,0x62,0x10,0xAF,0x7B,0x18,0xCE,0xF8,0xC5,0xCB,0x5A,0x41,0x08,0x25,0x29,0xA7,0x39,0x6A,0x4A,0x45,0x31,0xC7,0x41,0xA3,0x18,0xC7,0x41,0x96,0xBD,0xD7,0xBD,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x48,
-	0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x00,0xB8,0x01,0xC0,0x23,0xC0,0x05,0xC9,0x85,0xC9,0x05,0xC9,0x23,0xC0,0x01,0xC8,0x01,0xC8,0x21,0x70,0x00,0x28,0xE7,0xA9,0x66,0x89,0x4D,0x63,0x6E,0x73,0x00,0x00,0x10,0x8C,0xB7,0xBD,0xD3,0x9C,0xC3,0x20,0xA3,0x18,0x25,0x29,0x66,0x31,0xC3,0x18,0x82,0x18,0xA7,0x39,0x96,0xBD,
-	0x31,0x8C,0x21,0x08,0x00,0x08,0x62,0x10,0x41,0x00,0x42,0x28,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x42,0x48,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x00,0xA2,0x20,0x23,0xB8,0x00,0xB8,0x00,0xA8,0x01,0xC8,0x42,0x48,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x00,0x21,0x88,0x00,0xB8,0x00,0xB8,0x02,0xB0,0x00,0xA8,0x00,0xB8,0x8E,0xB3,0xD7,0xB5,0xB7,0xB5,0x96,0xBD,0x96,0xBD,0x96,0xB5,0x39,0xC6,0x31,0x8C,0x21,0x08,0x04,0x29,0x04,0x29,0x04,0x21,0xD0,0x73,0xF4,0xAC,0xD3,0xA4,0xB3,0x9C,0xD3,0x9C,0x55,0xB5,0x25,0x29,0x00,0x00,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xA3,0x18,0x82,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x86,0x31,0x25,0x29,0x21,0x08,0x41,0x10,0x21,0x08,0x82,0x10,0x8A,0x52,0xC3,0x18,0x00,0x00,
-	0x66,0x29,0x25,0x29,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0xAB,0x5A,0xB3,0x9C,0x18,0xCE,0x55,0xAD,0x31,0x84,0x55,0xA5,0xB3,0x94,0x8E,0x83,0xCB,0x62,0xEC,0x62,0x72,0x94,0xC7,0x39,0xC3,0x10,0xAB,0x52,0xF4,0x94,0x96,0xB5,0x76,0xB5,0x72,0x94,0x72,0x94,0xD3,0x9C,0xAB,0x5A,0x6E,0x73,0xD7,0xB5,0xD7,0xC5,
-	0x14,0xA5,0x34,0xB5,0x35,0xA5,0xAB,0x52,0x31,0x84,0x96,0xB5,0x35,0xA5,0x31,0x84,0x0C,0x6B,0x55,0xA5,0xBB,0xDE,0xF4,0xAC,0x66,0x31,0x40,0x10,0xE4,0x20,0x25,0x21,0x29,0x42,0xB3,0x94,0x96,0xB5,0x34,0xB5,0x51,0x94,0x14,0xA5,0xB3,0x9C,0x14,0xAD,0xF0,0x7B,0x4D,0x73,0x14,0xA5,0x29,0x4A,0xEC,0x62,0x35,0xA5,0xD3,0x9C,0x10,0x84,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0xA3,0x18,0x6A,0x52,0xCB,0x5A,0x00,0x00,0x8E,0x83,0xF8,0xC5,0xF8,0xC5,0xEC,0x62,0x00,0x00,0xE4,0x20,0x86,0x39,0x4D,0x63,0x04,0x29,0x66,0x29,0x82,0x18,0xC7,0x41,0x96,0xBD,
-	0xD7,0xC5,0xC7,0x41,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x20,0x21,0x70,0x00,0xA8,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x42,0x60,0x42,0x48,0x84,0xC8,0xA4,0xD8,0xE6,0xE1,0xE6,0xE1,0x43,0xC0,0x21,0x70,0x42,0x60,0x62,0x18,0x00,0x00,
-	0x45,0x71,0x24,0x51,0x28,0x3A,0x6A,0x52,0x82,0x10,0x10,0x8C,0x96,0xBD,0x51,0x94,0xA3,0x18,0x62,0x10,0x86,0x39,0xC7,0x41,0xC3,0x18,0xC3,0x20,0xC7,0x41,0x96,0xBD,0xEF,0x8B,0x21,0x08,0x00,0x00,0x41,0x10,0x62,0x00,0x42,0x38,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x42,0x38,0x41,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x10,0x02,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x28,0x62,0x00,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x00,0x01,0x98,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x8E,0xB3,0x76,0xA5,0x55,0xAD,0x76,0xB5,0x96,0xB5,
-	0x76,0xB5,0x18,0xC6,0x6E,0x73,0x21,0x08,0x04,0x29,0xC3,0x18,0x25,0x29,0xD0,0x73,0xD3,0xA4,0x72,0x94,0x72,0x94,0x72,0x94,0x96,0xB5,0xAF,0x7B,0x41,0x10,0x00,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,
-	0x21,0x08,0x82,0x10,0xA7,0x39,0xE4,0x20,0x66,0x31,0xCB,0x62,0xEC,0x5A,0x28,0x3A,0xA3,0x18,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x08,0x00,0x08,0x62,0x10,0x86,0x39,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE4,0x20,0xB2,0xA4,0x6E,0x63,0x92,0x94,0xF4,0x94,0xAF,0x6B,0x31,0x8C,0xB3,0x8C,0x8E,0x7B,
-	0xF4,0xA4,0x6E,0x73,0xCB,0x5A,0x30,0x8C,0xE8,0x41,0x00,0x00,0x21,0x00,0xE8,0x39,0x55,0xAD,0x15,0x9D,0x72,0x94,0x31,0x8C,0x14,0xA5,0x6A,0x4A,0x66,0x29,0xB3,0x94,0x59,0xCE,0x35,0xAD,0x14,0xAD,0xAF,0x7B,0x6A,0x4A,0xB3,0x94,0x35,0xAD,0x55,0xA5,0x31,0x8C,0xCB,0x5A,0x2D,0x6B,0x14,0xAD,0x39,0xCE,0xEF,0x8B,0x08,0x4A,0xA7,0x31,
-	0xC7,0x39,0x25,0x29,0x49,0x4A,0x76,0xAD,0xF4,0xA4,0xB3,0x9C,0x30,0x8C,0xB3,0x9C,0x30,0x8C,0x0C,0x6B,0x55,0xB5,0xA7,0x39,0x30,0x8C,0x55,0xB5,0xF4,0x9C,0x8E,0x7B,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x66,0x31,0x66,0x31,0x00,0x00,0xF0,0x83,0xF8,0xC5,0xD7,0xC5,0x6A,0x4A,0x00,0x08,0xC3,0x18,0xA7,0x39,0x8E,0x7B,0xC3,0x20,0xE4,0x20,0x41,0x10,0xE4,0x20,0xF4,0xAC,0x18,0xC6,0xE8,0x41,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x20,0x21,0x88,
-	0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x42,0x60,0x41,0x00,0x21,0x00,0x41,0x08,0xE7,0xA9,0x66,0x89,0xE4,0x38,0x21,0x08,0x41,0x00,0x82,0x00,0x41,0x00,0x00,0x00,0xE4,0x38,0xC6,0x39,0xEC,0x62,0x66,0x31,0x00,0x00,0x51,0x94,0xB7,0xBD,0xF0,0x7B,0x61,0x10,0x41,0x10,0xC7,0x41,0xC7,0x39,0x82,0x10,0x82,0x10,0x49,0x52,0x96,0xBD,
-	0x8E,0x7B,0x00,0x00,0x21,0x08,0x41,0x10,0x62,0x00,0x42,0x60,0x01,0xC8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0x38,0x41,0x00,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x00,0x21,0x70,0x00,0xB8,0x00,0xB8,0x01,0x98,0x61,0x00,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x01,0x98,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x01,0x98,0xEF,0x8B,0x76,0xAD,0xB3,0x9C,0xF4,0xA4,0x14,0xAD,0x14,0xA5,0xF8,0xBD,0x4D,0x73,0x21,0x08,0xC3,0x18,0x21,0x08,0xA7,0x31,0xB3,0x94,0x72,0x94,0x51,0x94,0x72,0x94,0x92,0x9C,0xD3,0x9C,0xF8,0xC5,0xCB,0x62,0x00,0x00,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x21,0xF0,0x83,0x72,0x8C,0x8A,0x4A,0x04,0x21,0x00,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xE4,0x20,
-	0xC3,0x20,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xC3,0x20,0xF4,0xAC,0x86,0x31,0x8E,0x7B,0x14,0xA5,0xB3,0x9C,0x0C,0x6B,0xF0,0x7B,0x72,0x8C,0x8E,0x7B,0xAF,0x7B,0xEC,0x62,0xAB,0x5A,0xAF,0x7B,0x0C,0x6B,0x66,0x31,0x00,0x08,0x62,0x08,0x8A,0x4A,0xF0,0x7B,0xB7,0xAD,0xB3,0x9C,0xD3,0xA4,0xEC,0x62,0xA3,0x18,
-	0xAB,0x52,0xB7,0xAD,0x96,0xBD,0xF4,0xAC,0x51,0x94,0xF4,0xA4,0x96,0xB5,0x55,0xAD,0xB7,0xBD,0x76,0xB5,0xF0,0x83,0x8E,0x7B,0xB3,0x94,0x96,0xB5,0xD7,0xC5,0xF0,0x83,0xCB,0x62,0x0C,0x6B,0x86,0x31,0xE4,0x20,0x92,0x8C,0x14,0xAD,0x10,0x8C,0xD3,0x9C,0x92,0x9C,0x49,0x4A,0x55,0xA5,0xA7,0x39,0xF0,0x83,0xB7,0xB5,0xF4,0x9C,0x6A,0x4A,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x10,0x00,0x08,0x00,0x00,0x30,0x8C,0xF8,0xC5,0xD7,0xC5,0x28,0x3A,0x41,0x10,0xC3,0x18,0xC7,0x39,0x10,0x84,0x25,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x30,0x8C,
-	0x7A,0xD6,0x69,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x21,0x28,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x21,0x28,0x41,0x00,0x83,0x50,0x82,0x38,0x42,0x30,0x42,0x28,0x21,0x00,0x62,0x08,0x62,0x18,0x41,0x20,0x62,0x18,0x42,0x28,
-	0xA2,0x20,0x24,0x51,0xC7,0x41,0x00,0x00,0xA3,0x18,0xB2,0xA4,0xB7,0xBD,0xEC,0x62,0x21,0x08,0x42,0x10,0x6A,0x52,0xC7,0x39,0x82,0x18,0x21,0x08,0x08,0x42,0x55,0xB5,0x4D,0x73,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x00,0x42,0x60,0x01,0xC8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x01,0xC0,0x42,0x28,0x41,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x00,0x42,0x60,0x01,0xC8,0x00,0xB8,0x42,0x38,0x62,0x00,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x01,0x98,0x01,0xC0,0x02,0xA8,0x02,0xA8,0x00,0xB8,0x83,0xA8,0xF4,0xAC,0x76,0xA5,0xF4,0xAC,0xB2,0xA4,0xD3,0xA4,
-	0x14,0xAD,0x14,0xAD,0x08,0x4A,0x41,0x10,0x45,0x29,0xE4,0x18,0xC7,0x39,0x8E,0x7B,0x72,0x94,0x72,0x94,0x72,0x94,0x72,0x94,0xB3,0x9C,0x35,0xAD,0x45,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x01,0x08,0x45,0x29,0x04,0x21,0xA3,0x10,0xA3,0x18,0x62,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x45,0x31,0x55,0xA5,0x10,0x84,0x6A,0x4A,0xEC,0x5A,0xB3,0x94,0x51,0x8C,0x6A,0x52,0xF0,0x83,
-	0x6E,0x73,0x6A,0x52,0x35,0xAD,0xF0,0x7B,0x08,0x4A,0xF0,0x7B,0x6E,0x73,0x6A,0x52,0x00,0x00,0x00,0x00,0xC3,0x20,0xAF,0x7B,0x14,0xA5,0x55,0xB5,0x96,0xB5,0xF0,0x7B,0x20,0x08,0xA3,0x10,0x72,0x94,0x18,0xC6,0x14,0xA5,0x4D,0x63,0xB3,0x94,0xD7,0xBD,0x96,0xB5,0x76,0xB5,0xF8,0xC5,0x55,0xAD,0x92,0x9C,0xF4,0x9C,0xF4,0xAC,0xD7,0xC5,
-	0x14,0xAD,0xEF,0x8B,0x92,0x9C,0x6A,0x52,0xE4,0x20,0x51,0x84,0xD3,0x9C,0x14,0xA5,0x34,0xB5,0xE4,0x20,0x6A,0x4A,0xCB,0x62,0x6E,0x73,0x76,0xAD,0x72,0x94,0x08,0x42,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0x25,0x21,0x62,0x18,0x00,0x00,0x30,0x8C,0x18,0xCE,0xB7,0xAD,0x66,0x29,0x21,0x10,0x82,0x18,0xC7,0x39,0x51,0x8C,0x25,0x29,0x04,0x29,0xA3,0x18,0x00,0x08,0xAF,0x7B,0xDB,0xE6,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x48,0x01,0x98,
-	0x01,0x98,0x01,0x98,0x00,0xA8,0x01,0x98,0x41,0x00,0x42,0x28,0x23,0xD0,0xA4,0xD8,0x23,0xB8,0x43,0xC0,0x23,0xC0,0x02,0xA8,0x21,0xA8,0x00,0xA8,0x00,0xB8,0x01,0xA0,0x20,0x08,0xC3,0x20,0x86,0x39,0x00,0x00,0x66,0x31,0x55,0xB5,0xF4,0xAC,0xA7,0x31,0x82,0x10,0x21,0x08,0xEC,0x62,0x08,0x4A,0x21,0x08,0x00,0x00,0x04,0x29,0x96,0xBD,
-	0xEC,0x62,0x00,0x00,0x62,0x10,0x41,0x08,0x62,0x00,0x42,0x60,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x42,0x28,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x48,0x00,0xB8,0x21,0x70,0x62,0x00,0x61,0x00,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0xA0,0x23,0xD0,0x02,0xB8,0x02,0xB8,0x00,0xB8,0xC4,0xA8,0x14,0xAD,0x55,0xA5,0xD3,0xA4,0xD3,0xA4,0xF4,0xAC,0x55,0xB5,0xF0,0x83,0xC3,0x20,0xC3,0x18,0x04,0x29,0xC3,0x20,0x21,0x08,0x41,0x10,0x8E,0x7B,0xF4,0xA4,0x72,0x94,0x72,0x94,0x76,0xB5,0x51,0x94,0x00,0x08,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x21,0x08,0x25,0x29,0xC7,0x39,0x45,0x29,0x45,0x31,0x45,0x29,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x41,0x10,0x00,0x00,0xE8,0x41,0xF8,0xC5,0x96,0xB5,0xAF,0x7B,0x0C,0x6B,0x31,0x84,0xF4,0x9C,0x4D,0x63,0x6A,0x52,0x51,0x8C,0x4D,0x63,0x28,0x3A,0xA7,0x29,0x20,0x08,0x41,0x08,0x62,0x10,0xE4,0x20,0x82,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x29,0x42,0xB3,0x8C,0xB3,0x9C,0x55,0xAD,
-	0xF4,0xA4,0xE4,0x20,0x00,0x00,0x0C,0x5B,0xDB,0xD6,0x30,0x8C,0xC7,0x41,0xD3,0x9C,0xB3,0x9C,0xB3,0x94,0x35,0xAD,0x96,0xB5,0x55,0xAD,0x14,0xA5,0xF4,0xA4,0xF4,0xA4,0x76,0xB5,0x55,0xB5,0xD3,0x9C,0x55,0xAD,0x4D,0x73,0x45,0x31,0x8E,0x7B,0xD3,0x9C,0x14,0xA5,0xC7,0x39,0xC3,0x20,0x6A,0x52,0xAF,0x6B,0x96,0xB5,0xF0,0x83,0x04,0x21,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x29,0x66,0x31,0x21,0x08,0xAF,0x7B,0x7A,0xD6,0x51,0x8C,0x21,0x08,0xC3,0x18,0xE4,0x20,0x08,0x4A,0x14,0xAD,0xC7,0x39,0x25,0x29,0x45,0x29,0x41,0x08,0xEC,0x62,
-	0x1C,0xE7,0x69,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x00,0x42,0x38,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x01,0x98,0x62,0x00,0x42,0x30,0x23,0xD0,0x05,0xC9,0x84,0xC8,0x43,0xC0,0x23,0xC0,0x01,0xC0,0x00,0xB8,0x00,0xB8,0x01,0xC8,0x01,0xA0,
-	0x41,0x08,0x21,0x00,0x66,0x31,0x00,0x00,0x86,0x39,0x96,0xBD,0x92,0x9C,0xE4,0x20,0x04,0x21,0x41,0x10,0x4D,0x73,0x6A,0x52,0x62,0x10,0x21,0x08,0x66,0x31,0xF4,0xAC,0xAB,0x5A,0x00,0x00,0x62,0x10,0x41,0x10,0x62,0x00,0x42,0x60,0x01,0xC8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x21,0xA8,0x01,0x98,0x21,0x88,0x42,0x28,0x62,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x20,0x41,0x20,0x41,0x08,0x41,0x10,0x41,0x00,0x42,0x28,0x01,0x98,0x21,0x88,0x41,0x20,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x83,0xA8,0x23,0xD0,0x02,0xB8,0x23,0xB8,0x00,0xB8,0x46,0xB1,0x55,0xB5,0x55,0xAD,0x14,0xAD,0xF4,0xA4,0xF4,0xAC,
-	0xB7,0xBD,0x6E,0x73,0x00,0x00,0xE4,0x18,0xA3,0x18,0x25,0x21,0x41,0x08,0x62,0x10,0x31,0x8C,0x14,0xA5,0xB3,0x9C,0x72,0x94,0x76,0xB5,0x8E,0x83,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0x45,0x31,0x45,0x31,0xC3,0x18,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0x29,0x4A,0xB7,0xAD,0x76,0xAD,0xB3,0x9C,0x10,0x8C,0x92,0x94,0xEC,0x5A,0x25,0x21,
-	0x08,0x42,0xA7,0x31,0x00,0x00,0x00,0x00,0x21,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x42,0x10,0x82,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x08,0x49,0x4A,0x51,0x8C,0xB3,0x94,0xB3,0x94,0x82,0x18,0x00,0x00,0x8A,0x52,0xBB,0xDE,0xAF,0x7B,0x08,0x42,0xB3,0x94,0x14,0xAD,0x51,0x8C,0xD3,0x9C,0x35,0xAD,0x51,0x8C,0xD3,0x9C,0x35,0xAD,
-	0xB3,0x9C,0xD3,0xA4,0x76,0xAD,0x55,0xB5,0x96,0xBD,0x92,0x9C,0xE8,0x41,0xF0,0x7B,0x30,0x8C,0x08,0x42,0x00,0x00,0xA3,0x18,0x51,0x94,0xD7,0xBD,0x6A,0x4A,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x08,0x4A,0xE8,0x41,0x00,0x00,0xEF,0x8B,0xDB,0xE6,0xEC,0x62,0x21,0x08,0xA3,0x18,0x82,0x10,0x29,0x4A,0x76,0xB5,0x08,0x42,0x82,0x10,0xC3,0x18,0x00,0x00,0x08,0x4A,0xDB,0xE6,0xE8,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x42,0x48,0x01,0x98,
-	0x01,0x98,0x01,0x98,0x00,0xA8,0x01,0x98,0x41,0x00,0x82,0x38,0xA4,0xD8,0xA4,0xD8,0x05,0xC9,0x84,0xC8,0x23,0xB8,0x02,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x01,0xA0,0x82,0x38,0x41,0x00,0x08,0x4A,0x82,0x10,0xC7,0x39,0x76,0xB5,0x51,0x94,0x82,0x10,0xA3,0x18,0x01,0x08,0xF0,0x83,0x8A,0x5A,0xA3,0x18,0xA3,0x18,0xA7,0x39,0xB2,0xA4,
-	0x49,0x52,0x00,0x00,0x62,0x10,0x41,0x08,0x41,0x00,0x42,0x60,0x01,0xC8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x21,0xA8,0x00,0xA8,0x41,0x20,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x30,0x42,0x30,0x41,0x08,0x41,0x10,0x21,0x08,0x61,0x00,0x00,0xA8,0x01,0x98,0x21,0x08,0x62,0x08,0x41,0x08,0x41,0x08,0x42,0x30,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x28,0x23,0xC0,0x23,0xC0,0x23,0xB8,0x23,0xB8,0x00,0xB8,0xE7,0xA9,0xB7,0xAD,0x55,0xAD,0x34,0xB5,0xF4,0xAC,0x35,0xAD,0xD7,0xC5,0xCB,0x62,0x00,0x00,0x04,0x21,0xC3,0x20,0x62,0x10,0x00,0x00,0x04,0x21,0x76,0xA5,0xB3,0x9C,0xB3,0x9C,0xB3,0x9C,0x55,0xB5,0x29,0x4A,0x00,0x00,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0xA3,0x18,0x82,0x18,0x41,0x08,0x41,0x10,0x42,0x10,0x62,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x5A,0xA2,0x20,0xE8,0x39,0x51,0x84,0x6E,0x63,0xCB,0x52,0x86,0x31,0x21,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x21,0x08,
-	0xA7,0x31,0xCB,0x52,0x6A,0x52,0x66,0x31,0x00,0x00,0xA7,0x31,0x7A,0xCE,0x10,0x84,0xE8,0x39,0xB3,0x94,0xB7,0xB5,0x31,0x8C,0x51,0x94,0xB3,0x9C,0x8E,0x7B,0xF4,0x9C,0x76,0xAD,0x14,0xAD,0xD3,0xA4,0x31,0x84,0xAF,0x6B,0x96,0xB5,0x6E,0x73,0xC7,0x39,0x8E,0x7B,0x6A,0x52,0x00,0x00,0x00,0x00,0xD3,0xA4,0xD7,0xBD,0x82,0x10,0x62,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE8,0x39,0x86,0x39,0x00,0x00,0xF0,0x83,0xBB,0xDE,0xCB,0x5A,0xA3,0x18,0xE4,0x20,0xA3,0x18,0x82,0x18,0x86,0x31,0xE4,0x20,0xA3,0x18,0xE4,0x20,0x00,0x00,0x66,0x31,
-	0xDB,0xE6,0x86,0x31,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x30,0x21,0x88,0x01,0x98,0x01,0x98,0x01,0x98,0x21,0xA8,0x41,0x20,0x62,0x00,0xA3,0x90,0x66,0x89,0x46,0xB1,0x84,0xC8,0x43,0xC0,0x23,0xC0,0x00,0xB8,0x00,0xA8,0x01,0xC8,0x01,0x98,
-	0x42,0x10,0x62,0x10,0xCB,0x62,0x00,0x00,0x45,0x29,0xB7,0xBD,0x2D,0x6B,0x00,0x00,0x00,0x08,0x62,0x10,0x10,0x8C,0x29,0x4A,0x61,0x10,0x62,0x10,0x45,0x31,0xB2,0xA4,0x66,0x31,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x00,0x42,0x60,0x01,0xC8,0x00,0xA8,0x00,0xA8,0x01,0x98,0x01,0x98,0x00,0xB8,0x01,0xA0,0x62,0x10,0x61,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x00,0x42,0x48,0x42,0x48,0x41,0x00,0x41,0x10,0x41,0x08,0x61,0x00,0x00,0xA8,0x42,0x60,0x62,0x00,0x41,0x10,0x41,0x00,0x42,0x28,0x42,0x38,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x00,0x42,0x30,0x23,0xB8,0x23,0xB8,0x23,0xB8,0x23,0xB8,0x00,0xB8,0xE7,0xA9,0xB7,0xAD,0x14,0xAD,0x35,0xAD,0xF4,0xAC,0x55,0xAD,
-	0x96,0xBD,0xC6,0x39,0x82,0x18,0x04,0x21,0xC3,0x18,0xE4,0x20,0x45,0x29,0x29,0x4A,0x35,0xA5,0xD3,0x9C,0xB3,0x9C,0x35,0xA5,0xF4,0xAC,0xC3,0x20,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x42,0x10,0x00,0x08,0xC3,0x18,0x04,0x21,0xC3,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x42,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x42,0x10,0x00,0x00,0x8A,0x5A,0x10,0x84,0x00,0x00,0x21,0x08,0xC3,0x20,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,
-	0x25,0x29,0xA3,0x18,0x41,0x08,0x00,0x08,0x04,0x21,0xE8,0x41,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0xCB,0x62,0x2D,0x6B,0x04,0x29,0x00,0x00,0x25,0x21,0x55,0xAD,0x72,0x94,0xC7,0x41,0xAF,0x7B,0xB7,0xBD,0x14,0xA5,0x14,0xAD,0x72,0x94,0x8A,0x52,
-	0x72,0x94,0xF8,0xC5,0x72,0x94,0xAB,0x5A,0x8A,0x52,0xAF,0x7B,0x92,0x9C,0x62,0x10,0xCB,0x5A,0x08,0x42,0x00,0x08,0x82,0x10,0x31,0x8C,0x29,0x4A,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x86,0x31,0xC3,0x18,0x00,0x00,0x8E,0x83,0x59,0xD6,0x6A,0x4A,0x82,0x10,0xE4,0x20,0x25,0x29,0x04,0x29,0x41,0x08,0xE4,0x18,0x45,0x31,0xE4,0x20,0x00,0x00,0x6A,0x52,0xBB,0xDE,0xA7,0x31,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x21,0x70,
-	0x00,0xA8,0x01,0x98,0x01,0x98,0x00,0xA8,0x21,0x70,0x62,0x00,0x21,0x00,0x42,0x30,0x84,0xC8,0x84,0xC8,0x23,0xC0,0x43,0xC0,0x00,0xA8,0x00,0xB8,0x01,0xC8,0x83,0x50,0x20,0x00,0xC3,0x20,0x6A,0x4A,0x00,0x00,0xA7,0x39,0x18,0xCE,0x6A,0x52,0x21,0x08,0xC3,0x20,0xE4,0x20,0x86,0x39,0xE4,0x20,0x82,0x18,0x00,0x08,0xE4,0x20,0xB2,0xA4,
-	0x04,0x29,0x00,0x00,0x41,0x10,0x41,0x08,0x62,0x00,0x21,0x88,0x01,0xC8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x21,0x70,0x61,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x00,0x42,0x60,0x21,0x70,0x41,0x00,0x41,0x10,0x62,0x08,0x41,0x00,0x21,0x88,0x42,0x48,0x62,0x00,0x41,0x10,0x62,0x00,0x42,0x48,0x42,0x60,0x62,0x00,
-	0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x00,0x82,0x38,0x23,0xB8,0x01,0xC0,0x02,0xB0,0x02,0xB8,0x00,0xB8,0xAB,0xAA,0x76,0xA5,0x35,0xAD,0x35,0xAD,0xF4,0xAC,0x76,0xB5,0xD3,0xA4,0x41,0x10,0x41,0x08,0x82,0x18,0x62,0x10,0xAB,0x52,0xB3,0x9C,0x51,0x94,0x72,0x94,0x92,0x9C,0x92,0x94,0x55,0xB5,0x10,0x8C,0x00,0x00,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x18,0xE8,0x41,0xC3,0x20,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x62,0x10,0x00,0x00,0x6A,0x52,0x8E,0x7B,0x21,0x10,0x00,0x00,0xE4,0x20,0x6A,0x52,0x62,0x10,0x21,0x08,0x41,0x10,0xA3,0x18,0x62,0x10,0x21,0x08,0x00,0x00,0x25,0x29,0x66,0x31,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x42,0x10,
-	0x41,0x10,0x21,0x08,0x00,0x08,0x62,0x10,0xCB,0x5A,0x86,0x39,0x00,0x00,0x62,0x10,0x92,0x9C,0xD3,0xA4,0xE8,0x41,0xAF,0x6B,0x96,0xB5,0x35,0xAD,0x55,0xB5,0x51,0x94,0xE8,0x41,0x92,0x94,0x55,0xB5,0x10,0x84,0xAF,0x7B,0x92,0x94,0xB7,0xBD,0x45,0x29,0x66,0x31,0xA7,0x39,0x41,0x10,0x41,0x10,0x29,0x42,0xC3,0x20,0x00,0x00,0xA7,0x39,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x86,0x39,0x6A,0x4A,0x00,0x00,0xF0,0x83,0x59,0xD6,0x08,0x42,0x21,0x10,0xE4,0x20,0x66,0x29,0xC3,0x20,0x21,0x10,0xC3,0x18,0x66,0x31,0xC3,0x18,0xE4,0x20,0x10,0x8C,
-	0x59,0xD6,0x29,0x42,0x00,0x00,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x38,0x00,0xA8,0x01,0x98,0x01,0x98,0x00,0xA8,0x00,0xA8,0x21,0x88,0x21,0x70,0x23,0xB8,0x85,0xC9,0x43,0xC0,0x43,0xC0,0x02,0xB8,0x02,0xB8,0x00,0xB8,0x00,0xB8,0x41,0x20,
-	0x00,0x00,0x25,0x29,0x6A,0x4A,0x00,0x00,0x08,0x42,0xD7,0xBD,0x08,0x42,0x62,0x10,0x04,0x29,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xC3,0x18,0x00,0x00,0x86,0x39,0x72,0x94,0xA3,0x18,0x00,0x08,0x42,0x10,0x41,0x00,0x62,0x18,0x01,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x42,0x60,0x41,0x00,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x62,0x00,0x42,0x60,0x21,0x88,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x48,0x41,0x20,0x41,0x08,0x41,0x10,0x41,0x00,0x21,0x70,0x42,0x48,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x38,0x23,0xC0,0x02,0xB0,0x02,0xA8,0x00,0xA8,0x00,0xA8,0xAB,0xAA,0x76,0xA5,0xF4,0xA4,0xF4,0xAC,0x14,0xA5,0xD7,0xBD,
-	0x51,0x94,0x00,0x08,0x21,0x08,0xA3,0x18,0x21,0x08,0xAB,0x52,0xB3,0x9C,0x10,0x84,0x31,0x8C,0x72,0x94,0xD3,0x9C,0x96,0xB5,0x8A,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA3,0x18,0x29,0x42,0x62,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x10,0x00,0x08,0x25,0x29,0xF0,0x7B,0x49,0x4A,0xA7,0x39,0x82,0x18,0x8A,0x52,0xA3,0x10,0x00,0x08,0x21,0x08,
-	0x41,0x08,0x01,0x08,0x41,0x08,0x86,0x31,0x04,0x29,0x20,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x42,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0x21,0x08,0x45,0x31,0x82,0x18,0x00,0x00,0x66,0x29,0xAF,0x7B,0xF0,0x83,0x6A,0x52,0x2D,0x6B,0xB3,0x94,0x35,0xAD,0xB7,0xBD,
-	0x92,0x9C,0x8A,0x52,0x31,0x84,0x55,0xB5,0x14,0xAD,0x96,0xBD,0xB7,0xB5,0xA3,0x18,0xE4,0x20,0xC6,0x39,0x00,0x08,0x62,0x10,0x8E,0x7B,0xC7,0x41,0x00,0x00,0x28,0x52,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x82,0x10,
-	0x49,0x52,0x6A,0x52,0x00,0x00,0x30,0x8C,0x7A,0xD6,0x86,0x31,0x62,0x10,0x04,0x21,0x04,0x21,0x66,0x31,0x66,0x31,0xE4,0x20,0x04,0x29,0xC3,0x18,0x62,0x10,0x45,0x31,0x96,0xBD,0xE8,0x39,0x00,0x00,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x01,0x98,0x00,0xA8,0x01,0x98,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x01,0xC0,0x84,0xC8,0x85,0xC9,0x05,0xC9,0x84,0xC8,0x02,0xB8,0x00,0xB8,0x01,0xC8,0x21,0x88,0x62,0x00,0x00,0x00,0xC3,0x20,0x2D,0x6B,0x21,0x08,0x6A,0x52,0xB7,0xBD,0x66,0x31,0x21,0x08,0x82,0x18,0xC3,0x18,0x82,0x18,0xC3,0x20,0xE4,0x20,0xA3,0x10,0x8E,0x83,0x72,0x94,
-	0x62,0x10,0x00,0x08,0x41,0x10,0x41,0x00,0x42,0x28,0x23,0xD0,0x01,0xC8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x01,0xC8,0x21,0x88,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x70,0x21,0x88,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0xA8,0x42,0x38,0x41,0x00,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x00,0x83,0x50,0x01,0xC0,0x02,0xA8,0x02,0xA8,0x00,0xB8,0x00,0xA8,0x8E,0xB3,0x76,0xA5,0x14,0xAD,0x14,0xAD,0x35,0xAD,0xB7,0xBD,0x51,0x94,0xC3,0x20,0xC3,0x18,0xC3,0x20,0x41,0x10,0xCB,0x52,0x72,0x94,0xF0,0x83,0x51,0x94,0x51,0x94,0x92,0x9C,0x55,0xAD,0x86,0x39,0x00,0x00,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x10,0x86,0x39,0xC3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x18,0x00,0x00,0x8A,0x52,0x31,0x8C,0x66,0x29,0x45,0x29,0x21,0x08,0x00,0x00,0x00,0x08,0x42,0x10,0xE4,0x20,0x41,0x10,0x82,0x18,0xE4,0x18,0xE4,0x20,0x41,0x08,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x21,0x08,0x21,0x08,0x42,0x10,0x21,0x10,0x41,0x08,0xE8,0x39,0x8E,0x83,0x4D,0x73,0xF0,0x83,0x6E,0x73,0x72,0x94,0x55,0xB5,0x55,0xB5,0xB2,0xA4,0xAF,0x7B,0x14,0xA5,0x14,0xA5,0xD7,0xBD,0x0C,0x5B,0x00,0x00,0x04,0x29,0xE8,0x41,0x00,0x00,0x86,0x31,0x4D,0x73,0x21,0x08,0x82,0x10,0x08,0x42,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x08,0x42,0xC7,0x39,0x00,0x00,0xD3,0xA4,0x14,0xA5,0x62,0x08,0xE4,0x20,0x82,0x18,0x21,0x08,0xF0,0x83,0x39,0xCE,0x6E,0x63,0x82,0x10,0x82,0x18,0x21,0x08,0x21,0x08,
-	0x92,0x9C,0x86,0x31,0x66,0x31,0x76,0xB5,0x49,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x62,0x18,0x41,0x00,0x21,0x70,0x00,0xB8,0x01,0x98,0x01,0x98,0x01,0x98,0x00,0xA8,0x00,0xA8,0x02,0xB8,0x43,0xC0,0x84,0xC8,0x43,0xC0,0x01,0xC0,0x01,0xC8,0x02,0xB0,0x41,0x20,0x41,0x00,
-	0x62,0x10,0x86,0x39,0x8A,0x52,0x00,0x00,0x0C,0x6B,0x96,0xBD,0x04,0x29,0x62,0x10,0x82,0x18,0x04,0x29,0x45,0x29,0x82,0x18,0xC3,0x20,0x62,0x10,0x49,0x4A,0x30,0x8C,0x00,0x08,0x00,0x00,0x21,0x08,0x41,0x08,0x62,0x08,0x83,0x50,0x02,0xB8,0x01,0xC0,0x02,0xB0,0x00,0xB8,0x21,0x88,0x01,0x98,0x42,0x60,0x41,0x00,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x00,0x21,0x88,0x21,0xA8,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x00,0x42,0x48,0x01,0xC0,0x42,0x28,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x42,0x60,0x00,0xB8,0x00,0xA8,0x21,0xA8,0x00,0xA8,0x01,0xA0,0x51,0x94,0x55,0xA5,0x14,0xAD,0xD3,0xA4,0xD3,0xA4,0x96,0xBD,
-	0x4D,0x73,0x41,0x08,0x04,0x21,0x82,0x10,0x82,0x10,0xF0,0x7B,0x31,0x8C,0x10,0x8C,0x10,0x8C,0x31,0x8C,0xB3,0x9C,0x10,0x8C,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x42,0x10,0x00,0x08,0x45,0x29,0xA7,0x31,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x5A,0x14,0xAD,0xE8,0x41,0x25,0x29,0x00,0x08,0x00,0x00,0xC3,0x18,0xCB,0x5A,0x66,0x31,
-	0x45,0x29,0xC7,0x39,0x82,0x18,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x42,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x29,0x42,0xF0,0x7B,0x51,0x84,0xD3,0xA4,0xCB,0x5A,0xF0,0x7B,
-	0xB7,0xAD,0xB7,0xBD,0x10,0x84,0x08,0x42,0x4D,0x63,0xD0,0x73,0x21,0x08,0x00,0x00,0xA7,0x39,0x08,0x42,0x00,0x00,0x86,0x31,0x6A,0x52,0x00,0x00,0xA3,0x18,0x8A,0x52,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,
-	0x86,0x39,0x29,0x4A,0x00,0x00,0xF4,0xA4,0x92,0x94,0x21,0x08,0x45,0x31,0xC3,0x20,0x41,0x10,0xEF,0x8B,0x7A,0xD6,0xD0,0x73,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0xF0,0x83,0x51,0x94,0x92,0x9C,0xBB,0xDE,0xAB,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x20,0x41,0x00,
-	0x41,0x20,0x01,0x98,0x00,0xA8,0x01,0x98,0x00,0xA8,0x01,0xA0,0x02,0xB8,0x23,0xB8,0x23,0xB8,0x84,0xC8,0x43,0xC0,0x23,0xC0,0x23,0xD0,0x42,0x48,0x41,0x00,0x41,0x00,0xC3,0x18,0xC7,0x41,0x08,0x4A,0x00,0x00,0xF0,0x83,0xB3,0x9C,0x41,0x08,0xC3,0x18,0x21,0x08,0xAB,0x5A,0xD3,0xA4,0x25,0x29,0x21,0x08,0x00,0x08,0x45,0x29,0x4D,0x73,
-	0x21,0x08,0x6A,0x52,0x86,0x39,0x00,0x08,0x41,0x08,0x21,0x00,0x42,0x30,0x23,0xB8,0x00,0xB8,0x02,0xA8,0x42,0x60,0x21,0x88,0x82,0x38,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0x98,0x02,0xA8,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x62,0x00,0x21,0x88,0x00,0xB8,0x21,0x10,0x62,0x00,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x70,0x00,0xB8,0x00,0xA8,0x01,0xA0,0x00,0xA8,0x22,0xB8,0xF4,0xA4,0x35,0xA5,0xD3,0x9C,0xF4,0xA4,0xF4,0xA4,0x76,0xB5,0xCB,0x62,0x00,0x00,0x04,0x29,0x41,0x08,0xE7,0x31,0x76,0xAD,0x92,0x9C,0x10,0x8C,0xF0,0x83,0x31,0x8C,0xF4,0xAC,0xCB,0x62,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0xC7,0x39,0x45,0x31,0x82,0x18,0x21,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xE8,0x41,0x55,0xAD,0x18,0xC6,0xEC,0x5A,0x00,0x08,0xA3,0x18,0xA3,0x18,0x45,0x29,0x00,0x00,0xC3,0x18,0x62,0x10,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x42,0x10,0x41,0x10,
-	0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x08,0x45,0x29,0x29,0x42,0x35,0xAD,0x14,0xA5,0x49,0x52,0x2D,0x6B,0x8E,0x7B,0x49,0x4A,0xAF,0x7B,0x31,0x8C,0x04,0x21,0x00,0x00,0x00,0x00,0x6A,0x52,0x08,0x4A,0x00,0x00,0xC7,0x39,0x04,0x21,0x82,0x10,0x21,0x08,0x25,0x29,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xC3,0x18,0x25,0x29,0xE4,0x18,0x00,0x00,0x34,0xB5,0xD0,0x73,0x62,0x10,0x25,0x29,0xE4,0x20,0x82,0x10,0xF0,0x83,0x39,0xCE,0xF0,0x7B,0x41,0x08,0xC3,0x20,0xC3,0x18,0x00,0x08,
-	0x28,0x52,0xB7,0xBD,0x55,0xAD,0x96,0xB5,0x6A,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x20,0x42,0x38,0x41,0x08,0x62,0x00,0x42,0x30,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x02,0xB8,0x23,0xB8,0x84,0xC8,0x05,0xC9,0x23,0xD0,0x01,0xC0,0x21,0x70,0x82,0x00,0x61,0x10,0x21,0x28,
-	0xE4,0x18,0xE8,0x41,0xAB,0x5A,0x00,0x00,0x51,0x94,0x8E,0x7B,0x00,0x08,0x25,0x29,0x00,0x08,0x0C,0x6B,0x96,0xBD,0xC7,0x41,0x00,0x00,0x00,0x00,0xA3,0x18,0x2D,0x6B,0x0C,0x6B,0xD7,0xC5,0xE8,0x41,0x00,0x00,0x41,0x08,0xA2,0x20,0xC4,0x70,0x23,0xB8,0x02,0xB8,0x02,0xA8,0x00,0xB8,0x02,0xD8,0x42,0x48,0x41,0x00,0x41,0x10,0x41,0x10,
-	0x41,0x00,0x62,0x08,0x02,0xB0,0x22,0xB8,0x62,0x18,0x61,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x00,0x21,0x08,0x00,0xA8,0x01,0x98,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x88,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0xA3,0x90,0xB7,0xAD,0x76,0xAD,0xD3,0xA4,0xB3,0x9C,0xF4,0xA4,0x76,0xB5,
-	0xE8,0x41,0x00,0x00,0xC3,0x20,0x62,0x10,0x25,0x29,0xEC,0x62,0x10,0x84,0xB3,0x9C,0x31,0x8C,0x10,0x8C,0x35,0xAD,0x8A,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x08,0x00,0x08,0x04,0x21,0xC7,0x39,0x25,0x21,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x42,0x10,0x62,0x10,0x42,0x10,0x00,0x00,0x04,0x29,0xD0,0x73,0xF4,0x94,0xE8,0x39,0x21,0x08,0xE4,0x20,0x00,0x00,0x00,0x08,0x41,0x10,
-	0x21,0x08,0x42,0x10,0x04,0x29,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x10,0x41,0x08,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0xE4,0x18,0xF0,0x7B,0x55,0xAD,
-	0x51,0x8C,0x4D,0x73,0xD3,0xA4,0x72,0x94,0x25,0x21,0x00,0x00,0x00,0x08,0x41,0x10,0xEC,0x62,0x08,0x42,0x00,0x00,0xE4,0x20,0x21,0x08,0x41,0x08,0x41,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0xC3,0x20,
-	0x45,0x29,0xE4,0x18,0xC3,0x20,0xB7,0xBD,0x8A,0x52,0x00,0x08,0x00,0x00,0x00,0x00,0x41,0x10,0x51,0x94,0x18,0xCE,0x92,0x94,0x41,0x08,0x00,0x00,0x00,0x00,0x21,0x08,0x86,0x31,0xB2,0xA4,0x35,0xAD,0x96,0xBD,0x49,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x82,0x38,0x42,0x60,0x41,0x08,
-	0x41,0x08,0x41,0x00,0x42,0x48,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x23,0xD0,0x84,0xC8,0xE6,0xE1,0xE6,0xE1,0x43,0xC0,0x23,0xD0,0x42,0x30,0x62,0x00,0x42,0x60,0x02,0xB8,0x04,0x29,0x65,0x21,0x45,0x31,0xC3,0x18,0x14,0xAD,0x6A,0x52,0x21,0x08,0x04,0x21,0x21,0x10,0x4D,0x73,0x34,0xB5,0xE8,0x41,0x41,0x08,0x62,0x10,0xA3,0x18,0x51,0x94,
-	0x14,0xAD,0xF4,0xA4,0x25,0x29,0x00,0x00,0xA2,0x20,0x85,0xC9,0x02,0xD8,0x23,0xC0,0x02,0xB8,0x02,0xB8,0x00,0xA8,0x01,0xC0,0x42,0x38,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x10,0x22,0xA8,0x02,0xB8,0x21,0x28,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x00,0x42,0x48,0x01,0xC8,0x21,0x88,0x41,0x00,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x61,0x00,0x41,0x08,0x01,0x98,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x21,0x70,0x66,0x21,0xB7,0xAD,0xD3,0xA4,0xD3,0x9C,0xF4,0xA4,0x35,0xAD,0xD3,0xA4,0xC3,0x20,0x41,0x10,0xE4,0x20,0xE4,0x18,0x21,0x10,0x00,0x00,0x82,0x08,0x2D,0x6B,0xB3,0x9C,0x72,0x94,0xD3,0xA4,0xA7,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x04,0x21,0xE8,0x39,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x08,0x4A,0xF0,0x83,0xE8,0x39,0x62,0x10,0x00,0x00,0xA3,0x18,0x04,0x21,0x21,0x08,0x41,0x10,0x00,0x08,0xA3,0x18,0x45,0x29,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0xAB,0x52,0x35,0xA5,0xB3,0x94,0x72,0x8C,0xC6,0x39,0x00,0x00,0x41,0x08,0x00,0x00,0x45,0x31,0x2D,0x6B,0x86,0x39,0xC3,0x20,0x25,0x29,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x08,
-	0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0x62,0x10,0xE8,0x41,0xCB,0x62,0x2D,0x6B,0x7A,0xD6,0xCB,0x5A,0xC3,0x10,0xC7,0x39,0x86,0x31,0x6A,0x52,0x55,0xB5,0x34,0xB5,0x35,0xAD,0x6E,0x73,0xCB,0x5A,0x2D,0x6B,0xAF,0x7B,
-	0x72,0x94,0x14,0xAD,0x15,0x9D,0x96,0xB5,0x49,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x61,0x00,0x42,0x28,0x21,0x28,0x41,0x08,0x41,0x10,0x41,0x00,0x42,0x28,0x42,0x38,0x42,0x30,0x42,0x60,0x21,0x70,0xC4,0x70,0xC4,0x70,0x24,0x51,0x42,0x38,0x23,0xC0,0x42,0x38,0x41,0x00,0x42,0x38,0x02,0xB8,
-	0x82,0x38,0xE7,0x31,0xE4,0x20,0x45,0x29,0x96,0xBD,0x08,0x42,0x41,0x10,0x82,0x10,0x20,0x00,0x6E,0x73,0x55,0xB5,0x86,0x39,0x00,0x08,0xA3,0x18,0x00,0x00,0x8E,0x7B,0x34,0xB5,0xB2,0xA4,0xE4,0x20,0x00,0x00,0x82,0x18,0x85,0xC9,0xA4,0xD8,0x01,0xC0,0x02,0xB8,0x21,0x88,0x21,0x88,0x01,0xC8,0x42,0x48,0x62,0x00,0x41,0x10,0x41,0x10,
-	0x41,0x00,0x41,0x20,0x00,0xA8,0x00,0xB8,0x42,0x38,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x00,0x21,0x88,0x01,0xC8,0x21,0x70,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x00,0x62,0x10,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x01,0xA0,0x41,0x00,0x83,0x50,0x46,0xB1,0x62,0x08,0xAB,0x52,0x96,0xBD,0xB7,0xBD,0x8E,0x7B,
-	0x00,0x00,0x00,0x08,0x20,0x00,0x62,0x10,0x82,0x10,0xC3,0x18,0x00,0x00,0xEC,0x5A,0xB3,0x9C,0xB3,0x9C,0x72,0x94,0x41,0x10,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x45,0x29,0xA7,0x31,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x00,0x00,0x49,0x52,0x51,0x94,0x0C,0x5B,0x21,0x08,0x21,0x08,0x2D,0x6B,0xA7,0x39,0x00,0x00,0x41,0x10,
-	0x82,0x18,0xE4,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x42,0x10,0x62,0x10,0x62,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x08,0x00,0x00,
-	0xA3,0x18,0x65,0x21,0xA3,0x10,0x00,0x00,0x21,0x08,0x42,0x10,0x00,0x08,0xC7,0x41,0x8E,0x7B,0x04,0x21,0x08,0x4A,0xAF,0x7B,0x62,0x10,0x21,0x08,0x42,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x45,0x29,0xE8,0x41,0x25,0x29,0x55,0xB5,0xF8,0xC5,0xB7,0xBD,0xF8,0xC5,0x59,0xD6,0xBB,0xDE,0xD7,0xC5,0x76,0xB5,0xB7,0xBD,0x39,0xC6,0x59,0xCE,0x18,0xCE,0xB7,0xBD,0x55,0xB5,0xF4,0xA4,0xF4,0xAC,0x96,0xB5,0x69,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x28,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x10,0x41,0x00,0x41,0x00,0x41,0x00,0x21,0x00,0x00,0x00,0xC3,0x20,0x83,0x50,0x02,0xA8,0x42,0x38,0x62,0x00,0x00,0x00,0xC4,0x70,0xE4,0x38,0xE8,0x39,0xC7,0x41,0x4D,0x73,0xB7,0xBD,0x66,0x31,0x21,0x08,0xA3,0x18,0xE4,0x20,0xEF,0x8B,0x34,0xB5,0x6A,0x52,0x82,0x10,0x66,0x31,0x04,0x21,0xAF,0x7B,
-	0xF4,0xAC,0x51,0x94,0xA3,0x18,0x00,0x00,0xA2,0x20,0x48,0xD2,0x85,0xC9,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x01,0xA0,0x42,0x98,0x42,0x38,0x21,0x00,0x41,0x08,0x41,0x08,0x41,0x00,0x42,0x28,0x00,0xA8,0x00,0xB8,0x42,0x60,0x62,0x00,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x00,0x42,0x38,0x00,0xB8,0x00,0xB8,0x42,0x60,0x41,0x00,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x30,0x21,0xA8,0x00,0xA8,0x00,0xB8,0x21,0x70,0x42,0x48,0x00,0xB8,0x00,0x28,0x00,0x00,0xEC,0x5A,0xD7,0xBD,0x96,0xB5,0xF4,0xA4,0x6E,0x73,0x2D,0x6B,0xA7,0x39,0xE4,0x20,0x21,0x08,0x00,0x00,0xC3,0x20,0x31,0x8C,0x72,0x94,0xD3,0xA4,0x6A,0x52,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x45,0x29,0x45,0x29,0x00,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x21,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x6A,0x52,0xB2,0xA4,0x66,0x29,0x00,0x00,0xA3,0x18,0x66,0x31,0x00,0x00,0x41,0x10,0x21,0x08,0xE4,0x18,0x45,0x31,0x21,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x08,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x86,0x39,0x6E,0x73,0xE4,0x20,0x25,0x29,0x6E,0x73,0x25,0x29,0x00,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x00,0x00,0x21,0x10,0x51,0x94,0xF4,0xAC,0x92,0x9C,0x51,0x94,0xF0,0x83,0xCB,0x5A,0x6A,0x52,0x2D,0x6B,0x10,0x8C,0x76,0xB5,0x96,0xBD,0x76,0xB5,0xF8,0xC5,
-	0x55,0xB5,0x35,0xAD,0x14,0xAD,0xD7,0xB5,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x60,0x42,0x28,0x41,0x00,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x62,0x08,0xC4,0xA8,0x02,0xD8,0x21,0x88,0x41,0x00,0x41,0x00,0x41,0x00,0x42,0x60,
-	0x21,0x28,0x29,0x42,0x0C,0x6B,0xCB,0x62,0x55,0xB5,0x31,0x8C,0x30,0x8C,0x51,0x94,0x51,0x94,0xD3,0xA4,0xB2,0xA4,0xB2,0xA4,0x51,0x94,0x51,0x94,0x92,0x9C,0x51,0x94,0xB2,0xA4,0xF0,0x83,0x62,0x10,0x00,0x00,0xE4,0x38,0x48,0xD2,0x85,0xC9,0x02,0xB8,0x02,0xB8,0x43,0xC0,0x02,0xB0,0x21,0x88,0x42,0x28,0x62,0x00,0x61,0x18,0x41,0x10,
-	0x62,0x08,0x42,0x38,0x01,0xA0,0x00,0xB8,0x21,0x88,0x41,0x00,0x62,0x08,0x41,0x00,0x62,0x08,0x61,0x00,0x42,0x60,0x00,0xB8,0x00,0xA8,0x42,0x38,0x62,0x10,0x41,0x20,0x42,0x30,0x41,0x20,0x41,0x00,0x42,0x30,0x00,0xB8,0x00,0xA8,0x02,0xA8,0x01,0xA0,0x01,0xC0,0x66,0x89,0xE7,0x31,0xE8,0x39,0x14,0xA5,0xD7,0xBD,0x55,0xB5,0xB7,0xB5,
-	0xD7,0xBD,0xD7,0xBD,0x96,0xB5,0x72,0x94,0xAB,0x5A,0x62,0x10,0x65,0x21,0x72,0x94,0x55,0xB5,0xB3,0x9C,0x42,0x10,0x00,0x08,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0xA3,0x18,0x45,0x31,0xE4,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0xE4,0x18,0xA3,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xCB,0x62,0x55,0xAD,0x86,0x31,0x45,0x31,0xE4,0x20,0x04,0x21,0x62,0x10,0x41,0x10,0x21,0x08,
-	0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA3,0x18,0x6E,0x73,0x25,0x29,0xA3,0x18,0x4D,0x73,0x25,0x29,0x00,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x00,0xA7,0x39,0x4D,0x63,0x62,0x10,0x04,0x21,0x04,0x21,0x66,0x31,0x08,0x4A,0xF0,0x83,0x14,0xA5,0x96,0xBD,0xF8,0xC5,0xF8,0xBD,0x35,0xAD,0x49,0x4A,0x04,0x21,0x10,0x8C,0x55,0xB5,0xB7,0xB5,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x30,0x42,0x48,
-	0x41,0x20,0x42,0x60,0x42,0x60,0x42,0x28,0x42,0x48,0x42,0x38,0x42,0x30,0x42,0x38,0x66,0x89,0x05,0xC9,0x02,0xD8,0x02,0xB8,0x42,0x38,0x42,0x28,0x42,0x60,0x21,0x88,0x00,0x08,0x62,0x08,0x00,0x00,0x45,0x31,0xF8,0xC5,0xD7,0xC5,0x96,0xBD,0x34,0xB5,0xB2,0xA4,0x8E,0x83,0x6E,0x73,0x92,0x9C,0xD3,0xA4,0xD3,0xA4,0xF4,0xAC,0x51,0x94,
-	0xB2,0xA4,0x8E,0x83,0x00,0x00,0x00,0x00,0x42,0x38,0x85,0xC9,0x85,0xC9,0x43,0xC0,0x00,0xB8,0x23,0xB8,0x23,0xC0,0x21,0xA8,0x21,0x08,0x62,0x00,0x41,0x08,0x42,0x60,0x42,0x60,0x42,0x30,0x01,0x98,0x00,0xB8,0x01,0x98,0x62,0x00,0x41,0x00,0x42,0x38,0x61,0x10,0x62,0x00,0x21,0x70,0x01,0xC8,0x00,0xA8,0x42,0x30,0x62,0x08,0x41,0x00,
-	0x42,0x10,0x42,0x10,0x41,0x08,0x42,0x60,0x23,0xC0,0x02,0xB8,0x02,0xB8,0x02,0xB8,0x22,0xA8,0x55,0xB5,0x59,0xC6,0x18,0xCE,0x76,0xB5,0xF4,0xAC,0x96,0xBD,0x76,0xB5,0x76,0xB5,0xD7,0xBD,0xF8,0xC5,0xD7,0xBD,0x35,0xAD,0xF0,0x83,0x10,0x84,0x10,0x8C,0x86,0x39,0x6A,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE4,0x18,0x04,0x21,0x41,0x08,0x41,0x10,0x00,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x66,0x31,0xE7,0x31,0x62,0x10,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xF0,0x83,0xD7,0xBD,0xE8,0x39,0xA3,0x18,0x82,0x18,0x21,0x08,0x41,0x08,0x61,0x10,0x21,0x08,0x66,0x31,0xA3,0x18,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x42,0x10,0x62,0x00,0x41,0x08,
-	0x83,0x50,0x83,0x50,0x83,0x50,0x62,0x08,0x62,0x00,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x86,0x39,0xAB,0x5A,0x29,0x4A,0x66,0x31,0x8E,0x7B,0xC7,0x39,0x00,0x00,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE4,0x20,0x14,0xAD,0x72,0x94,0xD3,0x9C,0x35,0xAD,0xB7,0xBD,0x5D,0xEF,0xBB,0xDE,0xAF,0x7B,0xEC,0x62,0xA7,0x39,0x08,0x4A,0x29,0x4A,0x00,0x00,
-	0x00,0x00,0xF0,0x83,0x96,0xB5,0xB7,0xBD,0x6A,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x28,0x42,0x30,0x62,0x10,0x41,0x20,0x41,0x20,0x41,0x20,0x42,0x30,0x42,0x30,0x82,0x38,0x42,0x48,0x21,0x88,0x21,0x70,0x21,0x70,0x21,0x88,0x42,0x38,
-	0x62,0x00,0x21,0x08,0x00,0x00,0x08,0x4A,0x8A,0x5A,0x62,0x18,0xE4,0x20,0x04,0x29,0x45,0x31,0x08,0x4A,0x0C,0x6B,0x92,0x9C,0xF4,0xAC,0xF4,0xAC,0x8E,0x83,0xEF,0x8B,0xB2,0xA4,0x6E,0x73,0x00,0x00,0x00,0x00,0x24,0x51,0xE6,0xE1,0x05,0xC9,0x05,0xC9,0x83,0xA8,0x22,0xA8,0x02,0xB0,0x21,0x88,0x42,0x60,0x42,0x60,0x42,0x60,0x21,0x70,
-	0x21,0x88,0x01,0x98,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x42,0x48,0x21,0x28,0x42,0x60,0x42,0x38,0x42,0x30,0x01,0x98,0x00,0xB8,0x00,0xB8,0x21,0x88,0x42,0x60,0x21,0x70,0x21,0x70,0x21,0x88,0x42,0x98,0xA4,0xB8,0x43,0xC0,0x23,0xB8,0x23,0xB8,0x02,0xB8,0x02,0xA8,0x8E,0xB3,0x76,0xA5,0xB7,0xBD,0x8A,0x5A,0x82,0x10,0x86,0x39,0x45,0x29,
-	0x45,0x29,0xE8,0x41,0x28,0x52,0xAB,0x5A,0x10,0x8C,0x55,0xAD,0x76,0xAD,0xF0,0x83,0x82,0x18,0x8A,0x52,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0xE4,0x20,0xE4,0x18,0x21,0x08,0xC7,0x39,0xA7,0x39,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x00,0x00,0x62,0x10,0x72,0x94,0x4D,0x63,0x08,0x42,0x21,0x08,0xE4,0x18,0x66,0x31,0x21,0x08,0x42,0x10,0x41,0x10,
-	0x25,0x29,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0xC4,0x70,0x43,0xC0,0x23,0xD0,0x84,0xC8,0x42,0x98,0x21,0x08,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x21,0x08,0x62,0x08,0xAB,0x5A,0x0C,0x6B,0xEC,0x62,0x08,0x4A,0xCB,0x5A,0x86,0x39,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x00,0x00,0x82,0x18,0x55,0xB5,0x59,0xD6,0x39,0xC6,0xD7,0xC5,0x55,0xAD,0x8E,0x7B,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x04,0x29,0x00,0x08,0x00,0x00,0xF0,0x83,0x96,0xBD,0x96,0xB5,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x62,0x00,0x62,0x08,0x61,0x00,0x61,0x00,0x41,0x00,0x61,0x00,0x41,0x10,0x62,0x10,0x00,0x00,0x49,0x52,0x4D,0x73,0xE8,0x41,0xCB,0x5A,0x2D,0x6B,0x92,0x9C,0x55,0xB5,0x92,0x9C,0x8E,0x83,0xF0,0x83,0xE8,0x41,0x00,0x00,0xCB,0x62,
-	0x55,0xB5,0x0C,0x6B,0x00,0x00,0x20,0x00,0x61,0x10,0xE7,0xA9,0xE6,0xE1,0x85,0xC9,0x05,0xC9,0xA4,0xB8,0x02,0xB8,0x00,0xA8,0x00,0xB8,0x01,0xC8,0x01,0xC8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x22,0xB8,0x00,0xB8,0x21,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xA8,0x01,0xC8,0x01,0xC0,0x02,0xB8,0x02,0xB0,0x02,0xB8,0x02,0xB8,0x02,0xB8,0x00,0xB8,0x71,0xBC,0xBA,0xCE,0x76,0xB5,0x82,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x08,0x4A,0x51,0x8C,0x49,0x52,0xE4,0x20,0xB3,0x94,0xF0,0x83,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x08,0x62,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x86,0x31,0xE8,0x39,0x82,0x10,0xE4,0x20,0xE8,0x39,0x62,0x10,0x01,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x2D,0x6B,0xF4,0xA4,0x08,0x42,0x6E,0x73,0x45,0x29,0x21,0x10,0xC3,0x18,0x21,0x08,0x41,0x08,0x21,0x08,0x04,0x29,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x21,0x70,0x05,0xC9,
-	0xC4,0xA8,0x46,0xB1,0x83,0xA8,0xA4,0xD8,0xC4,0x70,0x62,0x00,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC7,0x39,0x8E,0x7B,0x8E,0x7B,0x4D,0x73,0x49,0x52,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x41,0x10,0x00,0x00,0xD3,0xA4,0x96,0xBD,0xC7,0x39,0x66,0x29,0x42,0x10,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0xE4,0x20,0x21,0x08,
-	0x00,0x08,0x72,0x94,0x59,0xD6,0xF8,0xBD,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x00,0x00,0x49,0x52,0x39,0xCE,0xF8,0xC5,0x18,0xCE,0x18,0xC6,0xD3,0xA4,0x86,0x39,0x21,0x08,0x00,0x00,0x25,0x29,0x41,0x10,0x00,0x00,0x4D,0x73,0xD7,0xC5,0xEC,0x62,0x00,0x00,0x20,0x00,0xE4,0x38,0x46,0xB1,0xE6,0xE1,0x48,0xD2,0x85,0xC9,0x85,0xC9,0x23,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x01,0xC8,0x01,0xC8,0x00,0xB8,0x01,0xC8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xB8,0x02,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x21,0xA8,0x00,0xA8,0x02,0xA8,0x02,0xB8,0x02,0xA8,0x02,0xA8,0x02,0xB8,0xEB,0x72,0xD0,0x73,0x8A,0x5A,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x10,0x42,0x10,0x00,0x00,0x00,0x00,0xA3,0x18,0x00,0x08,0x00,0x00,0x04,0x21,0x8E,0x7B,0x8E,0x7B,0xAB,0x5A,0x66,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0x29,0x4A,0x00,0x00,0x25,0x29,0xE8,0x41,0xA7,0x39,0x82,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x42,0x10,0x00,0x00,0x04,0x29,0xEF,0x8B,0x10,0x84,0x8E,0x7B,0x4D,0x63,0x62,0x10,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,
-	0xE8,0x41,0xE4,0x20,0x00,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x08,0xA3,0x90,0x85,0xC9,0xC4,0xA8,0xA4,0xB8,0x83,0xA8,0x43,0xC0,0xC4,0xA8,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x29,0x4A,0x0C,0x6B,0x8E,0x83,0x30,0x8C,0x6E,0x73,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x00,0x00,0x49,0x52,0x08,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x0C,0x6B,0x8E,0x83,0x92,0x94,0xC7,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x18,0x00,0x00,0x08,0x42,0x18,0xCE,0x92,0x9C,0x8E,0x83,0x6A,0x52,0x62,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0x62,0x10,0x00,0x00,0xF0,0x83,
-	0xD7,0xC5,0x6A,0x52,0x00,0x00,0x21,0x00,0x45,0x71,0xE6,0xE1,0x48,0xD2,0x85,0xC9,0x05,0xC9,0x85,0xC9,0x43,0xC0,0x01,0xC8,0x01,0x98,0x42,0x28,0x42,0x30,0x42,0x48,0x42,0x48,0x21,0x70,0x21,0x88,0x21,0x88,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x01,0xC8,0x00,0xB8,0x00,0xB8,0x01,0xC8,0x01,0xC8,0x00,0xB8,0x01,0xC8,
-	0x00,0xB8,0x00,0xB8,0x01,0xC8,0x01,0xC0,0x23,0xD0,0x23,0xC0,0x23,0xC0,0x23,0xD0,0x02,0xD8,0x21,0x70,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x21,0x08,0x42,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x8C,0x18,0xCE,0x10,0x8C,0x8A,0x52,
-	0x45,0x31,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE4,0x20,0xC7,0x39,0x00,0x00,0xA2,0x20,0x29,0x4A,0x6A,0x4A,0xC3,0x10,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x10,0x00,0x00,0xCB,0x62,0x6E,0x73,0x92,0x9C,0x4D,0x73,0x8A,0x5A,0x04,0x21,0x00,0x00,0x82,0x18,0x42,0x10,0x41,0x10,0x00,0x08,0x25,0x29,0xE4,0x20,0x21,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x18,0x83,0xA8,0xC4,0xA8,
-	0xA4,0xB8,0x83,0xA8,0x83,0xA8,0xA4,0xB8,0xC4,0xA8,0x42,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x86,0x39,0x2D,0x6B,0x92,0x94,0xB2,0xA4,0xEC,0x62,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,0x00,0x00,0x00,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0xA3,0x18,0x00,0x00,0x04,0x29,0x30,0x8C,0x04,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x10,0x62,0x10,0x21,0x08,0x82,0x10,0x21,0x08,0x41,0x10,0x51,0x94,0x59,0xD6,0x6A,0x52,0x00,0x00,0x20,0x00,0x42,0x28,0xE7,0xA9,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0x42,0x98,0x42,0x48,0x41,0x10,0x41,0x00,0x41,0x00,0x41,0x00,
-	0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0xA2,0x20,0x21,0x28,0x42,0x60,0x21,0x70,0x21,0x70,0x21,0x70,0x01,0x98,0x21,0x88,0x42,0x60,0x21,0x70,0x21,0x70,0x21,0x70,0x21,0x70,0x21,0x70,0x42,0x60,0x21,0x70,0x21,0x88,0x42,0x98,0x42,0x98,0x22,0xA8,0xA4,0xB8,0x83,0x50,0x61,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x25,0x21,0xF8,0xBD,0xD7,0xC5,0x18,0xC6,0x18,0xCE,0x39,0xCE,0x8E,0x83,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xC7,0x41,0x62,0x18,0x00,0x08,0xA7,0x31,0x08,0x42,0x66,0x29,0x01,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x04,0x29,0x31,0x8C,0x31,0x84,0x76,0xAD,0x55,0xAD,0x8A,0x52,0xA3,0x10,0x41,0x10,0x45,0x31,0xA3,0x18,0x41,0x08,0x21,0x08,
-	0x82,0x10,0xC7,0x39,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x08,0x42,0x98,0x22,0xA8,0x42,0x98,0x22,0xA8,0x42,0x98,0x23,0xC0,0x21,0x88,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x18,0x62,0x10,0x00,0x08,0x00,0x00,0xCB,0x62,0x35,0xAD,0x76,0xAD,0x18,0xBE,0x6A,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0xC3,0x18,0x21,0x08,0x62,0x10,0x25,0x29,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xC7,0x41,
-	0xCB,0x62,0x66,0x31,0x00,0x00,0x41,0x08,0x82,0x10,0xC4,0x70,0xA3,0x90,0xC4,0xA8,0x66,0x89,0x45,0x71,0x61,0x18,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x42,0x28,0x41,0x10,0x62,0x00,0x41,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x41,0x00,0x41,0x08,0x62,0x18,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x42,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0xB3,0x94,0xD3,0x9C,0x55,0xB5,0xD7,0xC5,
-	0x5D,0xEF,0xAF,0x7B,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x86,0x39,0x86,0x31,0x00,0x00,0xE4,0x20,0x86,0x31,0x66,0x31,0x45,0x31,0x82,0x18,0x41,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xCB,0x62,0x10,0x84,0x4D,0x63,0xF4,0xA4,0xBB,0xDE,0x6E,0x63,0x00,0x00,0xCB,0x5A,0x45,0x29,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0xE4,0x18,0xC3,0x20,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x42,0x48,0x83,0xA8,
-	0x02,0xB8,0x23,0xB8,0x23,0xC0,0x23,0xB8,0x42,0x28,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xC3,0x20,0xA3,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x62,0x10,0x62,0x08,0x00,0x00,0x28,0x52,0xB7,0xBD,0x14,0xA5,0x51,0x8C,0x14,0xAD,0x35,0xAD,0xA3,0x18,0x00,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x62,0x10,0x82,0x10,0x41,0x08,0x62,0x10,0x62,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0x62,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x61,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x28,0x42,0x48,0x21,0x70,0x21,0x70,0x21,0x70,0x21,0x88,0x21,0x88,0x22,0xB8,0xA3,0x90,0x82,0x00,0x62,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x41,0x10,0x04,0x29,0x45,0x31,0x69,0x42,0x25,0x21,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x00,0x08,0x62,0x10,0x6A,0x4A,0x82,0x10,0x00,0x08,0xC3,0x18,0xE4,0x20,0x86,0x39,0xA3,0x18,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC3,0x20,0x6E,0x73,0x31,0x8C,0x31,0x8C,0x55,0xAD,0x55,0xA5,0xD7,0xBD,0x4D,0x63,0x4D,0x73,0x2D,0x6B,0x00,0x00,0x62,0x08,0x82,0x10,
-	0x21,0x08,0x00,0x08,0x04,0x21,0x04,0x29,0x01,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x00,0x42,0x38,0x01,0x98,0x01,0x98,0x21,0x88,0x42,0x30,0x62,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x10,0xA3,0x10,0xC3,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x82,0x18,0x41,0x08,0x41,0x08,0x00,0x08,0x62,0x10,0xEF,0x8B,0x14,0xA5,0xF4,0xAC,0xD3,0xA4,0x72,0x94,0xF4,0xA4,0xC7,0x39,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x62,0x08,0x62,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x20,0x41,0x20,0x42,0x30,0x42,0x38,0x42,0x38,0x42,0x38,
-	0x42,0x38,0x42,0x48,0x42,0x60,0x42,0x38,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x45,0x31,0x66,0x31,0x00,0x00,0x41,0x10,0x21,0x08,0xA2,0x20,0xCB,0x62,0xA3,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x00,0x00,0xE8,0x41,0x4D,0x73,0x0C,0x6B,0x8E,0x7B,0x2D,0x6B,0x8A,0x4A,0x72,0x94,0x6E,0x63,0x6E,0x73,0xD0,0x73,0x62,0x10,0x04,0x21,0xA3,0x18,0x21,0x08,0x41,0x10,0x62,0x10,0xC3,0x18,0xE4,0x20,0x82,0x18,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x00,
-	0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x00,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xA3,0x18,0x82,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x45,0x29,0xA3,0x18,0x21,0x08,0x00,0x00,0xA7,0x31,0x92,0x94,0x14,0xAD,0xD3,0x9C,0xF4,0x9C,0x35,0xAD,0xB2,0xA4,0xA7,0x39,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x20,0x42,0x60,
-	0x42,0x60,0x42,0x60,0x42,0x48,0x42,0x30,0x21,0x28,0x41,0x20,0x41,0x20,0x61,0x18,0x61,0x00,0x21,0x10,0x42,0x30,0x61,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x41,0x10,0xC7,0x41,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x66,0x29,0xA3,0x18,0x00,0x00,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x0C,0x6B,0x4D,0x73,0xAF,0x7B,0x6E,0x73,0x2D,0x6B,0x4D,0x73,0x8E,0x7B,0x66,0x29,0x45,0x31,0x2D,0x6B,0x29,0x4A,0xC3,0x18,0x82,0x10,
-	0x00,0x08,0x41,0x08,0x21,0x08,0x62,0x10,0xA3,0x18,0xA3,0x18,0x25,0x29,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x04,0x29,0xC3,0x18,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x21,0x08,0xE4,0x20,0x08,0x4A,0x04,0x21,0xA3,0x18,0x86,0x39,0x51,0x94,0xF4,0xA4,0xD3,0x9C,0xB3,0x9C,0xF4,0x9C,0xF4,0xA4,0x08,0x42,0x00,0x00,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x42,0x30,0x21,0x70,0x21,0x70,0x21,0x70,0x21,0x88,0x21,0x88,0x21,0x88,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0xA0,0x01,0xA0,0x02,0xB0,0x42,0x98,0x82,0x38,0x21,0x00,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0xE4,0x18,0xC7,0x39,0x00,0x08,0xA3,0x18,0x41,0x10,0x21,0x08,0x41,0x10,0x45,0x31,0x82,0x10,0xC3,0x18,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x00,0x28,0x52,0x15,0x9D,0x31,0x8C,0x55,0xB5,0xB2,0xA4,0x72,0x94,0x96,0xB5,0xD7,0xB5,0x14,0xA5,0x45,0x29,0xC3,0x18,0x6A,0x52,0x45,0x29,0x41,0x10,0x04,0x29,0x42,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x04,0x21,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE4,0x18,0x62,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0xC3,0x18,0xA3,0x18,0x45,0x29,0xE8,0x41,0x92,0x94,0xF4,0x9C,0xB3,0x9C,0xB3,0x9C,0xB3,0x9C,0x14,0xA5,0xE8,0x41,0x00,0x00,0x62,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x00,
-	0x61,0x00,0x41,0x00,0x41,0x00,0x61,0x10,0x62,0x18,0x42,0x28,0x41,0x20,0x42,0x30,0x42,0x48,0x82,0x38,0x42,0x48,0x42,0x60,0x42,0x30,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x08,0x04,0x29,0x45,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x20,0x25,0x29,0x00,0x08,0xE8,0x39,0xC3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x62,0x18,0x14,0xAD,0xF8,0xC5,0xF8,0xBD,0xD7,0xB5,0xF8,0xBD,0x92,0x94,0xF0,0x83,0xB7,0xBD,0xF4,0xA4,0xF0,0x83,0xAB,0x52,0xAB,0x5A,0xA7,0x39,0x04,0x21,
-	0x45,0x29,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x00,0x00,0x04,0x29,0x04,0x29,0xC7,0x39,0xD3,0xA4,0xF4,0xA4,0xF4,0xA4,0xF4,0xA4,0xD3,0x9C,0xB3,0x9C,0xE8,0x41,0x00,0x00,0x21,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x00,0x41,0x08,0x41,0x00,0x41,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0x04,0x29,0x00,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0xA3,0x10,0x21,0x08,0x62,0x10,0xC3,0x20,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x00,0x29,0x42,0x35,0xAD,0x35,0xA5,0x10,0x8C,0xF4,0x94,0xF4,0x9C,0xD3,0x9C,0x72,0x8C,0xB3,0x94,0x15,0x9D,0xD3,0xA4,0xAF,0x7B,0x86,0x31,0xAF,0x7B,0xF0,0x83,0xEC,0x5A,0x21,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0xC3,0x20,0x62,0x10,0xE8,0x41,0xB3,0x9C,0x92,0x9C,0x72,0x94,0xD3,0xA4,0x14,0xA5,0xB3,0x94,0x8A,0x52,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x08,0xC7,0x39,0xA3,0x18,0x00,0x08,0xA3,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x49,0x4A,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x10,0xAF,0x6B,0x6E,0x63,0x08,0x42,0xA7,0x39,0xC7,0x39,0xA7,0x39,0xE8,0x41,0x28,0x3A,0x08,0x4A,0xCB,0x62,0x11,0x7C,0x51,0x84,0x08,0x4A,0x29,0x4A,0xD3,0xA4,
-	0xCB,0x62,0x8A,0x52,0x25,0x29,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0xE4,0x20,0xC3,0x20,0xE4,0x20,0x82,0x18,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x39,0xA7,0x39,0x49,0x4A,0x55,0xB5,0xD3,0x9C,0x51,0x94,0x51,0x94,0x92,0x9C,0xD3,0x9C,0xCB,0x5A,0x00,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xC7,0x39,0x41,0x08,0xC3,0x20,0x66,0x31,0x21,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x2D,0x6B,0xA7,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0xC3,0x20,0x6E,0x63,0xAB,0x52,0x08,0x42,0xE8,0x41,0x86,0x39,0xC7,0x41,0xE8,0x39,0x86,0x39,0x86,0x39,0x65,0x21,0x65,0x21,0x08,0x4A,0xAB,0x5A,0x08,0x42,0xE4,0x18,0x6A,0x52,0x6E,0x73,0x51,0x94,0x08,0x42,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xA3,0x18,0xC3,0x20,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x82,0x10,0x10,0x84,0xE4,0x20,0x29,0x42,0xD3,0xA4,0x72,0x94,0x92,0x94,0x72,0x94,0xB3,0x94,0xB7,0xBD,0x0C,0x6B,0x00,0x00,0x21,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,
-	0xA3,0x18,0x45,0x29,0x00,0x08,0xC7,0x39,0xE4,0x20,0x00,0x08,0x41,0x08,0x00,0x00,0xC3,0x20,0x2D,0x6B,0x62,0x10,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x86,0x31,0x29,0x42,0x45,0x31,0xE8,0x41,0x08,0x42,0x29,0x4A,0x49,0x4A,0xC7,0x41,0xE8,0x41,0xE8,0x41,0xE8,0x41,0x86,0x31,0xA7,0x39,0xC7,0x41,0x86,0x31,0x00,0x00,
-	0x62,0x10,0xCB,0x62,0x10,0x84,0x31,0x8C,0x29,0x4A,0x00,0x00,0x00,0x00,0x00,0x08,0x62,0x10,0x21,0x08,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x00,0x66,0x31,0xAF,0x7B,0xA3,0x18,0xCB,0x62,0x55,0xAD,0xF4,0x9C,0x14,0xA5,0x35,0xA5,0x96,0xB5,0xB7,0xB5,0x8A,0x5A,0x00,0x00,0x62,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x25,0x29,0x04,0x29,0xA3,0x18,0xC7,0x41,0x00,0x08,0x01,0x08,0x41,0x10,0x00,0x00,0xC3,0x20,0xCB,0x5A,0x62,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0xC3,0x20,0x04,0x21,0x66,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x28,0x3A,0x08,0x42,0xE8,0x39,0x86,0x39,0xAB,0x5A,0xF0,0x7B,0xE8,0x39,0xC7,0x39,0x29,0x42,0x86,0x31,0xC3,0x18,0xE8,0x41,0xAB,0x5A,0x6A,0x52,0x14,0xAD,0x6A,0x52,0x66,0x31,0x00,0x08,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0xEC,0x62,0x82,0x10,0x8E,0x7B,0x55,0xB5,0x14,0xA5,0x35,0xA5,0x14,0xAD,0x96,0xB5,0x51,0x84,0x04,0x29,0x00,0x08,0x21,0x08,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x25,0x29,0xE4,0x20,0x45,0x29,0x86,0x31,0x00,0x00,0x04,0x29,0x86,0x39,0x00,0x00,0x04,0x29,0xAB,0x52,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x25,0x21,0xC7,0x39,0x08,0x4A,0x29,0x4A,0x29,0x42,0x25,0x29,0x65,0x21,0x66,0x29,0x08,0x42,0xC7,0x41,0x28,0x52,0x0C,0x6B,0x08,0x4A,0x86,0x39,0x25,0x29,0x86,0x31,
-	0x08,0x42,0x82,0x18,0x62,0x10,0x45,0x31,0xAF,0x7B,0x55,0xAD,0x10,0x8C,0x6E,0x73,0xA3,0x18,0x66,0x31,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xA3,0x18,0x66,0x31,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x82,0x10,0x41,0x08,0x21,0x08,0x41,0x08,
-	0x41,0x10,0x21,0x08,0xCB,0x5A,0x45,0x31,0xC3,0x20,0x92,0x94,0x14,0xA5,0x92,0x94,0x14,0xA5,0x14,0xA5,0xD7,0xBD,0x10,0x84,0x21,0x08,0x62,0x08,0x62,0x10,0xC3,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x21,0x04,0x21,0x66,0x31,0xA3,0x18,0x00,0x00,0x8A,0x5A,0x45,0x29,0x00,0x00,0x45,0x29,0xA7,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,
-	0x86,0x31,0xCB,0x5A,0x49,0x4A,0x25,0x29,0x04,0x29,0x29,0x4A,0xE8,0x39,0x45,0x29,0x25,0x21,0x08,0x42,0xA7,0x39,0x45,0x29,0x66,0x31,0xC7,0x39,0xC7,0x39,0x82,0x18,0xC7,0x39,0x86,0x39,0x62,0x10,0x82,0x18,0x00,0x00,0x6A,0x52,0x31,0x84,0x8E,0x7B,0x10,0x84,0x6E,0x73,0x51,0x8C,0x6E,0x73,0xA7,0x39,0xE8,0x41,0x6A,0x52,0x49,0x52,
-	0xE8,0x41,0x82,0x10,0x00,0x00,0x00,0x00,0x08,0x42,0x8A,0x52,0xA3,0x18,0x21,0x08,0x62,0x10,0x00,0x00,0x00,0x00,0xA7,0x39,0xE4,0x20,0x00,0x00,0x04,0x21,0xA3,0x18,0x00,0x08,0x41,0x08,0xC7,0x41,0xAB,0x5A,0x29,0x4A,0xB3,0x9C,0xD3,0x9C,0xF4,0xA4,0xB3,0x9C,0xB3,0x9C,0x96,0xB5,0x8E,0x7B,0x00,0x00,0xE4,0x20,0x25,0x29,0xC7,0x39,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,
-	0xE4,0x20,0x25,0x21,0xA7,0x39,0x00,0x08,0xC3,0x18,0x6A,0x4A,0x00,0x08,0x00,0x08,0xC7,0x39,0x25,0x21,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x08,0x45,0x29,0x8A,0x52,0x49,0x4A,0x08,0x4A,0xA7,0x31,0x08,0x52,0x08,0x42,0x08,0x42,0x45,0x31,0x25,0x29,0xA7,0x31,0xE8,0x39,0x45,0x29,0x86,0x39,0x29,0x4A,0x25,0x29,
-	0xA2,0x20,0x86,0x39,0x25,0x21,0x86,0x39,0xA3,0x18,0x82,0x18,0xE4,0x20,0x00,0x00,0x66,0x31,0x45,0x31,0x86,0x39,0x2D,0x6B,0x6A,0x52,0x45,0x31,0xE8,0x39,0x25,0x29,0x21,0x08,0x00,0x00,0x66,0x31,0x2D,0x6B,0x8A,0x52,0x82,0x18,0x00,0x00,0x62,0x10,0x00,0x00,0x00,0x00,0xAF,0x7B,0xAF,0x7B,0x00,0x00,0x62,0x10,0x8A,0x5A,0x82,0x18,
-	0x00,0x00,0x41,0x10,0x2D,0x6B,0x6E,0x73,0x08,0x4A,0x14,0xAD,0xD3,0x9C,0xB3,0x9C,0xB3,0x9C,0xF4,0xA4,0xD7,0xBD,0x0C,0x6B,0x00,0x00,0xE4,0x20,0x25,0x29,0x04,0x21,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x18,0x86,0x31,0x86,0x39,0x00,0x00,0xE8,0x41,0x45,0x29,0x00,0x00,0x41,0x10,0xA3,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,
-	0xA7,0x39,0x08,0x4A,0x8A,0x52,0xEC,0x5A,0xE8,0x41,0xE8,0x41,0xE8,0x41,0xC7,0x41,0x49,0x4A,0x66,0x29,0x82,0x10,0xC7,0x41,0x28,0x52,0x86,0x39,0x86,0x31,0xC7,0x39,0xA7,0x39,0x86,0x39,0x45,0x31,0x86,0x39,0xEF,0x8B,0x66,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0xC3,0x20,0xC3,0x18,0xC3,0x20,0x66,0x31,
-	0x49,0x4A,0x4D,0x73,0x2D,0x6B,0x86,0x39,0x00,0x00,0x21,0x08,0x21,0x00,0x00,0x00,0xC3,0x20,0x14,0xA5,0xB7,0xB5,0xA3,0x10,0x00,0x00,0xE8,0x41,0xAB,0x5A,0x00,0x00,0x00,0x00,0x66,0x31,0xF4,0xAC,0x08,0x4A,0xA7,0x39,0xD3,0xA4,0x55,0xAD,0x14,0xA5,0xB3,0x9C,0x14,0xA5,0xD7,0xBD,0x8A,0x52,0x00,0x00,0x49,0x4A,0xE8,0x41,0x86,0x31,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,
-	0xC3,0x20,0x86,0x39,0xA7,0x39,0x00,0x00,0x08,0x42,0xA3,0x10,0x00,0x08,0x41,0x10,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x20,0xC7,0x39,0x29,0x42,0x08,0x4A,0xC7,0x41,0xC7,0x39,0x6A,0x4A,0x08,0x4A,0xE8,0x39,0xC7,0x39,0xE8,0x41,0xE7,0x31,0xC3,0x10,0x86,0x31,0x08,0x4A,0x66,0x31,0x86,0x31,
-	0xEC,0x62,0xE8,0x41,0x86,0x39,0x04,0x29,0x10,0x8C,0x35,0xAD,0x6E,0x73,0xE8,0x41,0x41,0x10,0x00,0x00,0x21,0x08,0xC3,0x20,0xE8,0x41,0x8A,0x4A,0x8A,0x5A,0x6A,0x52,0xC7,0x41,0x25,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x4A,0xF8,0xC5,0x35,0xAD,0x21,0x00,0x21,0x08,0xC3,0x20,0x08,0x4A,0xEC,0x62,0x00,0x00,
-	0xE4,0x20,0x08,0x4A,0xB3,0x9C,0x6A,0x52,0x49,0x4A,0x92,0x9C,0x14,0xAD,0x35,0xA5,0x14,0xAD,0xD3,0xA4,0x14,0xA5,0xE8,0x41,0x00,0x00,0xA7,0x39,0x29,0x4A,0xA3,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0xA2,0x20,0x45,0x31,0x66,0x29,0x21,0x08,0xC7,0x41,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x21,
-	0x49,0x52,0x29,0x4A,0xC7,0x39,0xE8,0x39,0xA7,0x31,0xE8,0x41,0xC7,0x41,0xE8,0x41,0xC7,0x39,0xC7,0x39,0x28,0x52,0x66,0x31,0x41,0x08,0xC7,0x41,0x29,0x42,0x45,0x29,0x66,0x31,0x49,0x52,0xE8,0x39,0xC3,0x20,0xEC,0x62,0x55,0xAD,0x14,0xAD,0x76,0xAD,0x72,0x94,0x04,0x29,0x08,0x42,0x66,0x31,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x66,0x31,0xAB,0x5A,0x45,0x29,0x66,0x31,0xEF,0x8B,0xF4,0xA4,0xEC,0x5A,0x21,0x08,0xA3,0x18,0x30,0x8C,0x8A,0x5A,0xC7,0x39,0xE8,0x41,0xE4,0x20,0xAB,0x5A,0xAB,0x5A,0x35,0xAD,0x49,0x52,0x0C,0x6B,0x14,0xAD,0xD3,0xA4,0xF4,0xA4,0xD3,0x9C,0x35,0xAD,0x14,0xAD,0xA7,0x39,0xE4,0x20,0x6A,0x52,0xCB,0x62,0x66,0x31,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0xA3,0x18,0x25,0x21,0x62,0x10,0xC3,0x20,0x08,0x42,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x45,0x29,0x28,0x52,0xA7,0x39,0xA7,0x31,0xA7,0x39,0xC7,0x39,0x08,0x42,0xE8,0x41,0xE8,0x39,0x08,0x4A,0xC7,0x41,0x25,0x29,0x8E,0x83,0x28,0x52,0x08,0x42,0x8A,0x4A,0xE4,0x18,
-	0x41,0x20,0x49,0x52,0x6A,0x52,0x45,0x31,0x49,0x52,0xD3,0xA4,0x72,0x94,0x92,0x94,0x35,0xAD,0x6E,0x73,0xCB,0x62,0x51,0x8C,0x8A,0x52,0x6A,0x52,0x08,0x42,0xAB,0x5A,0x0C,0x6B,0xF0,0x83,0x72,0x94,0x51,0x94,0xB2,0xA4,0x55,0xB5,0xF0,0x7B,0x29,0x4A,0xA7,0x39,0xEF,0x8B,0x51,0x94,0x51,0x8C,0xE8,0x41,0xF0,0x83,0x45,0x29,0xE8,0x41,
-	0x6A,0x52,0xCB,0x62,0xF4,0xA4,0xC7,0x39,0xEC,0x62,0xF4,0xAC,0x14,0xA5,0x14,0xAD,0xD3,0x9C,0x35,0xAD,0xB3,0x9C,0xAB,0x52,0xC7,0x39,0x2D,0x6B,0x2D,0x6B,0xA7,0x39,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x10,0xA3,0x10,0x82,0x10,0x00,0x00,0x86,0x31,0x86,0x31,0xC3,0x20,0x45,0x31,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0x25,0x29,
-	0xE8,0x41,0xC7,0x41,0xE8,0x39,0xA7,0x31,0x08,0x42,0x86,0x39,0xA7,0x31,0xC7,0x39,0xC7,0x41,0xC7,0x41,0x45,0x29,0xCB,0x5A,0xAB,0x5A,0x66,0x31,0xA7,0x39,0xA7,0x39,0xE4,0x20,0x45,0x29,0xCB,0x5A,0x29,0x42,0xE8,0x41,0x51,0x94,0xB3,0x9C,0x92,0x94,0xB3,0x9C,0xB3,0x9C,0x29,0x4A,0x92,0x94,0x92,0x9C,0x76,0xB5,0x72,0x94,0xF4,0xAC,
-	0x55,0xB5,0x35,0xAD,0xD3,0xA4,0xB3,0x9C,0xD3,0xA4,0xF4,0xA4,0xEF,0x8B,0x92,0x94,0x14,0xAD,0xB3,0x94,0x92,0x94,0x8E,0x7B,0x08,0x4A,0xF0,0x83,0x61,0x10,0x6E,0x73,0x0C,0x6B,0x6E,0x73,0x31,0x8C,0x08,0x42,0x6E,0x73,0xD3,0xA4,0xB3,0x9C,0xF4,0xA4,0x14,0xA5,0x55,0xAD,0x72,0x8C,0x0C,0x6B,0x25,0x29,0x04,0x21,0xB3,0x9C,0x6A,0x52,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x82,0x18,0x62,0x10,0x00,0x00,0x49,0x52,0x66,0x29,0xC7,0x39,0xA7,0x39,0x00,0x00,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x25,0x21,0x29,0x42,0xE8,0x41,0xC7,0x41,0xE8,0x41,0x08,0x42,0x66,0x29,0xA7,0x39,0x08,0x4A,0x86,0x39,0x86,0x31,0xE8,0x41,0x45,0x29,0x49,0x4A,0x45,0x31,0x04,0x29,0x08,0x42,
-	0x08,0x42,0xA3,0x18,0x0C,0x5B,0x31,0x8C,0xA7,0x31,0x8E,0x83,0xD3,0xA4,0x92,0x94,0x92,0x94,0x55,0xAD,0xCB,0x5A,0xEC,0x62,0x6E,0x73,0xAF,0x7B,0x51,0x8C,0xF0,0x83,0xD3,0x9C,0x10,0x8C,0x72,0x94,0xB3,0x9C,0x72,0x94,0x72,0x94,0x92,0x94,0xD3,0x9C,0x92,0x9C,0x10,0x84,0x14,0xAD,0xEC,0x62,0x30,0x8C,0x8A,0x52,0x86,0x31,0x35,0xAD,
-	0x0C,0x6B,0x4D,0x73,0xF0,0x7B,0x8A,0x52,0x51,0x94,0x35,0xAD,0xB3,0x94,0x72,0x94,0xB3,0x9C,0xD3,0x9C,0x8E,0x7B,0x0C,0x6B,0x08,0x42,0x00,0x00,0x2D,0x6B,0x08,0x42,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x08,0x00,0x00,0x6A,0x62,0x45,0x29,0x6A,0x4A,0x45,0x29,0x41,0x10,0x62,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x42,0x10,
-	0xA7,0x31,0xC7,0x41,0x45,0x29,0x08,0x42,0xA7,0x39,0x86,0x31,0xE8,0x41,0x08,0x4A,0xE8,0x39,0xA7,0x39,0x45,0x29,0xC3,0x20,0x08,0x42,0xC7,0x39,0x04,0x29,0xE7,0x31,0xC7,0x39,0xC3,0x20,0x49,0x52,0x51,0x94,0xA7,0x39,0x8E,0x7B,0x55,0xB5,0xD3,0xA4,0x92,0x94,0x55,0xAD,0x8E,0x83,0x8A,0x5A,0xF0,0x83,0xCB,0x62,0x72,0x94,0xAF,0x7B,
-	0xD3,0x9C,0x10,0x84,0x92,0x9C,0xF4,0xA4,0xD3,0x9C,0x92,0x94,0x72,0x94,0xB3,0x94,0xF0,0x83,0x92,0x94,0x51,0x8C,0x6E,0x73,0xB3,0x94,0x08,0x42,0xAF,0x7B,0x51,0x94,0x6E,0x73,0xF0,0x83,0x31,0x84,0x0C,0x6B,0x10,0x84,0x10,0x8C,0x92,0x9C,0xB3,0x9C,0xF4,0xA4,0x76,0xB5,0xF0,0x83,0xAB,0x5A,0x2D,0x6B,0xC6,0x39,0x25,0x29,0x8A,0x52,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x00,0x08,0x4D,0x63,0x86,0x39,0x6A,0x4A,0xA3,0x10,0x21,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x41,0x08,0xE8,0x39,0x45,0x31,0xA7,0x31,0xA7,0x39,0xE8,0x41,0xC7,0x41,0x45,0x31,0xE8,0x39,0x08,0x42,0xC7,0x41,0xA7,0x39,0xA7,0x39,0xE8,0x39,0x04,0x29,0xA7,0x31,
-	0x25,0x29,0x25,0x29,0x45,0x29,0x6A,0x62,0x04,0x29,0x8E,0x7B,0x14,0xAD,0x72,0x94,0x92,0x9C,0xD3,0xA4,0xB3,0x94,0x29,0x42,0x92,0x9C,0xCB,0x5A,0x6E,0x73,0xAF,0x7B,0x51,0x94,0x55,0xAD,0xD3,0xA4,0xB3,0x9C,0xB3,0x9C,0xB3,0x9C,0xF4,0x9C,0x10,0x84,0x6E,0x73,0xD3,0xA4,0x10,0x8C,0xB3,0x9C,0xF0,0x83,0xAB,0x5A,0x92,0x9C,0xC7,0x39,
-	0x10,0x8C,0xB3,0x9C,0x51,0x8C,0x6E,0x73,0x92,0x94,0x72,0x94,0xD3,0x9C,0xD3,0xA4,0xF4,0xA4,0x96,0xB5,0x31,0x84,0xAB,0x5A,0x6E,0x73,0x51,0x94,0xAB,0x5A,0x08,0x42,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x01,0x08,0x0C,0x5B,0xE8,0x41,0x6A,0x52,0x41,0x10,0x00,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x62,0x10,
-	0x6A,0x62,0x29,0x42,0x86,0x39,0xA7,0x31,0xE8,0x39,0x49,0x52,0xA7,0x39,0xA7,0x31,0xE8,0x41,0xA7,0x31,0xE8,0x41,0xC7,0x41,0x66,0x31,0x08,0x42,0x66,0x31,0x66,0x31,0xE8,0x41,0xC7,0x41,0x25,0x29,0x8A,0x5A,0xE7,0x31,0x0C,0x6B,0x14,0xAD,0xB3,0x9C,0xD3,0x9C,0x92,0x9C,0x35,0xA5,0x29,0x4A,0x92,0x94,0x0C,0x6B,0xEC,0x62,0x31,0x8C,
-	0x72,0x94,0xB3,0x9C,0x31,0x8C,0xF4,0xA4,0x14,0xAD,0x92,0x9C,0xB3,0x94,0xAF,0x7B,0x10,0x8C,0xB3,0x9C,0xB3,0x9C,0x14,0xAD,0x6E,0x73,0x51,0x94,0xD3,0x9C,0x8E,0x7B,0x10,0x8C,0x51,0x94,0x31,0x8C,0x10,0x8C,0x35,0xAD,0x14,0xA5,0xF4,0xA4,0xD3,0xA4,0xF4,0xA4,0x76,0xB5,0x30,0x8C,0xAB,0x5A,0xCB,0x5A,0x31,0x8C,0xAF,0x7B,0x29,0x4A,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x21,0x08,0x21,0x08,0xCB,0x5A,0xE8,0x41,0xCB,0x52,0x61,0x00,0x00,0x08,0xE4,0x20,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x21,0x8A,0x5A,0x08,0x42,0x86,0x31,0x86,0x31,0x6A,0x4A,0x29,0x42,0xA7,0x39,0xA7,0x39,0xC7,0x41,0x86,0x39,0x25,0x21,0xE8,0x41,0x45,0x31,0xA7,0x39,0x45,0x29,0x86,0x31,
-	0x08,0x4A,0xC7,0x39,0x66,0x31,0xAB,0x5A,0xE8,0x41,0x0C,0x6B,0x14,0xAD,0x92,0x94,0x72,0x8C,0xD3,0x9C,0x55,0xA5,0x49,0x52,0x10,0x84,0x72,0x94,0x4D,0x73,0x10,0x84,0xB3,0x94,0x72,0x94,0x8E,0x7B,0xD3,0xA4,0xD3,0xA4,0xD3,0xA4,0xB3,0x9C,0x72,0x94,0xB2,0xA4,0xD3,0xA4,0xD3,0xA4,0x92,0x9C,0x51,0x94,0xD3,0x9C,0x51,0x94,0xB3,0x9C,
-	0x51,0x8C,0x51,0x8C,0x10,0x8C,0x2D,0x6B,0x72,0x94,0xD3,0xA4,0xD3,0x9C,0xD3,0x9C,0xF4,0xA4,0x76,0xB5,0xF0,0x7B,0x0C,0x6B,0x0C,0x6B,0x92,0x94,0x2D,0x6B,0x4D,0x73,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x6A,0x4A,0x08,0x4A,0x8A,0x52,0x00,0x00,0x21,0x10,0x08,0x42,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,
-	0x86,0x39,0x08,0x42,0x08,0x42,0x66,0x31,0xC7,0x39,0x86,0x31,0x66,0x31,0x08,0x4A,0xA7,0x39,0xA7,0x39,0xC7,0x39,0x08,0x42,0x25,0x29,0x08,0x42,0xA7,0x39,0x86,0x39,0x08,0x42,0xA7,0x39,0x45,0x29,0x28,0x3A,0xA7,0x31,0x0C,0x6B,0x14,0xA5,0xB3,0x94,0x72,0x94,0xD3,0x9C,0xF4,0x9C,0x8A,0x52,0x51,0x94,0x72,0x94,0x2D,0x6B,0xF0,0x83,
-	0xD3,0xA4,0xB3,0x9C,0x2D,0x6B,0x31,0x8C,0x72,0x94,0xD3,0x9C,0xD3,0xA4,0x92,0x9C,0xD3,0xA4,0xD3,0xA4,0xB3,0x9C,0x72,0x94,0x14,0xAD,0xF4,0xA4,0x2D,0x6B,0x31,0x8C,0x92,0x94,0xAF,0x7B,0x72,0x94,0x51,0x8C,0xB3,0x9C,0xF4,0xA4,0xD3,0xA4,0xD3,0xA4,0xF4,0xA4,0xB7,0xBD,0xF0,0x83,0x6E,0x73,0xAF,0x7B,0x30,0x8C,0xF0,0x83,0x6A,0x52,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x21,0x08,0x21,0x08,0x29,0x4A,0x29,0x4A,0xE8,0x41,0x00,0x00,0xE4,0x20,0x6A,0x4A,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0x29,0x4A,0x08,0x4A,0xA7,0x31,0xA7,0x39,0x28,0x52,0x66,0x31,0x86,0x31,0xE8,0x41,0xE8,0x41,0x29,0x4A,0x66,0x31,0x04,0x29,0x86,0x39,0x25,0x29,0x86,0x39,
-	0xE8,0x39,0xC7,0x39,0x66,0x31,0xC7,0x39,0x25,0x21,0x2D,0x6B,0x76,0xB5,0xB3,0x9C,0xB3,0x9C,0xF4,0xA4,0x31,0x8C,0x0C,0x6B,0xF4,0xA4,0xAF,0x7B,0x8E,0x7B,0x10,0x84,0xB3,0x9C,0x92,0x94,0x6A,0x52,0xF0,0x83,0xD3,0x9C,0xB3,0x9C,0x31,0x8C,0x10,0x8C,0x14,0xAD,0xB2,0xA4,0x92,0x9C,0xB3,0x9C,0x55,0xAD,0x8E,0x7B,0x0C,0x6B,0xD3,0xA4,
-	0x10,0x8C,0x8E,0x7B,0x51,0x8C,0xB3,0x9C,0xD3,0x9C,0xB3,0x9C,0xF4,0xA4,0xB3,0x9C,0x92,0x94,0xAF,0x7B,0x0C,0x6B,0xAF,0x7B,0xF0,0x83,0xAF,0x7B,0x8E,0x7B,0x6E,0x73,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x20,0x08,0x49,0x52,0x29,0x4A,0xA7,0x39,0x00,0x00,0xE8,0x41,0x6A,0x4A,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,
-	0xC3,0x20,0xA7,0x39,0x08,0x42,0x08,0x42,0xA7,0x39,0xC7,0x39,0xC7,0x39,0x45,0x31,0xA7,0x39,0xE8,0x41,0xA7,0x39,0xE4,0x20,0x66,0x31,0xA7,0x39,0x86,0x31,0x66,0x31,0xE8,0x39,0xC7,0x41,0x86,0x39,0x08,0x42,0x45,0x31,0x6E,0x73,0x31,0x8C,0x8E,0x7B,0xF4,0xA4,0x92,0x9C,0x8E,0x7B,0x10,0x8C,0xF4,0xAC,0xAF,0x7B,0x31,0x8C,0x10,0x8C,
-	0xD3,0xA4,0x10,0x84,0xAB,0x5A,0x92,0x9C,0xB3,0x9C,0xD3,0x9C,0x10,0x8C,0xF0,0x83,0x51,0x94,0xF0,0x83,0xD3,0x9C,0xF4,0xA4,0xD3,0x9C,0x86,0x31,0x92,0x9C,0xB3,0x9C,0x10,0x8C,0x6E,0x73,0x10,0x84,0xD3,0x9C,0xD3,0xA4,0xD3,0x9C,0xF4,0xA4,0x72,0x94,0xB3,0x9C,0xB3,0x9C,0x8E,0x7B,0xF0,0x83,0x51,0x8C,0x10,0x84,0x8E,0x7B,0x8E,0x7B,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x00,0x00,0x08,0x4A,0x8A,0x52,0x66,0x31,0x00,0x00,0xEC,0x62,0x66,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x66,0x31,0x66,0x31,0xC7,0x39,0x08,0x42,0x86,0x31,0x86,0x31,0x08,0x4A,0xE8,0x41,0x45,0x31,0x04,0x29,0xA7,0x31,0x45,0x31,0x8E,0x7B,0x8A,0x52,0x86,0x39,
-	0xC7,0x39,0xA7,0x39,0x86,0x31,0xE8,0x41,0x45,0x31,0xF0,0x83,0xEF,0x8B,0x51,0x94,0x92,0x9C,0xF0,0x83,0x51,0x84,0xB3,0x9C,0xD3,0x9C,0xAF,0x7B,0x6E,0x73,0x31,0x8C,0xF4,0xA4,0x8E,0x7B,0x4D,0x73,0x72,0x94,0x72,0x94,0x76,0xB5,0x8E,0x7B,0xAB,0x5A,0x6E,0x73,0x72,0x94,0xD3,0x9C,0x96,0xB5,0x49,0x4A,0xE8,0x41,0x55,0xAD,0x72,0x94,
-	0x8E,0x7B,0x2D,0x6B,0x72,0x94,0xB3,0x9C,0xB3,0x9C,0x92,0x9C,0x92,0x94,0xD3,0xA4,0x14,0xA5,0x55,0xB5,0x72,0x8C,0xF0,0x83,0xEF,0x8B,0x92,0x94,0x10,0x84,0x0C,0x6B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x61,0x10,0xA1,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0xE8,0x41,0x00,0x08,0xA3,0x18,0x0C,0x6B,0x41,0x10,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,
-	0x00,0x00,0x45,0x29,0x66,0x31,0xA3,0x18,0xA7,0x29,0x66,0x31,0xE8,0x41,0xA7,0x39,0xE8,0x39,0x66,0x31,0x66,0x31,0xA7,0x39,0xAF,0x7B,0x31,0x8C,0x86,0x31,0x86,0x39,0xC7,0x41,0x86,0x31,0x49,0x52,0xA7,0x39,0x25,0x29,0x10,0x8C,0x76,0xAD,0x35,0xA5,0x92,0x9C,0x72,0x94,0x51,0x94,0xB3,0x94,0xB3,0x94,0x51,0x94,0xF0,0x83,0x92,0x94,
-	0xB3,0x9C,0x0C,0x6B,0xF0,0x83,0x10,0x8C,0x14,0xA5,0x31,0x8C,0xE8,0x41,0x6E,0x73,0xB3,0x9C,0xB3,0x9C,0x35,0xA5,0x31,0x84,0x00,0x00,0x10,0x8C,0x76,0xAD,0x31,0x8C,0x6E,0x73,0x0C,0x6B,0x72,0x94,0x72,0x94,0x31,0x8C,0x31,0x8C,0xB3,0x94,0xD3,0x9C,0xB3,0x9C,0x14,0xAD,0x31,0x8C,0x31,0x84,0x6E,0x73,0xF0,0x83,0x31,0x8C,0x8A,0x52,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x61,0x10,0x41,0x10,0x61,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x86,0x31,0x00,0x00,0xA7,0x31,0xAB,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0xC7,0x39,0xC3,0x20,0x82,0x10,0x04,0x21,0xE4,0x20,0x6A,0x4A,0xE8,0x41,0xE8,0x39,0xE8,0x41,0x08,0x42,0xCB,0x62,0x86,0x39,0x86,0x39,0xA7,0x39,
-	0xE8,0x39,0xE8,0x41,0x10,0x8C,0x08,0x42,0x86,0x31,0x92,0x9C,0x35,0xAD,0x51,0x94,0x92,0x9C,0xB3,0x9C,0x51,0x94,0xD3,0xA4,0xB3,0x94,0x31,0x8C,0x10,0x84,0xB3,0x94,0xF0,0x83,0xAF,0x7B,0xF4,0xA4,0x14,0xA5,0xAF,0x7B,0xA7,0x31,0x8E,0x83,0x55,0xB5,0x14,0xAD,0x55,0xAD,0xB7,0xB5,0x45,0x31,0x00,0x00,0x51,0x94,0xF4,0xA4,0xD3,0x94,
-	0x30,0x8C,0x51,0x94,0xF4,0xA4,0xF4,0xA4,0xF4,0x9C,0xB3,0x9C,0xD3,0x9C,0xD3,0xA4,0xB3,0x9C,0xF4,0x9C,0x51,0x94,0x8E,0x7B,0x4D,0x73,0x2D,0x6B,0x8E,0x7B,0xAB,0x5A,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x25,0x29,0x41,0x10,0x86,0x39,0x86,0x39,0x00,0x00,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x00,0xA3,0x18,0x66,0x31,0xA3,0x18,0x04,0x29,0xA3,0x18,0xC7,0x39,0xA7,0x39,0x25,0x29,0x8A,0x5A,0x66,0x31,0x45,0x29,0x86,0x31,0x08,0x4A,0x66,0x31,0x2D,0x6B,0x8E,0x7B,0x2D,0x6B,0x04,0x21,0xAB,0x52,0x14,0xA5,0xD3,0x9C,0x92,0x94,0xB3,0x9C,0xF4,0x9C,0x51,0x94,0xF4,0xA4,0x72,0x8C,0x10,0x84,0x10,0x8C,0x92,0x9C,
-	0x31,0x8C,0x51,0x8C,0xB3,0x9C,0xF0,0x83,0x4D,0x63,0xAB,0x5A,0x14,0xAD,0x55,0xAD,0x92,0x94,0x8A,0x5A,0x04,0x21,0x00,0x00,0x49,0x52,0x10,0x84,0xD3,0xA4,0xD3,0x9C,0x92,0x94,0x72,0x94,0x14,0xA5,0x92,0x9C,0x72,0x94,0x92,0x9C,0xB3,0x9C,0xB3,0x9C,0xD3,0xA4,0xD3,0xA4,0x51,0x8C,0x8E,0x7B,0xCB,0x62,0x2D,0x6B,0x6E,0x73,0xAF,0x7B,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x61,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0xC3,0x18,0xC3,0x10,0x08,0x4A,0x04,0x21,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0xA3,0x10,0x62,0x10,0x21,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x82,0x10,0xE4,0x20,0x04,0x29,0xA3,0x18,0xA3,0x18,0x86,0x31,0x04,0x29,0x04,0x21,0xC3,0x20,0x45,0x31,0x86,0x39,0xA7,0x39,0xE8,0x41,
-	0x08,0x4A,0x2D,0x6B,0x6E,0x73,0x04,0x29,0xAF,0x7B,0x14,0xAD,0xB3,0x94,0x10,0x8C,0x92,0x94,0xF4,0xA4,0x92,0x94,0xB2,0xA4,0x51,0x94,0xAF,0x7B,0x72,0x94,0xD3,0xA4,0xD3,0x9C,0x51,0x94,0x10,0x84,0xB3,0x94,0xEC,0x62,0x31,0x8C,0x18,0xC6,0x6E,0x73,0x62,0x10,0x00,0x00,0x00,0x00,0x41,0x10,0xF0,0x83,0xD3,0xA4,0xD3,0x9C,0xF0,0x83,
-	0x31,0x84,0xB3,0x94,0xF4,0xA4,0xD3,0x9C,0x51,0x94,0x31,0x8C,0x72,0x94,0xB3,0x9C,0x14,0xAD,0x96,0xBD,0xD3,0x9C,0xB3,0x94,0xF0,0x7B,0xAB,0x5A,0x8E,0x7B,0xCB,0x5A,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA2,0x20,0xAF,0x6B,0xC3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0xA3,0x10,0x62,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0xE8,0x41,0x6E,0x73,0xC3,0x20,0xE4,0x20,0xC7,0x39,0xA3,0x10,0xE4,0x18,0xA7,0x31,0xE8,0x41,0xA7,0x39,0x6E,0x63,0x69,0x42,0x45,0x31,0x0C,0x6B,0x49,0x52,0xD3,0x9C,0x72,0x94,0xB3,0x94,0x92,0x9C,0x31,0x8C,0xB3,0x9C,0xB3,0x9C,0x72,0x8C,0xF0,0x83,0x51,0x8C,0xB3,0x9C,0x92,0x9C,
-	0xB3,0x9C,0x51,0x84,0x76,0xAD,0x6E,0x73,0x4D,0x73,0xD7,0xBD,0x6A,0x4A,0x00,0x00,0x00,0x00,0x42,0x10,0x21,0x08,0x82,0x18,0x2D,0x6B,0xB3,0x9C,0xF4,0xA4,0xAF,0x7B,0x92,0x9C,0xF4,0xA4,0xD3,0x9C,0x31,0x8C,0x10,0x84,0x14,0xA5,0xF4,0xA4,0xAF,0x7B,0xEC,0x5A,0x8A,0x52,0x8E,0x7B,0x51,0x94,0xF4,0xA4,0xAF,0x7B,0xEC,0x62,0xEC,0x62,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x21,0x08,0xC3,0x18,0x62,0x10,0x41,0x10,0x00,0x00,0x86,0x39,0x8A,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xC3,0x18,0xE8,0x41,0x49,0x4A,0x25,0x29,0xE4,0x20,0xE4,0x20,0xE4,0x18,0x25,0x29,0x25,0x29,0x86,0x39,0xEC,0x5A,
-	0x0C,0x5B,0x86,0x31,0xE4,0x20,0xAF,0x7B,0x76,0xB5,0x72,0x94,0xD3,0x9C,0xD3,0xA4,0xB3,0x9C,0x35,0xA5,0xF4,0x94,0xAF,0x7B,0x31,0x8C,0xB3,0x9C,0x72,0x94,0x8E,0x7B,0xEC,0x62,0x6E,0x73,0x6E,0x73,0xEC,0x62,0x76,0xB5,0x6A,0x52,0x00,0x00,0xA7,0x39,0x49,0x52,0x00,0x08,0x00,0x00,0x04,0x21,0xF0,0x83,0x51,0x8C,0xB3,0x9C,0x6E,0x73,
-	0x72,0x94,0xF4,0xA4,0x92,0x9C,0x31,0x8C,0xD3,0x9C,0x31,0x8C,0x10,0x8C,0x51,0x8C,0xD3,0x9C,0x30,0x8C,0xE8,0x41,0x8A,0x52,0x51,0x84,0xD3,0x9C,0xAF,0x7B,0xEC,0x62,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x49,0x52,0xC7,0x41,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0x41,0x10,0x82,0x10,0x21,0x08,0x04,0x29,0x08,0x4A,0x04,0x29,0xA3,0x18,0xC3,0x18,0x04,0x29,0x04,0x29,0x66,0x31,0xE8,0x41,0xA3,0x18,0x62,0x10,0xEC,0x62,0xF4,0xA4,0xD3,0xA4,0xD3,0xA4,0x15,0x9D,0x10,0x8C,0x51,0x94,0x72,0x8C,0x10,0x8C,0xB3,0x9C,0x51,0x94,0x72,0x94,0x92,0x9C,0x8E,0x7B,
-	0xEB,0x72,0x6A,0x52,0x0C,0x6B,0x92,0x9C,0x11,0x7C,0x00,0x00,0x45,0x31,0x51,0x94,0x4D,0x73,0x00,0x00,0x00,0x00,0xC3,0x18,0x92,0x9C,0x10,0x84,0x51,0x94,0xAF,0x7B,0x92,0x9C,0xB3,0x9C,0xF4,0x9C,0x14,0xAD,0x8E,0x7B,0x6E,0x73,0x51,0x8C,0xB3,0x9C,0xD3,0x9C,0x35,0xAD,0xD3,0xA4,0xE8,0x41,0x0C,0x6B,0x30,0x8C,0x31,0x84,0x6E,0x73,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x01,0x08,0xEC,0x62,0x45,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0xA3,0x18,0xE4,0x20,0xC3,0x20,0x04,0x29,0xC3,0x18,0x45,0x31,0xA7,0x39,0xE4,0x20,0x82,0x18,0xC3,0x18,0xE4,0x20,0x45,0x29,
-	0xE4,0x20,0x08,0x42,0x8E,0x7B,0x6A,0x52,0xA7,0x39,0x8E,0x7B,0x28,0x52,0x04,0x29,0x66,0x31,0x45,0x29,0xE8,0x41,0xEC,0x5A,0x72,0x8C,0x8E,0x83,0x49,0x52,0xD3,0xA4,0x8E,0x83,0x08,0x42,0x76,0xB5,0x2D,0x6B,0x00,0x00,0xC7,0x41,0x31,0x8C,0x2D,0x6B,0x6E,0x73,0x82,0x18,0x00,0x00,0x00,0x00,0x4D,0x73,0xF4,0xA4,0x72,0x94,0x30,0x8C,
-	0x92,0x94,0xF4,0xA4,0x72,0x94,0x51,0x94,0x4D,0x73,0xF4,0xA4,0x14,0xA5,0xF4,0xA4,0xB3,0x9C,0xD3,0x9C,0x35,0xAD,0x10,0x8C,0xEC,0x62,0xF0,0x83,0xD3,0xA4,0x6E,0x73,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xA3,0x18,0x0C,0x5B,0x62,0x10,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x29,0x86,0x31,0x01,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x04,0x21,0xA3,0x10,0xA3,0x18,0x49,0x52,0x25,0x21,0x45,0x29,0xC3,0x20,0x00,0x00,0xA7,0x39,0x31,0x8C,0xF0,0x83,0xAF,0x7B,0xAF,0x7B,0xF0,0x83,0xF0,0x83,0xA7,0x39,0x8A,0x52,0x6A,0x52,0x51,0x94,0xF0,0x83,0x0C,0x6B,0xC7,0x41,0x41,0x10,0x8A,0x52,0x6E,0x73,
-	0x2D,0x6B,0xB3,0x9C,0x31,0x84,0x00,0x00,0x66,0x31,0xD3,0xA4,0x4D,0x73,0x49,0x4A,0xAF,0x7B,0xE8,0x41,0x00,0x00,0x00,0x00,0x82,0x10,0xB3,0x9C,0x76,0xB5,0x72,0x8C,0x6E,0x73,0xB3,0x94,0x6E,0x73,0xCB,0x5A,0x51,0x94,0xF4,0xA4,0x72,0x94,0xB3,0x9C,0xB3,0x94,0x92,0x94,0xB3,0x9C,0xB3,0x9C,0x51,0x8C,0x10,0x8C,0x51,0x8C,0x6A,0x52,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x45,0x31,0x6E,0x73,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xC3,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x62,0x10,0xA7,0x31,0xE4,0x18,0xE4,0x18,0xC7,0x41,0x8A,0x5A,0x2D,0x6B,0xAF,0x7B,
-	0xB3,0x9C,0x72,0x94,0xF0,0x83,0xF0,0x83,0x10,0x84,0x72,0x94,0x4D,0x73,0xEC,0x62,0xAF,0x6B,0xAF,0x7B,0xE8,0x41,0xC3,0x18,0x00,0x08,0xCB,0x62,0xB3,0x94,0xAF,0x7B,0x92,0x9C,0x96,0xB5,0x62,0x10,0xC3,0x20,0xD3,0xA4,0x10,0x84,0x8A,0x52,0x6A,0x52,0xEC,0x62,0x8E,0x7B,0xE8,0x41,0x82,0x10,0x00,0x00,0x25,0x29,0x14,0xAD,0x14,0xAD,
-	0xC7,0x39,0x51,0x8C,0xF4,0xA4,0x6E,0x73,0x72,0x94,0xD3,0x9C,0x92,0x94,0xB3,0x94,0x92,0x94,0x72,0x94,0xB3,0x9C,0xD3,0xA4,0x14,0xA5,0xD3,0x9C,0x51,0x8C,0xE8,0x39,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x49,0x52,0x2D,0x6B,0x00,0x00,0x21,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x25,0x21,0x21,0x08,0x21,0x08,
-	0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0xE4,0x18,0x00,0x00,0xA3,0x18,0x66,0x29,0xAB,0x5A,0x14,0xA5,0x92,0x94,0x8E,0x7B,0xF4,0xA4,0x2D,0x6B,0x2D,0x6B,0x0C,0x5B,0xA3,0x18,0x45,0x31,0xA3,0x10,0x00,0x00,0x00,0x00,0xA7,0x29,0x0C,0x6B,0x51,0x94,0xD3,0x9C,0x31,0x8C,0x72,0x94,
-	0x35,0xAD,0x29,0x42,0x41,0x10,0x92,0x9C,0xF0,0x83,0xAB,0x52,0xF0,0x7B,0x08,0x4A,0x08,0x42,0xF0,0x83,0xF0,0x7B,0x86,0x31,0x00,0x00,0x00,0x00,0x45,0x31,0x76,0xB5,0x45,0x29,0xCB,0x62,0xD3,0x9C,0x51,0x94,0x72,0x94,0xB3,0x9C,0x92,0x9C,0x92,0x9C,0x92,0x9C,0xD3,0xA4,0xB2,0xA4,0xD3,0x9C,0x92,0x94,0x92,0x9C,0x35,0xAD,0xE8,0x39,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0xA1,0x18,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xAB,0x5A,0xCB,0x52,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x10,0x6A,0x4A,0xA3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xE4,0x20,0x66,0x31,
-	0x00,0x08,0x45,0x29,0x6A,0x4A,0xCB,0x5A,0x86,0x39,0xAB,0x5A,0xE8,0x39,0xE8,0x41,0xE8,0x41,0x08,0x4A,0xD3,0xA4,0x6A,0x52,0xE8,0x41,0xAB,0x52,0xCB,0x5A,0xD3,0xA4,0x31,0x8C,0xC3,0x20,0x6E,0x73,0x51,0x8C,0xCB,0x5A,0x10,0x84,0xF0,0x83,0x6A,0x4A,0xAB,0x5A,0x51,0x94,0x14,0xA5,0xEC,0x62,0x62,0x10,0x21,0x08,0x00,0x00,0x29,0x4A,
-	0xE4,0x20,0xA7,0x31,0x31,0x84,0xD3,0xA4,0x72,0x94,0x92,0x94,0x92,0x94,0x92,0x9C,0xB3,0x94,0xD3,0x9C,0xD3,0x9C,0xD3,0x9C,0xF0,0x83,0x14,0xA5,0x72,0x94,0xA3,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0x61,0x10,0x41,0x08,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0xCB,0x62,0xAB,0x5A,0x00,0x00,0xE4,0x20,0xA3,0x18,0x21,0x08,0x41,0x10,0x21,0x08,0x00,0x08,0x29,0x42,0x45,0x29,0x00,0x00,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xE4,0x20,0x49,0x52,0x08,0x42,0x25,0x29,0x86,0x31,0x04,0x29,0xEC,0x5A,0xAB,0x5A,0x08,0x4A,0x6E,0x73,0x08,0x42,0x49,0x4A,0xC7,0x41,0x45,0x31,0x8E,0x7B,0x92,0x9C,0x76,0xB5,
-	0x29,0x4A,0x86,0x39,0x6E,0x73,0xF0,0x7B,0x31,0x8C,0xAF,0x7B,0x0C,0x6B,0xF0,0x83,0x8E,0x7B,0x51,0x94,0x31,0x84,0x6A,0x52,0xA7,0x39,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0xC3,0x18,0xF0,0x7B,0xB2,0xA4,0xD3,0xA4,0x92,0x94,0x72,0x94,0x72,0x94,0xD3,0x9C,0xB3,0x9C,0xF4,0xA4,0xF0,0x83,0x10,0x8C,0x14,0xA5,0xE4,0x20,0x00,0x00,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x0C,0x6B,0x6A,0x52,0x00,0x00,0x25,0x29,0xC3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0xA3,0x18,0xC3,0x18,0x01,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x08,0x01,0x08,
-	0xCB,0x62,0x10,0x84,0x0C,0x6B,0x86,0x31,0x04,0x21,0x29,0x4A,0x86,0x39,0x66,0x31,0x66,0x29,0xA7,0x39,0x6E,0x73,0x49,0x52,0x6E,0x73,0x14,0xA5,0x92,0x9C,0xAF,0x7B,0xC7,0x39,0x8A,0x52,0x4D,0x73,0x51,0x8C,0xAF,0x7B,0x8A,0x5A,0xAB,0x5A,0xEF,0x8B,0x31,0x8C,0x8E,0x7B,0xE8,0x41,0xE4,0x20,0xC3,0x18,0x45,0x31,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x00,0x00,0x6A,0x52,0x72,0x94,0xD3,0x9C,0x92,0x94,0x92,0x94,0x72,0x94,0x92,0x9C,0xD3,0x9C,0xD3,0xA4,0x4D,0x73,0x14,0xA5,0x0C,0x6B,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x61,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x52,0xAB,0x52,0x00,0x00,0x66,0x31,0x45,0x29,0x00,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0xA3,0x18,0xC7,0x41,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC7,0x39,0x29,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x45,0x31,0x62,0x10,0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x41,0x10,0x08,0x42,0xB3,0x9C,0x31,0x8C,0x10,0x8C,0x08,0x42,
-	0x2D,0x6B,0x10,0x8C,0x14,0xA5,0xEC,0x62,0x6A,0x52,0x72,0x94,0x10,0x8C,0xCB,0x5A,0xB3,0x9C,0xEC,0x5A,0x2D,0x6B,0x10,0x8C,0xC3,0x18,0x49,0x52,0x66,0x31,0x00,0x00,0x21,0x08,0x00,0x00,0xE4,0x20,0xAF,0x7B,0x30,0x8C,0x92,0x94,0xD3,0x9C,0xB3,0x9C,0xB3,0x9C,0x14,0xA5,0xF0,0x7B,0x10,0x8C,0x92,0x9C,0x62,0x10,0x00,0x08,0x21,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0x61,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0xC7,0x41,0x4D,0x63,0x00,0x00,0xE4,0x20,0x45,0x29,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x8A,0x52,0xC3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xCB,0x62,0xEC,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x00,0x00,0x08,0x86,0x39,0x86,0x39,0xA3,0x18,0x00,0x00,0x21,0x08,0x62,0x10,0xC3,0x20,0xA3,0x10,0xAF,0x6B,0x92,0x9C,0x10,0x8C,0xAF,0x7B,0xCB,0x5A,0x31,0x8C,0x72,0x94,0x14,0xA5,0xF0,0x7B,0xE8,0x41,0x72,0x94,0x55,0xAD,0x8E,0x7B,0x8E,0x7B,0x8E,0x7B,0x8E,0x7B,0x35,0xAD,0x6A,0x52,0x8A,0x52,0x08,0x4A,0x8A,0x5A,
-	0x25,0x29,0x00,0x00,0x00,0x00,0x0C,0x6B,0x72,0x94,0x8E,0x7B,0x10,0x8C,0x92,0x94,0x10,0x84,0xAF,0x7B,0x10,0x8C,0x35,0xAD,0xC7,0x39,0x00,0x00,0x21,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x04,0x29,0x0C,0x6B,0x00,0x00,0x62,0x10,0xC7,0x39,0x21,0x08,0x04,0x21,0x82,0x10,0x21,0x08,0x00,0x00,0xC7,0x39,0xC7,0x39,
-	0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0x8E,0x7B,0x29,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x25,0x29,0xAB,0x52,0x6A,0x52,0x2D,0x6B,0x45,0x29,0x82,0x10,0x28,0x52,0x31,0x8C,0x04,0x29,0x6A,0x4A,0x10,0x84,0x14,0xAD,0xAF,0x7B,0x8E,0x7B,
-	0xF4,0xA4,0x92,0x9C,0xD3,0xA4,0x14,0xA5,0x49,0x52,0x8A,0x5A,0x14,0xAD,0xF4,0xA4,0x6E,0x73,0x8E,0x7B,0x10,0x8C,0x96,0xBD,0x6E,0x73,0x6A,0x52,0xCB,0x5A,0xAF,0x7B,0x2D,0x6B,0x00,0x08,0x00,0x00,0x25,0x21,0x51,0x8C,0x31,0x8C,0x6E,0x73,0x8E,0x7B,0x10,0x8C,0x10,0x84,0xD3,0xA4,0x0C,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x41,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x10,0x21,0x08,0x28,0x3A,0x04,0x21,0x00,0x00,0x66,0x31,0x62,0x08,0xA7,0x39,0xA7,0x39,0x00,0x00,0x21,0x08,0x62,0x10,0x25,0x21,0x00,0x08,0x41,0x08,0x42,0x10,0x41,0x10,0x00,0x08,0x21,0x10,0xB3,0x9C,0xE8,0x39,0x00,0x00,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x25,0x29,0xC7,0x41,0xCB,0x5A,0x08,0x4A,0x25,0x29,0x2D,0x6B,0xF0,0x83,0xAF,0x7B,0xB3,0x94,0x29,0x42,0x25,0x29,0x6A,0x52,0x29,0x4A,0x2D,0x6B,0x14,0xAD,0xB3,0x9C,0xF4,0x9C,0x92,0x9C,0xB3,0x9C,0x55,0xAD,0x8A,0x52,0x10,0x8C,0x34,0xB5,0xF4,0xA4,0xB3,0x9C,0xD3,0xA4,0x35,0xAD,0x35,0xAD,0x49,0x52,0x8E,0x7B,0xAB,0x5A,
-	0x51,0x8C,0x08,0x4A,0x00,0x00,0x00,0x00,0x04,0x29,0x72,0x94,0xF4,0xA4,0x14,0xA5,0x14,0xAD,0x35,0xAD,0x6E,0x73,0x21,0x08,0x00,0x00,0x62,0x10,0xCB,0x62,0x29,0x4A,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x08,0x25,0x19,0x25,0x19,0x00,0x00,0x25,0x29,0xE4,0x20,0x41,0x10,0x6A,0x52,0x62,0x10,0x21,0x08,0x00,0x08,0x66,0x31,
-	0xC3,0x20,0x00,0x08,0x42,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0x8E,0x7B,0x21,0x08,0x00,0x08,0x00,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x20,0x04,0x29,0x08,0x42,0x2D,0x6B,0xC3,0x20,0xAF,0x7B,0x51,0x8C,0x51,0x94,0xB3,0x9C,0xB3,0x94,0x08,0x42,0xEC,0x62,0x25,0x21,0x04,0x29,0x49,0x52,
-	0xE8,0x41,0xC7,0x41,0x8E,0x83,0xAF,0x7B,0x2D,0x6B,0x6A,0x4A,0x29,0x4A,0xAF,0x7B,0x72,0x94,0xF4,0xA4,0x92,0x94,0xF0,0x83,0xF4,0x94,0xAB,0x5A,0x29,0x4A,0x86,0x31,0x66,0x31,0x49,0x52,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x6E,0x73,0xF0,0x83,0x6E,0x73,0x29,0x4A,0x21,0x08,0x00,0x00,0x41,0x10,0x8A,0x52,0x72,0x8C,0x8A,0x52,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x41,0x10,0x00,0x08,0xC3,0x18,0xE8,0x41,0x00,0x00,0x25,0x29,0xA7,0x39,0x01,0x08,0x00,0x08,0x04,0x21,0xA7,0x31,0x01,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0xEC,0x62,0xAB,0x52,0x00,0x00,0x82,0x10,0xC3,0x18,0x28,0x52,0xE8,0x41,0x00,0x00,0x42,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x00,0x08,0x45,0x29,0x45,0x29,0xC7,0x39,0x08,0x4A,0x31,0x8C,0xEC,0x62,0x6E,0x73,0x31,0x8C,0x72,0x8C,0x8E,0x7B,0xAB,0x5A,0x8A,0x5A,0xE4,0x18,0xA3,0x18,0x8A,0x52,0xC7,0x39,0x0C,0x6B,0xF0,0x7B,0x62,0x10,0xC7,0x39,0xE8,0x41,0xA7,0x39,0x08,0x42,0xE8,0x39,0xA7,0x39,0x86,0x31,0xC7,0x39,0xC7,0x39,0x62,0x10,0xE4,0x20,
-	0x21,0x08,0xE4,0x20,0x45,0x31,0x82,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0x04,0x29,0x86,0x39,0x66,0x31,0xA7,0x39,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xA7,0x31,0x04,0x21,0x00,0x00,0xA3,0x18,0x41,0x10,0x21,0x08,0x21,0x08,
-	0x25,0x29,0xE4,0x20,0x21,0x08,0x21,0x08,0x00,0x00,0x31,0x8C,0x08,0x42,0x00,0x00,0x00,0x00,0x6A,0x62,0xD3,0x9C,0x04,0x21,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x86,0x39,0xA7,0x39,0x00,0x08,0x66,0x31,0x31,0x8C,0x51,0x8C,0xAF,0x7B,0x10,0x8C,0x31,0x8C,0x51,0x94,0xEC,0x5A,0x0C,0x6B,0x45,0x29,0xC3,0x20,
-	0x6A,0x52,0x8A,0x52,0x29,0x42,0xEC,0x62,0x45,0x29,0x49,0x4A,0x29,0x4A,0xA7,0x39,0x86,0x39,0xA7,0x39,0xE8,0x41,0x08,0x42,0xE8,0x41,0x29,0x4A,0x45,0x29,0xC3,0x20,0x04,0x29,0xE4,0x20,0x04,0x29,0x25,0x29,0xA3,0x18,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x25,0x29,0x45,0x29,0x82,0x10,0x04,0x21,0x04,0x29,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x41,0x20,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x42,0x10,0xA7,0x39,0x62,0x10,0x00,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x82,0x10,0x41,0x10,0x00,0x00,0x6A,0x62,0x31,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x8C,0x4D,0x63,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x21,0x08,0x08,0x42,0xE8,0x39,0x04,0x29,0x0C,0x6B,0xF0,0x83,0x92,0x9C,0xEC,0x62,0xF0,0x83,0xF4,0xA4,0xB3,0x94,0x8E,0x7B,0x0C,0x6B,0x6A,0x52,0x08,0x42,0x25,0x29,0xE4,0x20,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x62,0x10,0xE4,0x20,0xC3,0x18,0x82,0x18,0xC3,0x18,0xC3,0x18,0xA3,0x18,0x25,0x29,0x86,0x31,0x21,0x08,
-	0x62,0x10,0x41,0x10,0x62,0x10,0x82,0x10,0xA3,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x82,0x18,0x82,0x18,0x04,0x29,0xC3,0x20,0x45,0x29,0xA3,0x18,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC3,0x18,0x66,0x31,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x21,0x10,0x41,0x10,0x00,0x00,0x82,0x18,0x35,0xAD,0xA7,0x31,0x00,0x00,0x00,0x00,0xAF,0x7B,0xAF,0x7B,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0xEC,0x62,0xA7,0x31,0x8A,0x52,0x10,0x84,0x31,0x8C,0xEC,0x5A,0x8A,0x5A,0xB3,0x9C,0x92,0x9C,0x92,0x94,0x8E,0x7B,0x2D,0x6B,0xAB,0x5A,
-	0x08,0x4A,0xC3,0x20,0x00,0x00,0x21,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x00,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x01,0x08,0x00,0x00,0x41,0x10,0x62,0x10,0x21,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x21,0x08,0x41,0x10,0x42,0x10,0x62,0x10,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0xC3,0x18,0x04,0x21,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x21,0x08,0xF0,0x83,0x08,0x52,0x00,0x00,0x00,0x00,0xF0,0x83,0x51,0x8C,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x00,0x82,0x18,0xAF,0x7B,0xE8,0x39,0xA7,0x39,0x72,0x94,0x10,0x84,0x10,0x8C,0x28,0x52,0x10,0x8C,0x92,0x9C,0x51,0x94,0xD3,0x9C,0x6E,0x73,0x04,0x21,0x49,0x4A,0x29,0x4A,0x41,0x10,0x00,0x00,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x42,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x42,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x00,0x00,0x82,0x18,0x72,0x94,0x0C,0x5B,0x00,0x00,0x45,0x31,0xB3,0x94,0xAF,0x6B,0x00,0x00,0x00,0x00,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0xA3,0x18,0x21,0x08,0xA7,0x39,0x6A,0x52,0xCB,0x62,0x6E,0x73,0x8E,0x7B,0x92,0x94,0x49,0x52,0x4D,0x73,0x31,0x8C,0xF0,0x83,0x92,0x9C,0xD3,0x9C,0x08,0x42,
-	0x82,0x18,0x86,0x39,0x0C,0x6B,0x25,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x08,0x00,0x00,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0xE8,0x41,0xAF,0x7B,0xCB,0x5A,0xC3,0x20,0xCB,0x5A,0x51,0x8C,0x29,0x4A,0x00,0x00,0x00,0x00,0x62,0x10,0x21,0x08,0xA3,0x18,0xA7,0x39,0x41,0x10,0x00,0x08,0x00,0x00,
-	0x82,0x18,0x86,0x39,0xA3,0x18,0x62,0x10,0x08,0x42,0xCB,0x62,0x6E,0x73,0x2D,0x6B,0xF0,0x83,0x0C,0x6B,0x66,0x31,0x29,0x4A,0x51,0x94,0x92,0x9C,0xF4,0xA4,0x4D,0x63,0x62,0x10,0xE4,0x20,0x31,0x84,0xEC,0x62,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x08,0xA3,0x18,
-	0xE4,0x20,0x25,0x29,0xA3,0x18,0xA3,0x18,0xE4,0x20,0xC3,0x18,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0xE8,0x41,
-	0x8E,0x7B,0x82,0x10,0x82,0x18,0x6A,0x52,0xA7,0x31,0x21,0x08,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x01,0x08,0xC3,0x18,0xA7,0x39,0x00,0x00,0xE4,0x20,0x45,0x29,0x00,0x00,0x82,0x10,0x00,0x00,0x45,0x31,0x6A,0x52,0xCB,0x5A,0x6E,0x73,0x8E,0x7B,0xB3,0x9C,0xF0,0x83,0x25,0x21,0x2D,0x6B,0xB3,0x9C,0x51,0x94,0x14,0xA5,0x72,0x8C,
-	0x25,0x29,0xC3,0x18,0x8E,0x7B,0x4D,0x63,0x62,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0xC3,0x18,0x04,0x21,0x62,0x10,0x29,0x42,0xAF,0x7B,0xF0,0x83,0x04,0x29,0xF0,0x83,0x14,0xAD,0x35,0xAD,0xEC,0x5A,0x2D,0x6B,0x35,0xAD,0xF4,0xA4,0x08,0x4A,0xCB,0x5A,0x92,0x94,0x10,0x8C,0xF0,0x83,0xC7,0x39,0xC7,0x39,0xEC,0x5A,0x29,0x42,0x08,0x42,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x28,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0xC3,0x18,0xE4,0x18,0x00,0x08,0x00,0x00,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xC3,0x20,0x49,0x4A,0xAB,0x5A,0xA7,0x39,
-	0x25,0x29,0xC3,0x20,0x00,0x00,0x25,0x29,0xC3,0x18,0x08,0x42,0xF4,0xA4,0xF0,0x83,0x6E,0x73,0xD3,0xA4,0xE8,0x39,0x8E,0x7B,0xF4,0xA4,0xCB,0x5A,0x92,0x94,0xB3,0x9C,0x2D,0x6B,0x82,0x18,0xAF,0x7B,0xCB,0x5A,0xE4,0x20,0x82,0x18,0x00,0x00,0x00,0x08,0x6E,0x73,0x34,0xB5,0x08,0x42,0x31,0x8C,0x59,0xD6,0x55,0xB5,0x25,0x21,0xF4,0xA4,
-	0x39,0xCE,0x39,0xCE,0x6E,0x73,0x8E,0x7B,0xD7,0xC5,0xB7,0xBD,0x6A,0x52,0xAF,0x7B,0x55,0xAD,0x35,0xA5,0xF8,0xBD,0x6A,0x52,0x4D,0x73,0x76,0xB5,0xB3,0x94,0xF0,0x83,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x62,0x10,0x21,0x08,0x00,0x00,0x41,0x10,0xA7,0x39,0x0C,0x5B,0xA7,0x39,0x6A,0x52,0x8A,0x52,0xE4,0x20,0x00,0x00,0xA3,0x18,0x45,0x31,0x25,0x29,0xAF,0x7B,0x92,0x9C,0x4D,0x73,0x10,0x8C,0xAB,0x5A,0x6A,0x4A,0xD3,0x9C,0xEC,0x62,0xAF,0x7B,0x6E,0x73,
-	0xF0,0x83,0x45,0x29,0x4D,0x73,0xCB,0x62,0x04,0x21,0xC3,0x20,0x00,0x00,0x41,0x08,0xF0,0x7B,0x14,0xAD,0xC7,0x41,0x6A,0x52,0x6E,0x73,0xCB,0x62,0xC3,0x20,0x8A,0x5A,0x4D,0x73,0x2D,0x6B,0xE8,0x41,0xE8,0x41,0x8E,0x7B,0xF0,0x83,0x86,0x39,0x8E,0x7B,0xF4,0xA4,0x92,0x9C,0x14,0xAD,0x29,0x4A,0x0C,0x6B,0xF8,0xC5,0x92,0x94,0x31,0x8C,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA7,0x39,0xF0,0x83,0xA7,0x39,0x41,0x10,0xA7,0x39,0x72,0x94,
-	0x6E,0x73,0xA3,0x18,0x00,0x00,0x41,0x10,0x8A,0x5A,0xC3,0x18,0xCB,0x5A,0xF0,0x83,0x10,0x84,0xF4,0xAC,0xAF,0x7B,0xE8,0x39,0xB3,0x94,0xAF,0x7B,0x11,0x7C,0xAB,0x5A,0xEC,0x62,0x6E,0x73,0x8E,0x7B,0x8A,0x52,0x04,0x21,0x25,0x29,0x21,0x08,0x41,0x08,0x04,0x29,0x04,0x21,0x01,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x00,0x08,0x41,0x10,0x82,0x10,0xC3,0x18,0x04,0x29,0x82,0x18,0x25,0x29,0x29,0x4A,0xE8,0x41,0xA7,0x39,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x61,0x10,0x04,0x21,0x61,0x10,0xC3,0x18,0xEC,0x62,0x31,0x84,0xEC,0x5A,0xAB,0x5A,0xAB,0x5A,0x4D,0x73,0x6E,0x73,0x66,0x29,0x00,0x00,0x41,0x10,0x00,0x00,0xAB,0x5A,0x08,0x42,0x29,0x4A,0xB3,0x9C,0x10,0x8C,0xF0,0x83,0xD0,0x73,0x49,0x52,0xAF,0x7B,0x0C,0x6B,0x51,0x8C,0x8A,0x52,
-	0xAB,0x5A,0x72,0x94,0xB3,0x9C,0x8A,0x5A,0x04,0x29,0x66,0x29,0x41,0x08,0x41,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x0C,0x6B,0x18,0xC6,0x51,0x94,0xC3,0x20,0x6E,0x73,0x31,0x84,0x0C,0x5B,0x29,0x4A,0x86,0x39,
-	0x45,0x31,0x00,0x00,0x41,0x10,0x00,0x00,0x66,0x31,0x6A,0x52,0x00,0x08,0x6E,0x73,0x55,0xAD,0xE8,0x39,0x2D,0x6B,0x0C,0x6B,0x8E,0x7B,0x4D,0x63,0x51,0x94,0x2D,0x6B,0x8A,0x5A,0x51,0x94,0xD3,0xA4,0x8A,0x52,0xC3,0x20,0x45,0x29,0x41,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x82,0x10,0xC3,0x18,0xE4,0x20,0x04,0x29,0x04,0x29,0x25,0x29,
-	0x25,0x29,0x41,0x08,0xC3,0x18,0x04,0x29,0x04,0x21,0xC3,0x20,0x25,0x21,0xE4,0x20,0x04,0x29,0xE4,0x20,0xE4,0x20,0xA3,0x18,0x82,0x10,0x62,0x10,0x42,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x82,0x10,0x82,0x10,0x62,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xEC,0x62,0x72,0x94,0x4D,0x73,0x08,0x42,0x8A,0x5A,0x4D,0x73,0xE8,0x39,0x6E,0x73,0x6E,0x73,0xA7,0x31,0xA3,0x18,0x62,0x08,0x62,0x10,0x21,0x08,0x21,0x08,0x08,0x42,0x21,0x08,0xC7,0x41,0xEC,0x62,0x31,0x84,0xD3,0xA4,0x6E,0x63,0xAF,0x7B,0x92,0x94,0x72,0x94,0xCB,0x5A,
-	0x6A,0x62,0x72,0x94,0x92,0x9C,0x6A,0x4A,0xE4,0x20,0x6E,0x73,0x45,0x29,0x00,0x00,0x00,0x08,0x8A,0x52,0xAB,0x5A,0xA7,0x31,0x08,0x42,0x29,0x42,0xA7,0x31,0xE8,0x41,0xA7,0x39,0x00,0x00,0x45,0x31,0x08,0x4A,0xE8,0x41,0x04,0x29,0x86,0x31,0x66,0x31,0xE8,0x41,0x08,0x42,0x08,0x42,0x08,0x42,0xA7,0x39,0x66,0x31,0xA7,0x39,0x04,0x21,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xE8,0x39,0x72,0x94,0xD3,0x9C,0xA7,0x39,0x08,0x42,0x0C,0x6B,0x8E,0x7B,0xA7,0x39,0x86,0x39,0x08,0x4A,0xC7,0x39,0xC7,0x39,
-	0x41,0x10,0xA7,0x31,0xC3,0x20,0x41,0x10,0x01,0x08,0x31,0x8C,0x86,0x31,0xA3,0x18,0x08,0x4A,0x72,0x94,0x14,0xAD,0xF0,0x83,0x8E,0x7B,0x92,0x9C,0xB3,0x94,0xEC,0x62,0xCB,0x62,0x92,0x9C,0xB2,0xA4,0x31,0x84,0x86,0x31,0xA7,0x39,0xA3,0x18,0x00,0x08,0x62,0x10,0x6A,0x52,0x4D,0x73,0x66,0x31,0xE7,0x31,0xE8,0x41,0x25,0x29,0xA7,0x31,
-	0x25,0x29,0x00,0x00,0x66,0x31,0x08,0x42,0xE8,0x39,0x04,0x29,0x66,0x29,0x66,0x29,0xA7,0x39,0xC7,0x39,0xA7,0x39,0xA7,0x39,0xA7,0x39,0xA7,0x39,0xC7,0x39,0x45,0x29,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,
-	0x21,0x08,0x00,0x00,0x20,0x08,0x6E,0x73,0x92,0x9C,0xD3,0x9C,0xAF,0x6B,0x8A,0x5A,0xEC,0x5A,0xAB,0x52,0x6A,0x52,0x6A,0x52,0x45,0x31,0x49,0x4A,0x08,0x42,0xA7,0x39,0x00,0x00,0x82,0x18,0xA3,0x18,0xA3,0x18,0x00,0x00,0x8A,0x5A,0x0C,0x5B,0xE4,0x20,0xAB,0x5A,0x6E,0x73,0xB3,0x9C,0x51,0x94,0x31,0x8C,0x72,0x94,0xD3,0xA4,0xAF,0x7B,
-	0x8A,0x5A,0xB3,0x94,0xF4,0xA4,0x14,0xA5,0xE8,0x41,0x00,0x00,0x00,0x00,0x21,0x08,0x25,0x29,0x04,0x29,0xCB,0x5A,0x29,0x4A,0x66,0x31,0xE8,0x41,0x45,0x29,0x86,0x39,0xE4,0x20,0x21,0x08,0xC7,0x41,0x08,0x4A,0xE8,0x41,0x45,0x31,0x86,0x39,0xC7,0x39,0xE8,0x41,0x08,0x4A,0x08,0x42,0x08,0x42,0xA7,0x39,0xA7,0x39,0x45,0x31,0x04,0x21,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x04,0x21,0x82,0x18,0x00,0x00,0x00,0x00,0xC7,0x41,0xF4,0xA4,0x92,0x9C,0xE8,0x41,0x6A,0x62,0xAB,0x5A,0x8A,0x5A,0x28,0x52,0x45,0x31,0xA7,0x39,0x29,0x4A,0x66,0x31,0x2D,0x6B,0xCB,0x62,0xE4,0x20,
-	0x00,0x00,0x21,0x08,0x41,0x08,0x62,0x10,0x00,0x00,0xC3,0x20,0x6E,0x73,0xE4,0x20,0xAB,0x52,0x0C,0x6B,0x31,0x8C,0x72,0x94,0x31,0x8C,0x72,0x94,0x51,0x8C,0x51,0x94,0x51,0x94,0x72,0x94,0x92,0x9C,0xD3,0xA4,0xAB,0x52,0xCB,0x62,0xA3,0x18,0x00,0x00,0x04,0x21,0xA3,0x18,0x04,0x29,0xA7,0x31,0xE4,0x20,0xC7,0x39,0xA7,0x39,0x25,0x29,
-	0x62,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x18,0x82,0x10,0x82,0x18,0x82,0x10,0xC3,0x18,0x04,0x29,0x45,0x31,0x86,0x31,0x66,0x31,0x66,0x31,0x66,0x31,0x25,0x29,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x10,0x45,0x31,0x00,0x00,0x41,0x08,
-	0xAF,0x7B,0xD3,0x9C,0x6E,0x73,0x08,0x52,0x8A,0x5A,0x49,0x52,0x86,0x39,0x66,0x31,0x45,0x29,0x66,0x31,0x45,0x29,0x45,0x31,0x66,0x31,0x4D,0x73,0x10,0x84,0x62,0x10,0x00,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x82,0x10,0x72,0x94,0xE8,0x39,0xE8,0x41,0x10,0x84,0xF0,0x7B,0xB3,0x94,0x51,0x94,0x51,0x94,0x51,0x94,0x10,0x8C,
-	0x51,0x94,0x51,0x94,0x92,0x94,0xD3,0x9C,0xEC,0x62,0x51,0x8C,0x08,0x42,0x00,0x00,0x41,0x10,0xC7,0x41,0x86,0x31,0x8A,0x52,0x45,0x29,0x62,0x10,0x00,0x08,0x00,0x00,0x21,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x00,0x08,0x21,0x10,0x21,0x08,0x01,0x08,0x21,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0xA3,0x10,0x62,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x08,0x00,0x00,0x6A,0x52,0xF4,0xA4,0xD0,0x73,0x86,0x39,0xC7,0x41,0x6A,0x4A,0xE8,0x39,0xE8,0x41,0x45,0x29,0x66,0x31,0xA7,0x31,0x25,0x29,0x45,0x29,0x45,0x29,0x8A,0x5A,0x08,0x4A,0x25,0x21,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x4D,0x73,0x31,0x8C,0x41,0x10,0xF0,0x83,0x31,0x8C,0x31,0x8C,0x72,0x94,0x10,0x8C,0xB3,0x94,0xF4,0x94,0x8E,0x83,0x72,0x94,0x72,0x94,0xD3,0xA4,0x2D,0x6B,0xF0,0x83,0x08,0x4A,0x00,0x00,0x00,0x08,0x31,0x8C,0x14,0xA5,0xAF,0x7B,0xAF,0x6B,0x0C,0x6B,0x2D,0x6B,0xAF,0x7B,
-	0x72,0x94,0x0C,0x6B,0xAF,0x7B,0x45,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0xCB,0x5A,0x8E,0x7B,0xAF,0x7B,0x6E,0x73,0xCB,0x62,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0xC3,0x20,0xF0,0x83,0x92,0x9C,0x08,0x4A,
-	0x45,0x31,0x08,0x42,0xE8,0x41,0x8A,0x52,0x29,0x4A,0xE4,0x20,0x86,0x31,0x66,0x29,0x66,0x31,0x6A,0x52,0x6A,0x52,0x0C,0x5B,0x25,0x29,0x00,0x00,0xA3,0x18,0xE4,0x20,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA3,0x18,0x10,0x84,0x45,0x29,0x6A,0x52,0x72,0x94,0xAB,0x5A,0xF0,0x83,0x51,0x94,0xB3,0x94,0x72,0x94,
-	0x2D,0x6B,0x92,0x94,0x72,0x94,0x92,0x9C,0x51,0x94,0xD3,0x9C,0x29,0x4A,0x00,0x00,0x41,0x10,0x10,0x84,0x92,0x9C,0xC7,0x41,0x6E,0x73,0xF4,0x9C,0x14,0xAD,0x14,0xA5,0x76,0xAD,0xEC,0x62,0x31,0x8C,0x45,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0x21,0x08,0x10,0x84,0x14,0xAD,0xD3,0xA4,0x55,0xAD,0x51,0x94,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0xC7,0x41,0xB2,0xA4,0x0C,0x6B,0x25,0x29,0x29,0x4A,0xCB,0x5A,0x6A,0x4A,0x25,0x29,0xC7,0x39,0xC7,0x39,0x45,0x29,0x04,0x29,0xC7,0x41,0x6E,0x73,0x4D,0x63,0x31,0x8C,0x25,0x29,0x00,0x00,0x00,0x08,0xC3,0x18,0xE4,0x20,
-	0xA3,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x42,0x10,0x21,0x08,0x00,0x00,0x4D,0x73,0x6A,0x52,0x04,0x29,0xB2,0xA4,0x51,0x8C,0x72,0x94,0xEF,0x8B,0x31,0x8C,0x92,0x9C,0x8A,0x52,0x8E,0x7B,0xB2,0xA4,0x72,0x94,0xF0,0x83,0x31,0x8C,0xAB,0x5A,0x00,0x00,0xA3,0x18,0x4D,0x73,0x6E,0x73,0x8A,0x5A,0xAF,0x7B,0x51,0x94,0x51,0x94,0xF0,0x83,
-	0x92,0x9C,0x2D,0x6B,0x0C,0x6B,0xA3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x2D,0x6B,0x72,0x94,0xEC,0x62,0x92,0x9C,0xCB,0x62,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0xC3,0x18,0x62,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0x6A,0x52,0x34,0xB5,0x08,0x4A,0xA3,0x10,0xC7,0x41,0x2D,0x6B,
-	0xF0,0x83,0xE8,0x39,0xA2,0x20,0x62,0x10,0x25,0x21,0x66,0x31,0x08,0x4A,0x08,0x4A,0x6A,0x52,0xE4,0x20,0xE8,0x41,0xA3,0x18,0x21,0x08,0x62,0x10,0x00,0x00,0x00,0x08,0x66,0x31,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE8,0x41,0x8E,0x7B,0x42,0x10,0x6E,0x73,0xF4,0xA4,0x72,0x94,0x31,0x8C,0xF0,0x83,0x51,0x8C,
-	0x6E,0x73,0x31,0x8C,0x72,0x94,0x72,0x94,0xF0,0x83,0x10,0x84,0x8A,0x5A,0x00,0x00,0xE4,0x18,0x8E,0x7B,0x31,0x84,0x29,0x4A,0xAF,0x7B,0x72,0x94,0x10,0x8C,0xAF,0x7B,0xB3,0x9C,0xF0,0x7B,0x2D,0x6B,0x62,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x6E,0x73,0xB3,0x9C,0xAB,0x52,0xB2,0xA4,0x45,0x31,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x86,0x31,0xA3,0x18,0x00,0x00,0x00,0x00,0xCB,0x62,0xF4,0xA4,0x04,0x29,0xC3,0x18,0x29,0x42,0x62,0x10,0x25,0x29,0x86,0x39,0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x00,0x66,0x31,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x21,0x08,0x41,0x08,0x62,0x10,0x41,0x08,0xC7,0x39,
-	0xA3,0x18,0xC3,0x18,0x62,0x10,0x21,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x04,0x21,0x31,0x84,0x25,0x29,0x86,0x39,0x35,0xAD,0x51,0x94,0xEF,0x8B,0x31,0x8C,0x31,0x8C,0xAF,0x7B,0x51,0x94,0x51,0x94,0x51,0x94,0x10,0x8C,0x92,0x9C,0x8A,0x52,0x00,0x00,0xE4,0x20,0x8E,0x7B,0x8E,0x83,0x6A,0x52,0xF0,0x83,0x92,0x9C,0x10,0x8C,0x8E,0x7B,
-	0x72,0x94,0x6E,0x73,0xAF,0x7B,0xE4,0x18,0xC3,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x6E,0x73,0xF4,0xAC,0x2D,0x6B,0xD3,0xA4,0x25,0x29,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0x29,0x4A,0xF4,0xA4,0x82,0x18,0x00,0x08,0xA7,0x39,0x21,0x08,0x00,0x00,0xA3,0x18,
-	0x04,0x21,0x04,0x21,0xC7,0x39,0x21,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0xC7,0x41,0x82,0x18,0x01,0x08,0x41,0x08,0x45,0x29,0x62,0x10,0x45,0x29,0x45,0x29,0x00,0x08,0x62,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x4D,0x73,0xEF,0x8B,0xA7,0x31,0x31,0x8C,0x72,0x94,0x72,0x94,0x72,0x94,0x72,0x94,
-	0xF0,0x83,0x31,0x8C,0x92,0x9C,0x72,0x94,0xAF,0x7B,0xD3,0xA4,0xEC,0x62,0x00,0x00,0xA3,0x18,0x8A,0x5A,0xAF,0x7B,0x0C,0x6B,0x31,0x8C,0x92,0x9C,0x72,0x94,0x4D,0x73,0x51,0x94,0xAF,0x7B,0xF0,0x7B,0x04,0x21,0x45,0x29,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x10,0x00,0x00,0xAB,0x5A,0x35,0xAD,0x6E,0x73,0x72,0x94,0x04,0x29,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x20,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x08,0x52,0x96,0xBD,0x86,0x31,0x04,0x29,0x25,0x29,0x21,0x08,0x00,0x00,0x00,0x08,0x45,0x31,0x45,0x31,0xCB,0x5A,0x66,0x31,0x21,0x08,0x82,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xC7,0x39,0x82,0x18,0x00,0x08,0x41,0x10,0x00,0x08,
-	0x00,0x08,0xA3,0x18,0xA3,0x18,0x00,0x00,0xC3,0x20,0xA3,0x18,0x21,0x08,0x00,0x00,0x45,0x29,0x92,0x9C,0x0C,0x5B,0xEC,0x62,0x10,0x8C,0x10,0x84,0xAF,0x7B,0x51,0x94,0xF0,0x83,0x31,0x8C,0x92,0x9C,0x10,0x8C,0xF0,0x83,0x14,0xAD,0xEC,0x62,0x00,0x00,0x21,0x08,0x6A,0x62,0xB3,0x9C,0xAF,0x7B,0x8E,0x7B,0xB3,0x9C,0x92,0x94,0x0C,0x6B,
-	0x10,0x8C,0xF0,0x83,0x31,0x8C,0x25,0x29,0x86,0x39,0x82,0x18,0x82,0x18,0x41,0x10,0x41,0x08,0x61,0x10,0x00,0x00,0x08,0x4A,0xF4,0xAC,0xAF,0x7B,0x92,0x94,0x25,0x29,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x18,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x21,0x10,0x72,0x94,0x8A,0x52,0x00,0x00,0x08,0x4A,0x04,0x29,0x00,0x00,0xC3,0x18,0x62,0x10,0x00,0x08,
-	0x62,0x10,0xA3,0x18,0x21,0x08,0xA3,0x18,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,0x00,0x00,0x21,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x10,0x00,0x08,0x21,0x08,0xAF,0x7B,0x8E,0x7B,0x8E,0x7B,0xD3,0xA4,0xF0,0x83,0x10,0x84,0x72,0x94,
-	0x51,0x8C,0x31,0x8C,0x72,0x94,0x72,0x94,0x31,0x8C,0x35,0xAD,0x0C,0x6B,0x41,0x08,0x62,0x10,0x4D,0x73,0x72,0x94,0x6E,0x73,0x30,0x8C,0x72,0x94,0x92,0x94,0x0C,0x6B,0xF0,0x83,0xF0,0x83,0x72,0x94,0xE8,0x41,0xC3,0x18,0x41,0x10,0xE4,0x20,0x04,0x29,0x21,0x08,0x62,0x10,0x00,0x00,0xC7,0x41,0xF4,0xA4,0xEF,0x8B,0xD3,0x9C,0x45,0x31,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0xE8,0x41,0x31,0x84,0x00,0x00,0x00,0x00,0xA7,0x39,0x25,0x29,0x00,0x08,0xC7,0x39,0x66,0x31,0x00,0x08,0x21,0x08,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x10,0x00,0x08,0x62,0x08,0x41,0x08,0x62,0x10,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x6A,0x52,0xD3,0xA4,0x4D,0x73,0xAF,0x7B,0x92,0x9C,0x72,0x94,0x72,0x94,0x10,0x8C,0x51,0x94,0xB3,0x9C,0x31,0x8C,0x10,0x8C,0x55,0xB5,0x0C,0x6B,0x00,0x00,0xA3,0x18,0x10,0x84,0x72,0x94,0x10,0x8C,0xB3,0x9C,0x31,0x8C,0x51,0x94,0x4D,0x73,
-	0x10,0x8C,0xF0,0x83,0x31,0x8C,0xAB,0x5A,0x45,0x31,0x62,0x10,0x25,0x29,0x25,0x21,0x45,0x31,0xC3,0x20,0x00,0x00,0xA7,0x39,0xD3,0xA4,0x30,0x8C,0xF4,0xA4,0xA7,0x39,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x42,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x2D,0x6B,0x4D,0x63,0x00,0x00,0x62,0x10,0xA3,0x18,0x61,0x10,0x21,0x08,0x62,0x10,0xC3,0x20,0x41,0x10,
-	0x21,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x62,0x10,0x21,0x10,0x21,0x08,0x00,0x08,0x86,0x31,0x49,0x4A,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA3,0x18,0x8E,0x7B,0x49,0x52,0x04,0x29,0x8E,0x83,0x92,0x9C,0x72,0x94,
-	0x72,0x94,0x10,0x8C,0x31,0x8C,0x30,0x8C,0x6E,0x73,0xF0,0x83,0x0C,0x6B,0x00,0x00,0xA3,0x18,0x6E,0x73,0x92,0x94,0x92,0x9C,0x51,0x94,0x51,0x94,0xB3,0x9C,0x4D,0x73,0x10,0x8C,0x31,0x8C,0x51,0x8C,0x0C,0x5B,0xC7,0x41,0xE4,0x20,0x25,0x29,0x86,0x39,0x86,0x39,0x04,0x21,0x00,0x00,0xC7,0x39,0xF4,0xA4,0x31,0x8C,0x14,0xAD,0x08,0x42,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x10,0xEF,0x8B,0xA7,0x31,0x00,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x04,0x29,0x41,0x10,0x00,0x08,0x82,0x18,0x82,0x10,0x21,0x08,0x62,0x10,0x62,0x10,0x62,0x10,0x86,0x39,0x82,0x18,0x04,0x21,0x82,0x10,0x00,0x08,0xE4,0x20,0x25,0x29,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x29,0x4A,0x92,0x9C,0x66,0x31,0x82,0x18,0x2D,0x6B,0x10,0x8C,0x92,0x9C,0xAF,0x7B,0x8A,0x5A,0xD3,0x9C,0x30,0x8C,0x10,0x84,0xEC,0x62,0x00,0x00,0x82,0x10,0x8E,0x7B,0x72,0x94,0x72,0x94,0x72,0x94,0x51,0x94,0xD3,0xA4,0x6E,0x73,
-	0x10,0x8C,0x51,0x94,0x31,0x8C,0xAF,0x7B,0x8A,0x5A,0x45,0x31,0x08,0x42,0x86,0x31,0x08,0x42,0x04,0x29,0x00,0x00,0x08,0x4A,0xF4,0xAC,0x10,0x8C,0xF4,0xA4,0x6A,0x52,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x04,0x29,0xEF,0x8B,0x29,0x4A,0x6A,0x4A,0x01,0x08,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x04,0x29,0x82,0x10,
-	0xE4,0x18,0x45,0x31,0x21,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x86,0x31,0xA3,0x18,0xA3,0x18,0x04,0x29,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x82,0x10,0x62,0x10,0x82,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xC3,0x20,0xD3,0xA4,0x92,0x94,0xC3,0x18,0x28,0x52,0x6E,0x73,
-	0x10,0x8C,0x72,0x94,0xF0,0x83,0xAF,0x7B,0xF0,0x83,0x34,0xB5,0x2D,0x6B,0x00,0x00,0x41,0x10,0x31,0x8C,0x72,0x94,0x31,0x8C,0x72,0x94,0x51,0x94,0xEF,0x8B,0x4D,0x73,0x10,0x8C,0x72,0x94,0x10,0x84,0x0C,0x6B,0x6E,0x73,0x08,0x42,0x6A,0x52,0x8A,0x5A,0xCB,0x5A,0x25,0x29,0x00,0x00,0x08,0x4A,0xF4,0xAC,0x30,0x8C,0xF4,0xA4,0xCB,0x62,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0xA7,0x39,0xEF,0x8B,0xF0,0x83,0xCB,0x62,0x82,0x18,0x21,0x08,0x62,0x10,0x62,0x10,0x41,0x08,0xE4,0x20,0x41,0x10,0x86,0x31,0xC3,0x18,0x00,0x08,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x21,0x08,0x21,0x10,0x62,0x10,0x42,0x10,0x25,0x21,0xC7,0x41,0x21,0x08,0x62,0x10,0x62,0x10,
-	0x21,0x08,0x41,0x10,0x21,0x08,0x82,0x18,0x82,0x10,0x00,0x00,0x49,0x52,0x66,0x31,0x00,0x00,0x41,0x10,0x00,0x00,0x08,0x4A,0x92,0x9C,0x0C,0x5B,0x6E,0x73,0x2D,0x6B,0x8E,0x83,0x4D,0x73,0xB3,0x9C,0x8E,0x7B,0xAB,0x5A,0x34,0xB5,0x8E,0x7B,0x00,0x00,0x41,0x10,0xAF,0x7B,0x92,0x94,0x51,0x94,0x51,0x94,0x92,0x9C,0x31,0x8C,0x6E,0x73,
-	0xF0,0x83,0x72,0x94,0x72,0x94,0x8E,0x7B,0x0C,0x6B,0xCB,0x5A,0xAB,0x5A,0x2D,0x6B,0xAF,0x7B,0x45,0x29,0x82,0x10,0x2D,0x6B,0xF4,0xAC,0x31,0x8C,0x92,0x9C,0x4D,0x73,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xEC,0x62,0xEC,0x5A,0x21,0x08,0x04,0x21,0xC3,0x18,0x00,0x08,0x21,0x08,0x62,0x10,0x41,0x10,0x21,0x08,0x21,0x08,
-	0xA3,0x18,0x62,0x10,0x25,0x21,0xE8,0x41,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x82,0x18,0x41,0x10,0x21,0x08,0x41,0x08,0x00,0x00,0xCB,0x62,0x86,0x39,0x00,0x00,0x41,0x10,0x21,0x08,0x00,0x00,0x45,0x31,0x8E,0x7B,0x66,0x31,0xCB,0x62,
-	0xF0,0x83,0x49,0x52,0x6E,0x73,0xF0,0x83,0x6E,0x73,0x14,0xAD,0x4D,0x73,0x00,0x00,0x82,0x10,0x10,0x8C,0xF0,0x83,0x31,0x8C,0x31,0x8C,0x92,0x9C,0x92,0x9C,0xF0,0x7B,0xF0,0x83,0x51,0x94,0x72,0x94,0x8E,0x7B,0xCB,0x5A,0x29,0x42,0x8E,0x7B,0xF0,0x7B,0xF0,0x83,0xC7,0x41,0x25,0x29,0x10,0x8C,0x92,0x9C,0x31,0x8C,0x92,0x9C,0x8E,0x7B,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0xF0,0x83,0x29,0x4A,0x00,0x00,0x21,0x08,0x00,0x08,0x21,0x08,0x62,0x10,0x42,0x10,0x41,0x10,0x61,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x82,0x10,0xC3,0x18,0x21,0x08,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0xC3,0x18,0xA3,0x18,0x21,0x08,0x82,0x18,0x41,0x10,0x04,0x21,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0xC7,0x39,0x2D,0x6B,0x04,0x29,0x6E,0x73,0x6E,0x73,0x8E,0x7B,0xAF,0x7B,0x4D,0x73,0x6E,0x73,0x4D,0x73,0x00,0x00,0x41,0x10,0x31,0x8C,0x72,0x94,0xAF,0x7B,0x51,0x94,0x10,0x8C,0x72,0x94,0x0C,0x6B,
-	0xF0,0x83,0x72,0x94,0x8E,0x7B,0x28,0x52,0x08,0x4A,0xCB,0x5A,0x0C,0x6B,0xF0,0x83,0x31,0x8C,0xC7,0x39,0xE8,0x41,0xD3,0xA4,0x72,0x94,0x31,0x8C,0x72,0x94,0xAF,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0x31,0x84,0xE4,0x18,0x00,0x00,0x41,0x10,0x42,0x10,0x45,0x29,0xA3,0x18,0x00,0x08,0x00,0x08,0x41,0x10,0x62,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0xA3,0x18,0x62,0x10,0x00,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x20,0x6E,0x73,0xCB,0x5A,
-	0x86,0x31,0xF0,0x83,0x6E,0x73,0x29,0x4A,0xCB,0x5A,0xF0,0x83,0x0C,0x6B,0x00,0x00,0x41,0x08,0xEC,0x62,0x51,0x94,0xEF,0x8B,0xAF,0x7B,0x31,0x8C,0x72,0x94,0xAF,0x7B,0xAF,0x7B,0x92,0x9C,0x4D,0x73,0xCB,0x5A,0x8E,0x7B,0x2D,0x6B,0xEC,0x62,0x6E,0x73,0xD3,0xA4,0x6A,0x52,0x8A,0x52,0x14,0xAD,0x92,0x9C,0x51,0x94,0x72,0x94,0xF0,0x83,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x62,0x10,0xAF,0x7B,0x8A,0x4A,0x00,0x00,0x62,0x10,0x41,0x10,0x82,0x10,0x45,0x31,0x41,0x10,0x25,0x29,0x25,0x29,0x00,0x08,0x62,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,
-	0x21,0x08,0x41,0x08,0x21,0x08,0x41,0x10,0xA3,0x18,0x45,0x29,0xA7,0x39,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x00,0x00,0x00,0x00,0xEC,0x62,0xC7,0x41,0x29,0x4A,0x8E,0x7B,0x0C,0x6B,0x72,0x94,0x34,0xB5,0x2D,0x6B,0x00,0x00,0x00,0x00,0xEC,0x62,0x10,0x8C,0x31,0x8C,0x72,0x94,0x31,0x8C,0x92,0x9C,0x31,0x8C,
-	0x4D,0x73,0x51,0x94,0x8E,0x7B,0x6E,0x73,0x8E,0x83,0xF0,0x83,0x2D,0x6B,0x8E,0x7B,0xF0,0x83,0xAB,0x5A,0x4D,0x73,0x14,0xAD,0x72,0x94,0x51,0x94,0x72,0x94,0xAF,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x8E,0x7B,0xA7,0x39,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x45,0x29,0x45,0x29,0x00,0x08,0x62,0x10,
-	0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x04,0x29,0x04,0x29,0xC3,0x20,0x82,0x18,0x82,0x10,0x62,0x10,0xC3,0x18,0x21,0x08,0x41,0x10,0x41,0x08,0x20,0x08,0x00,0x08,
-	0x04,0x29,0x8A,0x52,0xF0,0x83,0x10,0x84,0xCB,0x5A,0xF0,0x83,0xCB,0x5A,0x00,0x00,0x00,0x00,0x6E,0x73,0xF4,0xA4,0xF0,0x83,0xF0,0x83,0x31,0x8C,0x51,0x94,0x31,0x8C,0x10,0x8C,0x51,0x8C,0x6E,0x73,0x10,0x8C,0xEC,0x62,0x4D,0x73,0xF0,0x83,0xAB,0x5A,0xAF,0x7B,0x2D,0x6B,0x4D,0x73,0x92,0x9C,0x92,0x9C,0x72,0x94,0x10,0x8C,0x8E,0x7B,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x0C,0x6B,0x86,0x31,0x8A,0x5A,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x01,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x82,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x41,0x10,0x00,0x00,0x21,0x08,0x21,0x08,0xA3,0x18,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x00,0x00,0x08,0x52,0x6E,0x73,0x10,0x84,0x6E,0x73,0xCB,0x62,0xC3,0x18,0x00,0x00,0x00,0x00,0x8E,0x83,0xF4,0xA4,0x8E,0x7B,0xE8,0x41,0x51,0x94,0x92,0x9C,0xEF,0x8B,
-	0x10,0x8C,0xB3,0x9C,0xAF,0x7B,0xAF,0x7B,0x10,0x84,0x6E,0x73,0xEB,0x72,0xCB,0x62,0x8E,0x83,0x6E,0x73,0xC7,0x41,0x0C,0x6B,0x92,0x9C,0x72,0x94,0x51,0x94,0xAF,0x7B,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0xA3,0x18,0x8E,0x7B,0xE4,0x20,0xCB,0x62,0x25,0x29,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0xA3,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0xA3,0x18,0xC3,0x18,0x62,0x10,0x82,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x00,0x08,0x86,0x39,0x4D,0x73,0x49,0x52,0x82,0x10,0x00,0x00,0x41,0x10,0x00,0x00,0x4D,0x73,0xD3,0xA4,0x51,0x94,0x31,0x8C,0x72,0x94,0x51,0x94,0x51,0x94,0x72,0x94,0x31,0x8C,0x31,0x8C,0xAF,0x7B,0x8E,0x83,0x72,0x94,0x6E,0x73,0x6E,0x63,0x92,0x9C,0x10,0x84,0xF0,0x83,0x92,0x9C,0x51,0x94,0x51,0x94,0x92,0x9C,0xAF,0x7B,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0xCB,0x62,0xA7,0x31,0xC7,0x39,0xC3,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x82,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x00,0x08,0x25,0x29,0x66,0x31,0x08,0x42,0x45,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x8E,0x83,0x34,0xB5,0x92,0x9C,0xB3,0x9C,0x92,0x9C,0x92,0x9C,0x92,0x9C,
-	0x51,0x94,0x10,0x8C,0x10,0x8C,0x10,0x84,0xF0,0x83,0xEC,0x62,0x10,0x84,0xD3,0x9C,0xCB,0x62,0xAB,0x5A,0x72,0x94,0xB3,0x9C,0x92,0x9C,0x92,0x9C,0xB3,0x9C,0x8E,0x7B,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x08,0xC3,0x18,0x29,0x4A,0xAB,0x5A,0x04,0x21,0x41,0x08,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x01,0x08,0x25,0x29,0x04,0x29,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xA3,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x08,0x04,0x29,0x25,0x29,0x82,0x10,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x42,0x10,0x41,0x10,0x00,0x00,0x28,0x52,0xB2,0xA4,0x0C,0x6B,0x6E,0x73,0x30,0x8C,0xAF,0x7B,0xB2,0xA4,0x72,0x94,0x51,0x94,0x6E,0x73,0xAF,0x7B,0x6E,0x73,0xC7,0x39,0x2D,0x6B,0xB2,0xA4,0x4D,0x63,0x25,0x29,0x51,0x94,0x6E,0x73,0x6A,0x52,0x92,0x9C,0xB2,0xA4,0xF0,0x83,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x42,0x10,0x00,0x08,0xE4,0x20,0x29,0x4A,0xAB,0x5A,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x10,0xA3,0x18,0x41,0x10,0x21,0x08,0x41,0x08,0x21,0x08,0x82,0x18,0x62,0x10,0x82,0x10,0x62,0x10,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0xA3,0x18,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x61,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x00,0x08,0xC3,0x18,0xC7,0x39,0xE8,0x41,0x08,0x4A,0x29,0x4A,0x10,0x8C,0x49,0x4A,0x2D,0x6B,
-	0x51,0x94,0x10,0x8C,0x51,0x94,0x10,0x8C,0x8A,0x5A,0x8A,0x5A,0xEC,0x62,0x49,0x52,0x51,0x94,0xCB,0x62,0x6E,0x73,0xB3,0x9C,0xAF,0x7B,0x51,0x94,0x72,0x94,0x8E,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x29,0x6A,0x52,0x29,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x62,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x21,0x08,0x41,0x08,0x21,0x08,0x82,0x18,0xA3,0x18,0x62,0x10,0x41,0x10,0xC3,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x86,0x31,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE4,0x20,0xE4,0x20,0x82,0x10,0x82,0x18,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x00,0x00,0xE8,0x41,0x55,0xAD,0x49,0x4A,0x66,0x31,0xC7,0x39,0x2D,0x6B,0x0C,0x6B,0x29,0x4A,0x31,0x8C,0x10,0x8C,0xF0,0x83,0xF0,0x83,0x6E,0x73,0x4D,0x73,0x49,0x4A,0x6A,0x52,0x49,0x4A,0x29,0x4A,0x4D,0x63,0x92,0x94,0x51,0x94,0x0C,0x6B,0x6E,0x73,0x6E,0x73,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x00,0x08,0x45,0x29,0x08,0x4A,0x08,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x62,0x10,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x25,0x29,0xC3,0x20,0x21,0x08,0x41,0x10,0x62,0x10,0x82,0x10,0x21,0x08,0xC3,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x21,0x08,0xA7,0x39,0x86,0x31,0x04,0x29,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x08,0x42,0xF4,0xAC,0x4D,0x73,0xAF,0x6B,0x72,0x94,0x10,0x84,0x8E,0x7B,0xF0,0x83,
-	0x10,0x8C,0xE8,0x39,0x66,0x31,0xF0,0x83,0x31,0x8C,0xAF,0x7B,0x8E,0x7B,0xAF,0x7B,0x6E,0x73,0x6E,0x73,0x10,0x84,0xEC,0x62,0xEC,0x62,0x6E,0x73,0x31,0x8C,0xEC,0x62,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x66,0x31,0x08,0x4A,0xCB,0x62,0x00,0x00,0x21,0x08,0x41,0x10,0x21,0x08,0xC3,0x18,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x20,0x82,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0xA3,0x18,0x00,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x62,0x10,0x21,0x08,0x20,0x08,0x86,0x39,0x45,0x29,0x62,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x82,0x18,0x6E,0x73,0x10,0x84,0xAF,0x7B,0x51,0x94,0x92,0x9C,0x92,0x9C,0x31,0x8C,0x10,0x84,0x8A,0x52,0x4D,0x63,0xD3,0xA4,0xF4,0xA4,0xF4,0xAC,0x35,0xAD,0xB3,0x9C,0x72,0x94,0x8E,0x83,0x10,0x8C,0xF0,0x83,0x10,0x8C,0xB3,0x9C,0x8E,0x7B,0x08,0x4A,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x08,0x82,0x18,0xA7,0x39,0x66,0x29,0xEC,0x62,0x21,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x25,0x29,0xE4,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x41,0x10,0xA3,0x18,0x62,0x10,0x00,0x08,0x41,0x08,0x82,0x18,0x42,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x8A,0x5A,0xE4,0x20,0x00,0x00,0x41,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0x49,0x52,0xE4,0x18,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x45,0x29,0x10,0x8C,0x6E,0x73,0x6E,0x73,0x10,0x84,0x51,0x94,0x72,0x94,
-	0x92,0x9C,0xD3,0xA4,0x51,0x94,0xAF,0x7B,0x8E,0x7B,0xAF,0x7B,0x4D,0x73,0xAB,0x5A,0x31,0x8C,0x51,0x94,0x51,0x94,0xD3,0xA4,0x31,0x8C,0x6E,0x73,0x72,0x94,0x8E,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x62,0x10,0x6A,0x4A,0xC7,0x39,0xC7,0x39,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x21,0x08,0xA3,0x18,0x62,0x10,0x82,0x18,0x82,0x10,
-	0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0xE4,0x20,0x62,0x10,0x21,0x08,0xC3,0x20,0x82,0x18,0x21,0x08,0x62,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0xCB,0x5A,0xC3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x86,0x39,0x04,0x29,0x00,0x08,0x21,0x08,
-	0x21,0x08,0x41,0x10,0x25,0x29,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0xA7,0x39,0xC3,0x20,0x00,0x00,0x04,0x29,0xAF,0x7B,0x31,0x8C,0x72,0x94,0xD3,0xA4,0xF4,0xA4,0x92,0x9C,0x31,0x8C,0x6E,0x73,0x4D,0x73,0x0C,0x5B,0xEC,0x62,0xCB,0x5A,0x0C,0x6B,0x6E,0x73,0xAF,0x7B,0xAF,0x7B,0xB3,0x9C,0x31,0x8C,0x0C,0x6B,0x30,0x8C,0x10,0x84,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x61,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x21,0x08,0x00,0x00,0xCB,0x62,0x29,0x4A,0xA3,0x18,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0xA3,0x18,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x25,0x21,0xE4,0x20,0x21,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x8A,0x52,0xE4,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x08,0x21,0x08,0x62,0x08,0xA3,0x18,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x28,0x52,0x2D,0x6B,0x25,0x21,0x00,0x00,0x00,0x00,0x04,0x29,0xC7,0x41,0x08,0x4A,0x86,0x39,
-	0x04,0x29,0x66,0x31,0x08,0x4A,0x28,0x52,0x6A,0x52,0xEB,0x72,0x4D,0x73,0x6E,0x73,0x6E,0x73,0xEF,0x8B,0x10,0x8C,0x51,0x94,0x92,0x9C,0xF4,0xAC,0xB3,0x9C,0x10,0x8C,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0xEC,0x62,0x86,0x39,0x00,0x00,0x62,0x10,0x41,0x10,0x82,0x10,0x62,0x10,0x62,0x10,0x82,0x18,0xA3,0x18,0xE4,0x20,0x41,0x10,0x62,0x10,
-	0x21,0x08,0x21,0x08,0xA3,0x18,0xA3,0x18,0x21,0x08,0x41,0x08,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0xA3,0x18,0x66,0x31,0x62,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xAB,0x5A,0xC3,0x20,0x00,0x08,0x21,0x08,0x45,0x29,0xA3,0x18,0x21,0x08,0x42,0x10,0x21,0x08,0x62,0x10,0xA3,0x18,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x25,0x29,0x2D,0x6B,0x0C,0x5B,0x6E,0x73,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x62,0x18,0xC3,0x20,0x66,0x31,0x66,0x31,0x08,0x4A,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x21,0x08,0x41,0x10,0x04,0x21,0xAB,0x5A,0x25,0x29,0x00,0x00,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x82,0x18,0xA3,0x18,0x82,0x10,0x66,0x31,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x20,0x2D,0x6B,0xE4,0x20,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x08,0x42,0xC3,0x18,0x21,0x08,0x21,0x10,0x82,0x18,0x41,0x10,0x21,0x08,0x82,0x18,0x41,0x10,0x21,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x86,0x39,0x6E,0x73,0xC7,0x41,0xEC,0x62,0x10,0x8C,0x0C,0x5B,0xE4,0x18,0x00,0x08,0xAB,0x5A,
-	0x4D,0x63,0x45,0x29,0x25,0x29,0x25,0x29,0x66,0x29,0x25,0x29,0xC3,0x20,0xA3,0x18,0x62,0x10,0x41,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0x45,0x29,0x49,0x4A,0x25,0x29,0x00,0x00,0xC3,0x20,0x62,0x10,0x00,0x08,0x01,0x08,0x41,0x10,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0xC3,0x20,
-	0x82,0x10,0x45,0x31,0xC3,0x18,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x10,0xC3,0x18,0x62,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x61,0x10,0xA3,0x18,0xC3,0x18,0x42,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xCB,0x62,0x72,0x94,0x6A,0x4A,0xA7,0x39,0xAF,0x7B,0xF0,0x83,0x04,0x21,0x00,0x00,0xAF,0x7B,0x10,0x84,0x86,0x39,0x86,0x31,0xC7,0x39,0xC7,0x39,0xE8,0x41,0x08,0x42,0x29,0x4A,0xC7,0x39,0x66,0x31,0x66,0x31,0x86,0x31,0x45,0x31,0x45,0x29,0x04,0x21,0x82,0x18,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x00,0x41,0x00,0x62,0x00,0x62,0x00,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x08,0xC3,0x18,0x25,0x29,0xAB,0x5A,0xC7,0x41,0x00,0x00,0x04,0x21,0x41,0x10,0x86,0x31,0x04,0x29,0x00,0x08,0x62,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x08,0x62,0x10,0x82,0x18,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x20,0x08,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x08,0x4A,0xE4,0x20,0x00,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0xC3,0x20,0x62,0x10,0xA3,0x18,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x00,0x00,0x25,0x21,0xCB,0x62,0x6E,0x73,0xEC,0x5A,0x2D,0x6B,0xAF,0x7B,0x86,0x39,0x00,0x00,0xCB,0x62,
-	0x4D,0x73,0xC3,0x18,0x45,0x29,0xA7,0x39,0xA7,0x39,0xA7,0x39,0x86,0x39,0xA7,0x39,0xC7,0x39,0x04,0x29,0x62,0x10,0xC7,0x39,0xE8,0x41,0x08,0x42,0xC7,0x39,0x86,0x39,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x42,0x60,0x21,0x70,0x42,0x60,0x21,0x70,0x42,0x30,0x41,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x29,0x45,0x29,0x08,0x42,0xE8,0x41,0x00,0x00,0x42,0x10,0x62,0x10,0x25,0x21,0xE4,0x20,0x21,0x08,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0xC3,0x20,0x42,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xAB,0x5A,0xC3,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC7,0x41,0xCB,0x52,0x86,0x31,0x0C,0x6B,0x4D,0x73,0x8E,0x83,0x0C,0x6B,0x21,0x08,0x62,0x10,0xAB,0x5A,0xAB,0x5A,0x8A,0x5A,0x45,0x31,0xA7,0x39,0x86,0x39,0x86,0x39,0xA7,0x39,0xE8,0x39,0x45,0x31,0x04,0x21,0x86,0x39,0xA7,0x39,0xA7,0x39,0xC7,0x41,0x04,0x21,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x20,0x01,0xC0,0x02,0xD8,0x01,0xA0,0x42,0x60,0x42,0x60,0x21,0x70,0x21,0x70,0x21,0x70,0x21,0x88,0x21,0x88,0x21,0x70,0x21,0x88,0x42,0x48,0x41,0x10,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x20,0x02,0xD8,0x02,0xD8,0x01,0xC8,0x01,0xC8,0x02,0xB8,0x21,0x88,0x01,0x98,0x01,0xA0,0x01,0xA0,0x21,0x70,0x41,0x20,0x41,0x20,
-	0x41,0x20,0x42,0x28,0x42,0x28,0x41,0x20,0x42,0x28,0x41,0x20,0x42,0x28,0x21,0x88,0x21,0x88,0x41,0x10,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x00,0x08,0x04,0x29,0x29,0x42,0xE8,0x39,0x66,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x00,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x41,0x10,0x62,0x10,0xC3,0x20,0xC3,0x18,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x8A,0x52,0xE4,0x18,0x00,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x6A,0x52,0x14,0xAD,0xEC,0x62,0xC7,0x41,0x8A,0x5A,0x6E,0x73,0xAF,0x7B,0xC7,0x39,0x00,0x00,
-	0xE8,0x41,0x72,0x94,0x2D,0x6B,0x86,0x31,0x25,0x29,0x86,0x31,0xA7,0x39,0x86,0x31,0x86,0x39,0xC7,0x39,0xC7,0x41,0xA7,0x39,0xA7,0x31,0xC7,0x39,0x86,0x39,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x42,0x48,0x42,0x60,0x01,0xA0,0x01,0xC0,0x01,0xC0,0x02,0xB8,0x02,0xB8,0x01,0xC0,0x02,0xB8,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC8,0x02,0xA8,0x42,0x30,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x21,0x28,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB8,0x02,0xB8,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x02,0xB8,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xA0,0x01,0xC8,0x01,0xA0,0x41,0x00,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x08,0x04,0x21,0x66,0x31,0xCB,0x62,0x29,0x4A,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x18,0x08,0x42,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x62,0x10,0xA3,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x49,0x52,0xC3,0x20,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0xD3,0xA4,0x72,0x94,0xAF,0x6B,0x29,0x42,0x0C,0x6B,0xD0,0x73,0x6E,0x73,0x21,0x08,0x00,0x00,0xEC,0x62,0xF0,0x83,0x6A,0x52,0x6A,0x4A,0xC7,0x39,0x45,0x29,0x86,0x39,0x86,0x39,0xA7,0x39,0xA7,0x39,0xA7,0x39,0xA7,0x39,0xC7,0x41,0x82,0x18,0x00,0x00,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x42,0x10,0x41,0x10,0x62,0x08,0x62,0x00,0x41,0x00,
-	0x41,0x00,0x41,0x00,0x41,0x00,0x42,0x28,0x01,0xA0,0x02,0xA8,0x01,0xA0,0x01,0xA0,0x01,0xA0,0x01,0xA0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB8,0x02,0xB8,0x01,0xA0,0x01,0xA0,0x02,0xA8,0x02,0xB0,0x02,0xB8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xB8,0x23,0xC0,0x21,0x88,0x62,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x10,
-	0x00,0x00,0x86,0x31,0xA7,0x39,0xAB,0x5A,0xA7,0x39,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x82,0x10,0xE4,0x20,0x41,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x49,0x4A,0xC3,0x20,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x21,0x08,0x00,0x08,0x4D,0x73,0x92,0x9C,0x72,0x94,0x31,0x8C,0x0C,0x6B,0xCB,0x62,0x2D,0x6B,0xC7,0x39,
-	0x00,0x00,0x82,0x10,0xCB,0x62,0x4D,0x73,0xAF,0x7B,0xF0,0x7B,0x45,0x31,0x86,0x39,0xA7,0x39,0xA7,0x39,0x86,0x39,0x86,0x39,0x08,0x42,0xE4,0x20,0x00,0x00,0x86,0x39,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x70,0x01,0xC0,0x01,0x98,0x21,0x88,0x21,0x70,0x21,0x70,0x21,0x70,0x21,0x70,0x02,0xA8,0x02,0xB8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB8,
-	0x01,0xC0,0x01,0xC0,0x01,0xC0,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x01,0xC8,0x42,0x60,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC7,0x41,0x29,0x42,0x49,0x52,0x25,0x29,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x04,0x21,0xC3,0x18,
-	0x00,0x08,0x00,0x08,0x41,0x08,0x62,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xCB,0x5A,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0xA1,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x00,0x00,0x62,0x10,0x10,0x8C,0x51,0x94,0x31,0x8C,0x10,0x8C,0xAF,0x7B,0x4D,0x63,0x6E,0x73,0xE4,0x20,0x00,0x00,0x62,0x18,0x49,0x4A,0x08,0x4A,0x2D,0x6B,0x6A,0x52,0x45,0x31,0xC7,0x39,0xC7,0x39,0x86,0x31,0xE8,0x41,0x66,0x31,0x00,0x00,0xC3,0x20,0x10,0x84,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x70,0x02,0xD8,0x01,0xC0,0x23,0xC0,0x01,0xC8,
-	0x01,0xC8,0x01,0xC8,0x01,0xC0,0x02,0xB8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x01,0xC0,0x21,0x70,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x00,0x49,0x52,0x08,0x42,0x08,0x4A,0x45,0x29,0x00,0x00,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x45,0x31,0x82,0x10,0xC3,0x20,0x25,0x29,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x82,0x18,0xCB,0x62,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0xA1,0x18,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xC3,0x18,0xA7,0x39,0x51,0x94,0x10,0x84,0x10,0x84,0x92,0x9C,0x31,0x8C,0xAF,0x7B,
-	0xC7,0x39,0x00,0x00,0x00,0x00,0x82,0x10,0x86,0x39,0x66,0x31,0x66,0x31,0x86,0x39,0x86,0x39,0xA7,0x39,0xC7,0x41,0xC7,0x39,0x00,0x00,0x00,0x00,0x10,0x84,0x10,0x8C,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x70,0x01,0xC8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xC0,0x02,0xD8,0x41,0x20,0x41,0x00,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xEC,0x62,0xA7,0x39,0x6A,0x52,0xC7,0x41,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x18,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x42,0x10,0x62,0x10,
-	0x25,0x21,0x86,0x31,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0xA3,0x18,0xAB,0x5A,0x62,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x42,0x10,0x21,0x08,0x41,0x10,0xC3,0x18,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x08,0x4A,0x82,0x18,0x49,0x52,0xD3,0xA4,0x51,0x94,0xAF,0x7B,0xF4,0xA4,0x0C,0x6B,0x04,0x29,0xAF,0x6B,0x25,0x29,0x00,0x00,0xC3,0x20,0x45,0x31,0xE4,0x20,0xA7,0x39,0x86,0x31,0x66,0x31,0x08,0x42,0xE4,0x20,0x00,0x00,0x8A,0x52,0x14,0xA5,0x8E,0x7B,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x42,0x60,0x23,0xD0,0x02,0xA8,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xC8,0x42,0x60,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0x00,0x08,0x4D,0x73,0xA7,0x31,0x08,0x42,0x6A,0x52,0x00,0x00,0x21,0x08,0x41,0x10,0x62,0x10,0x82,0x10,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xA1,0x18,0xEC,0x62,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x25,0x21,0x41,0x10,0x41,0x10,0xA3,0x18,0x00,0x00,0xE8,0x41,0x0C,0x6B,0xE4,0x20,0xEC,0x62,0x72,0x94,0x0C,0x6B,0x8E,0x7B,0x10,0x8C,
-	0x6E,0x73,0xF4,0xAC,0x86,0x31,0x00,0x00,0x21,0x08,0x00,0x08,0x04,0x29,0x08,0x4A,0xE8,0x41,0x86,0x39,0x25,0x29,0x00,0x00,0xE4,0x20,0xD3,0xA4,0x92,0x9C,0x8E,0x7B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0x98,0x01,0xC0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xC8,0x42,0x60,0x62,0x00,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x41,0x10,0x4D,0x73,0x08,0x42,0x82,0x10,0x6E,0x73,0x41,0x10,0xA3,0x18,0xA1,0x18,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x01,0x08,0xEC,0x62,0x0C,0x6B,0x04,0x29,0x66,0x31,0x66,0x31,0x04,0x21,0xA3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x00,0x08,0x21,0x08,0x21,0x08,0x45,0x29,0x6E,0x73,0x29,0x4A,0x00,0x00,0xAF,0x7B,0x10,0x8C,0x2D,0x6B,0x92,0x9C,0xD3,0xA4,0x72,0x94,0xC3,0x18,0xA3,0x18,0x45,0x29,0x21,0x08,0x41,0x08,0xC3,0x18,0xC3,0x20,0x82,0x18,0x20,0x08,0x00,0x00,0xE4,0x20,0xB3,0x9C,0x92,0x9C,0x8E,0x7B,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x48,0x01,0xC0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xD8,0x21,0x28,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x25,0x21,0xF0,0x7B,0x86,0x39,0x00,0x00,0x8E,0x7B,0xAB,0x5A,0x62,0x10,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x18,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x62,0x10,0x62,0x10,
-	0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x62,0x10,0x45,0x29,0xC3,0x18,0x29,0x4A,0x49,0x4A,0x08,0x4A,0x8A,0x52,0x8A,0x5A,0x08,0x4A,0x86,0x31,0x42,0x10,0xA3,0x18,0x62,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x66,0x29,0x21,0x10,0xA3,0x18,0x8A,0x52,0x86,0x31,0xAF,0x7B,0x45,0x29,0x6A,0x52,0x35,0xAD,0x51,0x94,0x31,0x84,
-	0x72,0x94,0x10,0x8C,0x21,0x08,0x04,0x21,0xC7,0x39,0x82,0x10,0x42,0x10,0x41,0x08,0x00,0x08,0x21,0x08,0xA3,0x18,0xA3,0x18,0x41,0x10,0xAF,0x7B,0x92,0x9C,0x8E,0x7B,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x00,0x21,0x70,0x01,0xC8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,
-	0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xD8,0x21,0x28,0x41,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x66,0x31,0x72,0x94,0x66,0x31,0x00,0x00,0xE8,0x41,0x10,0x84,0x00,0x00,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x41,0x10,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xE4,0x20,0x25,0x29,0x82,0x18,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x39,0x25,0x29,0x01,0x08,0x62,0x10,0xE4,0x20,0x29,0x42,0xEC,0x5A,
-	0x2D,0x6B,0xA3,0x18,0x21,0x08,0x41,0x08,0x62,0x10,0x69,0x42,0x82,0x18,0x00,0x00,0x6A,0x52,0xAB,0x52,0x6A,0x52,0x4D,0x73,0x29,0x4A,0x10,0x8C,0xB2,0xA4,0x10,0x8C,0x14,0xA5,0x49,0x52,0x00,0x00,0x04,0x29,0x8A,0x52,0x45,0x31,0x04,0x21,0xA7,0x39,0xE4,0x20,0x04,0x29,0xC7,0x41,0x45,0x29,0x00,0x00,0x6E,0x73,0x92,0x9C,0xAF,0x7B,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x21,0x70,0x01,0xC0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,
-	0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,
-	0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x01,0xC0,0x01,0xA0,0x41,0x20,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x00,0x86,0x39,0xE8,0x41,0x00,0x00,0x82,0x18,0x04,0x29,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0xC3,0x18,0x61,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,
-	0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE8,0x41,0x04,0x29,0x00,0x00,0xC3,0x20,0x08,0x4A,0x08,0x42,0x86,0x31,0xC3,0x20,0x41,0x08,0x41,0x08,0x62,0x10,0x00,0x08,0xE4,0x18,0xE4,0x18,0x00,0x08,0x6A,0x52,0x6E,0x73,0xC7,0x39,0xCB,0x62,0xAB,0x5A,0x6A,0x52,0x0C,0x6B,0x10,0x84,
-	0xD3,0xA4,0xA3,0x18,0x00,0x00,0x04,0x21,0xC7,0x41,0x62,0x10,0x45,0x31,0x08,0x4A,0x04,0x21,0x25,0x29,0x08,0x42,0x66,0x31,0x00,0x00,0x4D,0x73,0xF4,0xA4,0x6E,0x73,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x00,0x21,0x70,0x01,0xC0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,
-	0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x01,0xC8,0x21,0x70,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x10,0x00,0x08,0x62,0x08,0x08,0x42,0xCB,0x62,0xC3,0x18,0x00,0x00,0x00,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x10,0x82,0x10,0x41,0x08,0x41,0x10,0xA3,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x82,0x10,0xC3,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x08,0x49,0x4A,0xCB,0x5A,0x86,0x39,0xE2,0x20,0xE2,0x20,
-	0x40,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x21,0x08,0x62,0x18,0xC3,0x18,0x00,0x00,0x6E,0x73,0xAB,0x5A,0xCB,0x5A,0x04,0x29,0x66,0x31,0x0C,0x6B,0x6A,0x52,0x14,0xAD,0x10,0x8C,0x00,0x00,0x62,0x10,0x25,0x29,0x62,0x10,0x00,0x00,0x66,0x31,0xE8,0x41,0x25,0x29,0x04,0x21,0xE8,0x41,0x86,0x39,0x00,0x00,0x49,0x52,0x35,0xAD,0x2D,0x6B,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x70,0x01,0xC0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xC0,0x42,0x30,0x41,0x00,0x41,0x10,0x41,0x08,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,
-	0x08,0x4A,0x72,0x94,0xC7,0x39,0x41,0x08,0x21,0x08,0x21,0x10,0x61,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0xA3,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0x62,0x10,0x62,0x10,0x82,0x18,0x62,0x10,0x62,0x10,0x82,0x18,0x21,0x08,0xA3,0x18,0x82,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0x21,0x08,0x00,0x00,0x66,0x31,0x0C,0x6B,0xE8,0x41,0x00,0x08,0x60,0x08,0xE2,0x20,0x83,0x39,0xE2,0x20,0x61,0x10,0x41,0x10,0x42,0x10,0x20,0x08,0xC3,0x20,0x04,0x29,0x00,0x00,0x0C,0x6B,0x6E,0x73,0x6A,0x52,0xEC,0x62,0x8A,0x52,0x6E,0x73,0x8A,0x5A,0xAF,0x7B,
-	0x08,0x42,0x00,0x00,0x82,0x10,0xA3,0x18,0x86,0x39,0x29,0x4A,0x25,0x29,0x66,0x31,0xC3,0x18,0xE4,0x20,0x08,0x42,0xC7,0x39,0x00,0x00,0x86,0x31,0xF4,0xA4,0x4D,0x73,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x21,0x70,0x01,0xC0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,
-	0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x01,0xC0,0x42,0x28,0x41,0x00,0x41,0x00,0x42,0x38,0x21,0x88,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0xEC,0x62,0xAF,0x7B,0x00,0x00,0x00,0x00,0x62,0x10,0x21,0x08,0x45,0x29,0xA3,0x18,0x42,0x10,0x45,0x29,0x62,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x82,0x18,0xA3,0x18,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0xA3,0x18,0x62,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0xA3,0x18,0xA3,0x18,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0xC7,0x41,0x0C,0x6B,0x25,0x29,0x00,0x00,0x41,0x08,0x61,0x18,0xE2,0x20,0xE2,0x20,
-	0xA1,0x18,0x61,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0x8A,0x5A,0xD3,0x9C,0xCB,0x62,0x2D,0x6B,0xEC,0x62,0x6E,0x73,0xF0,0x83,0x6A,0x52,0x41,0x10,0x00,0x08,0x45,0x29,0x86,0x39,0xC7,0x39,0x66,0x29,0x45,0x31,0x45,0x31,0x21,0x08,0xE4,0x20,0xE8,0x41,0xE8,0x41,0x21,0x08,0x25,0x21,0xF4,0xAC,0x8E,0x7B,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x00,0x21,0x70,0x01,0xC0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,
-	0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xC0,0x21,0x28,0x62,0x00,0x62,0x00,0x42,0x48,0x02,0xD8,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,
-	0x2D,0x6B,0x0C,0x5B,0x41,0x10,0x41,0x10,0x82,0x10,0x21,0x08,0x62,0x10,0x82,0x10,0x41,0x10,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x25,0x29,0x04,0x29,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x62,0x10,0x62,0x10,0x45,0x29,0x62,0x10,0xC3,0x18,0x62,0x10,0x21,0x08,0x62,0x08,0xA3,0x18,0x41,0x10,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x20,0x6A,0x52,0xA3,0x18,0x61,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x8A,0x5A,0xD3,0xA4,0xF0,0x7B,0xAB,0x52,0x0C,0x6B,0x4D,0x73,0x10,0x8C,0xEC,0x62,
-	0x41,0x10,0x82,0x10,0x66,0x31,0x86,0x31,0x86,0x39,0x04,0x29,0x86,0x39,0x86,0x39,0x25,0x29,0xC3,0x20,0xA7,0x39,0xC7,0x41,0x21,0x08,0x82,0x10,0x72,0x94,0x8E,0x7B,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x00,0x21,0x88,0x01,0xC0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xC0,0x21,0x70,0x41,0x00,0x41,0x00,0x42,0x38,0x02,0xB0,
-	0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x10,0xCB,0x62,0x04,0x29,0x28,0x52,0xA7,0x39,0x00,0x00,0x62,0x10,0x82,0x10,0x62,0x10,0x82,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,
-	0x82,0x18,0x41,0x10,0x41,0x10,0xE2,0x20,0xC3,0x18,0x21,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x66,0x31,0xC3,0x18,0x21,0x10,0x01,0x08,0x41,0x10,0xA3,0x18,0xC3,0x20,0x21,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x41,0x10,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x61,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x00,0x00,0x08,0x4A,0x92,0x9C,0x51,0x8C,0x8E,0x7B,0x2D,0x6B,0x6E,0x73,0x92,0x94,0x45,0x29,0x00,0x00,0x25,0x29,0x04,0x29,0x25,0x29,0x86,0x39,0xA3,0x18,0x86,0x31,0xC7,0x41,0xC7,0x39,0x04,0x29,0xA7,0x39,0xC7,0x39,0x41,0x08,0x21,0x08,0xF0,0x83,0xF0,0x83,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x00,0x21,0x88,0x01,0xC0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xC0,0x01,0xA0,0x62,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x20,
-	0xC7,0x39,0x00,0x00,0x66,0x31,0x45,0x31,0x00,0x00,0x62,0x10,0x82,0x10,0x41,0x10,0x82,0x10,0x62,0x10,0x82,0x10,0xC3,0x20,0x21,0x08,0x21,0x08,0x21,0x08,0x62,0x10,0x62,0x10,0x82,0x10,0x41,0x08,0xC3,0x18,0xE4,0x20,0x82,0x10,0x04,0x21,0x00,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x82,0x10,0x41,0x08,0xA3,0x18,0x04,0x29,
-	0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xC3,0x18,0x82,0x18,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x00,0x00,0xE8,0x41,0x92,0x9C,0x92,0x9C,0x72,0x94,0xAF,0x6B,0x4D,0x73,0xF4,0xA4,0xE4,0x20,
-	0x00,0x00,0x86,0x39,0x04,0x21,0x04,0x29,0xE4,0x20,0x41,0x10,0x86,0x39,0x86,0x39,0x45,0x29,0x45,0x31,0xC7,0x41,0x66,0x31,0x00,0x08,0x00,0x00,0x8E,0x83,0x10,0x8C,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x00,0x42,0x38,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xC0,0x01,0xA0,0x82,0x00,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x82,0x18,0xA3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x08,0x41,0x10,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0xC3,0x18,0xA3,0x18,0x25,0x29,0x82,0x10,0x41,0x10,
-	0x41,0x08,0x62,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0x41,0x10,0xC3,0x20,0x82,0x10,0x66,0x29,0x82,0x10,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x66,0x31,0x04,0x29,0x01,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x00,0x00,0x45,0x31,0x72,0x94,0x8E,0x83,0xEF,0x8B,0x31,0x84,0x10,0x84,0x31,0x8C,0x41,0x10,0x21,0x08,0xC7,0x41,0xE4,0x20,0x86,0x31,0x45,0x29,0x82,0x10,0x66,0x31,0x45,0x31,0x45,0x29,0x66,0x31,0xA7,0x39,0xC7,0x39,0x82,0x18,0x00,0x00,0xCB,0x62,0x10,0x84,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x08,0x02,0xB0,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xC0,0x01,0xA0,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x62,0x10,0xC3,0x18,0x62,0x10,0x00,0x08,0x04,0x21,0xE4,0x20,0x21,0x08,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0xA3,0x18,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0xA3,0x18,0x21,0x08,0x21,0x08,0x41,0x08,0x82,0x10,0xA3,0x18,0x62,0x10,0x41,0x10,0x61,0x10,0x21,0x08,0x21,0x08,0xA3,0x18,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x08,0x86,0x31,0xA7,0x31,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x10,0x00,0x08,0xC3,0x20,0xB3,0x9C,0x25,0x29,0x82,0x18,0x72,0x94,0xF4,0xA4,0x0C,0x5B,0x00,0x00,
-	0xE4,0x20,0xE8,0x41,0x25,0x29,0x08,0x42,0xA7,0x39,0x04,0x29,0xC7,0x39,0x86,0x39,0xC7,0x39,0xE4,0x20,0x66,0x31,0xE8,0x41,0xE4,0x20,0x00,0x00,0x6A,0x52,0x72,0x94,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x10,0x02,0xB0,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xC0,0x01,0x98,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0x0C,0x6B,0x00,0x00,0x21,0x08,0x21,0x08,0xC3,0x20,0xC3,0x18,0x21,0x08,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x00,0x00,0x66,0x29,0x29,0x42,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x45,0x29,0x29,0x42,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x25,0x29,0x08,0x4A,0x00,0x00,0x41,0x10,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x08,0x41,0x10,0x10,0x8C,0x2D,0x6B,0xCB,0x5A,0x92,0x9C,0xD3,0xA4,0xC7,0x41,0x00,0x00,0x45,0x31,0xE8,0x41,0x86,0x31,0xC7,0x41,0x86,0x39,0x25,0x21,0xC7,0x41,0x25,0x29,0x04,0x29,0xC3,0x18,0x25,0x29,0xC7,0x39,0xC3,0x18,0x00,0x00,0x82,0x10,0x49,0x52,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x10,0x02,0xB8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xC0,0x01,0xA0,0x62,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0xA3,0x18,
-	0x86,0x39,0x00,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x82,0x18,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x82,0x18,0xA3,0x18,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xA3,0x18,0x29,0x4A,0x00,0x08,0x62,0x10,0x45,0x31,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x42,0x10,0x41,0x08,0x00,0x08,0x2D,0x6B,0xD3,0x9C,0x72,0x94,0xD3,0xA4,0xD3,0x9C,0xA3,0x18,0x00,0x00,
-	0x86,0x31,0xC7,0x39,0xC7,0x39,0x86,0x39,0x45,0x31,0xC3,0x20,0xA7,0x39,0x45,0x29,0x45,0x31,0xC7,0x39,0xC7,0x41,0xA7,0x39,0x86,0x31,0x62,0x10,0x20,0x08,0x49,0x4A,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x00,0x41,0x10,0x02,0xB8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x01,0xC0,0x01,0x98,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xC3,0x18,0x00,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0x82,0x18,0x82,0x18,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0x82,0x18,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x8A,0x52,0xA3,0x18,0x00,0x00,0xA3,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x00,0x00,0xCB,0x62,0x72,0x94,0x31,0x8C,0x2D,0x6B,0x49,0x52,0x21,0x08,0x82,0x10,0x45,0x29,0xA7,0x39,0xC7,0x39,0xC7,0x39,0x66,0x31,0xC3,0x20,0x86,0x39,0xA7,0x39,0xA7,0x39,0xE4,0x20,0x66,0x31,0x86,0x39,0x29,0x4A,0xE4,0x20,0xC3,0x20,0x31,0x8C,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x10,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,
-	0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x01,0xC0,0x01,0xA0,0x62,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x08,0x66,0x31,
-	0x6A,0x52,0x00,0x00,0xE4,0x18,0x04,0x21,0x01,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0x61,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x82,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0x49,0x4A,0x65,0x21,0x00,0x00,0x62,0x10,0x61,0x10,0x21,0x08,0x41,0x10,0x21,0x10,0x21,0x08,0x41,0x08,0x41,0x08,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x49,0x4A,0x92,0x9C,0x72,0x94,0x2D,0x6B,0xE8,0x41,0x21,0x08,0x82,0x18,
-	0xE4,0x20,0xA7,0x39,0x86,0x39,0xA7,0x39,0x86,0x31,0x04,0x21,0x86,0x39,0x66,0x31,0xA7,0x39,0x45,0x31,0x86,0x39,0xE8,0x41,0x04,0x29,0x00,0x00,0xA3,0x18,0x6E,0x73,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x10,0x02,0xA8,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB8,0x02,0xB0,0x21,0x28,0x41,0x00,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0x08,0x42,0x00,0x00,0xC3,0x20,0x04,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x21,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x62,0x10,
-	0x82,0x10,0xC3,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x82,0x10,0xC3,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0xC7,0x41,0xE8,0x41,0x00,0x00,0xC3,0x18,0x66,0x31,0x61,0x10,0x01,0x08,0xA3,0x18,
-	0x62,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,0x21,0x08,0x41,0x10,0x00,0x00,0xA7,0x39,0x92,0x9C,0x10,0x8C,0x35,0xAD,0x8A,0x52,0x00,0x00,0x04,0x21,0x04,0x29,0xC7,0x39,0x86,0x39,0xE8,0x41,0x66,0x31,0x45,0x31,0xC7,0x39,0x86,0x39,0x66,0x31,0x66,0x31,0x04,0x29,0xE4,0x20,0xC3,0x20,0x21,0x08,0x21,0x08,0xCB,0x62,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x10,0x02,0xB0,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xD8,0x42,0x60,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x29,0x4A,
-	0xE8,0x41,0x00,0x08,0x00,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0xC3,0x18,0x25,0x29,0x21,0x10,0x41,0x08,0x62,0x10,0x82,0x18,0x41,0x08,0x41,0x10,0x45,0x29,0x41,0x10,0x21,0x08,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x82,0x18,0x41,0x08,0x41,0x10,0x45,0x29,0x41,0x10,0x21,0x08,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x04,0x29,0x8A,0x5A,0x21,0x08,0x41,0x08,0xC7,0x39,0xE4,0x20,0x00,0x08,0x82,0x18,0xA3,0x18,0x82,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0xC3,0x18,0xA3,0x18,0x42,0x10,0x00,0x00,0x45,0x31,0x92,0x9C,0x31,0x84,0xF4,0xA4,0xC7,0x39,0x00,0x00,0x04,0x21,
-	0x04,0x29,0xA7,0x39,0xC7,0x39,0x08,0x42,0x66,0x31,0x45,0x29,0xA7,0x39,0x86,0x39,0xA7,0x39,0xC7,0x41,0x82,0x10,0x00,0x00,0x82,0x10,0x62,0x10,0x00,0x00,0xCB,0x62,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x10,0x02,0xA8,0x02,0xB8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xD8,0x42,0x60,0x41,0x00,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0xCB,0x62,0x29,0x42,0x00,0x00,0x82,0x10,0xA3,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x82,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x25,0x29,0x62,0x10,0xA3,0x18,0x62,0x10,0x41,0x08,0x41,0x08,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x25,0x29,0x82,0x10,0xA3,0x18,0x62,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x8A,0x52,0xA3,0x18,0x00,0x08,0xA7,0x39,0x45,0x29,0x41,0x10,0x41,0x10,
-	0x25,0x19,0x04,0x21,0x82,0x18,0x41,0x10,0xE4,0x20,0x25,0x29,0xC3,0x20,0xA3,0x18,0x00,0x00,0x41,0x10,0x6E,0x73,0x51,0x94,0xB3,0x9C,0x04,0x29,0x21,0x08,0xE4,0x20,0x86,0x39,0xC7,0x39,0xA7,0x39,0xA7,0x39,0x86,0x31,0x45,0x29,0xA7,0x39,0x66,0x31,0x86,0x31,0xE8,0x41,0x86,0x31,0x21,0x08,0x00,0x08,0xA1,0x18,0x20,0x08,0x49,0x52,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0x98,0x01,0xC0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB8,0x02,0xA8,0x42,0x48,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0xAB,0x5A,
-	0xE8,0x41,0x41,0x08,0x04,0x29,0x04,0x29,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA1,0x18,0x62,0x10,0x82,0x18,0x62,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA1,0x18,0x62,0x10,0x82,0x18,0x62,0x18,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x45,0x29,0x82,0x10,0x00,0x00,0x45,0x31,0xC6,0x39,0x04,0x29,0x82,0x18,0x25,0x29,0xC3,0x20,0x42,0x10,0x21,0x08,0xE4,0x20,0x45,0x29,0xA3,0x18,0xA3,0x18,0x21,0x08,0x00,0x00,0xC7,0x41,0xF4,0xAC,0x31,0x8C,0x41,0x08,0x82,0x10,0xC3,0x20,
-	0x8A,0x52,0xE8,0x41,0x86,0x31,0xA7,0x39,0x86,0x39,0x86,0x39,0xC7,0x39,0x66,0x31,0x25,0x29,0x66,0x31,0xA7,0x39,0xEC,0x62,0x25,0x21,0x21,0x08,0x82,0x10,0x82,0x18,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x00,0x42,0x48,0x02,0xD8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,
-	0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB8,0x21,0x28,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x82,0x18,0x6E,0x73,0xA7,0x39,0x41,0x08,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x21,0x08,0x21,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x29,0x25,0x21,0x00,0x00,0xE4,0x20,0x08,0x4A,0x04,0x21,0xC3,0x18,
-	0x04,0x29,0xC3,0x18,0x62,0x10,0x62,0x10,0x04,0x29,0x45,0x29,0xA3,0x18,0xC3,0x20,0x00,0x08,0x00,0x00,0xCB,0x62,0x55,0xB5,0x4D,0x73,0x00,0x00,0xA3,0x18,0xC3,0x18,0x86,0x39,0xA7,0x39,0xA7,0x39,0xC7,0x39,0xA7,0x39,0x86,0x39,0xA7,0x39,0xA7,0x39,0x45,0x31,0x66,0x31,0x86,0x39,0x49,0x4A,0x86,0x39,0xA1,0x18,0xA3,0x18,0x04,0x21,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x00,0x42,0x60,0x01,0xC8,0x02,0xA8,0x02,0xB0,0x02,0xA8,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xC0,0xA3,0x18,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xA3,0x18,0x2D,0x6B,
-	0x86,0x39,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x21,0x25,0x29,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x21,0x25,0x29,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0x49,0x52,0x00,0x00,0x00,0x00,0x45,0x29,0x86,0x31,0x25,0x29,0x25,0x21,0xC3,0x20,0x61,0x10,0x62,0x08,0xC3,0x20,0x04,0x29,0xC3,0x18,0xA3,0x18,0x21,0x08,0x00,0x00,0x0C,0x6B,0xF0,0x83,0xC3,0x18,0x41,0x10,0xE4,0x20,0xE4,0x20,
-	0xA7,0x39,0x86,0x39,0xA7,0x39,0xC7,0x39,0xA7,0x39,0xA7,0x39,0x86,0x39,0x66,0x31,0x86,0x31,0xC7,0x39,0x86,0x39,0x25,0x29,0x04,0x21,0xA3,0x18,0x82,0x18,0x25,0x29,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x00,0x42,0x60,0x01,0xC8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x01,0xC0,0x02,0xD8,0x42,0x30,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x08,0x08,0x4A,0x6A,0x4A,0xA3,0x18,0xC7,0x41,0xA3,0x18,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x00,0x00,0x66,0x31,0x45,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0x45,0x31,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xA3,0x18,0xAB,0x5A,0x41,0x10,0x00,0x00,0x21,0x08,0x45,0x29,0x66,0x31,
-	0xC3,0x20,0xE4,0x20,0xA3,0x10,0x82,0x18,0x04,0x21,0xC3,0x18,0xC3,0x20,0x42,0x10,0x41,0x08,0x00,0x00,0xA7,0x39,0xAF,0x6B,0x00,0x08,0x21,0x08,0xA3,0x18,0x04,0x29,0xA7,0x39,0x86,0x31,0xA7,0x39,0xA7,0x39,0xC7,0x39,0xA7,0x39,0xA7,0x39,0x86,0x39,0xA7,0x39,0x86,0x39,0xA7,0x39,0x86,0x39,0xE4,0x20,0x82,0x10,0xA3,0x18,0xA3,0x18,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x00,0x21,0x70,0x23,0xD0,0x02,0xA8,0x02,0xA8,0x02,0xA8,
-	0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,
-	0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB8,0x01,0xC8,0x01,0xC0,0x01,0xC8,0x01,0xA0,0x42,0x60,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x08,0x62,0x10,0xAF,0x7B,0x28,0x52,
-	0x00,0x00,0x0C,0x5B,0x8E,0x7B,0x62,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x08,0x21,0x10,0x41,0x10,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x82,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x10,
-	0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xEC,0x62,0x62,0x10,0x00,0x00,0xC3,0x20,0x04,0x21,0xA3,0x18,0x62,0x10,0x62,0x18,0xC3,0x20,0xC3,0x18,0xE4,0x20,0x82,0x10,0xA3,0x18,0x42,0x10,0x41,0x10,0x00,0x00,0x04,0x29,0xF0,0x83,0xA3,0x18,0x41,0x10,0xA3,0x18,0x04,0x29,
-	0xC7,0x39,0xA7,0x39,0xA7,0x39,0x86,0x39,0x86,0x39,0xC7,0x41,0x86,0x39,0xA7,0x39,0x86,0x39,0x86,0x31,0xA7,0x39,0x86,0x31,0xE4,0x20,0xC3,0x18,0xE4,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x42,0x60,0x01,0xC8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,
-	0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB8,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x02,0xD8,0x01,0xC8,0x02,0xB8,0x01,0x98,0x21,0x88,0x42,0x28,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x82,0x18,0x31,0x8C,0x49,0x4A,0x00,0x00,0xC3,0x20,0x72,0x94,0x82,0x10,0x00,0x08,0x41,0x10,0x82,0x18,0xE4,0x20,0x41,0x08,0x41,0x08,0x82,0x18,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0xA3,0x18,0xA3,0x18,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xA3,0x18,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xA3,0x18,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0xAB,0x52,0x45,0x29,0x00,0x00,0xE4,0x20,0x45,0x29,0x00,0x08,
-	0x62,0x10,0x41,0x10,0x82,0x18,0xA3,0x18,0xC3,0x18,0xC3,0x18,0x62,0x10,0x21,0x10,0x41,0x10,0x00,0x00,0x45,0x31,0x2D,0x6B,0x21,0x08,0x82,0x10,0x04,0x29,0xE4,0x20,0x66,0x31,0xC7,0x39,0xA7,0x39,0x04,0x29,0x25,0x29,0x86,0x31,0xA7,0x39,0x66,0x31,0x66,0x31,0x86,0x31,0xC7,0x41,0xC7,0x39,0xE4,0x20,0x62,0x10,0xC3,0x20,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x70,0x01,0xC8,0x02,0xA8,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x01,0xC8,0x01,0xC0,
-	0x01,0xA0,0x21,0x88,0x21,0x70,0x42,0x60,0x42,0x60,0x42,0x28,0x41,0x00,0x41,0x00,0x41,0x00,0x61,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x25,0x29,0x08,0x4A,
-	0x41,0x10,0x21,0x08,0x66,0x31,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x04,0x21,0x04,0x29,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x04,0x21,0x25,0x29,0x41,0x10,0x62,0x10,0x21,0x08,
-	0xA3,0x18,0x45,0x31,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x6A,0x52,0x6A,0x52,0x00,0x00,0x41,0x08,0xE4,0x20,0x62,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0xC3,0x20,0xA3,0x18,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x29,0x45,0x31,0x00,0x00,0x82,0x18,0xE4,0x20,0x45,0x31,
-	0xA7,0x39,0xA7,0x39,0xA7,0x39,0x45,0x29,0x82,0x18,0x66,0x31,0xC7,0x41,0xC6,0x39,0x66,0x31,0x86,0x31,0xA7,0x39,0xC7,0x41,0x04,0x29,0x41,0x08,0xC3,0x20,0xA1,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x70,0x01,0xC0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,
-	0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB8,0x01,0xC8,0x01,0xC0,0x02,0xA8,0x21,0x88,0x42,0x60,0x42,0x38,0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x86,0x31,0xCB,0x62,0x66,0x29,0x00,0x00,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x01,0x08,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0xA7,0x39,0x0C,0x6B,0x00,0x00,0x21,0x08,0x82,0x18,0x45,0x29,
-	0xA3,0x18,0x21,0x08,0x62,0x10,0xA3,0x18,0xA3,0x18,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x00,0x08,0xA3,0x18,0x25,0x29,0x21,0x08,0xA3,0x18,0x82,0x18,0xC3,0x18,0xA7,0x39,0x86,0x39,0xA7,0x39,0x25,0x29,0x41,0x10,0x86,0x39,0xE4,0x20,0x04,0x29,0xC7,0x39,0xA7,0x39,0xA7,0x39,0xC7,0x39,0x86,0x31,0xE4,0x18,0xC3,0x18,0x62,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x00,0x21,0x88,0x02,0xD8,0x01,0xC0,0x01,0xC0,0x02,0xB8,
-	0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB8,0x01,0xC0,0x01,0xC0,0x01,0xC8,0x01,0xC0,0x02,0xB8,0x21,0x70,0x42,0x48,0x41,0x10,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,
-	0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x04,0x21,0x51,0x94,0x6A,0x4A,
-	0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0xA3,0x18,0x62,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0xA3,0x18,0x62,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC3,0x20,0x08,0x4A,0x21,0x10,0x21,0x08,0x61,0x10,0x45,0x29,0xE4,0x20,0x21,0x08,0x61,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x04,0x21,0x04,0x29,0x66,0x31,
-	0x86,0x39,0x66,0x31,0xC7,0x39,0xA3,0x18,0xA3,0x18,0x86,0x31,0x21,0x08,0x61,0x10,0xC7,0x41,0xC7,0x41,0x86,0x39,0x25,0x29,0x66,0x31,0xE4,0x20,0x04,0x29,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x42,0x38,0x21,0x88,0x21,0x88,0x21,0x88,0x01,0xA0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,
-	0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x21,0x88,0x21,0x88,0x21,0x88,0x42,0x38,0x41,0x10,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE8,0x41,0x51,0x94,0x82,0x10,0x00,0x00,0x62,0x10,0x21,0x08,0x04,0x21,0x04,0x21,0x21,0x08,0x25,0x29,0xC3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x82,0x18,
-	0x41,0x10,0x82,0x10,0x42,0x10,0x82,0x18,0x82,0x18,0x21,0x08,0x62,0x10,0x82,0x10,0x41,0x10,0x62,0x10,0xA3,0x18,0x41,0x10,0x82,0x10,0x41,0x10,0x82,0x10,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x04,0x29,
-	0xC3,0x20,0x21,0x08,0x21,0x08,0x62,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x45,0x29,0x66,0x31,0x25,0x29,0x45,0x31,0x86,0x39,0x45,0x31,0xE4,0x20,0x82,0x18,0x25,0x29,0x04,0x29,0xC3,0x20,0xA7,0x39,0x45,0x31,0x25,0x29,0x86,0x39,0xC6,0x39,0x66,0x31,0x04,0x29,0x82,0x18,
-	0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x62,0x00,0x41,0x00,0x21,0x08,0x21,0x88,
-	0x02,0xB8,0x02,0xA8,0x02,0xB0,0x02,0xB8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB8,0x02,0xB8,0x01,0xC0,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x02,0xD8,0x42,0x38,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x29,0x4A,0xAF,0x7B,0x82,0x18,
-	0x41,0x10,0x82,0x10,0x21,0x08,0x62,0x10,0x82,0x18,0x41,0x10,0x82,0x18,0x62,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x82,0x10,0x82,0x18,0x82,0x10,0x41,0x08,0x82,0x18,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0xA3,0x18,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x82,0x18,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x08,0x62,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x62,0x10,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x25,0x29,0x45,0x29,0x25,0x29,
-	0x82,0x18,0x86,0x39,0x66,0x31,0xC3,0x18,0x42,0x10,0x45,0x29,0xC7,0x39,0x86,0x31,0x86,0x39,0xC3,0x18,0xC3,0x20,0xC7,0x41,0xC7,0x39,0xA7,0x39,0x45,0x29,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x00,0x42,0x28,0x01,0xC0,0x01,0xC0,0x01,0xC8,0x02,0xB8,0x21,0x88,0x21,0x88,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x01,0xA0,0x21,0x88,0x01,0xA0,0x01,0x98,0x01,0x98,0x01,0xA0,0x01,0xA0,0x42,0x60,
-	0x42,0x38,0x42,0x60,0x21,0x70,0x21,0x88,0x42,0x30,0x62,0x00,0x42,0x10,0x42,0x38,0x42,0x48,0x42,0x60,0x42,0x38,0x62,0x00,0x61,0x00,0x41,0x08,0x41,0x08,0x41,0x00,0x62,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0x6A,0x52,0xC7,0x39,0x86,0x39,0x28,0x52,0x00,0x00,0x41,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x10,0x61,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0xE4,0x20,0x62,0x10,0x25,0x29,0x82,0x10,0x21,0x08,0x41,0x10,0x82,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x08,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x62,0x10,0x21,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x04,0x21,0xE8,0x41,0xE8,0x41,0x00,0x08,0xE4,0x20,0xE8,0x41,0xA2,0x20,0x21,0x08,0x66,0x31,0xC7,0x41,0x86,0x39,0xC7,0x39,0xA7,0x39,0x45,0x31,0x45,0x29,0x86,0x39,0x86,0x39,0x86,0x39,0x62,0x08,
-	0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x00,
-	0x42,0x38,0x21,0x88,0x02,0xB8,0x01,0xC8,0x01,0xC0,0x01,0xC0,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC0,0x01,0xC8,0x01,0xC8,0x23,0xD0,0x01,0xC8,0x01,0xC0,0x02,0xA8,0x41,0x10,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x00,0x21,0x70,0x02,0xD8,0x02,0xD8,0x02,0xD8,0x02,0xB8,0x01,0xA0,0x01,0xA0,0x02,0xA8,0x02,0xA8,0x42,0x48,
-	0x41,0x20,0x41,0x20,0x42,0x28,0x42,0x30,0x42,0x28,0x42,0x30,0x42,0x30,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0xE8,0x41,0x00,0x08,0xE4,0x20,
-	0xE8,0x41,0x00,0x00,0x62,0x10,0x82,0x18,0x41,0x10,0x62,0x10,0x82,0x10,0x62,0x10,0xC3,0x20,0x41,0x10,0x21,0x08,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x45,0x29,0x82,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x04,0x21,0xE4,0x20,0x21,0x08,0x00,0x00,0x66,0x31,0x49,0x4A,0x00,0x00,0x41,0x08,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x45,0x31,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x04,0x29,0x25,0x29,0xE4,0x20,
-	0x41,0x10,0x45,0x29,0xE8,0x41,0x82,0x18,0x00,0x00,0x25,0x29,0xC7,0x41,0x86,0x39,0x66,0x31,0x82,0x18,0x04,0x21,0x86,0x39,0xC6,0x39,0xC7,0x41,0x66,0x31,0x60,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x20,0x42,0x48,0x42,0x48,0x42,0x48,0x42,0x48,0x42,0x60,0x42,0x60,0x42,0x48,0x42,0x48,0x42,0x48,0x42,0x48,0x42,0x60,0x02,0xB0,0x02,0xD8,
-	0x42,0x60,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x62,0x00,0x42,0x38,0x21,0x70,0x42,0x30,0x21,0x70,0x01,0xC8,0x01,0xC0,0x01,0xC0,0x01,0xC0,0x02,0xD8,0x02,0xD8,0x02,0xD8,0x02,0xD8,0x02,0xD8,0x02,0xD8,0x02,0xD8,0x02,0xD8,0x02,0xD8,0x21,0x70,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0xA3,0x18,0xA3,0x18,0x82,0x10,0x00,0x00,0x21,0x10,0x21,0x08,0x41,0x08,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0xA3,0x18,0x82,0x18,0x04,0x21,0xC3,0x20,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x21,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x20,0xE4,0x20,0x20,0x08,0x00,0x08,0x04,0x21,0x08,0x4A,0x20,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x62,0x10,0xC7,0x41,0x04,0x29,0x00,0x00,0xE4,0x20,0x86,0x39,0xC7,0x41,0x45,0x31,0x01,0x08,0x45,0x31,0x66,0x31,0xE4,0x20,0xC3,0x20,0x00,0x00,0x45,0x31,0xE8,0x41,0xE4,0x20,0xA3,0x18,0x86,0x39,0x21,0x08,
-	0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x10,0x41,0x20,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x00,0x42,0x10,0x42,0x48,0x21,0x70,0x42,0x30,0x41,0x08,0x61,0x10,0x41,0x10,0x42,0x48,0x21,0x88,
-	0x01,0xA0,0x01,0x98,0x21,0x88,0x01,0x98,0x01,0x98,0x02,0xA8,0x02,0xB8,0x42,0x60,0x62,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0xA3,0x18,0xA3,0x18,
-	0x00,0x08,0xA3,0x18,0x04,0x29,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x62,0x10,0xA3,0x18,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0xC3,0x20,0xA7,0x39,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0x21,0x08,0x42,0x10,0x21,0x08,0x21,0x08,0xE4,0x20,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x21,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x10,0xC7,0x41,0xE8,0x41,0x66,0x31,
-	0x45,0x31,0x04,0x21,0x25,0x29,0x66,0x31,0x04,0x29,0xE4,0x20,0x82,0x10,0x41,0x10,0xA1,0x18,0x41,0x08,0x04,0x29,0x86,0x31,0x82,0x10,0x61,0x10,0xC7,0x41,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x62,0x00,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x41,0x00,0x41,0x08,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x0C,0x6B,0x82,0x10,0x20,0x08,0x21,0x08,0xA3,0x18,0x04,0x21,0x21,0x08,0x62,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x45,0x29,0xE8,0x41,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x61,0x10,0x41,0x10,0x04,0x29,0x62,0x10,0x21,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x25,0x29,0x86,0x39,0x08,0x42,0x04,0x29,0x25,0x29,0x25,0x29,0x62,0x10,0x04,0x21,0xE4,0x20,0x45,0x29,0xA3,0x18,0x86,0x39,0x25,0x29,0xA7,0x39,0xE4,0x20,0x66,0x31,0x86,0x31,0x04,0x29,0x00,0x00,
-	0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x62,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0xC7,0x39,0x62,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x21,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x61,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x20,0x86,0x39,
-	0x25,0x29,0x66,0x31,0x04,0x29,0x00,0x08,0x00,0x08,0x04,0x21,0xE8,0x41,0x45,0x31,0x66,0x31,0xE4,0x20,0x45,0x29,0x86,0x39,0x86,0x39,0x45,0x31,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xC3,0x18,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xC3,0x18,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0xC3,0x20,0x21,0x08,0x41,0x10,0x21,0x08,0xA3,0x18,0xA1,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0xA2,0x20,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x08,0x62,0x10,0xC3,0x18,0xC3,0x20,0xE8,0x41,0xE4,0x20,0x00,0x08,0x21,0x08,0x04,0x29,0xC7,0x41,0xA3,0x18,0xE4,0x20,0xE4,0x20,0x82,0x18,0x86,0x39,0xC3,0x20,0x25,0x29,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0xA3,0x18,0xAB,0x5A,0x41,0x08,0x82,0x10,
-	0x25,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x82,0x18,0x41,0x10,0x82,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x82,0x18,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0xC3,0x20,0x45,0x29,0x45,0x29,
-	0x41,0x10,0x86,0x39,0xA3,0x18,0x00,0x00,0x82,0x10,0xE4,0x20,0x82,0x10,0x41,0x10,0xE8,0x41,0x25,0x29,0x82,0x10,0x82,0x10,0x82,0x18,0xE8,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0xC3,0x18,0x49,0x52,0x00,0x08,0x82,0x18,0x45,0x29,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0xA3,0x18,0x82,0x18,0x00,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x66,0x31,0x25,0x29,0x61,0x10,0x66,0x31,0x04,0x29,0x21,0x08,0x41,0x08,0xA3,0x18,0x04,0x21,0x41,0x10,0x86,0x39,0x04,0x29,0x62,0x10,0x41,0x10,0xC3,0x20,0x25,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x66,0x31,0x6A,0x52,0x41,0x08,0x21,0x08,
-	0x00,0x00,0x41,0x10,0x21,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x45,0x29,0x62,0x10,0x21,0x08,0x62,0x10,0x82,0x18,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x25,0x21,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x82,0x18,0xE4,0x20,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0xC3,0x18,0x66,0x31,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x25,0x29,0x45,0x31,0x04,0x29,
-	0x04,0x29,0x45,0x31,0xE4,0x20,0x62,0x10,0x00,0x08,0x25,0x29,0x45,0x29,0x62,0x10,0xE4,0x20,0x45,0x31,0x01,0x08,0xE4,0x20,0x66,0x31,0x62,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x28,0x52,0xEC,0x5A,0x41,0x08,0x41,0x08,0xA3,0x18,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0xA3,0x18,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x25,0x29,0x62,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x25,0x29,0x45,0x31,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x82,0x10,0xE4,0x20,0x21,0x08,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x45,0x31,0x86,0x31,0xE4,0x20,0xA3,0x18,0x45,0x29,0x21,0x08,0xC3,0x18,0xA3,0x18,0x66,0x31,0x04,0x29,0x45,0x31,0x25,0x29,0x86,0x39,0x61,0x10,0xE4,0x20,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x29,0x4A,0x8A,0x52,0x41,0x10,0xC3,0x18,
-	0x66,0x31,0x21,0x08,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x18,0x41,0x10,0x82,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x21,0x08,0x41,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x66,0x31,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0x41,0x10,0x66,0x31,0xC7,0x41,0x82,0x10,
-	0xA2,0x20,0x25,0x29,0x21,0x08,0x41,0x10,0xC3,0x18,0x86,0x31,0x62,0x18,0x04,0x29,0x45,0x31,0x45,0x31,0x04,0x29,0xA3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x0C,0x6B,0x49,0x52,0x41,0x08,0x82,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0xC3,0x20,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0x08,0x25,0x29,0x82,0x18,0x21,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xE4,0x20,0x86,0x39,0xA3,0x18,0x82,0x18,0x04,0x29,0x62,0x10,0x00,0x00,0x82,0x10,0xE8,0x41,0x82,0x10,0x00,0x08,0xA3,0x18,0x04,0x29,0x86,0x39,0xC3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x08,0xCB,0x5A,0x29,0x42,0x00,0x00,0x21,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x45,0x29,0x08,0x42,0x82,0x18,
-	0x21,0x08,0xE4,0x20,0xC3,0x18,0x41,0x10,0x62,0x10,0x86,0x39,0xA3,0x18,0x21,0x00,0x62,0x10,0x62,0x10,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE4,0x20,0x49,0x52,0xA3,0x18,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x66,0x31,0xA7,0x39,0x21,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x82,0x18,0x21,0x10,0xE4,0x20,0x45,0x31,0x21,0x08,0x04,0x29,0x45,0x31,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xA3,0x18,0xEC,0x62,0xAB,0x5A,0x04,0x21,0x01,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x21,0x08,0x62,0x10,0x08,0x4A,0xE4,0x20,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x66,0x31,0x86,0x31,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x45,0x29,0xC3,0x20,0xE4,0x20,0xE8,0x41,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE4,0x20,0x31,0x8C,0xA7,0x31,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x10,0x45,0x29,0x62,0x10,0x21,0x08,0x82,0x18,0x82,0x18,0x21,0x08,0x21,0x10,0x62,0x10,0x66,0x31,0x41,0x10,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x86,0x31,0xE4,0x20,0x00,0x08,0x61,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x21,0x08,0x82,0x10,0x45,0x29,0x25,0x29,0x66,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE4,0x20,0x61,0x10,0x00,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x82,0x10,0x21,0x08,0x82,0x10,0x61,0x10,0x21,0x08,0x62,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x00,0x08,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0xC3,0x20,0xE4,0x20,0x00,0x08,
-	0x21,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x08,0xA3,0x18,0xC6,0x39,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x25,0x29,0xA3,0x18,0x00,0x08,0x41,0x08,0x21,0x08,0x41,0x10,0xA3,0x18,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x62,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0xE4,0x20,0x82,0x18,0x21,0x08,0x41,0x08,0x42,0x10,0xC3,0x20,0x41,0x10,0x41,0x08,0x41,0x10,0x42,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x45,0x31,0x04,0x29,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x21,0x08,0x21,0x08,0xE4,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x21,0x08,0x00,0x08,0x8A,0x5A,0x45,0x29,0x00,0x00,0x66,0x31,
-	0x82,0x18,0x41,0x10,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA3,0x18,0x62,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x62,0x10,0x61,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x21,0x10,0x25,0x29,
-	0x45,0x31,0x21,0x08,0x61,0x10,0x21,0x08,0xA1,0x18,0x61,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x82,0x18,0x62,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xC3,0x18,0xC3,0x18,0xA3,0x18,
-	0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x21,0x08,0x49,0x4A,0xC3,0x20,0x00,0x08,0xC3,0x18,0x82,0x10,0x21,0x08,0xE4,0x20,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x62,0x10,0x82,0x10,0x41,0x10,0x62,0x10,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x10,0x04,0x21,0x62,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0xA1,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA2,0x20,0x62,0x18,0x00,0x00,0x20,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x20,0x86,0x39,0x41,0x10,0x61,0x10,0x21,0x08,0xA3,0x18,0xA1,0x18,
-	0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x25,0x29,0x2D,0x6B,0xE4,0x18,0x01,0x08,0x00,0x08,
-	0x21,0x10,0x00,0x08,0x04,0x29,0x04,0x21,0x00,0x08,0x41,0x10,0x00,0x08,0x45,0x29,0xC3,0x18,0x00,0x08,0x62,0x10,0xC3,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x18,0x82,0x18,0x41,0x10,0x41,0x08,0x62,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x10,0x41,0x10,0xC3,0x18,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x21,0x10,0x41,0x10,0x41,0x08,0x21,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0xE4,0x20,0xA7,0x39,0xA3,0x10,0x21,0x08,0x82,0x10,0x41,0x10,0x62,0x08,0x82,0x18,0xA3,0x18,0x41,0x08,0x41,0x10,0x21,0x08,0xA3,0x18,0xA3,0x18,0x62,0x10,0x62,0x10,0x04,0x29,0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x10,
-	0x61,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x18,0xC3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x42,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x20,0x41,0x08,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0xA7,0x31,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x62,0x10,0x62,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0xA3,0x18,0x41,0x10,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x21,0x08,0x21,0x08,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x00,0x08,0x25,0x29,0x25,0x29,0x00,0x00,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x66,0x31,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x82,0x18,0x82,0x18,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE4,0x20,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0xA3,0x18,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0x86,0x31,0x00,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x08,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x62,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x08,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x62,0x08,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x41,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x62,0x08,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x62,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_1169_dial_img_0_144_data_0, "face_1169_dial_img_0_144_data_0.bin");
         
 
 
@@ -2186,7 +21,7 @@ const lv_img_dsc_t face_1169_dial_img_0_144_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 288,
-    .data_size = sizeof(face_1169_dial_img_0_144_data_0),
+    .data_size = 138240,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_1169_dial_img_0_144_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 1169
 
 #include "../1169.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,34 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_0[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x02,0x90,0x02,0x90,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x20,0x22,0x70,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x22,0x70,0x22,0x70,0x22,0x70,0x22,0x70,0x02,0xA8,0x02,0xB0,0x21,0x48,0x41,0x10,0x02,0x88,0x02,0xA0,0x02,0xB0,0x02,0xA8,0x02,0x88,0x22,0x70,0x22,0x78,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x22,0x78,
-	0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x21,0x48,0x21,0x48,0x02,0xA0,0x02,0xB0,0x02,0x80,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x68,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x02,0xA0,0x02,0xB0,0x21,0x48,0x02,0x90,0x02,0xB0,0x02,0x80,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x22,0x70,0x02,0xB0,0x02,0x98,0x21,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x02,0xB0,0x02,0xB0,0x02,0x98,0x02,0x98,0x02,0xB0,0x02,0xA0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x22,0x78,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xB0,0x02,0x80,0x41,0x10,0x41,0x30,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,
-	0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x21,0x48,0x02,0x80,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,
-	0x02,0x80,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x80,0x21,0x48,0x02,0x80,0x02,0xB0,0x02,0x80,0x02,0x80,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x30,0x02,0xB0,0x21,0x48,0x41,0x30,0x02,0xB0,0x22,0x70,0x41,0x10,0x22,0x78,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x41,0x10,0x41,0x10,0x02,0xB0,0x21,0x60,0x41,0x10,0x21,0x60,0x02,0xA8,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x02,0xB0,0x21,0x48,0x41,0x20,0x21,0x68,0x02,0xB0,0x02,0xB0,0x22,0x78,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0x90,0x02,0xB0,0x02,0xA8,0x41,0x10,0x41,0x10,0x21,0x60,0x02,0xB0,0x41,0x20,0x41,0x10,0x21,0x50,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0xA8,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x20,0x41,0x10,0x41,0x10,0x02,0x98,0x02,0xB0,0x21,0x60,0x21,0x48,0x21,0x60,0x22,0x70,0x22,0x70,0x22,0x70,0x22,0x70,0x22,0x70,0x21,0x50,0x21,0x48,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x22,0x70,0x02,0xA0,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_0, "face_1169_dial_img_1_69774_data_0.bin");
         
 
 
@@ -47,40 +21,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_0),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_1[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x21,0x48,0x21,0x48,0x41,0x30,0x41,0x10,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x20,0x41,0x40,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0x88,0x02,0x80,0x02,0x90,0x02,0x90,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x02,0xA8,0x02,0xB0,0x22,0x70,0x21,0x48,0x21,0x48,0x21,0x48,0x22,0x78,0x21,0x48,0x21,0x60,
-	0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x22,0x70,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x90,
-	0x02,0x90,0x02,0x90,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_1, "face_1169_dial_img_1_69774_data_1.bin");
         
 
 
@@ -88,40 +35,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_1),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_2[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0x90,0x02,0x90,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x88,0x21,0x68,0x21,0x48,0x21,0x60,0x22,0x78,0x02,0xA0,0x22,0x70,
-	0x21,0x50,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x20,0x02,0xA8,0x22,0x70,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x88,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x22,0x78,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x22,0x70,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x02,0xA0,0x02,0xA0,0x22,0x70,0x41,0x20,0x41,0x10,0x41,0x10,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,
-	0x02,0x90,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0x90,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x88,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0x80,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x30,0x41,0x20,0x02,0xA8,0x02,0xB0,0x02,0x98,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xA0,0x22,0x70,0x02,0x98,0x02,0xB0,0x02,0x98,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xA8,0x22,0x70,0x02,0x98,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x21,0x60,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0x90,0x02,0x90,
-	0x02,0x90,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x21,0x48,0x21,0x48,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_2, "face_1169_dial_img_1_69774_data_2.bin");
         
 
 
@@ -129,40 +49,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_2),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_3[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x40,0x21,0x48,0x02,0xA0,0x02,0xA8,0x02,0x80,0x22,0x70,0x22,0x70,0x22,0x78,0x02,0xA0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0x80,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x22,0x70,0x02,0xB0,0x02,0x80,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x80,0x02,0xA0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0x98,0x02,0xA8,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x90,0x02,0x90,
-	0x02,0xA0,0x02,0xB0,0x02,0xB0,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x88,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x22,0x78,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x88,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x20,0x02,0x90,0x02,0xB0,0x02,0x80,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x20,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0x90,0x21,0x50,0x41,0x20,0x41,0x10,0x41,0x30,0x21,0x60,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x21,0x48,0x41,0x20,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x02,0x90,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_3, "face_1169_dial_img_1_69774_data_3.bin");
         
 
 
@@ -170,40 +63,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_3),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_4[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x22,0x78,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,
-	0x02,0xA8,0x02,0x90,0x02,0xA0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0x98,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x21,0x68,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xA8,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x02,0x88,0x02,0xB0,0x02,0x98,0x41,0x20,0x21,0x48,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x20,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x20,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x02,0x88,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x40,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x21,0x50,0x02,0x90,0x02,0x90,0x02,0x90,0x22,0x78,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x68,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0x98,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_4, "face_1169_dial_img_1_69774_data_4.bin");
         
 
 
@@ -211,40 +77,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_4),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_5[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,
-	0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x88,0x21,0x48,0x21,0x48,0x21,0x50,0x22,0x70,0x21,0x68,0x21,0x48,0x21,0x48,0x21,0x68,0x02,0xB0,
-	0x02,0xB0,0x21,0x50,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x48,0x21,0x48,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x21,0x48,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x21,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x60,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x68,0x22,0x70,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x20,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x78,0x02,0xA8,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x88,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x40,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x22,0x70,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x40,0x22,0x70,0x02,0xA8,0x02,0xB0,0x02,0x80,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x02,0x80,0x41,0x20,0x22,0x70,0x02,0xB0,0x02,0xB0,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x68,0x22,0x70,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x02,0x90,0x02,0x90,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_5, "face_1169_dial_img_1_69774_data_5.bin");
         
 
 
@@ -252,40 +91,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_5),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_6[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0xA8,0x02,0xB0,0x02,0x98,0x02,0x90,0x02,0x90,0x02,0x80,0x22,0x70,0x22,0x70,0x02,0x80,
-	0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x21,0x48,0x22,0x70,0x22,0x70,0x22,0x70,0x22,0x70,0x22,0x70,0x02,0x98,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0x90,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0x80,0x41,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x22,0x78,0x22,0x70,0x22,0x70,0x22,0x70,0x22,0x78,0x02,0xA8,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0x98,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x22,0x70,
-	0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xA8,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,
-	0x02,0xB0,0x02,0xB0,0x02,0xA0,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x40,0x02,0x88,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x02,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x02,0x90,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,
-	0x02,0xB0,0x21,0x50,0x02,0x88,0x02,0x98,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x22,0x78,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x88,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x30,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x22,0x78,0x02,0xA8,0x02,0xA0,0x02,0x90,0x02,0xA0,0x02,0xB0,0x21,0x60,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0x90,0x02,0xA0,0x02,0xB0,0x02,0xA0,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_6, "face_1169_dial_img_1_69774_data_6.bin");
         
 
 
@@ -293,40 +105,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_6),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_7[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x21,0x48,
-	0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x48,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x21,0x48,0x02,0x88,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x22,0x78,0x02,0x88,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_7, "face_1169_dial_img_1_69774_data_7.bin");
         
 
 
@@ -334,40 +119,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_7),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_8[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x22,0x70,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x22,0x70,0x22,0x70,0x22,0x70,
-	0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0x90,0x41,0x30,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x80,0x21,0x50,0x21,0x48,0x21,0x48,0x21,0x48,0x21,0x50,0x02,0x88,0x02,0xB0,
-	0x02,0xB0,0x02,0xA8,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xA0,0x02,0xA0,
-	0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x78,
-	0x02,0xB0,0x02,0xB0,0x02,0x88,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x22,0x70,0x21,0x60,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0x90,0x21,0x50,0x21,0x60,0x02,0x80,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x22,0x70,0x02,0x90,0x02,0xB0,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,
-	0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x21,0x68,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0x90,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x78,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xA8,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x02,0xB0,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x20,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x30,0x22,0x70,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x02,0xA0,0x02,0xB0,
-	0x02,0x98,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x02,0x90,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_8, "face_1169_dial_img_1_69774_data_8.bin");
         
 
 
@@ -375,40 +133,13 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_8),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_1_69774_data_9[] = {
-	//RGB565 data 
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x22,0x70,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x21,0x60,0x02,0xA0,0x02,0xA8,0x22,0x78,0x41,0x20,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x22,0x78,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x50,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x21,0x68,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x02,0x98,0x02,0xB0,0x02,0xB0,0x21,0x50,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x21,0x68,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x22,0x78,0x02,0xB0,0x02,0xB0,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x78,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0x88,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0x90,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x80,0x02,0x80,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xA0,0x02,0xA0,0x02,0xA8,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x48,0x02,0x98,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x98,0x21,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x60,0x21,0x48,
-	0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0xA0,0x02,0x80,0x22,0x70,0x21,0x48,0x21,0x50,0x02,0x90,0x02,0x90,0x21,0x60,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x21,0x48,0x22,0x70,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0x80,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x02,0x80,0x21,0x48,0x22,0x70,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x22,0x70,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x40,0x02,0xB0,0x21,0x48,0x22,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x22,0x78,0x02,0xB0,0x21,0x48,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x22,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x20,0x02,0xA8,0x02,0xB0,0x41,0x40,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x40,0x41,0x10,0x41,0x10,0x41,0x10,0x22,0x70,0x41,0x30,
-	0x41,0x10,0x41,0x10,0x02,0x80,0x02,0xB0,0x02,0xB0,0x41,0x10,0x02,0x90,0x02,0xB0,0x21,0x50,0x22,0x78,0x02,0xB0,0x02,0xA8,0x21,0x68,0x41,0x30,0x41,0x10,0x02,0x90,0x02,0xA8,0x02,0x90,0x02,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x41,0x10,0x02,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0x90,0x22,0x70,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_1169_dial_img_1_69774_data_9, "face_1169_dial_img_1_69774_data_9.bin");
         
 
 
@@ -416,7 +147,7 @@ const lv_img_dsc_t face_1169_dial_img_1_69774_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 17,
     .header.h = 27,
-    .data_size = sizeof(face_1169_dial_img_1_69774_data_9),
+    .data_size = 1377,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_1169_dial_img_1_69774_data_9};
 
@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 1169
-
-#include "../1169.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_1169_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x04,0x21,0xC3,0x18,0x61,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xE4,0x20,0x04,0x21,0xE3,0x18,0xA2,0x18,0x21,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x08,0x62,0x10,0x82,0x10,0x04,0x21,0x04,0x21,0xA3,0x18,0x82,0x10,0xC3,0x20,0x04,0x21,0xF8,0xC5,0xD3,0x9C,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x82,0x18,0xC3,0x18,0xA2,0x10,0x41,0x08,0x21,0x08,
-	0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,
-	0x41,0x08,0x41,0x20,0x41,0x30,0x82,0x30,0xD3,0x9C,0xF7,0xC5,0x10,0x8C,0x08,0x4A,0xC3,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x21,0x08,0x04,0x21,0x25,0x29,0x69,0x42,0x8A,0x52,0xA6,0x31,0x29,0x42,0x25,0x21,0xE4,0x18,0xEB,0x52,0xA2,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x08,0x86,0x31,0x65,0x29,0xA2,0x10,
-	0x21,0x08,0x61,0x10,0x62,0x10,0xA3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x70,0x21,0x78,0x21,0x78,0x22,0x70,0x21,0x78,0x01,0x80,0x01,0x98,
-	0x42,0xA8,0x63,0xC0,0x02,0xC8,0x01,0x98,0xE3,0x18,0xB6,0xB5,0xF7,0xC5,0xD7,0xBD,0xD7,0xBD,0x14,0xA5,0xCF,0x7B,0xEF,0x83,0xE3,0x18,0x86,0x31,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x86,0x31,0x00,0x00,0x21,0x08,0x00,0x00,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x20,0x00,0x20,0x08,0xC3,0x18,
-	0xA3,0x10,0xA3,0x18,0x62,0x10,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x61,0x10,0x41,0x00,0x41,0x20,0x01,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x01,0xB0,
-	0x01,0xB8,0x00,0xB8,0x00,0xB8,0x22,0x68,0xE3,0x18,0x35,0xA5,0xEF,0x7B,0x6D,0x73,0x8A,0x4A,0x6A,0x4A,0x14,0x9D,0x39,0xCE,0x38,0xC6,0x38,0xCE,0xF3,0xA4,0x92,0x94,0x96,0xBD,0xF4,0xA4,0xD3,0xA4,0x45,0x29,0x20,0x00,0x41,0x08,0x20,0x00,0x62,0x10,0x41,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x21,0x08,
-	0x41,0x08,0x41,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0x96,0xB5,0xB7,0xBD,0x45,0x29,0x20,0x08,0x62,0x18,0x41,0x18,0x01,0xB0,0x00,0xB8,0x00,0xC0,0x41,0x48,0x01,0x78,0x01,0xC0,0x42,0x58,
-	0x02,0xC0,0x01,0xC0,0x00,0x98,0xE4,0x18,0xD7,0xBD,0xAF,0x7B,0x6E,0x6B,0x18,0xCE,0x96,0xB5,0x92,0x9C,0x28,0x4A,0x8E,0x6B,0xD0,0x73,0x51,0x84,0xB7,0xBD,0x76,0xAD,0x49,0x3A,0xAA,0x4A,0x18,0xC6,0x13,0xA5,0x41,0x08,0x00,0x00,0xCF,0x7B,0xB6,0xBD,0x55,0xAD,0x34,0xAD,0xF4,0xA4,0x92,0x94,0x6E,0x73,0x08,0x4A,0x25,0x29,0x41,0x08,
-	0x20,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x31,0x8C,0x96,0xB5,0x35,0xAD,0xA2,0x10,0x82,0x20,0xA3,0x40,0x41,0x20,0x01,0xB8,0x00,0xB8,0x00,0x98,0x42,0x30,0x61,0x40,0x01,0xA8,0x21,0x80,
-	0x01,0xC0,0x01,0xC0,0x00,0x90,0xE4,0x18,0xD7,0xB5,0x2D,0x6B,0x10,0x8C,0xB6,0xBD,0x96,0xB5,0x18,0xCE,0xAB,0x5A,0x00,0x00,0x21,0x08,0xA6,0x31,0x18,0xBE,0xD7,0xBD,0xC7,0x41,0x8E,0x73,0xD7,0xBD,0x34,0xAD,0x71,0x94,0xA2,0x10,0x10,0x7C,0x96,0xB5,0xB6,0xB5,0x35,0xA5,0xB3,0x8C,0x34,0x9D,0x35,0x9D,0xD7,0xB5,0x18,0xC6,0xB2,0x9C,
-	0xAA,0x5A,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xB5,0x18,0xC6,0x08,0x42,0x20,0x08,0x34,0xA5,0xF8,0xC5,0xAE,0x73,0x00,0x00,0x82,0x20,0x62,0x20,0x21,0x20,0x01,0xB8,0x00,0xC0,0x21,0x88,0x42,0x30,0x42,0x30,0x42,0x38,0x82,0x70,
-	0x01,0xC0,0x02,0xC8,0x21,0x78,0xA2,0x08,0x96,0xAD,0x49,0x52,0x14,0x9D,0xB6,0xB5,0x96,0xBD,0xD7,0xC5,0x10,0x8C,0x20,0x08,0x41,0x08,0x8A,0x52,0x18,0xC6,0x96,0xB5,0x96,0xB5,0x92,0x8C,0xD7,0xBD,0xB6,0xB5,0x76,0xB5,0x82,0x10,0x76,0xAD,0x96,0xB5,0xD7,0xB5,0x49,0x4A,0xA2,0x08,0x04,0x19,0xE3,0x18,0x08,0x32,0x69,0x42,0xB2,0x8C,
-	0x59,0xCE,0xEC,0x62,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0xAD,0x35,0xA5,0x76,0xB5,0x18,0xC6,0xE7,0x41,0xE4,0x20,0xD7,0xBD,0xF8,0xC5,0x6D,0x6B,0x00,0x00,0xA2,0x28,0x83,0x48,0x21,0x28,0x01,0xB8,0x00,0xB8,0x42,0x50,0x42,0x30,0x42,0x38,0x42,0x38,0x42,0x30,
-	0x01,0xB0,0x01,0xD0,0x21,0x70,0x00,0x00,0x14,0xA5,0xA7,0x39,0x35,0xA5,0xB6,0xBD,0x96,0xB5,0x96,0xB5,0x55,0xB5,0xA2,0x18,0x20,0x08,0x0C,0x5B,0x18,0xC6,0xB6,0xBD,0xB2,0x9C,0x69,0x42,0xF8,0xC5,0x96,0xB5,0xF3,0xA4,0x61,0x08,0x35,0xA5,0x96,0xB5,0xB7,0xB5,0x8A,0x5A,0x25,0x29,0x45,0x29,0x66,0x29,0x86,0x29,0xE4,0x18,0x62,0x08,
-	0x8E,0x6B,0xE3,0x18,0x20,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0x96,0xB5,0x71,0x8C,0x55,0xAD,0x18,0xCE,0x29,0x4A,0xA7,0x39,0x18,0xC6,0x18,0xC6,0xEB,0x5A,0xA2,0x18,0xE3,0x50,0x62,0x38,0x22,0x48,0x01,0xB8,0x01,0xB0,0x41,0x38,0x62,0x38,0x83,0x48,0x62,0x30,0x42,0x30,
-	0x21,0x98,0x01,0xC8,0x21,0x50,0x41,0x08,0x76,0xB5,0x04,0x21,0x96,0xB5,0xB6,0xBD,0x96,0xB5,0x76,0xAD,0xB7,0xB5,0x49,0x52,0xC3,0x18,0x30,0x84,0xD7,0xBD,0xF7,0xC5,0xCF,0x83,0xCB,0x5A,0x18,0xBE,0xB7,0xBD,0xD3,0x9C,0x41,0x08,0x31,0x7C,0xB7,0xB5,0x96,0xB5,0xB7,0xB5,0xB7,0xBD,0x69,0x52,0xE4,0x18,0x65,0x21,0x28,0x42,0x08,0x4A,
-	0xEF,0x83,0xC3,0x18,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x4A,0xE7,0x39,0xB7,0xBD,0x96,0xB5,0x8A,0x4A,0x96,0xB5,0xF8,0xC5,0x0B,0x63,0x29,0x4A,0x59,0xCE,0x38,0xC6,0xA6,0x31,0xAA,0x5A,0xE3,0x58,0x62,0x50,0x21,0x48,0x00,0xB8,0x01,0xA8,0x82,0x28,0x62,0x38,0x83,0x48,0xA3,0x30,0x62,0x28,
-	0x21,0x98,0x02,0xD0,0x42,0x38,0xE4,0x18,0x14,0xA5,0xC3,0x18,0xF7,0xBD,0xB6,0xBD,0x96,0xB5,0x76,0xB5,0xB6,0xBD,0x76,0xB5,0xEF,0x73,0x96,0xB5,0x76,0xB5,0x18,0xC6,0x2D,0x6B,0x51,0x84,0xB6,0xB5,0xB7,0xBD,0x31,0x8C,0x21,0x08,0x55,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB6,0xB5,0x29,0x4A,0x65,0x29,0x45,0x19,0xF3,0x9C,0xF8,0xBD,
-	0x75,0xB5,0xA2,0x18,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xB6,0xB5,0x6A,0x52,0xCB,0x5A,0xB6,0xB5,0xB7,0xB5,0x25,0x29,0x96,0xBD,0xF7,0xBD,0x4D,0x6B,0x4D,0x6B,0xF8,0xBD,0x96,0xB5,0x61,0x08,0x45,0x39,0xC3,0x58,0xA3,0x38,0x21,0x58,0x00,0xC0,0x02,0x90,0xA2,0x28,0x82,0x48,0xE4,0x68,0x42,0x38,0x42,0x30,
-	0x21,0x98,0x02,0xD0,0x21,0x20,0xEB,0x62,0xCF,0x7B,0x86,0x29,0x18,0xC6,0x96,0xB5,0x96,0xBD,0x96,0xB5,0x76,0xB5,0xB3,0x9C,0xA3,0x10,0x55,0xA5,0x76,0xB5,0xF7,0xC5,0x4D,0x6B,0xD3,0x9C,0x96,0xB5,0xF7,0xC5,0xAF,0x7B,0xAA,0x52,0x18,0xC6,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x45,0x29,0xE4,0x18,0x04,0x19,0x55,0xA5,0xB6,0xB5,
-	0xF3,0xA4,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x7B,0xB6,0xBD,0xB6,0xB5,0xB7,0xBD,0x2D,0x63,0x4D,0x6B,0xD7,0xBD,0x76,0xAD,0x82,0x10,0x55,0xAD,0xF8,0xC5,0xEF,0x7B,0x10,0x84,0xF8,0xC5,0xB2,0x94,0xE7,0x41,0xD7,0xBD,0x07,0x6A,0x40,0x08,0x21,0x88,0x01,0xC8,0x21,0x78,0x42,0x30,0x82,0x50,0x82,0x68,0x42,0x30,0x42,0x30,
-	0x42,0xA0,0x22,0xC8,0x00,0x08,0x30,0x8C,0x8E,0x7B,0x49,0x42,0x18,0xC6,0xB6,0xB5,0x75,0xAD,0x96,0xB5,0x96,0xB5,0xD7,0xC5,0x25,0x21,0x35,0xA5,0x76,0xB5,0xD7,0xBD,0xAF,0x7B,0x55,0xAD,0x76,0xB5,0xF8,0xC5,0x0C,0x63,0x29,0x42,0xF7,0xBD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x34,0xAD,0x25,0x29,0x24,0x29,0x45,0x21,0xB6,0xB5,0xD7,0xBD,
-	0xB2,0x9C,0x61,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x00,0x08,0x2C,0x6B,0x30,0x7C,0x14,0x9D,0xB7,0xBD,0x8E,0x73,0xAF,0x7B,0xF7,0xBD,0xD3,0x9C,0xE4,0x20,0x14,0xA5,0xD7,0xBD,0x51,0x8C,0xD3,0x9C,0x96,0xB5,0xB6,0xBD,0x18,0xC6,0x2C,0x63,0x20,0x18,0x41,0x08,0x01,0xA0,0x01,0xB8,0x62,0x48,0x82,0x28,0x22,0x70,0x22,0x60,0x42,0x28,0x82,0x18,
-	0x62,0xA0,0x22,0xB0,0x00,0x00,0xF0,0x83,0x8E,0x73,0xEB,0x5A,0xF8,0xC5,0xF7,0xBD,0xCF,0x7B,0xD3,0x94,0xD7,0xBD,0xF7,0xBD,0xCF,0x7B,0x55,0xAD,0x76,0xB5,0x18,0xBE,0x66,0x31,0x55,0xA5,0x96,0xB5,0x18,0xC6,0x49,0x4A,0xE8,0x39,0xF7,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xB5,0xF3,0xA4,0x45,0x29,0x45,0x29,0xA7,0x31,0xF7,0xBD,0x76,0xB5,
-	0xD7,0xBD,0x45,0x31,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x20,0x00,0x2C,0x63,0xEC,0x5A,0x49,0x4A,0x18,0xC6,0x14,0xA5,0xF4,0xA4,0xB7,0xBD,0x10,0x84,0x8A,0x52,0x92,0x94,0xB6,0xB5,0xD3,0x94,0x34,0xAD,0xB6,0xB5,0xAA,0x52,0x08,0x42,0x20,0x00,0x21,0x58,0x62,0x20,0x00,0xB0,0x01,0x90,0x62,0x28,0x42,0x30,0x21,0x90,0x21,0x60,0x42,0x30,0x62,0x38,
-	0x01,0x88,0x21,0x98,0x00,0x00,0x31,0x8C,0x6D,0x73,0xAF,0x73,0xF7,0xBD,0x18,0xC6,0x2C,0x6B,0x4D,0x6B,0x38,0xC6,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xD7,0xBD,0x04,0x21,0x75,0xAD,0xB7,0xB5,0x38,0xC6,0xA6,0x39,0xCC,0x52,0xF8,0xBD,0x96,0xB5,0x96,0xB5,0xD7,0xBD,0x30,0x8C,0x04,0x29,0x24,0x29,0x8A,0x4A,0x18,0xC6,0x96,0xB5,
-	0x14,0xAD,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xE4,0x20,0xE3,0x20,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x49,0x52,0x29,0x4A,0x24,0x21,0xF7,0xBD,0x96,0xB5,0x96,0xB5,0xF8,0xC5,0x49,0x42,0x00,0x00,0x8E,0x7B,0x96,0xB5,0x76,0xB5,0x76,0xB5,0xD7,0xBD,0xE4,0x20,0xE8,0x39,0x41,0x08,0x83,0x50,0x41,0x20,0x01,0xC0,0x62,0x68,0x42,0x30,0x42,0x28,0x83,0x80,0x42,0x48,0x82,0x38,0x82,0x20,
-	0x01,0x88,0x42,0x78,0x20,0x00,0xB3,0x9C,0x2D,0x6B,0x51,0x8C,0xD7,0xBD,0x18,0xC6,0x2D,0x6B,0x86,0x29,0x18,0xBE,0x96,0xB5,0x96,0xBD,0x96,0xB5,0xB7,0xBD,0x55,0xAD,0x25,0x29,0xD7,0xBD,0x96,0xB5,0xF7,0xC5,0xE3,0x20,0xC7,0x39,0xD7,0xBD,0x76,0xB5,0x96,0xB5,0xF8,0xC5,0x4D,0x6B,0x25,0x29,0x25,0x21,0x6D,0x6B,0xF7,0xBD,0xB7,0xBD,
-	0xB3,0x9C,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0xA2,0x18,0x86,0x31,0x00,0x00,0x41,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x2C,0x6B,0x38,0xC6,0xA2,0x18,0xB7,0xB5,0x76,0xB5,0x96,0xB5,0x18,0xC6,0x45,0x29,0x00,0x00,0x0C,0x63,0xD7,0xBD,0x75,0xAD,0x75,0xAD,0x34,0xA5,0xC3,0x18,0x4D,0x73,0x41,0x10,0x21,0x60,0x41,0x28,0x01,0xC8,0x62,0x50,0x62,0x30,0x82,0x40,0x62,0x38,0xC3,0x40,0xC3,0x48,0x62,0x30,
-	0x01,0xA8,0x41,0x48,0xA2,0x10,0x18,0xC6,0xEC,0x62,0x14,0x9D,0x96,0xBD,0x39,0xCE,0x6A,0x52,0x00,0x00,0x14,0x9D,0xB7,0xB5,0x76,0xB5,0xB6,0xB5,0xB6,0xBD,0x51,0x94,0x45,0x29,0xF8,0xBD,0xB7,0xB5,0x96,0xB5,0xA3,0x18,0xF4,0xA4,0xD7,0xBD,0x96,0xB5,0x96,0xB5,0xF8,0xC5,0x49,0x4A,0xE4,0x18,0xE4,0x18,0xF3,0x94,0xB6,0xBD,0xB7,0xBD,
-	0x14,0xA5,0x82,0x10,0x20,0x08,0x41,0x08,0x62,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x00,0x08,0x42,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x92,0x94,0x38,0xC6,0xE3,0x18,0xD3,0x9C,0x96,0xB5,0x96,0xB5,0xB6,0xB5,0xA2,0x10,0x00,0x00,0x08,0x4A,0xD7,0xBD,0x55,0xAD,0xB6,0xB5,0x30,0x84,0x6D,0x6B,0xEB,0x52,0x21,0x30,0x21,0x48,0x41,0x50,0x01,0xB8,0x21,0x40,0x62,0x30,0x42,0x38,0x62,0x48,0x62,0x48,0x82,0x48,0xC3,0x58,
-	0x23,0xC0,0x21,0x38,0xE3,0x18,0x38,0xC6,0xE8,0x41,0x76,0xAD,0x96,0xB5,0x18,0xC6,0x86,0x31,0x00,0x00,0x0C,0x5B,0xD7,0xBD,0x96,0xB5,0x96,0xB5,0xB6,0xB5,0xAE,0x83,0xC7,0x39,0x18,0xBE,0x96,0xB5,0xB2,0x9C,0x45,0x21,0xB6,0xB5,0x96,0xB5,0x96,0xBD,0x96,0xB5,0xB6,0xBD,0x6E,0x7B,0x8E,0x7B,0x65,0x31,0x96,0xB5,0x75,0xAD,0x76,0xB5,
-	0xF8,0xBD,0x92,0x9C,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x66,0x31,0xC7,0x31,0xC6,0x41,0xA3,0x18,0x41,0x08,
-	0x21,0x08,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x6E,0x73,0xAE,0x73,0x00,0x00,0x31,0x8C,0x96,0xB5,0x96,0xB5,0xB3,0x94,0x00,0x00,0x00,0x00,0x45,0x31,0xD7,0xBD,0x76,0xB5,0xD7,0xBD,0xCB,0x5A,0x86,0x31,0x04,0x29,0x41,0x48,0x42,0x40,0x21,0x70,0x21,0x98,0x42,0x38,0x42,0x30,0x41,0x60,0x22,0xC0,0x42,0x58,0xC3,0x38,0xC3,0x28,
-	0x21,0x90,0x21,0x28,0x45,0x41,0xB6,0xB5,0x65,0x29,0xB6,0xB5,0x96,0xB5,0xD7,0xBD,0xC3,0x18,0x00,0x08,0x65,0x29,0xD7,0xBD,0x96,0xB5,0x96,0xB5,0xD7,0xB5,0xCB,0x5A,0x66,0x29,0xD7,0xBD,0xB7,0xBD,0x31,0x8C,0x25,0x21,0x76,0xB5,0x96,0xB5,0x96,0xB5,0x76,0xB5,0xB7,0xBD,0x08,0x3A,0x86,0x31,0xA7,0x31,0x55,0xA5,0x75,0xAD,0xD7,0xBD,
-	0x92,0x94,0xE3,0x18,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x29,0x4A,0xC3,0x18,0x65,0x29,0x62,0x08,0xC3,0x18,
-	0x66,0x31,0x21,0x08,0x00,0x00,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x08,0x6E,0x73,0xAE,0x73,0x00,0x00,0xAE,0x7B,0xB7,0xB5,0xB7,0xBD,0x6E,0x73,0x00,0x00,0x21,0x08,0xE3,0x20,0xB7,0xBD,0x96,0xB5,0x39,0xCE,0xE7,0x39,0x41,0x08,0x20,0x00,0x41,0x28,0x42,0x38,0x01,0xA0,0x21,0x68,0x42,0x30,0x42,0x38,0x21,0x70,0x01,0xC0,0x62,0x50,0x81,0x28,0x82,0x30,
-	0xA3,0x80,0x21,0x90,0x66,0xC1,0x10,0x84,0xE8,0x41,0xD7,0xBD,0xB6,0xBD,0x96,0xBD,0x61,0x10,0x61,0x08,0xA2,0x10,0x55,0xAD,0xB7,0xBD,0x96,0xB5,0x96,0xBD,0xE7,0x41,0x4D,0x6B,0xD7,0xBD,0xD7,0xBD,0x6E,0x73,0xE4,0x20,0x96,0xB5,0x76,0xB5,0x76,0xB5,0xB6,0xB5,0x96,0xBD,0x45,0x31,0x45,0x29,0x08,0x42,0xD7,0xBD,0x76,0xB5,0x18,0xC6,
-	0xF0,0x83,0x00,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x8A,0x4A,0x41,0x08,0xA7,0x39,0x20,0x08,0x21,0x08,
-	0x66,0x29,0x49,0x4A,0xE4,0x20,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x28,0x42,0xA2,0x18,0xC3,0x18,0x82,0x10,0xC3,0x18,0xE4,0x20,0x82,0x10,0x62,0x10,0x62,0x10,0x20,0x08,0x08,0x42,0x0C,0x5B,0x10,0x7C,0x04,0x21,0x82,0x10,0x24,0x29,0x41,0x58,0x21,0x70,0x01,0xB8,0x21,0x60,0x42,0x38,0x82,0x48,0x20,0x90,0x01,0xB8,0x62,0x60,0xE4,0x38,0xE4,0x38,
-	0x63,0x70,0x01,0xC0,0x08,0xB2,0x0C,0x63,0xE8,0x39,0xD7,0xB5,0x38,0xC6,0x14,0xA5,0x00,0x00,0x41,0x08,0x41,0x08,0xF0,0x7B,0xF8,0xBD,0x76,0xB5,0xB7,0xBD,0x08,0x42,0xB6,0xB5,0x96,0xB5,0xB7,0xBD,0x8E,0x7B,0x8E,0x6B,0xB7,0xBD,0xB6,0xB5,0x76,0xB5,0xB6,0xB5,0x14,0xAD,0xE4,0x20,0x24,0x21,0x8A,0x4A,0xB6,0xBD,0x76,0xAD,0xD7,0xBD,
-	0x51,0x8C,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA2,0x10,0x6A,0x52,0x62,0x10,0xE7,0x41,0x08,0x42,0x21,0x08,
-	0x41,0x08,0x82,0x10,0x45,0x29,0x45,0x29,0x86,0x31,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x82,0x10,0xA2,0x18,0xE3,0x18,0x21,0x08,0x08,0x3A,0xCF,0x7B,0xF0,0x83,0x8E,0x73,0xAF,0x7B,0x4D,0x6B,0x28,0x4A,0x04,0x21,0xB3,0x9C,0x34,0xAD,0x30,0x8C,0x69,0x52,0x24,0x29,0xA2,0x10,0x41,0x08,0x10,0x84,0x45,0x41,0xC3,0x28,0x05,0xA9,0x01,0xB8,0x41,0xB8,0x01,0xB8,0x01,0xB8,0x00,0xB8,0xA3,0xB0,0xAA,0xBA,0x89,0xCA,
-	0x25,0xB9,0x00,0xB8,0xEF,0xB3,0xAA,0x52,0x00,0x00,0x82,0x10,0x24,0x19,0x04,0x21,0x20,0x08,0x62,0x10,0x41,0x08,0x08,0x3A,0xF8,0xBD,0xB6,0xB5,0xD7,0xBD,0xE7,0x39,0xF7,0xBD,0x55,0xAD,0xD7,0xBD,0x0C,0x6B,0xEC,0x5A,0xD7,0xBD,0xB7,0xBD,0xB6,0xBD,0xF7,0xC5,0x71,0x94,0xC3,0x18,0xC2,0x18,0x8A,0x4A,0x96,0xB5,0x76,0xB5,0xB7,0xB5,
-	0x72,0x94,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xE3,0x18,0x28,0x4A,0xC7,0x31,0x61,0x10,0xCF,0x7B,0x04,0x21,
-	0x21,0x08,0x41,0x08,0x00,0x08,0x20,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x71,0x94,0xB7,0xBD,0xB7,0xBD,0xAE,0x7B,0xF0,0x83,0x71,0x94,0xD3,0x9C,
-	0x14,0xA5,0x35,0xAD,0x76,0xAD,0xB6,0xB5,0x65,0x29,0x41,0x08,0x08,0x4A,0x96,0xB5,0x14,0xA5,0x34,0xA5,0x55,0xB5,0x75,0xB5,0x55,0xAD,0xB6,0xBD,0xB6,0xB5,0xB7,0xBD,0xD7,0xBD,0xD7,0xBD,0x34,0xAD,0xB3,0x9C,0xCF,0x83,0x29,0x4A,0x14,0x9D,0x34,0xAD,0xA2,0x40,0xCB,0x82,0x21,0x70,0x00,0x90,0x00,0xA0,0x83,0xC0,0x0A,0xEB,0x0A,0xEB,
-	0x68,0xD2,0x42,0xA8,0x75,0xBD,0x8A,0x52,0x00,0x00,0x41,0x08,0x41,0x08,0x61,0x10,0x20,0x08,0x00,0x00,0x20,0x08,0x41,0x10,0xE3,0x18,0xE4,0x20,0x25,0x21,0x8A,0x4A,0x18,0xC6,0x76,0xAD,0xB7,0xBD,0x8E,0x73,0x8A,0x52,0x35,0xA5,0xF8,0xC5,0xD7,0xBD,0xF7,0xC5,0xB6,0xBD,0xB3,0x9C,0x51,0x94,0x92,0x9C,0x55,0xAD,0x76,0xAD,0x96,0xB5,
-	0xD3,0x9C,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x10,0xC3,0x18,0x61,0x10,0x61,0x08,0x69,0x4A,0x41,0x08,0xC3,0x10,0x8A,0x4A,
-	0x86,0x31,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x83,0xCF,0x83,0xF3,0x9C,0x18,0xC6,0xF7,0xBD,0xD7,0xBD,0xD7,0xBD,0xB7,0xB5,0xB2,0x94,
-	0xB2,0x94,0x96,0xBD,0xB6,0xB5,0x18,0xC6,0x69,0x4A,0x20,0x08,0xAF,0x7B,0x18,0xC6,0x96,0xB5,0xB6,0xB5,0x75,0xB5,0x75,0xB5,0x55,0xAD,0x55,0xB5,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0x76,0xB5,0x96,0xB5,0xB6,0xB5,0x18,0xC6,0xDB,0xDE,0x18,0xC6,0xF4,0xAC,0xA4,0xB8,0x35,0xBD,0x29,0xB2,0x04,0xB1,0x61,0xB0,0x62,0xA0,0x88,0xCA,0xA6,0x89,
-	0xEC,0xAA,0x43,0xB8,0x18,0xBE,0xC7,0x39,0x20,0x00,0x41,0x10,0x41,0x08,0x40,0x08,0xC7,0x39,0x0C,0x6B,0x86,0x31,0x41,0x08,0x61,0x10,0x41,0x10,0x20,0x08,0x6E,0x6B,0xF8,0xBD,0x75,0xAD,0x76,0xB5,0xE3,0x18,0xA3,0x10,0x0C,0x5B,0x59,0xCE,0xD7,0xBD,0xF7,0xC5,0xD7,0xBD,0x96,0xB5,0x76,0xB5,0x96,0xB5,0x55,0xAD,0x55,0xB5,0x76,0xB5,
-	0xD3,0x9C,0x82,0x10,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x82,0x10,0xE3,0x20,0xA2,0x18,0xE4,0x18,0x21,0x08,0x00,0x00,
-	0xE3,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xBA,0xD6,0xF7,0xBD,0x4D,0x5B,0x79,0xCE,0x35,0x9D,0x51,0x8C,0x51,0x84,0x51,0x8C,
-	0x76,0xAD,0xB7,0xB5,0x75,0xAD,0x18,0xC6,0x8A,0x52,0x20,0x08,0x61,0x08,0xE3,0x18,0x08,0x42,0xF0,0x7B,0x6E,0x6B,0x31,0x84,0x34,0xA5,0xF7,0xC5,0x18,0xC6,0x96,0xBD,0x96,0xB5,0x96,0xB5,0x96,0xBD,0xD7,0xBD,0x15,0xA5,0x14,0xA5,0x96,0xB5,0xE8,0xB1,0x22,0x60,0x86,0x59,0x49,0x4A,0x29,0x52,0x28,0x4A,0x62,0x10,0xC3,0x58,0x20,0x00,
-	0xEC,0x82,0xC8,0xA9,0x18,0xBE,0xAA,0x52,0xA2,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x10,0x84,0xBA,0xDE,0xAE,0x7B,0x20,0x00,0x61,0x10,0x61,0x10,0x40,0x08,0x51,0x84,0xD7,0xBD,0x76,0xB5,0xB7,0xBD,0x04,0x21,0x21,0x08,0x61,0x08,0xF8,0xBD,0xD7,0xBD,0xF7,0xC5,0xB6,0xBD,0x96,0xB5,0x76,0xB5,0x76,0xB5,0x75,0xAD,0x76,0xB5,0x96,0xB5,
-	0xF3,0xA4,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x42,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x66,0x29,0xA2,0x10,0x82,0x10,0x82,0x10,0x41,0x08,
-	0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x7C,0xEF,0x7B,0x10,0x7C,0xCB,0x5A,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,
-	0x21,0x08,0x00,0x00,0xCF,0x7B,0x59,0xC6,0xEB,0x62,0x21,0x08,0x62,0x10,0x41,0x08,0x00,0x00,0x61,0x10,0xA2,0x18,0x82,0x10,0xA6,0x39,0x49,0x42,0x6D,0x6B,0x96,0xB5,0x76,0xB5,0xB6,0xB5,0x14,0xA5,0x10,0x7C,0x49,0x4A,0x00,0x08,0x20,0x08,0x41,0x40,0x41,0x00,0x20,0x00,0x00,0x00,0xC3,0x20,0x45,0x29,0xA3,0x18,0x45,0x51,0x45,0x21,
-	0x83,0x80,0x10,0xB4,0x18,0xBE,0x18,0xC6,0xB6,0xBD,0x75,0xB5,0x13,0xAD,0x10,0x84,0xD3,0x94,0xD7,0xBD,0x4D,0x6B,0xC3,0x18,0xA2,0x18,0x20,0x08,0x65,0x29,0x76,0xB5,0x75,0xAD,0xB7,0xBD,0xCF,0x7B,0x20,0x08,0x41,0x10,0x00,0x00,0x6D,0x6B,0x38,0xCE,0xF7,0xC5,0xD7,0xBD,0xB7,0xBD,0x96,0xB5,0xB6,0xB5,0xB6,0xB5,0x76,0xB5,0x18,0xC6,
-	0x4D,0x6B,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x24,0x21,0x81,0x10,0x21,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x6B,0x00,0x00,0x00,0x08,0x41,0x08,0x04,0x21,0x21,0x08,0x41,0x08,0x20,0x08,0x00,0x00,0x62,0x10,0xAB,0x52,
-	0xA2,0x10,0x00,0x00,0x31,0x8C,0x59,0xCE,0x49,0x4A,0x00,0x00,0x08,0x42,0xA2,0x18,0x21,0x08,0x04,0x29,0xA6,0x39,0x82,0x10,0xA6,0x31,0x82,0x18,0x03,0x21,0xF7,0xC5,0x96,0xB5,0x18,0xCE,0x04,0x21,0x00,0x00,0x21,0x00,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x0C,0x63,0xA6,0x39,0xE4,0x20,0xE3,0x18,0x45,0x21,
-	0xE7,0x79,0xC3,0x78,0xEF,0x8B,0x76,0xAD,0x18,0xC6,0xF8,0xC5,0xD7,0xB5,0x14,0xA5,0x71,0x8C,0xEF,0x83,0x49,0x52,0x10,0x84,0x96,0xBD,0x72,0x94,0xD3,0x9C,0x76,0xAD,0x75,0xAD,0xD7,0xBD,0x6A,0x52,0x21,0x08,0x41,0x10,0x45,0x29,0x61,0x08,0x86,0x31,0x6D,0x6B,0x51,0x8C,0x72,0x8C,0x92,0x94,0x14,0xA5,0xB7,0xB5,0xD7,0xB5,0x39,0xC6,
-	0xC7,0x39,0x20,0x08,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x61,0x10,0x66,0x31,0xE8,0x39,0x45,0x29,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x82,0x10,0xE3,0x20,0x71,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xCE,0x8E,0x6B,0x00,0x00,0x41,0x08,0x41,0x08,0x61,0x10,0x21,0x08,0x00,0x00,0x82,0x10,0x6A,0x52,0x61,0x10,0x00,0x00,
-	0x21,0x08,0x00,0x00,0x31,0x8C,0x39,0xC6,0x29,0x4A,0x21,0x08,0x00,0x08,0x20,0x08,0x41,0x08,0x04,0x21,0x25,0x21,0x61,0x10,0x82,0x18,0x41,0x08,0xE3,0x20,0x14,0xA5,0xF4,0x9C,0xF3,0x9C,0x21,0x08,0x00,0x08,0x20,0x08,0x20,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0x24,0x21,0x8E,0x73,0x25,0x29,0xA2,0x18,0x82,0x18,0x45,0x29,
-	0x45,0x29,0x21,0x00,0x20,0x00,0x41,0x08,0x8E,0x6B,0xAF,0x73,0xF4,0x9C,0x55,0xAD,0x72,0x8C,0x71,0x8C,0xF3,0x9C,0x14,0xA5,0x38,0xC6,0xB7,0xB5,0xB3,0x94,0x96,0xB5,0x96,0xB5,0xF4,0x9C,0x8A,0x5A,0x41,0x08,0x82,0x10,0x45,0x29,0x20,0x00,0x20,0x00,0x66,0x31,0x45,0x29,0x00,0x00,0x25,0x21,0x49,0x4A,0x04,0x21,0x25,0x19,0x28,0x4A,
-	0xE4,0x20,0x61,0x10,0x29,0x4A,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0xA2,0x18,0xA3,0x18,0x04,0x19,0xA2,0x10,0xC7,0x39,0x65,0x29,0xA2,0x18,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x00,0xA6,0x39,0x30,0x8C,0xF4,0x9C,0xF4,0x9C,0x51,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x10,0x84,0xE3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x20,0x00,0x61,0x08,0x4D,0x73,0x92,0x94,0x14,0xA5,0x92,0x94,0x8A,0x52,
-	0x00,0x00,0x00,0x00,0x51,0x8C,0xF8,0xC5,0x08,0x3A,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0xE3,0x20,0x25,0x29,0xA2,0x10,0x41,0x08,0x41,0x08,0xEF,0x83,0xF3,0xA4,0x72,0x94,0x6D,0x73,0xAA,0x52,0xE7,0x41,0x24,0x29,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x10,0x00,0x00,0x08,0x42,0xA2,0x18,0xA2,0x18,0xE4,0x18,0xA2,0x18,
-	0x82,0x10,0x21,0x08,0x20,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0xE4,0x18,0xE7,0x39,0x55,0xA5,0xD3,0xA4,0x4D,0x6B,0x8E,0x73,0xAA,0x5A,0x92,0x94,0xD3,0x9C,0xD3,0x9C,0xB3,0x9C,0xB2,0x9C,0x34,0xAD,0xAA,0x5A,0x20,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x00,0x00,0x61,0x10,0xE3,0x18,
-	0x61,0x10,0x62,0x08,0xA6,0x31,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0x62,0x10,0xE7,0x39,0x86,0x29,0x62,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x8A,0x5A,0xD3,0x9C,0x10,0x7C,0x10,0x84,0xAB,0x4A,0xC7,0x39,0x0F,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x0F,0x84,0xC3,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x08,0x14,0xA5,0xF8,0xC5,0x96,0xB5,0x55,0xB5,0x96,0xB5,0xF8,0xBD,
-	0x08,0x42,0x00,0x00,0x51,0x8C,0x18,0xBE,0x29,0x4A,0x20,0x08,0x41,0x10,0x21,0x08,0xA3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0xA3,0x18,0x41,0x10,0x41,0x08,0x92,0x94,0xD7,0xBD,0xB7,0xBD,0xD7,0xBD,0x18,0xC6,0x18,0xC6,0xF7,0xC5,0xD3,0x9C,0x69,0x4A,0xE3,0x20,0x61,0x10,0x65,0x29,0xAE,0x83,0x49,0x4A,0xE3,0x20,0xC3,0x18,0xA3,0x18,
-	0x62,0x10,0x4D,0x6B,0x76,0xB5,0xCF,0x7B,0x2C,0x6B,0xC7,0x39,0x41,0x08,0x41,0x08,0x04,0x21,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x72,0x8C,0xD7,0xC5,0xF7,0xC5,0xF7,0xC5,0x18,0xC6,0x76,0xB5,0xB6,0xBD,0xD7,0xBD,0xF8,0xC5,0x18,0xC6,0x7A,0xD6,0xC6,0x39,0x21,0x08,0x42,0x10,0x41,0x08,0x21,0x08,0x00,0x08,0x66,0x31,0xC3,0x18,
-	0x21,0x08,0x41,0x08,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x18,0xE7,0x39,0xA2,0x10,0x20,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x08,0x2C,0x73,0x35,0xA5,0x51,0x8C,0x6E,0x73,0x2C,0x5B,0xCB,0x62,0x55,0xAD,0x76,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x62,0x8E,0x7B,0x14,0xAD,0xA2,0x10,0x42,0x10,0x41,0x10,0x00,0x00,0x4D,0x6B,0x18,0xC6,0x55,0xAD,0xD7,0xBD,0x96,0xB5,0x55,0xAD,0x96,0xB5,
-	0x72,0x8C,0x45,0x31,0xF0,0x83,0xF7,0xBD,0x29,0x42,0x20,0x08,0x41,0x10,0x21,0x08,0xA3,0x18,0xE3,0x18,0x25,0x29,0xE4,0x20,0xC3,0x20,0x41,0x10,0x41,0x08,0x92,0x9C,0xB6,0xB5,0x76,0xB5,0x96,0xAD,0x55,0xAD,0x76,0xB5,0x75,0xB5,0x75,0xB5,0x96,0xB5,0x96,0xB5,0x24,0x29,0x49,0x4A,0x10,0x84,0x66,0x31,0xE4,0x20,0x04,0x21,0xE4,0x20,
-	0x41,0x08,0x31,0x8C,0xB7,0xBD,0x76,0xAD,0x75,0xB5,0x96,0xB5,0xE3,0x18,0x21,0x08,0x82,0x10,0x41,0x10,0x20,0x08,0x82,0x10,0x41,0x08,0xCF,0x7B,0xB6,0xBD,0xB7,0xBD,0x51,0x8C,0xCB,0x52,0xD7,0xBD,0xCE,0x83,0x71,0x8C,0xF7,0xBD,0x18,0xC6,0x75,0xAD,0xA2,0x10,0x21,0x08,0x61,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA3,0x18,0x82,0x10,
-	0x21,0x08,0x21,0x08,0x86,0x31,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xA2,0x18,0xA2,0x10,0x20,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x08,0xCA,0x5A,0x10,0x7C,0x8E,0x73,0xCF,0x7B,0x14,0xA5,0x14,0xA5,0x75,0xAD,0xD3,0x94,0xAB,0x52,0xAB,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x34,0xAD,0x18,0xCE,0x96,0xB5,0xA2,0x10,0x41,0x10,0x41,0x10,0xA2,0x10,0x96,0xBD,0xD7,0xB5,0xF8,0xC5,0xAB,0x52,0xE7,0x41,0xB6,0xB5,0x34,0xAD,
-	0x76,0xAD,0xF4,0xA4,0x34,0xAD,0xB7,0xB5,0x08,0x42,0x20,0x08,0x41,0x08,0x20,0x08,0xE3,0x20,0xE4,0x18,0x04,0x21,0xA2,0x10,0xC3,0x18,0x21,0x08,0xA2,0x18,0x55,0xAD,0x75,0xAD,0x76,0xB5,0x96,0xB5,0x75,0xB5,0x96,0xB5,0x76,0xB5,0x76,0xB5,0x34,0xAD,0x96,0xB5,0xA6,0x31,0x49,0x4A,0x28,0x4A,0x41,0x10,0xA3,0x18,0xA2,0x10,0xA3,0x18,
-	0x82,0x08,0xD3,0x9C,0x75,0xAD,0x35,0xA5,0x55,0xA5,0xD3,0x9C,0x66,0x31,0x20,0x00,0xA2,0x10,0x41,0x08,0x62,0x10,0x45,0x29,0x62,0x10,0x14,0xA5,0x96,0xB5,0x96,0xB5,0x49,0x4A,0x61,0x08,0x34,0xA5,0x8A,0x5A,0x30,0x7C,0xF7,0xC5,0xD7,0xBD,0xE3,0x20,0x41,0x08,0x41,0x10,0x21,0x08,0x00,0x00,0x08,0x42,0x8A,0x5A,0x04,0x21,0x61,0x08,
-	0x41,0x08,0x41,0x10,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x82,0x10,0x04,0x21,0x82,0x10,0x61,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x04,0x21,0x82,0x18,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x25,0x31,0x10,0x84,0x6D,0x6B,0x30,0x8C,0x14,0x9D,0x72,0x8C,0x75,0xAD,0xF4,0x9C,0x4D,0x6B,0xAE,0x83,0xF3,0xA4,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xA3,0x18,0xD2,0x9C,0x96,0xBD,0x55,0xA5,0x82,0x10,0x41,0x10,0x20,0x08,0x45,0x29,0x18,0xC6,0x96,0xB5,0xB6,0xB5,0xC3,0x18,0x00,0x00,0x92,0x94,0x55,0xA5,
-	0x96,0xAD,0x66,0x29,0x8E,0x7B,0xB7,0xBD,0x08,0x42,0x20,0x08,0x41,0x08,0x20,0x08,0x25,0x29,0x45,0x29,0x61,0x10,0x21,0x08,0xE7,0x41,0xE4,0x20,0x04,0x21,0xB6,0xBD,0x34,0xAD,0x55,0xAD,0x35,0xAD,0xC7,0x39,0x0B,0x5B,0x54,0xAD,0x34,0xAD,0x14,0xAD,0x55,0xB5,0x29,0x4A,0x24,0x21,0xAE,0x7B,0xAA,0x5A,0x82,0x10,0x04,0x21,0xE4,0x20,
-	0x82,0x10,0x14,0xA5,0x34,0xAD,0x14,0xA5,0x75,0xAD,0x2D,0x6B,0x49,0x4A,0x21,0x08,0x41,0x10,0x21,0x08,0xA2,0x18,0x25,0x29,0x41,0x08,0xF4,0x9C,0x96,0xAD,0x35,0xAD,0xC3,0x18,0xA3,0x18,0x29,0x42,0x0C,0x63,0x51,0x8C,0xF8,0xBD,0xD7,0xBD,0xA2,0x18,0x41,0x08,0x41,0x10,0x62,0x08,0x20,0x00,0x8E,0x6B,0xD7,0xBD,0xD7,0xBD,0x6D,0x73,
-	0x00,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x08,0x41,0x08,0x62,0x18,0xE3,0x18,0xE4,0x20,0x21,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x21,0x08,0xC3,0x18,0xEB,0x5A,0x4D,0x63,0x89,0x5A,0xB3,0x94,0xCF,0x73,0xF4,0x9C,0x14,0x9D,0xB2,0x8C,0x34,0xAD,0x76,0xAD,0x75,0xAD,0xD3,0xA4,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x29,0x25,0x29,0x82,0x18,0xD3,0x9C,0xB6,0xBD,0x14,0xA5,0xC3,0x18,0x41,0x08,0x00,0x00,0xE7,0x39,0xD7,0xBD,0x76,0xAD,0xD7,0xBD,0x08,0x3A,0x00,0x00,0xF0,0x83,0x96,0xB5,
-	0x96,0xB5,0x69,0x4A,0x6E,0x73,0x96,0xB5,0xC7,0x39,0x20,0x08,0x41,0x10,0x21,0x08,0xA3,0x10,0x08,0x42,0xE8,0x41,0x82,0x10,0x8A,0x5A,0x25,0x29,0x45,0x29,0x18,0xC6,0x75,0xB5,0x55,0xAD,0x96,0xB5,0x65,0x31,0x20,0x00,0xF0,0x83,0x55,0xB5,0x14,0xAD,0x35,0xAD,0x8A,0x52,0xC7,0x39,0x69,0x4A,0x28,0x4A,0x82,0x18,0x82,0x10,0xE4,0x20,
-	0xC3,0x20,0x35,0xA5,0x14,0xAD,0x14,0xA5,0x34,0xA5,0xA6,0x39,0x00,0x00,0x21,0x08,0x61,0x10,0x00,0x00,0xC3,0x20,0x66,0x31,0x41,0x08,0xF4,0x9C,0xB6,0xB5,0xEF,0x83,0x61,0x10,0xC3,0x18,0xE3,0x18,0xC3,0x18,0x76,0xAD,0xD7,0xBD,0x55,0xAD,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xF0,0x83,0x96,0xB5,0x96,0xB5,0x6D,0x73,
-	0x00,0x00,0x20,0x00,0xF0,0x7B,0x92,0x9C,0xCB,0x62,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x62,0x10,0xE4,0x20,0xA2,0x18,0x28,0x42,0xE4,0x18,0x00,0x00,0x82,0x10,0x45,0x29,0x66,0x31,0xE4,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x20,0x08,0xA6,0x39,0x92,0x9C,0xD3,0xA4,0xD3,0x94,0x49,0x42,0x6D,0x6B,0x8E,0x6B,0x30,0x84,0xB3,0x94,0x14,0xA5,0x14,0x9D,0xD3,0x94,0xF4,0xA4,0xF3,0xA4,0xD3,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB7,0xBD,0x66,0x29,0x45,0x29,0xC3,0x20,0x14,0xAD,0xB6,0xBD,0xF8,0xC5,0xA6,0x31,0x00,0x00,0x00,0x00,0xA6,0x39,0xB7,0xBD,0x96,0xB5,0x10,0x7C,0x00,0x00,0x00,0x00,0x10,0x84,0x75,0xAD,
-	0x55,0xAD,0xCB,0x52,0xAF,0x7B,0xB6,0xB5,0xA6,0x31,0x20,0x08,0x21,0x08,0x61,0x08,0xA3,0x18,0x25,0x29,0xE8,0x41,0x86,0x31,0xA3,0x18,0x20,0x00,0xA6,0x39,0xF7,0xC5,0x76,0xB5,0xF7,0xC5,0xCB,0x5A,0xAA,0x5A,0x8E,0x73,0x0C,0x6B,0x55,0xAD,0xF4,0xA4,0x55,0xAD,0x86,0x31,0xAF,0x7B,0xE3,0x20,0xC3,0x20,0xC3,0x18,0x62,0x10,0xE3,0x18,
-	0x04,0x21,0x96,0xB5,0x14,0xA5,0x14,0xA5,0x34,0xAD,0xE3,0x20,0x21,0x08,0x20,0x08,0x04,0x21,0x20,0x00,0xE3,0x18,0xC7,0x39,0xE3,0x20,0x35,0xA5,0xB6,0xBD,0x8A,0x5A,0xC3,0x18,0x25,0x29,0x25,0x29,0xC3,0x18,0xCF,0x7B,0x18,0xC6,0x92,0x9C,0x20,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x31,0x7C,0x96,0xB5,0xB7,0xB5,0xEC,0x62,
-	0x00,0x00,0x28,0x3A,0xF7,0xC5,0xB7,0xB5,0x96,0xB5,0xA2,0x10,0x20,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x20,0x00,0x65,0x29,0xC3,0x10,0x41,0x08,0xEB,0x62,0xC6,0x31,0x82,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x21,0x08,0x62,0x18,0xCF,0x83,0xCF,0x73,0x92,0x8C,0xAF,0x73,0x66,0x29,0xE7,0x41,0x2D,0x6B,0xB3,0x94,0x31,0x84,0x71,0x8C,0x92,0x94,0x55,0xAD,0xF4,0xA4,0xB2,0x94,0xF3,0x9C,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0x86,0x29,0x65,0x29,0xE3,0x18,0x55,0xB5,0xD7,0xBD,0xB7,0xBD,0x04,0x21,0x62,0x10,0x00,0x00,0x08,0x42,0x96,0xB5,0x75,0xAD,0xF0,0x7B,0x00,0x00,0x00,0x00,0x4D,0x73,0x55,0xB5,
-	0x55,0xA5,0x6D,0x6B,0xF0,0x83,0x35,0xA5,0x45,0x21,0x21,0x08,0x41,0x08,0x61,0x08,0x04,0x21,0x04,0x21,0xE4,0x20,0x45,0x29,0xC7,0x41,0x41,0x08,0x65,0x31,0xD7,0xC5,0x96,0xB5,0x18,0xC6,0x69,0x52,0x20,0x00,0x66,0x29,0x0C,0x63,0x55,0xB5,0xD3,0x9C,0x34,0xAD,0xC3,0x18,0xAF,0x7B,0x82,0x10,0x2D,0x63,0x72,0x94,0x20,0x08,0x20,0x00,
-	0xC7,0x39,0x76,0xB5,0x14,0xA5,0x34,0xAD,0x14,0xA5,0xA2,0x10,0x41,0x08,0x41,0x08,0xF0,0x83,0xA3,0x18,0xE3,0x20,0x86,0x31,0xC3,0x18,0x75,0xAD,0xD7,0xBD,0x86,0x31,0xA2,0x18,0x04,0x21,0xE4,0x20,0x24,0x21,0x6E,0x6B,0x39,0xCE,0x8E,0x73,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x6E,0x6B,0x75,0xAD,0x96,0xB5,0x69,0x52,
-	0x82,0x10,0x14,0x9D,0x96,0xB5,0xD7,0xBD,0xEB,0x62,0xAB,0x5A,0x24,0x29,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x20,0x08,0x25,0x29,0x65,0x29,0xA2,0x18,0x8E,0x7B,0xA7,0x29,0x00,0x00,0x41,0x08,0x41,0x10,0x62,0x10,0x62,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x4D,0x6B,0x14,0x9D,0x8E,0x73,0x31,0x8C,0x51,0x84,0xA2,0x18,0x10,0x8C,0x31,0x8C,0x91,0x9C,0xB6,0xBD,0x75,0xB5,0xB7,0xB5,0x96,0xAD,0x92,0x94,0xB2,0x94,0xB3,0x9C,0x72,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xD7,0xB5,0x05,0x21,0x25,0x21,0xE3,0x20,0xB6,0xBD,0xD7,0xC5,0xF8,0xC5,0x04,0x21,0x42,0x10,0x00,0x00,0xCB,0x5A,0xB7,0xBD,0x75,0xAD,0x31,0x7C,0x00,0x00,0x00,0x00,0x2C,0x6B,0x96,0xB5,
-	0x55,0xAD,0x0C,0x5B,0x0C,0x6B,0xF4,0x9C,0xC3,0x18,0x21,0x08,0x21,0x08,0x41,0x10,0xC7,0x31,0xA6,0x31,0x49,0x4A,0xA6,0x39,0x29,0x4A,0x00,0x00,0x65,0x31,0xD7,0xBD,0x75,0xB5,0x38,0xC6,0x8A,0x52,0x00,0x00,0xC2,0x18,0xD3,0xA4,0xF4,0xAC,0xF3,0xAC,0x51,0x94,0xE7,0x39,0x51,0x94,0x28,0x4A,0x65,0x29,0xD3,0x9C,0xE3,0x20,0x04,0x21,
-	0x0C,0x63,0x55,0xAD,0x35,0xAD,0x75,0xAD,0x30,0x8C,0x20,0x00,0x41,0x08,0x20,0x08,0xF0,0x83,0xC3,0x18,0xE4,0x20,0x6D,0x6B,0x45,0x29,0x76,0xB5,0x96,0xB5,0x25,0x29,0xE4,0x20,0xA7,0x39,0xE3,0x20,0x82,0x18,0xAE,0x6B,0x7A,0xD6,0xEC,0x62,0x00,0x00,0x41,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0x8E,0x6B,0x75,0xAD,0x75,0xAD,0x65,0x31,
-	0xC7,0x31,0xB6,0xBD,0x96,0xB5,0x55,0xB5,0x82,0x10,0xE8,0x41,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xA2,0x10,0x44,0x31,0x4D,0x5B,0xC3,0x18,0x21,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x08,0xAA,0x52,0x8E,0x6B,0xCF,0x73,0x6D,0x73,0xF0,0x73,0x28,0x3A,0x86,0x39,0xB3,0x9C,0x14,0xAD,0x14,0xA5,0x14,0x9D,0x55,0xA5,0xF3,0x9C,0x92,0x94,0x51,0x8C,0x14,0xA5,0x92,0x94,0xB2,0x94,0x92,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0x55,0xB5,0x04,0x19,0x04,0x29,0x45,0x29,0xB6,0xBD,0xB7,0xB5,0x18,0xC6,0xA6,0x31,0x00,0x00,0x00,0x00,0x49,0x4A,0x96,0xB5,0x75,0xAD,0x51,0x8C,0x00,0x00,0x00,0x00,0xEB,0x62,0x76,0xAD,
-	0x35,0xA5,0xEC,0x62,0x0C,0x63,0xD3,0x9C,0xA2,0x10,0x20,0x08,0x41,0x08,0x61,0x10,0xC3,0x18,0x25,0x29,0x65,0x31,0xE4,0x18,0x28,0x4A,0x20,0x00,0x45,0x29,0xD7,0xBD,0x96,0xBD,0x96,0xBD,0xD7,0xBD,0xD6,0xBD,0xD7,0xBD,0xD7,0xBD,0x34,0xB5,0xF8,0xC5,0x2C,0x6B,0x08,0x42,0x6E,0x73,0x45,0x29,0xC3,0x18,0x0C,0x63,0x82,0x10,0x41,0x08,
-	0xEF,0x83,0x14,0xA5,0x14,0xAD,0x75,0xB5,0xAB,0x5A,0x21,0x08,0x41,0x10,0x00,0x00,0x86,0x31,0x62,0x10,0xE3,0x20,0x29,0x4A,0x04,0x21,0xB7,0xBD,0x75,0xB5,0xE3,0x18,0x25,0x21,0x8A,0x5A,0x04,0x21,0x82,0x10,0x4D,0x63,0x59,0xCE,0xC7,0x39,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x4D,0x6B,0x76,0xAD,0xB6,0xB5,0x45,0x29,
-	0x30,0x84,0xB7,0xB5,0xD7,0xBD,0x49,0x4A,0xC3,0x18,0x04,0x21,0x00,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x66,0x39,0x4D,0x5B,0x61,0x08,0x20,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x62,0x10,0x92,0x94,0x8E,0x6B,0xD3,0xA4,0xF3,0x9C,0xAA,0x52,0x00,0x00,0x0C,0x6B,0x96,0xB5,0x55,0xAD,0x92,0x8C,0x10,0x84,0x14,0xA5,0x35,0xA5,0x14,0xA5,0x92,0x94,0x31,0x7C,0xB3,0x94,0x14,0xA5,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xB6,0xBD,0x55,0xAD,0xE3,0x18,0xC3,0x18,0x86,0x39,0x18,0xCE,0x76,0xB5,0x96,0xB5,0xB6,0xBD,0x69,0x52,0x00,0x00,0x69,0x4A,0xB6,0xB5,0x75,0xB5,0x51,0x84,0x00,0x00,0x00,0x00,0x0B,0x6B,0x55,0xAD,
-	0x55,0xAD,0x2C,0x63,0x45,0x29,0x6E,0x73,0x82,0x10,0x20,0x08,0x21,0x08,0x82,0x10,0x04,0x21,0x04,0x21,0xC3,0x20,0x45,0x31,0x25,0x29,0x00,0x00,0x86,0x39,0xD7,0xBD,0xB6,0xB5,0x75,0xB5,0x75,0xAD,0xB7,0xBD,0xD7,0xBD,0x96,0xB5,0x18,0xC6,0x35,0xAD,0xA6,0x39,0xAF,0x7B,0x0C,0x63,0xA3,0x18,0x25,0x29,0xC3,0x18,0xC3,0x18,0xA3,0x18,
-	0x14,0xA5,0x14,0xA5,0xF4,0xA4,0x76,0xB5,0x65,0x29,0x21,0x08,0x41,0x10,0x20,0x08,0xC3,0x18,0x41,0x10,0x62,0x10,0x82,0x10,0x86,0x31,0xF8,0xBD,0x31,0x8C,0xA2,0x10,0x04,0x29,0xCB,0x5A,0xE3,0x20,0x82,0x10,0x8E,0x73,0x18,0xC6,0x04,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xEB,0x52,0x96,0xB5,0x76,0xB5,0xA6,0x39,
-	0x96,0xB5,0x18,0xBE,0x14,0xA5,0x61,0x08,0xE4,0x20,0xC3,0x18,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x00,0xC3,0x20,0x49,0x42,0x41,0x08,0x41,0x08,0xC3,0x20,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x00,
-	0x08,0x42,0x55,0xAD,0x35,0xA5,0xD3,0xA4,0x30,0x84,0x4D,0x6B,0xA2,0x18,0x14,0xA5,0xEF,0x73,0xF4,0x9C,0xAE,0x6B,0xEF,0x7B,0x8E,0x7B,0xAE,0x7B,0x4D,0x73,0x69,0x5A,0x8A,0x52,0x49,0x52,0x49,0x42,0x08,0x3A,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB7,0xBD,0xB6,0xBD,0x35,0xA5,0xEC,0x62,0xCF,0x7B,0xE7,0x41,0x18,0xCE,0x96,0xBD,0x75,0xB5,0x92,0x94,0x45,0x29,0x00,0x00,0x86,0x31,0x96,0xB5,0x55,0xAD,0xF4,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0x76,0xB5,
-	0x35,0xAD,0x49,0x4A,0x65,0x31,0x20,0x00,0x21,0x08,0x41,0x08,0x21,0x08,0xE4,0x20,0x04,0x21,0xE4,0x20,0xC3,0x18,0x65,0x29,0x45,0x31,0x00,0x00,0xE7,0x41,0x96,0xBD,0x75,0xB5,0x75,0xB5,0xB2,0x9C,0x76,0xB5,0xB7,0xBD,0x55,0xAD,0x8E,0x73,0x61,0x08,0x82,0x10,0x55,0xB5,0x2D,0x6B,0x82,0x10,0x25,0x29,0x82,0x10,0xA2,0x18,0x86,0x31,
-	0x75,0xB5,0xF3,0xA4,0xF3,0xA4,0x14,0xA5,0x41,0x08,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x82,0x10,0x61,0x08,0x49,0x4A,0x39,0xCE,0x28,0x4A,0xA3,0x18,0x24,0x21,0x2C,0x6B,0x82,0x10,0x20,0x00,0x4D,0x6B,0x55,0xB5,0x20,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xAB,0x52,0x75,0xAD,0x55,0xAD,0x10,0x7C,
-	0x75,0xAD,0x59,0xCE,0x65,0x31,0x21,0x08,0xA2,0x10,0xA2,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x28,0x42,0x61,0x08,0x04,0x19,0x61,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,
-	0xE7,0x39,0x35,0xA5,0xD3,0x94,0xB3,0x8C,0x0C,0x6B,0xEC,0x52,0xE3,0x20,0xF3,0xA4,0x72,0x94,0xB3,0x9C,0x71,0x94,0x10,0x7C,0xF8,0xBD,0x55,0xAD,0x96,0xB5,0xF4,0xA4,0xB3,0x94,0xB6,0xB5,0x55,0xB5,0x55,0xAD,0x34,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xD7,0xBD,0xB6,0xB5,0x76,0xAD,0x66,0x31,0x45,0x29,0xE3,0x20,0xB6,0xBD,0xB7,0xBD,0xD7,0xBD,0x8A,0x52,0x00,0x00,0x00,0x08,0x65,0x29,0xB6,0xB5,0x75,0xAD,0xF4,0x9C,0x01,0x08,0x00,0x00,0x2D,0x6B,0x76,0xAD,
-	0x34,0xA5,0x66,0x31,0x66,0x31,0x45,0x29,0x20,0x08,0x41,0x08,0x41,0x08,0xA3,0x10,0xC3,0x18,0x24,0x21,0xC3,0x18,0x29,0x4A,0xC7,0x41,0x00,0x00,0x08,0x42,0x96,0xB5,0x55,0xAD,0x55,0xAD,0x61,0x10,0xA2,0x10,0xC3,0x18,0x82,0x10,0x21,0x08,0x82,0x10,0x41,0x08,0xEF,0x7B,0x4D,0x6B,0x65,0x29,0x86,0x31,0xE4,0x20,0xE3,0x20,0x2C,0x63,
-	0xD7,0xB5,0x35,0xAD,0xF3,0xA4,0xF0,0x83,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x04,0x21,0x83,0x18,0xCB,0x5A,0x39,0xCE,0x66,0x31,0x45,0x29,0x49,0x42,0x6E,0x73,0x82,0x10,0x61,0x10,0xAE,0x73,0x34,0xAD,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x4A,0x96,0xB5,0x35,0xAD,0xF4,0x9C,
-	0x35,0xA5,0x4D,0x73,0x00,0x00,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x45,0x29,0xC3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0xE3,0x20,
-	0xB2,0x9C,0x31,0x84,0xAF,0x7B,0x92,0x94,0x10,0x7C,0x28,0x42,0x04,0x21,0x35,0xAD,0xF4,0x9C,0x35,0xAD,0x35,0xAD,0x14,0xA5,0x35,0xA5,0x55,0xA5,0xD3,0x9C,0x72,0x8C,0x72,0x8C,0x72,0x94,0x14,0xA5,0x14,0xA5,0x34,0xAD,0x34,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xD7,0xB5,0x75,0xB5,0x75,0xAD,0x04,0x19,0x65,0x29,0x24,0x29,0xB6,0xBD,0xB6,0xBD,0xB7,0xBD,0xAF,0x73,0x00,0x00,0x41,0x10,0xC3,0x18,0x55,0xB5,0x76,0xAD,0xF4,0x9C,0x20,0x08,0x00,0x00,0x8E,0x73,0x35,0xAD,
-	0x14,0xA5,0x24,0x21,0xCB,0x5A,0x69,0x4A,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0xA3,0x18,0xC3,0x18,0xC3,0x18,0x65,0x29,0xE3,0x18,0x00,0x00,0x49,0x4A,0x96,0xB5,0x55,0xAD,0x92,0x94,0x00,0x00,0x21,0x08,0x41,0x10,0x21,0x08,0x86,0x39,0xE3,0x20,0x82,0x10,0xA7,0x31,0x6A,0x4A,0xE4,0x20,0xC3,0x20,0xC3,0x18,0xC3,0x18,0x72,0x94,
-	0xD3,0x9C,0xB2,0x9C,0x75,0xAD,0xAB,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x86,0x31,0x82,0x10,0x8E,0x6B,0xB2,0x9C,0x61,0x10,0x61,0x10,0xAA,0x52,0x0C,0x63,0xC3,0x18,0x82,0x10,0x8E,0x6B,0x51,0x94,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x4A,0xB7,0xBD,0xD3,0x9C,0xD3,0x9C,
-	0xF3,0xA4,0xA2,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x45,0x29,0xE4,0x20,0xC3,0x18,0x20,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x00,0x49,0x52,
-	0x14,0x9D,0xF3,0x9C,0x51,0x8C,0x92,0x8C,0x0D,0x5B,0x45,0x29,0x66,0x31,0x96,0xB5,0x75,0xB5,0x76,0xAD,0x75,0xAD,0x55,0xAD,0x34,0xA5,0x34,0xA5,0xD3,0xA4,0xEF,0x83,0xEF,0x83,0x55,0xAD,0x14,0xAD,0x14,0xAD,0x14,0xAD,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x39,0x55,0xB5,0xF7,0xBD,0x75,0xB5,0x96,0xAD,0x04,0x21,0x24,0x29,0x24,0x29,0xB6,0xBD,0xD7,0xBD,0xB6,0xBD,0x35,0xA5,0x00,0x00,0x41,0x08,0x41,0x08,0xB2,0x9C,0x34,0xAD,0x96,0xB5,0xC7,0x39,0x41,0x08,0xB3,0x9C,0xF3,0x9C,
-	0xD3,0x9C,0xA2,0x10,0x45,0x29,0xA2,0x10,0x20,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xC7,0x39,0x8A,0x5A,0x41,0x08,0xAA,0x5A,0x96,0xB5,0x75,0xAD,0x92,0x94,0x00,0x00,0x20,0x08,0x41,0x10,0x00,0x00,0xE8,0x41,0xA2,0x10,0x82,0x18,0xE7,0x41,0x08,0x42,0xA2,0x10,0x04,0x29,0xC3,0x20,0x82,0x10,0xF4,0x9C,
-	0xF3,0xA4,0xD3,0x9C,0x75,0xB5,0x65,0x29,0x00,0x00,0x20,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0x00,0x00,0x86,0x31,0x61,0x08,0x92,0x94,0x8E,0x7B,0x82,0x10,0xE4,0x20,0xC3,0x18,0xC3,0x20,0x04,0x21,0x41,0x08,0x2C,0x63,0xAB,0x5A,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x69,0x4A,0xB7,0xB5,0xD3,0x9C,0xF4,0xA4,
-	0xCB,0x5A,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x18,0x66,0x29,0x04,0x21,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x4D,0x6B,
-	0xAB,0x52,0xCF,0x7B,0x30,0x8C,0x6D,0x6B,0xCB,0x5A,0xE7,0x39,0x04,0x21,0x96,0xB5,0x72,0x8C,0xF3,0xA4,0xF4,0xA4,0x55,0xAD,0xF3,0xA4,0x75,0xAD,0xF4,0x9C,0x8E,0x6B,0x10,0x7C,0xD3,0x9C,0x14,0xAD,0x34,0xA5,0x34,0xA5,0x34,0xAD,0x55,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x52,0x55,0xAD,0xF7,0xBD,0x95,0xB5,0x55,0xAD,0x04,0x21,0x04,0x21,0x04,0x29,0x75,0xB5,0xD7,0xBD,0xD7,0xBD,0x18,0xC6,0x65,0x31,0x41,0x08,0x21,0x08,0x29,0x4A,0xD7,0xBD,0x35,0xA5,0x34,0xAD,0xB2,0x9C,0x35,0xB5,0x34,0xA5,
-	0xAF,0x73,0x20,0x08,0x08,0x42,0x86,0x31,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0xA2,0x10,0x04,0x21,0x86,0x31,0xC3,0x20,0x20,0x00,0x2C,0x6B,0x76,0xB5,0x55,0xB5,0x71,0x8C,0x00,0x08,0x21,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x28,0x4A,0x45,0x29,0x82,0x10,0xA2,0x18,0x41,0x08,0xA2,0x10,0x66,0x29,0x96,0xAD,
-	0x76,0xAD,0x35,0xA5,0x55,0xAD,0x10,0x84,0x8A,0x52,0x45,0x29,0xC3,0x18,0x41,0x08,0xC3,0x18,0xCB,0x5A,0x8E,0x73,0xC7,0x39,0x76,0xAD,0x28,0x4A,0xC3,0x18,0x04,0x21,0xE4,0x20,0x04,0x21,0xE3,0x18,0x25,0x21,0xD3,0x94,0x86,0x39,0x00,0x00,0x41,0x10,0x41,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x08,0x3A,0x96,0xB5,0x92,0x94,0x10,0x84,
-	0x20,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x20,0x45,0x29,0x41,0x08,0x04,0x21,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x86,0x31,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0xC7,0x41,
-	0xEF,0x83,0x34,0xAD,0x72,0x8C,0x4D,0x6B,0x2C,0x63,0x25,0x21,0xC3,0x18,0x35,0xAD,0x55,0xAD,0x55,0xAD,0x14,0xA5,0x14,0xA5,0x92,0x8C,0x51,0x8C,0xD0,0x7B,0x4D,0x73,0x71,0x94,0x14,0xA5,0x34,0xA5,0x14,0xAD,0x14,0xA5,0x34,0xAD,0x72,0x8C,0xF3,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x41,0x96,0xB5,0xD7,0xBD,0x34,0xB5,0x75,0xB5,0x51,0x94,0x51,0x8C,0x91,0x94,0xB6,0xBD,0xB7,0xBD,0xB6,0xBD,0x18,0xCE,0xEC,0x5A,0x21,0x08,0x41,0x08,0x41,0x08,0x2D,0x6B,0xB6,0xBD,0x96,0xBD,0x96,0xB5,0x75,0xB5,0xF4,0x9C,
-	0xC3,0x18,0x00,0x00,0x24,0x21,0xC3,0x18,0x20,0x08,0x41,0x10,0x21,0x08,0x62,0x10,0x04,0x19,0xA2,0x10,0xA2,0x10,0x04,0x21,0x6A,0x52,0x20,0x08,0x8A,0x5A,0x14,0xAD,0x96,0xB5,0x72,0x8C,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0xA3,0x10,0xE4,0x78,0x41,0x98,0x41,0x98,0x42,0x98,0x22,0x80,0x21,0x70,0xA3,0x78,0x4A,0xB2,
-	0x6A,0xAA,0xCB,0xAA,0x6E,0xAB,0x8E,0xAB,0x14,0xA5,0x75,0xB5,0x14,0xA5,0x51,0x8C,0x4D,0x73,0x08,0x4A,0xE7,0x41,0xE3,0x18,0x96,0xB5,0x04,0x29,0xA3,0x18,0x25,0x21,0xF4,0xA4,0xC7,0x41,0xA2,0x10,0xE4,0x18,0x71,0x8C,0x24,0x21,0x00,0x00,0x20,0x08,0x00,0x08,0x6A,0x4A,0x4D,0x6B,0xE7,0x41,0x51,0x84,0x55,0xAD,0x92,0x9C,0xA6,0x39,
-	0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x08,0xC3,0x18,0xE3,0x20,0x66,0x29,0x41,0x08,0x25,0x29,0x21,0x08,0x00,0x08,0x69,0x4A,0x65,0x29,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x04,0x21,0x51,0x8C,
-	0x30,0x84,0x72,0x8C,0x2C,0x63,0xCF,0x73,0xC7,0x31,0xA2,0x10,0x61,0x10,0xD3,0xA4,0x75,0xAD,0x34,0xA5,0x14,0xA5,0xCF,0x73,0x92,0x8C,0xAF,0x73,0xAF,0x73,0xB2,0x9C,0x55,0xAD,0xD3,0xA4,0x14,0xA5,0x14,0xA5,0x34,0xA5,0x51,0x8C,0x71,0x94,0x55,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x01,0x08,0x24,0x21,0x75,0xB5,0xD7,0xBD,0x75,0xB5,0x55,0xB5,0xB7,0xBD,0xD7,0xBD,0xB6,0xBD,0x96,0xBD,0x96,0xBD,0xB7,0xBD,0xF7,0xBD,0xAE,0x73,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x00,0xE7,0x39,0x0C,0x63,0x2D,0x6B,0x69,0x52,0xA3,0x18,
-	0x20,0x00,0x21,0x08,0x61,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0xE4,0x20,0xA3,0x18,0xC3,0x18,0xC7,0x39,0x82,0x10,0x62,0x10,0x20,0x00,0x00,0x00,0x62,0x10,0xC3,0x20,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x08,0x41,0x00,0x82,0x88,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,
-	0xC3,0xA8,0x8E,0xAB,0x04,0xA1,0x69,0xAA,0xD3,0x9C,0xD3,0x9C,0x34,0xA5,0xF3,0xA4,0x55,0xB5,0xE8,0x41,0x45,0x29,0xA6,0x39,0xD3,0x9C,0x82,0x10,0xE3,0x20,0xA7,0x39,0x79,0xD6,0xAB,0x5A,0x00,0x00,0x00,0x00,0xAF,0x7B,0xA6,0x31,0x8E,0x7B,0x82,0x18,0x61,0x08,0xB3,0x94,0x96,0xB5,0xB7,0xBD,0x75,0xAD,0xF3,0xA4,0x72,0x94,0xC3,0x18,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x65,0x29,0xA2,0x18,0xA2,0x10,0x86,0x31,0xE4,0x20,0x00,0x00,0x04,0x21,0x6A,0x42,0xA3,0x18,0x65,0x29,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xC7,0x41,0x0C,0x63,
-	0xCB,0x5A,0xE8,0x39,0xAF,0x7B,0x29,0x3A,0xC7,0x39,0xA2,0x18,0x41,0x08,0xB2,0x9C,0x55,0xA5,0x35,0xA5,0x34,0xA5,0xC7,0x39,0x6D,0x73,0x10,0x84,0x10,0x84,0x55,0xAD,0x34,0xA5,0x14,0xA5,0x14,0xAD,0x14,0xA5,0x14,0xA5,0xCF,0x7B,0x95,0xB5,0x55,0xAD,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x21,0x08,0x20,0x08,0x71,0x94,0x18,0xC6,0x55,0xAD,0x76,0xB5,0x76,0xB5,0x96,0xBD,0x96,0xBD,0x76,0xB5,0x76,0xB5,0x96,0xB5,0x18,0xC6,0x2C,0x6B,0x00,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x62,0x10,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE4,0x20,0xE3,0x18,0x25,0x29,0x49,0x4A,0x49,0x4A,0x86,0x31,0x04,0x21,0xC3,0x20,0xC3,0x18,0x82,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0xE3,0x20,0x25,0x29,0x04,0x19,0x62,0x98,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x62,0x88,0x00,0xB0,0x00,0xA8,0x00,0xB8,
-	0x41,0xA8,0x6A,0x62,0x6E,0x6B,0xEF,0x83,0xD3,0x9C,0x76,0xB5,0xB7,0xBD,0x96,0xBD,0x2C,0x93,0xC3,0x18,0xE7,0x41,0xF0,0x7B,0x51,0x8C,0x04,0x21,0x45,0x69,0x08,0x42,0x59,0xCE,0x28,0x4A,0x82,0x10,0x82,0x10,0x6E,0x73,0x76,0xB5,0x34,0xAD,0xA2,0x18,0xC7,0x31,0x96,0xB5,0x55,0xAD,0x35,0xA5,0x55,0xAD,0x34,0xAD,0x10,0x8C,0xA3,0x18,
-	0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x08,0x49,0x4A,0x82,0x10,0x20,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x28,0x4A,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x0C,0x6B,0x31,0x8C,
-	0x30,0x84,0xCB,0x62,0x10,0x84,0x08,0x42,0x25,0x29,0x25,0x29,0x61,0x08,0xB2,0x9C,0x92,0x94,0x75,0xAD,0x14,0xA5,0x34,0xA5,0x8E,0x73,0x2D,0x63,0x96,0xB5,0x14,0xAD,0xF3,0x9C,0x92,0x94,0x75,0xAD,0x35,0xAD,0xD3,0x94,0x51,0x94,0x35,0xAD,0x34,0xAD,0x71,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x45,0x29,0xD7,0xBD,0xB7,0xB5,0x55,0xB5,0x96,0xB5,0x96,0xBD,0xB6,0xBD,0x96,0xB5,0x75,0xB5,0x75,0xB5,0xD7,0xBD,0xEC,0x5A,0x08,0x42,0x00,0x00,0xA2,0x18,0x69,0x52,0x45,0x29,0x62,0x10,0x66,0x31,0x08,0x42,0x0C,0x63,
-	0x00,0x08,0x86,0x31,0xA6,0x31,0x20,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0xC3,0x10,0xC3,0x18,0x24,0x21,0xC3,0x18,0xA3,0x10,0x29,0x4A,0xCB,0x5A,0xE4,0x20,0x82,0x10,0xC3,0x18,0xA2,0x10,0xC3,0x18,0xE4,0x18,0xA2,0x18,0x62,0x10,0xA3,0x18,0xE3,0x18,0x62,0x98,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x62,0xA0,0x00,0xB0,0x00,0xB0,0x01,0x98,
-	0x01,0xA8,0x20,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x25,0x29,0x49,0x4A,0xCF,0x7B,0x08,0x6A,0x25,0x29,0x0C,0x63,0x10,0x8C,0x86,0xA9,0xA4,0xB0,0x8A,0x72,0x92,0x8C,0x18,0xC6,0x8E,0x7B,0xA7,0x39,0xC7,0x39,0xB3,0x94,0x96,0xB5,0x96,0xB5,0xEF,0x83,0x31,0x8C,0x71,0x8C,0xB2,0x9C,0x55,0xAD,0x96,0xAD,0xCF,0x7B,0x25,0x21,0x61,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA2,0x10,0xCB,0x5A,0x82,0x10,0x20,0x08,0x41,0x08,0x65,0x29,0xA2,0x18,0xEB,0x5A,0xA2,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x82,0x10,0x82,0x18,0x41,0x08,0xCF,0x83,0x72,0x94,
-	0x2D,0x63,0x10,0x84,0xAE,0x73,0xA6,0x31,0x8A,0x52,0x61,0x08,0x82,0x10,0xD3,0xA4,0xD3,0x94,0xF4,0x9C,0xAE,0x73,0xB3,0x9C,0x13,0xAD,0xAA,0x5A,0x29,0x42,0x75,0xAD,0x75,0xB5,0xCF,0x83,0x72,0x8C,0x96,0xAD,0xAE,0x7B,0x14,0xA5,0x35,0xAD,0x55,0xAD,0x34,0xAD,0x34,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x49,0x52,0xCF,0x7B,0xD3,0x94,0xD3,0x9C,0xF4,0xA4,0xB2,0x9C,0xF3,0xA4,0x34,0xA5,0xAF,0x73,0xCF,0x7B,0x86,0x29,0x41,0x08,0xC7,0x39,0xA3,0x18,0x82,0x10,0x28,0x4A,0xC3,0x18,0x71,0x8C,0x72,0xB4,0x62,0x98,
-	0x00,0x80,0x62,0x80,0x62,0x78,0x01,0x70,0x21,0x80,0x01,0x78,0x44,0x91,0xA3,0x78,0x41,0x68,0x62,0x68,0x82,0x58,0x85,0x79,0x4D,0x9B,0x8E,0x6B,0xA3,0x18,0x24,0x29,0xC3,0x18,0x82,0x18,0xC3,0x18,0x45,0x29,0xA2,0x10,0x62,0x10,0x82,0x10,0xC3,0x10,0x21,0xA0,0x00,0xA8,0x00,0xB0,0x21,0x70,0x00,0xB0,0x00,0xB0,0x21,0x98,0x62,0x90,
-	0x21,0x50,0x41,0x00,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x49,0x4A,0xE8,0x41,0x41,0x70,0x66,0xA9,0x66,0xB1,0x29,0xBA,0xF3,0x9C,0xD3,0x9C,0x55,0xAD,0xB7,0xBD,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x55,0xB5,0x75,0xAD,0x55,0xAD,0x72,0x94,0x2C,0x6B,0xCB,0x5A,0x65,0x31,0x21,0x08,0xA2,0x18,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x00,0xA3,0x18,0x6D,0x6B,0xA2,0x10,0x41,0x00,0x41,0x10,0x41,0x08,0x61,0x10,0xC7,0x31,0x04,0x21,0x08,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x10,0x84,0x72,0x8C,
-	0x49,0x4A,0x10,0x7C,0x2C,0x6B,0xAA,0x52,0x86,0x29,0x41,0x08,0x24,0x29,0x13,0xA5,0x34,0xA5,0xEB,0x5A,0xCF,0x83,0x14,0xAD,0x14,0xA5,0x55,0xA5,0x92,0x94,0xAB,0x52,0x92,0x94,0x10,0x84,0x92,0x94,0x34,0xA5,0xCF,0x7B,0x14,0xAD,0x35,0xAD,0x34,0xA5,0x35,0xA5,0x34,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0x00,0x00,0x00,0x00,0xE4,0x20,0xA6,0x39,0x00,0x00,0x82,0x10,0x8A,0x52,0x04,0x21,0x20,0x00,0x86,0x39,0x45,0x29,0x21,0x08,0xE7,0x41,0x25,0x29,0x41,0x08,0xCF,0x7B,0x4D,0x6B,0x4D,0x63,0xEC,0x8A,0x21,0x98,
-	0x00,0xA0,0x00,0x98,0x01,0x98,0x01,0x80,0x01,0x78,0x83,0xA8,0x88,0xC2,0xA3,0xB8,0x01,0xB8,0x00,0xC0,0x41,0xA0,0x47,0xE2,0xEA,0xC2,0x6E,0x73,0x04,0x21,0x08,0x42,0xA3,0x18,0xA2,0x18,0x62,0x10,0x04,0x21,0xA2,0x18,0x04,0x21,0xC3,0x18,0x04,0x21,0x21,0xA0,0x00,0xA8,0x00,0xA8,0x41,0x48,0x21,0x48,0x82,0x28,0xE3,0x18,0x21,0x10,
-	0x41,0x00,0x41,0x08,0x41,0x10,0x61,0x10,0x82,0x10,0x20,0x08,0x21,0x08,0x82,0x10,0xE4,0x20,0x4D,0x73,0xE3,0x20,0xA3,0x70,0x21,0xB0,0x83,0xA8,0x6A,0xA2,0xCF,0x73,0x92,0x94,0x75,0xB5,0xF7,0xBD,0xF4,0x9C,0x14,0x9D,0x96,0xB5,0x76,0xB5,0x35,0xAD,0x35,0xAD,0x55,0xAD,0x96,0xB5,0x76,0xB5,0x35,0xAD,0xAF,0x7B,0x41,0x08,0x00,0x00,
-	0x20,0x00,0x20,0x08,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x41,0x08,0x45,0x39,0xAF,0x6B,0xA2,0x10,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x42,0x10,0x20,0x08,0x41,0x08,0x20,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x08,0x82,0x18,0x92,0x94,0x2C,0x63,
-	0x6E,0x73,0x30,0x84,0x0C,0x5B,0xC7,0x39,0xA2,0x10,0xC3,0x18,0xD2,0x9C,0x76,0xB5,0x55,0xAD,0xAF,0x7B,0xF3,0x9C,0xF3,0xA4,0xF3,0xA4,0x14,0xA5,0x14,0xA5,0x51,0x8C,0xEB,0x62,0x71,0x8C,0x4D,0x63,0xE7,0x39,0x2D,0x5B,0xF3,0x9C,0x55,0xA5,0x95,0xB5,0x96,0xB5,0x96,0xB5,0x75,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x08,0xE4,0x20,0x65,0x29,0x61,0x08,0x00,0x00,0xC7,0x39,0x61,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0xC7,0x39,0xCB,0x62,0x2D,0x6B,0xA2,0x10,0x00,0x00,0x00,0x08,0x20,0x08,0xA7,0x31,0x82,0x10,0x00,0x00,0x00,0x28,0x01,0xA0,
-	0x01,0x98,0x01,0x88,0x00,0x98,0x21,0x50,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x18,0x41,0x30,0x21,0x98,0xA3,0x70,0xA5,0xC9,0x28,0x9A,0x86,0x31,0xE3,0x20,0xA2,0x18,0xA2,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x20,0x00,0x61,0x10,0xA3,0x10,0x82,0x20,0x01,0xA8,0x00,0xB0,0x00,0xA8,0x00,0xB0,0x00,0xA0,0x01,0xA8,0x41,0xA0,0x21,0x80,
-	0x21,0x00,0x20,0x08,0x41,0x08,0xA2,0x18,0x86,0x31,0x86,0x31,0x08,0x42,0x14,0xA5,0x51,0x94,0x08,0x4A,0x40,0x10,0xAF,0x83,0x2C,0xBB,0x2C,0xBB,0xB6,0xBD,0xCF,0x7B,0x66,0x31,0x24,0x29,0xEB,0x62,0x10,0x84,0x72,0x8C,0x96,0xB5,0xB6,0xB5,0x76,0xB5,0x55,0xAD,0x35,0xAD,0x35,0xAD,0x55,0xAD,0xF4,0x9C,0xB3,0x9C,0x8E,0x73,0x0C,0x63,
-	0x0C,0x63,0x28,0x4A,0x25,0x29,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x45,0x29,0xC7,0x39,0xCB,0x52,0x82,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x08,0x41,0x08,0x92,0x94,0xEC,0x5A,
-	0x8E,0x7B,0xAF,0x73,0x85,0x29,0x45,0x29,0x30,0x8C,0xB2,0x94,0xF4,0x9C,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x55,0xAD,0x35,0xAD,0x92,0x94,0x14,0xA5,0x14,0xA5,0x72,0x94,0x71,0x94,0xAF,0x83,0x14,0xA5,0xCF,0x7B,0x4C,0x73,0xE7,0x41,0xC7,0x39,0x08,0x3A,0xE7,0x31,0xCB,0x52,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xE4,0x20,0x08,0x42,0x86,0x31,0x28,0x4A,0xB6,0xBD,0x4D,0x6B,0xF0,0x83,0xB3,0x9C,0x55,0xB5,0xD7,0xBD,0xD7,0xBD,0x96,0xBD,0xD7,0xBD,0x45,0x29,0x41,0x10,0xC3,0x18,0x21,0x08,0x20,0x00,0x21,0x08,0x41,0x08,0x21,0x30,0x00,0xA0,
-	0x01,0x98,0x01,0x98,0x01,0x88,0x20,0x38,0x41,0x00,0x41,0x10,0x41,0x08,0x41,0x20,0x41,0x20,0x21,0x88,0x62,0x80,0xE7,0xC1,0x65,0x71,0xA2,0x10,0xA2,0x18,0xC3,0x18,0xA6,0x39,0xE7,0x41,0x28,0x4A,0x2C,0x6B,0x0F,0x8C,0x71,0x94,0x14,0xA5,0xE7,0x59,0x00,0xB0,0x00,0xA8,0x00,0xB0,0x00,0xA8,0x00,0xA0,0x00,0xA8,0x20,0xA8,0xE3,0x60,
-	0x45,0x29,0x45,0x29,0x21,0x08,0x21,0x08,0x00,0x00,0x25,0x29,0x62,0x10,0x69,0x4A,0x10,0x8C,0xEC,0x6A,0x61,0x28,0x0C,0x63,0x6D,0x63,0x85,0x29,0x61,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x28,0x42,0x18,0xC6,0x55,0xAD,0x76,0xB5,0x14,0xAD,0x31,0x84,0x35,0xAD,0x14,0xA5,0x34,0xAD,0x55,0xAD,0xF3,0x9C,0x92,0x9C,0x92,0x94,0xF0,0x7B,
-	0xF0,0x7B,0x66,0x29,0x04,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x08,0x42,0x04,0x21,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x18,0x61,0x08,0x28,0x4A,0xCF,0x7B,0xAF,0x7B,
-	0x50,0x8C,0x0C,0x63,0x0C,0x6B,0x34,0xAD,0x55,0xAD,0x51,0x8C,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x34,0xA5,0x35,0xAD,0x35,0xAD,0xF4,0xA4,0x92,0x94,0x92,0x94,0x34,0xAD,0x55,0xAD,0x96,0xB5,0x14,0xAD,0x31,0x8C,0x76,0xAD,0xD7,0xBD,0x75,0xB5,0x10,0x8C,0x6D,0x7B,0xCA,0x5A,0x0C,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xA3,0x18,0x8E,0x7B,0xD6,0xBD,0x55,0xB5,0xB6,0xBD,0xB7,0xBD,0xB6,0xBD,0x55,0xAD,0x14,0xAD,0x34,0xAD,0x14,0xAD,0xD3,0x9C,0xA2,0x10,0x21,0x08,0x61,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x00,0x21,0x38,0x00,0xA0,
-	0x01,0x98,0x01,0x88,0x20,0x28,0x41,0x20,0x41,0x08,0x41,0x10,0xE3,0x50,0x41,0x10,0x62,0x30,0x42,0x40,0xA3,0x78,0x65,0x91,0x65,0x81,0x00,0x00,0x92,0x9C,0x34,0xAD,0xF3,0xA4,0x13,0xAD,0x91,0x9C,0x13,0xAD,0xF3,0xA4,0xD2,0xA4,0xB7,0xB5,0x87,0x51,0x00,0xB0,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x21,0xA0,0xC4,0xA8,0x4D,0x93,0x92,0x94,
-	0xCF,0x7B,0xAB,0x52,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x08,0x41,0x08,0x62,0x40,0x41,0x28,0xA2,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0xA7,0x31,0xB6,0xBD,0x96,0xB5,0x96,0xB5,0x55,0xAD,0x14,0xA5,0x34,0xAD,0x34,0xA5,0x14,0xAD,0x34,0xA5,0xB3,0x9C,0xF3,0x9C,0xEC,0x62,0x00,0x00,
-	0xA3,0x18,0x41,0x08,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0xE3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0x8A,0x5A,0x30,0x84,0xAE,0x7B,
-	0x10,0x7C,0xB2,0x9C,0x96,0xAD,0x55,0xAD,0x34,0xA5,0x75,0xB5,0x96,0xB5,0x76,0xAD,0x34,0xAD,0x34,0xAD,0x35,0xAD,0x55,0xAD,0x14,0xA5,0xF4,0xA4,0x14,0xA5,0x35,0xAD,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x92,0x94,0x34,0xAD,0x34,0xAD,0x55,0xAD,0xB2,0x9C,0x55,0xAD,0x55,0xB5,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xA2,0x10,0x45,0x31,0x96,0xBD,0x75,0xB5,0xF4,0x9C,0x04,0x21,0xB2,0xA4,0x51,0x8C,0x8A,0x5A,0x96,0xBD,0x76,0xB5,0xE7,0x39,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x00,0x21,0x38,0x00,0x98,
-	0x00,0x88,0x00,0x98,0x21,0x28,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x30,0x61,0x20,0x41,0x08,0x41,0x20,0x62,0x18,0xA6,0x99,0xE3,0x38,0x00,0x00,0xCF,0x7B,0xF3,0xAC,0xD2,0xA4,0xCB,0x5A,0x91,0x9C,0xCB,0x62,0x71,0x94,0x14,0xAD,0xEF,0x7B,0x82,0x20,0x01,0x98,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x80,0x61,0x18,0x00,0x18,
-	0x00,0x20,0x00,0x18,0x41,0x18,0x41,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x18,0x41,0x18,0x21,0x00,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x00,0x00,0x00,0x08,0x42,0x96,0xB5,0x34,0xAD,0x55,0xB5,0x55,0xB5,0x14,0xAD,0x14,0xA5,0x14,0xAD,0x35,0xAD,0xF4,0xA4,0x72,0x8C,0x92,0x94,0xF4,0xA4,0x45,0x29,
-	0x24,0x29,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x49,0x4A,0xE8,0x39,0xA7,0x39,0xE7,0x41,0x24,0x21,0xC3,0x18,0x82,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0x0C,0x63,0x2D,0x63,0x4D,0x73,
-	0xB3,0x94,0xB2,0x94,0x55,0xAD,0x55,0xAD,0xD3,0x94,0xB2,0x8C,0xD3,0x9C,0x75,0xB5,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xB3,0x94,0xD3,0x94,0x34,0xA5,0xD3,0x9C,0xF4,0x9C,0x55,0xB5,0x55,0xAD,0x35,0xAD,0xF4,0xA4,0x34,0xAD,0x55,0xAD,0x14,0xAD,0x35,0xA5,0x34,0xB5,0x55,0xB5,0xF3,0x9C,0x6E,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x04,0x21,0xE3,0x20,0xE8,0x41,0xB7,0xBD,0x96,0xB5,0xAF,0x73,0xA2,0x10,0x6A,0x52,0x35,0xAD,0xEB,0x62,0x55,0xB5,0x55,0xB5,0xE7,0x41,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x28,0x21,0x38,
-	0x21,0x40,0x21,0x18,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0x41,0x08,0x41,0x10,0x42,0x38,0x41,0x18,0x44,0x69,0x04,0x41,0x41,0x08,0x31,0x8C,0xF3,0xAC,0x31,0x94,0x82,0x10,0xEF,0x8B,0x08,0x42,0x92,0x9C,0x55,0xB5,0x28,0x4A,0x20,0x00,0x41,0x08,0x20,0x70,0x00,0xB0,0x00,0xB0,0x00,0x90,0x00,0xA8,0x01,0xB0,0x01,0xB0,
-	0x01,0xB0,0x01,0xB0,0x01,0xB0,0x01,0xA8,0x01,0xA0,0xA4,0xA8,0x62,0x88,0x00,0x80,0x21,0x68,0x21,0x70,0x21,0x50,0x21,0x50,0x21,0x50,0x41,0x48,0x42,0x40,0x62,0x38,0xA3,0x50,0x62,0x30,0xEB,0x52,0x96,0xB5,0x35,0xAD,0x55,0xB5,0x35,0xAD,0x55,0xAD,0xB7,0xBD,0x96,0xB5,0x55,0xAD,0xF3,0x9C,0x92,0x9C,0xD3,0x94,0x34,0xAD,0xAF,0x7B,
-	0x20,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0xE4,0x18,0xA2,0x10,0x82,0x10,0x61,0x08,0x41,0x08,0x66,0x31,0xA3,0x18,0x21,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x01,0x08,0x04,0x21,0x24,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x82,0x10,0x08,0x42,0x49,0x4A,0x51,0x84,
-	0xB2,0x94,0x92,0x94,0xD3,0x9C,0xF4,0xA4,0x92,0x8C,0x8A,0x4A,0xEB,0x52,0xC7,0x31,0xA7,0x31,0x72,0x84,0x35,0x9D,0xB3,0x94,0x86,0x39,0x04,0x21,0x28,0x3A,0xCB,0x52,0x31,0x84,0xB2,0x9C,0x14,0xA5,0x92,0x8C,0x51,0x84,0x92,0x94,0x96,0xB5,0x96,0xB5,0x76,0xB5,0x55,0xB5,0x35,0xA5,0x35,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0x62,0x08,0x45,0x29,0x96,0xBD,0xB7,0xBD,0xAB,0x5A,0xA3,0x18,0x82,0x10,0xC7,0x39,0x6D,0x73,0xB6,0xBD,0xD7,0xC5,0xC7,0x31,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x00,0x62,0x28,0x42,0x40,
-	0x41,0x20,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x00,0x21,0x08,0x41,0x10,0x41,0x18,0x42,0x40,0x20,0x00,0xC7,0x49,0xC7,0x49,0x20,0x00,0x50,0x94,0x14,0xA5,0x8E,0x73,0x41,0x08,0x86,0x39,0x6A,0x52,0x72,0x94,0x96,0xB5,0xE7,0x41,0x20,0x08,0x41,0x08,0x41,0x48,0x00,0xC0,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0x98,0x00,0x88,
-	0x00,0x88,0x00,0x88,0x00,0x88,0x00,0x90,0x01,0xB8,0x23,0xB8,0x01,0xB0,0x00,0xB0,0x00,0xA8,0x01,0xA8,0x01,0xA8,0x01,0xA8,0x01,0xB0,0x02,0xB8,0x21,0xC0,0x63,0xD0,0xC6,0xD9,0xA5,0xD1,0xEB,0xB2,0xB7,0xB5,0x96,0xB5,0x75,0xB5,0xD7,0xBD,0xD3,0xA4,0xAB,0x5A,0x6E,0x73,0xB2,0x94,0xD3,0x9C,0x71,0x94,0x92,0x94,0x14,0xA5,0x96,0xB5,
-	0xA3,0x18,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xAB,0x5A,0xA7,0x39,0x04,0x29,0x49,0x4A,0x8A,0x52,0x25,0x21,0x61,0x10,0xC3,0x18,0x21,0x08,0x21,0x08,0x62,0x10,0xE4,0x20,0x85,0x29,0xA2,0x10,0x21,0x08,0x82,0x10,0x21,0x08,0x24,0x21,0x2C,0x63,0xE7,0x41,0xAF,0x73,
-	0x2C,0x6B,0x8E,0x6B,0x0C,0x5B,0x08,0x3A,0x82,0x08,0x82,0x10,0xE3,0x18,0x85,0x39,0x04,0x29,0x82,0x10,0x21,0x00,0xAA,0x52,0x71,0x8C,0xD3,0x9C,0xF0,0x83,0x08,0x4A,0xE3,0x18,0x07,0x3A,0x10,0x7C,0x72,0x94,0x71,0x94,0x4D,0x6B,0x8A,0x5A,0xCB,0x52,0xB2,0x8C,0x76,0xB5,0x76,0xB5,0x35,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0xC3,0x18,0x61,0x10,0x24,0x29,0xD7,0xBD,0x18,0xC6,0x86,0x31,0x24,0x29,0x66,0x31,0xA3,0x18,0x24,0x31,0xF8,0xC5,0xF7,0xBD,0xE7,0x39,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x28,0x42,0x40,
-	0x41,0x08,0x41,0x00,0x21,0x50,0x21,0x80,0x01,0x78,0x83,0x58,0x82,0x20,0x41,0x00,0x41,0x18,0x41,0x68,0x41,0x08,0xA2,0x18,0xE4,0x20,0x20,0x00,0x10,0x8C,0x96,0xBD,0x8A,0x52,0x62,0x10,0xA2,0x18,0x04,0x21,0xB3,0x9C,0x75,0xB5,0x86,0x31,0x20,0x08,0x61,0x08,0x21,0x50,0x00,0xC0,0x00,0xA8,0x00,0xB0,0x00,0xB8,0x21,0x40,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x22,0xA8,0x01,0xA8,0x00,0x98,0x00,0xB8,0x21,0x48,0x20,0x10,0x41,0x10,0x41,0x18,0x41,0x18,0x41,0x18,0x83,0x90,0x63,0xC0,0xA5,0xC9,0x27,0xD2,0x0B,0xCB,0xB6,0xB5,0x96,0xB5,0x75,0xB5,0xB6,0xB5,0x6E,0x7B,0x20,0x00,0x61,0x10,0xC3,0x18,0xE3,0x20,0x2D,0x6B,0x34,0xA5,0xB6,0xB5,0x18,0xC6,
-	0x86,0x39,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x65,0x29,0x08,0x3A,0xE3,0x18,0x21,0x00,0x04,0x21,0x48,0x42,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x45,0x29,0x21,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0xEB,0x6A,0x86,0x29,0x49,0x4A,0x6E,0x63,
-	0x08,0x3A,0xA2,0x10,0x41,0x08,0xC7,0x39,0xAB,0x5A,0xAB,0x52,0xCF,0x7B,0xD3,0x9C,0x75,0xAD,0x72,0x94,0x2C,0x6B,0x24,0x29,0x61,0x10,0xC3,0x18,0xE8,0x39,0x51,0x8C,0xB6,0xBD,0x8A,0x62,0x04,0x19,0x72,0x84,0x55,0xB5,0x35,0xAD,0x55,0xAD,0x10,0x8C,0x45,0x29,0x86,0x31,0x45,0x21,0x24,0x21,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x65,0x29,0x24,0x21,0x96,0xBD,0x18,0xC6,0x24,0x21,0xE4,0x20,0x04,0x21,0x04,0x21,0xA3,0x18,0x71,0x94,0x18,0xC6,0x08,0x42,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x30,0x42,0x38,
-	0x41,0x08,0x00,0x78,0x00,0xA0,0x00,0xA0,0x00,0xB0,0x63,0xC8,0x65,0xD1,0x42,0x68,0x41,0x18,0x01,0x90,0x21,0x28,0x04,0x29,0x49,0x4A,0x61,0x10,0xCF,0x83,0xB7,0xBD,0xA6,0x31,0xC3,0x18,0xE3,0x18,0x61,0x10,0x4D,0x6B,0x75,0xB5,0x25,0x29,0x21,0x08,0x41,0x08,0x21,0x50,0x00,0xB0,0x00,0xB0,0x00,0xA8,0x00,0xB0,0x42,0x28,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x83,0x80,0x01,0xB0,0x00,0xA8,0x00,0xA8,0x21,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x83,0xA0,0x65,0xC9,0x65,0xC9,0x85,0xC9,0x10,0xAC,0xD7,0xB5,0x96,0xB5,0x76,0xAD,0x96,0xB5,0xEB,0x6A,0x82,0x10,0xE4,0x20,0xE3,0x20,0x21,0x08,0x08,0x3A,0x6E,0x73,0x24,0x29,0xA3,0x10,
-	0x41,0x08,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x00,0x08,0xC3,0x18,0xAB,0x5A,0x45,0x29,0x00,0x00,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x66,0x31,0x41,0x08,0x41,0x10,0x21,0x08,0xC3,0x18,0x71,0x8C,0x82,0x08,0xC7,0x41,0xEC,0x6A,
-	0xF0,0x83,0xB2,0x9C,0xF4,0xA4,0x75,0xAD,0xB2,0x94,0x50,0x8C,0x92,0x9C,0x92,0x9C,0xF3,0xA4,0xD3,0x9C,0x34,0xAD,0x75,0xB5,0x30,0x8C,0x6A,0x52,0x82,0x10,0x00,0x00,0x8A,0x4A,0xD7,0xBD,0xD3,0x9C,0xA7,0x39,0xCF,0x7B,0x31,0x84,0x35,0xA5,0x76,0xB5,0xB7,0xBD,0x10,0x8C,0xAE,0x7B,0xEF,0x83,0x30,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE4,0x20,0x04,0x21,0x45,0x29,0x76,0xB5,0xB6,0xBD,0x04,0x21,0x04,0x29,0x04,0x21,0x04,0x29,0x41,0x08,0xAF,0x7B,0x18,0xC6,0xE7,0x39,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x28,0x21,0x30,
-	0x21,0x40,0x00,0x98,0x01,0x98,0x00,0xA0,0x01,0xA8,0x43,0xC0,0x24,0xC9,0x21,0xC8,0x01,0x98,0x41,0x38,0x41,0x18,0x85,0x49,0x45,0x41,0x82,0x10,0xEF,0x83,0x54,0xB5,0xE4,0x20,0x82,0x10,0x61,0x10,0x41,0x08,0x8A,0x52,0x34,0xAD,0xE4,0x20,0x21,0x08,0x41,0x08,0x21,0x50,0x00,0xB0,0x00,0xA8,0x00,0xA8,0x00,0xB0,0x41,0x20,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x00,0x22,0x68,0x01,0xB8,0x00,0xA8,0x00,0xA0,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x62,0xA8,0xA4,0xC8,0x65,0xC9,0xC6,0xD9,0x10,0xAC,0xB7,0xB5,0x96,0xB5,0x76,0xB5,0xD7,0xBD,0x49,0x4A,0x82,0x10,0xA3,0x18,0xC3,0x18,0x00,0x00,0x6E,0x73,0x8A,0x52,0x00,0x00,0x21,0x08,
-	0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x04,0x21,0xA2,0x10,0x21,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x10,0x00,0x08,0x45,0x29,0xA2,0x10,0x41,0x08,0x41,0x10,0x20,0x00,0xEC,0x62,0xAA,0x52,0x86,0x31,0xD3,0x9C,0x76,0xAD,
-	0xB3,0x9C,0x71,0x8C,0xB2,0x9C,0x92,0x94,0xB3,0x9C,0xF4,0x9C,0x35,0xA5,0x14,0xAD,0x34,0xA5,0xD3,0xA4,0xF3,0x9C,0xF4,0x9C,0x14,0xA5,0x14,0xA5,0x92,0x9C,0x6D,0x73,0x24,0x29,0xA3,0x10,0xEF,0x7B,0x35,0xA5,0x71,0x8C,0xCF,0x83,0x0C,0x63,0x2C,0x63,0x14,0xA5,0x35,0xA5,0xF4,0xA4,0xB2,0x9C,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x04,0x21,0x49,0x4A,0x04,0x21,0x76,0xB5,0x55,0xAD,0x04,0x21,0x45,0x29,0xC7,0x39,0x45,0x29,0xA3,0x18,0x2C,0x6B,0xB7,0xBD,0x86,0x31,0x20,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x20,0x21,0x30,
-	0x00,0x80,0x00,0x98,0x01,0x98,0x00,0xA8,0x01,0xB0,0x04,0xC1,0x44,0xC1,0x22,0xB8,0x00,0xB8,0x21,0x68,0x61,0x20,0x65,0x81,0xAB,0x52,0x61,0x08,0x51,0x94,0x35,0xAD,0xE3,0x20,0xA3,0x18,0xC3,0x20,0x82,0x10,0xAA,0x5A,0xB2,0x9C,0x61,0x10,0x21,0x08,0x41,0x00,0x20,0x70,0x00,0xB0,0x00,0xA8,0x00,0xA8,0x00,0xB0,0x42,0x28,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x62,0x50,0x00,0xB8,0x00,0xB0,0x21,0x78,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x01,0x90,0x01,0xB8,0x22,0xB0,0xE3,0xC0,0x10,0xB4,0xB7,0xB5,0x96,0xBD,0x96,0xB5,0xB7,0xBD,0xA6,0x39,0xE3,0x18,0xE4,0x18,0xAF,0x73,0xEC,0x62,0x71,0x8C,0x31,0x8C,0x41,0x08,0x21,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x86,0x31,0x61,0x08,0x62,0x10,0x65,0x29,0x21,0x08,0x41,0x10,0x41,0x08,0x61,0x10,0xAB,0x5A,0x4D,0x6B,0x14,0xAD,0x55,0xAD,0xAB,0x5A,
-	0x0C,0x63,0x51,0x8C,0xAE,0x73,0xF4,0x9C,0x55,0xA5,0xD3,0xA4,0x14,0x9D,0x92,0x8C,0x72,0x8C,0x55,0xAD,0x14,0xA5,0x34,0xA5,0xD3,0x9C,0xB3,0x94,0x14,0xA5,0x14,0xA5,0x55,0xAD,0x51,0x8C,0xA7,0x39,0x04,0x21,0x6A,0x4A,0x72,0x8C,0xD3,0xA4,0x8E,0x7B,0x71,0x8C,0xD3,0x9C,0xD3,0x9C,0x6E,0x73,0x92,0x8C,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x04,0x21,0xAB,0x5A,0xE4,0x20,0x55,0xB5,0x35,0xAD,0xC3,0x18,0x04,0x29,0xAA,0x52,0x24,0x29,0xC3,0x18,0xAA,0x5A,0xB6,0xBD,0x65,0x31,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x50,
-	0x00,0xA0,0x01,0x98,0x00,0x98,0x21,0x80,0x42,0x78,0xA4,0xD0,0xC5,0xD9,0x83,0xC0,0x21,0x80,0x41,0x40,0x41,0x20,0x44,0x61,0x69,0x4A,0xE3,0x18,0x71,0x94,0xB2,0x9C,0x82,0x18,0x24,0x29,0x65,0x31,0xA2,0x18,0xAA,0x5A,0x51,0x94,0x00,0x00,0x21,0x08,0x41,0x08,0x00,0x90,0x00,0xB0,0x00,0xA8,0x00,0xA8,0x00,0xB0,0x41,0x28,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x41,0x38,0x00,0xB0,0x00,0xB0,0x21,0x50,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x00,0x98,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x10,0xAC,0x75,0xAD,0x76,0xB5,0x76,0xB5,0x75,0xAD,0x04,0x21,0xE3,0x20,0x04,0x21,0x10,0x7C,0x92,0x9C,0x72,0x94,0x34,0xAD,0x49,0x4A,0x00,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0x25,0x29,0xE4,0x20,0x28,0x4A,0x08,0x3A,0x82,0x10,0x21,0x08,0x41,0x08,0x82,0x10,0x21,0x08,0x24,0x29,0x62,0x10,0x21,0x08,0x41,0x10,0x20,0x00,0x86,0x31,0xCF,0x73,0xF3,0x9C,0x10,0x7C,0x72,0x8C,0xCF,0x7B,
-	0x10,0x84,0x2D,0x6B,0x0C,0x63,0xE3,0x18,0xA7,0x31,0xB2,0x94,0xB3,0x94,0x51,0x8C,0xF0,0x7B,0x8A,0x4A,0x35,0xA5,0x55,0xAD,0xB2,0x9C,0xEC,0x5A,0xF4,0x9C,0x14,0x9D,0xAF,0x7B,0xCF,0x7B,0xF4,0xA4,0x6D,0x7B,0xA6,0x39,0xC7,0x31,0x49,0x4A,0xD3,0x9C,0xB3,0x9C,0x71,0x94,0x92,0x94,0x4D,0x73,0x51,0x94,0x4D,0x6B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x10,0x04,0x21,0x04,0x21,0x76,0xB5,0xF3,0xA4,0xA2,0x18,0xE4,0x20,0x2C,0x6B,0xC3,0x20,0x41,0x10,0xA7,0x39,0xD7,0xBD,0x86,0x31,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x70,
-	0x01,0x98,0x01,0x98,0x00,0x90,0x41,0x10,0x41,0x10,0x24,0x69,0x04,0x59,0x41,0x10,0x41,0x00,0x41,0x00,0x41,0x10,0x65,0x39,0x29,0x4A,0x61,0x08,0xB2,0x9C,0x31,0x84,0x41,0x08,0x86,0x31,0x65,0x29,0x61,0x08,0x0C,0x63,0xEF,0x83,0x00,0x00,0x21,0x08,0x41,0x18,0x01,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x41,0x20,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x18,0x00,0xA8,0x00,0xA8,0x41,0x20,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0xA0,0x00,0xA8,0x00,0xA8,0x01,0xA0,0x71,0x94,0xF4,0x9C,0xD3,0xA4,0x14,0xA5,0xF4,0xA4,0xC3,0x20,0xC3,0x18,0x45,0x29,0x51,0x8C,0x51,0x94,0x72,0x94,0xB2,0x9C,0xF3,0xA4,0x82,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x66,0x29,0x6E,0x6B,0xC7,0x31,0x41,0x10,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0xA2,0x18,0x20,0x00,0x41,0x10,0x41,0x10,0x00,0x00,0xE7,0x41,0xCB,0x5A,0x8E,0x73,0x92,0x94,0x6D,0x73,0x10,0x84,
-	0x6E,0x73,0x6E,0x73,0x0C,0x63,0x2D,0x6B,0x86,0x31,0x61,0x08,0x28,0x42,0xB3,0x8C,0xD3,0x9C,0xEF,0x83,0x86,0x31,0xCF,0x73,0x35,0xAD,0xB2,0x9C,0xB3,0x94,0x55,0xAD,0x96,0xB5,0xB3,0x9C,0x10,0x8C,0x34,0xA5,0x55,0xB5,0x8E,0x7B,0xEB,0x62,0x86,0x31,0xEF,0x7B,0x51,0x94,0xD3,0x9C,0x8A,0x52,0xEF,0x7B,0x4D,0x6B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x04,0x21,0x96,0xB5,0xB2,0x8C,0x82,0x10,0xE3,0x20,0x8E,0x73,0x04,0x21,0x82,0x10,0xE3,0x20,0xF7,0xC5,0xA6,0x31,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x80,
-	0x01,0x98,0x00,0xA0,0x00,0x78,0x41,0x18,0x43,0xB0,0x43,0x98,0x22,0x98,0x02,0x80,0x21,0x80,0x00,0x88,0x21,0x60,0xA2,0x20,0x24,0x29,0xE4,0x20,0x14,0xAD,0xAB,0x5A,0x41,0x08,0x09,0x4A,0x86,0x31,0x00,0x00,0x49,0x52,0x8E,0x7B,0x00,0x00,0x41,0x08,0x41,0x18,0x00,0xA0,0x00,0xB0,0x00,0xA8,0x00,0xA8,0x00,0xB0,0x41,0x18,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0xA0,0x21,0x60,0x61,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0xA8,0x02,0xB8,0x01,0xB0,0x82,0xA8,0x14,0xA5,0xF3,0xA4,0xD3,0xA4,0x14,0xAD,0x6D,0x73,0xC3,0x18,0x04,0x21,0x82,0x10,0xA7,0x39,0x92,0x94,0x72,0x94,0x14,0xA5,0x6D,0x73,0x20,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x62,0x10,0x66,0x31,0x04,0x21,0x04,0x21,0x41,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0xAB,0x5A,0x55,0xAD,0x2D,0x6B,0xF0,0x7B,0x51,0x84,0xCB,0x5A,
-	0xCF,0x7B,0xEB,0x52,0xC7,0x31,0x04,0x21,0x25,0x29,0x82,0x10,0x20,0x08,0xA3,0x18,0x4D,0x63,0xD3,0x9C,0x92,0x94,0x86,0x31,0xC7,0x39,0xB6,0xB5,0x8E,0x73,0x71,0x8C,0xD3,0x9C,0x35,0xAD,0x55,0xAD,0x14,0xA5,0xF4,0xA4,0x55,0xAD,0xD3,0xA4,0x92,0x94,0x8A,0x52,0x6D,0x73,0xF3,0x9C,0x69,0x4A,0x86,0x31,0x4D,0x63,0x14,0xA5,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x66,0x31,0x04,0x21,0xD7,0xBD,0xEC,0x62,0x82,0x10,0x04,0x21,0x51,0x94,0x86,0x31,0x04,0x21,0xC3,0x18,0xF7,0xBD,0xA6,0x29,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x01,0x80,
-	0x01,0x98,0x00,0xA0,0x01,0x70,0x42,0x20,0x63,0xD0,0xA4,0xC8,0x43,0xC0,0x01,0xB8,0x00,0xB0,0x00,0xC0,0x01,0x78,0x21,0x00,0x25,0x29,0x24,0x29,0x35,0xAD,0xA7,0x39,0xA3,0x18,0x8A,0x5A,0xE8,0x41,0x41,0x08,0x49,0x4A,0x0C,0x6B,0x00,0x00,0x41,0x08,0x41,0x18,0x01,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA0,0x00,0x90,0x41,0x18,0x41,0x08,
-	0x41,0x08,0x41,0x18,0x41,0x18,0x41,0x08,0x41,0x08,0x01,0x78,0x21,0x70,0x41,0x08,0x41,0x08,0x41,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x43,0xB0,0x02,0xB8,0x02,0xB8,0x04,0xB1,0x55,0xAD,0x14,0xAD,0xF4,0xA4,0x76,0xB5,0x6A,0x52,0xA3,0x10,0xA3,0x18,0x61,0x08,0x86,0x31,0xD3,0x9C,0x92,0x94,0x34,0xAD,0x69,0x52,0x20,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x62,0x10,0xE4,0x20,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xE3,0x20,0xF0,0x7B,0xF4,0x9C,0xCF,0x7B,0x6D,0x6B,0x25,0x21,
-	0x65,0x29,0x41,0x08,0x00,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x61,0x10,0x21,0x08,0x00,0x00,0x45,0x29,0x6D,0x6B,0x10,0x7C,0xC3,0x20,0x86,0x31,0x35,0xA5,0xEC,0x5A,0x31,0x84,0xB2,0x94,0xB2,0x9C,0x92,0x94,0x92,0x94,0xF4,0x9C,0xF3,0xA4,0x14,0xA5,0xF4,0xA4,0xEB,0x62,0x8E,0x6B,0x8A,0x52,0x20,0x00,0x6D,0x73,0xD3,0x9C,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0xA6,0x39,0xE4,0x20,0xF8,0xC5,0x29,0x4A,0xC3,0x18,0xA3,0x18,0x08,0x42,0x04,0x21,0xC3,0x18,0x61,0x08,0x75,0xB5,0x24,0x21,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x70,
-	0x01,0x98,0x00,0x98,0x21,0x80,0x61,0x10,0xC3,0xA0,0x25,0xB1,0x63,0xC0,0x22,0xB8,0x00,0xB0,0x00,0xB8,0x01,0x78,0x41,0x10,0xE7,0x41,0x04,0x21,0x14,0xA5,0xE3,0x20,0x21,0x08,0x0C,0x6B,0xC7,0x39,0x62,0x10,0x28,0x4A,0x49,0x52,0x00,0x00,0x41,0x08,0x41,0x18,0x01,0xA8,0x00,0xA8,0x00,0xA0,0x00,0xA0,0x00,0xA0,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x30,0x41,0x30,0x41,0x08,0x41,0x00,0x00,0x78,0x21,0x50,0x41,0x08,0x41,0x08,0x42,0x30,0x41,0x08,0x41,0x08,0x41,0x08,0x42,0x20,0x23,0xB8,0x23,0xB8,0x02,0xB8,0x65,0xA9,0x96,0xAD,0x34,0xAD,0xF4,0xAC,0x76,0xB5,0x85,0x31,0xC3,0x18,0xC3,0x18,0xE3,0x18,0xAB,0x52,0xD3,0x9C,0xB3,0x9C,0xF4,0xA4,0xC3,0x20,0x20,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x20,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0xAA,0x5A,0x24,0x21,0x25,0x29,0xE3,0x18,0x41,0x08,0x20,0x08,
-	0xC3,0x18,0x41,0x08,0x41,0x08,0x45,0x29,0x61,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0xA2,0x10,0xAA,0x5A,0x45,0x29,0xE3,0x18,0x51,0x8C,0x6E,0x73,0xAF,0x7B,0x35,0xAD,0xF3,0xA4,0xEF,0x83,0x51,0x8C,0x75,0xB5,0x6E,0x6B,0x2C,0x63,0x31,0x8C,0x45,0x29,0x49,0x4A,0x00,0x08,0x4D,0x6B,0x49,0x4A,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x08,0x45,0x29,0xE3,0x20,0x96,0xBD,0xC7,0x39,0xC3,0x18,0x24,0x29,0x61,0x10,0xE4,0x18,0xE4,0x20,0xE3,0x18,0x96,0xBD,0x45,0x21,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x48,
-	0x00,0xA0,0x01,0x98,0x00,0x98,0x41,0x38,0x21,0x28,0xA3,0xA8,0x63,0xC0,0x22,0xB8,0x00,0xA8,0x00,0xC0,0x41,0x30,0xA2,0x18,0xC7,0x31,0x45,0x29,0x14,0xA5,0xA3,0x18,0xC3,0x20,0x25,0x29,0xC3,0x18,0x20,0x08,0xE7,0x41,0xC7,0x41,0x00,0x00,0x41,0x08,0x41,0x28,0x00,0xB0,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x21,0x78,0x41,0x00,0x41,0x08,
-	0x41,0x08,0x42,0x48,0x21,0x58,0x41,0x08,0x41,0x08,0x21,0x58,0x41,0x28,0x41,0x08,0x41,0x10,0x42,0x58,0x41,0x00,0x41,0x08,0x41,0x08,0x61,0x28,0x02,0xB8,0x01,0xB0,0x01,0xB0,0xE8,0xA9,0x55,0xA5,0x14,0xAD,0x14,0xAD,0xD3,0xA4,0x20,0x08,0x62,0x10,0xE4,0x18,0x31,0x84,0x31,0x8C,0x72,0x94,0xD3,0x9C,0x10,0x8C,0x00,0x00,0x21,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0x25,0x21,0xC3,0x18,0x00,0x00,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x08,0x00,0x00,0x6A,0x52,0x65,0x31,0x82,0x10,0x08,0x42,0x41,0x08,0x21,0x08,
-	0x62,0x10,0x21,0x08,0x82,0x10,0x04,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x42,0x08,0x41,0x08,0x21,0x08,0x20,0x08,0xA6,0x31,0x24,0x29,0x41,0x08,0xEF,0x83,0xEC,0x62,0xAF,0x73,0xF4,0xA4,0x14,0xAD,0x0C,0x63,0x51,0x8C,0x72,0x94,0x31,0x8C,0x76,0xAD,0x24,0x21,0x86,0x31,0x20,0x08,0xE8,0x39,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xC3,0x18,0x49,0x4A,0x04,0x21,0xD7,0xBD,0x45,0x29,0xC3,0x18,0x24,0x21,0x04,0x29,0xE4,0x20,0xC3,0x18,0xE3,0x20,0xD3,0xA4,0x66,0x29,0x20,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x00,0x98,0x00,0x98,0x00,0xA8,0x00,0xA8,0x21,0xB0,0x24,0xC1,0xA4,0xC0,0x22,0xB8,0x00,0xB8,0x00,0xA0,0x41,0x00,0xA2,0x18,0x29,0x4A,0xC7,0x39,0xB2,0x94,0x82,0x10,0xA2,0x18,0x82,0x18,0xC3,0x18,0x82,0x10,0x4D,0x73,0x66,0x31,0x00,0x08,0x41,0x00,0x42,0x48,0x01,0xC0,0x00,0xA8,0x00,0xB0,0x00,0xB8,0x21,0x90,0x41,0x00,0x41,0x08,
-	0x41,0x00,0x21,0x50,0x21,0x60,0x41,0x08,0x41,0x10,0x41,0x18,0x41,0x08,0x41,0x08,0x21,0x30,0x21,0x50,0x41,0x00,0x41,0x08,0x41,0x08,0x62,0x38,0x01,0xB8,0x02,0xA8,0x00,0xB0,0x6A,0xAA,0x55,0xA5,0xF4,0xAC,0x55,0xAD,0x92,0x9C,0x82,0x18,0xA2,0x18,0xC3,0x18,0x10,0x84,0x10,0x84,0x51,0x94,0xD3,0x9C,0xAA,0x5A,0x00,0x00,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x04,0x21,0xC3,0x18,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xAA,0x52,0x29,0x42,0x04,0x21,0x82,0x10,0x21,0x08,0x82,0x10,
-	0x41,0x10,0xA2,0x10,0xE3,0x18,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x62,0x10,0x21,0x08,0xE4,0x18,0x4D,0x73,0x2D,0x6B,0xAF,0x7B,0xD3,0x9C,0x34,0xAD,0x0F,0x8C,0xD3,0x9C,0x34,0xAD,0x30,0x84,0x61,0x08,0xA6,0x39,0x41,0x08,0xCB,0x62,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0xC3,0x18,0xC7,0x39,0x24,0x29,0xD3,0x9C,0x62,0x08,0xA2,0x18,0x04,0x29,0xB6,0xBD,0xAB,0x4A,0x61,0x10,0x21,0x08,0x4D,0x6B,0x28,0x4A,0xD3,0x9C,0xC7,0x39,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x00,
-	0x20,0x70,0x00,0xA0,0x01,0x98,0x00,0xA0,0x01,0xA8,0x22,0xB8,0x63,0xC0,0x01,0xC0,0x01,0xB8,0x21,0x38,0x41,0x00,0x45,0x31,0xC7,0x39,0x69,0x52,0x30,0x8C,0x82,0x10,0xA2,0x18,0xE7,0x41,0xA2,0x18,0x61,0x10,0x69,0x52,0x04,0x21,0x82,0x10,0x41,0x08,0x62,0x10,0x22,0x80,0x01,0xB8,0x00,0xB0,0x21,0x80,0x41,0x60,0x41,0x00,0x41,0x08,
-	0x41,0x00,0x21,0x68,0x21,0x80,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x00,0x21,0x70,0x21,0x48,0x41,0x00,0x41,0x10,0x41,0x00,0x21,0x48,0x00,0xB0,0x00,0xA0,0x00,0xA8,0x4D,0x9B,0x34,0xA5,0xD3,0xA4,0xF4,0xA4,0xAE,0x7B,0x61,0x08,0x82,0x10,0xA6,0x31,0x31,0x8C,0x10,0x8C,0x10,0x8C,0x72,0x94,0x24,0x29,0x21,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x10,0x86,0x29,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x0C,0x6B,0x6E,0x73,0x25,0x29,0x20,0x00,0x24,0x21,0x65,0x29,
-	0x24,0x21,0xA2,0x18,0x20,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x08,0x25,0x21,0x4D,0x63,0x92,0x94,0x4D,0x6B,0xB3,0x8C,0xB3,0x9C,0xAA,0x52,0x6D,0x63,0xC3,0x18,0x62,0x10,0xE8,0x41,0x61,0x08,0xE8,0x41,0x21,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xC3,0x18,0x25,0x21,0x45,0x29,0x31,0x84,0x82,0x10,0xE4,0x20,0x45,0x29,0xB6,0xBD,0xEC,0x5A,0x61,0x10,0x61,0x10,0xE7,0x41,0x35,0xAD,0x96,0xB5,0xC7,0x39,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x20,0x41,0x10,
-	0x41,0x18,0x00,0x98,0x00,0xA8,0x00,0xA0,0x02,0xB8,0x43,0xC0,0xA4,0xC8,0x01,0xC0,0x21,0x68,0x61,0x08,0x41,0x18,0x86,0x31,0xC7,0x39,0x2C,0x6B,0xCB,0x62,0xC3,0x18,0xC3,0x18,0xB2,0x9C,0x25,0x29,0x00,0x00,0x65,0x31,0x8A,0x52,0x30,0x8C,0x61,0x10,0x41,0x08,0x83,0x48,0x02,0xB8,0x01,0xA8,0x00,0xA8,0x42,0x60,0x41,0x00,0x41,0x10,
-	0x41,0x00,0x01,0x80,0x22,0x88,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x00,0xA0,0x21,0x30,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x60,0x00,0xB0,0x00,0xA0,0x20,0xA0,0x31,0xA4,0x35,0xA5,0xB3,0x9C,0x14,0xA5,0xEC,0x62,0x20,0x08,0x62,0x10,0xE7,0x39,0xF0,0x83,0x71,0x94,0x10,0x8C,0x72,0x94,0xA2,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x08,0x04,0x21,0x45,0x29,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xE8,0x41,0xF4,0x94,0xA7,0x31,0xA3,0x18,0x20,0x08,0x20,0x08,
-	0x41,0x08,0xA2,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x61,0x08,0x86,0x31,0x51,0x84,0x10,0x84,0x8E,0x7B,0x31,0x8C,0x66,0x29,0x00,0x00,0xC3,0x20,0x28,0x4A,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xC3,0x20,0x65,0x29,0x6A,0x52,0x6D,0x6B,0x41,0x08,0x61,0x08,0xA7,0x39,0x75,0xBD,0xCF,0x7B,0xC3,0x18,0xC3,0x18,0xE7,0x39,0xD3,0xA4,0x75,0xB5,0xA6,0x39,0x20,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x00,0x62,0x38,0x41,0x18,
-	0x41,0x08,0x41,0x30,0x00,0x88,0x00,0x98,0x42,0xB0,0x45,0xC1,0x44,0xB1,0x23,0xC0,0x42,0x20,0x42,0x40,0x22,0x90,0x45,0x21,0x04,0x29,0x10,0x8C,0xC7,0x39,0xA2,0x18,0xE3,0x20,0xB2,0xA4,0x65,0x31,0x61,0x10,0x65,0x31,0xD3,0xA4,0xEF,0x83,0x41,0x08,0xC2,0x48,0x83,0xD0,0x02,0xB8,0x01,0xA8,0x00,0xA8,0x21,0x58,0x41,0x00,0x41,0x10,
-	0x41,0x00,0x21,0x80,0x01,0x90,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x40,0x01,0xB0,0x21,0x20,0x41,0x08,0x41,0x10,0x41,0x00,0x00,0x78,0x00,0xA8,0x00,0xB0,0x62,0x48,0xAF,0x8B,0xCF,0x7B,0xD3,0x9C,0x14,0xA5,0x86,0x39,0x41,0x10,0xC3,0x10,0x21,0x08,0x41,0x00,0x6E,0x73,0x92,0x94,0xCF,0x83,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x45,0x21,0xC3,0x18,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x8A,0x5A,0xAA,0x52,0x41,0x08,0xE4,0x20,0xE3,0x18,0x21,0x08,
-	0x41,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x42,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x00,0x82,0x10,0x8E,0x6B,0xAF,0x73,0xC7,0x39,0x00,0x00,0x00,0x00,0xC7,0x41,0xC7,0x41,0x45,0x29,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x08,0xE8,0x41,0x8A,0x5A,0x35,0xAD,0x92,0x94,0x14,0xA5,0x96,0xBD,0x75,0xB5,0x96,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xAD,0xF4,0xA4,0x55,0xAD,0xC6,0x31,0x20,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x21,0x10,0x41,0x10,0x41,0x18,0x21,0x18,0xC3,0x30,0x22,0x90,0x42,0x28,0x20,0x08,0xA3,0x70,0x86,0x31,0xC7,0x41,0xF3,0xA4,0x25,0x29,0x82,0x10,0x66,0x31,0xD2,0xA4,0xA7,0x39,0x04,0x21,0x66,0x31,0x92,0x9C,0x6D,0x73,0x20,0x00,0xE3,0x48,0x65,0xC9,0x01,0xB0,0x01,0xA0,0x01,0x98,0x42,0x50,0x21,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x88,0x00,0xA0,0x42,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x88,0x00,0xA0,0x41,0x18,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x88,0x00,0xA8,0x00,0x88,0x21,0x50,0x41,0x58,0xC3,0x10,0xF4,0xA4,0x55,0xAD,0x0C,0x63,0x08,0x42,0xE4,0x20,0x21,0x08,0x61,0x10,0xF0,0x83,0xB2,0x9C,0x29,0x4A,0x20,0x00,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x00,0x45,0x29,0x61,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xEB,0x62,0x6A,0x4A,0x20,0x00,0x86,0x31,0x41,0x08,0x21,0x08,
-	0xE3,0x18,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x00,0x00,0x08,0x4A,0x86,0x31,0xE7,0x41,0x86,0x31,0x00,0x08,0x41,0x08,
-	0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x00,0x00,0x65,0x31,0xCF,0x83,0x8E,0x7B,0x4D,0x6B,0xAA,0x52,0x6E,0x73,0xB2,0x9C,0x96,0xB5,0x35,0xAD,0x71,0x94,0xF3,0xA4,0x96,0xAD,0x86,0x31,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x18,0x42,0x38,
-	0x41,0x08,0x41,0x18,0x41,0x08,0x41,0x10,0x41,0x08,0x82,0x20,0xA3,0xB8,0x01,0xA0,0x41,0x08,0x41,0x10,0x21,0x58,0x45,0x29,0x49,0x52,0xB2,0x9C,0x92,0x94,0x71,0x94,0x71,0x94,0x51,0x94,0x91,0x9C,0x71,0x94,0x92,0x9C,0x91,0x9C,0xEC,0x62,0x00,0x00,0x04,0x59,0xA5,0xC9,0x02,0xB8,0x22,0xB8,0x02,0xA8,0x21,0x38,0x61,0x00,0x41,0x20,
-	0x42,0x20,0x01,0x80,0x00,0xA8,0x41,0x20,0x41,0x08,0x41,0x08,0x41,0x18,0x00,0xA0,0x00,0x88,0x42,0x18,0x41,0x18,0x41,0x18,0x41,0x10,0x01,0x98,0x00,0xA8,0x01,0xA8,0xA3,0xB0,0xCB,0x62,0x6E,0x6B,0x75,0xB5,0x75,0xB5,0xB6,0xB5,0xB6,0xB5,0xF4,0xA4,0xCB,0x5A,0xC7,0x31,0x51,0x8C,0x30,0x8C,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0xE4,0x20,0x21,0x08,0x20,0x08,0x41,0x08,0x21,0x08,0x82,0x10,0xA3,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0xAE,0x7B,0x8A,0x52,0x04,0x21,0xC3,0x18,0x41,0x08,0x21,0x08,
-	0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x42,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x00,0x66,0x31,0xC7,0x39,0x66,0x31,0xC7,0x39,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x69,0x52,0x10,0x84,0xB2,0x94,0x30,0x84,0xAE,0x73,0xAE,0x73,0x10,0x84,0x92,0x94,0x92,0x94,0x10,0x84,0xAF,0x7B,0xEB,0x5A,0xAE,0x7B,0x10,0x84,0x0C,0x63,0xAA,0x52,0xAA,0x5A,0xAA,0x5A,0xE7,0x41,0x41,0x10,0x41,0x08,0x41,0x18,
-	0x21,0x18,0x21,0x38,0x41,0x18,0x41,0x20,0x41,0x28,0x62,0x40,0x82,0x60,0x21,0x88,0x21,0x60,0x21,0x70,0x41,0x38,0x21,0x00,0x61,0x10,0xEC,0x62,0xC7,0x41,0x08,0x4A,0x28,0x4A,0xEB,0x62,0x92,0x9C,0xD3,0xA4,0xEF,0x8B,0x71,0x9C,0x8A,0x52,0x00,0x00,0x24,0x69,0x45,0xC9,0xA4,0xC0,0x22,0xA8,0x02,0xA8,0x21,0x58,0x42,0x48,0x21,0x60,
-	0x21,0x78,0x00,0x98,0x00,0xA8,0x21,0x50,0x21,0x28,0x41,0x38,0x21,0x38,0x00,0xB0,0x00,0xA0,0x41,0x50,0x21,0x50,0x21,0x60,0x42,0x80,0x43,0xB8,0x02,0xB8,0x02,0xB8,0x05,0xA9,0x35,0xAD,0x14,0xAD,0x08,0x42,0x69,0x52,0x49,0x4A,0xEB,0x62,0x4D,0x6B,0x71,0x94,0x14,0x9D,0x2C,0x6B,0x08,0x42,0x00,0x00,0x20,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x45,0x29,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0x21,0x08,0x31,0x84,0x69,0x4A,0x62,0x08,0x04,0x21,0x21,0x08,0x41,0x08,
-	0x04,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x83,0x68,0x43,0xA8,0x63,0x98,0x21,0x20,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x8A,0x52,0xCB,0x5A,0x28,0x4A,0xE7,0x41,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x04,0x21,0xEF,0x7B,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x34,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x34,0xA5,0x45,0x29,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x82,0x10,0x8E,0x7B,0x0C,0x63,0xCF,0x7B,0x92,0x9C,0xAE,0x7B,0xCB,0x62,0xE8,0x41,0xA2,0x18,0xD3,0xA4,0x29,0x4A,0x00,0x00,0xC3,0x38,0xC6,0xD1,0x85,0xC9,0xE4,0xB8,0x01,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x01,0xB0,0x00,0xA8,0x00,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x01,0xB8,0x01,0xB0,0x02,0xB0,0x02,0xB0,0x04,0xB1,0x75,0xAD,0x8E,0x7B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0xEB,0x5A,0x65,0x31,0xEC,0x5A,0x4D,0x6B,0xE3,0x20,0x41,0x08,0x21,0x08,
-	0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xA2,0x18,0x66,0x29,0xC3,0x18,0xA7,0x31,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x00,0x8A,0x52,0x10,0x84,0x0C,0x63,0xC3,0x18,0x82,0x10,0x21,0x08,0x20,0x00,
-	0x04,0x29,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x58,0x04,0xC1,0x05,0xB1,0x83,0xB0,0xA4,0x90,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x29,0x4A,0x6D,0x7B,0x4C,0x6B,0xE4,0x20,0x21,0x08,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0xA6,0x39,0xF3,0x9C,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x34,0xA5,0x69,0x4A,0x86,0x39,0x65,0x31,0x25,0x29,0x45,0x29,0x6D,0x73,0x51,0x8C,0x6D,0x6B,0x51,0x8C,0x55,0xAD,0x71,0x8C,0x96,0xB5,0x86,0x31,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x61,0x10,0x82,0x10,0x14,0xA5,0xB2,0x9C,0x8E,0x73,0x25,0x29,0x20,0x00,0x20,0x00,0x62,0x10,0xE3,0x18,0x55,0xAD,0xE7,0x39,0x00,0x00,0x45,0x79,0x07,0xD2,0x85,0xC9,0x65,0xC9,0x22,0xC0,0x00,0xA8,0x21,0x48,0x21,0x60,
-	0x21,0x70,0x00,0x90,0x00,0x98,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB0,0x01,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x01,0xB8,0x02,0xC0,0x02,0xB8,0x02,0xC0,0x22,0xB8,0xE3,0x30,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x20,0x08,0x21,0x08,0x41,0x08,0xE3,0x18,0x0C,0x63,0x71,0x94,0x28,0x42,
-	0xC3,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x82,0x10,0x65,0x29,0x81,0x10,0xE8,0x41,0x45,0x21,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x82,0x10,0x2D,0x6B,0x30,0x8C,0xCB,0x62,0xA2,0x10,0x41,0x08,0x41,0x10,0x00,0x08,
-	0x25,0x29,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x78,0xE4,0xB0,0x83,0xA8,0x83,0xA8,0xA4,0xA8,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x08,0x08,0x42,0xF0,0x83,0x30,0x8C,0xC3,0x18,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x14,0xA5,0x2C,0x63,0x28,0x42,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x08,0x21,0x08,0x61,0x08,0x85,0x29,0x61,0x10,0xAE,0x73,0xE3,0x20,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x10,0x20,0x18,0x20,0x18,0x20,0x18,0x61,0x20,0x01,0x80,0x01,0x98,0x01,0x88,0x00,0x60,0x00,0x30,0x42,0x08,0x21,0x08,0x21,0x08,0x24,0x29,0xF3,0xA4,0x86,0x31,0x00,0x08,0x82,0x40,0x64,0xA9,0x64,0xB9,0x64,0xB9,0x21,0x70,0x21,0x20,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x41,0x08,0x41,0x18,0x41,0x48,0x21,0x50,0x21,0x58,0x21,0x68,0x41,0x48,0x21,0x50,0x21,0x50,0x21,0x50,0x41,0x48,0x21,0x60,0x41,0x70,0x21,0x78,0x83,0x78,0x61,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x72,0x8C,0x96,0xBD,0xF7,0xC5,
-	0xB7,0xBD,0xE3,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x65,0x31,0x41,0x10,0x45,0x29,0xA7,0x39,0x62,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x00,0x08,0x4A,0xF0,0x7B,0x55,0xAD,0x6D,0x6B,0x82,0x10,0x24,0x29,0x62,0x10,0x21,0x08,
-	0xA2,0x18,0xE3,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x42,0x60,0x22,0xA0,0x22,0xA8,0x22,0xA8,0x21,0x80,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0xA2,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x61,0x10,0x41,0x08,0x61,0x10,0xEF,0x83,0x14,0xA5,0x14,0xA5,0xE3,0x18,0x20,0x08,0x41,0x08,
-	0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x04,0x21,0x51,0x8C,0x75,0xAD,0x75,0xAD,0x14,0xA5,0x86,0x31,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x24,0x21,0xA6,0x31,
-	0xA6,0x31,0x8A,0x52,0x29,0x4A,0xA6,0x31,0xC3,0x18,0x41,0x10,0x41,0x10,0x01,0x70,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0xA0,0x00,0x88,0x00,0x80,0x00,0x80,0x00,0x38,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0xA2,0x10,0x41,0x10,0x00,0x50,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,
-	0x01,0x90,0x01,0x90,0x00,0x50,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x18,0x41,0x38,0x21,0x50,0x21,0x58,0x21,0x60,0x42,0x80,0x62,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xE3,0x18,0x86,0x39,0x49,0x52,
-	0x2C,0x5B,0x61,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0xC3,0x18,0x04,0x21,0x20,0x08,0xE4,0x20,0x45,0x31,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x61,0x10,0x6E,0x73,0xF0,0x83,0x55,0xAD,0x55,0xA5,0xAA,0x52,0xCB,0x5A,0x20,0x00,0x61,0x08,
-	0x21,0x08,0xC3,0x18,0xA2,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x42,0x60,0x01,0xA0,0x21,0x80,0x42,0x18,0x41,0x08,0x41,0x10,0x21,0x08,0x62,0x08,0xA2,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x61,0x10,0x41,0x08,0x20,0x08,0xAA,0x5A,0x14,0xA5,0xB2,0x9C,0xB3,0x9C,0x49,0x4A,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x04,0x21,0x92,0x94,0x28,0x4A,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x61,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x18,0xA2,0x18,0x41,0x08,0x41,0x08,0x45,0x31,0x55,0xAD,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x55,0xAD,0xA6,0x31,0x41,0x08,0x20,0x28,0x00,0x58,0x01,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x01,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x01,0x68,0x41,0x08,0x41,0x08,0x41,0x00,0x21,0x10,0x41,0x18,0x21,0x30,0x21,0x40,0x21,0x48,0x21,0x50,0x21,0x40,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x00,0x45,0x31,0x41,0x08,0x21,0x08,0x61,0x10,0xE8,0x41,0x21,0x08,0x21,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xA6,0x39,0x2D,0x6B,0x6D,0x73,0x0C,0x63,0xCF,0x7B,0xEC,0x52,0x6E,0x6B,0xC3,0x18,0xA3,0x18,
-	0x20,0x08,0x41,0x08,0xA3,0x18,0x82,0x18,0x61,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x41,0x08,0x41,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x61,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x24,0x21,0x82,0x10,0x82,0x10,0xAF,0x7B,0xF3,0xA4,0xD3,0x9C,0xF4,0xA4,0x6A,0x52,0x00,0x00,0x21,0x08,
-	0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE3,0x20,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x61,0x10,0xCF,0x7B,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x92,0x94,0x8A,0x52,0x41,0x08,0xC3,0x20,0x30,0x84,0x75,0xAD,0xB2,0x94,
-	0x10,0x84,0x10,0x84,0x96,0xB5,0x71,0x8C,0xA6,0x31,0xC3,0x20,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x10,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x00,0x58,0x00,0x50,0x20,0x18,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x18,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x01,0x80,0x01,0x78,0x00,0x68,0x00,0x50,0x01,0x70,0x01,0x80,0x01,0x90,0x01,0x98,0x01,0xA0,0x01,0xA0,0x00,0x60,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x20,0x08,0x82,0x10,0x45,0x29,0x62,0x10,0x21,0x08,0x21,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x61,0x10,0xCF,0x7B,0x30,0x8C,0x71,0x9C,0x51,0x8C,0x34,0xA5,0x6D,0x6B,0x45,0x29,0x08,0x42,0x82,0x10,
-	0xA2,0x18,0x21,0x08,0x41,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x10,0x82,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0xA3,0x18,0xC3,0x18,0x45,0x29,0xCF,0x7B,0xD3,0x9C,0xB3,0x9C,0xD3,0x9C,0xAB,0x5A,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xA6,0x31,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x71,0x8C,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x10,0x84,0xC7,0x39,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x18,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x01,0xA0,0x01,0x90,0x21,0x20,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x20,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x01,0x60,0x41,0x18,0x20,0x28,0x01,0x88,0x01,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x70,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x08,0xC3,0x20,0xE3,0x20,0x20,0x08,0x20,0x08,0x82,0x10,0xA3,0x18,0x25,0x29,0x62,0x10,0x21,0x08,0x41,0x10,0x00,0x00,0xE7,0x41,0x96,0xB5,0x76,0xAD,0x96,0xAD,0x71,0x8C,0x14,0xA5,0xB3,0x9C,0x2D,0x63,0x49,0x4A,0xC7,0x39,
-	0x45,0x29,0x20,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xA2,0x18,0x04,0x29,0x10,0x84,0xD3,0x9C,0xD3,0x9C,0xD3,0x9C,0xAB,0x5A,0x00,0x00,0x21,0x08,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x08,0x42,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x30,0x8C,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x20,0x28,0x20,0x20,0x20,0x20,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x30,0x01,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x00,0x28,0x41,0x08,0x41,0x08,0x20,0x20,0x20,0x30,0x00,0x68,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x60,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x08,0x24,0x29,0x82,0x10,0x61,0x08,0x41,0x10,0x41,0x08,0x62,0x10,0xC7,0x39,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x08,0x6E,0x63,0x0C,0x5B,0x49,0x4A,0x6A,0x52,0xAA,0x52,0xAA,0x52,0x8E,0x73,0x30,0x7C,0x08,0x42,0x10,0x84,
-	0x8A,0x52,0x24,0x21,0x00,0x00,0x41,0x08,0x41,0x08,0x21,0x08,0xA3,0x18,0xA3,0x18,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x04,0x21,0x86,0x31,0x71,0x94,0x92,0x94,0x51,0x94,0xB2,0x9C,0x2C,0x63,0x00,0x00,0x21,0x08,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xAE,0x7B,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x01,0x98,0x02,0xB0,0x02,0xB0,0x01,0x98,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x40,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x01,0x98,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x40,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x00,0x50,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x45,0x29,0x61,0x10,0x25,0x29,0x20,0x08,0x20,0x08,0x04,0x21,0xC7,0x31,0x00,0x00,0x41,0x10,0x20,0x08,0xA2,0x18,0xEC,0x52,0x08,0x42,0xC7,0x39,0xC7,0x41,0xC7,0x39,0x86,0x39,0x65,0x21,0xC7,0x39,0x49,0x4A,0xE4,0x18,
-	0x29,0x4A,0xEF,0x83,0x08,0x42,0x21,0x08,0x20,0x08,0x21,0x08,0x61,0x10,0x82,0x18,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x00,0x2C,0x63,0x25,0x29,0x31,0x8C,0x92,0x94,0x92,0x94,0x14,0xA5,0x8E,0x7B,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0xEF,0x7B,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x6B,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x01,0x98,0x02,0xB0,0x02,0xB0,0x01,0x98,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x01,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x00,0x58,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x00,0x48,0x02,0xB0,0x02,0xB0,0x00,0x50,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x04,0x21,0xC3,0x18,0x82,0x18,0x00,0x08,0x00,0x00,0x45,0x29,0x04,0x19,0x00,0x08,0x41,0x10,0x41,0x08,0xC3,0x18,0x45,0x29,0x86,0x31,0xA6,0x31,0x07,0x3A,0xE7,0x39,0xA6,0x39,0xAB,0x52,0x29,0x42,0xC7,0x39,0x45,0x29,
-	0x04,0x21,0xCB,0x5A,0x2D,0x6B,0x6A,0x52,0xC3,0x18,0x00,0x00,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0xAA,0x5A,0x25,0x29,0xD3,0x9C,0x14,0x9D,0x14,0xA5,0x55,0xA5,0x28,0x4A,0x00,0x00,0x21,0x08,
-	0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE3,0x20,0xD3,0x9C,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x01,0x90,0x02,0xB0,0x02,0xA8,0x01,0x80,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x10,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x01,0xA0,0x21,0x28,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x18,0x00,0x80,0x02,0xB0,0x00,0x50,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0xE4,0x20,0x45,0x29,0x41,0x08,0x65,0x31,0x61,0x08,0x65,0x31,0x82,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0xE4,0x18,0x08,0x42,0xE8,0x41,0xA7,0x39,0x65,0x29,0x66,0x29,0xC7,0x39,0x28,0x4A,0x08,0x4A,0x86,0x31,0x45,0x29,
-	0xA6,0x31,0x62,0x10,0x66,0x31,0x10,0x84,0xEF,0x83,0xE8,0x41,0x08,0x42,0x25,0x29,0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x10,0x20,0x08,0x61,0x08,0x24,0x21,0x62,0x10,0x41,0x08,0x20,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0xC3,0x18,0xC7,0x41,0xE8,0x41,0xD3,0x9C,0xB2,0x94,0xF3,0x9C,0x55,0xAD,0x04,0x21,0x82,0x10,0xE3,0x18,
-	0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x49,0x4A,0x75,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x6B,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x01,0x90,0x02,0xB0,0x02,0xA8,0x01,0x88,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x01,0x70,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x60,0x01,0xA8,0x02,0xB0,0x00,0x48,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x04,0x21,0x25,0x29,0x61,0x10,0xE7,0x39,0x00,0x08,0x86,0x31,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x08,0x04,0x21,0x8A,0x52,0xE7,0x41,0xA6,0x31,0x08,0x42,0xA6,0x31,0x45,0x29,0xA7,0x31,0x65,0x29,0xA6,0x39,0x45,0x29,
-	0x04,0x29,0x04,0x21,0x04,0x29,0xC3,0x20,0x86,0x31,0xC7,0x39,0xE7,0x41,0xEC,0x62,0x08,0x42,0xC7,0x39,0x25,0x29,0x41,0x08,0x65,0x29,0x69,0x4A,0xC3,0x18,0x41,0x08,0x00,0x00,0x08,0x42,0x6A,0x52,0x41,0x08,0xA7,0x39,0x20,0x08,0xE3,0x20,0x0C,0x63,0xCB,0x5A,0xD3,0x9C,0xB3,0x9C,0xD3,0x9C,0x14,0xA5,0xC3,0x18,0xE4,0x20,0x24,0x21,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xE3,0x20,0xF3,0x9C,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x40,0x01,0x80,0x01,0x88,0x01,0x70,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x01,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x98,
-	0x20,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x30,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x00,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x45,0x29,0x24,0x29,0x66,0x31,0xC3,0x18,0x20,0x08,0x62,0x10,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x66,0x31,0x28,0x4A,0x8A,0x52,0xE8,0x39,0xE8,0x41,0xE7,0x41,0xA7,0x31,0x04,0x19,0xC7,0x41,0x86,0x39,0xA6,0x31,
-	0xC7,0x41,0x65,0x31,0x08,0x4A,0xAB,0x5A,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x10,0x04,0x21,0x24,0x29,0xC7,0x39,0x8A,0x5A,0x08,0x42,0x41,0x08,0x00,0x00,0x61,0x08,0xCB,0x5A,0x72,0x8C,0x62,0x08,0x66,0x31,0x08,0x42,0x20,0x00,0x49,0x52,0xCB,0x62,0x8A,0x52,0x14,0xA5,0xF4,0x9C,0xF3,0x9C,0xD3,0x9C,0x82,0x10,0x08,0x42,0x66,0x31,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0xE3,0x20,0x92,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x4D,0x6B,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x18,0x01,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x40,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x18,0x00,0x60,0x01,0xA0,0x02,0xB0,0x00,0x38,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x61,0x08,0x24,0x29,0x04,0x21,0x65,0x31,0x21,0x08,0x21,0x08,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xC7,0x41,0x08,0x42,0xC7,0x39,0xC7,0x31,0xE7,0x41,0xC7,0x39,0xC7,0x39,0xC7,0x41,0xA3,0x18,0xC7,0x41,0x66,0x29,
-	0xC7,0x41,0xE7,0x39,0x65,0x31,0xB3,0x9C,0x92,0x94,0xAF,0x7B,0xE3,0x20,0x45,0x29,0xA2,0x18,0xA2,0x10,0x82,0x10,0x41,0x08,0x45,0x29,0x24,0x21,0x86,0x31,0xEF,0x83,0x0C,0x63,0xA3,0x18,0xEB,0x62,0xE7,0x41,0xC7,0x39,0xC7,0x39,0x0C,0x6B,0xEC,0x62,0x4D,0x73,0xD3,0xA4,0xF4,0x9C,0xF4,0xA4,0x30,0x8C,0xE4,0x20,0x49,0x4A,0x86,0x31,
-	0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x10,0x85,0x31,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xAA,0x5A,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x28,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x30,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x40,0x02,0xA8,0x00,0x48,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0xE4,0x18,0x62,0x10,0xA6,0x31,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0xC7,0x41,0xA7,0x39,0xA7,0x31,0xC7,0x39,0xC7,0x39,0xE7,0x39,0xC7,0x41,0xA7,0x39,0x89,0x5A,0xE8,0x39,0x65,0x29,
-	0xC3,0x28,0x49,0x4A,0xA6,0x39,0x10,0x8C,0x72,0x94,0xF3,0x9C,0x6E,0x73,0xEF,0x7B,0x0C,0x63,0xAB,0x5A,0x4D,0x73,0x10,0x84,0x72,0x94,0x92,0x9C,0xD3,0xA4,0x0C,0x63,0xEB,0x62,0x51,0x8C,0x8E,0x73,0x6E,0x73,0x45,0x29,0x6A,0x52,0x4D,0x73,0x8A,0x52,0x6E,0x73,0xF3,0xA4,0xF3,0xA4,0x14,0xA5,0x10,0x84,0xE7,0x39,0xCB,0x5A,0x49,0x4A,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xE7,0x41,0x10,0x84,0x55,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xAA,0x5A,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x40,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,0x20,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x30,0x01,0xA8,0x00,0x30,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x62,0x10,0x82,0x10,0x86,0x31,0x86,0x31,0x61,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x61,0x08,0xC7,0x39,0xC7,0x41,0xC7,0x39,0xC7,0x39,0x86,0x31,0xC7,0x41,0x86,0x31,0xA7,0x39,0x28,0x42,0x45,0x29,0xA7,0x39,
-	0x86,0x31,0x69,0x4A,0x2D,0x63,0x2C,0x73,0xB2,0x9C,0x92,0x94,0x72,0x94,0x2C,0x63,0xCF,0x7B,0x31,0x8C,0x51,0x8C,0x71,0x94,0x92,0x94,0x92,0x94,0x72,0x94,0x92,0x94,0x92,0x94,0xB2,0x9C,0x2C,0x6B,0x0C,0x63,0x08,0x42,0x6D,0x73,0x6E,0x73,0xCB,0x5A,0x51,0x94,0xB3,0x94,0x92,0x94,0xD3,0x9C,0x8E,0x73,0x08,0x42,0x04,0x21,0x6A,0x52,
-	0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x10,0x84,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xAA,0x52,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x60,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x18,0x00,0x60,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0xA2,0x18,0xA6,0x39,0x08,0x3A,0x61,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x04,0x21,0xA6,0x39,0xC7,0x39,0xA6,0x31,0xC7,0x39,0xC7,0x41,0xC7,0x39,0x45,0x29,0xA6,0x39,0x86,0x31,0xA6,0x29,
-	0x65,0x31,0xA6,0x39,0x2D,0x73,0x0C,0x63,0x14,0xAD,0x92,0x94,0xD3,0x9C,0xCB,0x5A,0xAF,0x7B,0xCF,0x7B,0xEF,0x83,0x71,0x8C,0xB2,0x9C,0xD3,0x9C,0x92,0x94,0x72,0x8C,0xF0,0x83,0x51,0x8C,0xF0,0x7B,0xAB,0x5A,0xCF,0x7B,0x8E,0x73,0x10,0x84,0x6D,0x73,0x30,0x84,0x71,0x94,0xB3,0x9C,0x55,0xAD,0xAF,0x73,0x0C,0x63,0x28,0x4A,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x6D,0x73,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xAA,0x5A,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x20,0x01,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x20,0x18,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0x08,0x42,0xE7,0x39,0x20,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x66,0x39,0xE8,0x39,0x86,0x31,0xE8,0x39,0xC7,0x39,0xA6,0x31,0xC7,0x31,0xC7,0x41,0x86,0x31,0xC7,0x39,0x66,0x31,
-	0xA7,0x39,0x45,0x29,0x49,0x4A,0xCB,0x5A,0xF3,0xA4,0xB2,0x9C,0xB2,0x9C,0xCB,0x5A,0x30,0x84,0x0C,0x63,0x10,0x84,0xB3,0x9C,0x72,0x94,0xF3,0xA4,0x92,0x94,0xF0,0x83,0x10,0x8C,0x92,0x94,0x92,0x9C,0xCF,0x7B,0x51,0x8C,0xCF,0x83,0x51,0x94,0xEF,0x83,0xF4,0xA4,0xD3,0x9C,0xD3,0xA4,0x55,0xAD,0xCF,0x7B,0xCB,0x5A,0xF0,0x83,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x6D,0x6B,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xAA,0x52,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x01,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x00,0x58,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x18,0x00,0x50,0x20,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xC3,0x18,0x08,0x42,0x08,0x3A,0x00,0x08,0x04,0x21,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0xE7,0x41,0xE7,0x39,0x86,0x31,0x29,0x42,0xA7,0x39,0xA7,0x39,0x86,0x39,0x66,0x29,0x65,0x31,0xA6,0x31,0x65,0x31,
-	0xE7,0x41,0x66,0x31,0x49,0x4A,0xAB,0x5A,0xF3,0xA4,0x72,0x8C,0xD3,0x9C,0x0C,0x63,0x30,0x84,0x8E,0x73,0x30,0x84,0x92,0x94,0xAF,0x7B,0xB2,0x9C,0xB3,0x9C,0x72,0x94,0xB2,0xA4,0xB3,0x9C,0x72,0x94,0xB2,0x9C,0x10,0x8C,0x71,0x8C,0x10,0x84,0x8E,0x73,0x92,0x94,0xD3,0x9C,0xD3,0x9C,0x55,0xAD,0xAF,0x73,0x2C,0x6B,0x30,0x84,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x6D,0x6B,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xC7,0x39,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x18,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x01,0x78,0x01,0x88,0x01,0x88,
-	0x01,0x88,0x01,0x88,0x01,0x80,0x01,0x80,0x01,0x88,0x01,0x88,0x01,0x78,0x00,0x40,0x01,0x88,0x00,0x40,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xA3,0x18,0x28,0x4A,0x86,0x31,0x82,0x10,0xC7,0x39,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0x04,0x21,0x08,0x42,0xA7,0x31,0xC7,0x39,0x86,0x31,0xA6,0x39,0xC7,0x39,0xE8,0x41,0x24,0x29,0x86,0x31,0x65,0x31,
-	0xE7,0x39,0x66,0x31,0xA6,0x31,0xAB,0x52,0x34,0xA5,0x92,0x94,0xB3,0x9C,0x4D,0x6B,0x92,0x94,0x8E,0x73,0x30,0x84,0x92,0x94,0xEC,0x62,0x72,0x94,0x92,0x94,0x30,0x8C,0xF3,0xA4,0x92,0x9C,0xB3,0x9C,0x30,0x8C,0x6D,0x73,0x51,0x8C,0xAF,0x7B,0x72,0x94,0xB3,0x9C,0xD3,0x9C,0xB2,0x9C,0x51,0x8C,0x4D,0x73,0xCF,0x7B,0xAF,0x7B,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0xEB,0x62,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6A,0x52,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x38,0x01,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x78,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0xA2,0x18,0x29,0x4A,0x25,0x29,0x86,0x31,0x86,0x31,0x20,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x82,0x10,0xA7,0x39,0xE7,0x39,0xA7,0x39,0xA6,0x31,0x86,0x31,0xA7,0x39,0x65,0x31,0x45,0x29,0x08,0x42,0x86,0x31,
-	0xC7,0x39,0x86,0x39,0xC7,0x39,0xEC,0x62,0xF0,0x83,0x92,0x94,0x30,0x8C,0x10,0x8C,0x92,0x9C,0xF0,0x83,0x31,0x8C,0x10,0x84,0x2D,0x6B,0x92,0x94,0xB2,0x9C,0xAF,0x7B,0x10,0x84,0x92,0x94,0xD3,0x9C,0x29,0x4A,0xB2,0x9C,0x10,0x8C,0x8E,0x73,0x92,0x94,0xB3,0x9C,0xD3,0x9C,0x92,0x94,0xD3,0x9C,0xCF,0x7B,0x10,0x84,0x10,0x84,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0xAA,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xAA,0x5A,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,0x20,0x28,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x61,0x08,0xE7,0x41,0x61,0x10,0x49,0x52,0x61,0x10,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x00,0x45,0x29,0x04,0x21,0xA7,0x29,0xA7,0x39,0xC7,0x39,0x66,0x31,0x65,0x31,0xAB,0x5A,0x6E,0x73,0x86,0x39,
-	0xA6,0x39,0xE7,0x41,0x86,0x31,0x4D,0x6B,0xF4,0x9C,0x92,0x9C,0x51,0x8C,0x92,0x94,0x92,0x94,0xCF,0x83,0x72,0x94,0x8E,0x7B,0xCF,0x83,0xB2,0x9C,0xF0,0x83,0xEC,0x62,0x72,0x94,0xF4,0x9C,0x8E,0x6B,0xCB,0x5A,0x14,0xA5,0x8E,0x7B,0x6D,0x73,0x72,0x94,0x51,0x8C,0x92,0x8C,0xD3,0x9C,0xF4,0xA4,0x31,0x84,0xAE,0x7B,0x10,0x84,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x8A,0x52,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xAA,0x5A,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x00,0x40,0x20,0x28,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x48,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x25,0x29,0x61,0x10,0x29,0x4A,0x00,0x00,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x82,0x10,0x04,0x21,0xA2,0x10,0xE3,0x18,0x28,0x42,0xA7,0x31,0x08,0x42,0x49,0x4A,0x86,0x39,0x86,0x39,
-	0x29,0x42,0x6D,0x73,0xC7,0x39,0xEF,0x83,0xD3,0x9C,0x72,0x94,0x92,0x94,0xB2,0x9C,0x72,0x8C,0x10,0x84,0x72,0x8C,0xCF,0x7B,0xD3,0x9C,0xCF,0x7B,0x69,0x4A,0xF3,0xA4,0xD3,0x9C,0x92,0x8C,0xC3,0x20,0x4D,0x6B,0xD3,0x9C,0x51,0x8C,0x72,0x94,0xD3,0x9C,0xB3,0x94,0xB3,0x9C,0xB3,0x9C,0xD3,0x9C,0x10,0x8C,0x2C,0x6B,0x2D,0x6B,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0xA6,0x31,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x4D,0x6B,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x20,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x80,0x20,0x10,0x20,0x28,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x30,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0xA2,0x10,0xE3,0x18,0x45,0x29,0x00,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x21,0x10,0x20,0x08,0x82,0x10,0xE3,0x20,0xA3,0x18,0x04,0x21,0x24,0x29,0x45,0x29,0x24,0x29,0x86,0x39,0xC7,0x39,
-	0x8A,0x52,0x4D,0x6B,0x86,0x39,0x92,0x9C,0x92,0x94,0x71,0x94,0xD3,0x9C,0xB2,0x9C,0x30,0x8C,0x31,0x8C,0xB2,0x9C,0x51,0x94,0x31,0x8C,0x4D,0x6B,0x51,0x8C,0x51,0x8C,0x25,0x29,0x41,0x08,0x04,0x21,0x51,0x8C,0x92,0x94,0x31,0x84,0xB3,0x94,0xD3,0x9C,0x51,0x8C,0x72,0x94,0xB3,0x9C,0x34,0xAD,0x92,0x94,0xCF,0x7B,0xEC,0x62,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0xC3,0x18,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x6B,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x10,0x00,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x20,0x30,0x41,0x10,0x20,0x28,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x30,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x65,0x31,0x45,0x21,0x20,0x08,0x41,0x10,0x41,0x10,0x62,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0xAB,0x5A,0x04,0x29,0x65,0x29,0xC3,0x10,0x45,0x29,0xA7,0x39,0xCB,0x52,
-	0x28,0x42,0x28,0x4A,0x2C,0x6B,0x92,0x94,0xB2,0x94,0x51,0x94,0xD3,0x9C,0x51,0x8C,0x10,0x84,0x92,0x94,0x51,0x8C,0x10,0x84,0x72,0x8C,0xAE,0x7B,0x30,0x84,0xC3,0x18,0x62,0x10,0x21,0x08,0x45,0x29,0x31,0x8C,0x92,0x94,0x51,0x8C,0xD3,0x9C,0x51,0x8C,0x51,0x8C,0xB3,0x9C,0xAF,0x73,0x0C,0x63,0x4D,0x73,0x92,0x94,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0xD3,0x9C,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x6B,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x00,0x58,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x10,0x41,0x10,0x20,0x28,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x30,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x62,0x10,0x41,0x10,0x00,0x00,0x08,0x4A,0x82,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x10,0x41,0x08,0x82,0x10,0x65,0x31,0x24,0x29,0xA3,0x18,0xE4,0x20,0x24,0x29,0xE8,0x41,
-	0x04,0x21,0xE8,0x41,0xB3,0x9C,0xB3,0x9C,0xD3,0x94,0x51,0x94,0x72,0x8C,0x51,0x8C,0x51,0x8C,0x72,0x94,0x4D,0x73,0xAB,0x5A,0x4D,0x73,0x51,0x84,0xA2,0x18,0xEB,0x62,0x49,0x4A,0x00,0x00,0xA6,0x39,0x30,0x84,0x30,0x8C,0x51,0x8C,0xB3,0x9C,0xD3,0x9C,0xCF,0x7B,0x10,0x84,0x92,0x94,0xD3,0x9C,0x8E,0x73,0x0C,0x63,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x8A,0x52,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xF3,0x9C,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xCF,0x7B,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x20,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,0x20,0x20,0x41,0x08,0x41,0x08,0x20,0x20,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x6A,0x4A,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0xA3,0x18,0x21,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x82,0x18,0xA2,0x18,0xE3,0x20,0x04,0x21,0x86,0x31,0xC3,0x18,0xA3,0x18,0x24,0x21,
-	0xE8,0x41,0x4D,0x6B,0x8A,0x52,0x4D,0x6B,0xC7,0x41,0x86,0x31,0x08,0x42,0xCB,0x5A,0x6E,0x73,0x69,0x52,0x30,0x8C,0xCB,0x5A,0x72,0x8C,0xC3,0x18,0xCB,0x62,0x2D,0x6B,0xCB,0x5A,0x20,0x08,0xA2,0x10,0x51,0x8C,0x92,0x94,0x30,0x8C,0xB3,0x94,0xEF,0x83,0xCF,0x83,0xD3,0x9C,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x6E,0x73,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xE7,0x41,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x30,0x8C,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x01,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x40,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x20,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x21,0x28,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x20,0x08,0xC3,0x20,0x8A,0x52,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0xE3,0x20,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0x25,0x21,0x25,0x21,0x66,0x31,0x28,0x4A,0xEC,0x62,
-	0x72,0x94,0xF0,0x83,0xCF,0x7B,0x31,0x8C,0xCB,0x62,0x2D,0x63,0x6E,0x73,0x86,0x31,0xE3,0x20,0x8E,0x73,0xAF,0x7B,0x14,0xA5,0x24,0x21,0x0C,0x6B,0xCF,0x7B,0x6A,0x52,0x0C,0x63,0xC7,0x39,0x41,0x08,0x86,0x31,0x14,0xAD,0xCB,0x5A,0x71,0x8C,0x8E,0x73,0x72,0x94,0x92,0x94,0x92,0x94,0x72,0x94,0xB3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x86,0x31,0x75,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x31,0x8C,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x40,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x21,0x38,0x21,0x38,0x21,0x30,0x21,0x30,0x21,0x48,0x01,0xA0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x21,0x48,0x21,0x30,0x20,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x08,0xC7,0x39,0x49,0x4A,0x21,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x25,0x21,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x82,0x10,0x20,0x08,0xE4,0x18,0x6A,0x52,0xCF,0x7B,
-	0xEC,0x62,0x2D,0x6B,0xEC,0x5A,0x86,0x31,0x45,0x29,0x82,0x10,0xE4,0x18,0xCB,0x5A,0xCF,0x7B,0xEF,0x7B,0x92,0x94,0x8A,0x52,0xE7,0x41,0xCF,0x7B,0x2D,0x63,0x8A,0x52,0xAA,0x52,0x30,0x84,0x65,0x29,0x00,0x00,0xC7,0x41,0x08,0x42,0x0C,0x63,0x71,0x94,0x72,0x94,0x92,0x94,0x92,0x9C,0xB2,0x9C,0xB2,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x45,0x29,0x55,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x71,0x8C,0x61,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x00,0x50,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x61,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x08,0x08,0x42,0x08,0x42,0x82,0x10,0x62,0x10,0x21,0x08,0x20,0x08,0xA7,0x31,0xC3,0x18,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x08,0x20,0x00,0xC3,0x18,
-	0xA6,0x39,0x86,0x31,0xA6,0x31,0x6A,0x4A,0x49,0x4A,0xCB,0x5A,0x28,0x4A,0x28,0x4A,0xE7,0x41,0xEF,0x83,0x92,0x94,0xA6,0x39,0x8E,0x73,0xCF,0x7B,0x8E,0x73,0x6E,0x73,0x8E,0x7B,0x51,0x8C,0x29,0x4A,0xA2,0x10,0x20,0x00,0x41,0x08,0xA7,0x31,0x71,0x94,0xB2,0x9C,0x72,0x94,0x92,0x94,0xB3,0x9C,0xB3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x45,0x29,0x55,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB2,0x94,0xA2,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x20,0x08,0x28,0x4A,0xC7,0x39,0xE4,0x20,0xA2,0x10,0x20,0x08,0x20,0x08,0x62,0x10,0xC3,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x62,0x10,0x82,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x08,0x00,0x08,
-	0x69,0x52,0x8A,0x5A,0x04,0x21,0x66,0x31,0x24,0x29,0x04,0x21,0x86,0x31,0x49,0x4A,0xF0,0x83,0x72,0x94,0xEC,0x62,0xAA,0x5A,0xCF,0x7B,0x6E,0x73,0xEC,0x62,0x6D,0x73,0x10,0x84,0x6A,0x52,0x66,0x31,0x45,0x31,0x41,0x08,0x21,0x08,0x82,0x10,0xAF,0x7B,0x92,0x94,0x92,0x94,0x72,0x94,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x45,0x31,0x55,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB2,0x94,0xA2,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x10,0x01,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x48,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x65,0x31,0x49,0x42,0xC3,0x18,0xE4,0x20,0x21,0x08,0x21,0x08,0x41,0x10,0xE7,0x39,0x20,0x08,0x41,0x10,0x41,0x10,0x20,0x08,0xE7,0x41,0x08,0x3A,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,
-	0x20,0x08,0x20,0x08,0x24,0x29,0xA3,0x18,0x00,0x00,0x41,0x08,0x82,0x18,0x8A,0x4A,0x71,0x94,0xCF,0x7B,0xEB,0x5A,0x31,0x8C,0xB2,0x94,0x6A,0x52,0x92,0x94,0xAE,0x7B,0xAE,0x7B,0x6D,0x73,0x30,0x8C,0x49,0x4A,0xC7,0x41,0x24,0x29,0x00,0x00,0x69,0x52,0x30,0x8C,0x10,0x8C,0x71,0x8C,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x45,0x29,0x55,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB2,0x94,0xA2,0x18,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x18,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x38,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x08,0x82,0x18,0x28,0x42,0x41,0x08,0x45,0x29,0xE3,0x18,0xA2,0x10,0x00,0x00,0x66,0x29,0x61,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0xCB,0x62,0x86,0x31,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x04,0x21,0x8A,0x52,0x8A,0x52,0xA6,0x31,0x28,0x4A,0x8E,0x73,0xE7,0x39,0xCF,0x7B,0xAF,0x7B,0x30,0x8C,0xB2,0x9C,0xD3,0x9C,0x6E,0x73,0x0C,0x6B,0xF3,0xA4,0xCF,0x7B,0x10,0x8C,0x14,0xA5,0xAB,0x5A,0x0C,0x63,0x6E,0x73,0x61,0x10,0xA2,0x10,0xAE,0x73,0xF0,0x83,0xEF,0x83,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x45,0x29,0x55,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB2,0x94,0xC3,0x18,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x20,0x18,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x38,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x08,0x45,0x19,0x41,0x00,0x04,0x21,0xA2,0x18,0xA7,0x39,0x21,0x08,0x61,0x10,0xC3,0x18,0x20,0x08,0x41,0x10,0x41,0x08,0x0C,0x6B,0x62,0x10,0x00,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x24,0x29,0x49,0x4A,0x45,0x31,0xAF,0x7B,0x30,0x8C,0x72,0x94,0x49,0x4A,0x6A,0x52,0x86,0x31,0xCB,0x62,0x8A,0x52,0xCF,0x83,0xAF,0x7B,0x6A,0x4A,0xAE,0x7B,0x92,0x94,0xB2,0x94,0x72,0x8C,0x2D,0x63,0x49,0x4A,0x08,0x42,0xA6,0x39,0x00,0x00,0x82,0x10,0x2D,0x6B,0x10,0x84,0x0C,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x45,0x31,0x55,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x14,0xA5,0x04,0x21,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x20,0x18,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x21,0x30,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x20,0x08,0xE3,0x18,0xA2,0x10,0xE4,0x20,0x62,0x10,0x21,0x08,0x45,0x29,0x21,0x08,0x21,0x08,0xC3,0x18,0xAB,0x52,0x00,0x00,0xE4,0x20,0x89,0x5A,0x61,0x10,0x41,0x10,0x41,0x10,
-	0x20,0x08,0x04,0x21,0x45,0x29,0xA7,0x39,0xF0,0x83,0x6E,0x73,0x31,0x8C,0xCF,0x83,0xAB,0x5A,0x65,0x29,0x24,0x29,0x08,0x42,0x0C,0x63,0x45,0x29,0xE7,0x39,0xA7,0x39,0xE7,0x39,0xA7,0x39,0xA6,0x31,0xC7,0x39,0xA3,0x18,0x62,0x10,0xE4,0x20,0xC3,0x18,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x45,0x31,0x55,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x14,0xA5,0x04,0x21,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x18,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x30,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x45,0x29,0x41,0x08,0x21,0x08,0x21,0x08,0x62,0x10,0x82,0x10,0x00,0x00,0x69,0x5A,0x65,0x29,0x00,0x00,0xEC,0x5A,0xCB,0x52,0x20,0x08,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x65,0x31,0x86,0x31,0x28,0x4A,0x10,0x84,0x6E,0x73,0x10,0x8C,0x92,0x94,0x4D,0x6B,0x49,0x4A,0xA6,0x31,0x45,0x29,0x82,0x10,0x82,0x10,0xC3,0x18,0x04,0x21,0xE3,0x20,0xE4,0x20,0x04,0x21,0x45,0x29,0x24,0x21,0x62,0x10,0x62,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x45,0x29,0x34,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB2,0x94,0xA2,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x18,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x30,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x08,0x62,0x10,0x04,0x21,0x21,0x08,0x41,0x10,0x21,0x10,0x20,0x08,0x04,0x21,0x8E,0x73,0x41,0x08,0xA6,0x31,0x0C,0x63,0x00,0x00,0x20,0x08,0x41,0x10,0x41,0x10,
-	0x20,0x08,0xE3,0x20,0xAB,0x5A,0x28,0x42,0x10,0x84,0x6E,0x6B,0xEB,0x62,0x92,0x94,0x51,0x8C,0x4D,0x73,0x29,0x4A,0x45,0x31,0x00,0x00,0x41,0x08,0x21,0x08,0x00,0x08,0x21,0x08,0x21,0x08,0x00,0x08,0x20,0x08,0x41,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x04,0x21,0x14,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xEF,0x7B,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x20,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x28,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x00,0x24,0x29,0x4D,0x63,0xA2,0x18,0xCB,0x5A,0x0C,0x5B,0x41,0x08,0x41,0x08,0x21,0x08,0x41,0x08,0x41,0x08,
-	0x61,0x10,0x41,0x08,0x29,0x4A,0x69,0x52,0xAE,0x7B,0x30,0x8C,0x8A,0x5A,0x10,0x84,0x30,0x8C,0x71,0x94,0x86,0x31,0x66,0x31,0xE7,0x41,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x04,0x29,0x14,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x28,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x30,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x08,0xC7,0x39,0xAB,0x5A,0x65,0x31,0xAA,0x52,0x08,0x42,0x00,0x00,0x41,0x08,0x41,0x08,0x66,0x31,0x20,0x08,0x41,0x08,
-	0x82,0x18,0xA3,0x18,0xE4,0x20,0x8A,0x5A,0x4D,0x6B,0xCF,0x83,0xCB,0x5A,0x29,0x42,0x71,0x94,0xD3,0x9C,0xCB,0x52,0xC3,0x18,0xAF,0x73,0xC3,0x18,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0xA2,0x10,0xE4,0x20,0xA2,0x18,0xC7,0x39,0xE8,0x41,0x45,0x29,0xE8,0x41,0xE3,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x18,0x41,0x08,0x41,0x10,0x41,0x08,0x04,0x21,0x14,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x28,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x30,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0xC3,0x18,0xE3,0x20,0x20,0x08,0x82,0x18,0x41,0x08,0x20,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0xC3,0x20,0xC7,0x39,0xA7,0x39,
-	0xC3,0x18,0x20,0x00,0x25,0x29,0xE7,0x39,0x51,0x8C,0xAF,0x7B,0xCF,0x7B,0xEC,0x62,0x72,0x94,0x51,0x8C,0x10,0x84,0x04,0x29,0x6E,0x73,0x45,0x29,0x41,0x10,0x00,0x00,0x0C,0x63,0x28,0x4A,0x30,0x84,0x14,0xAD,0xE8,0x41,0x96,0xB5,0x35,0xAD,0x6D,0x73,0x96,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x04,0x29,0x14,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x18,0x00,0x60,0x01,0x88,0x01,0x88,0x01,0x88,0x01,0x88,0x01,0x88,0x01,0x88,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x90,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x01,0x88,0x21,0x20,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x82,0x10,0x86,0x31,0x28,0x42,0x8A,0x52,
-	0x49,0x4A,0x21,0x08,0xC3,0x18,0x25,0x29,0xAE,0x7B,0xAE,0x7B,0xEF,0x83,0x6A,0x4A,0x51,0x8C,0x8E,0x73,0x4D,0x6B,0x49,0x4A,0x2C,0x6B,0x65,0x29,0xA2,0x18,0x20,0x00,0x6D,0x6B,0x08,0x42,0x08,0x42,0x28,0x4A,0xE3,0x20,0x49,0x52,0x28,0x42,0x66,0x31,0xAB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x04,0x29,0x14,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x78,0x21,0x28,0x20,0x18,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0xC3,0x18,0x61,0x08,0xC7,0x39,0x6E,0x6B,0x8A,0x52,0x49,0x4A,0x6E,0x73,
-	0x66,0x29,0x20,0x08,0xA2,0x18,0xE7,0x39,0xCB,0x5A,0x30,0x8C,0x10,0x84,0x8A,0x52,0xAF,0x7B,0xF0,0x7B,0x8A,0x52,0xCF,0x7B,0xEF,0x83,0x65,0x31,0x04,0x21,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x04,0x29,0x14,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x01,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x60,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x08,0x82,0x10,0xCF,0x83,0x10,0x8C,0xA7,0x39,0x8E,0x6B,0xEC,0x5A,0xC7,0x39,
-	0xC3,0x20,0x41,0x08,0x41,0x08,0xE8,0x41,0xC3,0x18,0x51,0x8C,0xAB,0x52,0x2D,0x6B,0x8E,0x73,0x10,0x84,0xEB,0x62,0xCF,0x83,0x30,0x8C,0x25,0x29,0x66,0x31,0x21,0x08,0x41,0x08,0xE4,0x20,0x04,0x21,0x45,0x29,0x25,0x29,0x45,0x29,0x61,0x08,0x24,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x04,0x29,0x14,0xA5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x18,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x10,0x61,0x08,0x20,0x00,0xE7,0x39,0x10,0x84,0x49,0x4A,0xAA,0x5A,0xEB,0x62,0xA7,0x39,0x49,0x4A,0xC7,0x39,
-	0x82,0x10,0xC3,0x18,0x21,0x08,0xAB,0x5A,0x04,0x21,0xE7,0x41,0x72,0x94,0x10,0x84,0xCF,0x83,0x92,0x94,0xCB,0x5A,0x10,0x8C,0x71,0x94,0xE8,0x39,0xC7,0x39,0x20,0x08,0xC3,0x18,0xEB,0x62,0x86,0x31,0xE8,0x39,0x66,0x29,0x66,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x04,0x21,0xF3,0x9C,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x08,0xA2,0x18,0x0C,0x63,0xEF,0x83,0x8E,0x6B,0x8A,0x5A,0x69,0x4A,0x29,0x4A,0x86,0x39,0x69,0x4A,0xA6,0x39,
-	0x00,0x00,0x82,0x10,0x62,0x10,0x86,0x39,0x8A,0x4A,0x29,0x4A,0x8E,0x7B,0x51,0x94,0x31,0x8C,0x92,0x9C,0x8E,0x7B,0x31,0x84,0xD3,0x9C,0xCB,0x5A,0x82,0x10,0x20,0x00,0x04,0x21,0xE7,0x41,0xC7,0x39,0xA7,0x39,0x65,0x29,0xE4,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0xC3,0x18,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x40,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x04,0x21,0x20,0x00,0x08,0x42,0xEF,0x83,0xEB,0x6A,0x49,0x52,0xE7,0x41,0xA6,0x39,0x65,0x31,0x65,0x29,0x66,0x31,0x4D,0x73,0x45,0x29,
-	0x00,0x08,0x41,0x08,0x21,0x08,0x61,0x08,0x8E,0x73,0xE8,0x41,0xCF,0x7B,0x72,0x8C,0x51,0x8C,0x51,0x8C,0x30,0x8C,0x51,0x94,0x92,0x94,0x4D,0x6B,0x4D,0x6B,0x61,0x08,0xA2,0x18,0x65,0x31,0x08,0x42,0xC3,0x18,0x61,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0xA2,0x18,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x30,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0xC3,0x18,0x2D,0x6B,0x6E,0x6B,0xA6,0x39,0x49,0x4A,0xE8,0x39,0x65,0x29,0x66,0x29,0x66,0x31,0x86,0x31,0x08,0x42,0x65,0x31,0x82,0x10,
-	0x20,0x08,0x41,0x10,0x41,0x10,0x00,0x00,0xEC,0x62,0x65,0x31,0xAF,0x7B,0xF0,0x83,0x31,0x8C,0x92,0x8C,0x72,0x8C,0x31,0x8C,0x72,0x94,0xAF,0x7B,0x8E,0x73,0x82,0x10,0x04,0x29,0xB2,0x9C,0x4D,0x6B,0x8E,0x73,0xAF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0xA2,0x18,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x6B,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x40,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0x21,0x08,0x20,0x08,0x00,0x00,0xE7,0x41,0x4D,0x73,0x08,0x42,0x49,0x4A,0x08,0x42,0xC7,0x39,0xA6,0x31,0x24,0x29,0xE8,0x41,0x0C,0x5B,0x2D,0x6B,0xA2,0x10,0x20,0x08,0xC3,0x18,
-	0x62,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0xE4,0x20,0x6A,0x52,0x28,0x4A,0x10,0x84,0x31,0x8C,0x31,0x8C,0x10,0x84,0x6E,0x73,0x92,0x9C,0x10,0x8C,0xCF,0x7B,0xA2,0x10,0x45,0x29,0x8E,0x7B,0xAA,0x5A,0x31,0x8C,0x71,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0xA2,0x18,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x18,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x58,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0x6A,0x52,0x8D,0x7B,0x25,0x21,0xA7,0x39,0x2C,0x6B,0x24,0x21,0x41,0x10,0xE4,0x18,0x08,0x42,0x86,0x39,0xE4,0x20,0x25,0x29,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x04,0x21,0x41,0x08,0x21,0x08,0x41,0x08,0x61,0x08,0x2C,0x6B,0x05,0x29,0x72,0x94,0x51,0x8C,0xF0,0x83,0x10,0x84,0xF0,0x83,0x51,0x94,0x10,0x84,0xAE,0x7B,0xA2,0x10,0x86,0x31,0xCF,0x7B,0x8A,0x52,0x31,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0xA2,0x18,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x50,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x38,0x01,0x88,0x21,0x28,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x82,0x10,0x00,0x00,0x49,0x4A,0x49,0x52,0x82,0x18,0xC3,0x18,0x41,0x08,0x04,0x21,0xE3,0x18,0x62,0x10,0x41,0x08,0xA3,0x18,0x20,0x08,0x20,0x08,0x82,0x18,0xA2,0x18,0x21,0x08,0x04,0x21,
-	0xA2,0x10,0x04,0x21,0x20,0x08,0x41,0x08,0x20,0x00,0xAA,0x5A,0xCB,0x62,0xAF,0x7B,0x51,0x94,0x51,0x8C,0x31,0x8C,0x10,0x84,0x71,0x94,0xEF,0x83,0x31,0x8C,0xA2,0x10,0x25,0x29,0x6D,0x73,0x2C,0x6B,0x71,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0xC3,0x20,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x48,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x60,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x40,0x00,0x50,0x20,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0xE8,0x49,0xCF,0x83,0x24,0x29,0xC3,0x20,0x20,0x00,0x41,0x10,0x04,0x29,0xE8,0x41,0x62,0x10,0x61,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0xA2,0x10,0xA2,0x18,0x00,0x08,0x20,0x08,
-	0x20,0x08,0x82,0x10,0x20,0x08,0xA2,0x18,0x20,0x08,0xA3,0x18,0x10,0x84,0x0C,0x63,0x30,0x8C,0xCF,0x7B,0x31,0x8C,0x10,0x84,0x71,0x94,0xF0,0x83,0x92,0x94,0xC3,0x18,0xC3,0x20,0x10,0x8C,0x8E,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0xC3,0x18,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x58,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x8E,0x73,0x61,0x08,0x45,0x29,0xC3,0x20,0x24,0x21,0xC3,0x20,0x21,0x08,0x20,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x41,0x08,0x41,0x08,0x00,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x00,0x00,0x2C,0x6B,0x8E,0x7B,0x10,0x84,0x51,0x8C,0x51,0x8C,0x30,0x8C,0x72,0x94,0x10,0x8C,0xB2,0x9C,0xC3,0x18,0x65,0x31,0x51,0x8C,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0xA2,0x18,0xB2,0x94,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0x98,0x21,0x48,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x18,0xEC,0x5A,0x00,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x18,0x20,0x08,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0xA2,0x18,0x61,0x10,0x21,0x08,0x04,0x21,0x86,0x31,0x21,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x20,0x00,0x24,0x29,0xEB,0x62,0x86,0x39,0xCF,0x83,0x51,0x8C,0x10,0x8C,0xEF,0x83,0xCF,0x7B,0xAF,0x7B,0xC3,0x18,0x45,0x29,0x31,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x51,0x8C,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x6D,0x73,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x20,0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,
-	0x00,0x58,0x00,0x58,0x00,0x58,0x00,0x58,0x21,0x30,0x20,0x18,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x00,0x00,0x86,0x39,0x6A,0x52,0x45,0x29,0x21,0x08,0x41,0x08,0x41,0x10,0xE3,0x20,0x82,0x10,0xC3,0x20,0x21,0x08,0x41,0x10,0x41,0x10,0x61,0x10,0x04,0x21,0x82,0x10,0xC3,0x20,0x42,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x21,0x08,0x41,0x08,0xCF,0x83,0xEC,0x62,0xE7,0x41,0xAF,0x7B,0x31,0x8C,0xAE,0x7B,0xF0,0x83,0x71,0x94,0xC3,0x18,0x25,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0x14,0xA5,0x14,0xA5,0x14,0xA5,0xD3,0x9C,0x92,0x94,0x71,0x8C,0xB2,0x94,0xF3,0x9C,0x28,0x4A,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x69,0x52,0x2C,0x6B,0xE7,0x41,0x21,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x04,0x21,0x82,0x10,0x82,0x18,0x21,0x08,0x41,0x08,0x21,0x08,0x41,0x08,0x62,0x10,0x25,0x29,0x21,0x08,0x62,0x10,
-	0x21,0x08,0x21,0x08,0x61,0x10,0x20,0x00,0x28,0x4A,0x41,0x08,0x20,0x08,0x24,0x29,0x8E,0x73,0xEC,0x62,0x2D,0x6B,0x2C,0x6B,0x31,0x8C,0x0C,0x63,0xB2,0xA4,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x04,0x29,0x04,0x29,0xE3,0x20,0xA2,0x18,0x82,0x10,0xC3,0x18,0xE4,0x20,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x4D,0x6B,0x82,0x10,0x41,0x08,0x20,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x62,0x10,0xE3,0x18,0x21,0x08,0x41,0x08,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x08,
-	0x61,0x10,0x82,0x10,0x21,0x08,0x41,0x08,0x45,0x29,0x41,0x08,0x41,0x10,0x20,0x08,0xC3,0x18,0x8A,0x52,0xE8,0x41,0x2D,0x6B,0x8E,0x73,0x6D,0x73,0xAE,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x41,0x08,0x00,0x28,0x00,0x50,0x21,0x38,0x21,0x30,0x21,0x28,0x21,0x30,0x20,0x28,0x20,0x28,0x20,0x18,0x20,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x08,0x65,0x31,0xEC,0x5A,0x41,0x08,0x41,0x10,0x04,0x21,0x62,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x61,0x10,0x82,0x10,0x41,0x10,0x20,0x08,0x21,0x08,0x41,0x08,0x21,0x08,0x08,0x42,0x6A,0x52,0xEC,0x62,0x0C,0x63,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x20,0x10,0x01,0x88,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xA8,0x01,0xA8,0x01,0xA0,0x01,0xA0,0x01,0x90,0x01,0x90,0x01,0x88,0x01,0x88,0x21,0x28,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0xAB,0x5A,0x66,0x31,0x21,0x08,0x41,0x10,0x61,0x10,0x82,0x10,0x25,0x29,0x00,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x21,0x08,0x21,0x08,0x41,0x10,0x04,0x21,0xC3,0x20,0x61,0x10,0x62,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0xC3,0x20,0x08,0x42,0x2D,0x6B,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x20,0x20,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,0x01,0x70,0x01,0x70,0x01,0x70,0x01,0x68,0x21,0x20,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x18,0x01,0x78,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,
-	0x01,0x98,0x01,0x98,0x00,0x58,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x69,0x52,0xA6,0x39,0x04,0x21,0x21,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0x21,0x08,0x42,0x10,0x61,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x21,0x08,0x82,0x18,0x21,0x08,0x41,0x10,0x41,0x10,0x00,0x08,0x24,0x29,0x2C,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x20,0x20,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,0x00,0x20,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x21,0x30,0x21,0x40,0x00,0x58,0x00,0x88,0x01,0xA8,0x02,0xB0,0x02,0xB0,
-	0x02,0xB0,0x02,0xB0,0x01,0xA8,0x00,0x58,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x69,0x52,0x86,0x31,0x24,0x29,0x00,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x61,0x10,0x41,0x10,0x41,0x08,0xA3,0x18,0x45,0x29,0x24,0x29,0x20,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,
-	0x20,0x18,0x01,0x90,0x02,0xB0,0x01,0xA0,0x00,0x50,0x00,0x30,0x00,0x28,0x20,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x18,0x20,0x20,0x20,0x28,0x20,0x18,0x20,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x18,0x01,0x70,0x01,0xA8,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x70,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x20,0x08,0xC7,0x39,0x29,0x4A,0x41,0x08,0x21,0x10,0x41,0x10,0x82,0x10,0x89,0x52,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0x69,0x4A,0x86,0x31,0x08,0x42,0x08,0x42,0x86,0x39,0x86,0x31,0x69,0x4A,
-	0x2C,0x63,0xEF,0x7B,0x30,0x84,0xB2,0x94,0xE7,0x39,0x62,0x10,0x21,0x08,0x41,0x10,0x21,0x08,0x41,0x08,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x20,0x20,0x01,0x98,0x01,0xA8,0x00,0x60,0x21,0x50,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x48,0x01,0x78,0x01,0x90,0x01,0x98,0x01,0xA0,0x01,0x90,0x01,0x88,0x01,0x60,0x20,0x18,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x50,
-	0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x70,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x08,0x42,0xA7,0x39,0x20,0x08,0x41,0x10,0x41,0x10,0x89,0x52,0x75,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x34,0xA5,0xCB,0x5A,0x41,0x10,0x20,0x00,0xA3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x20,0x20,0x01,0xA0,0x01,0x90,0x01,0x90,0x01,0x80,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x18,0x20,0x40,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x00,0x48,0x20,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x01,0x70,0x01,0xA8,0x02,0xB0,0x00,0x48,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0xC7,0x41,0xA6,0x31,0x20,0x08,0x41,0x10,0x41,0x08,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x4D,0x6B,0x45,0x29,0x45,0x29,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x20,0x20,0x01,0xA0,0x01,0x78,0x21,0x28,0x21,0x28,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x18,0x01,0x78,0x01,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x01,0x78,0x20,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x20,0x28,0x01,0xA0,0x01,0xA8,0x21,0x30,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x08,0xA3,0x18,0x86,0x31,0x29,0x4A,0x21,0x08,0x21,0x08,0xC3,0x18,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x75,0xAD,0x8A,0x52,0xA6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x20,0x28,0x01,0xA0,0x00,0x60,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x18,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x78,0x20,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x20,0x20,0x01,0x98,0x01,0x98,0x20,0x20,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x08,0xC3,0x18,0x08,0x42,0x24,0x21,0x41,0x08,0x41,0x10,0x20,0x08,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x20,0x20,0x01,0xA0,0x00,0x40,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x20,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x68,0x20,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x20,0x18,0x01,0x90,0x01,0x78,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x20,0xE8,0x41,0x21,0x08,0x41,0x10,0x61,0x10,0x41,0x10,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x20,0x18,0x01,0x78,0x20,0x28,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x18,0x00,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x20,0x38,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x20,0x10,0x00,0x48,0x20,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0x41,0x10,0x65,0x29,0x66,0x31,0x00,0x00,0x61,0x10,0x20,0x08,0x41,0x10,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x58,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x21,0x08,0x82,0x10,0x86,0x31,0xC7,0x41,0x41,0x08,0x61,0x10,0x04,0x21,0x41,0x10,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x28,0x21,0x80,0x21,0x78,0x21,0x58,0x21,0x20,0x41,0x28,0x21,0x20,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x20,0x21,0x18,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x20,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x50,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xC3,0x20,0x86,0x31,0xC7,0x39,0x00,0x00,0x41,0x10,0xC3,0x18,0x41,0x08,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x21,0x48,0x02,0xB8,0x01,0xB0,0x02,0xB8,0x01,0xA8,0x01,0xB8,0x01,0xB0,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0xA8,0x21,0x18,0x41,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x00,0x50,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,0x20,0x18,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x20,0x08,0xC3,0x18,0xC7,0x39,0x08,0x42,0x00,0x00,0x41,0x10,0x20,0x08,0x41,0x10,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x01,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x20,0x30,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x20,0x21,0x28,0x41,0x10,0x41,0x08,0x41,0x08,0x21,0x08,0x24,0x21,0xE8,0x41,0xC7,0x39,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x01,0xB0,0x01,0x90,0x21,0x20,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x20,0x30,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x70,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x38,0x01,0x90,0x01,0xA0,0x00,0x48,0x41,0x10,0x41,0x10,0x20,0x08,0x86,0x39,0x08,0x42,0x65,0x31,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0xE7,0x41,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xC0,0x21,0x40,0x41,0x00,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,
-	0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x20,0x18,0x01,0x88,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x00,0x60,0x00,0x38,0x00,0x50,0x01,0x90,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x20,0x18,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x40,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x00,0x60,0x41,0x10,0x41,0x10,0x20,0x08,0x29,0x4A,0xC7,0x39,0x08,0x42,0x00,0x00,0x41,0x10,0x41,0x10,0x61,0x10,0xA6,0x31,0x75,0xAD,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x75,0xAD,0x34,0xA5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xB0,0x02,0xA8,0x01,0xA8,0x41,0x18,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x40,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,0x20,0x38,0x41,0x10,0x41,0x08,0x41,0x08,0x20,0x18,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x48,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x00,0x40,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x01,0x98,0x20,0x20,0x41,0x10,0x41,0x10,0x00,0x08,0x8A,0x5A,0xA6,0x31,0x8A,0x52,0x41,0x08,0x81,0x10,0x21,0x08,0x41,0x10,0xCB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x58,0x21,0x58,0x01,0x70,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xB8,0x01,0x50,0x41,0x00,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x00,0x78,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x60,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x50,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x78,0x41,0x10,
-	0x41,0x10,0x00,0x40,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x00,0x50,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x4D,0x6B,0x04,0x29,0x49,0x52,0x49,0x4A,0x41,0x08,0x21,0x08,0x41,0x10,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x21,0x38,0x02,0xA0,0x02,0xB0,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x02,0xA8,0x01,0xB0,0x01,0x88,0x21,0x20,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x98,0x20,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x20,0x20,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA8,0x21,0x30,
-	0x20,0x20,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x70,0x20,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0xC7,0x39,0x45,0x29,0xA2,0x18,0x45,0x31,0x20,0x08,0x41,0x10,0x41,0x10,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xB8,0x21,0x48,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x20,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x01,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x70,
-	0x20,0x18,0x01,0x98,0x02,0xB0,0x02,0xB0,0x01,0x90,0x20,0x18,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x20,0x08,0x28,0x42,0x08,0x42,0x20,0x00,0x00,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0xEB,0x5A,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xB0,0x02,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xA8,0x01,0xB8,0x41,0x20,0x41,0x00,0x21,0x38,0x21,0x20,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x00,0x40,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x50,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x00,0x38,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,
-	0x41,0x10,0x00,0x50,0x02,0xB0,0x01,0x98,0x21,0x20,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x21,0x08,0xA2,0x10,0x8E,0x73,0x41,0x08,0x41,0x08,0x41,0x10,0xA2,0x18,0x62,0x10,0x82,0x10,0xCE,0x73,0x96,0xB5,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xB8,0x21,0x28,0x41,0x00,0x22,0x60,0x21,0x38,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x58,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x60,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0xA8,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xA8,
-	0x20,0x08,0x41,0x08,0x00,0x40,0x20,0x18,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x21,0x08,0xC3,0x20,0xAA,0x52,0xA2,0x18,0x61,0x10,0x41,0x08,0x62,0x10,0x41,0x10,0x41,0x10,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xB0,0x01,0xB8,0x21,0x68,0x41,0x08,0x41,0x18,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x60,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x60,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x01,0x98,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x00,0x28,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x21,0x08,0x03,0x21,0xA2,0x18,0x86,0x31,0x41,0x08,0x62,0x10,0x41,0x10,0x62,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,0x01,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,
-	0x00,0x48,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x21,0x08,0x61,0x10,0xA2,0x18,0x21,0x08,0x41,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x01,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x40,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0xA0,
-	0x00,0x28,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x00,0x45,0x31,0xA3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x01,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x21,0x40,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x68,
-	0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x10,
-	0x41,0x08,0x41,0x08,0x41,0x10,0x01,0x70,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x00,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,
-	0x41,0x10,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x41,0x10,0x41,0x08,0x01,0x68,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x80,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x00,0x80,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x58,
-	0x41,0x08,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x01,0x90,0x41,0x10,0x41,0x08,0x41,0x08,0x41,0x10,0x41,0x08,0x41,0x10,0x41,0x08,0x20,0x38,0x01,0xA0,0x02,0xB0,0x02,0xB0,0x02,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_1169_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_1169_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_1169_dial_img_preview_data_0};
-
-    
\ No newline at end of file
@@ -190,9 +190,10 @@ void init_face_116_2(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_
     lv_obj_set_y(face_116_2_18_162424, 40);
     lv_obj_add_flag(face_116_2_18_162424, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_116_2_18_162424, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_116_2_0_384);
 
 
-    callback("Outline", &face_116_2_dial_img_preview_0, &face_116_2, NULL);
+    callback("Outline", NULL, &face_116_2, NULL);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_116_2 // (Outline) uncomment to enable or define it elsewhere
 
@@ -84,8 +85,6 @@ extern "C"
 	LV_IMG_DECLARE(face_116_2_dial_img_18_162424_4);
 	LV_IMG_DECLARE(face_116_2_dial_img_18_162424_5);
 	LV_IMG_DECLARE(face_116_2_dial_img_18_162424_6);
-	LV_IMG_DECLARE(face_116_2_dial_img_preview_0);
-	LV_IMG_DECLARE(face_116_2_dial_img_preview_0);
 
 
 #endif
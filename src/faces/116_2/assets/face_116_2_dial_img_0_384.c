@@ -5,6 +5,7 @@
 // Watchface: 116_2
 
 #include "../116_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,1813 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_0_384_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x60,0x20,0x40,0x28,0x40,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x40,0x30,0x40,0x28,0x40,0x20,0x61,0x18,0x41,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x20,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x40,0x20,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x10,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x00,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x08,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x60,0x30,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x10,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x20,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x60,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x60,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x20,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x61,0x28,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x40,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x82,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x40,0x20,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x28,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x60,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x10,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x60,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x61,0x10,0x20,0x00,0x20,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x28,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x10,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x41,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x18,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0xA2,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x61,0x18,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x30,0x00,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x20,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x60,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x08,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0xA2,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x28,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x28,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x82,0x20,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x10,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x18,0x81,0x28,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x28,0xA2,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x18,0x61,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x00,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA2,0x18,0x61,0x20,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x20,0x18,0x20,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x20,0x10,0x40,0x20,0x61,0x28,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x28,
-	0x40,0x20,0x20,0x10,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x81,0x28,0xA0,0x58,0x01,0x91,0x62,0xB9,0xA1,0xD9,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0xA1,0xD9,0x62,0xB9,0x01,0x91,0xA0,0x58,0x81,0x28,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x40,0x20,0xE0,0x78,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0x22,0x81,0xC2,0x30,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x40,0x28,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0xE2,0x40,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC2,0x28,0x62,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x41,0xB9,0xC0,0x70,0x02,0x59,0xE2,0x38,0xA2,0x20,0x00,0x00,0x00,0x00,0x82,0x20,0xE2,0x38,0x02,0x59,
-	0xE1,0x78,0x41,0xB9,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xA9,0xE3,0x28,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0xA0,0x50,0xA1,0xF1,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB9,0xC1,0x58,0xC2,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x08,0xA0,0x50,0x62,0xB9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x02,0x61,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x42,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0xE2,0x40,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x60,0x30,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x42,0x99,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xC2,0x20,0x61,0xB9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA2,0xE1,
-	0xA1,0x48,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x40,0x28,0xC0,0x70,0x62,0xB1,0xA2,0xD1,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0xA2,0xD1,0x62,0xB1,0xC0,0x70,0x40,0x28,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0xA1,0x48,0xA2,0xE1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB9,0xC3,0x20,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x08,0x81,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x61,0x18,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x08,0xE1,0x70,0xA2,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0xC0,0x70,0x82,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x08,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x61,0x10,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x18,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x42,0x89,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0x22,0x79,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0xC0,0x70,0xA2,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0xE0,0x78,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB9,0x00,0x00,
-	0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x20,0x00,0xA2,0x10,0xA2,0x10,0x81,0x28,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x21,0xA9,0x22,0x71,0xE2,0x48,0xA2,0x20,0x00,0x00,0x00,0x00,0x81,0x20,0xE2,0x48,0x22,0x71,
-	0x21,0xA9,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x61,0x28,0xC3,0x18,0xC3,0x18,0x41,0x08,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0x99,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0xE2,0x60,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x42,0x89,0x82,0x10,0x00,0x00,0x00,0x00,0xC1,0x50,
-	0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x22,0x71,0xC3,0x20,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x18,0xC0,0x60,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x80,0x48,0x61,0x08,0xC3,0x18,0xA2,0x10,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0x02,0x61,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x40,0x18,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x00,0x00,0x82,0x10,0xA2,0x10,0xE2,0x60,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x22,0x81,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x10,0xC0,0x70,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x00,0x00,0x82,0x10,0xC3,0x18,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0xE3,0x30,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x21,0xA1,0xC1,0xF9,0xC1,0xF9,0xA2,0xE1,0xC2,0x20,0x20,0x00,0x00,0x00,0xA0,0x50,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x81,0xD9,0x60,0x30,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x40,0x20,0x22,0x81,0x82,0xC1,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x82,0xC1,0x22,0x81,0x40,0x28,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x60,0x30,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0x50,0x00,0x00,0x20,0x00,0xC2,0x20,0xA2,0xE1,0xC1,0xF9,
-	0xC1,0xF9,0x21,0xA1,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xA1,0x38,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x48,0x61,0x08,0xA2,0x10,0xC2,0x38,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xA2,0xD9,0xC2,0x28,0x20,0x00,0x00,0x00,0x20,0x00,0xE2,0x48,0x82,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x81,0xC1,0x60,0x38,0x00,0x00,0x82,0x10,0xC3,0x18,0xC2,0x28,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0xE2,0x38,0x00,0x00,0x00,0x00,0xA1,0x48,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x40,0x30,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x41,0xA9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0x41,0x08,0x00,0x00,0x00,0x00,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,
-	0x20,0x10,0x61,0x08,0xA2,0x10,0xA2,0x18,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0x99,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x28,0xA1,0xD9,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0xA9,
-	0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0xC2,0x30,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0x30,0xA2,0x10,0xA2,0x10,0xE1,0x70,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xE2,0x40,0x41,0x08,0x00,0x00,0x20,0x10,0x82,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0x02,0x69,0xC2,0x30,0x00,0x00,0x00,0x08,0x81,0x30,0x02,0x69,0x62,0xB1,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x82,0xC9,0x40,0x18,0x00,0x00,0x20,0x00,0xE2,0x40,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xE1,0x70,0xA2,0x10,0xC3,0x18,0xA1,0x38,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xE3,0x30,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0xE0,0x78,0xC1,0xF9,0xC1,0xF9,0x62,0xB9,0x00,0x00,0x00,0x00,0x61,0x18,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x41,0x08,
-	0xA2,0x10,0xC2,0x20,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0x81,0x28,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xE2,0x38,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x82,0xC9,0xA2,0x18,0x00,0x00,0x00,0x00,0x22,0x81,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x00,0x08,0x41,0x08,0xC3,0x18,
-	0x82,0xC1,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xE2,0x60,0xA2,0x10,0x41,0x08,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xA2,0xD9,0x81,0x10,0x00,0x00,0x00,0x00,0x41,0xA1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x61,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0x42,0x81,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xA1,0xC3,0x18,0x61,0x08,0x00,0x00,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x22,0x79,0x00,0x00,0x00,0x00,0xE2,0x60,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x28,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x00,0x08,0x20,0x00,0xA2,0x10,0xA2,0xD9,0xC1,0xF9,0xC1,0xF9,0xC0,0x60,0xA2,0x10,0xA2,0x10,
-	0xA1,0x40,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x22,0x81,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x42,0x81,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0x40,0xC3,0x18,0xC3,0x18,0xE1,0x68,0xC1,0xF9,0xC1,0xF9,0xA2,0xD9,0xC3,0x18,0x61,0x08,
-	0x00,0x08,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC2,0x30,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x82,0x10,0x61,0x08,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0x62,0xB9,0x61,0x10,0x00,0x00,0x40,0x28,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x20,0x08,0x00,0x00,0x41,0x08,0x82,0xC9,0xC1,0xF9,0xC1,0xF9,0x41,0xA9,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x00,0x00,0x61,0x08,0xC3,0x20,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0x81,0x30,0xC3,0x18,0xC3,0x18,0x61,0xB9,0xC1,0xF9,0xC1,0xF9,0x22,0x71,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x42,0x99,0xC1,0xF9,0xC1,0xF9,0xE1,0x78,0x82,0x10,0xA2,0x10,0x01,0x79,0xC1,0xF9,0xC1,0xF9,0x62,0xA9,0xA2,0x10,0x61,0x10,0x40,0x28,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC2,0x30,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x20,0x18,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0x38,0x00,0x00,0x00,0x00,0x62,0xA9,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x00,0x00,
-	0x61,0x08,0x42,0x89,0xC1,0xF9,0xC1,0xF9,0x01,0x91,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0xB9,0xC1,0xF9,0xC1,0xF9,0xA0,0x50,0x00,0x00,0x20,0x00,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0xC0,0x60,0x20,0x00,0xA2,0x10,0x42,0x89,0xC1,0xF9,0xC1,0xF9,0x21,0xA1,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x21,0xA1,0xC1,0xF9,0xC1,0xF9,0x42,0x89,0xC3,0x18,0x41,0x08,0xC0,0x60,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0x61,0x08,0x00,0x00,0x80,0x48,0xC1,0xF9,0xC1,0xF9,0x62,0xB9,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC2,0x38,0x61,0x10,0x00,0x00,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xE2,0x40,0x00,0x00,0x00,0x00,0x61,0xC1,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0x58,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0x02,0x61,0xC1,0xF9,0xC1,0xF9,0x41,0xB9,0x61,0x08,0xC3,0x18,0xE2,0x48,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0xC3,0x18,
-	0xC3,0x18,0x61,0x28,0xC1,0xF9,0xC1,0xF9,0xA2,0xD9,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x82,0x10,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0x20,0x10,0x82,0x10,0xA2,0x10,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xA2,0x20,0xA2,0x10,0x61,0x10,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,0xC2,0x30,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x40,0x20,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x00,0x00,0x00,0x00,0xA2,0x20,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x00,0x00,0x61,0x08,0xE3,0x28,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x20,0x08,0x00,0x00,0x20,0x00,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x00,0x00,0x20,0x00,0xA2,0x10,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x08,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC3,0x18,0x41,0x08,0x00,0x00,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0x08,
-	0x00,0x00,0x00,0x00,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x61,0x08,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA2,0x18,0x61,0x10,0x00,0x00,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA2,0x18,0x00,0x00,0x00,0x00,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x20,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0x08,0xC3,0x18,0xC3,0x18,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC3,0x18,0xC3,0x18,0x41,0x08,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0x20,0x10,0x82,0x10,0xA2,0x10,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xA2,0x20,0xA2,0x10,0x61,0x10,0xA1,0xE1,
-	0xC1,0xF9,0xC1,0xF9,0xC2,0x30,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x40,0x20,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x00,0x00,0x00,0x00,0xA2,0x20,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x00,0x00,
-	0x61,0x08,0xE3,0x28,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x60,0x28,0x00,0x00,0x20,0x00,0xA2,0xD1,0xC1,0xF9,0xC1,0xF9,0x60,0x30,0x00,0x00,0xA2,0x10,0x82,0xC1,0xC1,0xF9,0xC1,0xF9,0xA0,0x50,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0xC1,0x58,0xC1,0xF9,0xC1,0xF9,0x82,0xC1,0xC3,0x18,0x41,0x08,0x60,0x30,0xC1,0xF9,0xC1,0xF9,0xA2,0xD1,0x61,0x08,0x00,0x00,0x40,0x20,0xC1,0xF9,0xC1,0xF9,0xA1,0xD9,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0xB9,0xC1,0xF9,0xC1,0xF9,0x02,0x59,0x82,0x10,0x00,0x00,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0x22,0x71,0x00,0x00,0x00,0x00,0x01,0x81,
-	0xC1,0xF9,0xC1,0xF9,0x21,0xA1,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x62,0xA9,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x41,0x08,0xC3,0x18,0x22,0x71,0xC1,0xF9,0xC1,0xF9,0x41,0xA9,0xC3,0x18,
-	0xC3,0x18,0xC1,0x50,0xC1,0xF9,0xC1,0xF9,0x82,0xB9,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x82,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x42,0x99,0xC1,0xF9,0xC1,0xF9,0xE1,0x78,0x82,0x10,0xA2,0x10,0x01,0x79,0xC1,0xF9,0xC1,0xF9,0x62,0xA9,0xA2,0x10,0x61,0x10,0x40,0x28,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC2,0x30,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x20,0x18,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0x38,0x00,0x00,0x00,0x00,0x62,0xA9,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x00,0x00,0x61,0x08,0x42,0x81,0xC1,0xF9,0xC1,0xF9,0x01,0x91,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xC1,0x60,0xC1,0xF9,0xC1,0xF9,0x41,0xB9,0x00,0x00,0x20,0x00,0xC2,0x38,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x20,0x08,0xA2,0x10,0xA2,0x10,
-	0x81,0xC1,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0xC3,0x18,0xC3,0x18,0x61,0x10,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xE2,0x40,0x61,0x08,
-	0x00,0x00,0x41,0xB9,0xC1,0xF9,0xC1,0xF9,0x02,0x69,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x61,0x08,0x20,0x18,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x82,0x10,0x00,0x00,0x00,0x00,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC0,0x60,0x00,0x00,0x41,0x08,0xE2,0x48,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xE1,0x78,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x00,0x00,0x41,0x08,0x22,0x71,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0x20,0x00,0xC3,0x18,0xC3,0x20,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xE2,0x38,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xE2,0x60,0xA2,0x10,0x61,0x08,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xA2,0xD9,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0x42,0x81,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xA1,0xC3,0x18,0x82,0x10,0x00,0x00,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x22,0x79,0x00,0x00,0x00,0x00,
-	0xE2,0x60,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x22,0x81,0xC1,0xF9,0xC1,0xF9,0x41,0xB9,0x20,0x00,0xA2,0x10,0xC2,0x20,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0x22,0x81,0xA2,0x10,0x61,0x08,0x00,0x08,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xA9,0x40,0x20,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x60,0x20,0x41,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x00,0x08,0x20,0x00,0xC3,0x18,0x42,0x81,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0xC2,0x20,0xC3,0x18,0x61,0x08,0x41,0xB9,0xC1,0xF9,0xC1,0xF9,0x42,0x89,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x20,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x40,0x30,0x00,0x00,0x41,0x08,0x22,0x79,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x81,0x30,
-	0xA2,0x10,0xA2,0x10,0x40,0x18,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0xA1,0xA0,0x50,0xC2,0x30,0xC2,0x18,0x61,0x10,0x20,0x20,0xA0,0x50,0x42,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x82,0xC9,0xE3,0x28,0xA2,0x10,0x00,0x00,0x40,0x30,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xE1,0x70,0x00,0x00,0x20,0x00,0xE2,0x40,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x40,0x20,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0xA9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0x61,0x08,0x00,0x00,0x00,0x00,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x20,0x10,0x41,0x08,0xA2,0x10,0xA2,0x18,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0x99,0x00,0x08,0x00,0x00,0x82,0x10,0xE3,0x28,0xA1,0xD9,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0xA9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xC2,0x40,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xE2,0x50,0xA2,0x10,0x41,0x08,0x40,0x20,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,
-	0x81,0xD1,0x20,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0xC2,0x48,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0xA1,0x40,0xC3,0x18,0xC3,0x18,0x20,0x00,0x20,0x18,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x40,0x20,0x00,0x00,0xA2,0x10,0x02,0x59,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC2,0x40,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x62,0xA9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x61,0x18,0xA2,0x10,0xA2,0x10,0xA0,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA2,0xE1,0x81,0x30,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x81,0x30,0xC0,0x70,0x41,0xB9,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x41,0xB9,0x22,0x81,
-	0xE2,0x38,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xE2,0x40,0xA2,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x02,0x59,0xC3,0x18,0x20,0x00,0x00,0x08,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x41,0xA9,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x18,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x00,0x00,0x61,0x08,0xA2,0x10,0x02,0x69,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x22,0x81,0x00,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0xC0,0x70,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x00,0x00,0x61,0x10,0xC3,0x18,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,
-	0xA1,0xF1,0xE3,0x30,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xA0,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x00,0x00,0x00,0x00,0x82,0x10,0x02,0x59,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA2,0xD9,0x02,0x69,0x00,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,
-	0x20,0x00,0x00,0x08,0xE1,0x68,0xA2,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x02,0x61,0xC3,0x18,0x41,0x08,0x00,0x00,0xE0,0x78,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x50,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x22,0x79,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC2,0x38,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x41,0xA9,0xC0,0x60,0x60,0x30,0xA2,0x20,0xC2,0x18,0x81,0x10,0x20,0x10,0x60,0x30,0x02,0x69,0x62,0xA9,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0x40,0x28,0x00,0x00,0x41,0x08,0xC3,0x18,0x22,0x79,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xA1,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x18,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x42,0x89,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0x22,0x79,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0xC0,0x68,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0xE0,0x78,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB9,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x18,0x82,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0xC2,0x20,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x18,0x22,0x81,0xA2,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0x22,0x81,0xC2,0x20,0x41,0x08,0x00,0x00,0x20,0x00,0xC2,0x20,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x82,0xC9,0xC3,0x20,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x10,0x62,0xB9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xE2,0x50,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xC2,0x38,0x01,0x79,0x21,0xA9,0x81,0xD1,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x81,0xD1,0x62,0xB1,
-	0x22,0x79,0xC2,0x38,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x80,0x48,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xB9,0x00,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x41,0xB1,0xE2,0x40,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x40,0x30,0x62,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0x99,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0xA0,0x50,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xB9,0x02,0x61,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x02,0x61,0x82,0xB9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC2,0xF1,0xC1,0x58,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x20,0x10,0x21,0xA1,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x82,0xB9,0xE1,0x80,0xA0,0x50,0x40,0x28,0xA2,0x20,0xC2,0x18,0x82,0x10,0x20,0x10,0x40,0x28,0xE2,0x50,0x42,0x81,0x62,0xB9,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0xA1,0x61,0x18,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x40,0x30,0x41,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x62,0xB1,0xE2,0x40,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x61,0x08,0x00,0x00,0x20,0x18,0x22,0x81,0xA2,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xD9,0x42,0x89,0x61,0x28,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xC2,0x30,0x02,0x69,0x41,0x99,0x41,0xB9,0x81,0xD9,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x81,0xD9,0x62,0xB9,
-	0x42,0x99,0x02,0x69,0x40,0x18,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x40,0x18,0x81,0x28,0x61,0x28,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x40,0x28,
-	0x20,0x20,0x81,0x20,0xA2,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x20,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x81,0x28,0x41,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x18,0x61,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x28,0x20,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x40,0x20,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x28,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x10,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x61,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x28,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x28,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x28,0xA2,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x60,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0xA2,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x30,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x28,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x61,0x10,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x28,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x20,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x28,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x60,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x28,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x28,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA2,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x40,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA2,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x40,0x20,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x82,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x40,0x20,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x20,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x28,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x61,0x10,
-	0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x41,0x08,0x82,0x10,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x28,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x60,0x30,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x10,0x20,0x00,0x61,0x10,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x20,0x81,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x40,0x20,0x40,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x18,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x10,0x40,0x20,0x40,0x28,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x28,0x40,0x20,0x20,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_116_2_dial_img_0_384_data_0, "face_116_2_dial_img_0_384_data_0.bin");
         
 
 
@@ -1826,7 +21,7 @@ const lv_img_dsc_t face_116_2_dial_img_0_384_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 240,
-    .data_size = sizeof(face_116_2_dial_img_0_384_data_0),
+    .data_size = 115200,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_116_2_dial_img_0_384_data_0};
 
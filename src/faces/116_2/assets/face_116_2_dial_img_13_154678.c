@@ -5,6 +5,7 @@
 // Watchface: 116_2
 
 #include "../116_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,64 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_13_154678_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x18,0x60,0x30,0x80,0x40,0x80,0x50,0xA0,0x60,0xC0,0x68,0xC0,0x78,0xE0,0x78,0xE1,0x80,0xE0,0x78,0xE0,0x78,0xC0,0x70,0xC0,0x68,0xA0,0x58,0x80,0x50,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x80,0x40,0xC0,0x70,0x21,0xA1,0x61,0xC1,0x81,0xE1,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x81,0xE1,0x81,0xD1,0x41,0xA9,0x01,0x91,0xC0,0x68,0x80,0x48,0x40,0x20,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0xC0,0x68,0x41,0xB9,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x81,0xD1,0x21,0x99,0xA0,0x58,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0xE1,0x80,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xE1,0xE1,0x88,0x20,0x10,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0x61,0xD1,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x61,0xD1,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x01,0x99,0x61,0xC1,0xA1,0xE1,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x60,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x41,0xB9,0xE1,0x80,0xE0,0x78,0xE1,0x80,0x41,0xB9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xE1,0x41,0xB1,0x01,0x91,0xE0,0x78,0xE0,0x78,0x21,0x99,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0xE1,0x80,0x00,0x00,0x40,0x28,0x21,0xA9,0x41,0xB1,0xE0,0x78,0x21,0x99,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x41,0xB1,0x01,0x91,0x21,0x99,0xA1,0xE9,0xC1,0xF9,0x81,0xD9,0x01,0x91,0x60,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x41,0xB1,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,
-	0x81,0xD1,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0xA1,0xF1,0x61,0xC1,0xA0,0x60,0x40,0x28,0x60,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x21,0xA1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x01,0x89,0xE0,0x78,0xC0,0x70,0xE1,0x80,0xE1,0x80,0x01,0x89,0x21,0x99,0x21,0xA9,0x41,0xA9,0x41,0xB1,0x41,0xB1,0x41,0xB1,0x41,0xB1,0x41,0xB1,0x41,0xB1,0x21,0xA9,0x21,0xA9,0xE1,0x80,0xE1,0x88,0xE1,0x80,0xC0,0x78,0xE0,0x78,0xE1,0x80,0x01,0x91,0x41,0xB9,
-	0x81,0xD1,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x81,0xE1,0x81,0xD9,0x61,0xC9,0x41,0xB1,0x21,0xA9,0x21,0xA1,0x21,0xA1,0x21,0xA1,0x21,0xA1,0x21,0xA1,0x21,0xA1,0x21,0xA1,0x21,0xA9,0x41,0xB1,0x41,0xB1,
-	0x81,0xD1,0x81,0xD9,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x40,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0xA0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x70,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x41,0xB1,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xE1,0x88,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x20,0xA0,0x58,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x21,0xA1,0xA0,0x58,0x80,0x48,0xE1,0x88,0xE0,0x78,0x60,0x40,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x60,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0xE1,0x88,0x01,0x89,0x01,0x91,0x01,0x91,0x01,0x89,0x01,0x89,0xE1,0x88,0xE1,0x80,0xE0,0x78,0xE1,0x80,0xE1,0x80,0xE1,0x80,0xE0,0x78,0x20,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x81,0xD1,0x81,0xD9,
-	0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x50,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0x01,0x91,0xC0,0x70,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x48,0x21,0x99,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x81,0xD1,0x41,0xB9,0x01,0x91,0xE0,0x78,0x01,0x91,
-	0x61,0xC9,0xC1,0xF9,0x41,0xB1,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x48,0xC1,0xF9,0x01,0x91,0xC0,0x70,0xE0,0x78,0xC0,0x68,0xA0,0x60,0xC0,0x68,0xE0,0x78,
-	0xC0,0x78,0xE1,0x80,0x01,0x89,0x21,0x99,0x61,0xC1,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0xC1,0xF1,
-	0xC1,0xF9,0xC1,0xF1,0xA1,0xF1,0xA1,0xE1,0x81,0xD9,0xA1,0xE1,0xA1,0xF1,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x58,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x01,0x99,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x81,0xD9,0x21,0xA1,0x60,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,
-	0xE0,0x78,0xE0,0x78,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xB9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0xA1,0xE9,0x81,0xE1,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x30,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC0,0x68,0x41,0xB9,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x41,0xB1,0xC0,0x68,0x40,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_116_2_dial_img_13_154678_data_0, "face_116_2_dial_img_13_154678_data_0.bin");
         
 
 
@@ -77,7 +21,7 @@ const lv_img_dsc_t face_116_2_dial_img_13_154678_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 39,
     .header.h = 28,
-    .data_size = sizeof(face_116_2_dial_img_13_154678_data_0),
+    .data_size = 3276,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_13_154678_data_0};
 
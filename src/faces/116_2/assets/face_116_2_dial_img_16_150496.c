@@ -5,6 +5,7 @@
 // Watchface: 116_2
 
 #include "../116_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,56 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_16_150496_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xA0,0x58,0x01,0x89,0x21,0xA9,0x41,0xA9,0x21,0xA9,0xE1,0x88,0xA0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x48,0x41,0xB9,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x41,0xB9,
-	0x80,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0x80,0xF9,
-	0xC1,0xF9,0xC2,0xF9,0xC1,0xF9,0x80,0xF9,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x30,
-	0x81,0xE1,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0x03,0xFA,0xCB,0xFB,0xD0,0xFC,0x11,0xFD,0x12,0xFD,0x11,0xFD,0xD0,0xFC,0xCB,0xFB,0x03,0xFA,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xA1,0xE1,0xC1,0xF9,0xA1,0xF9,0x80,0xF9,0xEC,0xFB,0x73,0xFD,0x0C,0xFC,0xE7,0xFA,0xE7,0xFA,0xC6,0xFA,0xC6,0xFA,0xC6,0xFA,0x0C,0xFC,0x93,0xFD,0xEC,0xFB,0x80,0xF9,0xA1,0xF9,0xC1,0xF9,0xA1,0xE9,0x40,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x11,0xFD,0x8F,0xFC,0x85,0xFA,0x2D,0xFC,0x11,0xFD,0xAF,0xFC,0xAF,0xFC,0xD0,0xFC,0x11,0xFD,0x8A,0xFB,0x02,0xFA,0xAF,0xFC,0x11,0xFD,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0x81,0xD1,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x58,0x21,0x99,0x61,0xD1,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0xF1,0xFC,0xEB,0xFB,0x07,0xFB,0x93,0xFD,0x69,0xFB,0xA5,0xFA,0x49,0xFB,0x8A,0xFB,0x08,0xFB,0x85,0xFA,
-	0x2D,0xFC,0x73,0xFD,0x03,0xFA,0xEC,0xFB,0xF1,0xFC,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x68,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0xCB,0xFB,0x8F,0xFC,0x07,0xFB,0x73,0xFD,
-	0x23,0xFA,0x4E,0xFC,0x52,0xFD,0x2D,0xFC,0xAB,0xFB,0x8E,0xFC,0x73,0xFD,0x69,0xFB,0xC6,0xFA,0xB4,0xFD,0xE2,0xF9,0xB0,0xFC,0xCB,0xFB,0x80,0xF9,0xC1,0xF9,0xA1,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0x02,0xFA,0x73,0xFD,0x85,0xFA,0x93,0xFD,0x23,0xFA,0x32,0xFD,0x0C,0xFC,0x80,0xF9,0x03,0xFA,0x6E,0xFC,0xE2,0xF9,0xE2,0xF9,0x11,0xFD,0x0C,0xFC,0x07,0xFB,0x11,0xFD,0xE2,0xF9,0x94,0xFD,0x02,0xFA,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0xAA,0xFB,0x2D,0xFC,0x0C,0xFC,0x8A,0xFB,0x2D,0xFC,0x0D,0xFC,0x60,0xF9,0x80,0xF9,0x28,0xFB,0xFF,0xFF,0xC6,0xFA,0x80,0xF9,0x80,0xF9,0x52,0xFD,0xE7,0xFA,0xD0,0xFC,0xA6,0xFA,0x4D,0xFC,0xAA,0xFB,0x80,0xF9,0xC1,0xF9,0xA1,0xF1,0x61,0xC1,
-	0xE1,0x80,0x40,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0xAF,0xFC,0x07,0xFB,0xF1,0xFC,0xA5,0xFA,0x52,0xFD,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0x07,0xFB,0xBE,0xFF,0xA6,0xFA,0xA1,0xF9,0xA0,0xF9,0xC6,0xFA,0xD0,0xFC,0x28,0xFB,
-	0x4E,0xFC,0xC6,0xFA,0xB0,0xFC,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x01,0x89,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x30,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF9,0x11,0xFD,0xE7,0xFA,0xD0,0xFC,0x28,0xFB,0x8F,0xFC,0x60,0xF9,0xC1,0xF9,0xA1,0xF9,0xC6,0xFA,
-	0x7D,0xFF,0xA6,0xFA,0xA1,0xF9,0xC1,0xF9,0xC1,0xF9,0x12,0xFD,0xC6,0xFA,0xF0,0xFC,0x23,0xFA,0x11,0xFD,0xA1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB9,0x00,0x08,0x00,0x00,0x01,0x91,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF9,0x32,0xFD,0xC6,0xFA,
-	0xD0,0xFC,0x49,0xFB,0x4E,0xFC,0x60,0xF9,0xC1,0xF9,0xA1,0xF9,0x85,0xFA,0x3B,0xFF,0x65,0xFA,0xA1,0xF9,0xC1,0xF9,0xA1,0xF9,0x11,0xFD,0xC6,0xFA,0x11,0xFD,0x02,0xFA,0x32,0xFD,0xA1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0xA1,0x00,0x00,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF9,0x11,0xFD,0xC6,0xFA,0xF1,0xFC,0xE7,0xFA,0xD0,0xFC,0x80,0xF9,0xC1,0xF9,0xA1,0xF9,0x44,0xFA,0xFA,0xFE,0x23,0xFA,0xA1,0xF9,0xC1,0xF9,0x03,0xFA,0x32,0xFD,0xE7,0xFA,0xD0,0xFC,0x23,0xFA,0x11,0xFD,0xA1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x60,0x40,0x81,0xE1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0xAF,0xFC,0x07,0xFB,0xD0,0xFC,0xA6,0xFA,0x52,0xFD,0x44,0xFA,0xA1,0xF9,0xC1,0xF9,0xE2,0xF9,0x2D,0xFC,0xE2,0xF9,0xC1,0xF9,0x60,0xF9,0xAB,0xFB,0x2D,0xFC,0xCB,0xFB,0xCB,0xFB,0xE7,0xFA,0xAF,0xFC,0x80,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0xA1,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0x69,0xFB,0x6E,0xFC,0x28,0xFB,0x8F,0xFC,0xE7,0xFA,0x73,0xFD,0xA1,0xF9,0x60,0xF9,0xA6,0xFA,0xF6,0xFD,0x64,0xFA,0x40,0xF9,0x85,0xFA,
-	0xB4,0xFD,0x44,0xFA,0x73,0xFD,0xE2,0xF9,0x8F,0xFC,0x69,0xFB,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC2,0xF9,0x93,0xFD,0x23,0xFA,0x32,0xFD,0x28,0xFB,0x8A,0xFB,
-	0x93,0xFD,0x08,0xFB,0xA6,0xFA,0x32,0xFD,0xA6,0xFA,0xAB,0xFB,0xB4,0xFD,0x65,0xFA,0x8F,0xFC,0xEC,0xFB,0x02,0xFA,0x94,0xFD,0xC2,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x80,0xF9,0x69,0xFB,0x11,0xFD,0xC1,0xF9,0x93,0xFD,0x8A,0xFB,0x85,0xFA,0x8F,0xFC,0xF1,0xFC,0xD0,0xFC,0xF1,0xFC,0x0D,0xFC,0x44,0xFA,0xAF,0xFC,0xAF,0xFC,0x40,0xF9,0x32,0xFD,0x69,0xFB,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD1,0x40,0x20,0xC1,0xF1,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0x8F,0xFC,0x8F,0xFC,0xA1,0xF9,0xAF,0xFC,0x32,0xFD,0x8A,0xFB,0xE7,0xFA,0xC6,0xFA,0xE7,0xFA,0xEC,0xFB,0x73,0xFD,0xCB,0xFB,0x40,0xF9,0xAF,0xFC,0x8F,0xFC,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x01,0x99,0x00,0x00,0xE0,0x78,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0x8F,0xFC,0x32,0xFD,0x23,0xFA,0x44,0xFA,0xEC,0xFB,0xAF,0xFC,0xF0,0xFC,0x8F,0xFC,0x8A,0xFB,0xC2,0xF9,0x23,0xFA,0x32,0xFD,0x8F,0xFC,0x80,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x60,0x30,0x00,0x00,0x00,0x00,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0x49,0xFB,0x73,0xFD,0xAF,0xFC,0x28,0xFB,0x64,0xFA,0x23,0xFA,
-	0x64,0xFA,0x28,0xFB,0xB0,0xFC,0x73,0xFD,0x49,0xFB,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x91,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x80,0xF9,0xC1,0xF9,0x48,0xFB,0x6E,0xFC,0xF1,0xFC,0x32,0xFD,0xF1,0xFC,0x6E,0xFC,0x48,0xFB,0xC1,0xF9,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x48,0x61,0xC1,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0xF9,0x80,0xF9,0x80,0xF9,0xA0,0xF9,0x80,0xF9,0x80,0xF9,0x80,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xA0,0x60,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x30,0xC0,0x70,0x21,0x99,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,0x41,0xA9,
-	0x21,0xA9,0xE1,0x88,0x80,0x48,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_116_2_dial_img_16_150496_data_0, "face_116_2_dial_img_16_150496_data_0.bin");
         
 
 
@@ -69,7 +21,7 @@ const lv_img_dsc_t face_116_2_dial_img_16_150496_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 39,
     .header.h = 24,
-    .data_size = sizeof(face_116_2_dial_img_16_150496_data_0),
+    .data_size = 2808,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_16_150496_data_0};
 
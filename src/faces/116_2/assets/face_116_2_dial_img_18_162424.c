@@ -5,6 +5,7 @@
 // Watchface: 116_2
 
 #include "../116_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,31 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_18_162424_data_0[] = {
-	//RGB565 data 
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x21,0x99,0x60,0x38,0x60,0x38,0xC0,0x68,0x61,0xC9,0x61,0xC9,0x61,0xC9,0xC0,0x70,0x60,0x38,0x60,0x38,0x80,0x40,0x21,0x99,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x21,0xA9,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x21,0xA9,0x61,0xC9,0x21,0xA9,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0xC0,0x68,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0xA0,0x58,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC0,0x68,0x60,0x38,0x60,0x38,0xA1,0xF1,0xC1,0xF9,0x41,0xB1,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0xA0,0x58,0xA1,0xF1,0xC1,0xF9,0xA1,0xF1,0x21,0x99,0x21,0x99,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0xC0,0x68,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xA1,0xF1,0xC1,0xF9,0xA1,0xF1,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x80,0x40,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,
-	0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x61,0xC9,0xC1,0xF9,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xC1,0xF9,0x61,0xC9,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,
-	0xA1,0xE1,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0xA1,0xF1,0xC1,0xF9,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0xC1,0xF9,0x41,0xB1,0xA1,0xE1,0xC1,0xF9,0x21,0x99,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x40,
-	0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x81,0xD9,0xC1,0xF9,0x61,0xC9,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0xC1,0xF9,0xA1,0xF1,0x60,0x38,0x80,0x40,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,
-	0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,
-	0x80,0x40,0x60,0x38,0xA0,0x58,0xA1,0xE1,0xC1,0xF9,0xA1,0xF1,0x80,0x40,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x60,0x38,0x01,0x89,0xC1,0xF9,0xA1,0xF1,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0xA1,0xF1,
-	0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x60,0x38,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x41,0xB1,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xA1,0xF1,0x60,0x38,0x21,0xA9,0xC1,0xF9,0x81,0xD9,0x60,0x38,
-	0x60,0x38,0xC0,0x70,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0xC0,0x70,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x60,0x38,0x60,0x38,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0xA0,0x58,0xC0,0x68,0xA0,0x58,0x60,0x38,0xA0,0x58,0xC0,0x68,0xA0,0x58,0x60,0x38,0xA0,0x58,0xC0,0x68,
-	0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x40,0xE1,0x80,0x21,0x99,0x21,0x99,0xC0,0x70,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0x60,0x38,0x60,0x38,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_116_2_dial_img_18_162424_data_0, "face_116_2_dial_img_18_162424_data_0.bin");
         
 
 
@@ -44,37 +21,13 @@ const lv_img_dsc_t face_116_2_dial_img_18_162424_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 12,
-    .data_size = sizeof(face_116_2_dial_img_18_162424_data_0),
+    .data_size = 1224,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_18_162424_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_18_162424_data_1[] = {
-	//RGB565 data 
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,
-	0x61,0xC9,0x41,0xB1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x60,0x38,0x60,0x38,0x80,0x40,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0x21,0x99,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x21,0x99,0x21,0x99,0xE1,0x80,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,
-	0x61,0xC1,0x21,0x99,0x21,0x99,0x21,0x99,0x21,0x99,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x21,0x99,
-	0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x80,0x50,
-	0x60,0x38,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,
-	0xC1,0xF9,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,
-	0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x60,0x38,
-	0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA1,0xF1,0xC1,0xF9,
-	0xC1,0xF9,0xA1,0xE1,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x80,0x40,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0xA0,0x58,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0x01,0x89,0x21,0x99,0x21,0x99,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_116_2_dial_img_18_162424_data_1, "face_116_2_dial_img_18_162424_data_1.bin");
         
 
 
@@ -82,37 +35,13 @@ const lv_img_dsc_t face_116_2_dial_img_18_162424_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 12,
-    .data_size = sizeof(face_116_2_dial_img_18_162424_data_1),
+    .data_size = 1224,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_18_162424_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_18_162424_data_2[] = {
-	//RGB565 data 
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x21,0x99,0x61,0xC9,0x61,0xC9,0xA0,0x58,0x60,0x38,0x80,0x50,0x61,0xC9,0x61,0xC9,0xE1,0x80,0x61,0xC1,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x41,0xB1,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,
-	0x21,0xA9,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x80,0x40,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0xA1,0xE1,0xC1,0xF9,0x61,0xC9,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x21,0x99,0x21,0x99,0x21,0x99,0x21,0x99,0xC0,0x68,0x60,0x38,0xC0,0x68,0xC1,0xF9,
-	0xC1,0xF9,0x61,0xC1,0x21,0x99,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0x61,0xC9,0x80,0x40,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x60,0x38,0x61,0xC9,0xC1,0xF9,0x61,0xC9,0xE1,0x80,0xC1,0xF9,0xA1,0xF1,0x81,0xD9,0xC1,0xF9,0x41,0xB1,0x41,0xB1,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,
-	0x60,0x38,0x60,0x38,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0x61,0xC9,0xC1,0xF9,0x61,0xC9,0xA1,0xE1,0xC1,0xF9,0x21,0x99,0x61,0xC1,0xC1,0xF9,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x61,0xC1,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xC0,0x68,
-	0xC0,0x68,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,
-	0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0xE1,0x80,
-	0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x21,0x99,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,
-	0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0x80,0x50,0x60,0x38,0x60,0x38,0x80,0x40,0xC0,0x68,0xC0,0x68,
-	0x80,0x50,0x60,0x38,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_116_2_dial_img_18_162424_data_2, "face_116_2_dial_img_18_162424_data_2.bin");
         
 
 
@@ -120,37 +49,13 @@ const lv_img_dsc_t face_116_2_dial_img_18_162424_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 12,
-    .data_size = sizeof(face_116_2_dial_img_18_162424_data_2),
+    .data_size = 1224,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_18_162424_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_18_162424_data_3[] = {
-	//RGB565 data 
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,
-	0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x60,0x38,0x60,0x38,0x80,0x40,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x60,0x38,0x60,0x38,
-	0x80,0x40,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0x21,0x99,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x21,0x99,0x21,0x99,0xE1,0x80,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x01,0x89,
-	0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x21,0x99,0xC1,0xF9,
-	0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,
-	0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xC0,0x68,0xC0,0x68,0xC0,0x68,0xC1,0xF9,
-	0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,
-	0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x60,0x38,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,
-	0x60,0x38,0x60,0x38,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,
-	0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,
-	0xA0,0x58,0xC0,0x68,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0x01,0x89,0x21,0x99,0x21,0x99,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_116_2_dial_img_18_162424_data_3, "face_116_2_dial_img_18_162424_data_3.bin");
         
 
 
@@ -158,37 +63,13 @@ const lv_img_dsc_t face_116_2_dial_img_18_162424_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 12,
-    .data_size = sizeof(face_116_2_dial_img_18_162424_data_3),
+    .data_size = 1224,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_18_162424_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_18_162424_data_4[] = {
-	//RGB565 data 
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0xA0,0x58,0x60,0x38,0x61,0xC1,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x21,0x99,0x80,0x50,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0xE1,0x80,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x80,0x40,0x80,0x50,0xC1,0xF9,0xC1,0xF9,
-	0x01,0x89,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x21,0x99,0x21,0x99,0x21,0x99,0x01,0x89,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0xC0,0x68,0xC0,0x70,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0xC0,0x68,
-	0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,
-	0x80,0x40,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC1,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x61,0xC9,0x81,0xD9,0xC1,0xF9,
-	0xC1,0xF9,0x21,0xA9,0x60,0x38,0x61,0xC1,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xA1,0xF1,0x21,0x99,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x40,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0xC0,0x68,0xC0,0x68,0xC0,0x68,0x80,0x50,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,
-	0xE1,0x80,0xA1,0xF1,0xC1,0xF9,0xA1,0xF1,0x80,0x50,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC1,0xF9,
-	0xC1,0xF9,0x21,0x99,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0xA0,0x58,0xA0,0x58,0xC0,0x68,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_116_2_dial_img_18_162424_data_4, "face_116_2_dial_img_18_162424_data_4.bin");
         
 
 
@@ -196,37 +77,13 @@ const lv_img_dsc_t face_116_2_dial_img_18_162424_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 12,
-    .data_size = sizeof(face_116_2_dial_img_18_162424_data_4),
+    .data_size = 1224,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_18_162424_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_18_162424_data_5[] = {
-	//RGB565 data 
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xE1,0x80,0x61,0xC1,0x61,0xC9,0x61,0xC9,0x61,0xC1,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0x61,0xC9,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,0x61,0xC9,
-	0x61,0xC9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0xC0,0x68,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x21,0x99,0x21,0x99,0x41,0xB1,
-	0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x21,0x99,0x21,0x99,0xE1,0x80,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0xC0,0x68,0x80,0x50,0x21,0x99,0xC0,0x70,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0xA1,0xE1,0xC1,0xF9,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x41,0xB1,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x80,0x40,0xA1,0xF1,0xC1,0xF9,0x41,0xB1,0x60,0x38,0xA1,0xE1,0xC1,0xF9,
-	0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0x60,0x38,0xC0,0x68,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x61,0xC9,
-	0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x21,0x99,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x41,0xB1,0xC1,0xF9,
-	0xC1,0xF9,0x21,0x99,0x21,0x99,0x21,0x99,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xE1,0x80,0x60,0x38,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x40,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0xA0,0x58,
-	0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x40,0xE1,0x80,0x21,0x99,0x21,0x99,0xE1,0x80,0x80,0x50,0x60,0x38,
-	0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x40,0xC0,0x68,0xC0,0x68,0xA0,0x58,0x60,0x38,0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_116_2_dial_img_18_162424_data_5, "face_116_2_dial_img_18_162424_data_5.bin");
         
 
 
@@ -234,37 +91,13 @@ const lv_img_dsc_t face_116_2_dial_img_18_162424_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 12,
-    .data_size = sizeof(face_116_2_dial_img_18_162424_data_5),
+    .data_size = 1224,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_18_162424_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_18_162424_data_6[] = {
-	//RGB565 data 
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xE1,0x80,0x61,0xC1,0x61,0xC9,0x61,0xC9,0x61,0xC1,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x61,0xC1,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x21,0xA9,0x61,0xC9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x80,0x50,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x60,0x38,0x60,0x38,0x80,0x40,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,
-	0x60,0x38,0x60,0x38,0xA1,0xF1,0xC1,0xF9,0x41,0xB1,0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0xC0,0x68,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0x41,0xB1,0x60,0x38,0x80,0x50,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0xC0,0x68,0x80,0x50,0x21,0x99,0xC0,0x70,0x80,0x40,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x21,0x99,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0xC0,0x68,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x41,0xB1,0x80,0x40,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x60,0x38,0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x80,0x50,
-	0x60,0x38,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x21,0x99,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC9,0xC1,0xF9,
-	0xC1,0xF9,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0x61,0xC9,0x61,0xC9,0xC1,0xF9,0xC1,0xF9,0x61,0xC1,0xC1,0xF9,0xA1,0xF1,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xC0,0x68,0xC0,0x68,0x60,0x38,0xC0,0x68,0x21,0xA9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,
-	0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0xC1,0xC1,0xF9,0xC1,0xF9,0xA0,0x58,0x60,0x38,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xA1,0xE1,0x60,0x38,0x60,0x38,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0x60,0x38,
-	0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x01,0x89,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x21,0x99,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0xA1,0xF1,0xC1,0xF9,
-	0xC1,0xF9,0xA1,0xE1,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x80,0x40,0x60,0x38,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x01,0x89,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x40,0x81,0xD9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0x60,0x38,0x60,0x38,0x60,0x38,
-	0xE1,0x80,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0xA0,0x58,0x60,0x38,0x60,0x38,0x21,0x99,0xC1,0xF9,0xC1,0xF9,0x80,0x40,0x60,0x38,0x60,0x38,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x40,0xE1,0x80,0x21,0x99,0x21,0x99,0xE1,0x80,0x80,0x50,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0x01,0x89,0x21,0x99,0x21,0x99,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC0,0x68,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_116_2_dial_img_18_162424_data_6, "face_116_2_dial_img_18_162424_data_6.bin");
         
 
 
@@ -272,7 +105,7 @@ const lv_img_dsc_t face_116_2_dial_img_18_162424_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 12,
-    .data_size = sizeof(face_116_2_dial_img_18_162424_data_6),
+    .data_size = 1224,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_116_2_dial_img_18_162424_data_6};
 
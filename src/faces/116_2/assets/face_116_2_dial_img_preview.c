@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 116_2
-
-#include "../116_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_116_2_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,
-	0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x20,0x08,0x00,0x08,0x40,0x20,0x40,0x28,0x40,0x30,0x60,0x30,0x60,0x30,0x40,0x30,0x40,0x28,0x40,0x20,0x40,0x10,0x00,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,
-	0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x10,0x40,0x28,0x40,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x40,0x20,0x00,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x40,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x40,0x20,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x08,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,
-	0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x10,0x40,0x30,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x20,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,
-	0x20,0x00,0x40,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x10,0x40,0x30,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x40,0x10,0x00,0x00,0x20,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x08,
-	0x41,0x08,0x00,0x00,0x20,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x18,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x60,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x20,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,
-	0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x20,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,
-	0x61,0x08,0x40,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0x24,0x21,0xC3,0x18,0xC3,0x18,0x24,0x21,0xE3,0x18,0xC3,0x18,0x04,0x21,0x24,0x21,0x82,0x10,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,
-	0x24,0x21,0xE3,0x18,0xE3,0x18,0xC3,0x18,0xC3,0x18,0xE3,0x18,0xC3,0x18,0xC3,0x18,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0xE0,0x88,0x20,0xA1,0x20,0xA1,0x20,0xA1,0x20,0xA1,0x80,0x48,0xE0,0x80,0x20,0xA1,0x20,0xA1,0x20,0xA1,0x00,0x89,0x60,0x40,0x60,0x38,0x20,0xA1,0xC0,0x78,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x2C,0x63,0x79,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x58,0xC6,0x61,0x08,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0xE3,0x18,0x95,0xAD,
-	0x1B,0xDF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x69,0x4A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x40,0x80,0xD1,0xA1,0xF1,0x81,0xE1,0x81,0xE1,0x81,0xD9,0x80,0x40,0x60,0xD1,0xA1,0xF1,0x80,0xD9,0x80,0xD9,0xC1,0xF1,0x60,0xC9,0x80,0x50,0xC1,0xF9,0x20,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x10,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,
-	0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x28,0x42,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x00,0x00,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0xE3,0x18,0xD6,0xB5,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x80,0x48,0x81,0xD9,0x80,0xD1,0xA0,0x58,0x80,0x50,0x80,0x48,0x80,0x48,0x81,0xD9,0x80,0xD9,0x80,0x50,0xC0,0x68,0xA1,0xF1,0x60,0xC9,0xE0,0x78,0xC1,0xF9,0xC0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0xC2,0x10,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0xE3,0x18,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0xA0,0x58,0xA1,0xE9,0xA1,0xE9,0x61,0xD1,0x61,0xD1,0xA0,0x58,0xA0,0x58,0xA1,0xE9,0xA1,0xE9,0x61,0xD1,0x81,0xE1,0xA1,0xE1,0xC0,0x70,0x20,0xA1,0xA1,0xF1,0xA0,0x60,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,
-	0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0xC3,0x18,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0xC0,0x68,0xC1,0xF1,0x40,0xB9,0x00,0x89,0xE0,0x80,0x60,0x40,0xA0,0x60,0xC1,0xF1,0x61,0xD1,0x81,0xD9,0xA1,0xF1,0xE0,0x80,0x60,0x38,0x60,0xC1,0xA1,0xE1,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x18,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0xC2,0x10,0x17,0xBE,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0x54,0xA5,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x00,0x91,0xC1,0xF9,0xE0,0x70,0x60,0x38,0x60,0x38,0x60,0x38,0xE0,0x80,0xC1,0xF9,0xE0,0x78,0xE0,0x80,0xC1,0xF9,0x81,0xD9,0x60,0x40,0x80,0xD1,0x80,0xD1,0x60,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x18,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,
-	0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x24,0x21,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xE7,0x39,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0xD2,0x94,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x7C,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x41,0xB1,0xC1,0xF9,0x80,0x48,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0xA9,0xC1,0xF9,0x80,0x50,0x60,0x38,0x81,0xD9,0xC1,0xF9,0xC0,0x78,0x81,0xD9,0x60,0xC9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x20,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0xA6,0x31,0x79,0xCE,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xA6,0x31,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x82,0x10,0x54,0xA5,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x48,0x42,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x80,0x50,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xA0,0x58,0x60,0x38,0x60,0x38,0x80,0x48,0xA0,0x58,0x80,0x50,0xA0,0x58,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,
-	0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x81,0x08,0x8A,0x52,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x04,0x21,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0xE3,0x18,0xD2,0x94,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xC6,0x31,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x04,0x21,0x34,0xA5,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x61,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0x54,0xA5,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x24,0x21,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x08,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0x80,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x48,0xA0,0x58,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,
-	0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0xE3,0x18,0x4C,0x63,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0x9D,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0xD2,0x94,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xC2,0x10,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x40,0x08,0x20,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x00,0x91,0xA1,0xE9,0xC0,0x68,0x60,0x38,0x60,0x38,0xA0,0x58,0x81,0xD1,0xA1,0xE9,0xA1,0xE9,0x20,0xA1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x20,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0xEF,0x7B,0xBA,0xD6,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7B,0x41,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x82,0x10,0x54,0xA5,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x80,0x48,0x41,0xB9,0xA1,0xF1,0xA1,0xF1,0xA0,0x60,0x60,0x38,0x60,0x38,0x00,0x89,0x60,0xC9,0xC0,0x68,0xA1,0xE1,0x60,0xD1,0x60,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,
-	0x81,0x08,0x40,0x00,0x40,0x00,0x85,0x29,0x89,0x4A,0xF3,0x9C,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x3A,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0xD2,0x94,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x84,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0xC0,0x70,0x40,0xB1,0x80,0xD9,0xA1,0xE1,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0x60,0xD1,0xA1,0xF1,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x81,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,
-	0x40,0x00,0x20,0x00,0xCF,0x7B,0x1B,0xDF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x40,0x00,0x41,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0xC2,0x10,0x54,0xA5,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x40,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x40,0x60,0xD1,0x80,0xD1,0x60,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x68,0x60,0xC1,0xC1,0xF1,0x00,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,
-	0x82,0x10,0x41,0x08,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x81,0x10,0x50,0x84,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x08,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x80,0x48,0x81,0xD9,0x60,0xC9,0x60,0x38,0x60,0x38,0x80,0x58,0x00,0x91,0x80,0x50,0xA0,0x60,0xA1,0xF1,0x40,0xB1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x41,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x40,0x00,0x82,0x10,
-	0x40,0x00,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x81,0x08,0x50,0x84,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0xA0,0x58,0xA1,0xE9,0x00,0xA1,0x60,0x38,0x60,0x38,0xC0,0x60,0xA1,0xF1,0x61,0xC1,0x61,0xC9,0xA1,0xE9,0x80,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x41,0x08,0x20,0x00,0x81,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,
-	0x82,0x10,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x6B,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x40,0x00,0xAE,0x73,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xAD,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x81,0x10,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x80,0x48,0x00,0x89,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0xE0,0x78,0x41,0xA9,0x00,0x99,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x00,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x40,0x00,0x71,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x08,0x42,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0x50,0x84,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x84,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x60,0x18,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x60,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x58,0xC6,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xC6,0x31,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,
-	0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0xC2,0x10,0xAE,0x73,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xC6,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xE7,0x39,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x81,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0xC2,0x10,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x6D,0x6B,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x24,0x21,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x50,0x84,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xB5,0xC6,0x31,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xE7,0x39,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x40,0x08,0x40,0x20,0x60,0x30,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x60,0x28,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,
-	0xA6,0x31,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xFB,0xDE,0x50,0x84,0x03,0x19,0x20,0x00,0xC6,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xBE,0x81,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,
-	0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0xAE,0x73,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xBE,0xE3,0x18,0x65,0x29,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x24,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x10,0x61,0x20,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0xC6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xBA,0xD6,0x0B,0x5B,0x65,0x29,0x61,0x08,0x20,0x00,0x61,0x08,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0x50,0x84,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xB5,0xC3,0x18,0x81,0x08,0x07,0x3A,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0xA2,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x61,0x18,0x60,0x30,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x10,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0xEB,0x5A,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x1B,0xDF,0x96,0xB5,0x89,0x4A,0xA2,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8E,0x73,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,
-	0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0xAE,0x73,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x65,0x29,0x81,0x08,0x20,0x00,0x89,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x40,0x08,
-	0x81,0x20,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x18,0x20,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x6D,0x6B,0x5C,0xE7,0x96,0xB5,0xAA,0x52,0x24,0x21,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x82,0x10,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x50,0x84,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x85,0x29,0x41,0x08,0x20,0x00,0x81,0x08,0xD2,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x10,0x61,0x18,0x40,0x28,0x40,0x28,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x40,0x28,0x60,0x28,0x40,0x18,0x20,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0xCB,0x5A,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x45,0x29,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x89,0x4A,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x00,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x08,0x40,0x10,0xA2,0x18,0x40,0x10,0x20,0x08,0x81,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x86,0x31,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x6D,0x6B,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x45,0x29,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x61,0x08,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0xE7,0x39,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x2C,0x63,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x07,0x3A,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0xA6,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x8E,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8A,0x52,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x6D,0x6B,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x28,0x42,0xA2,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x6D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xA5,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x40,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x14,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x07,0x3A,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0xCA,0x52,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x48,0x42,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x65,0x29,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x82,0x10,0x61,0x08,0xEB,0x5A,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7B,0x41,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0xA2,0x10,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x07,0x3A,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x03,0x19,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0x20,0x00,0xE3,0x18,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xF7,0xBD,0xC2,0x10,0x81,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x40,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x07,0x3A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x41,0x08,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x82,0x10,0x08,0x42,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x65,0x29,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0x20,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xC6,0x61,0x08,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x40,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x13,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x6B,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x82,0x10,0xD2,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x10,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0x31,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0x20,0x00,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x20,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x65,0x29,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x61,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x82,0x10,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xA6,0x31,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0x44,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x20,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x49,0x4A,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0x94,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x6D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x08,0x81,0x20,0xC2,0x38,0x60,0x30,0x80,0x40,0x02,0x49,0xA0,0x38,0x40,0x28,0xA1,0x20,0xA2,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x52,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0xD3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,
-	0x81,0x08,0x40,0x10,0xE0,0x68,0x61,0xB9,0x80,0xD1,0xA1,0xE1,0xA1,0xF1,0xC1,0xF1,0xC1,0xF1,0xA1,0xF1,0xA1,0xE1,0x80,0xD1,0x61,0xB9,0x02,0x71,0x81,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x40,0x00,0x41,0x08,0x82,0x10,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x28,0x42,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0xD6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x60,0x20,
-	0xC0,0x70,0xA1,0xE9,0xC1,0xF9,0xC1,0xF1,0x81,0xE1,0x81,0xD1,0x81,0xC1,0x40,0xB9,0x40,0xB9,0x81,0xC1,0x81,0xD1,0x81,0xE1,0xC1,0xF1,0xC1,0xF9,0xA1,0xE9,0x21,0x81,0x81,0x20,0x00,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x20,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x24,0x21,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x81,0x08,0xEF,0x7B,0xF7,0xBD,0xF7,0xBD,0x18,0xC6,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0x18,0xC6,0xF7,0xBD,0xF7,0xBD,0x18,0xC6,0x17,0xBE,0xF7,0xBD,0x17,0xBE,0x17,0xC6,0xF7,0xBD,0xF7,0xBD,0x18,0xC6,0x58,0xC6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xBA,0xD6,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x75,0xAD,0x65,0x29,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0xA0,0x58,0x81,0xD9,
-	0xC1,0xF9,0xC1,0xF9,0x41,0xB1,0x01,0x59,0xA1,0x30,0x40,0x18,0x61,0x10,0x82,0x10,0x20,0x00,0x20,0x08,0xC2,0x20,0xA1,0x30,0x80,0x50,0x41,0xB1,0xC1,0xF9,0xC1,0xF9,0x81,0xD9,0xE1,0x60,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x24,0x21,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x65,0x29,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xC6,0x31,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x10,0x21,0x91,0xC1,0xF9,0xA1,0xF1,
-	0x61,0xB9,0xC1,0x40,0x61,0x08,0x20,0x00,0x61,0x18,0xC2,0x30,0x60,0x30,0x80,0x40,0x02,0x49,0xA1,0x38,0x40,0x28,0x81,0x18,0x82,0x10,0x41,0x08,0x80,0x38,0x61,0xB9,0xA1,0xF1,0xC1,0xF9,0x42,0x91,0xA2,0x18,0x20,0x00,0x40,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,
-	0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0xAA,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x20,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x65,0x29,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x04,0x21,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x08,0x61,0xA9,0xA1,0xF1,0xA1,0xE9,0xC1,0x60,
-	0x81,0x18,0x20,0x00,0x40,0x18,0x21,0x91,0x60,0xC9,0xA1,0xE1,0xA1,0xF1,0xC1,0xF1,0xC1,0xF1,0xA1,0xF1,0xA1,0xE1,0x60,0xC9,0x01,0x89,0xA1,0x28,0x82,0x10,0x20,0x10,0xA0,0x58,0xA1,0xE9,0xA1,0xF1,0x41,0xA9,0x81,0x10,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0x94,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x48,0x42,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x17,0xBE,0x61,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x10,0x41,0xA9,0xC1,0xF9,0x80,0xD9,0xC1,0x48,0x20,0x00,
-	0x40,0x10,0x21,0x81,0xA1,0xE9,0xC1,0xF9,0xA1,0xF1,0x81,0xD9,0x81,0xC9,0x40,0xB9,0x40,0xB9,0x81,0xC9,0x81,0xD9,0xA1,0xF1,0xC1,0xF9,0xA1,0xE9,0xE0,0x78,0xA2,0x20,0x61,0x08,0x80,0x40,0x80,0xD9,0xC1,0xF9,0x20,0xA1,0x40,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,
-	0x82,0x10,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x54,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4C,0x63,0x00,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x40,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0xE1,0x68,0xA1,0xF1,0xA1,0xE1,0xC1,0x40,0x00,0x00,0x81,0x30,
-	0x81,0xC9,0xA1,0xF1,0xA1,0xF1,0x41,0xA1,0xC2,0x48,0x40,0x20,0x60,0x10,0x82,0x10,0x40,0x00,0x20,0x10,0xC2,0x28,0xC2,0x48,0x20,0x99,0xA1,0xF1,0xA1,0xF1,0x61,0xC9,0x81,0x30,0x82,0x10,0xC1,0x40,0x81,0xE1,0xA1,0xF1,0xE1,0x68,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x81,0x08,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x44,0x21,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x60,0x28,0xA1,0xF1,0xA1,0xF1,0xC1,0x60,0x41,0x08,0xC1,0x38,0x81,0xD9,
-	0xC1,0xF1,0x60,0xD1,0xC1,0x48,0x20,0x00,0x61,0x08,0xA2,0x28,0x60,0x30,0x80,0x40,0x02,0x49,0x81,0x30,0x40,0x18,0x61,0x10,0x82,0x10,0xA1,0x48,0x60,0xC9,0xC1,0xF1,0x80,0xD9,0x60,0x28,0x61,0x08,0x02,0x69,0xA1,0xF1,0xA1,0xF1,0xE2,0x38,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,
-	0x82,0x10,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x85,0x29,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,
-	0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x08,0x41,0xB1,0xC1,0xF9,0x00,0x91,0x61,0x08,0x81,0x20,0x60,0xD1,0xC1,0xF9,
-	0x61,0xB9,0x60,0x18,0x20,0x00,0xA1,0x28,0x21,0xA1,0x81,0xD1,0xA1,0xE9,0xC1,0xF1,0xC1,0xF1,0xA1,0xE9,0x81,0xD1,0x20,0x99,0x40,0x20,0x61,0x08,0xA2,0x28,0x61,0xB9,0xC1,0xF9,0x81,0xD1,0x81,0x20,0x20,0x00,0x01,0x91,0xC1,0xF9,0x40,0xB1,0x40,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0xA6,0x31,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9D,0xEF,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x80,0x38,0xA1,0xE9,0x81,0xD9,0x81,0x28,0x20,0x08,0x20,0xA9,0xC1,0xF9,0x61,0xC1,
-	0x20,0x08,0x61,0x08,0xE1,0x58,0xA1,0xE1,0xC1,0xF9,0xA1,0xE9,0x81,0xD1,0x60,0xB9,0x40,0xB9,0x81,0xD1,0xA1,0xE9,0xC1,0xF9,0xA1,0xE1,0xA0,0x50,0x20,0x08,0xA2,0x18,0x81,0xC1,0xC1,0xF9,0x61,0xA9,0x82,0x18,0x60,0x28,0x81,0xD9,0xA1,0xE9,0x81,0x38,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,
-	0x82,0x10,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x48,0x42,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x84,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x28,0x42,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x58,0xC6,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x20,0x00,0x00,0x89,0xC1,0xF9,0x21,0x99,0x20,0x00,0xA1,0x40,0xA1,0xE9,0x80,0xD9,0x81,0x30,
-	0x81,0x10,0xE1,0x78,0xA1,0xE9,0xC1,0xF9,0x41,0xA9,0x60,0x38,0x40,0x18,0x82,0x10,0x40,0x08,0x20,0x10,0xE2,0x40,0x61,0xA9,0xC1,0xF9,0xA1,0xE9,0x01,0x79,0x20,0x00,0x80,0x30,0xA1,0xE1,0xA1,0xE9,0x60,0x38,0x61,0x10,0x42,0xA1,0xC1,0xF9,0x01,0x89,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x45,0x29,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x55,0xAD,0x44,0x21,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0xA2,0x10,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0x96,0xB5,0x69,0x4A,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x10,0xA1,0xE1,0xC1,0xF1,0xA1,0x38,0x61,0x08,0x20,0xA1,0xC1,0xF9,0x21,0x91,0x40,0x00,
-	0x60,0x38,0xA1,0xE9,0xA1,0xF1,0xE0,0x70,0x41,0x08,0x81,0x08,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x21,0x81,0xA1,0xF1,0xA1,0xE9,0xE2,0x40,0x61,0x08,0x01,0x89,0xC1,0xF9,0x61,0xA9,0x20,0x00,0x81,0x38,0xA1,0xF1,0xA1,0xE1,0x20,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,
-	0x81,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x80,0x38,0xC1,0xF9,0x81,0xD1,0x20,0x08,0x40,0x18,0xA1,0xF1,0xC1,0xF1,0x40,0x18,0x41,0x08,
-	0x61,0xB9,0xC1,0xF9,0x20,0x91,0x81,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x08,0x20,0x99,0xC1,0xF9,0x41,0xB1,0x41,0x08,0xA2,0x28,0xC1,0xF1,0xA1,0xF1,0x81,0x20,0x82,0x10,0x81,0xD1,0xC1,0xF9,0xE2,0x48,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x01,0x79,0xC1,0xF9,0x00,0x91,0x61,0x08,0xE1,0x68,0xC1,0xF9,0x41,0xA9,0x81,0x08,0x80,0x30,
-	0xC1,0xF9,0xA1,0xE9,0x81,0x18,0x20,0x00,0x41,0x08,0x81,0x08,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x10,0xA1,0xE9,0xC1,0xF9,0xA1,0x38,0x00,0x00,0x41,0xA9,0xC1,0xF9,0xA0,0x60,0x40,0x00,0x41,0x99,0xC1,0xF9,0xE1,0x70,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x21,0x99,0xC1,0xF9,0xE1,0x68,0x20,0x08,0x21,0x91,0xC1,0xF9,0x01,0x71,0x00,0x00,0x01,0x81,
-	0xC1,0xF9,0x01,0x89,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x21,0x91,0xC1,0xF9,0x01,0x81,0x82,0x10,0x01,0x79,0xC1,0xF9,0x41,0x99,0x82,0x10,0xC0,0x60,0xC1,0xF9,0x42,0xA1,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0xB9,0xC1,0xF9,0x80,0x48,0x61,0x08,0x61,0xB1,0xC1,0xF9,0xC1,0x50,0x81,0x08,0x41,0xB1,
-	0xC1,0xF9,0xE1,0x58,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x40,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x80,0x50,0xC1,0xF9,0x41,0xB1,0x00,0x00,0xC1,0x50,0xC1,0xF9,0x40,0xB1,0x40,0x00,0xE2,0x50,0xC1,0xF9,0x41,0xB1,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x61,0xB9,0xC1,0xF9,0xC1,0x48,0x20,0x08,0x40,0xB9,0xC1,0xF9,0xC1,0x48,0x00,0x00,0x40,0xB9,
-	0xC1,0xF9,0x80,0x40,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0xE2,0x48,0xC1,0xF9,0x61,0xB9,0x82,0x10,0xE2,0x48,0xC1,0xF9,0x61,0xB9,0x82,0x10,0x80,0x40,0xC1,0xF9,0x61,0xB9,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0xB1,0xC1,0xF9,0x80,0x48,0x61,0x08,0x41,0xA9,0xC1,0xF9,0xE1,0x58,0x61,0x08,0x41,0xA1,
-	0xC1,0xF9,0xE1,0x68,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0xA0,0x60,0xC1,0xF9,0x41,0xA9,0x00,0x00,0xE1,0x58,0xC1,0xF9,0x41,0xA9,0x40,0x00,0xE2,0x58,0xC1,0xF9,0x41,0xB1,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x01,0x91,0xC1,0xF9,0x01,0x71,0x41,0x08,0xE1,0x80,0xC1,0xF9,0x21,0x81,0x00,0x00,0xE1,0x68,
-	0xC1,0xF9,0x20,0xA1,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x41,0xA9,0xC1,0xF9,0xE1,0x68,0x82,0x10,0x21,0x81,0xC1,0xF9,0x21,0x89,0x82,0x10,0xE0,0x70,0xC1,0xF9,0x41,0x91,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x82,0x10,0x00,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0xE1,0x68,0xC1,0xF9,0x21,0xA1,0x61,0x08,0xC1,0x50,0xC1,0xF9,0x81,0xC9,0x81,0x08,0x60,0x18,
-	0xA1,0xE9,0xC1,0xF9,0xA1,0x38,0x20,0x00,0x41,0x08,0x81,0x08,0x40,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x60,0x30,0xC1,0xF9,0xA1,0xE9,0x81,0x20,0x20,0x00,0x81,0xC9,0xC1,0xF9,0xA0,0x48,0x40,0x00,0x61,0xA9,0xC1,0xF9,0xC1,0x60,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x41,0x08,0x40,0x20,0xC1,0xF9,0xA1,0xE9,0x41,0x08,0x20,0x08,0xA1,0xE1,0xA1,0xF1,0x80,0x38,0x41,0x08,
-	0x21,0x89,0xC1,0xF9,0x61,0xC1,0xA1,0x20,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x40,0x18,0x61,0xC1,0xC1,0xF9,0xE0,0x80,0x41,0x08,0xC1,0x40,0xA1,0xF1,0xA1,0xE1,0x61,0x10,0x82,0x10,0xA1,0xE9,0xC1,0xF9,0xC2,0x38,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x81,0xC9,0xC1,0xF9,0xC1,0x58,0x61,0x08,0x00,0x81,0xC1,0xF1,0x61,0xB1,0x40,0x08,
-	0x40,0x18,0x61,0xC9,0xC1,0xF9,0x20,0xA9,0x81,0x28,0x81,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xA1,0x28,0x61,0xB1,0xC1,0xF9,0x81,0xD1,0xA2,0x28,0x81,0x10,0x40,0xB1,0xC1,0xF1,0x21,0x81,0x20,0x00,0xC1,0x58,0xC1,0xF9,0x81,0xD1,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x24,0x21,0x48,0x42,0x2C,0x63,0x50,0x84,0x50,0x84,
-	0x50,0x84,0x50,0x84,0x30,0x84,0xEB,0x5A,0xA6,0x31,0xA2,0x10,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x20,0x00,0x40,0x00,0x82,0x10,0x40,0x00,0x82,0x10,0x24,0x21,0x24,0x21,0xC3,0x18,0xE3,0x18,0x44,0x21,0xE3,0x18,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x20,0x00,0xA0,0x68,0xC1,0xF9,0x40,0xB1,0x20,0x08,0x81,0x30,0xA1,0xD9,0xA1,0xE9,0xC1,0x50,
-	0x81,0x08,0x80,0x30,0x81,0xD9,0xC1,0xF9,0x81,0xD9,0x01,0x89,0xA0,0x38,0x81,0x18,0x40,0x10,0x80,0x38,0x21,0x91,0x81,0xD9,0xC1,0xF9,0xA1,0xD9,0xE2,0x40,0x20,0x00,0xA0,0x50,0xA1,0xE9,0x81,0xD9,0x60,0x28,0x61,0x10,0x61,0xB9,0xC1,0xF9,0xC0,0x68,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x69,0x4A,0x75,0xAD,0xFB,0xDE,0xBE,0xF7,0x9D,0xEF,0xFB,0xDE,0xFB,0xDE,
-	0xFB,0xDE,0xFB,0xDE,0x1B,0xDF,0xBE,0xF7,0x7D,0xEF,0x99,0xCE,0x30,0x84,0xA2,0x10,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x24,0x21,0xCF,0x7B,0xB6,0xB5,0x79,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x17,0xBE,0x55,0xAD,0xAE,0x73,0xE3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x81,0x28,0x81,0xD9,0xA1,0xE9,0xC1,0x40,0x20,0x00,0xE0,0x78,0xA1,0xF1,0xA1,0xE1,
-	0x60,0x30,0x61,0x08,0xA1,0x28,0x61,0xB1,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x61,0xB1,0x61,0x20,0x20,0x00,0xE2,0x40,0xA1,0xE1,0xC1,0xF1,0x01,0x81,0xA2,0x10,0x80,0x40,0xA1,0xE9,0xA1,0xD9,0x81,0x28,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x13,0x9D,0x7D,0xEF,0x9A,0xD6,0xB2,0x94,0x28,0x42,0x40,0x00,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x2C,0x63,0x55,0xAD,0x7D,0xEF,0x58,0xC6,0x24,0x21,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0xE3,0x18,0x89,0x4A,
-	0xF7,0xBD,0x9D,0xEF,0x5C,0xE7,0x79,0xCE,0x75,0xAD,0xF3,0x9C,0x13,0x9D,0x34,0xA5,0xF3,0x9C,0x13,0x9D,0x34,0xA5,0xD6,0xB5,0x99,0xCE,0x5D,0xEF,0x9D,0xEF,0xF3,0x9C,0xA6,0x31,0x40,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x08,0x21,0x91,0xC1,0xF9,0x61,0xC1,0x61,0x10,0x81,0x10,0x00,0x99,0xC1,0xF9,
-	0x81,0xD9,0x81,0x40,0x20,0x00,0x81,0x18,0xC1,0x40,0xE0,0x80,0x61,0xD1,0xA1,0xF1,0xA1,0xF1,0x61,0xD1,0x41,0x91,0xC1,0x40,0x20,0x08,0x61,0x08,0xC1,0x48,0x81,0xD9,0xC1,0xF9,0x41,0x99,0x81,0x10,0x20,0x08,0x61,0xC9,0xC1,0xF9,0x00,0x91,0x20,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x0B,0x5B,0xFB,0xDE,0x7D,0xEF,0xAA,0x52,0x03,0x19,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x89,0x4A,0xFB,0xDE,0xBA,0xD6,0x65,0x29,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xCA,0x52,0x58,0xC6,0xBE,0xF7,
-	0x38,0xC6,0xEB,0x5A,0x65,0x29,0x81,0x08,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0xE3,0x18,0x65,0x29,0xAE,0x73,0x1B,0xDF,0x1C,0xE7,0x0B,0x5B,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x08,0x60,0xD1,0xC1,0xF9,0x00,0x91,0x40,0x08,0x81,0x18,0x61,0xB1,
-	0xC1,0xF1,0xC1,0xF9,0x01,0x81,0x40,0x20,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0xC2,0x30,0xE0,0x78,0xC1,0xF1,0xA1,0xF1,0x41,0xB1,0x20,0x10,0x61,0x10,0x41,0x99,0xC1,0xF9,0x60,0xD1,0xA2,0x20,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0xEF,0x7B,0xBE,0xF7,0x95,0xAD,0xA6,0x31,0xA2,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0xA6,0x31,0xFB,0xDE,0x58,0xC6,0x24,0x21,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x04,0x21,0xCE,0x73,0x9D,0xEF,0x59,0xCE,0x2C,0x63,
-	0x20,0x00,0x40,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x04,0x21,0x75,0xAD,0xBE,0xF7,0x0B,0x5B,0x61,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0xA1,0x40,0xA1,0xE1,0xA1,0xF1,0x01,0x79,0x00,0x00,0x40,0x10,
-	0x21,0x81,0xA1,0xF1,0xC1,0xF1,0x81,0xD9,0x20,0xA9,0xA0,0x50,0x80,0x20,0x81,0x10,0x40,0x08,0x60,0x20,0xE1,0x58,0x41,0xA9,0x81,0xD9,0xC1,0xF1,0xA1,0xF1,0xC0,0x78,0x40,0x10,0x82,0x10,0x01,0x79,0xA1,0xF1,0xA1,0xE9,0xE2,0x48,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x8D,0x6B,0xBE,0xF7,0x92,0x94,0xE3,0x18,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,
-	0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x48,0x42,0x7D,0xEF,0x91,0x8C,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0x54,0xA5,0x9D,0xEF,0x0F,0x7C,0x24,0x21,0x20,0x00,
-	0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x34,0xA5,0x3C,0xE7,0x65,0x29,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x01,0x71,0xA1,0xE9,0xC1,0xF9,0x21,0x89,0x40,0x10,
-	0x20,0x00,0xA1,0x40,0x61,0xC1,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x61,0xB9,0x80,0x38,0x82,0x10,0x81,0x18,0xE0,0x78,0xC1,0xF9,0xA1,0xE9,0xE1,0x68,0x40,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x69,0x4A,0xBE,0xF7,0xD2,0x94,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0xB2,0x94,0x3C,0xE7,0x45,0x29,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0xD2,0x94,0x7D,0xEF,0x8E,0x73,0x00,0x00,0x41,0x08,0x81,0x08,
-	0x20,0x00,0x40,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0xDA,0xD6,0x95,0xAD,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0xC1,0x60,0xA1,0xE9,0xA1,0xF1,0x61,0xB9,
-	0xA1,0x30,0x20,0x00,0x20,0x08,0xC1,0x38,0x01,0x71,0x41,0xB1,0x81,0xD9,0xA1,0xF1,0xA1,0xF1,0x81,0xD9,0x61,0xB9,0x01,0x71,0x40,0x28,0x61,0x10,0x82,0x10,0x60,0x28,0x61,0xB9,0xA1,0xF1,0xA1,0xE9,0xA0,0x58,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x04,0x21,0xBA,0xD6,0x17,0xBE,0x82,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x4C,0x63,0xD3,0x9C,0xF3,0x9C,
-	0x8D,0x6B,0x03,0x19,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x65,0x29,0x5C,0xE7,0x8D,0x6B,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x0F,0x7C,0x9D,0xEF,0xCB,0x5A,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,
-	0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0xEB,0x5A,0x9D,0xEF,0x85,0x29,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0xA0,0x50,0x80,0xD9,0xC1,0xF9,
-	0xA1,0xE9,0x21,0x81,0xA1,0x30,0x20,0x08,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x60,0x28,0xC0,0x78,0xA1,0xE9,0xC1,0xF9,0x81,0xD9,0xC1,0x58,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x50,0x84,0x9D,0xEF,0xE7,0x39,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x65,0x29,0x18,0xC6,0x7D,0xEF,0xDA,0xD6,0xBA,0xD6,
-	0x7D,0xEF,0xDB,0xDE,0x44,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x96,0xB5,0x79,0xCE,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0xE7,0x39,0x5C,0xE7,0x13,0x9D,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x24,0x21,0x69,0x4A,0x75,0xAD,0x79,0xCE,0xD7,0xBD,0x8E,0x73,0x44,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x45,0x29,0x3C,0xE7,0x10,0x84,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x40,0x20,0x00,0x99,
-	0xC1,0xF9,0xC1,0xF9,0xA1,0xE1,0x61,0xB9,0x01,0x81,0x80,0x40,0x60,0x20,0x81,0x10,0x41,0x08,0x40,0x18,0xE2,0x48,0x01,0x81,0x41,0xB9,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,0x21,0x99,0xC2,0x30,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x08,0x20,0x00,0x82,0x10,0x49,0x4A,0x9D,0xEF,0x6D,0x6B,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x24,0x21,0x79,0xCE,0xFB,0xDE,0x49,0x4A,0x65,0x29,0x24,0x21,
-	0x07,0x3A,0xFB,0xDE,0x18,0xC6,0xA2,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x69,0x4A,0xBE,0xF7,0x44,0x21,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0xF3,0x9C,0xFB,0xDE,0x44,0x21,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,
-	0x40,0x00,0x81,0x08,0xAA,0x52,0xBA,0xD6,0x7D,0xEF,0x18,0xC6,0x13,0x9D,0xD7,0xBD,0xBE,0xF7,0xBA,0xD6,0xA6,0x31,0x81,0x08,0x20,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0x58,0xC6,0x95,0xAD,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,
-	0x60,0x38,0x40,0xB1,0xA1,0xE1,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0xA1,0xE1,0x41,0xB1,0xC1,0x40,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0xD7,0xBD,0xBA,0xD6,0x04,0x21,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0xB2,0x94,0x7D,0xEF,0x49,0x4A,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x4D,0x6B,0x7D,0xEF,0x08,0x42,0x61,0x08,0x00,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0xC7,0x39,0x5C,0xE7,0x4D,0x6B,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x85,0x29,0xBE,0xF7,0xCF,0x7B,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,
-	0x20,0x00,0xEB,0x5A,0xBE,0xF7,0xD6,0xB5,0xE7,0x39,0x61,0x08,0x81,0x08,0x20,0x00,0xC6,0x31,0xBA,0xD6,0xBA,0xD6,0xC3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0xB6,0xB5,0x18,0xC6,0x41,0x08,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,
-	0x81,0x08,0x41,0x08,0x40,0x20,0xC1,0x50,0x41,0x91,0x61,0xC1,0x81,0xE1,0xA1,0xF1,0xA1,0xF1,0x81,0xE1,0x61,0xC1,0x41,0x91,0x80,0x48,0x81,0x28,0xA2,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x08,0x20,0x00,0x08,0x42,0x9D,0xEF,0xAE,0x73,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0xE7,0x39,0x9D,0xEF,0x8E,0x73,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0xA2,0x10,0xDE,0xF7,0xE7,0x39,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0xFB,0xDE,0x92,0x94,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x08,0x20,0x00,0x82,0x10,0x14,0xA5,0x1B,0xDF,0x65,0x29,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,
-	0x65,0x29,0x1C,0xE7,0x75,0xAD,0x81,0x08,0x81,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0xC6,0x31,0xBE,0xF7,0x28,0x42,0x20,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x13,0x9D,0xBA,0xD6,0x03,0x19,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0xF3,0x9C,0xBA,0xD6,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0xF3,0x9C,0xFB,0xDE,0x24,0x21,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x1B,0xDF,0x0F,0x7C,0x61,0x08,0x00,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x45,0x29,0xBA,0xD6,0x13,0x9D,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0xE3,0x18,0xBA,0xD6,0x13,0x9D,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,
-	0xF3,0x9C,0x3C,0xE7,0xC2,0x10,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x5D,0xEF,0xAE,0x73,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x20,0x00,0xB6,0xB5,0x58,0xC6,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,
-	0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0xC2,0x10,0x9D,0xEF,0xAE,0x73,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x65,0x29,0xDA,0xD6,0x54,0xA5,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x61,0x08,0xFB,0xDE,0x71,0x8C,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0xE3,0x18,0xBA,0xD6,0x34,0xA5,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x08,0x20,0x00,0xE7,0x39,0x7D,0xEF,0xF3,0x9C,0x2C,0x63,0x8A,0x52,0x44,0x21,0x20,0x00,0x81,0x08,0x61,0x08,0xE3,0x18,
-	0x7D,0xEF,0x8D,0x6B,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0xBE,0xF7,0xAA,0x52,0x20,0x08,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0x99,0xCE,0x34,0xA5,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,
-	0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x81,0x08,0x82,0x10,0x20,0x00,0x20,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x0F,0x7C,0x5C,0xE7,0xC6,0x31,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x48,0x42,0x9D,0xEF,0x49,0x4A,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x41,0x08,0xFB,0xDE,0x71,0x8C,0x61,0x08,0x00,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x17,0xBE,0xF7,0xBD,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x65,0x29,0xBA,0xD6,0x3C,0xE7,0x7D,0xEF,0x9D,0xEF,0xDE,0xF7,0xFF,0xFF,0x3C,0xE7,0xBA,0xD6,0x18,0xC6,
-	0x5C,0xE7,0x86,0x31,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x89,0x4A,0x9D,0xEF,0xA6,0x31,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x24,0x21,0x1B,0xDF,0x30,0x84,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,
-	0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0xF7,0xBD,0x38,0xC6,0xA2,0x10,0x00,0x00,0x61,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x14,0xA5,0xBA,0xD6,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x61,0x08,0xFB,0xDE,0x71,0x8C,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x17,0xBE,0x17,0xBE,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x08,0x20,0x00,0x82,0x10,0x65,0x29,0x45,0x29,0xA6,0x31,0x28,0x42,0xE7,0x39,0x08,0x42,0xCE,0x73,0x91,0x8C,0xB6,0xB5,
-	0x4C,0x63,0xA2,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x75,0xAD,0xFB,0xDE,0x45,0x29,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0xE7,0x39,0xBE,0xF7,0xE7,0x39,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,
-	0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x81,0x08,0x82,0x10,0x20,0x00,0x40,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x86,0x31,0x1B,0xDF,0x51,0x8C,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xFB,0xDE,0x51,0x8C,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x41,0x08,0x5C,0xE7,0x8D,0x6B,0x61,0x08,0x00,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x20,0x08,0x45,0x29,0xBA,0xD6,0x13,0x9D,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0xE7,0x39,0x5D,0xEF,0x30,0x84,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0xF7,0xBD,0x79,0xCE,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,
-	0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x08,0x42,0xBE,0xF7,0x28,0x42,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0xA6,0x31,0xBE,0xF7,0x07,0x3A,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x61,0x08,0xFF,0xFF,0x08,0x42,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0xE3,0x18,0xBA,0xD6,0x34,0xA5,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,
-	0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0xC2,0x10,0x9A,0xD6,0x9A,0xD6,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0xEB,0x5A,0x9D,0xEF,0xAA,0x52,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,
-	0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0xAE,0x73,0x3C,0xE7,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x4D,0x6B,0x5C,0xE7,0xE7,0x39,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0xAA,0x52,0x9D,0xEF,0x08,0x42,0x61,0x08,0x00,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x20,0x08,0x45,0x29,0xDA,0xD6,0xD3,0x9C,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0x17,0xBE,0x1B,0xDF,0xA6,0x31,0x41,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0x59,0xCE,0x38,0xC6,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,
-	0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x95,0xAD,0x17,0xBE,0x81,0x10,0x81,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0xD2,0x94,0xDA,0xD6,0x03,0x19,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0xAE,0x73,0x5C,0xE7,0x65,0x29,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x44,0x21,0x3C,0xE7,0x10,0x84,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,
-	0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x86,0x31,0x17,0xBE,0x3C,0xE7,0x69,0x4A,0x20,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x92,0x94,0xBE,0xF7,0xC7,0x39,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,
-	0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0xDA,0xD6,0x92,0x94,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0xB6,0xB5,0x38,0xC6,0xC2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x34,0xA5,0xBA,0xD6,0x24,0x21,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x08,0x28,0x42,0x9E,0xF7,0x28,0x42,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x28,0x42,0xFB,0xDE,0xDB,0xDE,0x69,0x4A,0x00,0x00,0x61,0x08,0x40,0x08,0x00,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0x0C,0x63,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,
-	0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0xBE,0xF7,0x69,0x4A,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x9A,0xD6,0x34,0xA5,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0xD7,0xBD,0x38,0xC6,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x08,0x42,0xDE,0xF7,0xE3,0x18,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x40,0x00,0x81,0x08,0xC2,0x10,0xF3,0x9C,0x7D,0xEF,0x38,0xC6,0x24,0x21,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x69,0x4A,0x3C,0xE7,0x55,0xAD,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x10,0x20,0x08,0x40,0x20,0x60,0x28,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x40,0x28,0x60,0x20,0x81,0x18,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x48,0x42,0x9D,0xEF,0x07,0x3A,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xA6,0x31,0x3C,0xE7,0x10,0x84,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x45,0x29,0xDA,0xD6,0xF3,0x9C,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x92,0x94,0xDA,0xD6,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x41,0x08,0x08,0x42,0x9A,0xD6,0x7D,0xEF,0x30,0x84,0xC3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x69,0x4A,0x3C,0xE7,0x17,0xBE,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,
-	0x61,0x10,0x40,0x20,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x40,0x28,0x20,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xAE,0x73,0x5C,0xE7,0x65,0x29,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0xA6,0x31,0x9D,0xEF,0xAA,0x52,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x65,0x29,0x3C,0xE7,0xCE,0x73,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0xB6,0xB5,0xF7,0xBD,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x71,0x8C,0x7D,0xEF,0x59,0xCE,0xE7,0x39,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x69,0x4A,0x1C,0xE7,0x17,0xBE,0x03,0x19,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x10,0x40,0x20,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x20,0x00,0x08,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x13,0x9D,0xBA,0xD6,0x24,0x21,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x89,0x4A,0xDE,0xF7,0xC2,0x10,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x28,0x42,0xBE,0xF7,0x28,0x42,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x1B,0xDF,0x0F,0x7C,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x44,0x21,0xB6,0xB5,
-	0x9D,0xEF,0xD3,0x9C,0x61,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x61,0x08,0xCB,0x5A,0x3C,0xE7,0x17,0xBE,0xA2,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x41,0x18,0x40,0x30,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x40,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xD6,0xB5,0x38,0xC6,0x61,0x08,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x0F,0x7C,0x3C,0xE7,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,
-	0x0B,0x5B,0x9D,0xEF,0xC2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0xE3,0x18,0xBE,0xF7,0x48,0x42,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x48,0x42,0xBA,0xD6,0x3C,0xE7,
-	0xAA,0x52,0xA2,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x40,0x00,0x00,0x00,0x30,0x84,0x9D,0xEF,0x75,0xAD,0xC3,0x18,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x10,0x40,0x30,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x80,0x58,0x80,0x48,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x81,0x20,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0xF7,0xBD,0x17,0xBE,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0x54,0xA5,0x38,0xC6,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x34,0xA5,0x79,0xCE,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x2C,0x63,0x7D,0xEF,0x86,0x31,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0xCA,0x5A,0x5D,0xEF,0x79,0xCE,0x65,0x29,
-	0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x20,0x00,0xE3,0x18,0x55,0xAD,0x9D,0xEF,0x92,0x94,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x08,0x20,0x18,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x41,0xB9,0xE0,0x80,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x60,0x18,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x17,0xBE,0xF7,0xBD,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0xD6,0xB5,0xB6,0xB5,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,
-	0xFB,0xDE,0x71,0x8C,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x14,0xA5,0xBA,0xD6,0xE3,0x18,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xEF,0x7B,0x7D,0xEF,0x54,0xA5,0x24,0x21,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x89,0x4A,0xBA,0xD6,0x5C,0xE7,0x2C,0x63,0x81,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x40,0x10,0x60,0x30,0x60,0x30,0x80,0x48,0xE0,0x80,0x60,0x38,
-	0x60,0x38,0x60,0x38,0xC0,0x70,0xA0,0x58,0x60,0x38,0x60,0x38,0x60,0x38,0xE0,0x88,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x40,0x10,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0xF7,0xBD,0x17,0xBE,0x81,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0xF7,0xBD,0xB6,0xB5,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x65,0x29,
-	0xBE,0xF7,0xE7,0x39,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0xDA,0xD6,0x55,0xAD,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x41,0x08,0xAE,0x73,0x7D,0xEF,0xD3,0x9C,0x82,0x10,0x41,0x08,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0xE3,0x18,0x6D,0x6B,0x7D,0xEF,0x58,0xC6,0xC6,0x31,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x40,0x28,0x60,0x38,0x60,0x30,0xC0,0x78,0x81,0xE1,0x80,0x50,
-	0x60,0x38,0x40,0x20,0x60,0x38,0x40,0x30,0x60,0x38,0x60,0x38,0x80,0x48,0xA1,0xE1,0x80,0x48,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x40,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x17,0xBE,0xF7,0xBD,0x20,0x00,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0xF7,0xBD,0xB6,0xB5,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x71,0x8C,
-	0x1C,0xE7,0x85,0x31,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xE7,0x39,0x9D,0xEF,0x89,0x4A,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x40,0x00,0x50,0x84,0x7D,0xEF,0x10,0x84,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x65,0x29,0x58,0xC6,0x9D,0xEF,0x30,0x84,0x03,0x19,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,
-	0x80,0x50,0x81,0xD1,0xC1,0xF9,0xC1,0xF9,0x60,0xC1,0x40,0x28,0x40,0x30,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x81,0x20,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0xB6,0xB5,0x38,0xC6,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x10,0xD6,0xB5,0xB6,0xB5,0x41,0x08,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x82,0x10,0x79,0xCE,
-	0xD6,0xB5,0x61,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0xF3,0x9C,0x1B,0xDF,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0xAE,0x73,0x7D,0xEF,0x71,0x8C,0xA2,0x10,0x40,0x08,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x82,0x10,0xEB,0x5A,0x3C,0xE7,0xBA,0xD6,0xAA,0x52,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x08,0x40,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x70,
-	0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0x61,0xD1,0xA0,0x68,0x80,0x50,0xE0,0x78,0xE0,0x88,0xC0,0x70,0x40,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x20,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x34,0xA5,0xBA,0xD6,0xE3,0x18,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x14,0xA5,0x79,0xCE,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xE7,0x39,0x7D,0xEF,
-	0xAE,0x73,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x44,0x21,0x9D,0xEF,0x8D,0x6B,0x00,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x50,0x84,0x7D,0xEF,0x10,0x84,0xC2,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x20,0x00,0x40,0x08,0x10,0x84,0x9D,0xEF,0x75,0xAD,0x44,0x21,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x18,0x60,0x38,0x60,0x38,0x40,0x30,0x60,0x38,0x40,0x30,0x60,0x38,0x60,0xC9,
-	0xC1,0xF9,0xA1,0xF1,0x20,0xA1,0x80,0x50,0x61,0xC1,0xA1,0xF1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x20,0x99,0x60,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x18,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x10,0x84,0x1B,0xDF,0x85,0x29,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x2C,0x63,0x7D,0xEF,0xC3,0x18,0xA2,0x10,0x40,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x14,0xA5,0xFB,0xDE,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x13,0x9D,0x3C,0xE7,0x65,0x29,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x8A,0x52,0x7D,0xEF,0x92,0x94,0x61,0x08,0x20,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x41,0x08,0x10,0x84,0xBE,0xF7,0xB2,0x94,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0xE0,0x80,0x60,0xC9,0xA0,0x60,0x80,0x50,0xA1,0xE1,
-	0xC1,0xF9,0x00,0x91,0xC0,0x70,0xA1,0xE9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x80,0xD9,0x80,0x50,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x81,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0xCB,0x5A,0x7D,0xEF,0xA6,0x31,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x86,0x31,0x7D,0xEF,0xCF,0x7B,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x8D,0x6B,0x7D,0xEF,0xEB,0x5A,
-	0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0xA6,0x31,0x5C,0xE7,0xD3,0x9C,0x82,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x08,0x48,0x42,0x5D,0xEF,0x54,0xA5,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x45,0x29,0x3C,0xE7,0x51,0x8C,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x68,0x20,0xA9,0x80,0x50,0x80,0x50,0x61,0xC9,
-	0x40,0xB9,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x60,0xD1,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x00,0x00,0x41,0x08,0x81,0x08,0x40,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0xA2,0x10,0x9D,0xEF,0xEB,0x5A,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0xE3,0x18,0xD7,0xBD,0xFB,0xDE,0x8A,0x52,0x44,0x21,0x65,0x29,0xAE,0x73,0x7D,0xEF,0x34,0xA5,0xC2,0x10,
-	0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0xB6,0xB5,0x1B,0xDF,0xC2,0x10,0x40,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x04,0x21,0x99,0xCE,0x79,0xCE,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x08,0x41,0x08,
-	0xC3,0x18,0xF7,0xBD,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0xC0,0x68,
-	0x40,0xB9,0x81,0xE1,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0xC0,0x68,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x20,0x61,0x08,0x00,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x82,0x10,
-	0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x95,0xAD,0x59,0xCE,0x81,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x86,0x31,0x79,0xCE,0x7D,0xEF,0x3C,0xE7,0x3C,0xE7,0x9D,0xEF,0x51,0x8C,0xE3,0x18,0x61,0x08,
-	0x00,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0xEF,0x7B,0x9D,0xEF,0x89,0x4A,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0xB2,0x94,0x3C,0xE7,0xA6,0x31,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x08,0x00,0x00,
-	0x20,0x00,0x03,0x19,0xE7,0x39,0xE7,0x39,0x28,0x42,0x28,0x42,0xE7,0x39,0x07,0x3A,0x28,0x42,0x08,0x42,0x07,0x3A,0x07,0x3A,0x07,0x3A,0xE7,0x39,0x07,0x3A,0xB6,0xB5,0xDA,0xD6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x00,0x91,0xA1,0xF1,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xD1,0x60,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x18,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x41,0x08,0xA2,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x69,0x4A,0xBE,0xF7,0x0C,0x63,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x69,0x4A,0x10,0x84,0xAE,0x73,0xA6,0x31,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x69,0x52,0x7D,0xEF,0x13,0x9D,0xA2,0x10,0x20,0x00,0x40,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0xCA,0x52,0xBE,0xF7,0xCE,0x73,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x96,0xB5,0x58,0xC6,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x00,0x99,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xF1,0x81,0xD1,0x20,0xA9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x20,0x61,0x08,0x00,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x58,0xC6,0x79,0xCE,0x24,0x21,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x81,0x08,0x61,0x08,
-	0x00,0x00,0x61,0x08,0x81,0x08,0xE7,0x39,0x3C,0xE7,0xD6,0xB5,0xE3,0x18,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0xE3,0x18,0x99,0xCE,0xF7,0xBD,0x82,0x10,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x99,0xCE,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x48,0x81,0xE1,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x60,0xD1,0x60,0x40,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x81,0x08,0x20,0x00,0x40,0x00,0x82,0x10,0x40,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0xAA,0x52,0x9D,0xEF,0x0F,0x7C,0x82,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x48,0x42,0x3C,0xE7,0x59,0xCE,0x04,0x21,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0xEB,0x5A,0x9D,0xEF,0x8A,0x52,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0x1B,0xDF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC1,0xF1,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF1,0x00,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x61,0x08,0x00,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,
-	0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xAE,0x73,0x7D,0xEF,0x6D,0x6B,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x81,0x08,0x61,0x08,
-	0x61,0x08,0x0F,0x7C,0x7D,0xEF,0xD6,0xB5,0x04,0x21,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x1B,0xDF,0x14,0xA5,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x70,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x20,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x81,0x08,0x61,0x08,0xA2,0x10,0x54,0xA5,0x7D,0xEF,0xD3,0x9C,0x04,0x21,0x61,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x82,0x10,0xE7,0x39,
-	0x58,0xC6,0x7D,0xEF,0x13,0x9D,0xE3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x00,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0xAE,0x73,0x7D,0xEF,0x86,0x31,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x28,0x42,0xDE,0xF7,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xA0,0x58,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x61,0x20,0x61,0x08,0x00,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,
-	0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0xE3,0x18,0x6D,0x6B,0x7D,0xEF,0xDA,0xD6,0xB2,0x94,0x08,0x42,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0xE7,0x39,0x50,0x84,0x38,0xC6,0x7D,0xEF,
-	0xBA,0xD6,0x69,0x4A,0xA2,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0x38,0xC6,0xB6,0xB5,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x7C,0x3C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x80,0x50,0xA1,0xE1,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xA1,0xE9,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x20,0x08,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x08,0x81,0x08,0x07,0x3A,0x75,0xAD,0xFB,0xDE,0xBE,0xF7,0x9D,0xEF,0xFB,0xDE,0xFB,0xDE,0x1B,0xDF,0xBE,0xF7,0xBE,0xF7,0x1B,0xDF,0xF7,0xBD,0x4D,0x6B,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x45,0x29,0x3C,0xE7,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,
-	0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0x3C,0xE7,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x28,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x20,0xA1,0xC1,0xF9,0xC1,0xF9,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x00,0x99,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,
-	0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x44,0x21,0xC6,0x31,0x0B,0x5B,0x50,0x84,0x50,0x84,0x30,0x84,0xCA,0x52,0xE7,0x39,0x24,0x21,0xA2,0x10,0x61,0x08,
-	0x00,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0xCE,0x73,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,
-	0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x18,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x28,0x40,0xB9,0xA1,0xF1,
-	0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0xC1,0xF9,0x61,0xC9,0x80,0x48,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x08,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0xC0,0x68,
-	0x41,0xB9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0xA1,0xE9,0x81,0xD1,0xE0,0x80,0x80,0x48,0x40,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x30,0x20,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,
-	0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x28,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,
-	0x81,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x08,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x40,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x60,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x20,0x10,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,
-	0x81,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x81,0x08,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x20,0x60,0x30,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x40,0x28,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,
-	0x81,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x60,0x38,0x60,0x38,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x40,0x20,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x40,0x28,
-	0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x40,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x18,0x40,0x30,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x38,0x60,0x30,0x40,0x18,0x00,0x00,0x40,0x00,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x18,0x40,0x28,0x40,0x28,0x40,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x40,0x28,0x40,0x28,0x20,0x18,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x08,0x20,0x08,0x40,0x10,0x40,0x10,0x00,0x08,0x20,0x08,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x08,
-	0x40,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x08,0x00,0x00,0x40,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x08,
-	0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,
-	0x20,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,
-	0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x08,0x00,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0x40,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,
-	0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x00,
-	0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x40,0x00,
-	0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_116_2_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_116_2_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_116_2_dial_img_preview_data_0};
-
-    
\ No newline at end of file
@@ -427,9 +427,17 @@ void init_face_174(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_174_36_124040, 245);
     lv_obj_add_flag(face_174_36_124040, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_174_36_124040, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_174_0_24536);
+	face_compositor_static(face_174_1_10295);
+	face_compositor_static(face_174_2_14700);
+	face_compositor_static(face_174_3_6727);
+	face_compositor_static(face_174_9_2783);
+	face_compositor_static(face_174_11_9921);
+	face_compositor_static(face_174_13_24092);
+	face_compositor_static(face_174_28_6485);
 
 
-    callback("174", &face_174_dial_img_preview_0, &face_174, NULL);
+    callback("174", NULL, &face_174, NULL);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_174 // (174) uncomment to enable or define it elsewhere
 
@@ -125,8 +126,6 @@ extern "C"
 	LV_IMG_DECLARE(face_174_dial_img_36_124040_4);
 	LV_IMG_DECLARE(face_174_dial_img_36_124040_5);
 	LV_IMG_DECLARE(face_174_dial_img_36_124040_6);
-	LV_IMG_DECLARE(face_174_dial_img_preview_0);
-	LV_IMG_DECLARE(face_174_dial_img_preview_0);
 
 
 #endif
@@ -5,6 +5,7 @@
 // Watchface: 174
 
 #include "../174.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,91 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_0_24536_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x08,0x06,0x1B,0xAA,0x2C,0xED,0x35,0xEF,0x3E,0x70,0x47,0xD1,0x47,0x30,0x47,0xA8,0x23,0x81,0x00,0x61,0x00,0x40,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x02,0x09,0x09,0x24,0xCF,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x45,0x12,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x09,0x6C,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xE8,0x23,
-	0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC1,0x00,0x2B,0x2D,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x45,0x12,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x1A,0x90,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0x50,0x47,0xC8,0x23,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0xCA,0x2C,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6E,0x3E,0x69,0x2C,0xC6,0x1A,0x83,0x09,0x81,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0xED,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x30,0x47,0xE8,0x23,0x02,0x09,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x4E,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x70,0x47,0x87,0x23,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x00,0x81,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x0D,0x36,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6C,0x35,0xA1,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x2C,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x88,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x1A,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xB1,0x47,0x85,0x12,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x08,0x90,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x85,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x2D,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0x88,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x09,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6C,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x35,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0x70,0x47,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x09,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x67,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x08,0x24,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x0F,0x3F,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x67,0x1B,0x06,0x1B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0xCF,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xE8,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x09,0x8C,0x35,0x2D,0x36,0x06,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x0F,0x3F,0xF1,0x47,0xF1,0x47,0xAC,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x81,0x00,0x00,0x00,0xE2,0x08,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xE2,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x00,0xD1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x04,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x2C,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0x49,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x00,0x00,0x06,0x1B,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xCF,0x3E,0x00,0x00,0x00,0x00,0x20,0x00,0x90,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x20,0x00,0xCA,0x2C,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x69,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x02,0x09,
-	0x00,0x00,0x43,0x09,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x88,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x40,0x00,0xED,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xC6,0x1A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x23,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x65,0x12,0x00,0x00,0x04,0x12,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xAC,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0xEF,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x63,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x2D,0xF1,0x47,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0xC6,0x1A,0x00,0x00,0x04,0x12,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x90,0x47,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xC6,0x1A,0x00,0x00,0x63,0x09,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x8E,0x3E,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xCD,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x45,0x12,0x00,0x00,0x61,0x00,0xD1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x81,0x08,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x83,0x09,0x00,0x00,0x00,0x00,0xAF,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0x2D,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x90,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x24,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xB1,0x47,0x61,0x00,0x00,0x00,0x00,0x00,0x0B,0x2D,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x4B,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0xEF,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x63,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x1A,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x87,0x1B,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x87,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0xED,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xA6,0x1A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x2B,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x09,0x0F,0x3F,0xB1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x63,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0xCA,0x2C,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x49,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2B,0x2D,0x6E,0x3E,0xAC,0x35,0xEA,0x2C,0x08,0x24,
-	0x22,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x00,0x42,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x40,0x00,0x06,0x1B,0xF1,0x47,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0x4E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x12,0xC4,0x11,0x02,0x09,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x20,0x00,0xE2,0x08,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xE2,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x09,
-	0xA8,0x23,0x69,0x24,0x2B,0x2D,0x0D,0x36,0x04,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x00,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x4E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x00,0x00,
-	0x00,0x00,0xCF,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xE8,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x23,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x69,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x11,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xAE,0x3E,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x00,0x00,0x00,0x00,0x08,0x24,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x0F,0x3F,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0x1A,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x2B,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x12,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x8C,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x02,0x09,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x67,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x09,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xAC,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x11,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0x27,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x70,0x47,0xA1,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xCA,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x90,0x47,0xF1,0x47,0xF1,0x47,0xEF,0x3E,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x81,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x11,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6C,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x09,0x2F,0x3F,0xF1,0x47,0xB1,0x47,0x22,0x09,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x09,0x4B,0x2D,0xCA,0x2C,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x2D,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0x88,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x08,0x90,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x85,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE6,0x1A,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xB1,0x47,0x85,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x2C,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x88,0x23,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x0D,0x36,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x6C,0x35,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x4E,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0x70,0x47,0x67,0x23,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0xED,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x30,0x47,0xE8,0x23,0x02,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xEA,0x2C,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x4E,0x3E,0x69,0x2C,0xA6,0x1A,0x83,0x09,0x81,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x1A,0x90,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0x30,0x47,0xC8,0x23,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x00,0x2B,0x2D,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x45,0x12,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x09,0x6C,0x35,0xF1,0x47,0xF1,0x47,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xE8,0x23,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x09,0x09,0x24,0xCF,0x3E,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x45,0x12,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x09,0x06,0x1B,0xCA,0x2C,0xED,0x35,0xEF,0x3E,0x70,0x47,0xD1,0x47,0x50,0x47,0xC8,0x23,0x81,0x00,0x61,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_174_dial_img_0_24536_data_0, "face_174_dial_img_0_24536_data_0.bin");
         
 
 
@@ -104,7 +21,7 @@ const lv_img_dsc_t face_174_dial_img_0_24536_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 50,
     .header.h = 50,
-    .data_size = sizeof(face_174_dial_img_0_24536_data_0),
+    .data_size = 5000,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_174_dial_img_0_24536_data_0};
 
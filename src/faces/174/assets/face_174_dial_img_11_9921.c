@@ -5,6 +5,7 @@
 // Watchface: 174
 
 #include "../174.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,28 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_11_9921_data_0[] = {
-	//RGB565 data 
-	0x90,0x19,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x08,0x90,0x19,0x86,0x08,0x00,0x00,0x00,0x00,0x64,0x00,0x90,0x19,0x77,0x2A,0x77,0x2A,0x6E,0x19,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x90,0x19,0xC8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x90,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x3F,0x3B,0xC8,0x08,0x00,0x00,0x00,0x00,0x86,0x08,0x1D,0x33,0x13,0x22,0x00,0x00,0x00,0x00,0x86,0x08,0x1D,0x33,0xDB,0x32,0x90,0x19,0xD1,0x21,0xDB,0x32,0xDB,0x32,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0x21,0x3F,0x3B,0xDB,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x08,0x3F,0x3B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3B,0xC8,0x08,0x00,0x00,0x86,0x08,0x1D,0x33,0x13,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0x32,0x35,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0xDB,0x32,0x13,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x33,0x90,0x19,0x3F,0x3B,0x86,0x08,0x00,0x00,0x00,0x00,0xC8,0x08,0x3F,0x3B,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3B,0xC8,0x08,0x86,0x08,0x1D,0x33,0x2C,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x08,0x3F,0x3B,0x86,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x86,0x08,0x00,0x00,0x00,0x00,0x2C,0x11,0x3F,0x3B,0x22,0x00,0x99,0x32,0x13,0x22,0x00,0x00,0x00,0x00,
-	0xC8,0x08,0x3F,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3B,0x6E,0x19,0x1D,0x33,0x35,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x19,0x3F,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x2A,0x35,0x2A,0x00,0x00,0x6E,0x19,0x1D,0x33,
-	0x22,0x00,0x00,0x00,0xC8,0x08,0x3F,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3B,0x3F,0x3B,0x13,0x22,0x3F,0x3B,0x2C,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x19,0x3F,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x3F,0x3B,0x0A,0x11,0x00,0x00,
-	0x22,0x00,0x3F,0x3B,0x2C,0x11,0x00,0x00,0xC8,0x08,0x3F,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3B,0x6E,0x19,0x00,0x00,0x90,0x19,0x3F,0x3B,0x2C,0x11,0x00,0x00,0x00,0x00,0x2C,0x11,0x3F,0x3B,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x08,0x90,0x19,0x00,0x00,0x90,0x19,0x3F,0x3B,
-	0x77,0x2A,0x77,0x2A,0x77,0x2A,0x1D,0x33,0x77,0x2A,0x00,0x00,0xC8,0x08,0x3F,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3B,0xC8,0x08,0x00,0x00,0x00,0x00,0x13,0x22,0x1D,0x33,0x86,0x08,0x00,0x00,0x22,0x00,0x3F,0x3B,0x90,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x2A,0x35,0x2A,0x00,0x00,
-	0xDB,0x32,0x13,0x22,0xC8,0x08,0xC8,0x08,0xC8,0x08,0x6E,0x19,0x3F,0x3B,0x64,0x00,0xC8,0x08,0x3F,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x3B,0xC8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x32,0x1D,0x33,0x86,0x08,0x00,0x00,0x2C,0x11,0x3F,0x3B,0x13,0x22,0x0A,0x11,0x2C,0x11,0x77,0x2A,0x1D,0x33,
-	0x86,0x08,0xC8,0x08,0x3F,0x3B,0x86,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x33,0xD1,0x21,0xC8,0x08,0x3F,0x3B,0x90,0x19,0x90,0x19,0x90,0x19,0x90,0x19,0x90,0x19,0x64,0x00,0x77,0x2A,0x86,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x35,0x2A,0x13,0x22,0x00,0x00,0x00,0x00,0x0A,0x11,0x77,0x2A,0x3F,0x3B,0x1D,0x33,
-	0x13,0x22,0x64,0x00,0x00,0x00,0x6E,0x19,0x35,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x19,0x13,0x22,0x86,0x08,0x77,0x2A,0x77,0x2A,0x77,0x2A,0x77,0x2A,0x77,0x2A,0x77,0x2A,0x86,0x08,
-
-	// Alpha Channel 
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_174_dial_img_11_9921_data_0, "face_174_dial_img_11_9921_data_0.bin");
         
 
 
@@ -41,7 +21,7 @@ const lv_img_dsc_t face_174_dial_img_11_9921_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 10,
-    .data_size = sizeof(face_174_dial_img_11_9921_data_0),
+    .data_size = 1020,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_11_9921_data_0};
 
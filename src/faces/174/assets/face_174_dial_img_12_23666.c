@@ -5,6 +5,7 @@
 // Watchface: 174
 
 #include "../174.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,31 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_12_23666_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x2C,0x6A,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x12,0x00,0x00,0x6A,0x2C,0x06,0x1B,0x02,0x09,0x04,0x12,0x00,0x00,0x6A,0x2C,0x04,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x09,0xED,0x35,
-	0x00,0x00,0x00,0x00,0xED,0x35,0x6E,0x3E,0x04,0x12,0x04,0x12,0x04,0x12,0x83,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x3E,0x06,0x1B,0xED,0x35,0x08,0x24,0x6C,0x35,0xEB,0x2C,0x00,0x00,0x6E,0x3E,0x08,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x12,0xF1,0x47,0x00,0x00,0x00,0x00,0xED,0x35,0xF1,0x47,
-	0xF1,0x47,0xF1,0x47,0xF1,0x47,0xED,0x35,0x00,0x00,0x00,0x00,0x81,0x00,0x08,0x24,0x6A,0x2C,0x6E,0x3E,0xEB,0x2C,0xED,0x35,0x85,0x12,0x00,0x00,0xF1,0x47,0xEF,0x3E,0xED,0x35,0xED,0x35,0xED,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x12,0xF1,0x47,0x00,0x00,0x00,0x00,0xED,0x35,0xED,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x04,0x12,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x83,0x09,0xF1,0x47,0x08,0x24,0x6A,0x2C,0xF1,0x47,0x08,0x24,0x00,0x00,0x81,0x00,0x04,0x12,0x87,0x1B,0xF1,0x47,0x04,0x12,0x04,0x12,0x6E,0x3E,0x6E,0x3E,0x04,0x12,0x04,0x12,0x04,0x12,0x04,0x12,0x04,0x12,0x81,0x00,0x00,0x00,0x81,0x00,
-	0xEF,0x3E,0xEF,0x3E,0xEF,0x3E,0x08,0x24,0x81,0x00,0x87,0x1B,0xF1,0x47,0x00,0x00,0x04,0x12,0xF1,0x47,0x00,0x00,0x00,0x00,0x04,0x12,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x04,0x12,0x04,0x12,0x70,0x47,0x08,0x24,0xED,0x35,0xEB,0x2C,0xED,0x35,
-	0x6A,0x2C,0xEF,0x3E,0xF1,0x47,0x04,0x12,0x04,0x12,0xF1,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x09,0x83,0x09,0x00,0x00,0x08,0x24,0xED,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x00,0x00,0x00,0x00,0x04,0x12,0x08,0x24,0x81,0x00,0xED,0x35,0x06,0x1B,0x00,0x00,0x83,0x09,0xF1,0x47,0xED,0x35,0x6A,0x2C,
-	0x08,0x24,0xED,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x6E,0x3E,0x6C,0x35,0x00,0x00,0x08,0x24,0xED,0x35,0x00,0x00,0x00,0x00,0x06,0x1B,0xEF,0x3E,0x00,0x00,0x00,0x00,0x04,0x12,0x08,0x24,0xEB,0x2C,0xF1,0x47,0x08,0x24,0x08,0x24,0x06,0x1B,0x83,0x09,0x04,0x12,0x70,0x47,0x6C,0x35,0x6A,0x2C,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEB,0x2C,0x70,0x47,0x02,0x09,0x00,0x00,0x08,0x24,0xED,0x35,0x00,0x00,0x81,0x00,0xEF,0x3E,0xEB,0x2C,0x00,0x00,0x00,0x00,0x06,0x1B,0xED,0x35,0xF1,0x47,0x6E,0x3E,0xED,0x35,0xEF,0x3E,0xED,0x35,0x00,0x00,0x00,0x00,0xEF,0x3E,0xF1,0x47,0x83,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x35,0x70,0x47,0x83,0x09,
-	0x00,0x00,0x00,0x00,0x08,0x24,0xED,0x35,0x81,0x00,0x6E,0x3E,0x70,0x47,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x1B,0x70,0x47,0x81,0x00,0x81,0x00,0xEF,0x3E,0x06,0x1B,0x00,0x00,0x00,0x00,0x6A,0x2C,0xF1,0x47,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x09,0x83,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x12,
-	0xEF,0x3E,0x70,0x47,0x83,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x1B,0xEF,0x3E,0xEF,0x3E,0xEF,0x3E,0x6E,0x3E,0x00,0x00,0x00,0x00,0x83,0x09,0xF1,0x47,0xEF,0x3E,0x6C,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x04,0x12,0x08,0x24,0x6E,0x3E,0xF1,0x47,0xED,0x35,0x81,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x12,0x6C,0x35,0xF1,0x47,0xEF,0x3E,0xF1,0x47,0xEB,0x2C,0x04,0x12,0x70,0x47,0x6A,0x2C,0x83,0x09,0x70,0x47,0xEB,0x2C,0x00,0x00,0x00,0x00,0x85,0x12,0xF1,0x47,0xF1,0x47,0xF1,0x47,0x70,0x47,0xEB,0x2C,0x04,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x24,0xF1,0x47,
-	0xEB,0x2C,0x04,0x12,0x00,0x00,0x04,0x12,0x06,0x1B,0xED,0x35,0xEB,0x2C,0x00,0x00,0x00,0x00,0x83,0x09,0xEF,0x3E,0x81,0x00,0x00,0x00,0x00,0x00,0x04,0x12,0x04,0x12,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_12_23666_data_0, "face_174_dial_img_12_23666_data_0.bin");
         
 
 
@@ -44,7 +21,7 @@ const lv_img_dsc_t face_174_dial_img_12_23666_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 28,
     .header.h = 14,
-    .data_size = sizeof(face_174_dial_img_12_23666_data_0),
+    .data_size = 1176,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_12_23666_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 174
 
 #include "../174.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,17 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x75,0xAD,0x7D,0xEF,0x79,0xCE,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x7D,0xEF,0x7D,0xEF,0x71,0x8C,0x75,0xAD,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x75,0xAD,0xFF,0xFF,0x86,0x31,0x00,0x00,
-	0x00,0x00,0x10,0x84,0xFF,0xFF,0x08,0x42,0x82,0x10,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0xF3,0x9C,0x08,0x42,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0x79,0xCE,0x08,0x42,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x08,0x42,
-	0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x08,0x42,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0x79,0xCE,0x82,0x10,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x75,0xAD,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,
-	0x10,0x84,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x86,0x31,0x7D,0xEF,0xFB,0xDE,0x10,0x84,0xF3,0x9C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x75,0xAD,0xFF,0xFF,0x7D,0xEF,0x71,0x8C,0x82,0x10,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_0, "face_174_dial_img_14_3087_data_0.bin");
         
 
 
@@ -30,23 +21,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_0),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x7D,0xEF,0xFB,0xDE,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x71,0x8C,0x82,0x10,0xF7,0xBD,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_1, "face_174_dial_img_14_3087_data_1.bin");
         
 
 
@@ -54,23 +35,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_1),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xF3,0x9C,0xFB,0xDE,0xFB,0xDE,0xF3,0x9C,0x04,0x21,0x00,0x00,0x00,0x00,0x86,0x31,0x7D,0xEF,0x7D,0xEF,0xF3,0x9C,0xF3,0x9C,0x7D,0xEF,0x7D,0xEF,0x04,0x21,0x00,0x00,0x75,0xAD,0xFF,0xFF,0x86,0x31,0x00,0x00,
-	0x00,0x00,0x08,0x42,0xFF,0xFF,0x71,0x8C,0x00,0x00,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x10,0x84,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0xFF,0xFF,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x7D,0xEF,0x7D,0xEF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0x79,0xCE,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0xFF,0xFF,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x71,0x8C,0x82,0x10,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x71,0x8C,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_2, "face_174_dial_img_14_3087_data_2.bin");
         
 
 
@@ -78,23 +49,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_2),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x75,0xAD,0xFB,0xDE,0xFB,0xDE,0x75,0xAD,0x86,0x31,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x7D,0xEF,0xF3,0x9C,0xF3,0x9C,0x7D,0xEF,0xFF,0xFF,0x86,0x31,0x00,0x00,0xFB,0xDE,0x7D,0xEF,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x08,0x42,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x7D,0xEF,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x10,0x84,0xFB,0xDE,0x7D,0xEF,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x7D,0xEF,0x79,0xCE,0x86,0x31,0xF7,0xBD,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x82,0x10,0xFF,0xFF,0xFB,0xDE,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x86,0x31,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x10,0x84,0xFF,0xFF,0xFB,0xDE,0x10,0x84,0x71,0x8C,0x7D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x86,0x31,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_3, "face_174_dial_img_14_3087_data_3.bin");
         
 
 
@@ -102,23 +63,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_3),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xF7,0xBD,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFB,0xDE,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,
-	0x79,0xCE,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x7D,0xEF,0x86,0x31,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x8A,0x52,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x04,0x21,0x7D,0xEF,0x71,0x8C,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,
-	0x79,0xCE,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x71,0x8C,0x7D,0xEF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x31,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,
-	0xFF,0xFF,0xF3,0x9C,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x0C,0x63,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_4, "face_174_dial_img_14_3087_data_4.bin");
         
 
 
@@ -126,23 +77,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_4),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x0C,0x63,0x00,0x00,0x71,0x8C,0xFF,0xFF,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x0C,0x63,0x00,0x00,0xF7,0xBD,0xFB,0xDE,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0x75,0xAD,0x10,0x84,0xF7,0xBD,0xFB,0xDE,0x75,0xAD,0x86,0x31,0x00,0x00,0x00,0x00,0xFF,0xFF,0x7D,0xEF,0x79,0xCE,0x10,0x84,0xF3,0x9C,0x7D,0xEF,0x7D,0xEF,0x86,0x31,0x00,0x00,
-	0xF7,0xBD,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFB,0xDE,0x04,0x21,0x10,0x84,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x7D,0xEF,0x04,0x21,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x08,0x42,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x71,0x8C,0xFF,0xFF,0xF7,0xBD,0x10,0x84,0xF3,0x9C,0xFF,0xFF,0x7D,0xEF,0x04,0x21,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,0xFF,0xFF,0x7D,0xEF,0xF3,0x9C,0x04,0x21,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_5, "face_174_dial_img_14_3087_data_5.bin");
         
 
 
@@ -150,23 +91,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_5),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xF3,0x9C,0xFB,0xDE,0xFB,0xDE,0x75,0xAD,0x86,0x31,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0x7D,0xEF,0x71,0x8C,0x71,0x8C,0x7D,0xEF,0x7D,0xEF,0x04,0x21,0x00,0x00,0x10,0x84,0xFF,0xFF,0x86,0x31,0x00,0x00,
-	0x00,0x00,0x08,0x42,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x7D,0xEF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x86,0x31,0x86,0x31,0xFF,0xFF,0x10,0x84,0x8A,0x52,0xF7,0xBD,0xF7,0xBD,0xF3,0x9C,0x04,0x21,0x00,0x00,0x08,0x42,0xFF,0xFF,0x75,0xAD,0x7D,0xEF,0x75,0xAD,0xF7,0xBD,0xFF,0xFF,0x7D,0xEF,0x86,0x31,0x08,0x42,
-	0xFF,0xFF,0x7D,0xEF,0x04,0x21,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x75,0xAD,0x08,0x42,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x7D,0xEF,0x82,0x10,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x7D,0xEF,0x00,0x00,0xF7,0xBD,0xFB,0xDE,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x86,0x31,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x86,0x31,0xFF,0xFF,0xFB,0xDE,0x10,0x84,0x71,0x8C,0x7D,0xEF,0x7D,0xEF,0x86,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x86,0x31,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_6, "face_174_dial_img_14_3087_data_6.bin");
         
 
 
@@ -174,23 +105,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_6),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x71,0x8C,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0C,0x63,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x7D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x10,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xF7,0xBD,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_7, "face_174_dial_img_14_3087_data_7.bin");
         
 
 
@@ -198,23 +119,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_7),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xF7,0xBD,0x7D,0xEF,0x79,0xCE,0xF3,0x9C,0x04,0x21,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xF7,0xBD,0x10,0x84,0x71,0x8C,0x7D,0xEF,0x7D,0xEF,0x04,0x21,0x00,0x00,0x7D,0xEF,0xF7,0xBD,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x86,0x31,0xFF,0xFF,0x71,0x8C,0x00,0x00,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x75,0xAD,0x00,0x00,0xF7,0xBD,0xFB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x82,0x10,0x79,0xCE,0xFF,0xFF,0xFB,0xDE,0x7D,0xEF,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,0x10,0x84,0x10,0x84,0xFB,0xDE,0x7D,0xEF,0x86,0x31,0x08,0x42,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFB,0xDE,0xFB,0xDE,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x8A,0x52,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xFB,0xDE,0x7D,0xEF,0x00,0x00,0x79,0xCE,0xFF,0xFF,0xF3,0x9C,0x10,0x84,0x10,0x84,0xFB,0xDE,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x82,0x10,0x10,0x84,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x8A,0x52,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_8, "face_174_dial_img_14_3087_data_8.bin");
         
 
 
@@ -222,23 +133,13 @@ const lv_img_dsc_t face_174_dial_img_14_3087_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_8),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_14_3087_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xF7,0xBD,0x7D,0xEF,0x79,0xCE,0x10,0x84,0x82,0x10,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFB,0xDE,0x10,0x84,0xF3,0x9C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x82,0x10,0x7D,0xEF,0x79,0xCE,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x8E,0x73,0xFF,0xFF,0x0C,0x63,0x08,0x42,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x75,0xAD,0x08,0x42,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFB,0xDE,0x04,0x21,0xFF,0xFF,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x71,0x8C,0xFF,0xFF,0xFB,0xDE,0x10,0x84,0xF3,0x9C,0x7D,0xEF,0xFB,0xDE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x0C,0x63,0xF7,0xBD,0xF7,0xBD,0x75,0xAD,0x86,0x31,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x7D,0xEF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x10,0x84,0xFF,0xFF,0x86,0x31,0x00,0x00,0x71,0x8C,0xFF,0xFF,0xF7,0xBD,0x10,0x84,0xF3,0x9C,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFB,0xDE,0xFF,0xFF,0xFB,0xDE,0x10,0x84,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_14_3087_data_9, "face_174_dial_img_14_3087_data_9.bin");
         
 
 
@@ -246,7 +147,7 @@ const lv_img_dsc_t face_174_dial_img_14_3087_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 9,
     .header.h = 13,
-    .data_size = sizeof(face_174_dial_img_14_3087_data_9),
+    .data_size = 351,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_14_3087_data_9};
 
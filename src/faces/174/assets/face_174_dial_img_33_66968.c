@@ -5,6 +5,7 @@
 // Watchface: 174
 
 #include "../174.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,248 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x08,0x42,0x8E,0x73,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x8E,0x73,0x08,0x42,
-	0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x8A,0x52,0x92,0x94,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x10,0x84,
-	0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x96,0xB5,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xBA,0xD6,0xB6,0xB5,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0xB6,0xB5,0xBA,0xD6,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x10,0x84,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0C,0x63,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xF3,0x9C,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xB6,0xB5,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,
-	0x5D,0xEF,0xF3,0x9C,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x1C,0xE7,0xFF,0xFF,0xBE,0xF7,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x38,0xC6,0xFF,0xFF,0xBE,0xF7,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x1C,0xE7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,
-	0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x5D,0xEF,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x10,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x92,0x8C,0x55,0xAD,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,
-	0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x38,0xC6,0x10,0x84,0xFF,0xFF,
-	0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x28,0x42,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,
-	0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x92,0x94,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x92,0x94,0x00,0x00,0x86,0x31,0xFF,0xFF,0x1C,0xE7,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,
-	0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x86,0x31,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,
-	0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x28,0x42,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,
-	0xFF,0xFF,0x04,0x21,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x79,0xCE,
-	0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,
-	0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x92,0x94,0x00,0x00,0x86,0x31,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,
-	0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x86,0x31,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x28,0x42,0x00,0x00,
-	0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x92,0x94,0x00,0x00,0x86,0x31,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,
-	0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,
-	0xFF,0xFF,0x04,0x21,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x24,0x21,0xFF,0xFF,
-	0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x10,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xAE,0x73,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x92,0x8C,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x0C,0x63,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xBA,0xD6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,
-	0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x1C,0xE7,0xFF,0xFF,
-	0xBE,0xF7,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xF3,0x9C,0xE8,0x39,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x18,0xC6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x55,0xAD,0xAE,0x73,0x8A,0x4A,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x92,0x8C,0x18,0xC6,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xB5,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x96,0xB5,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x92,0x94,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x28,0x42,0x10,0x84,0x18,0xC6,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x79,0xCE,0x14,0xA5,0x0C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_0, "face_174_dial_img_33_66968_data_0.bin");
         
 
 
@@ -261,254 +21,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_0),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x5D,0xEF,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,
-	0xFF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x38,0xC6,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x28,0x42,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x55,0xAD,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x8E,0x73,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,
-	0xBE,0xF7,0x18,0xC6,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x8E,0x73,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x55,0xAD,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x96,0xB5,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x18,0xC6,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x18,0xC6,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x18,0xC6,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xB6,0xB5,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0xF3,0x9C,0xAE,0x73,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,
-	0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x8E,0x73,0x10,0x84,0x10,0x84,
-	0x10,0x84,0x10,0x84,0x92,0x94,0x18,0xC6,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,
-	0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,
-	0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,
-	0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,
-	0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,
-	0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_1, "face_174_dial_img_33_66968_data_1.bin");
         
 
 
@@ -516,254 +35,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_1),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x28,0x42,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x28,0x42,0x08,0x42,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x92,0x94,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x14,0xA5,0x0C,0x63,0x24,0x21,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x14,0xA5,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xBA,0xD6,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0xBA,0xD6,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x96,0xB5,0x8A,0x52,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0x14,0xA5,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xF3,0x9C,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x92,0x8C,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xB5,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,
-	0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xF3,0x9C,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x38,0xC6,0xFF,0xFF,0xBE,0xF7,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xBE,0xF7,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x38,0xC6,0xFF,0xFF,0x1C,0xE7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x1C,0xE7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xBA,0xD6,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,
-	0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xBA,0xD6,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,
-	0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xE8,0x39,0x92,0x8C,0x55,0xAD,0xF3,0x9C,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xBE,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x96,0xB5,0x10,0x84,0x34,0xA5,0xFF,0xFF,0x18,0xC6,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA6,0x31,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,
-	0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,
-	0xFF,0xFF,0x86,0x31,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x14,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0xA6,0x31,0xFF,0xFF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x28,0x42,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x8E,0x73,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,
-	0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0x3C,0xE7,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x65,0x29,
-	0x96,0xB5,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0x5D,0xEF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,
-	0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x3C,0xE7,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x3C,0xE7,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,
-	0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xBE,0xF7,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0x5D,0xEF,0xE8,0x39,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0xBA,0xD6,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x3C,0xE7,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x5D,0xEF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x96,0xB5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x38,0xC6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,
-	0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xBE,0xF7,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x1C,0xE7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x5D,0xEF,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xB6,0xB5,0xFF,0xFF,0xBA,0xD6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xBA,0xD6,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xA6,0x31,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x96,0xB5,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xBE,0xF7,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x1C,0xE7,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x3C,0xE7,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x38,0xC6,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x1C,0xE7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,
-	0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xBE,0xF7,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,
-	0xFF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xBA,0xD6,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x1C,0xE7,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x38,0xC6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x3C,0xE7,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x38,0xC6,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x79,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,
-	0x1C,0xE7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0xBE,0xF7,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,
-	0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x86,0x31,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x96,0xB5,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_2, "face_174_dial_img_33_66968_data_2.bin");
         
 
 
@@ -771,254 +49,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_2),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x08,0x42,0x8A,0x52,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x8A,0x52,0x08,0x42,
-	0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0x14,0xA5,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x14,0xA5,
-	0x0C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x8E,0x73,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xBA,0xD6,0x79,0xCE,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x79,0xCE,0xBA,0xD6,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x0C,0x63,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x10,0x84,
-	0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x18,0xC6,0x92,0x8C,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x92,0x8C,0x18,0xC6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x8A,0x52,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x10,0x84,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xBE,0xF7,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xBE,0xF7,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x3C,0xE7,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xBA,0xD6,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x3C,0xE7,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xFF,0xFF,0x8A,0x4A,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x55,0xAD,0x55,0xAD,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0xFF,0xFF,0x92,0x94,0x18,0xC6,0xFF,0xFF,
-	0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,
-	0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,
-	0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x10,0x84,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,
-	0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x34,0xA5,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x10,0x84,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,
-	0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x79,0xCE,
-	0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xB6,0xB5,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x5D,0xEF,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xBE,0xF7,0xFF,0xFF,0xB6,0xB5,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x8A,0x4A,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x0C,0x63,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x1C,0xE7,0xFF,0xFF,0xBE,0xF7,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x55,0xAD,0x55,0xAD,0xF3,0x9C,0xAE,0x73,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x28,0x42,0x10,0x84,0x10,0x84,0x92,0x94,0x18,0xC6,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,
-	0x08,0x42,0x20,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x20,0x00,0x00,0x00,
-	0x24,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x1C,0xE7,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0xBE,0xF7,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x86,0x31,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,
-	0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0xA2,0x10,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,
-	0x92,0x94,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x14,0xA5,0xFF,0xFF,
-	0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x20,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x10,0x84,0x96,0xB5,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0x55,0xAD,0xF3,0x9C,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xBA,0xD6,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x5D,0xEF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x3C,0xE7,0xFF,0xFF,
-	0xBA,0xD6,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x79,0xCE,0xFF,0xFF,
-	0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xBA,0xD6,0xFF,0xFF,0x5D,0xEF,0xAE,0x73,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xBE,0xF7,0xFF,0xFF,0x3C,0xE7,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x55,0xAD,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x96,0xB5,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x55,0xAD,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x55,0xAD,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x92,0x94,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xBA,0xD6,0x79,0xCE,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,
-	0x55,0xAD,0x55,0xAD,0x79,0xCE,0xBA,0xD6,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x14,0xA5,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x10,0x84,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x10,0x84,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x08,0x42,0x8A,0x52,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x8A,0x52,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_3, "face_174_dial_img_33_66968_data_3.bin");
         
 
 
@@ -1026,254 +63,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_3),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,
-	0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x5D,0xEF,
-	0xFF,0xFF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x14,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x8A,0x4A,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA6,0x31,0xFF,0xFF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,
-	0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xB6,0xB5,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,
-	0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x55,0xAD,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,
-	0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,
-	0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,
-	0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,
-	0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,
-	0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,
-	0xFF,0xFF,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x0C,0x63,0xFF,0xFF,0x5D,0xEF,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,
-	0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xE8,0x39,0xFF,0xFF,0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x28,0x42,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x92,0x8C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x0C,0x63,0x00,0x00,
-	0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,
-	0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x1C,0xE7,0x20,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xE8,0x39,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,
-	0x1C,0xE7,0xFF,0xFF,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF3,0x9C,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,
-	0x9E,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0C,0x63,0xFF,0xFF,0x18,0xC6,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x5D,0xEF,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,
-	0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x9E,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x2C,0x63,0xFF,0xFF,0x79,0xCE,0x10,0x84,0x10,0x84,0x10,0x84,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x96,0xB5,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x8E,0x73,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x92,0x8C,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,
-	0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_4, "face_174_dial_img_33_66968_data_4.bin");
         
 
 
@@ -1281,254 +77,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_4),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,
-	0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x3C,0xE7,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0x1C,0xE7,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x1C,0xE7,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,
-	0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xF7,0xBD,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,
-	0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xB2,0x94,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4D,0x6B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x28,0x42,0x96,0xB5,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x96,0xB5,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x59,0xCE,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0xB6,0xB5,0x55,0xAD,0x55,0xAD,0x55,0xAD,0xB6,0xB5,0xBA,0xD6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x18,0xC6,0x2C,0x63,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xB6,0xB5,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0x5D,0xEF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x55,0xAD,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,
-	0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x55,0xAD,0xF3,0x9C,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xDF,0xFF,0x96,0xB5,0x59,0xCE,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,
-	0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,
-	0xBE,0xF7,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0xF7,0xBD,
-	0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x18,0xC6,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0x28,0x42,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,
-	0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xF7,0xBD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x59,0xCE,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x92,0x8C,
-	0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x41,0x08,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,
-	0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,
-	0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xBA,0xD6,
-	0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x28,0x42,0xDF,0xFF,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,
-	0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0xBA,0xD6,0x7D,0xEF,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xAE,0x73,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xBA,0xD6,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xBE,0xF7,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xDB,0xDE,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xBE,0xF7,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xDF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0x1C,0xE7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x79,0xCE,0xFF,0xFF,0xDF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xDB,0xDE,
-	0xFF,0xFF,0x5D,0xEF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x5D,0xEF,
-	0xFF,0xFF,0x7D,0xEF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,
-	0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xC7,0x39,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x18,0xC6,0x2C,0x63,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x92,0x8C,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x59,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xB6,0xB5,0x92,0x8C,0x2C,0x63,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x10,0x84,0x55,0xAD,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x34,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x96,0xB5,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x59,0xCE,0x51,0x8C,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xB2,0x94,0xF7,0xBD,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFB,0xDE,0x59,0xCE,0x34,0xA5,0x4D,0x6B,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_5, "face_174_dial_img_33_66968_data_5.bin");
         
 
 
@@ -1536,254 +91,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_5),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0x4D,0x6B,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,
-	0xCF,0x7B,0x4D,0x6B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xD3,0x9C,0x59,0xCE,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,
-	0x59,0xCE,0xD3,0x9C,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x96,0xB5,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0xBA,0xD6,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x79,0xCE,0xBA,0xD6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,
-	0xD3,0x9C,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x4D,0x6B,0x59,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xB6,0xB5,0x10,0x84,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x10,0x84,0xB6,0xB5,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x51,0x8C,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,
-	0xBE,0xF7,0xB6,0xB5,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0x7D,0xEF,0xFF,0xFF,0xBE,0xF7,0x55,0xAD,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xBE,0xF7,0xFF,0xFF,0xDB,0xDE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x1C,0xE7,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x5D,0xEF,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xC6,0xFF,0xFF,0xBE,0xF7,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,
-	0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x7D,0xEF,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x3C,0xE7,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,
-	0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xDF,0xFF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0x55,0xAD,0xF3,0x9C,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,
-	0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xDB,0xDE,0x34,0xA5,0x18,0xC6,
-	0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,
-	0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,
-	0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,
-	0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x18,0xC6,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x65,0x29,0xCF,0x7B,0x34,0xA5,0x59,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xF7,0xBD,0xB2,0x94,0xCB,0x5A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0xD3,0x9C,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xF7,0xBD,0x28,0x42,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x79,0xCE,0x55,0xAD,0x10,0x84,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x92,0x8C,0xB6,0xB5,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x55,0xAD,0xFF,0xFF,0xBE,0xF7,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0x1C,0xE7,0xFF,0xFF,0xDB,0xDE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0x1C,0xE7,0x2C,0x63,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x1C,0xE7,0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x1C,0xE7,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x18,0xC6,0xBA,0xD6,0x18,0xC6,
-	0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,
-	0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x34,0xA5,0x4D,0x6B,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x65,0x29,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,
-	0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,
-	0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,
-	0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x30,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,
-	0xFF,0xFF,0xAA,0x52,0x00,0x00,0x65,0x29,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xD3,0x9C,
-	0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x28,0x42,0x3C,0xE7,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,
-	0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xBA,0xD6,0xDF,0xFF,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xAE,0x73,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xAE,0x73,0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x34,0xA5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xBE,0xF7,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xBE,0xF7,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,
-	0xFF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xBA,0xD6,
-	0xFF,0xFF,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,
-	0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xCF,0x7B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x2C,0x63,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBD,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xF7,0xBD,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xB6,0xB5,0x92,0x8C,0xAE,0x73,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xAE,0x73,0x55,0xAD,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xF7,0xBD,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x96,0xB5,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xD3,0x9C,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xB2,0x94,0xF7,0xBD,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0x34,0xA5,0xCF,0x7B,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_6, "face_174_dial_img_33_66968_data_6.bin");
         
 
 
@@ -1791,254 +105,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_6),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,
-	0x4D,0x6B,0x4D,0x6B,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x5D,0xEF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x5D,0xEF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x30,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xCF,0x7B,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,
-	0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x59,0xCE,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xF7,0xBD,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x34,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xDF,0xFF,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,
-	0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,
-	0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x7D,0xEF,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x5D,0xEF,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,
-	0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x7D,0xEF,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0xCF,0x7B,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x18,0xC6,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xDF,0xFF,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,
-	0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x5D,0xEF,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,
-	0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,
-	0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x59,0xCE,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x59,0xCE,
-	0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_7, "face_174_dial_img_33_66968_data_7.bin");
         
 
 
@@ -2046,254 +119,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_7),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xCF,0x7B,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,
-	0x4D,0x6B,0x4D,0x6B,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x34,0xA5,0xBA,0xD6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,
-	0xF7,0xBD,0x51,0x8C,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xF7,0xBD,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0x79,0xCE,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0xB6,0xB5,0xBA,0xD6,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,
-	0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x4D,0x6B,0x59,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x55,0xAD,0xAE,0x73,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x92,0x8C,0x18,0xC6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x4D,0x6B,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,
-	0x55,0xAD,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x3C,0xE7,0xFF,0xFF,0xBE,0xF7,0x55,0xAD,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x3C,0xE7,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC7,0x39,0x7D,0xEF,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,
-	0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xF3,0x9C,0x55,0xAD,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,
-	0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x59,0xCE,0x34,0xA5,0xFF,0xFF,
-	0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,
-	0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,
-	0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,
-	0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x65,0x29,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,
-	0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xAE,0x73,
-	0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x1C,0xE7,0xFF,0xFF,0xDF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x8A,0x4A,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0x3C,0xE7,0xFF,0xFF,0xBE,0xF7,
-	0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0x96,0xB5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xBE,0xF7,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xDF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,
-	0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xBE,0xF7,0xFF,0xFF,0xBA,0xD6,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xE8,0x39,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0x59,0xCE,
-	0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xD3,0x9C,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x28,0x42,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x30,0x84,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,
-	0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,
-	0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,
-	0x5D,0xEF,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x65,0x29,0xFF,0xFF,
-	0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,
-	0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0xDF,0xFF,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xAE,0x73,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x59,0xCE,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xBE,0xF7,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xDB,0xDE,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xDF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x28,0x42,0xDF,0xFF,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x1C,0xE7,0xFF,0xFF,0xDF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,
-	0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xBE,0xF7,
-	0xFF,0xFF,0xDB,0xDE,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x8A,0x4A,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x2C,0x63,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xF3,0x9C,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xF7,0xBD,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xB6,0xB5,0x10,0x84,0x2C,0x63,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x92,0x8C,0xB6,0xB5,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x96,0xB5,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xF7,0xBD,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xD3,0x9C,0x59,0xCE,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBA,0xD6,0xF7,0xBD,0xB2,0x94,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_8, "face_174_dial_img_33_66968_data_8.bin");
         
 
 
@@ -2301,254 +133,13 @@ const lv_img_dsc_t face_174_dial_img_33_66968_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_8),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_33_66968_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x4D,0x6B,0x4D,0x6B,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x30,0x84,
-	0x4D,0x6B,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x51,0x8C,0xF7,0xBD,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,
-	0x96,0xB5,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xD3,0x9C,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xBA,0xD6,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x55,0xAD,0x18,0xC6,0xBA,0xD6,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xF7,0xBD,
-	0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x28,0x42,0xF7,0xBD,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x18,0xC6,0x92,0x8C,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xF3,0x9C,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x18,0xC6,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xB6,0xB5,0xBE,0xF7,0xFF,0xFF,0x3C,0xE7,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xDF,0xFF,0xFF,0xFF,0x5D,0xEF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xDF,0xFF,0xFF,0xFF,0x18,0xC6,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xDF,0xFF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xDF,0xFF,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC7,0x39,0x7D,0xEF,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,
-	0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0xBE,0xF7,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x3C,0xE7,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,
-	0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x55,0xAD,0xF3,0x9C,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x18,0xC6,
-	0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,
-	0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,
-	0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,
-	0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,
-	0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,
-	0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,
-	0xFF,0xFF,0x34,0xA5,0x00,0x00,0x51,0x8C,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x59,0xCE,0x96,0xB5,0xDF,0xFF,
-	0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,
-	0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xF3,0x9C,0x55,0xAD,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,
-	0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0xFF,0xFF,0x5D,0xEF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,
-	0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x28,0x42,0xDF,0xFF,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x18,0xC6,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xDF,0xFF,
-	0xFF,0xFF,0x1C,0xE7,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,
-	0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x10,0x84,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0xB6,0xB5,
-	0x55,0xAD,0x55,0xAD,0x55,0xAD,0x18,0xC6,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x34,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x34,0xA5,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xD3,0x9C,0x41,0x08,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xB2,0x94,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x30,0x84,0x4D,0x6B,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x8A,0x4A,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xF3,0x9C,0xFF,0xFF,0x96,0xB5,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xB6,0xB5,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xF3,0x9C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,
-	0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBE,0xF7,
-	0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x55,0xAD,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xAA,0x52,
-	0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x1C,0xE7,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,
-	0xFF,0xFF,0x55,0xAD,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBA,0xD6,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x8C,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0xBE,0xF7,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0x55,0xAD,0x55,0xAD,0x8A,0x4A,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x18,0xC6,0xFF,0xFF,0x59,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xE8,0x39,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xFF,0xFF,0xDF,0xFF,0x28,0x42,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0x10,0x84,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x5D,0xEF,0xFF,0xFF,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0x79,0xCE,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xBA,0xD6,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x7D,0xEF,0xFF,0xFF,0x2C,0x63,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0x3C,0xE7,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0x1C,0xE7,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x18,0xC6,0xFF,0xFF,0xDF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xDB,0xDE,0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x8A,0x4A,0x1C,0xE7,0xFF,0xFF,0xDF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xDF,0xFF,
-	0xFF,0xFF,0x18,0xC6,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x92,0x8C,0xBE,0xF7,
-	0xFF,0xFF,0xDB,0xDE,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xDF,0xFF,0xFF,0xFF,0x1C,0xE7,0x8A,0x4A,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xAE,0x73,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x8A,0x4A,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE8,0x39,0x92,0x8C,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xF7,0xBD,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xF3,0x9C,0xAE,0x73,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0x2C,0x63,0xF3,0x9C,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x34,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xF7,0xBD,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xBA,0xD6,0x18,0xC6,0x55,0xAD,0x55,0xAD,0x55,0xAD,
-	0x55,0xAD,0x55,0xAD,0xB6,0xB5,0xBA,0xD6,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x59,0xCE,0x51,0x8C,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0x96,0xB5,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x96,0xB5,0xCF,0x7B,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x4D,0x6B,0x30,0x84,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4D,0x6B,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_33_66968_data_9, "face_174_dial_img_33_66968_data_9.bin");
         
 
 
@@ -2556,7 +147,7 @@ const lv_img_dsc_t face_174_dial_img_33_66968_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 84,
-    .data_size = sizeof(face_174_dial_img_33_66968_data_9),
+    .data_size = 15120,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_33_66968_data_9};
 
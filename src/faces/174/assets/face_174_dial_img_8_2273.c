@@ -5,6 +5,7 @@
 // Watchface: 174
 
 #include "../174.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,34 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_174_dial_img_8_2273_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x59,0xC1,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x41,0xBA,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x38,0x00,0x00,0x00,0x00,0x20,0x10,0x60,0x69,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x60,0x18,0x22,0xFB,0x81,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xAA,0x21,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x59,0xA1,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x28,0x22,0xFB,0xC0,0x38,0x00,0x00,0x60,0x18,0x22,0xFB,
-	0xC0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x79,0x22,0xFB,0x80,0x28,0x00,0x00,0x00,0x00,0xE1,0xEA,0xA1,0xDA,0x41,0xBA,0x41,0xBA,0x41,0xBA,0x41,0xBA,0x41,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xCA,0x81,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x81,0xCA,0x41,0xBA,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE1,0x99,0xA1,0xDA,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xBA,0xA1,0xDA,0x00,0x00,0xE0,0x48,0x22,0xFB,0xC1,0x89,0x81,0x79,0x81,0x79,0x81,0x79,0x41,0xBA,0xA1,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x28,0x22,0xFB,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x99,0xE1,0xEA,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE1,0xEA,0xE1,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x18,0x20,0x59,0x00,0x00,0x41,0xBA,0x41,0xBA,0x00,0x00,0x81,0x79,0xC0,0x38,0x00,0x00,0x81,0xCA,0xC1,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x89,0x41,0xBA,0x00,0x00,0x00,0x00,0x20,0x10,0x21,0xAA,0xE1,0xEA,
-	0x80,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x28,0xE1,0xEA,0x21,0xAA,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x59,0x22,0xFB,0xC0,0x38,0x00,0x00,0x22,0xFB,0x20,0x59,0x60,0x18,0x22,0xFB,0xC0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0xEA,0x20,0x59,0x00,0x00,0x00,0x00,0x41,0xBA,
-	0xA1,0xDA,0x60,0x69,0xC0,0x38,0xC0,0x38,0xC0,0x38,0xC0,0x38,0xC0,0x38,0xC0,0x38,0xC0,0x38,0x20,0x59,0xE1,0xEA,0x21,0xAA,0x00,0x00,0x00,0x00,0x20,0x10,0xE0,0x48,0x00,0x00,0xE0,0x48,0x00,0x00,0x00,0x00,0x22,0xFB,0xC0,0x38,0xC0,0x38,0x21,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x48,0xE1,0xEA,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x80,0x28,0x20,0x10,0x22,0xFB,0x22,0xFB,0x22,0xFB,0x22,0xFB,0x22,0xFB,0x22,0xFB,0x22,0xFB,0x22,0xFB,0x41,0xBA,0x20,0x10,0x20,0x10,0x00,0x00,0x00,0x00,0x20,0x59,0x22,0xFB,0x20,0x10,0x00,0x00,0x00,0x00,0xC0,0x38,0x22,0xFB,0x81,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xAA,0xE1,0x99,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x69,0xA1,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x79,0x41,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xCA,0x21,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x89,0x22,0xFB,0xE1,0xEA,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0x22,0xFB,0x80,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xCA,0xE1,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x99,0x41,0xBA,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x28,0x22,0xFB,0x20,0x59,0x00,0x00,0x00,0x00,0x20,0x10,0xE1,0xEA,0xE1,0x99,0xA1,0xDA,0x21,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x69,0xA1,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x38,0x22,0xFB,0x80,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xBA,0x81,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x99,0xE1,0xEA,0x00,0x00,0x00,0x00,0x20,0x10,0x21,0xAA,0xE1,0xEA,0x60,0x18,0xC0,0x38,0x22,0xFB,0xE1,0x99,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0xDA,0x60,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x28,0xE1,0xEA,0x21,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0xDA,0x60,0x69,0x00,0x00,0x00,0x00,0x20,0x10,0x22,0xFB,0x81,0x79,0x00,0x00,0x60,0x18,0x81,0xCA,0x22,0xFB,0x20,0x59,0x00,0x00,0x00,0x00,
-	0x20,0x59,0x22,0xFB,0xE1,0x99,0x20,0x10,0x80,0x28,0x22,0xFB,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x48,0xE1,0xEA,0x81,0xCA,0x20,0x10,0x80,0x28,0xC0,0x38,0xC0,0x38,0x60,0x69,0x22,0xFB,0x80,0x28,0x00,0x00,0x00,0x00,0x20,0x10,0xE1,0x99,0x60,0x18,0x00,0x00,0x21,0xAA,0xA1,0xDA,0xC0,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x59,0xE1,0xEA,0x80,0x28,0xE1,0x99,0x21,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE1,0xEA,0xC1,0x89,0x20,0x10,0x00,0x00,0x21,0xAA,0x22,0xFB,0x22,0xFB,0x22,0xFB,0xC1,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x00,0x00,0x80,0x28,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_174_dial_img_8_2273_data_0, "face_174_dial_img_8_2273_data_0.bin");
         
 
 
@@ -47,7 +21,7 @@ const lv_img_dsc_t face_174_dial_img_8_2273_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 34,
     .header.h = 14,
-    .data_size = sizeof(face_174_dial_img_8_2273_data_0),
+    .data_size = 1428,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_174_dial_img_8_2273_data_0};
 
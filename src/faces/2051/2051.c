@@ -157,9 +157,10 @@ void init_face_2051(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_2051_8_102190, 179);
     lv_obj_add_flag(face_2051_8_102190, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_2051_8_102190, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_2051_0_184);
 
 
-    callback("2051", &face_2051_dial_img_preview_0, &face_2051, NULL);
+    callback("2051", NULL, &face_2051, NULL);
 
 #endif
 }
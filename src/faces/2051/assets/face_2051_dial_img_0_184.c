@@ -5,6 +5,7 @@
 // Watchface: 2051
 
 #include "../2051.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,2158 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_0_184_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0x21,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x10,0x21,0x10,0x61,0x18,0x62,0x18,0x62,0x18,0xA2,0x18,
-	0xA2,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x10,0x61,0x08,0x62,0x10,0xA2,0x18,0xA2,0x18,0x62,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0xA3,0x28,0xE3,0x28,0xA2,0x18,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x08,0x62,0x18,0xA2,0x20,0x61,0x10,0x62,0x18,0xA1,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x20,0x08,0xA2,0x28,
-	0xA3,0x20,0xA2,0x18,0xA1,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x21,0x08,0x65,0x39,0xE8,0x49,0xA3,0x20,0x20,0x00,0x20,0x08,0x60,0x08,0x60,0x08,0x21,0x10,0x62,0x20,0xA2,0x20,0x60,0x10,0x20,0x08,0x61,0x10,0xA2,0x18,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x21,0x10,0x20,0x10,0x65,0x39,0x49,0x5A,0xE4,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0xE2,0x20,0xA3,0x20,
-	0x20,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x62,0x20,0x62,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x20,0xA2,0x20,0x61,0x18,0xA3,0x20,0x24,0x29,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x18,0xA2,0x20,0x61,0x10,0x60,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0xA1,0x18,0x62,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA1,0x18,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x00,0x61,0x10,0xA2,0x20,0x62,0x18,0x00,0x00,
-	0x20,0x08,0x20,0x08,0x60,0x08,0x60,0x08,0x20,0x08,0x61,0x10,0xA1,0x18,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x10,0x60,0x18,0x62,0x18,0x61,0x18,0x62,0x20,0xA2,0x20,0xA2,0x20,0x61,0x20,0xA3,0x28,0xA3,0x28,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0xA1,0x18,0x62,0x18,0x61,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x61,0x18,0x62,0x20,0xA2,0x20,0xA2,0x28,0xA3,0x30,0xE3,0x38,0xA3,0x28,0x60,0x10,0x61,0x08,
-	0x60,0x08,0x60,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x62,0x10,0xA2,0x18,0x24,0x39,0x65,0x39,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x10,0x62,0x18,0x62,0x18,0x61,0x18,0x61,0x18,0x62,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x28,0xE4,0x30,0xE3,0x38,0x62,0x20,0xA3,0x28,0xA1,0x20,0x21,0x10,0x60,0x08,0x60,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x18,0x49,0x5A,0xEC,0x8A,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x62,0x18,0x61,0x18,0x62,0x18,0x62,0x18,0x61,0x18,0xA1,0x10,0x62,0x18,0x62,0x18,0xA3,0x28,0x24,0x39,0xA2,0x28,0xA2,0x28,0x66,0x51,0x65,0x49,
-	0xA1,0x20,0x20,0x10,0x20,0x10,0x20,0x10,0x60,0x08,0x60,0x10,0x61,0x10,0x61,0x10,0x21,0x10,0x20,0x10,0xE3,0x30,0x25,0x49,0x61,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x60,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x60,0x10,0x61,0x10,0xA3,0x28,0xA2,0x30,0xE3,0x38,0xA7,0x59,0xC7,0x69,0xE3,0x30,0x62,0x20,0x61,0x18,0x61,0x10,0x21,0x10,0x60,0x08,0x61,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0x61,0x28,0x65,0x69,0x66,0x69,0xE3,0x38,0x61,0x28,0x61,0x20,
-	0x60,0x10,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x20,0x61,0x20,0x61,0x18,0x61,0x20,0x61,0x18,0x61,0x18,0x21,0x18,0x61,0x18,0x21,0x18,0x61,0x18,0x62,0x20,0xA3,0x30,0xA2,0x28,0xE3,0x30,0x24,0x39,
-	0xA2,0x20,0xA1,0x20,0xA2,0x20,0x62,0x20,0xA1,0x18,0x61,0x20,0x20,0x10,0x20,0x10,0x60,0x10,0x60,0x20,0xA3,0x38,0xA9,0x92,0x4B,0xB3,0x07,0x8A,0x23,0x59,0x24,0x49,0xC1,0x40,0x61,0x20,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x20,0x61,0x20,0x61,0x18,0x62,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0xA3,0x28,0xA2,0x28,0x61,0x18,0x61,0x18,0x60,0x18,0x21,0x18,0x61,0x18,0x61,0x18,0x61,0x28,0xA2,0x20,0xA1,0x20,0x61,0x20,0x61,0x20,0x60,0x20,0xE2,0x38,0x4B,0xB3,0x51,0xE5,0xC8,0xC2,0xE4,0x48,0x65,0x69,
-	0x03,0x69,0x23,0x59,0xA2,0x30,0x21,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x10,0x61,0x18,0xA3,0x20,0xA2,0x20,0x20,0x10,
-	0x60,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x20,0xA2,0x28,0xA2,0x28,0xA1,0x28,0x61,0x28,0x61,0x20,0x61,0x20,0xA9,0x92,0x6E,0xD4,0x4B,0xB3,0xA3,0x30,0x62,0x20,0x23,0x59,0x03,0x69,0x65,0x69,0xA2,0x38,0x61,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x10,0xA3,0x28,0x61,0x18,0x61,0x18,0x61,0x18,0x62,0x20,0xA2,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0xA2,0x20,0xA2,0x20,0x62,0x20,0x21,0x18,0x66,0x51,0x4B,0xB3,0xEC,0x8A,0xA2,0x30,0x21,0x08,
-	0x62,0x20,0xC3,0x58,0x44,0x81,0x03,0x69,0x61,0x30,0x61,0x18,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x10,0xA2,0x20,0xA2,0x20,
-	0x21,0x18,0x61,0x18,0x61,0x10,0xA1,0x20,0xA1,0x20,0x61,0x20,0x61,0x18,0x21,0x18,0x61,0x18,0x62,0x20,0x62,0x18,0xA2,0x30,0x24,0x49,0x24,0x49,0x60,0x18,0x20,0x08,0x20,0x08,0x61,0x20,0x24,0x49,0x03,0x69,0xA2,0x38,0xA1,0x28,0xA1,0x18,0x61,0x10,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x60,0x08,
-	0x60,0x10,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0xA2,0x20,0x62,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x10,0x60,0x10,0x61,0x18,0x62,0x18,0x62,0x20,0x61,0x20,0x61,0x18,0x60,0x10,
-	0x60,0x10,0x60,0x18,0xA2,0x30,0x65,0x59,0xC3,0x58,0xA2,0x38,0x61,0x28,0xA1,0x20,0x61,0x20,0x20,0x10,0x20,0x00,0x20,0x08,0x23,0x39,0x24,0x41,0x61,0x18,0xA2,0x20,0xE2,0x28,0xE2,0x20,0x61,0x18,0x20,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x00,0x20,0x08,0x61,0x08,0x60,0x08,0x61,0x08,0x20,0x10,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x61,0x18,
-	0xA2,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x61,0x10,0x61,0x18,0x20,0x10,0x20,0x08,0x60,0x10,0x61,0x18,0x62,0x20,0xA2,0x20,0x62,0x20,0xA1,0x20,0x60,0x18,0xA1,0x20,0xE3,0x40,0x23,0x59,0x23,0x59,0xA2,0x38,0x61,0x20,0xA1,0x20,0xA1,0x20,0x21,0x10,0xA1,0x28,0x4B,0xB3,0x6E,0xD4,0xE7,0x79,0xE3,0x38,
-	0x24,0x39,0x23,0x39,0xE2,0x28,0x61,0x18,0x61,0x10,0xA2,0x18,0xE3,0x28,0xA2,0x20,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x61,0x10,0x62,0x18,0x61,0x10,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x10,0x60,0x10,0x21,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x62,0x18,0x61,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x61,0x18,0x60,0x10,0x20,0x08,0x20,0x10,0x61,0x10,0x61,0x18,0xA2,0x20,
-	0xA2,0x28,0xA2,0x28,0x61,0x18,0x61,0x20,0xA3,0x38,0x65,0x69,0x23,0x59,0xA2,0x38,0x60,0x20,0x61,0x20,0x61,0x20,0xE3,0x30,0x6E,0xD4,0xD3,0xF5,0x4B,0xB3,0x65,0x59,0x66,0x51,0x65,0x59,0x64,0x49,0x23,0x39,0xE2,0x30,0x24,0x39,0x65,0x49,0x24,0x41,0xE2,0x28,0xA1,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x10,0xA2,0x20,0xE3,0x28,0xE2,0x20,0xA2,0x18,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x61,0x10,0x21,0x08,0x61,0x10,0x61,0x08,0x60,0x08,
-	0x62,0x18,0xE3,0x28,0x61,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x10,0x21,0x18,0x61,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x61,0x18,0x61,0x20,0xA1,0x20,0x60,0x18,0x20,0x18,0xA3,0x38,0x65,0x69,0x65,0x69,0xE3,0x40,0xA1,0x28,0x61,0x20,0xA2,0x38,0x07,0x8A,0x8B,0xD3,0x47,0xAA,0x85,0x71,
-	0x85,0x71,0xE7,0x79,0x47,0x92,0x47,0x92,0x07,0x8A,0xE7,0x79,0xE7,0x79,0x07,0x8A,0x85,0x71,0xE3,0x30,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x60,0x10,0xE2,0x20,0xE3,0x30,0xE3,0x30,0xE3,0x30,0xE3,0x28,0xE2,0x20,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x61,0x18,0xE4,0x30,0xA3,0x28,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0xA1,0x18,0x49,0x5A,0xE2,0x30,0x21,0x10,0x20,0x08,0x00,0x00,
-	0x20,0x08,0x20,0x10,0x21,0x10,0xA2,0x18,0x62,0x20,0x60,0x20,0xA2,0x38,0x03,0x69,0x63,0x69,0x85,0x71,0x03,0x69,0xC1,0x40,0x03,0x69,0x44,0x81,0x47,0xAA,0xC8,0xC2,0xC9,0xAA,0x47,0xAA,0x8B,0xD3,0x4B,0xB3,0x8B,0xD3,0x8B,0xD3,0x4B,0xB3,0xC8,0xC2,0xC9,0xAA,0x24,0x49,0xA1,0x20,0x61,0x18,0x61,0x18,0x60,0x10,0xA1,0x20,0xA1,0x28,
-	0xA2,0x28,0x24,0x39,0xE3,0x38,0x23,0x39,0xE3,0x38,0xE3,0x38,0xE3,0x30,0xA2,0x18,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0xA2,0x18,0xA3,0x28,0x61,0x18,0x61,0x10,0xA1,0x18,0x61,0x10,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0xE2,0x20,0xAE,0x93,0xA2,0x20,0x61,0x10,0x62,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0x62,0x20,0xC3,0x58,0xE7,0x79,0xC3,0x58,0xC8,0xC2,0xC9,0xAA,0x44,0x81,0x03,0x69,0x44,0x81,0x8B,0xD3,0xD3,0xF5,
-	0x6E,0xD4,0x8B,0xD3,0x8B,0xD3,0x8B,0xD3,0x8B,0xD3,0x51,0xE5,0x6E,0xD4,0x8B,0xD3,0xC8,0xC2,0x85,0x71,0xA3,0x38,0xE3,0x40,0xC3,0x58,0x23,0x59,0x03,0x69,0x23,0x59,0x65,0x59,0x65,0x69,0x65,0x59,0x65,0x59,0x24,0x49,0x24,0x49,0x24,0x49,0xE3,0x38,0xE3,0x38,0xE3,0x30,0xA1,0x20,0x60,0x10,0x20,0x10,0x60,0x10,0x20,0x10,0x21,0x18,
-	0x60,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0xA2,0x20,0xA2,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x18,0x61,0x18,0x61,0x18,0x60,0x08,0x00,0x00,0x20,0x08,0x61,0x10,0x00,0x00,0x20,0x00,0x20,0x08,0x62,0x18,
-	0x61,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x18,0x69,0x72,0xEE,0xBB,0xC3,0x58,0xA5,0x99,0x47,0xAA,0x44,0x81,0xA5,0x99,0xA5,0x99,0x8B,0xD3,0xD3,0xF5,0xD3,0xF5,0x51,0xE5,0x6E,0xD4,0xC8,0xC2,0x8B,0xD3,0x6E,0xD4,0x8B,0xD3,0x8B,0xD3,0xC8,0xC2,0xA5,0x99,0xC3,0x58,0xC4,0x79,0x47,0xAA,0x8B,0xD3,0x4B,0xB3,0x47,0xAA,
-	0x47,0x92,0x47,0x92,0x85,0x71,0x65,0x69,0x85,0x71,0x85,0x71,0x65,0x69,0xA5,0x69,0xA5,0x69,0x65,0x59,0x24,0x49,0xE2,0x28,0x20,0x10,0x20,0x10,0x60,0x10,0x60,0x18,0x21,0x18,0x60,0x18,0x60,0x10,0x60,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x10,0xA2,0x20,0xA2,0x20,
-	0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x08,0x61,0x10,0x61,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x20,0x08,0xA3,0x30,0x65,0x69,0xC3,0x58,0x44,0x81,0xA5,0x99,0xA5,0x99,0xA5,0x99,0xA5,0x99,0xC8,0xC2,0x8B,0xD3,
-	0x8B,0xD3,0x8B,0xD3,0x8B,0xD3,0xC8,0xC2,0xC8,0xC2,0xC8,0xC2,0x8B,0xD3,0x6E,0xD4,0xC8,0xC2,0x44,0x81,0x44,0x81,0x47,0xAA,0x6E,0xD4,0x51,0xE5,0x51,0xE5,0xC8,0xC2,0x47,0xAA,0x47,0x92,0xC4,0x79,0x07,0x8A,0x07,0x8A,0x07,0x8A,0x07,0x8A,0x47,0x92,0x47,0x92,0x47,0x92,0x07,0x8A,0x24,0x49,0xA1,0x20,0x60,0x18,0x61,0x18,0x61,0x18,
-	0x61,0x20,0xA1,0x28,0xE3,0x38,0xA3,0x30,0xE3,0x28,0x20,0x18,0x61,0x10,0xA1,0x18,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0xE3,0x20,0xA2,0x20,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0x60,0x10,0x20,0x08,0x61,0x10,0x61,0x10,0x62,0x10,0xA1,0x18,0xA2,0x20,0xA2,0x20,
-	0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x10,0x20,0x10,0x20,0x20,0x62,0x30,0x65,0x69,0x44,0x81,0xA5,0x99,0xA5,0x99,0xC8,0xC2,0x47,0xAA,0x47,0xAA,0x47,0xAA,0xA5,0x99,0x03,0x69,0x44,0x81,0xA5,0x99,0xA5,0x99,0x44,0x81,0xC8,0xC2,0xD3,0xF5,0xC8,0xC2,0x03,0x69,0x03,0x69,0x47,0xAA,0x6E,0xD4,0x51,0xE5,0x51,0xE5,0x8B,0xD3,
-	0x47,0x92,0x07,0x8A,0x85,0x71,0x07,0x8A,0x07,0x8A,0x07,0x8A,0x07,0x8A,0x47,0xAA,0xC9,0xAA,0x47,0xAA,0x47,0x92,0x85,0x71,0xC1,0x30,0xE3,0x38,0xE3,0x38,0xC1,0x30,0x61,0x28,0x24,0x49,0x85,0x71,0x07,0x8A,0x07,0x8A,0xC7,0x69,0xA5,0x51,0x24,0x49,0x24,0x39,0xA2,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x60,0x08,0x60,0x10,0x61,0x10,0xE3,0x20,0xA2,0x20,0x20,0x08,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xCB,0x62,0xA7,0x49,0x00,0x00,0x20,0x00,0x61,0x08,0xA3,0x28,0x24,0x39,0x24,0x39,0x23,0x39,0xE2,0x28,0xA1,0x10,0x20,0x08,0x60,0x10,0xA2,0x20,0xA2,0x28,0xE4,0x48,0x65,0x69,0x23,0x59,0xC3,0x58,0x03,0x69,0xA5,0x99,0x8B,0xD3,0xC8,0xC2,0xC8,0xC2,0xC8,0xC2,
-	0xA5,0x99,0x03,0x69,0xC3,0x58,0x03,0x69,0x44,0x81,0x03,0x69,0xA5,0x99,0x8B,0xD3,0x47,0x92,0xC3,0x58,0xC3,0x58,0x63,0x69,0xC8,0xC2,0x8B,0xD3,0x8B,0xD3,0x47,0x92,0x65,0x69,0x23,0x59,0x24,0x49,0x65,0x59,0x66,0x69,0x65,0x69,0x65,0x69,0x07,0x8A,0x47,0x92,0x47,0x92,0x07,0x8A,0x63,0x69,0x65,0x69,0x85,0x71,0xE7,0x79,0xA5,0x69,
-	0x23,0x41,0x65,0x69,0x47,0x92,0x4B,0xB3,0x8B,0xD3,0x6E,0xD4,0xEE,0xBB,0xA9,0x92,0xA5,0x69,0x24,0x41,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x60,0x18,0xE2,0x38,0x23,0x39,0x61,0x18,0xA2,0x20,0xA2,0x20,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x24,0x29,0xE2,0x18,0x00,0x00,0x20,0x08,0xA1,0x18,0xE3,0x28,0x24,0x41,0x24,0x49,0x64,0x41,
-	0x24,0x41,0xE3,0x30,0x61,0x10,0x20,0x08,0x61,0x18,0xE3,0x40,0x85,0x71,0xC3,0x58,0xA2,0x38,0xC3,0x58,0x03,0x69,0x44,0x81,0x47,0xAA,0xA5,0x99,0x47,0xAA,0x47,0xAA,0xA5,0x99,0x44,0x81,0xC3,0x58,0xA2,0x38,0xA3,0x38,0xC3,0x58,0x03,0x69,0x03,0x69,0xC1,0x40,0xA2,0x38,0xA2,0x38,0xE2,0x38,0x23,0x59,0x63,0x69,0xA5,0x69,0x23,0x59,
-	0xE2,0x38,0xE2,0x30,0xE2,0x30,0xE3,0x38,0xE3,0x40,0xE3,0x38,0xE3,0x38,0x65,0x59,0x66,0x69,0x65,0x59,0x23,0x59,0xC3,0x58,0xE7,0x79,0xC9,0xAA,0xC9,0xAA,0x47,0x92,0x65,0x69,0x65,0x69,0x47,0x92,0x8B,0xD3,0x6E,0xD4,0x51,0xE5,0x51,0xE5,0x8B,0xD3,0x07,0x8A,0xC7,0x69,0x62,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x61,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x23,0x41,0xA9,0x92,0x4B,0xB3,0x47,0x92,0xE4,0x28,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x08,0x60,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x60,0x08,0x61,0x18,0xE3,0x28,0x65,0x49,0x65,0x59,0x64,0x41,0x24,0x39,0x24,0x39,0x24,0x41,0xE4,0x28,0x61,0x18,0x60,0x18,0x61,0x30,0x65,0x69,0xA5,0x99,0x03,0x69,0x03,0x69,0x03,0x69,0xC3,0x58,0xC3,0x58,0xC3,0x58,0x03,0x69,0xA5,0x99,
-	0xA5,0x99,0x44,0x81,0x63,0x69,0xC1,0x40,0x61,0x30,0xC1,0x40,0x03,0x69,0x44,0x81,0x23,0x59,0xA2,0x38,0x61,0x28,0x61,0x28,0xA2,0x30,0xA2,0x38,0xC1,0x40,0x60,0x28,0xA2,0x28,0xA2,0x20,0xE3,0x30,0x23,0x39,0x23,0x39,0xE3,0x30,0xE3,0x30,0xE3,0x30,0x24,0x39,0xE2,0x28,0xA1,0x20,0xA2,0x30,0x07,0x8A,0x4B,0xB3,0xC9,0xAA,0xA9,0x92,
-	0x66,0x51,0xE3,0x40,0x85,0x71,0x4B,0xB3,0x8B,0xD3,0x6E,0xD4,0x6E,0xD4,0x8B,0xD3,0xA9,0x92,0xC7,0x69,0xA1,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0xA5,0x51,0x6E,0xD4,0xD3,0xF5,0x51,0xE5,0x65,0x49,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x61,0x18,0xE2,0x20,0x24,0x39,0xA7,0x59,0xC7,0x69,0xA7,0x59,0x24,0x49,
-	0x24,0x41,0x65,0x59,0x66,0x69,0x24,0x49,0x23,0x41,0xE3,0x40,0x23,0x59,0x44,0x81,0x85,0x71,0x03,0x69,0xC1,0x40,0x62,0x30,0x21,0x20,0x60,0x28,0x61,0x30,0xC3,0x58,0x44,0x81,0x44,0x81,0x44,0x81,0x44,0x81,0x63,0x69,0xC3,0x58,0x03,0x69,0x03,0x69,0x63,0x69,0xC3,0x58,0xA2,0x38,0xA1,0x28,0xA2,0x20,0xA1,0x28,0xA1,0x28,0xA1,0x28,
-	0xA1,0x28,0xA2,0x28,0xE3,0x38,0x64,0x41,0x24,0x41,0x24,0x41,0xE3,0x38,0xE3,0x30,0xA3,0x20,0x60,0x08,0x20,0x08,0x60,0x18,0x24,0x49,0x47,0x92,0x47,0x92,0x47,0x92,0x24,0x41,0xA1,0x28,0xE2,0x30,0xE7,0x79,0x47,0x92,0x47,0xAA,0x4B,0xB3,0xC9,0xAA,0x85,0x71,0x23,0x41,0x60,0x18,0x60,0x10,0x60,0x10,0x20,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0xA2,0x20,0xA1,0x20,0x60,0x18,0x20,0x08,0x20,0x00,0x20,0x08,0x23,0x29,0xEE,0xBB,0xD3,0xF5,0x51,0xE5,0xC7,0x69,0x60,0x10,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x61,0x10,0xE3,0x20,0xE3,0x30,0x24,0x39,0xA5,0x51,0xE7,0x79,0xE7,0x79,0x85,0x71,0xE7,0x79,0xA9,0x92,0xC9,0xAA,0x47,0x92,0xC4,0x79,0x63,0x69,0xC3,0x58,0x03,0x69,0x03,0x69,0xC3,0x58,0xA2,0x30,0x61,0x28,0x60,0x18,0x20,0x10,0x61,0x18,0x21,0x20,
-	0xA2,0x38,0x44,0x81,0xA5,0x99,0x47,0xAA,0xA5,0x99,0xC4,0x79,0x63,0x69,0x63,0x69,0xC3,0x58,0xC3,0x58,0x23,0x41,0xC1,0x40,0x61,0x20,0x61,0x20,0x61,0x18,0xA1,0x20,0xA1,0x28,0xA1,0x28,0xE2,0x38,0x24,0x49,0x64,0x49,0x24,0x49,0x24,0x41,0x24,0x31,0xE2,0x28,0x21,0x10,0x20,0x08,0x20,0x10,0xA1,0x28,0x65,0x59,0x65,0x69,0x65,0x59,
-	0xA2,0x28,0x20,0x10,0x61,0x18,0xA1,0x28,0xE4,0x48,0xE4,0x48,0x23,0x59,0x24,0x49,0xE3,0x40,0xA1,0x28,0x21,0x20,0x61,0x18,0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x39,0xA5,0x51,0xC7,0x69,0xA5,0x51,0xE2,0x20,0xE3,0x28,0x21,0x08,0x20,0x08,0xA5,0x51,0xEE,0xBB,0xA9,0x92,0x64,0x41,0x61,0x10,0xA1,0x10,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x10,0xE3,0x28,0x23,0x41,0x24,0x49,0x65,0x69,0x07,0x8A,0xA9,0x92,0x47,0x92,
-	0x47,0x92,0x8B,0xD3,0x6E,0xD4,0x8B,0xD3,0x87,0xAB,0x85,0x71,0xC1,0x40,0xC1,0x40,0x65,0x69,0xE3,0x38,0x61,0x28,0xA1,0x20,0x61,0x18,0x60,0x18,0x20,0x10,0x61,0x18,0xA1,0x28,0xE3,0x40,0x44,0x81,0x47,0xAA,0x47,0xAA,0x47,0xAA,0xA5,0x99,0x63,0x69,0xC1,0x40,0xE2,0x38,0xE2,0x38,0x63,0x69,0x23,0x59,0x60,0x20,0x61,0x18,0x61,0x18,
-	0x60,0x20,0xA1,0x28,0xA1,0x28,0xE2,0x38,0x23,0x41,0x24,0x49,0xE3,0x40,0x23,0x41,0x24,0x49,0x23,0x41,0xA2,0x20,0x20,0x10,0x60,0x10,0xA1,0x20,0xE2,0x30,0xA1,0x28,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x20,0x61,0x28,0x61,0x28,0xA1,0x20,0xA1,0x28,0x61,0x20,0xA1,0x20,0x61,0x20,0x60,0x18,0x61,0x18,0x60,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x69,0x4B,0xB3,0x6E,0xD4,0x2A,0xA4,0xC7,0x69,0x12,0xAD,0x24,0x29,0x00,0x00,0x61,0x20,0xC7,0x69,0x24,0x39,0x20,0x10,0x20,0x00,0x20,0x08,0x61,0x10,0xA2,0x18,
-	0x62,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0xE3,0x20,0xA2,0x18,0x00,0x00,0x20,0x00,0x60,0x18,0x23,0x39,0x64,0x49,0x65,0x59,0x65,0x69,0xC7,0x69,0x07,0x8A,0x07,0x8A,0x47,0x92,0x8B,0xD3,0x4A,0xC4,0x8B,0xD3,0x8B,0xD3,0xA5,0x99,0x03,0x69,0x23,0x59,0xA2,0x30,0x61,0x20,0xA2,0x28,0x61,0x18,0x60,0x20,0xC1,0x30,0xC1,0x30,0xE2,0x28,
-	0xE1,0x28,0xC1,0x30,0x62,0x49,0x44,0x81,0xA5,0x99,0x47,0xAA,0xA5,0x99,0xC3,0x59,0xC1,0x30,0xA1,0x28,0x21,0x41,0x47,0xAA,0xC8,0xC2,0x65,0x69,0x61,0x20,0x60,0x10,0x61,0x10,0x61,0x18,0x60,0x20,0xA1,0x20,0xE2,0x30,0xE2,0x38,0xE3,0x40,0x65,0x69,0x47,0x92,0x47,0x92,0xC7,0x69,0xA1,0x20,0x20,0x08,0x60,0x18,0x61,0x18,0x61,0x18,
-	0x61,0x18,0x21,0x10,0x20,0x10,0x20,0x10,0x61,0x10,0x60,0x18,0x61,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0xA1,0x28,0xE2,0x30,0xA1,0x28,0x60,0x20,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC7,0x69,0x2D,0xCD,0xD3,0xF5,0x51,0xE5,0xA9,0x92,0x29,0x7B,0x49,0x5A,0x20,0x08,0xA3,0x28,0x24,0x31,0x20,0x08,0x00,0x00,0x20,0x00,0x60,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x61,0x10,0x61,0x10,0x61,0x18,0xA7,0x49,0x49,0x5A,0x60,0x18,0x60,0x18,0xA1,0x20,0x23,0x39,0x24,0x49,0x64,0x49,0x24,0x49,0x65,0x59,0xA5,0x51,0x65,0x59,
-	0x65,0x69,0x47,0x92,0x8B,0xD3,0x8B,0xD3,0x8B,0xD3,0x47,0xAA,0xE4,0x48,0x21,0x28,0x61,0x28,0x60,0x20,0x60,0x18,0xA1,0x20,0xE2,0x30,0xE2,0x38,0x23,0x41,0xE3,0x40,0xE2,0x38,0xA5,0x69,0x85,0x7A,0xC4,0x79,0x03,0x69,0x44,0x81,0xC8,0xC2,0xC4,0x79,0x21,0x41,0xA1,0x20,0x45,0x6A,0x2D,0xCD,0xD3,0xF5,0x2D,0xCD,0x23,0x41,0x61,0x20,
-	0x61,0x18,0x20,0x10,0x60,0x10,0x60,0x18,0x61,0x20,0xA1,0x20,0xE2,0x38,0xC4,0x79,0x4B,0xB3,0x6E,0xD4,0xEE,0xBB,0xA5,0x51,0x20,0x10,0x20,0x10,0x60,0x18,0x61,0x18,0x61,0x18,0x60,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x60,0x10,0x61,0x10,0x60,0x18,0xE2,0x38,0xA5,0x69,0xC4,0x79,0x03,0x69,0x61,0x30,0x61,0x20,0x21,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x39,0xEE,0xBB,0x51,0xE5,0x6E,0xD4,0x69,0x72,0xA1,0x20,0x61,0x18,0x62,0x20,0x66,0x41,0xA2,0x28,0x20,0x00,0x00,0x00,0xA1,0x18,0xE2,0x20,0x23,0x29,0xA1,0x18,
-	0x20,0x08,0x20,0x00,0x60,0x18,0xA1,0x20,0xE2,0x38,0xA2,0x30,0xE2,0x28,0xA1,0x20,0x61,0x20,0xE2,0x28,0x24,0x39,0x64,0x41,0x64,0x41,0x65,0x59,0x65,0x59,0xE3,0x40,0xA2,0x30,0x23,0x41,0x47,0x92,0x6E,0xD4,0xC8,0xC2,0x24,0x49,0x61,0x28,0x61,0x28,0xA1,0x20,0x61,0x20,0xA1,0x28,0xA2,0x28,0xE2,0x38,0xE2,0x38,0xE3,0x40,0xE2,0x38,
-	0x23,0x59,0x4A,0xC4,0x51,0xE5,0x2D,0xCD,0x63,0x69,0xC4,0x79,0xD3,0xF5,0x47,0xAA,0x63,0x69,0xC1,0x40,0x85,0x7A,0xD8,0xF6,0xD8,0xFF,0xD3,0xF5,0x47,0x92,0xC1,0x30,0x61,0x20,0x61,0x18,0x20,0x10,0x20,0x10,0x60,0x08,0x21,0x10,0xA1,0x20,0xA5,0x69,0x8B,0xD3,0xD3,0xF5,0xD3,0xF5,0x4B,0xB3,0xE2,0x30,0x20,0x08,0x20,0x10,0x60,0x18,
-	0x61,0x18,0x60,0x18,0x61,0x18,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x10,0x64,0x41,0x4B,0xB3,0x4B,0xB3,0xC9,0xAA,0x23,0x59,0xA1,0x20,0x61,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x60,0x10,0xA5,0x51,0x89,0x93,0x06,0x8B,0x64,0x41,0x61,0x18,0xA2,0x20,0xE3,0x28,0xA3,0x28,0x61,0x18,0x61,0x08,0xA1,0x20,0x65,0x59,0x06,0x8B,0xA9,0x92,0x85,0x7A,0x23,0x39,0x60,0x18,0xA1,0x18,0xA1,0x20,0xA1,0x20,0xA2,0x28,0xE3,0x28,0xA2,0x28,0xA2,0x28,0x61,0x20,0x60,0x18,0xE2,0x30,0x24,0x49,0xC7,0x69,0x66,0x69,0x65,0x59,
-	0xA2,0x28,0xA2,0x38,0x44,0x81,0xA5,0x99,0x23,0x59,0x24,0x49,0x23,0x41,0xA2,0x38,0xE2,0x28,0xC1,0x30,0xE2,0x30,0xE2,0x30,0xE1,0x28,0xE2,0x38,0xC1,0x30,0xE1,0x28,0x65,0x59,0x6E,0xD4,0x36,0xF7,0x36,0xF7,0x4B,0xB3,0x63,0x69,0x47,0x92,0x6E,0xD4,0x47,0x92,0x44,0x81,0x87,0xAB,0xBA,0xFF,0xFB,0xFF,0x94,0xEE,0x47,0xAA,0xC1,0x40,
-	0xC1,0x30,0xA2,0x28,0xA1,0x20,0x60,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0xE2,0x38,0x4B,0xB3,0xD3,0xF5,0xD3,0xF5,0x6E,0xD4,0x65,0x69,0x61,0x18,0x20,0x10,0x20,0x10,0x60,0x18,0x61,0x18,0x61,0x18,0x20,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x65,0x59,0x4A,0xC4,0x6E,0xD4,0x8B,0xD3,0x65,0x69,0xA2,0x30,0xA1,0x28,
-	0x60,0x10,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0xE3,0x28,0x24,0x31,0xE3,0x28,0xA3,0x20,0xA2,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x23,0x39,0xC9,0xAA,0x6E,0xD4,0x52,0xDE,0x94,0xEE,
-	0xAD,0xB4,0xC3,0x59,0xA1,0x20,0xA0,0x18,0x61,0x20,0x60,0x18,0x60,0x10,0x60,0x18,0xE3,0x30,0x23,0x41,0xC1,0x30,0xE3,0x40,0x65,0x59,0x85,0x71,0xE7,0x79,0xA5,0x69,0x23,0x41,0xA2,0x38,0xA5,0x99,0xC3,0x58,0xC3,0x58,0xA2,0x38,0x23,0x59,0x03,0x69,0x23,0x41,0xC1,0x40,0xC1,0x40,0x21,0x41,0xA0,0x20,0xC1,0x30,0xA1,0x28,0xA1,0x18,
-	0xE1,0x20,0x4A,0xC4,0x36,0xF7,0xD8,0xF6,0x2D,0xCD,0x23,0x41,0xE1,0x20,0x85,0x7A,0x85,0x7A,0xA5,0x99,0x4A,0xC4,0xD8,0xFF,0x58,0xFF,0x4A,0xC4,0x44,0x81,0xC3,0x58,0xE2,0x38,0xE2,0x38,0xE2,0x30,0xA1,0x20,0x61,0x18,0x21,0x10,0x20,0x08,0x61,0x18,0xC7,0x69,0x6E,0xD4,0x51,0xE5,0x6E,0xD4,0xE7,0x79,0xA2,0x20,0x60,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x23,0x39,0xA9,0x92,0x4B,0xB3,0x4B,0xB3,0x23,0x59,0xA2,0x30,0xE2,0x30,0x61,0x20,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x20,0x08,0x62,0x18,0xA2,0x18,0x61,0x18,0x20,0x08,0x00,0x00,0x20,0x08,0x60,0x10,0x60,0x10,0xA1,0x18,0xE2,0x30,0x06,0x8B,0x94,0xEE,0x58,0xFF,0xD8,0xFF,0x36,0xF7,0x4A,0xC4,0xA5,0x51,0xA0,0x20,0xA1,0x20,0xA0,0x18,0x60,0x10,0xE2,0x28,0x85,0x7A,0x89,0x93,0x4A,0xC4,0xEE,0xBB,0xC9,0xAA,0x47,0x92,0x07,0x8A,0x07,0x8A,
-	0x07,0x8A,0x44,0x81,0x44,0x81,0xC9,0xAA,0xC9,0xAA,0x23,0x59,0x03,0x69,0x03,0x69,0xA5,0x69,0x63,0x69,0x47,0x92,0x87,0xAB,0x85,0x7A,0x4B,0xB3,0x61,0x20,0xA1,0x18,0xE2,0x30,0x47,0x92,0x52,0xDE,0xD8,0xF6,0x52,0xDE,0xA5,0x69,0xE2,0x28,0xE2,0x20,0x62,0x49,0xC4,0x79,0xC8,0xC2,0x2D,0xCD,0x4A,0xC4,0x23,0x41,0xC1,0x40,0xC3,0x58,
-	0xC1,0x30,0xA1,0x28,0xC1,0x30,0xE2,0x28,0xA0,0x28,0xA1,0x18,0x60,0x10,0x20,0x10,0xA2,0x28,0xE7,0x79,0xA9,0x92,0xA9,0x92,0x23,0x59,0xA1,0x20,0x60,0x20,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x18,0x64,0x39,0xC7,0x69,0x23,0x39,0xA1,0x28,0xA2,0x38,0xE2,0x38,
-	0xA2,0x30,0x61,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x20,0xE3,0x20,0xA2,0x20,0x21,0x10,0x20,0x08,0x60,0x08,0x61,0x18,0xA1,0x18,0xA1,0x20,0xA1,0x20,0xA1,0x28,0xE2,0x30,0x47,0x92,0x51,0xE5,0x58,0xFF,0xD8,0xFF,
-	0xD8,0xFF,0x94,0xEE,0x06,0x8B,0xC1,0x40,0xE2,0x38,0x23,0x39,0xE2,0x30,0x45,0x6A,0x2D,0xCD,0x94,0xEE,0x38,0xEF,0x36,0xF7,0xD3,0xF5,0x2D,0xCD,0xC9,0xAA,0xC8,0xC2,0x47,0xAA,0xC8,0xC2,0x44,0x81,0x47,0x92,0x63,0x69,0x63,0x69,0x23,0x59,0x23,0x59,0x21,0x41,0xC4,0x79,0x2D,0xCD,0x58,0xFF,0x52,0xDE,0xEE,0xBB,0xA0,0x20,0xA1,0x18,
-	0xE2,0x28,0x65,0x59,0x51,0xE5,0xBA,0xFF,0xD8,0xF6,0x89,0x93,0x24,0x41,0xA1,0x28,0xA1,0x20,0x21,0x39,0x44,0x81,0xA5,0x99,0xA5,0x99,0x21,0x41,0xC1,0x40,0xC3,0x58,0x61,0x30,0xA1,0x20,0x61,0x20,0xA2,0x20,0xA1,0x20,0xA1,0x28,0xA1,0x20,0x60,0x18,0x20,0x10,0xA2,0x20,0x23,0x39,0x23,0x39,0xE1,0x28,0xA2,0x28,0xA1,0x20,0x60,0x18,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x60,0x10,0x60,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x28,0xA2,0x38,0xE2,0x30,0x61,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE2,0x28,0xA1,0x20,0xA2,0x20,0xA2,0x30,0xE2,0x30,0xE2,0x30,0xE2,0x30,0xA1,0x28,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xE1,0x28,0x64,0x49,0x06,0x8B,0x2D,0xCD,0x36,0xF7,0x56,0xF6,0xEF,0xD5,0x06,0x8B,0x23,0x41,0x23,0x41,0x23,0x41,0x21,0x39,0xC4,0x79,0x51,0xE5,0x58,0xFF,0xFB,0xFF,0xFB,0xFF,0x58,0xFF,0xD3,0xF5,0x8B,0xD3,0xC8,0xC2,
-	0x8B,0xD3,0xC8,0xC2,0xA5,0x99,0xA5,0x99,0xC4,0x79,0x63,0x69,0x23,0x59,0x62,0x49,0x21,0x41,0xA5,0x69,0x52,0xDE,0xD8,0xFF,0x36,0xF7,0x89,0x93,0x60,0x20,0x60,0x18,0x23,0x39,0x06,0x8B,0x52,0xDE,0xFB,0xFF,0x58,0xFF,0xAD,0xB4,0x23,0x59,0xE3,0x28,0xA2,0x20,0xC7,0x69,0xC9,0xAA,0x63,0x69,0xC4,0x79,0xC4,0x79,0x63,0x69,0x23,0x59,
-	0x07,0x8A,0x63,0x69,0x20,0x20,0x21,0x18,0x61,0x18,0xA1,0x20,0xA2,0x28,0xA1,0x20,0xA1,0x20,0x61,0x18,0x20,0x10,0x60,0x10,0x20,0x10,0xA1,0x18,0xA1,0x20,0xA1,0x20,0x60,0x18,0x60,0x10,0x60,0x08,0x20,0x10,0x20,0x10,0x60,0x10,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x20,0xC1,0x40,
-	0xE2,0x38,0xA1,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x69,0x23,0x39,0xA1,0x28,0xE2,0x30,0xE2,0x38,0x23,0x41,0x23,0x41,0x23,0x41,0x23,0x39,0x23,0x39,0xE2,0x30,0xA1,0x28,0xA1,0x28,0xE2,0x30,0xA7,0x59,0x89,0x93,
-	0x4A,0xC4,0x06,0x8B,0xA5,0x51,0xA1,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x30,0xA5,0x69,0x4A,0xC4,0x94,0xEE,0xD8,0xFF,0xBA,0xFF,0x36,0xF7,0xD3,0xF5,0x8B,0xD3,0xC8,0xC2,0x8B,0xD3,0x47,0xAA,0x47,0xAA,0x47,0xAA,0xC4,0x79,0x23,0x59,0x62,0x49,0x21,0x39,0xA0,0x20,0x21,0x41,0x2D,0xCD,0xD8,0xFF,0xD8,0xFF,0x2D,0xCD,0x23,0x41,0xE2,0x38,
-	0x2A,0xA4,0x94,0xEE,0x58,0xFF,0xFC,0xFF,0xD8,0xFF,0xEE,0xBB,0x24,0x49,0x24,0x31,0xE3,0x28,0xC7,0x69,0xE2,0x38,0xE2,0x38,0x21,0x41,0x47,0x92,0x87,0xAB,0xC4,0x79,0x56,0xF6,0x51,0xE5,0xA2,0x30,0x20,0x10,0x20,0x10,0x20,0x10,0x61,0x20,0xA1,0x20,0xA1,0x20,0xA1,0x18,0xA1,0x18,0x20,0x10,0x20,0x08,0x20,0x10,0xA0,0x18,0xA1,0x20,
-	0xA1,0x20,0x60,0x18,0x20,0x08,0x60,0x08,0x60,0x10,0x20,0x10,0x60,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x18,0xE2,0x30,0xE2,0x38,0xA1,0x28,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x4B,0xB3,0x45,0x6A,0x21,0x41,0x21,0x39,0xE2,0x30,0xE1,0x28,0xE2,0x30,0xE1,0x28,0xA1,0x28,0xE1,0x28,0xA1,0x20,0xA1,0x20,0xA1,0x20,0xA1,0x20,0x60,0x18,0xA1,0x20,0xE2,0x28,0xE2,0x28,0x60,0x18,0x60,0x18,0xA1,0x20,0xE2,0x28,0xE2,0x30,0xE3,0x40,0xE7,0x79,0x51,0xE5,0xD8,0xF6,0xEF,0xD5,0x51,0xE5,0x6E,0xD4,0xC8,0xC2,0xC8,0xC2,
-	0xC8,0xC2,0xA5,0x99,0xA5,0x99,0xC4,0x79,0xA5,0x69,0x23,0x59,0xE2,0x38,0xE1,0x28,0xE1,0x28,0x21,0x39,0x06,0x8B,0xEF,0xD5,0x52,0xDE,0x4A,0xC4,0xA5,0x69,0x85,0x7A,0x94,0xEE,0xD8,0xFF,0xBA,0xFF,0x38,0xEF,0xEF,0xD5,0xE7,0x79,0x23,0x41,0x24,0x31,0x24,0x29,0xE3,0x30,0xA5,0x69,0x69,0x72,0xE3,0x40,0x6E,0xD4,0x87,0xAB,0x87,0xAB,
-	0x56,0xF6,0x38,0xEF,0xC7,0x69,0xC1,0x30,0xA3,0x39,0x24,0x5A,0x23,0x41,0x61,0x20,0x60,0x18,0xA1,0x20,0xA2,0x28,0xA1,0x20,0x61,0x18,0x60,0x18,0x60,0x18,0xA1,0x20,0xA1,0x28,0xA1,0x28,0x60,0x18,0x20,0x10,0x60,0x10,0x60,0x10,0x60,0x18,0x20,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x60,0x10,0xE2,0x28,
-	0xE2,0x38,0xA2,0x30,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6E,0xD4,0x47,0x92,0x23,0x59,0xE1,0x28,0xE1,0x28,0xA1,0x20,0xA0,0x20,0xA0,0x18,0x60,0x10,0x60,0x10,0x60,0x10,0x20,0x08,0x60,0x10,0x60,0x18,0x61,0x18,0x60,0x18,
-	0xA1,0x10,0xA1,0x18,0x61,0x20,0xA3,0x28,0x24,0x39,0x24,0x49,0x65,0x59,0x65,0x69,0x23,0x59,0x44,0x81,0x44,0x81,0xA5,0x99,0xC8,0xC2,0xC8,0xC2,0x47,0xAA,0xC8,0xC2,0x47,0xAA,0xA5,0x99,0xC4,0x79,0xA5,0x69,0x62,0x49,0x21,0x41,0xE2,0x30,0xE1,0x28,0xE1,0x20,0xC1,0x30,0x21,0x41,0xA5,0x69,0x45,0x6A,0xA2,0x51,0x21,0x41,0x63,0x69,
-	0xEF,0xD5,0xD8,0xFF,0x58,0xFF,0x2D,0xCD,0x85,0x7A,0xA5,0x69,0xA9,0x92,0x24,0x39,0x25,0x31,0xE2,0x28,0xEC,0x8A,0xC7,0x69,0x65,0x59,0x44,0x81,0x47,0xAA,0x4A,0xC4,0xEF,0xD5,0x58,0xFF,0x51,0xE5,0x23,0x41,0x2D,0xCD,0x52,0xDE,0x2A,0xA4,0x23,0x39,0x20,0x18,0x61,0x20,0xA1,0x20,0xA2,0x28,0xA2,0x28,0xA2,0x28,0x61,0x20,0xA1,0x20,
-	0xA1,0x28,0xA2,0x28,0xA2,0x28,0x61,0x18,0x60,0x10,0x60,0x18,0x61,0x18,0x61,0x20,0x60,0x18,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0xA1,0x20,0xC1,0x30,0xE3,0x38,0x61,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x4A,0xC4,0x06,0x8B,0x23,0x41,0xA1,0x20,0xA0,0x18,0x60,0x10,0x60,0x18,0x60,0x10,0x60,0x10,0x60,0x10,0x60,0x18,0x60,0x10,0xA0,0x18,0xA1,0x18,0xA1,0x20,0xA1,0x20,0xE1,0x28,0xE2,0x30,0x23,0x41,0xA5,0x51,0x07,0x8A,0x07,0x8A,0x47,0x92,0x47,0x92,0x47,0xAA,0xA5,0x99,0xA5,0x99,0xA5,0x99,0xA5,0x99,0x47,0xAA,0xC8,0xC2,0xC8,0xC2,
-	0x47,0xAA,0xC4,0x79,0xA5,0x69,0x23,0x59,0x64,0x49,0x23,0x41,0xE2,0x30,0xE2,0x30,0x23,0x39,0xE2,0x30,0xC1,0x30,0xE0,0x28,0xA0,0x28,0xA0,0x20,0xA0,0x20,0xC1,0x30,0x85,0x7A,0xEF,0xD5,0x51,0xE5,0x47,0x92,0x45,0x6A,0x06,0x8B,0x51,0xE5,0xC7,0x69,0x64,0x49,0x23,0x39,0x23,0x39,0x65,0x59,0x65,0x69,0x4B,0xB3,0x4A,0xC4,0x51,0xE5,
-	0xEF,0xD5,0x56,0xF6,0x2D,0xCD,0x63,0x69,0xEF,0xD5,0xD8,0xFF,0x94,0xEE,0xA5,0x51,0x20,0x18,0x61,0x18,0x61,0x18,0x61,0x20,0xA1,0x28,0xA2,0x28,0xA2,0x30,0xE2,0x30,0xE2,0x38,0xE3,0x38,0xE2,0x38,0xA1,0x20,0x61,0x20,0x60,0x18,0xA0,0x20,0x61,0x20,0xA1,0x20,0x61,0x18,0x60,0x10,0x21,0x10,0x20,0x08,0x60,0x10,0xA1,0x28,0xE3,0x40,
-	0x23,0x41,0xE3,0x40,0xA1,0x28,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0xB3,0xE7,0x79,0x23,0x39,0x60,0x18,0x60,0x18,0x60,0x18,0xA1,0x20,0xA1,0x20,0xC1,0x30,0xA1,0x28,0xE1,0x28,0xC1,0x30,0xE2,0x30,0x23,0x39,0x21,0x39,0x23,0x41,
-	0x21,0x41,0x21,0x41,0x23,0x59,0xC4,0x79,0x47,0xAA,0x47,0xAA,0xC8,0xC2,0xC8,0xC2,0xC8,0xC2,0x47,0xAA,0xA5,0x99,0xA5,0x99,0xA5,0x99,0x47,0xAA,0x47,0xAA,0xA5,0x99,0x07,0x8A,0xC4,0x79,0x65,0x69,0x65,0x59,0x64,0x49,0x23,0x39,0xE1,0x20,0xA0,0x20,0xE1,0x20,0xA0,0x20,0xE2,0x28,0xA1,0x20,0xA1,0x20,0xA1,0x20,0xA1,0x18,0x62,0x20,
-	0xE1,0x28,0x64,0x41,0xA5,0x51,0x64,0x49,0x65,0x59,0x07,0x8A,0x47,0x92,0x06,0x8B,0xC4,0x79,0x45,0x6A,0xA5,0x69,0xC7,0x69,0xA5,0x69,0x85,0x71,0x63,0x69,0x47,0x92,0x06,0x8B,0x4A,0xC4,0x4A,0xC4,0xC4,0x79,0x2D,0xCD,0xD8,0xFF,0x52,0xDE,0x64,0x49,0x60,0x18,0x61,0x18,0x61,0x18,0x61,0x20,0x61,0x20,0xA1,0x28,0x23,0x41,0x23,0x59,
-	0x65,0x59,0x23,0x59,0x24,0x49,0xE3,0x40,0xA1,0x28,0x60,0x18,0x60,0x18,0xA1,0x20,0xA1,0x20,0xA1,0x20,0x61,0x18,0x60,0x10,0x60,0x10,0xE2,0x30,0x65,0x59,0xC4,0x79,0x07,0x8A,0x63,0x69,0xA2,0x38,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x45,0x6A,0x64,0x41,0xA1,0x28,0xE2,0x28,0xE2,0x30,0x23,0x39,0x24,0x39,0x23,0x41,0x23,0x41,0x23,0x59,0xC3,0x59,0x62,0x49,0x62,0x49,0x62,0x49,0x23,0x59,0x62,0x49,0x62,0x49,0x62,0x49,0x65,0x59,0x47,0x92,0xC9,0xAA,0xC8,0xC2,0xC8,0xC2,0xC8,0xC2,0x51,0xE5,0xC8,0xC2,0xA5,0x99,0xA5,0x99,0xA5,0x99,0x63,0x69,0x63,0x69,0x62,0x49,
-	0x62,0x49,0x65,0x59,0x64,0x49,0x23,0x41,0xE2,0x30,0xE1,0x20,0xA1,0x18,0x61,0x20,0xA0,0x20,0xA1,0x20,0xA1,0x20,0xA1,0x20,0xE2,0x28,0xE2,0x28,0xA1,0x20,0xA0,0x20,0xA0,0x18,0xA1,0x10,0xA1,0x20,0xA1,0x28,0xE3,0x40,0xA5,0x69,0xA5,0x69,0xC3,0x59,0xC4,0x79,0xC9,0xAA,0xC9,0xAA,0x47,0x92,0xE7,0x79,0x65,0x69,0x07,0x8A,0x23,0x59,
-	0x62,0x49,0x63,0x69,0x87,0xAB,0x4A,0xC4,0x52,0xDE,0x58,0xFF,0x06,0x8B,0xC1,0x30,0xA2,0x28,0xA1,0x20,0x61,0x18,0x60,0x18,0x61,0x20,0xA1,0x28,0x24,0x41,0x65,0x59,0x65,0x69,0x65,0x59,0x65,0x69,0x23,0x59,0xE3,0x40,0xA1,0x28,0x61,0x20,0x61,0x18,0xA1,0x20,0xA1,0x28,0xA2,0x28,0x61,0x18,0x61,0x20,0x64,0x49,0x07,0x8A,0xC9,0xAA,
-	0xC9,0xAA,0xA5,0x99,0xC1,0x40,0xA1,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x30,0xE2,0x28,0xA1,0x20,0xE2,0x30,0xE2,0x30,0xE2,0x38,0x23,0x41,0x23,0x41,0x23,0x59,0x4B,0xB3,0x47,0x92,0x63,0x69,0x23,0x59,0x23,0x59,0xA2,0x51,0x62,0x49,
-	0x21,0x41,0xE3,0x40,0x23,0x59,0xC4,0x79,0x47,0x92,0x47,0xAA,0x47,0xAA,0x47,0xAA,0x47,0xAA,0x44,0x81,0x03,0x69,0x8B,0xD3,0x47,0x92,0xA0,0x28,0xC1,0x30,0xE2,0x30,0xE3,0x30,0xE3,0x30,0x24,0x39,0x65,0x59,0xA3,0x28,0x61,0x18,0x60,0x10,0x20,0x10,0x60,0x08,0x60,0x10,0x24,0x39,0x20,0x10,0x60,0x18,0x61,0x20,0xA1,0x20,0x62,0x20,
-	0x20,0x10,0x20,0x08,0x60,0x10,0xA1,0x20,0xA2,0x28,0xE3,0x38,0x23,0x41,0x24,0x41,0x64,0x41,0xC4,0x79,0xC9,0xAA,0xA9,0x92,0x07,0x8A,0x23,0x59,0x85,0x71,0x23,0x41,0x64,0x41,0xE2,0x30,0x44,0x81,0x4A,0xC4,0x94,0xEE,0x94,0xEE,0xE0,0x28,0xA0,0x20,0xA1,0x20,0xA2,0x28,0xA1,0x20,0xA1,0x20,0x60,0x20,0xE2,0x28,0x24,0x49,0x65,0x59,
-	0x24,0x49,0x65,0x59,0x65,0x59,0x23,0x59,0x23,0x41,0xE3,0x40,0xA0,0x28,0x60,0x18,0x61,0x20,0xA1,0x20,0xC1,0x30,0xA1,0x20,0xA2,0x28,0x65,0x59,0x47,0x92,0xC9,0xAA,0xC8,0xC2,0x47,0x92,0x23,0x41,0x61,0x20,0x61,0x10,0x60,0x10,0x60,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x20,0xA2,0x20,0xA1,0x28,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0x21,0x39,0xC1,0x30,0xC3,0x59,0x23,0x59,0xA5,0x69,0xC4,0x79,0x47,0x92,0x85,0x71,0x63,0x69,0x23,0x41,0xE2,0x38,0xE2,0x30,0xC1,0x40,0x23,0x59,0x63,0x69,0x44,0x81,0xC4,0x79,0x65,0x59,0xC1,0x40,0xC3,0x58,0x85,0x71,0x60,0x20,0x60,0x20,0x61,0x18,0xA1,0x18,
-	0xA2,0x20,0xA2,0x20,0xA1,0x18,0xE2,0x28,0xE3,0x30,0x62,0x20,0x20,0x08,0x60,0x08,0x20,0x08,0x20,0x10,0x12,0xAD,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x18,0xA2,0x28,0xE3,0x30,0x24,0x41,0x21,0x20,0x60,0x10,0x20,0x10,0x21,0x10,0xE2,0x20,0xE3,0x38,0xE2,0x28,0x64,0x49,0xA5,0x69,0x07,0x8A,0x07,0x8A,0x47,0x92,0x07,0x8A,0x65,0x59,
-	0x65,0x59,0x65,0x49,0xA2,0x51,0x47,0xAA,0xEF,0xD5,0x4A,0xC4,0x62,0x49,0xA1,0x20,0x60,0x18,0xA0,0x18,0xA1,0x20,0xA1,0x20,0xA1,0x20,0xE2,0x28,0x24,0x39,0x24,0x41,0x24,0x49,0x24,0x49,0x24,0x49,0x23,0x41,0xC4,0x79,0xC9,0xAA,0x23,0x59,0x60,0x18,0x60,0x18,0x61,0x18,0xA0,0x20,0xA1,0x28,0xA1,0x28,0x65,0x59,0xE7,0x79,0x47,0x92,
-	0xC9,0xAA,0x07,0x8A,0xE3,0x40,0xA1,0x20,0xE2,0x30,0xA5,0x69,0xC7,0x69,0xE2,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x20,0xA1,0x20,0xA1,0x28,0xE1,0x28,0xC1,0x30,0xC1,0x30,0x62,0x39,0xE1,0x28,0xC1,0x30,0xA0,0x28,0xA1,0x28,0xE2,0x28,0x64,0x49,0x47,0x92,0x47,0x92,0x47,0x92,
-	0x63,0x69,0xE3,0x40,0xA2,0x38,0xA2,0x30,0xE3,0x40,0x23,0x41,0x23,0x59,0xE4,0x48,0xC1,0x40,0x61,0x30,0x85,0x71,0x61,0x28,0x60,0x18,0x61,0x18,0x20,0x10,0x61,0x10,0x61,0x18,0x61,0x10,0x20,0x10,0x20,0x08,0xA1,0x20,0xA2,0x30,0x61,0x20,0x20,0x08,0x20,0x10,0x20,0x20,0x62,0x20,0xE3,0x38,0xE3,0x30,0xE3,0x30,0xA2,0x20,0x61,0x18,
-	0x61,0x20,0xA2,0x38,0x61,0x30,0x20,0x10,0x62,0x10,0xE3,0x38,0x60,0x10,0xA2,0x20,0xE4,0x48,0xE3,0x38,0x24,0x41,0x64,0x41,0x64,0x49,0xC4,0x79,0x47,0x92,0x47,0x92,0xA5,0x69,0xC7,0x69,0x65,0x41,0x45,0x6A,0x94,0xEE,0x2D,0xCD,0x87,0xAB,0xC3,0x59,0xE1,0x28,0x60,0x10,0x61,0x10,0xA1,0x18,0xA1,0x20,0xE1,0x28,0x23,0x39,0x23,0x39,
-	0x24,0x41,0x24,0x41,0x24,0x41,0xA5,0x69,0x2D,0xCD,0x94,0xEE,0x4A,0xC4,0xE2,0x38,0x61,0x20,0x61,0x18,0x60,0x18,0x60,0x20,0xA1,0x28,0x64,0x41,0xE7,0x79,0x07,0x8A,0x07,0x8A,0x63,0x69,0x23,0x59,0xC3,0x58,0xE7,0x79,0x6E,0xD4,0x6E,0xD4,0xE7,0x79,0x61,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA1,0x20,0xA0,0x20,0xE1,0x28,0xC1,0x30,0xE2,0x30,0xE1,0x28,0xE1,0x20,0xA0,0x20,0x60,0x10,0x60,0x10,0x60,0x08,0x60,0x18,0x64,0x49,0x85,0x7A,0xC9,0xAA,0x8B,0xD3,0x4B,0xB3,0xA5,0x99,0x03,0x69,0xA2,0x38,0xC1,0x30,0xA2,0x38,0xA3,0x38,0x61,0x30,0xA1,0x28,0x61,0x28,0x65,0x69,0x62,0x30,0xA2,0x28,0x61,0x20,0x61,0x18,0x61,0x18,
-	0x61,0x18,0x61,0x18,0xA2,0x20,0xA1,0x18,0xA2,0x28,0x62,0x30,0xEE,0xBB,0x24,0x49,0x65,0x59,0x24,0x41,0xA2,0x30,0x61,0x20,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x10,0x21,0x18,0xC7,0x69,0x66,0x51,0x69,0x72,0xA7,0x49,0x20,0x08,0x60,0x08,0xA2,0x20,0xA3,0x38,0x24,0x41,0xE3,0x28,0xE3,0x28,0x23,0x39,0x65,0x69,0xA9,0x92,
-	0xA9,0x92,0x07,0x8A,0x64,0x49,0x24,0x39,0x07,0x8A,0xC8,0xC2,0x2D,0xCD,0xA5,0x99,0xA2,0x51,0xE2,0x30,0x20,0x08,0x60,0x08,0x60,0x08,0x60,0x18,0xE2,0x30,0x64,0x41,0x24,0x41,0x23,0x41,0xE3,0x40,0xA5,0x69,0x94,0xEE,0x58,0xFF,0x2D,0xCD,0x21,0x41,0xA2,0x30,0x61,0x20,0x61,0x18,0x60,0x18,0xE2,0x38,0x65,0x69,0x07,0x8A,0xE7,0x79,
-	0x07,0x8A,0x47,0x92,0xC9,0xAA,0x47,0x92,0xC9,0xAA,0x51,0xE5,0x51,0xE5,0x89,0x93,0x61,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x20,0xA1,0x20,0xA1,0x28,0xA2,0x28,0xA1,0x20,0xA1,0x18,0x60,0x10,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x10,0xC1,0x30,0xA5,0x69,0xC9,0xAA,0xC8,0xC2,0x8B,0xD3,
-	0xC9,0xAA,0x07,0x8A,0x44,0x81,0x44,0x81,0x65,0x69,0x23,0x59,0xA3,0x38,0x61,0x28,0xA2,0x20,0xA1,0x20,0x61,0x20,0x61,0x28,0xE2,0x28,0xA2,0x28,0x61,0x20,0x21,0x18,0x20,0x18,0x20,0x10,0x21,0x10,0x20,0x10,0x60,0x18,0xE3,0x38,0xEE,0xBB,0x61,0x28,0x61,0x20,0x61,0x20,0x21,0x18,0x21,0x18,0x60,0x10,0x20,0x10,0x20,0x08,0xE4,0x28,
-	0x12,0xAD,0x20,0x08,0xE4,0x30,0x65,0x69,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x00,0x61,0x18,0xA2,0x30,0xE3,0x38,0xE2,0x20,0xA2,0x20,0x12,0xAD,0x65,0x69,0x07,0x8A,0xC9,0xAA,0xC4,0x79,0xA7,0x59,0xA5,0x51,0xD3,0xF5,0x36,0xF7,0x87,0xAB,0x63,0x69,0xC3,0x59,0x21,0x39,0x60,0x10,0x20,0x00,0x20,0x08,0xA0,0x20,0xE2,0x38,
-	0x23,0x39,0x23,0x39,0xE3,0x40,0x23,0x59,0x4A,0xC4,0x52,0xDE,0x06,0x8B,0x61,0x30,0xE2,0x38,0xA1,0x28,0xA1,0x20,0x20,0x18,0x23,0x41,0x07,0x8A,0x47,0x92,0x07,0x8A,0x47,0x92,0x8B,0xD3,0x6E,0xD4,0x8B,0xD3,0xC9,0xAA,0xC9,0xAA,0x89,0x93,0xA5,0x51,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE2,0x28,0xE2,0x30,0xE2,0x30,0xE2,0x28,0xA1,0x20,0x61,0x18,0x60,0x10,0x20,0x10,0x61,0x10,0x24,0x49,0xA2,0x30,0xE3,0x40,0x63,0x69,0xC8,0xC2,0x8B,0xD3,0x8B,0xD3,0xC9,0xAA,0x44,0x81,0xC3,0x58,0xA2,0x38,0xC1,0x40,0x24,0x49,0xA2,0x38,0x61,0x28,0x61,0x20,0x60,0x18,0x60,0x18,0x61,0x18,0x60,0x10,0x21,0x18,0x21,0x18,0x61,0x18,
-	0x62,0x20,0x61,0x18,0x61,0x18,0x60,0x18,0x20,0x10,0x00,0x00,0x21,0x10,0x20,0x10,0x20,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x10,0x20,0x10,0xA3,0x20,0xA2,0x20,0x20,0x10,0x20,0x08,0xA2,0x38,0xC3,0x58,0x21,0x18,0x60,0x10,0x20,0x10,0x20,0x08,0x60,0x08,0x20,0x10,0xA2,0x30,0xA2,0x30,0xE4,0x30,0x12,0xAD,0x24,0x41,
-	0x65,0x59,0xE7,0x79,0x4B,0xB3,0x85,0x7A,0xE7,0x79,0x3A,0xEF,0x56,0xF6,0x4A,0xC4,0x63,0x69,0x23,0x59,0xC3,0x59,0xE2,0x38,0xA1,0x18,0x20,0x08,0x60,0x10,0x61,0x18,0xE1,0x28,0xE2,0x30,0x23,0x41,0xC4,0x79,0x85,0x7A,0x62,0x49,0x20,0x20,0xA0,0x18,0xA1,0x28,0xE3,0x38,0xA2,0x28,0xA2,0x28,0xE3,0x40,0x07,0x8A,0x47,0x92,0x47,0x92,
-	0xC9,0xAA,0x6E,0xD4,0x6E,0xD4,0x8B,0xD3,0x47,0x92,0x23,0x59,0x23,0x39,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0xA1,0x20,0xA1,0x20,0x61,0x18,0xA1,0x18,0xA1,0x20,0xA1,0x20,0xA2,0x28,0x63,0x69,0xEE,0xBB,0xC3,0x58,0x03,0x69,0xA5,0x99,0xA5,0x99,0x47,0xAA,0x47,0xAA,
-	0x44,0x81,0x24,0x49,0xA1,0x28,0x61,0x28,0x61,0x20,0x20,0x18,0x61,0x20,0xA2,0x38,0xE3,0x38,0xA2,0x28,0x62,0x20,0x20,0x18,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x61,0x18,0x61,0x18,0xA2,0x30,0xE2,0x38,0xA2,0x20,0x61,0x18,0x20,0x10,0x21,0x10,0x60,0x10,0x21,0x10,0x61,0x10,0x20,0x10,0x20,0x10,0x61,0x10,0x61,0x18,
-	0x20,0x10,0x60,0x08,0x20,0x08,0x20,0x10,0x07,0x8A,0x23,0x59,0xA2,0x20,0x62,0x20,0x62,0x20,0xA2,0x20,0xA2,0x20,0x61,0x20,0xA2,0x38,0xE3,0x38,0x21,0x28,0x62,0x30,0x24,0x41,0x66,0x69,0x56,0xF6,0x47,0x92,0x07,0x8A,0x69,0x72,0x4B,0xB3,0x87,0xAB,0x2D,0xCD,0x63,0x69,0x62,0x49,0xC3,0x59,0x64,0x49,0xA1,0x20,0x21,0x18,0x61,0x10,
-	0x61,0x20,0xA0,0x28,0x24,0x5A,0xEF,0xD5,0xEF,0xD5,0x64,0x49,0x21,0x10,0x21,0x10,0x61,0x20,0xA2,0x38,0xE2,0x38,0xC1,0x30,0xE2,0x38,0xA5,0x69,0x07,0x8A,0x07,0x8A,0x47,0x92,0xC9,0xAA,0xC9,0xAA,0x47,0x92,0x23,0x59,0x60,0x28,0x61,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x10,0x60,0x10,0x60,0x10,0x60,0x18,0xA1,0x20,0xA1,0x28,0xA2,0x30,0xA2,0x38,0xC3,0x58,0x44,0x81,0x47,0xAA,0xA5,0x99,0x03,0x69,0x44,0x81,0x63,0x69,0xC3,0x58,0xE2,0x38,0xC1,0x30,0x61,0x28,0xA1,0x20,0x61,0x20,0x61,0x18,0x61,0x18,0x61,0x20,0x61,0x28,0x61,0x20,0xA2,0x28,0xA2,0x28,0x61,0x18,0x61,0x10,0x20,0x08,0x20,0x00,
-	0x20,0x08,0x20,0x10,0xE3,0x40,0x65,0x59,0x61,0x20,0x62,0x20,0xA2,0x20,0x61,0x18,0x20,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0x60,0x10,0x61,0x20,0x61,0x18,0xA2,0x18,0xA1,0x18,0x61,0x28,0x24,0x49,0xA3,0x38,0xA2,0x20,0x20,0x10,0x20,0x10,0x20,0x08,0x21,0x10,0x61,0x10,0x61,0x20,0x61,0x30,0xA2,0x30,0x61,0x28,
-	0xA3,0x28,0x64,0x41,0x65,0x59,0x66,0x69,0xC4,0x79,0xC4,0x79,0x65,0x59,0x21,0x41,0x56,0xF6,0xEF,0xD5,0x62,0x49,0xC1,0x40,0xA5,0x69,0x62,0x49,0xE2,0x28,0xA1,0x20,0x21,0x20,0x60,0x18,0x06,0x8B,0xD8,0xFF,0xD8,0xFF,0x69,0x72,0x60,0x10,0x20,0x08,0x60,0x10,0x60,0x20,0xE2,0x38,0xC1,0x30,0xC1,0x30,0x23,0x39,0x65,0x59,0x85,0x71,
-	0xA5,0x51,0x64,0x49,0x23,0x59,0xE2,0x30,0xA1,0x20,0xA1,0x20,0xA1,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x10,0xA0,0x20,0xE1,0x28,0xE2,0x30,0xE3,0x40,0xC3,0x58,0x44,0x81,0x47,0x92,0x47,0xAA,0x47,0xAA,0x47,0xAA,0xA5,0x99,0x03,0x69,0xC1,0x40,0xA2,0x28,
-	0x21,0x20,0x61,0x20,0x61,0x18,0x60,0x10,0x61,0x18,0xA1,0x20,0x61,0x18,0x61,0x20,0x61,0x18,0x20,0x10,0x20,0x10,0x61,0x20,0x62,0x20,0x61,0x18,0x21,0x18,0x20,0x10,0x20,0x18,0x85,0x71,0x24,0x49,0x20,0x18,0x20,0x10,0x20,0x10,0x61,0x18,0x61,0x18,0x62,0x20,0x20,0x10,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,
-	0x61,0x10,0x61,0x18,0x61,0x18,0x21,0x20,0x61,0x28,0x61,0x30,0x61,0x20,0xE2,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x16,0xCE,0xC7,0x69,0xE3,0x38,0x61,0x28,0xE3,0x38,0x24,0x41,0xE4,0x48,0x23,0x59,0x23,0x59,0xE3,0x38,0xA1,0x28,0x52,0xDE,0x4A,0xC4,0x47,0x92,0x62,0x49,0x21,0x41,0x63,0x69,0x23,0x41,0x23,0x39,
-	0xA1,0x28,0x21,0x20,0x89,0x93,0x36,0xF7,0xD8,0xFF,0x89,0x93,0x60,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0xA2,0x28,0xA2,0x38,0xA1,0x28,0xA1,0x28,0xE2,0x28,0x23,0x41,0xC1,0x40,0xC1,0x30,0xA1,0x28,0x60,0x18,0x60,0x18,0xA2,0x28,0xA1,0x20,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x60,0x08,0xA1,0x20,0xA1,0x28,0xE2,0x38,0x03,0x69,0x85,0x71,0x63,0x69,0xA5,0x99,0x47,0xAA,0xC8,0xC2,0x8B,0xD3,0x8B,0xD3,0x47,0xAA,0x23,0x59,0xA2,0x30,0x61,0x20,0x61,0x18,0x61,0x18,0x60,0x18,0x21,0x18,0x60,0x18,0x61,0x18,0x61,0x18,0x61,0x20,0x61,0x18,0x60,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0xA2,0x20,0xE2,0x28,0xE3,0x38,
-	0xE7,0x79,0x65,0x59,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x10,0x62,0x20,0x61,0x18,0x61,0x18,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x18,0x61,0x18,0xA1,0x20,0xA2,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x25,0x39,0x20,0x10,0xA2,0x28,
-	0x61,0x20,0x61,0x28,0xA2,0x30,0xA3,0x38,0xE4,0x48,0x16,0xCE,0xA1,0x20,0xE3,0x30,0xC1,0x40,0xC4,0x79,0x47,0xAA,0xA5,0x99,0x21,0x41,0x62,0x49,0x62,0x49,0x85,0x7A,0x89,0x93,0xC1,0x30,0xE2,0x38,0xEF,0xD5,0xD8,0xFF,0x52,0xDE,0x21,0x41,0x60,0x18,0x21,0x08,0x20,0x08,0xA0,0x20,0xA2,0x38,0xE2,0x38,0xA2,0x28,0x61,0x20,0xA0,0x20,
-	0xE2,0x38,0x23,0x41,0xE1,0x28,0x61,0x18,0x60,0x10,0xA1,0x20,0xA0,0x20,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x18,0xA1,0x28,0xE3,0x40,0x65,0x69,0x63,0x69,0x03,0x69,0x03,0x69,0x44,0x81,0xC8,0xC2,0x8B,0xD3,0x8B,0xD3,0xC8,0xC2,0xC8,0xC2,0x85,0x71,0xA2,0x30,0x61,0x20,
-	0x61,0x18,0x61,0x20,0x61,0x18,0x20,0x18,0x60,0x18,0x60,0x18,0x61,0x20,0xA1,0x20,0xA1,0x20,0xA1,0x18,0x62,0x20,0xA2,0x20,0x61,0x18,0x61,0x18,0x20,0x18,0x21,0x20,0x61,0x20,0x61,0x28,0xE3,0x38,0xA1,0x20,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x61,0x10,0x20,0x08,0xA2,0x20,0x61,0x18,0x60,0x10,0x21,0x10,0x20,0x10,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x62,0x18,0x20,0x18,0xE3,0x30,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0xE2,0x30,0x61,0x28,0x61,0x20,0x61,0x20,0xE3,0x38,0xE7,0x79,0xA3,0x38,0xA2,0x28,0x61,0x28,0xC1,0x30,0x47,0xAA,0x47,0xAA,0xC4,0x79,0xC1,0x30,0x21,0x41,0x58,0xFF,
-	0x36,0xF7,0xC3,0x59,0xC1,0x40,0x2A,0xA4,0xFB,0xFF,0xD8,0xFF,0x87,0xAB,0xE2,0x30,0x60,0x18,0xE1,0x20,0x24,0x5A,0xA5,0x69,0xC1,0x40,0xE2,0x38,0xA2,0x28,0xA1,0x28,0xC1,0x30,0x23,0x59,0x23,0x41,0x61,0x20,0x60,0x18,0xA1,0x28,0xA1,0x28,0x60,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE3,0x30,0xE3,0x40,0x23,0x41,0xC3,0x58,0xC3,0x58,0x23,0x59,0xC3,0x58,0x44,0x81,0x47,0xAA,0xC8,0xC2,0xC8,0xC2,0xC8,0xC2,0xC8,0xC2,0x85,0x71,0xE3,0x40,0xA1,0x20,0xA2,0x28,0x62,0x20,0x61,0x28,0xA2,0x30,0xE3,0x38,0xA2,0x38,0xA2,0x30,0x20,0x18,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x10,0x61,0x10,0x60,0x10,0x61,0x18,0xA1,0x18,
-	0xA1,0x18,0x61,0x18,0x94,0xC5,0xA3,0x30,0x61,0x18,0x61,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x10,0x20,0x10,0x62,0x18,0x61,0x18,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0x61,0x20,0xA2,0x28,0x61,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0xA1,0x18,0xA2,0x28,0xA2,0x28,0x61,0x20,0x61,0x20,0x20,0x18,0x61,0x28,0xA1,0x28,0xA2,0x28,0x61,0x28,0x23,0x59,0x87,0xAB,0xC3,0x59,0xA2,0x51,0x21,0x39,0x2D,0xCD,0x2D,0xCD,0x06,0x8B,0x4A,0xC4,0x2A,0xA4,0x36,0xF7,0xD7,0xE6,0x85,0x7A,0xC3,0x59,0xC1,0x30,0x2D,0xCD,0x58,0xFF,0x52,0xDE,0x23,0x59,0xC1,0x40,0xE3,0x40,0xA2,0x30,
-	0xA2,0x38,0x63,0x69,0x63,0x69,0xC1,0x30,0x61,0x18,0xE2,0x30,0xA2,0x28,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x28,0xA2,0x38,0xE3,0x40,0x23,0x59,0xC3,0x58,0x23,0x59,0x23,0x59,0x63,0x69,0x07,0x8A,0x47,0xAA,0xC9,0xAA,0xC9,0xAA,0x47,0x92,0x85,0x71,0xE4,0x48,0xA1,0x28,
-	0x60,0x20,0x61,0x30,0x23,0x41,0x24,0x41,0x61,0x20,0x61,0x20,0xE3,0x30,0xA2,0x20,0x60,0x18,0x61,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x18,0xA2,0x28,0xA3,0x28,0xA2,0x28,0x62,0x20,0x61,0x20,0xA2,0x20,0x61,0x18,0xA2,0x20,0x61,0x10,0x61,0x18,0x20,0x08,0xAE,0x93,0x49,0x5A,0x20,0x08,0x20,0x10,0x20,0x10,0xA2,0x18,0x61,0x10,
-	0x20,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x60,0x18,0xA2,0x30,0x20,0x18,0x61,0x20,0x20,0x10,0xA1,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x18,0xA1,0x28,0xE3,0x38,0x94,0xC5,0x21,0x18,0x61,0x18,0x21,0x18,0x21,0x18,0xA2,0x28,0xAD,0xB4,0x58,0xFF,0x45,0x6A,0xA3,0x49,0x23,0x41,0x23,0x41,
-	0x62,0x39,0xD8,0xFF,0xD8,0xFF,0x2A,0xA4,0x85,0x7A,0x62,0x49,0x21,0x39,0xA5,0x69,0xA5,0x69,0x38,0xEF,0xFC,0xFF,0x36,0xF7,0x23,0x59,0xE3,0x40,0xE3,0x40,0x23,0x41,0xC1,0x40,0x63,0x69,0x44,0x81,0x62,0x49,0x61,0x28,0xE2,0x38,0xE2,0x38,0x60,0x20,0x60,0x08,0x60,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x30,0xC1,0x30,0xC1,0x40,0xC1,0x40,0xC1,0x40,0xE3,0x40,0x23,0x59,0x65,0x69,0x07,0x8A,0x47,0x92,0x47,0x92,0x07,0x8A,0xE7,0x79,0x65,0x69,0xA3,0x38,0x61,0x30,0xE3,0x40,0xE2,0x38,0x61,0x20,0x61,0x20,0x61,0x20,0x20,0x18,0x20,0x10,0xE3,0x28,0x20,0x10,0xA1,0x20,0x61,0x10,0x20,0x10,0x61,0x10,0x61,0x20,0xA2,0x28,0xE3,0x38,
-	0x24,0x39,0xE3,0x30,0xE3,0x30,0xA2,0x28,0xA2,0x20,0x61,0x18,0x20,0x08,0x61,0x10,0x61,0x18,0xA2,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x10,0x61,0x18,0xA1,0x18,0x61,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x18,0x61,0x20,0xA2,0x28,0x49,0x5A,0xAE,0x93,0x20,0x00,0x00,0x00,
-	0x20,0x08,0x20,0x10,0xE3,0x38,0xAE,0x93,0x12,0xAD,0x20,0x18,0x60,0x18,0x20,0x00,0x20,0x08,0x00,0x00,0xA7,0x49,0xD8,0xF6,0x06,0x8B,0xC1,0x30,0x62,0x49,0xC3,0x59,0x06,0x8B,0xD8,0xFF,0xFB,0xFF,0x89,0x93,0x23,0x59,0xA5,0x69,0x23,0x41,0x23,0x41,0x45,0x6A,0x52,0xDE,0x58,0xFF,0xEF,0xD5,0xA0,0x28,0xA2,0x38,0x62,0x49,0x23,0x59,
-	0xC3,0x58,0x03,0x69,0xC4,0x79,0x63,0x69,0xC4,0x79,0x47,0x92,0x85,0x71,0xA2,0x38,0xE2,0x30,0xE3,0x28,0xE3,0x28,0x62,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x28,0xA2,0x38,0xA2,0x30,0xA1,0x28,0xA2,0x30,0x64,0x49,0x85,0x71,0x07,0x8A,0x07,0x8A,0x07,0x8A,0xE7,0x79,0x65,0x69,0x03,0x69,0xC3,0x58,0xE3,0x40,0xE3,0x40,
-	0x60,0x28,0x61,0x20,0x61,0x18,0x61,0x18,0x60,0x10,0x20,0x10,0x23,0x29,0xA7,0x49,0x20,0x10,0x21,0x18,0x61,0x18,0xA1,0x20,0xA2,0x28,0xA2,0x28,0xE3,0x30,0xE3,0x30,0xA3,0x30,0x24,0x39,0xA3,0x30,0xE3,0x30,0x24,0x31,0x61,0x18,0x20,0x08,0x20,0x08,0x60,0x08,0x61,0x18,0xA2,0x20,0x20,0x10,0x60,0x10,0x20,0x08,0x20,0x10,0x20,0x08,
-	0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x60,0x10,0x65,0x49,0x61,0x20,0x20,0x08,0x50,0x9C,0x00,0x00,0x61,0x10,0xBD,0xF7,0xA2,0x38,0x21,0x28,0x61,0x28,0x60,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x18,0x94,0xC5,0x56,0xF6,0xE7,0x79,0x60,0x28,0x45,0x6A,
-	0xA2,0x51,0xEF,0xD5,0x94,0xC5,0xA0,0x20,0xE2,0x38,0xA3,0x49,0xA5,0x51,0xC3,0x59,0x62,0x49,0x06,0x8B,0x85,0x7A,0xE1,0x28,0x21,0x18,0xA2,0x28,0x62,0x49,0x65,0x69,0x63,0x69,0x63,0x69,0x44,0x81,0x47,0xAA,0x8B,0xD3,0x51,0xE5,0x8B,0xD3,0x65,0x69,0x65,0x59,0xA7,0x59,0x25,0x49,0x23,0x39,0x61,0x18,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x69,0x24,0x49,0xA1,0x28,0xA1,0x28,0xA2,0x28,0x65,0x69,0x07,0x8A,0x07,0x8A,0xE7,0x79,0x07,0x8A,0x85,0x71,0xC3,0x58,0x23,0x59,0xEC,0x8A,0xE4,0x48,0x21,0x28,0x61,0x20,0x61,0x18,0x60,0x18,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x08,0x20,0x10,0x60,0x10,0xA2,0x28,0xA3,0x28,0x24,0x41,0xE3,0x38,
-	0xA3,0x30,0xA2,0x28,0xA2,0x28,0x50,0x9C,0x24,0x39,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x18,0x62,0x18,0xA2,0x18,0x61,0x10,0x60,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x10,0x60,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x20,0xA2,0x20,0x69,0x72,0x49,0x5A,
-	0x20,0x08,0x61,0x10,0xA5,0x39,0x60,0x28,0xA9,0x92,0x23,0x59,0x24,0x41,0x61,0x10,0x20,0x00,0x20,0x08,0x20,0x08,0xC1,0x30,0xD7,0xE6,0x78,0xD6,0xC1,0x30,0xC1,0x30,0x85,0x7A,0x94,0xEE,0x2A,0xA4,0x60,0x10,0xA2,0x18,0xA1,0x20,0xA3,0x49,0x85,0x7A,0xA5,0x69,0x62,0x49,0x21,0x39,0xA2,0x20,0x61,0x18,0x45,0x6A,0xAD,0xB4,0x47,0x92,
-	0x85,0x71,0x44,0x81,0x44,0x81,0x47,0xAA,0xD3,0xF5,0x56,0xF6,0x6E,0xD4,0x07,0x8A,0xE7,0x79,0x85,0x71,0xA5,0x69,0x24,0x49,0xE3,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x30,0x24,0x49,0xA2,0x30,0x61,0x18,0xA1,0x20,0x65,0x49,0xE7,0x79,0xE7,0x79,0xE7,0x79,0x07,0x8A,0x47,0x92,0x65,0x69,0xA2,0x38,0xC1,0x40,0x62,0x30,0x61,0x20,
-	0x60,0x20,0x61,0x18,0x61,0x18,0x60,0x08,0x60,0x10,0x20,0x10,0x20,0x10,0x60,0x10,0x20,0x08,0x60,0x10,0x61,0x10,0x20,0x10,0x61,0x20,0xA2,0x28,0xE3,0x38,0x24,0x39,0x24,0x39,0xE3,0x30,0x61,0x20,0xA3,0x30,0xA2,0x20,0xA3,0x20,0xA1,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x10,0x61,0x10,0x21,0x18,0x61,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0xA2,0x18,0x61,0x10,0x61,0x10,0x20,0x08,0x60,0x10,0x20,0x10,0x20,0x08,0x60,0x10,0x61,0x18,0xA2,0x28,0x61,0x18,0x20,0x10,0x61,0x18,0xA2,0x18,0x20,0x28,0x47,0x92,0x61,0x30,0xA2,0x38,0x60,0x10,0x61,0x10,0x62,0x10,0x60,0x18,0xE3,0x30,0xA7,0x59,0x45,0x6A,0x65,0x49,0xC1,0x30,
-	0x89,0x93,0xFB,0xFF,0x52,0xDE,0x60,0x10,0x21,0x08,0x61,0x10,0xE1,0x28,0x85,0x7A,0x85,0x7A,0xC3,0x59,0xA3,0x49,0xE2,0x38,0x21,0x41,0x36,0xF7,0xD8,0xFF,0xEF,0xD5,0x65,0x59,0x65,0x69,0x63,0x69,0xA5,0x99,0x51,0xE5,0x56,0xF6,0x6E,0xD4,0xA5,0x99,0xE7,0x79,0xE7,0x79,0xE7,0x79,0x07,0x8A,0x65,0x59,0xA2,0x20,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC1,0x30,0xA2,0x38,0xA3,0x38,0x61,0x18,0x61,0x18,0xE2,0x28,0xA5,0x51,0xE7,0x79,0x47,0x92,0xC9,0xAA,0x47,0x92,0x23,0x59,0xA2,0x30,0xA2,0x28,0xA2,0x28,0x61,0x28,0xA1,0x20,0xA1,0x20,0x61,0x18,0x61,0x10,0x60,0x10,0x21,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x21,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0xA2,0x28,0xE3,0x38,0xA3,0x38,
-	0x24,0x39,0x24,0x41,0x24,0x41,0xE3,0x38,0xA3,0x28,0xA2,0x20,0x21,0x10,0x61,0x18,0x61,0x18,0x60,0x08,0x20,0x10,0x60,0x08,0x61,0x10,0x20,0x10,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x10,0xA2,0x20,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x10,0x60,0x10,0x60,0x10,0x61,0x18,0x61,0x20,
-	0x62,0x20,0xA1,0x20,0xA2,0x28,0xE3,0x40,0xE7,0x79,0xA2,0x38,0xE2,0x30,0x20,0x18,0x20,0x00,0x21,0x08,0x20,0x10,0xA1,0x18,0x61,0x20,0xE2,0x28,0xA5,0x51,0x64,0x49,0xA3,0x49,0x52,0xDE,0x2A,0xA4,0xE2,0x28,0x20,0x08,0x61,0x08,0xA1,0x18,0x64,0x49,0x85,0x7A,0xC3,0x59,0xA5,0x69,0xC3,0x59,0x06,0x8B,0xFB,0xFF,0xFC,0xFF,0x52,0xDE,
-	0x64,0x49,0x65,0x59,0x23,0x59,0x47,0x92,0xEF,0xD5,0xD3,0xF5,0x2D,0xCD,0x8B,0xD3,0x47,0xAA,0x07,0x8A,0xA9,0x92,0x4B,0xB3,0x07,0x8A,0x24,0x41,0xA2,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x40,0xA2,0x30,0xA2,0x30,0x61,0x28,0x20,0x10,0x60,0x20,0x65,0x49,0x47,0x92,0x47,0x92,0x07,0x8A,0x44,0x81,0xE4,0x48,0xA2,0x30,0xA2,0x28,0x61,0x28,0xA2,0x28,
-	0xA2,0x28,0xA2,0x28,0xA2,0x28,0xA2,0x20,0x61,0x18,0x21,0x18,0x20,0x10,0x60,0x10,0x21,0x10,0x61,0x20,0x62,0x20,0xA2,0x20,0xA2,0x20,0xE2,0x28,0xE3,0x30,0xE3,0x30,0xA3,0x30,0xA2,0x28,0xE2,0x30,0x24,0x31,0xA2,0x28,0xA2,0x20,0x61,0x18,0x21,0x20,0x50,0x9C,0x62,0x20,0x61,0x20,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x08,0xA1,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x10,0x60,0x10,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x18,0x61,0x10,0x61,0x10,0x21,0x08,0x61,0x18,0xE2,0x20,0x24,0x31,0xA1,0x28,0x65,0x59,0x64,0x49,0xE1,0x28,0x24,0x31,0xA1,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x60,0x10,0xE3,0x30,0x78,0xD6,0x69,0x72,0xE7,0x79,
-	0xE2,0x38,0xA3,0x39,0xC3,0x59,0x21,0x41,0xA0,0x18,0xE1,0x18,0xA5,0x39,0xA0,0x20,0xA5,0x69,0xA3,0x49,0xA3,0x39,0xE7,0x79,0x2A,0xA4,0xD8,0xF6,0xBD,0xFF,0x89,0x93,0x64,0x41,0x65,0x59,0xC4,0x79,0x4A,0xC4,0x51,0xE5,0xD3,0xF5,0xEF,0xD5,0x56,0xF6,0x51,0xE5,0x47,0x92,0xC9,0xAA,0xC9,0xAA,0xE7,0x79,0x65,0x59,0x24,0x39,0x61,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE2,0x30,0xE3,0x40,0x24,0x49,0xE3,0x40,0xA2,0x38,0xA2,0x38,0xA3,0x38,0x23,0x59,0x66,0x69,0x03,0x69,0x24,0x49,0xA2,0x30,0xA2,0x30,0x61,0x28,0xA2,0x30,0xE2,0x30,0xE2,0x30,0xA2,0x28,0xA3,0x30,0xE3,0x30,0xE3,0x30,0xA2,0x28,0xA2,0x20,0x61,0x18,0x61,0x18,0x61,0x18,0x20,0x10,0x61,0x10,0x20,0x10,0x61,0x18,0xA2,0x20,0xA2,0x28,
-	0xE3,0x28,0xA2,0x20,0xA2,0x20,0xA1,0x20,0x24,0x31,0x61,0x18,0x21,0x10,0x20,0x08,0x65,0x39,0x61,0x20,0xE3,0x38,0xE3,0x38,0xE3,0x30,0x62,0x20,0xA2,0x20,0xA2,0x20,0x62,0x20,0x21,0x10,0x61,0x18,0x62,0x20,0x61,0x18,0x61,0x20,0x61,0x28,0xA2,0x28,0xE3,0x28,0x24,0x41,0x24,0x39,0xE3,0x38,0xA2,0x30,0x61,0x20,0xA1,0x18,0x21,0x10,
-	0xA2,0x20,0x24,0x39,0xE2,0x30,0xA5,0x69,0xEE,0xBB,0x61,0x10,0xE2,0x28,0xE3,0x30,0x20,0x08,0x00,0x00,0x20,0x00,0x60,0x08,0xA1,0x20,0x6D,0x7B,0x29,0x7B,0xFC,0xFF,0x49,0x5A,0x23,0x41,0xC3,0x59,0xA2,0x51,0x2A,0xA4,0x3A,0xEF,0x3A,0xEF,0xA1,0x20,0x23,0x39,0xA5,0x69,0x23,0x41,0x65,0x59,0xC4,0x79,0x87,0xAB,0x06,0x8B,0x25,0x49,
-	0x65,0x49,0x65,0x59,0x47,0x92,0x51,0xE5,0xD3,0xF5,0x51,0xE5,0xD3,0xF5,0x36,0xF7,0xD3,0xF5,0xA5,0x99,0x85,0x71,0x07,0x8A,0x66,0x69,0x65,0x59,0x24,0x49,0xA1,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0x85,0x71,0x24,0x49,0x62,0x30,0xE3,0x40,0xC1,0x40,0xE4,0x48,0xA2,0x38,0x61,0x30,0xA2,0x30,0xA1,0x28,0xA3,0x30,0xE2,0x30,
-	0xA5,0x51,0x65,0x59,0x24,0x39,0x24,0x39,0xE3,0x38,0xE2,0x28,0x61,0x18,0x20,0x08,0x20,0x10,0x60,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x18,0x61,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x18,0x61,0x10,0xA2,0x20,0xA1,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x60,0x08,0x20,0x10,0x60,0x18,0xE3,0x30,0x61,0x20,0x20,0x10,0x20,0x00,
-	0x20,0x08,0x60,0x08,0x21,0x10,0x60,0x10,0xA2,0x20,0xE3,0x30,0x61,0x28,0xA2,0x20,0xE2,0x28,0xE3,0x38,0x24,0x41,0x66,0x51,0x65,0x59,0x24,0x41,0xE3,0x30,0xA2,0x20,0xA1,0x20,0xE2,0x28,0xE4,0x48,0x69,0x72,0x16,0xCE,0xA3,0x28,0xA2,0x20,0x23,0x29,0xA1,0x18,0x00,0x00,0x00,0x00,0x21,0x08,0xA1,0x20,0xA1,0x28,0x24,0x5A,0x94,0xC5,
-	0x64,0x49,0xA5,0x69,0x87,0xAB,0x06,0x8B,0xD8,0xFF,0xFB,0xFF,0xD7,0xE6,0xA1,0x18,0xE2,0x30,0xA5,0x51,0xC3,0x59,0xA5,0x51,0x64,0x49,0x45,0x6A,0x45,0x6A,0xA5,0x69,0x66,0x41,0x24,0x41,0xE7,0x79,0x4A,0xC4,0x51,0xE5,0x4A,0xC4,0xEF,0xD5,0x94,0xEE,0x52,0xDE,0x44,0x81,0x65,0x69,0x65,0x69,0x85,0x71,0xE7,0x79,0x65,0x69,0xA2,0x28,
-	0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA1,0x28,0x60,0x20,0x61,0x20,0xA2,0x30,0x62,0x30,0x4B,0xB3,0x61,0x28,0xE4,0x48,0xA2,0x38,0xC1,0x40,0xA2,0x38,0xA2,0x38,0xA3,0x38,0xE3,0x38,0xE4,0x48,0xA7,0x59,0x94,0xC5,0xE3,0x38,0xE2,0x28,0xE2,0x30,0xE3,0x30,0xA2,0x28,0xA1,0x18,0x20,0x10,0x20,0x10,0x61,0x10,0x21,0x10,0x60,0x10,0x60,0x10,0x60,0x10,0x21,0x10,0x60,0x10,
-	0x61,0x10,0x60,0x08,0x61,0x08,0x60,0x08,0x20,0x00,0x20,0x08,0x62,0x18,0x61,0x18,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x10,0x20,0x10,0xE2,0x28,0x21,0x18,0x16,0xCE,0x60,0x08,0x20,0x00,0x61,0x10,0x61,0x10,0xA1,0x10,0xE3,0x20,0xE4,0x30,0xA2,0x28,0xE2,0x20,0xA3,0x28,0xE2,0x28,0xA3,0x28,0x24,0x41,0xE3,0x38,0xE2,0x28,0x24,0x31,
-	0xE3,0x30,0x24,0x39,0xE4,0x48,0x85,0x71,0x61,0x30,0xA2,0x20,0xA3,0x28,0xA1,0x18,0xA2,0x20,0x60,0x08,0x00,0x00,0x20,0x08,0x62,0x18,0xE2,0x28,0xE2,0x30,0xA2,0x28,0x63,0x69,0x87,0xAB,0x4A,0xC4,0x52,0xDE,0xFC,0xFF,0xFC,0xF7,0xEF,0xD5,0x62,0x39,0x24,0x39,0xA5,0x51,0x45,0x6A,0x85,0x7A,0x45,0x6A,0x62,0x49,0x06,0x8B,0x85,0x7A,
-	0x24,0x39,0xE3,0x28,0x24,0x31,0xC4,0x79,0x87,0xAB,0x8B,0xD3,0x2D,0xCD,0x36,0xF7,0x36,0xF7,0x6E,0xD4,0xA5,0x99,0x24,0x41,0x85,0x71,0xA9,0x92,0x07,0x8A,0x65,0x59,0xA2,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x30,0x60,0x20,0xE3,0x38,0xA7,0x59,0x20,0x20,0x65,0x59,0x61,0x28,0xA2,0x38,0x24,0x49,0x65,0x59,0x6E,0xD4,0x61,0x30,0xA2,0x30,0xA2,0x28,0xA2,0x30,0xA2,0x30,
-	0x24,0x49,0xE3,0x38,0xE2,0x30,0xE3,0x38,0xE4,0x48,0x65,0x49,0x24,0x41,0x61,0x20,0x61,0x20,0x61,0x18,0x60,0x10,0x61,0x10,0x60,0x10,0x21,0x18,0x60,0x10,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x12,0xAD,0x00,0x00,0x20,0x08,0x20,0x08,0xA2,0x18,0x60,0x10,0x21,0x10,0x20,0x10,0x60,0x08,0x60,0x08,0x20,0x10,0x61,0x18,0x65,0x39,
-	0x21,0x10,0x21,0x10,0x61,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xE3,0x28,0x24,0x31,0x24,0x41,0xE3,0x30,0xE3,0x28,0xE3,0x28,0xE3,0x30,0x24,0x41,0xA3,0x30,0xA1,0x20,0xA2,0x20,0xA2,0x20,0x23,0x39,0x85,0x71,0xE7,0x79,0x61,0x20,0x61,0x18,0x62,0x18,0x61,0x10,0xA2,0x20,0x20,0x08,0x20,0x08,0xA1,0x10,0x62,0x18,0xE3,0x30,0xE3,0x40,
-	0x85,0x7A,0xEF,0xD5,0x2D,0xCD,0x94,0xEE,0xFC,0xFF,0xFB,0xFF,0x85,0x7A,0xE2,0x30,0xE3,0x38,0x64,0x41,0x29,0x7B,0xD8,0xFF,0x36,0xF7,0x2A,0xA4,0x45,0x6A,0x85,0x7A,0xA3,0x49,0xE2,0x20,0xA1,0x20,0x23,0x59,0x2D,0xCD,0xD3,0xF5,0x36,0xF7,0x58,0xFF,0xD8,0xFF,0x36,0xF7,0xC9,0xAA,0xA2,0x38,0x66,0x69,0xC8,0xC2,0x4B,0xB3,0xA9,0x92,
-	0x24,0x39,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEC,0x8A,0xA2,0x38,0xE3,0x40,0x65,0x59,0xA2,0x30,0x24,0x49,0xE4,0x48,0xE4,0x48,0xA2,0x30,0xE2,0x38,0x66,0x51,0x21,0x28,0x60,0x18,0xA2,0x20,0x62,0x20,0xA2,0x30,0xE3,0x30,0x23,0x39,0x24,0x41,0x24,0x49,0xE3,0x38,0xA2,0x28,0x24,0x39,0xA3,0x38,0xE3,0x38,0x21,0x18,0x61,0x18,0xA1,0x20,0x62,0x20,0x61,0x18,0x20,0x10,0x20,0x10,
-	0x20,0x08,0x20,0x08,0x61,0x10,0x25,0x21,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x10,0x61,0x18,0x61,0x18,0x20,0x10,0x20,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0xA1,0x18,0x61,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x20,0x24,0x39,0x66,0x51,0x65,0x41,0xE3,0x28,0xE2,0x20,0xA2,0x20,0xE3,0x30,0x65,0x49,0xA1,0x20,
-	0xA2,0x20,0xA2,0x20,0xA1,0x10,0x61,0x20,0xE7,0x79,0xEE,0xBB,0x49,0x5A,0x60,0x08,0x20,0x10,0xA1,0x18,0xA2,0x20,0x20,0x08,0x61,0x10,0xA2,0x10,0xA2,0x28,0xC7,0x69,0x89,0x93,0xFB,0xFF,0xD8,0xFF,0x52,0xDE,0xD8,0xFF,0xEF,0xD5,0x2A,0xA4,0xC3,0x59,0xE2,0x20,0xA1,0x28,0x29,0x7B,0xFB,0xFF,0xFB,0xFF,0x2A,0xA4,0xA2,0x30,0xA5,0x51,
-	0xA5,0x51,0xE1,0x20,0xA1,0x20,0xE7,0x79,0x56,0xF6,0xD8,0xFF,0xFB,0xFF,0xD8,0xFF,0x58,0xFF,0xD3,0xF5,0xC4,0x79,0xC1,0x40,0x07,0x8A,0x6E,0xD4,0x6E,0xD4,0xEE,0xBB,0x65,0x49,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x48,0x65,0x59,0xEE,0xBB,0xE4,0x48,0x66,0x69,0x24,0x49,0xC1,0x40,0xC3,0x58,0x61,0x30,0xE3,0x38,0xA9,0x92,0x61,0x28,0x61,0x20,0x61,0x28,0xA2,0x28,0xE3,0x38,
-	0x24,0x39,0x23,0x39,0xE2,0x28,0xE3,0x30,0xE2,0x28,0xA2,0x20,0xA1,0x20,0x60,0x10,0xE2,0x28,0xA2,0x28,0xA2,0x28,0x21,0x10,0x60,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0x20,0x08,0x00,0x00,0xA1,0x10,0x20,0x08,0x20,0x08,0x21,0x10,0x60,0x10,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0xA2,0x18,0xA2,0x20,0xA3,0x28,0x61,0x10,0x61,0x10,0xE2,0x20,0xE2,0x20,0xE3,0x28,0xE3,0x30,0xA7,0x59,0x24,0x39,0xE4,0x28,0x24,0x31,0x49,0x5A,0xE3,0x30,0x24,0x39,0xA2,0x20,0x61,0x18,0x21,0x10,0x60,0x10,0xA2,0x30,0xEC,0x8A,0xA2,0x28,0x60,0x08,0x61,0x10,0x21,0x10,0xA2,0x20,0xA0,0x20,0x20,0x10,0x62,0x18,0xA2,0x20,0x23,0x41,
-	0x2A,0xA4,0xFD,0xFF,0xD8,0xFF,0x38,0xEF,0xBB,0xF7,0x36,0xF7,0xD8,0xFF,0x89,0x93,0x21,0x39,0x60,0x18,0x24,0x5A,0xD7,0xE6,0xD8,0xFF,0xA3,0x49,0xE3,0x28,0xE3,0x30,0xA5,0x51,0xE2,0x28,0x61,0x10,0x65,0x49,0x51,0xE5,0xBA,0xFF,0xD8,0xFF,0xD8,0xF6,0xD3,0xF5,0x47,0xAA,0xC3,0x58,0xC1,0x40,0xE7,0x79,0x4B,0xB3,0x8B,0xD3,0xEE,0xBB,
-	0x24,0x49,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA3,0x38,0xA9,0x92,0x66,0x51,0xE4,0x48,0xA2,0x38,0xA2,0x38,0x66,0x69,0x4B,0xB3,0x65,0x59,0x24,0x49,0xE4,0x48,0x65,0x59,0xC7,0x69,0xE3,0x40,0xA2,0x30,0xA2,0x30,0xA1,0x28,0xA2,0x28,0xA2,0x28,0xA2,0x28,0xE2,0x20,0xA2,0x18,0xA1,0x18,0x20,0x10,0x60,0x10,0x21,0x18,0xA2,0x28,0x62,0x20,0x61,0x18,0x20,0x10,0x20,0x08,0x00,0x00,
-	0x20,0x00,0x20,0x08,0x61,0x10,0x20,0x08,0x50,0x9C,0x49,0x5A,0x62,0x18,0x60,0x10,0x60,0x10,0x21,0x10,0x61,0x18,0x21,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0xA1,0x18,0x24,0x31,0xCB,0x62,0xE8,0x49,0x62,0x18,0xE2,0x20,0xE3,0x28,0x65,0x41,0x3A,0xEF,0x24,0x41,0xA2,0x28,0x12,0xAD,0xE8,0x49,0xA2,0x20,0x65,0x41,
-	0xE3,0x30,0x65,0x39,0x50,0x9C,0x20,0x10,0xA1,0x10,0xA2,0x30,0xA2,0x30,0x20,0x10,0x20,0x10,0x61,0x08,0x61,0x18,0xE3,0x28,0x61,0x20,0x21,0x18,0x20,0x08,0xA0,0x20,0xC4,0x79,0xD8,0xF6,0xFC,0xFF,0xFB,0xFF,0x16,0xCE,0xAD,0xB4,0x58,0xFF,0xA3,0x39,0xC3,0x59,0xA0,0x28,0x20,0x08,0xA5,0x39,0x45,0x6A,0xE0,0x20,0xA2,0x20,0xA1,0x20,
-	0x62,0x39,0xA3,0x39,0x60,0x10,0x61,0x18,0xA5,0x69,0x4A,0xC4,0x51,0xE5,0x51,0xE5,0x4A,0xC4,0xC4,0x79,0xA1,0x28,0xE2,0x28,0x65,0x59,0xA9,0x92,0xEE,0xBB,0xC9,0xAA,0x24,0x41,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x38,0xE4,0x30,0x21,0x28,0x61,0x20,0x61,0x20,0xA2,0x28,0xA2,0x30,0xA3,0x38,0x24,0x49,0x20,0x20,0xA2,0x30,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0xE3,0x38,
-	0x24,0x49,0xE3,0x38,0xA7,0x59,0x65,0x49,0x21,0x20,0x60,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x60,0x10,0x20,0x10,0x20,0x18,0xA1,0x20,0x61,0x18,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x31,0x21,0x10,0x60,0x10,0x20,0x10,0x61,0x10,0xE2,0x20,0xE3,0x28,0xE2,0x28,0x61,0x10,0xA1,0x18,0x60,0x10,0x00,0x00,
-	0x60,0x08,0x61,0x10,0xE2,0x20,0x69,0x72,0x23,0x39,0xA1,0x20,0xA2,0x20,0xE3,0x28,0xE3,0x20,0x65,0x41,0x24,0x41,0xA3,0x30,0xE3,0x28,0xA2,0x20,0xA2,0x20,0xA3,0x28,0x24,0x39,0xA3,0x28,0x65,0x31,0x61,0x10,0x61,0x10,0xA1,0x18,0xA2,0x28,0xE3,0x30,0x00,0x00,0x21,0x10,0x61,0x10,0x61,0x20,0xE2,0x30,0x61,0x20,0xC5,0x49,0x49,0x5A,
-	0x21,0x39,0xD7,0xE6,0xFB,0xFF,0x12,0xAD,0x00,0x00,0xE1,0x18,0xE2,0x30,0x60,0x18,0x45,0x6A,0x89,0x93,0x20,0x10,0x20,0x18,0xC5,0x49,0xA0,0x20,0x21,0x10,0x60,0x08,0xE0,0x20,0xC3,0x59,0xE1,0x28,0x60,0x08,0x61,0x20,0xA2,0x28,0xC3,0x58,0x47,0xAA,0x2D,0xCD,0x87,0xAB,0x21,0x41,0x61,0x18,0xE3,0x40,0xC9,0xAA,0x6E,0xD4,0x4B,0xB3,
-	0x64,0x41,0x20,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x10,0x61,0x18,0x20,0x10,0x61,0x18,0xA1,0x18,0x61,0x18,0x20,0x18,0xA2,0x30,0x65,0x59,0x61,0x30,0x21,0x20,0x61,0x18,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x24,0x41,0xA1,0x28,0x69,0x72,0x24,0x49,0x24,0x41,0x24,0x41,0x62,0x20,0x61,0x20,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x20,0x61,0x18,0xA2,0x20,0x61,0x18,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0xA2,0x20,0x61,0x10,0xA1,0x10,0x61,0x18,0x60,0x18,0xA1,0x20,0xA2,0x20,0x24,0x39,0xA2,0x20,0xA3,0x20,0xE3,0x28,0x24,0x29,0xE3,0x28,0x24,0x39,0xA3,0x28,0xA2,0x20,0xA2,0x18,0xA1,0x18,
-	0xA2,0x20,0x62,0x20,0x20,0x08,0x60,0x10,0x21,0x10,0x60,0x10,0xE2,0x28,0x7C,0xF7,0x49,0x5A,0x24,0x31,0x60,0x10,0x61,0x18,0xA1,0x20,0xA1,0x20,0x50,0x9C,0xAE,0x93,0xE0,0x28,0xD8,0xFF,0xFB,0xFF,0xFB,0xFF,0x21,0x39,0xE1,0x28,0x45,0x6A,0x85,0x7A,0xA5,0x69,0xA2,0x51,0x62,0x39,0x20,0x10,0x62,0x39,0xE1,0x28,0x20,0x08,0x20,0x08,
-	0x29,0x7B,0x38,0xEF,0xAD,0xB4,0xE1,0x28,0x61,0x18,0x61,0x18,0xA0,0x28,0x87,0xAB,0x94,0xEE,0xD3,0xF5,0x85,0x7A,0x23,0x41,0xA5,0x69,0x4B,0xB3,0xEE,0xBB,0x4B,0xB3,0xC7,0x69,0xA1,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x18,0x60,0x10,0x61,0x08,0x20,0x08,0x60,0x08,0x61,0x18,0x60,0x10,0xA2,0x38,0xE7,0x79,0x61,0x28,0x60,0x20,0x61,0x18,0x20,0x10,0x60,0x08,0x20,0x08,0x20,0x08,
-	0xEC,0x8A,0x60,0x10,0x20,0x18,0x94,0xC5,0x20,0x10,0x60,0x10,0x61,0x18,0xA2,0x28,0xA2,0x28,0x61,0x20,0x61,0x18,0x61,0x10,0x61,0x18,0x20,0x10,0x61,0x18,0x62,0x18,0xA3,0x28,0xA2,0x18,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x10,0x61,0x18,0x20,0x08,0x20,0x08,
-	0x61,0x10,0x24,0x31,0xE3,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE3,0x30,0xE2,0x28,0xA2,0x20,0xE3,0x20,0xE3,0x20,0xA2,0x20,0xE2,0x28,0xA3,0x20,0xA1,0x18,0xA1,0x10,0xA2,0x18,0x49,0x5A,0x20,0x08,0x20,0x10,0x61,0x08,0x21,0x10,0xE3,0x28,0x49,0x5A,0xFE,0xFF,0xC5,0x49,0x61,0x18,0x61,0x18,0x60,0x10,0xA2,0x28,0xA2,0x28,0x62,0x08,
-	0xA1,0x18,0xAD,0xB4,0xD8,0xFF,0x36,0xF7,0x24,0x5A,0xC5,0x49,0x23,0x29,0x21,0x39,0xE1,0x18,0x21,0x39,0x24,0x5A,0xA0,0x20,0xA3,0x39,0x21,0x29,0x20,0x10,0x60,0x10,0xD7,0xE6,0xFC,0xFF,0xBA,0xFF,0xA3,0x39,0xA1,0x20,0x61,0x20,0xA0,0x20,0x06,0x8B,0x36,0xF7,0x94,0xEE,0x87,0xAB,0x47,0x92,0x4B,0xB3,0x6E,0xD4,0x8B,0xD3,0x4B,0xB3,
-	0xE7,0x79,0xA0,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x18,0x61,0x10,0x61,0x20,0x21,0x28,0xA9,0x92,0x20,0x28,0x61,0x28,0x23,0x39,0x61,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x62,0x18,0x20,0x10,0x50,0x9C,0x20,0x00,0x20,0x08,0x20,0x08,0x21,0x18,0x21,0x18,0x61,0x20,0xA1,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x20,0x10,0x20,0x00,
-	0x20,0x10,0x61,0x18,0x62,0x20,0x21,0x18,0x21,0x10,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x60,0x10,0x60,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0xA2,0x20,0x24,0x39,0x23,0x39,0xE3,0x38,0xE3,0x38,0xE3,0x30,0x61,0x18,0x62,0x10,0x61,0x08,0x61,0x10,0x61,0x20,0xA2,0x20,0x60,0x08,
-	0x20,0x00,0x16,0xCE,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x60,0x10,0xA1,0x20,0x64,0x41,0x62,0x20,0x61,0x18,0xA2,0x28,0x21,0x18,0x60,0x18,0xE2,0x28,0xA2,0x18,0x21,0x00,0x21,0x39,0x87,0xAB,0x06,0x8B,0xE0,0x28,0x61,0x18,0x20,0x08,0xA0,0x18,0x23,0x29,0x20,0x08,0xA3,0x49,0x62,0x49,0xA3,0x49,0x62,0x49,0xA0,0x18,0x20,0x08,
-	0xAD,0xB4,0xD8,0xFF,0x52,0xDE,0xC1,0x30,0xE2,0x30,0xA2,0x28,0x60,0x20,0x21,0x41,0x4A,0xC4,0x4A,0xC4,0x87,0xAB,0x4A,0xC4,0x4A,0xC4,0x6E,0xD4,0x8B,0xD3,0x07,0x8A,0x23,0x39,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x20,0x00,0x20,0x08,0x21,0x10,0x21,0x20,0x61,0x18,0x61,0x20,0x60,0x20,0x69,0x72,0x62,0x30,0xA2,0x28,0x69,0x72,0x61,0x20,0xA2,0x20,0xA3,0x20,0x60,0x18,
-	0xA2,0x20,0x61,0x18,0x21,0x10,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x10,0x61,0x18,0x20,0x10,0x20,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x60,0x08,0xA5,0x39,0x12,0xAD,0x61,0x18,0x20,0x10,0x61,0x18,0xA1,0x18,0x20,0x10,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x10,0x61,0x10,0x20,0x08,
-	0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x10,0xA1,0x18,0xA2,0x20,0xE3,0x30,0x64,0x41,0x24,0x49,0x61,0x20,0x21,0x18,0x20,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0xA1,0x18,0x20,0x00,0x21,0x08,0xA2,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0xA2,0x20,0xE3,0x28,0x60,0x10,0x20,0x10,0xA1,0x18,0xA1,0x20,0xE2,0x28,0x60,0x10,0xA1,0x20,
-	0x61,0x10,0xA0,0x20,0x06,0x8B,0x4A,0xC4,0x45,0x6A,0x24,0x5A,0x20,0x08,0x20,0x08,0xE2,0x20,0x60,0x10,0xC5,0x49,0x24,0x5A,0xA2,0x51,0xA3,0x49,0x64,0x41,0xA1,0x28,0xA0,0x28,0x45,0x6A,0x62,0x39,0x61,0x20,0xA2,0x30,0xE2,0x38,0xA0,0x20,0x21,0x41,0xC3,0x59,0x47,0xAA,0x87,0xAB,0x2D,0xCD,0xD3,0xF5,0x56,0xF6,0x4B,0xB3,0xE2,0x28,
-	0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x20,0x08,0x20,0x10,0x61,0x18,0x21,0x18,0x62,0x20,0xA2,0x28,0x61,0x20,0x61,0x20,0x61,0x20,0xA2,0x28,0xE3,0x30,0xA2,0x30,0x61,0x20,0x60,0x20,0x61,0x30,0xE4,0x48,0xAE,0x93,0xE3,0x28,0xA2,0x20,0xA1,0x18,0x21,0x10,0x20,0x10,0x20,0x10,0x16,0xCE,0xA3,0x20,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x00,0x60,0x00,0x60,0x00,0xE3,0x18,0x25,0x29,0xA2,0x20,0x60,0x18,0x20,0x10,0x20,0x10,0x60,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x18,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x08,0x60,0x10,0x60,0x10,0x61,0x18,0xA1,0x20,0xE3,0x38,0x65,0x41,0xA3,0x28,0x20,0x08,0x60,0x08,0x00,0x00,0x61,0x18,
-	0x21,0x08,0x00,0x00,0x61,0x10,0xA1,0x10,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x10,0xA7,0x59,0x61,0x18,0x61,0x08,0x20,0x00,0x20,0x08,0xA1,0x20,0xA2,0x18,0x23,0x39,0xA5,0x51,0xBD,0xFF,0x36,0xF7,0x2D,0xCD,0xD8,0xFF,0x38,0xEF,0xA5,0x39,0x20,0x08,0x60,0x10,0xE1,0x20,0xBB,0xF7,0xD7,0xE6,0x2A,0xA4,0x85,0x7A,0x23,0x41,0x64,0x41,
-	0xAD,0xB4,0x52,0xDE,0x2A,0xA4,0xA2,0x30,0xA2,0x28,0xE2,0x38,0x21,0x41,0x21,0x41,0x85,0x7A,0x2D,0xCD,0x87,0xAB,0x51,0xE5,0x58,0xFF,0x36,0xF7,0xAD,0xB4,0xA1,0x28,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x18,0x20,0x08,0x60,0x18,0x61,0x18,0xA2,0x28,0xA2,0x20,0x61,0x20,0x61,0x20,0x61,0x18,0x61,0x18,0x21,0x10,0x21,0x18,0x21,0x10,0x62,0x18,0x24,0x41,0xA2,0x38,
-	0x24,0x49,0x24,0x41,0x20,0x08,0x20,0x10,0x62,0x18,0xA1,0x18,0x61,0x18,0x21,0x18,0xE4,0x30,0xA2,0x28,0xA2,0x18,0x20,0x10,0x60,0x10,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0xA2,0x28,0xA7,0x59,0xA1,0x28,0x61,0x18,0x20,0x10,0x00,0x00,0x20,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x21,0x08,
-	0x61,0x18,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0xA2,0x20,0xA3,0x28,0x61,0x18,0xE3,0x28,0xA1,0x10,0x20,0x10,0xA2,0x18,0x20,0x08,0x20,0x08,0xA2,0x28,0xE3,0x30,0xE3,0x28,0xA2,0x20,0xE3,0x28,0x65,0x49,0x20,0x08,0x60,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,
-	0x69,0x72,0x38,0xEF,0xFC,0xFF,0xFE,0xF7,0xFD,0xFF,0xFC,0xFF,0x45,0x6A,0xE1,0x18,0x23,0x29,0x62,0x39,0x16,0xCE,0xFC,0xFF,0xFC,0xFF,0xAD,0xB4,0xA5,0x69,0x45,0x6A,0xBA,0xFF,0xFC,0xFF,0xD7,0xE6,0xC1,0x30,0xA1,0x20,0xE1,0x28,0x85,0x7A,0x87,0xAB,0x36,0xF7,0xD8,0xFF,0xEF,0xD5,0xEF,0xD5,0xD8,0xFF,0x58,0xFF,0xAD,0xB4,0x21,0x41,
-	0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x20,0x61,0x18,0x62,0x20,0x61,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x18,0x61,0x18,0x61,0x10,0x60,0x10,0x60,0x10,0x20,0x10,0x20,0x10,0x61,0x20,0x61,0x28,0x61,0x20,0x61,0x20,0xE3,0x20,0xE3,0x28,0x62,0x20,0x61,0x18,0x61,0x20,0x21,0x20,0x20,0x10,0x20,0x10,0x61,0x18,0x61,0x18,0x62,0x20,0xA1,0x18,0xA3,0x20,0xA2,0x18,
-	0xA1,0x10,0x61,0x10,0x21,0x10,0xA1,0x10,0x62,0x10,0xA2,0x28,0xE3,0x38,0x61,0x20,0xE3,0x30,0xA2,0x20,0x50,0x9C,0xE2,0x18,0x20,0x08,0xE3,0x20,0xA7,0x39,0x20,0x08,0xA1,0x18,0x62,0x20,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0xA1,0x10,0x61,0x18,0x60,0x10,0x61,0x10,0xA2,0x18,0xA2,0x20,
-	0x23,0x29,0x24,0x41,0xA2,0x28,0xA7,0x59,0xA2,0x20,0x61,0x18,0x61,0x10,0xE3,0x20,0x65,0x41,0xA2,0x20,0x20,0x08,0x60,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0xA0,0x10,0x45,0x6A,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0x3A,0xEF,0xC5,0x49,0xA0,0x20,0xA0,0x10,0x24,0x5A,0x45,0x6A,0x38,0xEF,0xFB,0xFF,0x45,0x6A,0x06,0x8B,0x87,0xAB,
-	0x58,0xFF,0xD8,0xFF,0xAD,0xB4,0x21,0x41,0xA0,0x20,0x65,0x59,0xEF,0xD5,0xD8,0xFF,0xFB,0xFF,0xFB,0xFF,0xEF,0xD5,0x4A,0xC4,0x94,0xEE,0x94,0xEE,0xC9,0xAA,0xC1,0x30,0x60,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x28,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x20,0x61,0x20,0x61,0x18,0x61,0x20,0x60,0x10,0x21,0x10,0x20,0x10,0x61,0x18,0x61,0x18,0xA2,0x18,0x21,0x10,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x60,0x08,0x61,0x10,0xA2,0x20,0xE3,0x30,0xE3,0x28,0x62,0x20,0x62,0x18,0x61,0x18,0x61,0x18,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0xA2,0x18,0xA1,0x28,0xA2,0x30,0x60,0x20,0x61,0x18,0xE3,0x28,0x16,0xCE,0x49,0x5A,0xA1,0x10,0x65,0x39,0xA7,0x39,0x20,0x08,
-	0x20,0x00,0xA2,0x20,0x61,0x18,0x61,0x18,0x20,0x08,0x61,0x10,0x00,0x00,0x60,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0xA2,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0x62,0x18,0x94,0xC5,0xA5,0x51,0x20,0x08,0x60,0x10,0x61,0x10,0x20,0x00,0x20,0x08,0x20,0x08,0xE2,0x20,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,
-	0xE2,0x10,0x85,0x7A,0x94,0xC5,0xBB,0xF7,0x58,0xFF,0x29,0x7B,0x62,0x39,0x21,0x29,0x16,0xCE,0xFC,0xF7,0x2A,0xA4,0x06,0x8B,0x45,0x6A,0xA5,0x69,0x87,0xAB,0x2D,0xCD,0xD3,0xF5,0x51,0xE5,0x62,0x49,0x21,0x41,0x62,0x49,0x85,0x7A,0x94,0xEE,0xFB,0xFF,0xFB,0xFF,0x94,0xEE,0x85,0x7A,0x45,0x6A,0x87,0xAB,0x87,0xAB,0x2A,0xA4,0x45,0x6A,
-	0xA1,0x20,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x18,0x60,0x10,0x21,0x18,0x61,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x18,0x20,0x18,0x61,0x18,0xE3,0x28,0x62,0x18,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x10,0x21,0x10,0x60,0x10,0x20,0x10,0x20,0x10,0x62,0x18,0xE2,0x28,0xA2,0x18,0xA1,0x10,
-	0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x08,0x20,0x10,0xA7,0x59,0x20,0x18,0xA3,0x28,0x61,0x20,0x61,0x18,0x24,0x31,0x50,0x9C,0xAE,0x93,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0xE3,0x28,0x60,0x10,0x12,0xAD,0x62,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x61,0x10,0xA2,0x20,0x00,0x00,0x20,0x08,
-	0x20,0x00,0xE3,0x20,0x62,0x18,0x61,0x10,0x20,0x08,0x21,0x08,0x61,0x10,0x20,0x08,0x12,0xAD,0xA7,0x49,0xE2,0x18,0x50,0x9C,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x21,0x29,0x2A,0xA4,0x45,0x6A,0x85,0x7A,0xE0,0x20,0x62,0x39,0x3A,0xEF,0xFE,0xFF,0xFD,0xFF,0x24,0x5A,0xA2,0x51,0x06,0x8B,0x62,0x49,0x4A,0xC4,0x51,0xE5,
-	0xD3,0xF5,0x2D,0xCD,0x06,0x8B,0x4A,0xC4,0x2A,0xA4,0x06,0x8B,0x36,0xF7,0xFB,0xFF,0x58,0xFF,0x4A,0xC4,0xA2,0x51,0x21,0x41,0x62,0x39,0x06,0x8B,0xBA,0xFF,0x94,0xEE,0x21,0x39,0x60,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x18,0x61,0x18,0xA1,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0xA2,0x28,0xA2,0x20,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x60,0x10,0xA2,0x20,0x24,0x29,0xE3,0x28,0xE4,0x48,0xE3,0x30,0x61,0x10,0x20,0x10,0x61,0x10,0xA1,0x18,0x61,0x18,0x21,0x18,0x60,0x20,0xA1,0x20,0xA1,0x18,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x20,0xA2,0x20,0x60,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0xA1,0x10,0xA2,0x20,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0xA2,0x18,0x20,0x08,0x20,0x08,0x60,0x08,0x00,0x00,0x12,0xAD,0x62,0x10,0x94,0xC5,0x94,0xC5,0x24,0x21,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x00,0xA5,0x39,0xFD,0xFF,0x52,0xDE,0x2A,0xA4,0x45,0x6A,0x89,0x93,0xFE,0xFF,0xFE,0xFF,0xD7,0xE6,0x45,0x6A,0x58,0xFF,0xBD,0xFF,0x69,0x72,0xE7,0x79,0x87,0xAB,0x2D,0xCD,0x6E,0xD4,0x94,0xEE,0xD8,0xFF,0x36,0xF7,0x36,0xF7,0xFB,0xFF,0xFC,0xFF,0x58,0xFF,0x4A,0xC4,0x62,0x49,0xE2,0x20,0xA0,0x18,0x2A,0xA4,0xFC,0xFF,0xFB,0xFF,
-	0x89,0x93,0x60,0x18,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x20,0x60,0x18,0x20,0x18,0x61,0x28,0xA2,0x28,0xE3,0x38,0xE2,0x28,0x61,0x18,0x20,0x10,0x60,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x18,0xE2,0x20,0xE4,0x28,
-	0x62,0x18,0x61,0x08,0x20,0x10,0x20,0x08,0x00,0x00,0x20,0x10,0x61,0x18,0x21,0x18,0x61,0x10,0x20,0x10,0x20,0x08,0x61,0x10,0xA2,0x20,0x61,0x18,0xA2,0x28,0x60,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x61,0x10,0xA1,0x18,0xA1,0x20,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x00,0x00,0xA2,0x20,0x61,0x10,
-	0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x10,0xA1,0x18,0x20,0x08,0x20,0x08,0x62,0x10,0xA3,0x18,0x00,0x00,0xA2,0x08,0xE8,0x49,0xBC,0xEF,0x62,0x10,0x00,0x00,0x20,0x08,0x00,0x00,0x65,0x31,0xFD,0xF7,0xAD,0xB4,0xFB,0xFF,0x62,0x49,0x06,0x8B,0xFD,0xFF,0xFF,0xFF,0x52,0xDE,0xD8,0xF6,0xFE,0xFF,0xFD,0xFF,0xAD,0xB4,0xA5,0x69,0x23,0x59,
-	0xC4,0x79,0x87,0xAB,0xEF,0xD5,0xD8,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0x2D,0xCD,0x21,0x41,0x60,0x10,0xA1,0x18,0xA2,0x51,0x58,0xFF,0xFB,0xFF,0xEF,0xD5,0xA0,0x20,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x38,0x65,0x59,0x25,0x49,0xE3,0x38,0x61,0x20,0x60,0x20,0x61,0x20,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x10,0x21,0x18,0x61,0x18,0xA2,0x20,0xA3,0x28,0xA2,0x20,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x00,0x20,0x10,0x61,0x10,0x61,0x10,0x64,0x29,0xAE,0x93,0x61,0x18,0x21,0x18,0xE2,0x20,0xA1,0x20,
-	0xA2,0x20,0x20,0x10,0x61,0x10,0x20,0x08,0x60,0x08,0x61,0x10,0xA2,0x20,0xA2,0x20,0xA2,0x18,0x61,0x10,0x60,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0xA2,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0xA2,0x18,0xA1,0x18,0x60,0x10,0x3A,0xEF,0x16,0xCE,0x00,0x00,0x20,0x08,0xE3,0x20,0x66,0x29,0x00,0x00,0x12,0xAD,0x50,0x9C,
-	0x20,0x00,0x00,0x00,0xA3,0x39,0x21,0x29,0x38,0xEF,0x2A,0xA4,0x52,0xDE,0xFE,0xFF,0xFF,0xFF,0xD3,0xF5,0x56,0xF6,0xBD,0xFF,0xBB,0xF7,0x87,0xAB,0x85,0x7A,0xC4,0x79,0x85,0x7A,0x85,0x7A,0xEF,0xD5,0x36,0xF7,0x36,0xF7,0xD8,0xFF,0xD8,0xFF,0xD8,0xFF,0x36,0xF7,0x2D,0xCD,0x21,0x39,0xA0,0x10,0x60,0x10,0xC3,0x59,0x2D,0xCD,0xEF,0xD5,
-	0xC5,0x49,0xA1,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x59,0xC9,0xAA,0x65,0x59,0xE3,0x38,0xA2,0x30,0xA2,0x28,0x60,0x18,0x61,0x18,0xA1,0x20,0x61,0x18,0xA2,0x20,0xA1,0x18,0x61,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x10,0x61,0x20,0xA2,0x20,0xA1,0x20,0xA3,0x30,0xA2,0x28,0x61,0x18,0x21,0x10,0x20,0x10,0x61,0x10,0x60,0x10,0x20,0x10,0x61,0x10,0x20,0x10,
-	0x60,0x00,0x20,0x10,0x20,0x08,0xA1,0x18,0x61,0x18,0x21,0x10,0x20,0x08,0x60,0x08,0x21,0x10,0x61,0x10,0xA3,0x20,0xE3,0x28,0x61,0x10,0x20,0x08,0x61,0x18,0x61,0x10,0xE2,0x28,0xA2,0x20,0xE2,0x20,0x6D,0x7B,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA1,0x18,0xA2,0x18,0x62,0x18,0x61,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x60,0x08,
-	0xA2,0x18,0x21,0x10,0x61,0x10,0xA1,0x18,0xA2,0x18,0xE3,0x28,0x20,0x08,0x49,0x5A,0x20,0x00,0x61,0x10,0x20,0x08,0x60,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0xE3,0x18,0x20,0x00,0x21,0x00,0x20,0x00,0x94,0xC5,0xFD,0xF7,0xFD,0xFF,0x94,0xEE,0x12,0xAD,0x52,0xDE,0x2D,0xCD,0xD3,0xF5,0x58,0xFF,0x36,0xF7,0x94,0xEE,0x94,0xEE,0x4A,0xC4,
-	0x85,0x7A,0x4A,0xC4,0xD8,0xFF,0x36,0xF7,0xEF,0xD5,0xEF,0xD5,0x36,0xF7,0xD8,0xFF,0xD8,0xFF,0x87,0xAB,0xA3,0x49,0x21,0x29,0xE0,0x28,0xC3,0x59,0x62,0x49,0xA0,0x28,0xA0,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x40,0xE4,0x48,0x24,0x41,0xE3,0x38,0xA2,0x28,0xA2,0x28,0xEC,0x8A,0x60,0x10,0x60,0x10,0x21,0x10,0x61,0x10,0x20,0x10,0x61,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,
-	0xA1,0x18,0xA3,0x20,0x62,0x20,0x61,0x18,0x60,0x10,0x21,0x10,0x60,0x10,0xE3,0x28,0xA7,0x49,0x64,0x39,0x60,0x10,0x20,0x08,0x20,0x10,0x61,0x10,0x60,0x08,0x20,0x08,0x61,0x18,0xA2,0x20,0x61,0x18,0x61,0x10,0x21,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0x20,0x10,0x20,0x08,0xA1,0x18,0x6D,0x7B,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x00,
-	0x21,0x18,0xA1,0x20,0xEC,0x8A,0x29,0x7B,0x61,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA1,0x18,0xA2,0x20,0xA1,0x10,0x21,0x10,0x60,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x61,0x10,0xA1,0x18,0xA2,0x20,0xA2,0x18,0xA1,0x18,0xA2,0x18,0xE2,0x20,0x60,0x10,0x62,0x10,0xA1,0x10,0x60,0x10,0xA1,0x18,0x00,0x00,0x20,0x00,0x21,0x08,0x60,0x08,
-	0x60,0x08,0x20,0x00,0x20,0x00,0xBC,0xEF,0xFC,0xFF,0xFF,0xFF,0x52,0xDE,0xA5,0x51,0x65,0x69,0x87,0xAB,0xD3,0xF5,0xBA,0xFF,0xFC,0xFF,0xFC,0xFF,0xD8,0xFF,0xD8,0xFF,0xEF,0xD5,0xD8,0xFF,0xD8,0xFF,0xD8,0xFF,0x52,0xDE,0x36,0xF7,0xD8,0xFF,0xD8,0xFF,0xEF,0xD5,0x62,0x39,0xA3,0x49,0xA2,0x51,0xC3,0x59,0x24,0x5A,0x23,0x39,0x61,0x18,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE3,0x38,0xE3,0x38,0xE3,0x38,0xE3,0x38,0xA2,0x28,0x20,0x10,0xA1,0x18,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x08,0x61,0x08,0x61,0x18,0xA2,0x18,0x61,0x18,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x24,0x31,0x20,0x08,0xE3,0x28,0x20,0x00,0x20,0x10,0x61,0x18,0x61,0x10,0x61,0x18,0xA2,0x20,0x20,0x00,
-	0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x10,0xE4,0x28,0x62,0x18,0x61,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x60,0x10,0x20,0x08,0x20,0x10,0x20,0x00,0x20,0x08,0x61,0x10,0x24,0x31,0x65,0x39,0xA3,0x28,0xE2,0x28,0xA2,0x18,0xE3,0x20,0xA2,0x20,0xE2,0x20,0xA2,0x20,0x61,0x10,0x60,0x08,0x20,0x08,0x61,0x10,0x20,0x08,
-	0x20,0x08,0xA2,0x18,0xE3,0x28,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xE2,0x20,0xA2,0x20,0xA1,0x10,0x62,0x10,0x61,0x10,0x5C,0xEF,0xE2,0x20,0x20,0x00,0x21,0x00,0x20,0x08,0xA1,0x10,0x60,0x08,0x00,0x00,0xE8,0x49,0x49,0x5A,0x45,0x6A,0x52,0xDE,0x94,0xC5,0x62,0x49,0x87,0xAB,0xEF,0xD5,0xD8,0xFF,0xFC,0xFF,0xFC,0xFF,0xFC,0xFF,0xD8,0xFF,
-	0xFB,0xFF,0xFB,0xFF,0xFC,0xFF,0xFC,0xFF,0xFB,0xFF,0xFB,0xFF,0xFC,0xFF,0x38,0xEF,0x21,0x39,0xC3,0x59,0x21,0x39,0xE0,0x20,0x21,0x39,0x21,0x41,0xA1,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x38,0xE3,0x38,0x24,0x41,0x24,0x39,0xA2,0x28,0x61,0x10,0x20,0x08,0x20,0x10,0x20,0x10,0x61,0x18,0xA2,0x18,0xA2,0x18,0x61,0x10,0xA2,0x18,0xA2,0x18,0xA1,0x18,
-	0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x60,0x08,0x60,0x08,0x61,0x10,0x60,0x08,0x20,0x10,0x20,0x10,0x20,0x08,0x6D,0x7B,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0xE8,0x49,0x60,0x08,0x60,0x10,0x61,0x10,0x60,0x08,0x20,0x10,0x61,0x10,0x60,0x10,0x61,0x10,0x20,0x08,
-	0x60,0x08,0x60,0x10,0x61,0x10,0xA2,0x20,0xE2,0x30,0x65,0x41,0xA2,0x20,0xA1,0x18,0x61,0x10,0xA2,0x20,0xE3,0x28,0xE2,0x18,0x60,0x10,0x20,0x08,0x20,0x08,0x21,0x10,0xA1,0x10,0xA1,0x18,0xA2,0x20,0xE3,0x28,0xA2,0x20,0xA1,0x18,0x62,0x10,0xE3,0x20,0xA2,0x20,0x61,0x10,0xA2,0x18,0xCB,0x62,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x00,0xA1,0x10,0x21,0x08,0x60,0x00,0x64,0x29,0x50,0x9C,0xD7,0xE6,0x2A,0xA4,0x87,0xAB,0xEF,0xD5,0x36,0xF7,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xFC,0xFF,0xFD,0xFF,0xFC,0xFF,0xFD,0xFF,0xFD,0xFF,0xFC,0xFF,0x36,0xF7,0x85,0x7A,0x36,0xF7,0xEF,0xD5,0x62,0x39,0xA0,0x18,0x2A,0xA4,0x24,0x5A,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE3,0x38,0x24,0x41,0xE3,0x38,0xE3,0x38,0xA2,0x28,0x20,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x20,0x08,0x61,0x10,0x61,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA1,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x60,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0xA1,0x10,0xE3,0x20,0x20,0x10,0x60,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x61,0x10,0x61,0x10,0x21,0x10,0x49,0x5A,0x20,0x08,0x20,0x18,0xA2,0x28,0x23,0x39,0x64,0x41,0xC5,0x49,0x60,0x10,0xA1,0x10,0xE2,0x20,0xE2,0x20,0x61,0x10,0x00,0x00,0x20,0x00,
-	0x60,0x10,0xA2,0x18,0xE2,0x20,0xA2,0x20,0xE3,0x28,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA1,0x10,0x21,0x08,0x20,0x00,0xA1,0x18,0x60,0x10,0x00,0x00,0x20,0x00,0x21,0x08,0xE3,0x28,0x65,0x41,0xAE,0x93,0xFE,0xF7,0xFE,0xFF,0xAD,0xB4,0xA2,0x51,0xEF,0xD5,0xD8,0xFF,0xD8,0xFF,0xD8,0xFF,0x36,0xF7,0xEF,0xD5,0x4A,0xC4,0x36,0xF7,
-	0xD8,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xFE,0xFF,0xFD,0xF7,0xFB,0xFF,0x36,0xF7,0x94,0xEE,0xD8,0xFF,0xFB,0xFF,0xA5,0x39,0x94,0xC5,0xFB,0xFF,0xD7,0xE6,0xA1,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x48,0x24,0x49,0x24,0x41,0x24,0x41,0x24,0x39,0xA2,0x20,0x61,0x18,0xA2,0x20,0x61,0x18,0xA2,0x18,0xE3,0x28,0x24,0x31,0xE3,0x28,0xA3,0x28,0xE3,0x30,0xE3,0x28,
-	0xE3,0x28,0xE3,0x30,0xA2,0x20,0x61,0x18,0x60,0x10,0x21,0x10,0x60,0x08,0x20,0x10,0x21,0x10,0x60,0x10,0x20,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x49,0x5A,0x20,0x10,0x21,0x10,0x60,0x18,0xA7,0x49,0x60,0x10,0x21,0x18,0x24,0x31,0x00,0x00,0x61,0x10,0x60,0x10,0x61,0x10,0x00,0x00,0x20,0x08,
-	0x20,0x08,0x24,0x31,0xAE,0x93,0xAE,0x93,0x24,0x39,0xA2,0x28,0xA1,0x28,0xA5,0x51,0x12,0xAD,0x64,0x41,0x61,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0xA3,0x20,0xA1,0x20,0x24,0x31,0xA2,0x20,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0x60,0x08,0x20,0x00,0x61,0x10,0xA5,0x39,0xAE,0x93,0xA5,0x51,
-	0x65,0x31,0xE1,0x18,0xA1,0x10,0x29,0x7B,0x16,0xCE,0xD7,0xE6,0x52,0xDE,0x4A,0xC4,0xD8,0xFF,0xD8,0xFF,0xD8,0xFF,0xEF,0xD5,0x45,0x6A,0x85,0x7A,0xA2,0x51,0x4A,0xC4,0x36,0xF7,0xD8,0xFF,0x36,0xF7,0x94,0xEE,0xFB,0xFF,0xFC,0xFF,0xD8,0xFF,0xD8,0xFF,0xEF,0xD5,0x52,0xDE,0xD7,0xE6,0xE0,0x20,0xAD,0xB4,0xFC,0xFF,0x94,0xEE,0x60,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x49,0x25,0x49,0x24,0x41,0xE3,0x30,0xA2,0x28,0x61,0x18,0x20,0x08,0x20,0x00,0x20,0x08,0x60,0x08,0xA2,0x18,0xA2,0x20,0xA2,0x28,0xE3,0x28,0xA3,0x30,0xE3,0x30,0xA3,0x28,0xA2,0x28,0x62,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x18,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x60,0x10,0x61,0x18,0x61,0x18,
-	0xA2,0x18,0x61,0x10,0xA7,0x59,0xA2,0x18,0xA2,0x28,0xA2,0x20,0x61,0x18,0x62,0x20,0x61,0x20,0xEC,0x8A,0x61,0x18,0x20,0x10,0x20,0x10,0x61,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x61,0x10,0x24,0x31,0xE3,0x28,0x62,0x20,0x61,0x20,0x61,0x18,0x65,0x39,0x23,0x39,0xA2,0x20,0xA1,0x18,0x60,0x08,0x20,0x08,0x61,0x08,0x62,0x10,
-	0x20,0x08,0x60,0x10,0xA1,0x18,0xA2,0x20,0xE3,0x28,0x24,0x31,0xE2,0x28,0x60,0x18,0x61,0x18,0xA1,0x18,0x61,0x10,0x61,0x18,0x61,0x18,0x23,0x29,0xA0,0x20,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x08,0xE1,0x20,0x2D,0xCD,0xD7,0xE6,0xFC,0xFF,0xD8,0xFF,0x36,0xF7,0xFB,0xFF,0xD8,0xFF,0x4A,0xC4,0xC3,0x59,0x62,0x49,0x21,0x41,0x85,0x7A,
-	0x94,0xEE,0xD8,0xFF,0x2D,0xCD,0x45,0x6A,0x94,0xEE,0xD7,0xE6,0x29,0x7B,0xAD,0xB4,0xA2,0x51,0xAD,0xB4,0x24,0x5A,0xA0,0x10,0x62,0x39,0x2A,0xA4,0x21,0x29,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x38,0xE3,0x38,0xE3,0x30,0xE3,0x28,0x61,0x18,0x20,0x08,0x6D,0x7B,0x20,0x08,0x20,0x08,0x60,0x08,0xA1,0x10,0xA3,0x28,0xE3,0x28,0xA3,0x28,0xE2,0x20,0xA2,0x20,
-	0xA2,0x20,0xA2,0x20,0xA2,0x18,0xA1,0x18,0x61,0x18,0xE3,0x28,0xA2,0x20,0x24,0x39,0x20,0x10,0x60,0x08,0x20,0x08,0x20,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0xA2,0x10,0xA2,0x20,0xA1,0x18,0xA2,0x18,0xC5,0x49,0x20,0x10,0x20,0x10,0x61,0x18,0x60,0x10,0x21,0x10,0xA1,0x10,0x61,0x18,0x60,0x10,0x61,0x10,
-	0x20,0x08,0x20,0x10,0x61,0x10,0xA1,0x18,0xA2,0x18,0x62,0x18,0xA1,0x18,0xE8,0x49,0xCB,0x62,0x24,0x31,0x64,0x39,0xE2,0x20,0x61,0x10,0x20,0x08,0x00,0x00,0x61,0x10,0x61,0x08,0x61,0x18,0x20,0x00,0xA2,0x18,0xA1,0x18,0xA1,0x20,0x65,0x41,0x64,0x39,0xE2,0x20,0x64,0x39,0x23,0x39,0x64,0x41,0x24,0x39,0x65,0x49,0x65,0x39,0xA1,0x10,
-	0x60,0x08,0x20,0x08,0x00,0x00,0x64,0x29,0x38,0xEF,0xFE,0xFF,0xFD,0xFF,0xBB,0xF7,0xEF,0xD5,0x36,0xF7,0xEF,0xD5,0x85,0x7A,0x23,0x59,0x21,0x41,0xA2,0x51,0x45,0x6A,0x36,0xF7,0xD8,0xFF,0xEF,0xD5,0xE0,0x20,0x21,0x29,0x00,0x00,0x60,0x00,0x60,0x08,0xD7,0xE6,0xFB,0xFF,0x94,0xEE,0xA0,0x10,0xE2,0x20,0x23,0x29,0xA0,0x10,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x28,0xA2,0x28,0xA2,0x28,0x61,0x10,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x20,0xE3,0x28,0xA3,0x28,0xA2,0x28,0xE3,0x28,0xE3,0x28,0xA3,0x28,0xE3,0x28,0xE2,0x20,0x61,0x10,0x20,0x08,0xE3,0x20,0x20,0x08,0x66,0x41,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,
-	0x61,0x18,0xA2,0x18,0x61,0x18,0xA7,0x49,0xA1,0x20,0x61,0x10,0x65,0x39,0x62,0x18,0x61,0x18,0x61,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x60,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x62,0x18,0xA2,0x20,0x62,0x10,0xA1,0x18,0x65,0x31,0x78,0xD6,0xA1,0x18,0xA2,0x28,0xE2,0x28,0x60,0x08,0x20,0x08,0x00,0x00,
-	0x20,0x00,0x61,0x10,0x50,0x9C,0x50,0x9C,0x61,0x08,0x61,0x10,0xA1,0x20,0xE2,0x28,0xA2,0x20,0xE2,0x28,0x60,0x20,0xE2,0x30,0x64,0x41,0x61,0x10,0x24,0x29,0xE2,0x20,0x60,0x10,0xE2,0x20,0x94,0xC5,0xD7,0xE6,0x12,0xAD,0xFD,0xFF,0x12,0xAD,0x89,0x93,0xFC,0xF7,0xD8,0xFF,0x87,0xAB,0xC4,0x79,0xA2,0x51,0x45,0x6A,0xA5,0x69,0x85,0x7A,
-	0x36,0xF7,0xD8,0xFF,0xD7,0xE6,0xA0,0x10,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x08,0x16,0xCE,0xFD,0xFF,0x38,0xEF,0x61,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0xA2,0x20,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0xA2,0x20,0xA7,0x59,0x65,0x39,0xE4,0x30,0xA2,0x28,0xE3,0x28,0xE3,0x30,
-	0x24,0x31,0xA2,0x20,0x60,0x10,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x08,0x24,0x39,0x61,0x18,0xA2,0x18,0xA1,0x18,0x62,0x18,0x62,0x18,0xA2,0x20,0xA2,0x18,0xA3,0x28,0xA2,0x20,0x24,0x29,0x24,0x39,0x65,0x49,0xE4,0x30,0xE4,0x30,0xE3,0x30,0xA2,0x20,0xA3,0x28,0x62,0x20,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x61,0x10,0x61,0x18,0xA2,0x20,0x60,0x10,0x61,0x18,0xA2,0x18,0xA2,0x18,0x20,0x00,0x20,0x08,0xA1,0x10,0x60,0x10,0xA1,0x20,0x61,0x10,0xE2,0x20,0x00,0x00,0x20,0x08,0x60,0x08,0x24,0x29,0xA1,0x10,0x60,0x10,0x21,0x10,0x20,0x08,0x61,0x10,0x62,0x18,0x61,0x18,0x50,0x9C,0x3A,0xEF,0xCB,0x62,0xA1,0x18,0xA3,0x18,0xE3,0x28,
-	0xE1,0x28,0xE4,0x30,0x94,0xC5,0x89,0x93,0x52,0xDE,0x2A,0xA4,0xAD,0xB4,0x78,0xD6,0xFD,0xFF,0xBA,0xFF,0x4A,0xC4,0x85,0x7A,0x52,0xDE,0x36,0xF7,0x94,0xEE,0x36,0xF7,0xD8,0xFF,0xD8,0xFF,0xC5,0x49,0x60,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x64,0x39,0x12,0xAD,0x49,0x5A,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x18,0x61,0x18,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x08,0xA2,0x20,0xA2,0x20,0x61,0x18,0x61,0x10,0x20,0x08,0x61,0x10,0xA2,0x20,0xE3,0x30,0x24,0x39,0x61,0x18,0xA2,0x20,0xA2,0x18,0x20,0x10,0x20,0x00,0x60,0x00,0x60,0x00,0x20,0x08,0xA2,0x28,0x20,0x10,0x20,0x08,0x60,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x21,0x10,0xA1,0x18,
-	0xA1,0x18,0xA2,0x18,0x61,0x18,0x62,0x20,0xE2,0x28,0xE3,0x28,0xA3,0x30,0xE3,0x28,0xA3,0x28,0x61,0x20,0xA2,0x28,0x62,0x20,0x61,0x10,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x18,0x62,0x18,0xA1,0x18,0xA1,0x10,0x61,0x18,0x61,0x10,0x60,0x08,0x60,0x08,0x61,0x08,0x61,0x10,0x20,0x08,0xA2,0x18,0x60,0x10,
-	0x21,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0xA1,0x10,0xA1,0x10,0x20,0x08,0x20,0x08,0x62,0x18,0x61,0x10,0xE8,0x49,0x24,0x29,0xE2,0x20,0xA2,0x20,0x60,0x18,0xA2,0x28,0x65,0x59,0xE7,0x79,0xEC,0x8A,0x4B,0xB3,0x94,0xEE,0x2A,0xA4,0xFD,0xF7,0xFF,0xFF,0xFC,0xFF,0xFB,0xFF,0xD8,0xFF,0x52,0xDE,0xD8,0xFF,0xFB,0xFF,0xFB,0xFF,0xD8,0xFF,
-	0xD8,0xFF,0xD7,0xE6,0x60,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x10,0xA3,0x28,0x24,0x31,0x20,0x10,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0xA2,0x20,0x49,0x5A,0xE3,0x28,0xA3,0x28,
-	0xA2,0x20,0xE3,0x30,0x20,0x10,0x20,0x00,0x20,0x00,0x60,0x08,0x65,0x39,0xE4,0x30,0x61,0x28,0x61,0x20,0x24,0x29,0x24,0x39,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x18,0xA1,0x18,0xA2,0x20,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA1,0x20,0x61,0x18,0x21,0x10,0xA2,0x20,0xA1,0x18,0xAE,0x93,0x60,0x10,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xAE,0x93,0xE2,0x20,0x20,0x08,0x20,0x08,0x20,0x00,0x61,0x10,0x60,0x08,0x20,0x08,0xE8,0x49,0x50,0x9C,0x61,0x18,0xA2,0x20,0x60,0x10,0x20,0x08,0xA2,0x18,0x60,0x08,0x61,0x10,0x61,0x10,0xA2,0x18,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xE2,0x20,0x12,0xAD,0xCB,0x62,
-	0xE2,0x30,0x49,0x5A,0xD8,0xF6,0x94,0xC5,0x52,0xDE,0x45,0x6A,0xC5,0x49,0xAD,0xB4,0x3A,0xEF,0xFB,0xFF,0xD8,0xFF,0x36,0xF7,0xD8,0xFF,0xD8,0xFF,0xD8,0xFF,0xD8,0xFF,0xFB,0xFF,0xAD,0xB4,0x60,0x10,0x60,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x10,0x20,0x10,0x60,0x08,0x20,0x10,0x62,0x20,0x24,0x39,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x61,0x10,0x60,0x10,0x20,0x08,0xE3,0x20,0x61,0x10,0x61,0x10,0x20,0x08,0xA2,0x18,0x20,0x00,0x20,0x08,0x20,0x08,0x24,0x29,0xA1,0x10,0x20,0x10,0x61,0x18,0xE3,0x30,0xA2,0x20,0x61,0x18,0x61,0x18,0xA1,0x10,0xA2,0x18,0xE3,0x28,
-	0xE3,0x28,0xE3,0x20,0xE3,0x20,0xA3,0x20,0xE2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0x61,0x18,0x20,0x10,0x20,0x10,0xA2,0x20,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x08,0x20,0x00,0xA7,0x39,0x49,0x5A,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x10,0x6D,0x7B,0xA5,0x39,0x6D,0x7B,
-	0xA5,0x39,0x60,0x08,0xE3,0x20,0x65,0x39,0x61,0x10,0xE2,0x18,0x61,0x18,0xA2,0x20,0x60,0x18,0xE2,0x20,0xE2,0x20,0xE2,0x20,0xA3,0x20,0x62,0x18,0xAE,0x93,0xA3,0x18,0xA3,0x20,0xC5,0x49,0xD7,0xE6,0xBA,0xFF,0xBB,0xF7,0x12,0xAD,0x24,0x5A,0x60,0x08,0x12,0xAD,0xFB,0xFF,0x36,0xF7,0x94,0xEE,0xD8,0xFF,0xFB,0xFF,0xD8,0xFF,0xD8,0xFF,
-	0xFB,0xFF,0x69,0x72,0x60,0x08,0x20,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x20,0x10,0x20,0x08,0xA2,0x20,0xE4,0x30,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x60,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x08,0x20,0x08,
-	0x61,0x18,0x61,0x18,0x21,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x18,0x61,0x20,0xE2,0x20,0x20,0x08,0x20,0x10,0x20,0x08,0x61,0x18,0x61,0x10,0xA1,0x18,0x62,0x20,0xE2,0x20,0xA3,0x28,0xA2,0x28,0xE3,0x28,0xE3,0x28,0xE3,0x28,0xE3,0x28,0x61,0x18,0x61,0x10,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x00,
-	0x65,0x31,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x65,0x31,0x24,0x29,0x60,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x12,0xAD,0xE3,0x20,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x60,0x08,0x60,0x08,0x16,0xCE,0x49,0x5A,0x64,0x29,0xE2,0x28,0xE3,0x28,0xE3,0x30,0x23,0x39,0xE2,0x20,0xA1,0x20,0xA1,0x18,0xE1,0x20,
-	0x62,0x20,0xA1,0x18,0x85,0x7A,0x36,0xF7,0xBA,0xFF,0xFD,0xFF,0x16,0xCE,0x60,0x10,0xEF,0xD5,0xD8,0xFF,0x36,0xF7,0x36,0xF7,0xFB,0xFF,0xD8,0xFF,0xD8,0xFF,0xEF,0xD5,0x2D,0xCD,0xE1,0x28,0x20,0x10,0x21,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x10,0x20,0x10,0xA3,0x28,0x20,0x10,0x61,0x18,0x20,0x08,0x20,0x08,0xA2,0x18,0xE3,0x28,0x61,0x10,0x61,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xE2,0x20,0xA2,0x20,0xA2,0x18,0x49,0x5A,0x21,0x10,0x60,0x10,0x20,0x08,0xA1,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0xA2,0x20,0x61,0x20,0x61,0x18,0x20,0x08,0x61,0x10,
-	0x61,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xE2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x18,0x61,0x18,0x61,0x18,0x60,0x08,0x61,0x18,0xE3,0x30,0x61,0x18,0x20,0x08,0x6D,0x7B,0x20,0x00,0xA2,0x18,0x20,0x00,0x60,0x08,0x20,0x08,0x60,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x18,
-	0xA1,0x10,0x20,0x08,0xA7,0x49,0x00,0x00,0x20,0x00,0xA3,0x18,0x20,0x08,0x20,0x08,0xA1,0x18,0xA1,0x20,0xA1,0x20,0x64,0x39,0x24,0x39,0x24,0x39,0x24,0x39,0xC5,0x49,0xC5,0x49,0xC5,0x49,0x89,0x93,0x36,0xF7,0xFB,0xFF,0xD8,0xFF,0x16,0xCE,0x3A,0xEF,0xFD,0xF7,0xFB,0xFF,0xD8,0xFF,0xFB,0xFF,0xFC,0xFF,0xFB,0xFF,0x2D,0xCD,0x52,0xDE,
-	0x5A,0xF7,0xAD,0xB4,0x61,0x10,0x61,0x10,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x18,0x61,0x18,0x20,0x10,0xE2,0x20,0x20,0x08,0x20,0x00,0x00,0x00,0xE3,0x28,0x61,0x10,0x62,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,
-	0x20,0x08,0xA2,0x18,0x20,0x08,0x60,0x08,0x61,0x10,0x65,0x39,0x24,0x29,0x61,0x18,0xE2,0x28,0x20,0x10,0x20,0x10,0x60,0x08,0x20,0x08,0x62,0x18,0x61,0x18,0x61,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA3,0x20,0xA2,0x20,0xA3,0x28,0xE3,0x20,0xE3,0x28,0xE2,0x20,0xA3,0x20,0xA2,0x28,0xA2,0x18,0xE2,0x20,0xE3,0x28,0x61,0x18,0x20,0x08,
-	0x00,0x00,0x49,0x5A,0xE8,0x49,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x08,0x21,0x00,0x16,0xCE,0x50,0x9C,0x60,0x08,0x61,0x10,0x00,0x00,0x21,0x10,0x00,0x00,0x6D,0x7B,0x61,0x10,0xA2,0x20,0xE2,0x20,0xA1,0x20,0xC5,0x49,0x64,0x39,0xA1,0x20,
-	0x45,0x6A,0xFC,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xBB,0xF7,0xFC,0xF7,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xD8,0xFF,0xD8,0xFF,0xFC,0xFF,0xBB,0xF7,0x87,0xAB,0x94,0xEE,0xFB,0xFF,0x94,0xC5,0x61,0x18,0x61,0x10,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x6D,0x7B,0x20,0x10,0xE3,0x28,0x20,0x10,0x49,0x5A,0x20,0x08,0xA1,0x10,0x60,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x61,0x10,0x61,0x08,0x60,0x08,0x20,0x08,0x60,0x08,0x20,0x08,0x61,0x10,0x61,0x08,0xA2,0x20,0x65,0x39,0x62,0x18,0xA2,0x20,0xA1,0x18,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,
-	0x61,0x10,0x61,0x10,0x61,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0x60,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x20,0xA1,0x18,0x20,0x08,0x20,0x08,0x61,0x18,0x60,0x08,0x60,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x60,0x08,0x00,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0xA5,0x39,0x6D,0x7B,
-	0x00,0x00,0x24,0x29,0x60,0x08,0x49,0x5A,0x6D,0x7B,0x20,0x08,0x20,0x08,0x49,0x5A,0xFF,0xFF,0x3A,0xEF,0x3A,0xEF,0x6D,0x7B,0xA1,0x18,0x16,0xCE,0xA1,0x18,0x20,0x10,0x64,0x39,0x2D,0xCD,0x58,0xFF,0xFB,0xFF,0xFC,0xFF,0xFD,0xF7,0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xFC,0xFF,0xD8,0xFF,0xD8,0xFF,0xFC,0xFF,0xFB,0xFF,0x38,0xEF,0xEF,0xD5,
-	0x2D,0xCD,0x65,0x49,0x60,0x20,0x61,0x18,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x41,0x61,0x18,0x61,0x18,0xA2,0x20,0x24,0x29,0xA1,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x10,0x61,0x18,0x61,0x20,0xE3,0x38,0xE4,0x30,0x23,0x39,0xA2,0x20,0x61,0x20,0x61,0x18,0x60,0x10,0x20,0x10,0x62,0x18,0x65,0x41,0x61,0x18,0x49,0x5A,0x24,0x39,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x20,0x10,0x60,0x10,0xA2,0x20,0x20,0x00,
-	0xA1,0x10,0x21,0x10,0x61,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0xA2,0x20,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x21,0x08,0x94,0xC5,0xAE,0x93,0xE3,0x18,0x6D,0x7B,0x00,0x00,0x20,0x08,0x50,0x9C,0x50,0x9C,0x61,0x10,0x60,0x08,0x16,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3A,0xEF,0x78,0xD6,0xFE,0xFF,0x6D,0x7B,0xE2,0x30,
-	0x62,0x49,0xEF,0xD5,0x58,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFD,0xFF,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0xFC,0xFF,0xFC,0xFF,0x16,0xCE,0x63,0x69,0x23,0x41,0x61,0x18,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x60,0x10,0x61,0x18,0x20,0x08,0xE3,0x28,0x20,0x08,0x00,0x00,0x20,0x08,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x24,0x39,0xE3,0x38,0x62,0x30,0xA2,0x28,0xE4,0x30,0x61,0x18,0x61,0x18,
-	0x61,0x18,0x61,0x10,0xE2,0x20,0x65,0x41,0x61,0x18,0xE3,0x38,0xA2,0x20,0x61,0x18,0x20,0x10,0x60,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0xA7,0x49,0xAE,0x93,0x60,0x08,0x20,0x00,0x20,0x00,0x62,0x10,0x60,0x08,0x20,0x00,0x20,0x10,0x6D,0x7B,0x61,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0x00,0x00,0xA7,0x39,0x20,0x00,0xA1,0x10,
-	0x78,0xD6,0x20,0x00,0x60,0x08,0x61,0x00,0xE1,0x18,0xE2,0x20,0x60,0x08,0x6D,0x7B,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xF7,0xD7,0xE6,0x52,0xDE,0x58,0xFF,0xBA,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFB,0xFF,0xFC,0xFF,0xFB,0xFF,0xFC,0xFF,0xBA,0xFF,0x89,0x93,
-	0x62,0x49,0x23,0x41,0xA1,0x10,0x61,0x18,0x61,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x28,0x21,0x18,0x24,0x31,0x20,0x10,0x20,0x00,0x20,0x00,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,
-	0xA2,0x18,0x21,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0xA1,0x10,0x61,0x18,0xEC,0x8A,0xE3,0x30,0x61,0x18,0x61,0x18,0x20,0x10,0x20,0x10,0x61,0x10,0x21,0x10,0x20,0x18,0x21,0x18,0xE3,0x38,0xA7,0x59,0x60,0x18,0x61,0x18,0x20,0x10,0x20,0x08,0xE3,0x20,0x49,0x5A,0x20,0x08,0x61,0x20,0xA1,0x18,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x08,0xE3,0x20,0xAE,0x93,0xA1,0x18,0x20,0x08,0x20,0x00,0x20,0x00,0x94,0xC5,0xA2,0x18,0x60,0x08,0x20,0x08,0x49,0x5A,0xA5,0x39,0x20,0x08,0x21,0x08,0x61,0x08,0x20,0x08,0xA1,0x18,0x21,0x08,0x50,0x9C,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFD,0xFF,
-	0xBB,0xF7,0xFC,0xFF,0x38,0xEF,0xBB,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFC,0xFF,0x16,0xCE,0xEF,0xD5,0x06,0x8B,0x60,0x20,0x89,0x93,0xA9,0x92,0x61,0x18,0x61,0x18,0x61,0x10,0x21,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x20,0xE3,0x28,0xE2,0x28,0x20,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0xA1,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x65,0x31,0xE3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x49,0x5A,0x20,0x08,0x61,0x10,0xA2,0x18,0x61,0x08,0x20,0x08,0x61,0x18,0x20,0x10,0x20,0x10,0x62,0x18,0x61,0x10,
-	0x60,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0x60,0x18,0x24,0x39,0x24,0x41,0xEC,0x8A,0x60,0x18,0x20,0x10,0x61,0x10,0xA7,0x39,0xE3,0x20,0x20,0x08,0x20,0x08,0xE2,0x20,0xE3,0x28,0xA1,0x10,0x20,0x08,0x00,0x00,0x61,0x08,0x20,0x08,0x60,0x10,0x60,0x10,0x20,0x08,0x60,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x78,0xD6,
-	0x94,0xC5,0xA5,0x39,0x61,0x10,0x20,0x08,0x61,0x10,0xE3,0x20,0xA5,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x16,0xCE,0x38,0xEF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xBC,0xEF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xD7,0xE6,0xA0,0x28,0xE2,0x38,0x12,0xAD,
-	0xFD,0xFF,0x58,0xFF,0x23,0x39,0x62,0x18,0x61,0x10,0x60,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x30,0x21,0x18,0x61,0x10,0x20,0x00,0x00,0x00,0x61,0x10,0x20,0x08,0x20,0x08,0xA2,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0x61,0x10,0x20,0x08,0x61,0x10,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x61,0x00,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x18,0x61,0x18,0xA7,0x49,0x24,0x31,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0xA1,0x20,0x61,0x20,0xE3,0x38,0xE2,0x28,0xAE,0x93,0x24,0x39,0xA1,0x20,0x60,0x10,0x20,0x08,0x60,0x10,0x21,0x10,0x50,0x9C,
-	0x64,0x39,0x60,0x10,0xAE,0x93,0x61,0x08,0x60,0x08,0x20,0x08,0x61,0x10,0xA2,0x18,0xA1,0x18,0x21,0x10,0x61,0x08,0x61,0x10,0x20,0x00,0x20,0x08,0x61,0x08,0x60,0x10,0xE2,0x30,0x21,0x10,0x60,0x10,0x61,0x10,0xA1,0x10,0x61,0x18,0x6D,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0x2A,0xA4,0x52,0xDE,0xFB,0xFF,0xFD,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFE,0xFF,0x16,0xCE,0x61,0x28,0x94,0xC5,0xFF,0xFF,0xFD,0xFF,0x5A,0xF7,0x23,0x41,0x62,0x10,0x61,0x10,0x21,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x10,0xE2,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x18,0x20,0x10,0x20,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x10,0x00,0x00,0x60,0x08,0x60,0x10,0xA2,0x18,0x20,0x08,0x20,0x10,0x60,0x10,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x62,0x18,0xA1,0x20,0x62,0x18,0xC5,0x49,0xA2,0x20,0x62,0x18,0x20,0x10,0x61,0x18,0x61,0x18,0xA2,0x20,0xA2,0x18,0x60,0x18,0x49,0x5A,0x49,0x5A,0xC5,0x49,0xA5,0x39,0xA2,0x18,0xA1,0x10,0x61,0x08,0x20,0x08,0xE2,0x18,0xA2,0x18,0x20,0x08,0x61,0x08,0x21,0x10,0x60,0x10,0x20,0x00,0x61,0x08,0xC5,0x49,
-	0xA0,0x20,0xA2,0x20,0x21,0x10,0x20,0x08,0xE2,0x20,0xA1,0x10,0xCB,0x62,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xBE,0xFF,0xD7,0xE6,0xAD,0xB4,0xFC,0xFF,0xFC,0xFF,0x5A,0xF7,0xFB,0xFF,0xFC,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0x3A,0xEF,0xE2,0x38,0x94,0xEE,0xFE,0xFF,
-	0xFD,0xFF,0xAD,0xB4,0xE2,0x38,0x61,0x18,0x62,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x62,0x18,0x60,0x10,0xA2,0x20,0x61,0x10,0x61,0x10,0x62,0x18,0x60,0x08,0x21,0x08,0x61,0x10,0x20,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x00,0x21,0x08,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x08,0x60,0x08,0x20,0x10,0x60,0x10,0x20,0x08,0xE3,0x20,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x10,0xCB,0x62,0x65,0x39,0x20,0x10,0x20,0x10,0x20,0x10,0x65,0x41,0x20,0x08,0x60,0x10,0x21,0x08,0x94,0xC5,0xE2,0x20,0xA2,0x18,0xA1,0x10,0x64,0x41,
-	0x23,0x39,0xA1,0x20,0xA2,0x20,0x60,0x10,0xA2,0x18,0xA2,0x20,0x60,0x10,0x24,0x29,0x29,0x7B,0x20,0x00,0x61,0x10,0x00,0x00,0x60,0x10,0xE8,0x49,0xAE,0x93,0xBC,0xEF,0x64,0x41,0xA2,0x18,0xA2,0x18,0x20,0x08,0x60,0x10,0x78,0xD6,0x12,0xAD,0x50,0x9C,0x78,0xD6,0xFD,0xFF,0x3A,0xEF,0xAD,0xB4,0xBB,0xF7,0xFE,0xFF,0xFF,0xFF,0xFD,0xFF,
-	0x5A,0xF7,0xFB,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFC,0xFF,0xFC,0xFF,0xBD,0xFF,0x2A,0xA4,0xA9,0x92,0xBD,0xFF,0xFE,0xFF,0xD7,0xE6,0x23,0x41,0x61,0x18,0x61,0x10,0x60,0x10,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE3,0x28,0xE3,0x28,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xE3,0x28,0xA3,0x20,0xA2,0x18,0x61,0x10,0x60,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0xA1,0x10,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x29,0x7B,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x18,
-	0x60,0x10,0x21,0x10,0x49,0x5A,0x24,0x31,0x61,0x10,0x61,0x18,0x65,0x31,0xE8,0x49,0x21,0x10,0x21,0x08,0x20,0x08,0x61,0x10,0xCB,0x62,0xCB,0x62,0xA2,0x20,0xA2,0x20,0xA1,0x20,0xE2,0x38,0x12,0xAD,0xE2,0x18,0x65,0x39,0xE8,0x49,0x60,0x18,0x69,0x72,0x24,0x31,0x00,0x00,0xE2,0x18,0xA5,0x39,0xA5,0x39,0xBB,0xF7,0xBC,0xEF,0x5A,0xF7,
-	0x29,0x7B,0xC5,0x49,0xA0,0x10,0xE8,0x49,0xE2,0x20,0x50,0x9C,0xA5,0x39,0x20,0x00,0xBC,0xEF,0xFD,0xFF,0xD8,0xF6,0xD7,0xE6,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xBB,0xF7,0xA2,0x30,0x23,0x41,0x78,0xD6,
-	0xBD,0xF7,0x29,0x7B,0x21,0x20,0x61,0x10,0x61,0x10,0x21,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x20,0x24,0x31,0xE3,0x28,0x24,0x31,0xA2,0x20,0x24,0x39,0xE3,0x20,0x61,0x10,0x60,0x08,0x62,0x18,0xE4,0x20,0x61,0x10,0xA1,0x10,0x20,0x08,0x20,0x08,0x62,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x60,0x08,0x20,0x08,0x61,0x10,0x61,0x18,0x20,0x08,0x21,0x10,0x20,0x10,0x20,0x10,0x6D,0x7B,0x21,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x61,0x18,0x60,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x50,0x9C,0xA1,0x18,0x61,0x10,0xA2,0x18,
-	0xA1,0x18,0xA7,0x59,0xAE,0x93,0x6D,0x7B,0x78,0xD6,0x49,0x5A,0x60,0x10,0xA7,0x59,0xC5,0x49,0x3A,0xEF,0x94,0xC5,0x12,0xAD,0x16,0xCE,0xFC,0xFF,0x29,0x7B,0xBB,0xF7,0xFC,0xFF,0xFC,0xFF,0x2A,0xA4,0xFD,0xFF,0x38,0xEF,0xC5,0x49,0xA2,0x08,0x50,0x9C,0x3A,0xEF,0x52,0xDE,0xEF,0xD5,0xFB,0xFF,0xFD,0xFF,0xFE,0xF7,0xFE,0xF7,0xFD,0xFF,
-	0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xBD,0xFF,0x16,0xCE,0x60,0x20,0x60,0x18,0x21,0x18,0xE2,0x20,0xE4,0x28,0x60,0x18,0x61,0x18,0x62,0x10,0x61,0x10,0x61,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x18,0x61,0x18,0x49,0x5A,0xA2,0x20,0x24,0x31,0x62,0x18,0xA2,0x20,0xA2,0x18,0x62,0x18,0xA2,0x18,0x60,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x00,0x20,0x08,0xA7,0x59,0xA2,0x20,0x20,0x10,0x20,0x10,0xA2,0x20,
-	0x20,0x10,0x20,0x08,0x60,0x10,0x20,0x10,0x20,0x08,0xA7,0x49,0xE3,0x28,0x61,0x18,0x60,0x10,0x20,0x08,0x20,0x08,0x60,0x08,0xA1,0x18,0x61,0x10,0xA2,0x18,0xA1,0x10,0x23,0x39,0xA0,0x18,0x60,0x10,0x64,0x39,0x20,0x00,0x60,0x10,0xA1,0x20,0x64,0x29,0x24,0x5A,0x78,0xD6,0x2A,0xA4,0xA0,0x10,0x64,0x39,0x64,0x39,0xA0,0x18,0x78,0xD6,
-	0xC5,0x49,0x12,0xAD,0xFD,0xF7,0xD7,0xE6,0x5C,0xEF,0x78,0xD6,0x5C,0xEF,0xFF,0xFF,0xBB,0xF7,0x38,0xEF,0xFB,0xFF,0xFC,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFC,0xFF,0xFC,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xAD,0xB4,0xA1,0x28,0x60,0x20,0x61,0x18,0x61,0x10,0x61,0x10,
-	0x60,0x10,0x61,0x18,0xA1,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x20,0x24,0x31,0xE3,0x28,0xA2,0x20,0xA2,0x20,0xA1,0x18,0xA2,0x20,0xA3,0x20,0xE3,0x20,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,
-	0x60,0x00,0x20,0x00,0x60,0x08,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0xE3,0x28,0x61,0x18,0x61,0x18,0x20,0x08,0x20,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x18,0xA2,0x20,0xA2,0x28,0xE3,0x30,0xA1,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0xA2,0x18,0x20,0x08,0xA2,0x20,0xA1,0x18,0x23,0x29,
-	0xA1,0x10,0x20,0x08,0xA1,0x10,0xA2,0x18,0xE2,0x18,0xA2,0x20,0xA1,0x20,0x12,0xAD,0x12,0xAD,0x12,0xAD,0x64,0x29,0x24,0x21,0xA2,0x18,0xE2,0x18,0x16,0xCE,0xFE,0xFF,0xA1,0x10,0x64,0x29,0xE8,0x49,0xFF,0xFF,0xFD,0xF7,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x94,0xC5,0x29,0x7B,0x20,0x18,0x61,0x10,0xA1,0x10,0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE3,0x28,0x24,0x29,0xA2,0x20,0xE2,0x20,0xA1,0x18,0xA2,0x20,0xA2,0x20,0xE2,0x20,0xA2,0x20,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x21,0x08,0x60,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x61,0x10,0x61,0x08,0x61,0x10,0xA7,0x39,0x24,0x29,0x20,0x10,0xE4,0x28,0x20,0x08,0x20,0x10,0x61,0x10,0xA2,0x20,0x61,0x18,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x21,0x10,0x61,0x18,0xA3,0x28,0xA1,0x18,0x20,0x10,0x20,0x10,0x20,0x08,0x78,0xD6,0x61,0x10,0x60,0x10,0xC5,0x49,0xA1,0x20,0xA1,0x18,0x50,0x9C,0x24,0x29,0xA1,0x10,0x61,0x10,0xE1,0x18,0xBB,0xF7,0xC5,0x49,0xA5,0x39,0x3A,0xEF,0x60,0x08,0xA5,0x39,0x94,0xC5,0xCB,0x62,0xFD,0xF7,0x6D,0x7B,
-	0xE2,0x20,0xCB,0x62,0x49,0x5A,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xBC,0xEF,0xFE,0xFF,0x16,0xCE,0x21,0x10,0x61,0x18,0x61,0x18,0x61,0x10,
-	0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0x61,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x39,0xE3,0x20,0xA2,0x18,0xA2,0x18,0x61,0x18,0xA2,0x18,0xE3,0x28,0xE3,0x20,0xA2,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0x21,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0xE8,0x49,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x61,0x10,0x20,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x24,0x31,0x49,0x5A,0xA1,0x20,0x20,0x10,0x60,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x61,0x18,0x60,0x10,0x61,0x10,0x60,0x08,0xA1,0x18,0x61,0x10,0xA2,0x20,0x20,0x10,0x24,0x31,0x60,0x18,0xA1,0x18,
-	0x61,0x10,0xAE,0x93,0xA1,0x10,0x61,0x10,0x60,0x08,0xA1,0x18,0x64,0x39,0x60,0x10,0x49,0x5A,0x94,0xC5,0x64,0x29,0x50,0x9C,0xBE,0xF7,0xE2,0x10,0x50,0x9C,0x94,0xC5,0xFF,0xFF,0x5C,0xEF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFD,0xFF,0x3A,0xEF,0xBE,0xFF,0xFE,0xFF,0x3A,0xEF,0xEC,0x8A,0x50,0x9C,0x23,0x29,0x20,0x08,0x21,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA3,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xE3,0x28,0xA2,0x18,0xE2,0x20,0x62,0x18,0x60,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x21,0x08,0xA2,0x18,0x20,0x08,0x60,0x10,0x61,0x10,0xA2,0x20,0x24,0x39,0xE3,0x30,0xA2,0x28,0x60,0x18,
-	0x20,0x08,0x60,0x10,0xCB,0x62,0x61,0x10,0x12,0xAD,0x61,0x10,0x20,0x10,0x20,0x08,0xE8,0x49,0x24,0x29,0x61,0x10,0x61,0x18,0xA2,0x20,0x61,0x10,0x61,0x10,0x62,0x10,0xA1,0x10,0xA2,0x10,0xA2,0x18,0x61,0x18,0x49,0x5A,0x94,0xC5,0xC5,0x49,0x94,0xC5,0x3A,0xEF,0x64,0x29,0xFF,0xFF,0xFF,0xFF,0x65,0x39,0x5C,0xEF,0xFD,0xF7,0xFF,0xFF,
-	0x7E,0xF7,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFC,0xFF,0xFC,0xFF,0xBA,0xFF,0xFB,0xFF,0xFC,0xFF,0xFD,0xFF,0xBA,0xFF,0x16,0xCE,0x56,0xF6,0x58,0xFF,0xFC,0xFF,0xFC,0xF7,0xD8,0xF6,0x51,0xE5,0xD8,0xF6,0xD8,0xF6,0x4B,0xB3,0x23,0x41,0xA2,0x28,0xA3,0x20,0xA1,0x18,0x61,0x10,0x61,0x18,0x61,0x10,
-	0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0x61,0x08,0x61,0x10,0x20,0x08,0x21,0x08,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x10,0xA2,0x18,0xA2,0x20,0xA2,0x18,0x24,0x31,0xE8,0x49,0xE2,0x20,0xA2,0x18,0x61,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x60,0x08,
-	0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x20,0x08,0xE3,0x20,0x24,0x29,0x60,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x10,0x69,0x72,0xEE,0xBB,0x62,0x20,0x61,0x18,0x24,0x31,0xE8,0x49,0xA1,0x10,0xAE,0x93,0x61,0x18,0x62,0x18,0x61,0x10,0x49,0x5A,0x60,0x10,0x20,0x10,0xE3,0x20,0x65,0x39,0x20,0x00,0x60,0x00,0x21,0x08,
-	0x61,0x10,0xA1,0x10,0x60,0x10,0xCB,0x62,0x29,0x7B,0x24,0x5A,0xBC,0xEF,0x94,0xC5,0x16,0xCE,0x12,0xAD,0x78,0xD6,0x78,0xD6,0x50,0x9C,0x78,0xD6,0xBE,0xFF,0xFF,0xFF,0x7E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0x58,0xFF,0xAD,0xB4,0x89,0x93,0x16,0xCE,0x5A,0xF7,0x52,0xDE,0x4A,0xC4,
-	0xEF,0xD5,0xD3,0xF5,0xD8,0xF6,0x56,0xF6,0xD3,0xF5,0x6E,0xD4,0x8B,0xD3,0x4B,0xB3,0xC7,0x69,0xE3,0x38,0x24,0x39,0xE2,0x28,0xA2,0x20,0x61,0x18,0x61,0x18,0x61,0x10,0x60,0x10,0x21,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0x21,0x10,0x61,0x08,0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x62,0x18,0xA2,0x18,0xA2,0x20,0xA3,0x20,0xA1,0x18,0xE3,0x20,0xA1,0x10,0x61,0x10,0x20,0x08,0x61,0x08,0x20,0x08,0x00,0x00,0x61,0x10,0x61,0x10,0xA2,0x18,0x62,0x10,0xA1,0x10,0x61,0x10,0xA2,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x60,0x10,0x65,0x49,0x20,0x10,0x62,0x20,
-	0x61,0x18,0x94,0xC5,0x20,0x10,0x61,0x18,0xE3,0x28,0x61,0x18,0xA2,0x20,0x61,0x18,0x61,0x10,0xA2,0x18,0x20,0x08,0x50,0x9C,0xCB,0x62,0xA0,0x10,0x24,0x29,0x61,0x08,0x20,0x08,0x60,0x08,0x21,0x10,0x6D,0x7B,0x23,0x29,0x24,0x29,0x5C,0xEF,0xFF,0xFF,0xFE,0xF7,0xFD,0xF7,0x78,0xD6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFC,0xFF,0xAD,0xB4,0x60,0x10,0x62,0x49,0xA9,0x92,0x8B,0xD3,0xD3,0xF5,0x51,0xE5,0xD3,0xF5,0x56,0xF6,0xD3,0xF5,0x6E,0xD4,0xC8,0xC2,0xA9,0x92,0xA5,0x69,0x24,0x41,0xE3,0x38,0xE3,0x30,0xE3,0x30,0xA2,0x20,0x61,0x18,0x60,0x10,0x61,0x10,
-	0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x08,0x62,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0x61,0x10,0x21,0x10,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x61,0x08,0x60,0x08,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x62,0x20,0x20,0x10,0xE3,0x28,0x69,0x72,0x21,0x08,0xA1,0x18,0xA2,0x20,0xA7,0x59,0xA3,0x28,0xA2,0x20,0xA2,0x18,0x61,0x10,0xA1,0x18,0x61,0x18,0x78,0xD6,0x20,0x08,0x6D,0x7B,0x50,0x9C,0xFD,0xFF,
-	0xC5,0x49,0x60,0x08,0xAE,0x93,0xA5,0x39,0xE2,0x20,0xFE,0xFF,0xFF,0xFF,0xFE,0xF7,0x5C,0xEF,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFC,0xFF,0xFE,0xFF,0xFE,0xFF,0xFC,0xFF,0xFB,0xFF,0x52,0xDE,0xA0,0x20,0xE3,0x40,0xA9,0x92,0x51,0xE5,0xD3,0xF5,
-	0xD3,0xF5,0x6E,0xD4,0x4A,0xC4,0x8B,0xD3,0xC9,0xAA,0x07,0x8A,0x65,0x59,0xE3,0x38,0xE4,0x30,0xE3,0x30,0xE2,0x30,0xE3,0x30,0xE2,0x20,0x61,0x18,0x61,0x10,0x61,0x18,0xA2,0x18,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x60,0x08,0x60,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0x00,0x00,0xE3,0x18,0x60,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x60,0x08,0x20,0x08,0x61,0x10,0x20,0x10,0x20,0x10,0x24,0x31,0x65,0x41,0x61,0x18,
-	0x21,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0x49,0x5A,0xA2,0x20,0xA2,0x20,0x61,0x10,0xC5,0x49,0x3A,0xEF,0x23,0x39,0x69,0x72,0x20,0x00,0x49,0x5A,0xBC,0xEF,0xBC,0xEF,0xC5,0x49,0x20,0x00,0x50,0x9C,0x94,0xC5,0x5C,0xEF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xD7,0xE6,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFC,0xFF,0x58,0xFF,0x52,0xDE,0x24,0x5A,0x61,0x20,0xA5,0x51,0xC9,0xAA,0x6E,0xD4,0xD3,0xF5,0x56,0xF6,0x6E,0xD4,0x47,0x92,0x64,0x49,0x23,0x41,0x23,0x41,0xA2,0x30,0xE3,0x38,0xE3,0x30,0xE3,0x30,0xE3,0x28,0xE3,0x30,0xA2,0x20,0x61,0x18,0x61,0x18,0xA1,0x18,
-	0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x20,0x00,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x21,0x10,0x60,0x08,0x21,0x08,0x61,0x10,0xCB,0x62,0xA7,0x39,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0xE3,0x18,0x21,0x08,0x20,0x00,0x00,0x00,0x61,0x10,0x00,0x00,0x20,0x00,0x61,0x18,0x60,0x10,0x60,0x10,0x20,0x10,0xE3,0x28,0x21,0x18,0xA2,0x20,0x61,0x18,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x28,0xA2,0x20,0xA1,0x20,0x24,0x31,0x29,0x7B,0xE2,0x20,0x60,0x18,0x20,0x00,0x60,0x00,0x50,0x9C,0xD7,0xE6,0xAE,0x93,
-	0x60,0x08,0xCB,0x62,0xC5,0x49,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x16,0xCE,0xBB,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFB,0xFF,0xBA,0xFF,0x52,0xDE,0xC3,0x59,0x60,0x10,0xA3,0x28,0xA9,0x92,0x6E,0xD4,0xD3,0xF5,0x56,0xF6,
-	0x56,0xF6,0x51,0xE5,0x47,0x92,0xE2,0x38,0x61,0x20,0x61,0x20,0x61,0x20,0xA2,0x20,0xA2,0x28,0xE2,0x20,0xE2,0x20,0xA2,0x20,0x61,0x18,0x62,0x20,0xA2,0x20,0xA3,0x28,0xE2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0x62,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0xA1,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0xE3,0x20,0xA2,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x00,0x00,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x20,0x20,0x08,0x20,0x10,0xA2,0x20,
-	0x61,0x18,0xA2,0x20,0xA3,0x20,0x62,0x20,0xE3,0x28,0xA2,0x20,0xA2,0x20,0x65,0x39,0x20,0x08,0xA2,0x20,0x61,0x18,0x62,0x10,0xA2,0x18,0x94,0xC5,0x5C,0xEF,0x29,0x7B,0x6D,0x7B,0xFF,0xFF,0x78,0xD6,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFE,0xFF,0xFC,0xFF,0x5A,0xF7,0xFC,0xFF,0x5A,0xF7,0x94,0xEE,0x94,0xEE,0x94,0xEE,0x4B,0xB3,0xA1,0x20,0x24,0x31,0xC9,0xAA,0x51,0xE5,0x56,0xF6,0xD8,0xF6,0xD3,0xF5,0x8B,0xD3,0x07,0x8A,0xE2,0x28,0x61,0x18,0x61,0x18,0x20,0x10,0x21,0x18,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0xA2,0x20,0xA3,0x28,0xE3,0x30,0xE4,0x28,
-	0x24,0x31,0xE2,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x18,0x61,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x20,0x00,0x20,0x08,0xA1,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x21,0x08,0xE3,0x20,0x20,0x00,0x61,0x10,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x61,0x00,0x00,0x00,0x60,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0xE3,0x20,0x61,0x10,0xC5,0x49,0x24,0x29,0xA3,0x28,0x65,0x41,0x62,0x18,0x61,0x18,0x49,0x5A,0x24,0x39,0xE2,0x28,0x24,0x39,0xE3,0x28,0xA2,0x20,0x61,0x18,0x94,0xC5,0x65,0x31,0xA2,0x20,0xA2,0x20,0x60,0x08,0x78,0xD6,0x78,0xD6,0x16,0xCE,0x50,0x9C,
-	0xFD,0xF7,0xFE,0xFF,0xFD,0xFF,0xFD,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFC,0xFF,0x94,0xEE,0x24,0x5A,0x2A,0xA4,0x24,0x5A,0x62,0x39,0x89,0x93,0xAD,0xB4,0xC7,0x69,0xA2,0x18,0xE3,0x30,0xA9,0x92,0x6E,0xD4,0x56,0xF6,0x56,0xF6,
-	0xD3,0xF5,0x8B,0xD3,0xA5,0x51,0xA2,0x20,0x20,0x10,0x60,0x10,0x60,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0xA2,0x18,0xA3,0x28,0xE3,0x30,0x24,0x39,0x24,0x39,0x24,0x31,0x24,0x29,0xE2,0x20,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0x61,0x10,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x08,0x20,0x08,0x60,0x08,0x60,0x10,0x20,0x08,0x21,0x08,0x62,0x10,0x21,0x08,0x20,0x08,0xA7,0x49,0x20,0x08,0x61,0x10,0x24,0x29,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x6D,0x7B,0x20,0x00,0x61,0x08,0x60,0x08,0x20,0x08,0xA7,0x49,0x20,0x10,0x20,0x08,0x65,0x39,0xE3,0x28,0x65,0x41,0xA1,0x20,0x21,0x18,
-	0xE8,0x49,0x21,0x10,0x94,0xC5,0x24,0x39,0xA3,0x28,0x50,0x9C,0x20,0x08,0xA1,0x18,0xA1,0x20,0xA1,0x18,0x60,0x08,0x49,0x5A,0xFD,0xFF,0x78,0xD6,0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,
-	0xFD,0xFF,0xD8,0xFF,0x29,0x7B,0xA0,0x10,0xA0,0x10,0x60,0x18,0x23,0x41,0x07,0x8A,0x85,0x7A,0x64,0x39,0x20,0x10,0xA2,0x20,0x66,0x69,0x4B,0xB3,0xD3,0xF5,0x51,0xE5,0x51,0xE5,0xC9,0xAA,0x24,0x41,0xA2,0x20,0xA1,0x20,0xA2,0x20,0xA1,0x20,0x61,0x18,0x60,0x10,0x20,0x08,0x60,0x08,0xA2,0x20,0xE3,0x28,0xE4,0x30,0xE4,0x30,0x24,0x39,
-	0x24,0x39,0x24,0x31,0xE3,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0x61,0x10,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x21,0x08,0x62,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x18,0xA3,0x20,0x20,0x08,0x20,0x08,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x61,0x18,0x60,0x10,0x20,0x08,0xE3,0x30,0x49,0x5A,0xA3,0x20,0xA2,0x20,0xE3,0x28,0x6D,0x7B,0x24,0x39,0x24,0x39,0xA1,0x18,0xAE,0x93,0xFC,0xFF,0x3A,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFB,0xFF,0x38,0xEF,0x16,0xCE,0x12,0xAD,0x62,0x39,0xE0,0x20,0xA5,0x51,0x69,0x72,0xA9,0x92,0x4B,0xB3,0xEF,0xD5,0x2D,0xCD,0xA9,0x92,0xE2,0x30,0x61,0x10,0xA1,0x18,0x64,0x49,0x47,0xAA,0x8B,0xD3,
-	0x6E,0xD4,0xE7,0x79,0xA2,0x30,0xA2,0x28,0xE3,0x38,0xE3,0x38,0xE3,0x30,0xA2,0x28,0x61,0x20,0x61,0x10,0x61,0x10,0x62,0x20,0xE3,0x28,0xE3,0x30,0xE4,0x30,0x24,0x39,0xE4,0x30,0x24,0x39,0xE3,0x28,0xA2,0x20,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x61,0x10,0x61,0x08,0x21,0x08,0xA3,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x61,0x10,0x20,0x08,0x20,0x00,0x61,0x10,0x20,0x00,0x61,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x60,0x08,0x00,0x00,0x61,0x10,0x60,0x08,0x20,0x10,0x61,0x18,0x20,0x08,0xE8,0x49,0x60,0x18,0xA2,0x18,0x61,0x18,
-	0xCB,0x62,0xAE,0x93,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0x6D,0x7B,0x12,0xAD,0x94,0xC5,0x16,0xCE,0xFD,0xF7,0xFD,0xFF,0xBD,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFC,0xFF,0xFD,0xFF,0xFF,0xFF,0xFC,0xFF,0xFB,0xFF,0x38,0xEF,0x87,0xAB,0xC3,0x59,
-	0xC3,0x59,0xE2,0x28,0xE2,0x30,0x2A,0xA4,0xD3,0xF5,0x94,0xEE,0x94,0xEE,0x56,0xF6,0x56,0xF6,0x8B,0xD3,0x64,0x49,0xA1,0x10,0x61,0x18,0xA2,0x28,0x07,0x8A,0x4B,0xB3,0x4B,0xB3,0x07,0x8A,0xE3,0x40,0x24,0x39,0x24,0x41,0x23,0x41,0x24,0x49,0xE4,0x48,0xA3,0x30,0xA2,0x28,0xA2,0x20,0xA2,0x28,0xE3,0x28,0xE3,0x30,0xE3,0x30,0x24,0x41,
-	0x25,0x41,0x65,0x41,0xE4,0x30,0xA3,0x20,0xA3,0x18,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0x61,0x08,0x60,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x62,0x18,0x21,0x08,0x62,0x10,0x61,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x21,0x10,0x20,0x00,0x21,0x08,0x20,0x08,0x20,0x00,
-	0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x60,0x08,0x20,0x00,0x60,0x08,0x61,0x10,0x00,0x00,0x20,0x08,0x20,0x08,0x62,0x18,0x60,0x10,0x61,0x18,0x20,0x10,0x61,0x18,0xA2,0x28,0x61,0x18,0xE3,0x28,0xE3,0x28,0xA2,0x20,0xE3,0x28,0x61,0x18,0x64,0x39,0xFE,0xF7,0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xBA,0xFF,0x94,0xEE,0x2D,0xCD,0x52,0xDE,0x38,0xEF,0xFB,0xFF,0xFB,0xFF,0x94,0xEE,0xEF,0xD5,0x52,0xDE,0x2A,0xA4,0x23,0x59,0x4A,0xC4,0x94,0xEE,0xD3,0xF5,0x51,0xE5,0x51,0xE5,0x51,0xE5,0xC9,0xAA,0x24,0x39,0x61,0x18,0xA2,0x20,0xE3,0x40,0x07,0x8A,0xC8,0xC2,
-	0xC9,0xAA,0xA5,0x99,0x65,0x69,0x24,0x49,0x24,0x49,0x24,0x49,0x23,0x59,0x65,0x59,0x23,0x59,0xE3,0x40,0xE3,0x38,0xE4,0x30,0xE3,0x30,0xE3,0x30,0xE3,0x30,0x25,0x41,0xA7,0x59,0x66,0x51,0x65,0x39,0x24,0x31,0xE3,0x20,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0x61,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x10,0x61,0x10,0x62,0x10,0x21,0x08,0x61,0x10,0x62,0x10,0x20,0x08,0x60,0x08,0x21,0x08,0x20,0x08,0x62,0x10,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x60,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0xAE,0x93,0x20,0x08,0x61,0x10,0x20,0x10,0x20,0x10,0xA2,0x20,0x21,0x10,0x20,0x10,0x20,0x18,
-	0xA2,0x20,0x21,0x10,0x61,0x20,0x61,0x20,0x49,0x5A,0x6D,0x7B,0x12,0xAD,0xBD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xBB,0xF7,0xAE,0x93,0x38,0xEF,0xFD,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFC,0xFF,0xFC,0xF7,0x94,0xEE,0xA3,0x39,0xA0,0x10,0x62,0x39,0x12,0xAD,0xD7,0xE6,0xEF,0xD5,0x52,0xDE,
-	0xFB,0xFF,0xD8,0xF6,0x06,0x8B,0x65,0x69,0x06,0x8B,0x85,0x7A,0xA5,0x51,0xC3,0x59,0x65,0x49,0x23,0x39,0x61,0x18,0xA2,0x20,0x24,0x41,0x65,0x69,0x4B,0xB3,0x6E,0xD4,0x8B,0xD3,0x4B,0xB3,0x07,0x8A,0x65,0x69,0x23,0x59,0x65,0x69,0x65,0x69,0x65,0x69,0x65,0x59,0xE3,0x40,0x23,0x41,0xE3,0x38,0x24,0x39,0xA3,0x28,0xE3,0x30,0x65,0x49,
-	0x65,0x49,0x65,0x49,0x24,0x31,0x24,0x39,0xE4,0x28,0xA3,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x10,0x61,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0x62,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0xA3,0x20,0x20,0x08,0x20,0x08,0x60,0x08,0x20,0x00,0x20,0x08,
-	0x61,0x10,0x20,0x00,0x00,0x00,0x21,0x00,0xAE,0x93,0x20,0x08,0x60,0x08,0x20,0x00,0x61,0x10,0x60,0x08,0x20,0x08,0xA2,0x20,0xA2,0x18,0x65,0x41,0xE3,0x28,0x65,0x39,0xA2,0x28,0xCB,0x62,0x65,0x39,0x16,0xCE,0x16,0xCE,0xBB,0xF7,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFC,0xFF,0xBB,0xF7,0x38,0xEF,
-	0xAD,0xB4,0xE1,0x39,0x94,0xC5,0x38,0xEF,0x5A,0xF7,0xFC,0xFF,0xFC,0xFF,0xFB,0xFF,0xFB,0xFF,0x89,0x93,0xA0,0x20,0xA0,0x20,0xE1,0x28,0xC5,0x49,0x62,0x39,0x06,0x8B,0x36,0xF7,0xFB,0xFF,0xEF,0xD5,0x23,0x41,0x20,0x10,0x61,0x10,0x20,0x10,0x21,0x10,0xA1,0x18,0x61,0x18,0x61,0x10,0xE3,0x38,0x66,0x69,0x47,0x92,0x6E,0xD4,0xD3,0xF5,
-	0x51,0xE5,0x51,0xE5,0x4B,0xB3,0x44,0x81,0x65,0x69,0x23,0x59,0x23,0x59,0xE4,0x48,0xE4,0x48,0x24,0x49,0x24,0x41,0x24,0x41,0xE3,0x38,0xA2,0x28,0xA2,0x28,0xE4,0x30,0x24,0x39,0x24,0x39,0x24,0x39,0x24,0x31,0x24,0x29,0xE3,0x20,0xA2,0x18,0xA2,0x10,0x62,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x62,0x10,0x62,0x10,0x21,0x10,0x20,0x10,0x21,0x08,0xA3,0x18,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x60,0x08,0xA1,0x10,0x00,0x00,0x20,0x00,0x60,0x08,0x00,0x00,0x61,0x08,0x60,0x08,0x61,0x10,0x00,0x00,0x20,0x08,0x60,0x10,0x20,0x10,0x24,0x31,0x61,0x18,0x20,0x10,0xA7,0x59,
-	0x50,0x9C,0x94,0xC5,0x49,0x5A,0xFE,0xF7,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0x16,0xCE,0x94,0xC5,0x29,0x7B,0x52,0xDE,0xFC,0xF7,0x38,0xEF,0xA3,0x39,0xA0,0x10,0xE1,0x20,0x2A,0xA4,0x94,0xEE,0xEF,0xD5,0x94,0xEE,0xD8,0xFF,0x94,0xEE,0x52,0xDE,0xAD,0xB4,0xA5,0x51,0x60,0x10,0x20,0x00,0xE2,0x20,
-	0x2D,0xCD,0x36,0xF7,0x16,0xCE,0xC5,0x49,0x60,0x10,0x23,0x29,0x23,0x39,0xA2,0x20,0x60,0x10,0x61,0x10,0x61,0x20,0x24,0x49,0xA9,0x92,0x8B,0xD3,0x51,0xE5,0xD3,0xF5,0x56,0xF6,0xD3,0xF5,0x8B,0xD3,0x47,0xAA,0x85,0x71,0xC3,0x58,0x62,0x30,0xA2,0x30,0xE3,0x40,0xE3,0x38,0xE3,0x38,0xE3,0x38,0x24,0x39,0xE3,0x30,0xE3,0x30,0xE4,0x30,
-	0xE3,0x30,0xE3,0x28,0xE4,0x28,0xE4,0x28,0xE3,0x28,0xA2,0x20,0x62,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x20,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0xA3,0x18,0x20,0x08,0x60,0x08,0x60,0x08,0x61,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x08,0x20,0x00,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x08,0x61,0x08,0x20,0x08,0xA1,0x10,0x61,0x10,0x20,0x10,0x49,0x5A,0x61,0x18,0x20,0x10,0xEC,0x8A,0x6D,0x7B,0xE8,0x49,0x6D,0x7B,0x00,0x00,0x12,0xAD,0xBD,0xF7,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xE1,0x18,0xA0,0x18,0x24,0x5A,0xD8,0xFF,0xFB,0xFF,
-	0xFB,0xFF,0xE1,0x20,0x60,0x10,0x61,0x08,0xE0,0x20,0xE2,0x18,0xE1,0x28,0x2D,0xCD,0x94,0xEE,0xD8,0xFF,0xBA,0xFF,0x5A,0xF7,0x2D,0xCD,0x23,0x39,0x21,0x00,0x21,0x08,0x65,0x49,0xAD,0xB4,0x2A,0xA4,0x23,0x39,0x64,0x39,0xA9,0x92,0x4B,0xB3,0xE7,0x79,0xE2,0x28,0x61,0x18,0xA2,0x20,0xE7,0x79,0x8B,0xD3,0x51,0xE5,0xD3,0xF5,0xD3,0xF5,
-	0x56,0xF6,0xD3,0xF5,0x8B,0xD3,0xC9,0xAA,0x47,0x92,0x24,0x49,0x61,0x28,0x61,0x20,0xA2,0x20,0xE2,0x28,0xE3,0x38,0x24,0x41,0x24,0x41,0xE3,0x38,0xE3,0x38,0x65,0x41,0xE4,0x30,0xE3,0x30,0xE3,0x28,0xE2,0x20,0xE2,0x20,0x61,0x10,0x60,0x08,0x60,0x08,0x21,0x10,0x61,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x21,0x10,0x60,0x08,0x60,0x10,0x20,0x08,0x62,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xE3,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x08,0x20,0x08,0x00,0x00,0xA2,0x18,0x00,0x00,0x60,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x60,0x08,0xA7,0x39,0x61,0x10,0xA3,0x20,0x20,0x10,0xA2,0x20,0x61,0x18,0x24,0x31,0x50,0x9C,0xAE,0x93,
-	0xC5,0x49,0xFD,0xF7,0x12,0xAD,0xBB,0xF7,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFC,0xFF,0x5A,0xF7,0xA3,0x39,0x60,0x10,0x94,0xC5,0xFB,0xFF,0xFB,0xFF,0xFB,0xFF,0x12,0xAD,0x60,0x08,0xA0,0x10,0x61,0x10,0xA1,0x18,0x60,0x18,0xA3,0x49,0x94,0xEE,0x58,0xFF,0x36,0xF7,0xD7,0xE6,0x38,0xEF,0xEF,0xD5,0xA3,0x39,0x61,0x08,0x20,0x08,
-	0x20,0x10,0xE2,0x28,0xE2,0x28,0x60,0x18,0x64,0x49,0xEE,0xBB,0xD3,0xF5,0x6E,0xD4,0xC7,0x69,0x62,0x20,0xE3,0x40,0xA9,0x92,0x6E,0xD4,0x6E,0xD4,0x51,0xE5,0xD3,0xF5,0xD3,0xF5,0xD3,0xF5,0x8B,0xD3,0x4B,0xB3,0x07,0x8A,0xE4,0x48,0xA1,0x20,0xA1,0x20,0x61,0x20,0x61,0x18,0xA1,0x20,0xE3,0x30,0xE3,0x38,0xE3,0x38,0x24,0x39,0x24,0x41,
-	0x24,0x39,0xE3,0x30,0xE3,0x28,0xA3,0x28,0xA2,0x18,0x61,0x10,0x61,0x10,0x61,0x08,0x21,0x10,0x60,0x08,0x21,0x08,0x20,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x10,0x60,0x08,0x21,0x10,0x20,0x08,0x20,0x08,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x61,0x10,0x20,0x08,
-	0xA1,0x10,0x00,0x00,0x61,0x10,0x20,0x00,0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0xA2,0x20,0x65,0x39,0x20,0x08,0x20,0x10,0x60,0x10,0x49,0x5A,0x7E,0xF7,0x16,0xCE,0x60,0x10,0xBD,0xFF,0xBC,0xEF,0xFC,0xF7,0x78,0xD6,0xFE,0xFF,0xFD,0xFF,0xFC,0xFF,0xD7,0xE6,0x62,0x39,0x00,0x00,0x60,0x08,0x94,0xEE,0xFB,0xFF,0x36,0xF7,0x49,0x5A,
-	0xA0,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x18,0x61,0x18,0x64,0x41,0x52,0xDE,0x52,0xDE,0x06,0x8B,0x85,0x7A,0x2A,0xA4,0xC7,0x69,0xA0,0x18,0x60,0x10,0x60,0x08,0x60,0x08,0x60,0x10,0x20,0x08,0x20,0x10,0xE3,0x30,0x4A,0xC4,0xD3,0xF5,0x6E,0xD4,0x47,0x92,0xE2,0x30,0x24,0x41,0x85,0x71,0x4B,0xB3,0x6E,0xD4,0x8B,0xD3,0x6E,0xD4,
-	0x6E,0xD4,0x8B,0xD3,0x8B,0xD3,0xC8,0xC2,0x85,0x71,0xE3,0x40,0xE3,0x38,0xE3,0x30,0xA3,0x28,0x61,0x20,0x61,0x18,0xA2,0x28,0xE3,0x30,0x24,0x39,0xE3,0x38,0x24,0x39,0xE4,0x30,0xE3,0x28,0xA2,0x20,0xA2,0x18,0x60,0x10,0x61,0x10,0x60,0x08,0x21,0x08,0x60,0x08,0x61,0x08,0x21,0x08,0x60,0x00,0x20,0x08,0x60,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x21,0x10,0x60,0x08,0x20,0x10,0x20,0x08,0xA3,0x18,0x20,0x08,0x20,0x08,0x21,0x08,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x08,0x20,0x00,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x08,0x60,0x10,0x20,0x08,0x60,0x10,0x69,0x72,0xEC,0x8A,0xA7,0x59,0x20,0x10,
-	0x94,0xC5,0xFE,0xFF,0xBB,0xF7,0xFD,0xFF,0xFC,0xF7,0xFD,0xF7,0xFC,0xFF,0xFD,0xFF,0x5A,0xF7,0xC5,0x49,0xA3,0x39,0xD7,0xE6,0xEF,0xD5,0xAD,0xB4,0xA5,0x39,0x60,0x00,0x20,0x00,0x20,0x08,0x60,0x18,0xA0,0x20,0x60,0x10,0x60,0x08,0xA1,0x18,0x24,0x39,0x64,0x41,0xA3,0x49,0x4A,0xC4,0xEE,0xBB,0x64,0x49,0x60,0x10,0x60,0x08,0x60,0x08,
-	0x60,0x10,0x60,0x10,0x60,0x10,0x20,0x10,0xE2,0x30,0xA9,0x92,0x6E,0xD4,0x4A,0xC4,0xC7,0x69,0xA2,0x20,0xE2,0x28,0x65,0x49,0xE7,0x79,0xA9,0x92,0x47,0x92,0x47,0xAA,0x47,0xAA,0x4B,0xB3,0xC9,0xAA,0xA9,0x92,0x66,0x69,0xE3,0x38,0x24,0x39,0xE4,0x30,0xE3,0x28,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xE3,0x30,0xE4,0x30,0x24,0x39,0x24,0x39,
-	0xA3,0x30,0xA2,0x20,0x62,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x21,0x10,0x61,0x10,0x61,0x10,0x21,0x10,0x60,0x08,0x60,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0xA3,0x18,0x21,0x08,0x21,0x08,0x20,0x08,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,
-	0x61,0x10,0x61,0x08,0x20,0x00,0x61,0x10,0x61,0x10,0x00,0x00,0x61,0x08,0x20,0x08,0xE3,0x20,0x20,0x08,0x61,0x10,0x65,0x49,0xC7,0x69,0xE3,0x30,0x20,0x10,0x21,0x10,0x89,0x93,0xD7,0xE6,0xFC,0xF7,0xFC,0xFF,0xBD,0xFF,0xFB,0xFF,0x38,0xEF,0x5A,0xF7,0xFC,0xFF,0xA3,0x39,0x12,0xAD,0xFC,0xFF,0x38,0xEF,0xA3,0x39,0x20,0x00,0x20,0x08,
-	0x20,0x08,0x60,0x10,0x06,0x8B,0x2D,0xCD,0x24,0x5A,0x60,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0xA5,0x39,0x51,0xE5,0x94,0xEE,0x29,0x7B,0x21,0x08,0x20,0x00,0x20,0x08,0x21,0x10,0x61,0x10,0x60,0x10,0x60,0x10,0x23,0x41,0x89,0x93,0x4B,0xB3,0xA9,0x92,0x24,0x39,0x21,0x10,0x61,0x18,0xA3,0x20,0x24,0x39,0xE4,0x48,0xE4,0x30,0x66,0x69,
-	0xA9,0x92,0xC9,0xAA,0xC9,0xAA,0x07,0x8A,0xE4,0x48,0xA2,0x30,0xE3,0x30,0xE3,0x28,0xE2,0x28,0xE3,0x28,0xA2,0x20,0xA2,0x20,0xA3,0x28,0xE4,0x30,0x24,0x39,0x24,0x39,0xA3,0x30,0x62,0x20,0xA1,0x18,0xA2,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x61,0x08,0x60,0x08,0x21,0x08,0x60,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x18,0x21,0x10,0x60,0x08,0x20,0x10,0x20,0x08,0xA2,0x18,0x21,0x08,0x20,0x08,0x21,0x08,0x62,0x10,0x21,0x08,0x20,0x00,0x61,0x10,0x61,0x10,0x20,0x00,0x20,0x08,0x61,0x08,0x61,0x10,0x20,0x00,0x61,0x08,0xE3,0x18,0x20,0x08,0x62,0x10,0x61,0x10,0x60,0x08,0x21,0x08,0xA1,0x10,0xA7,0x59,0x20,0x10,0x61,0x18,0xA1,0x18,0xE1,0x20,
-	0x60,0x10,0xD7,0xE6,0xFC,0xFF,0x2A,0xA4,0xAD,0xB4,0x38,0xEF,0x89,0x93,0x29,0x7B,0x2A,0xA4,0x60,0x08,0x89,0x93,0xFB,0xFF,0xFC,0xFF,0x24,0x5A,0x20,0x08,0x20,0x08,0x60,0x08,0xE2,0x20,0x94,0xC5,0x5A,0xF7,0xAD,0xB4,0xC1,0x30,0x23,0x39,0xA1,0x20,0x21,0x08,0xE2,0x28,0x4B,0xB3,0x4A,0xC4,0xA5,0x51,0x20,0x08,0x60,0x10,0xA1,0x20,
-	0x62,0x18,0x61,0x10,0x61,0x10,0x60,0x10,0x24,0x39,0xC9,0xAA,0xC9,0xAA,0xA9,0x92,0xE3,0x28,0x20,0x10,0x60,0x10,0x20,0x10,0x61,0x10,0x20,0x08,0x62,0x18,0x66,0x51,0x07,0x8A,0xA9,0x92,0x07,0x8A,0x65,0x59,0xA1,0x28,0xA2,0x20,0xE3,0x28,0xE2,0x28,0xA3,0x28,0xE3,0x20,0xA2,0x20,0x61,0x18,0xA2,0x20,0xE3,0x28,0xA3,0x30,0xE3,0x30,
-	0xA2,0x20,0x62,0x20,0x62,0x20,0xA1,0x18,0x62,0x10,0x62,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x61,0x08,0x60,0x08,0x21,0x08,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x60,0x10,0x20,0x08,0x20,0x08,0x62,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x21,0x08,
-	0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x24,0x29,0xA1,0x18,0xA7,0x59,0xAE,0x93,0x60,0x10,0x94,0xC5,0x2A,0xA4,0x94,0xC5,0x58,0xFF,0x16,0xCE,0x61,0x18,0x60,0x08,0x62,0x39,0x60,0x00,0x60,0x00,0xA0,0x18,0xA0,0x18,0x62,0x39,0x52,0xDE,0xD7,0xE6,0x64,0x39,0x20,0x08,0x21,0x08,
-	0x60,0x08,0x60,0x08,0x29,0x7B,0x51,0xE5,0xA9,0x92,0x85,0x7A,0x6E,0xD4,0xA9,0x92,0xA1,0x20,0x60,0x10,0xE2,0x30,0x23,0x41,0xA1,0x18,0x60,0x10,0x64,0x41,0xE7,0x79,0xA5,0x51,0xA2,0x20,0x20,0x08,0x20,0x00,0xA1,0x18,0xA5,0x69,0x47,0x92,0xA5,0x51,0x62,0x18,0x60,0x08,0x21,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0xA1,0x20,0x65,0x49,
-	0x66,0x69,0x66,0x69,0x66,0x69,0x24,0x41,0x62,0x20,0x61,0x18,0xA1,0x20,0xA3,0x20,0xE3,0x20,0xE3,0x28,0xA2,0x18,0x60,0x10,0x61,0x10,0x62,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0x62,0x18,0xA1,0x20,0xA2,0x18,0x62,0x18,0xA1,0x10,0x62,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x21,0x08,0x60,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x21,0x10,0x60,0x10,0x20,0x10,0x20,0x08,0x62,0x10,0x21,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x08,0xA2,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA3,0x18,0x00,0x00,0x20,0x00,0x60,0x08,0xE8,0x49,0x61,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0xA2,0x18,0x24,0x39,0x69,0x72,0x60,0x20,0x20,0x08,0x78,0xD6,0xFC,0xF7,
-	0xD8,0xFF,0xBB,0xF7,0x85,0x7A,0xA0,0x18,0x60,0x10,0xA2,0x18,0x60,0x08,0x20,0x08,0xE1,0x20,0x23,0x29,0x60,0x10,0x23,0x29,0xE2,0x20,0x20,0x10,0x21,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0xA1,0x18,0x60,0x10,0x29,0x7B,0x56,0xF6,0x2D,0xCD,0xE2,0x30,0x60,0x10,0x61,0x18,0xA2,0x20,0xA1,0x18,0xE2,0x28,0xA9,0x92,0x4A,0xC4,
-	0xEE,0xBB,0xA9,0x92,0xE2,0x20,0x20,0x08,0x20,0x08,0x62,0x20,0xE2,0x28,0x62,0x20,0x20,0x10,0x20,0x10,0x61,0x10,0x60,0x08,0x60,0x08,0x21,0x08,0xE3,0x28,0x24,0x41,0x24,0x49,0x25,0x49,0x25,0x49,0x24,0x49,0xA3,0x30,0xA3,0x28,0x62,0x18,0x60,0x10,0x61,0x18,0x62,0x18,0x60,0x10,0x21,0x08,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,
-	0x62,0x18,0xA1,0x20,0xA2,0x20,0xA2,0x20,0x61,0x18,0x62,0x10,0x62,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x61,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0xA2,0x18,0x21,0x08,0x20,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x61,0x10,0x20,0x08,0xA1,0x10,0xA2,0x10,0x60,0x00,0x20,0x00,0x20,0x00,0x65,0x31,0x20,0x10,0x61,0x18,0x49,0x5A,0x61,0x20,0x94,0xC5,0x94,0xC5,0xFD,0xFF,0x5A,0xF7,0xFC,0xF7,0xFC,0xFF,0x5A,0xF7,0x94,0xC5,0xA5,0x39,0x60,0x10,0x60,0x10,0x60,0x08,0xA1,0x18,0xE2,0x28,0x61,0x08,0x20,0x08,0x60,0x10,0x60,0x10,0x20,0x08,0x60,0x08,
-	0x20,0x08,0x20,0x08,0xE2,0x28,0x64,0x39,0xA2,0x28,0xA5,0x69,0x4B,0xB3,0x69,0x72,0xA0,0x18,0x61,0x08,0x61,0x08,0x61,0x10,0x60,0x10,0xE2,0x20,0x07,0x8A,0x6E,0xD4,0xD3,0xF5,0xEE,0xBB,0xE7,0x79,0xE2,0x20,0x60,0x08,0x60,0x10,0x60,0x10,0x60,0x08,0x20,0x10,0x20,0x08,0x61,0x10,0x21,0x10,0x60,0x08,0x20,0x10,0xA2,0x18,0xE3,0x38,
-	0x65,0x49,0x65,0x59,0x65,0x69,0x66,0x69,0x24,0x49,0x24,0x39,0xE3,0x28,0x61,0x10,0x20,0x08,0x20,0x08,0x21,0x08,0x60,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0xA1,0x18,0xA2,0x20,0x62,0x18,0xA2,0x20,0xA2,0x18,0xA1,0x18,0x62,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x08,
-	0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x62,0x18,0x60,0x10,0x61,0x10,0x60,0x08,0x20,0x08,0x62,0x10,0x20,0x08,0x20,0x08,0x21,0x08,0x60,0x08,0x61,0x08,0x20,0x08,0xA2,0x18,0x20,0x08,0x20,0x08,0x21,0x08,0x61,0x08,0x20,0x08,0x65,0x29,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x24,0x29,0x21,0x08,0x21,0x10,0x20,0x10,0x24,0x49,0xA5,0x51,0x12,0xAD,0xBA,0xFF,0xD7,0xE6,
-	0xBD,0xFF,0x38,0xEF,0xFC,0xFF,0xFE,0xFF,0x2A,0xA4,0xE0,0x20,0x24,0x5A,0xE2,0x20,0xA1,0x18,0x61,0x10,0x20,0x08,0xE2,0x20,0x89,0x93,0x2A,0xA4,0x23,0x29,0x20,0x08,0x20,0x10,0x61,0x20,0x89,0x93,0x51,0xE5,0x52,0xDE,0x4B,0xB3,0x45,0x6A,0x60,0x20,0x21,0x00,0x60,0x08,0x21,0x08,0x20,0x10,0x60,0x08,0x61,0x18,0x64,0x39,0x47,0x92,
-	0x6E,0xD4,0x8B,0xD3,0xC9,0xAA,0x65,0x49,0x61,0x10,0x21,0x18,0x61,0x10,0x61,0x18,0x61,0x18,0x20,0x08,0x60,0x10,0x61,0x10,0x60,0x10,0x21,0x10,0x61,0x18,0xE4,0x28,0x65,0x59,0xC7,0x69,0xE7,0x79,0xE7,0x79,0x24,0x49,0x24,0x41,0x24,0x39,0xA2,0x20,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,
-	0x61,0x18,0xA2,0x20,0xA1,0x18,0x62,0x18,0xA2,0x18,0x62,0x18,0xA2,0x10,0x62,0x18,0xA2,0x10,0xA2,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x61,0x10,0x61,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0x21,0x10,0x61,0x10,0x21,0x10,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0xE3,0x20,0x21,0x08,0x20,0x08,0x60,0x08,
-	0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x60,0x08,0xA1,0x18,0xAE,0x93,0xC9,0xAA,0xD8,0xF6,0xD8,0xF6,0xAD,0xB4,0x06,0x8B,0xEE,0xBB,0x2A,0xA4,0x94,0xC5,0x12,0xAD,0x62,0x39,0x2A,0xA4,0xBB,0xF7,0xAD,0xB4,0xA2,0x20,0x61,0x10,0x20,0x10,0x29,0x7B,0xFB,0xFF,0x5A,0xF7,0x24,0x5A,0x20,0x10,
-	0x61,0x18,0xA1,0x28,0x4B,0xB3,0x56,0xF6,0xD8,0xF6,0xD3,0xF5,0x06,0x8B,0x61,0x18,0x20,0x08,0x60,0x08,0x20,0x10,0x20,0x08,0x20,0x00,0x21,0x08,0x60,0x18,0xE2,0x38,0xA5,0x69,0xC9,0xAA,0x69,0x72,0x64,0x39,0x21,0x10,0x61,0x18,0xA2,0x28,0x24,0x41,0x23,0x39,0xA2,0x20,0x60,0x10,0x61,0x18,0xE2,0x20,0xA3,0x20,0x61,0x18,0x62,0x18,
-	0x65,0x41,0x65,0x59,0x66,0x69,0xC7,0x69,0x65,0x59,0x24,0x41,0x24,0x39,0xE2,0x20,0x61,0x10,0x20,0x08,0x20,0x10,0x60,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x62,0x20,0xA1,0x20,0x62,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0x62,0x10,0xA2,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x08,0x61,0x10,
-	0x61,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE3,0x20,0x61,0x10,0x60,0x10,0x60,0x08,0x61,0x08,0x61,0x10,0x21,0x08,0x61,0x08,0x20,0x08,0x21,0x08,0x60,0x10,0x49,0x5A,0x62,0x10,0x60,0x10,0x20,0x08,0x21,0x08,0x20,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x65,0x31,0x61,0x08,0x60,0x08,0x60,0x10,0x61,0x28,0xE7,0x79,0x58,0xFF,0xA5,0x69,0x23,0x59,0xA2,0x38,
-	0x94,0xC5,0x56,0xF6,0x23,0x59,0x20,0x18,0x60,0x18,0x2A,0xA4,0x58,0xFF,0x52,0xDE,0xA1,0x20,0x21,0x10,0x60,0x18,0x52,0xDE,0xBA,0xFF,0x58,0xFF,0xC5,0x49,0x61,0x10,0x60,0x18,0x60,0x18,0x23,0x39,0x85,0x7A,0x4B,0xB3,0x2A,0xA4,0x66,0x41,0x20,0x08,0x61,0x10,0x20,0x10,0x60,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x21,0x10,0xA1,0x20,
-	0xE2,0x38,0x23,0x41,0x62,0x39,0x60,0x18,0x20,0x08,0x61,0x18,0x24,0x39,0x65,0x59,0x65,0x59,0x64,0x41,0x62,0x20,0xE2,0x28,0x24,0x39,0x24,0x41,0xE3,0x28,0xA2,0x20,0x24,0x31,0x24,0x41,0x25,0x41,0xA7,0x59,0x65,0x59,0x24,0x39,0x23,0x39,0xA2,0x20,0x20,0x10,0x60,0x10,0x61,0x10,0x60,0x08,0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x18,
-	0x61,0x18,0x62,0x20,0xA2,0x20,0xA2,0x18,0x62,0x20,0xA2,0x18,0x62,0x18,0xA2,0x18,0x62,0x18,0xA2,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x20,0x62,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x61,0x08,0x60,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x21,0x08,0xA2,0x18,0x61,0x08,0x20,0x08,0x21,0x08,
-	0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x61,0x10,0x20,0x00,0x61,0x10,0xA2,0x18,0x69,0x72,0xA9,0x92,0x5A,0xF7,0x85,0x7A,0xE3,0x30,0x61,0x28,0xE7,0x79,0xD8,0xF6,0x51,0xE5,0xC3,0x59,0x2A,0xA4,0x2A,0xA4,0x85,0x7A,0x24,0x5A,0xE1,0x20,0x60,0x18,0xA5,0x51,0x38,0xEF,0xBA,0xFF,0x89,0x93,0x60,0x18,0x60,0x10,
-	0x60,0x08,0x60,0x08,0x20,0x08,0x60,0x20,0xC1,0x30,0xA2,0x28,0x61,0x18,0x21,0x08,0x60,0x10,0x60,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x61,0x10,0xA1,0x18,0x60,0x18,0x60,0x18,0x20,0x10,0x20,0x08,0x60,0x10,0xE3,0x30,0x65,0x59,0x65,0x69,0x65,0x59,0xA2,0x20,0xE3,0x30,0x24,0x39,0x24,0x41,0x24,0x41,0xA2,0x20,
-	0xE3,0x28,0x24,0x39,0x24,0x39,0x24,0x39,0x24,0x39,0xE2,0x30,0xA2,0x20,0x61,0x10,0x20,0x10,0x20,0x10,0x61,0x10,0x21,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x62,0x18,0xA1,0x18,0x62,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x20,0xA2,0x18,0xA3,0x20,0xA2,0x18,0x62,0x10,0xA2,0x18,0x62,0x18,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x08,
-	0x61,0x08,0x61,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE2,0x20,0xA2,0x18,0x61,0x18,0x60,0x10,0x20,0x08,0x61,0x00,0x62,0x10,0x61,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x60,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0xE3,0x28,0xA3,0x38,0xE4,0x48,0x94,0xC5,0x5A,0xF7,0x3A,0xEF,0x64,0x49,0x60,0x18,
-	0x23,0x39,0x94,0xC5,0xD3,0xF5,0x06,0x8B,0x5A,0xF7,0x52,0xDE,0xA1,0x18,0xA1,0x18,0xE2,0x20,0xE1,0x20,0xA5,0x51,0xAD,0xB4,0xAD,0xB4,0x62,0x39,0x20,0x08,0x60,0x08,0x61,0x08,0x60,0x00,0x60,0x18,0xC7,0x69,0xE7,0x79,0xE2,0x30,0x20,0x10,0x20,0x10,0x60,0x10,0x21,0x10,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x10,
-	0x61,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0x20,0x10,0x20,0x10,0x61,0x18,0x24,0x39,0x65,0x59,0x24,0x41,0xA2,0x20,0xA3,0x28,0xE4,0x30,0x25,0x41,0x24,0x39,0x62,0x20,0xA2,0x20,0xA3,0x28,0xE4,0x30,0xE3,0x20,0x61,0x18,0x61,0x10,0x60,0x08,0x21,0x10,0x60,0x10,0x21,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x18,0x61,0x10,
-	0x61,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0x62,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x10,0x62,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x28,0xE3,0x28,0x61,0x18,0x61,0x10,0x21,0x08,0x61,0x08,0x62,0x08,0x21,0x00,0x20,0x00,0x21,0x08,0x60,0x08,0x62,0x10,0x20,0x08,0x21,0x08,0x20,0x08,0x61,0x10,
-	0x20,0x08,0xA2,0x18,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x10,0x12,0xAD,0xD8,0xF6,0xC7,0x69,0x66,0x51,0xD8,0xF6,0xFE,0xFF,0xAE,0x93,0xA2,0x20,0x60,0x10,0x64,0x49,0x23,0x41,0xE2,0x38,0x51,0xE5,0xD7,0xE6,0x23,0x39,0x60,0x10,0x20,0x08,0x20,0x10,0xA0,0x18,0xE1,0x28,0xA2,0x28,0x60,0x10,0x20,0x08,0x60,0x10,
-	0x61,0x10,0x61,0x18,0xE2,0x30,0xEC,0x8A,0x6E,0xD4,0x65,0x59,0x60,0x08,0x60,0x10,0x21,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0xA1,0x20,0x64,0x49,0x24,0x41,0x61,0x18,0x60,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x60,0x10,0x60,0x10,0x61,0x18,0x61,0x28,0x61,0x20,0x61,0x18,0x61,0x20,0xE2,0x20,0x24,0x31,0xE3,0x28,0x61,0x18,
-	0x60,0x10,0x61,0x10,0x61,0x20,0x61,0x18,0x61,0x18,0x61,0x10,0x20,0x10,0x61,0x10,0x60,0x08,0x20,0x10,0x61,0x18,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x18,0x62,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0x62,0x18,0xA2,0x18,0xA2,0x20,0xA3,0x18,0x62,0x18,0xA2,0x18,0x62,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,
-	0x62,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA3,0x28,0xA3,0x20,0xA2,0x18,0x60,0x10,0x20,0x08,0x21,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0xA2,0x18,0x21,0x08,0x21,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x25,0x41,0x4B,0xB3,0xE4,0x48,0xA2,0x38,0x89,0x93,0x94,0xC5,0x4B,0xB3,0xE3,0x38,
-	0xA1,0x28,0x4B,0xB3,0xA9,0x92,0xA0,0x28,0xAD,0xB4,0xFC,0xFF,0xAD,0xB4,0x20,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x08,0x21,0x10,0x61,0x10,0x20,0x08,0xE2,0x28,0xA9,0x92,0xC7,0x69,0xA2,0x28,0xC7,0x69,0x29,0x7B,0xE3,0x30,0x60,0x10,0x61,0x18,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x10,0x65,0x59,0xA9,0x92,0xA9,0x92,0x24,0x41,
-	0x20,0x10,0x20,0x08,0x61,0x10,0x60,0x18,0x61,0x20,0xE3,0x30,0xE3,0x30,0xE2,0x28,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x60,0x08,0x61,0x10,0xA2,0x20,0xE3,0x28,0xE3,0x28,0xA2,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x62,0x18,0xA1,0x18,0x61,0x18,0x61,0x10,
-	0x61,0x10,0x61,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0x62,0x18,0xA2,0x18,0x62,0x18,0xA3,0x18,0xA2,0x18,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x21,0x08,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x28,0xE4,0x28,0xA2,0x18,0x21,0x10,0x20,0x08,0x21,0x00,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x18,0x61,0x10,0x21,0x08,0x61,0x10,0x21,0x08,0x61,0x10,0xA2,0x18,
-	0x20,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x60,0x08,0x20,0x10,0xA2,0x28,0x62,0x30,0xA9,0x92,0x85,0x71,0xEE,0xBB,0x94,0xC5,0xA5,0x51,0x16,0xCE,0x65,0x69,0xD8,0xF6,0x94,0xC5,0xA0,0x28,0xA5,0x51,0xAD,0xB4,0xA7,0x59,0x60,0x10,0x20,0x00,0x21,0x08,0x61,0x08,0x20,0x08,0x60,0x10,0x21,0x08,0x20,0x08,0x65,0x49,
-	0x94,0xC5,0x12,0xAD,0xE3,0x38,0x61,0x18,0xA2,0x20,0x20,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0x20,0x08,0x20,0x00,0x20,0x08,0x64,0x41,0xA9,0x92,0xA9,0x92,0xC5,0x49,0x20,0x10,0x20,0x08,0x61,0x20,0xA2,0x30,0x23,0x41,0xA5,0x51,0x65,0x49,0x25,0x41,0xA2,0x28,0x21,0x10,0x60,0x10,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,
-	0x61,0x18,0x21,0x10,0xA2,0x20,0x24,0x39,0x24,0x39,0x24,0x39,0x24,0x29,0xE2,0x20,0x62,0x18,0xA1,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x62,0x20,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0xA2,0x20,0x62,0x20,0xA2,0x18,0x62,0x18,0xA2,0x18,0xA2,0x18,0x62,0x18,0xA3,0x18,0xA2,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,
-	0x61,0x10,0x61,0x10,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE4,0x28,0x24,0x29,0xA3,0x20,0x61,0x08,0x20,0x08,0x20,0x00,0xA3,0x18,0x21,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x21,0x08,0x21,0x10,0x61,0x10,0x21,0x08,0xE3,0x20,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x08,0x21,0x18,0x12,0xAD,0x21,0x28,0x07,0x8A,0x16,0xCE,0x51,0xE5,0x23,0x59,0xA3,0x38,0x69,0x72,
-	0x65,0x69,0x56,0xF6,0x4B,0xB3,0x60,0x18,0x60,0x10,0x60,0x10,0x60,0x10,0x20,0x10,0x20,0x00,0x21,0x08,0x60,0x10,0x60,0x10,0xA5,0x51,0xA7,0x59,0x20,0x08,0xA1,0x20,0x4B,0xB3,0xA9,0x92,0xE2,0x20,0x60,0x08,0x60,0x10,0x20,0x08,0x60,0x08,0xA1,0x18,0xA1,0x20,0x60,0x10,0x20,0x08,0x20,0x00,0xA2,0x20,0x25,0x39,0xA5,0x51,0xA1,0x20,
-	0x20,0x08,0x60,0x18,0x24,0x49,0x07,0x8A,0xA9,0x92,0x47,0x92,0xC7,0x69,0x65,0x41,0xA2,0x20,0x20,0x10,0x21,0x10,0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x18,0xA3,0x28,0x65,0x41,0x25,0x41,0x24,0x41,0x24,0x31,0xE3,0x28,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA1,0x20,0xA1,0x18,0x62,0x20,0x61,0x18,
-	0x61,0x10,0x61,0x18,0xA1,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x18,0x62,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x10,0x62,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x28,0xE3,0x28,0xE2,0x20,0x61,0x10,0x20,0x08,0x20,0x00,0xA3,0x10,0x21,0x00,0x20,0x00,0x20,0x08,0x61,0x10,0x61,0x08,0x21,0x08,0x62,0x10,0xA2,0x10,0x24,0x21,
-	0xA2,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0xE4,0x28,0xA2,0x20,0xA7,0x59,0x61,0x20,0x21,0x18,0xA9,0x92,0x5A,0xF7,0xEC,0x8A,0x61,0x10,0x60,0x08,0xA1,0x20,0xA9,0x92,0x23,0x39,0x60,0x10,0x20,0x08,0x20,0x00,0x60,0x10,0x20,0x08,0x00,0x00,0x60,0x00,0x20,0x08,0xC1,0x30,0x94,0xC5,0x56,0xF6,0x45,0x6A,0xA0,0x18,
-	0xA1,0x18,0xA2,0x10,0x20,0x10,0x21,0x10,0x61,0x10,0x20,0x00,0x20,0x08,0x60,0x10,0x61,0x18,0x60,0x18,0x60,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x10,0x60,0x08,0x20,0x08,0xA2,0x28,0xC7,0x69,0x4B,0xB3,0xC8,0xC2,0xC9,0xAA,0xC7,0x69,0x24,0x39,0x61,0x18,0x20,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x10,
-	0xA1,0x18,0xA1,0x18,0xA2,0x20,0x24,0x39,0x24,0x41,0x25,0x41,0x24,0x39,0xE3,0x28,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0x62,0x20,0x61,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x20,0x62,0x20,0xA2,0x20,0x62,0x20,0xA2,0x18,0x61,0x18,0x62,0x18,0x62,0x10,0xA2,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x62,0x10,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE4,0x28,0xA3,0x20,0xA2,0x18,0x61,0x10,0x20,0x08,0x20,0x00,0xE4,0x18,0x61,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x61,0x10,0x61,0x08,0xA3,0x18,0x61,0x08,0x62,0x10,0x62,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x61,0x00,0x62,0x08,0x24,0x29,0xA3,0x28,0x20,0x18,0x61,0x18,0xA2,0x18,0xEE,0xBB,0xBD,0xF7,0xE2,0x30,0x61,0x08,0x61,0x18,
-	0x85,0x71,0xE4,0x48,0x60,0x18,0x20,0x08,0x61,0x08,0x60,0x08,0x60,0x08,0x20,0x08,0x20,0x10,0xA1,0x18,0x20,0x08,0xA1,0x18,0x4B,0xB3,0x56,0xF6,0x16,0xCE,0x69,0x72,0x60,0x18,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x60,0x18,0x60,0x10,0x60,0x10,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,
-	0x20,0x08,0xA1,0x18,0xC7,0x69,0xC9,0xAA,0x4B,0xB3,0x07,0x8A,0xE3,0x38,0x61,0x18,0x20,0x08,0x60,0x08,0x61,0x10,0x61,0x18,0x61,0x20,0x61,0x18,0x61,0x18,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xE3,0x30,0x25,0x39,0x65,0x39,0x24,0x31,0xE3,0x20,0xA2,0x18,0xA1,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xE3,0x28,0xA3,0x28,
-	0xE3,0x28,0xE3,0x28,0xE3,0x28,0xE3,0x28,0xA2,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0x62,0x10,0xA2,0x18,0x62,0x18,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x20,0xA2,0x18,0x62,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x62,0x08,0x21,0x00,0x61,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x22,0x08,0x62,0x10,0x21,0x08,0x62,0x10,
-	0xE3,0x20,0x20,0x08,0x20,0x00,0x20,0x00,0x25,0x29,0xAE,0x93,0xA3,0x18,0xE3,0x30,0x69,0x72,0x21,0x10,0xA2,0x28,0x69,0x72,0x5A,0xF7,0x69,0x72,0x20,0x18,0x65,0x59,0x56,0xF6,0xE7,0x79,0x20,0x10,0x20,0x08,0x60,0x10,0x61,0x10,0x21,0x08,0x60,0x10,0xAE,0x93,0x94,0xC5,0x62,0x49,0x60,0x10,0xE2,0x20,0xC9,0xAA,0x51,0xE5,0x89,0x93,
-	0x61,0x20,0x21,0x08,0x21,0x10,0x60,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x60,0x08,0x20,0x10,0x20,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0xE3,0x38,0xE7,0x79,0xA9,0x92,0x66,0x69,0xE2,0x30,0x20,0x10,0x21,0x08,0x60,0x10,0x21,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x62,0x18,0x62,0x18,
-	0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xE3,0x28,0xE3,0x28,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x28,0xE3,0x28,0xE3,0x30,0xE2,0x28,0xA3,0x28,0xE3,0x30,0xE3,0x28,0xE3,0x28,0xA3,0x28,0xA2,0x18,0xA2,0x20,0x62,0x18,0x61,0x18,0x62,0x10,0x62,0x18,0x61,0x10,0x62,0x18,0x62,0x10,0x61,0x10,0x61,0x10,
-	0x61,0x08,0x61,0x10,0x61,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x18,0xA2,0x18,0x61,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x62,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x21,0x08,0x61,0x10,0x62,0x10,0x60,0x08,0x61,0x10,0xA2,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0xA3,0x28,0x62,0x20,0x61,0x18,0xA3,0x28,0x4B,0xB3,0x12,0xAD,0x24,0x41,0x20,0x20,0xC9,0xAA,
-	0x56,0xF6,0x23,0x59,0x20,0x10,0x20,0x08,0x61,0x10,0x62,0x18,0x20,0x08,0x61,0x18,0x52,0xDE,0x58,0xFF,0xAD,0xB4,0xEE,0xBB,0xA5,0x51,0xA1,0x20,0x24,0x49,0xE3,0x30,0x61,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x60,0x10,0x60,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x08,0x21,0x10,0x61,0x18,0xA2,0x30,0x65,0x59,0x65,0x59,0x24,0x41,0xA1,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x21,0x10,0x61,0x18,0x61,0x20,0x61,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x20,0xE3,0x20,0xE3,0x28,0xE3,0x28,0xA3,0x28,
-	0xE3,0x28,0xE3,0x28,0xE3,0x30,0xE3,0x30,0xE3,0x28,0xA2,0x20,0xA2,0x20,0xA2,0x18,0x62,0x10,0x62,0x18,0x61,0x18,0x62,0x18,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x60,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x18,0xA3,0x10,0x62,0x10,0x20,0x08,0x20,0x08,0x21,0x00,0xA2,0x08,0x21,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x21,0x08,0x61,0x08,
-	0x61,0x08,0x21,0x08,0x61,0x08,0x20,0x00,0x21,0x00,0xA2,0x10,0xE8,0x49,0x24,0x39,0xA2,0x28,0x25,0x41,0x21,0x20,0xAE,0x93,0x69,0x72,0xA2,0x38,0xA5,0x69,0xD8,0xF6,0xD3,0xF5,0xE3,0x38,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x18,0x20,0x08,0x00,0x00,0x65,0x41,0x06,0x8B,0x06,0x8B,0x56,0xF6,0x89,0x93,0x20,0x08,0x20,0x08,0x60,0x10,
-	0x61,0x10,0x20,0x08,0x21,0x10,0x60,0x10,0x60,0x10,0x21,0x08,0x21,0x08,0x61,0x08,0x60,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x10,0x61,0x10,0x60,0x10,0x60,0x10,0xE3,0x30,0xE3,0x38,0x23,0x41,0x24,0x49,0x64,0x41,0x64,0x41,0xA3,0x28,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x60,0x10,0x61,0x18,0x61,0x18,0x62,0x20,
-	0xA2,0x20,0xA2,0x20,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xE2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x20,0xE2,0x20,0xA3,0x28,0xE3,0x28,0xE3,0x28,0xA3,0x28,0xE3,0x28,0xE3,0x30,0xE3,0x30,0xE3,0x28,0xA3,0x28,0xA2,0x20,0x62,0x20,0xA2,0x20,0x62,0x18,0x62,0x18,0xA2,0x18,0x62,0x10,0xA2,0x18,0x61,0x10,0x62,0x10,0x61,0x10,
-	0x61,0x08,0x62,0x10,0x21,0x08,0x60,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x18,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x00,0x21,0x00,0xA3,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x62,0x10,0xA2,0x08,0x62,0x08,0x21,0x00,0x21,0x00,0x65,0x31,0x69,0x72,0x62,0x30,0x69,0x72,0x69,0x72,0x61,0x28,0x23,0x41,0x24,0x49,0x61,0x30,0x65,0x59,0x51,0xE5,
-	0xEE,0xBB,0x61,0x20,0x20,0x08,0x20,0x08,0x60,0x08,0xE2,0x20,0x60,0x10,0x20,0x00,0x00,0x00,0x20,0x10,0x21,0x18,0xC7,0x69,0x23,0x41,0x20,0x08,0x21,0x08,0x61,0x10,0x61,0x10,0x61,0x08,0x60,0x08,0x60,0x10,0x21,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x21,0x10,0x60,0x18,
-	0xA2,0x28,0x65,0x59,0x65,0x59,0x65,0x59,0x64,0x41,0x24,0x41,0x24,0x41,0xA2,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x10,0x61,0x10,0x61,0x18,0x62,0x18,0xA1,0x18,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA3,0x20,0xA2,0x20,0xA3,0x20,0xA2,0x20,0xA3,0x20,0xA2,0x28,
-	0xE3,0x28,0xE3,0x30,0xE3,0x30,0xE4,0x30,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x18,0x62,0x18,0x62,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0xA2,0x10,0xA3,0x10,0x62,0x08,0x20,0x00,0x21,0x00,0xA3,0x10,0x21,0x00,0x20,0x00,0x60,0x08,0x61,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x21,0x08,
-	0x21,0x08,0x61,0x08,0x61,0x08,0xA2,0x08,0x61,0x08,0x20,0x08,0xA3,0x20,0x20,0x10,0x66,0x51,0x24,0x49,0xEC,0x8A,0x24,0x49,0xE7,0x79,0x24,0x41,0x62,0x30,0xC3,0x58,0xA2,0x38,0x60,0x18,0x20,0x08,0x20,0x00,0x20,0x08,0xA1,0x20,0xA1,0x20,0xA1,0x10,0x60,0x10,0x61,0x10,0x60,0x10,0x60,0x20,0xA1,0x18,0x21,0x08,0x21,0x08,0x61,0x10,
-	0x20,0x08,0x20,0x08,0x61,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x21,0x08,0x60,0x10,0x60,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x10,0x60,0x18,0xA2,0x28,0x65,0x59,0x65,0x59,0x66,0x51,0xE3,0x30,0xA2,0x28,0xA3,0x20,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0xA2,0x20,0x62,0x20,0x61,0x20,
-	0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xE2,0x18,0xA3,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xE3,0x28,0xE4,0x28,0x24,0x31,0xE3,0x30,0xA2,0x20,0x62,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x18,0x61,0x18,0x62,0x18,0x62,0x18,0xA1,0x10,0x62,0x10,0x62,0x10,0xA1,0x10,
-	0x61,0x08,0x61,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x62,0x10,0xA2,0x08,0x25,0x19,0x62,0x00,0x21,0x00,0xA2,0x08,0x62,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x60,0x08,0x20,0x00,0x61,0x10,0x61,0x10,0x21,0x08,0x21,0x08,0x61,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0xA3,0x18,0xE8,0x49,0x49,0x5A,0x66,0x51,0xEC,0x8A,0xEC,0x8A,0x16,0xCE,0x4B,0xB3,0x07,0x8A,0x65,0x69,
-	0xC1,0x30,0x61,0x18,0x20,0x08,0x20,0x00,0x20,0x00,0x60,0x10,0x60,0x18,0x20,0x18,0xA0,0x20,0xE2,0x20,0x60,0x20,0x60,0x28,0xA1,0x20,0xA1,0x18,0xA2,0x38,0x23,0x41,0x61,0x18,0x20,0x08,0x21,0x10,0x61,0x08,0x61,0x08,0x21,0x08,0x60,0x08,0x21,0x10,0x60,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x10,
-	0x61,0x20,0xE3,0x38,0x24,0x41,0x24,0x39,0x62,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0xA2,0x20,0xE3,0x30,0xE3,0x38,0xE3,0x28,0x61,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x20,0xA2,0x20,0xE3,0x20,0xA2,0x18,0x62,0x18,0x61,0x10,0x61,0x18,
-	0xA2,0x18,0xA2,0x28,0xE2,0x20,0xA2,0x20,0x61,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x18,0x62,0x18,0xA1,0x10,0x62,0x10,0x62,0x18,0x62,0x10,0xA1,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x60,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x18,0x62,0x08,0x26,0x19,0x62,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x62,0x08,0xA3,0x10,0x21,0x08,0x62,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x10,0x61,0x08,
-	0x21,0x10,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x08,0x62,0x18,0xA3,0x20,0xE4,0x28,0xE4,0x28,0x25,0x49,0x66,0x51,0x62,0x30,0x16,0xCE,0x94,0xC5,0x94,0xC5,0xE7,0x79,0x23,0x59,0x62,0x20,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x08,0x61,0x08,0x20,0x00,0x60,0x10,0xA1,0x18,0xA0,0x20,0x69,0x72,0x4B,0xB3,0xE1,0x28,0xE7,0x79,0x6E,0xD4,
-	0x65,0x59,0x20,0x10,0x60,0x10,0x61,0x10,0x20,0x10,0x20,0x08,0x60,0x10,0x60,0x08,0x60,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x10,0x60,0x10,0x61,0x20,0x61,0x18,0x60,0x10,0x60,0x10,0x20,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0xE2,0x20,0xE4,0x30,0x24,0x39,0x24,0x39,
-	0xA2,0x20,0x61,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xE2,0x20,0xA2,0x20,0xA2,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0xA2,0x20,0x62,0x18,0xA2,0x20,0x62,0x20,0xA2,0x20,0xA2,0x20,0x62,0x20,0xA2,0x18,0x61,0x18,0x62,0x18,0x62,0x18,0x62,0x10,0xA1,0x10,0x62,0x10,0x61,0x08,
-	0x61,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x18,0xA4,0x10,0xA4,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0xA3,0x08,0xE4,0x08,0x62,0x08,0x20,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x20,0x08,0x62,0x18,0xA2,0x20,0xA3,0x18,0xA3,0x20,0x25,0x41,0x66,0x51,0xA3,0x28,0x25,0x49,0xEE,0xBB,0xE7,0x79,0xE3,0x40,
-	0x65,0x69,0xE3,0x40,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x60,0x08,0xA1,0x18,0xEE,0xBB,0x94,0xC5,0xE2,0x38,0xA7,0x59,0x4B,0xB3,0x65,0x59,0xA1,0x18,0x61,0x18,0x61,0x18,0x62,0x20,0x65,0x49,0x24,0x31,0xA1,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,
-	0x20,0x08,0x20,0x10,0x60,0x10,0x60,0x10,0x60,0x10,0x21,0x10,0x60,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0xA3,0x28,0xE3,0x30,0x24,0x39,0x24,0x39,0xA3,0x28,0x61,0x18,0xA1,0x10,0x62,0x18,0xA1,0x18,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA3,0x20,0xE3,0x28,0xA2,0x20,0xA2,0x18,0x62,0x10,0xA1,0x10,
-	0xA2,0x20,0xA2,0x20,0xA3,0x20,0xA2,0x20,0xA2,0x20,0xA1,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0x62,0x18,0x62,0x18,0xA2,0x18,0x61,0x18,0x62,0x10,0x62,0x10,0xA1,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0xE4,0x10,0xA4,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x66,0x29,0x61,0x00,0xA4,0x08,0xE4,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x08,
-	0x21,0x08,0x61,0x08,0x62,0x10,0x60,0x00,0x60,0x08,0x62,0x20,0x62,0x18,0xE3,0x18,0xE4,0x20,0xE3,0x28,0xE4,0x30,0xA7,0x59,0x4B,0xB3,0x6E,0xD4,0x66,0x69,0xA2,0x30,0xEE,0xBB,0xE7,0x79,0x61,0x20,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x60,0x10,0x24,0x41,0x23,0x59,0x61,0x18,0x21,0x00,0x61,0x10,
-	0x60,0x18,0x61,0x10,0x61,0x18,0x61,0x20,0x24,0x49,0xA9,0x92,0xC7,0x69,0xE4,0x30,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x18,0xE2,0x28,0xA2,0x20,0x60,0x10,0x60,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0xA2,0x18,0xE3,0x30,0x24,0x39,0xA3,0x30,
-	0x61,0x20,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0xA1,0x18,0x62,0x10,0x62,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x28,0xE4,0x28,0xE3,0x30,0xE3,0x28,0x24,0x29,0xA2,0x20,0xE3,0x20,0xA3,0x28,0xE3,0x28,0xA3,0x28,0xA2,0x20,0x62,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x28,0xA3,0x28,0xA3,0x20,0xA2,0x20,0xA2,0x18,0x62,0x10,0x62,0x10,
-	0x61,0x10,0x61,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA4,0x10,0x62,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x62,0x00,0xA3,0x08,0xA4,0x10,0xA4,0x10,0x26,0x19,0xE4,0x18,0x62,0x08,0x21,0x08,0x62,0x10,0x61,0x08,0x21,0x08,0xE3,0x30,0xA3,0x20,0xA2,0x18,0xE4,0x20,0x25,0x31,0xE3,0x28,0xE4,0x28,0x25,0x41,0x94,0xC5,0x66,0x51,0xE4,0x48,
-	0x4B,0xB3,0xC7,0x69,0xA1,0x20,0x61,0x18,0x20,0x10,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x08,0x60,0x08,0x61,0x00,0x60,0x08,0x60,0x00,0x61,0x10,0x61,0x18,0xE4,0x48,0xE7,0x79,0xE7,0x79,0xA3,0x30,0x60,0x10,0x61,0x18,0xE3,0x30,0xE3,0x28,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,
-	0xE3,0x30,0x24,0x39,0xE3,0x30,0xA2,0x20,0x20,0x10,0x60,0x18,0x61,0x10,0x20,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x61,0x18,0xA2,0x20,0x62,0x20,0xA2,0x28,0x24,0x31,0xE3,0x28,0xA2,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x61,0x10,0xA2,0x18,0xE3,0x20,0xE3,0x30,0xE4,0x30,0x24,0x39,0x24,0x39,0xE3,0x30,
-	0xE2,0x20,0xE2,0x20,0xE3,0x28,0xE3,0x28,0xE3,0x28,0x62,0x20,0xA2,0x20,0xA2,0x28,0xE4,0x28,0xE3,0x28,0xE3,0x28,0xE3,0x28,0xE3,0x20,0xA2,0x18,0xA2,0x18,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x61,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x63,0x08,0x62,0x08,0x62,0x00,0xA3,0x08,0xA3,0x08,
-	0xA2,0x10,0x62,0x08,0xA2,0x08,0x62,0x10,0x20,0x08,0xA3,0x28,0x25,0x41,0xA2,0x20,0xA2,0x18,0xE4,0x20,0xE3,0x28,0xE4,0x28,0x62,0x20,0xEE,0xBB,0x66,0x51,0xA3,0x28,0xE3,0x38,0xA3,0x38,0x61,0x20,0x61,0x10,0x61,0x10,0x60,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x60,0x00,0x20,0x08,0x60,0x08,0x20,0x08,
-	0x60,0x18,0xA2,0x20,0x21,0x10,0x60,0x10,0x61,0x20,0xA2,0x30,0xE3,0x38,0xA1,0x20,0x61,0x18,0x24,0x39,0xA7,0x59,0x65,0x49,0xA3,0x20,0x00,0x00,0x20,0x08,0x20,0x08,0xE3,0x28,0xE3,0x30,0x24,0x31,0xA2,0x20,0x20,0x10,0x61,0x10,0x21,0x18,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x10,0x62,0x20,
-	0x24,0x39,0x24,0x41,0x24,0x39,0xE3,0x20,0x61,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0xE2,0x20,0xE4,0x28,0xE3,0x30,0x24,0x41,0x65,0x49,0x24,0x39,0xE3,0x28,0xA3,0x28,0xE3,0x28,0xE4,0x28,0xA3,0x28,0xA2,0x20,0xA2,0x20,0xA3,0x28,0xE4,0x30,0xE3,0x30,0xE3,0x28,0xA3,0x28,0xE3,0x28,0xE3,0x20,0xA2,0x18,0x61,0x10,
-	0x62,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x62,0x08,0x61,0x08,0x62,0x08,0x21,0x08,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x20,0x00,0x21,0x18,0x65,0x49,0xE4,0x30,0xA3,0x20,0xE3,0x20,0xE3,0x28,0xE3,0x28,0x24,0x41,0xEE,0xBB,0x25,0x39,0xA7,0x59,
-	0xE3,0x30,0xE3,0x38,0xA2,0x20,0x20,0x10,0x20,0x10,0x21,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x23,0x39,0x25,0x49,0x20,0x18,0x65,0x49,0xA9,0x92,0x65,0x49,0x20,0x10,0x61,0x10,0x60,0x10,0xA1,0x20,0x62,0x20,0xA2,0x28,0x24,0x41,0xC7,0x69,0xC7,0x69,0xE3,0x30,0x60,0x08,0x20,0x08,0x20,0x10,
-	0x61,0x18,0xE3,0x28,0xE3,0x28,0x61,0x18,0x20,0x08,0x20,0x10,0x61,0x18,0x60,0x10,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0xE3,0x30,0x66,0x51,0x66,0x51,0x24,0x41,0xE4,0x30,0xA2,0x18,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x61,0x08,0xA3,0x18,0xE3,0x30,0xE4,0x30,0x24,0x39,0x65,0x49,0x24,0x39,
-	0xE3,0x28,0xE3,0x28,0xE3,0x28,0xE4,0x30,0xE3,0x30,0xA2,0x28,0xA2,0x20,0xE3,0x28,0xE3,0x30,0xE4,0x30,0xE3,0x28,0xE3,0x28,0xE3,0x28,0xA3,0x20,0xA2,0x18,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x61,0x10,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x62,0x10,0xE4,0x18,0x61,0x08,0x21,0x00,0xA2,0x28,0x25,0x41,0x66,0x41,0xE3,0x20,0x24,0x31,0xA2,0x20,0xE4,0x30,0x69,0x72,0xA3,0x28,0x24,0x31,0x50,0x9C,0xA3,0x38,0xA2,0x20,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x20,0x21,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x20,0x6E,0xD4,0x12,0xAD,0xA3,0x28,
-	0xA5,0x51,0x50,0x9C,0xA7,0x59,0x61,0x18,0x61,0x08,0x61,0x08,0x61,0x18,0xA2,0x20,0xA3,0x28,0xE2,0x30,0x24,0x39,0x24,0x39,0xA2,0x10,0x21,0x10,0x61,0x10,0x60,0x08,0x20,0x10,0x61,0x18,0x60,0x10,0x20,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0xA1,0x18,0x24,0x39,
-	0x65,0x69,0xC7,0x69,0x66,0x51,0xE3,0x30,0xA2,0x18,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x60,0x08,0x61,0x10,0xA2,0x20,0xE3,0x30,0x24,0x39,0x65,0x39,0xE4,0x30,0xE3,0x28,0xE3,0x28,0xE3,0x30,0x24,0x39,0xE4,0x30,0xA3,0x28,0xA2,0x28,0xE3,0x28,0xE4,0x30,0xE4,0x30,0xE3,0x30,0xA3,0x28,0xE3,0x28,0xE3,0x28,0xA3,0x18,0x62,0x10,
-	0x61,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x63,0x00,0x28,0x09,0x62,0x00,0x21,0x00,0x60,0x10,0x21,0x10,0x60,0x10,0xA3,0x20,0x62,0x10,0x62,0x08,0x61,0x00,0xA3,0x18,0xE4,0x30,0x25,0x39,0xE3,0x20,0x24,0x31,0xA2,0x28,0xE4,0x30,0xEE,0xBB,0x66,0x51,0x62,0x10,
-	0xA3,0x28,0xAE,0x93,0x66,0x51,0x20,0x10,0x60,0x08,0x20,0x08,0xE2,0x28,0x51,0xE5,0x69,0x72,0x20,0x08,0x20,0x00,0x00,0x00,0x22,0x08,0xA9,0x92,0xA9,0x92,0xA1,0x10,0xA2,0x20,0x24,0x41,0xA2,0x20,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x20,0xE2,0x20,0xA3,0x28,0xA2,0x20,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0xA1,0x10,
-	0x61,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x10,0x61,0x10,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0xA2,0x18,0xE3,0x28,0x24,0x41,0x66,0x51,0x66,0x51,0xE3,0x28,0x61,0x18,0x61,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x61,0x10,0x62,0x18,0xA3,0x20,0xE3,0x20,0xA3,0x20,0xE3,0x28,
-	0xA3,0x28,0x24,0x39,0x65,0x49,0x65,0x41,0x24,0x39,0xA3,0x28,0xA2,0x28,0xE3,0x28,0xE4,0x30,0x24,0x41,0x24,0x39,0xE4,0x30,0xE3,0x28,0xA3,0x20,0xA2,0x18,0x62,0x10,0x62,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x62,0x08,0x21,0x00,0x21,0x00,0x63,0x08,0x62,0x00,0xA4,0x08,0xE4,0x10,0xE5,0x10,0xE5,0x08,0x28,0x09,0xA9,0x29,0xA4,0x08,0x62,0x08,0x62,0x08,
-	0x61,0x10,0x60,0x10,0x20,0x10,0x21,0x08,0x61,0x10,0xA2,0x08,0xE4,0x18,0xA3,0x18,0x25,0x31,0x67,0x31,0x25,0x39,0x24,0x21,0xA3,0x28,0xEC,0x8A,0x66,0x51,0xE3,0x18,0x62,0x18,0x66,0x51,0x51,0xE5,0x24,0x49,0x20,0x08,0x20,0x08,0xE1,0x20,0xAE,0x93,0x25,0x49,0x60,0x10,0x20,0x08,0x60,0x18,0xA0,0x10,0x20,0x10,0x61,0x18,0x21,0x08,
-	0x20,0x08,0x60,0x10,0x61,0x10,0x60,0x10,0x61,0x10,0x62,0x10,0x62,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x28,0xA2,0x20,0xA1,0x18,0x61,0x10,0x61,0x10,0xA1,0x10,0x61,0x10,0xA1,0x10,0x61,0x10,0x60,0x08,0x21,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x08,0x62,0x18,0xE3,0x28,
-	0xE3,0x30,0x24,0x39,0xE3,0x30,0x62,0x20,0x61,0x10,0x61,0x10,0x20,0x08,0x60,0x00,0x21,0x08,0x61,0x08,0x61,0x10,0x62,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xE3,0x28,0x24,0x39,0x65,0x41,0x24,0x41,0xE4,0x30,0xE3,0x30,0xA3,0x28,0xA2,0x28,0xA3,0x30,0xE4,0x30,0x24,0x41,0xE4,0x30,0xE3,0x30,0xA3,0x20,0x62,0x18,0x61,0x10,
-	0x62,0x10,0x62,0x10,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x61,0x00,0x22,0x00,0xE4,0x10,0xE5,0x10,0xA4,0x08,0xE5,0x10,0xA4,0x08,0xA3,0x08,0x63,0x00,0xE5,0x10,0xE5,0x08,0x62,0x00,0x61,0x08,0x62,0x10,0x61,0x08,0x21,0x10,0x61,0x10,0x21,0x10,0x20,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0xE4,0x20,0xE5,0x28,0xE4,0x30,0xE4,0x28,0x61,0x10,0x69,0x72,0xEC,0x8A,0x62,0x20,
-	0xA2,0x10,0xC7,0x69,0x51,0xE5,0xA9,0x92,0x25,0x39,0xA3,0x10,0x00,0x00,0x60,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0xEE,0xBB,0xA9,0x92,0x61,0x20,0x61,0x18,0x61,0x08,0x20,0x08,0x21,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0x62,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x18,0xA1,0x18,0x61,0x10,0x62,0x10,0x61,0x18,
-	0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0xA1,0x18,0xA2,0x20,0xE2,0x28,0xA2,0x20,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x21,0x08,0x60,0x08,0x61,0x10,0x61,0x10,0x62,0x18,0x62,0x10,0xA2,0x18,0x62,0x10,0x62,0x10,
-	0xA3,0x20,0xE4,0x28,0x24,0x39,0x24,0x31,0xE3,0x30,0xE3,0x30,0xE3,0x30,0xA2,0x28,0xA3,0x28,0xE3,0x30,0xE3,0x30,0xE3,0x30,0xA3,0x28,0xA2,0x20,0x62,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x21,0x00,0x20,0x00,0x62,0x00,0xA5,0x10,0xA4,0x08,0xA4,0x10,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,
-	0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x10,0x20,0x08,0x61,0x00,0x61,0x08,0xA3,0x18,0x24,0x21,0xA3,0x20,0xE4,0x28,0x62,0x10,0x62,0x10,0xEC,0x8A,0xC7,0x69,0x61,0x08,0xE4,0x28,0x6E,0xD4,0xEE,0xBB,0x69,0x72,0xE4,0x18,0x62,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x60,0x08,0xAE,0x93,0xEC,0x8A,0x61,0x20,0xA2,0x18,0xA1,0x10,
-	0x21,0x08,0x60,0x08,0x61,0x10,0x61,0x10,0x62,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xE2,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0xA2,0x18,0x62,0x10,0xA1,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x08,0x20,0x10,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,
-	0x20,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0x62,0x18,0x61,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0xA1,0x18,0x62,0x18,0xA2,0x18,0xA2,0x18,0x62,0x18,0xA3,0x18,0xE4,0x28,0xE3,0x28,0xE3,0x30,0xE4,0x28,0xE3,0x30,0xE3,0x30,0xA2,0x28,0xA2,0x28,0xA3,0x28,0xA3,0x28,0xA3,0x28,0xA3,0x28,0xA2,0x28,0xA2,0x18,0x61,0x10,
-	0x61,0x10,0x62,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0xA4,0x10,0x63,0x00,0x63,0x08,0x62,0x00,0x21,0x00,0x62,0x00,0xA3,0x10,0xA2,0x08,0x61,0x10,0x62,0x10,0xA2,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x60,0x10,0x21,0x10,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0xA2,0x18,0xA3,0x20,0xE4,0x28,0x62,0x18,0xA7,0x39,0x50,0x9C,0xC7,0x69,
-	0xA3,0x20,0xA4,0x20,0xE8,0x49,0x25,0x41,0xA3,0x38,0xE4,0x28,0x67,0x31,0x21,0x00,0x21,0x00,0x62,0x08,0x21,0x08,0x20,0x10,0x61,0x10,0x60,0x08,0xA2,0x18,0xA1,0x18,0x20,0x08,0x62,0x08,0x21,0x08,0xA2,0x10,0xA2,0x18,0xA3,0x20,0xA2,0x18,0xA2,0x10,0xE3,0x10,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA1,0x18,0xA3,0x18,0xA3,0x18,0x61,0x10,
-	0x62,0x10,0xA1,0x10,0x62,0x10,0x62,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x62,0x08,0x62,0x10,0x61,0x08,0x61,0x00,0x21,0x08,0x20,0x08,0x61,0x10,0x62,0x10,0x62,0x10,0xA2,0x18,0x62,0x10,0x21,0x10,0x61,0x08,0x61,0x10,0x61,0x10,0x62,0x10,0xA2,0x18,0x62,0x18,0x62,0x18,0x62,0x10,
-	0xA3,0x18,0xE3,0x20,0xE4,0x28,0xE4,0x28,0xE3,0x28,0xE3,0x28,0xA3,0x28,0xA2,0x20,0xA2,0x28,0xA2,0x28,0xA3,0x28,0xA3,0x28,0xE2,0x28,0xA3,0x28,0xA2,0x20,0x62,0x18,0x61,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0x63,0x08,0x62,0x00,0x00,0x00,0x62,0x08,0xA3,0x08,0xA3,0x08,0x62,0x08,0xE4,0x10,0x62,0x08,0x20,0x00,0x20,0x00,0x21,0x08,0x61,0x10,0x61,0x10,0x61,0x10,
-	0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x10,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x61,0x10,0x62,0x18,0xE4,0x20,0xA2,0x20,0x24,0x21,0xA4,0x18,0xE4,0x30,0xA3,0x20,0xA3,0x20,0x21,0x10,0x62,0x18,0xC7,0x69,0xA3,0x38,0x25,0x41,0xA3,0x18,0xA4,0x08,0x67,0x29,0x61,0x00,0x61,0x08,0x21,0x10,0x20,0x10,0x62,0x20,0xA2,0x20,
-	0x62,0x10,0x62,0x08,0x62,0x10,0xA3,0x10,0xE3,0x18,0xA3,0x20,0xA3,0x18,0xA3,0x18,0xE4,0x20,0xE4,0x18,0x24,0x29,0xE3,0x20,0xA2,0x20,0xE3,0x20,0xE4,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0x61,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x61,0x08,0x62,0x10,0xA3,0x08,0xE3,0x08,0xE4,0x08,0xE5,0x10,0xE4,0x08,0xA4,0x08,
-	0x63,0x08,0x62,0x00,0xA3,0x08,0xA3,0x18,0xA4,0x20,0xE4,0x20,0xA3,0x18,0x61,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x18,0x62,0x10,0xA3,0x18,0xE3,0x20,0xE3,0x28,0xE3,0x28,0xA3,0x20,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x28,0xA2,0x28,0xE3,0x28,0xA3,0x28,0xA3,0x28,0xA2,0x28,0xA2,0x18,
-	0x61,0x10,0x62,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x60,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE5,0x10,0xA4,0x08,0x25,0x19,0xA3,0x08,0xA3,0x08,0x21,0x00,0x61,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x21,0x10,0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x21,0x08,0x61,0x10,0xA2,0x18,0x62,0x18,0x62,0x18,0x61,0x10,0xA2,0x20,
-	0xE3,0x28,0xA2,0x20,0x61,0x18,0xA3,0x28,0xA2,0x30,0xE3,0x40,0xE3,0x38,0x62,0x20,0x62,0x10,0x62,0x08,0x62,0x00,0x69,0x72,0xEC,0x8A,0xC7,0x69,0xEC,0x8A,0x24,0x49,0x62,0x18,0x63,0x08,0x62,0x08,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xE4,0x18,0xE3,0x18,0xA3,0x10,0x25,0x31,0xE8,0x49,0x66,0x41,0x24,0x29,0xA3,0x18,0x25,0x29,0xE5,0x20,
-	0xE4,0x18,0xE4,0x18,0xE4,0x10,0xE4,0x10,0xA3,0x08,0x62,0x00,0x62,0x00,0x62,0x08,0xA2,0x08,0xA4,0x08,0xE4,0x08,0xE5,0x08,0xE5,0x10,0xA4,0x08,0xE5,0x08,0x26,0x09,0x26,0x09,0xE5,0x10,0x26,0x21,0x25,0x21,0x25,0x21,0xE4,0x18,0xA3,0x18,0x62,0x10,0x62,0x10,0xA1,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0x62,0x18,
-	0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0xA2,0x18,0x62,0x18,0x61,0x10,0x61,0x18,0x62,0x18,0xA2,0x20,0xA2,0x28,0xA3,0x28,0xA3,0x28,0xE2,0x20,0xA3,0x28,0xA3,0x20,0x62,0x18,0x61,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x08,0xA4,0x08,0x63,0x08,0x21,0x00,0x20,0x00,0x61,0x00,0x62,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x61,0x10,0x60,0x10,0x61,0x10,
-	0x61,0x18,0x62,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x62,0x18,0xA2,0x20,0xA2,0x18,0x62,0x18,0x61,0x18,0x24,0x39,0xA7,0x49,0x62,0x20,0xA2,0x20,0xE3,0x38,0x23,0x41,0xA9,0x92,0xA3,0x38,0xA2,0x18,0xA3,0x18,0x61,0x08,0x69,0x72,0xEE,0xBB,0x6E,0xD4,0x56,0xF6,0x6E,0xD4,
-	0xE3,0x30,0x21,0x08,0x61,0x00,0x62,0x10,0xA3,0x10,0xA3,0x28,0xA3,0x20,0xA3,0x10,0xA3,0x10,0x25,0x31,0x49,0x5A,0xA7,0x59,0x24,0x39,0xA3,0x18,0x25,0x21,0x25,0x21,0xE4,0x20,0xE4,0x10,0xA4,0x08,0xE5,0x08,0xE5,0x08,0xA5,0x08,0xE4,0x08,0xA3,0x08,0xA3,0x08,0xA4,0x08,0x64,0x00,0xA3,0x00,0xE5,0x18,0xE4,0x18,0xA4,0x08,0xE4,0x08,
-	0xE4,0x08,0x26,0x19,0x25,0x21,0x67,0x29,0x26,0x29,0x26,0x21,0xE4,0x20,0xA3,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xA2,0x18,0xA2,0x18,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0x62,0x18,0xA1,0x10,0x61,0x10,0x62,0x18,0xA2,0x20,0xA2,0x20,0xA3,0x28,0xA3,0x28,0xE4,0x28,0xE3,0x30,
-	0xE3,0x28,0xA2,0x18,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x21,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x18,0xA2,0x20,0x20,0x10,
-	0x65,0x41,0xA2,0x20,0x66,0x51,0xA3,0x28,0x62,0x20,0xA3,0x28,0x25,0x49,0xC3,0x58,0xA2,0x30,0xA3,0x28,0x62,0x18,0x62,0x20,0xA9,0x92,0x6E,0xD4,0x4B,0xB3,0xEE,0xBB,0xE4,0x30,0x61,0x18,0x61,0x08,0x61,0x08,0xA2,0x18,0xA3,0x28,0xA7,0x59,0x65,0x39,0xA2,0x10,0xE4,0x20,0xA7,0x49,0xA7,0x59,0xE3,0x18,0xA2,0x10,0x25,0x21,0x26,0x29,
-	0x25,0x29,0x25,0x21,0xE5,0x18,0xE4,0x08,0xA5,0x08,0xE5,0x00,0xA5,0x00,0xE5,0x08,0xA4,0x08,0x63,0x00,0x62,0x00,0xA3,0x08,0xA3,0x10,0xA3,0x18,0xA3,0x08,0xA4,0x08,0xE3,0x08,0x25,0x19,0x66,0x29,0xA8,0x39,0xA8,0x39,0x67,0x29,0x25,0x21,0xE4,0x28,0xA2,0x18,0x62,0x18,0xA2,0x10,0xA3,0x18,0xA2,0x18,0xA3,0x20,0xA3,0x20,0xA3,0x18,
-	0xA2,0x18,0x62,0x18,0x61,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x18,0x62,0x10,0xA1,0x10,0x61,0x18,0xA2,0x20,0xA3,0x20,0xA3,0x28,0xE4,0x30,0x25,0x39,0x25,0x41,0x24,0x31,0xE4,0x28,0xA2,0x18,0x62,0x10,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x60,0x08,0x60,0x10,0x61,0x10,0x61,0x10,
-	0x61,0x18,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x10,0x60,0x08,0x61,0x10,0x21,0x08,0x60,0x08,0x21,0x10,0x20,0x08,0x61,0x10,0x61,0x18,0x61,0x18,0xCB,0x62,0x21,0x18,0xA3,0x30,0x12,0xAD,0xA2,0x28,0x61,0x18,0x61,0x18,0x66,0x51,0xE4,0x48,0xE3,0x40,0x24,0x41,0xA2,0x30,0xA3,0x38,0xEE,0xBB,0xEC,0x8A,0x25,0x31,0x25,0x31,
-	0xA3,0x18,0xA2,0x18,0x21,0x10,0x61,0x08,0x61,0x10,0xE3,0x30,0x69,0x72,0x69,0x72,0xE4,0x20,0xA2,0x10,0xE3,0x18,0x24,0x21,0xA3,0x18,0xA3,0x10,0xE4,0x18,0x25,0x21,0xE4,0x20,0x24,0x21,0x26,0x21,0x25,0x19,0xE5,0x08,0x26,0x09,0xA4,0x00,0xE5,0x08,0x63,0x00,0xA3,0x08,0xA2,0x08,0x62,0x00,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,
-	0xA3,0x00,0xE4,0x18,0xE4,0x28,0x24,0x29,0x67,0x29,0xEA,0x39,0xE4,0x18,0xE4,0x20,0xA3,0x20,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xA2,0x20,0x62,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x62,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0xA3,0x28,0xE4,0x30,0x25,0x41,0xA7,0x59,0x66,0x51,
-	0x25,0x41,0x24,0x31,0xA3,0x20,0xA2,0x18,0x62,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0xA1,0x10,0xA1,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0xE3,0x28,0x50,0x9C,
-	0x62,0x20,0x49,0x5A,0xA3,0x30,0xA3,0x28,0xA2,0x28,0xA7,0x49,0x20,0x18,0xA2,0x30,0xA2,0x28,0xE3,0x30,0xA3,0x38,0x6E,0xD4,0x12,0xAD,0xC3,0x58,0xA3,0x38,0xCB,0x62,0xEA,0x39,0xE8,0x49,0xA3,0x28,0x62,0x20,0x62,0x10,0xE2,0x20,0xC7,0x69,0x49,0x5A,0xA3,0x18,0xA2,0x10,0xA3,0x18,0xA3,0x10,0xE3,0x10,0xA3,0x10,0xA3,0x18,0xE4,0x20,
-	0xE4,0x28,0xE5,0x20,0x26,0x21,0xE5,0x18,0xE4,0x08,0xA4,0x08,0xE5,0x08,0xE5,0x08,0xE4,0x08,0xA3,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x63,0x10,0xA3,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x08,0xE4,0x20,0x25,0x29,0x26,0x29,0x66,0x21,0xE4,0x18,0xE5,0x20,0x26,0x21,0x25,0x21,0xA4,0x18,0xE4,0x20,0xE5,0x18,0xE4,0x18,0xE4,0x20,0xE4,0x18,
-	0xA3,0x18,0xA2,0x18,0xA2,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0xA2,0x18,0xE3,0x28,0x24,0x39,0x65,0x49,0xC7,0x69,0xC7,0x69,0x66,0x51,0x25,0x39,0xE3,0x28,0xA3,0x18,0x62,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x21,0x08,0x60,0x10,0x21,0x10,0x61,0x10,
-	0x61,0x10,0x61,0x18,0x61,0x10,0x62,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x10,0x61,0x10,0x61,0x10,0xA2,0x18,0x25,0x39,0x20,0x20,0x24,0x39,0xA2,0x20,0xA3,0x28,0xA2,0x28,0xEC,0x8A,0xA2,0x20,0x24,0x41,0xA1,0x20,0x61,0x18,0xA2,0x20,0x69,0x72,0xA3,0x38,0x21,0x20,0x85,0x71,0x69,0x72,
-	0xCB,0x62,0xE5,0x20,0xAE,0x93,0xA9,0x92,0xA4,0x20,0x62,0x18,0xE4,0x30,0xE4,0x30,0xA2,0x20,0xA2,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x18,0xA2,0x08,0xA3,0x10,0xE3,0x20,0xA3,0x20,0x24,0x31,0x65,0x31,0x24,0x29,0xA3,0x18,0xA3,0x08,0x61,0x00,0x62,0x00,0xA4,0x08,0xE4,0x10,0x62,0x00,0x61,0x00,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x62,0x08,
-	0x61,0x08,0xA3,0x10,0x62,0x10,0xA3,0x18,0xA4,0x10,0x26,0x21,0x26,0x19,0x26,0x21,0x67,0x29,0x26,0x21,0xE4,0x18,0xE4,0x10,0xE5,0x18,0x25,0x21,0x27,0x21,0xE5,0x20,0xE4,0x18,0xA3,0x18,0x62,0x10,0xA3,0x18,0x62,0x08,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0xA2,0x20,0xA3,0x28,0x24,0x39,0x66,0x41,0xC7,0x69,0x69,0x72,
-	0xA7,0x59,0x25,0x49,0xE4,0x28,0xA3,0x20,0x62,0x10,0x61,0x08,0x62,0x08,0x21,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0xA1,0x18,0xA2,0x20,0xA2,0x18,0x62,0x18,0xA1,0x10,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x18,0x61,0x10,0xA1,0x18,0x60,0x10,0x21,0x10,
-	0x49,0x5A,0x20,0x08,0x61,0x18,0xA2,0x20,0x65,0x41,0x65,0x41,0x65,0x49,0xEC,0x8A,0xE3,0x38,0xA1,0x18,0x21,0x10,0x62,0x18,0x25,0x39,0x60,0x18,0x25,0x41,0xA7,0x59,0xA3,0x18,0xA2,0x18,0x69,0x72,0xEC,0x8A,0x24,0x31,0xA2,0x20,0xA3,0x30,0x24,0x39,0xA3,0x28,0xA2,0x18,0xA2,0x10,0xA2,0x18,0xA3,0x18,0x62,0x10,0xE2,0x10,0xA2,0x18,
-	0xA3,0x20,0x65,0x39,0x65,0x41,0x65,0x39,0xE3,0x18,0x21,0x08,0x00,0x00,0x21,0x00,0x62,0x00,0xE4,0x10,0xA4,0x08,0xA3,0x08,0x62,0x08,0x61,0x08,0x62,0x10,0x62,0x08,0x21,0x08,0x62,0x08,0x62,0x08,0xE5,0x18,0xA4,0x10,0x25,0x19,0x26,0x21,0x26,0x19,0x26,0x21,0x26,0x21,0xE5,0x20,0x25,0x19,0xA4,0x18,0xE4,0x18,0xE5,0x18,0xE5,0x20,
-	0xE4,0x20,0x25,0x21,0xE4,0x18,0x25,0x19,0x62,0x08,0x62,0x08,0x21,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0xA2,0x20,0xE3,0x20,0xE4,0x28,0x65,0x49,0xA7,0x59,0xC7,0x69,0xC7,0x69,0x66,0x51,0x25,0x39,0xE4,0x28,0xA3,0x18,0x21,0x10,0x61,0x08,0x62,0x08,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x60,0x10,0x61,0x10,0x61,0x10,
-	0x61,0x10,0x61,0x10,0xA1,0x18,0xA2,0x20,0xA3,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x10,0xA2,0x18,0xA2,0x18,0x61,0x10,0xA2,0x18,0xA2,0x18,0x24,0x31,0x61,0x10,0x20,0x10,0x61,0x18,0xA7,0x59,0x12,0xAD,0x62,0x20,0x24,0x39,0x62,0x20,0xA3,0x28,0x62,0x20,0x20,0x10,0xE8,0x49,0x66,0x41,0xA3,0x20,0x62,0x20,
-	0x21,0x10,0x21,0x08,0xA2,0x20,0xE4,0x30,0x61,0x18,0x62,0x18,0xA3,0x28,0x24,0x39,0xE3,0x30,0xA2,0x20,0x62,0x18,0xA2,0x10,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x18,0xA3,0x20,0x65,0x39,0x65,0x41,0x65,0x39,0xA3,0x18,0x61,0x08,0x61,0x10,0x20,0x08,0x21,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x08,0xA2,0x10,0xA3,0x10,
-	0xA2,0x10,0xA3,0x10,0xE4,0x10,0x26,0x21,0x26,0x21,0xE5,0x18,0xE4,0x18,0xE4,0x18,0x25,0x29,0xE5,0x18,0x25,0x21,0x25,0x21,0xA4,0x10,0xA4,0x10,0x25,0x21,0xE5,0x20,0xE4,0x20,0xE4,0x18,0xA4,0x18,0xA3,0x10,0x61,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0xA2,0x18,0xA3,0x20,0xE3,0x28,0xE4,0x30,0xA7,0x59,0xC7,0x69,
-	0x69,0x72,0xC7,0x69,0x65,0x49,0x65,0x39,0xE4,0x28,0xA3,0x18,0x62,0x10,0x61,0x10,0x61,0x08,0x62,0x08,0x62,0x10,0x61,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0xA2,0x20,0xE2,0x20,0xA2,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA1,0x10,0x61,0x10,0x62,0x18,
-	0x20,0x08,0xA1,0x18,0x20,0x08,0x20,0x10,0x61,0x18,0x49,0x5A,0xA3,0x30,0x61,0x18,0x21,0x08,0xA1,0x20,0xE2,0x28,0xA2,0x28,0x24,0x41,0xA3,0x28,0x21,0x18,0x62,0x08,0x61,0x08,0x62,0x08,0x20,0x00,0x61,0x08,0xE4,0x18,0x62,0x10,0xA3,0x20,0xA3,0x28,0xA2,0x20,0xA2,0x18,0x62,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,
-	0xA2,0x18,0xE3,0x28,0x24,0x31,0xE3,0x28,0x62,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x61,0x08,0x62,0x08,0x62,0x00,0x62,0x08,0x61,0x00,0x62,0x08,0x62,0x10,0x62,0x10,0x62,0x08,0x62,0x08,0xA3,0x10,0xA4,0x10,0xA4,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xE5,0x20,0xE4,0x20,0xA4,0x18,0xE5,0x20,0xE5,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x18,
-	0xE4,0x18,0xA4,0x18,0xE4,0x18,0xA3,0x10,0x20,0x08,0x21,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0xA3,0x20,0xE2,0x20,0xE4,0x28,0x25,0x41,0xA7,0x59,0x66,0x69,0xA7,0x59,0x66,0x51,0x25,0x41,0x24,0x31,0xE4,0x28,0xE3,0x18,0x62,0x10,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x21,0x10,0x60,0x10,0x61,0x10,
-	0x21,0x10,0x61,0x10,0xA2,0x18,0xA2,0x20,0xA3,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x10,0xA1,0x18,0xA2,0x18,0x62,0x18,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0xA1,0x10,0x20,0x08,0x21,0x10,0xA2,0x28,0xA3,0x28,0xA3,0x20,0x61,0x18,0x62,0x18,0xA2,0x30,0x65,0x59,0xE4,0x48,0x62,0x20,0x21,0x08,0x61,0x08,
-	0x61,0x08,0x62,0x08,0xA7,0x39,0xA3,0x10,0x20,0x00,0x61,0x00,0x61,0x08,0x62,0x18,0x61,0x10,0xA2,0x18,0xA2,0x10,0xA3,0x18,0xA2,0x18,0xA2,0x18,0x62,0x08,0xA2,0x10,0xA2,0x18,0x61,0x10,0x61,0x10,0x20,0x10,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x60,0x08,0xA2,0x10,0x21,0x00,0x20,0x00,0x21,0x00,0x62,0x10,0x61,0x10,
-	0x61,0x10,0x61,0x08,0x62,0x08,0xE4,0x18,0xA2,0x10,0xA3,0x20,0xA2,0x18,0xA2,0x18,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xE5,0x20,0x27,0x21,0xA4,0x10,0xE5,0x18,0xE4,0x18,0x25,0x29,0xE5,0x20,0xA4,0x08,0xA3,0x10,0x21,0x08,0x60,0x08,0x21,0x10,0x60,0x08,0x61,0x10,0x61,0x10,0x62,0x18,0xA2,0x18,0xE3,0x20,0xE3,0x28,0xE4,0x30,0x25,0x41,
-	0x66,0x41,0x25,0x49,0x25,0x49,0x24,0x39,0x24,0x39,0xE4,0x28,0xE3,0x20,0xA2,0x18,0x61,0x10,0x61,0x08,0x62,0x10,0x21,0x10,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x60,0x08,0x21,0x10,0x61,0x10,0x60,0x10,0x61,0x10,0x62,0x18,0xE2,0x18,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x10,0x21,0x10,
-	0x61,0x10,0x20,0x08,0x61,0x10,0x61,0x08,0x20,0x08,0x61,0x18,0xA2,0x28,0xA2,0x28,0xA3,0x28,0xA7,0x59,0xA3,0x30,0xE7,0x79,0x25,0x49,0x61,0x20,0x61,0x10,0x60,0x10,0x24,0x29,0xCB,0x62,0xA3,0x18,0xCB,0x62,0x61,0x00,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0xA2,0x10,0x62,0x10,0x61,0x08,0x61,0x10,0x62,0x10,0x61,0x08,0x21,0x08,
-	0x62,0x10,0x61,0x10,0x21,0x08,0x21,0x00,0x61,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x20,0x08,0x61,0x10,0xE3,0x20,0xA3,0x18,0x61,0x08,0x20,0x00,0x61,0x08,0x21,0x08,0x20,0x10,0x61,0x10,0x62,0x10,0xE4,0x18,0xA2,0x10,0xA2,0x18,0xE3,0x28,0x25,0x29,0x25,0x29,0xA3,0x20,0xE4,0x20,0xA4,0x18,0x26,0x21,0xE4,0x18,0xE4,0x18,0xE5,0x18,
-	0xE4,0x20,0xE5,0x10,0x26,0x21,0xA4,0x10,0x61,0x00,0x61,0x08,0x21,0x08,0x21,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x18,0xA3,0x20,0xA3,0x28,0xE3,0x28,0xE4,0x30,0x25,0x41,0x25,0x41,0x65,0x41,0x65,0x41,0x24,0x39,0x24,0x31,0xE4,0x28,0xE3,0x20,0xA2,0x10,0x61,0x08,0x61,0x08,0x62,0x08,0x62,0x08,0x61,0x08,0x21,0x08,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x10,0x61,0x10,0x60,0x10,
-	0x21,0x10,0x61,0x10,0x61,0x10,0xA2,0x18,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x10,0xA1,0x10,0x60,0x08,0x61,0x10,0x60,0x08,0x20,0x08,0xA1,0x10,0x60,0x08,0x60,0x08,0x62,0x20,0xA3,0x28,0x12,0xAD,0xA7,0x59,0xE3,0x38,0xA7,0x59,0x69,0x72,0x24,0x39,0x61,0x20,0xE3,0x28,
-	0x65,0x41,0x65,0x41,0xA2,0x18,0x62,0x10,0x62,0x10,0xA3,0x18,0xA3,0x20,0x25,0x39,0xE4,0x20,0x62,0x10,0x61,0x08,0x61,0x08,0xA3,0x18,0x61,0x10,0x21,0x08,0x20,0x08,0x62,0x08,0x21,0x08,0x61,0x10,0x62,0x10,0xA2,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x61,0x10,0x24,0x31,0x24,0x31,0xE4,0x28,0xA2,0x18,0x61,0x08,0x62,0x10,0x61,0x10,
-	0x21,0x10,0x61,0x08,0x62,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x18,0x25,0x29,0x25,0x29,0x65,0x39,0x25,0x31,0xA3,0x20,0xA3,0x18,0xE5,0x18,0x25,0x21,0xA3,0x10,0xA2,0x18,0xA3,0x18,0xE4,0x18,0xE5,0x18,0xE4,0x10,0xA3,0x10,0x62,0x00,0xA3,0x10,0x20,0x10,0x61,0x10,0x61,0x10,0xA2,0x18,0xA2,0x18,0xE4,0x28,0x24,0x29,0xE4,0x28,0xE3,0x28,
-	0xE3,0x30,0x65,0x41,0x66,0x51,0x65,0x41,0x66,0x41,0x25,0x39,0x24,0x31,0xE3,0x20,0x62,0x18,0x62,0x08,0x62,0x08,0x62,0x10,0x21,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x60,0x08,0x21,0x10,0x61,0x10,0x60,0x08,0x61,0x10,0xA1,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA1,0x10,0x62,0x10,0x61,0x10,0x20,0x08,
-	0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x61,0x10,0xA3,0x28,0x69,0x72,0xA7,0x59,0xA3,0x28,0x24,0x41,0xEC,0x8A,0x66,0x51,0x62,0x20,0xA2,0x28,0x65,0x39,0x24,0x31,0x62,0x10,0x62,0x10,0xA3,0x10,0xA2,0x18,0xC7,0x69,0x69,0x72,0x65,0x31,0x62,0x10,0xA2,0x18,0x61,0x08,0xE4,0x20,0xA3,0x18,0xA2,0x18,0x62,0x10,
-	0xA2,0x10,0xE5,0x20,0xE4,0x20,0xA3,0x10,0x21,0x00,0x61,0x08,0xA2,0x10,0x62,0x08,0x61,0x10,0xE4,0x28,0x24,0x39,0x24,0x39,0xE3,0x20,0x61,0x08,0x20,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0xA3,0x10,0x62,0x08,0xA2,0x18,0xA3,0x20,0x25,0x31,0x25,0x39,0x25,0x39,0x65,0x39,0xE3,0x20,0xA3,0x18,0xE5,0x18,0xE4,0x18,0xA2,0x10,0xA2,0x18,
-	0xA3,0x20,0xA3,0x18,0xE3,0x10,0x62,0x10,0x61,0x08,0x21,0x00,0xA4,0x08,0x61,0x08,0x61,0x10,0x61,0x10,0xA2,0x18,0xE3,0x28,0xE4,0x28,0xE4,0x28,0x24,0x31,0x24,0x31,0xE4,0x28,0x25,0x41,0xA7,0x59,0xA7,0x59,0x66,0x41,0x66,0x41,0x65,0x39,0x24,0x29,0xA2,0x18,0x61,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x61,0x10,
-	0x21,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA1,0x10,0x60,0x08,0x20,0x08,0x20,0x00,0x61,0x08,0x61,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x10,0xA3,0x20,0x25,0x41,0xA3,0x28,0xA2,0x20,0x62,0x20,0x69,0x72,0x66,0x51,0xE3,0x30,0xE4,0x28,
-	0x62,0x20,0x61,0x18,0x20,0x08,0x61,0x00,0x20,0x08,0x20,0x10,0xE4,0x30,0xC7,0x69,0xA3,0x20,0x20,0x08,0x61,0x08,0x61,0x10,0x62,0x08,0x61,0x10,0xA3,0x18,0xE3,0x28,0xE3,0x20,0xA3,0x18,0x62,0x10,0xE4,0x20,0x62,0x10,0x61,0x00,0xE4,0x20,0x62,0x08,0x61,0x08,0xA2,0x18,0x24,0x29,0x24,0x29,0xA2,0x18,0x20,0x08,0x21,0x00,0x60,0x08,
-	0x21,0x08,0x61,0x08,0xA3,0x10,0xA3,0x18,0x24,0x29,0x25,0x31,0x67,0x31,0x25,0x31,0x25,0x31,0x25,0x39,0xE4,0x20,0xE4,0x18,0xE4,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0x61,0x10,0x61,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x21,0x10,0x60,0x10,0xA2,0x20,0xE4,0x28,0xE3,0x20,0xE4,0x28,0x24,0x31,0x24,0x31,
-	0x65,0x39,0x25,0x39,0x66,0x41,0xA7,0x49,0x66,0x41,0x66,0x41,0x65,0x39,0xE5,0x28,0xA3,0x18,0x62,0x10,0x61,0x08,0x21,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x08,0x21,0x10,0x61,0x10,0x60,0x10,0x21,0x10,0x61,0x10,0x61,0x10,0x21,0x10,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x08,0x61,0x10,0x62,0x18,0xA2,0x18,0x61,0x08,0x62,0x18,0x62,0x18,0x20,0x10,0x61,0x08,0xA2,0x20,0x62,0x20,0x62,0x20,0xA7,0x49,0x24,0x39,0xE3,0x30,0x62,0x20,0x61,0x10,0x20,0x10,0x61,0x10,0x61,0x18,0xA2,0x30,0xA2,0x30,0x21,0x18,0x61,0x08,0x20,0x00,0x21,0x10,0x61,0x08,0x61,0x10,0x24,0x39,0x65,0x41,
-	0x65,0x39,0xA3,0x20,0xA3,0x18,0xA3,0x18,0x62,0x10,0x62,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x20,0x08,0x61,0x10,0xA2,0x18,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0xA4,0x10,0x62,0x10,0xE3,0x18,0xE4,0x20,0x24,0x29,0x25,0x31,0x24,0x31,0x25,0x29,0x24,0x29,0xE3,0x18,0xA3,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,
-	0xA2,0x10,0xA3,0x18,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x21,0x08,0x61,0x10,0x61,0x10,0xA2,0x18,0xE3,0x20,0xE3,0x28,0xE4,0x28,0x25,0x31,0x65,0x39,0x66,0x41,0x25,0x39,0x25,0x41,0x66,0x41,0x65,0x39,0x67,0x31,0x25,0x31,0xE4,0x28,0xA2,0x18,0xA2,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x62,0x10,0x61,0x08,0x61,0x08,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x08,0x60,0x08,0x61,0x10,0x60,0x10,0x61,0x10,0x60,0x10,0x61,0x10,0x60,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x62,0x10,
-	0x61,0x10,0x61,0x10,0x60,0x08,0x21,0x10,0x60,0x08,0x21,0x10,0xA1,0x10,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0xA2,0x18,0xA1,0x18,0x62,0x18,0xA2,0x20,0xA3,0x20,0x61,0x10,0xA2,0x18,0xA2,0x20,0xE3,0x30,0x49,0x5A,0xA7,0x49,
-	0x25,0x41,0xE3,0x30,0xE2,0x20,0x62,0x18,0xA2,0x18,0xA2,0x18,0xE2,0x20,0xA2,0x28,0xA2,0x20,0xA3,0x18,0x62,0x08,0x62,0x08,0x61,0x10,0x21,0x10,0x24,0x31,0x65,0x41,0x25,0x41,0xA1,0x10,0x62,0x10,0x62,0x18,0x62,0x10,0x62,0x10,0x66,0x29,0x21,0x00,0x61,0x08,0x21,0x00,0x62,0x10,0xA2,0x10,0x62,0x18,0xA2,0x18,0x62,0x10,0xA3,0x10,
-	0xA3,0x10,0x62,0x10,0x61,0x08,0xA3,0x18,0xE4,0x20,0x25,0x31,0x25,0x29,0x24,0x29,0xE3,0x18,0xA2,0x10,0xA3,0x18,0xE4,0x18,0xA3,0x10,0xE3,0x18,0xA2,0x10,0x62,0x10,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x21,0x08,0x21,0x08,0x61,0x10,0x61,0x10,0xA2,0x18,0xE3,0x28,0xE3,0x28,0xE4,0x28,0x65,0x39,0x66,0x41,
-	0xA7,0x49,0x66,0x41,0x66,0x41,0x66,0x41,0x25,0x39,0x25,0x29,0x25,0x29,0xE4,0x20,0xE4,0x20,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x08,0x61,0x10,0x62,0x10,0xA1,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x10,0x62,0x10,0x61,0x10,0xA2,0x18,0xA1,0x10,0x62,0x10,0xA1,0x10,0x62,0x10,0x61,0x10,0x21,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0xA2,0x10,0x24,0x31,0x66,0x41,0xA7,0x59,0xA3,0x28,0x62,0x10,0xA2,0x18,0xE4,0x28,0x66,0x51,0xC7,0x69,0x25,0x41,0xE3,0x30,0x24,0x39,0xA2,0x20,0x62,0x18,0x61,0x10,0x61,0x10,0x20,0x10,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x61,0x18,0xA3,0x28,
-	0xE3,0x28,0x62,0x18,0xA2,0x10,0x61,0x08,0x61,0x10,0x61,0x08,0xA3,0x18,0x61,0x08,0x62,0x08,0xA2,0x10,0x62,0x08,0x61,0x08,0x61,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0xA3,0x18,0x62,0x10,0x61,0x08,0x62,0x18,0xE4,0x28,0x24,0x29,0x25,0x29,0xE3,0x20,0x62,0x10,0xA2,0x18,0xA3,0x10,0xE4,0x18,0xA3,0x18,0x62,0x10,0xA2,0x18,0x62,0x10,
-	0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0x61,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x60,0x08,0x61,0x18,0xA2,0x20,0xE3,0x20,0x24,0x31,0x65,0x39,0xA7,0x49,0xE8,0x49,0xA7,0x49,0xA7,0x49,0xA7,0x49,0x66,0x41,0x25,0x31,0x25,0x31,0x25,0x29,0xE4,0x20,0xA3,0x18,0x62,0x10,0x61,0x08,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x08,
-	0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x10,0xA1,0x10,0xA2,0x18,0xA2,0x18,0x62,0x18,0xA2,0x18,0xE3,0x20,0xA3,0x20,0xE2,0x20,0xA2,0x18,0xA2,0x18,0x62,0x10,0xA2,0x18,
-	0xA2,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0x61,0x10,0x21,0x08,0x60,0x08,0x21,0x08,0x60,0x08,0x60,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0xA2,0x18,0x49,0x5A,0x69,0x72,0x25,0x41,0xA3,0x20,0xE4,0x28,0xE3,0x20,0x25,0x39,0x25,0x41,
-	0xC7,0x69,0x24,0x39,0x24,0x41,0x24,0x39,0xA2,0x20,0x21,0x10,0xA7,0x39,0x20,0x00,0x20,0x08,0x61,0x08,0x62,0x10,0x20,0x08,0x21,0x08,0x61,0x10,0x62,0x10,0xA2,0x18,0x62,0x18,0x61,0x18,0xA2,0x18,0xA2,0x18,0x62,0x18,0x21,0x08,0x25,0x29,0x62,0x08,0x62,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x10,0x62,0x10,0x61,0x08,0xE3,0x20,
-	0xA2,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0xA3,0x18,0xA3,0x18,0xA2,0x18,0x61,0x10,0x62,0x10,0x62,0x10,0xA3,0x18,0xA3,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xE3,0x20,0x62,0x10,0x61,0x08,0x61,0x08,0x61,0x10,0x61,0x10,0x21,0x08,0x61,0x10,0x20,0x08,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0xA2,0x20,0xE4,0x28,0x25,0x39,0x65,0x39,
-	0x66,0x41,0xA7,0x49,0xE8,0x49,0xA7,0x59,0xE8,0x49,0x66,0x41,0x25,0x31,0x25,0x31,0x25,0x29,0xE4,0x20,0xA3,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x60,0x08,0x62,0x18,0xA2,0x18,0xA1,0x10,0x62,0x18,0xE2,0x18,0xA3,0x18,0xE3,0x20,0xE3,0x20,0xE3,0x20,0xA3,0x18,0xA2,0x18,0xA2,0x10,0x62,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x10,0x61,0x10,0x60,0x10,0x21,0x10,0x60,0x08,0x20,0x08,0x21,0x08,0x60,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0xE5,0x28,0xE8,0x49,0xA7,0x59,0x66,0x41,0x24,0x31,0xE4,0x28,0xE4,0x28,0x66,0x51,0xAE,0x93,0x69,0x72,0x69,0x72,0x65,0x49,0x24,0x39,0x24,0x29,0xA1,0x10,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x60,0x08,0x62,0x10,0xA2,0x18,0x61,0x10,0x21,0x08,
-	0x61,0x08,0x61,0x10,0x62,0x18,0xA2,0x18,0x62,0x18,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x10,0x61,0x08,0x62,0x10,0x62,0x10,0xA3,0x10,0x62,0x18,0xA2,0x18,0x62,0x10,0xA3,0x18,0x62,0x08,0x62,0x10,0x61,0x10,0x61,0x10,0x62,0x08,0x62,0x08,0xE4,0x18,0x62,0x08,0xA2,0x10,0xA3,0x20,0x24,0x29,0x24,0x29,
-	0xE3,0x20,0x62,0x18,0xA2,0x10,0xA3,0x18,0xA2,0x18,0x61,0x10,0x60,0x08,0x21,0x08,0x21,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0xA2,0x18,0xA3,0x20,0xE4,0x28,0x25,0x31,0xA7,0x49,0xA7,0x49,0xE8,0x49,0xE8,0x49,0xE8,0x49,0xA7,0x49,0x67,0x31,0x67,0x31,0x25,0x31,0xE4,0x20,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,
-	0x62,0x10,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x20,0xE3,0x20,0x24,0x29,0x24,0x21,0x24,0x29,0xE3,0x20,0xA3,0x18,0x62,0x18,0xA2,0x18,
-	0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0x62,0x10,0x61,0x10,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x21,0x08,0x61,0x08,0x61,0x10,0x62,0x18,0xA3,0x20,0x25,0x31,0x66,0x41,0x25,0x39,0xE4,0x28,0x66,0x41,0xA7,0x59,
-	0xE4,0x30,0x24,0x39,0x25,0x41,0xE4,0x28,0xA3,0x28,0xE4,0x28,0xA2,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x00,0x00,0x20,0x08,0xE2,0x20,0x65,0x39,0xA3,0x28,0x21,0x10,0x61,0x08,0x61,0x10,0xE3,0x20,0xE4,0x30,0xE4,0x28,0xA3,0x20,0xA2,0x18,0x62,0x08,0x21,0x08,0x21,0x08,0x60,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0xE3,0x18,0x62,0x10,
-	0xA2,0x18,0xA3,0x10,0xA3,0x18,0x62,0x08,0x62,0x08,0x62,0x10,0x62,0x10,0x62,0x08,0xA2,0x10,0xA3,0x10,0xA3,0x10,0x62,0x10,0x62,0x10,0xE3,0x20,0x24,0x31,0xE4,0x28,0xE4,0x28,0xE3,0x28,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xA3,0x20,0x21,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x10,0x61,0x10,0xA2,0x18,0xE3,0x28,0x24,0x29,0x25,0x31,
-	0x67,0x31,0xA7,0x49,0xA7,0x49,0xA7,0x49,0x49,0x5A,0xA7,0x49,0x67,0x31,0x25,0x39,0x25,0x31,0x25,0x21,0xE4,0x20,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x08,0x61,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x20,0xE3,0x20,0xE3,0x20,0x24,0x29,0x24,0x29,0x24,0x29,0x24,0x29,0xE3,0x20,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x20,0xA2,0x18,0xA2,0x18,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x60,0x08,0x61,0x08,0x60,0x08,
-	0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,0xA3,0x18,0xE4,0x28,0x25,0x31,0xA7,0x49,0x24,0x31,0x49,0x5A,0xA7,0x59,0xA7,0x49,0xA3,0x20,0xA3,0x28,0xE3,0x30,0xA2,0x20,0xE3,0x28,0xA3,0x20,0x62,0x10,0x61,0x08,0xE8,0x49,0x21,0x00,0x61,0x08,0xA3,0x20,0xA7,0x59,0x65,0x41,0x61,0x10,
-	0x61,0x10,0x62,0x18,0x24,0x31,0x25,0x39,0xE8,0x49,0xE4,0x28,0xA3,0x20,0xA3,0x10,0x62,0x10,0x62,0x10,0x61,0x00,0x21,0x08,0x61,0x08,0xA3,0x18,0x62,0x08,0x62,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x08,0xA3,0x10,0xA2,0x10,0x62,0x08,0x62,0x10,0x25,0x21,0x25,0x29,0x24,0x29,
-	0xE3,0x28,0x64,0x29,0xE4,0x28,0xE3,0x20,0xE3,0x28,0xE3,0x28,0xA1,0x18,0x61,0x10,0x21,0x10,0x61,0x10,0x61,0x18,0x61,0x10,0x62,0x18,0xE3,0x20,0xE4,0x28,0x25,0x29,0x25,0x39,0xA7,0x39,0xA7,0x49,0xE8,0x49,0xE8,0x49,0xA7,0x49,0x66,0x41,0x25,0x31,0x25,0x31,0xE4,0x28,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x62,0x10,0x61,0x10,0x62,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xE3,0x20,0xE3,0x20,0x24,0x29,0x24,0x29,0x24,0x29,0x24,0x29,0x24,0x29,0xE4,0x20,0xA2,0x18,0xA2,0x18,
-	0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x20,0xA3,0x20,0x25,0x31,0x25,0x41,0x66,0x41,0xA7,0x59,
-	0xCB,0x62,0xA3,0x20,0xA3,0x18,0xE4,0x28,0xE3,0x28,0xA3,0x28,0xE2,0x28,0xA2,0x20,0x61,0x08,0xE3,0x18,0xA7,0x39,0xE4,0x18,0xA2,0x18,0x65,0x39,0xE3,0x20,0x62,0x10,0x62,0x10,0xA2,0x18,0x24,0x31,0x66,0x41,0x65,0x41,0xA3,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x10,0xA3,0x10,0x62,0x10,0x62,0x10,
-	0xA2,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0xA3,0x10,0xA3,0x10,0x62,0x08,0x61,0x10,0x61,0x08,0xA3,0x18,0x25,0x29,0xE4,0x28,0xE3,0x28,0xE3,0x28,0x24,0x21,0xA3,0x20,0xE2,0x20,0xE3,0x28,0x62,0x18,0x61,0x10,0x61,0x10,0x62,0x18,0x62,0x18,0x62,0x18,0xA2,0x18,0xA3,0x18,0x24,0x29,0x25,0x29,
-	0x25,0x31,0x65,0x39,0x65,0x39,0x66,0x41,0xA7,0x49,0xA7,0x49,0x25,0x39,0x25,0x31,0x25,0x29,0x25,0x29,0xE4,0x20,0xE4,0x18,0xA3,0x18,0xA3,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x60,0x08,0x61,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xE3,0x20,0xE4,0x20,0x24,0x29,0x24,0x29,0x24,0x29,0x25,0x29,0x24,0x29,0xE3,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x20,0xA2,0x18,0xA3,0x20,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,
-	0x62,0x10,0x61,0x10,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x28,0x66,0x41,0x49,0x5A,0x25,0x41,0xE4,0x30,0xE4,0x28,0xA3,0x20,0xE3,0x20,0xA3,0x20,0xA3,0x28,0xA3,0x28,0x24,0x39,0x61,0x10,0x62,0x18,0xE3,0x18,0xA3,0x10,0xA3,0x18,0xE3,0x20,0xE3,0x18,0x62,0x10,
-	0x62,0x10,0x62,0x10,0xA3,0x20,0xE4,0x28,0xA3,0x20,0x62,0x20,0xA3,0x20,0xA2,0x18,0x62,0x10,0x62,0x10,0xA2,0x10,0x61,0x08,0x62,0x08,0xA2,0x08,0x62,0x10,0xA3,0x10,0xA3,0x10,0x62,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0x62,0x10,0xA3,0x10,0xA2,0x10,0x62,0x08,0xA3,0x10,0x62,0x08,0x62,0x10,0xA1,0x10,0x62,0x10,0xA3,0x18,0xA3,0x18,
-	0xE2,0x18,0xA2,0x10,0x24,0x29,0xE4,0x20,0xA3,0x20,0xE3,0x20,0x61,0x10,0x21,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0x61,0x18,0x62,0x10,0xE3,0x20,0x25,0x29,0x67,0x31,0x25,0x29,0x25,0x31,0x67,0x31,0x65,0x39,0x66,0x41,0x25,0x31,0xE5,0x28,0x25,0x29,0xE4,0x28,0xE4,0x28,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xA2,0x10,0xA3,0x10,0xA2,0x10,
-	0x62,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0x61,0x08,0x61,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x20,0xE3,0x20,0xE4,0x28,0x24,0x29,0x25,0x29,0x25,0x29,0x25,0x29,0x24,0x29,0xE3,0x20,0xA3,0x20,0xA3,0x18,
-	0xE2,0x18,0xA3,0x18,0xA3,0x18,0xE3,0x20,0xA3,0x18,0xA3,0x20,0xA3,0x20,0xA3,0x18,0x62,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0xA2,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x08,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x20,0xE8,0x49,0xEC,0x8A,0xA7,0x49,
-	0x66,0x41,0x25,0x31,0x24,0x29,0xE3,0x20,0xE4,0x20,0xA3,0x28,0x50,0x9C,0xA7,0x59,0xA3,0x28,0x60,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x21,0x08,0x61,0x10,0x62,0x18,0xA3,0x18,0x25,0x29,0xE4,0x28,0xE4,0x28,0xE4,0x28,0x25,0x31,0x67,0x31,0x25,0x39,0x24,0x29,0xA3,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA3,0x10,
-	0xA3,0x10,0xA4,0x18,0xA3,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0xA2,0x08,0x61,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0xE3,0x18,0x25,0x19,0xA3,0x10,0x21,0x08,0x61,0x08,0x21,0x08,0x62,0x10,0xA2,0x10,0xA3,0x18,0xA2,0x18,0xE4,0x20,0xE5,0x28,0x26,0x29,
-	0x67,0x31,0x25,0x29,0x65,0x29,0x25,0x29,0x24,0x29,0xE4,0x28,0xE4,0x20,0xE4,0x28,0xE4,0x28,0x25,0x21,0x25,0x29,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x10,0x61,0x10,0x61,0x08,0xA2,0x10,0xA2,0x18,0xA3,0x20,0xE3,0x20,0x25,0x29,0x25,0x29,0x25,0x29,0x25,0x29,0x24,0x29,0xE4,0x28,0xE3,0x20,0xA3,0x18,0xE2,0x18,0xA3,0x18,0xA2,0x18,0xE3,0x18,0xA2,0x18,0xA3,0x18,0xE3,0x20,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0x62,0x10,0xA2,0x18,0xA3,0x18,0x62,0x10,0xA2,0x18,0x62,0x10,
-	0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x21,0x10,0x61,0x08,0x62,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x20,0x25,0x31,0x67,0x31,0xE5,0x28,0x25,0x31,0x25,0x39,0x25,0x31,0x25,0x29,0xE4,0x28,0x25,0x39,0xAE,0x93,0x62,0x20,0xA2,0x28,0xE3,0x28,0xA2,0x20,0x62,0x18,0xE3,0x20,0x65,0x39,0xE3,0x20,0x62,0x10,
-	0xA3,0x20,0xE4,0x20,0xA3,0x20,0x25,0x39,0x25,0x31,0x25,0x31,0x67,0x31,0x25,0x31,0x25,0x29,0xA3,0x18,0xA3,0x18,0x62,0x10,0xE8,0x49,0x25,0x19,0x66,0x21,0xE4,0x18,0xA3,0x10,0xA3,0x18,0xE4,0x18,0x25,0x21,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0x62,0x08,0xA3,0x10,0xA3,0x10,0x61,0x08,
-	0x61,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x22,0x00,0x62,0x08,0xA3,0x08,0xA3,0x08,0x62,0x08,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xE4,0x20,0x66,0x29,0x25,0x21,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x28,0xE4,0x28,0x25,0x29,0x25,0x29,0xE4,0x28,0x25,0x21,0xE3,0x20,0xA3,0x10,0xA3,0x10,0xA2,0x10,
-	0xA3,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0x62,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0xA2,0x18,0xA3,0x18,0xE4,0x20,0x24,0x29,0x25,0x29,0x25,0x29,0x25,0x29,0x25,0x29,0xE4,0x20,0xE3,0x18,0xE3,0x18,0xA3,0x18,
-	0xA3,0x18,0xE2,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xE3,0x20,0xA3,0x20,0xA3,0x18,0xA3,0x18,0x62,0x10,0x62,0x18,0xA3,0x10,0xA2,0x18,0x62,0x18,0xA2,0x10,0x62,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x62,0x10,0x61,0x10,0x62,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xE3,0x20,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,
-	0xE4,0x20,0x24,0x31,0xE4,0x28,0xE4,0x28,0xE4,0x28,0x49,0x5A,0x66,0x41,0xA4,0x28,0xA2,0x20,0x62,0x20,0xE4,0x30,0xE3,0x28,0xE4,0x30,0xA7,0x49,0x24,0x31,0x61,0x10,0x62,0x18,0xA2,0x18,0xA3,0x20,0xE4,0x28,0xA7,0x49,0x25,0x31,0x67,0x31,0x6D,0x7B,0x26,0x29,0x25,0x21,0xEA,0x39,0xE5,0x18,0xA4,0x10,0xE6,0x10,0xA4,0x10,0xA4,0x10,
-	0xA4,0x10,0xE4,0x20,0xCB,0x62,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x10,0x62,0x08,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x62,0x10,0xA3,0x10,0xA3,0x10,0x62,0x08,0xA2,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0x62,0x08,0xA3,0x10,0xA3,0x08,0xA3,0x10,0xA4,0x10,0xA2,0x10,0xA3,0x20,0xA3,0x20,0xE4,0x28,
-	0xA3,0x20,0xE4,0x20,0xE4,0x18,0xA3,0x20,0xE3,0x20,0xE3,0x20,0xE4,0x20,0xE4,0x28,0xE4,0x28,0x25,0x29,0x25,0x29,0xE4,0x28,0xA4,0x18,0xA2,0x18,0xA3,0x10,0xA2,0x10,0xA3,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xA2,0x18,0xA3,0x18,0xA3,0x20,0xE4,0x20,0xE4,0x28,0x25,0x29,0xE4,0x28,0xE4,0x20,0xE3,0x20,0xE3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xE2,0x18,0xE3,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x20,0xA3,0x18,0x62,0x18,0xA2,0x10,0x62,0x10,0x62,0x18,0xA3,0x18,0x62,0x10,0x62,0x18,0xA2,0x10,
-	0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x62,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xE4,0x20,0xE4,0x28,0xE4,0x28,0xE4,0x28,0xE8,0x49,0xE4,0x28,0x24,0x31,0xA3,0x28,0xA3,0x28,0x25,0x41,0x25,0x41,0xA7,0x59,0x65,0x49,0xA3,0x20,0xE4,0x28,
-	0x25,0x29,0xE4,0x28,0xE4,0x30,0x66,0x41,0xCB,0x62,0xA7,0x49,0x25,0x31,0xE5,0x28,0x62,0x08,0x62,0x08,0xA3,0x10,0xA3,0x18,0xE4,0x20,0x26,0x21,0x26,0x21,0x26,0x29,0x25,0x21,0x27,0x29,0xA8,0x39,0x66,0x29,0x25,0x29,0xE5,0x18,0xE4,0x18,0xE4,0x10,0xE4,0x18,0xA4,0x10,0x63,0x10,0x62,0x10,0x62,0x08,0xA3,0x10,0xA4,0x08,0xE4,0x10,
-	0x25,0x19,0xA3,0x10,0x20,0x00,0x62,0x08,0x61,0x00,0x62,0x08,0x21,0x00,0x61,0x08,0x21,0x00,0x61,0x08,0xE4,0x18,0xE4,0x18,0xA3,0x18,0xE4,0x18,0xE4,0x20,0xA4,0x20,0xE3,0x28,0xE3,0x20,0xE4,0x20,0xA3,0x18,0xE3,0x20,0xE3,0x28,0xE4,0x20,0xE4,0x20,0xE4,0x28,0xE4,0x28,0xE4,0x28,0xE4,0x20,0xE4,0x20,0xA3,0x18,0x62,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x18,0xA3,0x18,0xA3,0x18,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xA3,0x18,
-	0xA3,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0x62,0x10,0x62,0x10,0xA2,0x18,0x62,0x10,0xA2,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x62,0x10,0x61,0x10,0x62,0x08,0x61,0x10,0x61,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,
-	0xA3,0x18,0xA2,0x18,0xE3,0x20,0xE4,0x20,0xA3,0x20,0xA3,0x28,0xA3,0x20,0xA2,0x18,0x62,0x18,0x50,0x9C,0x24,0x39,0x62,0x20,0xE4,0x30,0xA3,0x28,0x62,0x20,0x62,0x18,0xA3,0x20,0x25,0x31,0xA7,0x49,0xEC,0x8A,0x69,0x72,0xEC,0x8A,0x49,0x5A,0xE4,0x20,0x63,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xE4,0x18,0x63,0x10,0xA3,0x18,
-	0xE4,0x20,0x25,0x31,0xCB,0x62,0x25,0x29,0xA4,0x18,0xA4,0x10,0xA3,0x10,0xE4,0x18,0xE5,0x18,0xA3,0x08,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x08,0xA3,0x18,0x25,0x29,0x25,0x21,0x26,0x21,0xA3,0x08,0x62,0x08,0x21,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x62,0x08,0x21,0x08,0xA3,0x18,0xA3,0x10,0x65,0x29,0xE4,0x20,0xE4,0x20,
-	0xE4,0x20,0xA3,0x20,0x25,0x19,0x26,0x21,0xE4,0x20,0xE3,0x28,0xE3,0x20,0xE4,0x20,0x24,0x21,0xE4,0x28,0xE4,0x20,0xE4,0x28,0xE3,0x20,0xA3,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x10,0x62,0x10,0xA2,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x18,0x62,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xA3,0x18,0xA3,0x20,0xA3,0x18,0xE3,0x20,0xA3,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xE3,0x18,0xA3,0x18,0xE3,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x10,0x62,0x18,0x62,0x10,0x62,0x10,0x62,0x18,0x62,0x10,0x62,0x10,
-	0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x08,0x61,0x10,0x61,0x10,0x62,0x08,0x61,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xE3,0x18,0xE3,0x20,0xA3,0x18,0xA2,0x18,0x61,0x08,0x20,0x08,0xE4,0x20,0x61,0x10,0x20,0x10,0x61,0x18,0xA3,0x28,0x65,0x41,0xA3,0x28,
-	0x62,0x18,0x25,0x39,0xEC,0x8A,0xAE,0x93,0x67,0x31,0xCB,0x62,0xE8,0x49,0x25,0x31,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x18,0xA4,0x20,0x62,0x10,0xA2,0x18,0xA3,0x20,0xE4,0x28,0xA7,0x39,0x25,0x29,0xA3,0x18,0xA7,0x39,0x63,0x08,0xA3,0x10,0xA3,0x08,0xA3,0x10,0xA3,0x10,0xA3,0x18,0xA2,0x10,0xA3,0x10,0xE4,0x20,0xE4,0x28,
-	0xE4,0x28,0x26,0x29,0xE5,0x18,0x61,0x00,0xA2,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,0x62,0x08,0x62,0x10,0x62,0x10,0xA3,0x20,0xA3,0x18,0xA3,0x10,0x25,0x21,0xA4,0x20,0x26,0x29,0x25,0x21,0x27,0x21,0xE5,0x18,0xA3,0x20,0xE3,0x20,0xE4,0x28,0xE4,0x20,0xE4,0x20,0xE5,0x18,0xA3,0x20,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,
-	0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0xA3,0x18,0xA2,0x18,0x62,0x10,0xA2,0x18,0x62,0x10,0x62,0x18,0xA3,0x18,0xA3,0x18,0xE3,0x20,0xE4,0x20,0xA3,0x18,0xA3,0x20,0xA4,0x20,0xA3,0x20,0xA3,0x20,
-	0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x18,0xA2,0x10,0x62,0x10,0x62,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0x61,0x10,0x62,0x08,0x61,0x10,0x61,0x08,0x61,0x10,0x62,0x10,0x62,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xE3,0x18,0xA2,0x10,
-	0xA3,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,0x61,0x10,0x21,0x08,0x60,0x08,0x61,0x10,0xA2,0x10,0x6D,0x7B,0xE8,0x49,0x69,0x72,0x69,0x72,0xE4,0x28,0xE5,0x28,0x66,0x41,0xE5,0x28,0xE5,0x28,0xE8,0x49,0x67,0x31,0x25,0x31,0xE3,0x18,0x62,0x10,0xA3,0x18,0x62,0x10,0xA3,0x10,0x62,0x10,0xA3,0x18,0xA3,0x18,
-	0xE3,0x20,0x25,0x29,0x25,0x29,0xE4,0x28,0xE4,0x20,0x67,0x31,0xA3,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA4,0x10,0x62,0x08,0x61,0x08,0xE3,0x20,0xE3,0x28,0xE4,0x28,0x25,0x29,0x25,0x19,0xE5,0x18,0x62,0x18,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0xA3,0x18,0xA2,0x18,0xA3,0x20,0x62,0x18,0xA4,0x18,
-	0x67,0x29,0x25,0x21,0xE5,0x20,0x26,0x21,0x27,0x21,0x26,0x21,0xE4,0x20,0xE3,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xA2,0x20,0xA4,0x18,0xA4,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x10,0x62,0x10,0xA2,0x08,0x62,0x10,0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA3,0x20,0xA3,0x18,0xA3,0x18,0x62,0x10,0x62,0x18,0x62,0x10,0x62,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xE4,0x20,0xE4,0x20,0xE3,0x20,0xE4,0x20,0xA3,0x18,0xE4,0x20,0xA3,0x20,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x18,0xA2,0x18,0x62,0x10,0xA1,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,
-	0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x62,0x08,0x61,0x10,0x61,0x10,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x60,0x08,0x21,0x08,0x65,0x31,0x62,0x18,0x62,0x18,0xE8,0x49,
-	0xA3,0x28,0xE4,0x28,0xA4,0x20,0xA3,0x20,0xA3,0x20,0xA4,0x28,0xE5,0x28,0xE5,0x28,0xA2,0x18,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x08,0x62,0x10,0x62,0x10,0xA2,0x18,0xE4,0x20,0xE4,0x28,0xA4,0x18,0xA3,0x18,0xA3,0x10,0xA3,0x18,0x61,0x10,0xA2,0x18,0xA3,0x18,0xA4,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0xA2,0x10,0xE2,0x18,
-	0x24,0x29,0x26,0x29,0x26,0x19,0xA4,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x20,0xA2,0x18,0xA3,0x20,0xA3,0x20,0xE4,0x18,0x25,0x29,0xE4,0x20,0xA4,0x18,0xE5,0x18,0xA4,0x18,0x25,0x29,0x26,0x19,0x25,0x21,0xE4,0x20,0xA3,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA3,0x18,0xE6,0x10,0x68,0x21,0x25,0x19,
-	0x63,0x08,0xA2,0x10,0xA2,0x10,0xA3,0x08,0x62,0x08,0x62,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x20,0xE4,0x20,0xA3,0x20,0xA3,0x18,0x62,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xE4,0x20,0xA3,0x18,0xE4,0x20,0xA3,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,
-	0xE4,0x20,0xE4,0x20,0xE3,0x18,0xE2,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA1,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0xA2,0x10,
-	0xA1,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x60,0x08,0x61,0x08,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x21,0x08,0x61,0x10,0xA2,0x18,0x62,0x18,0xA3,0x28,0xE4,0x28,0xA4,0x20,0xA3,0x20,0xA4,0x20,0xA4,0x20,0xA3,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x10,0xA3,0x18,0xA3,0x18,
-	0xE4,0x20,0xE4,0x20,0xA3,0x20,0xE4,0x20,0xA4,0x20,0xA3,0x20,0xA3,0x18,0xE3,0x20,0x25,0x29,0x67,0x31,0x25,0x29,0xA2,0x18,0x21,0x08,0x61,0x08,0x62,0x08,0xE4,0x18,0xE4,0x20,0x62,0x08,0xE4,0x18,0xA3,0x10,0xA3,0x18,0xA3,0x18,0x62,0x10,0x62,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xE4,0x18,0x25,0x29,0x24,0x21,0xA3,0x18,
-	0xA3,0x18,0xE5,0x18,0x26,0x29,0x14,0x7C,0xA2,0x18,0xE4,0x18,0x27,0x21,0xE5,0x18,0xE4,0x18,0xA4,0x10,0xA4,0x18,0xE5,0x18,0x28,0x09,0x68,0x21,0xA5,0x10,0x27,0x21,0x28,0x09,0x62,0x10,0x61,0x18,0xA2,0x10,0x62,0x08,0x61,0x08,0x62,0x08,0x61,0x00,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x29,0xE4,0x28,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA3,0x18,0x62,0x10,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x28,0xE4,0x20,0xE4,0x20,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x61,0x10,0x61,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,
-	0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x61,0x08,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x60,0x08,0x21,0x08,0x62,0x10,
-	0xE4,0x28,0xA3,0x18,0xA3,0x18,0xA3,0x18,0x25,0x31,0x66,0x41,0x25,0x29,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xA2,0x10,0x62,0x10,0xA2,0x18,0xE3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xE4,0x20,0xA3,0x20,0xA3,0x18,0xE3,0x20,0xE3,0x18,0xE3,0x20,0xA7,0x49,0x65,0x31,0x65,0x31,0xA3,0x20,0x62,0x08,0xA3,0x10,0xA3,0x10,0x61,0x08,
-	0x21,0x08,0x62,0x08,0xA2,0x08,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x18,0x62,0x10,0xA2,0x10,0xA4,0x18,0x67,0x31,0x24,0x21,0xE4,0x20,0xA2,0x20,0xA3,0x18,0xA3,0x10,0xA8,0x39,0x63,0x08,0xA3,0x18,0x62,0x10,0x68,0x21,0x27,0x21,0xA5,0x10,0x26,0x19,0x8B,0x11,0x8B,0x11,0xED,0x21,0x8B,0x11,0x68,0x21,0x28,0x09,
-	0x8B,0x11,0xE5,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x29,0x25,0x29,0xE4,0x20,0xE3,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xE4,0x20,0xE4,0x20,0xE4,0x20,0x24,0x29,
-	0x24,0x21,0xE4,0x20,0xE3,0x20,0xA3,0x18,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x62,0x10,0x61,0x10,0xA1,0x10,0x62,0x10,0x61,0x10,0x62,0x08,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0xA3,0x18,0xA2,0x18,0xA3,0x20,0xA3,0x20,0x50,0x9C,0xA7,0x49,0x67,0x31,0xE4,0x28,0x25,0x29,0xE8,0x49,0x67,0x31,0xA2,0x10,0x61,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x10,
-	0xA3,0x18,0xE3,0x20,0xA3,0x20,0xE3,0x20,0xA2,0x20,0xA3,0x18,0xA3,0x18,0xE4,0x28,0x66,0x29,0x65,0x39,0x25,0x29,0xE4,0x18,0xA3,0x10,0x62,0x08,0x62,0x10,0xA2,0x18,0x62,0x08,0xE3,0x10,0x62,0x10,0xA3,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xE5,0x18,0x24,0x21,0xE4,0x18,0xE4,0x20,0xA3,0x20,0xA3,0x20,
-	0xA2,0x18,0xE4,0x18,0x26,0x19,0xE4,0x20,0xE4,0x20,0xA4,0x10,0xA5,0x10,0x67,0x29,0xA8,0x39,0x27,0x21,0x27,0x21,0x68,0x21,0xE5,0x10,0xE4,0x10,0xA3,0x18,0xA4,0x10,0x28,0x09,0xE5,0x10,0xA3,0x10,0xA2,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x29,0x24,0x21,0xE4,0x28,0xE4,0x20,0xA3,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xE4,0x20,0xE4,0x20,0xE4,0x28,0xE4,0x20,0xE4,0x20,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x10,0xA1,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x10,0x61,0x08,0x61,0x10,
-	0x61,0x10,0x61,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x61,0x08,0xA2,0x18,0xA2,0x18,0x62,0x10,0xA2,0x10,0x62,0x08,0x61,0x08,
-	0x62,0x10,0x62,0x18,0x62,0x10,0x25,0x29,0x25,0x39,0x25,0x31,0xE4,0x20,0xA4,0x20,0x67,0x31,0xA7,0x49,0xE8,0x49,0xE4,0x20,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xE2,0x20,0xA3,0x18,0xA2,0x10,0xE4,0x20,0xE4,0x20,0x25,0x29,0x25,0x29,0xE4,0x18,0xA3,0x10,0x62,0x10,0x61,0x10,0xE4,0x28,0x64,0x29,
-	0x25,0x29,0xA3,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xE3,0x18,0xA3,0x10,0x26,0x21,0x26,0x21,0xA3,0x10,0xA2,0x10,0xE4,0x20,0xA3,0x20,0xE3,0x20,0xA3,0x20,0xE3,0x20,0xA4,0x18,0xA3,0x18,0x62,0x10,0xE4,0x20,0xE5,0x18,0x67,0x29,0x67,0x29,0xE3,0x20,0xA3,0x10,0xE5,0x18,0xA4,0x10,0xE3,0x20,0x62,0x10,0xA3,0x10,0xA3,0x10,
-	0xA4,0x10,0xE4,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x08,0xA3,0x08,0xE4,0x10,0xA3,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x29,0x25,0x29,0x25,0x29,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA3,0x18,0x62,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,
-	0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x61,0x10,0x62,0x10,0xA2,0x18,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0xA3,0x18,0x62,0x10,0xA2,0x10,0xA3,0x18,0xA2,0x10,0xA3,0x18,0x62,0x18,0xA3,0x20,0x67,0x31,0x66,0x41,0xE4,0x28,0xE4,0x20,0x24,0x21,0x25,0x21,0x24,0x21,
-	0x25,0x21,0x25,0x29,0x24,0x29,0xE4,0x20,0xA3,0x10,0x6D,0x7B,0xE4,0x18,0x25,0x21,0xA4,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x24,0x29,0x25,0x21,0xEA,0x39,0xE4,0x18,0xA2,0x10,0xE4,0x18,0xE3,0x10,0xE5,0x18,0xE4,0x18,0xA9,0x29,0xA7,0x39,0x25,0x31,0xE4,0x20,0xE3,0x18,0xA2,0x18,0xA3,0x18,0xE3,0x20,0xE4,0x20,
-	0xA3,0x20,0xA3,0x18,0x62,0x10,0xA3,0x10,0xA3,0x18,0xA4,0x18,0x27,0x29,0xA9,0x29,0x67,0x29,0x25,0x21,0xA4,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0xA3,0x18,0xA3,0x10,0xA3,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0xA4,0x08,0xA4,0x08,0xA2,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x29,0x25,0x29,0x25,0x29,0x24,0x29,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x18,0xA3,0x18,0xE4,0x20,0xE4,0x20,0xA3,0x20,0xE4,0x20,0xA3,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x10,0x61,0x10,0x61,0x08,0x20,0x08,0x21,0x08,0x60,0x08,0x21,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x08,0x21,0x00,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x62,0x10,
-	0xA3,0x18,0xE4,0x20,0x62,0x18,0x62,0x10,0x62,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0xA3,0x18,0xE3,0x20,0xE4,0x28,0xE4,0x28,0xE4,0x20,0xA3,0x18,0xE4,0x18,0xE3,0x10,0xE4,0x18,0x25,0x29,0x26,0x29,0x67,0x29,0x67,0x29,0x68,0x21,0x26,0x21,0x26,0x29,0x26,0x21,0x25,0x21,0xE5,0x18,0xA4,0x10,0xA4,0x10,0x26,0x21,0xA9,0x29,
-	0xEA,0x39,0x27,0x21,0xE5,0x10,0x62,0x08,0x63,0x08,0xE4,0x18,0x26,0x21,0x65,0x29,0x25,0x39,0x24,0x31,0x66,0x41,0xA3,0x18,0xA2,0x18,0xA2,0x18,0xE4,0x20,0xE4,0x20,0xA3,0x20,0xA3,0x20,0xE4,0x18,0xA4,0x18,0x25,0x29,0xA8,0x39,0x26,0x29,0x27,0x29,0x2C,0x3A,0xA9,0x29,0x26,0x19,0xA4,0x10,0xA3,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x10,
-	0xA3,0x10,0xA4,0x10,0xA3,0x08,0x62,0x10,0xA3,0x08,0xA3,0x10,0x63,0x08,0xA4,0x08,0xA3,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x31,0x25,0x29,0x25,0x29,0x25,0x21,0x24,0x21,0xE4,0x20,0xA3,0x18,0xA2,0x10,0x62,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x20,0xE3,0x20,0xA3,0x20,0xE3,0x20,0xE3,0x18,
-	0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x62,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x62,0x18,0xE4,0x20,0xA7,0x49,0x25,0x31,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x10,0x62,0x10,0xA3,0x18,0xA4,0x20,0x25,0x31,0x25,0x31,0xA3,0x20,0xA2,0x10,
-	0xA3,0x18,0xE3,0x18,0xA4,0x18,0x25,0x21,0xE4,0x20,0xE4,0x10,0xA4,0x10,0xE5,0x20,0x27,0x29,0x27,0x29,0x67,0x29,0x67,0x29,0x66,0x21,0x67,0x29,0x67,0x29,0xA9,0x29,0xA9,0x29,0xEA,0x39,0xA9,0x29,0x26,0x19,0xE4,0x10,0xA3,0x10,0xA3,0x18,0x65,0x31,0x25,0x39,0x65,0x39,0x25,0x29,0xE3,0x20,0xA2,0x10,0xE3,0x18,0xA3,0x20,0xE4,0x20,
-	0xE4,0x20,0xA3,0x18,0x49,0x5A,0xA4,0x10,0xE4,0x20,0x25,0x29,0x26,0x29,0xA8,0x39,0xEA,0x39,0xA8,0x39,0x2C,0x3A,0x27,0x21,0xA4,0x10,0xE4,0x10,0xE4,0x18,0x63,0x10,0xA3,0x10,0xA4,0x10,0xA3,0x08,0xA4,0x08,0x26,0x19,0x68,0x21,0x62,0x08,0x62,0x00,0xA4,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x26,0x29,0x25,0x29,0x25,0x29,0xE5,0x28,0x24,0x21,0xE4,0x20,0xE4,0x18,0xA3,0x18,0x62,0x10,0x62,0x10,0xA3,0x18,0xA3,0x18,0xE3,0x20,0xA3,0x18,0xA3,0x18,0xE2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x10,0xA1,0x10,0x62,0x10,0xA1,0x10,0x62,0x10,0xA1,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x08,0x20,0x08,0x60,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x62,0x08,0xA2,0x18,0xE4,0x18,
-	0xA3,0x18,0x62,0x18,0xA7,0x49,0xA7,0x49,0xA3,0x20,0xA3,0x18,0xE3,0x20,0xE4,0x20,0xA3,0x18,0xA3,0x10,0xE3,0x20,0x25,0x29,0xA7,0x49,0xA7,0x49,0x24,0x29,0xA2,0x18,0xA2,0x10,0xA3,0x18,0xA3,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x18,0xE3,0x18,0xE4,0x20,0x67,0x31,0xA8,0x39,0x26,0x29,0x26,0x29,0xE4,0x20,0xE4,0x20,0xA4,0x18,0x63,0x08,
-	0xA4,0x10,0x63,0x08,0xE5,0x18,0x26,0x21,0xA3,0x10,0x62,0x10,0xA1,0x18,0xE4,0x28,0xA7,0x39,0x66,0x29,0x25,0x29,0xE2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xE4,0x20,0xA4,0x20,0xE8,0x49,0xA7,0x49,0xE4,0x20,0x67,0x31,0x25,0x29,0x25,0x31,0x25,0x31,0xA8,0x39,0xA8,0x39,0xA8,0x39,0x26,0x19,0xE6,0x10,0xE4,0x18,0xE5,0x18,0xE4,0x18,
-	0xA4,0x10,0xE4,0x10,0xA3,0x08,0x64,0x00,0xE6,0x08,0x69,0x11,0xE4,0x10,0x62,0x08,0xA2,0x08,0xA4,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x29,0x25,0x29,0x25,0x29,0x25,0x21,0xE4,0x20,0x24,0x21,0xE3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x20,0xA3,0x20,0xE3,0x18,0xE2,0x18,0xA3,0x18,
-	0xA3,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x08,0x61,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0xA3,0x10,0xA2,0x10,0xA3,0x10,0xE4,0x28,0x25,0x29,0x62,0x10,0x61,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xE4,0x20,0x67,0x31,0xE8,0x49,0xCB,0x62,0x49,0x5A,0xA7,0x49,0xA3,0x20,
-	0x62,0x18,0x62,0x10,0x62,0x10,0xA3,0x18,0xE3,0x18,0xA3,0x18,0xE3,0x20,0x65,0x39,0xA7,0x59,0xA7,0x49,0x25,0x31,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0x62,0x08,0x61,0x10,0xA2,0x10,0xA1,0x10,0xA3,0x18,0xE5,0x18,0xA3,0x10,0x61,0x08,0xE4,0x18,0xE4,0x18,0x25,0x29,0xE3,0x20,0xE3,0x20,0xA2,0x18,0xA3,0x18,0x62,0x10,0xA3,0x20,
-	0xE4,0x20,0xA3,0x18,0x62,0x10,0x67,0x31,0xE4,0x20,0x25,0x29,0x25,0x31,0x25,0x31,0x25,0x31,0x67,0x31,0x27,0x29,0xE6,0x10,0xA4,0x18,0xA3,0x18,0xA3,0x18,0xA4,0x10,0xE4,0x10,0xE5,0x08,0xA4,0x08,0x68,0x21,0xA5,0x08,0x26,0x09,0xA3,0x00,0xA3,0x08,0x63,0x08,0xE5,0x10,0x62,0x10,0x21,0x08,0x61,0x00,0x61,0x08,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x26,0x29,0x25,0x29,0x25,0x21,0xE5,0x20,0x25,0x21,0xE4,0x20,0xE3,0x18,0xA3,0x18,0x62,0x10,0x62,0x10,0xA3,0x18,0xA3,0x18,0xE3,0x20,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xE2,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x10,0xA1,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x10,0xA2,0x10,0xA1,0x10,0x61,0x10,0x61,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x61,0x08,
-	0x21,0x08,0x61,0x08,0x62,0x08,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x20,0x25,0x29,0xA8,0x39,0xCB,0x62,0xCB,0x62,0x2C,0x3A,0x25,0x39,0x24,0x31,0x25,0x39,0xE4,0x28,0x25,0x21,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xE4,0x28,0x67,0x31,0x67,0x31,0x25,0x31,0xA3,0x20,0xE3,0x18,0xA3,0x18,0x62,0x10,0x62,0x10,
-	0xA2,0x10,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xE5,0x18,0x25,0x21,0x25,0x21,0xE3,0x10,0xA3,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xE4,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0x62,0x18,0x62,0x18,0xE4,0x20,0xE4,0x20,0xE4,0x28,0x25,0x29,0x25,0x31,0xE5,0x28,0xE5,0x28,0x26,0x21,0xA4,0x20,0xE4,0x28,0xE4,0x20,0xE4,0x20,
-	0x26,0x19,0xE5,0x08,0xE6,0x10,0x62,0x08,0x63,0x00,0x26,0x19,0xA4,0x00,0xA4,0x08,0xA3,0x08,0xA3,0x08,0x63,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x29,0x26,0x29,0x25,0x29,0x25,0x21,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xE3,0x18,0xA3,0x18,
-	0xA2,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x10,0xA2,0x10,0x61,0x10,0x61,0x08,0x20,0x00,0x60,0x00,0x20,0x00,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0x25,0x29,0x62,0x10,0x62,0x10,0xA3,0x18,0xA3,0x10,0xA3,0x18,0x65,0x31,0xA7,0x39,0xE8,0x49,0xA8,0x39,0x25,0x39,0x67,0x31,
-	0xCB,0x62,0xEC,0x8A,0xE8,0x49,0xE4,0x28,0xE4,0x20,0xE3,0x20,0xA3,0x18,0xA3,0x18,0x25,0x29,0x67,0x31,0x24,0x29,0xE3,0x18,0xE4,0x20,0xE4,0x20,0xA3,0x10,0x62,0x10,0xA2,0x10,0xA3,0x10,0xE4,0x20,0xA3,0x18,0xE3,0x18,0xE4,0x18,0xA3,0x18,0xA2,0x10,0xA1,0x10,0xE3,0x20,0x24,0x31,0xE4,0x28,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xA2,0x10,
-	0xA3,0x18,0xA3,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x18,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xE3,0x20,0xE5,0x18,0x26,0x21,0x27,0x29,0xE5,0x20,0x25,0x21,0x67,0x29,0xEA,0x39,0x2C,0x3A,0x67,0x29,0xA2,0x10,0x62,0x00,0xA4,0x08,0xA4,0x00,0xA3,0x00,0xA3,0x08,0x62,0x08,0xA3,0x08,0x61,0x00,0x62,0x08,0x61,0x00,0x61,0x08,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x66,0x29,0x26,0x29,0x25,0x29,0x25,0x21,0x24,0x21,0xE3,0x20,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x10,0xA1,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x60,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x62,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x62,0x08,
-	0x62,0x10,0x21,0x08,0x62,0x08,0x65,0x29,0x49,0x5A,0xA3,0x18,0x62,0x08,0x61,0x08,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xE5,0x20,0xE5,0x28,0xE5,0x28,0xE5,0x28,0xE5,0x28,0xA7,0x49,0xCB,0x62,0x49,0x5A,0x67,0x31,0x25,0x29,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA3,0x18,0xA3,0x10,0xA2,0x18,0xA3,0x10,0xA3,0x18,0xA3,0x18,0x62,0x10,
-	0x61,0x08,0x62,0x10,0x62,0x10,0xA7,0x49,0x61,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0x25,0x31,0xE8,0x49,0xE8,0x49,0x25,0x29,0xA3,0x18,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xE4,0x20,0x61,0x10,0x62,0x10,0x62,0x18,0xA3,0x18,0xA3,0x20,0xA3,0x20,0xA3,0x18,0xA4,0x18,0xE4,0x18,0x26,0x21,0xA9,0x29,0xA9,0x29,0xA9,0x29,0x68,0x21,
-	0xA8,0x39,0x66,0x29,0x67,0x29,0xE5,0x18,0xA3,0x08,0xE4,0x10,0x22,0x08,0xA3,0x08,0x63,0x08,0x62,0x08,0x62,0x08,0x62,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x29,0x26,0x29,0x25,0x29,0x25,0x29,0xE4,0x20,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x62,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x10,
-	0xA2,0x18,0xA3,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x10,0xA1,0x10,0xA2,0x10,0xA1,0x10,0x61,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xA3,0x10,0xE4,0x20,0x62,0x10,0x61,0x10,0x62,0x10,0x25,0x21,0x65,0x29,0xE3,0x18,0x62,0x08,0xA2,0x10,0xA3,0x18,0xE4,0x20,0xE5,0x28,
-	0x26,0x29,0xA7,0x49,0xCB,0x62,0xCB,0x62,0xA7,0x49,0x25,0x29,0x67,0x31,0x25,0x29,0x25,0x29,0x24,0x21,0xE4,0x20,0x24,0x21,0xE5,0x20,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA4,0x10,0xCB,0x62,0xE4,0x20,0xE4,0x28,0xE4,0x20,0xE4,0x20,0x65,0x29,0xA7,0x49,0xE8,0x49,0xE8,0x49,0x25,0x29,0xA3,0x18,0xA2,0x10,0x61,0x10,
-	0xA3,0x10,0xA2,0x10,0x61,0x10,0xA2,0x18,0xA3,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE5,0x20,0xE4,0x20,0xE4,0x20,0x26,0x29,0x67,0x29,0xA9,0x29,0xED,0x21,0x2C,0x3A,0xA8,0x39,0xA7,0x39,0xA8,0x39,0x68,0x21,0xE4,0x10,0xE5,0x08,0x22,0x00,0xA3,0x08,0x62,0x00,0x22,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x61,0x00,
-	0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x26,0x29,0x25,0x29,0x25,0x29,0x24,0x21,0xE3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x62,0x08,0x62,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x62,0x10,0x62,0x08,0xA2,0x10,0xA2,0x10,
-	0xA3,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0x65,0x29,0x66,0x29,0x25,0x29,0x62,0x10,0x62,0x08,0x62,0x10,0xA3,0x10,0xA3,0x18,0xE4,0x20,0x67,0x31,0x67,0x31,0x2C,0x3A,0x67,0x31,0x25,0x29,0x25,0x29,0x26,0x29,0x67,0x31,0x6D,0x7B,0x67,0x31,0xE4,0x20,0xE4,0x20,0xE4,0x18,0xE4,0x20,0xE4,0x20,
-	0xA3,0x18,0xA3,0x10,0xA3,0x18,0xE5,0x18,0xE5,0x20,0xE4,0x18,0xE4,0x20,0x25,0x29,0xE4,0x20,0x25,0x21,0x25,0x29,0xE4,0x28,0xA3,0x20,0xA2,0x18,0x62,0x10,0x62,0x08,0xA3,0x18,0x61,0x08,0x62,0x10,0xA2,0x20,0xE4,0x28,0x65,0x31,0x25,0x31,0x25,0x31,0xE5,0x20,0xA3,0x20,0xE4,0x20,0x25,0x31,0x67,0x31,0xA8,0x39,0xA8,0x39,0x8E,0x4A,
-	0xEA,0x39,0xA8,0x39,0xEA,0x39,0x67,0x29,0x25,0x21,0x69,0x11,0x28,0x09,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0xA2,0x08,0x62,0x08,0x20,0x10,0x61,0x08,0x21,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x21,0x25,0x21,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x62,0x08,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x10,
-	0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x10,0xA1,0x10,0x61,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,0x62,0x10,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x24,0x21,0x66,0x29,0x25,0x29,0x62,0x08,0x62,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,
-	0xCB,0x62,0xE8,0x49,0xE4,0x20,0xE4,0x28,0xA3,0x18,0xA3,0x18,0xA3,0x18,0x62,0x10,0xA4,0x20,0xA8,0x39,0x24,0x29,0xA3,0x18,0xA3,0x18,0x62,0x10,0x62,0x10,0x61,0x08,0x21,0x08,0xE4,0x20,0xE3,0x18,0xE4,0x18,0x62,0x08,0xA3,0x18,0xE4,0x20,0x62,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x10,0xA2,0x10,0x62,0x08,0x61,0x08,
-	0xA3,0x18,0x61,0x08,0x62,0x10,0xE4,0x28,0x65,0x39,0xA7,0x49,0xE8,0x49,0xA7,0x49,0x66,0x41,0x25,0x31,0xE4,0x28,0x25,0x31,0xA7,0x49,0xEA,0x39,0xA7,0x49,0xEA,0x39,0x8E,0x4A,0x2C,0x3A,0x2C,0x3A,0xA9,0x29,0x67,0x29,0xA9,0x29,0xED,0x21,0x69,0x11,0xA4,0x08,0x62,0x00,0xA3,0x08,0xA3,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x63,0x00,
-	0xE4,0x08,0xE5,0x10,0xA3,0x08,0xA2,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0xA3,0x08,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x21,0xE4,0x20,0xE4,0x18,0xE4,0x18,0xE3,0x10,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x62,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xE2,0x18,0xA2,0x18,0xA2,0x10,0x61,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0x21,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x62,0x10,0x62,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x10,
-	0xA3,0x18,0xA3,0x10,0xA2,0x18,0xA3,0x10,0xA2,0x10,0xA2,0x10,0x62,0x08,0x61,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0xE4,0x20,0xE4,0x18,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xE3,0x18,0xA3,0x10,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xE3,0x20,0xA3,0x18,0xA2,0x10,0x62,0x10,0x21,0x08,
-	0x20,0x00,0x49,0x5A,0x25,0x21,0xCB,0x62,0x25,0x21,0xA3,0x10,0x62,0x10,0x25,0x21,0xCB,0x62,0x61,0x08,0x62,0x10,0xA1,0x10,0x62,0x10,0x62,0x10,0x26,0x29,0xA7,0x39,0x62,0x10,0x62,0x08,0xA2,0x18,0x25,0x29,0x65,0x41,0x25,0x39,0xA7,0x59,0x69,0x72,0xA7,0x59,0xE8,0x49,0x67,0x31,0x67,0x31,0x66,0x41,0xA8,0x39,0xA7,0x49,0x49,0x5A,
-	0x2C,0x3A,0x8E,0x4A,0x2C,0x3A,0x8E,0x4A,0xEA,0x39,0x27,0x21,0x26,0x19,0x8B,0x11,0xE4,0x08,0x62,0x00,0x62,0x00,0xA3,0x00,0x62,0x00,0x22,0x00,0xA3,0x08,0xE4,0x08,0x26,0x09,0xA3,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x08,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x18,0xE4,0x18,0xA3,0x18,0xA3,0x10,0x62,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x62,0x08,0x62,0x10,0xA2,0x10,0xA2,0x10,
-	0xA3,0x10,0xA3,0x18,0xA3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x20,0xE3,0x18,0xA2,0x18,0x62,0x10,0x61,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x62,0x08,0x62,0x10,0xA3,0x18,0xA3,0x10,0xA2,0x18,0xA3,0x10,0xA2,0x18,0xA3,0x18,0xA3,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x62,0x10,0x62,0x08,0x62,0x10,0xA2,0x10,0xA2,0x08,0x62,0x10,0x61,0x10,0x61,0x08,
-	0x62,0x08,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x18,0xE3,0x18,0xA3,0x18,0xA2,0x18,0x62,0x10,0x62,0x10,0xE4,0x20,0x25,0x29,0x62,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x00,0x21,0x08,0xA3,0x10,0xA3,0x10,0x21,0x08,0x00,0x00,0x65,0x29,0x66,0x29,0x21,0x00,0x20,0x08,0x21,0x08,0x61,0x08,0x61,0x00,0xA7,0x39,0xA8,0x39,
-	0x62,0x08,0x62,0x10,0xA4,0x18,0x25,0x29,0x25,0x39,0x25,0x39,0xA7,0x59,0x49,0x5A,0x49,0x5A,0xCB,0x62,0x49,0x5A,0x67,0x31,0x25,0x31,0xA8,0x39,0xA7,0x49,0xE8,0x49,0xA7,0x59,0xE8,0x49,0x49,0x5A,0x49,0x5A,0xA8,0x39,0x25,0x29,0xE5,0x18,0xE5,0x10,0x8B,0x11,0x62,0x00,0x62,0x00,0xA3,0x08,0x62,0x00,0xA4,0x08,0xE5,0x10,0xE5,0x08,
-	0xE5,0x08,0xE5,0x08,0x26,0x09,0xE6,0x08,0x26,0x19,0x28,0x09,0x69,0x11,0xE6,0x08,0x28,0x09,0x69,0x11,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE4,0x20,0xE4,0x20,0x25,0x21,0x25,0x21,0xE4,0x20,0xE4,0x10,0xA3,0x10,0xA2,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE3,0x20,0xE3,0x18,0xA3,0x18,0xA2,0x18,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x62,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x18,0xA3,0x10,
-	0xA3,0x18,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA1,0x10,0xA2,0x10,0xA1,0x10,0x62,0x10,0x61,0x08,0x62,0x10,0x62,0x10,0x62,0x08,0x62,0x08,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0xA2,0x08,0xA2,0x10,0xA3,0x18,0xA3,0x10,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xE8,0x49,0xE8,0x49,0x62,0x10,0x62,0x10,0x62,0x10,
-	0x62,0x10,0x62,0x10,0xA2,0x10,0xE3,0x18,0x62,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x62,0x08,0xE5,0x18,0xA3,0x10,0xE4,0x18,0xA3,0x18,0xE4,0x20,0x26,0x29,0xA7,0x39,0xA7,0x49,0x49,0x5A,0xCB,0x62,0x2C,0x3A,0x49,0x5A,0x25,0x31,0x25,0x31,0x67,0x31,0xA7,0x39,0xA7,0x49,
-	0xA7,0x49,0xA7,0x49,0x49,0x5A,0x2C,0x3A,0xA8,0x39,0x25,0x21,0xE4,0x20,0x26,0x19,0x8B,0x11,0xA3,0x00,0x62,0x00,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x08,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x08,0x26,0x09,0xE6,0x08,0x28,0x09,0x28,0x09,0xE6,0x08,0xE6,0x08,0x8B,0x11,0x28,0x09,0x62,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x60,0x00,0x62,0x00,0x68,0x21,0x67,0x29,0xA4,0x08,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x21,0x25,0x21,0x25,0x29,0x25,0x21,0x25,0x21,0xE4,0x18,0xA3,0x18,0xA2,0x10,0x62,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x62,0x10,
-	0xA3,0x18,0xA3,0x18,0xE3,0x18,0xE3,0x20,0xE3,0x18,0xE3,0x20,0xA3,0x20,0xA3,0x18,0xA2,0x18,0xA2,0x18,0x62,0x10,0x61,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x61,0x08,0x21,0x00,0x61,0x08,0x62,0x08,0x62,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0xA1,0x10,0xA2,0x08,0x61,0x10,0xA2,0x08,0x62,0x10,0x61,0x08,0x62,0x08,0x62,0x08,0xA2,0x08,
-	0x61,0x08,0x62,0x08,0x21,0x08,0x61,0x00,0x60,0x08,0x61,0x08,0x61,0x10,0xA2,0x10,0xA2,0x10,0x66,0x29,0xE8,0x49,0xEA,0x39,0xA8,0x39,0x62,0x10,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0xA3,0x10,0xA3,0x18,0xA2,0x10,0xA2,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x62,0x08,0xA3,0x10,0x26,0x21,
-	0x26,0x21,0xEA,0x39,0x66,0x29,0xE4,0x18,0x25,0x21,0x25,0x29,0x25,0x31,0x27,0x29,0x67,0x31,0xE8,0x49,0xA7,0x49,0xE5,0x28,0x25,0x31,0x25,0x31,0x67,0x31,0x67,0x31,0x26,0x29,0x25,0x29,0xA8,0x39,0xEA,0x39,0x27,0x29,0x25,0x21,0x14,0x7C,0xA9,0x29,0xED,0x21,0xA3,0x00,0xA3,0x08,0xA4,0x00,0xA3,0x00,0xA4,0x08,0xE5,0x08,0x26,0x09,
-	0x28,0x09,0xE6,0x08,0xE5,0x08,0xE5,0x08,0xE6,0x08,0x28,0x09,0xA5,0x00,0x63,0x00,0xA3,0x00,0x28,0x09,0x8B,0x11,0x26,0x09,0xA4,0x08,0xA3,0x08,0xE4,0x08,0xE5,0x08,0xE4,0x08,0xA4,0x00,0xE5,0x08,0x2C,0x3A,0x52,0x5B,0xED,0x21,0x8B,0x11,0x69,0x11,0xE5,0x08,0x62,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x21,0x25,0x29,0x26,0x29,0x26,0x29,0x26,0x29,0x24,0x21,0xE4,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0xA3,0x18,0xE3,0x18,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xE3,0x20,0xA3,0x18,0xE3,0x20,0xA3,0x18,0xA3,0x18,0xA1,0x18,0xA2,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,0xA3,0x18,0xA2,0x10,0xA3,0x10,
-	0xA2,0x18,0xA3,0x10,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA1,0x10,0x61,0x08,0x61,0x10,0xA1,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x62,0x10,0x24,0x21,0xE8,0x49,0xE8,0x49,0x66,0x29,0xE4,0x20,0x62,0x08,0x61,0x08,
-	0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0x62,0x10,0xA2,0x08,0xA2,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x10,0xA2,0x08,0xA3,0x10,0xE4,0x10,0xE4,0x10,0x26,0x21,0xA7,0x39,0x67,0x29,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xA4,0x20,0x27,0x29,0x26,0x29,0x25,0x31,0x25,0x31,0x25,0x39,0x25,0x31,0x25,0x39,
-	0x25,0x29,0xA4,0x18,0x25,0x29,0xA8,0x39,0x25,0x29,0x23,0x29,0xA7,0x49,0xA9,0x29,0xED,0x21,0xE4,0x00,0xA3,0x00,0xA4,0x00,0x28,0x09,0x28,0x09,0xE6,0x10,0x26,0x09,0xE5,0x08,0xE4,0x10,0xA3,0x10,0xA4,0x08,0xE5,0x08,0x26,0x19,0xA3,0x00,0x22,0x00,0x20,0x00,0x63,0x00,0x28,0x09,0x69,0x11,0xE6,0x08,0xA4,0x00,0xE5,0x00,0x26,0x19,
-	0x26,0x09,0xE6,0x08,0xE6,0x08,0x28,0x09,0x69,0x11,0x28,0x09,0x69,0x11,0x8B,0x11,0x69,0x11,0xA5,0x00,0x63,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x21,0x66,0x29,0x66,0x29,0x25,0x29,0x66,0x29,0x25,0x21,0xE4,0x20,0xE4,0x18,0xA3,0x10,0xA2,0x08,0x62,0x10,0x61,0x08,0x62,0x08,0x62,0x08,0x61,0x08,0x62,0x10,
-	0xA3,0x10,0xE4,0x20,0xE3,0x18,0xA3,0x18,0xE3,0x20,0xE3,0x18,0xA3,0x20,0xA3,0x18,0xE3,0x20,0xE3,0x20,0xA2,0x18,0xA2,0x18,0x61,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0xA1,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x62,0x08,0x62,0x10,0x61,0x08,0x21,0x00,0x61,0x08,
-	0x62,0x08,0x62,0x08,0x62,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0xE4,0x18,0x65,0x29,0x25,0x29,0x25,0x29,0x62,0x10,0x21,0x08,0x61,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,
-	0x62,0x08,0xE4,0x18,0xE4,0x18,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x08,0x61,0x08,0xA3,0x10,0xA4,0x18,0xA3,0x20,0xE4,0x20,0x25,0x29,0x25,0x29,0x25,0x31,0x25,0x29,0xE5,0x28,0xE5,0x20,0x27,0x29,0xA9,0x29,0xA7,0x39,0x67,0x31,0x66,0x21,0x8B,0x11,0xED,0x21,0x69,0x11,0x26,0x19,0xED,0x21,0x52,0x5B,0xA9,0x29,0xE5,0x08,0xE5,0x08,
-	0xA3,0x08,0x62,0x08,0x62,0x08,0x62,0x00,0xA4,0x08,0xA3,0x00,0xA4,0x08,0x61,0x00,0x20,0x00,0xA3,0x00,0x8B,0x11,0xED,0x21,0x8B,0x11,0xE6,0x08,0xE5,0x08,0xE5,0x00,0xE5,0x00,0x26,0x09,0x2C,0x3A,0xA9,0x29,0xA4,0x08,0x63,0x00,0xA4,0x08,0xE6,0x08,0x28,0x09,0xE6,0x08,0xE5,0x00,0xA4,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x21,0x25,0x29,0x26,0x29,0x66,0x29,0x25,0x21,0x25,0x21,0xE5,0x20,0xE4,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0xA2,0x10,0xA3,0x18,0xE3,0x18,0xA3,0x18,0xE3,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x20,0xE3,0x20,0xE3,0x20,0xA3,0x18,0xE3,0x20,0xA2,0x18,0xA2,0x18,0x61,0x08,0x21,0x08,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x62,0x08,0x62,0x10,0xA3,0x10,0xA3,0x18,0xA2,0x18,0xA3,0x10,
-	0xA2,0x10,0xA3,0x18,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA1,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x62,0x08,0x21,0x00,0x21,0x00,0x61,0x08,0x62,0x08,0xA2,0x08,0x62,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x62,0x08,0xE4,0x18,0x25,0x29,0x25,0x21,0x61,0x08,0x21,0x08,
-	0x62,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x20,0x08,0x21,0x08,0x61,0x08,0x62,0x08,0xA2,0x10,0x62,0x08,0xA2,0x10,0x62,0x08,0x21,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0xA3,0x10,0x62,0x08,0x62,0x10,0xA7,0x39,0x49,0x5A,0xE5,0x20,0xE4,0x20,0x26,0x29,
-	0x27,0x29,0xA8,0x39,0xA8,0x39,0xEA,0x39,0xA8,0x39,0x67,0x29,0xA9,0x29,0xED,0x21,0xED,0x21,0xED,0x21,0xA9,0x29,0x8E,0x4A,0x52,0x5B,0xED,0x21,0xE4,0x10,0x63,0x08,0x62,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0xA4,0x10,0x63,0x00,0xA3,0x08,0xA3,0x08,0x62,0x00,0xA5,0x00,0x8B,0x11,0x8B,0x11,0xED,0x21,0x8B,0x11,0x26,0x09,0xE5,0x08,
-	0xE5,0x00,0xA9,0x29,0x14,0x7C,0x52,0x5B,0xE5,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x08,0xA5,0x08,0xE5,0x08,0xE5,0x08,0xE5,0x00,0xA4,0x00,0xA3,0x00,0x62,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x18,0x25,0x29,0x26,0x21,0x25,0x29,0x25,0x29,0x25,0x21,0xE4,0x20,0xE4,0x18,0xE4,0x18,0xE3,0x18,0xA3,0x10,0x62,0x08,0xA2,0x10,0x62,0x08,0x61,0x10,0xA2,0x10,
-	0xA3,0x18,0xE3,0x18,0xE4,0x18,0xA3,0x18,0xE4,0x18,0xE3,0x18,0xE3,0x18,0xA3,0x20,0xE3,0x18,0xE3,0x20,0xA3,0x18,0xA3,0x18,0xA2,0x18,0x61,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0xA2,0x10,0xA3,0x18,0xA3,0x10,0xA3,0x18,0xA3,0x10,0xA2,0x18,0xA3,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xA1,0x10,0x62,0x10,0x61,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x21,0x08,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x62,0x08,0xA3,0x10,0xA3,0x08,0x62,0x08,0x61,0x08,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x08,0xA2,0x10,0xE3,0x18,0xA3,0x10,0x62,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x60,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x62,0x08,0x62,0x10,0xA3,0x10,0xA3,0x10,0xE4,0x18,0xA3,0x10,0x61,0x08,0x61,0x08,
-	0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0xA3,0x10,0xA3,0x10,0x62,0x08,0xA3,0x10,0x26,0x21,0xA8,0x39,0xE5,0x10,0x26,0x21,0x26,0x21,0x27,0x29,0x27,0x29,0xA8,0x39,0xEA,0x39,0x2C,0x3A,0x2C,0x3A,0x2C,0x3A,0x8E,0x4A,0x52,0x5B,0x8E,0x4A,0x52,0x5B,0x8E,0x4A,0x2C,0x3A,0x67,0x29,0xE5,0x18,0xA3,0x08,
-	0x62,0x10,0xA3,0x10,0x63,0x08,0xE4,0x10,0xA4,0x10,0xA2,0x00,0xA3,0x08,0xE5,0x10,0xE5,0x08,0xE6,0x08,0x28,0x09,0x28,0x09,0x69,0x11,0x8B,0x11,0x28,0x09,0xE6,0x08,0xE4,0x08,0x26,0x19,0x52,0x5B,0x8E,0x4A,0x69,0x11,0xE5,0x08,0xE5,0x08,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA5,0x00,0x26,0x09,0xE6,0x08,0xE5,0x08,0xA4,0x00,
-	0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA3,0x18,0x25,0x21,0x25,0x29,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE4,0x20,0xE4,0x18,0xE3,0x18,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x10,0xA2,0x08,0xA3,0x10,0xE3,0x18,0xE4,0x18,0xE4,0x18,0xE3,0x18,0xE4,0x20,0xA3,0x18,0xE4,0x20,0xE3,0x18,0xA3,0x20,0xE3,0x20,0xE3,0x20,0xE3,0x18,0xA3,0x10,0x62,0x10,0x61,0x00,0x61,0x08,
-	0x61,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x08,0x21,0x00,0x61,0x08,0x62,0x08,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xA2,0x10,
-	0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0xA1,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA3,0x10,0xE4,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x21,0x00,0x21,0x00,0x61,0x08,0x61,0x00,0x21,0x08,0x62,0x08,0x62,0x08,0x61,0x08,0x63,0x08,0xE4,0x18,0xA3,0x08,0xA3,0x10,0xA3,0x10,0xE4,0x10,0xE5,0x10,0x26,0x21,0x26,0x19,0xE5,0x20,
-	0xE5,0x20,0x67,0x31,0xE8,0x49,0x8E,0x4A,0x52,0x5B,0x8E,0x4A,0x8E,0x4A,0x8E,0x4A,0x52,0x5B,0x8E,0x4A,0x14,0x7C,0x14,0x7C,0x14,0x7C,0x8E,0x4A,0x66,0x21,0xA4,0x18,0xA4,0x10,0xA4,0x18,0xA4,0x10,0xE5,0x10,0xA4,0x10,0xA4,0x10,0xE4,0x18,0xE6,0x10,0x28,0x09,0x28,0x09,0x26,0x09,0x63,0x00,0xA4,0x00,0xE6,0x08,0x26,0x09,0xA5,0x00,
-	0x63,0x00,0xA3,0x00,0xE5,0x00,0x28,0x09,0xE5,0x08,0xE5,0x08,0xE6,0x08,0xE5,0x08,0xA4,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0xE5,0x00,0x28,0x09,0xE6,0x08,0xE5,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x08,0x26,0x29,0x25,0x21,0x25,0x21,0x25,0x21,0x25,0x29,0x25,0x29,0xE4,0x20,0xE4,0x20,0xE4,0x18,0xE3,0x18,0xA2,0x10,0xA2,0x08,0x62,0x10,0xA2,0x10,0xA3,0x10,
-	0xA3,0x18,0xE3,0x18,0xE4,0x20,0xE4,0x18,0xA3,0x20,0xE3,0x18,0xE4,0x20,0xA4,0x20,0xE4,0x20,0xE4,0x20,0xA3,0x20,0xA3,0x18,0xA2,0x18,0x62,0x10,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x61,0x08,0x62,0x10,0xA3,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x18,0xA3,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0xA1,0x10,0x62,0x08,0x61,0x08,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x08,0xA3,0x10,0xA3,0x10,0xA3,0x08,0xA3,0x10,0xA3,0x08,0x62,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x62,0x08,0x62,0x10,0xA3,0x08,0x63,0x08,0x62,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x60,0x00,0x21,0x00,0x20,0x00,0x61,0x08,0x21,0x00,0x21,0x08,0x61,0x08,0x62,0x08,
-	0xA2,0x08,0x62,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0xA3,0x10,0xA4,0x08,0xA3,0x08,0xA3,0x08,0xA3,0x08,0xE4,0x10,0xE5,0x18,0xE5,0x10,0xA4,0x10,0xE4,0x18,0x25,0x29,0xA8,0x39,0x8E,0x4A,0x52,0x5B,0x14,0x7C,0x8E,0x4A,0x2C,0x3A,0x8E,0x4A,0x52,0x5B,0x52,0x5B,0x6D,0x7B,0x52,0x5B,0x14,0x7C,0x52,0x5B,0x67,0x31,0xA3,0x10,
-	0xA3,0x10,0xA3,0x10,0xE4,0x10,0xE6,0x10,0xA4,0x10,0xE4,0x18,0xE3,0x18,0xE4,0x18,0x68,0x21,0xED,0x21,0x26,0x09,0xA3,0x00,0x21,0x00,0xA3,0x08,0xE5,0x00,0xA5,0x08,0x63,0x08,0x61,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0xA4,0x08,0xA4,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xE5,0x08,0xE5,0x08,0xA3,0x00,0xA4,0x00,
-	0xA3,0x08,0xA2,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x26,0x29,0x25,0x21,0x25,0x29,0x26,0x29,0x26,0x29,0x26,0x29,0x25,0x29,0x25,0x29,0xE4,0x20,0xE4,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x18,0xE4,0x18,0xE4,0x20,0xE4,0x20,0xE4,0x18,0xE4,0x20,0xA3,0x20,0xE4,0x20,0xE3,0x20,0xA4,0x20,0xE4,0x20,0xA3,0x18,0xA2,0x10,0x62,0x08,0x61,0x08,0x21,0x08,
-	0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x08,0x62,0x08,0xA2,0x10,0xA3,0x10,0xA2,0x18,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x61,0x10,0x62,0x08,0x62,0x10,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x61,0x00,0x62,0x08,0x62,0x08,0xA2,0x08,0x62,0x08,0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x62,0x08,0xA3,0x10,
-	0xA3,0x10,0xA4,0x10,0xA3,0x10,0xA2,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x61,0x08,0x21,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x62,0x08,0x63,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x62,0x00,0xA4,0x10,0xA3,0x08,0xA3,0x00,0x63,0x08,0xA4,0x10,0xA4,0x10,0x63,0x08,0x62,0x08,0xA3,0x10,0xE5,0x18,
-	0x66,0x29,0xEA,0x39,0xEA,0x39,0x8E,0x4A,0x8E,0x4A,0x49,0x5A,0xEA,0x39,0x2C,0x3A,0x52,0x5B,0x8E,0x4A,0x8E,0x4A,0xE8,0x49,0x8E,0x4A,0x8E,0x4A,0x66,0x29,0x62,0x10,0xA3,0x10,0xA2,0x08,0xE4,0x10,0xA4,0x10,0xA3,0x08,0xA3,0x10,0x62,0x10,0xA3,0x08,0x27,0x21,0x2C,0x3A,0xA9,0x29,0xE5,0x08,0xA3,0x00,0xA3,0x00,0xE5,0x08,0xE5,0x00,
-	0x26,0x09,0xE4,0x08,0xA3,0x00,0x61,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xE5,0x08,0x28,0x09,0xE5,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA2,0x00,0x62,0x00,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x25,0x29,0x26,0x21,0x26,0x29,0x66,0x29,0x66,0x29,0x66,0x29,0x26,0x29,0x25,0x29,0x25,0x21,0xE4,0x20,0xE3,0x18,0xA3,0x10,0xA3,0x10,0xA2,0x10,0xA3,0x10,
-	0xA2,0x10,0xA3,0x18,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x18,0xE3,0x20,0xE4,0x20,0xA3,0x18,0xA2,0x10,0x62,0x08,0x62,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,
-	0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x62,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0xA1,0x10,0x62,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0x62,0x08,0xE4,0x18,0xE4,0x18,0x62,0x08,0x61,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x63,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x21,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x08,0x62,0x00,0xE4,0x10,0xE5,0x10,0xA3,0x08,0xA3,0x08,0xA3,0x08,0xA3,0x00,0x61,0x00,0x62,0x08,0xA3,0x10,0xA3,0x10,0xE5,0x18,0x26,0x21,0xA8,0x39,0xEA,0x39,0x66,0x41,0xA7,0x49,0xE8,0x49,0xEA,0x39,0x8E,0x4A,0x8E,0x4A,0x2C,0x3A,0x8E,0x4A,0xEA,0x39,0xA8,0x39,0x68,0x21,0x25,0x19,0x62,0x08,
-	0x62,0x10,0xA2,0x08,0xE4,0x10,0x63,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x62,0x08,0x26,0x21,0xA9,0x29,0x68,0x21,0x26,0x09,0xE5,0x08,0xE5,0x00,0x28,0x09,0x26,0x09,0x28,0x09,0x28,0x09,0xA5,0x00,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x00,0xA4,0x00,0x26,0x09,0xE5,0x08,0xA3,0x00,0x62,0x00,
-	0xA4,0x00,0x26,0x09,0xE5,0x08,0xA4,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x26,0x29,0x26,0x29,0x26,0x29,0x67,0x29,0x67,0x31,0x67,0x31,0x67,0x31,0x26,0x29,0x25,0x29,0x25,0x21,0xE4,0x20,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x20,0xE4,0x20,0xE4,0x20,0xE4,0x20,0xA3,0x18,0xE3,0x20,0xE4,0x18,0xA3,0x18,0xA3,0x18,0x62,0x10,0x61,0x08,0x62,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x00,0x21,0x08,0x21,0x00,0x61,0x00,0x21,0x08,0x60,0x00,0x21,0x08,0x20,0x08,0x21,0x00,0x21,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x60,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0x62,0x08,0x62,0x10,
-	0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA1,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x10,0x66,0x29,0x26,0x21,0xE4,0x18,0x62,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x61,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0xA2,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x00,0x62,0x08,0x61,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x08,0x62,0x00,0xA3,0x08,0xE5,0x10,0xE4,0x08,0xA4,0x08,0xA3,0x08,0xA3,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0x63,0x08,0xA3,0x08,0xE4,0x10,
-	0x26,0x21,0x26,0x29,0x25,0x29,0x67,0x31,0xA7,0x49,0xE8,0x49,0xEA,0x39,0x52,0x5B,0x2C,0x3A,0xA8,0x39,0x2C,0x3A,0xEA,0x39,0x67,0x29,0xE4,0x18,0xE4,0x10,0xA3,0x10,0x62,0x08,0xA3,0x10,0xA4,0x10,0x62,0x08,0x62,0x08,0x21,0x08,0x61,0x00,0x62,0x08,0xE4,0x08,0xE4,0x18,0x63,0x10,0xA4,0x08,0x26,0x09,0x28,0x09,0x8B,0x11,0x69,0x11,
-	0xE5,0x00,0xE6,0x08,0x69,0x11,0x26,0x09,0xA5,0x00,0x62,0x00,0x60,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0x68,0x21,0xED,0x21,0x8B,0x11,0xE6,0x08,0xA4,0x00,0xA2,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x20,0x67,0x31,0x67,0x31,0xA7,0x39,0x67,0x31,0xA8,0x39,0x67,0x31,0x66,0x29,0x26,0x29,0x25,0x21,0xE4,0x20,0xE4,0x18,0xE3,0x10,0xA3,0x18,0xA3,0x18,
-	0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x20,0xE3,0x18,0xE4,0x20,0xE4,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,
-	0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x08,0x62,0x10,0xA2,0x10,0xA1,0x10,0x62,0x08,0x62,0x10,0xA2,0x08,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x25,0x21,0x25,0x21,0xE4,0x18,0x62,0x08,0x62,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x08,0xA2,0x00,0x63,0x08,0xA3,0x08,0xA3,0x08,0xA3,0x08,
-	0xA2,0x08,0xA3,0x08,0x63,0x08,0xA3,0x08,0xA4,0x08,0xE4,0x10,0xA4,0x08,0xA3,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x08,0xA4,0x10,0xE4,0x18,0xE4,0x20,0x24,0x21,0x66,0x29,0x67,0x31,0xE8,0x49,0x2C,0x3A,0x8E,0x4A,0x2C,0x3A,0x67,0x31,0x2C,0x3A,0xA9,0x29,0x67,0x29,0xE4,0x18,0xA3,0x10,0xE4,0x10,
-	0xA4,0x08,0xE4,0x10,0xA4,0x10,0xA3,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x62,0x00,0xA4,0x08,0xA3,0x00,0x62,0x08,0x62,0x08,0xA4,0x08,0xE5,0x08,0x28,0x09,0x69,0x11,0x28,0x09,0x28,0x09,0x69,0x11,0x8B,0x11,0x8B,0x11,0x69,0x11,0xE5,0x08,0xE6,0x08,0x26,0x09,0xE6,0x08,0xE5,0x08,0xA3,0x08,0xA3,0x08,0xA4,0x00,0xE5,0x00,0xE5,0x00,
-	0xED,0x21,0x8E,0x4A,0xED,0x21,0x69,0x11,0x26,0x09,0xE4,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA3,0x10,0x67,0x31,0x67,0x31,0x67,0x31,0xA8,0x39,0x67,0x31,0x67,0x29,0x67,0x31,0x26,0x29,0x25,0x29,0xE4,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA3,0x18,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x62,0x10,0x61,0x08,0x62,0x08,
-	0x61,0x08,0x61,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x62,0x08,0x62,0x08,0xA2,0x10,0xA2,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA3,0x10,0xA3,0x18,0x62,0x08,0x21,0x00,0x62,0x08,0x62,0x08,0x61,0x08,0x61,0x08,
-	0x61,0x00,0x62,0x08,0x62,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x08,0x63,0x08,0xA3,0x08,0xA3,0x08,0xA3,0x10,0xA3,0x10,0xA3,0x08,0xA3,0x08,0xE4,0x08,0xE5,0x10,0x63,0x00,0x62,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0xA2,0x08,0x62,0x08,0x61,0x08,
-	0x62,0x10,0xE3,0x18,0xE3,0x20,0xE4,0x20,0x24,0x29,0x67,0x31,0xA8,0x39,0x8E,0x4A,0xEA,0x39,0xE8,0x49,0xE8,0x49,0x2C,0x3A,0xEA,0x39,0x25,0x21,0xA3,0x18,0xA4,0x10,0xE5,0x08,0x25,0x19,0x25,0x21,0x25,0x21,0xE4,0x20,0xE3,0x18,0x62,0x08,0x62,0x08,0xA3,0x08,0x62,0x00,0x21,0x00,0x61,0x08,0x21,0x08,0x62,0x00,0x62,0x00,0xA5,0x00,
-	0x28,0x09,0xE6,0x08,0xE5,0x08,0x28,0x09,0x8B,0x11,0x8B,0x11,0x69,0x11,0x28,0x09,0x69,0x11,0x28,0x09,0xE4,0x08,0xE4,0x08,0xE5,0x08,0x28,0x09,0x28,0x09,0x26,0x09,0x28,0x09,0xED,0x21,0xED,0x21,0x8B,0x11,0x69,0x11,0x69,0x11,0x28,0x09,0xE5,0x08,0xA4,0x00,0x62,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x67,0x31,0x67,0x29,0x67,0x31,0x67,0x31,0xA8,0x39,0xA7,0x39,0x66,0x29,0x26,0x29,0x25,0x21,0xE4,0x18,0xE4,0x18,0xE4,0x18,0xE3,0x18,0xA3,0x18,
-	0xA3,0x10,0xA3,0x18,0xA2,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,
-	0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x08,0x62,0x08,0xA2,0x10,0x24,0x21,0x25,0x21,0xE4,0x18,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x62,0x00,0xA3,0x08,0xA4,0x08,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x20,0x24,0x31,0x26,0x29,0xEA,0x39,0x67,0x29,0xA7,0x49,0xE8,0x49,0x2C,0x3A,0xA9,0x29,0x25,0x29,0xE4,0x20,0xA3,0x10,
-	0xE6,0x10,0x68,0x21,0x26,0x21,0x25,0x29,0x26,0x21,0x24,0x21,0xA3,0x10,0xA3,0x08,0xA3,0x08,0x62,0x00,0x21,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xE6,0x08,0x69,0x11,0x28,0x09,0x28,0x09,0x69,0x11,0x26,0x09,0x64,0x00,0x63,0x00,0xA5,0x00,0xE6,0x08,0xE6,0x08,0xE6,0x08,
-	0x26,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x69,0x11,0x69,0x11,0x69,0x11,0x8B,0x11,0x69,0x11,0x28,0x09,0xA5,0x00,0x62,0x08,0x62,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x66,0x29,0x67,0x31,0x67,0x31,0x67,0x31,0x67,0x31,0x67,0x29,0x66,0x29,0x25,0x29,0x25,0x21,0xE4,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x62,0x10,
-	0x62,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x00,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0xA3,0x10,0x66,0x29,0x66,0x29,0x66,0x29,0x63,0x10,0x62,0x08,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xA2,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xA3,0x08,0xA3,0x00,0xA2,0x00,0x62,0x00,0x21,0x08,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0xE4,0x20,0x26,0x21,0xA8,0x39,0xE4,0x28,0x66,0x41,0xEA,0x39,0x2C,0x3A,0xA9,0x29,0x25,0x21,0x24,0x21,0xE4,0x20,0x25,0x19,0x68,0x21,0xEA,0x39,0xEA,0x39,0xEA,0x39,0x67,0x29,0x26,0x21,0xE4,0x08,0xA4,0x08,0x62,0x00,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x63,0x00,0xA2,0x00,0x61,0x00,0x63,0x00,0xE6,0x08,0x69,0x11,0x69,0x11,0x69,0x11,0x69,0x11,0x28,0x09,0xE6,0x08,0xE6,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0x26,0x09,0x28,0x09,0xE6,0x08,0xE6,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0x8B,0x11,0xED,0x21,0x8B,0x11,0x69,0x11,0x28,0x09,0xA4,0x00,0x63,0x00,0x61,0x00,0x61,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0x67,0x29,0x67,0x31,0x67,0x29,0x67,0x31,0x67,0x31,0x66,0x29,0x25,0x21,0xE5,0x20,0x24,0x21,0xE4,0x18,0xE4,0x18,0xE4,0x18,0xA3,0x18,
-	0xE3,0x10,0xA3,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x62,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,
-	0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x25,0x19,0x66,0x29,0x26,0x21,0xA3,0x10,0xA2,0x08,0x62,0x08,0x62,0x00,0x62,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x61,0x00,0x61,0x00,0x62,0x00,0xA3,0x08,0x62,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x62,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x60,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x62,0x10,0xA3,0x18,0x26,0x21,0x68,0x21,0xE4,0x20,0x24,0x31,0xA8,0x39,0x2C,0x3A,0x68,0x21,0x25,0x21,0x24,0x29,0x25,0x21,
-	0x25,0x21,0xA8,0x39,0xCB,0x62,0x8E,0x4A,0x2C,0x3A,0x2C,0x3A,0xA9,0x29,0x26,0x19,0xE5,0x08,0xA4,0x08,0x62,0x08,0x61,0x00,0x61,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0xA5,0x08,0xE6,0x08,0x28,0x09,0x69,0x11,0x28,0x09,0x28,0x09,0x69,0x11,0x69,0x11,0x69,0x11,0x28,0x09,
-	0xA5,0x00,0xE6,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0xE6,0x08,0x28,0x09,0x69,0x11,0x8B,0x11,0xED,0x21,0xED,0x21,0x8B,0x11,0x69,0x11,0xE6,0x08,0xA4,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x60,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x66,0x29,0x67,0x31,0x67,0x31,0x67,0x31,0x67,0x29,0x66,0x29,0x26,0x21,0x25,0x21,0x25,0x21,0xE4,0x18,0xE4,0x18,0xE4,0x18,0xE4,0x18,0xE3,0x18,0xE3,0x10,0xA3,0x18,0xA3,0x10,0xA3,0x18,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x08,0x62,0x10,0x62,0x08,
-	0x61,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x61,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0xA3,0x10,0xA2,0x08,0x62,0x08,0x63,0x08,0x62,0x08,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0x61,0x00,0x61,0x00,0x62,0x00,0xA3,0x08,0xA2,0x00,0x62,0x00,0xA3,0x00,0xA3,0x08,0xA3,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x61,0x08,0x21,0x00,0x60,0x08,0x61,0x08,0xA2,0x10,0x26,0x19,0x26,0x21,0xE4,0x20,0xE4,0x20,0x67,0x29,0x67,0x29,0x67,0x31,0xE4,0x28,0x25,0x21,0x24,0x29,0x24,0x21,0xA7,0x39,0xCB,0x62,0xCB,0x62,0xCB,0x62,0x2C,0x3A,0xA9,0x29,0x68,0x21,0xE6,0x08,0xE5,0x10,0xA4,0x08,0xE4,0x08,0xA3,0x08,0xA3,0x08,0x62,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x20,0x00,0x21,0x00,0x62,0x00,0xA4,0x08,0xA5,0x00,0xA5,0x00,0xA4,0x08,0xA4,0x08,0xE6,0x08,0xA4,0x08,0xA3,0x00,0x63,0x00,0xE5,0x00,0xE5,0x08,0xE5,0x00,0xA5,0x00,0xA4,0x00,0xE4,0x00,0xE6,0x08,0x8B,0x11,0x8B,0x11,0x8B,0x11,0x8B,0x11,0x69,0x11,0x69,0x11,0x28,0x09,0xE6,0x08,
-	0xA4,0x00,0x63,0x00,0x22,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x29,0xA8,0x39,0xA8,0x39,0x67,0x31,0x67,0x31,0x67,0x31,0x26,0x29,0x26,0x21,0x25,0x21,0xE4,0x20,0xE4,0x18,0xE4,0x18,0xE4,0x18,
-	0xE4,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x21,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x61,0x00,0x62,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,
-	0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x08,0x61,0x00,0x21,0x08,
-	0x21,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x08,0x62,0x00,0x62,0x00,0x21,0x00,0x20,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x61,0x08,0x62,0x08,0xE5,0x18,0xE5,0x18,0xA3,0x18,0xE4,0x18,0x25,0x21,0xE5,0x18,0x66,0x21,0x25,0x21,0xE4,0x20,0xE3,0x18,
-	0xE4,0x20,0x26,0x29,0x49,0x5A,0x8E,0x4A,0xCB,0x62,0xEA,0x39,0xA8,0x39,0x26,0x19,0xE5,0x10,0xA3,0x08,0xE4,0x10,0xE4,0x10,0xE4,0x10,0xE5,0x18,0xE4,0x08,0xA3,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0xA4,0x08,0x26,0x19,0xA4,0x08,0x62,0x00,0x22,0x00,0x61,0x00,0x62,0x00,
-	0x22,0x00,0x62,0x00,0x63,0x00,0xA4,0x00,0xA4,0x00,0x63,0x00,0x62,0x00,0xA4,0x00,0x28,0x09,0x8B,0x11,0x69,0x11,0x28,0x09,0xE6,0x08,0xE6,0x08,0x28,0x09,0x69,0x11,0x28,0x09,0xE5,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0xA8,0x39,0xA8,0x39,0xA8,0x39,0xA8,0x39,0x67,0x31,0x67,0x31,0x66,0x29,0x26,0x21,0x25,0x21,0x25,0x19,0xE4,0x20,0xE4,0x18,0xE4,0x18,0xE3,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x08,0x62,0x10,0x62,0x08,0x62,0x10,
-	0x62,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xA3,0x08,0xE5,0x08,0xA4,0x08,0xA3,0x08,0x62,0x00,0x61,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x60,0x00,0x60,0x00,0x21,0x00,0xA3,0x08,0xA3,0x08,0x62,0x00,0xE4,0x08,0xA3,0x00,0x63,0x08,0xE4,0x10,0xE4,0x10,0xA3,0x10,0x62,0x10,0xE3,0x20,0x25,0x29,0xA8,0x39,0x49,0x5A,0xCB,0x62,0xEA,0x39,0x26,0x21,0x25,0x19,0xA3,0x10,0xA4,0x10,0xE5,0x18,0x25,0x19,0xE5,0x18,0xE5,0x18,0xE4,0x10,0xE3,0x08,
-	0x62,0x00,0x62,0x00,0x63,0x00,0xA2,0x00,0xA5,0x08,0xA4,0x00,0x63,0x00,0x61,0x00,0x61,0x08,0xE5,0x08,0xA9,0x29,0x67,0x29,0xE5,0x08,0x21,0x00,0x20,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0xA3,0x00,0xE6,0x08,0x28,0x09,0x28,0x09,0xE6,0x08,0x64,0x00,0xA4,0x00,0xE5,0x00,0x28,0x09,
-	0x28,0x09,0x69,0x11,0xE6,0x08,0xA4,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0xA3,0x00,0x63,0x08,0xA3,0x00,0x63,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xEA,0x39,0xEA,0x39,0xA8,0x39,0xA8,0x39,0xA8,0x39,0x67,0x31,0x66,0x29,0x66,0x29,0x25,0x21,0x25,0x21,0x25,0x21,0xE4,0x18,
-	0xE4,0x18,0xE3,0x18,0xE3,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,
-	0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x20,0x00,0x62,0x00,
-	0xA3,0x08,0xE4,0x08,0xA4,0x08,0xA3,0x00,0x62,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x60,0x00,0x21,0x08,0x61,0x00,0xA3,0x08,0x62,0x00,0x62,0x00,0xA3,0x08,0x61,0x00,0x62,0x00,0xE4,0x08,0x63,0x08,0x62,0x08,0x61,0x08,
-	0xA3,0x10,0xE4,0x20,0x25,0x29,0x67,0x31,0x67,0x29,0x25,0x21,0x25,0x19,0xE6,0x10,0xA4,0x10,0xA4,0x18,0x25,0x21,0x26,0x21,0x25,0x21,0x25,0x21,0x25,0x21,0xE4,0x10,0x62,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x62,0x00,0xA5,0x00,0x63,0x00,0x21,0x00,0x61,0x00,0x25,0x19,0x68,0x21,0xA9,0x29,0x68,0x21,0xA4,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x62,0x00,0x62,0x00,0xA2,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA5,0x00,0xE6,0x08,0x28,0x09,0xE5,0x00,0xA2,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0x28,0x09,0x28,0x09,0x28,0x09,0xE5,0x08,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x08,0xA2,0x00,0x62,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x20,0xE8,0x49,0xEA,0x39,0xA8,0x39,0xA8,0x39,0xA8,0x39,0x67,0x29,0x66,0x29,0x26,0x21,0x25,0x21,0x24,0x21,0x24,0x21,0xE4,0x18,0xE3,0x18,0xA3,0x10,0xA3,0x18,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x08,0x61,0x10,
-	0x62,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x08,0xA3,0x00,0x62,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x60,0x00,0x21,0x00,0xA3,0x08,0x62,0x00,0xA3,0x08,0x62,0x08,0x20,0x00,0x62,0x00,0xA4,0x08,0xA4,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0xA2,0x10,0xA3,0x10,0xE4,0x18,0xE3,0x18,0xA3,0x18,0xE4,0x18,0xE5,0x18,0xA4,0x10,0xE4,0x18,0x25,0x21,0x26,0x29,0x67,0x29,0x67,0x29,0x67,0x29,0x26,0x21,
-	0xA3,0x10,0x61,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x62,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x62,0x10,0x25,0x21,0x25,0x19,0x26,0x19,0xE5,0x08,0xA4,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA5,0x00,0xE5,0x08,0xA3,0x00,0x21,0x00,0x62,0x00,0xE5,0x08,0x28,0x09,0xE6,0x08,0xA4,0x00,0xA3,0x00,
-	0xA4,0x00,0xE5,0x00,0x28,0x09,0x28,0x09,0x28,0x09,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA8,0x39,0xEA,0x39,0xE8,0x49,0xA8,0x39,0xA8,0x39,0x67,0x31,0x66,0x29,0x25,0x29,0x25,0x21,0x25,0x21,0x24,0x21,
-	0x24,0x21,0xE4,0x18,0xE3,0x10,0xA3,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x08,0x62,0x10,0x61,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,
-	0x21,0x08,0x61,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x60,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x61,0x00,0xA3,0x08,0x63,0x00,0xA3,0x00,0x61,0x00,0x20,0x00,0x62,0x00,0xE5,0x10,0xE5,0x08,0xA4,0x08,0xA3,0x08,
-	0xA3,0x08,0xA3,0x08,0xA3,0x08,0xA3,0x08,0xA2,0x10,0xA3,0x08,0xA5,0x10,0xE5,0x18,0xA3,0x10,0xA4,0x18,0x25,0x21,0x67,0x29,0xA8,0x39,0xA8,0x39,0x67,0x29,0x67,0x29,0x25,0x21,0x62,0x08,0x61,0x08,0x20,0x00,0x21,0x00,0x62,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0xA2,0x08,0xA3,0x10,0x62,0x00,0xA4,0x00,0xE4,0x00,0xA4,0x00,
-	0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xE6,0x08,0x26,0x09,0xA4,0x00,0x61,0x00,0x21,0x00,0xA3,0x00,0xE5,0x08,0x28,0x09,0x26,0x09,0xE5,0x00,0xA4,0x00,0xE5,0x08,0xE6,0x08,0x28,0x09,0x69,0x11,0x28,0x09,0xE6,0x08,0xE5,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0xEA,0x39,0xEA,0x39,0xA8,0x39,0xA8,0x39,0xA7,0x39,0x66,0x29,0x66,0x21,0x25,0x21,0x24,0x21,0x25,0x21,0x24,0x21,0xE4,0x18,0xA3,0x10,0xA2,0x10,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x08,0x62,0x10,0x62,0x10,0x61,0x08,0x62,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x21,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x21,0x08,0x21,0x08,0x60,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x62,0x00,0xA4,0x08,0xA3,0x00,0xA2,0x00,0x20,0x00,0x21,0x08,0x62,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0xA3,0x08,0xA3,0x08,0xA4,0x08,0xE5,0x08,0xE5,0x08,0xE4,0x10,0xA5,0x08,0xE6,0x10,0x28,0x09,0xA4,0x10,0xA3,0x10,0x25,0x19,0x67,0x29,0xEA,0x39,0xEA,0x39,0xA8,0x39,0x67,0x29,
-	0x26,0x21,0xA3,0x10,0x62,0x08,0x61,0x00,0x62,0x00,0x63,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0xA4,0x08,0x28,0x09,0xE5,0x00,0xA2,0x08,0xA3,0x00,0x63,0x00,0xA4,0x00,0xE5,0x00,0xE6,0x08,0xE6,0x08,
-	0x26,0x09,0xE5,0x08,0xE6,0x08,0x28,0x09,0x8B,0x11,0x8B,0x11,0x69,0x11,0x26,0x09,0xA5,0x00,0xA3,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x39,0xA7,0x49,0xEA,0x39,0xA8,0x39,0xA8,0x39,0x67,0x29,0x26,0x29,0x25,0x21,0x25,0x21,0x25,0x21,
-	0x24,0x21,0xE4,0x18,0xA3,0x10,0xA2,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x61,0x10,0x62,0x10,0x61,0x08,0x62,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x61,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0xA4,0x08,0xA4,0x00,0x62,0x00,0x21,0x08,0x21,0x08,0xA3,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x61,0x00,
-	0x61,0x00,0x62,0x00,0x62,0x08,0xA4,0x08,0xA4,0x10,0xA5,0x10,0x69,0x11,0x28,0x09,0xE5,0x10,0xE4,0x08,0xA5,0x08,0x66,0x21,0xEA,0x39,0xEA,0x39,0xA9,0x29,0x66,0x21,0x25,0x21,0xA3,0x10,0x62,0x10,0x62,0x08,0xA3,0x08,0xA4,0x08,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x08,0xA4,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x08,0xA3,0x08,0xA4,0x08,0xE5,0x00,0xE5,0x00,0xE6,0x08,0x28,0x09,0x26,0x09,0xE5,0x00,0x28,0x09,0x69,0x11,0x8B,0x11,0x8B,0x11,0x69,0x11,0x28,0x09,0xE5,0x08,0xA4,0x00,0xA3,0x08,0x62,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,
-	0xA4,0x00,0xA4,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xEA,0x39,0xA8,0x39,0xA8,0x39,0xA7,0x39,0x67,0x29,0x66,0x29,0x25,0x21,0x25,0x21,0x24,0x21,0x25,0x21,0xE4,0x18,0xA3,0x10,0x62,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x62,0x08,0x61,0x08,0x21,0x08,0x61,0x08,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x60,0x00,0x21,0x08,0x21,0x00,0x60,0x00,0x21,0x08,0x21,0x08,0x61,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x60,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x62,0x00,0xE4,0x08,0x63,0x00,0x21,0x00,0x20,0x08,0x61,0x00,0xA3,0x00,0x61,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0x62,0x08,0xA3,0x08,0xE5,0x08,0xE6,0x08,0xE5,0x10,0xE5,0x10,0xE5,0x10,0x26,0x19,0x68,0x21,0x68,0x21,0x66,0x21,0x26,0x21,
-	0xE5,0x18,0xA3,0x18,0xA3,0x10,0xE4,0x18,0x26,0x21,0x26,0x21,0xE4,0x10,0x62,0x08,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA4,0x08,0xA4,0x08,0x62,0x00,0x62,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0xA3,0x00,0xE5,0x08,0xE6,0x08,
-	0x28,0x09,0x28,0x09,0x28,0x09,0xE6,0x08,0x28,0x09,0x69,0x11,0x8B,0x11,0x69,0x11,0x69,0x11,0x28,0x09,0xE5,0x08,0xE5,0x08,0xE5,0x08,0xE4,0x08,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x08,0xE6,0x08,0xE6,0x08,0xE4,0x08,0xA3,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0xA8,0x39,0xA8,0x39,0x67,0x31,0x67,0x29,0x66,0x29,0x25,0x21,0x25,0x21,0x24,0x21,
-	0x24,0x21,0xE3,0x10,0xA3,0x10,0x62,0x08,0x61,0x00,0x21,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0xE4,0x08,0x62,0x00,0x20,0x00,0x20,0x08,0xA2,0x08,0xA2,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x62,0x08,0xA3,0x08,0xE5,0x08,0xA3,0x08,0xA3,0x10,0xA4,0x10,0xE5,0x10,0xE5,0x10,0x26,0x19,0x68,0x21,0x27,0x21,0x25,0x19,0xE5,0x18,0xE4,0x18,0xE4,0x20,0x65,0x29,0xA8,0x39,0x67,0x29,0x68,0x21,0x25,0x19,0xA2,0x08,0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,
-	0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0xA4,0x00,0xE4,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0x69,0x11,0x28,0x09,0xE6,0x08,0xE6,0x08,0x28,0x09,0x28,0x09,0xE6,0x08,0xE5,0x00,0xE6,0x08,0x26,0x09,0xE6,0x08,0x28,0x09,
-	0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0xE5,0x08,0xA4,0x00,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x29,0xA8,0x39,0xA8,0x39,0x67,0x29,0x66,0x29,0x25,0x21,0x25,0x21,0xE4,0x20,0xE4,0x18,0xE3,0x18,0xA2,0x10,0x61,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x62,0x08,0xA4,0x08,0x62,0x00,0x21,0x00,0x21,0x00,0xA3,0x08,0x62,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x63,0x08,0xE4,0x08,0xA3,0x08,0x62,0x08,0xA3,0x10,0xA3,0x08,0xE4,0x08,0xE5,0x10,0xE5,0x10,0x26,0x19,0x26,0x19,
-	0xE5,0x18,0xE5,0x10,0x25,0x21,0x66,0x29,0xA8,0x39,0xA8,0x39,0xA8,0x39,0x66,0x29,0xE3,0x10,0x62,0x08,0xA3,0x08,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x62,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0x28,0x09,0x28,0x09,0xE6,0x08,0xE5,0x00,0xE5,0x00,0x28,0x09,0xE6,0x08,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0xE5,0x08,0xA4,0x00,0x62,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA8,0x39,0xA8,0x39,0x67,0x31,0x26,0x29,0x25,0x21,0xE4,0x20,0xE4,0x18,
-	0xE4,0x18,0xA3,0x10,0xA3,0x10,0x61,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0xA3,0x08,0xA3,0x08,0x22,0x00,0x62,0x00,0xA4,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0xA4,0x00,0xA4,0x08,0x63,0x00,0x62,0x08,0x62,0x10,0xA3,0x08,0xA3,0x08,0xA3,0x08,0xA4,0x10,0xE5,0x10,0x25,0x19,0x27,0x21,0x26,0x19,0x26,0x19,0xA8,0x39,0xA9,0x29,0xEA,0x39,0xA9,0x29,0x67,0x29,0xE4,0x18,0xE4,0x08,0xA3,0x08,0xA4,0x08,0xE4,0x08,0xE5,0x08,0xE5,0x08,0x26,0x09,
-	0xE5,0x08,0x26,0x09,0xA4,0x00,0x62,0x00,0x21,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0x61,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x62,0x00,0x63,0x00,0xA4,0x00,0xE5,0x00,0xE6,0x08,0xE6,0x08,0xA4,0x08,0xE5,0x00,0xE6,0x08,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0x26,0x09,
-	0x28,0x09,0x28,0x09,0xE5,0x00,0x28,0x09,0x28,0x09,0x28,0x09,0xE6,0x08,0xE5,0x00,0xA4,0x00,0x63,0x00,0x61,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xA7,0x39,0x67,0x29,0x26,0x21,0x24,0x21,0xE4,0x18,0xE3,0x18,0xA3,0x18,0xA3,0x10,0xA2,0x10,0x62,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x62,0x00,0xA4,0x08,0xA2,0x00,0xA3,0x00,0xA3,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x08,0x62,0x08,0xA3,0x10,0xA3,0x08,0xA3,0x10,0xA3,0x10,0xA4,0x10,0xE5,0x10,
-	0x26,0x19,0x68,0x21,0x68,0x21,0x68,0x21,0xA9,0x29,0xA9,0x29,0xA9,0x29,0x67,0x29,0x26,0x19,0xE5,0x10,0xE4,0x08,0xE4,0x08,0xE5,0x08,0xE5,0x00,0xE5,0x08,0xA5,0x08,0xA4,0x08,0xA4,0x00,0xA4,0x08,0x63,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0x63,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x61,0x00,
-	0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0xA4,0x00,0xA5,0x08,0xA2,0x08,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x08,0xE5,0x00,0xE4,0x00,0xE5,0x08,0xE6,0x08,0xE6,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0xE6,0x08,0xE6,0x08,0xE5,0x08,0xE4,0x00,0xA3,0x00,0x62,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x10,0x66,0x29,0x25,0x21,0xE4,0x20,0xE4,0x18,0xA3,0x18,
-	0xA3,0x10,0xA2,0x10,0x62,0x10,0x61,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0xA3,0x00,0xE5,0x08,0xE5,0x00,0x63,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x00,0xA3,0x08,0x62,0x00,0x21,0x00,0x62,0x08,0x62,0x08,0x62,0x08,0xA2,0x08,0x62,0x08,0xA3,0x08,0xE4,0x18,0xE4,0x18,0x25,0x19,0x25,0x19,0x26,0x19,0x27,0x21,0x68,0x21,0xA9,0x29,0x68,0x21,0x25,0x19,0x25,0x19,0xE4,0x10,0xE4,0x10,0xA4,0x00,0xA4,0x08,0xA4,0x08,0xA3,0x08,0xA4,0x08,
-	0xE5,0x08,0xA4,0x08,0xA4,0x08,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA5,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA4,0x00,0xA3,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0xA5,0x00,0xE5,0x08,0xE6,0x08,0xE6,0x08,
-	0xE6,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0xE6,0x08,0xE5,0x00,0xE5,0x08,0xE5,0x00,0xE5,0x08,0xA3,0x00,0x62,0x00,0x61,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x18,0x25,0x21,0xE4,0x18,0xE3,0x18,0xA3,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x08,0x62,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0xE5,0x08,0xE5,0x08,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x62,0x00,0xA3,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x61,0x08,0x62,0x08,0xA3,0x08,0xA3,0x10,0xA3,0x10,0xE4,0x18,
-	0x25,0x21,0x25,0x21,0x25,0x19,0x26,0x21,0x26,0x19,0x26,0x19,0xE5,0x18,0xE4,0x18,0xE4,0x10,0xE4,0x10,0xE4,0x10,0xA3,0x08,0xA3,0x08,0x63,0x08,0xA3,0x10,0xE3,0x08,0xE5,0x10,0xE4,0x08,0xA4,0x08,0xA3,0x08,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xE4,0x08,0xA4,0x08,0xA4,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0xA4,0x00,0xA4,0x08,0xE5,0x08,0xE5,0x08,0xE5,0x00,0xE5,0x00,0xE6,0x08,0x28,0x09,0xE6,0x08,0xE5,0x00,0xE5,0x08,0xE6,0x08,0xE6,0x08,0xE6,0x08,0xE6,0x08,0xE5,0x08,0xA4,0x00,0x62,0x00,0x61,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x18,0xE4,0x18,0xE3,0x10,0xA2,0x10,
-	0xA3,0x10,0xA3,0x10,0x62,0x10,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0xA2,0x08,0xA3,0x08,0xA3,0x00,0xA3,0x08,
-	0xA4,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x08,0x63,0x08,0xA3,0x10,0xE4,0x18,0xE4,0x18,0xE5,0x20,0x25,0x19,0x26,0x21,0x27,0x21,0x25,0x19,0xE5,0x18,0xE5,0x18,0xE4,0x18,0xE3,0x18,0xA3,0x10,0xA3,0x08,0x63,0x08,0xA3,0x10,0xA3,0x08,0xE4,0x10,
-	0xE4,0x08,0xA3,0x08,0xA3,0x08,0x62,0x08,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x08,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x08,0xE4,0x08,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE6,0x08,0x26,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0xA4,0x08,0xA2,0x00,0x62,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0xA3,0x10,0xA3,0x18,0xA2,0x10,0xA2,0x10,0x62,0x10,0x61,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x08,0xA3,0x08,0xA3,0x00,0xA4,0x08,0xE4,0x00,0xE5,0x08,0x26,0x09,0xA4,0x00,0x63,0x00,0x62,0x08,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0xA3,0x08,0xE4,0x10,
-	0xE5,0x18,0x25,0x19,0x27,0x21,0x27,0x21,0x26,0x21,0x25,0x19,0x25,0x21,0xE4,0x18,0x25,0x19,0xE4,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x10,0xE4,0x18,0x25,0x19,0x25,0x19,0xE4,0x10,0x62,0x08,0x62,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0xA4,0x00,0xA4,0x08,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xE4,0x08,0xE5,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA2,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0xA2,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x08,0x26,0x09,0xE6,0x08,0xE6,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0xE5,0x00,
-	0xA4,0x00,0xA2,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA3,0x10,0xA3,0x10,
-	0xA3,0x10,0xA2,0x10,0x62,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xA2,0x00,0xA3,0x08,0xA4,0x00,0xA3,0x08,0xA4,0x00,0xA3,0x08,0x63,0x08,0x62,0x00,0x62,0x00,0x63,0x08,0xA3,0x08,0xA4,0x10,0xE5,0x10,0x26,0x19,0x26,0x19,0x26,0x21,0x25,0x19,0x25,0x21,0x25,0x19,0x25,0x21,0x25,0x21,0xE5,0x10,0xA3,0x10,0xA2,0x10,0xE4,0x18,0x25,0x19,0x26,0x21,0x66,0x21,
-	0xE5,0x10,0xA3,0x08,0x61,0x08,0x21,0x08,0x21,0x08,0x61,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x63,0x00,0xE5,0x00,0xE5,0x08,0xE5,0x08,0xA5,0x00,0xE4,0x08,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA2,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,
-	0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0xA2,0x00,0xA3,0x00,0xA4,0x08,0xE4,0x00,0xE5,0x00,0xE6,0x08,0xE6,0x08,0x28,0x09,0x28,0x09,0xE5,0x08,0xA4,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x61,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x61,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,
-	0x20,0x00,0x61,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0xA3,0x08,0xA3,0x10,
-	0xE4,0x10,0x26,0x19,0x27,0x21,0x26,0x21,0x25,0x19,0xE5,0x18,0x25,0x19,0xE5,0x18,0x25,0x19,0xE4,0x10,0xA3,0x18,0xE3,0x18,0x25,0x21,0x25,0x21,0x25,0x19,0x25,0x21,0x25,0x19,0xA3,0x10,0x61,0x00,0x21,0x00,0x61,0x08,0x61,0x00,0x62,0x00,0xA4,0x00,0xE4,0x00,0xA3,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x63,0x00,0xA4,0x08,
-	0xA5,0x00,0xE5,0x00,0xE4,0x08,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0x63,0x00,0xA2,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x08,0xE4,0x08,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xE6,0x08,0xE6,0x08,
-	0xE6,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x62,0x08,0x62,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x00,0x20,0x00,0x61,0x00,0x21,0x00,
-	0x20,0x00,0x61,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0xA3,0x08,0xE4,0x10,0x26,0x19,0x25,0x19,0x25,0x19,0x26,0x21,0x25,0x19,0xE5,0x18,0xE5,0x18,0xA3,0x18,0xA3,0x10,0xA3,0x18,0x25,0x19,0x26,0x21,0x66,0x21,0x25,0x19,
-	0xE4,0x20,0xA2,0x18,0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0xA3,0x00,0xE4,0x00,0xA3,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA4,0x00,0xA3,0x00,0xA2,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x00,
-	0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x08,0xA3,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x61,0x08,0x21,0x00,0x61,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x60,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x61,0x00,0x61,0x00,0x60,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x61,0x08,0x62,0x08,0xA3,0x10,0xE5,0x18,0xE5,0x18,0x26,0x19,0x25,0x19,0xE5,0x10,0xE5,0x10,0xA4,0x10,0xA3,0x10,0xA3,0x08,0xE5,0x18,0x26,0x21,0x26,0x21,0x25,0x21,0xE3,0x18,0xA3,0x10,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x63,0x00,0xA4,0x08,0xA4,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x08,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA5,0x00,0xE5,0x08,0xE5,0x00,0xE6,0x08,0xE5,0x08,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x08,0xE5,0x00,0xA4,0x00,0xA3,0x00,0x63,0x00,0xA4,0x00,0xA4,0x08,0xA4,0x00,0xE5,0x00,0x63,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x61,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x20,0x00,0x61,0x00,0x21,0x08,0x60,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x00,0x60,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x61,0x08,
-	0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x62,0x08,0xA3,0x10,0xA3,0x10,0xA4,0x10,0xE5,0x10,0xE5,0x10,0xE4,0x10,0xE4,0x10,0xA3,0x00,0x63,0x00,0xE4,0x08,0x26,0x21,0x25,0x19,0xE4,0x18,
-	0xA3,0x18,0x62,0x10,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x08,0xA3,0x08,0x62,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0xA4,0x00,0xE5,0x08,0xE6,0x08,
-	0xE6,0x08,0xE5,0x08,0xA4,0x08,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x08,0xE5,0x00,0xE5,0x00,0xA4,0x08,0xA4,0x00,0xA4,0x00,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x00,0x21,0x08,0x60,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x60,0x00,0x21,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x08,0x60,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x60,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0x62,0x08,0x61,0x10,0x61,0x08,0x61,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x08,0x21,0x00,0x61,0x08,0x61,0x00,0x62,0x08,0xA2,0x08,0xA3,0x08,0xA4,0x08,0xE4,0x10,0xE4,0x08,0xE5,0x08,0xA4,0x08,0xE4,0x00,0xE5,0x08,0xA3,0x10,0xA3,0x10,0x62,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xA2,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,
-	0xA3,0x00,0x62,0x00,0xA2,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x08,0xA3,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA5,0x00,0xE5,0x00,0xE6,0x08,0x26,0x09,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x08,0x26,0x09,0x26,0x09,0xE6,0x08,0xA4,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x08,0x61,0x00,0x21,0x08,
-	0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x00,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x60,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x62,0x08,0xA2,0x10,
-	0xA2,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x62,0x10,0x61,0x08,0x61,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x61,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0xA3,0x08,0xA4,0x08,0xE4,0x08,0xE5,0x08,0xE5,0x08,0xA4,0x08,0x62,0x08,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA2,0x00,0x62,0x00,0xA2,0x00,0x63,0x00,0xA3,0x00,0xA2,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x63,0x00,0xA4,0x00,0xA5,0x00,
-	0xE6,0x08,0xE5,0x08,0xA5,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x00,0xE6,0x08,0xE6,0x08,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x60,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x60,0x00,0x21,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x21,0x00,0x61,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x00,0x61,0x08,0x61,0x00,0x21,0x00,0x60,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x61,0x08,0x21,0x00,0x60,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x08,0x61,0x00,0x61,0x00,0x61,0x08,0x62,0x08,0x61,0x00,0x62,0x08,0x62,0x08,0x63,0x08,0xA3,0x00,0xA4,0x08,0xE5,0x08,0xA4,0x08,0xA3,0x00,0x22,0x08,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0x63,0x08,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0x63,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA4,0x00,0xA4,0x08,0xE5,0x08,0xA5,0x00,0xA4,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0x62,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x60,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x20,0x00,0x61,0x08,
-	0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x61,0x00,0x21,0x00,0x61,0x08,0x60,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x18,
-	0xA2,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x62,0x08,0xA3,0x00,0xA4,0x08,0xA4,0x08,0x63,0x08,
-	0x62,0x08,0x61,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0xA3,0x00,0x62,0x00,0x61,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA2,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0xA3,0x00,0xE5,0x00,0xA4,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,
-	0x61,0x00,0x21,0x08,0x60,0x00,0x21,0x00,0x61,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x08,0x60,0x00,0x21,0x00,0x60,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x08,0x62,0x08,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xA2,0x18,0xA3,0x10,0xA2,0x18,0xA3,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x08,0x62,0x00,0x62,0x08,0x63,0x08,0x63,0x08,0xA3,0x00,0xA3,0x08,0x63,0x00,0x62,0x08,0x62,0x08,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xA3,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x61,0x00,0x61,0x00,
-	0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x00,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x08,
-	0x21,0x08,0x60,0x00,0x21,0x08,0x61,0x00,0x61,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x61,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x61,0x08,0x62,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x10,0xA2,0x10,
-	0xA2,0x18,0xA2,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x62,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x08,0x62,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0xA3,0x08,0xA3,0x00,0xA3,0x08,
-	0x63,0x00,0x62,0x08,0x62,0x08,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA4,0x08,0xA3,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x61,0x00,
-	0x62,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x62,0x08,0x21,0x08,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x00,0x61,0x08,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x08,0x61,0x00,0x61,0x08,0x21,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x00,
-	0x21,0x00,0x20,0x08,0x21,0x00,0x61,0x00,0x21,0x00,0x60,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x62,0x08,0x62,0x10,0xA3,0x18,0xA3,0x10,0xA2,0x18,0xA2,0x10,0xA3,0x18,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x62,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0x62,0x08,0xA3,0x08,0xA3,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x20,0x00,0x21,0x00,0x62,0x00,0xA3,0x00,0xA3,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0x62,0x08,
-	0x61,0x00,0x20,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x08,0xA3,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x08,0x61,0x08,0x62,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0x21,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x21,0x00,0x61,0x08,0x61,0x00,0x61,0x08,0x61,0x00,0x21,0x08,
-	0x61,0x00,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x61,0x08,0x21,0x08,0x21,0x00,0x60,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x61,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x10,0xA3,0x18,0xA2,0x10,
-	0xA2,0x18,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0x62,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x61,0x00,0x61,0x00,0x61,0x08,0x61,0x00,0x61,0x00,0x21,0x08,0x61,0x00,0x62,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0x62,0x08,0xA3,0x00,
-	0xA3,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0xA2,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x08,0xA3,0x10,0xA3,0x10,0xE3,0x10,0xA3,0x10,0x62,0x08,0x61,0x00,0x62,0x00,0x61,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_2051_dial_img_0_184_data_0, "face_2051_dial_img_0_184_data_0.bin");
         
 
 
@@ -2171,7 +21,7 @@ const lv_img_dsc_t face_2051_dial_img_0_184_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 286,
-    .data_size = sizeof(face_2051_dial_img_0_184_data_0),
+    .data_size = 137280,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_2051_dial_img_0_184_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 2051
 
 #include "../2051.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,49 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_7_96684_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x55,0xAD,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,
-	0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFB,0xDE,
-	0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xD7,0xBD,0x38,0xC6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,
-	0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x24,0x21,0x4D,0x6B,0x4D,0x6B,
-	0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x5D,0xEF,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x5D,0xEF,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0x38,0xC6,0xF3,0x9C,0x55,0xAD,0xFB,0xDE,0xF3,0x9C,0x71,0x8C,
-	0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xCB,0x5A,0xEF,0x7B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xF3,0x9C,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x24,0x21,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0xCB,0x5A,0xBE,0xF7,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2051_dial_img_7_96684_data_0, "face_2051_dial_img_7_96684_data_0.bin");
         
 
 
@@ -62,55 +21,13 @@ const lv_img_dsc_t face_2051_dial_img_7_96684_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 46,
     .header.h = 17,
-    .data_size = sizeof(face_2051_dial_img_7_96684_data_0),
+    .data_size = 2346,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2051_dial_img_7_96684_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_7_96684_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x55,0xAD,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,
-	0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xF3,0x9C,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x4D,0x6B,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x4D,0x6B,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFB,0xDE,
-	0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xD7,0xBD,0x38,0xC6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x5D,0xEF,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x5D,0xEF,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0x38,0xC6,0xF3,0x9C,0x55,0xAD,0xFB,0xDE,0xF3,0x9C,0x71,0x8C,
-	0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xCB,0x5A,0xEF,0x7B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xF3,0x9C,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x24,0x21,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0xCB,0x5A,0xBE,0xF7,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x55,0xAD,
-	0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2051_dial_img_7_96684_data_1, "face_2051_dial_img_7_96684_data_1.bin");
         
 
 
@@ -118,55 +35,13 @@ const lv_img_dsc_t face_2051_dial_img_7_96684_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 46,
     .header.h = 17,
-    .data_size = sizeof(face_2051_dial_img_7_96684_data_1),
+    .data_size = 2346,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2051_dial_img_7_96684_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_7_96684_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x55,0xAD,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,
-	0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xCB,0x5A,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFB,0xDE,
-	0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xD7,0xBD,0x38,0xC6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x08,0x42,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x5D,0xEF,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x5D,0xEF,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0x38,0xC6,0xF3,0x9C,0x55,0xAD,0xFB,0xDE,0xF3,0x9C,0x71,0x8C,
-	0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xCB,0x5A,0xEF,0x7B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xF3,0x9C,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x24,0x21,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0xCB,0x5A,0xBE,0xF7,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,
-	0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2051_dial_img_7_96684_data_2, "face_2051_dial_img_7_96684_data_2.bin");
         
 
 
@@ -174,55 +49,13 @@ const lv_img_dsc_t face_2051_dial_img_7_96684_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 46,
     .header.h = 17,
-    .data_size = sizeof(face_2051_dial_img_7_96684_data_2),
+    .data_size = 2346,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2051_dial_img_7_96684_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_7_96684_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x55,0xAD,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x24,0x21,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,
-	0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0xBE,0xF7,0xFF,0xFF,0x9A,0xD6,0xFB,0xDE,0xFF,0xFF,0x5D,0xEF,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x00,0x00,0x4D,0x6B,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFB,0xDE,
-	0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xF3,0x9C,
-	0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x08,0x42,0xD7,0xBD,0x38,0xC6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,
-	0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0xFB,0xDE,0xBE,0xF7,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x24,0x21,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,
-	0x4D,0x6B,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xD7,0xBD,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x5D,0xEF,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFB,0xDE,0xFF,0xFF,0x4D,0x6B,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEF,0x7B,0x55,0xAD,0x9A,0xD6,0xFB,0xDE,0xFF,0xFF,0x4D,0x6B,0x4D,0x6B,0x5D,0xEF,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0x38,0xC6,0xF3,0x9C,0x55,0xAD,0xFB,0xDE,0xF3,0x9C,0x71,0x8C,
-	0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x24,0x21,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xCB,0x5A,0xEF,0x7B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xF3,0x9C,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x24,0x21,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0xCB,0x5A,0xBE,0xF7,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,
-	0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x24,0x21,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2051_dial_img_7_96684_data_3, "face_2051_dial_img_7_96684_data_3.bin");
         
 
 
@@ -230,55 +63,13 @@ const lv_img_dsc_t face_2051_dial_img_7_96684_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 46,
     .header.h = 17,
-    .data_size = sizeof(face_2051_dial_img_7_96684_data_3),
+    .data_size = 2346,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2051_dial_img_7_96684_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_7_96684_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x55,0xAD,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x08,0x42,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,
-	0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x08,0x42,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x4D,0x6B,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFB,0xDE,
-	0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xCB,0x5A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xD7,0xBD,0x38,0xC6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,
-	0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xCB,0x5A,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0xFF,0xFF,0x5D,0xEF,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x71,0x8C,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x5D,0xEF,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xCB,0x5A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0x4D,0x6B,0x5D,0xEF,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0x38,0xC6,0xF3,0x9C,0x55,0xAD,0xFB,0xDE,0xF3,0x9C,0x71,0x8C,
-	0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xCB,0x5A,0xEF,0x7B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xF3,0x9C,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x24,0x21,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0xCB,0x5A,0xBE,0xF7,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2051_dial_img_7_96684_data_4, "face_2051_dial_img_7_96684_data_4.bin");
         
 
 
@@ -286,55 +77,13 @@ const lv_img_dsc_t face_2051_dial_img_7_96684_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 46,
     .header.h = 17,
-    .data_size = sizeof(face_2051_dial_img_7_96684_data_4),
+    .data_size = 2346,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2051_dial_img_7_96684_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_7_96684_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x55,0xAD,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,
-	0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xEF,0x7B,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFB,0xDE,
-	0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,
-	0xF3,0x9C,0x71,0x8C,0x00,0x00,0x08,0x42,0xD7,0xBD,0x38,0xC6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0x5D,0xEF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xBE,0xF7,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x38,0xC6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x55,0xAD,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x5D,0xEF,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xFF,0xFF,0xD7,0xBD,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x4D,0x6B,0x5D,0xEF,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0x38,0xC6,0xF3,0x9C,0x55,0xAD,0xFB,0xDE,0xF3,0x9C,0x71,0x8C,
-	0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xBE,0xF7,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xCB,0x5A,0xEF,0x7B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x71,0x8C,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xF3,0x9C,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x24,0x21,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0xCB,0x5A,0xBE,0xF7,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xBE,0xF7,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x71,0x8C,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,
-	0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0xEF,0x7B,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x9A,0xD6,0x08,0x42,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2051_dial_img_7_96684_data_5, "face_2051_dial_img_7_96684_data_5.bin");
         
 
 
@@ -342,55 +91,13 @@ const lv_img_dsc_t face_2051_dial_img_7_96684_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 46,
     .header.h = 17,
-    .data_size = sizeof(face_2051_dial_img_7_96684_data_5),
+    .data_size = 2346,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2051_dial_img_7_96684_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_7_96684_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x55,0xAD,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x08,0x42,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x5D,0xEF,
-	0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x9A,0xD6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0xFB,0xDE,0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFB,0xDE,
-	0x4D,0x6B,0x4D,0x6B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,
-	0x4D,0x6B,0x00,0x00,0x00,0x00,0x08,0x42,0xD7,0xBD,0x38,0xC6,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0xF3,0x9C,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xF3,0x9C,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xBE,0xF7,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,
-	0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,
-	0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x5D,0xEF,0xBE,0xF7,0x9A,0xD6,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x4D,0x6B,0x5D,0xEF,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xF3,0x9C,0x38,0xC6,0xF3,0x9C,0x55,0xAD,0xFB,0xDE,0xF3,0x9C,0x71,0x8C,
-	0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x24,0x21,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x9A,0xD6,0xFF,0xFF,0xD7,0xBD,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x55,0xAD,0x9A,0xD6,0xFF,0xFF,0xCB,0x5A,0xEF,0x7B,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xF3,0x9C,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x00,0x00,0x00,0x00,0x24,0x21,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0xCB,0x5A,0xBE,0xF7,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x4D,0x6B,0xD7,0xBD,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,
-	0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x4D,0x6B,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x08,0x42,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_2051_dial_img_7_96684_data_6, "face_2051_dial_img_7_96684_data_6.bin");
         
 
 
@@ -398,7 +105,7 @@ const lv_img_dsc_t face_2051_dial_img_7_96684_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 46,
     .header.h = 17,
-    .data_size = sizeof(face_2051_dial_img_7_96684_data_6),
+    .data_size = 2346,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2051_dial_img_7_96684_data_6};
 
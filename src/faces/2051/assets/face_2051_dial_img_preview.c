@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 2051
-
-#include "../2051.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2051_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x30,0x84,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xB6,0xB5,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x69,0x4A,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0x61,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0xB6,0xB5,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x20,0x03,0x59,0xA2,0x38,0x81,0x20,0x60,0x10,0x00,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x60,0x08,
-	0x80,0x10,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC3,0x18,0xAE,0x73,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x18,0x60,0x18,0xE3,0x38,0x03,0x51,0xA2,0x38,0x61,0x20,0x80,0x18,0x20,0x10,0x27,0x72,0x0A,0x9B,0x03,0x39,
-	0x03,0x31,0xC2,0x28,0x40,0x10,0x61,0x10,0xA2,0x18,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,
-	0x99,0xCE,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x81,0x20,0x81,0x20,0x60,0x18,0xA2,0x38,0x23,0x59,0xC2,0x38,0x61,0x20,0x81,0x20,0x09,0x9B,0xAF,0xDC,0xC6,0x71,
-	0x65,0x59,0x85,0x59,0x43,0x49,0x44,0x49,0x65,0x51,0x23,0x41,0x81,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0xC2,0x20,0xE2,0x20,0xA2,0x18,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x34,0xA5,0xDE,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x20,0x00,0x20,0x08,0x20,0x10,0x81,0x10,0x41,0x20,0xA2,0x38,0x23,0x61,0x43,0x59,0xC2,0x50,0x23,0x61,0xE6,0x99,0x67,0xAA,
-	0x67,0x9A,0xE9,0xB2,0x0A,0xAB,0x0A,0xBB,0xC9,0xA2,0x68,0xA2,0xE3,0x38,0x60,0x10,0x40,0x10,0x60,0x10,0x81,0x20,0xE3,0x28,0xE3,0x30,0xE3,0x30,0xE3,0x30,0xA2,0x18,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x41,0x10,0xE3,0x48,0xE7,0x79,0x06,0x9A,0x47,0x9A,0x23,0x71,0xE6,0x99,0x31,0xED,
-	0x8E,0xD4,0xCC,0xD3,0x6A,0xCB,0xAF,0xDC,0x0C,0xD4,0xE8,0xC2,0x44,0x69,0x03,0x49,0x44,0x69,0x85,0x79,0x64,0x69,0x85,0x69,0x65,0x59,0x44,0x51,0x24,0x51,0x03,0x41,0x03,0x41,0xC2,0x28,0x60,0x10,0x40,0x10,0x20,0x10,0x40,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xBA,0xD6,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0xC3,0x30,0xA6,0x71,0x24,0x79,0xA5,0x99,0x85,0x91,0xE6,0xA1,0xCC,0xD3,
-	0x0C,0xD4,0xCC,0xD3,0xC8,0xC2,0x09,0xC3,0xAB,0xD3,0x09,0xC3,0x44,0x81,0xE5,0x91,0x0D,0xCC,0xCF,0xD4,0x87,0xB2,0x47,0x92,0xA4,0x79,0xE6,0x81,0xE6,0x81,0x06,0x82,0x06,0x82,0xC6,0x79,0xE2,0x30,0x60,0x18,0x60,0x10,0x41,0x18,0xA1,0x20,0xA2,0x28,0x81,0x18,0x40,0x08,0x60,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xAE,0x73,0xE3,0x18,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x61,0x10,0xA1,0x18,0xC2,0x20,0x81,0x18,0x61,0x10,0x60,0x10,0x61,0x10,0x40,0x20,0xC3,0x48,0x24,0x71,0x84,0x89,0xA7,0xBA,0x67,0xAA,0x67,0xAA,
-	0x64,0x89,0x03,0x71,0x84,0x89,0x44,0x81,0x29,0xC3,0x4A,0xC3,0xE3,0x60,0xC5,0x89,0x2D,0xD4,0xCF,0xDC,0xE9,0xB2,0xC6,0x79,0x85,0x69,0xC6,0x79,0xC6,0x81,0x06,0x9A,0x88,0xA2,0x27,0x92,0x43,0x61,0x03,0x41,0x03,0x41,0xA1,0x30,0x44,0x59,0x27,0x8A,0x68,0x92,0x47,0x72,0x65,0x51,0xE3,0x28,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xBE,0xF7,0xF7,0xBD,0xC7,0x39,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x18,0x00,0x00,0xA1,0x18,0x03,0x39,0x24,0x41,0x23,0x39,0xA2,0x20,0x20,0x08,0x81,0x20,0x24,0x59,0xE3,0x50,0xC2,0x50,0x03,0x71,0x47,0xA2,0x06,0xA2,0x67,0xAA,
-	0x84,0x91,0xE3,0x60,0xC2,0x40,0xC3,0x58,0x43,0x79,0x43,0x61,0xA2,0x40,0xE2,0x40,0xA4,0x71,0x06,0x82,0x43,0x59,0xE2,0x38,0xE2,0x38,0x03,0x49,0x03,0x41,0x65,0x59,0x86,0x69,0x64,0x61,0x23,0x61,0x47,0x92,0x68,0x92,0x85,0x69,0x85,0x71,0x2A,0xBB,0x6E,0xD4,0xF0,0xDC,0xE9,0xB2,0xA6,0x61,0x41,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xFF,0xFF,0xFB,0xDE,
-	0xEB,0x5A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x03,0x31,0x65,0x59,0x64,0x41,0x24,0x39,0x24,0x41,0xA2,0x28,0x81,0x20,0x23,0x59,0x64,0x89,0x03,0x69,0xE2,0x58,0xA2,0x48,0xA2,0x50,0x44,0x79,
-	0x64,0x89,0x43,0x71,0xC1,0x48,0xA1,0x40,0x03,0x69,0x23,0x61,0x82,0x38,0x61,0x28,0xA2,0x28,0xA1,0x38,0x80,0x28,0xA2,0x20,0xE3,0x30,0x23,0x39,0xE3,0x30,0xE3,0x30,0xE3,0x28,0x81,0x18,0xE2,0x38,0xA9,0x9A,0x88,0x9A,0xA6,0x59,0xE3,0x40,0x88,0x92,0x4A,0xC3,0x0D,0xCC,0x09,0xB3,0xC6,0x69,0x60,0x18,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x38,0xC6,0xB2,0x94,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x6D,0x6B,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x08,0x61,0x10,0xC2,0x28,0x44,0x39,0xC6,0x69,0xA6,0x69,0xA5,0x69,0x48,0x8A,0x06,0x82,0x83,0x61,0xE3,0x58,0x03,0x69,0xE3,0x60,0x81,0x30,0x40,0x18,0x40,0x18,0x41,0x28,
-	0xE2,0x58,0x64,0x89,0xE5,0x99,0x84,0x71,0x43,0x69,0x03,0x59,0xC3,0x50,0xC1,0x38,0x61,0x20,0x61,0x18,0xA1,0x20,0xA1,0x28,0xE2,0x38,0x44,0x41,0x24,0x41,0x03,0x31,0xA1,0x20,0x20,0x08,0x40,0x18,0x64,0x59,0x85,0x69,0xE3,0x38,0x40,0x18,0xC2,0x30,0x24,0x59,0x85,0x69,0x64,0x59,0xC2,0x30,0x40,0x18,0x40,0x10,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x8D,0x6B,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x81,0x18,0x23,0x39,0x44,0x51,0xC6,0x79,0x68,0x8A,0x47,0x92,0xAB,0xCB,0xAB,0xCB,0x07,0xA3,0x02,0x51,0xE2,0x48,0xE3,0x38,0x61,0x20,0x60,0x18,0x60,0x18,0x61,0x18,
-	0xA1,0x28,0x23,0x61,0x06,0xA2,0x26,0xA2,0x84,0x89,0xE1,0x40,0xC1,0x30,0x63,0x69,0x43,0x61,0x61,0x20,0x60,0x18,0x80,0x20,0xA1,0x28,0x02,0x39,0x03,0x41,0x23,0x49,0x64,0x59,0x03,0x39,0x40,0x10,0x80,0x18,0xA1,0x28,0x61,0x18,0x41,0x10,0x40,0x10,0x61,0x18,0x61,0x20,0x81,0x20,0x61,0x20,0x81,0x20,0x60,0x18,0x60,0x10,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xC6,0xA2,0x10,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x31,0x65,0x39,0x40,0x10,0xA1,0x20,0x23,0x41,0x44,0x49,0x65,0x59,0xA5,0x61,0x85,0x69,0xC8,0xAA,0x8B,0xCB,0x29,0xC3,0x24,0x61,0x61,0x30,0x60,0x20,0x60,0x18,0xA1,0x28,0xE2,0x38,0xE2,0x38,
-	0x02,0x39,0x04,0x6A,0x83,0x79,0x64,0x81,0x46,0xA2,0x21,0x49,0xE1,0x30,0xC9,0xAB,0xCF,0xD4,0xC4,0x51,0x60,0x18,0x40,0x10,0x60,0x10,0x81,0x20,0xC1,0x28,0x63,0x61,0x2A,0xAB,0x6C,0xAB,0x03,0x31,0x20,0x10,0x60,0x18,0x61,0x18,0x40,0x10,0x20,0x08,0x40,0x08,0x60,0x10,0x60,0x10,0xA1,0x28,0x63,0x59,0x02,0x59,0x60,0x28,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x4D,0x6B,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x49,0x4A,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x28,0xA2,0x28,0xA1,0x20,0x81,0x20,0xE2,0x28,0x43,0x39,0x65,0x51,0x44,0x51,0xA2,0x30,0x43,0x51,0x4A,0xB3,0x06,0x8A,0xA2,0x30,0x81,0x28,0x81,0x20,0xA1,0x28,0xC1,0x30,0xE2,0x38,0xE2,0x30,
-	0xE5,0x71,0x70,0xDD,0xAC,0xBC,0xA4,0x71,0x4E,0xCC,0xE5,0x81,0x42,0x59,0xF3,0xD5,0x57,0xF7,0x2A,0xAB,0xA1,0x30,0x61,0x18,0x40,0x10,0x40,0x08,0x40,0x10,0x23,0x49,0x0D,0xD4,0xD3,0xF5,0xE9,0x9A,0x60,0x18,0x20,0x10,0x60,0x18,0x60,0x18,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x08,0x03,0x39,0x8B,0xB3,0x0A,0xB3,0x03,0x49,0x81,0x18,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE3,0x18,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xB2,0x94,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x18,0x80,0x18,0x60,0x18,0x60,0x18,0xC2,0x30,0xA1,0x28,0x03,0x41,0x85,0x69,0xA6,0x71,0x23,0x41,0xC2,0x48,0x23,0x71,0xC2,0x50,0x02,0x49,0xE2,0x50,0xC1,0x38,0xC1,0x38,0xC0,0x28,0xC1,0x30,0xA1,0x20,
-	0xC4,0x51,0x73,0xE6,0x54,0xE6,0x05,0x6A,0xA3,0x51,0x86,0x82,0x25,0x9A,0xD4,0xEE,0xD5,0xEE,0x46,0x9A,0xC2,0x48,0xC2,0x30,0xC1,0x28,0x60,0x10,0x20,0x08,0x61,0x18,0xC9,0x92,0x31,0xE5,0xAC,0xBB,0xE3,0x30,0x40,0x08,0x20,0x08,0x20,0x10,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x30,0x29,0xA3,0x6B,0xBB,0x03,0x51,0xC1,0x28,
-	0x40,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x51,0xA1,0x20,0xA0,0x18,0x02,0x31,0x68,0x93,0xCD,0xC4,0x6E,0xC4,0x09,0xA3,0x27,0x92,0x07,0x92,0x84,0x89,0x47,0x9A,0x06,0x8A,0x03,0x61,0x23,0x61,0x63,0x69,0x49,0xA3,0xA9,0x9B,0xA9,0x8A,0x81,0x18,
-	0x23,0x41,0x0F,0xC5,0xD7,0xEE,0x29,0x8B,0xE2,0x28,0x01,0x31,0xC4,0x79,0xCA,0xBB,0xE7,0x9A,0xC1,0x40,0xA2,0x48,0xA1,0x28,0xA1,0x28,0xA0,0x20,0x80,0x18,0x40,0x10,0xC2,0x30,0x07,0x72,0xE6,0x69,0xC1,0x28,0x60,0x18,0x20,0x00,0x20,0x08,0x20,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x60,0x08,0x23,0x31,0x03,0x31,0x81,0x20,0xC2,0x30,
-	0xA1,0x28,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x8A,0x52,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xCA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0xDE,0x85,0x72,0x02,0x39,0x22,0x39,0xA3,0x61,0xB1,0xE5,0x99,0xF7,0x99,0xF7,0xF2,0xED,0x29,0xC3,0x09,0xC3,0x67,0xB2,0xA5,0x91,0x83,0x71,0x23,0x59,0x42,0x49,0x83,0x61,0x72,0xDE,0x15,0xEF,0xC7,0x7A,0x60,0x18,
-	0x63,0x41,0x2E,0xC5,0xBA,0xFF,0x0F,0xBD,0x03,0x49,0xA2,0x20,0xC6,0x69,0xA4,0x79,0xA4,0x79,0x42,0x61,0x23,0x59,0x43,0x59,0x20,0x18,0x61,0x18,0xA1,0x20,0x81,0x20,0x80,0x18,0x60,0x18,0x80,0x18,0x81,0x18,0xA1,0x20,0x60,0x10,0x40,0x08,0x20,0x08,0x40,0x10,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0xA1,0x30,
-	0xC1,0x30,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x7A,0x23,0x39,0xC1,0x20,0xE2,0x28,0x43,0x51,0x4B,0xBC,0x36,0xF7,0x16,0xEF,0xB2,0xED,0x29,0xCB,0x29,0xCB,0x06,0xA2,0x26,0x9A,0x84,0x69,0x22,0x49,0xE0,0x30,0x00,0x31,0x4D,0xC5,0x56,0xF7,0x0A,0xA4,0x43,0x49,
-	0x4E,0xC5,0x37,0xF7,0x99,0xF7,0x4E,0xBC,0x23,0x41,0x03,0x29,0x65,0x51,0x23,0x41,0x83,0x59,0x47,0xA3,0x29,0x9B,0xD3,0xE5,0xC2,0x30,0x60,0x18,0xA1,0x20,0x81,0x20,0x80,0x18,0xA1,0x18,0x40,0x10,0x20,0x10,0x80,0x18,0xA1,0x20,0x60,0x18,0x40,0x08,0x40,0x10,0x40,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC1,0x28,
-	0xC1,0x30,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x34,0xA5,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x18,0xA1,0x18,0x61,0x20,0xE3,0x28,0x23,0x41,0x44,0x59,0x84,0x69,0x88,0x9A,0xE8,0xAA,0x29,0xC3,0x67,0xB2,0x67,0xB2,0xA4,0x91,0xA4,0x71,0x62,0x49,0xE1,0x30,0xE1,0x20,0xC1,0x28,0xE3,0x59,0x28,0x83,0x03,0x62,0x83,0x61,
-	0x72,0xDE,0x78,0xFF,0x0D,0xC5,0x06,0x72,0xE6,0x69,0x24,0x31,0x44,0x41,0x08,0x72,0x65,0x61,0x66,0xA2,0x8B,0xC4,0xF6,0xEE,0x8B,0xA3,0x68,0x8B,0xCD,0xAC,0x84,0x49,0x40,0x18,0x81,0x20,0xA1,0x20,0x81,0x20,0x60,0x18,0xA1,0x20,0xA1,0x20,0x61,0x18,0x60,0x10,0x60,0x18,0x40,0x18,0x40,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x81,0x18,
-	0xC1,0x30,0x81,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x42,0x9D,0xEF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x20,0xC1,0x28,0xE1,0x30,0x43,0x49,0xE6,0x81,0x27,0x92,0x67,0x9A,0x26,0xAA,0xA5,0x99,0xA5,0x99,0x06,0xA2,0x87,0xBA,0x47,0xA2,0xA4,0x71,0x43,0x59,0x43,0x41,0xE2,0x30,0xE1,0x28,0xE1,0x28,0xC1,0x28,0xA0,0x20,0xA0,0x20,0xA1,0x28,
-	0xC6,0x72,0x6D,0xBC,0x06,0x7A,0x86,0x7A,0xEC,0xB3,0xA4,0x59,0x63,0x41,0x65,0x51,0xC6,0x71,0x48,0xAB,0xAE,0xCC,0x91,0xDD,0x0A,0xB4,0xAB,0xB4,0x76,0xF7,0xC8,0x72,0x40,0x18,0x61,0x18,0x61,0x20,0xA1,0x28,0xC2,0x30,0x02,0x39,0xE2,0x38,0xC1,0x28,0x60,0x20,0x80,0x18,0x81,0x20,0x81,0x18,0x40,0x10,0x20,0x08,0x80,0x18,0x03,0x49,
-	0x43,0x51,0xA1,0x30,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x79,0xCE,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x42,0x41,0x41,0x41,0x85,0x61,0x88,0xA2,0xA7,0xBA,0xC8,0xC2,0x2D,0xD4,0xE5,0xA1,0xA5,0x99,0x84,0x81,0x83,0x71,0x83,0x59,0x64,0x59,0x43,0x49,0x02,0x31,0xC1,0x18,0x80,0x20,0xA0,0x20,0xA1,0x20,0xC1,0x20,0xC1,0x20,0x80,0x20,
-	0xA0,0x18,0xE2,0x28,0xE2,0x30,0x85,0x61,0xC5,0x69,0xC4,0x71,0x88,0x9A,0x27,0x8A,0xA6,0x71,0xC5,0x79,0x83,0x61,0x04,0x72,0xA8,0xAB,0x6E,0xCD,0x94,0xE6,0xA3,0x51,0x81,0x20,0x61,0x18,0x60,0x18,0x81,0x20,0x24,0x41,0x64,0x61,0x44,0x59,0x23,0x51,0xC2,0x30,0x60,0x20,0x81,0x18,0xA1,0x20,0x81,0x20,0x60,0x18,0x64,0x51,0x47,0x92,
-	0x47,0x9A,0xE2,0x50,0x60,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x61,0x83,0x59,0x42,0x49,0xE2,0x38,0x22,0x51,0xC5,0x79,0x06,0x9A,0x06,0x9A,0xC5,0x89,0x03,0x61,0xA8,0xA2,0xE1,0x38,0xA1,0x28,0xC2,0x28,0xE2,0x28,0x24,0x41,0xA2,0x20,0x40,0x10,0x20,0x08,0x40,0x08,0x85,0x41,0x40,0x10,0x60,0x18,0x61,0x20,
-	0x40,0x18,0x40,0x10,0x81,0x18,0xA2,0x28,0x03,0x39,0x23,0x39,0xE5,0x71,0x68,0x92,0xC6,0x81,0x85,0x71,0x43,0x41,0x03,0x39,0xE5,0x81,0xB0,0xDD,0xAD,0xB4,0xA0,0x20,0x81,0x20,0xA1,0x20,0x80,0x20,0xC1,0x20,0x24,0x49,0x24,0x49,0x44,0x51,0x23,0x51,0x43,0x51,0xE1,0x38,0x60,0x18,0x81,0x18,0xA0,0x28,0xA1,0x20,0x85,0x61,0x88,0x9A,
-	0xA8,0xAA,0x44,0x51,0x61,0x18,0xA1,0x20,0xA1,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDE,0xF7,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x61,0x26,0x8A,0xC5,0x79,0x02,0x41,0xA2,0x30,0xE2,0x40,0x23,0x51,0x23,0x59,0xC1,0x40,0x03,0x59,0x81,0x30,0x60,0x18,0x40,0x10,0x61,0x18,0x61,0x10,0x40,0x10,0xA1,0x20,0x61,0x18,0x20,0x08,0x20,0x18,0x45,0x39,0xA2,0x28,0xA2,0x20,0x61,0x18,
-	0x81,0x28,0x61,0x30,0x20,0x10,0x82,0x20,0x81,0x18,0xC3,0x38,0x03,0x41,0x64,0x51,0xA4,0x61,0x26,0x8A,0xE6,0x79,0xA6,0x61,0xA4,0x51,0x4F,0xCD,0x6A,0xBC,0xC3,0x59,0xA0,0x20,0x60,0x10,0xA1,0x18,0xC1,0x20,0x23,0x39,0x23,0x41,0x24,0x41,0x64,0x51,0x8C,0xBC,0x0A,0xB4,0xA1,0x28,0x61,0x18,0x60,0x18,0x80,0x20,0x85,0x51,0x07,0x82,
-	0x06,0x8A,0x23,0x59,0xE3,0x50,0x2A,0xA3,0x2A,0xA3,0xA2,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x38,0xC6,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x18,0xA4,0x59,0xA8,0xA2,0x6A,0xCB,0x06,0x9A,0x03,0x61,0xE2,0x40,0xA2,0x38,0x61,0x30,0x81,0x20,0xE3,0x48,0x61,0x28,0x81,0x20,0x61,0x18,0x40,0x18,0x61,0x18,0x81,0x18,0x81,0x28,0x0B,0x93,0x03,0x41,0x03,0x39,0x61,0x20,0x20,0x10,0x20,0x10,0x40,0x10,
-	0x03,0x29,0x24,0x49,0x86,0x51,0x65,0x41,0x20,0x08,0x61,0x10,0xA2,0x30,0xE3,0x30,0xE2,0x28,0xE6,0x61,0x48,0x8A,0x47,0x92,0x64,0x49,0xC6,0x69,0x0B,0xCC,0xE8,0xAA,0x62,0x49,0x80,0x18,0x60,0x08,0x40,0x10,0xE2,0x30,0x23,0x39,0x03,0x39,0x44,0x59,0x32,0xE6,0x2E,0xC5,0xE1,0x38,0x81,0x20,0x60,0x18,0xC1,0x30,0xA5,0x71,0xE7,0x81,
-	0x27,0x92,0x09,0xAB,0xA8,0xA2,0x2D,0xCC,0x6D,0xBC,0x02,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x5C,0xE7,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x30,0xC4,0x79,0x29,0xCB,0x4A,0xC3,0xC5,0x89,0xC3,0x58,0xE2,0x48,0x03,0x41,0x61,0x28,0x61,0x18,0x60,0x18,0x60,0x18,0x41,0x18,0x21,0x18,0x41,0x18,0x40,0x10,0x40,0x10,0x20,0x10,0xC3,0x28,0x20,0x10,0x40,0x10,0x41,0x10,0x60,0x10,0x40,0x10,0x82,0x18,
-	0x44,0x31,0x40,0x10,0xC2,0x40,0x41,0x20,0x40,0x10,0x20,0x08,0x40,0x08,0x81,0x28,0xA2,0x28,0xEE,0x8B,0x44,0x51,0xE7,0x79,0xA8,0x92,0xE6,0x69,0xB7,0xEE,0xAC,0xCC,0x43,0x61,0x82,0x51,0xA1,0x20,0x20,0x08,0x60,0x10,0xC1,0x28,0xE2,0x30,0x63,0x61,0xC6,0x82,0x42,0x41,0x80,0x20,0xC2,0x30,0x81,0x20,0xC2,0x38,0x07,0x8A,0x27,0x8A,
-	0x09,0xAB,0x4D,0xD4,0x2A,0xC3,0xC5,0x71,0x63,0x41,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xB6,0xB5,0xAA,0x52,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x8E,0x73,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7B,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x9A,0x23,0x71,0x84,0x89,0xE5,0x91,0xA5,0x89,0x03,0x49,0x81,0x28,0x61,0x20,0x40,0x18,0x81,0x28,0xA2,0x30,0x62,0x20,0x40,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x61,0x18,0xC2,0x30,0xA1,0x28,0x61,0x18,0x20,0x10,0x40,0x10,0x41,0x10,0x40,0x10,0x40,0x10,0x61,0x18,
-	0x40,0x10,0x40,0x08,0x81,0x28,0x23,0x59,0x81,0x18,0x41,0x18,0x81,0x18,0x61,0x18,0xA2,0x30,0x61,0x28,0x82,0x30,0x45,0x51,0x4F,0xBC,0xE6,0x81,0x68,0x7A,0xE6,0x92,0xAD,0xBC,0xA3,0x51,0x83,0x51,0xE2,0x30,0x41,0x18,0x41,0x18,0x01,0x31,0x4E,0xBD,0x2E,0xBD,0x81,0x20,0x20,0x10,0x81,0x28,0xC1,0x30,0xC1,0x30,0x85,0x61,0xE6,0x81,
-	0x26,0x82,0x67,0x92,0xA5,0x69,0x80,0x28,0x60,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xA2,0x26,0xA2,0x64,0x81,0xE2,0x50,0x82,0x30,0x61,0x20,0x60,0x18,0x60,0x18,0x81,0x18,0x61,0x18,0x40,0x18,0x40,0x10,0x61,0x20,0x61,0x18,0x20,0x10,0x20,0x10,0x23,0x51,0x81,0x30,0x20,0x10,0x61,0x18,0x61,0x18,0x20,0x10,0x40,0x08,0x20,0x08,0x20,0x08,0x40,0x08,
-	0x61,0x10,0x61,0x18,0x41,0x20,0x61,0x30,0x81,0x20,0x40,0x10,0x20,0x08,0x20,0x08,0x44,0x31,0x48,0x6A,0xA2,0x30,0xE2,0x30,0x24,0x49,0x23,0x59,0x23,0x59,0xC1,0x30,0xD1,0xDD,0xA7,0x92,0x21,0x41,0x42,0x59,0x02,0x39,0xA1,0x28,0x02,0x39,0x53,0xDE,0xB4,0xDE,0x02,0x29,0x20,0x08,0x40,0x10,0xA2,0x28,0xA1,0x28,0xC1,0x28,0x23,0x41,
-	0xE2,0x40,0xC1,0x30,0x80,0x18,0x81,0x20,0x80,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xC3,0x6A,0xCB,0x06,0x9A,0xC2,0x38,0x61,0x18,0x61,0x18,0x40,0x18,0x40,0x18,0x60,0x18,0x61,0x18,0x60,0x18,0x61,0x18,0x61,0x18,0x81,0x18,0xA1,0x28,0x44,0x51,0xE3,0x40,0x40,0x10,0x20,0x08,0x20,0x10,0x20,0x10,0x41,0x10,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x00,0x40,0x08,0x61,0x18,0xA1,0x20,0x20,0x08,0x20,0x08,0x41,0x10,0x41,0x10,0x81,0x20,0x61,0x20,0x82,0x28,0xC3,0x40,0xEE,0x93,0xC2,0x28,0xE1,0x40,0x06,0x9A,0xA4,0x89,0x41,0x41,0xE3,0x59,0x2B,0xA4,0xE1,0x38,0x4A,0xA4,0x97,0xF7,0xE6,0x7A,0x60,0x18,0x40,0x08,0xE1,0x30,0xC2,0x38,0xA1,0x28,0x80,0x20,
-	0xE2,0x38,0x01,0x31,0x60,0x18,0x80,0x18,0x80,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xC2,0xC8,0xC2,0x67,0xAA,0x03,0x49,0x81,0x20,0x61,0x20,0x61,0x20,0xA2,0x28,0x81,0x28,0x40,0x18,0x40,0x10,0x20,0x10,0x40,0x10,0x60,0x10,0x60,0x18,0x81,0x18,0x64,0x39,0x85,0x49,0x40,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x41,0x10,0x40,0x10,0x20,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x20,0x81,0x20,0x40,0x10,0x20,0x08,0x20,0x08,0x40,0x08,0x81,0x20,0x81,0x20,0x61,0x20,0x81,0x28,0x81,0x28,0x81,0x28,0x23,0x59,0xC6,0x92,0x82,0x49,0x44,0x62,0xAF,0xD5,0xE5,0x82,0xE9,0xA3,0x57,0xEF,0xCA,0x9B,0x42,0x41,0x27,0x83,0xD2,0xCD,0x05,0x6A,0xC1,0x38,0xA2,0x30,
-	0xC2,0x40,0x43,0x61,0x81,0x20,0xA1,0x28,0x81,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x81,0x47,0xA2,0x88,0xA2,0x06,0x82,0xE4,0x48,0x81,0x28,0x81,0x30,0xE2,0x38,0x81,0x20,0x61,0x20,0xA2,0x20,0x40,0x10,0x40,0x08,0x20,0x08,0x40,0x10,0xA2,0x28,0xC2,0x28,0x82,0x20,0x81,0x20,0x61,0x18,0x61,0x10,0x40,0x10,0x28,0x5A,0x45,0x31,0x20,0x08,0x20,0x10,0x61,0x10,
-	0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x20,0x61,0x20,0xC2,0x20,0x61,0x10,0x00,0x08,0x40,0x10,0xE2,0x30,0x70,0x9C,0x20,0x18,0x20,0x10,0x21,0x10,0x09,0x7B,0xF3,0xD5,0xA3,0x49,0x22,0x41,0xA3,0x49,0xD8,0xFF,0xED,0xB4,0xE4,0x69,0x21,0x41,0x84,0x61,0xB2,0xC5,0x99,0xF7,0x66,0x72,0xE2,0x38,0x03,0x41,
-	0xE1,0x48,0x43,0x79,0x22,0x49,0x02,0x49,0xE2,0x38,0x80,0x10,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFB,0xDE,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0x81,0x07,0x82,0xA5,0x71,0x23,0x69,0xC3,0x40,0xA2,0x38,0x81,0x28,0x61,0x18,0x60,0x10,0x40,0x10,0x45,0x39,0x20,0x10,0x41,0x10,0x81,0x18,0x81,0x20,0xC2,0x28,0xC3,0x30,0xE3,0x30,0xC2,0x28,0xC2,0x20,0x20,0x08,0x40,0x08,0x61,0x10,0x61,0x10,0x40,0x08,0x20,0x08,0x20,0x08,
-	0x40,0x08,0x40,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x08,0x60,0x10,0x85,0x49,0x61,0x10,0x69,0x52,0x40,0x08,0xD2,0xA4,0x45,0x49,0x40,0x20,0x20,0x00,0x00,0x00,0x81,0x18,0xB4,0xCD,0x88,0x82,0x01,0x39,0x03,0x62,0x52,0xD6,0x87,0x62,0x22,0x41,0x84,0x49,0x83,0x51,0x47,0x8B,0x48,0x83,0xA1,0x28,0xC2,0x30,0x43,0x59,
-	0x43,0x61,0x43,0x79,0x46,0xA2,0x2D,0xCC,0x88,0xA2,0x44,0x51,0x45,0x49,0xE3,0x30,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,
-	0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x49,0x4A,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x5A,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x79,0xE6,0x81,0x04,0x61,0x44,0x59,0x25,0x49,0x41,0x20,0x61,0x18,0x60,0x10,0x40,0x10,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x60,0x10,0xA2,0x28,0x03,0x39,0xC3,0x30,0xA2,0x28,0xAA,0x6A,0xE3,0x28,0x40,0x10,0x20,0x08,0x20,0x08,0x61,0x10,0x81,0x10,0x40,0x10,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x61,0x18,0x85,0x49,0x65,0x39,0x40,0x10,0x23,0x29,0xE6,0x71,0xE2,0x48,0x81,0x18,0x20,0x00,0x20,0x08,0xE5,0x51,0x73,0xBD,0xE1,0x30,0x44,0x6A,0x53,0xDE,0x63,0x39,0x81,0x10,0x22,0x31,0x45,0x72,0x83,0x51,0x21,0x31,0x81,0x20,0xEA,0x9B,0xAA,0xAB,
-	0x64,0x69,0x43,0x79,0xE9,0xB2,0x15,0xEE,0xCC,0xBB,0xE6,0x79,0xA5,0x71,0x65,0x59,0xC2,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x61,0x07,0x82,0x88,0x9A,0x64,0x69,0xA2,0x30,0x82,0x28,0x61,0x20,0x81,0x18,0x61,0x10,0x60,0x10,0x20,0x08,0x20,0x08,0x40,0x08,0x40,0x10,0x40,0x10,0x81,0x20,0xC3,0x38,0x03,0x39,0x03,0x39,0xC3,0x30,0xA2,0x20,0x41,0x10,0x40,0x10,0x40,0x08,0x20,0x08,0x60,0x08,0x20,0x10,0x40,0x10,
-	0x40,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x10,0x61,0x10,0x60,0x10,0x40,0x10,0x60,0x10,0x61,0x18,0x61,0x18,0x81,0x18,0xA2,0x28,0xA5,0x69,0xA1,0x30,0x40,0x18,0x20,0x00,0x20,0x10,0xA1,0x20,0x02,0x31,0x64,0x49,0xE4,0x51,0x32,0xD6,0xA4,0x41,0x20,0x08,0xA1,0x18,0xE4,0x59,0xE3,0x61,0x84,0x59,0x44,0x6A,0xBA,0xF7,0x93,0xDE,
-	0x64,0x51,0x43,0x59,0x08,0xA3,0xD2,0xED,0x6C,0xCC,0x67,0xA2,0x07,0x82,0xC9,0x9A,0xA5,0x69,0xA2,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x51,0x06,0x82,0xA5,0x79,0xE3,0x48,0xA2,0x28,0x61,0x28,0xA2,0x28,0xA2,0x28,0xA2,0x28,0x81,0x20,0x41,0x18,0x40,0x10,0x41,0x10,0x41,0x18,0x81,0x18,0xA1,0x20,0xC2,0x28,0xA3,0x28,0xA2,0x28,0xE3,0x28,0xA2,0x20,0x61,0x18,0xE3,0x30,0x24,0x39,0x61,0x20,0x40,0x10,0x20,0x10,0x40,0x10,
-	0x40,0x08,0x61,0x08,0x20,0x08,0x20,0x08,0x40,0x10,0x40,0x18,0x81,0x28,0x81,0x20,0x61,0x10,0x41,0x08,0x61,0x18,0x03,0x29,0xE2,0x30,0xE6,0x61,0xC1,0x20,0xC2,0x20,0x00,0x00,0x00,0x00,0x80,0x10,0x70,0x94,0xC9,0x7A,0xC5,0x51,0x83,0x41,0x61,0x49,0xC3,0x39,0xE9,0x5A,0xC1,0x28,0x83,0x51,0x83,0x49,0x08,0x8B,0x14,0xDE,0xCB,0x93,
-	0x64,0x49,0xC4,0x71,0xAD,0xCC,0x92,0xED,0x11,0xDE,0xB2,0xE5,0x26,0x92,0x88,0x9A,0xA6,0x69,0x24,0x41,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x30,0xE2,0x48,0xE3,0x48,0x81,0x30,0xA1,0x28,0xA2,0x28,0x02,0x31,0x44,0x49,0x03,0x31,0xE3,0x30,0xA1,0x20,0x40,0x10,0x40,0x10,0x40,0x10,0x61,0x10,0x21,0x10,0x81,0x18,0xA2,0x18,0x81,0x18,0x61,0x10,0xA2,0x20,0x61,0x10,0x20,0x08,0x60,0x10,0x60,0x18,0xC2,0x28,0x41,0x18,0x40,0x08,
-	0x20,0x08,0x20,0x10,0x60,0x10,0xA2,0x28,0x61,0x20,0xC2,0x20,0x03,0x39,0x25,0x41,0x24,0x49,0xC2,0x28,0x81,0x18,0xE2,0x28,0x24,0x49,0xB1,0xAC,0x82,0x20,0xE2,0x28,0x60,0x08,0x00,0x00,0x40,0x08,0x23,0x31,0x49,0x7B,0xA9,0x6A,0xE4,0x69,0xC5,0x82,0x16,0xE7,0x18,0xE7,0xA1,0x20,0x64,0x49,0x83,0x51,0x84,0x51,0x85,0x72,0xC5,0x61,
-	0x45,0x41,0xC6,0x71,0xAD,0xCC,0xAD,0xCC,0x11,0xDE,0x52,0xE6,0x64,0x79,0x85,0x69,0x85,0x69,0x65,0x61,0x81,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x7A,0x81,0x28,0xC2,0x38,0x02,0x49,0xC2,0x40,0xA2,0x30,0xC3,0x38,0x28,0x62,0xC6,0x51,0xE2,0x28,0xE3,0x30,0xC2,0x28,0x40,0x18,0x40,0x10,0x40,0x10,0x60,0x10,0x40,0x10,0x20,0x10,0x40,0x08,0x40,0x00,0x23,0x21,0x00,0x00,0x41,0x10,0x61,0x10,0x20,0x08,0x40,0x10,0x20,0x08,0x81,0x20,0xAD,0x83,
-	0x40,0x08,0x40,0x08,0x81,0x10,0xC2,0x18,0xC3,0x28,0xE2,0x28,0xC2,0x28,0xC2,0x28,0x03,0x39,0xC2,0x28,0xE3,0x28,0xE3,0x30,0x04,0x49,0xE3,0x48,0x82,0x20,0x81,0x18,0x81,0x18,0x20,0x00,0x20,0x08,0xA2,0x20,0xC2,0x30,0x63,0x59,0x29,0xB4,0xD0,0xD5,0xFC,0xF7,0xD0,0xCD,0x22,0x31,0x64,0x41,0xC7,0x72,0x89,0x8B,0x44,0x62,0x85,0x7A,
-	0x23,0x31,0xE3,0x28,0x25,0x82,0x0B,0xCC,0x11,0xDE,0x56,0xF7,0x4D,0xCC,0x24,0x51,0xC6,0x79,0x68,0x92,0x65,0x51,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x41,0xC3,0x40,0xC2,0x38,0x44,0x49,0xA2,0x38,0x80,0x18,0x82,0x20,0xA2,0x30,0x03,0x39,0x03,0x39,0xE3,0x38,0xE3,0x30,0xA2,0x30,0xA2,0x28,0x40,0x10,0x81,0x18,0x41,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0xA6,0x31,0x00,0x00,0x20,0x00,0x60,0x10,0x41,0x10,0x20,0x10,0x40,0x08,0x20,0x08,0x81,0x10,
-	0x61,0x10,0x81,0x10,0xA2,0x18,0xA2,0x18,0xC3,0x20,0x45,0x41,0x24,0x31,0xE2,0x20,0xC2,0x28,0x24,0x39,0xA1,0x20,0xA2,0x20,0xA1,0x20,0x85,0x61,0xA9,0x82,0xA2,0x18,0x40,0x10,0x81,0x18,0x20,0x08,0x81,0x10,0xE3,0x30,0xC7,0x7A,0x57,0xEF,0x93,0xE6,0x77,0xF7,0x6B,0xA4,0x62,0x41,0xC1,0x28,0x4D,0x9C,0xB9,0xF7,0x48,0x8B,0xA4,0x51,
-	0x63,0x41,0xA1,0x20,0xC9,0x8A,0xF6,0xF6,0xB9,0xF7,0x78,0xFF,0x10,0xD5,0x02,0x51,0x68,0x92,0x0D,0xCC,0x0A,0x93,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x49,0x03,0x51,0xC2,0x40,0x44,0x49,0x03,0x41,0xA2,0x30,0x81,0x28,0xE2,0x30,0x02,0x31,0xC2,0x28,0xE2,0x28,0xA1,0x18,0x60,0x10,0xA1,0x20,0x82,0x20,0x41,0x10,0x40,0x10,0x40,0x08,0x40,0x08,0x40,0x08,0x20,0x08,0x03,0x21,0x61,0x10,0x20,0x08,0x40,0x10,0x40,0x10,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x81,0x10,0xA2,0x20,0xE3,0x20,0xC2,0x18,0xE2,0x20,0xE3,0x30,0x89,0x6A,0xE3,0x28,0x27,0x52,0x24,0x31,0x03,0x31,0xA2,0x20,0xE3,0x28,0x81,0x20,0xE7,0x61,0x60,0x10,0x40,0x10,0x61,0x18,0x80,0x18,0x41,0x10,0xA1,0x20,0xE7,0x7A,0xBB,0xF7,0x78,0xEF,0x18,0xE7,0x57,0xF7,0x86,0x6A,0xA0,0x20,0x86,0x62,0x33,0xCE,0x42,0x39,0xC2,0x28,
-	0x63,0x41,0x81,0x10,0xE6,0x59,0x34,0xE6,0xF6,0xF6,0xB2,0xE5,0xC5,0x89,0xC1,0x38,0x07,0x7A,0x6B,0xC3,0xEA,0x9A,0x61,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x81,0x28,0x81,0x28,0xE3,0x40,0x24,0x49,0x61,0x28,0x81,0x28,0xA2,0x30,0x61,0x20,0xE2,0x38,0xE2,0x30,0x45,0x49,0x82,0x28,0x60,0x10,0x20,0x10,0x20,0x10,0x40,0x10,0x40,0x18,0x60,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x41,0x61,0x10,0x40,0x10,0xA1,0x18,0xC2,0x20,0x61,0x10,0x60,0x10,0x00,0x00,
-	0x60,0x08,0xC2,0x20,0x28,0x62,0xC2,0x20,0xC2,0x20,0xE3,0x28,0x68,0x62,0xC3,0x30,0xA6,0x41,0xA2,0x20,0xE3,0x30,0xE3,0x28,0xA6,0x39,0x61,0x10,0xA1,0x20,0xA2,0x28,0x00,0x00,0x41,0x10,0x81,0x20,0x61,0x20,0x64,0x39,0x63,0x49,0x18,0xEF,0x56,0xCE,0x85,0x31,0x46,0x5A,0x01,0x31,0xA6,0x72,0x20,0x10,0x84,0x41,0x80,0x18,0x60,0x10,
-	0x21,0x31,0x01,0x29,0x60,0x10,0x43,0x41,0x27,0x8A,0x6B,0xC4,0x85,0x82,0xA1,0x20,0x64,0x59,0xEC,0xC3,0xA8,0x92,0x61,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x9A,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x60,0x10,0x61,0x10,0x40,0x18,0x44,0x51,0x41,0x28,0x41,0x18,0x20,0x10,0x20,0x08,0x81,0x18,0xC2,0x28,0xE7,0x59,0x24,0x41,0xC2,0x28,0x61,0x20,0x61,0x18,0x61,0x18,0x61,0x18,0x40,0x18,0x81,0x18,0x40,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x10,0x40,0x10,0x61,0x18,0x61,0x10,
-	0x81,0x10,0x81,0x18,0xA1,0x20,0xE3,0x30,0xA2,0x20,0xC2,0x20,0x03,0x21,0xE3,0x28,0xA2,0x20,0xA1,0x18,0xA1,0x18,0xC3,0x28,0x20,0x08,0x20,0x08,0x60,0x10,0xD2,0xA4,0x0B,0x6B,0x81,0x18,0x61,0x18,0xA1,0x20,0x2C,0x7B,0x43,0x31,0x36,0xEF,0xB9,0xF7,0x41,0x39,0xC3,0x49,0xE4,0x61,0x82,0x49,0x41,0x31,0x21,0x29,0xC0,0x20,0x20,0x08,
-	0xCF,0xAC,0xF2,0xCD,0xE1,0x28,0x61,0x18,0x41,0x41,0xD1,0xDD,0x2F,0xD5,0xC4,0x61,0x67,0x8A,0xAC,0xBB,0xEA,0x9A,0xE2,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x10,0x61,0x10,0x40,0x20,0xE6,0x71,0x40,0x28,0xC2,0x28,0x40,0x10,0x20,0x08,0x40,0x10,0x81,0x18,0x44,0x31,0x44,0x29,0x20,0x08,0x41,0x18,0x41,0x18,0x81,0x18,0x61,0x10,0x40,0x10,0x20,0x08,0x40,0x10,0x61,0x18,0x21,0x10,0x00,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x00,0x00,
-	0x20,0x08,0x81,0x10,0xC2,0x20,0x03,0x31,0xE3,0x30,0xC2,0x28,0x81,0x18,0x61,0x10,0x81,0x18,0x81,0x18,0x60,0x08,0xEE,0x83,0x20,0x08,0x20,0x08,0x60,0x08,0xE2,0x28,0x68,0x5A,0x61,0x18,0x61,0x20,0x60,0x18,0xC2,0x20,0x41,0x08,0xA5,0x72,0x2A,0xAC,0x01,0x31,0x61,0x10,0xC0,0x20,0x80,0x18,0xA2,0x49,0x82,0x41,0x21,0x31,0x40,0x08,
-	0xD1,0xCD,0xF5,0xE6,0xE1,0x30,0xA1,0x28,0xA0,0x28,0x2A,0xAC,0x8B,0xC4,0xA8,0xB3,0x0B,0xC4,0xAB,0xD3,0x07,0x82,0x81,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x10,0x41,0x18,0x61,0x20,0x85,0x49,0x61,0x28,0xA6,0x51,0x61,0x20,0x82,0x20,0x60,0x20,0x03,0x31,0x41,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x44,0x29,0x20,0x10,0x40,0x10,0x20,0x08,0x40,0x08,0x20,0x00,0x40,0x00,0x23,0x21,0x2B,0x6B,0x40,0x10,0x60,0x10,0x40,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x40,0x08,
-	0x20,0x00,0x20,0x08,0x60,0x10,0x81,0x18,0xC2,0x28,0x03,0x39,0x81,0x20,0x41,0x10,0x20,0x08,0x40,0x08,0x60,0x10,0x00,0x00,0x81,0x10,0x00,0x00,0x00,0x00,0x61,0x10,0xE3,0x28,0x40,0x08,0x80,0x10,0xC1,0x20,0x80,0x10,0xA1,0x20,0xC8,0x6A,0x6A,0xBC,0x89,0x8B,0x23,0x29,0x40,0x08,0x80,0x10,0x4A,0x73,0x85,0x6A,0xA3,0x49,0xE2,0x30,
-	0x04,0x5A,0x65,0x5A,0x81,0x20,0xC2,0x30,0xC0,0x28,0xC2,0x59,0x08,0xAB,0xCC,0xC4,0x34,0xF6,0x4E,0xC4,0xA1,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x18,0x82,0x20,0x61,0x20,0x61,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0xC2,0x30,0xA2,0x38,0x85,0x51,0x40,0x10,0x61,0x10,0x61,0x10,0x20,0x10,0xC7,0x49,0x81,0x18,0x20,0x10,0x40,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x61,0x10,0x24,0x41,0x60,0x18,0x20,0x10,0x20,0x00,0x40,0x08,0x40,0x08,0x20,0x08,
-	0x40,0x10,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x40,0x08,0x81,0x18,0xA3,0x28,0x61,0x10,0x81,0x10,0x40,0x10,0x20,0x08,0x40,0x10,0xA2,0x20,0xA2,0x18,0xA2,0x20,0x24,0x39,0x40,0x08,0x20,0x00,0x20,0x00,0x40,0x08,0xC6,0x51,0x79,0xEF,0x5A,0xEF,0xDB,0xF7,0x8A,0x83,0xC1,0x18,0x21,0x29,0xB8,0xDE,0x18,0xE7,0x69,0x93,0xE4,0x59,
-	0x17,0xEF,0x75,0xDE,0xA1,0x28,0xC1,0x28,0x44,0x72,0x2E,0xC5,0xB3,0xE6,0xAE,0xD5,0x97,0xFF,0x4F,0xC5,0xC0,0x28,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x18,0x61,0x20,0x61,0x18,0x60,0x10,0x40,0x10,0x60,0x10,0x20,0x10,0x40,0x18,0x40,0x18,0x40,0x18,0xA2,0x18,0x61,0x18,0x61,0x18,0x41,0x20,0x40,0x10,0x41,0x10,0x61,0x18,0x61,0x18,0x82,0x18,0x81,0x10,0x40,0x08,0x60,0x08,0x82,0x18,0xC2,0x30,0x61,0x20,0xA2,0x20,0xCE,0x83,0x81,0x10,0x24,0x29,0x81,0x10,
-	0x81,0x10,0x40,0x10,0x20,0x00,0x20,0x08,0x40,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x60,0x10,0x61,0x10,0xA1,0x18,0xE6,0x51,0xE3,0x30,0xC2,0x20,0x61,0x10,0x81,0x10,0xE3,0x28,0x40,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x80,0x08,0x8A,0x8B,0xBC,0xF7,0x5A,0xEF,0xC8,0x62,0x01,0x29,0x28,0x6B,0x89,0x8B,0x75,0xD6,0x45,0x72,0xA8,0xAB,
-	0xF6,0xF6,0xAD,0xAC,0x00,0x39,0x63,0x51,0x72,0xDE,0xDA,0xFF,0xF6,0xE6,0x09,0xAC,0xD0,0xDD,0xCB,0xB3,0xE1,0x30,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x18,0x61,0x20,0x61,0x18,0x40,0x10,0x61,0x18,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x10,0x40,0x10,0x41,0x10,0x40,0x10,0x40,0x10,0xA1,0x20,0x81,0x10,0x60,0x08,0x40,0x08,0x20,0x08,0x81,0x20,0x81,0x28,0x82,0x20,0x61,0x18,0xAA,0x62,0x0B,0x73,0x61,0x10,0x20,0x00,
-	0x00,0x00,0x40,0x10,0xA1,0x18,0xEA,0x62,0x41,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x00,0x85,0x39,0x82,0x20,0x20,0x08,0x21,0x08,0x20,0x08,0x2B,0x73,0xE2,0x18,0x69,0x5A,0x20,0x00,0x00,0x00,0x20,0x00,0x24,0x52,0xCB,0x93,0x27,0x83,0x62,0x39,0x15,0xC6,0xDC,0xF7,0x64,0x62,0x85,0x7A,0x04,0x6A,0xEE,0xD4,
-	0x91,0xED,0x47,0x8B,0x67,0x9B,0x06,0x83,0x36,0xF7,0x99,0xFF,0x0A,0xAC,0x82,0x49,0x24,0x62,0xD2,0xCD,0x4C,0xA4,0x80,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x20,0x81,0x20,0x61,0x20,0x61,0x20,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x40,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x40,0x10,0x60,0x10,0xA2,0x18,0xC2,0x20,0xA2,0x30,0x61,0x18,0x20,0x10,0x60,0x10,0x40,0x10,0x60,0x18,0x81,0x18,0x40,0x08,
-	0x20,0x08,0x20,0x08,0x40,0x08,0xA1,0x18,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x81,0x18,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x08,0x20,0x08,0x20,0x00,0x0B,0x63,0x4C,0x73,0x2F,0x8C,0xC2,0x18,0x00,0x00,0x00,0x00,0x2B,0x63,0x53,0xDE,0x4B,0xA4,0x07,0x83,0xFD,0xFF,0xF7,0xE6,0x6D,0xA4,0xBC,0xFF,0xA9,0x7A,0xA6,0x8A,
-	0x4B,0xBC,0xD1,0xDD,0xB7,0xF7,0x57,0xF7,0xFB,0xFF,0x99,0xFF,0xA8,0xA3,0xE1,0x20,0x42,0x31,0xB6,0xDE,0xF6,0xE6,0x42,0x39,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE3,0x38,0xA2,0x30,0x80,0x20,0x61,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x10,0x61,0x18,0x82,0x18,0x40,0x10,0x40,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x20,0x10,0x40,0x10,0x85,0x31,0x03,0x31,0x41,0x18,0xA1,0x18,
-	0x61,0x10,0x40,0x08,0x20,0x00,0x60,0x10,0xA1,0x18,0x81,0x10,0x40,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x10,0x20,0x00,0x20,0x08,0x81,0x10,0x60,0x10,0x2F,0x8C,0x8D,0x73,0x20,0x00,0x86,0x31,0xC3,0x18,0xAD,0x7B,0xE3,0x18,0x03,0x21,0x45,0x52,0x54,0xD6,0xED,0xB4,0xFE,0xFF,0x75,0xEE,0xB8,0xF6,0xBC,0xF7,0x67,0x9B,0xC4,0x71,
-	0x65,0x7A,0x0C,0xBD,0x56,0xF7,0xB8,0xF7,0xD8,0xFF,0x77,0xF7,0x2A,0xA4,0xA0,0x18,0xC0,0x20,0xAC,0xB4,0x6F,0xBD,0x22,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x85,0x61,0xC2,0x30,0xA2,0x28,0xC2,0x28,0x80,0x18,0x61,0x18,0x81,0x18,0x40,0x10,0x40,0x10,0x40,0x08,0x40,0x10,0x40,0x10,0x81,0x18,0x81,0x18,0xA2,0x28,0xA2,0x20,0x40,0x10,0x40,0x08,0x20,0x10,0x40,0x08,0x40,0x08,0x40,0x10,0x60,0x10,0x41,0x10,0x20,0x08,0x40,0x08,0x40,0x08,0xC3,0x20,0xA2,0x18,0x20,0x08,0x40,0x08,
-	0xA1,0x20,0x23,0x31,0xA9,0x62,0xA1,0x18,0xA2,0x18,0xA1,0x18,0x82,0x18,0x41,0x10,0x20,0x08,0x00,0x00,0x40,0x08,0x41,0x10,0x81,0x10,0xA1,0x18,0xA2,0x18,0x65,0x39,0x40,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x03,0x19,0x40,0x00,0x20,0x00,0x90,0x9C,0xFD,0xF7,0xD6,0xEE,0x6E,0x9C,0xCC,0xBC,0x34,0xF6,0x57,0xF7,0xD5,0xEE,0x8F,0xD5,
-	0xC9,0x9B,0x15,0xEF,0xF4,0xEE,0x30,0xD6,0x76,0xF7,0x76,0xF7,0xA5,0x7A,0x41,0x39,0x41,0x39,0x62,0x49,0x80,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE3,0x38,0xC2,0x30,0x40,0x18,0xE2,0x28,0x20,0x08,0x20,0x08,0x40,0x08,0x61,0x18,0x81,0x18,0x41,0x10,0x40,0x08,0x20,0x08,0x20,0x08,0x41,0x10,0x61,0x10,0xE3,0x28,0x40,0x10,0x40,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0xA2,0x20,0x61,0x18,0x20,0x10,0x61,0x10,0x81,0x10,0x20,0x08,0x20,0x00,
-	0x20,0x08,0x44,0x39,0x85,0x41,0xC2,0x20,0xA2,0x18,0xA2,0x18,0xC2,0x18,0x61,0x10,0x40,0x08,0x40,0x08,0x20,0x00,0x81,0x10,0xC2,0x20,0xA1,0x18,0xA2,0x18,0xA1,0x18,0x81,0x10,0x61,0x10,0x70,0x8C,0x40,0x00,0x20,0x00,0x60,0x08,0x40,0x00,0x89,0x52,0xAD,0x83,0x90,0xC5,0xCC,0x8B,0xE6,0x92,0x52,0xE6,0xDB,0xFF,0xFB,0xFF,0xD8,0xFF,
-	0x98,0xF7,0xDA,0xFF,0xDA,0xF7,0xB9,0xF7,0xBA,0xF7,0x89,0x83,0x82,0x49,0x20,0x31,0x41,0x41,0xE1,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x03,0x39,0xE3,0x30,0x61,0x10,0x20,0x08,0x20,0x10,0x61,0x10,0x81,0x18,0x81,0x10,0xA2,0x18,0x81,0x18,0x40,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x40,0x08,0x40,0x08,0x40,0x08,0x20,0x10,0x20,0x08,0xE7,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x44,0x29,0x60,0x08,0x60,0x10,0x40,0x08,0x40,0x08,0x40,0x08,0x40,0x08,
-	0x60,0x08,0xA2,0x18,0x81,0x18,0x03,0x31,0xC2,0x20,0xC2,0x18,0xA1,0x18,0xE2,0x18,0x60,0x10,0x20,0x00,0x40,0x08,0xA1,0x10,0xA2,0x20,0xA2,0x20,0x81,0x10,0xA2,0x18,0x81,0x18,0x81,0x10,0xA6,0x39,0x40,0x08,0x00,0x00,0x20,0x00,0xA1,0x10,0x03,0x21,0x8C,0x73,0xF4,0xCD,0xA8,0x93,0xCF,0xD5,0x77,0xF7,0xB9,0xF7,0x57,0xEF,0x99,0xF7,
-	0xDA,0xFF,0xFC,0xFF,0xFC,0xFF,0xFD,0xF7,0xBA,0xF7,0x6C,0xAC,0x15,0xEF,0xA6,0x62,0xA7,0x5A,0xAA,0x8B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x86,0x31,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xA6,0x31,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0xA6,0x31,
-	0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x03,0x41,0x03,0x39,0xA2,0x20,0x61,0x18,0x61,0x18,0x81,0x18,0xE3,0x28,0xC2,0x20,0xC2,0x28,0xC2,0x20,0xC2,0x20,0x61,0x18,0x60,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x40,0x10,0x40,0x10,0x40,0x08,0x20,0x08,0x81,0x10,0x81,0x18,0x20,0x10,0x24,0x31,0x60,0x10,0xC2,0x20,0x20,0x00,0x40,0x08,0x40,0x08,0x20,0x08,
-	0x61,0x10,0xAA,0x6A,0x48,0x5A,0xA2,0x28,0xE2,0x30,0x8C,0x7B,0xE2,0x28,0xA1,0x18,0xA1,0x10,0x41,0x08,0x20,0x00,0x60,0x10,0xA2,0x20,0xE3,0x28,0xA1,0x18,0xA1,0x18,0xA2,0x18,0x60,0x08,0x20,0x00,0x03,0x21,0x48,0x62,0x24,0x29,0xE1,0x18,0xA8,0x62,0xB8,0xD6,0x32,0xD6,0x8B,0xB4,0xB7,0xF7,0x76,0xF7,0x2B,0x9C,0x06,0x83,0x4A,0xB4,
-	0x77,0xF7,0x77,0xF7,0x17,0xEF,0xFC,0xF7,0xD8,0xFF,0x72,0xDE,0xB4,0xE6,0x87,0x52,0x92,0xC5,0xF6,0xEE,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xCF,0x7B,0x59,0xCE,0x3C,0xE7,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x7D,0xEF,0xBA,0xD6,0x13,0x9D,0x85,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x9D,0xEF,0x9D,0xEF,
-	0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x04,0x39,0xC2,0x28,0x61,0x18,0xC2,0x18,0x20,0x00,0x60,0x08,0xA2,0x18,0xA2,0x28,0xA2,0x28,0xC2,0x28,0xA2,0x20,0x61,0x18,0x20,0x08,0x40,0x10,0xA2,0x18,0x20,0x08,0x40,0x08,0x40,0x08,0x40,0x08,0x40,0x10,0x81,0x10,0xA2,0x18,0xC3,0x20,0xA1,0x20,0xA2,0x20,0x41,0x18,0xC7,0x59,0x40,0x10,0x20,0x10,0x40,0x10,0x20,0x08,
-	0x20,0x08,0x60,0x10,0xE3,0x28,0x82,0x20,0x81,0x20,0x65,0x39,0x03,0x31,0xA1,0x18,0x40,0x08,0x40,0x00,0x41,0x08,0x40,0x10,0x81,0x10,0xC2,0x20,0x03,0x29,0xA1,0x20,0x81,0x18,0xA1,0x18,0xA1,0x20,0x03,0x29,0xA1,0x18,0x20,0x00,0x20,0x00,0xC1,0x18,0xF2,0xD5,0xBB,0xF7,0x97,0xF7,0x78,0xF7,0x72,0xDE,0x24,0x6A,0x41,0x41,0x24,0x6A,
-	0xF5,0xEE,0xF0,0xD5,0xA6,0x6A,0x10,0xAD,0xA7,0x62,0x07,0x7B,0xEE,0xB4,0x42,0x29,0xC3,0x41,0x82,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x69,0x4A,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x50,0x84,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x28,0x61,0x10,0x20,0x08,0xC2,0x20,0x20,0x08,0x40,0x08,0xC2,0x20,0xA2,0x28,0xC2,0x20,0xC2,0x20,0xC2,0x20,0xA1,0x18,0x40,0x08,0xA2,0x18,0x04,0x31,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x81,0x10,0x24,0x31,0x81,0x18,0x24,0x31,0x41,0x10,0x61,0x10,0x20,0x10,0x20,0x08,0x40,0x08,0x40,0x08,
-	0x40,0x10,0x61,0x10,0x61,0x18,0x82,0x18,0x82,0x10,0x85,0x31,0x0E,0x84,0xA2,0x20,0xA1,0x18,0x20,0x00,0x20,0x00,0x40,0x08,0x4C,0x73,0x23,0x21,0x81,0x18,0xE2,0x28,0xC2,0x20,0xA1,0x28,0x02,0x31,0xC2,0x20,0x03,0x29,0x80,0x10,0x84,0x39,0x11,0xAD,0x36,0xCE,0x56,0xCE,0x50,0xBD,0x97,0xF7,0x87,0xA3,0xA2,0x59,0xE4,0x59,0x44,0x72,
-	0x56,0xF7,0xD5,0xE6,0x80,0x10,0x20,0x00,0x20,0x00,0xB0,0x9C,0xBB,0xF7,0x06,0x42,0x40,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x50,0x84,
-	0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xF7,0xBD,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x08,0x20,0x08,0x20,0x08,0x40,0x08,0x40,0x10,0xC2,0x20,0x24,0x31,0xC3,0x28,0xE3,0x28,0xC2,0x28,0xA2,0x20,0x40,0x08,0x00,0x00,0x20,0x00,0xC2,0x28,0x61,0x10,0x81,0x10,0x41,0x10,0x61,0x18,0x82,0x18,0xA2,0x20,0x03,0x21,0x04,0x39,0xE3,0x28,0xC3,0x30,0xA2,0x20,0x62,0x20,0x61,0x18,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x40,0x10,0x81,0x18,0x60,0x10,0xA1,0x10,0x40,0x08,0x40,0x08,0x60,0x08,0x81,0x18,0xA1,0x18,0x00,0x00,0x40,0x08,0xC2,0x18,0x60,0x10,0x20,0x08,0x40,0x08,0x61,0x18,0xCA,0x6A,0xD1,0x9C,0x03,0x29,0xA2,0x18,0xE2,0x30,0x08,0x5A,0xCB,0x9B,0xD0,0xCD,0x2F,0xBD,0x1A,0xE7,0xDA,0xFF,0xAC,0xBC,0xD0,0xCD,0x36,0xF7,0x36,0xF7,
-	0xB8,0xF7,0xE8,0x6A,0x40,0x00,0x00,0x00,0x00,0x00,0xC2,0x20,0x4B,0x6B,0x81,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xBE,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xBE,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x18,0xC2,0x20,0x20,0x08,0x00,0x00,0x40,0x08,0xE3,0x28,0x24,0x31,0x82,0x20,0xC2,0x28,0x20,0x08,0x20,0x00,0x81,0x10,0xE3,0x28,0x40,0x20,0xC2,0x20,0xC2,0x28,0x40,0x10,0x41,0x10,0x61,0x10,0x61,0x18,0x81,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0x61,0x18,0x41,0x18,0x81,0x18,0x27,0x52,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x08,0xE2,0x20,0x44,0x31,0x20,0x08,0x20,0x00,0x60,0x08,0x40,0x08,0xE7,0x49,0x03,0x29,0x61,0x18,0x40,0x08,0x81,0x10,0x40,0x08,0x61,0x10,0xC2,0x20,0xC2,0x18,0xC2,0x18,0x6C,0x7B,0x44,0x41,0x0B,0x7B,0x32,0xC5,0x6F,0xC5,0x29,0x73,0xF3,0xCD,0xDA,0xF7,0x97,0xF7,0x97,0xF7,0xD8,0xFF,0xD8,0xFF,
-	0x37,0xEF,0x83,0x39,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,0xBE,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x59,0xCE,0xD2,0x94,0x71,0x8C,0x91,0x8C,0xB6,0xB5,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x10,0x40,0x08,0x41,0x18,0xC2,0x28,0x20,0x08,0x20,0x00,0x20,0x08,0x40,0x08,0x40,0x08,0x61,0x10,0x40,0x08,0x61,0x10,0x20,0x00,0x20,0x00,0xC2,0x18,0x20,0x08,0x61,0x18,0xA2,0x20,0x61,0x18,0x60,0x10,0x81,0x18,0xC2,0x20,0xC2,0x18,0xA2,0x20,0xC2,0x20,0xA2,0x20,0xA2,0x20,0x81,0x18,0x20,0x10,0x61,0x18,0x40,0x10,0x40,0x08,
-	0x81,0x10,0x20,0x08,0x20,0x08,0x40,0x00,0x81,0x08,0xE7,0x41,0x20,0x08,0x00,0x00,0x44,0x29,0x07,0x42,0x48,0x52,0x81,0x10,0xC2,0x18,0x81,0x10,0xC6,0x39,0xC2,0x20,0x81,0x18,0xE2,0x20,0xE2,0x20,0x82,0x18,0x48,0x5A,0x82,0x18,0x87,0x5A,0x17,0xEF,0x39,0xE7,0xCB,0x83,0x84,0x31,0x38,0xE7,0x15,0xEF,0x97,0xF7,0xD9,0xFF,0x76,0xF7,
-	0xF3,0xCD,0xC1,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x79,0xCE,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x54,0xA5,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x18,0x40,0x10,0x20,0x08,0x20,0x08,0xA2,0x18,0x60,0x10,0x40,0x10,0x20,0x08,0x20,0x08,0xA1,0x18,0x81,0x18,0x45,0x39,0x40,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x81,0x18,0x40,0x10,0x20,0x08,0x61,0x10,0xA1,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0x81,0x18,0x60,0x10,0x60,0x10,0x81,0x20,0x20,0x08,
-	0x28,0x4A,0x61,0x10,0x20,0x00,0x20,0x00,0x40,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x60,0x10,0x20,0x08,0xE4,0x28,0x20,0x00,0xA6,0x39,0x81,0x10,0xA1,0x18,0xA1,0x20,0x43,0x31,0x03,0x31,0x23,0x31,0x64,0x39,0xE5,0x51,0x32,0xD6,0xDA,0xFF,0x76,0xD6,0xF5,0xC5,0xBA,0xF7,0xB8,0xF7,0xDB,0xFF,0x57,0xEF,0x10,0xD6,
-	0xF3,0xD5,0x23,0x31,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xAE,0x73,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xC6,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x10,0xA1,0x18,0x40,0x08,0x40,0x08,0x61,0x10,0x41,0x10,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x60,0x08,0x03,0x29,0xA2,0x20,0xA1,0x20,0x40,0x10,0x40,0x08,0x41,0x10,0x40,0x10,0x81,0x10,0x81,0x18,0xA2,0x20,0xA2,0x20,0xC2,0x20,0xC2,0x20,0x82,0x18,0x81,0x18,0xA1,0x18,0xA2,0x20,0x20,0x08,
-	0x61,0x10,0x86,0x39,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x81,0x08,0xA2,0x18,0xAD,0x7B,0xA9,0x5A,0x03,0x21,0x00,0x00,0x61,0x10,0xEF,0x83,0x27,0x4A,0x43,0x31,0x47,0x52,0x02,0x29,0xA3,0x49,0x58,0xEF,0xDA,0xFF,0xDB,0xF7,0xDC,0xF7,0xFE,0xFF,0xFD,0xFF,0xD8,0xFF,0xDB,0xFF,0xF7,0xE6,0xF0,0xDD,
-	0x95,0xDE,0x64,0x39,0x41,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x7D,0xEF,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x18,0xA2,0x20,0xA1,0x18,0x40,0x08,0x40,0x08,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x10,0x61,0x18,0xA2,0x28,0xC2,0x28,0x81,0x20,0x40,0x18,0x60,0x10,0x40,0x10,0x03,0x31,0xC2,0x20,0x24,0x39,0x60,0x10,0x40,0x08,0x40,0x08,0x20,0x08,0x80,0x10,0x40,0x08,
-	0x60,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x24,0x29,0x6C,0x83,0xC6,0x39,0xC3,0x18,0x03,0x29,0xEF,0x8B,0x40,0x08,0xEE,0x83,0xDE,0xF7,0xBD,0xF7,0xF5,0xC5,0xD9,0xDE,0x27,0x52,0x22,0x39,0x10,0xDE,0xBB,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFD,0xFF,0xDA,0xFF,0xFB,0xFF,0xDB,0xF7,0x76,0xD6,
-	0x05,0x72,0x81,0x20,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x10,0x81,0x18,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x40,0x08,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC2,0x30,0xE4,0x38,0xC3,0x28,0x61,0x18,0x40,0x10,0x61,0x10,0xE3,0x30,0x61,0x20,0xE3,0x30,0x40,0x10,0x40,0x10,0x61,0x10,0xC2,0x18,0xA6,0x41,0x02,0x21,
-	0x20,0x00,0x41,0x08,0x40,0x00,0x40,0x10,0xAA,0x62,0x20,0x00,0x00,0x00,0x64,0x29,0x61,0x10,0x61,0x08,0x07,0x42,0x64,0x29,0x40,0x00,0xA0,0x10,0xA1,0x18,0xCA,0x62,0xBD,0xF7,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x7B,0xEF,0xB5,0xE6,0x79,0xF7,0xDB,0xF7,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFB,0xFF,0x9A,0xEF,0x37,0xEF,0xAA,0x8B,
-	0xC4,0x59,0xC1,0x20,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x5C,0xE7,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE2,0x28,0x00,0x00,0x00,0x00,0x40,0x08,0x20,0x08,0x60,0x10,0x20,0x08,0x20,0x08,0xC2,0x18,0x81,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x45,0x31,0x40,0x08,0x81,0x10,0x40,0x08,0xC3,0x28,0x20,0x10,0x61,0x10,0x40,0x10,0x61,0x10,0x41,0x10,0x81,0x20,0x24,0x41,0xC6,0x51,0x20,0x10,0x82,0x10,0x44,0x29,0x20,0x08,0xA1,0x18,
-	0xA1,0x18,0x20,0x08,0x20,0x00,0x40,0x08,0x02,0x29,0x20,0x08,0x40,0x00,0x44,0x29,0x40,0x00,0x20,0x00,0x33,0xAD,0x06,0x4A,0x40,0x08,0x40,0x08,0xE2,0x20,0x95,0xB5,0xDE,0xF7,0xFF,0xFF,0x9D,0xEF,0x19,0xE7,0xFD,0xFF,0xDD,0xF7,0xDC,0xF7,0xDC,0xF7,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xF8,0xE6,0xC3,0x51,0x4A,0x7B,
-	0xB7,0xDE,0x27,0x5A,0x61,0x10,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x79,0xCE,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x99,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x10,0x00,0x00,0x40,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x20,0x00,0x40,0x08,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x08,0x20,0x08,0x40,0x08,0x60,0x10,0x04,0x31,0xA2,0x20,0x20,0x08,0x20,0x08,0x20,0x10,0x81,0x20,0xE3,0x30,0x44,0x39,0x65,0x39,0x80,0x18,0x40,0x08,0x60,0x10,0xEA,0x6A,
-	0x64,0x39,0x89,0x62,0x61,0x08,0x40,0x08,0x61,0x10,0xA1,0x18,0x20,0x08,0x41,0x08,0x20,0x00,0x40,0x08,0xC1,0x20,0x61,0x18,0x40,0x10,0x81,0x10,0x23,0x29,0xBA,0xD6,0xFF,0xFF,0xFE,0xFF,0x19,0xE7,0x8F,0xC5,0xFB,0xFF,0xDD,0xF7,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xB8,0xDE,0xC6,0x51,0x5C,0xEF,
-	0x9B,0xF7,0x67,0x62,0x61,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x10,0x40,0x08,0x40,0x10,0x81,0x18,0x40,0x10,0x41,0x10,0x40,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x40,0x08,0x40,0x08,0x81,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x18,0x65,0x31,0x40,0x10,0x61,0x18,0xE3,0x28,0x40,0x08,0x24,0x29,0xA5,0x39,0xA1,0x10,0x44,0x39,
-	0x43,0x39,0xE2,0x20,0x80,0x10,0x81,0x18,0x80,0x10,0x26,0x52,0x20,0x00,0x20,0x00,0xA1,0x18,0x69,0x62,0xF1,0x9C,0xC2,0x20,0x61,0x10,0x60,0x10,0xD1,0x9C,0xF2,0xAC,0x1A,0xE7,0x7B,0xEF,0xF3,0xCD,0x39,0xEF,0xFD,0xFF,0x7A,0xF7,0xFB,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFC,0xFF,0x9C,0xF7,0x69,0x8B,0xB8,0xE6,
-	0x7B,0xEF,0x47,0x62,0x61,0x10,0x60,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x4A,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xBE,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC2,0x20,0xA2,0x20,0xE3,0x28,0xA2,0x18,0x61,0x10,0x60,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x20,0x00,0x20,0x08,0x20,0x10,0xC5,0x49,0x20,0x08,0x61,0x18,0x81,0x18,0x82,0x18,0x04,0x29,0x40,0x10,0xE3,0x20,0x24,0x31,0x21,0x08,0x20,0x08,0x69,0x52,0xC6,0x41,0xA2,0x18,
-	0xC1,0x20,0xCD,0x8B,0xC6,0x39,0x28,0x52,0xC2,0x28,0x85,0x41,0xC6,0x39,0x67,0x52,0xED,0x83,0xD8,0xD6,0x97,0xDE,0x8B,0x7B,0xE5,0x41,0xA9,0x5A,0x0B,0x6B,0x24,0x29,0x9B,0xEF,0xD6,0xEE,0x59,0xEF,0xFE,0xF7,0xFE,0xF7,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xBC,0xF7,0x36,0xCE,0xA1,0x28,0xEE,0x8B,
-	0x12,0xA5,0xC2,0x28,0x61,0x10,0x41,0x08,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x86,0x41,0xC2,0x20,0xA2,0x20,0xA2,0x18,0x61,0x10,0x81,0x10,0x40,0x08,0x20,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x40,0x08,0x20,0x08,0x04,0x39,0x20,0x10,0x61,0x18,0x61,0x18,0x20,0x08,0x20,0x08,0x61,0x10,0xC3,0x20,0x60,0x10,0x40,0x08,0x20,0x08,0x23,0x29,0x61,0x10,0xA1,0x10,
-	0xE2,0x28,0x23,0x29,0xC6,0x41,0x03,0x21,0xC1,0x20,0xE4,0x49,0x15,0xCE,0x66,0x52,0xA8,0x5A,0xA4,0x39,0xD5,0xBD,0x32,0xAD,0xF8,0xDE,0x3A,0xEF,0x53,0xAD,0xB9,0xD6,0x59,0xEF,0x57,0xEF,0xFC,0xFF,0xFD,0xF7,0xFD,0xF7,0xFC,0xFF,0xFC,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0x8E,0xA4,0xC1,0x28,0x60,0x10,0x61,0x10,
-	0x61,0x10,0x81,0x10,0x61,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE3,0x28,0xA2,0x20,0xA1,0x18,0xA2,0x20,0xC2,0x20,0x40,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x61,0x10,0x61,0x10,0x81,0x18,0x40,0x10,0x20,0x08,0x61,0x18,0x40,0x10,0x40,0x10,0x61,0x18,0x82,0x20,0xA1,0x20,0x20,0x10,0x20,0x08,0xA1,0x18,0xA2,0x18,0xA1,0x18,0xE2,0x20,
-	0xC1,0x18,0xC2,0x18,0xA1,0x10,0xA1,0x18,0xC9,0x62,0x2E,0x8C,0x6F,0x94,0x24,0x21,0xA6,0x39,0x32,0xAD,0x53,0xA5,0x64,0x29,0x6D,0x73,0xFD,0xF7,0xFE,0xF7,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDD,0xF7,0x94,0xBD,0x03,0x31,0x61,0x10,0x61,0x10,
-	0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xEB,0x5A,0x03,0x19,0x69,0x4A,0x34,0xA5,0xDB,0xDE,0xBE,0xF7,0xDE,0xF7,0x1C,0xE7,0x9A,0xD6,0x54,0xA5,0x0C,0x63,0x45,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA1,0x18,0x81,0x18,0xC2,0x20,0xA2,0x18,0x20,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x24,0x29,0x00,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x10,0x41,0x10,0x40,0x10,0x86,0x39,0x81,0x18,0x40,0x08,0x00,0x00,0x00,0x08,0x20,0x08,0x60,0x10,0x60,0x10,0x60,0x10,0xC2,0x18,0xA2,0x18,0xE2,0x20,0xA1,0x18,
-	0x44,0x31,0x85,0x31,0x60,0x08,0xA0,0x10,0x67,0x52,0xC6,0x41,0xB0,0xA4,0xEA,0x6A,0xB5,0xB5,0x2F,0x8C,0x53,0xB5,0x37,0xC6,0xBA,0xD6,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFE,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xDD,0xF7,0x9D,0xF7,0xDD,0xF7,0xF2,0xB4,0x70,0x9C,0xA2,0x18,0x41,0x10,0x61,0x10,
-	0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x40,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0xDA,0xD6,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x5C,0xE7,0x75,0xAD,0x85,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x20,0x03,0x29,0xA2,0x18,0x81,0x18,0x40,0x08,0x40,0x08,0x20,0x00,0x40,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x18,0x20,0x08,0x40,0x08,0xA1,0x20,0x24,0x39,0x23,0x41,0x40,0x10,0x03,0x29,0xE3,0x20,0x8D,0x7B,0x40,0x10,0xA2,0x18,0x24,0x29,0x61,0x10,0xC2,0x20,0x40,0x08,0x41,0x08,
-	0x81,0x10,0x81,0x10,0x44,0x39,0x2E,0x94,0xCD,0x83,0x97,0xDE,0x8D,0x73,0x9D,0xEF,0x4C,0x73,0xBC,0xEF,0xDE,0xF7,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xDC,0xFF,0x17,0xEF,0xF7,0xE6,0xBB,0xF7,0xD6,0xE6,0x14,0xE6,0x17,0xF7,0x9A,0xF7,0x35,0xEE,0xB3,0xE5,0x32,0xD5,0x84,0x51,0xC2,0x28,0xA1,0x18,0x61,0x10,0x61,0x10,
-	0x60,0x10,0x61,0x10,0x60,0x08,0x41,0x08,0x20,0x08,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x0F,0x7C,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x20,0xE2,0x20,0xC2,0x18,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x40,0x08,0x81,0x10,0x61,0x08,0x41,0x08,0x40,0x08,0x20,0x00,0x61,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x44,0x41,0xE3,0x30,0x61,0x18,0x6C,0x7B,0x61,0x18,0x44,0x39,0x81,0x18,0x81,0x18,0xA1,0x18,0xE3,0x20,0xAA,0x5A,0xA0,0x10,0x61,0x08,
-	0x40,0x08,0x40,0x08,0xCA,0x62,0x64,0x31,0x5C,0xEF,0x7C,0xE7,0xF9,0xDE,0x1B,0xE7,0x1B,0xE7,0xDE,0xF7,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xDC,0xFF,0x70,0xC5,0x83,0x39,0x6B,0x9B,0x8D,0xD4,0x70,0xDD,0xF3,0xF5,0x14,0xF6,0x4D,0xD4,0xE9,0xAA,0xC6,0x69,0xE3,0x38,0xE3,0x30,0xA2,0x20,0x60,0x10,0x60,0x10,
-	0x60,0x10,0x61,0x10,0x61,0x10,0x41,0x10,0x40,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x81,0x10,0x81,0x10,0x40,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x61,0x18,0x81,0x18,0x85,0x49,0x41,0x08,0xA1,0x18,0x86,0x49,0xA2,0x20,0x81,0x18,0xE6,0x41,0xC6,0x41,0x65,0x31,0x8D,0x7B,0x3A,0xE7,
-	0x63,0x39,0xEA,0x6A,0x88,0x5A,0x98,0xCE,0xFE,0xF7,0x5B,0xEF,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFC,0xFF,0xFD,0xFF,0xBA,0xF7,0xD1,0xC5,0xA1,0x28,0x47,0x82,0x31,0xE5,0xD3,0xF5,0x2C,0xCC,0x29,0xB3,0x27,0x8A,0x44,0x59,0xE3,0x30,0xE3,0x30,0xE2,0x28,0xC2,0x20,0x61,0x10,0x61,0x10,
-	0xA1,0x18,0xA1,0x18,0xA2,0x18,0xA2,0x18,0x81,0x10,0x40,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0x9D,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0xA6,0x39,0x04,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x60,0x10,0x40,0x10,0xC2,0x20,0x62,0x20,0x61,0x18,0xA2,0x18,0xA2,0x18,0xE3,0x28,0xA1,0x20,0x64,0x39,0x88,0x5A,0x81,0x18,0x60,0x00,0x90,0x9C,0x33,0xB5,
-	0x03,0x21,0x47,0x52,0x7C,0xEF,0xDE,0xF7,0xD9,0xDE,0xBC,0xF7,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFD,0xFF,0xFC,0xFF,0xDA,0xFF,0x90,0xC5,0x42,0x39,0x03,0x39,0x8B,0xB3,0x92,0xED,0x35,0xF6,0x4E,0xCC,0x43,0x51,0x81,0x28,0x61,0x20,0xA2,0x20,0xC2,0x20,0xC2,0x20,0x81,0x18,0x61,0x18,0xA2,0x20,
-	0xC2,0x20,0xA2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x75,0xAD,0xC7,0x39,0x45,0x29,0x24,0x21,0x24,0x21,0x45,0x29,0xA6,0x31,0x0F,0x7C,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x08,0x61,0x10,0x60,0x08,0x40,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x81,0x10,0x61,0x10,0x61,0x10,0x81,0x18,0x40,0x10,0xC2,0x20,0xC2,0x20,0x82,0x20,0xC2,0x20,0x81,0x18,0xE6,0x49,0x81,0x18,0x61,0x10,0xA6,0x39,0x16,0xCE,0x4E,0x9C,
-	0x54,0xAD,0x1A,0xE7,0xFE,0xF7,0xFE,0xFF,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0x38,0xEF,0xB6,0xDE,0xD3,0xC5,0xB0,0xCD,0x50,0xCD,0x23,0x39,0x65,0x49,0x6E,0xCC,0x56,0xF6,0xF4,0xF5,0x09,0xBB,0x03,0x39,0x40,0x10,0x40,0x10,0x20,0x10,0x40,0x08,0x40,0x10,0x82,0x20,0xC3,0x28,0xE3,0x28,
-	0x03,0x29,0xC2,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x18,0x40,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x1B,0xDF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDA,0xD6,0xCA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x34,0xA5,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x60,0x08,0x20,0x08,0x41,0x08,0x20,0x08,0x24,0x31,0x40,0x08,0xA2,0x18,0x00,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x40,0x08,0x20,0x08,0x24,0x31,0x61,0x10,0x24,0x31,0x44,0x39,0x61,0x18,0x86,0x39,0x65,0x39,0xE6,0x51,0x45,0x39,0xE3,0x28,0x84,0x39,0xA1,0x18,0xC2,0x18,0x16,0xC6,0xB8,0xD6,0x1A,0xE7,
-	0xDE,0xF7,0xDE,0xF7,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xDA,0xFF,0x29,0x7B,0x62,0x31,0xE1,0x28,0x06,0x72,0xA6,0x72,0x81,0x18,0xE3,0x38,0x0A,0xA3,0xD3,0xED,0x71,0xE5,0x88,0x92,0xC2,0x28,0x81,0x18,0x81,0x18,0x40,0x10,0x20,0x08,0x60,0x08,0xC2,0x20,0xE3,0x30,0x04,0x31,
-	0x24,0x31,0xE3,0x20,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0xA6,0x31,0x71,0x8C,0x58,0xC6,
-	0xDA,0xD6,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x91,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x61,0x10,0x20,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x08,0x20,0x08,0x40,0x10,0x40,0x10,0x40,0x08,0x61,0x10,0xA2,0x18,0xA6,0x49,0xE3,0x28,0xA2,0x20,0xCA,0x62,0x27,0x52,0x06,0x4A,0x94,0xBD,0x7B,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0xDC,0xF7,0x95,0xDE,0xD0,0xA4,0x05,0x4A,0x22,0x31,0xEA,0x82,0xAC,0xAB,0x8F,0xD5,0xCD,0xC4,0x64,0x51,0x61,0x10,0x02,0x31,0x88,0xAA,0xEC,0xCB,0x85,0x69,0xC2,0x28,0xE3,0x38,0xE3,0x30,0xA2,0x28,0x61,0x18,0x61,0x18,0xC2,0x20,0xE3,0x30,0x04,0x39,
-	0x04,0x31,0xE3,0x28,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x61,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x08,0x00,0x00,0x20,0x08,0x61,0x10,0x61,0x18,0x40,0x10,0xE3,0x28,0x03,0x31,0xC2,0x20,0xA2,0x20,0x03,0x29,0x8C,0x7B,0x7B,0xEF,0xFE,0xF7,0xDE,0xF7,0xFE,0xFF,0xFF,0xFF,
-	0xFD,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xDC,0xFF,0x17,0xEF,0x12,0xD6,0x38,0xEF,0xDA,0xF7,0x53,0xDE,0xEC,0xB4,0xC9,0x93,0xC4,0x69,0xD1,0xDD,0xD2,0xED,0x92,0xE5,0xF0,0xDC,0xA5,0x59,0x61,0x18,0xC2,0x30,0x27,0x92,0xE9,0xAA,0x85,0x81,0x24,0x49,0x24,0x41,0x23,0x51,0x24,0x51,0xE2,0x38,0xC3,0x30,0xE3,0x28,0xE3,0x30,0x04,0x39,
-	0x66,0x51,0x45,0x39,0xE3,0x28,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x23,0x21,0x20,0x00,0x28,0x52,0x40,0x08,0x20,0x08,0x40,0x10,0x82,0x18,0x40,0x18,0x81,0x20,0xC3,0x20,0x85,0x41,0x8D,0x7B,0x73,0xB5,0xDD,0xFF,0xFD,0xFF,0xFE,0xFF,0xFE,0xFF,0xFD,0xFF,0x9A,0xF7,
-	0x6E,0xA4,0xF8,0xDE,0xBC,0xF7,0xDC,0xFF,0xFC,0xF7,0x17,0xEF,0xA3,0x41,0x01,0x29,0x4F,0x94,0xED,0xAC,0x11,0xD6,0x39,0xF7,0x27,0x8B,0x04,0x62,0xC4,0x51,0x42,0x41,0x23,0x39,0x81,0x18,0xC2,0x28,0x85,0x69,0xCC,0xC3,0x2D,0xD4,0x6B,0xB3,0x85,0x71,0x23,0x59,0x44,0x61,0x44,0x59,0x03,0x41,0x03,0x39,0x03,0x39,0xA2,0x28,0x24,0x39,
-	0x44,0x41,0x24,0x31,0x04,0x31,0xC3,0x18,0xA2,0x18,0x82,0x10,0x40,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x60,0x08,0x20,0x00,0x20,0x00,0xC2,0x18,0x40,0x08,0x40,0x08,0x20,0x00,0x40,0x08,0x61,0x18,0xA2,0x20,0xA2,0x20,0xEB,0x72,0x2F,0x94,0x17,0xC6,0x9C,0xEF,0xFD,0xFF,0xFD,0xFF,0xFE,0xFF,0x9B,0xEF,0x36,0xD6,0xEF,0xAC,0x79,0xEF,
-	0x50,0xB5,0xC4,0x39,0x08,0x6B,0x74,0xDE,0x93,0xDE,0x98,0xF7,0x90,0xCD,0xEA,0x93,0x43,0x39,0x80,0x10,0x66,0x62,0xF5,0xEE,0xF0,0xAC,0xA1,0x18,0xE2,0x20,0x81,0x20,0x60,0x10,0x61,0x18,0x64,0x51,0xE9,0xB2,0x31,0xE5,0xF4,0xED,0x10,0xE5,0x67,0xAA,0x44,0x69,0xA2,0x40,0xC2,0x38,0xE3,0x38,0xE3,0x38,0x03,0x39,0xC2,0x28,0xE3,0x30,
-	0xE3,0x30,0xE3,0x28,0xE3,0x28,0xC2,0x20,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x08,0x61,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x10,0x81,0x10,0x20,0x10,0x65,0x39,0x61,0x18,0x4D,0x8B,0x48,0x52,0xAD,0x7B,0x90,0x94,0xDD,0xF7,0xFE,0xFF,0xFD,0xFF,0xDC,0xF7,0xF1,0x9C,0x84,0x31,0xAD,0x9C,0xDA,0xFF,
-	0x92,0xB5,0x80,0x10,0x80,0x08,0xC1,0x18,0x24,0x5A,0x73,0xE6,0x98,0xF7,0x59,0xEF,0x4A,0xA4,0x61,0x10,0x61,0x10,0x08,0x7B,0xA6,0x6A,0x43,0x39,0x2B,0xA3,0xC9,0x9A,0xE2,0x30,0xA2,0x20,0x68,0x92,0xAF,0xDC,0xB2,0xED,0x14,0xF6,0x31,0xED,0x09,0xB3,0xE6,0x79,0x81,0x28,0x61,0x20,0xA1,0x20,0xE2,0x30,0x03,0x39,0xE3,0x38,0x24,0x39,
-	0xE3,0x30,0xE3,0x28,0xC2,0x20,0x81,0x10,0x60,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x81,0x10,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x20,0x00,0x40,0x08,0x40,0x00,0x20,0x00,0x61,0x10,0xA2,0x20,0x61,0x10,0x40,0x10,0x85,0x39,0x58,0xD6,0xE6,0x41,0x9C,0xEF,0x9B,0xEF,0x1A,0xE7,0xFD,0xFF,0xBB,0xF7,0xEC,0x83,0x60,0x08,0xCF,0xAC,0xDA,0xF7,0x90,0x9C,
-	0x43,0x29,0x40,0x08,0x40,0x08,0x60,0x18,0xA7,0x6A,0x73,0xDE,0xE9,0x9B,0x8C,0xAC,0x47,0x6A,0x80,0x10,0x40,0x08,0x60,0x10,0x40,0x10,0xC2,0x28,0x8D,0xCC,0xAF,0xDC,0xC5,0x71,0x03,0x39,0x27,0x8A,0x2D,0xCC,0x2D,0xD4,0xAF,0xDC,0xEC,0xD3,0x09,0xC3,0x65,0x69,0xC2,0x30,0xC2,0x28,0x61,0x20,0x81,0x18,0xC2,0x30,0x03,0x39,0x03,0x39,
-	0xE3,0x30,0xC2,0x20,0x81,0x18,0x60,0x10,0x40,0x08,0x40,0x08,0x40,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x81,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x40,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x40,0x08,0x61,0x08,0x20,0x08,0x03,0x31,0x49,0x72,0xE4,0x38,0xCD,0x8B,0xBC,0xF7,0xDC,0xF7,0xDC,0xF7,0xDB,0xF7,0xBB,0xF7,0x2A,0x73,0xAB,0x7B,0x73,0xDE,0x28,0x7B,0x81,0x08,
-	0x20,0x00,0xC1,0x28,0x82,0x41,0x80,0x10,0x81,0x18,0x03,0x29,0x45,0x62,0x8E,0xC4,0x64,0x41,0x40,0x08,0x40,0x08,0x60,0x10,0x40,0x10,0xC1,0x28,0x2A,0x9B,0xEA,0xBB,0x45,0x49,0xA1,0x20,0x45,0x49,0x07,0x7A,0xE6,0x81,0x47,0xA2,0x0A,0xAB,0x88,0x92,0x24,0x51,0x03,0x31,0xE3,0x28,0xC2,0x20,0xA2,0x20,0xC2,0x28,0xE4,0x30,0x24,0x39,
-	0xA2,0x28,0x61,0x18,0x61,0x10,0x61,0x10,0x41,0x10,0x61,0x10,0x20,0x08,0x60,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9A,0xD6,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x7C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x10,0x20,0x00,0x40,0x08,0x20,0x00,0x20,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x20,0x08,0x41,0x08,0x60,0x08,0x61,0x08,0x45,0x49,0x81,0x20,0x80,0x18,0x02,0x29,0x18,0xE7,0xD1,0xC5,0xF3,0xCD,0x2F,0xBD,0x6D,0x9C,0xC4,0x39,0xEF,0xAC,0xDB,0xF7,0x82,0x39,0x20,0x08,
-	0x60,0x08,0xCC,0x8B,0x13,0xD6,0x83,0x41,0xC1,0x28,0x20,0x08,0xC5,0x51,0x8C,0xC4,0x84,0x41,0x40,0x08,0x61,0x18,0x61,0x10,0x60,0x10,0xE2,0x30,0xE9,0xA2,0xA9,0x92,0xC2,0x20,0x40,0x10,0x41,0x10,0x61,0x18,0xA3,0x28,0xE7,0x79,0x88,0x92,0xA6,0x69,0xA1,0x28,0xC2,0x28,0xC2,0x28,0xC3,0x20,0x81,0x18,0x82,0x20,0xC3,0x28,0xE3,0x30,
-	0x82,0x20,0x61,0x18,0x81,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x21,0x08,0x60,0x08,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0xB6,0xB5,0x99,0xCE,0x03,0x19,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x60,0x08,0x20,0x08,0x61,0x10,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0xA1,0x10,0x20,0x00,0x00,0x00,0x81,0x08,0xC2,0x20,0x08,0x62,0xE2,0x28,0x93,0xC5,0xD3,0xCD,0xD7,0xE6,0xA5,0x39,0x80,0x10,0x80,0x08,0x60,0x08,0xC0,0x18,0x04,0x4A,0x30,0xAD,0xC2,0x20,0x20,0x08,
-	0x40,0x08,0xE5,0x49,0x8B,0x9B,0x86,0x72,0x6E,0xCC,0x43,0x41,0x60,0x10,0xE2,0x30,0x80,0x18,0x64,0x41,0x67,0x82,0x64,0x49,0x40,0x08,0x60,0x10,0x64,0x59,0x64,0x51,0x41,0x10,0x20,0x08,0x40,0x08,0x20,0x08,0xC2,0x28,0x45,0x59,0x45,0x61,0x24,0x49,0x62,0x20,0x81,0x18,0xA2,0x18,0xC2,0x20,0x81,0x10,0x60,0x10,0x61,0x18,0x81,0x18,
-	0x82,0x18,0x81,0x18,0x82,0x18,0x81,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x40,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0xF3,0x9C,0xDE,0xF7,0xFF,0xFF,0xDE,0xF7,0xAE,0x73,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xD6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x21,0x08,0x20,0x08,0x81,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x81,0x08,0xA1,0x10,0x20,0x00,0xC2,0x18,0x20,0x10,0x86,0x41,0xA6,0x49,0x2F,0x94,0x7B,0xEF,0xDA,0xF7,0x7A,0xEF,0xB0,0xA4,0x03,0x21,0x60,0x08,0x60,0x08,0xE2,0x20,0x60,0x08,0x60,0x10,0x40,0x08,0x40,0x08,
-	0x20,0x08,0x81,0x18,0x02,0x29,0xA4,0x59,0xCC,0xB3,0x42,0x39,0x60,0x08,0x61,0x10,0x80,0x10,0xC6,0x71,0x8E,0xD4,0x0E,0xBC,0x64,0x51,0x60,0x08,0x60,0x10,0x60,0x10,0x20,0x08,0x40,0x08,0x40,0x08,0x20,0x08,0xC2,0x20,0x24,0x41,0x45,0x51,0x45,0x61,0x03,0x39,0xC3,0x28,0x40,0x08,0x20,0x08,0x20,0x08,0x60,0x10,0x61,0x10,0x81,0x18,
-	0x82,0x18,0x82,0x18,0xA1,0x18,0x61,0x10,0x82,0x18,0x82,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBE,0xF7,0xCA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,
-	0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x20,0x08,0x81,0x10,0x20,0x08,0x40,0x08,0x20,0x08,0xC2,0x10,0x20,0x00,0x20,0x00,0xA2,0x18,0x20,0x08,0xC2,0x28,0xE6,0x61,0xD1,0xAC,0xB5,0xDE,0x77,0xE6,0x95,0xDE,0x3A,0xE7,0x06,0x73,0x08,0x6B,0x83,0x39,0x61,0x10,0x61,0x10,0xCB,0x8B,0x0B,0x94,0x60,0x10,
-	0x40,0x10,0xA7,0x7A,0xB2,0xE5,0x8E,0xCC,0xE4,0x59,0x20,0x08,0x40,0x08,0x20,0x08,0x40,0x08,0xE2,0x28,0x47,0x8A,0x6A,0xC3,0x48,0x82,0x82,0x18,0x41,0x18,0x81,0x18,0x81,0x18,0x40,0x10,0x60,0x10,0x41,0x10,0x61,0x18,0x24,0x41,0xA6,0x69,0xC7,0x71,0x24,0x49,0x24,0x39,0x81,0x18,0x20,0x08,0x20,0x08,0x60,0x10,0x61,0x10,0x61,0x18,
-	0x61,0x18,0x81,0x18,0x82,0x18,0x82,0x18,0x82,0x10,0x82,0x10,0x82,0x10,0x62,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xF3,0x9C,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7D,0xEF,0xEB,0x5A,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x8D,0x6B,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x65,0x31,0x61,0x10,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x81,0x08,0x60,0x08,0x03,0x31,0x4B,0xA3,0xED,0xA3,0xC4,0x61,0x2E,0xA4,0xD0,0xC4,0x85,0x49,0x82,0x41,0x95,0xE6,0x8C,0xA4,0x41,0x10,0x84,0x41,0x37,0xEF,0xF3,0xCD,0xA1,0x18,
-	0x60,0x18,0x43,0x49,0xAA,0xA3,0x6C,0xB4,0x64,0x41,0x40,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0xC1,0x28,0x64,0x51,0x63,0x39,0x40,0x10,0x81,0x18,0x44,0x49,0x44,0x49,0x82,0x20,0xC2,0x28,0x03,0x31,0xA2,0x20,0x03,0x29,0x24,0x41,0x86,0x59,0x44,0x51,0x23,0x39,0x81,0x18,0x40,0x08,0x40,0x08,0x60,0x08,0x61,0x10,0x61,0x10,
-	0x61,0x18,0x82,0x20,0x82,0x18,0x82,0x18,0x82,0x18,0x82,0x18,0x82,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xEF,0x7B,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x58,0xC6,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBE,0xF7,0x58,0xC6,0xAE,0x73,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0x58,0xC6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x81,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x81,0x18,0xA6,0x51,0x4F,0xB4,0x8E,0xAC,0xC2,0x30,0x64,0x51,0x35,0xE6,0xE7,0x82,0xCD,0xB4,0xA6,0x72,0x82,0x39,0x80,0x18,0xC9,0x72,0xD6,0xE6,0x45,0x62,0x60,0x10,
-	0x60,0x08,0x40,0x08,0xC2,0x30,0xC2,0x30,0x40,0x10,0x40,0x08,0x40,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x10,0x60,0x10,0x40,0x10,0x20,0x08,0x60,0x10,0x24,0x41,0x65,0x61,0xC2,0x28,0xE3,0x30,0x24,0x39,0x03,0x31,0xC2,0x20,0x03,0x31,0x03,0x31,0xE2,0x28,0xA1,0x18,0x40,0x10,0x20,0x10,0x40,0x10,0x41,0x10,0x61,0x10,0x61,0x10,
-	0x61,0x18,0x81,0x18,0xA2,0x18,0xA2,0x18,0x82,0x18,0xA2,0x18,0x82,0x10,0x62,0x18,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x7D,0xEF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x58,0xC6,0xB6,0xB5,0xD6,0xB5,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x50,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFB,0xDE,0xD7,0xBD,0xB6,0xB5,0xBA,0xD6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x13,0x9D,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x20,0x08,0x20,0x08,0x40,0x08,0x61,0x10,0x41,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x4F,0x94,0x69,0x7A,0x8D,0x8B,0x9B,0xF7,0x69,0x62,0x81,0x18,0x67,0x6A,0xA4,0x51,0xF3,0xE5,0x67,0x5A,0x60,0x10,0x40,0x10,0x22,0x29,0xA4,0x49,0x80,0x10,0x40,0x08,
-	0x61,0x08,0xA1,0x20,0xEB,0x8A,0xE6,0x69,0x40,0x08,0x20,0x10,0x40,0x08,0x20,0x00,0xA1,0x20,0xE3,0x30,0x40,0x10,0x60,0x10,0x61,0x18,0x40,0x10,0x40,0x10,0x81,0x18,0xA2,0x30,0x61,0x18,0x81,0x20,0x03,0x31,0xC2,0x28,0x60,0x10,0x61,0x18,0x81,0x18,0x61,0x10,0x40,0x08,0x40,0x08,0x20,0x08,0x60,0x10,0x61,0x10,0x61,0x10,0x61,0x10,
-	0x61,0x18,0x82,0x18,0xA2,0x20,0x82,0x18,0x82,0x18,0xA2,0x18,0x82,0x18,0x62,0x18,0x62,0x10,0x62,0x10,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x7D,0xEF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x6B,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xD3,0x9C,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x10,0x61,0x10,0x40,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x65,0x51,0xA6,0x69,0x84,0x59,0x11,0xB5,0xA9,0x8A,0x23,0x41,0xED,0xB3,0x43,0x41,0xAE,0xAC,0xAE,0xAC,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x40,0x08,0xC2,0x20,
-	0x2B,0x93,0x24,0x39,0xA6,0x59,0x23,0x31,0x60,0x10,0x61,0x10,0x20,0x00,0x20,0x08,0xA5,0x61,0xA9,0x92,0x03,0x31,0x20,0x08,0x60,0x10,0x81,0x20,0x03,0x39,0xE3,0x30,0x61,0x18,0x60,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x10,0x40,0x08,0xA2,0x20,0xE3,0x28,0xC2,0x20,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x81,0x18,0x61,0x10,
-	0x61,0x10,0x81,0x18,0xA2,0x20,0xA2,0x18,0x62,0x18,0x82,0x18,0x82,0x18,0x82,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x41,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,
-	0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,0xFB,0xDE,0xDE,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xEF,0x7B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x10,0x21,0x08,0xA2,0x18,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x10,0xEA,0x72,0xA6,0x71,0xF1,0xBC,0xE9,0x8A,0x65,0x51,0xC6,0x71,0xD4,0xE5,0x43,0x41,0xE1,0x20,0xE2,0x28,0x20,0x08,0x20,0x00,0x60,0x08,0x02,0x31,0xE4,0x30,0xA1,0x20,
-	0xAC,0xAB,0x64,0x41,0x60,0x08,0x20,0x08,0x60,0x08,0x81,0x18,0x40,0x08,0x20,0x00,0x03,0x31,0xC6,0x59,0xA1,0x20,0x40,0x10,0x23,0x49,0x07,0x7A,0x06,0x7A,0x65,0x49,0x81,0x18,0x20,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x24,0x39,0x24,0x39,0x24,0x31,0xC2,0x20,0xA1,0x10,0x81,0x18,0x81,0x18,0x81,0x18,0x61,0x18,
-	0x61,0x10,0x81,0x18,0xA2,0x18,0xA2,0x18,0x82,0x18,0x82,0x18,0x82,0x10,0x82,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC7,0x39,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xEB,0x5A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x71,0x8C,
-	0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xF3,0x9C,0x85,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x81,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0xA2,0x20,0x04,0x39,0x41,0x18,0x0E,0xB4,0xAD,0x93,0x60,0x08,0xA1,0x28,0xE6,0x69,0x60,0x10,0x20,0x00,0x40,0x08,0x00,0x00,0x40,0x00,0x40,0x10,0xED,0x9B,0x92,0xD5,0x84,0x41,
-	0x81,0x10,0x20,0x08,0x41,0x10,0x20,0x00,0x20,0x08,0x60,0x10,0x60,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x40,0x08,0x81,0x18,0x07,0x7A,0xE9,0xBA,0x47,0x8A,0x04,0x39,0x40,0x10,0x40,0x10,0x61,0x18,0x61,0x18,0x61,0x10,0x81,0x10,0xA1,0x18,0xE3,0x30,0x24,0x39,0x24,0x39,0xC2,0x20,0xA1,0x18,0xA2,0x20,0x82,0x20,0x81,0x20,0xA2,0x20,
-	0xA2,0x20,0xA2,0x20,0x82,0x20,0x82,0x20,0x81,0x18,0x61,0x10,0x62,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x28,0x42,0x14,0xA5,0x99,0xCE,0x1B,0xDF,0x3C,0xE7,0x9D,0xEF,0x7D,0xEF,0x3C,0xE7,0xDA,0xD6,0xB6,0xB5,0x4D,0x6B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0x6D,0x6B,0x75,0xAD,0x9A,0xD6,0x3C,0xE7,0x7D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x3C,0xE7,0xDA,0xD6,0xF7,0xBD,0xEF,0x7B,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x62,0x10,0x40,0x08,0x20,0x00,0xC3,0x10,0x49,0x5A,0xC3,0x28,0x65,0x49,0x81,0x20,0xEE,0x9B,0x4C,0x83,0x61,0x20,0x0E,0xAC,0x44,0x51,0x20,0x08,0x60,0x08,0x40,0x08,0xE2,0x20,0xEE,0x8B,0xE1,0x28,0x23,0x39,0x0D,0xC4,0xCB,0x9B,
-	0x40,0x18,0x20,0x08,0x60,0x10,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x44,0x51,0xA9,0x92,0x65,0x61,0x60,0x18,0x20,0x08,0x40,0x10,0x61,0x18,0x61,0x18,0x61,0x18,0x82,0x18,0xA2,0x18,0xA2,0x20,0xE3,0x28,0xC2,0x20,0xA2,0x18,0xA1,0x18,0xA2,0x20,0xA2,0x20,0xC2,0x28,0xC2,0x28,
-	0xC3,0x28,0xE3,0x28,0xC3,0x28,0xA2,0x18,0x82,0x18,0x61,0x10,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x45,0x29,0xA6,0x31,0x86,0x31,0x24,0x21,0xC3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x86,0x31,0xA6,0x31,0xA6,0x31,0x86,0x31,0x45,0x29,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x08,0xA3,0x20,0x62,0x20,0x82,0x20,0x8C,0xA3,0xC6,0x51,0x44,0x51,0x93,0xE5,0xC2,0x40,0x20,0x08,0x61,0x10,0x20,0x08,0x64,0x39,0xF2,0xD5,0x4C,0xAC,0xA8,0x7A,0x81,0x20,0xC2,0x28,
-	0x41,0x08,0x21,0x08,0x40,0x08,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x20,0x08,0x40,0x08,0x40,0x10,0x20,0x08,0x41,0x10,0x81,0x20,0x24,0x49,0x44,0x49,0xC2,0x20,0x20,0x08,0x20,0x00,0x40,0x08,0x41,0x10,0x61,0x18,0x81,0x20,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xC3,0x20,0xE3,0x28,0xA3,0x28,
-	0xE3,0x28,0xE3,0x28,0xE3,0x28,0xA2,0x20,0x82,0x18,0x62,0x10,0x61,0x18,0x61,0x10,0x61,0x10,0x62,0x10,0x61,0x08,0x61,0x08,0x41,0x08,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x61,0x08,0x41,0x00,0x21,0x00,0x65,0x39,0x04,0x39,0xE7,0x61,0xC2,0x30,0xA5,0x51,0xA2,0x38,0x88,0x7A,0xB0,0xCC,0x61,0x18,0x20,0x08,0x60,0x08,0x60,0x10,0x20,0x00,0xA1,0x20,0x44,0x49,0x06,0x62,0x20,0x08,0x40,0x08,
-	0x61,0x08,0x40,0x08,0x40,0x10,0x20,0x08,0x20,0x08,0x40,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x40,0x08,0x60,0x18,0x03,0x41,0x44,0x51,0x44,0x41,0x24,0x41,0xC2,0x28,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x10,0x61,0x18,0x81,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x20,0xA2,0x20,0xA2,0x20,0xA2,0x20,
-	0xE3,0x28,0xE3,0x30,0xC3,0x28,0xA2,0x20,0x82,0x18,0x62,0x18,0x62,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x00,0x61,0x00,0x41,0x08,0x82,0x18,0x86,0x51,0x6A,0x7A,0xE7,0x61,0xE7,0x69,0xC3,0x48,0xA2,0x40,0x40,0x10,0x20,0x00,0x40,0x08,0x80,0x18,0x80,0x10,0x81,0x10,0x60,0x18,0x80,0x18,0x41,0x08,0x81,0x18,
-	0x20,0x08,0x40,0x08,0x61,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x60,0x18,0x03,0x41,0x45,0x51,0xE3,0x30,0x81,0x20,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x20,0x82,0x20,0x81,0x18,0xA2,0x18,0xA2,0x18,0xA1,0x10,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xC2,0x18,0xA2,0x18,0x82,0x18,0x81,0x18,
-	0xC3,0x20,0x03,0x29,0xC2,0x28,0x62,0x20,0xA2,0x20,0xA2,0x18,0x61,0x18,0x62,0x10,0x81,0x10,0x61,0x10,0x81,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x21,0x00,0x20,0x00,0x62,0x10,0x04,0x29,0x25,0x39,0xA7,0x59,0x48,0x62,0x32,0xBD,0xEE,0xA3,0x23,0x59,0x41,0x10,0x20,0x00,0x20,0x00,0x60,0x08,0x20,0x08,0xA1,0x18,0xE1,0x30,0x68,0x82,0x02,0x31,0x09,0x9B,
-	0xE3,0x38,0x40,0x10,0x40,0x08,0x20,0x08,0x60,0x08,0x60,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x18,0x81,0x20,0x60,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0xE3,0x28,0x03,0x31,0xA2,0x20,0x81,0x18,0xA2,0x18,0x82,0x10,0x82,0x10,0xA2,0x18,0xA2,0x20,0xC2,0x20,0xA2,0x18,0x61,0x10,0x61,0x10,
-	0x81,0x18,0x82,0x18,0x82,0x20,0x82,0x20,0x82,0x20,0x82,0x18,0x61,0x18,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x62,0x18,0xA2,0x18,0xC3,0x20,0x25,0x41,0x04,0x41,0x6C,0xA3,0x85,0x61,0xA6,0x69,0xE3,0x40,0x20,0x08,0x20,0x00,0x20,0x08,0x00,0x00,0x40,0x00,0x23,0x31,0x0E,0xA4,0xE2,0x30,0x27,0x72,
-	0x03,0x39,0x61,0x18,0x61,0x18,0x65,0x49,0x24,0x31,0x41,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x10,0x60,0x10,0x60,0x10,0x40,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x08,0xC3,0x28,0x04,0x39,0xA2,0x28,0x61,0x10,0x61,0x10,0x81,0x10,0x81,0x10,0x82,0x18,0xA2,0x18,0xA2,0x20,0xC2,0x20,0xA2,0x18,0xA1,0x10,
-	0xA2,0x20,0xA2,0x20,0xA2,0x20,0x81,0x18,0xA2,0x20,0xA2,0x20,0x62,0x18,0x82,0x18,0x61,0x18,0x62,0x10,0x81,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA6,0x31,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x30,0x84,0x00,0x00,0x14,0xA5,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xF3,0x9C,0x04,0x21,0x00,0x00,0xA2,0x10,0xD7,0xBD,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x6D,0x6B,0xBA,0xD6,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x40,0x08,0xA2,0x28,0xA2,0x18,0xE4,0x20,0xE3,0x28,0x25,0x39,0x4F,0xAC,0x45,0x51,0xC9,0x92,0x65,0x59,0x60,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x60,0x18,0x60,0x08,0x60,0x00,
-	0x60,0x08,0x60,0x08,0x81,0x20,0xC6,0x71,0x86,0x61,0x61,0x18,0x61,0x18,0xA2,0x20,0x00,0x00,0x00,0x00,0x40,0x10,0x03,0x31,0xC2,0x28,0x40,0x10,0x60,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x18,0xA2,0x20,0x81,0x20,0xE3,0x28,0xA2,0x18,0x61,0x10,0x61,0x10,0x60,0x08,0x81,0x18,0xC2,0x20,0xE3,0x30,0x03,0x31,0xE3,0x28,
-	0xE2,0x20,0xE2,0x20,0xC3,0x28,0x82,0x20,0xA2,0x20,0xC3,0x20,0xC2,0x28,0xC3,0x20,0xC2,0x18,0x82,0x10,0x61,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xD7,0xBD,0x71,0x8C,0x71,0x8C,0x71,0x8C,0xCB,0x5A,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x71,0x8C,0x71,0x8C,0xF3,0x9C,0x9D,0xEF,0x38,0xC6,0xA2,0x10,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x99,0xCE,0xDE,0xF7,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x71,0x8C,0xFF,0xFF,0xF7,0xBD,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA3,0x28,0xC3,0x28,0xA2,0x18,0xE3,0x20,0xC3,0x28,0x0B,0x93,0x25,0x41,0xE3,0x30,0xA2,0x30,0x40,0x10,0x40,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x60,0x10,0x40,0x08,
-	0xC1,0x28,0xA2,0x20,0x40,0x10,0x81,0x20,0xC2,0x28,0x61,0x18,0x44,0x41,0x85,0x51,0x82,0x18,0x20,0x00,0x40,0x10,0xC2,0x28,0xE3,0x28,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x08,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x10,0x04,0x39,0x24,0x41,0xE3,0x28,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0xC2,0x20,0xE3,0x28,0x24,0x41,0x24,0x39,
-	0xC3,0x28,0xC3,0x28,0xC3,0x28,0xA2,0x20,0xA2,0x20,0xC3,0x28,0xE3,0x28,0xC3,0x28,0xE3,0x20,0xA2,0x18,0x61,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xD2,0x94,0x7D,0xEF,0x86,0x31,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0x38,0xC6,0x30,0x84,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x3C,0xE7,0x17,0xBE,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x10,0x04,0x39,0x24,0x31,0x03,0x29,0xC2,0x20,0x48,0x6A,0xE3,0x30,0xEA,0x6A,0xA2,0x30,0x61,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x00,0x00,0x00,0x00,0x40,0x10,0xAC,0xA3,0x65,0x39,
-	0x27,0x62,0x28,0x62,0x40,0x10,0x60,0x08,0x61,0x18,0xA2,0x20,0x03,0x39,0x44,0x41,0x81,0x10,0x40,0x08,0x40,0x08,0x61,0x18,0x60,0x10,0x20,0x08,0x20,0x08,0x60,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0xA1,0x18,0x44,0x51,0x86,0x59,0x03,0x31,0x81,0x10,0x20,0x08,0x20,0x00,0x40,0x00,0x81,0x10,0xC3,0x28,0x24,0x39,0x04,0x31,
-	0xE3,0x28,0xE3,0x28,0x04,0x31,0xA3,0x28,0xA2,0x20,0xE3,0x28,0xE3,0x30,0xC3,0x28,0xE3,0x28,0xA2,0x18,0x61,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x9D,0xEF,0xA6,0x31,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x69,0x4A,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x3C,0xE7,0x34,0xA5,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0xC3,0x20,0x04,0x31,0x04,0x29,0xC2,0x28,0xEB,0x8A,0x25,0x41,0x82,0x20,0xEB,0x7A,0xE3,0x30,0x40,0x08,0xA1,0x18,0x2E,0xB4,0xA2,0x20,0x20,0x00,0x21,0x08,0x06,0x72,0xE2,0x20,
-	0xA1,0x20,0xA2,0x20,0x60,0x10,0x61,0x10,0x61,0x10,0xA2,0x18,0xA2,0x20,0x81,0x10,0x61,0x10,0x61,0x10,0x81,0x10,0x60,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x40,0x10,0x40,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0xA2,0x18,0x03,0x31,0x45,0x49,0xE3,0x28,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x61,0x10,0x82,0x18,0xC2,0x18,0xC2,0x20,
-	0xC3,0x28,0x44,0x41,0x44,0x39,0xC3,0x28,0xA2,0x28,0xC3,0x28,0x04,0x39,0xE4,0x30,0xC3,0x28,0x82,0x18,0x61,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xD7,0xBD,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x08,0x42,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x24,0x21,0x24,0x21,0xC7,0x39,0x79,0xCE,0xFB,0xDE,0x24,0x21,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x4A,0x7D,0xEF,0xFF,0xFF,0x9D,0xEF,0xD7,0xBD,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0xE4,0x20,0xE4,0x30,0xC3,0x20,0x07,0x5A,0x08,0x62,0x82,0x10,0x89,0x82,0x0A,0x93,0xC3,0x20,0x40,0x08,0x03,0x21,0x40,0x08,0x02,0x29,0x47,0x7A,0x40,0x18,0x41,0x08,
-	0x20,0x08,0x41,0x10,0x60,0x10,0x61,0x10,0x62,0x18,0xA2,0x18,0xA2,0x20,0xA1,0x18,0x81,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x60,0x08,0x20,0x00,0x20,0x00,0x40,0x08,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x60,0x10,0xA2,0x20,0xE2,0x28,0x61,0x18,0x61,0x10,0x40,0x08,0x20,0x00,0x60,0x08,0x61,0x10,0x62,0x10,0x82,0x10,0x62,0x10,
-	0xC3,0x20,0x24,0x31,0x03,0x31,0xE3,0x30,0xC2,0x28,0xA2,0x28,0xE3,0x30,0xE3,0x30,0xA2,0x28,0x62,0x18,0x61,0x10,0x61,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x5D,0xEF,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x6D,0x6B,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x3C,0xE7,0x3C,0xE7,0x7D,0xEF,0x9D,0xEF,0x0C,0x63,0x20,0x00,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x34,0xA5,0xE7,0x39,0x0C,0x63,0xFB,0xDE,0x7D,0xEF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xA2,0x18,0xA3,0x20,0xC3,0x20,0xA3,0x18,0xCB,0x82,0xC2,0x20,0x86,0x49,0x4C,0x9B,0xA6,0x51,0xA3,0x10,0x20,0x00,0x20,0x00,0xE2,0x20,0x69,0x6A,0x61,0x18,0xA1,0x10,
-	0x20,0x08,0x40,0x08,0x61,0x10,0x82,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x18,0x81,0x10,0x82,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x40,0x08,0x20,0x08,0x40,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x40,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x41,0x08,0x61,0x08,0x61,0x10,0x61,0x18,0x82,0x18,0x62,0x10,
-	0xA3,0x18,0xE3,0x28,0xE3,0x28,0xE3,0x28,0xC2,0x28,0xA2,0x28,0xA2,0x28,0xA3,0x28,0xA2,0x28,0xA2,0x18,0x61,0x10,0x61,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x8A,0x52,0x17,0xBE,0x7D,0xEF,0x08,0x42,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x62,0x18,0xC3,0x20,0x04,0x21,0x66,0x39,0xC3,0x28,0xA3,0x20,0x82,0x20,0x45,0x51,0x05,0x39,0x82,0x08,0xE5,0x18,0x41,0x00,0x21,0x08,0x40,0x10,0x81,0x18,
-	0x41,0x08,0x41,0x08,0xA2,0x10,0xA3,0x18,0xA2,0x18,0xC3,0x18,0xE3,0x18,0xE3,0x20,0xA2,0x18,0xC3,0x18,0x82,0x10,0xA2,0x10,0x82,0x10,0x61,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x62,0x08,0xA2,0x08,0xC4,0x08,0xA3,0x08,0x62,0x08,0x61,0x00,0x82,0x10,0xA3,0x18,0xA3,0x18,0x41,0x10,0x61,0x10,0x61,0x10,0x62,0x10,0x82,0x10,0x82,0x10,
-	0x82,0x10,0xC3,0x20,0xE3,0x28,0xC3,0x20,0xA2,0x18,0xA2,0x20,0xA2,0x28,0xC2,0x28,0xA2,0x28,0xA2,0x20,0x81,0x10,0x61,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x40,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x00,0x00,0xE3,0x18,0x5C,0xE7,0x59,0xCE,0xA2,0x10,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x18,0x62,0x18,0x61,0x10,0xC2,0x28,0xC2,0x20,0x82,0x20,0xC2,0x30,0x24,0x49,0x62,0x20,0x62,0x08,0xE3,0x18,0xEB,0x8A,0xCA,0x8A,0x68,0x7A,
-	0x62,0x18,0x62,0x00,0x82,0x10,0xA3,0x18,0xC3,0x18,0xA3,0x10,0x45,0x31,0x86,0x49,0x03,0x21,0x04,0x21,0xE4,0x18,0xE4,0x10,0xC4,0x08,0xC3,0x08,0x62,0x00,0x62,0x00,0xA2,0x08,0xA4,0x00,0xC4,0x08,0xC4,0x08,0xE5,0x08,0x05,0x09,0x05,0x11,0x25,0x21,0x05,0x21,0xC3,0x18,0x62,0x10,0x81,0x10,0xA2,0x10,0xA2,0x18,0xA2,0x18,0x82,0x18,
-	0x62,0x10,0x82,0x10,0x61,0x10,0x62,0x18,0x61,0x10,0x61,0x10,0x82,0x20,0xA2,0x20,0xA2,0x20,0xA3,0x20,0xA2,0x20,0x61,0x10,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x00,0x00,0x00,0x00,0x4D,0x6B,0xBE,0xF7,0xF3,0x9C,0x41,0x08,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFB,0xDE,0xE7,0x39,0xC3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x10,0x61,0x18,0x03,0x31,0xE3,0x30,0xC3,0x28,0x82,0x28,0x45,0x49,0xA2,0x40,0xA2,0x20,0x82,0x18,0x68,0x82,0x4E,0xCC,0x0E,0xBC,
-	0xC3,0x28,0x61,0x08,0x61,0x08,0xA2,0x20,0x45,0x41,0xC2,0x18,0x25,0x29,0xA7,0x51,0xE3,0x18,0x04,0x19,0x25,0x21,0x04,0x19,0xC4,0x10,0xC4,0x08,0xC5,0x00,0xC4,0x00,0x83,0x00,0x62,0x00,0xA3,0x08,0xA3,0x10,0xA3,0x08,0xC3,0x08,0x25,0x19,0x87,0x31,0x67,0x31,0x25,0x21,0xC3,0x20,0x82,0x18,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xA2,0x18,
-	0x82,0x18,0x61,0x10,0x61,0x10,0x62,0x10,0x61,0x10,0x81,0x10,0x61,0x18,0xA2,0x20,0xA3,0x28,0x04,0x31,0x04,0x39,0xE3,0x20,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0x00,0x00,0x00,0x00,0x41,0x08,0x75,0xAD,0x9D,0xEF,0xCB,0x5A,0xC3,0x18,0xBA,0xD6,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x1C,0xE7,0x5C,0xE7,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x24,0x31,0xE4,0x28,0xC7,0x49,0x65,0x41,0x81,0x18,0xE4,0x38,0xC3,0x40,0x03,0x39,0xE3,0x38,0x8C,0x9B,0x08,0x6A,0x66,0x39,
-	0xE4,0x20,0x62,0x18,0x61,0x08,0xC2,0x20,0x48,0x6A,0x25,0x31,0xA2,0x10,0xE3,0x18,0xA3,0x10,0xC3,0x10,0x04,0x21,0x04,0x21,0x25,0x19,0xE4,0x08,0xE5,0x00,0xC4,0x00,0x83,0x00,0x82,0x00,0x61,0x00,0x82,0x08,0xA3,0x10,0xA3,0x00,0xC3,0x18,0x04,0x29,0x67,0x29,0x05,0x19,0xC4,0x20,0xC3,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x18,0xA3,0x18,
-	0x82,0x18,0x62,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x10,0xA2,0x20,0x04,0x31,0x86,0x51,0x66,0x51,0x24,0x31,0xA2,0x20,0x62,0x10,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0xAE,0x73,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xAE,0x73,0x0C,0x63,0x61,0x08,0x2C,0x63,0xCA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xAE,0x73,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x03,0x29,0xA2,0x28,0x24,0x39,0xA2,0x20,0x24,0x39,0x03,0x31,0xE3,0x30,0x81,0x18,0x24,0x39,0x07,0x62,0x82,0x38,0x28,0x6A,
-	0x29,0x4A,0x69,0x62,0xA6,0x59,0x82,0x18,0x24,0x39,0xC3,0x20,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC3,0x20,0xE4,0x28,0x45,0x29,0xC3,0x18,0x83,0x00,0x82,0x00,0xA4,0x08,0x82,0x00,0x61,0x00,0x82,0x08,0x82,0x10,0x61,0x08,0x82,0x10,0xA3,0x18,0xE4,0x18,0x05,0x19,0x26,0x21,0x26,0x21,0xC4,0x10,0xE4,0x10,0x05,0x19,0xE5,0x18,
-	0xC3,0x18,0x82,0x10,0x82,0x10,0x62,0x08,0x61,0x10,0x61,0x10,0x61,0x18,0xA2,0x20,0x24,0x39,0xA6,0x59,0x08,0x6A,0x45,0x49,0xC3,0x20,0x62,0x10,0x61,0x08,0x21,0x08,0x41,0x08,0x41,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x86,0x39,0x20,0x08,0x81,0x18,0xA6,0x49,0x65,0x41,0x08,0x62,0xA1,0x20,0x21,0x10,0x04,0x31,0xA2,0x28,0x45,0x41,
-	0x82,0x10,0x85,0x49,0x08,0x62,0xA2,0x20,0xC3,0x30,0xC3,0x28,0xA2,0x18,0xA2,0x10,0x82,0x10,0xA2,0x10,0xA2,0x18,0x24,0x31,0x65,0x39,0xE3,0x20,0x20,0x00,0x20,0x00,0x62,0x00,0xA3,0x08,0x82,0x00,0x61,0x08,0x62,0x08,0x41,0x08,0x62,0x08,0xC4,0x10,0xC4,0x10,0x05,0x19,0x05,0x19,0x05,0x19,0x05,0x19,0xC4,0x10,0xC4,0x10,0xE5,0x18,
-	0xE4,0x20,0xE4,0x18,0xC3,0x10,0x41,0x08,0x41,0x10,0x61,0x10,0x61,0x10,0xC2,0x20,0xE4,0x28,0x86,0x51,0xC7,0x69,0x86,0x59,0x24,0x39,0xC3,0x20,0x41,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x60,0x10,0x20,0x10,0x44,0x39,0x24,0x39,0x61,0x18,0x81,0x18,0xA1,0x20,0x24,0x39,0xA3,0x28,0x41,0x10,
-	0x41,0x08,0x40,0x08,0x82,0x10,0x62,0x10,0xA3,0x20,0xA2,0x20,0x82,0x18,0x82,0x10,0xA2,0x10,0x82,0x10,0x82,0x10,0xE3,0x28,0x24,0x31,0x82,0x18,0x20,0x08,0x20,0x08,0x41,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x62,0x10,0x62,0x08,0x82,0x08,0xC4,0x10,0xC4,0x10,0xA3,0x10,0xC3,0x18,0xE4,0x18,0xC4,0x18,0xC4,0x18,0xC4,0x10,0xE4,0x18,
-	0xC4,0x18,0xC4,0x18,0x82,0x08,0x20,0x08,0x40,0x08,0x61,0x10,0x61,0x10,0x82,0x18,0xE2,0x20,0x25,0x39,0xA7,0x61,0xA7,0x61,0x45,0x49,0x04,0x31,0xC3,0x20,0x62,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x40,0x08,0x41,0x10,0xA2,0x20,0x82,0x20,0xA2,0x20,0xC3,0x38,0x04,0x49,0x41,0x18,0x40,0x08,
-	0xA2,0x10,0x45,0x29,0xE3,0x18,0x40,0x00,0x61,0x08,0x41,0x10,0xA2,0x10,0x82,0x10,0x81,0x10,0x61,0x08,0x81,0x10,0x61,0x10,0x40,0x08,0x20,0x08,0x61,0x08,0x61,0x08,0x40,0x08,0xA1,0x10,0x41,0x00,0x20,0x00,0x61,0x08,0x40,0x10,0x61,0x08,0xC3,0x10,0xA2,0x10,0xA2,0x18,0xC3,0x18,0xA3,0x18,0xA3,0x18,0x06,0x21,0xC4,0x10,0xE4,0x18,
-	0x04,0x21,0xC4,0x10,0x82,0x08,0x40,0x08,0x20,0x08,0x60,0x08,0x61,0x10,0x82,0x18,0xC3,0x20,0xE3,0x28,0x25,0x39,0x25,0x41,0x24,0x41,0x24,0x39,0xE3,0x28,0xC2,0x18,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0x40,0x08,0x61,0x18,0x65,0x41,0x28,0x62,0x04,0x41,0xE7,0x61,0xC2,0x28,0xA2,0x20,
-	0x65,0x39,0xE3,0x20,0xC3,0x18,0x82,0x10,0xA2,0x20,0xC3,0x18,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x08,0x41,0x08,0x41,0x08,0x81,0x08,0x21,0x00,0x20,0x00,0x61,0x10,0x03,0x29,0xC3,0x20,0x61,0x08,0x61,0x08,0x20,0x10,0x61,0x08,0xA3,0x10,0xA2,0x10,0xE3,0x20,0x25,0x29,0x04,0x29,0xA3,0x18,0xE4,0x18,0xE4,0x18,0xA2,0x10,
-	0xC3,0x18,0xE5,0x18,0xC3,0x08,0x62,0x00,0x62,0x08,0x40,0x10,0x61,0x10,0x82,0x18,0xE3,0x20,0xE3,0x28,0xE3,0x28,0x24,0x39,0x65,0x49,0x45,0x39,0x24,0x31,0xE3,0x20,0x62,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x40,0x08,0x40,0x08,0x04,0x31,0x86,0x51,0xA3,0x28,0x49,0x72,0x25,0x41,0xA2,0x20,
-	0x04,0x31,0x62,0x10,0x61,0x08,0x81,0x10,0xA6,0x59,0x65,0x39,0x61,0x10,0x61,0x08,0xA3,0x18,0xA2,0x18,0x82,0x10,0xC4,0x18,0xC3,0x18,0x41,0x08,0x61,0x08,0x62,0x08,0x81,0x10,0x03,0x31,0x03,0x29,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x08,0xC2,0x18,0x05,0x29,0x25,0x31,0x45,0x39,0xC3,0x18,0xC4,0x18,0xC3,0x10,0xA2,0x10,
-	0xA2,0x18,0xC3,0x10,0x61,0x08,0x41,0x00,0x82,0x08,0x41,0x08,0x61,0x10,0xC3,0x20,0xE3,0x20,0x04,0x29,0x04,0x29,0x04,0x39,0x86,0x51,0x66,0x41,0x65,0x39,0x24,0x29,0x82,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0x41,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x61,0x08,0x62,0x18,0x41,0x18,0x61,0x10,0xC3,0x28,0xC3,0x30,0x24,0x39,
-	0xA2,0x28,0x41,0x10,0x20,0x08,0x40,0x10,0xC2,0x30,0x62,0x20,0x40,0x00,0x20,0x08,0x61,0x08,0xC3,0x28,0x44,0x39,0xC3,0x20,0x82,0x10,0x62,0x10,0x62,0x08,0x61,0x08,0x20,0x00,0x81,0x10,0xA2,0x18,0x40,0x08,0x41,0x00,0x41,0x08,0x83,0x08,0xA2,0x10,0x04,0x21,0x25,0x29,0x24,0x29,0x24,0x29,0xC3,0x18,0xC3,0x18,0xA3,0x18,0xA2,0x10,
-	0xA2,0x10,0x82,0x10,0x61,0x10,0x61,0x08,0x20,0x08,0x41,0x08,0x61,0x10,0xC3,0x20,0xE3,0x20,0x04,0x29,0x45,0x39,0x25,0x39,0x45,0x41,0x65,0x39,0x46,0x31,0xE4,0x28,0xA2,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x20,0xE3,0x28,0x61,0x10,0xA2,0x18,0x24,0x39,0xC7,0x51,
-	0x04,0x39,0xE2,0x28,0x62,0x18,0x81,0x10,0xA1,0x18,0x81,0x18,0x62,0x10,0x41,0x00,0x40,0x08,0xC2,0x20,0x24,0x39,0xA2,0x18,0x62,0x10,0x61,0x10,0x82,0x10,0x62,0x08,0x41,0x00,0x41,0x08,0x81,0x10,0x82,0x10,0x62,0x10,0xA3,0x10,0x61,0x08,0x82,0x10,0xE4,0x20,0x25,0x29,0x03,0x21,0xA2,0x10,0xA3,0x10,0xA3,0x10,0xA2,0x10,0x62,0x10,
-	0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x21,0x08,0x41,0x08,0x61,0x10,0xC2,0x20,0xE3,0x20,0x44,0x31,0x86,0x41,0x86,0x41,0x66,0x41,0x45,0x39,0x25,0x29,0x04,0x21,0xC3,0x18,0x62,0x10,0x61,0x08,0x62,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x62,0xE4,0x30,0xC3,0x20,0xE3,0x28,0x45,0x41,
-	0x65,0x51,0x24,0x39,0xE3,0x28,0x41,0x10,0x04,0x21,0x20,0x00,0x41,0x08,0x20,0x08,0x20,0x08,0x61,0x10,0x82,0x18,0x61,0x18,0xA2,0x10,0x61,0x10,0x61,0x08,0x82,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x10,0x61,0x08,0xA2,0x10,0x61,0x10,0x61,0x08,0xA3,0x18,0xC2,0x18,0x61,0x10,0x62,0x10,0xA3,0x10,0xA2,0x10,0x82,0x10,0xA2,0x18,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x40,0x08,0x40,0x08,0x60,0x08,0x61,0x18,0xC2,0x20,0x24,0x31,0x65,0x39,0x86,0x41,0xC7,0x49,0xA7,0x49,0x45,0x39,0x25,0x29,0x04,0x21,0xA3,0x18,0x61,0x08,0x62,0x08,0x61,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x49,0x24,0x31,0xE4,0x28,0x45,0x49,
-	0xAA,0x72,0x08,0x62,0x24,0x39,0x04,0x29,0x81,0x08,0x20,0x00,0x20,0x00,0x40,0x08,0x82,0x10,0x81,0x18,0x21,0x08,0x61,0x08,0x82,0x18,0x82,0x18,0x61,0x10,0x62,0x08,0x41,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x82,0x10,0x62,0x10,0x82,0x10,0x82,0x10,0x62,0x08,0x61,0x10,0x61,0x08,0x62,0x08,0xA3,0x10,0x82,0x08,0xC3,0x20,0x04,0x29,
-	0xC3,0x20,0xA2,0x10,0xA3,0x18,0x81,0x10,0x40,0x08,0x21,0x08,0x61,0x10,0x61,0x10,0xA2,0x18,0xE3,0x20,0x45,0x31,0xA7,0x41,0xC7,0x49,0xE8,0x49,0x87,0x41,0x46,0x31,0x04,0x29,0xC3,0x18,0x82,0x10,0x62,0x10,0x82,0x10,0x62,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x41,0x45,0x31,0xA7,0x51,
-	0x45,0x39,0xC3,0x28,0xC3,0x28,0xC3,0x20,0x82,0x18,0x41,0x08,0x24,0x29,0x40,0x00,0xE3,0x28,0x45,0x41,0x41,0x10,0x61,0x10,0x04,0x29,0x86,0x39,0xC3,0x20,0x82,0x10,0x41,0x08,0x61,0x00,0x41,0x08,0x82,0x10,0x62,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x62,0x08,0x82,0x10,0x82,0x08,0x82,0x08,0x82,0x08,0x62,0x08,0x04,0x21,0x04,0x29,
-	0xE3,0x28,0xE4,0x20,0xE3,0x20,0xC3,0x20,0x61,0x10,0x41,0x10,0x61,0x10,0x61,0x10,0x82,0x18,0xE3,0x20,0x25,0x29,0x86,0x39,0xA7,0x49,0xE8,0x49,0x86,0x41,0x25,0x31,0x04,0x29,0xE4,0x20,0xA3,0x10,0x82,0x10,0x82,0x10,0x62,0x10,0x61,0x08,0x40,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x49,
-	0xE7,0x49,0xA3,0x18,0xE3,0x20,0xA3,0x28,0xC2,0x28,0x61,0x10,0xE3,0x18,0xE4,0x18,0xC2,0x18,0xE3,0x20,0x62,0x10,0x82,0x10,0x04,0x31,0x24,0x39,0x82,0x18,0xA2,0x18,0x82,0x10,0xA2,0x10,0x82,0x10,0xA2,0x08,0x62,0x10,0x82,0x10,0x82,0x10,0xA3,0x18,0xA2,0x10,0x62,0x10,0x62,0x08,0xA3,0x10,0x61,0x08,0x61,0x08,0xA3,0x18,0xE4,0x20,
-	0xE2,0x20,0x03,0x21,0xA3,0x20,0xE2,0x20,0x61,0x10,0x61,0x10,0x61,0x10,0x61,0x18,0x82,0x10,0x04,0x21,0x25,0x29,0x45,0x31,0x65,0x39,0x86,0x41,0x66,0x39,0x25,0x31,0x04,0x29,0xE4,0x20,0xC3,0x18,0xA2,0x10,0x82,0x10,0x82,0x10,0x62,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x39,0x04,0x29,0xE3,0x20,0xA3,0x20,0xEB,0x72,0xC3,0x28,0x60,0x10,0x20,0x00,0x21,0x08,0x61,0x10,0x62,0x10,0xC3,0x18,0xC3,0x20,0xC3,0x20,0x04,0x29,0x04,0x29,0xC3,0x18,0xA2,0x10,0x82,0x10,0xA2,0x10,0x82,0x10,0xA3,0x10,0x83,0x10,0xA3,0x10,0xA3,0x10,0x62,0x10,0x62,0x10,0x82,0x10,0x62,0x08,0x61,0x08,0x61,0x08,0x81,0x10,
-	0x81,0x10,0x82,0x10,0xE3,0x18,0xC3,0x10,0x21,0x08,0x21,0x08,0x61,0x10,0x82,0x10,0xA2,0x18,0xE4,0x20,0x26,0x29,0x25,0x29,0x45,0x29,0x24,0x29,0xE4,0x28,0xE4,0x20,0xE4,0x20,0x04,0x21,0xC3,0x18,0xA2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x62,0x08,0x41,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x04,0x31,0x04,0x29,0x45,0x39,0x69,0x62,0x82,0x20,0xC2,0x20,0x82,0x18,0x03,0x29,0x03,0x29,0x62,0x10,0xC3,0x18,0xC3,0x20,0x25,0x31,0x25,0x31,0xA7,0x39,0x04,0x21,0xE4,0x18,0xC3,0x18,0x25,0x19,0x05,0x19,0xA3,0x10,0xC3,0x18,0x04,0x21,0xA2,0x10,0x82,0x10,0x62,0x08,0x62,0x10,0x62,0x08,0x62,0x08,0xA3,0x10,0x61,0x08,
-	0x41,0x08,0x20,0x08,0x20,0x00,0x41,0x00,0x82,0x08,0x62,0x08,0xA2,0x08,0xA2,0x10,0xA2,0x18,0xA3,0x20,0xE4,0x20,0x04,0x21,0xE4,0x18,0xE3,0x20,0xE3,0x20,0xE4,0x28,0x04,0x29,0x04,0x29,0x04,0x21,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x62,0x10,0x62,0x08,0x41,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE4,0x28,0xA7,0x41,0x04,0x29,0xA3,0x28,0xA3,0x28,0x04,0x39,0x66,0x49,0xE3,0x28,0xC3,0x20,0xC3,0x20,0xE4,0x30,0x28,0x52,0x66,0x39,0x66,0x39,0x83,0x10,0xC4,0x10,0xA3,0x18,0x05,0x19,0x05,0x19,0x05,0x19,0x46,0x29,0x66,0x29,0xE4,0x20,0xC4,0x10,0xC3,0x10,0xA3,0x10,0x62,0x10,0x62,0x08,0xA3,0x08,0xC3,0x08,
-	0xC3,0x10,0x20,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x82,0x08,0xC4,0x10,0xA3,0x10,0xC3,0x18,0xA3,0x20,0xE3,0x20,0xC3,0x18,0xC3,0x18,0xE3,0x20,0xE4,0x20,0xE4,0x28,0xE4,0x28,0xE4,0x20,0xA3,0x18,0x82,0x10,0xA2,0x10,0x82,0x10,0x62,0x10,0x61,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x20,0xA2,0x18,0x61,0x10,0xCA,0x62,0x62,0x20,0xA3,0x28,0xA2,0x28,0x62,0x18,0x04,0x29,0x29,0x62,0x69,0x6A,0xAB,0x72,0x45,0x31,0x83,0x10,0x82,0x10,0x62,0x10,0xA3,0x18,0x62,0x10,0xC3,0x18,0x66,0x39,0x66,0x31,0xA4,0x18,0xA3,0x10,0xC4,0x10,0xA3,0x08,0x62,0x08,0x62,0x08,0x82,0x08,0xE4,0x20,
-	0x05,0x21,0xC4,0x10,0x41,0x00,0x21,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x62,0x10,0xC3,0x18,0xE4,0x18,0xE4,0x20,0xC3,0x20,0x25,0x19,0xE4,0x18,0xC3,0x20,0xE3,0x20,0x04,0x21,0xE4,0x20,0xC3,0x20,0xA3,0x18,0xA3,0x10,0x82,0x10,0x82,0x10,0x82,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x08,0x61,0x10,0x69,0x5A,0x07,0x5A,0xA6,0x51,0xE4,0x28,0xA7,0x49,0x26,0x31,0xE8,0x49,0x25,0x31,0xC3,0x18,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xC3,0x18,0x25,0x29,0x04,0x29,0xE4,0x20,0xC4,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x10,0x82,0x08,0x82,0x10,0xE3,0x20,
-	0xE4,0x28,0x05,0x19,0xA3,0x10,0x61,0x10,0x61,0x08,0x62,0x10,0x62,0x08,0x82,0x10,0xA2,0x18,0x82,0x18,0xE4,0x18,0x25,0x21,0x05,0x21,0x06,0x19,0xE4,0x20,0xE3,0x20,0xE4,0x20,0xE4,0x18,0xA2,0x18,0xA3,0x18,0xA3,0x10,0x82,0x10,0x82,0x10,0x82,0x08,0x61,0x08,0x61,0x00,0x41,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0xE3,0x20,0x62,0x18,0x45,0x31,0xC3,0x28,0xA3,0x20,0xA3,0x20,0xA4,0x20,0xC4,0x20,0x82,0x10,0x62,0x10,0x61,0x08,0x61,0x08,0x62,0x10,0xA2,0x18,0xE4,0x20,0xA4,0x18,0xA3,0x18,0xA3,0x10,0x81,0x10,0xC3,0x18,0xA3,0x10,0x41,0x08,0x61,0x08,0xC2,0x10,
-	0x04,0x21,0x05,0x19,0xA3,0x10,0xA2,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xE3,0x18,0xE4,0x20,0xA4,0x18,0x06,0x21,0x25,0x21,0x05,0x19,0xE4,0x18,0xA3,0x18,0xA2,0x18,0xA3,0x18,0xE6,0x10,0x26,0x19,0xA4,0x08,0x82,0x10,0xA2,0x08,0x62,0x08,0x41,0x08,0x41,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x18,0xA3,0x18,0xA3,0x18,0xE4,0x28,0x25,0x31,0xE4,0x20,0xC3,0x18,0x82,0x10,0x62,0x10,0xA2,0x10,0xA2,0x18,0xA3,0x18,0xA3,0x20,0xA3,0x20,0xA3,0x18,0xC3,0x18,0x03,0x29,0x65,0x31,0x24,0x29,0x62,0x08,0x82,0x08,0x82,0x08,
-	0x41,0x08,0xA2,0x08,0xA2,0x10,0xA2,0x18,0x82,0x10,0xA2,0x10,0x82,0x10,0xA3,0x10,0x25,0x29,0x04,0x21,0xA2,0x18,0xA3,0x10,0x67,0x31,0xC3,0x18,0xA3,0x10,0x26,0x19,0xC5,0x10,0x28,0x11,0x6A,0x11,0x8A,0x11,0x27,0x19,0x49,0x09,0xA3,0x10,0x61,0x10,0x62,0x08,0x61,0x08,0x41,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x18,0xA3,0x18,0xCA,0x6A,0x66,0x39,0xE4,0x28,0x46,0x31,0x87,0x39,0xA2,0x10,0x82,0x10,0xA2,0x10,0xA3,0x10,0xC3,0x18,0xC2,0x20,0xA2,0x18,0xA3,0x18,0x04,0x21,0x45,0x31,0x04,0x21,0xA3,0x10,0x62,0x08,0xC2,0x18,
-	0xA2,0x10,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA3,0x18,0xA3,0x10,0xC3,0x10,0xE3,0x18,0xE4,0x18,0xA3,0x20,0xA2,0x18,0xC3,0x18,0xE4,0x18,0xC3,0x18,0xA4,0x10,0x46,0x21,0x46,0x29,0x06,0x19,0x26,0x19,0xC3,0x10,0xA3,0x10,0xE6,0x08,0xC4,0x10,0xA2,0x10,0x62,0x08,0x82,0x08,0x61,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x10,0xC3,0x18,0xC2,0x18,0x82,0x18,0xE4,0x28,0x86,0x39,0xE4,0x20,0xE3,0x18,0x04,0x19,0x04,0x19,0x04,0x21,0xE3,0x20,0x24,0x21,0x45,0x29,0x04,0x19,0xC3,0x18,0xA3,0x10,0x62,0x10,0x82,0x10,0x24,0x21,
-	0x67,0x29,0xA2,0x10,0xC3,0x10,0xC4,0x10,0x04,0x19,0x67,0x29,0x04,0x29,0xC3,0x18,0xA2,0x18,0xC3,0x18,0xC3,0x20,0xA3,0x18,0x62,0x10,0xA3,0x18,0xC5,0x18,0x68,0x29,0x25,0x21,0xC4,0x18,0xA3,0x10,0x82,0x10,0x82,0x10,0xA3,0x10,0xA3,0x08,0x62,0x08,0x62,0x08,0xA3,0x08,0xA3,0x08,0x61,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x18,0xA2,0x10,0x62,0x10,0xC3,0x18,0xC4,0x20,0xE4,0x20,0xA3,0x18,0xC3,0x10,0xE4,0x18,0x05,0x21,0x46,0x21,0x26,0x19,0x05,0x21,0x26,0x21,0x25,0x21,0xE4,0x10,0xE5,0x18,0x88,0x21,
-	0xA9,0x31,0x26,0x19,0x83,0x08,0xC3,0x10,0x05,0x21,0x25,0x31,0x24,0x31,0xC3,0x20,0xA2,0x10,0xC3,0x18,0xC3,0x20,0xA3,0x18,0x05,0x21,0xE4,0x20,0x67,0x31,0x27,0x29,0xEA,0x31,0x67,0x21,0xA4,0x10,0xA2,0x10,0xA3,0x10,0xA2,0x10,0xA3,0x08,0x82,0x08,0xC3,0x08,0x83,0x08,0x83,0x00,0x61,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x25,0x29,0x86,0x41,0xE3,0x20,0xA2,0x10,0xA3,0x18,0xE4,0x18,0xE4,0x18,0xC3,0x10,0x05,0x21,0x67,0x31,0x26,0x29,0x05,0x21,0xE4,0x20,0xA4,0x10,
-	0xC5,0x10,0x05,0x19,0x05,0x19,0x82,0x10,0xA2,0x18,0x66,0x31,0x45,0x29,0xE3,0x18,0xA2,0x10,0xA3,0x18,0xC4,0x20,0x46,0x31,0x86,0x41,0x25,0x29,0x25,0x29,0x25,0x31,0xA8,0x39,0xA8,0x39,0x06,0x19,0xE4,0x10,0xC4,0x18,0xA3,0x10,0xC3,0x08,0x83,0x00,0x06,0x09,0xE4,0x10,0x62,0x00,0x83,0x08,0x61,0x00,0x41,0x00,0x21,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x4A,0x69,0x5A,0x87,0x39,0xA2,0x20,0x82,0x18,0xA3,0x18,0xC3,0x18,0xC3,0x18,0x45,0x39,0x87,0x41,0x04,0x29,0xA3,0x18,0xA2,0x10,0x62,0x08,
-	0x81,0x10,0xA1,0x10,0xA3,0x10,0xC3,0x10,0xA2,0x10,0xC3,0x18,0xE3,0x20,0xC2,0x18,0xA2,0x18,0x82,0x10,0xA3,0x18,0xA3,0x18,0x83,0x18,0xE4,0x20,0x04,0x29,0x25,0x29,0x25,0x31,0x26,0x29,0xE5,0x10,0xA3,0x18,0xA3,0x18,0xE4,0x10,0xC4,0x08,0x06,0x11,0xA4,0x08,0xC4,0x00,0x83,0x08,0xA4,0x08,0x42,0x08,0x41,0x00,0x41,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x62,0x25,0x29,0xC3,0x18,0xA3,0x18,0xC3,0x20,0x46,0x29,0x04,0x21,0xE3,0x18,0xC3,0x18,0x62,0x10,
-	0xA2,0x10,0xC3,0x18,0xA3,0x10,0xE4,0x18,0xC3,0x18,0xA1,0x10,0xE3,0x20,0xE3,0x20,0xC3,0x18,0xA3,0x18,0xA2,0x10,0xA3,0x18,0x82,0x18,0xA2,0x10,0xA3,0x18,0xC3,0x20,0xC3,0x20,0xE4,0x18,0x06,0x21,0xE5,0x20,0x25,0x21,0x88,0x29,0xA9,0x29,0xC3,0x10,0x62,0x00,0xA4,0x00,0xA3,0x00,0x82,0x08,0x82,0x00,0x61,0x00,0x41,0x00,0x21,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x18,0xC3,0x18,0xC3,0x18,0xA3,0x10,0xA3,0x10,0xA3,0x18,0x82,0x10,
-	0x61,0x08,0x62,0x10,0x86,0x41,0xA2,0x18,0xA3,0x18,0xC3,0x18,0x66,0x39,0xE8,0x49,0x04,0x21,0xC3,0x18,0x82,0x10,0xC3,0x18,0x61,0x10,0x62,0x18,0xA3,0x18,0xA3,0x20,0xA3,0x18,0xC4,0x18,0x46,0x21,0xA8,0x29,0xA9,0x21,0xA8,0x31,0x66,0x29,0x26,0x19,0xC3,0x08,0x42,0x08,0x83,0x08,0x42,0x08,0x62,0x00,0x61,0x00,0x41,0x08,0x41,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x29,0xE4,0x20,0xE4,0x18,0xC3,0x18,
-	0xA3,0x10,0xA3,0x10,0x26,0x29,0xE4,0x18,0xE4,0x20,0x04,0x21,0x45,0x29,0x25,0x31,0xA3,0x20,0x82,0x10,0x62,0x08,0x81,0x08,0x61,0x10,0xC3,0x20,0x24,0x29,0x04,0x29,0xC4,0x20,0xC3,0x20,0x25,0x29,0x88,0x31,0xEA,0x31,0xEA,0x39,0xA8,0x39,0x87,0x29,0x25,0x19,0xE6,0x08,0x63,0x00,0x42,0x00,0x62,0x00,0x61,0x08,0x40,0x08,0x41,0x00,
-	0x41,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x10,0x04,0x19,0x25,0x21,0xA3,0x10,0xA3,0x18,0x03,0x21,0x61,0x08,0xA1,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,0x61,0x08,0x82,0x18,0x44,0x31,0x86,0x41,0xC7,0x51,0x66,0x41,0x05,0x29,0x45,0x31,0xC8,0x39,0xA7,0x41,0x4C,0x42,0x2C,0x3A,0xEA,0x31,0x88,0x29,0xAA,0x21,0x28,0x09,0x62,0x00,0x82,0x00,0x61,0x00,0x41,0x00,0x82,0x00,
-	0xE4,0x08,0xA3,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x61,0x08,0x25,0x29,0x46,0x29,0x62,0x08,0xC3,0x18,0x25,0x31,0x45,0x41,0x28,0x5A,0x29,0x5A,0x29,0x52,0x46,0x31,0x87,0x31,0xA7,0x49,0xC8,0x49,0x09,0x4A,0x4A,0x52,0x87,0x31,0x05,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_2051_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_2051_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_2051_dial_img_preview_data_0};
-
-    
\ No newline at end of file
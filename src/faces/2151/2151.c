@@ -578,9 +578,28 @@ void init_face_2151(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_2151_50_95294, 5);
     lv_obj_add_flag(face_2151_50_95294, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_2151_50_95294, LV_OBJ_FLAG_SCROLLABLE );
-
-
-    callback("2151", &face_2151_dial_img_preview_0, &face_2151, NULL);
+	face_compositor_static(face_2151_0_1184);
+	face_compositor_static(face_2151_5_65535);
+	face_compositor_static(face_2151_6_65535);
+	face_compositor_static(face_2151_7_99366);
+	face_compositor_static(face_2151_8_99366);
+	face_compositor_static(face_2151_9_99366);
+	face_compositor_static(face_2151_10_94363);
+	face_compositor_static(face_2151_11_96315);
+	face_compositor_static(face_2151_12_65535);
+	face_compositor_static(face_2151_13_76712);
+	face_compositor_static(face_2151_14_76712);
+	face_compositor_static(face_2151_15_76712);
+	face_compositor_static(face_2151_16_76712);
+	face_compositor_static(face_2151_18_81161);
+	face_compositor_static(face_2151_20_81309);
+	face_compositor_static(face_2151_27_80776);
+	face_compositor_static(face_2151_39_86586);
+	face_compositor_static(face_2151_43_86814);
+	face_compositor_static(face_2151_48_76584);
+
+
+    callback("2151", NULL, &face_2151, NULL);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_2151 // (2151) uncomment to enable or define it elsewhere
 
@@ -149,8 +150,6 @@ extern "C"
 	LV_IMG_DECLARE(face_2151_dial_img_56_106393_0);
 	LV_IMG_DECLARE(face_2151_dial_img_57_97232_0);
 	LV_IMG_DECLARE(face_2151_dial_img_58_98351_0);
-	LV_IMG_DECLARE(face_2151_dial_img_preview_0);
-	LV_IMG_DECLARE(face_2151_dial_img_preview_0);
 
 
 #endif
@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,2173 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_0_1184_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x18,0xC1,0x30,0x42,0x51,0xC3,0x69,0x03,0x82,0x23,0x8A,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,
-	0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,
-	0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,
-	0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,
-	0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0xC3,0x71,0x03,0x82,0x03,0x82,0xE3,0x79,0x03,0x82,0x44,0x8A,0xE3,0x79,0xE3,0x79,0x64,0x8A,0x44,0x8A,0x44,0x8A,0x03,0x82,0xE3,0x79,0x44,0x8A,0x85,0x92,0x85,0x92,0x44,0x8A,0x85,0x92,0x85,0x92,0x64,0x8A,0x44,0x8A,0x64,0x8A,0x85,0x92,0x85,0x92,0x44,0x8A,
-	0x23,0x8A,0x64,0x8A,0x85,0x92,0x64,0x8A,0x44,0x8A,0x23,0x8A,0xE3,0x79,0xC3,0x71,0xC3,0x69,0x84,0xA2,0xA4,0xA2,0x44,0x8A,0xA2,0x61,0x01,0x49,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE1,0x40,0xA3,0x69,0x64,0x92,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC5,0xA2,0xC5,0xAA,0x04,0x7A,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,
-	0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,
-	0xA2,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,
-	0xA2,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xC3,0x71,0x44,0x8A,0x44,0x8A,0x03,0x82,0x64,0x8A,0x44,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x79,
-	0x44,0x8A,0x64,0x8A,0x03,0x82,0x44,0x8A,0x84,0x92,0x85,0x92,0x84,0x92,0x44,0x8A,0x64,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x84,0x92,0x84,0x92,0x44,0x8A,0x64,0x8A,0x44,0x8A,0x44,0x8A,0x84,0x92,0x64,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0xA5,0x9A,0xA6,0xDB,0xA6,0xDB,0xC7,0xE3,0x28,0xF4,0x28,0xF4,0xC7,0xE3,0xE5,0xB2,
-	0xC2,0x79,0x22,0x49,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x22,0x49,0x03,0x82,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,
-	0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC4,0xAA,0xC5,0xAA,0xC5,0xAA,0x84,0x92,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x69,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,
-	0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,
-	0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,
-	0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0x82,0x61,0xA3,0x61,0xC3,0x69,0x04,0x7A,0x64,0x8A,0x64,0x8A,0x65,0x8A,0x85,0x92,0x44,0x8A,0x44,0x8A,0xE3,0x79,0xC2,0x71,0x44,0x8A,0x64,0x8A,0x64,0x8A,0x64,0x8A,0x64,0x92,0x85,0x92,0x85,0x92,0x44,0x8A,0x03,0x82,0x03,0x82,0x64,0x8A,0x85,0x92,0x85,0x92,0x44,0x8A,0x44,0x8A,0x64,0x8A,
-	0x64,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x8A,0x64,0x8A,0x44,0x8A,0x03,0x82,0x03,0x82,0x45,0xCB,0xC7,0xE3,0xE7,0xEB,0xA6,0xDB,0xC7,0xE3,0xE7,0xEB,0xA6,0xDB,0x25,0xC3,0x45,0xCB,0x66,0xD3,0xA6,0xDB,0x05,0xB3,0xA3,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x18,0xA3,0x69,0xC5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC4,0xAA,0xA4,0xAA,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xC4,0xA2,0xC3,0x71,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x69,0xA3,0x69,0xC3,0x69,
-	0x04,0x7A,0x04,0x7A,0xA2,0x69,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,
-	0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,
-	0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0xC3,0x69,0xC3,0x71,0xA3,0x69,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xC3,0x71,0xC3,0x69,0xC3,0x69,0x04,0x7A,0x44,0x8A,0x64,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x44,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x79,
-	0x64,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x84,0x92,0x85,0x92,0x64,0x8A,0x64,0x8A,0x64,0x8A,0x44,0x8A,0x64,0x8A,0x84,0x92,0x65,0x8A,0x84,0x92,0x85,0x92,0x84,0x92,0x64,0x8A,0x64,0x8A,0x64,0x8A,0x44,0x8A,0x64,0x8A,0x03,0x82,0xE3,0x79,0x44,0x8A,0xA6,0xDB,0xE7,0xEB,0xC7,0xE3,0x04,0xCB,0x66,0xD3,0x49,0xEC,0xA6,0xD3,0x25,0xC3,
-	0x45,0xCB,0xA6,0xDB,0xA6,0xDB,0xC7,0xE3,0xE7,0xEB,0xA6,0xDB,0x23,0x8A,0xA1,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0xC3,0x71,0xC5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0xC4,0xAA,0xC5,0xAA,0xC5,0xAA,
-	0xC5,0xAA,0xA4,0xAA,0xA4,0xAA,0xC4,0xA2,0xC5,0xAA,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0x44,0x8A,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x69,0x04,0x7A,0x65,0x8A,0xC3,0x71,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,
-	0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x83,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,
-	0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0x04,0x7A,0xC3,0x71,0x82,0x61,0xA2,0x61,0x83,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0xA3,0x61,0xC3,0x71,0xC3,0x71,0xC3,0x71,0x03,0x82,0x64,0x8A,0x85,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x64,0x8A,0x44,0x8A,0x04,0x7A,0x44,0x8A,0x64,0x8A,0x64,0x8A,0x23,0x8A,0x64,0x8A,0x84,0x92,0x44,0x8A,0x64,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x8A,0x84,0x92,0x84,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x84,0x92,
-	0x64,0x8A,0x64,0x8A,0x64,0x8A,0x44,0x8A,0x03,0x82,0x04,0x7A,0xE3,0x79,0xE5,0xAA,0xE7,0xDB,0xC7,0xE3,0xA6,0xD3,0x45,0xCB,0xE7,0xEB,0xE7,0xEB,0xA6,0xD3,0x05,0xBB,0x45,0xCB,0xE7,0xEB,0xC7,0xE3,0xA6,0xDB,0xC7,0xE3,0xC7,0xE3,0xC7,0xE3,0xE7,0xEB,0xE5,0xAA,0xC2,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x18,0xC3,0x69,0xE5,0xAA,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xC4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xA2,0xC5,0xAA,0xA5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xA4,0xAA,0xC3,0x69,0x82,0x61,0xA2,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0xC3,0x69,
-	0x64,0x8A,0x04,0x7A,0xA3,0x69,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,
-	0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,
-	0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0xA3,0x69,0xA3,0x69,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0xA2,0x61,0xA2,0x69,0xA2,0x69,0x04,0x7A,0x85,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x84,0x92,0x65,0x8A,0x64,0x8A,0x84,0x92,
-	0x64,0x8A,0x85,0x92,0x64,0x8A,0x64,0x8A,0x64,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x85,0x92,0x84,0x92,0x44,0x8A,0x85,0x92,0x84,0x92,0x84,0x92,0x44,0x8A,0x44,0x8A,0x03,0x82,0x04,0x7A,0x03,0x82,0xE3,0x79,0x03,0x82,0x64,0x8A,0xA6,0xDB,0x66,0xD3,0x04,0xCB,0x66,0xD3,0x28,0xEC,0x28,0xF4,0xE7,0xEB,0xA6,0xDB,0x25,0xC3,
-	0x04,0xCB,0xA6,0xDB,0xA6,0xDB,0x66,0xD3,0xA6,0xDB,0xA6,0xDB,0xE7,0xEB,0xE7,0xF3,0x28,0xF4,0x28,0xF4,0x84,0x9A,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0xC5,0xA2,0x05,0xB3,0xE5,0xB2,0xC4,0xAA,0xC5,0xAA,0xC5,0xAA,0xA5,0xAA,0xC5,0xA2,0xA4,0xAA,0xC5,0xAA,0xC4,0xAA,0xC4,0xAA,
-	0xC5,0xAA,0xA4,0xAA,0xA5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xAA,0x44,0x8A,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x04,0x7A,0x04,0x7A,0xC3,0x69,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x83,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,
-	0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,
-	0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0xC3,0x71,0xC2,0x69,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x69,0xC2,0x69,0xA2,0x69,0x03,0x82,0x85,0x92,0x85,0x92,0x84,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x84,0x92,0x64,0x92,0x84,0x92,0x85,0x92,0x84,0x92,0x64,0x8A,0x23,0x8A,0x64,0x8A,0x65,0x8A,0x64,0x8A,0x85,0x92,0x84,0x92,0x64,0x8A,0x64,0x92,0x64,0x8A,0x44,0x8A,0x44,0x8A,
-	0xE3,0x79,0xE3,0x79,0xA3,0x71,0xA2,0x71,0xC3,0x71,0xC3,0x71,0x64,0x9A,0xA6,0xD3,0xA6,0xD3,0xA6,0xD3,0xC7,0xE3,0x28,0xF4,0xE7,0xEB,0xE7,0xEB,0xE7,0xDB,0x45,0xCB,0x04,0xCB,0x45,0xCB,0xA6,0xDB,0xA6,0xDB,0xC7,0xE3,0xC7,0xE3,0xE7,0xEB,0xE7,0xEB,0xE7,0xEB,0xE7,0xEB,0xE7,0xEB,0x28,0xEC,0xC3,0x69,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x18,0x84,0x92,0x46,0xBB,0xA4,0xAA,0xC5,0xAA,0x05,0xB3,0x25,0xC3,0x05,0xB3,0xE5,0xAA,0xC5,0xAA,0xC5,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA5,0xAA,0xC4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC4,0xA2,0xA4,0xA2,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xAA,0x84,0x9A,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xC3,0x69,
-	0xA3,0x61,0x04,0x7A,0xC3,0x71,0xA3,0x69,0xA3,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xC3,0x71,0xA3,0x69,0xA3,0x69,0xC2,0x69,0xA3,0x61,0xA2,0x61,0x82,0x59,0x82,0x59,0xA3,0x61,0xA3,0x69,0xA2,0x61,0xC3,0x69,0x04,0x7A,0x03,0x82,0x44,0x8A,0x23,0x8A,0x23,0x8A,0xC7,0x92,0x85,0x92,0x44,0x8A,0x64,0x92,0x85,0x92,0x85,0x92,
-	0x85,0x92,0x84,0x92,0x84,0x92,0x64,0x8A,0x44,0x8A,0x64,0x8A,0x84,0x92,0x84,0x92,0x85,0x92,0x84,0x92,0x64,0x8A,0x64,0x8A,0x44,0x8A,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC3,0x69,0xC3,0x71,0xC3,0x71,0xC3,0x71,0x04,0x7A,0xC2,0x71,0x84,0xA2,0x25,0xC3,0xC7,0xE3,0x28,0xEC,0xC7,0xE3,0xE7,0xEB,0xE7,0xEB,0xC7,0xE3,0xA6,0xDB,0x66,0xD3,
-	0x45,0xCB,0x25,0xC3,0xA6,0xDB,0xE7,0xEB,0xC7,0xE3,0xE7,0xEB,0xE7,0xEB,0xE7,0xEB,0xC7,0xE3,0x28,0xF4,0xA6,0xF3,0xE7,0xEB,0x28,0xF4,0x25,0xBB,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x49,0x87,0xCB,0xE7,0xDB,0xE7,0xDB,0x66,0xC3,0xE5,0xB2,0x25,0xBB,0xA6,0xD3,0x66,0xC3,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xA4,0xAA,
-	0xC5,0xA2,0xC5,0xA2,0xA5,0xAA,0xC5,0xAA,0xA5,0xA2,0xA4,0xAA,0xA4,0xA2,0xA4,0xAA,0xC5,0xAA,0xC5,0xA2,0x04,0x7A,0x83,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xC3,0x71,0xC3,0x71,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0x83,0x61,0xA2,0x61,
-	0x83,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x69,0xC3,0x69,0xC3,0x71,0xC3,0x69,0x83,0x61,
-	0x82,0x61,0xA3,0x61,0xA3,0x69,0xC3,0x69,0x03,0x82,0x64,0x8A,0x44,0x8A,0x03,0x82,0x04,0x7A,0x44,0x8A,0x84,0x92,0x84,0x92,0x44,0x8A,0x84,0x92,0x85,0x92,0x85,0x92,0x84,0x92,0x64,0x8A,0x85,0x92,0x64,0x92,0x44,0x8A,0x85,0x92,0x85,0x92,0x85,0x92,0x64,0x92,0x44,0x8A,0x44,0x8A,0x04,0x7A,0xC2,0x71,0xA2,0x69,0xA2,0x69,0xC3,0x71,
-	0xC3,0x71,0xC3,0x71,0xC3,0x71,0x04,0x7A,0x04,0x7A,0x44,0x8A,0xE5,0xB2,0xC4,0xB2,0xA6,0xDB,0xC7,0xE3,0xA6,0xDB,0xE7,0xEB,0xA6,0xDB,0x66,0xD3,0xA6,0xDB,0x66,0xD3,0x45,0xCB,0xA7,0xDB,0xE7,0xEB,0xE7,0xEB,0x28,0xF4,0xE7,0xEB,0xE7,0xEB,0xC7,0xE3,0xA6,0xF3,0x28,0xF4,0x28,0xEC,0xC7,0xE3,0xA6,0xF3,0xE7,0xEB,0xC7,0xE3,0x42,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x71,
-	0x66,0xC3,0xA7,0xD3,0x28,0xEC,0x49,0xEC,0x49,0xEC,0xA6,0xD3,0x66,0xC3,0x66,0xCB,0x25,0xBB,0xC5,0xA2,0xA4,0xA2,0xA4,0xAA,0xA4,0xA2,0xC5,0xAA,0xC4,0xA2,0xA4,0xA2,0xC4,0xAA,0xA4,0xAA,0xA4,0xAA,0xA4,0xAA,0xC4,0xA2,0xC5,0xAA,0xC4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xA2,0x64,0x9A,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,
-	0xC3,0x69,0xC3,0x69,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x83,0x61,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xC3,0x69,0xA2,0x61,0x82,0x61,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0xA3,0x69,0xC3,0x69,0x04,0x7A,0x03,0x82,0x44,0x8A,0x64,0x8A,0x03,0x82,0x03,0x82,0x44,0x8A,0x03,0x82,0xE3,0x79,0x64,0x8A,0x85,0x92,0x85,0x92,0x85,0x92,
-	0x64,0x8A,0x84,0x92,0x64,0x8A,0x84,0x92,0x84,0x92,0x85,0x92,0x85,0x92,0x85,0x92,0x65,0x8A,0x64,0x8A,0x23,0x8A,0xE3,0x79,0xA3,0x61,0xA2,0x69,0xC3,0x69,0xC3,0x71,0xA2,0x69,0xA2,0x69,0xC3,0x69,0xA2,0x71,0xC3,0x71,0x63,0x9A,0xA4,0xAA,0xC4,0xB2,0x45,0xCB,0xC7,0xE3,0xC7,0xE3,0x66,0xCB,0x45,0xCB,0x04,0xCB,0x66,0xCB,0x04,0xCB,
-	0x45,0xCB,0xC7,0xE3,0xE7,0xEB,0xE7,0xF3,0xE7,0xEB,0xE7,0xEB,0xA6,0xF3,0xE7,0xEB,0xE7,0xEB,0xE7,0xEB,0x28,0xF4,0x28,0xF4,0xE7,0xEB,0xC7,0xE3,0x85,0xEB,0x28,0xF4,0x04,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x8A,0x66,0xCB,0x87,0xC3,0x28,0xEC,0x28,0xEC,0x49,0xEC,0xCB,0xFC,0x89,0xEC,0xA6,0xD3,0x25,0xBB,0xA5,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xA2,
-	0xC5,0xA2,0xA4,0xA2,0xA4,0xAA,0xC4,0xA2,0xC5,0xAA,0xC5,0xA2,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC4,0xAA,0xC5,0xAA,0xC3,0x69,0xA2,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x61,0xC3,0x69,0xC3,0x71,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,
-	0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,
-	0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0x82,0x61,0xA2,0x61,0xA3,0x69,0xA2,0x61,0x62,0x59,
-	0xA2,0x61,0xC3,0x71,0xC3,0x71,0x44,0x8A,0x64,0x8A,0xE3,0x79,0x04,0x7A,0x04,0x7A,0xC3,0x71,0xA3,0x69,0xC3,0x69,0xC3,0x71,0x65,0x8A,0x85,0x92,0x85,0x92,0x85,0x92,0x64,0x92,0x64,0x8A,0x85,0x92,0x65,0x8A,0x65,0x8A,0x85,0x92,0x85,0x92,0x84,0x92,0x85,0x92,0x84,0x92,0x64,0x8A,0x44,0x8A,0x04,0x7A,0xC3,0x71,0xC3,0x69,0xA3,0x69,
-	0x62,0x61,0x82,0x61,0x04,0x7A,0xC3,0x71,0xE3,0x79,0xC4,0xAA,0xC4,0xAA,0x25,0xC3,0x66,0xD3,0xE7,0xDB,0xA6,0xDB,0x45,0xCB,0x25,0xC3,0x45,0xCB,0x25,0xC3,0xC4,0xB2,0x46,0xC3,0xC7,0xE3,0xE7,0xEB,0xE7,0xEB,0x28,0xF4,0x28,0xF4,0xE7,0xEB,0xE7,0xEB,0xE7,0xEB,0xC7,0xE3,0xE7,0xEB,0x28,0xF4,0xE7,0xEB,0xC7,0xE3,0xC7,0xE3,0x28,0xF4,
-	0x28,0xEC,0x64,0x92,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x44,0x8A,0x87,0xCB,0x66,0xCB,
-	0xE7,0xDB,0x49,0xEC,0x28,0xEC,0xE7,0xEB,0x28,0xEC,0xE7,0xEB,0x87,0xCB,0xC5,0xAA,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xA2,0xC5,0xA2,0xC5,0xAA,0xC5,0xA2,0xC5,0xA2,0xC4,0xA2,0xC5,0xAA,0xE5,0xAA,0xA4,0xAA,0xA4,0xAA,0xA5,0xAA,0x44,0x8A,0xA3,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x69,
-	0x04,0x7A,0xC3,0x71,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,
-	0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0xC3,0x69,0xC3,0x71,0x03,0x82,0x65,0x8A,0x44,0x8A,0x44,0x8A,0xE3,0x79,0xC2,0x71,0xA2,0x61,0xA3,0x69,0x04,0x7A,0x85,0x92,0x85,0x92,0x84,0x92,0x64,0x8A,
-	0x44,0x8A,0x64,0x8A,0x84,0x92,0x85,0x92,0x85,0x92,0x84,0x92,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x03,0x82,0x04,0x7A,0xE3,0x79,0xC2,0x71,0xA2,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0xE3,0x79,0x04,0x7A,0x05,0xAB,0x66,0xCB,0x45,0xCB,0x66,0xCB,0xA6,0xDB,0x66,0xD3,0x25,0xC3,0xE5,0xBA,0x45,0xCB,0x66,0xCB,0xE5,0xBA,0xC4,0xB2,
-	0x45,0xCB,0xA6,0xD3,0xA6,0xDB,0xA6,0xDB,0xC7,0xE3,0xE7,0xEB,0x28,0xF4,0xE7,0xEB,0xA6,0xF3,0x28,0xF4,0x28,0xF4,0x28,0xF4,0x28,0xF4,0xE7,0xEB,0xC7,0xE3,0xE7,0xEB,0xC7,0xE3,0xC7,0xE3,0xC5,0xAA,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x82,0xA5,0xA2,0x26,0xBB,0x66,0xCB,0x28,0xEC,0x49,0xEC,0xA6,0xDB,0xE7,0xDB,0xE7,0xDB,0x66,0xCB,0x66,0xCB,0x05,0xB3,0xA4,0xA2,0xA4,0xAA,0xE5,0xB2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xA4,0xA2,
-	0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xAA,0xC4,0xAA,0xC4,0xAA,0xC5,0xA2,0xC5,0xA2,0xA5,0xA2,0xA3,0x61,0xA3,0x61,0xC3,0x69,0x04,0x7A,0x04,0x7A,0xC3,0x71,0xA2,0x61,0x82,0x61,0xA3,0x69,0xA3,0x69,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,
-	0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x62,0x61,0x62,0x61,
-	0x82,0x61,0xC3,0x69,0xC2,0x71,0xC3,0x71,0x64,0x8A,0x85,0x92,0x64,0x8A,0x04,0x7A,0xC3,0x71,0xC3,0x71,0x04,0x7A,0x44,0x8A,0x85,0x92,0x85,0x92,0x84,0x92,0x64,0x8A,0x64,0x8A,0x44,0x8A,0x84,0x92,0x85,0x92,0x84,0x92,0x44,0x8A,0xC3,0x69,0x82,0x61,0x82,0x61,0xA2,0x69,0xA3,0x69,0xC3,0x69,0xA2,0x69,0xA3,0x69,0x82,0x61,0x62,0x61,
-	0x82,0x61,0xA3,0x61,0xC3,0x71,0x03,0x82,0x66,0xD3,0x66,0xD3,0xA6,0xDB,0xC7,0xE3,0xA6,0xDB,0x66,0xD3,0x25,0xC3,0xC4,0xB2,0xA4,0xAA,0xA4,0xAA,0xA4,0xAA,0xE5,0xB2,0x45,0xCB,0x45,0xCB,0x66,0xD3,0x45,0xCB,0x66,0xD3,0xC7,0xE3,0x28,0xF4,0xE7,0xEB,0xE7,0xEB,0x28,0xF4,0x28,0xEC,0x28,0xF4,0xE7,0xF3,0xE7,0xEB,0xC7,0xE3,0xE7,0xEB,
-	0xE7,0xEB,0xC7,0xE3,0xA6,0xDB,0x05,0xB3,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x82,0x06,0xB3,0x06,0xB3,0xC5,0xAA,0xE5,0xB2,
-	0xE7,0xDB,0x28,0xEC,0xA7,0xD3,0x08,0xDC,0xE7,0xDB,0x46,0xC3,0x25,0xC3,0xE5,0xB2,0xA5,0xA2,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0x26,0xBB,0x05,0xAB,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xC5,0xAA,0xC4,0xA2,0xA4,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xA4,0xA2,0xC4,0xA2,0xC5,0xAA,0xA4,0xA2,0x03,0x82,0xA3,0x61,0xC3,0x69,0x04,0x7A,
-	0x04,0x7A,0xC3,0x69,0x82,0x61,0xA3,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x83,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,
-	0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x62,0x61,0x82,0x59,0xC3,0x69,0x04,0x7A,0x44,0x8A,0x03,0x82,0x04,0x7A,0xE3,0x79,0xA2,0x69,0xA3,0x69,0xC3,0x71,0x04,0x7A,0x04,0x7A,0x44,0x8A,0x64,0x8A,0x85,0x92,0x85,0x92,0x84,0x92,
-	0x65,0x8A,0x64,0x8A,0x84,0x92,0x64,0x8A,0x44,0x8A,0xE3,0x79,0xC2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0xA3,0x61,0xC3,0x69,0xA3,0x69,0x23,0x8A,0x66,0xD3,0x04,0xCB,0x45,0xCB,0xE7,0xEB,0xE7,0xEB,0xC7,0xE3,0x45,0xCB,0x84,0xA2,0x63,0x9A,0x64,0x9A,0xC4,0xB2,0x46,0xC3,
-	0x04,0xCB,0x25,0xC3,0x66,0xD3,0x25,0xC3,0xE5,0xBA,0x45,0xCB,0xC7,0xE3,0xE7,0xEB,0xE7,0xEB,0xE7,0xEB,0x28,0xF4,0x28,0xF4,0xE7,0xEB,0xC7,0xE3,0xA6,0xDB,0x04,0xDB,0xE7,0xEB,0x28,0xEC,0x85,0xEB,0xC7,0xE3,0x26,0xBB,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x79,0xE5,0xAA,0xA8,0xCB,0x26,0xBB,0xA4,0xAA,0xE5,0xAA,0x46,0xC3,0xA6,0xD3,0xA7,0xD3,0x08,0xDC,0xE7,0xDB,0xA8,0xCB,0x46,0xC3,0xC5,0xAA,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xE5,0xAA,0xE5,0xB2,0xC5,0xAA,0xC5,0xAA,
-	0xA4,0xA2,0xA5,0xA2,0xA5,0xAA,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xC4,0xA2,0xA5,0xAA,0xC5,0xAA,0xA5,0xAA,0xC5,0xAA,0x64,0x9A,0xA2,0x61,0xC3,0x71,0x04,0x7A,0x04,0x7A,0xA3,0x69,0x82,0x61,0xA3,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,
-	0xA3,0x69,0xC3,0x69,0xA3,0x69,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,
-	0x82,0x61,0x82,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x59,0x83,0x61,
-	0xC3,0x71,0x64,0x8A,0x64,0x8A,0x44,0x8A,0xC3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x71,0x04,0x7A,0x44,0x8A,0x65,0x8A,0x85,0x92,0x84,0x92,0x65,0x8A,0x84,0x92,0x85,0x92,0x64,0x8A,0x44,0x8A,0x03,0x82,0x44,0x8A,0x03,0x82,0xC3,0x71,0xA3,0x69,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x59,0x62,0x59,0x82,0x59,0x82,0x61,
-	0xC3,0x71,0xC3,0x71,0x82,0x61,0x23,0x9A,0x66,0xCB,0xA7,0xD3,0xE5,0xBA,0x45,0xCB,0xE7,0xEB,0x28,0xF4,0xA6,0xDB,0x05,0xB3,0xC4,0xB2,0xE5,0xBA,0x66,0xCB,0x25,0xC3,0xC4,0xB2,0x45,0xCB,0x08,0xDC,0xA6,0xD3,0xC4,0xB2,0xE5,0xBA,0x66,0xD3,0xE7,0xEB,0xE7,0xF3,0x28,0xF4,0xE7,0xEB,0xE7,0xEB,0x28,0xF4,0xA6,0xDB,0xE5,0xBA,0x83,0xB2,
-	0xC7,0xE3,0x28,0xF4,0xC7,0xE3,0xA6,0xDB,0xC7,0xE3,0xC5,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x71,0xA7,0xD3,0x25,0xBB,0x87,0xCB,0xC7,0xD3,0x25,0xBB,0xC7,0xD3,
-	0x08,0xDC,0x05,0xBB,0x05,0xBB,0x66,0xCB,0x87,0xCB,0xA7,0xD3,0x25,0xC3,0xA4,0xAA,0xA4,0xA2,0xA4,0xAA,0xA4,0xA2,0xC5,0xAA,0xA5,0xA2,0xA5,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xAA,0xA4,0xA2,0x04,0x7A,0x04,0x7A,0xC3,0x71,
-	0xA3,0x69,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x69,0xA3,0x69,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x71,0xC3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x83,0x61,
-	0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xC3,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x04,0x7A,0x64,0x8A,0x44,0x8A,0xC3,0x71,0x82,0x61,0x62,0x59,0x82,0x61,0xA2,0x61,0x82,0x61,0xC3,0x69,0x04,0x7A,0x64,0x8A,0x85,0x92,0x85,0x92,0x85,0x92,0x65,0x8A,
-	0x84,0x92,0x84,0x92,0x64,0x8A,0xE3,0x79,0xC2,0x71,0xE3,0x79,0xC3,0x69,0xA2,0x69,0xC3,0x69,0xC3,0x71,0xA3,0x69,0x82,0x61,0x82,0x59,0x82,0x59,0x62,0x59,0x62,0x61,0xA3,0x69,0xC3,0x69,0xC2,0x79,0x84,0xA2,0xA4,0xAA,0x25,0xC3,0x05,0xB3,0x84,0xA2,0x66,0xD3,0x28,0xF4,0x89,0xEC,0x28,0xEC,0xA6,0xD3,0x66,0xD3,0x25,0xC3,0x83,0xB2,
-	0x84,0xA2,0x45,0xCB,0xE7,0xEB,0xA6,0xDB,0xC4,0xB2,0xA4,0xAA,0x04,0xCB,0xC7,0xE3,0xE7,0xEB,0xA6,0xDB,0xA6,0xDB,0xE7,0xEB,0xE7,0xEB,0x45,0xCB,0x45,0xCB,0x25,0xC3,0xA6,0xDB,0x28,0xEC,0xC7,0xE3,0x44,0xE3,0xC7,0xE3,0x28,0xEC,0x44,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x51,0xA7,0xD3,0xC7,0xD3,0x66,0xCB,0xA7,0xD3,0x89,0xEC,0x28,0xEC,0xE7,0xEB,0x08,0xDC,0x87,0xCB,0x66,0xC3,0x46,0xC3,0xE5,0xBA,0xC4,0xB2,0x66,0xC3,0x26,0xBB,0xC4,0xAA,0xE5,0xB2,0xE5,0xB2,0xE5,0xB2,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,
-	0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xC5,0xA2,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xE5,0xB2,0x05,0xB3,0xE5,0xAA,0xA3,0x69,0xA3,0x69,0xA3,0x69,0xA3,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA3,0x69,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x83,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x69,0xC3,0x69,0xC3,0x69,0xC3,0x71,0xC3,0x61,0xA3,0x69,0xA2,0x61,0xA3,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0xA3,0x61,0xC3,0x71,0xA2,0x69,0x82,0x61,0x82,0x59,0x82,0x61,
-	0xC3,0x69,0xA2,0x69,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x59,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0xE3,0x79,0x44,0x8A,0x65,0x8A,0x84,0x92,0x85,0x92,0x64,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x8A,0x44,0x8A,0xC3,0x71,0x82,0x61,0x62,0x61,0xA3,0x69,0xC3,0x71,0xA3,0x69,0x82,0x59,0x62,0x61,0x82,0x59,0x62,0x59,0x62,0x59,0x82,0x59,
-	0x82,0x61,0xA2,0x69,0x43,0x92,0x84,0xA2,0x43,0x92,0x84,0xA2,0xE5,0xB2,0xA4,0xAA,0xE5,0xBA,0x66,0xD3,0xE7,0xEB,0x4A,0xFC,0xC7,0xE3,0x05,0xBB,0xA4,0xAA,0xA4,0xAA,0xE5,0xAA,0xE5,0xBA,0x66,0xD3,0xA6,0xDB,0x05,0xBB,0x83,0xB2,0xE5,0xBA,0xA6,0xDB,0xC7,0xE3,0x66,0xD3,0x45,0xCB,0xA6,0xDB,0x04,0xCB,0xC3,0xBA,0xA6,0xDB,0xC7,0xE3,
-	0xC7,0xE3,0xE7,0xEB,0xA6,0xDB,0xA6,0xDB,0xC7,0xE3,0xC7,0xE3,0xA6,0xDB,0x22,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x20,0x08,0xDC,0x28,0xEC,0xE7,0xEB,0xE7,0xDB,0xE7,0xEB,0x28,0xF4,0x49,0xEC,0xE7,0xDB,
-	0xE7,0xEB,0x49,0xEC,0xA7,0xD3,0xE5,0xB2,0x84,0xA2,0xC5,0xAA,0x25,0xBB,0x26,0xBB,0xE5,0xB2,0xE5,0xB2,0x05,0xB3,0xC5,0xAA,0xA4,0xAA,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA5,0xA2,0xA5,0xA2,0xC5,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xC5,0xAA,0xC4,0xAA,0xC5,0xAA,0x25,0xBB,0x46,0xBB,0x05,0xB3,0x84,0xA2,0xA4,0xA2,
-	0xE5,0xAA,0x05,0xB3,0x05,0xAB,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x92,0x03,0x82,0xC3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0xC3,0x71,0x04,0x7A,0xC3,0x71,0xC3,0x71,0x04,0x7A,0x44,0x8A,0x04,0x7A,0xA3,0x69,0x83,0x61,0x82,0x61,
-	0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x59,0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x69,0x62,0x61,0x62,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x62,0x59,0xC3,0x69,0x64,0x8A,0x64,0x92,0xE5,0xAA,0x87,0xCB,0x66,0xCB,
-	0x05,0xBB,0xC5,0xAA,0xE5,0xBA,0x46,0xC3,0xA4,0xAA,0x23,0x92,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x43,0x92,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x23,0x92,0xA4,0xAA,0x25,0xC3,0xA6,0xDB,0x28,0xF4,0xA6,0xDB,0x05,0xB3,0x83,0xB2,0xC4,0xB2,
-	0x25,0xBB,0xC4,0xB2,0xC4,0xB2,0x45,0xCB,0x45,0xCB,0x25,0xC3,0x46,0xC3,0x45,0xCB,0xA6,0xDB,0xE7,0xEB,0x66,0xD3,0x45,0xCB,0x45,0xCB,0x66,0xCB,0xA6,0xD3,0x66,0xD3,0xA6,0xDB,0xE7,0xDB,0x45,0xCB,0x45,0xDB,0xA6,0xDB,0xA6,0xDB,0x45,0xCB,0x25,0xC3,0x60,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0xBB,0x28,0xEC,0x28,0xEC,0x28,0xEC,0x89,0xEC,0x89,0xEC,0x49,0xEC,0xE7,0xEB,0x28,0xEC,0x28,0xEC,0xA6,0xD3,0xE5,0xBA,0xC5,0xAA,0x84,0xA2,0xE5,0xB2,0x26,0xBB,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,
-	0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xA5,0xAA,0xA4,0xA2,0xC5,0xAA,0xC4,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xAA,0xC5,0xAA,0xE5,0xB2,0x05,0xB3,0xC4,0xAA,0x84,0xA2,0xE5,0xB2,0x25,0xC3,0x05,0xB3,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xA4,0xAA,0xE5,0xB2,0x05,0xB3,0xA5,0xA2,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xA4,0xA2,0xA4,0xAA,
-	0xA4,0xAA,0xC5,0xAA,0xA5,0xA2,0xC3,0x69,0xA3,0x61,0xC3,0x69,0xC3,0x71,0x04,0x7A,0x04,0x7A,0x04,0x7A,0x44,0x8A,0x64,0x8A,0x44,0x8A,0xC3,0x71,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0xA3,0x69,0xC3,0x71,0xC3,0x71,0xA2,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x59,0x04,0x7A,0x06,0xB3,0xE7,0xDB,0xC7,0xE3,0xC7,0xE3,0x45,0xCB,0xC4,0xB2,0xA4,0xAA,0xC5,0xAA,0xE5,0xB2,0x84,0xA2,0x84,0xA2,0xA5,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x23,0x92,0x64,0x9A,0xE5,0xBA,0x25,0xC3,0x04,0xCB,0x66,0xD3,0x05,0xBB,0xA4,0xAA,0xA4,0xAA,0xE5,0xB2,0xA4,0xAA,0x23,0x9A,0x84,0xA2,0xC4,0xB2,0xE5,0xB2,0xC4,0xB2,0xC4,0xB2,0x25,0xC3,0xA6,0xD3,0x45,0xCB,0x45,0xCB,0x66,0xD3,0x66,0xD3,0x45,0xCB,0x45,0xCB,
-	0x45,0xCB,0x66,0xD3,0xA6,0xDB,0xE7,0xDB,0xC7,0xE3,0xA6,0xDB,0x66,0xD3,0xE5,0xBA,0x64,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x61,0x89,0xEC,0x89,0xEC,0x49,0xEC,0x49,0xEC,0x89,0xEC,0x89,0xEC,0x49,0xEC,0x28,0xEC,0x46,0xC3,
-	0x25,0xC3,0xE5,0xB2,0xC5,0xAA,0xE5,0xAA,0xA4,0xAA,0xA4,0xAA,0x06,0xB3,0xA4,0xAA,0x05,0xB3,0xE5,0xB2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xAA,0xC4,0xAA,0xC5,0xAA,
-	0x26,0xBB,0x05,0xB3,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xB2,0xE5,0xB2,0x05,0xB3,0xE5,0xB2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xAA,0xA4,0xAA,0xA4,0xA2,0xC5,0xAA,0xE5,0xB2,0x25,0xBB,0x05,0xB3,0xC3,0x71,0xC3,0x69,0x04,0x7A,0x04,0x7A,0x44,0x8A,0x03,0x82,0x04,0x7A,0x44,0x8A,0x44,0x8A,0x04,0x7A,0xA3,0x69,0x82,0x61,
-	0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xC3,0x69,0x04,0x7A,0xC3,0x71,0xA3,0x69,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0xC3,0x71,0xE5,0xAA,0xE7,0xEB,0x28,0xEC,0xE7,0xEB,0xA6,0xDB,0x25,0xC3,
-	0xA4,0xAA,0xA4,0xAA,0xE5,0xB2,0x84,0xA2,0x84,0x9A,0x84,0xA2,0x64,0x9A,0x63,0x9A,0x63,0x9A,0x63,0x9A,0x64,0x9A,0xA4,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x44,0x9A,0x64,0x9A,0x84,0xA2,0x63,0x9A,0x23,0x92,0xE5,0xB2,0x25,0xC3,0xA4,0xAA,0x63,0x9A,
-	0xA4,0xAA,0xE5,0xB2,0xA4,0xA2,0x63,0x9A,0x64,0x9A,0x44,0x9A,0x23,0x9A,0x64,0x9A,0x63,0x9A,0x24,0xA2,0x25,0xC3,0x04,0xCB,0xC4,0xB2,0xE5,0xBA,0xC4,0xB2,0x04,0xCB,0x45,0xCB,0x04,0xCB,0xC7,0xE3,0x28,0xEC,0xC7,0xE3,0x45,0xDB,0x04,0xCB,0xC4,0xB2,0xA4,0xAA,0x01,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x18,0x08,0xDC,0x89,0xEC,0x89,0xEC,0x89,0xEC,0x49,0xEC,0x89,0xEC,0x89,0xEC,0x28,0xEC,0xE7,0xEB,0x66,0xCB,0xC4,0xAA,0xA4,0xAA,0xE5,0xAA,0xC5,0xAA,0xC4,0xAA,0xE5,0xB2,0xE5,0xB2,0xC5,0xAA,0x46,0xBB,0xE5,0xAA,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA5,0xA2,
-	0xC5,0xA2,0xC5,0xA2,0xA5,0xAA,0xA5,0xAA,0xC5,0xAA,0xC5,0xA2,0xA4,0xA2,0xA4,0xAA,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xE5,0xB2,0x87,0xC3,0x87,0xCB,0xE5,0xB2,0xE5,0xB2,0x05,0xB3,0xE5,0xAA,0xC4,0xB2,0x26,0xBB,0x25,0xBB,0xE5,0xB2,0xC5,0xAA,0xA4,0xA2,0xA4,0xAA,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,
-	0xC5,0xAA,0xE5,0xAA,0x05,0xBB,0x66,0xCB,0xA5,0xA2,0xA2,0x69,0xC3,0x69,0x04,0x7A,0xC3,0x71,0x04,0x7A,0x04,0x7A,0x64,0x8A,0x64,0x8A,0x44,0x8A,0xC3,0x69,0xA2,0x61,0x82,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,
-	0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0xC3,0x71,0xC3,0x71,0xC3,0x69,0xA2,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0xA2,0x61,0x82,0x61,0x03,0x82,0xA6,0xD3,0xA7,0xDB,0xA6,0xDB,0xA6,0xDB,0xE7,0xDB,0x66,0xCB,0xC4,0xB2,0x25,0xBB,0xE5,0xBA,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x43,0x92,0xC4,0xB2,0x45,0xCB,0xC4,0xAA,0x23,0x92,0x64,0x9A,0xC4,0xB2,0xE5,0xB2,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x63,0x9A,0x23,0x92,0x23,0x92,0x64,0x9A,0xC4,0xAA,0xE5,0xB2,0x64,0x9A,0x84,0xA2,0xC5,0xAA,0x45,0xCB,
-	0x66,0xD3,0x66,0xD3,0xC7,0xE3,0xC7,0xE3,0xE7,0xEB,0xC7,0xE3,0x46,0xC3,0xC4,0xB2,0xC4,0xB2,0xC5,0xAA,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x92,0x89,0xEC,0x89,0xEC,0x89,0xEC,0x89,0xEC,0x89,0xEC,0x49,0xEC,0x89,0xEC,0x28,0xF4,0xE7,0xDB,0x66,0xCB,
-	0xE5,0xB2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xAA,0x05,0xB3,0x05,0xB3,0xC4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xAA,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xAA,0xC5,0xA2,0xA5,0xA2,0xC5,0xAA,0xC4,0xAA,0xA4,0xAA,0xC4,0xAA,0xC4,0xAA,0xA4,0xAA,0xC5,0xA2,0x06,0xB3,0xA7,0xD3,
-	0x66,0xCB,0xC4,0xB2,0xA4,0xAA,0xE5,0xB2,0x25,0xBB,0x87,0xC3,0x25,0xC3,0x25,0xC3,0x25,0xBB,0xC5,0xAA,0xA4,0xAA,0xA4,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x44,0x8A,0xA3,0x69,0xC3,0x69,0xC3,0x71,0x04,0x7A,0x03,0x82,0x04,0x7A,0x44,0x8A,0x64,0x8A,0x04,0x7A,0xC3,0x69,
-	0xC3,0x69,0xC3,0x69,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xC3,0x69,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0x04,0x7A,0x04,0x7A,0xC2,0x71,0xA2,0x69,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xC3,0x69,0xC4,0xB2,0x45,0xCB,0xE7,0xDB,0x66,0xD3,0xC7,0xE3,0xE7,0xDB,0x66,0xCB,
-	0x25,0xBB,0xE5,0xBA,0x05,0xBB,0xE5,0xAA,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x63,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x44,0x9A,0x84,0xA2,0xC4,0xB2,0x05,0xB3,0xA4,0xA2,
-	0x64,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x63,0x9A,0x64,0x9A,0x63,0x9A,0x63,0x9A,0x64,0x9A,0x44,0x9A,0x63,0x9A,0xA4,0xAA,0x84,0xA2,0x23,0x92,0x64,0x9A,0x45,0xCB,0x66,0xD3,0x04,0xCB,0xA6,0xDB,0xA6,0xDB,0xE7,0xEB,0xE7,0xEB,0x66,0xD3,0x45,0xCB,0xA6,0xD3,0xA6,0xD3,0xE3,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x28,0x49,0xEC,0x89,0xEC,0x49,0xEC,0x49,0xEC,0x89,0xEC,0x89,0xEC,0x28,0xF4,0x89,0xEC,0x49,0xEC,0x87,0xCB,0x05,0xB3,0xC5,0xAA,0xC5,0xA2,0xC5,0xA2,0xA4,0xA2,0xA5,0xA2,0xA5,0x9A,0xA4,0xA2,0xE5,0xAA,0xA4,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,
-	0xA4,0xA2,0xA4,0xA2,0xA4,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x05,0xB3,0x66,0xCB,0xC4,0xB2,0xC5,0xAA,0x06,0xB3,0x66,0xC3,0x87,0xCB,0x26,0xBB,0xE5,0xB2,0x26,0xBB,0x26,0xBB,0xA4,0xA2,0xA4,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0xA2,0xC5,0xA2,
-	0xA4,0xA2,0xE5,0xB2,0x87,0xC3,0x05,0xB3,0xC4,0xB2,0x25,0xBB,0x04,0x7A,0x04,0x7A,0x04,0x7A,0x03,0x82,0x03,0x82,0xC3,0x71,0x04,0x7A,0x64,0x8A,0x04,0x7A,0xC3,0x71,0xC3,0x69,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x62,0x61,0x82,0x61,0xA3,0x61,0xC3,0x69,0xC3,0x71,0x04,0x7A,0xC2,0x69,0x82,0x61,
-	0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x64,0x9A,0xE5,0xB2,0xE5,0xBA,0x25,0xC3,0x45,0xCB,0xC7,0xE3,0xA6,0xD3,0xC4,0xB2,0xA4,0xAA,0xC4,0xB2,0x26,0xBB,0xE5,0xB2,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x84,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x63,0x9A,
-	0x84,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x44,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x44,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0xA5,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x44,0x9A,0x43,0x92,0x44,0x9A,0x44,0x9A,0x43,0x92,0x44,0x9A,0x84,0xA2,0x64,0x9A,0x64,0x9A,0xC4,0xB2,0xC4,0xB2,0x64,0x92,0x23,0x92,0xA4,0xAA,
-	0x04,0xCB,0x45,0xCB,0x45,0xCB,0xC7,0xE3,0xE7,0xEB,0xE7,0xEB,0x45,0xDB,0x66,0xD3,0xC7,0xE3,0x45,0xCB,0x45,0xCB,0x81,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xAA,0x28,0xEC,0x89,0xEC,0x89,0xEC,0x28,0xF4,0x28,0xEC,0xC7,0xE3,0xA6,0xDB,0xA6,0xDB,0x66,0xCB,0x46,0xBB,0x26,0xBB,
-	0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xAA,0xA4,0xA2,0xA4,0xAA,0xA4,0xAA,0xC5,0xAA,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC4,0xA2,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xE5,0xAA,0x25,0xBB,0x46,0xC3,
-	0xC5,0xAA,0xE5,0xB2,0x66,0xCB,0xA7,0xD3,0x66,0xD3,0x05,0xBB,0xC5,0xAA,0xE5,0xB2,0x26,0xBB,0xE5,0xAA,0x84,0xA2,0xA4,0xA2,0xA5,0xAA,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0x25,0xBB,0x26,0xBB,0x25,0xC3,0x05,0xBB,0xE5,0xB2,0xC5,0xAA,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x69,0xC3,0x71,0x04,0x7A,0x04,0x7A,0xC2,0x71,
-	0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0xC3,0x71,0xC3,0x71,0xA2,0x61,0xA3,0x69,0xA3,0x69,0xA2,0x61,0x82,0x59,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x59,0xE3,0x79,0x26,0xBB,0x25,0xBB,0x64,0x9A,0x84,0xA2,0x25,0xBB,0x66,0xD3,0x45,0xCB,0xA4,0xAA,
-	0x84,0xA2,0x46,0xBB,0x25,0xC3,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x63,0x9A,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x43,0x92,0x64,0x92,0x64,0x9A,0x43,0x92,0x64,0x92,0x44,0x9A,0x84,0x9A,0x64,0x9A,0x43,0x92,0x43,0x92,
-	0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x63,0x9A,0x43,0x92,0x44,0x9A,0x64,0x9A,0x84,0xA2,0xC4,0xB2,0x25,0xBB,0x05,0xB3,0x63,0x9A,0x23,0x92,0x84,0xA2,0xC4,0xB2,0x25,0xC3,0x45,0xCB,0xA6,0xDB,0xE7,0xEB,0xA6,0xDB,0xA6,0xDB,0xA6,0xDB,0xA6,0xDB,0x66,0xD3,0xA6,0xD3,0x64,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x28,0x49,0xEC,0x28,0xEC,0x49,0xEC,0x49,0xEC,0xA6,0xDB,0xE5,0xBA,0xA4,0xAA,0x05,0xB3,0x46,0xBB,0xE5,0xB2,0xC4,0xB2,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xA5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,
-	0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0x05,0xB3,0x05,0xB3,0xC4,0xA2,0x84,0xA2,0xA4,0xA2,0x05,0xB3,0x87,0xCB,0x46,0xC3,0x26,0xBB,0x46,0xC3,0xC7,0xD3,0xA7,0xD3,0xC7,0xD3,0x25,0xC3,0xA4,0xAA,0xA4,0xAA,0xC5,0xAA,0x05,0xB3,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xE5,0xAA,0xC5,0xAA,
-	0xC5,0xAA,0xC4,0xAA,0xC5,0xAA,0x05,0xB3,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0x44,0x8A,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x69,0xC3,0x71,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x62,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xC3,0x71,0xC3,0x69,0x62,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,
-	0x62,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x59,0x82,0x61,0xA2,0x61,0xA4,0xA2,0xC5,0xAA,0x84,0xA2,0x64,0x92,0xC5,0xAA,0xA7,0xD3,0xA7,0xD3,0x25,0xC3,0xC4,0xAA,0xA4,0xAA,0x25,0xBB,0xA4,0xAA,0x64,0x9A,0xA5,0xAA,0xE5,0xAA,0x64,0x9A,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x84,0xA2,0xC5,0xAA,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x24,0xA2,0xA5,0xAA,0x84,0xA2,0x63,0x9A,0x84,0xA2,
-	0x84,0xA2,0xC4,0xB2,0x66,0xD3,0xC7,0xE3,0xE7,0xEB,0xC7,0xE3,0xA6,0xDB,0xA6,0xDB,0xA6,0xDB,0x45,0xCB,0x66,0xD3,0x45,0xCB,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x92,0x49,0xEC,0xC7,0xE3,0xA6,0xDB,0xA6,0xD3,0x46,0xC3,0xA4,0xAA,0x64,0x9A,0xE5,0xAA,0x05,0xB3,0xE5,0xB2,0xC4,0xAA,0xE5,0xB2,
-	0xE5,0xAA,0xC4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xC5,0xA2,0xC5,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xAA,0xA4,0xAA,0xA4,0xA2,0xC5,0xAA,0xA5,0xAA,0xA4,0xAA,0x26,0xBB,0x46,0xBB,0xE5,0xAA,0xA4,0xA2,0xA5,0xA2,0x25,0xBB,0x46,0xC3,0x46,0xC3,
-	0xA7,0xD3,0xC7,0xD3,0x66,0xD3,0x66,0xCB,0x46,0xC3,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x46,0xBB,0x66,0xC3,0x25,0xBB,0x05,0xB3,0xC5,0xAA,0xA4,0xAA,0xA4,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xA4,0xAA,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xC3,0x71,0xC3,0x61,0xA2,0x61,0xA3,0x69,0xC3,0x71,0xA3,0x61,0xA2,0x61,0x82,0x61,
-	0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0xA3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x59,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xC3,0x69,0xA3,0x69,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x62,0x59,0x82,0x59,0x82,0x59,0x62,0x59,0x82,0x61,0xC5,0xA2,0x25,0xBB,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x05,0xB3,0xA6,0xD3,0xA6,0xD3,0x25,0xC3,0xA4,0xAA,
-	0x63,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xAA,0x84,0xA2,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0xA4,0xA2,0xE5,0xB2,0xA4,0xA2,0x64,0x9A,0x63,0x9A,0x43,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x63,0x9A,0x64,0x92,0x44,0x9A,
-	0x44,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x92,0x23,0x92,0x43,0x92,0x23,0x8A,0x23,0x8A,0x43,0x92,0x44,0x9A,0x84,0xA2,0x64,0x9A,0x44,0x9A,0xC5,0xAA,0x25,0xC3,0xA6,0xDB,0xE7,0xEB,0xE7,0xEB,0xC7,0xE3,0xA6,0xDB,0xC7,0xE3,0x45,0xDB,0x04,0xCB,0x66,0xD3,0x44,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x46,0xC3,0xA6,0xD3,0xA7,0xD3,0x46,0xC3,0x05,0xBB,0xE5,0xAA,0xC5,0xAA,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,
-	0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0x25,0xC3,0x46,0xC3,0x46,0xBB,0xE5,0xAA,0xE5,0xB2,0x25,0xC3,0xC4,0xB2,0x25,0xC3,0xE7,0xDB,0xE7,0xDB,0x66,0xCB,0xC7,0xD3,0x87,0xCB,0x66,0xC3,0x46,0xBB,0xE5,0xBA,0x66,0xC3,0x05,0xB3,0xE5,0xB2,0xA5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,
-	0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0x84,0x9A,0xC3,0x69,0xA3,0x69,0xA3,0x69,0xA3,0x69,0xA2,0x61,0xA3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x83,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0xC3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x69,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x62,0x59,0x82,0x61,0x82,0x59,
-	0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x03,0x82,0x25,0xC3,0xE5,0xB2,0x64,0x9A,0x63,0x9A,0x84,0x9A,0x84,0xA2,0x25,0xBB,0xE5,0xBA,0xE5,0xBA,0xC5,0xAA,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x84,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x64,0x9A,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x63,0x9A,0x44,0x9A,0x64,0x9A,0x43,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x44,0x9A,0x64,0x92,0x64,0x92,0x43,0x92,0x44,0x9A,0x43,0x92,0x84,0xA2,0xC5,0xAA,0xC5,0xAA,0x64,0x9A,0x23,0x8A,0x03,0x8A,0x64,0x92,0x43,0x92,0x23,0x92,0x43,0x92,0xA5,0x9A,0x64,0x9A,
-	0x23,0x9A,0x84,0xA2,0x84,0xA2,0x45,0xCB,0xC7,0xE3,0xA6,0xDB,0xA6,0xDB,0xA6,0xDB,0xC7,0xE3,0xC7,0xE3,0x04,0xCB,0x45,0xCB,0xA6,0xD3,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x49,0x05,0xB3,0x46,0xBB,0xA7,0xD3,0x87,0xCB,0x05,0xBB,0xA4,0xAA,0xA4,0xA2,0x84,0xA2,0xA5,0xA2,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xC4,0xA2,
-	0xA4,0xA2,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xE5,0xAA,0xE5,0xAA,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xE5,0xB2,0x05,0xB3,0xE5,0xB2,0x05,0xB3,0x25,0xC3,0x87,0xCB,0x87,0xC3,0xE5,0xB2,0x26,0xBB,
-	0x08,0xDC,0xA7,0xD3,0xA6,0xD3,0xA7,0xDB,0x66,0xD3,0x46,0xC3,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0xA2,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0x84,0xA2,0x23,0x8A,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xC3,0x69,0xC3,0x71,
-	0xA3,0x61,0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x59,
-	0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0xA3,0x61,0xA3,0x69,0x82,0x61,0x62,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x59,0xA3,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0x05,0x82,0x69,0xB3,0x69,0xB3,0xE6,0xAA,0xC7,0x92,0xC7,0x92,0x45,0xA2,0xA5,0xA2,0x05,0xB3,0xC4,0xAA,0xA5,0xAA,0xE5,0xAA,
-	0xA4,0xA2,0x64,0x9A,0x84,0xA2,0x63,0x9A,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x43,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x63,0x9A,0x64,0x9A,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x43,0x92,
-	0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x84,0xA2,0xA4,0xAA,0x84,0xA2,0x64,0x9A,0xC5,0xAA,0xA4,0xA2,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x9A,0x63,0x9A,0x44,0x9A,0x44,0x9A,0xE5,0xBA,0xA6,0xDB,0x45,0xDB,0xE5,0xBA,0x04,0xCB,0xE7,0xEB,0xA6,0xDB,0x66,0xD3,0x45,0xDB,0xA6,0xDB,0x82,0x59,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x44,0x8A,0x46,0xBB,0x66,0xC3,0xC7,0xD3,0xC7,0xD3,0x25,0xBB,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0xA5,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xE5,0xAA,0x05,0xB3,
-	0x05,0xB3,0xE5,0xB2,0xA4,0xAA,0x84,0xA2,0x84,0xA2,0xC5,0xAA,0xC5,0xAA,0x05,0xB3,0x05,0xB3,0xA4,0xAA,0xE5,0xB2,0x87,0xC3,0xC7,0xD3,0xA7,0xD3,0xE5,0xB2,0x46,0xC3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x66,0xD3,0x05,0xBB,0xC4,0xAA,0x84,0xA2,0xA5,0xAA,0xC4,0xAA,0xC5,0xAA,0x84,0xA2,0xC5,0xAA,0xA4,0xAA,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,
-	0xC5,0xAA,0x25,0xBB,0x26,0xBB,0xA4,0xAA,0xA4,0xA2,0xA4,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xE3,0x79,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xC3,0x69,0xC3,0x69,0xA2,0x69,0xA3,0x69,0x83,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0xA3,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x59,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0xA3,0x61,0xA3,0x61,0x82,0x59,0x62,0x59,0x82,0x61,0xA3,0x61,0x82,0x61,0x83,0x61,0xC3,0x69,0xA7,0x72,0x49,0x93,0x49,0x93,
-	0x49,0x93,0x49,0x93,0x49,0x93,0x69,0xB3,0xAD,0xEC,0x4A,0xFC,0x28,0xEC,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0xA8,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0xA7,0xDB,0xA7,0xDB,0x66,0xD3,0x25,0xBB,0xA5,0x9A,0x64,0x9A,0xA4,0xA2,0x84,0xA2,0xA4,0xAA,0x84,0xA2,0x64,0x9A,0x63,0x9A,0x43,0x92,0x63,0x9A,0x44,0x9A,0x64,0x9A,0x64,0x9A,
-	0x63,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x63,0x9A,0x63,0x9A,0x84,0xA2,0xC5,0xAA,0xA4,0xAA,0x84,0x9A,0x64,0x9A,0x44,0x9A,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x23,0x92,0x43,0x92,0x64,0x9A,0x23,0x92,0x03,0x8A,0x44,0x9A,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0x64,0x9A,0x23,0x8A,0x43,0x92,0x23,0x92,0x23,0x9A,
-	0x64,0x9A,0x44,0x9A,0x44,0x9A,0xE5,0xB2,0xC5,0xAA,0x05,0xBB,0xC4,0xB2,0x24,0xA2,0x84,0xA2,0x23,0x92,0x24,0xA2,0x25,0xC3,0x45,0xCB,0xA5,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x05,0xB3,0x46,0xBB,0xC4,0xB2,0x25,0xC3,0x46,0xC3,0xE5,0xB2,0x84,0x9A,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,
-	0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xAA,0xC5,0xAA,0xE5,0xAA,0x25,0xBB,0xE5,0xB2,0xC4,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xE5,0xAA,0xE5,0xB2,0x84,0xA2,0xE5,0xB2,0xA7,0xD3,0xA7,0xD3,0x66,0xCB,0xC4,0xB2,0x46,0xBB,
-	0xE7,0xDB,0xE7,0xDB,0xA7,0xDB,0x25,0xC3,0x25,0xBB,0xE5,0xAA,0x84,0xA2,0xA4,0xAA,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0xA4,0xA2,0x05,0xB3,0x25,0xBB,0xE5,0xB2,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0xA4,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x03,0x82,0x82,0x61,0xA2,0x61,0xA2,0x61,0xC3,0x69,
-	0xC3,0x69,0xC3,0x69,0xC3,0x69,0xC3,0x71,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA3,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x61,0x82,0x61,0xA3,0x69,0xC3,0x69,0x82,0x59,0x82,0x59,0x62,0x61,0x82,0x59,0x82,0x59,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,
-	0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC5,0x61,0xA7,0x72,0x49,0x93,0x49,0x93,0x49,0x93,0x49,0x93,0xC7,0x92,0xC7,0x92,0x49,0x93,0xC7,0x92,0x69,0xB3,0xC9,0xE3,0xC9,0xE3,0x2A,0xEC,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0x66,0xD3,0x66,0xD3,0xC7,0xE3,
-	0x45,0xDB,0x45,0xCB,0x25,0xC3,0x45,0xCB,0x45,0xCB,0x25,0xC3,0xE5,0xB2,0xE5,0xB2,0x84,0xA2,0x64,0x92,0x64,0x9A,0x44,0x9A,0x64,0x92,0x63,0x9A,0x63,0x9A,0x84,0x9A,0x64,0x9A,0x63,0x9A,0x44,0x9A,0x84,0x9A,0x84,0xA2,0x84,0xA2,0xC5,0xAA,0xC4,0xAA,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x43,0x92,
-	0x44,0x9A,0x23,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x23,0x92,0x23,0x8A,0x63,0x9A,0x63,0x9A,0x84,0xA2,0xC5,0xAA,0x43,0x92,0x23,0x8A,0x23,0x92,0x43,0x92,0x64,0x92,0x44,0x9A,0x23,0x92,0x63,0x9A,0x63,0x9A,0x63,0x9A,0xE5,0xBA,0x05,0xBB,0x43,0x92,0xE3,0x81,0x03,0x82,0x03,0x82,0x64,0x9A,0x45,0xCB,0xA6,0xDB,0x60,0x18,0x00,0x00,
-	0x00,0x00,0x01,0x49,0xE5,0xAA,0xA4,0xAA,0xA4,0xAA,0xC5,0xAA,0x25,0xBB,0xC5,0xAA,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xAA,0x05,0xB3,0x25,0xBB,
-	0x66,0xC3,0x25,0xBB,0xC4,0xAA,0xC5,0xAA,0xC4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xAA,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0x05,0xB3,0x05,0xBB,0x87,0xC3,0xC4,0xAA,0x84,0xA2,0x66,0xC3,0xE7,0xDB,0x25,0xC3,0x84,0xA2,0x05,0xB3,0x46,0xBB,0x05,0xB3,0xC5,0xAA,0xE5,0xB2,0xC5,0xAA,0xA4,0xAA,0x84,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,
-	0xA4,0xA2,0xA5,0xA2,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x64,0x92,0xC3,0x71,0xA3,0x69,0xA3,0x69,0xA3,0x69,0x04,0x7A,0x04,0x7A,0x04,0x7A,0xC2,0x69,0xA3,0x69,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,
-	0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x61,0xA3,0x69,0xC3,0x69,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,
-	0x82,0x59,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x84,0x51,0xA7,0x72,0xEB,0x62,0x49,0x93,0xED,0x93,0x49,0x93,0x49,0x93,0xC7,0x92,0xC7,0x92,0xC7,0x92,0x65,0x8A,0xC7,0x92,
-	0x69,0xB3,0x0C,0xE4,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0xC9,0xE3,0x28,0xEC,0xC9,0xE3,0x2A,0xEC,0xA7,0xD3,0x26,0xBB,0xA7,0xDB,0xC9,0xE3,0xC7,0xE3,0x66,0xD3,0x45,0xDB,0x66,0xEB,0x45,0xDB,0x45,0xDB,0x45,0xDB,0x04,0xCB,0xE5,0xBA,0xE5,0xBA,0xE5,0xB2,0xE5,0xBA,0x45,0xCB,0xC4,0xB2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x63,0x9A,
-	0x84,0x9A,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0xA4,0xAA,0x05,0xB3,0x46,0xC3,0xC4,0xB2,0x84,0xA2,0xA4,0xA2,0x63,0x9A,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x23,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x23,0x92,0x43,0x92,0x43,0x92,0x23,0x8A,0x23,0x92,0x23,0x92,0x43,0x92,0x64,0x92,
-	0x43,0x92,0x64,0x9A,0x63,0x9A,0x64,0x9A,0xA4,0xAA,0xE5,0xBA,0x45,0xCB,0xC4,0xAA,0x23,0x92,0x23,0x92,0x64,0x92,0x84,0xA2,0x25,0xC3,0x25,0xC3,0x22,0x49,0x00,0x00,0x00,0x00,0x04,0x7A,0xA4,0xAA,0xA4,0xAA,0xE5,0xAA,0xE5,0xAA,0x26,0xBB,0xE5,0xB2,0xA4,0xA2,0xA4,0xA2,0x64,0x9A,0xA4,0xA2,0xA5,0xAA,0xC5,0xAA,0x84,0xA2,0xA5,0xAA,
-	0xC5,0xAA,0xA4,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0x05,0xB3,0x25,0xC3,0x46,0xC3,0x87,0xCB,0x05,0xB3,0xE5,0xB2,0xE5,0xB2,0xE5,0xB2,0x26,0xBB,0x05,0xB3,0xC5,0xAA,0xA5,0xAA,0xA4,0xAA,0xC5,0xAA,0xE5,0xB2,0xE5,0xB2,0xC4,0xAA,0xE5,0xB2,
-	0x05,0xB3,0x05,0xBB,0xE5,0xB2,0x84,0xA2,0xC4,0xAA,0x05,0xBB,0x26,0xBB,0x46,0xBB,0x25,0xC3,0xC4,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xA5,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,
-	0x05,0xB3,0x25,0xC3,0xC4,0xB2,0xA4,0xAA,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x26,0xBB,0x26,0xBB,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0x64,0x9A,0x63,0x9A,0xE5,0xAA,0x05,0xB3,0xA4,0xAA,0x05,0xB3,0xA4,0xAA,0x84,0xA2,0xE5,0xB2,0x46,0xBB,0x05,0xB3,0xE5,0xB2,0x26,0xBB,0xE5,0xB2,0xA5,0xA2,0x64,0x9A,
-	0x64,0x9A,0x84,0xA2,0x84,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0xC4,0xAA,0xA5,0xAA,0x64,0x9A,0xA5,0xA2,0xC5,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x49,0x93,0xF1,0xAC,0xD4,0xF6,0xD4,0xF6,0x4E,0xFE,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0x0C,0xE4,0x08,0xDC,0x0C,0xE4,0xC9,0xE3,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0x28,0xEC,0xA7,0xDB,0x28,0xEC,0xC7,0xE3,0xC7,0xE3,0xA6,0xDB,0x45,0xDB,0x45,0xDB,0x45,0xDB,
-	0x04,0xDB,0x04,0xCB,0x04,0xDB,0x45,0xDB,0x04,0xDB,0xC4,0xB2,0x64,0x9A,0xE5,0xB2,0xE5,0xBA,0xC4,0xB2,0x04,0xCB,0x04,0xCB,0x04,0xCB,0xC4,0xB2,0x44,0x9A,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x05,0xBB,0x66,0xCB,0x87,0xCB,0x25,0xC3,0x64,0x9A,0x64,0x9A,0x23,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x92,
-	0x64,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x23,0x92,0x43,0x92,0x43,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x92,0x43,0x92,0x64,0x92,0x63,0x9A,0xA4,0xAA,0x64,0x9A,0x63,0x9A,0xC4,0xB2,0xC4,0xB2,0xC4,0xB2,0x05,0xBB,0x63,0x9A,0x03,0x8A,0x23,0x92,0xA4,0xAA,0x25,0xBB,0x25,0xC3,0x03,0x82,0x00,0x00,
-	0x00,0x00,0x84,0x9A,0x25,0xBB,0x46,0xBB,0x26,0xBB,0xC4,0xAA,0x05,0xB3,0x25,0xBB,0x25,0xBB,0x05,0xB3,0xA4,0xA2,0x64,0x9A,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xC5,0xAA,0x46,0xC3,0xC4,0xB2,
-	0x05,0xB3,0x66,0xC3,0xE5,0xB2,0xE5,0xAA,0xA4,0xAA,0xC4,0xAA,0x05,0xB3,0x05,0xB3,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xAA,0x84,0xA2,0xA4,0xA2,0x66,0xC3,0xC7,0xD3,0x46,0xC3,0xC4,0xAA,0xE5,0xAA,0xC5,0xAA,0xE5,0xB2,0x05,0xB3,0xC4,0xB2,0xE5,0xB2,0x66,0xC3,0x05,0xB3,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,
-	0xE5,0xB2,0x26,0xBB,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0x84,0xA2,0xA5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x05,0xB3,0x25,0xC3,0x25,0xBB,0xE5,0xB2,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0xC5,0xAA,0xC5,0xA2,0x05,0xB3,0x87,0xCB,0x05,0xB3,0xE5,0xB2,0xE5,0xB2,0xE5,0xB2,0xE5,0xB2,
-	0x05,0xB3,0xE5,0xB2,0x25,0xBB,0xE5,0xB2,0xC4,0xB2,0xE5,0xB2,0x26,0xBB,0x25,0xBB,0x46,0xBB,0x05,0xBB,0xC5,0xAA,0x25,0xBB,0x46,0xC3,0xA4,0xAA,0x84,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0xA2,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,
-	0x84,0xA2,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xED,0x93,0xBA,0xD6,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x89,0xEC,0x08,0xDC,0xC9,0xE3,0x2A,0xEC,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,
-	0xC9,0xE3,0xA7,0xDB,0xE7,0xEB,0xC9,0xE3,0xE7,0xEB,0xC7,0xE3,0xC7,0xE3,0xC7,0xE3,0xE7,0xEB,0xC7,0xE3,0x66,0xEB,0x66,0xEB,0x66,0xEB,0xA6,0xF3,0x04,0xDB,0xE3,0xD2,0x04,0xDB,0x04,0xDB,0xC4,0xB2,0xE5,0xBA,0x04,0xCB,0xE5,0xBA,0xE5,0xBA,0x05,0xBB,0xC4,0xB2,0xC4,0xB2,0xA4,0xAA,0xC4,0xB2,0xC4,0xB2,0xC4,0xB2,0xC4,0xB2,0x04,0xCB,
-	0x84,0xA2,0x84,0xA2,0x84,0xA2,0xC4,0xAA,0x45,0xCB,0x46,0xC3,0x25,0xC3,0x25,0xC3,0xA4,0xAA,0x23,0x8A,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x9A,0x64,0x92,0x23,0x92,0x23,0x92,0x44,0x9A,0x63,0x9A,0x23,0x92,0x43,0x92,0x43,0x92,0x23,0x92,0x23,0x92,0x23,0x92,0x23,0x92,0x43,0x92,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x92,
-	0x43,0x92,0x64,0x9A,0x64,0x9A,0x23,0x9A,0x63,0x9A,0x84,0xA2,0xC5,0xAA,0xA4,0xAA,0x84,0xA2,0x64,0x9A,0xC5,0xAA,0xC4,0xB2,0xC4,0xB2,0xE5,0xBA,0xE5,0xB2,0x00,0x00,0x60,0x18,0x05,0xBB,0x25,0xC3,0xA8,0xCB,0x87,0xCB,0x25,0xBB,0xC4,0xAA,0x05,0xB3,0x25,0xBB,0x05,0xB3,0xC5,0xAA,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0xA5,0xA2,0x84,0xA2,
-	0xE5,0xAA,0xE5,0xAA,0x84,0xA2,0xA5,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0xA2,0x66,0xC3,0x25,0xBB,0xE5,0xB2,0x66,0xC3,0x05,0xB3,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0xA2,0xC5,0xAA,0xA4,0xA2,0xA5,0xAA,0xE5,0xAA,0xA4,0xA2,0x64,0x9A,0xA4,0xA2,0x26,0xBB,0x46,0xBB,
-	0xC5,0xAA,0xC4,0xAA,0xC5,0xAA,0x05,0xB3,0x66,0xC3,0x26,0xBB,0xC4,0xAA,0x05,0xB3,0x46,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA5,0xA2,0xC5,0xAA,0x26,0xBB,0x26,0xBB,0x25,0xBB,0xE5,0xB2,0xC5,0xAA,0xA4,0xA2,0xC5,0xAA,0xE5,0xAA,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0x9A,0xC5,0xAA,0x05,0xB3,
-	0x25,0xBB,0xE5,0xB2,0xA4,0xA2,0x84,0xA2,0xA4,0xAA,0xA5,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0x84,0xA2,0xC5,0xAA,0x25,0xBB,0xE5,0xB2,0xE5,0xB2,0xE5,0xB2,0xC4,0xB2,0x25,0xC3,0x66,0xC3,0xA4,0xAA,0x05,0xB3,0x46,0xBB,0x25,0xBB,0xA7,0xD3,0x49,0xEC,0x08,0xDC,0x05,0xBB,0x26,0xBB,0xE7,0xDB,0xE7,0xDB,0x05,0xBB,0x64,0x9A,0x64,0x9A,
-	0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0xE5,0xAA,0xA5,0xAA,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x70,0x94,0xBA,0xD6,
-	0xDA,0xFF,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0x89,0xEC,0x0C,0xE4,0x0C,0xE4,0xC9,0xE3,0xC9,0xE3,0x2A,0xEC,0xC9,0xE3,0xC7,0xD3,0xA7,0xDB,0x87,0xCB,0xA7,0xD3,0x66,0xD3,0x45,0xCB,0x66,0xD3,0xC7,0xE3,0xE7,0xEB,0xE7,0xEB,0xE7,0xF3,0xA6,0xF3,0x66,0xEB,0xE7,0xF3,0xA6,0xF3,0xE7,0xF3,0xE7,0xF3,0x64,0xF3,
-	0x44,0xE3,0x03,0xDB,0x24,0xEB,0x44,0xE3,0x03,0xDB,0x04,0xCB,0xC3,0xBA,0xC4,0xB2,0xC3,0xBA,0xC4,0xB2,0xA4,0xAA,0xA4,0xAA,0xA4,0xAA,0x63,0x9A,0xA4,0xA2,0xA4,0xAA,0xE5,0xBA,0xC3,0xBA,0xE5,0xB2,0x05,0xB3,0x25,0xBB,0xE5,0xBA,0xE5,0xBA,0x25,0xBB,0x84,0xA2,0x23,0x8A,0x64,0x92,0x43,0x92,0x23,0x92,0x64,0x92,0x43,0x92,0x23,0x92,
-	0x43,0x92,0x23,0x92,0x64,0x9A,0x64,0x92,0x43,0x92,0x23,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x23,0x8A,0x23,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x92,0x43,0x92,0x64,0x9A,0x64,0x9A,0x23,0x92,0x64,0x9A,0xE5,0xB2,0xE5,0xBA,0x46,0xC3,0xA6,0xD3,0x66,0xCB,0x25,0xC3,0x83,0xB2,0x22,0xA2,0xE5,0xBA,0x60,0x18,
-	0x22,0x49,0x08,0xDC,0x66,0xC3,0x45,0xCB,0xA6,0xD3,0x66,0xCB,0x05,0xB3,0xE5,0xB2,0xA4,0xAA,0x84,0xA2,0xE5,0xAA,0xE5,0xAA,0xC4,0xAA,0xE5,0xAA,0x05,0xB3,0xC4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x64,0x9A,0xA5,0xA2,0x46,0xBB,0xC7,0xD3,
-	0x87,0xCB,0x66,0xCB,0xC5,0xAA,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xE5,0xB2,0x46,0xC3,0xE5,0xB2,0xA4,0xAA,0x46,0xBB,0x26,0xBB,0x05,0xB3,0x25,0xBB,0x46,0xBB,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,
-	0xA4,0xAA,0xC5,0xAA,0x05,0xB3,0x26,0xBB,0x26,0xBB,0xE5,0xB2,0xC4,0xAA,0xE5,0xB2,0xE5,0xB2,0xC5,0xAA,0x05,0xB3,0x46,0xBB,0x05,0xB3,0x26,0xBB,0x87,0xCB,0x25,0xBB,0x25,0xBB,0xE5,0xAA,0x84,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0x05,0xB3,0xA4,0xAA,0xC5,0xAA,0x05,0xB3,0x84,0xA2,
-	0xC5,0xAA,0xE5,0xAA,0x63,0x9A,0xE5,0xB2,0xE7,0xDB,0xE7,0xEB,0x49,0xEC,0x89,0xEC,0xE7,0xEB,0x46,0xC3,0x66,0xCB,0x28,0xEC,0xE7,0xEB,0x46,0xC3,0xA4,0xA2,0xA5,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,
-	0x64,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x84,0xA2,0xA4,0xAA,0xC5,0xAA,0xA4,0xA2,0x63,0x9A,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0xED,0x93,0xBA,0xD6,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0x4D,0xD5,0xAD,0xEC,0x89,0xEC,0x0C,0xE4,0x0C,0xE4,0xC9,0xE3,0x08,0xDC,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xA8,0xCB,0x46,0xBB,0x26,0xBB,
-	0xE5,0xB2,0xE5,0xAA,0xE5,0xB2,0x25,0xC3,0xA6,0xDB,0x66,0xEB,0xC7,0xE3,0xE7,0xF3,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0x85,0xEB,0xA6,0xF3,0x64,0xF3,0xA6,0xF3,0xA4,0xF3,0x64,0xF3,0x24,0xEB,0x66,0xEB,0x44,0xE3,0x44,0xE3,0x44,0xE3,0xE3,0xD2,0xE5,0xBA,0x04,0xCB,0xE3,0xD2,0xC3,0xBA,0xC4,0xB2,0xC4,0xB2,0x84,0xA2,0x84,0xA2,0xA4,0xAA,
-	0xA4,0xAA,0xC5,0xAA,0xE5,0xBA,0x04,0xDB,0xA4,0xAA,0xC4,0xB2,0x46,0xC3,0x05,0xBB,0x63,0x9A,0x43,0x92,0x23,0x8A,0x23,0x8A,0x23,0x92,0x43,0x92,0x23,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x23,0x92,0x43,0x92,0x23,0x92,0x23,0x92,0x44,0x8A,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x92,0x23,0x8A,0x23,0x92,0x23,0x8A,
-	0x23,0x8A,0x23,0x92,0x43,0x92,0x44,0x9A,0x23,0x92,0x23,0x92,0x63,0x9A,0x84,0xA2,0x25,0xC3,0xE5,0xBA,0xE5,0xBA,0x45,0xCB,0x25,0xC3,0xC4,0xB2,0xE5,0xBA,0xE1,0x40,0xC3,0x61,0x08,0xDC,0x49,0xEC,0x08,0xDC,0x08,0xDC,0x66,0xCB,0x66,0xCB,0x25,0xBB,0xC5,0xAA,0xC5,0xAA,0x05,0xB3,0x66,0xC3,0x46,0xC3,0xA8,0xCB,0x87,0xCB,0xE5,0xB2,
-	0x63,0x9A,0xA4,0xA2,0x46,0xBB,0x05,0xB3,0xA4,0xAA,0x84,0xA2,0x84,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0x9A,0xE5,0xAA,0x46,0xC3,0xC7,0xD3,0x28,0xEC,0x05,0xBB,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xC4,0xAA,0xC5,0xAA,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0x9A,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x64,0x9A,
-	0xA5,0xA2,0xC5,0xAA,0xA5,0xAA,0xC5,0xAA,0x84,0xA2,0xA4,0xAA,0xE5,0xAA,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x66,0xC3,0x25,0xC3,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0x84,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0x05,0xBB,0x46,0xBB,0x46,0xBB,0xE5,0xBA,0x05,0xB3,0xC4,0xB2,0x46,0xBB,0x25,0xC3,0x25,0xC3,0x66,0xCB,0xA7,0xD3,0xA7,0xD3,0xA8,0xCB,
-	0x46,0xC3,0x26,0xBB,0x05,0xB3,0xC5,0xAA,0xC5,0xA2,0xA4,0xAA,0x84,0xA2,0x84,0xA2,0x05,0xB3,0x87,0xCB,0x26,0xBB,0xE5,0xB2,0xA4,0xAA,0x84,0xA2,0xC5,0xAA,0xA4,0xAA,0xE5,0xB2,0x66,0xC3,0x46,0xBB,0x05,0xB3,0xE7,0xDB,0x89,0xEC,0x89,0xEC,0x49,0xEC,0xE7,0xDB,0x45,0xCB,0x66,0xD3,0x08,0xDC,0xE7,0xDB,0x25,0xC3,0x05,0xB3,0xC4,0xB2,
-	0x64,0x92,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0xC7,0x92,0xBA,0xD6,0xDA,0xFF,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,
-	0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x0C,0xE4,0x0C,0xE4,0x08,0xDC,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xA8,0xCB,0x87,0xC3,0x26,0xBB,0x05,0xB3,0x25,0xBB,0x05,0xBB,0xE5,0xBA,0xE5,0xBA,0x04,0xCB,0x66,0xEB,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0xE7,0xEB,0xA6,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0xA4,0xF3,0x64,0xF3,
-	0x64,0xF3,0x64,0xF3,0x23,0xEB,0x04,0xCB,0xE3,0xD2,0xE3,0xD2,0x04,0xDB,0x04,0xDB,0xA4,0xCA,0x44,0xE3,0x44,0xE3,0xC3,0xBA,0xC3,0xBA,0xE5,0xBA,0x83,0xB2,0xE5,0xBA,0xC4,0xB2,0x04,0xCB,0xC3,0xCA,0x83,0xB2,0x04,0xCB,0x04,0xDB,0xE5,0xBA,0x25,0xBB,0xC4,0xAA,0xC4,0xAA,0x64,0x9A,0x64,0x9A,0x64,0x92,0x44,0x8A,0x23,0x92,0x43,0x92,
-	0x23,0x8A,0x23,0x92,0x23,0x92,0x43,0x92,0x23,0x92,0x43,0x92,0x23,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x43,0x92,0x23,0x8A,0x23,0x8A,0x43,0x92,0x43,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x43,0x92,0x43,0x92,0x23,0x8A,0x23,0x92,0x63,0x9A,0x64,0x9A,0x63,0x9A,0xA4,0xAA,0xC4,0xB2,0xE5,0xBA,0x25,0xC3,0x82,0x59,
-	0x04,0x7A,0xA6,0xD3,0x28,0xEC,0x89,0xEC,0x49,0xEC,0x28,0xEC,0xE7,0xDB,0xC7,0xD3,0xA7,0xD3,0x66,0xCB,0x66,0xCB,0x66,0xCB,0xE5,0xBA,0x87,0xCB,0x66,0xCB,0xE5,0xB2,0xC4,0xAA,0xE5,0xAA,0xA8,0xCB,0x46,0xC3,0xA4,0xAA,0x84,0x9A,0x84,0x9A,0x84,0xA2,0x64,0x9A,0x84,0x9A,0x84,0xA2,0x84,0x9A,0xA4,0xA2,0xC5,0xAA,0x25,0xBB,0xA7,0xD3,
-	0x08,0xDC,0x25,0xC3,0x84,0xA2,0xA4,0xA2,0xC4,0xA2,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0xA2,0xA5,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0x9A,0xE5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0x43,0x92,0x84,0xA2,0x06,0xB3,0xC4,0xB2,0x05,0xBB,0x26,0xBB,0x05,0xB3,0x25,0xBB,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xAA,
-	0xC5,0xAA,0xC5,0xAA,0xC4,0xAA,0x25,0xBB,0x66,0xCB,0x46,0xC3,0x46,0xC3,0x05,0xB3,0xC4,0xB2,0xE5,0xB2,0xE5,0xBA,0x05,0xB3,0x25,0xBB,0xC4,0xB2,0xE5,0xBA,0x46,0xC3,0xE5,0xBA,0xC4,0xB2,0x46,0xC3,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0x84,0xA2,0xC5,0xAA,0x25,0xBB,0x66,0xCB,0x66,0xC3,0xA4,0xAA,0xA4,0xA2,0xC5,0xAA,0x26,0xBB,0x66,0xCB,
-	0xA7,0xD3,0x49,0xEC,0x49,0xEC,0xC7,0xE3,0x28,0xEC,0x49,0xEC,0x49,0xEC,0x28,0xEC,0xC7,0xE3,0xA6,0xD3,0xA6,0xD3,0x28,0xEC,0x28,0xEC,0x46,0xC3,0x25,0xBB,0x26,0xBB,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0xA2,0xD4,0xCD,0xFF,0xFF,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0x4D,0xD5,0xAD,0xEC,0xAD,0xEC,0x0C,0xE4,0xAD,0xEC,0xAD,0xEC,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0x87,0xCB,0x66,0xC3,0x25,0xC3,0x25,0xC3,0x04,0xCB,0x04,0xCB,
-	0xE5,0xBA,0x04,0xCB,0x44,0xE3,0x24,0xEB,0x04,0xDB,0xA4,0xF3,0xA6,0xF3,0x64,0xF3,0xA4,0xF3,0xA6,0xF3,0x23,0xE3,0x44,0xE3,0x23,0xE3,0x23,0xE3,0x23,0xE3,0x23,0xE3,0xA4,0xF3,0xA6,0xF3,0xA4,0xF3,0x23,0xEB,0x23,0xE3,0x03,0xDB,0x03,0xDB,0x03,0xDB,0xE3,0xD2,0x04,0xCB,0xE4,0xE2,0x63,0xEB,0x04,0xDB,0x04,0xCB,0xC3,0xBA,0x84,0xA2,
-	0x43,0xAA,0x83,0xB2,0xC3,0xBA,0xC3,0xCA,0xC3,0xCA,0x03,0xDB,0xE3,0xD2,0x04,0xDB,0x25,0xC3,0x05,0xBB,0x84,0xA2,0x64,0x9A,0x64,0x92,0x43,0x92,0x23,0x92,0x44,0x8A,0x64,0x92,0x43,0x92,0x23,0x92,0x64,0x92,0x43,0x92,0x23,0x8A,0x44,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x92,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,
-	0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x9A,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x63,0x9A,0x24,0xA2,0xA2,0x61,0xC5,0xA2,0xA6,0xD3,0xE7,0xDB,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x89,0xEC,0x28,0xEC,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0x46,0xC3,0x87,0xCB,0x87,0xCB,0x66,0xCB,
-	0x66,0xC3,0x46,0xC3,0xA7,0xD3,0xA7,0xD3,0xC4,0xB2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0x63,0x9A,0xE5,0xAA,0xC7,0xD3,0xA7,0xD3,0x66,0xC3,0xE5,0xAA,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x06,0xB3,0xC5,0xAA,0xA5,0xA2,0xA4,0xA2,0x84,0xA2,0xA5,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0x84,0xA2,
-	0xA4,0xA2,0xE5,0xB2,0xE5,0xB2,0xA4,0xA2,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0x26,0xBB,0xE5,0xB2,0xA4,0xAA,0x05,0xB3,0x05,0xB3,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xAA,0xC5,0xAA,0xA4,0xAA,0x84,0xA2,0xA4,0xAA,0x46,0xC3,0x87,0xCB,0x05,0xBB,0xA4,0xAA,0x84,0xA2,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xE5,0xB2,0x26,0xBB,0xE5,0xB2,
-	0x05,0xB3,0xC4,0xAA,0x05,0xB3,0xE5,0xB2,0x05,0xBB,0xE5,0xB2,0x84,0xA2,0xE5,0xB2,0xE5,0xB2,0xA4,0xAA,0xA4,0xAA,0x23,0x9A,0x64,0x9A,0xA8,0xCB,0xE7,0xDB,0xA6,0xD3,0xE7,0xDB,0x49,0xEC,0x89,0xEC,0x28,0xEC,0x89,0xEC,0x49,0xEC,0x28,0xEC,0xC7,0xE3,0xA6,0xDB,0xE7,0xDB,0x28,0xEC,0x28,0xEC,0xE7,0xEB,0xC4,0xAA,0xA4,0xAA,0x26,0xBB,
-	0xE5,0xB2,0x84,0xA2,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0xED,0x93,0xBA,0xD6,0xDA,0xFF,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,
-	0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x0C,0xE4,0xC7,0xD3,0xC9,0xE3,0xC9,0xE3,0xC7,0xD3,0xA7,0xDB,0x87,0xCB,0x45,0xCB,0x66,0xD3,0x45,0xCB,0x45,0xCB,0x45,0xDB,0x04,0xCB,0xE3,0xD2,0x44,0xE3,0xA4,0xF3,0x04,0xDB,0x03,0xDB,0x64,0xF3,0xA6,0xF3,0x24,0xEB,0x23,0xE3,0x23,0xE3,0x23,0xE3,0x23,0xE3,0x03,0xDB,0x03,0xDB,0x85,0xEB,0x24,0xEB,
-	0x63,0xEB,0x63,0xEB,0x63,0xEB,0x03,0xDB,0xE2,0xDA,0x23,0xEB,0x03,0xDB,0xC2,0xD2,0xC2,0xD2,0xC3,0xCA,0xE3,0xD2,0x44,0xE3,0x04,0xDB,0x04,0xCB,0xC3,0xBA,0x82,0xBA,0x43,0xB2,0x43,0xB2,0xC3,0xBA,0xC3,0xCA,0xC3,0xBA,0xC3,0xCA,0xC3,0xCA,0x03,0xDB,0x44,0xE3,0x83,0xB2,0x63,0x9A,0x43,0x92,0x23,0x92,0x43,0x92,0x43,0x92,0x23,0x92,
-	0x43,0x92,0x64,0x92,0x23,0x92,0x43,0x92,0x23,0x92,0x23,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x64,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x43,0x92,0x23,0x92,0x64,0x9A,0xA4,0xA2,0x44,0x9A,0x03,0x8A,0x02,0x8A,0xC2,0x79,
-	0x46,0xBB,0x66,0xCB,0xE7,0xDB,0x28,0xEC,0x49,0xEC,0x08,0xDC,0xE7,0xEB,0x28,0xEC,0x28,0xEC,0x28,0xEC,0x28,0xEC,0xE7,0xDB,0xA7,0xD3,0xE7,0xDB,0xA7,0xD3,0x87,0xCB,0x08,0xDC,0x28,0xEC,0xA7,0xD3,0xA7,0xD3,0x46,0xC3,0xA4,0xA2,0xA5,0xA2,0x84,0xA2,0x84,0x9A,0x84,0xA2,0x84,0x9A,0x84,0x9A,0x64,0x9A,0xA5,0x9A,0x46,0xBB,0xE7,0xDB,
-	0xE7,0xDB,0x87,0xCB,0x46,0xC3,0x46,0xC3,0x05,0xB3,0x25,0xBB,0xE5,0xB2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0xA4,0xA2,0x25,0xBB,0x66,0xCB,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0x05,0xAB,0x26,0xBB,0x87,0xC3,0x25,0xBB,0xA4,0xAA,0xE5,0xB2,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,
-	0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0x84,0xA2,0xA5,0xA2,0xC5,0xAA,0xC4,0xB2,0x25,0xBB,0x26,0xBB,0xC5,0xAA,0xA4,0xAA,0xA4,0xA2,0xC5,0xAA,0x87,0xCB,0xE7,0xDB,0x66,0xC3,0xE5,0xB2,0x05,0xB3,0xE5,0xB2,0x05,0xB3,0x26,0xBB,0x46,0xBB,0xE5,0xB2,0xE5,0xB2,0x46,0xBB,0xC4,0xAA,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x25,0xC3,0x28,0xEC,0x28,0xEC,
-	0x66,0xD3,0x66,0xD3,0xA7,0xDB,0x28,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x28,0xEC,0xE7,0xEB,0x49,0xEC,0x28,0xEC,0x49,0xEC,0xE7,0xDB,0x87,0xCB,0xE5,0xAA,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0xF1,0xAC,0xFF,0xFF,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0x0C,0xE4,0x0C,0xE4,0xC9,0xE3,0xC9,0xE3,0xA8,0xCB,0x87,0xCB,0xA7,0xD3,0xA7,0xDB,0xA6,0xDB,0x45,0xDB,0x45,0xDB,0x44,0xE3,0x85,0xEB,0x24,0xEB,0x24,0xEB,
-	0x24,0xEB,0x64,0xF3,0xA4,0xF3,0x23,0xEB,0x03,0xDB,0x23,0xE3,0xA4,0xF3,0x23,0xEB,0x23,0xEB,0x23,0xE3,0x23,0xE3,0x24,0xEB,0x44,0xE3,0x44,0xE3,0x85,0xEB,0x64,0xF3,0x23,0xE3,0x63,0xEB,0x03,0xDB,0x03,0xDB,0x02,0xE3,0x23,0xE3,0x02,0xE3,0xC3,0xCA,0x03,0xDB,0xC2,0xD2,0xE2,0xDA,0x03,0xDB,0x23,0xE3,0xE4,0xE2,0xC2,0xD2,0xC3,0xCA,
-	0xC3,0xBA,0x82,0xBA,0xC3,0xCA,0x82,0xC2,0xC3,0xCA,0xC2,0xD2,0x82,0xBA,0xC3,0xCA,0x82,0xC2,0x23,0xE3,0x04,0xDB,0x43,0x92,0x23,0x92,0x43,0x92,0x44,0x8A,0x23,0x92,0x23,0x92,0x64,0x9A,0x64,0x9A,0x43,0x92,0x43,0x92,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x92,0x23,0x92,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,
-	0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x92,0x23,0x9A,0x84,0xA2,0xA4,0xAA,0x43,0x92,0xE2,0x81,0x03,0x8A,0x23,0x8A,0x26,0xBB,0x46,0xC3,0xA6,0xD3,0x28,0xEC,0x28,0xEC,0x49,0xEC,0xE7,0xDB,0xA6,0xD3,0x66,0xD3,0xE7,0xDB,0xC7,0xD3,0xA6,0xD3,0x45,0xCB,0xA6,0xD3,0xE7,0xDB,0xA6,0xD3,
-	0x28,0xEC,0x89,0xEC,0xE7,0xDB,0x87,0xCB,0x66,0xCB,0xC4,0xAA,0x84,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x06,0xB3,0xE7,0xDB,0xE7,0xDB,0x66,0xCB,0x87,0xCB,0xC7,0xD3,0xC7,0xD3,0x66,0xC3,0x05,0xB3,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0x84,0x9A,0x84,0xA2,0xC5,0xA2,0x84,0xA2,0xC5,0xAA,0x05,0xB3,0x26,0xBB,
-	0x87,0xCB,0xA7,0xD3,0xA7,0xD3,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x66,0xC3,0x25,0xBB,0x05,0xBB,0xA4,0xAA,0x84,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xC5,0xAA,0xA4,0xA2,0xE5,0xB2,0x87,0xCB,0x25,0xBB,0xE5,0xB2,0xC5,0xAA,0xC5,0xAA,0x46,0xC3,0xE7,0xDB,0x28,0xEC,0xA6,0xD3,
-	0x66,0xCB,0x66,0xCB,0x25,0xC3,0x05,0xBB,0x66,0xC3,0x87,0xCB,0x25,0xC3,0x05,0xBB,0xA7,0xD3,0xC7,0xD3,0xA8,0xCB,0x87,0xCB,0x46,0xC3,0x66,0xCB,0xA7,0xDB,0xE7,0xDB,0x66,0xCB,0xC4,0xB2,0x66,0xC3,0xC7,0xE3,0x49,0xEC,0x89,0xEC,0x28,0xEC,0x28,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x28,0xEC,0x28,0xEC,0xE7,0xDB,0xE5,0xB2,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x44,0x9A,0xA5,0x9A,0xBA,0xD6,0xDA,0xFF,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xB0,0xED,0x4D,0xD5,0xAD,0xEC,0x0C,0xE4,
-	0x0C,0xE4,0x0C,0xE4,0x0C,0xE4,0xC9,0xE3,0xE7,0xDB,0xC9,0xE3,0xA7,0xDB,0xA6,0xDB,0xA6,0xDB,0x45,0xDB,0x66,0xEB,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0x64,0xF3,0x64,0xF3,0xC4,0xFB,0xA4,0xF3,0x24,0xEB,0x23,0xEB,0xA4,0xF3,0x23,0xEB,0x23,0xEB,0xA4,0xF3,0x63,0xEB,0x23,0xEB,0x23,0xE3,0x03,0xDB,0x03,0xDB,0xE3,0xD2,0xC3,0xBA,0x63,0xEB,
-	0x63,0xEB,0x63,0xEB,0x03,0xDB,0x23,0xE3,0xA4,0xF3,0x02,0xE3,0x23,0xEB,0x02,0xE3,0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0x02,0xE3,0xE2,0xE2,0xE2,0xDA,0x02,0xE3,0xC3,0xCA,0xC2,0xD2,0xC2,0xD2,0xE2,0xDA,0xC3,0xCA,0x82,0xC2,0xC2,0xD2,0x43,0xB2,0xC3,0xCA,0xC2,0xD2,0xC3,0xCA,0xE4,0xE2,0x23,0xEB,0x23,0x92,0x43,0x92,0x23,0x8A,0x23,0x92,
-	0x23,0x92,0x64,0x9A,0x64,0x9A,0x43,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x43,0x92,0xE5,0xBA,0x25,0xC3,0x66,0xCB,0x25,0xC3,0x63,0x9A,0x44,0x9A,0x84,0xA2,
-	0xC5,0xAA,0x05,0xB3,0x46,0xBB,0xC7,0xD3,0x28,0xEC,0x49,0xEC,0x28,0xEC,0xE7,0xDB,0xC7,0xD3,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0x08,0xDC,0x28,0xEC,0xE7,0xDB,0xE7,0xDB,0x28,0xEC,0x28,0xEC,0xA6,0xD3,0xA8,0xCB,0x87,0xCB,0xA4,0xAA,0x64,0x9A,0x64,0x9A,0x64,0x9A,0xA4,0xA2,0xC5,0xA2,0xA5,0xA2,0x26,0xBB,0xC7,0xD3,0x66,0xCB,
-	0xC4,0xB2,0x87,0xCB,0x28,0xEC,0x08,0xDC,0xA7,0xD3,0x05,0xB3,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xC5,0xAA,0x25,0xBB,0x87,0xCB,0xA7,0xD3,0xE7,0xDB,0x66,0xCB,0xC7,0xD3,0xE7,0xDB,0x45,0xCB,0x46,0xC3,0x87,0xCB,0x25,0xBB,0x05,0xBB,0xE5,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xAA,0xC5,0xA2,
-	0xA4,0xAA,0xC5,0xAA,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0xE5,0xAA,0x66,0xC3,0xA7,0xD3,0x25,0xBB,0xE5,0xB2,0x05,0xB3,0x46,0xBB,0xC7,0xD3,0x08,0xDC,0x28,0xEC,0xE7,0xDB,0xA7,0xD3,0x66,0xCB,0x25,0xC3,0x46,0xC3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0x49,0xEC,0x89,0xEC,0xA7,0xD3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,
-	0xE7,0xDB,0xA7,0xD3,0x08,0xDC,0x49,0xEC,0x28,0xEC,0xC7,0xE3,0xA6,0xDB,0x28,0xEC,0x28,0xEC,0x28,0xEC,0x08,0xDC,0xC7,0xE3,0x28,0xEC,0x25,0xC3,0x84,0xA2,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,
-	0x64,0x9A,0x84,0x9A,0x64,0x9A,0x49,0x93,0x5D,0xEF,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x0C,0xE4,0xC9,0xE3,0xC9,0xE3,0xE7,0xDB,0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0xE7,0xEB,0xC7,0xE3,0x66,0xEB,0x66,0xEB,0x24,0xEB,0xA6,0xF3,0x28,0xF4,0x28,0xF4,0xC4,0xFB,0xA4,0xF3,0xA4,0xF3,
-	0xA6,0xF3,0x64,0xF3,0x23,0xEB,0x23,0xEB,0x24,0xEB,0x23,0xE3,0x85,0xEB,0xA6,0xF3,0x63,0xEB,0x23,0xEB,0x23,0xE3,0xC2,0xD2,0x83,0xB2,0x43,0xB2,0x43,0xB2,0xC3,0xCA,0x44,0xE3,0x02,0xE3,0x23,0xE3,0x42,0xF3,0x42,0xF3,0x42,0xF3,0x02,0xE3,0x23,0xEB,0x23,0xEB,0x03,0xDB,0xC2,0xD2,0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0xE2,0xE2,0xC2,0xD2,
-	0x82,0xC2,0x82,0xCA,0xC2,0xD2,0x82,0xC2,0x82,0xBA,0x82,0xBA,0xC3,0xBA,0x82,0xC2,0x82,0xBA,0x82,0xC2,0xA4,0xCA,0xC3,0xDA,0x23,0xE3,0x23,0x9A,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x92,0x44,0x8A,0x23,0x92,0x23,0x92,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,
-	0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x64,0x92,0x84,0xA2,0x44,0x9A,0xC5,0xAA,0x45,0xCB,0xA6,0xDB,0xA6,0xD3,0x25,0xC3,0xE5,0xBA,0xE5,0xB2,0x63,0x9A,0xC5,0xAA,0x46,0xBB,0x87,0xCB,0xA7,0xD3,0xE7,0xEB,0x49,0xEC,0x28,0xEC,0x28,0xEC,0xE7,0xDB,0xE7,0xDB,0x28,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0xE7,0xDB,
-	0xA6,0xD3,0xA7,0xD3,0xC7,0xD3,0x66,0xCB,0x45,0xCB,0x66,0xCB,0xE5,0xB2,0xC4,0xAA,0xC5,0xA2,0x84,0x9A,0x64,0x9A,0xA4,0xA2,0x84,0xA2,0x87,0xC3,0xA7,0xD3,0x46,0xC3,0x66,0xCB,0xE7,0xDB,0x08,0xDC,0xA7,0xDB,0x66,0xCB,0x25,0xC3,0x25,0xBB,0x05,0xB3,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0xE5,0xB2,0x46,0xC3,
-	0x66,0xCB,0x66,0xC3,0x25,0xC3,0x66,0xCB,0xA7,0xD3,0x46,0xC3,0x05,0xBB,0x46,0xC3,0x66,0xCB,0xC4,0xB2,0xC4,0xAA,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xB2,0xE5,0xB2,0xA4,0xA2,0xE5,0xB2,0x26,0xBB,0xE5,0xB2,0xE5,0xB2,0xC5,0xAA,0x66,0xC3,0xC7,0xD3,0xA7,0xD3,0x46,0xC3,0xC4,0xB2,0x87,0xCB,0x28,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,
-	0x08,0xDC,0xA7,0xD3,0x66,0xCB,0x66,0xCB,0x66,0xCB,0xA7,0xD3,0xC7,0xE3,0x28,0xEC,0x28,0xEC,0xC7,0xE3,0x28,0xEC,0xC7,0xE3,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0x28,0xEC,0x28,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x28,0xEC,0x66,0xD3,0xA6,0xDB,0x28,0xEC,0x28,0xEC,0xC7,0xE3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0xC4,0xB2,0x63,0x9A,0x64,0x92,
-	0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0xED,0x93,0xFF,0xFF,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0x4D,0xD5,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0xC9,0xE3,0xA8,0xCB,0xA7,0xDB,
-	0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0xC7,0xE3,0xC7,0xE3,0x66,0xEB,0x66,0xEB,0xA6,0xF3,0x85,0xEB,0xA4,0xF3,0xE7,0xF3,0x28,0xF4,0xE7,0xF3,0xA4,0xF3,0xA6,0xF3,0xE7,0xF3,0x05,0xFC,0xA4,0xF3,0x42,0xF3,0x23,0xEB,0x02,0xE3,0x24,0xEB,0x63,0xEB,0x63,0xEB,0xC2,0xD2,0xE2,0xDA,0x02,0xE3,0x02,0xE3,0x82,0xC2,0x43,0xAA,0x43,0xAA,0x43,0xB2,
-	0x82,0xBA,0xC3,0xCA,0x43,0xB2,0xC2,0xD2,0x23,0xEB,0x63,0xEB,0xE2,0xDA,0x03,0xDB,0x23,0xEB,0xA4,0xF3,0xE2,0xE2,0x22,0xEB,0x02,0xE3,0xC2,0xD2,0xE2,0xDA,0x82,0xCA,0x43,0xB2,0x82,0xBA,0x43,0xB2,0x82,0xBA,0x82,0xBA,0x23,0x92,0xC3,0xBA,0x82,0xBA,0x03,0x8A,0x43,0xAA,0x82,0xBA,0x64,0xC2,0xA3,0xD2,0xE4,0xE2,0x83,0xB2,0x23,0x8A,
-	0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x64,0x9A,0xA4,0xAA,0xA4,0xAA,0xA4,0xAA,0x45,0xCB,0x66,0xD3,0x66,0xD3,0x45,0xCB,0x66,0xCB,0xE5,0xBA,
-	0xC5,0xA2,0x87,0xC3,0x66,0xCB,0x66,0xCB,0xA7,0xD3,0xE7,0xDB,0x28,0xEC,0x08,0xDC,0x28,0xEC,0x08,0xDC,0xA6,0xD3,0xA7,0xDB,0xE7,0xDB,0x28,0xEC,0x28,0xEC,0xE7,0xDB,0xA7,0xD3,0x87,0xCB,0x66,0xCB,0x46,0xC3,0x66,0xCB,0x25,0xBB,0xC5,0xAA,0x05,0xB3,0x25,0xBB,0xA4,0xA2,0x84,0x9A,0xC5,0xAA,0x05,0xB3,0xC7,0xD3,0xA6,0xDB,0x87,0xCB,
-	0x08,0xDC,0x28,0xEC,0x28,0xEC,0xE7,0xDB,0x87,0xCB,0xE5,0xAA,0x84,0xA2,0x06,0xB3,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0x9A,0x84,0x9A,0x84,0xA2,0xC5,0xAA,0x05,0xB3,0xC4,0xAA,0xE5,0xB2,0xE5,0xAA,0xA4,0xAA,0x05,0xB3,0x25,0xC3,0x46,0xC3,0x87,0xCB,0xA8,0xCB,0x26,0xBB,0x46,0xBB,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x26,0xBB,0x05,0xB3,
-	0xC5,0xAA,0x26,0xBB,0x25,0xBB,0xC4,0xAA,0x05,0xB3,0xA4,0xAA,0x25,0xBB,0xA7,0xD3,0xE7,0xDB,0x87,0xCB,0x87,0xCB,0x08,0xDC,0x28,0xEC,0xC7,0xE3,0x28,0xEC,0x28,0xEC,0x49,0xEC,0x28,0xEC,0xA7,0xD3,0xA6,0xD3,0x87,0xCB,0x66,0xCB,0xA7,0xD3,0x28,0xEC,0x28,0xEC,0xA6,0xDB,0xC7,0xE3,0x28,0xEC,0xA7,0xDB,0x08,0xDC,0xC7,0xE3,0x28,0xEC,
-	0x28,0xEC,0xE7,0xEB,0xC7,0xE3,0xC7,0xE3,0xC7,0xE3,0xE7,0xDB,0xE7,0xDB,0xA7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0xC7,0xE3,0x05,0xBB,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,
-	0x64,0x9A,0x70,0x94,0xFF,0xFF,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x2A,0xEC,0xC9,0xE3,0x87,0xC3,0xA8,0xCB,0xA7,0xDB,0xA7,0xDB,0xC7,0xE3,0xA6,0xDB,0x66,0xEB,0xA6,0xF3,0x85,0xEB,0xA6,0xF3,0x28,0xF4,0x64,0xF3,0xA4,0xF3,0xC4,0xFB,0xA4,0xF3,0x63,0xF3,0x64,0xF3,0x05,0xFC,0xE7,0xF3,
-	0xE7,0xF3,0xC4,0xFB,0x63,0xF3,0xA4,0xF3,0x03,0xDB,0xC2,0xD2,0x03,0xDB,0xE2,0xDA,0x82,0xC2,0xE2,0xDA,0xE2,0xDA,0xC3,0xCA,0x43,0xB2,0x43,0xB2,0x43,0xAA,0x22,0xA2,0x82,0xBA,0x82,0xCA,0xC3,0xCA,0x23,0xE3,0x23,0xEB,0x23,0xEB,0x23,0xE3,0x23,0xE3,0x24,0xEB,0x23,0xEB,0x22,0xEB,0x63,0xF3,0x42,0xF3,0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,
-	0x82,0xCA,0x82,0xCA,0xC3,0xCA,0x82,0xBA,0x22,0xA2,0x23,0x8A,0x02,0x8A,0x43,0xAA,0x23,0x92,0x23,0x92,0x43,0xAA,0xC3,0xCA,0x64,0xC2,0xA3,0xD2,0xA3,0xDA,0x44,0xB2,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x92,0x43,0x92,0x43,0x92,0x03,0x8A,0x23,0x8A,0x23,0x8A,
-	0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x63,0x9A,0xA4,0xAA,0x84,0xA2,0x83,0xB2,0x25,0xC3,0xE5,0xBA,0xE5,0xBA,0x25,0xC3,0x83,0xB2,0x87,0xCB,0x08,0xDC,0xA7,0xD3,0x66,0xCB,0x87,0xCB,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0x28,0xEC,0x28,0xEC,0x08,0xDC,0xA6,0xD3,0xA6,0xDB,0x28,0xEC,0xE7,0xDB,0xE7,0xDB,
-	0xE7,0xDB,0xA6,0xD3,0xA7,0xD3,0x66,0xCB,0x66,0xCB,0x05,0xB3,0xA4,0xAA,0x05,0xB3,0x05,0xB3,0xC4,0xAA,0x05,0xB3,0x05,0xBB,0x66,0xC3,0x05,0xBB,0x66,0xCB,0xE7,0xDB,0x08,0xDC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x66,0xD3,0x84,0xA2,0xE5,0xAA,0x05,0xB3,0xA5,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,
-	0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xA4,0xA2,0x26,0xBB,0x26,0xBB,0x46,0xC3,0x66,0xCB,0xA7,0xD3,0xE7,0xDB,0xC7,0xD3,0xE5,0xBA,0xC4,0xB2,0x25,0xBB,0x05,0xB3,0xA4,0xAA,0x25,0xBB,0x66,0xCB,0x66,0xC3,0x05,0xB3,0x87,0xC3,0x66,0xC3,0xE5,0xBA,0x05,0xBB,0xA7,0xD3,0xE7,0xDB,0x28,0xEC,0x28,0xEC,0x28,0xEC,0xC7,0xE3,0xE7,0xEB,0x28,0xEC,
-	0x28,0xEC,0xC7,0xE3,0xE7,0xDB,0xA7,0xD3,0xA7,0xD3,0xC7,0xD3,0x28,0xEC,0x49,0xEC,0xE7,0xDB,0xE7,0xDB,0x49,0xEC,0xA7,0xD3,0x66,0xCB,0xA7,0xDB,0x28,0xEC,0x28,0xEC,0x28,0xEC,0xA6,0xDB,0x25,0xC3,0x66,0xCB,0xE7,0xDB,0xA6,0xD3,0xC7,0xD3,0x45,0xCB,0xA7,0xDB,0xE7,0xDB,0xA6,0xDB,0x25,0xC3,0x63,0x9A,0x64,0x9A,0x64,0x92,0x43,0x92,
-	0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x92,0x43,0x92,0x64,0x9A,0x44,0x8A,0x73,0xC5,0xDA,0xFF,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xA8,0xCB,0x66,0xC3,0x66,0xD3,0xA7,0xDB,
-	0x28,0xF4,0xE7,0xEB,0x66,0xEB,0x66,0xEB,0xE7,0xF3,0xA6,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0xA6,0xF3,0xA6,0xF3,0x64,0xF3,0xA6,0xF3,0x28,0xF4,0xE7,0xF3,0x05,0xFC,0xA6,0xF3,0x63,0xF3,0x03,0xDB,0xC2,0xD2,0xC3,0xCA,0x82,0xC2,0xC3,0xCA,0x82,0xCA,0xC2,0xD2,0xC3,0xCA,0x82,0xBA,0x82,0xC2,0xC2,0xD2,0x82,0xC2,0x82,0xBA,0x43,0xB2,
-	0x82,0xBA,0x23,0xE3,0x23,0xEB,0x23,0xEB,0x42,0xF3,0x23,0xEB,0x23,0xE3,0x24,0xEB,0x24,0xEB,0x23,0xE3,0x23,0xE3,0x23,0xEB,0x22,0xEB,0xA2,0xDA,0xE2,0xDA,0xA3,0xDA,0x82,0xC2,0x82,0xC2,0xC3,0xDA,0x43,0xB2,0xE2,0x81,0xC2,0x79,0xC2,0x79,0xC2,0x71,0xC2,0x79,0xC2,0x79,0x23,0x8A,0x23,0x9A,0x44,0xB2,0xA3,0xD2,0xC3,0xCA,0xC3,0xBA,
-	0x23,0x9A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x43,0x92,0x43,0x92,0x23,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x92,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x44,0x9A,0x64,0x9A,0xC4,0xB2,0x05,0xBB,0xC4,0xB2,0xC4,0xB2,
-	0xA7,0xD3,0x28,0xEC,0xA6,0xDB,0x66,0xCB,0x66,0xCB,0xA7,0xD3,0xE7,0xDB,0xA6,0xD3,0xE7,0xDB,0x28,0xEC,0x28,0xEC,0xE7,0xDB,0x08,0xDC,0x49,0xEC,0x28,0xEC,0xE7,0xDB,0xE7,0xDB,0x66,0xCB,0x87,0xCB,0xA7,0xD3,0x66,0xCB,0xC4,0xAA,0xE5,0xAA,0x87,0xCB,0x26,0xBB,0xC5,0xAA,0x05,0xB3,0x66,0xC3,0x05,0xBB,0x64,0x9A,0x66,0xC3,0xE7,0xDB,
-	0x28,0xEC,0x49,0xEC,0x49,0xEC,0x28,0xEC,0x05,0xBB,0xA4,0xAA,0xC5,0xAA,0x84,0xA2,0x64,0x92,0x64,0x9A,0x84,0x9A,0xA5,0x9A,0xA5,0xA2,0x84,0xA2,0x63,0x9A,0x84,0x9A,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0x05,0xB3,0x66,0xC3,0x05,0xBB,0x25,0xC3,0x66,0xCB,0xA7,0xD3,0x28,0xEC,0x08,0xDC,0x26,0xBB,0xC5,0xAA,0x84,0xA2,0xE5,0xB2,0x05,0xB3,
-	0x25,0xBB,0xA8,0xCB,0xA7,0xD3,0xA6,0xD3,0xC7,0xD3,0xA7,0xD3,0x66,0xC3,0xA7,0xD3,0x08,0xDC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x28,0xEC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0x66,0xD3,0xA6,0xD3,0x28,0xEC,0x28,0xEC,0xE7,0xDB,0xA6,0xD3,0xA6,0xD3,0xA6,0xD3,0x46,0xC3,0x66,0xCB,0xE7,0xDB,0x28,0xEC,
-	0x28,0xEC,0xC7,0xD3,0x46,0xC3,0x66,0xCB,0xA6,0xD3,0x45,0xCB,0x25,0xC3,0x46,0xC3,0x87,0xCB,0x66,0xCB,0x05,0xBB,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0xF1,0xAC,
-	0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xCB,0xFC,0x2A,0xEC,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0xC9,0xE3,0x2A,0xEC,0x28,0xF4,0x4A,0xFC,0x4A,0xFC,0xE7,0xEB,0x28,0xF4,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0x64,0xF3,0xA4,0xF3,0x05,0xFC,0xE7,0xF3,0xE7,0xF3,0xE7,0xF3,0x4A,0xFC,0x28,0xF4,0xA6,0xF3,
-	0xC4,0xFB,0xC4,0xFB,0x23,0xE3,0xE2,0xDA,0xC2,0xD2,0xC3,0xBA,0x82,0xBA,0x82,0xBA,0xC2,0xD2,0x82,0xBA,0x43,0xAA,0x82,0xC2,0xC2,0xD2,0xC3,0xCA,0xC2,0xD2,0x82,0xC2,0x82,0xCA,0x03,0xDB,0x23,0xE3,0x22,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xE3,0x23,0xE3,0x23,0xE3,0xE2,0xE2,0xE2,0xDA,0xE2,0xE2,0xA2,0xDA,0xA2,0xD2,0x82,0xC2,0x82,0xC2,
-	0xC3,0xCA,0x24,0xA2,0xA3,0xD2,0x22,0xA2,0xE3,0x81,0x03,0x8A,0x02,0x8A,0xC2,0x79,0xC2,0x71,0xC2,0x61,0xA2,0x61,0xE3,0x79,0x23,0x9A,0x64,0xC2,0xE3,0xD2,0x64,0xC2,0xC3,0xBA,0x24,0xA2,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,
-	0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x92,0x63,0x9A,0xE5,0xB2,0x25,0xBB,0xC4,0xB2,0x83,0xB2,0xC7,0xD3,0xA7,0xD3,0x66,0xC3,0x25,0xC3,0x25,0xC3,0x46,0xC3,0x87,0xCB,0x66,0xCB,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xA6,0xD3,0x66,0xCB,0xA7,0xD3,0x87,0xCB,
-	0xA7,0xD3,0xA6,0xD3,0xA6,0xD3,0xA7,0xD3,0x87,0xCB,0xE5,0xB2,0x05,0xB3,0x66,0xCB,0xC4,0xB2,0x63,0x9A,0x46,0xBB,0x46,0xC3,0xC4,0xB2,0xE5,0xB2,0x87,0xCB,0xA7,0xD3,0x28,0xEC,0x89,0xEC,0x08,0xDC,0xA6,0xD3,0x46,0xBB,0x25,0xBB,0xC5,0xAA,0xC5,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0xA2,0x64,0x9A,
-	0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0x84,0xA2,0xC5,0xAA,0x26,0xBB,0xA8,0xCB,0xE7,0xDB,0x28,0xEC,0x49,0xEC,0xE7,0xDB,0xE5,0xB2,0x64,0x9A,0xE5,0xB2,0x46,0xBB,0x25,0xC3,0x87,0xCB,0x66,0xCB,0x45,0xCB,0x66,0xCB,0x66,0xCB,0xE7,0xDB,0x28,0xEC,0x28,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x28,0xEC,0x08,0xDC,
-	0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA7,0xDB,0x66,0xCB,0x66,0xCB,0x66,0xCB,0x45,0xCB,0xA7,0xD3,0xE7,0xDB,0xE7,0xDB,0xA6,0xDB,0xA6,0xD3,0xE7,0xDB,0xA7,0xD3,0x25,0xC3,0x05,0xBB,0xC5,0xAA,0x05,0xB3,0x05,0xBB,0xA4,0xAA,0x43,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,
-	0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x43,0x92,0x43,0x92,0x84,0x9A,0xA5,0xA2,0xA4,0xA2,0x70,0x94,0xDA,0xFF,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xCB,0xFC,0xAD,0xEC,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0xC9,0xE3,0x2A,0xEC,0x4A,0xFC,0xE7,0xF3,0x4A,0xFC,
-	0x4A,0xFC,0x4A,0xFC,0xCB,0xFC,0x4A,0xFC,0x4A,0xFC,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0xE7,0xF3,0xE7,0xF3,0xE7,0xF3,0xC4,0xFB,0xC4,0xFB,0xA6,0xF3,0x63,0xF3,0x63,0xF3,0x63,0xF3,0x42,0xF3,0xC2,0xD2,0x82,0xC2,0x82,0xC2,0x82,0xC2,0x22,0xA2,0x43,0xAA,0x43,0xB2,0x82,0xC2,0x22,0xEB,0x63,0xEB,0x23,0xEB,
-	0xE2,0xDA,0x03,0xDB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xE3,0xE2,0xE2,0x02,0xE3,0xA2,0xDA,0xE2,0xE2,0xA2,0xDA,0x82,0xCA,0x82,0xCA,0x82,0xBA,0x82,0xC2,0x82,0xC2,0x64,0xBA,0x02,0x8A,0x02,0x8A,0x03,0x82,0xE2,0x81,0xC2,0x79,0xC2,0x69,0xC2,0x69,0xC2,0x61,0xA2,0x61,0xA2,0x61,0x23,0x92,0xA3,0xD2,0xC4,0xDA,
-	0x83,0xB2,0x82,0xBA,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x02,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x92,0x23,0x92,0x23,0x92,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,
-	0x08,0xDC,0x66,0xCB,0x46,0xC3,0x66,0xC3,0x66,0xC3,0x05,0xBB,0x05,0xBB,0x66,0xC3,0x87,0xCB,0x66,0xD3,0x87,0xCB,0xE7,0xDB,0x66,0xCB,0x66,0xC3,0x25,0xBB,0xE5,0xBA,0x66,0xC3,0x87,0xCB,0x46,0xC3,0x66,0xCB,0x66,0xCB,0xE5,0xB2,0xA4,0xAA,0x05,0xB3,0xE5,0xB2,0xA4,0xAA,0x87,0xCB,0x46,0xBB,0xE5,0xAA,0xE5,0xB2,0x46,0xC3,0xC7,0xD3,
-	0x49,0xEC,0x08,0xDC,0xE7,0xEB,0xA6,0xD3,0x87,0xCB,0x66,0xC3,0x05,0xB3,0x05,0xB3,0xA4,0xAA,0xA4,0xA2,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0xA2,0xA4,0xA2,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0xC5,0xAA,0x46,0xC3,0x66,0xC3,0xE7,0xDB,0x49,0xEC,0x89,0xEC,0x49,0xEC,0x66,0xCB,0xC4,0xB2,0x66,0xC3,0x26,0xBB,
-	0x25,0xBB,0x66,0xCB,0x46,0xC3,0x46,0xC3,0x05,0xBB,0x87,0xCB,0xA7,0xD3,0xA6,0xD3,0xA6,0xD3,0xA7,0xDB,0xA6,0xD3,0xE7,0xDB,0x49,0xEC,0x89,0xEC,0x08,0xDC,0x08,0xDC,0x28,0xEC,0xE7,0xDB,0xA6,0xD3,0xA6,0xDB,0x08,0xDC,0x08,0xDC,0xA6,0xD3,0xA7,0xD3,0xA6,0xDB,0x87,0xCB,0x66,0xCB,0x66,0xCB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xA7,0xDB,
-	0x46,0xC3,0xA7,0xD3,0xA6,0xD3,0x25,0xBB,0xE5,0xB2,0xC4,0xB2,0x46,0xBB,0x05,0xB3,0x84,0xA2,0x64,0x92,0x84,0x9A,0xA5,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,0x63,0x9A,0x64,0x9A,0x63,0x9A,0xF1,0xAC,0xDA,0xFF,0xD4,0xF6,
-	0xD4,0xF6,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0x2A,0xEC,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0x2A,0xEC,0x2A,0xEC,0x4A,0xFC,0x28,0xF4,0x28,0xF4,0x28,0xF4,0x28,0xF4,0x4A,0xFC,0x4A,0xFC,0x28,0xF4,0x28,0xF4,0x28,0xF4,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0xE7,0xF3,0xA6,0xF3,0x28,0xF4,0xE7,0xF3,0xE7,0xF3,0xA4,0xF3,0xA6,0xF3,
-	0x05,0xFC,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x42,0xF3,0xE2,0xE2,0x22,0xEB,0x22,0xEB,0x82,0xC2,0x22,0xA2,0x23,0x92,0x43,0xAA,0x82,0xBA,0x23,0xE3,0x23,0xE3,0x85,0xEB,0xE2,0xE2,0xE2,0xE2,0x02,0xE3,0x63,0xEB,0x64,0xF3,0x63,0xEB,0x23,0xEB,0xE2,0xE2,0x22,0xEB,0x42,0xF3,0x22,0xEB,0xC1,0xDA,0x82,0xBA,0x82,0xC2,0xA2,0xDA,0x82,0xCA,
-	0x82,0xCA,0xA3,0xDA,0x82,0xC2,0x03,0x8A,0x03,0x82,0xE2,0x81,0xE3,0x79,0xC2,0x71,0xC2,0x69,0xC2,0x71,0xC2,0x61,0xC2,0x61,0xC2,0x71,0xC2,0x71,0x23,0x9A,0xC3,0xDA,0xC3,0xDA,0x82,0xBA,0x83,0xB2,0x43,0x92,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x64,0x92,0x64,0x9A,0x64,0x92,0x43,0x92,0x44,0x8A,0x23,0x8A,
-	0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x02,0x8A,0x23,0x8A,0x43,0x92,0x63,0x9A,0x63,0x9A,0xA4,0xAA,0xA4,0xAA,0x63,0x9A,0xA7,0xD3,0xA7,0xD3,0x66,0xC3,0x46,0xC3,0x46,0xC3,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x05,0xBB,0x66,0xCB,0xE7,0xDB,0xA7,0xD3,0xA7,0xD3,0x46,0xC3,0x25,0xBB,
-	0x46,0xC3,0x26,0xBB,0x05,0xB3,0xE5,0xB2,0x26,0xBB,0x26,0xBB,0xA4,0xA2,0x46,0xBB,0x66,0xC3,0x87,0xC3,0xC7,0xD3,0x87,0xCB,0x46,0xC3,0x05,0xB3,0x87,0xC3,0x08,0xDC,0x28,0xEC,0xE7,0xDB,0x28,0xEC,0x08,0xDC,0x66,0xCB,0xE5,0xB2,0x46,0xBB,0x87,0xCB,0xE5,0xAA,0xA5,0xA2,0xA4,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x84,0x9A,
-	0xA4,0xA2,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0x9A,0x84,0xA2,0x46,0xBB,0x25,0xBB,0x66,0xCB,0xE7,0xDB,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x49,0xEC,0xE7,0xDB,0x66,0xCB,0x25,0xBB,0xA8,0xCB,0x87,0xCB,0x25,0xC3,0x05,0xBB,0x87,0xCB,0x66,0xC3,0x87,0xCB,0xA7,0xD3,0xA6,0xD3,0x87,0xCB,0xA6,0xDB,0x08,0xDC,0x49,0xEC,0x49,0xEC,0xC7,0xE3,
-	0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0xC7,0xD3,0xA6,0xDB,0x08,0xDC,0xC7,0xD3,0x66,0xD3,0x66,0xCB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x25,0xC3,0x25,0xC3,0xA8,0xCB,0x05,0xBB,0xA4,0xAA,0xE5,0xB2,0x87,0xCB,0xA4,0xA2,0x44,0x8A,0x43,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,0x49,0x93,0xDA,0xFF,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,0x2A,0xEC,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0xC9,0xE3,0x4A,0xFC,0x2A,0xEC,0x45,0xDB,0xA7,0xDB,0x28,0xF4,0xE7,0xF3,
-	0x28,0xF4,0x4A,0xFC,0xCB,0xFC,0x28,0xF4,0xE7,0xF3,0x28,0xF4,0x4A,0xFC,0xE7,0xF3,0x28,0xF4,0xE7,0xF3,0xE7,0xF3,0xE7,0xEB,0x28,0xF4,0x28,0xF4,0x24,0xEB,0xA4,0xF3,0x05,0xFC,0xA4,0xF3,0x23,0xEB,0x03,0xDB,0xE2,0xDA,0xC2,0xD2,0xC1,0xDA,0x82,0xBA,0x82,0xBA,0x43,0xB2,0x22,0xA2,0x23,0x8A,0x23,0x92,0x82,0xBA,0xC3,0xCA,0xA4,0xCA,
-	0x82,0xCA,0xA2,0xDA,0xE2,0xE2,0x23,0xEB,0x64,0xF3,0xA4,0xF3,0xA4,0xF3,0x63,0xF3,0x23,0xEB,0x22,0xEB,0xE2,0xE2,0xE2,0xE2,0x82,0xCA,0x43,0xB2,0xA2,0xDA,0xA2,0xDA,0x82,0xCA,0xC3,0xDA,0xA2,0xDA,0x22,0xA2,0x03,0x8A,0xE2,0x81,0xC2,0x79,0xE3,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x69,0xC2,0x61,0xC2,0x61,0x03,0x8A,0x82,0xBA,0x82,0xBA,
-	0xE4,0xE2,0xE4,0xE2,0xA3,0xD2,0xE3,0xD2,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x43,0x92,0x43,0x92,0x63,0x9A,0x64,0x9A,0x63,0x9A,0x63,0x9A,0x43,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x82,0x03,0x82,0xE3,0x81,0x03,0x82,0x43,0x92,0x84,0xA2,0x64,0x9A,0xA4,0xA2,0xA4,0xAA,0x84,0x9A,
-	0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0xA7,0xD3,0xA6,0xD3,0xA7,0xD3,0x87,0xCB,0x46,0xBB,0x66,0xCB,0xC7,0xD3,0x46,0xC3,0x46,0xC3,0xA7,0xD3,0x87,0xCB,0x46,0xBB,0x25,0xBB,0x26,0xBB,0xA4,0xAA,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x87,0xC3,0x87,0xCB,0xA7,0xD3,0xA6,0xD3,0xA6,0xD3,0x46,0xC3,0x25,0xBB,0xA7,0xD3,0xE7,0xDB,
-	0x08,0xDC,0xA6,0xD3,0xE7,0xDB,0x28,0xEC,0x87,0xCB,0xE5,0xAA,0x25,0xC3,0xE7,0xDB,0x46,0xBB,0xA5,0xA2,0xC5,0xA2,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0x84,0x9A,0x64,0x9A,0xA4,0xA2,0xA5,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0x25,0xBB,0x25,0xC3,0x87,0xCB,0xA7,0xDB,0xA6,0xDB,0x08,0xDC,0x89,0xEC,0x89,0xEC,0x28,0xEC,0x28,0xEC,
-	0xE7,0xDB,0xA6,0xD3,0x87,0xCB,0xA8,0xCB,0xC7,0xD3,0xA7,0xD3,0xA6,0xD3,0xE7,0xDB,0x28,0xEC,0x08,0xDC,0x28,0xEC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0xA6,0xD3,0xA7,0xD3,0xA6,0xD3,0xA6,0xD3,0x08,0xDC,0x49,0xEC,0x08,0xDC,0xA6,0xD3,0xA7,0xD3,0x66,0xD3,
-	0x46,0xC3,0x25,0xC3,0xA8,0xCB,0x66,0xC3,0x25,0xBB,0xE5,0xBA,0x25,0xBB,0x84,0x9A,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x9A,0x64,0x92,0x43,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,0xC7,0x92,0xDA,0xFF,0xD4,0xF6,0xD4,0xF6,0xB0,0xED,
-	0xAD,0xEC,0xAD,0xEC,0x0C,0xE4,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0x2A,0xEC,0x4A,0xFC,0x45,0xDB,0x83,0xB2,0xE7,0xEB,0x28,0xF4,0xE7,0xF3,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0xE7,0xF3,0xC4,0xFB,0xE7,0xF3,0xE7,0xF3,0xE7,0xF3,0xE7,0xF3,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0x85,0xEB,
-	0xC3,0xCA,0x82,0xBA,0x43,0xB2,0x43,0xB2,0x82,0xBA,0x82,0xCA,0x82,0xBA,0x43,0xAA,0x43,0xAA,0x43,0xB2,0x23,0x92,0x23,0x92,0xE2,0x81,0x03,0x82,0x03,0x82,0x03,0x8A,0x43,0xB2,0x82,0xCA,0xA2,0xDA,0xE2,0xE2,0x64,0xF3,0x23,0xEB,0xA4,0xF3,0x63,0xF3,0xE2,0xE2,0x42,0xF3,0xE2,0xE2,0x22,0xEB,0xA2,0xDA,0x82,0xCA,0xA2,0xD2,0xE2,0xE2,
-	0xA2,0xDA,0xA2,0xDA,0xE2,0xE2,0xC3,0xDA,0x82,0xBA,0xE2,0x81,0xE3,0x81,0xE2,0x81,0xC2,0x71,0xC2,0x69,0xC2,0x71,0xC2,0x71,0xC2,0x69,0xC2,0x71,0x82,0xBA,0xA3,0xD2,0x82,0xBA,0xE3,0xD2,0xE3,0xD2,0x23,0xEB,0xC3,0xDA,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x64,0x92,0x84,0xA2,0x64,0x9A,0x43,0x92,0x23,0x92,0x23,0x92,0x63,0x9A,0x43,0x92,
-	0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x84,0xA2,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0x63,0x9A,0x23,0x8A,0xE7,0xDB,0xA6,0xD3,0xC7,0xD3,0xE7,0xDB,0x87,0xCB,0x66,0xCB,0x25,0xC3,0x46,0xC3,0x25,0xBB,0x25,0xC3,0x66,0xCB,0xA7,0xD3,0x46,0xC3,0x26,0xBB,0xA7,0xD3,0xA7,0xD3,
-	0x87,0xCB,0x87,0xCB,0x66,0xC3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xB2,0x87,0xCB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0x66,0xCB,0x87,0xCB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0x66,0xD3,0x87,0xCB,0x08,0xDC,0x28,0xEC,0xC7,0xD3,0x66,0xC3,0x45,0xCB,0x05,0xBB,0xC5,0xAA,0xC4,0xAA,0x05,0xB3,0x46,0xBB,0x66,0xC3,0xE5,0xAA,0x64,0x9A,
-	0x84,0x9A,0xA4,0xA2,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xA8,0xCB,0x66,0xC3,0x46,0xC3,0xC7,0xD3,0x66,0xCB,0x25,0xC3,0xA7,0xDB,0x49,0xEC,0x49,0xEC,0x49,0xEC,0x08,0xDC,0x49,0xEC,0x08,0xDC,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x28,0xEC,0x28,0xEC,0xE7,0xDB,0x28,0xEC,0x08,0xDC,0x28,0xEC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,
-	0xA6,0xD3,0x87,0xCB,0xA7,0xD3,0x66,0xCB,0xC7,0xD3,0xE7,0xDB,0xC7,0xD3,0x66,0xD3,0x87,0xCB,0x66,0xCB,0xE7,0xDB,0x49,0xEC,0x08,0xDC,0xA6,0xD3,0x66,0xD3,0x45,0xCB,0xA7,0xD3,0xA6,0xD3,0xA6,0xD3,0x66,0xC3,0xC7,0xD3,0x87,0xCB,0xC4,0xB2,0x84,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x43,0x92,0x64,0x92,0x64,0x9A,
-	0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0xD4,0xF6,0xD4,0xF6,0xD4,0xF6,0xAD,0xEC,0xB0,0xED,0x0C,0xE4,0x0C,0xE4,0x0C,0xE4,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0x4A,0xFC,0xAD,0xEC,0x4A,0xFC,0x4A,0xFC,0x28,0xEC,0xE7,0xF3,0x66,0xEB,0x45,0xDB,0x44,0xE3,
-	0x24,0xEB,0x44,0xE3,0x03,0xDB,0xE7,0xF3,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0xA4,0xF3,0xE7,0xF3,0xA4,0xF3,0x64,0xF3,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0x05,0xFC,0xA1,0xD2,0x43,0xAA,0x22,0xA2,0x43,0xAA,0x43,0xB2,0x82,0xBA,0x43,0xB2,0x43,0xAA,0x22,0xA2,0x43,0xAA,0x82,0xBA,0x22,0xA2,0x23,0x92,0x03,0x8A,0xE3,0x79,0xE3,0x81,0xC2,0x79,
-	0xC2,0x79,0xE3,0x81,0x23,0x9A,0xA2,0xD2,0xE2,0xE2,0x85,0xEB,0xE2,0xE2,0xE2,0xE2,0xA2,0xDA,0xA2,0xD2,0xA2,0xD2,0x22,0xEB,0x64,0xF3,0xA1,0xD2,0xA2,0xDA,0xE2,0xE2,0xE2,0xE2,0x23,0xEB,0x22,0xEB,0x23,0xEB,0xC3,0xDA,0x82,0xCA,0x23,0x92,0xC2,0x79,0xC2,0x71,0xC2,0x71,0xE3,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x69,0x02,0x8A,0xE4,0xE2,
-	0xE3,0xD2,0xA3,0xDA,0xE2,0xE2,0x23,0xEB,0x23,0xEB,0xC3,0xDA,0x23,0x8A,0x44,0x8A,0x43,0x92,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x43,0x92,0x23,0x92,0x43,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x64,0x9A,0x64,0x9A,0xA4,0xAA,0x84,0xA2,0x84,0xA2,0xA4,0xAA,0xC5,0xAA,0x84,0xA2,0xA4,0xAA,0x84,0xA2,0x23,0x8A,0x03,0x82,
-	0xC7,0xD3,0x87,0xCB,0x87,0xCB,0x45,0xCB,0x25,0xBB,0x05,0xBB,0x66,0xC3,0x25,0xBB,0x25,0xBB,0x87,0xC3,0x87,0xCB,0xA7,0xD3,0x46,0xC3,0xE5,0xB2,0xC4,0xB2,0x87,0xCB,0xA6,0xD3,0xA7,0xD3,0x25,0xC3,0x26,0xBB,0x25,0xBB,0xA4,0xAA,0xE5,0xB2,0xC7,0xD3,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,
-	0x87,0xCB,0x66,0xCB,0xA6,0xD3,0xE7,0xDB,0x28,0xEC,0x49,0xEC,0x08,0xDC,0xA7,0xD3,0x26,0xBB,0x05,0xB3,0xC4,0xAA,0xA4,0xAA,0x25,0xBB,0x25,0xC3,0xC4,0xAA,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x06,0xB3,0x66,0xC3,0x05,0xB3,0x66,0xC3,0x25,0xC3,0x46,0xC3,0x25,0xC3,0xE5,0xBA,0x25,0xBB,0x87,0xCB,0xA7,0xD3,0xC7,0xD3,0x49,0xEC,0x49,0xEC,
-	0x08,0xDC,0x49,0xEC,0x28,0xEC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x28,0xEC,0xE7,0xDB,0xA7,0xDB,0xE7,0xDB,0xA7,0xD3,0xA6,0xD3,0xA6,0xD3,0xA7,0xD3,0xA7,0xD3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xA7,0xD3,0x45,0xCB,0xA6,0xD3,0xC7,0xE3,0x28,0xEC,0xA7,0xD3,0x87,0xCB,0xA6,0xD3,
-	0xC7,0xD3,0xA6,0xD3,0xE7,0xDB,0x87,0xCB,0xC7,0xD3,0x46,0xC3,0x84,0xA2,0xA4,0xA2,0x84,0x9A,0x23,0x8A,0x43,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x73,0xC5,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xAD,0xEC,
-	0xAD,0xEC,0x0C,0xE4,0x0C,0xE4,0xC9,0xE3,0x0C,0xE4,0xC9,0xE3,0xC9,0xE3,0x4A,0xFC,0xC9,0xE3,0xC7,0xE3,0xA6,0xF3,0x66,0xEB,0xA6,0xF3,0x04,0xDB,0x04,0xDB,0x03,0xDB,0x23,0xE3,0x23,0xE3,0x03,0xDB,0x03,0xDB,0x44,0xE3,0xA6,0xF3,0x63,0xF3,0x64,0xF3,0xE7,0xF3,0xA6,0xF3,0x63,0xEB,0x28,0xF4,0xE7,0xF3,0x05,0xFC,0x64,0xF3,0x82,0xBA,
-	0x43,0xB2,0x82,0xBA,0x82,0xBA,0x82,0xBA,0x43,0xB2,0x43,0xB2,0x22,0xA2,0x23,0x92,0x22,0xA2,0x43,0xB2,0x43,0xB2,0x23,0x92,0x23,0x92,0xE2,0x81,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xE2,0x81,0x43,0xB2,0x82,0xCA,0x82,0xCA,0xA3,0xD2,0xA2,0xD2,0xA3,0xD2,0xA1,0xD2,0x43,0xAA,0x22,0xA2,0x82,0xC2,0x42,0xF3,0xE2,0xE2,0xE2,0xE2,0x23,0xEB,
-	0x42,0xF3,0x64,0xF3,0xA4,0xF3,0xA6,0xF3,0xA4,0xF3,0xA2,0xDA,0x82,0xBA,0xE2,0x81,0xE3,0x79,0xC2,0x71,0xC2,0x79,0xE3,0x79,0xC2,0x79,0xE3,0x79,0x02,0x8A,0xC2,0xD2,0xA3,0xDA,0xE2,0xE2,0xE3,0xD2,0xA3,0xD2,0x23,0xEB,0x23,0xEB,0xC3,0xDA,0x23,0x92,0x23,0x92,0x43,0x92,0x64,0x9A,0x64,0x9A,0x43,0x92,0x64,0x9A,0x64,0x92,0x03,0x8A,
-	0x23,0x8A,0x23,0x8A,0x23,0x92,0x84,0x9A,0x63,0x9A,0x64,0x9A,0xA4,0xA2,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x84,0xA2,0xA4,0xAA,0xA4,0xAA,0x63,0x9A,0x03,0x8A,0x23,0x8A,0x66,0xCB,0x66,0xCB,0x87,0xCB,0x46,0xC3,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x26,0xBB,0x66,0xC3,0x46,0xC3,0x87,0xCB,0xC7,0xD3,0x66,0xCB,0x05,0xBB,0x26,0xBB,0xA7,0xD3,
-	0xA7,0xD3,0xA6,0xD3,0x25,0xC3,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x66,0xC3,0x87,0xCB,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0x28,0xEC,0x08,0xDC,0xE7,0xDB,0xA7,0xD3,0x66,0xCB,0x66,0xCB,0x87,0xCB,0xC7,0xD3,0x87,0xCB,0xA6,0xD3,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0x46,0xC3,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0xC5,0xAA,0x05,0xB3,0xA4,0xA2,0x64,0x9A,
-	0x84,0xA2,0x84,0x9A,0x46,0xBB,0xA7,0xD3,0x25,0xBB,0x25,0xBB,0x05,0xBB,0x66,0xC3,0x87,0xCB,0x66,0xC3,0x87,0xC3,0x46,0xBB,0x25,0xBB,0xA6,0xD3,0x08,0xDC,0x49,0xEC,0x49,0xEC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0x28,0xEC,0xE7,0xDB,0x66,0xD3,0x66,0xCB,0x66,0xD3,0xC7,0xD3,0xE7,0xDB,
-	0xA6,0xD3,0xA6,0xD3,0xE7,0xDB,0xA7,0xD3,0x66,0xD3,0xE7,0xDB,0x28,0xEC,0x49,0xEC,0x08,0xDC,0xA6,0xDB,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0x66,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x87,0xCB,0x45,0xCB,0x25,0xBB,0x84,0xA2,0xC5,0xAA,0x26,0xBB,0x84,0xA2,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,
-	0x43,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0xED,0x93,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0x0C,0xE4,0x0C,0xE4,0x0C,0xE4,0x0C,0xE4,0x0C,0xE4,0x2A,0xEC,0xC9,0xE3,0x2A,0xEC,0xA7,0xDB,0xA5,0xC2,0x66,0xEB,0x66,0xEB,0xE7,0xEB,0x44,0xE3,0x66,0xEB,0x44,0xE3,0x03,0xDB,
-	0xE3,0xD2,0x03,0xDB,0x03,0xDB,0x03,0xDB,0x02,0xE3,0x22,0xEB,0x42,0xF3,0x63,0xEB,0x63,0xEB,0x63,0xEB,0xA4,0xF3,0xE7,0xF3,0x66,0xFC,0x28,0xF4,0x44,0xE3,0x43,0xB2,0x43,0xB2,0x82,0xCA,0x43,0xB2,0x43,0xB2,0x43,0xAA,0x22,0xA2,0x23,0x92,0x23,0x92,0x23,0x92,0x43,0xAA,0x43,0xAA,0x22,0xA2,0x03,0x8A,0xE2,0x81,0x03,0x8A,0x03,0x82,
-	0xE3,0x79,0xC2,0x79,0x23,0x92,0x43,0xB2,0x82,0xC2,0x82,0xCA,0xA3,0xDA,0xA2,0xD2,0xA2,0xD2,0x82,0xC2,0x22,0xA2,0x82,0xBA,0x82,0xCA,0x43,0xAA,0x43,0xAA,0xA2,0xDA,0xE2,0xE2,0x23,0xE3,0x64,0xF3,0xA6,0xF3,0xA4,0xF3,0x23,0xE3,0xC2,0xD2,0x43,0xB2,0x02,0x8A,0x03,0x82,0xC2,0x79,0xE3,0x79,0xE2,0x81,0xE3,0x79,0x22,0xA2,0xA3,0xDA,
-	0xC2,0xD2,0xE2,0xE2,0x43,0xB2,0xC3,0xCA,0xC3,0xDA,0x23,0xEB,0x63,0xF3,0xC3,0xCA,0x23,0x8A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x43,0x92,0x64,0x9A,0x64,0x92,0x23,0x92,0x43,0x92,0x23,0x92,0x43,0x92,0x64,0x9A,0x23,0x92,0x23,0x92,0x84,0xA2,0x84,0xA2,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0x64,0x9A,0x64,0x9A,0x43,0x92,0x23,0x8A,0x03,0x8A,
-	0x87,0xCB,0x66,0xCB,0x87,0xCB,0xA7,0xD3,0x66,0xC3,0x46,0xBB,0x26,0xBB,0x05,0xBB,0x25,0xBB,0x05,0xBB,0x05,0xBB,0x87,0xCB,0xA7,0xD3,0x66,0xC3,0xA6,0xD3,0xC7,0xD3,0x08,0xDC,0xA7,0xD3,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x87,0xCB,0x66,0xCB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0x66,0xC3,
-	0x46,0xC3,0x87,0xCB,0xA7,0xD3,0x87,0xC3,0x25,0xC3,0xC7,0xD3,0x08,0xDC,0xA6,0xDB,0x66,0xC3,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x63,0x9A,0xC5,0xA2,0x66,0xCB,0xA7,0xD3,0x66,0xCB,0xC7,0xD3,0xC7,0xD3,0x46,0xC3,0xA7,0xD3,0x08,0xDC,0xE7,0xDB,0x87,0xCB,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0x49,0xEC,
-	0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0x66,0xCB,0x66,0xCB,0xA6,0xD3,0xA7,0xD3,0xC7,0xD3,0xA7,0xD3,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0x66,0xD3,0xA6,0xD3,0xC7,0xE3,0x49,0xEC,0x08,0xDC,0xE7,0xDB,0x66,0xD3,0xA6,0xD3,0x08,0xDC,0xE7,0xDB,0x66,0xCB,0x45,0xCB,
-	0xA6,0xDB,0xE7,0xDB,0x08,0xDC,0x46,0xC3,0x05,0xBB,0xC4,0xB2,0x64,0x9A,0xC5,0xAA,0x46,0xBB,0x05,0xB3,0x64,0x9A,0x44,0x8A,0x43,0x92,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x92,0x65,0x8A,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0x0C,0xE4,0xA8,0xCB,
-	0xA8,0xCB,0xAD,0xEC,0xAD,0xEC,0x0C,0xE4,0x2A,0xEC,0x2A,0xEC,0xE7,0xEB,0x45,0xDB,0x04,0xDB,0x04,0xDB,0xA6,0xDB,0xA6,0xF3,0x04,0xDB,0x44,0xE3,0xE3,0xD2,0xE3,0xD2,0xE3,0xD2,0xC2,0xD2,0x23,0xE3,0x23,0xE3,0x85,0xEB,0x22,0xEB,0x42,0xF3,0x63,0xEB,0x02,0xE3,0x63,0xEB,0xA6,0xF3,0x85,0xEB,0xE7,0xF3,0x28,0xF4,0xE7,0xEB,0x82,0xBA,
-	0x43,0xAA,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x43,0xAA,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x23,0x92,0x22,0xA2,0x22,0xA2,0x43,0xB2,0x23,0x92,0x02,0x8A,0x03,0x8A,0x23,0x92,0x02,0x8A,0xC3,0x71,0xC3,0x71,0x03,0x8A,0x82,0xBA,0xA4,0xCA,0x82,0xCA,0xA2,0xD2,0x82,0xCA,0x82,0xCA,0x82,0xBA,0x22,0xA2,0x02,0x8A,0x02,0x8A,0x22,0xA2,0xA1,0xD2,
-	0xA1,0xD2,0xA2,0xDA,0xA2,0xDA,0xA2,0xD2,0x64,0xF3,0xA4,0xF3,0xA4,0xF3,0x64,0xF3,0xA2,0xD2,0x82,0xBA,0x22,0xA2,0xE2,0x81,0xC2,0x79,0x43,0xB2,0xA3,0xDA,0xE2,0xDA,0xC2,0xD2,0xE2,0xE2,0xC3,0xCA,0x43,0xAA,0x82,0xBA,0xE3,0xD2,0x63,0xF3,0xC4,0xFB,0x23,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x43,0x92,0x23,0x92,0x64,0x92,0x43,0x92,
-	0x23,0x92,0x43,0x92,0x23,0x92,0x23,0x92,0x23,0x8A,0x43,0x92,0x64,0x9A,0x84,0xA2,0xC4,0xAA,0xE5,0xB2,0xA4,0xA2,0x23,0x8A,0x23,0x8A,0x23,0x92,0x03,0x8A,0x02,0x8A,0x87,0xCB,0x66,0xC3,0x66,0xCB,0x87,0xCB,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x05,0xB3,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x87,0xCB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,
-	0x08,0xDC,0x08,0xDC,0x87,0xCB,0x25,0xBB,0x66,0xC3,0x66,0xC3,0x46,0xC3,0xA7,0xD3,0xC7,0xE3,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0x46,0xC3,0xE5,0xB2,0xC5,0xAA,0xA4,0xAA,0xE5,0xB2,0x66,0xC3,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0x05,0xBB,0xC5,0xAA,0xA4,0xAA,0xC4,0xAA,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0xA2,
-	0xA4,0xA2,0x46,0xBB,0x87,0xCB,0x46,0xC3,0x66,0xCB,0x87,0xCB,0xC7,0xD3,0x66,0xCB,0x87,0xCB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x49,0xEC,0x08,0xDC,0xE7,0xDB,0xC7,0xE3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xA7,0xD3,0xA6,0xD3,0x87,0xCB,0xA7,0xD3,0x66,0xCB,0x66,0xD3,
-	0xA7,0xD3,0xC7,0xD3,0xA6,0xDB,0xA7,0xD3,0xE7,0xDB,0xC7,0xD3,0xA7,0xDB,0xE7,0xDB,0x49,0xEC,0xE7,0xDB,0xA6,0xD3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0x66,0xCB,0x66,0xCB,0x08,0xDC,0x08,0xDC,0xA6,0xD3,0x46,0xC3,0x26,0xBB,0xE5,0xB2,0x84,0xA2,0x84,0xA2,0xC5,0xAA,0x25,0xBB,0xA4,0xA2,0x44,0x8A,0x44,0x8A,0x43,0x92,0x43,0x92,0x64,0x92,
-	0x64,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x84,0x9A,0xA5,0x9A,0x73,0xC5,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0xC9,0xE3,0xA8,0xCB,0x0C,0xE4,0x0C,0xE4,0xAD,0xEC,0x0C,0xE4,0x2A,0xEC,0x2A,0xEC,0xE7,0xEB,0xC7,0xE3,0xE7,0xEB,0x04,0xDB,0xE3,0xD2,0x44,0xE3,0x23,0xE3,0x03,0xDB,0xE3,0xD2,0x04,0xDB,0xC3,0xCA,
-	0xC2,0xD2,0xC2,0xD2,0x03,0xDB,0x22,0xEB,0x42,0xF3,0x63,0xF3,0x42,0xF3,0x63,0xEB,0xC2,0xD2,0x23,0xE3,0x02,0xE3,0x02,0xE3,0x44,0xE3,0x85,0xEB,0xA6,0xDB,0x82,0xCA,0x43,0xB2,0x23,0x92,0x02,0x8A,0x43,0xAA,0x43,0xAA,0x22,0xA2,0x22,0xA2,0x43,0xAA,0x23,0x92,0x43,0xB2,0x22,0xA2,0x22,0xA2,0x23,0x92,0x02,0x8A,0x02,0x8A,0x03,0x8A,
-	0x23,0x92,0x02,0x8A,0xC2,0x79,0xE3,0x81,0xE2,0x81,0x43,0xAA,0xE3,0xD2,0xC3,0xDA,0x82,0xC2,0x22,0xA2,0x23,0x92,0x43,0xAA,0xE2,0x81,0xC2,0x69,0x23,0x92,0xA2,0xD2,0xA2,0xDA,0xA2,0xDA,0xA2,0xDA,0xA2,0xDA,0xA2,0xDA,0x64,0xF3,0xA4,0xF3,0x63,0xF3,0x64,0xF3,0xE2,0xE2,0xC3,0xDA,0xE3,0xD2,0xC3,0xCA,0xE3,0xD2,0x03,0xDB,0x23,0xE3,
-	0x82,0xBA,0x82,0xBA,0xE3,0xD2,0x23,0x92,0x82,0xBA,0xE3,0xD2,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x64,0x9A,0x63,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x23,0x92,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x43,0x92,0x64,0x92,0x84,0xA2,0x84,0xA2,0xA4,0xAA,0xA4,0xAA,0x43,0x92,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x82,
-	0xA7,0xD3,0x87,0xCB,0xA7,0xD3,0x66,0xCB,0x25,0xC3,0x05,0xB3,0xE5,0xB2,0x26,0xBB,0x46,0xC3,0x46,0xC3,0x87,0xCB,0xA7,0xD3,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x66,0xCB,0xE5,0xBA,0x25,0xBB,0x46,0xBB,0x26,0xBB,0xC7,0xD3,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0x87,0xCB,0x46,0xC3,
-	0xC4,0xAA,0x64,0x9A,0x84,0x9A,0xC4,0xA2,0x05,0xB3,0xE5,0xB2,0x05,0xBB,0x46,0xBB,0xC5,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0x64,0x9A,0x84,0xA2,0xE5,0xAA,0xC5,0xAA,0x87,0xC3,0xA7,0xD3,0x87,0xCB,0x66,0xC3,0x05,0xB3,0xE5,0xBA,0x25,0xBB,0x66,0xC3,0xE7,0xDB,0x28,0xEC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,
-	0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xC7,0xE3,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xC7,0xD3,0x87,0xCB,0xA7,0xD3,0xA7,0xD3,0xA6,0xD3,0xC7,0xD3,0xA6,0xD3,0xA6,0xD3,0xA7,0xD3,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xA6,0xD3,0xA6,0xD3,
-	0xE7,0xDB,0xA7,0xDB,0x66,0xD3,0x46,0xC3,0xC4,0xB2,0xE5,0xBA,0x87,0xC3,0xE5,0xB2,0x64,0x9A,0xC5,0xAA,0x46,0xBB,0x43,0x92,0x23,0x8A,0x23,0x8A,0x44,0x8A,0xA5,0x9A,0xA5,0x9A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x43,0x92,0x23,0x8A,0x64,0x9A,0x49,0x93,0xD4,0xF6,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0x0C,0xE4,0x69,0xB3,0x0C,0xE4,0x0C,0xE4,
-	0xAD,0xEC,0x0C,0xE4,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0x66,0xEB,0x66,0xEB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x04,0xDB,0xE3,0xD2,0x03,0xDB,0x04,0xDB,0xC2,0xD2,0xC2,0xD2,0xC2,0xD2,0xC2,0xD2,0x02,0xE3,0x42,0xF3,0x63,0xF3,0x63,0xF3,0x22,0xEB,0x02,0xE3,0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0xA2,0xDA,0xC2,0xD2,0x85,0xEB,0x44,0xE3,0x82,0xC2,
-	0x82,0xBA,0x43,0xAA,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x23,0x92,0x22,0xA2,0x43,0xB2,0x22,0xA2,0x22,0xA2,0x43,0xAA,0x22,0xA2,0x22,0xA2,0x03,0x8A,0xE2,0x81,0x02,0x8A,0x03,0x8A,0x23,0x92,0x02,0x8A,0xE2,0x81,0xC2,0x71,0x63,0x9A,0xC3,0xCA,0xA2,0xDA,0x82,0xCA,0x82,0xBA,0x23,0x92,0x22,0xA2,0x23,0x92,0xC2,0x79,0xC2,0x71,0xE2,0x81,
-	0x82,0xC2,0xA2,0xDA,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0x23,0xEB,0x64,0xF3,0x23,0xEB,0x24,0xEB,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,0xC3,0xDA,0xC3,0xDA,0xE2,0xE2,0x03,0xDB,0xC3,0xDA,0x43,0xB2,0xC3,0xBA,0x03,0xDB,0x64,0xF3,0x64,0xF3,0x63,0xF3,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0xC4,0xAA,0x84,0xA2,0x64,0x9A,
-	0x64,0x92,0x23,0x92,0x23,0x92,0x43,0x92,0x43,0x92,0x23,0x92,0x44,0x9A,0x84,0xA2,0xA4,0xA2,0x64,0x9A,0x03,0x8A,0x03,0x8A,0xE2,0x81,0x03,0x8A,0x03,0x82,0x03,0x8A,0xC7,0xD3,0xA7,0xD3,0xA7,0xD3,0x87,0xCB,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x87,0xC3,0x25,0xC3,0x26,0xBB,0x66,0xC3,0x87,0xCB,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,
-	0xE7,0xDB,0xA7,0xDB,0x46,0xC3,0x06,0xB3,0xC4,0xB2,0x84,0xA2,0x46,0xBB,0x08,0xDC,0x08,0xDC,0xA6,0xD3,0xA7,0xD3,0xA6,0xD3,0xA6,0xD3,0xA6,0xD3,0x66,0xCB,0xE5,0xB2,0x64,0x9A,0xA5,0xA2,0xA4,0xA2,0x64,0x9A,0x43,0x92,0x43,0x92,0xA5,0xA2,0x05,0xB3,0xA4,0xA2,0x43,0x92,0x64,0x9A,0xC5,0xA2,0xA4,0xA2,0xA5,0xA2,0x46,0xBB,0xA8,0xCB,
-	0x05,0xB3,0x05,0xBB,0xC7,0xD3,0xE7,0xDB,0xA8,0xCB,0x66,0xC3,0x25,0xBB,0x05,0xB3,0x25,0xC3,0xC7,0xD3,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0x66,0xCB,0x66,0xD3,0xA7,0xD3,0xA6,0xD3,0xA6,0xD3,
-	0xC7,0xD3,0xA7,0xD3,0xA7,0xD3,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xA7,0xDB,0xC7,0xD3,0xA7,0xD3,0xA6,0xD3,0x66,0xC3,0x05,0xB3,0x25,0xC3,0x05,0xB3,0x43,0x92,0x23,0x8A,0x46,0xBB,0xA4,0xA2,0x44,0x8A,0x64,0x92,0x64,0x92,0x84,0x9A,
-	0x84,0xA2,0xA4,0xA2,0x44,0x8A,0x23,0x8A,0x43,0x92,0x43,0x92,0x64,0x92,0xB0,0xED,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0x0C,0xE4,0xC9,0xE3,0x0C,0xE4,0x0C,0xE4,0xAD,0xEC,0x0C,0xE4,0x2A,0xEC,0x2A,0xEC,0x2A,0xEC,0xE7,0xEB,0x44,0xE3,0x04,0xCB,0xE3,0xD2,0x04,0xDB,0x23,0xE3,0xE3,0xD2,0xC3,0xCA,0x03,0xDB,0xC3,0xCA,0xC2,0xD2,0xC2,0xD2,
-	0xC2,0xD2,0x02,0xE3,0x02,0xE3,0x42,0xF3,0x63,0xF3,0x22,0xEB,0xE2,0xE2,0x63,0xF3,0xA4,0xF3,0x02,0xE3,0xA1,0xD2,0xA2,0xDA,0xE2,0xE2,0x44,0xE3,0xE3,0xD2,0x82,0xBA,0x82,0xC2,0x82,0xBA,0x43,0xAA,0x43,0xB2,0x22,0xA2,0x23,0x92,0x23,0x92,0x43,0xB2,0x22,0xA2,0x22,0xA2,0x43,0xB2,0x22,0xA2,0x22,0xA2,0x03,0x8A,0xE2,0x81,0xE2,0x81,
-	0x03,0x8A,0x03,0x8A,0x03,0x8A,0xE3,0x79,0x03,0x8A,0x43,0xAA,0x43,0xB2,0x82,0xBA,0x82,0xC2,0x82,0xBA,0x43,0xB2,0x22,0xA2,0x02,0x8A,0xE2,0x81,0xE2,0x81,0xC2,0x61,0x02,0x8A,0x82,0xBA,0xA2,0xD2,0x82,0xBA,0x82,0xC2,0xA2,0xD2,0x82,0xCA,0xE2,0xE2,0xA4,0xF3,0x64,0xF3,0x24,0xEB,0x24,0xEB,0x24,0xEB,0x23,0xE3,0xE2,0xE2,0x23,0xEB,
-	0x23,0xEB,0x64,0xF3,0x23,0xEB,0x03,0xDB,0x82,0xC2,0x23,0xE3,0x24,0xEB,0xC3,0xDA,0x23,0xEB,0x23,0xEB,0x44,0x9A,0x84,0xA2,0xA4,0xAA,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x43,0x92,0x43,0x92,0x64,0x9A,0x84,0x9A,0x43,0x92,0x43,0x92,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x23,0x92,0x03,0x82,0xE2,0x81,0x23,0x8A,0x23,0x8A,0x03,0x8A,
-	0xA7,0xD3,0xA6,0xD3,0x66,0xCB,0x25,0xBB,0x46,0xC3,0x87,0xC3,0x66,0xC3,0x66,0xC3,0x05,0xB3,0x25,0xBB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0xE7,0xDB,0xA7,0xD3,0xA6,0xD3,0xA7,0xD3,0xA6,0xD3,0x05,0xB3,0xE5,0xAA,0xE5,0xB2,0xA4,0xAA,0x66,0xC3,0x08,0xDC,0x08,0xDC,0xC7,0xD3,0xA6,0xD3,0xC7,0xD3,0x08,0xDC,0xC7,0xD3,0x66,0xC3,0xC5,0xAA,
-	0x43,0x92,0xA4,0xA2,0xE5,0xAA,0x84,0x9A,0x44,0x8A,0x44,0x8A,0x84,0x9A,0x05,0xB3,0xA4,0xA2,0x64,0x92,0x84,0x9A,0xE5,0xAA,0xC4,0xAA,0xC5,0xAA,0x26,0xBB,0x66,0xC3,0x66,0xC3,0x05,0xB3,0x25,0xBB,0xC7,0xD3,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,
-	0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0xA7,0xD3,0xA6,0xD3,0x66,0xCB,0x87,0xCB,0xC7,0xD3,0x46,0xC3,0x05,0xBB,0x66,0xCB,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0x08,0xDC,0x08,0xDC,
-	0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x66,0xCB,0x05,0xB3,0xE5,0xB2,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0xA4,0xA2,0x05,0xB3,0xE5,0xAA,0xC5,0xAA,0x84,0xA2,0x23,0x92,0x23,0x8A,0xA4,0xAA,0x05,0xB3,0x43,0x92,0x43,0x92,0x43,0x92,0x4D,0xD5,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0x0C,0xE4,0x0C,0xE4,0xAD,0xEC,0x0C,0xE4,0xAD,0xEC,0xAD,0xEC,
-	0xAD,0xEC,0x2A,0xEC,0x28,0xF4,0x4A,0xFC,0x66,0xEB,0xE5,0xB2,0xC4,0xAA,0xE5,0xBA,0xC3,0xCA,0xE3,0xD2,0xC3,0xCA,0xE3,0xD2,0x03,0xDB,0xE2,0xDA,0xC3,0xCA,0xC3,0xCA,0xE2,0xDA,0x02,0xE3,0x02,0xE3,0xE2,0xDA,0x02,0xE3,0x42,0xF3,0x22,0xEB,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0xE2,0xDA,0xE2,0xE2,0xE2,0xE2,0xA2,0xDA,0x82,0xCA,0x82,0xC2,
-	0x82,0xBA,0x82,0xCA,0x82,0xC2,0x82,0xBA,0x22,0xA2,0x22,0xA2,0x23,0x92,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x43,0xB2,0x43,0xB2,0x23,0x92,0x02,0x8A,0x03,0x8A,0x02,0x8A,0x02,0x8A,0x23,0x92,0x23,0x92,0xE3,0x79,0xC2,0x79,0x03,0x8A,0x02,0x8A,0x03,0x8A,0x22,0xA2,0x23,0x92,0x43,0xB2,0x22,0xA2,0x02,0x8A,0xE3,0x81,0xE3,0x81,0xC3,0x69,
-	0xC2,0x61,0xC3,0x69,0xE3,0x81,0xC3,0x71,0xC2,0x69,0x03,0x8A,0x82,0xC2,0xA2,0xD2,0x23,0xE3,0x24,0xEB,0x23,0xE3,0x23,0xEB,0x24,0xEB,0x24,0xEB,0x64,0xF3,0x23,0xEB,0x23,0xEB,0x03,0xDB,0x23,0xE3,0x64,0xF3,0xE3,0xD2,0xC3,0xDA,0x23,0xE3,0xC3,0xCA,0xE3,0xD2,0x64,0xF3,0xC3,0xCA,0x64,0x9A,0x64,0x9A,0x23,0x92,0x43,0x92,0x43,0x92,
-	0x43,0x92,0x23,0x92,0x23,0x92,0x23,0x92,0x43,0x92,0x23,0x92,0x23,0x92,0x64,0x9A,0x63,0x9A,0x63,0x9A,0x64,0x9A,0x23,0x92,0x03,0x82,0x03,0x82,0x03,0x8A,0x03,0x8A,0xA6,0xD3,0x87,0xCB,0x66,0xCB,0x25,0xBB,0x46,0xBB,0x46,0xC3,0x25,0xBB,0x25,0xBB,0xE5,0xB2,0xE5,0xB2,0x46,0xC3,0x46,0xBB,0x87,0xCB,0xE7,0xDB,0xE7,0xDB,0x87,0xCB,
-	0x46,0xC3,0x46,0xC3,0x25,0xBB,0x46,0xBB,0x25,0xBB,0xE5,0xAA,0x66,0xCB,0x08,0xDC,0x08,0xDC,0xA7,0xD3,0xA7,0xD3,0xA7,0xD3,0x28,0xEC,0xE7,0xDB,0x66,0xC3,0xE5,0xB2,0x63,0x9A,0x64,0x9A,0x26,0xBB,0x05,0xB3,0x64,0x92,0x44,0x8A,0x84,0x9A,0xC5,0xAA,0x84,0xA2,0xA4,0xAA,0x05,0xB3,0xE5,0xB2,0xC4,0xAA,0xE5,0xB2,0xA4,0xAA,0xC4,0xB2,
-	0x87,0xCB,0x46,0xC3,0x46,0xC3,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x49,0xEC,0x08,0xDC,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0x66,0xCB,0x46,0xC3,0x46,0xC3,0x66,0xCB,0xA7,0xD3,0x66,0xCB,0x05,0xBB,
-	0x46,0xC3,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA6,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA6,0xDB,0xE7,0xDB,0xE7,0xDB,0x87,0xCB,0x25,0xBB,0x66,0xCB,0x66,0xC3,0x25,0xBB,0xC4,0xA2,0x23,0x92,0x64,0x9A,0xA4,0xAA,0x25,0xBB,0x26,0xBB,0x64,0x9A,
-	0x84,0x9A,0x46,0xBB,0xA7,0xD3,0xC5,0xAA,0x43,0x92,0x05,0x92,0xB0,0xED,0xB0,0xED,0xAD,0xEC,0x0C,0xE4,0xA8,0xCB,0x0C,0xE4,0x0C,0xE4,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x2A,0xEC,0xC7,0xE3,0x45,0xDB,0x66,0xEB,0x25,0xC3,0xA4,0xAA,0xA4,0xAA,0xC4,0xAA,0xC4,0xB2,0xC3,0xBA,0xE3,0xD2,0xC3,0xCA,0xC2,0xD2,0x02,0xE3,0xC2,0xD2,0xC2,0xD2,
-	0xC2,0xD2,0xC2,0xD2,0x02,0xE3,0x23,0xE3,0xE2,0xDA,0x22,0xEB,0x23,0xEB,0x22,0xEB,0x42,0xF3,0x42,0xF3,0x63,0xF3,0x63,0xEB,0xE2,0xE2,0xA2,0xD2,0x82,0xCA,0x82,0xBA,0x43,0xB2,0x43,0xB2,0x43,0xB2,0x43,0xAA,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x23,0x92,0x43,0xB2,0x82,0xBA,0x22,0xA2,0x23,0x92,0x23,0x92,0x23,0x92,
-	0x03,0x8A,0x22,0xA2,0x02,0x8A,0x03,0x82,0x02,0x8A,0x02,0x8A,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xE2,0x81,0xE2,0x81,0xE2,0x81,0x03,0x82,0xC2,0x79,0xE2,0x81,0xC2,0x79,0xC3,0x69,0xC2,0x61,0x02,0x8A,0xC2,0x79,0x23,0x9A,0x82,0xC2,0x82,0xCA,0x82,0xBA,0x43,0xAA,0x43,0xB2,0x82,0xC2,0xE3,0xD2,0xE2,0xE2,0x23,0xEB,0x23,0xEB,0x23,0xEB,
-	0x23,0xEB,0x23,0xEB,0xC3,0xDA,0x03,0xDB,0xC3,0xCA,0x82,0xBA,0x04,0xDB,0x23,0xEB,0x23,0xE3,0xE4,0xE2,0x03,0xDB,0x43,0x92,0x23,0x92,0x23,0x92,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x82,0x23,0x92,0x44,0x9A,0x23,0x92,0x23,0x8A,0x43,0x92,0x64,0x92,0x03,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,
-	0xA7,0xD3,0x46,0xC3,0x46,0xC3,0x05,0xB3,0x05,0xB3,0x46,0xBB,0x66,0xC3,0x26,0xBB,0x25,0xBB,0x05,0xB3,0x25,0xBB,0x05,0xB3,0x66,0xC3,0x08,0xDC,0xE7,0xDB,0xA7,0xD3,0x25,0xBB,0x05,0xB3,0x87,0xCB,0xA8,0xCB,0x46,0xBB,0x84,0xA2,0x25,0xBB,0x08,0xDC,0x08,0xDC,0xA7,0xD3,0xA7,0xD3,0xA6,0xD3,0x66,0xCB,0xC7,0xD3,0xC7,0xD3,0x66,0xC3,
-	0xA4,0xA2,0x64,0x9A,0x46,0xBB,0x46,0xBB,0x43,0x92,0x84,0x9A,0xA5,0xA2,0x84,0x9A,0x84,0xA2,0x84,0xA2,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0x06,0xB3,0xC5,0xAA,0x25,0xBB,0x66,0xCB,0x87,0xCB,0x87,0xCB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,
-	0xA6,0xD3,0x66,0xD3,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0xC7,0xD3,0xA7,0xD3,0x66,0xC3,0x25,0xBB,0x05,0xB3,0x25,0xBB,0x25,0xC3,0x66,0xC3,0x87,0xCB,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xA6,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,
-	0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0x08,0xDC,0x08,0xDC,0x46,0xC3,0x84,0x9A,0x64,0x9A,0xE5,0xAA,0x46,0xBB,0x46,0xC3,0x46,0xBB,0xC5,0xAA,0xA4,0xAA,0x25,0xBB,0x66,0xC3,0xE5,0xB2,0x84,0x9A,0x2B,0xBC,0xAD,0xEC,0x4D,0xD5,0xAD,0xEC,0x0C,0xE4,0x69,0xB3,0x0C,0xE4,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,
-	0xA7,0xDB,0x66,0xEB,0x45,0xDB,0x04,0xDB,0xE5,0xBA,0xC4,0xAA,0xA4,0xAA,0xA4,0xAA,0xC3,0xBA,0xA4,0xAA,0xC3,0xCA,0xC2,0xD2,0xC2,0xD2,0x03,0xDB,0x02,0xE3,0xE2,0xDA,0x82,0xCA,0x82,0xC2,0xC2,0xD2,0x85,0xEB,0xA1,0xD2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0x42,0xF3,0xA4,0xF3,0xA4,0xF3,0x63,0xEB,0x03,0xDB,0xE3,0xD2,0xE3,0xD2,0xC3,0xCA,
-	0x82,0xC2,0x22,0xA2,0x22,0xA2,0x43,0xAA,0x23,0x92,0x02,0x8A,0x23,0x92,0x22,0xA2,0x22,0xA2,0x02,0x8A,0x43,0xB2,0x82,0xCA,0x43,0xB2,0x22,0xA2,0x23,0x92,0x23,0x92,0x23,0x92,0x03,0x8A,0xE3,0x79,0x23,0x92,0x22,0xA2,0x23,0x92,0x23,0x8A,0xE3,0x81,0xE3,0x81,0xE2,0x81,0xE3,0x79,0xC3,0x71,0xC3,0x69,0xC3,0x71,0xC3,0x71,0xC3,0x69,
-	0xC2,0x71,0xC3,0x71,0x03,0x82,0xE3,0x79,0x23,0x92,0xE2,0xE2,0x82,0xC2,0x43,0xB2,0x43,0xAA,0x82,0xBA,0x43,0xB2,0x43,0xB2,0x43,0xAA,0x83,0xB2,0x03,0xDB,0xC3,0xDA,0x23,0xEB,0xC3,0xDA,0xC2,0xD2,0xC3,0xCA,0xC3,0xCA,0x23,0x9A,0xC3,0xCA,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0x24,0xEB,0xC3,0xCA,0x23,0x8A,0x44,0x8A,0x43,0x92,0x23,0x8A,
-	0x03,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x82,0xE2,0x81,0x03,0x82,0x02,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0xA7,0xD3,0x66,0xCB,0x05,0xBB,0xE5,0xAA,0xC5,0xAA,0x46,0xBB,0xC4,0xB2,0xC4,0xB2,0x05,0xB3,0x25,0xBB,0x05,0xB3,0x26,0xBB,0xA7,0xD3,0x08,0xDC,0xE7,0xDB,0xA7,0xD3,
-	0x46,0xC3,0x25,0xBB,0xA8,0xCB,0x87,0xCB,0x05,0xB3,0x06,0xB3,0x66,0xC3,0xA7,0xD3,0xE7,0xDB,0x08,0xDC,0xA7,0xD3,0x25,0xC3,0x66,0xC3,0x87,0xCB,0x66,0xCB,0x66,0xC3,0x06,0xB3,0x05,0xB3,0xA7,0xD3,0x46,0xC3,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0x64,0x92,0x64,0x9A,0xC5,0xAA,0xA4,0xA2,0x23,0x92,0x43,0x92,0xE5,0xAA,0x87,0xC3,
-	0x87,0xCB,0xA7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xC7,0xD3,0xA7,0xD3,0x08,0xDC,0xC7,0xD3,0x08,0xDC,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xA7,0xD3,0x46,0xC3,0x66,0xCB,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0x87,0xCB,0xA6,0xD3,0xA7,0xD3,0x87,0xCB,0x25,0xBB,0xC4,0xAA,0xC4,0xAA,0x05,0xB3,0x46,0xBB,0x87,0xCB,
-	0xA7,0xD3,0xE7,0xDB,0xC7,0xD3,0xA6,0xD3,0xA6,0xD3,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xA6,0xDB,0xA6,0xD3,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0xC7,0xD3,0xE7,0xDB,0xA6,0xD3,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0x66,0xC3,0x87,0xCB,0xA7,0xD3,0x87,0xCB,0x25,0xC3,0xE5,0xB2,0x05,0xB3,
-	0xA4,0xAA,0x63,0x9A,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x69,0xB3,0x69,0xB3,0xA8,0xCB,0x0C,0xE4,0x0C,0xE4,0xAD,0xEC,0xAD,0xEC,0x66,0xEB,0x45,0xDB,0x66,0xEB,0x85,0xEB,0x04,0xCB,0xA4,0xAA,0xC4,0xB2,0xA4,0xAA,0xC3,0xBA,0xC3,0xBA,0xC4,0xB2,0x83,0xB2,0xC3,0xBA,0x03,0xDB,0xE2,0xDA,0x02,0xE3,0xC2,0xD2,
-	0x82,0xCA,0x82,0xBA,0x82,0xBA,0x82,0xC2,0x82,0xC2,0xE2,0xDA,0xE2,0xDA,0x42,0xF3,0x63,0xF3,0x63,0xF3,0x63,0xF3,0xA4,0xF3,0x24,0xEB,0x44,0xE3,0xA6,0xF3,0x44,0xE3,0xA2,0xD2,0x43,0xB2,0x22,0xA2,0x22,0xA2,0x02,0x8A,0x02,0x8A,0x23,0x92,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x82,0xC2,0x43,0xB2,0x43,0xB2,0x22,0xA2,0x23,0x92,
-	0x23,0x92,0xE2,0x81,0xC2,0x79,0xE3,0x79,0xE3,0x81,0x03,0x8A,0xE2,0x81,0x03,0x8A,0x02,0x8A,0x03,0x82,0x23,0x8A,0xE2,0x81,0xE3,0x79,0xC2,0x79,0xC2,0x71,0xC3,0x71,0xC3,0x71,0x03,0x82,0x23,0x8A,0xE3,0x81,0x22,0xA2,0xA3,0xD2,0x82,0xBA,0x82,0xBA,0x82,0xC2,0xA2,0xD2,0xC3,0xCA,0x43,0xAA,0x23,0x92,0xE3,0x81,0x03,0x8A,0x23,0x92,
-	0x83,0xB2,0x43,0xAA,0x23,0x8A,0x82,0xC2,0x82,0xC2,0x83,0xB2,0x83,0xB2,0xC3,0xCA,0x03,0xDB,0xE4,0xE2,0x24,0xEB,0xE4,0xE2,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x82,0x03,0x8A,0x03,0x8A,0x03,0x82,0x03,0x8A,0x03,0x82,0xE3,0x81,0x03,0x8A,0x23,0x8A,0x03,0x8A,0xE2,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x81,
-	0xC7,0xD3,0x46,0xC3,0x05,0xB3,0xC4,0xAA,0xE5,0xB2,0x66,0xC3,0xA4,0xAA,0xA4,0xA2,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x87,0xC3,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0xA6,0xD3,0x46,0xBB,0x46,0xC3,0x66,0xC3,0x25,0xBB,0x87,0xCB,0xA7,0xD3,0xC7,0xD3,0x08,0xDC,0x08,0xDC,0x46,0xC3,0xC4,0xAA,0x26,0xBB,0x66,0xC3,0x25,0xBB,0xE5,0xB2,
-	0x26,0xBB,0x87,0xCB,0xC7,0xD3,0xA7,0xD3,0x66,0xC3,0xE5,0xAA,0xE5,0xAA,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0xE5,0xAA,0xE5,0xAA,0x64,0x9A,0x43,0x92,0x05,0xB3,0x87,0xCB,0x87,0xCB,0xC7,0xD3,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0x08,0xDC,0x08,0xDC,0x08,0xDC,
-	0x08,0xDC,0xC7,0xD3,0x87,0xCB,0xA7,0xD3,0xC7,0xD3,0xA7,0xD3,0xA7,0xD3,0xA7,0xD3,0x87,0xCB,0x66,0xCB,0x25,0xBB,0xE5,0xB2,0xA4,0xA2,0xA4,0xA2,0xE5,0xB2,0x25,0xC3,0x87,0xC3,0x87,0xCB,0x87,0xCB,0x87,0xCB,0xA7,0xD3,0xA7,0xDB,0xA6,0xD3,0xA6,0xD3,0xC7,0xD3,0xA7,0xD3,0x66,0xCB,0xA7,0xD3,0xA7,0xD3,0xE7,0xDB,0xA7,0xD3,0x66,0xD3,
-	0xA7,0xD3,0x66,0xD3,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0x87,0xCB,0x66,0xD3,0xA7,0xD3,0xA6,0xD3,0x66,0xCB,0x46,0xC3,0x25,0xC3,0xE5,0xAA,0x84,0xA2,0xC5,0xAA,0xE5,0xAA,0x69,0xB3,0x0C,0xE4,0xAD,0xEC,0x0C,0xE4,0x69,0xB3,0x69,0xB3,0xC9,0xE3,0x0C,0xE4,0xAD,0xEC,0xAD,0xEC,0x2A,0xEC,0x45,0xDB,
-	0x45,0xDB,0x24,0xEB,0x24,0xEB,0xE5,0xBA,0xC4,0xB2,0xC3,0xBA,0xC3,0xBA,0xC3,0xBA,0x83,0xB2,0x83,0xB2,0xC3,0xBA,0xC3,0xBA,0xC2,0xD2,0xC2,0xD2,0xC1,0xDA,0xC1,0xDA,0xC2,0xD2,0x82,0xC2,0x82,0xC2,0x82,0xC2,0x82,0xC2,0x02,0xE3,0x23,0xEB,0x63,0xF3,0x63,0xF3,0x63,0xF3,0xC4,0xFB,0xA4,0xF3,0x64,0xF3,0x85,0xEB,0xC7,0xE3,0xC3,0xDA,
-	0x44,0xE3,0x82,0xBA,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x23,0x92,0x02,0x8A,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x43,0xB2,0x43,0xB2,0x43,0xB2,0x22,0xA2,0x22,0xA2,0x02,0x8A,0x02,0x8A,0x22,0xA2,0x82,0xCA,0x23,0x8A,0xE3,0x79,0xE2,0x81,0x23,0x8A,0x02,0x8A,0x22,0xA2,0x23,0x92,0xE3,0x81,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,
-	0xC2,0x79,0xC3,0x71,0xE3,0x79,0xE3,0x79,0x22,0xA2,0x43,0xB2,0x23,0x92,0x82,0xBA,0xA3,0xD2,0xE3,0xD2,0xA3,0xD2,0x43,0xAA,0x23,0x92,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x81,0x23,0x92,0x43,0xB2,0x64,0xC2,0xA3,0xD2,0x82,0xBA,0xC3,0xDA,0xC3,0xDA,0xE4,0xE2,0x23,0xE3,0x24,0xEB,0xC3,0xCA,0x23,0x8A,0x03,0x82,0x03,0x82,
-	0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0xE3,0x81,0x03,0x8A,0x03,0x8A,0x03,0x82,0x03,0x82,0x23,0x8A,0x03,0x82,0xE3,0x81,0x87,0xCB,0x66,0xC3,0x25,0xBB,0x05,0xB3,0x66,0xC3,0x66,0xC3,0x26,0xBB,0xE5,0xAA,0xA4,0xAA,0xC4,0xAA,0x26,0xBB,0x66,0xC3,0xA7,0xD3,0x87,0xCB,0xA6,0xD3,0xA7,0xD3,
-	0xC7,0xD3,0x25,0xC3,0x84,0xA2,0x05,0xBB,0xC7,0xD3,0x08,0xDC,0xC7,0xD3,0xC7,0xD3,0x08,0xDC,0xE7,0xDB,0xC4,0xB2,0xA4,0xAA,0xC4,0xA2,0xE5,0xB2,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x87,0xCB,0x25,0xC3,0x46,0xC3,0x25,0xBB,0xC5,0xAA,0x64,0x9A,0x64,0x9A,0xE5,0xAA,0xC4,0xAA,0xC4,0xAA,0xA4,0xA2,0x64,0x9A,0xC5,0xAA,0xE5,0xAA,0x46,0xBB,
-	0xC7,0xD3,0xA7,0xD3,0xC7,0xD3,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xC7,0xD3,0x08,0xDC,0xC7,0xD3,0xE7,0xDB,0x08,0xDC,0xC7,0xD3,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xA6,0xD3,0xA6,0xD3,0xC7,0xD3,0xA7,0xD3,0xA7,0xD3,0x66,0xCB,0x25,0xC3,0x25,0xBB,0x25,0xBB,0xE5,0xAA,0xC5,0xAA,0x84,0xA2,0x84,0xA2,0x05,0xBB,
-	0x46,0xC3,0x25,0xBB,0x25,0xBB,0x46,0xBB,0x25,0xC3,0x25,0xC3,0x46,0xC3,0x66,0xC3,0xA6,0xD3,0xC7,0xD3,0xA7,0xD3,0x87,0xCB,0xA6,0xD3,0xC7,0xD3,0xE7,0xDB,0xA6,0xD3,0xA7,0xD3,0x66,0xD3,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA7,0xD3,0x46,0xC3,0x87,0xCB,0xA7,0xD3,0x87,0xCB,0x08,0xDC,0x87,0xCB,0x25,0xC3,0x46,0xC3,
-	0x25,0xC3,0xC4,0xB2,0xE5,0xB2,0x26,0xBB,0xAD,0xEC,0x0C,0xE4,0xC9,0xE3,0x69,0xB3,0x69,0xB3,0xA8,0xCB,0x0C,0xE4,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x4A,0xFC,0x66,0xEB,0x04,0xDB,0x04,0xCB,0xE5,0xBA,0xC4,0xB2,0xC4,0xAA,0xC4,0xB2,0xA4,0xAA,0xC4,0xB2,0xA4,0xAA,0xC3,0xBA,0xC3,0xBA,0x82,0xC2,0xC2,0xD2,0xC2,0xD2,0xC2,0xD2,0xC2,0xD2,
-	0xA1,0xD2,0xA1,0xD2,0x82,0xCA,0x82,0xC2,0xE2,0xE2,0x22,0xEB,0xE2,0xE2,0x42,0xF3,0xE2,0xE2,0x22,0xEB,0xE2,0xE2,0x82,0xCA,0x82,0xC2,0xC3,0xCA,0x64,0xF3,0x63,0xEB,0x23,0xEB,0xA3,0xD2,0x23,0x92,0x23,0x92,0x23,0x92,0x23,0x92,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x23,0x92,0x22,0xA2,0x43,0xB2,0x43,0xAA,0x22,0xA2,0x43,0xAA,0x43,0xB2,
-	0x82,0xCA,0x82,0xBA,0x22,0xA2,0x82,0xBA,0x02,0x8A,0xE2,0x81,0x03,0x82,0x03,0x82,0x23,0x8A,0x22,0xA2,0x23,0x92,0xC3,0x71,0xE3,0x79,0xE2,0x81,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0xE3,0x79,0xC2,0x79,0x23,0x92,0x22,0xA2,0x03,0x8A,0x43,0xB2,0x82,0xCA,0x82,0xBA,0x82,0xBA,0x23,0x9A,0x23,0x8A,0x03,0x8A,0x03,0x82,0xE3,0x81,
-	0xE3,0x79,0xE3,0x79,0x03,0x82,0x23,0x9A,0x43,0xB2,0x64,0xBA,0xC3,0xCA,0x44,0xE3,0x23,0xE3,0x23,0xEB,0xE4,0xE2,0x23,0xEB,0x24,0xEB,0x23,0x92,0x03,0x82,0xE2,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x8A,0x03,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x82,0xE3,0x81,
-	0x87,0xCB,0x46,0xC3,0x25,0xBB,0x25,0xC3,0x66,0xCB,0x66,0xC3,0x05,0xB3,0xE5,0xB2,0x05,0xB3,0x26,0xBB,0x46,0xBB,0x26,0xBB,0x46,0xC3,0x25,0xBB,0x25,0xC3,0x66,0xC3,0x87,0xCB,0x25,0xBB,0xA4,0xA2,0x05,0xB3,0xA7,0xD3,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x87,0xCB,0x84,0xA2,0x64,0x9A,0x64,0x9A,0xC4,0xAA,0x66,0xCB,0xC7,0xD3,
-	0xC7,0xD3,0x46,0xC3,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0x64,0x9A,0x64,0x92,0xC5,0xA2,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0x84,0x9A,0xC5,0xAA,0xC5,0xAA,0x26,0xBB,0x87,0xCB,0x87,0xCB,0xC7,0xD3,0xA6,0xD3,0xA6,0xD3,0xA7,0xD3,0xA7,0xD3,0x08,0xDC,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,
-	0xC7,0xD3,0xE7,0xDB,0x87,0xCB,0x66,0xCB,0xA7,0xD3,0xA7,0xD3,0x87,0xCB,0x05,0xBB,0xE5,0xB2,0xE5,0xAA,0xA5,0xAA,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0x64,0x9A,0x84,0xA2,0xE5,0xAA,0xC5,0xAA,0x84,0xA2,0x05,0xB3,0x66,0xC3,0x66,0xC3,0x25,0xBB,0x26,0xBB,0x87,0xCB,0xA7,0xD3,0xA7,0xD3,0x66,0xCB,0x45,0xCB,0xC7,0xD3,0xC7,0xD3,0xA6,0xD3,
-	0xC7,0xD3,0xC7,0xD3,0xA6,0xD3,0xA7,0xD3,0xE7,0xDB,0xE7,0xDB,0x46,0xC3,0x25,0xC3,0x46,0xC3,0xC7,0xD3,0x87,0xCB,0x45,0xCB,0xE7,0xDB,0x87,0xCB,0xE5,0xBA,0x46,0xC3,0xA8,0xCB,0x66,0xCB,0x25,0xBB,0x2B,0xBC,0x0C,0xE4,0x0C,0xE4,0x0C,0xE4,0x0C,0xE4,0xA8,0xCB,0xAD,0xEC,0xAD,0xEC,0xAD,0xEC,0x4A,0xFC,0xCB,0xFC,0x4A,0xFC,0x24,0xEB,
-	0x04,0xDB,0xC4,0xB2,0xA4,0xAA,0xA4,0xAA,0xA4,0xAA,0xA4,0xA2,0xA4,0xAA,0xC3,0xBA,0x83,0xB2,0xC3,0xCA,0x82,0xC2,0xC2,0xD2,0xC2,0xD2,0x82,0xCA,0x82,0xBA,0xA2,0xD2,0xA1,0xD2,0x82,0xCA,0x82,0xCA,0xA2,0xD2,0x02,0xE3,0x42,0xF3,0x22,0xEB,0x42,0xF3,0xE2,0xE2,0xE2,0xE2,0xA2,0xDA,0x82,0xC2,0x43,0xB2,0xE3,0xD2,0xA6,0xF3,0x28,0xF4,
-	0x64,0xF3,0xA2,0xDA,0x82,0xBA,0x22,0xA2,0x02,0x8A,0x02,0x8A,0x43,0xB2,0x43,0xB2,0x23,0x92,0x22,0xA2,0x22,0xA2,0x22,0xA2,0x43,0xB2,0x43,0xB2,0x82,0xC2,0xC1,0xDA,0xE2,0xE2,0x82,0xBA,0xE3,0x79,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x8A,0x23,0x92,0x43,0xAA,0x22,0xA2,0x23,0x9A,0xC2,0x79,0x03,0x8A,0x23,0x8A,0x03,0x82,0xE2,0x81,
-	0xE3,0x79,0x03,0x82,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x92,0x23,0x92,0x43,0xAA,0x64,0xC2,0x82,0xBA,0x43,0xB2,0x43,0xAA,0x23,0x92,0x23,0x92,0x03,0x8A,0x03,0x8A,0xE3,0x79,0xE3,0x81,0x03,0x8A,0x23,0x9A,0x23,0x9A,0x43,0xB2,0xE3,0xD2,0x24,0xEB,0xC3,0xDA,0xC3,0xDA,0xC3,0xDA,0x24,0xEB,0xE4,0xE2,0xC3,0xBA,0x03,0x82,0x03,0x82,
-	0xE2,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xE2,0x81,0xE3,0x81,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0x87,0xCB,0x46,0xC3,0x05,0xBB,0x66,0xC3,0x66,0xCB,0x46,0xC3,0x25,0xBB,0x05,0xB3,0x26,0xBB,0x66,0xC3,0x46,0xC3,0x25,0xBB,0xA4,0xAA,0xE5,0xB2,0x66,0xC3,0x26,0xBB,
-	0x05,0xBB,0x05,0xB3,0x26,0xBB,0xA8,0xCB,0xA6,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xE7,0xDB,0x66,0xCB,0xA4,0xAA,0x64,0x9A,0x64,0x9A,0xC5,0xAA,0x05,0xBB,0x66,0xCB,0x66,0xC3,0x26,0xBB,0xE5,0xAA,0xA4,0xA2,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0x05,0xB3,0xC4,0xAA,0xA4,0xA2,0x64,0x9A,0x43,0x92,0x64,0x9A,0xA4,0xA2,0xC5,0xAA,0x26,0xBB,
-	0x46,0xC3,0x66,0xC3,0x87,0xCB,0x87,0xCB,0x66,0xCB,0x66,0xCB,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xA6,0xD3,0xE7,0xDB,0xC7,0xD3,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0x08,0xDC,0xA7,0xD3,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x66,0xCB,0x46,0xBB,0xC5,0xA2,0x84,0xA2,0x64,0x9A,0x23,0x8A,0x43,0x92,0x84,0xA2,0xC5,0xA2,0x64,0x9A,0x43,0x92,
-	0x64,0x92,0x43,0x92,0x64,0x92,0xC5,0xAA,0x25,0xBB,0x46,0xBB,0x26,0xBB,0x25,0xBB,0x66,0xCB,0xC7,0xD3,0xA7,0xD3,0x66,0xCB,0x66,0xCB,0xA7,0xD3,0xA6,0xD3,0xA7,0xD3,0xE7,0xDB,0xA7,0xD3,0x66,0xD3,0xA6,0xD3,0xC7,0xD3,0xA7,0xD3,0x66,0xCB,0x46,0xC3,0x25,0xC3,0x66,0xCB,0x46,0xC3,0x25,0xC3,0xA8,0xCB,0xA7,0xD3,0x46,0xC3,0x05,0xBB,
-	0x66,0xC3,0x25,0xC3,0xC5,0xAA,0xAD,0xEC,0x0C,0xE4,0x0C,0xE4,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xAD,0xEC,0xAD,0xEC,0xCB,0xFC,0x4A,0xFC,0x4A,0xFC,0x4A,0xFC,0x66,0xEB,0x04,0xDB,0xC4,0xAA,0xC4,0xAA,0xC4,0xB2,0xA4,0xAA,0xA4,0xA2,0xA4,0xAA,0xA4,0xA2,0xC3,0xBA,0x82,0xBA,0xC3,0xCA,0xC2,0xD2,0xC2,0xD2,0x82,0xBA,0x82,0xCA,0xC1,0xDA,
-	0xC1,0xDA,0xA1,0xD2,0x82,0xCA,0xA1,0xD2,0xE2,0xE2,0x42,0xF3,0x42,0xF3,0x42,0xF3,0x42,0xF3,0x42,0xF3,0xE2,0xE2,0x82,0xCA,0xC2,0xD2,0xA4,0xF3,0xA6,0xF3,0xA4,0xF3,0xA4,0xF3,0xE2,0xE2,0xA1,0xD2,0x82,0xBA,0xC3,0xCA,0x43,0xB2,0x43,0xB2,0xC1,0xDA,0xE2,0xDA,0xC2,0xD2,0xA1,0xD2,0x03,0xDB,0x66,0xFC,0x66,0xFC,0x42,0xF3,0xE2,0xE2,
-	0xA2,0xD2,0x23,0x9A,0x03,0x82,0xE3,0x79,0x03,0x82,0xE3,0x81,0xE3,0x81,0x22,0xA2,0x82,0xBA,0x22,0xA2,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x81,0x03,0x8A,0xE3,0x79,0x03,0x82,0x23,0x92,0x43,0xAA,0x23,0x9A,0x23,0x92,0x24,0xA2,0x22,0xA2,0x82,0xC2,0xA3,0xDA,0x22,0xA2,0x22,0xA2,0x23,0x9A,0x03,0x82,0x03,0x8A,0x03,0x8A,
-	0xE3,0x79,0x03,0x82,0x23,0x8A,0x24,0xA2,0x43,0xB2,0x84,0xA2,0x43,0xB2,0xC4,0xDA,0xE3,0xD2,0xE3,0xD2,0xE3,0xD2,0xE4,0xE2,0xC3,0xDA,0x23,0xE3,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x8A,0x03,0x82,0xE2,0x81,0xE2,0x81,0x03,0x82,0xE2,0x81,0xE3,0x81,0x03,0x82,0xE3,0x81,0xE2,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x8A,
-	0x66,0xCB,0x46,0xC3,0x46,0xC3,0xA8,0xCB,0x87,0xCB,0x66,0xC3,0x46,0xC3,0x87,0xCB,0x66,0xC3,0x66,0xCB,0x05,0xB3,0xC4,0xB2,0xA4,0xAA,0xE5,0xB2,0x66,0xC3,0x05,0xB3,0x26,0xBB,0x46,0xBB,0x66,0xC3,0x08,0xDC,0xC7,0xD3,0xA6,0xD3,0xC7,0xD3,0xC7,0xD3,0xE7,0xDB,0x87,0xCB,0xE5,0xAA,0x64,0x92,0xC5,0xA2,0x05,0xB3,0xC5,0xAA,0xC5,0xAA,
-	0x46,0xBB,0x66,0xC3,0xE5,0xB2,0xC5,0xAA,0xC5,0xAA,0xA4,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x63,0x9A,0x64,0x9A,0x23,0x92,0x64,0x92,0x84,0x9A,0xC5,0xA2,0x25,0xC3,0x66,0xC3,0x46,0xBB,0x25,0xC3,0x87,0xCB,0x66,0xCB,0x66,0xCB,0x08,0xDC,0x08,0xDC,0xA7,0xD3,0xA7,0xDB,0xC7,0xD3,0xC7,0xD3,0xA6,0xD3,0xE7,0xDB,0xC7,0xD3,0xA7,0xD3,
-	0xC7,0xD3,0xA7,0xD3,0x87,0xCB,0x87,0xCB,0x66,0xC3,0x46,0xBB,0xE5,0xAA,0x64,0x9A,0x64,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x64,0x92,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0x23,0x8A,0x03,0x8A,0x64,0x92,0x84,0xA2,0xC4,0xAA,0xC4,0xAA,0xE5,0xB2,0x46,0xBB,0x87,0xCB,0xA7,0xD3,0xA7,0xD3,0xA7,0xD3,0x66,0xCB,0x87,0xCB,0xA7,0xD3,0xA7,0xD3,
-	0xC7,0xD3,0xA6,0xD3,0x66,0xD3,0xA7,0xD3,0xA7,0xD3,0x87,0xCB,0xA7,0xD3,0x87,0xCB,0x25,0xC3,0x46,0xC3,0x46,0xBB,0x05,0xBB,0x87,0xCB,0x87,0xCB,0x25,0xBB,0xC4,0xB2,0x26,0xBB,0x05,0xB3,0x49,0x93,0x2A,0xEC,0x0C,0xE4,0xC9,0xE3,0xC9,0xE3,0x0C,0xE4,0xC9,0xE3,0x2A,0xEC,0x4A,0xFC,0x4A,0xFC,0x4A,0xFC,0xCB,0xFC,0x4A,0xFC,0xA6,0xF3,
-	0x04,0xCB,0xC3,0xBA,0xC3,0xCA,0xC3,0xBA,0xC4,0xB2,0xC3,0xBA,0x43,0xB2,0x83,0xB2,0x43,0xB2,0xC3,0xBA,0x82,0xC2,0xC2,0xD2,0xC2,0xD2,0xA1,0xD2,0xA1,0xD2,0xC1,0xDA,0xA1,0xD2,0xA1,0xD2,0x82,0xC2,0xA1,0xD2,0x63,0xF3,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x63,0xF3,0x23,0xEB,0x23,0xEB,0xA6,0xDB,0x28,0xF4,0x05,0xFC,0xA4,0xF3,
-	0x63,0xF3,0x22,0xEB,0xA2,0xDA,0xA1,0xD2,0x82,0xC2,0xC1,0xDA,0xA1,0xD2,0xA1,0xD2,0xE2,0xE2,0x82,0xCA,0x82,0xCA,0xC1,0xDA,0x05,0xFC,0xC4,0xFB,0x23,0xE3,0x22,0xEB,0xE2,0xDA,0x22,0xA2,0xE2,0x81,0x23,0x92,0x22,0xA2,0x03,0x82,0xE3,0x79,0x03,0x82,0x03,0x8A,0x03,0x8A,0x03,0x82,0x03,0x8A,0x02,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x8A,
-	0x03,0x8A,0x03,0x8A,0x23,0x9A,0x22,0xA2,0x23,0x92,0xE3,0x81,0x23,0x92,0x22,0xA2,0x64,0xBA,0x64,0xC2,0x23,0x92,0x03,0x8A,0x23,0x9A,0x23,0x8A,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x8A,0x23,0x8A,0x23,0x9A,0x43,0xB2,0x43,0xB2,0x84,0xA2,0x64,0xC2,0xC4,0xDA,0xA3,0xD2,0xE3,0xD2,0xC3,0xDA,0xC4,0xDA,0x23,0xEB,0x04,0xDB,0x03,0x82,
-	0x03,0x82,0x03,0x8A,0x23,0x8A,0x03,0x8A,0xE3,0x81,0x03,0x82,0x23,0x8A,0x03,0x8A,0xE2,0x81,0xE3,0x79,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0x23,0x8A,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x66,0xCB,0xA8,0xCB,0x87,0xCB,0x66,0xCB,0x26,0xBB,0xA4,0xAA,0x05,0xB3,0x06,0xB3,0x06,0xB3,0x26,0xBB,
-	0x46,0xC3,0xA7,0xD3,0xA7,0xD3,0xC7,0xD3,0x08,0xDC,0xA6,0xD3,0xC7,0xD3,0xC7,0xD3,0x87,0xCB,0x46,0xC3,0xA4,0xA2,0xA4,0xA2,0x06,0xB3,0x84,0xA2,0xA5,0xAA,0xE5,0xAA,0x66,0xC3,0x87,0xCB,0xC5,0xAA,0x84,0x9A,0x64,0x9A,0x63,0x9A,0x84,0x9A,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x64,0x92,0x23,0x8A,0x43,0x92,0x64,0x92,0xE5,0xAA,0x46,0xC3,
-	0x66,0xC3,0x25,0xBB,0x05,0xB3,0x46,0xC3,0x87,0xCB,0x87,0xCB,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xA6,0xD3,0xA7,0xD3,0xC7,0xD3,0xA7,0xD3,0xA7,0xD3,0xA6,0xD3,0xC7,0xD3,0xC7,0xD3,0xA7,0xD3,0x87,0xCB,0x25,0xBB,0xC4,0xAA,0xA4,0xA2,0x64,0x9A,0x64,0x92,0x44,0x8A,0x03,0x8A,0x03,0x82,0x44,0x8A,0x64,0x9A,0xC5,0xAA,0xA4,0xA2,
-	0x64,0x9A,0x64,0x92,0x43,0x92,0x23,0x8A,0x84,0x9A,0xA4,0xA2,0x84,0xA2,0xE5,0xB2,0x25,0xC3,0x45,0xCB,0x87,0xCB,0x87,0xC3,0x46,0xC3,0x66,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0xA6,0xD3,0xA6,0xD3,0x87,0xCB,0xA6,0xD3,0xC7,0xD3,0x87,0xCB,0x66,0xCB,0xC7,0xD3,0x46,0xC3,0xC4,0xB2,0x05,0xBB,0x66,0xC3,0x26,0xBB,0x26,0xBB,
-	0x46,0xBB,0x25,0xBB,0xAD,0xEC,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0x2A,0xEC,0x4A,0xFC,0x4A,0xFC,0x4A,0xFC,0x4A,0xFC,0xA6,0xF3,0xC3,0xBA,0xE3,0xD2,0x03,0xDB,0x04,0xCB,0x83,0xB2,0xC3,0xBA,0xC3,0xBA,0xC3,0xBA,0x82,0xBA,0xC3,0xBA,0x82,0xBA,0x82,0xBA,0x82,0xC2,0x82,0xCA,0xA1,0xD2,0xA1,0xD2,0xA2,0xDA,
-	0xA2,0xD2,0xA1,0xD2,0xA1,0xD2,0x22,0xEB,0x42,0xF3,0x63,0xF3,0x63,0xF3,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0xC4,0xFB,0x05,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x05,0xFC,0xA4,0xF3,0x63,0xF3,0x22,0xEB,0x82,0xBA,0xC1,0xDA,0xA2,0xD2,0x82,0xCA,0xC1,0xDA,0xA1,0xD2,0x82,0xCA,0x82,0xCA,0x82,0xBA,0xA1,0xD2,0xA1,0xD2,0x03,0xDB,0x03,0xDB,
-	0x43,0xB2,0x22,0xA2,0x03,0x82,0x23,0x92,0x23,0x92,0x03,0x82,0xE3,0x81,0x03,0x82,0x03,0x82,0xE3,0x79,0x03,0x82,0xE3,0x81,0x03,0x8A,0x23,0x92,0x23,0x92,0x03,0x82,0x23,0x9A,0x23,0x92,0x43,0xAA,0x23,0x9A,0x23,0x92,0x03,0x8A,0x03,0x8A,0x23,0x9A,0x64,0xBA,0x83,0xB2,0x03,0x8A,0x23,0x92,0x03,0x8A,0x23,0x92,0x23,0x8A,0xE3,0x79,
-	0x03,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x9A,0x83,0xB2,0x84,0xA2,0x64,0x9A,0x64,0xBA,0x04,0xCB,0xC4,0xDA,0xC3,0xDA,0xE4,0xE2,0x23,0xE3,0xC3,0xDA,0x23,0xEB,0x03,0x82,0x03,0x8A,0xE2,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,
-	0x87,0xC3,0x66,0xCB,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x87,0xCB,0x66,0xCB,0x87,0xCB,0x87,0xCB,0x46,0xC3,0x46,0xC3,0x26,0xBB,0x46,0xC3,0x26,0xBB,0xE5,0xAA,0x87,0xC3,0x46,0xC3,0x25,0xC3,0x87,0xCB,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0x87,0xCB,0x05,0xBB,0xC4,0xAA,0x05,0xB3,0x05,0xB3,0x63,0x9A,0x05,0xB3,0xA7,0xD3,
-	0x46,0xC3,0x05,0xB3,0xA4,0xA2,0x64,0x92,0x23,0x8A,0x64,0x92,0x64,0x9A,0x84,0xA2,0xA5,0xAA,0xE5,0xAA,0x64,0x9A,0x64,0x9A,0xA4,0xA2,0xA4,0xA2,0x05,0xB3,0x46,0xC3,0x46,0xC3,0xE5,0xB2,0xC5,0xAA,0x46,0xBB,0xA7,0xD3,0xC7,0xD3,0xA6,0xD3,0xC7,0xD3,0xC7,0xD3,0x87,0xCB,0x66,0xCB,0xA7,0xD3,0xC7,0xD3,0xA7,0xD3,0x87,0xCB,0xA7,0xD3,
-	0xC7,0xD3,0xC7,0xD3,0xA7,0xD3,0x87,0xCB,0x26,0xBB,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x64,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x9A,0xC5,0xA2,0xA4,0xA2,0x64,0x9A,0x64,0x92,0x03,0x82,0xE3,0x79,0x03,0x82,0x23,0x8A,0x63,0x9A,0x84,0x9A,0xA4,0xAA,0x05,0xB3,0x46,0xC3,0x66,0xC3,0x25,0xC3,0x25,0xBB,0x46,0xC3,0x46,0xC3,
-	0x66,0xCB,0x87,0xCB,0xA7,0xD3,0x87,0xCB,0xA6,0xD3,0xA7,0xD3,0xA6,0xD3,0x66,0xCB,0x87,0xCB,0xA7,0xD3,0xA7,0xD3,0x66,0xC3,0xE5,0xB2,0xC4,0xAA,0xA4,0xAA,0x05,0xB3,0xE5,0xBA,0xE6,0xAA,0xAD,0xEC,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0x45,0xDB,0x2A,0xEC,0xCB,0xFC,0x4A,0xFC,0x4A,0xFC,0xE7,0xF3,0x45,0xDB,0xC3,0xBA,
-	0x03,0xDB,0xC3,0xBA,0xC3,0xBA,0xC3,0xCA,0xC3,0xCA,0xC3,0xBA,0xC3,0xBA,0x82,0xBA,0xC3,0xBA,0x82,0xBA,0x82,0xC2,0xA1,0xD2,0xA1,0xD2,0x82,0xC2,0x82,0xCA,0xA1,0xD2,0xE2,0xE2,0xE2,0xE2,0xA1,0xD2,0x42,0xF3,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0x66,0xFC,0xC8,0xFC,0x66,0xFC,0x28,0xF4,0x66,0xFC,
-	0x64,0xF3,0xE2,0xDA,0xA2,0xD2,0x02,0xE3,0x22,0xEB,0x82,0xBA,0x82,0xCA,0xA1,0xD2,0x42,0xF3,0xE2,0xE2,0x43,0xAA,0x82,0xCA,0x23,0xEB,0x63,0xF3,0xA4,0xF3,0x82,0xC2,0x43,0xB2,0x23,0x92,0x23,0x8A,0x23,0x92,0x03,0x82,0xE3,0x79,0x03,0x8A,0x23,0x92,0x43,0xB2,0x23,0x92,0x03,0x82,0xE3,0x79,0xE3,0x79,0x03,0x8A,0x23,0x92,0x03,0x8A,
-	0x23,0x92,0x02,0x8A,0x23,0x92,0x03,0x8A,0x03,0x8A,0x03,0x82,0x23,0x92,0x23,0x92,0x84,0xA2,0xA4,0xCA,0x03,0x8A,0x23,0x92,0x03,0x8A,0x23,0x8A,0x23,0x8A,0xE3,0x79,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x92,0x43,0xAA,0x84,0xA2,0x64,0x9A,0xC4,0xDA,0x04,0xDB,0xC4,0xDA,0xE4,0xE2,0xE3,0xD2,0x04,0xDB,0x44,0xE3,0x23,0xEB,0x43,0xB2,
-	0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x23,0x8A,0x23,0x8A,0xE3,0x81,0xE3,0x81,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x81,0xE3,0x79,0xC2,0x79,0xE3,0x79,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x66,0xC3,0x66,0xCB,0x66,0xCB,0x87,0xCB,0x66,0xC3,0x66,0xC3,0x46,0xBB,0x26,0xBB,0x46,0xC3,0x66,0xC3,0x66,0xC3,0x25,0xC3,
-	0x05,0xB3,0x26,0xBB,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xA7,0xD3,0xA7,0xD3,0x87,0xC3,0x26,0xBB,0xA4,0xAA,0xC4,0xAA,0x66,0xC3,0xA8,0xCB,0xE7,0xDB,0x46,0xC3,0x84,0xA2,0x64,0x92,0xA5,0x9A,0x64,0x9A,0x43,0x92,0xA4,0xA2,0x84,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0x05,0xB3,0x26,0xBB,0xE5,0xB2,0x05,0xB3,0x26,0xBB,
-	0x46,0xBB,0xC4,0xB2,0xC4,0xAA,0x25,0xC3,0x87,0xCB,0xA7,0xD3,0xC7,0xD3,0xA7,0xD3,0x87,0xCB,0xA8,0xCB,0x87,0xCB,0xE7,0xDB,0xC7,0xD3,0x87,0xCB,0x66,0xCB,0x66,0xCB,0xA7,0xD3,0xA7,0xD3,0xA7,0xD3,0x87,0xCB,0x66,0xC3,0x05,0xB3,0xC5,0xAA,0xA4,0xA2,0x64,0x9A,0x44,0x8A,0x64,0x92,0x23,0x92,0x43,0x92,0x64,0x9A,0xA4,0xA2,0x64,0x92,
-	0x64,0x92,0x23,0x8A,0xE3,0x81,0xC2,0x79,0xC2,0x79,0x03,0x82,0x64,0x9A,0x64,0x9A,0x64,0x92,0xA5,0xA2,0x05,0xB3,0x46,0xBB,0x05,0xB3,0xE5,0xB2,0x46,0xBB,0x66,0xC3,0x46,0xC3,0x87,0xCB,0x87,0xCB,0x66,0xCB,0x66,0xCB,0xA7,0xD3,0xA7,0xD3,0x66,0xCB,0xA7,0xD3,0xA6,0xD3,0x66,0xCB,0x66,0xCB,0x46,0xBB,0xA4,0xAA,0x63,0x9A,0x64,0x9A,
-	0xA5,0xAA,0xC7,0x92,0xC9,0xE3,0xC9,0xE3,0xA7,0xDB,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0x66,0xD3,0x4A,0xFC,0xCB,0xFC,0x4A,0xFC,0x4A,0xFC,0x4A,0xFC,0x44,0xE3,0xC3,0xCA,0x04,0xCB,0xE3,0xD2,0x03,0xDB,0xC2,0xD2,0xC3,0xCA,0xC3,0xCA,0xC3,0xCA,0xC3,0xBA,0x82,0xBA,0xC2,0xD2,0x82,0xC2,0x82,0xCA,0x42,0xF3,0xA1,0xD2,0xA1,0xD2,0xE2,0xDA,
-	0x63,0xF3,0x42,0xF3,0xE2,0xE2,0xA1,0xD2,0x22,0xEB,0x42,0xF3,0x42,0xF3,0xC4,0xFB,0x42,0xF3,0x22,0xEB,0x05,0xFC,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0xC4,0xFB,0x63,0xEB,0x23,0xEB,0x42,0xF3,0x22,0xEB,0xE2,0xE2,0x22,0xEB,0x66,0xFC,0x66,0xFC,0x63,0xEB,0xC2,0xD2,0xC1,0xDA,0x23,0xEB,0x64,0xF3,0x05,0xFC,0x63,0xEB,
-	0xC2,0xD2,0x43,0xB2,0x23,0x92,0xE3,0x79,0x03,0x82,0xE3,0x79,0x03,0x8A,0x23,0x92,0x22,0xA2,0x03,0x8A,0x03,0x8A,0x03,0x8A,0xE3,0x79,0x03,0x8A,0x03,0x8A,0x23,0x92,0x23,0x9A,0x43,0xAA,0x43,0xAA,0x64,0xBA,0x44,0xB2,0x23,0x9A,0x83,0xB2,0x04,0xCB,0x64,0xBA,0xA4,0xCA,0x03,0x8A,0x03,0x8A,0x23,0x9A,0x03,0x8A,0x03,0x8A,0x03,0x8A,
-	0x03,0x8A,0xE3,0x81,0x03,0x82,0x03,0x8A,0x23,0x92,0x84,0xA2,0xA4,0xAA,0xE4,0xE2,0x64,0xF3,0xE4,0xE2,0x04,0xDB,0xC4,0xDA,0xC3,0xDA,0xC3,0xDA,0xE4,0xE2,0xC3,0xDA,0xE3,0x79,0xE3,0x81,0xE3,0x79,0x03,0x82,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0xC2,0x79,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,
-	0x66,0xC3,0x66,0xC3,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x66,0xC3,0x87,0xC3,0x87,0xCB,0x66,0xC3,0x26,0xBB,0x25,0xBB,0x26,0xBB,0x25,0xBB,0x25,0xC3,0x66,0xC3,0x46,0xBB,0x05,0xB3,0x05,0xB3,0xA7,0xD3,0xC7,0xD3,0xA7,0xD3,0x87,0xCB,0xA7,0xD3,0x66,0xCB,0xA7,0xD3,0xC7,0xD3,0x25,0xBB,0x05,0xB3,0x26,0xBB,0x87,0xCB,0x87,0xCB,0x66,0xCB,
-	0x66,0xC3,0xC5,0xAA,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0xA4,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0xA5,0xA2,0x26,0xBB,0x05,0xB3,0x64,0x9A,0xC5,0xAA,0x05,0xB3,0xE5,0xB2,0x05,0xB3,0x25,0xBB,0x66,0xC3,0x46,0xC3,0x46,0xC3,0xA7,0xD3,0xC7,0xD3,0xC7,0xD3,0x87,0xCB,0x87,0xCB,0xC7,0xD3,0xA7,0xD3,0x66,0xCB,0x66,0xC3,0x25,0xC3,
-	0x66,0xC3,0x87,0xCB,0x66,0xCB,0x46,0xC3,0x26,0xBB,0x05,0xB3,0xC4,0xA2,0x84,0xA2,0x64,0x9A,0x64,0x9A,0xA5,0x9A,0x64,0x92,0x64,0x92,0x64,0x9A,0x84,0xA2,0x64,0x9A,0xA5,0x9A,0xA5,0x9A,0x23,0x8A,0xE3,0x79,0xE3,0x81,0x23,0x8A,0x64,0x92,0x64,0x92,0x84,0x9A,0x84,0xA2,0x84,0xA2,0xA4,0xAA,0xC5,0xAA,0x05,0xB3,0x46,0xBB,0x46,0xC3,
-	0x46,0xC3,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x87,0xCB,0xA6,0xD3,0xA7,0xD3,0xA7,0xD3,0x66,0xCB,0xA8,0xCB,0x46,0xC3,0x25,0xC3,0x25,0xBB,0xE5,0xAA,0xC5,0xAA,0x84,0xA2,0x84,0x9A,0x69,0xB3,0xC9,0xE3,0xC9,0xE3,0xC9,0xE3,0xE7,0xEB,0x66,0xEB,0x66,0xEB,0x45,0xDB,0x28,0xF4,0xCB,0xFC,0x28,0xF4,0xE7,0xF3,0xE7,0xF3,0x04,0xDB,0xC3,0xCA,
-	0xC3,0xCA,0x02,0xE3,0x03,0xDB,0xC3,0xCA,0xC3,0xBA,0xC3,0xBA,0x82,0xBA,0x82,0xBA,0xC2,0xD2,0xC2,0xD2,0x82,0xC2,0x82,0xCA,0x02,0xE3,0xE2,0xE2,0xA1,0xD2,0x02,0xE3,0xC4,0xFB,0x22,0xEB,0xE2,0xE2,0xA1,0xD2,0x82,0xCA,0x82,0xCA,0xC1,0xDA,0xC1,0xDA,0x82,0xCA,0xA1,0xD2,0x22,0xEB,0x66,0xFC,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x42,0xF3,
-	0x22,0xEB,0xC4,0xFB,0x63,0xF3,0xC1,0xDA,0xC1,0xDA,0xC1,0xDA,0x42,0xF3,0xC8,0xFC,0x66,0xFC,0xC4,0xFB,0x42,0xF3,0xA2,0xD2,0xE2,0xDA,0x03,0xDB,0x05,0xFC,0x85,0xEB,0x23,0xEB,0xA2,0xD2,0x43,0xB2,0x03,0x82,0x03,0x8A,0x03,0x8A,0x23,0x92,0x23,0x92,0x22,0xA2,0x03,0x8A,0xE3,0x79,0x23,0x92,0x03,0x8A,0x03,0x82,0x03,0x82,0x24,0xA2,
-	0x23,0x9A,0x24,0xA2,0x24,0xEB,0x24,0xEB,0x04,0xDB,0xE3,0xD2,0xC4,0xDA,0xA4,0xCA,0xA4,0xCA,0x04,0xCB,0x24,0x9A,0x03,0x8A,0x03,0x8A,0x23,0x92,0x03,0x8A,0x23,0x8A,0x03,0x8A,0xE3,0x81,0xE3,0x81,0x03,0x8A,0x23,0x9A,0x24,0xA2,0x64,0xBA,0x04,0xDB,0x64,0xF3,0x44,0xE3,0xC4,0xDA,0x04,0xDB,0xC3,0xDA,0xE3,0xD2,0xC3,0xDA,0x24,0xEB,
-	0xC2,0x79,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0x64,0x92,0x64,0x9A,0x23,0x92,0x64,0x9A,0x43,0x92,0x03,0x82,0xE3,0x81,0x03,0x82,0x23,0x8A,0x23,0x8A,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x87,0xC3,0x66,0xC3,0x46,0xC3,0x05,0xBB,0x25,0xBB,0x26,0xBB,0x25,0xBB,0x46,0xBB,0x46,0xBB,
-	0x05,0xB3,0x05,0xB3,0x46,0xBB,0x87,0xCB,0xC7,0xD3,0xA7,0xD3,0x66,0xCB,0x46,0xC3,0x87,0xCB,0x87,0xCB,0x05,0xBB,0x05,0xB3,0x87,0xC3,0xC7,0xD3,0xC7,0xD3,0x66,0xCB,0x66,0xC3,0x26,0xBB,0xA4,0xA2,0x43,0x92,0x64,0x9A,0xC5,0xAA,0xA5,0xA2,0x64,0x9A,0x43,0x92,0x84,0x9A,0xA4,0xA2,0xC5,0xAA,0x84,0xA2,0xA4,0xA2,0x06,0xB3,0x05,0xB3,
-	0xC4,0xAA,0x26,0xBB,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x46,0xC3,0xA7,0xD3,0xA8,0xCB,0x87,0xCB,0x66,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x87,0xC3,0x66,0xC3,0x46,0xC3,0x25,0xBB,0xE5,0xB2,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x43,0x92,0x43,0x92,0x64,0x92,0x64,0x9A,0xA5,0xA2,
-	0xE5,0xAA,0xA4,0xAA,0x84,0x9A,0x44,0x8A,0x44,0x8A,0x03,0x82,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0xE5,0xB2,0x46,0xBB,0x25,0xBB,0x05,0xBB,0x26,0xBB,0x46,0xBB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x46,0xC3,0x87,0xCB,0x66,0xC3,0xE5,0xAA,0xA4,0xA2,0xC5,0xAA,0x05,0xB3,0x05,0xB3,
-	0xC5,0xAA,0xAD,0xEC,0xA7,0xDB,0xC9,0xE3,0xE7,0xEB,0xC9,0xE3,0xA6,0xF3,0x66,0xEB,0x45,0xDB,0x4A,0xFC,0x28,0xF4,0x28,0xF4,0x28,0xF4,0x66,0xEB,0xE3,0xD2,0xC3,0xCA,0x03,0xDB,0x02,0xE3,0x03,0xDB,0xC3,0xCA,0xC3,0xBA,0x82,0xBA,0x82,0xBA,0xC2,0xD2,0xC1,0xDA,0xC1,0xDA,0xA1,0xD2,0x82,0xCA,0x82,0xC2,0xC1,0xDA,0xC1,0xDA,0xA1,0xD2,
-	0xC1,0xDA,0xA1,0xD2,0xA1,0xD2,0xC1,0xDA,0x82,0xCA,0x82,0xC2,0xA1,0xD2,0x82,0xCA,0xA1,0xD2,0xA1,0xD2,0xE2,0xE2,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x66,0xFC,0x05,0xFC,0x42,0xF3,0xE2,0xE2,0xC1,0xDA,0xA1,0xD2,0x82,0xCA,0x82,0xCA,0xA1,0xD2,0x82,0xCA,0xE2,0xE2,0x23,0xEB,0xA2,0xD2,0xA2,0xD2,0x22,0xEB,0x63,0xF3,0x05,0xFC,0x82,0xCA,
-	0x22,0xEB,0xE2,0xE2,0x43,0xAA,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x82,0xBA,0x43,0xAA,0x23,0x92,0x03,0x8A,0xE3,0x81,0x03,0x82,0x23,0x92,0x03,0x8A,0x03,0x82,0x22,0xA2,0x23,0x9A,0x03,0x8A,0xA4,0xCA,0x66,0xEB,0x66,0xEB,0x24,0xEB,0x04,0xDB,0x04,0xDB,0xA4,0xCA,0xA5,0xC2,0x64,0xC2,0x24,0xA2,0x03,0x8A,0x24,0x92,0x03,0x82,0x03,0x8A,
-	0xE3,0x81,0x03,0x82,0xE3,0x79,0x03,0x8A,0x23,0x92,0x23,0x9A,0x64,0xBA,0xC4,0xDA,0xE4,0xE2,0x24,0xEB,0xA3,0xD2,0xC4,0xDA,0xC4,0xDA,0xE3,0xD2,0xA4,0xCA,0xE4,0xE2,0x22,0xA2,0xE3,0x79,0xE3,0x79,0xE3,0x81,0xE3,0x79,0xE3,0x79,0x03,0x8A,0x23,0x8A,0x02,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x82,
-	0x66,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xBB,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xBB,0x46,0xC3,0x46,0xC3,0x46,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xBB,0x05,0xB3,0x05,0xB3,0x26,0xBB,0xA7,0xD3,0xC7,0xD3,0x87,0xCB,0x46,0xC3,0x46,0xC3,0xA8,0xCB,0xA7,0xD3,0x05,0xBB,0xC4,0xB2,0x46,0xBB,0x87,0xCB,0xC7,0xD3,0xC7,0xD3,
-	0x66,0xCB,0x05,0xB3,0x84,0xA2,0xA4,0xA2,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0x9A,0x43,0x92,0x64,0x9A,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x06,0xB3,0xC5,0xAA,0x05,0xB3,0x05,0xB3,0x66,0xC3,0x87,0xCB,0x46,0xC3,0x87,0xCB,0xA8,0xCB,0xA8,0xCB,0x66,0xCB,0x25,0xC3,0x66,0xCB,0x87,0xCB,0x87,0xCB,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x46,0xC3,
-	0x66,0xC3,0x87,0xC3,0x46,0xC3,0x26,0xBB,0xE5,0xB2,0xC4,0xAA,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0xA4,0xA2,0xE5,0xAA,0xA4,0xAA,0x63,0x9A,0x64,0x92,0x23,0x92,0xE3,0x79,0xA2,0x71,0xE3,0x79,0xE3,0x79,0xE3,0x81,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x9A,0xA4,0xAA,0x05,0xB3,
-	0xE5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC4,0xAA,0xE5,0xB2,0x46,0xC3,0x87,0xCB,0x66,0xCB,0x66,0xCB,0x46,0xC3,0x05,0xBB,0x05,0xB3,0xE5,0xB2,0xE5,0xB2,0x25,0xBB,0x46,0xBB,0x69,0xB3,0x2A,0xEC,0xC9,0xE3,0x66,0xEB,0xE7,0xEB,0xA6,0xF3,0x66,0xEB,0xA6,0xF3,0x66,0xEB,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0xE7,0xEB,0x85,0xEB,0xC3,0xBA,0xC3,0xCA,
-	0x02,0xE3,0x63,0xEB,0xE2,0xDA,0xC2,0xD2,0xC2,0xD2,0xC2,0xD2,0xE2,0xDA,0xC2,0xD2,0xC2,0xD2,0xE2,0xDA,0xA1,0xD2,0x82,0xC2,0x82,0xC2,0xE2,0xE2,0xC1,0xDA,0x82,0xCA,0xA1,0xD2,0xC1,0xDA,0xC1,0xDA,0xC1,0xDA,0x82,0xCA,0xA1,0xD2,0xC1,0xDA,0xA1,0xD2,0xA1,0xD2,0xC1,0xDA,0xC4,0xFB,0x05,0xFC,0x66,0xFC,0xC8,0xFC,0xC4,0xFB,0x63,0xF3,
-	0xE2,0xE2,0xC1,0xDA,0xC1,0xDA,0xA2,0xDA,0x82,0xCA,0x82,0xCA,0x82,0xBA,0x82,0xC2,0xC1,0xDA,0xE2,0xE2,0x82,0xCA,0xC2,0xD2,0x85,0xEB,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0x63,0xEB,0x23,0xEB,0xE2,0xDA,0x43,0xB2,0x23,0x9A,0x23,0x92,0x22,0xA2,0x23,0x9A,0x23,0x92,0x03,0x82,0x03,0x8A,0x03,0x8A,0x03,0x8A,0xE3,0x79,0x03,0x8A,0x03,0x8A,
-	0x03,0x8A,0x23,0x92,0x04,0xCB,0xA6,0xF3,0xC4,0xDA,0x04,0xDB,0x84,0xD2,0x04,0xDB,0xA4,0xCA,0xA4,0xCA,0xA4,0xCA,0xC4,0xDA,0x83,0xB2,0x24,0x92,0x03,0x8A,0xE3,0x79,0x03,0x8A,0x03,0x82,0xE3,0x81,0x23,0x8A,0x23,0x92,0x24,0xA2,0x43,0xB2,0x64,0xC2,0xE4,0xE2,0xC4,0xDA,0xA4,0xCA,0xE3,0xD2,0xA4,0xCA,0x84,0xD2,0xA4,0xCA,0xC3,0xDA,
-	0xA3,0xD2,0xE3,0x79,0xC2,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xE3,0x79,0x03,0x82,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x46,0xC3,0x25,0xC3,0x46,0xBB,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x87,0xC3,0x87,0xC3,0x46,0xC3,0x25,0xBB,0x25,0xBB,0x25,0xBB,
-	0xE5,0xAA,0xE5,0xB2,0x46,0xBB,0xA7,0xD3,0x66,0xCB,0x66,0xC3,0x66,0xC3,0x25,0xC3,0x66,0xCB,0x87,0xCB,0x25,0xBB,0x05,0xB3,0x26,0xBB,0xA7,0xD3,0xC7,0xD3,0x08,0xDC,0x87,0xCB,0x05,0xB3,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x43,0x92,0x64,0x92,0xA5,0xA2,0x05,0xAB,0xE5,0xB2,0xE5,0xAA,0xA4,0xAA,0xE5,0xAA,
-	0x66,0xC3,0xA7,0xD3,0x87,0xCB,0x87,0xCB,0x87,0xCB,0xA8,0xCB,0x66,0xCB,0x46,0xC3,0x46,0xC3,0x87,0xCB,0x66,0xCB,0x46,0xC3,0x25,0xBB,0x46,0xC3,0x87,0xC3,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x05,0xB3,0xC4,0xAA,0xC4,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x23,0x92,0x23,0x8A,0x64,0x9A,0xA4,0xA2,
-	0xE5,0xAA,0xE5,0xAA,0xC5,0xA2,0xA5,0x9A,0x23,0x92,0xE3,0x79,0xA2,0x71,0xA2,0x71,0xE3,0x79,0x03,0x82,0x03,0x82,0x03,0x82,0x23,0x8A,0x64,0x92,0x84,0x9A,0xA4,0xAA,0xE5,0xAA,0xE5,0xAA,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xE5,0xB2,0x66,0xCB,0x87,0xCB,0x87,0xCB,0x46,0xC3,0x05,0xB3,0x25,0xBB,0x05,0xBB,0x26,0xBB,0x05,0xB3,0xC4,0xB2,
-	0x69,0xB3,0x2A,0xEC,0x66,0xEB,0xC9,0xE3,0xA6,0xF3,0xA6,0xF3,0x66,0xEB,0xE7,0xF3,0xA6,0xF3,0xA6,0xF3,0xE7,0xF3,0x66,0xEB,0x24,0xEB,0x85,0xEB,0xC3,0xCA,0xC2,0xD2,0x02,0xE3,0x02,0xE3,0x02,0xE3,0xC2,0xD2,0x02,0xE3,0xC2,0xD2,0xC2,0xD2,0xE2,0xE2,0xE2,0xDA,0xC1,0xDA,0xC1,0xDA,0xA1,0xD2,0x82,0xBA,0xA1,0xD2,0xE2,0xE2,0xA1,0xD2,
-	0xA1,0xD2,0xC1,0xDA,0xC1,0xDA,0xE2,0xE2,0xC1,0xDA,0xE2,0xE2,0xE2,0xE2,0xA1,0xD2,0xC1,0xDA,0xE2,0xE2,0x66,0xFC,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x22,0xEB,0xC1,0xDA,0xC1,0xDA,0xE2,0xE2,0xE2,0xDA,0xA1,0xD2,0x82,0xC2,0x43,0xB2,0x43,0xB2,0x82,0xBA,0xA2,0xD2,0xA2,0xDA,0xA2,0xD2,0x85,0xEB,0x66,0xFC,0x63,0xF3,0x05,0xFC,
-	0x05,0xFC,0x23,0xEB,0xE2,0xE2,0x82,0xCA,0x43,0xB2,0x23,0x9A,0x23,0x9A,0x03,0x82,0x23,0x8A,0xE3,0x81,0x03,0x8A,0x22,0xA2,0x23,0x92,0x03,0x8A,0x03,0x82,0x23,0x92,0x03,0x8A,0x23,0x9A,0xA4,0xCA,0x45,0xDB,0x04,0xCB,0xA4,0xCA,0x84,0xD2,0x04,0xCB,0xA5,0xC2,0xA4,0xCA,0xA5,0xC2,0x44,0xAA,0x24,0x9A,0x24,0x9A,0x03,0x8A,0x03,0x8A,
-	0xE3,0x81,0x03,0x82,0x03,0x8A,0x03,0x8A,0x23,0x9A,0x24,0xA2,0x24,0xA2,0x83,0xB2,0x64,0xBA,0x64,0xC2,0x64,0xBA,0xE3,0xD2,0xA4,0xCA,0xA4,0xCA,0xA3,0xD2,0xE3,0xD2,0xC4,0xDA,0xE3,0x81,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x81,0xE3,0x79,0xE3,0x81,0x03,0x82,0x03,0x8A,0x23,0x8A,
-	0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xBB,0x46,0xBB,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x87,0xC3,0x66,0xC3,0x66,0xCB,0x46,0xC3,0x46,0xBB,0x46,0xC3,0x25,0xBB,0x05,0xB3,0x05,0xB3,0x46,0xC3,0x46,0xC3,0x05,0xBB,0x66,0xC3,0x66,0xC3,0x25,0xC3,0x46,0xC3,0x87,0xCB,0x66,0xC3,0x26,0xBB,0xA8,0xCB,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,
-	0xA7,0xD3,0x46,0xBB,0xE5,0xAA,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0x43,0x92,0x64,0x92,0x26,0xBB,0x46,0xBB,0xA4,0xAA,0x26,0xBB,0x46,0xBB,0xE5,0xB2,0x46,0xBB,0xC7,0xD3,0xA7,0xD3,0xA7,0xD3,0x87,0xCB,0x46,0xC3,0x46,0xC3,0x87,0xC3,0x87,0xCB,0x46,0xC3,0x66,0xC3,0x46,0xBB,0x26,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xC3,
-	0x46,0xC3,0x46,0xC3,0x87,0xC3,0x66,0xCB,0x26,0xBB,0x05,0xB3,0xE5,0xB2,0xE5,0xAA,0xA4,0xA2,0x64,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0xA4,0xA2,0xC5,0xAA,0x05,0xB3,0x26,0xBB,0xE5,0xAA,0x84,0x9A,0x03,0x82,0xA2,0x71,0xA2,0x71,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x44,0x8A,0x64,0x92,0x64,0x92,
-	0xA4,0xA2,0xE5,0xB2,0xE5,0xAA,0xA4,0xAA,0x84,0xA2,0xA5,0xAA,0xE5,0xB2,0x26,0xBB,0x26,0xBB,0x66,0xC3,0xA7,0xD3,0x46,0xC3,0xC4,0xAA,0x05,0xB3,0x26,0xBB,0xA4,0xAA,0x0C,0xE4,0xE7,0xF3,0xE7,0xEB,0xA6,0xF3,0xE7,0xF3,0x66,0xEB,0x66,0xEB,0xA6,0xF3,0xA6,0xF3,0x64,0xF3,0x64,0xF3,0x24,0xEB,0x24,0xEB,0x23,0xE3,0xC2,0xD2,0x03,0xDB,
-	0x02,0xE3,0x02,0xE3,0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0x23,0xE3,0x03,0xDB,0xC1,0xDA,0xA1,0xD2,0x02,0xE3,0xC1,0xDA,0x82,0xCA,0xA1,0xD2,0xE2,0xE2,0xC1,0xDA,0xA1,0xD2,0xC1,0xDA,0xC1,0xDA,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0x42,0xF3,0xA1,0xD2,0x42,0xF3,0x05,0xFC,0xC8,0xFC,0x05,0xFC,0xC4,0xFB,0x05,0xFC,0x05,0xFC,0x42,0xF3,
-	0xE2,0xDA,0xE2,0xE2,0xE2,0xE2,0xA2,0xD2,0xA2,0xD2,0x82,0xCA,0x43,0xB2,0x22,0xA2,0x23,0x92,0x43,0xB2,0xE2,0xDA,0xE2,0xE2,0x23,0xEB,0x05,0xFC,0xC4,0xFB,0xA4,0xF3,0x05,0xFC,0x64,0xF3,0x02,0xE3,0xC3,0xDA,0xC3,0xCA,0x43,0xAA,0x23,0x92,0xE3,0x81,0xE3,0x79,0x03,0x8A,0x03,0x82,0x03,0x8A,0x23,0x9A,0x02,0x8A,0x03,0x82,0x03,0x8A,
-	0x03,0x8A,0x23,0x92,0xA4,0xCA,0x44,0xE3,0xC4,0xDA,0xC4,0xDA,0xE3,0xD2,0xA4,0xCA,0x64,0xC2,0xA4,0xCA,0x64,0xBA,0x83,0xB2,0x64,0x9A,0x23,0x9A,0x23,0x92,0x24,0x92,0x03,0x82,0x03,0x82,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x9A,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x64,0xBA,0x64,0xBA,0xA4,0xCA,0x64,0xC2,0x64,0xBA,0xA4,0xCA,0xE3,0xD2,
-	0xE4,0xE2,0x03,0x82,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xE3,0x79,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x8A,0x23,0x8A,0x46,0xC3,0x46,0xBB,0x46,0xC3,0x25,0xBB,0x46,0xC3,0x46,0xC3,0x46,0xBB,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x66,0xCB,0x87,0xC3,0x87,0xC3,0x66,0xC3,0x26,0xBB,
-	0x05,0xB3,0xE5,0xB2,0x25,0xBB,0x26,0xBB,0x46,0xBB,0x87,0xC3,0x66,0xC3,0x46,0xC3,0x25,0xBB,0x25,0xBB,0x66,0xCB,0x46,0xC3,0x66,0xCB,0x87,0xCB,0xA8,0xCB,0xC7,0xD3,0x87,0xCB,0x66,0xC3,0x25,0xBB,0x05,0xB3,0x26,0xBB,0xE5,0xAA,0xE5,0xAA,0x46,0xBB,0xC5,0xA2,0x64,0x9A,0x26,0xBB,0x46,0xBB,0xE5,0xB2,0x87,0xC3,0x26,0xBB,0x25,0xBB,
-	0x87,0xC3,0xA8,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x46,0xBB,0x46,0xC3,0xA8,0xCB,0x87,0xCB,0x66,0xC3,0x66,0xC3,0x26,0xBB,0x05,0xBB,0x25,0xBB,0x26,0xBB,0x25,0xBB,0x46,0xC3,0x66,0xC3,0x87,0xC3,0x66,0xC3,0x46,0xC3,0x25,0xBB,0x25,0xBB,0x05,0xB3,0xC5,0xAA,0xA4,0xA2,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0xA2,0x84,0x9A,0x84,0x9A,
-	0xA4,0xA2,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xA4,0xAA,0x23,0x8A,0xA2,0x71,0x82,0x61,0xA2,0x69,0xA3,0x71,0xA2,0x71,0xC2,0x71,0xC2,0x79,0xE3,0x81,0x03,0x8A,0x03,0x8A,0x64,0x92,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xAA,0xC5,0xAA,0xE5,0xAA,0x05,0xB3,0x66,0xCB,0xC7,0xD3,0x87,0xCB,0xE5,0xB2,0x05,0xBB,0x66,0xC3,0x66,0xC3,
-	0xAD,0xEC,0xE7,0xF3,0xA6,0xF3,0xA6,0xF3,0xE7,0xF3,0x66,0xEB,0x66,0xEB,0xE7,0xF3,0x64,0xF3,0x64,0xF3,0x24,0xEB,0x44,0xE3,0x44,0xE3,0x64,0xF3,0x23,0xE3,0x02,0xE3,0x63,0xEB,0x02,0xE3,0x02,0xE3,0xC2,0xD2,0xC2,0xD2,0xE2,0xDA,0x02,0xE3,0x02,0xE3,0xA2,0xD2,0xA1,0xD2,0x02,0xE3,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0x42,0xF3,
-	0xC1,0xDA,0xC1,0xDA,0x22,0xEB,0x22,0xEB,0x22,0xEB,0xC4,0xFB,0x63,0xF3,0xE2,0xE2,0x42,0xF3,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x02,0xE3,0x02,0xE3,0xA2,0xDA,0x82,0xCA,0x82,0xBA,0x82,0xC2,0x82,0xCA,0x43,0xB2,0x43,0xB2,0x82,0xCA,0xE2,0xDA,0xE2,0xDA,0x23,0xEB,0x42,0xF3,0x05,0xFC,0x05,0xFC,
-	0xA4,0xF3,0x64,0xF3,0x23,0xEB,0x03,0xDB,0xC3,0xCA,0x82,0xBA,0x82,0xBA,0x43,0xB2,0x23,0x9A,0x03,0x82,0x03,0x8A,0x03,0x82,0x03,0x8A,0x03,0x8A,0x22,0xA2,0x03,0x8A,0x23,0x92,0xE3,0x81,0x44,0xAA,0xC3,0xDA,0xC4,0xDA,0xE3,0xD2,0xA4,0xCA,0xE3,0xD2,0x04,0xDB,0x04,0xCB,0x64,0xBA,0xA4,0xCA,0xA5,0xC2,0x44,0x9A,0x24,0x92,0x64,0xBA,
-	0x84,0xA2,0xE3,0x81,0x24,0x92,0x23,0x8A,0x23,0x8A,0x44,0x9A,0x44,0x9A,0x84,0xA2,0x64,0xB2,0x64,0xBA,0x64,0xBA,0x83,0xB2,0xA5,0xC2,0x64,0xBA,0x64,0xBA,0xE3,0xD2,0x04,0xDB,0x44,0x9A,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE2,0x81,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xE2,0x81,0x03,0x8A,
-	0x25,0xBB,0x26,0xBB,0x46,0xBB,0x25,0xBB,0x25,0xC3,0x46,0xBB,0x05,0xBB,0x46,0xBB,0x46,0xBB,0x46,0xC3,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x46,0xC3,0x25,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x46,0xBB,0xA8,0xCB,0x87,0xCB,0x46,0xC3,0x25,0xBB,0x46,0xBB,0x87,0xC3,0x46,0xC3,0x25,0xC3,0x66,0xC3,0xA7,0xD3,0xA7,0xD3,
-	0x87,0xCB,0x46,0xC3,0x66,0xC3,0x66,0xCB,0x87,0xC3,0x05,0xB3,0x05,0xB3,0xA8,0xCB,0x66,0xC3,0x05,0xB3,0x25,0xBB,0x46,0xBB,0x46,0xC3,0x87,0xCB,0x66,0xC3,0x66,0xC3,0x66,0xCB,0x66,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x66,0xCB,0x87,0xCB,0x66,0xC3,0x46,0xBB,0x46,0xC3,0x46,0xBB,0x66,0xC3,0x46,0xBB,0x46,0xBB,
-	0x26,0xBB,0x46,0xC3,0x87,0xC3,0x66,0xC3,0x46,0xBB,0x05,0xB3,0x05,0xB3,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0xA5,0x9A,0xA5,0x9A,0xC5,0xAA,0x05,0xB3,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x23,0x8A,0xC3,0x71,0x82,0x61,0x82,0x69,0xA3,0x71,0xA2,0x71,0x82,0x69,0x82,0x69,0xA3,0x71,0xC2,0x79,0xE3,0x79,
-	0x03,0x82,0x03,0x8A,0x23,0x8A,0x64,0x92,0x84,0xA2,0xA4,0xA2,0xC5,0xAA,0x06,0xB3,0x66,0xC3,0x66,0xCB,0xA8,0xCB,0x87,0xCB,0x87,0xCB,0x87,0xCB,0xA8,0xCB,0x87,0xCB,0xAD,0xEC,0xA6,0xF3,0xA6,0xF3,0xE7,0xF3,0xA6,0xF3,0x66,0xEB,0x66,0xEB,0xA6,0xF3,0xA6,0xF3,0x24,0xEB,0x24,0xEB,0x24,0xEB,0x85,0xEB,0x63,0xF3,0xA4,0xF3,0x03,0xDB,
-	0x63,0xEB,0x42,0xF3,0x23,0xEB,0xC1,0xDA,0xC2,0xD2,0xC2,0xD2,0xE2,0xDA,0x42,0xF3,0xE2,0xDA,0xE2,0xE2,0xE2,0xE2,0xC1,0xDA,0x02,0xE3,0x42,0xF3,0xC1,0xDA,0x02,0xE3,0x22,0xEB,0xE2,0xE2,0x42,0xF3,0x42,0xF3,0x42,0xF3,0x63,0xF3,0x63,0xF3,0x42,0xF3,0x05,0xFC,0x05,0xFC,0xC4,0xFB,0x05,0xFC,0xC4,0xFB,0x42,0xF3,0x22,0xEB,0x42,0xF3,
-	0x42,0xF3,0xA1,0xD2,0xA2,0xDA,0xA2,0xD2,0x82,0xCA,0x82,0xCA,0xA1,0xD2,0xE2,0xDA,0xE2,0xDA,0xE2,0xE2,0x63,0xEB,0x63,0xF3,0xA4,0xF3,0xC4,0xFB,0x05,0xFC,0xA4,0xF3,0xA4,0xF3,0x64,0xF3,0x24,0xEB,0xA2,0xDA,0x44,0xE3,0x44,0xE3,0x82,0xCA,0x82,0xC2,0x82,0xBA,0x03,0x8A,0x23,0x92,0x22,0xA2,0x43,0xAA,0x43,0xAA,0x43,0xAA,0x23,0x92,
-	0x03,0x8A,0x23,0x92,0x43,0xAA,0xE3,0xD2,0xC3,0xDA,0x04,0xDB,0xA3,0xD2,0xC4,0xDA,0xE4,0xE2,0x66,0xEB,0x04,0xDB,0xC4,0xDA,0xA5,0xC2,0x64,0xB2,0x65,0xBA,0x84,0xA2,0x64,0xB2,0x24,0x9A,0x03,0x8A,0x24,0x92,0x24,0x92,0x24,0xA2,0x44,0x9A,0x24,0x92,0x84,0xA2,0x64,0xC2,0x44,0xB2,0x84,0xA2,0xC3,0xBA,0x64,0xBA,0x44,0xB2,0x64,0xC2,
-	0xC4,0xDA,0xA4,0xCA,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xE3,0x81,0xE3,0x81,0x03,0x82,0xE3,0x81,0xE3,0x79,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x81,0x05,0xBB,0x25,0xBB,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xBB,0x05,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xC3,0x25,0xC3,0x46,0xC3,0x46,0xBB,
-	0x46,0xBB,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x46,0xC3,0x66,0xC3,0x46,0xC3,0x46,0xC3,0xA8,0xCB,0x87,0xCB,0x66,0xC3,0x46,0xC3,0x46,0xC3,0xA8,0xCB,0xC7,0xD3,0x87,0xCB,0x87,0xCB,0x46,0xC3,0x87,0xCB,0xC7,0xD3,0xA8,0xCB,0x46,0xBB,0x25,0xBB,0x87,0xCB,0xA8,0xCB,0x87,0xCB,0x46,0xC3,0x87,0xC3,0x46,0xC3,0xA8,0xCB,0xC7,0xD3,0xA7,0xD3,
-	0x66,0xC3,0x05,0xBB,0x25,0xBB,0x66,0xC3,0x87,0xCB,0xA8,0xCB,0x87,0xC3,0x46,0xC3,0x87,0xCB,0x46,0xC3,0x66,0xC3,0x46,0xBB,0x46,0xC3,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x26,0xBB,0x46,0xC3,0x66,0xC3,0x87,0xC3,0x26,0xBB,0x05,0xB3,0xE5,0xAA,0xC4,0xAA,0xC4,0xA2,0x84,0x9A,0x64,0x9A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x9A,0x84,0xA2,
-	0xC5,0xA2,0xE5,0xAA,0xA4,0xAA,0xA4,0xAA,0x64,0x9A,0x03,0x82,0xE3,0x79,0xC3,0x69,0xA2,0x69,0xA2,0x71,0xC3,0x71,0xC2,0x71,0xA2,0x71,0xC2,0x71,0xC2,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0x23,0x8A,0x64,0x92,0x84,0x9A,0xA4,0xA2,0xA5,0xA2,0x26,0xBB,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x66,0xCB,0x66,0xCB,0x87,0xCB,0x25,0xC3,0x69,0xB3,
-	0x4A,0xFC,0xA6,0xF3,0xE7,0xF3,0xE7,0xF3,0xA6,0xF3,0x66,0xEB,0x66,0xEB,0xA6,0xF3,0xA6,0xF3,0x64,0xF3,0x66,0xEB,0x66,0xEB,0x64,0xF3,0x23,0xE3,0x02,0xE3,0x02,0xE3,0xC4,0xFB,0x63,0xF3,0x02,0xE3,0xE2,0xDA,0xC1,0xDA,0x82,0xCA,0xA1,0xD2,0xC1,0xDA,0xE2,0xE2,0x22,0xEB,0x22,0xEB,0x02,0xE3,0xC1,0xDA,0x63,0xEB,0xE2,0xE2,0xE2,0xDA,
-	0x63,0xEB,0x22,0xEB,0x22,0xEB,0x42,0xF3,0x42,0xF3,0x63,0xF3,0xC4,0xFB,0x66,0xFC,0x05,0xFC,0x22,0xEB,0x22,0xEB,0xC4,0xFB,0x63,0xEB,0xA1,0xD2,0x82,0xC2,0xA1,0xD2,0x42,0xF3,0x23,0xEB,0x23,0xEB,0xC4,0xFB,0x63,0xF3,0x23,0xEB,0xE2,0xE2,0x63,0xEB,0x63,0xEB,0x23,0xEB,0x23,0xEB,0x63,0xEB,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,
-	0x05,0xFC,0x64,0xF3,0x23,0xEB,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xC3,0xDA,0x82,0xBA,0x43,0xB2,0xC3,0xCA,0xC3,0xCA,0x82,0xCA,0xE4,0xE2,0xE2,0xE2,0x43,0xB2,0x43,0xB2,0x23,0x92,0x43,0xAA,0x82,0xBA,0x82,0xC2,0xA3,0xDA,0xC4,0xDA,0xA3,0xD2,0xE3,0xD2,0xE4,0xE2,0x66,0xEB,0x04,0xDB,0x04,0xDB,0x45,0xDB,0xA4,0xCA,0x04,0xCB,0x44,0x9A,
-	0x24,0x92,0x24,0x92,0x44,0xAA,0x44,0x9A,0x44,0xAA,0x44,0xAA,0x24,0xA2,0x23,0x8A,0x44,0x9A,0x64,0xBA,0x84,0xA2,0xA5,0xA2,0x64,0xB2,0x83,0xB2,0x44,0xAA,0x64,0xBA,0xE3,0xD2,0xC4,0xDA,0xC2,0x79,0xC2,0x79,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x81,0x03,0x82,0x23,0x8A,0x03,0x82,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,
-	0x05,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x26,0xBB,0x26,0xBB,0x25,0xBB,0x25,0xBB,0x26,0xBB,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x26,0xBB,0x25,0xBB,0x26,0xBB,0x46,0xBB,0x66,0xC3,0x46,0xC3,0x46,0xBB,0x87,0xC3,0xA8,0xCB,0x87,0xC3,0x66,0xC3,0x46,0xBB,0x87,0xCB,0xA8,0xCB,0xA8,0xCB,0xA8,0xCB,
-	0x87,0xCB,0x66,0xC3,0x87,0xC3,0x87,0xC3,0x46,0xC3,0x05,0xBB,0x25,0xBB,0x87,0xCB,0xA8,0xCB,0x87,0xCB,0xA8,0xCB,0x87,0xCB,0x66,0xC3,0x87,0xCB,0xC7,0xD3,0xA7,0xD3,0x66,0xC3,0x26,0xBB,0x46,0xC3,0xA8,0xCB,0x87,0xC3,0x66,0xC3,0x46,0xC3,0x25,0xC3,0x66,0xC3,0x87,0xC3,0x25,0xBB,0x05,0xBB,0x25,0xBB,0x25,0xBB,0x05,0xB3,0x05,0xBB,
-	0x25,0xBB,0x46,0xBB,0x66,0xC3,0x25,0xBB,0x25,0xBB,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x64,0x9A,0x23,0x8A,0x03,0x82,0x23,0x8A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0x64,0x9A,0x64,0x92,0x23,0x8A,0xC2,0x79,0xC2,0x71,0xA2,0x71,0xC2,0x71,0xE3,0x79,0x03,0x82,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,
-	0xE3,0x79,0xC2,0x79,0xE3,0x81,0x23,0x8A,0x64,0x92,0x64,0x92,0x64,0x9A,0xC5,0xAA,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x87,0xC3,0x66,0xC3,0x25,0xBB,0x69,0xB3,0x4A,0xFC,0xA6,0xF3,0xA6,0xF3,0xE7,0xF3,0x66,0xEB,0xC7,0xE3,0x66,0xEB,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0x23,0xEB,0x23,0xEB,0x23,0xE3,0xE2,0xDA,0x63,0xEB,
-	0x42,0xF3,0x22,0xEB,0xE2,0xDA,0x02,0xE3,0x02,0xE3,0xC1,0xDA,0xA1,0xD2,0x82,0xCA,0x22,0xEB,0x42,0xF3,0x02,0xE3,0xE2,0xDA,0x66,0xFC,0x03,0xDB,0x02,0xE3,0x02,0xE3,0xA4,0xF3,0x42,0xF3,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x05,0xFC,0x05,0xFC,0x63,0xF3,0x42,0xF3,0x42,0xF3,0x42,0xF3,0x22,0xEB,0xE2,0xE2,0x82,0xBA,0x43,0xAA,0x82,0xCA,
-	0xE2,0xE2,0x63,0xF3,0x05,0xFC,0x05,0xFC,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0xC4,0xFB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x05,0xFC,0x66,0xFC,0x28,0xF4,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0xA4,0xF3,0xA4,0xF3,0x64,0xF3,0x23,0xEB,0xE2,0xE2,0x23,0xEB,0xE3,0xD2,0xE2,0xE2,0x23,0xEB,0x23,0xEB,0x23,0xE3,0x23,0xEB,0x23,0xEB,0xE4,0xE2,0x43,0xB2,
-	0x23,0x9A,0x24,0xA2,0x43,0xB2,0x24,0xA2,0xA3,0xD2,0xA3,0xDA,0xA3,0xDA,0x64,0xC2,0xA3,0xD2,0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0xC4,0xDA,0x04,0xDB,0x45,0xDB,0x65,0xBA,0x44,0xAA,0x44,0xAA,0xA5,0xC2,0x64,0xBA,0xA5,0xC2,0xA5,0xC2,0x64,0xB2,0x64,0x92,0x44,0x9A,0x64,0xBA,0x84,0xA2,0x84,0x9A,0x84,0xA2,0x44,0xB2,0x44,0xB2,0x64,0xBA,
-	0xA4,0xCA,0x84,0xD2,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x81,0xE2,0x81,0x03,0x8A,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x71,0x46,0xBB,0x46,0xBB,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x26,0xBB,0x05,0xB3,0x25,0xBB,0x26,0xBB,0x26,0xBB,0x05,0xBB,0x05,0xB3,0x25,0xBB,0x05,0xB3,0x46,0xBB,0x46,0xBB,
-	0x25,0xBB,0x25,0xBB,0x46,0xBB,0x66,0xC3,0x46,0xBB,0x25,0xBB,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x87,0xC3,0x46,0xC3,0x66,0xC3,0x66,0xCB,0x66,0xC3,0x87,0xCB,0x87,0xCB,0x87,0xCB,0x46,0xC3,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x66,0xC3,0x46,0xC3,0x87,0xCB,0x87,0xCB,0x66,0xC3,0x66,0xC3,0x66,0xCB,0x87,0xCB,0x66,0xC3,0x66,0xC3,
-	0x66,0xC3,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x25,0xBB,0x26,0xBB,0x46,0xBB,0x25,0xBB,0x66,0xC3,0x25,0xBB,0x05,0xB3,0x25,0xBB,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x25,0xBB,0x46,0xBB,0x25,0xBB,0x05,0xB3,0x25,0xBB,0x25,0xBB,0xE5,0xAA,0xC4,0xA2,0xC5,0xAA,0x84,0x9A,0x64,0x92,0x23,0x8A,0x23,0x92,0x64,0x9A,0x64,0x92,
-	0x43,0x92,0x64,0x92,0xA5,0x9A,0x84,0x9A,0x43,0x92,0x23,0x8A,0xE3,0x81,0xE3,0x79,0xC2,0x79,0xC2,0x71,0xE3,0x79,0x03,0x82,0x03,0x82,0xE3,0x79,0xC2,0x79,0xA2,0x71,0xC2,0x79,0xC2,0x79,0xC2,0x79,0x03,0x82,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x84,0x9A,0x05,0xB3,0x46,0xC3,0x26,0xBB,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x0C,0xE4,
-	0xE7,0xF3,0xA6,0xF3,0xE7,0xF3,0xA6,0xF3,0x66,0xEB,0x66,0xEB,0x66,0xEB,0xA6,0xF3,0x66,0xEB,0xA4,0xF3,0x64,0xF3,0x64,0xF3,0x85,0xEB,0x24,0xEB,0x02,0xE3,0x22,0xEB,0x22,0xEB,0xE2,0xDA,0xA1,0xD2,0xC1,0xDA,0xE2,0xDA,0x63,0xF3,0xE2,0xE2,0xA1,0xD2,0xC1,0xDA,0x42,0xF3,0xC1,0xDA,0xA1,0xD2,0x63,0xEB,0xE2,0xDA,0x63,0xF3,0x23,0xEB,
-	0x63,0xF3,0xC4,0xFB,0x05,0xFC,0xC4,0xFB,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0xC4,0xFB,0x63,0xF3,0xC4,0xFB,0x42,0xF3,0xE2,0xE2,0xE2,0xE2,0x82,0xCA,0x82,0xBA,0xA2,0xDA,0x63,0xEB,0x05,0xFC,0x05,0xFC,0x66,0xFC,0xC8,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0xA4,0xF3,0x05,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,
-	0x66,0xFC,0xE7,0xF3,0xA4,0xF3,0xA4,0xF3,0xA4,0xF3,0x64,0xF3,0x23,0xEB,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0xA3,0xD2,0x22,0xA2,0x23,0x9A,0x43,0xAA,0x22,0xA2,0x24,0xA2,0x43,0xB2,0xA3,0xD2,0xA3,0xD2,0xC3,0xDA,0xA3,0xD2,0xC4,0xDA,0x64,0xC2,0x64,0xC2,0xA4,0xCA,0x04,0xDB,0x45,0xCB,0x65,0xBA,
-	0xA5,0xC2,0x64,0xBA,0x64,0xB2,0x65,0xBA,0x65,0xBA,0x04,0xCB,0xC5,0xAA,0x84,0xA2,0x64,0x9A,0x84,0xA2,0x64,0xB2,0x83,0xB2,0x83,0xB2,0x64,0xBA,0x64,0xBA,0x64,0xBA,0xA4,0xCA,0x04,0xDB,0x23,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x79,0xC2,0x79,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xE3,0x81,0x03,0x82,0xE3,0x79,0xC2,0x79,
-	0x25,0xBB,0x46,0xBB,0x87,0xC3,0x87,0xC3,0x46,0xBB,0x26,0xBB,0x05,0xBB,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x25,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x46,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x46,0xBB,0x66,0xC3,0x46,0xBB,0x46,0xC3,0x66,0xC3,0x25,0xBB,0x46,0xC3,0x66,0xC3,
-	0x87,0xC3,0x66,0xC3,0x46,0xC3,0x26,0xBB,0x05,0xB3,0x25,0xC3,0x46,0xBB,0x66,0xC3,0x66,0xC3,0x87,0xC3,0x46,0xC3,0x46,0xC3,0x87,0xCB,0xA8,0xCB,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x87,0xC3,0x66,0xC3,0x05,0xBB,0x25,0xBB,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x26,0xBB,0x46,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,
-	0xE5,0xB2,0x05,0xB3,0x05,0xB3,0x46,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0x64,0x92,0x64,0x92,0xA5,0x9A,0x64,0x9A,0x23,0x92,0x64,0x92,0xA5,0xA2,0xC5,0xA2,0xA4,0xA2,0x64,0x9A,0x23,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x81,0x03,0x82,0x03,0x82,0xC2,0x79,0xC2,0x71,0xA2,0x71,
-	0xA2,0x71,0xA2,0x71,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0xA5,0x9A,0x26,0xBB,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x25,0xC3,0xAD,0xEC,0xE7,0xF3,0xE7,0xF3,0xE7,0xF3,0x66,0xEB,0x64,0xF3,0x66,0xEB,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0xA4,0xF3,0xE7,0xF3,0x64,0xF3,0xA6,0xF3,0x63,0xEB,0x22,0xEB,0x22,0xEB,
-	0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0xC1,0xDA,0xE2,0xDA,0x66,0xFC,0xC4,0xFB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x63,0xEB,0x23,0xEB,0x02,0xE3,0x02,0xE3,0x63,0xF3,0x23,0xEB,0x63,0xF3,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x63,0xF3,0x42,0xF3,0x02,0xE3,0xA1,0xD2,0xA2,0xD2,0x63,0xF3,
-	0x05,0xFC,0x05,0xFC,0xC4,0xFB,0x05,0xFC,0x66,0xFC,0x05,0xFC,0xA4,0xF3,0x05,0xFC,0xC8,0xFC,0x66,0xFC,0xA4,0xF3,0xA4,0xF3,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x28,0xF4,0x66,0xFC,0x05,0xFC,0x64,0xF3,0xA4,0xF3,0xA4,0xF3,0xA4,0xF3,0x23,0xEB,0x64,0xF3,0x23,0xEB,0xA4,0xF3,0xE7,0xF3,0xA4,0xF3,0x64,0xF3,0xC3,0xDA,0x82,0xBA,0x23,0x92,
-	0x23,0x9A,0x44,0xB2,0x24,0xA2,0x43,0xAA,0x82,0xBA,0x82,0xBA,0x64,0xC2,0xA4,0xCA,0x64,0xBA,0x43,0xB2,0x24,0xA2,0x64,0xBA,0x64,0xBA,0xA5,0xC2,0xA4,0xCA,0x64,0xB2,0xA5,0xC2,0x64,0xB2,0x44,0x9A,0xA5,0xC2,0x64,0xB2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xE5,0xBA,0x64,0xBA,0x44,0xAA,0x64,0xB2,0x64,0xB2,0x64,0xB2,
-	0x64,0xC2,0xC4,0xDA,0x23,0x8A,0x23,0x8A,0x23,0x8A,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x8A,0x03,0x82,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x81,0xC2,0x79,0x46,0xBB,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x26,0xBB,0x26,0xBB,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0x26,0xBB,0x26,0xBB,0x46,0xBB,
-	0x26,0xBB,0x46,0xC3,0x46,0xBB,0x46,0xBB,0x26,0xBB,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x46,0xBB,0x26,0xBB,0x05,0xBB,0x46,0xBB,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x26,0xBB,0x26,0xBB,0x26,0xBB,0xE5,0xB2,0xC4,0xB2,0x46,0xBB,0x66,0xC3,0x46,0xBB,0x25,0xBB,0x66,0xC3,0x46,0xBB,0x46,0xC3,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x46,0xC3,
-	0x87,0xCB,0x66,0xC3,0x26,0xBB,0xC4,0xB2,0x05,0xB3,0x46,0xBB,0x26,0xBB,0x26,0xBB,0x46,0xBB,0x26,0xBB,0x05,0xBB,0x26,0xBB,0x05,0xB3,0xE5,0xAA,0xE5,0xB2,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xAB,0xE5,0xB2,0x05,0xB3,0x06,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xC4,0xAA,0x64,0x9A,0x64,0x92,0x84,0x9A,0x64,0x9A,
-	0x64,0x92,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0xA5,0xA2,0x64,0x9A,0x23,0x92,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0xC2,0x79,0xC2,0x71,0xC3,0x71,0xC3,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xC2,0x79,0xE3,0x81,0x64,0x8A,0xC5,0xA2,0xE5,0xB2,0x05,0xB3,0x26,0xBB,0x46,0xC3,0x25,0xBB,0x46,0xC3,0x66,0xC3,0x4A,0xFC,
-	0xA6,0xF3,0x4A,0xFC,0x66,0xEB,0x66,0xEB,0xE7,0xF3,0xA6,0xF3,0xA6,0xF3,0x66,0xEB,0x05,0xFC,0xE7,0xF3,0x64,0xF3,0xA6,0xF3,0x05,0xFC,0x64,0xF3,0x02,0xE3,0x22,0xEB,0x02,0xE3,0xC2,0xD2,0xE2,0xDA,0x02,0xE3,0xE2,0xE2,0x63,0xF3,0xC4,0xFB,0xA4,0xF3,0x23,0xE3,0x02,0xE3,0x63,0xEB,0x63,0xEB,0x63,0xEB,0x02,0xE3,0xA4,0xF3,0x05,0xFC,
-	0x05,0xFC,0x66,0xFC,0xC8,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0xA4,0xF3,0x63,0xEB,0xA4,0xF3,0x23,0xEB,0x02,0xE3,0xE2,0xDA,0x03,0xDB,0xC4,0xFB,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x85,0xEB,0xE2,0xE2,0xA4,0xF3,0xC8,0xFC,0x05,0xFC,0xC4,0xFB,0x05,0xFC,0xA4,0xF3,0x05,0xFC,0xE7,0xF3,0x66,0xFC,
-	0x66,0xFC,0xA4,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x63,0xEB,0x23,0xEB,0x64,0xF3,0x64,0xF3,0xA4,0xF3,0x23,0xEB,0xA2,0xDA,0xA3,0xD2,0x64,0xC2,0x43,0xB2,0x43,0xB2,0x43,0xAA,0x24,0xA2,0x43,0xAA,0x43,0xB2,0x24,0xA2,0x23,0x9A,0x03,0x8A,0x03,0x8A,0x23,0x92,0x23,0x9A,0x03,0x8A,0x44,0xAA,0xA5,0xC2,0xA4,0xCA,
-	0xA5,0xC2,0xA5,0xC2,0x64,0xB2,0xA5,0xC2,0x44,0xAA,0x64,0x9A,0x84,0xA2,0x84,0x9A,0x84,0xA2,0x64,0xC2,0xA4,0xCA,0x64,0xC2,0x44,0xAA,0x83,0xB2,0x44,0xB2,0x64,0xBA,0x64,0xBA,0xA4,0xCA,0x03,0x8A,0xE2,0x81,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x8A,0xE2,0x81,0x03,0x82,0x03,0x82,0xC2,0x79,0xA2,0x71,0xC2,0x79,0x03,0x82,0x03,0x8A,
-	0x46,0xBB,0x66,0xC3,0x26,0xBB,0x05,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x25,0xBB,0x25,0xBB,0x26,0xBB,0x26,0xBB,0x05,0xBB,0x05,0xBB,0x46,0xBB,0x26,0xBB,0x46,0xBB,0x26,0xBB,0x26,0xBB,0x25,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xBB,
-	0x05,0xBB,0x26,0xBB,0x46,0xBB,0x05,0xB3,0x05,0xB3,0x46,0xBB,0x46,0xBB,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x46,0xBB,0x87,0xC3,0x66,0xC3,0x46,0xC3,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x05,0xBB,0x05,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xB2,0xE5,0xAA,
-	0xE5,0xB2,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x06,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xB2,0x84,0x9A,0x64,0x92,0x64,0x92,0x84,0x9A,0xA5,0xA2,0xA5,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xC2,0x79,0xC2,0x79,
-	0xE3,0x79,0xE3,0x79,0xC2,0x71,0xA2,0x71,0xC2,0x71,0x03,0x82,0x64,0x9A,0x64,0x9A,0xA4,0xAA,0x05,0xB3,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x26,0xBB,0x46,0xBB,0x4A,0xFC,0xE7,0xF3,0x4A,0xFC,0x66,0xEB,0x66,0xEB,0x66,0xEB,0x66,0xEB,0xE7,0xF3,0x66,0xEB,0xA6,0xF3,0x05,0xFC,0xA4,0xF3,0xA6,0xF3,0xE7,0xF3,0xC4,0xFB,0x02,0xE3,0xE2,0xE2,
-	0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0x22,0xEB,0x23,0xEB,0xC4,0xFB,0x63,0xF3,0x42,0xF3,0x02,0xE3,0x63,0xEB,0xA4,0xF3,0xA4,0xF3,0x23,0xEB,0x23,0xEB,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x28,0xF4,0x66,0xFC,0x05,0xFC,0x05,0xFC,0xA4,0xF3,0xE2,0xE2,0xE2,0xE2,0xA4,0xF3,0x63,0xEB,0x63,0xF3,
-	0x05,0xFC,0xC8,0xFC,0xC8,0xFC,0xA4,0xF3,0x64,0xF3,0x05,0xFC,0xA4,0xF3,0xA4,0xF3,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0x05,0xFC,0x05,0xFC,0xE7,0xF3,0xC4,0xFB,0x05,0xFC,0x05,0xFC,0xA4,0xF3,0xA4,0xF3,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x23,0xEB,0x23,0xEB,0x23,0xEB,0xA4,0xF3,0xA6,0xF3,0x63,0xF3,0x63,0xF3,0xC3,0xDA,0x82,0xCA,0x82,0xC2,
-	0x43,0xB2,0x44,0xB2,0x82,0xBA,0x43,0xB2,0x22,0xA2,0x64,0xBA,0x64,0xC2,0x43,0xB2,0x24,0xA2,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x24,0x92,0x44,0xAA,0xA4,0xCA,0xA5,0xC2,0xA5,0xC2,0x24,0xA2,0x65,0xBA,0x65,0xBA,0x64,0x9A,0x24,0x92,0x24,0x92,0x64,0x92,0x64,0x9A,0xA4,0xCA,0xA4,0xCA,0x64,0xC2,0x44,0xAA,0x64,0xB2,0x64,0xB2,0x64,0xB2,
-	0x64,0xBA,0xA5,0xC2,0x03,0x82,0x03,0x8A,0x23,0x8A,0x64,0x92,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0x25,0xBB,0x26,0xBB,0x26,0xBB,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,
-	0x05,0xB3,0x26,0xBB,0x05,0xB3,0xE5,0xAA,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x46,0xBB,0x26,0xBB,0x05,0xBB,0x05,0xBB,0x05,0xB3,0x05,0xB3,0x06,0xB3,0x05,0xB3,0x05,0xBB,0x26,0xBB,0x26,0xBB,0x05,0xB3,0x46,0xBB,0x26,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xBB,0x05,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x46,0xBB,
-	0x26,0xBB,0x05,0xB3,0x46,0xBB,0x26,0xBB,0x26,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,0xE5,0xB2,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xA4,0xAA,0xE5,0xAA,0x06,0xB3,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xC5,0xA2,0x64,0x92,0x23,0x92,0x64,0x9A,
-	0xA4,0xA2,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x64,0x9A,0x64,0x92,0x44,0x8A,0x03,0x82,0xE3,0x81,0x03,0x8A,0x23,0x8A,0x44,0x8A,0xE3,0x81,0xC2,0x79,0xC2,0x79,0x03,0x82,0xE3,0x79,0xA2,0x71,0xA2,0x71,0xC3,0x69,0xE3,0x79,0x64,0x92,0xA4,0xA2,0xE5,0xAA,0x05,0xB3,0x26,0xBB,0x25,0xBB,0x25,0xBB,0x26,0xBB,0x25,0xBB,0xE7,0xF3,
-	0x28,0xF4,0xE7,0xEB,0x66,0xEB,0x66,0xEB,0xA7,0xDB,0x66,0xEB,0xA6,0xF3,0x66,0xEB,0x4A,0xFC,0x4A,0xFC,0xE7,0xF3,0x05,0xFC,0x05,0xFC,0xC4,0xFB,0x63,0xEB,0xA1,0xD2,0xC2,0xD2,0xE2,0xE2,0x02,0xE3,0x22,0xEB,0x23,0xEB,0xC4,0xFB,0x63,0xF3,0x23,0xEB,0x23,0xEB,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x66,0xFC,0xC8,0xFC,
-	0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x28,0xF4,0x28,0xF4,0xE7,0xF3,0x63,0xF3,0x03,0xDB,0xC2,0xD2,0x03,0xDB,0xC2,0xD2,0x23,0xEB,0xA4,0xF3,0x05,0xFC,0x66,0xFC,0x05,0xFC,0xA4,0xF3,0x05,0xFC,0x05,0xFC,0x63,0xF3,0xC4,0xFB,0xC4,0xFB,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0xC4,0xFB,
-	0x63,0xF3,0x64,0xF3,0x24,0xEB,0x64,0xF3,0x64,0xF3,0x63,0xEB,0x63,0xEB,0x64,0xF3,0x23,0xEB,0xA6,0xF3,0x66,0xFC,0xA4,0xF3,0x42,0xF3,0xA2,0xDA,0x82,0xCA,0xA3,0xD2,0x64,0xC2,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0x43,0xAA,0x64,0xC2,0xC3,0xCA,0x82,0xBA,0x43,0xAA,0x03,0x82,0xE3,0x81,0x03,0x8A,0x23,0x9A,0x24,0x9A,0x64,0xBA,0xA4,0xCA,
-	0x64,0xBA,0x03,0x8A,0x44,0xAA,0x64,0xB2,0x64,0xB2,0x24,0x92,0x03,0x8A,0x05,0x82,0x44,0x8A,0x64,0xBA,0xA5,0xC2,0xA5,0xC2,0x64,0xB2,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x64,0xB2,0x64,0xB2,0x03,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x82,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x81,0xC2,0x79,0xC2,0x79,
-	0x05,0xB3,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x06,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0x05,0xB3,0x06,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x06,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x46,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x05,0xB3,
-	0x05,0xB3,0x05,0xB3,0x06,0xB3,0x05,0xB3,0xE5,0xB2,0x26,0xBB,0x26,0xBB,0x26,0xBB,0x46,0xBB,0x46,0xBB,0x05,0xB3,0xE5,0xB2,0x46,0xBB,0x26,0xBB,0x05,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x05,0xBB,0x25,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xAB,0xE5,0xAA,0x05,0xB3,0x06,0xB3,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xAA,0xC4,0xA2,
-	0xC5,0xA2,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xA2,0xA4,0xA2,0xC5,0xA2,0xC5,0xAA,0xC5,0xA2,0xC4,0xA2,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0x84,0x9A,0x43,0x92,0x64,0x92,0x84,0xA2,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0x64,0x9A,0x23,0x8A,0x03,0x82,0xE2,0x81,0x03,0x82,0x23,0x8A,0x44,0x8A,0x23,0x8A,0xC2,0x79,0xE3,0x79,
-	0x03,0x82,0xE3,0x79,0x82,0x69,0x82,0x69,0xC3,0x71,0xE3,0x79,0x23,0x8A,0xA5,0x9A,0xC5,0xAA,0xE5,0xAA,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x25,0xBB,0x28,0xF4,0xA6,0xF3,0xA6,0xF3,0x66,0xEB,0x45,0xDB,0x66,0xEB,0xA6,0xF3,0x66,0xEB,0xA6,0xDB,0x66,0xFC,0xCB,0xFC,0xE7,0xF3,0xE7,0xF3,0xA4,0xF3,0xA4,0xF3,0x02,0xE3,0xC1,0xDA,
-	0xE2,0xE2,0xE2,0xDA,0x23,0xEB,0x02,0xE3,0x02,0xE3,0x23,0xEB,0x23,0xEB,0x03,0xDB,0x63,0xEB,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x28,0xF4,0x66,0xFC,0x66,0xFC,0xA4,0xF3,0xA4,0xF3,0x03,0xDB,0xE2,0xDA,0x82,0xCA,0x82,0xCA,0x03,0xDB,
-	0x63,0xEB,0x63,0xF3,0xC4,0xFB,0xA4,0xF3,0x64,0xF3,0x23,0xEB,0xE2,0xE2,0xE2,0xE2,0x42,0xF3,0xA4,0xF3,0xA4,0xF3,0x05,0xFC,0x05,0xFC,0xA4,0xF3,0xC4,0xFB,0xC4,0xFB,0x63,0xEB,0x23,0xEB,0x64,0xF3,0xA4,0xF3,0x23,0xEB,0x23,0xEB,0x64,0xF3,0x23,0xEB,0x64,0xF3,0xA4,0xF3,0xA6,0xF3,0x64,0xF3,0x23,0xEB,0x23,0xEB,0xE2,0xE2,0xE2,0xE2,
-	0xA3,0xD2,0xE4,0xE2,0xE4,0xE2,0xA3,0xD2,0x64,0xC2,0x82,0xC2,0x64,0xC2,0x24,0xA2,0x23,0x9A,0xE3,0x81,0x03,0x82,0x03,0x8A,0x24,0x92,0x03,0x8A,0x44,0xAA,0xC4,0xDA,0xA4,0xCA,0x24,0x9A,0x24,0x9A,0x44,0xAA,0x64,0xB2,0x44,0xAA,0x24,0x9A,0x03,0x82,0x24,0x9A,0x64,0xB2,0x64,0xC2,0xA5,0xC2,0x64,0xBA,0x64,0xB2,0x64,0xB2,0x64,0xB2,
-	0x44,0xAA,0x64,0xB2,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x82,0xE2,0x81,0x03,0x82,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x81,0x03,0x82,0x03,0x8A,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x06,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xAB,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x06,0xB3,0x05,0xAB,
-	0xE5,0xB2,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0x06,0xB3,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x06,0xB3,0xE5,0xAA,0xE5,0xAA,0x06,0xB3,0xE5,0xAA,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x05,0xAB,0xE5,0xB2,0x05,0xB3,0xE5,0xB2,0x05,0xB3,0x46,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x06,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,
-	0x05,0xB3,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xB2,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xAB,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0xC5,0xAA,0xE5,0xAA,0xA4,0xA2,0x64,0x9A,0x84,0x9A,0x84,0xA2,
-	0xA4,0xA2,0xC5,0xAA,0xC5,0xA2,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0x84,0x9A,0x64,0x92,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x23,0x8A,0x44,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xA2,0x71,0xA2,0x71,0xE3,0x79,0xE3,0x79,0x03,0x82,0x23,0x8A,0x84,0x9A,0xA4,0xA2,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x28,0xF4,
-	0xE7,0xF3,0xE7,0xF3,0x64,0xF3,0x66,0xEB,0x45,0xDB,0x66,0xEB,0x66,0xEB,0x66,0xEB,0xE7,0xF3,0xCB,0xFC,0x89,0xEC,0xE7,0xF3,0xA6,0xF3,0x24,0xEB,0x22,0xEB,0x02,0xE3,0x63,0xEB,0x23,0xEB,0x02,0xE3,0xE2,0xDA,0x02,0xE3,0x63,0xF3,0xC4,0xFB,0xA4,0xF3,0x05,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0x49,0xFD,
-	0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x23,0xE3,0x82,0xC2,0x43,0xAA,0x82,0xCA,0xE2,0xDA,0x23,0xE3,0x02,0xE3,0x23,0xEB,0x23,0xE3,0xC3,0xDA,0xE2,0xDA,0xE2,0xDA,0xE2,0xE2,0xE2,0xE2,0x64,0xF3,0x05,0xFC,0xA4,0xF3,0xA4,0xF3,0xA4,0xF3,0x05,0xFC,0xA4,0xF3,
-	0x23,0xEB,0x24,0xEB,0xA4,0xF3,0x23,0xEB,0x23,0xEB,0xE4,0xE2,0xE4,0xE2,0xE2,0xE2,0x23,0xEB,0x64,0xF3,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x64,0xF3,0x64,0xF3,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xC3,0xDA,0xA3,0xD2,0xA3,0xD2,0x44,0xB2,0x24,0xA2,0x03,0x8A,0xE3,0x81,0x03,0x82,0xE3,0x79,0x03,0x8A,0xC3,0x71,0xE3,0x81,0x64,0xBA,
-	0x64,0xBA,0x24,0xA2,0x44,0xAA,0x03,0x8A,0x24,0x92,0x25,0xA2,0x25,0xA2,0x24,0x92,0x44,0xAA,0x64,0xB2,0x64,0xB2,0x64,0xB2,0x44,0xB2,0x64,0xBA,0x64,0xB2,0x64,0xBA,0x45,0xA2,0x64,0xB2,0x23,0x8A,0x03,0x8A,0xE2,0x81,0x44,0x8A,0x03,0x82,0x03,0x82,0xE3,0x81,0xC2,0x79,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x8A,0x23,0x8A,
-	0xE5,0xAA,0x05,0xAB,0x06,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xAB,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xAB,0x05,0xAB,0x05,0xB3,0x05,0xB3,0xE5,0xB2,0x05,0xB3,0x05,0xAB,0x06,0xB3,0xE5,0xAA,0xE5,0xB2,0x06,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,
-	0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xAB,0x05,0xB3,0x05,0xAB,0xE5,0xAA,0x05,0xB3,0x46,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x06,0xB3,0xE5,0xB2,0x05,0xB3,0x26,0xBB,0x06,0xB3,0xE5,0xB2,0xE5,0xAA,0xC5,0xAA,0xE5,0xAA,0xC4,0xAA,0xC4,0xAA,0x05,0xAB,0xE5,0xAA,0xC5,0xA2,0xC5,0xA2,0xA4,0xA2,0xA5,0x9A,
-	0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA5,0xA2,0xA5,0xA2,0x64,0x9A,0x64,0x92,0x64,0x9A,0xA4,0xA2,0x84,0x9A,0x63,0x9A,0x84,0x9A,0xC5,0xA2,0xA5,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x63,0x9A,0x03,0x82,0xE3,0x81,0x03,0x82,0x03,0x82,0x23,0x8A,0x44,0x8A,0x23,0x8A,0xE3,0x81,
-	0xE3,0x81,0xE3,0x79,0xC2,0x79,0xC2,0x71,0xC2,0x79,0xC2,0x71,0xE3,0x79,0x03,0x8A,0x64,0x92,0xA5,0x9A,0xA5,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0xCB,0xFC,0xCB,0xFC,0xE7,0xF3,0x66,0xEB,0x66,0xEB,0x66,0xEB,0x45,0xDB,0xA6,0xF3,0xE7,0xF3,0xE7,0xF3,0x4E,0xFE,0xCB,0xFC,0x05,0xFC,0xE7,0xF3,0xA6,0xF3,0x22,0xEB,0xE2,0xE2,
-	0xE2,0xE2,0xE2,0xE2,0xE2,0xDA,0xC2,0xD2,0xC2,0xD2,0x23,0xE3,0x64,0xF3,0x66,0xFC,0x49,0xFD,0xC8,0xFC,0x28,0xF4,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x28,0xF4,0xC8,0xFC,0x66,0xFC,0x28,0xF4,0xA4,0xF3,0x05,0xFC,0x05,0xFC,0xC4,0xFB,0x82,0xCA,0x43,0xAA,0x22,0xA2,0x82,0xC2,0xE2,0xDA,
-	0xE3,0xD2,0x82,0xBA,0x82,0xCA,0x03,0xDB,0xA2,0xD2,0x82,0xCA,0xA2,0xD2,0xE2,0xDA,0x23,0xEB,0xA4,0xF3,0xC4,0xFB,0xA4,0xF3,0xA4,0xF3,0x64,0xF3,0x05,0xFC,0xA4,0xF3,0x23,0xEB,0x63,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0xE2,0xE2,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xA4,0xF3,0x24,0xEB,0xA3,0xDA,
-	0x23,0xEB,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,0xA3,0xDA,0xA4,0xCA,0x44,0xB2,0x23,0x92,0x03,0x8A,0x03,0x8A,0x05,0x82,0xE3,0x79,0xE5,0x79,0xC3,0x71,0xC3,0x69,0x24,0x92,0x64,0xB2,0x24,0xA2,0x44,0xAA,0x64,0xB2,0x24,0x92,0x24,0xA2,0x64,0xB2,0x24,0xA2,0x24,0xA2,0x64,0xB2,0x64,0xB2,0x64,0xB2,0x64,0xC2,0x64,0xBA,0x64,0xB2,0x65,0xBA,
-	0x25,0xA2,0xA4,0xAA,0x64,0x9A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x44,0x8A,0xE2,0x81,0xE2,0x81,0xE3,0x81,0x03,0x8A,0x44,0x8A,0x23,0x8A,0x03,0x8A,0xC5,0xAA,0x05,0xAB,0x05,0xB3,0x06,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x05,0xAB,0xE5,0xAA,0xE5,0xAA,0x06,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xB2,
-	0xE5,0xB2,0x06,0xB3,0x05,0xB3,0xE5,0xAA,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xC4,0xA2,0xA5,0xA2,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0x05,0xAB,0x06,0xB3,0xE5,0xB2,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x05,0xB3,0x06,0xB3,0x46,0xBB,0x26,0xBB,0x05,0xB3,0xE5,0xB2,0x06,0xB3,0x05,0xAB,0xE5,0xB2,0x06,0xB3,
-	0x05,0xB3,0x05,0xB3,0x26,0xBB,0x06,0xB3,0x05,0xB3,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xA2,0xC5,0xA2,0x84,0xA2,0xA5,0x9A,0xA5,0x9A,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0x64,0x9A,0x43,0x92,0x64,0x92,0x64,0x92,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,
-	0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x23,0x8A,0xE3,0x79,0xE3,0x79,0x03,0x82,0x23,0x8A,0x44,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x79,0x03,0x82,0x44,0x8A,0x84,0x9A,0xA5,0x9A,0xA5,0xA2,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xCB,0xFD,
-	0xCB,0xFC,0xE7,0xF3,0x66,0xEB,0x24,0xEB,0x45,0xDB,0x45,0xDB,0x66,0xEB,0xA6,0xF3,0x28,0xF4,0xCB,0xFC,0x05,0xFC,0xA6,0xF3,0xA6,0xF3,0xE7,0xF3,0xC4,0xFB,0x42,0xF3,0x22,0xEB,0x22,0xEB,0x22,0xEB,0x23,0xEB,0x23,0xEB,0x22,0xEB,0x85,0xEB,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x49,0xFD,
-	0xCB,0xFD,0x4E,0xFE,0x4E,0xFE,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x05,0xFC,0x63,0xEB,0x05,0xFC,0xA4,0xF3,0x63,0xF3,0x23,0xE3,0x43,0xB2,0x22,0xA2,0x82,0xBA,0x82,0xC2,0xA3,0xD2,0x82,0xBA,0x82,0xBA,0x03,0xDB,0x82,0xC2,0x82,0xC2,0x82,0xBA,0x82,0xCA,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x64,0xF3,0x63,0xF3,0xA4,0xF3,0x64,0xF3,0x64,0xF3,
-	0x64,0xF3,0x23,0xEB,0x64,0xF3,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0xE4,0xE2,0xC3,0xDA,0xE4,0xE2,0xE2,0xE2,0xE4,0xE2,0x23,0xEB,0x24,0xEB,0xE4,0xE2,0xC3,0xDA,0xE4,0xE2,0x23,0xEB,0xC3,0xDA,0xC3,0xDA,0xE4,0xE2,0xA3,0xDA,0x64,0xBA,0x24,0xA2,0x03,0x8A,0x03,0x8A,0xE3,0x81,0x03,0x8A,0xE3,0x81,0xC3,0x71,0x84,0x61,0x04,0x7A,
-	0x03,0x8A,0x24,0xA2,0x24,0xA2,0x64,0xB2,0x24,0x9A,0x64,0xB2,0x64,0xB2,0x64,0xB2,0x44,0xAA,0x44,0xAA,0x64,0xB2,0x64,0xB2,0x65,0xBA,0xA5,0xC2,0x64,0xB2,0x64,0xB2,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x23,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x02,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x8A,0xE2,0x81,
-	0xC5,0xAA,0x05,0xAB,0xE5,0xAA,0xE5,0xB2,0x06,0xB3,0x05,0xAB,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xAB,0x05,0xAB,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x06,0xB3,0x05,0xB3,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA5,0xA2,0xC5,0xA2,0xC5,0xA2,0xC5,0xA2,0xA4,0xA2,0xC5,0xA2,0xE5,0xAA,0xC5,0xAA,
-	0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xAB,0x06,0xB3,0x05,0xB3,0x05,0xAB,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xA4,0xAA,0xC5,0xA2,0xA4,0xA2,0x64,0x9A,0x84,0x9A,
-	0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0xC5,0xA2,0xC5,0xA2,0xA4,0xA2,0xC5,0xA2,0xE5,0xAA,0xC5,0xA2,0x64,0x9A,0x44,0x8A,0x23,0x8A,0xE3,0x79,0xC2,0x79,0xE3,0x79,0x44,0x8A,0x44,0x8A,0x03,0x8A,0xE3,0x81,
-	0xC2,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x81,0xE3,0x81,0x03,0x82,0xC2,0x79,0x03,0x82,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA5,0xA2,0xA5,0xA2,0xCB,0xFC,0xCB,0xFC,0x28,0xF4,0x24,0xEB,0x66,0xEB,0x45,0xDB,0xE4,0xE2,0x66,0xEB,0x66,0xEB,0x05,0xFC,0xA6,0xF3,0xA4,0xF3,0x64,0xF3,0xA6,0xF3,0x64,0xF3,0xC4,0xFB,0x63,0xF3,
-	0xE2,0xE2,0x42,0xF3,0xE2,0xDA,0x82,0xCA,0xA1,0xD2,0x42,0xF3,0xC4,0xFB,0x63,0xEB,0x05,0xFC,0xC8,0xFC,0x49,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xCB,0xFD,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xC4,0xFB,0x05,0xFC,0x85,0xEB,0x23,0xE3,0x42,0xF3,0x63,0xEB,0xC2,0xD2,0xC3,0xCA,0x82,0xBA,0xE3,0xD2,
-	0x03,0xDB,0xE3,0xD2,0xC3,0xCA,0x23,0xE3,0xA3,0xDA,0x82,0xBA,0x82,0xBA,0xA2,0xDA,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0xA4,0xF3,0x64,0xF3,0x23,0xEB,0x64,0xF3,0x64,0xF3,0xA4,0xF3,0x64,0xF3,0x24,0xEB,0x23,0xEB,0x23,0xEB,0xE2,0xE2,0xA3,0xDA,0x24,0xEB,0x64,0xF3,0x24,0xEB,0x23,0xEB,0xE4,0xE2,0xA3,0xDA,0xE4,0xE2,
-	0x23,0xEB,0xA4,0xF3,0x24,0xEB,0xC3,0xDA,0x24,0xEB,0xE4,0xE2,0x64,0xC2,0x24,0xA2,0x24,0x9A,0x24,0x92,0x05,0x82,0xC3,0x71,0xE5,0x69,0x04,0x7A,0x24,0x92,0x24,0x9A,0x24,0x92,0x24,0x92,0x44,0xAA,0x24,0xA2,0x44,0xAA,0x64,0xBA,0x64,0xB2,0x64,0xBA,0x64,0xC2,0x45,0xAA,0x44,0xAA,0x65,0xBA,0x64,0xB2,0x65,0xBA,0x64,0xB2,0x64,0xB2,
-	0x64,0x9A,0x45,0xA2,0x23,0x8A,0x23,0x8A,0x64,0x92,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xE5,0xAA,0x06,0xB3,0xE5,0xAA,0xC5,0xA2,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC4,0xA2,0xC5,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x06,0xB3,
-	0x06,0xB3,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA5,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0x9A,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0x84,0x9A,0xA4,0xA2,0xC5,0xA2,0xC5,0xA2,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x06,0xB3,0xE5,0xAA,0xC5,0xAA,0xE5,0xAA,0x05,0xB3,0x06,0xB3,0x06,0xB3,
-	0xE5,0xAA,0xE5,0xAA,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC4,0xA2,0xC5,0xAA,0xE5,0xAA,0xC4,0xA2,0xC4,0xA2,0xA4,0xA2,0x84,0x9A,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x43,0x92,0x64,0x92,0xA5,0x9A,0x84,0x9A,0x43,0x92,0x64,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0xA2,0xA4,0xA2,0xA5,0x9A,0x64,0x9A,0x43,0x92,0x23,0x8A,0x03,0x82,0xE3,0x79,0x03,0x82,0x44,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x81,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x79,0x03,0x82,0x03,0x82,0xE3,0x81,0x23,0x8A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0xA2,0xA4,0xA2,0xCB,0xFC,
-	0x28,0xF4,0xA6,0xF3,0x24,0xEB,0x24,0xEB,0x45,0xDB,0x45,0xDB,0x24,0xEB,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0xA6,0xF3,0x66,0xEB,0x24,0xEB,0x64,0xF3,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x22,0xEB,0xC1,0xDA,0xC1,0xDA,0xA4,0xF3,0x05,0xFC,0xA4,0xF3,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xCB,0xFD,0xCB,0xFD,0xC8,0xFC,0x49,0xFD,0xCB,0xFD,
-	0x4E,0xFE,0xCB,0xFD,0x49,0xFD,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x23,0xE3,0xC2,0xD2,0x03,0xDB,0xE2,0xDA,0x63,0xEB,0x23,0xEB,0x03,0xDB,0x03,0xDB,0xC3,0xCA,0xC3,0xCA,0xA4,0xCA,0x44,0xE3,0x44,0xE3,0x23,0xE3,0x23,0xE3,0xC3,0xDA,0xE2,0xDA,0xE4,0xE2,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x64,0xF3,0x23,0xEB,0x64,0xF3,0x23,0xEB,0x23,0xEB,
-	0x64,0xF3,0x05,0xFC,0x66,0xFC,0x64,0xF3,0x23,0xE3,0xC3,0xDA,0xC3,0xDA,0x23,0xE3,0xC3,0xDA,0x23,0xEB,0xA6,0xF3,0xE4,0xE2,0xC3,0xDA,0xA3,0xDA,0xA3,0xD2,0xC3,0xDA,0xE4,0xE2,0x24,0xEB,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0x24,0xEB,0xE3,0xD2,0x64,0xBA,0x23,0x9A,0x03,0x8A,0x24,0x92,0x24,0x92,0x24,0x92,0xE3,0x79,0x44,0xAA,0x44,0xB2,
-	0x24,0x92,0x03,0x8A,0x24,0xA2,0x44,0xAA,0x44,0xAA,0x64,0xBA,0x64,0xBA,0x44,0xB2,0xA5,0xC2,0x65,0xBA,0x65,0xBA,0x65,0xBA,0x65,0xBA,0x64,0xB2,0x64,0xB2,0x64,0xB2,0x25,0x9A,0x25,0x9A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x82,0x03,0x8A,0x03,0x82,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x43,0x92,0x44,0x8A,
-	0xE5,0xAA,0xE5,0xAA,0xC5,0xA2,0x84,0xA2,0xC5,0xA2,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xC5,0xA2,0xC5,0xA2,0xC5,0xAA,0x05,0xAB,0xE5,0xAA,0xA4,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0xA5,0x9A,0xA4,0xA2,0xA5,0x9A,0xA4,0xA2,0x84,0x9A,0xC5,0xA2,0xC5,0xA2,0xC5,0xA2,0xC4,0xA2,
-	0xC4,0xA2,0xC5,0xAA,0xC4,0xA2,0xC4,0xA2,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xA4,0xA2,0xC5,0xAA,0x05,0xAB,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC4,0xA2,0xA4,0xAA,0xC5,0xA2,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0xA5,0x9A,
-	0xA5,0x9A,0x84,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x43,0x92,0x23,0x8A,0x64,0x92,0x64,0x92,0x43,0x92,0x64,0x9A,0x43,0x92,0x43,0x92,0x64,0x92,0x44,0x8A,0x44,0x8A,0x64,0x92,0x44,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0xE3,0x79,0xC2,0x79,
-	0xE3,0x81,0x03,0x82,0x03,0x82,0xC2,0x79,0xE3,0x81,0xE3,0x79,0xE3,0x79,0x23,0x8A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x84,0x9A,0xCB,0xFC,0xCB,0xFC,0xA4,0xF3,0x64,0xF3,0x66,0xEB,0x45,0xDB,0xE3,0xD2,0x04,0xDB,0x44,0xE3,0x24,0xEB,0x24,0xEB,0x64,0xF3,0x64,0xF3,0xE4,0xE2,0x66,0xEB,0x24,0xEB,0x63,0xF3,
-	0xC4,0xFB,0x05,0xFC,0x05,0xFC,0xE2,0xE2,0xC1,0xDA,0x63,0xEB,0x63,0xEB,0x63,0xF3,0x66,0xFC,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x85,0xEB,0xC2,0xD2,0x02,0xE3,0x63,0xEB,0x63,0xEB,0x23,0xE3,0xE3,0xD2,0xC3,0xCA,0xE3,0xD2,0xC3,0xCA,
-	0x45,0xDB,0x85,0xEB,0x85,0xEB,0x44,0xE3,0x64,0xF3,0xA4,0xF3,0x64,0xF3,0x63,0xEB,0x63,0xEB,0x63,0xEB,0x23,0xEB,0x64,0xF3,0x23,0xEB,0x23,0xEB,0x64,0xF3,0x63,0xF3,0x64,0xF3,0xE7,0xF3,0xA6,0xF3,0x64,0xF3,0xE4,0xE2,0xE2,0xE2,0x23,0xE3,0x23,0xEB,0xC3,0xDA,0x23,0xEB,0x24,0xEB,0xC3,0xDA,0xC4,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xDA,
-	0xC4,0xDA,0xA3,0xDA,0xE4,0xE2,0xC4,0xDA,0xE4,0xE2,0x24,0xEB,0xC4,0xDA,0x64,0xBA,0x44,0xB2,0x44,0xB2,0x24,0xA2,0x03,0x8A,0x24,0x92,0x44,0xAA,0x44,0xB2,0x44,0xB2,0x24,0x92,0x03,0x8A,0x44,0xAA,0x64,0xB2,0x44,0xAA,0x64,0xBA,0x64,0xB2,0x65,0xBA,0xA5,0xC2,0x64,0xC2,0x65,0xBA,0x45,0xAA,0x64,0xB2,0x45,0xA2,0x64,0xB2,0x64,0xB2,
-	0x45,0xA2,0x45,0xA2,0x03,0x8A,0x23,0x8A,0x03,0x8A,0xE2,0x81,0x03,0x82,0x03,0x82,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x64,0x92,0x64,0x92,0x84,0x9A,0x84,0x9A,0xA5,0xA2,0x64,0x9A,0x64,0x9A,0x84,0x9A,0xA5,0x9A,0xA5,0x9A,0xA5,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x84,0x9A,0xA5,0x9A,0xA5,0x9A,0xA4,0xA2,
-	0xC5,0xA2,0xA4,0xA2,0xC4,0xA2,0xC5,0xA2,0xC4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA5,0xA2,0xC5,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC4,0xA2,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC4,0xA2,0xC5,0xA2,0xC5,0xAA,
-	0xC4,0xA2,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xC4,0xA2,0xC5,0xAA,0xE5,0xAA,0xC5,0xA2,0x64,0x92,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0x64,0x9A,0x64,0x92,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x92,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x23,0x8A,0x23,0x8A,0x64,0x92,0x84,0x92,
-	0x64,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x81,0x03,0x82,0x23,0x8A,0x03,0x82,0x03,0x82,0xC2,0x79,0xC2,0x79,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x79,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xE3,0x79,0x03,0x82,0x23,0x8A,0x64,0x9A,0xA4,0xA2,0x84,0xA2,0xA5,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x4A,0xFC,
-	0xCB,0xFC,0xE7,0xF3,0x64,0xF3,0x24,0xEB,0x04,0xDB,0x04,0xDB,0x44,0xE3,0x24,0xEB,0x24,0xEB,0x24,0xEB,0x24,0xEB,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0x64,0xF3,0x42,0xF3,0x63,0xF3,0x42,0xF3,0x66,0xFC,0x42,0xF3,0x22,0xEB,0x42,0xF3,0x02,0xE3,0x23,0xEB,0xA4,0xF3,0x05,0xFC,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,
-	0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0xC4,0xFB,0x23,0xE3,0x63,0xEB,0x63,0xEB,0xE2,0xE2,0x85,0xEB,0x23,0xE3,0xA3,0xD2,0xC3,0xCA,0x04,0xCB,0x44,0xE3,0xA6,0xF3,0x85,0xEB,0x85,0xEB,0x85,0xEB,0x64,0xF3,0x64,0xF3,0x64,0xF3,0x23,0xEB,0x64,0xF3,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x64,0xF3,
-	0x64,0xF3,0xA4,0xF3,0x64,0xF3,0xC3,0xDA,0x23,0xE3,0xC3,0xDA,0xC3,0xDA,0xA3,0xDA,0xA3,0xDA,0xC3,0xDA,0xE4,0xE2,0xC3,0xDA,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xC4,0xDA,0xA3,0xDA,0xA3,0xD2,0xC4,0xDA,0xE4,0xE2,0xC4,0xDA,0xC3,0xDA,0xC4,0xDA,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x25,0xA2,0x03,0x8A,0x03,0x8A,0x44,0xAA,0x44,0xAA,0x64,0xB2,
-	0x24,0x9A,0x25,0xA2,0xA5,0xC2,0x44,0xAA,0x44,0xB2,0x64,0xB2,0x45,0xAA,0x64,0xB2,0x65,0xBA,0xA5,0xC2,0x65,0xBA,0x64,0xB2,0xC5,0xAA,0x45,0xA2,0x45,0xAA,0x45,0xA2,0x25,0x9A,0x45,0xA2,0x23,0x8A,0x23,0x8A,0x03,0x8A,0xE3,0x81,0xE2,0x81,0x03,0x82,0x03,0x82,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,
-	0x23,0x8A,0x23,0x8A,0x84,0x92,0x64,0x92,0x23,0x8A,0x64,0x92,0x43,0x92,0x64,0x92,0x84,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x84,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0xA5,0x9A,0xA4,0xA2,0xA5,0x9A,0xA5,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0xA5,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,
-	0xA5,0xA2,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xE5,0xAA,0x06,0xB3,0xE5,0xAA,0xC4,0xA2,0xC5,0xA2,0xC4,0xA2,0xA4,0xA2,0xC5,0xAA,0xE5,0xAA,0xA4,0xA2,0xA4,0xAA,0xE5,0xAA,0xC4,0xA2,0xC4,0xA2,0xC5,0xA2,0xC5,0xAA,0xA4,0xA2,0xA5,0xA2,0xA5,0xA2,0xA5,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x43,0x92,0x44,0x8A,0x23,0x8A,0x03,0x82,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,
-	0xC2,0x79,0xA2,0x71,0xA2,0x71,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x23,0x8A,0x64,0x92,0x64,0x9A,0x64,0x9A,0xA5,0x9A,0xA5,0xA2,0xA4,0xA2,0xCB,0xFC,0xCB,0xFC,0xE7,0xEB,0xE7,0xF3,0x44,0xE3,0x03,0xDB,0x04,0xDB,0xE4,0xE2,0x24,0xEB,0x24,0xEB,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0x24,0xEB,0xE4,0xE2,0x24,0xEB,0x63,0xF3,
-	0x42,0xF3,0x63,0xF3,0xC4,0xFB,0xC4,0xFB,0x05,0xFC,0x63,0xF3,0x22,0xEB,0xE2,0xE2,0xC4,0xFB,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x23,0xE3,0x03,0xDB,0xE2,0xDA,0xE2,0xDA,0xC3,0xDA,0x03,0xDB,0xE3,0xD2,0xE3,0xD2,0xE3,0xD2,
-	0x04,0xDB,0x04,0xDB,0xE3,0xD2,0xE7,0xF3,0x28,0xF4,0x64,0xF3,0x64,0xF3,0x63,0xF3,0x64,0xF3,0x63,0xF3,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0xE4,0xE2,0xE4,0xE2,0x23,0xEB,0xA3,0xDA,0xA3,0xDA,0xA3,0xDA,0xC3,0xDA,0xA3,0xD2,0xA3,0xDA,0xC4,0xDA,0xA3,0xDA,0xA3,0xD2,0x64,0xC2,0xC4,0xDA,
-	0xA3,0xD2,0xA3,0xD2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0xA4,0xCA,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x24,0x92,0x25,0xA2,0x44,0xAA,0x24,0xA2,0x25,0xA2,0x24,0x92,0x24,0x92,0x44,0xAA,0x64,0xB2,0x44,0xAA,0x64,0xB2,0x65,0xBA,0xA5,0xC2,0x65,0xBA,0xA5,0xC2,0x65,0xBA,0x65,0xBA,0x65,0xBA,0x45,0xA2,0x45,0xAA,0x45,0xA2,
-	0x25,0x9A,0x25,0x9A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x81,0x03,0x82,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x82,0x03,0x82,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x8A,0x44,0x8A,0x03,0x82,0x44,0x8A,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,
-	0x43,0x92,0x84,0x9A,0xA5,0x9A,0xA5,0x9A,0x64,0x9A,0x84,0x9A,0xA5,0x9A,0x64,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0xA5,0x9A,0xA5,0xA2,0xA5,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xC5,0xA2,0xC5,0xA2,0xC4,0xA2,0xA4,0xA2,0xC4,0xA2,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xA2,0xA4,0xA2,0xC4,0xA2,
-	0xC5,0xAA,0xE5,0xAA,0xA4,0xA2,0xC4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x92,0x64,0x9A,0x43,0x92,0x23,0x8A,0x43,0x92,0x64,0x92,0x64,0x92,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x64,0x92,0x64,0x92,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x81,
-	0xE3,0x81,0x03,0x82,0xE3,0x81,0x03,0x82,0x23,0x8A,0x03,0x82,0xE3,0x81,0xC3,0x71,0xA2,0x69,0xA3,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x71,0xC3,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0x03,0x82,0x23,0x8A,0x43,0x92,0x64,0x92,0x64,0x92,0x84,0x9A,0xA5,0x9A,0xCB,0xFC,
-	0xC8,0xFC,0xA4,0xF3,0x89,0xEC,0x44,0xE3,0x03,0xDB,0xE3,0xD2,0x04,0xDB,0x04,0xDB,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0x24,0xEB,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0x23,0xEB,0x63,0xF3,0x63,0xF3,0x63,0xF3,0xC4,0xFB,0x66,0xFC,0x66,0xFC,0x63,0xEB,0x42,0xF3,0xC4,0xFB,0x05,0xFC,0x66,0xFC,0x66,0xFC,0xC4,0xFB,0x66,0xFC,0x49,0xFD,0x49,0xFD,
-	0x66,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0xA4,0xF3,0x23,0xE3,0x03,0xDB,0xC3,0xDA,0xC2,0xD2,0xE3,0xD2,0xE3,0xD2,0xC3,0xCA,0x04,0xCB,0x44,0xE3,0x04,0xDB,0x24,0xEB,0x85,0xEB,0xE7,0xF3,0xA4,0xF3,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0x64,0xF3,0x23,0xEB,0x23,0xE3,0x23,0xEB,0x23,0xEB,0x23,0xEB,0xE2,0xE2,
-	0xE4,0xE2,0xE2,0xE2,0x23,0xEB,0xE4,0xE2,0xA3,0xDA,0xC3,0xDA,0xC3,0xDA,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0x64,0xC2,0xA3,0xD2,0xC4,0xDA,0x84,0xD2,0x64,0xC2,0x64,0xC2,0xC4,0xDA,0x64,0xC2,0x64,0xC2,0x64,0xBA,0x64,0xBA,0x64,0xC2,0x64,0xBA,0x44,0xAA,0x24,0x9A,0x25,0xA2,0x44,0xAA,0x25,0xA2,0x25,0xA2,
-	0x24,0x92,0x24,0x92,0x24,0x9A,0x44,0xAA,0x25,0xA2,0x44,0xAA,0x64,0xB2,0x65,0xBA,0x65,0xBA,0xA5,0xC2,0x65,0xBA,0x65,0xBA,0xC5,0xAA,0x45,0xA2,0x45,0xA2,0x05,0x92,0x05,0x92,0x05,0x92,0x03,0x82,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x8A,0x23,0x8A,
-	0x03,0x82,0x23,0x8A,0x23,0x8A,0xE3,0x81,0xE3,0x79,0x03,0x82,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x84,0x92,0xA5,0x9A,0x84,0x9A,0xA4,0xA2,0x84,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,
-	0x84,0x9A,0x84,0x9A,0xA5,0x9A,0xA4,0xA2,0xA5,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xE5,0xAA,0xE5,0xAA,0xC4,0xA2,0xC5,0xAA,0xC5,0xAA,0xA5,0xA2,0xC5,0xAA,0xC5,0xA2,0xC5,0xAA,0xC5,0xA2,0xC5,0xA2,0xA5,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,
-	0x64,0x92,0x64,0x92,0x44,0x8A,0x64,0x92,0x64,0x92,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x71,0xC2,0x79,0x03,0x82,0x03,0x82,0xE3,0x81,0xC3,0x71,0x82,0x61,0x62,0x61,0x82,0x61,0xA2,0x71,0xC2,0x71,0xC2,0x79,0xC3,0x71,0xA2,0x69,
-	0xA3,0x71,0xC2,0x71,0xC2,0x71,0x82,0x69,0x82,0x69,0xC3,0x71,0xA2,0x71,0xA2,0x71,0xC3,0x71,0x03,0x82,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x64,0x92,0x44,0x8A,0xB0,0xED,0x4A,0xFC,0x63,0xEB,0xE7,0xF3,0x63,0xEB,0x04,0xDB,0xE3,0xD2,0xC3,0xDA,0x24,0xEB,0xE4,0xE2,0x24,0xEB,0xE4,0xE2,0x23,0xEB,0xE4,0xE2,0xE4,0xE2,0xC3,0xDA,0xE4,0xE2,
-	0x42,0xF3,0xC4,0xFB,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x66,0xFC,0x05,0xFC,0x63,0xEB,0x05,0xFC,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0xC8,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x85,0xEB,0x04,0xDB,0x23,0xE3,0xE3,0xD2,0xE3,0xD2,0xE3,0xD2,0x04,0xCB,0xE3,0xD2,
-	0x85,0xEB,0xE7,0xF3,0x85,0xEB,0x64,0xF3,0x63,0xEB,0x63,0xEB,0x63,0xF3,0x63,0xF3,0xA4,0xF3,0x23,0xEB,0x23,0xEB,0xC3,0xDA,0x23,0xEB,0x23,0xE3,0xE2,0xE2,0xC3,0xDA,0xA3,0xD2,0xA3,0xDA,0x23,0xE3,0xC3,0xDA,0xA3,0xD2,0xA3,0xDA,0xC3,0xDA,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xC4,0xDA,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0xA3,0xD2,
-	0xA4,0xCA,0x64,0xBA,0x64,0xC2,0xA4,0xCA,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0xA4,0xCA,0x64,0xBA,0x24,0xA2,0x24,0x9A,0x24,0x9A,0x44,0xAA,0x25,0xA2,0x25,0xA2,0x24,0x9A,0x24,0x9A,0x24,0x92,0x45,0xA2,0x25,0x9A,0x25,0x9A,0x25,0xA2,0x45,0xAA,0xA5,0xC2,0x65,0xBA,0x45,0xAA,0x65,0xBA,0x65,0xBA,0x25,0x9A,0x45,0xA2,0x05,0x92,
-	0x05,0x92,0x05,0x82,0x03,0x82,0x03,0x82,0x03,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x8A,0x64,0x92,
-	0x84,0x92,0x84,0x9A,0x84,0x92,0x84,0x9A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x9A,0xA5,0x9A,0x64,0x9A,0xA5,0x9A,0xA5,0x9A,0x84,0x9A,0xA4,0xA2,0xC5,0xA2,0xC5,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xC5,0xA2,0xA5,0xA2,0xC4,0xA2,
-	0xC5,0xA2,0xC5,0xAA,0xC4,0xA2,0xA5,0xA2,0x84,0xA2,0xA4,0xA2,0xC5,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA5,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x92,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x23,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,
-	0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xC2,0x79,0xA2,0x71,0xA2,0x69,0x62,0x61,0x62,0x59,0x62,0x61,0xA2,0x69,0xA2,0x69,0xA3,0x71,0xC3,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xE3,0x79,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x8A,0xAD,0xEC,
-	0x28,0xF4,0x85,0xEB,0x85,0xEB,0x63,0xEB,0xE3,0xD2,0xE3,0xD2,0xE3,0xD2,0x23,0xE3,0xE4,0xE2,0x23,0xEB,0xC4,0xDA,0xE4,0xE2,0x24,0xEB,0x23,0xEB,0xE4,0xE2,0x23,0xEB,0x23,0xEB,0x42,0xF3,0x05,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x49,0xFD,0xA6,0xF3,0x05,0xFC,0x64,0xF3,0x66,0xFC,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,
-	0x49,0xFD,0x66,0xFC,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xE7,0xEB,0xA6,0xF3,0x85,0xEB,0x44,0xE3,0x85,0xEB,0x45,0xDB,0x45,0xDB,0x45,0xDB,0xA6,0xDB,0xE7,0xF3,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x63,0xEB,0x64,0xF3,0xA4,0xF3,0x64,0xF3,0x23,0xEB,0xE2,0xE2,0xE2,0xE2,0xA3,0xDA,0xC3,0xDA,0x23,0xE3,0xA3,0xDA,0xA2,0xDA,
-	0xA3,0xDA,0xA3,0xD2,0xE4,0xE2,0xA3,0xDA,0xA3,0xD2,0xA3,0xDA,0xC3,0xDA,0xA3,0xDA,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0xA3,0xD2,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xBA,0x64,0xC2,0x64,0xC2,0x64,0xBA,0x64,0xBA,0x64,0xC2,0x84,0xD2,0x65,0xBA,0x25,0xA2,0x24,0xA2,0x44,0xAA,0x64,0xB2,0x25,0xA2,0x44,0x9A,
-	0x24,0x92,0x24,0x92,0x24,0x9A,0x25,0xA2,0x25,0x9A,0x45,0xA2,0x25,0x9A,0x45,0xA2,0xA5,0xC2,0x65,0xBA,0x45,0xA2,0x65,0xBA,0x45,0xAA,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x92,0x05,0x82,0xC2,0x79,0xE3,0x81,0x23,0x8A,0x03,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0x23,0x8A,0x43,0x92,0x43,0x92,0x23,0x92,
-	0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA3,0x69,0xA3,0x69,0xC3,0x69,0xC2,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x23,0x8A,0x43,0x92,0x64,0x92,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x64,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,
-	0xA5,0x9A,0xA5,0x9A,0x64,0x92,0x64,0x92,0x84,0x92,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA5,0xA2,0xA5,0xA2,0xA5,0xA2,0xA5,0xA2,0xA5,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,0xA5,0x9A,0x64,0x9A,0xA4,0xA2,0xA5,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0x9A,0x84,0x92,0x64,0x9A,0x64,0x9A,0x84,0x92,0x64,0x92,
-	0x64,0x92,0x64,0x92,0x84,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xA2,0x71,0xA3,0x71,0xC2,0x71,0x82,0x69,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,
-	0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xE3,0x81,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x8A,0x4D,0xD5,0xC8,0xFC,0xA4,0xF3,0x63,0xEB,0x63,0xEB,0xC3,0xCA,0xE3,0xD2,0xC4,0xDA,0xE3,0xD2,0xA3,0xDA,0xE4,0xE2,0xA3,0xD2,0x84,0xD2,0xE4,0xE2,0x24,0xEB,0x23,0xEB,0xE4,0xE2,
-	0x23,0xEB,0x23,0xEB,0xC4,0xFB,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0xC8,0xFC,0x66,0xFC,0xA6,0xF3,0x28,0xF4,0x66,0xFC,0xE7,0xF3,0xE7,0xEB,0x45,0xDB,0x44,0xE3,0x04,0xDB,0x44,0xE3,0x44,0xE3,0xA6,0xDB,
-	0xE7,0xEB,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x64,0xF3,0x63,0xEB,0x63,0xEB,0x64,0xF3,0xE2,0xE2,0xC3,0xDA,0xE2,0xDA,0xA2,0xDA,0xA3,0xDA,0xA3,0xDA,0x23,0xE3,0xA3,0xDA,0xA2,0xDA,0xA3,0xDA,0xA3,0xDA,0xA3,0xD2,0xA3,0xDA,0xA3,0xDA,0xC3,0xDA,0xC3,0xDA,0xE4,0xE2,0xA3,0xD2,0x84,0xD2,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0xA3,0xD2,0x64,0xC2,
-	0x64,0xC2,0x64,0xC2,0x44,0xB2,0x64,0xBA,0x44,0xB2,0x64,0xBA,0x64,0xC2,0x84,0xD2,0xA4,0xCA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x44,0xB2,0x24,0xA2,0x24,0x9A,0x24,0x92,0x24,0x92,0x24,0x92,0x24,0x92,0x25,0x9A,0x25,0x9A,0x45,0xA2,0x05,0x92,0x45,0xA2,0x45,0xAA,0x45,0xA2,0x45,0xAA,0x45,0xAA,0x25,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,
-	0x64,0x9A,0x05,0x82,0xA2,0x71,0xC2,0x79,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x92,0x82,0x69,0xA2,0x71,0xA2,0x69,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0xE3,0x79,0xC2,0x79,0xC2,0x79,0x03,0x82,
-	0x23,0x8A,0x43,0x92,0x64,0x92,0x84,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x43,0x92,0x44,0x8A,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x9A,0x85,0x92,0x84,0x92,0x43,0x92,0x64,0x92,0x84,0x9A,0x64,0x9A,0x64,0x9A,0xA5,0x9A,0xA5,0x9A,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0xA5,0x9A,
-	0x84,0xA2,0xA4,0xA2,0xC5,0xA2,0xA4,0xA2,0xA5,0x9A,0x84,0x9A,0xA5,0x9A,0xA5,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x44,0x8A,0x03,0x82,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xC2,0x79,
-	0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC3,0x71,0xA3,0x71,0xA2,0x71,0x82,0x61,0x62,0x59,0x42,0x51,0x42,0x51,0x62,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0x03,0x82,0x03,0x82,0x23,0x8A,0x44,0x8A,0x2B,0xBC,
-	0xCB,0xFC,0xA4,0xF3,0x63,0xEB,0x63,0xEB,0xC3,0xDA,0x23,0xE3,0x02,0xE3,0xE3,0xD2,0xA3,0xD2,0xE3,0xD2,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0xE4,0xE2,0xC4,0xDA,0x84,0xD2,0xE4,0xE2,0x63,0xF3,0x66,0xFC,0x66,0xFC,0x49,0xFD,0x49,0xFD,0xCB,0xFD,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0xC4,0xFB,0x05,0xFC,0xE7,0xEB,
-	0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xA6,0xDB,0x44,0xE3,0xC7,0xE3,0xE7,0xEB,0x85,0xEB,0xA6,0xF3,0x44,0xE3,0x44,0xE3,0x04,0xDB,0xC3,0xBA,0xC3,0xCA,0x04,0xDB,0x85,0xEB,0x24,0xEB,0x24,0xEB,0x24,0xEB,0x44,0xE3,0x24,0xEB,0x64,0xF3,0xC3,0xDA,0xA2,0xDA,0xA3,0xDA,0xE2,0xE2,0xC3,0xDA,0xA2,0xDA,0xC3,0xDA,0xE4,0xE2,
-	0xC3,0xDA,0xE4,0xE2,0xA3,0xDA,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xDA,0xE4,0xE2,0x24,0xEB,0x84,0xD2,0x82,0xC2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xBA,0x44,0xB2,0x44,0xB2,0x44,0xAA,0x44,0xB2,0xA5,0xC2,0xA4,0xCA,0x64,0xBA,0x64,0xBA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x25,0xA2,0x24,0x92,0x24,0x92,
-	0x05,0x92,0x25,0x9A,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x92,0x25,0x9A,0x45,0xA2,0x25,0x9A,0x45,0xA2,0x25,0x9A,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x64,0x92,0x05,0x82,0xA2,0x71,0xC2,0x79,0xE3,0x81,0x03,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,
-	0xA2,0x69,0x82,0x61,0xA2,0x69,0xA3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x04,0x7A,0xE3,0x79,0xC3,0x71,0x03,0x82,0x03,0x82,0x64,0x8A,0x64,0x92,0x84,0x92,0x44,0x8A,0x44,0x8A,0x03,0x82,0x03,0x82,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x84,0x92,0x64,0x9A,0x64,0x9A,
-	0x64,0x9A,0x64,0x92,0x64,0x9A,0xA5,0x9A,0xA5,0x9A,0x84,0x9A,0x84,0x92,0xA5,0x9A,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0x9A,0x84,0x9A,0xA5,0xA2,0xA5,0xA2,0xA5,0x9A,0xA5,0x9A,0x84,0x9A,0xA5,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,
-	0x64,0x92,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x8A,0x03,0x82,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xC2,0x79,0xC3,0x71,0xC2,0x71,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xC2,0x79,0xC2,0x79,0xA3,0x71,0x82,0x61,0x82,0x59,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0x62,0x61,0x82,0x61,
-	0x62,0x61,0x62,0x61,0x82,0x59,0x62,0x59,0x21,0x51,0x42,0x51,0x82,0x61,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0x03,0x82,0x03,0x82,0xA7,0x72,0x4E,0xFE,0xE7,0xF3,0x63,0xF3,0x23,0xE3,0x63,0xEB,0x23,0xEB,0xE2,0xE2,0xA3,0xDA,0xC4,0xDA,0xA2,0xD2,0xE2,0xE2,0xE2,0xE2,0xC3,0xDA,0xA3,0xDA,0xC4,0xDA,0xA3,0xD2,
-	0x22,0xEB,0x63,0xF3,0xC4,0xFB,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xA4,0xF3,0x05,0xFC,0x05,0xFC,0x66,0xFC,0xC4,0xFB,0x85,0xEB,0x05,0xFC,0x66,0xFC,0xA6,0xF3,0xE7,0xEB,0x05,0xFC,0xE7,0xEB,0xE7,0xEB,0xC7,0xE3,0x04,0xDB,0x44,0xE3,0x85,0xEB,0x05,0xFC,0xA6,0xF3,0xE7,0xF3,0xA6,0xF3,0xE3,0xD2,0xA4,0xCA,0x64,0xC2,
-	0x82,0xC2,0x04,0xDB,0x04,0xDB,0x04,0xDB,0x44,0xE3,0x24,0xEB,0x23,0xEB,0x64,0xF3,0x64,0xF3,0xE4,0xE2,0x23,0xE3,0xE4,0xE2,0x23,0xE3,0xA3,0xDA,0xA3,0xD2,0xE2,0xE2,0xA3,0xDA,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xDA,0xA3,0xDA,0xE4,0xE2,0xA3,0xD2,0x64,0xC2,0xA3,0xD2,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0xA3,0xD2,0x64,0xC2,0x64,0xC2,
-	0x64,0xC2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x84,0xD2,0x84,0xD2,0x64,0xB2,0x44,0xAA,0x24,0xA2,0x44,0xAA,0x25,0xA2,0x24,0x9A,0x05,0x92,0x05,0x92,0x24,0x9A,0x45,0xA2,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x92,0x25,0x9A,0x25,0x9A,0x25,0x9A,0x25,0x9A,0x05,0x92,0xE5,0x79,0x05,0x82,0xE5,0x79,0x05,0x82,
-	0x05,0x92,0x05,0x82,0xC2,0x71,0xC2,0x79,0xC2,0x79,0x03,0x82,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0xC3,0x69,0xC3,0x71,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xE3,0x79,
-	0xE3,0x79,0x03,0x82,0x44,0x8A,0x03,0x82,0x03,0x82,0xE3,0x81,0x03,0x82,0x03,0x82,0x44,0x8A,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x9A,0xA5,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0x9A,0x84,0x9A,0xA5,0x9A,0xA5,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,
-	0x84,0x9A,0xA5,0x9A,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA5,0x9A,0x64,0x9A,0x64,0x9A,0xA5,0x9A,0xA5,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x23,0x8A,0x23,0x8A,0xE3,0x79,0xC3,0x71,0xC2,0x79,0xC2,0x71,0x04,0x7A,0xC2,0x79,
-	0xC2,0x79,0x03,0x82,0x03,0x82,0xE3,0x79,0xC3,0x71,0xA2,0x69,0x62,0x61,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x59,0x62,0x59,0x82,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x62,0x59,0x82,0x61,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xC2,0x79,0xE3,0x81,0x03,0x82,
-	0x4E,0xFE,0x28,0xF4,0x63,0xF3,0x63,0xEB,0x23,0xEB,0x23,0xEB,0xE2,0xE2,0xA3,0xDA,0xC3,0xDA,0xE3,0xD2,0xE2,0xE2,0xC3,0xDA,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0xC3,0xDA,0x23,0xEB,0xC4,0xFB,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0xA4,0xF3,0xC4,0xFB,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0xE7,0xEB,0x66,0xFC,
-	0x05,0xFC,0x05,0xFC,0x85,0xEB,0xA4,0xF3,0x85,0xEB,0x24,0xEB,0x44,0xE3,0x04,0xDB,0x85,0xEB,0xA6,0xF3,0xA6,0xF3,0x85,0xEB,0x85,0xEB,0xE3,0xD2,0xE3,0xD2,0xC3,0xBA,0x44,0xB2,0x64,0xC2,0x64,0xC2,0x64,0xBA,0xA4,0xCA,0x04,0xDB,0xE4,0xE2,0x24,0xEB,0x24,0xEB,0x23,0xEB,0x23,0xEB,0xC3,0xDA,0xE4,0xE2,0xE2,0xE2,0xA3,0xDA,0xA3,0xDA,
-	0xA3,0xDA,0xA3,0xD2,0xA3,0xDA,0xA3,0xD2,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0xA3,0xD2,0x84,0xD2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x44,0xB2,0x44,0xB2,0x24,0xA2,0x44,0xAA,0x44,0xB2,0x65,0xBA,0x84,0xD2,0x64,0xBA,0x44,0xAA,0x44,0xAA,0x24,0x9A,0x24,0x9A,0x24,0x9A,0x24,0x92,0x05,0x92,0x05,0x82,
-	0x24,0x92,0x24,0x9A,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x92,0x25,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x69,0x05,0x92,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0x23,0x8A,0x23,0x8A,0xE2,0x81,0x03,0x82,0x23,0x8A,0x03,0x82,0xE2,0x81,0x03,0x82,0x23,0x8A,
-	0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x71,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA2,0x71,0xA2,0x69,0xC3,0x69,0xC3,0x71,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,
-	0x64,0x92,0x64,0x9A,0x64,0x92,0x84,0x92,0x84,0x92,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0xA5,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x92,0x64,0x9A,0x84,0x9A,0x84,0x9A,0xA5,0x9A,0xA5,0xA2,0xA5,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,
-	0x44,0x8A,0x44,0x8A,0x44,0x8A,0x03,0x82,0xE3,0x79,0xC2,0x79,0x03,0x82,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xC3,0x71,0xC3,0x71,0x03,0x82,0x03,0x82,0x03,0x82,0xC2,0x79,0xA2,0x71,0x82,0x61,0x82,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,
-	0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x82,0x59,0x82,0x61,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x79,0xC2,0x79,0x4D,0xD5,0xC8,0xFC,0x63,0xF3,0x42,0xF3,0x23,0xEB,0x23,0xEB,0x23,0xE3,0xE2,0xE2,0xC3,0xDA,0x03,0xDB,0xA3,0xD2,0xA3,0xDA,0xA3,0xDA,0xC3,0xDA,0x84,0xD2,0x64,0xC2,
-	0x03,0xDB,0xC4,0xFB,0x63,0xEB,0xA4,0xF3,0x05,0xFC,0x66,0xFC,0xC8,0xFC,0x49,0xFD,0x05,0xFC,0x63,0xF3,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0x05,0xFC,0x05,0xFC,0x85,0xEB,0x44,0xE3,0x03,0xDB,0x44,0xE3,0x44,0xE3,0x44,0xE3,0xE7,0xEB,0xE7,0xF3,0x85,0xEB,0x64,0xF3,0x85,0xEB,0x44,0xE3,0x64,0xBA,
-	0x23,0x9A,0x43,0xB2,0x43,0xB2,0x43,0xB2,0x64,0xC2,0xA4,0xCA,0xC4,0xDA,0xE4,0xE2,0xC4,0xDA,0x44,0xE3,0xC4,0xDA,0xC3,0xDA,0xA3,0xDA,0xE4,0xE2,0xA3,0xDA,0xA3,0xDA,0xA3,0xDA,0xA3,0xD2,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xA3,0xDA,0x64,0xC2,0x82,0xBA,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x84,0xD2,0xA3,0xD2,0x84,0xD2,0x84,0xD2,0x84,0xD2,
-	0x64,0xBA,0x44,0xAA,0x25,0xA2,0x25,0xA2,0x44,0xB2,0x44,0xAA,0x64,0xB2,0x25,0xA2,0x25,0xA2,0x24,0x9A,0x25,0x9A,0x24,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0x05,0x92,0x05,0x92,0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xC5,0x61,
-	0x05,0x82,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xE3,0x81,0xE2,0x81,0xE3,0x81,0x23,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xE3,0x81,0xE3,0x81,0x03,0x82,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0x62,0x61,0x62,0x59,0x82,0x61,0xA3,0x69,0xC2,0x69,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xA3,0x71,0xA3,0x71,0xA2,0x69,0x82,0x69,
-	0xA3,0x71,0xE3,0x79,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x44,0x8A,0x44,0x8A,0x03,0x82,0x23,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x43,0x92,0x23,0x8A,0x44,0x8A,0x64,0x92,0x44,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x9A,0x84,0x92,0x64,0x9A,0x64,0x92,0x84,0x92,0x84,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x92,
-	0x64,0x92,0x64,0x92,0x64,0x9A,0xA5,0x9A,0xA4,0xA2,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x64,0x92,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xC3,0x71,0xC2,0x79,0xC2,0x71,0xC2,0x71,
-	0xC3,0x71,0xE3,0x79,0x03,0x82,0x03,0x82,0xC2,0x79,0xA2,0x71,0xA2,0x69,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x21,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x82,0x61,0x82,0x61,0xA2,0x69,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xC3,0x71,
-	0x2B,0xBC,0xCB,0xFD,0x28,0xF4,0xA4,0xF3,0x42,0xF3,0x22,0xEB,0x23,0xEB,0x23,0xE3,0xE2,0xDA,0xE2,0xDA,0xA3,0xDA,0xA3,0xDA,0xC3,0xDA,0xC4,0xDA,0xA3,0xD2,0xA2,0xDA,0x23,0xEB,0xC3,0xDA,0x22,0xEB,0xA4,0xF3,0xA4,0xF3,0x63,0xEB,0x63,0xEB,0xC8,0xFC,0x66,0xFC,0x63,0xF3,0x05,0xFC,0x63,0xF3,0xA4,0xF3,0xA4,0xF3,0x63,0xEB,0x85,0xEB,
-	0x85,0xEB,0x85,0xEB,0x05,0xFC,0x85,0xEB,0xE3,0xD2,0x03,0xDB,0x44,0xE3,0xE7,0xEB,0x85,0xEB,0x85,0xEB,0xA6,0xF3,0x85,0xEB,0x85,0xEB,0xA6,0xF3,0x44,0xE3,0x43,0xB2,0x43,0xAA,0x43,0xB2,0x24,0xA2,0x24,0xA2,0xC3,0xBA,0x04,0xDB,0x04,0xDB,0xE3,0xD2,0x44,0xB2,0x04,0xDB,0xA4,0xCA,0xE4,0xE2,0xC4,0xDA,0xC3,0xDA,0xE4,0xE2,0xA2,0xDA,
-	0xA3,0xDA,0xE4,0xE2,0x24,0xEB,0xE4,0xE2,0xA3,0xD2,0xC3,0xDA,0x84,0xD2,0x44,0xB2,0x44,0xB2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x44,0xB2,0x44,0xAA,0x24,0xA2,0x64,0xB2,0x44,0xB2,0x64,0xBA,0x44,0xB2,0x24,0x9A,0x44,0xAA,0x25,0xA2,0x24,0x92,0x05,0x92,0x03,0x8A,0x05,0x82,0x05,0x82,0x05,0x82,
-	0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x79,0x05,0x92,0x05,0x82,0xE5,0x69,0xE5,0x69,0xC3,0x61,0xE5,0x69,0xC5,0x61,0x84,0x61,0x05,0x82,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x81,0xE3,0x81,0xE3,0x81,0x03,0x82,0x23,0x8A,0x03,0x82,0x03,0x82,0xE3,0x81,0xC2,0x79,0xE3,0x79,0x03,0x82,0x03,0x82,
-	0x82,0x59,0x82,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x82,0x59,0x82,0x61,0xA3,0x71,0xC3,0x71,0xA3,0x71,0x82,0x69,0x82,0x61,0xA2,0x69,0xA3,0x69,0xC3,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xE3,0x79,0x03,0x82,0x23,0x8A,0x03,0x82,0x03,0x82,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,
-	0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x84,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x84,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x84,0x92,0x64,0x92,0x64,0x92,0x84,0x9A,0xA5,0x9A,0xA5,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x44,0x8A,
-	0x44,0x8A,0xE3,0x79,0xC2,0x79,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x23,0x8A,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xE3,0x79,0x03,0x82,0xE3,0x79,0xA3,0x71,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x62,0x59,0x42,0x51,
-	0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0x49,0x93,0x4E,0xFE,0xC8,0xFC,0x05,0xFC,0x63,0xF3,0x22,0xEB,0x22,0xEB,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xC3,0xDA,0xC3,0xDA,0xE2,0xE2,0xE2,0xE2,0xC3,0xDA,
-	0xC3,0xDA,0xE2,0xE2,0x03,0xDB,0x63,0xEB,0x05,0xFC,0x05,0xFC,0x42,0xF3,0x66,0xFC,0x66,0xFC,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0x63,0xEB,0x63,0xEB,0x63,0xEB,0x63,0xEB,0x05,0xFC,0x05,0xFC,0xA4,0xF3,0x85,0xEB,0x23,0xE3,0x03,0xDB,0xE3,0xD2,0x44,0xE3,0x44,0xE3,0x44,0xE3,0x85,0xEB,0x85,0xEB,0xA6,0xF3,0x66,0xFC,0x24,0xEB,0xE3,0xD2,
-	0x64,0xBA,0x43,0xB2,0x64,0xBA,0x44,0xB2,0x43,0xB2,0x64,0xBA,0x64,0xC2,0x64,0xBA,0x23,0x9A,0x44,0xB2,0xC4,0xDA,0x45,0xDB,0x04,0xDB,0xA3,0xD2,0xE4,0xE2,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0x84,0xD2,0xC4,0xDA,0xA3,0xD2,0xA3,0xD2,0x84,0xD2,0x64,0xBA,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0xA4,0xCA,0x64,0xC2,0x64,0xBA,
-	0x64,0xB2,0x44,0xAA,0x44,0xAA,0x64,0xBA,0x64,0xC2,0x65,0xBA,0x25,0xA2,0x05,0x92,0x24,0x9A,0x25,0xA2,0x25,0x9A,0x24,0x92,0x05,0x82,0x05,0x82,0x03,0x8A,0x05,0x82,0xE5,0x79,0x03,0x8A,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0x84,0x61,
-	0x05,0x82,0xC2,0x79,0xC2,0x79,0xE3,0x81,0x03,0x82,0xE3,0x79,0xE2,0x81,0x03,0x82,0x03,0x82,0x23,0x8A,0x03,0x8A,0x03,0x82,0xC2,0x79,0xE2,0x81,0x03,0x82,0x03,0x8A,0x22,0x49,0x21,0x51,0x22,0x51,0x22,0x51,0x62,0x59,0x42,0x51,0x21,0x51,0x42,0x51,0x82,0x59,0xA2,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0xA2,0x69,
-	0xA3,0x69,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0xC3,0x71,0xE3,0x79,0x03,0x82,0x44,0x8A,0x44,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x84,0x92,0x64,0x9A,
-	0x84,0x9A,0xA5,0x9A,0x84,0x9A,0x84,0x92,0x64,0x92,0x64,0x9A,0x84,0x92,0x84,0x92,0x64,0x92,0x84,0x92,0x64,0x92,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xA2,0x71,
-	0xA2,0x69,0xA2,0x71,0xE3,0x79,0xC3,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x69,0x82,0x61,0x62,0x61,0x82,0x61,0x62,0x59,0x21,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x61,0x82,0x61,0xA2,0x61,
-	0xA7,0x72,0x4E,0xFE,0xCB,0xFC,0x66,0xFC,0x05,0xFC,0x22,0xEB,0x02,0xE3,0xE2,0xE2,0xE2,0xE2,0x22,0xEB,0xE2,0xE2,0x02,0xE3,0x22,0xEB,0xE2,0xDA,0xA2,0xDA,0xC3,0xDA,0xC3,0xDA,0xC3,0xDA,0xC3,0xDA,0xA1,0xD2,0x63,0xEB,0x05,0xFC,0x05,0xFC,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x22,0xEB,0x05,0xFC,0x23,0xE3,
-	0x05,0xFC,0x66,0xFC,0xC4,0xFB,0x02,0xE3,0x44,0xE3,0x23,0xE3,0x03,0xDB,0xE3,0xD2,0x85,0xEB,0x04,0xDB,0x44,0xE3,0x24,0xEB,0x85,0xEB,0x85,0xEB,0x44,0xE3,0x85,0xEB,0x44,0xE3,0x64,0xC2,0xC3,0xBA,0x83,0xB2,0x43,0xB2,0x44,0xB2,0x83,0xB2,0x44,0xB2,0x64,0xBA,0x83,0xB2,0xA4,0xCA,0xC4,0xDA,0x04,0xDB,0x04,0xDB,0xC3,0xDA,0xE4,0xE2,
-	0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0x84,0xD2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x44,0xAA,0x24,0xA2,0x44,0xAA,0x44,0xAA,0x44,0xAA,0xA5,0xC2,0x44,0xB2,0x25,0xA2,0x24,0x92,0x25,0xA2,0x25,0xA2,0x24,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,
-	0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0x05,0x82,0x05,0x82,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC3,0x61,0xC5,0x61,0xC5,0x61,0x03,0x8A,0x03,0x82,0xE2,0x81,0xE2,0x81,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x81,0xE3,0x79,0xE3,0x81,0x03,0x82,
-	0x01,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x22,0x49,0x22,0x51,0x22,0x49,0x21,0x51,0x62,0x59,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xC2,0x69,0xC3,0x71,0x04,0x7A,0xE3,0x79,0xE3,0x79,0x04,0x7A,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x81,0x03,0x82,0x44,0x8A,0x44,0x8A,
-	0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x84,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x92,0x44,0x8A,0x44,0x8A,0x64,0x92,0x64,0x9A,0x85,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x03,0x82,
-	0xE3,0x79,0xC2,0x79,0xE3,0x79,0x03,0x82,0x03,0x82,0x23,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0x03,0x82,0xC3,0x71,0xC2,0x79,0xE3,0x79,0xC3,0x71,0xA3,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x71,0xA3,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x62,0x61,0x62,0x59,0x42,0x51,0x62,0x59,0x21,0x51,0x22,0x51,
-	0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x82,0x59,0x4D,0xD5,0x4E,0xFE,0xC8,0xFC,0x66,0xFC,0x63,0xEB,0xE2,0xE2,0x22,0xEB,0x23,0xEB,0xC4,0xFB,0xE2,0xE2,0x02,0xE3,0xA2,0xDA,0xE2,0xE2,0xA2,0xDA,0xE2,0xDA,
-	0xE2,0xE2,0xA2,0xD2,0xE2,0xDA,0xC1,0xDA,0xC1,0xDA,0xC4,0xFB,0x63,0xF3,0x42,0xF3,0x42,0xF3,0x42,0xF3,0x42,0xF3,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x66,0xFC,0x05,0xFC,0x02,0xE3,0x63,0xEB,0x23,0xEB,0x05,0xFC,0x23,0xE3,0x23,0xE3,0xC3,0xDA,0xC2,0xD2,0x44,0xE3,0x03,0xDB,0xC2,0xD2,0xA3,0xD2,0x03,0xDB,0x23,0xE3,0x04,0xDB,0x85,0xEB,
-	0x66,0xEB,0x44,0xE3,0x43,0xB2,0x24,0xA2,0x23,0x9A,0x44,0xB2,0xE3,0xD2,0x64,0xBA,0xA5,0xC2,0x44,0xAA,0xA4,0xCA,0x84,0xD2,0xC3,0xDA,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xA3,0xDA,0x64,0xC2,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xBA,0x64,0xBA,0x84,0xD2,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xBA,0x44,0xAA,
-	0x44,0xAA,0x25,0xA2,0x44,0xAA,0x64,0xB2,0x44,0xB2,0x44,0xAA,0x24,0x9A,0x25,0x9A,0x44,0xAA,0x25,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0x04,0x7A,0x05,0x82,0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x69,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xE5,0x69,
-	0x23,0x8A,0x03,0x8A,0x03,0x82,0x03,0x8A,0x03,0x82,0xE2,0x81,0x03,0x82,0x03,0x82,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x42,0x51,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x82,0x59,
-	0x82,0x59,0x82,0x61,0xA2,0x69,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0x03,0x82,0x23,0x8A,0x44,0x8A,0x23,0x8A,0x03,0x82,0x03,0x82,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x84,0x92,0x64,0x92,0x44,0x8A,
-	0x44,0x8A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x81,0xE3,0x79,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x79,0x03,0x82,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x71,
-	0xC3,0x71,0xA3,0x69,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x22,0x51,0x21,0x51,0x62,0x59,0x62,0x59,0x21,0x51,0x62,0x59,0x42,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x61,0x62,0x59,
-	0x62,0x61,0x49,0x93,0x4E,0xFE,0xCB,0xFD,0x49,0xFD,0x66,0xFC,0x64,0xF3,0xE2,0xE2,0x22,0xEB,0xA4,0xF3,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xA2,0xDA,0xE2,0xE2,0xE2,0xE2,0xA3,0xD2,0xA2,0xDA,0xC1,0xDA,0xC1,0xDA,0xC1,0xDA,0x63,0xF3,0xC1,0xDA,0x22,0xEB,0x22,0xEB,0x22,0xEB,0x42,0xF3,0x63,0xF3,0x63,0xEB,0x63,0xEB,0x63,0xEB,
-	0x63,0xEB,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x63,0xEB,0xE2,0xE2,0xA2,0xDA,0xE2,0xDA,0xE2,0xDA,0xA2,0xD2,0xE3,0xD2,0x82,0xCA,0x82,0xC2,0x82,0xCA,0xA3,0xD2,0x04,0xDB,0x45,0xDB,0x85,0xEB,0xA4,0xCA,0x43,0xB2,0x23,0x9A,0x43,0xB2,0x64,0xBA,0x44,0xAA,0x24,0xA2,0x44,0xAA,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0xC3,0xDA,0xE4,0xE2,0xA3,0xDA,
-	0xA3,0xD2,0x64,0xC2,0x64,0xC2,0xA3,0xDA,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x84,0xD2,0xC4,0xDA,0xA3,0xDA,0xE4,0xE2,0x64,0xC2,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x44,0xB2,0x25,0xA2,0x44,0xB2,0x64,0xBA,0x64,0xB2,0x05,0x92,0x24,0x9A,0x24,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0x05,0x82,0x05,0x82,
-	0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0x84,0x61,0xC5,0x61,0x84,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0x05,0x82,0x03,0x8A,0x23,0x8A,0x03,0x82,0x03,0x8A,0x03,0x82,0xE2,0x81,0x03,0x82,0x03,0x82,0xC2,0x79,0xC2,0x79,0xC3,0x71,0xA2,0x71,0xC2,0x71,0xE3,0x79,0xC2,0x79,0xC2,0x79,
-	0x22,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x22,0x51,0x42,0x51,0x62,0x59,0x82,0x59,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0xA2,0x69,0xA3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0xC2,0x71,0xC2,0x71,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,
-	0x03,0x82,0xE3,0x79,0xE3,0x81,0x03,0x82,0x03,0x82,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x23,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x03,0x82,0xE3,0x81,
-	0xE3,0x81,0x03,0x82,0xE3,0x79,0xE3,0x81,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xC2,0x71,0xA3,0x71,0xA2,0x69,0xA3,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x42,0x51,
-	0x22,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x61,0x82,0x61,0x62,0x61,0xA7,0x72,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0xC8,0xFC,0xC4,0xFB,0x22,0xEB,0xE2,0xE2,0xE2,0xE2,0xA2,0xDA,0xA2,0xDA,0xA2,0xDA,0xA2,0xDA,0xE2,0xE2,0xE2,0xE2,
-	0xE2,0xE2,0xE2,0xDA,0xC3,0xDA,0xC1,0xDA,0x02,0xE3,0xC1,0xDA,0xE2,0xDA,0x42,0xF3,0x22,0xEB,0xE2,0xE2,0x02,0xE3,0x22,0xEB,0x42,0xF3,0x63,0xF3,0x63,0xF3,0x63,0xEB,0x63,0xF3,0x05,0xFC,0x05,0xFC,0xC8,0xFC,0x63,0xF3,0xE2,0xDA,0x82,0xCA,0xC2,0xD2,0xA3,0xDA,0xA2,0xD2,0xA3,0xD2,0xA3,0xD2,0x82,0xC2,0x82,0xC2,0xA3,0xD2,0xC3,0xBA,
-	0x64,0xBA,0x44,0xE3,0x64,0xC2,0x43,0xB2,0x24,0x92,0x24,0xA2,0x23,0x92,0x03,0x8A,0x03,0x8A,0x64,0xBA,0xE4,0xE2,0xE4,0xE2,0xC3,0xDA,0xE4,0xE2,0xA3,0xDA,0xC3,0xDA,0xA3,0xDA,0x64,0xC2,0xA3,0xDA,0xA3,0xDA,0x84,0xD2,0xA3,0xDA,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x84,0xD2,0xC4,0xDA,0xE4,0xE2,0xA3,0xDA,0x64,0xC2,0x44,0xB2,0x25,0xA2,
-	0x44,0xAA,0x44,0xAA,0x25,0xA2,0x44,0xAA,0x65,0xBA,0x44,0xAA,0x05,0x92,0x24,0x9A,0x05,0x82,0x24,0x92,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0x04,0x7A,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0x84,0x61,0xA5,0x51,0x03,0x82,
-	0x03,0x82,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x79,0xC2,0x79,0xC3,0x71,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x21,0x51,0x22,0x49,0x42,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x62,0x59,
-	0x62,0x59,0x82,0x59,0x62,0x61,0x82,0x61,0xA2,0x69,0xA3,0x71,0xC3,0x71,0xA3,0x71,0xC3,0x71,0xC3,0x71,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xC3,0x71,0x04,0x7A,0xE3,0x79,0xE3,0x79,0x03,0x82,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x03,0x82,0xE3,0x79,0x03,0x82,0x03,0x82,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x03,0x82,0x03,0x82,
-	0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x44,0x8A,0x44,0x8A,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x81,0x03,0x82,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x71,0xC2,0x79,0xC2,0x79,0xC3,0x71,0xC3,0x71,0xC3,0x69,0xA3,0x71,
-	0xA2,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x69,0x62,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x59,0x62,0x59,0x82,0x61,
-	0x62,0x61,0x83,0x61,0xB0,0xED,0x4E,0xFE,0xCB,0xFD,0x49,0xFD,0xE7,0xF3,0x63,0xF3,0x42,0xF3,0xA2,0xDA,0xA2,0xD2,0xA2,0xD2,0xA2,0xD2,0x82,0xCA,0xA2,0xDA,0xE2,0xE2,0xE2,0xE2,0xA2,0xDA,0xE2,0xE2,0xE2,0xDA,0xC2,0xD2,0xC2,0xD2,0x82,0xCA,0x63,0xEB,0x63,0xEB,0x03,0xDB,0xC1,0xDA,0x02,0xE3,0x42,0xF3,0x63,0xF3,0xC4,0xFB,0x02,0xE3,
-	0x42,0xF3,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0xA4,0xF3,0xA2,0xDA,0xC2,0xD2,0x82,0xCA,0xA2,0xDA,0xA2,0xD2,0x82,0xCA,0xA3,0xD2,0x82,0xBA,0xC3,0xBA,0x44,0xE3,0x84,0xD2,0x43,0xB2,0x04,0xCB,0x64,0xBA,0x64,0xBA,0x43,0xB2,0x43,0xB2,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x64,0xBA,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xE4,0xE2,0xE4,0xE2,0xA3,0xDA,
-	0xA3,0xDA,0xA3,0xD2,0x84,0xD2,0x84,0xD2,0xA3,0xDA,0xA3,0xDA,0x84,0xD2,0x44,0xB2,0x64,0xC2,0xA3,0xD2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x44,0xAA,0x44,0xAA,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x65,0xBA,0x64,0xB2,0x25,0x9A,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0x03,0x8A,0x05,0x82,0xE5,0x79,
-	0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xC5,0x61,0x84,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0x84,0x61,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x81,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xA2,0x71,0xA2,0x71,0xA3,0x71,0xA2,0x71,0xA2,0x71,
-	0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x22,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x22,0x51,0x22,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x62,0x59,0x82,0x61,0xA2,0x69,0xA3,0x69,0xA3,0x69,0xA2,0x69,0xA3,0x71,0xC3,0x69,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xC3,0x71,
-	0xC3,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0x03,0x82,0xE3,0x79,0xE3,0x79,0x03,0x82,0x44,0x8A,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC3,0x69,0xA3,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,
-	0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0x44,0x8A,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xA3,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x21,0x51,
-	0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x61,0x61,0x2B,0xBC,0xD4,0xF6,0xB0,0xED,0x49,0xFD,0xCB,0xFD,0xC8,0xFC,0x63,0xF3,0xE2,0xE2,0x82,0xCA,0xA2,0xD2,0x82,0xCA,0x82,0xCA,0xA2,0xD2,0xE2,0xE2,
-	0xE2,0xE2,0xE2,0xDA,0xE2,0xDA,0xC1,0xDA,0xA2,0xDA,0xC2,0xD2,0xC2,0xD2,0x63,0xEB,0xA4,0xF3,0x02,0xE3,0xC1,0xDA,0x02,0xE3,0x02,0xE3,0x63,0xF3,0xC4,0xFB,0xA4,0xF3,0x02,0xE3,0xC4,0xFB,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xE2,0xDA,0xA2,0xD2,0x82,0xCA,0xC3,0xCA,0x82,0xCA,0x82,0xCA,0x82,0xCA,0xC3,0xCA,0x82,0xC2,0x23,0xE3,0xA3,0xD2,
-	0x64,0xC2,0x43,0xB2,0x43,0xB2,0x82,0xBA,0x82,0xBA,0x44,0xB2,0x43,0xB2,0x44,0xAA,0x03,0x8A,0x24,0xA2,0x64,0xC2,0xA3,0xDA,0xA3,0xDA,0xC3,0xDA,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,0x84,0xD2,0x84,0xD2,0xC4,0xDA,0xE4,0xE2,0xE4,0xE2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x25,0xA2,0x44,0xAA,
-	0x25,0xA2,0x44,0xAA,0x44,0xAA,0x65,0xBA,0x25,0xA2,0x25,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xA5,0x51,0x64,0x39,0xE5,0x79,0x03,0x82,
-	0x03,0x82,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xE3,0x81,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x71,0xC2,0x71,0x82,0x69,0x82,0x69,0xA2,0x71,0xA2,0x71,0xC2,0x71,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x22,0x51,0x22,0x49,0x22,0x51,0x22,0x51,
-	0x42,0x51,0x62,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x71,0xA3,0x71,0xA2,0x69,0xA2,0x69,0xC2,0x69,0xC3,0x71,0xC2,0x71,0xA2,0x71,0xC2,0x71,0xA2,0x71,0xC2,0x71,0xC3,0x71,0xC3,0x71,0xE3,0x79,0xC3,0x71,0xE3,0x79,0xC3,0x71,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC3,0x71,
-	0xC2,0x71,0xA3,0x71,0xC3,0x69,0xA3,0x71,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0xC3,0x69,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0x03,0x82,0x03,0x82,0xE3,0x79,0xC2,0x79,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA2,0x71,0xA2,0x69,
-	0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,
-	0x82,0x61,0x82,0x61,0x84,0x51,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x05,0xFC,0x42,0xF3,0xE2,0xDA,0x82,0xC2,0xA2,0xD2,0xA2,0xD2,0xA2,0xD2,0xA2,0xDA,0xE2,0xE2,0xA2,0xDA,0xC3,0xDA,0xA1,0xD2,0x02,0xE3,0x82,0xCA,0xC3,0xCA,0x23,0xE3,0x23,0xE3,0x02,0xE3,0x23,0xE3,0x23,0xE3,0x02,0xE3,0x22,0xEB,0x42,0xF3,0x63,0xEB,
-	0x05,0xFC,0xA4,0xF3,0x05,0xFC,0x05,0xFC,0x66,0xFC,0x23,0xE3,0xC2,0xD2,0xE3,0xD2,0x82,0xC2,0x82,0xC2,0x03,0xDB,0xC2,0xD2,0xC3,0xDA,0x03,0xDB,0xA3,0xD2,0xA3,0xDA,0x82,0xBA,0x82,0xBA,0x82,0xBA,0x82,0xBA,0x24,0xA2,0x03,0x8A,0x23,0x9A,0x44,0xB2,0x23,0x9A,0x03,0x8A,0x43,0xB2,0x64,0xC2,0xA3,0xDA,0x84,0xD2,0xA3,0xDA,0xA3,0xDA,
-	0xA3,0xDA,0x82,0xCA,0x64,0xC2,0xC4,0xDA,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0x64,0xC2,0x84,0xD2,0x44,0xB2,0x64,0xBA,0x44,0xAA,0x44,0xB2,0x44,0xAA,0x64,0xB2,0x44,0xB2,0x45,0xAA,0x45,0xAA,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0x05,0x82,0x03,0x8A,0x05,0x82,0xE5,0x69,0xE5,0x69,0xE5,0x79,
-	0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xC5,0x61,0x84,0x61,0xA5,0x51,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0x03,0x82,0x03,0x82,0xE3,0x81,0xC2,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x79,0xC2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0x82,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,
-	0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x51,0x22,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x62,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xC2,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xC3,0x71,0xC3,0x71,
-	0xA2,0x71,0xA3,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC3,0x71,0xC2,0x71,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA3,0x71,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0xC2,0x71,0xC3,0x71,0xE3,0x79,0x04,0x7A,0xE3,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x79,
-	0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x59,0x62,0x59,0x62,0x61,0x82,0x59,
-	0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x4D,0xD5,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x66,0xFC,0x42,0xF3,0x22,0xEB,0xC1,0xDA,0x82,0xCA,0xA1,0xD2,0xA2,0xDA,0xA2,0xD2,
-	0xE2,0xDA,0xE2,0xE2,0xE2,0xDA,0xC2,0xD2,0xE2,0xDA,0xC2,0xD2,0xC2,0xD2,0x03,0xDB,0x03,0xDB,0xC2,0xD2,0xC4,0xFB,0xC4,0xFB,0x22,0xEB,0x02,0xE3,0x22,0xEB,0x63,0xEB,0x63,0xEB,0x63,0xEB,0x63,0xEB,0x63,0xEB,0x63,0xEB,0x23,0xE3,0xC3,0xCA,0x03,0xDB,0xA2,0xD2,0xA2,0xDA,0x05,0xFC,0x23,0xE3,0x82,0xC2,0x82,0xC2,0x82,0xC2,0xC3,0xCA,
-	0xA3,0xD2,0x82,0xCA,0x82,0xBA,0x43,0xB2,0x23,0x9A,0x03,0x8A,0x24,0xA2,0x43,0xAA,0x23,0x9A,0x03,0x8A,0x44,0xB2,0x64,0xC2,0x43,0xB2,0x64,0xC2,0x64,0xC2,0xA3,0xDA,0xA3,0xDA,0xA2,0xD2,0x64,0xC2,0xA3,0xDA,0xE4,0xE2,0xC4,0xDA,0xA3,0xDA,0xA3,0xDA,0x84,0xD2,0xC4,0xDA,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xBA,0x44,0xB2,0x44,0xAA,
-	0x44,0xAA,0x25,0xA2,0x44,0xAA,0x05,0x92,0x05,0x92,0x25,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x92,0x05,0x92,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x69,0x05,0x82,0xE5,0x79,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0x84,0x61,0xC2,0x79,0xC2,0x79,
-	0xC2,0x79,0xC2,0x71,0xC2,0x79,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xA2,0x71,0x82,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0x82,0x69,0x82,0x69,0xA3,0x71,0x82,0x69,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x51,0x22,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,
-	0x42,0x51,0x62,0x59,0x62,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xC3,0x69,0xA3,0x71,0xC3,0x71,0xC2,0x71,0xC3,0x69,0xA2,0x69,0xA2,0x71,0xC3,0x69,0xC3,0x71,0x82,0x69,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA3,0x71,0xA2,0x69,0xA2,0x69,
-	0xA2,0x69,0x82,0x61,0x82,0x61,0xA3,0x69,0xA3,0x69,0xA2,0x69,0x82,0x69,0xA3,0x69,0xA3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x79,0xE3,0x79,0xC3,0x71,0xC2,0x71,0xC2,0x79,0xC3,0x71,0xC2,0x79,0xC2,0x71,0xC3,0x71,0xC2,0x79,0xC2,0x71,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC3,0x69,0xA2,0x69,
-	0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x61,
-	0x62,0x61,0x82,0x61,0x82,0x61,0xA7,0x72,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xC4,0xFB,0xE2,0xE2,0xC1,0xDA,0xA1,0xD2,0xE2,0xDA,0x82,0xCA,0xA2,0xD2,0xA2,0xD2,0x02,0xE3,0x22,0xEB,0xC1,0xDA,0xE2,0xDA,0xE2,0xDA,0x63,0xEB,0x02,0xE3,0x02,0xE3,0x03,0xDB,0x22,0xEB,0x63,0xF3,0xC4,0xFB,0x02,0xE3,0x23,0xEB,0x02,0xE3,
-	0x23,0xEB,0x02,0xE3,0x23,0xEB,0x23,0xEB,0x63,0xEB,0x63,0xEB,0x23,0xEB,0x82,0xCA,0x03,0xDB,0xA4,0xF3,0x05,0xFC,0x05,0xFC,0xA3,0xD2,0x82,0xC2,0x82,0xCA,0x82,0xC2,0xA3,0xD2,0x64,0xC2,0x43,0xB2,0x43,0xB2,0x24,0xA2,0x23,0x92,0x43,0xAA,0x24,0x9A,0x23,0x92,0x03,0x8A,0x23,0x9A,0x44,0xB2,0x24,0xA2,0x44,0xAA,0x64,0xC2,0xC3,0xDA,
-	0xE2,0xE2,0xA3,0xDA,0xA3,0xDA,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x65,0xBA,0x44,0xB2,0x44,0xAA,0x44,0xB2,0x44,0xAA,0x45,0xAA,0x25,0x9A,0x05,0x92,0x05,0x92,0x25,0x9A,0x05,0x82,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,
-	0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xC5,0x61,0x84,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0x64,0x39,0x64,0x39,0xE5,0x79,0xA2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x79,0xC2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0x82,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0x82,0x69,0xA2,0x69,
-	0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x51,0x22,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x62,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0xA3,0x69,0xA3,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xC2,0x69,
-	0xC3,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x71,0xC3,0x69,0xC3,0x71,0xA3,0x71,0xA3,0x69,0xC3,0x69,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA3,0x71,0xC3,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xC3,0x69,0xA3,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xC2,0x71,
-	0xC3,0x71,0xC2,0x79,0xC2,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC3,0x71,0xA3,0x71,0xA2,0x69,0xA3,0x69,0xA3,0x69,0xA3,0x71,0xA3,0x69,0x82,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0x82,0x61,0x62,0x61,0x82,0x61,0x62,0x61,
-	0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0xA2,0x69,0x82,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x59,0x4D,0xD5,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x66,0xFC,0x42,0xF3,0xE2,0xE2,0xE2,0xE2,0xC1,0xDA,0xA1,0xD2,0x82,0xCA,
-	0xA2,0xDA,0x63,0xF3,0x42,0xF3,0x42,0xF3,0xE2,0xE2,0x63,0xEB,0x02,0xE3,0x02,0xE3,0x02,0xE3,0x22,0xEB,0x23,0xEB,0x23,0xEB,0x63,0xEB,0x02,0xE3,0x23,0xE3,0x02,0xE3,0x23,0xEB,0x63,0xEB,0xE2,0xDA,0xE2,0xDA,0x23,0xE3,0x63,0xEB,0x23,0xE3,0x23,0xE3,0x44,0xE3,0x64,0xF3,0x05,0xFC,0x05,0xFC,0xC3,0xDA,0x82,0xC2,0x82,0xC2,0x64,0xC2,
-	0x82,0xC2,0x82,0xC2,0x82,0xC2,0x43,0xAA,0x23,0x9A,0x24,0x92,0x03,0x8A,0x23,0x9A,0x24,0x9A,0x03,0x8A,0x03,0x8A,0x24,0x9A,0x23,0x9A,0x24,0xA2,0x64,0xC2,0xA3,0xDA,0xA3,0xDA,0xE4,0xE2,0xA3,0xDA,0xC4,0xDA,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x45,0xAA,0x44,0xB2,
-	0x44,0xAA,0x44,0xAA,0x05,0x92,0x05,0x92,0x25,0x9A,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0x64,0x39,0x84,0x61,0xA2,0x71,0xC2,0x71,0xC2,0x71,
-	0xC2,0x79,0xE3,0x79,0xC2,0x71,0xA2,0x71,0x82,0x69,0x82,0x69,0xA2,0x71,0xA2,0x71,0xA3,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x71,0xA2,0x69,0x82,0x69,0x82,0x69,0x82,0x69,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,
-	0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x61,0x82,0x59,0x62,0x61,0x62,0x61,0x82,0x61,0xA3,0x61,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x61,0xA2,0x69,0xA3,0x69,0xA3,0x71,0xC3,0x69,0xA2,0x69,0xA3,0x71,0xC3,0x71,0xA3,0x71,0xC2,0x69,0xC2,0x69,0xA2,0x71,0xA3,0x71,0xC3,0x71,0xC3,0x71,0xA3,0x71,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA3,0x69,
-	0xA3,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xC2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xC2,0x69,0xA3,0x71,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA2,0x71,0xA3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,
-	0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x61,0x82,0x61,
-	0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0xE5,0x69,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x63,0xF3,0x63,0xEB,0xC1,0xDA,0xC1,0xDA,0xA2,0xDA,0xA2,0xD2,0x82,0xCA,0xE2,0xDA,0x22,0xEB,0x63,0xF3,0xE2,0xE2,0x42,0xF3,0x22,0xEB,0x22,0xEB,0x02,0xE3,0x02,0xE3,0x22,0xEB,0x42,0xF3,0x23,0xEB,0x63,0xF3,0x22,0xEB,0x02,0xE3,
-	0xE2,0xDA,0x03,0xDB,0xE2,0xDA,0xE2,0xDA,0xA2,0xD2,0xE3,0xD2,0xE3,0xD2,0x03,0xDB,0x23,0xE3,0x85,0xEB,0x85,0xEB,0x05,0xFC,0x24,0xEB,0x82,0xCA,0x82,0xCA,0x64,0xC2,0x82,0xC2,0xA3,0xD2,0x64,0xC2,0x82,0xBA,0x24,0xA2,0x22,0xA2,0x24,0xA2,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x24,0x9A,0x43,0xB2,0x84,0xD2,
-	0xA3,0xDA,0xE4,0xE2,0xE4,0xE2,0x84,0xD2,0xA3,0xDA,0xC4,0xDA,0xA3,0xDA,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x65,0xBA,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x65,0xBA,0x44,0xAA,0x25,0xA2,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x69,0xE5,0x69,0xE5,0x79,0x05,0x82,0xE5,0x79,
-	0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x64,0x39,0xE5,0x69,0x82,0x69,0xA2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xA3,0x71,0x82,0x69,0xA2,0x69,0xA2,0x71,0x82,0x69,0xA3,0x71,0xA2,0x69,0xA2,0x71,0xA3,0x71,0x82,0x69,0x82,0x69,0x82,0x69,0x82,0x61,0x82,0x61,
-	0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x21,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x21,0x51,0x21,0x51,0x22,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x82,0x59,0x62,0x59,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA3,0x69,
-	0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0xC3,0x69,0xA2,0x69,0x82,0x69,0xA2,0x71,0xA3,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x69,0xA3,0x69,0xA2,0x71,
-	0xA2,0x69,0xA3,0x71,0xA3,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x69,0x82,0x69,0xA2,0x71,0xC3,0x71,0xA2,0x71,0xA3,0x71,0xC3,0x71,0xA2,0x69,0xA2,0x69,0xA3,0x71,0xA3,0x71,0x82,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0xA2,0x69,0xA3,0x69,0xA3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x59,0x62,0x59,0x2B,0xDD,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x05,0xFC,0x63,0xF3,0xC4,0xFB,0xE2,0xDA,0xA1,0xD2,0xA1,0xD2,
-	0xA1,0xD2,0xC1,0xDA,0xE2,0xE2,0x42,0xF3,0x63,0xF3,0x22,0xEB,0xE2,0xE2,0xE2,0xE2,0x22,0xEB,0x02,0xE3,0x22,0xEB,0x23,0xEB,0x63,0xEB,0x63,0xEB,0x02,0xE3,0x23,0xEB,0x63,0xF3,0x03,0xDB,0x23,0xE3,0x03,0xDB,0xA3,0xD2,0x82,0xBA,0x82,0xC2,0x64,0xC2,0x04,0xDB,0x85,0xEB,0x05,0xFC,0x44,0xE3,0x03,0xDB,0xA3,0xD2,0xA3,0xDA,0xA3,0xDA,
-	0xA3,0xD2,0x82,0xC2,0x43,0xB2,0x64,0xC2,0x64,0xC2,0xA3,0xD2,0x24,0xA2,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x24,0x92,0xE3,0x81,0x03,0x8A,0x24,0xA2,0x24,0xA2,0xA3,0xDA,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0x64,0xC2,0xC4,0xDA,0xE4,0xE2,0x84,0xD2,0x64,0xC2,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x44,0xB2,0x44,0xB2,0x45,0xAA,0x44,0xB2,
-	0x25,0xA2,0x05,0x92,0x05,0x92,0x05,0x92,0x25,0x9A,0x25,0x9A,0x05,0x82,0xE5,0x79,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA3,0x69,0x82,0x69,0x82,0x69,0xA2,0x71,
-	0xA3,0x71,0xA2,0x71,0x82,0x69,0x82,0x61,0x82,0x69,0xA2,0x69,0x82,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0x82,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x01,0x49,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x22,0x51,0x22,0x51,0x22,0x49,0x22,0x51,0x22,0x49,0x22,0x51,0x42,0x51,
-	0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA3,0x69,0xA3,0x69,0xA2,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x61,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA3,0x69,0xC2,0x69,0xC3,0x69,
-	0xA3,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xC3,0x69,0xA3,0x69,0xA3,0x71,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x71,0xA3,0x69,
-	0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0xA3,0x69,0xA2,0x69,0xA3,0x69,
-	0xA2,0x69,0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0xC5,0x61,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x63,0xEB,0xC2,0xD2,0xC1,0xDA,0xA2,0xDA,0xA2,0xDA,0xC1,0xDA,0xC1,0xDA,0x02,0xE3,0x22,0xEB,0x42,0xF3,0x42,0xF3,0x42,0xF3,0x42,0xF3,0xE2,0xDA,0x42,0xF3,0x66,0xFC,0xC8,0xFC,0x05,0xFC,0x23,0xE3,
-	0x23,0xE3,0x03,0xDB,0x23,0xE3,0xE2,0xE2,0xE3,0xD2,0xE3,0xD2,0x44,0xE3,0x82,0xC2,0x64,0xBA,0xC3,0xCA,0x24,0xEB,0x85,0xEB,0x04,0xDB,0xA2,0xD2,0x85,0xEB,0xC4,0xFB,0xE4,0xE2,0xA3,0xD2,0x82,0xBA,0x43,0xAA,0x23,0x9A,0x24,0xA2,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x05,0x92,0x24,0x9A,0x64,0xC2,0x64,0xC2,0xA3,0xDA,
-	0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xE4,0xE2,0x24,0xEB,0xC4,0xDA,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x64,0xBA,0x64,0xC2,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x24,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0x25,0x9A,0x25,0x9A,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,
-	0xE5,0x69,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x64,0x39,0x84,0x61,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xC2,0x71,0xA2,0x71,0x82,0x69,0x82,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0xA2,0x71,0xA2,0x69,0x82,0x61,0x61,0x61,
-	0x01,0x49,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x21,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x22,0x51,0x22,0x51,0x21,0x51,0x22,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,
-	0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x61,0xA2,0x69,
-	0xA3,0x69,0xC2,0x69,0xA2,0x71,0xA2,0x69,0xC2,0x69,0xA2,0x69,0xA3,0x69,0xC3,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xC3,0x69,0xA3,0x69,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0x82,0x61,0xA2,0x69,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,
-	0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0xA3,0x69,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x42,0x51,0x2B,0xDD,0xCB,0xFD,0xC8,0xFC,0xCB,0xFD,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0xC4,0xFB,0x63,0xF3,
-	0xC1,0xDA,0xE2,0xDA,0xE2,0xE2,0xE2,0xDA,0xC1,0xDA,0xE2,0xE2,0x42,0xF3,0x63,0xF3,0x42,0xF3,0x02,0xE3,0x23,0xEB,0x02,0xE3,0xA4,0xF3,0xC8,0xFC,0xC8,0xFC,0xE7,0xEB,0x85,0xEB,0x85,0xEB,0x05,0xFC,0xA6,0xF3,0xC2,0xD2,0x44,0xE3,0xE7,0xEB,0xC3,0xBA,0x04,0xDB,0x45,0xDB,0xA6,0xF3,0xA4,0xF3,0x24,0xEB,0xE4,0xE2,0xC3,0xDA,0x03,0xDB,
-	0xC3,0xDA,0x82,0xCA,0x64,0xC2,0x44,0xAA,0x23,0x9A,0x24,0x92,0x03,0x8A,0x03,0x8A,0x24,0x92,0x03,0x8A,0x03,0x8A,0x64,0xC2,0x82,0xBA,0xA3,0xD2,0xA3,0xDA,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0x24,0xEB,0xA6,0xF3,0xE4,0xE2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x65,0xBA,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x44,0xAA,0x25,0xA2,
-	0x24,0x9A,0x25,0x9A,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x82,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,
-	0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC3,0x71,0xA2,0x69,0x82,0x61,0x82,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x51,0x22,0x51,0x22,0x51,0x22,0x51,0x22,0x51,0x22,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x42,0x51,
-	0x22,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,
-	0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0xC3,0x69,0xC3,0x69,0xC3,0x71,0xA2,0x71,0xC2,0x69,0xC3,0x69,0xA3,0x71,0xA2,0x71,0xC3,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x71,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA3,0x69,
-	0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x59,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,
-	0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x42,0x51,0x84,0x51,0xCB,0xFD,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x63,0xF3,0x66,0xFC,0x66,0xFC,0x05,0xFC,0xC4,0xFB,0x63,0xF3,0x22,0xEB,0x22,0xEB,0x42,0xF3,0xE2,0xE2,0x22,0xEB,0x42,0xF3,0x42,0xF3,0xC4,0xFB,0x63,0xEB,0xC4,0xFB,0x66,0xFC,0x05,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,
-	0xC8,0xFC,0x85,0xEB,0x85,0xEB,0x66,0xFC,0x04,0xDB,0x04,0xDB,0xC3,0xCA,0x45,0xDB,0xC7,0xE3,0x66,0xEB,0x04,0xDB,0x85,0xEB,0x64,0xF3,0x44,0xE3,0xC3,0xDA,0xA3,0xD2,0xC3,0xCA,0xA3,0xD2,0x64,0xC2,0x43,0xB2,0x24,0xA2,0x24,0x92,0x24,0x92,0x03,0x8A,0x23,0x9A,0x44,0xAA,0x44,0xAA,0x44,0xB2,0x84,0xD2,0xA3,0xDA,0xA3,0xDA,0xE4,0xE2,
-	0xE4,0xE2,0xE4,0xE2,0x24,0xEB,0x66,0xEB,0x24,0xEB,0xE4,0xE2,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x65,0xBA,0x64,0xC2,0x44,0xB2,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xE5,0x69,
-	0xE5,0x69,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x84,0x61,0x82,0x69,0x82,0x69,0xC2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x69,0x82,0x69,0xA2,0x69,0x82,0x61,0x62,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,
-	0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x22,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x82,0x59,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x62,0x61,0x62,0x61,0x62,0x59,0x82,0x59,0x62,0x61,0x82,0x59,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA3,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x71,0xA3,0x69,
-	0xA2,0x71,0xC2,0x71,0xC2,0x69,0xC3,0x71,0xC3,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0xA2,0x71,0xA3,0x71,0xC3,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0xA2,0x69,0xC3,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x46,0x93,0xCB,0xFD,0xC8,0xFC,0x49,0xFD,0x22,0xEB,0x23,0xEB,0xCB,0xFD,0x49,0xFD,0x05,0xFC,
-	0x05,0xFC,0xC4,0xFB,0x42,0xF3,0x42,0xF3,0x42,0xF3,0xC4,0xFB,0x05,0xFC,0x42,0xF3,0x42,0xF3,0x05,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x66,0xFC,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x05,0xFC,0x03,0xDB,0x44,0xE3,0xE7,0xEB,0x03,0xDB,0x04,0xCB,0xE7,0xEB,0xA6,0xF3,0xA6,0xF3,0x04,0xDB,0x44,0xE3,0x04,0xDB,0x82,0xCA,0xE3,0xD2,0x23,0xEB,
-	0xC3,0xDA,0x82,0xC2,0x82,0xC2,0x64,0xC2,0x43,0xB2,0x03,0x8A,0x03,0x8A,0x24,0x9A,0x43,0xB2,0x44,0xB2,0x44,0xAA,0x23,0x9A,0x44,0xB2,0xA3,0xDA,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0x24,0xEB,0xE4,0xE2,0x24,0xEB,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x65,0xBA,0x65,0xBA,0x44,0xB2,0x25,0xA2,0x25,0x9A,0x45,0xAA,
-	0x25,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x82,0x61,0x82,0x69,0x82,0x69,0xC3,0x69,0xA2,0x71,0x82,0x69,
-	0xA2,0x71,0xC2,0x71,0xC3,0x71,0xA2,0x71,0x82,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x69,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x21,0x51,0x22,0x49,0x22,0x51,0x22,0x51,0x42,0x51,0x42,0x51,0x42,0x51,
-	0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0x62,0x59,0x82,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x62,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x69,0xA3,0x71,0xA3,0x71,0xA2,0x69,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x61,0xA2,0x69,0xA3,0x69,0xC2,0x69,0xA2,0x71,0xC2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,
-	0x82,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0x82,0x61,
-	0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x2B,0xDD,0x49,0xFD,0x49,0xFD,0x66,0xFC,0xA1,0xD2,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0xC4,0xFB,0x22,0xEB,0x42,0xF3,0xC4,0xFB,0xC8,0xFC,0x66,0xFC,0xC4,0xFB,0xC4,0xFB,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x28,0xF4,
-	0x66,0xFC,0xC8,0xFC,0x05,0xFC,0xC2,0xD2,0x03,0xDB,0x04,0xDB,0x04,0xDB,0x05,0xFC,0x28,0xF4,0xE7,0xF3,0x85,0xEB,0xE3,0xD2,0x04,0xDB,0xC3,0xCA,0x64,0xC2,0xE3,0xD2,0xC3,0xDA,0xC3,0xDA,0xA3,0xD2,0x64,0xBA,0x64,0xBA,0x44,0xB2,0x24,0xA2,0x24,0xA2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x44,0xB2,0x84,0xD2,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,
-	0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x44,0xAA,0x24,0x9A,0x25,0xA2,0x25,0xA2,0x45,0xA2,0x05,0x92,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,
-	0xE5,0x69,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x64,0x39,0x82,0x61,0x82,0x69,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x69,0xA2,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x71,0x82,0x69,0xA3,0x71,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x73,0xC5,0x73,0xC5,0xF1,0xAC,0x2B,0xBC,0xED,0x93,0x49,0x93,0xE5,0x79,0x82,0x61,
-	0xA2,0x61,0xA2,0x69,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x21,0x51,0x62,0x59,0x42,0x51,0xA5,0x51,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x85,0xEB,0x05,0xFC,0x49,0xFD,0x49,0xFD,
-	0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0xC4,0xFB,0x42,0xF3,0xC4,0xFB,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x23,0xE3,0x82,0xC2,0xC3,0xCA,0xE3,0xD2,0xE3,0xD2,0x85,0xEB,0xE7,0xF3,0x24,0xEB,0x44,0xE3,0x04,0xDB,0xA4,0xCA,0x82,0xBA,0x44,0xB2,
-	0x44,0xB2,0xC3,0xCA,0xA3,0xDA,0xA3,0xDA,0x64,0xC2,0x64,0xBA,0x64,0xBA,0x64,0xC2,0xA4,0xCA,0x84,0xD2,0xA3,0xDA,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0xA3,0xDA,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x65,0xBA,0x65,0xBA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x25,0xA2,0x25,0x9A,
-	0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0x84,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x83,0x61,0x82,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0xA2,0x69,0xC3,0x69,0xA2,0x71,0x82,0x69,0x82,0x69,0x82,0x69,0x82,0x69,0xA2,0x69,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x44,0x29,0xC6,0x39,0xEB,0x62,0x8C,0x7B,0xF1,0xAC,0x73,0xC5,0xED,0x93,0x49,0x93,0xC3,0x71,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x62,0x61,
-	0x82,0x59,0x82,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x46,0x93,0xCB,0xFD,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0xC4,0xFB,0x05,0xFC,0xC8,0xFC,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,
-	0xC8,0xFC,0x66,0xFC,0x44,0xE3,0x82,0xCA,0xA3,0xD2,0xC3,0xCA,0xC3,0xCA,0xC3,0xBA,0xC3,0xCA,0x85,0xEB,0x24,0xEB,0x44,0xE3,0x04,0xDB,0x04,0xDB,0x45,0xDB,0x64,0xC2,0x64,0xBA,0x64,0xBA,0x43,0xB2,0x04,0xDB,0x24,0xEB,0x04,0xDB,0x84,0xD2,0x04,0xDB,0x04,0xDB,0x04,0xDB,0xC4,0xDA,0x84,0xD2,0xC4,0xDA,0xA3,0xDA,0xE4,0xE2,0x24,0xEB,
-	0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x25,0x9A,0x25,0x9A,0x25,0x9A,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,
-	0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x84,0x51,0x82,0x61,0xA2,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x69,0x82,0x61,0x82,0x61,0x82,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x69,0x82,0x61,0x82,0x61,0x61,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x48,0x4A,0xED,0x93,0x73,0xC5,0xF1,0xAC,0xA7,0x72,0x62,0x61,0x62,0x61,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x21,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x2B,0xBC,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,
-	0x49,0xFD,0x49,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0x66,0xFC,0xC4,0xFB,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xA4,0xF3,0x23,0xE3,0xC2,0xD2,0xC2,0xD2,0xE3,0xD2,0xA3,0xD2,0xC3,0xCA,0xC3,0xCA,0x82,0xBA,0xC3,0xBA,0xC3,0xCA,0xA3,0xD2,0xA4,0xCA,0x45,0xDB,0x66,0xEB,0x04,0xCB,
-	0xA5,0xC2,0x64,0xC2,0xA4,0xCA,0xA4,0xCA,0xC4,0xDA,0x24,0xEB,0x66,0xEB,0x66,0xEB,0x45,0xDB,0x66,0xEB,0x04,0xDB,0xC4,0xDA,0xC4,0xDA,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x45,0xAA,0x44,0xAA,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x05,0x92,
-	0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xC5,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x69,
-	0xA2,0x69,0x82,0x69,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA5,0x51,0xF1,0xAC,0xF1,0xAC,0xC7,0x92,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,
-	0x82,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x2B,0xDD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x4E,0xFE,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xCB,0xFD,0x49,0xFD,
-	0x05,0xFC,0x63,0xEB,0x23,0xE3,0xE2,0xDA,0xC2,0xD2,0xC2,0xD2,0xA3,0xD2,0x82,0xC2,0x64,0xC2,0x82,0xBA,0x64,0xC2,0xE3,0xD2,0xA4,0xCA,0x04,0xCB,0x45,0xCB,0xC4,0xDA,0x64,0xC2,0x64,0xC2,0xC4,0xDA,0xC3,0xDA,0xA5,0xC2,0xA4,0xCA,0x45,0xCB,0x45,0xDB,0xC7,0xE3,0x66,0xEB,0x24,0xEB,0x44,0xE3,0xC4,0xDA,0xC4,0xDA,0xE4,0xE2,0xC4,0xDA,
-	0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0x65,0xBA,0x65,0xBA,0x65,0xBA,0x65,0xBA,0x65,0xBA,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x25,0x9A,0x25,0xA2,0x25,0xA2,0x25,0x9A,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0x84,0x61,0xA5,0x51,0xA5,0x51,
-	0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xC5,0x61,0xA3,0x69,0xA2,0x71,0xA2,0x69,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x39,0x70,0x94,0x73,0xC5,0xA7,0x72,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x22,0x51,0x22,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x22,0x51,0x42,0x51,0xC3,0x61,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,
-	0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xCB,0xFD,0x49,0xFD,0x66,0xFC,0x63,0xF3,0xE2,0xE2,0xE2,0xDA,0xE2,0xE2,0xE3,0xD2,0xA3,0xD2,0xC3,0xCA,0xA3,0xD2,0xC3,0xCA,0xA3,0xD2,0x44,0xE3,0x66,0xEB,0xA6,0xDB,0x45,0xDB,0xE5,0xBA,
-	0x84,0xA2,0x04,0xDB,0x24,0xEB,0xE3,0xD2,0x44,0xB2,0x65,0xBA,0xA4,0xCA,0x45,0xDB,0xA4,0xCA,0xA4,0xCA,0xC4,0xDA,0x04,0xDB,0xE4,0xE2,0x84,0xD2,0x84,0xD2,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0x65,0xBA,0x64,0xB2,0x45,0xAA,0x45,0xAA,0x44,0xB2,0x45,0xAA,0x45,0xAA,0x45,0xAA,0x44,0xAA,0x25,0xA2,0x25,0xA2,0x25,0x9A,0x05,0x92,0x25,0x9A,
-	0x05,0x92,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xC5,0x61,0xC5,0x61,0xC5,0x61,0x84,0x61,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x61,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x61,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x39,0xF1,0xAC,0xED,0x93,0xC3,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,
-	0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x22,0x51,0x22,0x51,0x22,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x04,0x7A,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0x49,0xFD,
-	0x66,0xFC,0x63,0xF3,0x23,0xEB,0x23,0xE3,0x23,0xE3,0x03,0xDB,0xC2,0xD2,0xE3,0xD2,0xC3,0xCA,0xC3,0xCA,0xA3,0xD2,0x84,0xD2,0x04,0xCB,0x66,0xEB,0xE7,0xF3,0xA5,0xC2,0x44,0xAA,0x64,0xBA,0x64,0xBA,0x64,0xBA,0x44,0xB2,0x44,0xB2,0xA5,0xC2,0xA4,0xCA,0x84,0xD2,0xA4,0xCA,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,
-	0x84,0xD2,0x64,0xC2,0x65,0xBA,0xA5,0xC2,0xA5,0xC2,0x25,0xA2,0x25,0xA2,0x45,0xAA,0x44,0xAA,0x44,0xAA,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x25,0x9A,0x05,0x92,0x05,0x92,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0x84,0x61,0xC5,0x61,0xE5,0x69,0xC5,0x61,0x84,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,
-	0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0x84,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xEB,0x62,0x73,0xC5,0xA7,0x72,0x62,0x59,0x62,0x59,0x21,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x22,0x51,0x22,0x49,0x22,0x49,0x01,0x49,0x46,0x93,0x49,0xFD,0xCB,0xFD,
-	0xCB,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0xC4,0xFB,0x63,0xF3,0x63,0xEB,0x63,0xEB,0x03,0xDB,0xA3,0xDA,0xC2,0xD2,0xA3,0xDA,0xA3,0xD2,0xE3,0xD2,0x44,0xE3,0x24,0xEB,0xA6,0xF3,0x04,0xDB,
-	0x44,0xB2,0x24,0xA2,0x64,0xBA,0xC4,0xDA,0x44,0xB2,0xA4,0xCA,0xC4,0xDA,0xC4,0xDA,0x04,0xDB,0xC4,0xDA,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x84,0xD2,0xA3,0xDA,0xC4,0xDA,0x84,0xD2,0x44,0xB2,0x64,0xC2,0xA4,0xCA,0xA5,0xC2,0x45,0xAA,0x45,0xA2,0x44,0xAA,0x44,0xAA,0x25,0xA2,0x25,0xA2,0x45,0xAA,0x25,0xA2,0x25,0x9A,0x05,0x92,0x05,0x92,
-	0x05,0x92,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0x84,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0x82,0x61,
-	0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0xF1,0xAC,0xED,0x93,0x62,0x59,0x62,0x59,0x62,0x59,
-	0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x22,0x51,0x22,0x49,0x22,0x49,0x21,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x46,0x93,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xC8,0xFC,0x49,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0x49,0xFD,0x49,0xFD,
-	0x49,0xFD,0xCB,0xFD,0xC8,0xFC,0x63,0xF3,0x63,0xEB,0x64,0xF3,0x23,0xEB,0xA3,0xD2,0xA3,0xD2,0x03,0xDB,0xC3,0xDA,0x24,0xEB,0xE4,0xE2,0x85,0xEB,0x24,0xEB,0xA4,0xCA,0x64,0xBA,0x64,0xBA,0x83,0xB2,0xC3,0xDA,0xE3,0xD2,0xC4,0xDA,0x04,0xDB,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0xA4,0xCA,0x84,0xD2,0xC4,0xDA,0xC4,0xDA,0x84,0xD2,0x84,0xD2,
-	0x84,0xD2,0x44,0xB2,0x45,0xAA,0x65,0xBA,0x45,0xAA,0x45,0xA2,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x25,0xA2,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x92,0x05,0x82,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xC5,0x61,
-	0x84,0x61,0xC5,0x61,0x84,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x62,0x59,0x21,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xED,0x93,0xF1,0xAC,0xA3,0x61,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x22,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x21,0x51,0x22,0x49,0x22,0x51,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x46,0x93,
-	0xCB,0xFD,0x49,0xFD,0xCB,0xFD,0x49,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0xC8,0xFC,0x66,0xFC,0x85,0xEB,0xE2,0xE2,0xA4,0xF3,0xA4,0xF3,0x24,0xEB,0xE2,0xE2,0xE4,0xE2,0x85,0xEB,0xE4,0xE2,0x85,0xEB,0x64,0xF3,0x85,0xEB,
-	0xA4,0xCA,0x43,0xB2,0x64,0xC2,0xC3,0xDA,0xA4,0xCA,0x84,0xD2,0xA3,0xDA,0xC4,0xDA,0xE4,0xE2,0x84,0xD2,0x64,0xC2,0xA3,0xD2,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xB2,0x45,0xAA,0x45,0xAA,0x45,0xAA,0x45,0xAA,0x45,0xAA,0x25,0xA2,0x25,0x9A,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0xE5,0x79,
-	0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x84,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x61,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,
-	0x62,0x59,0x21,0x51,0x42,0x51,0x22,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xF1,0xAC,0xC3,0x61,
-	0x22,0x51,0x22,0x49,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x22,0x51,0x22,0x51,0x22,0x49,0x21,0x51,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x46,0x93,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x4E,0xFE,0xCB,0xFD,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,
-	0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xA4,0xF3,0x85,0xEB,0xA4,0xF3,0x64,0xF3,0x63,0xEB,0x23,0xE3,0x44,0xE3,0x24,0xEB,0x64,0xF3,0x63,0xEB,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xA3,0xDA,0x84,0xD2,0x64,0xBA,0x64,0xBA,0x44,0xB2,0x64,0xC2,0x84,0xD2,0x64,0xC2,0x44,0xB2,0x64,0xC2,0x64,0xC2,
-	0x64,0xBA,0x65,0xBA,0x65,0xBA,0x64,0xB2,0x44,0xAA,0x45,0xAA,0x45,0xAA,0x25,0xA2,0x25,0xA2,0x05,0x92,0x05,0x82,0x05,0x92,0x05,0x92,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xA5,0x51,0xA5,0x51,
-	0x84,0x61,0x84,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x22,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0x73,0xC5,0x83,0x61,0x22,0x51,0x22,0x51,0x22,0x51,0x22,0x49,0x21,0x51,0x21,0x51,0x22,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,
-	0x01,0x49,0x46,0x93,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x64,0xF3,0xA4,0xF3,0x64,0xF3,0x24,0xEB,0x24,0xEB,
-	0xC3,0xDA,0xE3,0xD2,0xE4,0xE2,0xC3,0xDA,0xC4,0xDA,0x64,0xBA,0x64,0xBA,0x64,0xC2,0x44,0xB2,0x64,0xC2,0xA4,0xCA,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x65,0xBA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x25,0xA2,0x44,0xAA,0x25,0x9A,0x25,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,
-	0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xA5,0x51,0xC5,0x61,0xA5,0x51,0x23,0x49,0x21,0x51,0x22,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x82,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x42,0x51,
-	0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x21,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,
-	0xF1,0xAC,0x82,0x59,0x22,0x51,0x42,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xA7,0x72,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,
-	0x49,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0xA4,0xF3,0xA4,0xF3,0xA6,0xF3,0xA4,0xF3,0x44,0xE3,0x23,0xE3,0xE4,0xE2,0x24,0xEB,0xC3,0xDA,0xE4,0xE2,0xC3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0xC4,0xDA,0xC4,0xDA,0x64,0xC2,0x44,0xB2,0x64,0xBA,0x64,0xC2,0x44,0xB2,0x64,0xC2,0x44,0xB2,
-	0x44,0xB2,0x24,0x9A,0x44,0xB2,0x44,0xAA,0x24,0x9A,0x25,0xA2,0x44,0xAA,0x25,0xA2,0x25,0x9A,0x05,0x92,0x05,0x92,0xE5,0x79,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0x23,0x49,
-	0x23,0x49,0x21,0x51,0x21,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x22,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xF1,0xAC,0x22,0x51,0x22,0x49,0x21,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,
-	0x01,0x49,0x01,0x49,0x01,0x49,0xA5,0x51,0xCB,0xFD,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0xA4,0xF3,0x23,0xEB,0x23,0xEB,0xC4,0xDA,0xA3,0xDA,0x44,0xE3,0x44,0xE3,
-	0x23,0xEB,0x24,0xEB,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,0xC4,0xDA,0xA3,0xD2,0x64,0xC2,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0x24,0xA2,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x25,0xA2,0x25,0x9A,0x44,0xAA,0x44,0xAA,0x05,0x92,0x24,0x9A,0x25,0xA2,0x24,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x69,
-	0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0x84,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,
-	0x22,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xED,0x93,0xED,0x93,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x64,0x39,0x4D,0xD5,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x4E,0xFE,0x4E,0xFE,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,
-	0x49,0xFD,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x64,0xF3,0x23,0xE3,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xC3,0xDA,0xE4,0xE2,0xE4,0xE2,0xC3,0xDA,0xE4,0xE2,0xE4,0xE2,0xA3,0xD2,0x84,0xD2,0x64,0xC2,0x64,0xBA,0x44,0xB2,0x44,0xB2,0x44,0xAA,0x25,0xA2,0x24,0xA2,0x24,0xA2,0x25,0xA2,
-	0x24,0x9A,0x24,0x9A,0x44,0xAA,0x44,0xAA,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0xE5,0x79,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xA5,0x51,0x23,0x49,0x42,0x51,0x42,0x51,0x22,0x51,
-	0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xF1,0xAC,0xA7,0x72,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,
-	0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0x01,0x49,0xE1,0x40,0x2B,0xBC,0x4E,0xFE,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x66,0xFC,0x05,0xFC,0x64,0xF3,0x64,0xF3,0x23,0xEB,0xC3,0xDA,0xE4,0xE2,
-	0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,0x84,0xD2,0xA3,0xD2,0x84,0xD2,0x64,0xC2,0x44,0xB2,0x44,0xB2,0x44,0xAA,0x24,0xA2,0x25,0xA2,0x24,0x9A,0x24,0x9A,0x25,0xA2,0x24,0x9A,0x25,0xA2,0x25,0xA2,0x05,0x82,0x05,0x82,0x05,0x92,0x05,0x82,0x25,0x9A,0x05,0x92,0xE5,0x79,0xE5,0x79,0x05,0x92,0x05,0x82,0xE5,0x79,0xE5,0x79,
-	0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xA5,0x51,0x23,0x49,0x42,0x51,0x22,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x82,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x22,0x51,
-	0x21,0x51,0x22,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x21,0x51,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x21,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x21,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x44,0x29,0x73,0xC5,0x84,0x51,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xA7,0x72,0xCB,0xFD,0x4E,0xFE,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,
-	0xC8,0xFC,0x49,0xFD,0x49,0xFD,0x66,0xFC,0xE7,0xF3,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0xA4,0xF3,0x64,0xF3,0x63,0xEB,0x64,0xF3,0x23,0xEB,0x23,0xEB,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,0xC4,0xDA,0xA3,0xD2,0xA4,0xCA,0x64,0xC2,0x44,0xB2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x25,0xA2,0x44,0xAA,0x24,0x9A,0x05,0x92,0x24,0x92,
-	0x24,0x92,0x05,0x92,0x05,0x92,0x24,0x9A,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0x23,0x49,0x22,0x51,0x22,0x49,0x22,0x51,0x22,0x49,0x22,0x49,0x21,0x51,
-	0x21,0x51,0x22,0x51,0x42,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x22,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x21,0x51,0x22,0x49,0x21,0x51,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xED,0x93,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,
-	0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0x01,0x49,0xE1,0x40,0xC1,0x38,0x64,0x39,0x2B,0xBC,0x4E,0xFE,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0xA4,0xF3,0x23,0xE3,0x63,0xF3,0x23,0xEB,0x64,0xF3,0x24,0xEB,0x23,0xEB,
-	0xA2,0xDA,0x64,0xC2,0x64,0xC2,0xA4,0xCA,0xA3,0xD2,0x64,0xBA,0x44,0xAA,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x25,0xA2,0x24,0x9A,0x24,0x92,0x03,0x8A,0x05,0x92,0x05,0x92,0x24,0x92,0x24,0x92,0x05,0x82,0xE3,0x81,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,
-	0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xC5,0x61,0x23,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x21,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,
-	0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xF1,0xAC,0xA7,0x72,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xA7,0x72,0x2B,0xDD,0xCB,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,
-	0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0xA4,0xF3,0xA4,0xF3,0x64,0xF3,0x64,0xF3,0x63,0xF3,0x64,0xF3,0xE4,0xE2,0xC3,0xDA,0xA3,0xDA,0xA3,0xD2,0x64,0xC2,0x44,0xB2,0x64,0xBA,0x44,0xB2,0x44,0xB2,0x25,0xA2,0x24,0xA2,0x24,0xA2,0x24,0x9A,0x24,0x9A,0x24,0x9A,0x24,0x92,0x24,0x92,0x24,0x92,
-	0x05,0x92,0x24,0x92,0x05,0x82,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0x64,0x39,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,
-	0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x22,0x49,0x22,0x49,0x21,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xF1,0xAC,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,
-	0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE2,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE2,0x38,0xA7,0x72,0xCB,0xFD,0xCB,0xFD,0xC8,0xFC,0x49,0xFD,0x49,0xFD,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x66,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0xC4,0xFB,0x63,0xF3,0x23,0xE3,0xC3,0xDA,0xA3,0xDA,0xE4,0xE2,0x23,0xE3,
-	0xC3,0xDA,0xA3,0xD2,0x64,0xBA,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x24,0xA2,0x25,0xA2,0x24,0xA2,0x25,0xA2,0x24,0x9A,0x24,0x9A,0x24,0x9A,0x24,0x92,0x05,0x92,0x24,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,
-	0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0x84,0x51,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,
-	0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xA7,0x72,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE2,0x38,0x46,0x93,0x49,0xFD,
-	0x49,0xFD,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x05,0xFC,0x63,0xF3,0xE4,0xE2,0x64,0xC2,0xC3,0xCA,0xC3,0xDA,0xC4,0xDA,0x64,0xBA,0xA3,0xD2,0xA3,0xD2,0x44,0xB2,0x44,0xAA,0x24,0xA2,0x44,0xAA,0x24,0x9A,0x24,0x92,0x24,0x9A,0x24,0x9A,0x24,0x9A,0x24,0x9A,0x24,0x92,0x05,0x92,0x05,0x92,
-	0x03,0x8A,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0x64,0x39,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,
-	0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x39,0xF1,0xAC,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,
-	0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x64,0x39,0x87,0xC3,0xC8,0xFC,0x49,0xFD,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0xC4,0xFB,0xA4,0xF3,0x64,0xF3,0x23,0xEB,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,
-	0xA3,0xDA,0xA3,0xDA,0xA3,0xDA,0x64,0xBA,0x43,0xB2,0x44,0xB2,0x24,0xA2,0x24,0x9A,0x03,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x92,0x24,0x9A,0x25,0xA2,0x05,0x92,0x05,0x82,0x03,0x8A,0x05,0x92,0x03,0x8A,0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x79,0xE5,0x69,
-	0x84,0x51,0xE2,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,
-	0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0xE5,0x69,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE2,0x38,0xE1,0x40,0xE1,0x40,
-	0xE1,0x40,0xE2,0x38,0x64,0x8A,0x49,0xEC,0xC8,0xFC,0xC8,0xFC,0x66,0xFC,0x66,0xFC,0x05,0xFC,0xC4,0xFB,0xA4,0xF3,0x64,0xF3,0x23,0xEB,0x23,0xEB,0xE4,0xE2,0xE2,0xE2,0xE2,0xE2,0xA2,0xDA,0x64,0xC2,0x82,0xC2,0x64,0xC2,0x64,0xBA,0x44,0xB2,0x24,0xA2,0x24,0x9A,0x24,0x92,0x03,0x8A,0x03,0x8A,0x24,0x9A,0x24,0x9A,0x25,0xA2,0x24,0x9A,
-	0x24,0x92,0x24,0x9A,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0x05,0x82,0x05,0x82,0xE5,0x79,0xC5,0x61,0x23,0x49,0xE2,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,
-	0xC1,0x38,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xC1,0x38,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xED,0x93,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,
-	0xE1,0x40,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE2,0x38,0xE1,0x40,0xE2,0x38,0xE1,0x40,0xE1,0x40,0x84,0x51,0x64,0x8A,0xE7,0xDB,0x66,0xFC,0x66,0xFC,0x05,0xFC,0x63,0xF3,0x64,0xF3,0x64,0xF3,0xE4,0xE2,0xE2,0xE2,0xA3,0xDA,
-	0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0x64,0xC2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x64,0xB2,0x44,0xAA,0x25,0xA2,0x25,0xA2,0x24,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0x24,0x92,0x05,0x92,0x05,0x92,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x69,0x23,0x49,0xE2,0x38,0xE2,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,
-	0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x73,0xC5,0x01,0x49,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xE1,0x40,0xE2,0x38,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xE1,0x40,0x82,0x59,0x64,0x92,0xE5,0xBA,0x85,0xEB,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x64,0xF3,0x23,0xEB,0xA3,0xDA,0xA3,0xDA,0xA3,0xD2,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x44,0xAA,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x24,0x9A,
-	0x24,0x9A,0x05,0x92,0x24,0x9A,0x25,0x9A,0x25,0xA2,0x45,0xA2,0x05,0x92,0xC3,0x71,0x84,0x51,0xE2,0x38,0xE2,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xA7,0x72,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE2,0x38,0x22,0x51,0x03,0x8A,0xC3,0xBA,0x04,0xDB,0xE4,0xE2,
-	0xE4,0xE2,0xE2,0xE2,0xE2,0xE2,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0x64,0xC2,0x64,0xBA,0x64,0xBA,0x64,0xB2,0x44,0xB2,0x44,0xB2,0x64,0xB2,0x44,0xB2,0x44,0xB2,0x44,0xAA,0x25,0xA2,0x25,0x9A,0x25,0x9A,0xE3,0x79,0x84,0x51,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE1,0x40,0xE2,0x38,0xC1,0x38,0xE1,0x40,0xE2,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xED,0x93,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE1,0x40,0xE2,0x38,0xE1,0x40,0xE2,0x38,0x22,0x49,0x82,0x69,0xE3,0x81,0x23,0x92,0x24,0xA2,0x43,0xB2,0x82,0xBA,0x44,0xB2,0x43,0xB2,0x44,0xAA,0x24,0x9A,0x03,0x8A,0xC2,0x79,0x84,0x61,0x42,0x51,
-	0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE1,0x40,0xE2,0x38,0xE1,0x40,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xA1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x73,0xC5,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE2,0x38,
-	0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE1,0x40,0xC1,0x38,0xE2,0x38,0xA1,0x30,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xC1,0x38,0xE2,0x38,0xA1,0x30,0xE2,0x38,0xC1,0x30,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0xA5,0x51,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE2,0x38,0xC1,0x38,0xE2,0x38,0xE2,0x38,0xE2,0x38,0xA1,0x30,0xE2,0x38,0xE2,0x38,0xA1,0x30,0xE2,0x38,0xC1,0x30,0xE2,0x38,0xA1,0x30,0xE2,0x38,0xE2,0x38,0xA1,0x30,0xE2,0x38,
-	0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xA1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xA0,0x30,0xA0,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xA7,0x72,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xA0,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xC1,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x72,0x8C,0x7B,0xC1,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xA1,0x30,0xC1,0x30,0xA0,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,
-	0xA0,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xA1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xC1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xED,0x93,0xC1,0x38,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,
-	0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,
-	0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,
-	0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA1,0x28,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x28,0x80,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0xF1,0xAC,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,
-	0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA1,0x28,0xA0,0x30,
-	0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x30,0xA0,0x30,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA0,0x30,0xA0,0x30,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x28,0xA0,0x30,0xA1,0x30,
-	0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA0,0x30,0xA0,0x30,0xA1,0x28,0xA1,0x28,0xA0,0x30,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x73,0xC5,0xA0,0x30,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA0,0x30,0xA1,0x28,
-	0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,
-	0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x28,0xA1,0x30,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,
-	0xA1,0x30,0xA1,0x28,0xA0,0x30,0xA1,0x30,0xA1,0x28,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x30,0x80,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA0,0x30,0x80,0x28,0xA1,0x28,
-	0xA0,0x30,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0xA0,0x30,0xA1,0x28,0x80,0x28,0xA0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x73,0xC5,0x80,0x28,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x28,0xA1,0x30,0xA0,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x28,0xA1,0x30,0xA1,0x28,0xA1,0x28,0xA0,0x30,
-	0xA1,0x28,0xA1,0x30,0xA1,0x28,0xA1,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,
-	0x80,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,
-	0x80,0x28,0x80,0x28,0xA0,0x30,0xA1,0x30,0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA0,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xD4,0xCD,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,
-	0xA1,0x28,0xA1,0x28,0xA1,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA0,0x30,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,
-	0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,
-	0xA1,0x28,0x80,0x28,0xA0,0x30,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xCD,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,
-	0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x81,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,
-	0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x81,0x20,0x81,0x20,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,
-	0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x73,0xC5,0x80,0x28,0x81,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,
-	0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x81,0x20,0x80,0x28,0x81,0x20,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x20,0x80,0x28,0x81,0x20,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x28,0x81,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x81,0x20,0x81,0x20,
-	0x80,0x28,0x81,0x20,0x81,0x20,0x80,0x28,0x81,0x20,0x81,0x20,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x28,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,
-	0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x28,0x80,0x20,0x80,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x18,0x73,0xC5,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x28,0x81,0x20,0x81,0x20,0x80,0x28,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x28,
-	0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x81,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x81,0x20,0x80,0x28,0x80,0x28,
-	0x80,0x20,0x81,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x20,0x80,0x20,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0xF1,0xAC,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x81,0x20,0x81,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x81,0x20,0x80,0x20,0x81,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x81,0x20,0x80,0x20,0x81,0x20,0x81,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x81,0x20,0x80,0x20,0x80,0x20,
-	0x80,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x81,0x20,0x80,0x20,0x81,0x20,0x81,0x20,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x18,0x60,0x18,0x60,0x20,0x60,0x18,0x60,0x20,0x60,0x18,
-	0x60,0x18,0x60,0x18,0x60,0x20,0x60,0x18,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xED,0x93,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0xC2,0x28,0xA5,0x51,0xEB,0x62,0xED,0x93,0xF1,0xAC,0xF1,0xAC,0x73,0xC5,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x72,0x8C,0x7B,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,
-	0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,
-	0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x60,0x18,0xE2,0x38,0xA7,0x72,0xF1,0xAC,0xD4,0xCD,0x70,0x94,0xEB,0x62,0x48,0x4A,0x44,0x29,0xC2,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xA7,0x72,0x60,0x20,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x20,0x60,0x20,0x60,0x18,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,
-	0x60,0x20,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x18,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x18,0xA5,0x51,0xED,0x93,0x73,0xC5,0x8C,0x7B,0x64,0x39,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0x64,0x39,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,
-	0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x20,0x60,0x18,0x60,0x20,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x20,0x60,0x20,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,
-	0x60,0x18,0xA5,0x51,0x70,0x94,0xF1,0xAC,0x48,0x4A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x73,0xC5,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,
-	0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0xC2,0x28,0xED,0x93,0xF1,0xAC,0xA5,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xED,0x93,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,
-	0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x48,0x4A,0x73,0xC5,
-	0xEB,0x62,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x73,0xC5,0xF1,0xAC,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x73,0xC5,0x64,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0x73,0xC5,0xED,0x93,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0x73,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xD4,0xCD,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0xD4,0xCD,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x39,0x73,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x73,0xC5,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0xA7,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0xED,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x39,0x73,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xF1,0xAC,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0x73,0xC5,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xF1,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0x73,0xC5,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0x73,0xC5,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xF1,0xAC,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xF1,0xAC,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x8C,0x7B,0x73,0xC5,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0x73,0xC5,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0x73,0xC5,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xD4,0xCD,
-	0x64,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xD4,0xCD,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xED,0x93,0xD4,0xCD,0xC6,0x39,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x21,0xD4,0xCD,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0xF1,0xAC,0x73,0xC5,0x64,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xED,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xEB,0x62,0x73,0xC5,0x73,0xC5,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF1,0xAC,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x39,0xF1,0xAC,0x73,0xC5,0xED,0x93,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x39,0x70,0x94,0x73,0xC5,0x73,0xC5,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xD4,0xCD,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x48,0x4A,0xF1,0xAC,0x73,0xC5,0x73,0xC5,0x8C,0x7B,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0xD4,0xCD,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x48,0x4A,0xED,0x93,0x73,0xC5,0xF1,0xAC,0x73,0xC5,0x8C,0x7B,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x64,0x39,0xD4,0xCD,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC2,0x18,0x03,0x21,0x64,0x39,0xEB,0x62,0x8C,0x7B,0xF1,0xAC,0x73,0xC5,
-	0xF1,0xAC,0x73,0xC5,0xF1,0xAC,0x48,0x4A,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xD4,0xCD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xD4,0xCD,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC6,0x39,0x73,0xC5,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0x73,0xC5,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x03,0x21,0x73,0xC5,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xD4,0xCD,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF1,0xAC,0xED,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0xBA,0xD6,0x8C,0x7B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xD4,0xCD,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x48,0x4A,0x73,0xC5,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x73,0xC5,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0x73,0xC5,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x18,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x51,0x73,0xC5,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0xF1,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x73,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0x73,0xC5,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x73,0xC5,0xF1,0xAC,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0x73,0xC5,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC6,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0x73,0xC5,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x73,0xC5,0xF1,0xAC,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x18,
-	0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0x73,0xC5,0xED,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x48,0x4A,0xEB,0x62,0x8C,0x7B,0x73,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xD4,0xCD,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0xCD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0x73,0xC5,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x72,0xD4,0xCD,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xD4,0xCD,0xED,0x93,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0xCD,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0x73,0xC5,0xF1,0xAC,0x44,0x29,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,
-	0xF1,0xAC,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xF1,0xAC,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x70,0x94,0x73,0xC5,0xEB,0x62,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,
-	0xD4,0xCD,0xF1,0xAC,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xED,0x93,0xD4,0xCD,0xF1,0xAC,0x48,0x4A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x21,0xED,0x93,0x73,0xC5,0x73,0xC5,0x8C,0x7B,0xC6,0x39,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0xED,0x93,0x73,0xC5,0x73,0xC5,0x73,0xC5,0x70,0x94,0xEB,0x62,0x48,0x4A,0x44,0x29,0xC2,0x18,0x61,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xEB,0x62,0xF1,0xAC,0xF1,0xAC,0xEB,0x62,0xC6,0x39,0x03,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x8C,0x7B,0x73,0xC5,0x8C,0x7B,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0x73,0xC5,0x8C,0x7B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,
-	0xF1,0xAC,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xED,0x93,0xED,0x93,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xED,0x93,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xED,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xF1,0xAC,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x73,0xC5,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0x5D,0xEF,0xFF,0xFF,0xBA,0xD6,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC2,0x18,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x18,0x73,0xC5,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x70,0x94,0xBA,0xD6,0xBA,0xD6,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xBA,0xD6,0xBA,0xD6,0x70,0x94,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x8C,0x7B,0xBA,0xD6,0x5D,0xEF,0xD4,0xCD,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0xF1,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0xCD,0x00,0x00,0x00,0x00,0x73,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x44,0x29,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,
-	0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x72,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xAC,0x8C,0x7B,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0xC6,0x39,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xAC,0x70,0x94,0xFF,0xFF,0xF1,0xAC,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xD4,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x73,0xC5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xAC,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xCD,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x44,0x29,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xAC,0x20,0x00,0x44,0x29,0xBA,0xD6,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x4A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xC6,0x39,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xAC,0x20,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0x70,0x94,0x20,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC2,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x48,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x70,0x94,0x8C,0x7B,0x48,0x4A,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0xF1,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x82,0x10,0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x48,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x44,0x29,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0xD4,0xCD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x73,0xC5,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x18,0xBA,0xD6,0xBA,0xD6,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xBA,0xD6,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x73,0xC5,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0xFF,0xFF,0x5D,0xEF,0xC6,0x39,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xF1,0xAC,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0x70,0x94,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0x70,0x94,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xED,0x93,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xED,0x93,0x8C,0x7B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xED,0x93,0xED,0x93,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x8C,0x7B,0xF1,0xAC,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC6,0x39,0x73,0xC5,0x8C,0x7B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x8C,0x7B,0x73,0xC5,0xEB,0x62,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x18,0xEB,0x62,0xF1,0xAC,0xF1,0xAC,0x8C,0x7B,0xC6,0x39,0x03,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x18,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xD4,0xCD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x8C,0x7B,0xFF,0xFF,0x8C,0x7B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0x70,0x94,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x70,0x94,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xFF,0xFF,0xFF,0xFF,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,
-	0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xC5,0xFF,0xFF,0xFF,0xFF,0xF1,0xAC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x18,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x20,0x00,0x20,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC2,0x18,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x5D,0xEF,0x48,0x4A,0x00,0x00,0x00,0x00,0x48,0x4A,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x44,0x29,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x62,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xAC,
-	0xFF,0xFF,0xFF,0xFF,0x73,0xC5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0xBA,0xD6,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xFF,0xFF,
-	0xFF,0xFF,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x7B,0xFF,0xFF,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x70,0x94,0xFF,0xFF,0xFF,0xFF,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xD4,0xCD,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x94,0x70,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_2151_dial_img_0_1184_data_0, "face_2151_dial_img_0_1184_data_0.bin");
         
 
 
@@ -2186,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_0_1184_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 288,
-    .data_size = sizeof(face_2151_dial_img_0_1184_data_0),
+    .data_size = 138240,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_2151_dial_img_0_1184_data_0};
 
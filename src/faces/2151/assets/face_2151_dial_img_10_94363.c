@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,35 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_10_94363_data_0[] = {
-	//RGB565 data 
-	0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0xC3,0x69,0xA3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x83,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x69,
-	0xE3,0x71,0xC3,0x71,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0xE3,0x71,0xA3,0x69,0xC3,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x61,0x82,0x59,0x82,0x59,0xA3,0x61,0xA3,0x69,0x82,0x61,
-	0x82,0x61,0x2F,0x9C,0x1C,0xE7,0xFF,0xFF,0x1C,0xE7,0x4F,0x9C,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x71,0xC3,0x69,0xE3,0x71,0xC3,0x69,0x83,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0x82,0x61,0x4F,0x9C,0xFF,0xFF,0xBE,0xF7,0xDA,0xDE,0xBE,0xF7,0xFF,0xFF,0x4F,0x9C,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,
-	0xC3,0x69,0xA2,0x61,0xA2,0x69,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0xA3,0x69,0xC3,0x69,0x82,0x61,0x1C,0xE7,0xBE,0xF7,0x4B,0x8B,0x82,0x61,0x4B,0x8B,0xBE,0xF7,0x1C,0xE7,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0xA2,0x61,0xA2,0x61,0xC3,0x69,0xA3,0x61,0x62,0x59,0xA2,0x69,0xE3,0x71,0xE3,0x71,0x82,0x61,0xFF,0xFF,
-	0xDA,0xDE,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0xCD,0x93,0x79,0xD6,0xFF,0xFF,0xFF,0xFF,0x1C,0xEF,0x74,0xBD,0x26,0x6A,0x82,0x61,0xC3,0x69,0xC3,0x71,0x82,0x61,0x1C,0xE7,0xBE,0xF7,0x26,0x6A,0x82,0x61,0x4B,0x8B,0xBE,0xF7,0x1C,0xE7,0x83,0x61,0x82,0x61,0xB1,0xAC,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x26,0x6A,0xC3,0x69,0xC3,0x71,0x82,0x61,0x4F,0x9C,0xFF,0xFF,0xBE,0xF7,0xDA,0xDE,0xBE,0xF7,0xFF,0xFF,0x2F,0x9C,0x82,0x61,0xC9,0x7A,0xFF,0xFF,0xFF,0xFF,0x13,0xB5,0x46,0x72,0xA2,0x61,0xCD,0x93,0xBE,0xF7,0xFF,0xFF,0x38,0xD6,0x04,0x7A,0x24,0x82,0x82,0x61,0xA2,0x61,0x2F,0x9C,
-	0x1C,0xE7,0xFF,0xFF,0x1C,0xE7,0x2F,0x9C,0x82,0x61,0x82,0x61,0x74,0xBD,0xFF,0xFF,0x17,0xCE,0xA2,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0xCD,0x93,0xFF,0xFF,0xFF,0xFF,0xE8,0x92,0x85,0x8A,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x79,0xD6,0xFF,0xFF,0x2F,0x9C,0xA3,0x61,0xC3,0x69,
-	0xA2,0x61,0x82,0x61,0x82,0x61,0xCD,0x93,0x0E,0xA4,0xE7,0x92,0x44,0x82,0x83,0x61,0x83,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xDA,0xDE,0xFF,0xFF,0xCD,0x93,0xA3,0x61,0xE3,0x71,0xA3,0x69,0x82,0x61,0x82,0x59,0x82,0x61,0xC3,0x69,0xA2,0x69,0xC3,0x71,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xDA,0xDE,0xFF,0xFF,0xCD,0x93,0xA3,0x61,0xC3,0x69,0xC3,0x69,0xC3,0x69,0x62,0x61,0x62,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xDA,0xDE,0xFF,0xFF,0xCD,0x93,0x83,0x61,0xA3,0x69,0xE3,0x71,
-	0xE3,0x71,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0xCD,0x93,0x83,0x61,0xC3,0x69,0x03,0x7A,0xE3,0x71,0xC3,0x69,0x82,0x61,0x62,0x59,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0xCD,0x93,0x82,0x61,0xC3,0x69,0x03,0x72,0xE3,0x71,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x74,0xBD,0xFF,0xFF,0xD6,0xC5,0x82,0x61,0xA3,0x69,0x03,0x7A,0x04,0x7A,
-	0xE9,0x82,0xFF,0xFF,0xFF,0xFF,0xC9,0x7A,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xCD,0x93,0xFF,0xFF,0xBE,0xF7,0x4B,0x8B,0xC3,0x71,0xE3,0x71,0x87,0x82,0xDA,0xE6,0xFF,0xFF,0xDA,0xDE,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0x1C,0xEF,0xDA,0xDE,0xBE,0xF7,0xFF,0xFF,0xBE,0xF7,0x4B,0x83,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x62,0x59,0x82,0x59,0x82,0x61,0x62,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x75,0xBD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xDE,
-	0x4B,0x8B,0x62,0x61,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xC3,0x69,0xC3,0x69,0x82,0x61,0xA3,0x61,0xA3,0x69,0xCD,0x93,0xCD,0x93,0x26,0x6A,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0x82,0x59,0x62,0x59,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x69,
-	0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0xA3,0x69,0xC3,0x69,0x82,0x61,0x62,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0x62,0x61,
-	0x83,0x61,0xE5,0x59,0x26,0x5A,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_10_94363_data_0, "face_2151_dial_img_10_94363_data_0.bin");
         
 
 
@@ -48,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_10_94363_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 21,
     .header.h = 23,
-    .data_size = sizeof(face_2151_dial_img_10_94363_data_0),
+    .data_size = 1449,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_10_94363_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,35 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_11_96315_data_0[] = {
-	//RGB565 data 
-	0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0xC3,0x69,0xA3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x83,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x69,
-	0xE3,0x71,0xC3,0x71,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x69,0xE3,0x71,0xA3,0x69,0xC3,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x61,0x82,0x59,0x82,0x59,0xA3,0x61,0xA3,0x69,0x82,0x61,
-	0x82,0x61,0x13,0xB5,0xDA,0xDE,0x17,0xCE,0x4B,0x8B,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x71,0xC3,0x69,0xE3,0x71,0xC3,0x69,0x83,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0x82,0x61,0xD6,0xC5,0x1C,0xE7,0x2F,0x9C,0x74,0xBD,0xBE,0xF7,0xC9,0x7A,0x83,0x61,0xD6,0xC5,0xDA,0xDE,0xDA,0xDE,0xDA,0xDE,
-	0xDA,0xE6,0xDA,0xDE,0xDA,0xDE,0xDA,0xE6,0xDA,0xE6,0xDA,0xDE,0xDA,0xDE,0xA3,0x69,0xC3,0x69,0x82,0x61,0xBE,0xF7,0xC9,0x7A,0x82,0x61,0x82,0x61,0x17,0xCE,0x13,0xB5,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x71,0xE3,0x71,0x82,0x61,0xBE,0xF7,
-	0x26,0x72,0x82,0x61,0x82,0x61,0x17,0xCE,0x13,0xB5,0xA3,0x61,0xDA,0xDE,0xFF,0xFF,0x17,0xCE,0xCD,0x93,0xCD,0x93,0xCD,0x93,0xCD,0x93,0xCD,0x93,0xCD,0x93,0xCD,0x93,0xCD,0x93,0xC3,0x69,0xC3,0x71,0x82,0x61,0xD6,0xC5,0x1C,0xE7,0xCD,0x93,0x74,0xBD,0xBE,0xF7,0xC9,0x7A,0x83,0x61,0xDA,0xDE,0xFF,0xFF,0x75,0xBD,0xA3,0x61,0x82,0x61,
-	0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0x83,0x61,0xC3,0x69,0xC3,0x71,0x82,0x61,0x82,0x61,0x13,0xB5,0xDA,0xDE,0x17,0xCE,0x4B,0x8B,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x75,0xBD,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x62,0x61,0x82,0x61,0xC3,0x69,0x04,0x7A,0x24,0x82,0x82,0x61,0xA2,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x74,0xBD,0x82,0x61,0xA2,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0x82,0x59,0x83,0x61,0xE3,0x71,0x65,0x8A,0x85,0x8A,0x83,0x61,0x83,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x17,0xCE,0xCD,0x93,0xCD,0x93,0xEE,0x9B,
-	0xCD,0x93,0xCD,0x93,0xCD,0x93,0xCD,0x93,0x04,0x7A,0x64,0x8A,0x44,0x82,0x83,0x61,0x83,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC3,0x69,0xA2,0x69,0xC3,0x71,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x7D,0xEF,0xDA,0xDE,0xDA,0xDE,0xDA,0xE6,0xDA,0xE6,0xDA,0xE6,0xDA,0xDE,0xDA,0xDE,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x74,0xBD,0x62,0x59,0x83,0x61,0xA3,0x69,0xE3,0x71,
-	0xE3,0x71,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x74,0xBD,0x82,0x61,0x83,0x61,0xC3,0x69,0x03,0x7A,0xE3,0x71,0xC3,0x69,0x82,0x61,0x62,0x59,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x74,0xBD,0x82,0x61,0x82,0x61,0xC3,0x69,0x03,0x72,0xE3,0x71,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x74,0xBD,0x82,0x61,0x82,0x61,0xA3,0x69,0x03,0x7A,0x04,0x7A,
-	0xC3,0x71,0xA2,0x69,0x82,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x74,0xBD,0x82,0x61,0xA3,0x61,0xC3,0x71,0xE3,0x71,0x03,0x7A,0xC3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x61,
-	0x82,0x61,0x82,0x61,0xDA,0xDE,0xFF,0xFF,0x74,0xBD,0x82,0x61,0xE3,0x71,0xE3,0x71,0xA2,0x69,0xA3,0x69,0xC3,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x62,0x59,0x82,0x59,0x82,0x61,0x62,0x61,0x82,0x61,0xB1,0xAC,0x74,0xBD,0xCD,0x93,0xA3,0x61,0xE3,0x71,0xC3,0x69,0x62,0x61,0x82,0x61,0xA3,0x61,
-	0x82,0x61,0x62,0x61,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xC3,0x69,0xC3,0x69,0x82,0x61,0xA3,0x61,0xA3,0x69,0x82,0x61,0x62,0x59,0x62,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0x82,0x59,0x62,0x59,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x69,
-	0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0xA3,0x69,0xC3,0x69,0x82,0x61,0x62,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0x62,0x61,
-	0x83,0x61,0xE5,0x59,0x26,0x5A,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_11_96315_data_0, "face_2151_dial_img_11_96315_data_0.bin");
         
 
 
@@ -48,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_11_96315_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 21,
     .header.h = 23,
-    .data_size = sizeof(face_2151_dial_img_11_96315_data_0),
+    .data_size = 1449,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_11_96315_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,17 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,
-	0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,
-	0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x9A,0xD6,
-	0xCB,0x5A,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0xCB,0x5A,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0xCB,0x5A,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_0, "face_2151_dial_img_13_76712_data_0.bin");
         
 
 
@@ -30,23 +21,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_0),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x5D,0xEF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xFF,0xFF,0x38,0xC6,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x55,0xAD,0xF3,0x9C,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x5D,0xEF,0x5D,0xEF,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_1, "face_2151_dial_img_13_76712_data_1.bin");
         
 
 
@@ -54,23 +35,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_1),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xD7,0xBD,0x5D,0xEF,0x5D,0xEF,0x9A,0xD6,0x4D,0x6B,0x00,0x00,0x24,0x21,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0x9A,0xD6,
-	0x71,0x8C,0x38,0xC6,0xCB,0x5A,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0xFF,0xFF,0x38,0xC6,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xFF,0xFF,0x5D,0xEF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x5D,0xEF,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0x9A,0xD6,0x38,0xC6,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_2, "face_2151_dial_img_13_76712_data_2.bin");
         
 
 
@@ -78,23 +49,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_2),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x38,0xC6,0x5D,0xEF,0x5D,0xEF,0xD7,0xBD,0x08,0x42,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x24,0x21,0x9A,0xD6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x55,0xAD,
-	0x71,0x8C,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xFF,0xFF,0x55,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0x5D,0xEF,0xFF,0xFF,0x9A,0xD6,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x24,0x21,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xD7,0xBD,0xFF,0xFF,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0xFB,0xDE,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xBE,0xF7,0xFB,0xDE,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x55,0xAD,0xFF,0xFF,0x38,0xC6,
-	0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xBE,0xF7,0x08,0x42,0x00,0x00,0xCB,0x5A,0x9A,0xD6,0x5D,0xEF,0x5D,0xEF,0x38,0xC6,0x08,0x42,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_3, "face_2151_dial_img_13_76712_data_3.bin");
         
 
 
@@ -102,23 +63,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_3),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEF,0x7B,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0x9A,0xD6,0x9A,0xD6,0x00,0x00,
-	0xEF,0x7B,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x5D,0xEF,0x5D,0xEF,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0x00,0x00,0x5D,0xEF,0x5D,0xEF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0x5D,0xEF,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_4, "face_2151_dial_img_13_76712_data_4.bin");
         
 
 
@@ -126,23 +77,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_4),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x38,0xC6,0xFB,0xDE,0xFF,0xFF,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0x55,0xAD,0xFB,0xDE,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFB,0xDE,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0x5D,0xEF,0x71,0x8C,0x9A,0xD6,0xFB,0xDE,0xD7,0xBD,0x08,0x42,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBE,0xF7,0xFF,0xFF,0xBE,0xF7,0x08,0x42,0xFB,0xDE,0xFF,0xFF,0xEF,0x7B,0x00,0x00,0x24,0x21,0xD7,0xBD,0xFF,0xFF,0x38,0xC6,
-	0x24,0x21,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x55,0xAD,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0x38,0xC6,
-	0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0xEF,0x7B,0x9A,0xD6,0x5D,0xEF,0x5D,0xEF,0x38,0xC6,0xCB,0x5A,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_5, "face_2151_dial_img_13_76712_data_5.bin");
         
 
 
@@ -150,23 +91,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_5),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x5D,0xEF,0x5D,0xEF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x5D,0xEF,0xFB,0xDE,0xD7,0xBD,0x08,0x42,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x08,0x42,
-	0xD7,0xBD,0xFF,0xFF,0xD7,0xBD,0x00,0x00,0x24,0x21,0xD7,0xBD,0xFF,0xFF,0xD7,0xBD,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,
-	0xCB,0x5A,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xBE,0xF7,0x08,0x42,0x00,0x00,0xCB,0x5A,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x38,0xC6,0x08,0x42,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_6, "face_2151_dial_img_13_76712_data_6.bin");
         
 
 
@@ -174,23 +105,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_6),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x9A,0xD6,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x5D,0xEF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0xFF,0xFF,0x55,0xAD,
-	0x9A,0xD6,0x9A,0xD6,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0xD6,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xD7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xC6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0x5D,0xEF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_7, "face_2151_dial_img_13_76712_data_7.bin");
         
 
 
@@ -198,23 +119,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_7),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x38,0xC6,0xCB,0x5A,0x00,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xBE,0xF7,0x08,0x42,0x9A,0xD6,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,
-	0xBE,0xF7,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0xCB,0x5A,0xFF,0xFF,0xFB,0xDE,0x38,0xC6,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xD7,0xBD,0x08,0x42,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xFB,0xDE,0x24,0x21,0x08,0x42,0x5D,0xEF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x24,0x21,
-	0x9A,0xD6,0xFF,0xFF,0x55,0xAD,0x24,0x21,0x24,0x21,0xD7,0xBD,0xFF,0xFF,0x38,0xC6,0xFF,0xFF,0xBE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x5D,0xEF,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFB,0xDE,
-	0xEF,0x7B,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x4D,0x6B,0x9A,0xD6,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0xCB,0x5A,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_8, "face_2151_dial_img_13_76712_data_8.bin");
         
 
 
@@ -222,23 +133,13 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_8),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_13_76712_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x38,0xC6,0xBE,0xF7,0xBE,0xF7,0x9A,0xD6,0xCB,0x5A,0x00,0x00,0x08,0x42,0xBE,0xF7,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xCB,0x5A,0x38,0xC6,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,
-	0x5D,0xEF,0xFF,0xFF,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0xFF,0xFF,0x5D,0xEF,0x5D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x5D,0xEF,0x38,0xC6,0xFF,0xFF,0xD7,0xBD,0x00,0x00,0x00,0x00,0xD7,0xBD,0xFF,0xFF,0xD7,0xBD,0x08,0x42,0xBE,0xF7,0xFF,0xFF,0xBE,0xF7,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,
-	0x00,0x00,0x08,0x42,0xD7,0xBD,0xFB,0xDE,0x5D,0xEF,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xFF,0xFF,0xCB,0x5A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0x38,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x5D,0xEF,0x5D,0xEF,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_13_76712_data_9, "face_2151_dial_img_13_76712_data_9.bin");
         
 
 
@@ -246,7 +147,7 @@ const lv_img_dsc_t face_2151_dial_img_13_76712_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_13_76712_data_9),
+    .data_size = 336,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_13_76712_data_9};
 
@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,23 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_17_71222_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,
-	0x08,0x42,0x8E,0x73,0xFF,0xFF,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x79,0xCE,0x79,0xCE,0x08,0x42,0x04,0x21,0x10,0x84,0xFF,0xFF,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x79,0xCE,0x79,0xCE,0x08,0x42,0x04,0x21,0x10,0x84,0xFF,0xFF,0x08,0x42,0x8E,0x73,0xFF,0xFF,0x08,0x42,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x08,0x42,
-	0x8A,0x52,0x7D,0xEF,0x04,0x21,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x82,0x10,0x7D,0xEF,0xF7,0xBD,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0x8E,0x73,
-	0xFF,0xFF,0x8A,0x52,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0xFB,0xDE,0x79,0xCE,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x10,0x84,0xF3,0x9C,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x08,0x42,0x82,0x10,
-	0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,
-	0xF7,0xBD,0x00,0x00,0x00,0x00,0x04,0x21,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x10,0x84,0x10,0x84,0x10,0x84,0x82,0x10,0x00,0x00,
-	0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_17_71222_data_0, "face_2151_dial_img_17_71222_data_0.bin");
         
 
 
@@ -36,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_17_71222_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 15,
     .header.h = 15,
-    .data_size = sizeof(face_2151_dial_img_17_71222_data_0),
+    .data_size = 675,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_17_71222_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,19 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_18_81161_data_0[] = {
-	//RGB565 data 
-	0x0C,0x63,0xF7,0xBD,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xF7,0xBD,0x0C,0x63,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,
-	0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x8E,0x73,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x8E,0x73,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0xF3,0x9C,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0xF3,0x9C,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x08,0x42,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0x10,0x84,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_18_81161_data_0, "face_2151_dial_img_18_81161_data_0.bin");
         
 
 
@@ -32,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_18_81161_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 13,
-    .data_size = sizeof(face_2151_dial_img_18_81161_data_0),
+    .data_size = 390,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_18_81161_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,44 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_22_81824_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x20,0xA3,0x20,0xA3,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0x20,0xA3,0x20,0xA3,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0xA0,0xBB,0x20,0xD4,
-	0x20,0xD4,0x20,0xD4,0xA0,0xBB,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0x20,0xA3,0x20,0xA3,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x20,0xA3,0xA0,0x82,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,
-	0x00,0xFD,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xB3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,
-	0x00,0xFD,0xE0,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x20,0xD4,0x40,0x7A,0xE0,0x61,0x40,0x7A,0xA0,0xBB,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0x40,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xA3,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA0,0x82,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x60,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0x20,0xA3,0x00,0x00,0xE0,0x92,0x00,0xFD,0xA0,0xEC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xA0,0xBB,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0xA0,0xEC,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0xA0,0xEC,0x00,0xFD,
-	0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x60,0xE4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x20,0xD4,0x00,0xFD,0x60,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0xA0,0xEC,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0xFD,0x00,0xFD,
-	0xE0,0x92,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x20,0xD4,0xA0,0xBB,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xBB,0x00,0xFD,0xA0,0xBB,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x20,0xD4,0x00,0xFD,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x20,0xA3,0x00,0xFD,0xE0,0xF4,0x20,0x39,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x20,0xD4,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x20,0x39,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0x80,0x51,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,
-	0x20,0xD4,0x00,0xFD,0x40,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,0x20,0xD4,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x60,0xE4,0x00,0xFD,
-	0x20,0xA3,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0x00,0xFD,0x00,0xFD,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0x00,0xFD,
-	0xE0,0x92,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0xA0,0x82,0x00,0xFD,0xE0,0xF4,0x00,0x00,0xE0,0xF4,0x00,0xFD,0xA0,0x82,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0xA0,0xBB,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xBB,0x00,0xFD,
-	0x20,0xD4,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0xE0,0xCB,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0xE0,0xF4,0x00,0xFD,0x20,0xD4,0x00,0xFD,0xA0,0xEC,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0xE0,0x61,0x00,0xFD,
-	0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0xE0,0xF4,0x00,0xFD,0xE0,0x92,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,
-	0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0xF4,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0xA0,0xEC,0x00,0xFD,0xA0,0xEC,0x80,0x20,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0xE0,0xF4,0x00,0xFD,
-	0x00,0xFD,0x20,0xD4,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x80,0x20,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x80,0x20,0x60,0xE4,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x20,0xD4,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x80,0x51,0x00,0x00,0x00,0x00,
-	0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x92,0x00,0xFD,0x00,0xFD,0x20,0xD4,0xE0,0x92,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xBB,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0xA0,0xBB,
-	0xE0,0xF4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0xE0,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0xE0,0x61,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_22_81824_data_0, "face_2151_dial_img_22_81824_data_0.bin");
         
 
 
@@ -57,50 +21,13 @@ const lv_img_dsc_t face_2151_dial_img_22_81824_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 42,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_22_81824_data_0),
+    .data_size = 2016,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_22_81824_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_22_81824_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0xA0,0x82,0x00,0x00,0x20,0xA3,0x20,0xA3,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x39,0x20,0xA3,0xA0,0x82,0x00,0x00,0x00,0x00,0xA0,0x82,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0x00,0xFD,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x80,0x51,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x40,0x7A,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xA0,0xBB,0x20,0xA3,0x20,0xA3,
-	0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE0,0x61,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,
-	0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0x20,0xD4,0x00,0x00,
-	0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,
-	0x60,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xBB,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0xE0,0xF4,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x92,0x00,0xFD,0x00,0xFD,0xA0,0x82,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x60,0xE4,0x00,0xFD,0x00,0xFD,0xA0,0xEC,0x20,0xD4,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0x60,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,
-	0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF4,0x00,0xFD,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0xA0,0xBB,0x00,0xFD,
-	0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0xE0,0x61,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_22_81824_data_1, "face_2151_dial_img_22_81824_data_1.bin");
         
 
 
@@ -108,50 +35,13 @@ const lv_img_dsc_t face_2151_dial_img_22_81824_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 42,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_22_81824_data_1),
+    .data_size = 2016,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_22_81824_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_22_81824_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0x20,0xD4,0x60,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x20,0xD4,0x20,0xD4,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x20,0xD4,0x40,0x7A,0x40,0x7A,0x20,0xD4,0x20,0xD4,0x20,0xD4,
-	0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0x39,0x00,0x00,0x20,0xA3,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0xE0,0xCB,0x20,0xA3,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x92,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x40,0x7A,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0x00,0xFD,0x40,0x7A,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xEC,0x80,0x51,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,
-	0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x60,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0x00,0xFD,0x00,0x00,0x20,0xA3,0x00,0xFD,0xA0,0xEC,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0x39,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xD4,0x20,0xA3,
-	0x20,0xA3,0x20,0xA3,0xE0,0xCB,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x80,0x51,0x00,0x00,0x00,0x00,0xE0,0xF4,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x60,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xBB,0x00,0xFD,0x20,0xD4,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0xA0,0xEC,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0xE0,0xCB,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0x80,0x20,0x00,0x00,0x00,0x00,
-	0xA0,0xEC,0x00,0xFD,0x20,0xA3,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x20,0x39,0x00,0x00,0xE0,0x92,0x00,0xFD,0xE0,0xF4,
-	0x00,0x00,0x00,0x00,0xE0,0x92,0x00,0xFD,0xE0,0xCB,0xA0,0xEC,0x00,0xFD,0x40,0x7A,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xEC,0x00,0xFD,0xA0,0x82,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0x00,0xE0,0xCB,0x00,0xFD,0xE0,0x92,0xA0,0xBB,0x00,0xFD,0x60,0xB3,0x00,0x00,0xA0,0x82,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0xA0,0xEC,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,
-	0x20,0xA3,0xA0,0x82,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0xA0,0xEC,0x00,0xFD,0xE0,0x92,0x00,0x00,0xE0,0xF4,0x00,0xFD,0x80,0x51,0xA0,0x82,0x00,0xFD,0x60,0xE4,0x00,0x00,0x60,0xB3,0x00,0xFD,0xE0,0xCB,
-	0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0xA0,0xBB,0x00,0xFD,0xA0,0xBB,0x80,0x51,
-	0x00,0xFD,0xE0,0xF4,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0x80,0x20,0x60,0xE4,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0xA0,0xEC,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0xA0,0x82,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0xA0,0xEC,0xE0,0x92,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0xA0,0xEC,0x00,0xFD,0x40,0x7A,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0x60,0xE4,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0xA0,0xBB,0x00,0xFD,0x60,0xE4,0x00,0xFD,0xE0,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xEC,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x80,0x51,
-	0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x20,0xD4,0x00,0xFD,
-	0xA0,0xEC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xB3,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x60,0xE4,0xE0,0x61,0xE0,0x61,0xE0,0x61,0xE0,0x61,0xE0,0x61,0xE0,0x61,0xE0,0x61,0x80,0x20,0x00,0x00,
-	0x20,0xD4,0x00,0xFD,0xA0,0xBB,0xE0,0x61,0xE0,0x61,0xE0,0x61,0xA0,0x82,0xA0,0xEC,0x00,0xFD,0x00,0xFD,0x40,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0x00,0xFD,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xEC,0x00,0xFD,0x00,0xFD,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,
-	0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xA3,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x00,0xFD,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA0,0xBB,0x00,0xFD,0xA0,0xEC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x92,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xA3,0x00,0x00,0xE0,0xCB,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0xA0,0xBB,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_22_81824_data_2, "face_2151_dial_img_22_81824_data_2.bin");
         
 
 
@@ -159,50 +49,13 @@ const lv_img_dsc_t face_2151_dial_img_22_81824_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 42,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_22_81824_data_2),
+    .data_size = 2016,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_22_81824_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_22_81824_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0xA0,0x82,0x00,0x00,0x20,0xA3,0x20,0xA3,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x39,0x20,0xA3,0x20,0xA3,0x00,0x00,0x00,0x00,0xA0,0x82,0x20,0xA3,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0x00,0xFD,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x80,0x51,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x40,0x7A,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,
-	0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,
-	0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x60,0xB3,0x00,0xFD,0x60,0xE4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0xE0,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0xE0,0xF4,0x00,0xFD,0xA0,0xBB,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA0,0xBB,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x20,0xD4,0xA0,0xEC,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF4,0x00,0xFD,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF4,0x00,0xFD,0x80,0x51,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0xE0,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xD4,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0xE0,0x61,0xE0,0x61,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_22_81824_data_3, "face_2151_dial_img_22_81824_data_3.bin");
         
 
 
@@ -210,50 +63,13 @@ const lv_img_dsc_t face_2151_dial_img_22_81824_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 42,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_22_81824_data_3),
+    .data_size = 2016,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_22_81824_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_22_81824_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x60,0xB3,0x00,0x00,0x20,0xA3,0x20,0xD4,0x20,0xD4,
-	0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0xA0,0xBB,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0x20,0xD4,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xD4,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0xA0,0xEC,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x40,0x7A,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xD4,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x60,0xB3,0xA0,0xEC,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x80,0x20,0x00,0xFD,0x00,0xFD,0x20,0xA3,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF4,0x00,0xFD,0xA0,0x82,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0xE0,0xF4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x40,0x7A,0x00,0x00,0x20,0xD4,0x00,0xFD,0xA0,0xBB,0xE0,0x61,0xE0,0x61,0xE0,0x61,0xA0,0x82,
-	0x20,0xD4,0x00,0xFD,0x00,0xFD,0x80,0x20,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0x00,0xFD,0x20,0xA3,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x40,0x7A,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0xA0,0xEC,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x80,0x51,0x00,0x00,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0xA0,0xBB,0x00,0xFD,
-	0x00,0xFD,0x80,0x51,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x60,0xB3,
-	0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,
-	0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0xA0,0xEC,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x92,0x00,0xFD,
-	0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xCB,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0x00,0xFD,0x80,0x20,0x80,0x51,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_22_81824_data_4, "face_2151_dial_img_22_81824_data_4.bin");
         
 
 
@@ -261,50 +77,13 @@ const lv_img_dsc_t face_2151_dial_img_22_81824_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 42,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_22_81824_data_4),
+    .data_size = 2016,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_22_81824_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_22_81824_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0xE0,0xCB,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x60,0xB3,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x20,0xA3,0x20,0xA3,
-	0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x60,0xE4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0xE0,0xF4,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x60,0xB3,0x40,0x7A,0xE0,0x61,0xA0,0x82,0xE0,0xF4,0x00,0xFD,0xA0,0xEC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x00,0xFD,0x00,0xFD,
-	0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0xA0,0xEC,0x00,0xFD,0x20,0xA3,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x60,0xE4,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xEC,0x00,0xFD,
-	0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xB3,0x00,0xFD,0x20,0xD4,0xA0,0x82,0x00,0xFD,0xA0,0xEC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0xA3,0x00,0xFD,0x00,0xFD,0x20,0xD4,0xA0,0x82,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF4,0x00,0xFD,0xA0,0x82,0x80,0x20,0x00,0xFD,0x00,0xFD,0x40,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xB3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x60,0xE4,0xE0,0x92,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0x00,0xFD,0xE0,0xF4,0x80,0x20,0x00,0x00,0xA0,0xBB,0x00,0xFD,0xA0,0xBB,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0xE0,0x92,0x60,0xE4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0xA0,0x82,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE0,0xCB,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0x40,0x7A,0x00,0xFD,0x00,0xFD,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0xE0,0x92,0xA0,0xEC,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x20,0x39,0x00,0xFD,0x00,0xFD,0xE0,0xCB,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x00,0xFD,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x00,0xFD,0x00,0xFD,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xEC,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xD4,0x00,0x00,0xA0,0xEC,0x00,0xFD,
-	0xE0,0xCB,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x20,0xA3,0x60,0xB3,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xCB,0x00,0xFD,0xE0,0xF4,0xE0,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0x00,0xFD,0x00,0xFD,0xE0,0x92,0xE0,0x61,0x00,0xFD,0x00,0xFD,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0xA0,0xEC,0x20,0xD4,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x80,0x20,0xA0,0xBB,0x00,0xFD,0x20,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x92,0x00,0xFD,0xE0,0xF4,0x80,0x20,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x20,0x39,0x00,0x00,0xE0,0xF4,0x00,0xFD,0xA0,0x82,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0xE0,0x61,0xE0,0x61,
-	0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_22_81824_data_5, "face_2151_dial_img_22_81824_data_5.bin");
         
 
 
@@ -312,50 +91,13 @@ const lv_img_dsc_t face_2151_dial_img_22_81824_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 42,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_22_81824_data_5),
+    .data_size = 2016,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_22_81824_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_22_81824_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0xE0,0xCB,0x20,0xD4,0x20,0xD4,0x20,0xD4,0x60,0xB3,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x20,0xA3,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0xA3,0x20,0xA3,0x00,0x00,0x00,0x00,0xE0,0x61,0x20,0xA3,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x20,0xA3,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x60,0xE4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0xF4,
-	0x80,0x51,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x60,0xB3,0x40,0x7A,0xE0,0x61,0xA0,0x82,0xE0,0xF4,0x00,0xFD,0xA0,0xEC,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x80,0x20,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0x00,0xFD,0x80,0x51,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x60,0xE4,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xEC,0x00,0xFD,0xA0,0x82,
-	0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x40,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,
-	0x00,0xFD,0x00,0xFD,0x20,0xD4,0xA0,0x82,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xA3,0x60,0xB3,0x00,0xFD,0xE0,0xF4,0x80,0x20,0x00,0x00,
-	0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xB3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x60,0xE4,0xE0,0x92,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,
-	0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xA3,0x80,0x20,0xA0,0xEC,0x00,0xFD,0xE0,0xCB,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0xE0,0x92,0x60,0xE4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0xA0,0x82,0x00,0x00,0x00,0x00,0x20,0xD4,
-	0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xA3,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0xE0,0x92,0x00,0x00,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x39,0xE0,0x92,0xA0,0xEC,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0xE0,0xF4,0x20,0x39,0x20,0xD4,
-	0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x00,0xFD,0x00,0xFD,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0x00,0xFD,0x00,0x00,0x00,0x00,
-	0x20,0xA3,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,0x20,0xD4,0x20,0xD4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x00,0xFD,0xA0,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD4,0x00,0xFD,0x20,0xD4,0x00,0x00,0x60,0xB3,0x00,0xFD,0x60,0xE4,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x82,0x00,0xFD,0xE0,0xF4,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xCB,0x00,0xFD,0xE0,0xF4,0xE0,0x61,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x7A,0x00,0xFD,0x00,0xFD,0xE0,0x92,0x00,0x00,0xE0,0x61,0x00,0xFD,0x00,0xFD,0xE0,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x61,0xE0,0xF4,0x00,0xFD,0xA0,0xBB,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x39,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0xA0,0xEC,0x20,0xD4,0xE0,0xF4,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x80,0x20,0x00,0x00,0x00,0x00,0xA0,0xBB,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x20,0xD4,0xA0,0xEC,0x00,0xFD,0x00,0xFD,0xE0,0xF4,0x20,0x39,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,
-	0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE4,0x00,0xFD,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0x20,0xD4,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA0,0xBB,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0xE0,0xF4,0x00,0xFD,
-	0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE0,0xCB,0x20,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA3,0x00,0xFD,0x20,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0xE0,0xF4,0x00,0xFD,0xE0,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0xE0,0x61,0xE0,0x61,0xE0,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x51,0xE0,0x61,0xE0,0x61,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_22_81824_data_6, "face_2151_dial_img_22_81824_data_6.bin");
         
 
 
@@ -363,7 +105,7 @@ const lv_img_dsc_t face_2151_dial_img_22_81824_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 42,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_22_81824_data_6),
+    .data_size = 2016,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_22_81824_data_6};
 
@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,13 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_27_80776_data_0[] = {
-	//RGB565 data 
-	0xD7,0xBD,0xD7,0xBD,0xD7,0xBD,0x51,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xBD,0x28,0x42,0x28,0x42,0x28,0x42,0x86,0x31,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_27_80776_data_0, "face_2151_dial_img_27_80776_data_0.bin");
         
 
 
@@ -26,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_27_80776_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 4,
     .header.h = 4,
-    .data_size = sizeof(face_2151_dial_img_27_80776_data_0),
+    .data_size = 48,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_27_80776_data_0};
 
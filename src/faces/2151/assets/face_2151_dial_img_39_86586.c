@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,22 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_39_86586_data_0[] = {
-	//RGB565 data 
-	0x82,0x10,0xF3,0x9C,0xFF,0xFF,0x7D,0xEF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xF7,0xBD,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0x7D,0xEF,0x8A,0x52,0x8E,0x73,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x10,0x84,0x7D,0xEF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0x10,0x84,0x00,0x00,0x82,0x10,0x7D,0xEF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0xFB,0xDE,
-	0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x71,0x8C,0x75,0xAD,0x7D,0xEF,0x04,0x21,0x0C,0x63,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x75,0xAD,0xF3,0x9C,0x86,0x31,0x00,0x00,0xFB,0xDE,0xF3,0x9C,0x00,0x00,0x0C,0x63,0xF7,0xBD,0x75,0xAD,
-	0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x0C,0x63,0xFF,0xFF,0x71,0x8C,0x75,0xAD,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0x8A,0x52,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFB,0xDE,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x0C,0x63,
-	0x00,0x00,0x00,0x00,0xF3,0x9C,0xFB,0xDE,0x82,0x10,0x86,0x31,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x7D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x08,0x42,0x86,0x31,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0x00,0x00,
-    };
+ASSET_BIN(face_2151_dial_img_39_86586_data_0, "face_2151_dial_img_39_86586_data_0.bin");
         
 
 
@@ -35,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_39_86586_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 14,
     .header.h = 14,
-    .data_size = sizeof(face_2151_dial_img_39_86586_data_0),
+    .data_size = 588,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_39_86586_data_0};
 
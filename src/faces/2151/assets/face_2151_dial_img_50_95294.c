@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,43 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_50_95294_data_0[] = {
-	//RGB565 data 
-	0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x17,0xD6,0xBE,0xF7,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,
-	0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xE4,0x69,0x82,0x61,0xA3,0x61,0xA3,0x61,0x58,0xD6,0xFF,0xFF,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xC3,0x69,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x7D,0xF7,0x79,0xDE,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x6F,0xAC,0xFF,0xFF,0xC8,0x82,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x09,0x83,0x4F,0xA4,
-	0xD1,0xB4,0xD1,0xB4,0x2E,0xA4,0x17,0xD6,0x0D,0x9C,0xA2,0x61,0xCD,0x9B,0x90,0xAC,0x70,0xAC,0xCD,0x9B,0x82,0x61,0xCC,0x9B,0xB5,0xC5,0x04,0x6A,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x67,0x7A,0xF6,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x3C,0xEF,0x0E,0xA4,0x25,0x72,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD5,0xCD,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA7,0x7A,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xDE,
-	0x6A,0x8B,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6F,0xAC,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB5,0xCD,0x2E,0xA4,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x58,0xDE,0xA2,0x61,0xCD,0x9B,0x0E,0x9C,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xC8,0x82,0xF6,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2E,0xA4,0x78,0xDE,0xFF,0xFF,0xFF,0xFF,0x58,0xD6,
-	0xA2,0x61,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x09,0x83,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xDE,0xB0,0xAC,0xFF,0xFF,0xFF,0xFF,0x16,0xCE,0x82,0x61,0x25,0x6A,0x25,0x72,
-	0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x4A,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x12,0xBD,0x90,0xAC,0x33,0xBD,0x09,0x83,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,
-	0xC3,0x69,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xDE,0xAC,0x93,0x83,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6F,0xAC,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x33,0xBD,0x0E,0x9C,0xA7,0x7A,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0xAC,0x87,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0xAC,0x82,0x61,0x83,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x78,0xDE,0xA3,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0xC3,0x69,0x58,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xD6,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE3,0x71,0x8B,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0xB4,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0xC3,0x71,0xA3,0x61,0xB9,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x87,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0xE4,0x69,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4F,0xA4,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xF1,0xB4,0xFA,0xE6,0x9E,0xF7,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xBE,0xFF,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0xBE,0xF7,0x7D,0xF7,0x99,0xDE,0x6B,0x8B,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0xA3,0x69,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0xC3,0x69,0x82,0x61,0x82,0x61,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0xE3,0x71,0xA3,0x69,
-	0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_50_95294_data_0, "face_2151_dial_img_50_95294_data_0.bin");
         
 
 
@@ -56,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_50_95294_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 29,
     .header.h = 23,
-    .data_size = sizeof(face_2151_dial_img_50_95294_data_0),
+    .data_size = 2001,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_50_95294_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,43 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_51_105316_data_0[] = {
-	//RGB565 data 
-	0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA1,0x92,0xE0,0xF4,0x81,0xBB,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,
-	0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x01,0xA3,0x00,0xFD,0x00,0xD4,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x92,0x42,0x82,
-	0xA3,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x8A,0x60,0xE4,0x41,0xAB,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xE2,0x71,0xE2,0xA2,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x62,0x8A,0x00,0xFD,0x00,0xFD,0x62,0x82,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xE2,0x71,0x80,0xE4,0x00,0xFD,0x21,0xAB,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x22,0x7A,0x60,0xE4,0x00,0xFD,0x82,0x92,0xA2,0x61,0x82,0x61,0xA3,0x61,0x22,0x7A,0x62,0x8A,
-	0x42,0x82,0x82,0x61,0xA2,0x61,0xA2,0x61,0x02,0x72,0x00,0xFD,0xC0,0xF4,0x82,0x8A,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xC3,0x69,0x42,0x82,0xA2,0x61,0xA3,0x61,0x62,0x8A,0x40,0xDC,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x80,0xEC,0xE1,0x9A,
-	0xA2,0x61,0x82,0x61,0xE2,0x71,0xC2,0x71,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x21,0xAB,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xC1,0xC3,0x82,0x61,0x82,0x61,
-	0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x22,0x7A,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x01,0xA3,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,
-	0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x40,0xDC,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE2,0x71,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,
-	0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x21,0xA3,0x41,0xB3,0x01,0xA3,0xA3,0x61,0xC2,0x69,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xC1,0x9A,0x82,0x61,0xC2,0x92,0x41,0xB3,0x01,0xA3,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,
-	0xA2,0x61,0xA3,0x61,0x82,0x61,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA3,0x61,0x02,0x72,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x01,0xA3,0x82,0x61,0xC0,0xF4,0x00,0xFD,0x00,0xFD,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,
-	0x01,0xA3,0x21,0xAB,0xE1,0xA2,0xA2,0x61,0xC2,0x69,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA1,0x92,0xA3,0x61,0xA2,0x92,0x21,0xAB,0x01,0xA3,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0x82,0x61,0x20,0xDC,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xC2,0x69,0xA2,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x22,0x7A,
-	0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xE1,0x9A,0xA3,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x69,0xA3,0x69,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x01,0xA3,0x00,0xFD,0x00,0xFD,
-	0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0xA1,0xC3,0xA3,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0xC3,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x61,0xA3,0x61,0xC3,0x69,0xA3,0x61,0x22,0x7A,0x82,0x61,0xA3,0x61,0x42,0x82,0x20,0xDC,0x00,0xFD,0x00,0xFD,0x00,0xFD,
-	0x60,0xE4,0xC1,0x9A,0x82,0x61,0x82,0x61,0x02,0x72,0xC2,0x69,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE3,0x71,0xC3,0x69,0xA2,0x69,0x82,0x61,0xA3,0x69,0x82,0x61,0x42,0x82,0x40,0xDC,0x00,0xFD,0xA2,0x92,0x82,0x61,0x82,0x61,0x82,0x61,0x02,0x72,0x42,0x82,0x22,0x7A,0x82,0x61,0x83,0x61,0x82,0x61,
-	0xE2,0x71,0x00,0xFD,0xA0,0xEC,0x42,0x82,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0xC3,0x71,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x62,0x8A,0x00,0xFD,0x00,0xFD,0x62,0x82,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE2,0x71,0x60,0xE4,0x00,0xFD,
-	0xE1,0xA2,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x62,0x8A,0x22,0x82,0xA3,0x69,0x82,0x61,0xA2,0x61,0xC3,0x61,0x82,0x92,0xA0,0xEC,0x41,0xB3,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0xC2,0x69,0xC1,0x9A,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0xC3,0x69,0xC3,0x69,0xC3,0x69,0x01,0xA3,0x00,0xFD,0x00,0xD4,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0xA3,0x69,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0xC3,0x69,0x82,0x61,0x82,0x61,0xC3,0x69,0xA3,0x69,0xA1,0x92,0xE0,0xF4,0x61,0xB3,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0xE3,0x71,0xA3,0x69,
-	0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_51_105316_data_0, "face_2151_dial_img_51_105316_data_0.bin");
         
 
 
@@ -56,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_51_105316_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 29,
     .header.h = 23,
-    .data_size = sizeof(face_2151_dial_img_51_105316_data_0),
+    .data_size = 2001,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_51_105316_data_0};
 
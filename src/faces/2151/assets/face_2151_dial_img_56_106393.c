@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,43 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_56_106393_data_0[] = {
-	//RGB565 data 
-	0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xD1,0xB4,0x17,0xD6,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x4A,0x8B,0x0D,0x9C,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0x4A,0x8B,0xFF,0xFF,0x33,0xBD,0xA2,0x61,0xA3,0x61,0x4A,0x8B,0xFF,0xFF,0x8B,0x93,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,
-	0xA3,0x61,0xA3,0x61,0x87,0x7A,0xFF,0xFF,0xD1,0xB4,0xA2,0x61,0xA2,0x61,0x4A,0x8B,0xFF,0xFF,0xA7,0x7A,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,
-	0x66,0x7A,0xFF,0xFF,0xD1,0xB4,0xA3,0x61,0xA3,0x61,0x2E,0xA4,0xFF,0xFF,0x09,0x83,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xE4,0x69,0x87,0x7A,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x4A,0x8B,0xAC,0x93,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xE4,0x69,0x09,0x83,0xFF,0xFF,
-	0x0E,0x9C,0xA3,0x61,0xA3,0x61,0x74,0xC5,0xB0,0xAC,0xA2,0x61,0x2A,0x8B,0x58,0xD6,0x1B,0xEF,0x3C,0xEF,0x1B,0xEF,0xD6,0xCD,0x66,0x72,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xCD,0x9B,0xFF,0xFF,0x29,0x8B,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x1B,0xEF,0x6F,0xAC,0x25,0x72,0xFF,0xFF,0x6B,0x8B,0xA3,0x61,
-	0xA3,0x61,0x82,0x61,0xF2,0xB4,0xFF,0xFF,0xD5,0xCD,0x09,0x83,0x46,0x72,0x8B,0x93,0xBA,0xE6,0xFF,0xFF,0xA7,0x7A,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x0E,0xA4,0xFF,0xFF,0x09,0x83,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xFF,0xFF,0x4F,0xA4,0x86,0x7A,0xFF,0xFF,0xE8,0x82,0xA2,0x61,0xA2,0x61,0x12,0xB5,
-	0xAC,0x9B,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0x90,0xAC,0xFF,0xFF,0x25,0x72,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xB0,0xAC,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xF2,0xB4,0xFF,0xFF,0x25,0x72,0xC3,0x69,0x90,0xAC,0x45,0x72,0xFF,0xFF,0x4A,0x8B,0x8B,0x93,0xFF,0xFF,0xA7,0x7A,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,
-	0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x1B,0xE7,0x16,0xCE,0x82,0x61,0x82,0x61,0xA3,0x61,0xFB,0xE6,0x99,0xDE,0xA2,0x61,0xA2,0x61,0xA3,0x61,0x74,0xC5,0xFF,0xFF,0xC3,0x69,0x7D,0xF7,0x53,0xBD,0xA3,0x61,0xFF,0xFF,0x87,0x7A,0x4F,0xA4,0xFF,0xFF,0x04,0x6A,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x83,0x61,
-	0xA2,0x61,0xE8,0x82,0x5C,0xEF,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x5C,0xEF,0xD6,0xCD,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x16,0xCE,0x9D,0xF7,0x82,0x61,0x5D,0xF7,0x33,0xBD,0xE4,0x69,0xFF,0xFF,0x25,0x72,0x90,0xAC,0xFF,0xFF,0xC4,0x69,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xE4,0x69,0x99,0xDE,
-	0x82,0x61,0xA2,0x61,0xA3,0x61,0xA3,0x61,0x04,0x6A,0xDF,0xFF,0x2E,0xA4,0xA7,0x7A,0x82,0x61,0xA3,0x61,0x1B,0xEF,0x58,0xD6,0xA2,0x61,0xFF,0xFF,0xAC,0x93,0xC8,0x82,0xFF,0xFF,0xA3,0x61,0xD6,0xCD,0x9E,0xF7,0xA3,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0x79,0xDE,0x82,0x61,0x82,0x61,0xA2,0x61,
-	0xA2,0x61,0xA3,0x61,0xE4,0x69,0xFF,0xFF,0x94,0xC5,0x82,0x61,0xA3,0x61,0xA3,0x61,0xDF,0xFF,0x33,0xBD,0xA3,0x61,0xFF,0xFF,0x4A,0x8B,0x4A,0x8B,0xFF,0xFF,0x82,0x61,0x17,0xD6,0xBE,0xFF,0x25,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0x66,0x72,0x1B,0xEF,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xC8,0x7A,
-	0x9D,0xF7,0x25,0x72,0xA3,0x61,0xA2,0x61,0x82,0x61,0x66,0x7A,0xFF,0xFF,0xC4,0x69,0xE9,0x82,0xFF,0xFF,0xA8,0x7A,0xED,0x9B,0xBE,0xFF,0xC3,0x69,0x95,0xC5,0x6B,0x93,0x82,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x17,0xD6,0x99,0xDE,0x82,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xB0,0xAC,0xB9,0xDE,0xA3,0x61,0xA3,0x61,
-	0xA3,0x61,0x82,0x61,0x82,0x61,0xBA,0xE6,0xB0,0xAC,0xA2,0x61,0xAC,0x93,0xFF,0xFF,0xE4,0x69,0x12,0xBD,0xFF,0xFF,0x83,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x83,0x61,0x82,0x61,0x2A,0x8B,0xFF,0xFF,0xC8,0x82,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0x4F,0xA4,0x1B,0xE7,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,
-	0x3C,0xEF,0xED,0x9B,0x82,0x61,0x82,0x61,0x0E,0x9C,0xFF,0xFF,0xA3,0x61,0xB0,0xAC,0xFF,0xFF,0x0D,0x9C,0xA3,0x61,0x83,0x61,0xC3,0x61,0x12,0xBD,0xFF,0xFF,0xCC,0x9B,0xA3,0x61,0xA3,0x61,0x83,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x69,0x66,0x7A,0xFF,0xFF,0xAC,0x93,0xA3,0x61,0xA3,0x61,0xA2,0x61,0xB0,0xAC,0xFF,0xFF,0xC3,0x61,0xA3,0x61,
-	0x82,0x61,0x82,0x61,0x90,0xAC,0xFF,0xFF,0x04,0x6A,0xAC,0x93,0x1B,0xEF,0x1B,0xEF,0xFB,0xE6,0x1B,0xEF,0xFB,0xE6,0x8B,0x93,0xA3,0x61,0x83,0x61,0x83,0x61,0x82,0x61,0xC3,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x69,0x4F,0xAC,0xFF,0xFF,0xB0,0xB4,0x8B,0x93,0x12,0xB5,0xFF,0xFF,0x0E,0x9C,0x83,0x61,0xA3,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,
-	0x74,0xC5,0xFF,0xFF,0x82,0x61,0x82,0x61,0x8B,0x93,0x4F,0xA4,0x2A,0x8B,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE3,0x71,0xC3,0x69,0xA2,0x69,0x82,0x61,0xA3,0x69,0x4A,0x93,0x1B,0xEF,0x7D,0xF7,0xDA,0xE6,0x09,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x94,0xC5,0xFF,0xFF,
-	0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0xC3,0x71,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xC4,0x69,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xD6,0xCD,0xFF,0xFF,0xC8,0x82,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0x82,0x61,0xA2,0x61,0xC3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xDA,0xE6,0x33,0xBD,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA2,0x61,0xA3,0x69,0xC3,0x69,0xC3,0x69,0xC3,0x69,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0xA3,0x69,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA3,0x69,0xC3,0x69,0x82,0x61,0x82,0x61,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xA3,0x61,0x82,0x61,0xE3,0x71,0xA3,0x69,
-	0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x69,0xA2,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA3,0x61,0x82,0x61,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_56_106393_data_0, "face_2151_dial_img_56_106393_data_0.bin");
         
 
 
@@ -56,7 +21,7 @@ const lv_img_dsc_t face_2151_dial_img_56_106393_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 29,
     .header.h = 23,
-    .data_size = sizeof(face_2151_dial_img_56_106393_data_0),
+    .data_size = 2001,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_56_106393_data_0};
 
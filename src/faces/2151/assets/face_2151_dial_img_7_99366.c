@@ -5,6 +5,7 @@
 // Watchface: 2151
 
 #include "../2151.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,20 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_0[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0x58,0xD6,0xBE,0xF7,0xBE,0xF7,0x58,0xD6,0x6C,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x82,0x61,0x5D,0xEF,
-	0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x46,0x72,0xF7,0xCD,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,
-	0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x5D,0xEF,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x82,0x61,0xF7,0xCD,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0x58,0xD6,0xBE,0xF7,0xBE,0xF7,0x58,0xD6,0x6C,0x8B,0x82,0x61,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_0, "face_2151_dial_img_7_99366_data_0.bin");
         
 
 
@@ -33,26 +21,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_0),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_1[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xF7,0xCD,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x58,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0xBA,0xDE,0xFF,0xFF,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xBA,0xDE,0x6C,0x8B,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xF7,0xCD,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,
-	0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_1, "face_2151_dial_img_7_99366_data_1.bin");
         
 
 
@@ -60,26 +35,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_1),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_2[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0x58,0xD6,0x5D,0xEF,0xBE,0xF7,0xBA,0xDE,0xEE,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x70,0xA4,0x82,0x61,0x82,0x61,0x1B,0xE7,
-	0xFF,0xFF,0xF7,0xCD,0x46,0x72,0x82,0x61,0x95,0xC5,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0xE9,0x7A,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBE,0xF7,0xFF,0xFF,0x6C,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0xBE,0xF7,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0x5D,0xEF,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBA,0xDE,0xFF,0xFF,0xBA,0xDE,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x95,0xC5,0xFF,0xFF,
-	0xBE,0xF7,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x70,0xA4,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xBE,0xF7,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0x1B,0xE7,0xFF,0xFF,0x58,0xD6,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x58,0xD6,0xFF,0xFF,0x5D,0xEF,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6C,0x8B,0x6C,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6C,0x8B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_2, "face_2151_dial_img_7_99366_data_2.bin");
         
 
 
@@ -87,26 +49,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_2),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_3[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xBA,0xDE,0xFF,0xFF,0x5D,0xEF,0xF7,0xCD,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0xD2,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x46,0x72,0x82,0x61,0x46,0x72,0xBE,0xF7,
-	0xFF,0xFF,0x95,0xC5,0x46,0x72,0xE9,0x7A,0x1B,0xE7,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x70,0xA4,0xFF,0xFF,0xBE,0xF7,0x82,0x61,0x82,0x61,0x82,0x61,0x70,0xA4,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x6C,0x8B,0x34,0xB5,0x70,0xA4,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0xBA,0xDE,0xFF,0xFF,0x95,0xC5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x58,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x58,0xD6,0xFF,0xFF,
-	0xFF,0xFF,0x5D,0xEF,0x6C,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0x95,0xC5,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBE,0xF7,0xFF,0xFF,0xE9,0x7A,0x95,0xC5,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,
-	0xFF,0xFF,0xE9,0x7A,0x70,0xA4,0xFF,0xFF,0xFF,0xFF,0x70,0xA4,0x46,0x72,0xE9,0x7A,0x58,0xD6,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x58,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0xD2,0xAC,0xBA,0xDE,0xFF,0xFF,0x5D,0xEF,0x58,0xD6,0x6C,0x8B,0x82,0x61,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_3, "face_2151_dial_img_7_99366_data_3.bin");
         
 
 
@@ -114,26 +63,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_3),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_4[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x1B,0xE7,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x70,0xA4,0xFF,0xFF,0xBE,0xF7,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0xBA,0xDE,0xFF,0xFF,0x95,0xC5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBA,0xDE,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0xFF,0xFF,
-	0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xF7,0xCD,0xFF,0xFF,0x58,0xD6,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x58,0xD6,0x58,0xD6,0xE9,0x7A,0x82,0x61,0x82,0x61,0x95,0xC5,0xFF,0xFF,0xBA,0xDE,0x82,0x61,0x82,0x61,
-	0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x46,0x72,0xBE,0xF7,0xFF,0xFF,0x70,0xA4,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x34,0xB5,0xFF,0xFF,0x5D,0xEF,0xE9,0x7A,0xE9,0x7A,0xE9,0x7A,0xBE,0xF7,0xFF,0xFF,0x70,0xA4,0xE9,0x7A,0x58,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x58,0xD6,0x58,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x58,0xD6,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x5D,0xEF,0xFF,0xFF,0x6C,0x8B,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_4, "face_2151_dial_img_7_99366_data_4.bin");
         
 
 
@@ -141,26 +77,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_4),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_5[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0x82,0x61,0x82,0x61,0xFF,0xFF,
-	0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0x95,0xC5,
-	0x5D,0xEF,0xFF,0xFF,0xBA,0xDE,0x70,0xA4,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x70,0xA4,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0x95,0xC5,0x82,0x61,0x82,0x61,0xF7,0xCD,0xFF,0xFF,0x1B,0xE7,0x82,0x61,0x82,0x61,0x6C,0x8B,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x46,0x72,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x46,0x72,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x6C,0x8B,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,
-	0xFF,0xFF,0x46,0x72,0x82,0x61,0xBE,0xF7,0xFF,0xFF,0xF7,0xCD,0x46,0x72,0xE9,0x7A,0x58,0xD6,0xFF,0xFF,0x1B,0xE7,0x82,0x61,0x82,0x61,0x70,0xA4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xBA,0xDE,0xBE,0xF7,0xBE,0xF7,0x58,0xD6,0x6C,0x8B,0x82,0x61,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_5, "face_2151_dial_img_7_99366_data_5.bin");
         
 
 
@@ -168,26 +91,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_5),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_6[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xBE,0xF7,0xBE,0xF7,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x95,0xC5,0xFF,0xFF,0xBA,0xDE,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0xBE,0xF7,0xFF,0xFF,0x70,0xA4,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x70,0xA4,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBA,0xDE,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,
-	0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xF7,0xCD,0xFF,0xFF,0x58,0xD6,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0xBE,0xF7,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xBA,0xDE,0xEE,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0x34,0xB5,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBE,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0x70,0xA4,0x82,0x61,0x82,0x61,0x5D,0xEF,0xFF,0xFF,0x95,0xC5,0x82,0x61,0x82,0x61,0x95,0xC5,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xBE,0xF7,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBE,0xF7,0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xBE,0xF7,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBE,0xF7,
-	0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x5D,0xEF,0xFF,0xFF,0x95,0xC5,0x82,0x61,0x82,0x61,0x95,0xC5,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0x58,0xD6,0xBE,0xF7,0xBE,0xF7,0x58,0xD6,0x6C,0x8B,0x82,0x61,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_6, "face_2151_dial_img_7_99366_data_6.bin");
         
 
 
@@ -195,26 +105,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_6),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_7[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0xBA,0xDE,0xFF,0xFF,0x5D,0xEF,0xBA,0xDE,0xBA,0xDE,0xBA,0xDE,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0xBA,0xDE,0xFF,0xFF,
-	0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0x70,0xA4,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0xBA,0xDE,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0xF7,0xCD,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0x70,0xA4,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x34,0xB5,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x1B,0xE7,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x95,0xC5,0xFF,0xFF,
-	0xBA,0xDE,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xBE,0xF7,0xFF,0xFF,0xD2,0xAC,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xD2,0xAC,0xFF,0xFF,0xBE,0xF7,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x58,0xD6,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x6C,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x34,0xB5,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x5D,0xEF,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_7, "face_2151_dial_img_7_99366_data_7.bin");
         
 
 
@@ -222,26 +119,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_7),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_8[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0xBA,0xDE,0xBE,0xF7,0x5D,0xEF,0xF7,0xCD,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xE9,0x7A,0x82,0x61,0x82,0x61,0x1B,0xE7,
-	0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x46,0x72,0x1B,0xE7,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0x46,0x72,
-	0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0xBA,0xDE,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x46,0x72,0x1B,0xE7,0xFF,0xFF,0x95,0xC5,0x82,0x61,0x82,0x61,0xE9,0x7A,0xBE,0xF7,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xBE,0xF7,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0x5D,0xEF,0xE9,0x7A,0x82,0x61,0x46,0x72,0xBE,0xF7,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x46,0x72,0xF7,0xCD,0xFF,0xFF,0x1B,0xE7,0x82,0x61,0xD2,0xAC,0xFF,0xFF,0xBA,0xDE,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0xD2,0xAC,0xFF,0xFF,0xBA,0xDE,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,
-	0xFF,0xFF,0xE9,0x7A,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0xD2,0xAC,0x82,0x61,0x46,0x72,0xF7,0xCD,0xFF,0xFF,0x5D,0xEF,0x82,0x61,0x82,0x61,0x34,0xB5,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xBA,0xDE,0xBE,0xF7,0x5D,0xEF,0x58,0xD6,0xE9,0x7A,0x82,0x61,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_8, "face_2151_dial_img_7_99366_data_8.bin");
         
 
 
@@ -249,26 +133,13 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_8),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_7_99366_data_9[] = {
-	//RGB565 data 
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0x58,0xD6,0xBE,0xF7,0xBE,0xF7,0x58,0xD6,0x6C,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x93,0x82,0x61,0x82,0x61,0x1B,0xE7,0xFF,0xFF,0xF7,0xCD,0x46,0x72,0x46,0x72,0xF7,0xCD,0xFF,0xFF,0x1B,0xE7,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x82,0x61,0x46,0x72,0xFF,0xFF,0xFF,0xFF,0x46,0x72,0x82,0x61,0x1B,0xE7,0xFF,0xFF,0xF7,0xCD,0x46,0x72,0x46,0x72,0xF7,0xCD,0xFF,0xFF,0x1B,0xE7,0x82,0x61,0x82,0x61,0xEE,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xD2,0xAC,0x82,0x61,0x82,0x61,0x82,0x61,0xEE,0x93,0xBA,0xDE,0xFF,0xFF,0x5D,0xEF,0xFF,0xFF,0xBE,0xF7,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x58,0xD6,0xFF,0xFF,0x34,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x6C,0x8B,0xFF,0xFF,0xBE,0xF7,0x46,0x72,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x58,0xD6,0xFF,0xFF,0x95,0xC5,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xE9,0x7A,0xFF,0xFF,0xFF,0xFF,0xE9,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xF7,0xCD,0xFF,0xFF,0xF7,0xCD,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_2151_dial_img_7_99366_data_9, "face_2151_dial_img_7_99366_data_9.bin");
         
 
 
@@ -276,7 +147,7 @@ const lv_img_dsc_t face_2151_dial_img_7_99366_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 16,
-    .data_size = sizeof(face_2151_dial_img_7_99366_data_9),
+    .data_size = 480,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_2151_dial_img_7_99366_data_9};
 
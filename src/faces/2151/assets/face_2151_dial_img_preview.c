@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 2151
-
-#include "../2151.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_2151_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,
-	0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,
-	0x82,0x61,0xF2,0xB4,0x37,0xCE,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x83,0x61,0xC3,0x71,0xC3,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0x82,0x61,0xA3,0x61,0xA7,0x7A,0x74,0xBD,
-	0xA3,0x61,0x86,0x72,0xC8,0x7A,0xA2,0x61,0x4F,0xA4,0x6A,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x70,0xA4,0x12,0xB5,0x87,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x69,0xC3,0x69,0x82,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x04,0x6A,0xCC,0x93,0x53,0xBD,0x94,0xC5,0x73,0xBD,0x90,0xAC,
-	0x66,0x72,0x33,0xBD,0x33,0xBD,0x29,0x8B,0x8B,0x93,0x86,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x86,0x7A,0x09,0x83,0xC7,0x7A,0xC3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x61,0x09,0x83,0x25,0x6A,0x82,0x61,0x82,0x61,0xE8,0x82,0x09,0x83,0x09,0x83,0x09,0x83,0x09,0x83,0x09,0x83,0xE4,0x69,0x12,0xB5,
-	0x54,0xB5,0x2E,0x9C,0x58,0xCE,0xE5,0x69,0x58,0xCE,0x1B,0xE7,0x1B,0xE7,0x1B,0xE7,0x1B,0xE7,0x1B,0xE7,0x1B,0xE7,0x09,0x8B,0xC3,0x69,0x03,0x82,0x23,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0xA2,0x61,0x25,0x6A,0xBA,0xDE,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x1B,0xE7,
-	0x12,0xB5,0xD9,0xDE,0xFF,0xFF,0x7D,0xEF,0x29,0x8B,0x82,0x61,0xA3,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x2E,0x9C,0x5C,0xEF,0xBE,0xF7,0x9D,0xF7,0xF6,0xC5,0xE4,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x0E,0x9C,0x9D,0xF7,0x09,0x83,0x82,0x61,0x82,0x61,0xFB,0xE6,0x9D,0xEF,0xFB,0xE6,0xFB,0xE6,0x3C,0xE7,0xFF,0xFF,0x4B,0x83,0x17,0xCE,
-	0x05,0x6A,0x82,0x61,0xD6,0xC5,0x66,0x72,0x1B,0xE7,0xDA,0xDE,0xD1,0xAC,0xD1,0xAC,0xD1,0xAC,0xD1,0xAC,0xD1,0xAC,0x86,0x7A,0xC3,0x71,0x44,0x82,0x23,0x82,0xE3,0x79,0xA2,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x61,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA2,0x61,0x04,0x6A,0x58,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7D,0xEF,0xB0,0xAC,0x9D,0xF7,0xFF,0xFF,0x12,0xBD,0x0D,0x9C,0x0E,0x9C,0x82,0x61,0x82,0x61,0xC3,0x61,0x9D,0xEF,0xB5,0xC5,0xA2,0x61,0x4F,0xA4,0xDE,0xF7,0x4A,0x8B,0x82,0x61,0x82,0x61,0xA2,0x61,0x58,0xD6,0xBA,0xDE,0x04,0x6A,0x82,0x61,0x82,0x61,0xFB,0xE6,0xD6,0xC5,0x82,0x61,0x82,0x61,0x95,0xBD,0x9D,0xEF,0xE4,0x69,0xED,0x93,
-	0x17,0xCE,0x53,0xB5,0x94,0xBD,0xC3,0x61,0x1B,0xE7,0x17,0xCE,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0xC3,0x69,0xC3,0x71,0x23,0x82,0x44,0x8A,0xE3,0x71,0xC3,0x71,0xE3,0x71,0x44,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x61,0xE3,0x61,0xD0,0xAC,0xDA,0xDE,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x58,0xD6,0xD5,0xC5,0xFF,0xFF,0xF1,0xB4,0x09,0x83,0x09,0x83,0x82,0x61,0x82,0x61,0x87,0x72,0xFF,0xFF,0x4A,0x8B,0x82,0x61,0xA2,0x61,0xFF,0xFF,0x2E,0x9C,0x82,0x61,0x82,0x61,0xA7,0x7A,0x7D,0xEF,0xB1,0xA4,0x82,0x61,0x82,0x61,0x82,0x61,0xE8,0x82,0x87,0x7A,0x82,0x61,0xE4,0x69,0x9D,0xEF,0x95,0xBD,0x82,0x61,0x82,0x61,
-	0x86,0x72,0xA7,0x7A,0xC3,0x69,0x82,0x61,0x1B,0xE7,0x17,0xCE,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x24,0x7A,0x44,0x82,0xE3,0x71,0x82,0x61,0x82,0x61,0xA2,0x69,0xE3,0x71,0x44,0x8A,0x65,0x8A,0x64,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x61,0xA2,0x61,0xC3,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x53,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xFF,0x94,0xC5,0xD1,0xB4,0x46,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x87,0x72,0xFF,0xFF,0x09,0x83,0x82,0x61,0x82,0x61,0xFF,0xFF,0x2E,0x9C,0x82,0x61,0x82,0x61,0xB1,0xA4,0x9D,0xF7,0xE4,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x90,0xA4,0x9E,0xF7,0xC8,0x7A,0x82,0x61,0x83,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x1B,0xE7,0xDA,0xDE,0xD1,0xAC,0xD2,0xAC,0xD1,0xAC,0xD1,0xAC,0x0E,0x9C,0x23,0x7A,0x03,0x7A,0x82,0x61,0x62,0x59,0x82,0x61,0x82,0x61,0xE3,0x71,0x64,0x8A,0x84,0x92,0x65,0x8A,0x64,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x8A,0x43,0x8A,0xE3,0x79,0xA2,0x61,0xA2,0x61,0xA3,0x69,0xE3,0x71,0xA3,0x69,0xE3,0x71,0x03,0x7A,0xA3,0x69,0x82,0x61,0x29,0x8B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x1B,0xE7,0x0E,0x9C,0xA7,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x87,0x72,0xFF,0xFF,0x09,0x83,0x82,0x61,0x82,0x61,0xFF,0xFF,0x2E,0x9C,0x82,0x61,0xE4,0x69,0x7D,0xEF,0x7D,0xEF,0x16,0xCE,0xCD,0x93,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0x78,0xD6,0xDA,0xDE,0x04,0x6A,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x1B,0xE7,0x9D,0xEF,0x1B,0xE7,0x1B,0xE7,0x1B,0xE7,0x1B,0xE7,0xB5,0xC5,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x59,0x82,0x61,0x62,0x59,0xA2,0x69,0x44,0x8A,0xA4,0x9A,0x26,0xBB,0xE5,0xAA,0xA4,0xA2,0xE5,0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC4,0xAA,0x84,0x9A,0xC3,0x69,0xC3,0x69,0xE3,0x71,0x04,0x7A,0x24,0x82,0x44,0x8A,0xE3,0x79,0xA2,0x61,0xB5,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0xC8,0x82,0x82,0x61,0x82,0x61,0x82,0x61,0x87,0x72,0xFF,0xFF,0x09,0x83,0x82,0x61,0x82,0x61,0xFF,0xFF,0x2E,0x9C,0x82,0x61,0xB1,0xA4,0xBE,0xF7,0x78,0xD6,0x78,0xD6,0xBE,0xF7,0x2F,0x9C,0x82,0x61,0x82,0x61,0x82,0x61,0xA7,0x7A,0x7D,0xEF,0x12,0xB5,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x1B,0xE7,0x16,0xCE,0x62,0x59,0xA3,0x61,0xE3,0x71,0xA2,0x61,0x82,0x61,0x62,0x59,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x59,0x82,0x61,0x03,0x7A,0x66,0xC3,0xC7,0xE3,0x86,0xDB,0xC4,0xB2,0xA4,0xAA,0xC4,0xAA,0x84,0x9A,0x84,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xB2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0x05,0xBB,0xA4,0xA2,0xA2,0x69,0xE3,0x71,0xE3,0x71,0x04,0x7A,0x44,0x8A,0x24,0x82,0xA2,0x61,0x37,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xEF,0xA7,0x7A,0x83,0x61,0x82,0x61,0x82,0x61,0x87,0x72,0xFF,0xFF,0x09,0x83,0x82,0x61,0x82,0x61,0xFF,0xFF,0x2E,0x9C,0xC3,0x61,0x78,0xD6,0x78,0xD6,0xC3,0x61,0xC3,0x61,0x78,0xD6,0x78,0xD6,0xC3,0x61,0x82,0x61,0x82,0x61,0xF2,0xAC,0xBE,0xF7,0x87,0x72,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x1B,0xE7,0x16,0xCE,0x82,0x61,0xA2,0x61,0xE3,0x71,0xC3,0x69,0x82,0x61,0x62,0x59,0x82,0x61,0x82,0x61,0x62,0x59,0x82,0x59,0xA2,0x61,0x05,0xB3,0xA6,0xDB,0xA6,0xDB,0xA6,0xD3,0xE4,0xB2,0xE4,0xB2,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x63,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xBB,0x05,0xBB,0x25,0xBB,0xA4,0xA2,0xA4,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xC4,0xAA,0x25,0xBB,0x04,0xB3,0x44,0x8A,0xC3,0x69,0xE3,0x71,0x03,0x7A,0x03,0x7A,0x44,0x82,0xE3,0x71,0xB0,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xEF,0xA7,0x7A,0x82,0x61,0x82,0x61,0x82,0x61,0x46,0x6A,0xDE,0xF7,0x4F,0xA4,0x82,0x61,0xC8,0x7A,0xDE,0xF7,0xCD,0x93,0xC3,0x61,0x78,0xD6,0x78,0xD6,0xC3,0x61,0xC3,0x61,0x78,0xD6,0x78,0xD6,0xC3,0x61,0x82,0x61,0xC3,0x61,0xFB,0xE6,0xF7,0xCD,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x1B,0xE7,0x16,0xCE,0x82,0x61,0xA2,0x69,0xE3,0x71,0xC3,0x71,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x23,0x82,0x04,0xBB,0x86,0xD3,0xA6,0xDB,0xA6,0xD3,0x05,0xBB,0xE4,0xB2,0xE5,0xAA,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x63,0x9A,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x86,0xCB,0x25,0xBB,0xC5,0xAA,0x05,0xB3,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xE5,0xB2,0x26,0xBB,0xE4,0xBA,0xC5,0xAA,0x03,0x7A,0xC3,0x71,0xC3,0x71,0xC3,0x69,0x03,0x7A,0xE3,0x71,0x04,0x6A,0x3B,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB9,0xDE,0xE3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x95,0xBD,0x9D,0xEF,0x17,0xCE,0x1B,0xE7,0x1B,0xE7,0x46,0x72,0x82,0x61,0xED,0x93,0xBE,0xF7,0x78,0xD6,0x78,0xD6,0xBE,0xF7,0xED,0x93,0x82,0x61,0x82,0x61,0xCD,0x93,0xDE,0xF7,0x4A,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x1B,0xE7,0x16,0xCE,0x82,0x61,0xC3,0x69,0xA2,0x69,0xC3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x59,0x62,0x59,0xA2,0x69,0xE5,0xB2,0xA4,0xA2,0xC4,0xAA,0x66,0xCB,0x25,0xC3,0x84,0xA2,0x25,0xBB,0xA4,0xAA,0x64,0x9A,0x63,0x9A,0x84,0xA2,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x86,0xCB,0x86,0xCB,0x25,0xC3,0xC4,0xAA,0xC5,0xAA,0x05,0xB3,0xC5,0xAA,0xA4,0xAA,0xC4,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC4,0xAA,0xA4,0xA2,0x64,0x92,0xA2,0x61,0xA2,0x61,0xA3,0x69,0xA3,0x61,0xA2,0x61,0x82,0x61,0xA7,0x7A,0xB9,0xDE,0xBE,0xF7,0xDE,0xF7,0xDE,0xF7,0xDE,0xF7,0xDE,0xFF,0xDE,0xF7,0xDE,0xF7,0xDE,0xF7,
-	0xDE,0xF7,0xDE,0xF7,0xBE,0xF7,0xFA,0xE6,0x09,0x83,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xC3,0x69,0x90,0xA4,0x17,0xCE,0x53,0xBD,0x87,0x72,0x82,0x61,0x82,0x61,0x82,0x61,0x6B,0x8B,0xD5,0xC5,0xD5,0xC5,0x6B,0x8B,0x82,0x61,0x82,0x61,0x82,0x61,0xD1,0xAC,0xD5,0xC5,0x25,0x6A,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,
-	0x62,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x0E,0x9C,0x8B,0x8B,0xA3,0x61,0xA2,0x69,0x62,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0x83,0x9A,0xA4,0xA2,0x64,0x92,0x05,0xB3,0xA6,0xD3,0x04,0xBB,0x83,0xA2,0xE4,0xAA,0x64,0x9A,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x64,0x9A,0x63,0x9A,0x63,0x9A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC7,0xD3,0x86,0xCB,0x86,0xCB,0x46,0xBB,0x25,0xBB,0x45,0xBB,0x05,0xB3,0xC5,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xC5,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x23,0x82,0xA2,0x61,0xA3,0x69,0xA2,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x45,0x6A,0xE8,0x82,0x29,0x8B,0x29,0x8B,0x09,0x83,0x29,0x8B,0x09,0x83,0x09,0x83,0x09,0x83,
-	0x09,0x83,0x09,0x83,0xE8,0x82,0x25,0x6A,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,
-	0x62,0x59,0x82,0x61,0xA2,0x61,0xA2,0x61,0xA3,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x23,0x8A,0xE5,0xB2,0x63,0x9A,0x63,0x9A,0xC4,0xAA,0x25,0xBB,0xE5,0xB2,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x84,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x84,0x9A,0x63,0x9A,0x63,0x9A,
-	0x64,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xBB,
-	0xE7,0xD3,0xA6,0xD3,0x86,0xD3,0x25,0xBB,0xA4,0xA2,0xC4,0xAA,0xC5,0xAA,0xC5,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xAA,0xA4,0xAA,0xC5,0xAA,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x63,0x9A,0xC3,0x71,0xA2,0x61,0x82,0x61,0xA2,0x69,0xA3,0x69,0x82,0x61,0xA2,0x61,0xA3,0x69,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x62,0x59,
-	0x62,0x59,0x82,0x59,0x82,0x61,0xA3,0x61,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0xA3,0x61,0xE3,0x69,0xE4,0x69,0x25,0x6A,0x46,0x6A,0x86,0x92,0x89,0xC3,0x27,0xBB,0x07,0xA3,0xA5,0xAA,0xE5,0xAA,0x05,0xB3,0xE5,0xB2,0xE5,0xB2,0xA4,0xA2,0x83,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x64,0x9A,0x43,0x92,0x43,0x92,0x44,0x9A,0x64,0x9A,
-	0x63,0x92,0x64,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0xCB,0x45,0xC3,0x25,0xBB,
-	0xE7,0xDB,0xC7,0xDB,0x25,0xC3,0xE4,0xAA,0x84,0xA2,0xC4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xAA,0xC5,0xAA,0x84,0xA2,0xE4,0xAA,0x05,0xB3,0xC4,0xAA,0xC4,0xAA,0xA4,0xA2,0x84,0xA2,0x83,0x9A,0xC2,0x71,0x82,0x61,0xA2,0x61,0xA3,0x61,0xA2,0x61,0xC3,0x69,0xC3,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0xA3,0x69,0x82,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0xA2,0x61,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x59,
-	0x82,0x59,0x82,0x59,0x82,0x59,0x82,0x61,0x82,0x59,0xA3,0x61,0x86,0x72,0xC7,0x82,0xE7,0x82,0xE7,0x8A,0xE7,0x92,0xE7,0x92,0x69,0xB3,0xE9,0xDB,0x09,0xEC,0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0xA7,0xD3,0x66,0xD3,0x86,0xD3,0x65,0xDB,0x45,0xC3,0x05,0xBB,0x04,0xBB,0xC4,0xAA,0xC4,0xAA,0x64,0x92,0x43,0x9A,0x43,0x92,0x43,0x9A,0x63,0x9A,
-	0x63,0x9A,0x43,0x9A,0x63,0x9A,0x63,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xAA,0xE5,0xB2,0x25,0xB3,0xA4,0xA2,
-	0x66,0xC3,0x25,0xC3,0xA4,0xA2,0x25,0xB3,0x05,0xB3,0xE5,0xB2,0xA4,0xAA,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x84,0x9A,0x23,0x82,0xE3,0x79,0xE3,0x79,0x44,0x8A,0x24,0x82,0xE2,0x71,0xC3,0x71,0xC2,0x71,0xE3,0x71,0xE2,0x71,0xC2,0x71,0xE2,0x71,0xC2,0x71,
-	0xA2,0x69,0xC2,0x71,0xC2,0x71,0x03,0x7A,0xE3,0x79,0xE2,0x71,0x03,0x7A,0xE3,0x71,0xE3,0x71,0xC2,0x71,0xA2,0x69,0xC2,0x69,0xC2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xC2,0x69,0xA2,0x69,0xC3,0x71,0xE2,0x71,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,
-	0xA2,0x69,0xE3,0x61,0x66,0x6A,0x69,0x8B,0xCB,0x8B,0x0C,0xA4,0x8A,0xA3,0x27,0xA3,0x08,0xA3,0xE6,0xA2,0x28,0xAB,0xEB,0xDB,0x2A,0xEC,0x2A,0xEC,0xE9,0xE3,0xE8,0xE3,0xE8,0xE3,0x66,0xC3,0xA7,0xDB,0xA7,0xDB,0x45,0xD3,0x45,0xE3,0x24,0xD3,0x45,0xDB,0xE4,0xC2,0xC4,0xB2,0xE5,0xB2,0x04,0xC3,0xC4,0xB2,0x84,0xA2,0x63,0x9A,0x63,0x9A,
-	0x64,0x9A,0x63,0x9A,0x84,0xA2,0x05,0xB3,0x25,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC4,0xAA,0x66,0xC3,
-	0x05,0xBB,0xE4,0xAA,0xA4,0xAA,0xE5,0xB2,0xE4,0xB2,0x25,0xBB,0xE4,0xAA,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0xE5,0xB2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0x84,0xA2,0xA4,0xA2,0xC4,0xA2,0x05,0xBB,0x05,0xBB,0xA4,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xE5,0xAA,0x46,0xBB,0xC4,0xAA,0xC5,0xAA,0xC5,0xAA,
-	0xC4,0xAA,0x04,0xB3,0xE4,0xB2,0xE4,0xB2,0x05,0xB3,0x25,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xBB,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0xA2,0x84,0x9A,0xA5,0xA2,0xA4,0xA2,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,
-	0x0D,0x9C,0xD2,0xD5,0x32,0xE6,0xF1,0xED,0x0D,0xED,0xAD,0xEC,0x69,0xE4,0xE8,0xDB,0x0A,0xE4,0xC9,0xE3,0xC9,0xE3,0xC8,0xDB,0xE8,0xE3,0xE8,0xE3,0xC7,0xE3,0xC7,0xE3,0xC7,0xE3,0x86,0xE3,0x66,0xE3,0x85,0xEB,0x04,0xD3,0x03,0xD3,0xE4,0xCA,0xE4,0xBA,0xE4,0xC2,0xC4,0xB2,0xE4,0xB2,0xC4,0xB2,0xC4,0xB2,0xC4,0xB2,0xA4,0xAA,0xC4,0xBA,
-	0x84,0xA2,0x63,0x9A,0xC4,0xAA,0x45,0xC3,0x25,0xC3,0xA4,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xA2,0x84,0xA2,0xC4,0xA2,0x64,0x9A,0xA4,0xA2,0x05,0xB3,
-	0xA4,0xA2,0xC4,0xAA,0x05,0xB3,0x25,0xBB,0xC4,0xAA,0x25,0xB3,0x05,0xB3,0x05,0xB3,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0xC4,0xAA,0xC4,0xAA,0xC4,0xAA,0xA4,0xA2,0xC4,0xA2,0xA4,0xA2,0xE5,0xB2,0x05,0xB3,0xC4,0xAA,0x84,0xA2,0x84,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0xC5,0xAA,0xE4,0xB2,0xE5,0xAA,0xC4,0xAA,
-	0x05,0xBB,0xC4,0xAA,0x05,0xB3,0x45,0xC3,0xE7,0xDB,0x08,0xDC,0x05,0xBB,0xC7,0xD3,0xA6,0xD3,0x84,0xA2,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0xC4,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0x9A,0xA5,0x92,0xEB,0xA3,0x57,0xCE,
-	0x57,0xF7,0xD0,0xED,0x8F,0xE5,0xCC,0xEC,0x6C,0xE4,0x0A,0xE4,0xEA,0xDB,0xC9,0xE3,0xE9,0xE3,0xA7,0xCB,0x66,0xCB,0x66,0xC3,0x45,0xCB,0x65,0xCB,0xA6,0xE3,0xE7,0xEB,0xC6,0xF3,0x86,0xEB,0xC6,0xEB,0xA6,0xF3,0xA6,0xF3,0x44,0xE3,0x03,0xDB,0x44,0xE3,0x03,0xD3,0xC3,0xC2,0xC4,0xB2,0xC3,0xBA,0xA3,0xAA,0xA4,0xAA,0x63,0x9A,0xA4,0xA2,
-	0xC4,0xB2,0xC4,0xB2,0x04,0xBB,0xE4,0xB2,0x05,0xBB,0xA4,0xA2,0x23,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xA2,0xC4,0xAA,0x84,0xA2,0x84,0xA2,0x84,0x9A,0x84,0xA2,0xA4,0xA2,0x64,0x9A,
-	0xA4,0xA2,0xA5,0xAA,0xC4,0xAA,0xA4,0xAA,0xE4,0xAA,0x25,0xB3,0x25,0xBB,0x25,0xBB,0xA4,0xAA,0xA4,0xAA,0x84,0xA2,0xC5,0xAA,0xE5,0xAA,0x25,0xBB,0x05,0xB3,0xE5,0xB2,0xE4,0xB2,0x05,0xBB,0x25,0xBB,0x66,0xCB,0x87,0xCB,0x46,0xC3,0x05,0xB3,0xC4,0xA2,0xA4,0xA2,0x84,0xA2,0x84,0xA2,0x26,0xBB,0x05,0xB3,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,
-	0xE5,0xB2,0x05,0xB3,0x25,0xBB,0x28,0xE4,0x69,0xEC,0x07,0xDC,0x45,0xCB,0xE7,0xDB,0xA6,0xD3,0xE4,0xB2,0xA4,0xA2,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x69,0xA3,0x96,0xDE,0x58,0xEF,0xD4,0xF6,
-	0xD0,0xED,0x0E,0xED,0xCD,0xE4,0x4B,0xE4,0x0B,0xDC,0xC9,0xDB,0xC8,0xDB,0xA8,0xD3,0x66,0xC3,0x25,0xB3,0x05,0xBB,0xE5,0xB2,0xE4,0xBA,0x45,0xDB,0x86,0xEB,0xA6,0xEB,0xA6,0xEB,0xA6,0xEB,0x64,0xEB,0x64,0xF3,0x84,0xF3,0x64,0xF3,0x44,0xEB,0x04,0xD3,0xE3,0xD2,0xE3,0xD2,0xE4,0xCA,0x03,0xD3,0x03,0xCB,0xC3,0xB2,0xA4,0xB2,0xC4,0xB2,
-	0xC4,0xB2,0xC3,0xC2,0xA3,0xBA,0xE4,0xCA,0x05,0xBB,0xC4,0xAA,0x83,0x9A,0x43,0x92,0x43,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xA2,0xC4,0xA2,0xC5,0xAA,0xA4,0xA2,0x84,0x9A,0x84,0xA2,0x84,0xA2,0x84,0xA2,0x84,0x9A,
-	0xC4,0xA2,0xA4,0xAA,0xA4,0xA2,0x63,0x9A,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0xC4,0xAA,0xA4,0xA2,0xA4,0xA2,0xC5,0xAA,0xC4,0xAA,0x25,0xBB,0x46,0xC3,0x05,0xB3,0xC4,0xAA,0xC4,0xB2,0xE5,0xB2,0xC4,0xB2,0x05,0xBB,0xE5,0xBA,0xE4,0xB2,0xE5,0xAA,0xE5,0xAA,0x84,0xA2,0xC5,0xAA,0x25,0xBB,0x05,0xB3,0x84,0xA2,0x05,0xB3,0x66,0xCB,
-	0xC7,0xDB,0x49,0xEC,0xE7,0xE3,0x48,0xEC,0x28,0xEC,0xC7,0xE3,0xA6,0xD3,0x07,0xE4,0xC7,0xDB,0x05,0xB3,0x05,0xB3,0x84,0xA2,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x07,0x9B,0x92,0xCD,0xDC,0xFF,0xF5,0xF6,0xB3,0xF6,0xD0,0xED,
-	0xED,0xDC,0xAD,0xEC,0x0B,0xE4,0x6B,0xE4,0xC8,0xDB,0xA8,0xDB,0x86,0xD3,0x66,0xC3,0x25,0xC3,0x04,0xCB,0xE4,0xC2,0x04,0xCB,0x44,0xE3,0x03,0xDB,0x84,0xF3,0x64,0xEB,0x84,0xEB,0x23,0xE3,0x23,0xE3,0x03,0xDB,0x23,0xE3,0x63,0xEB,0x84,0xEB,0x23,0xE3,0x02,0xDB,0x03,0xDB,0xE2,0xD2,0xE3,0xCA,0x03,0xDB,0x03,0xDB,0xE3,0xC2,0x83,0xAA,
-	0x43,0xAA,0xA3,0xB2,0xC3,0xC2,0xE3,0xD2,0xE3,0xD2,0x24,0xCB,0xC4,0xB2,0x63,0x9A,0x43,0x92,0x23,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xBB,0x05,0xB3,0xE5,0xB2,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,
-	0xC4,0xA2,0x25,0xBB,0xE4,0xAA,0xC4,0xA2,0xE5,0xAA,0x46,0xBB,0xE4,0xB2,0xC4,0xAA,0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xE5,0xB2,0x05,0xBB,0xE5,0xB2,0xA4,0xAA,0xA4,0xA2,0x26,0xBB,0x86,0xCB,0x05,0xB3,0xE4,0xAA,0xE5,0xB2,0x25,0xBB,0xE5,0xAA,0xE5,0xB2,0xC4,0xAA,0x84,0xA2,0x64,0x9A,0x66,0xCB,0x07,0xE4,
-	0x86,0xD3,0xC7,0xDB,0x28,0xEC,0x49,0xEC,0x28,0xEC,0xE7,0xE3,0x28,0xE4,0x28,0xEC,0xC6,0xD3,0xE5,0xAA,0x84,0xA2,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0xCB,0xA3,0x1A,0xE7,0x36,0xF7,0xF5,0xF6,0x31,0xEE,0xD0,0xED,0x0E,0xED,
-	0x8C,0xE4,0x2C,0xE4,0xC9,0xDB,0xA8,0xD3,0x87,0xCB,0xA7,0xD3,0x86,0xD3,0x45,0xD3,0x44,0xDB,0x24,0xE3,0x04,0xE3,0x44,0xEB,0x83,0xEB,0x03,0xDB,0x43,0xE3,0x43,0xEB,0x23,0xE3,0x23,0xE3,0x23,0xE3,0x23,0xDB,0x64,0xEB,0x23,0xE3,0x43,0xE3,0x03,0xDB,0x02,0xDB,0x02,0xDB,0xC2,0xCA,0xC2,0xD2,0xE2,0xD2,0x03,0xDB,0xE3,0xD2,0xA2,0xC2,
-	0x82,0xB2,0xA2,0xC2,0xA2,0xC2,0xC2,0xCA,0xA2,0xC2,0xA2,0xCA,0xE3,0xD2,0x63,0x9A,0x23,0x92,0x43,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xCB,0xC7,0xD3,0x46,0xBB,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0xA2,0x84,0xA2,0xC5,0xAA,0x26,0xBB,
-	0x87,0xCB,0x86,0xCB,0x87,0xCB,0x66,0xCB,0x66,0xC3,0x25,0xBB,0xE4,0xB2,0x84,0xA2,0xA4,0xA2,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC4,0xA2,0x66,0xC3,0x05,0xB3,0xC5,0xAA,0x05,0xB3,0xC7,0xD3,0x07,0xE4,0x86,0xCB,0x45,0xC3,0x05,0xBB,0x86,0xCB,0x65,0xCB,0x45,0xC3,0xC7,0xD3,0xC8,0xCB,0x66,0xC3,0x86,0xCB,0xC7,0xDB,
-	0x65,0xC3,0x66,0xC3,0xE7,0xE3,0x48,0xE4,0x07,0xE4,0x28,0xEC,0x28,0xE4,0x08,0xE4,0x07,0xE4,0x05,0xB3,0x63,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x65,0x92,0x8E,0xBC,0x58,0xEF,0x57,0xF7,0x93,0xEE,0x8F,0xED,0x6F,0xED,0xED,0xDC,0x0B,0xE4,
-	0xEB,0xE3,0xEA,0xDB,0xC8,0xDB,0xC8,0xE3,0xA6,0xDB,0x86,0xDB,0x45,0xE3,0xA6,0xEB,0xA6,0xF3,0x84,0xF3,0x84,0xF3,0x84,0xF3,0x23,0xEB,0x63,0xEB,0x23,0xE3,0x84,0xEB,0x43,0xEB,0x23,0xE3,0xE2,0xD2,0xC3,0xCA,0xC3,0xC2,0x43,0xE3,0x22,0xE3,0x22,0xE3,0x63,0xEB,0x02,0xE3,0x02,0xE3,0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0xE2,0xDA,0xC2,0xD2,
-	0xA2,0xCA,0xC2,0xD2,0xA2,0xC2,0xA2,0xC2,0x63,0xB2,0xA2,0xCA,0xA3,0xCA,0xE3,0xE2,0x43,0xA2,0x23,0x8A,0x23,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xC3,0xC7,0xD3,0xC7,0xDB,0x46,0xC3,0x05,0xB3,0xC4,0xAA,0x84,0xA2,0x64,0x9A,0x64,0x9A,0xA4,0xA2,0x26,0xBB,
-	0x66,0xCB,0x45,0xC3,0x86,0xCB,0x66,0xC3,0x25,0xBB,0x45,0xC3,0xC4,0xB2,0xE4,0xAA,0xE4,0xAA,0xC4,0xAA,0xC4,0xAA,0xC4,0xAA,0x05,0xB3,0xC4,0xAA,0xE5,0xAA,0xA6,0xCB,0x66,0xC3,0xE4,0xB2,0x87,0xCB,0x28,0xE4,0x28,0xE4,0xE8,0xDB,0x86,0xCB,0x46,0xC3,0x86,0xCB,0xC7,0xDB,0x07,0xE4,0xE7,0xE3,0x08,0xE4,0xA6,0xD3,0xE7,0xDB,0x07,0xE4,
-	0x08,0xE4,0x28,0xE4,0x28,0xEC,0xA6,0xDB,0xC6,0xDB,0x28,0xEC,0xC7,0xDB,0xC6,0xDB,0xA6,0xD3,0x83,0xA2,0x63,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0xA5,0x92,0xF5,0xCD,0x79,0xF7,0xD4,0xF6,0xF1,0xED,0x8E,0xDD,0xCD,0xEC,0xAD,0xEC,0xE9,0xDB,0xA7,0xD3,
-	0xA7,0xDB,0xA7,0xDB,0xA7,0xDB,0x86,0xE3,0x86,0xEB,0x85,0xEB,0x84,0xEB,0x07,0xF4,0xE6,0xF3,0xA5,0xF3,0xC6,0xF3,0xA4,0xF3,0x22,0xEB,0x02,0xE3,0x23,0xE3,0x63,0xEB,0xE2,0xDA,0x02,0xDB,0xC2,0xD2,0x42,0xAA,0x43,0xAA,0xA2,0xBA,0xA2,0xCA,0xC2,0xD2,0x22,0xEB,0x02,0xDB,0x03,0xDB,0x63,0xEB,0xE2,0xDA,0x02,0xE3,0xC2,0xD2,0xA2,0xCA,
-	0x62,0xB2,0x62,0xBA,0x82,0xBA,0x42,0xA2,0xA2,0xBA,0x22,0x9A,0x62,0xB2,0x83,0xC2,0xC3,0xD2,0x63,0xB2,0x23,0x8A,0x23,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0xD3,0xE7,0xD3,0x28,0xEC,0x07,0xDC,0x46,0xC3,0xA4,0xA2,0xE5,0xAA,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x84,0xA2,0xE5,0xAA,
-	0xC4,0xAA,0xC4,0xAA,0xA4,0xAA,0x05,0xBB,0x46,0xC3,0x87,0xCB,0x46,0xC3,0x45,0xBB,0x45,0xBB,0x25,0xBB,0xE4,0xAA,0x05,0xBB,0x05,0xB3,0x05,0xB3,0xE4,0xB2,0x66,0xC3,0xC7,0xD3,0xA7,0xCB,0x08,0xDC,0xC7,0xE3,0x07,0xEC,0x28,0xEC,0xE7,0xE3,0xA6,0xD3,0x86,0xCB,0xA7,0xD3,0x28,0xE4,0xC6,0xDB,0xE7,0xE3,0xA7,0xDB,0xE7,0xDB,0x07,0xE4,
-	0x07,0xE4,0xA6,0xDB,0xA6,0xDB,0xC6,0xDB,0xC6,0xD3,0xC6,0xD3,0xC6,0xD3,0x86,0xD3,0xA4,0xAA,0x64,0x92,0x43,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x9A,0x43,0x92,0x64,0x92,0xE6,0x9A,0xD5,0xBD,0xD5,0xF6,0x52,0xEE,0x6F,0xED,0x2E,0xED,0x6C,0xE4,0x4B,0xE4,0xC9,0xDB,0x87,0xC3,0xA7,0xD3,
-	0xC7,0xDB,0xA6,0xDB,0x66,0xEB,0x85,0xEB,0xA5,0xF3,0x84,0xF3,0xA4,0xF3,0x84,0xF3,0x64,0xF3,0xE5,0xF3,0xE6,0xF3,0xA4,0xF3,0x43,0xEB,0x03,0xDB,0xC2,0xCA,0xC2,0xD2,0xA2,0xCA,0xC2,0xD2,0xA2,0xC2,0x42,0xB2,0x42,0xAA,0x62,0xB2,0xA2,0xCA,0x03,0xDB,0x22,0xEB,0x23,0xE3,0x23,0xE3,0x23,0xE3,0x22,0xEB,0x42,0xEB,0xC2,0xDA,0xC2,0xDA,
-	0x82,0xC2,0xA2,0xCA,0x42,0xAA,0x02,0x8A,0x02,0x8A,0x02,0x8A,0x02,0x92,0x83,0xB2,0x63,0xC2,0xA3,0xD2,0x43,0xAA,0x23,0x8A,0x23,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xA2,0x86,0xCB,0x07,0xE4,0x49,0xEC,0x28,0xEC,0xE5,0xBA,0xC4,0xAA,0x84,0xA2,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x83,0x9A,0x84,0x9A,
-	0xC5,0xAA,0xA4,0xAA,0x05,0xB3,0x05,0xBB,0x25,0xC3,0x86,0xCB,0x07,0xE4,0x46,0xC3,0xA4,0xAA,0xC4,0xAA,0xE4,0xB2,0x66,0xC3,0x86,0xCB,0xA6,0xCB,0x86,0xCB,0x66,0xC3,0xE8,0xDB,0x28,0xE4,0x28,0xEC,0x08,0xE4,0x07,0xDC,0xE7,0xDB,0xC7,0xDB,0xA6,0xD3,0x86,0xD3,0x07,0xE4,0x08,0xE4,0xC6,0xD3,0xC6,0xD3,0x66,0xC3,0x86,0xD3,0x07,0xE4,
-	0x07,0xE4,0x46,0xC3,0x66,0xCB,0x65,0xCB,0x45,0xC3,0x66,0xCB,0x66,0xCB,0xA4,0xAA,0x63,0x92,0x64,0x92,0x43,0x92,0x63,0x92,0x64,0x9A,0x64,0x9A,0x64,0x92,0x63,0x9A,0x64,0x92,0x64,0x9A,0x64,0x9A,0x63,0x92,0xC6,0x92,0x75,0xDE,0xF5,0xF6,0xF1,0xED,0x6F,0xED,0xCC,0xF4,0x2A,0xE4,0xC9,0xE3,0xA7,0xDB,0xA7,0xD3,0xA8,0xDB,0x08,0xEC,
-	0x29,0xF4,0xC7,0xEB,0xE7,0xEB,0x07,0xF4,0xA5,0xF3,0x84,0xF3,0xE5,0xF3,0xC6,0xF3,0xE7,0xF3,0x08,0xF4,0xA5,0xF3,0xA4,0xF3,0x02,0xDB,0xC2,0xD2,0xA2,0xBA,0x82,0xBA,0xA2,0xCA,0x62,0xB2,0x82,0xC2,0xA2,0xCA,0xA2,0xC2,0x82,0xC2,0x03,0xDB,0x22,0xE3,0x22,0xEB,0x23,0xE3,0x23,0xE3,0x02,0xE3,0xE2,0xDA,0xC2,0xDA,0xA2,0xCA,0x82,0xC2,
-	0x83,0xBA,0x83,0xCA,0x02,0x9A,0xE2,0x81,0xE2,0x81,0xC2,0x71,0xC2,0x61,0xE2,0x79,0x23,0xAA,0xC3,0xCA,0x83,0xBA,0x43,0xA2,0x23,0x8A,0x23,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xB2,0x86,0xCB,0x08,0xE4,0x48,0xE4,0xA6,0xD3,0x46,0xBB,0xE5,0xAA,0xC4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,
-	0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x46,0xBB,0xC7,0xD3,0x28,0xEC,0x07,0xDC,0xE5,0xB2,0xE5,0xAA,0x25,0xBB,0x66,0xC3,0x45,0xC3,0x45,0xC3,0x86,0xCB,0xE7,0xDB,0x07,0xE4,0x08,0xE4,0x28,0xE4,0x49,0xEC,0x08,0xE4,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0xE7,0xDB,0xC6,0xD3,0xC7,0xD3,0x66,0xCB,0x66,0xCB,0x65,0xCB,0xC7,0xD3,0xC7,0xDB,
-	0x86,0xD3,0xC6,0xD3,0x66,0xC3,0xE4,0xBA,0xE5,0xAA,0xE4,0xB2,0x83,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x84,0x9A,0x06,0xA3,0xD4,0xBD,0xF5,0xF6,0x8F,0xED,0x6F,0xED,0x8B,0xF4,0xE9,0xE3,0xC8,0xE3,0xA7,0xDB,0xC8,0xDB,0x09,0xEC,0x29,0xF4,0x29,0xF4,
-	0x29,0xF4,0x8A,0xFC,0x29,0xF4,0x28,0xF4,0x07,0xF4,0xC6,0xF3,0xA6,0xF3,0xE7,0xF3,0xE7,0xF3,0xC4,0xF3,0xA4,0xF3,0x83,0xF3,0x63,0xF3,0x42,0xF3,0xC2,0xD2,0xA2,0xCA,0x62,0xBA,0x22,0xA2,0x42,0xB2,0xE2,0xDA,0x43,0xE3,0xE2,0xDA,0x02,0xDB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x02,0xE3,0x02,0xE3,0xC2,0xDA,0xA2,0xD2,0x82,0xCA,0x82,0xC2,
-	0x82,0xC2,0x63,0xBA,0x02,0x8A,0xE2,0x81,0xC2,0x79,0xC2,0x69,0xC2,0x69,0xA2,0x61,0xC2,0x69,0x63,0xB2,0xA3,0xD2,0x82,0xBA,0x23,0x92,0x23,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xC3,0x05,0xB3,0x87,0xC3,0x08,0xE4,0xE7,0xDB,0xE7,0xDB,0x46,0xC3,0x25,0xB3,0x46,0xBB,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x92,0x84,0x9A,
-	0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0xA2,0x45,0xBB,0x66,0xCB,0x07,0xDC,0x49,0xEC,0x08,0xDC,0xC7,0xD3,0x45,0xC3,0x66,0xC3,0x66,0xC3,0x05,0xBB,0x86,0xC3,0x86,0xCB,0xA6,0xD3,0x86,0xCB,0xC6,0xDB,0x48,0xE4,0x08,0xE4,0xE7,0xDB,0xC6,0xD3,0xC6,0xD3,0xE7,0xD3,0xA6,0xD3,0xE7,0xD3,0x86,0xCB,0x66,0xCB,0xE7,0xD3,0xE7,0xDB,0xC7,0xDB,
-	0x25,0xC3,0x87,0xCB,0xE4,0xB2,0xC4,0xAA,0x46,0xBB,0x64,0x92,0x43,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x63,0x92,0x84,0x92,0x13,0xD6,0xB4,0xF6,0xF1,0xED,0xCD,0xEC,0x4B,0xEC,0xC9,0xE3,0xA7,0xDB,0xA7,0xDB,0xA8,0xDB,0x2A,0xF4,0xA7,0xE3,0xC7,0xE3,0x07,0xF4,
-	0x28,0xF4,0x8A,0xFC,0x07,0xF4,0x07,0xF4,0x29,0xF4,0x07,0xF4,0xE7,0xF3,0xE7,0xEB,0x07,0xF4,0x65,0xEB,0xA4,0xF3,0xC4,0xF3,0x43,0xEB,0x02,0xDB,0xC1,0xD2,0xA1,0xCA,0x62,0xB2,0x22,0xA2,0x23,0x92,0x82,0xBA,0xC3,0xCA,0xA2,0xCA,0xC2,0xDA,0x22,0xE3,0x64,0xF3,0x83,0xEB,0x22,0xEB,0x22,0xEB,0xE2,0xE2,0x82,0xCA,0x62,0xBA,0x82,0xD2,
-	0x82,0xCA,0xA2,0xD2,0x02,0x92,0xE2,0x81,0xC2,0x79,0xC2,0x71,0xC2,0x69,0xC2,0x61,0xC2,0x69,0x42,0xA2,0xA2,0xCA,0xC3,0xDA,0xA3,0xC2,0x43,0x92,0x03,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xD3,0x86,0xCB,0x45,0xBB,0xC7,0xD3,0xE7,0xDB,0xA6,0xD3,0x07,0xE4,0x86,0xCB,0x25,0xBB,0x86,0xCB,0xC5,0xAA,0xC4,0xA2,0xE5,0xAA,0xC5,0xAA,0x64,0x9A,
-	0x84,0x9A,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,0x25,0xBB,0x66,0xCB,0x86,0xD3,0xC7,0xD3,0x69,0xEC,0x28,0xEC,0x07,0xE4,0xC6,0xD3,0x87,0xCB,0xC7,0xD3,0xA7,0xD3,0xE7,0xDB,0x07,0xE4,0x08,0xE4,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xA6,0xD3,0xA6,0xD3,0xC6,0xD3,0xC7,0xD3,0xA6,0xD3,0x86,0xD3,0x86,0xCB,0x08,0xDC,0x08,0xDC,0xA6,0xD3,0x66,0xCB,
-	0x46,0xC3,0x87,0xCB,0x45,0xC3,0x05,0xBB,0xE4,0xAA,0x64,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x43,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0xAD,0xBC,0xF5,0xF6,0x11,0xEE,0xCD,0xE4,0x4C,0xE4,0xC9,0xE3,0xA8,0xDB,0xA8,0xDB,0xE9,0xE3,0x2A,0xEC,0x09,0xF4,0x04,0xC3,0xC6,0xEB,0xC6,0xEB,
-	0xE7,0xEB,0xA6,0xEB,0xE6,0xF3,0xE6,0xF3,0xE6,0xF3,0xE6,0xF3,0x07,0xF4,0xE7,0xF3,0x28,0xF4,0xE6,0xF3,0x23,0xDB,0x62,0xB2,0x43,0xAA,0x62,0xB2,0x62,0xBA,0x42,0xAA,0x43,0xAA,0x22,0x9A,0x02,0x8A,0xE2,0x79,0xE3,0x81,0x02,0x9A,0x62,0xBA,0xC2,0xD2,0x43,0xEB,0x63,0xEB,0x22,0xEB,0x02,0xE3,0xE2,0xDA,0xE2,0xE2,0x81,0xCA,0xC2,0xDA,
-	0xA2,0xDA,0xE2,0xE2,0xC2,0xD2,0x22,0x9A,0xE2,0x81,0xC2,0x71,0xC2,0x69,0xC2,0x71,0xC2,0x69,0x22,0x9A,0xA3,0xCA,0xC2,0xCA,0xE2,0xDA,0xE3,0xDA,0x43,0x92,0x03,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xC7,0xD3,0xC6,0xD3,0xA6,0xCB,0x66,0xCB,0xC7,0xD3,0x28,0xE4,0xE7,0xD3,0x66,0xCB,0xE5,0xB2,0xC4,0xAA,0x05,0xB3,0x05,0xBB,0x64,0x9A,
-	0x84,0x9A,0xE5,0xAA,0x25,0xBB,0x46,0xBB,0x25,0xC3,0x45,0xC3,0x05,0xBB,0x66,0xCB,0xC7,0xD3,0x28,0xE4,0x28,0xE4,0x28,0xE4,0x07,0xE4,0xE7,0xDB,0xE7,0xDB,0x07,0xDC,0x07,0xDC,0x08,0xE4,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0xA6,0xD3,0x87,0xCB,0x86,0xCB,0xC7,0xD3,0xE7,0xD3,0xA6,0xD3,0x65,0xCB,0xC6,0xD3,0x07,0xE4,0x86,0xCB,0x86,0xCB,
-	0xA6,0xD3,0xC6,0xD3,0x86,0xCB,0x66,0xC3,0x84,0xA2,0x84,0x9A,0x23,0x8A,0x43,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x0C,0xAC,0x93,0xEE,0xF1,0xED,0xAD,0xEC,0x8D,0xE4,0x0C,0xE4,0xC9,0xE3,0xEA,0xE3,0xC9,0xE3,0x2A,0xF4,0xE8,0xE3,0xA6,0xF3,0xA6,0xEB,0x04,0xDB,0x03,0xDB,
-	0x23,0xE3,0x03,0xDB,0x44,0xE3,0xA6,0xEB,0x84,0xF3,0xC6,0xF3,0x85,0xEB,0xE6,0xEB,0xE6,0xF3,0xA4,0xF3,0x62,0xBA,0x62,0xB2,0x62,0xB2,0x42,0xB2,0x22,0xAA,0x22,0x9A,0x22,0xA2,0x42,0xAA,0x23,0x92,0xE2,0x81,0xC3,0x79,0xC2,0x71,0xE2,0x89,0x62,0xC2,0xA2,0xD2,0xA2,0xD2,0xA2,0xD2,0x62,0xBA,0x42,0xB2,0x22,0xE3,0xC1,0xDA,0x02,0xE3,
-	0x22,0xEB,0x63,0xEB,0x64,0xEB,0xC2,0xDA,0x42,0xA2,0xC2,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xE2,0x81,0xC2,0xD2,0xC2,0xDA,0xC2,0xD2,0x03,0xE3,0xE3,0xDA,0x43,0x9A,0x23,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xC3,0xE7,0xDB,0xC6,0xD3,0x08,0xE4,0xE7,0xDB,0x86,0xCB,0x46,0xC3,0x87,0xCB,0x87,0xCB,0xA6,0xCB,0x08,0xDC,0xA6,0xD3,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0xE4,0xAA,0x84,0x9A,
-	0x83,0x9A,0x05,0xB3,0x86,0xCB,0x45,0xBB,0x25,0xBB,0x86,0xCB,0x86,0xC3,0x66,0xBB,0x65,0xC3,0xE7,0xD3,0x49,0xE4,0x08,0xDC,0xE7,0xDB,0x08,0xDC,0xC6,0xD3,0xC6,0xD3,0x08,0xDC,0xE7,0xDB,0x66,0xCB,0x66,0xCB,0xC7,0xD3,0xA6,0xD3,0xA6,0xD3,0xA7,0xD3,0x86,0xD3,0xE7,0xE3,0x28,0xE4,0xC6,0xDB,0xA6,0xD3,0xE7,0xDB,0xC6,0xD3,0x65,0xCB,
-	0xC6,0xDB,0xE7,0xDB,0x66,0xC3,0x04,0xBB,0x84,0xA2,0x05,0xB3,0x84,0xA2,0x43,0x8A,0x43,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0xE6,0x92,0x12,0xDE,0xB0,0xED,0x6F,0xED,0x4C,0xE4,0xEB,0xDB,0x2C,0xE4,0x0C,0xE4,0x09,0xE4,0x09,0xE4,0x46,0xD3,0x25,0xDB,0x86,0xE3,0x44,0xE3,0x45,0xE3,0x03,0xDB,
-	0xE3,0xD2,0x03,0xDB,0x03,0xDB,0x22,0xE3,0x42,0xEB,0x42,0xE3,0x63,0xEB,0xC6,0xEB,0x26,0xF4,0x85,0xE3,0x42,0xB2,0x62,0xBA,0x22,0xAA,0x43,0xAA,0x22,0x9A,0x22,0x92,0x23,0x92,0x22,0xA2,0x22,0x9A,0xE2,0x81,0x03,0x82,0xE2,0x79,0xC2,0x79,0x23,0x9A,0x82,0xC2,0x82,0xD2,0xA2,0xD2,0x82,0xC2,0x42,0xAA,0x62,0xB2,0x22,0xA2,0x82,0xCA,
-	0xE2,0xDA,0x23,0xE3,0x64,0xEB,0x43,0xE3,0xE2,0xD2,0x42,0xA2,0x02,0x8A,0xE2,0x79,0xE2,0x81,0x22,0xA2,0xA2,0xD2,0xC2,0xDA,0x63,0xBA,0xA2,0xCA,0x23,0xE3,0x03,0xDB,0x23,0x8A,0x64,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xC3,0x86,0xCB,0xC7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0x86,0xCB,0x05,0xB3,0xE5,0xB2,0x05,0xB3,0x66,0xC3,0xE7,0xDB,0x86,0xCB,0xC5,0xAA,0xA4,0xAA,0xC4,0xAA,0xA4,0xA2,0x84,0xA2,
-	0xA4,0xA2,0x66,0xC3,0x46,0xC3,0x86,0xCB,0xA6,0xCB,0x86,0xCB,0x08,0xDC,0xE7,0xD3,0xE7,0xD3,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xC7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0x86,0xCB,0x86,0xCB,0x66,0xCB,0x86,0xD3,0xA6,0xD3,0xA6,0xD3,0xC6,0xD3,0xA7,0xDB,0x07,0xDC,0xE7,0xDB,0x86,0xD3,0xC7,0xD3,0xC6,0xD3,0x45,0xCB,
-	0xE7,0xDB,0xC6,0xD3,0x26,0xBB,0xE5,0xB2,0x84,0x9A,0xC5,0xAA,0xE4,0xB2,0x44,0x8A,0x43,0x8A,0x43,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x43,0x92,0x64,0x92,0x84,0x92,0xEF,0xC4,0xB0,0xED,0x6F,0xED,0x2B,0xE4,0xC9,0xD3,0xEB,0xDB,0x8C,0xE4,0x2B,0xE4,0x09,0xEC,0xC7,0xE3,0x85,0xE3,0xE3,0xD2,0x44,0xE3,0x03,0xDB,0xE3,0xD2,0xC3,0xCA,
-	0xC2,0xD2,0xE2,0xDA,0x22,0xEB,0x42,0xEB,0x42,0xEB,0xE2,0xDA,0x23,0xE3,0x22,0xE3,0x65,0xE3,0xA6,0xE3,0x62,0xBA,0x22,0x9A,0x02,0x92,0x43,0xAA,0x22,0xA2,0x22,0xA2,0x23,0x92,0x22,0xA2,0x22,0x9A,0x02,0x8A,0x02,0x8A,0x02,0x8A,0xE2,0x79,0xE2,0x79,0x22,0x92,0xA2,0xC2,0xA2,0xD2,0x42,0xB2,0x22,0x9A,0x02,0x8A,0xE2,0x79,0x82,0xC2,
-	0xA1,0xD2,0xA2,0xDA,0xA2,0xDA,0x43,0xEB,0x83,0xF3,0x43,0xEB,0xC2,0xD2,0xA2,0xC2,0x82,0xBA,0xE3,0xD2,0xE2,0xD2,0x82,0xC2,0xA3,0xC2,0x62,0xB2,0x03,0xDB,0x64,0xF3,0xE3,0xCA,0x63,0x9A,0x64,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xB3,0xA7,0xCB,0xE7,0xDB,0xC7,0xD3,0xC6,0xD3,0xA6,0xD3,0x66,0xC3,0xC4,0xAA,0x64,0x9A,0xA4,0x9A,0xC4,0xAA,0xE4,0xB2,0x05,0xB3,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0x84,0x9A,0xE5,0xAA,
-	0xE5,0xAA,0x86,0xCB,0x86,0xCB,0x25,0xBB,0xE5,0xBA,0x45,0xBB,0xE7,0xDB,0x07,0xDC,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xC7,0xDB,0xE7,0xDB,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xA6,0xCB,0x87,0xCB,0xA6,0xD3,0xA6,0xD3,0xA6,0xD3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xD3,0xA6,0xD3,
-	0xC7,0xDB,0x86,0xD3,0x45,0xC3,0xE4,0xB2,0x46,0xBB,0x84,0x9A,0xC4,0xA2,0x84,0x9A,0x23,0x8A,0x43,0x8A,0x84,0x9A,0x43,0x92,0x23,0x8A,0x43,0x8A,0x23,0x8A,0x69,0xA3,0x52,0xEE,0x6F,0xED,0x4C,0xE4,0xAA,0xC3,0x0C,0xE4,0x6C,0xE4,0x0B,0xE4,0x2A,0xEC,0xE8,0xEB,0x45,0xE3,0xE3,0xD2,0x03,0xDB,0xE3,0xD2,0xE3,0xD2,0xE3,0xD2,0xC2,0xD2,
-	0xC2,0xD2,0xE2,0xDA,0x42,0xF3,0x42,0xEB,0x02,0xE3,0x02,0xE3,0xE2,0xDA,0xA2,0xDA,0xE2,0xDA,0x24,0xDB,0x82,0xBA,0x62,0xB2,0x22,0xA2,0x22,0xA2,0x22,0x92,0x22,0xAA,0x22,0xA2,0x22,0xAA,0x22,0xA2,0x02,0x8A,0xE2,0x81,0x02,0x8A,0x02,0x8A,0xE2,0x81,0xE2,0x81,0x83,0xBA,0x82,0xCA,0x82,0xBA,0x22,0x9A,0x02,0x92,0xC2,0x79,0xC2,0x71,
-	0x62,0xBA,0xC2,0xDA,0xC2,0xD2,0xC2,0xDA,0xC2,0xDA,0x43,0xEB,0x23,0xEB,0x04,0xE3,0xC3,0xDA,0xC2,0xDA,0xE2,0xDA,0x03,0xDB,0xC3,0xD2,0xA2,0xBA,0x03,0xDB,0x43,0xEB,0x23,0xDB,0x84,0xA2,0xA4,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xAA,0xC4,0xAA,0xC7,0xD3,0xE7,0xD3,0xA6,0xD3,0xC7,0xD3,0xC7,0xD3,0x25,0xBB,0x63,0x9A,0xA4,0xA2,0x84,0x9A,0x43,0x8A,0x64,0x92,0xE4,0xAA,0x63,0x92,0x84,0x9A,0xC4,0xA2,0xC5,0xAA,0x66,0xC3,
-	0x25,0xBB,0x25,0xBB,0xC7,0xD3,0xA6,0xCB,0x86,0xCB,0x86,0xCB,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xC7,0xDB,0xE7,0xDB,0xE7,0xDB,0xA6,0xD3,0xA6,0xD3,0x66,0xCB,0xA7,0xCB,0x45,0xC3,0x66,0xC3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0x08,0xDC,0x08,0xDC,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,
-	0xC7,0xDB,0xC7,0xD3,0xA6,0xD3,0x05,0xB3,0xE4,0xB2,0x83,0x9A,0x64,0x9A,0xE4,0xAA,0xA4,0xA2,0x84,0x9A,0x23,0x92,0x83,0xA2,0xA4,0xA2,0x43,0x92,0xC5,0x9A,0x4E,0xDD,0x6F,0xED,0x4C,0xE4,0x0C,0xE4,0x0C,0xE4,0x8C,0xE4,0x8C,0xE4,0x29,0xEC,0x29,0xF4,0x65,0xDB,0xC4,0xB2,0xE4,0xC2,0xE3,0xD2,0xC3,0xCA,0xE3,0xD2,0xC2,0xD2,0xC2,0xCA,
-	0xE2,0xDA,0x02,0xE3,0x02,0xE3,0x22,0xEB,0x22,0xEB,0xA4,0xF3,0x22,0xE3,0xC2,0xDA,0xC2,0xDA,0xA2,0xCA,0x82,0xBA,0x82,0xC2,0x62,0xBA,0x22,0xA2,0x22,0x9A,0x22,0x9A,0x22,0xA2,0x22,0xAA,0x22,0xA2,0x02,0x8A,0xE2,0x81,0x02,0x8A,0x03,0x8A,0xE3,0x79,0xE2,0x81,0x02,0x92,0x22,0x9A,0x22,0x9A,0x22,0xAA,0x02,0x8A,0xE2,0x81,0xC2,0x69,
-	0xC2,0x69,0x02,0x8A,0xE2,0x81,0x02,0x92,0x82,0xC2,0x23,0xE3,0x23,0xEB,0x23,0xE3,0x24,0xEB,0x23,0xEB,0x23,0xEB,0x03,0xE3,0x23,0xE3,0xE3,0xD2,0xE3,0xDA,0xC3,0xD2,0x03,0xDB,0xC3,0xCA,0x64,0x9A,0x43,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xBB,0xE5,0xAA,0xC7,0xD3,0xE7,0xD3,0xA7,0xD3,0xA7,0xD3,0xE7,0xDB,0x46,0xC3,0x83,0xA2,0x84,0xA2,0x05,0xB3,0x43,0x8A,0x64,0x92,0xA4,0xA2,0x84,0xA2,0xE5,0xAA,0xC4,0xAA,0xC5,0xAA,0xC4,0xB2,
-	0x66,0xC3,0x46,0xC3,0xE7,0xDB,0xE7,0xDB,0xC6,0xD3,0xC6,0xD3,0xE7,0xDB,0xE7,0xDB,0x28,0xE4,0xC7,0xD3,0xE7,0xDB,0xC6,0xD3,0xC6,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xD3,0x86,0xCB,0x45,0xC3,0x25,0xBB,0x66,0xCB,0x45,0xC3,0x45,0xC3,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0x08,0xDC,0xC6,0xDB,0xC6,0xDB,0xE7,0xDB,0x08,0xDC,
-	0xC6,0xDB,0xC6,0xDB,0xC7,0xD3,0x65,0xC3,0x86,0xCB,0x45,0xBB,0x83,0x9A,0x64,0x9A,0xE4,0xB2,0x25,0xBB,0x84,0x9A,0x05,0xB3,0x66,0xC3,0x63,0x9A,0x48,0xAB,0x8F,0xE5,0x6C,0xE4,0xA9,0xCB,0x0C,0xE4,0x8C,0xE4,0xAD,0xEC,0x2A,0xE4,0x86,0xE3,0x45,0xE3,0xE4,0xBA,0xA4,0xAA,0xA4,0xAA,0xA3,0xB2,0xC3,0xCA,0xC2,0xCA,0xE2,0xDA,0xC2,0xD2,
-	0xA2,0xCA,0xE2,0xDA,0x23,0xDB,0x02,0xE3,0x02,0xE3,0x22,0xEB,0x62,0xF3,0x63,0xEB,0xC2,0xDA,0xA2,0xCA,0x82,0xBA,0x42,0xAA,0x22,0xAA,0x22,0x9A,0x02,0x9A,0x22,0x9A,0x22,0x9A,0x23,0xAA,0x62,0xB2,0x22,0x9A,0x23,0x92,0x03,0x8A,0x02,0x92,0x02,0x82,0x02,0x8A,0xE2,0x81,0xC2,0x79,0xC2,0x79,0xE2,0x79,0xE2,0x79,0xC2,0x79,0xC2,0x71,
-	0xC2,0x69,0xE2,0x79,0xE2,0x81,0x62,0xBA,0x82,0xC2,0x42,0xAA,0x42,0xB2,0xA2,0xC2,0xC2,0xD2,0x03,0xE3,0x03,0xE3,0x03,0xE3,0xC2,0xD2,0xC3,0xCA,0x82,0xBA,0x03,0xE3,0x03,0xE3,0x03,0xDB,0x43,0x9A,0x23,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xCB,0x25,0xBB,0x05,0xB3,0xA6,0xCB,0xE7,0xDB,0xA7,0xD3,0x45,0xC3,0x86,0xCB,0x66,0xCB,0x05,0xB3,0x05,0xB3,0x46,0xC3,0xA4,0xA2,0xA5,0xA2,0x84,0x9A,0x64,0x9A,0xC4,0xA2,0x43,0x92,0x84,0x9A,0x46,0xBB,
-	0x86,0xCB,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xA6,0xD3,0xC7,0xD3,0xE7,0xD3,0x08,0xDC,0xE7,0xDB,0xE7,0xD3,0x66,0xC3,0x86,0xCB,0xE7,0xDB,0xA7,0xD3,0xA6,0xCB,0x87,0xCB,0x25,0xBB,0xC4,0xAA,0x04,0xB3,0x46,0xBB,0x86,0xCB,0xC7,0xD3,0xA6,0xD3,0xC6,0xD3,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xA6,0xD3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,
-	0xC6,0xD3,0xC6,0xD3,0xC6,0xD3,0xC6,0xD3,0x08,0xDC,0xC7,0xD3,0x25,0xBB,0x66,0xC3,0x66,0xC3,0x05,0xB3,0xE4,0xAA,0x83,0xA2,0xE5,0xAA,0xA4,0xA2,0x8C,0xDC,0xCD,0xE4,0xAA,0xBB,0x88,0xC3,0x0C,0xE4,0x8C,0xE4,0x6B,0xEC,0x66,0xDB,0x65,0xE3,0x24,0xD3,0xA4,0xAA,0xA4,0xAA,0xA3,0xB2,0xA3,0xB2,0xA3,0xBA,0xE2,0xD2,0xE2,0xDA,0xC2,0xD2,
-	0x82,0xC2,0x82,0xBA,0xA2,0xCA,0xC2,0xD2,0xE2,0xDA,0x42,0xEB,0x63,0xF3,0x83,0xEB,0x23,0xE3,0x64,0xE3,0x03,0xD3,0x42,0xB2,0x22,0xA2,0x02,0x92,0x02,0x8A,0x22,0x9A,0x22,0x9A,0x22,0xA2,0x62,0xBA,0x22,0xAA,0x22,0x9A,0x23,0x92,0xE2,0x81,0xE2,0x79,0xE2,0x89,0xE2,0x81,0xE2,0x81,0xE2,0x81,0x02,0x82,0xC2,0x71,0xC2,0x71,0xC2,0x69,
-	0xC2,0x71,0x03,0x82,0xE2,0x81,0x82,0xC2,0x82,0xBA,0x62,0xBA,0x82,0xCA,0x43,0xB2,0x23,0x92,0x23,0x9A,0x63,0xAA,0x63,0xB2,0x42,0xA2,0x82,0xC2,0x63,0xAA,0xA3,0xCA,0xE3,0xDA,0x04,0xE3,0xA3,0xC2,0x03,0x8A,0x03,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xBB,0x45,0xBB,0xA7,0xCB,0xA7,0xD3,0x08,0xDC,0x46,0xC3,0xC4,0xAA,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x86,0xCB,0x86,0xCB,0x25,0xBB,0xC4,0xA2,0x64,0x9A,0xA4,0xA2,0xC4,0xAA,0x84,0x9A,0x83,0x9A,0x46,0xBB,
-	0x87,0xCB,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0xE7,0xD3,0xC7,0xD3,0xE7,0xD3,0x08,0xDC,0xE7,0xD3,0x86,0xCB,0xA7,0xD3,0xA7,0xD3,0x86,0xCB,0x66,0xC3,0x25,0xBB,0xC4,0xAA,0xA4,0xA2,0xE4,0xB2,0x46,0xC3,0x66,0xC3,0x66,0xC3,0x86,0xCB,0x86,0xCB,0x86,0xCB,0xA7,0xD3,0x66,0xCB,0xA6,0xD3,0xC7,0xD3,0x86,0xD3,
-	0x86,0xD3,0xA6,0xD3,0xE7,0xDB,0xE7,0xDB,0xE7,0xDB,0xC7,0xD3,0x86,0xCB,0x86,0xCB,0xA6,0xD3,0x45,0xC3,0x05,0xBB,0xA4,0xA2,0xC5,0xAA,0x88,0xBB,0x0C,0xE4,0x0B,0xDC,0x69,0xB3,0xA9,0xD3,0x4C,0xE4,0xAD,0xEC,0xE8,0xEB,0x24,0xDB,0x04,0xDB,0xE4,0xC2,0xC3,0xB2,0xA3,0xB2,0xA3,0xB2,0x83,0xB2,0xC3,0xBA,0xC2,0xCA,0xC1,0xD2,0xC1,0xD2,
-	0xA1,0xCA,0x82,0xC2,0x82,0xC2,0xE2,0xDA,0x22,0xEB,0x42,0xEB,0x63,0xEB,0x63,0xEB,0x23,0xE3,0x85,0xE3,0x03,0xDB,0xA2,0xC2,0x22,0x9A,0x22,0x9A,0x02,0x92,0x02,0x9A,0x22,0x9A,0x22,0x9A,0x43,0xB2,0x22,0xAA,0x22,0xA2,0x22,0x9A,0x22,0x92,0x62,0xBA,0x02,0x82,0xE2,0x79,0x02,0x82,0x02,0x9A,0x03,0x8A,0xE3,0x79,0xE2,0x79,0xE3,0x79,
-	0xC2,0x71,0xE3,0x71,0xE2,0x81,0x22,0xAA,0x22,0x9A,0x82,0xCA,0xC2,0xCA,0x43,0xAA,0x03,0x8A,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x23,0x92,0x43,0xBA,0x83,0xC2,0xC3,0xD2,0xE3,0xDA,0x03,0xE3,0x03,0xE3,0x43,0x9A,0x03,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xBB,0xA4,0xA2,0x86,0xCB,0x08,0xDC,0xE7,0xD3,0xC7,0xD3,0xC4,0xAA,0x64,0x9A,0xA4,0xA2,0x66,0xCB,0xA6,0xCB,0x26,0xBB,0xE5,0xAA,0xC4,0xAA,0x64,0x92,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0xC5,0xAA,0x05,0xB3,
-	0x87,0xCB,0xA7,0xCB,0xA6,0xD3,0xA6,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xC7,0xD3,0xE7,0xD3,0x86,0xCB,0x86,0xCB,0x87,0xCB,0x25,0xC3,0xE5,0xB2,0xC5,0xAA,0xA4,0xAA,0xA4,0xA2,0x64,0x9A,0xE5,0xAA,0xC4,0xAA,0xE5,0xAA,0x45,0xC3,0x25,0xBB,0x46,0xBB,0xA7,0xCB,0x86,0xCB,0x65,0xCB,0xC7,0xD3,0xA6,0xD3,
-	0xA7,0xD3,0xA6,0xD3,0xC7,0xD3,0xE7,0xDB,0x66,0xC3,0x45,0xC3,0xA7,0xCB,0x65,0xCB,0xC7,0xD3,0x05,0xBB,0x46,0xC3,0x46,0xC3,0x46,0xB3,0x0B,0xDC,0x0B,0xE4,0xEB,0xD3,0xC9,0xCB,0x6C,0xE4,0x8C,0xEC,0xAB,0xF4,0x08,0xF4,0x04,0xDB,0xC4,0xB2,0xA4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA3,0xB2,0xA3,0xBA,0x82,0xC2,0xC2,0xCA,0x82,0xC2,0xA2,0xCA,
-	0x81,0xCA,0x82,0xCA,0xA2,0xD2,0x22,0xEB,0x22,0xEB,0xE2,0xE2,0xE2,0xE2,0x82,0xCA,0x62,0xBA,0x64,0xEB,0xC6,0xEB,0xC2,0xDA,0x42,0xAA,0x02,0x8A,0x02,0x92,0x22,0xAA,0x22,0x92,0x22,0x9A,0x22,0xA2,0x22,0xAA,0x82,0xBA,0xC1,0xD2,0x62,0xAA,0x02,0x8A,0x02,0x82,0x03,0x82,0x23,0x92,0x22,0xA2,0x02,0x8A,0xE2,0x81,0x02,0x82,0xE2,0x79,
-	0xE3,0x79,0xE3,0x81,0xE2,0x81,0x02,0x92,0x23,0x92,0x63,0xBA,0x62,0xB2,0x43,0xAA,0x23,0x8A,0x03,0x8A,0xE3,0x81,0xE3,0x79,0x03,0x8A,0x23,0x9A,0x63,0xBA,0x03,0xE3,0xC3,0xDA,0xC3,0xDA,0x03,0xE3,0xA3,0xBA,0x03,0x82,0xE2,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xB3,0x46,0xBB,0xA6,0xCB,0xA6,0xD3,0xC7,0xD3,0xC6,0xD3,0xE4,0xB2,0x64,0x92,0xA4,0xA2,0x05,0xB3,0x46,0xBB,0x25,0xB3,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xE4,0xAA,0x83,0xA2,0x43,0x92,0x43,0x92,0xA4,0xA2,0x05,0xB3,
-	0x46,0xC3,0x66,0xC3,0x66,0xCB,0x66,0xCB,0xC7,0xD3,0xC7,0xD3,0xA6,0xD3,0xC7,0xD3,0xA6,0xD3,0xC7,0xD3,0xC7,0xD3,0xA7,0xD3,0x87,0xCB,0x66,0xC3,0x46,0xC3,0xC5,0xA2,0x64,0x9A,0x23,0x8A,0x43,0x92,0xA4,0x9A,0x64,0x9A,0x43,0x92,0x43,0x8A,0xA4,0xA2,0x05,0xB3,0x05,0xB3,0x25,0xBB,0xA6,0xCB,0x86,0xCB,0x66,0xCB,0x86,0xCB,0xA6,0xD3,
-	0xC7,0xD3,0x66,0xD3,0xA6,0xD3,0xA7,0xCB,0x66,0xCB,0x25,0xC3,0x46,0xC3,0x25,0xBB,0x87,0xCB,0x46,0xC3,0x05,0xBB,0x25,0xBB,0x47,0xB3,0x2C,0xE4,0xEA,0xE3,0xC9,0xE3,0xE9,0xE3,0x8C,0xEC,0x8A,0xFC,0x4A,0xFC,0x09,0xF4,0x24,0xDB,0xC3,0xAA,0xC3,0xB2,0xA4,0xAA,0x83,0xAA,0x83,0xAA,0x82,0xBA,0xA2,0xCA,0xC2,0xD2,0x81,0xC2,0xA1,0xD2,
-	0xA1,0xD2,0x81,0xCA,0xA1,0xD2,0x42,0xEB,0x62,0xF3,0x42,0xF3,0x22,0xEB,0xA2,0xD2,0x23,0xDB,0xA5,0xF3,0xA4,0xF3,0x02,0xE3,0x81,0xCA,0xA2,0xC2,0x62,0xBA,0xA1,0xCA,0xC2,0xD2,0xA1,0xCA,0x43,0xE3,0x45,0xFC,0x22,0xEB,0xC2,0xD2,0x02,0x92,0xE3,0x79,0x02,0x82,0xE3,0x79,0x22,0x9A,0x22,0x9A,0x03,0x82,0x02,0x82,0x03,0x82,0x03,0x82,
-	0xE3,0x79,0x03,0x8A,0x22,0xA2,0x03,0x8A,0x23,0x9A,0x62,0xB2,0x63,0xC2,0x02,0x9A,0x03,0x92,0x03,0x82,0xE3,0x81,0xE3,0x81,0x23,0x8A,0x23,0xAA,0x63,0xA2,0x83,0xCA,0xC3,0xD2,0xE3,0xD2,0xC3,0xDA,0x03,0xE3,0x23,0x92,0x03,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xBB,0x66,0xC3,0xA6,0xCB,0xE7,0xD3,0xA6,0xD3,0xC7,0xD3,0x86,0xCB,0xC4,0xAA,0xA4,0xA2,0xA4,0xA2,0xA5,0xAA,0x25,0xBB,0x46,0xBB,0xA4,0xA2,0x64,0x9A,0x84,0x9A,0x84,0xA2,0x83,0x9A,0x43,0x92,0x43,0x8A,0x84,0x92,0x25,0xBB,
-	0x45,0xBB,0x05,0xB3,0x46,0xC3,0x66,0xCB,0xC7,0xD3,0xC7,0xD3,0xA6,0xD3,0xA6,0xD3,0xA6,0xD3,0xA7,0xD3,0xA6,0xD3,0xA7,0xD3,0x87,0xCB,0x45,0xBB,0xC4,0xAA,0x64,0x9A,0x44,0x8A,0x03,0x8A,0x03,0x82,0x64,0x92,0xA4,0xA2,0x63,0x92,0x43,0x8A,0x43,0x8A,0x84,0x9A,0xA4,0xA2,0x05,0xB3,0x45,0xCB,0x87,0xCB,0x46,0xC3,0x66,0xCB,0x87,0xCB,
-	0x87,0xCB,0x86,0xCB,0x86,0xCB,0x86,0xCB,0xA7,0xCB,0x66,0xC3,0x86,0xCB,0xE4,0xB2,0x25,0xBB,0x25,0xBB,0x05,0xB3,0x25,0xB3,0x2B,0xD4,0xC9,0xE3,0xC9,0xE3,0xA8,0xDB,0xC8,0xDB,0x2A,0xF4,0x4A,0xFC,0x4A,0xFC,0x86,0xE3,0xE3,0xCA,0xE3,0xCA,0xA3,0xBA,0xC3,0xB2,0xA3,0xB2,0x82,0xB2,0x82,0xBA,0x82,0xBA,0x82,0xCA,0xA1,0xD2,0xA1,0xD2,
-	0xA1,0xD2,0x81,0xCA,0x01,0xE3,0x63,0xF3,0x83,0xF3,0xA3,0xF3,0x63,0xF3,0xC4,0xF3,0x46,0xF4,0x87,0xFC,0xC4,0xF3,0x63,0xEB,0xE2,0xDA,0xA1,0xCA,0xA1,0xD2,0xA1,0xD2,0xA1,0xD2,0x82,0xCA,0xA1,0xC2,0xE1,0xDA,0x03,0xDB,0x82,0xC2,0x02,0x9A,0x03,0x8A,0x02,0x8A,0xE3,0x79,0x03,0x82,0xE3,0x79,0xE3,0x81,0xE2,0x81,0x03,0x8A,0x03,0x82,
-	0x03,0x92,0x23,0x9A,0x22,0x9A,0x03,0x8A,0x03,0x8A,0x43,0xB2,0x63,0xAA,0x03,0x8A,0x03,0x8A,0x03,0x8A,0xE3,0x79,0x03,0x8A,0x03,0x8A,0x63,0xAA,0x63,0xA2,0x64,0xB2,0xE4,0xCA,0xC3,0xD2,0xE3,0xDA,0xE3,0xDA,0xC3,0xCA,0x03,0x82,0xE2,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xB3,0x46,0xBB,0x25,0xBB,0x87,0xCB,0xC7,0xD3,0xC7,0xD3,0xA7,0xD3,0x66,0xC3,0xE4,0xB2,0xE4,0xAA,0xA4,0xA2,0x46,0xBB,0x66,0xC3,0xC4,0xAA,0x64,0x92,0x23,0x8A,0x64,0x9A,0x84,0xA2,0xC4,0xA2,0x64,0x9A,0xA4,0xA2,0xC4,0xA2,0x25,0xBB,
-	0x25,0xBB,0xC4,0xAA,0x46,0xBB,0xA7,0xD3,0xA6,0xD3,0xA7,0xCB,0x87,0xCB,0xA6,0xD3,0xA7,0xD3,0x86,0xCB,0x86,0xCB,0xA7,0xD3,0x87,0xCB,0x46,0xBB,0xE5,0xAA,0xA4,0xA2,0x43,0x92,0x23,0x8A,0x23,0x8A,0x44,0x92,0xA4,0x9A,0x64,0x9A,0x23,0x8A,0xE2,0x79,0xE2,0x81,0x43,0x92,0x84,0x9A,0xC4,0xAA,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x46,0xC3,
-	0x66,0xC3,0x87,0xCB,0x86,0xCB,0xA6,0xD3,0x86,0xCB,0x86,0xCB,0xA6,0xD3,0x66,0xC3,0xE5,0xB2,0x83,0xA2,0xC4,0xAA,0xC6,0xA2,0x4B,0xE4,0xA8,0xDB,0xC8,0xE3,0xA7,0xDB,0x86,0xDB,0x8A,0xF4,0x4A,0xFC,0x08,0xF4,0x24,0xD3,0xE3,0xCA,0xC3,0xBA,0xC2,0xCA,0xC3,0xC2,0xC3,0xBA,0x82,0xBA,0x82,0xBA,0x81,0xC2,0xC1,0xD2,0x81,0xC2,0xA1,0xD2,
-	0x02,0xE3,0xC1,0xDA,0x22,0xEB,0xA3,0xF3,0x63,0xF3,0xA3,0xF3,0xA3,0xF3,0x25,0xFC,0x87,0xFC,0x27,0xF4,0x05,0xF4,0x22,0xE3,0xC2,0xDA,0x22,0xE3,0xA2,0xC2,0xE2,0xDA,0x62,0xEB,0x82,0xBA,0xA2,0xD2,0x43,0xEB,0x63,0xEB,0x62,0xBA,0x23,0x92,0x03,0x8A,0xE3,0x79,0xE3,0x81,0x23,0x92,0x23,0x92,0xE3,0x81,0xE3,0x79,0x03,0x8A,0x03,0x8A,
-	0x22,0x92,0x22,0x92,0x03,0x92,0x03,0x8A,0x43,0x9A,0x63,0xA2,0x63,0xBA,0x03,0x8A,0x03,0x8A,0x03,0x8A,0xE3,0x79,0xE3,0x81,0x03,0x8A,0x23,0x9A,0x84,0x9A,0xA4,0xCA,0x04,0xDB,0xE4,0xDA,0xE3,0xD2,0x03,0xDB,0xE3,0xDA,0x03,0x8A,0xE3,0x81,0xE3,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xC3,0x25,0xBB,0x05,0xB3,0xA7,0xD3,0xA7,0xD3,0x87,0xCB,0x86,0xCB,0xA7,0xCB,0x45,0xBB,0xE5,0xB2,0x66,0xC3,0x87,0xCB,0x66,0xC3,0xA4,0xA2,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x9A,0xC5,0xA2,0x05,0xB3,0x84,0xA2,0xE5,0xB2,
-	0xE5,0xB2,0x04,0xB3,0x45,0xC3,0x46,0xC3,0xA7,0xD3,0xA7,0xCB,0x87,0xCB,0xA7,0xD3,0x86,0xCB,0x66,0xC3,0x45,0xC3,0x86,0xCB,0x66,0xCB,0x26,0xBB,0xE4,0xAA,0x84,0xA2,0x64,0x92,0x84,0x92,0x43,0x92,0x64,0x92,0x84,0x9A,0x84,0x92,0x64,0x92,0xE2,0x79,0xE2,0x81,0x43,0x8A,0x64,0x92,0x84,0x9A,0xA4,0xA2,0xC4,0xAA,0x05,0xB3,0x46,0xBB,
-	0x46,0xC3,0x66,0xC3,0x46,0xC3,0x86,0xCB,0xA7,0xD3,0x66,0xCB,0x87,0xCB,0x25,0xC3,0x05,0xB3,0xA4,0xA2,0x84,0x9A,0x07,0xA3,0xC9,0xE3,0xA8,0xDB,0xC7,0xE3,0x66,0xE3,0x86,0xDB,0x8A,0xF4,0x28,0xF4,0xE7,0xF3,0x03,0xD3,0xC3,0xCA,0xE2,0xDA,0xC2,0xCA,0xC3,0xBA,0xA2,0xBA,0x82,0xBA,0xC2,0xCA,0x82,0xC2,0xE2,0xDA,0xC1,0xDA,0xE1,0xDA,
-	0x83,0xF3,0xE2,0xE2,0xA1,0xD2,0xA2,0xD2,0xE1,0xDA,0xC2,0xD2,0xE1,0xDA,0x05,0xF4,0x25,0xFC,0x45,0xFC,0x62,0xF3,0x83,0xF3,0x22,0xEB,0xC1,0xDA,0xE1,0xDA,0x46,0xF4,0x25,0xF4,0x42,0xEB,0xA1,0xD2,0x03,0xDB,0xE4,0xF3,0x23,0xE3,0x62,0xC2,0x03,0x8A,0x03,0x82,0x03,0x8A,0x22,0x92,0x02,0x8A,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x92,
-	0x23,0x9A,0xA3,0xCA,0xE4,0xDA,0xA3,0xC2,0xA3,0xCA,0x84,0xC2,0xA4,0xBA,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0xE3,0x81,0xE3,0x81,0x03,0x92,0x44,0xA2,0xC4,0xD2,0x44,0xEB,0xE4,0xDA,0xE3,0xDA,0xC3,0xD2,0xC3,0xDA,0x02,0x92,0xE3,0x81,0xE3,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xBB,0x25,0xBB,0x25,0xB3,0x05,0xB3,0x46,0xBB,0xA7,0xCB,0x86,0xCB,0x46,0xC3,0x87,0xCB,0x25,0xBB,0x05,0xB3,0xA7,0xCB,0xA6,0xCB,0x66,0xC3,0xE5,0xB2,0x63,0x92,0x84,0x9A,0xA4,0xA2,0x63,0x92,0x63,0x92,0xA4,0xA2,0x84,0xA2,0xC4,0xA2,0x05,0xB3,
-	0xE4,0xAA,0x46,0xC3,0x66,0xC3,0x66,0xC3,0xA7,0xCB,0x66,0xC3,0x66,0xCB,0x87,0xCB,0x66,0xC3,0x46,0xC3,0x46,0xC3,0x66,0xC3,0x25,0xBB,0xE5,0xB2,0xC4,0xAA,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x43,0x92,0x43,0x92,0x64,0x9A,0xC5,0xA2,0x84,0xA2,0x44,0x8A,0x23,0x82,0xE2,0x81,0x03,0x82,0x23,0x82,0x43,0x8A,0x64,0x9A,0xA4,0xA2,0x05,0xB3,
-	0x05,0xB3,0x05,0xB3,0x25,0xBB,0x66,0xC3,0x87,0xCB,0x46,0xC3,0x66,0xC3,0x05,0xAB,0xA4,0xA2,0xE5,0xB2,0x05,0xB3,0x0A,0xDC,0xA7,0xDB,0xC7,0xE3,0xA7,0xE3,0x66,0xEB,0x86,0xE3,0x28,0xF4,0x07,0xF4,0x86,0xEB,0xC3,0xCA,0xE2,0xD2,0x02,0xE3,0xC2,0xCA,0xA2,0xBA,0x82,0xC2,0xC1,0xD2,0xC1,0xDA,0x81,0xCA,0x82,0xC2,0xC1,0xDA,0xA1,0xD2,
-	0xA1,0xD2,0xA1,0xD2,0xA1,0xD2,0x81,0xC2,0xA1,0xD2,0x81,0xCA,0xC1,0xD2,0x05,0xF4,0x25,0xFC,0x25,0xFC,0xA3,0xF3,0xE1,0xE2,0xA1,0xD2,0x81,0xCA,0x81,0xCA,0x81,0xC2,0xE2,0xE2,0xA2,0xD2,0xC2,0xD2,0x63,0xF3,0xA4,0xEB,0x02,0xE3,0xC2,0xD2,0x23,0x9A,0x03,0x8A,0x42,0xAA,0x23,0x9A,0x03,0x8A,0xE3,0x81,0x03,0x8A,0xE3,0x81,0x02,0x92,
-	0x03,0x92,0x83,0xBA,0x65,0xEB,0x24,0xE3,0xE4,0xD2,0xA4,0xCA,0x84,0xC2,0x44,0xB2,0x23,0x92,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x79,0x03,0x8A,0x23,0xA2,0x84,0xCA,0xE4,0xE2,0xA3,0xD2,0xC3,0xD2,0xC3,0xD2,0xA4,0xCA,0x62,0xBA,0xE3,0x79,0xE3,0x79,0xC2,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xBB,0x25,0xBB,0x05,0xB3,0xE5,0xAA,0x46,0xBB,0x86,0xCB,0x66,0xC3,0x25,0xC3,0x66,0xCB,0x25,0xBB,0x05,0xB3,0x86,0xCB,0xC7,0xD3,0x87,0xCB,0xE4,0xAA,0xA4,0xA2,0xC4,0xA2,0xA4,0xA2,0x63,0x92,0x43,0x92,0xA4,0xA2,0xC4,0xAA,0xC5,0xAA,0xC4,0xAA,
-	0x46,0xC3,0x87,0xCB,0x66,0xC3,0x87,0xCB,0x66,0xC3,0x45,0xC3,0x66,0xCB,0x46,0xC3,0x25,0xBB,0x66,0xC3,0x46,0xC3,0x66,0xC3,0x46,0xC3,0x05,0xB3,0xC4,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x43,0x92,0x23,0x8A,0x64,0x9A,0xC4,0xA2,0xC4,0xA2,0x84,0x9A,0x03,0x8A,0xA2,0x71,0xC2,0x71,0xE3,0x79,0x03,0x82,0x23,0x82,0x64,0x92,0xA4,0xA2,
-	0xE5,0xAA,0xA4,0xA2,0x84,0xA2,0xE5,0xB2,0x66,0xCB,0x66,0xCB,0x25,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE9,0xDB,0x87,0xE3,0xA6,0xEB,0x86,0xEB,0xA6,0xEB,0xA6,0xEB,0xE7,0xF3,0x65,0xEB,0x65,0xEB,0xC2,0xC2,0xE2,0xDA,0x02,0xE3,0xC2,0xD2,0xE2,0xDA,0xC2,0xD2,0xC2,0xDA,0xC1,0xDA,0xA1,0xD2,0x81,0xBA,0xA1,0xD2,0xA1,0xD2,
-	0xA1,0xD2,0xC1,0xDA,0xC1,0xDA,0xC1,0xDA,0xC1,0xDA,0xA1,0xD2,0x22,0xE3,0x05,0xFC,0x66,0xFC,0x05,0xFC,0x02,0xE3,0xC1,0xDA,0xC1,0xDA,0xA1,0xD2,0x62,0xBA,0x42,0xB2,0x81,0xC2,0xA2,0xD2,0xE2,0xD2,0x05,0xF4,0x83,0xF3,0xE4,0xF3,0x02,0xE3,0x82,0xCA,0x23,0xA2,0x22,0x9A,0x03,0x82,0xE3,0x81,0x02,0x8A,0x02,0x92,0xE3,0x81,0x03,0x8A,
-	0x03,0x8A,0x83,0xBA,0x45,0xDB,0xC4,0xCA,0xA4,0xCA,0xA4,0xC2,0xA4,0xC2,0x64,0xBA,0x23,0x9A,0x03,0x8A,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x92,0x24,0xA2,0x63,0xB2,0x84,0xC2,0x64,0xBA,0xC3,0xCA,0x84,0xCA,0xA3,0xCA,0xC3,0xD2,0xE3,0x79,0xC2,0x79,0xC2,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xC3,0x46,0xBB,0x46,0xBB,0x05,0xB3,0xE5,0xB2,0x25,0xBB,0x05,0xBB,0x66,0xC3,0x25,0xC3,0x46,0xC3,0x66,0xC3,0x46,0xBB,0xA7,0xCB,0xA7,0xCB,0xA7,0xCB,0x25,0xB3,0xC5,0xA2,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0x63,0x92,0x26,0xBB,0xC4,0xAA,0x26,0xBB,0x05,0xB3,
-	0x66,0xBB,0xA7,0xCB,0x87,0xCB,0x46,0xC3,0x46,0xC3,0x87,0xC3,0x46,0xC3,0x46,0xBB,0x05,0xBB,0x26,0xBB,0x25,0xBB,0x46,0xC3,0x66,0xC3,0x26,0xBB,0x05,0xB3,0xE5,0xAA,0x84,0xA2,0x64,0x92,0x43,0x92,0x64,0x9A,0x64,0x9A,0xA4,0xA2,0xE5,0xB2,0xE5,0xAA,0x63,0x92,0xA2,0x71,0xA2,0x69,0xA2,0x71,0xC2,0x71,0xE2,0x79,0x23,0x8A,0x43,0x8A,
-	0xA4,0xA2,0xC4,0xAA,0x84,0xA2,0x84,0xA2,0xE5,0xB2,0x05,0xB3,0x66,0xC3,0x66,0xC3,0xC4,0xAA,0x25,0xBB,0x26,0xBB,0xE8,0xEB,0xC6,0xEB,0xC6,0xF3,0x66,0xEB,0xA6,0xEB,0x85,0xF3,0x44,0xEB,0x24,0xE3,0x23,0xE3,0xE2,0xD2,0x02,0xE3,0xE2,0xDA,0xE2,0xD2,0xC2,0xD2,0x02,0xDB,0xE2,0xDA,0xA1,0xD2,0xE1,0xDA,0xA1,0xD2,0xC1,0xD2,0xE1,0xDA,
-	0xA1,0xD2,0xC1,0xDA,0xE2,0xE2,0x02,0xE3,0x22,0xEB,0x21,0xEB,0x46,0xFC,0x45,0xFC,0xC4,0xFB,0xE4,0xFB,0x22,0xEB,0xE2,0xDA,0xC2,0xDA,0x82,0xCA,0x62,0xC2,0x22,0xAA,0x23,0xA2,0xC2,0xD2,0xE2,0xE2,0xA4,0xF3,0xC4,0xF3,0xE4,0xF3,0x43,0xEB,0xE2,0xDA,0xA3,0xC2,0x42,0x9A,0xE3,0x89,0x03,0x82,0x03,0x82,0x03,0x92,0x02,0x8A,0x03,0x8A,
-	0x03,0x8A,0x63,0xB2,0x03,0xDB,0xC3,0xD2,0xC3,0xCA,0x84,0xC2,0xA4,0xC2,0x83,0xB2,0x64,0xA2,0x23,0x92,0x23,0x92,0x03,0x82,0x03,0x8A,0x03,0x8A,0x23,0x9A,0x64,0x9A,0x64,0xAA,0x64,0xBA,0x83,0xC2,0x64,0xBA,0xA3,0xC2,0xE3,0xDA,0x03,0x82,0xC2,0x79,0xC2,0x79,0xE3,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x25,0xBB,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x87,0xC3,0x46,0xC3,0x25,0xBB,0x66,0xC3,0x45,0xC3,0x46,0xC3,0xA7,0xCB,0x87,0xCB,0x46,0xC3,0x45,0xC3,0x46,0xBB,0xE5,0xAA,0x67,0xC3,0xE5,0xAA,0x25,0xBB,0x25,0xBB,0x66,0xC3,0x45,0xBB,
-	0x66,0xC3,0x46,0xC3,0x46,0xC3,0x46,0xBB,0x66,0xC3,0x86,0xCB,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x46,0xBB,0x25,0xBB,0x46,0xBB,0x66,0xC3,0x46,0xBB,0x05,0xB3,0xE5,0xAA,0xA4,0xA2,0x84,0x9A,0x63,0x9A,0x63,0x9A,0x84,0x9A,0xA4,0xA2,0xE5,0xAA,0xC5,0xAA,0x83,0x9A,0xC2,0x71,0x82,0x61,0x82,0x69,0xA2,0x69,0x82,0x69,0xA2,0x71,0xE2,0x79,
-	0x23,0x82,0x23,0x8A,0x64,0x92,0x84,0xA2,0xC5,0xAA,0x25,0xBB,0x66,0xCB,0x87,0xCB,0x46,0xC3,0x87,0xC3,0xC8,0xCB,0xE8,0xEB,0xA6,0xF3,0xA6,0xF3,0x66,0xEB,0xA6,0xEB,0x65,0xEB,0x24,0xEB,0x24,0xE3,0x63,0xEB,0x63,0xEB,0x43,0xE3,0x22,0xEB,0xC1,0xDA,0xC2,0xD2,0xE2,0xDA,0x02,0xE3,0xC1,0xDA,0xE1,0xDA,0xE1,0xDA,0x01,0xEB,0x01,0xE3,
-	0x01,0xE3,0x22,0xEB,0x22,0xEB,0x63,0xF3,0x42,0xEB,0xA3,0xF3,0x25,0xFC,0x05,0xFC,0xA3,0xF3,0x42,0xEB,0x42,0xEB,0xC1,0xDA,0xA2,0xD2,0x82,0xC2,0x81,0xCA,0xA2,0xCA,0xC2,0xD2,0x22,0xE3,0x43,0xEB,0x83,0xF3,0xE4,0xF3,0xA4,0xF3,0x44,0xEB,0xC2,0xDA,0x23,0xDB,0xA2,0xCA,0x62,0xBA,0x02,0x92,0x02,0x92,0x22,0x9A,0x23,0xA2,0x23,0x92,
-	0x03,0x8A,0x23,0xA2,0xC3,0xD2,0xE3,0xD2,0xA3,0xD2,0xE4,0xDA,0x25,0xDB,0xC4,0xD2,0x84,0xBA,0x44,0xAA,0x64,0xAA,0x23,0x9A,0x03,0x8A,0x23,0x8A,0x24,0x9A,0x24,0x92,0x64,0xAA,0x44,0xB2,0x83,0xAA,0x63,0xBA,0x44,0xB2,0xC4,0xD2,0x63,0xAA,0xE3,0x81,0xC2,0x79,0xE3,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xBB,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x46,0xBB,0x25,0xBB,0x25,0xBB,0x45,0xBB,0x46,0xC3,0x46,0xC3,0x87,0xCB,0x66,0xC3,0x46,0xBB,0x87,0xC3,0xA7,0xCB,0x87,0xCB,0x46,0xC3,0xA7,0xCB,0x67,0xC3,0x25,0xBB,0x87,0xCB,0x87,0xCB,0x66,0xC3,0x46,0xC3,0xA7,0xCB,0xA7,0xD3,
-	0x45,0xBB,0x25,0xBB,0x66,0xC3,0x87,0xC3,0x66,0xC3,0x66,0xC3,0x46,0xC3,0x25,0xBB,0x25,0xBB,0x25,0xB3,0x05,0xBB,0x26,0xBB,0x66,0xC3,0x26,0xBB,0xE5,0xAA,0xC4,0xAA,0xA4,0xA2,0x64,0x9A,0x23,0x8A,0x23,0x8A,0x64,0x9A,0xA4,0x9A,0xC4,0xA2,0x84,0xA2,0x43,0x92,0xE2,0x79,0xA2,0x69,0xA2,0x69,0xC2,0x71,0xA2,0x71,0xC2,0x71,0xC2,0x71,
-	0xC3,0x71,0x03,0x82,0x43,0x92,0x84,0x9A,0xA5,0xA2,0x45,0xBB,0x45,0xBB,0x45,0xC3,0x66,0xC3,0x25,0xC3,0x89,0xC3,0xC7,0xF3,0xC6,0xF3,0xA6,0xEB,0x66,0xE3,0x86,0xEB,0x85,0xF3,0x65,0xEB,0x44,0xEB,0x23,0xE3,0x02,0xDB,0x83,0xF3,0x22,0xEB,0xE2,0xDA,0xC1,0xD2,0xA1,0xCA,0xC1,0xDA,0x02,0xEB,0x02,0xE3,0x22,0xE3,0x22,0xE3,0xE2,0xDA,
-	0x63,0xEB,0x42,0xEB,0x42,0xF3,0x63,0xF3,0xE4,0xFB,0xE4,0xF3,0x22,0xEB,0x83,0xF3,0x02,0xDB,0x62,0xBA,0xC1,0xD2,0x22,0xEB,0x63,0xEB,0x83,0xF3,0x23,0xEB,0x43,0xEB,0x43,0xEB,0x23,0xEB,0xA4,0xEB,0x46,0xF4,0x66,0xFC,0x05,0xFC,0x63,0xEB,0x02,0xE3,0xE2,0xE2,0xC2,0xDA,0x82,0xBA,0xC3,0xCA,0xC2,0xD2,0xE3,0xDA,0xC2,0xDA,0x43,0xB2,
-	0x23,0x92,0x62,0xB2,0x62,0xC2,0xA3,0xDA,0xA3,0xD2,0xC3,0xDA,0x25,0xE3,0xE4,0xD2,0x04,0xD3,0xE4,0xCA,0x44,0x9A,0x24,0x92,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x23,0x92,0x44,0xA2,0x64,0xA2,0x84,0xA2,0x63,0xAA,0x44,0xAA,0xA3,0xCA,0x63,0xBA,0xC2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xBB,0x05,0xB3,0x05,0xB3,0x25,0xB3,0x25,0xBB,0x25,0xBB,0x46,0xBB,0x46,0xBB,0x25,0xBB,0x66,0xC3,0x66,0xC3,0x66,0xC3,0x46,0xBB,0x66,0xC3,0x66,0xC3,0x87,0xCB,0x66,0xC3,0x46,0xBB,0x25,0xBB,0x45,0xBB,0x66,0xC3,0x87,0xCB,0x66,0xC3,0x66,0xC3,0x86,0xC3,0x66,0xC3,
-	0x66,0xC3,0x46,0xC3,0x66,0xC3,0x45,0xBB,0x26,0xBB,0x25,0xBB,0x46,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x25,0xB3,0x45,0xBB,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xC4,0xA2,0x84,0x9A,0x43,0x8A,0x23,0x8A,0x64,0x92,0x43,0x92,0x64,0x92,0x84,0x9A,0x43,0x8A,0xE2,0x81,0xC2,0x71,0xC2,0x71,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xA2,0x71,
-	0xC2,0x79,0xC2,0x79,0x03,0x82,0x23,0x8A,0x43,0x92,0xE4,0xAA,0x25,0xBB,0x45,0xBB,0x66,0xC3,0x45,0xBB,0xEA,0xDB,0xA6,0xF3,0xC6,0xF3,0x66,0xEB,0x66,0xE3,0x86,0xEB,0x85,0xEB,0x84,0xF3,0x44,0xEB,0x24,0xE3,0x02,0xE3,0x22,0xEB,0xE1,0xDA,0xC1,0xDA,0x02,0xDB,0xE2,0xE2,0xA1,0xD2,0x21,0xEB,0xC1,0xDA,0x63,0xE3,0x02,0xDB,0x22,0xEB,
-	0x83,0xF3,0xE4,0xFB,0xE4,0xFB,0x46,0xFC,0x25,0xFC,0x63,0xF3,0x83,0xF3,0x02,0xE3,0xC2,0xDA,0x62,0xBA,0xC2,0xDA,0xA4,0xF3,0x05,0xFC,0x66,0xFC,0xE4,0xFB,0xE4,0xFB,0xC4,0xF3,0x84,0xF3,0x05,0xFC,0x46,0xF4,0xA7,0xFC,0x66,0xFC,0xC5,0xF3,0x84,0xF3,0x63,0xEB,0x23,0xEB,0x43,0xEB,0x43,0xEB,0x43,0xEB,0x43,0xEB,0x23,0xEB,0x42,0xB2,
-	0x23,0x9A,0x22,0xA2,0x23,0xA2,0x83,0xCA,0xA3,0xD2,0xA3,0xD2,0xA4,0xD2,0x64,0xC2,0xC4,0xCA,0x24,0xCB,0x65,0xBA,0x64,0xB2,0x64,0xB2,0x65,0xBA,0xC4,0xBA,0x84,0xA2,0x64,0x9A,0x64,0xAA,0x83,0xAA,0x63,0xB2,0x44,0xB2,0x84,0xC2,0xA3,0xC2,0xE2,0x81,0xC2,0x79,0xE3,0x79,0xC2,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x25,0xBB,0x46,0xBB,0x25,0xBB,0x46,0xBB,0x26,0xBB,0x25,0xBB,0x25,0xBB,0x46,0xBB,0x25,0xBB,0x46,0xBB,0x45,0xBB,0x46,0xC3,0x66,0xBB,0x46,0xBB,0x05,0xBB,0x04,0xB3,0x45,0xBB,0x46,0xBB,0x66,0xC3,0x46,0xBB,0x66,0xC3,0x87,0xC3,0x46,0xC3,
-	0x66,0xC3,0x46,0xBB,0xE4,0xB2,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x26,0xBB,0x26,0xBB,0x05,0xB3,0xE5,0xB2,0xE5,0xB2,0xE5,0xB2,0x05,0xB3,0x25,0xB3,0xE5,0xB2,0x05,0xB3,0xE5,0xAA,0xC5,0xAA,0x84,0x9A,0x64,0x92,0x84,0x9A,0x43,0x92,0x64,0x92,0xA4,0xA2,0x84,0x9A,0x23,0x8A,0xE3,0x79,0xE3,0x79,0xE3,0x81,0x03,0x82,0xC2,0x71,0xA2,0x71,
-	0xA2,0x71,0xA2,0x71,0xC2,0x71,0xE3,0x79,0x43,0x8A,0xE5,0xAA,0x45,0xBB,0x46,0xC3,0x45,0xBB,0x25,0xC3,0x4A,0xEC,0xE7,0xF3,0xA6,0xEB,0x65,0xEB,0x86,0xEB,0x86,0xEB,0xA5,0xF3,0xC5,0xF3,0x84,0xF3,0x63,0xEB,0x02,0xE3,0xE2,0xDA,0xC2,0xD2,0xC1,0xDA,0x22,0xE3,0xC4,0xFB,0x23,0xEB,0x02,0xE3,0x43,0xEB,0x22,0xE3,0x22,0xE3,0x63,0xEB,
-	0xC4,0xF3,0x66,0xFC,0x66,0xFC,0x86,0xFC,0x66,0xFC,0x05,0xF4,0xC4,0xF3,0x42,0xEB,0xE1,0xDA,0xA2,0xD2,0x83,0xF3,0x05,0xFC,0xE4,0xFB,0x25,0xFC,0xC4,0xF3,0xC4,0xF3,0xA7,0xFC,0xC4,0xF3,0xC4,0xF3,0x25,0xFC,0x46,0xF4,0x46,0xF4,0xC4,0xF3,0x84,0xF3,0x84,0xF3,0x43,0xEB,0x43,0xEB,0x63,0xEB,0xA5,0xF3,0x63,0xEB,0xA2,0xD2,0x43,0xA2,
-	0x23,0xA2,0x23,0xA2,0x43,0xAA,0x62,0xB2,0x64,0xBA,0x43,0xB2,0x23,0xA2,0x43,0xAA,0x44,0xB2,0x84,0xC2,0x84,0xBA,0x84,0xB2,0x64,0xA2,0x64,0xB2,0x84,0x9A,0x84,0x9A,0x84,0xA2,0xA4,0xB2,0x44,0xB2,0x63,0xAA,0x44,0xB2,0x64,0xBA,0x83,0xC2,0x02,0x82,0x03,0x82,0xE3,0x81,0x03,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xB3,0x05,0xB3,0x05,0xAB,0x05,0xB3,0x25,0xBB,0x25,0xBB,0x25,0xBB,0x05,0xBB,0x25,0xBB,0x26,0xBB,0x26,0xBB,0x05,0xBB,0x26,0xBB,0x46,0xBB,0x45,0xBB,0x05,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x46,0xBB,0x05,0xB3,0x26,0xBB,0x46,0xBB,0x66,0xC3,0x45,0xBB,0x25,0xBB,
-	0x46,0xBB,0x25,0xBB,0xE5,0xB2,0x26,0xBB,0x05,0xBB,0x25,0xBB,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xB2,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x05,0xB3,0xC4,0xAA,0x64,0x92,0x64,0x92,0x84,0x9A,0x84,0x9A,0x84,0xA2,0x84,0xA2,0x23,0x8A,0x03,0x82,0xE3,0x81,0x03,0x82,0x03,0x82,0xC2,0x79,0xC2,0x71,
-	0xC3,0x71,0xC2,0x71,0xA2,0x71,0xE2,0x79,0x64,0x92,0xA4,0xA2,0x05,0xB3,0x25,0xBB,0x25,0xBB,0x46,0xBB,0x29,0xF4,0x29,0xF4,0x66,0xEB,0x66,0xEB,0x86,0xEB,0x86,0xEB,0xC5,0xF3,0xA4,0xF3,0xA6,0xF3,0xA4,0xF3,0x02,0xE3,0xE2,0xDA,0xC2,0xD2,0x02,0xE3,0x23,0xEB,0x83,0xF3,0x42,0xEB,0x22,0xE3,0x83,0xEB,0x43,0xEB,0x43,0xEB,0x25,0xFC,
-	0x45,0xFC,0x66,0xFC,0x66,0xFC,0xC8,0xFC,0x47,0xF4,0x05,0xF4,0xC4,0xF3,0x22,0xE3,0x02,0xE3,0x43,0xE3,0x83,0xF3,0x66,0xFC,0x46,0xF4,0x84,0xF3,0xC4,0xF3,0x83,0xEB,0xE4,0xFB,0xC4,0xFB,0xE5,0xFB,0xE6,0xF3,0xE4,0xF3,0x05,0xFC,0xA4,0xF3,0x64,0xF3,0x64,0xF3,0x43,0xEB,0x23,0xEB,0x63,0xEB,0x85,0xF3,0x43,0xEB,0xA2,0xD2,0x82,0xC2,
-	0x43,0xB2,0x62,0xB2,0x23,0xAA,0x43,0xB2,0x43,0xB2,0x23,0x9A,0x03,0x8A,0x03,0x8A,0x23,0x92,0x84,0xBA,0xA4,0xC2,0x44,0xAA,0x64,0xB2,0x64,0xA2,0x24,0x92,0x64,0x92,0x64,0xA2,0xA4,0xCA,0x44,0xBA,0x63,0xAA,0x44,0xB2,0x64,0xB2,0x64,0xB2,0xE2,0x81,0x23,0x8A,0x23,0x8A,0x03,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x25,0xB3,0x05,0xB3,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x26,0xBB,0x26,0xBB,0x46,0xBB,0x05,0xB3,0x26,0xBB,0x25,0xBB,0x25,0xBB,
-	0x05,0xB3,0x25,0xB3,0x05,0xBB,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xC4,0xAA,0xC4,0xA2,0xC4,0xAA,0xE5,0xAA,0xC5,0xA2,0xC4,0xA2,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xA2,0x84,0x92,0x23,0x92,0x84,0x9A,0xC4,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x92,0x23,0x82,0xE2,0x81,0x03,0x82,0x23,0x8A,0xE2,0x81,0xC2,0x79,
-	0xE3,0x79,0xA2,0x71,0xA2,0x69,0xC3,0x71,0x63,0x92,0xC4,0xA2,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x25,0xBB,0xE7,0xF3,0xE7,0xEB,0x66,0xE3,0x86,0xDB,0x66,0xEB,0x66,0xE3,0x49,0xFC,0x07,0xF4,0xE5,0xF3,0xC4,0xF3,0x22,0xE3,0xC1,0xD2,0xE2,0xDA,0x02,0xE3,0x23,0xEB,0x63,0xF3,0x23,0xE3,0xC4,0xF3,0x66,0xFC,0x46,0xFC,0x46,0xFC,0xC7,0xFC,
-	0xE8,0xFC,0xC8,0xFC,0xC8,0xFC,0xC8,0xFC,0x87,0xF4,0x27,0xF4,0xA5,0xF3,0x23,0xDB,0xC2,0xD2,0xC2,0xD2,0x23,0xE3,0xC4,0xF3,0x25,0xFC,0xA4,0xF3,0xC4,0xF3,0x63,0xEB,0xA3,0xF3,0xE4,0xF3,0x05,0xFC,0xE4,0xF3,0xE4,0xFB,0x63,0xF3,0x43,0xEB,0x64,0xEB,0x43,0xEB,0x63,0xEB,0x43,0xEB,0x85,0xEB,0x05,0xF4,0x42,0xEB,0xA2,0xDA,0xA2,0xD2,
-	0x83,0xCA,0xA3,0xD2,0x83,0xCA,0x63,0xBA,0x83,0xC2,0x42,0xAA,0xE3,0x81,0xE3,0x81,0x23,0x92,0x44,0xAA,0x84,0xCA,0x23,0x9A,0x44,0xA2,0x64,0xB2,0x23,0x92,0x04,0x82,0x44,0x92,0x84,0xBA,0x84,0xBA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x43,0xA2,0x03,0x8A,0x23,0x8A,0x02,0x82,0x03,0x82,0xC2,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xAB,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xB2,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x25,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x05,0xAB,0xE5,0xB2,0xE5,0xB2,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,
-	0x05,0xB3,0x05,0xB3,0x05,0xB3,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0xA4,0xA2,0xC4,0xA2,0x64,0x9A,0x63,0x9A,0x84,0x9A,0xC5,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x43,0x8A,0x02,0x82,0x03,0x82,0x23,0x82,0x23,0x82,0xE3,0x79,
-	0xE2,0x79,0xA2,0x71,0xA2,0x71,0xE3,0x79,0x03,0x82,0x84,0x9A,0xC4,0xA2,0xE5,0xAA,0x05,0xB3,0x25,0xBB,0x07,0xF4,0xC6,0xF3,0x64,0xEB,0x45,0xDB,0x66,0xEB,0x66,0xE3,0x27,0xF4,0x69,0xEC,0xC6,0xF3,0x44,0xEB,0x02,0xE3,0x22,0xE3,0x02,0xE3,0xE2,0xDA,0x02,0xE3,0x83,0xF3,0x84,0xEB,0x66,0xF4,0x87,0xFC,0xC7,0xFC,0x28,0xFD,0x29,0xFD,
-	0x49,0xFD,0xE8,0xFC,0xC8,0xFC,0x86,0xFC,0xA7,0xF4,0x66,0xFC,0xE4,0xF3,0x43,0xE3,0x82,0xC2,0x62,0xC2,0xE2,0xDA,0x22,0xE3,0x43,0xEB,0x03,0xE3,0xE2,0xDA,0xE2,0xDA,0x02,0xE3,0xC4,0xF3,0xA4,0xF3,0xA4,0xF3,0xE4,0xF3,0x43,0xEB,0x43,0xEB,0x43,0xEB,0x03,0xE3,0x04,0xE3,0x02,0xE3,0x63,0xEB,0x43,0xEB,0x23,0xEB,0x43,0xEB,0xE3,0xE2,
-	0xC3,0xDA,0xE4,0xE2,0xA3,0xD2,0x82,0xCA,0x44,0xAA,0x03,0x92,0xE3,0x81,0xE3,0x79,0xE3,0x81,0xE3,0x81,0x64,0xBA,0x24,0xA2,0x23,0x9A,0x23,0x92,0x24,0xA2,0x04,0x92,0x44,0xA2,0x64,0xB2,0x64,0xB2,0x44,0xB2,0x64,0xB2,0x44,0xA2,0x43,0xA2,0x03,0x8A,0xE2,0x81,0x03,0x82,0xE3,0x81,0xC2,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xAB,0xE5,0xAA,0xE5,0xB2,0x05,0xAB,0xE5,0xAA,0xC4,0xAA,0xE5,0xAA,0xE4,0xAA,0xC5,0xA2,0xE5,0xAA,0xE5,0xAA,0xC4,0xAA,0xC5,0xAA,0xE5,0xAA,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0x26,0xBB,0x05,0xB3,0x05,0xB3,0x05,0xAB,0x05,0xB3,
-	0xE5,0xB2,0x05,0xB3,0xE5,0xB2,0xE5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC4,0xAA,0xE5,0xAA,0xC5,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0x64,0x92,0x64,0x92,0x84,0x9A,0x63,0x9A,0x84,0x9A,0xA5,0xA2,0x84,0xA2,0xA4,0xA2,0x84,0xA2,0x64,0x9A,0x43,0x92,0xE3,0x79,0xE3,0x79,0x03,0x82,0x23,0x8A,0xE3,0x81,
-	0xE3,0x79,0xC2,0x79,0xC2,0x71,0xC2,0x71,0xE3,0x79,0x43,0x8A,0x84,0x9A,0xA5,0xA2,0xC5,0xAA,0xE5,0xAA,0xEB,0xFC,0x08,0xF4,0x65,0xEB,0x45,0xE3,0x45,0xDB,0xC6,0xF3,0x68,0xF4,0xEA,0xFC,0xE5,0xF3,0xA6,0xF3,0x22,0xEB,0xE2,0xE2,0xE2,0xE2,0xE2,0xDA,0xE2,0xDA,0x43,0xEB,0xA7,0xFC,0xE8,0xFC,0x47,0xF4,0x66,0xFC,0xE8,0xFC,0x29,0xFD,
-	0xCB,0xFD,0x8A,0xFD,0x88,0xF4,0x86,0xFC,0xE6,0xF3,0xE4,0xF3,0xC4,0xF3,0xE2,0xDA,0x22,0xAA,0x62,0xB2,0xC2,0xD2,0x82,0xBA,0xA2,0xCA,0xA2,0xCA,0x82,0xC2,0xC2,0xD2,0x23,0xEB,0x83,0xF3,0x84,0xF3,0x64,0xF3,0xC4,0xF3,0x43,0xEB,0x43,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x03,0xE3,0xE3,0xE2,0xE3,0xE2,0xE3,0xE2,0x64,0xEB,0xC3,0xDA,
-	0x03,0xE3,0xC3,0xDA,0xC3,0xDA,0xA3,0xD2,0x43,0xAA,0x03,0x8A,0x03,0x82,0xE3,0x79,0xC4,0x79,0xA3,0x69,0x24,0x92,0x24,0xA2,0x44,0xAA,0x24,0x9A,0x44,0xA2,0x44,0xA2,0x24,0xA2,0x64,0xB2,0x64,0xB2,0x64,0xBA,0x64,0xB2,0x44,0xA2,0x84,0xA2,0x23,0x92,0x23,0x8A,0x03,0x8A,0x23,0x8A,0x02,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,0xE5,0xAA,0xA4,0xA2,0xA4,0xA2,0x84,0xA2,0xA5,0xA2,0xC5,0xA2,0xC4,0xA2,0xA4,0xA2,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xAB,0x05,0xB3,0xE5,0xAA,0xE5,0xAA,0xE5,0xAA,0x05,0xB3,
-	0xE5,0xAA,0xE5,0xB2,0xE5,0xAA,0xE5,0xAA,0xC5,0xAA,0xC4,0xAA,0xE5,0xAA,0xC4,0xAA,0xA4,0xA2,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x9A,0x84,0x9A,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0x64,0x9A,0x43,0x8A,0xE3,0x79,0xC2,0x79,0x23,0x82,0x23,0x8A,0xE3,0x81,
-	0xC2,0x79,0xC2,0x79,0xE3,0x79,0xC2,0x79,0xE2,0x79,0x03,0x82,0x64,0x9A,0x84,0x9A,0x84,0x9A,0xA5,0xA2,0xEB,0xFC,0x48,0xF4,0x24,0xEB,0x45,0xDB,0x04,0xE3,0x66,0xEB,0x06,0xF4,0xC5,0xF3,0x84,0xF3,0x85,0xF3,0xA3,0xF3,0x02,0xE3,0x22,0xEB,0xA2,0xD2,0xE1,0xDA,0x83,0xF3,0xE4,0xEB,0xA7,0xFC,0x28,0xFD,0x29,0xFD,0x29,0xFD,0x8A,0xFD,
-	0x2D,0xFE,0xEC,0xFD,0x86,0xFC,0x66,0xFC,0xC4,0xF3,0xA4,0xEB,0x43,0xE3,0x42,0xEB,0xA2,0xC2,0x82,0xBA,0xC2,0xCA,0xC2,0xCA,0xC2,0xCA,0xA2,0xD2,0x82,0xBA,0x82,0xCA,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x83,0xEB,0x43,0xEB,0x43,0xEB,0x63,0xEB,0x63,0xEB,0x23,0xEB,0x23,0xEB,0xC2,0xDA,0xE3,0xE2,0x23,0xEB,0x23,0xEB,0xE3,0xE2,0xC3,0xDA,
-	0x23,0xEB,0x23,0xE3,0xC3,0xDA,0xE3,0xE2,0x44,0xB2,0x03,0x92,0x04,0x8A,0xC3,0x79,0xE4,0x71,0xE4,0x81,0x04,0x92,0x24,0x92,0x24,0xA2,0x24,0xA2,0x64,0xB2,0x64,0xB2,0x44,0xB2,0x44,0xAA,0x64,0xB2,0x64,0xBA,0x64,0xB2,0x64,0xA2,0x44,0x9A,0x23,0x8A,0x43,0x8A,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x23,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xC5,0xAA,0x05,0xAB,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0xA4,0xA2,0xC5,0xA2,0xC4,0xA2,0xC5,0xAA,0xC4,0xA2,0xC5,0xAA,0xE5,0xAA,0xC4,0xA2,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xE5,0xAA,0xE5,0xAA,
-	0xC4,0xAA,0xC4,0xAA,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xC5,0xA2,0xC4,0xA2,0xA4,0xA2,0x84,0x9A,0xA4,0x9A,0x84,0x9A,0x64,0x92,0x64,0x92,0x43,0x8A,0x84,0x92,0x63,0x92,0x43,0x92,0x43,0x92,0x43,0x8A,0x64,0x92,0x43,0x92,0x64,0x9A,0x63,0x9A,0x84,0x9A,0x64,0x92,0x43,0x8A,0x03,0x82,0xE3,0x79,0x23,0x82,0x03,0x82,0xE2,0x79,
-	0xE3,0x81,0x03,0x82,0xC2,0x79,0xE3,0x79,0xE3,0x79,0x23,0x8A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0xAA,0xF4,0xC6,0xF3,0x24,0xEB,0x44,0xDB,0x24,0xDB,0x65,0xEB,0x85,0xEB,0x85,0xF3,0x85,0xEB,0x24,0xEB,0x64,0xF3,0xA4,0xFB,0x83,0xF3,0xE1,0xDA,0xE1,0xDA,0xC4,0xF3,0xC4,0xF3,0xA7,0xFC,0x08,0xFD,0x8A,0xFD,0xE8,0xFC,0x8A,0xFD,
-	0xEC,0xFD,0x28,0xFD,0x46,0xFC,0x05,0xFC,0x03,0xDB,0xE2,0xDA,0x02,0xDB,0x23,0xE3,0xE3,0xD2,0xC3,0xCA,0xC3,0xCA,0x24,0xDB,0x44,0xE3,0x23,0xE3,0xE3,0xDA,0x03,0xE3,0x23,0xEB,0x23,0xEB,0x43,0xEB,0x43,0xEB,0x23,0xEB,0x43,0xEB,0x05,0xF4,0x84,0xF3,0x03,0xDB,0xC3,0xDA,0x03,0xE3,0x03,0xE3,0x45,0xEB,0xC3,0xDA,0xA3,0xD2,0xA3,0xD2,
-	0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0x04,0xE3,0xA3,0xCA,0x23,0xA2,0x03,0x92,0x03,0x92,0x03,0x8A,0x23,0xA2,0x24,0xAA,0x03,0x8A,0x24,0xA2,0x44,0xAA,0x64,0xBA,0x44,0xB2,0x85,0xBA,0x65,0xBA,0x45,0xB2,0x44,0xAA,0x64,0xB2,0x24,0xA2,0x24,0x92,0x03,0x8A,0x03,0x8A,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x9A,0xA4,0x9A,0x84,0x9A,0x64,0x92,0x84,0x9A,0xA5,0x9A,0xC4,0xA2,0xA4,0xA2,0xC4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0xA4,0xA2,0xA4,0xA2,0xA4,0x9A,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xC5,0xA2,0xC4,0xA2,0xE5,0xAA,0xE5,0xAA,0xC4,0xA2,0xE5,0xAA,0xC5,0xAA,0xC4,0xAA,0xC4,0xA2,0xC5,0xA2,
-	0xC4,0xA2,0xE5,0xAA,0xC5,0xAA,0xC5,0xAA,0xC5,0xAA,0xA4,0xA2,0xC4,0xA2,0xC4,0xA2,0xA4,0x9A,0x64,0x92,0x84,0x9A,0x64,0x9A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x9A,0x64,0x92,0x43,0x92,0x23,0x8A,0x64,0x92,0x63,0x92,0x43,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x81,0x23,0x82,0x03,0x82,0xE2,0x79,0xC2,0x79,0x03,0x82,0xE2,0x79,
-	0xE3,0x79,0xE3,0x81,0xC2,0x79,0xC2,0x79,0x03,0x82,0x43,0x92,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x6A,0xFC,0x07,0xF4,0x44,0xEB,0x04,0xDB,0x03,0xDB,0x24,0xE3,0x24,0xEB,0x24,0xEB,0xE4,0xE2,0xE4,0xE2,0x43,0xEB,0x63,0xF3,0xA3,0xF3,0x63,0xEB,0x01,0xE3,0x22,0xE3,0x43,0xEB,0x05,0xF4,0x28,0xFD,0x08,0xFD,0x49,0xFD,0xE8,0xFC,
-	0xA7,0xFC,0xA7,0xFC,0x45,0xFC,0x05,0xFC,0x83,0xEB,0x22,0xE3,0x42,0xE3,0x44,0xE3,0xE3,0xDA,0xC3,0xCA,0x03,0xCB,0x85,0xEB,0x85,0xEB,0x64,0xEB,0x64,0xF3,0x63,0xEB,0x43,0xEB,0x23,0xEB,0x23,0xEB,0x23,0xEB,0x43,0xEB,0x64,0xF3,0xA4,0xF3,0x03,0xE3,0x03,0xDB,0xC3,0xDA,0xA3,0xDA,0xC3,0xDA,0xE3,0xE2,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,
-	0xA3,0xD2,0xC3,0xDA,0xC4,0xDA,0xC3,0xDA,0xA4,0xD2,0x44,0xBA,0x44,0xB2,0x03,0x8A,0x03,0x92,0x44,0xAA,0x44,0xAA,0x04,0x9A,0x64,0xB2,0x44,0xAA,0x44,0xB2,0x44,0xB2,0x65,0xBA,0x65,0xBA,0x64,0xAA,0x45,0xA2,0x44,0xAA,0x25,0x9A,0x24,0x9A,0x23,0x8A,0xE3,0x81,0xE2,0x81,0x03,0x82,0x23,0x82,0x23,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x8A,0x43,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x43,0x8A,0x64,0x92,0x64,0x92,0x64,0x9A,0xA4,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0xA4,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xC4,0xA2,0xC4,0xA2,0xC4,0xA2,0xC4,0xA2,0xC4,0xA2,0xC5,0xAA,0xE5,0xAA,0xC4,0xA2,0xC4,0xA2,0xA4,0xA2,
-	0xC5,0xAA,0xA4,0xA2,0xA4,0xA2,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x43,0x92,0x43,0x8A,0x43,0x92,0x44,0x8A,0x43,0x8A,0x43,0x92,0x43,0x92,0x23,0x8A,0x03,0x82,0x03,0x82,0x23,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xC2,0x71,0xE2,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC2,0x71,
-	0xA2,0x71,0xA2,0x71,0xC3,0x71,0xE3,0x79,0xE2,0x79,0x03,0x82,0x43,0x92,0x64,0x92,0x84,0x9A,0xA4,0x9A,0xCA,0xFC,0x07,0xEC,0xC6,0xEB,0x03,0xDB,0xE3,0xDA,0x04,0xE3,0x04,0xE3,0xE4,0xE2,0xE4,0xE2,0xE4,0xE2,0x23,0xEB,0x42,0xF3,0x63,0xF3,0xA4,0xFB,0xE4,0xF3,0x42,0xEB,0x22,0xEB,0x25,0xFC,0x66,0xFC,0x66,0xFC,0xA7,0xFC,0x28,0xFD,
-	0xA7,0xFC,0x66,0xFC,0x46,0xFC,0x05,0xFC,0xC4,0xF3,0x03,0xDB,0xE2,0xDA,0xC2,0xD2,0xE3,0xD2,0xC3,0xCA,0xE3,0xD2,0x04,0xDB,0x24,0xDB,0x07,0xF4,0x64,0xF3,0x63,0xF3,0x63,0xF3,0x23,0xEB,0x23,0xE3,0x23,0xEB,0x23,0xEB,0x03,0xE3,0x03,0xE3,0xE4,0xE2,0xE3,0xE2,0xA3,0xDA,0xA3,0xDA,0xA3,0xD2,0xA3,0xDA,0xA3,0xD2,0x83,0xCA,0xA4,0xD2,
-	0x83,0xCA,0x63,0xC2,0x84,0xCA,0x84,0xC2,0x64,0xBA,0x64,0xC2,0x44,0xBA,0x24,0x9A,0x24,0xA2,0x24,0xA2,0x24,0x9A,0x24,0x92,0x44,0xA2,0x44,0xAA,0x44,0xB2,0x85,0xBA,0x65,0xBA,0x65,0xBA,0x65,0xB2,0x45,0xA2,0x45,0xA2,0x25,0x9A,0x04,0x92,0x23,0x8A,0x03,0x82,0xE3,0x81,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x82,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x84,0x92,0x84,0x9A,0x84,0x9A,0x64,0x92,0x43,0x92,0x64,0x92,0x43,0x8A,0x43,0x8A,0x64,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x84,0x9A,0xA4,0x9A,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0xE5,0xAA,0xC4,0xA2,0xC5,0xAA,0xA5,0xA2,0xC4,0xA2,
-	0xC5,0xA2,0xC4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x92,0x43,0x92,0x43,0x8A,0x64,0x92,0x23,0x8A,0x03,0x82,0x03,0x82,0x44,0x8A,0x03,0x82,0x03,0x82,0xE3,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x79,0x03,0x82,0xE3,0x81,0xA2,0x69,0x62,0x61,0x82,0x69,0xC2,0x71,0xC2,0x71,0xA2,0x69,
-	0xA2,0x71,0xC2,0x71,0x82,0x69,0xC2,0x71,0xA2,0x71,0xC2,0x71,0x03,0x82,0x44,0x8A,0x43,0x8A,0x64,0x8A,0x2D,0xED,0xA4,0xEB,0xE6,0xEB,0x03,0xDB,0xE3,0xD2,0x03,0xE3,0xE4,0xE2,0xE4,0xE2,0x03,0xE3,0xE4,0xE2,0xC3,0xDA,0x22,0xEB,0xA4,0xF3,0xE4,0xFB,0x25,0xFC,0xE4,0xF3,0x83,0xEB,0xC4,0xFB,0xE4,0xFB,0x46,0xFC,0x86,0xFC,0xE8,0xFC,
-	0x08,0xFD,0xC7,0xFC,0x87,0xFC,0x05,0xFC,0xE5,0xFB,0x84,0xEB,0x03,0xDB,0xE2,0xD2,0xE3,0xD2,0xE3,0xCA,0x03,0xD3,0x85,0xEB,0x64,0xEB,0x64,0xEB,0x63,0xEB,0x63,0xF3,0x83,0xF3,0x23,0xEB,0xE3,0xDA,0x23,0xE3,0xE2,0xE2,0xA3,0xD2,0xC2,0xDA,0xE3,0xDA,0xA3,0xD2,0xA3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0x83,0xC2,0x64,0xC2,0x83,0xCA,
-	0x84,0xC2,0x64,0xBA,0x84,0xCA,0x64,0xC2,0x64,0xBA,0x84,0xC2,0x44,0xB2,0x24,0x9A,0x24,0x9A,0x24,0xA2,0x24,0x9A,0x24,0x92,0x24,0x92,0x25,0x9A,0x24,0x9A,0x45,0xAA,0x85,0xBA,0x45,0xB2,0x65,0xB2,0x45,0xA2,0x25,0x9A,0x05,0x92,0x04,0x82,0x03,0x82,0x03,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x8A,0x03,0x82,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x71,0xC2,0x71,0xC3,0x71,0x03,0x82,0x03,0x82,0x23,0x82,0x43,0x8A,0x63,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x92,0x84,0x92,0x84,0x9A,0xA4,0x9A,0xA4,0xA2,0xA4,0xA2,0xA4,0xA2,0xA5,0xA2,0xA4,0xA2,
-	0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x84,0xA2,0xA5,0xA2,0xA4,0xA2,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x84,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x23,0x8A,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x79,0xE2,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xC3,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x71,0x82,0x61,0x62,0x59,0x62,0x61,0x82,0x61,0x82,0x69,0xA2,0x69,
-	0x82,0x61,0x82,0x61,0x62,0x59,0x62,0x59,0x82,0x61,0xA2,0x69,0xE3,0x79,0x23,0x8A,0x23,0x8A,0x23,0x8A,0xAB,0xE4,0xA5,0xEB,0x64,0xEB,0xE3,0xD2,0xE3,0xD2,0x03,0xDB,0xE3,0xE2,0xC3,0xDA,0xC4,0xDA,0x23,0xEB,0xE3,0xE2,0x23,0xEB,0x62,0xF3,0x87,0xFC,0xA7,0xFC,0x08,0xFD,0xE6,0xF3,0xA4,0xF3,0x66,0xFC,0x08,0xFD,0xA7,0xFC,0xA7,0xFC,
-	0xE8,0xFC,0x87,0xFC,0x08,0xFD,0x87,0xF4,0xA8,0xF4,0xC6,0xEB,0x85,0xE3,0x64,0xE3,0x24,0xDB,0x44,0xDB,0xA6,0xDB,0x26,0xF4,0x25,0xFC,0x83,0xEB,0x63,0xEB,0x64,0xF3,0x02,0xE3,0xE2,0xDA,0xA2,0xDA,0xE3,0xDA,0xA2,0xDA,0xA2,0xDA,0xA3,0xD2,0xA3,0xDA,0xA3,0xD2,0xA3,0xDA,0xA3,0xDA,0xC3,0xD2,0xA3,0xD2,0x83,0xCA,0x64,0xC2,0x83,0xCA,
-	0x64,0xC2,0x44,0xBA,0x64,0xBA,0x64,0xBA,0x64,0xBA,0x84,0xCA,0x44,0xB2,0x24,0xA2,0x44,0xAA,0x24,0xA2,0x24,0x92,0x24,0x92,0x24,0x9A,0x25,0x9A,0x25,0x9A,0x25,0x9A,0x85,0xBA,0x45,0xA2,0x45,0xB2,0x05,0x92,0x05,0x82,0x04,0x8A,0xE4,0x79,0xC2,0x79,0x03,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0x03,0x82,0x03,0x82,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x69,0xC3,0x69,0xC2,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xE2,0x79,0xC2,0x79,0x03,0x82,0x43,0x8A,0x64,0x92,0x64,0x92,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x43,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x84,0x92,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x9A,0x84,0x9A,0xA4,0x9A,0xA4,0xA2,0x84,0x9A,0x84,0x9A,0xA4,0x9A,
-	0x84,0xA2,0xA4,0xA2,0xA4,0x9A,0x84,0x9A,0xA5,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x63,0x92,0x43,0x8A,0x03,0x82,0x23,0x8A,0x03,0x82,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xC2,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xA2,0x71,0x82,0x61,0x42,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,
-	0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0xA2,0x71,0xC3,0x71,0x03,0x82,0x03,0x82,0x43,0x8A,0x8B,0xCC,0xE5,0xF3,0x63,0xEB,0xE3,0xDA,0x02,0xDB,0xE2,0xD2,0xA3,0xD2,0xC3,0xD2,0xA4,0xD2,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,0x83,0xF3,0x66,0xFC,0x28,0xFD,0x6A,0xFD,0xA7,0xFC,0x05,0xFC,0x66,0xFC,0x46,0xFC,0x05,0xFC,0x06,0xEC,
-	0xA7,0xFC,0x45,0xFC,0x66,0xFC,0xC6,0xE3,0x85,0xE3,0xE7,0xEB,0x85,0xEB,0x44,0xE3,0x24,0xDB,0xE3,0xCA,0x04,0xD3,0x85,0xEB,0x44,0xEB,0x24,0xEB,0x43,0xE3,0x44,0xEB,0xC2,0xDA,0xA2,0xDA,0xC2,0xDA,0xA2,0xDA,0xC3,0xDA,0xC3,0xDA,0xC3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0xE3,0xE2,0xA3,0xD2,0x82,0xC2,0x64,0xC2,0x64,0xC2,0x64,0xC2,
-	0x64,0xBA,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x84,0xC2,0x64,0xC2,0x44,0xB2,0x44,0xAA,0x24,0xAA,0x24,0x92,0x04,0x92,0x04,0x92,0x04,0x92,0x05,0x92,0x05,0x8A,0x25,0x9A,0x25,0xA2,0x25,0xA2,0x25,0x92,0x05,0x82,0x05,0x82,0x44,0x8A,0xE4,0x79,0xA2,0x71,0xE3,0x81,0x03,0x8A,0x03,0x8A,0x03,0x82,0x03,0x82,0x03,0x8A,0x23,0x8A,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x69,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC3,0x71,0xE3,0x79,0x23,0x82,0x44,0x8A,0x43,0x8A,0x23,0x82,0x03,0x82,0x44,0x8A,0x64,0x92,0x43,0x92,0x64,0x92,0x64,0x9A,0x64,0x9A,0x64,0x92,0x84,0x9A,0x84,0x9A,0x84,0x92,0xA4,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x9A,0x84,0x9A,
-	0x84,0x9A,0xA4,0xA2,0xA4,0x9A,0x84,0x9A,0x84,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x92,0x64,0x92,0x43,0x92,0x43,0x92,0x44,0x8A,0x23,0x8A,0x23,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xC2,0x79,0xC2,0x71,0xC2,0x71,0xE3,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xA2,0x71,0x82,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,
-	0x62,0x61,0x62,0x59,0x41,0x51,0x21,0x51,0x82,0x61,0xA2,0x69,0xA2,0x71,0xA2,0x71,0xE2,0x79,0xE3,0x81,0x68,0x93,0x89,0xF4,0x43,0xEB,0x43,0xE3,0x02,0xE3,0xA2,0xDA,0xC3,0xD2,0xC2,0xDA,0xC2,0xDA,0xA3,0xD2,0xA3,0xD2,0xE2,0xDA,0x63,0xF3,0x87,0xFC,0xC8,0xFC,0x29,0xFD,0x87,0xF4,0xE4,0xF3,0x25,0xFC,0x04,0xFC,0xA5,0xEB,0x45,0xF4,
-	0xC6,0xF3,0xE5,0xF3,0xC6,0xEB,0xA6,0xE3,0x04,0xDB,0x64,0xE3,0xC5,0xF3,0xC6,0xEB,0x65,0xE3,0xC3,0xCA,0x63,0xBA,0xC3,0xCA,0xC4,0xD2,0x04,0xDB,0x03,0xE3,0x43,0xEB,0x24,0xEB,0x03,0xE3,0xE3,0xDA,0xC2,0xDA,0xA2,0xD2,0xA2,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xDA,0xC3,0xDA,0x83,0xCA,0x83,0xCA,0x83,0xCA,0x64,0xC2,0x83,0xCA,0x64,0xC2,
-	0x44,0xBA,0x24,0xAA,0x44,0xAA,0x44,0xB2,0x84,0xCA,0x64,0xB2,0x24,0xA2,0x24,0xA2,0x24,0x9A,0x04,0x92,0x04,0x8A,0x24,0x9A,0x05,0x92,0x05,0x82,0x05,0x82,0x05,0x92,0x05,0x92,0x05,0x92,0xE5,0x89,0xE5,0x79,0xE5,0x79,0x05,0x8A,0xE4,0x79,0xC2,0x79,0xC2,0x79,0x03,0x82,0x03,0x8A,0x02,0x82,0x03,0x82,0x03,0x82,0xE2,0x81,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xA2,0x71,0xA2,0x69,0xC3,0x71,0x03,0x82,0xE3,0x79,0xE3,0x79,0x23,0x82,0x44,0x8A,0x44,0x8A,0x43,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x84,0x92,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x84,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,
-	0x84,0x9A,0x84,0x9A,0xA4,0xA2,0x84,0x9A,0x64,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x23,0x82,0xE3,0x79,0xC2,0x79,0x03,0x82,0x23,0x8A,0x03,0x82,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0x03,0x82,0xE3,0x79,0xA2,0x71,0x82,0x61,0x62,0x59,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,
-	0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x82,0x61,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xC2,0x79,0xC5,0x92,0xC9,0xEC,0x42,0xF3,0x22,0xEB,0x23,0xE3,0xE2,0xDA,0xC3,0xDA,0xC2,0xD2,0xA3,0xDA,0xA3,0xD2,0x83,0xCA,0xC3,0xD2,0x83,0xF3,0xC4,0xF3,0x46,0xFC,0xC7,0xFC,0xE8,0xFC,0x83,0xF3,0x45,0xFC,0x05,0xFC,0x45,0xF4,0x46,0xF4,
-	0x66,0xFC,0xE5,0xF3,0x64,0xEB,0x03,0xDB,0x44,0xE3,0x44,0xE3,0xC6,0xEB,0x85,0xEB,0x64,0xEB,0x24,0xDB,0x63,0xB2,0x43,0xAA,0x43,0xB2,0x63,0xBA,0xC4,0xD2,0xE4,0xE2,0xE4,0xDA,0xE3,0xDA,0xC3,0xDA,0xC3,0xDA,0xA3,0xDA,0xA3,0xDA,0xA3,0xD2,0xC3,0xDA,0xC3,0xDA,0x83,0xCA,0x62,0xBA,0x64,0xC2,0x64,0xC2,0x83,0xD2,0x64,0xCA,0x64,0xCA,
-	0x44,0xB2,0x24,0xA2,0x24,0xA2,0x44,0xAA,0x44,0xB2,0x24,0xA2,0x24,0x9A,0x24,0x9A,0x04,0x8A,0x05,0x82,0x05,0x82,0x04,0x82,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0x05,0x92,0xE5,0x81,0xE5,0x79,0xE5,0x71,0xC5,0x69,0xE5,0x79,0xE2,0x79,0xC2,0x79,0xE2,0x81,0xE2,0x81,0x03,0x82,0xE2,0x81,0xE3,0x81,0xC2,0x79,0xE2,0x81,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x82,0x61,0x42,0x59,0x62,0x59,0xA2,0x61,0xA2,0x71,0xA3,0x71,0x82,0x69,0xA2,0x69,0x82,0x69,0xC3,0x71,0xE3,0x79,0xE2,0x79,0x03,0x82,0x23,0x8A,0x03,0x82,0x23,0x8A,0x44,0x8A,0x43,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,
-	0x64,0x92,0x64,0x92,0xA4,0x9A,0x64,0x9A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x43,0x8A,0x44,0x8A,0x03,0x82,0xC2,0x79,0xE3,0x79,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xE3,0x79,0x03,0x82,0xC2,0x71,0x82,0x69,0x62,0x61,0x62,0x61,0x62,0x59,0x42,0x59,0x41,0x51,0x41,0x51,
-	0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x62,0x59,0x82,0x61,0xA2,0x69,0xA2,0x69,0x44,0x82,0x6B,0xE5,0x27,0xF4,0x62,0xF3,0x22,0xEB,0x02,0xE3,0xE2,0xDA,0xC2,0xDA,0xA3,0xDA,0xC3,0xDA,0xA2,0xD2,0xE2,0xE2,0xE2,0xDA,0x63,0xEB,0xA4,0xF3,0x63,0xEB,0x87,0xFC,0xA4,0xF3,0xC4,0xF3,0x83,0xEB,0x83,0xEB,0x64,0xEB,
-	0xA5,0xEB,0xC4,0xF3,0x64,0xE3,0x03,0xD3,0x44,0xDB,0x85,0xE3,0x65,0xEB,0x85,0xEB,0x85,0xEB,0x64,0xE3,0x63,0xB2,0x43,0xAA,0x24,0xA2,0x83,0xB2,0xC4,0xD2,0xC3,0xCA,0x63,0xB2,0xA4,0xCA,0xE4,0xDA,0xC3,0xD2,0xC3,0xDA,0xA2,0xD2,0xC3,0xDA,0xE4,0xDA,0xA3,0xD2,0x83,0xD2,0x44,0xB2,0x44,0xBA,0x64,0xC2,0x64,0xCA,0x84,0xCA,0x64,0xC2,
-	0x44,0xAA,0x24,0xA2,0x44,0xB2,0x44,0xB2,0x24,0xA2,0x24,0xA2,0x24,0x9A,0x04,0x92,0x03,0x82,0x04,0x82,0x05,0x82,0x04,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x71,0xE5,0x71,0x05,0x8A,0xE5,0x69,0xC4,0x61,0xC4,0x61,0xA4,0x61,0xE4,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x81,0xE2,0x81,0x03,0x82,0x03,0x82,0xE3,0x81,0xC2,0x79,0xE2,0x79,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x42,0x51,0x42,0x51,0x21,0x51,0x62,0x59,0xA2,0x69,0x82,0x61,0x62,0x61,0x82,0x61,0xA2,0x69,0xA3,0x69,0xC3,0x71,0xC2,0x71,0xC3,0x71,0x03,0x82,0x23,0x82,0x03,0x82,0x03,0x82,0x23,0x82,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,
-	0x84,0x92,0x84,0x9A,0x84,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x82,0xE3,0x79,0xE2,0x79,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0x03,0x82,0xE3,0x79,0xE3,0x79,0xC2,0x71,0xA2,0x69,0xA2,0x71,0xC3,0x71,0xC2,0x71,0x82,0x69,0x82,0x61,0x62,0x61,0x62,0x59,0x21,0x51,0x42,0x51,0x42,0x51,
-	0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x42,0x59,0x82,0x61,0xE3,0x69,0x6C,0xDD,0xA9,0xFC,0xE4,0xF3,0x02,0xE3,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xE2,0xDA,0xA2,0xDA,0xC3,0xDA,0xC2,0xDA,0xC1,0xD2,0xA3,0xEB,0xE4,0xF3,0xE4,0xFB,0xC4,0xFB,0xC4,0xFB,0x63,0xF3,0x42,0xEB,0x43,0xE3,
-	0x05,0xFC,0xE4,0xF3,0x23,0xE3,0x23,0xDB,0xE3,0xD2,0x44,0xE3,0x24,0xDB,0x44,0xE3,0x85,0xEB,0x44,0xE3,0x44,0xDB,0x83,0xC2,0x83,0xB2,0x43,0xB2,0x43,0xB2,0x43,0xB2,0x43,0xB2,0x83,0xC2,0xE4,0xDA,0xE3,0xD2,0xC3,0xDA,0xA3,0xDA,0xA3,0xD2,0x83,0xD2,0x63,0xC2,0x64,0xC2,0x64,0xBA,0x64,0xC2,0x64,0xCA,0x64,0xCA,0x84,0xCA,0x44,0xB2,
-	0x24,0xA2,0x44,0xAA,0x44,0xB2,0x44,0xB2,0x24,0x9A,0x24,0x9A,0x24,0x9A,0x04,0x92,0x05,0x82,0x04,0x82,0xE5,0x79,0xE4,0x81,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xC5,0x69,0xC5,0x61,0xC3,0x61,0xC5,0x61,0xE3,0x79,0xE2,0x79,0xE2,0x81,0xE3,0x81,0xE2,0x81,0x03,0x82,0x03,0x82,0xE3,0x81,0xE2,0x79,0xE2,0x79,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x01,0x49,0x22,0x49,0x21,0x49,0x41,0x51,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x59,0x82,0x59,0x82,0x61,0xA2,0x69,0xE3,0x71,0xE3,0x79,0xE3,0x79,0xE2,0x79,0xE3,0x79,0xE3,0x79,0xE2,0x79,0x23,0x82,0x44,0x8A,0x23,0x8A,0x03,0x82,0x44,0x8A,0x23,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x44,0x8A,0x64,0x92,0x64,0x8A,
-	0x44,0x92,0x44,0x92,0x23,0x8A,0x44,0x8A,0x64,0x92,0x64,0x92,0x64,0x92,0x44,0x8A,0x23,0x8A,0x23,0x82,0xE3,0x79,0xC2,0x79,0xE3,0x79,0x03,0x82,0x03,0x82,0xE3,0x81,0xE3,0x79,0xE3,0x79,0xE2,0x79,0xC2,0x71,0xC2,0x71,0xA3,0x69,0x82,0x69,0x82,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0x82,0x61,0x62,0x59,0x42,0x51,0x41,0x51,0x21,0x51,
-	0x21,0x51,0x41,0x51,0x41,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x59,0x62,0x59,0xE9,0xA3,0xEC,0xFD,0xA7,0xFC,0x63,0xEB,0x02,0xE3,0x43,0xEB,0x02,0xE3,0xE2,0xDA,0xC2,0xDA,0xA2,0xDA,0xE2,0xDA,0xA2,0xD2,0xC1,0xDA,0xE1,0xDA,0x63,0xF3,0x21,0xEB,0x22,0xEB,0x42,0xF3,0xA3,0xF3,0x83,0xF3,0xE4,0xF3,
-	0x22,0xE3,0x63,0xEB,0xC4,0xF3,0x02,0xE3,0xC2,0xD2,0x03,0xDB,0xE2,0xD2,0xA2,0xCA,0xE2,0xD2,0xE3,0xD2,0x65,0xE3,0x44,0xE3,0x43,0xB2,0x23,0x9A,0x63,0xB2,0x63,0xBA,0x64,0xB2,0x84,0xC2,0xA3,0xD2,0xC3,0xDA,0xE4,0xE2,0xA3,0xDA,0x63,0xC2,0x63,0xCA,0x64,0xC2,0x64,0xC2,0x64,0xBA,0x64,0xCA,0xA4,0xD2,0x84,0xD2,0x64,0xBA,0x44,0xAA,
-	0x24,0xA2,0x24,0xA2,0x44,0xB2,0x44,0xAA,0x04,0x92,0x24,0xA2,0x05,0x92,0x05,0x82,0xE5,0x79,0xE5,0x79,0x04,0x7A,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xC5,0x71,0xC5,0x61,0xA4,0x61,0xC5,0x61,0xC5,0x61,0x03,0x82,0x03,0x82,0x03,0x82,0xE2,0x81,0xE2,0x81,0xE3,0x79,0xC2,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x79,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x62,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0xA2,0x69,0xC3,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC3,0x71,0xC2,0x71,0xE3,0x79,0x03,0x82,0xE3,0x79,0xE3,0x81,0x03,0x82,0x23,0x8A,0x23,0x82,0x03,0x82,0x23,0x82,0x44,0x8A,0x44,0x8A,0x23,0x8A,
-	0x23,0x8A,0x23,0x82,0x03,0x82,0x23,0x82,0x23,0x8A,0x43,0x8A,0x44,0x8A,0x23,0x8A,0x23,0x8A,0x03,0x82,0xE3,0x81,0xE3,0x81,0xE3,0x79,0xE3,0x81,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,
-	0x21,0x51,0x42,0x51,0x41,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x66,0x72,0x2D,0xFE,0xCB,0xFD,0x66,0xFC,0x22,0xEB,0xE2,0xE2,0xC2,0xDA,0xA2,0xDA,0xA2,0xDA,0xC2,0xDA,0xE2,0xE2,0xC2,0xD2,0xC1,0xDA,0xE1,0xDA,0xE2,0xDA,0x21,0xEB,0x02,0xE3,0x02,0xE3,0x42,0xEB,0x63,0xEB,0x63,0xEB,
-	0x83,0xF3,0x05,0xFC,0x46,0xF4,0x02,0xDB,0x82,0xCA,0xA2,0xD2,0xA2,0xD2,0xA2,0xCA,0x82,0xC2,0x82,0xCA,0xC3,0xC2,0x24,0xDB,0x63,0xBA,0x23,0x9A,0x23,0xA2,0x03,0x92,0x23,0x9A,0xA4,0xD2,0xC3,0xDA,0xC3,0xDA,0xA3,0xDA,0xA3,0xD2,0x63,0xC2,0xA3,0xD2,0x83,0xD2,0x63,0xC2,0x64,0xC2,0x64,0xCA,0xC4,0xDA,0xA3,0xDA,0x44,0xBA,0x24,0xA2,
-	0x44,0xAA,0x24,0xA2,0x44,0xAA,0x44,0xAA,0x04,0x92,0x04,0x8A,0x04,0x8A,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE4,0x71,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xC5,0x61,0xC5,0x61,0xA4,0x61,0xA4,0x61,0xA4,0x59,0x03,0x82,0x03,0x8A,0x03,0x8A,0xE3,0x81,0xE3,0x81,0xC2,0x79,0xC2,0x79,0xA2,0x71,0xA2,0x71,0xC2,0x79,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x01,0x49,0x22,0x49,0x01,0x49,0x21,0x49,0x21,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x42,0x51,0x62,0x51,0x62,0x59,0x82,0x61,0xA3,0x69,0xA2,0x69,0xA3,0x71,0xA2,0x71,0xC3,0x71,0xC2,0x71,0xC3,0x71,0xE3,0x71,0xC3,0x71,0xE3,0x79,0x23,0x82,0x23,0x82,0xE3,0x79,0xE3,0x79,0x03,0x82,0x23,0x82,0x23,0x82,0xE3,0x79,
-	0xE3,0x79,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC3,0x79,0xE3,0x79,0xE3,0x81,0x23,0x82,0x23,0x82,0xE3,0x79,0xE3,0x79,0xE3,0x79,0xE3,0x79,0x03,0x82,0xE3,0x79,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xA3,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x42,0x59,0x42,0x51,0x42,0x51,0x21,0x51,
-	0x21,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x61,0x8F,0xE5,0xED,0xF5,0x08,0xF5,0xE5,0xF3,0x22,0xEB,0xA2,0xD2,0xA2,0xD2,0x82,0xCA,0xA2,0xDA,0xE2,0xE2,0xC2,0xDA,0xC1,0xDA,0xA2,0xD2,0xA2,0xCA,0x63,0xEB,0x22,0xDB,0xC1,0xDA,0x22,0xEB,0x63,0xF3,0x42,0xEB,
-	0x62,0xEB,0x87,0xFC,0x66,0xF4,0xE2,0xDA,0xA2,0xCA,0xA2,0xD2,0x82,0xCA,0x82,0xCA,0x82,0xBA,0x03,0xD3,0x63,0xCA,0xA3,0xBA,0x63,0xB2,0x43,0xB2,0x23,0xAA,0x03,0x92,0x03,0x92,0xA4,0xCA,0xC3,0xDA,0xC3,0xDA,0xC3,0xDA,0xA3,0xDA,0x83,0xD2,0x84,0xD2,0xA3,0xDA,0x83,0xD2,0x44,0xBA,0x83,0xCA,0x64,0xC2,0x64,0xC2,0x44,0xB2,0x44,0xAA,
-	0x25,0xA2,0x24,0xA2,0x64,0xB2,0x24,0x9A,0x05,0x8A,0x05,0x8A,0xE5,0x79,0xE5,0x79,0xE4,0x79,0xE4,0x81,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xC5,0x61,0xA4,0x61,0xC5,0x61,0x84,0x49,0xA4,0x69,0x03,0x82,0xE3,0x79,0xE2,0x79,0xE2,0x79,0xC2,0x79,0xC2,0x79,0xC2,0x71,0xA2,0x71,0x82,0x69,0xA2,0x71,0x00,0x00,
-	0x00,0x00,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x21,0x49,0x21,0x51,0x21,0x51,0x22,0x49,0x21,0x49,0x22,0x51,0x42,0x51,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x69,0xA2,0x69,0xA2,0x71,0xA2,0x69,0xA2,0x69,0xC2,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xC3,0x71,0xE3,0x79,0xC3,0x71,0xC3,0x71,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xC3,0x71,
-	0xC2,0x71,0xC3,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0xC2,0x69,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x79,0xE3,0x79,0xC2,0x79,0xE3,0x79,0xE3,0x79,0xC2,0x71,0xC2,0x71,0xA2,0x71,0xC3,0x71,0xC3,0x71,0xC2,0x71,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x51,0x41,0x51,
-	0x21,0x51,0x21,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x61,0x61,0x28,0x8B,0x2E,0xF6,0xAA,0xFD,0x49,0xFD,0xA3,0xF3,0xE2,0xDA,0x82,0xC2,0x82,0xCA,0xA2,0xD2,0xC2,0xDA,0xA2,0xDA,0xA1,0xD2,0xC2,0xDA,0xA2,0xCA,0x23,0xE3,0x02,0xE3,0x02,0xDB,0x02,0xE3,0x42,0xEB,0x63,0xEB,
-	0xA4,0xF3,0x05,0xF4,0x25,0xFC,0x63,0xE3,0xC2,0xD2,0xA2,0xC2,0x82,0xC2,0xC2,0xD2,0xC3,0xD2,0xC3,0xD2,0x82,0xCA,0x62,0xB2,0x62,0xB2,0x43,0xAA,0x03,0x92,0x23,0xAA,0x03,0x92,0x23,0xAA,0x83,0xCA,0x83,0xD2,0xA3,0xDA,0xA3,0xDA,0x62,0xCA,0xA4,0xD2,0xE4,0xE2,0xA4,0xD2,0xA4,0xD2,0x64,0xC2,0x64,0xCA,0x44,0xBA,0x44,0xAA,0x44,0xAA,
-	0x44,0xAA,0x44,0xAA,0x25,0xA2,0x05,0x8A,0x05,0x82,0xE5,0x79,0xE5,0x79,0x03,0x82,0xE5,0x79,0xE5,0x69,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xC5,0x69,0x84,0x59,0xA5,0x59,0xC5,0x59,0x84,0x49,0xE3,0x79,0xE3,0x81,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x71,0xA2,0x69,0x82,0x69,0xA2,0x71,0xA2,0x71,
-	0x00,0x00,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0xA2,0x61,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0xC3,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x71,0xC2,0x71,0xA2,0x69,0xC2,0x71,0xC2,0x71,0xC3,0x71,0xA3,0x71,0xA2,0x69,
-	0x82,0x69,0x82,0x61,0xA2,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0xC3,0x71,0xE3,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x79,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xA3,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,
-	0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x44,0x72,0xCD,0xED,0xCB,0xFD,0xCB,0xFD,0x66,0xF4,0x22,0xEB,0xA1,0xD2,0xA1,0xD2,0x82,0xD2,0xC2,0xD2,0xE2,0xDA,0xC1,0xD2,0xC2,0xD2,0xE2,0xD2,0x02,0xDB,0xE2,0xD2,0xA3,0xF3,0x62,0xEB,0x02,0xE3,0x42,0xE3,
-	0x43,0xEB,0x43,0xEB,0x43,0xEB,0x43,0xE3,0xC3,0xD2,0xC2,0xD2,0x23,0xE3,0x83,0xEB,0x82,0xC2,0x82,0xC2,0xA2,0xCA,0x82,0xCA,0x62,0xB2,0x23,0xA2,0x03,0x92,0x23,0xA2,0x03,0x92,0x23,0xA2,0x43,0xBA,0x43,0xB2,0x63,0xC2,0xA2,0xDA,0x82,0xCA,0xA3,0xD2,0xC4,0xDA,0xA3,0xDA,0x83,0xD2,0xA4,0xD2,0x64,0xCA,0x64,0xBA,0x44,0xB2,0x44,0xAA,
-	0x24,0xA2,0x24,0xA2,0x05,0x92,0x05,0x92,0x05,0x8A,0x05,0x82,0x05,0x82,0xE5,0x89,0xE5,0x71,0xE5,0x71,0xE5,0x69,0xE5,0x69,0xE5,0x71,0xE5,0x79,0xC5,0x69,0xA4,0x51,0xC5,0x61,0xA5,0x59,0x84,0x49,0x84,0x59,0xA2,0x71,0xC2,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x71,0x82,0x69,0x82,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0x82,0x69,
-	0x00,0x00,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x62,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xC2,0x69,0xC2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x71,0xA2,0x69,0xC3,0x69,0xC3,0x71,0xA3,0x71,0xA2,0x69,0xA2,0x69,
-	0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC3,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xC2,0x71,0xA2,0x71,0xA2,0x69,0xA3,0x69,0xA2,0x69,0x82,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,
-	0x82,0x61,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0x82,0x69,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x8A,0xBC,0x0C,0xFE,0xCB,0xFD,0x08,0xFD,0x62,0xEB,0xC1,0xDA,0xC1,0xDA,0x81,0xCA,0x82,0xD2,0x42,0xEB,0x21,0xEB,0xE2,0xE2,0x22,0xE3,0x02,0xE3,0x02,0xE3,0x22,0xEB,0x63,0xEB,0x02,0xE3,0x02,0xE3,
-	0x23,0xEB,0x02,0xDB,0x02,0xDB,0x43,0xE3,0x03,0xE3,0x23,0xDB,0x84,0xF3,0x05,0xFC,0xA2,0xD2,0x82,0xC2,0x63,0xC2,0x82,0xC2,0x62,0xBA,0x23,0x9A,0x23,0x92,0x23,0x92,0x03,0x92,0x03,0x8A,0x23,0x9A,0x23,0xA2,0x63,0xC2,0xA2,0xDA,0xC3,0xDA,0xC3,0xDA,0xE4,0xE2,0xC4,0xDA,0xA4,0xD2,0x84,0xCA,0x64,0xCA,0x64,0xBA,0x44,0xAA,0x44,0xAA,
-	0x44,0xAA,0x04,0x9A,0x05,0x92,0x05,0x92,0x05,0x8A,0x05,0x82,0xE5,0x81,0xE5,0x71,0xE5,0x69,0xE5,0x69,0xE5,0x79,0xE5,0x71,0xE5,0x71,0xE5,0x69,0xC5,0x61,0xA4,0x61,0xA5,0x59,0xA5,0x51,0x64,0x41,0xA3,0x69,0xA2,0x71,0xC2,0x71,0xC2,0x71,0xA2,0x71,0x82,0x69,0x82,0x69,0xA2,0x71,0x82,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0x82,0x69,
-	0x00,0x00,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x21,0x49,0x22,0x49,0x22,0x49,0x21,0x49,0x22,0x49,0x21,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x61,0x82,0x61,0xA2,0x69,0x82,0x61,0xA2,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0xA3,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,
-	0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0xA2,0x71,0xA2,0x71,0xA3,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x71,0xC3,0x71,0xA3,0x71,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0xA3,0x61,0x0D,0xF6,0xEB,0xFD,0x49,0xFD,0xE4,0xF3,0x42,0xEB,0xC1,0xDA,0xA1,0xD2,0x81,0xCA,0xE1,0xDA,0x42,0xEB,0x02,0xE3,0x02,0xEB,0x02,0xE3,0x02,0xE3,0x22,0xEB,0x22,0xEB,0x42,0xEB,0x02,0xE3,
-	0x02,0xDB,0xE2,0xDA,0xC2,0xD2,0xC2,0xCA,0xC2,0xCA,0x03,0xDB,0x85,0xEB,0xC4,0xF3,0xE3,0xDA,0x82,0xCA,0x63,0xC2,0x82,0xCA,0x63,0xBA,0x43,0xAA,0x22,0xAA,0x03,0x8A,0x03,0x8A,0x03,0x8A,0xE3,0x81,0x03,0x92,0x43,0xB2,0xA3,0xDA,0xE4,0xE2,0x84,0xD2,0xA3,0xDA,0xA3,0xD2,0x84,0xCA,0x84,0xD2,0x64,0xCA,0x44,0xB2,0x44,0xB2,0x44,0xB2,
-	0x24,0xA2,0x05,0x92,0x05,0x82,0x05,0x8A,0x05,0x8A,0x05,0x82,0x05,0x82,0xE5,0x69,0xE5,0x69,0xE5,0x79,0xE5,0x71,0xE5,0x71,0xE5,0x69,0xC5,0x61,0xC5,0x59,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x84,0x49,0x82,0x69,0xA2,0x69,0xA2,0x71,0xA2,0x71,0x82,0x69,0x82,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0x82,0x61,0x82,0x61,
-	0x00,0x00,0xE1,0x40,0xE1,0x40,0x01,0x49,0x22,0x49,0x21,0x49,0x22,0x49,0x22,0x49,0x21,0x49,0x22,0x49,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x61,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,
-	0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,
-	0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0x62,0x61,0x62,0x61,0x62,0x59,0x67,0x9B,0xCB,0xFD,0xAA,0xFD,0xC7,0xFC,0x25,0xF4,0x83,0xEB,0xA1,0xD2,0xA1,0xD2,0xA1,0xDA,0xC1,0xDA,0x02,0xE3,0x22,0xEB,0x22,0xEB,0x22,0xEB,0x02,0xE3,0xE4,0xF3,0x46,0xF4,0x43,0xE3,
-	0x23,0xE3,0x03,0xDB,0xE2,0xDA,0xC2,0xCA,0xE3,0xD2,0x83,0xC2,0x03,0xD3,0x64,0xEB,0xE3,0xD2,0x24,0xDB,0x43,0xEB,0xA3,0xD2,0x62,0xB2,0x23,0xA2,0x23,0xA2,0x03,0x8A,0x03,0x8A,0x03,0x8A,0x04,0x8A,0x44,0xAA,0x63,0xC2,0xC3,0xDA,0xE4,0xE2,0xA4,0xD2,0xE4,0xE2,0xC4,0xDA,0x64,0xC2,0x64,0xC2,0x44,0xBA,0x64,0xBA,0x24,0xA2,0x24,0xA2,
-	0x04,0x92,0x05,0x92,0x05,0x92,0x25,0x9A,0xE5,0x79,0xE5,0x71,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x84,0x41,0x83,0x61,0x82,0x69,0x82,0x69,0xA2,0x71,0xA2,0x71,0x82,0x69,0x82,0x69,0x82,0x69,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0x82,0x61,0x61,0x61,
-	0x00,0x00,0xE1,0x40,0x01,0x49,0x01,0x49,0x21,0x49,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x59,0x82,0x61,0x62,0x61,0x82,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0xA2,0x69,0xA2,0x69,
-	0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA3,0x69,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,
-	0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x69,0x82,0x61,0xA2,0x69,0x82,0x61,0xA2,0x69,0xA2,0x69,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x03,0x6A,0x6A,0xED,0xE8,0xFC,0xE8,0xFC,0x66,0xF4,0x66,0xFC,0xA4,0xF3,0x02,0xE3,0xE2,0xDA,0xE2,0xDA,0xC1,0xDA,0x22,0xEB,0x42,0xF3,0x22,0xE3,0x43,0xEB,0xA4,0xEB,0xA7,0xFC,0x47,0xEC,
-	0xC5,0xEB,0xC5,0xF3,0x85,0xEB,0x03,0xDB,0x65,0xDB,0x24,0xD3,0x45,0xE3,0x84,0xEB,0x24,0xEB,0xC3,0xDA,0xE3,0xD2,0x82,0xCA,0x44,0xBA,0x23,0x9A,0x03,0x8A,0x03,0x8A,0x23,0x92,0x03,0x92,0x63,0xBA,0x82,0xCA,0xA3,0xDA,0xE4,0xE2,0xE4,0xDA,0x04,0xE3,0x45,0xEB,0x84,0xD2,0x64,0xC2,0x64,0xC2,0x44,0xBA,0x44,0xB2,0x44,0xAA,0x24,0xA2,
-	0x24,0x9A,0x05,0x92,0x05,0x8A,0xE5,0x89,0xE5,0x79,0xE5,0x69,0xE5,0x71,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x59,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x84,0x51,0x82,0x69,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x71,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x61,0x62,0x61,
-	0x00,0x00,0xE1,0x40,0xE1,0x40,0x01,0x49,0x22,0x49,0x22,0x49,0x22,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0x62,0x59,0x82,0x59,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x61,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x71,0xA2,0x69,0xC3,0x69,0xA2,0x69,0x82,0x69,0xA2,0x69,0xA3,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,
-	0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0xA2,0x69,0xA2,0x69,0xA2,0x69,0xA2,0x69,0x82,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x46,0x93,0x49,0xFD,0x08,0xFD,0x42,0xEB,0xE8,0xF4,0xA7,0xFC,0xE4,0xF3,0x83,0xF3,0x42,0xF3,0x42,0xEB,0xC4,0xF3,0x42,0xF3,0xA4,0xF3,0x25,0xFC,0x05,0xFC,0x66,0xFC,0x08,0xFD,
-	0x87,0xF4,0x43,0xE3,0x85,0xE3,0x24,0xDB,0x24,0xCB,0xA6,0xEB,0x65,0xEB,0x44,0xE3,0x03,0xDB,0xC2,0xD2,0xE3,0xDA,0x82,0xCA,0x62,0xBA,0x43,0xB2,0x03,0x8A,0x03,0x92,0x23,0xAA,0x44,0xAA,0x23,0xA2,0x83,0xD2,0xC3,0xDA,0xE4,0xE2,0x04,0xE3,0x24,0xE3,0xE4,0xE2,0xC4,0xDA,0x64,0xCA,0x64,0xC2,0x64,0xBA,0x44,0xB2,0x24,0xA2,0x25,0xA2,
-	0x05,0x9A,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x71,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x83,0x59,0x82,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0xC2,0x71,0xA2,0x71,0x82,0x69,0xA2,0x69,0x82,0x69,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x82,0x61,
-	0x00,0x00,0x05,0x62,0x25,0x62,0x25,0x6A,0x46,0x6A,0x46,0x6A,0x46,0x6A,0x46,0x6A,0x46,0x6A,0x66,0x6A,0x66,0x6A,0x66,0x72,0x66,0x72,0x66,0x72,0x86,0x72,0x86,0x72,0x66,0x7A,0x66,0x7A,0x86,0x7A,0x86,0x72,0x86,0x72,0x86,0x72,0x86,0x72,0x66,0x72,0x86,0x72,0x86,0x72,0x86,0x7A,0x86,0x7A,0x86,0x7A,0x86,0x7A,0xA6,0x7A,0x86,0x7A,
-	0x86,0x7A,0x86,0x7A,0x86,0x7A,0x86,0x7A,0x86,0x7A,0x86,0x7A,0x86,0x7A,0x86,0x7A,0xA6,0x82,0xA7,0x82,0xA6,0x82,0xC7,0x82,0xC7,0x82,0xA6,0x82,0xA6,0x7A,0xA7,0x82,0xA6,0x82,0xA6,0x82,0xA7,0x82,0xA6,0x82,0xA6,0x82,0x86,0x82,0xA6,0x82,0xA6,0x7A,0xA6,0x7A,0x86,0x7A,0x86,0x7A,0x66,0x7A,0x45,0x72,0x24,0x6A,0xC3,0x69,0x82,0x61,
-	0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x42,0x51,0x41,0x51,0x42,0x51,0x89,0xC4,0x49,0xFD,0x25,0xF4,0x26,0xF4,0x28,0xFD,0x87,0xFC,0x46,0xFC,0x63,0xEB,0x62,0xF3,0x87,0xFC,0x45,0xFC,0xC4,0xFB,0x66,0xFC,0x87,0xFC,0xA7,0xFC,0x68,0xF4,
-	0x86,0xFC,0x46,0xFC,0xC2,0xD2,0xE3,0xD2,0x24,0xDB,0xE6,0xEB,0xC6,0xEB,0x03,0xDB,0xE3,0xD2,0x83,0xC2,0xA3,0xCA,0xA3,0xD2,0x83,0xCA,0x64,0xBA,0x44,0xAA,0x24,0xAA,0x64,0xC2,0x63,0xCA,0x64,0xC2,0xC4,0xDA,0xC3,0xDA,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xC4,0xDA,0xA4,0xD2,0x84,0xD2,0x64,0xC2,0x44,0xBA,0x44,0xAA,0x24,0x9A,0x25,0x9A,
-	0x25,0x9A,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x71,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x63,0x49,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0xA2,0x69,0x82,0x69,0x82,0x69,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,
-	0x00,0x00,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,
-	0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0xA6,0x39,0x27,0x4A,0xEA,0x62,0xAC,0x83,0x4E,0xA4,
-	0x29,0x83,0xE3,0x71,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x59,0x82,0x59,0x62,0x59,0x62,0x59,0x21,0x51,0x21,0x51,0xE3,0x61,0x29,0xE5,0x08,0xF5,0xC7,0xF4,0xE8,0xFC,0xE8,0xFC,0xC8,0xFC,0xA7,0xFC,0x04,0xF4,0x05,0xFC,0x86,0xFC,0x25,0xFC,0x66,0xFC,0x66,0xFC,0xA7,0xFC,0x08,0xFD,
-	0xA7,0xFC,0xC5,0xEB,0xA2,0xCA,0xA3,0xCA,0xC3,0xC2,0xE3,0xCA,0x65,0xEB,0x24,0xE3,0xE4,0xD2,0x04,0xD3,0x44,0xBA,0x63,0xBA,0x83,0xC2,0xE4,0xDA,0xC4,0xCA,0xC4,0xD2,0xE4,0xD2,0xC3,0xDA,0xA4,0xD2,0xA3,0xDA,0xE3,0xE2,0xE4,0xE2,0xE4,0xE2,0xC4,0xDA,0xA4,0xD2,0x84,0xD2,0x64,0xCA,0x64,0xC2,0x44,0xB2,0x44,0xAA,0x24,0x9A,0x25,0x9A,
-	0x05,0x8A,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x71,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xA5,0x59,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x51,0x84,0x51,0x82,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0xA2,0x69,0x82,0x69,0x82,0x69,0x82,0x69,0x82,0x61,0x62,0x61,0x82,0x61,0x82,0x69,0x82,0x61,0x61,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x07,0x42,0xCD,0x8B,0xCC,0x8B,0x86,0x72,0xA3,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0xE7,0x8A,0x8A,0xF5,0x49,0xFD,0xE8,0xFC,0x28,0xFD,0x49,0xFD,0xCB,0xFD,0x49,0xFD,0xE8,0xFC,0x08,0xFD,0x05,0xFC,0x66,0xFC,0xA7,0xFC,0xE8,0xFC,0x29,0xFD,
-	0x84,0xEB,0xE2,0xDA,0xC2,0xD2,0xA2,0xD2,0xA3,0xCA,0x82,0xBA,0xA2,0xBA,0xA3,0xCA,0xC4,0xCA,0x45,0xDB,0xC4,0xCA,0x64,0xC2,0xA4,0xCA,0xA4,0xD2,0x04,0xE3,0x45,0xE3,0x65,0xDB,0x24,0xDB,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0xC4,0xDA,0x84,0xCA,0x64,0xCA,0x64,0xC2,0x64,0xBA,0x44,0xB2,0x44,0xA2,0x24,0xA2,0x25,0xA2,0x05,0x92,
-	0x05,0x92,0x05,0x82,0x05,0x82,0xE5,0x71,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xA5,0x59,0xA5,0x59,0xA5,0x59,0xA5,0x51,0xA5,0x51,0xA4,0x59,0x83,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x82,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x18,0x06,0x4A,0x0E,0x94,0xC8,0x7A,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x51,0x22,0x51,0x46,0x9B,0x49,0xFD,0x49,0xFD,0x49,0xFD,0x28,0xFD,0x49,0xFD,0xAA,0xFD,0x49,0xFD,0xE8,0xFC,0xC7,0xFC,0xA7,0xFC,0xC8,0xFC,0x69,0xFD,0x69,0xFD,
-	0x05,0xF4,0x02,0xE3,0xE2,0xDA,0xC2,0xD2,0xA3,0xCA,0x83,0xCA,0xA2,0xC2,0x03,0xDB,0x45,0xDB,0x45,0xD3,0xC4,0xBA,0xC4,0xCA,0x03,0xE3,0x64,0xBA,0x84,0xBA,0x24,0xD3,0xE4,0xCA,0xC4,0xDA,0x04,0xDB,0xA4,0xD2,0xA4,0xD2,0xC4,0xDA,0xA4,0xD2,0x64,0xB2,0x45,0xAA,0x44,0xB2,0x45,0xAA,0x44,0xAA,0x24,0xA2,0x25,0xA2,0x05,0x9A,0x05,0x92,
-	0x05,0x8A,0xE5,0x79,0xE5,0x79,0xE5,0x69,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xA5,0x59,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xA5,0x59,0xA5,0x59,0x84,0x61,0xA2,0x69,0x82,0x61,0x61,0x61,0x62,0x61,0x82,0x61,0x82,0x61,0x82,0x61,0x61,0x61,0x82,0x61,0x62,0x61,0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x61,0x62,0x59,0x62,0x59,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x0A,0x6B,0x6B,0x83,0xE4,0x61,0x62,0x59,0x41,0x51,0x62,0x59,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x42,0x51,0x48,0xC4,0x8A,0xFD,0x69,0xFD,0x49,0xFD,0x28,0xFD,0x49,0xFD,0x49,0xFD,0x28,0xFD,0x28,0xFD,0xC8,0xFC,0x28,0xFD,0xE8,0xFC,0x49,0xFD,
-	0x45,0xF4,0x63,0xEB,0x23,0xE3,0x23,0xDB,0xC2,0xD2,0xC2,0xCA,0xA3,0xCA,0x83,0xD2,0x24,0xD3,0xA6,0xEB,0x84,0xBA,0x44,0xB2,0x64,0xBA,0x44,0xB2,0x64,0xBA,0xA4,0xCA,0xA4,0xD2,0xA4,0xD2,0x84,0xCA,0xA4,0xD2,0xA3,0xDA,0x84,0xD2,0x44,0xBA,0x84,0xC2,0x85,0xBA,0x25,0xA2,0x44,0xAA,0x24,0xA2,0x25,0xA2,0x25,0xA2,0x25,0x9A,0x05,0x92,
-	0x05,0x8A,0xE5,0x79,0xE5,0x71,0xE5,0x69,0xA4,0x61,0xC5,0x61,0xA4,0x61,0xA4,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x51,0xC5,0x61,0xC5,0x61,0x83,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x82,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x59,0x41,0x51,0x42,0x51,0x41,0x51,0x62,0x59,0x62,0x59,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xCC,0x83,0xC8,0x7A,0x41,0x51,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x49,0x21,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x62,0x51,0x47,0xBC,0xCB,0xFD,0xAA,0xFD,0xE8,0xFC,0x69,0xFD,0xAA,0xFD,0xAA,0xFD,0x49,0xFD,0x28,0xFD,0x28,0xFD,0xE8,0xFC,0x49,0xFD,
-	0x29,0xFD,0xA7,0xFC,0x63,0xEB,0x63,0xEB,0xE3,0xE2,0xA2,0xD2,0xE3,0xDA,0xE3,0xDA,0x04,0xE3,0x44,0xEB,0xA4,0xC2,0x44,0xB2,0x83,0xBA,0xA3,0xCA,0xC4,0xD2,0xC4,0xDA,0xC4,0xDA,0xA4,0xCA,0x84,0xD2,0xA4,0xD2,0x83,0xD2,0x84,0xD2,0x44,0xB2,0x64,0xBA,0x45,0xAA,0x25,0xA2,0x24,0xA2,0x25,0xA2,0x25,0xA2,0x05,0x9A,0x05,0x82,0x05,0x82,
-	0x05,0x8A,0xE5,0x71,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x59,0xA5,0x59,0xA4,0x61,0xA4,0x61,0x83,0x61,0x62,0x61,0x62,0x61,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x61,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x41,0x51,0x41,0x51,0x21,0x51,0x21,0x51,0x41,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x4B,0x7B,0xE8,0x7A,0x42,0x51,0x22,0x49,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x49,0x22,0x49,0x22,0x49,0x01,0x49,0x62,0x51,0x88,0xC4,0x69,0xFD,0x69,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0xCB,0xFD,0x69,0xFD,0x69,0xFD,0x69,0xFD,0x49,0xFD,
-	0xC7,0xFC,0xA7,0xFC,0x25,0xF4,0x63,0xEB,0xC4,0xF3,0x44,0xEB,0x02,0xE3,0x44,0xE3,0x04,0xE3,0x44,0xEB,0x44,0xE3,0x83,0xC2,0x83,0xCA,0xA3,0xD2,0x83,0xD2,0xA3,0xD2,0xA4,0xD2,0x64,0xC2,0x83,0xCA,0x64,0xCA,0x64,0xCA,0x64,0xCA,0x64,0xBA,0x44,0xAA,0x44,0xAA,0x45,0xAA,0x25,0xA2,0x05,0x9A,0x05,0x8A,0x05,0x92,0x05,0x8A,0xE5,0x79,
-	0xE5,0x79,0xE5,0x71,0xE5,0x69,0xC5,0x69,0xC5,0x61,0xC5,0x61,0xA5,0x51,0xA5,0x51,0xA5,0x59,0xA5,0x51,0xA5,0x51,0x84,0x59,0x42,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x21,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xCA,0x5A,0xAC,0x93,0x22,0x51,0x21,0x51,0x21,0x49,0x21,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x62,0x51,0x68,0xBC,0xCB,0xFD,0xCB,0xFD,0x2D,0xFE,0x2D,0xFE,0x2D,0xFE,0x2D,0xFE,0xCB,0xFD,0xCB,0xFD,0x69,0xFD,
-	0x8A,0xFD,0x28,0xFD,0xA7,0xFC,0xA7,0xFC,0x66,0xFC,0xE5,0xF3,0xE4,0xF3,0x84,0xF3,0x63,0xEB,0x24,0xEB,0x23,0xE3,0xE3,0xD2,0xC3,0xDA,0xC3,0xDA,0x63,0xC2,0x64,0xBA,0x44,0xB2,0x84,0xC2,0x64,0xC2,0x44,0xBA,0x44,0xBA,0x44,0xB2,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x24,0xA2,0x24,0xA2,0x05,0x92,0x05,0x8A,0x05,0x82,0xE5,0x79,0xE5,0x79,
-	0xE5,0x71,0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x59,0xA5,0x51,0xA5,0x59,0xA5,0x59,0x84,0x51,0x22,0x51,0x22,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x42,0x51,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x42,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x5A,0xE8,0x7A,0x22,0x51,0x21,0x51,0x22,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x42,0x51,0x6A,0xB4,0x2D,0xFE,0xEB,0xFD,0x2D,0xFE,0x4E,0xFE,0x4E,0xFE,0xEB,0xFD,0xAA,0xFD,0x49,0xFD,
-	0x49,0xFD,0xAA,0xFD,0x28,0xFD,0xE8,0xFC,0xC8,0xFC,0x66,0xFC,0x84,0xF3,0x84,0xEB,0x44,0xE3,0x23,0xE3,0x04,0xE3,0xE3,0xDA,0xC3,0xDA,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0xA3,0xD2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x44,0xB2,0x24,0xAA,0x24,0x9A,0x44,0xAA,0x04,0x9A,0x24,0xA2,0x24,0x9A,0x05,0x8A,0xE5,0x81,0xE5,0x79,0xE5,0x79,0xE5,0x69,
-	0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x59,0x84,0x51,0x22,0x49,0x21,0x49,0x21,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x41,0x51,0x21,0x51,0x21,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x4B,0x7B,0xA8,0x72,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x21,0x49,0x27,0x83,0xED,0xF5,0xCB,0xFD,0xEB,0xFD,0x4E,0xFE,0x2D,0xFE,0xAA,0xFD,0x49,0xFD,
-	0x28,0xFD,0x28,0xFD,0x49,0xFD,0x49,0xFD,0xC7,0xFC,0x25,0xFC,0xC4,0xF3,0x23,0xE3,0xA3,0xD2,0xC3,0xD2,0xE3,0xDA,0xE4,0xE2,0xC3,0xDA,0xC3,0xDA,0xA3,0xD2,0x64,0xC2,0x63,0xBA,0x44,0xB2,0x24,0xA2,0x24,0xA2,0x24,0xA2,0x24,0x9A,0x24,0x9A,0x44,0xAA,0x05,0x92,0x05,0x92,0x04,0x92,0x05,0x82,0xE5,0x79,0x05,0x82,0xE5,0x79,0xE5,0x69,
-	0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xC5,0x61,0xA5,0x59,0x43,0x49,0x42,0x51,0x21,0x51,0x21,0x51,0x42,0x51,0x62,0x59,0x62,0x59,0x62,0x59,0x62,0x59,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x49,0x21,0x49,0x21,0x49,0x21,0x51,0x21,0x49,0x21,0x49,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xCC,0x83,0xC4,0x59,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xA6,0x82,0x6C,0xDD,0xCB,0xFD,0xAA,0xFD,0x49,0xFD,0x49,0xFD,0x49,0xFD,
-	0x28,0xFD,0xE8,0xFC,0xA7,0xFC,0x86,0xFC,0x45,0xFC,0x05,0xFC,0x45,0xFC,0x84,0xF3,0x43,0xEB,0xE3,0xE2,0xE3,0xE2,0xC3,0xDA,0xC3,0xDA,0xA3,0xD2,0x83,0xCA,0x63,0xCA,0x44,0xBA,0x44,0xB2,0x24,0xA2,0x24,0x9A,0x04,0x92,0x24,0x9A,0x04,0x9A,0x24,0x9A,0x05,0x82,0x05,0x8A,0x05,0x82,0x05,0x92,0xE5,0x79,0xE5,0x89,0xE5,0x79,0xE5,0x79,
-	0xE5,0x69,0xE5,0x69,0xC5,0x61,0xC5,0x61,0xE5,0x69,0xC5,0x61,0xA4,0x59,0x23,0x49,0x22,0x51,0x21,0x49,0x21,0x51,0x22,0x51,0x62,0x51,0x62,0x51,0x42,0x51,0x42,0x51,0x21,0x51,0x21,0x51,0x21,0x49,0x21,0x49,0x21,0x51,0x21,0x51,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x21,0x49,0x01,0x49,0x01,0x49,0x21,0x49,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4B,0x7B,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0x83,0x49,0x2A,0xB4,0x0C,0xFE,0x49,0xFD,0x49,0xFD,0x49,0xFD,
-	0xC8,0xFC,0xE8,0xFC,0x87,0xFC,0xA7,0xFC,0x66,0xFC,0x25,0xFC,0xA4,0xEB,0x43,0xEB,0x43,0xEB,0x23,0xEB,0x02,0xE3,0x83,0xCA,0x83,0xCA,0xA3,0xCA,0x64,0xBA,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x24,0xA2,0x24,0x9A,0x04,0x8A,0x04,0x8A,0x04,0x92,0x24,0x92,0xE4,0x81,0xE4,0x81,0xE5,0x79,0xE5,0x79,0x05,0x8A,0x05,0x82,0xE5,0x79,0xE5,0x79,
-	0xE5,0x69,0xE5,0x69,0xC5,0x61,0xE5,0x71,0xC5,0x71,0x63,0x51,0x22,0x49,0x22,0x49,0x22,0x49,0x22,0x49,0x21,0x49,0x22,0x49,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x51,0x21,0x49,0x21,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x6B,0xA7,0x6A,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x38,0xE1,0x40,0xA6,0x72,0xC9,0xCC,0x69,0xFD,0x29,0xFD,
-	0x28,0xFD,0xC8,0xFC,0x66,0xFC,0xA7,0xFC,0x87,0xFC,0xE4,0xF3,0x84,0xF3,0x43,0xEB,0x23,0xEB,0xE4,0xE2,0xC3,0xDA,0xA3,0xD2,0x44,0xBA,0x44,0xB2,0x44,0xAA,0x24,0xA2,0x24,0xA2,0x24,0x9A,0x24,0x9A,0x24,0x92,0x04,0x92,0x04,0x8A,0x04,0x8A,0x05,0x8A,0x05,0x8A,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x71,
-	0xE5,0x71,0xE5,0x69,0xC5,0x61,0xA4,0x61,0x42,0x39,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xAB,0x8B,0x22,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x38,0xE1,0x40,0xE1,0x40,0x22,0x49,0x85,0x7A,0xC8,0xE4,
-	0x49,0xFD,0xE8,0xFC,0xA7,0xFC,0x66,0xFC,0x05,0xFC,0x05,0xFC,0xC4,0xF3,0x03,0xE3,0x83,0xCA,0xC3,0xD2,0xC3,0xD2,0x83,0xCA,0x83,0xC2,0x44,0xAA,0x24,0xA2,0x24,0x9A,0x24,0x92,0x24,0x9A,0x24,0x9A,0x24,0x92,0x05,0x92,0x03,0x8A,0x05,0x82,0x05,0x82,0x05,0x82,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x71,0xE5,0x69,0xE5,0x69,0xE5,0x71,
-	0xE5,0x69,0x84,0x49,0x22,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xE1,0x40,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x4A,0x05,0x62,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x38,0x22,0x39,
-	0x05,0xAB,0x47,0xD4,0xA8,0xF4,0xC8,0xFC,0x66,0xFC,0x05,0xFC,0xA4,0xF3,0x64,0xF3,0x03,0xE3,0xC3,0xDA,0xC2,0xDA,0xA2,0xDA,0x83,0xCA,0x43,0xB2,0x44,0xAA,0x24,0x9A,0x03,0x82,0x04,0x82,0x04,0x82,0x04,0x8A,0x24,0x9A,0x04,0x92,0x04,0x82,0x04,0x8A,0xE3,0x81,0xE5,0x79,0xE5,0x79,0xE5,0x79,0xE5,0x71,0xE5,0x69,0xC4,0x69,0xA4,0x61,
-	0x22,0x49,0xE1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0x01,0x49,0x01,0x49,0x01,0x49,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xB6,0xB5,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x48,0x42,0x49,0x4A,0x49,0x4A,0x49,0x4A,0x49,0x4A,0x49,0x4A,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x4A,0x7B,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x38,0xE1,0x38,
-	0xE1,0x38,0x21,0x49,0xE3,0x69,0xC5,0x9A,0x06,0xE4,0x45,0xFC,0xC4,0xF3,0x63,0xF3,0x23,0xEB,0xE2,0xE2,0xA2,0xDA,0xA2,0xD2,0x83,0xCA,0x83,0xCA,0x44,0xBA,0x24,0xAA,0x24,0xAA,0x23,0xA2,0x43,0xA2,0x24,0xA2,0x24,0x9A,0x04,0x92,0x04,0x92,0x04,0x92,0x05,0x8A,0x05,0x8A,0x05,0x82,0xE5,0x79,0xC4,0x69,0x23,0x49,0x02,0x41,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x4C,0x63,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x91,0x8C,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x8B,0x42,0x49,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0x01,0x41,0xC2,0x71,0x84,0xA2,0x03,0xCB,0x43,0xDB,0x43,0xEB,0xE3,0xE2,0xA2,0xDA,0xA3,0xD2,0x63,0xC2,0x43,0xB2,0x44,0xB2,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x44,0xAA,0x24,0xA2,0x24,0x9A,0x04,0x92,0x04,0x92,0xE4,0x89,0xC4,0x79,0x82,0x59,0x02,0x39,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xE1,0x40,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x54,0xA5,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xCE,0x04,0x21,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x42,0xE8,0x72,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,
-	0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x38,0xE2,0x38,0x22,0x51,0x62,0x61,0x62,0x61,0x82,0x69,0xE2,0x89,0x23,0x9A,0x43,0xAA,0x62,0xB2,0x43,0xB2,0x43,0xAA,0x23,0x9A,0xE2,0x89,0xA3,0x71,0x42,0x51,0x22,0x51,0x22,0x49,0x01,0x41,0xE1,0x38,0xE2,0x38,0xE2,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x30,
-	0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x40,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x21,0xF3,0x9C,0xF3,0x9C,0x59,0xCE,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x14,0xA5,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x1B,0xDF,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x94,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0x5C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x2E,0x9C,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xE1,0x38,0xE2,0x38,0xE2,0x38,0xE1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xE2,0x38,0xE2,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xE1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xC1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xBE,0xF7,0xFF,0xFF,0x5C,0xE7,0x8D,0x6B,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x8C,0x04,0x21,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xE3,0x18,0x49,0x4A,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0x2C,0x63,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x7B,0x22,0x39,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x38,0xC1,0x38,0xC1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,
-	0xA0,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x0B,0x5B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x0C,0x63,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xCE,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x24,0x21,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x6A,0x63,0x41,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,
-	0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x30,0xC1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,
-	0xA0,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xC1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xC1,0x30,0xC1,0x30,0xA0,0x30,0xC1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x28,0xA0,0x30,0xA0,0x28,0xA0,0x30,0xA0,0x30,0xA0,0x28,0xA0,0x30,0xA0,0x28,0xA0,0x30,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x3A,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0x0F,0x7C,0x20,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0xCF,0x7B,0xCF,0x7B,0x8E,0x73,0xC3,0x18,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x4A,0xA4,0x49,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,
-	0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA0,0x28,0xA0,0x28,0xA1,0x28,0xA1,0x30,0xA0,0x28,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x28,0x80,0x28,0xA0,0x28,0xA1,0x28,0xA0,0x30,
-	0xA0,0x28,0xA0,0x28,0xA0,0x30,0xA0,0x28,0xA0,0x28,0xA1,0x28,0xA0,0x30,0xA0,0x30,0xA0,0x28,0xA0,0x28,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA1,0x30,0xA0,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x28,0xA0,0x28,0x80,0x28,0xA0,0x28,0xA0,0x28,0xA0,0x28,0xA0,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x30,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFB,0xDE,0xFF,0xFF,0xDE,0xF7,0x34,0xA5,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x39,0xC4,0x51,0x80,0x28,0x80,0x28,0xA0,0x28,0xA0,0x28,0xA1,0x28,0xA1,0x30,0xA0,0x30,0xA1,0x30,0xA0,0x30,0xA1,0x28,0xA1,0x30,0xA1,0x30,0xA0,0x28,0xA0,0x30,
-	0xA0,0x28,0xA0,0x28,0xA1,0x30,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0xA0,0x28,0xA1,0x28,0xA1,0x28,0xA0,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA0,0x28,0xA1,0x28,0xA0,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0xA0,0x28,0xA1,0x28,0xA1,0x28,
-	0xA1,0x28,0xA0,0x28,0xA1,0x28,0xA0,0x28,0xA0,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA0,0x30,0xA0,0x28,0xA1,0x30,0xA1,0x30,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA0,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xA2,0x10,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0x99,0xCE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x34,0xA5,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x31,0xC5,0x51,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0xA0,0x28,0xA1,0x28,0xA0,0x28,0xA0,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0xA0,0x28,
-	0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,
-	0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0x9D,0xEF,0x9D,0xEF,0x5C,0xE7,0x86,0x31,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x31,0xC5,0x51,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,
-	0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0xA1,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,
-	0x80,0x28,0x80,0x20,0x80,0x28,0x80,0x20,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x91,0x8C,0xDE,0xF7,0xFF,0xFF,0x3C,0xE7,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0xA6,0x31,0x86,0x31,0x41,0x08,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xA4,0x49,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x28,0x80,0x28,0x80,0x28,0xA1,0x28,0x80,0x20,0x80,0x28,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xEB,0x5A,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xA6,0x31,0xA6,0x31,
-	0xA6,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0x81,0x08,0x48,0x42,0x49,0x4A,0x49,0x4A,
-	0x49,0x4A,0x49,0x4A,0x49,0x4A,0x49,0x4A,0x49,0x4A,0xAA,0x52,0x51,0x8C,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x42,0x64,0x41,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x80,0x20,
-	0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x80,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0xA1,0x20,0x03,0x29,0x64,0x39,0x84,0x49,0xC4,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xA5,0x49,0xA5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,
-	0xC5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xA5,0x49,0xA5,0x49,0xA5,0x49,0xA5,0x49,0xA5,0x49,0xA5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xC5,0x49,0xA5,0x49,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x49,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x49,0xA5,0x49,0xA5,0x49,0xA5,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x9D,0xEF,
-	0x9D,0xEF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x6A,0x23,0x39,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x80,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,
-	0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x18,0x02,0x39,0x4A,0x7B,0x4F,0x9C,0x0B,0x6B,0x88,0x52,0xE6,0x39,0x85,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,
-	0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x7B,0xE1,0x28,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x20,0x60,0x18,0x60,0x18,
-	0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0xA1,0x28,0xA5,0x41,0x2A,0x7B,0xAD,0x83,0x64,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x13,0x9D,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0x50,0x84,0x50,0x84,
-	0x50,0x84,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x0E,0x94,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,
-	0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x60,0x18,0x43,0x39,0xCD,0x8B,0x06,0x52,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xB6,0xB5,0xB6,0xB5,0x75,0xAD,0x24,0x21,0x00,0x00,0x00,0x00,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x42,0xAC,0x8B,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,
-	0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0xA5,0x41,0x88,0x5A,0xCD,0x83,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0xCE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x92,0x94,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0x10,0x84,0x38,0xC6,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0xAA,0x52,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,
-	0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0x51,0x8C,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x8B,0x27,0x52,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,
-	0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0xA9,0x5A,0x32,0xBD,0x27,0x4A,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xCA,0x52,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x18,0x2E,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0x90,0x9C,0xE6,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xBA,0xD6,0xFB,0xDE,0xFB,0xDE,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0x63,0xFB,0xDE,0xFB,0xDE,0xBA,0xD6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x3A,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xCF,0x7B,0x41,0x08,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x4A,0xC6,0x39,0x00,0x00,0x00,0x00,0x04,0x21,0x4D,0x6B,0x00,0x00,0xE7,0x39,0xF3,0x9C,0xC3,0x18,0x04,0x21,0x95,0xAD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,
-	0xD3,0x9C,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x4F,0x94,0x85,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x41,0x00,0x9B,0x00,0x9B,0x00,0x9B,0x00,0x9B,
-	0x00,0x9B,0xA0,0x8A,0x80,0x18,0xE0,0x92,0x00,0x9B,0x00,0x9B,0x00,0x9B,0xC0,0x8A,0x00,0x31,0x00,0x00,0x20,0x08,0x80,0x82,0x40,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0xF3,0x9C,0xF3,0x9C,0xD2,0x94,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x2C,0x63,0x34,0xA5,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x55,0xAD,0x10,0x84,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,
-	0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x96,0xB5,0x30,0x84,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0xED,0x8B,0x81,0x10,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x17,0xBE,0x8E,0x73,0x61,0x08,0x82,0x10,0x69,0x4A,0xB6,0xB5,0xE3,0x18,0x00,0x00,0x00,0x00,0x6D,0x6B,0x6D,0x6B,0xF7,0xBD,0x24,0x21,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xED,0x83,0x47,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0xE0,0xF4,0xA0,0xE4,0x80,0xE4,0x80,0xE4,
-	0x80,0xE4,0xE0,0xC3,0x00,0x31,0xC0,0xEC,0xA0,0xEC,0x80,0xE4,0x80,0xE4,0xC0,0xF4,0xC0,0xEC,0x40,0x41,0x60,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x6B,0x48,0x4A,0x00,0x00,0x9D,0xEF,0x0C,0x63,0x0C,0x63,0xAE,0x73,0x79,0xCE,0x8E,0x73,0x00,0x00,0x0C,0x63,0xDE,0xF7,0x8E,0x73,0x00,0x00,0x00,0x00,0x28,0x42,0x17,0xBE,0x7D,0xEF,0x65,0x29,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x39,0xC9,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0xC0,0xF4,0xA0,0x51,0xC0,0x28,0xC0,0x28,
-	0xC0,0x28,0xA0,0x20,0x00,0x31,0xC0,0xEC,0xA0,0x8A,0xC0,0x28,0xC0,0x28,0x60,0x49,0x00,0xFD,0x60,0xAB,0x60,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xCD,0x83,0x00,0x00,0x00,0x00,0x7D,0xEF,0x65,0x29,0x65,0x29,0x71,0x8C,0x48,0x42,0x17,0xBE,0x00,0x00,0x0C,0x63,0xDE,0xF7,0x5C,0xE7,0x82,0x10,0x00,0x00,0x89,0x4A,0x1B,0xDF,0x7D,0xEF,0x65,0x29,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x4F,0x94,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0xC0,0xEC,0x00,0x31,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x31,0xC0,0xEC,0x40,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE4,0x80,0xB3,0x60,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xCD,0x83,0x03,0x21,0x00,0x00,0x00,0x00,0x7D,0xEF,0x65,0x29,0xE3,0x18,0xCB,0x5A,0x30,0x84,0x55,0xAD,0x00,0x00,0x0C,0x63,0x3C,0xE7,0x3C,0xE7,0x71,0x8C,0x00,0x00,0x51,0x8C,0x96,0xB5,0x7D,0xEF,0x65,0x29,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x7B,0x07,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0xE0,0xF4,0x80,0xAB,0x00,0x9B,0x00,0x9B,
-	0x00,0x9B,0x00,0x6A,0x00,0x31,0xC0,0xEC,0xE0,0x9A,0x60,0x49,0x80,0x49,0xC0,0x8A,0xE0,0xF4,0x00,0x6A,0x60,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x6B,0x7B,0x89,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x18,0xED,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0xE0,0xF4,0xA0,0xE4,0x80,0xE4,0x80,0xE4,
-	0x80,0xE4,0x20,0xA3,0x00,0x31,0xC0,0xEC,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x00,0xFD,0x60,0xDC,0xA0,0x20,0x60,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x62,0xA9,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x07,0x42,0xC6,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0xC0,0xF4,0xA0,0x51,0xC0,0x28,0xC0,0x28,
-	0xC0,0x28,0x60,0x18,0x00,0x31,0xC0,0xEC,0x00,0x9B,0x40,0x39,0x80,0x49,0x80,0xB3,0xE0,0xF4,0x00,0x62,0x60,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x89,0x52,0xCD,0x83,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xED,0x8B,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0xC0,0xEC,0x00,0x31,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x31,0xC0,0xEC,0x40,0x7A,0x00,0x00,0x00,0x00,0x40,0x10,0xC0,0xF4,0xE0,0x92,0x60,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x6B,0x7B,0x4B,0x73,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x81,0x10,0x6F,0x9C,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x7A,0xC0,0xEC,0x00,0x31,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x31,0xC0,0xEC,0x40,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xDC,0xC0,0xBB,0x60,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4F,0x94,0x6C,0x7B,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xEA,0x62,0xA9,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x72,0xC0,0xEC,0x00,0x31,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x31,0xC0,0xEC,0x40,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xA3,0xC0,0xEC,0x80,0x18,0x20,0xD4,0xC0,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x0A,0x6B,0xB0,0xA4,0x47,0x52,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xED,0x8B,0xC6,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x18,0x20,0x39,0x40,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x08,0x20,0x39,0x80,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x18,0x40,0x39,0x20,0x08,0x00,0x31,0xE0,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x18,0x06,0x4A,0xB0,0xA4,0x4F,0x9C,0x44,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x6F,0x9C,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x07,0x42,0xCD,0x8B,0x6F,0x9C,0x4F,0x94,0xC6,0x39,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xB0,0xA4,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,
-	0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x85,0x31,0xE6,0x41,0x47,0x4A,0x4C,0x73,0x4F,0x94,0x72,0xBD,
-	0x32,0xB5,0x32,0xB5,0xC9,0x5A,0x85,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,
-	0xC6,0x39,0x11,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,
-	0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x39,0xA5,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,
-	0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,
-	0xE6,0x41,0x11,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x6F,0x9C,0xA1,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x4F,0x9C,0x85,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x2E,0x94,0x48,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0A,0x73,0x0D,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x34,0xA5,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD2,0x94,0x85,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xB2,0x94,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x55,0xAD,
-	0xCA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x55,0xAD,0xF7,0xBD,0xF7,0xBD,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x44,0x29,0x90,0xA4,0x81,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xDE,0xF7,0xFF,0xFF,0xDE,0xF7,0x9D,0xEF,0x9D,0xEF,0xDE,0xF7,0xFF,0xFF,0x5C,0xE7,0xC3,0x18,0x00,0x00,0xC3,0x18,0x99,0xCE,0xFF,0xFF,0xDE,0xF7,0x9D,0xEF,0x9D,0xEF,0xBE,0xF7,0xFF,0xFF,
-	0xBE,0xF7,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xDB,0xDE,0xBE,0xF7,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xB0,0xA4,0x44,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0x6D,0x6B,0xA6,0x31,0xA6,0x31,0x71,0x8C,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x00,0x00,0xC7,0x39,0xBE,0xF7,0xDE,0xF7,0x2C,0x63,0xA6,0x31,0xA6,0x31,0x49,0x4A,0x1B,0xDF,
-	0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x86,0x31,0x2C,0x63,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x65,0x29,0xE7,0x39,0xA6,0x31,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA6,0x31,0xE7,0x39,0x45,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x86,0x31,0xC7,0x39,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xC7,0x39,0xC7,0x39,0xE3,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x47,0x5A,0x8C,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,
-	0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0x5C,0xE7,0x5D,0xEF,0x9D,0xEF,0x75,0xAD,0x82,0x10,
-	0xA2,0x10,0x96,0xB5,0x9D,0xEF,0x5D,0xEF,0x3C,0xE7,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x4C,0x63,0x00,0x00,0x00,0x00,0x61,0x08,0x17,0xBE,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x75,0xAD,0x7D,0xEF,0x5D,0xEF,0x1B,0xDF,0x28,0x42,0x00,0x00,0x86,0x31,0xDB,0xDE,0x7D,0xEF,0x7D,0xEF,0xDB,0xDE,
-	0x86,0x31,0x00,0x00,0x00,0x00,0x95,0xAD,0x17,0xBE,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x75,0xAD,0x17,0xBE,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x18,0xB0,0xA4,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x9D,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,
-	0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xE7,0xF3,0x9C,0x00,0x00,0xEB,0x5A,0x9E,0xF7,0xA6,0x31,
-	0xA6,0x31,0x9E,0xF7,0xCB,0x5A,0x00,0x00,0x34,0xA5,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x6D,0x6B,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xDB,0xDE,0xCA,0x52,0x00,0x00,0xD7,0xBD,0x18,0xC6,0x00,0x00,0x14,0xA5,0xFB,0xDE,0x03,0x19,0x03,0x19,0xFB,0xDE,
-	0x14,0xA5,0x00,0x00,0x00,0x00,0xF7,0xBD,0xBE,0xF7,0x49,0x4A,0x00,0x00,0x00,0x00,0x85,0x29,0x5C,0xE7,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x73,0xED,0x8B,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xE7,0x39,0xDE,0xF7,0xDE,0xF7,0xF3,0x9C,0xE7,0x39,0xE7,0x39,0xCB,0x5A,0x3C,0xE7,
-	0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0x4D,0x6B,0x00,0x00,0x45,0x29,0xDE,0xF7,0xC7,0x39,
-	0xA6,0x31,0x9D,0xEF,0xCB,0x5A,0x00,0x00,0x34,0xA5,0x99,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x6D,0x6B,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0x00,0x00,0x00,0x00,0x96,0xB5,0x18,0xC6,0x00,0x00,0x96,0xB5,0x59,0xCE,0x61,0x08,0x61,0x08,0x59,0xCE,
-	0x96,0xB5,0x00,0x00,0x00,0x00,0xF7,0xBD,0x9D,0xEF,0x79,0xCE,0x00,0x00,0x00,0x00,0x51,0x8C,0x9D,0xEF,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x6F,0x9C,0xE6,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0xE3,0x18,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0x6D,0x6B,0x00,0x00,0x86,0x31,0xBE,0xF7,0xC7,0x39,
-	0x82,0x10,0xF7,0xBD,0xDE,0xF7,0x7D,0xEF,0xBE,0xF7,0x89,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x75,0xAD,0x6D,0x6B,0x6D,0x6B,0xCE,0x73,0x1B,0xDF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x9A,0xD6,0x9D,0xEF,0x69,0x4A,0x00,0x00,0x75,0xAD,0x79,0xCE,0x82,0x10,0x82,0x10,0x79,0xCE,
-	0x75,0xAD,0x00,0x00,0x00,0x00,0xF7,0xBD,0xB6,0xB5,0x3C,0xE7,0xEB,0x5A,0x04,0x21,0x5C,0xE7,0xD3,0x9C,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x29,0xD1,0xAC,0xE3,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x6D,0x6B,0xBA,0xD6,
-	0xFF,0xFF,0xDB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0x6D,0x6B,0x00,0x00,0x86,0x31,0xBE,0xF7,0xC7,0x39,
-	0x45,0x29,0x3C,0xE7,0x34,0xA5,0xCA,0x52,0xBA,0xD6,0x95,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x38,0xC6,0xF3,0x9C,0xF3,0x9C,0x34,0xA5,0x5C,0xE7,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x69,0x4A,0x9A,0xD6,0x55,0xAD,0x00,0x00,0x75,0xAD,0x79,0xCE,0x82,0x10,0x82,0x10,0x79,0xCE,
-	0x75,0xAD,0x00,0x00,0x00,0x00,0xF7,0xBD,0x91,0x8C,0xF3,0x9C,0x79,0xCE,0x96,0xB5,0xF7,0xBD,0x4D,0x6B,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x42,0xB0,0xA4,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xFF,0xFF,0x7D,0xEF,0xA2,0x10,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,
-	0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x51,0x8C,0x51,0x8C,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0x4D,0x6B,0x00,0x00,0x45,0x29,0xDE,0xF7,0xC7,0x39,
-	0xE7,0x39,0xBE,0xF7,0x00,0x00,0x00,0x00,0xCA,0x52,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x6D,0x6B,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xA6,0x31,0x00,0x00,0x00,0x00,0x4D,0x6B,0x7D,0xEF,0x00,0x00,0x96,0xB5,0x59,0xCE,0x61,0x08,0x61,0x08,0x59,0xCE,
-	0x96,0xB5,0x00,0x00,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x24,0x21,0x9D,0xEF,0xDE,0xF7,0x49,0x4A,0x0C,0x63,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x52,0xEE,0x83,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0xB6,0xB5,0xB6,0xB5,0x5C,0xE7,0xFF,0xFF,0xDE,0xF7,0xEB,0x5A,0x00,0x00,0x82,0x10,0xD2,0x94,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x59,0xCE,0xDE,0xF7,
-	0xDE,0xF7,0xF3,0x9C,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x00,0x00,0xEB,0x5A,0x9E,0xF7,0xA6,0x31,
-	0xC7,0x39,0xBE,0xF7,0x69,0x4A,0x00,0x00,0xF3,0x9C,0x5C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x6D,0x6B,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x7D,0xEF,0x69,0x4A,0x00,0x00,0x34,0xA5,0xDA,0xD6,0x00,0x00,0x14,0xA5,0xFB,0xDE,0x03,0x19,0x03,0x19,0xFB,0xDE,
-	0x14,0xA5,0x00,0x00,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x00,0x00,0x8E,0x73,0xF3,0x9C,0x00,0x00,0x0C,0x63,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x27,0x4A,0xB0,0xA4,0xE3,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x95,0xAD,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xB2,0x94,0x20,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xF7,0xBD,0x04,0x21,0x00,0x00,0x00,0x00,0x8D,0x6B,0x8D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0x9D,0xEF,0x75,0xAD,0x82,0x10,
-	0xA2,0x10,0xD6,0xB5,0x9D,0xEF,0x5D,0xEF,0x5C,0xE7,0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x6D,0x6B,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x96,0xB5,0x7D,0xEF,0x5D,0xEF,0x3C,0xE7,0xAA,0x52,0x00,0x00,0x86,0x31,0xDB,0xDE,0x7D,0xEF,0x7D,0xEF,0xDB,0xDE,
-	0x86,0x31,0x00,0x00,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x39,0x90,0x9C,0xE6,0x41,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x08,0x42,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0xC7,0x39,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x82,0x10,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xA6,0x31,0xE7,0x39,0x65,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA6,0x31,0xC7,0x39,0x45,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xC7,0x39,0xC7,0x39,0xE3,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x86,0x31,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x8C,0x7B,0x0E,0x8C,0x03,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x52,0x8F,0x9C,0x6C,0x73,0x64,0x31,0x81,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC6,0x39,0x6F,0xA4,0x90,0xA4,0xED,0x83,0x69,0x52,0x85,0x31,0xA1,0x10,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,
-	0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x6F,0x9C,0x32,0xB5,0x93,0xC5,0xF1,0xAC,0xB0,0xA4,0x6F,0x9C,0x4F,0x94,0x4F,0x94,0x4F,0x94,
-	0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,0x4F,0x94,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x18,0xCD,0x83,0x0A,0x63,0x64,0x31,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x27,0x42,0xED,0x8B,0xE2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2A,0x73,0x07,0x42,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x2A,0x73,0x27,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x42,0x07,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x18,0xED,0x8B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xCD,0x83,0xE2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x0A,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x85,0x31,0x85,0x31,0x41,0x08,0x00,0x00,0x00,0x00,0x03,0x21,0xA6,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0x41,0x64,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x10,
-	0xF7,0xBD,0x7D,0xEF,0x7D,0xEF,0x12,0xAD,0x00,0x00,0x0A,0x6B,0xFB,0xDE,0x9D,0xEF,0xBA,0xD6,0x27,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0x72,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xD6,0xB5,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x53,0xAD,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0x92,0x94,0x24,0x21,0x00,0x00,0x00,0x00,0xAE,0x73,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,
-	0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCD,0x83,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x21,0x1B,0xE7,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4B,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x34,0xA5,0x1C,0xE7,0x34,0xA5,0x34,0xA5,0x34,0xA5,
-	0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x29,0x5C,0xEF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x99,0xCE,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x8C,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8B,0x7B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_2151_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_2151_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_2151_dial_img_preview_data_0};
-
-    
\ No newline at end of file
@@ -157,9 +157,10 @@ void init_face_228(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_228_8_89898, 171);
     lv_obj_add_flag(face_228_8_89898, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_228_8_89898, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_228_0_1478);
 
 
-    callback("228", &face_228_dial_img_preview_0, &face_228, NULL);
+    callback("228", NULL, &face_228, NULL);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_228 // (228) uncomment to enable or define it elsewhere
 
@@ -64,8 +65,6 @@ extern "C"
 	LV_IMG_DECLARE(face_228_dial_img_8_89898_4);
 	LV_IMG_DECLARE(face_228_dial_img_8_89898_5);
 	LV_IMG_DECLARE(face_228_dial_img_8_89898_6);
-	LV_IMG_DECLARE(face_228_dial_img_preview_0);
-	LV_IMG_DECLARE(face_228_dial_img_preview_0);
 
 
 #endif
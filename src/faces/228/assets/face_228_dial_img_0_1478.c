@@ -5,6 +5,7 @@
 // Watchface: 228
 
 #include "../228.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,2173 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_228_dial_img_0_1478_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x41,0x49,0x3A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0xE7,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x4C,0x6B,0x65,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0x90,0x84,0x24,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x73,0xFF,0xFF,0xD2,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xEF,0x7B,0xE7,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0xEF,0x7B,0x69,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0xC2,0x10,0xD6,0xB5,0x4C,0x6B,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0x24,0x21,0x62,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x61,0x08,0xA2,0x08,0xA1,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA1,0x10,0xC2,0x10,
-	0xC2,0x10,0xA1,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x61,0x08,0xA1,0x10,0xA1,0x10,0xC2,0x10,0x24,0x21,0x24,0x21,0x65,0x31,0xE7,0x41,0xE7,0x41,
-	0xE7,0x41,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x69,0x52,0xE7,0x41,0x69,0x52,0x69,0x52,0x69,0x52,0x69,0x52,0xE7,0x41,0x69,0x52,0xE7,0x41,0xE7,0x41,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x65,0x31,0x24,0x21,0x24,0x21,0xC2,0x10,0xA1,0x10,0xA1,0x10,0x61,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0x4C,0x6B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA1,0x10,0xC2,0x10,0x24,0x21,0x65,0x31,0x65,0x31,0xE7,0x41,0xE7,0x41,0x69,0x52,0xCA,0x5A,0x2B,0x6B,0x2B,0x6B,0x4C,0x6B,0x6C,0x7B,0x8D,0x73,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0xAD,0x83,0xAD,0x83,0x8D,0x73,
-	0x4C,0x6B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x65,0x31,0x24,0x21,0xA1,0x10,0xA2,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC2,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA1,0x10,0x24,0x21,0x24,0x21,0xE7,0x41,0xE7,0x41,0x69,0x52,0xCA,0x5A,0x2B,0x6B,0x6C,0x7B,0xAD,0x83,0x0E,0x84,0x50,0x8C,0xB1,0x9C,0xF1,0xA4,0xF2,0xA4,
-	0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,0xD6,0xB5,0x93,0xBD,0xD6,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xF1,0xA4,0xB1,0x9C,0x50,0x8C,0x0E,0x84,0xAD,0x83,0x8D,0x73,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0xE7,0x41,0x65,0x31,0x24,0x21,0xC4,0x10,0xA1,0x10,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA1,0x10,0xC2,0x10,
-	0x65,0x31,0xE7,0x41,0x69,0x52,0xCA,0x5A,0x2B,0x6B,0x8D,0x73,0x0E,0x84,0x50,0x8C,0xF0,0xA4,0xF2,0xA4,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x36,0xC6,0x36,0xC6,0x36,0xC6,0x77,0xD6,0x77,0xD6,0x77,0xD6,0x77,0xD6,0xB9,0xD6,0xB9,0xD6,0xB9,0xD6,0x97,0xDE,0xF8,0xDE,0xF8,0xDE,0x77,0xD6,0xB9,0xD6,0xB9,0xD6,0x77,0xD6,0x77,0xD6,0x77,0xD6,
-	0x36,0xC6,0x36,0xC6,0x36,0xC6,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xF1,0xA4,0x70,0x94,0x0E,0x84,0x8D,0x73,0x2B,0x6B,0xCA,0x5A,0xE7,0x41,0x65,0x31,0x24,0x21,0xC2,0x10,0xA1,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x69,0x52,
-	0xC2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0x24,0x21,0x65,0x31,0x69,0x52,0xCA,0x5A,0x2B,0x6B,0x8D,0x73,0x4F,0x9C,0xB1,0x9C,0xF2,0xA4,0x33,0xB5,0x93,0xBD,0x36,0xC6,0x36,0xC6,0x77,0xD6,0x77,0xD6,0xB9,0xD6,0xF8,0xDE,0xF8,0xDE,0xF8,0xDE,
-	0xFA,0xDE,0x39,0xEF,0x5A,0xEF,0x5A,0xEF,0x39,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x39,0xEF,0x5A,0xEF,0x5A,0xEF,0x39,0xEF,0xFA,0xDE,0x39,0xEF,0xFA,0xDE,0xF8,0xDE,0xF8,0xDE,0xF8,0xDE,0xB9,0xD6,0x77,0xD6,0x77,0xD6,0x36,0xC6,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xB1,0x9C,0x0E,0x84,0xAD,0x83,0x2B,0x6B,0x69,0x52,0xE7,0x41,
-	0x65,0x31,0x24,0x21,0xA1,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0x6B,0xB9,0xD6,0x65,0x31,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0x8D,0x73,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x69,0x52,0xD2,0x9C,0x24,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0x24,0x21,0xE7,0x41,0x69,0x52,0x2B,0x6B,0x8D,0x73,
-	0x50,0x8C,0xF1,0xA4,0x33,0xB5,0xD6,0xB5,0x36,0xC6,0x77,0xD6,0x77,0xD6,0xF8,0xDE,0xF8,0xDE,0xF8,0xDE,0xFA,0xDE,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0x5A,0xEF,0xBB,0xF7,0x5A,0xEF,0xBB,0xF7,0x5C,0xEF,0xBB,0xF7,0x5C,0xEF,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xBB,0xF7,
-	0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xFA,0xDE,0xF8,0xDE,0xF8,0xDE,0xB9,0xD6,0x77,0xD6,0x36,0xC6,0x93,0xBD,0xF2,0xA4,0xB1,0x9C,0x0E,0x84,0x8D,0x73,0x2B,0x6B,0x69,0x52,0x65,0x31,0x24,0x21,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6E,0x63,0xB9,0xD6,0x65,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC2,0x10,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x0D,0x53,0xD6,0xB5,0x24,0x21,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0xC2,0x10,0x65,0x31,0xE7,0x41,0xCA,0x5A,0x6C,0x7B,0x50,0x8C,0xF1,0xA4,0x33,0xB5,0x93,0xBD,0x36,0xC6,0x77,0xD6,0xF8,0xDE,0xF8,0xDE,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x39,0xEF,0xF8,0xDE,0xB9,0xD6,0x77,0xD6,0x36,0xC6,0x93,0xBD,0xF2,0xA4,
-	0xB1,0x9C,0x0E,0x84,0x4C,0x6B,0x69,0x52,0xE7,0x41,0x24,0x21,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0xC2,0x10,0x65,0x31,0x69,0x52,0x2B,0x6B,0xAD,0x83,0xCE,0x94,0x33,0xB5,0x93,0xBD,0x36,0xC6,0x77,0xD6,
-	0xF8,0xDE,0xF8,0xDE,0x39,0xEF,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xF8,0xDE,0xB9,0xD6,0x77,0xD6,0x36,0xC6,0x93,0xBD,0xF1,0xA4,0x50,0x8C,0x6C,0x7B,0xCA,0x5A,0xE7,0x41,0x24,0x21,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xE7,0x41,
-	0xA2,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0x65,0x31,0x69,0x52,0x2B,0x6B,0x0E,0x84,0xB1,0x9C,0x33,0xB5,0x36,0xC6,0x77,0xD6,0xF8,0xDE,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x39,0xEF,
-	0xF8,0xDE,0x77,0xD6,0x36,0xC6,0x93,0xBD,0xF2,0xA4,0x50,0x8C,0x6C,0x7B,0xCA,0x5A,0xE7,0x41,0x24,0x21,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0x65,0x31,0xE7,0x41,0xCA,0x5A,0xAD,0x83,0xB1,0x9C,0x33,0xB5,0x36,0xC6,0x77,0xD6,0xF8,0xDE,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,
-	0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xF8,0xDE,0xB9,0xD6,0x36,0xC6,0x93,0xBD,0x33,0xB5,0x50,0x8C,0x8D,0x73,0xCA,0x5A,0xE7,0x41,0x24,0x21,0xA1,0x10,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x61,0x08,0x24,0x21,0xE7,0x41,0xCA,0x5A,0x8D,0x73,0xB1,0x9C,0x33,0xB5,0x36,0xC6,0x77,0xD6,0xF8,0xDE,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0x39,0xEF,0xF8,0xDE,0xB9,0xD6,0x36,0xC6,0x93,0xBD,0xF1,0xA4,0x0E,0x84,0x2B,0x6B,0x69,0x52,0x65,0x31,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0xA1,0x10,0x24,0x21,0x69,0x52,0x2B,0x6B,0x0E,0x84,0x33,0xB5,0x93,0xBD,0x77,0xD6,0xF8,0xDE,0x39,0xEF,0x5A,0xEF,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0x36,0xC6,0x33,0xB5,0xB1,0x9C,0xAD,0x83,0xCA,0x5A,0xE7,0x41,0x24,0x21,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xE7,0x41,0x69,0x52,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0x65,0x31,
-	0xCA,0x5A,0xAD,0x83,0xF1,0xA4,0x93,0xBD,0x77,0xD6,0xF8,0xDE,0x39,0xEF,0x5A,0xEF,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,
-	0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0xF8,0xDE,0xB9,0xD6,0x36,0xC6,0x33,0xB5,0xB1,0x9C,0x6C,0x7B,0x69,0x52,0x65,0x31,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x41,0x69,0x52,0x62,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA1,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x65,0x31,0x69,0x52,0x2B,0x6B,0xCE,0x94,0x33,0xB5,0x36,0xC6,0xF8,0xDE,0xF8,0xDE,0x39,0xEF,0x5A,0xEF,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0xD6,0xB5,0xF1,0xA4,0x0E,0x84,0xCA,0x5A,
-	0xE7,0x41,0x24,0x21,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x65,0x31,0xCA,0x5A,0xAD,0x83,0xF1,0xA4,
-	0x93,0xBD,0x77,0xD6,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,
-	0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x5A,0xEF,0x5A,0xEF,0xF8,0xDE,0xF8,0xDE,0x36,0xC6,0x33,0xB5,0xCE,0x94,0x4C,0x6B,0x69,0x52,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC2,0x10,0x65,0x31,0x2B,0x6B,0x0E,0x84,0x33,0xB5,0x36,0xC6,0x77,0xD6,0x39,0xEF,0x39,0xEF,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,
-	0xF0,0xA4,0x8D,0x73,0x69,0x52,0x65,0x31,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xD2,0x9C,0x50,0x8C,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0xE7,0x41,0x2B,0x6B,0x50,0x8C,0x33,0xB5,0x77,0xD6,0x97,0xDE,
-	0x39,0xEF,0x39,0xEF,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,
-	0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0xD6,0xB5,0xF1,0xA4,0xAD,0x83,0x69,0x52,0x65,0x31,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x58,0xC6,0x58,0xC6,0xA1,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0xE7,0x41,0x2B,0x6B,0x70,0x94,0x93,0xBD,0x77,0xD6,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,
-	0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x39,0xEF,
-	0xB9,0xD6,0x36,0xC6,0x33,0xB5,0x0E,0x84,0xCA,0x5A,0x65,0x31,0xC2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xB9,0xD6,0x8D,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0xE7,0x41,0x8D,0x73,0xF0,0xA4,0x36,0xC6,0x77,0xD6,0x39,0xEF,0x39,0xEF,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,
-	0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x39,0xEF,0xF8,0xDE,0x36,0xC6,0x93,0xBD,0x50,0x8C,0x2B,0x6B,0xE7,0x41,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x50,0x8C,0x69,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0x65,0x31,0x69,0x52,0xAD,0x83,0x93,0xBD,0xFA,0xDE,0xF8,0xDE,0x39,0xEF,0x39,0xEF,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,
-	0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0x7A,0xF7,0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0x50,0x8C,0x2B,0x6B,0xE7,0x41,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0x69,0x52,0xAD,0x83,0xF2,0xA4,0x77,0xD6,0xFA,0xDE,0x39,0xEF,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,
-	0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0xB1,0x9C,0x4C,0x6B,0xE7,0x41,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0x69,0x52,0xAD,0x83,0x33,0xB5,0x36,0xC6,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0x5C,0xEF,
-	0xFA,0xDE,0x5C,0xEF,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x39,0xEF,0x77,0xD6,0x93,0xBD,0xB1,0x9C,0x6C,0x7B,0xE7,0x41,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0x24,0x21,0xE7,0x41,0x8D,0x73,0xF2,0xA4,0x36,0xC6,0x97,0xDE,0x39,0xEF,0x79,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,
-	0x38,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xFD,0xFF,0xBC,0xF7,0xBC,0xF7,
-	0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0x5C,0xEF,0x5C,0xEF,0xBD,0xF7,0xBD,0xF7,0x58,0xC6,0xD7,0xB5,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0xB1,0x9C,0x2B,0x6B,0xE7,0x41,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x50,0x8C,0x0D,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x41,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x00,0xC2,0x10,0xE7,0x41,0x6C,0x7B,0xF1,0xA4,0x36,0xC6,0x97,0xDE,0x39,0xEF,0x5A,0xEF,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xFF,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0x5C,0xEF,0xFA,0xDE,0xBD,0xF7,0x58,0xC6,0x56,0x9D,0x5C,0xEF,0xFA,0xDE,0x34,0x74,
-	0xB5,0x8C,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x5C,0xEF,0x5A,0xEF,0xBC,0xF7,0x58,0xC6,0x5A,0xEF,0xBB,0xF7,0x5C,0xEF,0xB9,0xD6,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0x70,0x94,0xCA,0x5A,0x65,0x31,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x69,0x52,0xE7,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xB1,0x9C,0xE7,0x41,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xC2,0x10,0xE7,0x41,0x4C,0x6B,0xF1,0xA4,0x36,0xC6,0x97,0xDE,0x39,0xEF,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,
-	0x78,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0x58,0xC6,0xD7,0xB5,0xB5,0x8C,0x34,0x74,0x56,0x9D,0x34,0x74,0x34,0x74,0x58,0xC6,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xFA,0xDE,0xD7,0xB5,0x58,0xC6,0xB5,0x8C,0x58,0xC6,0x5C,0xEF,0x56,0x9D,0xB5,0x8C,0x58,0xC6,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x39,0xEF,0x77,0xD6,0xD6,0xB5,0xCE,0x94,0xCA,0x5A,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0xC2,0x10,0xE7,0x41,0x2B,0x6B,0xB1,0x9C,0x93,0xBD,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xD3,0x63,0x34,0x74,0xD7,0xB5,0xD7,0xB5,0xB5,0x8C,0xD7,0xB5,0x5C,0xEF,
-	0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xB5,0x8C,0xD3,0x63,0x56,0x9D,0x56,0x9D,0x56,0x9D,0x34,0x74,0xD3,0x63,0x56,0x9D,0xFA,0xDE,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x5A,0xEF,0x39,0xEF,0x77,0xD6,0x33,0xB5,0x0E,0x84,0xCA,0x5A,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x65,0x31,0x2B,0x6B,0xB1,0x9C,0x93,0xBD,0x97,0xDE,0x39,0xEF,0x5A,0xEF,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x78,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0x58,0xC6,0xCF,0x32,0xB5,0x8C,0xB5,0x8C,0x34,0x74,0x56,0x9D,0x5C,0xEF,0xBD,0xF7,0xBD,0xF7,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0x56,0x9D,0x50,0x32,0xD3,0x63,0x56,0x9D,0x56,0x9D,0xB5,0x8C,0xD7,0xB5,0xFA,0xDE,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0x33,0xB5,0x0E,0x84,0x69,0x52,0x65,0x31,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,
-	0xCA,0x5A,0x50,0x8C,0x33,0xB5,0x77,0xD6,0x39,0xEF,0x5A,0xEF,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xD7,0xB5,0x50,0x32,0x2F,0x1A,0xD3,0x63,0x56,0x9D,0x58,0xC6,0x5C,0xEF,0xBD,0xF7,0x5C,0xEF,
-	0x5C,0xEF,0x5C,0xEF,0xFA,0xDE,0xFA,0xDE,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xB9,0xD6,0x34,0x74,0x50,0x32,0x6E,0x09,0xCF,0x11,0xD3,0x63,0x56,0x9D,0x56,0x9D,0xD7,0xB5,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x5A,0xEF,0xF8,0xDE,0x36,0xC6,0xF2,0xA4,0xAD,0x83,0xE7,0x41,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC2,0x10,0x4C,0x6B,0x65,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0x0E,0x84,0x33,0xB5,0x77,0xD6,0xF8,0xDE,0x5A,0xEF,0xB9,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xB9,0xD6,0xD3,0x63,0x6E,0x01,0x6E,0x09,0x6E,0x09,0x58,0xC6,0xBD,0xF7,0xBD,0xF7,0x5C,0xEF,0x5C,0xEF,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0x5C,0xEF,0x5C,0xEF,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x56,0x9D,
-	0x6E,0x09,0x6E,0x01,0x6E,0x01,0x0E,0x01,0x56,0x9D,0x5C,0xEF,0x5C,0xEF,0xBB,0xF7,0x5A,0xEF,0xFA,0xDE,0x5A,0xEF,0x5A,0xEF,0xFA,0xDE,0xFA,0xDE,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x39,0xEF,0x77,0xD6,0x36,0xC6,0xF0,0xA4,0x4C,0x6B,0x65,0x31,
-	0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0x58,0xC6,0xCA,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0x65,0x31,0x4C,0x6B,
-	0xF1,0xA4,0x36,0xC6,0xF8,0xDE,0x39,0xEF,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xB5,0x8C,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0xD7,0xB5,0xBD,0xF7,0x5C,0xEF,0xB9,0xD6,0xFA,0xDE,0xFA,0xDE,
-	0x5C,0xEF,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x5C,0xEF,0xD7,0xB5,0xD3,0x63,0x6E,0x09,0x6E,0x09,0xD7,0xB5,0xBC,0xF7,0xBB,0xF7,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0x5A,0xEF,0xFA,0xDE,0xFA,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x39,0xEF,0x77,0xD6,0x93,0xBD,0xCE,0x94,0xCA,0x5A,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0xCA,0x5A,0xCE,0x94,0x36,0xC6,0xF8,0xDE,0x39,0xEF,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x78,0xF7,
-	0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x79,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x5A,0xEF,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xFA,0xDE,0x58,0xC6,0xD7,0xB5,0x30,0x43,0x6E,0x09,0xCF,0x32,0x5C,0xEF,0x5C,0xEF,0xFA,0xDE,0xFA,0xDE,0x5C,0xEF,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xD3,0x63,0x6E,0x01,0xD3,0x63,0x5C,0xEF,0x5A,0xEF,0xB9,0xD6,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x39,0xEF,0x77,0xD6,0x33,0xB5,0x0E,0x84,
-	0x69,0x52,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC2,0x10,0x69,0x52,0x0E,0x84,0x93,0xBD,
-	0x77,0xD6,0x39,0xEF,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xD7,0xB5,0xB5,0x8C,0xB9,0xD6,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xB9,0xD6,0x6E,0x09,0x0E,0x01,0x34,0x74,0xFA,0xDE,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x34,0x74,0x6E,0x01,0x0E,0x01,0x56,0x9D,0x5A,0xEF,0xFA,0xDE,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x5A,0xEF,0xF8,0xDE,0x36,0xC6,0xF2,0xA4,0x2B,0x6B,0xE7,0x41,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0x2B,0x6B,0xF1,0xA4,0x77,0xD6,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,
-	0x38,0xF7,0x78,0xF7,0x38,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xF7,0x36,0xC6,0x5A,0xEF,0x7A,0xF7,0x34,0x74,0x34,0x74,0x39,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xD7,0xB5,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x34,0x74,0xFA,0xDE,0xB9,0xD6,0xD7,0xB5,0xD7,0xB5,0x56,0x9D,0x56,0x9D,0x58,0xC6,0xB9,0xD6,0x58,0xC6,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xFA,0xDE,0x2F,0x1A,0x6E,0x09,0x6E,0x01,0x50,0x32,0x58,0xC6,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x39,0xEF,0xF8,0xDE,0x93,0xBD,
-	0xB1,0x9C,0xCA,0x5A,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x2B,0x09,0x0E,0x01,0xE7,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0xCA,0x5A,0x50,0x8C,0x93,0xBD,0xF8,0xDE,
-	0x39,0xEF,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xF7,0x79,0xF7,0xF8,0xDE,0xF8,0xDE,0x7A,0xF7,
-	0x56,0x9D,0xD6,0xB5,0x56,0x9D,0xD3,0x63,0xB9,0xD6,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xD3,0x63,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x0E,0x01,0x4F,0x22,0x2F,0x1A,0x4F,0x11,
-	0x6E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x50,0x32,0x58,0xC6,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0x34,0x74,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x09,0xCF,0x32,0x56,0x9D,0x58,0xC6,0xB9,0xD6,0x5A,0xEF,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x39,0xEF,0x77,0xD6,0x33,0xB5,0xAD,0x83,0x69,0x52,0x24,0x21,0x20,0x00,0x00,0x00,0x2B,0x09,0x6E,0x01,0x22,0x00,0x00,0x00,0x20,0x00,0x2B,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0xC8,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0xAD,0x83,0x33,0xB5,0x77,0xD6,0xF8,0xDE,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x39,0xEF,0x36,0xC6,0x36,0xC6,0x34,0x74,0xB5,0x8C,0x56,0x9D,0xB9,0xD6,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x5A,0xEF,0x50,0x32,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x58,0xC6,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xFA,0xDE,0xB9,0xD6,0xFA,0xDE,
-	0x58,0xC6,0x50,0x32,0x0E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x09,0xCF,0x11,0x2F,0x1A,0x50,0x32,0x30,0x43,0x56,0x9D,0x5A,0xEF,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x5A,0xEF,0xF8,0xDE,
-	0x36,0xC6,0xB1,0x9C,0x2B,0x6B,0xA8,0x19,0x29,0x09,0xA5,0x00,0xA7,0x00,0x0C,0x09,0x2B,0x09,0x00,0x00,0x23,0x00,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0xF1,0xA4,0x36,0xC6,0xF8,0xDE,0x39,0xEF,
-	0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x38,0xF7,0xB5,0x8C,0x34,0x74,
-	0x36,0xC6,0x56,0x9D,0x56,0x9D,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0x5A,0xEF,0x56,0x9D,0xCF,0x11,0x6E,0x01,0x0C,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,
-	0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x34,0x74,0xB9,0xD6,0x58,0xC6,0xD7,0xB5,0xD7,0xB5,0xD7,0xB5,0xD7,0xB5,0xD7,0xB5,0x56,0x9D,0x56,0x9D,0x56,0x9D,0x34,0x74,0xCF,0x11,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x0E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x0E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x09,0x50,0x32,0x56,0x9D,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x39,0xEF,0x77,0xD6,0x33,0xB5,0x4E,0x53,0x6E,0x09,0x6E,0x01,0x2B,0x09,0x00,0x00,0x21,0x00,0x09,0x01,0x09,0x01,0x09,0x01,0x6E,0x01,0x6E,0x01,0x0E,0x01,0x6E,0x01,0x6E,0x09,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x69,0x52,0x0E,0x84,0x93,0xBD,0x77,0xD6,0x39,0xEF,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,
-	0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x79,0xF7,0x39,0xEF,0xD3,0x63,0xB5,0x8C,0x56,0x9D,0xD3,0x63,0x36,0xC6,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x39,0xEF,0xFA,0xDE,0x5A,0xEF,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xFA,0xDE,0x56,0x9D,0xB5,0x8C,0xD3,0x63,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x0C,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x0E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0xCF,0x32,0xD3,0x63,0xD3,0x63,0x34,0x74,0xB5,0x8C,0x56,0x9D,0x56,0x9D,0xD7,0xB5,0xB9,0xD6,0xB9,0xD6,0xD3,0x63,
-	0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x0C,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x0C,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x56,0x9D,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0xB9,0xD6,0x58,0xC6,
-	0x54,0x95,0x34,0x74,0xAF,0x2A,0x4D,0x11,0x4A,0x11,0x0C,0x09,0x63,0x00,0x00,0x00,0x22,0x00,0x0E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0xF2,0xA4,0x77,0xD6,0xF8,0xDE,0x79,0xF7,0x7A,0xF7,
-	0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xF7,0x38,0xF7,0x30,0x43,0xCF,0x32,
-	0x34,0x74,0x36,0xC6,0x7A,0xF7,0x79,0xF7,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0x39,0xEF,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xD7,0xB5,0xB5,0x8C,0x34,0x74,0x50,0x32,0xCF,0x11,0xCF,0x32,0x2F,0x1A,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0xCF,0x11,0x30,0x43,
-	0x34,0x74,0xD3,0x63,0x4F,0x22,0x0E,0x01,0x6E,0x09,0xCF,0x32,0x56,0x9D,0x56,0x9D,0x56,0x9D,0x56,0x9D,0x56,0x9D,0x56,0x9D,0x56,0x9D,0xD7,0xB5,0x58,0xC6,0xD3,0x63,0xCF,0x32,0xD7,0xB5,0x34,0x74,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x0C,0x09,0x6E,0x01,0xD3,0x63,0x36,0xC6,
-	0xD7,0xB5,0xD7,0xB5,0xD7,0xB5,0xD7,0xB5,0x36,0xC6,0x58,0xC6,0xD7,0xB5,0x58,0xC6,0xD7,0xB5,0xD7,0xB5,0xD7,0xB5,0xD7,0xB5,0x56,0x9D,0xB5,0x8C,0xB5,0x8C,0x56,0x9D,0xD6,0xB5,0x36,0xC6,0x93,0xBD,0x50,0x8C,0x4B,0x2A,0x6E,0x01,0x63,0x08,0x00,0x00,0x64,0x00,0x6E,0x01,0x6E,0x01,0x0E,0x01,0x6E,0x01,0x6E,0x01,0x0C,0x09,0xE7,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0xC2,0x10,0x69,0x52,0x50,0x8C,0x93,0xBD,0x97,0xDE,0x39,0xEF,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x37,0xF7,0x37,0xF7,0x38,0xF7,
-	0x37,0xF7,0x37,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x34,0x74,0x4F,0x11,0x50,0x32,0xF8,0xDE,0x7A,0xF7,0x79,0xF7,0xF8,0xDE,0xF8,0xDE,0xF8,0xDE,0x5A,0xEF,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0x58,0xC6,0x34,0x74,0xD3,0x63,0xB5,0x8C,0x58,0xC6,0x34,0x74,0x50,0x32,0xD7,0xB5,0x7A,0xF7,0x56,0x9D,0xD3,0x63,0xD3,0x63,0x34,0x74,0xD7,0xB5,0xB9,0xD6,0xFA,0xDE,0xFA,0xDE,0xD7,0xB5,0x50,0x32,0x6E,0x01,0x2F,0x09,0x34,0x74,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5C,0xEF,0x5A,0xEF,0x5A,0xEF,0xFA,0xDE,0x5C,0xEF,0xB9,0xD6,
-	0xD3,0x63,0xD7,0xB5,0xBB,0xF7,0x58,0xC6,0xD3,0x63,0x4F,0x22,0xCF,0x11,0x4F,0x22,0x30,0x43,0xCF,0x32,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x09,0xCF,0x32,0x56,0x9D,0xD6,0xB5,0x58,0xC6,0x36,0xC6,0xD7,0xB5,0x56,0x9D,0x56,0x9D,0x56,0x9D,0x56,0x9D,0x56,0x9D,0xD7,0xB5,0xD7,0xB5,0x58,0xC6,0x58,0xC6,0xB9,0xD6,0x5A,0xEF,0xFA,0xDE,
-	0x5A,0xEF,0xF8,0xDE,0x77,0xD6,0xAF,0x63,0x6E,0x01,0x4D,0x11,0xC2,0x10,0x20,0x00,0xA6,0x00,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0xC8,0x08,0x63,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0xF2,0xA4,0x77,0xD6,0x39,0xEF,0x5A,0xEF,0x7A,0xF7,0x7A,0xF7,
-	0xB9,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xFF,0x56,0x9D,0x6E,0x09,0x6E,0x09,0xCF,0x32,
-	0x79,0xF7,0x79,0xF7,0xF8,0xDE,0xF8,0xDE,0xF8,0xDE,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xD6,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x58,0xC6,0xB5,0x8C,0xD3,0x63,0x34,0x74,0xD7,0xB5,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0x34,0x74,0xD3,0x63,0xFA,0xDE,0xFA,0xDE,0xB9,0xD6,0x58,0xC6,0xB9,0xD6,0xB9,0xD6,0xB9,0xD6,
-	0x58,0xC6,0xB9,0xD6,0xFA,0xDE,0xD7,0xB5,0x34,0x74,0xCF,0x11,0xCF,0x11,0xD7,0xB5,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xD7,0xB5,0x50,0x32,0xB5,0x8C,0xFA,0xDE,0xB9,0xD6,0x58,0xC6,0xD6,0xB5,0xD7,0xB5,0x58,0xC6,0x58,0xC6,0x56,0x9D,0x50,0x32,0x6E,0x09,0x6E,0x01,0x34,0x74,0x56,0x9D,
-	0x34,0x74,0x56,0x9D,0x58,0xC6,0x39,0xEF,0x5A,0xEF,0x5A,0xEF,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xBB,0xF7,0x7A,0xF7,0x56,0x9D,0x4F,0x22,0x6E,0x01,0x6E,0x09,0xCD,0x11,0x2B,0x09,0x2B,0x09,0x0C,0x09,0x6E,0x01,0x0C,0x09,0x6E,0x01,0x6E,0x01,0xC8,0x08,0x64,0x00,0xC8,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0x0E,0x84,0x93,0xBD,0xF8,0xDE,0x39,0xEF,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x37,0xF7,0x38,0xF7,0x78,0xF7,
-	0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x36,0xC6,0xB5,0x8C,0x6E,0x09,0x0C,0x09,0x6E,0x01,0x6E,0x09,0xB5,0x8C,0x79,0xFF,0x79,0xF7,0x39,0xEF,0x7A,0xF7,0xBA,0xF7,0x39,0xEF,0xD7,0xB5,0xD3,0x63,0xCF,0x32,0x56,0x9D,0xBA,0xF7,0xBB,0xF7,0x58,0xC6,0x34,0x74,0xD3,0x63,
-	0xD3,0x63,0x56,0x9D,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x34,0x74,0x4F,0x22,0x30,0x43,0xD7,0xB5,0xFA,0xDE,0x58,0xC6,0x58,0xC6,0xD7,0xB5,0x58,0xC6,0xD7,0xB5,0x58,0xC6,0xFA,0xDE,0x7A,0xF7,0x58,0xC6,0x4F,0x22,0x50,0x32,0x58,0xC6,0x7A,0xF7,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0x5C,0xEF,
-	0xBB,0xF7,0xD7,0xB5,0x50,0x32,0xCF,0x32,0xB9,0xD6,0x5A,0xEF,0xB9,0xD6,0x77,0xD6,0x77,0xD6,0x97,0xDE,0x39,0xEF,0xD6,0xB5,0x4F,0x11,0x6E,0x01,0xB0,0x53,0x77,0xD6,0xD6,0xB5,0x56,0x9D,0x56,0x9D,0xB5,0x8C,0x56,0x9D,0x36,0xC6,0xF8,0xDE,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xFA,0xDE,0x30,0x43,0xB9,0xD6,
-	0x58,0xC6,0xCF,0x11,0x6E,0x09,0x0E,0x01,0x6E,0x09,0xED,0x4A,0xA8,0x19,0x0C,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x0C,0x09,0x6E,0x01,0x6E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0xF1,0xA4,0x77,0xD6,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF6,0xF6,0x37,0xF7,0x78,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x33,0xB5,0xD3,0x63,0x4F,0x22,0xD3,0x63,0x50,0x32,0x6E,0x09,
-	0x6E,0x09,0xB5,0x8C,0x39,0xEF,0x79,0xF7,0x77,0xD6,0x34,0x74,0x50,0x32,0x6E,0x09,0x6E,0x09,0x6E,0x01,0xB0,0x53,0xD7,0xB5,0x34,0x74,0xB0,0x53,0xD3,0x63,0x56,0x9D,0xFA,0xDE,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x5A,0xEF,0xFA,0xDE,0xBB,0xF7,0x5A,0xEF,0xD7,0xB5,0xB5,0x8C,0x58,0xC6,0xFA,0xDE,0xB9,0xD6,0xB9,0xD6,0x58,0xC6,
-	0xB9,0xD6,0xFA,0xDE,0xFA,0xDE,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0x58,0xC6,0x30,0x43,0x50,0x32,0x56,0x9D,0x5A,0xEF,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xFA,0xDE,0xBC,0xF7,0xBC,0xF7,0xB9,0xD6,0x56,0x9D,0x58,0xC6,0xF8,0xDE,0x77,0xD6,0x58,0xC6,0xD6,0xB5,0xD6,0xB5,0x36,0xC6,0xF8,0xDE,0xB5,0x8C,0x6E,0x09,0x2F,0x09,0xD6,0xB5,
-	0x39,0xF7,0xF8,0xDE,0xF8,0xDE,0xB9,0xD6,0xD6,0xB5,0x56,0x9D,0xB5,0x8C,0xB5,0x8C,0x56,0x9D,0x56,0x9D,0xD6,0xB5,0x58,0xC6,0x39,0xEF,0x36,0xC6,0x6E,0x09,0x30,0x43,0x50,0x32,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x90,0x84,0x50,0x8C,0x69,0x52,0x2B,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0xAD,0x83,0x93,0xBD,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,
-	0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0xF8,0xDE,0x97,0xDE,0xD7,0xEE,0x78,0xF7,0xD6,0xB5,0xCD,0x11,0x6E,0x01,0x0E,0x01,0xD3,0x63,0xD3,0x63,0x4F,0x22,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x0E,0x01,0xD3,0x63,0x56,0x9D,0xD7,0xB5,0x5A,0xEF,0xBB,0xFF,
-	0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x5A,0xEF,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xB9,0xD6,0x34,0x74,0x56,0x9D,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0x5A,0xEF,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x39,0xEF,0xF8,0xDE,0x39,0xEF,0x97,0xDE,0x77,0xD6,0x77,0xD6,0x36,0xC6,0x77,0xD6,0x38,0xF7,0xD6,0xB5,0xCD,0x21,0xD3,0x63,0xF8,0xDE,0x39,0xEF,0x39,0xEF,0xB9,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB5,0x8C,0x4F,0x22,0x2F,0x09,0x4F,0x22,0x30,0x43,
-	0x6E,0x09,0x6E,0x01,0x6E,0x01,0xD3,0x63,0x77,0xD6,0xF1,0xA4,0xCD,0x21,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x0C,0x09,0x6E,0x01,0x6E,0x01,0x0C,0x09,0x6E,0x01,0x6E,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0xCA,0x5A,0xF0,0xA4,0x36,0xC6,0xF8,0xDE,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,
-	0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x77,0xD6,0xCF,0x11,
-	0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x0E,0x01,0x6E,0x01,0xB5,0x8C,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x5A,0xEF,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0x5A,0xEF,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0x5A,0xEF,0xFA,0xDE,0xFA,0xDE,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0xF8,0xDE,0xF8,0xDE,0x39,0xEF,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0x39,0xEF,0x37,0xEF,0x78,0xF7,0x78,0xF7,0x54,0x95,0x6E,0x09,
-	0xD6,0xB5,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xF8,0xDE,0x50,0x32,0x6E,0x09,0xCF,0x32,0x58,0xC6,0xD6,0xB5,0x6E,0x09,0x0C,0x09,0x6E,0x09,0xB5,0x8C,0x97,0xDE,0xCF,0x32,0x6E,0x01,0x6E,0x01,0x0C,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0xE7,0x41,0x6C,0x7B,0x33,0xB5,0x77,0xD6,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,
-	0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0xB5,0x8C,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x0C,0x09,0x6E,0x01,0x6E,0x01,0x0E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x01,0xCF,0x11,0xB5,0x8C,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xFA,0xDE,0xFA,0xDE,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xFA,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xFA,0xDE,0xFA,0xDE,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x39,0xEF,0xF8,0xDE,0xF8,0xDE,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0xD3,0x63,0x50,0x32,0xD6,0xB5,0x79,0xF7,0x79,0xF7,0x39,0xEF,0xD7,0xEE,0xF8,0xDE,0x39,0xEF,0x78,0xF7,0x78,0xF7,0xD3,0x63,0x6E,0x09,0xD6,0xB5,0x79,0xF7,0x79,0xFF,0x58,0xC6,
-	0x6E,0x09,0x6E,0x01,0x6E,0x01,0x4F,0x22,0xCF,0x32,0x6E,0x09,0x6E,0x09,0xCD,0x21,0x4D,0x11,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x69,0x52,0x50,0x8C,0xD4,0xCD,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0xF5,0xF6,0xF5,0xF6,0x94,0xFE,0xF5,0xF6,0xF5,0xF6,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x34,0x74,0x0C,0x09,
-	0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x09,0xD3,0x63,0x56,0x9D,0xD6,0xB5,0xD3,0x63,0x50,0x32,0x6E,0x09,0x6E,0x01,0x34,0x74,0xB9,0xD6,0xB9,0xD6,0xFA,0xDE,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0x5A,0xEF,0xFA,0xDE,0xFA,0xDE,0xFA,0xDE,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x39,0xEF,0x39,0xEF,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xF8,0xDE,
-	0xD3,0x63,0xCF,0x32,0x77,0xD6,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xEF,0xD7,0xEE,0x78,0xF7,0x77,0xD6,0xCD,0x11,0x34,0x74,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x39,0xEF,0x30,0x43,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x01,0xCF,0x32,0x4C,0x3A,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x0C,0x09,0x6E,0x09,0x6E,0x01,0x0E,0x01,0x6E,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0xCA,0x5A,0xF1,0xA4,0x36,0xC6,0x39,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0xB5,0x8C,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x4F,0x22,0x56,0x9D,0xF8,0xDE,0x39,0xEF,0xF8,0xDE,0x58,0xC6,0x36,0xC6,0xD7,0xB5,0x34,0x74,0x50,0x32,0x30,0x43,0x34,0x74,
-	0xF8,0xDE,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xBA,0xF7,0x39,0xEF,0xD6,0xB5,0x77,0xD6,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x38,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xD6,0xCF,0x11,0xB5,0x8C,0x78,0xF7,0x79,0xF7,0x39,0xEF,0x79,0xF7,
-	0x56,0x9D,0x0E,0x01,0x6E,0x01,0x6E,0x01,0x0C,0x09,0x50,0x32,0xD3,0x63,0xCD,0x21,0x6E,0x01,0x0C,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x10,0xE7,0x41,0x8D,0x73,0x33,0xB5,0x97,0xDE,0x39,0xEF,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0xF6,0xF6,0xF4,0xF6,0x53,0xEE,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x97,0xDE,0xD3,0x63,0x6E,0x09,
-	0x4D,0x11,0xCF,0x11,0xCF,0x32,0x34,0x74,0x36,0xC6,0xF8,0xDE,0xB9,0xD6,0x36,0xC6,0xD7,0xB5,0x58,0xC6,0xFA,0xDE,0x39,0xEF,0xB9,0xD6,0xD7,0xB5,0x56,0x9D,0xD7,0xB5,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xFF,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0x7A,0xF7,0xF8,0xDE,0xF8,0xDE,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x37,0xF7,0xCF,0x32,0xCD,0x21,0x97,0xDE,0x79,0xF7,0x79,0xF7,0xF8,0xDE,0x30,0x43,0x50,0x32,0x30,0x43,0x4F,0x11,0x6E,0x01,0xCF,0x11,0xCD,0x21,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x0C,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0x69,0x52,0xCE,0x94,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,
-	0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xEF,0x50,0x32,0xCF,0x11,0xD2,0x9C,0x77,0xD6,0x36,0xC6,0x36,0xC6,0x77,0xD6,0x77,0xD6,0x36,0xC6,0xD7,0xB5,0xD7,0xB5,0x58,0xC6,0xB9,0xD6,0xF8,0xDE,0xF8,0xDE,0xFA,0xDE,0x39,0xEF,0xFA,0xDE,0x39,0xEF,
-	0x5A,0xEF,0x5A,0xEF,0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xFF,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0xF8,0xDE,0x97,0xDE,0x39,0xEF,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xC6,0x6E,0x01,0xCF,0x11,0xD6,0xB5,0xF8,0xDE,0xD3,0x63,
-	0x4F,0x11,0x97,0xDE,0x36,0xC6,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0x2B,0x6B,0xF1,0xA4,0x36,0xC6,0x39,0xEF,0x7A,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x37,0xF7,0xF6,0xF6,0xF5,0xF6,0x94,0xFE,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF6,0xF6,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x34,0x74,0x4F,0x22,0xB5,0x8C,
-	0x77,0xD6,0xB5,0x8C,0xD6,0xB5,0x77,0xD6,0xD7,0xB5,0x36,0xC6,0x36,0xC6,0xB9,0xD6,0xF8,0xDE,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0xF8,0xDE,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0x39,0xEF,0xF8,0xDE,0x97,0xDE,0x39,0xEF,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x93,0xBD,0x4F,0x22,0x6E,0x09,0x6E,0x09,0x6E,0x01,0x34,0x74,0xD6,0xB5,0xCF,0x32,0xCF,0x32,0xB5,0x8C,0x30,0x43,0x6E,0x09,0x6E,0x01,0x0E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x0C,0x09,0x6E,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x41,0xAD,0x83,0x33,0xB5,0x77,0xD6,0x39,0xEF,0x7A,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x37,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0x94,0xFE,0xF5,0xF6,0xF6,0xF6,0x37,0xF7,0x38,0xF7,0x39,0xF7,0x79,0xF7,0x79,0xF7,
-	0x39,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x36,0xC6,0x34,0x74,0xD3,0x63,0xD3,0x63,0xD6,0xB5,0xB9,0xD6,0x77,0xD6,0xB9,0xD6,0xF8,0xDE,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0x5A,0xEF,0x39,0xEF,0x5A,0xEF,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xFF,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xEF,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0xD7,0xEE,0xD3,0x7C,0x6E,0x09,0x6E,0x09,
-	0xCD,0x11,0x4F,0x11,0xB0,0x53,0x39,0xEF,0x79,0xFF,0x36,0xC6,0x34,0x74,0x4F,0x22,0x6E,0x09,0x0C,0x09,0x6E,0x09,0x0E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0xE7,0x41,0x0E,0x84,0x93,0xBD,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x37,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xFF,0x79,0xF7,0x38,0xF7,
-	0x77,0xD6,0x77,0xD6,0xF8,0xDE,0xF8,0xDE,0x39,0xEF,0x39,0xEF,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x17,0xFF,0x77,0xD6,0xD3,0x7C,0x6E,0x09,0x6E,0x01,0xD3,0x63,0xF8,0xDE,0x79,0xF7,0x39,0xEF,0x77,0xD6,0xD2,0x9C,0x4E,0x53,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0xCA,0x5A,0xB1,0x9C,0x36,0xC6,0xF8,0xDE,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF6,0xF6,0x37,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x38,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xD7,0xEE,0xF6,0xF6,0x17,0xFF,
-	0x97,0xDE,0x90,0x84,0x4F,0x11,0x6E,0x09,0xD3,0x63,0x77,0xD6,0xF8,0xDE,0x77,0xD6,0xF2,0xA4,0x4E,0x53,0x4D,0x11,0x6E,0x01,0x0C,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0x33,0xB5,0x77,0xD6,0x39,0xEF,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xD5,0xEE,0x77,0xD6,0x97,0xDE,0x37,0xF7,0x37,0xF7,0xD6,0xB5,0xCF,0x32,0x6E,0x09,0x4F,0x22,0x54,0x95,0x77,0xD6,0xD4,0xCD,0x50,0x8C,0xCD,0x11,0x2B,0x09,0x09,0x01,0x6E,0x01,0x0E,0x01,0x6E,0x09,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x8D,0x73,0x93,0xBD,0x77,0xD6,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x39,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0xF6,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x38,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,
-	0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0xD5,0xEE,0x34,0xDE,
-	0x36,0xC6,0x77,0xD6,0xD7,0xEE,0xD7,0xEE,0xD2,0x9C,0xCF,0x11,0x2F,0x09,0x30,0x43,0xD6,0xB5,0xB1,0x9C,0xCD,0x21,0x49,0x11,0xA7,0x00,0x2B,0x09,0x09,0x01,0xC8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x41,0x0E,0x84,0x93,0xBD,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF6,0xF6,0x36,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,
-	0x78,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xEF,0xD7,0xEE,0x34,0xDE,0x36,0xC6,0x77,0xD6,0x39,0xEF,0x77,0xD6,0xD3,0x63,0x6E,0x09,0xCF,0x11,0x4E,0x53,0xCD,0x21,0x4A,0x11,0x09,0x01,0xA7,0x00,0x21,0x00,0xA6,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x10,0x69,0x52,0xCE,0x94,0x36,0xC6,0xF8,0xDE,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xF6,0xF6,0xF6,0xF6,0xF6,0xF6,0xF6,0xF6,0xF5,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x38,0xF7,
-	0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,
-	0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x17,0xFF,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x37,0xEF,0xD7,0xEE,0x77,0xD6,0x36,0xC6,0x38,0xF7,0x79,0xF7,0xD6,0xB5,0xCF,0x32,0x6E,0x09,0x6E,0x01,0x4D,0x11,0x2B,0x09,0x65,0x00,0x22,0x00,0x2B,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x69,0x52,0xB1,0x9C,0x77,0xD6,0xF8,0xDE,0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,
-	0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xEF,0x97,0xDE,0x77,0xD6,0xF8,0xDE,0x38,0xF7,0x97,0xDE,0x34,0x74,0xCD,0x11,0x6E,0x01,0x6E,0x01,0xA6,0x00,0x21,0x00,0x65,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x08,0x24,0x21,0x2B,0x6B,0xF1,0xA4,0x77,0xD6,0x39,0xEF,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0xF6,0xF6,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x37,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,
-	0x37,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,
-	0x37,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0xF8,0xDE,0x77,0xD6,0x36,0xC6,0x77,0xD6,0xD4,0xCD,0x0E,0x84,0xCD,0x21,0x6E,0x01,0x0C,0x09,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x6C,0x7B,0x33,0xB5,0x97,0xDE,0x39,0xEF,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0xF6,0xF6,0x35,0xF7,0xF6,0xF6,0xF6,0xF6,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,
-	0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x36,0xF7,
-	0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0xB9,0xD6,0x36,0xC6,0xD6,0xB5,0xF0,0xA4,0xCA,0x5A,0x47,0x11,0x6E,0x01,0x6E,0x01,0x64,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x65,0x31,0xAD,0x83,0xD6,0xB5,0xF8,0xDE,0x39,0xEF,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0xF6,0xF6,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x38,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0x35,0xF7,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x77,0xF7,
-	0x77,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xD6,0xD6,0xB5,0x50,0x8C,0x2B,0x6B,0x24,0x21,0xA5,0x08,0x0C,0x09,0x6E,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x41,0x0E,0x84,0x93,0xBD,0xF8,0xDE,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0xF5,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,
-	0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,
-	0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,0x77,0xD6,0xB1,0x9C,0x0D,0x53,0x67,0x29,0x61,0x00,0x22,0x00,0x09,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x08,0xE7,0x41,0x0E,0x84,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x39,0xF7,0x79,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,
-	0x78,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xB9,0xF7,
-	0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x78,0xF7,
-	0x79,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x37,0xEF,0x77,0xD6,0x33,0xB5,0x2B,0x6B,0x67,0x29,0x63,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0xE7,0x41,0x0E,0x84,0x36,0xC6,0xF8,0xDE,0x79,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,
-	0x39,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x39,0xEF,0x77,0xD6,0x33,0xB5,0x6C,0x7B,0x65,0x31,0x62,0x08,0x63,0x00,0x22,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA1,0x10,0xE7,0x41,0xB1,0x9C,0x36,0xC6,0xF8,0xDE,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x38,0xF7,0x79,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,
-	0x78,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,
-	0xF6,0xF6,0x35,0xF7,0x36,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x35,0xF7,0x36,0xF7,0x78,0xF7,
-	0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0x8D,0x73,0x65,0x31,0x61,0x00,0x21,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x69,0x52,0xCE,0x94,0x36,0xC6,0x39,0xEF,0x5A,0xEF,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,
-	0x79,0xF7,0x39,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x36,0xF7,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,
-	0x78,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0x8D,0x73,0x65,0x31,0x61,0x08,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA1,0x10,0x69,0x52,0x70,0x94,0x77,0xD6,0x39,0xEF,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,
-	0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,
-	0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,
-	0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0xAD,0x83,0xE7,0x41,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0x69,0x52,0xB1,0x9C,0x36,0xC6,0x39,0xEF,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,
-	0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,
-	0x77,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x93,0xBD,0xAD,0x83,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC2,0x10,0x69,0x52,0xCE,0x94,0x77,0xD6,0x39,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x38,0xF7,0x37,0xF7,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x36,0xF7,0x35,0xF7,0x36,0xF7,0xF5,0xF6,
-	0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0x0E,0x84,0xE7,0x41,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x10,0x69,0x52,0xB1,0x9C,0x36,0xC6,0x39,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0x36,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,
-	0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0xBA,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,
-	0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0xF8,0xDE,0x93,0xBD,0xAD,0x83,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xA1,0x10,0x69,0x52,0xB1,0x9C,0x36,0xC6,0x39,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,
-	0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0xAD,0x83,0xE7,0x41,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x10,0x69,0x52,0x50,0x8C,0x77,0xD6,0x39,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,
-	0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xEF,0x97,0xDE,0x93,0xBD,0xAD,0x83,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC2,0x10,0xE7,0x41,0xCE,0x94,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x39,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x39,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,
-	0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x38,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x35,0xF7,0xF6,0xF6,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,
-	0x35,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0x8D,0x73,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x10,0x69,0x52,0x50,0x8C,0x36,0xC6,0x39,0xEF,0x5A,0xEF,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,
-	0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0x97,0xDE,0x33,0xB5,0xAD,0x83,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA1,0x10,0xE7,0x41,0x50,0x8C,0x36,0xC6,0xFA,0xDE,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x79,0xF7,0x78,0xF7,
-	0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x35,0xF7,0xF6,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,
-	0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xEF,0x97,0xDE,0x33,0xB5,0x6C,0x7B,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x08,0xE7,0x41,0x0E,0x84,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x38,0xF7,0x79,0xF7,0x38,0xF7,0x79,0xF7,0x78,0xF7,0x39,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x78,0xF7,0x77,0xF7,0x38,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,
-	0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0xF6,0xF6,0x35,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x94,0xFE,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xEF,0x77,0xD6,0x33,0xB5,0x2B,0x6B,0x65,0x31,0x60,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA1,0x10,0xE7,0x41,0x0E,0x84,0x93,0xBD,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF6,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,
-	0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0xF8,0xDE,0x77,0xD6,0x31,0xB5,0x2B,0x6B,0x65,0x31,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x41,0xAD,0x83,0xD6,0xB5,0xF8,0xDE,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,
-	0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,
-	0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xEF,0x77,0xD6,0xF0,0xA4,0x2B,0x6B,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x65,0x31,0x8D,0x73,0x93,0xBD,0xB9,0xD6,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x77,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,
-	0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x39,0xEF,0xD7,0xEE,0x36,0xC6,0xF0,0xA4,0xCA,0x5A,0x24,0x21,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x24,0x21,0x2B,0x6B,0xF2,0xA4,0x77,0xD6,0x5A,0xEF,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0xB9,0xF7,0x7A,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x37,0xEF,0x97,0xDE,0xD4,0xCD,0xCE,0x94,0x69,0x52,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x24,0x21,0x69,0x52,0xD2,0x9C,0x77,0xD6,0xFA,0xDE,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0xBA,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,
-	0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x37,0xEF,0x97,0xDE,0x93,0xBD,0x0E,0x84,0xE7,0x41,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x10,0x69,0x52,0x50,0x8C,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0x6C,0x7B,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x41,0x0E,0x84,0x93,0xBD,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x35,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF4,0xF6,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0xD7,0xEE,0x77,0xD6,0x33,0xB5,0x2B,0x6B,0x65,0x31,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x8D,0x73,0x93,0xBD,0xB9,0xD6,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x78,0xF7,0x79,0xF7,
-	0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x35,0xF7,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF6,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,
-	0x78,0xF7,0x37,0xF7,0x35,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x36,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x39,0xEF,0xD7,0xEE,0x36,0xC6,0xF0,0xA4,0xCA,0x5A,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0xF2,0xA4,0x77,0xD6,0x39,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,
-	0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x0F,0xE6,0x8E,0xDD,0x77,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x37,0xF7,0x35,0xF7,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0x97,0xDE,0xD4,0xCD,0xCE,0x94,0x69,0x52,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0x69,0x52,0xB1,0x9C,0x36,0xC6,0xF8,0xDE,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0xE5,0xE4,0xE5,0xE4,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x78,0xF7,
-	0x36,0xF7,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0x0E,0x84,0xE7,0x41,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x10,0xE7,0x41,0x0E,0x84,0x93,0xBD,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,
-	0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x77,0xF7,0x77,0xF7,0xF5,0xF6,0x35,0xF7,0x37,0xEF,0xE5,0xE4,0xE5,0xE4,0xF5,0xF6,0x35,0xF7,0xF4,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF6,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,
-	0x37,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0x79,0xF7,0x77,0xF7,0xF5,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,
-	0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0x37,0xEF,0x77,0xD6,0xF1,0xA4,0x6C,0x7B,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x41,0x8D,0x73,0x93,0xBD,0x77,0xD6,0x39,0xEF,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x77,0xF7,0x35,0xEF,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0xB2,0xF6,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0x0F,0xE6,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x35,0xF7,0x36,0xF7,0x36,0xF7,0xF4,0xF6,0xB2,0xF6,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x78,0xF7,0x37,0xF7,
-	0xF5,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0xF8,0xDE,0xD4,0xCD,0xF0,0xA4,0x2B,0x6B,0x24,0x21,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0x2B,0x6B,0xD2,0x9C,0x77,0xD6,0x39,0xEF,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,
-	0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0xF4,0xF6,0x35,0xEF,0x79,0xF7,0x78,0xF7,0xF4,0xF6,0x77,0xF7,0x78,0xF7,0x38,0xF7,
-	0x77,0xF7,0x77,0xF7,0x37,0xF7,0xB2,0xF6,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xAC,0xC4,0x90,0xF6,0x37,0xEF,0x77,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0xB2,0xF6,0xF4,0xF6,0x36,0xF7,0xF5,0xF6,0x90,0xF6,0xD5,0xEE,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x77,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x77,0xF7,0x35,0xF7,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,
-	0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0x97,0xDE,0x93,0xBD,0xCE,0x94,0x69,0x52,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0x69,0x52,0x50,0x8C,0xD4,0xCD,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB2,0xF6,0x36,0xF7,0x79,0xF7,0x36,0xF7,0xD5,0xEE,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xEF,0x8E,0xDD,0xA5,0xB3,0xE5,0xE4,0xE5,0xE4,0x37,0xEF,0x77,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0xB2,0xF6,
-	0x36,0xF7,0x36,0xF7,0xB2,0xF6,0xD5,0xEE,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x36,0xF7,0xF4,0xF6,
-	0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0x90,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0x35,0xF7,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xEF,0x77,0xD6,0x33,0xB5,0xAD,0x83,0xE7,0x41,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0xE7,0x41,0x8D,0x73,0x33,0xB5,0x97,0xDE,0x39,0xEF,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0xB2,0xF6,0x77,0xF7,0x78,0xF7,0xF4,0xF6,0x35,0xF7,0x78,0xF7,
-	0x78,0xF7,0x78,0xF7,0x37,0xEF,0xB2,0xF6,0xE5,0xE4,0xB2,0xF6,0xD5,0xEE,0xE5,0xE4,0xB2,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x35,0xF7,0xB2,0xF6,0x35,0xEF,0x36,0xF7,0xB2,0xF6,0xB2,0xF6,0x36,0xF7,0x35,0xF7,0x36,0xF7,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,
-	0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0xF5,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,
-	0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x39,0xEF,0xD7,0xEE,0x36,0xC6,0xF0,0xA4,0x2B,0x6B,0x65,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0x2B,0x6B,0xF1,0xA4,0x77,0xD6,0x39,0xEF,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,
-	0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,
-	0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x35,0xEF,0xB2,0xF6,0x37,0xF7,0x77,0xF7,0x36,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x90,0xF6,0x35,0xEF,0xF8,0xDE,0xB9,0xD6,0x35,0xEF,0x0F,0xE6,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0x35,0xEF,0x36,0xF7,
-	0xB2,0xF6,0xB2,0xF6,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0xF4,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0x35,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xEF,0x97,0xDE,0x93,0xBD,0x0E,0x84,0x69,0x52,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0x69,0x52,0x50,0x8C,0x93,0xBD,0xF8,0xDE,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x36,0xF7,0xF4,0xF6,0x79,0xF7,0x78,0xF7,0x77,0xF7,0xD5,0xEE,0x77,0xF7,0x78,0xF7,0x35,0xEF,0xF4,0xF6,0x78,0xF7,0x78,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xEF,0x56,0x9D,0xD3,0x7C,0x77,0xF7,0x76,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0xF5,0xF6,0xB2,0xF6,0x35,0xEF,0x35,0xF7,0xB2,0xF6,0xB2,0xF6,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF4,0xF6,0x77,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,
-	0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0x90,0xF6,0xB2,0xF6,0x90,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF6,0xF6,0x37,0xF7,0x77,0xF7,
-	0x77,0xF7,0x77,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xEF,0x77,0xD6,0x31,0xB5,0x6C,0x7B,0xE7,0x41,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0x65,0x31,0x8D,0x73,0x33,0xB5,0x77,0xD6,0x39,0xEF,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0xD5,0xEE,0xB2,0xF6,0x78,0xF7,0x78,0xF7,0x36,0xF7,0xB2,0xF6,0x36,0xF7,0x78,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x79,0xF7,0x50,0x64,0x50,0x64,0x39,0xEF,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xEF,
-	0x36,0xF7,0x36,0xF7,0xB2,0xF6,0xB2,0xF6,0x36,0xF7,0x36,0xF7,0xF4,0xF6,0x90,0xF6,0x35,0xEF,0x78,0xF7,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,
-	0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xD1,0xED,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xEF,0xD7,0xEE,0x36,0xC6,0xF0,0xA4,0xCA,0x5A,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0xCA,0x5A,0xF0,0xA4,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x35,0xEF,0xB2,0xF6,0x36,0xF7,0x78,0xF7,0x77,0xF7,0xD5,0xEE,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,
-	0x79,0xF7,0x79,0xF7,0x77,0xF7,0x76,0xF7,0x36,0xC6,0xB0,0x53,0xB0,0x53,0xD6,0xB5,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xF4,0xF6,0xB2,0xF6,0x36,0xF7,0x37,0xF7,0xB2,0xF6,0xB2,0xF6,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,
-	0x37,0xF7,0x77,0xF7,0x38,0xF7,0x37,0xEF,0x97,0xDE,0x93,0xBD,0x0E,0x84,0x69,0x52,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0xEF,0x7B,0x93,0xBD,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x37,0xEF,0xB2,0xF6,0xF4,0xF6,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x37,0xEF,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,
-	0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xEF,0xB2,0xF6,0xD5,0xEE,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x35,0xF7,
-	0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0x90,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xEF,0xD7,0xEE,0x77,0xD6,0xF0,0xA4,0x2B,0x6B,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0xCA,0x5A,0xF1,0xA4,0x77,0xD6,0xF8,0xDE,0x5A,0xEF,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xD5,0xEE,0x35,0xEF,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,
-	0xB9,0xF7,0x79,0xF7,0x78,0xF7,0xD6,0xB5,0xB0,0x53,0x50,0x64,0x50,0x64,0xB0,0x53,0x54,0x95,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xB2,0xF6,0x36,0xF7,0x78,0xF7,0xB9,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,
-	0x77,0xF7,0x38,0xF7,0x37,0xEF,0x97,0xDE,0x93,0xBD,0x0E,0x84,0x69,0x52,0xC2,0x10,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x69,0x52,0x0E,0x84,0x93,0xBD,0xF8,0xDE,0x39,0xEF,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,
-	0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0xD5,0xEE,0x35,0xEF,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0xB9,0xF7,0x39,0xEF,0xB0,0x53,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xB0,0x53,0x77,0xD6,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,
-	0x36,0xF7,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x77,0xF7,0xD5,0xEE,0x35,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,
-	0x35,0xF7,0xF4,0xF6,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0x94,0xFE,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x78,0xF7,0x38,0xF7,0x37,0xEF,0xD7,0xEE,0x77,0xD6,0x31,0xB5,0x6C,0x7B,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0xF2,0xA4,0x77,0xD6,0xF8,0xDE,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x77,0xF7,0xF4,0xF6,0x37,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0xD5,0xEE,0xF4,0xF6,0x37,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xB0,0x53,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0xD5,0xEE,0xF4,0xF6,0x36,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x35,0xEF,0x36,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x36,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,
-	0x78,0xF7,0x37,0xEF,0x97,0xDE,0x93,0xBD,0xCE,0x94,0x69,0x52,0x24,0x21,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x69,0x52,0x50,0x8C,0x93,0xBD,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBA,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x35,0xEF,0xD5,0xEE,0xB2,0xF6,0x35,0xEF,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xD3,0x7C,0x4E,0x53,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xB0,0x53,0x50,0x64,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x77,0xF7,
-	0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x78,0xF7,0x78,0xF7,0x35,0xEF,0xB2,0xF6,0xB2,0xF6,0xD5,0xEE,0x35,0xEF,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xEF,0xD7,0xEE,0x77,0xD6,0x31,0xB5,0x8D,0x73,0xE7,0x41,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0xF2,0xA4,0x77,0xD6,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xEF,0xF4,0xF6,0xB2,0xF6,0xF4,0xF6,0x78,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xFF,
-	0x54,0x95,0xCD,0x2A,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xCD,0x2A,0x50,0x64,0x79,0xFF,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0x37,0xEF,0x78,0xF7,0x0F,0xE6,0x78,0xF7,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x39,0xEF,0x97,0xDE,0x93,0xBD,0xCE,0x94,0xCA,0x5A,0x24,0x21,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x69,0x52,0x0E,0x84,0x93,0xBD,0x77,0xD6,0x39,0xEF,0x7A,0xF7,
-	0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x7A,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x35,0xEF,0x37,0xEF,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0x5A,0xEF,0x50,0x64,0xCD,0x2A,0x54,0x95,0x54,0x95,0xB0,0x53,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xB0,0x53,0x8E,0xDD,0x91,0xD5,0xCD,0x2A,0xB0,0x53,0x39,0xEF,0x78,0xF7,0x77,0xF7,
-	0x37,0xF7,0x77,0xF7,0x37,0xF7,0x78,0xF7,0x37,0xF7,0xB2,0xF6,0x35,0xEF,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x35,0xF7,0xE5,0xE4,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x78,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0xF8,0xDE,0x36,0xC6,0xF1,0xA4,0x6C,0x7B,0xE7,0x41,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0x2B,0x6B,0xD2,0x9C,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xB2,0xF6,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x36,0xF7,0x36,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xF8,0xDE,0x36,0xC6,
-	0xB9,0xF7,0xFA,0xF7,0xD3,0x7C,0xB0,0x53,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xB0,0x53,0x50,0x64,0xB9,0xF7,0xB9,0xF7,0x36,0xC6,0x77,0xD6,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x38,0xF7,0x35,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x36,0xF7,0x35,0xEF,0xF4,0xF6,0x8E,0xDD,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0x90,0xF6,0xBA,0xF7,0x7A,0xF7,
-	0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0x36,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,
-	0x97,0xDE,0x93,0xBD,0x0E,0x84,0x69,0x52,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0xAD,0x83,0x33,0xB5,0x77,0xD6,0x39,0xEF,
-	0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x35,0xEF,0x8E,0xDD,0x7A,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x36,0xF7,0x35,0xEF,0xD5,0xEE,0x36,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0x36,0xC6,0xCD,0x2A,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xB0,0x53,0x2D,0xAD,0x50,0x64,0x54,0x95,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x77,0xF7,
-	0x78,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0x78,0xF7,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0x35,0xF7,0x2E,0xCD,0xE5,0xE4,0x8E,0xDD,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x37,0xF7,0xBA,0xF7,0x77,0xF7,0x78,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x78,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x39,0xEF,0x97,0xDE,0xD4,0xCD,0xF0,0xA4,0x2B,0x6B,0x65,0x31,0xA1,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x65,0x31,0xCA,0x5A,0xCE,0x94,0xD6,0xB5,0xF8,0xDE,0x39,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x79,0xF7,0x0F,0xE6,0x8E,0xDD,0xE5,0xE4,0x0F,0xE6,0xF4,0xF6,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x78,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x7A,0xF7,
-	0x77,0xD6,0x30,0x43,0x50,0x64,0x50,0x64,0xB0,0x53,0x50,0x64,0xB0,0x53,0x30,0x43,0x2D,0xAD,0xCE,0x94,0xCD,0x2A,0xD6,0xB5,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xEF,0x35,0xEF,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x8E,0xDD,0xD5,0xEE,0x8E,0xDD,0xFA,0xF7,0x79,0xF7,0xBA,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x36,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0xF8,0xDE,0x77,0xD6,
-	0x33,0xB5,0x8D,0x73,0x69,0x52,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0xE7,0x41,0x4C,0x6B,0xF1,0xA4,0x77,0xD6,
-	0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x38,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x77,0xF7,0xE5,0xE4,0xE5,0xE4,0x0F,0xE6,
-	0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x37,0xF7,0xBA,0xF7,0x78,0xF7,0x78,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x36,0xC6,0x30,0x43,0xB0,0x53,0xB0,0x53,0x50,0x64,0xB0,0x53,0xB0,0x53,0x50,0x64,0x2D,0xAD,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xCD,0x2A,0xD6,0xB5,0x79,0xF7,0x78,0xF7,0x37,0xF7,
-	0x79,0xF7,0x78,0xF7,0x36,0xF7,0x78,0xF7,0x35,0xEF,0x37,0xF7,0x78,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0xB9,0xF7,0x54,0x95,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0xBA,0xF7,0xB9,0xF7,0x36,0xF7,0x79,0xF7,0x36,0xF7,0x79,0xF7,0x79,0xF7,0x77,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,
-	0x37,0xF7,0x77,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x93,0xBD,0xCE,0x94,0xCA,0x5A,0x24,0x21,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xC2,0x10,0xE7,0x41,0x0E,0x84,0x93,0xBD,0xB9,0xD6,0x39,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x78,0xF7,0xBB,0xF7,0x78,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xE5,0xE4,0x8E,0xDD,0x0F,0xE6,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x78,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0xD3,0x7C,0xCD,0x2A,
-	0xB0,0x53,0x50,0x64,0xB0,0x53,0xB0,0x53,0x50,0x64,0x30,0x43,0x50,0x64,0x8E,0xDD,0x50,0x64,0xB0,0x53,0x50,0x64,0xB0,0x53,0xCD,0x2A,0x50,0x64,0x39,0xEF,0x78,0xF7,0x35,0xF7,0x79,0xF7,0x78,0xF7,0x36,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0xB9,0xF7,0x77,0xD6,0x50,0x64,0xF8,0xDE,0xBA,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x36,0xF7,0x78,0xF7,0x79,0xF7,0x35,0xEF,0x78,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0xB9,0xF7,0x7A,0xF7,0xBA,0xF7,0x39,0xEF,0xF8,0xDE,0x36,0xC6,0xF2,0xA4,
-	0x6C,0x7B,0xE7,0x41,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0xCA,0x5A,0x50,0x8C,
-	0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x79,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0x39,0xEF,0xFA,0xF7,0x36,0xC6,0x77,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0xBB,0xF7,0x37,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x39,0xEF,0x54,0x95,0xB0,0x53,0xCD,0x2A,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xCE,0x94,0xCE,0x94,0x30,0x43,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0x30,0x43,0x30,0x43,0xD3,0x7C,
-	0xF8,0xDE,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xD3,0x7C,0x50,0x64,0x54,0x95,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x35,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0xF8,0xDE,0x77,0xD6,0x33,0xB5,0xAD,0x83,0x69,0x52,0xC2,0x10,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0x65,0x31,0x2B,0x6B,0xF1,0xA4,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0x78,0xF7,0x7A,0xF7,0xBC,0xF7,0x79,0xF7,0xBB,0xF7,0x7A,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0x36,0xC6,0xD3,0x7C,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x36,0xC6,0xD3,0x7C,0xD3,0x7C,0xD3,0x7C,0x50,0x64,0x30,0x43,0xCD,0x2A,
-	0xD3,0x7C,0x50,0x64,0xB0,0x53,0xB0,0x53,0xAF,0x2A,0x2D,0xAD,0x2D,0xAD,0x30,0x43,0xB0,0x53,0xB0,0x53,0x50,0x64,0xD3,0x7C,0x30,0x43,0xCD,0x2A,0x50,0x64,0xD3,0x7C,0xD3,0x7C,0xD3,0x7C,0x36,0xC6,0x39,0xEF,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x36,0xC6,0x50,0x64,0x50,0x64,0x50,0x64,0xF8,0xDE,0xB9,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x36,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0xCE,0x94,0xCA,0x5A,
-	0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,
-	0x0E,0x84,0x33,0xB5,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0x7A,0xF7,0x79,0xF7,0xBC,0xF7,0x7A,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xD3,0x7C,0x50,0x64,0x77,0xD6,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x79,0xF7,0xBA,0xF7,0x39,0xEF,0xF8,0xDE,0x39,0xEF,0xB9,0xD6,0x50,0x64,0xCD,0x2A,0xD3,0x7C,0x77,0xD6,0x54,0x95,0x30,0x43,0x30,0x43,0xCE,0x94,0x2D,0xAD,0xB0,0x53,0x30,0x43,0xB0,0x53,0xB0,0x53,0xB0,0x53,0x30,0x43,0xD3,0x7C,0x77,0xD6,0xD3,0x7C,0xCD,0x2A,0x50,0x64,
-	0x36,0xC6,0xF8,0xDE,0xF8,0xDE,0x39,0xEF,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x39,0xEF,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xD3,0x7C,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x36,0xF7,0x77,0xF7,0xBA,0xF7,0x7A,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,
-	0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0x7A,0xF7,0x39,0xEF,0xF8,0xDE,0xD4,0xCD,0xF0,0xA4,0x2B,0x6B,0x65,0x31,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0xCA,0x5A,0x50,0x8C,0x93,0xBD,0x77,0xD6,0x39,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x78,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x77,0xD6,0x50,0x64,0x50,0x64,0xD3,0x7C,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x37,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0xD6,0xB5,0xD6,0xB5,0x5A,0xEF,0xBA,0xF7,0x58,0xC6,
-	0xCD,0x2A,0xB0,0x53,0x30,0x43,0x90,0x84,0x2D,0xAD,0x30,0x43,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xCD,0x2A,0xD6,0xB5,0xBA,0xFF,0x37,0xEF,0xD6,0xB5,0xD6,0xB5,0x7A,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0xD3,0x7C,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x54,0x95,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x36,0xF7,0x36,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x36,0xC6,0xF1,0xA4,0x8D,0x73,0x69,0x52,0x24,0x21,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,
-	0x65,0x31,0x2B,0x6B,0x50,0x8C,0x93,0xBD,0xB9,0xD6,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x79,0xF7,0x7A,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xD3,0x7C,0x50,0x64,0x50,0x64,0x50,0x64,
-	0xD6,0xB5,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0x78,0xF7,0x37,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xBA,0xF7,0xD3,0x7C,0x4F,0x22,0xAF,0x2A,0x50,0x64,0x8E,0xDD,0x30,0x43,0xAF,0x2A,0xB0,0x53,0xB0,0x53,0x30,0x43,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xAF,0x2A,0x50,0x64,0x79,0xF7,0x79,0xF7,
-	0x36,0xF7,0x37,0xEF,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0xD3,0x7C,0xD3,0x7C,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x90,0x84,0x90,0x84,0x54,0x95,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x36,0xF7,0x37,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x37,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0xB9,0xF7,0x39,0xEF,0xF8,0xDE,0x36,0xC6,0x33,0xB5,0x0E,0x84,0x69,0x52,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0x2B,0x6B,0xB1,0x9C,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0x79,0xF7,0x78,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x54,0x95,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0xF8,0xDE,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x78,0xF7,0x37,0xF7,0x39,0xEF,0x58,0xC6,0xB0,0x53,0xAF,0x63,
-	0x2D,0xAD,0x50,0x64,0x50,0x64,0xB0,0x53,0xB0,0x53,0xB0,0x53,0x30,0x43,0xB0,0x53,0x30,0x43,0xB0,0x53,0x30,0x43,0xB0,0x53,0x30,0x43,0x50,0x64,0xD7,0xB5,0x39,0xEF,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0x79,0xF7,0xF8,0xDE,0xF8,0xDE,0x77,0xD6,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x37,0xEF,0x97,0xDE,
-	0xF8,0xDE,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x33,0xB5,0x0E,0x84,0x69,0x52,0x65,0x31,0xA1,0x10,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xC2,0x10,0xE7,0x41,0x2B,0x6B,0xB1,0x9C,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x79,0xF7,0x38,0xF7,0x79,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x54,0x95,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,
-	0x50,0x64,0x50,0x64,0xF8,0xDE,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,0x37,0xF7,0x37,0xEF,0x78,0xF7,0x7A,0xF7,0x7A,0xF7,0x39,0xEF,0x90,0x84,0xB0,0x53,0x2D,0xAD,0x30,0x43,0xCF,0x32,0x30,0x43,0x30,0x43,0x30,0x43,0xB0,0x53,0x30,0x43,0xB0,0x53,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xB0,0x53,0x77,0xD6,0xBA,0xF7,
-	0x79,0xF7,0x79,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0x39,0xEF,0x50,0x64,0x50,0x64,0xB0,0x53,0x50,0x64,0x50,0x64,0xCE,0x94,0xD3,0x7C,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,
-	0x37,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0xCE,0x94,0xCA,0x5A,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0xE7,0x41,0x6C,0x7B,0xF1,0xA4,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x36,0xC6,0xD6,0xB5,0xD6,0xB5,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x31,0xB5,0x36,0xC6,0xD6,0xB5,0x5A,0xEF,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0xB9,0xF7,0xD6,0xB5,0x0D,0x53,0x2D,0xAD,0x30,0x43,
-	0xCF,0x32,0x30,0x43,0xB0,0x53,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xCF,0x32,0x4F,0x22,0xD3,0x7C,0x39,0xEF,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xF8,0xDE,0xD3,0x7C,0xB0,0x53,0x50,0x64,0xB0,0x53,0x50,0x64,0xCE,0x94,0x50,0x64,0xB0,0x53,0xD3,0x7C,
-	0x39,0xEF,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0x50,0x8C,0xCA,0x5A,0x65,0x31,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0xE7,0x41,0x8D,0x73,0xF2,0xA4,0x36,0xC6,0x97,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x5A,0xEF,0xD3,0x7C,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,
-	0x90,0x84,0x36,0xC6,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0xFA,0xDE,0x0F,0xE6,0x6C,0x7B,0xAF,0x2A,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xAF,0x2A,0x0D,0x53,
-	0x2D,0xAD,0xF8,0xDE,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x54,0x95,0x50,0x64,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0x50,0x64,0x50,0x64,0xB0,0x53,0xB0,0x53,0xB0,0x53,0x50,0x64,0xD6,0xB5,0x38,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x38,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0x70,0x94,0x2B,0x6B,0x65,0x31,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0x69,0x52,0xAD,0x83,0xF2,0xA4,0x36,0xC6,0xB9,0xD6,0x5A,0xEF,0x5A,0xEF,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0x5A,0xEF,0xD3,0x7C,0x50,0x64,0xB0,0x53,0xB0,0x53,0x50,0x64,0x50,0x64,0x50,0x64,0x50,0x64,0x77,0xD6,0xBB,0xF7,0x7A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0xBB,0xF7,0xD3,0x63,0xCD,0x2A,0x30,0x43,0x30,0x43,0x30,0x43,
-	0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xCF,0x32,0x30,0x43,0xCE,0x94,0x7A,0xF7,0x39,0xEF,0xD7,0xB5,0x54,0x95,0xD3,0x7C,0xB0,0x53,0x50,0x64,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xCE,0x94,0xB0,0x53,0xB0,0x53,0x50,0x64,0x50,0x64,
-	0xB0,0x53,0x54,0x95,0x54,0x95,0x36,0xC6,0x39,0xEF,0x37,0xF7,0x77,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0xB1,0x9C,0x2B,0x6B,0xE7,0x41,0xC2,0x10,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0x69,0x52,0xAD,0x83,0xF2,0xA4,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xB9,0xD6,0x50,0x64,0x50,0x64,0xB0,0x53,0x50,0x64,0xB0,0x53,0x50,0x64,0xCE,0x94,
-	0xB0,0x53,0xB0,0x53,0xB0,0x53,0x54,0x95,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xB0,0x53,0x2F,0x1A,0x30,0x43,0x30,0x43,0xCF,0x32,0x30,0x43,0x30,0x43,0xCF,0x32,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xCF,0x32,0x30,0x43,0x0E,0x84,
-	0x4F,0x22,0xCF,0x32,0x5A,0xEF,0xBA,0xF7,0xD6,0xB5,0x54,0x95,0x58,0xC6,0xD3,0x7C,0xB0,0x53,0x50,0x64,0xCE,0x94,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0x54,0x95,0x36,0xC6,0x54,0x95,0xD6,0xB5,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0xBA,0xF7,0x79,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0xCE,0x94,0x4C,0x6B,0xE7,0x41,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA1,0x10,0x24,0x21,0x69,0x52,0x8D,0x73,0xF1,0xA4,0x36,0xC6,0xB9,0xD6,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0x58,0xC6,0xD3,0x7C,0x50,0x64,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0x50,0x64,0xCE,0x94,0xB0,0x53,0xB0,0x53,0x50,0x64,0x50,0x64,0xB0,0x53,0xD3,0x7C,0x56,0x9D,0xF8,0xDE,0xBB,0xFF,0xB9,0xD6,0xAF,0x2A,0xCD,0x11,0x30,0x43,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,
-	0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0x30,0x43,0xAF,0x2A,0x30,0x43,0x8E,0xDD,0x50,0x64,0xAD,0x09,0x4F,0x22,0x58,0xC6,0xBB,0xF7,0x39,0xEF,0x50,0x64,0xB0,0x53,0xEF,0x7B,0x50,0x64,0xB0,0x53,0x30,0x43,0xB0,0x53,0xB0,0x53,0x30,0x43,0xB0,0x53,
-	0xD3,0x7C,0x37,0xEF,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0xBA,0xF7,0x79,0xF7,0x7A,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0x50,0x8C,0x2B,0x6B,0xE7,0x41,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x24,0x21,0xE7,0x41,0x6C,0x7B,0xB1,0x9C,0x36,0xC6,0x77,0xD6,0xFA,0xDE,0x5A,0xEF,0x7A,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x5A,0xEF,0xFA,0xDE,0xD6,0xB5,0x50,0x64,0x56,0x9D,0xD3,0x7C,0xB0,0x53,0x50,0x64,0xEF,0x7B,0xB0,0x53,0xB0,0x53,
-	0xB0,0x53,0x50,0x64,0x56,0x9D,0xD3,0x7C,0xD3,0x7C,0xB9,0xD6,0xFA,0xDE,0xD3,0x63,0x2B,0x09,0xCD,0x11,0x30,0x43,0x30,0x43,0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,0x30,0x43,0xCF,0x32,0x30,0x43,0xCF,0x32,0x30,0x43,0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,
-	0xCF,0x32,0x30,0x43,0x4F,0x22,0x09,0x01,0xB0,0x53,0xB9,0xD6,0xD3,0x7C,0xCE,0x94,0x30,0x43,0xB0,0x53,0x30,0x43,0xB0,0x53,0x30,0x43,0x30,0x43,0xB0,0x53,0x30,0x43,0xD3,0x7C,0xF8,0xDE,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,
-	0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x33,0xB5,0xCE,0x94,0xCA,0x5A,0xE7,0x41,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0xE7,0x41,0x4C,0x6B,0x70,0x94,0x93,0xBD,0x77,0xD6,0xF8,0xDE,0x5A,0xEF,
-	0x5C,0xEF,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0x54,0x95,0xB0,0x53,0x90,0x84,0xAF,0x63,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0xB0,0x53,0x50,0x64,0xFA,0xDE,0xB9,0xD6,0xD3,0x63,0xAD,0x09,0xAD,0x09,0x56,0x9D,0x54,0x95,0x2F,0x1A,0xAF,0x2A,0xCF,0x32,0xCF,0x32,0xAF,0x2A,0xCF,0x32,
-	0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xAF,0x2A,0xAF,0x2A,0x8E,0xDD,0xAF,0x63,0x2F,0x1A,0xCD,0x11,0xD3,0x7C,0xD6,0xB5,0xCF,0x11,0xAD,0x09,0xB0,0x53,0x54,0x95,0x54,0x95,0xB0,0x53,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,
-	0x30,0x43,0x50,0x64,0x77,0xD6,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x7A,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,0x39,0xEF,0x97,0xDE,0x36,0xC6,0x33,0xB5,0x0E,0x84,0xCA,0x5A,0x65,0x31,0xC2,0x10,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0xC2,0x10,0xE7,0x41,0xCA,0x5A,0x50,0x8C,0x93,0xBD,0x36,0xC6,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xD7,0xB5,0x50,0x64,0xCE,0x94,0xB0,0x53,0xB0,0x53,0x30,0x43,0xB0,0x53,0x30,0x43,
-	0x30,0x43,0x30,0x43,0xB0,0x53,0xB9,0xD6,0x56,0x9D,0xD6,0xB5,0xFA,0xDE,0xBB,0xF7,0xBC,0xF7,0x30,0x43,0xCD,0x11,0xB0,0x53,0x4F,0x22,0xCD,0x11,0xB0,0x53,0x30,0x43,0xAF,0x2A,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xB0,0x53,0xED,0x4A,0xCD,0x2A,
-	0xB0,0x53,0x4F,0x22,0x4F,0x22,0x5A,0xEF,0xD6,0xB5,0xD3,0x7C,0x34,0x74,0xB5,0x8C,0xD6,0xB5,0xB0,0x53,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xB0,0x53,0x31,0xB5,0x39,0xEF,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x39,0xEF,0xF8,0xDE,0x77,0xD6,
-	0xD4,0xCD,0xF1,0xA4,0x0E,0x84,0x69,0x52,0x65,0x31,0xC2,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0xC2,0x10,0x65,0x31,0xCA,0x5A,0x50,0x8C,0x33,0xB5,0x36,0xC6,
-	0x97,0xDE,0xFA,0xDE,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0x5A,0xEF,0xD2,0x9C,0x50,0x64,0x4E,0x53,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xB0,0x53,0x30,0x43,0xB0,0x53,0x58,0xC6,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x58,0xC6,0xB5,0x8C,0x5A,0xEF,0x30,0x43,0xAD,0x09,0x58,0xC6,0x56,0x9D,0x4F,0x22,
-	0xAF,0x2A,0xCF,0x32,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xCF,0x32,0xAF,0x2A,0x2F,0x1A,0x30,0x43,0x50,0xFF,0xD7,0xB5,0xAF,0x09,0x4F,0x22,0x5A,0xEF,0x56,0x9D,0x54,0x95,0xB0,0x53,0x30,0x43,0x30,0x43,0xCF,0x32,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,
-	0x30,0x43,0xAF,0x63,0x30,0x43,0xD6,0xB5,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xBA,0xF7,0x79,0xF7,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0xF0,0xA4,0xAD,0x83,0x69,0x52,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0xC2,0x10,0x65,0x31,0xCA,0x5A,0xAD,0x83,0xF1,0xA4,0xD6,0xB5,0x77,0xD6,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,0xBC,0xF7,0xF8,0xDE,0xF0,0xA4,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,
-	0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xAF,0x63,0x93,0xBD,0xBC,0xF7,0xBC,0xF7,0x5A,0xEF,0xBC,0xF7,0x5A,0xEF,0xB5,0x8C,0xBB,0xF7,0xBB,0xF7,0xAF,0x2A,0x4F,0x22,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xCF,0x32,0x2F,0x1A,0xAF,0x2A,0x4C,0x6B,0x5A,0xEF,0xBC,0xF7,
-	0x54,0x95,0xB9,0xD6,0xD3,0x63,0x34,0x74,0x34,0x74,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xAF,0x63,0x30,0x43,0xCF,0x32,0x34,0x74,0x39,0xEF,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x39,0xEF,0x39,0xEF,0x97,0xDE,0x36,0xC6,0x33,0xB5,0xCE,0x94,
-	0x4C,0x6B,0x69,0x52,0x65,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA6,0x08,0xA7,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x24,0x21,0x69,0x52,0x2B,0x6B,
-	0x50,0x8C,0x33,0xB5,0x36,0xC6,0xB9,0xD6,0x39,0xEF,0x5A,0xEF,0xD7,0xB5,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x34,0x74,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xCF,0x32,0xAD,0x09,0xAF,0x2A,
-	0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x09,0xCE,0x94,0xCE,0x94,0x0E,0x01,0x2F,0x1A,0xFA,0xDE,0xD3,0x7C,0x34,0x74,0x54,0x95,0x30,0x43,0xAF,0x2A,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,
-	0x4E,0x53,0xAF,0x63,0xCF,0x32,0xB0,0x53,0xD3,0x7C,0xB0,0x53,0xB5,0x8C,0xF8,0xDE,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0x93,0xBD,0xF1,0xA4,0x0E,0x84,0xCA,0x5A,0xE7,0x41,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0xA5,0x08,0xA7,0x08,0xA7,0x08,0x63,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0x65,0x31,0xCA,0x5A,0x0E,0x84,0xF2,0xA4,0x93,0xBD,0x77,0xD6,0xB5,0x8C,0x30,0x43,0xCF,0x32,0x30,0x43,0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,
-	0x30,0x43,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCE,0x94,0xCF,0x32,0xB0,0x53,0xB9,0xD6,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xFF,0x30,0x43,0x6E,0x01,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0x4F,0x22,0xAF,0x09,0xAF,0x63,0x0E,0x84,0x2F,0x1A,0xAD,0x09,0xAF,0x2A,
-	0xBB,0xF7,0xBC,0xF7,0x58,0xC6,0x34,0x74,0xB0,0x53,0x30,0x43,0xD3,0x63,0xAF,0x2A,0xCF,0x32,0xAF,0x2A,0xCF,0x32,0xAF,0x2A,0xCF,0x32,0xAF,0x2A,0xCF,0x32,0xCF,0x32,0x90,0x84,0x30,0x43,0xD3,0x63,0x34,0x74,0xF8,0xDE,0x79,0xF7,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0x77,0xD6,0xD4,0xCD,0x33,0xB5,0xCE,0x94,0x6C,0x7B,0x69,0x52,0x65,0x31,
-	0xC2,0x10,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x64,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0xA6,0x08,0xC8,0x08,0xA7,0x08,0xC8,0x08,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0xA1,0x10,
-	0x24,0x21,0xE7,0x41,0x0E,0x84,0xB5,0x8C,0x30,0x43,0xB0,0x53,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,0xCF,0x32,0x30,0x43,0xCF,0x32,0xAF,0x63,0x4E,0x53,0xCF,0x32,0xB0,0x53,0x30,0x43,0xB5,0x8C,0xFA,0xDE,0xBB,0xF7,0x30,0x43,0x6E,0x01,0xAF,0x2A,0x4F,0x22,0x4F,0x22,
-	0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0xCF,0x11,0xCF,0x32,0x2E,0xCD,0xAF,0x2A,0x6F,0x01,0xAF,0x2A,0xAF,0x2A,0x6E,0x01,0x4F,0x22,0x5A,0xEF,0x5A,0xEF,0xBA,0xF7,0xD7,0xB5,0xF8,0xDE,0xCF,0x32,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,
-	0x50,0x64,0xF8,0xDE,0xD6,0xB5,0x79,0xF7,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0x97,0xDE,0x36,0xC6,0x93,0xBD,0xF0,0xA4,0xAD,0x83,0xCA,0x5A,0xE7,0x41,0x24,0x21,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x08,0xC8,0x08,0xA6,0x00,0x64,0x08,0x63,0x00,0x63,0x08,0xA5,0x00,0xA7,0x08,0xCA,0x08,0xCA,0x08,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x53,0x22,0x53,0x22,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x69,0x52,0xD3,0x7C,0xEF,0x7B,0xB1,0x9C,0x54,0x95,0x30,0x43,0x30,0x43,0xCF,0x32,0xB0,0x53,0xCF,0x32,0xCF,0x32,0xAF,0x2A,0xCF,0x32,0xCF,0x32,0xAF,0x2A,
-	0xCF,0x32,0xCF,0x32,0xCF,0x32,0xB0,0x53,0xCF,0x32,0xB0,0x53,0xD3,0x63,0x5C,0xEF,0xB9,0xD6,0x56,0x9D,0xCF,0x11,0x6E,0x01,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0xAF,0x2A,0xCF,0x32,0xEF,0x7B,0xCF,0x32,0x2F,0x1A,0x4F,0x22,0x4F,0x22,0xAF,0x2A,
-	0xAD,0x09,0xAD,0x09,0x56,0x9D,0x7A,0xF7,0x5A,0xEF,0xB0,0x53,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0x0E,0x84,0xAF,0x2A,0x34,0x74,0x39,0xEF,0x39,0xEF,0xF8,0xDE,0x97,0xDE,0x77,0xD6,0x93,0xBD,0xF1,0xA4,0x0E,0x84,0x2B,0x6B,0x69,0x52,0x65,0x31,0xC2,0x10,0x60,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA5,0x08,0xA6,0x00,0xC8,0x08,0xCA,0x08,0xA7,0x08,0x63,0x00,0x62,0x00,0x63,0x08,0x64,0x00,0xA6,0x08,0xA4,0x00,0xA7,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x08,0x5A,0x33,
-	0x5A,0x33,0x98,0x22,0x5A,0x33,0x2F,0x1A,0xA6,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x60,0x08,0xA1,0x10,0x65,0x31,0xCA,0x5A,0xD2,0x9C,0x33,0xB5,0xD3,0x63,0xD6,0xB5,0xCF,0x32,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0x4E,0x53,0x33,0xB5,0x56,0x9D,0x56,0x9D,0xFA,0xDE,0x5A,0xEF,0x56,0x9D,0x30,0x43,0xCF,0x11,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,
-	0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x6F,0x01,0x6F,0x01,0x8E,0xDD,0x8D,0x73,0x6F,0x01,0x2F,0x1A,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0xAF,0x09,0xCF,0x32,0x56,0x9D,0xD7,0xB5,0xAF,0x2A,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x0E,0x84,0x4F,0x22,
-	0x4F,0x22,0x4F,0x22,0xD3,0x63,0x77,0xD6,0x77,0xD6,0x93,0xBD,0x33,0xB5,0x50,0x8C,0x6C,0x7B,0xCA,0x5A,0xE7,0x41,0x24,0x21,0xA2,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x00,0x65,0x08,0xA7,0x08,0xA7,0x00,0xCA,0x08,0xCD,0x08,0xCA,0x08,0xA5,0x00,0x63,0x08,0x64,0x00,0xA4,0x08,0x62,0x00,0xA4,0x08,0x62,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x08,0x2F,0x1A,0x5A,0x33,0x5A,0x33,0x5A,0x33,0x5A,0x33,0x98,0x22,0x98,0x22,0x53,0x22,0x53,0x22,0x2F,0x09,0xA7,0x08,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0x65,0x31,0xCA,0x5A,0xEF,0x7B,0x30,0x43,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,
-	0xAF,0x2A,0xCF,0x32,0xAF,0x63,0xAF,0x2A,0xB9,0xD6,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x34,0x74,0xAD,0x09,0x2F,0x1A,0x4F,0x22,0x2F,0x1A,0x4F,0x22,0x2F,0x1A,0x4F,0x22,0x2F,0x1A,0x4F,0x22,0x4F,0x22,0xCF,0x11,0xAF,0x09,0x0E,0x84,0xAF,0x63,0xAF,0x2A,0xAF,0x2A,0x2F,0x1A,0x4F,0x22,0x4F,0x22,0x2F,0x1A,0x4F,0x22,0x2F,0x1A,
-	0x4F,0x22,0xAF,0x09,0xB0,0x53,0xD7,0xB5,0xCF,0x32,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0xAF,0x2A,0x4E,0x53,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x30,0x43,0x54,0x95,0xB1,0x9C,0x8D,0x73,0xCA,0x5A,0xE7,0x41,0x24,0x21,0xC2,0x10,0x60,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC8,0x08,0xC8,0x08,0xCA,0x08,0x0C,0x09,0xCA,0x08,0xCA,0x08,0xCF,0x08,0x11,0x09,0xCF,0x08,0x0C,0x09,0xC8,0x08,0xA4,0x08,0x22,0x00,0x63,0x00,0x64,0x08,0x62,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0x08,0x98,0x22,0x5A,0x33,0x98,0x22,0x5A,0x33,0x5A,0x33,
-	0x98,0x22,0x5A,0x33,0x98,0x22,0x98,0x22,0x53,0x22,0x98,0x22,0x98,0x22,0xB7,0x11,0x72,0x11,0x11,0x09,0xA7,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE7,0x41,0x30,0x43,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0x4F,0x22,0xAF,0x2A,0xAF,0x2A,0x4F,0x22,0xAF,0x2A,0xAF,0x2A,0x4E,0x53,0xAF,0x2A,0xAF,0x2A,0xCF,0x32,0xB9,0xD6,0xBC,0xF7,0x5C,0xEF,0x30,0x43,0x0E,0x01,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,
-	0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xAF,0x2A,0x2F,0x1A,0x2D,0xAD,0x0E,0x84,0x6F,0x01,0x2F,0x1A,0x4F,0x22,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x4F,0x22,0x0E,0x01,0x2F,0x1A,0xB5,0x8C,0x2F,0x1A,0x4F,0x22,0x2F,0x1A,0x4F,0x22,0x2F,0x1A,0x4F,0x22,0xED,0x4A,0xCF,0x32,0xCF,0x32,0x2F,0x1A,0x4F,0x22,
-	0x2F,0x1A,0x4F,0x22,0x2F,0x1A,0xCF,0x32,0x33,0xB5,0xCA,0x5A,0xE7,0x41,0x24,0x21,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x08,0x65,0x00,0xC8,0x08,0x6B,0x00,0x0C,0x09,0xCF,0x08,0xCD,0x08,0xCD,0x08,0xCF,0x08,0x2F,0x09,0xCD,0x08,0xCF,0x08,0xC8,0x08,0x63,0x08,0x62,0x00,0x22,0x00,
-	0x62,0x00,0x62,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x2B,0x09,0x53,0x22,0x5A,0x33,0x98,0x22,0x5A,0x33,0x5A,0x33,0x98,0x22,0x5A,0x33,0x98,0x22,0x98,0x22,0x53,0x22,0x98,0x22,0x98,0x22,0x98,0x22,0x98,0x22,0xB7,0x11,0xCF,0x08,0x72,0x11,0xCF,0x08,0xCF,0x08,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xCA,0x5A,0xAF,0x2A,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0xAF,0x2A,
-	0xCF,0x32,0x30,0x43,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x30,0x43,0xD7,0xB5,0xAD,0x09,0x0E,0x01,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xAF,0x09,0x6F,0x01,0x2E,0xCD,0x0E,0x84,0x6F,0x01,0xCF,0x11,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,
-	0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x6E,0x01,0x6E,0x01,0xB5,0x8C,0x30,0x43,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xAF,0x63,0xAF,0x2A,0x4F,0x22,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x4F,0x22,0xAF,0x63,0xC2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0xA7,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0xA6,0x00,0xA6,0x08,0xA7,0x00,0xA7,0x08,0x69,0x00,0xCA,0x08,0xCA,0x08,0x69,0x00,0xCA,0x08,0xCD,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xC8,0x08,0xC8,0x08,0xA5,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC8,0x08,0x53,0x22,0x98,0x22,0xB7,0x11,0x98,0x22,0x5A,0x33,0x5A,0x33,0x98,0x22,0x98,0x22,0x5A,0x33,
-	0x98,0x22,0x98,0x22,0x98,0x22,0x98,0x22,0x98,0x22,0x50,0x32,0x98,0x22,0xB7,0x11,0x11,0x09,0x72,0x11,0xCF,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x2B,0x09,0x63,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x64,0x00,0x24,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x52,0xD3,0x63,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x2F,0x1A,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x30,0x43,0xED,0x4A,0x4F,0x22,0x4F,0x22,0x4F,0x22,0xB5,0x8C,0xCF,0x32,0x0E,0x01,0xCF,0x11,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xCF,0x11,0xCF,0x11,0x2F,0x1A,
-	0x6F,0x01,0x2F,0x1A,0x2E,0xCD,0x4E,0x53,0xAF,0x2A,0xAF,0x2A,0xAF,0x09,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xCF,0x11,0x0E,0x01,0x4F,0x22,0xB5,0x8C,0xCF,0x32,0x6E,0x63,0xAF,0x2A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,
-	0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xCF,0x11,0x2F,0x1A,0x4F,0x22,0xED,0x4A,0x65,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x6B,0x00,0x11,0x09,0x98,0x22,0xB7,0x11,0xCD,0x11,0x28,0x09,0x49,0x11,0x6F,0x09,0x65,0x08,0x65,0x00,0x66,0x00,0xA6,0x00,0xA7,0x08,0x69,0x00,0xA7,0x00,0xC8,0x08,0xA7,0x00,0xCA,0x08,0xCD,0x08,0xCA,0x08,0x69,0x00,0xC8,0x08,0x66,0x00,0xA5,0x08,
-	0xC8,0x08,0xA7,0x08,0x63,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x98,0x22,0x53,0x22,0xB7,0x11,0x98,0x22,0x5A,0x33,0x5A,0x33,0x98,0x22,0x5A,0x33,0x5A,0x33,0x98,0x22,0x53,0x22,0xB7,0x11,0x98,0x22,0x53,0x22,0x98,0x22,0x98,0x22,0x98,0x22,0x98,0x22,0x53,0x22,0x53,0x22,0xB7,0x11,0x53,0x22,0xB7,0x11,0xB7,0x11,0x53,0x22,0x72,0x11,
-	0x72,0x11,0x4D,0x11,0xE5,0x08,0x63,0x00,0xA6,0x08,0x6E,0x09,0xB7,0x11,0xB7,0x11,0x2F,0x09,0x6B,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x5A,0x4F,0x22,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xAF,0x2A,0x8D,0x73,0x4F,0x22,
-	0x4F,0x22,0x30,0x43,0xB5,0x8C,0x34,0x74,0x4F,0x11,0xD3,0x63,0xB5,0x8C,0xAF,0x09,0xAF,0x09,0x6F,0x01,0xCF,0x11,0x6F,0x01,0xAF,0x09,0xAF,0x2A,0xCF,0x11,0xED,0x4A,0x2E,0xCD,0x4F,0x22,0xAF,0x63,0xCF,0x32,0x6F,0x01,0xAF,0x09,0x2F,0x1A,0xCF,0x11,0x2F,0x1A,0xCF,0x11,0xCF,0x11,0x2F,0x1A,0xCF,0x11,0xCF,0x11,0xCF,0x11,0x2F,0x1A,
-	0xAF,0x09,0xAF,0x09,0x2F,0x1A,0xCF,0x11,0x6E,0x09,0x56,0x9D,0x34,0x74,0x4D,0x11,0xD3,0x63,0xB5,0x8C,0x30,0x43,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0x4F,0x22,0x6E,0x63,0xB0,0x53,0x90,0x84,0x65,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x65,0x00,0x69,0x00,0xA7,0x00,0x24,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x22,0x00,0xA6,0x08,0x4F,0x11,0x72,0x11,0x72,0x11,0x11,0x09,0xCF,0x08,0xCF,0x08,0x72,0x11,0x2F,0x1A,0x53,0x22,
-	0x63,0x00,0xA4,0x08,0x65,0x00,0x65,0x08,0xA6,0x00,0xA7,0x08,0xC8,0x08,0xA7,0x00,0xA7,0x08,0x66,0x00,0x66,0x00,0x69,0x00,0xCA,0x08,0xCA,0x08,0xC8,0x08,0xC8,0x08,0xA6,0x08,0xA6,0x00,0xA7,0x08,0xA7,0x08,0x64,0x08,0x62,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x4D,0x11,0x53,0x22,0xCF,0x11,0xA4,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x09,0x98,0x22,0x53,0x22,0x98,0x22,0x98,0x22,0x2F,0x1A,0x4D,0x11,0x6F,0x09,0xB7,0x11,0xB7,0x11,0x4F,0x11,
-	0x4D,0x11,0x4D,0x11,0x4F,0x11,0x6F,0x09,0x72,0x11,0xB7,0x11,0x98,0x22,0x53,0x22,0x53,0x22,0x53,0x22,0x53,0x22,0x53,0x22,0x53,0x22,0x11,0x09,0x11,0x09,0x53,0x22,0x98,0x22,0x72,0x11,0x72,0x11,0x50,0x32,0x11,0x09,0xCF,0x08,0x2F,0x09,0x72,0x11,0xB7,0x11,0x72,0x11,0x2F,0x09,0xCA,0x08,0x63,0x00,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0xA7,0x00,0x6B,0x00,0x6B,0x00,0x69,0x00,0x69,0x00,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x10,0xED,0x4A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xAF,0x2A,0xAF,0x2A,0xAF,0x63,0x2F,0x1A,0x2F,0x1A,0x30,0x43,0xD7,0xB5,0x34,0x74,0xD3,0x63,0x30,0x43,0xD3,0x63,0xD3,0x63,0x0E,0x01,0x4F,0x22,0xCD,0x21,0xAF,0x09,0xF0,0xA4,0x2F,0x1A,0xED,0x93,0x2D,0xAD,0xCF,0x11,
-	0xEF,0x7B,0x2F,0x1A,0x2F,0x09,0xAF,0x09,0x2F,0x1A,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0x2F,0x1A,0xCF,0x11,0xCF,0x11,0xCF,0x11,0x2F,0x1A,0xCF,0x11,0xCF,0x11,0x30,0x43,0x2F,0x1A,0xCD,0x08,0x6E,0x09,0x6E,0x01,0x4F,0x22,0xB5,0x8C,0x50,0x32,0xD3,0x63,0x34,0x74,0x56,0x9D,0xB0,0x53,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,
-	0xCF,0x11,0xCF,0x11,0x2F,0x1A,0x4E,0x53,0xCF,0x11,0xCF,0x11,0xCF,0x32,0xC2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x69,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,
-	0xCD,0x08,0xCA,0x08,0x4A,0x11,0x49,0x11,0x4A,0x11,0x29,0x09,0x4D,0x11,0x6E,0x09,0x4F,0x11,0x72,0x11,0x6F,0x09,0x4F,0x11,0x53,0x22,0x98,0x22,0x53,0x22,0x72,0x11,0x63,0x00,0x63,0x00,0x64,0x08,0x63,0x00,0x64,0x08,0x64,0x00,0x65,0x08,0x66,0x00,0x66,0x00,0xA5,0x08,0x65,0x00,0xA6,0x08,0x66,0x00,0xA6,0x00,0x66,0x00,0xA7,0x08,
-	0xA7,0x00,0xA7,0x08,0xA6,0x08,0xA5,0x00,0xA5,0x00,0xA6,0x08,0x64,0x08,0x62,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x2B,0x09,0x53,0x22,0x98,0x22,0x98,0x22,0x98,0x22,
-	0x98,0x22,0x53,0x22,0xCF,0x11,0x2B,0x09,0x0C,0x09,0x2F,0x1A,0x2F,0x09,0x72,0x11,0x2F,0x09,0x2B,0x09,0x29,0x09,0x29,0x09,0xCA,0x08,0x0C,0x09,0x0C,0x09,0x0C,0x09,0x2B,0x09,0x0C,0x09,0x29,0x09,0xC8,0x08,0xE7,0x08,0x11,0x09,0x72,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0x98,0x22,0x53,0x22,0x53,0x22,0x2F,0x09,0x2F,0x09,0x2F,0x09,
-	0x72,0x11,0xCD,0x21,0x53,0x22,0x72,0x11,0x53,0x22,0x72,0x11,0x49,0x11,0xCD,0x11,0x72,0x11,0x4F,0x11,0x4F,0x11,0x4D,0x11,0x2B,0x09,0xE7,0x08,0xE7,0x08,0x28,0x09,0xCA,0x08,0xC8,0x08,0x0C,0x09,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x69,0x00,0x23,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x6E,0x63,0x30,0x43,0x4E,0x53,0x2F,0x1A,0x2F,0x1A,0xCF,0x11,0x2F,0x1A,0x4F,0x22,0x2F,0x1A,0xAD,0x83,0xCF,0x32,0xAF,0x2A,0x2F,0x1A,0xCF,0x11,0x2F,0x1A,
-	0x2F,0x1A,0x2F,0x1A,0xCF,0x11,0x2F,0x1A,0x50,0x32,0x30,0x43,0xC7,0x7A,0xCA,0x19,0x0D,0x53,0xB2,0xF6,0xB5,0x8C,0x2D,0xAD,0xAC,0x3A,0x2F,0x1A,0xCF,0x32,0x6F,0x01,0x6F,0x01,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0x6E,0x09,
-	0x50,0x32,0x56,0x9D,0xB5,0x8C,0xCF,0x11,0xCD,0x08,0x6B,0x00,0xCF,0x11,0x30,0x43,0xCF,0x11,0xAF,0x09,0xCF,0x11,0x2F,0x1A,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0x4F,0x22,0x4E,0x53,0x4C,0x6B,0x69,0x52,0xED,0x4A,0x8D,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA7,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCA,0x08,0x6B,0x00,0x0C,0x09,0x47,0x11,0x4D,0x11,0x4F,0x11,0x29,0x09,0x4D,0x11,0x4D,0x11,0x4F,0x11,0x4F,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0xB7,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0xCD,0x11,
-	0x64,0x08,0x64,0x00,0x65,0x08,0x64,0x00,0x65,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x64,0x08,0x63,0x00,0x63,0x08,0x64,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0x65,0x00,0x64,0x08,0x64,0x00,0x64,0x00,0xA5,0x08,0x63,0x08,0x63,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xE7,0x08,0x4D,0x11,0x6F,0x09,0x11,0x09,0x72,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0x72,0x11,0xB7,0x11,0x72,0x11,0x2F,0x09,0x2F,0x09,0x0C,0x09,0x0C,0x09,0x2F,0x09,
-	0x6F,0x09,0x11,0x09,0x11,0x09,0x4D,0x11,0x0C,0x09,0x0C,0x09,0xCA,0x08,0xCA,0x08,0x0C,0x09,0x0C,0x09,0x0C,0x09,0x6E,0x09,0x72,0x11,0xB7,0x11,0x2F,0x1A,0xCD,0x21,0xCD,0x08,0xCD,0x08,0xCF,0x11,0xB7,0x11,0xB7,0x11,0x72,0x11,0x72,0x11,0x11,0x09,0x72,0x11,0x6F,0x09,0x6F,0x09,0x2F,0x09,0x4D,0x11,0x4D,0x11,0x2B,0x09,0x29,0x09,
-	0x0C,0x09,0x4D,0x11,0x29,0x09,0x28,0x09,0xCA,0x08,0x6B,0x00,0x6B,0x00,0x69,0x00,0x6B,0x00,0x69,0x00,0x6B,0x00,0x6B,0x00,0x69,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x69,0x52,0x69,0x52,0x24,0x21,0x4E,0x53,0xED,0x4A,0x6E,0x63,0xCF,0x32,0xAD,0x83,0xED,0x4A,0xCF,0x32,0x2F,0x1A,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0x56,0x9D,0xD3,0x63,0xCF,0x11,0xD3,0x63,0x34,0x74,0x34,0x74,0x36,0xC6,0x4F,0x22,0xCF,0x08,0xAF,0x09,0xAF,0x09,0x6F,0x01,0xCF,0x11,
-	0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x08,0x2D,0xAD,0xD5,0xEE,0x34,0x74,0xD3,0x63,0xD3,0x63,0xCF,0x11,0x30,0x43,0x56,0x9D,0xCF,0x11,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,
-	0xAF,0x09,0xAF,0x09,0x8D,0x73,0xAF,0x09,0x6E,0x09,0x0D,0x53,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCA,0x08,0x6B,0x00,0x49,0x11,0x4D,0x11,
-	0x4D,0x11,0x4A,0x11,0x2B,0x09,0x4D,0x11,0x4D,0x11,0x4F,0x11,0x6F,0x09,0x6F,0x09,0x4F,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0xB7,0x11,0xA5,0x00,0xA5,0x08,0xA5,0x00,0xA6,0x08,0xA6,0x00,0xA7,0x08,0xA7,0x00,0x66,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xC8,0x08,0xA7,0x00,0x65,0x08,0x64,0x00,0xA6,0x08,
-	0x64,0x00,0x63,0x08,0x64,0x00,0xA5,0x08,0x64,0x00,0x64,0x08,0x62,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x63,0x00,0x63,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x63,0x00,
-	0x64,0x00,0x65,0x08,0x69,0x00,0x0C,0x09,0x72,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0x72,0x11,0x11,0x09,0x72,0x11,0x11,0x09,0x72,0x11,0x11,0x09,0x11,0x09,0x72,0x11,0x0C,0x09,0x2B,0x09,0x6E,0x09,0x4F,0x11,0x2B,0x09,0x29,0x09,0xE7,0x08,0xA5,0x08,0xE6,0x08,0xC8,0x08,0xCA,0x08,0x11,0x09,
-	0x72,0x11,0x72,0x11,0x11,0x09,0x11,0x09,0x72,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x11,0x09,0x4F,0x11,0x11,0x09,0x4F,0x11,0x2F,0x09,0x0C,0x09,0x2B,0x09,0xCA,0x08,0xCA,0x08,0x2B,0x09,0x4D,0x11,0x4D,0x11,0x4A,0x11,0xCA,0x08,0x6B,0x00,0x6B,0x00,0x69,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x23,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x34,0x74,0x4C,0x3A,0xED,0x4A,0x50,0x8C,0xCD,0x21,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,
-	0xCF,0x11,0xCF,0x11,0xCF,0x11,0xD3,0x63,0x30,0x43,0x4E,0x53,0x50,0x8C,0xAF,0x63,0xB5,0x8C,0xCD,0x08,0x0E,0x01,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xAF,0x09,0xCF,0x11,0xCF,0x11,0xAF,0x09,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xAF,0x09,
-	0x6F,0x01,0xCD,0x11,0x0C,0x09,0xD3,0x63,0x50,0x32,0xAF,0x09,0xCF,0x11,0x30,0x43,0xD3,0x63,0xCF,0x11,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xCF,0x32,0xCF,0x11,0xAF,0x09,0xAF,0x09,0xAF,0x09,0x4C,0x3A,0x65,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x69,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCA,0x08,0x6B,0x00,0xCA,0x08,0x49,0x11,0x4D,0x11,0x4D,0x11,0x4D,0x11,0x6E,0x09,0x4D,0x11,0x6F,0x09,0x6F,0x09,0x4F,0x11,0x4F,0x11,0x4F,0x11,0x72,0x11,0x4F,0x11,0x4F,0x11,0x72,0x11,0xB7,0x11,0xB7,0x11,0x72,0x11,0x6F,0x09,0x4D,0x11,
-	0x66,0x00,0xA7,0x00,0xA7,0x08,0xA6,0x00,0x66,0x00,0xA7,0x00,0xC8,0x08,0xA7,0x00,0xA7,0x08,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x08,0x66,0x00,0xCA,0x08,0xA7,0x00,0xA6,0x08,0x65,0x00,0xA5,0x08,0x63,0x00,0x64,0x08,0x64,0x00,0x63,0x08,0x63,0x00,0x63,0x08,0x64,0x00,0x64,0x00,0x63,0x08,0x62,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x65,0x00,0x69,0x00,0xCF,0x08,0x11,0x09,0x11,0x09,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,0xB7,0x11,
-	0x72,0x11,0x11,0x09,0x4F,0x11,0x4F,0x11,0x2F,0x09,0x4F,0x11,0x2B,0x09,0x29,0x09,0xA6,0x08,0xE7,0x08,0xA6,0x08,0xA4,0x08,0xE7,0x08,0xC8,0x08,0x28,0x09,0xCA,0x08,0xCA,0x08,0x4D,0x11,0x72,0x11,0xB7,0x11,0x72,0x11,0xB7,0x11,0xB7,0x11,0x72,0x11,0x4F,0x11,0x4F,0x11,0x11,0x09,0x6F,0x09,0x4D,0x11,0x4F,0x11,0x11,0x09,0x6F,0x09,
-	0x6F,0x09,0x4D,0x11,0x0C,0x09,0x4D,0x11,0x0C,0x09,0x0C,0x09,0x0C,0x09,0x47,0x11,0xCA,0x08,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x69,0x00,0x6B,0x00,0x6B,0x00,0x69,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x0D,0x53,0xCF,0x11,0xCF,0x11,0xAF,0x09,0xCF,0x11,0xAF,0x09,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xAF,0x09,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xAF,0x09,0xCF,0x11,0xAF,0x2A,0x34,0x74,0x30,0x43,0x6B,0x00,0x6E,0x01,0xCF,0x11,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xCF,0x11,
-	0xAF,0x09,0xCF,0x11,0xAF,0x09,0xAF,0x09,0xCF,0x11,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xCF,0x11,0x6F,0x01,0xAF,0x09,0x2E,0xCD,0xCF,0x32,0xCF,0x08,0xCD,0x08,0x50,0x32,0x34,0x74,0x6F,0x09,0x6F,0x09,0x6F,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x09,
-	0x4F,0x11,0xED,0x4A,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x4F,0x11,0xED,0x4A,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x23,0x00,0x66,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCA,0x08,0x29,0x09,0x4A,0x11,0x4A,0x11,0x29,0x09,0x4A,0x11,0x4A,0x11,
-	0x4D,0x11,0x4D,0x11,0x4D,0x11,0x4D,0x11,0x6F,0x09,0x72,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x2B,0x09,0x0C,0x09,0x4F,0x11,0x4D,0x11,0x4D,0x11,0x6F,0x09,0x4D,0x11,0xA7,0x08,0xC8,0x08,0xCA,0x08,0xCD,0x08,0xCD,0x08,0x0C,0x09,0xCA,0x08,0x6B,0x00,0xCD,0x08,0xCA,0x08,0x69,0x00,0xC8,0x08,0xC8,0x08,0xA5,0x00,0x64,0x08,0xA5,0x00,
-	0x64,0x08,0xA7,0x00,0xA7,0x08,0x64,0x00,0xA5,0x08,0x63,0x00,0x63,0x00,0x63,0x08,0x63,0x00,0x63,0x08,0xA4,0x00,0xA4,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x66,0x00,0xCA,0x08,0xCF,0x08,0x72,0x11,0x6E,0x09,0xCA,0x08,0x29,0x09,0xC8,0x08,0x63,0x08,0x62,0x08,0x22,0x00,0x63,0x08,0x62,0x00,0xA5,0x08,0x11,0x09,0xB7,0x11,0xB7,0x11,0x2B,0x09,
-	0x29,0x09,0x2B,0x09,0x0C,0x09,0xCD,0x08,0x72,0x11,0x11,0x09,0x72,0x11,0x11,0x09,0x11,0x09,0x6E,0x09,0x11,0x09,0x72,0x11,0x11,0x09,0x0C,0x09,0x2B,0x09,0x4D,0x11,0x6F,0x09,0x2F,0x09,0x2F,0x09,0x4D,0x11,0x0C,0x09,0x0C,0x09,0x4D,0x11,0x0C,0x09,0x29,0x09,0x49,0x11,0xCA,0x08,0x6B,0x00,0x69,0x00,0x6B,0x00,0x69,0x00,0x6B,0x00,
-	0x69,0x00,0x6B,0x00,0xA7,0x00,0x23,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0xED,0x4A,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,
-	0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0x2F,0x1A,0x56,0x9D,0xCF,0x11,0x6B,0x00,0x6F,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xCF,0x11,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0x6F,0x01,0x6F,0x01,
-	0x4C,0x6B,0xAF,0x2A,0x6F,0x01,0xAF,0x09,0x6B,0x00,0x2F,0x09,0xB5,0x8C,0x2F,0x1A,0x6F,0x01,0x6F,0x09,0x6E,0x09,0x6F,0x09,0x6E,0x09,0x6F,0x09,0xAF,0x09,0xAF,0x09,0x8D,0x73,0x6F,0x01,0x6F,0x09,0x6E,0x09,0x6F,0x09,0x6E,0x09,0x50,0x32,0x4E,0x53,0xED,0x4A,0x69,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x09,0x4A,0x11,
-	0xA7,0x08,0x69,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0x6B,0x00,0xCA,0x08,0x4D,0x11,0x4F,0x11,0x4A,0x11,0x49,0x11,0x29,0x09,0x24,0x00,0x65,0x08,0x64,0x08,0xE7,0x08,0x28,0x09,0x4F,0x11,0xB7,0x11,0x72,0x11,0x6F,0x09,0x4F,0x11,0x0C,0x09,0x4D,0x11,0x2B,0x09,0x4D,0x11,0x6E,0x09,0x4F,0x11,0x11,0x09,0x72,0x11,0x4F,0x11,0x63,0x08,
-	0xCA,0x08,0xCD,0x08,0x6B,0x00,0xCD,0x08,0xCA,0x08,0xCD,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x08,0xCF,0x08,0x72,0x11,0x11,0x09,0x72,0x11,0x11,0x09,0x72,0x11,0xCF,0x08,0xA7,0x00,0x66,0x00,0xA7,0x00,0xA6,0x08,0x65,0x00,0xA6,0x08,0xA6,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0xA5,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x63,0x08,0x63,0x00,
-	0x63,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x62,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x64,0x08,0xE7,0x08,0xA6,0x08,0xA6,0x08,0x2F,0x09,0x6F,0x09,0x0C,0x09,0xCA,0x08,0x2F,0x09,0x0C,0x09,0x0C,0x09,0x4F,0x11,0x4D,0x11,0x2F,0x09,0x4F,0x11,0x72,0x11,0x72,0x11,0x72,0x11,
-	0x2F,0x09,0x4D,0x11,0x4D,0x11,0x29,0x09,0xA6,0x08,0xA4,0x08,0x65,0x08,0x64,0x00,0x28,0x09,0x29,0x09,0xCA,0x08,0x4A,0x11,0xE8,0x10,0x49,0x11,0xCA,0x08,0x69,0x00,0x6B,0x00,0x69,0x00,0x6B,0x00,0x69,0x00,0x69,0x00,0x69,0x00,0x4D,0x11,0x4A,0x11,0xE6,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xCA,0x5A,0xCD,0x21,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xD3,0x63,0xB5,0x8C,0xCD,0x08,0xCD,0x08,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,
-	0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xCF,0x08,0x6E,0x63,0x2D,0xAD,0xCF,0x08,0x6F,0x01,0x4F,0x11,0xAF,0x09,0xAF,0x09,0x0E,0x01,0x6B,0x00,0xD3,0x63,0xD3,0x63,0x6F,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0xCF,0x11,0x6E,0x63,
-	0x6E,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6E,0x09,0xED,0x4A,0x24,0x21,0x00,0x00,0x00,0x00,0x62,0x00,0x4A,0x11,0xCD,0x11,0x4D,0x11,0x53,0x22,0x2F,0x09,0x6B,0x00,0xCA,0x08,0xCA,0x08,0x4F,0x11,0x4F,0x11,0x2B,0x09,0x49,0x11,0xA6,0x08,0x65,0x00,0x23,0x00,0x24,0x00,0x64,0x08,0xA5,0x08,0xE5,0x08,
-	0xA5,0x08,0xE6,0x08,0x28,0x09,0x0C,0x09,0x4D,0x11,0x2B,0x09,0x29,0x09,0x4D,0x11,0x4D,0x11,0x4F,0x11,0x4F,0x11,0x72,0x11,0x72,0x11,0xA4,0x08,0x21,0x00,0x21,0x00,0xCF,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0x6B,0x00,0xCD,0x08,0xCD,0x08,0xCF,0x08,0xCF,0x08,0x11,0x09,
-	0x72,0x11,0xCF,0x08,0xCA,0x08,0xCA,0x08,0xA7,0x08,0xA7,0x00,0xA6,0x08,0x65,0x00,0xA6,0x08,0x65,0x00,0xA5,0x08,0x65,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0xA5,0x00,0x64,0x08,0x63,0x08,0x64,0x08,0x63,0x00,0x63,0x08,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0x62,0x00,0x63,0x08,0x63,0x08,0x64,0x08,0x63,0x00,0x63,0x08,0x63,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x62,0x00,0xA6,0x08,0x2F,0x09,0x72,0x11,0x72,0x11,0x6F,0x09,0x4D,0x11,0x2F,0x09,0xCA,0x08,0x0C,0x09,0x0C,0x09,0xCA,0x08,0x6E,0x09,0xCA,0x08,0x0C,0x09,0x4D,0x11,0x0C,0x09,0xA6,0x08,0xA5,0x08,0xE7,0x08,0x63,0x00,0x64,0x08,0x23,0x00,0x23,0x00,0x64,0x08,0xA4,0x08,0xE7,0x08,0x29,0x09,0x2B,0x09,0x4D,0x11,0x6F,0x09,
-	0x4A,0x11,0x69,0x00,0x69,0x00,0x6B,0x00,0x11,0x09,0x53,0x22,0x4A,0x11,0xCD,0x11,0xCD,0x11,0x4D,0x11,0xE6,0x08,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x90,0x84,0x2F,0x1A,0x4F,0x22,0xCF,0x11,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,
-	0x2F,0x1A,0xD3,0x63,0x34,0x74,0x4F,0x11,0x6B,0x00,0xCD,0x08,0xAF,0x09,0xAF,0x09,0x6F,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6F,0x01,0xCF,0x32,0x6E,0x63,
-	0x2F,0x09,0x6F,0x01,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x6F,0x01,0x6B,0x00,0xCD,0x08,0x34,0x74,0xD3,0x63,0x2F,0x1A,0x6F,0x01,0xED,0x4A,0x4F,0x22,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6F,0x09,0x4F,0x11,0x4F,0x22,0x30,0x43,0x50,0x32,0xCF,0x11,0xCD,0x11,0xCA,0x19,0x4A,0x11,
-	0x6F,0x09,0x4F,0x22,0xCD,0x11,0x72,0x11,0x72,0x11,0x4D,0x11,0x4D,0x11,0x29,0x09,0xA6,0x08,0x64,0x08,0x64,0x00,0xA5,0x08,0xE7,0x08,0x29,0x09,0x28,0x09,0x28,0x09,0x2B,0x09,0x6F,0x09,0x4F,0x11,0x2B,0x09,0x4D,0x11,0x4D,0x11,0x4F,0x11,0x6F,0x09,0x4F,0x11,0x2F,0x09,0x4F,0x11,0xA6,0x08,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0xCA,0x08,0x6B,0x00,0xCA,0x08,0xCA,0x08,0x6B,0x00,0xCA,0x08,0x69,0x00,0xA7,0x08,0x69,0x00,0xA7,0x00,0xC8,0x08,0x69,0x00,0x69,0x00,0xCA,0x08,0x69,0x00,0xCA,0x08,0x6B,0x00,0xCA,0x08,0xA7,0x08,0xA6,0x00,0x66,0x00,0x66,0x00,0x64,0x00,0x65,0x08,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x08,
-	0x64,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x61,0x00,0x63,0x08,0x62,0x00,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x62,0x00,0x65,0x08,0x0C,0x09,0x72,0x11,0x0C,0x09,0x4D,0x11,0x4F,0x11,0x2F,0x09,0x0C,0x09,0x29,0x09,0xCA,0x08,0x2B,0x09,0x0C,0x09,
-	0x0C,0x09,0x2B,0x09,0xE7,0x08,0xA5,0x08,0xA4,0x08,0xA6,0x08,0xE6,0x08,0xA5,0x08,0x64,0x08,0x64,0x00,0x23,0x00,0x64,0x08,0xE7,0x08,0xE7,0x08,0x2B,0x09,0x0C,0x09,0x4F,0x11,0xB7,0x11,0x4F,0x11,0xCF,0x11,0xCF,0x11,0x72,0x11,0x4A,0x11,0x4A,0x11,0xCA,0x19,0xCD,0x11,0xCD,0x11,0x4D,0x11,0x4A,0x11,0x27,0x09,0xC8,0x08,0x22,0x00,
-	0x21,0x00,0xCA,0x5A,0xCD,0x21,0x6F,0x09,0x6F,0x09,0xAF,0x09,0x6F,0x01,0xAF,0x09,0x6F,0x09,0xAF,0x09,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x09,0x6E,0x09,0x6F,0x09,0x34,0x74,0xB5,0x8C,0x4F,0x11,0x50,0x32,0x34,0x74,0x30,0x43,0x6E,0x09,0x6E,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,
-	0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0xAF,0x09,0xCF,0x08,0x6E,0x01,0x8E,0xDD,0x4C,0x3A,0xCF,0x08,0x6E,0x09,0xAF,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0x6E,0x09,0x50,0x32,0x34,0x74,0x50,0x32,0x2F,0x09,0x34,0x74,0xB5,0x8C,0x8D,0x73,0x2F,0x09,0x6E,0x09,0x6F,0x01,
-	0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x01,0x72,0x11,0x53,0x22,0x53,0x22,0x4C,0x3A,0xCD,0x21,0x4F,0x11,0xCD,0x11,0x4A,0x11,0x4D,0x11,0x53,0x22,0x72,0x11,0x4A,0x11,0xE6,0x08,0xCF,0x11,0x11,0x09,0x4D,0x11,0xA5,0x08,0xA5,0x08,0x29,0x09,0x6F,0x09,0x6F,0x09,0x4F,0x11,0x4D,0x11,0x4F,0x11,0x72,0x11,
-	0x11,0x09,0x6F,0x09,0x4F,0x11,0x4F,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x72,0x11,0x0C,0x09,0xA6,0x08,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0xCA,0x08,0xCA,0x08,0xC8,0x08,0x69,0x00,0xC8,0x08,0x69,0x00,0xC8,0x08,0x69,0x00,0xA7,0x08,0xC8,0x08,0x69,0x00,0xA7,0x00,0xA7,0x08,0xC8,0x08,0xA7,0x00,0xA7,0x08,
-	0x66,0x00,0xA7,0x00,0x69,0x00,0xA7,0x08,0xA7,0x00,0xA6,0x08,0x66,0x00,0x65,0x08,0xA6,0x00,0x64,0x08,0x23,0x00,0x63,0x00,0x64,0x08,0xA6,0x00,0xA6,0x08,0xA5,0x00,0x64,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x64,0x08,0x62,0x00,0x63,0x00,0x64,0x00,0x63,0x08,0x62,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x11,0x09,0x2F,0x09,0xCD,0x08,0x2F,0x09,0x6F,0x09,0x2F,0x09,0x2F,0x09,0x2F,0x09,0x4D,0x11,0x0C,0x09,0x4F,0x11,0x11,0x09,0x6F,0x09,0x2F,0x09,0x4D,0x11,0x4D,0x11,0x2B,0x09,0x6E,0x09,0x0C,0x09,0x2B,0x09,0xE7,0x08,0x64,0x08,0x64,0x08,0x29,0x09,0x11,0x09,
-	0x72,0x11,0x4D,0x11,0xE6,0x08,0xE7,0x08,0x11,0x09,0xB7,0x11,0xCF,0x11,0xCD,0x11,0x4A,0x11,0x4D,0x11,0x4D,0x11,0x4F,0x11,0x0C,0x09,0x4D,0x11,0x4F,0x11,0x2F,0x1A,0x2F,0x1A,0x11,0x09,0x6F,0x01,0x6E,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6F,0x01,
-	0xED,0x4A,0x2F,0x1A,0x2F,0x1A,0x56,0x9D,0xB5,0x8C,0xCF,0x11,0x0E,0x01,0x6F,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x09,0x6E,0x09,0x6F,0x01,0xAF,0x09,0x6E,0x09,0x6F,0x09,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x09,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x09,0x6E,0x09,0x6F,0x01,0x2F,0x09,0xAF,0x2A,0x4F,0x22,0xED,0x4A,0x2F,0x1A,0x2F,0x09,
-	0x6F,0x01,0x6E,0x09,0x6F,0x09,0x6E,0x09,0x6F,0x01,0x2F,0x09,0xCF,0x11,0x34,0x74,0x56,0x9D,0xAF,0x63,0xCF,0x11,0xED,0x4A,0x6F,0x01,0x6F,0x01,0x6F,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x2F,0x09,0x6F,0x01,0x6F,0x09,0xAF,0x09,0x4F,0x11,0x0C,0x09,0x4D,0x11,0xCD,0x11,0xCD,0x21,0xCD,0x21,0x4A,0x11,0x4A,0x11,0x4F,0x11,0x72,0x11,
-	0x4D,0x11,0xA5,0x08,0xA5,0x08,0x2B,0x09,0x0C,0x09,0x4A,0x11,0x4D,0x11,0x4D,0x11,0x4F,0x11,0x6F,0x09,0x4D,0x11,0x4D,0x11,0x0C,0x09,0x6F,0x09,0x4F,0x11,0x2B,0x09,0x4D,0x11,0x11,0x09,0x72,0x11,0x72,0x11,0x6F,0x09,0x4D,0x11,0xC8,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x66,0x00,0x66,0x00,0xA7,0x08,0xA7,0x00,0xC8,0x08,0xC8,0x08,0x69,0x00,0xCA,0x08,0x69,0x00,0xC8,0x08,0x69,0x00,0xCA,0x08,0x69,0x00,0xC8,0x08,0x66,0x00,0xA7,0x00,0xA7,0x08,0xA6,0x08,0x66,0x00,0x65,0x00,0x66,0x00,0xA6,0x00,0x65,0x08,0x64,0x00,0x64,0x00,0x63,0x00,0x64,0x08,0x65,0x08,0x65,0x00,0x64,0x08,0x64,0x00,0x64,0x08,
-	0x65,0x00,0xA7,0x08,0xA7,0x00,0xA5,0x08,0x64,0x00,0xA5,0x08,0x64,0x00,0x63,0x08,0x62,0x08,0x62,0x00,0x63,0x08,0x62,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x63,0x08,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x08,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0xA6,0x08,0x0C,0x09,0x72,0x11,0xB7,0x11,0xB7,0x11,0x72,0x11,0x11,0x09,
-	0x2F,0x09,0x2F,0x09,0x11,0x09,0x6F,0x09,0x11,0x09,0x11,0x09,0x2F,0x09,0x11,0x09,0x2F,0x09,0x4F,0x11,0x6F,0x09,0x72,0x11,0x72,0x11,0x11,0x09,0x29,0x09,0xE8,0x10,0xE7,0x08,0xCA,0x08,0xC8,0x08,0xA5,0x08,0x64,0x08,0x4A,0x11,0x11,0x09,0x72,0x11,0x4D,0x11,0x29,0x09,0xE8,0x10,0x29,0x09,0xC8,0x08,0x49,0x11,0x4B,0x2A,0x4A,0x11,
-	0x4A,0x11,0x0C,0x09,0xCF,0x11,0xAF,0x09,0x6E,0x09,0x2F,0x09,0x2F,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6E,0x63,0x2F,0x1A,0x30,0x43,0x34,0x74,0x2F,0x1A,0x6B,0x00,0xCF,0x08,0xAF,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,
-	0x6E,0x09,0x6F,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0xCF,0x08,0xCF,0x08,0x2D,0xAD,0xAD,0x83,0xCF,0x08,0xCF,0x08,0x6F,0x01,0x6E,0x09,0x6F,0x09,0x6E,0x01,0x6F,0x09,0x6E,0x09,0x6F,0x01,0x6E,0x01,0x6B,0x00,0x4F,0x11,0x34,0x74,0xD3,0x63,0x2F,0x09,0x6F,0x01,0x6E,0x09,0x6E,0x09,0x6E,0x09,
-	0x2F,0x09,0x2F,0x09,0x2F,0x09,0x6F,0x09,0x6E,0x09,0xCA,0x08,0xCA,0x08,0x29,0x09,0xE9,0x29,0x4A,0x11,0x4D,0x11,0x4A,0x11,0xCD,0x21,0x50,0x32,0x4F,0x11,0x29,0x09,0x28,0x09,0x2B,0x09,0x29,0x09,0x6F,0x09,0x4D,0x11,0x29,0x09,0xE7,0x08,0xA6,0x08,0xE6,0x08,0xC8,0x08,0x4D,0x11,0x11,0x09,0x72,0x11,0x72,0x11,0x11,0x09,0x11,0x09,
-	0x72,0x11,0x2F,0x09,0x4F,0x11,0xCA,0x08,0xA6,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0x66,0x00,0x66,0x00,0xA6,0x08,0x66,0x00,0xA7,0x08,0xA7,0x00,0xA7,0x08,0xA7,0x00,0xA7,0x08,0x66,0x00,0x66,0x00,0xA7,0x08,0x69,0x00,
-	0x66,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0xA6,0x08,0x66,0x00,0x66,0x00,0xA7,0x08,0x66,0x00,0xA6,0x08,0x65,0x00,0x64,0x00,0x64,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x64,0x00,0x65,0x08,0xA6,0x00,0x66,0x00,0xA6,0x08,0xC8,0x08,0xA6,0x00,0x63,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x08,0x64,0x08,0x63,0x00,
-	0x64,0x08,0x64,0x00,0x63,0x00,0x63,0x00,0x63,0x08,0x63,0x00,0x62,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x08,0x62,0x00,0x62,0x08,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x65,0x08,0xCA,0x08,0x0C,0x09,0x11,0x09,0x72,0x11,0x11,0x09,0x11,0x09,0x0C,0x09,0x0C,0x09,0x0C,0x09,0x11,0x09,0x4F,0x11,0xCD,0x08,0x2F,0x09,0xCA,0x08,0x29,0x09,0xE7,0x08,0xE7,0x08,0xC8,0x08,0x2B,0x09,
-	0x2B,0x09,0x0C,0x09,0x6F,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0xA5,0x08,0x2B,0x09,0x6F,0x09,0x0C,0x09,0xE7,0x08,0xE7,0x08,0xE7,0x08,0xE7,0x08,0xC7,0x10,0x49,0x11,0xE8,0x10,0xCA,0x08,0xA7,0x00,0xCA,0x08,0x6F,0x09,0x11,0x09,0x2F,0x09,0xCD,0x08,0x0E,0x01,0x2F,0x09,0x6F,0x01,0x6E,0x09,0xCF,0x11,0xED,0x4A,0xB0,0x53,0x34,0x74,
-	0xD3,0x63,0x6F,0x09,0x6B,0x00,0xCF,0x08,0x6F,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6E,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0xCF,0x08,0xCF,0x08,0x0E,0x84,0x8D,0x73,0x2F,0x09,0x6E,0x09,0x2F,0x09,0x6F,0x01,0x6E,0x09,
-	0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x2F,0x09,0x6F,0x09,0x0E,0x01,0x6B,0x00,0x2F,0x09,0xD3,0x63,0x34,0x74,0x30,0x43,0x6F,0x09,0x4F,0x11,0x4F,0x11,0x6F,0x09,0x72,0x11,0x4D,0x11,0x4A,0x11,0x49,0x11,0xE8,0x10,0x49,0x11,0x4B,0x2A,0x65,0x08,0x47,0x11,0xCA,0x19,0xCD,0x21,0xCD,0x21,0x49,0x11,0xC7,0x10,
-	0x2B,0x09,0x4F,0x11,0x4F,0x11,0xE7,0x08,0xE7,0x08,0xA5,0x08,0xE7,0x08,0xE7,0x08,0x29,0x09,0x2B,0x09,0x0C,0x09,0x4D,0x11,0x2F,0x09,0x29,0x09,0x2B,0x09,0x2F,0x09,0x2B,0x09,0x2F,0x09,0xA6,0x08,0xA4,0x08,0x62,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x62,0x00,
-	0x64,0x08,0x64,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0x65,0x00,0x66,0x00,0x66,0x00,0xA7,0x08,0x66,0x00,0x66,0x00,0xA6,0x08,0x66,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,0xA7,0x08,0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x08,0x65,0x08,0x66,0x00,0x66,0x00,0xA7,0x00,
-	0x65,0x08,0x64,0x08,0x64,0x00,0x64,0x00,0x64,0x08,0x63,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0xA7,0x08,0x63,0x00,0x62,0x00,0x63,0x08,0x63,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x65,0x08,0x64,0x08,0x64,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0x63,0x08,0x64,0x08,0x64,0x00,0x64,0x08,0x65,0x00,0xA4,0x08,0x63,0x08,
-	0x63,0x00,0x63,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0xA7,0x08,
-	0xCA,0x08,0x2F,0x09,0x0C,0x09,0x2F,0x09,0x2F,0x09,0x6F,0x09,0x0C,0x09,0x2F,0x09,0x11,0x09,0x0C,0x09,0x0C,0x09,0xC8,0x08,0xE7,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0xA7,0x08,0xE7,0x08,0xC8,0x08,0x6F,0x09,0x6F,0x09,0xCA,0x08,0x28,0x09,0xE5,0x08,0xC8,0x08,0x29,0x09,0x29,0x09,0xE7,0x08,0xC7,0x10,0x49,0x11,0xA7,0x08,0xC8,0x08,
-	0xC8,0x08,0xE8,0x10,0xC8,0x08,0xC8,0x08,0x49,0x11,0x4D,0x11,0x72,0x11,0x4F,0x11,0x72,0x11,0x4F,0x11,0xCD,0x21,0x4F,0x11,0x4E,0x53,0x56,0x9D,0x56,0x9D,0x50,0x32,0x30,0x43,0x34,0x74,0xCF,0x11,0x0E,0x01,0x4F,0x11,0x0D,0x53,0xB0,0xA4,0xF1,0xA4,0xCF,0x11,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,
-	0x6F,0x01,0x6F,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0xCF,0x08,0x0E,0x01,0xCF,0x32,0xCD,0x21,0xAD,0x83,0x6E,0x63,0xCF,0x08,0x6F,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6F,0x01,0x2F,0x09,0x6F,0x09,0xD3,0x63,0xD3,0x63,0x50,0x32,0x50,0x32,0x50,0x32,0x50,0x32,
-	0x4D,0x11,0x4D,0x11,0xCD,0x21,0x49,0x11,0x24,0x00,0xC7,0x10,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x65,0x08,0x29,0x09,0x28,0x09,0x2B,0x09,0x4F,0x11,0x4D,0x11,0x2B,0x09,0x0C,0x09,0x4D,0x11,0x2B,0x09,0x0C,0x09,0x4F,0x11,0x4D,0x11,0x0C,0x09,0x4D,0x11,0x2F,0x09,0x4D,0x11,0x0C,0x09,0x2F,0x09,0xCD,0x08,0x4F,0x11,
-	0xC8,0x08,0x62,0x08,0x63,0x00,0x22,0x00,0x62,0x08,0x62,0x00,0x62,0x08,0x62,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x63,0x08,0x63,0x08,0xA5,0x08,0xA6,0x08,0xA6,0x08,0x64,0x00,0x65,0x08,0x64,0x00,0x64,0x08,0x65,0x00,0xA6,0x08,0x65,0x00,0x65,0x08,0x65,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0x66,0x00,0x66,0x00,0x65,0x08,
-	0x65,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x00,0x66,0x00,0xA7,0x08,0x66,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x08,0x65,0x00,0xA6,0x00,0x65,0x08,0x65,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x08,0x63,0x00,0x63,0x00,0x22,0x00,0x63,0x00,0x64,0x08,0x62,0x00,0x62,0x00,
-	0x64,0x00,0xA4,0x08,0xA4,0x00,0x64,0x00,0x64,0x08,0x65,0x00,0x65,0x08,0xA5,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x63,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x65,0x00,0xA5,0x08,0x65,0x00,0xA6,0x08,0xA5,0x00,0x65,0x08,0x65,0x00,0xA5,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0x64,0x08,0x63,0x00,
-	0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0xA6,0x08,0x0C,0x09,0x29,0x09,0xCD,0x08,0x0C,0x09,0xC8,0x08,0x0C,0x09,0x0C,0x09,0x0C,0x09,0x0C,0x09,0xCD,0x08,0x2F,0x09,0xCA,0x08,0x2B,0x09,0xCA,0x08,
-	0xE7,0x08,0xC8,0x08,0x2B,0x09,0xCA,0x08,0xCA,0x08,0x4D,0x11,0x4F,0x11,0x2F,0x09,0x29,0x09,0xE7,0x08,0x29,0x09,0x67,0x29,0x47,0x11,0xA6,0x08,0xC7,0x10,0xC7,0x10,0xA4,0x08,0xC7,0x10,0xA7,0x08,0xC7,0x10,0xC7,0x10,0x4A,0x11,0x49,0x11,0x2A,0x1A,0x4F,0x11,0x53,0x22,0x72,0x11,0x72,0x11,0x72,0x11,0x98,0x22,0x72,0x11,0x72,0x11,
-	0x56,0x9D,0xD3,0x63,0x0E,0x01,0x2F,0x09,0xCA,0x5A,0xD1,0xB4,0x35,0xF7,0xFA,0xFF,0x31,0xB5,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x01,0x6F,0x01,0xCF,0x08,0x6E,0x09,0x4F,0x22,0x2F,0x09,0x2D,0xAD,0x8D,0x73,0xCF,0x08,0xCF,0x08,0x6F,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,
-	0x6F,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x0E,0x01,0x53,0x22,0x34,0x74,0x53,0x22,0xCF,0x11,0x50,0x32,0x4A,0x11,0x49,0x11,0xA6,0x08,0x64,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0xA6,0x08,0x29,0x09,0x4F,0x11,0xE7,0x08,
-	0x28,0x09,0xC8,0x08,0xE7,0x08,0xE6,0x08,0xE8,0x10,0x2B,0x09,0x29,0x09,0x29,0x09,0xC8,0x08,0xE7,0x08,0xC8,0x08,0x29,0x09,0x0C,0x09,0x4D,0x11,0x29,0x09,0xA4,0x08,0x62,0x00,0x63,0x08,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x08,0x63,0x08,0x64,0x08,0xA4,0x08,0x64,0x08,0x63,0x00,0x63,0x08,0x62,0x00,0x62,0x00,
-	0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0x65,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0xA7,0x00,0xA7,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0x65,0x00,0x66,0x00,0x64,0x00,0x65,0x08,0x65,0x00,
-	0x65,0x08,0x64,0x00,0x64,0x00,0x65,0x08,0xA6,0x08,0x66,0x00,0x66,0x00,0x64,0x08,0x65,0x00,0x64,0x08,0x64,0x00,0x65,0x08,0x65,0x08,0x64,0x00,0xA7,0x08,0xA6,0x08,0x62,0x00,0x63,0x08,0x22,0x00,0x62,0x00,0x63,0x08,0xA4,0x08,0xA5,0x00,0x65,0x08,0xA6,0x08,0xA7,0x00,0xA7,0x08,0xA7,0x08,0xA6,0x00,0xA5,0x08,0x64,0x00,0x63,0x08,
-	0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x63,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x08,0xA5,0x08,0xA7,0x08,0xA7,0x00,0xA7,0x08,0xA5,0x00,0x64,0x08,0x63,0x00,0x63,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,
-	0x22,0x00,0x62,0x00,0x63,0x08,0x65,0x08,0xC8,0x08,0x6F,0x09,0x2F,0x09,0x0C,0x09,0x0C,0x09,0xCA,0x08,0x29,0x09,0xCA,0x08,0x29,0x09,0x2B,0x09,0xCA,0x08,0x0C,0x09,0x0C,0x09,0x29,0x09,0xA7,0x08,0xE7,0x08,0xC8,0x08,0xE7,0x08,0xA7,0x08,0xE7,0x08,0x4F,0x11,0xE7,0x08,0x65,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,
-	0x64,0x08,0xA5,0x08,0x23,0x00,0x64,0x08,0xC7,0x10,0xA6,0x08,0xE8,0x10,0x49,0x11,0x49,0x11,0xCA,0x19,0x2F,0x1A,0x2F,0x1A,0x50,0x32,0x72,0x11,0x53,0x22,0x5A,0x33,0x53,0x22,0x11,0x09,0xCF,0x08,0x0C,0x09,0xAD,0x83,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x35,0xEF,0xAF,0x2A,0x6E,0x09,0x6F,0x01,0x2F,0x09,0x6F,0x01,0x0E,0x01,0x6F,0x01,
-	0xCF,0x08,0xCF,0x08,0xCF,0x11,0x4F,0x22,0x6F,0x09,0x2E,0xCD,0xED,0x4A,0xCF,0x08,0x6F,0x09,0x2F,0x09,0x6F,0x01,0x6E,0x09,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x6F,0x01,0x6E,0x09,0x0E,0x01,0x2B,0x09,0x0C,0x09,0x2F,0x09,0x6E,0x01,0x2F,0x09,0x72,0x11,0x72,0x11,0x53,0x22,0x72,0x11,0x11,0x09,0x53,0x22,0x50,0x32,0xE8,0x10,0xE8,0x10,
-	0xE7,0x08,0x64,0x00,0x24,0x00,0x24,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x65,0x08,0x64,0x00,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0xA4,0x08,0x64,0x08,0xA4,0x00,0xA5,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0xE6,0x08,0xA5,0x08,0xA4,0x08,0x63,0x00,0x22,0x00,
-	0x62,0x00,0x63,0x00,0x63,0x08,0x62,0x00,0x62,0x08,0x63,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x08,0x64,0x08,0x63,0x00,0x63,0x08,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x08,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x00,0x64,0x08,0x63,0x00,0x64,0x08,0x64,0x00,
-	0x64,0x08,0x66,0x00,0x66,0x00,0xA7,0x00,0x66,0x00,0x65,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x08,0x65,0x08,0x65,0x00,0x65,0x00,0x65,0x08,0x64,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x08,0x66,0x00,
-	0xA7,0x08,0xA7,0x00,0xA7,0x08,0xC8,0x08,0xA6,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x08,0x64,0x08,0xA5,0x00,0xA6,0x08,0xA7,0x08,0xA7,0x08,0xA6,0x00,0xA6,0x08,0xA6,0x08,0x64,0x08,0x63,0x08,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x62,0x00,0x62,0x00,0x63,0x08,0x63,0x00,0x63,0x08,0x63,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x63,0x08,0x62,0x00,0x62,0x08,0x62,0x08,0x63,0x08,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x63,0x08,0x22,0x00,0xC8,0x08,0x29,0x09,0xC8,0x08,0xC8,0x08,0xA6,0x08,0xA5,0x08,0xA5,0x08,0xA4,0x08,0xA5,0x08,0xA5,0x08,
-	0xA4,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0xA4,0x08,0xA4,0x08,0x64,0x08,0x64,0x08,0x64,0x00,0x65,0x08,0x63,0x00,0x64,0x08,0x64,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x64,0x08,0xA6,0x08,0x49,0x11,0xC7,0x10,0x4D,0x11,0x2F,0x1A,0x5A,0x33,0x50,0x32,0x4F,0x11,
-	0x0C,0x09,0x11,0x09,0x53,0x22,0x4D,0x11,0xED,0x93,0x91,0xD5,0x62,0x49,0x20,0x98,0xC6,0xB9,0xE8,0x10,0x69,0x00,0x0E,0x01,0xCF,0x08,0x6F,0x01,0x6F,0x01,0xCF,0x08,0x4E,0x53,0xED,0x4A,0x4C,0x3A,0x2E,0xCD,0x6E,0x09,0x2F,0x1A,0xAF,0x09,0x0E,0x01,0x6F,0x01,0x6F,0x01,0x6E,0x01,0x6F,0x01,0x6E,0x01,0x2F,0x09,0x6F,0x01,0x2F,0x09,
-	0xCA,0x08,0xA7,0x00,0x69,0x00,0xA7,0x00,0xA7,0x00,0xC8,0x08,0xCA,0x08,0x6E,0x09,0x4F,0x22,0x2B,0x09,0xCF,0x11,0x4F,0x11,0x72,0x11,0xCD,0x21,0x50,0x32,0xA8,0x19,0x65,0x08,0x24,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0xE7,0x08,0xA5,0x08,0x64,0x08,0x64,0x00,0xE5,0x08,0xE7,0x08,
-	0xA5,0x08,0xA4,0x08,0xA4,0x08,0xA5,0x08,0xE7,0x08,0x29,0x09,0x2B,0x09,0x4F,0x11,0x11,0x09,0x6F,0x09,0x4D,0x11,0xA5,0x08,0x64,0x08,0x64,0x00,0x63,0x08,0x63,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x08,0x62,0x00,0x63,0x08,0x62,0x00,0x63,0x08,0x63,0x08,0xA4,0x08,0xA6,0x08,0xC8,0x08,0xC8,0x08,0xA7,0x08,
-	0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x08,0x65,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x65,0x08,0x65,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x63,0x08,0x63,0x00,0x64,0x08,0x64,0x00,0x64,0x08,
-	0x63,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x23,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0xA6,0x00,0xCA,0x08,0xCA,0x08,0xC8,0x08,0xA5,0x00,0x64,0x08,0x62,0x00,0x63,0x00,0x64,0x08,0xA6,0x00,0xA7,0x08,0xA7,0x08,
-	0x69,0x00,0xC8,0x08,0xA7,0x08,0xA7,0x08,0xA6,0x08,0xA6,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0x63,0x08,0x62,0x00,0x63,0x08,0x63,0x08,0xA4,0x08,0x63,0x00,0x63,0x08,0x63,0x08,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x08,0x22,0x00,0x62,0x00,0x22,0x00,
-	0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x08,0x62,0x00,0x63,0x08,0xA4,0x08,0xE6,0x08,0xE7,0x08,0xE6,0x08,0xA7,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0xA4,0x08,0xA4,0x08,0x63,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x64,0x08,0xA5,0x00,0xA5,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0xA6,0x08,0xA5,0x08,0x64,0x00,0x63,0x00,
-	0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0xC7,0x10,0xCD,0x21,0x50,0x32,0x4A,0x11,0x0C,0x09,0xC8,0x08,0x4F,0x11,0x4A,0x11,0xCA,0x19,0xCD,0x21,0xCD,0x21,0x0D,0x53,0xED,0x93,0xA1,0x30,0x20,0x98,0x20,0x98,0x41,0x68,0xA7,0x00,0x47,0x11,0x67,0x29,0x6B,0x00,0x2D,0xAD,0xCF,0x11,
-	0x0E,0x84,0xAD,0x83,0xCF,0x08,0x2F,0x1A,0x6E,0x01,0xCF,0x08,0x6F,0x01,0x6F,0x01,0x0E,0x01,0x6E,0x01,0x6F,0x09,0x6F,0x01,0x0E,0x01,0xCD,0x08,0x69,0x00,0xA7,0x00,0x69,0x00,0x69,0x00,0xA7,0x00,0x69,0x00,0x2B,0x09,0x4D,0x11,0x4A,0x11,0x4D,0x11,0x4A,0x11,0x4C,0x3A,0xCD,0x21,0x4A,0x11,0x4A,0x11,0xCA,0x08,0xE8,0x10,0x4D,0x11,
-	0x49,0x11,0x67,0x29,0xA5,0x08,0x64,0x00,0x64,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x65,0x08,0xA5,0x08,0xA5,0x08,0x64,0x00,0x65,0x08,0xA5,0x08,0xA6,0x08,0xE6,0x08,0xE7,0x08,0xE7,0x08,0x28,0x09,0x29,0x09,0x29,0x09,0xCA,0x08,0x2B,0x09,0x29,0x09,0xA7,0x08,0xA6,0x00,0xA6,0x08,0xA5,0x08,0x62,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x62,0x00,0x63,0x08,0x63,0x08,0x64,0x08,0x63,0x08,0x62,0x00,0x63,0x08,0xA4,0x08,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,0xCA,0x08,0x64,0x00,0x63,0x08,0x63,0x00,0x23,0x00,0x62,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x08,0x63,0x00,0x65,0x08,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,
-	0x63,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x63,0x08,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x65,0x08,0x64,0x08,0x64,0x00,0x63,0x00,0x63,0x00,
-	0x23,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x66,0x00,0xCA,0x08,0xCA,0x08,0x0C,0x09,0xCA,0x08,0xCA,0x08,0xA5,0x00,0x64,0x08,0x64,0x08,0x64,0x00,0x64,0x08,0xA5,0x00,0xC8,0x08,0xCA,0x08,0x0C,0x09,0xA6,0x08,0xA7,0x00,0xA7,0x08,0xCA,0x08,0xCA,0x08,0x2F,0x09,0xCD,0x08,0xCA,0x08,0xC8,0x08,0xC8,0x08,0xA7,0x08,
-	0xA7,0x08,0xA4,0x00,0xA4,0x08,0xA4,0x08,0x64,0x08,0x63,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x08,0x62,0x00,0x62,0x08,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x64,0x08,0x63,0x00,0x64,0x00,0x64,0x08,0xC8,0x08,0x72,0x11,0x72,0x11,0x72,0x11,0x11,0x09,0x0C,0x09,
-	0xCA,0x08,0xC8,0x08,0xE7,0x08,0xE6,0x08,0xA6,0x08,0xA5,0x08,0xA6,0x08,0x27,0x09,0xA5,0x08,0x64,0x08,0x63,0x00,0xA5,0x08,0x64,0x08,0xA5,0x00,0x64,0x08,0x64,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0x23,0x00,0x64,0x00,0x24,0x00,0x64,0x08,0xE9,0x29,0x4B,0x2A,0xCA,0x19,0x4A,0x11,0x4A,0x11,0xE9,0x29,0xA8,0x19,
-	0xA8,0x19,0x65,0x08,0xCD,0x21,0xE8,0x10,0x4A,0x11,0x0D,0x53,0x65,0x31,0xA1,0x30,0x80,0xD0,0x80,0xD0,0x41,0x68,0xC7,0x10,0xC7,0x10,0xC8,0x08,0x67,0x29,0x4D,0x11,0xCF,0x08,0xCD,0x08,0x6F,0x09,0x6B,0x00,0x6E,0x01,0xAF,0x09,0x6F,0x01,0x0E,0x01,0x0E,0x01,0xCD,0x08,0x0E,0x01,0xCF,0x08,0x4C,0x3A,0x4A,0x11,0x69,0x00,0x69,0x00,
-	0x69,0x00,0xC8,0x08,0x4D,0x11,0xCD,0x11,0x4D,0x11,0xCD,0x21,0xCA,0x19,0xCD,0x21,0xC8,0x08,0xCD,0x21,0x65,0x08,0x49,0x11,0x2A,0x1A,0xCA,0x19,0x4A,0x11,0x49,0x11,0x4A,0x11,0xCD,0x21,0xCD,0x21,0xA6,0x08,0xA6,0x08,0xA5,0x08,0x65,0x00,0x64,0x00,0x65,0x08,0xA5,0x08,0xE6,0x08,0xE5,0x08,0xA6,0x08,0x64,0x08,0x64,0x00,0x64,0x00,
-	0x64,0x00,0x63,0x00,0x63,0x00,0x64,0x08,0x23,0x00,0x64,0x08,0xE7,0x08,0xA7,0x08,0xC8,0x08,0xA7,0x08,0xA7,0x08,0xA5,0x08,0x63,0x08,0x63,0x00,0x63,0x08,0x62,0x08,0x63,0x00,0x63,0x08,0x63,0x08,0xA5,0x08,0xA6,0x08,0xA5,0x00,0xA7,0x08,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,0xCA,0x08,0x0C,0x09,0xCA,0x08,0xC8,0x08,
-	0x64,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x08,0x64,0x00,0x63,0x08,0x64,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0x23,0x00,0x63,0x00,
-	0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x65,0x08,0x63,0x00,0x64,0x00,0x23,0x00,0x63,0x08,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x08,0x66,0x00,0xA7,0x00,0x69,0x00,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xC8,0x08,0xA6,0x08,
-	0xA5,0x00,0x64,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0xA6,0x08,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xCA,0x08,0xC8,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xA7,0x00,0xA7,0x08,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,0xA6,0x08,0x64,0x08,0x63,0x08,0x63,0x08,0x62,0x00,0x62,0x08,0x63,0x00,0x62,0x08,0x63,0x00,0x62,0x08,
-	0x62,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x08,0xA4,0x08,0xA5,0x00,0x65,0x08,0x65,0x00,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xA6,0x08,0xE6,0x08,0xA6,0x08,0xA5,0x08,0xA5,0x08,0xA3,0x08,0xA4,0x08,0xA4,0x08,0x64,0x08,0x64,0x00,0x63,0x00,0x64,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x08,0x65,0x00,0x64,0x08,
-	0x64,0x00,0x65,0x08,0xA5,0x00,0xA5,0x08,0xA6,0x08,0xA7,0x08,0xA6,0x08,0xA6,0x08,0xA6,0x00,0x65,0x08,0x66,0x00,0xA6,0x08,0xE7,0x08,0x28,0x09,0xA7,0x08,0xA6,0x00,0xA7,0x08,0xC9,0x11,0xCD,0x21,0x49,0x11,0x49,0x11,0x28,0x09,0xCD,0x21,0x20,0x08,0x41,0x68,0x80,0xD0,0x80,0xD0,0x20,0x98,0xE8,0x10,0x49,0x11,0x4A,0x11,0xC8,0x08,
-	0xCA,0x08,0x4C,0x3A,0x4B,0x2A,0xD3,0x63,0x72,0x11,0x0E,0x01,0xCF,0x08,0x53,0x22,0x4E,0x53,0x30,0x43,0x0E,0x01,0x6B,0x00,0x4A,0x11,0xA7,0x00,0x49,0x11,0xCA,0x19,0xCD,0x11,0xAF,0x09,0xCF,0x32,0xCD,0x21,0x4D,0x11,0x4B,0x22,0xA7,0x08,0x29,0x09,0x49,0x11,0xCA,0x19,0xCA,0x19,0xE7,0x08,0xC8,0x08,0xA6,0x08,0xA6,0x08,0x65,0x08,
-	0xA6,0x08,0xA6,0x08,0xA4,0x08,0xA6,0x08,0xA6,0x00,0xE6,0x08,0xE7,0x08,0xE6,0x08,0xE6,0x08,0xA6,0x08,0xA5,0x08,0x65,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x08,0x63,0x08,0x64,0x08,0xA5,0x08,0xA5,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x64,0x08,0x63,0x08,0x62,0x00,0xA5,0x08,0xA7,0x08,0xC8,0x08,0xC8,0x08,
-	0xC8,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0x0C,0x09,0x0C,0x09,0xCD,0x08,0x2F,0x09,0xCD,0x08,0x0C,0x09,0xCA,0x08,0xC8,0x08,0xA6,0x08,0xA5,0x08,0xA6,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x08,0x24,0x00,0x63,0x00,0x23,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x63,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,
-	0x63,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x22,0x00,0x63,0x08,0x23,0x00,0x63,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x65,0x08,0x66,0x00,0xA7,0x00,0x66,0x00,0xC8,0x08,0xA7,0x08,0xC8,0x08,0xCA,0x08,0xC8,0x08,0x64,0x08,0x63,0x00,0x63,0x00,0x63,0x08,0x63,0x00,0x64,0x00,0xA5,0x08,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xCA,0x08,0xC8,0x08,
-	0xCA,0x08,0xC8,0x08,0xCA,0x08,0x69,0x00,0xC8,0x08,0xC8,0x08,0xA7,0x08,0xA7,0x00,0xA7,0x08,0xA6,0x08,0xA6,0x08,0x65,0x00,0xA5,0x08,0x64,0x00,0x63,0x08,0x63,0x00,0x63,0x08,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x08,0x63,0x00,0x64,0x08,0xA5,0x08,0xA6,0x00,0xA6,0x08,0xA7,0x08,0xA6,0x08,0xA7,0x08,0xA7,0x08,
-	0xA5,0x08,0x63,0x00,0x63,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0xA5,0x08,0xA6,0x00,0xE5,0x08,0xA6,0x08,0xE6,0x08,0xA6,0x08,0xA6,0x00,0xA6,0x08,0xA6,0x00,0xA6,0x00,0xA5,0x08,0xA7,0x00,0xA7,0x08,0xA6,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xA7,0x08,0xE7,0x08,0xE7,0x08,0xE7,0x00,
-	0xE7,0x08,0xA6,0x08,0xA6,0x00,0xE7,0x08,0x29,0x09,0x29,0x09,0xCD,0x11,0xC7,0x10,0x60,0x20,0x20,0x98,0x80,0xD0,0x80,0xD0,0x20,0x98,0xA4,0x40,0x49,0x11,0x4A,0x11,0x28,0x09,0xA7,0x00,0xA6,0x00,0xE7,0x00,0x49,0x11,0xCF,0x11,0x50,0x32,0xA8,0x19,0xA7,0x00,0xA7,0x00,0x49,0x11,0x4A,0x11,0x49,0x11,0xA7,0x00,0x28,0x09,0x4D,0x11,
-	0xCF,0x11,0xCD,0x21,0x2F,0x1A,0xCD,0x11,0xCD,0x11,0xCD,0x11,0x4A,0x11,0xCD,0x11,0x4A,0x11,0x4A,0x11,0x49,0x11,0x29,0x09,0x49,0x11,0x28,0x09,0xE7,0x08,0x27,0x09,0x28,0x09,0xE7,0x08,0x29,0x09,0x49,0x11,0x27,0x09,0xE6,0x08,0x64,0x08,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x63,0x00,0x64,0x08,0xA4,0x08,
-	0xA4,0x08,0x64,0x08,0x64,0x00,0xA4,0x08,0x64,0x08,0x64,0x00,0x63,0x08,0x64,0x00,0x64,0x08,0xA5,0x08,0xC8,0x08,0xCA,0x08,0xCA,0x08,0x0C,0x09,0xCD,0x08,0x2F,0x09,0xCF,0x08,0xCD,0x08,0xCF,0x08,0x11,0x09,0xCF,0x08,0xCD,0x08,0x0C,0x09,0xCA,0x08,0xC8,0x08,0xC8,0x08,0xA7,0x08,0xA6,0x08,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,
-	0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0x65,0x08,0x64,0x08,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x23,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x62,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0xA7,0x00,
-	0xA7,0x00,0xA7,0x08,0x66,0x00,0xA7,0x08,0x0C,0x09,0xCA,0x08,0xC8,0x08,0xC8,0x08,0xA7,0x08,0xA6,0x08,0xA4,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x63,0x00,0x64,0x08,0x64,0x00,0xA6,0x08,0x66,0x00,0xC8,0x08,0x0C,0x09,0xCD,0x08,0x0C,0x09,0xCA,0x08,0xCA,0x08,0xC8,0x08,0xA6,0x00,0x65,0x08,0xA7,0x08,0xC8,0x08,0xCA,0x08,0xC8,0x08,
-	0xC8,0x08,0xA7,0x08,0xA6,0x08,0xA6,0x08,0xA6,0x08,0xA6,0x08,0xA5,0x00,0x65,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x08,0x64,0x00,0x64,0x08,0xA4,0x08,0x63,0x08,0xA3,0x00,0x64,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,
-	0xA5,0x00,0xA5,0x08,0xE7,0x08,0xE7,0x08,0x28,0x09,0x49,0x11,0x29,0x09,0x28,0x09,0x28,0x09,0x27,0x09,0xE7,0x08,0xE7,0x08,0x27,0x09,0x29,0x09,0x29,0x09,0x28,0x09,0x2B,0x09,0x6A,0x09,0x2B,0x09,0x6A,0x09,0x6A,0x09,0x29,0x09,0x6A,0x09,0x4D,0x11,0x22,0x00,0x60,0x20,0x20,0x98,0x80,0xD0,0x80,0xD0,0x20,0x98,0xA4,0x40,0xA6,0x00,
-	0xA6,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xC7,0x10,0x49,0x11,0x67,0x29,0xC7,0x10,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA7,0x00,0x29,0x09,0x2B,0x09,0xAD,0x09,0x4A,0x11,0x68,0x09,0x29,0x09,0x29,0x09,0x68,0x09,0x28,0x09,0x28,0x09,0x27,0x09,0x27,0x09,0x29,0x09,0x49,0x11,0x4A,0x11,0x49,0x11,0x28,0x09,0x49,0x11,0x4A,0x11,
-	0xE6,0x08,0xE6,0x08,0x49,0x11,0xE7,0x08,0xA5,0x08,0x65,0x08,0xA5,0x08,0x65,0x08,0x64,0x00,0x63,0x00,0x63,0x00,0xA4,0x08,0xA7,0x08,0xA7,0x08,0xA6,0x08,0x65,0x08,0xA5,0x00,0xA5,0x08,0x65,0x08,0xA5,0x00,0xA6,0x08,0xA6,0x08,0xA7,0x08,0xCA,0x08,0xCD,0x08,0x11,0x09,0x2F,0x09,0x2F,0x09,0x11,0x09,0x11,0x09,0x11,0x09,0x11,0x09,
-	0x11,0x09,0x0C,0x09,0x0C,0x09,0x0C,0x09,0xCA,0x08,0xC8,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xC8,0x08,0xA7,0x08,0xA6,0x08,0x65,0x08,0xA5,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x65,0x08,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0x64,0x00,0x65,0x00,0x24,0x00,0x65,0x00,0x24,0x00,0x64,0x00,0x23,0x00,0x23,0x00,
-	0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x24,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x61,0x00,0x23,0x00,0x23,0x00,0x64,0x08,0x65,0x00,0x65,0x08,0x65,0x00,0x64,0x08,0x64,0x00,0x63,0x08,0x23,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x69,0x00,0xC8,0x08,0x69,0x00,0x69,0x00,0xA7,0x08,0xA7,0x00,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,
-	0xA7,0x08,0xA6,0x00,0xA6,0x08,0xA5,0x08,0x65,0x08,0x66,0x00,0xA7,0x08,0x69,0x00,0xCA,0x08,0xCD,0x08,0xCF,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCA,0x08,0xC8,0x08,0xC8,0x08,0xA7,0x08,0xA7,0x08,0xA5,0x08,0x63,0x00,0x63,0x08,0x63,0x08,0x63,0x00,
-	0x63,0x08,0xA4,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0xA5,0x08,0xA5,0x08,0xA5,0x08,0xA4,0x08,0xA5,0x08,0xA4,0x08,0xA5,0x08,0xA5,0x08,0xA5,0x00,0x65,0x00,0x65,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x08,0xE6,0x08,0x28,0x09,0x6A,0x09,0x6A,0x09,0x29,0x09,0x4D,0x11,0x6A,0x09,0x28,0x09,0x29,0x09,0x28,0x09,0xAD,0x09,0x28,0x09,
-	0x29,0x09,0x29,0x09,0x28,0x09,0x27,0x09,0x28,0x09,0x28,0x09,0x49,0x11,0x68,0x09,0xE6,0x08,0x20,0x00,0x41,0x68,0x20,0x98,0x80,0xD0,0x80,0xD0,0x20,0x98,0xA4,0x40,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA5,0x00,0xC7,0x10,0xE8,0x10,0x67,0x29,0xC7,0x10,0xA6,0x00,0xA6,0x00,0xE7,0x08,0x4A,0x11,0xAF,0x09,0x4D,0x11,0x4A,0x11,0x6A,0x09,
-	0x28,0x09,0x49,0x11,0x28,0x09,0x27,0x09,0x29,0x09,0x28,0x09,0x49,0x11,0x27,0x09,0xE7,0x08,0x28,0x09,0x28,0x09,0x28,0x09,0x4D,0x11,0xCD,0x11,0x29,0x09,0xE6,0x08,0xA5,0x08,0x28,0x09,0x28,0x09,0x29,0x09,0x49,0x11,0xE7,0x08,0xA5,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x64,0x08,0x63,0x00,0x64,0x08,0x64,0x00,
-	0x64,0x08,0xA6,0x08,0xC8,0x08,0xCA,0x08,0x0C,0x09,0x11,0x09,0x72,0x11,0x11,0x09,0xCF,0x08,0x11,0x09,0x11,0x09,0x11,0x09,0xCF,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xA7,0x08,0xA6,0x08,0xA5,0x08,0xA5,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x65,0x00,0x65,0x08,0xA6,0x08,0xA7,0x00,0xC8,0x08,
-	0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x08,0x64,0x00,0x64,0x08,0x65,0x08,0x64,0x00,0x64,0x00,0x64,0x08,0x65,0x00,0x65,0x08,0x66,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x63,0x00,0x64,0x00,
-	0x24,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x64,0x00,
-	0x24,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0xA7,0x08,0x69,0x00,0x69,0x00,0xC8,0x08,0x6B,0x00,0xCA,0x08,0xC8,0x08,0x66,0x00,0xA7,0x08,0xA6,0x08,0x65,0x08,0xA5,0x08,0x65,0x00,0xA6,0x08,0xA7,0x08,0xA7,0x00,0xC8,0x08,0xA7,0x08,0xA6,0x08,0x65,0x00,0xA6,0x08,0x66,0x00,0xA7,0x08,0xC8,0x08,0xC8,0x08,0x69,0x00,0xCA,0x08,0xCF,0x08,
-	0x11,0x09,0xCF,0x08,0xCD,0x08,0x11,0x09,0x11,0x09,0x11,0x09,0x11,0x09,0x11,0x09,0xCF,0x08,0x0C,0x09,0xCA,0x08,0xCF,0x08,0x2F,0x09,0xCA,0x08,0xC8,0x08,0xA6,0x08,0xA6,0x00,0xA6,0x08,0xA5,0x00,0x65,0x08,0xA4,0x00,0xA5,0x08,0xA5,0x00,0xA5,0x08,0xA6,0x00,0xA6,0x08,0xA7,0x00,0xA6,0x08,0xA4,0x00,0x63,0x00,0x64,0x00,0x64,0x00,
-	0xA5,0x00,0xA5,0x00,0xE7,0x08,0x29,0x09,0x29,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x29,0x09,0x68,0x09,0x28,0x09,0x4D,0x11,0x6E,0x09,0x4D,0x11,0x27,0x09,0x28,0x09,0x29,0x09,0x49,0x11,0x49,0x11,0x49,0x11,0x29,0x09,0x28,0x09,0x4A,0x11,0x49,0x11,0x49,0x11,0xA4,0x08,0x20,0x00,0x41,0x68,0x20,0x98,0x80,0xD0,0x80,0xD0,0x20,0x98,
-	0x41,0x68,0xE8,0x10,0xA6,0x08,0xE7,0x08,0xA7,0x00,0xA7,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xE7,0x08,0xC8,0x08,0xC8,0x08,0x49,0x11,0x49,0x11,0x4A,0x11,0x4A,0x11,0x4A,0x11,0x4A,0x11,0x4A,0x11,0x49,0x11,0x4A,0x11,0x47,0x11,0xE7,0x08,0x49,0x11,0x4A,0x11,0x49,0x11,0x49,0x11,0x27,0x09,0x49,0x11,0x29,0x09,0x4A,0x11,0xE6,0x08,
-	0xE7,0x08,0x49,0x11,0xE7,0x08,0xE6,0x08,0x64,0x08,0x64,0x08,0xA5,0x08,0xA5,0x08,0xE7,0x08,0x29,0x09,0x0C,0x09,0xCD,0x08,0x0C,0x09,0x0C,0x09,0x0C,0x09,0xCD,0x08,0xCF,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCF,0x08,0x6B,0x00,0xCD,0x08,0x0C,0x09,0xCA,0x08,0xCA,0x08,0x69,0x00,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,
-	0x69,0x00,0xA7,0x08,0x66,0x00,0x64,0x08,0x63,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x65,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x64,0x00,0x65,0x08,0x64,0x00,0x64,0x00,0x65,0x08,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,
-	0x65,0x00,0x65,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x64,0x00,0x65,0x08,0x65,0x00,0x24,0x00,0x65,0x00,0x65,0x00,0x24,0x00,0x65,0x00,0x63,0x00,0x63,0x00,
-	0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x69,0x00,0x69,0x00,0xC8,0x08,0x6B,0x00,0xCA,0x08,0xCA,0x08,0x6B,0x00,0xCA,0x08,0xC8,0x08,0xA7,0x00,
-	0xA7,0x08,0xA6,0x00,0xA5,0x08,0x64,0x08,0x64,0x00,0xA6,0x08,0xA7,0x08,0xC8,0x08,0xA7,0x08,0xA6,0x08,0xA7,0x08,0xA6,0x08,0xA6,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xCA,0x08,0x6B,0x00,0xCA,0x08,0x6B,0x00,0xCD,0x08,0xCD,0x08,0xCF,0x08,0x11,0x09,0x11,0x09,0x11,0x09,0x11,0x09,0xCF,0x08,0x11,0x09,0x11,0x09,
-	0x11,0x09,0xCD,0x08,0x0C,0x09,0xCA,0x08,0xC8,0x08,0xA5,0x00,0xA6,0x08,0x65,0x00,0xA5,0x08,0xA5,0x00,0xA4,0x08,0xA4,0x00,0xA5,0x08,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE6,0x08,0x29,0x09,0x2B,0x09,0x4D,0x11,0x2B,0x09,0xCD,0x11,0xCF,0x11,0xCD,0x11,0x6A,0x09,0x6A,0x09,0x4A,0x11,0xCA,0x19,
-	0x29,0x09,0x49,0x11,0x4A,0x11,0x29,0x09,0x49,0x11,0x49,0x11,0x49,0x11,0x28,0x09,0x49,0x11,0x4A,0x11,0xA4,0x00,0xA1,0x30,0x20,0x98,0x80,0xD0,0x80,0xD0,0x80,0xD0,0x80,0xD0,0x20,0x98,0xC7,0x10,0x66,0x00,0xA7,0x00,0xA6,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xA6,0x00,0x28,0x09,0x29,0x09,0xC8,0x08,0xC8,0x08,
-	0x28,0x01,0x29,0x09,0x28,0x09,0xA7,0x00,0xA7,0x00,0xA8,0x19,0x47,0x11,0xE7,0x08,0xA8,0x19,0x47,0x11,0xC4,0x10,0x47,0x11,0x47,0x11,0x28,0x09,0xA5,0x08,0xA4,0x08,0x67,0x29,0x67,0x29,0x62,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x08,0x65,0x08,0x64,0x00,0x64,0x08,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x63,0x08,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x63,0x08,0x63,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,0xA7,0x08,0xA7,0x00,0xA7,0x00,0xA7,0x08,0xA7,0x08,0xA6,0x00,0x65,0x08,0x64,0x00,0x63,0x08,0x63,0x00,0x64,0x08,0x64,0x00,0x65,0x08,0xA6,0x00,0xA6,0x08,
-	0xC8,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCD,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCF,0x08,0xCD,0x08,0x6B,0x00,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0xCD,0x08,0x6B,0x00,0xCD,0x08,0xCD,0x08,0xCA,0x08,0xCA,0x08,0x6B,0x00,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xCA,0x08,0xC8,0x08,0xA6,0x08,
-	0xA5,0x00,0xA4,0x00,0xA4,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x08,0xE7,0x08,0x47,0x11,0xA8,0x19,0x49,0x11,0xA7,0x00,0xA7,0x00,0xA7,0x00,0xE7,0x00,0x49,0x11,0xE7,0x08,0xA7,0x00,0xA7,0x00,0x47,0x11,0x27,0x09,0xE7,0x00,0x27,0x09,0xA5,0x08,0xA1,0x30,0x20,0x98,0x80,0xD0,0x80,0xD0,0xA0,0xEA,
-	0x80,0xD0,0x80,0xD0,0x20,0x98,0x67,0x29,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xA7,0x00,0xA7,0x00,0xE7,0x00,0xE7,0x00,0x28,0x01,0xA7,0x00,0xE7,0x00,0x28,0x01,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xA7,0x00,0xE7,0x00,0xE7,0x00,0xA7,0x00,0xA7,0x00,0xA7,0x00,0x49,0x11,0xE7,0x08,0xA6,0x00,0x66,0x00,0xA7,0x00,0xA5,0x08,0xA3,0x08,0xC4,0x10,
-	0xA3,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,
-	0x64,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x63,0x08,0x63,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x08,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x63,0x00,
-	0x63,0x00,0x63,0x00,0x64,0x08,0x64,0x00,0x63,0x00,0x64,0x08,0x63,0x00,0x63,0x00,0x23,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x64,0x00,0x66,0x00,0x65,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x64,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x08,0xA8,0x19,
-	0x28,0x09,0xA7,0x00,0xA7,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xC8,0x08,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xA5,0x08,0x60,0x20,0x20,0x98,0x80,0xD0,0x80,0xD0,0x80,0xD0,0xA0,0xEA,0x80,0xD0,0x80,0xD0,0x20,0x98,0x65,0x31,0x67,0x29,0xE7,0x00,0x47,0x11,0xE7,0x00,0xA7,0x00,0xE7,0x00,0xA7,0x00,0x28,0x01,0x09,0x01,0x09,0x01,0x09,0x01,
-	0x28,0x01,0x28,0x01,0xE7,0x00,0x28,0x01,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xA6,0x00,0xA7,0x00,0xE7,0x08,0xA8,0x19,0xC4,0x10,0x21,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x23,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0x47,0x11,0xA8,0x19,0xA8,0x19,0xA8,0x19,0x49,0x11,0xE7,0x00,0x28,0x01,0xE7,0x00,0x28,0x01,0xE7,0x00,0x28,0x01,0x28,0x01,0xC8,0x08,0xE6,0x08,0x60,0x20,0x20,0x98,0x80,0xD0,0x80,0xD0,0x80,0xD0,
-	0xA0,0xEA,0xA0,0xEA,0x80,0xD0,0x80,0xD0,0x80,0xD0,0xA4,0x40,0xE7,0x00,0x67,0x29,0xE7,0x00,0x47,0x11,0xE7,0x00,0xA7,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0x09,0x01,0x09,0x01,0x28,0x09,0x09,0x01,0x09,0x01,0x28,0x01,0x28,0x01,0xE7,0x00,0x28,0x09,0xE7,0x00,0x28,0x09,0xA8,0x19,0x47,0x11,0xA3,0x08,0xC2,0x10,0xA4,0x08,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0x47,0x11,0xA8,0x19,0xA8,0x19,
-	0x49,0x11,0x6A,0x09,0xE7,0x00,0xC8,0x08,0x09,0x01,0x09,0x01,0x28,0x01,0x09,0x01,0x09,0x01,0x09,0x01,0xE7,0x00,0x20,0x08,0x41,0x68,0x20,0x98,0x80,0xD0,0x80,0xD0,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0x80,0xD0,0x80,0xD0,0xA4,0x40,0xE7,0x00,0x28,0x01,0xE9,0x29,0x28,0x01,0x28,0x09,0xE7,0x00,0xE7,0x00,0x28,0x01,0x28,0x01,
-	0x09,0x01,0x28,0x01,0x29,0x09,0x28,0x01,0xC8,0x08,0x28,0x01,0x28,0x01,0xA7,0x00,0xA7,0x00,0xE7,0x08,0x49,0x11,0xE5,0x08,0xC4,0x10,0x47,0x11,0xA3,0x08,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x64,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x08,0xA8,0x19,0xA8,0x11,0x28,0x09,0x28,0x01,0x09,0x01,0x28,0x01,0x09,0x01,0x09,0x01,0xE7,0x08,0x20,0x08,0x41,0x68,0x80,0xD0,0x80,0xD0,0x80,0xD0,
-	0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0x80,0xD0,0x41,0x68,0xE7,0x00,0xE7,0x00,0x28,0x09,0xE9,0x29,0x09,0x01,0x28,0x01,0xC8,0x08,0xE7,0x00,0xE7,0x00,0xE7,0x00,0x28,0x01,0x28,0x01,0x09,0x01,0x09,0x01,0x28,0x01,0x49,0x11,0xA8,0x19,0x26,0x09,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,
-	0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,
-	0x47,0x11,0x47,0x11,0x47,0x11,0xA8,0x19,0xC9,0x11,0x28,0x09,0x28,0x01,0x28,0x01,0x28,0x01,0x09,0x01,0xA4,0x00,0x41,0x68,0x80,0xD0,0x80,0xD0,0x80,0xD0,0x80,0xD0,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0x80,0xD0,0x41,0x68,0x28,0x01,0x28,0x01,0x28,0x01,0x68,0x09,0xA8,0x19,0xC8,0x08,0x09,0x01,
-	0x28,0x01,0x09,0x01,0x28,0x01,0xE7,0x00,0x28,0x01,0x29,0x09,0x49,0x11,0xCA,0x19,0xA8,0x19,0xA8,0x19,0x47,0x11,0xE5,0x08,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,
-	0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,
-	0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x26,0x09,0x47,0x11,0xA8,0x19,0xC8,0x08,0xC8,0x08,0x28,0x01,0x28,0x01,0xE7,0x00,0x28,0x01,0xE7,0x00,0x61,0x08,0x41,0x68,0x20,0x98,0x80,0xD0,0xA0,0xEA,0xA0,0xEA,
-	0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xE5,0xE4,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0x80,0xD0,0xA4,0x40,0x28,0x01,0x09,0x01,0x28,0x01,0x68,0x09,0xA8,0x19,0x68,0x09,0x09,0x01,0x28,0x01,0xC8,0x08,0x28,0x01,0x28,0x01,0x28,0x01,0x09,0x01,0x09,0x01,0x49,0x11,0xA8,0x19,0x49,0x11,0x26,0x09,0xE6,0x00,0xE6,0x00,0xA5,0x00,0xA4,0x00,
-	0xA4,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x63,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA4,0x00,0x63,0x00,0xA4,0x00,0x63,0x00,0xA4,0x00,
-	0xA3,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x08,0xA8,0x19,0x28,0x09,0xA7,0x00,0xA7,0x00,0xE7,0x00,0xE7,0x00,0x60,0x20,0x41,0x68,0x20,0x98,0x80,0xD0,0x80,0xD0,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xA0,0xEA,0xA0,0xEA,0x80,0xD0,0x80,0xD0,0xC7,0x10,0x28,0x01,0x09,0x01,0x09,0x01,0xA8,0x19,0x49,0x11,
-	0x28,0x01,0x28,0x01,0x09,0x01,0x09,0x01,0xA7,0x00,0x28,0x01,0xC9,0x11,0xA1,0x30,0x04,0x6A,0x69,0x93,0xE6,0x08,0xA6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x64,0x00,0x63,0x00,
-	0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x64,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0x64,0x00,0x22,0x00,0xA3,0x08,0x47,0x11,0x27,0x09,0xA7,0x00,0x64,0x00,0x60,0x20,0x41,0x68,0x20,0x98,0x80,0xD0,0x80,0xD0,0xA0,0xEA,
-	0xA0,0xEA,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0xA0,0xEA,0x80,0xD0,0x80,0xD0,0x20,0x98,0x20,0x98,0xE7,0x08,0x28,0x01,0x28,0x01,0x09,0x01,0x68,0x09,0xE9,0x29,0x09,0x01,0x28,0x01,0xE7,0x00,0xC9,0x11,0x47,0x11,0xE4,0x08,0xA1,0x30,0x69,0x93,0x2E,0xCD,0x65,0x31,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x00,0xE6,0x00,
-	0xE5,0x00,0xE6,0x00,0xA5,0x00,0xA4,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,
-	0x63,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0xA3,0x08,0xA4,0x00,0xA4,0x00,0x63,0x00,
-	0x62,0x00,0x21,0x00,0x62,0x00,0x24,0x21,0x47,0x11,0xA3,0x08,0xA2,0x00,0x47,0x11,0xE9,0x29,0xC2,0x10,0xA1,0x30,0x20,0x98,0x20,0x98,0x80,0xD0,0x80,0xD0,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0x80,0xD0,0x80,0xD0,0x80,0xD0,0x20,0x98,0x20,0x98,0x41,0x68,0x41,0x68,0xCA,0x19,0xCA,0x19,0x6A,0x09,0xC9,0x11,
-	0x6A,0x09,0xA8,0x19,0xC9,0x11,0xA8,0x19,0xE5,0x08,0xA4,0x00,0xA1,0x30,0x04,0x6A,0xCA,0xA3,0xCA,0xA3,0xC4,0x10,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,
-	0x63,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0xA5,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x62,0x08,0xA2,0x08,0xC2,0x10,0x24,0x21,0x69,0x52,0xE9,0x29,0xCA,0x5A,0x69,0x52,0xCA,0x5A,0x60,0x20,0x41,0x68,0x20,0x98,0x20,0x98,0x80,0xD0,0x80,0xD0,0xA0,0xEA,
-	0x80,0xD0,0xA0,0xEA,0x80,0xD0,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0x20,0x98,0x20,0x98,0x41,0x68,0x41,0x68,0xE7,0x41,0x2A,0x1A,0xCA,0x19,0x6A,0x09,0x6A,0x09,0xAC,0x3A,0x4B,0x2A,0xC9,0x11,0xA8,0x11,0xC4,0x10,0x62,0x49,0xC7,0x7A,0x2B,0xB4,0x24,0x21,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA6,0x00,0xE5,0x00,0xE6,0x00,0xA5,0x00,0xA5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xA5,0x00,0xA5,0x00,0xE6,0x00,0xA6,0x00,0xA5,0x00,0xE6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,
-	0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x00,0x64,0x00,0x63,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA1,0x10,
-	0xC2,0x10,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0x69,0x52,0xCA,0x5A,0xE9,0x29,0xE7,0x41,0x60,0x20,0x41,0x68,0x20,0x98,0x20,0x98,0x20,0x98,0x20,0x98,0xC6,0xB9,0x4A,0xD3,0xD1,0xB4,0x91,0xD5,0xD5,0xEE,0x36,0xF7,0x77,0xF7,0x76,0xF7,0xB2,0xF6,0x91,0xD5,0x2B,0xB4,0xC6,0xB9,0x20,0x98,0xA4,0x40,0x6A,0x09,0x6A,0x09,0x6A,0x09,
-	0xC9,0x11,0x69,0x01,0x28,0x01,0x28,0x01,0xA6,0x00,0x60,0x20,0x04,0x6A,0x2B,0xB4,0x49,0x3A,0x2A,0x1A,0xA8,0x19,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,
-	0xE7,0x00,0xE7,0x00,0xE6,0x00,0xA5,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xE6,0x00,0xA6,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0x64,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x61,0x08,0xA1,0x10,0xC2,0x10,0xC2,0x10,0x24,0x21,0xE7,0x41,0x69,0x52,0x69,0x52,0x69,0x52,0x49,0x3A,0x49,0x3A,0x67,0x29,0xA1,0x30,0x41,0x68,0x41,0x68,0x41,0x68,0xC6,0xB9,0x91,0xD5,0xD5,0xEE,
-	0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x76,0xFF,0x36,0xF7,0x77,0xFF,0x98,0xFF,0x77,0xF7,0x91,0xD5,0x69,0x93,0xCA,0x19,0x6A,0x09,0x6A,0x09,0x69,0x01,0x69,0x01,0x49,0x11,0x69,0x52,0xC7,0x7A,0xA1,0x30,0xC7,0x7A,0x2B,0x6B,0xA8,0x19,0x47,0x11,0x25,0x01,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,
-	0xA5,0x00,0xE4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x27,0x01,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x27,0x01,0x27,0x01,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0x64,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0xA1,0x10,
-	0xC2,0x10,0xC2,0x10,0x24,0x21,0x24,0x21,0x65,0x31,0x69,0x52,0xCA,0x5A,0x49,0x3A,0xA4,0x40,0xA1,0x30,0x41,0x68,0x2B,0xB4,0x53,0xEE,0x76,0xF7,0x37,0xEF,0xD7,0xEE,0xD7,0xEE,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xFF,0x37,0xF7,0x77,0xF7,0x36,0xFF,0x37,0xF7,0x37,0xF7,0xF6,0xF6,0xF5,0xF6,0xF6,0xF6,0x6F,0xA4,0x4B,0x2A,0xCA,0x19,
-	0xCA,0x19,0xE7,0x41,0xC4,0x8A,0xC6,0xB9,0xD1,0xED,0x52,0xBD,0xC7,0x7A,0xE4,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0x26,0x01,0xE6,0x00,
-	0xE6,0x00,0xE7,0x00,0xA6,0x00,0xA5,0x00,0xA6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0x64,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,
-	0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,
-	0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA1,0x10,0xA1,0x10,0xC2,0x10,0xC2,0x10,0x24,0x21,0x24,0x21,0x65,0x31,0xE7,0x41,0x60,0x20,0xC4,0x8A,0xD1,0xED,0xF6,0xF6,0xD5,0xEE,0xD7,0xEE,0xF6,0xF6,0xF6,0xF6,
-	0xF6,0xF6,0xD5,0xEE,0x53,0xEE,0xD5,0xEE,0x53,0xEE,0x53,0xEE,0x53,0xEE,0x53,0xEE,0xD5,0xEE,0xD5,0xEE,0xD5,0xEE,0xD5,0xEE,0x53,0xEE,0x53,0xEE,0x4F,0x9C,0x4B,0x2A,0x04,0x6A,0xC6,0xB9,0x4A,0xD3,0xAD,0xE4,0xAD,0xE4,0x76,0xFF,0xE7,0x41,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,
-	0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA5,0x00,0xA5,0x00,0xA6,0x00,0xE5,0x00,0xA6,0x00,0xA6,0x00,0xE6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x22,0x00,0x22,0x00,
-	0x63,0x00,0x64,0x00,0x64,0x00,0x62,0x00,0x64,0x00,0x63,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x08,0x60,0x08,0xA1,0x10,0xA1,0x10,0xA1,0x10,0xC2,0x10,0xE7,0x41,0x69,0x93,0x95,0xFE,0xD5,0xEE,0x34,0xDE,0xD5,0xEE,0xD5,0xEE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0xD5,0xEE,0x34,0xDE,0x53,0xEE,0xD5,0xEE,0xD5,0xEE,0xD5,0xEE,0x53,0xEE,0x53,0xEE,0xD5,0xEE,0xD5,0xEE,0x34,0xDE,0x53,0xEE,0x91,0xD5,0x69,0x93,
-	0xC6,0xB9,0x4A,0xD3,0xAD,0xE4,0x53,0xEE,0x95,0xFE,0x94,0xFE,0x2B,0x6B,0x25,0x01,0xE5,0x00,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA6,0x00,0xA5,0x00,0xA6,0x00,0xE6,0x00,0xA5,0x00,0xA6,0x00,0xE6,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x00,0xA7,0x00,0xA6,0x00,0xA6,0x00,0xA5,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,
-	0x22,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x65,0x00,0x63,0x08,0x62,0x00,0x62,0x00,0x63,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x69,0x93,0xD1,0xED,0x91,0xD5,0x34,0xDE,0x53,0xEE,0x91,0xD5,0x34,0xDE,0xD5,0xEE,0x53,0xEE,
-	0x53,0xEE,0x36,0xF7,0x95,0xFE,0x0F,0xE6,0xF5,0xF6,0xFA,0xFF,0x98,0xFF,0xF6,0xF6,0xD1,0xED,0x53,0xEE,0x95,0xFE,0xF5,0xF6,0xD5,0xEE,0x91,0xD5,0x91,0xD5,0xAD,0xE4,0xD1,0xED,0x95,0xFE,0xD1,0xED,0xAD,0xE4,0x53,0xEE,0x76,0xFF,0x31,0xB5,0x69,0x52,0x49,0x3A,0xE9,0x29,0xE9,0x29,0x67,0x29,0xA8,0x19,0x47,0x11,0x47,0x11,0x26,0x09,
-	0x25,0x01,0x25,0x01,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA5,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE6,0x00,
-	0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xE6,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x41,0xD1,0xB4,0x52,0xBD,0x34,0xDE,0x91,0xD5,0x91,0xD5,0x34,0xDE,0x78,0xF7,0x94,0xFE,0xAD,0xE4,0xAD,0xE4,0xD1,0xED,0xD1,0xED,0x53,0xEE,0x98,0xFF,0xF5,0xF6,0x53,0xEE,0x53,0xEE,0x94,0xFE,0x94,0xFE,0xD1,0xED,0xD1,0xED,0x36,0xF7,0x34,0xDE,0xAD,0xE4,0x4A,0xD3,
-	0x4A,0xD3,0xD1,0xED,0x38,0xFF,0x95,0xFE,0xD1,0xED,0x76,0xFF,0xB2,0xF6,0x91,0xD5,0x31,0xB5,0x2B,0x6B,0xCA,0x5A,0x49,0x3A,0x69,0x52,0x49,0x3A,0x49,0x3A,0xE9,0x29,0xE9,0x29,0xA8,0x19,0x47,0x11,0x47,0x11,0x26,0x09,0x25,0x01,0xE5,0x00,0xE4,0x00,0xE5,0x00,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA5,0x00,0xA6,0x00,0xA5,0x00,0xE6,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA6,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA7,0x00,0xE6,0x00,0xA5,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x64,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0x23,0x00,0x63,0x00,
-	0x63,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xB0,0xAC,0x2E,0xCD,0x91,0xD5,0x91,0xD5,0x53,0xEE,0x98,0xFF,0x98,0xFF,0x95,0xFE,0x95,0xFE,
-	0x15,0xFF,0x94,0xFE,0x15,0xFF,0xD1,0xED,0xAD,0xE4,0xD1,0xED,0x98,0xFF,0xD1,0xED,0xD1,0xED,0x53,0xFF,0xB2,0xF6,0xD1,0xED,0x95,0xFE,0xD5,0xEE,0xAC,0xC4,0x04,0x6A,0x41,0x68,0xA5,0xB3,0x94,0xFE,0x76,0xFF,0x15,0xFF,0x53,0xFF,0xB2,0xF6,0xD7,0xEE,0x77,0xFF,0xB2,0xF6,0x2B,0x6B,0x49,0x3A,0x69,0x52,0x49,0x3A,0x49,0x3A,0x49,0x3A,
-	0x49,0x3A,0xE9,0x29,0xE9,0x29,0xA8,0x19,0x47,0x11,0x47,0x11,0x26,0x09,0x25,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,
-	0xA6,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x63,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0x63,0x00,0x62,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x93,0xD1,0xB4,0xAC,0xC4,0x91,0xD5,0xD7,0xEE,0x77,0xF7,0xFA,0xFF,0x53,0xEE,0xD1,0xED,0x53,0xEE,0xD1,0xED,0x0F,0xE6,0x91,0xD5,0xAD,0xE4,0xC6,0xB9,0x4A,0xD3,0xAD,0xE4,0xAD,0xE4,0xAD,0xE4,0xAD,0xE4,0x0F,0xE6,0xAD,0xE4,0xAD,0xE4,0xD1,0xED,0xAC,0xC4,0x62,0x49,
-	0xAC,0xC4,0xAC,0xC4,0xAD,0xE4,0x15,0xFF,0xD3,0xFF,0x53,0xFF,0x53,0xEE,0xD7,0xEE,0x78,0xF7,0x76,0xFF,0xB2,0xF6,0xCA,0x5A,0xED,0x4A,0x69,0x52,0x49,0x3A,0x49,0x3A,0x49,0x3A,0xE9,0x29,0xE9,0x29,0xA8,0x19,0xA8,0x19,0x47,0x11,0x66,0x09,0x26,0x09,0x26,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA5,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA6,0x00,0xA5,0x00,0xE6,0x00,
-	0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x23,0x00,0x23,0x00,0x64,0x00,
-	0x65,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x24,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x23,0x00,
-	0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x24,0x21,0xC2,0x10,0x69,0x93,0xAD,0xE4,0x91,0xD5,0xF6,0xF6,0x37,0xF7,0xFA,0xFF,0x53,0xEE,0x4A,0xD3,0x4A,0xD3,0xAD,0xE4,
-	0xD1,0xED,0xD1,0xED,0x0F,0xE6,0xAD,0xE4,0x4A,0xD3,0xA0,0xEA,0x4A,0xD3,0xD1,0xED,0x90,0xF6,0xAD,0xE4,0xD1,0xED,0x53,0xFF,0xB2,0xF6,0xAD,0xE4,0xC4,0x8A,0x69,0x93,0xD7,0xFF,0xAC,0xC4,0x4A,0xD3,0x94,0xFE,0x53,0xFF,0x53,0xEE,0x97,0xDE,0x37,0xF7,0x77,0xF7,0x36,0xF7,0x35,0xF7,0x8D,0x73,0xCA,0x5A,0x49,0x3A,0x49,0x3A,0x49,0x3A,
-	0xE9,0x29,0xE9,0x29,0xE9,0x29,0xA8,0x19,0x47,0x11,0x47,0x11,0x66,0x09,0x26,0x01,0x26,0x09,0x66,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0x26,0x01,0xE5,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,
-	0xA3,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA5,0x00,0xA6,0x00,0xA4,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x62,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,
-	0x64,0x00,0x64,0x00,0x63,0x00,0x62,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x31,0x65,0x31,0x69,0x52,0xD1,0xED,0xAD,0xE4,0x53,0xEE,0x98,0xFF,0x37,0xF7,0x98,0xFF,0x4A,0xD3,0xA0,0xEA,0xAD,0xE4,0xD1,0xED,0xB2,0xF6,0xB2,0xF6,0x90,0xF6,0x4A,0xD3,0xA0,0xEA,0xD1,0xED,0x76,0xFF,0x76,0xFF,0x53,0xFF,0xD1,0xED,0xD1,0xED,0xB2,0xF6,0xD7,0xFF,0xA5,0xB3,0x04,0x6A,0x15,0xFF,
-	0xB2,0xF6,0x2E,0xCD,0xAD,0xE4,0xD1,0xED,0x53,0xEE,0x97,0xDE,0x38,0xF7,0x37,0xF7,0x36,0xF7,0x35,0xF7,0xF4,0xF6,0xCE,0x94,0x49,0x3A,0xAC,0x3A,0x49,0x3A,0xE9,0x29,0xE9,0x29,0xE9,0x29,0xA8,0x19,0xA8,0x11,0x67,0x09,0x67,0x09,0x67,0x09,0x67,0x09,0x67,0x01,0x26,0x01,0x67,0x01,0x66,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,
-	0x26,0x01,0xE5,0x00,0x26,0x01,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0x63,0x00,0xA4,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x24,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x63,0x00,
-	0x63,0x00,0x23,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x62,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0xA5,0x00,0xA5,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x62,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x04,0x6A,0x4A,0xD3,0x91,0xD5,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x94,0xFE,0xD1,0xED,0xD1,0xED,0xD1,0xED,0xD1,0xED,
-	0xD1,0xED,0x94,0xFE,0x53,0xEE,0xAD,0xE4,0xAD,0xE4,0x53,0xEE,0x53,0xFF,0x53,0xFF,0xF4,0xF6,0xF5,0xF6,0xF6,0xF6,0xFB,0xFF,0x34,0xDE,0x41,0x68,0x53,0xEE,0x15,0xFF,0x8E,0xDD,0x97,0xDE,0xD7,0xEE,0x97,0xDE,0xD7,0xEE,0x39,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x35,0xF7,0x53,0xFF,0x4C,0x6B,0x4B,0x2A,0x4B,0x2A,0xE9,0x29,0xC9,0x11,
-	0xC9,0x11,0xA8,0x11,0xA9,0x01,0x68,0x09,0xA9,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x63,0x00,0x65,0x00,0x64,0x00,
-	0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA5,0x00,0x64,0x00,0xA4,0x00,0x65,0x00,0x23,0x00,0x63,0x00,
-	0x63,0x08,0x64,0x08,0x64,0x00,0x63,0x00,0x64,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x23,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0xA2,0x08,
-	0xA3,0x08,0xC4,0x10,0x24,0x21,0x24,0x21,0x67,0x29,0x65,0x31,0xED,0x93,0xD5,0xEE,0x37,0xF7,0xF6,0xF6,0x77,0xF7,0x36,0xF7,0x36,0xFF,0x98,0xFF,0x98,0xFF,0x98,0xFF,0x98,0xFF,0xD7,0xFF,0xD7,0xFF,0xFA,0xFF,0x98,0xFF,0x95,0xFE,0xF5,0xF6,0x17,0xFF,0x36,0xF7,0xF5,0xF6,0xFA,0xFF,0x37,0xEF,0x62,0x49,0xAC,0xC4,0xFA,0xFF,0xB2,0xF6,
-	0xF6,0xF6,0xD5,0xEE,0xD7,0xEE,0x38,0xF7,0xD7,0xEE,0x38,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x76,0xFF,0xB2,0xF6,0x4B,0x22,0x2A,0x1A,0xC9,0x11,0xC9,0x11,0xC9,0x11,0xC9,0x11,0xA9,0x01,0xA8,0x11,0xA9,0x01,0x68,0x09,0x68,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,
-	0xE5,0x00,0x26,0x01,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x62,0x00,0xA5,0x00,0xA5,0x08,0xA6,0x08,0xA6,0x08,0x62,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0xA5,0x00,0xA5,0x00,0x64,0x00,0xA6,0x08,0xA5,0x00,0x62,0x00,0x62,0x00,0x64,0x00,0x65,0x00,0x64,0x00,
-	0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x08,0x65,0x00,0xA4,0x00,0x65,0x00,0xA5,0x08,0xA4,0x00,0x64,0x00,0x64,0x00,0x63,0x08,0xA5,0x00,0x63,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x65,0x00,0x65,0x00,0x23,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x62,0x08,0xC2,0x10,0xC4,0x10,0xC4,0x10,0x24,0x21,0x65,0x31,0x65,0x31,0xE7,0x41,0xE7,0x41,0x49,0x3A,0x69,0x52,0x69,0x52,0xCA,0x5A,0x2B,0x6B,0x91,0xD5,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,
-	0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0xD7,0xFF,0x98,0xFF,0x98,0xFF,0x77,0xF7,0x98,0xFF,0x35,0xF7,0x04,0x6A,0xCA,0xA3,0xFD,0xFF,0xB2,0xF6,0xF4,0xF6,0xFA,0xFF,0x77,0xFF,0xD7,0xEE,0xD7,0xEE,0xD7,0xEE,0x37,0xEF,0x36,0xF7,0x35,0xF7,0xD7,0xFF,0x35,0xEF,0xC7,0x7A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0xC9,0x11,0xC9,0x11,
-	0xC9,0x11,0xC9,0x11,0xA9,0x01,0xA9,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0xA6,0x00,0x64,0x08,0x64,0x00,0xA5,0x08,0xA6,0x08,0xA5,0x08,0xA5,0x00,0xA6,0x00,0xA5,0x08,0xA5,0x00,0xA4,0x08,0x65,0x00,0xA4,0x08,0xA6,0x00,0xA5,0x00,0xA4,0x08,0xA5,0x08,0x65,0x00,0x64,0x00,0x64,0x08,0x63,0x08,0x63,0x08,0x23,0x00,0x64,0x00,0x64,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0xA1,0x10,
-	0xA1,0x10,0xA1,0x10,0xA1,0x10,0xA1,0x10,0xA1,0x10,0xA1,0x10,0xA1,0x10,0xA1,0x10,0xC2,0x10,0xA2,0x08,0xA2,0x08,0xA2,0x08,0xA3,0x08,0xE3,0x08,0xC4,0x10,0xC4,0x10,0x24,0x21,0x65,0x31,0x67,0x29,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x69,0x52,0x69,0x52,0x69,0x52,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0x2B,0x6B,0x4C,0x6B,0x6C,0x7B,0x6C,0x7B,
-	0xAD,0x83,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0xB0,0xAC,0x34,0xDE,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x76,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x98,0xFF,0x98,0xFF,0x35,0xF7,0x15,0xFF,0xFB,0xFF,0x69,0x93,0x04,0x6A,0xFB,0xFF,0x76,0xFF,0xB2,0xF6,0x98,0xFF,
-	0xD7,0xFF,0x98,0xFF,0x76,0xFF,0x36,0xF7,0xB9,0xF7,0xFA,0xFF,0xD7,0xFF,0xD7,0xFF,0xB2,0xF6,0xA0,0xEA,0x20,0x98,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0xC9,0x11,0xC9,0x11,0xA8,0x11,0xA9,0x01,0x68,0x09,0x67,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0xA4,0x00,0xA5,0x08,0x65,0x00,0xA5,0x00,0xA6,0x08,0xE5,0x08,0xA5,0x08,0xA5,0x00,
-	0xA6,0x08,0xA5,0x00,0xA5,0x00,0xA5,0x08,0xA4,0x00,0x65,0x00,0xA5,0x00,0xA5,0x00,0x64,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x23,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA1,0x10,0xC2,0x10,0xC2,0x10,0x24,0x21,0x24,0x21,0x24,0x21,0x65,0x31,0x65,0x31,0xE7,0x41,0xE7,0x41,0x69,0x52,0x69,0x52,0xCA,0x5A,0xCA,0x5A,0x2B,0x6B,0x6C,0x7B,0x6C,0x7B,0xAD,0x83,0xED,0x93,0xED,0x93,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,
-	0xF0,0xAC,0xF0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xA4,0xB0,0xAC,0xB0,0xA4,0xB0,0xAC,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xF0,0xAC,0x34,0xDE,0xD7,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,
-	0x77,0xFF,0x77,0xFF,0x77,0xFF,0x98,0xFF,0xD7,0xFF,0x98,0xFF,0x77,0xFF,0xF5,0xF6,0xD7,0xFF,0x91,0xD5,0x04,0x6A,0x94,0xFE,0xFA,0xFF,0xD1,0xED,0xD7,0xFF,0x98,0xFF,0xD7,0xFF,0xD7,0xFF,0xD7,0xFF,0xD1,0xED,0x2E,0xCD,0x2E,0xCD,0xAD,0xE4,0x4A,0xD3,0x80,0xD0,0x80,0xD0,0xC6,0xB9,0xE9,0x29,0x2A,0x1A,0xC9,0x11,0xC9,0x11,0xA8,0x11,
-	0xA9,0x01,0x68,0x09,0x67,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x64,0x00,0xA5,0x08,0xA6,0x00,0xA6,0x08,0xA6,0x08,0xA5,0x08,0xA5,0x00,0xA5,0x08,0xA5,0x08,0xA5,0x00,0xA4,0x08,0xA5,0x08,0x65,0x00,0xA6,0x08,0x65,0x00,0x23,0x00,0x64,0x00,0x22,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0xA1,0x10,0xC2,0x10,0xC2,0x10,0x24,0x21,0x24,0x21,0x65,0x31,0x65,0x31,0x65,0x31,0xE7,0x41,0xE7,0x41,0x69,0x52,0x69,0x52,0x69,0x52,0xC7,0x7A,0xCA,0x5A,0xC7,0x7A,0x2B,0x6B,0x6C,0x7B,0x6C,0x7B,0xED,0x93,0xED,0x93,0xED,0x93,
-	0xED,0x93,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xF0,0xAC,0xB0,0xA4,0xF1,0xA4,0xF1,0xA4,
-	0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xD1,0xB4,0xD1,0xED,0x77,0xF7,0x77,0xF7,0x98,0xFF,0x98,0xFF,0x98,0xFF,0x98,0xFF,0x98,0xFF,0x98,0xFF,0x77,0xFF,0x77,0xFF,0xD7,0xFF,0x98,0xFF,0x77,0xFF,0x77,0xFF,0x36,0xFF,0xD5,0xEE,0xD7,0xFF,0x34,0xDE,0x62,0x49,0x8E,0xDD,0xFF,0xFF,0xB2,0xF6,0x35,0xF7,0x76,0xFF,0x15,0xFF,
-	0x76,0xFF,0x76,0xFF,0xFA,0xFF,0x4A,0xD3,0x20,0x98,0x20,0x98,0x20,0x98,0x80,0xD0,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xC9,0x11,0xC9,0x11,0xC9,0x11,0xA8,0x11,0xA8,0x11,0x68,0x09,0x67,0x09,0x67,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0x26,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE4,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA1,0x10,0xA1,0x10,0x61,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x62,0x00,0xA5,0x08,0xA5,0x08,0xA6,0x08,
-	0xE5,0x08,0xE5,0x00,0xA6,0x08,0xA5,0x08,0xA6,0x08,0xA5,0x00,0xA4,0x08,0x64,0x00,0x63,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x60,0x08,0x61,0x08,0x61,0x08,0xA1,0x10,0xC2,0x10,0xC2,0x10,0xA1,0x30,0x24,0x21,0x24,0x21,0x65,0x31,
-	0x65,0x31,0xE7,0x41,0x62,0x49,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x69,0x52,0x69,0x52,0x69,0x52,0xCA,0x5A,0xCA,0x5A,0xC7,0x7A,0x2B,0x6B,0x2B,0x6B,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0xAD,0x83,0xAD,0x83,0xED,0x93,0xED,0x93,0xED,0x93,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x4F,0x9C,0xB0,0xA4,0x6F,0xA4,0x70,0x94,0xB0,0xA4,
-	0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xF1,0xA4,0xF1,0xAC,0xF1,0xA4,0xF1,0xAC,0xF1,0xA4,0xF1,0xAC,0xF1,0xAC,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xC7,0x7A,0x41,0x68,0x2B,0xB4,0x98,0xFF,0xD7,0xEE,0x37,0xF7,0x98,0xFF,0x98,0xFF,0x98,0xFF,0x77,0xFF,0x98,0xFF,
-	0x77,0xFF,0x77,0xFF,0x37,0xF7,0x77,0xF7,0x17,0xFF,0x35,0xEF,0xD5,0xEE,0xFA,0xFF,0xC4,0x8A,0xC4,0x8A,0xFF,0xFF,0x35,0xF7,0xB2,0xF6,0x76,0xFF,0x76,0xFF,0x15,0xFF,0x15,0xFF,0x76,0xFF,0xFA,0xFF,0x0F,0xE6,0x20,0x98,0x20,0x98,0x80,0xD0,0x80,0xD0,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0xE9,0x29,0xC9,0x11,0xC9,0x11,0xA8,0x11,0x68,0x01,
-	0x67,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE4,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xC2,0x10,0xA1,0x30,0x62,0x49,0x04,0x6A,0x62,0x49,0x60,0x20,0xA3,0x08,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,
-	0x21,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x63,0x00,0x22,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA5,0x08,0xA6,0x08,0xE6,0x08,0xA5,0x08,0xA6,0x00,0x64,0x08,0x64,0x00,0x22,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA1,0x10,0xC2,0x10,0xC2,0x10,0x24,0x21,0x24,0x21,0x24,0x21,0x65,0x31,0x65,0x31,0x65,0x31,0xE7,0x41,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x69,0x52,0x69,0x52,
-	0x69,0x52,0xCA,0x5A,0xCA,0x5A,0x2B,0x6B,0x2B,0x6B,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0xB0,0xA4,0xB1,0x9C,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB1,0x9C,0xB0,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xF1,0xA4,0xF1,0xA4,0xB1,0xA4,0xF1,0xA4,0xB1,0xA4,0xF1,0xA4,0xF1,0xA4,
-	0xF1,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xED,0x93,0x60,0x20,0x20,0x08,0x41,0x68,0x53,0xEE,0x37,0xF7,0xD7,0xEE,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xF7,0xD5,0xEE,0xD5,0xEE,0xFA,0xFF,0x91,0xD5,0x04,0x6A,0xFC,0xFF,0xFA,0xFF,0xB2,0xF6,0x77,0xFF,0x76,0xFF,0x76,0xFF,0x76,0xFF,
-	0x76,0xFF,0x76,0xFF,0x77,0xFF,0xD7,0xFF,0xD1,0xED,0xA5,0xB3,0x80,0xD0,0xA0,0xEA,0xA0,0xEA,0xE5,0xE4,0xC4,0x8A,0xED,0x4A,0xAC,0x3A,0x49,0x3A,0x4B,0x2A,0xE9,0x29,0xC9,0x11,0xA8,0x11,0x67,0x09,0x67,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xE5,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x49,0x04,0x6A,0x24,0x21,0x61,0x08,0x24,0x21,0xC4,0x8A,0x60,0x20,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x62,0x00,0xA5,0x08,0xE6,0x08,0x63,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0xA2,0x00,0xA2,0x00,0xA3,0x08,0xA3,0x08,0xE4,0x08,
-	0xE4,0x08,0xC4,0x10,0x47,0x11,0x67,0x29,0x65,0x31,0xE7,0x41,0x49,0x3A,0x69,0x52,0x69,0x52,0xCA,0x5A,0xCA,0x5A,0x2B,0x6B,0x6C,0x7B,0xAD,0x83,0xAD,0x83,0x0E,0x84,0xED,0x93,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x70,0x94,0x70,0x94,0x70,0x94,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,
-	0xB1,0xA4,0xB1,0xA4,0xB1,0x9C,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xB1,0xA4,0xF1,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xA1,0x30,0x60,0x20,0xA1,0x30,0x41,0x68,0xCA,0xA3,0xFB,0xFF,0xD5,0xEE,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x77,0xF7,0x77,0xFF,0x37,0xF7,0xD5,0xEE,0xD5,0xEE,0x36,0xF7,0xFA,0xFF,0xC4,0x8A,0x91,0xD5,0xFC,0xFF,0x0F,0xE6,0x35,0xF7,0xD7,0xFF,0x36,0xFF,0x77,0xFF,0x36,0xFF,0x77,0xFF,0x36,0xFF,0x36,0xFF,0xD7,0xFF,0xFA,0xFF,0x90,0xF6,0xA0,0xEA,0x80,0xD0,0xA0,0xEA,0xA5,0xB3,0x6C,0x7B,0x4C,0x6B,0x0D,0x53,0x0D,0x53,0x4C,0x6B,0xED,0x4A,
-	0x49,0x3A,0x49,0x3A,0x49,0x3A,0xE9,0x29,0xE9,0x29,0xA8,0x19,0xA8,0x19,0x47,0x11,0x66,0x09,0x26,0x09,0x25,0x01,0xE5,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA1,0x30,0x04,0x6A,0x61,0x00,0xA3,0x00,0xA2,0x00,0xA3,0x00,0x63,0x00,0x04,0x6A,0x62,0x49,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xE3,0x08,0xA3,0x00,0xA3,0x08,0xA3,0x00,0xA3,0x08,0xA2,0x00,0xA2,0x00,0xA2,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x25,0x01,0x26,0x09,0x66,0x09,0x67,0x09,0x47,0x11,0xA8,0x19,0xA8,0x19,0xE9,0x29,0xE9,0x29,0xE9,0x29,0x49,0x3A,0x49,0x3A,0x49,0x3A,0x49,0x3A,0xAC,0x3A,0x69,0x52,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x0D,0x53,0x4C,0x6B,
-	0x6E,0x63,0x4C,0x6B,0x8D,0x73,0x8D,0x73,0xEF,0x7B,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x50,0x8C,0x50,0x8C,0x70,0x94,0x70,0x94,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF2,0xA4,0xF1,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,
-	0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x2B,0x6B,0x60,0x20,0x41,0x68,0x41,0x68,0x41,0x68,0x20,0x98,0xFA,0xFF,0x78,0xF7,0xF6,0xF6,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x17,0xFF,0x17,0xFF,0x36,0xF7,0xD5,0xEE,0xD5,0xEE,0xF5,0xF6,0xFD,0xFF,0x69,0x93,0x69,0x93,0xFF,0xFF,0x8E,0xDD,0x8E,0xDD,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xF7,
-	0x36,0xFF,0x77,0xF7,0x77,0xFF,0x36,0xFF,0x77,0xFF,0x98,0xFF,0x76,0xF7,0x50,0xFF,0x8E,0xDD,0xB0,0xA4,0xB1,0x9C,0x70,0x94,0x31,0xB5,0xD4,0xCD,0x31,0xB5,0x0E,0x84,0xEF,0x7B,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x6C,0x7B,0x4C,0x6B,
-	0x4C,0x6B,0x2B,0x6B,0x04,0x6A,0xCA,0xA3,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0x04,0x6A,0x69,0x52,0x2B,0x6B,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0x69,0x52,0x69,0x52,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x65,0x31,0x65,0x31,0x65,0x31,0x24,0x21,0x24,0x21,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0x0D,0x53,
-	0x4E,0x53,0x6E,0x63,0x6E,0x63,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0xB1,0xAC,0xA1,0x30,0x60,0x20,0x41,0x68,0x20,0x98,0x20,0x98,0x41,0x68,0x4A,0xD3,0xFC,0xFF,0x37,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,
-	0x37,0xF7,0xD5,0xEE,0xD5,0xEE,0x35,0xEF,0xFC,0xFF,0x2E,0xCD,0x04,0x6A,0xFB,0xFF,0x35,0xF7,0x0F,0xE6,0x98,0xFF,0x98,0xFF,0x76,0xFF,0x76,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xF7,0x76,0xFF,0x36,0xFF,0x36,0xFF,0x98,0xFF,0xFA,0xFF,0xFA,0xFF,0xFA,0xFF,0x77,0xF7,0x35,0xEF,0x77,0xFF,0xD7,0xFF,0xF1,0xAC,0xF1,0xA4,
-	0xB1,0xA4,0xF1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0xB0,0xA4,0x70,0x94,0xB0,0xA4,0x6F,0xA4,0x04,0x6A,0xC4,0x8A,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0xC4,0x8A,0x62,0x49,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,
-	0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0xED,0x93,0xED,0x93,0xAD,0x83,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0xCA,0x5A,0x69,0x52,0x69,0x52,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0x63,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,
-	0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0x6E,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0xB1,0x9C,
-	0xB1,0xA4,0xF2,0xA4,0xE7,0x41,0x60,0x20,0x41,0x68,0x20,0x98,0x80,0xD0,0x80,0xD0,0x20,0x98,0x41,0x68,0xAD,0xE4,0xFB,0xFF,0xB9,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xD5,0xEE,0x34,0xDE,0xD5,0xEE,0xFC,0xFF,0x91,0xD5,0xA1,0x30,0x34,0xDE,0xFA,0xFF,0x0F,0xE6,0xFA,0xFF,0x79,0xFF,0x77,0xFF,0x98,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,
-	0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x98,0xFF,0x98,0xFF,0xD4,0xCD,0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB1,0x9C,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x70,0x94,0xB0,0xA4,0x70,0x94,0xB0,0xA4,0x70,0x94,0xB0,0xA4,0x4F,0x9C,0xB0,0xA4,
-	0x6F,0xA4,0x04,0x6A,0xCA,0xA3,0xB0,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0xED,0x93,0xED,0x93,0x6F,0xA4,0x6F,0xA4,0xA1,0x30,0x4F,0x9C,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0xED,0x93,0xED,0x93,0xED,0x93,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x65,0x31,
-	0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,
-	0xC9,0x11,0xC9,0x11,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0x4E,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xAF,0x63,0xEF,0x7B,
-	0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x70,0x94,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xD2,0x9C,0xF1,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF1,0xAC,0x60,0x20,0x41,0x68,0x41,0x68,0x20,0x98,0x20,0x98,0x80,0xD0,0x20,0x98,0x20,0x98,0x41,0x68,0xC6,0xB9,0x34,0xDE,0x37,0xF7,0xD7,0xEE,0xD7,0xEE,
-	0xD5,0xEE,0xD5,0xEE,0x98,0xFF,0x37,0xEF,0x04,0x6A,0xAC,0xC4,0xFC,0xFF,0xB2,0xF6,0x36,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x38,0xFF,0x98,0xFF,0x78,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xF7,0x38,0xFF,0x98,0xFF,0x38,0xFF,0x98,0xFF,0x17,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x98,0xFF,0xD5,0xEE,0xF1,0xA4,0xF1,0xA4,0xB1,0xA4,
-	0xB0,0xA4,0xB1,0xA4,0xB1,0x9C,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB1,0x9C,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x70,0x94,0xB0,0xA4,0x4F,0x9C,0x6C,0x7B,0xC4,0x8A,0x2B,0xB4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0xC7,0x7A,0x2B,0x6B,0x69,0x52,0xAD,0x83,0x04,0x6A,0x6C,0x7B,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,
-	0xCA,0x5A,0xCA,0x5A,0x69,0x52,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0x65,0x31,0x65,0x31,0x65,0x31,0x24,0x21,0x24,0x21,0xC2,0x10,0xC2,0x10,0xA1,0x10,0x61,0x08,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x63,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,
-	0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0xA9,0x01,0xA8,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,
-	0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0x6E,0x63,0x6E,0x63,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xD2,0x9C,0xD2,0x9C,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,
-	0x33,0xB5,0x6C,0x7B,0x20,0x08,0x41,0x68,0x20,0x98,0x20,0x98,0x20,0x98,0x20,0x98,0x20,0x98,0x20,0x98,0x20,0x98,0x41,0x68,0x4A,0xD3,0xD5,0xEE,0x53,0xEE,0xB2,0xF6,0x53,0xEE,0x35,0xEF,0xFD,0xFF,0x2B,0xB4,0xC4,0x8A,0xBA,0xFF,0xB2,0xF6,0x35,0xF7,0x98,0xFF,0x76,0xFF,0x36,0xFF,0x77,0xFF,0x77,0xF7,0x77,0xFF,0x78,0xF7,0x98,0xFF,
-	0x78,0xF7,0x38,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xF7,0x77,0xFF,0x77,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x98,0xFF,0x36,0xF7,0xF1,0xAC,0xF1,0xAC,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x70,0x94,0xB0,0xA4,0x6F,0xA4,0x70,0x94,0x6F,0xA4,
-	0x62,0x49,0xC4,0x8A,0xB0,0xA4,0x6F,0xA4,0xB0,0xA4,0x6F,0xA4,0x6C,0x7B,0xA1,0x30,0xA1,0x30,0x20,0x08,0x60,0x20,0xCA,0xA3,0xED,0x93,0xAD,0x83,0x6C,0x7B,0x6C,0x7B,0xED,0x93,0xAD,0x83,0xED,0x93,0xAD,0x83,0xAD,0x83,0xAD,0x83,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0x69,0x52,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,
-	0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,
-	0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x67,0x01,0x67,0x01,0x68,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0x6E,0x63,0xAF,0x63,0xAF,0x63,0xAF,0x63,
-	0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xCA,0x5A,0x60,0x20,0x41,0x68,0x20,0x98,0x20,0x98,0x80,0xD0,0x20,0x98,0x80,0xD0,0x20,0x98,0x4A,0xD3,0xD5,0xEE,0x76,0xF7,0x35,0xF7,0x76,0xFF,0x35,0xEF,
-	0x90,0xF6,0xB2,0xF6,0xD5,0xEE,0x04,0x6A,0x2E,0xCD,0xF4,0xF6,0xB2,0xF6,0x98,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xF7,0x36,0xFF,0x77,0xFF,0x17,0xFF,0x77,0xFF,0x38,0xFF,0x78,0xF7,0x78,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x17,0xFF,0x36,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x35,0xF7,0x33,0xB5,0xF1,0xA4,0xB1,0xA4,0xF1,0xA4,0xF0,0xAC,
-	0xB1,0xA4,0xF1,0xA4,0xB1,0xA4,0xB0,0xA4,0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0xED,0x93,0x04,0x6A,0xAC,0xC4,0x6F,0xA4,0x6F,0xA4,0xAD,0x83,0x65,0x31,0x00,0x00,0x41,0x68,0xC6,0xB9,0xC4,0x8A,0x62,0x49,0xED,0x93,0x4F,0x9C,0xED,0x93,0x6C,0x7B,0xAD,0x83,
-	0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,0xC7,0x7A,0xCA,0x5A,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x65,0x31,0x24,0x21,0x24,0x21,0x24,0x21,0xC2,0x10,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,
-	0xA3,0x00,0x64,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0x26,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0xE6,0x00,0xE7,0x00,0x67,0x01,0x27,0x01,0x67,0x01,
-	0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0x6E,0x63,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,
-	0x33,0xB5,0x69,0x52,0x60,0x20,0x41,0x68,0x20,0x98,0x80,0xD0,0x20,0x98,0x20,0x98,0x20,0x98,0x91,0xD5,0xFB,0xF7,0x98,0xFF,0x98,0xFF,0x77,0xF7,0xD1,0xED,0xAD,0xE4,0xAD,0xE4,0xD1,0xED,0xD1,0xED,0x69,0x93,0x8E,0xDD,0x91,0xD5,0x37,0xF7,0x98,0xFF,0x36,0xFF,0x77,0xFF,0x36,0xFF,0x77,0xFF,0x17,0xFF,0x77,0xF7,0x17,0xFF,0x37,0xF7,
-	0x17,0xFF,0x77,0xFF,0x17,0xFF,0x77,0xF7,0x37,0xF7,0x77,0xFF,0xFA,0xFF,0x98,0xFF,0x53,0xFF,0x34,0xDE,0x33,0xB5,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xB1,0xA4,0xF1,0xA4,0xF1,0xAC,0xB0,0xA4,0xF1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0x6F,0xA4,0x70,0x94,0x69,0x93,
-	0x62,0x49,0x2E,0xCD,0x0E,0x84,0xAD,0x83,0x20,0x08,0x20,0x08,0x60,0x20,0x41,0x68,0xA5,0xB3,0x20,0x98,0x20,0x08,0xC2,0x10,0x65,0x31,0xE7,0x41,0x65,0x31,0xE7,0x41,0x65,0x31,0x65,0x31,0x24,0x21,0x24,0x21,0xE4,0x08,0xA2,0x08,0xA2,0x08,0x62,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x62,0x00,0x22,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,
-	0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,
-	0xED,0x4A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0x4E,0x53,0x6E,0x63,0xAF,0x63,0x6E,0x63,0x6E,0x63,0xAF,0x63,0xAF,0x63,0xAF,0x63,0xAF,0x63,0xAF,0x63,0xAF,0x63,0x6E,0x63,0x6E,0x63,0x49,0x3A,0x20,0x08,0x41,0x68,0x20,0x98,0x20,0x98,0x20,0x98,0x20,0x98,0xAD,0xE4,0xBA,0xF7,0x37,0xF7,0x77,0xF7,0xD5,0xEE,0xAD,0xE4,0xAD,0xE4,0xD1,0xED,
-	0x53,0xEE,0xD1,0xED,0x95,0xFE,0x98,0xFF,0xCA,0xA3,0x8E,0xDD,0xFD,0xFF,0xFA,0xFF,0x98,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0xFA,0xFF,0xFA,0xFF,0xFB,0xFF,0xFA,0xFF,0xF4,0xF6,0xB2,0xF6,0x34,0xDE,0x31,0xB5,0x33,0xB5,0x31,0xB5,0xF2,0xA4,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,
-	0xF1,0xAC,0xF1,0xA4,0xF1,0xA4,0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x70,0x94,0x70,0x94,0x4F,0x9C,0x0E,0x84,0x6C,0x7B,0x6C,0x7B,0x8D,0x73,0x2B,0x6B,0xE7,0x41,0xA5,0xB3,0xCA,0x5A,0x69,0x52,0xA1,0x10,0x00,0x00,0xA1,0x30,0xC4,0x8A,0xE5,0xE4,0xE5,0xE4,0xA5,0xB3,0xC4,0x8A,0xC4,0x8A,0x62,0x49,0xC2,0x10,0x62,0x08,0x62,0x00,
-	0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,
-	0xE6,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0x67,0x01,0x28,0x01,0x67,0x01,
-	0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x0D,0x53,0x0D,0x53,0x4E,0x53,0x6E,0x63,0x6E,0x63,
-	0x6E,0x63,0x0D,0x53,0x00,0x00,0x60,0x20,0x41,0x68,0x20,0x98,0x20,0x98,0xAD,0xE4,0xBA,0xF7,0xD7,0xEE,0x37,0xF7,0xD7,0xEE,0xAC,0xC4,0xAD,0xE4,0xD1,0xED,0x95,0xFE,0x38,0xFF,0x95,0xFE,0xD1,0xED,0xD7,0xFF,0x91,0xD5,0x41,0x68,0xAC,0xC4,0xD1,0xED,0xD7,0xFF,0xD7,0xFF,0x76,0xFF,0x76,0xFF,0xD7,0xFF,0xFA,0xFF,0xBA,0xFF,0x98,0xFF,
-	0xFA,0xFF,0xFA,0xFF,0xF5,0xF6,0xD1,0xED,0xAD,0xE4,0xE5,0xE4,0x80,0xD0,0x2B,0xB4,0xD7,0xFF,0xB2,0xF6,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF1,0xA4,0xF1,0xA4,0xB1,0x9C,0x70,0x94,0x50,0x8C,0x0E,0x84,0xEF,0x7B,0xEF,0x7B,0x8D,0x73,0x4C,0x6B,0x4C,0x6B,0x0D,0x53,0xCA,0x5A,0xED,0x4A,0x69,0x52,0x49,0x3A,0x49,0x3A,0x62,0x49,
-	0xE5,0xE4,0x67,0x29,0xA2,0x08,0x20,0x00,0xC4,0x8A,0xE5,0xE4,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0xE5,0xE4,0xC4,0x8A,0xE9,0x29,0xE7,0x41,0xE9,0x29,0xE7,0x41,0xE7,0x41,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x65,0x31,0xE7,0x41,0x65,0x31,0x65,0x31,0x65,0x31,0x65,0x31,0x24,0x21,0x24,0x21,0x24,0x21,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,
-	0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0x67,0x01,0x68,0x01,0x27,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xEA,0x01,0xC9,0x11,0x2A,0x1A,
-	0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0x6E,0x63,0x6E,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0x0E,0x84,0x4F,0x9C,0xB0,0xA4,0xF0,0xAC,0x91,0xD5,0x91,0xD5,0x24,0x21,0x00,0x00,0xA1,0x30,0x41,0x68,0x20,0x98,0x34,0xDE,0x39,0xEF,0x37,0xF7,0x37,0xF7,0x2E,0xCD,0xAD,0xE4,0x53,0xEE,0x95,0xFE,0xD1,0xED,
-	0x94,0xFE,0x17,0xFF,0xD1,0xED,0xD1,0xED,0xFA,0xFF,0xC4,0x8A,0x41,0x68,0x20,0x98,0xC6,0xB9,0xAD,0xE4,0x35,0xF7,0xF5,0xF6,0x36,0xF7,0x34,0xDE,0xD1,0xED,0x77,0xF7,0xD1,0xED,0xC6,0xB9,0x80,0xD0,0x80,0xD0,0xA0,0xEA,0x80,0xD0,0x20,0x98,0x34,0xDE,0xFA,0xFF,0xD3,0xFF,0xB2,0xF6,0xF2,0xA4,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,
-	0xF2,0xA4,0xF1,0xA4,0xF1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0x70,0x94,0xB1,0x9C,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0x4F,0x9C,0x69,0x93,0xCA,0xA3,0x00,0x00,0x00,0x00,0xC4,0x8A,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0xE5,0xE4,0xA5,0xB3,
-	0xCA,0x5A,0x69,0x52,0x69,0x52,0x49,0x3A,0xE7,0x41,0xE7,0x41,0x67,0x29,0x65,0x31,0x65,0x31,0x24,0x21,0x24,0x21,0xC4,0x10,0xC2,0x10,0xA2,0x08,0x61,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0x26,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x67,0x01,0x27,0x01,0x68,0x01,
-	0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0x8D,0x73,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x4F,0x9C,0xF0,0xAC,0x52,0xBD,0xD1,0xB4,0xD1,0xB4,0xAC,0xC4,0x2B,0xB4,0xCA,0xA3,0xC7,0x7A,
-	0x04,0x6A,0xC7,0x7A,0x2B,0x6B,0x00,0x00,0x20,0x08,0xA1,0x30,0x04,0x6A,0xD7,0xEE,0xD7,0xEE,0xD7,0xEE,0x97,0xDE,0xAD,0xE4,0xAD,0xE4,0x53,0xEE,0x95,0xFE,0x53,0xEE,0xD1,0xED,0x15,0xFF,0x94,0xFE,0x0F,0xE6,0xFA,0xFF,0x4A,0xD3,0x20,0x98,0x20,0x98,0x20,0x98,0xC6,0xB9,0x37,0xEF,0x95,0xFE,0xCA,0xA3,0xC4,0x8A,0xE5,0xE4,0x50,0xFF,
-	0x4A,0xD3,0x80,0xD0,0x80,0xD0,0xA0,0xEA,0x80,0xD0,0x80,0xD0,0x91,0xD5,0xFC,0xFF,0x77,0xFF,0x76,0xFF,0xD3,0xFF,0x93,0xBD,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xAC,0xF1,0xA4,0xF1,0xA4,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xCA,0xA3,
-	0xA5,0xB3,0xA1,0x30,0x20,0x98,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0x50,0xFF,0x49,0xFE,0xE5,0xE4,0xE5,0xE4,0xEE,0xFE,0x49,0xFE,0xE5,0xE4,0x69,0x52,0x67,0x29,0x67,0x29,0x24,0x21,0x47,0x11,0xE5,0x08,0xE4,0x08,0xA3,0x00,0xA3,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,
-	0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0x27,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0x0D,0x53,0x6E,0x63,0xAF,0x63,0x0E,0x84,
-	0x50,0x8C,0x70,0x94,0xB1,0x9C,0x70,0x94,0xED,0x93,0x6F,0xA4,0x2E,0xCD,0x2E,0xCD,0x2B,0xB4,0x69,0x93,0x04,0x6A,0x62,0x49,0x62,0x49,0x60,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x4F,0x9C,0x04,0x6A,0x20,0x00,0x20,0x08,0xC7,0x7A,0x95,0xFE,0xF6,0xF6,0xD7,0xEE,0x34,0xDE,0xAD,0xE4,0xAD,0xE4,0x95,0xFE,0xD1,0xED,0x95,0xFE,
-	0xD1,0xED,0xD1,0xED,0x76,0xFF,0x90,0xF6,0xAD,0xE4,0x20,0x98,0x20,0x98,0x80,0xD0,0x80,0xD0,0xCA,0xA3,0xFA,0xFF,0xD5,0xEE,0xC4,0x8A,0xC4,0x8A,0xE5,0xE4,0x49,0xFE,0x8E,0xDD,0x20,0x98,0x20,0x98,0x80,0xD0,0xC6,0xB9,0x91,0xD5,0xBB,0xFF,0x98,0xFF,0x76,0xFF,0x53,0xFF,0x50,0xFF,0x91,0xD5,0x93,0xBD,0xD4,0xCD,0x52,0xBD,0x4A,0xD3,
-	0x52,0xBD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xB0,0xA4,0xA5,0xB3,0xC4,0x8A,0x20,0x98,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0xEE,0xFE,0xEE,0xFE,0xE5,0xE4,0x49,0xFE,0xD3,0xFF,0x76,0xFF,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,
-	0xA5,0xB3,0xE7,0x41,0xA8,0x19,0x47,0x11,0x47,0x11,0xC4,0x10,0xE4,0x08,0xE4,0x08,0xA4,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,
-	0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,
-	0xE6,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0x27,0x01,0x67,0x01,0x28,0x01,
-	0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0x8D,0x73,0x0E,0x84,0x4F,0x9C,0xAC,0xC4,0xAC,0xC4,0xCA,0xA3,0xC7,0x7A,0x62,0x49,0xA1,0x30,0x60,0x08,0x20,0x08,0x20,0x08,0x60,0x08,0x60,0x20,0x60,0x20,0x60,0x08,
-	0x00,0x00,0x62,0x49,0xED,0x93,0xB1,0xAC,0x04,0x6A,0x00,0x00,0x04,0x6A,0x17,0xFF,0xD5,0xEE,0xD5,0xEE,0x97,0xDE,0xAD,0xE4,0xC6,0xB9,0x4A,0xD3,0x95,0xFE,0x94,0xFE,0xD1,0xED,0x0F,0xE6,0xFA,0xFF,0xAC,0xC4,0x41,0x68,0x80,0xD0,0x80,0xD0,0x80,0xD0,0x20,0x98,0xAC,0xC4,0x98,0xFF,0xF5,0xF6,0xA5,0xB3,0xA5,0xB3,0x49,0xFE,0x49,0xFE,
-	0xF4,0xF6,0x4A,0xD3,0x4A,0xD3,0x91,0xD5,0xFA,0xFF,0xFA,0xFF,0x76,0xFF,0x76,0xFF,0x76,0xFF,0x50,0xFF,0x50,0xFF,0x0F,0xE6,0xAC,0xC4,0x31,0xB5,0x4A,0xD3,0x4A,0xD3,0xAD,0xE4,0xD1,0xB4,0x4A,0xD3,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x6F,0xA4,0x2B,0xB4,
-	0x04,0x6A,0xA5,0xB3,0x50,0xFF,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0xE5,0xE4,0x49,0xFE,0xEE,0xFE,0xD7,0xFF,0xD3,0xFF,0x50,0xFF,0xEE,0xFE,0x49,0xFE,0x50,0xFF,0xEE,0xFE,0xE5,0xE4,0x69,0x52,0xE9,0x29,0x67,0x29,0xA8,0x19,0x47,0x11,0x47,0x11,0x25,0x01,0xE4,0x00,0xE4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,
-	0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,
-	0xE6,0x00,0xE7,0x00,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0x2A,0x1A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0x8D,0x73,0xEF,0x7B,0x4F,0x9C,
-	0x6F,0xA4,0xAC,0xC4,0xCA,0xA3,0xC7,0x7A,0x62,0x49,0xA1,0x30,0x60,0x20,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x60,0x20,0x60,0x20,0x60,0x20,0x20,0x08,0xA1,0x30,0xAD,0x83,0x6F,0xA4,0x52,0xBD,0x69,0x93,0xC4,0x8A,0xD1,0xED,0x34,0xDE,0x34,0xDE,0xF6,0xF6,0xAC,0xC4,0xA1,0x30,0xA1,0x30,0xCA,0xA3,0xD1,0xED,
-	0x15,0xFF,0x0F,0xE6,0xAD,0xE4,0x41,0x68,0x20,0x98,0x80,0xD0,0x80,0xD0,0x80,0xD0,0x80,0xD0,0xD5,0xEE,0x37,0xEF,0x77,0xF7,0xB2,0xF6,0xE5,0xE4,0xE5,0xE4,0x0F,0xE6,0x76,0xFF,0xFA,0xFF,0xFA,0xFF,0xD7,0xFF,0x76,0xFF,0x76,0xFF,0x76,0xFF,0x76,0xFF,0x53,0xFF,0xD3,0xFF,0x50,0xFF,0x4A,0xD3,0x45,0xF0,0x4A,0xD3,0x4A,0xD3,0x4A,0xD3,
-	0x4A,0xD3,0xAD,0xE4,0x4A,0xD3,0x4A,0xD3,0x93,0xBD,0x31,0xB5,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xB1,0xA4,0xB1,0x9C,0x70,0x94,0x50,0x8C,0xAD,0x83,0xE5,0xE4,0x41,0x68,0xC4,0x8A,0xEE,0xFE,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0xE5,0xE4,0x49,0xFE,0x50,0xFF,0xD3,0xFF,0xD3,0xFF,0x50,0xFF,0xEE,0xFE,0x49,0xFE,0xEE,0xFE,0x50,0xFF,
-	0x49,0xFE,0x04,0x6A,0xE5,0x00,0xE4,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,
-	0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,
-	0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0x2B,0xB4,0x91,0xD5,0xC7,0x7A,0x62,0x49,0x62,0x49,0x62,0x49,0x62,0x49,0xA1,0x30,0x24,0x21,0x62,0x49,0xA1,0x30,0x62,0x49,0xA1,0x30,0xA1,0x30,0x60,0x20,0x60,0x20,0x60,0x20,
-	0x60,0x20,0x20,0x00,0x04,0x6A,0x52,0xBD,0xD4,0xCD,0x95,0xFE,0x34,0xDE,0x91,0xD5,0x91,0xD5,0x91,0xD5,0x91,0xD5,0xAC,0xC4,0x62,0x49,0x62,0x49,0x41,0x68,0xAD,0xE4,0x53,0xFF,0x0F,0xE6,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0x4A,0xD3,0x4A,0xD3,0x2B,0xB4,0x97,0xDE,0x37,0xEF,0x37,0xF7,0x77,0xF7,0xD7,0xFF,0x76,0xF7,0x97,0xDE,0x76,0xF7,
-	0x35,0xF7,0x76,0xFF,0x76,0xFF,0x77,0xFF,0x76,0xFF,0x76,0xFF,0x53,0xFF,0x15,0xFF,0xD3,0xFF,0x50,0xFF,0x8E,0xDD,0xC6,0xB9,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x4A,0xD3,0x4A,0xD3,0x90,0xF6,0xD3,0xFF,0x90,0xF6,0x90,0xF6,0x91,0xD5,0xF0,0xAC,0x0E,0x84,0xEF,0x7B,0xAF,0x63,0x6E,0x63,0x4E,0x53,0xCA,0x5A,0x2B,0xB4,
-	0xA1,0x30,0xC4,0x8A,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0xEE,0xFE,0x76,0xFF,0x53,0xFF,0x50,0xFF,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0xA5,0xB3,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0x26,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0x67,0x29,
-	0x2B,0xB4,0x2E,0xCD,0xC7,0x7A,0x62,0x49,0x65,0x31,0x62,0x49,0x62,0x49,0x62,0x49,0xA1,0x30,0x62,0x49,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x20,0x08,0x20,0x08,0x6C,0x7B,0xD4,0xCD,0x97,0xDE,0xD7,0xEE,0x97,0xDE,0x91,0xD5,0xAC,0xC4,0xAD,0xE4,0xC7,0x7A,0x04,0x6A,0xA5,0xB3,0xAC,0xC4,0x8E,0xDD,
-	0x53,0xEE,0x39,0xEF,0xBB,0xF7,0xFA,0xF7,0xFA,0xF7,0xFB,0xF7,0xFB,0xF7,0xFB,0xFF,0xBA,0xFF,0x38,0xF7,0x78,0xF7,0x77,0xFF,0x36,0xFF,0x15,0xFF,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x76,0xFF,0x77,0xFF,0x76,0xFF,0x35,0xF7,0x53,0xFF,0x76,0xFF,0xD7,0xFF,0x50,0xFF,0xAC,0xC4,0x2D,0xAD,0x4A,0xD3,0xC6,0xB9,0xC6,0xB9,0x45,0xF0,0x45,0xF0,
-	0x45,0xF0,0x45,0xF0,0x45,0xF0,0x4A,0xD3,0xAD,0xE4,0x90,0xF6,0x0F,0xE6,0x0F,0xE6,0xEE,0xFE,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0x52,0xBD,0xF1,0xA4,0x50,0x8C,0xE5,0xE4,0x65,0x31,0x41,0x68,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0x50,0xFF,0x53,0xFF,0x53,0xFF,0xEE,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0xEE,0xFE,
-	0x49,0xFE,0xE5,0xE4,0x2A,0x1A,0x2A,0x1A,0xC9,0x11,0xA9,0x01,0x68,0x09,0x68,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,
-	0xC9,0x11,0xC9,0x11,0xA9,0x01,0xC9,0x11,0xC9,0x11,0xC9,0x11,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x22,0x4B,0x22,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0x61,0x08,0x2B,0xB4,0x91,0xD5,0xCA,0xA3,0x04,0x6A,0xA1,0x30,0xA1,0x30,0x62,0x49,0x24,0x21,0xA1,0x30,0x24,0x21,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x60,0x20,
-	0x60,0x20,0x60,0x20,0x20,0x08,0x20,0x08,0x04,0x6A,0x52,0xBD,0x95,0xFE,0x97,0xDE,0x38,0xF7,0x38,0xFF,0xD1,0xB4,0x62,0x49,0xC4,0x8A,0xAC,0xC4,0x39,0xFF,0x39,0xF7,0x39,0xF7,0x7A,0xF7,0x39,0xF7,0x79,0xF7,0x7A,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x79,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x76,0xFF,0x53,0xFF,0xD5,0xEE,0xF5,0xF6,
-	0x36,0xF7,0x76,0xFF,0x76,0xFF,0x35,0xF7,0x76,0xFF,0xD7,0xFF,0xD3,0xFF,0xAC,0xC4,0x69,0x93,0xCA,0xA3,0x2B,0xB4,0x45,0xF0,0x45,0xF0,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x50,0xFF,0x0F,0xE6,0x8E,0xDD,0x2E,0xCD,0x8E,0xDD,0x0F,0xE6,0xEE,0xFE,0x50,0xFF,0xD3,0xFF,0xAC,0xC4,0x2B,0xB4,
-	0x4C,0x6B,0x69,0x52,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0x53,0xFF,0x53,0xFF,0x53,0xFF,0x53,0xFF,0xEE,0xFE,0x49,0xFE,0x0F,0xE6,0xEE,0xFE,0x49,0xFE,0xA5,0xB3,0x26,0x09,0x26,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0xE7,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x61,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xE5,0x00,0x26,0x01,0xE5,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x67,0x01,0x67,0x01,0x67,0x09,0x67,0x01,0x67,0x09,0xA8,0x11,0xA8,0x11,0xA8,0x11,0xC9,0x11,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x4E,0x53,
-	0x49,0x3A,0x00,0x00,0xC7,0x7A,0x91,0xD5,0x91,0xD5,0x69,0x93,0x04,0x6A,0x60,0x20,0x60,0x20,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x60,0x20,0xA1,0x30,0x60,0x20,0x60,0x20,0x60,0x20,0x20,0x08,0x21,0x00,0x62,0x49,0x6F,0xA4,0x34,0xDE,0x38,0xFF,0xF6,0xF6,0x62,0x49,0x04,0x6A,0x2E,0xCD,0xD7,0xEE,0x39,0xF7,0xD7,0xEE,
-	0x38,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x98,0xFF,0x77,0xF7,0x76,0xFF,0x76,0xFF,0xB2,0xF6,0xB2,0xF6,0xF6,0xF6,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xD7,0xFF,0xD7,0xFF,0xEE,0xFE,0xC6,0xB9,0x04,0x6A,0x69,0x93,0xCA,0xA3,0x4A,0xD3,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,
-	0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0x45,0xF0,0xAD,0xE4,0x90,0xF6,0x0F,0xE6,0x0F,0xE6,0x8E,0xDD,0x8E,0xDD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x90,0xF6,0x8E,0xDD,0xA5,0xB3,0x2D,0xAD,0xC7,0x7A,0xE5,0xE4,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0x50,0xFF,0x53,0xFF,0x53,0xFF,0x50,0xFF,0xEE,0xFE,0x49,0xFE,0xEE,0xFE,0x50,0xFF,
-	0x49,0xFE,0x04,0x6A,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x27,0x01,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x25,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x09,0x66,0x09,0x67,0x09,0x67,0x09,0x67,0x09,0xA8,0x11,
-	0xA8,0x11,0xA8,0x19,0xC9,0x11,0xE9,0x29,0xE9,0x29,0xE9,0x29,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x6E,0x63,0x6E,0x63,0x8D,0x73,0xEF,0x7B,0xE7,0x41,0x00,0x00,0x24,0x21,0xC7,0x7A,0x91,0xD5,0x91,0xD5,0xCA,0xA3,0x04,0x6A,0xA1,0x30,0x60,0x20,0x60,0x20,0xA1,0x10,0xA1,0x30,0xA1,0x30,0xA1,0x30,
-	0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x00,0x00,0x20,0x08,0xC7,0x7A,0x91,0xD5,0x04,0x6A,0x62,0x49,0xAC,0xC4,0x91,0xD5,0x7A,0xF7,0xD7,0xEE,0xD7,0xEE,0x38,0xF7,0xD7,0xEE,0xD7,0xEE,0xD7,0xEE,0xD7,0xEE,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x36,0xF7,0x77,0xF7,0x36,0xF7,0x53,0xFF,0xD3,0xFF,0x76,0xFF,0xD7,0xFF,
-	0xD7,0xFF,0xD7,0xFF,0xD7,0xFF,0x90,0xF6,0x4A,0xD3,0x20,0x98,0x41,0x68,0x69,0x93,0x69,0x93,0xCA,0xA3,0xC6,0xB9,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x45,0xF0,0x2E,0xCD,0x50,0xFF,0x0F,0xE6,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x8E,0xDD,0x8E,0xDD,0x2E,0xCD,0xAC,0xC4,0x2B,0xB4,0x69,0x93,0xA5,0xB3,
-	0x50,0xFF,0x50,0xFF,0xE5,0xE4,0x49,0xFE,0x49,0xFE,0xD3,0xFF,0xEE,0xFE,0x49,0xFE,0x90,0xF6,0x50,0xFF,0x53,0xFF,0xEE,0xFE,0xEE,0xFE,0xE5,0xE4,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0x47,0x11,0x67,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,
-	0xA3,0x00,0xA4,0x00,0xE4,0x00,0xE5,0x00,0xE4,0x00,0xE5,0x00,0x25,0x01,0xE5,0x00,0x25,0x01,0x26,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x67,0x09,0x67,0x09,0xA8,0x11,0xA8,0x11,0xA8,0x11,0xA8,0x19,0xE9,0x29,0x2A,0x1A,0xE9,0x29,0x4B,0x2A,0x49,0x3A,0x49,0x3A,0xAC,0x3A,0xCA,0x5A,0xED,0x4A,0x0D,0x53,0x4C,0x6B,0x6E,0x63,0x8D,0x73,
-	0xEF,0x7B,0x4C,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x49,0x69,0x93,0xB2,0xF6,0x94,0xFE,0x8E,0xDD,0x69,0x93,0x04,0x6A,0xA1,0x30,0x60,0x08,0x20,0x00,0x20,0x00,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x60,0x20,0x00,0x00,0x00,0x00,0x60,0x20,0x62,0x49,0xAC,0xC4,0x8E,0xDD,0xF6,0xF6,0x79,0xFF,0x7A,0xF7,0x39,0xF7,
-	0x39,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0xF6,0xF6,0x35,0xEF,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x76,0xFF,0x76,0xFF,0xD7,0xFF,0xD7,0xFF,0x0F,0xE6,0xAD,0xE4,0x8E,0xDD,0x0F,0xE6,0xAD,0xE4,0xC6,0xB9,0x80,0xD0,0x20,0x98,0x41,0x68,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0x4A,0xD3,0x45,0xF0,0x45,0xF0,0x45,0xF0,
-	0x45,0xF0,0x45,0xF0,0x45,0xF0,0x91,0xD5,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x2E,0xCD,0x2E,0xCD,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0xC4,0x8A,0xC4,0x8A,0xAC,0xC4,0x50,0xFF,0x49,0xFE,0xE5,0xE4,0x49,0xFE,0xEE,0xFE,0x49,0xFE,0xE5,0xE4,0x49,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xE5,0xE4,0x49,0xFE,0x49,0xFE,0x49,0xFE,
-	0xC4,0x8A,0xE6,0x00,0x27,0x01,0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x26,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x61,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xE4,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x09,0x67,0x09,0x67,0x09,0x67,0x09,
-	0xA8,0x11,0xA8,0x11,0xC9,0x11,0xC9,0x11,0xE9,0x29,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x6E,0x63,0xAF,0x63,0x8D,0x73,0xEF,0x7B,0xA1,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x49,0xC7,0x7A,0x8E,0xDD,0xF4,0xF6,0xB2,0xF6,0x8E,0xDD,0xCA,0xA3,0x04,0x6A,0x62,0x49,
-	0x60,0x20,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA1,0x30,0x69,0x93,0x2B,0xB4,0x04,0x6A,0xAC,0xC4,0x34,0xDE,0xF6,0xF6,0x38,0xF7,0xB9,0xF7,0xFA,0xFF,0xFA,0xF7,0xFA,0xFF,0xFA,0xFF,0xFA,0xFF,0xD7,0xFF,0xD7,0xFF,0xD7,0xFF,0x76,0xFF,0xF4,0xF6,0x8E,0xDD,0x4A,0xD3,0x20,0x98,0x20,0x98,0x20,0x98,
-	0x80,0xD0,0x80,0xD0,0x20,0x98,0x20,0x98,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0x69,0x93,0xCA,0xA3,0x2D,0xAD,0x2B,0xB4,0xC6,0xB9,0x45,0xF0,0x45,0xF0,0x4A,0xD3,0x0F,0xE6,0x8E,0xDD,0x2E,0xCD,0x8E,0xDD,0x2E,0xCD,0x2E,0xCD,0xAC,0xC4,0xAC,0xC4,0xCA,0xA3,0x69,0x93,0x69,0x93,0xCA,0xA3,0x8E,0xDD,
-	0x50,0xFF,0x50,0xFF,0x90,0xF6,0xE5,0xE4,0x49,0xFE,0x49,0xFE,0x50,0xFF,0x49,0xFE,0x49,0xFE,0xEE,0xFE,0xEE,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0xA5,0xB3,0x63,0x08,0xE6,0x00,0x26,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0x6E,0x63,
-	0x8D,0x73,0xEF,0x7B,0x65,0x31,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x60,0x20,0x04,0x6A,0xCA,0xA3,0x8E,0xDD,0x94,0xFE,0x53,0xFF,0xB2,0xF6,0x8E,0xDD,0xCA,0xA3,0x04,0x6A,0xA1,0x30,0x20,0x08,0x20,0x00,0x20,0x08,0xA1,0x30,0xC4,0x8A,0xAD,0xE4,0x04,0x6A,0x00,0x00,0xA1,0x30,0x41,0x68,0x20,0x98,0xC6,0xB9,
-	0xC6,0xB9,0xAC,0xC4,0xAD,0xE4,0x4A,0xD3,0xAC,0xC4,0x4A,0xD3,0x4A,0xD3,0x2B,0xB4,0xC6,0xB9,0xC6,0xB9,0x20,0x98,0x20,0x98,0x20,0x98,0x20,0x98,0x80,0xD0,0x80,0xD0,0x20,0x98,0x20,0x98,0x41,0x68,0x04,0x6A,0x69,0x52,0xC7,0x7A,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0x2D,0xAD,
-	0xAC,0xC4,0x4A,0xD3,0xAC,0xC4,0x2D,0xAD,0xAC,0xC4,0xAC,0xC4,0x2B,0xB4,0xCA,0xA3,0xA5,0xB3,0xCA,0xA3,0xCA,0xA3,0xAC,0xC4,0x8E,0xDD,0x90,0xF6,0x50,0xFF,0xD3,0xFF,0x90,0xF6,0xEE,0xFE,0x2D,0xAD,0xA8,0x19,0xA5,0xB3,0x49,0xFE,0xEE,0xFE,0xE5,0xE4,0x49,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x49,0xFE,0xA5,0xB3,0x20,0x08,
-	0xA3,0x00,0xE6,0x00,0x27,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,
-	0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,
-	0xA9,0x01,0xA9,0x01,0xEA,0x01,0xC9,0x11,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0xAF,0x63,0x8D,0x73,0x4C,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0x60,0x20,0x60,0x08,0x60,0x20,0x62,0x49,0x04,0x6A,0xC7,0x7A,0x2B,0xB4,
-	0x2E,0xCD,0xB2,0xF6,0x53,0xFF,0x90,0xF6,0x2E,0xCD,0x69,0x93,0x62,0x49,0x62,0x49,0xCA,0xA3,0x69,0x93,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x20,0x60,0x20,0xA1,0x30,0x41,0x68,0x41,0x68,0x41,0x68,0x41,0x68,0x41,0x68,0x41,0x68,0x41,0x68,0x41,0x68,0x41,0x68,0x41,0x68,0x41,0x68,0x20,0x98,0x20,0x98,0x20,0x98,0x41,0x68,0x41,0x68,
-	0x62,0x49,0x62,0x49,0xE7,0x41,0x69,0x52,0x04,0x6A,0x04,0x6A,0x04,0x6A,0x04,0x6A,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0xCA,0xA3,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0x69,0x93,0xCA,0xA3,0x2B,0xB4,0xAC,0xC4,0x8E,0xDD,0x0F,0xE6,0x50,0xFF,0x50,0xFF,0xD3,0xFF,0x50,0xFF,0xEE,0xFE,0xEE,0xFE,
-	0xEE,0xFE,0x50,0xFF,0x0D,0x53,0x27,0x01,0xA4,0x00,0xE5,0xE4,0xEE,0xFE,0x49,0xFE,0xE5,0xE4,0x50,0xFF,0xD3,0xFF,0x49,0xFE,0x49,0xFE,0xA5,0xB3,0xE5,0x08,0x62,0x00,0xA4,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x27,0x01,0xE6,0x00,0x26,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,
-	0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x28,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,
-	0x6E,0x63,0x6E,0x63,0x8D,0x73,0x24,0x21,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x60,0x20,0x60,0x20,0x60,0x20,0xA1,0x30,0xA1,0x30,0xC2,0x10,0xA1,0x30,0xA1,0x30,0x62,0x49,0x04,0x6A,0xC7,0x7A,0x2B,0xB4,0xB2,0xF6,0xAC,0xC4,0x62,0x49,0x04,0x6A,0xAC,0xC4,0x8E,0xDD,0xCA,0xA3,0xC7,0x7A,0x04,0x6A,0x04,0x6A,0x41,0x68,0x41,0x68,
-	0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x60,0x20,0x60,0x20,0x60,0x20,0x20,0x08,0x20,0x08,0x60,0x20,0x60,0x20,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x62,0x49,0x62,0x49,0x04,0x6A,0x04,0x6A,0x04,0x6A,0xC7,0x7A,0x69,0x93,0x69,0x93,0x2B,0xB4,0xAC,0xC4,
-	0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x8E,0xDD,0x90,0xF6,0xEE,0xFE,0x50,0xFF,0xD3,0xFF,0xD3,0xFF,0x50,0xFF,0xEE,0xFE,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0x50,0xFF,0x50,0xFF,0xA8,0x19,0x27,0x01,0x27,0x01,0x24,0x21,0xE5,0xE4,0x49,0xFE,0xE5,0xE4,0x50,0xFF,0xD3,0xFF,0x49,0xFE,0x49,0xFE,0xA1,0x30,0x27,0x01,0x27,0x01,
-	0x27,0x01,0xE7,0x00,0x27,0x01,0x26,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,
-	0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,
-	0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0xE7,0x00,0x27,0x01,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,
-	0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x6E,0x63,0xAF,0x63,0x4C,0x6B,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x60,0x20,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x62,0x49,0x62,0x49,0x62,0x49,
-	0x62,0x49,0x62,0x49,0x62,0x49,0x62,0x49,0x62,0x49,0xA1,0x30,0x04,0x6A,0x2B,0xB4,0xAC,0xC4,0x8E,0xDD,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0x53,0xFF,0xB2,0xF6,0x0F,0xE6,0x8E,0xDD,0xAD,0xE4,0xAC,0xC4,0x2B,0xB4,0xCA,0xA3,0xCA,0xA3,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,
-	0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0x50,0xFF,0x50,0xFF,0xD3,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,
-	0x50,0xFF,0x6C,0x7B,0x66,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xC4,0x8A,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0x49,0xFE,0xA5,0xB3,0x21,0x00,0x26,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0xE6,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,
-	0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,
-	0x0D,0x53,0x0D,0x53,0x6E,0x63,0x4C,0x6B,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x08,0xA1,0x30,0x62,0x49,0x62,0x49,0x62,0x49,0xA1,0x30,0x62,0x49,0x62,0x49,0xE7,0x41,0x62,0x49,0x69,0x52,0x04,0x6A,0xA1,0x30,0x62,0x49,0xCA,0xA3,0x8E,0xDD,0xC7,0x7A,0x04,0x6A,0x69,0x93,0x2B,0xB4,0xAC,0xC4,0x8E,0xDD,0x0F,0xE6,0x90,0xF6,
-	0x50,0xFF,0x53,0xFF,0x53,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0xD3,0xFF,0x50,0xFF,0xD3,0xFF,0x50,0xFF,0x53,0xFF,0x53,0xFF,0xD3,0xFF,0x53,0xFF,0x50,0xFF,0xD3,0xFF,0x50,0xFF,0xD3,0xFF,0x50,0xFF,0xD3,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x50,0xFF,0x90,0xF6,0x90,0xF6,0x90,0xF6,
-	0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x2E,0xCD,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0xE6,0x08,0xE5,0xE4,0xE5,0xE4,0xE5,0xE4,0x49,0xFE,0x49,0xFE,0x20,0x98,0x60,0x20,0xE7,0x00,0x26,0x01,
-	0xE7,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA5,0x00,
-	0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,
-	0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0xCA,0x5A,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x60,0x20,0x60,0x20,0xA1,0x30,0x62,0x49,0x62,0x49,0xE7,0x41,0x62,0x49,0x62,0x49,
-	0x62,0x49,0x62,0x49,0x04,0x6A,0xA1,0x30,0x62,0x49,0x69,0x93,0x0F,0xE6,0x69,0x93,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x52,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x2E,0xCD,0x2E,0xCD,
-	0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0x50,0xFF,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,
-	0x2D,0xAD,0x27,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x69,0x93,0xC4,0x8A,0xE5,0xE4,0x49,0xFE,0xA5,0xB3,0x41,0x68,0x60,0x20,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE7,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0xAC,0x3A,
-	0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x60,0x20,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x62,0x49,0x62,0x49,0x04,0x6A,0xE7,0x41,0x62,0x49,0xA1,0x30,0xA1,0x30,0xC4,0x8A,0x8E,0xDD,0xCA,0xA3,0x04,0x6A,0xC7,0x7A,0x6C,0x7B,0x69,0x93,0x69,0x93,0xCA,0xA3,0x69,0x93,0x69,0x93,0xC7,0x7A,
-	0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,
-	0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0x50,0xFF,0x6C,0x7B,0x26,0x01,0x27,0x01,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x65,0x31,0xE6,0x00,0xA5,0xB3,0x2B,0xB4,0x04,0x6A,0x62,0x49,0xA1,0x30,0xE7,0x00,0x27,0x01,
-	0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE7,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0x27,0x01,
-	0x27,0x01,0x26,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0xA1,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x20,0x60,0x20,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x24,0x21,
-	0x04,0x6A,0x04,0x6A,0xA1,0x30,0x04,0x6A,0xAC,0xC4,0xC7,0x7A,0x62,0x49,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0xED,0x93,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,
-	0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0x90,0xF6,0xEE,0xFE,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0xEE,0xFE,0x50,0xFF,
-	0x49,0x3A,0x26,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0x27,0x01,0xE7,0x00,0x27,0x01,0xE7,0x00,0x69,0x52,0xC4,0x8A,0xE6,0x00,0x65,0x31,0x24,0x21,0xE6,0x00,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0xE7,0x00,0x27,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,
-	0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0xE7,0x41,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x60,0x08,0x60,0x20,0xA1,0x30,0xA1,0x30,0xA1,0x30,0xA1,0x30,0x62,0x49,0x62,0x49,0xA1,0x30,0x62,0x49,0xCA,0xA3,0xCA,0xA3,0x69,0x52,0x04,0x6A,0xE7,0x41,0x04,0x6A,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,
-	0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,
-	0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0xEE,0xFE,0x50,0xFF,0x2D,0xAD,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x25,0x01,0x66,0x09,0xE7,0x00,0xE6,0x08,0xE5,0x08,0xE6,0x00,0xE6,0x00,
-	0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,
-	0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,
-	0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x66,0x01,0x67,0x09,0x67,0x09,0x47,0x11,0xA8,0x19,0xE9,0x29,0xE9,0x29,0x49,0x3A,0x49,0x3A,0x49,0x3A,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x60,0x20,0x60,0x08,0x60,0x20,0xA1,0x30,0x24,0x21,0x62,0x49,0xC4,0x8A,
-	0xA1,0x30,0xA1,0x30,0x69,0x93,0x2B,0xB4,0x69,0x93,0x69,0x93,0xCA,0xA3,0x69,0x93,0xC7,0x7A,0x04,0x6A,0x69,0x52,0x04,0x6A,0x69,0x52,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0xCA,0xA3,0x2B,0xB4,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,
-	0x0F,0xE6,0x8E,0xDD,0x8E,0xDD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0x50,0xFF,0xA8,0x11,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0xE7,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,
-	0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0x25,0x01,0x66,0x09,0x47,0x11,0xA8,0x19,0xA8,0x19,0xE9,0x29,0xE9,0x29,0x49,0x3A,0x49,0x3A,0x69,0x52,0xCA,0x5A,0xCA,0x5A,0x4C,0x6B,
-	0x2B,0x6B,0x6C,0x7B,0xAD,0x83,0xAD,0x83,0x0E,0x84,0x24,0x21,0x20,0x00,0x20,0x08,0x20,0x08,0x60,0x20,0xA1,0x30,0x60,0x20,0x60,0x20,0xA1,0x30,0x62,0x49,0x04,0x6A,0x62,0x49,0x62,0x49,0x2B,0xB4,0xCA,0xA3,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xCA,0xA3,0x69,0x93,0xCA,0xA3,
-	0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0xED,0x93,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x91,0xD5,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x50,0xFF,0xEE,0xFE,0x90,0xF6,0x90,0xF6,
-	0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x50,0xFF,0xEE,0xFE,0xEE,0xFE,0xE9,0x29,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,
-	0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xE5,0x00,0x25,0x01,0x26,0x09,0x47,0x11,0x47,0x11,0xA8,0x19,0xE9,0x29,
-	0xE9,0x29,0x49,0x3A,0x49,0x3A,0xCA,0x5A,0xCA,0x5A,0x0D,0x53,0x2B,0x6B,0x6C,0x7B,0x8D,0x73,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x50,0x8C,0x70,0x94,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x4F,0x9C,0x60,0x08,0x20,0x08,0x20,0x08,0x60,0x20,0xA1,0x30,0x62,0x49,0xA1,0x30,0x60,0x20,0x62,0x49,0x04,0x6A,
-	0x62,0x49,0xC4,0x8A,0xCA,0xA3,0xC7,0x7A,0x69,0x93,0x69,0x93,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x8E,0xDD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0xAC,0xC4,0x2E,0xCD,0xAC,0xC4,0x2E,0xCD,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x91,0xD5,0x0F,0xE6,
-	0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x50,0xFF,0x90,0xF6,0x50,0xFF,0x90,0xF6,0x90,0xF6,0x50,0xFF,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xED,0x93,0x67,0x01,0x28,0x01,
-	0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE6,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,
-	0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xE5,0x00,0x25,0x01,0x26,0x09,0x66,0x09,0x47,0x11,0xA8,0x19,0xA8,0x19,0xA8,0x19,0xE9,0x29,0xE9,0x29,0x49,0x3A,0x49,0x3A,0x49,0x3A,0x69,0x52,0xED,0x4A,0xCA,0x5A,0xCA,0x5A,0x4C,0x6B,0x4C,0x6B,0x8D,0x73,0x8D,0x73,
-	0xAD,0x83,0xEF,0x7B,0x0E,0x84,0x50,0x8C,0x4F,0x9C,0x70,0x94,0x0E,0x84,0x20,0x00,0x20,0x08,0x60,0x20,0x60,0x20,0x60,0x20,0x62,0x49,0xA1,0x30,0x62,0x49,0x04,0x6A,0x04,0x6A,0xCA,0xA3,0xC7,0x7A,0xC7,0x7A,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0x8E,0xDD,0x8E,0xDD,
-	0x8E,0xDD,0x91,0xD5,0x8E,0xDD,0x91,0xD5,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x50,0xFF,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0x90,0xF6,
-	0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xE9,0x29,0x28,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0x27,0x01,
-	0xE7,0x00,0x27,0x01,0xE7,0x00,0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,
-	0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0x26,0x01,
-	0x66,0x09,0x67,0x09,0xA8,0x19,0xA8,0x19,0xE9,0x29,0x4B,0x2A,0x49,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x6E,0x63,0x6E,0x63,0x8D,0x73,0x8D,0x73,0xEF,0x7B,0xEF,0x7B,0x0E,0x84,0x0E,0x84,0x50,0x8C,0x70,0x94,0x70,0x94,0x70,0x94,0x6C,0x7B,0x20,0x00,0x60,0x08,0x60,0x20,0x60,0x20,0xA1,0x30,0x60,0x08,0x62,0x49,0xC4,0x8A,
-	0xC7,0x7A,0x69,0x93,0x62,0x49,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,
-	0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x2D,0xAD,0x68,0x01,0x68,0x01,0x68,0x01,
-	0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE5,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x64,0x00,
-	0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0x26,0x01,0x67,0x09,0xA8,0x11,0xA8,0x19,0xA8,0x19,0xE9,0x29,0xE9,0x29,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x0D,0x53,0x4C,0x6B,0x8D,0x73,0x8D,0x73,0x8D,0x73,0xEF,0x7B,0xEF,0x7B,
-	0x0E,0x84,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x70,0x94,0xB1,0x9C,0x70,0x94,0xAD,0x83,0xC2,0x10,0x20,0x08,0x60,0x20,0x60,0x20,0x20,0x08,0x62,0x49,0xC4,0x8A,0x69,0x93,0x04,0x6A,0x04,0x6A,0x69,0x52,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,
-	0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x91,0xD5,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0x0F,0xE6,0x91,0xD5,0x8E,0xDD,0x91,0xD5,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,
-	0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x0F,0xE6,0x90,0x84,0xEF,0x7B,0xAF,0x63,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0xAF,0x63,0xAF,0x63,0x4E,0x53,0x4E,0x53,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0x4B,0x22,0x4B,0x22,0x2A,0x1A,
-	0xCA,0x19,0xC9,0x11,0xA9,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0xE6,0x00,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x22,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA8,0x11,0xC9,0x11,0xA8,0x19,0xA8,0x19,0xA8,0x19,0xE9,0x29,0xE9,0x29,0xAC,0x3A,0xED,0x4A,0x24,0x21,0x60,0x20,0x60,0x20,0xA1,0x30,0x04,0x6A,0xC4,0x8A,
-	0xC7,0x7A,0xA1,0x30,0x04,0x6A,0x04,0x6A,0xC7,0x7A,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0xCA,0xA3,0x2B,0xB4,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,
-	0x0F,0xE6,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0x90,0xF6,0xEE,0xFE,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0x91,0xD5,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,
-	0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xB1,0x9C,0xB1,0x9C,0x90,0x84,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0x6E,0x63,0x4E,0x53,0x0D,0x53,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0x4B,0x22,0x2A,0x1A,0xC9,0x11,0xA9,0x01,0x68,0x01,0x68,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x26,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0xA9,0x01,0x69,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,
-	0xEA,0x01,0xEA,0x01,0xA9,0x01,0x66,0x01,0x67,0x09,0x67,0x09,0xA8,0x11,0xA8,0x11,0xE9,0x29,0x2A,0x1A,0x24,0x21,0xA1,0x30,0xA1,0x30,0x04,0x6A,0x04,0x6A,0xC7,0x7A,0x04,0x6A,0xA1,0x30,0x65,0x31,0x62,0x49,0x62,0x49,0xE7,0x41,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,
-	0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x91,0xD5,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0xEE,0xFE,0x90,0xF6,0xEE,0xFE,0x90,0xF6,0x90,0xF6,
-	0x90,0xF6,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0xEE,0xFE,0xEE,0xFE,0xEE,0xFE,0x90,0xF6,0x91,0xD5,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0x4E,0x53,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0x2A,0x1A,
-	0x2A,0x1A,0xEA,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x68,0x01,0x68,0x01,
-	0x69,0x01,0xA9,0x01,0xA9,0x01,0xEA,0x01,0xEA,0x01,0xCA,0x19,0x2A,0x1A,0x4B,0x22,0x4B,0x22,0xCD,0x2A,0xCD,0x2A,0xCD,0x2A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0xB0,0x53,0xAF,0x63,0xAF,0x63,0x0D,0x53,0xCA,0x5A,0x0D,0x53,0x4C,0x6B,0x0E,0x84,0x8D,0x73,0xA1,0x30,0x04,0x6A,0x04,0x6A,0xC4,0x8A,0xA5,0xB3,0x62,0x49,0xC7,0x7A,
-	0x04,0x6A,0x62,0x49,0x62,0x49,0x62,0x49,0x62,0x49,0x04,0x6A,0xE7,0x41,0x04,0x6A,0x69,0x52,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,
-	0x2E,0xCD,0x8E,0xDD,0x91,0xD5,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0xEE,0xFE,0x50,0xFF,0xD3,0xFF,0x50,0xFF,0xB2,0xF6,0x93,0xBD,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xF1,0xA4,0xD2,0x9C,0xD2,0x9C,0xB1,0x9C,0xB1,0x9C,
-	0x90,0x84,0x90,0x84,0x50,0x8C,0x90,0x84,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0xAF,0x63,0xAF,0x63,0x4E,0x53,0x4E,0x53,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0x4B,0x22,0x4B,0x22,0x2A,0x1A,0x2A,0x1A,0xCA,0x19,0xC9,0x11,0xA9,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x67,0x01,0x27,0x01,0x27,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,
-	0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0xA9,0x01,0xA9,0x01,0xEA,0x01,0xCA,0x19,0x2A,0x1A,0x4B,0x22,0x4B,0x22,
-	0xCD,0x2A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x49,0x3A,0xA1,0x30,0xC4,0x8A,0xC4,0x8A,0x04,0x6A,0xC4,0x8A,0xE5,0xE4,0x04,0x6A,0xC7,0x7A,0x0E,0x84,0xCA,0x5A,0x69,0x52,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0x04,0x6A,0xC7,0x7A,0x04,0x6A,0x04,0x6A,0x69,0x52,0x04,0x6A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,
-	0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0x69,0x93,0xCA,0xA3,0xCA,0xA3,0xCA,0xA3,0x2B,0xB4,0x6F,0xA4,0xAC,0xC4,0x2E,0xCD,0x91,0xD5,0x91,0xD5,0x0F,0xE6,0x0F,0xE6,0xD1,0xED,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x90,0xF6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0xEE,0xFE,0xD3,0xFF,
-	0xD3,0xFF,0x50,0xFF,0x2E,0xCD,0x2D,0xAD,0xB1,0x9C,0xD2,0x9C,0xF1,0xA4,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0x90,0x84,0x50,0x8C,0x90,0x84,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xCD,0x2A,0x4B,0x22,0x4B,0x22,
-	0xCA,0x19,0xEA,0x01,0xA9,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,
-	0x28,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x69,0x01,0x69,0x01,0xA9,0x01,0xA9,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0x2A,0x1A,0x4B,0x22,0xCD,0x2A,0xCD,0x2A,0xE9,0x29,0x62,0x49,0xC4,0x8A,0x04,0x6A,0x62,0x49,0xC4,0x8A,0xA5,0xB3,0xA5,0xB3,0xA5,0xB3,0x04,0x6A,
-	0xAF,0x63,0x0E,0x84,0x8D,0x73,0x2B,0x6B,0x69,0x52,0x69,0x52,0xC7,0x7A,0xC7,0x7A,0xC7,0x7A,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0x69,0x93,0xED,0x93,0xCA,0xA3,0xCA,0xA3,0xED,0x93,0xCA,0xA3,0x6F,0xA4,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x91,0xD5,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x0F,0xE6,0x90,0xF6,
-	0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x90,0xF6,0x53,0xFF,0x53,0xFF,0xD3,0xFF,0x50,0xFF,0x0F,0xE6,0x2D,0xAD,0xAD,0x83,0xAD,0x83,0x0E,0x84,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0x8D,0x73,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0x4E,0x53,0x4E,0x53,0x30,0x43,
-	0xED,0x4A,0xCD,0x2A,0x4B,0x22,0x4B,0x22,0xCD,0x11,0xEA,0x01,0xEA,0x01,0x69,0x01,0x69,0x01,0x69,0x01,0x69,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x28,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,
-	0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,
-	0x27,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x67,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x27,0x01,0x68,0x01,0x28,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0x69,0x01,0x68,0x01,0x69,0x01,
-	0x69,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xA1,0x30,0xC7,0x7A,0xC4,0x8A,0xC4,0x8A,0x04,0x6A,0x04,0x6A,0xA5,0xB3,0xA5,0xB3,0xA5,0xB3,0xA5,0xB3,0xE7,0x41,0x0D,0x53,0x49,0x3A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x0D,0x53,0xED,0x4A,0x49,0x3A,0x69,0x52,0x69,0x52,0x69,0x52,0x2B,0x6B,0x69,0x93,0x2B,0xB4,0xAC,0xC4,0x2E,0xCD,
-	0x2E,0xCD,0x8E,0xDD,0x91,0xD5,0x8E,0xDD,0x91,0xD5,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x0F,0xE6,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x0F,0xE6,0xD1,0xED,0x90,0xF6,0xB2,0xF6,0x53,0xFF,0x53,0xFF,0x53,0xFF,0x90,0xF6,0x0F,0xE6,0x2D,0xAD,0x2B,0xB4,0xAD,0x83,0x8D,0x73,0x4C,0x6B,0xEF,0x7B,
-	0x8D,0x73,0x4C,0x6B,0x0D,0x53,0xED,0x4A,0x49,0x3A,0x49,0x3A,0x4B,0x2A,0xE9,0x29,0xE9,0x29,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0x69,0x01,0xEA,0x01,0xA9,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,
-	0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xA9,0x01,0x69,0x01,0x69,0x01,0x69,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x69,0x01,0x69,0x01,0xA9,0x01,0x69,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0x69,0x01,0xA9,0x01,0xE5,0x00,0x62,0x49,0x04,0x6A,0xC7,0x7A,0x04,0x6A,0x62,0x49,0xC4,0x8A,0xA5,0xB3,0xA5,0xB3,0xA5,0xB3,0xC4,0x8A,0xE7,0x41,
-	0x0D,0x53,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0x2B,0x6B,0x4C,0x6B,0x8D,0x73,0x0E,0x84,0x50,0x8C,0x50,0x8C,0x4F,0x9C,0xAD,0x83,0x8D,0x73,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0xED,0x93,0xED,0x93,0x2B,0xB4,0xAC,0xC4,0xAC,0xC4,0x2E,0xCD,0x2E,0xCD,0x2E,0xCD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x8E,0xDD,0x2E,0xCD,0x2E,0xCD,
-	0x2E,0xCD,0x2E,0xCD,0xAC,0xC4,0x2D,0xAD,0x2B,0xB4,0xED,0x93,0xED,0x93,0xAD,0x83,0xAD,0x83,0x0E,0x84,0x50,0x8C,0x50,0x8C,0x0E,0x84,0x8D,0x73,0x8D,0x73,0x4C,0x6B,0x4C,0x6B,0x0D,0x53,0x0D,0x53,0xCA,0x5A,0x0D,0x53,0x0D,0x53,0x0D,0x53,0x0D,0x53,0x0D,0x53,0xED,0x4A,0xCA,0x5A,0xED,0x4A,0x4E,0x53,0xAF,0x63,0x50,0x64,0xEF,0x7B,
-	0x50,0x64,0xAF,0x63,0xAF,0x63,0xAF,0x63,0x4E,0x53,0x4E,0x53,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xCD,0x2A,0xCD,0x2A,0x4B,0x22,0x4B,0x22,0x4B,0x22,0xEA,0x01,0xEA,0x01,0xEA,0x01,0xA9,0x01,0x69,0x01,0x69,0x01,0x68,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,
-	0x61,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0x68,0x01,0xA9,0x01,0x69,0x01,
-	0xA9,0x01,0x68,0x01,0x27,0x01,0x26,0x01,0x62,0x49,0xC4,0x8A,0x04,0x6A,0x04,0x6A,0x04,0x6A,0x04,0x6A,0xC4,0x8A,0xA5,0xB3,0xA5,0xB3,0xA5,0xB3,0xC7,0x7A,0x4C,0x6B,0x0E,0x84,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0xF0,0xAC,0xF1,0xAC,0x52,0xBD,0x52,0xBD,0x52,0xBD,
-	0x52,0xBD,0x52,0xBD,0xF1,0xAC,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x50,0x8C,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0xA4,0xF1,0xA4,0xB1,0xA4,0x70,0x94,0x70,0x94,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0xAD,0x83,
-	0x0E,0x84,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x0E,0x84,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0x8D,0x73,0x8D,0x73,0x4C,0x6B,0x2B,0x6B,0x0D,0x53,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0xB0,0x53,0x4E,0x53,0x30,0x43,0xAC,0x3A,0x4B,0x22,0x2A,0x1A,0xC9,0x11,0xA9,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0x69,0x01,0x68,0x01,0x68,0x01,
-	0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,
-	0x26,0x01,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0xA9,0x01,0x69,0x01,0x68,0x01,0x27,0x01,0x68,0x01,0xE4,0x08,0x04,0x6A,0xC4,0x8A,0x04,0x6A,0x04,0x6A,0x62,0x49,0xC4,0x8A,0xA5,0xB3,0xC4,0x8A,0xA5,0xB3,0xE5,0xE4,0xC7,0x7A,0x4F,0x9C,
-	0x0E,0x84,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x70,0x94,0x70,0x94,0xB0,0xA4,0x6F,0xA4,0x70,0x94,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xF1,0xA4,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xB1,0xA4,0xB1,0xA4,0xF1,0xA4,0xB1,0xA4,0xB1,0x9C,0xB0,0xA4,
-	0xB0,0xA4,0x70,0x94,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x0E,0x84,0x4F,0x9C,0x0E,0x84,0x4F,0x9C,0x0E,0x84,0x4F,0x9C,0x50,0x8C,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0xAD,0x83,0xAD,0x83,0x8D,0x73,0x8D,0x73,0x4C,0x6B,0x0D,0x53,0xEF,0x7B,
-	0xEF,0x7B,0xEF,0x7B,0x4E,0x53,0xED,0x4A,0x49,0x3A,0xE9,0x29,0xE9,0x29,0xA8,0x19,0xA8,0x11,0x67,0x09,0x67,0x01,0xA9,0x01,0xA9,0x01,0x69,0x01,0x69,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,0x28,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,
-	0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x69,0x01,0x69,0x01,0xA9,0x01,0x69,0x01,0xA9,0x01,0x68,0x01,
-	0x66,0x01,0x67,0x09,0xA8,0x11,0xE9,0x29,0x04,0x6A,0x04,0x6A,0xC4,0x8A,0x04,0x6A,0x04,0x6A,0xA5,0xB3,0xA5,0xB3,0xA5,0xB3,0xA5,0xB3,0xA5,0xB3,0xCA,0x5A,0x70,0x94,0xAD,0x83,0xED,0x93,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x70,0x94,0x6F,0xA4,0x6F,0xA4,0x70,0x94,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0xB0,0xA4,
-	0x70,0x94,0x6F,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0x70,0x94,0x6F,0xA4,0x70,0x94,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x50,0x8C,0x4F,0x9C,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,
-	0x0E,0x84,0xAD,0x83,0x0E,0x84,0xAD,0x83,0xAD,0x83,0x8D,0x73,0x8D,0x73,0x4C,0x6B,0x4C,0x6B,0x0D,0x53,0xCA,0x5A,0xED,0x4A,0xCA,0x5A,0xAC,0x3A,0x49,0x3A,0x4B,0x2A,0x4B,0x2A,0x2A,0x1A,0xA8,0x19,0xA8,0x11,0xA8,0x11,0x67,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x28,0x01,
-	0x28,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,
-	0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x26,0x09,0x67,0x09,0xA8,0x11,0xC9,0x11,0xA8,0x19,0xC4,0x8A,0x04,0x6A,0x04,0x6A,0x04,0x6A,0xA5,0xB3,0xC4,0x8A,0xA5,0xB3,0xC4,0x8A,0x04,0x6A,0xC7,0x7A,0x69,0x52,0x8D,0x73,
-	0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x8D,0x73,0x8D,0x73,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0xB0,0xA4,0x6F,0xA4,0x70,0x94,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0xB0,0xA4,0x70,0x94,0x70,0x94,0x70,0x94,0x4F,0x9C,0x4F,0x9C,0x50,0x8C,0x4F,0x9C,
-	0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x6C,0x7B,0x8D,0x73,0x8D,0x73,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0xCA,0x5A,0x0D,0x53,0xCA,0x5A,0xED,0x4A,0x69,0x52,0x49,0x3A,0xAC,0x3A,0x49,0x3A,0xAC,0x3A,0x49,0x3A,0xE9,0x29,0x4B,0x2A,0xE9,0x29,0xE9,0x29,
-	0xA8,0x19,0xA8,0x19,0xA8,0x11,0xA8,0x11,0x67,0x09,0x67,0x09,0x67,0x01,0x67,0x01,0x66,0x01,0x66,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0x26,0x01,0x68,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0x67,0x09,0x67,0x09,0x67,0x09,0x67,0x09,
-	0x67,0x09,0x47,0x11,0xC9,0x11,0x65,0x31,0x04,0x6A,0x04,0x6A,0x04,0x6A,0xC4,0x8A,0xC4,0x8A,0xC4,0x8A,0xA5,0xB3,0xA5,0xB3,0xC4,0x8A,0x04,0x6A,0x49,0x3A,0xED,0x4A,0x49,0x3A,0xED,0x4A,0xCA,0x5A,0x4C,0x6B,0x4C,0x6B,0x8D,0x73,0x8D,0x73,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0x70,0x94,0x6F,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,
-	0xB0,0xA4,0xB0,0xA4,0xF0,0xAC,0xB0,0xA4,0xB0,0xA4,0xF0,0xAC,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0x70,0x94,0x4F,0x9C,0x4F,0x9C,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0xAD,0x83,0x8D,0x73,0xAD,0x83,0xAD,0x83,0xAD,0x83,0x8D,0x73,0x8D,0x73,0xAD,0x83,0x0E,0x84,0xAD,0x83,
-	0xEF,0x7B,0x0E,0x84,0x50,0x8C,0x0E,0x84,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x90,0x84,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xAF,0x63,0xCA,0x5A,0xED,0x4A,0x49,0x3A,0x49,0x3A,0x49,0x3A,0xE9,0x29,0xE9,0x29,0xA8,0x19,0xA8,0x19,0xA8,0x11,0x67,0x09,0x66,0x09,0x26,0x01,0x26,0x01,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0x26,0x01,
-	0x27,0x01,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,
-	0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,
-	0xE5,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x27,0x01,0x67,0x01,0x67,0x09,0x68,0x09,0x67,0x09,0xA8,0x11,0xA8,0x11,0xA8,0x11,0xC9,0x11,0xC9,0x11,0xA8,0x19,0x2A,0x1A,0xA8,0x19,0x04,0x6A,0x04,0x6A,0xC4,0x8A,0xC4,0x8A,0xC4,0x8A,0xC4,0x8A,0xC4,0x8A,0xA5,0xB3,0xA5,0xB3,0x62,0x49,0xCA,0x5A,0x0D,0x53,
-	0x2B,0x6B,0x0D,0x53,0x4C,0x6B,0x4C,0x6B,0x8D,0x73,0xAD,0x83,0xAD,0x83,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x70,0x94,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xF0,0xAC,0xB0,0xA4,0xF0,0xAC,0xF0,0xAC,0xF0,0xAC,0xF1,0xAC,0xF0,0xAC,0xF1,0xAC,0xF0,0xAC,0xF0,0xAC,0xF0,0xAC,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,
-	0xB0,0xA4,0xB0,0xA4,0x70,0x94,0x6F,0xA4,0x4F,0x9C,0x70,0x94,0x4F,0x9C,0xF2,0xA4,0x93,0xBD,0x93,0xBD,0x33,0xB5,0xF2,0xA4,0xF1,0xA4,0xD2,0x9C,0xD2,0x9C,0x70,0x94,0x90,0x84,0x50,0x8C,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0x4E,0x53,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xCD,0x2A,0xAC,0x3A,0x4B,0x2A,0xA8,0x11,0xA8,0x19,0xC9,0x11,0xA8,0x11,
-	0x67,0x09,0x67,0x09,0x67,0x09,0x67,0x09,0x67,0x09,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,
-	0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,
-	0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0xA4,0x00,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xE5,0x00,0x25,0x01,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x67,0x09,0x47,0x11,0xA8,0x11,0xA8,0x19,0xA8,0x19,0xE9,0x29,
-	0xE9,0x29,0x4B,0x2A,0x4B,0x2A,0x49,0x3A,0xC4,0x8A,0x04,0x6A,0xC4,0x8A,0x04,0x6A,0xC4,0x8A,0xC4,0x8A,0xC4,0x8A,0xC4,0x8A,0xC7,0x7A,0x69,0x52,0x4C,0x6B,0x2B,0x6B,0x2B,0x6B,0x2B,0x6B,0x2B,0x6B,0x4C,0x6B,0x6C,0x7B,0x6C,0x7B,0x8D,0x73,0xAD,0x83,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,
-	0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xF0,0xAC,0xB0,0xA4,0xB0,0xA4,0xF0,0xAC,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0xB0,0xA4,0x4F,0x9C,0x70,0x94,0xB0,0xA4,0x33,0xB5,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,
-	0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0x4C,0x6B,0x8D,0x73,0x70,0x94,0x50,0x8C,0x8D,0x73,0x4C,0x6B,0x4C,0x6B,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0xED,0x4A,0xCA,0x5A,0x0D,0x53,0x0D,0x53,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,
-	0x4B,0x2A,0x2A,0x1A,0x2A,0x1A,0xC9,0x11,0xA9,0x01,0x68,0x01,0x68,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA4,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0x25,0x01,0xE5,0x00,0x25,0x01,0x25,0x01,0x26,0x09,0x26,0x09,0x66,0x09,0x47,0x11,0x47,0x11,0xA8,0x19,0xA8,0x19,0xE9,0x29,0xE9,0x29,0xE9,0x29,0x49,0x3A,0xCA,0x5A,0x04,0x6A,0x62,0x49,0x62,0x49,0x04,0x6A,0x04,0x6A,0xC7,0x7A,0x2B,0x6B,0xED,0x93,0x70,0x94,0xB0,0xA4,0xAD,0x83,0x6C,0x7B,
-	0x6C,0x7B,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xED,0x93,0x0E,0x84,0xED,0x93,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,
-	0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0xB0,0xA4,0x6F,0xA4,0xB0,0xA4,0xB1,0xA4,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0xF1,0xAC,0x0E,0x84,0xB1,0xA4,0x33,0xB5,
-	0x33,0xB5,0xF1,0xA4,0x70,0x94,0xEF,0x7B,0x8D,0x73,0x6E,0x63,0xCA,0x5A,0xED,0x4A,0x0D,0x53,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0x4B,0x2A,0x4B,0x2A,0x2A,0x1A,0x2A,0x1A,0xA9,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE6,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x2A,0x1A,
-	0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0xCA,0x5A,0x4C,0x6B,0x4C,0x6B,0x8D,0x73,0xEF,0x7B,0x0E,0x84,0x50,0x8C,0x70,0x94,0x70,0x94,0xB1,0xA4,0x0E,0x84,0xAD,0x83,0x6C,0x7B,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xED,0x93,0xED,0x93,0xED,0x93,0xED,0x93,0x4F,0x9C,0xED,0x93,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,
-	0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xA4,0xB0,0xAC,0xB0,0xA4,0xB0,0xAC,0x31,0xB5,0x93,0xBD,0xD4,0xCD,0x52,0xBD,0x52,0xBD,0x34,0xDE,0x97,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x77,0xD6,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0xEF,0x7B,0x4C,0x6B,0x6E,0x63,0x6E,0x63,0x4E,0x53,0x0D,0x53,0xED,0x4A,0xAC,0x3A,0x4B,0x2A,0x4B,0x2A,0xE9,0x29,0x4B,0x22,0x2A,0x1A,0xC9,0x11,0xC9,0x11,0xA9,0x01,0x68,0x01,0x68,0x01,0x67,0x01,
-	0x68,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,
-	0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,
-	0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0xAF,0x63,0x8D,0x73,0xEF,0x7B,0x0E,0x84,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0xA4,
-	0x4F,0x9C,0x6C,0x7B,0x6C,0x7B,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xED,0x93,0xED,0x93,0xED,0x93,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0xB0,0xA4,0x6F,0xA4,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,
-	0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xA4,0xD4,0xCD,0x34,0xDE,0x34,0xDE,0x34,0xDE,0xD4,0xCD,0x34,0xDE,0xD4,0xCD,0x36,0xC6,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xF1,0xA4,0xD2,0x9C,0xB1,0x9C,0xB1,0x9C,0x70,0x94,0x50,0x8C,
-	0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x0E,0x84,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0x6E,0x63,0x4E,0x53,0x0D,0x53,0xED,0x4A,0xAC,0x3A,0x4B,0x2A,0x4B,0x22,0x2A,0x1A,0xC9,0x11,0xA9,0x01,0xA9,0x01,0x68,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE7,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x62,0x00,
-	0x22,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,
-	0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0x6E,0x63,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x70,0x94,0x70,0x94,0x70,0x94,0x0E,0x84,0x6C,0x7B,0xAD,0x83,0xAD,0x83,0xED,0x93,0x0E,0x84,0xED,0x93,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,
-	0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xF0,0xAC,0xB0,0xAC,0xF0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xF0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xA4,0x6F,0xA4,0x6F,0xA4,0xD4,0xCD,0x34,0xDE,0x97,0xDE,0x34,0xDE,0x34,0xDE,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,
-	0x93,0xBD,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0x6E,0x63,0x4E,0x53,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0x2A,0x1A,0xCA,0x19,0xA9,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,
-	0x26,0x01,0xE7,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x09,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0x6E,0x63,0xEF,0x7B,0x0E,0x84,0x70,0x94,0xB1,0xA4,0xF1,0xA4,
-	0xF1,0xAC,0x4F,0x9C,0xAD,0x83,0xED,0x93,0xED,0x93,0xED,0x93,0xED,0x93,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0xB0,0xAC,0xB0,0xAC,0x6F,0xA4,0xB0,0xAC,0xB0,0xAC,0x6F,0xA4,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,
-	0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0xED,0x93,0x0E,0x84,0x0E,0x84,0xF1,0xAC,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0x4E,0x53,0x4E,0x53,0x4E,0x53,0xAC,0x3A,0xCD,0x2A,0x4B,0x22,0x2A,0x1A,0xEA,0x01,0xA9,0x01,0x69,0x01,0x68,0x01,0x67,0x01,0x27,0x01,
-	0x27,0x01,0x27,0x01,0x26,0x01,0xE6,0x00,0x27,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,
-	0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xE5,0x00,
-	0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE4,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE5,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0x26,0x01,0x26,0x01,0x26,0x01,0x27,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,
-	0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0x50,0x8C,0x70,0x94,0xB1,0xA4,0xF1,0xAC,0x33,0xB5,0x52,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD1,0xB4,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,
-	0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0xB1,0x9C,0xB1,0xA4,0xB1,0xA4,0xF1,0xAC,0x52,0xBD,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0x50,0x8C,0xEF,0x7B,0xAF,0x63,0xAF,0x63,
-	0x4E,0x53,0xED,0x4A,0xCD,0x2A,0xAC,0x3A,0x4B,0x22,0x4B,0x22,0x2A,0x1A,0xCA,0x19,0xCA,0x19,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0xAC,0x3A,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0x2A,0x1A,0x2A,0x1A,0xC9,0x11,0xA8,0x11,0x68,0x01,0x67,0x01,
-	0x26,0x01,0x26,0x01,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,
-	0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0x26,0x01,0x66,0x01,0x67,0x09,0xA8,0x11,0xE9,0x29,
-	0xE9,0x29,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x4C,0x6B,0x6E,0x63,0x8D,0x73,0x0E,0x84,0x50,0x8C,0x4F,0x9C,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xF1,0xAC,0xF1,0xA4,0xF1,0xAC,0x33,0xB5,0x31,0xB5,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x52,0xBD,0x33,0xB5,0x52,0xBD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x34,0xDE,
-	0x34,0xDE,0xD4,0xCD,0x52,0xBD,0xB0,0xAC,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0xB0,0xA4,0xF0,0xAC,0x52,0xBD,0x52,0xBD,0x31,0xB5,0xD1,0xB4,0xB0,0xAC,0xB0,0xA4,0x6F,0xA4,
-	0x4F,0x9C,0xF0,0xAC,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xB1,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xAF,0x63,0x6E,0x63,0x0D,0x53,
-	0x0D,0x53,0xED,0x4A,0xAC,0x3A,0x4B,0x2A,0xE9,0x29,0x2A,0x1A,0xC9,0x11,0x68,0x09,0x67,0x01,0x26,0x01,0xE5,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0x27,0x01,0x67,0x01,0x68,0x01,0xA8,0x11,0xC9,0x11,0xE9,0x29,0x4B,0x2A,0xAC,0x3A,0x49,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x4C,0x6B,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x0E,0x84,0x0E,0x84,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xF1,0xA4,0xB1,0x9C,0xF1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xF1,0xA4,
-	0xF1,0xA4,0xF1,0xA4,0xF1,0xAC,0xF1,0xAC,0xF2,0xA4,0xF1,0xAC,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x91,0xD5,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x34,0xDE,0x34,0xDE,0x52,0xBD,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0xB0,0xA4,0x6F,0xA4,
-	0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0xB0,0xAC,0xF0,0xAC,0x52,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x52,0xBD,0x31,0xB5,0xB0,0xAC,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0xF1,0xAC,0x33,0xB5,0x52,0xBD,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,
-	0xD2,0x9C,0xB1,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0x8D,0x73,0x6E,0x63,0x6E,0x63,0x0D,0x53,0x0D,0x53,0xAC,0x3A,0xAC,0x3A,0x49,0x3A,0x4B,0x2A,0xE9,0x29,0xA8,0x19,0xA8,0x11,0x67,0x09,0x26,0x01,0x26,0x01,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE4,0x00,
-	0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x09,0xA8,0x11,0xC9,0x11,0xE9,0x29,0x2A,0x1A,
-	0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x4C,0x6B,0x6E,0x63,0x8D,0x73,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0xA4,0xB1,0xA4,0xF1,0xA4,0xF1,0xAC,0xF2,0xA4,0xF1,0xAC,0xF1,0xAC,0x33,0xB5,0x52,0xBD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x34,0xDE,
-	0x34,0xDE,0x34,0xDE,0x34,0xDE,0xD4,0xCD,0xD1,0xB4,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0xB0,0xA4,0xB0,0xAC,0x31,0xB5,0x52,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x52,0xBD,0x93,0xBD,0x33,0xB5,
-	0xF2,0xA4,0x4F,0x9C,0x4F,0x9C,0x70,0x94,0xF1,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xB1,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0x8D,0x73,0x6E,0x63,0x6E,0x63,0x0D,0x53,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0x4B,0x2A,0x2A,0x1A,0xE9,0x29,0xA8,0x19,0xA8,0x11,0x67,0x01,0x27,0x01,
-	0x27,0x01,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,
-	0x63,0x00,0x62,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xEA,0x01,0xC9,0x11,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x6E,0x63,0x8D,0x73,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,
-	0xB1,0xA4,0xF1,0xA4,0xD2,0x9C,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF2,0xA4,0xF1,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x93,0xBD,0x52,0xBD,0x31,0xB5,0xED,0x93,0xED,0x93,0x0E,0x84,0xED,0x93,0xAD,0x83,0x0E,0x84,0xAD,0x83,0xED,0x93,0xAD,0x83,0x0E,0x84,0x0E,0x84,
-	0x0E,0x84,0x50,0x8C,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0xAF,0x63,0x4E,0x53,0x6E,0x63,0x4E,0x53,0x6E,0x63,0xAF,0x63,0xAF,0x63,0xAF,0x63,0x8D,0x73,0xAF,0x63,0xEF,0x7B,0x8D,0x73,0xAF,0x63,0x6E,0x63,0x6E,0x63,0x6E,0x63,
-	0x6E,0x63,0x0D,0x53,0x0D,0x53,0x0D,0x53,0xED,0x4A,0xAC,0x3A,0x4B,0x2A,0x4B,0x2A,0xC9,0x11,0xC9,0x11,0xA8,0x11,0x68,0x09,0x68,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,
-	0x63,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,
-	0xA5,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,
-	0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0x4E,0x53,0x6E,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xD2,0x9C,0xF1,0xA4,0xF1,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,
-	0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF1,0xA4,0x50,0x8C,0xAD,0x83,0x8D,0x73,0xAD,0x83,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xF1,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0x90,0x84,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xCD,0x2A,0xCD,0x2A,0xCD,0x2A,
-	0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x6E,0x63,0xAF,0x63,0xAF,0x63,0x6E,0x63,0xAF,0x63,0x8D,0x73,0xAF,0x63,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0x6E,0x63,0x4E,0x53,0x4E,0x53,0x0D,0x53,0x0D,0x53,0xED,0x4A,0xAC,0x3A,0x4B,0x2A,0x4B,0x2A,0xC9,0x11,0xC9,0x11,0xA9,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,
-	0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x27,0x01,0x67,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,
-	0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0xA9,0x01,0xA9,0x01,
-	0xEA,0x01,0x2A,0x1A,0x4B,0x22,0x4B,0x22,0x4B,0x22,0xCD,0x2A,0xCD,0x2A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0x90,0x84,0x50,0x8C,0x50,0x8C,0x0E,0x84,0x0E,0x84,0xEF,0x7B,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x70,0x94,0xB1,0x9C,0xF1,0xA4,0xF1,0xAC,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,
-	0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF1,0xAC,0xF2,0xA4,0xF2,0xA4,0xB1,0xA4,0xF1,0xA4,0xB1,0x9C,
-	0xB1,0x9C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0x6E,0x63,0x4E,0x53,0xED,0x4A,0xAC,0x3A,0x4B,0x22,0x4B,0x22,0xCA,0x19,0xEA,0x01,0xEA,0x01,0xA9,0x01,0xA9,0x01,0x69,0x01,0x69,0x01,0x69,0x01,0x68,0x01,0x69,0x01,0x69,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x27,0x01,0x28,0x01,
-	0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x22,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0xCA,0x19,
-	0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x22,0x4B,0x22,0x4B,0x2A,0xCD,0x2A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0x30,0x43,0x4E,0x53,0x4E,0x53,0x4E,0x53,0xB0,0x53,0xAF,0x63,0xAF,0x63,0x50,0x64,0xEF,0x7B,0xEF,0x7B,0x90,0x84,0x90,0x84,0x50,0x8C,0x50,0x8C,0x0E,0x84,
-	0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x0E,0x84,0x0E,0x84,0x50,0x8C,0xB1,0x9C,0xB1,0x9C,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x52,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x52,0xBD,0x93,0xBD,0x52,0xBD,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xB1,0xA4,0xB1,0x9C,0x50,0x8C,0xEF,0x7B,0xAF,0x63,0x4E,0x53,0xED,0x4A,0xCD,0x2A,0x4B,0x22,0x2A,0x1A,0xEA,0x01,0xA9,0x01,0x69,0x01,
-	0xA9,0x01,0xA9,0x01,0xA9,0x01,0x69,0x01,0x68,0x01,0x69,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x63,0x00,0x62,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE7,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,
-	0x90,0x84,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xD2,0x9C,0xF1,0xA4,0xD2,0x9C,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xD2,0x9C,0x70,0x94,0x50,0x8C,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x4F,0x9C,0xB1,0x9C,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x36,0xC6,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xB1,0xA4,
-	0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0x70,0x94,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,0x4E,0x53,0xED,0x4A,0xAC,0x3A,0x4B,0x22,0x4B,0x22,0x2A,0x1A,0xEA,0x01,0xEA,0x01,0x69,0x01,0xA9,0x01,0x69,0x01,0xA9,0x01,0x69,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x27,0x01,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xCA,0x19,0x2A,0x1A,0x4B,0x22,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0x90,0x84,0x50,0x8C,0xB1,0x9C,0xF1,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0xF1,0xAC,0xF1,0xAC,
-	0xF1,0xAC,0x33,0xB5,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x36,0xC6,0xD4,0xCD,0xD4,0xCD,0x36,0xC6,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xD2,0x9C,0x70,0x94,0x90,0x84,0x50,0x8C,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0x6E,0x63,0x4E,0x53,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0x4C,0x3A,0x4B,0x2A,0x4B,0x22,0x2A,0x1A,0x2A,0x1A,0xCA,0x19,
-	0xEA,0x01,0xEA,0x01,0xA9,0x01,0xA9,0x01,0x69,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x28,0x01,0x68,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0xE6,0x00,0x27,0x01,0xE7,0x00,0x26,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x2A,0x1A,0x4B,0x22,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,
-	0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xD2,0x9C,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x93,0xBD,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,
-	0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0x90,0x84,0xEF,0x7B,0xAF,0x63,0x4E,0x53,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0xCD,0x2A,
-	0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0x4B,0x22,0x4B,0x22,0x2A,0x1A,0x2A,0x1A,0xC9,0x11,0xCA,0x19,0xC9,0x11,0xEA,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0x69,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x67,0x01,0x28,0x01,0x67,0x01,0x27,0x01,0x27,0x01,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,
-	0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xCA,0x19,0x2A,0x1A,0x4B,0x22,0x4B,0x22,0x4C,0x3A,0xCD,0x2A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0x90,0x84,0x50,0x8C,0x90,0x84,0xB1,0x9C,
-	0xB1,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,
-	0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xD2,0x9C,0xD2,0x9C,0x90,0x84,0x90,0x84,0xEF,0x7B,0xAF,0x63,0xAF,0x63,0x4E,0x53,0x4E,0x53,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0xAC,0x3A,0x4C,0x3A,0x4C,0x3A,0x4B,0x2A,0x4B,0x2A,0x4B,0x22,0x4B,0x22,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,
-	0xCA,0x19,0xC9,0x11,0xC9,0x11,0xC9,0x11,0xA9,0x01,0xA9,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xEA,0x01,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0xAC,0x3A,
-	0xAC,0x3A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0x90,0x84,0x90,0x84,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xD2,0x9C,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x93,0xBD,
-	0x93,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x36,0xC6,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xAF,0x63,
-	0xEF,0x7B,0x8D,0x73,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x8D,0x73,0x6E,0x63,0x4E,0x53,0xED,0x4A,0xED,0x4A,0x4C,0x3A,0x4B,0x2A,0x4B,0x22,0x2A,0x1A,0x2A,0x1A,0xCA,0x19,0xC9,0x11,0xC9,0x11,0xA9,0x01,0xA9,0x01,0xA9,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x67,0x01,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x26,0x01,0x27,0x01,
-	0x26,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xEA,0x01,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0xCD,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0x4E,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x90,0x84,
-	0x50,0x8C,0xB1,0x9C,0x90,0x84,0xB1,0x9C,0xB1,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xD2,0x9C,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x36,0xC6,0xD4,0xCD,0x36,0xC6,0xD4,0xCD,0x36,0xC6,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,
-	0x93,0xBD,0x93,0xBD,0x33,0xB5,0xF2,0xA4,0xF2,0xA4,0xD2,0x9C,0xB1,0x9C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x70,0x94,0x70,0x94,0x70,0x94,0x70,0x94,0x70,0x94,0x70,0x94,0x70,0x94,0x50,0x8C,0xEF,0x7B,0x8D,0x73,0x6E,0x63,0x4E,0x53,0x0D,0x53,0xED,0x4A,0xAC,0x3A,0xAC,0x3A,0x4B,0x2A,0x4B,0x22,
-	0x2A,0x1A,0x2A,0x1A,0xCA,0x19,0xEA,0x01,0xA9,0x01,0xA9,0x01,0x69,0x01,0x69,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x67,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE7,0x00,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0xE7,0x00,0x26,0x01,
-	0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0x69,0x01,0xA9,0x01,0x69,0x01,0xEA,0x01,0xEA,0x01,0xEA,0x01,0x2A,0x1A,0x4B,0x22,0x4B,0x22,0xCD,0x2A,0xCD,0x2A,0xAC,0x3A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0x90,0x84,0x90,0x84,
-	0x70,0x94,0xD2,0x9C,0xD2,0x9C,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x52,0xBD,0x33,0xB5,0x33,0xB5,0xF1,0xAC,0xF2,0xA4,0xB1,0xAC,0xF1,0xAC,0xB1,0xAC,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,
-	0xB1,0xA4,0xB1,0x9C,0x70,0x94,0x70,0x94,0x0E,0x84,0x0E,0x84,0xEF,0x7B,0xAF,0x63,0x6E,0x63,0x0D,0x53,0xED,0x4A,0xED,0x4A,0xAC,0x3A,0x4B,0x2A,0x4B,0x2A,0x4B,0x2A,0x2A,0x1A,0xC9,0x11,0xC9,0x11,0xC9,0x11,0x68,0x09,0x68,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,
-	0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,
-	0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x69,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xEA,0x01,0xCA,0x19,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x22,0x4B,0x22,0x4B,0x22,0xCD,0x2A,0xCD,0x2A,0xCD,0x2A,0xCD,0x2A,0xAC,0x3A,
-	0xAC,0x3A,0xCD,0x2A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xD2,0x9C,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x52,0xBD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x34,0xDE,0xD4,0xCD,0x34,0xDE,0xD4,0xCD,0x34,0xDE,0x34,0xDE,0xD4,0xCD,0x34,0xDE,0xD4,0xCD,0x34,0xDE,
-	0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x33,0xB5,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB0,0xA4,0x70,0x94,0x70,0x94,0x50,0x8C,0x0E,0x84,0xEF,0x7B,0x8D,0x73,0x4C,0x6B,0x4C,0x6B,0xED,0x4A,0xCA,0x5A,0xAC,0x3A,0x49,0x3A,0x49,0x3A,0xE9,0x29,0xE9,0x29,
-	0xA8,0x19,0xA8,0x19,0x47,0x11,0x47,0x11,0x26,0x09,0x26,0x09,0xE5,0x00,0xE5,0x00,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x61,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x64,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,
-	0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,
-	0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0xAF,0x63,0xAF,0x63,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xD2,0x9C,0xF1,0xAC,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x93,0xBD,0x52,0xBD,0x93,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0xD4,0xCD,0x52,0xBD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0xD4,0xCD,0x34,0xDE,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0xD1,0xB4,0xD1,0xB4,0xF1,0xAC,0xD1,0xB4,0xB0,0xAC,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,
-	0x4F,0x9C,0x4F,0x9C,0xED,0x93,0x0E,0x84,0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0x49,0x3A,0xE7,0x41,0xE7,0x41,0x67,0x29,0x67,0x29,0x67,0x29,0x47,0x11,0x24,0x21,0xE5,0x08,0xC4,0x10,0xA3,0x08,0xA2,0x08,0xA2,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA4,0x00,0xA5,0x00,0xE4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,
-	0x26,0x01,0xE7,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xC9,0x11,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,
-	0xED,0x4A,0x4E,0x53,0x6E,0x63,0x6E,0x63,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0xB1,0xA4,0xB1,0xA4,0x33,0xB5,0x52,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x34,0xDE,0x34,0xDE,0xD4,0xCD,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0x34,0xDE,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x91,0xD5,0xD4,0xCD,0x91,0xD5,0x52,0xBD,
-	0x91,0xD5,0x52,0xBD,0x52,0xBD,0xD1,0xB4,0xD1,0xB4,0xD1,0xB4,0xF1,0xAC,0xB0,0xAC,0xB0,0xAC,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0xED,0x93,0xED,0x93,0xED,0x93,0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x67,0x29,0x65,0x31,0x24,0x21,0x24,0x21,
-	0x24,0x21,0xC4,0x10,0xC2,0x10,0xA2,0x08,0x62,0x08,0x61,0x08,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,
-	0x62,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0xE7,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,
-	0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x27,0x01,0x67,0x01,0x68,0x01,0xA9,0x01,0xC9,0x11,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0x8D,0x73,0x0E,0x84,0x70,0x94,0xB1,0xA4,0xF1,0xAC,0x33,0xB5,0x52,0xBD,0x52,0xBD,0x52,0xBD,0xD4,0xCD,0xD4,0xCD,
-	0xD4,0xCD,0xD4,0xCD,0x34,0xDE,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0xD1,0xB4,0xD1,0xB4,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xA4,0xB0,0xAC,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0xED,0x93,0x4F,0x9C,0xED,0x93,
-	0xED,0x93,0xED,0x93,0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0xC7,0x7A,0xCA,0x5A,0x69,0x52,0xE7,0x41,0xE7,0x41,0xE7,0x41,0x65,0x31,0x65,0x31,0x24,0x21,0x24,0x21,0x24,0x21,0xC2,0x10,0xC2,0x10,0xA2,0x08,0x62,0x08,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,
-	0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,
-	0x27,0x01,0xE6,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0xE7,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,
-	0x27,0x01,0x27,0x01,0x68,0x09,0xC9,0x11,0xE9,0x29,0x4B,0x2A,0x4C,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x0D,0x53,0x0D,0x53,0x0D,0x53,0x4C,0x6B,0x4C,0x6B,0x4C,0x6B,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x6C,0x7B,0x2B,0x6B,0x4C,0x6B,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0x2B,0x6B,0x2B,0x6B,0x6C,0x7B,
-	0x6C,0x7B,0x6C,0x7B,0xED,0x93,0xED,0x93,0xED,0x93,0xED,0x93,0xED,0x93,0x4F,0x9C,0xED,0x93,0x6F,0xA4,0xED,0x93,0x6F,0xA4,0xED,0x93,0x6F,0xA4,0xED,0x93,0xED,0x93,0xED,0x93,0xED,0x93,0x69,0x93,0x6C,0x7B,0xC7,0x7A,0xCA,0x5A,0x69,0x52,0xE7,0x41,0xE7,0x41,0x65,0x31,0x65,0x31,0x24,0x21,0x24,0x21,0x24,0x21,0xC4,0x10,0xC2,0x10,
-	0xC2,0x10,0x62,0x08,0x62,0x08,0x61,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,
-	0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE7,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,
-	0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x67,0x09,0x68,0x09,0xA8,0x11,0xE9,0x29,0x4B,0x2A,0x49,0x3A,0xED,0x4A,0xCA,0x5A,0x2B,0x6B,0x4C,0x6B,0x8D,0x73,0xAD,0x83,0x0E,0x84,0x0E,0x84,0x0E,0x84,0x4F,0x9C,
-	0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0xAD,0x83,0xAD,0x83,0xAD,0x83,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0x6C,0x7B,0xAD,0x83,0xAD,0x83,0xAD,0x83,0xED,0x93,0xED,0x93,0xED,0x93,0xED,0x93,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0xED,0x93,0x6F,0xA4,0xED,0x93,0x6F,0xA4,0xED,0x93,0xED,0x93,0xED,0x93,
-	0xED,0x93,0xED,0x93,0x6C,0x7B,0x6C,0x7B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0xE7,0x41,0xE7,0x41,0x65,0x31,0x67,0x29,0x24,0x21,0xC4,0x10,0xC4,0x10,0xC4,0x10,0xA4,0x08,0xA3,0x08,0xA3,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,
-	0x63,0x00,0xA3,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xE4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,
-	0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x26,0x01,0x27,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,
-	0x67,0x09,0x67,0x09,0x67,0x09,0x47,0x11,0xA8,0x19,0xA8,0x19,0xE9,0x29,0x49,0x3A,0x0D,0x53,0x4C,0x6B,0x6C,0x7B,0x0E,0x84,0x0E,0x84,0xB0,0xA4,0xB1,0xA4,0x31,0xB5,0x52,0xBD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x34,0xDE,0xD4,0xCD,0xD4,0xCD,0x91,0xD5,0xD4,0xCD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0xD1,0xB4,
-	0xD1,0xB4,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0xED,0x93,0xED,0x93,0xAD,0x83,0xAD,0x83,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0x49,0x3A,0x67,0x29,0xA8,0x19,0x47,0x11,0x26,0x09,0x26,0x09,0x25,0x01,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x61,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE7,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,
-	0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x68,0x01,0x68,0x09,0x68,0x09,0x68,0x09,0xA8,0x11,0xC9,0x11,0xC9,0x11,0xE9,0x29,0x4B,0x2A,0x4B,0x2A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0x8D,0x73,0x50,0x8C,
-	0x70,0x94,0xB1,0xA4,0xF1,0xAC,0x52,0xBD,0x52,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x34,0xDE,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0xD1,0xB4,0x52,0xBD,0xD1,0xB4,0xD1,0xB4,0xD1,0xB4,0xF1,0xAC,0xF1,0xAC,
-	0xB1,0xAC,0x70,0x94,0x4F,0x9C,0x0E,0x84,0x8D,0x73,0x4C,0x6B,0x0D,0x53,0xCA,0x5A,0xED,0x4A,0x49,0x3A,0x49,0x3A,0x49,0x3A,0xE9,0x29,0xE9,0x29,0xA8,0x19,0x47,0x11,0x26,0x09,0xE5,0x08,0xE4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0x63,0x00,0xA3,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x62,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE6,0x00,0xA6,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,
-	0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE7,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0x27,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x28,0x01,
-	0x68,0x01,0x68,0x01,0x68,0x01,0x69,0x01,0xA9,0x01,0x6A,0x09,0xC9,0x11,0xCA,0x19,0xCA,0x19,0x2A,0x1A,0x4B,0x2A,0x4B,0x2A,0x4C,0x3A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0xAF,0x63,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0xB1,0x9C,0xB1,0xA4,0xB1,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,
-	0xF1,0xAC,0x33,0xB5,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF2,0xA4,0xF1,0xAC,0xF2,0xA4,0xF1,0xAC,0xF2,0xA4,0xF2,0xA4,0xF1,0xA4,0xF1,0xAC,0xF1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB0,0xA4,0xB1,0xA4,0xB0,0xA4,0xB1,0xA4,0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,0x70,0x94,0x70,0x94,0x4F,0x9C,0x0E,0x84,0x0E,0x84,0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,
-	0xCA,0x5A,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0x67,0x29,0x24,0x21,0xC4,0x10,0xE3,0x08,0xA2,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0x63,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,
-	0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE7,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0x27,0x01,0xE6,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0x6A,0x09,0xC9,0x11,0xCA,0x19,0x2A,0x1A,0x2A,0x1A,0x4B,0x2A,0x4C,0x3A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,
-	0x0D,0x53,0xAF,0x63,0xEF,0x7B,0x50,0x8C,0xB1,0x9C,0xD2,0x9C,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x33,0xB5,0x52,0xBD,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x33,0xB5,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF2,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,
-	0xB0,0xA4,0xB1,0x9C,0x70,0x94,0x4F,0x9C,0x4F,0x9C,0x0E,0x84,0xAD,0x83,0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0xCA,0x5A,0xCA,0x5A,0x69,0x52,0x49,0x3A,0xE7,0x41,0x67,0x29,0x67,0x29,0x24,0x21,0xE5,0x08,0xA3,0x08,0xA3,0x00,0xA2,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x22,0x00,0x62,0x00,0x21,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0x64,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE6,0x00,0xE5,0x00,0xA6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,
-	0xE7,0x00,0xE6,0x00,0x26,0x01,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,
-	0x27,0x01,0x28,0x01,0x27,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x4B,0x2A,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0x0D,0x53,0x6E,0x63,0xEF,0x7B,0x50,0x8C,0x70,0x94,0xD2,0x9C,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x93,0xBD,0x52,0xBD,0x33,0xB5,0x52,0xBD,0x33,0xB5,0x52,0xBD,0x33,0xB5,
-	0x33,0xB5,0x33,0xB5,0xF1,0xAC,0xF1,0xAC,0xF2,0xA4,0xF1,0xAC,0xB1,0xA4,0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0xB0,0xA4,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x0E,0x84,0x0E,0x84,0xAD,0x83,0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,
-	0x69,0x52,0xE7,0x41,0xE7,0x41,0x65,0x31,0x24,0x21,0x24,0x21,0xC2,0x10,0xA2,0x08,0x62,0x08,0x61,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA6,0x00,0xE5,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE7,0x00,0x26,0x01,0xE7,0x00,0xE7,0x00,0x27,0x01,0xE7,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE7,0x00,0xE7,0x00,
-	0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x69,0x01,0xA9,0x01,0xCA,0x19,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x6E,0x63,0xEF,0x7B,0x50,0x8C,0x70,0x94,0xD2,0x9C,
-	0x33,0xB5,0x33,0xB5,0x93,0xBD,0x52,0xBD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0xD4,0xCD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x33,0xB5,0x33,0xB5,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xB1,0xA4,0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x70,0x94,0x4F,0x9C,
-	0x0E,0x84,0xAD,0x83,0x6C,0x7B,0x4C,0x6B,0xCA,0x5A,0x69,0x52,0x69,0x52,0xE7,0x41,0x65,0x31,0x67,0x29,0x24,0x21,0xC4,0x10,0xA3,0x08,0x62,0x08,0x62,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,
-	0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,
-	0x63,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,
-	0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x28,0x01,0x28,0x01,0x68,0x01,0x69,0x01,
-	0xC9,0x11,0x2A,0x1A,0x4B,0x22,0x4C,0x3A,0xED,0x4A,0x0D,0x53,0x6E,0x63,0x6E,0x63,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x93,0xBD,0x93,0xBD,0x93,0xBD,0x52,0xBD,0xD4,0xCD,0x93,0xBD,0x93,0xBD,0xD4,0xCD,0x93,0xBD,0xD4,0xCD,0x93,0xBD,0x52,0xBD,0x93,0xBD,0x93,0xBD,
-	0x52,0xBD,0x52,0xBD,0x52,0xBD,0x31,0xB5,0x31,0xB5,0xF1,0xAC,0xB0,0xA4,0x4F,0x9C,0x0E,0x84,0xAD,0x83,0x6C,0x7B,0x4C,0x6B,0xCA,0x5A,0x69,0x52,0x69,0x52,0xE7,0x41,0x67,0x29,0x67,0x29,0x47,0x11,0x24,0x21,0xC4,0x10,0xC4,0x10,0xC4,0x10,0xC4,0x10,0xC4,0x10,0xC4,0x10,0xC2,0x10,0xC4,0x10,0xC2,0x10,0xC4,0x10,0xC2,0x10,0xC2,0x10,
-	0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA2,0x08,0x62,0x08,0x61,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,
-	0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0x63,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA4,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE6,0x00,0xA5,0x00,0xE6,0x00,
-	0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE7,0x00,0x27,0x01,0x27,0x01,0x68,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x4B,0x22,0x4B,0x2A,0x4C,0x3A,
-	0xAC,0x3A,0xED,0x4A,0xED,0x4A,0x4E,0x53,0x4E,0x53,0x6E,0x63,0x6E,0x63,0xAF,0x63,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x70,0x94,0x70,0x94,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xF2,0xA4,0xF2,0xA4,0xF2,0xA4,0x33,0xB5,0x52,0xBD,0x52,0xBD,
-	0x93,0xBD,0x93,0xBD,0x93,0xBD,0x52,0xBD,0x93,0xBD,0x93,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x52,0xBD,0x33,0xB5,0x52,0xBD,0xD1,0xB4,0xF0,0xAC,0xB0,0xAC,0xB0,0xA4,0x6F,0xA4,0x70,0x94,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x4F,0x9C,0x0E,0x84,0x4F,0x9C,
-	0xED,0x93,0xED,0x93,0xAD,0x83,0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0x65,0x31,0x24,0x21,0xC2,0x10,0xC2,0x10,0x62,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,
-	0x63,0x00,0x63,0x00,0x63,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0x27,0x01,
-	0x27,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xCA,0x19,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xED,0x4A,0x0D,0x53,0x4E,0x53,0x6E,0x63,0xAF,0x63,0xEF,0x7B,0x50,0x8C,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xD2,0x9C,0xD2,0x9C,0xF1,0xA4,0xB1,0xA4,0xD2,0x9C,0xB1,0xA4,0xD2,0x9C,0xB1,0x9C,0xB1,0x9C,0xB1,0xA4,0xB1,0x9C,0xB1,0xA4,
-	0xB1,0xA4,0xB1,0x9C,0xD2,0x9C,0xB1,0xA4,0xB1,0x9C,0xB1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xA4,0xF1,0xAC,0xF1,0xAC,0x33,0xB5,0x31,0xB5,0x33,0xB5,0x33,0xB5,0x52,0xBD,0x33,0xB5,0x52,0xBD,0x52,0xBD,0x33,0xB5,0x52,0xBD,0x33,0xB5,0x31,0xB5,0x33,0xB5,0x31,0xB5,0x33,0xB5,0xF1,0xAC,0xF1,0xAC,0x33,0xB5,0xD1,0xB4,0x31,0xB5,0xD1,0xB4,
-	0x31,0xB5,0x31,0xB5,0xD1,0xB4,0xF1,0xAC,0xD1,0xB4,0xF1,0xAC,0xF1,0xAC,0xD1,0xB4,0xF0,0xAC,0xB0,0xAC,0xB0,0xAC,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0xED,0x93,0x6C,0x7B,0x6C,0x7B,0x2B,0x6B,0xCA,0x5A,0x69,0x52,0x69,0x52,0xE7,0x41,0xE7,0x41,0x65,0x31,0x24,0x21,0x24,0x21,0xC2,0x10,0x62,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,
-	0xA5,0x00,0xA5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xE6,0x00,0xE7,0x00,0x27,0x01,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xE7,0x00,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x68,0x01,0x69,0x01,0xA9,0x01,0xC9,0x11,0xCA,0x19,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xAC,0x3A,0xED,0x4A,
-	0x0D,0x53,0x6E,0x63,0x6E,0x63,0x8D,0x73,0xEF,0x7B,0x0E,0x84,0x50,0x8C,0x70,0x94,0xB1,0x9C,0xB1,0x9C,0xB1,0xA4,0xB1,0xA4,0xB1,0xA4,0xB1,0x9C,0xB1,0xA4,0xB1,0x9C,0xB1,0xA4,0xB1,0xA4,0xB0,0xA4,0xB1,0xA4,0xB0,0xA4,0xB1,0xA4,0xB0,0xA4,0xB1,0xA4,0xB1,0xA4,0xF0,0xAC,0xF1,0xAC,0xF1,0xAC,0xF1,0xAC,0xD1,0xB4,0xF1,0xAC,0xF1,0xAC,
-	0xF1,0xAC,0xF1,0xAC,0xB1,0xAC,0xB0,0xAC,0xF0,0xAC,0xB0,0xAC,0xB1,0xAC,0xF0,0xAC,0xB0,0xAC,0xF0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xA4,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0xED,0x93,0xED,0x93,0x6C,0x7B,0x6C,0x7B,0x2B,0x6B,0xCA,0x5A,
-	0x69,0x52,0xE7,0x41,0xE7,0x41,0x65,0x31,0x24,0x21,0xC4,0x10,0xA3,0x08,0xA2,0x08,0xA3,0x08,0x62,0x00,0x62,0x08,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x61,0x00,0x21,0x00,0x62,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,
-	0xE4,0x00,0xE5,0x08,0xE5,0x08,0xE5,0x08,0x47,0x11,0x47,0x11,0x67,0x29,0x67,0x29,0xE7,0x41,0x49,0x3A,0x69,0x52,0x69,0x52,0xCA,0x5A,0x2B,0x6B,0x6C,0x7B,0x6C,0x7B,0xAD,0x83,0xAD,0x83,0xED,0x93,0x0E,0x84,0x4F,0x9C,0x4F,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0xB0,0xA4,
-	0x6F,0xA4,0x6F,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xB0,0xAC,0xF0,0xAC,0xD1,0xB4,0xF1,0xAC,0xD1,0xB4,0xD1,0xB4,0xD1,0xB4,0xB0,0xAC,0xF0,0xAC,0xB0,0xA4,0x6F,0xA4,0x4F,0x9C,0x4F,0x9C,0xAD,0x83,0x6C,0x7B,0x2B,0x6B,0xCA,0x5A,0xCA,0x5A,0x69,0x52,0x69,0x52,0x69,0x52,0x69,0x52,
-	0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0x2B,0x6B,0x2B,0x6B,0x2B,0x6B,0x2B,0x6B,0xCA,0x5A,0xCA,0x5A,0xCA,0x5A,0x69,0x52,0x69,0x52,0x69,0x52,0x69,0x52,0xE7,0x41,0x65,0x31,0x24,0x21,0x24,0x21,0xC4,0x10,0xA4,0x08,0xC4,0x10,0xA4,0x08,0xC2,0x10,0xA3,0x08,0xA3,0x08,0xA3,0x08,0xA2,0x08,0xA2,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_228_dial_img_0_1478_data_0, "face_228_dial_img_0_1478_data_0.bin");
         
 
 
@@ -2186,7 +21,7 @@ const lv_img_dsc_t face_228_dial_img_0_1478_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 288,
-    .data_size = sizeof(face_228_dial_img_0_1478_data_0),
+    .data_size = 138240,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_228_dial_img_0_1478_data_0};
 
@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 228
-
-#include "../228.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_228_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x4A,0xCA,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x4A,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x61,0x00,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA5,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x61,0x08,0xC2,0x10,0xE2,0x18,0x44,0x29,0x85,0x31,0x07,0x42,0x28,0x4A,0x48,0x4A,0x48,0x52,0xA9,0x5A,0x89,0x52,0xCA,0x5A,0xCA,0x5A,0x89,0x52,0xA9,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x23,0x21,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x08,0xC2,0x10,0x03,0x21,0x85,0x31,0x28,0x42,0xA9,0x52,0x0B,0x6B,0x8C,0x73,0xEE,0x83,0x6F,0x94,0x90,0x94,0xB1,0xA4,0xD1,0xA4,0x11,0xAD,0x31,0xAD,0x53,0xA5,0x32,0xAD,0x32,0xAD,0x31,0xAD,0x11,0xAD,0xD1,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xA1,0x10,0x03,0x19,
-	0xC6,0x39,0x89,0x52,0x2B,0x6B,0xCD,0x7B,0x4F,0x8C,0x11,0xA5,0x53,0xAD,0xB4,0xBD,0xF5,0xC5,0x56,0xC6,0x76,0xCE,0x97,0xD6,0x97,0xD6,0xB8,0xD6,0xD9,0xD6,0xB8,0xDE,0xF8,0xDE,0xB7,0xDE,0xD9,0xD6,0x98,0xD6,0x97,0xD6,0x76,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xA2,0x10,0x65,0x29,0x28,0x4A,0x0B,0x63,
-	0x0E,0x84,0xB1,0x9C,0x74,0xAD,0xF5,0xC5,0x36,0xCE,0xB7,0xD6,0xB8,0xD6,0xF9,0xDE,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x5A,0xEF,0x7A,0xEF,0x5A,0xEF,0x5A,0xEF,0x7A,0xEF,0x7A,0xEF,0x5B,0xEF,0x7A,0xEF,0x5A,0xEF,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xE2,0x18,0xA5,0x31,0x89,0x52,0xAD,0x7B,0xB1,0x9C,0x73,0xB5,
-	0xF4,0xC5,0x97,0xD6,0xF8,0xDE,0x18,0xDF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xEF,0x7A,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x65,0x29,
-	0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xC2,0x10,0xC6,0x39,0xEA,0x62,0x0E,0x84,0x12,0xAD,0x15,0xC6,0x97,0xD6,0xF8,0xDE,
-	0x39,0xE7,0x7A,0xEF,0x9A,0xEF,0x9B,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x9B,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x85,0x31,0x89,0x52,0xCD,0x83,0x32,0xAD,0x15,0xC6,0xB7,0xD6,0xF8,0xDE,0x5A,0xEF,0x5A,0xEF,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x48,0x4A,0x6C,0x73,0xF1,0xA4,0xF5,0xC5,0xD7,0xD6,0x19,0xE7,0x59,0xEF,0x9A,0xEF,0x9A,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x10,0x48,0x4A,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x85,0x31,0xE9,0x5A,0x4F,0x94,0xB3,0xBD,0xB7,0xD6,0x19,0xE7,0x79,0xEF,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x27,0x42,0x8C,0x7B,0x11,0xA5,0x36,0xCE,0xF8,0xE6,0x59,0xEF,0x7A,0xEF,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE2,0x10,0x28,0x4A,0x0E,0x84,0xB4,0xBD,0x77,0xD6,0x39,0xEF,0x59,0xEF,0x9A,0xF7,0x79,0xF7,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x03,0x21,0x89,0x52,0x4F,0x94,0xD5,0xC5,0xD8,0xDE,0x38,0xEF,0x79,0xEF,0x79,0xF7,0x9A,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x44,0x21,0xCA,0x5A,0x11,0xA5,0x76,0xCE,0x18,0xE7,0x59,0xEF,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x9A,0xF7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x44,0x21,0x0B,0x6B,0xF2,0xA4,0xB9,0xD6,0x38,0xE7,0x79,0xEF,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x9A,0xF7,0x7A,0xF7,0x9A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x24,0x21,0xEB,0x62,0x12,0xAD,0x76,0xCE,0x38,0xE7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x9A,0xF7,0x7A,0xF7,0x9A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0xBC,0xF7,0x9C,0xEF,0x9C,0xF7,0x7C,0xEF,0xB9,0xD6,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE2,0x18,0xA9,0x5A,0xD1,0x9C,0x56,0xCE,0x18,0xE7,0x59,0xEF,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x58,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x9A,0xF7,0x7A,0xF7,0x7A,0xF7,0x9A,0xF7,0xBA,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0x5B,0xE7,0x9C,0xEF,0x58,0xC6,0xFB,0xDE,0x79,0xCE,0xD5,0x8C,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0x5B,0xEF,0x9B,0xEF,0xD9,0xD6,0x9B,0xEF,0x3B,0xE7,0x3A,0xE7,0xBB,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x0B,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x89,0x52,0xB0,0x9C,0x76,0xCE,0x18,0xE7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x58,0xF7,0x37,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0xBA,0xF7,0xBB,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x3A,0xDF,0x76,0xA5,0xD5,0x8C,0xF5,0x8C,0xB5,0x84,0x38,0xBE,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xBC,0xF7,0x18,0xBE,0xD7,0xB5,0x15,0x95,0x59,0xC6,0xD5,0x8C,0x17,0xBE,0xBB,0xF7,0xBB,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x68,0x52,0x90,0x94,0x15,0xCE,0x19,0xE7,0x59,0xEF,0x79,0xF7,0x79,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xB7,0xAD,0x33,0x74,0xD5,0x8C,0xF5,0x8C,0x1B,0xDF,0x9D,0xF7,0x5C,0xEF,0x5C,0xEF,0x7C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0x58,0xBE,0x11,0x4B,0xF5,0x8C,0x35,0x95,0x36,0x9D,0x58,0xC6,0x5A,0xE7,0xBB,0xF7,0xBB,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC6,0x31,0x2F,0x84,0xB4,0xBD,0x18,0xE7,0x59,0xEF,0x99,0xF7,0x79,0xF7,0x58,0xF7,0x37,0xF7,0x16,0xF7,0x37,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x58,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x9A,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x3B,0xE7,0x36,0x95,0x0F,0x22,0xD2,0x5B,0x18,0xB6,0x1B,0xE7,0x7C,0xEF,0x3B,0xE7,0x3B,0xE7,0xFA,0xDE,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xB9,0xCE,
-	0x11,0x4B,0x8E,0x09,0x30,0x22,0x56,0x9D,0xF7,0xB5,0x3A,0xE7,0x7A,0xEF,0x9A,0xEF,0x7A,0xEF,0x7A,0xEF,0xBB,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xB2,0x94,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x21,0x4C,0x6B,0x94,0xB5,0xD8,0xDE,0x59,0xEF,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0x16,0xF7,0x37,0xF7,0x58,0xF7,0x59,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x54,0x7C,0x8E,0x01,0x6E,0x01,0xD5,0x8C,0x9C,0xEF,0xFA,0xDE,0xFA,0xDE,0x1B,0xE7,0x5B,0xE7,0x9C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xFA,0xDE,
-	0x54,0x74,0xCF,0x11,0x70,0x2A,0x1A,0xDF,0x7B,0xEF,0x1A,0xDF,0xFA,0xDE,0x1A,0xDF,0xFA,0xDE,0x3A,0xE7,0xBB,0xF7,0xBB,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xA9,0x52,0x51,0xA5,0xD7,0xD6,0x59,0xEF,0x7A,0xF7,0x79,0xF7,0x58,0xF7,0x57,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x39,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x7A,0xF7,0x7A,0xF7,0xD9,0xDE,0x19,0xE7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xFA,0xDE,0x58,0xC6,0x51,0x4B,0x0E,0x1A,0xBA,0xD6,0x1A,0xE7,0x3A,0xE7,0x5C,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,
-	0xBC,0xF7,0xD5,0x84,0xCF,0x11,0xD8,0xB5,0x39,0xE7,0xF9,0xDE,0xFA,0xDE,0x5A,0xE7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0xE7,0x41,0x2E,0x8C,0x56,0xCE,0x19,0xE7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x78,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x59,0xF7,0x79,0xF7,0x79,0xF7,0x59,0xF7,
-	0xB7,0xD6,0x5A,0xEF,0x74,0x7C,0x57,0xC6,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xD5,0x8C,0x4E,0x01,0xD1,0x3A,0x99,0xCE,0xB9,0xD6,0x38,0xC6,0xD7,0xAD,0x78,0xC6,0xD9,0xD6,0x3B,0xE7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0x9B,0xEF,0xD2,0x5B,0x4E,0x01,0x90,0x3A,0xD9,0xD6,0x9B,0xEF,0x9A,0xEF,0x9B,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x21,0x4C,0x6B,0x73,0xB5,0xF8,0xDE,0x79,0xEF,0x7A,0xF7,0x79,0xF7,0x58,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x58,0xF7,0x59,0xF7,0xF8,0xDE,0xF8,0xE6,
-	0x15,0x95,0x56,0x9D,0x15,0x95,0x59,0xEF,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0x9B,0xEF,0xF1,0x42,0x6E,0x01,0x4E,0x01,0xCE,0x11,0xCE,0x11,0x4E,0x09,0x6E,0x01,0x6E,0x01,0x11,0x4B,0x5A,0xE7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xEF,0x7A,0xEF,0x7B,0xEF,
-	0x79,0xC6,0xEF,0x19,0x6E,0x01,0x6E,0x01,0xF0,0x3A,0xF5,0x8C,0xB6,0xAD,0x78,0xC6,0x39,0xDF,0x79,0xEF,0x9A,0xEF,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x68,0x52,0xF1,0xA4,0x97,0xD6,0x39,0xE7,0x7A,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x15,0xF7,0xF5,0xF6,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x97,0xDE,0xB4,0x8C,
-	0x95,0xA5,0x36,0x95,0x59,0xEF,0x9A,0xF7,0x5A,0xEF,0x5A,0xEF,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9B,0xEF,0x37,0xBE,0xCF,0x11,0x2C,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x2F,0x22,0x58,0xC6,0x98,0xCE,0x38,0xC6,0x38,0xC6,0x37,0xBE,0xB7,0xAD,0xB7,0xAD,
-	0xF3,0x6B,0x6E,0x01,0x6E,0x01,0x2E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x09,0xCE,0x11,0xB0,0x3A,0x35,0x95,0x9A,0xEF,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x44,0x29,0xCD,0x7B,0xF4,0xC5,0x18,0xE7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x16,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x57,0xC6,0x13,0x6C,
-	0xD5,0x8C,0xF6,0xB5,0x79,0xF7,0x59,0xEF,0x19,0xE7,0x5A,0xE7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xEF,0x99,0xCE,0xD5,0x84,0x72,0x53,0xAE,0x09,0x6E,0x01,0x6E,0x01,0x2C,0x01,0x8E,0x09,0x0F,0x1A,0xAF,0x11,0x6E,0x01,0xAE,0x09,0xD2,0x5B,0x34,0x74,0xB5,0x8C,0x56,0x9D,0x96,0xA5,0x78,0xCE,0x74,0x7C,
-	0xEE,0x11,0x2F,0x22,0x4D,0x01,0x4D,0x01,0x6E,0x01,0x2C,0x01,0x6E,0x01,0x6E,0x01,0x4D,0x01,0x13,0x6C,0x39,0xE7,0xF9,0xE6,0x3A,0xE7,0x39,0xE7,0x5A,0xE7,0x5A,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x89,0x52,0x11,0xA5,0xB7,0xDE,0x59,0xEF,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x16,0xF7,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x58,0xF7,0x13,0x74,0x2F,0x2A,
-	0x77,0xCE,0x59,0xEF,0x18,0xDF,0xF8,0xDE,0x59,0xE7,0x9A,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xD9,0xD6,0xD5,0x8C,0x94,0x84,0x36,0x9D,0x90,0x32,0x55,0x9D,0xB4,0x84,0x31,0x4B,0x72,0x53,0x15,0x95,0x18,0xBE,0xD7,0xAD,0xB0,0x3A,0x6E,0x01,0xB3,0x63,0xD9,0xD6,0xD9,0xD6,0xDA,0xD6,0xD9,0xD6,0xB9,0xD6,0x38,0xBE,
-	0x13,0x6C,0x98,0xCE,0x94,0x7C,0x4F,0x22,0xCE,0x11,0x8F,0x2A,0x2E,0x1A,0x6E,0x01,0x4D,0x01,0x8F,0x2A,0x96,0xA5,0x17,0xBE,0xF6,0xBD,0x96,0xA5,0x76,0xA5,0x76,0xA5,0x76,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x44,0x29,0xCD,0x7B,0x36,0xC6,0x39,0xEF,0x7A,0xEF,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x58,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x16,0xF7,0x38,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0xF7,0xE6,0xD4,0x8C,0x4D,0x09,0x2E,0x1A,
-	0xF8,0xDE,0x18,0xE7,0xF8,0xDE,0x59,0xEF,0x79,0xEF,0xD8,0xD6,0x57,0xC6,0x19,0xE7,0x9A,0xEF,0xF9,0xD6,0x56,0x9D,0x34,0x74,0x56,0x9D,0x19,0xE7,0xBB,0xF7,0x96,0xA5,0x54,0x74,0xF7,0xB5,0x78,0xCE,0x98,0xCE,0x98,0xCE,0x58,0xC6,0x98,0xCE,0x38,0xC6,0x74,0x7C,0x2F,0x1A,0x76,0xA5,0x9B,0xEF,0x7A,0xEF,0x7B,0xEF,0x7A,0xEF,0x9B,0xEF,
-	0x76,0xA5,0xD3,0x6B,0x17,0xB6,0x98,0xCE,0xF6,0xBD,0x37,0xC6,0x37,0xC6,0xD2,0x63,0x4E,0x09,0x51,0x4B,0x55,0x9D,0x15,0x95,0x37,0xBE,0xB8,0xD6,0x19,0xE7,0x79,0xEF,0x9A,0xF7,0xBA,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x68,0x52,0x11,0xA5,0xB7,0xD6,0x5A,0xEF,0xBA,0xF7,0x9A,0xF7,0x7A,0xF7,0x78,0xF7,0x37,0xF7,0x16,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x16,0xF7,0x58,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x13,0xA5,0x90,0x2A,0xD0,0x42,0x8E,0x09,
-	0xF1,0x42,0xB8,0xDE,0x38,0xEF,0x76,0xA5,0x31,0x53,0x0F,0x22,0x4F,0x22,0xB6,0xAD,0xD4,0x84,0xF3,0x63,0x36,0x95,0xD9,0xD6,0x9A,0xEF,0x9A,0xF7,0x5A,0xE7,0x7A,0xEF,0x17,0xBE,0x74,0x7C,0x58,0xC6,0xB9,0xCE,0x78,0xCE,0x78,0xCE,0xB9,0xCE,0x19,0xE7,0x9A,0xEF,0xD6,0xAD,0x10,0x43,0x35,0x9D,0x3A,0xE7,0x3A,0xE7,0x3A,0xE7,0x1A,0xDF,
-	0x9B,0xEF,0xF7,0xB5,0x15,0x95,0xD8,0xD6,0x77,0xCE,0x16,0xBE,0x16,0xBE,0x97,0xCE,0x32,0x53,0xAF,0x11,0x36,0xC6,0x97,0xCE,0x77,0xC6,0xD6,0xAD,0x76,0xA5,0x56,0xA5,0xD7,0xAD,0x37,0xBE,0xD8,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xEF,0x7B,0x50,0x84,0x50,0x84,0x4C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0F,0x7C,0x50,0x84,0x50,0x84,0xAE,0x73,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x23,0x21,0x6C,0x7B,0xF4,0xC5,0x39,0xE7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x58,0xF7,0x37,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0xF7,0xDE,0xF7,0xE6,0x17,0xE7,0xCF,0x3A,
-	0x4E,0x01,0xB0,0x32,0xF1,0x3A,0x8E,0x01,0x6E,0x01,0x6E,0x01,0x4E,0x01,0x52,0x53,0xF7,0xB5,0x19,0xE7,0xBB,0xF7,0x9A,0xEF,0x3A,0xEF,0xFA,0xDE,0xFA,0xDE,0x5A,0xE7,0xBB,0xF7,0x9B,0xEF,0x3A,0xE7,0x3A,0xE7,0x5A,0xEF,0x5A,0xEF,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x78,0xC6,0x76,0xA5,0x9A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,
-	0x7A,0xEF,0xBB,0xF7,0x7A,0xEF,0xF8,0xDE,0x18,0xE7,0x97,0xDE,0x77,0xD6,0x97,0xD6,0xF7,0xE6,0x90,0x5B,0x13,0x6C,0x18,0xE7,0x39,0xEF,0x59,0xEF,0x38,0xE7,0xB7,0xDE,0x36,0xC6,0x16,0xBE,0x92,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xD3,0x9C,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0x07,0x42,0x90,0x9C,0x97,0xD6,0x59,0xEF,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x7A,0xF7,0x58,0xF7,0x37,0xF7,0x15,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x16,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x58,0xF7,0xD7,0xDE,0x70,0x2A,
-	0x6E,0x01,0x2C,0x01,0x6E,0x01,0x2E,0x01,0x6E,0x01,0x6E,0x09,0x4E,0x01,0x2F,0x22,0xF7,0xB5,0xBB,0xF7,0x7A,0xEF,0xFA,0xDE,0xF8,0xDE,0x3A,0xEF,0x9A,0xEF,0x9B,0xF7,0xBB,0xF7,0x9A,0xEF,0x1A,0xE7,0x1A,0xE7,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9B,0xF7,0x5A,0xE7,0xFA,0xDE,0x9B,0xEF,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBB,0xF7,0x79,0xEF,0xF8,0xDE,0x18,0xE7,0x58,0xEF,0x58,0xEF,0x57,0xEF,0x58,0xF7,0xD7,0xDE,0x31,0x4B,0x75,0xA5,0x59,0xEF,0x39,0xEF,0xF7,0xE6,0x38,0xE7,0x78,0xF7,0x55,0x9D,0x6F,0x2A,0xD5,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0xAE,0x73,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x91,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xEB,0x62,0x93,0xBD,0x18,0xE7,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x58,0xF7,0x37,0xF7,0xF5,0xF6,0xF5,0xF6,0xB4,0xF6,0xF5,0xF6,0x16,0xF7,0x37,0xF7,0x36,0xF7,0x16,0xF7,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x76,0xD6,0xEE,0x21,
-	0x6E,0x01,0x6E,0x01,0x6E,0x01,0x2F,0x22,0xD4,0x8C,0xF6,0xB5,0x13,0x6C,0xB0,0x3A,0x70,0x2A,0x35,0x9D,0x38,0xC6,0x3A,0xE7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xEF,0x1A,0xDF,0xFA,0xDE,0xBB,0xF7,0xBB,0xF7,
-	0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x39,0xEF,0x58,0xEF,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xC6,0xD1,0x5B,0xB7,0xDE,0x78,0xF7,0x38,0xEF,0xF7,0xEE,0x17,0xEF,0xEF,0x42,0x15,0x95,0x78,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xEF,0x7B,0xFB,0xDE,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x65,0x31,0xCD,0x7B,0x15,0xCE,0x59,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x7A,0xF7,0x78,0xF7,0x37,0xF7,0x16,0xF7,0xF4,0xF6,0x93,0xEE,0xF4,0xF6,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x78,0xF7,0x16,0xC6,0x0F,0x1A,
-	0x6D,0x09,0x2E,0x1A,0xF3,0x63,0x36,0xBE,0xB8,0xD6,0x37,0xBE,0x78,0xC6,0xD8,0xDE,0xB7,0xAD,0xD4,0x84,0xD7,0xB5,0x9A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9B,0xF7,0x9A,0xEF,0x9A,0xF7,0xBB,0xF7,
-	0xBA,0xF7,0x9A,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x78,0xF7,0x99,0xF7,0x9A,0xF7,0x19,0xE7,0xD7,0xDE,0x58,0xEF,0x78,0xF7,0x38,0xF7,0x37,0xEF,0xB1,0x5B,0x91,0x63,0x38,0xEF,0x58,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x4A,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x28,0x4A,0x30,0x9D,0xD7,0xD6,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x59,0xF7,0x37,0xF7,0x15,0xF7,0xD4,0xF6,0xF4,0xF6,0xF4,0xF6,0x16,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x37,0xEF,0x90,0x32,0x11,0x74,
-	0x36,0xCE,0xF6,0xBD,0x57,0xCE,0x36,0xC6,0xF7,0xB5,0x57,0xC6,0xF9,0xDE,0x18,0xDF,0x19,0xE7,0x19,0xDF,0x19,0xE7,0x39,0xE7,0x7A,0xEF,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x99,0xF7,0x99,0xF7,
-	0xB9,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x9A,0xF7,0x79,0xF7,0xD8,0xDE,0xF8,0xE6,0x58,0xEF,0x77,0xF7,0x37,0xF7,0x96,0xD6,0x4F,0x2A,0xF2,0x6B,0xF4,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0x0B,0x6B,0x73,0xB5,0xF8,0xE6,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x79,0xF7,0x37,0xF7,0xF5,0xF6,0xD4,0xF6,0xB4,0xF6,0xF5,0xF6,0x17,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x58,0xF7,0x36,0xC6,0x74,0x7C,
-	0x53,0x7C,0x55,0x9D,0x78,0xCE,0x78,0xCE,0xD7,0xDE,0x79,0xEF,0xBA,0xF7,0xBA,0xF7,0x9A,0xF7,0x99,0xEF,0x79,0xEF,0x19,0xE7,0x5A,0xEF,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x9A,0xF7,0x99,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0x9A,0xF7,0x99,0xF7,0x58,0xEF,0x17,0xE7,0x38,0xEF,0x58,0xF7,0x57,0xF7,0x57,0xF7,0x95,0xD6,0x52,0x74,0x6E,0x09,0x0E,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xFB,0xDE,0x50,0x84,0x82,0x10,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x23,0x21,0xAD,0x73,0xF4,0xC5,0x39,0xE7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x79,0xF7,0x37,0xF7,0x15,0xF7,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x17,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xF7,0x59,0xF7,0x58,0xF7,0x37,0xF7,0x57,0xF7,0x57,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x58,0xF7,
-	0xB7,0xDE,0xD7,0xDE,0xF8,0xDE,0x39,0xEF,0xB9,0xF7,0x9A,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x99,0xF7,0x78,0xF7,0x78,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0xB9,0xF7,0x9A,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x77,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x17,0xF7,0x36,0xCE,0x51,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x9D,0xEF,0x30,0x84,0x04,0x21,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x00,0xC6,0x39,0x90,0x9C,0x97,0xD6,0x39,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x7A,0xF7,0x79,0xF7,0x58,0xF7,0x37,0xF7,0x16,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x37,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xF7,0x59,0xF7,0x78,0xF7,0x78,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,
-	0x59,0xEF,0x18,0xE7,0xF8,0xDE,0x59,0xEF,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x9A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x99,0xF7,0x78,0xF7,0x78,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0xBA,0xF7,0xBA,0xF7,0x99,0xF7,0x79,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xD5,0xEE,0x96,0xDE,0xF7,0xEE,0x15,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0x75,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x00,0x07,0x42,0x11,0xA5,0xB8,0xDE,0x9A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x59,0xF7,0x58,0xF7,0x37,0xF7,0x16,0xF7,0xF6,0xF6,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x36,0xF7,0x38,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x78,0xF7,0x57,0xF7,
-	0x37,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x9A,0xF7,0xBA,0xF7,0x9A,0xF7,0x79,0xF7,0x98,0xF7,0x78,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xB5,0xE6,0x55,0xCE,0x76,0xD6,0xB7,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x44,0x21,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x81,0x08,0xC9,0x5A,0xB3,0xB5,0x18,0xDF,0x7A,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x79,0xF7,0x58,0xF7,0x37,0xF7,0x37,0xF7,0x16,0xF7,0xF6,0xF6,0xF5,0xF6,0xF5,0xF6,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x9A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,
-	0x57,0xF7,0x57,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x16,0xF7,0x36,0xF7,0x16,0xEF,0xD6,0xE6,0x77,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x0C,0x63,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA1,0x10,0x0B,0x63,0xF5,0xC5,0x18,0xE7,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x16,0xF7,0x15,0xF7,0x16,0xF7,0xF6,0xF6,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,
-	0x79,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xB9,0xF7,0x99,0xF7,0x99,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,
-	0x36,0xF7,0x56,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x36,0xF7,0x15,0xF7,0x35,0xF7,0xF5,0xF6,0x15,0xF7,0x15,0xF7,0xF5,0xF6,0x35,0xF7,0x15,0xF7,0xF5,0xF6,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x37,0xEF,0xB7,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xB2,0x94,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x03,0x21,0xCD,0x83,0x35,0xCE,0x39,0xEF,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x15,0xF7,0xF5,0xF6,0xF5,0xF6,0xF5,0xF6,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x98,0xF7,0x99,0xF7,
-	0x79,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x9A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x58,0xF7,0x57,0xF7,0x36,0xF7,0x15,0xF7,0x15,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF5,0xF6,0xF5,0xF6,0x15,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x58,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x95,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xE3,0x18,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x24,0x29,0x2F,0x8C,0x97,0xCE,0x59,0xEF,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xF7,0x37,0xF7,0x16,0xF7,0xF6,0xF6,0x15,0xF7,0x16,0xF7,0xF6,0xF6,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,
-	0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0xB9,0xF7,0x9A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x99,0xF7,0xB9,0xF7,0xB9,0xF7,0x99,0xF7,0x99,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x36,0xF7,0x36,0xF7,0x57,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x36,0xF7,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x15,0xF7,0x57,0xF7,0x77,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x78,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x85,0x31,0x8F,0x94,0xB7,0xD6,0x59,0xEF,0x9A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x59,0xF7,0x58,0xF7,0x38,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x16,0xF7,0xF6,0xF6,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x58,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0xB9,0xF7,0xB9,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x35,0xF7,0x35,0xF7,0x36,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x57,0xF7,0x57,0xF7,0x36,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x57,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x77,0xF7,0x78,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x8D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x85,0x31,0xB0,0x94,0xB7,0xD6,0x79,0xF7,0x9A,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x59,0xF7,0x58,0xF7,0x38,0xF7,0x38,0xF7,0x36,0xF7,0x36,0xF7,0xF6,0xF6,0x36,0xF7,0x37,0xF7,0x58,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,
-	0x15,0xF7,0x15,0xF7,0x16,0xF7,0x56,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x57,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x77,0xF7,0x78,0xF7,0x59,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xE6,0x39,0x10,0x9D,0xD8,0xDE,0x7A,0xEF,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x59,0xF7,0x78,0xF7,0x38,0xF7,0x36,0xF7,0xF6,0xF6,0x16,0xF7,0x16,0xF7,0x38,0xF7,0x58,0xF7,0x38,0xF7,0x38,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,
-	0x15,0xF7,0x15,0xF7,0x15,0xF7,0x35,0xF7,0x15,0xF7,0xF5,0xF6,0xF5,0xF6,0x15,0xF7,0x15,0xF7,0x15,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x78,0xF7,0x58,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xD3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xE7,0x41,0xF1,0xA4,0xF8,0xE6,0x7A,0xEF,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x7A,0xF7,0x58,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x16,0xF7,0x36,0xF7,0x37,0xF7,0x58,0xF7,0x58,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,
-	0x15,0xF7,0xF5,0xF6,0x15,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xD3,0xF6,0xD3,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x58,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xE7,0x41,0x30,0xA5,0xF8,0xE6,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x59,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x79,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,
-	0x15,0xF7,0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xD3,0xF6,0xD3,0xF6,0xB2,0xF6,0xD3,0xF6,0xD2,0xF6,0xD2,0xF6,0xD3,0xF6,0xD3,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x35,0xF7,0x36,0xF7,0x77,0xF7,0x59,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x9C,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xE7,0x41,0x12,0xA5,0xF8,0xDE,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x9A,0xF7,0x7A,0xF7,0x79,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0xBA,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x57,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0xF5,0xF6,0x15,0xF7,0x15,0xF7,
-	0xF5,0xF6,0xF5,0xF6,0x15,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF3,0xF6,0xB2,0xF6,0xD3,0xF6,0xB2,0xF6,0xD3,0xF6,0xD3,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x15,0xF7,0x36,0xF7,0x57,0xF7,0x58,0xEF,0xF8,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x50,0x84,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x30,0x84,0xCF,0x7B,0xCF,0x7B,0x2C,0x63,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xE7,0x41,0xD1,0x9C,0xF8,0xE6,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x37,0xF7,0x16,0xF7,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x58,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x9A,0xF7,0xBA,0xF7,0x9A,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x77,0xF7,0x77,0xF7,0x57,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0xF5,0xF6,0x35,0xF7,0x15,0xF7,0xF5,0xF6,
-	0xF5,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xD3,0xF6,0xD3,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x15,0xF7,0x36,0xF7,0x77,0xF7,0x57,0xEF,0xB7,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xA6,0x31,0x10,0x9D,0xD7,0xD6,0x5A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0x9B,0xF7,0x7A,0xF7,0x59,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x38,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x57,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,
-	0x78,0xF7,0x79,0xF7,0x79,0xF7,0xB9,0xF7,0x99,0xF7,0x99,0xF7,0xB9,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x57,0xF7,0x58,0xF7,0x78,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0xF5,0xF6,
-	0x14,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xD3,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xD3,0xF6,0xD3,0xF6,0xB2,0xF6,0xD3,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x35,0xF7,0x36,0xF7,0x57,0xF7,0x58,0xEF,0xB7,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xA5,0x31,0xB1,0x94,0xD8,0xD6,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0x9B,0xF7,0x79,0xF7,0x58,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x38,0xF7,0x38,0xF7,0x78,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x57,0xF7,0x57,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x78,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x77,0xF7,0x37,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0xF5,0xF6,0x15,0xF7,
-	0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF3,0xF6,0xF3,0xF6,0xD3,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x35,0xF7,0x36,0xF7,0x57,0xF7,0x57,0xEF,0xB7,0xDE,0xB1,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x85,0x31,0x8F,0x94,0xB7,0xD6,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x58,0xF7,0x58,0xF7,0x78,0xF7,0x38,0xF7,0x58,0xF7,0x58,0xF7,0x58,0xF7,0x58,0xF7,0x78,0xF7,0x58,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x9A,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x58,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x57,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x15,0xF7,0x15,0xF7,0x35,0xF7,0xF5,0xF6,0x15,0xF7,0xF5,0xF6,
-	0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x16,0xF7,0x35,0xF7,0x15,0xF7,0xF4,0xF6,0xF4,0xF6,0xD4,0xF6,0xD4,0xF6,0xF4,0xF6,0x15,0xF7,0x36,0xF7,0x57,0xF7,0x57,0xEF,0x97,0xD6,0xB0,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x8A,0x52,0xE7,0x39,0xE7,0x39,0xA6,0x31,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x85,0x31,0x2F,0x8C,0x97,0xCE,0x5A,0xEF,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBD,0xF7,0xBC,0xF7,0x9B,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x59,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x38,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,
-	0x79,0xF7,0x99,0xF7,0x99,0xF7,0xB9,0xF7,0x99,0xF7,0x99,0xF7,0xBA,0xF7,0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x15,0xF7,0x15,0xF7,0xF5,0xF6,0xF5,0xF6,0x15,0xF7,0xF5,0xF6,
-	0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x14,0xF7,0x15,0xF7,0x15,0xF7,0x16,0xF7,0x36,0xF7,0x37,0xF7,0x36,0xF7,0x16,0xF7,0x35,0xF7,0x15,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x36,0xF7,0x57,0xF7,0x57,0xEF,0x97,0xD6,0x8F,0x94,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x03,0x21,0xEE,0x7B,0x57,0xCE,0x5A,0xEF,0x9B,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x99,0xF7,0x79,0xF7,0x99,0xF7,0x9A,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x58,0xF7,0x77,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x35,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,
-	0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x36,0xF7,0x37,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x15,0xF7,0x36,0xF7,0x57,0xF7,0x18,0xE7,0x35,0xCE,0x4E,0x8C,0x85,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE3,0x18,0x2B,0x63,0xF5,0xC5,0x1A,0xDF,0x9B,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x58,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,
-	0x15,0xF7,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x35,0xF7,0x36,0xF7,0x57,0xF7,0x78,0xF7,0x57,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x15,0xF7,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x15,0xF7,0x36,0xF7,0x57,0xF7,0xF7,0xE6,0xD4,0xC5,0xAC,0x73,0x03,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x08,0xCA,0x5A,0x93,0xB5,0xF8,0xDE,0x9B,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x99,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x15,0xF7,0x15,0xF7,0xF5,0xF6,0x35,0xF7,0x15,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x15,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0x35,0xF7,0x37,0xF7,0x36,0xF7,0x57,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x56,0xF7,0x16,0xF7,0x15,0xF7,0x15,0xF7,0xF5,0xF6,0x35,0xF7,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x37,0xF7,0x78,0xF7,0xF8,0xE6,0xB4,0xBD,0xCA,0x62,0x81,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x00,0x07,0x42,0x11,0xA5,0xD9,0xDE,0x9A,0xEF,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x79,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x98,0xF7,0x78,0xF7,
-	0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x15,0xF7,0x16,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x35,0xF7,0x15,0xF7,0x15,0xF7,0xF5,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,
-	0x15,0xF7,0x15,0xF7,0xF4,0xF6,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x57,0xF7,0x78,0xF7,0x99,0xF7,0x78,0xF7,0x57,0xF7,0x15,0xF7,0xF4,0xF6,0xD3,0xF6,0xB2,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0x56,0xF7,0x77,0xF7,0x38,0xEF,0xB6,0xDE,0x52,0xAD,0x68,0x4A,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x00,0xA6,0x39,0x50,0x8C,0x97,0xD6,0x39,0xEF,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,
-	0x99,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0xAC,0xDD,0xF4,0xEE,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x35,0xF7,0x36,0xF7,0x57,0xF7,0x57,0xF7,0x36,0xF7,
-	0x36,0xF7,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x36,0xF7,0x57,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x58,0xF7,0x15,0xF7,0xD3,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF3,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF4,0xF6,0xF5,0xF6,0x36,0xF7,0x78,0xF7,0x38,0xEF,0x56,0xD6,0xCF,0x9C,0xE7,0x41,0x40,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x9D,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xF7,0xBD,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x21,0xAD,0x73,0xF4,0xC5,0x39,0xE7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x57,0xF7,0x15,0xF7,0x36,0xEF,0xE5,0xE4,0x71,0xEE,0x15,0xF7,0x15,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x15,0xF7,0x15,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x57,0xF7,
-	0x36,0xF7,0x36,0xF7,0x36,0xF7,0x56,0xF7,0x57,0xF7,0x58,0xF7,0x79,0xF7,0xBA,0xF7,0x9A,0xF7,0x79,0xF7,0x56,0xF7,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0x15,0xF7,0xF4,0xF6,0xF4,0xF6,0x16,0xF7,0x57,0xF7,0x58,0xEF,0x37,0xEF,0x15,0xC6,0xED,0x83,0x44,0x29,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xEB,0x62,0x93,0xBD,0xF8,0xE6,0x7A,0xF7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBA,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x35,0xEF,0x58,0xEF,0x78,0xF7,0x57,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x70,0xEE,0x05,0xE5,0xE5,0xE4,0xC6,0xDC,0x8A,0xE5,0xF5,0xEE,0x36,0xF7,0x36,0xF7,0x16,0xF7,0x14,0xF7,0x36,0xF7,0xD3,0xF6,0xB3,0xEE,0x15,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x57,0xF7,0x78,0xF7,0x77,0xF7,
-	0x36,0xF7,0x57,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0x79,0xF7,0x99,0xF7,0x78,0xF7,0x16,0xF7,0xD3,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0x15,0xF7,0xF5,0xF6,0x35,0xF7,0x36,0xF7,0x57,0xF7,0x78,0xF7,0xF7,0xDE,0x72,0xBD,0x6B,0x73,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x28,0x4A,0xD1,0x9C,0xB7,0xDE,0x59,0xEF,0x79,0xF7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0x9A,0xF7,0x7A,0xF7,0x9A,0xF7,0x9B,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0xBA,0xF7,0x7A,0xF7,0x9A,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x58,0xF7,0xF3,0xEE,0x58,0xF7,0x15,0xEF,0x57,0xEF,0x58,0xF7,0x57,0xF7,0x56,0xEF,0xCE,0xDD,0x25,0xC4,0xC6,0xDC,0x15,0xEF,0x36,0xF7,0x36,0xF7,0x36,0xF7,0xF4,0xF6,0xF4,0xF6,0x15,0xF7,0xB3,0xEE,0x15,0xEF,0x35,0xF7,0x36,0xF7,0x36,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,
-	0x77,0xF7,0x58,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x56,0xF7,0xF4,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0x90,0xF6,0xB2,0xF6,0xF4,0xF6,0x15,0xF7,0x35,0xF7,0x36,0xF7,0x37,0xF7,0x77,0xF7,0x37,0xEF,0x97,0xDE,0xF1,0xA4,0x69,0x52,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x65,0x29,0xCE,0x7B,0x35,0xCE,0x39,0xEF,0x79,0xF7,0x9A,0xF7,0x7A,0xF7,0x9A,0xF7,0x7A,0xF7,0x9A,0xF7,0x7A,0xF7,0x7A,0xF7,0xBB,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x36,0xF7,0x15,0xF7,0x57,0xF7,0x15,0xF7,0x78,0xF7,0x58,0xF7,0x15,0xEF,0xAB,0xE5,0xB4,0xEE,0xCC,0xE5,0xB2,0xEE,0x36,0xF7,0x36,0xF7,0x15,0xF7,0xD3,0xEE,0x15,0xEF,0xB2,0xF6,0x15,0xF7,0x15,0xF7,0x15,0xF7,0x36,0xF7,0x37,0xF7,0x78,0xF7,0x79,0xF7,0x9A,0xF7,0x9A,0xF7,
-	0x99,0xF7,0x99,0xF7,0x99,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x77,0xF7,0x78,0xF7,0x57,0xF7,0xF5,0xF6,0xD3,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xF4,0xF6,0x15,0xF7,0x36,0xF7,0x36,0xF7,0x57,0xF7,0x78,0xF7,0x18,0xE7,0x35,0xCE,0x2E,0x8C,0xA5,0x31,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0B,0x63,0x73,0xB5,0x18,0xE7,0x79,0xF7,0x7A,0xF7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x7A,0xF7,0x7A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0xBA,0xF7,0x9A,0xF7,0xBA,0xF7,0x9A,0xF7,0x99,0xF7,0x9A,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x36,0xF7,0x58,0xF7,0x78,0xF7,0x16,0xEF,0x77,0xF7,0x15,0xEF,0x15,0xF7,0x57,0xF7,0x78,0xF7,0x58,0xF7,0x56,0xF7,0x16,0xEF,0x96,0xA5,0xD6,0xD6,0x14,0xEF,0x36,0xF7,0x36,0xF7,0x15,0xF7,0x16,0xEF,0xB2,0xF6,0x14,0xEF,0xD3,0xF6,0xD3,0xF6,0x36,0xF7,0x15,0xF7,0x56,0xF7,0x79,0xF7,0x9A,0xF7,0x9A,0xF7,0xBA,0xF7,
-	0x9A,0xF7,0x9A,0xF7,0x99,0xF7,0x78,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0xF5,0xF6,0xD3,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0x90,0xF6,0x91,0xF6,0x91,0xF6,0xD2,0xF6,0xF5,0xF6,0x37,0xF7,0x57,0xF7,0x57,0xF7,0x58,0xF7,0xF7,0xE6,0x92,0xBD,0x2B,0x6B,0x02,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0xC6,0x39,0xB0,0x9C,0x97,0xD6,0x59,0xEF,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBA,0xF7,0xBA,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x57,0xEF,0xD3,0xEE,0x36,0xF7,0x36,0xF7,0xF3,0xF6,0x57,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x17,0xE7,0x10,0x5C,0x36,0xBE,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xEF,0x35,0xEF,0xF4,0xF6,0xB2,0xF6,0x16,0xF7,0xF3,0xF6,0xD3,0xEE,0x57,0xEF,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x56,0xF7,0x15,0xF7,0xF4,0xF6,0xD2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0xB2,0xF6,0x31,0xEE,0xB2,0xF6,0xF4,0xF6,0x16,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xEF,0x96,0xDE,0x11,0xA5,0x48,0x4A,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x23,0x21,0xAD,0x73,0xF4,0xC5,0x39,0xE7,0x7A,0xF7,0xBA,0xF7,0x7A,0xF7,0x9A,0xF7,0x7A,0xF7,0xBB,0xF7,0x7A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x58,0xEF,0xF5,0xEE,0xF4,0xF6,0x58,0xF7,0x57,0xF7,0x78,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x77,0xF7,0x73,0x95,0x10,0x5C,0x91,0x6C,0x37,0xEF,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x15,0xF7,0x15,0xEF,0xD3,0xEE,0x16,0xEF,0x58,0xF7,0x79,0xF7,0x99,0xF7,0x9A,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x14,0xF7,0xD2,0xF6,0xB2,0xF6,0xB2,0xF6,0x91,0xF6,0x91,0xF6,0xB2,0xF6,0xD3,0xF6,0xF5,0xF6,0x56,0xF7,0x57,0xF7,0x57,0xF7,0x37,0xEF,0xF7,0xEE,0x15,0xC6,0xCD,0x7B,0x64,0x29,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x48,0x4A,0x11,0xA5,0xB7,0xD6,0x59,0xEF,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBA,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0xBA,0xF7,0xBA,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xEF,0x58,0xEF,0x16,0xEF,0x56,0xEF,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x99,0xF7,0xD7,0xDE,0x31,0x64,0x50,0x64,0xF0,0x53,0x74,0x9D,0x57,0xEF,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0xF4,0xF6,0x56,0xF7,0x78,0xEF,0x57,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0x9A,0xF7,0xBA,0xF7,0x99,0xF7,0xB9,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x15,0xF7,0xF4,0xF6,0xD3,0xF6,0xB2,0xF6,0xB2,0xF6,0x92,0xF6,0xB2,0xF6,0xD3,0xF6,0x15,0xF7,0x36,0xF7,0x57,0xF7,0x57,0xF7,0x17,0xEF,0xB7,0xDE,0x11,0xAD,0x89,0x52,0xA1,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x44,0x29,0xCD,0x7B,0x36,0xC6,0x18,0xE7,0x7A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBA,0xF7,0x9A,0xF7,0x7A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x9A,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,
-	0x56,0xF7,0x36,0xF7,0x78,0xF7,0x57,0xEF,0xF5,0xEE,0x36,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x9A,0xF7,0xB9,0xF7,0xD1,0x7C,0x30,0x5C,0x50,0x64,0x50,0x64,0x30,0x64,0xB6,0xD6,0x58,0xF7,0x57,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x57,0xF7,0xF5,0xEE,0x15,0xEF,0x57,0xF7,0x78,0xF7,0x36,0xEF,0x79,0xF7,0xBA,0xF7,0xBA,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x9A,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x37,0xF7,0x57,0xF7,0x36,0xF7,0xF5,0xF6,0xF3,0xF6,0xF3,0xF6,0xD4,0xF6,0xD3,0xF6,0xF4,0xF6,0x15,0xF7,0x36,0xF7,0x37,0xF7,0x57,0xF7,0x58,0xF7,0x17,0xE7,0xF4,0xC5,0x4D,0x8C,0x85,0x31,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x89,0x52,0x11,0xA5,0xD8,0xDE,0x59,0xEF,0x9A,0xF7,0xBA,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBB,0xF7,0xBA,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,
-	0x57,0xEF,0xF5,0xEE,0xD3,0xEE,0x36,0xEF,0x57,0xF7,0x77,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0xB9,0xF7,0x79,0xEF,0xF3,0x84,0xAE,0x53,0x50,0x64,0x50,0x64,0x50,0x64,0x30,0x5C,0xCF,0x53,0xD7,0xD6,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0xF3,0xEE,0xD3,0xEE,0xF5,0xEE,0x77,0xEF,0x99,0xF7,0x9A,0xF7,
-	0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x9A,0xF7,0xBA,0xF7,0x99,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x15,0xF7,0xF5,0xF6,0x15,0xF7,0xF4,0xF6,0x15,0xF7,0x36,0xF7,0x57,0xF7,0x77,0xF7,0x78,0xF7,0x37,0xEF,0x96,0xDE,0x51,0xB5,0xEA,0x5A,0xC2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x44,0x29,0xCD,0x7B,0xF4,0xC5,0x18,0xE7,0x7A,0xF7,0xBA,0xF7,0xBA,0xF7,0xBA,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0xBA,0xF7,0x7A,0xF7,0x99,0xF7,0x79,0xF7,
-	0x79,0xF7,0x78,0xF7,0x58,0xEF,0x37,0xF7,0x15,0xEF,0x98,0xEF,0x99,0xF7,0x99,0xF7,0xBA,0xF7,0x7A,0xEF,0xB1,0x74,0x51,0x6C,0xB2,0x7C,0x30,0x5C,0x50,0x64,0x50,0x64,0x2F,0x6C,0xEF,0xAC,0x8E,0x43,0x97,0xCE,0x57,0xF7,0x37,0xF7,0x57,0xF7,0x57,0xF7,0x16,0xF7,0xF3,0xEE,0x15,0xF7,0x56,0xEF,0xB2,0xEE,0xD3,0xEE,0x79,0xF7,0xB9,0xF7,
-	0x9A,0xF7,0x9A,0xF7,0xBA,0xF7,0x9A,0xF7,0xB9,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x36,0xF7,0x57,0xF7,0x78,0xF7,0x78,0xF7,0x58,0xF7,0x18,0xE7,0xF5,0xBD,0x0D,0x8C,0xC6,0x39,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x49,0x4A,0x54,0xA5,0xBA,0xD6,0x5D,0xEF,0xDE,0xF7,0x3C,0xE7,0xBA,0xD6,0x14,0xA5,0xC7,0x39,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0F,0x7C,0x50,0x84,0x50,0x84,0xAE,0x73,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x68,0x52,0xD1,0x9C,0x97,0xD6,0x59,0xEF,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x9A,0xF7,0x9A,0xF7,0x16,0xEF,0x57,0xEF,
-	0x79,0xF7,0x79,0xF7,0x36,0xF7,0x36,0xEF,0x58,0xF7,0x99,0xF7,0x7A,0xF7,0xBA,0xF7,0x79,0xF7,0x38,0xE7,0xD7,0xD6,0x99,0xE7,0x31,0x64,0x30,0x5C,0x50,0x64,0x30,0x5C,0x0F,0x64,0x55,0xBE,0x58,0xE7,0x96,0xD6,0x57,0xF7,0x57,0xF7,0x37,0xF7,0x57,0xF7,0x56,0xF7,0x15,0xF7,0xF4,0xEE,0x30,0xE6,0xE6,0xDC,0x06,0xDD,0x14,0xF7,0x9A,0xF7,
-	0x99,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x38,0xEF,0x76,0xDE,0xF1,0xA4,0x89,0x52,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xBA,0xD6,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x44,0x29,0x6B,0x73,0xB4,0xB5,0x18,0xE7,0x9A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBC,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0xB3,0xE6,0xAD,0xDD,0x0F,0xE6,
-	0x36,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xEF,0x78,0xF7,0x99,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x59,0xEF,0x93,0x7C,0xEF,0x53,0xF0,0x53,0x30,0x5C,0x70,0x4B,0x0D,0x9D,0xAE,0x53,0x76,0xCE,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x36,0xF7,0x36,0xEF,0x14,0xEF,0x36,0xF7,0x56,0xF7,0xAE,0xDD,0xAE,0xDD,0xB9,0xF7,0x99,0xF7,
-	0x78,0xF7,0x78,0xF7,0x56,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x58,0xF7,0x77,0xF7,0x57,0xF7,0x77,0xF7,0x58,0xF7,0x78,0xF7,0x99,0xF7,0x79,0xF7,0xD8,0xDE,0x94,0xBD,0x8C,0x73,0x85,0x31,0x40,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xB2,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xAE,0x73,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x91,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x08,0xE7,0x39,0x2E,0x8C,0x56,0xCE,0x39,0xE7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0x9B,0xF7,0x9A,0xF7,0x79,0xF7,0x9A,0xF7,0xBB,0xF7,0x78,0xEF,0xE5,0xE4,0xCD,0xE5,
-	0xB9,0xF7,0xBA,0xF7,0x79,0xF7,0x79,0xF7,0x78,0xF7,0x99,0xF7,0x9A,0xF7,0x9A,0xF7,0x79,0xF7,0x18,0xDF,0xD2,0x84,0xB0,0x53,0xD0,0x53,0xF0,0x53,0xB0,0x53,0xEE,0x9C,0xD0,0x53,0xD0,0x53,0x6F,0x4B,0x36,0xBE,0x58,0xEF,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x36,0xEF,0x57,0xF7,0x77,0xF7,0x78,0xF7,0xD7,0xCE,0xD7,0xD6,0xB9,0xF7,0x79,0xF7,
-	0x99,0xF7,0x57,0xF7,0x57,0xF7,0x58,0xF7,0x57,0xEF,0x98,0xF7,0x99,0xF7,0x79,0xF7,0x77,0xF7,0x36,0xF7,0x36,0xF7,0x57,0xF7,0x57,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0x79,0xF7,0x38,0xE7,0x56,0xCE,0xAE,0x94,0x27,0x42,0xA1,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xF7,0xBD,0xB6,0xB5,0x38,0xC6,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xA9,0x52,0x12,0xA5,0xD7,0xD6,0x5A,0xEF,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0x9A,0xF7,0x79,0xF7,0xBA,0xF7,0xBB,0xF7,0x59,0xEF,0xD4,0xE6,0xD4,0xE6,
-	0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x58,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0x59,0xEF,0x74,0x9D,0x8F,0x4B,0x6F,0x4B,0xD0,0x53,0xB0,0x53,0xD0,0x53,0x6E,0x7C,0xEF,0x6B,0xD0,0x53,0xD0,0x53,0x8F,0x4B,0x6F,0x4B,0x72,0x74,0x96,0xCE,0x56,0xF7,0x57,0xF7,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0xF3,0x84,0x53,0x95,0x99,0xF7,0x99,0xF7,
-	0x79,0xF7,0x79,0xF7,0x57,0xF7,0x56,0xF7,0x78,0xEF,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x57,0xF7,0x36,0xF7,0x36,0xF7,0x56,0xF7,0x77,0xF7,0x58,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x7A,0xF7,0x59,0xEF,0xB7,0xD6,0x12,0xAD,0xEA,0x62,0xE2,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x42,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x50,0x84,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xA6,0x31,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x21,0x4B,0x6B,0x94,0xB5,0xD8,0xD6,0x59,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBC,0xF7,0x9B,0xF7,0x79,0xF7,0x9A,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x94,0x9D,0xB7,0xCE,
-	0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0x79,0xF7,0x59,0xEF,0x16,0xBE,0x54,0x95,0x71,0x6C,0xB0,0x4B,0xF0,0x5B,0x30,0x64,0x8F,0x53,0x6E,0x4B,0xAD,0x94,0x8F,0x53,0xB0,0x53,0xF0,0x53,0x92,0x74,0x6F,0x43,0x10,0x5C,0xF3,0x84,0x94,0x9D,0xF8,0xE6,0x79,0xF7,0x78,0xF7,0x79,0xF7,0x35,0xBE,0x50,0x64,0x50,0x64,0xB7,0xCE,0x79,0xF7,
-	0x79,0xF7,0x79,0xF7,0x58,0xF7,0x57,0xF7,0x78,0xF7,0x99,0xF7,0x79,0xF7,0x78,0xF7,0x57,0xF7,0x36,0xF7,0x37,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x99,0xF7,0x9A,0xF7,0x59,0xEF,0xB7,0xD6,0x93,0xBD,0xEC,0x7B,0x64,0x29,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x69,0x4A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x5A,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC6,0x31,0x2F,0x84,0xF4,0xC5,0x18,0xE7,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9B,0xF7,0x9A,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xF8,0xDE,0x50,0x64,0xF3,0x84,
-	0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBA,0xF7,0x59,0xF7,0x79,0xEF,0x59,0xEF,0x57,0xC6,0x95,0xA5,0xB7,0xCE,0x95,0xA5,0x6F,0x4B,0x8F,0x53,0x0D,0x9D,0x50,0x43,0x90,0x4B,0xB0,0x53,0x90,0x4B,0xF0,0x5B,0xB7,0xD6,0xF4,0xB5,0xB5,0xAD,0x59,0xEF,0x58,0xEF,0x79,0xF7,0x78,0xF7,0xF7,0xDE,0x91,0x6C,0x50,0x64,0x50,0x64,0xB1,0x74,0xF8,0xDE,
-	0x78,0xF7,0x78,0xF7,0x78,0xF7,0x58,0xF7,0x57,0xF7,0x37,0xF7,0x78,0xF7,0x78,0xF7,0x37,0xF7,0x57,0xF7,0x37,0xF7,0x77,0xF7,0x78,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x59,0xEF,0x18,0xE7,0x15,0xBE,0x2E,0x8C,0x28,0x4A,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x91,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x75,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x85,0x29,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x10,0x68,0x52,0x4F,0x8C,0x36,0xC6,0x39,0xE7,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9B,0xF7,0x9A,0xF7,0x99,0xF7,0x7A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xEF,0x33,0x8D,0x50,0x64,0x50,0x64,
-	0xF6,0xB5,0x9A,0xEF,0xBB,0xF7,0x9A,0xF7,0x9A,0xF7,0x78,0xF7,0x58,0xF7,0x79,0xF7,0x79,0xEF,0x34,0x8D,0xCE,0x32,0x0F,0x5C,0xAE,0x9C,0xEF,0x32,0x90,0x4B,0x50,0x43,0x90,0x4B,0x90,0x4B,0x6F,0x4B,0xEF,0x53,0x18,0xE7,0x37,0xF7,0x57,0xEF,0x79,0xF7,0x79,0xF7,0x58,0xEF,0x54,0x95,0x71,0x6C,0x50,0x64,0x50,0x64,0xB0,0x84,0x74,0xA5,
-	0x38,0xEF,0x78,0xF7,0x78,0xF7,0x57,0xF7,0x37,0xF7,0x78,0xF7,0x77,0xF7,0x37,0xF7,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0x79,0xEF,0x18,0xE7,0x15,0xC6,0x90,0x9C,0x89,0x52,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x3A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x94,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x89,0x52,0xB0,0x94,0x77,0xCE,0x39,0xE7,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9B,0xF7,0x9A,0xF7,0x59,0xF7,0x79,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x94,0x9D,0x50,0x64,0x50,0x64,0x50,0x64,
-	0x70,0x6C,0x97,0xC6,0x9A,0xF7,0x9A,0xF7,0x7A,0xF7,0x58,0xF7,0x57,0xEF,0x59,0xF7,0x39,0xEF,0xF2,0x8C,0x0F,0x6C,0xCF,0x63,0x2F,0x3B,0x50,0x43,0x50,0x43,0x50,0x43,0x70,0x4B,0x30,0x43,0x30,0x43,0xB0,0x4B,0x97,0xD6,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x79,0xF7,0x79,0xEF,0x97,0xCE,0x70,0x64,0xF0,0x53,0x50,0x64,0xCF,0x8C,0xB6,0xD6,
-	0x58,0xEF,0x78,0xF7,0x78,0xF7,0x77,0xF7,0x57,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xF7,0x36,0xF7,0x36,0xF7,0x57,0xF7,0x57,0xF7,0x78,0xF7,0x99,0xF7,0x59,0xEF,0x18,0xE7,0x56,0xCE,0x10,0xA5,0xA9,0x5A,0x03,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xCE,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x18,0xA9,0x5A,0xD1,0x9C,0x76,0xCE,0x39,0xE7,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9B,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xD8,0xD6,0xF6,0xB5,0x91,0x74,0x50,0x64,0x50,0x64,
-	0x52,0xAD,0x36,0xC6,0x7A,0xEF,0x9A,0xF7,0xBA,0xF7,0x79,0xF7,0x99,0xEF,0x37,0xEF,0x92,0x8C,0x2D,0x7C,0x0F,0x3B,0x0F,0x3B,0x70,0x4B,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xEF,0x32,0xCF,0x32,0x14,0xBE,0x79,0xEF,0x7A,0xF7,0x79,0xEF,0x76,0xC6,0x51,0x64,0xF0,0x5B,0xD0,0x53,0x8E,0x7C,0xF0,0x5B,0x51,0x64,
-	0x97,0xCE,0x37,0xEF,0x77,0xF7,0x77,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x57,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x59,0xEF,0x18,0xE7,0x56,0xCE,0xF1,0xA4,0xCA,0x5A,0x03,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x44,0x21,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x24,0x21,0xEB,0x62,0xF1,0xA4,0x77,0xCE,0x39,0xE7,0x7A,0xEF,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x9A,0xF7,0xBB,0xF7,0xBB,0xF7,0xBB,0xF7,0x7A,0xEF,0x33,0x8D,0xF0,0x5B,0xF0,0x53,0x50,0x64,
-	0x70,0x6C,0x36,0xC6,0x9A,0xF7,0x9A,0xF7,0xBA,0xF7,0x99,0xF7,0x79,0xEF,0x14,0x9D,0xED,0x3A,0x10,0x3B,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0xCF,0x32,0x6E,0x84,0x59,0xEF,0x78,0xCE,0x94,0x9D,0x10,0x5C,0xF0,0x5B,0xB0,0x53,0xEF,0x5B,0x0F,0x64,0xD0,0x53,0x10,0x5C,
-	0x31,0x64,0xB4,0xA5,0xB6,0xD6,0x37,0xEF,0x57,0xF7,0x57,0xF7,0x77,0xF7,0x77,0xF7,0x78,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0x79,0xEF,0x18,0xE7,0x56,0xCE,0x12,0xAD,0x2B,0x6B,0x24,0x21,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x5B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xA6,0x31,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x0C,0x63,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x44,0x21,0x0B,0x6B,0xD1,0x9C,0x76,0xCE,0x39,0xE7,0x7A,0xEF,0xBB,0xF7,0xBC,0xF7,0xBB,0xF7,0xBC,0xF7,0x9B,0xF7,0x5B,0xE7,0xB9,0xCE,0x91,0x74,0xF0,0x5B,0xF0,0x5B,0xEF,0x5B,0x6E,0x7C,
-	0xB0,0x53,0xD0,0x53,0x54,0x95,0xF9,0xDE,0x9A,0xEF,0x7A,0xEF,0x95,0x9D,0x8F,0x2A,0x0F,0x3B,0xEF,0x32,0x0F,0x3B,0xEF,0x32,0x0F,0x3B,0x0F,0x3B,0x0F,0x3B,0x0F,0x3B,0x0F,0x3B,0x0F,0x3B,0x0F,0x3B,0xCF,0x32,0x6F,0x53,0x2F,0x4B,0x50,0x4B,0xF9,0xDE,0x16,0xBE,0xD5,0xAD,0x51,0x6C,0x30,0x5C,0x2E,0x74,0x90,0x4B,0x90,0x4B,0x92,0x74,
-	0xD5,0xAD,0x16,0xBE,0x57,0xF7,0x37,0xF7,0x57,0xF7,0x77,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xF7,0x79,0xEF,0x18,0xE7,0x56,0xCE,0xF1,0xA4,0x4B,0x6B,0x85,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xB2,0x94,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x24,0x21,0xA9,0x5A,0xB1,0x9C,0x57,0xCE,0xF9,0xDE,0x7A,0xEF,0x9B,0xF7,0xBC,0xF7,0xBC,0xF7,0x9B,0xEF,0xD9,0xDE,0x34,0x95,0xB3,0x7C,0x51,0x64,0xF0,0x5B,0xEF,0x6B,0xAF,0x53,
-	0xD0,0x53,0xD3,0x84,0x92,0x74,0xF7,0xB5,0x58,0xC6,0x10,0x4B,0x2E,0x1A,0x0F,0x3B,0xCF,0x32,0xEF,0x32,0xCF,0x32,0xEF,0x32,0xCF,0x32,0xCF,0x32,0xEF,0x3A,0xEF,0x3A,0xCF,0x32,0xCF,0x32,0x0F,0x3B,0xCF,0x32,0x2F,0x43,0x2F,0x43,0xAF,0x2A,0x4D,0x2A,0x34,0x95,0x34,0x8D,0x2E,0x74,0xB0,0x53,0x50,0x43,0x50,0x43,0x50,0x43,0x50,0x43,
-	0x54,0x95,0x58,0xEF,0x58,0xF7,0x57,0xF7,0x77,0xF7,0x78,0xF7,0x79,0xF7,0xB9,0xF7,0x99,0xF7,0x99,0xF7,0x59,0xEF,0x18,0xE7,0x56,0xCE,0x10,0xA5,0xEA,0x5A,0x85,0x31,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x7C,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x95,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xE3,0x18,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x03,0x21,0x89,0x52,0x4F,0x8C,0xF5,0xC5,0xD8,0xD6,0x3B,0xE7,0x9B,0xEF,0xBB,0xF7,0xBB,0xF7,0x7A,0xEF,0x5A,0xEF,0x94,0x9D,0x0F,0x64,0xCF,0x63,0x90,0x4B,0x90,0x4B,
-	0x90,0x4B,0xF0,0x5B,0xB9,0xD6,0xD4,0x8C,0x10,0x3B,0x35,0x95,0x11,0x64,0xAF,0x2A,0x8E,0x2A,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xAF,0x2A,0xCF,0x32,0x8E,0x9C,0xAF,0x32,0x6E,0x2A,0xB5,0xA5,0xB0,0x32,0x70,0x4B,0x34,0x95,0x11,0x64,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,
-	0x70,0x43,0x94,0xAD,0x58,0xEF,0x78,0xF7,0x78,0xF7,0x78,0xF7,0x99,0xF7,0x99,0xF7,0x79,0xF7,0x38,0xE7,0xD8,0xDE,0xF5,0xBD,0x90,0x9C,0xA9,0x5A,0x03,0x21,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE2,0x18,0x07,0x42,0x2F,0x8C,0xB4,0xBD,0x97,0xD6,0x1A,0xE7,0x5A,0xEF,0xBB,0xF7,0xBC,0xF7,0xD8,0xD6,0x70,0x74,0x8E,0x5B,0x50,0x43,0x30,0x43,0x30,0x43,
-	0x30,0x43,0x50,0x43,0xD3,0x84,0xF9,0xD6,0x9B,0xEF,0xD9,0xD6,0xB4,0x84,0xF1,0x63,0xAF,0x32,0xF4,0x8C,0x8F,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0x6F,0x22,0x90,0xAD,0x53,0x74,0x6F,0x22,0xB6,0xA5,0x75,0x9D,0x11,0x64,0x71,0x4B,0x70,0x4B,0x70,0x4B,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,
-	0x4F,0x43,0xB0,0x5B,0x77,0xCE,0x78,0xF7,0x79,0xF7,0x79,0xF7,0x99,0xF7,0x59,0xEF,0x39,0xE7,0xB7,0xD6,0x93,0xBD,0x2E,0x94,0x89,0x52,0x03,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x8D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x07,0x42,0x8C,0x7B,0x33,0xA5,0x36,0xCE,0x19,0xDF,0x5A,0xEF,0xD8,0xD6,0x30,0x74,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,0x30,0x43,
-	0x30,0x43,0x30,0x43,0x2F,0x43,0xD2,0x94,0x9B,0xEF,0x7A,0xEF,0x9B,0xEF,0xF7,0xB5,0x5A,0xE7,0x70,0x4B,0x6F,0x22,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0x8F,0x22,0xEE,0x3A,0xCD,0x4A,0x58,0xC6,0xB5,0xA5,0x96,0xA5,0xF3,0x63,0x91,0x53,0xCF,0x32,0xEF,0x3A,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,
-	0x0E,0x43,0x2F,0x43,0x50,0x43,0xD6,0xAD,0xF8,0xDE,0x59,0xEF,0x59,0xEF,0xF8,0xE6,0x35,0xCE,0x12,0xAD,0xEC,0x7B,0x48,0x4A,0xE3,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x64,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xB5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x44,0x29,0xCA,0x5A,0x90,0x94,0xB4,0xBD,0x57,0xCE,0x32,0x6C,0xEF,0x32,0xEF,0x32,0x0F,0x3B,0xCF,0x32,0x0F,0x3B,0xCF,0x32,
-	0x0F,0x3B,0xCF,0x32,0x6F,0x4B,0x6F,0x4B,0x34,0x8D,0x7B,0xEF,0xBC,0xF7,0xBC,0xF7,0xB1,0x53,0x2E,0x1A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0x8F,0x22,0xCF,0x09,0xEE,0x73,0x6E,0x2A,0x4E,0x1A,0x17,0xB6,0x99,0xCE,0x74,0x7C,0x4F,0x43,0x71,0x4B,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xCF,0x32,
-	0xEF,0x6B,0x71,0x53,0x94,0x7C,0x76,0xC6,0xB8,0xD6,0xF8,0xDE,0x76,0xD6,0x94,0xBD,0xAE,0x94,0x0B,0x63,0x85,0x31,0xA1,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x63,0x00,0xA6,0x08,0xA6,0x00,0x86,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xD3,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x89,0x52,0x72,0x84,0xB0,0x5B,0x2F,0x3B,0xCF,0x32,0xEF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,0xCF,0x32,
-	0xCF,0x32,0xCF,0x32,0x8F,0x53,0x0F,0x3B,0xD1,0x5B,0xF5,0x8C,0x78,0xC6,0x91,0x53,0xCE,0x11,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x2F,0x1A,0x4E,0x94,0x6F,0x22,0x4F,0x1A,0x4E,0x1A,0x0E,0x12,0x17,0xBE,0x79,0xEF,0x37,0xBE,0x90,0x53,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xEE,0x3A,
-	0x71,0x6C,0x36,0xBE,0x59,0xEF,0x18,0xE7,0xB7,0xD6,0xF5,0xBD,0xF1,0xA4,0x8C,0x7B,0x28,0x4A,0x03,0x21,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA7,0x08,0x63,0x00,0x63,0x00,0x65,0x00,0xA6,0x00,0x64,0x00,0x00,0x00,0xD6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x84,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xD7,0x5B,0x52,0x22,0xC6,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x19,0xE7,0x39,0xAD,0x73,0xB2,0x94,0xF2,0x63,0x70,0x4B,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,0xAF,0x2A,
-	0xAF,0x2A,0x0E,0x43,0xB2,0x94,0xD4,0x84,0x78,0xC6,0x17,0xB6,0x30,0x43,0xEE,0x11,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x0F,0x1A,0x8F,0x09,0x6E,0x9C,0x4E,0x2A,0x4F,0x1A,0x4F,0x22,0x4F,0x22,0x2E,0x1A,0x0F,0x1A,0x35,0x95,0x55,0x9D,0x6F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0xAE,0x32,0xEE,0x42,
-	0x6F,0x22,0x33,0x6C,0x97,0xD6,0xF4,0xC5,0x33,0xAD,0xEE,0x83,0xCA,0x5A,0xA6,0x31,0xA2,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA8,0x00,0xCB,0x08,0xCA,0x00,0x86,0x00,0x85,0x00,0x83,0x00,0x63,0x00,0x14,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0B,0x5B,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF4,0x9C,0xD5,0x2A,0x98,0x22,0x54,0x22,0x13,0x1A,0x0C,0x09,0x86,0x00,0x22,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xA2,0x10,0x28,0x42,0x8F,0x5B,0xAF,0x2A,0x8F,0x2A,0x8F,0x2A,0x8F,0x2A,0x8F,0x2A,
-	0xAF,0x2A,0x4F,0x4B,0x70,0x4B,0xFA,0xDE,0x9C,0xF7,0xD9,0xCE,0xF1,0x42,0x0E,0x12,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x0F,0x1A,0x6E,0x2A,0xEE,0x73,0x6F,0x22,0x4F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x0F,0x1A,0x73,0x74,0xF0,0x3A,0x4F,0x22,0x2F,0x1A,0x2F,0x1A,0x4E,0x22,0x8E,0x2A,0xEE,0x3A,0x4F,0x22,
-	0x2F,0x1A,0x2F,0x1A,0x90,0x53,0x70,0x8C,0xEA,0x5A,0xC6,0x39,0xC2,0x10,0x60,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xAB,0x00,0xCD,0x08,0xCD,0x08,0xCE,0x08,0x0D,0x09,0xAC,0x08,0x85,0x00,0x30,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xC7,0x39,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x72,0x8C,0x95,0x84,0x75,0x84,0x54,0x84,0x75,0x84,0x34,0x7C,0x13,0x7C,0xF1,0x7B,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x30,0x84,0xCF,0x7B,0xCF,0x7B,0x2C,0x63,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x6B,0x32,0x6F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x4F,0x22,0x8F,0x22,
-	0xCF,0x32,0x8F,0x2A,0x4F,0x22,0x91,0x53,0x76,0xA5,0xEF,0x19,0xEE,0x11,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0xAF,0x09,0xCE,0x7B,0x2E,0x53,0x4E,0x2A,0x0F,0x12,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x0F,0x1A,0xAE,0x09,0xB0,0x32,0x30,0x43,0x2F,0x1A,0x2F,0x1A,0x2E,0x4B,0x6E,0x22,0x4F,0x1A,0x2F,0x1A,
-	0x2F,0x1A,0x2F,0x1A,0x6F,0x2A,0x4E,0x5B,0xE2,0x18,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x87,0x00,0x89,0x00,0xA9,0x00,0xA9,0x00,0xCB,0x08,0xCA,0x08,0xA9,0x00,0x0C,0x5B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x84,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x86,0x31,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x8F,0x3A,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xE5,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x52,0x8F,0x2A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x6E,0x22,0xCF,0x32,
-	0xAE,0x3A,0xD0,0x32,0x11,0x43,0x30,0x4B,0xEF,0x19,0xEF,0x11,0xEF,0x11,0xEF,0x11,0x0F,0x12,0xCF,0x11,0x4E,0x2A,0x2F,0x22,0x4E,0x94,0x8E,0x2A,0x2F,0x1A,0xEF,0x11,0x0F,0x1A,0x0F,0x12,0x0F,0x1A,0x0F,0x12,0x0F,0x12,0x0F,0x12,0x0F,0x12,0x0F,0x12,0xCF,0x11,0x90,0x32,0x92,0x5B,0x8F,0x5B,0x8F,0x2A,0x0F,0x12,0x0F,0x12,0x0F,0x12,
-	0x0F,0x12,0x0F,0x12,0xCF,0x11,0x2F,0x1A,0xCB,0x4A,0x45,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x67,0x00,0xF0,0x08,0xF6,0x11,0x6F,0x09,0x4A,0x09,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x85,0x00,0x87,0x00,0xA7,0x00,0xA7,0x00,0x67,0x00,0x68,0x00,0xA9,0x00,0x08,0x11,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xAD,0x21,0x00,0x22,0x00,0x42,0x00,0x41,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x2E,0x2A,
-	0x09,0x09,0x20,0x00,0x00,0x00,0xAA,0x00,0x98,0x4B,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xAF,0x21,0xCB,0x00,0x43,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x23,0x00,0x47,0x00,0x48,0x00,0x46,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC7,0x29,0x4E,0x22,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x2F,0x1A,0x8F,0x22,0x2E,0x4B,0x4E,0x1A,
-	0x71,0x4B,0x74,0x7C,0x92,0x5B,0x72,0x53,0x52,0x53,0xEE,0x11,0xAD,0x11,0x6F,0x5B,0x6E,0x2A,0x0D,0x7C,0x8E,0x3A,0xAF,0x32,0xCF,0x19,0xEF,0x11,0xCF,0x09,0xCF,0x11,0xEF,0x11,0xCF,0x11,0xCF,0x11,0xEF,0x11,0xCF,0x11,0x8F,0x2A,0xCE,0x11,0x6E,0x09,0xCE,0x11,0x33,0x74,0x70,0x32,0x34,0x74,0x53,0x74,0x0F,0x1A,0xCF,0x11,0xCF,0x11,
-	0xCF,0x11,0xEF,0x11,0x8E,0x32,0xCF,0x11,0x8C,0x32,0x24,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x00,0x49,0x00,0x6A,0x00,0x69,0x00,0x89,0x00,0xA7,0x08,0xE7,0x08,0xE7,0x08,0x0A,0x09,0x4E,0x09,0x51,0x11,0x4F,0x09,0xB1,0x11,0x35,0x1A,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x84,0x00,0x85,0x00,0x65,0x00,0x65,0x00,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x66,0x21,0x41,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0xA2,0x10,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3B,0xBE,0x36,0x1A,
-	0x35,0x1A,0xD1,0x11,0x2E,0x09,0xD0,0x11,0x93,0x3A,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xCE,0x21,0x4E,0x09,0x2C,0x09,0xE8,0x08,0x08,0x09,
-	0xCA,0x08,0x0A,0x09,0x8A,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x46,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x18,0x0C,0x53,0x0D,0x4B,0x4E,0x22,0x2F,0x1A,0x6E,0x32,0x4E,0x22,0x0D,0x53,0x6F,0x22,0xEF,0x11,0xEF,0x11,
-	0x0F,0x12,0xCF,0x11,0xD0,0x3A,0xD0,0x32,0xCA,0x62,0x0E,0x4B,0xF3,0xC5,0x0F,0x7C,0x4D,0x22,0x4F,0x22,0x6F,0x01,0xAF,0x09,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xAE,0x09,0xCF,0x19,0x34,0x9D,0x11,0x43,0x6E,0x19,0xAE,0x11,0x10,0x3B,0xEF,0x11,0xCF,0x11,0xCF,0x11,0xAF,0x09,0xAF,0x09,
-	0xAF,0x09,0x4E,0x2A,0xCD,0x42,0x8A,0x52,0x49,0x3A,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x88,0x00,0x6B,0x00,0x6B,0x00,0xAA,0x00,0xAB,0x00,0x29,0x09,0x4C,0x11,0x2B,0x09,0x4D,0x11,0x4E,0x09,0x4F,0x09,0x71,0x11,0x73,0x11,0x73,0x11,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0xA6,0x00,0x85,0x00,0x64,0x00,0x4C,0x63,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x0C,0x5B,0x63,0x00,0x42,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x51,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8E,0x6B,0x86,0x00,
-	0xA8,0x00,0xAB,0x00,0x2F,0x09,0x96,0x11,0xF7,0x19,0x38,0x4B,0x39,0x4B,0x39,0x4B,0xF5,0x4A,0xF5,0x4A,0xD4,0x42,0xD4,0x42,0xD4,0x42,0xD1,0x42,0xF0,0x42,0xF2,0x4A,0xCF,0x42,0xAD,0x42,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x33,0x53,0x15,0x4B,0x15,0x4B,0xB4,0x42,0x50,0x09,0x2F,0x09,0x2F,0x09,0x2D,0x09,0x0A,0x09,
-	0xCA,0x08,0x0A,0x09,0x2B,0x09,0x0A,0x09,0x8A,0x00,0x6A,0x00,0x69,0x00,0x6B,0x00,0x6A,0x00,0x48,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE8,0x39,0xAD,0x42,0x2D,0x53,0x8E,0x3A,0x2E,0x2A,0x0E,0x1A,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,
-	0xCF,0x11,0xCF,0x11,0xF3,0x63,0xEE,0x42,0x10,0x7C,0x53,0x7C,0xEF,0x29,0x6E,0x09,0xAF,0x09,0xAF,0x09,0xCF,0x11,0xAF,0x09,0xCF,0x11,0xAF,0x09,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xCF,0x11,0xAF,0x09,0x4F,0x01,0x8D,0x3A,0x92,0x5B,0x90,0x32,0xCF,0x11,0x71,0x4B,0x50,0x2A,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,
-	0xCF,0x11,0x4E,0x2A,0xAF,0x09,0xEE,0x11,0x87,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0xCA,0x08,0x0B,0x09,0x4C,0x11,0x4D,0x09,0x4C,0x09,0x4E,0x09,0x4E,0x11,0x4F,0x09,0x50,0x09,0x4F,0x11,0x73,0x11,0x95,0x11,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x00,0x86,0x00,0x86,0x00,0x86,0x00,0x89,0x21,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x05,0x19,0x63,0x00,0x64,0x00,0x63,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x45,0x21,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x44,0x00,0x8A,0x00,0xCD,0x00,0x30,0x09,0x52,0x09,0x52,0x09,0x73,0x09,0x31,0x09,0x4E,0x09,0x2D,0x09,0x0C,0x09,0xE7,0x08,0x85,0x00,0xA5,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xD2,0x21,0x72,0x11,0x95,0x11,0x51,0x09,0x4F,0x09,0x10,0x09,0x4E,0x09,0x2E,0x09,0x4E,0x09,
-	0x4E,0x09,0x0D,0x09,0x2C,0x09,0x0C,0x09,0x0B,0x09,0xE9,0x08,0x8A,0x00,0x6B,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x45,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x08,0x6D,0x32,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,
-	0xAF,0x09,0xAF,0x09,0xAF,0x09,0xF0,0x3A,0x51,0x4B,0x0C,0x09,0x8E,0x01,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0x6F,0x01,0xED,0x83,0x4F,0x22,0xED,0x08,0x2F,0x32,0x91,0x32,0x8F,0x09,0x8F,0x09,0x8E,0x09,0x8E,0x09,0x6E,0x09,0x6E,0x09,
-	0x0E,0x2A,0xAE,0x11,0x8E,0x09,0x8E,0x09,0xCF,0x11,0x8D,0x3A,0xE2,0x18,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x00,0x22,0x00,0x45,0x00,0x6A,0x00,0x6B,0x00,0x8B,0x00,0xAB,0x00,0x09,0x09,0x29,0x09,0xE8,0x08,0x08,0x09,0x2B,0x09,0x4E,0x11,0x4E,0x11,0x6F,0x09,0x50,0x09,0x50,0x11,0x2C,0x09,0x2D,0x09,0x2E,0x09,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x08,0xAD,0x08,0xCE,0x08,0x0F,0x09,0x2F,0x09,0x0E,0x09,0xCB,0x08,0xD4,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xBE,0x67,0x21,0x64,0x00,0x64,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x86,0x29,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xEB,0x5A,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x44,0x00,0x65,0x00,0x64,0x00,0x43,0x00,0x43,0x00,0x42,0x00,0x42,0x00,0x21,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xAD,0x19,0x0D,0x09,0x0E,0x09,0x0D,0x09,0x2E,0x09,0x2E,0x09,0x2F,0x09,0x50,0x09,0x50,0x11,
-	0x2E,0x09,0x2D,0x09,0x09,0x09,0xA6,0x08,0x86,0x08,0xE7,0x00,0x09,0x09,0xEA,0x08,0xC8,0x08,0xC9,0x08,0x69,0x00,0x69,0x00,0x69,0x00,0x47,0x00,0x67,0x00,0xE8,0x08,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0x39,0xCD,0x19,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0xAF,0x09,0x8E,0x09,0xAF,0x09,0x8E,0x09,
-	0xAF,0x09,0x8E,0x09,0x72,0x53,0x70,0x3A,0x0D,0x09,0x8E,0x09,0xAF,0x09,0xAF,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x0E,0x09,0x2E,0x53,0x0E,0x3A,0x8F,0x09,0x8F,0x09,0x4E,0x01,0x4D,0x19,0x52,0x4B,0xCF,0x11,0x6E,0x01,0x6E,0x01,0x6E,0x09,0xAE,0x3A,
-	0xCE,0x11,0x6E,0x01,0x6E,0x01,0x6E,0x01,0xAE,0x11,0xAD,0x3A,0x04,0x21,0x00,0x00,0x63,0x00,0x6A,0x09,0x6D,0x11,0x2E,0x09,0x6A,0x00,0xAA,0x00,0x0E,0x09,0x2C,0x09,0x29,0x09,0xA6,0x00,0x44,0x00,0x44,0x00,0xA5,0x08,0xC5,0x08,0x09,0x09,0x2D,0x09,0x4D,0x09,0x2A,0x09,0x4C,0x11,0x4E,0x11,0x4F,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAB,0x00,0xAC,0x00,0xAD,0x00,0x0F,0x09,0x08,0x11,0x58,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x91,0x8C,0x6A,0x42,0x0A,0x3A,0x4A,0x42,0xD2,0x94,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xA3,0x10,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x41,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x43,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x8B,0x19,0x2F,0x09,0x50,0x09,0x2D,0x09,0xEC,0x08,0x0C,0x09,0xEA,0x08,0x2C,0x09,0xEB,0x08,
-	0x2C,0x09,0xC7,0x08,0xA5,0x08,0x84,0x00,0x64,0x00,0x23,0x00,0x64,0x00,0xA5,0x08,0x08,0x09,0x2B,0x09,0x4D,0x09,0xCC,0x00,0xAA,0x00,0x0F,0x09,0xD0,0x19,0x8B,0x11,0xAC,0x11,0x29,0x09,0x84,0x00,0x42,0x00,0x21,0x00,0xA9,0x4A,0x4E,0x22,0xCE,0x11,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x8E,0x09,0x6E,0x09,0x8F,0x09,
-	0xF1,0x3A,0x93,0x5B,0x6E,0x19,0x4D,0x19,0x8E,0x09,0x6E,0x09,0x6E,0x09,0x6E,0x09,0x8E,0x09,0x6E,0x09,0x8E,0x09,0x8E,0x09,0x6E,0x09,0x6E,0x09,0xAF,0x09,0x6E,0x09,0x8E,0x09,0x8E,0x09,0x4E,0x09,0x2E,0x2A,0xAE,0x3A,0x8E,0x19,0x6F,0x01,0x6E,0x09,0x8E,0x09,0x8F,0x09,0x4D,0x19,0xD1,0x42,0x92,0x5B,0x2F,0x22,0x4D,0x32,0x8E,0x09,
-	0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6F,0x01,0x70,0x11,0x6F,0x2A,0x4F,0x32,0xAE,0x11,0xAA,0x11,0x4C,0x11,0xEF,0x19,0x8D,0x11,0x70,0x11,0x2D,0x09,0x09,0x09,0xA5,0x08,0xA6,0x00,0xC7,0x08,0x29,0x09,0x2A,0x09,0x2C,0x09,0x4F,0x09,0x2C,0x09,0x4E,0x11,0x4F,0x11,0x4F,0x09,0x0D,0x09,0xEA,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x00,0x87,0x00,0xA8,0x00,0x87,0x00,0xA7,0x00,0xA7,0x00,0x87,0x00,0x87,0x00,0xAA,0x29,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0x25,0x19,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x22,0x00,0x41,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x18,0x22,0x00,0x64,0x00,0x0F,0x09,0xED,0x08,0x2E,0x09,0x2D,0x09,0x0D,0x09,0x2D,0x09,
-	0x0C,0x09,0x0E,0x09,0x2C,0x09,0x0B,0x09,0x2A,0x09,0x0B,0x09,0xC9,0x00,0xC7,0x08,0x84,0x08,0xE8,0x08,0x10,0x09,0x50,0x11,0x08,0x09,0x2E,0x09,0x93,0x11,0xAC,0x11,0x6A,0x11,0x6D,0x11,0x2D,0x09,0x2B,0x09,0x4C,0x09,0xAB,0x11,0x6F,0x11,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6F,0x01,
-	0x0F,0x4B,0x2F,0x1A,0x94,0x7C,0xB0,0x32,0x2E,0x01,0x6E,0x01,0x6E,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x09,0x6E,0x01,0x6E,0x09,0x6E,0x01,0x4F,0x01,0x2F,0x1A,0x2D,0x53,0xEE,0x19,0x4E,0x01,0x6E,0x09,0x6E,0x09,0x4E,0x01,0xAF,0x11,0x34,0x74,0x70,0x53,0x90,0x32,0x4E,0x2A,0x4F,0x01,0x6F,0x01,
-	0x6E,0x01,0x4E,0x01,0x6F,0x01,0x8F,0x01,0x4E,0x09,0x6E,0x11,0xEE,0x19,0xCD,0x21,0x4B,0x11,0x4D,0x11,0x70,0x11,0x09,0x09,0xC7,0x08,0x2C,0x09,0x2C,0x09,0x2B,0x09,0x2C,0x09,0x4D,0x09,0x2D,0x09,0x4E,0x09,0x4E,0x09,0x2D,0x09,0x30,0x09,0x51,0x11,0x4F,0x09,0x0B,0x09,0x65,0x00,0x42,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x00,0xA8,0x00,0xA9,0x00,0x68,0x00,0x86,0x00,0x87,0x00,0xA6,0x00,0x65,0x00,0xA8,0x29,0x18,0xC6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xD7,0xB5,0x25,0x19,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,
-	0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x41,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x22,0x00,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xE3,0x18,0x21,0x00,0x21,0x00,0x21,0x00,0x64,0x00,0xCA,0x08,0x51,0x09,0x73,0x09,0x10,0x09,
-	0x2F,0x09,0x10,0x09,0x2E,0x09,0x0F,0x09,0x0F,0x09,0x0F,0x09,0x2E,0x09,0x4F,0x09,0x2F,0x09,0x0A,0x09,0xE8,0x08,0xC9,0x08,0xE8,0x08,0xA5,0x08,0x2A,0x09,0x2F,0x09,0x4C,0x09,0xE8,0x08,0x08,0x09,0x08,0x09,0xAA,0x19,0x29,0x11,0x0B,0x09,0x6D,0x09,0x4E,0x09,0x2F,0x09,0x4E,0x01,0x4E,0x01,0x6E,0x01,0x6E,0x09,0xCE,0x11,0x2F,0x53,
-	0x90,0x2A,0x11,0x4B,0x8E,0x09,0xCE,0x00,0x8E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x4E,0x01,0x4F,0x09,0x6E,0x21,0xED,0x7B,0x6E,0x19,0x0F,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x4E,0x01,0xCC,0x00,0xB1,0x42,0xD1,0x3A,0x10,0x1A,0xAE,0x11,0x4E,0x09,
-	0x2F,0x09,0x2F,0x09,0x4E,0x09,0x0A,0x09,0xE9,0x08,0xC9,0x21,0x09,0x09,0x4A,0x11,0xCD,0x21,0x6E,0x11,0x08,0x09,0x2B,0x09,0x2B,0x09,0x2B,0x09,0xE7,0x08,0xC6,0x08,0xE7,0x08,0x0B,0x09,0x30,0x09,0x50,0x09,0x0F,0x09,0x50,0x09,0x2E,0x09,0xC9,0x08,0x64,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x00,0x86,0x00,0x86,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x86,0x00,0x65,0x00,0xC5,0x10,0x8A,0x4A,0xF7,0xBD,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xF7,0xBD,0x8A,0x4A,0xA4,0x08,0x85,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,
-	0x64,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x83,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x61,0x00,0x41,0x00,0x41,0x00,0x42,0x00,0x13,0x9D,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xF7,0xBD,0xC3,0x10,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x43,0x00,0xA8,0x08,
-	0xEC,0x08,0x0D,0x09,0x0E,0x09,0x4E,0x09,0x0D,0x09,0x0F,0x09,0x0C,0x09,0xE9,0x08,0xC6,0x08,0xA5,0x08,0xC6,0x08,0xE8,0x08,0x0A,0x09,0x4D,0x09,0xE9,0x08,0xE6,0x08,0xE9,0x08,0x08,0x09,0xC7,0x08,0x08,0x09,0xA7,0x08,0xC8,0x08,0xC8,0x08,0xC8,0x08,0x4B,0x09,0x50,0x09,0x2F,0x09,0x4F,0x09,0x8D,0x11,0x6E,0x32,0xB4,0x84,0x51,0x53,
-	0x51,0x4B,0xEF,0x19,0x0E,0x01,0x4D,0x32,0xEF,0x7B,0x4F,0x2A,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0xEE,0x00,0xEE,0x19,0x0D,0x32,0x8D,0x6B,0xEF,0x00,0x4F,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x4E,0x01,0x4F,0x01,0x2E,0x01,0x52,0x53,0xF1,0x4A,0x70,0x32,0x0F,0x2A,
-	0x4D,0x11,0x8E,0x19,0x08,0x09,0xC7,0x08,0x44,0x00,0x84,0x08,0x43,0x00,0xA5,0x08,0x49,0x09,0x2A,0x09,0x2C,0x11,0x2C,0x09,0x0C,0x09,0x0A,0x09,0xEB,0x08,0x2B,0x09,0x0B,0x09,0x2D,0x09,0x2D,0x09,0x0D,0x09,0xED,0x08,0xEA,0x08,0x84,0x00,0x42,0x00,0x62,0x00,0x61,0x00,0x42,0x00,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x86,0x00,0x86,0x00,0x66,0x00,0x86,0x00,0x65,0x00,0x65,0x00,0xC4,0x10,0xAB,0x52,0xCF,0x73,0xD0,0x7B,0xD0,0x7B,0x29,0x42,0xA5,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x43,0x00,0x43,0x00,0x63,0x00,0x63,0x00,
-	0x63,0x00,0x83,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x84,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x63,0x08,0x84,0x00,0x84,0x00,0x63,0x00,0x63,0x00,0x42,0x00,0x42,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x42,0x00,0x42,0x00,
-	0x62,0x00,0xC8,0x08,0xE9,0x08,0x0C,0x09,0xEA,0x08,0x0C,0x09,0xEB,0x08,0xCC,0x08,0x0C,0x09,0x0A,0x09,0xCA,0x08,0xE8,0x08,0xE9,0x08,0xC9,0x08,0x2B,0x09,0x0D,0x09,0x09,0x09,0xE7,0x08,0x06,0x19,0xA5,0x08,0x86,0x08,0x84,0x08,0xA6,0x08,0xA6,0x08,0xC7,0x10,0x28,0x11,0xCA,0x11,0xF0,0x19,0x91,0x11,0x91,0x11,0x15,0x1A,0xD3,0x11,
-	0x34,0x6C,0x6F,0x11,0x8D,0x19,0x90,0xA4,0x15,0xEF,0x13,0xCE,0xAE,0x09,0x6E,0x01,0x4E,0x01,0x4E,0x01,0x4E,0x01,0x2E,0x01,0x6F,0x01,0x4E,0x09,0xAE,0x3A,0x6D,0x63,0x6D,0x42,0xEF,0x00,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x6E,0x01,0x4E,0x01,0x4E,0x01,0x4E,0x01,0x4E,0x01,0x6F,0x09,0x4F,0x01,0x72,0x2A,0x93,0x2A,0xEF,0x19,0x4A,0x11,
-	0x07,0x09,0x64,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0xA6,0x00,0x0B,0x09,0xC6,0x08,0xA7,0x08,0xC6,0x08,0xC6,0x08,0x09,0x09,0x08,0x09,0xC7,0x08,0xC7,0x08,0x08,0x09,0x0A,0x09,0xC6,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x66,0x00,0x66,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x65,0x00,
-	0x85,0x00,0x85,0x00,0xA6,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x85,0x00,0xA6,0x00,0xA6,0x00,0x85,0x00,0x85,0x08,0x63,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x42,0x00,0x42,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x08,0x63,0x00,0x62,0x00,0x62,0x00,0x42,0x00,0x62,0x00,
-	0x42,0x00,0x22,0x00,0x63,0x00,0x65,0x00,0xE9,0x08,0xE9,0x08,0xC8,0x08,0xA6,0x08,0xC6,0x08,0xA6,0x08,0xA6,0x08,0x85,0x08,0x64,0x08,0xA5,0x08,0xA4,0x08,0x84,0x08,0x86,0x00,0x64,0x00,0x44,0x00,0x23,0x00,0x43,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x44,0x00,0x44,0x00,0xA5,0x08,0x28,0x11,0x2A,0x11,0x0E,0x1A,0xB6,0x2A,0xF1,0x19,
-	0x4E,0x09,0xB1,0x11,0xCC,0x29,0x30,0xC5,0x46,0x7A,0xA8,0xBA,0x29,0x11,0xED,0x00,0xEF,0x00,0x4E,0x01,0x4E,0x11,0x6D,0x3A,0xAD,0x4A,0x2E,0x2A,0xAE,0x3A,0x2E,0x09,0x6F,0x01,0x6E,0x01,0x6E,0x01,0x4E,0x01,0x4E,0x01,0xEC,0x08,0xA9,0x00,0xA8,0x00,0xC9,0x00,0xEA,0x08,0x8F,0x09,0x8D,0x11,0x8F,0x11,0x91,0x11,0xED,0x21,0x89,0x19,
-	0x65,0x00,0x44,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x43,0x00,0x64,0x00,0xA5,0x08,0x64,0x00,0xA4,0x00,0xA5,0x08,0x84,0x08,0xA4,0x08,0xC5,0x00,0x08,0x09,0x0B,0x09,0xED,0x08,0x2B,0x09,0xA5,0x08,0x64,0x00,0x63,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x63,0x00,0x22,0x00,0x43,0x00,0x23,0x00,0x42,0x00,0x43,0x00,0x43,0x00,0x44,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x43,0x00,0x63,0x00,0x63,0x00,0x43,0x00,0x63,0x00,0x43,0x00,0x63,0x00,0x43,0x00,0x64,0x00,0x64,0x00,0x63,0x00,
-	0x44,0x00,0x64,0x00,0x64,0x00,0xA7,0x00,0xA8,0x00,0xA6,0x00,0x85,0x00,0x64,0x00,0x64,0x00,0x86,0x00,0x86,0x00,0xA7,0x00,0xA7,0x08,0xA7,0x08,0xA5,0x08,0xA5,0x08,0xA6,0x08,0x86,0x08,0x64,0x00,0x64,0x08,0x84,0x00,0x64,0x00,0x63,0x00,0x62,0x00,0x42,0x00,0x22,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,
-	0x42,0x00,0x42,0x00,0x41,0x00,0x62,0x00,0x62,0x00,0x83,0x00,0xC6,0x08,0xE8,0x08,0xC9,0x08,0xC8,0x08,0xA6,0x08,0xA5,0x08,0x84,0x00,0x64,0x00,0x63,0x00,0xA5,0x00,0x84,0x00,0x63,0x00,0x64,0x00,0xA5,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0xE6,0x10,0xED,0x21,0x6B,0x11,0x0A,0x09,0x4C,0x11,
-	0x69,0x11,0xAC,0x19,0xCB,0x21,0x6C,0x73,0xA1,0x40,0x20,0x98,0x62,0x68,0xE6,0x10,0x07,0x19,0x4B,0x63,0x0E,0x22,0xED,0x62,0x0E,0x09,0x6E,0x01,0x0F,0x01,0x4E,0x01,0x0E,0x01,0x4E,0x01,0x4E,0x01,0x0C,0x09,0x68,0x00,0x68,0x00,0x88,0x00,0xC9,0x00,0x2B,0x09,0x6A,0x11,0x4C,0x11,0xEB,0x29,0x6A,0x19,0x6A,0x11,0x09,0x09,0x2B,0x11,
-	0x49,0x11,0x07,0x11,0x64,0x00,0x44,0x00,0x44,0x00,0x64,0x00,0x85,0x08,0xA5,0x08,0x64,0x00,0x84,0x00,0xA5,0x00,0xC5,0x00,0xC6,0x00,0xE7,0x00,0xE8,0x08,0xE9,0x08,0xE8,0x08,0xA6,0x00,0xA5,0x08,0x62,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x63,0x00,0x63,0x08,0x64,0x08,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x22,0x00,0x42,0x00,0x63,0x00,0x43,0x00,0x42,0x00,0x43,0x00,0x22,0x00,0x42,0x00,0x42,0x00,0x22,0x00,0x43,0x00,0x64,0x00,0x63,0x00,0x43,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x43,0x00,0x63,0x00,
-	0x43,0x00,0x42,0x00,0x43,0x00,0x43,0x00,0x64,0x00,0x66,0x00,0xA8,0x00,0xA9,0x00,0xA8,0x00,0xA7,0x08,0x85,0x00,0x64,0x00,0x64,0x00,0x85,0x00,0xA6,0x08,0xA7,0x08,0xC8,0x08,0xC9,0x08,0xCA,0x08,0xC9,0x08,0xC9,0x08,0xA7,0x00,0xA6,0x00,0xA6,0x08,0xA7,0x08,0x85,0x08,0x63,0x00,0x62,0x00,0x42,0x00,0x62,0x00,0x62,0x00,0x62,0x00,
-	0x42,0x00,0x22,0x00,0x41,0x00,0x21,0x00,0x42,0x00,0x83,0x00,0x85,0x00,0x87,0x00,0xCA,0x08,0xCA,0x08,0xC7,0x08,0xA6,0x08,0xA5,0x08,0xA4,0x08,0xA4,0x08,0x84,0x08,0x64,0x00,0x63,0x00,0xA5,0x08,0xA5,0x00,0x64,0x00,0x43,0x00,0x64,0x00,0x84,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0xA5,0x08,0xE7,0x08,0xE7,0x08,0x08,0x09,0xE6,0x08,
-	0x07,0x09,0xAB,0x19,0x28,0x11,0x89,0x19,0x48,0x21,0x40,0x60,0x80,0xC8,0x41,0x80,0xE8,0x10,0x49,0x11,0xC9,0x08,0x8C,0x21,0x4D,0x2A,0xD1,0x19,0x0E,0x01,0xB1,0x11,0xAE,0x3A,0x6E,0x09,0xAB,0x08,0xE8,0x08,0x29,0x09,0x6B,0x09,0xAD,0x11,0xED,0x19,0x6C,0x11,0x28,0x11,0x49,0x09,0x8A,0x11,0x48,0x11,0x08,0x09,0xE7,0x08,0xA6,0x08,
-	0xC7,0x08,0xE6,0x08,0xA6,0x00,0xC5,0x00,0xC6,0x00,0xC5,0x08,0xA5,0x08,0x85,0x00,0x64,0x00,0x43,0x00,0x43,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x84,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x63,0x00,0x85,0x00,0xA6,0x08,0xA6,0x00,0xA8,0x08,0xA8,0x08,0xC9,0x08,0xEA,0x08,0xCC,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x42,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x43,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x42,0x00,
-	0x43,0x00,0x64,0x00,0x43,0x00,0x42,0x00,0x22,0x00,0x42,0x00,0x43,0x00,0x64,0x00,0x66,0x00,0x66,0x00,0xA7,0x00,0xA7,0x08,0xA8,0x00,0x86,0x08,0x64,0x00,0x64,0x00,0x64,0x00,0x84,0x00,0x86,0x00,0xA7,0x00,0xA8,0x00,0xA8,0x00,0xA7,0x08,0x88,0x00,0xC9,0x08,0xA8,0x08,0xA7,0x00,0xA6,0x08,0x85,0x00,0x85,0x00,0x65,0x00,0x64,0x00,
-	0x64,0x00,0x63,0x00,0x43,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x84,0x00,0x85,0x00,0x85,0x00,0x85,0x00,0x85,0x08,0x63,0x00,0x63,0x00,0x42,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x85,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA6,0x00,0xC6,0x00,0xC7,0x00,0xC7,0x00,0xC5,0x00,0xA6,0x00,0xC6,0x00,0xE7,0x08,0xE7,0x00,
-	0xE7,0x08,0xC7,0x00,0x08,0x09,0x29,0x09,0x6B,0x09,0x62,0x10,0x40,0x88,0x60,0xC8,0x40,0x90,0xE6,0x28,0x08,0x09,0xA6,0x00,0xA6,0x00,0x08,0x09,0xAD,0x19,0x89,0x19,0xA6,0x00,0xE7,0x08,0x08,0x09,0xC7,0x00,0x29,0x09,0x8D,0x11,0xAC,0x19,0xAC,0x11,0xAB,0x09,0x4A,0x09,0x8B,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x07,0x09,0x27,0x09,
-	0x07,0x09,0x08,0x09,0x28,0x09,0xC6,0x08,0x64,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x84,0x08,0x84,0x08,0x64,0x00,0x84,0x08,0x64,0x00,0x65,0x00,0x86,0x08,0xC9,0x08,0xCB,0x08,0xEC,0x08,0xEE,0x08,0xEF,0x08,0xCD,0x08,0xEF,0x08,0xCD,0x08,0xEB,0x08,0xA8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x23,0x00,0x43,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x43,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x63,0x00,0x43,0x00,0x43,0x00,0x63,0x00,0x65,0x00,0x65,0x00,0x68,0x00,0x87,0x00,0x89,0x00,0xA7,0x00,0xA9,0x00,0xA9,0x08,0xA8,0x08,0xA8,0x00,0xA7,0x00,0xA6,0x00,0x86,0x00,0xA6,0x00,0xA5,0x08,0x87,0x00,0xA8,0x00,0x89,0x00,0xCB,0x08,0xAC,0x00,0xAB,0x08,0xCB,0x08,0xCB,0x08,
-	0xCB,0x08,0xAB,0x08,0xAB,0x08,0xAB,0x08,0xA8,0x00,0xA6,0x00,0x85,0x00,0x84,0x08,0x63,0x00,0x63,0x00,0x63,0x00,0x83,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x84,0x00,0x65,0x00,0xA5,0x00,0xA6,0x00,0x07,0x09,0x49,0x09,0x49,0x09,0x2A,0x09,0x28,0x09,0x28,0x09,0x29,0x09,0x29,0x09,
-	0x29,0x09,0x28,0x09,0x28,0x09,0x28,0x09,0x49,0x09,0xC6,0x00,0x20,0x20,0x20,0x98,0x60,0xC8,0x40,0x90,0xA4,0x20,0xA5,0x00,0xA5,0x00,0xA6,0x08,0x08,0x11,0xE7,0x10,0xA6,0x00,0xC6,0x00,0x2A,0x09,0x4C,0x09,0x4A,0x09,0x29,0x09,0x48,0x09,0x27,0x09,0x28,0x09,0x28,0x09,0x07,0x09,0x08,0x09,0x28,0x09,0x2B,0x09,0x8B,0x09,0x07,0x09,
-	0xC5,0x08,0x28,0x09,0x08,0x09,0xC6,0x08,0x84,0x00,0x23,0x00,0x22,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x85,0x08,0xA7,0x08,0xEA,0x08,0xEE,0x08,0x0F,0x09,0xCF,0x08,0x10,0x09,0xF0,0x08,0xCC,0x08,0xCB,0x08,0xCB,0x08,0xCA,0x08,0xCA,0x08,0xA7,0x08,0xA5,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x42,0x00,0x43,0x00,0x43,0x00,0x63,0x00,0x43,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x65,0x00,0x44,0x00,0x44,0x00,0x64,0x00,0x64,0x00,0x43,0x00,0x64,0x00,0x44,0x00,0x43,0x00,0x42,0x00,
-	0x22,0x00,0x22,0x00,0x42,0x00,0x42,0x00,0x44,0x00,0x45,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x44,0x00,0x44,0x00,0x65,0x00,0x86,0x00,0x68,0x00,0x88,0x00,0x8A,0x00,0xA9,0x08,0x87,0x00,0xA7,0x08,0x85,0x08,0x85,0x00,0xA6,0x00,0x86,0x00,0xA7,0x00,0xA6,0x08,0x85,0x00,0x86,0x00,0xA7,0x08,0xA7,0x08,0x88,0x00,0xAC,0x08,
-	0xEE,0x08,0xCC,0x08,0xEF,0x00,0xEF,0x00,0xF0,0x08,0xCF,0x08,0xEC,0x08,0xCE,0x08,0x0E,0x09,0xCA,0x08,0xA8,0x00,0xA8,0x00,0xA6,0x00,0xA5,0x00,0xA5,0x00,0x85,0x00,0xA5,0x00,0xA6,0x00,0xA5,0x00,0x83,0x00,0x64,0x00,0x84,0x00,0xA5,0x00,0xE7,0x00,0x08,0x09,0x28,0x09,0x29,0x09,0x69,0x09,0x4A,0x09,0x6D,0x09,0x4B,0x09,0x48,0x09,
-	0x29,0x09,0x49,0x11,0x29,0x09,0x28,0x09,0x49,0x11,0x49,0x11,0xA4,0x08,0x41,0x40,0x20,0xA0,0x80,0xD0,0x40,0x98,0x84,0x40,0xA6,0x08,0xA7,0x00,0xA6,0x00,0xA7,0x00,0xA7,0x00,0xC7,0x00,0xC7,0x08,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x28,0x09,0x28,0x09,0x07,0x09,0x28,0x09,0x48,0x11,0x27,0x09,0x28,0x09,0x28,0x09,0xE6,0x08,
-	0x07,0x11,0xE6,0x08,0x84,0x00,0x43,0x00,0x84,0x00,0xA5,0x00,0xC7,0x00,0xA9,0x00,0xC9,0x00,0xC9,0x00,0x8A,0x00,0x8A,0x00,0x8A,0x00,0x8A,0x00,0x8B,0x00,0x89,0x00,0xC9,0x00,0x88,0x00,0x67,0x00,0x88,0x00,0x88,0x00,0x67,0x00,0x65,0x00,0x43,0x00,0x42,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x41,0x00,0x21,0x00,0x20,0x00,0x01,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x43,0x00,0x63,0x00,0x43,0x00,0x64,0x00,0x44,0x00,0x44,0x00,0x45,0x00,0x65,0x00,0x66,0x00,0x65,0x00,0x66,0x00,0xA6,0x00,0x86,0x00,0x86,0x00,0xA6,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x85,0x00,0xA6,0x00,
-	0xC8,0x08,0xC9,0x08,0xAA,0x00,0xAD,0x00,0xCE,0x08,0xCE,0x08,0xCD,0x00,0xCD,0x00,0xCD,0x08,0xCD,0x08,0xCE,0x08,0xCD,0x08,0xCC,0x08,0x8A,0x00,0xAB,0x00,0xA9,0x00,0xA9,0x00,0xA8,0x00,0xA8,0x00,0xA8,0x00,0xA6,0x00,0xA5,0x00,0xA4,0x00,0x83,0x00,0x84,0x00,0x85,0x00,0xC5,0x00,0xE6,0x08,0x28,0x09,0x88,0x11,0x28,0x09,0xE7,0x00,
-	0xC7,0x00,0x28,0x09,0xE7,0x00,0xC7,0x00,0x27,0x09,0x07,0x01,0x07,0x09,0xA2,0x20,0x20,0xA0,0x80,0xD0,0xA0,0xD9,0x60,0xC0,0x83,0x60,0xE7,0x08,0xC6,0x00,0xA7,0x00,0xA7,0x00,0xC7,0x00,0xE7,0x00,0xE7,0x00,0x07,0x01,0xE7,0x00,0xE7,0x00,0xC7,0x00,0xC7,0x00,0xC7,0x00,0xC7,0x00,0x07,0x09,0xA5,0x00,0xC6,0x00,0xA5,0x08,0xA3,0x08,
-	0xC4,0x08,0x62,0x00,0x41,0x00,0x41,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x43,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x62,0x08,0x86,0x29,0x86,0x29,0x86,0x29,0x86,0x29,0xA2,0x10,0x00,0x00,0x46,0x21,0xA7,0x29,0xC8,0x29,0x66,0x29,0x62,0x08,0x01,0x00,0x00,0x00,0x25,0x21,0xE4,0x18,0x21,0x00,0x41,0x00,0x42,0x00,
-	0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x22,0x00,0x41,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x63,0x00,0x66,0x29,0x85,0x08,0x43,0x00,0x21,0x00,0xA7,0x29,0xA8,0x29,0x87,0x29,0x88,0x29,0xE5,0x18,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x21,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x62,0x00,0x42,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC5,0x00,0x87,0x11,
-	0x27,0x09,0xA7,0x00,0xE7,0x00,0xE7,0x00,0xC7,0x00,0xE7,0x00,0xC6,0x00,0x61,0x18,0x20,0xA0,0x80,0xD0,0x00,0xD1,0x60,0xD9,0x60,0xC0,0xE2,0x68,0x26,0x21,0x27,0x11,0xC7,0x00,0xC7,0x00,0xC7,0x00,0x08,0x01,0xE8,0x00,0x08,0x01,0x07,0x01,0x08,0x01,0xE7,0x00,0xE7,0x00,0xE7,0x00,0xC7,0x00,0x27,0x09,0xE4,0x10,0x41,0x00,0x42,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x41,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x3C,0xE7,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0x49,0x4A,0x00,0x00,0xF7,0xBD,0x58,0xC6,0xF7,0xBD,0xDA,0xD6,0x75,0xAD,0x82,0x10,0x00,0x00,0x95,0xAD,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x75,0xAD,0xDA,0xD6,0x66,0x29,0x21,0x00,0x21,0x00,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x3C,0xE7,0x4D,0x63,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x21,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0x47,0x11,0xA8,0x19,
-	0x49,0x11,0x07,0x01,0xE8,0x00,0x08,0x01,0x08,0x01,0x08,0x01,0xE8,0x00,0x61,0x08,0x20,0x80,0x60,0xC0,0x00,0xD1,0xA0,0xEA,0x00,0xE2,0xE0,0xD0,0x82,0x88,0xE6,0x10,0x28,0x09,0x28,0x09,0xE7,0x00,0xE7,0x00,0x07,0x01,0x08,0x01,0x28,0x01,0x08,0x01,0xE8,0x00,0x07,0x01,0xC7,0x00,0xE7,0x00,0x48,0x11,0xC4,0x08,0x05,0x09,0x62,0x00,
-	0x62,0x00,0x62,0x00,0x62,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x86,0x31,0xFB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x79,0xCE,0x08,0x3A,0x20,0x00,0xA2,0x10,0x3C,0xE7,0x29,0x42,0x21,0x00,0xF7,0xBD,0x71,0x8C,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x51,0x8C,0x71,0x8C,0x7D,0xEF,0x86,0x29,0x21,0x00,0x21,0x00,0x22,0x00,0x62,0x08,0x0F,0x7C,0xF3,0x9C,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x42,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x83,0x00,0x83,0x00,0x83,0x00,
-	0xC5,0x00,0x47,0x11,0x88,0x11,0x28,0x01,0x08,0x01,0x08,0x01,0xE8,0x00,0x41,0x18,0x60,0x90,0x80,0xD0,0x00,0xD1,0xA0,0xEA,0xA0,0xEA,0xA0,0xEA,0x20,0xE2,0x80,0x90,0xC6,0x10,0x07,0x01,0x88,0x11,0x28,0x01,0xC7,0x00,0xE7,0x00,0xE7,0x00,0x07,0x01,0x08,0x01,0x28,0x01,0x69,0x11,0x46,0x09,0x83,0x00,0x83,0x00,0x83,0x00,0x63,0x00,
-	0x63,0x00,0x62,0x00,0x62,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x21,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x43,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xFB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x08,0x3A,0x21,0x00,0x21,0x00,0x79,0xCE,0xCB,0x5A,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0xA3,0x10,0x41,0x00,0x7D,0xEF,0x87,0x29,0x21,0x00,0x21,0x00,0x62,0x08,0xB2,0x94,0x17,0xBE,0xA2,0x10,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x42,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x83,0x00,0xA3,0x00,0x83,0x00,
-	0x26,0x09,0x67,0x11,0xE8,0x08,0x08,0x01,0x07,0x01,0x07,0x01,0xC6,0x00,0x41,0x50,0x40,0xB0,0xA0,0xD9,0x20,0xE2,0xA0,0xEA,0x01,0xE3,0x01,0xE3,0xA0,0xEA,0x20,0xE2,0x81,0x90,0x07,0x09,0x08,0x01,0x68,0x09,0x68,0x11,0x08,0x01,0x08,0x01,0x07,0x01,0x28,0x01,0x08,0x01,0x29,0x09,0x88,0x11,0x27,0x09,0xE5,0x00,0xC5,0x00,0xA4,0x00,
-	0x83,0x00,0x62,0x00,0x63,0x00,0x42,0x00,0x62,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x41,0x00,0x21,0x00,0x41,0x00,0x41,0x00,0x21,0x00,0x41,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xBE,0xF7,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0x24,0x21,0x20,0x00,0x79,0xCE,0x8D,0x6B,0x08,0x42,0x10,0x84,0x3C,0xE7,0x65,0x29,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x7D,0xEF,0x86,0x29,0x20,0x00,0x21,0x00,0x49,0x4A,0xBA,0xD6,0xBA,0xD6,0xD6,0xB5,0x24,0x21,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x42,0x00,0x43,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x41,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x83,0x00,0x83,0x00,
-	0xA3,0x00,0xA4,0x00,0xE5,0x08,0x06,0x09,0xC7,0x00,0xC7,0x00,0xA4,0x08,0x40,0x50,0x20,0xA0,0x80,0xD0,0xA0,0xEA,0x01,0xE3,0xE5,0xE4,0xE5,0xE4,0x43,0xE4,0x20,0xE2,0x60,0xC8,0x84,0x50,0x08,0x01,0x08,0x01,0x68,0x11,0x48,0x09,0x08,0x01,0x08,0x01,0xE7,0x00,0x67,0x09,0x02,0x41,0x69,0x93,0xE5,0x08,0xC6,0x00,0xC5,0x00,0xA5,0x00,
-	0xA4,0x00,0x83,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x42,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x62,0x00,0x42,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x43,0x00,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x86,0x31,0x1C,0xE7,0x49,0x4A,0x85,0x29,0x85,0x29,0x61,0x08,0x20,0x00,0x79,0xCE,0xB6,0xB5,0x38,0xC6,0xDA,0xD6,0xC7,0x39,0x20,0x00,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x7D,0xEF,0x87,0x29,0x21,0x00,0x21,0x00,0x82,0x08,0x04,0x19,0xC2,0x10,0x34,0xA5,0x54,0xA5,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x62,0x00,0x63,0x00,0x83,0x00,0xA4,0x00,0x83,0x00,
-	0x62,0x00,0x62,0x00,0xE4,0x10,0xA3,0x08,0xE4,0x00,0x68,0x19,0xA2,0x10,0x40,0x70,0x20,0xA0,0x80,0xD0,0xA0,0xEA,0x01,0xE3,0x21,0xE3,0x21,0xE3,0x61,0xD1,0xA0,0xD0,0x20,0xA0,0x20,0x78,0xA4,0x40,0x89,0x11,0x69,0x09,0x89,0x11,0x88,0x11,0x68,0x11,0x05,0x09,0xA2,0x18,0x24,0x6A,0x0A,0xA4,0xC4,0x10,0xA3,0x00,0xA4,0x00,0xA4,0x00,
-	0xA5,0x00,0xA5,0x00,0xA4,0x00,0x84,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0xA3,0x00,0x84,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x82,0x00,0x62,0x00,0x42,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x44,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xFB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x08,0x3A,0x24,0x21,0xFB,0xDE,0xCB,0x5A,0x20,0x00,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x7D,0xEF,0x85,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0x4D,0x6B,0x58,0xC6,0x81,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x21,0x00,0x42,0x00,0x22,0x00,0x21,0x00,0x42,0x00,0x22,0x00,0x42,0x00,0x41,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x01,0x00,0x21,0x00,0x41,0x00,
-	0xA2,0x08,0x23,0x19,0x85,0x31,0x08,0x3A,0xA9,0x52,0x69,0x4A,0x40,0x30,0x20,0x88,0x20,0xA0,0x60,0xC0,0x01,0xDA,0xA3,0xDA,0x05,0xCA,0x0A,0xC3,0x2A,0xC3,0x09,0xC3,0x63,0xA1,0xC2,0x80,0x82,0x60,0xC9,0x19,0x8A,0x11,0x69,0x09,0x2B,0x22,0xA9,0x11,0x26,0x09,0x42,0x41,0x48,0x8B,0xE6,0x39,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xC5,0x00,0xA5,0x00,0xE5,0x00,0xA5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE7,0x00,0xC5,0x00,0xA5,0x00,0xA6,0x00,0xC5,0x00,0xC5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x86,0x31,0xFB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x79,0xCE,0x08,0x3A,0x21,0x00,0x6D,0x6B,0xFB,0xDE,0x25,0x21,0x00,0x00,0xF7,0xBD,0x71,0x8C,0x21,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x7D,0xEF,0x86,0x29,0x20,0x00,0x45,0x21,0x79,0xCE,0x69,0x4A,0x44,0x21,0x18,0xC6,0x50,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x01,0x00,0x22,0x00,0x42,0x00,0x43,0x00,0x22,0x00,0x63,0x00,0x43,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x42,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x42,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x01,0x00,0x21,0x00,0x22,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x60,0x08,0xA1,0x10,
-	0xE2,0x10,0xE7,0x39,0x48,0x4A,0x48,0x4A,0x49,0x3A,0xA7,0x31,0x80,0x38,0x20,0x70,0x81,0x80,0x6A,0xBB,0xB2,0xDD,0xB5,0xE6,0xD5,0xEE,0x16,0xF7,0x56,0xF7,0x15,0xF7,0xD5,0xEE,0x33,0xE6,0xCB,0xB3,0xE9,0x29,0x6A,0x09,0x69,0x01,0x49,0x01,0xC8,0x31,0xC5,0x49,0x04,0x62,0xEA,0x62,0x87,0x11,0x25,0x01,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xC4,0x00,0xA4,0x00,0xA4,0x00,0xC5,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0x06,0x01,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x21,0xB6,0xB5,0xE4,0x18,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x34,0xA5,0xA7,0x31,0x20,0x00,0x21,0x00,0x13,0x9D,0xEF,0x7B,0x00,0x00,0xD3,0x9C,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xBE,0x44,0x21,0x00,0x00,0x00,0x00,0x0C,0x63,0x38,0xC6,0x79,0xCE,0xF3,0x9C,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x00,0x43,0x00,
-	0x63,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x43,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x42,0x00,0x41,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x42,0x00,0x63,0x00,0x42,0x00,0x22,0x00,0x42,0x00,0x62,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x81,0x08,
-	0xA1,0x10,0xE3,0x18,0x03,0x21,0xE7,0x39,0x48,0x4A,0xE4,0x38,0x42,0x51,0x0B,0xB4,0x94,0xEE,0x16,0xEF,0xD6,0xEE,0xF6,0xEE,0xF6,0xEE,0x16,0xF7,0xF6,0xEE,0xF5,0xF6,0x16,0xEF,0xF6,0xEE,0xD5,0xEE,0x51,0xC5,0x8B,0x3A,0xC9,0x29,0x06,0x6A,0x87,0xBA,0x90,0xDD,0x4A,0x83,0xE4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xE5,0x00,0xC5,0x00,0xC6,0x00,0xA5,0x00,0xA5,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x82,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x62,0x08,0x20,0x00,0x20,0x00,0x21,0x00,0x41,0x00,0x82,0x10,0x21,0x00,0x62,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x43,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x41,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x42,0x00,0x63,0x00,0x63,0x00,0x62,0x00,0x42,0x00,0x42,0x00,0x43,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x00,0x60,0x08,0xA1,0x10,0xC1,0x10,0x23,0x21,0x66,0x62,0xD1,0xDD,0x74,0xE6,0xD5,0xEE,0x74,0xE6,0x54,0xDE,0x54,0xDE,0x94,0xE6,0x53,0xE6,0xB4,0xEE,0xB4,0xEE,0x73,0xEE,0xB4,0xEE,0x94,0xE6,0x33,0xE6,0xAE,0xAC,0x26,0x9A,0x29,0xCB,0x70,0xE5,0x33,0xF6,0xCC,0x83,0x04,0x01,0xC4,0x00,0xC4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x00,0x43,0x00,0x42,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x42,0x00,
-	0x42,0x00,0x41,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x41,0x00,0x22,0x00,0x42,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x43,0x00,0x42,0x00,0x41,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x31,0x2F,0xCD,0xD2,0xD5,0x12,0xDE,0xD2,0xD5,0xB4,0xEE,0xD1,0xE5,0x94,0xEE,0x53,0xF6,0xD4,0xEE,0x98,0xF7,0xD5,0xF6,0x12,0xEE,0x53,0xF6,0xB4,0xEE,0xF2,0xDD,0x0F,0xD5,0xEE,0xE4,0x53,0xF6,0x50,0xED,0x73,0xEE,0xF2,0xCD,0x2B,0x6B,0x69,0x42,0xE8,0x31,0xC8,0x29,0x87,0x19,0x67,0x11,
-	0x46,0x09,0x05,0x01,0xE4,0x00,0xC4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x83,0x00,0xA3,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x42,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x22,0x00,0x42,0x00,0x42,0x00,0x43,0x00,0x43,0x00,
-	0x42,0x00,0x42,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x8B,0x0F,0xBD,0xB1,0xD5,0xF2,0xDD,0x57,0xF7,0xD5,0xFE,0x33,0xF6,0x53,0xF6,0x93,0xF6,0x70,0xE5,0x53,0xEE,0x32,0xEE,0x32,0xEE,0x92,0xF6,0xF2,0xED,0xB4,0xEE,0x0A,0xB4,0x43,0x81,0xCB,0xCC,0x15,0xFF,0xD4,0xF6,0xD2,0xF6,0x95,0xE6,0x11,0xD6,0xCA,0x5A,0x49,0x4A,0x49,0x3A,0x29,0x32,
-	0x09,0x32,0xC8,0x21,0x67,0x11,0x26,0x09,0x05,0x01,0xE5,0x00,0xE4,0x00,0xE4,0x00,0xE4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x42,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x44,0x00,0x63,0x00,0x63,0x00,0x43,0x00,0x43,0x00,0x42,0x00,0x43,0x00,
-	0x42,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x42,0x00,0x41,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x0D,0x9C,0xCE,0xC4,0x13,0xDE,0x57,0xF7,0xF6,0xF6,0x2F,0xE5,0xD1,0xE5,0xEF,0xE5,0x6F,0xD5,0xC8,0xC2,0x68,0xDB,0xCD,0xE4,0xED,0xE4,0xAE,0xE5,0x4E,0xE5,0x6F,0xE5,0x88,0x9B,0x8C,0xB4,0x8C,0xC4,0x32,0xF6,0x73,0xF7,0x93,0xEE,0xF7,0xEE,0x56,0xF7,0xD0,0xCD,0xEB,0x52,0x49,0x42,0x49,0x3A,
-	0x09,0x32,0xE9,0x29,0x88,0x19,0x47,0x11,0x46,0x09,0x26,0x01,0x05,0x01,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xC4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x22,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x44,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x43,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x41,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x63,0x00,0x43,0x00,0x62,0x00,0x44,0x00,0x44,0x00,0x64,0x00,0x63,0x00,0x43,0x00,0x43,0x00,0x42,0x00,0x22,0x00,
-	0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x44,0x29,0xC6,0x39,0x0E,0xD5,0xB1,0xE5,0x57,0xF7,0x78,0xF7,0xA9,0xDB,0xE9,0xDB,0xB0,0xED,0x71,0xEE,0xAE,0xE5,0x04,0xDB,0x4E,0xED,0xD4,0xF6,0xB1,0xF6,0xB0,0xED,0xF3,0xF6,0xCA,0xCC,0x27,0x8B,0xB3,0xEE,0xCD,0xCC,0x90,0xED,0x93,0xEE,0xD7,0xE6,0x36,0xF7,0x35,0xF7,0x52,0xD6,0xEA,0x52,0x6A,0x3A,0x09,0x2A,
-	0xE9,0x29,0xC8,0x19,0x87,0x11,0x47,0x09,0x66,0x09,0x46,0x01,0x26,0x01,0x46,0x01,0x26,0x01,0x26,0x01,0x05,0x01,0xE5,0x00,0x05,0x01,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
-	0x22,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x44,0x00,0x44,0x00,0x23,0x00,0x42,0x00,0x22,0x00,0x42,0x00,0x22,0x00,0x43,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x43,0x00,0x43,0x00,0x63,0x00,0x64,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x63,0x00,0x84,0x00,0x63,0x00,0x43,0x00,0x43,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x00,0x00,
-	0x41,0x00,0x00,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x00,0x61,0x08,0x83,0x41,0x0C,0xC4,0xD5,0xEE,0x57,0xF7,0xD5,0xF6,0x32,0xEE,0x32,0xEE,0x32,0xEE,0xB4,0xF6,0x53,0xEE,0x6F,0xE5,0x93,0xEE,0x33,0xFF,0xF4,0xF6,0x16,0xF7,0x17,0xE7,0x46,0x8A,0xB4,0xEE,0x31,0xE6,0xB6,0xDE,0xB7,0xE6,0xD7,0xEE,0x36,0xF7,0x36,0xF7,0x35,0xF7,0x11,0xCE,0x6B,0x32,0x0A,0x22,0xC9,0x11,
-	0xA8,0x09,0xA8,0x01,0x68,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x27,0x01,0x46,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x84,0x00,
-	0x85,0x00,0x63,0x00,0x21,0x00,0x01,0x00,0x84,0x00,0x64,0x00,0x84,0x00,0x62,0x00,0x42,0x00,0x44,0x00,0x43,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x84,0x00,0x64,0x00,0x84,0x00,0x43,0x00,0x63,0x00,0x84,0x00,0x62,0x00,0x21,0x00,0x42,0x00,0x44,0x00,0x43,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x81,0x08,0x83,0x08,0xC3,0x10,0x24,0x21,0x65,0x29,
-	0xA6,0x31,0x07,0x3A,0x28,0x42,0xA9,0x52,0x91,0xCD,0xF5,0xF6,0x16,0xF7,0x56,0xF7,0x56,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x76,0xFF,0x77,0xFF,0x56,0xF7,0x56,0xF7,0x48,0x8B,0x14,0xD6,0xF3,0xF6,0x77,0xF7,0x16,0xF7,0xD7,0xEE,0xD7,0xEE,0x36,0xEF,0x55,0xF7,0x55,0xEF,0x49,0x73,0x2A,0x1A,0xE9,0x11,0xC9,0x11,
-	0xC9,0x09,0xA8,0x01,0x88,0x01,0x67,0x01,0x67,0x01,0x67,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xE5,0x00,0xC4,0x00,0xA4,0x00,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x64,0x00,0x64,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0x84,0x00,0xA5,0x00,0x84,0x00,0xA4,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x22,0x00,0x43,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x61,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xE2,0x18,0x03,0x21,0x23,0x21,0x23,0x21,0x43,0x29,0x64,0x29,0x84,0x29,0x85,0x29,0x85,0x29,0xC6,0x31,0xA7,0x31,0xE7,0x39,0x48,0x4A,0x69,0x52,0x89,0x5A,0xCA,0x62,0xEA,0x62,0x2B,0x6B,0x2B,0x6B,0x6C,0x73,0xAD,0x7B,0xAD,0x83,
-	0xED,0x8B,0x0E,0x8C,0x2E,0x8C,0xD0,0xAC,0xB5,0xE6,0x36,0xF7,0x56,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x76,0xFF,0x77,0xFF,0x77,0xFF,0x98,0xFF,0x35,0xF7,0x36,0xF7,0x0C,0xA4,0x4C,0xA4,0x36,0xF7,0x14,0xF7,0xB7,0xFF,0x97,0xFF,0xF5,0xF6,0x16,0xEF,0x15,0xF7,0x52,0xEE,0xC3,0xE2,0xE3,0x78,0x2A,0x1A,0xE9,0x11,0xA8,0x11,
-	0xA8,0x09,0x68,0x01,0x67,0x01,0x47,0x01,0x46,0x01,0x26,0x01,0x05,0x01,0x05,0x01,0xE5,0x00,0xE5,0x00,0xE4,0x00,0xC4,0x00,0xC4,0x00,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x63,0x00,0x84,0x00,0xA6,0x00,0xA5,0x08,0xA5,0x00,0xA5,0x00,0xA5,0x00,0xA4,0x00,0x85,0x00,0x85,0x00,0x44,0x00,0x43,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x81,0x08,0x81,0x08,0xC3,0x18,0x03,0x21,
-	0x03,0x21,0x44,0x29,0x85,0x31,0xE7,0x39,0x06,0x4A,0x47,0x4A,0x67,0x5A,0xC9,0x5A,0xEA,0x6A,0x4B,0x7B,0x6B,0x7B,0xCD,0x8B,0xED,0x8B,0x0E,0x94,0x2E,0x94,0x2E,0x9C,0x4E,0x9C,0x4E,0x9C,0x6F,0xA4,0x6F,0xA4,0x6F,0xA4,0x8F,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xD0,0xA4,0xB0,0xA4,0xD0,0xA4,
-	0xD0,0xA4,0xD0,0xA4,0xD0,0xA4,0x11,0xB5,0x93,0xEE,0x77,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x97,0xFF,0x77,0xFF,0x77,0xFF,0x36,0xF7,0x76,0xF7,0x91,0xC5,0x0A,0xAC,0x7A,0xF7,0xD4,0xEE,0x76,0xFF,0x76,0xFF,0x97,0xFF,0xEF,0xDC,0x63,0xA1,0x43,0xA9,0x61,0xD1,0x00,0xE2,0x43,0xAA,0xC9,0x11,0xA8,0x11,0xA8,0x11,
-	0x68,0x01,0x67,0x01,0x26,0x01,0x26,0x01,0x05,0x01,0x05,0x01,0xE5,0x00,0xE5,0x00,0xE4,0x00,0xC4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x84,0x00,0xA5,0x08,0xE5,0x00,0xA5,0x08,0x85,0x08,0x84,0x00,0x63,0x00,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x60,0x08,0x81,0x08,0x81,0x18,0xC3,0x18,0x03,0x21,
-	0x44,0x29,0x42,0x39,0xA5,0x31,0xA6,0x39,0x07,0x42,0x28,0x4A,0x68,0x4A,0x87,0x62,0xCA,0x5A,0x0B,0x6B,0x2B,0x6B,0x4C,0x73,0x6C,0x7B,0xAC,0x83,0xCD,0x8B,0x0E,0x94,0x2E,0x94,0x4E,0x94,0x4F,0x9C,0x6F,0x9C,0x90,0x94,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0x9C,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xF1,0xA4,0xD1,0xA4,0xF1,0xA4,
-	0xF1,0xA4,0x12,0xAD,0x12,0xAD,0xC8,0x72,0xE2,0x60,0x33,0xDE,0xF7,0xEE,0x57,0xF7,0x77,0xF7,0x57,0xF7,0x77,0xF7,0x57,0xF7,0x37,0xF7,0x16,0xF7,0x15,0xEF,0x37,0xEF,0xE5,0x8A,0xF8,0xE6,0xF4,0xF6,0x55,0xF7,0x55,0xFF,0x15,0xFF,0x76,0xFF,0xD3,0xEE,0x63,0xA9,0xA0,0xC0,0x60,0xD9,0x01,0xE3,0x83,0xAA,0x09,0x22,0xC9,0x19,0x88,0x09,
-	0x67,0x01,0x47,0x01,0x26,0x01,0x26,0x01,0xE5,0x00,0xE4,0x00,0xC4,0x00,0xA4,0x00,0xA4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA4,0x00,0xA5,0x00,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x41,0x00,0x61,0x00,0x62,0x00,0xA2,0x00,
-	0xC3,0x08,0x05,0x11,0x45,0x21,0x85,0x31,0x07,0x3A,0x28,0x4A,0x68,0x4A,0xC9,0x5A,0x0B,0x6B,0x4B,0x73,0x8C,0x73,0xCD,0x83,0xED,0x8B,0x0E,0x8C,0x2F,0x8C,0x4F,0x94,0x6F,0x9C,0x70,0x94,0x90,0x9C,0x90,0x9C,0xB0,0x9C,0xB0,0x9C,0xB0,0x9C,0xD0,0x9C,0xD1,0x9C,0xD1,0xA4,0xD1,0xA4,0xF1,0xA4,0xB1,0xA4,0xF1,0xA4,0xD1,0xA4,0xF1,0xA4,
-	0xF2,0xA4,0x12,0xAD,0x2F,0x94,0xA1,0x28,0x60,0x30,0x49,0xA3,0x78,0xF7,0xD5,0xEE,0x37,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xF7,0x16,0xEF,0xD5,0xEE,0x56,0xF7,0x8C,0xB4,0x71,0xC5,0xD4,0xEE,0x35,0xF7,0x56,0xFF,0x56,0xFF,0x56,0xFF,0x36,0xFF,0xB6,0xFF,0xF5,0xEE,0x03,0xE3,0x60,0xD9,0xA3,0xC3,0x2A,0x73,0xEC,0x52,0xEC,0x4A,0xAC,0x42,
-	0x29,0x2A,0x08,0x2A,0xC8,0x19,0x87,0x11,0x67,0x11,0x25,0x09,0x05,0x01,0xE4,0x00,0xC4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x41,0x00,
-	0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x61,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x82,0x00,0x82,0x00,0x83,0x00,0x83,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xE5,0x00,0xE5,0x00,0x05,0x01,0x26,0x01,0x26,0x09,0x67,0x11,
-	0x87,0x11,0xA8,0x19,0xA8,0x21,0xE8,0x29,0xE8,0x29,0x2A,0x2A,0x29,0x3A,0x8B,0x32,0x8B,0x3A,0x8B,0x3A,0xEB,0x4A,0xEB,0x4A,0x0C,0x5B,0x4D,0x5B,0x8D,0x63,0x8D,0x6B,0xCE,0x73,0xEF,0x7B,0xEF,0x7B,0x2F,0x84,0x30,0x84,0x70,0x8C,0x90,0x94,0x90,0x94,0x91,0x94,0xB1,0x94,0xB1,0x94,0xB1,0x9C,0xD1,0x9C,0xD1,0x9C,0xD1,0x9C,0x12,0xAD,
-	0xF2,0xA4,0x12,0xAD,0xE6,0x49,0x40,0x50,0x20,0x70,0x20,0x80,0xF6,0xEE,0x17,0xF7,0x16,0xF7,0x57,0xF7,0x17,0xF7,0x16,0xF7,0xD5,0xEE,0x16,0xF7,0x34,0xD6,0x2C,0xA4,0x39,0xEF,0xF0,0xDD,0x77,0xFF,0x76,0xFF,0x77,0xF7,0x56,0xF7,0x77,0xF7,0x56,0xFF,0x57,0xFF,0x76,0xF7,0x12,0xF7,0x92,0xC5,0x52,0xAD,0x92,0xBD,0xF3,0xCD,0x6F,0x94,
-	0x0F,0x84,0xCD,0x7B,0xCD,0x7B,0xAD,0x7B,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x8D,0x73,0x8C,0x73,0xAD,0x7B,0x8D,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x83,0x00,0x83,0x00,0xA3,0x00,
-	0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0x06,0x01,0x26,0x01,0x27,0x01,0x47,0x01,0x47,0x01,0x47,0x01,0x67,0x01,0x68,0x09,0x68,0x09,0xA8,0x09,0xA8,0x09,0xC9,0x11,0xEA,0x11,0x0A,0x1A,0x6B,0x2A,0x8B,0x32,0xAC,0x3A,0xEC,0x4A,0x2D,0x53,0x6E,0x5B,0xAE,0x6B,0x0F,0x7C,0x2F,0x84,0xB1,0x94,
-	0xD1,0xA4,0x2B,0x6B,0x60,0x30,0x20,0x78,0x60,0xC0,0x20,0x98,0x26,0x9A,0x37,0xF7,0x78,0xF7,0x37,0xF7,0x16,0xEF,0x74,0xE6,0x16,0xEF,0x95,0xE6,0x87,0x72,0x37,0xEF,0x92,0xEE,0x78,0xF7,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x77,0xFF,0x76,0xFF,0x56,0xF7,0x77,0xFF,0x97,0xFF,0x97,0xFF,0x77,0xF7,0x77,0xF7,0xF3,0xCD,0xB0,0xA4,
-	0xB0,0xA4,0xB0,0xA4,0xB0,0x9C,0xB0,0x9C,0xB0,0xA4,0x90,0x94,0x90,0x9C,0x90,0x9C,0x6F,0x94,0x6F,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xC5,0x00,0xA4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x26,0x01,0x47,0x01,0x67,0x01,0x88,0x01,
-	0x88,0x09,0xA8,0x09,0xA8,0x09,0xE9,0x11,0x09,0x12,0x09,0x12,0x2A,0x1A,0x2A,0x22,0x4B,0x2A,0x4B,0x2A,0x6B,0x2A,0xAC,0x3A,0xAC,0x3A,0xCC,0x42,0xED,0x4A,0x0D,0x4B,0x4E,0x53,0x6E,0x5B,0x6E,0x5B,0xCF,0x6B,0xCF,0x6B,0x0F,0x84,0x30,0x84,0x70,0x8C,0x70,0x94,0x90,0x94,0xD1,0x9C,0xD2,0x9C,0xF1,0xA4,0xF2,0xA4,0x33,0xB5,0x33,0xB5,
-	0xF2,0xAC,0x64,0x39,0x41,0x68,0x20,0x88,0x20,0xA0,0x20,0xA0,0x20,0x88,0x03,0x99,0xD2,0xDD,0xB6,0xEE,0xB5,0xEE,0xD4,0xEE,0x58,0xF7,0x48,0x8B,0xF2,0xDD,0xF4,0xF6,0x56,0xF7,0x56,0xFF,0x57,0xFF,0x77,0xFF,0x77,0xF7,0x77,0xF7,0x57,0xF7,0x57,0xF7,0x77,0xF7,0x77,0xF7,0x37,0xFF,0x77,0xFF,0x77,0xFF,0x94,0xE6,0xF1,0xA4,0xD1,0xA4,
-	0xB0,0xA4,0xB0,0x9C,0xB0,0xA4,0xB0,0xA4,0xB0,0x9C,0xB0,0xA4,0xB0,0xA4,0x90,0x9C,0x90,0x9C,0x90,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0x06,0x01,0x07,0x01,0x07,0x01,0x26,0x01,0x27,0x01,0x47,0x01,0x87,0x01,0x88,0x09,0xC9,0x09,0xE9,0x19,0x2A,0x1A,0x4B,0x22,0x6B,0x32,0xCC,0x3A,0xCC,0x42,0x0D,0x4B,0x2D,0x53,0x6E,0x5B,0xAF,0x6B,0xCF,0x6B,0x0F,0x7C,0x30,0x84,0x70,0x8C,0x70,0x94,0xB1,0x9C,0xD1,0xA4,0xF2,0xA4,0x12,0xAD,0x33,0xB5,0x33,0xB5,0x33,0xB5,
-	0x90,0x9C,0xE2,0x28,0x20,0x70,0x20,0x98,0x40,0xB8,0x40,0xB8,0xA1,0xA0,0x6D,0xC4,0x93,0xEE,0x15,0xF7,0xF3,0xEE,0xB2,0xEE,0xF2,0xD5,0x0A,0xAC,0xF4,0xF6,0x36,0xF7,0x77,0xFF,0x56,0xF7,0x56,0xFF,0x37,0xFF,0x57,0xF7,0x58,0xF7,0x57,0xF7,0x77,0xFF,0x57,0xF7,0x36,0xF7,0x77,0xFF,0x77,0xFF,0xD5,0xE6,0x11,0xAD,0xD1,0xA4,0xF0,0xA4,
-	0xB1,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0xB0,0xA4,0x90,0x9C,0xB0,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,
-	0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0x06,0x01,0x06,0x01,0x26,0x01,0xE6,0x00,0x07,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x88,0x01,0xA8,0x09,0xA9,0x09,0xE9,0x11,0x0A,0x1A,0x4B,0x2A,0x6B,0x32,0xAC,0x3A,0xCC,0x42,0x2D,0x4B,0x4E,0x5B,0x8E,0x5B,0xAE,0x6B,0xCF,0x73,0x0F,0x7C,0x50,0x84,0x70,0x8C,0x91,0x8C,0x91,0x94,0xB1,0x9C,
-	0x0F,0x8C,0xC2,0x20,0x20,0x70,0x40,0xB8,0x20,0x98,0xE2,0xA0,0x75,0xDE,0x98,0xF7,0x36,0xF7,0xD1,0xED,0xEE,0xE4,0x90,0xE5,0x90,0xDD,0xED,0xC4,0xF2,0xDD,0x98,0xF7,0x56,0xFF,0x56,0xFF,0x57,0xFF,0x57,0xF7,0x37,0xF7,0x37,0xF7,0x57,0xFF,0x77,0xF7,0x78,0xF7,0x98,0xF7,0x35,0xF7,0x33,0xD6,0x12,0xAD,0xF1,0xA4,0xF1,0xAC,0xD1,0xA4,
-	0xF1,0xA4,0xD0,0xA4,0xD0,0xA4,0xB0,0xA4,0xB0,0x9C,0x90,0x9C,0x8F,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xA5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,
-	0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0x07,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0x88,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0xEA,0x19,0x4A,0x22,0x8B,0x32,0xCC,0x3A,0xED,0x4A,0x0D,0x4B,0x0D,0x4B,0x2D,0x53,0x2D,0x53,0x2D,0x53,0x6E,0x53,0x6E,0x63,
-	0x4D,0x5B,0xA3,0x10,0x40,0x40,0x20,0x88,0xE2,0xA0,0x13,0xE6,0x17,0xEF,0xF7,0xEE,0x0E,0xD5,0x4F,0xE5,0x74,0xF6,0x74,0xF6,0x73,0xEE,0xB1,0xD5,0x87,0x92,0x12,0xE6,0xB7,0xFF,0x76,0xFF,0x76,0xFF,0xB8,0xFF,0x98,0xFF,0xB8,0xFF,0x98,0xF7,0x94,0xEE,0x8F,0xE5,0xE6,0xDA,0x6F,0xCD,0x92,0xE6,0x32,0xB5,0x12,0xAD,0xF1,0xA4,0xF1,0xA4,
-	0xB0,0x9C,0x70,0x94,0x2E,0x84,0x0F,0x84,0xAD,0x7B,0x8D,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0xE6,0x00,0x26,0x01,0xE6,0x00,0x06,0x01,0x06,0x01,0x26,0x01,0x26,0x01,0x07,0x01,0x47,0x01,0x47,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0x68,0x01,0xA9,0x01,0xA9,0x01,0xE9,0x01,0xE9,0x19,0x6B,0x2A,0x8B,0x32,0xEC,0x4A,0x2D,0x53,0x8E,0x63,0xAE,0x6B,0xEF,0x73,0x0F,0x84,0x2E,0x8C,0x4E,0x9C,0x6E,0x9C,
-	0xAE,0xB4,0x68,0x52,0x20,0x08,0x61,0x48,0x06,0xA2,0xD7,0xE6,0x17,0xEF,0x90,0xD5,0x0E,0xE5,0x74,0xF6,0x12,0xEE,0xD5,0xF6,0xF1,0xED,0x77,0xF7,0x24,0x92,0x20,0x88,0x06,0xBA,0x53,0xEE,0xB4,0xEE,0x90,0xCD,0x0F,0xEE,0xB0,0xE5,0x23,0xC1,0xE0,0xD0,0xA0,0xD9,0x23,0xB1,0xF6,0xE6,0xB5,0xFF,0x72,0xDE,0x12,0xAD,0xF2,0xA4,0xF2,0xA4,
-	0xF1,0xA4,0xF1,0xA4,0xB1,0xA4,0xB1,0x9C,0xB1,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xE4,0x00,0xE5,0x00,0xC5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,
-	0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE7,0x00,0x47,0x01,0x67,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0xC9,0x09,0x0A,0x1A,0x6B,0x32,0xEC,0x4A,0x6D,0x5B,0xCE,0x73,0x0F,0x84,0x2F,0x8C,0x0E,0x8C,0xCE,0xB4,0xCD,0xBC,0xEB,0x9B,0x86,0x72,0x24,0x62,0x42,0x31,0xC2,0x20,
-	0xA1,0x18,0x2B,0x73,0x22,0x39,0x20,0x08,0x8A,0x93,0xD6,0xF6,0xB6,0xE6,0x0F,0xDD,0x0E,0xE5,0x12,0xEE,0x53,0xF6,0x11,0xEE,0xF4,0xF6,0xB0,0xED,0xA1,0xA0,0x40,0xB8,0x22,0xB9,0x95,0xE6,0xD1,0xD5,0xC4,0x8A,0x46,0xE5,0x4C,0xDD,0x20,0xA0,0xC0,0xC8,0x26,0xC2,0x75,0xE6,0x98,0xFF,0x54,0xFF,0xF1,0xEE,0x72,0xBD,0x93,0xBD,0x0D,0xC4,
-	0x52,0xB5,0x93,0xBD,0x73,0xB5,0x73,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x01,
-	0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,
-	0xE6,0x00,0xE6,0x00,0x26,0x01,0x26,0x01,0x06,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x07,0x01,0x47,0x01,0x47,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xC9,0x09,0x0A,0x1A,0x6B,0x2A,0x8B,0x32,0xEC,0x4A,0x4D,0x5B,0xAD,0x7B,0x2D,0x94,0x2B,0xAC,0x89,0x9B,0x65,0x6A,0x01,0x39,0x80,0x18,0x40,0x10,0x60,0x10,0x60,0x20,0x60,0x10,
-	0x40,0x10,0x2A,0x7B,0x2E,0x9C,0x43,0x39,0x48,0x93,0xB5,0xEE,0x95,0xE6,0x2F,0xDD,0xC5,0x99,0x0F,0xD5,0x53,0xF6,0x0F,0xE6,0x33,0xE6,0x02,0x81,0x80,0xD0,0x80,0xD0,0x63,0xA9,0xD5,0xEE,0x52,0xE6,0x05,0xBC,0xE8,0xF5,0xD2,0xF6,0x6E,0xDC,0xB1,0xDD,0xD9,0xFF,0x76,0xFF,0x75,0xFF,0x71,0xFF,0xCF,0xF6,0xEB,0xD3,0x4E,0xBC,0x4A,0xD3,
-	0x6D,0xD4,0xAB,0xCB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA4,0x00,0xC5,0x00,0xC4,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0x06,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x47,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0x88,0x01,0xA9,0x09,0xC9,0x11,0x0A,0x1A,0x4A,0x22,0x6B,0x2A,0x8B,0x32,0xCC,0x42,0x0C,0x5B,0xEF,0xBC,0xE7,0x7A,0xC3,0x51,0x42,0x41,0xA1,0x30,0x02,0x29,0xC1,0x30,0x01,0x39,0xA1,0x30,0x60,0x20,0x60,0x20,
-	0x40,0x10,0xE4,0x51,0x31,0xB5,0xB2,0xDD,0x50,0xCD,0xB1,0xD5,0xB1,0xD5,0xED,0xC4,0x21,0x41,0x22,0x69,0x6F,0xED,0x50,0xE6,0x27,0xBA,0x44,0xA9,0x87,0xD2,0x08,0xBB,0x92,0xDD,0x16,0xEF,0x76,0xF7,0xF2,0xEE,0x53,0xDE,0x35,0xF7,0x97,0xFF,0x77,0xFF,0x76,0xFF,0x54,0xFF,0x34,0xFF,0x71,0xFF,0x0C,0xDD,0xA5,0xE0,0x06,0xE9,0x06,0xE9,
-	0xA7,0xE1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x00,0x82,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0x05,0x01,0x05,0x01,0xE5,0x00,0xE5,0x00,
-	0x06,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x47,0x01,0x47,0x01,0x47,0x01,0x67,0x01,0x68,0x01,0x88,0x01,0xA9,0x01,0xA9,0x01,0xA9,0x09,0xC9,0x11,0xC9,0x11,0x0A,0x1A,0x2A,0x1A,0x2A,0x22,0x4B,0x2A,0x8B,0x32,0x4A,0x32,0xC8,0x72,0x8C,0xB4,0x45,0x6A,0x64,0x39,0x21,0x41,0x22,0x41,0x01,0x39,0xA1,0x28,0xA1,0x30,0x60,0x20,0x60,0x20,
-	0x40,0x18,0x20,0x08,0x2A,0x73,0xD4,0xCD,0xB6,0xE6,0x13,0xDE,0x0E,0xD5,0xE7,0x82,0xA4,0x82,0xED,0xCC,0x11,0xE6,0x18,0xEF,0x9A,0xF7,0xDA,0xF7,0xBA,0xF7,0xBA,0xF7,0x79,0xF7,0x57,0xF7,0x56,0xFF,0x14,0xFF,0xD4,0xEE,0x15,0xF7,0x76,0xFF,0x56,0xF7,0x55,0xF7,0x75,0xFF,0xD2,0xE6,0xEC,0xC4,0x4B,0xB4,0xA6,0xC9,0x65,0xC1,0xA5,0xE0,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x61,0x00,0x41,0x00,0x42,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xC4,0x00,0x05,0x01,0x05,0x01,0x26,0x01,0x26,0x01,0x26,0x01,0x47,0x01,0x67,0x01,0x67,0x01,0x88,0x09,0xA8,0x09,0xA8,0x11,0xA9,0x09,0xE9,0x11,0x09,0x12,0x2A,0x22,0x2A,0x22,0x6B,0x2A,0x8C,0x32,0xAC,0x42,0xEC,0x42,0x28,0x32,0xA4,0x41,0xAD,0xB4,0x2C,0xA4,0xE4,0x61,0xA0,0x28,0xA1,0x28,0xA1,0x28,0xA1,0x30,0x80,0x28,0x80,0x28,
-	0x60,0x20,0x40,0x18,0x40,0x08,0xE5,0x51,0x51,0xBD,0xF7,0xEE,0xD2,0xCD,0xE4,0x61,0xED,0xC4,0xF7,0xEE,0xF7,0xEE,0x38,0xF7,0x38,0xF7,0x38,0xF7,0x37,0xF7,0x37,0xF7,0x58,0xF7,0x77,0xF7,0x76,0xFF,0xF3,0xF6,0xB3,0xEE,0x16,0xF7,0x35,0xF7,0x96,0xF7,0x95,0xFF,0x2B,0xD4,0xC6,0x82,0xA9,0x9B,0xA9,0xD2,0x45,0xF0,0xA5,0xE0,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x83,0x00,0x83,0x00,0xA3,0x00,
-	0xA3,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0x25,0x01,0x25,0x01,0x26,0x01,0x46,0x09,0x46,0x09,0x67,0x09,0xA8,0x11,0xA8,0x11,0xC8,0x19,0xE9,0x21,0xE9,0x29,0x4A,0x2A,0x8B,0x3A,0xCC,0x42,0xED,0x4A,0x4D,0x5B,0x6D,0x63,0xCE,0x73,0xA6,0x39,0xA2,0x10,0xA7,0x6A,0xCE,0xBC,0x2B,0xAC,0x25,0x62,0x02,0x39,0xA1,0x18,0x80,0x20,0x80,0x20,
-	0x60,0x20,0x60,0x20,0x60,0x20,0x20,0x08,0x81,0x18,0xAA,0x93,0xE3,0x61,0x2A,0xAC,0x34,0xDE,0x18,0xEF,0xF7,0xEE,0xF7,0xEE,0xD7,0xEE,0xD6,0xEE,0x36,0xEF,0x36,0xF7,0x56,0xF7,0x56,0xF7,0x55,0xF7,0x52,0xF7,0xD4,0xF6,0x55,0xF7,0xD4,0xF6,0x4D,0xED,0xE5,0xB1,0xC2,0x78,0x69,0x93,0x89,0x9B,0xE6,0xB9,0x06,0xE1,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,
-	0xA3,0x00,0xC4,0x00,0xE4,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x26,0x01,0x26,0x01,0x26,0x09,0x67,0x09,0x87,0x09,0xA8,0x11,0xC8,0x11,0xE9,0x21,0x2A,0x2A,0x4A,0x2A,0x8B,0x3A,0xAB,0x3A,0xED,0x4A,0x0C,0x53,0x6E,0x63,0x8D,0x6B,0xEA,0x5A,0x20,0x00,0x00,0x00,0xA1,0x20,0xE7,0x7A,0x0D,0xCD,0xF0,0xD5,0x8B,0xB4,0x86,0x6A,0x21,0x39,
-	0x40,0x18,0x00,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x60,0x20,0x28,0x8B,0x27,0x93,0x90,0xD5,0xF6,0xEE,0x38,0xF7,0xB9,0xF7,0xB9,0xF7,0xB9,0xF7,0xB8,0xF7,0x96,0xF7,0x96,0xF7,0x14,0xF7,0xAF,0xDD,0x46,0xB2,0x43,0xA9,0xC3,0xC9,0x42,0xC1,0x40,0xA0,0xA3,0x71,0xA7,0x7A,0xE7,0x7A,0x48,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xA4,0x00,0xC4,0x00,0xC4,0x00,0xA4,0x00,0xC5,0x00,0xE5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,
-	0x06,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x47,0x01,0x47,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0xA9,0x01,0xA9,0x09,0xC9,0x09,0x0A,0x1A,0x2A,0x1A,0x4B,0x22,0x4B,0x2A,0xAC,0x3A,0xCC,0x42,0xED,0x4A,0x4D,0x5B,0x8D,0x6B,0x4C,0x6B,0x61,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x18,0xE4,0x59,0x0A,0xA4,0x90,0xD5,0x10,0xDE,
-	0x2D,0xCD,0x88,0x93,0xE4,0x51,0x02,0x29,0x80,0x20,0x64,0x7A,0xA9,0xAB,0x60,0x10,0x60,0x30,0x20,0x70,0x64,0x99,0x08,0xAB,0x49,0xBB,0x48,0xAB,0x87,0xB2,0x08,0xA3,0x64,0xA1,0x61,0x90,0x20,0x98,0x20,0x98,0x60,0xB0,0x60,0x90,0x81,0x78,0xC4,0x61,0x47,0x5A,0x24,0x6A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0x00,0xA4,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,0x06,0x01,
-	0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x47,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0xA9,0x01,0xA9,0x01,0xC9,0x11,0x2A,0x1A,0x2A,0x1A,0x4B,0x22,0x8B,0x32,0xAC,0x3A,0xCC,0x42,0xED,0x4A,0x4E,0x5B,0x6D,0x63,0x85,0x29,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x18,0x60,0x18,0xC1,0x30,0x02,0x29,0x63,0x49,
-	0x85,0x72,0xA9,0x93,0x0D,0xCD,0xCC,0xC4,0x82,0x49,0xC9,0xA3,0x6B,0xB4,0x45,0x62,0x83,0x51,0xA1,0x50,0x61,0x50,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x80,0x38,0x40,0x30,0x40,0x38,0x20,0x28,0x40,0x30,0xA1,0x30,0xC1,0x30,0x02,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xC4,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0xE6,0x00,0x06,0x01,0x07,0x01,
-	0x06,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x67,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0xA9,0x01,0xA9,0x09,0xEA,0x19,0x2A,0x1A,0x2A,0x22,0x4B,0x2A,0x8C,0x32,0xCC,0x42,0x0D,0x53,0x4E,0x5B,0x4C,0x63,0x00,0x00,0x00,0x00,0x20,0x08,0x80,0x28,0xC1,0x30,0xC1,0x30,0x41,0x41,0x62,0x49,
-	0x63,0x41,0x83,0x49,0x62,0x49,0xE1,0x38,0xE7,0x82,0x4B,0xB4,0x2C,0xC5,0xD0,0xE6,0xF1,0xEE,0x91,0xEE,0x0F,0xE6,0x6E,0xE5,0x2D,0xCD,0xCC,0xBC,0xAC,0xB4,0x6B,0xAC,0x6B,0xAC,0x6B,0xAC,0x6B,0xAC,0xAB,0xB4,0xAB,0xB4,0xAC,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xA4,0x00,0xA5,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,
-	0x06,0x01,0xE6,0x00,0x26,0x01,0x26,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x27,0x01,0x47,0x01,0x67,0x01,0x68,0x01,0x88,0x01,0xA9,0x01,0xA9,0x09,0xC9,0x11,0x09,0x12,0x2A,0x1A,0x4B,0x2A,0xAC,0x3A,0xCC,0x42,0x0D,0x53,0x0B,0x5B,0x00,0x00,0x00,0x00,0x20,0x08,0x60,0x20,0xE1,0x38,0x62,0x49,0x84,0x39,0x62,0x49,
-	0x63,0x41,0xE4,0x59,0x01,0x39,0x65,0x6A,0x0C,0xC5,0x07,0x83,0xA6,0x72,0xC9,0x6A,0xC6,0x82,0x89,0x93,0xC9,0x9B,0x4B,0xAC,0xAC,0xBC,0x0D,0xC5,0x2D,0xC5,0x6D,0xCD,0x6D,0xCD,0xAE,0xD5,0xCF,0xD5,0x0F,0xE6,0xAE,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x83,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC5,0x00,0xE5,0x00,
-	0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x06,0x01,0x26,0x01,0x27,0x01,0x47,0x01,0x47,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0xA9,0x01,0xA9,0x09,0xC9,0x11,0x0A,0x1A,0x4B,0x2A,0x8C,0x32,0xED,0x4A,0x0D,0x53,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x18,0x80,0x28,0xA1,0x30,0x21,0x41,0xA3,0x51,
-	0xC5,0x49,0xC1,0x38,0x82,0x51,0x6A,0xB4,0xE7,0x82,0xA6,0x72,0x6A,0x83,0x69,0x93,0xA9,0x9B,0x69,0x93,0x08,0x83,0x08,0x83,0x07,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x89,0x9B,0xA9,0x9B,0xA9,0x9B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,
-	0xA4,0x00,0xA4,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE6,0x00,0xE6,0x00,0xE6,0x00,0x06,0x01,0x26,0x01,0x27,0x01,0x47,0x01,0x47,0x01,0x68,0x01,0x68,0x01,0x88,0x01,0xC9,0x09,0xE9,0x11,0x4B,0x2A,0xCC,0x42,0x0D,0x53,0x24,0x21,0x00,0x00,0x20,0x00,0x40,0x08,0x60,0x20,0xA1,0x30,0xA1,0x30,0x22,0x39,
-	0x62,0x49,0x21,0x41,0x69,0x9B,0xC9,0x6A,0xE4,0x59,0x25,0x62,0x85,0x72,0xE7,0x7A,0x69,0x93,0xA9,0x9B,0xCA,0x9B,0xEA,0xAB,0x0A,0xAC,0x0B,0xAC,0x8B,0xBC,0x8B,0xBC,0x8B,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x62,0x00,0x62,0x00,0x82,0x00,0x63,0x00,0x63,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xC4,0x00,
-	0xA4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xC5,0x00,0xC4,0x00,0xE5,0x00,0xE5,0x00,0x05,0x01,0x06,0x01,0x46,0x01,0x46,0x09,0x66,0x09,0x87,0x11,0xA7,0x19,0xA8,0x21,0x29,0x32,0x49,0x42,0x8A,0x4A,0x08,0x3A,0x00,0x00,0x20,0x00,0x40,0x18,0x60,0x10,0x80,0x28,0x03,0x29,0x43,0x72,
-	0xC1,0x30,0xE7,0x82,0xEA,0xA3,0x69,0x93,0xA9,0x9B,0x28,0x83,0x86,0x72,0x86,0x72,0xE9,0x6A,0xE7,0x7A,0x28,0x83,0x69,0x93,0xCA,0xA3,0x6B,0xB4,0xED,0xC4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x83,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xC4,0x00,0xE4,0x00,0x05,0x01,0x06,0x09,0x46,0x11,0x87,0x19,0xC8,0x21,0x08,0x32,0x69,0x42,0xAB,0x42,0xEA,0x5A,0x2C,0x63,0x6C,0x6B,0xAD,0x73,0xEE,0x83,0x2E,0x8C,0x4E,0x94,0x4F,0x94,0x6F,0x9C,0x2E,0x94,0x03,0x21,0x20,0x08,0x40,0x18,0xC1,0x30,0xA1,0x30,0xA0,0x28,0xC3,0x61,
-	0xA2,0x51,0x88,0x9B,0x08,0x83,0x69,0x93,0xCA,0xA3,0x0A,0xAC,0x2B,0xB4,0x8B,0xBC,0x8C,0xBC,0xEC,0xC4,0xCD,0xBC,0xCD,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x83,0x00,0x83,0x00,
-	0x83,0x00,0x83,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xC4,0x00,0xE4,0x00,0x05,0x01,0x46,0x01,0x47,0x09,0x87,0x11,0xA8,0x19,0xE9,0x21,0x49,0x32,0x49,0x3A,0x8A,0x4A,0xCB,0x52,0x0B,0x5B,0x4C,0x6B,0x8D,0x73,0xAD,0x7B,0xEE,0x7B,0x2F,0x84,0x4F,0x94,0x2E,0x84,0xC2,0x18,0x40,0x10,0x60,0x20,0x01,0x39,0xC1,0x28,0x03,0x62,
-	0x86,0x7A,0xA6,0x7A,0xC7,0x7A,0x89,0x93,0xEA,0xAB,0x0A,0xAC,0x2B,0xB4,0x6B,0xBC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x83,0x00,
-	0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA4,0x00,0xC4,0x00,0xE4,0x00,0x05,0x01,0x26,0x01,0x67,0x09,0x87,0x11,0xA8,0x19,0xE9,0x21,0x0A,0x22,0x4B,0x32,0x8B,0x3A,0xEC,0x4A,0xED,0x4A,0x2C,0x5B,0x6D,0x6B,0x8D,0x6B,0xCE,0x73,0xEE,0x7B,0x2F,0x84,0x4F,0x8C,0x50,0x8C,0x90,0x94,0xCD,0x83,0x23,0x21,0x40,0x10,0x60,0x20,0x80,0x18,0x63,0x7A,
-	0x07,0x83,0xE4,0x61,0x47,0x5A,0xA6,0x72,0xE7,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,
-	0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xA4,0x00,0xC4,0x00,0xC4,0x00,0xC5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0xE5,0x00,0x05,0x01,0x05,0x01,0x26,0x01,0x26,0x01,0x47,0x01,0x47,0x01,0x68,0x01,0x68,0x01,0xA9,0x01,0xA8,0x09,0x87,0x11,0x87,0x11,0xC8,0x19,0xE9,0x21,0xAC,0x3A,0xE3,0x20,0x60,0x20,0x22,0x49,0x84,0x7A,
-	0x05,0x62,0x83,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x01,0x27,0x01,0x47,0x01,0x48,0x01,0x68,0x01,0x88,0x01,0xC9,0x01,0xA9,0x11,0x0A,0x12,0x2A,0x1A,0x6C,0x1A,0x6C,0x22,0x8C,0x32,0xCC,0x3A,0x0E,0x3B,0x2D,0x4B,0xAB,0x3A,0x69,0x42,0xCB,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_228_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_228_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_228_dial_img_preview_data_0};
-
-    
\ No newline at end of file
@@ -229,9 +229,12 @@ void init_face_34_2(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_34_2_14_118067, 192);
     lv_obj_add_flag(face_34_2_14_118067, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_34_2_14_118067, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_34_2_0_304);
+	face_compositor_static(face_34_2_1_58396);
+	face_compositor_static(face_34_2_4_58396);
 
 
-    callback("Shadow", &face_34_2_dial_img_preview_0, &face_34_2, NULL);
+    callback("Shadow", NULL, &face_34_2, NULL);
 
 #endif
 }
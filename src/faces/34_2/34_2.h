@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_34_2 // (Shadow) uncomment to enable or define it elsewhere
 
@@ -81,8 +82,6 @@ extern "C"
 	LV_IMG_DECLARE(face_34_2_dial_img_14_118067_4);
 	LV_IMG_DECLARE(face_34_2_dial_img_14_118067_5);
 	LV_IMG_DECLARE(face_34_2_dial_img_14_118067_6);
-	LV_IMG_DECLARE(face_34_2_dial_img_preview_0);
-	LV_IMG_DECLARE(face_34_2_dial_img_preview_0);
 
 
 #endif
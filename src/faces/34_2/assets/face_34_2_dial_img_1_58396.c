@@ -5,6 +5,7 @@
 // Watchface: 34_2
 
 #include "../34_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,13 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_1_58396_data_0[] = {
-	//RGB565 data 
-	0xA2,0x10,0x45,0x29,0x45,0x29,0x45,0x29,0x04,0x21,0x65,0x29,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAA,0x52,0x61,0x08,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xA2,0x10,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_34_2_dial_img_1_58396_data_0, "face_34_2_dial_img_1_58396_data_0.bin");
         
 
 
@@ -26,7 +21,7 @@ const lv_img_dsc_t face_34_2_dial_img_1_58396_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 3,
-    .data_size = sizeof(face_34_2_dial_img_1_58396_data_0),
+    .data_size = 45,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_1_58396_data_0};
 
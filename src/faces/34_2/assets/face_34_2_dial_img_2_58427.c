@@ -5,6 +5,7 @@
 // Watchface: 34_2
 
 #include "../34_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,17 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x49,0x4A,0x49,0x4A,0x49,0x4A,0x49,0x4A,0x61,0x08,0x00,0x00,0x20,0x00,0xAA,0x52,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xEB,0x5A,0x61,0x08,
-	0x65,0x29,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0x2C,0x63,0xE7,0x39,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xE7,0x39,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xE7,0x39,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xE7,0x39,
-	0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xE7,0x39,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x2C,0x63,0xE7,0x39,0xC3,0x18,0x2C,0x63,0xEB,0x5A,0xE7,0x39,0xE7,0x39,0x8A,0x52,0x2C,0x63,0x65,0x29,0x00,0x00,0x04,0x21,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x65,0x29,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_0, "face_34_2_dial_img_2_58427_data_0.bin");
         
 
 
@@ -30,23 +21,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_0),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE7,0x39,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_1, "face_34_2_dial_img_2_58427_data_1.bin");
         
 
 
@@ -54,23 +35,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_1),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x45,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xA6,0x31,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xAA,0x52,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x2C,0x63,0x00,0x00,0x00,0x00,0xA2,0x10,0x49,0x4A,0x49,0x4A,0x8A,0x52,0x2C,0x63,0x49,0x4A,0x00,0x00,0x61,0x08,0xEB,0x5A,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x49,0x4A,0x20,0x00,
-	0x00,0x00,0x65,0x29,0x2C,0x63,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0x49,0x4A,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_2, "face_34_2_dial_img_2_58427_data_2.bin");
         
 
 
@@ -78,23 +49,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_2),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x61,0x08,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAA,0x52,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x2C,0x63,0x65,0x29,0x00,0x00,0x45,0x29,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xEB,0x5A,0x2C,0x63,0xA2,0x10,0x00,0x00,0x45,0x29,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xEB,0x5A,0x2C,0x63,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x2C,0x63,0x65,0x29,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xAA,0x52,0x2C,0x63,0xC3,0x18,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x65,0x29,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_3, "face_34_2_dial_img_2_58427_data_3.bin");
         
 
 
@@ -102,23 +63,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_3),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x49,0x4A,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0x2C,0x63,0x2C,0x63,0x65,0x29,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x45,0x29,0x2C,0x63,0x8A,0x52,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x61,0x08,0xEB,0x5A,0xAA,0x52,0xC3,0x18,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x49,0x4A,0x2C,0x63,0xA2,0x10,0xC3,0x18,0x2C,0x63,0x65,0x29,0x00,0x00,0x45,0x29,0x2C,0x63,0xA6,0x31,0x00,0x00,0xC3,0x18,0x2C,0x63,0x65,0x29,0x00,0x00,
-	0x65,0x29,0x2C,0x63,0xEB,0x5A,0xAA,0x52,0xEB,0x5A,0x2C,0x63,0xEB,0x5A,0x08,0x42,0x45,0x29,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xEB,0x5A,0x2C,0x63,0xEB,0x5A,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x2C,0x63,0x65,0x29,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_4, "face_34_2_dial_img_2_58427_data_4.bin");
         
 
 
@@ -126,23 +77,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_4),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x61,0x08,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xC3,0x18,
-	0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x2C,0x63,0x8A,0x52,0xE7,0x39,0xE7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xEB,0x5A,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x65,0x29,0x2C,0x63,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x2C,0x63,0x45,0x29,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xAA,0x52,0x2C,0x63,0xA2,0x10,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x65,0x29,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_5, "face_34_2_dial_img_2_58427_data_5.bin");
         
 
 
@@ -150,23 +91,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_5),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xA6,0x31,0x00,0x00,0xC3,0x18,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAA,0x52,
-	0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0xEB,0x5A,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xC3,0x18,0x00,0x00,0x65,0x29,0x2C,0x63,0xEB,0x5A,0xAA,0x52,0xAA,0x52,0xEB,0x5A,0xEB,0x5A,
-	0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0x00,0x00,0x45,0x29,0x2C,0x63,0x49,0x4A,0xE7,0x39,0xE7,0x39,0xAA,0x52,0x2C,0x63,0x00,0x00,0x00,0x00,0x08,0x42,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x65,0x29,
-	
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_6, "face_34_2_dial_img_2_58427_data_6.bin");
         
 
 
@@ -174,23 +105,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_6),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x00,0x00,0x65,0x29,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xEB,0x5A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x2C,0x63,0x65,0x29,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xEB,0x5A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xEB,0x5A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xAA,0x52,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_7, "face_34_2_dial_img_2_58427_data_7.bin");
         
 
 
@@ -198,23 +119,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_7),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x20,0x00,0x00,0x00,0x20,0x00,0xAA,0x52,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x49,0x4A,0x00,0x00,
-	0x65,0x29,0x2C,0x63,0x65,0x29,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0x04,0x21,0x65,0x29,0x2C,0x63,0x04,0x21,0x00,0x00,0x00,0x00,0x65,0x29,0x2C,0x63,0x45,0x29,0xA2,0x10,0xEB,0x5A,0x2C,0x63,0xAA,0x52,0xAA,0x52,0x2C,0x63,0xAA,0x52,0x20,0x00,0x61,0x08,0xEB,0x5A,0x2C,0x63,0xAA,0x52,0xAA,0x52,0x2C,0x63,0xAA,0x52,0x20,0x00,
-	0x65,0x29,0x2C,0x63,0x04,0x21,0x00,0x00,0x00,0x00,0xA6,0x31,0x2C,0x63,0x45,0x29,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x45,0x29,0x2C,0x63,0x45,0x29,0xC3,0x18,0x2C,0x63,0xEB,0x5A,0xE7,0x39,0xE7,0x39,0xEB,0x5A,0xEB,0x5A,0x61,0x08,0x00,0x00,0x04,0x21,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xEB,0x5A,0xC3,0x18,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_8, "face_34_2_dial_img_2_58427_data_8.bin");
         
 
 
@@ -222,23 +133,13 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_8),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_34_2_dial_img_2_58427_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0x20,0x00,0x00,0x00,0x04,0x21,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x49,0x4A,
-	0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x49,0x4A,0x2C,0x63,0x00,0x00,0x65,0x29,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0x00,0x00,0x65,0x29,0x2C,0x63,0x65,0x29,0xC3,0x18,0xC3,0x18,0x49,0x4A,0x2C,0x63,0x00,0x00,0xA2,0x10,0xEB,0x5A,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,0x65,0x29,0x65,0x29,0x8A,0x52,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x2C,0x63,0x00,0x00,0xA2,0x10,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xE7,0x39,0xEB,0x5A,0x2C,0x63,0x00,0x00,0x45,0x29,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xEB,0x5A,0xC3,0x18,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_34_2_dial_img_2_58427_data_9, "face_34_2_dial_img_2_58427_data_9.bin");
         
 
 
@@ -246,7 +147,7 @@ const lv_img_dsc_t face_34_2_dial_img_2_58427_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 12,
-    .data_size = sizeof(face_34_2_dial_img_2_58427_data_9),
+    .data_size = 288,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_34_2_dial_img_2_58427_data_9};
 
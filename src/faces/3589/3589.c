@@ -223,9 +223,11 @@ void init_face_3589(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_3589_11_132664, 137);
     lv_obj_add_flag(face_3589_11_132664, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_3589_11_132664, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_3589_0_244);
+	face_compositor_static(face_3589_7_70336);
 
 
-    callback("3589", &face_3589_dial_img_preview_0, &face_3589, NULL);
+    callback("3589", NULL, &face_3589, NULL);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_3589 // (3589) uncomment to enable or define it elsewhere
 
@@ -98,8 +99,6 @@ extern "C"
 	LV_IMG_DECLARE(face_3589_dial_img_11_132664_7);
 	LV_IMG_DECLARE(face_3589_dial_img_11_132664_8);
 	LV_IMG_DECLARE(face_3589_dial_img_11_132664_9);
-	LV_IMG_DECLARE(face_3589_dial_img_preview_0);
-	LV_IMG_DECLARE(face_3589_dial_img_preview_0);
 
 
 #endif
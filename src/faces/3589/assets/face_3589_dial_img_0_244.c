@@ -5,6 +5,7 @@
 // Watchface: 3589
 
 #include "../3589.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,2158 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_0_244_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x63,0x10,0x23,0x10,0x64,0x10,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x23,0x10,0x63,0x10,0x24,0x10,0x64,0x18,0x64,0x18,0x64,0x18,0x64,0x18,0x23,0x10,
-	0x22,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,
-	0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x63,0x10,0x64,0x10,0x65,0x20,0x64,0x20,0x64,0x18,0x65,0x20,0xA6,0x28,0x65,0x18,0x64,0x18,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x63,0x10,0x23,0x10,0x24,0x18,0x64,0x18,0x65,0x20,0x65,0x18,0x65,0x18,0x65,0x20,0x65,0x20,0x66,0x20,0x65,0x18,
-	0x64,0x18,0x63,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x23,0x10,0x23,0x10,0x64,0x10,0x64,0x18,0x64,0x18,0x65,0x18,0x65,0x20,0x65,0x20,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x65,0x18,0x24,0x18,0x63,0x10,0x63,0x10,0x64,0x18,0x64,0x18,0x63,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,
-	0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x63,0x10,0x23,0x10,0x63,0x10,0x64,0x18,0x64,0x18,0x65,0x18,0x65,0x20,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0xA6,0x28,
-	0x65,0x20,0x65,0x18,0x65,0x18,0x65,0x20,0x65,0x18,0x64,0x18,0x24,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x23,0x10,
-	0x63,0x10,0x63,0x10,0x64,0x18,0x64,0x18,0x64,0x18,0x65,0x20,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0xA6,0x28,0xA7,0x20,0x66,0x28,0xA7,0x20,0x67,0x28,0xA7,0x20,0x67,0x28,0xA7,0x30,0xA7,0x20,0x66,0x28,0x66,0x20,0x65,0x20,0x64,0x18,0x63,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x10,
-	0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x63,0x10,0x23,0x10,0x63,0x18,0x64,0x18,0x64,0x18,0x65,0x20,0x66,0x20,0x66,0x28,0xA7,0x20,0xA8,0x28,0xA7,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA7,0x30,0xA9,0x30,0xA9,0x30,
-	0xA9,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x30,0xA7,0x30,0x66,0x20,0x65,0x20,0x64,0x18,0x64,0x18,0x64,0x18,0x63,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x23,0x10,0x63,0x10,0x64,0x18,0x64,0x18,0x65,0x18,
-	0x65,0x20,0x66,0x28,0xA7,0x20,0xA7,0x30,0xA8,0x28,0xA9,0x30,0xA9,0x30,0xAA,0x38,0xAA,0x38,0xEB,0x48,0xAA,0x38,0xA9,0x40,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xEB,0x48,0xEB,0x48,0x2C,0x59,0xEB,0x48,0xEB,0x48,0xAA,0x38,0xA9,0x30,0x67,0x28,0x66,0x28,0xA6,0x28,0x65,0x20,0x64,0x18,0x64,0x18,0x63,0x18,0x23,0x10,0x63,0x10,0x22,0x08,
-	0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x63,0x10,0x63,0x18,0x64,0x18,0x64,0x18,0x65,0x20,0x65,0x20,0xA6,0x28,0xA7,0x20,0x67,0x28,0xA7,0x30,0xA9,0x30,0xA9,0x30,0xAA,0x38,0xA9,0x40,0xEB,0x48,0xAA,0x38,0xEB,0x48,0xEB,0x48,0xEB,0x48,0xEB,0x48,0xEB,0x48,0xEB,0x48,
-	0x2C,0x59,0x2C,0x59,0x2C,0x59,0xEB,0x48,0xEB,0x48,0xA9,0x30,0xA8,0x28,0xA9,0x30,0xA7,0x30,0x66,0x28,0x66,0x20,0x65,0x20,0x65,0x18,0x64,0x18,0x64,0x18,0x63,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x63,0x10,0x23,0x10,0x63,0x18,0x64,0x18,0x64,0x18,0x65,0x20,0x65,0x20,
-	0x66,0x20,0x66,0x28,0xA7,0x30,0xA8,0x28,0xA9,0x30,0xA9,0x30,0xAA,0x38,0xEB,0x38,0xEB,0x48,0xEB,0x48,0xEB,0x48,0xEB,0x48,0xEB,0x48,0xEB,0x48,0xEB,0x48,0x2C,0x59,0x2C,0x59,0x2C,0x59,0x2C,0x59,0x2C,0x59,0xAA,0x38,0xA9,0x30,0xA9,0x40,0xA9,0x30,0x67,0x28,0xA6,0x28,0x66,0x28,0x66,0x20,0x66,0x20,0x65,0x20,0x65,0x20,0x64,0x18,
-	0x64,0x18,0x63,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x23,0x10,0x63,0x18,0x63,0x18,
-	0x23,0x18,0x63,0x18,0x23,0x10,0x22,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x63,0x10,0x22,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x64,0x18,0x64,0x18,0x65,0x20,0x65,0x20,0x66,0x28,0xA7,0x20,0xA7,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x40,0xAA,0x38,0xEB,0x48,0xEB,0x48,0xCC,0x40,0xCC,0x40,0xCC,0x40,0x2C,0x59,0x2C,0x59,0xED,0x58,0x2C,0x59,
-	0xEE,0x71,0xEE,0x71,0x2F,0x61,0xEB,0x48,0xA9,0x40,0xEB,0x48,0xA9,0x30,0xA7,0x30,0xA7,0x20,0x66,0x28,0x66,0x20,0xA6,0x28,0x66,0x20,0x65,0x20,0x65,0x20,0x65,0x20,0x64,0x18,0x64,0x18,0x63,0x18,0x63,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x64,0x18,0x63,0x18,0x64,0x18,0x64,0x18,0x64,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x63,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x64,0x18,0x64,0x18,0x64,0x20,0x65,0x20,0x66,0x20,
-	0x66,0x28,0xA7,0x30,0xA9,0x30,0xA9,0x30,0xAA,0x38,0xEB,0x48,0xEB,0x48,0xED,0x58,0x2C,0x59,0x2C,0x59,0x2C,0x59,0xEE,0x71,0x2F,0x61,0xEE,0x71,0xEE,0x71,0xEE,0x71,0xEE,0x71,0x10,0x83,0xEE,0x71,0x2C,0x59,0xEB,0x48,0xEB,0x48,0xA9,0x30,0xA7,0x30,0x67,0x28,0x66,0x28,0xA6,0x28,0x66,0x28,0x66,0x20,0x65,0x20,0x65,0x20,0x65,0x20,
-	0x64,0x18,0x24,0x18,0x64,0x18,0x23,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x63,0x18,0x23,0x18,0x64,0x18,0x24,0x18,0x63,0x18,
-	0x23,0x10,0x63,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x23,0x10,0x63,0x10,0x23,0x10,0x63,0x10,0x63,0x18,0x63,0x18,0x66,0x28,0x66,0x20,0x66,0x28,0xA7,0x30,0xA9,0x30,0xEB,0x48,0xEB,0x48,0x2C,0x59,0x2C,0x59,0xEE,0x71,0xEE,0x71,0xEE,0x71,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,
-	0x10,0x83,0x10,0x83,0x10,0x83,0xEE,0x71,0xEE,0x71,0xEB,0x48,0xEB,0x48,0xAA,0x38,0xA9,0x30,0x67,0x28,0x67,0x28,0xA7,0x30,0xA6,0x28,0x65,0x20,0x65,0x20,0x65,0x20,0x64,0x18,0x64,0x18,0x63,0x18,0x23,0x10,0x63,0x18,0x23,0x10,0x23,0x18,0x63,0x18,0x24,0x10,0x23,0x18,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,
-	0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x63,0x10,0x22,0x10,0x23,0x18,0x63,0x18,0x63,0x18,0x64,0x18,0x64,0x18,0x63,0x18,0x63,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x63,0x18,0x63,0x18,0x64,0x18,0x64,0x18,0x65,0x20,0x67,0x28,0xA9,0x30,0xEB,0x48,0xEB,0x48,0x2C,0x59,0x2F,0x61,0xEE,0x71,
-	0xEE,0x71,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x10,0x83,0x32,0x94,0x10,0x83,0xEE,0x71,0xEE,0x71,0x2F,0x61,0x2C,0x59,0xED,0x58,0xEB,0x48,0xAA,0x38,0xA7,0x30,0x67,0x28,0x66,0x20,0x65,0x20,
-	0x64,0x18,0x64,0x18,0x64,0x18,0x63,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x63,0x18,0x23,0x10,0x63,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x10,0x63,0x10,0x23,0x10,0x23,0x18,0x64,0x18,0x23,0x18,0x64,0x18,0x23,0x18,
-	0x63,0x18,0x64,0x18,0x64,0x20,0x66,0x28,0xA7,0x30,0xA9,0x30,0xA9,0x40,0xED,0x58,0x2C,0x59,0x2F,0x61,0xEE,0x71,0xB1,0x71,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,
-	0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x10,0x83,0x10,0x83,0x10,0x83,0xEE,0x71,0xEE,0x71,0x2F,0x61,0x2C,0x59,0xEB,0x48,0xAB,0x40,0xA7,0x30,0x66,0x20,0x65,0x20,0x64,0x18,0x64,0x18,0x24,0x18,0x63,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,
-	0x22,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,
-	0x25,0x00,0x4A,0x00,0x4A,0x00,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x23,0x18,0x22,0x10,0x23,0x18,0x23,0x18,0x64,0x18,0x64,0x20,0x65,0x20,0x65,0x28,0x67,0x28,0xA7,0x30,0xA9,0x40,0xEB,0x48,0xED,0x58,0x2F,0x61,0xB1,0x71,0xEE,0x71,0xB1,0x71,0x53,0x8A,0xD4,0x9A,0x10,0x83,0xD4,0x9A,0x10,0x83,0xD4,0x9A,0x10,0x83,0x32,0x94,
-	0x32,0x94,0x10,0x83,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x10,0x83,0x10,0x83,0xB1,0x71,0x2F,0x61,
-	0xED,0x58,0xAB,0x40,0xA9,0x30,0x66,0x28,0x65,0x20,0x64,0x18,0x23,0x10,0x23,0x18,0x63,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x4A,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x26,0x08,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x23,0x18,0x23,0x18,0x63,0x18,0x64,0x20,0x66,0x28,0xA9,0x30,0xAB,0x40,0xAC,0x58,0xED,0x58,
-	0x2F,0x61,0xB1,0x71,0xD3,0x89,0x53,0x8A,0xD4,0x9A,0x53,0x8A,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,0xD4,0x9A,0x53,0x8A,0x53,0x8A,0x53,0x8A,0xD4,0x9A,0x53,0x8A,0x53,0x8A,0xD4,0x9A,0x10,0x83,0xD4,0x9A,0x10,0x83,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,
-	0xF6,0xAC,0x32,0x94,0xF6,0xAC,0xF6,0xAC,0x32,0x94,0x32,0x94,0x32,0x94,0x96,0xAB,0x32,0x94,0x32,0x94,0x32,0x94,0x96,0xAB,0xF6,0xAC,0x32,0x94,0x96,0xAB,0x96,0xAB,0xD4,0x9A,0x53,0x8A,0xB1,0x71,0xED,0x58,0xAB,0x40,0xA9,0x30,0x66,0x28,0x65,0x20,0x64,0x18,0x23,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x22,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x08,
-	0x48,0x00,0x48,0x00,0x4A,0x00,0x4C,0x00,0x4C,0x00,0x4C,0x00,0x4A,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x22,0x10,0x22,0x10,0x23,0x18,0x65,0x20,0x67,0x38,0xA9,0x40,0xAC,0x58,0x2F,0x61,0xF1,0x78,0xD3,0x89,0x35,0xA2,0x35,0xA2,0xD4,0x9A,0x35,0xA2,0xD4,0x9A,0x53,0x8A,0x53,0x8A,0x53,0x8A,0xD3,0x89,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xD3,0x89,0x53,0x8A,
-	0x53,0x8A,0x53,0x8A,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0x96,0xAB,0x96,0xAB,0x32,0x94,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x32,0x94,0xD4,0x9A,0xD4,0x9A,0xD3,0x89,0x53,0x8A,0xD3,0x89,0x35,0xA2,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0x96,0xAB,0xD4,0x9A,0xD4,0x9A,
-	0x96,0xAB,0x96,0xAB,0xD4,0x9A,0x98,0xB2,0x53,0x8A,0xF1,0x78,0xED,0x58,0xAB,0x40,0x67,0x28,0x65,0x20,0x64,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x4A,0x00,0x4C,0x00,0x4C,0x00,0x6E,0x00,0x6E,0x00,0x6E,0x00,0x6E,0x00,0x4C,0x00,0x4A,0x00,0x4A,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,
-	0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x22,0x10,0x24,0x20,0x67,0x38,0x8A,0x50,0xAC,0x58,0xF1,0x78,0x35,0xA2,0x35,0xA2,0x98,0xB2,0x35,0xA2,0x35,0xA2,
-	0xD3,0x89,0x53,0x89,0xD3,0x89,0xF1,0x78,0x53,0x89,0xF1,0x78,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,0xF1,0x78,0xF1,0x78,0x53,0x8A,0x53,0x8A,0xD3,0x89,0xD3,0x89,0x53,0x8A,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x32,0x94,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,
-	0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0x35,0xA2,0xD3,0x89,0x35,0xA2,0xD4,0x9A,0x53,0x89,0x95,0x91,0x53,0x89,0x35,0xA2,0x95,0x91,0x35,0xA2,0x35,0xA2,0x96,0xAB,0x35,0xA2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x35,0xA2,0x53,0x89,0xAC,0x58,0xA9,0x30,0x66,0x28,0x64,0x20,0x23,0x18,0x22,0x10,0x22,0x10,
-	0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x65,0x00,0x25,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x4A,0x00,
-	0x4A,0x00,0x4A,0x00,0x4C,0x00,0x4C,0x00,0x6E,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0x6E,0x00,0x6E,0x00,0x4C,0x00,0x4C,0x00,0x4A,0x00,0x48,0x00,0x4A,0x00,0x48,0x00,0x48,0x00,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x08,0x26,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x23,0x18,0x24,0x28,0x67,0x38,0xAE,0x68,0x53,0x89,0x35,0xA2,0x77,0xB1,0x35,0xA2,0x35,0xA2,0x53,0x89,0x53,0x89,0xF1,0x78,0xAE,0x68,0x2F,0x61,0xAC,0x58,0xAC,0x58,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,0xF1,0x78,0xF1,0x78,0x52,0x79,0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,
-	0xD3,0x89,0x35,0xA2,0x35,0xA2,0xD4,0x9A,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0x98,0xB2,0x96,0xAB,0xD4,0x9A,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x95,0x91,0xD3,0x89,0x53,0x89,0xF1,0x78,0x10,0x69,
-	0xF1,0x78,0x52,0x79,0x35,0xA2,0xD3,0x89,0x53,0x89,0x53,0x89,0x35,0xA2,0x77,0xB1,0x98,0xB2,0x77,0xB1,0x95,0x91,0xF1,0x78,0xAB,0x40,0x66,0x28,0x65,0x20,0x23,0x18,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,
-	0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x48,0x00,0x48,0x00,0xA8,0x08,0x48,0x00,0xCA,0x00,0x4A,0x00,0xCA,0x00,0xCC,0x08,0xCC,0x08,0xCC,0x08,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCC,0x08,0xCC,0x08,0x4A,0x00,
-	0x4A,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x26,0x08,0x26,0x08,0x26,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x23,0x18,0x24,0x20,0x25,0x30,0x2B,0x50,0x91,0x90,0xD4,0xA8,0x77,0xB1,0x77,0xB1,0xD4,0xA8,0x53,0x89,0x91,0x90,0x2F,0x61,0xAE,0x68,0x8A,0x50,
-	0xAC,0x58,0xAC,0x58,0xED,0x58,0xED,0x58,0x2F,0x61,0x2F,0x61,0xF1,0x78,0x52,0x79,0x53,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0x35,0xA2,0x53,0x8A,0x35,0xA2,0xD4,0x9A,0x35,0xA2,0xD4,0x9A,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,
-	0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0x35,0xA2,0x96,0xAB,0x35,0xA2,0x98,0xB2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x95,0x91,0xD3,0x89,0xD3,0x89,0x52,0x79,0x10,0x69,0x2F,0x61,0xCF,0x58,0xED,0x58,0x2F,0x61,0x2F,0x61,0xF1,0x78,0x52,0x79,0x53,0x89,0x35,0xA2,0x77,0xB1,0x77,0xB1,0x77,0xB1,0x53,0x89,0xAE,0x68,0x67,0x38,
-	0x24,0x20,0x23,0x18,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0x48,0x00,0xA7,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCC,0x08,0xCC,0x08,
-	0x6E,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCF,0x00,0xCC,0x08,0xCC,0x08,0xCA,0x00,0xCA,0x00,0x4A,0x00,0xA8,0x08,0x48,0x00,0x26,0x08,0x26,0x08,0x25,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x22,0x10,0x23,0x10,
-	0x23,0x18,0x24,0x20,0x27,0x30,0x2D,0x58,0x91,0x90,0x91,0x90,0xD4,0xA8,0xD4,0xA8,0xD4,0xA8,0x53,0x89,0xF1,0x78,0xF1,0x78,0x8A,0x50,0xAC,0x58,0xAC,0x58,0xED,0x58,0x2F,0x61,0x2F,0x61,0xF1,0x78,0xF1,0x78,0xF1,0x78,0x52,0x79,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0xD3,0x89,0x53,0x89,0xD3,0x89,
-	0x53,0x89,0xD3,0x89,0xD3,0x89,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x98,0xB2,0x35,0xA2,0x98,0xB2,0x96,0xAB,0x98,0xB2,0x98,0xB2,0x96,0xAB,0xFC,0xCB,0xF6,0xAC,0xFC,0xCB,0x96,0xAB,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0xD3,0x89,0xD3,0x89,0x35,0xA2,0x95,0x91,0x95,0x91,0x53,0x89,
-	0xD3,0x89,0x52,0x79,0xF1,0x78,0x2F,0x61,0xCF,0x58,0xED,0x58,0xAB,0x40,0xAC,0x58,0xAC,0x58,0xAE,0x68,0x2F,0x61,0x53,0x89,0x53,0x89,0xD4,0xA8,0x77,0xB1,0xD4,0xA8,0xAE,0x68,0x27,0x30,0x23,0x18,0x22,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0x24,0x00,
-	0x64,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCC,0x08,0xCC,0x08,0x2D,0x01,0xCF,0x00,0x4F,0x01,0x92,0x09,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0xCF,0x00,0x4F,0x01,0xCF,0x00,0x2D,0x01,0xCC,0x08,0xCC,0x08,
-	0x4C,0x00,0xCA,0x00,0xCA,0x00,0x4A,0x00,0xA8,0x08,0x26,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x10,0x24,0x10,0x25,0x18,0x25,0x20,0x49,0x30,0x2D,0x58,0x91,0x90,0x91,0x90,0x31,0x70,0x4B,0x70,0x2D,0x58,0x2D,0x58,0x4B,0x70,0xAE,0x68,0x4B,0x70,0xAC,0x58,0xAE,0x68,0xAE,0x68,0xAE,0x68,0xAE,0x68,
-	0xF1,0x78,0x52,0x79,0xF1,0x78,0xF1,0x78,0xF1,0x78,0xF1,0x78,0x10,0x69,0xF1,0x78,0x10,0x69,0x10,0x69,0xF1,0x78,0xB1,0x71,0xF1,0x78,0xF1,0x78,0xB1,0x71,0xB1,0x71,0x53,0x89,0xD3,0x89,0xD3,0x89,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x98,0xB2,0xD4,0x9A,0x98,0xB2,0x96,0xAB,0x98,0xB2,0x96,0xAB,0x98,0xB2,0x96,0xAB,0x98,0xB2,0xF6,0xAC,
-	0xFC,0xCB,0x96,0xAB,0x98,0xB2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0xD3,0x89,0xD3,0x89,0x52,0x79,0x52,0x79,0x53,0x89,0x52,0x79,0x52,0x79,0x52,0x79,0x52,0x79,0x53,0x89,0x53,0x89,0x53,0x89,0x52,0x79,0x52,0x79,0x10,0x69,0x2F,0x61,0xED,0x58,0xEB,0x48,0xAB,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x40,0xAC,0x58,0xAE,0x68,0xF1,0x78,0x53,0x89,
-	0x95,0x91,0x8E,0x80,0x2B,0x50,0x27,0x30,0x23,0x18,0x22,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCC,0x08,0xCC,0x08,0x2D,0x01,0x4F,0x01,0x4F,0x01,
-	0x4F,0x01,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x2D,0x01,0xCF,0x00,0x2D,0x01,0xCC,0x08,0x2D,0x01,0xCC,0x08,0xCA,0x00,0xA8,0x08,0xA7,0x08,0xA7,0x08,0x65,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x24,0x08,0x25,0x10,0x26,0x18,0x27,0x20,0x2B,0x30,0x30,0x60,
-	0x34,0x70,0x31,0x70,0x4B,0x70,0x2D,0x58,0x49,0x60,0x29,0x40,0x26,0x48,0x29,0x40,0x2D,0x58,0xF1,0x78,0x91,0x90,0xF1,0x78,0xAE,0x68,0x53,0x89,0xF1,0x78,0x2F,0x61,0x2F,0x61,0xF1,0x78,0x2F,0x61,0x2F,0x61,0xED,0x58,0x2C,0x59,0xAE,0x68,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x10,0x69,0x52,0x79,0x53,0x89,0xD3,0x89,0x53,0x89,
-	0xD3,0x89,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x98,0xB2,0x98,0xB2,0x96,0xAB,0x98,0xB2,0x98,0xB2,0x96,0xAB,0x96,0xAB,0x98,0xB2,0x96,0xAB,0x96,0xAB,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xF8,0xC5,0xF6,0xAC,0x98,0xB2,0x35,0xA2,0x35,0xA2,0x95,0x91,0xD3,0x89,0x52,0x79,0x10,0x69,0x2F,0x61,0x10,0x69,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,
-	0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x2F,0x61,0xCF,0x58,0xED,0x58,0xED,0x58,0xF1,0x78,0xA9,0x40,0x67,0x38,0x67,0x28,0x67,0x38,0xA9,0x40,0x8A,0x50,0xAE,0x68,0x2D,0x58,0x31,0x70,0x8E,0x80,0x2B,0x50,0x25,0x30,0x21,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,
-	0x64,0x00,0x65,0x00,0xA5,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0x4F,0x01,0x92,0x09,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,
-	0x4F,0x01,0xCC,0x08,0xCA,0x00,0xA8,0x08,0x65,0x00,0x48,0x00,0x65,0x08,0x24,0x08,0x25,0x08,0x26,0x10,0x68,0x18,0x29,0x20,0x4D,0x30,0x34,0x70,0x36,0x88,0x34,0x70,0x30,0x60,0x2B,0x50,0x29,0x40,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x2B,0x50,0xAE,0x68,0x91,0x90,0x91,0x90,0x53,0x89,0xF1,0x78,0xAE,0x68,0xAE,0x68,0xAC,0x58,
-	0xAE,0x68,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xED,0x58,0x2F,0x61,0x2F,0x61,0xF1,0x78,0xF1,0x78,0x52,0x79,0x53,0x89,0xD3,0x89,0x35,0xA2,0x95,0x91,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x98,0xB2,0x98,0xB2,0xFC,0xCB,0x98,0xB2,0x96,0xAB,0xFC,0xCB,0x96,0xAB,0xBC,0xD2,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xF6,0xAC,
-	0xFC,0xCB,0xF8,0xC5,0xFC,0xCB,0x98,0xB2,0x98,0xB2,0x35,0xA2,0x35,0xA2,0x95,0x91,0x53,0x89,0xD3,0x89,0xB1,0x71,0x10,0x69,0x2F,0x61,0xED,0x58,0xED,0x58,0xED,0x58,0xED,0x58,0x2C,0x59,0xED,0x58,0xED,0x58,0xAC,0x58,0xED,0x58,0xAC,0x58,0xAC,0x58,0xED,0x58,0xED,0x58,0xA9,0x40,0xA9,0x30,0x67,0x38,0x67,0x38,0x66,0x28,0x26,0x28,
-	0x67,0x38,0x67,0x38,0x26,0x48,0x2B,0x50,0x49,0x60,0x49,0x60,0x25,0x38,0x22,0x18,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,
-	0xD5,0x09,0xD5,0x09,0x37,0x0A,0xD5,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x92,0x09,0x92,0x09,0x4F,0x01,0xCC,0x08,0xCA,0x00,0xA8,0x08,0xA7,0x08,0xA7,0x08,0x65,0x08,0x67,0x10,0xAA,0x10,0x4C,0x28,0xAF,0x38,0xD5,0x50,0x36,0x88,0x39,0x59,0x34,0x70,0x2F,0x48,
-	0x29,0x40,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x2B,0x50,0x4B,0x70,0x8E,0x80,0x91,0x90,0x91,0x90,0x8E,0x80,0xAE,0x68,0x8A,0x50,0x8A,0x50,0x8A,0x50,0x8A,0x50,0xAC,0x58,0xAC,0x58,0xED,0x58,0xAE,0x68,0x2F,0x61,0xF1,0x78,0xF1,0x78,0x53,0x89,0x53,0x89,0xD3,0x89,0x95,0x91,0x35,0xA2,0x98,0xB2,0x35,0xA2,0x35,0xA2,
-	0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0xFC,0xCB,0xFC,0xCB,0x98,0xB2,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0x98,0xB2,0x98,0xB2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0xD3,0x89,0x35,0xA2,0x35,0xA2,0x10,0x69,0x10,0x69,0x10,0x69,0x2F,0x61,0xED,0x58,
-	0xED,0x58,0xEB,0x48,0xEB,0x48,0xA9,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x40,0x67,0x38,0x67,0x38,0x67,0x38,0x65,0x28,0x64,0x20,0x23,0x18,0x23,0x20,0x24,0x28,0x25,0x30,0x27,0x30,0x25,0x38,0x25,0x38,0x23,0x20,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,
-	0x64,0x00,0xA5,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0xD5,0x09,0x37,0x0A,0xD5,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0xD5,0x09,0x92,0x09,0x4F,0x01,
-	0x2D,0x01,0xCC,0x08,0xCA,0x00,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xAB,0x10,0xEE,0x18,0xF1,0x20,0xD5,0x50,0xD7,0x99,0x39,0x59,0x39,0x58,0x30,0x60,0x2B,0x30,0x49,0x30,0x28,0x28,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x2B,0x50,0x2B,0x50,0x2B,0x50,0x2D,0x58,0xAC,0x58,0x2D,0x58,0xAC,0x58,0xAC,0x58,0x8A,0x50,0xA9,0x40,0xAB,0x40,
-	0xAC,0x58,0xED,0x58,0xAE,0x68,0x2F,0x61,0x2F,0x61,0xF1,0x78,0xF1,0x78,0x52,0x79,0xF1,0x78,0x52,0x79,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x95,0x91,0x95,0x91,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0xBC,0xD2,0xBC,0xD2,0x98,0xB2,0x98,0xB2,
-	0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x35,0xA2,0x35,0xA2,0x95,0x91,0x53,0x89,0x52,0x79,0xF1,0x78,0x10,0x69,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,0xED,0x58,0xED,0x58,0xED,0x58,0xEB,0x48,0xA9,0x40,0xA9,0x30,0xA7,0x30,0xA9,0x30,0xA7,0x30,0x49,0x30,0xA9,0x30,0x67,0x38,0x49,0x30,0x67,0x38,0x67,0x38,0x27,0x30,
-	0x65,0x28,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x23,0x20,0x23,0x18,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,
-	0x22,0x00,0x22,0x00,0x23,0x00,0x62,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA5,0x00,0xA7,0x08,0xA7,0x08,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xD5,0x09,
-	0xD5,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x37,0x0A,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x37,0x0A,0xD5,0x09,0x92,0x09,0x4F,0x01,0x2D,0x01,0xCC,0x08,0xCA,0x00,0xCA,0x00,0xCC,0x08,0x4F,0x01,0x55,0x29,0x55,0x29,0x9A,0x51,0xDC,0x69,0x9A,0x51,0xD5,0x50,0x4D,0x30,0x29,0x28,0x28,0x28,0x49,0x30,
-	0x49,0x30,0x49,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x8A,0x50,0x2B,0x50,0x2D,0x58,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAE,0x68,0x2F,0x61,0xAE,0x68,0xAE,0x68,0xAE,0x68,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x10,0x69,0xF1,0x78,0x52,0x79,0x52,0x79,0xD3,0x89,0xD3,0x89,
-	0x53,0x89,0xD3,0x89,0xD3,0x89,0x95,0x91,0xD7,0x99,0x98,0xB2,0xD7,0x99,0x98,0xB2,0x98,0xB2,0x98,0xB2,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x35,0xA2,0xD3,0x89,0x52,0x79,0x10,0x69,0x10,0x69,0xCF,0x58,0xED,0x58,0xED,0x58,0xED,0x58,0xED,0x58,0xCF,0x58,0x2F,0x61,
-	0xCF,0x58,0x2F,0x61,0xED,0x58,0xED,0x58,0xEB,0x48,0xA9,0x40,0xA9,0x40,0x67,0x38,0x67,0x28,0x67,0x38,0x67,0x38,0x66,0x28,0x67,0x38,0x67,0x38,0x67,0x38,0x27,0x30,0x67,0x38,0x24,0x28,0x23,0x18,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x20,0x08,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x62,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0xA5,0x00,
-	0xA5,0x00,0xA5,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x2D,0x01,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x37,0x0A,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x37,0x0A,0x37,0x0A,0x92,0x09,0x92,0x09,0x4F,0x01,
-	0x2D,0x01,0x2D,0x01,0x4F,0x01,0x92,0x09,0x55,0x29,0xB8,0x29,0xDB,0x32,0x3E,0x6B,0x9A,0x51,0xF3,0x38,0xCF,0x20,0xAB,0x20,0x29,0x28,0x29,0x28,0x2B,0x30,0x2B,0x30,0x49,0x30,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x2B,0x50,0xAC,0x58,0xAE,0x68,0xAE,0x68,0xAE,0x68,
-	0xED,0x58,0xAE,0x68,0xAE,0x68,0xAC,0x58,0xEB,0x48,0xEB,0x48,0xAC,0x58,0xAC,0x58,0xED,0x58,0xCF,0x58,0x2F,0x61,0x10,0x69,0xF1,0x78,0x52,0x79,0x52,0x79,0x53,0x89,0x53,0x89,0xD3,0x89,0x95,0x91,0x95,0x91,0x35,0xA2,0x35,0xA2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0xBC,0xD2,0xBC,0xD2,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,0x98,0xB2,
-	0x98,0xB2,0xFC,0xCB,0xFC,0xCB,0x98,0xB2,0x35,0xA2,0x95,0x91,0x52,0x79,0x10,0x69,0xED,0x58,0x2C,0x59,0xCC,0x40,0xEB,0x48,0xCC,0x40,0xEB,0x48,0xEB,0x48,0xED,0x58,0xED,0x58,0xED,0x58,0xED,0x58,0xED,0x58,0xED,0x58,0x52,0x79,0xAB,0x40,0xA9,0x40,0xA9,0x30,0x67,0x38,0x66,0x28,0x65,0x28,0x65,0x28,0x65,0x28,0x25,0x28,0x25,0x30,
-	0x65,0x28,0x25,0x30,0x24,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x22,0x18,0x22,0x20,0x22,0x18,0x22,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,
-	0x22,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0x92,0x09,0xD5,0x09,
-	0xD5,0x09,0x37,0x0A,0x37,0x0A,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x37,0x0A,0xD5,0x09,0x92,0x09,0x92,0x09,0x4F,0x01,0x4F,0x01,0xD5,0x09,0xB8,0x29,0x37,0x0A,0xDB,0x32,0xDC,0x3C,0xDC,0x3B,0xB8,0x29,0x55,0x29,0xCF,0x20,0x4A,0x18,0x69,0x20,0x4B,0x28,0x4B,0x28,0x2B,0x30,0x29,0x28,
-	0x49,0x30,0x28,0x28,0x27,0x30,0x26,0x28,0x25,0x30,0x25,0x28,0x27,0x30,0x27,0x30,0x29,0x40,0x8A,0x50,0x8A,0x50,0x2B,0x50,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAC,0x58,0x8A,0x50,0xAB,0x40,0xA9,0x40,0xAB,0x40,0xAB,0x40,0xEB,0x48,0xAC,0x58,0xED,0x58,0xAE,0x68,0x2F,0x61,0x10,0x69,0x52,0x79,0x52,0x79,0x52,0x79,
-	0x52,0x79,0x53,0x89,0xD3,0x89,0x95,0x91,0x95,0x91,0xD7,0x99,0x98,0xB2,0xDE,0xA9,0xBC,0xD2,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0xBC,0xD2,0xBC,0xD2,0x98,0xB2,0x35,0xA2,0x52,0x79,0x2F,0x61,0xCF,0x58,0xED,0x58,0xED,0x58,0xEB,0x48,0xEB,0x48,0xAB,0x40,0xAB,0x40,0xA9,0x40,
-	0xAB,0x40,0xEB,0x48,0xAB,0x40,0xAB,0x40,0xEB,0x48,0xED,0x58,0xAB,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x30,0x67,0x38,0x66,0x28,0x25,0x28,0x25,0x28,0x24,0x20,0x25,0x28,0x64,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x22,0x10,0x22,0x18,0x22,0x20,0x22,0x18,0x21,0x10,
-	0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x62,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0xA5,0x00,0x65,0x00,
-	0xA5,0x00,0xA5,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x37,0x0A,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0x37,0x0A,0xD5,0x09,0xD5,0x09,0x92,0x09,0x92,0x09,0xD5,0x09,
-	0x37,0x0A,0x3B,0x22,0x5A,0x1B,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0xB8,0x29,0x32,0x21,0xEE,0x18,0xAB,0x18,0xAB,0x18,0x4B,0x28,0x4C,0x28,0x2B,0x30,0x69,0x28,0x28,0x28,0x27,0x28,0x26,0x28,0x25,0x20,0x25,0x28,0x25,0x28,0x27,0x30,0x27,0x30,0x29,0x40,0x2B,0x50,0x2B,0x50,0x8A,0x50,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x8A,0x50,
-	0x8A,0x50,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xA9,0x40,0xA9,0x40,0xA9,0x40,0xAB,0x40,0xAC,0x58,0xED,0x58,0xED,0x58,0x2F,0x61,0x2F,0x61,0x10,0x69,0xF1,0x78,0x52,0x79,0x52,0x79,0x52,0x79,0x53,0x89,0x95,0x91,0xD7,0x99,0xD7,0x99,0x98,0xB2,0xBC,0xD2,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,0xBC,0xD2,0x98,0xB2,0x98,0xB2,0xD7,0x99,0xD7,0x99,
-	0xD7,0x99,0xD7,0x99,0x35,0xA2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x95,0x91,0x10,0x69,0xED,0x58,0xED,0x58,0xED,0x58,0xCC,0x40,0xEB,0x48,0xEB,0x48,0xA9,0x40,0xAA,0x38,0xA9,0x40,0xA9,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x40,0x49,0x30,0xA9,0x30,0xA9,0x40,0xA9,0x40,0x29,0x40,0xA9,0x30,0x67,0x38,0x66,0x28,0x25,0x28,0x25,0x28,0x24,0x20,
-	0x24,0x20,0x23,0x20,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
-	0x22,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA5,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,
-	0x37,0x0A,0x37,0x0A,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0xB9,0x12,0x37,0x0A,0x37,0x0A,0xD5,0x09,0xD5,0x09,0x37,0x0A,0x5A,0x1B,0x5A,0x1B,0xDC,0x3B,0x1D,0x56,0xDC,0x3C,0x5A,0x1B,0x55,0x29,0x2F,0x19,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xAD,0x20,0xAD,0x20,0x4B,0x28,0x69,0x20,0x28,0x20,0x28,0x20,
-	0x25,0x20,0x25,0x20,0x25,0x28,0x26,0x28,0x25,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x67,0x38,0x67,0x38,0x67,0x38,0x29,0x40,0xA9,0x40,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAB,0x40,0xAB,0x40,0xAC,0x58,0xEB,0x48,0xED,0x58,0xED,0x58,0xED,0x58,0xCF,0x58,0x10,0x69,0x10,0x69,0x10,0x69,
-	0x52,0x79,0x52,0x79,0xD3,0x89,0x95,0x91,0xD7,0x99,0x98,0xB2,0xBC,0xD2,0xFC,0xCB,0xBC,0xD2,0xBC,0xD2,0xDE,0xA9,0x98,0xB2,0xD7,0x99,0xDE,0xA9,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0x35,0xA2,0x77,0xB1,0xD7,0x99,0xD7,0x99,0xD3,0x89,0x30,0x59,0xED,0x58,0xED,0x58,0xEB,0x48,0xEB,0x48,0xAA,0x38,0xA9,0x40,0xAA,0x38,
-	0xA9,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x40,0xA7,0x30,0xA7,0x30,0x67,0x38,0x67,0x28,0x67,0x28,0xA7,0x30,0x67,0x38,0x67,0x38,0x67,0x38,0x67,0x38,0x25,0x30,0x25,0x28,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA5,0x00,0x65,0x00,
-	0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0x37,0x0A,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0xB9,0x12,0x37,0x0A,0x37,0x0A,0xD5,0x09,0x37,0x0A,0x5A,0x1B,0x5A,0x1B,0xDC,0x3C,
-	0x1D,0x56,0x1D,0x56,0xDC,0x3C,0x59,0x2A,0x55,0x29,0x2F,0x19,0x2F,0x19,0x32,0x21,0x2F,0x19,0xCF,0x20,0xEE,0x18,0x4A,0x18,0x68,0x18,0x27,0x18,0x26,0x18,0x27,0x20,0x26,0x20,0x26,0x20,0x26,0x28,0x27,0x30,0x27,0x30,0x26,0x28,0x27,0x30,0x27,0x30,0x27,0x30,0x67,0x38,0x49,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0xA9,0x40,
-	0x8A,0x50,0xAC,0x58,0xAE,0x68,0xED,0x58,0xED,0x58,0xED,0x58,0xED,0x58,0xED,0x58,0xCF,0x58,0xAE,0x68,0xCF,0x58,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x10,0x69,0x52,0x79,0x52,0x79,0x53,0x89,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0xDE,0xA9,0x98,0xB2,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,
-	0x95,0x91,0x95,0x91,0x95,0x91,0x95,0x91,0x98,0xB2,0xD7,0x99,0x95,0x91,0x95,0x91,0x52,0x79,0xCF,0x58,0xCC,0x40,0xCC,0x40,0xEB,0x48,0xAB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x67,0x38,0x67,0x28,0x67,0x28,0x67,0x28,0x67,0x28,0x67,0x38,0x67,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x38,0x26,0x28,0x25,0x30,
-	0x64,0x28,0x24,0x20,0x23,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x63,0x00,0x63,0x00,
-	0x23,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,
-	0x37,0x0A,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0xB9,0x12,0x37,0x0A,0x37,0x0A,0xB9,0x12,0x5A,0x1B,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0x5A,0x1B,0x92,0x09,0x92,0x09,0x92,0x09,0x32,0x21,0x32,0x21,0x32,0x21,0xEE,0x18,0xAD,0x20,0x68,0x18,0x27,0x18,0x27,0x18,0x26,0x18,0x27,0x20,
-	0x26,0x20,0x27,0x28,0x27,0x28,0x27,0x28,0x25,0x28,0x25,0x28,0x25,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0xAC,0x58,0xA9,0x40,0x29,0x40,0xAB,0x40,0x8A,0x50,0xAC,0x58,0xAC,0x58,0xAE,0x68,0xED,0x58,0xAE,0x68,0x2F,0x61,0x10,0x69,0x10,0x69,0xF1,0x78,0xF1,0x78,0xF1,0x78,0x52,0x79,0xF1,0x78,0x52,0x79,
-	0x52,0x79,0x95,0x91,0xBC,0xD2,0xD7,0x99,0xD7,0x99,0x98,0xB2,0x98,0xB2,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0x95,0x91,0x95,0x91,0x95,0x91,0x75,0x79,0x53,0x89,0xBC,0xD2,0xD7,0x99,0x95,0x91,0x95,0x91,0x95,0x91,0x10,0x69,0xED,0x58,0xEB,0x48,0xAB,0x40,0xA9,0x40,0xA9,0x30,0xA9,0x30,
-	0xA9,0x30,0xA7,0x30,0xA7,0x30,0xA9,0x30,0xA7,0x30,0x67,0x28,0x67,0x38,0x66,0x28,0x66,0x28,0xA7,0x30,0x65,0x28,0x65,0x20,0x64,0x28,0x25,0x28,0x25,0x28,0x65,0x28,0x25,0x28,0x24,0x28,0x23,0x20,0x23,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x22,0x18,0x22,0x20,0x23,0x20,0x23,0x20,0x22,0x18,0x21,0x18,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA5,0x00,0x65,0x00,0xA7,0x08,
-	0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x37,0x0A,0x5A,0x1B,0xDC,0x3C,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1D,0x56,
-	0x5A,0x1B,0xB9,0x12,0xD5,0x09,0xD5,0x09,0x55,0x29,0xD5,0x09,0x55,0x29,0x55,0x29,0xF1,0x20,0xEE,0x18,0xAB,0x18,0x68,0x18,0x27,0x18,0x27,0x18,0x28,0x20,0x28,0x20,0x28,0x28,0x28,0x28,0x27,0x28,0x25,0x20,0x25,0x20,0x27,0x30,0x25,0x20,0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x67,0x38,0x67,0x38,
-	0x67,0x38,0x67,0x38,0xA9,0x30,0xA9,0x40,0xA9,0x40,0xAB,0x40,0xAB,0x40,0xAC,0x58,0xAE,0x68,0x10,0x69,0x52,0x79,0x52,0x79,0x52,0x79,0x53,0x89,0x52,0x79,0x52,0x79,0x52,0x79,0xD3,0x89,0x35,0xA2,0x75,0x79,0xD7,0x99,0x98,0xB2,0xD7,0x99,0x95,0x91,0x75,0x79,0x75,0x79,0x95,0x91,0x75,0x79,0x95,0x91,0x75,0x79,0x95,0x91,0x95,0x91,
-	0x95,0x91,0x95,0x91,0x75,0x79,0x52,0x79,0xD3,0x89,0x95,0x91,0x75,0x79,0xD3,0x89,0x95,0x91,0x95,0x91,0x2F,0x61,0xCC,0x40,0xEB,0x48,0xAA,0x38,0xA9,0x40,0xA7,0x30,0x67,0x28,0xA7,0x30,0x67,0x28,0x67,0x28,0x66,0x28,0x66,0x28,0xA6,0x28,0x66,0x28,0x66,0x28,0x65,0x28,0x65,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,
-	0x24,0x20,0x25,0x30,0x24,0x28,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,
-	0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0xA5,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,
-	0xB9,0x12,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x5A,0x1B,0x5A,0x1B,0x59,0x2A,0x37,0x0A,0xB8,0x29,0x37,0x0A,0x37,0x0A,0x55,0x29,0x32,0x21,0x2F,0x19,0xED,0x18,0xAB,0x18,0x4A,0x18,0x4A,0x18,0x29,0x20,0x29,0x28,0x29,0x28,
-	0x28,0x28,0x27,0x20,0x25,0x20,0x25,0x20,0x26,0x28,0x26,0x28,0x25,0x28,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x30,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x66,0x28,0x67,0x28,0x67,0x38,0xA9,0x30,0xA9,0x40,0xAB,0x40,0xED,0x58,0xCF,0x58,0x10,0x69,0x52,0x79,0x52,0x79,0x52,0x79,0x52,0x79,
-	0x10,0x69,0x10,0x69,0x10,0x69,0x52,0x79,0x95,0x91,0x95,0x91,0x52,0x79,0x75,0x79,0xD7,0x99,0x98,0xB2,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0x95,0x91,0x75,0x79,0x95,0x91,0xD3,0x89,0x75,0x79,0x52,0x79,0x52,0x79,0x52,0x79,0x53,0x89,0x95,0x91,0xD7,0x99,0x52,0x79,0xCF,0x58,0xEB,0x48,0xAB,0x40,0xA9,0x30,0xA7,0x30,
-	0x67,0x28,0x67,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x65,0x28,0x65,0x20,0x65,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x24,0x20,0x23,0x20,0x24,0x28,0x25,0x30,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,
-	0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,
-	0xA7,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x4F,0x01,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0x5A,0x1B,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0x5A,0x1B,0x5A,0x1B,
-	0x5A,0x1B,0x5A,0x1B,0x59,0x2A,0x5A,0x1B,0x59,0x2A,0xB8,0x29,0x55,0x29,0x92,0x09,0x32,0x21,0x2F,0x19,0xCF,0x20,0xCF,0x20,0xCF,0x20,0x4C,0x28,0x4B,0x28,0x29,0x28,0x28,0x20,0x27,0x20,0x26,0x20,0x26,0x20,0x26,0x28,0x26,0x28,0x25,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x27,0x30,0x26,0x28,0x25,0x28,0x25,0x28,0x24,0x20,
-	0x25,0x20,0x65,0x20,0x25,0x28,0x25,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0xA7,0x30,0xCF,0x58,0xAB,0x40,0xAB,0x40,0xED,0x58,0xCF,0x58,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x95,0x91,0x75,0x79,0x75,0x79,0x95,0x91,0xD7,0x99,0x98,0xB2,0x95,0x91,0xD7,0x99,0xD7,0x99,0x98,0xB2,0x98,0xB2,0x95,0x91,
-	0x95,0x91,0x95,0x91,0x75,0x79,0x52,0x79,0x52,0x79,0x10,0x69,0x52,0x79,0x52,0x79,0x75,0x79,0x95,0x91,0x95,0x91,0x2F,0x61,0xED,0x58,0xCF,0x58,0xAB,0x40,0xA9,0x30,0xA7,0x30,0x67,0x28,0x66,0x28,0x66,0x20,0x65,0x20,0x66,0x28,0x65,0x20,0x65,0x20,0x25,0x20,0x24,0x20,0x24,0x20,0x64,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x20,
-	0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x22,0x20,0x23,0x20,0x24,0x28,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x20,0x22,0x20,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x62,0x00,0x23,0x00,0x23,0x00,0x63,0x00,
-	0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x4F,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0x92,0x09,0x92,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0x5A,0x1B,
-	0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0x5A,0x1B,0x5A,0x1B,0xDC,0x3B,0x5A,0x1B,0x5A,0x1B,0x59,0x2A,0x37,0x0A,0x55,0x29,0x55,0x29,0x32,0x21,0x55,0x29,0xF3,0x38,0xF3,0x38,0x2F,0x28,0x4C,0x28,0x4B,0x28,0x69,0x20,
-	0x28,0x20,0x28,0x20,0x28,0x28,0x28,0x28,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x28,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x64,0x20,0x25,0x20,0x24,0x20,0x65,0x20,0x67,0x38,0x66,0x28,0x66,0x28,0x67,0x28,0xA7,0x30,0xA9,0x30,0xA9,0x40,0xAB,0x40,0xCC,0x40,0xED,0x58,
-	0x10,0x69,0x10,0x69,0x30,0x59,0x52,0x79,0x95,0x91,0x53,0x89,0x52,0x79,0x75,0x79,0x95,0x91,0x95,0x91,0x95,0x91,0x95,0x91,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0x95,0x91,0x75,0x79,0x75,0x79,0x33,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x95,0x91,0x95,0x91,0x33,0x69,0xCF,0x58,0xED,0x58,0xAB,0x40,0xA9,0x30,
-	0xED,0x58,0xA9,0x30,0x25,0x20,0x65,0x20,0x65,0x20,0x65,0x20,0x65,0x20,0x24,0x20,0x64,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x20,0x23,0x18,0x23,0x20,0x23,0x20,0x24,0x28,0x23,0x30,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x20,0x22,0x20,
-	0x22,0x20,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,
-	0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xD5,0x09,0x92,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0xB9,0x12,0x5A,0x1B,0x5A,0x1B,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0xDC,0x3C,0xDC,0x3C,0x1D,0x56,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,
-	0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDB,0x32,0x59,0x2A,0xB8,0x29,0xB8,0x29,0xB8,0x29,0xB8,0x29,0xB8,0x29,0x55,0x29,0xF1,0x20,0xF1,0x20,0x4C,0x28,0x4C,0x28,0x4B,0x28,0x29,0x28,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2A,0x48,0x49,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x28,0x25,0x20,0x24,0x20,0x24,0x20,
-	0x24,0x20,0x24,0x18,0x24,0x20,0x64,0x20,0x24,0x20,0x25,0x20,0x65,0x20,0x65,0x20,0x65,0x20,0x66,0x28,0x66,0x28,0x67,0x28,0x67,0x28,0xA9,0x30,0xA9,0x40,0xCC,0x40,0xCF,0x58,0x10,0x69,0x10,0x69,0x95,0x91,0xD7,0x99,0x75,0x79,0x52,0x79,0x75,0x79,0x95,0x91,0x95,0x91,0xD7,0x99,0x95,0x91,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,
-	0xD7,0x99,0xD7,0x99,0x75,0x79,0x52,0x79,0x33,0x69,0x10,0x69,0x10,0x69,0x30,0x59,0x10,0x69,0x33,0x69,0x95,0x91,0xF1,0x78,0xCF,0x58,0xED,0x58,0xCC,0x40,0xAA,0x38,0xAA,0x38,0x67,0x28,0x66,0x28,0x66,0x28,0x65,0x20,0x25,0x20,0x64,0x20,0x24,0x18,0x24,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x20,
-	0x23,0x20,0x24,0x20,0x24,0x28,0x24,0x28,0x24,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x64,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCC,0x08,0x2D,0x01,0x2D,0x01,0x4F,0x01,0xD5,0x09,0xD5,0x09,0x92,0x09,0x92,0x09,0xD5,0x09,0x37,0x0A,0xB9,0x12,0x5A,0x1B,0xB9,0x12,
-	0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x5A,0x1B,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0x5A,0x1B,0xDB,0x32,0x3B,0x22,0xDB,0x32,0xDB,0x32,0xFC,0x41,0xFC,0x41,0xB8,0x29,0xF3,0x38,0xF1,0x20,0x2F,0x28,0x2F,0x28,0x4D,0x30,
-	0x4D,0x30,0x4D,0x30,0x2D,0x48,0x2D,0x48,0x2A,0x48,0x29,0x40,0x27,0x30,0x26,0x28,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x28,0x24,0x20,0x24,0x20,0x24,0x18,0x23,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x64,0x18,0x24,0x20,0x65,0x20,0x65,0x20,0x65,0x20,0x66,0x28,0x66,0x28,0x67,0x28,0x67,0x28,0xA9,0x30,0xAA,0x38,
-	0xCC,0x40,0xCF,0x58,0x52,0x79,0xD7,0x99,0xD7,0x99,0x52,0x79,0x52,0x79,0x75,0x79,0xD3,0x89,0x95,0x91,0x95,0x91,0xD7,0x99,0x95,0x91,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0x52,0x79,0x33,0x69,0x10,0x69,0x10,0x69,0xCF,0x58,0xCF,0x58,0x10,0x69,0x75,0x79,0x10,0x69,0xCF,0x58,0xED,0x58,0xED,0x58,0xAB,0x40,
-	0xA9,0x30,0xA9,0x30,0x67,0x28,0x67,0x28,0x66,0x28,0x66,0x28,0x65,0x20,0x65,0x20,0x64,0x18,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x20,0x65,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x22,0x20,0x22,0x20,0x21,0x18,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,
-	0xCA,0x00,0xCA,0x00,0xCA,0x00,0xCC,0x08,0x2D,0x01,0x4F,0x01,0x92,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0xB9,0x12,0x3B,0x22,0xB9,0x12,0xB9,0x12,0xB9,0x12,0xB9,0x12,0x37,0x0A,0x5A,0x1B,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,
-	0xDC,0x3C,0xDC,0x3C,0x5A,0x1B,0xDC,0x3B,0x5A,0x1B,0xDC,0x3B,0xDB,0x32,0x9D,0x5A,0x3B,0x22,0xB8,0x29,0x55,0x29,0x55,0x29,0xF3,0x38,0xF3,0x38,0x2F,0x28,0x30,0x38,0x30,0x38,0x92,0x50,0x92,0x50,0x2F,0x48,0x2A,0x48,0x49,0x30,0x49,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x28,0x24,0x20,0x24,0x20,
-	0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x64,0x20,0x65,0x20,0x65,0x20,0x65,0x20,0x66,0x20,0x66,0x28,0x67,0x28,0x67,0x28,0xA9,0x30,0xA9,0x40,0xED,0x58,0x33,0x69,0xD7,0x99,0xD7,0x99,0x75,0x79,0x52,0x79,0x75,0x79,0x75,0x79,0x95,0x91,0x95,0x91,0x95,0x91,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,
-	0xD7,0x99,0xD7,0x99,0x95,0x91,0x75,0x79,0x10,0x69,0x10,0x69,0x30,0x59,0xCF,0x58,0xCF,0x58,0xCF,0x58,0x33,0x69,0xED,0x58,0xCC,0x40,0xCC,0x40,0xAB,0x40,0xAA,0x38,0xAA,0x38,0xA9,0x40,0xA9,0x30,0xA9,0x30,0x67,0x28,0x66,0x28,0x66,0x28,0x25,0x20,0x65,0x20,0x24,0x20,0x64,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x65,0x28,0x25,0x30,
-	0x25,0x30,0x25,0x30,0x24,0x28,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x18,0x21,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x20,0x22,0x20,0x23,0x20,0x21,0x18,0x21,0x10,0x20,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,
-	0x24,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xCC,0x08,0xCC,0x08,0x2D,0x01,0x4F,0x01,0x92,0x09,0xD5,0x09,0xD5,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0x3B,0x22,0xB9,0x12,0x37,0x0A,0x37,0x0A,
-	0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0x5A,0x1B,0xDC,0x3B,0xDC,0x3B,0xDB,0x32,0xDB,0x32,0x3B,0x22,0xB8,0x29,0x55,0x29,0xF3,0x38,0xF1,0x20,0x30,0x38,0xF1,0x20,0x30,0x38,
-	0x92,0x50,0x92,0x50,0x92,0x50,0x2F,0x48,0x2D,0x48,0x2A,0x48,0x49,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x28,0x25,0x28,0x24,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x64,0x18,0x24,0x18,0x64,0x18,0x24,0x20,0x65,0x20,0x25,0x20,0x65,0x20,0x65,0x20,0x66,0x28,0x67,0x28,0xA8,0x28,
-	0xA9,0x30,0xCC,0x40,0xCF,0x58,0x75,0x79,0xD7,0x99,0x95,0x91,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x95,0x91,0x95,0x91,0x95,0x91,0x95,0x91,0x95,0x91,0xD7,0x99,0x95,0x91,0xD7,0x99,0x95,0x91,0x75,0x79,0x10,0x69,0x10,0x69,0xCF,0x58,0xCF,0x58,0xCF,0x58,0x2F,0x61,0x10,0x69,0xCC,0x40,0xAB,0x40,0xAB,0x40,0xAA,0x38,0xA9,0x30,
-	0xA9,0x30,0x49,0x30,0xA9,0x30,0x49,0x30,0xA7,0x30,0x67,0x28,0x66,0x28,0x65,0x20,0x25,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x28,0x25,0x28,0x65,0x28,0x25,0x30,0x25,0x30,0x24,0x28,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x22,0x20,0x22,0x20,0x21,0x18,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x24,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,
-	0xCA,0x00,0xCA,0x00,0xEC,0x10,0xCC,0x08,0x4F,0x01,0x2F,0x19,0x92,0x09,0xD5,0x09,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x3B,0x22,0xB9,0x12,0x37,0x0A,0x37,0x0A,0x37,0x0A,0xB9,0x12,0x5A,0x1B,0xDC,0x3C,0x1D,0x56,0x1E,0x87,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1E,0x87,0x1E,0x87,0x1E,0x87,0x1D,0x56,0xDC,0x3C,
-	0xDC,0x3C,0xDC,0x3B,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0xDB,0x32,0x3B,0x22,0x3B,0x22,0xB8,0x29,0x55,0x29,0x55,0x29,0x32,0x21,0xF1,0x20,0x2F,0x28,0xAF,0x38,0x30,0x38,0xF3,0x38,0x92,0x50,0x2F,0x48,0x2D,0x48,0x2A,0x48,0x2B,0x30,0x2B,0x30,0x29,0x40,0x29,0x40,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x28,
-	0x25,0x28,0x24,0x20,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x65,0x18,0x65,0x20,0x65,0x20,0x66,0x20,0x66,0x28,0x67,0x28,0xA9,0x30,0xAB,0x40,0xED,0x58,0x52,0x79,0xD7,0x99,0xD7,0x99,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x95,0x91,0x95,0x91,0x95,0x91,0x95,0x91,0x95,0x91,
-	0x95,0x91,0x75,0x79,0x95,0x91,0x75,0x79,0x10,0x69,0x30,0x59,0xCF,0x58,0xCF,0x58,0xCF,0x48,0x10,0x69,0xCF,0x58,0xEB,0x48,0xAA,0x38,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x49,0x30,0xA9,0x30,0x67,0x28,0x67,0x28,0x67,0x28,0x66,0x28,0x66,0x28,0x65,0x20,0x24,0x20,0x64,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x25,0x28,0x65,0x28,0x25,0x28,
-	0x24,0x28,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x21,0x10,0x22,0x18,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x18,0x22,0x18,0x22,0x20,0x21,0x10,
-	0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x63,0x00,
-	0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xAB,0x10,0x2D,0x01,0xCC,0x08,0x4F,0x01,0x4F,0x01,0xD5,0x09,0xB8,0x29,0x37,0x0A,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x37,0x0A,
-	0xB9,0x12,0xDC,0x3C,0x1D,0x56,0x1E,0x87,0x1E,0x87,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1E,0x87,0x1E,0x87,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0x5A,0x1B,0x3B,0x22,0x3B,0x22,0xB8,0x29,0xB8,0x29,0x55,0x29,0x32,0x21,0xF1,0x20,0xCF,0x20,0xCF,0x20,0xF1,0x20,0xF1,0x20,
-	0x30,0x38,0xAF,0x38,0x4D,0x30,0x2B,0x30,0x2B,0x30,0x49,0x30,0x49,0x30,0x49,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x27,0x30,0x26,0x28,0x26,0x28,0x25,0x20,0x24,0x20,0x23,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x64,0x18,0x24,0x18,0x64,0x18,0x24,0x18,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x28,
-	0xA8,0x28,0xAA,0x38,0xAB,0x38,0xCF,0x58,0x95,0x91,0xD7,0x99,0x95,0x91,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x95,0x91,0x75,0x79,0x95,0x91,0x95,0x91,0x75,0x79,0x75,0x79,0x75,0x79,0x10,0x69,0xCF,0x58,0xCF,0x58,0x2E,0x49,0xED,0x58,0x30,0x59,0xCF,0x58,0xAB,0x40,0xAA,0x38,0xA9,0x30,0xA9,0x30,0x67,0x28,
-	0x67,0x28,0x67,0x28,0x67,0x28,0x66,0x28,0x66,0x28,0x65,0x20,0x65,0x20,0x24,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x24,0x18,0x24,0x20,0x64,0x28,0x24,0x28,0x24,0x20,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x10,0x21,0x10,0x22,0x18,0x22,0x10,0x21,0x10,0x22,0x18,0x22,0x18,
-	0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x18,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,
-	0xCA,0x00,0xEC,0x10,0xCC,0x08,0x2D,0x01,0x2F,0x19,0x92,0x09,0xD5,0x09,0x37,0x0A,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x37,0x0A,0x37,0x0A,0xB8,0x29,0x3B,0x22,0xDC,0x3C,0x1D,0x56,0x1E,0x87,0x1E,0x87,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,
-	0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0xDB,0x32,0xDB,0x32,0x3B,0x22,0x3B,0x22,0xB8,0x29,0x55,0x29,0x32,0x21,0xF1,0x20,0xEE,0x18,0xCF,0x20,0xCF,0x20,0xCF,0x20,0x30,0x38,0xCF,0x20,0x4D,0x30,0x4C,0x28,0x4D,0x30,0x2B,0x30,0x49,0x30,0x49,0x30,0x27,0x30,0x27,0x30,0x49,0x30,0x29,0x40,0x29,0x40,0x2A,0x48,0x29,0x40,0x49,0x30,0x27,0x30,
-	0x27,0x30,0x25,0x28,0x25,0x20,0x24,0x20,0x64,0x20,0x24,0x18,0x63,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x64,0x18,0x25,0x20,0x65,0x20,0x66,0x20,0x66,0x28,0x67,0x28,0xA9,0x30,0xAB,0x38,0xCC,0x40,0x52,0x79,0xD7,0x99,0x95,0x91,0x95,0x91,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x75,0x79,
-	0x75,0x79,0x75,0x79,0x75,0x79,0x33,0x69,0x10,0x69,0xCF,0x48,0xCC,0x40,0xCC,0x40,0xCF,0x58,0xCF,0x58,0xCC,0x40,0xAA,0x38,0xA9,0x30,0xA9,0x30,0x67,0x28,0x68,0x28,0x67,0x28,0x67,0x20,0x66,0x28,0x66,0x20,0x65,0x20,0x65,0x20,0x24,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x20,0x24,0x20,0x64,0x28,0x24,0x20,0x23,0x18,
-	0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x08,0x21,0x08,0x20,0x10,0x21,0x10,0x22,0x18,
-	0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x23,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,
-	0x64,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xCA,0x00,0xEC,0x10,0xCC,0x08,0xEE,0x18,0x4F,0x01,0x92,0x09,0x37,0x0A,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x37,0x0A,0x37,0x0A,0xD5,0x09,0x37,0x0A,0x3B,0x22,0xDC,0x3C,
-	0x1D,0x56,0x1E,0x87,0x1E,0x87,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3B,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0xDC,0x3B,0x3B,0x22,0x3B,0x22,0x3B,0x22,0xD5,0x09,0xD5,0x09,0x55,0x29,0x32,0x21,0x2F,0x19,0xEE,0x18,0x2C,0x18,0xEE,0x18,0xCF,0x20,0xCF,0x20,
-	0x4C,0x28,0x4B,0x28,0x2B,0x30,0x4B,0x28,0x29,0x28,0x49,0x30,0x28,0x28,0x49,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x29,0x40,0x49,0x30,0x27,0x30,0x26,0x28,0x65,0x20,0x24,0x20,0x24,0x20,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x10,0x64,0x18,0x24,0x18,0x65,0x20,0x65,0x18,0x25,0x20,0x66,0x20,0x67,0x20,
-	0x67,0x28,0xA9,0x30,0xAA,0x38,0xAB,0x38,0xCF,0x58,0x75,0x79,0xD7,0x99,0x95,0x91,0xD7,0x99,0x33,0x69,0x33,0x69,0x75,0x79,0x75,0x79,0x75,0x79,0x95,0x91,0xD7,0x99,0x33,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0x10,0x69,0xCC,0x40,0xCC,0x40,0xED,0x58,0x30,0x59,0xCF,0x48,0xAB,0x40,0xAB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x68,0x28,
-	0x67,0x28,0x67,0x28,0x66,0x28,0x66,0x28,0x25,0x20,0x65,0x20,0x64,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x24,0x20,0x24,0x20,0x65,0x28,0x24,0x20,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x20,0x21,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x23,0x00,0x63,0x00,0x63,0x08,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xCA,0x00,
-	0xCA,0x00,0xEC,0x10,0xCC,0x08,0x2D,0x01,0x92,0x09,0x55,0x29,0x37,0x0A,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x37,0x0A,0x37,0x0A,0x3B,0x22,0x3B,0x22,0xDC,0x3C,0x1D,0x56,0x1E,0x87,0x1E,0x87,0x1E,0x87,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0xDC,0x3B,0xDC,0x3B,0xDC,0x3C,0xDC,0x3C,
-	0xDC,0x3B,0xDB,0x32,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x3B,0x22,0xB8,0x29,0x55,0x29,0x32,0x21,0xF1,0x20,0x55,0x29,0xB8,0x29,0xEE,0x18,0xCF,0x20,0xCF,0x20,0xAD,0x20,0x4B,0x28,0x4A,0x18,0x69,0x28,0x29,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x27,0x28,0x27,0x28,0x25,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x27,0x30,0x49,0x30,
-	0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x20,0x65,0x18,0x24,0x20,0x24,0x18,0x64,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x65,0x18,0x65,0x18,0x65,0x20,0x65,0x20,0x67,0x20,0xA9,0x30,0xAA,0x38,0xAB,0x38,0xCC,0x40,0x33,0x69,0xD7,0x99,0xD7,0x99,0x95,0x91,0x33,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0x75,0x79,0x95,0x91,
-	0x33,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0xCF,0x58,0xCC,0x40,0xCC,0x40,0xCF,0x48,0xCF,0x58,0xAB,0x40,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xA9,0x30,0x49,0x30,0x67,0x28,0x67,0x28,0x67,0x20,0x66,0x28,0x66,0x20,0x25,0x20,0x65,0x20,0x25,0x20,0x24,0x20,0x24,0x18,0x24,0x18,0x24,0x20,0x25,0x28,0x64,0x28,0x24,0x20,0x23,0x18,0x22,0x18,
-	0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x21,0x10,0x22,0x18,0x21,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x08,0x21,0x10,
-	0x21,0x10,0x22,0x18,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x64,0x08,0x64,0x00,0x64,0x00,0x23,0x00,0x64,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,
-	0x65,0x08,0x65,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xCA,0x00,0xEA,0x10,0xCC,0x08,0xCC,0x08,0x2F,0x19,0x92,0x09,0xD5,0x09,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x37,0x0A,0x55,0x29,0x3B,0x22,0x3B,0x22,0xDC,0x3B,0x1D,0x56,0x1E,0x87,
-	0x1E,0x87,0x1E,0x87,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0x5A,0x1B,0x5A,0x1B,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x37,0x0A,0xD5,0x09,0x32,0x21,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xCF,0x20,
-	0x4A,0x18,0x69,0x20,0x69,0x20,0x29,0x28,0x29,0x28,0x28,0x28,0x27,0x28,0x26,0x28,0x26,0x28,0x25,0x28,0x25,0x28,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x20,0x24,0x20,0x25,0x18,0x25,0x20,0x24,0x18,0x24,0x18,0x64,0x18,0x24,0x18,0x64,0x18,0x24,0x18,0x65,0x20,0x25,0x18,0x65,0x20,
-	0x66,0x20,0x68,0x28,0xAA,0x30,0xAA,0x38,0xAB,0x38,0xCF,0x48,0x33,0x69,0xD7,0x99,0x95,0x91,0x33,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0x92,0x50,0x33,0x69,0x33,0x69,0x10,0x69,0x30,0x59,0xCF,0x48,0xCC,0x40,0xCF,0x58,0xCF,0x58,0xCC,0x40,0xAA,0x38,0xAB,0x38,0xAB,0x40,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xA9,0x30,
-	0x68,0x28,0x67,0x28,0x66,0x28,0x26,0x20,0x25,0x20,0x25,0x20,0x24,0x18,0x24,0x18,0x24,0x20,0x24,0x20,0x24,0x20,0x64,0x28,0x24,0x20,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,
-	0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x10,0x21,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x00,0x23,0x00,0x64,0x08,0x63,0x00,0x64,0x08,0x23,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x08,0x64,0x00,0x65,0x00,0x65,0x08,0x65,0x08,0xA7,0x08,0x65,0x08,0x65,0x08,0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0xA7,0x08,0x48,0x00,0xA8,0x08,0xAA,0x10,
-	0xCA,0x00,0xCC,0x08,0xEE,0x18,0x4F,0x01,0x37,0x0A,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x37,0x0A,0xB8,0x29,0x3B,0x22,0x3B,0x22,0xDB,0x32,0x1D,0x56,0x1E,0x87,0x1E,0x87,0x1E,0x87,0x1E,0x87,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0x5A,0x1B,0x5A,0x1B,0x5A,0x1B,0xDC,0x3C,0xDC,0x3B,0xDC,0x3B,0x5A,0x1B,
-	0xDB,0x32,0xDB,0x32,0xDB,0x32,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x3B,0x22,0xB8,0x29,0x55,0x29,0x92,0x09,0xCF,0x00,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x4C,0x28,0xAB,0x18,0x69,0x20,0x69,0x20,0x4B,0x28,0x29,0x28,0x28,0x28,0x27,0x28,0x27,0x20,0x26,0x20,0x25,0x20,0x24,0x20,0x25,0x28,0x26,0x28,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x26,0x28,0x26,0x28,0x26,0x28,0x65,0x20,0x25,0x20,0x65,0x20,0x25,0x20,0x65,0x20,0x25,0x20,0x25,0x18,0x24,0x18,0x24,0x18,0x25,0x18,0x65,0x18,0x65,0x18,0x25,0x18,0x66,0x20,0x68,0x28,0xA9,0x30,0xAA,0x38,0xAB,0x38,0xCC,0x40,0x30,0x59,0x75,0x79,0xD7,0x99,0x75,0x79,0x33,0x69,0x30,0x59,0x30,0x59,0x92,0x50,0x30,0x59,0x30,0x59,
-	0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0xCF,0x48,0xCF,0x58,0xCF,0x48,0xCC,0x40,0xAB,0x38,0xCC,0x40,0xCC,0x40,0xAB,0x40,0xAA,0x38,0xAA,0x38,0x49,0x30,0xAA,0x30,0x49,0x30,0x67,0x28,0x66,0x28,0x66,0x20,0x25,0x20,0x65,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x25,0x28,0x25,0x28,0x64,0x20,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x18,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x10,0x21,0x18,0x21,0x18,0x22,0x10,0x21,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x20,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x18,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x08,0x64,0x00,0x23,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x00,0x64,0x08,0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x00,
-	0x65,0x08,0xA7,0x08,0xA8,0x08,0xA7,0x08,0x65,0x08,0x65,0x08,0x65,0x00,0xA7,0x08,0xA7,0x08,0x65,0x08,0xA7,0x08,0xA7,0x08,0x67,0x10,0xA8,0x08,0xA8,0x08,0xCA,0x00,0xEC,0x10,0xCC,0x08,0x4F,0x01,0x32,0x21,0xB8,0x29,0xB8,0x29,0x3B,0x22,0x37,0x0A,0xB8,0x29,0x37,0x0A,0x3B,0x22,0xDB,0x32,0x1D,0x56,0x1D,0x56,0x1E,0x87,0x1E,0x87,
-	0x1E,0x87,0xDC,0x3C,0xDC,0x3C,0x1D,0x56,0x1D,0x56,0xDC,0x3C,0xDC,0x3B,0x3B,0x22,0xB9,0x12,0x3B,0x22,0x5A,0x1B,0xDC,0x3B,0xDC,0x3B,0x5A,0x1B,0xDC,0x3B,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0x3B,0x22,0x3B,0x22,0x3B,0x22,0xD5,0x09,0x55,0x29,0x32,0x21,0xF1,0x20,0xCF,0x00,0x32,0x21,0xF3,0x38,0xF1,0x20,0xCF,0x20,
-	0x4B,0x28,0xAB,0x20,0xAA,0x20,0x29,0x20,0x29,0x28,0x29,0x28,0x27,0x20,0x27,0x28,0x26,0x28,0x25,0x20,0x24,0x18,0x24,0x20,0x24,0x20,0x25,0x20,0x25,0x28,0x25,0x28,0x25,0x28,0x25,0x20,0x25,0x28,0x25,0x20,0x25,0x28,0x66,0x20,0x65,0x20,0x25,0x20,0x65,0x20,0x65,0x20,0x65,0x20,0x65,0x18,0x64,0x18,0x25,0x18,0x65,0x18,0x65,0x18,
-	0x66,0x20,0x67,0x20,0xA9,0x30,0xAA,0x30,0xAB,0x30,0xAB,0x38,0xCF,0x48,0x33,0x69,0x75,0x79,0xD7,0x99,0x75,0x79,0xD5,0x50,0x30,0x59,0x92,0x50,0x92,0x50,0x33,0x69,0x92,0x50,0x30,0x59,0x33,0x69,0x92,0x50,0x30,0x59,0xCF,0x48,0xAB,0x38,0xAA,0x38,0xCC,0x40,0xCC,0x40,0xAB,0x38,0xAB,0x38,0xAA,0x38,0xAA,0x38,0xA9,0x30,0x49,0x30,
-	0xA9,0x30,0x49,0x30,0x67,0x28,0x66,0x28,0x25,0x20,0x25,0x20,0x24,0x18,0x65,0x20,0x25,0x20,0x25,0x28,0x24,0x20,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x21,0x18,0x22,0x10,0x22,0x18,0x21,0x10,0x22,0x18,0x21,0x10,0x21,0x18,0x21,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xA7,0x08,0x65,0x08,0x26,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA9,0x10,0xCA,0x00,
-	0xEC,0x10,0xCC,0x08,0x32,0x21,0xD5,0x09,0x3B,0x22,0x3B,0x22,0xB8,0x29,0xB8,0x29,0x3B,0x22,0x3B,0x22,0xDB,0x32,0xDC,0x3C,0x1E,0x87,0x1E,0x87,0x1E,0x87,0x1E,0x87,0x1D,0x56,0xDC,0x3C,0x1D,0x56,0xDC,0x3C,0xDC,0x3B,0xDB,0x32,0xDB,0x32,0xB9,0x12,0x59,0x2A,0x5A,0x1B,0xDC,0x3B,0x5A,0x1B,0xDC,0x3B,0xDB,0x32,0x5A,0x1B,0xDB,0x32,
-	0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0x3B,0x22,0x3B,0x22,0x55,0x29,0xD5,0x09,0x92,0x09,0xF1,0x20,0x32,0x21,0x32,0x21,0x32,0x21,0xF1,0x20,0xCF,0x20,0x2C,0x18,0xAB,0x18,0x4B,0x28,0x4B,0x28,0x4B,0x28,0x29,0x28,0x27,0x28,0x27,0x20,0x26,0x20,0x25,0x20,0x25,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x25,0x20,
-	0x25,0x28,0x25,0x20,0x25,0x20,0x25,0x20,0x25,0x20,0x26,0x28,0x66,0x28,0x66,0x20,0x26,0x20,0x66,0x20,0x25,0x18,0x65,0x20,0x25,0x18,0x65,0x18,0x25,0x18,0x65,0x18,0x66,0x18,0x66,0x20,0x68,0x28,0xAA,0x30,0xAA,0x30,0xAB,0x38,0xCF,0x48,0x30,0x59,0xD5,0x50,0xD5,0x50,0x33,0x69,0x33,0x69,0x75,0x79,0x33,0x69,0x33,0x69,0x33,0x69,
-	0x33,0x69,0x33,0x69,0x33,0x69,0xCF,0x58,0xCC,0x40,0xAB,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAB,0x38,0xAA,0x38,0xAA,0x38,0x49,0x30,0xAA,0x38,0x69,0x28,0x49,0x30,0x68,0x28,0x68,0x28,0x67,0x28,0x66,0x28,0x65,0x20,0x25,0x20,0x24,0x20,0x25,0x20,0x65,0x28,0x25,0x28,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x10,
-	0x22,0x10,0x22,0x18,0x21,0x10,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x10,0x22,0x18,0x21,0x10,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x08,0x65,0x08,0x64,0x00,0x24,0x08,0x64,0x00,0x64,0x08,0x65,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0xA7,0x08,
-	0x65,0x08,0xA7,0x08,0x26,0x08,0xA8,0x08,0xA9,0x10,0xA8,0x08,0xA7,0x08,0xA7,0x08,0x67,0x10,0xA7,0x08,0x67,0x10,0xA8,0x08,0xA8,0x08,0xAA,0x10,0xCA,0x00,0xEC,0x10,0xCC,0x08,0x2F,0x19,0xD5,0x09,0xB8,0x29,0x59,0x2A,0x37,0x0A,0xB8,0x29,0x37,0x0A,0x3B,0x22,0x3B,0x22,0xDC,0x3C,0x1E,0x87,0x1E,0x87,0xDF,0xD6,0x1E,0x87,0xDC,0x3C,
-	0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0xDC,0x3B,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x59,0x2A,0xDB,0x32,0xDC,0x3B,0xDB,0x32,0x5A,0x1B,0x5A,0x1B,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x55,0x29,0x32,0x21,0xF1,0x20,0x32,0x21,0x55,0x29,0x55,0x29,0xF1,0x20,0xEE,0x18,
-	0xAD,0x20,0x2C,0x18,0xAB,0x28,0x4B,0x28,0x4B,0x28,0x29,0x28,0x28,0x28,0x27,0x28,0x26,0x20,0x25,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x25,0x20,0x25,0x20,0x25,0x20,0x26,0x20,0x26,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x26,0x18,0x65,0x20,0x65,0x18,0x65,0x18,0x65,0x18,
-	0x66,0x20,0x66,0x20,0x67,0x20,0x69,0x28,0xAA,0x30,0xAB,0x38,0xAB,0x38,0xCF,0x48,0x33,0x69,0x75,0x79,0x30,0x59,0x92,0x50,0x92,0x50,0xD5,0x50,0xD7,0x99,0x33,0x69,0x33,0x69,0x92,0x50,0xCF,0x48,0xAB,0x38,0xAB,0x30,0xAA,0x30,0xAA,0x30,0xAB,0x38,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x38,0xA9,0x30,0x49,0x30,0x49,0x30,
-	0x68,0x28,0x67,0x28,0x67,0x20,0x66,0x28,0x25,0x20,0x24,0x20,0x25,0x20,0x65,0x20,0x25,0x28,0x25,0x28,0x23,0x18,0x23,0x18,0x22,0x10,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x10,0x22,0x18,0x21,0x10,0x22,0x10,0x22,0x18,0x21,0x10,0x22,0x18,0x22,0x10,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x08,0x65,0x00,0x65,0x00,0x65,0x08,0x65,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x00,0x65,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xAA,0x10,0xA9,0x10,0xA8,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x08,0xA9,0x10,0xAA,0x10,0xCA,0x00,0xEC,0x10,0xEC,0x10,
-	0x2F,0x19,0x32,0x21,0xB8,0x29,0x59,0x2A,0x59,0x2A,0xB8,0x29,0x37,0x0A,0x3B,0x22,0x3B,0x22,0xDC,0x3B,0x1D,0x56,0x1E,0x87,0xDF,0xD6,0x1E,0x87,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDC,0x3B,0xDC,0x3B,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x59,0x2A,0x59,0x2A,0x5A,0x1B,0x59,0x2A,0x59,0x2A,0x59,0x2A,0xDB,0x32,0x59,0x2A,0xDB,0x32,
-	0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDC,0x3B,0xFC,0x41,0x3B,0x22,0x3B,0x22,0x55,0x29,0xD5,0x09,0x32,0x21,0x92,0x09,0x55,0x29,0x55,0x29,0x55,0x29,0xF3,0x38,0xF1,0x20,0x2F,0x28,0xAD,0x20,0xAD,0x20,0x4C,0x28,0x4B,0x28,0x29,0x28,0x29,0x20,0x28,0x28,0x26,0x28,0x26,0x20,0x25,0x18,0x24,0x20,0x23,0x18,0x24,0x18,0x24,0x18,0x23,0x18,
-	0x24,0x18,0x24,0x18,0x24,0x18,0x24,0x20,0x25,0x20,0x25,0x20,0x26,0x20,0x66,0x28,0x67,0x20,0x26,0x20,0x66,0x20,0x66,0x20,0x66,0x18,0x25,0x18,0x65,0x18,0x25,0x18,0x66,0x18,0x66,0x20,0x66,0x20,0x67,0x20,0x69,0x28,0xAA,0x30,0xAB,0x38,0xCF,0x48,0x92,0x50,0x33,0x69,0x92,0x50,0xCF,0x48,0xCF,0x48,0xCF,0x48,0x92,0x50,0xCF,0x48,
-	0xAF,0x38,0xAB,0x38,0xAB,0x30,0xAB,0x30,0xAA,0x30,0x69,0x28,0xAA,0x30,0xAA,0x30,0x69,0x28,0x49,0x30,0xA9,0x30,0x49,0x30,0xA9,0x30,0x69,0x28,0x68,0x28,0x68,0x28,0x67,0x28,0x67,0x28,0x66,0x28,0x26,0x28,0x26,0x20,0x25,0x20,0x25,0x20,0x25,0x28,0x25,0x28,0x24,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,
-	0x22,0x10,0x21,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x22,0x10,0x21,0x18,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x20,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x00,0x65,0x08,0xA7,0x08,0xA7,0x08,0xA7,0x08,0x26,0x08,0xA7,0x08,0x67,0x10,0x67,0x10,0xA7,0x08,
-	0x67,0x10,0xA8,0x08,0x67,0x10,0xA8,0x08,0xA7,0x08,0xA8,0x08,0xEC,0x10,0xAB,0x10,0xAA,0x10,0xA9,0x10,0xAA,0x10,0xCA,0x00,0xAA,0x10,0xAB,0x10,0xED,0x18,0x4F,0x01,0x32,0x21,0x37,0x0A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0xDB,0x32,0xDC,0x3B,0xDF,0x7C,0xDF,0xD6,0xDF,0xD6,0x1E,0x87,0x1D,0x56,0xDC,0x3C,0xDC,0x3C,
-	0xDC,0x3C,0xDC,0x3B,0xDC,0x3B,0xDB,0x32,0x3B,0x22,0x37,0x0A,0x59,0x2A,0x3B,0x22,0xDB,0x32,0xDB,0x32,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0xDB,0x32,0x3B,0x22,0xDB,0x32,0xDC,0x3B,0x3B,0x22,0x3B,0x22,0x3B,0x22,0xB8,0x29,0x32,0x21,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0x55,0x29,0x55,0x29,0xF1,0x20,
-	0xCF,0x20,0x2F,0x28,0xAD,0x20,0x4C,0x28,0x4B,0x28,0x4B,0x28,0x28,0x28,0x28,0x20,0x26,0x28,0x26,0x20,0x25,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x18,0x24,0x18,0x25,0x20,0x26,0x20,0x26,0x20,0x66,0x28,0x67,0x20,0x26,0x20,0x67,0x20,0x66,0x20,0x66,0x20,0x65,0x18,0x66,0x20,
-	0x65,0x18,0x26,0x18,0x66,0x20,0x67,0x20,0x68,0x20,0x69,0x28,0xAB,0x30,0xCF,0x48,0xCF,0x48,0x92,0x50,0xCF,0x48,0xCF,0x48,0xAF,0x38,0xCF,0x48,0xCF,0x48,0xEC,0x38,0xAB,0x38,0xAB,0x30,0xAA,0x30,0xAA,0x30,0x69,0x28,0xA9,0x28,0xAA,0x30,0x69,0x28,0x69,0x28,0x68,0x28,0xA9,0x28,0x69,0x28,0x49,0x30,0xA9,0x30,0x49,0x30,0x68,0x28,
-	0x67,0x20,0x27,0x28,0x26,0x28,0x26,0x28,0x66,0x28,0x25,0x20,0x65,0x20,0x65,0x28,0x25,0x20,0x24,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x18,0x21,0x18,0x22,0x18,0x21,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x22,0x18,0x21,0x18,0x20,0x10,0x21,0x10,0x21,0x10,0x21,0x20,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,
-	0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x08,0x65,0x08,0xA7,0x08,0x67,0x10,0xA7,0x08,0xA7,0x08,0xA7,0x08,0x65,0x08,0xA7,0x08,0x67,0x10,0x67,0x10,0xA7,0x08,0x67,0x10,0xA8,0x08,0xA8,0x08,0xA8,0x08,0x67,0x10,0xA8,0x08,0xA8,0x08,0xA8,0x10,0xA8,0x08,0xA8,0x08,0xAA,0x10,0xED,0x18,0xED,0x18,0xEC,0x10,0xAB,0x10,0xAB,0x10,0xEC,0x10,0xCC,0x08,0x2F,0x19,0x55,0x29,
-	0xB8,0x29,0x59,0x2A,0x59,0x2A,0x59,0x2A,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDC,0x3B,0x1E,0x87,0x1E,0x87,0xDF,0xD6,0xDF,0xD6,0x1E,0x87,0x1D,0x56,0xDF,0x7C,0xDF,0x7C,0xDC,0x3C,0xDC,0x3B,0xDB,0x32,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x3B,0x22,0xDB,0x32,0x59,0x2A,0x59,0x2A,0xB9,0x12,0x59,0x2A,0x59,0x2A,0x59,0x2A,0xDB,0x32,0x59,0x2A,
-	0x59,0x2A,0x59,0x2A,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x3B,0x22,0x37,0x0A,0x55,0x29,0xD5,0x09,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0x37,0x41,0xF3,0x38,0xF1,0x20,0xF1,0x20,0xCF,0x20,0x4C,0x28,0x4C,0x28,0x4C,0x28,0x29,0x28,0x29,0x28,0x28,0x20,0x27,0x20,0x26,0x20,0x25,0x20,0x25,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x23,0x10,0x23,0x18,0x24,0x18,0x25,0x20,0x25,0x20,0x26,0x20,0x26,0x20,0x67,0x28,0x67,0x20,0x67,0x20,0x67,0x20,0x26,0x20,0x66,0x18,0x26,0x18,0x65,0x18,0x66,0x18,0x66,0x18,0x66,0x20,0x67,0x20,0x67,0x20,0x69,0x28,0xAB,0x30,0xCF,0x48,0x92,0x50,0xCF,0x48,0xAF,0x38,0xEC,0x38,0xEC,0x38,0xAB,0x30,0xAB,0x30,
-	0xAA,0x30,0xAA,0x30,0xAA,0x30,0x69,0x28,0xA9,0x28,0x68,0x28,0x69,0x28,0x69,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x27,0x28,0x67,0x28,0x67,0x20,0x26,0x28,0x26,0x20,0x26,0x28,0x25,0x20,0x65,0x20,0x25,0x28,0x24,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,
-	0x21,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x18,0x22,0x18,0x21,0x18,0x21,0x10,0x20,0x08,0x21,0x10,0x21,0x18,0x22,0x20,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x08,0xA7,0x08,0xA7,0x08,0x67,0x10,0xA8,0x08,0x67,0x10,0x67,0x10,0x67,0x10,0xA7,0x08,0x67,0x10,0xA7,0x08,0xA8,0x10,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,
-	0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x10,0xA8,0x08,0xCC,0x08,0xEE,0x18,0x2F,0x19,0xEE,0x18,0xED,0x18,0xEE,0x18,0x32,0x21,0x55,0x29,0xB8,0x29,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDC,0x3B,0xDC,0x3B,0xDF,0x7C,0xDF,0xD6,0xDF,0xD6,0xFF,0xFF,0x1E,0x87,0x1D,0x56,0xDF,0x7C,0x1D,0x56,0xDC,0x3C,
-	0xDC,0x3B,0xDB,0x32,0xDB,0x32,0x3B,0x22,0x59,0x2A,0x59,0x2A,0xDB,0x32,0xDB,0x32,0x59,0x2A,0x37,0x0A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x3B,0x22,0x59,0x2A,0x3B,0x22,0x3B,0x22,0x3B,0x22,0xB8,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0x55,0x29,0x55,0x29,0xF1,0x20,
-	0xF1,0x20,0xCF,0x20,0xCF,0x20,0x4C,0x28,0x4B,0x28,0x29,0x28,0x29,0x28,0x28,0x20,0x27,0x20,0x26,0x20,0x25,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x25,0x20,0x23,0x18,0x23,0x10,0x23,0x10,0x24,0x18,0x24,0x18,0x25,0x18,0x66,0x20,0x26,0x20,0x27,0x20,0x67,0x20,0x27,0x28,0x67,0x20,0x66,0x20,0x26,0x18,0x66,0x18,
-	0x65,0x18,0x65,0x18,0x26,0x18,0x66,0x18,0x67,0x20,0x67,0x20,0x68,0x20,0x69,0x28,0xEC,0x38,0xAF,0x38,0xEC,0x38,0xAB,0x30,0xAA,0x30,0x2B,0x30,0x69,0x28,0xAA,0x30,0x69,0x28,0x69,0x28,0x69,0x28,0x69,0x28,0x68,0x28,0x68,0x20,0x68,0x28,0x69,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x67,0x20,0x67,0x28,
-	0x67,0x20,0x67,0x28,0x26,0x28,0x26,0x28,0x66,0x28,0x65,0x20,0x26,0x28,0x25,0x28,0x24,0x18,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x18,0x22,0x20,0x21,0x10,0x20,0x10,0x20,0x08,0x21,0x10,0x21,0x18,0x21,0x20,0x21,0x10,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x08,0x65,0x08,0x67,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x08,0xA9,0x10,0xA8,0x08,0xA8,0x08,0xA9,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x08,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xED,0x18,0x32,0x21,0x55,0x29,0x92,0x09,0x55,0x29,0x55,0x29,0x59,0x2A,0xDB,0x32,
-	0x9D,0x5A,0x9D,0x5A,0xDC,0x3B,0x3E,0x6B,0xDC,0x3B,0xDC,0x3B,0xDF,0x7C,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0x1E,0x87,0x1E,0x87,0xDF,0x7C,0x1D,0x56,0x3E,0x6B,0xDC,0x3B,0xDB,0x32,0xDB,0x32,0x59,0x2A,0xDB,0x32,0xDB,0x32,0xDB,0x32,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0xB8,0x29,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,
-	0xB9,0x12,0x59,0x2A,0x59,0x2A,0x3B,0x22,0xB8,0x29,0xB8,0x29,0xD5,0x09,0x32,0x21,0x92,0x09,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0x37,0x41,0xF3,0x38,0xF1,0x20,0xCF,0x20,0x2F,0x28,0xCF,0x20,0x4C,0x28,0x4C,0x28,0x29,0x20,0x29,0x20,0x27,0x28,0x28,0x20,0x26,0x18,0x25,0x18,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x10,0x22,0x10,0x23,0x10,0x23,0x10,0x24,0x18,0x25,0x18,0x25,0x20,0x26,0x20,0x26,0x20,0x69,0x28,0x69,0x28,0x67,0x20,0x27,0x20,0x66,0x20,0x66,0x18,0x26,0x18,0x66,0x18,0x65,0x18,0x66,0x18,0x66,0x18,0x67,0x18,0x67,0x20,0x69,0x28,0xAB,0x28,0x4D,0x30,0xAB,0x30,0x69,0x28,0x69,0x28,0xAA,0x28,0xAA,0x28,0x69,0x28,
-	0x69,0x28,0x69,0x28,0x68,0x28,0x68,0x28,0x68,0x20,0x68,0x20,0x68,0x28,0x69,0x28,0x68,0x28,0x68,0x20,0x68,0x28,0x67,0x20,0x68,0x28,0x68,0x28,0x27,0x28,0x67,0x20,0x27,0x28,0x27,0x28,0x26,0x20,0x66,0x28,0x65,0x20,0x24,0x20,0x25,0x20,0x24,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x18,0x21,0x18,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x20,0x22,0x18,0x21,0x10,0x20,0x08,0x20,0x08,0x21,0x10,0x22,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x08,0xA7,0x08,0x67,0x10,0xA8,0x08,0xA8,0x08,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x08,
-	0xAA,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xAA,0x10,0xCA,0x00,0xAB,0x10,0xEC,0x10,0xEE,0x18,0x32,0x21,0xB8,0x29,0x59,0x2A,0x59,0x2A,0x59,0x2A,0xFC,0x41,0xDB,0x32,0xDC,0x3B,0xDC,0x3B,0x3E,0x6B,0xDC,0x3C,0xDF,0x7C,0xDF,0x7C,0xDF,0xD6,0xFF,0xFF,0xDF,0xD6,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0x1E,0x87,0xDF,0x7C,0xDF,0x7C,0xDC,0x3C,
-	0xDC,0x3B,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xDB,0x32,0x59,0x2A,0x59,0x2A,0x37,0x0A,0xB8,0x29,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0xB8,0x29,0xB8,0x29,0xB8,0x29,0xB8,0x29,0x55,0x29,0x55,0x29,0x92,0x09,0xF1,0x20,0x32,0x21,0x32,0x21,0x55,0x29,0x55,0x29,0x55,0x29,0x55,0x29,0xF1,0x20,
-	0xCF,0x20,0xCF,0x20,0xAD,0x20,0x4C,0x28,0x4B,0x28,0x4B,0x28,0x29,0x20,0x29,0x28,0x27,0x20,0x25,0x18,0x25,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x23,0x10,0x24,0x18,0x25,0x18,0x66,0x20,0x27,0x28,0x2B,0x30,0x69,0x28,0x68,0x20,0x68,0x20,0x27,0x20,0x67,0x20,
-	0x66,0x18,0x26,0x18,0x66,0x18,0x25,0x18,0x66,0x18,0x66,0x18,0x67,0x18,0x69,0x20,0xAA,0x28,0xAB,0x30,0xAB,0x28,0x69,0x28,0x69,0x28,0x69,0x28,0x69,0x28,0x69,0x28,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x67,0x20,0x67,0x20,0x68,0x28,0x68,0x20,0x68,0x20,0x67,0x20,0x68,0x28,0x69,0x28,0x67,0x28,0x67,0x20,0x67,0x28,
-	0x27,0x20,0x27,0x28,0x26,0x28,0x66,0x20,0x25,0x18,0x24,0x18,0x24,0x20,0x24,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x20,0x22,0x20,0x21,0x18,0x20,0x10,0x20,0x08,0x21,0x10,0x21,0x18,0x22,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,
-	0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x08,0x67,0x10,0xA7,0x08,0x67,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xAB,0x10,0xCA,0x00,0xAB,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xEE,0x18,0x2F,0x19,0x32,0x21,0xB8,0x29,0xFC,0x41,0x9D,0x5A,0x9D,0x5A,0xDC,0x3B,0x3E,0x6B,
-	0x3E,0x6B,0xDC,0x3B,0x3E,0x6B,0xDF,0x7C,0x1E,0x87,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0x1D,0x56,0xDF,0x7C,0xDF,0x7C,0xDC,0x3B,0xDB,0x32,0xDB,0x32,0xDC,0x3B,0xDB,0x32,0xDB,0x32,0x59,0x2A,0x59,0x2A,0xB8,0x29,0x59,0x2A,0xB8,0x29,0x59,0x2A,0x59,0x2A,0xB8,0x29,0x59,0x2A,0x59,0x2A,
-	0xB8,0x29,0x37,0x0A,0xB8,0x29,0xB8,0x29,0xD5,0x09,0x55,0x29,0x32,0x21,0xF1,0x20,0x2F,0x19,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0x55,0x29,0xF3,0x38,0xF1,0x20,0xCF,0x20,0xCF,0x20,0xAF,0x38,0x4C,0x28,0x29,0x20,0x30,0x38,0x30,0x38,0x29,0x20,0x26,0x20,0x25,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,
-	0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x23,0x10,0x24,0x18,0x25,0x18,0x26,0x18,0x67,0x20,0x27,0x20,0x68,0x28,0x68,0x20,0x68,0x20,0x67,0x20,0x67,0x18,0x26,0x18,0x66,0x18,0x25,0x10,0x25,0x10,0x26,0x18,0x67,0x18,0x68,0x20,0xAA,0x28,0x4B,0x28,0x69,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,
-	0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x67,0x20,0x67,0x18,0x67,0x20,0x68,0x28,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x28,0x67,0x20,0x67,0x20,0x27,0x20,0x27,0x20,0x66,0x28,0x26,0x20,0x25,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x10,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x22,0x10,0x21,0x08,0x21,0x10,
-	0x21,0x10,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x18,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x20,0x08,0x21,0x10,0x21,0x20,0x22,0x20,0x21,0x18,0x21,0x10,0x20,0x00,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x67,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x08,0xA9,0x10,0xAA,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,
-	0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0x59,0x2A,0xDC,0x3B,0xDF,0x7C,0xDF,0x7C,0x3E,0x6B,0xDC,0x3B,0xDF,0x7C,0xDF,0x7C,0x1E,0x87,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0x1E,0x87,0x1E,0x87,0xDF,0x7C,0xDC,0x3B,
-	0x3E,0x6B,0xDC,0x3B,0xDC,0x3B,0xDC,0x3B,0xDB,0x32,0x59,0x2A,0x59,0x2A,0xB8,0x29,0x59,0x2A,0xB8,0x29,0x59,0x2A,0xB8,0x29,0xB8,0x29,0xB8,0x29,0x59,0x2A,0xB8,0x29,0xB8,0x29,0xB8,0x29,0xB8,0x29,0xD5,0x09,0x55,0x29,0x32,0x21,0x32,0x21,0xEE,0x18,0x92,0x09,0x2F,0x19,0x32,0x21,0x55,0x29,0x55,0x29,0x37,0x41,0x55,0x29,0xF3,0x38,
-	0xCF,0x20,0x2F,0x28,0xCF,0x20,0x4C,0x28,0x4C,0x28,0x30,0x38,0x4D,0x30,0x29,0x20,0x26,0x18,0x25,0x18,0x25,0x10,0x23,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x23,0x10,0x24,0x10,0x24,0x18,0x26,0x18,0x26,0x20,0x27,0x20,0x68,0x20,0x69,0x20,0x68,0x20,0x68,0x20,
-	0x68,0x20,0x67,0x18,0x67,0x18,0x66,0x10,0x65,0x18,0x26,0x10,0x66,0x18,0x28,0x20,0x69,0x20,0x69,0x20,0x69,0x20,0x68,0x18,0x68,0x20,0x68,0x18,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x18,0x68,0x20,0x67,0x20,0x67,0x18,0x27,0x20,0x67,0x18,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x28,0x68,0x20,0x68,0x28,0x67,0x20,0x26,0x20,
-	0x66,0x20,0x26,0x20,0x25,0x20,0x24,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x20,0x10,0x21,0x08,0x21,0x10,0x22,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x67,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x08,0xA9,0x10,0xA8,0x08,0xAA,0x10,0xEA,0x10,0xAB,0x10,0xEC,0x10,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x32,0x21,0x32,0x21,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0x59,0x2A,0x9D,0x5A,0x3E,0x6B,0x1E,0x87,0x5E,0xC5,
-	0xDF,0x7C,0xDF,0x7C,0x1E,0x87,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0x1E,0x87,0x1E,0x87,0xDF,0x7C,0xDC,0x3B,0xDC,0x3B,0xDC,0x3B,0x3E,0x6B,0xDC,0x3B,0xDB,0x32,0x59,0x2A,0x59,0x2A,0xB8,0x29,0xB8,0x29,0x59,0x2A,0xB8,0x29,0x59,0x2A,0xB8,0x29,0x59,0x2A,0xB8,0x29,0x55,0x29,
-	0xB8,0x29,0x55,0x29,0xD5,0x09,0x55,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0xCF,0x00,0x2F,0x19,0xF1,0x20,0xF1,0x20,0x32,0x21,0x55,0x29,0x55,0x29,0x55,0x29,0xF1,0x20,0xCF,0x20,0xCF,0x20,0x2C,0x18,0x2C,0x18,0x4C,0x28,0x29,0x20,0x28,0x10,0x28,0x10,0x26,0x18,0x26,0x10,0x24,0x10,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,
-	0x22,0x10,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x23,0x10,0x23,0x10,0x23,0x10,0x25,0x10,0x26,0x18,0x67,0x20,0x28,0x20,0x68,0x20,0x69,0x20,0x69,0x20,0x68,0x20,0x68,0x20,0x27,0x18,0x26,0x18,0x26,0x10,0x26,0x18,0x67,0x18,0x68,0x18,0x69,0x20,0x69,0x20,0x68,0x20,0x67,0x18,0x27,0x18,0x68,0x18,0x68,0x20,0x68,0x18,
-	0x68,0x20,0x68,0x18,0x67,0x20,0x68,0x18,0x27,0x18,0x67,0x20,0x67,0x18,0x27,0x18,0x67,0x20,0x67,0x20,0x68,0x28,0x68,0x28,0x68,0x28,0x27,0x20,0x27,0x20,0x26,0x20,0x26,0x20,0x24,0x18,0x24,0x10,0x23,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x18,
-	0x22,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x18,0x22,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x08,0xA8,0x10,0xA8,0x08,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xEC,0x10,0xAB,0x10,0xEC,0x10,0xEE,0x18,0xEE,0x18,0xCC,0x08,0xEE,0x18,0xEE,0x18,
-	0x2F,0x19,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0xFC,0x41,0xDB,0x32,0xDF,0x7C,0xDF,0x7C,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0x1E,0x87,0xDF,0x7C,0xDC,0x3C,
-	0xDF,0x7C,0xDF,0x7C,0xDC,0x3B,0x9D,0x5A,0x59,0x2A,0x59,0x2A,0x3B,0x22,0xDB,0x32,0x59,0x2A,0xB8,0x29,0x59,0x2A,0xB8,0x29,0xB8,0x29,0x59,0x2A,0x55,0x29,0xD5,0x09,0x55,0x29,0x55,0x29,0xB8,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0x2F,0x19,0xEE,0x18,0xEE,0x18,0xCF,0x00,0x32,0x21,0x32,0x21,0x55,0x29,0x55,0x29,0x55,0x29,0x30,0x20,
-	0xCF,0x20,0xAD,0x20,0x2C,0x18,0x2C,0x18,0x4A,0x18,0x29,0x20,0x27,0x18,0x28,0x10,0x26,0x10,0x25,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x23,0x10,0x23,0x10,0x24,0x10,0x25,0x18,0x26,0x18,0x27,0x18,0x68,0x20,0x69,0x28,0x69,0x20,
-	0x69,0x20,0x68,0x20,0x68,0x18,0x67,0x18,0x66,0x18,0x26,0x10,0x67,0x18,0x69,0x20,0x69,0x20,0x69,0x20,0x68,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x68,0x18,0x68,0x20,0x68,0x18,0x28,0x20,0x68,0x18,0x68,0x20,0x68,0x20,0x68,0x18,0x67,0x20,0x67,0x20,0x69,0x20,0x69,0x28,0x27,0x20,0x68,0x20,0x67,0x20,0x27,0x20,0x26,0x20,0x25,0x18,
-	0x24,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x18,0x21,0x10,0x21,0x08,0x21,0x10,
-	0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x22,0x20,0x21,0x18,0x21,0x18,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x20,0x22,0x20,0x21,0x18,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x08,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x32,0x21,0x55,0x29,0xB8,0x29,0x59,0x2A,0xDB,0x32,0x3E,0x6B,0xDF,0x7C,0xDF,0x7C,0xDF,0xD6,
-	0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0x1E,0x87,0xDF,0x7C,0x3E,0x6B,0xDF,0x7C,0xDC,0x3C,0x3E,0x6B,0xDB,0x32,0x59,0x2A,0xFC,0x41,0xFC,0x41,0xDB,0x32,0xFC,0x41,0xB8,0x29,0xB8,0x29,0xB8,0x29,0x37,0x0A,0x55,0x29,0x55,0x29,0x55,0x29,
-	0x32,0x21,0x32,0x21,0xB8,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0x2F,0x19,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x32,0x21,0x34,0x30,0x32,0x21,0xCF,0x20,0x2C,0x18,0x2C,0x18,0xAB,0x18,0x4A,0x18,0x28,0x10,0x28,0x10,0x27,0x18,0x26,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x10,0x21,0x10,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x23,0x08,0x23,0x10,0x24,0x10,0x24,0x10,0x25,0x18,0x26,0x18,0x27,0x18,0x28,0x20,0x69,0x20,0x69,0x20,0x69,0x20,0x68,0x18,0x27,0x18,0x67,0x10,0x66,0x18,0x27,0x18,0x69,0x20,0x69,0x20,0x69,0x20,0x68,0x18,0x67,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,
-	0x69,0x20,0x68,0x20,0x69,0x20,0x68,0x20,0x68,0x18,0x28,0x20,0x68,0x20,0x28,0x20,0x68,0x20,0x69,0x20,0x67,0x20,0x26,0x20,0x26,0x18,0x25,0x18,0x25,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x18,
-	0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x18,0x22,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x08,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xEA,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xAB,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xED,0x18,
-	0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0xFC,0x41,0x9D,0x5A,0x3E,0x6B,0xDF,0x7C,0xDF,0x7C,0x1E,0x87,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0x1E,0x87,0xDF,0x7C,0xDF,0x7C,
-	0xDF,0x7C,0xDF,0x7C,0xDC,0x3B,0xDB,0x32,0xFC,0x41,0x3B,0x22,0x59,0x2A,0x3B,0x22,0xB8,0x29,0xB8,0x29,0xB8,0x29,0x55,0x29,0x55,0x29,0x55,0x29,0x32,0x21,0x92,0x09,0x32,0x21,0x32,0x21,0x32,0x21,0x32,0x21,0x32,0x21,0x2F,0x19,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xF1,0x20,0x32,0x21,0xF3,0x38,0xF1,0x20,
-	0xAD,0x20,0x2C,0x18,0xAB,0x10,0x4A,0x18,0x28,0x10,0x28,0x10,0x26,0x10,0x25,0x18,0x25,0x18,0x24,0x18,0x23,0x10,0x23,0x08,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x10,0x23,0x08,0x24,0x10,0x25,0x10,0x25,0x10,0x26,0x18,0x27,0x18,0x27,0x18,
-	0x69,0x20,0x69,0x20,0x29,0x20,0x68,0x18,0x27,0x18,0x27,0x18,0x68,0x18,0x4C,0x28,0xAB,0x20,0x29,0x20,0x68,0x18,0x27,0x18,0x68,0x18,0x68,0x18,0x27,0x18,0x4C,0x28,0x69,0x20,0x68,0x18,0x69,0x20,0x28,0x20,0x69,0x20,0x68,0x20,0x68,0x18,0x68,0x20,0x67,0x20,0x27,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x18,0x24,0x18,0x24,0x10,
-	0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,
-	0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x20,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x20,0x22,0x20,0x21,0x18,
-	0x21,0x10,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xEA,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x32,0x21,0x55,0x29,0xB8,0x29,0xB8,0x29,0xDB,0x32,0x3E,0x6B,0xDF,0x7C,0xDF,0x7C,0x5E,0xC5,0xDF,0xD6,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0x1E,0x87,0x5E,0xC5,0x1E,0x87,0xDF,0x7C,0x3E,0x6B,0xDB,0x32,0xFC,0x41,0x3B,0x22,0xFC,0x41,0x3B,0x22,0x9A,0x51,0xB8,0x29,0xB8,0x29,0x55,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0x32,0x21,0x2F,0x19,
-	0xF1,0x20,0x32,0x21,0xF1,0x20,0x2F,0x19,0x2F,0x19,0x2F,0x19,0xEE,0x18,0xED,0x18,0xED,0x18,0xCC,0x08,0xED,0x18,0xAB,0x10,0xEE,0x18,0xCF,0x20,0xF1,0x20,0xCF,0x20,0x2C,0x18,0xAB,0x10,0x4A,0x18,0x28,0x10,0x28,0x10,0x28,0x10,0x26,0x08,0x25,0x08,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x10,0x25,0x10,0x26,0x18,0x27,0x18,0x27,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x27,0x18,0x68,0x18,0x29,0x20,0x4B,0x28,0x4A,0x18,0x29,0x20,0x27,0x18,0x68,0x18,0x68,0x18,0x28,0x20,0x68,0x18,0x29,0x20,
-	0x68,0x18,0x29,0x20,0x68,0x18,0x68,0x18,0x28,0x20,0x68,0x18,0x27,0x18,0x27,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x20,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x18,0x22,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xAA,0x10,0xAB,0x10,0xAB,0x10,0xEC,0x10,0xED,0x18,0xEC,0x10,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,
-	0xEE,0x18,0x2F,0x19,0x2F,0x19,0x32,0x21,0x32,0x21,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0xFC,0x41,0x3E,0x6B,0xDF,0x7C,0xDF,0x7C,0x5E,0xC5,0x5E,0xC5,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,
-	0xDF,0x7C,0xDF,0x7C,0x9D,0x5A,0xDB,0x32,0xFC,0x41,0x3B,0x22,0xFC,0x41,0xB8,0x29,0xB8,0x29,0xB8,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0x55,0x29,0x32,0x21,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0xEE,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xAB,0x18,0xAB,0x18,0x2C,0x18,0xAD,0x20,0xCF,0x20,0x2F,0x28,
-	0x4C,0x28,0x4A,0x00,0xA9,0x10,0x28,0x10,0x26,0x08,0x26,0x08,0x25,0x10,0x24,0x08,0x24,0x00,0x23,0x08,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x10,0x25,0x10,0x26,0x10,0x27,0x18,
-	0x27,0x18,0x29,0x20,0x68,0x18,0x27,0x18,0x68,0x18,0x68,0x18,0x69,0x20,0x4A,0x18,0x68,0x18,0x68,0x18,0x27,0x18,0x68,0x18,0x28,0x10,0x68,0x18,0x68,0x18,0x68,0x18,0x27,0x18,0x68,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x26,0x18,0x26,0x18,0x26,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,
-	0x23,0x10,0x23,0x08,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x22,0x20,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x18,0x22,0x20,
-	0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xEA,0x10,0xEB,0x18,0xAB,0x10,0xEC,0x10,0xEE,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0x59,0x2A,0x9D,0x5A,0x3E,0x6B,0xDF,0x7C,0xDF,0x7C,0x5E,0xC5,0xDF,0xD6,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0x1E,0x87,0xDF,0xD6,0x1E,0x87,0x1E,0x87,0x3E,0x6B,0xDB,0x32,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xB8,0x29,0xB8,0x29,0xB8,0x29,0x55,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0x32,0x21,0xF1,0x20,0x2F,0x19,0x2F,0x19,
-	0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xED,0x18,0xED,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x10,0xEB,0x18,0xAA,0x18,0x4A,0x18,0xAB,0x18,0xAD,0x20,0xAD,0x20,0xAB,0x18,0x4A,0x18,0x28,0x10,0x28,0x10,0x26,0x10,0x25,0x10,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x25,0x10,0x26,0x10,0x67,0x10,0x27,0x18,0x28,0x10,0x27,0x18,0x28,0x10,0x68,0x18,0x4A,0x18,0x68,0x18,0x68,0x18,0x28,0x10,0x28,0x10,0x67,0x10,0x27,0x18,0x27,0x18,0x28,0x10,0x28,0x10,0x28,0x10,
-	0x28,0x10,0x27,0x18,0x28,0x10,0x27,0x18,0x26,0x10,0x26,0x10,0x26,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x18,0x22,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAB,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,
-	0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0xF1,0x20,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0xFC,0x41,0x3E,0x6B,0xDF,0x7C,0x3E,0x6B,0xBF,0x93,0x1E,0x87,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0xDF,0x7C,
-	0x3E,0x6B,0x9D,0x5A,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xB8,0x29,0xB8,0x29,0xB8,0x29,0x55,0x29,0x55,0x29,0x55,0x29,0x32,0x21,0xF1,0x20,0x2F,0x19,0x2F,0x19,0xEE,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xAB,0x18,0xAA,0x10,0xAB,0x10,0xAB,0x18,0xAB,0x18,0xAA,0x18,0xAA,0x10,0x4A,0x18,0xA9,0x10,0xA9,0x18,0xAA,0x18,0x4C,0x28,
-	0xAB,0x18,0x4A,0x18,0x28,0x10,0x26,0x10,0x25,0x10,0x24,0x08,0x25,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x25,0x10,0x26,0x10,
-	0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x68,0x18,0x28,0x10,0x28,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x28,0x10,0x26,0x10,0x28,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x08,
-	0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x10,0x21,0x08,0x21,0x08,0x22,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x18,0x20,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x20,
-	0x22,0x20,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0xF1,0x20,0x32,0x21,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0x9D,0x5A,0x3E,0x6B,0x3E,0x6B,0xBF,0x93,0xDF,0x7C,0xDF,0xD6,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0xDF,0x7C,0x9D,0x5A,0xDB,0x32,0x9D,0x5A,0x3B,0x22,0xFC,0x41,0xB8,0x29,0xB8,0x29,0x55,0x29,0x55,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0x2F,0x19,0x2F,0x19,0x2F,0x19,0xEE,0x18,
-	0xED,0x18,0xED,0x18,0xAB,0x10,0xAB,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x18,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0x68,0x18,0x4A,0x18,0x4A,0x18,0x68,0x18,0x26,0x10,0x26,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x10,0x24,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x25,0x10,0x26,0x10,0x26,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x26,0x10,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x26,0x10,0x26,0x08,0x26,0x10,0x26,0x10,0x26,0x10,
-	0x26,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x08,0x24,0x10,0x23,0x08,0x23,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x20,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x55,0x29,0x32,0x21,0xEE,0x18,0xEE,0x18,0xEE,0x18,
-	0x2F,0x19,0x2F,0x19,0xF1,0x20,0xF1,0x20,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0xFC,0x41,0x9D,0x5A,0x3E,0x6B,0x3E,0x6B,0xDF,0x7C,0xBF,0x93,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0xDF,0x7C,0x3E,0x6B,
-	0x3E,0x6B,0xFC,0x41,0xFC,0x41,0xFC,0x41,0x3B,0x22,0x37,0x41,0x55,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0x32,0x21,0xF1,0x20,0xF1,0x20,0x2F,0x19,0xED,0x18,0xCF,0x20,0xED,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x10,0xAA,0x18,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0x28,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x26,0x10,0x28,0x10,
-	0x28,0x10,0x67,0x10,0x26,0x08,0x25,0x10,0x25,0x08,0x24,0x08,0x24,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,
-	0x26,0x08,0x26,0x08,0x28,0x10,0x28,0x10,0x28,0x10,0x26,0x08,0x25,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x10,0x25,0x08,0x25,0x10,0x25,0x08,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x08,0x23,0x10,0x23,0x08,0x24,0x10,0x23,0x10,0x22,0x08,
-	0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x20,0x10,0x20,0x08,0x21,0x10,
-	0x21,0x18,0x22,0x20,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAB,0x10,0xEC,0x10,0xED,0x18,0xEC,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x32,0x21,0x2F,0x19,0x2F,0x19,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x32,0x21,0x2F,0x19,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0xFC,0x41,0x9D,0x5A,0x3E,0x6B,0x3E,0x6B,0xBF,0x93,0xDF,0x7C,0xDF,0xD6,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0xDF,0x7C,0x3E,0x6B,0x3E,0x6B,0x9D,0x5A,0x9D,0x5A,0x9D,0x5A,0xFC,0x41,0xFC,0x41,0xB8,0x29,0x37,0x41,0x55,0x29,0x55,0x29,0x32,0x21,0x32,0x21,0xF1,0x20,0x2F,0x19,0xCF,0x20,0xEE,0x18,0xED,0x18,
-	0xED,0x18,0xAB,0x18,0xAB,0x18,0xAA,0x10,0xAA,0x10,0xAA,0x10,0x68,0x18,0xA9,0x10,0x68,0x18,0xA9,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x26,0x08,0x25,0x10,0x26,0x08,0x67,0x10,0x26,0x10,0x26,0x10,0x25,0x10,0x25,0x08,0x24,0x10,0x24,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x21,0x00,0x22,0x00,0x22,0x08,0x23,0x08,0x22,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x24,0x08,0x25,0x08,0x26,0x08,0x28,0x10,0x4A,0x18,0x26,0x08,0x25,0x08,0x25,0x08,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x25,0x08,
-	0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x10,0x21,0x10,0x21,0x10,0x21,0x18,
-	0x21,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x20,0x10,0x20,0x10,0x21,0x18,0x21,0x20,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0xEE,0x18,0xEE,0x18,0x2F,0x19,0xEE,0x18,0x2F,0x19,
-	0x2F,0x19,0xF1,0x20,0x2F,0x19,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0x9A,0x51,0x9D,0x5A,0x3E,0x6B,0x3E,0x6B,0x3E,0x6B,0x3E,0x6B,0x5E,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0x5E,0xC5,0x5E,0xC5,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0xDF,0x7C,0x3E,0x6B,0x9D,0x5A,
-	0x9D,0x5A,0x3E,0x6B,0x9D,0x5A,0xFC,0x41,0xB8,0x29,0xB8,0x29,0x37,0x41,0x55,0x29,0x55,0x29,0xF3,0x38,0x32,0x21,0x32,0x21,0xF1,0x20,0x2F,0x19,0xCF,0x20,0xED,0x18,0xAB,0x18,0xAA,0x18,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x26,0x08,0x67,0x10,0x67,0x10,0x26,0x08,0x25,0x08,0x25,0x08,
-	0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x10,0x25,0x10,0x24,0x08,0x24,0x00,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x24,0x08,
-	0x24,0x08,0x26,0x08,0x48,0x00,0x28,0x10,0x26,0x08,0x25,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x20,0x10,0x20,0x08,
-	0x20,0x10,0x21,0x18,0x22,0x20,0x21,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0xEE,0x18,0x2F,0x19,0xEE,0x18,0x2F,0x19,0xF1,0x20,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0xB8,0x29,0xFC,0x41,0x9D,0x5A,0x3E,0x6B,0x9D,0x5A,0x3E,0x6B,0x3E,0x6B,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0xDF,0x7C,0x5E,0xC5,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0xBF,0x93,0x3E,0x6B,0x9D,0x5A,0x9D,0x5A,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xB8,0x29,0x37,0x41,0x55,0x29,0xF3,0x38,0x32,0x21,0x32,0x21,0xF1,0x20,0xF1,0x20,0xF1,0x20,0x2F,0x19,0xEE,0x18,
-	0xAB,0x18,0xA9,0x18,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x26,0x08,0x26,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x25,0x08,0x25,0x08,0x25,0x10,0x25,0x08,0x25,0x08,0x25,0x08,0x24,0x10,0x25,0x08,0x25,0x10,0x25,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x00,
-	0x20,0x08,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x23,0x00,0x24,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x25,0x00,0x24,0x08,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x23,0x08,0x24,0x00,0x24,0x08,
-	0x24,0x00,0x24,0x08,0x24,0x00,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,
-	0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x20,0x08,0x21,0x08,0x21,0x10,0x20,0x08,0x21,0x10,0x21,0x18,0x21,0x18,
-	0x21,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x21,0x18,0x21,0x20,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,
-	0x2F,0x19,0xF1,0x20,0x32,0x21,0x55,0x29,0x55,0x29,0x37,0x41,0x59,0x2A,0x9D,0x5A,0x9D,0x5A,0x3E,0x6B,0x9D,0x5A,0x3E,0x6B,0xDF,0x7C,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0xBF,0x93,0xBF,0x93,0xBF,0x93,0x5E,0xC5,0x5E,0xC5,0xBF,0x93,0x3E,0x6B,0x9D,0x5A,
-	0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0x9A,0x51,0xFC,0x41,0xB8,0x29,0xF3,0x38,0x55,0x29,0xF3,0x38,0x32,0x21,0xF3,0x38,0x32,0x21,0xF1,0x20,0xCF,0x20,0xAD,0x20,0x4A,0x18,0xA9,0x10,0x68,0x18,0x67,0x10,0x67,0x10,0x26,0x10,0x66,0x10,0x65,0x08,0x65,0x08,0x25,0x08,0x65,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x25,0x08,
-	0x25,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x25,0x10,0x24,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x24,0x08,
-	0x25,0x00,0x25,0x08,0x26,0x08,0x26,0x08,0x25,0x08,0x25,0x08,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x08,0x24,0x00,0x23,0x08,0x23,0x00,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x22,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x18,0x22,0x20,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x20,0x10,
-	0x20,0x08,0x21,0x10,0x21,0x18,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEC,0x10,0xED,0x18,0xEC,0x10,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x32,0x21,0x32,0x21,0x55,0x29,0xB8,0x29,0x9A,0x51,0xFC,0x41,0x9D,0x5A,0x3E,0x6B,0x9D,0x5A,0x9D,0x5A,0xBF,0x93,0x5E,0xC5,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0xBF,0x93,0x3E,0x6B,0xBF,0x93,0xDF,0x7C,0xBF,0x93,0xDF,0x7C,0xBF,0x93,0x3E,0x6B,0x9D,0x5A,0x9D,0x5A,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0x37,0x41,0x37,0x41,0x55,0x29,0xF3,0x38,0x32,0x21,0xF3,0x38,0x32,0x21,0xF1,0x20,0xCF,0x20,0xAD,0x20,0xAB,0x20,
-	0xAA,0x18,0xA9,0x18,0x68,0x18,0x67,0x10,0x67,0x10,0x66,0x10,0x26,0x10,0x65,0x08,0x25,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x00,0x23,0x08,0x24,0x08,0x24,0x08,0x26,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x08,0x24,0x00,0x24,0x00,0x25,0x08,0x25,0x00,0x25,0x08,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x21,0x10,0x21,0x20,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,0x2F,0x19,
-	0x2F,0x19,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0x9D,0x5A,0x9D,0x5A,0x9D,0x5A,0x9D,0x5A,0x9D,0x5A,0x3E,0x6B,0xDF,0x7C,0x5E,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xFF,0xFF,0xDF,0xD6,0x5E,0xC5,0xBF,0x93,0x3E,0x6B,0x3E,0x6B,0xBF,0x93,0x3E,0x6B,0x3E,0x6B,0x9D,0x5A,0x9D,0x5A,0x3E,0x6B,0x9D,0x5A,
-	0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0x37,0x41,0x37,0x41,0x37,0x41,0x55,0x29,0xF3,0x38,0x32,0x21,0xF3,0x38,0xF1,0x20,0xAF,0x38,0xCF,0x20,0xAD,0x20,0xAB,0x20,0xA9,0x18,0x4A,0x18,0xA9,0x18,0x67,0x10,0x67,0x10,0x26,0x10,0x65,0x10,0x25,0x08,0x24,0x08,0x64,0x08,0x24,0x08,0x24,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,
-	0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x08,0x23,0x08,0x24,0x00,0x24,0x00,0x23,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x10,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x10,0x21,0x08,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,
-	0x20,0x08,0x20,0x08,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x10,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEC,0x10,0xED,0x18,0xEC,0x10,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0x32,0x21,0x32,0x21,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x2F,0x19,0xEE,0x18,0xF1,0x20,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0xFC,0x41,0x9D,0x5A,0x9D,0x5A,0x9D,0x5A,0x3E,0x6B,0xBF,0x93,0xBF,0x93,0x5E,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0xBF,0x93,0x3E,0x6B,0x7D,0x82,0x3E,0x6B,0x3E,0x6B,0x7D,0x82,0x9D,0x5A,0xFC,0x41,0x9D,0x5A,0x9D,0x5A,0x3E,0x6B,0x7D,0x82,0xFC,0x41,0xFC,0x41,0xFC,0x41,0x9A,0x51,0xB8,0x29,0x37,0x41,0xF3,0x38,0x37,0x41,0x55,0x29,0xF3,0x38,0xCF,0x20,0xCF,0x20,0xAD,0x20,0xAB,0x20,0xAB,0x18,
-	0xA9,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x67,0x10,0x26,0x10,0x25,0x08,0x25,0x08,0x64,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x26,0x08,0x25,0x00,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x22,0x10,0x22,0x10,0x21,0x10,
-	0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x20,0x10,
-	0x21,0x10,0x20,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x18,0x20,0x10,0x21,0x10,0x20,0x08,0x21,0x10,0x21,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x21,0x18,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0x32,0x21,0x32,0x21,0xEE,0x18,0x2F,0x19,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,
-	0x2F,0x19,0x32,0x21,0x55,0x29,0xB8,0x29,0xB8,0x29,0xFC,0x41,0x9D,0x5A,0x3E,0x6B,0x3E,0x6B,0xBF,0x93,0x3E,0x6B,0x3E,0x6B,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0x5E,0xC5,0x3E,0x6B,0x9D,0x5A,0x9D,0x5A,0x7D,0x82,0x9D,0x5A,0x9A,0x51,0xFC,0x41,0xFC,0x41,0xFC,0x41,0x9D,0x5A,0x9D,0x5A,
-	0x9D,0x5A,0x9D,0x5A,0xDC,0x69,0x9A,0x51,0x37,0x41,0x37,0x41,0x37,0x41,0x37,0x41,0xF3,0x38,0xF3,0x38,0xF1,0x20,0xAF,0x38,0xAD,0x20,0xAD,0x20,0xAB,0x20,0xAA,0x18,0x4A,0x18,0x68,0x18,0x68,0x18,0x67,0x10,0x67,0x10,0x66,0x10,0x25,0x10,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x08,
-	0x23,0x08,0x23,0x00,0x22,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x08,
-	0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x08,0x21,0x10,0x20,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x18,0x21,0x10,0x20,0x10,0x21,0x08,0x20,0x10,0x21,0x10,
-	0x21,0x10,0x20,0x08,0x20,0x08,0x21,0x10,0x21,0x18,0x21,0x18,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEC,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xF1,0x20,0x32,0x21,0x55,0x29,0xB8,0x29,0x9A,0x51,0xDB,0x32,0x9D,0x5A,0x3E,0x6B,0xBF,0x93,0x3E,0x6B,0x9D,0x5A,0xBF,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0x5E,0xC5,0xBF,0x93,0xDC,0x69,0x9D,0x5A,0x9A,0x51,0x9D,0x5A,0xDC,0x69,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0x9D,0x5A,0x7D,0x82,0xDC,0x69,0x9A,0x51,0x37,0x41,0x37,0x41,0xF3,0x38,0x37,0x41,0x37,0x41,0xF3,0x38,0xCF,0x20,0xCF,0x20,0xCF,0x20,0xAD,0x20,0xAB,0x18,0x4B,0x28,
-	0xAA,0x18,0xAA,0x18,0x67,0x10,0x27,0x18,0x66,0x10,0x26,0x10,0x65,0x08,0x25,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x23,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x20,0x08,
-	0x21,0x10,0x20,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x20,0x10,0x20,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x20,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x21,0x18,0x21,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x18,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,
-	0x2F,0x19,0x32,0x21,0x55,0x29,0xB8,0x29,0xFC,0x41,0x9D,0x5A,0x3E,0x6B,0xBF,0x93,0x3E,0x6B,0x9D,0x5A,0x9D,0x5A,0x5E,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5E,0xC5,0xDF,0xD6,0x5E,0xC5,0xBF,0x93,0xBF,0x93,0x9D,0x5A,0x9D,0x5A,0xDC,0x69,0x9D,0x5A,0x9A,0x51,0x9A,0x51,0x9A,0x51,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,
-	0xFC,0x41,0xDC,0x69,0xDC,0x69,0x9A,0x51,0x37,0x41,0x37,0x41,0x37,0x41,0x37,0x41,0xF3,0x38,0xF3,0x38,0xCF,0x20,0xAF,0x38,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xF3,0x38,0xAB,0x20,0x28,0x10,0x68,0x18,0x67,0x18,0x66,0x10,0x66,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x00,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x10,
-	0x23,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x10,0x20,0x08,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x21,0x08,0x20,0x10,
-	0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEC,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0x2F,0x19,0x32,0x21,0x55,0x29,0xB8,0x29,0x9A,0x51,0x3E,0x6B,0xBF,0x93,0x3E,0x6B,0x3E,0x6B,0x9D,0x5A,0x9D,0x5A,0x5E,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,
-	0xDF,0xD6,0x5E,0xC5,0x5E,0xC5,0xBF,0x93,0x3E,0x6B,0x9A,0x51,0xDC,0x69,0x7D,0x82,0xDC,0x69,0xDC,0x69,0x9A,0x51,0xFC,0x41,0x9A,0x51,0xFC,0x41,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x59,0x9A,0x51,0x37,0x41,0x37,0x41,0x37,0x41,0xF3,0x38,0xF3,0x38,0xAF,0x38,0xCF,0x20,0xAD,0x20,0xAD,0x20,0x30,0x38,0xCF,0x20,
-	0x68,0x18,0x68,0x18,0x67,0x18,0x67,0x10,0x26,0x10,0x66,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x10,0x23,0x08,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x10,
-	0x21,0x08,0x20,0x10,0x21,0x10,0x20,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x10,0x21,0x08,0x20,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x20,0x08,0x21,0x08,0x20,0x10,0x21,0x10,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x21,0x18,0x21,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xEC,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,
-	0x2F,0x19,0x32,0x21,0x55,0x29,0xB8,0x29,0xFC,0x41,0x3E,0x6B,0x3E,0x6B,0x3E,0x6B,0x9D,0x5A,0xFC,0x41,0x3E,0x6B,0xDF,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0x5E,0xC5,0xBF,0x93,0x7D,0x82,0x9D,0x5A,0x9D,0x5A,0x7D,0x82,0x9D,0x5A,0x9A,0x51,0x9A,0x51,0x9A,0x51,0xFC,0x41,0x9A,0x51,0x9A,0x51,0x9A,0x51,
-	0x9A,0x51,0x39,0x58,0x37,0x41,0x9A,0x51,0x9A,0x51,0x39,0x59,0x39,0x59,0x37,0x41,0xF3,0x38,0xF1,0x20,0xAF,0x38,0xAF,0x38,0xAD,0x20,0xAD,0x20,0x4D,0x30,0xAB,0x20,0x68,0x18,0x27,0x18,0x67,0x18,0x26,0x18,0x26,0x10,0x25,0x10,0x25,0x08,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,
-	0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x10,
-	0x22,0x10,0x23,0x08,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x10,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x08,0x21,0x10,0x20,0x10,0x21,0x08,0x20,0x08,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x08,0x20,0x08,
-	0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x21,0x18,0x20,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xEA,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x32,0x21,0x55,0x29,0xB8,0x29,0x9D,0x5A,0x3E,0x6B,0x9D,0x5A,0xFC,0x41,0x9D,0x5A,0x9D,0x5A,0xBF,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,
-	0x5E,0xC5,0x5E,0xC5,0x5E,0xC5,0xBF,0x93,0x9D,0x5A,0x9D,0x5A,0x7D,0x82,0xDC,0x69,0xDC,0x69,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0xFC,0x41,0x9A,0x51,0x37,0x41,0x37,0x41,0x39,0x59,0x37,0x41,0x37,0x41,0x37,0x41,0x39,0x59,0xDC,0x69,0xD5,0x50,0xF3,0x38,0xF3,0x38,0x30,0x38,0xAF,0x38,0xAF,0x38,0x4C,0x28,0x69,0x20,0x29,0x20,
-	0x68,0x18,0x27,0x18,0x26,0x18,0x66,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x22,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x10,0x21,0x08,0x21,0x10,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,
-	0x21,0x08,0x21,0x08,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x10,0x20,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xEC,0x10,0xAB,0x18,0xEC,0x10,0xED,0x18,0xEC,0x10,0xED,0x18,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,
-	0x2F,0x19,0xF1,0x20,0x55,0x29,0x9A,0x51,0x9D,0x5A,0x9D,0x5A,0x9D,0x5A,0xFC,0x41,0x9D,0x5A,0x9D,0x5A,0xBF,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xDF,0xD6,0x5E,0xC5,0x5E,0xC5,0xBF,0x93,0x7D,0x82,0xDC,0x69,0xDC,0x69,0x7D,0x82,0x3E,0x6B,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,
-	0x39,0x58,0x37,0x41,0x39,0x59,0x37,0x41,0xD5,0x50,0x39,0x59,0x39,0x59,0x39,0x59,0xD5,0x50,0xF3,0x38,0xAF,0x38,0xAF,0x38,0xAD,0x20,0x4B,0x28,0x69,0x20,0x69,0x20,0x68,0x18,0x27,0x18,0x67,0x18,0x26,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x08,0x22,0x00,0x21,0x08,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,
-	0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x10,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x10,0x21,0x10,0x20,0x08,0x20,0x08,
-	0x21,0x08,0x20,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x21,0x10,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xEC,0x10,0xAB,0x10,0xEC,0x10,0xAB,0x18,0xEC,0x10,0xAB,0x18,0xEC,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x32,0x21,0xB8,0x29,0x59,0x2A,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0xFC,0x41,0x9D,0x5A,0x5E,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5E,0xC5,0x5E,0xC5,
-	0x5E,0xC5,0x5E,0xC5,0xBF,0x93,0x7D,0x82,0x9D,0x5A,0x7D,0x82,0x7D,0x82,0xDC,0x69,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x58,0x37,0x41,0x37,0x41,0xD5,0x50,0x37,0x41,0x39,0x59,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xAF,0x38,0xCF,0x20,0x4C,0x28,0x4B,0x28,0x69,0x20,0x29,0x20,
-	0x27,0x18,0x67,0x18,0x27,0x18,0x26,0x10,0x25,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x21,0x08,0x22,0x00,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,
-	0x21,0x08,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x10,0x21,0x08,0x20,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x10,0x21,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x21,0x18,0x20,0x10,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xEC,0x10,0xEC,0x10,0xAB,0x18,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,
-	0x2F,0x19,0x32,0x21,0x37,0x41,0xB8,0x29,0xB8,0x29,0x9A,0x51,0x59,0x2A,0xFC,0x41,0xFC,0x41,0x3E,0x6B,0x5E,0xC5,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0x5E,0xC5,0x5E,0xC5,0x5E,0xC5,0xFC,0xCB,0x7D,0x82,0x9D,0x5A,0x9D,0x5A,0x7D,0x82,0x7D,0x82,0xDC,0x69,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x59,0x39,0x59,
-	0x39,0x59,0x9A,0x51,0x37,0x41,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xF3,0x38,0xD5,0x50,0xD5,0x50,0xD5,0x50,0x30,0x38,0x4D,0x30,0xAB,0x28,0x4B,0x28,0x69,0x20,0x68,0x20,0x28,0x20,0x27,0x18,0x26,0x18,0x26,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x08,0x22,0x00,0x21,0x08,
-	0x22,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x10,
-	0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x21,0x10,0x21,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xEA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xEC,0x10,0xAB,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0x32,0x21,0x55,0x29,0x55,0x29,0x37,0x41,0x37,0x41,0xB8,0x29,0xB8,0x29,0xB8,0x29,0xFC,0x41,0x3E,0x6B,0x5E,0xC5,0xFF,0xFF,0xFF,0xFF,0x5E,0xC5,0x5E,0xC5,0x5E,0xC5,
-	0x5E,0xC5,0xBF,0x93,0xBF,0x93,0xDC,0x69,0x7D,0x82,0x7D,0x82,0x7D,0x82,0xDC,0x69,0x39,0x59,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x59,0x9A,0x51,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x37,0x41,0xD5,0x50,0x37,0x41,0xD5,0x50,0x30,0x38,0xAF,0x38,0xF3,0x38,0x30,0x38,0xAF,0x38,0xAB,0x28,0x69,0x28,0x29,0x20,0x28,0x20,
-	0x27,0x18,0x27,0x18,0x26,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x08,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x10,0x23,0x08,0x23,0x08,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x18,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,
-	0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xAA,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xEA,0x10,0xAB,0x10,0xEB,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xF1,0x20,
-	0x32,0x21,0xF1,0x20,0x32,0x21,0x55,0x29,0x55,0x29,0xB8,0x29,0x37,0x41,0x37,0x41,0xB8,0x29,0xBF,0x93,0xDF,0xD6,0xDF,0xD6,0xDF,0xD6,0xBF,0x93,0x5E,0xC5,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0x7D,0x82,0x7D,0x82,0x7D,0x82,0x7D,0x82,0x7D,0x82,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x59,0x39,0x59,0x9A,0x51,0xDC,0x69,0x39,0x59,0x39,0x59,
-	0x39,0x59,0x9A,0x51,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0x92,0x50,0xF3,0x38,0xAF,0x38,0x4D,0x30,0xAF,0x38,0xAF,0x38,0x4D,0x30,0x69,0x20,0x69,0x20,0x28,0x20,0x27,0x18,0x27,0x18,0x26,0x18,0x25,0x10,0x25,0x10,0x24,0x08,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x23,0x08,0x22,0x08,0x24,0x08,0x23,0x10,0x23,0x08,
-	0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x23,0x18,0x22,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x10,0x22,0x18,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,
-	0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x21,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xEC,0x10,0xAB,0x18,0xED,0x18,0x2F,0x19,0x32,0x21,0x2F,0x19,0xEE,0x18,0xF1,0x20,0x55,0x29,0x55,0x29,0x55,0x29,0x55,0x29,0x55,0x29,0x9A,0x51,0xBF,0x93,0x5E,0xC5,0xDF,0xD6,0x5E,0xC5,0xBF,0x93,0xBF,0x93,0xFC,0xCB,
-	0x5E,0xC5,0xBF,0x93,0x7D,0x82,0x7D,0x82,0xDC,0x69,0x7D,0x82,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x59,0xDC,0x69,0x9A,0x51,0xDC,0x69,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0xD5,0x50,0xF3,0x38,0xD5,0x50,0xF3,0x38,0xCF,0x48,0xAF,0x38,0x4D,0x30,0x4C,0x28,0xAF,0x38,0x4D,0x30,0xAB,0x28,0x69,0x20,0x28,0x20,
-	0x27,0x18,0x27,0x18,0x26,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x10,0x23,0x08,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x10,0x22,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x00,0x00,0x20,0x08,0x00,0x00,
-	0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xEB,0x18,0xEE,0x18,0x2F,0x19,0xEE,0x18,
-	0xED,0x18,0xEE,0x18,0x2F,0x19,0x32,0x21,0x32,0x21,0xF1,0x20,0xF1,0x20,0x32,0x21,0xB8,0x29,0xBF,0x93,0x5E,0xC5,0x5E,0xC5,0xBF,0x93,0x7D,0x82,0xBF,0x93,0xBF,0x93,0xFC,0xCB,0xBF,0x93,0x7D,0x82,0x7D,0x82,0x7D,0x82,0xDC,0x69,0x9A,0x51,0x39,0x59,0x9A,0x51,0x39,0x59,0x39,0x59,0xDC,0x69,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,
-	0x39,0x59,0x39,0x59,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xF3,0x38,0x92,0x50,0xF3,0x38,0x4D,0x30,0x4D,0x30,0xAB,0x28,0x4B,0x28,0xAA,0x28,0x4D,0x30,0x4B,0x28,0x28,0x20,0x27,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x22,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x10,
-	0x23,0x08,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEA,0x10,0xA9,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAA,0x10,0xED,0x18,0xEE,0x18,0xEE,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xF1,0x20,0x32,0x21,0xF1,0x20,0x2F,0x19,0x2F,0x19,0xF1,0x20,0x37,0x41,0xBF,0x93,0x5E,0xC5,0xBF,0x93,0xBF,0x93,0x9D,0x5A,0xBF,0x93,0xFC,0xCB,
-	0xBF,0x93,0x7D,0x82,0x7D,0x82,0xDC,0x69,0x7D,0x82,0xDC,0x69,0x9A,0x51,0x9A,0x51,0xDC,0x69,0xDC,0x69,0x39,0x59,0x39,0x59,0xDC,0x69,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0xD5,0x50,0xD5,0x50,0x92,0x50,0xD5,0x50,0x92,0x50,0xD5,0x50,0xAF,0x38,0xAB,0x28,0x4B,0x28,0xAA,0x28,0x69,0x28,0x4D,0x30,0x4B,0x28,0x29,0x28,
-	0x27,0x20,0x26,0x18,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x23,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x10,0x22,0x08,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x22,0x10,0x23,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x10,0x21,0x10,0x22,0x10,
-	0x21,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xEE,0x18,0xED,0x18,0xEB,0x18,0xAB,0x18,
-	0xAB,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0xCF,0x20,0xED,0x18,0xED,0x18,0xEE,0x18,0x9A,0x51,0xBF,0x93,0xBF,0x93,0xBF,0x93,0x9D,0x5A,0x9D,0x5A,0x7D,0x82,0xBF,0x93,0xBF,0x93,0x7D,0x82,0xDC,0x69,0x7D,0x82,0x7D,0x82,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x59,0x39,0x59,0x39,0x59,0xDC,0x69,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,
-	0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0x92,0x50,0xF3,0x38,0xCF,0x48,0x30,0x38,0x4D,0x30,0x4D,0x30,0xAB,0x30,0x4B,0x28,0x29,0x28,0x28,0x20,0x28,0x20,0x29,0x28,0x27,0x18,0x26,0x18,0x25,0x18,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,
-	0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x23,0x08,
-	0x22,0x08,0x23,0x10,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x10,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xA9,0x10,0xAB,0x10,0xED,0x18,0xED,0x18,0xAB,0x10,0xEB,0x18,0xAB,0x10,0xEB,0x18,0xEE,0x18,0xCF,0x20,0x2F,0x19,0xEE,0x18,0xED,0x18,0xAB,0x18,0xCF,0x20,0xFC,0x41,0x3E,0x6B,0xBF,0x93,0x3E,0x6B,0x9A,0x51,0x9A,0x51,0x3E,0x6B,0xBF,0x93,
-	0x7D,0x82,0x7D,0x82,0x9D,0x5A,0x7D,0x82,0xDC,0x69,0xDC,0x69,0x9A,0x51,0x39,0x59,0x9A,0x51,0x9A,0x51,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xF3,0x38,0x92,0x50,0x30,0x38,0x30,0x38,0xAF,0x38,0x4D,0x30,0xAB,0x30,0x4B,0x28,0x29,0x28,0x29,0x28,0x28,0x20,0x28,0x20,0x28,0x20,
-	0x28,0x20,0x26,0x20,0x25,0x18,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x10,0x23,0x08,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,
-	0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xED,0x18,0xED,0x18,0xAA,0x10,0xEB,0x18,0xAB,0x10,0xAB,0x18,
-	0xED,0x18,0xEE,0x18,0x2F,0x19,0xCF,0x20,0xEE,0x18,0xED,0x18,0xAB,0x18,0xF1,0x20,0xFC,0x41,0xBF,0x93,0xBF,0x93,0x9D,0x5A,0x37,0x41,0x9A,0x51,0x7D,0x82,0x7D,0x82,0x7D,0x82,0x9D,0x5A,0xDC,0x69,0x7D,0x82,0x7D,0x82,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x59,0x9A,0x51,0x9A,0x51,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x75,0x79,
-	0xD5,0x50,0xD5,0x50,0xD5,0x50,0x92,0x50,0xCF,0x48,0xCF,0x48,0xCF,0x48,0xAF,0x38,0x4D,0x30,0xAB,0x30,0x2B,0x30,0x29,0x28,0x29,0x28,0x28,0x20,0x28,0x20,0x26,0x20,0x26,0x18,0x26,0x18,0x25,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xEC,0x10,0xED,0x18,0xAA,0x10,0xAB,0x10,0xAB,0x10,0xEB,0x18,0xAB,0x18,0xED,0x18,0xEE,0x18,0xF1,0x20,0x2F,0x19,0xEE,0x18,0xED,0x18,0xAB,0x18,0x55,0x29,0x9D,0x5A,0xBF,0x93,0x3E,0x6B,0x9A,0x51,0x55,0x29,0x9A,0x51,0x9D,0x5A,0x9D,0x5A,
-	0x9D,0x5A,0xDC,0x69,0x7D,0x82,0x7D,0x82,0x7D,0x82,0xDC,0x69,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0xD5,0x50,0x39,0x59,0xD5,0x50,0xD5,0x50,0x92,0x50,0x92,0x50,0x30,0x38,0x30,0x38,0x2F,0x48,0xCF,0x48,0x4D,0x30,0x4D,0x30,0x4B,0x28,0x29,0x28,0x29,0x28,0x28,0x20,0x27,0x20,0x26,0x18,
-	0x25,0x18,0x25,0x18,0x25,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x23,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,
-	0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xEC,0x10,0xED,0x18,0xAA,0x18,0xAA,0x10,0xAB,0x18,0xEB,0x18,0xAB,0x18,0xAB,0x18,
-	0xED,0x18,0x2F,0x19,0xF1,0x20,0xCF,0x20,0xED,0x18,0xED,0x18,0xED,0x18,0x37,0x41,0x9D,0x5A,0xBF,0x93,0x3E,0x6B,0x37,0x41,0x55,0x29,0x9A,0x51,0xDC,0x69,0x9D,0x5A,0xDC,0x69,0xDC,0x69,0x9D,0x5A,0x7D,0x82,0x7D,0x82,0xDC,0x69,0x39,0x59,0x9A,0x51,0x39,0x59,0x39,0x59,0x9A,0x51,0x39,0x59,0x39,0x59,0x39,0x58,0xD5,0x50,0xD5,0x50,
-	0xD5,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0xCF,0x48,0x2F,0x48,0xAF,0x38,0x4D,0x30,0x4D,0x30,0x4D,0x30,0x29,0x28,0x29,0x28,0x28,0x28,0x28,0x28,0x27,0x20,0x26,0x20,0x25,0x18,0x24,0x18,0x24,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x10,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,
-	0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAB,0x10,0xAB,0x18,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xAA,0x18,0xAB,0x10,0xAB,0x18,0xEC,0x10,0xED,0x18,0xCF,0x20,0x2F,0x19,0xCF,0x20,0xED,0x18,0xAD,0x20,0xED,0x18,0xB8,0x29,0x9D,0x5A,0xBF,0x93,0x9D,0x5A,0x37,0x41,0x55,0x29,0x9A,0x51,0x9D,0x5A,0xDC,0x69,
-	0x9A,0x51,0xDC,0x69,0x7D,0x82,0x7D,0x82,0x7D,0x82,0xDC,0x69,0xDC,0x69,0x39,0x59,0x9A,0x51,0x9A,0x51,0x39,0x59,0x37,0x41,0x39,0x58,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x30,0x38,0xAF,0x38,0x2D,0x48,0x4D,0x30,0x2D,0x48,0x2B,0x30,0x2B,0x30,0x29,0x28,0x28,0x20,0x28,0x28,0x27,0x20,0x26,0x18,
-	0x25,0x18,0x24,0x18,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x23,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x23,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,
-	0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,
-	0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xEB,0x18,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xEB,0x18,0xAB,0x18,0xAB,0x18,
-	0xED,0x18,0x2F,0x19,0xF1,0x20,0xEE,0x18,0xED,0x18,0xED,0x18,0xCF,0x20,0xFC,0x41,0x3E,0x6B,0xBF,0x93,0x9D,0x5A,0x37,0x41,0x37,0x41,0x9A,0x51,0xDC,0x69,0x9D,0x5A,0x9A,0x51,0xDC,0x69,0x7D,0x82,0xDE,0xA9,0x7D,0x82,0xDC,0x69,0xDC,0x69,0x39,0x59,0x39,0x59,0x39,0x59,0x37,0x41,0x39,0x58,0xD5,0x50,0x39,0x58,0xD5,0x50,0xD5,0x50,
-	0xD5,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0xCF,0x48,0x2F,0x48,0xAF,0x38,0x2B,0x30,0x4D,0x30,0x2B,0x30,0x2B,0x30,0x29,0x28,0x28,0x28,0x27,0x20,0x26,0x20,0x26,0x18,0x25,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x23,0x18,0x22,0x10,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,
-	0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xAB,0x18,0xEC,0x10,0xAB,0x18,0xEE,0x18,0x2F,0x19,0xF1,0x20,0xCF,0x20,0xEE,0x18,0xEE,0x18,0xF1,0x20,0xFC,0x41,0xBF,0x93,0xBF,0x93,0x9D,0x5A,0x37,0x41,0x37,0x41,0x9A,0x51,0x9D,0x5A,0xDC,0x69,
-	0xDC,0x69,0x7D,0x82,0xBF,0x93,0x7D,0x82,0x7D,0x82,0xDC,0x69,0xDC,0x69,0xDC,0x69,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0x92,0x50,0x2F,0x48,0xCF,0x48,0x2F,0x48,0x2D,0x48,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x29,0x28,0x28,0x28,0x27,0x20,0x26,0x20,0x25,0x20,
-	0x25,0x18,0x24,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,
-	0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,
-	0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xEB,0x18,0xAB,0x18,0xED,0x18,
-	0xEE,0x18,0xF1,0x20,0xF1,0x20,0x2F,0x19,0xEE,0x18,0xCF,0x20,0x32,0x21,0x9D,0x5A,0xBF,0x93,0xBF,0x93,0x9D,0x5A,0x37,0x41,0xB8,0x29,0xDC,0x69,0xDC,0x69,0xDC,0x69,0xDC,0x69,0xDC,0x69,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDC,0x69,0xDC,0x69,0xDC,0x69,0x39,0x59,0x39,0x59,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,
-	0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x30,0x38,0x2D,0x48,0x4D,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x28,0x28,0x27,0x28,0x26,0x20,0x25,0x18,0x25,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x18,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,
-	0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,
-	0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x18,0xAA,0x10,0xAB,0x18,0xEC,0x10,0xED,0x18,0xCF,0x20,0x32,0x21,0x32,0x21,0xCF,0x20,0xCF,0x20,0xEE,0x18,0x55,0x29,0x9D,0x5A,0xBF,0x93,0xBF,0x93,0xDC,0x69,0x37,0x41,0x9A,0x51,0xFC,0x41,0xDC,0x69,0xFC,0x41,
-	0x9A,0x51,0xDC,0x69,0xBF,0x93,0xDE,0xA9,0x7D,0x82,0x7D,0x82,0xDC,0x69,0xDC,0x69,0x39,0x59,0x39,0x58,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x49,0x30,0x28,0x28,0x28,0x28,0x28,0x28,0x26,0x20,0x25,0x20,
-	0x25,0x18,0x24,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x08,0x22,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x21,0x10,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x10,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x08,0x21,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xEB,0x18,0xAB,0x18,0xED,0x18,
-	0x2F,0x19,0x32,0x21,0x32,0x21,0xF1,0x20,0xEE,0x18,0xCF,0x20,0x37,0x41,0x7D,0x82,0xBF,0x93,0xBF,0x93,0xFC,0x41,0x37,0x41,0x9A,0x51,0xDC,0x69,0xDC,0x69,0xDC,0x69,0xDC,0x69,0xDC,0x69,0xDE,0xA9,0xBF,0x93,0xDE,0xA9,0xDC,0x69,0xBE,0xA0,0xDC,0x69,0xDC,0x69,0xD5,0x50,0xD5,0x50,0xD5,0x50,0xD5,0x50,0x92,0x50,0x92,0x50,0x92,0x50,
-	0x92,0x50,0x92,0x50,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x4D,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x49,0x30,0x29,0x28,0x49,0x30,0x29,0x28,0x28,0x28,0x27,0x28,0x26,0x20,0x25,0x20,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x21,0x08,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x08,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x21,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x08,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x10,0xAB,0x18,0xED,0x18,0xEE,0x18,0xF1,0x20,0xF3,0x38,0xF1,0x20,0xF1,0x20,0xCF,0x20,0xEE,0x18,0x9A,0x51,0xBF,0x93,0xBF,0x93,0x7D,0x82,0xFC,0x41,0x37,0x41,0x9A,0x51,0x9D,0x5A,0xDC,0x69,0x9A,0x51,
-	0xDC,0x69,0x7D,0x82,0x7D,0x82,0xDE,0xA9,0xDE,0xA9,0x7D,0x82,0x7D,0x82,0xDC,0x69,0xDC,0x69,0xD5,0x50,0xD5,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x2F,0x48,0x92,0x50,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x49,0x30,0x49,0x30,0x28,0x28,0x28,0x28,0x28,0x28,0x26,0x28,
-	0x26,0x20,0x25,0x20,0x24,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x10,0x22,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x10,0xAB,0x18,0xAB,0x18,0xED,0x18,0xEE,0x18,
-	0xF1,0x20,0x32,0x21,0x32,0x21,0x2F,0x19,0xCF,0x20,0xCF,0x20,0xFC,0x41,0x7D,0x82,0xBF,0x93,0xBF,0x93,0x9A,0x51,0x9A,0x51,0xDC,0x69,0xDC,0x69,0x9A,0x51,0x9A,0x51,0xDC,0x69,0xDC,0x69,0xDE,0xA9,0x7D,0x82,0xDE,0xA9,0x7D,0x82,0x7D,0x82,0xBE,0xA0,0x5B,0x88,0x39,0x59,0xD5,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0x2F,0x48,
-	0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2B,0x30,0x2A,0x48,0x2B,0x30,0x2B,0x30,0x49,0x30,0x27,0x28,0x27,0x28,0x2B,0x30,0x27,0x28,0x25,0x18,0x25,0x20,0x25,0x18,0x24,0x18,0x24,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xEC,0x10,0xED,0x18,0xED,0x18,0xCF,0x20,0xF1,0x20,0xF3,0x38,0x32,0x21,0xF1,0x20,0xCF,0x20,0xF1,0x20,0xDC,0x69,0xBF,0x93,0xBF,0x93,0x7D,0x82,0xDC,0x69,0x9A,0x51,0xDC,0x69,0xDC,0x69,0xDC,0x69,0xDC,0x69,
-	0x9A,0x51,0x7D,0x82,0xDE,0xA9,0xDE,0xA9,0x7D,0x82,0xDE,0xA9,0xDE,0xA9,0x7D,0x82,0xDC,0x69,0xDC,0x69,0x39,0x58,0x92,0x50,0x92,0x50,0x30,0x38,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x4D,0x30,0x2D,0x48,0x2B,0x30,0x49,0x30,0x28,0x28,0x27,0x28,0x27,0x28,0x26,0x20,0x26,0x20,0x25,0x20,0x24,0x18,
-	0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x08,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xAB,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,
-	0x32,0x21,0x32,0x21,0xF3,0x38,0xF1,0x20,0xF1,0x20,0xF1,0x20,0xFC,0x41,0xBF,0x93,0xFC,0xCB,0xBF,0x93,0xDC,0x69,0x9A,0x51,0xDC,0x69,0x7D,0x82,0xDC,0x69,0xDC,0x69,0xDC,0x69,0x7D,0x82,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,0x5B,0x88,0x39,0x59,0xD5,0x50,0x92,0x50,0x92,0x50,0x2F,0x48,0x92,0x50,
-	0x2F,0x48,0x4D,0x30,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x49,0x30,0x49,0x30,0x27,0x28,0x27,0x28,0x26,0x28,0x26,0x20,0x25,0x20,0x25,0x20,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,
-	0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xED,0x18,0xCF,0x20,0x32,0x21,0x55,0x29,0x32,0x21,0xF1,0x20,0xF1,0x20,0xF3,0x38,0xDC,0x69,0xBF,0x93,0xFC,0xCB,0xBF,0x93,0xDC,0x69,0x9A,0x51,0xDC,0x69,0x7D,0x82,0xDC,0x69,0x9A,0x51,
-	0x39,0x59,0x7D,0x82,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x34,0x70,0x92,0x50,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x49,0x30,0x28,0x28,0x28,0x28,0x27,0x28,0x27,0x28,0x26,0x28,0x26,0x20,0x25,0x20,0x25,0x18,0x24,0x18,
-	0x24,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x23,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xAB,0x18,0xED,0x18,0xEE,0x18,0xF1,0x20,
-	0xF3,0x38,0xF3,0x38,0xF3,0x38,0xF3,0x38,0x32,0x21,0xF3,0x38,0xDC,0x69,0xBF,0x93,0xFC,0xCB,0xBF,0x93,0xDC,0x69,0xDC,0x69,0x7D,0x82,0x7D,0x82,0x7D,0x82,0xDC,0x69,0xDC,0x69,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,0xDC,0x69,0x5B,0x88,0x39,0x59,0xD5,0x50,0x92,0x50,0x30,0x38,0x2F,0x48,
-	0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2F,0x48,0x2D,0x48,0x29,0x28,0x49,0x30,0x28,0x28,0x27,0x28,0x27,0x28,0x27,0x28,0x26,0x20,0x25,0x20,0x25,0x20,0x25,0x18,0x24,0x18,0x24,0x10,0x23,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x23,0x10,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x10,0x21,0x08,0x21,0x08,
-	0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x08,
-	0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x08,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xED,0x18,0xED,0x18,0xCF,0x20,0xF1,0x20,0xF3,0x38,0x55,0x29,0x55,0x29,0xF3,0x38,0xF1,0x20,0xF3,0x38,0x9D,0x5A,0xBF,0x93,0xFC,0xCB,0xBF,0x93,0xDC,0x69,0xDC,0x69,0x7D,0x82,0xDE,0xA9,0x7D,0x82,0x7D,0x82,
-	0x5B,0x88,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x36,0x88,0xD5,0x50,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2B,0x30,0x49,0x30,0x28,0x28,0x27,0x28,0x27,0x28,0x26,0x28,0x26,0x20,0x25,0x20,0x25,0x20,0x25,0x18,0x24,0x18,0x24,0x18,
-	0x23,0x18,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,
-	0x20,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xED,0x18,0xEE,0x18,0xCF,0x20,0x32,0x21,
-	0x55,0x29,0x37,0x41,0xF3,0x38,0xF3,0x38,0xF3,0x38,0x37,0x41,0xDC,0x69,0xFC,0xCB,0x5E,0xC5,0xDE,0xA9,0x7D,0x82,0x7D,0x82,0xBC,0xD2,0xBC,0xD2,0xDE,0xA9,0x7D,0x82,0x7D,0x82,0xDE,0xA9,0xBC,0xD2,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x39,0x59,0x34,0x70,0x92,0x50,0x2F,0x48,
-	0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x49,0x30,0x49,0x30,0x28,0x28,0x27,0x28,0x26,0x28,0x26,0x20,0x26,0x20,0x25,0x20,0x25,0x18,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x21,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x08,0xA8,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAB,0x10,0xAB,0x18,0xAD,0x20,0xEE,0x18,0xCF,0x20,0xF3,0x38,0x55,0x29,0x37,0x41,0x55,0x29,0xF3,0x38,0xF3,0x38,0x37,0x41,0xDC,0x69,0xFC,0xCB,0xFC,0xCB,0xBF,0x93,0x7D,0x82,0x7D,0x82,0xDE,0xA9,0xBC,0xD2,0xDE,0xA9,0x5B,0x88,
-	0xDE,0xA9,0xDE,0xA9,0x7E,0xE9,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x34,0x70,0x92,0x50,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x49,0x30,0x28,0x28,0x27,0x28,0x27,0x28,0x26,0x20,0x26,0x20,0x25,0x20,0x25,0x20,0x24,0x18,0x24,0x18,0x24,0x18,0x23,0x18,
-	0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x10,0x22,0x08,0x21,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x18,0xAB,0x18,0xED,0x18,0xED,0x18,0xCF,0x20,0xCF,0x20,0x32,0x21,
-	0x55,0x29,0x37,0x41,0x37,0x41,0x55,0x29,0xF3,0x38,0x37,0x41,0x7D,0x82,0xFC,0xCB,0x5E,0xC5,0xBC,0xD2,0x7D,0x82,0xDE,0xA9,0xBF,0x93,0xBC,0xD2,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBC,0xD2,0xDE,0xA9,0xBE,0xA0,0xDE,0xA9,0xDE,0xA9,0x7D,0xD0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x36,0x88,0x34,0x70,0x30,0x60,
-	0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2A,0x48,0x49,0x30,0x28,0x28,0x27,0x28,0x27,0x28,0x26,0x20,0x25,0x20,0x25,0x20,0x25,0x20,0x24,0x18,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x21,0x10,0x22,0x10,0x21,0x08,0x22,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xA8,0x08,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAB,0x10,0xAB,0x18,0xED,0x18,0xAD,0x20,0xCF,0x20,0xF1,0x20,0xF3,0x38,0x37,0x41,0x37,0x41,0x37,0x41,0xF3,0x38,0xF3,0x38,0x37,0x41,0x7D,0x82,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,0x7D,0x82,0x7D,0x82,0xBC,0xD2,0xDE,0xA9,0xBC,0xD2,0xDE,0xA9,
-	0xDE,0xA9,0x7E,0xE9,0x7E,0xE9,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x5B,0x88,0x34,0x70,0x92,0x50,0x30,0x60,0x2F,0x48,0x2A,0x48,0x49,0x30,0x28,0x28,0x27,0x30,0x27,0x28,0x26,0x28,0x25,0x20,0x25,0x20,0x25,0x20,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x10,
-	0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x21,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x22,0x08,0x21,0x08,0x22,0x00,0x21,0x08,
-	0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xED,0x18,0xCF,0x20,0xEE,0x18,0xCF,0x20,0xF3,0x38,
-	0x37,0x41,0x37,0x41,0x37,0x41,0x55,0x29,0xF3,0x38,0x37,0x41,0x7D,0x82,0xFC,0xCB,0x5E,0xC5,0xBC,0xD2,0x7D,0x82,0xDE,0xA9,0xBC,0xD2,0xBC,0xD2,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBC,0xD2,0x7E,0xE9,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x7D,0xD0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x5B,0x88,0x34,0x70,0x30,0x60,
-	0x30,0x60,0x2F,0x48,0x2D,0x48,0x49,0x30,0x27,0x30,0x27,0x28,0x26,0x28,0x26,0x28,0x25,0x20,0x25,0x20,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x21,0x10,0x22,0x08,0x21,0x10,0x22,0x08,0x21,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x08,
-	0x21,0x08,0x21,0x10,0x20,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA8,0x10,0xA8,0x08,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAD,0x20,0xED,0x18,0xCF,0x20,0xF1,0x20,0x32,0x21,0x37,0x41,0x37,0x41,0x37,0x41,0xF3,0x38,0x37,0x41,0x37,0x41,0xDE,0xA9,0xBC,0xD2,0xFC,0xCB,0xBC,0xD2,0xDE,0xA9,0x7D,0x82,0xDE,0xA9,0xBC,0xD2,0xBC,0xD2,0xDE,0xA9,
-	0x7A,0xD1,0xDE,0xA9,0x7E,0xE9,0x7A,0xD1,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x5B,0x88,0x5B,0x88,0x34,0x70,0x31,0x70,0x30,0x60,0x2D,0x58,0x2A,0x48,0x29,0x40,0x49,0x30,0x27,0x28,0x26,0x28,0x25,0x28,0x25,0x20,0x24,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x22,0x00,0x21,0x08,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xED,0x18,0xAD,0x20,0xCF,0x20,0xCF,0x20,0xF3,0x38,
-	0x37,0x41,0x37,0x41,0x37,0x41,0x37,0x41,0xF3,0x38,0x37,0x41,0x7D,0x82,0xBC,0xD2,0xFC,0xCB,0xBC,0xD2,0x7D,0x82,0xDE,0xA9,0xDE,0xA9,0xBC,0xD2,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0x7D,0xD0,0x7E,0xE9,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x5B,0x88,0x36,0x88,0x36,0x88,0x34,0x70,0x34,0x70,
-	0x30,0x60,0x30,0x60,0x2D,0x48,0x2A,0x48,0x49,0x30,0x27,0x30,0x26,0x28,0x25,0x20,0x24,0x20,0x24,0x20,0x24,0x18,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x08,0x22,0x10,0x22,0x08,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x10,0xAB,0x18,0xAB,0x18,0xAD,0x20,0xEE,0x18,0xCF,0x20,0xCF,0x20,0xF3,0x38,0x55,0x29,0x37,0x41,0x37,0x41,0xF3,0x38,0xF3,0x38,0x37,0x41,0x7D,0x82,0xBC,0xD2,0xFC,0xCB,0x7E,0xE9,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBC,0xD2,0xDE,0xA9,0xDE,0xA9,
-	0x7D,0xD0,0xDE,0xA9,0x7E,0xE9,0x7D,0xD0,0xBE,0xA0,0x38,0xA8,0xBE,0xA0,0x5B,0x88,0x5B,0x88,0x5B,0x88,0x5B,0x88,0x36,0x88,0x36,0x88,0x34,0x70,0x31,0x70,0x34,0x70,0x31,0x70,0x30,0x60,0x2B,0x50,0x2A,0x48,0x29,0x40,0x49,0x30,0x27,0x30,0x26,0x28,0x25,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x22,0x10,0x23,0x10,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x08,0x21,0x10,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x00,0x21,0x08,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA8,0x08,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xEB,0x18,0xAB,0x18,0xED,0x18,0xAB,0x18,0xAD,0x20,0xCF,0x20,0xCF,0x20,0xF1,0x20,
-	0x37,0x41,0x37,0x41,0x37,0x41,0xF3,0x38,0xF3,0x38,0x37,0x41,0xDE,0xA9,0xBC,0xD2,0xFC,0xCB,0x7E,0xE9,0xDE,0xA9,0x7D,0x82,0xDE,0xA9,0x7E,0xE9,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,0x7D,0xD0,0x7D,0xD0,0x7D,0xD0,0xBE,0xA0,0x38,0xA8,0x5B,0x88,0x38,0xA8,0x5B,0x88,0x36,0x88,0x34,0x70,0x34,0x70,0x34,0x70,0x30,0x60,0x30,0x60,0x30,0x60,
-	0x30,0x60,0x30,0x60,0x2D,0x58,0x2D,0x48,0x2A,0x48,0x29,0x40,0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x08,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xED,0x18,0xAD,0x20,0xAD,0x20,0xCF,0x20,0xCF,0x20,0xF3,0x38,0xF3,0x38,0x37,0x41,0x37,0x41,0xF3,0x38,0x34,0x30,0xD5,0x50,0x7D,0x82,0x7E,0xE9,0xBC,0xD2,0xBC,0xD2,0x7D,0x82,0xBE,0xA0,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0xBE,0xA0,
-	0xBE,0xA0,0xBE,0xA0,0x7D,0xD0,0x7D,0xD0,0x38,0xA8,0xBE,0xA0,0x38,0xA8,0x5B,0x88,0x5B,0x88,0x34,0x70,0x34,0x70,0x31,0x70,0x30,0x60,0x30,0x60,0x2D,0x58,0x2D,0x58,0x2D,0x58,0x30,0x60,0x30,0x60,0x2D,0x58,0x2A,0x48,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x28,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x22,0x10,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x23,0x18,0x22,0x10,0x22,0x08,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xED,0x18,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xCF,0x20,0xCF,0x20,
-	0xF3,0x38,0x37,0x41,0xF3,0x38,0xF3,0x38,0xF3,0x38,0xD5,0x50,0xDC,0x69,0x7E,0xE9,0xBC,0xD2,0x7E,0xE9,0xBE,0xA0,0x5B,0x88,0xDE,0xA9,0x7D,0xD0,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,0x7D,0xD0,0x7D,0xD0,0xBE,0xA0,0xBE,0xA0,0x38,0xA8,0x5B,0x88,0x5B,0x88,0x36,0x88,0x34,0x70,0x30,0x60,0x30,0x60,0x30,0x60,0x2D,0x58,0x2B,0x50,0x2D,0x48,
-	0x2D,0x48,0x2D,0x58,0x2D,0x58,0x2D,0x58,0x2B,0x50,0x2A,0x48,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x30,0x25,0x28,0x24,0x20,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x08,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x10,0xA8,0x08,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xCF,0x20,0xCF,0x20,0xF3,0x38,0xF3,0x38,0xD5,0x50,0xF3,0x38,0x92,0x50,0xF3,0x38,0xDC,0x69,0xDE,0xA9,0x7E,0xE9,0x7E,0xE9,0x7D,0x82,0xDC,0x69,0xBE,0xA0,0xDE,0xA9,0xBE,0xA0,0xBE,0xA0,
-	0xBE,0xA0,0xBE,0xA0,0x7D,0xD0,0x7D,0xD0,0x38,0xA8,0x5B,0x88,0x36,0x88,0x36,0x88,0x34,0x70,0x31,0x70,0x30,0x60,0x2D,0x58,0x2D,0x48,0x2A,0x48,0x2A,0x48,0x2A,0x48,0x2A,0x48,0x2A,0x48,0x2A,0x48,0x2B,0x50,0x2B,0x50,0x29,0x40,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x30,0x24,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x08,0x21,0x10,0x22,0x08,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xED,0x18,0xAB,0x18,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xCF,0x20,
-	0xF3,0x38,0xF3,0x38,0xF3,0x38,0x30,0x38,0xAF,0x38,0x30,0x38,0x39,0x59,0xDE,0xA9,0x7E,0xE9,0x7E,0xE9,0xBE,0xA0,0x5B,0x88,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,0x7D,0xD0,0xBE,0xA0,0x38,0xA8,0x36,0x88,0x36,0x88,0x36,0x88,0x31,0x70,0x92,0x50,0x30,0x60,0x2D,0x58,0x2A,0x48,0x2A,0x48,0x29,0x40,0x29,0x40,
-	0x29,0x40,0x29,0x40,0x29,0x40,0x2A,0x48,0x2A,0x48,0x29,0x40,0x29,0x40,0x29,0x40,0x26,0x48,0x27,0x30,0x27,0x30,0x25,0x30,0x25,0x28,0x24,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x22,0x10,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x08,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xED,0x18,0xAD,0x20,0xAB,0x18,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xCF,0x20,0x30,0x38,0xF3,0x38,0xF3,0x38,0xAF,0x38,0x30,0x38,0xAF,0x38,0x39,0x58,0xDE,0xA9,0x7E,0xE9,0x7E,0xE9,0xBE,0xA0,0x39,0x58,0x5B,0x88,0xBE,0xA0,0xBE,0xA0,0xBE,0xA0,
-	0x5B,0x88,0x5B,0x88,0x7D,0xD0,0xBE,0xA0,0x36,0x88,0x36,0x88,0x34,0x70,0x34,0x70,0x30,0x60,0x30,0x60,0x2D,0x58,0x2D,0x48,0x2B,0x50,0x2A,0x48,0x49,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x29,0x40,0x26,0x48,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x28,0x24,0x28,0x24,0x28,
-	0x24,0x28,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xAD,0x20,0xAB,0x18,0xAD,0x20,0xAD,0x20,0xCF,0x20,0x4C,0x28,
-	0xF1,0x20,0x92,0x50,0xF3,0x38,0x30,0x38,0xAF,0x38,0x4D,0x30,0xD5,0x50,0xBE,0xA0,0x7E,0xE9,0x7E,0xE9,0xBE,0xA0,0x39,0x58,0x5B,0x88,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x5B,0x88,0x5B,0x88,0xBE,0xA0,0x38,0xA8,0x36,0x88,0x34,0x70,0x31,0x70,0x31,0x70,0x30,0x60,0x2D,0x58,0x2D,0x48,0x2B,0x50,0x2D,0x48,0x29,0x40,0x49,0x30,0x27,0x30,
-	0x27,0x30,0x26,0x28,0x27,0x30,0x27,0x30,0x26,0x48,0x29,0x40,0x27,0x30,0x27,0x30,0x26,0x48,0x27,0x30,0x25,0x38,0x25,0x38,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x28,0x25,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x20,0x24,0x28,0x24,0x20,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x10,0xA8,0x08,0xA9,0x10,0xA9,0x10,0xAA,0x18,0xAA,0x10,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xAF,0x38,0xF3,0x38,0x30,0x38,0xAF,0x38,0x4D,0x30,0xAF,0x38,0x30,0x38,0x5B,0x88,0x7D,0xD0,0x7E,0xE9,0x5B,0x88,0x39,0x58,0x39,0x58,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,
-	0x36,0x88,0x5B,0x88,0x38,0xA8,0x5B,0x88,0x36,0x88,0x31,0x70,0x34,0x70,0x30,0x60,0x30,0x60,0x2D,0x58,0x2D,0x58,0x2A,0x48,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x27,0x30,0x25,0x28,0x25,0x28,0x25,0x30,0x26,0x28,0x27,0x30,0x26,0x48,0x27,0x30,0x27,0x30,0x27,0x30,0x25,0x30,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,
-	0x25,0x30,0x25,0x30,0x25,0x28,0x25,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x18,0x23,0x18,0x22,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0x67,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xAD,0x20,0x4C,0x28,0xAD,0x20,0x4C,0x28,
-	0xAF,0x38,0xF3,0x38,0xF3,0x38,0x30,0x38,0xAF,0x38,0x4D,0x30,0x30,0x38,0x5B,0x88,0x7D,0xD0,0x7E,0xE9,0x5B,0x88,0x39,0x58,0x34,0x70,0x5B,0x88,0xBE,0xA0,0x5B,0x88,0x34,0x70,0x36,0x88,0x5B,0x88,0x36,0x88,0x34,0x70,0x30,0x60,0x30,0x60,0x30,0x60,0x2D,0x58,0x2D,0x58,0x2A,0x48,0x2A,0x48,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x25,0x28,0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x38,0x25,0x38,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x38,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x28,0x24,0x20,0x23,0x20,0x24,0x20,0x23,0x18,0x22,0x20,0x23,0x18,0x23,0x20,0x23,0x18,0x22,0x18,
-	0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x20,0xAB,0x18,0xAB,0x20,0xAD,0x20,0xAD,0x20,0xAD,0x20,0xAF,0x38,0x30,0x38,0x30,0x38,0xAF,0x38,0x4D,0x30,0x4D,0x30,0xAF,0x38,0x5B,0x88,0xBE,0xA0,0x7D,0xD0,0xBE,0xA0,0x34,0x70,0xD5,0x50,0x5B,0x88,0x5B,0x88,0x5B,0x88,
-	0x34,0x70,0x34,0x70,0x36,0x88,0x36,0x88,0x34,0x70,0x30,0x60,0x30,0x60,0x2D,0x58,0x2D,0x58,0x2B,0x50,0x2B,0x50,0x2A,0x48,0x2A,0x48,0x29,0x40,0x49,0x30,0x27,0x30,0x26,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x38,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x30,
-	0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x28,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x08,0x67,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x20,0xAB,0x20,0xAB,0x20,0x4C,0x28,0x4C,0x28,
-	0xAD,0x20,0x30,0x38,0xF3,0x38,0xAF,0x38,0x4D,0x30,0x4D,0x30,0x4D,0x30,0x39,0x58,0xBE,0xA0,0x7D,0xD0,0xBE,0xA0,0x39,0x58,0x92,0x50,0x5B,0x88,0x5B,0x88,0x5B,0x88,0x34,0x70,0x34,0x70,0x34,0x70,0x36,0x88,0x31,0x70,0x30,0x60,0x2D,0x58,0x2D,0x58,0x2B,0x50,0x2B,0x50,0x2B,0x50,0x2A,0x48,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x28,
-	0x25,0x30,0x25,0x28,0x25,0x28,0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x28,0x24,0x28,0x24,0x28,0x25,0x28,0x25,0x30,0x25,0x30,0x24,0x28,0x24,0x30,0x25,0x30,0x25,0x30,0x24,0x28,0x24,0x28,0x24,0x28,0x23,0x20,0x24,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,
-	0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x10,0x67,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAB,0x20,0x4A,0x18,0xAB,0x20,0x4C,0x28,0xAB,0x20,0x4C,0x28,0xAF,0x38,0xAF,0x38,0x30,0x38,0x4D,0x30,0x4D,0x30,0x4D,0x30,0xD5,0x50,0xBE,0xA0,0x7D,0xD0,0xBE,0xA0,0x36,0x88,0x92,0x50,0x34,0x70,0x5B,0x88,0x5B,0x88,
-	0x34,0x70,0x31,0x70,0x31,0x70,0x34,0x70,0x34,0x70,0x2D,0x58,0x2D,0x58,0x2D,0x58,0x2B,0x50,0x2B,0x50,0x2A,0x48,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x30,0x25,0x28,0x25,0x28,0x24,0x28,0x25,0x28,0x25,0x28,0x25,0x30,0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x24,0x20,0x24,0x20,0x23,0x20,0x24,0x20,
-	0x24,0x28,0x24,0x28,0x23,0x20,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x20,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0x67,0x10,0xA8,0x08,0x67,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0x4A,0x18,0xAA,0x20,0x4A,0x18,0xAB,0x20,0x4B,0x28,
-	0x4C,0x28,0x4C,0x28,0xAF,0x38,0x4D,0x30,0x4D,0x30,0x2B,0x30,0x2B,0x30,0x92,0x50,0x5B,0x88,0x7D,0xD0,0x7D,0xD0,0x5B,0x88,0x92,0x50,0x34,0x70,0x5B,0x88,0x36,0x88,0x34,0x70,0x30,0x60,0x31,0x70,0x34,0x70,0x31,0x70,0x30,0x60,0x2D,0x58,0x2D,0x58,0x2D,0x58,0x2A,0x48,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x30,
-	0x25,0x28,0x25,0x28,0x25,0x30,0x25,0x30,0x24,0x30,0x25,0x30,0x24,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x24,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x20,0x23,0x18,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0x67,0x10,0x67,0x10,0xA8,0x10,0x67,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0x69,0x20,0xAA,0x18,0x69,0x20,0x4B,0x28,0x69,0x20,0x4B,0x28,0x4C,0x28,0x4D,0x30,0x4D,0x30,0x4D,0x30,0x4B,0x28,0x4B,0x28,0x30,0x38,0x5B,0x88,0x7D,0xD0,0x7D,0xD0,0x5B,0x88,0x92,0x50,0x31,0x70,0x36,0x88,0x36,0x88,
-	0x34,0x70,0x30,0x60,0x31,0x70,0x31,0x70,0x31,0x70,0xAE,0x68,0x2D,0x58,0x2D,0x58,0x2B,0x50,0x29,0x40,0x29,0x40,0x27,0x30,0x27,0x30,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x28,0x25,0x30,0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x28,0x23,0x20,0x24,0x20,0x24,0x20,
-	0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0xA8,0x08,0x67,0x10,0x67,0x10,0xA8,0x10,0xA8,0x10,0x68,0x18,0xA9,0x10,0xA9,0x10,0x68,0x18,0xA9,0x18,0x69,0x20,0xA9,0x18,0x4A,0x18,0x69,0x20,0x69,0x20,
-	0x69,0x20,0x4B,0x28,0x4D,0x30,0x4D,0x30,0x4B,0x28,0x29,0x28,0x29,0x28,0x2B,0x30,0x39,0x58,0xBE,0xA0,0x7D,0xD0,0x5B,0x88,0x30,0x60,0x2F,0x48,0x34,0x70,0x36,0x88,0x31,0x70,0x30,0x60,0x30,0x60,0x31,0x70,0x31,0x70,0x31,0x70,0x2D,0x58,0x2B,0x50,0x2B,0x50,0x29,0x40,0x26,0x48,0x26,0x48,0x27,0x30,0x27,0x30,0x25,0x30,0x25,0x30,
-	0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x25,0x30,0x25,0x38,0x24,0x28,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x20,0x22,0x18,0x22,0x20,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0x67,0x10,0x67,0x10,0xA7,0x10,0x67,0x10,0x67,0x10,0xA9,0x10,0x68,0x18,0x68,0x18,0xA9,0x10,0x68,0x18,0x68,0x18,0x68,0x18,0x69,0x20,0x68,0x18,0x29,0x20,0x29,0x20,0x29,0x28,0x4B,0x28,0x4D,0x30,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x92,0x50,0xBE,0xA0,0x7D,0xD0,0x5B,0x88,0x30,0x60,0x2F,0x48,0x31,0x70,0x34,0x70,
-	0x31,0x70,0x2D,0x58,0x2D,0x58,0x30,0x60,0x31,0x70,0x8E,0x80,0x2D,0x58,0x2B,0x50,0x29,0x40,0x26,0x48,0x27,0x30,0x27,0x30,0x27,0x30,0x25,0x38,0x25,0x30,0x25,0x30,0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x38,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x24,0x28,
-	0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0xA8,0x10,0x67,0x10,0xA8,0x10,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,0x68,0x18,
-	0x68,0x18,0x28,0x20,0x29,0x28,0x2B,0x30,0x29,0x28,0x29,0x28,0x28,0x28,0x28,0x28,0x2F,0x48,0x5B,0x88,0xBE,0xA0,0x5B,0x88,0x30,0x60,0x2D,0x48,0x30,0x60,0x31,0x70,0x31,0x70,0x2D,0x58,0x2B,0x50,0x2D,0x58,0x31,0x70,0x31,0x70,0x2B,0x50,0x29,0x40,0x29,0x40,0x26,0x48,0x29,0x40,0x25,0x38,0x25,0x38,0x25,0x30,0x25,0x30,0x25,0x30,
-	0x25,0x30,0x24,0x30,0x25,0x30,0x25,0x38,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x25,0x38,0x24,0x30,0x24,0x28,0x24,0x28,0x23,0x20,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x08,0x67,0x10,0xA7,0x08,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0xA8,0x10,0x67,0x10,0x67,0x18,0x68,0x18,0x27,0x18,0x67,0x18,0x27,0x18,0x28,0x20,0x28,0x20,0x29,0x28,0x29,0x28,0x28,0x20,0x28,0x28,0x28,0x28,0x2B,0x30,0x34,0x70,0x7D,0xD0,0x7D,0xD0,0x34,0x70,0x2D,0x48,0x30,0x60,0x31,0x70,
-	0x31,0x70,0x30,0x60,0x2B,0x50,0x2D,0x58,0x8E,0x80,0x4B,0x70,0x2B,0x50,0x29,0x40,0x26,0x48,0x26,0x48,0x27,0x30,0x27,0x30,0x25,0x38,0x25,0x30,0x25,0x30,0x24,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,
-	0x24,0x28,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x66,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x18,0x27,0x18,0x27,0x18,
-	0x27,0x18,0x27,0x18,0x28,0x20,0x28,0x20,0x28,0x28,0x28,0x20,0x27,0x28,0x27,0x20,0x2B,0x30,0x34,0x70,0xBE,0xA0,0xBE,0xA0,0x36,0x88,0x30,0x60,0x30,0x60,0x31,0x70,0x34,0x70,0x30,0x60,0x2B,0x50,0x2D,0x58,0x2D,0x58,0x2D,0x58,0x2B,0x50,0x26,0x48,0x26,0x48,0x27,0x30,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x30,0x25,0x30,0x25,0x30,
-	0x25,0x30,0x24,0x38,0x25,0x30,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x22,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0x67,0x10,0xA7,0x08,0x66,0x10,0xA7,0x08,0x66,0x10,0x67,0x10,0x66,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x18,0x67,0x10,0x27,0x18,0x67,0x18,0x27,0x18,0x67,0x18,0x26,0x18,0x27,0x20,0x28,0x20,0x29,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x2B,0x30,0x34,0x70,0x38,0xA8,0x7D,0xD0,0x38,0xA8,0x31,0x70,0x30,0x60,0x34,0x70,
-	0x91,0x90,0x31,0x70,0x30,0x60,0x2D,0x58,0x8E,0x80,0x2D,0x58,0x2B,0x50,0x29,0x40,0x27,0x30,0x27,0x30,0x25,0x38,0x25,0x38,0x25,0x30,0x25,0x30,0x24,0x30,0x25,0x30,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x30,0x25,0x30,0x24,0x30,0x24,0x28,0x24,0x30,0x24,0x30,0x24,0x28,
-	0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x65,0x08,0x66,0x10,0x66,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x67,0x10,0x66,0x10,0x67,0x10,0x26,0x10,0x26,0x18,
-	0x27,0x18,0x26,0x18,0x27,0x20,0x28,0x20,0x28,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x49,0x30,0x30,0x60,0xBE,0xA0,0x7D,0xD0,0x7D,0xD0,0x36,0x88,0x31,0x70,0x34,0x70,0x38,0xA8,0x91,0x90,0x31,0x70,0x30,0x60,0xAE,0x68,0x8E,0x80,0x2D,0x58,0x27,0x50,0x27,0x30,0x25,0x38,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x25,0x38,0x24,0x38,
-	0x25,0x38,0x25,0x38,0x25,0x40,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x30,0x25,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x25,0x30,0x24,0x30,0x24,0x28,0x23,0x30,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x08,0x67,0x10,0x67,0x10,0xA7,0x08,0x66,0x10,0x66,0x10,0x65,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x26,0x10,0x66,0x10,0x26,0x10,0x66,0x10,0x26,0x10,0x26,0x18,0x67,0x18,0x27,0x18,0x28,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x2B,0x30,0x2B,0x30,0x30,0x60,0x38,0xA8,0x7D,0xD0,0x7D,0xD0,0x38,0xA8,0x31,0x70,0x31,0x70,
-	0x38,0xA8,0x36,0x88,0x91,0x90,0x31,0x70,0xAE,0x68,0x4B,0x70,0x4B,0x70,0x2B,0x50,0x26,0x48,0x25,0x38,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x38,0x25,0x30,0x25,0x38,0x25,0x38,0x25,0x40,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x38,0x24,0x30,0x24,0x30,
-	0x24,0x28,0x23,0x30,0x23,0x20,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x30,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x65,0x08,0x66,0x10,0x66,0x10,0x65,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x26,0x18,
-	0x67,0x18,0x26,0x18,0x26,0x18,0x28,0x20,0x29,0x28,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2F,0x48,0x38,0xA8,0x7D,0xD0,0x7D,0xD0,0x38,0xA8,0x36,0x88,0x34,0x70,0x38,0xA8,0x38,0xA8,0x91,0x90,0x31,0x70,0x4B,0x70,0xAE,0x68,0x8E,0x80,0x2B,0x50,0x26,0x48,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x25,0x30,0x25,0x38,
-	0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x24,0x30,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x38,0x25,0x38,0x24,0x30,0x23,0x30,0x24,0x28,0x24,0x28,0x23,0x30,0x23,0x20,0x24,0x28,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x65,0x08,0x66,0x10,0x65,0x08,0x66,0x10,0x65,0x10,0x65,0x08,0x25,0x10,0x65,0x10,0x26,0x10,0x66,0x10,0x26,0x10,0x66,0x18,0x26,0x18,0x26,0x18,0x67,0x18,0x28,0x20,0x29,0x28,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2D,0x48,0x36,0x88,0x7D,0xD0,0x7D,0xD0,0x7D,0xD0,0x38,0xA8,0x31,0x70,
-	0x38,0xA8,0x38,0xA8,0x38,0xA8,0x91,0x90,0x31,0x70,0x4B,0x70,0x4B,0x70,0x4B,0x70,0x29,0x40,0x25,0x38,0x25,0x30,0x24,0x30,0x25,0x30,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x25,0x30,0x24,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x30,
-	0x24,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0x67,0x10,0xA8,0x08,0x67,0x10,0x67,0x10,0x65,0x08,0x66,0x10,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x10,0x25,0x10,0x65,0x10,0x26,0x10,0x66,0x10,0x66,0x18,
-	0x67,0x10,0x66,0x18,0x26,0x18,0x28,0x20,0x29,0x28,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2A,0x48,0x2B,0x30,0x34,0x70,0x7D,0xD0,0x7D,0xD0,0x7D,0xD0,0x38,0xA8,0x36,0x88,0x91,0x90,0x38,0xA8,0x38,0xA8,0x91,0x90,0x8E,0x80,0x2D,0x58,0x4B,0x70,0x4B,0x70,0x27,0x50,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,
-	0x25,0x38,0x25,0x38,0x25,0x40,0x25,0x38,0x24,0x38,0x25,0x40,0x25,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x23,0x30,0x23,0x20,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x10,0xA7,0x10,0x67,0x10,0x66,0x10,0x66,0x10,0x65,0x08,0x65,0x10,0x25,0x10,0x65,0x08,0x65,0x08,0x25,0x10,0x25,0x10,0x26,0x10,0x66,0x10,0x26,0x18,0x66,0x18,0x26,0x18,0x26,0x20,0x28,0x20,0x49,0x30,0x4D,0x30,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x2A,0x48,0x30,0x60,0x38,0xA8,0x7D,0xD0,0x7D,0xD0,0x7D,0xD0,0x91,0x90,
-	0x36,0x88,0x38,0xA8,0x38,0xA8,0xD4,0xA8,0x31,0x70,0x2D,0x58,0x4B,0x70,0x2D,0x58,0x49,0x60,0x26,0x48,0x25,0x30,0x25,0x38,0x24,0x38,0x25,0x38,0x25,0x30,0x24,0x38,0x25,0x38,0x25,0x40,0x25,0x40,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x25,0x40,0x25,0x38,0x24,0x38,
-	0x24,0x30,0x23,0x30,0x24,0x38,0x24,0x38,0x23,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x65,0x08,0x66,0x10,0x65,0x08,0x65,0x10,0x65,0x08,0x25,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x26,0x10,0x26,0x10,
-	0x26,0x18,0x26,0x18,0x27,0x18,0x27,0x20,0x29,0x28,0x2B,0x30,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x2D,0x48,0x2D,0x48,0x38,0xA8,0x7D,0xD0,0x7D,0xD0,0x7D,0xD0,0x38,0xA8,0x91,0x90,0x91,0x90,0x38,0xA8,0x38,0xA8,0x8E,0x80,0x4B,0x70,0x2B,0x50,0x4B,0x70,0x49,0x60,0x26,0x48,0x25,0x38,0x24,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,
-	0x24,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x23,0x30,0x24,0x28,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,
-	0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x08,0x67,0x10,0xA7,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x08,0x66,0x10,0x65,0x10,0x65,0x08,0x25,0x10,0x66,0x10,0x25,0x10,0x65,0x10,0x25,0x10,0x66,0x18,0x26,0x18,0x26,0x20,0x27,0x20,0x28,0x28,0x2B,0x30,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2A,0x48,0x2A,0x48,0x34,0x70,0x7D,0xD0,0x7D,0xD0,0x7D,0xD0,0x38,0xA8,
-	0x31,0x70,0x91,0x90,0xD4,0xA8,0x91,0x90,0x91,0x90,0x4B,0x70,0x49,0x60,0x49,0x60,0x2B,0x50,0x27,0x50,0x26,0x48,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x25,0x40,0x24,0x38,0x25,0x38,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,
-	0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0xA7,0x08,0x66,0x10,0x66,0x10,0x65,0x08,0x66,0x10,0x65,0x08,0x65,0x10,0x65,0x10,0x25,0x10,0x66,0x10,0x66,0x10,0x65,0x10,
-	0x26,0x18,0x66,0x18,0x26,0x18,0x67,0x20,0x28,0x28,0x2B,0x30,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2A,0x48,0x2D,0x58,0x38,0xA8,0x7D,0xD0,0x7D,0xD0,0x7D,0xD0,0x31,0x70,0x31,0x70,0x91,0x90,0xD4,0xA8,0x91,0x90,0x4B,0x70,0x2B,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x26,0x48,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x25,0x38,
-	0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x24,0x30,0x24,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x08,0xA8,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x25,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x26,0x10,0x26,0x18,0x66,0x10,0x66,0x18,0x26,0x18,0x67,0x20,0x28,0x28,0xAB,0x38,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2A,0x48,0x36,0x88,0x7D,0xD0,0x7E,0xE9,0x7D,0xD0,
-	0x91,0x90,0x31,0x70,0x31,0x70,0x91,0x90,0x91,0x90,0x8E,0x80,0x4B,0x70,0x2B,0x50,0x49,0x60,0x49,0x60,0x26,0x48,0x25,0x40,0x25,0x38,0x25,0x40,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x30,0x24,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,
-	0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x24,0x30,0x24,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x26,0x10,0x66,0x18,0x66,0x10,
-	0x66,0x18,0x26,0x18,0x67,0x20,0x67,0x20,0x68,0x28,0x2B,0x30,0xCC,0x40,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x31,0x70,0x7D,0xD0,0x7D,0xD0,0x7E,0xE9,0x38,0xA8,0x8E,0x80,0x31,0x70,0x91,0x90,0x91,0x90,0x91,0x90,0x4B,0x70,0x49,0x60,0x49,0x60,0x49,0x60,0x27,0x50,0x25,0x40,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,
-	0x25,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x38,0x23,0x30,0x22,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x22,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x10,0x67,0x10,0xA7,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x18,0x66,0x18,0x66,0x18,0x26,0x18,0x66,0x18,0x27,0x18,0x67,0x20,0x28,0x28,0x69,0x28,0x2D,0x48,0x2F,0x48,0xCF,0x58,0x2F,0x48,0xAC,0x58,0x2D,0x48,0xAE,0x68,0x38,0xA8,0x7E,0xE9,0x7E,0xE9,
-	0x7D,0xD0,0x91,0x90,0x31,0x70,0x91,0x90,0x91,0x90,0x91,0x90,0x4B,0x70,0x4B,0x70,0x49,0x60,0x49,0x60,0x49,0x60,0x26,0x48,0x25,0x38,0x25,0x38,0x25,0x40,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,
-	0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x24,0x38,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0xA9,0x10,0xA9,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x18,0x66,0x10,0x66,0x18,0x66,0x18,
-	0x66,0x18,0x26,0x18,0x67,0x20,0x67,0x20,0x68,0x28,0x69,0x28,0xAB,0x38,0x2F,0x48,0xCF,0x58,0x2F,0x48,0x2F,0x48,0x2D,0x58,0x2D,0x48,0x36,0x88,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x38,0xA8,0x91,0x90,0x91,0x90,0x91,0x90,0x91,0x90,0x8E,0x80,0x4B,0x70,0x49,0x60,0x49,0x60,0x49,0x60,0x26,0x48,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,
-	0x25,0x40,0x25,0x40,0x25,0x38,0x25,0x40,0x24,0x38,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x23,0x30,0x24,0x30,0x23,0x30,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x18,0x67,0x18,0x67,0x18,0x67,0x18,0x67,0x18,0x67,0x20,0x27,0x20,0x68,0x28,0x68,0x28,0x2B,0x30,0xAB,0x38,0xCF,0x48,0x30,0x60,0xCF,0x58,0x2F,0x48,0xAC,0x58,0xAC,0x58,0x31,0x70,0x7D,0xD0,0x7E,0xE9,
-	0x7E,0xE9,0x7E,0xE9,0x91,0x90,0x91,0x90,0x91,0x90,0x91,0x90,0x8E,0x80,0x4B,0x70,0x2B,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x26,0x48,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,
-	0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA8,0x10,0x67,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x66,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x18,0x68,0x18,0x67,0x18,0x67,0x18,0x67,0x18,0x67,0x18,
-	0x67,0x20,0x67,0x20,0x67,0x20,0x68,0x28,0x69,0x28,0xAA,0x30,0xAB,0x38,0x2F,0x48,0xCF,0x58,0x30,0x60,0xCF,0x58,0x2D,0x58,0xAC,0x58,0xAE,0x68,0x38,0xA8,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x38,0xA8,0x31,0x70,0x91,0x90,0xD4,0xA8,0x91,0x90,0x4B,0x70,0x49,0x60,0x49,0x60,0x49,0x60,0x49,0x60,0x49,0x60,0x27,0x50,0x26,0x48,0x26,0x48,
-	0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x27,0x50,0x26,0x48,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x18,0x67,0x18,0xA9,0x20,0x68,0x18,0x67,0x18,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x28,0x69,0x28,0x2B,0x30,0xAB,0x38,0x2D,0x48,0xCF,0x58,0x92,0x50,0xAE,0x68,0x2F,0x48,0x2D,0x58,0x2D,0x48,0x53,0x89,0x7E,0xE9,
-	0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x91,0x90,0x91,0x90,0x91,0x90,0x91,0x90,0x8E,0x80,0x4B,0x70,0x27,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x49,0x60,0x27,0x50,0x26,0x48,0x27,0x50,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x27,0x50,
-	0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x30,0x24,0x28,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xA9,0x10,0xA7,0x10,0x67,0x10,0x67,0x18,0x67,0x10,0x67,0x18,0x67,0x18,0x68,0x18,0x67,0x18,0x68,0x18,0x68,0x20,0x68,0x20,
-	0x68,0x20,0x68,0x20,0x68,0x28,0x68,0x28,0x69,0x28,0xAA,0x38,0xAB,0x38,0xCC,0x40,0x2F,0x48,0x10,0x69,0x30,0x60,0xCF,0x58,0x2D,0x58,0x2D,0x58,0x31,0x70,0x7D,0xD0,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x38,0xA8,0x8E,0x80,0x91,0x90,0x91,0x90,0x91,0x90,0x4B,0x70,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x27,0x50,0x26,0x48,
-	0x26,0x48,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x23,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,
-	0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAB,0x18,0xEC,0x10,0xEB,0x18,0xAA,0x18,0xA9,0x18,0x68,0x18,0xA7,0x10,0x67,0x10,0xA7,0x18,0x68,0x18,0xA8,0x18,0x68,0x18,0xA8,0x18,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x28,0x69,0x28,0x69,0x28,0xAA,0x38,0x2B,0x30,0xAB,0x40,0x2F,0x48,0xCF,0x58,0x10,0x69,0x30,0x60,0xED,0x58,0xAC,0x58,0x2D,0x48,0x91,0x90,
-	0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x7D,0xD0,0x91,0x90,0x8E,0x80,0x8E,0x80,0x91,0x90,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x27,0x50,0x26,0x48,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,
-	0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x22,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x18,0x2F,0x19,0x32,0x21,0xAB,0x18,0xAA,0x18,0xA8,0x18,0xA8,0x10,0x67,0x18,0xA8,0x18,0x68,0x18,0xA8,0x18,0x68,0x18,0x68,0x20,0x68,0x20,0xA9,0x20,0xA9,0x20,
-	0x69,0x28,0x69,0x28,0x69,0x28,0x69,0x28,0x69,0x28,0x2B,0x30,0xAA,0x38,0xAB,0x38,0xCC,0x40,0xCF,0x58,0x30,0x60,0xCF,0x58,0x2D,0x58,0xAC,0x58,0x2D,0x58,0xAE,0x68,0x7D,0xD0,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0xD4,0xA8,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x27,0x50,
-	0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,
-	0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
-	0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xED,0x18,0xEE,0x18,0xCF,0x20,0xEB,0x18,0xAA,0x18,0xA9,0x18,0x67,0x10,0xA8,0x18,0xAA,0x18,0xA8,0x18,0x68,0x18,0x68,0x18,0xA9,0x20,0xA9,0x20,0x69,0x20,0xA9,0x20,0x69,0x28,0xA9,0x28,0x69,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x38,0xAA,0x38,0x2A,0x48,0xED,0x58,0xCF,0x58,0xAE,0x68,0xCF,0x58,0x2D,0x58,0xAC,0x58,0x2D,0x58,
-	0xD4,0xA8,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x7A,0xD1,0x8E,0x80,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x27,0x50,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,
-	0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x18,0xED,0x18,0xEB,0x18,0xAB,0x18,0xAA,0x18,0xA9,0x18,0xA8,0x10,0x68,0x18,0xA9,0x18,0x68,0x18,0xA8,0x18,0xA9,0x20,0x68,0x18,0xA9,0x20,0xA9,0x20,0x69,0x20,
-	0x69,0x28,0xAA,0x28,0xAA,0x30,0x69,0x28,0xAA,0x30,0x2B,0x30,0xAA,0x38,0x2B,0x30,0xAB,0x38,0x2D,0x48,0xCF,0x58,0xCF,0x58,0xAE,0x68,0xCF,0x58,0x2D,0x58,0xAE,0x68,0xAE,0x68,0x7D,0xD0,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x91,0x90,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x49,0x60,0x49,0x60,0x49,0x60,
-	0x27,0x50,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,
-	0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
-	0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x23,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAB,0x18,0xEB,0x18,0xAB,0x18,0xAA,0x18,0xA9,0x10,0x68,0x18,0x67,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA9,0x18,0xA9,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x28,0x69,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x38,0xAB,0x30,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAB,0x40,0x2D,0x48,0xCF,0x58,0xCF,0x58,0xAE,0x68,0xED,0x58,0x2D,0x58,
-	0xAE,0x68,0xD4,0xA8,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x7A,0xD1,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x49,0x60,0x49,0x60,0x27,0x50,0x49,0x60,0x49,0x60,0x27,0x50,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x25,0x40,0x25,0x40,0x24,0x38,
-	0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xAA,0x18,0xA9,0x10,0xA9,0x18,0xA8,0x10,0xA8,0x18,0x68,0x18,0xA9,0x18,0x68,0x18,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAB,0x28,0xAB,0x28,0x69,0x28,
-	0xAA,0x28,0xAA,0x28,0xAA,0x30,0xAA,0x30,0x2B,0x30,0xAB,0x38,0xAB,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAB,0x40,0xAC,0x58,0xCF,0x58,0x2D,0x58,0xAC,0x58,0xAE,0x68,0xAC,0x58,0xAE,0x68,0x38,0xA8,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0x91,0x90,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x49,0x60,0x49,0x60,
-	0x49,0x60,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x26,0x48,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x24,0x30,0x24,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,
-	0x23,0x18,0x23,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x23,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x18,0xA9,0x10,0xA9,0x18,0xA8,0x10,0x68,0x18,0xA8,0x10,0xA9,0x18,0xCF,0x20,0xAA,0x20,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x30,0xAB,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x40,0xAB,0x38,0x2D,0x48,0xAC,0x58,0xCF,0x58,0xAE,0x68,0xAC,0x58,
-	0xAC,0x58,0xAC,0x58,0x8E,0x80,0x7A,0xD1,0x7E,0xE9,0x7E,0xE9,0x7A,0xD1,0x8E,0x80,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x26,0x48,0x25,0x40,0x25,0x38,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,
-	0x24,0x38,0x24,0x30,0x24,0x30,0x23,0x30,0x24,0x30,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x18,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x20,0x24,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xA9,0x10,0xA9,0x18,0xA8,0x10,0x68,0x18,0xA8,0x18,0xA9,0x20,0xA9,0x18,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,
-	0xAA,0x28,0xAA,0x30,0xAB,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x40,0xAB,0x38,0xAB,0x40,0xAB,0x40,0xCC,0x40,0xAC,0x58,0xAE,0x68,0xAE,0x68,0xAC,0x58,0x2D,0x58,0xAC,0x58,0xAC,0x58,0xD4,0xA8,0x7E,0xE9,0x7E,0xE9,0x7E,0xE9,0xD4,0xA8,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,
-	0x49,0x60,0x49,0x60,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x38,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x24,0x38,0x25,0x40,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x23,0x30,0x24,0x28,0x24,0x28,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x20,0x23,0x20,0x24,0x28,
-	0x24,0x20,0x24,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xA9,0x10,0xA8,0x18,0xA8,0x18,0x68,0x18,0xA8,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAB,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xAB,0x40,0x2D,0x48,0xED,0x58,0xCF,0x58,0xAE,0x68,0xAE,0x68,
-	0xAC,0x58,0xAC,0x58,0x2B,0x50,0x4B,0x70,0xD4,0xA8,0x7E,0xE9,0x7E,0xE9,0x7A,0xD1,0x91,0x90,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x24,0x38,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,
-	0x24,0x30,0x23,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x23,0x30,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x24,0x28,0x24,0x20,0x24,0x28,0x24,0x28,0x24,0x20,0x23,0x20,0x24,0x20,0x22,0x18,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xA9,0x18,0xA9,0x10,0xA9,0x18,0x68,0x18,0xA8,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,
-	0xAB,0x30,0xAB,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xCC,0x40,0x2D,0x48,0xCC,0x40,0xCC,0x40,0xED,0x58,0x2D,0x58,0x10,0x69,0xAE,0x68,0xAE,0x68,0xAC,0x58,0x8A,0x50,0x2A,0x48,0x91,0x90,0x7A,0xD1,0x7E,0xE9,0x7E,0xE9,0xD4,0xA8,0x8E,0x80,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x27,0x50,
-	0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x23,0x30,0x24,0x28,0x24,0x28,0x23,0x20,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x20,
-	0x23,0x20,0x24,0x20,0x24,0x20,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x18,0xA9,0x10,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x10,0xA8,0x18,0x68,0x18,0xA9,0x18,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAB,0x28,0xAB,0x28,0xAB,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xCC,0x40,0x2D,0x48,0xCC,0x40,0xCC,0x40,0xAC,0x58,0xCC,0x40,0xCF,0x58,0xAE,0x68,0xF1,0x78,
-	0xAE,0x68,0xAC,0x58,0x2B,0x50,0xAC,0x58,0x2B,0x50,0xD4,0xA8,0x7A,0xD1,0x7E,0xE9,0x7A,0xD1,0x91,0x90,0x4B,0x70,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x27,0x50,0x49,0x60,0x27,0x50,0x26,0x48,0x25,0x40,0x26,0x48,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x30,
-	0x24,0x38,0x24,0x30,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x28,0x24,0x20,0x23,0x18,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xA9,0x18,0xA9,0x18,0xA9,0x10,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAB,0x28,
-	0xAB,0x30,0xAB,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0x2D,0x48,0xAC,0x58,0xAC,0x58,0xCF,0x58,0xF1,0x78,0xAE,0x68,0xAE,0x68,0xAC,0x58,0x2B,0x50,0x8A,0x50,0x4B,0x70,0xD4,0xA8,0x7A,0xD1,0x7E,0xE9,0xD4,0xA8,0x8E,0x80,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x4B,0x70,0x4B,0x70,
-	0x27,0x50,0x26,0x48,0x27,0x50,0x27,0x50,0x49,0x60,0x27,0x50,0x27,0x50,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x25,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x30,0x25,0x28,0x24,0x28,0x24,0x20,
-	0x24,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAA,0x10,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0x68,0x18,0xA9,0x18,0xA9,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAB,0x30,0xAB,0x30,0xAB,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xAB,0x38,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xAB,0x40,0xCC,0x40,0xAC,0x58,0xAC,0x58,0xAE,0x68,
-	0xAE,0x68,0xAE,0x68,0xAC,0x58,0x8A,0x50,0x8A,0x50,0x2B,0x50,0x91,0x90,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0x4B,0x70,0x49,0x60,0x4B,0x70,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x26,0x48,0x27,0x50,0x27,0x50,0x49,0x60,0x27,0x50,0x27,0x50,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x25,0x38,
-	0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x25,0x30,0x25,0x38,0x25,0x40,0x27,0x30,0x25,0x30,0x24,0x28,0x24,0x20,0x23,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xA9,0x18,0xAA,0x10,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x28,0xAB,0x28,
-	0xAA,0x28,0xAB,0x30,0xEC,0x38,0xCC,0x40,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xAB,0x40,0xCC,0x40,0xCC,0x40,0x2D,0x48,0xCC,0x40,0xAC,0x58,0xCF,0x58,0xAE,0x68,0xAE,0x68,0xAE,0x68,0xAC,0x58,0x2B,0x50,0x8A,0x50,0x49,0x60,0x91,0x90,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x91,0x90,0x4B,0x70,0x49,0x60,0x4B,0x70,0x4B,0x70,
-	0x4B,0x70,0x49,0x60,0x26,0x48,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x27,0x50,0x27,0x50,0x25,0x40,0x25,0x38,0x25,0x40,0x24,0x38,0x25,0x38,0x25,0x40,0x25,0x38,0x25,0x40,0x24,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x26,0x48,0x26,0x48,0x26,0x48,0x25,0x30,0x25,0x28,0x24,0x28,0x24,0x20,
-	0x24,0x20,0x25,0x28,0x24,0x20,0x24,0x18,0x23,0x18,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAA,0x10,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0x68,0x18,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xEC,0x38,0xCF,0x48,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xAB,0x38,0xCC,0x40,0xAB,0x40,0xCC,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAC,0x58,
-	0xAE,0x68,0xAE,0x68,0xAE,0x68,0xAC,0x58,0x8A,0x50,0x8A,0x50,0x29,0x40,0x4B,0x70,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0x8E,0x80,0x49,0x60,0x49,0x60,0x4B,0x70,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,
-	0x26,0x48,0x26,0x48,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x38,0x26,0x48,0x25,0x40,0x26,0x48,0x26,0x48,0x26,0x48,0x27,0x30,0x25,0x30,0x25,0x28,0x24,0x28,0x24,0x28,0x25,0x28,0x25,0x28,0x25,0x20,0x24,0x18,0x24,0x18,0x23,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x10,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,
-	0xAA,0x28,0xAB,0x30,0xAB,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xAB,0x40,0xCC,0x40,0xAB,0x40,0xCC,0x40,0xAB,0x40,0xAC,0x58,0xAE,0x68,0xAE,0x68,0xAC,0x58,0x2B,0x50,0x8A,0x50,0x29,0x40,0x8A,0x50,0x8E,0x80,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0x4B,0x70,0x49,0x60,0x49,0x60,
-	0x4B,0x70,0x4B,0x70,0x49,0x60,0x27,0x50,0x26,0x48,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x27,0x50,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x25,0x40,0x26,0x48,0x26,0x48,0x26,0x48,0x27,0x50,0x29,0x40,0x27,0x30,0x25,0x30,0x25,0x30,0x25,0x28,0x25,0x28,
-	0x25,0x28,0x25,0x28,0x25,0x20,0x25,0x20,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAA,0x10,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0x68,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x30,0xAA,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x40,0xAB,0x38,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,
-	0xAB,0x40,0xAC,0x58,0xAC,0x58,0xAE,0x68,0xAC,0x58,0x8A,0x50,0xA9,0x40,0x29,0x40,0x8A,0x50,0x8E,0x80,0xD4,0xA8,0x7A,0xD1,0xD4,0xA8,0x91,0x90,0x49,0x60,0x27,0x50,0x49,0x60,0x4B,0x70,0x4B,0x70,0x49,0x60,0x27,0x50,0x26,0x48,0x27,0x50,0x27,0x50,0x4B,0x70,0x49,0x60,0x27,0x50,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,
-	0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x27,0x50,0x29,0x40,0x27,0x50,0x26,0x48,0x27,0x30,0x27,0x30,0x25,0x30,0x25,0x28,0x25,0x28,0x26,0x28,0x25,0x28,0x25,0x20,0x24,0x18,0x25,0x18,0x24,0x18,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x28,
-	0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x30,0xAB,0x30,0xAA,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAC,0x58,0xAE,0x68,0xAC,0x58,0xAC,0x58,0x8A,0x50,0x29,0x40,0x29,0x40,0x49,0x60,0x91,0x90,0xD4,0xA8,0x7A,0xD1,0xD4,0xA8,0x8E,0x80,0x8A,0x50,
-	0x49,0x60,0x49,0x60,0x4B,0x70,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x27,0x50,0x49,0x60,0x49,0x60,0x49,0x60,0x27,0x50,0x26,0x48,0x26,0x48,0x26,0x48,0x27,0x50,0x26,0x48,0x27,0x50,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x29,0x40,0x49,0x60,0x49,0x60,0x29,0x40,0x27,0x30,0x25,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x26,0x28,0x25,0x28,0x25,0x20,0x25,0x20,0x25,0x18,0x25,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xCF,0x20,0xEA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA8,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x40,0xAB,0x38,0xAB,0x40,0xAB,0x38,0xAB,0x40,0xAB,0x40,
-	0xAB,0x40,0xAB,0x40,0x8A,0x50,0xAC,0x58,0xAC,0x58,0xAC,0x58,0x29,0x40,0xA9,0x40,0x26,0x48,0xA9,0x30,0x4B,0x70,0x91,0x90,0xD4,0xA8,0x7A,0xD1,0xD4,0xA8,0x4B,0x70,0x27,0x50,0x49,0x60,0x4B,0x70,0x4B,0x70,0x4B,0x70,0x49,0x60,0x27,0x50,0x26,0x48,0x27,0x50,0x49,0x60,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x50,
-	0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x50,0x26,0x48,0x27,0x50,0x49,0x60,0x2B,0x50,0x2B,0x50,0x26,0x48,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x20,0x25,0x20,0x25,0x20,0x25,0x18,0x25,0x18,0x24,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xEA,0x18,0xAA,0x10,0xEA,0x18,0xEC,0x20,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,
-	0xA9,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAB,0x38,0xAA,0x38,0xAA,0x38,0xAB,0x40,0xAA,0x38,0xAB,0x40,0xA9,0x40,0xAB,0x40,0xAB,0x40,0x8A,0x50,0xAC,0x58,0xAC,0x58,0x8A,0x50,0x29,0x40,0xA9,0x40,0x26,0x48,0x67,0x38,0x4B,0x70,0x91,0x90,0xD4,0xA8,0x7A,0xD1,0x91,0x90,
-	0x8E,0x80,0x27,0x50,0x49,0x60,0x4B,0x70,0x8E,0x80,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x49,0x60,0x4B,0x70,0x4B,0x70,0x4B,0x70,0x49,0x60,0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x50,0x29,0x40,0x27,0x50,0x29,0x40,0x49,0x60,0x4B,0x70,0x4B,0x70,0x2B,0x50,0x29,0x40,0x26,0x48,0x29,0x40,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x26,0x28,0x25,0x28,0x25,0x20,0x25,0x20,0x25,0x18,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA8,0x20,0x69,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,
-	0xAA,0x38,0x29,0x40,0xA9,0x40,0xA9,0x40,0x8A,0x50,0xAC,0x58,0x8A,0x50,0x8A,0x50,0x29,0x40,0x67,0x38,0x67,0x38,0x26,0x48,0x4B,0x70,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0x91,0x90,0x8E,0x80,0x49,0x60,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x4B,0x70,0x4B,0x70,0x49,0x60,0x27,0x50,0x49,0x60,0x4B,0x70,0x8E,0x80,0x4B,0x70,0x49,0x60,0x49,0x60,
-	0x27,0x50,0x8A,0x50,0x27,0x50,0x49,0x60,0x27,0x50,0x49,0x60,0x2B,0x50,0x4B,0x70,0x4B,0x70,0x49,0x60,0x29,0x40,0x2A,0x48,0x2B,0x50,0x29,0x40,0x29,0x40,0x27,0x30,0x26,0x28,0x26,0x20,0x26,0x20,0x25,0x20,0x25,0x18,0x25,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x22,0x00,0x22,0x00,0x23,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x18,0xAA,0x18,0xA9,0x20,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,
-	0xA9,0x20,0xA9,0x20,0x69,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0xA9,0x40,0xAA,0x38,0xA9,0x40,0xA9,0x40,0x29,0x40,0xAB,0x40,0x8A,0x50,0x8A,0x50,0xA9,0x40,0x67,0x38,0x67,0x38,0x67,0x38,0x8A,0x50,0x8E,0x80,0xD4,0xA8,0x7A,0xD1,
-	0x7A,0xD1,0xD4,0xA8,0x4B,0x70,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x49,0x60,0x49,0x60,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x49,0x60,0x49,0x60,0x49,0x60,0x2B,0x50,0x49,0x60,0x2B,0x50,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x2D,0x58,0x2B,0x50,0x2B,0x50,0x2B,0x50,0x29,0x40,0x29,0x40,0x27,0x30,
-	0x27,0x28,0x26,0x28,0x26,0x20,0x26,0x20,0x26,0x18,0x25,0x18,0x25,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xEA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xA9,0x30,0xAA,0x38,0x49,0x30,0xAA,0x38,0x49,0x30,
-	0x49,0x30,0xA9,0x40,0x49,0x30,0x49,0x30,0xA9,0x40,0xA9,0x40,0x8A,0x50,0x2A,0x48,0x29,0x40,0x29,0x40,0x29,0x40,0x26,0x48,0x67,0x38,0x8A,0x50,0x91,0x90,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0x8E,0x80,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x4B,0x70,0x49,0x60,0x4B,0x70,0x8E,0x80,0x91,0x90,0x8E,0x80,
-	0x8E,0x80,0x4B,0x70,0x4B,0x70,0x4B,0x70,0x49,0x60,0x4B,0x70,0x8E,0x80,0x91,0x90,0x8E,0x80,0x8E,0x80,0x2D,0x58,0x2B,0x50,0x2B,0x50,0x29,0x40,0x49,0x30,0x49,0x30,0x27,0x30,0x27,0x28,0x27,0x28,0x26,0x20,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xAB,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0x69,0x20,
-	0xA9,0x20,0xA9,0x20,0x69,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x30,0x69,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x49,0x30,0xA9,0x30,0x49,0x30,0x67,0x38,0x49,0x30,0xA9,0x40,0xA9,0x40,0x8A,0x50,0x8A,0x50,0xA9,0x40,0x29,0x40,0x29,0x40,0x27,0x50,0x4B,0x70,0xD4,0xA8,
-	0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0x8E,0x80,0x4B,0x70,0x8E,0x80,0x91,0x90,0x91,0x90,0x8E,0x80,0x8E,0x80,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x8E,0x80,0x91,0x90,0xD4,0xA8,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x91,0x90,0x91,0x90,0x91,0x90,0x31,0x70,0x2B,0x50,0x2B,0x50,0x2B,0x50,0x2A,0x48,0x29,0x40,0x49,0x30,
-	0x49,0x30,0x28,0x28,0x28,0x28,0x27,0x28,0x26,0x20,0x26,0x18,0x26,0x18,0x25,0x10,0x25,0x10,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xA9,0x18,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0x69,0x28,0xA9,0x28,0xA9,0x28,0x69,0x28,0xA8,0x28,0x69,0x28,0xA9,0x28,0x69,0x28,0xA9,0x30,0x69,0x28,0xA9,0x30,0x49,0x30,0xA9,0x30,
-	0x49,0x30,0xA9,0x30,0x49,0x30,0xA7,0x30,0x49,0x30,0x67,0x38,0x49,0x30,0xA9,0x40,0x8A,0x50,0x8A,0x50,0x8A,0x50,0x8A,0x50,0x8A,0x50,0xA9,0x40,0xA9,0x40,0x8E,0x80,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0x8E,0x80,0x4B,0x70,0x8E,0x80,0x91,0x90,0x91,0x90,0x91,0x90,0x8E,0x80,0x4B,0x70,0x4B,0x70,0x8E,0x80,0x91,0x90,
-	0xD4,0xA8,0xD4,0xA8,0x91,0x90,0x91,0x90,0x8E,0x80,0x8E,0x80,0x91,0x90,0xD4,0xA8,0x91,0x90,0x8E,0x80,0x2D,0x58,0x2D,0x58,0x2D,0x58,0x2B,0x50,0x2A,0x48,0x2A,0x48,0x49,0x30,0x49,0x30,0x28,0x28,0x28,0x28,0x27,0x20,0x26,0x18,0x26,0x18,0x26,0x10,0x25,0x10,0x25,0x10,0x25,0x08,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x25,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xA9,0x20,0xAA,0x18,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0x69,0x20,
-	0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x28,0x69,0x28,0xA9,0x28,0xA8,0x28,0xA9,0x28,0x68,0x28,0xA9,0x30,0xA8,0x28,0xA8,0x28,0x68,0x28,0x68,0x28,0xA9,0x30,0x68,0x28,0x49,0x30,0x67,0x28,0xA9,0x30,0x67,0x38,0x49,0x30,0x67,0x38,0xA9,0x40,0xA9,0x40,0x8A,0x50,0xAC,0x58,0xAC,0x58,0xAC,0x58,0x8A,0x50,0x8A,0x50,0x8A,0x50,0x8A,0x50,
-	0x8E,0x80,0x7A,0xD1,0x7A,0xD1,0x7E,0xE9,0x7A,0xD1,0xD4,0xA8,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x91,0x90,0xD4,0xA8,0x91,0x90,0x91,0x90,0x91,0x90,0x8E,0x80,0x8E,0x80,0xD4,0xA8,0xD4,0xA8,0xD4,0xA8,0x91,0x90,0x91,0x90,0x91,0x90,0x91,0x90,0xD4,0xA8,0x91,0x90,0x31,0x70,0xAE,0x68,0x2D,0x58,0x2D,0x58,0x2B,0x50,0x2A,0x48,0x2A,0x48,
-	0x2A,0x48,0x2B,0x30,0x49,0x30,0x2B,0x30,0x29,0x28,0x27,0x20,0x27,0x18,0x26,0x18,0x26,0x10,0x25,0x10,0x25,0x08,0x24,0x08,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,
-	0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xEA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xAA,0x28,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0x68,0x28,0xA9,0x28,0xA9,0x28,0x68,0x28,0xA8,0x28,0xAA,0x38,0xA9,0x30,0x68,0x28,0xA9,0x30,
-	0xA7,0x30,0xA9,0x30,0x49,0x30,0xA9,0x30,0x49,0x30,0xA9,0x30,0x49,0x30,0xA9,0x40,0xAB,0x40,0xAC,0x58,0xAE,0x68,0xAC,0x58,0xAC,0x58,0x8A,0x50,0x8A,0x50,0x8A,0x50,0x4B,0x70,0x91,0x90,0x7A,0xD1,0x7A,0xD1,0xBC,0xD2,0x7E,0xE9,0x7A,0xD1,0x8E,0x80,0x8E,0x80,0x91,0x90,0x91,0x90,0xD4,0xA8,0xD4,0xA8,0xD4,0xA8,0x91,0x90,0x91,0x90,
-	0x91,0x90,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0xD4,0xA8,0x38,0xA8,0xD4,0xA8,0xD4,0xA8,0xF1,0x78,0xAE,0x68,0xAE,0x68,0xAE,0x68,0x2D,0x58,0x2D,0x58,0x2D,0x48,0x2A,0x48,0x2B,0x30,0x2B,0x30,0x29,0x28,0x28,0x28,0x28,0x20,0x28,0x20,0x27,0x18,0x26,0x10,0x26,0x10,0x25,0x10,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,
-	0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x18,0xAA,0x18,0xED,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x28,
-	0xAA,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x20,0xA9,0x28,0x69,0x28,0xA9,0x28,0x68,0x28,0xA9,0x28,0xAA,0x30,0x68,0x28,0xAB,0x38,0xAA,0x38,0xA9,0x30,0x68,0x28,0x49,0x30,0xA7,0x30,0x49,0x30,0xA7,0x30,0xA9,0x30,0xA9,0x40,0xA9,0x40,0x29,0x40,0xA9,0x40,0x8A,0x50,0xAC,0x58,0xAE,0x68,0xAE,0x68,0xAE,0x68,0xAC,0x58,0xAC,0x58,
-	0x8A,0x50,0x4B,0x70,0x91,0x90,0x7A,0xD1,0x7E,0xE9,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x91,0x90,0x8E,0x80,0x91,0x90,0xD4,0xA8,0xD4,0xA8,0x77,0xB1,0xD4,0xA8,0xD4,0xA8,0xD4,0xA8,0xD4,0xA8,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7D,0xD0,0x77,0xB1,0x91,0x90,0x31,0x70,0x31,0x70,0x31,0x70,0xCF,0x58,0x2D,0x58,0xED,0x58,
-	0x2D,0x48,0x2D,0x48,0x2B,0x30,0x2B,0x30,0x29,0x28,0x29,0x28,0x28,0x20,0x27,0x18,0x27,0x18,0x26,0x10,0x26,0x10,0x25,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xAA,0x18,0xEB,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xAF,0x38,0xAF,0x38,0xA9,0x28,0xA9,0x20,0x69,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA8,0x28,0xA9,0x28,0xA8,0x28,0xA9,0x30,0x68,0x28,0xA9,0x30,
-	0xA9,0x30,0x49,0x30,0xA7,0x30,0xA9,0x30,0x49,0x30,0xA9,0x30,0xA9,0x40,0xAB,0x40,0xAB,0x40,0xAC,0x58,0xAC,0x58,0xAE,0x68,0xF1,0x78,0xAE,0x68,0xAE,0x68,0x4B,0x70,0xAE,0x68,0xAE,0x68,0x8E,0x80,0x77,0xB1,0x7A,0xD1,0xBC,0xD2,0x7E,0xE9,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0x91,0x90,0xD4,0xA8,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,
-	0xD4,0xA8,0xD4,0xA8,0xD4,0xA8,0x38,0xA8,0x7A,0xD1,0x7D,0xD0,0x7A,0xD1,0x7E,0xE9,0x7D,0xD0,0x38,0xA8,0xF1,0x78,0xF1,0x78,0xF1,0x78,0x30,0x60,0xCF,0x58,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x48,0xAB,0x38,0x2B,0x30,0x4B,0x28,0x29,0x28,0x29,0x20,0x27,0x18,0x27,0x18,0x26,0x10,0x26,0x10,0x26,0x08,0x24,0x08,0x24,0x08,0x24,0x08,
-	0x23,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x23,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xEC,0x28,0xEC,0x28,
-	0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0x69,0x28,0xA9,0x28,0xA9,0x28,0x69,0x28,0xA9,0x28,0x69,0x28,0xA9,0x28,0xA9,0x28,0x69,0x28,0xA8,0x28,0xA9,0x30,0x68,0x28,0xA9,0x30,0x49,0x30,0xA9,0x30,0xA9,0x40,0xA9,0x40,0xAB,0x40,0xAB,0x40,0x8A,0x50,0xAB,0x40,0xAC,0x58,0xAE,0x68,0xAE,0x68,0xF1,0x78,0xF1,0x78,0x53,0x89,
-	0xF1,0x78,0x8E,0x80,0xF1,0x78,0x8E,0x80,0x77,0xB1,0x7E,0xE9,0xBC,0xD2,0xBC,0xD2,0x7E,0xE9,0x7A,0xD1,0xD4,0xA8,0xD4,0xA8,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7E,0xE9,0x7A,0xD1,0x7E,0xE9,0x7A,0xD1,0x36,0x88,0x91,0x90,0x34,0x70,0xF1,0x78,0x30,0x60,0x30,0x60,
-	0xCF,0x58,0xCF,0x48,0x2D,0x48,0x4D,0x30,0x4D,0x30,0x2B,0x30,0x29,0x28,0x29,0x20,0x28,0x20,0x28,0x10,0x26,0x10,0x26,0x10,0x25,0x08,0x26,0x08,0x25,0x08,0x24,0x08,0x24,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA8,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x30,0x69,0x28,0xA9,0x30,0xA9,0x30,0x68,0x28,
-	0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xAA,0x38,0xAA,0x38,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAC,0x58,0xAC,0x58,0xAC,0x58,0xAE,0x68,0xF1,0x78,0x91,0x90,0x53,0x89,0x91,0x90,0x53,0x89,0xF1,0x78,0x91,0x90,0x91,0x90,0x77,0xB1,0x7E,0xE9,0x7E,0xE9,0xBC,0xD2,0xBC,0xD2,0x7E,0xE9,0x7A,0xD1,0xD4,0xA8,0xD4,0xA8,0x7A,0xD1,0x7A,0xD1,
-	0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7E,0xE9,0xBC,0xD2,0x7E,0xE9,0x7A,0xD1,0x77,0xB1,0x34,0x70,0xF1,0x78,0x33,0x69,0x10,0x69,0x30,0x60,0x30,0x60,0xCF,0x48,0x2F,0x48,0x4D,0x30,0x4D,0x30,0xAB,0x28,0x29,0x28,0x29,0x20,0x27,0x18,0x27,0x18,0x26,0x10,0x26,0x10,0x26,0x10,0x25,0x08,0x25,0x08,
-	0x24,0x08,0x24,0x00,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,
-	0xAA,0x20,0xAA,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x20,0x69,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0x49,0x30,0xA8,0x28,0xA9,0x30,0xAA,0x38,0xA9,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAC,0x58,0xCC,0x40,0xAC,0x58,0xED,0x58,0xAE,0x68,0xF1,0x78,0x53,0x89,0xD4,0xA8,
-	0x95,0x91,0x91,0x90,0x91,0x90,0x53,0x89,0x8E,0x80,0x91,0x90,0x77,0xB1,0x7E,0xE9,0x7E,0xE9,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0x7A,0xD1,0x77,0xB1,0x77,0xB1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0xBC,0xD2,0x7A,0xD1,0x7A,0xD1,0x77,0xB1,0x36,0x88,0x34,0x70,0x33,0x69,
-	0x92,0x50,0x92,0x50,0xCF,0x58,0xCF,0x48,0x2F,0x48,0x4D,0x30,0x4D,0x30,0x4B,0x28,0x29,0x20,0x29,0x20,0x27,0x18,0x27,0x18,0x28,0x10,0x26,0x10,0x26,0x10,0x25,0x08,0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,
-	0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x08,0x25,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEB,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0x69,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x30,0xA9,0x28,
-	0xA9,0x30,0xA9,0x30,0xA9,0x30,0xAA,0x38,0xAA,0x38,0xAB,0x40,0xAB,0x40,0xAC,0x58,0xAB,0x40,0xAC,0x58,0xED,0x58,0xED,0x58,0xAC,0x58,0xF1,0x78,0x53,0x89,0xD4,0xA8,0x77,0xB1,0xD4,0xA8,0x95,0x91,0x91,0x90,0x53,0x89,0x53,0x89,0x91,0x90,0x77,0xB1,0x7E,0xE9,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0x7A,0xD1,0x7A,0xD1,0x77,0xB1,
-	0x7A,0xD1,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7E,0xE9,0x7A,0xD1,0xDE,0xA9,0x77,0xB1,0x5B,0x88,0x34,0x70,0x33,0x69,0x92,0x50,0x92,0x50,0x92,0x50,0x92,0x50,0xCF,0x48,0x4D,0x30,0xAB,0x30,0x4B,0x28,0x69,0x20,0x68,0x18,0x27,0x18,0x68,0x18,0x27,0x18,0x26,0x10,0x26,0x10,
-	0x25,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
-	0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x48,0x00,0x48,0x00,0x26,0x08,0x24,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x18,0xAA,0x18,0xEB,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,
-	0xA9,0x20,0xAA,0x28,0xA9,0x20,0xAA,0x28,0xAA,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xA9,0x30,0xAA,0x30,0xAA,0x38,0xAA,0x38,0xAB,0x40,0xAB,0x40,0xCC,0x40,0xCC,0x40,0xCF,0x58,0xCF,0x58,0xED,0x58,0xED,0x58,0xAE,0x68,0xAE,0x68,0x53,0x89,0x53,0x89,
-	0xD4,0xA8,0xD7,0x99,0x77,0xB1,0xD4,0xA8,0x53,0x89,0x91,0x90,0x53,0x89,0xF1,0x78,0xD4,0xA8,0x7E,0xE9,0x7E,0xE9,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x98,0xB2,0xBC,0xD2,0xBC,0xD2,0x7A,0xD1,0xBC,0xD2,0x7A,0xD1,0xBC,0xD2,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x77,0xB1,0x5B,0x88,
-	0x75,0x79,0x34,0x70,0x92,0x50,0x92,0x50,0xCF,0x48,0xCF,0x48,0xAF,0x38,0x4D,0x30,0x4D,0x30,0x4B,0x28,0x69,0x20,0x28,0x20,0x68,0x18,0x68,0x18,0x27,0x18,0x26,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x21,0x08,
-	0x21,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x26,0x08,0x26,0x08,0x26,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
-	0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x48,0x00,0x48,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAB,0x10,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xAB,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAB,0x28,0xEB,0x30,0xCF,0x48,0xEC,0x38,0xEB,0x30,0xEC,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,
-	0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x40,0xAB,0x38,0xAB,0x40,0xCC,0x40,0xAC,0x58,0x2F,0x61,0x10,0x69,0xED,0x58,0xCF,0x58,0xCF,0x58,0x2F,0x61,0xF1,0x78,0x53,0x89,0x95,0x91,0xD4,0xA8,0x77,0xB1,0x35,0xA2,0xD4,0xA8,0x53,0x89,0x53,0x89,0x8E,0x80,0xF1,0x78,0xD4,0xA8,0xBC,0xD2,0xBC,0xD2,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,
-	0xBC,0xD2,0x98,0xB2,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0x98,0xB2,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0xBC,0xD2,0x7A,0xD1,0xBC,0xD2,0x7A,0xD1,0xDE,0xA9,0x7A,0xD1,0xDE,0xA9,0xD7,0x99,0x5B,0x88,0x75,0x79,0x92,0x50,0x92,0x50,0xCF,0x48,0xAF,0x38,0x4D,0x30,0xAB,0x30,0xAB,0x30,0xAA,0x28,0x69,0x20,0x68,0x20,0x68,0x20,0x67,0x18,0x26,0x18,
-	0x26,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x23,0x00,0x24,0x00,
-	0x24,0x00,0x25,0x08,0x25,0x00,0x26,0x08,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x08,0x4A,0x00,0x48,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x18,0xAA,0x18,0xED,0x18,0xEB,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,
-	0xAA,0x20,0xA9,0x20,0xAA,0x28,0xAB,0x28,0xAB,0x28,0xEB,0x30,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xAB,0x38,0xEB,0x30,0xAB,0x38,0xEB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xED,0x58,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xED,0x58,0xED,0x58,0xCF,0x58,0xAE,0x68,0xCF,0x58,0xAE,0x68,0xF1,0x78,0x53,0x89,
-	0x53,0x89,0x95,0x91,0xD4,0xA8,0x77,0xB1,0xD7,0x99,0xD4,0xA8,0x53,0x89,0xF1,0x78,0x53,0x89,0xF1,0x78,0xD4,0xA8,0x7E,0xE9,0xBC,0xD2,0xFC,0xCB,0xF8,0xC5,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,0x98,0xB2,0x7A,0xD1,0x98,0xB2,0xBC,0xD2,0x98,0xB2,0xBC,0xD2,0x98,0xB2,0xBC,0xD2,0xBC,0xD2,0x98,0xB2,0x77,0xB1,0x77,0xB1,0xD7,0x99,0x77,0xB1,
-	0x77,0xB1,0xD7,0x99,0x5B,0x88,0x75,0x79,0xD5,0x50,0x92,0x50,0xCF,0x48,0xCF,0x48,0xAF,0x38,0x4D,0x30,0xAB,0x30,0x4B,0x28,0x69,0x20,0x68,0x20,0x67,0x18,0x66,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x23,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x25,0x00,0x26,0x08,0x26,0x08,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x08,0x25,0x00,0x26,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,
-	0x24,0x00,0x24,0x00,0x25,0x00,0x48,0x00,0x4A,0x00,0x48,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEA,0x10,0xAA,0x18,0xED,0x18,0xED,0x18,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xAB,0x28,0xEC,0x28,0xEC,0x28,0xEC,0x38,0xEC,0x28,0xAB,0x28,0xAB,0x30,0xAB,0x28,0xAA,0x28,0xAA,0x30,0xAA,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,
-	0xAA,0x38,0xCC,0x40,0xCC,0x40,0xCF,0x48,0xCF,0x58,0xCF,0x58,0xCF,0x58,0xCF,0x58,0xED,0x58,0xCF,0x58,0xCF,0x58,0xCF,0x58,0x10,0x69,0x10,0x69,0x10,0x69,0x53,0x89,0x53,0x89,0x53,0x89,0x95,0x91,0x95,0x91,0x77,0xB1,0xD4,0xA8,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0xD4,0xA8,0x7A,0xD1,0xBC,0xD2,0xFC,0xCB,0xF8,0xC5,
-	0xF8,0xC5,0xF8,0xC5,0xFC,0xCB,0xBC,0xD2,0x98,0xB2,0x98,0xB2,0xBC,0xD2,0x98,0xB2,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,0x77,0xB1,0x77,0xB1,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xD7,0x99,0x95,0x91,0x75,0x79,0x92,0x50,0x92,0x50,0xCF,0x48,0xAF,0x38,0x4D,0x30,0xAB,0x30,0xAA,0x28,0x69,0x20,0x68,0x20,0x67,0x18,
-	0x26,0x18,0x65,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x22,0x00,0x21,0x08,0x22,0x00,0x21,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x24,0x00,0x24,0x08,0x25,0x08,0x25,0x08,
-	0x26,0x08,0x26,0x08,0x25,0x00,0x25,0x08,0x25,0x00,0x25,0x00,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x25,0x08,0x24,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x08,0x48,0x00,0x4A,0x00,0x48,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x18,0xEA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xEA,0x20,0xAA,0x18,0xAA,0x20,0xAA,0x20,0xEA,0x20,0xAB,0x20,
-	0xAB,0x28,0xEC,0x28,0xEC,0x38,0xEC,0x28,0xAB,0x28,0xAB,0x28,0xAA,0x28,0xAA,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xCC,0x40,0xCC,0x40,0xCF,0x58,0x30,0x59,0x30,0x59,0xCF,0x58,0xCF,0x58,0xCF,0x58,0xCF,0x58,0xCF,0x58,0x2F,0x61,0x10,0x69,0x10,0x69,0xF1,0x78,
-	0xF1,0x78,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x95,0x91,0x95,0x91,0xD4,0xA8,0x53,0x89,0x53,0x89,0x53,0x89,0x53,0x89,0x35,0xA2,0x7A,0xD1,0xBC,0xD2,0xFC,0xCB,0xF8,0xC5,0xDF,0xD6,0xF8,0xC5,0xF8,0xC5,0xFC,0xCB,0xBC,0xD2,0x96,0xAB,0xFC,0xCB,0xFC,0xCB,0xF8,0xC5,0xFC,0xCB,0xF8,0xC5,0xFC,0xCB,0xFC,0xCB,0xBC,0xD2,0x98,0xB2,
-	0x77,0xB1,0x77,0xB1,0xD7,0x99,0xD7,0x99,0xD7,0x99,0x95,0x91,0x75,0x79,0x33,0x69,0x92,0x50,0xCF,0x48,0xAF,0x38,0xAB,0x30,0xAA,0x28,0x69,0x28,0x68,0x20,0x67,0x20,0x66,0x18,0x25,0x18,0x25,0x10,0x64,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x23,0x10,0x23,0x10,0x23,0x08,0x23,0x10,0x23,0x10,0x23,0x10,
-	0x24,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x00,0x21,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x00,
-	0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x24,0x08,0x24,0x00,0x24,0x00,0x25,0x08,0x25,0x08,0x25,0x00,0x26,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,
-	0x48,0x00,0x4C,0x00,0x4A,0x00,0x26,0x08,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xEB,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x20,0xA9,0x18,0xAA,0x20,0xA9,0x18,0xEC,0x28,0xAF,0x38,0xEC,0x28,0xEC,0x28,0xEC,0x28,0xAB,0x28,0xAA,0x28,0xAA,0x28,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xAA,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,
-	0xAA,0x30,0xAA,0x30,0xAA,0x38,0xCC,0x40,0xCC,0x40,0xCF,0x58,0x10,0x69,0x10,0x69,0x33,0x69,0xCF,0x58,0xCF,0x58,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0xF1,0x78,0xF1,0x78,0x53,0x89,0xD4,0xA8,0xD7,0x99,0x77,0xB1,0x95,0x91,0xD4,0xA8,0x95,0x91,0x95,0x91,0xD4,0xA8,0x77,0xB1,0xBC,0xD2,
-	0xFC,0xCB,0xFC,0xCB,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xFC,0xCB,0xF6,0xAC,0xFC,0xCB,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xFC,0xCB,0xFC,0xCB,0x98,0xB2,0x98,0xB2,0x98,0xB2,0xD7,0x99,0xD7,0x99,0x95,0x91,0x95,0x91,0x75,0x79,0x75,0x79,0x33,0x69,0xCF,0x48,0xAF,0x38,0xAB,0x38,0xAA,0x28,0x69,0x28,0x68,0x20,
-	0x67,0x18,0x66,0x18,0x66,0x18,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x25,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x00,0x25,0x08,0x25,0x00,
-	0x25,0x08,0x25,0x00,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x25,0x08,0x26,0x08,0x2C,0x18,0x2C,0x18,0x4A,0x00,0x26,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x18,0xEA,0x10,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xEA,0x20,0xAA,0x18,0xAB,0x20,0xEC,0x28,0xEC,0x28,
-	0xCF,0x20,0xEC,0x28,0xAB,0x28,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x28,0xA9,0x28,0xA9,0x20,0xAA,0x28,0xAA,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAB,0x30,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xAB,0x38,0xAB,0x38,0xEC,0x38,0xCC,0x40,0xCF,0x58,0x10,0x69,0x33,0x69,0x10,0x69,0x10,0x69,0xCF,0x58,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,
-	0xF1,0x78,0x10,0x69,0xF1,0x78,0x10,0x69,0xF1,0x78,0xF1,0x78,0x95,0x91,0xD7,0x99,0x77,0xB1,0x77,0xB1,0xD7,0x99,0x77,0xB1,0x95,0x91,0x95,0x91,0x77,0xB1,0x77,0xB1,0x98,0xB2,0xFC,0xCB,0xF8,0xC5,0xF8,0xC5,0xDF,0xD6,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,
-	0xFC,0xCB,0xFC,0xCB,0x98,0xB2,0xD7,0x99,0xD7,0x99,0x95,0x91,0x95,0x91,0x75,0x79,0x75,0x79,0x33,0x69,0x33,0x69,0x92,0x50,0xCF,0x48,0xAB,0x38,0xAA,0x28,0x69,0x28,0x67,0x20,0x67,0x18,0x66,0x18,0x65,0x18,0x25,0x18,0x66,0x18,0x25,0x18,0x25,0x18,0x25,0x10,0x25,0x18,0x24,0x10,0x24,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,
-	0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,
-	0x24,0x08,0x24,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x26,0x08,0x26,0x08,0x28,0x10,0x26,0x08,0x26,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x25,0x08,0x25,0x00,0x26,0x08,0x26,0x08,0x28,0x10,0x26,0x08,0x26,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x25,0x08,0x48,0x00,0x2C,0x18,0x30,0x20,0x30,0x20,
-	0x48,0x00,0x25,0x08,0x24,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xEB,0x18,0xEA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xEC,0x20,0xEC,0x28,0xEC,0x28,0xAB,0x28,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xAA,0x28,0xA9,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x28,0xEB,0x30,0xEB,0x30,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xEC,0x38,0xA9,0x28,
-	0xAA,0x30,0xAA,0x30,0xAA,0x38,0xEB,0x38,0xAB,0x38,0xCC,0x40,0xCF,0x48,0xCF,0x58,0x10,0x69,0x33,0x69,0x33,0x69,0x10,0x69,0xCF,0x58,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0xF1,0x78,0xF1,0x78,0x75,0x79,0xD7,0x99,0x77,0xB1,0x77,0xB1,0x77,0xB1,0x77,0xB1,0xD7,0x99,0xD7,0x99,0xD7,0x99,
-	0x77,0xB1,0x98,0xB2,0xFC,0xCB,0xFC,0xCB,0xF8,0xC5,0xF8,0xC5,0xDF,0xD6,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xFC,0xCB,0x98,0xB2,0x98,0xB2,0xD7,0x99,0x95,0x91,0x75,0x79,0x75,0x79,0x33,0x69,0x33,0x69,0x30,0x59,0x92,0x50,0xCF,0x48,0xEC,0x38,0xAB,0x30,
-	0x69,0x28,0x68,0x20,0x67,0x20,0x67,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x65,0x18,0x25,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x20,0x26,0x20,0x25,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x25,0x10,0x25,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x26,0x08,0x26,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x08,
-	0x26,0x08,0x26,0x08,0x26,0x08,0x28,0x10,0x48,0x00,0x26,0x08,0x26,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x48,0x00,0x30,0x20,0x34,0x30,0x34,0x30,0x4C,0x00,0x25,0x00,0x25,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x18,0xEA,0x18,0xAA,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xEC,0x20,0xCF,0x20,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xEC,0x20,0xCF,0x20,0xCF,0x20,0xEC,0x28,
-	0xEA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xAA,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xEB,0x38,0xAB,0x38,0xEB,0x38,0xCC,0x40,0xCC,0x40,0xCF,0x48,0x30,0x59,0x33,0x69,0x33,0x69,0x33,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,
-	0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x2F,0x61,0x10,0x69,0xF1,0x78,0x53,0x89,0x95,0x91,0xD7,0x99,0x77,0xB1,0xDE,0xA9,0x77,0xB1,0x77,0xB1,0x77,0xB1,0xD7,0x99,0xD7,0x99,0x77,0xB1,0x35,0xA2,0xFC,0xCB,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,
-	0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF6,0xAC,0x96,0xAB,0x98,0xB2,0xD7,0x99,0x75,0x79,0x33,0x69,0x33,0x69,0x33,0x69,0x30,0x59,0x30,0x59,0xCF,0x48,0xCF,0x48,0xEC,0x38,0xAB,0x30,0xAB,0x30,0xA9,0x28,0x68,0x28,0x68,0x20,0x67,0x20,0x67,0x20,0x66,0x18,0x26,0x20,0x66,0x20,0x67,0x20,0x67,0x20,0x67,0x20,0x27,0x20,0x26,0x18,0x25,0x18,
-	0x24,0x18,0x24,0x18,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x25,0x10,0x25,0x10,0x26,0x10,0x26,0x10,
-	0x28,0x10,0x28,0x10,0x28,0x10,0x29,0x20,0x29,0x20,0x29,0x20,0x29,0x20,0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x28,0x10,0x48,0x00,0x28,0x10,0x4A,0x18,0x28,0x10,0x4A,0x18,0x4A,0x18,0x28,0x10,0x28,0x10,0x26,0x08,0x26,0x08,0x48,0x00,0x2C,0x18,0x30,0x20,0x34,0x30,0x34,0x30,0x30,0x20,0x4A,0x00,0x25,0x00,0x24,0x08,
-	0x23,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAA,0x10,0xAA,0x18,0xEB,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x20,0xAA,0x18,0xAB,0x20,0xEC,0x20,0xAF,0x38,0xEC,0x28,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,
-	0xAA,0x30,0xAA,0x30,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xCC,0x40,0xCC,0x40,0xCC,0x40,0x2E,0x49,0x10,0x69,0x33,0x69,0x75,0x79,0x10,0x69,0x30,0x59,0x52,0x79,0x75,0x79,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0xAE,0x68,0x10,0x69,0x10,0x69,0x33,0x69,0x52,0x79,0x95,0x91,0xD7,0x99,0x77,0xB1,0x77,0xB1,0x77,0xB1,0x77,0xB1,0xD7,0x99,
-	0xD7,0x99,0x95,0x91,0x35,0xA2,0x35,0xA2,0x98,0xB2,0xFC,0xCB,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0x35,0xA2,0x95,0x91,0x75,0x79,0x33,0x69,0x33,0x69,0x30,0x59,0xCF,0x48,0xCF,0x48,0xEC,0x38,
-	0xCC,0x40,0xEC,0x38,0xAB,0x38,0xAB,0x30,0xAB,0x30,0xAA,0x30,0x69,0x28,0xAA,0x30,0x69,0x28,0xAA,0x30,0x69,0x28,0x69,0x28,0x69,0x28,0x28,0x28,0x26,0x20,0x25,0x18,0x25,0x18,0x25,0x18,0x24,0x18,0x24,0x18,0x24,0x10,0x24,0x10,0x24,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,
-	0x23,0x08,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x23,0x10,0x23,0x10,0x24,0x10,0x24,0x10,0x25,0x10,0x26,0x10,0x26,0x18,0x26,0x10,0x28,0x20,0x27,0x18,0x27,0x18,0x29,0x20,0x29,0x20,0x29,0x20,0x29,0x20,0x29,0x20,0x28,0x10,0x29,0x20,0x29,0x20,0x4A,0x18,0x4A,0x18,0x4A,0x18,0x4A,0x18,0x2C,0x18,0x2C,0x18,0x2C,0x18,0x2C,0x18,
-	0x2C,0x18,0x4A,0x18,0x4A,0x18,0x48,0x00,0x4A,0x18,0x4A,0x18,0x2C,0x18,0x34,0x30,0x34,0x30,0x39,0x58,0x34,0x30,0x6E,0x00,0x48,0x00,0x25,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x10,0xAA,0x18,0xAA,0x10,0xEB,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x20,0xEC,0x20,0xEC,0x28,0xEC,0x20,0xEC,0x20,0xAA,0x20,
-	0xA9,0x20,0xEC,0x20,0xEC,0x28,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xEB,0x38,0xAB,0x38,0xEC,0x38,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCF,0x58,0x10,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0x10,0x69,0x10,0x69,
-	0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0xF1,0x78,0x33,0x69,0x75,0x79,0x95,0x91,0xD7,0x99,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x77,0xB1,0x35,0xA2,0xD7,0x99,0x35,0xA2,0x98,0xB2,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,
-	0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0x35,0xA2,0xD3,0x89,0x75,0x79,0x71,0x61,0x30,0x59,0xCF,0x48,0xCC,0x40,0xEC,0x38,0xEC,0x38,0xAB,0x38,0xAB,0x38,0xEC,0x38,0xEC,0x38,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0x2B,0x30,0xAA,0x30,0x28,0x28,0x27,0x20,0x26,0x20,
-	0x26,0x20,0x26,0x20,0x25,0x18,0x24,0x18,0x25,0x18,0x25,0x20,0x25,0x18,0x24,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x24,0x10,0x23,0x10,0x24,0x10,0x24,0x10,0x25,0x18,0x25,0x10,0x26,0x18,0x26,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x29,0x20,0x28,0x20,0x29,0x20,
-	0x29,0x20,0x29,0x20,0x29,0x20,0x28,0x10,0x29,0x20,0x4A,0x18,0x4A,0x18,0x4A,0x18,0x2C,0x18,0x2F,0x28,0x2F,0x28,0x30,0x20,0x30,0x20,0x30,0x20,0x2F,0x28,0x2F,0x28,0x2C,0x18,0x2C,0x18,0x4A,0x18,0x2C,0x18,0x30,0x20,0x34,0x30,0x39,0x58,0x39,0x58,0x39,0x58,0x30,0x20,0x48,0x00,0x26,0x08,0x24,0x08,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xEA,0x10,0xAA,0x18,0xED,0x18,0xEB,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xEB,0x18,0xEC,0x28,0xAD,0x20,0xAB,0x20,0xAA,0x20,0xA9,0x18,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,
-	0xA9,0x28,0xAA,0x30,0xAA,0x30,0xAB,0x30,0xEB,0x38,0xAB,0x38,0xEC,0x38,0xCC,0x40,0xCC,0x40,0xCF,0x48,0x30,0x59,0x33,0x69,0x33,0x69,0x33,0x69,0x30,0x59,0x10,0x69,0x30,0x59,0x10,0x69,0xCF,0x58,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x52,0x79,0x52,0x79,0x75,0x79,0x75,0x79,0x95,0x91,0xD7,0x99,0x77,0xB1,0x98,0xB2,0x98,0xB2,
-	0x98,0xB2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x98,0xB2,0x96,0xAB,0x98,0xB2,0xF6,0xAC,0xF6,0xAC,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0x35,0xA2,0xD3,0x89,0x75,0x79,0x33,0x69,0x30,0x59,
-	0xCF,0x48,0xCF,0x48,0xEC,0x38,0xEC,0x38,0xCC,0x40,0xCC,0x40,0xCF,0x48,0xCF,0x48,0xCF,0x48,0xCF,0x48,0xCC,0x40,0xAB,0x38,0x2B,0x30,0x69,0x28,0x49,0x30,0x69,0x28,0x28,0x28,0x27,0x28,0x27,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x25,0x20,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x20,0x25,0x18,0x25,0x18,0x25,0x18,
-	0x25,0x18,0x25,0x18,0x24,0x18,0x25,0x18,0x25,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x27,0x20,0x27,0x20,0x27,0x18,0x28,0x20,0x27,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x28,0x10,0x29,0x20,0x29,0x20,0x4A,0x18,0x4C,0x28,0x2F,0x28,0x2F,0x28,0x30,0x38,0x34,0x30,0x34,0x30,0x34,0x30,0x34,0x30,0x30,0x20,0x30,0x20,0x2F,0x28,
-	0x2C,0x18,0x30,0x20,0x34,0x30,0x34,0x30,0x39,0x58,0x39,0x58,0x39,0x58,0x30,0x20,0x4A,0x00,0x26,0x08,0x25,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x10,0xAA,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xEA,0x18,0xAA,0x18,0xEC,0x20,0xAD,0x20,0xEC,0x20,0xEA,0x20,0xAA,0x20,0xA9,0x18,
-	0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xAB,0x30,0xAB,0x38,0xEC,0x38,0xCC,0x40,0x2E,0x49,0xCC,0x40,0x2E,0x49,0x30,0x59,0x33,0x69,0x33,0x69,0x10,0x69,0x30,0x59,
-	0x30,0x59,0x30,0x59,0x30,0x59,0xCF,0x58,0xCF,0x58,0xCF,0x58,0x10,0x69,0x10,0x69,0x33,0x69,0x33,0x69,0x33,0x69,0x75,0x79,0x95,0x91,0xD7,0x99,0xD7,0x99,0x35,0xA2,0x98,0xB2,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x96,0xAB,0x35,0xA2,0x96,0xAB,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF6,0xAC,
-	0xF8,0xC5,0xF6,0xAC,0xF8,0xC5,0xF6,0xAC,0xF8,0xC5,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0x35,0xA2,0x53,0x8A,0xD3,0x89,0x52,0x79,0x33,0x69,0x30,0x59,0xCF,0x58,0xCF,0x48,0xCF,0x48,0xCF,0x48,0xCF,0x48,0xCC,0x40,0xCC,0x40,0xCC,0x40,0x2D,0x48,0xAB,0x38,0xAA,0x38,0x2B,0x30,0x2B,0x30,0x49,0x30,
-	0x49,0x30,0x29,0x28,0x28,0x28,0x28,0x28,0x27,0x28,0x27,0x28,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x26,0x18,0x26,0x18,0x27,0x20,0x27,0x18,0x27,0x18,0x27,0x18,0x26,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x28,0x20,
-	0x29,0x20,0x4B,0x28,0x4B,0x28,0x4C,0x28,0x2F,0x28,0x30,0x38,0x30,0x38,0x34,0x30,0x34,0x30,0x34,0x30,0x34,0x30,0x30,0x38,0x30,0x38,0x30,0x20,0x30,0x20,0x34,0x30,0x34,0x30,0x39,0x58,0x39,0x58,0x39,0x58,0x39,0x58,0x30,0x20,0x4C,0x00,0x26,0x08,0x25,0x00,0x24,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x18,0xAA,0x10,0xEA,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xEC,0x20,0xAD,0x20,0xEC,0x20,0xAA,0x20,0xA9,0x18,0xA9,0x20,0xAA,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA8,0x20,
-	0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xEA,0x30,0xEB,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xCC,0x40,0x2E,0x49,0xCF,0x58,0x33,0x69,0x33,0x69,0x30,0x59,0x30,0x59,0xCF,0x58,0xCF,0x58,0x30,0x59,0x30,0x59,0xCF,0x58,0x30,0x59,0x10,0x69,0x10,0x69,0x10,0x69,0x33,0x69,0x52,0x79,0x75,0x79,0x75,0x79,0x75,0x79,0x95,0x91,0x35,0xA2,
-	0x35,0xA2,0x35,0xA2,0xD4,0x9A,0x98,0xB2,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF8,0xC5,0xF6,0xAC,0xF8,0xC5,0xF6,0xAC,0xF8,0xC5,0xF6,0xAC,0xF8,0xC5,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0xD4,0x9A,
-	0x53,0x8A,0x75,0x79,0x33,0x69,0x71,0x61,0x10,0x69,0x30,0x59,0xCF,0x58,0xCC,0x40,0xCC,0x40,0xAB,0x38,0xAA,0x30,0x2B,0x30,0x69,0x28,0x49,0x30,0x69,0x28,0x49,0x30,0x29,0x28,0x49,0x30,0x28,0x28,0x28,0x28,0x27,0x28,0x27,0x28,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x18,0x25,0x18,0x25,0x18,
-	0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x10,0x25,0x18,0x25,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x27,0x18,0x28,0x20,0x28,0x20,0x29,0x20,0x4B,0x28,0x4B,0x28,0x2F,0x28,0x2F,0x28,0x30,0x38,0x34,0x30,0x34,0x30,0x34,0x30,0x34,0x30,0x34,0x30,0x34,0x30,0x30,0x38,0x34,0x30,0x34,0x30,0x34,0x30,0x39,0x58,0x39,0x58,
-	0x39,0x58,0x5B,0x88,0x39,0x58,0x34,0x30,0x2C,0x18,0x28,0x10,0x26,0x08,0x25,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x10,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xA9,0x18,0xEB,0x18,0xEC,0x20,0xEC,0x20,0xAB,0x20,0xA9,0x18,0xAA,0x18,0xA9,0x20,
-	0xA9,0x18,0xA9,0x20,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x28,0xA8,0x20,0xA9,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xCC,0x40,0xCC,0x40,0xEB,0x38,0xEC,0x38,0xCC,0x40,0xCC,0x40,0x2E,0x49,0x30,0x59,0x33,0x69,0x30,0x59,0x30,0x59,
-	0xCF,0x58,0x30,0x59,0xCF,0x58,0xCF,0x58,0xCF,0x58,0xCF,0x58,0x30,0x59,0x30,0x59,0x71,0x61,0x33,0x69,0x33,0x69,0x75,0x79,0x75,0x79,0x75,0x79,0xD3,0x89,0x95,0x91,0x53,0x8A,0x35,0xA2,0xD4,0x9A,0xD4,0x9A,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF8,0xC5,0xF6,0xAC,
-	0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF8,0xC5,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0xD4,0x9A,0xD4,0x9A,0x95,0x91,0x75,0x79,0x71,0x61,0x10,0x69,0xCF,0x58,0xCC,0x40,0x2D,0x48,0xAB,0x38,0xAA,0x38,0xAB,0x38,0x2B,0x30,0x2B,0x30,0x2B,0x30,
-	0x49,0x30,0x28,0x28,0x27,0x28,0x27,0x28,0x27,0x20,0x27,0x28,0x27,0x28,0x26,0x20,0x26,0x20,0x26,0x20,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x24,0x18,0x25,0x18,0x25,0x18,0x26,0x18,0x26,0x18,0x27,0x20,0x27,0x20,0x28,0x20,0x28,0x20,0x29,0x28,0x4B,0x28,0x4B,0x28,0x4D,0x30,0x2F,0x28,
-	0x30,0x38,0x30,0x38,0x30,0x38,0x30,0x38,0x30,0x38,0x30,0x38,0x30,0x38,0x30,0x38,0x30,0x38,0x34,0x30,0x34,0x30,0x39,0x58,0x39,0x58,0x39,0x58,0x5B,0x88,0x5B,0x88,0x36,0x88,0x34,0x30,0x2C,0x18,0x28,0x10,0x28,0x10,0x25,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEA,0x10,0xAA,0x10,0xAA,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xAA,0x18,0xEC,0x20,0xAD,0x20,0xEC,0x20,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x18,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x28,0xA8,0x20,0xA8,0x20,0xA9,0x20,0xA8,0x20,0xA8,0x20,
-	0xA8,0x20,0xA8,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAB,0x30,0xEB,0x30,0xEB,0x38,0xAB,0x38,0xEC,0x38,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x33,0x69,0x30,0x59,0xCF,0x58,0x2E,0x49,0xCF,0x58,0x30,0x59,0xCF,0x58,0x30,0x59,0x10,0x69,0x30,0x59,0x30,0x59,0x30,0x59,0x71,0x61,0x33,0x69,0x33,0x69,0x52,0x79,0x75,0x79,0x75,0x79,0xD3,0x89,
-	0x53,0x8A,0x35,0xA2,0xD4,0x9A,0x35,0xA2,0xD4,0x9A,0xD4,0x9A,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x32,0x94,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x96,0xAB,0x96,0xAB,0x96,0xAB,
-	0x96,0xAB,0x96,0xAB,0xD4,0x9A,0xD4,0x9A,0x35,0xA2,0x53,0x8A,0xD3,0x89,0xD3,0x89,0x75,0x79,0x52,0x79,0x10,0x69,0xCF,0x58,0xCF,0x58,0xCF,0x58,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x49,0x30,0x29,0x28,0x28,0x28,0x28,0x28,0x27,0x28,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x18,0x26,0x20,0x26,0x18,0x25,0x20,
-	0x26,0x18,0x26,0x20,0x26,0x18,0x26,0x18,0x27,0x20,0x28,0x20,0x29,0x28,0x29,0x28,0x29,0x28,0x2B,0x30,0x4D,0x30,0x4B,0x28,0x4D,0x30,0x30,0x38,0x4D,0x30,0x4D,0x30,0x4D,0x30,0x30,0x38,0x30,0x38,0x30,0x38,0x30,0x38,0x34,0x30,0x30,0x38,0x34,0x30,0x39,0x58,0x39,0x58,0x39,0x58,0x5B,0x88,0x38,0xA8,0x36,0x88,0x34,0x70,0x30,0x38,
-	0x2C,0x18,0x28,0x10,0x28,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x18,0xAA,0x10,0xAA,0x10,0xAA,0x18,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xEC,0x20,0xEC,0x20,0xF1,0x20,0xAA,0x20,0xA9,0x18,0xA9,0x18,0xA9,0x18,
-	0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x18,0xA9,0x20,0xA9,0x18,0xA8,0x20,0xAA,0x20,0xEC,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0x68,0x20,0xA8,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xAB,0x30,0xEB,0x38,0xAB,0x38,0xEC,0x38,0xCC,0x40,0xCF,0x48,0x30,0x59,0x30,0x59,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0xCF,0x58,0xCF,0x58,0x30,0x59,0x30,0x59,0x52,0x79,0x71,0x61,0x71,0x61,0xB1,0x71,0xD3,0x89,0xD3,0x89,0x53,0x8A,0xD3,0x89,0x53,0x8A,0x53,0x8A,0x53,0x8A,0xD4,0x9A,0xD4,0x9A,0x96,0xAB,0x32,0x94,0x32,0x94,0x32,0x94,0x96,0xAB,0x32,0x94,0x32,0x94,0x96,0xAB,0x32,0x94,
-	0xD4,0x9A,0x32,0x94,0x32,0x94,0xF6,0xAC,0x32,0x94,0xF6,0xAC,0x32,0x94,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x32,0x94,0x96,0xAB,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,0x53,0x8A,0xD4,0x9A,0x53,0x8A,0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0x53,0x89,0x75,0x79,0x53,0x89,0x75,0x79,0xF1,0x78,0x10,0x69,
-	0x30,0x60,0x2F,0x48,0x2D,0x58,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2A,0x48,0x2B,0x30,0x29,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x27,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x2B,0x30,0x4B,0x28,0x4D,0x30,0x4D,0x30,0x4D,0x30,0x4D,0x30,0x4D,0x30,0x4D,0x30,0x4D,0x30,
-	0x4C,0x28,0x4C,0x28,0x30,0x38,0x2F,0x28,0x30,0x38,0x92,0x50,0x39,0x58,0x36,0x88,0x36,0x88,0x38,0xA8,0x38,0xA8,0x36,0x88,0x92,0x50,0x2F,0x28,0x4A,0x18,0x48,0x00,0x26,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x10,0xA9,0x10,0xAA,0x18,0xEA,0x10,0xA9,0x18,0xAA,0x10,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xEC,0x20,0xEC,0x20,0xEC,0x20,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x20,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x20,0xA8,0x18,0xA8,0x20,0xA8,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x18,0xA8,0x20,0xA8,0x20,0x68,0x20,0xAA,0x28,0xA9,0x28,
-	0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xEA,0x30,0xEB,0x30,0xEB,0x30,0xAB,0x38,0xEB,0x38,0x2E,0x49,0x30,0x59,0x30,0x59,0xCF,0x48,0xCC,0x40,0xCC,0x40,0xCC,0x40,0x2E,0x49,0xED,0x58,0xCF,0x48,0xCC,0x40,0x2E,0x49,0xCF,0x58,0x30,0x59,0x30,0x59,0x71,0x61,0x71,0x61,0x52,0x79,0xB1,0x71,0xD3,0x89,
-	0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0xD3,0x89,0x53,0x8A,0x53,0x8A,0xD4,0x9A,0xD4,0x9A,0x96,0xAB,0x32,0x94,0x32,0x94,0x32,0x94,0x96,0xAB,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,0xD3,0x89,0x53,0x8A,0x53,0x8A,0xD4,0x9A,0xD4,0x9A,0x32,0x94,0x32,0x94,0x32,0x94,0xF6,0xAC,0x32,0x94,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x32,0x94,
-	0x32,0x94,0x96,0xAB,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,0x53,0x8A,0xD3,0x89,0xD3,0x89,0xD3,0x89,0x52,0x79,0x52,0x79,0x52,0x79,0x52,0x79,0xF1,0x78,0xF1,0x78,0x31,0x70,0xF1,0x78,0x31,0x70,0x31,0x70,0x30,0x60,0x30,0x60,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2A,0x48,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,
-	0x29,0x28,0x29,0x28,0x29,0x28,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x4B,0x28,0x2B,0x30,0x29,0x28,0x4B,0x28,0x29,0x28,0x4B,0x28,0x4B,0x28,0x4B,0x28,0x4C,0x28,0x4D,0x30,0x30,0x38,0x92,0x50,0xD5,0x50,0x34,0x70,0x36,0x88,0x38,0xA8,0x36,0x88,0x36,0x88,0x92,0x50,0x30,0x38,0x4A,0x18,0x4A,0x18,0x28,0x10,0x26,0x08,0x25,0x08,
-	0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xA9,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x18,0xAA,0x18,0xAA,0x18,0xA9,0x18,0xAA,0x18,0xED,0x18,0xEC,0x20,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,
-	0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x20,0xA8,0x18,0xA8,0x18,0xA8,0x20,0xA8,0x18,0xA8,0x20,0xA8,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0x67,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAB,0x30,0xEB,0x38,0xEC,0x38,0xCF,0x48,0x2E,0x49,0x2E,0x49,
-	0xEC,0x38,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0x2E,0x49,0x2E,0x49,0xCF,0x58,0x10,0x69,0x71,0x61,0x71,0x61,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xD3,0x89,0xD3,0x89,0xD3,0x89,0x53,0x8A,0x53,0x8A,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0x96,0xAB,0x32,0x94,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,
-	0x53,0x8A,0x53,0x8A,0xB1,0x71,0x33,0x69,0x71,0x61,0x30,0x59,0x71,0x61,0x10,0x69,0xD3,0x89,0x10,0x83,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0xF6,0xAC,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,0x53,0x8A,0xD3,0x89,0xB1,0x71,0x52,0x79,0xF1,0x78,0x10,0x69,0xF1,0x78,0x10,0x69,0xF1,0x78,
-	0x31,0x70,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x29,0x28,0x49,0x30,0x2B,0x30,0x29,0x28,0x29,0x28,0x28,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x2B,0x30,0x4B,0x28,0x4D,0x30,0x4D,0x30,0x2F,0x48,0x92,0x50,
-	0x34,0x70,0x34,0x70,0x36,0x88,0x36,0x88,0x36,0x88,0x34,0x70,0x92,0x50,0x30,0x38,0x4C,0x28,0x29,0x20,0x28,0x10,0x28,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x24,0x00,0x24,0x08,0x24,0x00,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xEA,0x10,0xA9,0x10,0xAA,0x18,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xA9,0x10,0xAA,0x18,0xEC,0x20,0xEC,0x20,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x20,0xA8,0x18,0x68,0x20,0xA8,0x18,0xA8,0x20,0xA7,0x18,
-	0xA8,0x20,0x67,0x20,0x67,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAB,0x38,0x2E,0x49,0x2E,0x49,0xCC,0x40,0xEB,0x38,0xEC,0x38,0xEC,0x38,0xEB,0x38,0xEC,0x38,0x2E,0x49,0xEC,0x38,0xEB,0x38,0xCC,0x40,0x2E,0x49,0x2E,0x49,0x30,0x59,0x2F,0x61,0x71,0x61,0xB1,0x71,0xB1,0x71,
-	0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xD3,0x89,0xB1,0x71,0xD3,0x89,0x53,0x8A,0x53,0x8A,0x10,0x83,0xD4,0x9A,0xD4,0x9A,0x10,0x83,0x53,0x8A,0x53,0x8A,0xB1,0x71,0xB1,0x71,0x71,0x61,0x71,0x61,0x30,0x59,0xCF,0x48,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x53,0x8A,0x53,0x8A,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,
-	0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,0xD3,0x89,0x53,0x89,0x52,0x79,0x31,0x70,0x10,0x69,0xCF,0x58,0x30,0x60,0x30,0x60,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x2D,0x48,0x2A,0x48,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x29,0x28,
-	0x28,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x2B,0x30,0x2B,0x30,0x4D,0x30,0x2D,0x48,0x2F,0x48,0x2F,0x48,0x92,0x50,0x30,0x60,0x34,0x70,0x34,0x70,0x34,0x70,0x34,0x70,0x34,0x70,0x92,0x50,0x2F,0x48,0x2F,0x28,0x4B,0x28,0x29,0x20,0x27,0x18,0x26,0x10,0x26,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,
-	0x24,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xA9,0x18,0xAA,0x18,0xEB,0x18,0xEC,0x20,0xAA,0x18,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA8,0x18,
-	0xA8,0x18,0xA8,0x18,0xA9,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA7,0x18,0xA8,0x20,0xA7,0x18,0x67,0x20,0xA8,0x20,0xA8,0x20,0xAA,0x28,0xAA,0x28,0xEB,0x30,0xEB,0x30,0xEC,0x38,0x2E,0x49,0xEC,0x38,0xEB,0x30,0xEA,0x30,0xAA,0x30,0xAB,0x30,0xEC,0x38,0xCC,0x40,0xEC,0x38,
-	0xAB,0x38,0xEB,0x38,0xEB,0x38,0xAB,0x38,0xEB,0x38,0xAB,0x38,0xEB,0x38,0xEB,0x38,0xEB,0x38,0xCC,0x40,0xCC,0x40,0x2E,0x49,0x2F,0x61,0x71,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,0x2F,0x61,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0x53,0x8A,0x53,0x8A,0x53,0x8A,0x53,0x8A,
-	0x53,0x8A,0xB1,0x71,0xB1,0x71,0x71,0x61,0x33,0x69,0x30,0x59,0x2E,0x49,0x2E,0x49,0xEC,0x38,0xEB,0x38,0xEC,0x38,0x2F,0x61,0x71,0x61,0xB1,0x71,0xB1,0x71,0xD3,0x89,0xB1,0x71,0x53,0x8A,0x53,0x8A,0x10,0x83,0xD4,0x9A,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,0x53,0x8A,0xD3,0x89,0x53,0x89,
-	0x53,0x89,0xF1,0x78,0x31,0x70,0x31,0x70,0x31,0x70,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x2F,0x48,0x2D,0x58,0x30,0x60,0x2D,0x58,0x2D,0x48,0x2D,0x58,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x30,0x60,0x2F,0x48,0x2F,0x48,0x30,0x60,0x30,0x60,0x30,0x60,0x31,0x70,0x34,0x70,0x34,0x70,0x34,0x70,0x34,0x70,0x31,0x70,0x30,0x60,0x2F,0x48,
-	0x4D,0x30,0x4B,0x28,0x4B,0x28,0x29,0x20,0x27,0x18,0x26,0x18,0x26,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xA9,0x10,0xA9,0x10,0xA9,0x18,0xA9,0x18,0xEB,0x18,0xAB,0x18,0xAA,0x18,0xA9,0x18,0xA8,0x18,0xA8,0x18,0xA9,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0x67,0x18,0xA8,0x18,0x67,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA9,0x20,
-	0xAA,0x28,0xAB,0x28,0xAB,0x28,0xEA,0x30,0xAB,0x28,0xEB,0x30,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEB,0x38,0xEC,0x38,0xEC,0x38,0xEB,0x30,0xAA,0x30,0xAA,0x30,0xAB,0x30,0xAA,0x38,0xAB,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xEB,0x38,0xEB,0x38,0xEC,0x38,0x2C,0x59,0x2E,0x49,0x2F,0x61,0x2F,0x61,0x2F,0x61,
-	0x2F,0x61,0x2F,0x61,0x2F,0x61,0x71,0x61,0x2F,0x61,0x71,0x61,0xB1,0x71,0x71,0x61,0x71,0x61,0x71,0x61,0x71,0x61,0xB1,0x71,0xB1,0x71,0xEE,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0xB1,0x71,0x71,0x61,0x71,0x61,0x30,0x59,0x30,0x59,0x2E,0x49,0xEC,0x38,0xEC,0x38,0xAA,0x30,0xEA,0x30,0xEB,0x38,0xEC,0x38,0xEB,0x38,0xEB,0x38,
-	0xEB,0x48,0x2C,0x59,0x2E,0x49,0x2F,0x61,0x2F,0x61,0x71,0x61,0xB1,0x71,0xB1,0x71,0x53,0x8A,0x53,0x8A,0x10,0x83,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0xD4,0x9A,0x53,0x8A,0xD3,0x89,0x53,0x89,0x91,0x90,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,
-	0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x30,0x60,0x30,0x60,0x2F,0x48,0x2D,0x48,0x2B,0x30,0x4B,0x28,0x4B,0x28,0x29,0x20,0x28,0x20,0x27,0x18,0x26,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,
-	0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x18,0xA9,0x10,0xAA,0x18,0xEC,0x20,0xAA,0x18,0xA8,0x18,0xA9,0x18,0xA8,0x18,0xA8,0x18,
-	0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0x67,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x18,0x67,0x18,0xA8,0x20,0xAA,0x20,0xEA,0x28,0xAB,0x28,0xEA,0x28,0xAA,0x28,0xEA,0x28,0xAA,0x28,0xEA,0x30,0xEB,0x30,0xEB,0x30,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0x2E,0x49,0x2E,0x49,0xEB,0x38,0xAA,0x30,
-	0xEA,0x30,0xAA,0x30,0xEA,0x30,0xAA,0x30,0xEA,0x30,0xAA,0x30,0xEA,0x30,0xAA,0x30,0xAA,0x30,0xEB,0x38,0xEB,0x38,0xCC,0x40,0x2E,0x49,0x2C,0x59,0x2E,0x49,0x2E,0x49,0x30,0x59,0x2F,0x61,0x30,0x59,0x2F,0x61,0x71,0x61,0x71,0x61,0x71,0x61,0x71,0x61,0x30,0x59,0x71,0x61,0x30,0x59,0x30,0x59,0x71,0x61,0x30,0x59,0x30,0x59,0x71,0x61,
-	0x71,0x61,0x71,0x61,0x71,0x61,0x71,0x61,0x71,0x61,0x71,0x61,0x30,0x59,0x30,0x59,0x2E,0x49,0xEC,0x38,0xEB,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xA9,0x28,0xEA,0x30,0xA9,0x28,0xA8,0x20,0xA8,0x28,0xA9,0x28,0xEA,0x30,0xAB,0x38,0x2E,0x49,0xCF,0x58,0xCF,0x58,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0x10,0x69,0xF1,0x78,0x52,0x79,
-	0xF1,0x78,0xF1,0x78,0x31,0x70,0x91,0x90,0x31,0x70,0x91,0x90,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x30,0x60,0x30,0x60,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x4D,0x30,0x2B,0x30,0x4B,0x28,0x29,0x28,0x29,0x20,0x28,0x20,0x29,0x28,0x27,0x18,0x27,0x18,0x26,0x18,0x25,0x10,
-	0x24,0x10,0x24,0x10,0x23,0x08,0x24,0x08,0x23,0x10,0x23,0x08,0x24,0x08,0x24,0x10,0x24,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x18,0xAA,0x18,0xEB,0x18,0xAA,0x18,0xA9,0x10,0xA8,0x18,0xA8,0x10,0xA8,0x18,0xA8,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0x67,0x18,0xA8,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA8,0x18,0xEA,0x28,0xAB,0x28,0xEA,0x28,
-	0xEA,0x28,0xAA,0x28,0xEA,0x28,0xEA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xEB,0x30,0xEB,0x30,0xEA,0x30,0xEB,0x30,0xEC,0x38,0xEC,0x38,0x2E,0x49,0xCC,0x40,0xAA,0x28,0xA9,0x28,0xAA,0x30,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xA9,0x28,0xAA,0x30,0xA9,0x28,0xAA,0x30,0xEB,0x38,0xEC,0x38,0xCC,0x40,0xCC,0x40,0x2E,0x49,0x2C,0x59,
-	0x2E,0x49,0x2E,0x49,0x2C,0x59,0x30,0x59,0x2E,0x49,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x2E,0x49,0x30,0x59,0x2E,0x49,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x2E,0x49,0x2E,0x49,0xEC,0x38,0xEB,0x38,0xEB,0x38,0xEA,0x30,0xEA,0x30,0xAA,0x30,0xEA,0x30,
-	0xA9,0x28,0xA8,0x20,0xA8,0x28,0xA9,0x28,0xA9,0x28,0xA8,0x28,0x68,0x28,0xA9,0x28,0xAA,0x30,0xAB,0x30,0xAB,0x38,0xCC,0x40,0x2D,0x48,0xCC,0x40,0x2D,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2F,0x48,0x2F,0x48,0x2D,0x58,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2D,0x48,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x29,0x28,
-	0x29,0x28,0x28,0x28,0x27,0x20,0x27,0x20,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x23,0x08,0x23,0x10,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x10,0x24,0x08,0x24,0x08,0x23,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x25,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,
-	0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA9,0x18,0xAA,0x18,0xAA,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x10,0xA8,0x10,
-	0x67,0x18,0xA8,0x18,0x67,0x18,0xA8,0x10,0x67,0x18,0xA8,0x10,0xA7,0x18,0x67,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA7,0x18,0xAA,0x20,0xAA,0x28,0xEA,0x20,0xAA,0x20,0xEA,0x28,0xAA,0x20,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xAA,0x28,0xE9,0x28,0xAA,0x28,0xAA,0x28,0xEA,0x30,0xEA,0x30,0xEB,0x30,0xEB,0x38,0x2E,0x49,0xEC,0x38,0xEA,0x30,
-	0xA8,0x20,0xA8,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA8,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xEA,0x30,0xEB,0x38,0xEB,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0x2E,0x49,0x2E,0x49,0x2C,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x30,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0xEC,0x38,0xEC,0x38,0xEB,0x38,0xEB,0x38,0xEB,0x38,0xEB,0x30,0xEA,0x30,0xA9,0x28,0xA9,0x28,0xAA,0x30,0xAA,0x30,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0x69,0x28,0x68,0x28,0x68,0x28,0x69,0x28,0x68,0x28,0x68,0x20,0x68,0x20,0x67,0x20,
-	0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x29,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x25,0x18,0x25,0x18,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x24,0x10,0x23,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x24,0x10,
-	0x24,0x08,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x10,0x24,0x08,0x24,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x18,0xAA,0x18,0xEA,0x18,0xA9,0x18,0xA8,0x10,0xA7,0x10,0x67,0x18,0xA7,0x10,0xA7,0x18,0xA7,0x10,0x67,0x18,0xA7,0x10,0xA7,0x18,0x67,0x10,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA7,0x10,0xA9,0x20,0xEA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,
-	0xAA,0x20,0xAA,0x20,0xEA,0x28,0xA9,0x20,0xE9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xEA,0x28,0xAA,0x28,0xEA,0x28,0xEA,0x30,0xEC,0x38,0xEC,0x38,0xEB,0x38,0xEB,0x38,0xAA,0x28,0xA8,0x20,0xA8,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x28,0xA9,0x28,0xAA,0x30,0xEA,0x30,0xEB,0x38,0xEB,0x38,0xEB,0x38,0xEB,0x38,
-	0xEC,0x38,0xEC,0x38,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x30,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEB,0x30,0xEC,0x38,0xEB,0x38,0xEB,0x30,0xEA,0x30,0xEB,0x38,0xEB,0x38,0xEB,0x38,
-	0xEC,0x38,0xEB,0x38,0xEB,0x38,0xEA,0x30,0xAA,0x30,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0x69,0x28,0x69,0x28,0x69,0x28,0x68,0x28,0x27,0x20,0x26,0x20,0x26,0x18,0x26,0x20,0x26,0x18,0x25,0x18,0x26,0x18,0x25,0x18,0x26,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,
-	0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x24,0x10,0x23,0x08,0x24,0x10,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x25,0x10,0x25,0x10,0x25,0x08,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,
-	0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA8,0x10,0x67,0x10,0xA8,0x10,0x67,0x10,0xA8,0x10,0xA7,0x10,0xA8,0x10,0xA9,0x18,0xAA,0x18,0xA9,0x18,0xA7,0x10,0x67,0x10,0xA7,0x10,
-	0xA8,0x18,0x67,0x18,0xA7,0x10,0xA7,0x18,0x67,0x18,0xA7,0x10,0xA9,0x18,0xA8,0x18,0xA7,0x10,0x66,0x18,0xA8,0x18,0xAA,0x20,0xAA,0x20,0xEA,0x20,0xEC,0x38,0xEA,0x28,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xAA,0x28,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xEA,0x30,0xEB,0x38,0xEB,0x38,0xEA,0x30,0xEA,0x30,
-	0xEA,0x30,0xA8,0x20,0x67,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA8,0x20,0xA8,0x28,0xA9,0x28,0xAA,0x30,0xEA,0x28,0xEB,0x38,0xEA,0x30,0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEC,0x38,0xEC,0x38,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0xAF,0x38,0xEC,0x38,
-	0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEB,0x30,0xEB,0x30,0xAA,0x28,0xAA,0x28,0xA9,0x28,0xAA,0x30,0xEA,0x30,0xEA,0x30,0xEA,0x30,0xEB,0x38,0xEB,0x38,0xEC,0x38,0xEC,0x38,0xEB,0x38,0xEB,0x38,0xEB,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0x69,0x28,0x69,0x28,0x69,0x28,0x68,0x28,0x27,0x20,
-	0x27,0x20,0x26,0x18,0x26,0x20,0x26,0x18,0x26,0x20,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x23,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x25,0x10,0x25,0x10,0x25,0x10,
-	0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA8,0x10,0xA8,0x10,0xA8,0x10,0xA7,0x10,0xA8,0x10,0xA7,0x10,0xA7,0x10,0xA7,0x10,0x67,0x10,0xA7,0x10,0xA8,0x10,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA7,0x10,0xA7,0x10,0x67,0x10,0xA7,0x10,0x67,0x10,0xA7,0x10,0xA7,0x18,0x66,0x10,0xA9,0x18,0xA7,0x18,0x67,0x10,0xA7,0x18,0xAA,0x20,0xEA,0x20,0xAA,0x20,0xAA,0x20,0xEA,0x20,0xA9,0x20,
-	0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xEA,0x30,0xEB,0x30,0xEA,0x30,0xAA,0x28,0xA9,0x28,0xEA,0x28,0xA8,0x28,0x67,0x20,0xA7,0x18,0x67,0x20,0xA7,0x18,0x67,0x20,0x67,0x18,0xA7,0x20,0xA8,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,
-	0xEA,0x28,0xEA,0x30,0xEB,0x30,0xEB,0x30,0xEC,0x28,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0x2E,0x49,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEB,0x30,0xEB,0x30,0xEA,0x30,0xEB,0x30,0xAA,0x28,0xE9,0x28,0xA9,0x28,0xA8,0x28,0xA8,0x20,0xA9,0x28,0xA9,0x28,0xAA,0x28,0xEA,0x30,0xEA,0x30,
-	0xEB,0x38,0xEB,0x38,0xEB,0x38,0xEB,0x30,0xEB,0x38,0xEB,0x38,0xEB,0x38,0xAB,0x30,0xEB,0x38,0xAB,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0x69,0x28,0x68,0x20,0x67,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x26,0x20,0x26,0x20,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x18,
-	0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x08,0x24,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x10,0xA7,0x10,0x67,0x10,0xA7,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0xA7,0x10,0x67,0x10,0xA7,0x10,0xA8,0x10,0xA9,0x18,0xA8,0x10,0xA7,0x10,0x67,0x10,
-	0xA7,0x10,0x67,0x18,0xA7,0x10,0xA7,0x10,0x67,0x18,0xA7,0x10,0x67,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xEA,0x20,0xEA,0x28,0xEA,0x20,0xEA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA8,0x20,0xA9,0x20,0xA8,0x20,0xA9,0x20,0xA9,0x28,0xEA,0x28,0xEA,0x30,0xA9,0x28,0xA9,0x28,0xA9,0x28,
-	0xA9,0x28,0xA9,0x28,0xA7,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0xA6,0x18,0x67,0x20,0xA7,0x18,0xA8,0x20,0xA9,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x28,0xA9,0x28,0xAA,0x28,0xEA,0x28,0xEB,0x30,0xEB,0x30,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEB,0x30,
-	0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEA,0x28,0xAA,0x28,0xA9,0x28,0xA9,0x28,0xA8,0x20,0xA8,0x28,0xA9,0x20,0xA8,0x28,0xA9,0x20,0xA9,0x28,0xAA,0x28,0xAA,0x28,0xEA,0x30,0xEA,0x30,0xEA,0x30,0xEA,0x30,0xAA,0x30,0xEA,0x30,0xEB,0x38,0xEC,0x38,0xEB,0x38,0xAA,0x30,0xAB,0x30,0xAB,0x38,0xAA,0x30,0xAA,0x30,0x69,0x28,0x69,0x28,
-	0x68,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x20,0x28,0x28,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x25,0x10,
-	0x24,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA7,0x10,0xA7,0x08,0x67,0x10,0x67,0x10,0x67,0x10,0xA7,0x10,0x67,0x10,0xA7,0x08,0x66,0x10,0xA7,0x10,0x67,0x10,0xA7,0x10,0xA8,0x18,0xA8,0x10,0x67,0x10,0x66,0x10,0x66,0x10,0xA7,0x10,0x67,0x10,0xA7,0x18,0xA7,0x10,0x67,0x18,0xA7,0x10,0xA7,0x18,0xA7,0x10,0xA9,0x20,0xEC,0x20,0xAA,0x20,0xEC,0x20,0xEA,0x28,0xEA,0x20,0xAA,0x20,
-	0xE9,0x20,0xA9,0x20,0xE9,0x20,0xA9,0x20,0xA9,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x28,0xEA,0x28,0xEA,0x28,0xA9,0x28,0xA8,0x20,0xEA,0x30,0xA9,0x28,0xA8,0x20,0xA8,0x28,0xA7,0x18,0x66,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0xA6,0x18,0xA7,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x20,0xA8,0x20,0xA8,0x20,
-	0xA8,0x20,0xA8,0x20,0xA9,0x28,0xA9,0x28,0xEA,0x28,0xEA,0x30,0xEC,0x28,0xEB,0x30,0xEB,0x30,0xEC,0x28,0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEB,0x30,0xEA,0x28,0xEA,0x28,0xAA,0x28,0xAA,0x28,0xA9,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x28,0xA9,0x28,0xEA,0x28,
-	0xEA,0x30,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xAA,0x28,0xEB,0x38,0xAA,0x30,0xAA,0x28,0xAA,0x30,0xAA,0x30,0x69,0x28,0xAA,0x30,0x69,0x28,0x68,0x28,0x68,0x20,0x69,0x28,0x28,0x28,0x29,0x28,0x2B,0x30,0x2B,0x30,0x29,0x28,0x29,0x28,0x29,0x28,0x28,0x28,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x27,0x20,0x27,0x20,
-	0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x24,0x08,0x24,0x10,0x23,0x08,0x23,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x10,0x67,0x10,0xA6,0x10,0xA9,0x10,0xAA,0x10,0x65,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0x65,0x08,0x66,0x10,0x66,0x10,0xA7,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x10,
-	0xA7,0x10,0x67,0x10,0xA7,0x10,0x67,0x10,0xA7,0x10,0xA7,0x18,0x67,0x18,0xA8,0x10,0x67,0x18,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xEC,0x28,0xEB,0x30,0xEA,0x20,0xEA,0x28,0xAA,0x20,0xA9,0x20,0xAA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA8,0x20,0xA9,0x20,0xA9,0x28,0xEA,0x28,0xA9,0x28,0xA9,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,
-	0xA8,0x20,0xA8,0x20,0xA7,0x18,0x65,0x18,0x66,0x18,0xA8,0x20,0x65,0x18,0x65,0x18,0x66,0x18,0x66,0x18,0xA7,0x18,0x67,0x20,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x28,0xA9,0x28,0xAA,0x28,0xEA,0x28,0xEB,0x38,0xEB,0x30,0xEA,0x28,0xEA,0x28,0xEA,0x30,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xAA,0x28,
-	0xEA,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x20,0xA9,0x20,0xEA,0x30,0xEA,0x30,0xE9,0x28,0xA9,0x28,0xA9,0x28,0xA8,0x20,0xA9,0x28,0xA8,0x28,0xA9,0x28,0xA9,0x28,0xA8,0x28,0xA8,0x28,0xA9,0x28,0x68,0x28,0x69,0x28,0x68,0x28,0x67,0x20,
-	0x27,0x20,0x28,0x20,0x68,0x28,0x69,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x28,0x20,0x28,0x20,0x28,0x20,0x27,0x20,0x27,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,
-	0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x08,0x66,0x10,0xA7,0x08,0xA7,0x10,0xA7,0x10,0x66,0x10,0x66,0x10,0xA7,0x08,0x66,0x10,0x65,0x08,0xA6,0x10,0x65,0x08,0x66,0x10,0xA8,0x10,0xA9,0x10,0xA8,0x18,0x67,0x10,0xA7,0x10,0x67,0x18,0xA7,0x10,0x67,0x10,0xA7,0x18,0xA8,0x10,0xA7,0x18,0xA8,0x18,0xEA,0x20,0xAB,0x20,0xEA,0x28,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xAA,0x20,
-	0xEA,0x28,0xEA,0x20,0xA9,0x20,0xE9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xE9,0x28,0xA9,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0x65,0x18,0x65,0x10,0x66,0x18,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x18,0x66,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x20,0xA7,0x18,
-	0xA7,0x18,0xA8,0x20,0xA8,0x20,0xE9,0x28,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xE9,0x28,0xEA,0x28,0xAA,0x28,0xEA,0x28,0xAA,0x28,0xEA,0x28,0xAA,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xE9,0x20,0xA9,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x20,0xA9,0x28,
-	0xA9,0x28,0xA9,0x28,0xA9,0x20,0xA8,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x28,0x68,0x20,0xA8,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x67,0x20,0x26,0x18,0x66,0x18,0x27,0x20,0x28,0x28,0x28,0x28,0x28,0x28,0x29,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x20,0x27,0x20,0x27,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x10,
-	0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x08,0x24,0x10,0x23,0x08,0x23,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x08,0xA7,0x08,0x66,0x10,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x10,0xA7,0x10,0xA8,0x18,0xA9,0x10,
-	0xA8,0x18,0xA8,0x18,0xA7,0x10,0xA7,0x10,0xA7,0x10,0xA7,0x18,0xA8,0x10,0x67,0x18,0xA8,0x18,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xAA,0x20,0xEA,0x20,0xAA,0x28,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA8,0x20,0xA7,0x18,
-	0xA8,0x20,0xA8,0x20,0x67,0x20,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x18,0x65,0x10,0x65,0x18,0x66,0x18,0xA7,0x18,0x67,0x20,0xA6,0x18,0x67,0x18,0xA7,0x18,0xA8,0x20,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x28,0xA9,0x20,0xA9,0x28,0xA9,0x28,0xA9,0x28,0xA9,0x20,0xE9,0x28,0xA9,0x20,
-	0xE9,0x20,0xA9,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x20,0xA9,0x28,0xA8,0x20,0xE9,0x20,0xA8,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0x68,0x20,0xA8,0x20,0x68,0x20,0x67,0x20,0x67,0x18,0x66,0x18,
-	0x67,0x18,0x68,0x20,0x28,0x20,0x68,0x20,0x28,0x28,0x68,0x28,0x28,0x28,0x28,0x28,0x28,0x20,0x28,0x28,0x27,0x20,0x26,0x18,0x27,0x18,0x27,0x20,0x26,0x18,0x25,0x18,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x08,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,
-	0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x00,0x23,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0x65,0x08,0xA6,0x10,0x66,0x10,0x66,0x10,0x67,0x10,0xA8,0x10,0xA8,0x18,0xA9,0x18,0xA8,0x10,0xEA,0x20,0xA8,0x18,0xA7,0x10,0x67,0x18,0xA8,0x10,0xA7,0x18,0xA8,0x18,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xEA,0x28,0xEA,0x20,0xEB,0x30,0x2A,0x29,
-	0xAA,0x20,0xE9,0x20,0xA9,0x20,0xEA,0x28,0xEB,0x38,0xE9,0x28,0xE9,0x28,0xEA,0x28,0xE9,0x28,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x67,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x18,0x66,0x18,0xA6,0x18,0xA7,0x20,0xA7,0x18,0x66,0x18,0xA7,0x18,
-	0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xE9,0x20,0xA9,0x20,0xA9,0x20,0xA9,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x20,0xA8,0x20,
-	0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA9,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x20,0x68,0x20,0x68,0x20,0x68,0x20,0x67,0x20,0x67,0x20,0x67,0x18,0x67,0x20,0x67,0x20,0x68,0x28,0x68,0x28,0x69,0x28,0x28,0x20,0x28,0x28,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x28,0x28,0x20,0x26,0x18,0x27,0x18,0x28,0x20,0x26,0x18,0x25,0x10,
-	0x26,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0xA8,0x10,
-	0xA8,0x18,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x10,0xA7,0x18,0xA8,0x10,0xA7,0x18,0xAA,0x20,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xEA,0x28,0xEA,0x28,0xEA,0x20,0xE9,0x20,0xE9,0x20,0xE9,0x28,0x2A,0x29,0xE9,0x28,0xEA,0x30,0xE9,0x28,0xA9,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x67,0x18,
-	0xA7,0x18,0x67,0x20,0xA6,0x18,0x65,0x10,0x65,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x18,0xA7,0x18,0xA6,0x18,0x66,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,
-	0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xE9,0x28,0xA9,0x28,0xA8,0x20,0xA8,0x20,0xA8,0x28,0x68,0x20,0x67,0x20,0x68,0x20,0x67,0x20,0x67,0x20,0x67,0x20,
-	0x68,0x20,0x68,0x28,0x68,0x28,0x68,0x28,0x69,0x28,0x28,0x28,0x28,0x28,0x28,0x20,0x28,0x20,0x28,0x20,0x27,0x20,0x26,0x18,0x27,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,
-	0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x23,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0xA7,0x10,0xA8,0x18,0xA9,0x18,0xA9,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xEA,0x20,0xEA,0x20,
-	0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xE9,0x28,0xE9,0x28,0xE8,0x20,0xA8,0x20,0xA7,0x18,0xA8,0x20,0xA7,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x66,0x18,0x65,0x10,0x65,0x10,0x65,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x66,0x18,
-	0x66,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA8,0x20,0xA8,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x18,0xA8,0x20,0xA8,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x20,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA7,0x18,
-	0x67,0x18,0xA7,0x18,0x66,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0x67,0x20,0xA8,0x20,0xA8,0x20,0x67,0x20,0x67,0x18,0x67,0x20,0x67,0x20,0x68,0x28,0x69,0x28,0x68,0x28,0x68,0x28,0x69,0x28,0x28,0x28,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x10,
-	0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x23,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x00,0x23,0x08,0x22,0x08,0x23,0x00,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x65,0x08,
-	0x66,0x10,0x66,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xA9,0x18,0xA8,0x18,0xA9,0x18,0xA8,0x18,0xE9,0x20,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0x2A,0x29,0xEA,0x28,0x2A,0x29,0x2A,0x29,0x2A,0x29,0xE9,0x28,0xE9,0x28,0xE8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,
-	0x66,0x18,0xA7,0x18,0x65,0x10,0x64,0x10,0x65,0x10,0x66,0x18,0xA6,0x18,0x65,0x10,0x64,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0xA6,0x18,0x66,0x10,0xA6,0x18,0x66,0x10,0xA6,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA9,0x20,0xA8,0x20,0xA7,0x18,0xA8,0x18,0xA8,0x20,
-	0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0xA6,0x18,0x67,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x67,0x18,0x67,0x18,0x67,0x18,0x67,0x20,0x67,0x20,0x67,0x20,0x67,0x18,0x67,0x20,
-	0x67,0x20,0x68,0x20,0x68,0x28,0x68,0x28,0x68,0x28,0x49,0x30,0x68,0x28,0x28,0x20,0x28,0x20,0x28,0x20,0x26,0x18,0x27,0x18,0x26,0x18,0x26,0x10,0x26,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x00,0x22,0x08,
-	0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x21,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x65,0x08,0x65,0x08,0x65,0x08,0x65,0x10,0x65,0x08,0x65,0x08,0x65,0x08,0x66,0x10,0x66,0x10,0xA7,0x10,0xA8,0x10,0xA8,0x10,0xA7,0x18,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xE9,0x20,0x2A,0x29,0x2A,0x29,0x2A,0x29,0x2A,0x29,0x2A,0x29,0x2A,0x29,
-	0x2A,0x29,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x66,0x18,0xA6,0x18,0xA6,0x18,0x66,0x18,0x64,0x10,0x64,0x10,0x64,0x10,0xA7,0x18,0xA6,0x18,0x64,0x10,0x64,0x10,0x65,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x66,0x18,0x66,0x10,0x66,0x18,
-	0xA6,0x18,0x66,0x10,0x66,0x18,0xA6,0x18,0xA6,0x18,0x66,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA8,0x18,0xA7,0x18,0xA7,0x18,0x67,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x67,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA6,0x18,
-	0x66,0x18,0xA6,0x18,0xA6,0x18,0x66,0x18,0x67,0x18,0x67,0x18,0x67,0x18,0x67,0x18,0x66,0x18,0x66,0x18,0xA7,0x18,0x67,0x20,0x67,0x18,0x67,0x18,0x68,0x20,0x68,0x20,0x67,0x18,0x67,0x20,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x28,0x28,0x28,0x28,0x27,0x20,0x27,0x20,0x27,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x10,0x25,0x10,
-	0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x64,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x65,0x08,0xA6,0x10,0x66,0x10,0x65,0x08,
-	0x65,0x08,0x66,0x10,0x65,0x08,0x66,0x10,0xA7,0x10,0xA7,0x10,0xA7,0x10,0xA8,0x18,0xA8,0x18,0xA8,0x18,0xE9,0x20,0xEA,0x28,0xEA,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x20,0xE9,0x20,0xE8,0x20,0xE8,0x20,0xA8,0x20,0xA8,0x20,0xA8,0x20,0xA7,0x18,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA6,0x18,0x66,0x18,
-	0xA6,0x18,0x65,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x18,0xA7,0x18,0x65,0x10,0x65,0x10,0x66,0x18,0x66,0x10,0x66,0x18,0xA6,0x18,0xA6,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0xA6,0x18,
-	0x66,0x18,0x66,0x18,0xA7,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0x66,0x10,0x66,0x18,0x66,0x18,0x66,0x18,0xA6,0x18,0x66,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0x66,0x10,0x66,0x18,0xA7,0x18,0x66,0x10,0xA6,0x10,0x66,0x18,0xA6,0x18,0x67,0x18,0x67,0x18,0x66,0x18,0x67,0x18,0x67,0x20,0x67,0x18,0x67,0x18,0x66,0x18,0x67,0x20,0x67,0x20,
-	0x67,0x20,0x67,0x20,0x67,0x20,0x68,0x28,0x68,0x28,0x68,0x28,0x68,0x28,0x28,0x20,0x27,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x08,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x08,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x65,0x08,0x64,0x08,0x64,0x08,0x24,0x00,0x64,0x08,0x24,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0xA6,0x10,0x66,0x10,0x65,0x10,0x65,0x08,0x65,0x08,0x65,0x10,0x66,0x10,0x67,0x10,0xA7,0x10,0x66,0x10,0xA7,0x10,0xA7,0x10,0xA7,0x10,0xA7,0x18,0xE9,0x20,0xE9,0x20,0xE9,0x20,0xE9,0x20,0xE9,0x20,
-	0xE9,0x20,0xE8,0x20,0xE8,0x20,0xA8,0x20,0xE8,0x20,0xA8,0x20,0xE8,0x20,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA6,0x18,0x66,0x18,0xA6,0x18,0x66,0x10,0x64,0x10,0x64,0x08,0x65,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x65,0x10,0x64,0x08,0x64,0x10,0x64,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,
-	0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0xA6,0x10,0x66,0x10,0x66,0x18,0x66,0x10,0x66,0x10,0x66,0x18,0x66,0x10,0x66,0x10,0x66,0x18,0x66,0x10,0x66,0x10,0x66,0x18,0xA6,0x10,0x66,0x10,0x66,0x10,0x66,0x18,0x66,0x10,0x66,0x18,0xA6,0x10,0x65,0x10,0xA6,0x10,0x66,0x10,0x66,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x10,0x66,0x18,0x65,0x10,
-	0x65,0x10,0x65,0x10,0x66,0x10,0x66,0x18,0x66,0x10,0x66,0x10,0x66,0x18,0xA6,0x18,0x66,0x18,0x66,0x18,0xA7,0x18,0x67,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x67,0x18,0x66,0x18,0x67,0x18,0x67,0x20,0x27,0x20,0x67,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x26,0x18,0x26,0x18,0x27,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x10,0x25,0x10,
-	0x25,0x10,0x24,0x08,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x08,0x64,0x08,0x24,0x00,0x64,0x08,0x64,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x65,0x08,
-	0x65,0x08,0x65,0x10,0x65,0x08,0x65,0x08,0xA6,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA7,0x10,0xA7,0x18,0xE8,0x18,0xE8,0x20,0xE8,0x18,0xE8,0x20,0xE8,0x20,0xA8,0x20,0xE8,0x20,0xA8,0x18,0xA8,0x20,0xA8,0x18,0xA8,0x20,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA6,0x18,0x66,0x18,0xA6,0x10,0xA6,0x18,
-	0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x10,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0xA6,0x10,0x65,0x10,0xA6,0x10,0x66,0x10,0xA6,0x10,0x66,0x10,0xA5,0x10,
-	0x65,0x10,0x65,0x10,0x66,0x18,0x65,0x10,0xA6,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x18,0xA6,0x18,0x66,0x18,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x18,0x66,0x10,0x66,0x18,0x67,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x67,0x20,
-	0x66,0x20,0x66,0x18,0x66,0x20,0x67,0x18,0x67,0x18,0x27,0x20,0x27,0x20,0x67,0x18,0x26,0x18,0x26,0x18,0x26,0x10,0x26,0x18,0x26,0x10,0x26,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x22,0x00,0x64,0x08,0x63,0x00,0x63,0x08,0x23,0x08,0x64,0x08,0x24,0x00,0x64,0x08,0x24,0x08,0x64,0x08,0x24,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x65,0x08,0x65,0x10,0x66,0x10,0x66,0x10,0xA6,0x10,0x66,0x10,0xA6,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0xA8,0x18,0xA8,0x18,0xE8,0x20,0xA8,0x18,
-	0xA8,0x18,0xA8,0x20,0xA7,0x18,0xA8,0x20,0xE7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA7,0x18,0x65,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x65,0x10,
-	0x65,0x10,0x65,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0xA6,0x18,0xA6,0x18,0x66,0x10,0x66,0x10,0xA6,0x10,0x65,0x10,0x65,0x10,
-	0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x10,0x65,0x10,0x66,0x10,0x66,0x18,0xA6,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x67,0x18,0x66,0x18,0x66,0x18,0x26,0x18,0x66,0x18,0x67,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x10,0x26,0x18,0x26,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,
-	0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x63,0x00,0x64,0x08,0x63,0x00,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,
-	0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x65,0x10,0x65,0x08,0x65,0x08,0x65,0x10,0x65,0x08,0xA6,0x10,0x66,0x10,0x66,0x10,0xA6,0x10,0xA7,0x18,0xA7,0x18,0xE7,0x18,0xA7,0x18,0xA7,0x18,0xE7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0x66,0x18,0xA6,0x18,0xA6,0x18,0x65,0x10,
-	0x64,0x08,0x64,0x08,0x63,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x65,0x10,0xA6,0x10,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x65,0x10,0x64,0x10,
-	0x64,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0xA6,0x18,0xA6,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x18,0x66,0x18,0x66,0x10,0x66,0x18,0x66,0x10,0x66,0x18,
-	0x66,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x26,0x18,0x66,0x18,0x26,0x18,0x66,0x18,0x26,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x26,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x63,0x00,0x23,0x00,0x63,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x63,0x08,0x23,0x08,0x23,0x00,0x63,0x08,0x23,0x08,0x63,0x08,0x24,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x65,0x10,0x65,0x08,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x08,0x65,0x10,0x65,0x10,0x66,0x10,0xA6,0x10,0xA7,0x18,
-	0xA7,0x18,0xA7,0x18,0xA7,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0x65,0x10,0x65,0x10,0x64,0x10,0x64,0x08,0x64,0x10,0x23,0x08,0x63,0x08,0x23,0x08,0x64,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x64,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x64,0x08,
-	0x64,0x08,0x64,0x08,0x64,0x10,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x65,0x10,0x64,0x10,0x65,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,
-	0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x66,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x18,0x66,0x18,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x18,0x65,0x18,0x66,0x18,0x66,0x18,0x66,0x18,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x25,0x10,0x24,0x10,
-	0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x63,0x08,0x23,0x00,0x23,0x00,0x63,0x08,0x23,0x00,0x23,0x08,0x24,0x00,0x63,0x08,0x63,0x08,
-	0x23,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,0x64,0x08,0x65,0x08,0x65,0x10,0x65,0x08,0x65,0x10,0x65,0x10,0xA6,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0x65,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,
-	0x23,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x10,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,
-	0x63,0x08,0x64,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x10,0x65,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x10,0x64,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,
-	0x25,0x10,0x65,0x10,0x25,0x10,0x65,0x10,0x25,0x10,0x65,0x10,0x25,0x10,0x25,0x10,0x65,0x10,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x08,0x25,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x63,0x00,0x22,0x00,0x23,0x00,0x62,0x00,0x23,0x08,0x23,0x00,0x63,0x08,0x23,0x00,0x23,0x08,0x63,0x00,0x23,0x08,0x23,0x08,0x63,0x08,0x24,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x65,0x08,
-	0x65,0x10,0x65,0x08,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x65,0x10,0x64,0x10,0x64,0x08,0x64,0x10,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,
-	0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x64,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x64,0x10,0x64,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x64,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x64,0x08,0x64,0x08,
-	0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x24,0x08,0x64,0x08,0x64,0x10,0x64,0x10,0x64,0x10,0x64,0x10,0x24,0x10,0x64,0x10,0x64,0x10,0x65,0x10,0x64,0x10,0x65,0x10,0x25,0x10,0x24,0x10,0x64,0x10,0x24,0x10,0x24,0x08,0x24,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,
-	0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x00,0x23,0x00,0x22,0x00,0x63,0x08,0x23,0x00,0x23,0x08,
-	0x63,0x00,0x63,0x08,0x63,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0xA5,0x10,0x63,0x08,0x23,0x08,0x63,0x08,0x63,0x08,
-	0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x64,0x08,0x22,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x64,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x64,0x08,0x63,0x08,0x64,0x08,0x23,0x08,0x24,0x08,0x64,0x08,0x24,0x10,0x64,0x08,0x64,0x10,
-	0x64,0x10,0x24,0x08,0x64,0x10,0x24,0x10,0x24,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x63,0x08,0x63,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,
-	0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x64,0x08,0x64,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x23,0x08,0x22,0x08,0x63,0x08,0x22,0x08,0x62,0x08,0x22,0x08,0x62,0x08,0x22,0x08,0x62,0x08,0x22,0x08,0x62,0x08,0x22,0x08,0x63,0x08,0x22,0x08,0x62,0x08,0x22,0x08,0x62,0x08,
-	0x22,0x08,0x62,0x08,0x22,0x08,0x62,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x63,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x64,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,
-	0x22,0x08,0x23,0x00,0x22,0x08,0x23,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x22,0x08,0x62,0x00,0x22,0x00,0x22,0x08,0x63,0x00,0x22,0x08,0x62,0x00,0x23,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x22,0x08,
-	0x62,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x62,0x08,0x22,0x00,0x62,0x08,0x22,0x08,0x62,0x00,0x22,0x08,0x62,0x08,0x22,0x00,
-	0x62,0x08,0x22,0x08,0x62,0x00,0x22,0x08,0x22,0x00,0x62,0x08,0x22,0x00,0x62,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x62,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x63,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x63,0x08,0x23,0x08,
-	0x22,0x08,0x63,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x62,0x08,0x22,0x00,0x63,0x08,
-	0x22,0x00,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x00,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x62,0x08,0x23,0x00,0x62,0x08,0x22,0x00,0x62,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x63,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x62,0x00,
-	0x22,0x08,0x62,0x00,0x22,0x08,0x62,0x00,0x22,0x08,0x22,0x00,0x62,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x23,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x62,0x08,0x22,0x00,0x62,0x00,0x22,0x00,0x62,0x08,0x22,0x08,0x62,0x00,0x22,0x08,0x62,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x08,0x21,0x00,0x22,0x00,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x08,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x08,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,
-	0x22,0x00,0x21,0x08,0x21,0x00,0x22,0x00,0x21,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,
-	0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,
-	0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_3589_dial_img_0_244_data_0, "face_3589_dial_img_0_244_data_0.bin");
         
 
 
@@ -2171,7 +21,7 @@ const lv_img_dsc_t face_3589_dial_img_0_244_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 286,
-    .data_size = sizeof(face_3589_dial_img_0_244_data_0),
+    .data_size = 137280,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_3589_dial_img_0_244_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: 3589
 
 #include "../3589.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,16 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0xB2,0x94,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x14,0xA5,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0xBE,0xF7,0x5D,0xEF,0x24,0x21,0x00,0x00,0x24,0x21,0x5D,0xEF,0xBE,0xF7,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,
-	0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xBE,0xF7,0x5D,0xEF,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0xBE,0xF7,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x14,0xA5,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_0, "face_3589_dial_img_3_69392_data_0.bin");
         
 
 
@@ -29,22 +21,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_0),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xBE,0xF7,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0xF7,0xBD,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0xE7,0x39,0xF7,0xBD,0x00,0x00,0xBA,0xD6,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_1, "face_3589_dial_img_3_69392_data_1.bin");
         
 
 
@@ -52,22 +35,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_1),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x14,0xA5,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x5D,0xEF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0xBE,0xF7,0x14,0xA5,0x30,0x84,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xFB,0xDE,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xFB,0xDE,0x24,0x21,0x00,0x00,0x00,0x00,
-	0x30,0x84,0xFF,0xFF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0xAA,0x52,0xBE,0xF7,0xBE,0xF7,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0xFF,0xFF,0xBA,0xD6,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x14,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_2, "face_3589_dial_img_3_69392_data_2.bin");
         
 
 
@@ -75,22 +49,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_2),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x73,0x5D,0xEF,0xFF,0xFF,0xBE,0xF7,0x14,0xA5,0x00,0x00,0x2C,0x63,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0xBA,0xD6,0xFF,0xFF,0x96,0xAD,0x59,0xC6,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x5D,0xEF,0xBE,0xF7,0xAA,0x52,0x2C,0x63,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x5D,0xEF,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xBA,0xD6,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5D,0xEF,0x5D,0xEF,0x2C,0x63,
-	0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xBE,0xF7,0x5D,0xEF,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,0x96,0xAD,0xFF,0xFF,0xBA,0xD6,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x14,0xA5,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_3, "face_3589_dial_img_3_69392_data_3.bin");
         
 
 
@@ -98,22 +63,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_3),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0x59,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xC6,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,
-	0xCF,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x2C,0x63,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x2C,0x63,0xBE,0xF7,
-	0xFF,0xFF,0xCF,0x73,0x2C,0x63,0xF7,0xBD,0xFF,0xFF,0xB2,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xF7,0xBD,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x2C,0x63,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_4, "face_3589_dial_img_3_69392_data_4.bin");
         
 
 
@@ -121,22 +77,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_4),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x30,0x84,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0x96,0xAD,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xFB,0xDE,0x14,0xA5,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0x30,0x84,0x14,0xA5,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x2C,0x63,
-	0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xBE,0xF7,0xBE,0xF7,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,0x14,0xA5,0xFF,0xFF,0xBA,0xD6,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x14,0xA5,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_5, "face_3589_dial_img_3_69392_data_5.bin");
         
 
 
@@ -144,22 +91,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_5),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,
-	0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFF,0xFF,0x5D,0xEF,0xFF,0xFF,0x96,0xAD,0x00,0x00,0x14,0xA5,0xFF,0xFF,0xFB,0xDE,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0x14,0xA5,0x5D,0xEF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0xBE,0xF7,0xFF,0xFF,
-	0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x5D,0xEF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,0x14,0xA5,0xFF,0xFF,0xFB,0xDE,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x14,0xA5,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0xB2,0x94,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_6, "face_3589_dial_img_3_69392_data_6.bin");
         
 
 
@@ -167,22 +105,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_6),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFB,0xDE,0x2C,0x63,0xAA,0x52,0x00,0x00,0x00,0x00,
-	0x30,0x84,0xFF,0xFF,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xBE,0xF7,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0xF7,0x5D,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x30,0x84,0xFF,0xFF,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x59,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x96,0xAD,0xFF,0xFF,0xCF,0x73,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_7, "face_3589_dial_img_3_69392_data_7.bin");
         
 
 
@@ -190,22 +119,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_7),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xF7,0xBD,0xBA,0xD6,0xF7,0xBD,0x2C,0x63,0x00,0x00,0xAA,0x52,0xBE,0xF7,0xFF,0xFF,0xBA,0xD6,0xBE,0xF7,0xFF,0xFF,0xCF,0x73,0xF7,0xBD,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,0xBA,0xD6,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x14,0xA5,0xFF,0xFF,0x14,0xA5,0x00,0x00,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x59,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xAA,0x52,0x2C,0x63,0xFF,0xFF,0xFB,0xDE,0x14,0xA5,0xFB,0xDE,0xBE,0xF7,0xAA,0x52,0x5D,0xEF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0xFB,0xDE,0xFF,0xFF,
-	0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x5D,0xEF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0xBE,0xF7,0x14,0xA5,0xFF,0xFF,0xFB,0xDE,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0x14,0xA5,0x00,0x00,0xB2,0x94,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_8, "face_3589_dial_img_3_69392_data_8.bin");
         
 
 
@@ -213,22 +133,13 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_8),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_3_69392_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x5D,0xEF,0xFF,0xFF,0x5D,0xEF,0x14,0xA5,0x00,0x00,0xB2,0x94,0xFF,0xFF,0xFB,0xDE,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0xB2,0x94,0x5D,0xEF,0xBE,0xF7,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xBE,0xF7,0xBE,0xF7,0x24,0x21,0x00,0x00,0x24,0x21,0xBE,0xF7,0x5D,0xEF,0x14,0xA5,0xFF,0xFF,0xFB,0xDE,0x14,0xA5,0xFB,0xDE,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x96,0xAD,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBA,0xD6,0xFF,0xFF,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xFF,0xFF,0xBA,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_3589_dial_img_3_69392_data_9, "face_3589_dial_img_3_69392_data_9.bin");
         
 
 
@@ -236,7 +147,7 @@ const lv_img_dsc_t face_3589_dial_img_3_69392_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_3589_dial_img_3_69392_data_9),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_3589_dial_img_3_69392_data_9};
 
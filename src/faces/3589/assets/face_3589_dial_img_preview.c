@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 3589
-
-#include "../3589.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_3589_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x43,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x43,0x10,0x43,0x10,0x64,0x18,0x64,0x18,0x44,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x22,0x08,0x42,0x08,0x23,0x10,0x64,0x18,0x64,0x18,0x64,0x18,0x65,0x20,0x65,0x18,0x44,0x10,0x43,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x10,0x43,0x10,0x64,0x10,0x64,0x18,0x65,0x18,0x65,0x20,0x65,0x20,0x66,0x20,0x65,0x18,0x44,0x10,0x63,0x10,0x64,0x18,0x43,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x42,0x10,0x63,0x10,0x63,0x10,0x64,0x18,0x65,0x18,0x65,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x86,0x20,0x66,0x20,0x65,0x18,0x44,0x18,0x43,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x08,
-	0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x42,0x10,0x43,0x10,0x63,0x18,0x64,0x18,0x65,0x20,0x66,0x20,0xA7,0x20,0xA7,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA8,0x30,0xA9,0x30,0xA9,0x38,0xC9,0x40,0xA9,0x38,0x87,0x28,0x65,0x20,0x64,0x18,0x64,0x18,0x43,0x10,0x22,0x10,0x22,0x10,0x22,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x43,0x10,0x63,0x10,0x64,0x18,0x65,0x20,0x86,0x20,0x87,0x28,0xA8,0x28,0xA9,0x30,0xA9,0x38,0xCA,0x40,0xCA,0x40,0xCA,0x40,0xCA,0x40,0xCA,0x40,0x0B,0x51,0x2C,0x51,0xEB,0x48,0xCA,0x38,0x88,0x28,0x87,0x28,0x66,0x28,0x65,0x18,0x64,0x18,0x43,0x10,0x43,0x10,
-	0x22,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,
-	0x43,0x10,0x23,0x10,0x42,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x43,0x10,0x43,0x10,0x64,0x18,0x64,0x18,0x65,0x20,0x66,0x20,0xA7,0x28,0xA8,0x28,0xA9,0x30,0xCA,0x38,0xEB,0x48,0xCB,0x40,0xEB,0x48,0xEB,0x48,0xEB,0x48,0x4C,0x59,0x4C,0x59,0x0C,0x51,0xA9,0x38,0xA9,0x38,0x88,0x28,0x86,0x28,0x66,0x20,0x66,0x20,0x65,0x20,0x64,0x18,
-	0x63,0x10,0x43,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x23,0x00,
-	0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x43,0x10,0x43,0x10,0x63,0x18,
-	0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x43,0x10,0x43,0x10,0x64,0x18,0x64,0x20,0x65,0x20,0x86,0x28,0xA8,0x30,0xA9,0x30,0xCA,0x40,0xEC,0x50,0x0B,0x51,0x0C,0x51,0x6D,0x61,0x8D,0x61,0xAD,0x69,0xCD,0x69,0x6F,0x7A,0x2C,0x59,0xCA,0x40,0xA9,0x30,0x87,0x28,0x66,0x28,0x86,0x20,0x66,0x20,0x65,0x20,0x65,0x20,
-	0x44,0x18,0x43,0x18,0x23,0x10,0x43,0x10,0x22,0x10,0x22,0x10,0x42,0x10,0x22,0x10,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,
-	0x24,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x23,0x10,0x43,0x18,0x44,0x18,0x43,0x18,
-	0x23,0x10,0x23,0x10,0x43,0x10,0x23,0x10,0x43,0x10,0x43,0x10,0x64,0x18,0x86,0x28,0x87,0x28,0xA8,0x38,0x0A,0x41,0x4C,0x51,0x8D,0x61,0x0E,0x72,0x2E,0x72,0xCF,0x7A,0x10,0x83,0x10,0x83,0x10,0x83,0x10,0x83,0x50,0x83,0x50,0x83,0x30,0x83,0x8F,0x7A,0xED,0x69,0x2B,0x51,0xCA,0x40,0x88,0x30,0x88,0x30,0xA6,0x28,0x65,0x20,0x65,0x20,
-	0x64,0x18,0x63,0x18,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,
-	0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x42,0x10,0x23,0x10,0x43,0x18,0x43,0x18,0x43,0x18,
-	0x63,0x18,0x43,0x18,0x65,0x20,0x87,0x28,0xA8,0x38,0xEA,0x48,0x0D,0x51,0x6E,0x61,0x8E,0x72,0x8F,0x7A,0xEF,0x7A,0xD1,0x8B,0xD1,0x8B,0xD1,0x8B,0xD1,0x8B,0xD1,0x8B,0xD1,0x8B,0xD1,0x8B,0xD1,0x8B,0xD1,0x8B,0x32,0x94,0x32,0x94,0x11,0x8C,0x11,0x8C,0xD1,0x8B,0x91,0x8B,0x8F,0x7A,0x8F,0x72,0xAD,0x61,0x2D,0x59,0xEA,0x48,0xA9,0x38,
-	0x86,0x20,0x65,0x18,0x63,0x18,0x23,0x10,0x43,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,
-	0x26,0x00,0x49,0x00,0x26,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x43,0x18,0x65,0x20,0x66,0x28,0x88,0x30,
-	0xC9,0x40,0x0C,0x51,0x4F,0x61,0xB1,0x71,0x10,0x7A,0x52,0x8A,0xB3,0x92,0xB3,0x92,0xD1,0x82,0xF1,0x8A,0xB2,0x8B,0x31,0x8B,0xD1,0x8B,0xD1,0x8B,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x32,0x94,0x52,0x94,0x32,0x94,0x53,0x94,0x32,0x94,0x32,0x94,0x12,0x94,0x32,0x94,0x12,0x94,0x91,0x8B,0x11,0x83,0xD1,0x71,
-	0x4E,0x61,0xEB,0x40,0x87,0x30,0x65,0x20,0x23,0x10,0x43,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,
-	0x48,0x00,0x49,0x00,0x4B,0x00,0x4B,0x00,0x49,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x23,0x18,0x65,0x28,0x88,0x38,0xEC,0x50,0xF0,0x68,0xB2,0x89,
-	0x13,0x92,0x34,0x92,0x93,0x92,0x53,0x8A,0x53,0x8A,0xF2,0x79,0xD1,0x71,0xD1,0x71,0xD1,0x71,0xF2,0x81,0x53,0x8A,0x53,0x8A,0xD3,0x92,0xD3,0x92,0x13,0x93,0x94,0x9B,0xD4,0x9B,0xD4,0x9B,0xF5,0xA3,0xF5,0xA3,0xB5,0xA4,0xD5,0xA4,0xD5,0xA4,0x73,0x9C,0x13,0x93,0x93,0x8A,0x93,0x8A,0x93,0x9A,0x13,0x9B,0x34,0x9B,0x74,0xA3,0xF4,0x9A,
-	0x55,0xA3,0xB3,0x92,0x14,0x92,0x0F,0x69,0xAA,0x40,0x67,0x28,0x44,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x48,0x00,0x48,0x00,
-	0x48,0x00,0x4B,0x00,0x4C,0x00,0x6E,0x00,0x6E,0x00,0x6D,0x00,0x4B,0x00,0x49,0x00,0x48,0x00,0x48,0x00,0x27,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x24,0x20,0x89,0x48,0xED,0x60,0x53,0x89,0x35,0xA2,0x36,0xA2,0xD4,0x91,
-	0x71,0x81,0x71,0x79,0xF0,0x70,0x10,0x71,0x2F,0x61,0x0F,0x61,0x10,0x69,0x11,0x79,0x33,0x8A,0xD3,0x89,0xD3,0x89,0x74,0x92,0xB4,0x9A,0x55,0xA3,0x96,0xAB,0xD3,0x9B,0x16,0xAC,0x96,0xAC,0x16,0xAC,0xD6,0xAC,0xF6,0xAC,0xF6,0xAC,0xB6,0xAC,0x34,0x9B,0xF4,0x9A,0xF4,0x9A,0x34,0x9A,0x14,0x9A,0x54,0x92,0x94,0x89,0x73,0x89,0x93,0x89,
-	0xD4,0x91,0xD5,0xA2,0x15,0x9A,0x36,0xA2,0x56,0xAA,0xB4,0x91,0xCE,0x60,0x89,0x38,0x65,0x20,0x23,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x47,0x00,0x48,0x00,0x89,0x00,0x89,0x00,
-	0xAB,0x00,0xAB,0x00,0xAE,0x00,0xAF,0x00,0xCF,0x00,0xCF,0x00,0xAE,0x00,0xAE,0x00,0xAD,0x00,0xAB,0x00,0x49,0x00,0x48,0x00,0x27,0x00,0x26,0x00,0x25,0x00,0x25,0x08,0x24,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x23,0x18,0x25,0x30,0x6D,0x68,0xF3,0x98,0x96,0xA9,0x14,0xA1,0x12,0x91,0x0F,0x69,0xAC,0x60,
-	0xAC,0x58,0xCC,0x58,0xED,0x58,0x2F,0x61,0x10,0x71,0x32,0x81,0x92,0x81,0xB3,0x81,0xD3,0x89,0xD3,0x89,0xD3,0x89,0x33,0x92,0x54,0x9A,0x95,0xA2,0x14,0x9B,0x96,0xAB,0xD6,0xAB,0x96,0xAB,0xD6,0xAB,0xD6,0xAB,0xF6,0xAC,0xF6,0xAC,0xB6,0xAC,0x96,0xAB,0xB5,0xA2,0xB5,0xA2,0x76,0xAA,0x35,0xA2,0x15,0x9A,0xB4,0x91,0x92,0x81,0x51,0x79,
-	0x10,0x69,0x30,0x69,0x2E,0x61,0x30,0x69,0x32,0x81,0x94,0x89,0xD5,0xA1,0x55,0xA1,0x33,0x89,0xAC,0x58,0x45,0x28,0x22,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x44,0x00,0x44,0x00,0x64,0x00,0x65,0x00,0x87,0x00,0x87,0x00,0xA8,0x00,0xCA,0x00,0xCA,0x00,0xCC,0x00,
-	0x8E,0x00,0xEF,0x00,0xEF,0x00,0xEF,0x00,0xEF,0x00,0xEF,0x00,0xCF,0x00,0xCF,0x00,0xCE,0x00,0xCC,0x00,0xAB,0x00,0xAA,0x00,0x69,0x00,0x68,0x00,0x26,0x08,0x25,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x23,0x08,0x23,0x10,0x24,0x18,0x27,0x30,0x2C,0x58,0x70,0x88,0x91,0x90,0x92,0x90,0xF1,0x80,0xCF,0x70,0x8C,0x58,0xAC,0x58,0xCD,0x58,
-	0x0F,0x61,0xF0,0x70,0xF1,0x78,0x11,0x79,0x32,0x81,0x32,0x81,0x32,0x81,0x52,0x81,0x52,0x81,0x72,0x81,0x92,0x81,0xB3,0x89,0xD3,0x89,0x35,0xA2,0x35,0xA2,0x55,0xA2,0x97,0xAA,0x97,0xAA,0x56,0xAB,0xB7,0xAA,0x77,0xB3,0x98,0xB4,0xB9,0xBB,0x75,0xA2,0x35,0xA2,0x14,0x9A,0x14,0x9A,0xF4,0x91,0xB3,0x81,0xD3,0x91,0x74,0x89,0x53,0x89,
-	0x92,0x81,0x11,0x79,0x0F,0x61,0xEE,0x58,0xAB,0x48,0xAB,0x50,0xAD,0x58,0x0F,0x69,0x11,0x81,0x34,0xA1,0xF2,0x90,0x6A,0x50,0x24,0x20,0x22,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x43,0x00,0x63,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x86,0x00,0xA7,0x08,0xA9,0x00,0xCA,0x00,0xCB,0x00,0x0D,0x01,0x2E,0x01,
-	0x2F,0x01,0x91,0x09,0x71,0x01,0x71,0x01,0x71,0x01,0x4F,0x01,0x2F,0x01,0x2F,0x01,0x0D,0x01,0x0D,0x01,0xCC,0x00,0xCB,0x00,0xA9,0x00,0x87,0x08,0x66,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x24,0x10,0x26,0x18,0x2A,0x30,0x30,0x58,0x2F,0x68,0x4D,0x68,0x2A,0x58,0x28,0x48,0x2A,0x48,0xAF,0x68,0x8F,0x80,0xAE,0x68,0x11,0x79,0xEF,0x60,
-	0x10,0x69,0x10,0x69,0x0F,0x61,0x0D,0x61,0xCE,0x68,0x0F,0x61,0x0F,0x61,0x30,0x69,0x32,0x79,0x92,0x81,0x72,0x81,0xF4,0x91,0x14,0x9A,0x56,0xAA,0xB7,0xAA,0xD6,0xAA,0xD7,0xAA,0x56,0xAB,0xF7,0xAA,0x76,0xAB,0xBA,0xC3,0xFB,0xC3,0x17,0xB5,0xF7,0xAA,0x35,0xA2,0xB4,0x91,0xB2,0x81,0x30,0x69,0x30,0x69,0x30,0x69,0x2F,0x61,0x30,0x69,
-	0x10,0x71,0x10,0x69,0x10,0x69,0x0F,0x61,0xCE,0x50,0xCC,0x50,0xCD,0x60,0x87,0x38,0x68,0x38,0xAA,0x48,0xAD,0x60,0x6D,0x60,0x2E,0x68,0x29,0x48,0x23,0x20,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x43,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA6,0x00,0xA7,0x08,0xA8,0x00,0xA8,0x00,0xCA,0x00,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x71,0x01,
-	0xB3,0x09,0xD5,0x09,0xD5,0x09,0xB3,0x09,0x92,0x09,0x92,0x09,0x71,0x01,0x92,0x01,0x70,0x01,0x50,0x01,0x4F,0x01,0xEC,0x00,0xA9,0x00,0x86,0x00,0x47,0x00,0x44,0x08,0x26,0x08,0x69,0x18,0x4C,0x30,0x53,0x60,0x34,0x78,0x2F,0x58,0x29,0x40,0x27,0x30,0x27,0x30,0x29,0x40,0x4B,0x58,0x90,0x88,0xB1,0x88,0xF0,0x78,0x8D,0x60,0x8B,0x58,
-	0x8C,0x60,0xAC,0x58,0xAC,0x58,0xED,0x58,0x0F,0x61,0x11,0x71,0x11,0x79,0x53,0x81,0xF4,0x91,0xD5,0x99,0x35,0xA2,0x35,0xA2,0x35,0xA2,0x77,0xAA,0x5A,0xBB,0x16,0xAB,0x79,0xBB,0xD9,0xC2,0x9B,0xC3,0xDB,0xC3,0xFA,0xC3,0xFA,0xC3,0x19,0xC5,0xD9,0xB2,0x77,0xAA,0x35,0xA2,0x94,0x91,0xB3,0x89,0x91,0x71,0x0F,0x61,0xED,0x58,0xED,0x58,
-	0xEC,0x50,0xEC,0x50,0xCB,0x50,0xCB,0x50,0xAB,0x50,0xCB,0x50,0xCB,0x48,0xA9,0x30,0x67,0x38,0x66,0x28,0x45,0x28,0x46,0x30,0x26,0x40,0x28,0x50,0x27,0x48,0x23,0x20,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x85,0x00,0xA7,0x08,0xA8,0x00,0xC9,0x00,0xCA,0x00,0xEB,0x00,0x2D,0x01,0x4E,0x01,0x4F,0x01,0x92,0x09,
-	0xD5,0x09,0xD5,0x09,0xF6,0x09,0xF6,0x09,0xD5,0x09,0xB4,0x09,0xB4,0x09,0xD5,0x09,0xF6,0x09,0x92,0x09,0x4F,0x01,0xCC,0x00,0xA9,0x00,0xA7,0x08,0xA8,0x08,0xAB,0x10,0xD0,0x20,0x54,0x71,0xD8,0x58,0x53,0x60,0x2C,0x38,0x28,0x30,0x27,0x30,0x28,0x38,0x29,0x40,0x2A,0x48,0x2B,0x58,0x8D,0x60,0x4D,0x60,0xAC,0x58,0x89,0x48,0x8A,0x40,
-	0xAB,0x50,0xAD,0x60,0x0E,0x59,0xF0,0x68,0xF1,0x78,0x11,0x79,0x52,0x79,0x53,0x89,0x93,0x89,0x93,0x89,0x93,0x91,0xB5,0x91,0x35,0xA2,0x35,0xA2,0x56,0xA2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0x98,0xB2,0xDB,0xCA,0xD8,0xB2,0xD8,0xB2,0xD9,0xB2,0x98,0xB2,0x35,0xA2,0xD5,0x91,0x73,0x89,0x52,0x81,0x50,0x71,0x0F,0x61,0x0F,0x61,0x0E,0x59,
-	0xEC,0x50,0xEC,0x50,0xCA,0x40,0xA9,0x30,0xA7,0x30,0xA7,0x30,0x69,0x30,0x87,0x38,0x48,0x30,0x67,0x38,0x46,0x28,0x24,0x20,0x22,0x18,0x22,0x18,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x63,0x00,0x64,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0xA5,0x00,0xA7,0x08,0xA9,0x00,0xCA,0x00,0xCA,0x00,0x0C,0x01,0x2D,0x01,0x4F,0x01,0x92,0x09,0xB4,0x09,
-	0xD5,0x09,0x16,0x0A,0x37,0x0A,0x37,0x0A,0xD5,0x09,0xF5,0x09,0x57,0x0A,0x37,0x0A,0x16,0x0A,0x92,0x09,0x2E,0x01,0xEC,0x00,0xEB,0x00,0xED,0x08,0x72,0x11,0xB7,0x31,0x9A,0x51,0x77,0x49,0x90,0x38,0x29,0x28,0x29,0x28,0x49,0x30,0x29,0x30,0x28,0x38,0x28,0x38,0x28,0x38,0x29,0x40,0x29,0x40,0x4A,0x48,0x2C,0x50,0xAC,0x58,0xAC,0x58,
-	0xAC,0x58,0xEE,0x60,0xAD,0x60,0xAD,0x60,0x0E,0x59,0x0E,0x59,0x0F,0x61,0xF0,0x70,0x31,0x79,0x92,0x81,0x93,0x89,0xB3,0x89,0xB3,0x89,0xD6,0x99,0x57,0xAA,0x77,0xAA,0x98,0xB2,0x9B,0xCA,0xFC,0xCA,0xF9,0xBA,0x98,0xB2,0x98,0xB2,0xD9,0xB2,0x98,0xB2,0x14,0x9A,0x72,0x79,0x0F,0x61,0xEE,0x58,0xCC,0x50,0xCC,0x50,0xCC,0x50,0x0E,0x59,
-	0xCE,0x58,0xED,0x58,0xEC,0x50,0xCB,0x48,0x89,0x38,0x67,0x28,0x67,0x30,0x66,0x28,0x66,0x30,0x46,0x30,0x26,0x30,0x24,0x28,0x23,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x22,0x18,0x22,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA6,0x00,0xA7,0x08,0xA9,0x00,0x0C,0x01,0x2D,0x01,0x2D,0x01,0x2E,0x01,0x70,0x01,0x92,0x09,0xB4,0x09,
-	0xD5,0x09,0x37,0x0A,0x98,0x0A,0x98,0x0A,0x98,0x0A,0x98,0x12,0xB9,0x12,0x57,0x0A,0xD4,0x09,0x92,0x09,0x4E,0x01,0x91,0x01,0xB5,0x19,0x58,0x22,0xDB,0x33,0x7A,0x3A,0x34,0x29,0x6C,0x18,0x69,0x20,0x2A,0x28,0x2A,0x28,0x29,0x28,0x28,0x30,0x26,0x28,0x25,0x28,0x26,0x28,0x27,0x30,0x49,0x48,0x4A,0x48,0x8B,0x50,0xAC,0x58,0xAC,0x58,
-	0xAC,0x58,0x8B,0x58,0xAA,0x40,0xAA,0x40,0xAB,0x48,0xAC,0x50,0xCD,0x58,0x0F,0x61,0x10,0x69,0x52,0x79,0x52,0x79,0x52,0x81,0xB3,0x89,0xB5,0x91,0x16,0xA2,0x1B,0xAA,0xDB,0xCA,0x9C,0xCB,0xBC,0xCB,0xF9,0xBA,0x98,0xB2,0x98,0xB2,0xF9,0xBA,0xBB,0xCA,0x56,0xAA,0x72,0x81,0x0F,0x61,0xED,0x58,0xCC,0x50,0xCB,0x40,0xAB,0x40,0xAA,0x40,
-	0xCB,0x48,0xCB,0x48,0xCB,0x48,0xED,0x58,0xAA,0x40,0xA9,0x38,0x88,0x30,0x66,0x28,0x25,0x28,0x24,0x20,0x24,0x28,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x08,0x22,0x10,0x22,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x85,0x00,0x85,0x00,0xA5,0x00,0xA7,0x08,0xA8,0x00,0x0C,0x01,0x2D,0x01,0x2D,0x01,0x4F,0x01,0x71,0x01,0x92,0x09,0xD5,0x09,
-	0x37,0x0A,0x37,0x0A,0x57,0x0A,0xB9,0x12,0xF9,0x12,0x39,0x13,0x98,0x0A,0xF5,0x09,0xB4,0x09,0xB3,0x09,0x36,0x0A,0x9A,0x22,0x3B,0x2C,0x7B,0x34,0xB9,0x32,0x32,0x21,0xCD,0x18,0xAB,0x18,0x4B,0x20,0x2A,0x28,0x48,0x20,0x26,0x20,0x25,0x20,0x25,0x20,0x25,0x28,0x27,0x30,0x29,0x40,0x2A,0x48,0x49,0x48,0x28,0x38,0x28,0x38,0x69,0x48,
-	0x8A,0x48,0xAB,0x40,0xAA,0x40,0xA9,0x40,0xAA,0x40,0xAB,0x50,0xED,0x58,0x0E,0x59,0x0F,0x61,0xF0,0x70,0x31,0x71,0x52,0x79,0x73,0x89,0xB6,0x91,0x17,0xA2,0xDB,0xCA,0x9C,0xCB,0xBC,0xC2,0x9A,0xC2,0x59,0xAA,0xD7,0x99,0xD7,0x99,0xD6,0x99,0x56,0xAA,0x57,0xAA,0xD6,0x99,0x30,0x69,0xED,0x58,0xCC,0x50,0xCB,0x40,0xCA,0x40,0xA9,0x38,
-	0xA9,0x38,0xA9,0x30,0xA8,0x30,0x68,0x30,0x88,0x30,0x88,0x38,0x48,0x38,0x67,0x30,0x46,0x28,0x25,0x28,0x24,0x20,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x63,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x85,0x00,0x86,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x00,0x0C,0x01,0x2E,0x01,0x2E,0x01,0x4F,0x01,0x91,0x09,0xB4,0x09,0xF6,0x09,
-	0x37,0x0A,0x98,0x0A,0xD9,0x12,0x19,0x13,0x39,0x13,0xB9,0x12,0x37,0x0A,0xF5,0x09,0x57,0x0A,0xF9,0x12,0xBB,0x34,0x7C,0x4D,0x9B,0x3C,0x17,0x22,0x30,0x19,0x10,0x19,0x0E,0x19,0xCE,0x18,0x4A,0x18,0x27,0x18,0x26,0x18,0x26,0x20,0x25,0x20,0x26,0x28,0x26,0x28,0x27,0x30,0x27,0x30,0x47,0x38,0x28,0x30,0x27,0x30,0x28,0x38,0x89,0x40,
-	0x8A,0x50,0xAD,0x60,0xCC,0x58,0xCC,0x50,0xCC,0x50,0xCD,0x50,0xAE,0x60,0x0E,0x59,0x0F,0x59,0x0F,0x61,0x31,0x71,0x52,0x81,0xD6,0x91,0xD6,0x99,0x9B,0xCA,0xFC,0xCA,0x3C,0xB2,0xF8,0xA1,0xF7,0x99,0xD8,0x99,0xD7,0x99,0xB5,0x91,0x95,0x91,0xB5,0x91,0x17,0xAA,0xB5,0x91,0x73,0x81,0xEF,0x58,0xCC,0x40,0xCB,0x40,0xAA,0x38,0xA9,0x30,
-	0xA9,0x30,0xA9,0x30,0x67,0x30,0x67,0x28,0x67,0x28,0x67,0x30,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x24,0x28,0x23,0x20,0x22,0x18,0x21,0x10,0x21,0x10,0x22,0x18,0x22,0x20,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x43,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x08,0xA8,0x00,0x0C,0x01,0x4F,0x01,0x4F,0x01,0x70,0x01,0xB4,0x09,0xD5,0x09,0x16,0x0A,
-	0x57,0x0A,0xD9,0x12,0x5A,0x1B,0x5A,0x1B,0xF9,0x12,0xB9,0x12,0x37,0x0A,0xF9,0x12,0x1B,0x2C,0xDC,0x4D,0xDC,0x4D,0x9B,0x34,0x97,0x12,0x72,0x09,0x72,0x09,0x32,0x21,0x10,0x19,0xAC,0x18,0x47,0x18,0x27,0x18,0x26,0x18,0x26,0x20,0x27,0x28,0x26,0x20,0x25,0x20,0x25,0x28,0x27,0x30,0x28,0x38,0x29,0x40,0x29,0x40,0x8A,0x48,0x48,0x38,
-	0x89,0x40,0x8A,0x48,0xAB,0x50,0xCC,0x50,0xAD,0x58,0xEF,0x60,0x10,0x69,0xF1,0x78,0x11,0x79,0x11,0x79,0x52,0x79,0x93,0x89,0x59,0xB2,0xB6,0x91,0x78,0xAA,0xD6,0x99,0xB6,0x91,0xB6,0x91,0xB6,0x91,0xB6,0x91,0xB6,0x91,0x95,0x91,0x75,0x89,0x53,0x81,0x39,0xB2,0x95,0x89,0x94,0x89,0x32,0x79,0xED,0x50,0xAB,0x40,0xA9,0x38,0xA8,0x30,
-	0x88,0x28,0x87,0x28,0x88,0x28,0x66,0x28,0x66,0x30,0x66,0x28,0x86,0x28,0x44,0x20,0x44,0x20,0x24,0x20,0x44,0x20,0x24,0x28,0x23,0x20,0x22,0x18,0x21,0x10,0x21,0x10,0x22,0x18,0x23,0x20,0x21,0x18,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x63,0x00,0x44,0x00,0x44,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x86,0x00,0xA7,0x08,0xA7,0x08,0xA9,0x00,0xCA,0x00,0x0C,0x01,0x4F,0x01,0x92,0x09,0x92,0x09,0xB4,0x09,0xD5,0x09,0x16,0x0A,
-	0xD9,0x12,0x3A,0x1B,0x5A,0x1B,0xF9,0x12,0xB9,0x12,0xB9,0x12,0x59,0x1B,0x7C,0x45,0xDC,0x4D,0x1D,0x56,0xDA,0x23,0x99,0x22,0xF6,0x09,0xD6,0x11,0xD6,0x11,0x33,0x21,0x0F,0x19,0xAB,0x18,0x49,0x18,0x28,0x18,0x28,0x20,0x28,0x28,0x26,0x20,0x25,0x20,0x25,0x20,0x25,0x20,0x27,0x30,0x28,0x38,0x28,0x38,0x27,0x30,0x26,0x30,0x26,0x28,
-	0x26,0x28,0x46,0x28,0x67,0x28,0x67,0x30,0xA9,0x38,0xAB,0x48,0xEE,0x58,0x10,0x69,0x52,0x79,0x52,0x79,0x31,0x71,0x30,0x69,0x51,0x71,0x94,0x89,0xB5,0x91,0x74,0x79,0xD6,0x91,0xD6,0x99,0xB6,0x91,0xB6,0x91,0xB6,0x91,0x75,0x81,0x94,0x89,0x74,0x79,0x72,0x79,0x52,0x79,0x73,0x89,0xB6,0x91,0x10,0x69,0xCB,0x48,0xAA,0x38,0xA7,0x30,
-	0x67,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x65,0x28,0x65,0x20,0x44,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x20,0x24,0x28,0x24,0x28,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA8,0x00,0xC9,0x00,0xCA,0x00,0x2E,0x01,0x71,0x01,0x92,0x09,0x92,0x09,0xB4,0x09,0x16,0x0A,0xB9,0x12,
-	0x5A,0x1B,0x39,0x13,0xF9,0x12,0xF9,0x12,0xF9,0x12,0xDA,0x23,0x1D,0x56,0x1D,0x56,0xBC,0x4D,0xFA,0x23,0x5A,0x1B,0x5A,0x1B,0xB9,0x22,0x99,0x22,0xB7,0x21,0x73,0x11,0x31,0x19,0xF0,0x20,0xCF,0x20,0x4C,0x20,0x4A,0x28,0x28,0x20,0x27,0x20,0x26,0x20,0x26,0x28,0x25,0x28,0x27,0x30,0x27,0x30,0x28,0x38,0x26,0x28,0x24,0x20,0x24,0x20,
-	0x24,0x20,0x24,0x20,0x25,0x20,0x65,0x20,0x66,0x28,0x86,0x28,0xAC,0x48,0xAA,0x38,0xCC,0x50,0xEE,0x58,0xEF,0x60,0x10,0x69,0x10,0x61,0x73,0x81,0x54,0x79,0x74,0x81,0xD6,0x99,0xB5,0x91,0xB6,0x91,0x37,0xA2,0x37,0xA2,0x95,0x91,0x75,0x89,0x53,0x79,0x31,0x71,0x31,0x71,0x32,0x71,0x74,0x89,0x73,0x81,0xEE,0x58,0xCD,0x50,0xA9,0x30,
-	0xA8,0x30,0x46,0x20,0x65,0x20,0x65,0x20,0x65,0x20,0x24,0x20,0x24,0x18,0x43,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x22,0x18,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x00,0x43,0x00,0x44,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA9,0x00,0xC9,0x00,0x0C,0x01,0x2E,0x01,0x71,0x01,0xB3,0x09,0x92,0x09,0xD4,0x09,0x37,0x0A,0x19,0x13,
-	0x39,0x13,0xB9,0x12,0xB9,0x12,0xF9,0x12,0x7B,0x34,0xBC,0x4D,0x9D,0x6E,0x1D,0x56,0xBC,0x4D,0xDC,0x3C,0x7B,0x34,0x7B,0x34,0x1B,0x2C,0x79,0x2A,0xB7,0x21,0x97,0x29,0x96,0x21,0x55,0x29,0xD1,0x20,0x6D,0x20,0x4B,0x28,0x29,0x20,0x2A,0x28,0x2A,0x28,0x29,0x38,0x27,0x30,0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x28,0x24,0x20,0x24,0x20,
-	0x24,0x18,0x24,0x18,0x44,0x20,0x24,0x20,0x65,0x20,0x65,0x20,0x66,0x28,0x67,0x28,0x88,0x30,0xA9,0x38,0xCD,0x48,0xEF,0x60,0x31,0x69,0xB6,0x91,0x53,0x79,0x54,0x79,0x95,0x91,0xB6,0x91,0x95,0x91,0xD7,0x99,0xD7,0x99,0xD7,0x99,0xB6,0x89,0x53,0x79,0x12,0x69,0x10,0x69,0x10,0x59,0x32,0x71,0x74,0x89,0xCF,0x58,0xCC,0x50,0xAA,0x38,
-	0xAA,0x38,0x46,0x20,0x65,0x20,0x45,0x20,0x44,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x20,0x23,0x18,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x10,0x22,0x10,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x43,0x00,0x63,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x86,0x00,0xA7,0x08,0xA8,0x00,0xCA,0x00,0xCB,0x00,0x2D,0x01,0x4F,0x01,0xD5,0x09,0xB3,0x09,0xB3,0x09,0x37,0x0A,0xB9,0x12,0xD9,0x12,
-	0xB9,0x12,0x98,0x0A,0x19,0x13,0xBB,0x34,0x1D,0x56,0xBD,0x6E,0x1D,0x56,0x1D,0x56,0x5C,0x45,0x1D,0x56,0xBC,0x4D,0xDC,0x3C,0x9B,0x2B,0x1A,0x2B,0x9B,0x2A,0xBB,0x3A,0xFB,0x39,0x98,0x29,0xF3,0x30,0x70,0x28,0x2E,0x28,0x2D,0x30,0x4E,0x38,0x2D,0x48,0x29,0x40,0x27,0x30,0x26,0x28,0x28,0x38,0x27,0x30,0x26,0x28,0x24,0x20,0x24,0x20,
-	0x23,0x18,0x23,0x18,0x24,0x18,0x44,0x18,0x24,0x18,0x65,0x20,0x65,0x20,0x46,0x20,0x66,0x28,0x67,0x30,0xAA,0x38,0xCD,0x50,0x53,0x79,0xB6,0x91,0x53,0x79,0x53,0x79,0x74,0x81,0x95,0x89,0xB6,0x91,0xB6,0x91,0xB6,0x91,0xB7,0x91,0xD8,0xA2,0xF6,0x9A,0xD4,0x8A,0xB3,0x82,0xB3,0x82,0xB3,0x82,0x94,0x8A,0x0E,0x59,0xCC,0x48,0xAB,0x40,
-	0x89,0x30,0x67,0x30,0x67,0x28,0x46,0x28,0x45,0x20,0x44,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x28,0x04,0x28,0x04,0x28,0x04,0x28,0x03,0x20,0x02,0x18,0x02,0x10,0x02,0x10,0x02,0x18,0x02,0x10,0x01,0x10,0x01,0x10,0x01,0x08,0x01,0x10,0x01,0x18,0x26,0x39,0xE8,0x49,0xE8,0x49,0xE9,0x51,0xE9,0x51,0xE8,0x51,0xE8,0x41,0x07,0x42,
-	0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x23,0x00,0x44,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0xA7,0x08,0xA7,0x08,0xA9,0x00,0xCA,0x00,0xCB,0x08,0x2D,0x01,0x71,0x01,0xD5,0x09,0xD5,0x09,0x16,0x0A,0x39,0x12,0x79,0x12,0x57,0x0A,
-	0x19,0x13,0x19,0x13,0xBB,0x34,0xFD,0x4D,0xBD,0x6E,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xBC,0x4D,0xDC,0x3C,0x9B,0x2B,0x9B,0x2B,0x9B,0x33,0xBB,0x3A,0x1A,0x22,0x55,0x29,0xF3,0x30,0x71,0x30,0x90,0x28,0x51,0x40,0x92,0x50,0x2F,0x48,0x2B,0x40,0x29,0x30,0x27,0x30,0x27,0x30,0x28,0x38,0x27,0x30,0x26,0x28,0x24,0x20,
-	0x23,0x18,0x23,0x18,0x23,0x18,0x43,0x18,0x24,0x18,0x44,0x18,0x45,0x20,0x45,0x20,0x46,0x20,0x66,0x28,0x88,0x30,0xAB,0x40,0x11,0x69,0xB6,0x91,0x74,0x81,0x53,0x79,0x74,0x81,0x95,0x89,0xB6,0x91,0xB6,0x91,0xB6,0x91,0xB6,0x91,0x3E,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0xD6,0x2C,0x49,0xAA,0x38,0x89,0x38,
-	0x89,0x38,0x89,0x30,0x88,0x30,0x67,0x28,0x46,0x28,0x25,0x20,0x24,0x20,0x24,0x20,0x24,0x20,0x25,0x28,0x05,0x30,0x04,0x28,0x03,0x20,0x03,0x18,0x02,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x02,0x10,0x02,0x10,0x01,0x10,0x01,0x08,0x01,0x08,0x42,0x18,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x46,0x31,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x00,0x63,0x00,0x23,0x00,0x43,0x00,0x44,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA7,0x08,0xA8,0x08,0xA9,0x00,0xCA,0x00,0xCC,0x08,0x2F,0x01,0x71,0x09,0xD6,0x09,0x37,0x0A,0x38,0x12,0x79,0x12,0x37,0x0A,0x37,0x0A,
-	0xF9,0x12,0xBB,0x34,0x7D,0x66,0x1E,0x87,0x1D,0x56,0x1D,0x56,0x1D,0x56,0xDD,0x76,0xDD,0x76,0xFD,0x55,0xDC,0x3C,0x3C,0x3C,0xBC,0x3C,0xDB,0x33,0x7B,0x2A,0x1A,0x22,0x97,0x29,0x34,0x21,0x11,0x21,0x6F,0x20,0x8F,0x30,0x91,0x30,0x70,0x48,0x2D,0x40,0x2A,0x38,0x2A,0x30,0x28,0x38,0x27,0x30,0x29,0x40,0x29,0x40,0x27,0x30,0x25,0x28,
-	0x25,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x18,0x24,0x18,0x45,0x18,0x45,0x20,0x46,0x20,0x67,0x28,0x8A,0x38,0xCD,0x48,0x95,0x89,0x95,0x89,0x74,0x81,0x74,0x81,0x75,0x81,0x75,0x81,0x96,0x89,0x77,0xA1,0xDA,0xCC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xE7,0x76,0x7D,0xEE,0x52,0x67,0x30,
-	0x67,0x28,0x67,0x28,0x46,0x28,0x46,0x28,0x45,0x20,0x24,0x18,0x43,0x18,0x24,0x18,0x24,0x20,0x25,0x28,0x04,0x28,0x03,0x20,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x01,0x10,0x01,0x10,0x02,0x10,0x01,0x10,0x02,0x18,0x02,0x10,0x8A,0x50,0x54,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xF0,0x6B,0xAA,0x32,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x63,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0xA7,0x08,0xA8,0x08,0xA9,0x00,0xCB,0x08,0x0C,0x01,0x2F,0x09,0xB4,0x09,0x18,0x12,0x3A,0x1A,0x3A,0x1A,0x37,0x0A,0x17,0x0A,0x19,0x1A,
-	0x9B,0x34,0x9D,0x6E,0x1E,0x87,0x7D,0x66,0x1D,0x56,0x9D,0x6E,0x1D,0x56,0x5D,0x5E,0xDC,0x4D,0xDC,0x3C,0xDC,0x3C,0xDC,0x3C,0xDB,0x33,0xFA,0x2A,0x3B,0x22,0xD8,0x21,0x55,0x21,0x11,0x21,0xCE,0x18,0xCF,0x20,0xAF,0x20,0x8F,0x28,0x4D,0x30,0x2C,0x28,0x2A,0x30,0x49,0x30,0x27,0x30,0x28,0x30,0x29,0x40,0x29,0x40,0x28,0x38,0x27,0x28,
-	0x26,0x28,0x24,0x20,0x23,0x18,0x24,0x18,0x43,0x18,0x24,0x18,0x24,0x18,0x44,0x18,0x45,0x20,0x45,0x20,0x66,0x28,0x88,0x30,0xAA,0x38,0x32,0x71,0xB6,0x91,0x76,0x81,0x53,0x79,0x53,0x79,0x74,0x81,0x57,0xA1,0x79,0xC2,0x5E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x6C,0x67,0x30,
-	0x67,0x28,0x46,0x28,0x45,0x20,0x45,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x18,0x24,0x20,0x24,0x20,0x03,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x69,0x50,0x59,0xC2,0x3E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x75,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x24,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x86,0x00,0xA7,0x08,0xA8,0x00,0xCA,0x00,0xCC,0x08,0xED,0x10,0x50,0x01,0xF6,0x09,0x3B,0x22,0x38,0x0A,0x37,0x0A,0xF6,0x09,0x58,0x12,0x9C,0x3C,
-	0x7D,0x66,0x1E,0x87,0x9D,0x6E,0xDC,0x4D,0x1D,0x56,0x1D,0x56,0xBC,0x4D,0xDC,0x3C,0xFC,0x3B,0xBC,0x3C,0xBC,0x3C,0xDB,0x33,0x1B,0x2B,0x3B,0x22,0x19,0x1A,0xB5,0x11,0x33,0x21,0x30,0x19,0xEF,0x18,0xAD,0x18,0xCE,0x20,0x6C,0x20,0x4A,0x20,0x2A,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x26,0x30,0x27,0x30,0x28,0x38,0x28,0x38,0x28,0x30,
-	0x26,0x28,0x45,0x20,0x24,0x20,0x24,0x18,0x23,0x18,0x23,0x10,0x44,0x18,0x24,0x18,0x45,0x18,0x45,0x20,0x46,0x20,0x68,0x28,0x8A,0x38,0xCD,0x48,0x75,0x81,0xB6,0x91,0x96,0x81,0x32,0x69,0x54,0x81,0x79,0xBA,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x64,0x67,0x30,
-	0x47,0x28,0x46,0x28,0x45,0x20,0x45,0x20,0x24,0x20,0x23,0x18,0x23,0x18,0x24,0x20,0x44,0x20,0x23,0x20,0x02,0x18,0x02,0x18,0x02,0x18,0x01,0x10,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x10,0x01,0x10,0x23,0x20,0x14,0x99,0x5C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x64,0x00,0x65,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x86,0x00,0xA7,0x08,0xA8,0x00,0xCA,0x08,0xCC,0x08,0x0D,0x11,0x92,0x09,0x18,0x1A,0x3A,0x1A,0x37,0x0A,0xB6,0x19,0x3A,0x1A,0xFC,0x3B,0x9D,0x6E,
-	0x1E,0x87,0x7D,0x66,0x1C,0x3D,0x9C,0x45,0xDC,0x4D,0x1C,0x3D,0x9C,0x3C,0x9A,0x23,0xBA,0x23,0xBC,0x3C,0xDB,0x33,0xDB,0x32,0x9B,0x2A,0x5B,0x22,0x1A,0x1A,0xF6,0x11,0x73,0x11,0x12,0x21,0x12,0x21,0xD0,0x20,0xD0,0x20,0x6B,0x18,0x49,0x18,0x29,0x20,0x28,0x28,0x27,0x28,0x26,0x28,0x25,0x28,0x25,0x28,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x26,0x28,0x24,0x20,0x24,0x18,0x24,0x18,0x24,0x18,0x44,0x18,0x24,0x18,0x44,0x18,0x45,0x18,0x45,0x20,0x67,0x28,0x69,0x30,0x8A,0x38,0xF0,0x58,0x97,0x89,0x55,0x79,0x12,0x61,0x7A,0xC4,0x5E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x6C,0x68,0x30,
-	0x47,0x28,0x46,0x28,0x45,0x20,0x45,0x20,0x24,0x20,0x24,0x18,0x24,0x18,0x44,0x20,0x24,0x20,0x03,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x01,0x10,0x02,0x10,0x01,0x10,0x02,0x18,0x02,0x18,0x02,0x18,0x01,0x10,0x8A,0x50,0x39,0xCB,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,0x64,0x00,0x64,0x00,0x65,0x00,0x86,0x08,0x65,0x08,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0x67,0x00,0xA8,0x08,0xCA,0x00,0xCC,0x08,0x2F,0x09,0x18,0x12,0x1A,0x22,0x17,0x0A,0xD7,0x19,0x3B,0x22,0x5B,0x33,0x5D,0x5E,0x1E,0x87,
-	0xFD,0x7E,0x3C,0x45,0x1D,0x56,0x1C,0x3D,0x7C,0x34,0xBB,0x2B,0x1A,0x1B,0x5A,0x1B,0x5B,0x34,0xBB,0x33,0x1A,0x23,0xDB,0x32,0xBB,0x2A,0x3B,0x22,0x3B,0x22,0xD8,0x21,0x54,0x21,0xF0,0x08,0xF0,0x18,0xF1,0x20,0xD0,0x20,0x8B,0x18,0x69,0x20,0x4A,0x20,0x28,0x28,0x27,0x20,0x26,0x20,0x25,0x20,0x24,0x20,0x25,0x20,0x26,0x28,0x26,0x28,
-	0x25,0x28,0x25,0x28,0x45,0x20,0x45,0x20,0x25,0x20,0x25,0x20,0x24,0x18,0x44,0x18,0x44,0x18,0x45,0x18,0x45,0x18,0x47,0x20,0xAA,0x30,0x6C,0x49,0xAE,0x59,0x96,0x8A,0x9A,0xB3,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x64,0x69,0x30,
-	0x68,0x30,0x66,0x28,0x45,0x20,0x25,0x20,0x24,0x20,0x24,0x20,0x25,0x28,0x44,0x20,0x23,0x18,0x02,0x18,0x02,0x18,0x02,0x10,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x10,0x02,0x18,0x02,0x18,0x02,0x18,0x03,0x20,0x97,0xB1,0x5D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x01,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x08,0xA7,0x08,0x87,0x08,0x86,0x08,0x46,0x08,0xA6,0x08,0xA6,0x08,0xA7,0x08,0xA7,0x08,0xA9,0x08,0xCB,0x08,0xCD,0x08,0x93,0x11,0x1A,0x22,0xD9,0x21,0xD8,0x21,0x1A,0x1A,0x1B,0x2B,0x3D,0x66,0xDD,0x76,0x1E,0x87,
-	0xFD,0x55,0x7C,0x45,0xFC,0x3C,0x9B,0x33,0xFA,0x2A,0x79,0x1A,0x3A,0x23,0x7A,0x23,0x9B,0x33,0x5A,0x23,0xDB,0x32,0xDB,0x32,0xDB,0x32,0xBB,0x2A,0x3B,0x22,0x96,0x21,0x94,0x11,0x11,0x19,0x11,0x19,0x12,0x21,0xD0,0x20,0x4C,0x18,0x8B,0x18,0x4A,0x20,0x2A,0x28,0x27,0x20,0x26,0x20,0x25,0x20,0x24,0x18,0x24,0x20,0x24,0x20,0x24,0x20,
-	0x25,0x20,0x25,0x20,0x25,0x20,0x25,0x20,0x65,0x20,0x25,0x20,0x45,0x18,0x45,0x18,0x45,0x18,0x45,0x18,0x45,0x18,0x46,0x20,0xAC,0x49,0x9B,0xD6,0x1C,0xDF,0x9E,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x64,0x69,0x30,
-	0x68,0x30,0x47,0x28,0x45,0x20,0x25,0x20,0x24,0x20,0x45,0x20,0x24,0x20,0x23,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x18,0x02,0x10,0x01,0x10,0xAF,0x78,0x39,0xCB,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x00,0x65,0x08,0x65,0x08,0x65,0x08,0x86,0x08,0x86,0x08,0x46,0x08,0xA8,0x08,0xA8,0x08,0xA7,0x08,0x87,0x08,0x87,0x08,0xA8,0x08,0xA9,0x08,0xCA,0x00,0xCC,0x08,0x51,0x19,0xD7,0x21,0x38,0x22,0xD7,0x19,0x38,0x12,0x7B,0x22,0x9C,0x4D,0xFE,0x8E,0xDE,0xAE,0x5C,0x45,
-	0xDC,0x3C,0x9C,0x3C,0xBC,0x33,0x7B,0x22,0x39,0x1A,0x38,0x22,0x1A,0x2B,0xDA,0x32,0x19,0x1B,0xDA,0x2A,0xDB,0x32,0xDB,0x32,0xBB,0x2A,0x3B,0x2A,0x3B,0x22,0xF7,0x11,0x54,0x21,0x11,0x19,0x33,0x21,0x55,0x29,0xF0,0x20,0x8D,0x20,0x4C,0x18,0x4B,0x28,0x2A,0x28,0x28,0x20,0x27,0x20,0x25,0x20,0x24,0x18,0x23,0x18,0x24,0x18,0x23,0x18,
-	0x24,0x18,0x24,0x18,0x24,0x20,0x25,0x20,0x26,0x20,0x46,0x20,0x46,0x20,0x46,0x20,0x45,0x18,0x45,0x18,0x67,0x28,0x8A,0x40,0x10,0x72,0x7E,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x64,0x68,0x28,
-	0x47,0x28,0x47,0x28,0x25,0x28,0x25,0x20,0x25,0x20,0x25,0x28,0x24,0x20,0x22,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x18,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x18,0x01,0x18,0x01,0x10,0x25,0x30,0x76,0xA9,0xFD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x00,0x46,0x08,0x87,0x08,0x67,0x08,0x87,0x08,0x87,0x08,0x87,0x08,0xA7,0x08,0xA9,0x08,0xAA,0x08,0xA9,0x08,0xA9,0x08,0xA9,0x00,0xAA,0x08,0xED,0x10,0x30,0x19,0xF6,0x11,0x39,0x2A,0x39,0x2A,0x38,0x22,0xDB,0x2A,0x3D,0x5C,0xBE,0xB6,0xFE,0x9E,0xFD,0x55,0xDC,0x3C,
-	0x9C,0x3C,0xDC,0x3B,0xDB,0x2A,0x38,0x12,0x39,0x22,0x9A,0x2A,0xBA,0x2A,0x59,0x2A,0x59,0x2A,0x59,0x2A,0x79,0x2A,0x7B,0x22,0x1B,0x33,0x9B,0x2A,0x3B,0x22,0xB8,0x21,0x52,0x19,0x53,0x21,0x55,0x29,0x55,0x29,0x13,0x29,0xAF,0x20,0x4E,0x20,0x4C,0x20,0x4A,0x28,0x28,0x20,0x27,0x20,0x26,0x20,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x24,0x18,0x24,0x18,0x26,0x20,0x46,0x20,0x46,0x20,0x46,0x20,0x46,0x20,0x45,0x18,0xD1,0x78,0x58,0xB9,0x99,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x64,0x47,0x28,
-	0x47,0x28,0x46,0x28,0x46,0x28,0x25,0x20,0x25,0x20,0x25,0x20,0x23,0x18,0x22,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x18,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x01,0x10,0xD0,0x80,0x9B,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x00,0x10,0x01,0x10,0x01,0x18,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x10,0x87,0x08,0x87,0x08,0xA8,0x08,0x87,0x08,0x87,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xCC,0x10,0xED,0x10,0xCC,0x10,0xCB,0x10,0xCD,0x08,0x31,0x19,0xD8,0x29,0x79,0x2A,0x79,0x2A,0xDB,0x32,0x1B,0x33,0xDD,0x5C,0xFE,0x96,0xFF,0xD6,0xDE,0x86,0x9D,0x5D,0xDE,0x6C,
-	0x5C,0x3C,0xFB,0x32,0x3A,0x22,0x3A,0x22,0x7B,0x22,0x79,0x2A,0x58,0x1A,0x59,0x22,0x59,0x2A,0x9A,0x2A,0x59,0x2A,0x39,0x22,0x3A,0x22,0x3B,0x22,0x1A,0x1A,0x75,0x21,0x73,0x11,0x34,0x21,0x55,0x29,0x56,0x31,0xF2,0x28,0xF1,0x20,0xAE,0x20,0x4C,0x28,0x2B,0x28,0x29,0x28,0x27,0x20,0x26,0x20,0x25,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x10,0x23,0x10,0x24,0x18,0x25,0x18,0x26,0x20,0x47,0x20,0x47,0x20,0x46,0x20,0x45,0x18,0xF2,0x80,0x58,0xB9,0x99,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x5C,0x47,0x28,
-	0x47,0x28,0x46,0x28,0x46,0x20,0x25,0x20,0x25,0x28,0x24,0x20,0x22,0x10,0x22,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x02,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x67,0x40,0x18,0xC2,0x1E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x00,0x08,0x00,0x10,0x01,0x18,0x21,0x18,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA8,0x08,0xA9,0x10,0xAA,0x08,0xEE,0x18,0x32,0x21,0x51,0x11,0x34,0x21,0x38,0x2A,0x9C,0x42,0xDC,0x4A,0x3C,0x53,0x9B,0x33,0x5D,0x5C,0x9F,0xC6,0x9F,0xEF,0x1E,0xC7,0xDD,0x76,0x1E,0x6D,0x3D,0x5C,
-	0x9B,0x33,0xDB,0x32,0x59,0x2A,0xBA,0x2A,0xBA,0x2A,0x59,0x2A,0x38,0x22,0xF8,0x29,0x59,0x2A,0x59,0x2A,0x59,0x22,0x59,0x22,0x39,0x22,0xD9,0x21,0xD8,0x21,0x53,0x19,0x52,0x11,0x32,0x21,0x55,0x29,0x56,0x31,0xF2,0x28,0xCF,0x20,0x6F,0x20,0x6C,0x20,0x2B,0x20,0x29,0x20,0x27,0x20,0x26,0x18,0x24,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x22,0x10,0x23,0x10,0x23,0x10,0x25,0x18,0x25,0x20,0x26,0x20,0x48,0x28,0x47,0x20,0x46,0x20,0xD0,0x78,0x58,0xB9,0x99,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x5C,0x47,0x28,
-	0x46,0x28,0x46,0x28,0x46,0x28,0x25,0x20,0x25,0x20,0x23,0x18,0x22,0x10,0x22,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x02,0x18,0xF2,0x90,0xDB,0xDC,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x00,0x10,0x00,0x08,0x00,0x10,0x21,0x18,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x08,0xAA,0x08,0xAA,0x10,0xAA,0x10,0xCA,0x08,0xCC,0x10,0x0F,0x19,0x96,0x21,0x39,0x32,0x5A,0x32,0x7C,0x3A,0x7C,0x43,0x9C,0x43,0x5D,0x54,0x5E,0x7D,0x9F,0xC6,0xBF,0xF7,0xBF,0xF7,0xDF,0xD6,0xFE,0xA6,0x1E,0x75,0xDD,0x54,
-	0x9B,0x33,0xDB,0x32,0xFB,0x32,0xDB,0x32,0x59,0x2A,0x17,0x12,0xF8,0x29,0x39,0x2A,0x39,0x2A,0x39,0x2A,0x39,0x2A,0xD8,0x21,0xB8,0x29,0xB7,0x21,0x54,0x29,0x52,0x11,0x10,0x19,0x32,0x21,0x55,0x29,0x55,0x29,0x13,0x29,0xCF,0x20,0xAE,0x20,0x4C,0x28,0x2B,0x28,0x2B,0x28,0x28,0x20,0x25,0x18,0x24,0x18,0x23,0x10,0x22,0x10,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x24,0x10,0x45,0x18,0x27,0x20,0x49,0x28,0x48,0x20,0x47,0x20,0xF2,0x80,0x58,0xB9,0x99,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xDE,0xE7,0xDE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x5C,0x47,0x20,
-	0x46,0x28,0x46,0x20,0x25,0x18,0x23,0x18,0x24,0x18,0x23,0x18,0x22,0x10,0x21,0x10,0x01,0x08,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x68,0x48,0x78,0xC2,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xCF,0x9D,0xC7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x01,0x18,0x00,0x10,0x00,0x08,0x21,0x18,0x21,0x20,0x20,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x10,0xEC,0x10,0xCC,0x10,0xCC,0x10,0xCC,0x10,0xCC,0x10,0xCC,0x10,0xCC,0x10,0xED,0x10,0xED,0x10,0x10,0x19,0x33,0x21,0x97,0x29,0x7A,0x32,0x1E,0x64,0x3E,0x6C,0x7C,0x4B,0x7E,0x6C,0xFE,0x7D,0x1E,0xCF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xFE,0xA6,0x5E,0x76,0x3D,0x54,
-	0x5D,0x53,0x9B,0x33,0x9B,0x33,0x79,0x2A,0x38,0x2A,0x18,0x2A,0xF8,0x29,0xF8,0x29,0xD8,0x29,0x18,0x2A,0xD8,0x29,0xB7,0x21,0xB7,0x21,0x75,0x19,0x32,0x21,0xEF,0x18,0x50,0x11,0x31,0x19,0x55,0x29,0x36,0x31,0x14,0x29,0xCF,0x20,0x6F,0x20,0x6C,0x28,0x2C,0x28,0x2E,0x30,0x28,0x18,0x25,0x18,0x24,0x10,0x23,0x10,0x22,0x10,0x22,0x10,
-	0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x24,0x10,0x26,0x18,0x26,0x20,0x48,0x20,0x48,0x20,0xF2,0x80,0x58,0xB9,0x39,0xC2,0xDC,0xE5,0xDD,0xDE,0x9D,0xC7,0x9D,0xBF,0x9C,0xAF,0x7C,0xA7,0x7C,0x97,0xBE,0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x5C,0x26,0x20,
-	0x26,0x20,0x25,0x18,0x04,0x10,0x03,0x18,0x03,0x18,0x22,0x10,0x21,0x10,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x02,0x18,0x55,0xA1,0xDC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x7C,0xA7,0xBE,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x01,0x18,0x01,0x10,0x00,0x08,0x21,0x08,0x21,0x18,0x21,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x10,0xCC,0x10,0xED,0x18,0xED,0x10,0xED,0x10,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x2F,0x19,0x31,0x19,0x31,0x21,0x55,0x29,0x97,0x29,0x5A,0x32,0x5D,0x63,0x5E,0x96,0x5E,0x9D,0xDE,0x95,0x1E,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xDF,0xFE,0xA6,0x7E,0x7E,0x3C,0x4C,
-	0x1C,0x4C,0x7D,0x53,0x5B,0x3B,0x59,0x2A,0x39,0x22,0xD8,0x29,0x18,0x2A,0x18,0x2A,0xD8,0x29,0xB7,0x29,0x75,0x21,0x55,0x29,0x95,0x11,0x34,0x21,0x31,0x21,0xEF,0x08,0x0F,0x19,0xF1,0x18,0x32,0x21,0x55,0x29,0x34,0x21,0xCF,0x20,0x8D,0x18,0x2C,0x18,0x2A,0x20,0x28,0x10,0x27,0x10,0x25,0x10,0x23,0x10,0x22,0x10,0x21,0x10,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x23,0x10,0x23,0x10,0x25,0x10,0x26,0x18,0x48,0x18,0x69,0x20,0xF2,0x80,0x58,0xB9,0x37,0xB1,0x37,0xB1,0x58,0x9C,0x7C,0x97,0x3B,0x8F,0x1B,0x8F,0xFB,0x96,0x7B,0x9E,0x5D,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x53,0x5C,0x26,0x20,
-	0x25,0x18,0x23,0x10,0x03,0x10,0x02,0x10,0x03,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x10,0x8C,0x60,0xF9,0xCA,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xDF,0x7C,0x97,0xBE,0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x01,0x10,0x01,0x10,0x01,0x10,0x20,0x10,0x21,0x10,0x21,0x20,0x21,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAB,0x10,0xCB,0x10,0xEC,0x10,0xED,0x10,0xED,0x10,0xEE,0x18,0xEE,0x18,0x0E,0x19,0x2F,0x19,0x2F,0x19,0x31,0x19,0x55,0x29,0xF8,0x29,0xBB,0x3A,0x5E,0x74,0x5F,0x8D,0xDF,0xD6,0xBF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xDF,0x7E,0x7E,0xDD,0x63,
-	0xDE,0x6C,0xBD,0x53,0x9A,0x32,0x1A,0x32,0x3B,0x32,0x3B,0x3A,0xB8,0x29,0xB8,0x29,0xF7,0x11,0x55,0x29,0x54,0x21,0x32,0x21,0x97,0x29,0x32,0x21,0x31,0x19,0xEE,0x18,0xEE,0x10,0xEE,0x18,0x10,0x19,0x93,0x28,0x11,0x21,0x6D,0x18,0x4C,0x18,0x4A,0x18,0x28,0x10,0x27,0x10,0x26,0x10,0x25,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x21,0x08,
-	0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x24,0x10,0x25,0x10,0x26,0x18,0x48,0x18,0x6B,0x38,0x8D,0x40,0x6B,0x38,0x6A,0x30,0x4A,0x31,0x0E,0x3A,0xEE,0x39,0xCE,0x49,0x58,0xB2,0xF8,0xB1,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x52,0x5C,0x24,0x10,
-	0x23,0x10,0x03,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x24,0x20,0x35,0xA1,0x5D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xA7,0x7C,0x97,0xBE,0xD7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x20,0x10,0x20,0x10,0x21,0x18,0x21,0x18,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCB,0x10,0xEC,0x10,0xCC,0x10,0xCC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x32,0x21,0x76,0x29,0xFA,0x31,0xFD,0x62,0x7E,0x74,0x7E,0x8D,0xBE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xDF,0x7E,0x86,0x3E,0x7D,
-	0xBF,0x74,0xBC,0x43,0x7B,0x32,0x1B,0x2A,0x39,0x2A,0xB8,0x29,0x97,0x29,0x55,0x29,0x34,0x21,0x32,0x21,0x51,0x11,0x32,0x21,0x11,0x21,0x31,0x19,0x0E,0x19,0xED,0x18,0xED,0x10,0xED,0x10,0xCE,0x18,0x11,0x21,0xF2,0x28,0x8D,0x18,0x4B,0x10,0x49,0x10,0x28,0x10,0x26,0x08,0x25,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x22,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x04,0x10,0x25,0x10,0x26,0x18,0x28,0x18,0x49,0x18,0x48,0x18,0x28,0x18,0x47,0x18,0x4A,0x20,0x49,0x18,0x8A,0x38,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x5C,0x24,0x10,
-	0x03,0x10,0x03,0x10,0x02,0x10,0x02,0x08,0x02,0x10,0x02,0x08,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0xAD,0x68,0xDA,0xD3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xCF,0x7C,0x97,0x5C,0x97,0xBC,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x01,0x10,0x01,0x10,0x01,0x10,0x21,0x10,0x20,0x10,0x20,0x10,0x21,0x20,0x21,0x18,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0x0E,0x19,0x0F,0x19,0x31,0x19,0x32,0x21,0x54,0x29,0xB8,0x29,0xBC,0x52,0x7E,0x74,0x1E,0xA5,0xBE,0xC5,0x9F,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xDF,0xBE,0xC6,0xFE,0xB5,
-	0xBF,0x74,0x1D,0x5B,0x7B,0x32,0x1B,0x2A,0xDB,0x31,0xB8,0x29,0x97,0x29,0x33,0x21,0x32,0x21,0x32,0x21,0x2F,0x19,0x2F,0x19,0x0F,0x19,0x2F,0x19,0xEE,0x18,0xED,0x18,0xED,0x10,0xAB,0x10,0x8B,0x10,0x8D,0x18,0xAF,0x20,0x4C,0x20,0x6A,0x08,0x28,0x10,0x26,0x08,0x25,0x08,0x24,0x00,0x23,0x08,0x23,0x10,0x22,0x10,0x21,0x08,0x21,0x08,
-	0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x03,0x08,0x04,0x10,0x26,0x10,0x27,0x18,0x28,0x18,0x28,0x18,0x28,0x18,0x48,0x18,0x49,0x18,0x49,0x18,0x8A,0x30,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x5C,0x03,0x10,
-	0x03,0x10,0x02,0x10,0x02,0x08,0x02,0x08,0x02,0x10,0x02,0x08,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x46,0x30,0xF7,0xB9,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x7C,0xA7,0x7C,0x97,0x1A,0x9E,0xFC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x01,0x10,0x01,0x10,0x01,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x18,0x21,0x18,0x20,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0x2F,0x19,0x0F,0x19,0x32,0x21,0x34,0x21,0xD8,0x29,0x9C,0x52,0xDE,0x6B,0x7F,0x7C,0x1E,0xBE,0xBF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0xEF,0xFE,0xA6,0xDE,0xC6,0x9E,0x86,
-	0x1D,0x5B,0x1B,0x3A,0xFC,0x41,0xB9,0x29,0xB8,0x29,0x55,0x29,0x34,0x21,0x32,0x21,0x11,0x21,0x0F,0x19,0x0E,0x19,0xED,0x18,0xED,0x18,0xCD,0x18,0xCC,0x10,0xAB,0x18,0xAB,0x10,0xCA,0x10,0x8A,0x18,0x8A,0x18,0x8C,0x18,0x8B,0x18,0x29,0x10,0x27,0x10,0x25,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x03,0x08,0x03,0x08,0x25,0x10,0x27,0x10,0x28,0x10,0x28,0x18,0x28,0x10,0x48,0x18,0x28,0x10,0x27,0x10,0x6A,0x30,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x5C,0x03,0x10,
-	0x02,0x10,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x01,0x10,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0xF2,0x88,0x1A,0xD4,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xCF,0x7C,0x97,0x1B,0x97,0x78,0xB2,0xFC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x18,0x01,0x18,0x01,0x10,0x01,0x10,0x21,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x21,0x20,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xEC,0x10,0xED,0x18,0xEE,0x18,0xEE,0x18,0x0E,0x19,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x0E,0x19,0x0F,0x19,0x11,0x21,0x32,0x21,0x54,0x29,0xD9,0x31,0xFD,0x62,0x9E,0x73,0x3F,0x84,0x1E,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xDF,0xD6,0x7E,0xCE,0xFE,0x8C,
-	0xBC,0x52,0x7C,0x4A,0x1B,0x2A,0xB9,0x29,0x97,0x29,0x55,0x29,0x34,0x21,0x32,0x21,0x0F,0x19,0x2F,0x19,0xED,0x18,0xED,0x18,0xAB,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0x88,0x10,0xA8,0x10,0x69,0x18,0x4A,0x18,0x48,0x10,0x26,0x10,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x08,0x03,0x08,0x03,0x08,0x04,0x08,0x25,0x10,0x27,0x10,0x28,0x10,0x28,0x10,0x27,0x10,0x25,0x10,0x05,0x08,0x48,0x28,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x5C,0x03,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x46,0x30,0xF7,0xB1,0x5E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x7C,0x9F,0x7C,0x97,0xBB,0x9D,0x78,0xB1,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x21,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x18,0xED,0x18,0xED,0x18,0x0E,0x19,0x33,0x21,0x10,0x19,0xEE,0x18,0xEE,0x18,0x2F,0x19,0xF1,0x20,0x11,0x21,0x33,0x21,0x97,0x29,0x1C,0x42,0xFD,0x62,0x7E,0x6B,0x1F,0x84,0x1F,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xF7,0xDF,0xD6,0x7E,0xCE,0xDF,0xAD,0x7E,0x6B,
-	0xDD,0x5A,0x1C,0x42,0xFB,0x39,0x78,0x31,0x35,0x29,0x33,0x21,0x32,0x21,0xF1,0x20,0xF0,0x18,0xED,0x18,0xCE,0x18,0xAB,0x18,0xAB,0x10,0xAA,0x10,0xA9,0x10,0xA9,0x10,0x88,0x10,0x48,0x10,0x87,0x10,0x67,0x10,0x26,0x08,0x27,0x08,0x46,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x23,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x05,0x08,0x06,0x08,0x29,0x10,0x28,0x08,0x26,0x08,0x04,0x08,0x04,0x08,0x48,0x28,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x5C,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x33,0x91,0x7C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9D,0xBF,0x7C,0x97,0x1A,0x8F,0x78,0xB2,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x10,0x21,0x18,0x21,0x18,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEC,0x10,0xED,0x18,0xEE,0x18,0xEE,0x18,0x0E,0x19,0x0F,0x19,0x0E,0x19,0xEE,0x18,0x0E,0x19,0x10,0x19,0x30,0x19,0x31,0x21,0x55,0x29,0x99,0x39,0x9D,0x52,0x1E,0x63,0x3E,0x6B,0xBE,0x9C,0xBF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xD6,0xBE,0xC5,0xDF,0xD6,0xBE,0xC5,0x5E,0x74,0xDD,0x5A,
-	0xBD,0x5A,0xBD,0x5A,0xDB,0x39,0xB8,0x29,0x36,0x39,0x55,0x29,0x12,0x29,0x11,0x21,0xF0,0x18,0xCE,0x18,0xCC,0x18,0xAA,0x18,0xA9,0x10,0xA9,0x10,0x88,0x10,0x67,0x10,0x67,0x10,0x46,0x08,0x67,0x10,0x46,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x26,0x08,0x24,0x08,0x24,0x00,0x23,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,
-	0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x02,0x00,0x02,0x08,0x02,0x08,0x04,0x08,0x05,0x08,0x27,0x08,0x06,0x08,0x04,0x08,0x04,0x08,0x04,0x00,0x47,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x8B,0x58,0x79,0xC2,0x7E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x7C,0x9F,0x7C,0x97,0x31,0x64,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x18,0x01,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x20,0x18,0x21,0x18,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xED,0x18,0xED,0x18,0xEE,0x18,0x0E,0x19,0x2F,0x19,0x2F,0x19,0x0E,0x19,0x0E,0x19,0x0E,0x19,0xF0,0x18,0x32,0x21,0x34,0x21,0x97,0x29,0xFB,0x39,0xBD,0x5A,0xBD,0x5A,0x3E,0x6B,0xFE,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0xEF,0xDF,0xD6,0x1E,0xB5,0xDE,0xA4,0x1F,0xC6,0x9E,0xC5,0x9E,0x83,0xBD,0x5A,
-	0x3C,0x4A,0xFC,0x41,0xDB,0x41,0xB9,0x31,0x36,0x31,0x13,0x31,0x12,0x21,0xF1,0x20,0xF1,0x20,0x0F,0x19,0xCD,0x18,0x89,0x10,0x67,0x10,0x67,0x10,0x46,0x10,0x46,0x08,0x25,0x08,0x65,0x08,0x45,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04,0x08,0x05,0x08,0x06,0x00,0x06,0x08,0x04,0x00,0x04,0x00,0x03,0x00,0x47,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x21,0x08,0x21,0x08,0x01,0x08,0x01,0x08,0x23,0x18,0x14,0x99,0x7C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xC7,0x7C,0x97,0x78,0x86,0x28,0x39,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x21,0x18,0x21,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0x0E,0x19,0x0E,0x19,0x2F,0x19,0x0E,0x19,0x2F,0x19,0x11,0x19,0x32,0x21,0x76,0x29,0x99,0x49,0x7C,0x52,0xFD,0x62,0x9D,0x5A,0xFE,0x93,0x5E,0xCE,0xFF,0xFF,0xFF,0xFF,0xBF,0xF7,0x1F,0xDF,0xFF,0xDE,0xFE,0xC5,0xDE,0x93,0x9E,0x8B,0x7F,0x84,0xBE,0x8C,0x9E,0x83,0xBD,0x5A,
-	0x3C,0x4A,0xFC,0x41,0xDB,0x41,0x79,0x41,0x36,0x31,0x13,0x31,0x12,0x29,0x12,0x29,0xF0,0x20,0xAE,0x20,0x8B,0x18,0x89,0x10,0x67,0x10,0x67,0x10,0x46,0x10,0x45,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x24,0x00,0x23,0x08,0x24,0x08,0x25,0x08,0x24,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x04,0x08,0x04,0x08,0x05,0x00,0x05,0x08,0x04,0x00,0x04,0x00,0x03,0x00,0x47,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x21,0x08,0x21,0x08,0x01,0x10,0x01,0x08,0x8B,0x58,0x39,0xCB,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x97,0x7C,0x97,0x0F,0x54,0x45,0x28,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x21,0x10,0x21,0x10,0x20,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x21,0x10,0x21,0x18,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xED,0x18,0xED,0x18,0xEE,0x18,0x0F,0x19,0xEF,0x18,0x0E,0x19,0x2F,0x19,0x2F,0x19,0x0F,0x19,0x31,0x19,0x55,0x29,0x97,0x29,0x7C,0x52,0x9D,0x5A,0x9D,0x5A,0x1E,0x6B,0xBE,0x8C,0x3E,0xEF,0xFF,0xFF,0xFF,0xFF,0x7F,0xE7,0x7F,0xE7,0x1E,0xC6,0xDE,0x93,0x1D,0x6B,0x7E,0x7B,0xFD,0x6A,0x9D,0x52,0xBD,0x5A,0xDD,0x5A,
-	0xFC,0x49,0xFC,0x41,0xBB,0x41,0x57,0x39,0x36,0x39,0x14,0x31,0x12,0x29,0xD1,0x20,0xAE,0x28,0xAD,0x20,0xAA,0x18,0x69,0x18,0x88,0x10,0x67,0x10,0x25,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x04,0x00,0x04,0x00,0x05,0x00,0x05,0x00,0x04,0x00,0x03,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x01,0x08,0x01,0x08,0x21,0x08,0x21,0x08,0x01,0x10,0x24,0x20,0x97,0xB1,0x7D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9D,0xB7,0x7C,0x97,0x78,0x7E,0x41,0x08,0x25,0x28,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x21,0x10,0x20,0x10,0x20,0x08,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x21,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xED,0x18,0xED,0x18,0xEE,0x18,0x11,0x19,0x11,0x19,0x0E,0x19,0xEE,0x18,0x0E,0x19,0x0F,0x19,0x31,0x19,0x55,0x29,0x97,0x29,0x1C,0x42,0xDD,0x62,0x1E,0x6B,0x5E,0x73,0x1E,0x8C,0x9F,0xEF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD6,0xFE,0xC5,0xDE,0xAC,0xDD,0x62,0x9D,0x6A,0xBD,0x62,0xDB,0x51,0xFC,0x41,0x3C,0x4A,0xBD,0x5A,
-	0x7D,0x5A,0xFC,0x59,0x99,0x49,0x57,0x39,0x36,0x41,0xF4,0x38,0xF3,0x30,0xAF,0x28,0xAD,0x20,0xAB,0x20,0x8A,0x18,0x68,0x18,0x67,0x10,0x67,0x10,0x45,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x05,0x00,0x04,0x00,0x03,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x02,0x08,0x01,0x08,0x21,0x08,0x21,0x08,0x01,0x10,0xCF,0x78,0x7A,0xCB,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x97,0x5B,0x8F,0xAA,0x3A,0x00,0x08,0x25,0x28,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x7D,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x21,0x10,0x21,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x21,0x18,0x21,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0xEE,0x18,0x11,0x21,0x55,0x29,0x99,0x41,0xBC,0x42,0x1E,0x6B,0x7E,0x7B,0xBD,0x5A,0x1E,0xB5,0xFF,0xFF,0xFF,0xFF,0xDE,0xD6,0x7E,0xCE,0xFE,0xB4,0x3E,0x83,0x7C,0x5A,0xDB,0x51,0xFB,0x61,0xDB,0x41,0xDB,0x41,0xFC,0x41,0xFC,0x41,
-	0x5C,0x5A,0xFC,0x69,0x79,0x49,0x37,0x41,0x14,0x39,0x16,0x39,0xD2,0x30,0xAF,0x20,0xAE,0x20,0xAB,0x18,0x6C,0x28,0x89,0x10,0x47,0x10,0x46,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x05,0x00,0x04,0x00,0x03,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x02,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x21,0x10,0x21,0x10,0x45,0x30,0x36,0xA9,0xBC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xCF,0x9C,0xAF,0xDA,0x9E,0xAB,0x52,0xE8,0x41,0x2B,0x5A,0xF9,0xCA,0xF9,0xCA,0x3E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9D,0xBF,0x78,0x9E,0xE8,0x49,0xE8,0x49,0x66,0x39,0x00,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0x31,0x19,0x55,0x29,0x99,0x41,0x1E,0x6B,0x5E,0x73,0xFD,0x62,0x9D,0x5A,0xFE,0xCD,0xFF,0xFF,0xBF,0xF7,0x9E,0xD6,0x9E,0xC5,0x1E,0x9C,0xFD,0x6A,0xFB,0x61,0x3C,0x72,0xDB,0x61,0x9A,0x49,0xBA,0x49,0xDB,0x41,0x9A,0x49,
-	0x9A,0x49,0x9A,0x51,0x59,0x51,0x37,0x41,0x37,0x41,0xF4,0x38,0xD2,0x30,0xAF,0x28,0xAD,0x20,0x4E,0x28,0xAE,0x20,0x48,0x10,0x67,0x10,0x46,0x10,0x45,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x04,0x00,0x05,0x00,0x04,0x00,0x03,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x21,0x10,0x22,0x10,0xD0,0x80,0x58,0xB9,0xFC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x10,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x21,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0x31,0x19,0x55,0x29,0xFB,0x39,0x1E,0x63,0xDD,0x62,0x7C,0x52,0xFD,0x62,0x5F,0xE7,0xFF,0xFF,0x9F,0xEF,0x7E,0xCE,0x5E,0xC5,0x1E,0x9C,0x7D,0x6A,0x7D,0x62,0x5C,0x72,0xBA,0x51,0x9A,0x51,0xBB,0x41,0x9A,0x49,0x79,0x49,
-	0x39,0x49,0xF7,0x40,0x79,0x49,0x39,0x51,0x39,0x51,0xF3,0x38,0xD1,0x28,0x8F,0x38,0x8D,0x20,0x4C,0x28,0x69,0x18,0x27,0x18,0x46,0x18,0x25,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x03,0x00,0x03,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x03,0x10,0x03,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x21,0x10,0x21,0x10,0x58,0xB9,0x58,0xB9,0xFC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xCE,0x4D,0x43,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xAA,0x10,0xCB,0x10,0xCB,0x10,0xEC,0x10,0xEC,0x10,0xEC,0x10,0xED,0x18,0xED,0x18,0xED,0x18,0xEE,0x18,0x10,0x19,0x56,0x31,0x5C,0x52,0xBD,0x5A,0x1C,0x42,0x9D,0x5A,0x5E,0x83,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xBE,0xC5,0xFE,0xB4,0x1D,0x8B,0xFC,0x61,0x5C,0x7A,0x7C,0x62,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x9A,0x49,0x79,0x49,
-	0x98,0x48,0x38,0x49,0x16,0x41,0x18,0x51,0x39,0x59,0xD5,0x48,0xD2,0x38,0x8F,0x38,0x8D,0x20,0x49,0x20,0x48,0x18,0x27,0x18,0x46,0x10,0x25,0x10,0x24,0x10,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x03,0x00,0x02,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x03,0x10,0x03,0x10,0x03,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x58,0xB9,0x58,0xB9,0xFC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xDF,0x7C,0x97,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xAA,0x10,0xAA,0x10,0xCB,0x10,0xAB,0x10,0xCB,0x10,0xCB,0x10,0xCC,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0x11,0x19,0xB8,0x29,0xFA,0x31,0xDB,0x41,0xFB,0x39,0x1C,0x42,0x9D,0xA4,0xFF,0xFF,0xBF,0xF7,0x5E,0xC5,0x5E,0xC5,0x9D,0xB4,0xBD,0x7A,0x7D,0x62,0x7D,0x82,0xBB,0x61,0x9A,0x51,0x9A,0x51,0x9A,0x51,0x7A,0x51,0x79,0x51,
-	0x39,0x51,0xF7,0x40,0xF6,0x40,0xF6,0x40,0x16,0x51,0xD5,0x50,0xB3,0x48,0x8E,0x28,0x4B,0x28,0x49,0x20,0x28,0x18,0x47,0x18,0x26,0x10,0x25,0x10,0x24,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x03,0x00,0x03,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x03,0x10,0x03,0x10,0x03,0x10,0x03,0x10,0x03,0x10,0x02,0x10,0x22,0x10,0x22,0x18,0x58,0xB9,0x58,0xB9,0xFC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xDF,0x7C,0x97,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xAA,0x10,0xCA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xCB,0x10,0xED,0x18,0xED,0x18,0xEE,0x18,0x33,0x21,0x36,0x31,0x57,0x39,0xB8,0x31,0xB8,0x29,0x3C,0x4A,0xBE,0xAC,0xFF,0xFF,0x3E,0xD6,0x5E,0xC5,0x5E,0xC5,0x9E,0x9B,0x5C,0x6A,0x7D,0x7A,0x7D,0x82,0xBB,0x61,0x79,0x51,0x9A,0x51,0x59,0x51,0x79,0x51,0x39,0x59,
-	0x39,0x59,0x38,0x51,0xF6,0x40,0xF6,0x40,0xB3,0x40,0x90,0x38,0xB2,0x38,0x6E,0x30,0x8A,0x28,0x29,0x20,0x27,0x18,0x27,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x5C,0x03,0x08,
-	0x03,0x10,0x03,0x10,0x03,0x18,0x03,0x10,0x03,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x58,0xB9,0x58,0xB9,0xFC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xDF,0x7C,0x97,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xCA,0x10,0xCB,0x10,0xCC,0x18,0xED,0x18,0x11,0x21,0xF0,0x18,0x32,0x21,0x55,0x29,0x77,0x29,0x36,0x39,0x1A,0x4A,0xBE,0xBD,0xBF,0xCE,0x5F,0x9C,0x9D,0xBC,0x3C,0xC4,0x7C,0xAB,0x7D,0x82,0x5C,0x7A,0x3C,0x72,0x9A,0x51,0x79,0x51,0x59,0x59,0x7A,0x51,0x7A,0x61,0x39,0x59,
-	0x39,0x51,0x17,0x51,0xD4,0x48,0xD4,0x48,0xB2,0x40,0xAF,0x38,0x4D,0x30,0x8E,0x30,0x4C,0x28,0x69,0x20,0x27,0x18,0x27,0x18,0x25,0x10,0x25,0x10,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x5C,0x03,0x10,
-	0x03,0x10,0x03,0x10,0x03,0x10,0x03,0x10,0x03,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x58,0xB9,0x58,0xB9,0xFC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xDF,0x7C,0x97,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xAA,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAB,0x10,0xCB,0x18,0x0E,0x19,0xEE,0x18,0xED,0x18,0x10,0x19,0x32,0x21,0xF2,0x20,0x32,0x21,0x1A,0x4A,0xDE,0xB4,0x3E,0xBD,0x1D,0x8B,0xBE,0x93,0x1D,0xBC,0x5E,0x8B,0x7D,0x82,0x3C,0x72,0x9A,0x59,0x59,0x51,0x39,0x51,0x7A,0x59,0x7A,0x59,0x39,0x59,0x39,0x59,
-	0x39,0x59,0xF6,0x50,0xD4,0x48,0xD3,0x40,0xB2,0x40,0x6E,0x30,0x4C,0x28,0x6B,0x28,0x8B,0x28,0x4B,0x28,0x27,0x18,0x26,0x18,0x25,0x18,0x24,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x5C,0x03,0x10,
-	0x03,0x10,0x03,0x10,0x03,0x10,0x03,0x10,0x03,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x58,0xB9,0x58,0xB9,0x9B,0xDC,0xFC,0xE5,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xDE,0xDF,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBD,0xC7,0x7C,0x97,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x10,0x20,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xED,0x18,0xED,0x18,0xCC,0x18,0xED,0x18,0x10,0x19,0xF0,0x20,0x0E,0x19,0xEF,0x18,0xD9,0x51,0x9E,0xAC,0x9E,0x8B,0xBD,0x62,0x7E,0x9B,0xBE,0x9B,0x5D,0x7A,0x1C,0x72,0x3C,0x7A,0x9A,0x51,0x9A,0x51,0x9B,0x61,0x39,0x59,0x9A,0x61,0x39,0x59,0x39,0x59,
-	0x18,0x51,0xD5,0x50,0xB4,0x50,0xB3,0x48,0x91,0x48,0x8F,0x38,0x8B,0x28,0x8A,0x28,0x49,0x28,0x2A,0x28,0x28,0x20,0x26,0x18,0x25,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x02,0x10,0x02,0x10,0x03,0x10,0x03,0x10,0x03,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x58,0xB9,0x58,0xB9,0x58,0xB9,0x58,0xB9,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0xDF,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x21,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xCC,0x10,0xCC,0x10,0xCB,0x10,0xAB,0x10,0xED,0x18,0xEF,0x18,0xEE,0x18,0xCC,0x18,0xCE,0x18,0x3C,0x52,0x9E,0x8B,0xFD,0x6A,0xDA,0x51,0x3E,0x73,0xFD,0x82,0x7D,0x72,0x7D,0x72,0xDC,0x69,0x9A,0x51,0x59,0x51,0x79,0x51,0x39,0x59,0x39,0x59,0x39,0x59,0x39,0x59,
-	0xD5,0x50,0xD5,0x50,0xD3,0x40,0x71,0x38,0x4F,0x38,0x4D,0x30,0x8B,0x28,0x29,0x28,0x28,0x20,0x28,0x20,0x28,0x20,0x26,0x18,0x24,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x02,0x10,0x02,0x10,0x03,0x10,0x03,0x10,0x03,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x8B,0x58,0x8B,0x58,0x8B,0x58,0x8B,0x58,0xB0,0x63,0xB0,0x63,0xB0,0x63,0xB0,0x63,0xB0,0x63,0xB0,0x63,0xB0,0x63,0xB0,0x63,0xB0,0x63,0xD1,0x73,0x59,0xAC,0x59,0xAC,0x7E,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xFA,0x86,0x6D,0x4B,0x4D,0x43,0x4D,0x43,0x4D,0x43,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xCB,0x10,0xCC,0x10,0xAA,0x10,0xAB,0x10,0xAB,0x18,0xED,0x18,0x0F,0x19,0xEE,0x18,0xCC,0x18,0xF0,0x20,0x7D,0x5A,0x9E,0x8B,0xFA,0x49,0x79,0x49,0x7D,0x72,0x7D,0x72,0x3C,0x62,0x5C,0x7A,0x3C,0x72,0x9A,0x51,0x79,0x51,0x79,0x51,0x59,0x51,0x39,0x59,0x18,0x59,0x56,0x69,
-	0xD5,0x50,0xB4,0x50,0x91,0x48,0x8F,0x40,0xAF,0x40,0x4D,0x30,0x6B,0x30,0x29,0x28,0x28,0x20,0x27,0x20,0x26,0x18,0x25,0x18,0x24,0x10,0x84,0x18,0xC8,0x41,0xC8,0x41,0xC8,0x39,0xC8,0x39,0xC8,0x39,0x87,0x31,0x82,0x10,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xA7,0x39,0x04,0x21,0x20,0x00,0x20,0x00,0x44,0x21,0x44,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x26,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x03,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x10,0x03,0x10,0x03,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x00,0x08,0x00,0x00,0x24,0x20,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x75,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xCB,0x10,0xCC,0x10,0xAA,0x10,0xAB,0x10,0xAB,0x18,0xAB,0x18,0x0E,0x19,0xF0,0x20,0xED,0x18,0xEC,0x18,0x14,0x31,0xDD,0x62,0x5E,0x73,0x37,0x39,0x78,0x41,0x1C,0x62,0x1C,0x62,0xFC,0x61,0x7D,0x7A,0x3C,0x7A,0x5A,0x59,0x79,0x51,0x39,0x51,0x59,0x51,0x39,0x59,0x78,0x50,0xD5,0x50,
-	0xB4,0x50,0x92,0x50,0x91,0x48,0x4F,0x40,0x6E,0x38,0x4D,0x30,0x2C,0x28,0x29,0x28,0x28,0x28,0x27,0x20,0x25,0x18,0x24,0x18,0x24,0x18,0x49,0x4A,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0xBA,0xD6,0x08,0x42,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0x9D,0xEF,0xFB,0xDE,0x6D,0x6B,0x20,0x00,0x75,0xAD,0x75,0xAD,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x25,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x24,0x20,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x75,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xCC,0x10,0xCE,0x18,0x0F,0x19,0xCD,0x18,0xAD,0x18,0x76,0x29,0xFD,0x6A,0xDD,0x62,0x36,0x39,0x78,0x49,0x3C,0x5A,0xBA,0x51,0xFC,0x69,0x5D,0x8A,0x3C,0x7A,0xDC,0x69,0x39,0x51,0x79,0x51,0x18,0x49,0x77,0x50,0xB5,0x50,0xD5,0x50,
-	0xB4,0x50,0x92,0x50,0x71,0x48,0x6F,0x38,0x4D,0x38,0x2C,0x38,0x2B,0x30,0x29,0x28,0x28,0x20,0x27,0x20,0x25,0x18,0x24,0x18,0x24,0x10,0x6A,0x4A,0xBE,0xF7,0x8E,0x6B,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x08,0x42,0x08,0x42,0xFF,0xFF,0x69,0x4A,0x69,0x4A,0xAB,0x5A,0x59,0xCE,0xFB,0xDE,0x03,0x19,0xB6,0xB5,0xB6,0xB5,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x25,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x24,0x20,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x75,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xCB,0x10,0xAB,0x18,0x0E,0x19,0xD0,0x20,0xCE,0x18,0xEE,0x18,0xB9,0x39,0x9E,0x8B,0xDD,0x62,0x37,0x41,0x79,0x49,0x3C,0x5A,0xDB,0x61,0x9D,0x7A,0x9D,0x8A,0x3C,0x7A,0xDC,0x69,0x7A,0x61,0x39,0x59,0x18,0x51,0x18,0x51,0xB5,0x50,0xD5,0x50,
-	0xD4,0x50,0x92,0x50,0x4F,0x48,0x4F,0x48,0x2C,0x38,0x2B,0x30,0x2B,0x30,0x29,0x28,0x27,0x20,0x26,0x20,0x25,0x18,0x24,0x18,0x24,0x10,0x6A,0x4A,0x9D,0xEF,0xC8,0x41,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x09,0x42,0xFF,0xFF,0x22,0x08,0x22,0x10,0x22,0x10,0xAB,0x5A,0x9D,0xEF,0xA7,0x31,0xB6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x25,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x02,0x10,0x02,0x10,0x22,0x10,0x22,0x10,0x02,0x10,0x02,0x10,0x02,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x24,0x20,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x75,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xED,0x18,0xF0,0x18,0xF0,0x18,0xEE,0x18,0xEF,0x18,0x3A,0x4A,0xBF,0x93,0xBD,0x6A,0x57,0x39,0xDB,0x51,0xDC,0x61,0xBB,0x61,0xFC,0x71,0xFE,0xA1,0xFD,0x91,0xDC,0x69,0x9B,0x61,0xF9,0x58,0xD5,0x50,0xD5,0x50,0xD4,0x50,0xB4,0x50,
-	0x92,0x50,0x92,0x50,0x71,0x48,0x2E,0x40,0x2C,0x30,0x2B,0x30,0x2A,0x30,0x2A,0x28,0x27,0x28,0x26,0x20,0x25,0x18,0x24,0x18,0x23,0x10,0x69,0x4A,0x9D,0xEF,0x4A,0x52,0xE4,0x20,0xE4,0x18,0xC4,0x18,0x41,0x08,0x08,0x42,0xFF,0xFF,0x22,0x10,0x22,0x10,0x43,0x18,0xEF,0x7B,0x5D,0xEF,0x85,0x29,0xB6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x25,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x02,0x10,0x22,0x10,0x21,0x10,0x02,0x08,0x02,0x10,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x24,0x20,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x75,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x10,0xED,0x18,0x11,0x19,0x11,0x21,0xCE,0x18,0xF0,0x20,0x1B,0x62,0xBF,0x93,0x5C,0x5A,0x37,0x41,0xBB,0x59,0xDC,0x61,0xBB,0x61,0xFC,0x71,0xFE,0x9A,0xFD,0x91,0x3D,0x89,0xBB,0x61,0xD7,0x50,0xD5,0x50,0xD5,0x50,0x92,0x50,0x92,0x50,
-	0x92,0x50,0x50,0x48,0x2F,0x48,0x2D,0x38,0x2B,0x30,0x2B,0x30,0x29,0x28,0x28,0x28,0x28,0x28,0x27,0x20,0x25,0x20,0x24,0x18,0x23,0x10,0x69,0x4A,0xDE,0xF7,0xFB,0xDE,0xBA,0xD6,0xBA,0xD6,0x79,0xCE,0x87,0x31,0x08,0x42,0xFF,0xFF,0xF7,0xBD,0xF7,0xBD,0x38,0xC6,0x9D,0xEF,0x13,0x9D,0x61,0x08,0xB6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x25,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x31,0x54,0x02,0x08,
-	0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x08,0x02,0x10,0x02,0x10,0x21,0x08,0x21,0x08,0x01,0x08,0x02,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x00,0x01,0x00,0x01,0x00,0x24,0x20,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x75,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA9,0x10,0xA8,0x08,0xA9,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAB,0x10,0xCC,0x18,0xEE,0x18,0xF2,0x28,0xF1,0x20,0xCF,0x20,0x11,0x21,0xFD,0x7A,0x7E,0x8B,0x1C,0x52,0x58,0x49,0x3C,0x5A,0xBB,0x59,0xBB,0x61,0x3C,0x7A,0x1D,0x9A,0xFD,0x99,0x7D,0x82,0x7C,0x71,0xF7,0x58,0xB4,0x50,0x92,0x50,0x92,0x50,0x71,0x48,
-	0x50,0x48,0x50,0x48,0x2F,0x48,0x2D,0x48,0x2C,0x38,0x2B,0x30,0x2A,0x30,0x28,0x28,0x28,0x28,0x28,0x28,0x25,0x20,0x25,0x18,0x23,0x10,0x69,0x4A,0xDE,0xF7,0x96,0xB5,0x14,0xA5,0x14,0xA5,0xD3,0x9C,0x25,0x29,0x08,0x42,0xFF,0xFF,0x13,0x9D,0x34,0xA5,0xDE,0xF7,0x96,0xB5,0x20,0x00,0x20,0x00,0xB6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x25,0x20,0x58,0xB9,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x2F,0x4C,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x24,0x20,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xAF,0xF6,0x75,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xCC,0x10,0xEC,0x18,0xCF,0x18,0xF2,0x28,0x11,0x21,0xCF,0x20,0x13,0x31,0xFD,0x82,0x7E,0x8B,0xFC,0x69,0x9A,0x51,0xDC,0x69,0xBB,0x61,0x9A,0x59,0x1D,0x82,0xFD,0xA1,0x3D,0x8A,0xFD,0x99,0xDC,0x81,0x9B,0x61,0x56,0x50,0x92,0x50,0x30,0x40,0x2F,0x48,
-	0x2F,0x48,0x2F,0x48,0x2D,0x48,0x2D,0x38,0x2C,0x38,0x29,0x30,0x28,0x28,0x27,0x28,0x26,0x20,0x26,0x20,0x24,0x18,0x24,0x18,0x23,0x18,0x69,0x4A,0x9D,0xEF,0xC8,0x41,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x08,0x42,0xFF,0xFF,0x21,0x08,0x20,0x08,0xB6,0xB5,0x5C,0xE7,0xA2,0x10,0x20,0x00,0xB6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x25,0x20,0x58,0xB9,0x58,0xB9,0x7B,0xD4,0x1C,0xE6,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xD7,0xBE,0xCF,0x7C,0x97,0x2F,0x4C,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x24,0x20,0x58,0xB9,0x58,0xB9,0x3A,0xD4,0x5B,0xDD,0x9D,0xC7,0x9D,0xC7,0x9D,0xC7,0x9D,0xC7,0x9D,0xC7,0x9D,0xC7,
-	0x7C,0x9F,0xF6,0x75,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA8,0x10,0xA8,0x08,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xEC,0x18,0xEF,0x18,0x32,0x21,0xF2,0x28,0xF1,0x20,0x34,0x29,0x3E,0x7B,0xDC,0xBB,0x3C,0x72,0x9A,0x51,0x3C,0x7A,0xDB,0x61,0xBB,0x61,0x3D,0x8A,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0x7E,0xA1,0x7C,0x90,0xD8,0x60,0x92,0x50,0x50,0x48,0x50,0x48,
-	0x2E,0x40,0x2D,0x40,0x2D,0x48,0x2C,0x40,0x2A,0x30,0x28,0x28,0x27,0x28,0x26,0x28,0x25,0x20,0x25,0x18,0x24,0x18,0x23,0x10,0x23,0x10,0x69,0x4A,0x9D,0xEF,0xC8,0x41,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x08,0x42,0xFF,0xFF,0x20,0x08,0x20,0x00,0xA6,0x31,0x9D,0xEF,0x51,0x8C,0x20,0x00,0xB6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x25,0x20,0x58,0xB9,0x58,0xB9,0x58,0xB9,0x58,0xB9,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x2F,0x4C,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x24,0x20,0x58,0xB9,0x58,0xB9,0x58,0xB9,0xD8,0xB2,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,
-	0x7C,0x97,0xF6,0x75,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA9,0x10,0xA8,0x08,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xED,0x18,0xF1,0x20,0xF3,0x30,0xF2,0x30,0x12,0x21,0x15,0x41,0x3E,0x83,0xDC,0xBB,0x3C,0x72,0xDB,0x69,0x5D,0x7A,0x1C,0x72,0xBB,0x61,0xFD,0xA1,0xDE,0xA9,0xDE,0xA9,0xDE,0xA9,0x7E,0xA1,0x5C,0x81,0x7A,0x78,0xD5,0x50,0x50,0x48,0x2F,0x40,
-	0x2E,0x48,0x2D,0x48,0x2E,0x48,0x2A,0x30,0x28,0x28,0x27,0x28,0x27,0x28,0x26,0x20,0x25,0x20,0x25,0x18,0x24,0x10,0x23,0x10,0x22,0x10,0x69,0x4A,0x9D,0xEF,0xC8,0x41,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x08,0x42,0xFF,0xFF,0x20,0x08,0x20,0x00,0x61,0x08,0xD7,0xBD,0xFB,0xDE,0x04,0x21,0xB6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0xE7,0x21,0xE7,0x21,0xE7,0x21,0xE7,0x21,0xE7,0x21,0xE7,0x21,0xE7,0x21,0xE7,0x21,0x24,0x11,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x08,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x66,0x30,0x66,0x30,0x66,0x30,0xC6,0x28,0xE7,0x21,0xE7,0x21,0xE7,0x21,0xE7,0x21,0xE7,0x21,0xE7,0x21,
-	0xE7,0x21,0x85,0x19,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA8,0x08,0xA8,0x10,0xA8,0x08,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xED,0x18,0xCE,0x18,0xF1,0x20,0x35,0x31,0x14,0x29,0xF1,0x28,0x56,0x41,0x5D,0x8B,0xFD,0xBB,0x3C,0x7A,0x1C,0x7A,0x1D,0xAA,0x5D,0x8A,0x3B,0x81,0xDD,0xA9,0xDD,0xA9,0xDE,0xA9,0xDE,0xA9,0x7E,0xA1,0xDE,0xA0,0x9D,0x98,0x57,0x78,0x93,0x50,0x2F,0x48,
-	0x2D,0x48,0x2E,0x48,0x2C,0x40,0x29,0x30,0x27,0x28,0x26,0x28,0x26,0x20,0x25,0x20,0x25,0x18,0x24,0x18,0x23,0x18,0x23,0x10,0x22,0x10,0xC7,0x39,0xB6,0xB5,0x46,0x29,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x86,0x31,0xF7,0xBD,0x20,0x00,0x20,0x00,0x20,0x00,0x69,0x4A,0xF7,0xBD,0x07,0x3A,0x51,0x8C,0x51,0x8C,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA8,0x08,0xA8,0x08,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAB,0x10,0xCD,0x18,0xCE,0x18,0x13,0x31,0x36,0x39,0x14,0x29,0xF3,0x38,0x58,0x49,0x5C,0xB3,0xFD,0xBB,0x9D,0x82,0x5D,0x8A,0x7C,0xCA,0x9D,0xA1,0xBD,0x99,0xDD,0xB1,0xDD,0xB1,0x9E,0xA1,0x9E,0xA1,0x5E,0xA1,0xBE,0xA0,0x9D,0x98,0x9B,0x80,0x33,0x68,0x2F,0x48,
-	0x2E,0x48,0x2D,0x48,0x2A,0x30,0x28,0x28,0x27,0x28,0x26,0x20,0x25,0x20,0x25,0x20,0x24,0x18,0x24,0x18,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA8,0x08,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xCC,0x18,0xCD,0x18,0xCF,0x20,0x13,0x29,0x36,0x39,0x36,0x39,0xF3,0x30,0x78,0x51,0x9C,0xB3,0x5D,0xC4,0x7C,0x92,0x5D,0x9A,0xBD,0xBA,0xFD,0xB1,0xDE,0xA9,0xDD,0xC1,0xFD,0xB1,0xDE,0xA0,0x7E,0xA1,0x9D,0xB8,0xBE,0xA0,0xBE,0xA0,0x5B,0x88,0x36,0x80,0x31,0x60,
-	0x2E,0x48,0x2C,0x48,0x29,0x38,0x28,0x28,0x27,0x28,0x26,0x20,0x25,0x20,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x10,0x21,0x08,0x21,0x08,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x45,0x29,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA8,0x10,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xCC,0x18,0xCE,0x18,0xCF,0x18,0xF4,0x38,0x37,0x41,0x36,0x39,0xF3,0x30,0x78,0x51,0x9C,0xB3,0x5D,0xC4,0x7C,0x92,0x1D,0xAA,0x7C,0xCA,0xFD,0xB1,0xDE,0xA9,0x1C,0xDA,0xBE,0xB9,0xBE,0xA0,0xBE,0xA0,0xBD,0xA8,0xBD,0xA8,0xBE,0xA0,0x5B,0x88,0x39,0x80,0x31,0x60,
-	0x2F,0x58,0x2D,0x48,0x28,0x30,0x27,0x28,0x26,0x28,0x25,0x20,0x24,0x18,0x24,0x18,0x23,0x18,0x23,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x10,0x21,0x08,0x21,0x08,0x24,0x21,0xFB,0xDE,0xA6,0x39,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x08,0x01,0x00,0x01,0x08,0x01,0x08,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA8,0x10,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAB,0x18,0xAC,0x18,0xCD,0x18,0xD0,0x20,0x13,0x29,0x37,0x41,0x16,0x39,0x15,0x39,0x58,0x59,0x7C,0xC2,0x9C,0xCB,0x1D,0xAA,0x1D,0x92,0x7C,0xC2,0x5C,0xBA,0x9B,0xB9,0x7D,0xC1,0x7B,0xC9,0xBE,0xA0,0x9D,0x98,0xBE,0xA0,0xBE,0xA0,0x7C,0x90,0x3A,0x88,0x38,0x80,0x32,0x70,
-	0x2F,0x58,0x2B,0x48,0x29,0x38,0x27,0x28,0x25,0x28,0x24,0x20,0x24,0x18,0x23,0x18,0x6B,0x5A,0xDA,0xD6,0x3C,0xE7,0xD7,0xBD,0x05,0x29,0xE5,0x28,0xF7,0xBD,0x3C,0xE7,0xDB,0xDE,0x6A,0x52,0x21,0x10,0x21,0x08,0x21,0x08,0xEF,0x7B,0xFB,0xDE,0x03,0x21,0x61,0x08,0x0F,0x7C,0x9D,0xEF,0xC6,0x31,0x00,0x00,0x82,0x10,0x75,0xAD,0x3C,0xE7,
-	0xFB,0xDE,0x89,0x4A,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x44,0x21,0x6D,0x6B,0xB6,0xB5,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0x59,0xC6,0xF3,0x9C,0x69,0x4A,0xC3,0x18,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x08,0x01,0x08,0x01,0x00,0x01,0x00,0x01,0x00,0x42,0x08,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xAA,0x10,0xAB,0x18,0xAC,0x18,0xCE,0x18,0xCF,0x20,0xF3,0x30,0x36,0x39,0x16,0x39,0xF3,0x38,0x78,0x51,0x9C,0xBA,0x5C,0xCB,0xDD,0xA9,0xDE,0xA9,0x7C,0xC2,0xDE,0xA9,0xFD,0xB8,0x7D,0xC1,0xFD,0xC8,0x9C,0xA0,0x7C,0x98,0x5B,0x88,0x5B,0x88,0x3A,0x88,0x36,0x88,0x33,0x70,0x33,0x70,
-	0x30,0x68,0x2C,0x50,0x29,0x40,0x28,0x30,0x26,0x28,0x25,0x20,0x24,0x20,0x23,0x18,0x1C,0xE7,0xAE,0x73,0xA7,0x39,0x38,0xC6,0x55,0xAD,0xF4,0xA4,0x79,0xCE,0xA6,0x39,0xCE,0x73,0xFB,0xDE,0x21,0x08,0x21,0x08,0x62,0x10,0x17,0xBE,0x95,0xAD,0x40,0x08,0x4C,0x63,0x99,0xCE,0x3C,0xE7,0x07,0x3A,0x00,0x00,0x10,0x7C,0xBA,0xD6,0xC6,0x31,
-	0x0C,0x63,0x3C,0xE7,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xC3,0x10,0xF3,0x9C,0x3C,0xE7,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xBA,0xD6,0x8E,0x6B,0x41,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x08,0x01,0x08,0x01,0x00,0x46,0x28,0x6A,0x48,0xCD,0x59,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xB9,0xCE,0xCA,0x32,0x24,0x11,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA8,0x10,0xA9,0x10,0xAA,0x10,0xCB,0x18,0xAB,0x18,0xAB,0x18,0xAD,0x20,0xCF,0x20,0xF2,0x28,0x36,0x41,0x16,0x39,0xD3,0x30,0x58,0x59,0x3C,0xCA,0x1C,0xD3,0xDD,0xA9,0xFD,0x91,0x9E,0xC9,0xBE,0xA9,0xDE,0xA0,0x7D,0xC0,0x7D,0xD0,0x7B,0xA0,0x3A,0x90,0x39,0x98,0x36,0x80,0x33,0x70,0x33,0x68,0x2F,0x60,0x2F,0x58,
-	0x2F,0x58,0x2E,0x58,0x2C,0x48,0x29,0x40,0x27,0x30,0x26,0x28,0x24,0x20,0x23,0x18,0x9D,0xEF,0xC8,0x41,0x22,0x10,0x14,0xA5,0xF7,0xBD,0xF7,0xBD,0x54,0xA5,0x22,0x10,0x08,0x42,0x9D,0xEF,0x21,0x10,0x21,0x08,0x65,0x29,0x3C,0xE7,0x0B,0x5B,0x20,0x08,0x28,0x42,0x24,0x21,0xFB,0xDE,0x07,0x3A,0x00,0x00,0x85,0x29,0xC6,0x31,0x00,0x00,
-	0x49,0x4A,0x7D,0xEF,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x87,0x31,0xDB,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xF4,0xA4,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0xD0,0x78,0x58,0xB9,0xB9,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x7C,0x97,0xCA,0x32,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA9,0x10,0xA9,0x10,0xAA,0x10,0xAB,0x18,0xCC,0x18,0xAD,0x20,0xAD,0x20,0xAE,0x20,0xD0,0x28,0x16,0x39,0xF3,0x38,0xD3,0x30,0x16,0x59,0x9D,0xC9,0x7C,0xD2,0x3D,0xA9,0xBC,0x90,0xFD,0xB8,0x7E,0xA1,0xBE,0xA0,0x7D,0xC0,0x9D,0xB0,0x7B,0xA0,0x3A,0x90,0x3A,0x88,0x34,0x70,0x30,0x60,0x30,0x60,0x2D,0x58,0x2C,0x48,
-	0x2D,0x50,0x2D,0x58,0x2C,0x50,0x2A,0x48,0x28,0x38,0x27,0x30,0x25,0x28,0x24,0x20,0x9D,0xEF,0xC8,0x41,0x22,0x10,0x14,0xA5,0xF7,0xBD,0x51,0x8C,0x3C,0xE7,0x31,0x8C,0x17,0xBE,0xBA,0xD6,0x21,0x10,0x21,0x08,0x0B,0x5B,0x5C,0xE7,0x61,0x10,0x20,0x08,0x20,0x00,0x20,0x00,0xFB,0xDE,0x07,0x3A,0x20,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,
-	0xFB,0xDE,0xAE,0x73,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xC8,0x41,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xB5,0xA2,0x10,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x01,0x00,0x01,0x00,0xF2,0x88,0x58,0xB9,0x5B,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xCF,0x7C,0x97,0xCA,0x32,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAC,0x18,0xAD,0x20,0xAE,0x20,0xD0,0x20,0xF3,0x38,0xD4,0x40,0x91,0x40,0xF4,0x40,0xBD,0x91,0x7E,0xE9,0xDD,0xA1,0x3C,0x79,0x5E,0xA1,0xBE,0xA0,0xBE,0xA0,0x9D,0xA8,0x7D,0xC0,0x38,0xA0,0x37,0x88,0x35,0x80,0x31,0x68,0x2F,0x58,0x2C,0x48,0x2A,0x48,0x29,0x40,
-	0x29,0x40,0x29,0x40,0x2A,0x48,0x29,0x40,0x29,0x40,0x27,0x38,0x26,0x30,0x24,0x20,0x9D,0xEF,0xC9,0x49,0x23,0x18,0x14,0xA5,0xF7,0xBD,0x22,0x10,0x92,0x94,0x79,0xCE,0xDE,0xF7,0xEB,0x5A,0x22,0x08,0x21,0x10,0xF7,0xBD,0xF3,0x9C,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0xFB,0xDE,0x07,0x3A,0x20,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,
-	0xB6,0xB5,0xF7,0xBD,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x2A,0x51,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xCF,0x73,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x22,0x08,0x13,0x91,0x58,0xB9,0xFC,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xCF,0x7C,0x97,0x65,0x19,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xCC,0x18,0xAC,0x18,0xAC,0x18,0xAD,0x20,0xAD,0x20,0xAF,0x20,0xD2,0x38,0xD2,0x38,0x4F,0x38,0x71,0x40,0x7C,0x91,0x7E,0xE9,0xDE,0xB0,0x3A,0x68,0x9D,0x98,0xBE,0xA0,0x7C,0x90,0x5C,0x98,0x9D,0xA8,0x36,0x88,0x34,0x78,0x33,0x70,0x30,0x58,0x2D,0x50,0x2B,0x48,0x29,0x40,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x29,0x40,0x29,0x40,0x27,0x40,0x27,0x30,0x27,0x30,0x25,0x30,0x9D,0xEF,0xC9,0x51,0x24,0x20,0x14,0xA5,0xF8,0xC5,0x23,0x18,0x22,0x18,0x51,0x8C,0xBA,0xD6,0xC4,0x20,0x22,0x10,0x24,0x21,0x9D,0xEF,0x28,0x42,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0xFB,0xDE,0x07,0x42,0x20,0x00,0xC6,0x31,0x85,0x29,0x00,0x00,
-	0xA6,0x31,0x9D,0xEF,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xAB,0x58,0x9B,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,
-	0x8D,0x5B,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x22,0x00,0x22,0x00,0x03,0x08,0x13,0x91,0x58,0xB9,0x5C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x9D,0xBF,0x7C,0x97,0x65,0x19,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xAA,0x10,0xAB,0x18,0xAB,0x18,0xAB,0x18,0xAD,0x20,0xAE,0x20,0x6D,0x20,0xB1,0x40,0x91,0x38,0x6E,0x30,0x6F,0x38,0x9A,0x80,0x3D,0xE1,0xDD,0xA8,0x39,0x60,0x9D,0x90,0x9D,0x98,0x3A,0x88,0x5B,0x88,0x59,0xA0,0x35,0x80,0x32,0x70,0x30,0x68,0x2D,0x58,0x2C,0x48,0x2B,0x48,0x28,0x38,0x27,0x30,
-	0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x38,0x26,0x30,0x26,0x38,0x26,0x30,0x25,0x30,0x1C,0xE7,0xAE,0x73,0xA9,0x49,0x79,0xCE,0x55,0xB5,0x24,0x20,0x06,0x39,0xFB,0xDE,0x51,0x8C,0x22,0x18,0x22,0x18,0xEF,0x83,0xFB,0xDE,0x04,0x29,0x21,0x08,0x20,0x08,0x21,0x08,0x20,0x00,0xFB,0xDE,0x07,0x3A,0x00,0x00,0x55,0xA5,0xF7,0xBD,0x45,0x29,
-	0xCE,0x73,0xFB,0xDE,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x68,0x40,0xD9,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x3C,0xD7,0x86,0x21,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x22,0x00,0x22,0x00,0x44,0x18,0x15,0xA1,0x58,0xB9,0x3D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x9D,0xBF,0x7C,0x97,0x24,0x11,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0x8C,0x20,0x8C,0x20,0x6D,0x28,0xD2,0x38,0x91,0x38,0x6E,0x30,0x4E,0x30,0x38,0x70,0xBD,0xD0,0x9B,0xA0,0x38,0x58,0x5A,0x80,0x9D,0x98,0x36,0x78,0x38,0x88,0x38,0x88,0x33,0x70,0x30,0x60,0x2F,0x58,0x2D,0x58,0x2A,0x48,0x29,0x40,0x28,0x38,0x27,0x30,
-	0x26,0x28,0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x26,0x30,0x25,0x30,0x6C,0x62,0xDA,0xD6,0x3C,0xE7,0x18,0xC6,0x07,0x49,0x24,0x30,0xAF,0x7B,0x1B,0xDF,0xA4,0x28,0x23,0x18,0x63,0x20,0x18,0xC6,0x95,0xB5,0x41,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0xFB,0xDE,0x07,0x3A,0x00,0x00,0x04,0x21,0x18,0xC6,0x3C,0xE7,
-	0xDB,0xDE,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x18,0x15,0xA1,0xDC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBE,0xD7,0xDE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xF7,0x95,0x7D,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x45,0x18,0x35,0xA1,0x98,0xB9,0x7D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x9D,0xBF,0x7C,0x97,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xAA,0x10,0xAA,0x18,0xAB,0x18,0xAB,0x18,0xAB,0x20,0x8C,0x20,0x8D,0x20,0x4F,0x30,0x70,0x38,0x4D,0x30,0x4D,0x30,0x57,0x68,0x9D,0xA8,0x9D,0xA8,0x55,0x60,0x79,0x78,0x5B,0x88,0x35,0x70,0x34,0x70,0x35,0x80,0x32,0x68,0x2F,0x58,0x2C,0x58,0x2B,0x50,0x2A,0x48,0x29,0x40,0x28,0x38,0x27,0x28,
-	0x25,0x28,0x25,0x28,0x25,0x28,0x25,0x30,0x25,0x28,0x24,0x28,0x24,0x28,0x25,0x30,0x26,0x30,0x24,0x28,0x24,0x30,0x25,0x30,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x60,0x58,0xC2,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xDF,0x7C,0x9F,0x7C,0x97,0x7C,0x97,0x9D,0xB7,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBD,0xD7,0xCB,0x32,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x45,0x20,0x36,0xA9,0xD8,0xB9,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,
-	0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x10,0xAA,0x18,0xAA,0x18,0xAA,0x18,0x6A,0x18,0x4B,0x20,0x8B,0x20,0x6E,0x30,0x90,0x38,0x4D,0x30,0x4D,0x30,0x93,0x48,0x9D,0xA8,0x9D,0xA8,0x35,0x70,0x54,0x68,0x5B,0x88,0x35,0x70,0x31,0x70,0x33,0x70,0x31,0x68,0x2D,0x58,0x2C,0x50,0x2B,0x50,0x2A,0x48,0x28,0x38,0x26,0x30,0x25,0x28,
-	0x24,0x28,0x24,0x28,0x25,0x28,0x25,0x28,0x25,0x30,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x20,0x23,0x20,0x24,0x20,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x28,0x37,0xB1,0x3C,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x7C,0x97,0x5C,0x97,0x7B,0x9E,0x9A,0xA5,0x1C,0xC7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDE,0xF7,0xF6,0x75,0xA2,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x67,0x28,0x37,0xB1,0x38,0xC2,0x3E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xCF,0x7C,0x97,0xD7,0x7D,0x36,0x7D,0x36,0x7D,0x36,0x7D,0x36,0x7D,0x36,0x7D,0x36,0x7D,0x36,0x7D,0x36,0x7D,0x34,0x7D,
-	0xB1,0x5C,0xB1,0x5C,0xB1,0x5C,0xB1,0x5C,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0x10,0xAA,0x10,0xAA,0x18,0x69,0x18,0x8A,0x18,0x6A,0x20,0x4A,0x20,0x4C,0x28,0x6E,0x30,0x4D,0x30,0x2B,0x28,0x4F,0x40,0x5B,0x98,0x7D,0xD0,0x58,0x78,0x33,0x68,0x38,0x88,0x34,0x70,0x30,0x60,0x32,0x70,0x30,0x68,0x2D,0x58,0x2C,0x58,0x2A,0x48,0x28,0x38,0x27,0x30,0x25,0x30,0x25,0x30,
-	0x25,0x28,0x25,0x28,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x70,0xD8,0xB9,0xBD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9D,0xB7,0x7C,0x97,0x3B,0x8F,0xF4,0x7B,0x57,0xB1,0x58,0xB9,0x58,0xB9,0x3D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x5C,0xAF,0xC7,0x21,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x22,0x00,0x67,0x30,0x58,0xB9,0x59,0xC2,0x5E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xB7,0x7C,0x97,0x65,0x19,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x10,0xA9,0x10,0x88,0x18,0x69,0x18,0x89,0x18,0x49,0x20,0x69,0x20,0x4A,0x20,0x4D,0x30,0x4B,0x28,0x29,0x28,0x2B,0x30,0x5A,0x70,0x7D,0xC0,0x58,0x78,0x2F,0x50,0x34,0x78,0x32,0x70,0x30,0x60,0x30,0x68,0x30,0x70,0x2D,0x58,0x2B,0x50,0x29,0x40,0x26,0x40,0x26,0x30,0x26,0x30,0x25,0x30,
-	0x25,0x28,0x25,0x28,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x20,0x23,0x20,0x23,0x20,0x23,0x18,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x10,0x14,0x99,0x79,0xC2,0x7E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x7C,0x9F,0x7C,0x97,0x6D,0x43,0x02,0x10,0x13,0x99,0x58,0xB9,0x58,0xB9,0x7A,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x51,0x54,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x22,0x00,0x8A,0x48,0x58,0xB9,0x99,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9C,0xAF,0x7C,0x97,0x61,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x18,0x88,0x10,0x68,0x18,0x68,0x18,0x68,0x18,0x28,0x18,0x28,0x20,0x2B,0x28,0x29,0x28,0x29,0x28,0x28,0x28,0x74,0x60,0x7D,0xB8,0x38,0x78,0x2E,0x48,0x31,0x68,0x31,0x70,0x2C,0x58,0x2E,0x58,0x30,0x70,0x2D,0x60,0x2A,0x48,0x26,0x40,0x27,0x30,0x26,0x30,0x25,0x30,0x25,0x30,
-	0x25,0x28,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x30,0x37,0xB1,0x3A,0xCB,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x97,0x98,0x7E,0xE3,0x10,0x00,0x00,0x69,0x40,0x58,0xB9,0x58,0xB9,0xB9,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0xB9,0x86,0x41,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x01,0x00,0xAC,0x58,0x58,0xB9,0xB9,0xC2,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x9F,0x1A,0x8F,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x18,0x47,0x18,0x47,0x18,0x27,0x18,0x28,0x20,0x29,0x28,0x28,0x20,0x28,0x28,0x2E,0x40,0x7B,0xB0,0x5A,0xA8,0x2E,0x50,0x30,0x60,0x31,0x70,0x2E,0x58,0x2C,0x50,0x6E,0x78,0x2B,0x58,0x28,0x40,0x26,0x48,0x27,0x30,0x25,0x30,0x25,0x30,0x24,0x30,
-	0x25,0x30,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x30,0x24,0x28,0x23,0x20,0x24,0x28,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x60,0x58,0xB9,0xDB,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xCF,0x7C,0x97,0x33,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0xA9,0x58,0xB9,0x38,0xC2,0x3E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x7C,0x9F,0xC7,0x19,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x01,0x00,0xCF,0x70,0x58,0xB9,0xF9,0xCA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x97,0xF6,0x75,0x61,0x08,0x49,0x4A,0xEF,0x7B,0x92,0x8C,0xCF,0x73,0x29,0x42,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x10,0x67,0x10,0x67,0x10,0x67,0x10,0x27,0x18,0x27,0x18,0x26,0x18,0x27,0x20,0x28,0x20,0x27,0x20,0x27,0x20,0x2D,0x40,0x7A,0x90,0x7C,0xA0,0x31,0x68,0x30,0x60,0x32,0x70,0x2F,0x60,0x2C,0x50,0x2D,0x60,0x2B,0x50,0x26,0x40,0x26,0x30,0x25,0x38,0x25,0x30,0x25,0x30,0x25,0x30,
-	0x24,0x30,0x24,0x30,0x25,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x23,0x20,0x23,0x20,0x23,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x91,0x58,0xB9,0x1D,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xB7,0x7C,0x97,0x2B,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x70,0x58,0xB9,0xD8,0xB9,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x7C,0xA7,0xAE,0x43,0x01,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x01,0x00,0xF2,0x80,0x58,0xB9,0x1A,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0x7C,0x9F,0xDA,0xBE,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x31,0x84,0x44,0x21,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x10,0x66,0x10,0x66,0x10,0x66,0x10,0x26,0x10,0x26,0x18,0x26,0x18,0x27,0x20,0x28,0x20,0x28,0x28,0x28,0x28,0x2B,0x38,0x79,0x90,0x7C,0xC8,0x36,0x90,0x31,0x68,0x35,0x90,0x51,0x80,0x2F,0x60,0x8E,0x70,0x2C,0x58,0x27,0x40,0x25,0x30,0x25,0x30,0x25,0x30,0x24,0x30,0x24,0x30,
-	0x25,0x38,0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x30,0x23,0x28,0x23,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xB1,0x58,0xB9,0xDE,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xAF,0x7C,0x97,0x44,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x48,0x58,0xB9,0x58,0xB9,0x5D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xAF,0x54,0x65,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x01,0x00,0xF3,0x90,0x58,0xB9,0xBB,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0xDE,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x2D,0x6B,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x10,0x46,0x10,0x46,0x10,0x46,0x10,0x26,0x10,0x46,0x18,0x27,0x18,0x28,0x28,0x29,0x28,0x2A,0x28,0x2C,0x38,0x36,0x90,0x7D,0xD0,0x39,0xB0,0x32,0x70,0x36,0x98,0x35,0x90,0x31,0x78,0x8C,0x68,0x4B,0x70,0x29,0x48,0x25,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,
-	0x25,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x23,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x28,0x58,0xB9,0x58,0xB9,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x9F,0x3B,0x8F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x28,0x57,0xB1,0x58,0xB9,0xBD,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xB7,0xF6,0x75,0x82,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x01,0x00,0x58,0xB9,0x58,0xB9,0xBC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x31,0x84,0x41,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x08,0x45,0x10,0x46,0x10,0x46,0x10,0x46,0x18,0x26,0x18,0x47,0x18,0x28,0x20,0x2B,0x30,0x2B,0x30,0x2B,0x30,0x34,0x78,0x7D,0xD0,0x5C,0xC8,0x36,0x90,0x36,0x98,0x37,0xA0,0x72,0x88,0x2E,0x70,0x4B,0x70,0x2A,0x58,0x25,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x38,
-	0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x38,0x24,0x30,0x23,0x28,0x23,0x20,0x23,0x28,0x23,0x28,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x40,0x58,0xB9,0x58,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x97,0x17,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x20,0x36,0xA9,0x58,0xB9,0x5C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xC7,0x78,0x7E,0xE4,0x10,0x21,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x58,0xB9,0x58,0xB9,0x3C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xBE,0xF7,0x31,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x08,0x25,0x10,0x45,0x10,0x46,0x10,0x46,0x10,0x46,0x10,0x26,0x18,0x28,0x28,0x2B,0x30,0x2B,0x30,0x2A,0x38,0x31,0x58,0x5C,0xC8,0x7D,0xD0,0x38,0xA8,0x72,0x88,0x38,0xA8,0x73,0x98,0x4E,0x70,0x2B,0x68,0x2A,0x60,0x27,0x38,0x25,0x30,0x24,0x30,0x24,0x38,0x24,0x38,
-	0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x28,0x23,0x28,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8B,0x58,0x58,0xB9,0x38,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0x7C,0x97,0xD2,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x18,0x15,0xA1,0x58,0xB9,0xBB,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xC7,0xB9,0x86,0x25,0x11,0x21,0x00,0x21,0x00,0x01,0x00,0x45,0x20,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xF7,0xAE,0x53,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x10,0x45,0x10,0x25,0x10,0x26,0x10,0x26,0x18,0x26,0x18,0x28,0x28,0x2B,0x30,0x2D,0x48,0x2B,0x30,0x2D,0x48,0x39,0xB0,0x7D,0xD0,0x5B,0xC0,0x73,0x90,0x54,0x98,0x57,0xA8,0x6E,0x78,0x2B,0x58,0x2A,0x68,0x26,0x48,0x24,0x30,0x24,0x38,0x24,0x38,0x24,0x38,
-	0x24,0x38,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x28,0x23,0x28,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x60,0x58,0xB9,0x19,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0x7C,0x97,0x91,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x18,0x15,0xA1,0x58,0xB9,0x5B,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0xFA,0x86,0x66,0x19,0x21,0x00,0x21,0x00,0x01,0x00,0x47,0x30,0x58,0xB9,0x58,0xB9,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x5C,0xCF,0xE8,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x08,0x45,0x10,0x45,0x10,0x25,0x10,0x26,0x18,0x26,0x18,0x27,0x20,0x2B,0x30,0x2D,0x48,0x2C,0x48,0x2A,0x48,0x34,0x80,0x7C,0xC8,0x5C,0xC8,0x33,0x80,0x71,0x88,0x92,0x98,0x6F,0x88,0x29,0x60,0x29,0x58,0x28,0x50,0x25,0x40,0x25,0x38,0x24,0x38,0x24,0x38,
-	0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x30,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x78,0x58,0xB9,0x19,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0x7C,0x97,0xCE,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x10,0x14,0x99,0x58,0xB9,0x5B,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x1A,0x8F,0x87,0x19,0x21,0x00,0x21,0x00,0x01,0x00,0x8A,0x48,0x58,0xB9,0x78,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xDE,0xDF,0xBD,0xBF,0xBD,0xBF,0xDE,0xDF,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x37,0x86,0x42,0x00,0x01,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x10,0x45,0x10,0x25,0x10,0x66,0x10,0x26,0x18,0x27,0x20,0x6B,0x38,0x2D,0x48,0x2D,0x48,0x2C,0x48,0x2D,0x58,0x5B,0xC0,0xFD,0xD8,0x74,0x98,0x31,0x70,0x71,0x88,0x90,0x88,0x4B,0x68,0x2A,0x50,0x49,0x60,0x25,0x40,0x25,0x38,0x24,0x38,0x25,0x38,
-	0x24,0x30,0x24,0x30,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x24,0x30,0x23,0x28,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x88,0x58,0xB9,0x19,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0x7C,0x97,0x4C,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x13,0x91,0x58,0xB9,0x5B,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x7C,0x97,0xE7,0x21,0x22,0x00,0x21,0x00,0x01,0x00,0xAD,0x60,0x58,0xB9,0xB9,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xB7,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x9D,0xB7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9D,0xB7,0x4C,0x3B,0x01,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x10,0x46,0x10,0x66,0x10,0x26,0x18,0x47,0x18,0x47,0x20,0x4B,0x30,0x4E,0x40,0x4E,0x48,0x2D,0x48,0x2D,0x50,0x58,0xB0,0xDD,0xD8,0x9A,0xC0,0x6F,0x78,0x71,0x88,0x91,0x90,0x4C,0x78,0x49,0x60,0x49,0x60,0x27,0x50,0x25,0x38,0x25,0x38,0x24,0x38,
-	0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x88,0x58,0xB9,0x19,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0x7C,0x97,0x4C,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x13,0x91,0x58,0xB9,0x5B,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x7C,0x97,0xE8,0x21,0x21,0x00,0x21,0x00,0x01,0x00,0xAE,0x68,0x58,0xB9,0xB8,0xB9,0x3A,0xD4,0x7C,0xDE,0xDE,0xE7,0xDE,0xEF,0xDE,0xEF,0xFF,0xF7,0xFF,0xFF,0xBD,0xCF,0x7C,0x97,0x5B,0x8F,0x76,0x7D,0x18,0xAB,0x58,0xB9,0x78,0xB2,0xFC,0xD5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xCF,0xF6,0x75,0x62,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x10,0x66,0x18,0x26,0x18,0x47,0x18,0x47,0x20,0x69,0x28,0x2E,0x40,0x8F,0x50,0x2E,0x48,0x2D,0x50,0x34,0x80,0x7E,0xE9,0x3D,0xE1,0x55,0x98,0x71,0x88,0x91,0x90,0x6E,0x80,0x4A,0x68,0x49,0x60,0x28,0x58,0x25,0x40,0x25,0x40,0x25,0x38,
-	0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x30,0x23,0x28,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x88,0x58,0xB9,0xD9,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0x7C,0x97,0x4C,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x13,0x91,0x58,0xB9,0x5B,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x7C,0x97,0xE8,0x21,0x21,0x00,0x21,0x00,0x01,0x00,0xD0,0x78,0x58,0xB9,0x58,0xB9,0x58,0xB9,0xBA,0xA4,0x7C,0x97,0x7C,0x9F,0x7C,0xA7,0x9C,0xAF,0x9D,0xBF,0x7C,0x9F,0x7C,0x97,0x71,0x54,0x62,0x08,0xAC,0x58,0x58,0xB9,0x58,0xB9,0x79,0xC2,0x7E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0xD9,0x86,0x45,0x19,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x18,0x67,0x18,0x67,0x18,0x47,0x20,0x68,0x28,0x4A,0x30,0x8E,0x40,0x6F,0x58,0x6F,0x50,0x8C,0x58,0x4F,0x68,0x9C,0xC8,0x7E,0xE9,0x3B,0xD1,0x71,0x88,0x91,0x90,0x8F,0x88,0x2A,0x68,0x29,0x58,0x49,0x60,0x27,0x50,0x26,0x48,0x25,0x40,
-	0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x28,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x88,0x58,0xB9,0x58,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0x7C,0x97,0x4C,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x13,0x91,0x58,0xB9,0x7B,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xC7,0x7C,0x97,0xE8,0x21,0x22,0x00,0x21,0x00,0x02,0x00,0x01,0x00,0x23,0x08,0x68,0x38,0xAD,0x60,0xF1,0x80,0x74,0x91,0x57,0x9B,0x97,0x94,0x54,0x6D,0xF6,0x75,0x78,0x7E,0x78,0x7E,0x25,0x11,0x01,0x00,0x01,0x00,0x13,0x91,0x58,0xB9,0xB8,0xB9,0xBD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x97,0x28,0x2A,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x18,0x67,0x20,0x67,0x20,0x68,0x28,0x4A,0x30,0x4C,0x40,0xAF,0x50,0x8F,0x60,0x2E,0x48,0x4D,0x50,0x16,0xA1,0x7E,0xE9,0x5D,0xE1,0x93,0x98,0x91,0x90,0x91,0x90,0x6C,0x78,0x28,0x58,0x49,0x60,0x49,0x60,0x28,0x58,0x26,0x48,
-	0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x24,0x38,0x24,0x38,0x23,0x30,0x23,0x30,0x23,0x28,0x23,0x28,0x22,0x20,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x78,0x58,0xB9,0x58,0xB9,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xE7,0x7C,0x97,0x4C,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x08,0x13,0x91,0x58,0xB9,0x5C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xC7,0x7C,0x97,0xE8,0x21,0x22,0x00,0x22,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x02,0x08,0x24,0x18,0x24,0x18,0x01,0x00,0x62,0x08,0xE4,0x10,0x25,0x11,0x21,0x00,0x01,0x00,0x01,0x00,0x6A,0x48,0x58,0xB9,0x58,0xB9,0xFD,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xA7,0x0F,0x4C,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x20,0x68,0x28,0x68,0x28,0x8A,0x38,0xAB,0x38,0x4F,0x48,0x90,0x60,0x8E,0x58,0x4C,0x58,0x32,0x78,0x3D,0xD9,0x7E,0xE9,0x9A,0xC0,0x8F,0x80,0x90,0x88,0x6F,0x88,0x28,0x58,0x27,0x50,0x48,0x58,0x28,0x58,0x26,0x48,
-	0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x23,0x30,0x23,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x20,0x22,0x18,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x60,0x58,0xB9,0x58,0xB9,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x97,0x4C,0x3B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x13,0x99,0x58,0xB9,0x7C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xB7,0xFA,0x86,0x67,0x19,0x22,0x00,0x22,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x45,0x20,0x37,0xB1,0x58,0xB9,0x5C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xAF,0x34,0x65,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x20,0x68,0x28,0x69,0x28,0x4A,0x30,0x8A,0x38,0xAD,0x48,0x6F,0x60,0x8E,0x58,0x8C,0x58,0x4D,0x58,0xB9,0xB8,0x7E,0xE9,0x3D,0xE1,0x91,0x90,0x6D,0x78,0x8E,0x80,0x4B,0x70,0x27,0x50,0x28,0x58,0x49,0x60,0x27,0x50,
-	0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x23,0x30,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x21,0x10,0x21,0x10,0x21,0x08,0x20,0x08,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x60,0x58,0xB9,0x58,0xB9,0xFE,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x9F,0x6D,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x18,0x15,0xA1,0x58,0xB9,0x3D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xAF,0xFA,0x86,0x67,0x19,0x22,0x00,0x22,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x24,0x18,0x35,0xA1,0x58,0xB9,0x5C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xBF,0xF6,0x75,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x22,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x28,0xAA,0x30,0x8A,0x30,0x8A,0x30,0x6B,0x48,0xCE,0x50,0xAE,0x60,0x6D,0x58,0x6C,0x58,0x91,0x88,0x3D,0xE1,0x7E,0xE9,0x38,0xC1,0x4C,0x70,0x6D,0x78,0x6C,0x70,0x29,0x60,0x27,0x50,0x49,0x60,0x27,0x50,
-	0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x28,0x23,0x20,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x50,0x58,0xB9,0x58,0xB9,0xDC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xAF,0x91,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x35,0xA1,0xB8,0xB9,0xBD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0x7C,0xA7,0x99,0x86,0x25,0x11,0x22,0x00,0x22,0x00,0x02,0x00,0x02,0x00,0xE5,0x18,0x87,0x29,0x87,0x29,0xC8,0x31,0xE8,0x39,0xE8,0x39,0xE8,0x39,0x0D,0x63,0xCC,0x5A,0x21,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x24,0x18,0x15,0xA1,0x58,0xB9,0x5C,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9C,0xAF,0xFA,0x86,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x22,0x00,0x22,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x30,0xAA,0x30,0x8A,0x30,0x8A,0x30,0x8A,0x38,0x4D,0x48,0xCF,0x58,0xAE,0x60,0x8D,0x58,0x8D,0x60,0xD8,0xC0,0x7E,0xE9,0x5C,0xD9,0x6E,0x80,0x4B,0x70,0x8E,0x80,0x6C,0x70,0x28,0x58,0x27,0x50,0x49,0x60,
-	0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x23,0x28,0x23,0x28,0x23,0x20,0x22,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x10,0x22,0x10,0x21,0x10,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x38,0x58,0xB9,0x58,0xB9,0xFB,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xBF,0x54,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x20,0x36,0xA9,0x38,0xC2,0x3E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x7C,0x9F,0x37,0x7E,0xC4,0x08,0x22,0x00,0x22,0x00,0x02,0x00,0x02,0x00,0xB2,0x94,0x7D,0xEF,0x7D,0xEF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x83,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x24,0x18,0x15,0xA1,0x58,0xB9,0xBD,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xAF,0x7C,0x97,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0x30,0xAB,0x38,0xAA,0x38,0xAA,0x38,0xAA,0x38,0x8C,0x50,0x6D,0x58,0xAC,0x58,0xAC,0x58,0x8F,0x70,0x1B,0xD1,0x7E,0xE9,0xF6,0xB0,0x4B,0x70,0x6D,0x78,0x6D,0x78,0x4A,0x68,0x27,0x50,0x48,0x58,
-	0x28,0x58,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x23,0x30,0x24,0x30,0x23,0x20,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x18,0x22,0x18,0x22,0x18,0x23,0x18,0x22,0x10,0x21,0x08,0x21,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x58,0xB9,0x58,0xB9,0x59,0xCB,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x58,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x28,0x37,0xB1,0xB9,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x97,0xF6,0x75,0x63,0x00,0x22,0x00,0x22,0x00,0x8C,0x50,0x8C,0x50,0x53,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xDF,0xF6,0x7D,0x4D,0x43,0x01,0x00,0x01,0x00,0x01,0x00,0x24,0x18,0x15,0xA1,0x78,0xB9,0x5D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0x9F,0xF7,0x75,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0xAB,0x38,0x8C,0x48,0xAD,0x60,0xAD,0x60,0x4C,0x58,0xAC,0x58,0xD3,0x98,0x7E,0xE9,0x7D,0xE1,0x90,0x90,0x4B,0x70,0x8E,0x80,0x4B,0x70,0x28,0x58,0x27,0x50,
-	0x49,0x60,0x27,0x50,0x25,0x40,0x25,0x38,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x23,0x28,0x23,0x28,0x23,0x28,0x23,0x20,0x23,0x18,0x23,0x18,0x23,0x20,0x23,0x20,0x23,0x18,0x22,0x10,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0xB9,0x58,0xB9,0x99,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xE7,0x7C,0x9F,0x82,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x48,0x58,0xB9,0xBA,0xD3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBD,0xD7,0x7C,0x97,0xD2,0x5C,0x02,0x00,0x22,0x00,0x22,0x00,0x58,0xB9,0x58,0xB9,0x1A,0xD4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x7C,0x9F,0x30,0x4C,0x01,0x00,0x01,0x00,0x01,0x00,0x25,0x20,0x36,0xA9,0x18,0xBA,0x1D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0x7C,0x97,0xF7,0x75,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x38,0xAB,0x38,0xAC,0x40,0xAB,0x40,0x6C,0x48,0xAE,0x58,0xAE,0x68,0xAC,0x58,0x8B,0x50,0x2A,0x60,0xF5,0xB0,0x7D,0xE1,0x38,0xC1,0x6D,0x78,0x6D,0x78,0x8E,0x80,0x4B,0x70,0x27,0x50,
-	0x27,0x50,0x28,0x58,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x23,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x23,0x28,0x23,0x20,0x23,0x20,0x23,0x20,0x24,0x20,0x24,0x28,0x23,0x20,0x23,0x20,0x22,0x18,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x88,0x58,0xB9,0xF8,0xB9,0xFD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x9C,0xAF,0x68,0x2A,0x00,0x00,0x20,0x00,0x00,0x00,0xD0,0x78,0x58,0xB9,0x5D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x9D,0xAF,0x7C,0x97,0x2C,0x3B,0x02,0x00,0x22,0x00,0x22,0x00,0x58,0xB9,0x58,0xB9,0xD9,0xCA,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9D,0xAF,0x71,0x54,0x02,0x00,0x02,0x00,0x02,0x00,0x47,0x28,0x37,0xB1,0xF9,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xD7,0x7C,0x97,0x71,0x54,0x21,0x00,0x21,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x38,0xCC,0x40,0x6C,0x40,0xAC,0x40,0xAC,0x48,0xAE,0x50,0xCF,0x68,0xAE,0x68,0x8B,0x50,0x6B,0x50,0x6E,0x70,0x59,0xC9,0x5C,0xE1,0xB2,0x98,0x4B,0x70,0x4B,0x70,0x6D,0x78,0x29,0x60,
-	0x27,0x50,0x27,0x50,0x28,0x58,0x26,0x48,0x25,0x40,0x25,0x40,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x28,0x24,0x20,0x23,0x18,0x23,0x18,0x23,0x10,0x22,0x10,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x60,0x58,0xB9,0x58,0xB9,0xDC,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xDF,0xD1,0x5C,0x00,0x00,0x00,0x00,0x01,0x00,0x36,0xA9,0x59,0xCB,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xEF,0x7C,0x97,0x7C,0x97,0x05,0x11,0x02,0x00,0x22,0x00,0x22,0x00,0x14,0x99,0x58,0xB9,0x79,0xC2,0x7E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xDF,0xD6,0x75,0x42,0x00,0x02,0x00,0x02,0x00,0x8B,0x48,0x58,0xB9,0x1C,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xB7,0x7C,0x97,0x2C,0x3B,0x21,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x38,0xCC,0x40,0xCC,0x40,0x4C,0x48,0xAC,0x50,0xCE,0x58,0xAE,0x68,0xAD,0x60,0x4B,0x50,0x6A,0x50,0x91,0x90,0x7A,0xD1,0x17,0xB9,0x8E,0x80,0x4A,0x68,0x6C,0x78,0x4B,0x70,
-	0x27,0x50,0x26,0x48,0x27,0x50,0x27,0x50,0x26,0x48,0x25,0x40,0x25,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x24,0x38,0x25,0x38,0x24,0x30,0x24,0x30,0x24,0x30,0x24,0x30,0x25,0x38,0x25,0x30,0x24,0x28,0x24,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x46,0x30,0x37,0xB1,0x58,0xB9,0x79,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xB6,0x24,0x19,0x00,0x00,0x89,0x48,0xB9,0xC2,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBD,0xC7,0x7C,0x97,0x17,0x76,0x02,0x00,0x02,0x00,0x22,0x00,0x22,0x00,0xD1,0x78,0x58,0xB9,0x98,0xB9,0x9D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xC7,0xC8,0x29,0x02,0x00,0x02,0x00,0xB4,0x91,0x5C,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x7C,0xA7,0x3B,0x8F,0x87,0x19,0x22,0x00,0x23,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x40,0xAB,0x40,0xAC,0x40,0xAC,0x40,0xAC,0x58,0xAE,0x60,0xAD,0x60,0x8C,0x58,0x4A,0x50,0x4A,0x60,0xF5,0xA8,0x7A,0xD1,0x16,0xB1,0x4B,0x70,0x4A,0x68,0x4B,0x70,
-	0x4A,0x68,0x26,0x48,0x27,0x50,0x28,0x58,0x28,0x58,0x26,0x48,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x25,0x38,0x25,0x38,0x24,0x38,0x24,0x30,0x25,0x38,0x25,0x40,0x26,0x38,0x24,0x28,0x24,0x20,0x24,0x20,0x24,0x20,0x23,0x18,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x18,0x15,0xA1,0x58,0xB9,0x78,0xB9,0xDD,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x99,0xCE,0xD6,0xB5,0x1B,0xD6,0x5E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xDE,0xF7,0x7C,0xA7,0x7C,0x97,0x6E,0x43,0x02,0x00,0x02,0x00,0x22,0x00,0x21,0x00,0x6B,0x48,0x58,0xB9,0x58,0xB9,0xBB,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFB,0xDE,0xF7,0xBD,0xF8,0xBD,0xFD,0xEE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xD7,0x7C,0x97,0x58,0x7E,0xA5,0x08,0x23,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAD,0x60,0xAE,0x68,0xAC,0x58,0x6A,0x50,0x29,0x40,0x6C,0x70,0x17,0xB9,0x58,0xC9,0xB1,0x90,0x49,0x60,0x4A,0x68,
-	0x4A,0x68,0x28,0x58,0x27,0x50,0x27,0x50,0x28,0x58,0x49,0x60,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x38,0x25,0x40,0x26,0x48,0x26,0x40,0x26,0x30,0x25,0x28,0x24,0x28,0x24,0x28,0x25,0x20,0x24,0x18,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0x78,0x58,0xB9,0x58,0xB9,0x9A,0xD3,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xDE,0xDF,0x7C,0x97,0xDA,0x86,0x46,0x19,0x01,0x00,0x01,0x00,0x21,0x00,0x22,0x00,0x26,0x20,0x36,0xA9,0x58,0xB9,0xF8,0xB9,0x7E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDE,0xF7,0x7C,0xA7,0x7C,0x97,0x93,0x5C,0x04,0x00,0x23,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAC,0x58,0xAD,0x60,0x8B,0x50,0x89,0x40,0x49,0x48,0x8E,0x78,0x16,0xB9,0xF5,0xB0,0x6D,0x78,0x27,0x50,
-	0x49,0x60,0x4A,0x68,0x28,0x58,0x26,0x48,0x27,0x50,0x29,0x60,0x28,0x58,0x26,0x48,0x25,0x40,0x25,0x40,0x25,0x40,0x26,0x48,0x26,0x48,0x26,0x48,0x25,0x40,0x26,0x48,0x28,0x40,0x26,0x48,0x26,0x30,0x25,0x30,0x25,0x28,0x25,0x28,0x25,0x20,0x24,0x18,0x24,0x18,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x30,0x58,0xB9,0x58,0xB9,0xB8,0xB9,0x9D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7C,0xA7,0x7C,0x97,0x34,0x65,0x22,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x02,0x08,0x13,0x91,0x58,0xB9,0x58,0xB9,0x1A,0xD4,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x9D,0xBF,0x7C,0x97,0x1B,0x8F,0xE7,0x10,0x04,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x38,0xAB,0x40,0xAB,0x40,0xAB,0x40,0xAD,0x60,0xAC,0x58,0x6A,0x48,0x28,0x40,0x48,0x50,0x90,0x88,0x17,0xB9,0xD4,0xA8,0x6B,0x60,
-	0x28,0x58,0x4A,0x68,0x4A,0x68,0x28,0x58,0x27,0x50,0x28,0x58,0x49,0x60,0x28,0x58,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x26,0x48,0x28,0x48,0x29,0x58,0x28,0x48,0x26,0x30,0x26,0x30,0x27,0x30,0x26,0x28,0x25,0x20,0x25,0x20,0x25,0x10,0x24,0x10,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0x78,0x58,0xB9,0x58,0xB9,0xF9,0xC2,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9D,0xBF,
-	0x7C,0x97,0x3B,0x8F,0x87,0x19,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x02,0x00,0x6A,0x40,0x37,0xB1,0x58,0xB9,0xD8,0xB9,0x7D,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xBE,0xDF,0x7C,0x9F,0x5B,0x8F,0xD0,0x4B,0x04,0x00,0x03,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x38,0xAA,0x38,0xA9,0x40,0xAB,0x40,0x8A,0x48,0xAC,0x58,0x6A,0x48,0x48,0x40,0x47,0x40,0x49,0x50,0x90,0x88,0x16,0xB1,0xB1,0x98,
-	0x4B,0x68,0x29,0x60,0x4B,0x70,0x4B,0x70,0x28,0x58,0x27,0x50,0x49,0x60,0x4A,0x68,0x29,0x60,0x27,0x50,0x27,0x50,0x27,0x50,0x27,0x48,0x27,0x48,0x28,0x48,0x4A,0x68,0x2B,0x60,0x29,0x40,0x26,0x40,0x27,0x30,0x27,0x30,0x26,0x28,0x25,0x20,0x25,0x20,0x25,0x18,0x24,0x10,0x24,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x35,0xA9,0x58,0xB9,0x58,0xB9,0xBA,0xCB,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xD7,0x7C,0x97,
-	0x7C,0x97,0xCE,0x43,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x02,0x00,0x02,0x00,0xD1,0x78,0x58,0xB9,0x58,0xB9,0x39,0xC2,0x1D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,0xD7,
-	0x7C,0x9F,0x7C,0x97,0x38,0x7E,0xA6,0x08,0x03,0x00,0x01,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x38,0xA9,0x38,0x49,0x38,0xA9,0x40,0x6A,0x48,0x8A,0x50,0x69,0x48,0x47,0x38,0x46,0x38,0x49,0x58,0xD4,0xA8,0x59,0xC9,
-	0xB2,0x98,0x4B,0x68,0x4B,0x70,0x6D,0x78,0x4B,0x70,0x4A,0x68,0x27,0x50,0x4A,0x68,0x6D,0x78,0x4A,0x68,0x29,0x60,0x69,0x50,0x28,0x50,0x28,0x50,0x29,0x58,0x4B,0x68,0x4B,0x68,0x29,0x48,0x2A,0x48,0x29,0x40,0x28,0x38,0x26,0x28,0x26,0x20,0x25,0x20,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x50,0x37,0xB1,0x58,0xB9,0x78,0xB9,0xBA,0xD4,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xCF,0x7C,0x97,0x7C,0x97,
-	0xB6,0x6D,0xA3,0x08,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x02,0x00,0x02,0x00,0x25,0x18,0x14,0x99,0x58,0xB9,0x58,0xB9,0x59,0xC2,0xFD,0xE6,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xBE,0xD7,0x7C,0x9F,
-	0x7C,0x97,0x99,0x7E,0x8A,0x19,0x04,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x30,0x89,0x38,0x49,0x30,0x89,0x40,0x89,0x48,0x29,0x48,0x28,0x38,0x28,0x40,0x47,0x40,0x8C,0x68,0xD4,0xA8,
-	0x59,0xC9,0xD3,0xA0,0x6C,0x78,0x6D,0x78,0x8E,0x80,0x6D,0x78,0x4A,0x68,0x49,0x60,0x6C,0x70,0x8F,0x88,0x6D,0x78,0x4B,0x68,0x4A,0x68,0x49,0x60,0x4B,0x68,0x8F,0x88,0x6E,0x78,0x2C,0x58,0x2B,0x50,0x29,0x40,0x28,0x30,0x27,0x28,0x26,0x28,0x26,0x20,0x26,0x18,0x25,0x10,0x25,0x10,0x24,0x08,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAB,0x58,0x37,0xB1,0x58,0xB9,0x58,0xB9,0x3A,0xC4,0xBE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0x9D,0xB7,0x7C,0x97,0x7C,0x97,0xD6,0x75,
-	0xE4,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x26,0x20,0x35,0xA1,0x58,0xB9,0x58,0xB9,0x38,0xBA,0xBC,0xBE,0xDE,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0x9D,0xAF,0x7C,0x97,0x7C,0x97,
-	0x99,0x7E,0x89,0x19,0x04,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x30,0x68,0x30,0x47,0x30,0x68,0x38,0x89,0x40,0x8A,0x50,0x89,0x40,0x29,0x40,0x48,0x50,0x90,0x90,
-	0x58,0xC9,0x7A,0xD1,0xD4,0xA8,0x6C,0x78,0x6E,0x80,0x90,0x88,0x8E,0x80,0x6C,0x78,0x4B,0x70,0x8D,0x78,0x91,0x90,0xB0,0x90,0x8E,0x80,0x8E,0x80,0x8E,0x80,0x91,0x90,0x70,0x88,0x2C,0x58,0x2B,0x50,0x2A,0x48,0x29,0x38,0x49,0x30,0x28,0x28,0x27,0x28,0x26,0x18,0x26,0x18,0x25,0x10,0x25,0x08,0x24,0x08,0x23,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8B,0x58,0x36,0xA9,0x58,0xB9,0x78,0xB9,0xF9,0xAB,0xFC,0xBE,0xBE,0xDF,0xDE,0xE7,0xDE,0xEF,0xDE,0xEF,0xDE,0xEF,0xDE,0xE7,0xDE,0xDF,0xBD,0xB7,0x7C,0x97,0x7C,0x97,0x3B,0x8F,0x54,0x6D,0xC3,0x08,
-	0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x25,0x18,0xF2,0x80,0x37,0xB1,0x58,0xB9,0xD8,0xB1,0x9A,0xA5,0x7C,0xB7,0xBE,0xDF,0xDE,0xE7,0xDE,0xEF,0xDE,0xEF,0xDE,0xEF,0xDE,0xEF,0xDE,0xE7,0xBE,0xD7,0x9D,0xAF,0x7C,0x97,0x7C,0x97,0x3B,0x8F,0x75,0x65,
-	0x07,0x11,0x04,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x30,0x48,0x30,0x88,0x38,0x89,0x40,0x8B,0x50,0x8B,0x50,0x8A,0x50,0x89,0x48,0x8A,0x58,
-	0xD2,0x98,0x7A,0xD1,0x5B,0xD9,0xD4,0xA8,0x6D,0x78,0x8E,0x80,0x91,0x90,0x91,0x90,0x6F,0x88,0x8E,0x80,0x90,0x88,0xD4,0xA8,0xB2,0x98,0x90,0x88,0x90,0x88,0xB3,0xA0,0x70,0x88,0x6E,0x68,0x2D,0x58,0x2B,0x50,0x2A,0x48,0x29,0x40,0x2A,0x30,0x29,0x28,0x28,0x20,0x26,0x18,0x26,0x10,0x25,0x10,0x24,0x08,0x24,0x00,0x23,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x28,0xD0,0x78,0x58,0xB9,0x58,0xB9,0x78,0xB2,0x9A,0xA5,0x5C,0x9F,0x7C,0x9F,0x7C,0x9F,0x7C,0x9F,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x37,0x76,0xAA,0x32,0x62,0x08,0x01,0x00,
-	0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x04,0x08,0x69,0x30,0xF3,0x90,0x58,0xB9,0x98,0xB9,0xF9,0xAA,0xBA,0x9D,0x7C,0x97,0x7C,0x9F,0x7C,0x9F,0x7C,0x9F,0x7C,0x9F,0x7C,0x97,0x7C,0x97,0x7C,0x97,0x5B,0x8F,0x75,0x6D,0x2A,0x2A,0x45,0x00,
-	0x04,0x00,0x02,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x30,0x69,0x30,0x69,0x30,0x89,0x40,0x8B,0x50,0xAD,0x60,0xAC,0x58,0x8A,0x50,0x8A,0x50,
-	0x4C,0x70,0xF5,0xB0,0xBA,0xD1,0xBC,0xD9,0x37,0xC1,0x8F,0x88,0x90,0x88,0xB3,0xA0,0xD4,0xA8,0xB2,0x98,0x91,0x90,0xB3,0xA0,0x58,0xC9,0x16,0xB9,0xD6,0xB0,0x96,0xB0,0xF3,0x98,0x8F,0x68,0x8E,0x68,0x4D,0x58,0x2D,0x50,0x2B,0x48,0x2B,0x30,0x29,0x28,0x28,0x20,0x28,0x20,0x26,0x10,0x26,0x10,0x25,0x08,0x24,0x08,0x23,0x00,0x23,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x18,0x8A,0x50,0xCF,0x78,0xF2,0x88,0xF2,0x81,0xD3,0x73,0xD3,0x6C,0x95,0x6D,0x95,0x6D,0x13,0x5D,0xCE,0x4B,0x65,0x19,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x26,0x18,0x8C,0x48,0xD0,0x68,0xF2,0x88,0xF3,0x81,0xB4,0x7B,0xD4,0x6C,0x75,0x6D,0x96,0x6D,0x96,0x6D,0x11,0x4C,0x0D,0x3B,0xC4,0x08,0x03,0x00,0x04,0x00,0x04,0x00,
-	0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x30,0xA9,0x38,0x8A,0x40,0x8B,0x50,0xAC,0x58,0xCF,0x70,0xAD,0x60,0x6B,0x68,
-	0x8D,0x60,0x8E,0x78,0x78,0xC1,0x1B,0xD2,0x7C,0xD9,0x38,0xC1,0xB2,0x98,0xB3,0xA0,0xF5,0xB0,0x58,0xC1,0x17,0xB9,0xD4,0xA8,0xB5,0xA8,0x39,0xC9,0xDB,0xD0,0x3C,0xD9,0x9A,0xB8,0x92,0x80,0xB1,0x70,0x70,0x60,0x8E,0x50,0x2E,0x48,0x2C,0x40,0x6B,0x38,0x2A,0x28,0x29,0x20,0x28,0x18,0x26,0x10,0x26,0x10,0x25,0x08,0x24,0x08,0x24,0x00,
-	0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x22,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x40,0x8B,0x48,0xAC,0x58,0xAD,0x60,0xD1,0x78,0x32,0x81,
-	0xD0,0x78,0xD0,0x78,0xB0,0x88,0x5A,0xC9,0x5C,0xD2,0xDD,0xD9,0x99,0xC9,0xF5,0xB0,0xF5,0xB0,0x59,0xC9,0x7A,0xD1,0x7A,0xD1,0x16,0xB9,0x7A,0xD1,0x7A,0xD1,0x7B,0xD9,0xBC,0xD9,0xB8,0xA8,0x92,0x88,0xB1,0x70,0x70,0x60,0x8F,0x58,0x8E,0x48,0x4D,0x38,0x2C,0x30,0x2A,0x28,0x28,0x20,0x27,0x10,0x26,0x10,0x25,0x08,0x25,0x08,0x24,0x08,
-	0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x23,0x00,0x22,0x00,0x23,0x00,0x25,0x00,0x24,0x00,0x22,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x48,0xAC,0x58,0xAD,0x60,0xF1,0x78,0xF3,0x98,
-	0x33,0x91,0xB1,0x88,0xF1,0x88,0xB1,0x90,0x7A,0xC9,0xBD,0xE1,0x9C,0xD2,0x5B,0xD2,0x38,0xC1,0x57,0xB1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0x7A,0xD1,0xDB,0xD1,0xBA,0xD1,0x58,0xB9,0x95,0x88,0x93,0x68,0x91,0x58,0x90,0x50,0xAF,0x48,0x2E,0x38,0x4C,0x28,0x2A,0x20,0x28,0x18,0x27,0x18,0x27,0x10,0x26,0x10,0x25,0x08,
-	0x24,0x08,0x23,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xED,0x58,0xAC,0x58,0xF1,0x78,0xF3,0x98,
-	0x35,0xA9,0x55,0x99,0xD2,0x90,0x32,0x89,0xD2,0x90,0x3A,0xC9,0x5C,0xD2,0xDC,0xD2,0xBB,0xCA,0xDA,0xD1,0x78,0xB9,0x1B,0xD2,0x7B,0xCA,0xFA,0xC9,0xBA,0xD1,0xBA,0xD1,0x7A,0xD1,0x7C,0xD9,0x7A,0xC9,0x79,0xB1,0x79,0x88,0xF4,0x68,0x72,0x50,0x92,0x50,0xB0,0x48,0x6D,0x38,0x6B,0x28,0x4A,0x20,0x48,0x18,0x47,0x18,0x27,0x10,0x26,0x10,
-	0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x47,0x00,0x26,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x58,0x0F,0x69,0x32,0x81,
-	0x54,0x99,0x56,0xA9,0x94,0xA1,0x12,0x91,0x12,0x81,0xD1,0x80,0x58,0xC1,0xDC,0xD2,0xFC,0xCB,0xBC,0xCB,0x5B,0xD2,0x59,0xBA,0x7B,0xCA,0xBB,0xCA,0x79,0xBA,0x9B,0xD2,0x7B,0xD2,0xBA,0xD1,0x1B,0xD2,0x9C,0xB9,0x7A,0xB9,0x98,0x91,0x78,0x78,0xB2,0x58,0xB0,0x48,0xAF,0x38,0x4C,0x30,0x8B,0x28,0x89,0x20,0x68,0x18,0x67,0x18,0x26,0x10,
-	0x25,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x00,0x22,0x00,0x21,0x08,0x22,0x08,0x22,0x08,0x21,0x00,0x21,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x26,0x08,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x26,0x00,0x48,0x00,0x25,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x81,
-	0x53,0x89,0x14,0x99,0x76,0xA1,0xF4,0xA0,0x32,0x81,0x32,0x81,0xF2,0x80,0x39,0xC9,0xBB,0xCA,0xF9,0xC4,0x7B,0xC4,0xBB,0xCB,0x99,0xBA,0x58,0xBA,0x9A,0xC2,0x9A,0xC2,0xF9,0xBA,0xFC,0xCA,0xB8,0xB2,0xD8,0xB9,0x97,0xA1,0x77,0xA9,0x77,0x91,0x56,0x81,0xF4,0x58,0xB0,0x48,0xAF,0x40,0x6D,0x30,0x8B,0x28,0x69,0x20,0x68,0x18,0x66,0x18,
-	0x25,0x10,0x24,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,
-	0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x27,0x00,0x49,0x00,0x25,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x11,0x79,0x53,0x89,0x53,0x89,0x54,0x91,0x54,0x91,0x33,0x89,0x53,0x89,0x33,0x89,0xF7,0xB1,0xBB,0xCA,0xDA,0xC4,0x7C,0xCE,0x59,0xC5,0xFA,0xC3,0xDA,0xC2,0x7A,0xBB,0x5B,0xC4,0x5B,0xC4,0x19,0xC5,0xBC,0xCB,0x5A,0xC2,0xB7,0xA9,0x97,0xA1,0xD7,0x99,0xB6,0x91,0x54,0x71,0xF2,0x58,0xAF,0x40,0x8D,0x30,0xAA,0x28,0x68,0x20,0x67,0x18,
-	0x45,0x18,0x25,0x10,0x44,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x08,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x08,0x23,0x00,
-	0x23,0x08,0x22,0x08,0x23,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x25,0x08,0x25,0x08,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x08,0x26,0x08,0x26,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x26,0x00,0x2A,0x00,0x27,0x00,0x25,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xF0,0x68,0xF0,0x70,0x12,0x81,0x35,0xA1,0x77,0xA9,0x55,0x99,0x55,0x99,0x74,0x91,0x56,0xA9,0xBA,0xC2,0xDB,0xC3,0xF8,0xC5,0x19,0xC6,0xF8,0xC5,0xDA,0xC4,0xF7,0xB4,0x98,0xC5,0xF8,0xC5,0xF8,0xC5,0x7B,0xC4,0x39,0xBB,0xD8,0xB2,0xF7,0x99,0xB6,0x91,0x95,0x91,0x75,0x79,0x33,0x69,0xD0,0x48,0xAD,0x38,0x8A,0x28,0x68,0x20,
-	0x66,0x18,0x66,0x18,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x22,0x08,0x22,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x22,0x00,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,
-	0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x25,0x08,0x25,0x08,0x25,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x08,0x26,0x08,0x26,0x08,0x25,0x00,0x24,0x00,0x24,0x00,0x26,0x08,0x29,0x10,0x2B,0x10,0x28,0x00,0x24,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x10,0x69,0xF0,0x70,0x32,0x79,0xB6,0x91,0x77,0xA9,0x77,0xA9,0x76,0xA1,0xB6,0x99,0xB7,0xA1,0x98,0xB2,0x7B,0xC4,0xBA,0xC5,0x19,0xC6,0x19,0xC6,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0x98,0xC5,0xF9,0xC4,0xB8,0xB2,0x37,0xA2,0x95,0x91,0x75,0x79,0x33,0x69,0x12,0x61,0xB1,0x50,0xCD,0x40,0xAA,0x30,
-	0x68,0x20,0x67,0x18,0x66,0x18,0x66,0x18,0x45,0x18,0x45,0x10,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,
-	0x25,0x08,0x25,0x08,0x26,0x08,0x27,0x08,0x27,0x08,0x27,0x10,0x27,0x08,0x25,0x08,0x25,0x08,0x24,0x00,0x25,0x08,0x25,0x08,0x26,0x08,0x27,0x00,0x26,0x08,0x25,0x08,0x25,0x00,0x26,0x00,0x2E,0x18,0x31,0x28,0x2B,0x08,0x26,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x61,0x11,0x71,0x74,0x89,0xB6,0x99,0xBB,0xA9,0x77,0xB1,0x77,0xB1,0xD7,0x99,0x96,0xA1,0x76,0xAA,0xB8,0xBC,0x98,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0x56,0xB5,0x96,0xAB,0x57,0xA2,0x74,0x79,0x33,0x69,0x32,0x61,0x30,0x59,0xCF,0x48,0xCC,0x38,
-	0xAB,0x30,0xAA,0x28,0x68,0x28,0x68,0x20,0x67,0x20,0x46,0x20,0x67,0x20,0x67,0x20,0x47,0x20,0x26,0x18,0x24,0x18,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x23,0x08,0x22,0x08,0x22,0x08,0x22,0x08,0x23,0x08,0x23,0x08,0x24,0x10,0x24,0x10,0x25,0x10,0x25,0x10,0x26,0x10,
-	0x28,0x10,0x28,0x10,0x29,0x20,0x28,0x18,0x28,0x18,0x28,0x10,0x28,0x10,0x28,0x10,0x29,0x08,0x29,0x08,0x2A,0x10,0x29,0x10,0x29,0x10,0x28,0x10,0x27,0x08,0x2A,0x08,0x2F,0x20,0x33,0x30,0x31,0x20,0x2A,0x08,0x24,0x00,0x23,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x69,0x75,0x81,0xB6,0x99,0x37,0xB2,0x37,0xB2,0xB6,0xA1,0xD6,0x99,0x35,0xA2,0x16,0xAB,0xF7,0xB3,0xB7,0xBD,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0xF8,0xC5,0x97,0xBD,0xB6,0xAC,0x35,0xA3,0x35,0x9A,0x93,0x79,0x51,0x61,0xEF,0x50,0xCC,0x40,
-	0xCC,0x38,0xAB,0x38,0xAB,0x30,0xCB,0x30,0xAB,0x38,0xAB,0x38,0xAB,0x38,0x4A,0x30,0x69,0x28,0x27,0x20,0x25,0x18,0x25,0x18,0x24,0x18,0x24,0x10,0x24,0x18,0x24,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x08,0x23,0x10,0x23,0x10,0x24,0x10,0x24,0x10,0x25,0x10,0x26,0x10,0x26,0x10,0x26,0x10,0x28,0x20,0x28,0x18,
-	0x29,0x20,0x29,0x20,0x28,0x10,0x29,0x18,0x29,0x18,0x2B,0x18,0x2D,0x20,0x2E,0x20,0x2F,0x18,0x2E,0x20,0x2D,0x20,0x2B,0x18,0x2A,0x10,0x2D,0x18,0x32,0x30,0x37,0x48,0x36,0x40,0x2C,0x10,0x27,0x00,0x23,0x00,0x22,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0x81,0xB6,0x99,0x17,0xAA,0x77,0xAA,0x35,0xA2,0x35,0xA2,0x96,0xAA,0x16,0xAB,0x16,0xAC,0xD6,0xAC,0xD7,0xBD,0xF8,0xC5,0xF8,0xC5,0xD7,0xBD,0xD7,0xBD,0xB7,0xBD,0xB7,0xBD,0xD7,0xBD,0xB7,0xBD,0xF6,0xAC,0x16,0xAC,0x55,0xA3,0x14,0x92,0x94,0x79,0x31,0x61,
-	0xCF,0x48,0xCD,0x40,0xCC,0x38,0xCC,0x40,0xCE,0x48,0xCE,0x40,0xAD,0x40,0xAB,0x38,0x4A,0x30,0x49,0x28,0x48,0x28,0x27,0x28,0x27,0x20,0x26,0x20,0x26,0x20,0x25,0x20,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x24,0x18,0x24,0x18,0x25,0x18,0x26,0x18,0x26,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x27,0x18,0x27,0x18,
-	0x27,0x18,0x29,0x18,0x2A,0x20,0x2C,0x28,0x2F,0x28,0x30,0x30,0x34,0x30,0x33,0x30,0x32,0x28,0x30,0x20,0x2F,0x20,0x31,0x28,0x35,0x38,0x38,0x50,0x36,0x48,0x2F,0x20,0x28,0x00,0x24,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0x89,0x35,0xA2,0x35,0xA2,0x95,0x9A,0x36,0xAB,0x55,0xA3,0x96,0xAB,0xD6,0xAB,0x16,0xAD,0x36,0xAD,0x36,0xAD,0x56,0xB5,0x56,0xB5,0x97,0xB5,0x97,0xB5,0x56,0xB5,0x16,0xAD,0xF6,0xAC,0xF6,0xAC,0xD6,0xAB,0x55,0xA4,0x35,0xA3,0x94,0x92,
-	0xD3,0x79,0x12,0x61,0x30,0x59,0x0F,0x51,0xCE,0x48,0xCC,0x40,0xAB,0x38,0x4B,0x30,0x69,0x28,0x49,0x28,0x29,0x28,0x29,0x28,0x28,0x28,0x27,0x28,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x20,0x26,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x10,0x25,0x18,0x25,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x27,0x18,0x28,0x18,0x29,0x20,
-	0x2B,0x20,0x2E,0x28,0x30,0x30,0x33,0x30,0x33,0x30,0x34,0x30,0x33,0x30,0x32,0x30,0x33,0x30,0x35,0x40,0x37,0x48,0x39,0x70,0x38,0x50,0x30,0x28,0x29,0x10,0x25,0x08,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x9A,0xB4,0x9A,0x35,0xA3,0x75,0xA3,0x96,0xAB,0x96,0xAB,0x96,0xAB,0xF6,0xAC,0xF6,0xAC,0x56,0xB5,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x77,0xB5,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x96,0xAC,0x96,0xAC,
-	0x75,0xA3,0xD4,0x9A,0xD4,0x89,0x92,0x71,0x30,0x69,0xEE,0x50,0x8D,0x50,0xAB,0x40,0x8C,0x38,0x2B,0x30,0x2B,0x30,0x29,0x28,0x28,0x28,0x27,0x20,0x27,0x28,0x26,0x20,0x26,0x20,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x26,0x18,0x27,0x20,0x28,0x20,0x29,0x20,0x2B,0x28,0x2C,0x28,0x2E,0x28,
-	0x2F,0x30,0x30,0x38,0x30,0x38,0x30,0x30,0x30,0x38,0x32,0x38,0x35,0x38,0x38,0x58,0x38,0x68,0x39,0x78,0x37,0x70,0x31,0x38,0x2A,0x10,0x27,0x08,0x24,0x08,0x23,0x00,0x22,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x53,0x8A,0x53,0x8A,0xD4,0x9A,0x75,0xA3,0xF3,0x93,0xF3,0x93,0xF5,0xA3,0x53,0x94,0xD4,0x9B,0x94,0x9B,0x53,0x94,0xD5,0xA4,0x73,0x9C,0x73,0x9C,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0xF6,0xAC,0x75,0xA4,0xB5,0xA3,
-	0xF4,0x9A,0x93,0x92,0x73,0x92,0x53,0x8A,0xD3,0x89,0xB3,0x81,0x92,0x81,0x33,0x71,0x32,0x79,0xD0,0x68,0xAF,0x58,0x2E,0x48,0x2C,0x48,0x2C,0x40,0x2B,0x40,0x2A,0x30,0x28,0x28,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x28,0x20,0x29,0x28,0x2A,0x28,0x2C,0x28,0x4C,0x30,0x4C,0x30,0x2D,0x30,0x4D,0x30,
-	0x4C,0x28,0x2F,0x30,0x2F,0x28,0x51,0x40,0x36,0x58,0x36,0x78,0x38,0x90,0x37,0x88,0x52,0x58,0x2D,0x30,0x29,0x08,0x26,0x08,0x24,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x8A,0x93,0x92,0xF4,0x9A,0xB3,0x93,0x12,0x94,0x94,0x9B,0xB4,0x92,0xB3,0x92,0x32,0x82,0xF2,0x81,0x32,0x82,0x73,0x8A,0x71,0x8B,0xD1,0x8B,0x94,0x9C,0x94,0x9C,0xB5,0xA4,0x73,0x9C,
-	0x12,0x94,0x53,0x9B,0xF3,0x92,0x73,0x8A,0xF3,0x89,0xD3,0x89,0x51,0x71,0x31,0x79,0x31,0x71,0xF0,0x70,0x71,0x70,0x50,0x68,0x30,0x68,0x30,0x60,0x2E,0x48,0x2D,0x48,0x2B,0x40,0x2B,0x30,0x2A,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x29,0x28,0x2A,0x28,0x2A,0x28,0x2A,0x28,0x2A,0x28,0x29,0x28,0x2A,0x28,0x2B,0x28,0x4B,0x28,0x4D,0x30,
-	0x2F,0x40,0x52,0x58,0x75,0x60,0x35,0x78,0x36,0x88,0x33,0x70,0x4F,0x38,0x2A,0x18,0x28,0x10,0x25,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x8A,0x73,0x8A,0x32,0x8B,0xD3,0x9A,0xD1,0x82,0x53,0x8A,0xD1,0x71,0x71,0x61,0x50,0x59,0xEF,0x50,0x2E,0x51,0x8E,0x51,0xB2,0x8A,0x31,0x83,0x50,0x83,0x71,0x8B,
-	0x32,0x94,0x32,0x94,0x12,0x94,0xD2,0x93,0xB2,0x8B,0xD3,0x92,0x53,0x8A,0xB2,0x81,0x32,0x79,0x91,0x70,0xF0,0x68,0x4F,0x60,0x2F,0x58,0x2F,0x48,0x2D,0x48,0x2D,0x48,0x2C,0x40,0x2C,0x38,0x2A,0x38,0x2B,0x30,0x2A,0x28,0x28,0x28,0x29,0x28,0x28,0x28,0x29,0x28,0x2A,0x28,0x2C,0x30,0x2D,0x40,0x2E,0x40,0x2F,0x50,0x32,0x60,0x33,0x68,
-	0x34,0x70,0x53,0x60,0x30,0x50,0x2E,0x38,0x2A,0x28,0x28,0x18,0x26,0x10,0x25,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x23,0x08,0x24,0x00,0x23,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0x71,0x32,0x82,0x12,0x82,0x12,0x82,0xB1,0x71,0x71,0x61,0x31,0x61,0x2E,0x49,0x0D,0x41,0xEB,0x38,0xEC,0x38,0x2F,0x51,0x6F,0x61,0x90,0x71,
-	0x90,0x69,0xF1,0x79,0x90,0x7A,0x32,0x83,0x91,0x8B,0xB2,0x8B,0x72,0x8B,0xD3,0x92,0x73,0x8A,0x13,0x8A,0x73,0x89,0x11,0x79,0x31,0x70,0x31,0x70,0x30,0x60,0x30,0x60,0x30,0x60,0x2E,0x58,0x2F,0x60,0x2E,0x50,0x2E,0x58,0x2E,0x50,0x2E,0x50,0x2F,0x50,0x2F,0x50,0x30,0x60,0x30,0x60,0x32,0x68,0x32,0x60,0x31,0x60,0x2F,0x58,0x2D,0x40,
-	0x2B,0x28,0x29,0x20,0x27,0x18,0x25,0x10,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x61,0x71,0x61,0x71,0x61,0x30,0x59,0x2F,0x51,0xEC,0x38,0xCA,0x30,0xAA,0x30,0xAA,0x30,0xCA,0x30,
-	0xA9,0x30,0xC9,0x30,0xCA,0x38,0xCC,0x40,0x2F,0x51,0x0F,0x61,0x70,0x71,0x70,0x71,0x71,0x71,0x71,0x79,0x72,0x79,0x11,0x79,0x51,0x78,0x31,0x70,0x51,0x80,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x31,0x70,0x30,0x68,0x30,0x60,0x2F,0x50,0x2E,0x50,0x2E,0x48,0x2C,0x40,0x2C,0x38,0x2A,0x30,0x29,0x28,0x28,0x20,0x27,0x18,0x26,0x10,
-	0x25,0x10,0x24,0x08,0x24,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x51,0x2E,0x49,0xEC,0x38,0xEB,0x38,0xEA,0x30,0xCA,0x30,0xCA,0x30,
-	0xA8,0x20,0xA8,0x28,0xA9,0x28,0xA8,0x28,0x88,0x28,0x89,0x28,0x8A,0x30,0xAB,0x38,0x4B,0x38,0x4B,0x38,0x2D,0x38,0x2D,0x40,0x2D,0x40,0x2C,0x40,0x2D,0x40,0x2C,0x48,0x2C,0x40,0x2B,0x40,0x2B,0x38,0x2A,0x28,0x29,0x28,0x28,0x20,0x27,0x20,0x26,0x18,0x25,0x10,0x25,0x10,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x08,0x23,0x10,
-	0x24,0x08,0x24,0x08,0x24,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x30,0xEA,0x30,0xEB,0x38,0xEA,0x30,
-	0xCB,0x30,0xCA,0x30,0xCA,0x30,0xA9,0x28,0xA9,0x28,0x89,0x28,0x88,0x28,0x69,0x28,0x68,0x28,0x47,0x20,0x26,0x18,0x26,0x20,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x23,0x08,0x23,0x08,0x23,0x08,0x24,0x08,0x24,0x08,0x24,0x10,0x24,0x10,
-	0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x24,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x30,
-	0xEB,0x38,0xEB,0x38,0xEB,0x30,0xCA,0x30,0xAA,0x30,0xAA,0x30,0xAA,0x30,0x89,0x28,0x69,0x28,0x68,0x28,0x27,0x20,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x18,0x25,0x18,0x24,0x10,0x24,0x10,0x24,0x10,0x23,0x10,0x23,0x08,0x23,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x25,0x10,0x25,0x10,
-	0x25,0x10,0x24,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x30,0xAA,0x30,0x69,0x28,0x68,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x20,0x27,0x18,0x26,0x18,0x26,0x18,0x25,0x18,0x25,0x18,0x25,0x10,0x24,0x10,0x24,0x10,0x24,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_3589_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_3589_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_3589_dial_img_preview_data_0};
-
-    
\ No newline at end of file
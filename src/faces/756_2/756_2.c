@@ -10,114 +10,117 @@
 
 lv_obj_t *face_756_2;
 lv_obj_t *face_756_2_0_424;
-lv_obj_t *face_756_2_2_15014;
-lv_obj_t *face_756_2_3_18734;
-lv_obj_t *face_756_2_5_22382;
-lv_obj_t *face_756_2_6_25488;
-lv_obj_t *face_756_2_7_25488;
-lv_obj_t *face_756_2_8_81874;
-lv_obj_t *face_756_2_9_81874;
-lv_obj_t *face_756_2_10_22752;
-lv_obj_t *face_756_2_11_22752;
-lv_obj_t *face_756_2_12_22752;
-lv_obj_t *face_756_2_13_22752;
-lv_obj_t *face_756_2_14_22752;
-lv_obj_t *face_756_2_15_22752;
-lv_obj_t *face_756_2_16_22752;
-lv_obj_t *face_756_2_17_17160;
-lv_obj_t *face_756_2_18_17160;
-lv_obj_t *face_756_2_20_105728;
+lv_obj_t *face_756_2_2_53268;
+lv_obj_t *face_756_2_3_60934;
+lv_obj_t *face_756_2_5_74432;
+lv_obj_t *face_756_2_6_75640;
+lv_obj_t *face_756_2_7_75640;
+lv_obj_t *face_756_2_8_284946;
+lv_obj_t *face_756_2_9_284946;
+lv_obj_t *face_756_2_10_360030;
+lv_obj_t *face_756_2_11_360030;
+lv_obj_t *face_756_2_12_360030;
+lv_obj_t *face_756_2_13_360030;
+lv_obj_t *face_756_2_14_360030;
+lv_obj_t *face_756_2_15_360030;
+lv_obj_t *face_756_2_16_360030;
+lv_obj_t *face_756_2_17_368896;
+lv_obj_t *face_756_2_18_368896;
+lv_obj_t *face_756_2_20_388522;
 
 
 #if LV_COLOR_DEPTH != 16
 #error "LV_COLOR_DEPTH should be 16bit for watchfaces"
 #endif
+#if FACE_SIDE != 240 && FACE_SIDE != 466
+#error "756_2 has no assets for this screen, add its side to the targets"
+#endif
 
-const lv_img_dsc_t *face_756_2_dial_img_1_13004_group[] = {
-	&face_756_2_dial_img_1_13004_0,
-	&face_756_2_dial_img_1_13004_1,
+const lv_img_dsc_t *face_756_2_dial_img_1_46130_group[] = {
+	&face_756_2_dial_img_1_46130_0,
+	&face_756_2_dial_img_1_46130_1,
 };
-const lv_img_dsc_t *face_756_2_dial_img_2_15014_group[] = {
-	&face_756_2_dial_img_2_15014_0,
-	&face_756_2_dial_img_2_15014_1,
+const lv_img_dsc_t *face_756_2_dial_img_2_53268_group[] = {
+	&face_756_2_dial_img_2_53268_0,
+	&face_756_2_dial_img_2_53268_1,
 };
-const lv_img_dsc_t *face_756_2_dial_img_3_18734_group[] = {
-	&face_756_2_dial_img_3_18734_0,
-	&face_756_2_dial_img_3_18734_1,
-	&face_756_2_dial_img_3_18734_2,
-	&face_756_2_dial_img_3_18734_3,
-	&face_756_2_dial_img_3_18734_4,
-	&face_756_2_dial_img_3_18734_5,
+const lv_img_dsc_t *face_756_2_dial_img_3_60934_group[] = {
+	&face_756_2_dial_img_3_60934_0,
+	&face_756_2_dial_img_3_60934_1,
+	&face_756_2_dial_img_3_60934_2,
+	&face_756_2_dial_img_3_60934_3,
+	&face_756_2_dial_img_3_60934_4,
+	&face_756_2_dial_img_3_60934_5,
 };
 const lv_img_dsc_t *face_756_2_dial_img_connection[] = {
-	&face_756_2_dial_img_4_22016_0,
-	&face_756_2_dial_img_5_22382_0,
+	&face_756_2_dial_img_4_73228_0,
+	&face_756_2_dial_img_5_74432_0,
 };
-const lv_img_dsc_t *face_756_2_dial_img_6_25488_group[] = {
-	&face_756_2_dial_img_6_25488_0,
-	&face_756_2_dial_img_6_25488_1,
-	&face_756_2_dial_img_6_25488_2,
-	&face_756_2_dial_img_6_25488_3,
-	&face_756_2_dial_img_6_25488_4,
-	&face_756_2_dial_img_6_25488_5,
-	&face_756_2_dial_img_6_25488_6,
-	&face_756_2_dial_img_6_25488_7,
-	&face_756_2_dial_img_6_25488_8,
-	&face_756_2_dial_img_6_25488_9,
+const lv_img_dsc_t *face_756_2_dial_img_6_75640_group[] = {
+	&face_756_2_dial_img_6_75640_0,
+	&face_756_2_dial_img_6_75640_1,
+	&face_756_2_dial_img_6_75640_2,
+	&face_756_2_dial_img_6_75640_3,
+	&face_756_2_dial_img_6_75640_4,
+	&face_756_2_dial_img_6_75640_5,
+	&face_756_2_dial_img_6_75640_6,
+	&face_756_2_dial_img_6_75640_7,
+	&face_756_2_dial_img_6_75640_8,
+	&face_756_2_dial_img_6_75640_9,
 };
-const lv_img_dsc_t *face_756_2_dial_img_8_81874_group[] = {
-	&face_756_2_dial_img_8_81874_0,
-	&face_756_2_dial_img_8_81874_1,
-	&face_756_2_dial_img_8_81874_2,
-	&face_756_2_dial_img_8_81874_3,
-	&face_756_2_dial_img_8_81874_4,
-	&face_756_2_dial_img_8_81874_5,
-	&face_756_2_dial_img_8_81874_6,
-	&face_756_2_dial_img_8_81874_7,
-	&face_756_2_dial_img_8_81874_8,
-	&face_756_2_dial_img_8_81874_9,
+const lv_img_dsc_t *face_756_2_dial_img_8_284946_group[] = {
+	&face_756_2_dial_img_8_284946_0,
+	&face_756_2_dial_img_8_284946_1,
+	&face_756_2_dial_img_8_284946_2,
+	&face_756_2_dial_img_8_284946_3,
+	&face_756_2_dial_img_8_284946_4,
+	&face_756_2_dial_img_8_284946_5,
+	&face_756_2_dial_img_8_284946_6,
+	&face_756_2_dial_img_8_284946_7,
+	&face_756_2_dial_img_8_284946_8,
+	&face_756_2_dial_img_8_284946_9,
 };
-const lv_img_dsc_t *face_756_2_dial_img_10_22752_group[] = {
-	&face_756_2_dial_img_10_22752_0,
-	&face_756_2_dial_img_10_22752_1,
-	&face_756_2_dial_img_10_22752_2,
-	&face_756_2_dial_img_10_22752_3,
-	&face_756_2_dial_img_10_22752_4,
-	&face_756_2_dial_img_10_22752_5,
-	&face_756_2_dial_img_10_22752_6,
-	&face_756_2_dial_img_10_22752_7,
-	&face_756_2_dial_img_10_22752_8,
-	&face_756_2_dial_img_10_22752_9,
+const lv_img_dsc_t *face_756_2_dial_img_10_360030_group[] = {
+	&face_756_2_dial_img_10_360030_0,
+	&face_756_2_dial_img_10_360030_1,
+	&face_756_2_dial_img_10_360030_2,
+	&face_756_2_dial_img_10_360030_3,
+	&face_756_2_dial_img_10_360030_4,
+	&face_756_2_dial_img_10_360030_5,
+	&face_756_2_dial_img_10_360030_6,
+	&face_756_2_dial_img_10_360030_7,
+	&face_756_2_dial_img_10_360030_8,
+	&face_756_2_dial_img_10_360030_9,
 };
-const lv_img_dsc_t *face_756_2_dial_img_17_17160_group[] = {
-	&face_756_2_dial_img_17_17160_0,
-	&face_756_2_dial_img_17_17160_1,
-	&face_756_2_dial_img_17_17160_2,
-	&face_756_2_dial_img_17_17160_3,
-	&face_756_2_dial_img_17_17160_4,
-	&face_756_2_dial_img_17_17160_5,
-	&face_756_2_dial_img_17_17160_6,
-	&face_756_2_dial_img_17_17160_7,
-	&face_756_2_dial_img_17_17160_8,
-	&face_756_2_dial_img_17_17160_9,
+const lv_img_dsc_t *face_756_2_dial_img_17_368896_group[] = {
+	&face_756_2_dial_img_17_368896_0,
+	&face_756_2_dial_img_17_368896_1,
+	&face_756_2_dial_img_17_368896_2,
+	&face_756_2_dial_img_17_368896_3,
+	&face_756_2_dial_img_17_368896_4,
+	&face_756_2_dial_img_17_368896_5,
+	&face_756_2_dial_img_17_368896_6,
+	&face_756_2_dial_img_17_368896_7,
+	&face_756_2_dial_img_17_368896_8,
+	&face_756_2_dial_img_17_368896_9,
 };
-const lv_img_dsc_t *face_756_2_dial_img_19_101998_group[] = {
-	&face_756_2_dial_img_19_101998_0,
-	&face_756_2_dial_img_19_101998_1,
-	&face_756_2_dial_img_19_101998_2,
-	&face_756_2_dial_img_19_101998_3,
-	&face_756_2_dial_img_19_101998_4,
-	&face_756_2_dial_img_19_101998_5,
-	&face_756_2_dial_img_19_101998_6,
+const lv_img_dsc_t *face_756_2_dial_img_19_374600_group[] = {
+	&face_756_2_dial_img_19_374600_0,
+	&face_756_2_dial_img_19_374600_1,
+	&face_756_2_dial_img_19_374600_2,
+	&face_756_2_dial_img_19_374600_3,
+	&face_756_2_dial_img_19_374600_4,
+	&face_756_2_dial_img_19_374600_5,
+	&face_756_2_dial_img_19_374600_6,
 };
-const lv_img_dsc_t *face_756_2_dial_img_20_105728_group[] = {
-	&face_756_2_dial_img_20_105728_0,
-	&face_756_2_dial_img_20_105728_1,
-	&face_756_2_dial_img_20_105728_2,
-	&face_756_2_dial_img_20_105728_3,
-	&face_756_2_dial_img_20_105728_4,
-	&face_756_2_dial_img_20_105728_5,
-	&face_756_2_dial_img_20_105728_6,
+const lv_img_dsc_t *face_756_2_dial_img_20_388522_group[] = {
+	&face_756_2_dial_img_20_388522_0,
+	&face_756_2_dial_img_20_388522_1,
+	&face_756_2_dial_img_20_388522_2,
+	&face_756_2_dial_img_20_388522_3,
+	&face_756_2_dial_img_20_388522_4,
+	&face_756_2_dial_img_20_388522_5,
+	&face_756_2_dial_img_20_388522_6,
 };
 
 
@@ -144,166 +147,167 @@ void init_face_756_2(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_
     lv_image_set_src(face_756_2_0_424, &face_756_2_dial_img_0_424_0);
     lv_obj_set_width(face_756_2_0_424, LV_SIZE_CONTENT);
     lv_obj_set_height(face_756_2_0_424, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_0_424, 14);
-    lv_obj_set_y(face_756_2_0_424, 160);
+    lv_obj_set_x(face_756_2_0_424, FACE_X(237));
+    lv_obj_set_y(face_756_2_0_424, FACE_Y(2725));
     lv_obj_add_flag(face_756_2_0_424, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_756_2_0_424, LV_OBJ_FLAG_SCROLLABLE );
 
-    face_756_2_2_15014 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_2_15014, &face_756_2_dial_img_2_15014_0);
-    lv_obj_set_width(face_756_2_2_15014, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_2_15014, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_2_15014, 115);
-    lv_obj_set_y(face_756_2_2_15014, 17);
-    lv_obj_add_flag(face_756_2_2_15014, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_2_15014, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_3_18734 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_3_18734, &face_756_2_dial_img_3_18734_0);
-    lv_obj_set_width(face_756_2_3_18734, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_3_18734, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_3_18734, 65);
-    lv_obj_set_y(face_756_2_3_18734, 18);
-    lv_obj_add_flag(face_756_2_3_18734, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_3_18734, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_5_22382 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_5_22382, &face_756_2_dial_img_5_22382_0);
-    lv_obj_set_width(face_756_2_5_22382, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_5_22382, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_5_22382, 185);
-    lv_obj_set_y(face_756_2_5_22382, 55);
-    lv_obj_add_flag(face_756_2_5_22382, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_5_22382, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_6_25488 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_6_25488, &face_756_2_dial_img_6_25488_0);
-    lv_obj_set_width(face_756_2_6_25488, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_6_25488, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_6_25488, 76);
-    lv_obj_set_y(face_756_2_6_25488, 60);
-    lv_obj_add_flag(face_756_2_6_25488, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_6_25488, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_7_25488 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_7_25488, &face_756_2_dial_img_6_25488_0);
-    lv_obj_set_width(face_756_2_7_25488, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_7_25488, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_7_25488, 7);
-    lv_obj_set_y(face_756_2_7_25488, 60);
-    lv_obj_add_flag(face_756_2_7_25488, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_7_25488, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_8_81874 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_8_81874, &face_756_2_dial_img_8_81874_0);
-    lv_obj_set_width(face_756_2_8_81874, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_8_81874, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_8_81874, 182);
-    lv_obj_set_y(face_756_2_8_81874, 100);
-    lv_obj_add_flag(face_756_2_8_81874, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_8_81874, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_9_81874 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_9_81874, &face_756_2_dial_img_8_81874_0);
-    lv_obj_set_width(face_756_2_9_81874, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_9_81874, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_9_81874, 141);
-    lv_obj_set_y(face_756_2_9_81874, 100);
-    lv_obj_add_flag(face_756_2_9_81874, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_9_81874, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_10_22752 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_10_22752, &face_756_2_dial_img_10_22752_0);
-    lv_obj_set_width(face_756_2_10_22752, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_10_22752, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_10_22752, 188);
-    lv_obj_set_y(face_756_2_10_22752, 165);
-    lv_obj_add_flag(face_756_2_10_22752, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_10_22752, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_11_22752 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_11_22752, &face_756_2_dial_img_10_22752_0);
-    lv_obj_set_width(face_756_2_11_22752, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_11_22752, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_11_22752, 174);
-    lv_obj_set_y(face_756_2_11_22752, 165);
-    lv_obj_add_flag(face_756_2_11_22752, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_11_22752, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_12_22752 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_12_22752, &face_756_2_dial_img_10_22752_0);
-    lv_obj_set_width(face_756_2_12_22752, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_12_22752, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_12_22752, 160);
-    lv_obj_set_y(face_756_2_12_22752, 165);
-    lv_obj_add_flag(face_756_2_12_22752, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_12_22752, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_13_22752 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_13_22752, &face_756_2_dial_img_10_22752_0);
-    lv_obj_set_width(face_756_2_13_22752, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_13_22752, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_13_22752, 112);
-    lv_obj_set_y(face_756_2_13_22752, 196);
-    lv_obj_add_flag(face_756_2_13_22752, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_13_22752, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_14_22752 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_14_22752, &face_756_2_dial_img_10_22752_0);
-    lv_obj_set_width(face_756_2_14_22752, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_14_22752, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_14_22752, 98);
-    lv_obj_set_y(face_756_2_14_22752, 196);
-    lv_obj_add_flag(face_756_2_14_22752, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_14_22752, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_15_22752 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_15_22752, &face_756_2_dial_img_10_22752_0);
-    lv_obj_set_width(face_756_2_15_22752, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_15_22752, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_15_22752, 84);
-    lv_obj_set_y(face_756_2_15_22752, 196);
-    lv_obj_add_flag(face_756_2_15_22752, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_15_22752, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_16_22752 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_16_22752, &face_756_2_dial_img_10_22752_0);
-    lv_obj_set_width(face_756_2_16_22752, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_16_22752, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_16_22752, 70);
-    lv_obj_set_y(face_756_2_16_22752, 196);
-    lv_obj_add_flag(face_756_2_16_22752, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_16_22752, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_17_17160 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_17_17160, &face_756_2_dial_img_17_17160_0);
-    lv_obj_set_width(face_756_2_17_17160, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_17_17160, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_17_17160, 98);
-    lv_obj_set_y(face_756_2_17_17160, 160);
-    lv_obj_add_flag(face_756_2_17_17160, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_17_17160, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_18_17160 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_18_17160, &face_756_2_dial_img_17_17160_0);
-    lv_obj_set_width(face_756_2_18_17160, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_18_17160, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_18_17160, 87);
-    lv_obj_set_y(face_756_2_18_17160, 160);
-    lv_obj_add_flag(face_756_2_18_17160, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_18_17160, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_20_105728 = lv_image_create(face_756_2);
-    lv_image_set_src(face_756_2_20_105728, &face_756_2_dial_img_20_105728_0);
-    lv_obj_set_width(face_756_2_20_105728, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_20_105728, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_20_105728, 41);
-    lv_obj_set_y(face_756_2_20_105728, 160);
-    lv_obj_add_flag(face_756_2_20_105728, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_756_2_20_105728, LV_OBJ_FLAG_SCROLLABLE );
-
-
-    callback("Red", &face_756_2_dial_img_preview_0, &face_756_2, NULL);
+    face_756_2_2_53268 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_2_53268, &face_756_2_dial_img_2_53268_0);
+    lv_obj_set_width(face_756_2_2_53268, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_2_53268, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_2_53268, FACE_X(1960));
+    lv_obj_set_y(face_756_2_2_53268, FACE_Y(290));
+    lv_obj_add_flag(face_756_2_2_53268, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_2_53268, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_3_60934 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_3_60934, &face_756_2_dial_img_3_60934_0);
+    lv_obj_set_width(face_756_2_3_60934, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_3_60934, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_3_60934, FACE_X(1108));
+    lv_obj_set_y(face_756_2_3_60934, FACE_Y(299));
+    lv_obj_add_flag(face_756_2_3_60934, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_3_60934, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_5_74432 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_5_74432, &face_756_2_dial_img_5_74432_0);
+    lv_obj_set_width(face_756_2_5_74432, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_5_74432, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_5_74432, FACE_X(3156));
+    lv_obj_set_y(face_756_2_5_74432, FACE_Y(932));
+    lv_obj_add_flag(face_756_2_5_74432, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_5_74432, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_6_75640 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_6_75640, &face_756_2_dial_img_6_75640_0);
+    lv_obj_set_width(face_756_2_6_75640, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_6_75640, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_6_75640, FACE_X(1292));
+    lv_obj_set_y(face_756_2_6_75640, FACE_Y(1020));
+    lv_obj_add_flag(face_756_2_6_75640, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_6_75640, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_7_75640 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_7_75640, &face_756_2_dial_img_6_75640_0);
+    lv_obj_set_width(face_756_2_7_75640, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_7_75640, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_7_75640, FACE_X(114));
+    lv_obj_set_y(face_756_2_7_75640, FACE_Y(1020));
+    lv_obj_add_flag(face_756_2_7_75640, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_7_75640, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_8_284946 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_8_284946, &face_756_2_dial_img_8_284946_0);
+    lv_obj_set_width(face_756_2_8_284946, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_8_284946, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_8_284946, FACE_X(3103));
+    lv_obj_set_y(face_756_2_8_284946, FACE_Y(1705));
+    lv_obj_add_flag(face_756_2_8_284946, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_8_284946, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_9_284946 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_9_284946, &face_756_2_dial_img_8_284946_0);
+    lv_obj_set_width(face_756_2_9_284946, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_9_284946, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_9_284946, FACE_X(2400));
+    lv_obj_set_y(face_756_2_9_284946, FACE_Y(1705));
+    lv_obj_add_flag(face_756_2_9_284946, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_9_284946, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_10_360030 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_10_360030, &face_756_2_dial_img_10_360030_0);
+    lv_obj_set_width(face_756_2_10_360030, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_10_360030, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_10_360030, FACE_X(3208));
+    lv_obj_set_y(face_756_2_10_360030, FACE_Y(2813));
+    lv_obj_add_flag(face_756_2_10_360030, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_10_360030, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_11_360030 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_11_360030, &face_756_2_dial_img_10_360030_0);
+    lv_obj_set_width(face_756_2_11_360030, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_11_360030, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_11_360030, FACE_X(2962));
+    lv_obj_set_y(face_756_2_11_360030, FACE_Y(2813));
+    lv_obj_add_flag(face_756_2_11_360030, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_11_360030, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_12_360030 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_12_360030, &face_756_2_dial_img_10_360030_0);
+    lv_obj_set_width(face_756_2_12_360030, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_12_360030, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_12_360030, FACE_X(2725));
+    lv_obj_set_y(face_756_2_12_360030, FACE_Y(2813));
+    lv_obj_add_flag(face_756_2_12_360030, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_12_360030, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_13_360030 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_13_360030, &face_756_2_dial_img_10_360030_0);
+    lv_obj_set_width(face_756_2_13_360030, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_13_360030, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_13_360030, FACE_X(1907));
+    lv_obj_set_y(face_756_2_13_360030, FACE_Y(3340));
+    lv_obj_add_flag(face_756_2_13_360030, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_13_360030, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_14_360030 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_14_360030, &face_756_2_dial_img_10_360030_0);
+    lv_obj_set_width(face_756_2_14_360030, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_14_360030, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_14_360030, FACE_X(1670));
+    lv_obj_set_y(face_756_2_14_360030, FACE_Y(3340));
+    lv_obj_add_flag(face_756_2_14_360030, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_14_360030, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_15_360030 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_15_360030, &face_756_2_dial_img_10_360030_0);
+    lv_obj_set_width(face_756_2_15_360030, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_15_360030, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_15_360030, FACE_X(1433));
+    lv_obj_set_y(face_756_2_15_360030, FACE_Y(3340));
+    lv_obj_add_flag(face_756_2_15_360030, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_15_360030, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_16_360030 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_16_360030, &face_756_2_dial_img_10_360030_0);
+    lv_obj_set_width(face_756_2_16_360030, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_16_360030, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_16_360030, FACE_X(1187));
+    lv_obj_set_y(face_756_2_16_360030, FACE_Y(3340));
+    lv_obj_add_flag(face_756_2_16_360030, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_16_360030, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_17_368896 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_17_368896, &face_756_2_dial_img_17_368896_0);
+    lv_obj_set_width(face_756_2_17_368896, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_17_368896, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_17_368896, FACE_X(1670));
+    lv_obj_set_y(face_756_2_17_368896, FACE_Y(2725));
+    lv_obj_add_flag(face_756_2_17_368896, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_17_368896, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_18_368896 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_18_368896, &face_756_2_dial_img_17_368896_0);
+    lv_obj_set_width(face_756_2_18_368896, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_18_368896, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_18_368896, FACE_X(1477));
+    lv_obj_set_y(face_756_2_18_368896, FACE_Y(2725));
+    lv_obj_add_flag(face_756_2_18_368896, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_18_368896, LV_OBJ_FLAG_SCROLLABLE );
+
+    face_756_2_20_388522 = lv_image_create(face_756_2);
+    lv_image_set_src(face_756_2_20_388522, &face_756_2_dial_img_20_388522_0);
+    lv_obj_set_width(face_756_2_20_388522, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_756_2_20_388522, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_756_2_20_388522, FACE_X(694));
+    lv_obj_set_y(face_756_2_20_388522, FACE_Y(2725));
+    lv_obj_add_flag(face_756_2_20_388522, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_756_2_20_388522, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_756_2_0_424);
+
+
+    callback("Red", NULL, &face_756_2, NULL);
 
 #endif
 }
@@ -317,18 +321,18 @@ void update_time_756_2(int second, int minute, int hour, bool mode, bool am, int
     }
 	if (mode)
 	{
-		lv_obj_add_flag(face_756_2_2_15014, LV_OBJ_FLAG_HIDDEN);
+		lv_obj_add_flag(face_756_2_2_53268, LV_OBJ_FLAG_HIDDEN);
 	} else {
-		lv_obj_remove_flag(face_756_2_2_15014, LV_OBJ_FLAG_HIDDEN);
+		lv_obj_remove_flag(face_756_2_2_53268, LV_OBJ_FLAG_HIDDEN);
 	}
-	lv_image_set_src(face_756_2_2_15014, face_756_2_dial_img_2_15014_group[(am ? 0 : 1) % 2]);
-	lv_image_set_src(face_756_2_6_25488, face_756_2_dial_img_6_25488_group[(hour / 1) % 10]);
-	lv_image_set_src(face_756_2_7_25488, face_756_2_dial_img_6_25488_group[(hour / 10) % 10]);
-	lv_image_set_src(face_756_2_8_81874, face_756_2_dial_img_8_81874_group[(minute / 1) % 10]);
-	lv_image_set_src(face_756_2_9_81874, face_756_2_dial_img_8_81874_group[(minute / 10) % 10]);
-	lv_image_set_src(face_756_2_17_17160, face_756_2_dial_img_17_17160_group[(day / 1) % 10]);
-	lv_image_set_src(face_756_2_18_17160, face_756_2_dial_img_17_17160_group[(day / 10) % 10]);
-	lv_image_set_src(face_756_2_20_105728, face_756_2_dial_img_20_105728_group[((weekday + 6) / 1) % 7]);
+	lv_image_set_src(face_756_2_2_53268, face_756_2_dial_img_2_53268_group[(am ? 0 : 1) % 2]);
+	lv_image_set_src(face_756_2_6_75640, face_756_2_dial_img_6_75640_group[(hour / 1) % 10]);
+	lv_image_set_src(face_756_2_7_75640, face_756_2_dial_img_6_75640_group[(hour / 10) % 10]);
+	lv_image_set_src(face_756_2_8_284946, face_756_2_dial_img_8_284946_group[(minute / 1) % 10]);
+	lv_image_set_src(face_756_2_9_284946, face_756_2_dial_img_8_284946_group[(minute / 10) % 10]);
+	lv_image_set_src(face_756_2_17_368896, face_756_2_dial_img_17_368896_group[(day / 1) % 10]);
+	lv_image_set_src(face_756_2_18_368896, face_756_2_dial_img_17_368896_group[(day / 10) % 10]);
+	lv_image_set_src(face_756_2_20_388522, face_756_2_dial_img_20_388522_group[((weekday + 6) / 1) % 7]);
 
 #endif
 }
@@ -350,8 +354,8 @@ void update_status_756_2(int battery, bool connection){
     {
         return;
     }
-	lv_image_set_src(face_756_2_3_18734, face_756_2_dial_img_3_18734_group[(battery / (100 / 6)) % 6]);
-	lv_image_set_src(face_756_2_5_22382, face_756_2_dial_img_connection[(connection ? 0 : 1) % 2]);
+	lv_image_set_src(face_756_2_3_60934, face_756_2_dial_img_3_60934_group[(battery / (100 / 6)) % 6]);
+	lv_image_set_src(face_756_2_5_74432, face_756_2_dial_img_connection[(connection ? 0 : 1) % 2]);
 
 #endif
 }
@@ -363,10 +367,10 @@ void update_activity_756_2(int steps, int distance, int kcal)
     {
         return;
     }
-	lv_image_set_src(face_756_2_13_22752, face_756_2_dial_img_10_22752_group[(steps / 1) % 10]);
-	lv_image_set_src(face_756_2_14_22752, face_756_2_dial_img_10_22752_group[(steps / 10) % 10]);
-	lv_image_set_src(face_756_2_15_22752, face_756_2_dial_img_10_22752_group[(steps / 100) % 10]);
-	lv_image_set_src(face_756_2_16_22752, face_756_2_dial_img_10_22752_group[(steps / 1000) % 10]);
+	lv_image_set_src(face_756_2_13_360030, face_756_2_dial_img_10_360030_group[(steps / 1) % 10]);
+	lv_image_set_src(face_756_2_14_360030, face_756_2_dial_img_10_360030_group[(steps / 10) % 10]);
+	lv_image_set_src(face_756_2_15_360030, face_756_2_dial_img_10_360030_group[(steps / 100) % 10]);
+	lv_image_set_src(face_756_2_16_360030, face_756_2_dial_img_10_360030_group[(steps / 1000) % 10]);
 
 #endif
 }
@@ -378,9 +382,9 @@ void update_health_756_2(int bpm, int oxygen)
     {
         return;
     }
-	lv_image_set_src(face_756_2_10_22752, face_756_2_dial_img_10_22752_group[(bpm / 1) % 10]);
-	lv_image_set_src(face_756_2_11_22752, face_756_2_dial_img_10_22752_group[(bpm / 10) % 10]);
-	lv_image_set_src(face_756_2_12_22752, face_756_2_dial_img_10_22752_group[(bpm / 100) % 10]);
+	lv_image_set_src(face_756_2_10_360030, face_756_2_dial_img_10_360030_group[(bpm / 1) % 10]);
+	lv_image_set_src(face_756_2_11_360030, face_756_2_dial_img_10_360030_group[(bpm / 10) % 10]);
+	lv_image_set_src(face_756_2_12_360030, face_756_2_dial_img_10_360030_group[(bpm / 100) % 10]);
 
 #endif
 }
@@ -14,100 +14,100 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
+#include "../../common/face_res/face_res.h"
 
 //#define ENABLE_FACE_756_2 // (Red) uncomment to enable or define it elsewhere
 
 #ifdef ENABLE_FACE_756_2
     extern lv_obj_t *face_756_2;
 	extern lv_obj_t *face_756_2_0_424;
-	extern lv_obj_t *face_756_2_2_15014;
-	extern lv_obj_t *face_756_2_3_18734;
-	extern lv_obj_t *face_756_2_5_22382;
-	extern lv_obj_t *face_756_2_6_25488;
-	extern lv_obj_t *face_756_2_7_25488;
-	extern lv_obj_t *face_756_2_8_81874;
-	extern lv_obj_t *face_756_2_9_81874;
-	extern lv_obj_t *face_756_2_10_22752;
-	extern lv_obj_t *face_756_2_11_22752;
-	extern lv_obj_t *face_756_2_12_22752;
-	extern lv_obj_t *face_756_2_13_22752;
-	extern lv_obj_t *face_756_2_14_22752;
-	extern lv_obj_t *face_756_2_15_22752;
-	extern lv_obj_t *face_756_2_16_22752;
-	extern lv_obj_t *face_756_2_17_17160;
-	extern lv_obj_t *face_756_2_18_17160;
-	extern lv_obj_t *face_756_2_20_105728;
+	extern lv_obj_t *face_756_2_2_53268;
+	extern lv_obj_t *face_756_2_3_60934;
+	extern lv_obj_t *face_756_2_5_74432;
+	extern lv_obj_t *face_756_2_6_75640;
+	extern lv_obj_t *face_756_2_7_75640;
+	extern lv_obj_t *face_756_2_8_284946;
+	extern lv_obj_t *face_756_2_9_284946;
+	extern lv_obj_t *face_756_2_10_360030;
+	extern lv_obj_t *face_756_2_11_360030;
+	extern lv_obj_t *face_756_2_12_360030;
+	extern lv_obj_t *face_756_2_13_360030;
+	extern lv_obj_t *face_756_2_14_360030;
+	extern lv_obj_t *face_756_2_15_360030;
+	extern lv_obj_t *face_756_2_16_360030;
+	extern lv_obj_t *face_756_2_17_368896;
+	extern lv_obj_t *face_756_2_18_368896;
+	extern lv_obj_t *face_756_2_20_388522;
 
 
 	LV_IMG_DECLARE(face_756_2_dial_img_0_424_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_1_13004_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_1_13004_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_2_15014_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_2_15014_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_3_18734_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_3_18734_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_3_18734_2);
-	LV_IMG_DECLARE(face_756_2_dial_img_3_18734_3);
-	LV_IMG_DECLARE(face_756_2_dial_img_3_18734_4);
-	LV_IMG_DECLARE(face_756_2_dial_img_3_18734_5);
-	LV_IMG_DECLARE(face_756_2_dial_img_4_22016_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_5_22382_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_2);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_3);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_4);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_5);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_6);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_7);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_8);
-	LV_IMG_DECLARE(face_756_2_dial_img_6_25488_9);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_2);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_3);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_4);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_5);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_6);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_7);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_8);
-	LV_IMG_DECLARE(face_756_2_dial_img_8_81874_9);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_2);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_3);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_4);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_5);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_6);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_7);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_8);
-	LV_IMG_DECLARE(face_756_2_dial_img_10_22752_9);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_2);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_3);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_4);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_5);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_6);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_7);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_8);
-	LV_IMG_DECLARE(face_756_2_dial_img_17_17160_9);
-	LV_IMG_DECLARE(face_756_2_dial_img_19_101998_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_19_101998_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_19_101998_2);
-	LV_IMG_DECLARE(face_756_2_dial_img_19_101998_3);
-	LV_IMG_DECLARE(face_756_2_dial_img_19_101998_4);
-	LV_IMG_DECLARE(face_756_2_dial_img_19_101998_5);
-	LV_IMG_DECLARE(face_756_2_dial_img_19_101998_6);
-	LV_IMG_DECLARE(face_756_2_dial_img_20_105728_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_20_105728_1);
-	LV_IMG_DECLARE(face_756_2_dial_img_20_105728_2);
-	LV_IMG_DECLARE(face_756_2_dial_img_20_105728_3);
-	LV_IMG_DECLARE(face_756_2_dial_img_20_105728_4);
-	LV_IMG_DECLARE(face_756_2_dial_img_20_105728_5);
-	LV_IMG_DECLARE(face_756_2_dial_img_20_105728_6);
-	LV_IMG_DECLARE(face_756_2_dial_img_preview_0);
-	LV_IMG_DECLARE(face_756_2_dial_img_preview_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_1_46130_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_1_46130_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_2_53268_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_2_53268_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_3_60934_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_3_60934_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_3_60934_2);
+	LV_IMG_DECLARE(face_756_2_dial_img_3_60934_3);
+	LV_IMG_DECLARE(face_756_2_dial_img_3_60934_4);
+	LV_IMG_DECLARE(face_756_2_dial_img_3_60934_5);
+	LV_IMG_DECLARE(face_756_2_dial_img_4_73228_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_5_74432_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_2);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_3);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_4);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_5);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_6);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_7);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_8);
+	LV_IMG_DECLARE(face_756_2_dial_img_6_75640_9);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_2);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_3);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_4);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_5);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_6);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_7);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_8);
+	LV_IMG_DECLARE(face_756_2_dial_img_8_284946_9);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_2);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_3);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_4);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_5);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_6);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_7);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_8);
+	LV_IMG_DECLARE(face_756_2_dial_img_10_360030_9);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_2);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_3);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_4);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_5);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_6);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_7);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_8);
+	LV_IMG_DECLARE(face_756_2_dial_img_17_368896_9);
+	LV_IMG_DECLARE(face_756_2_dial_img_19_374600_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_19_374600_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_19_374600_2);
+	LV_IMG_DECLARE(face_756_2_dial_img_19_374600_3);
+	LV_IMG_DECLARE(face_756_2_dial_img_19_374600_4);
+	LV_IMG_DECLARE(face_756_2_dial_img_19_374600_5);
+	LV_IMG_DECLARE(face_756_2_dial_img_19_374600_6);
+	LV_IMG_DECLARE(face_756_2_dial_img_20_388522_0);
+	LV_IMG_DECLARE(face_756_2_dial_img_20_388522_1);
+	LV_IMG_DECLARE(face_756_2_dial_img_20_388522_2);
+	LV_IMG_DECLARE(face_756_2_dial_img_20_388522_3);
+	LV_IMG_DECLARE(face_756_2_dial_img_20_388522_4);
+	LV_IMG_DECLARE(face_756_2_dial_img_20_388522_5);
+	LV_IMG_DECLARE(face_756_2_dial_img_20_388522_6);
 
 
 #endif
@@ -0,0 +1,43 @@
+
+// File generated by bin2lvgl
+// developed by fbiego.
+// https://github.com/fbiego
+// Watchface: 756_2
+
+#include "../../756_2.h"
+#include "../../../../common/asset_bin/asset_bin.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#if defined(ENABLE_FACE_756_2) && FACE_SIDE == 240
+
+
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 240
+ASSET_BIN(face_756_2_dial_img_1_46130_data_0, "face_756_2_dial_img_1_46130_data_0.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_1_46130_0 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 54,
+    .header.h = 18,
+    .data_size = 2916,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_1_46130_data_0};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 240
+ASSET_BIN(face_756_2_dial_img_1_46130_data_1, "face_756_2_dial_img_1_46130_data_1.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_1_46130_1 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 54,
+    .header.h = 18,
+    .data_size = 2916,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_1_46130_data_1};
+
+    
+#endif
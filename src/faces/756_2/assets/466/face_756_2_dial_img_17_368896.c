@@ -0,0 +1,147 @@
+
+// File generated by bin2lvgl
+// developed by fbiego.
+// https://github.com/fbiego
+// Watchface: 756_2
+
+#include "../../756_2.h"
+#include "../../../../common/asset_bin/asset_bin.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#if defined(ENABLE_FACE_756_2) && FACE_SIDE == 466
+
+
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_0, "face_756_2_dial_img_17_368896_data_0.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_0 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_0};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_1, "face_756_2_dial_img_17_368896_data_1.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_1 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_1};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_2, "face_756_2_dial_img_17_368896_data_2.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_2 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_2};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_3, "face_756_2_dial_img_17_368896_data_3.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_3 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_3};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_4, "face_756_2_dial_img_17_368896_data_4.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_4 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_4};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_5, "face_756_2_dial_img_17_368896_data_5.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_5 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_5};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_6, "face_756_2_dial_img_17_368896_data_6.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_6 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_6};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_7, "face_756_2_dial_img_17_368896_data_7.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_7 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_7};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_8, "face_756_2_dial_img_17_368896_data_8.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_8 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_8};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_17_368896_data_9, "face_756_2_dial_img_17_368896_data_9.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_17_368896_9 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 21,
+    .header.h = 27,
+    .data_size = 1701,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_17_368896_data_9};
+
+    
+#endif
@@ -0,0 +1,108 @@
+
+// File generated by bin2lvgl
+// developed by fbiego.
+// https://github.com/fbiego
+// Watchface: 756_2
+
+#include "../../756_2.h"
+#include "../../../../common/asset_bin/asset_bin.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#if defined(ENABLE_FACE_756_2) && FACE_SIDE == 466
+
+
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_19_374600_data_0, "face_756_2_dial_img_19_374600_data_0.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_19_374600_0 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 64,
+    .header.h = 31,
+    .data_size = 5952,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_19_374600_data_0};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_19_374600_data_1, "face_756_2_dial_img_19_374600_data_1.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_19_374600_1 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 64,
+    .header.h = 31,
+    .data_size = 5952,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_19_374600_data_1};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_19_374600_data_2, "face_756_2_dial_img_19_374600_data_2.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_19_374600_2 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 64,
+    .header.h = 31,
+    .data_size = 5952,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_19_374600_data_2};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_19_374600_data_3, "face_756_2_dial_img_19_374600_data_3.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_19_374600_3 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 64,
+    .header.h = 31,
+    .data_size = 5952,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_19_374600_data_3};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_19_374600_data_4, "face_756_2_dial_img_19_374600_data_4.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_19_374600_4 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 64,
+    .header.h = 31,
+    .data_size = 5952,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_19_374600_data_4};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_19_374600_data_5, "face_756_2_dial_img_19_374600_data_5.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_19_374600_5 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 64,
+    .header.h = 31,
+    .data_size = 5952,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_19_374600_data_5};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_19_374600_data_6, "face_756_2_dial_img_19_374600_data_6.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_19_374600_6 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 64,
+    .header.h = 31,
+    .data_size = 5952,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_19_374600_data_6};
+
+    
+#endif
@@ -0,0 +1,108 @@
+
+// File generated by bin2lvgl
+// developed by fbiego.
+// https://github.com/fbiego
+// Watchface: 756_2
+
+#include "../../756_2.h"
+#include "../../../../common/asset_bin/asset_bin.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#if defined(ENABLE_FACE_756_2) && FACE_SIDE == 466
+
+
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_20_388522_data_0, "face_756_2_dial_img_20_388522_data_0.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_20_388522_0 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 79,
+    .header.h = 27,
+    .data_size = 6399,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_20_388522_data_0};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_20_388522_data_1, "face_756_2_dial_img_20_388522_data_1.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_20_388522_1 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 79,
+    .header.h = 27,
+    .data_size = 6399,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_20_388522_data_1};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_20_388522_data_2, "face_756_2_dial_img_20_388522_data_2.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_20_388522_2 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 79,
+    .header.h = 27,
+    .data_size = 6399,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_20_388522_data_2};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_20_388522_data_3, "face_756_2_dial_img_20_388522_data_3.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_20_388522_3 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 79,
+    .header.h = 27,
+    .data_size = 6399,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_20_388522_data_3};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_20_388522_data_4, "face_756_2_dial_img_20_388522_data_4.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_20_388522_4 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 79,
+    .header.h = 27,
+    .data_size = 6399,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_20_388522_data_4};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_20_388522_data_5, "face_756_2_dial_img_20_388522_data_5.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_20_388522_5 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 79,
+    .header.h = 27,
+    .data_size = 6399,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_20_388522_data_5};
+
+    
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_756_2_dial_img_20_388522_data_6, "face_756_2_dial_img_20_388522_data_6.bin");
+
+
+const lv_img_dsc_t face_756_2_dial_img_20_388522_6 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 79,
+    .header.h = 27,
+    .data_size = 6399,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_756_2_dial_img_20_388522_data_6};
+
+    
+#endif
@@ -1,410 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2
-
-#include "../756_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_0_424_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x89,0xE2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xF2,0xCA,0xF2,0xCA,0xF2,0xAA,0xF2,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x07,0xB2,0x07,0xB2,0xE7,0xB1,0xE7,0xA9,0xE7,0xA9,0xE7,0xA1,0xE7,0xA1,
-	0xC6,0x99,0xC6,0x99,0xA6,0x91,0x86,0x91,0x85,0x89,0x65,0x81,0x65,0x79,0x45,0x71,0x24,0x71,0x24,0x69,0x04,0x61,0x03,0x59,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x38,0x82,0x38,0x82,0x30,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0xE2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xF2,0xCA,0xF2,0xAA,0xF2,0xAA,0xF2,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,
-	0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xD2,0x69,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0xE7,0xB1,0xE7,0xA9,0xE7,0xA9,0xE7,0xA1,0xE7,0xA1,0xC6,0x99,0xC6,0x99,0xA6,0x91,0x86,0x91,0x85,0x89,0x65,0x81,0x65,0x79,0x45,0x71,0x24,0x71,0x24,0x69,0x04,0x61,0x03,0x59,
-	0xE3,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x38,0x82,0x38,0x82,0x30,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x48,0xD2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xAA,0xF2,0xAA,0xF2,0xAA,0xF2,0xAA,0xF2,0x89,0xF2,0xAA,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xD2,0x69,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,
-	0xE7,0xB9,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xA9,0xE7,0xA9,0xE7,0xA1,0xC6,0xA1,0xC6,0x99,0xC6,0x99,0xA6,0x91,0x86,0x91,0x85,0x89,0x65,0x81,0x65,0x79,0x45,0x71,0x24,0x71,0x24,0x69,0x04,0x61,0x03,0x59,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x38,0x82,0x38,0x82,0x30,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x79,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xF2,0xAA,0xF2,0xAA,0xF2,
-	0xAA,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xEA,0x89,0xEA,0x69,0xE2,0x89,0xE2,0x69,0xE2,0x48,0xDA,0x48,0xDA,0x69,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB1,0xE7,0xB1,0xE7,0xA9,0xC6,0xA9,0xE7,0xA1,0xC6,0xA1,0xC6,0x99,0xA6,0x99,0xA6,0x91,0x86,0x91,
-	0x85,0x89,0x65,0x81,0x65,0x79,0x45,0x71,0x24,0x71,0x24,0x69,0x04,0x61,0x03,0x59,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x38,0x82,0x38,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xEA,0x89,0xEA,0x69,0xE2,0x69,0xE2,0x69,0xE2,0x48,0xDA,0x48,0xDA,0x48,0xDA,0x48,0xD2,
-	0x48,0xD2,0x48,0xD2,0x48,0xCA,0x28,0xCA,0x28,0xC2,0x07,0xC2,0x07,0xC2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB1,0xE7,0xB1,0xC6,0xA9,0xC6,0xA9,0xC6,0xA1,0xC6,0xA1,0xC6,0x99,0xA6,0x99,0x85,0x91,0x86,0x91,0x65,0x89,0x65,0x81,0x65,0x79,0x24,0x71,0x24,0x71,0x24,0x69,0x03,0x61,0x03,0x59,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x40,
-	0xA2,0x38,0x82,0x38,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xEA,0x89,0xEA,0x69,0xE2,0x69,0xE2,0x69,0xE2,0x48,0xDA,0x48,0xDA,0x48,0xDA,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x28,0xCA,0x28,0xCA,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB1,0xC6,0xB1,
-	0xC6,0xA9,0xC6,0xA9,0xC6,0xA1,0xA6,0xA1,0xA6,0x99,0xA6,0x99,0x85,0x91,0x86,0x91,0x65,0x89,0x65,0x81,0x44,0x79,0x24,0x71,0x24,0x71,0x24,0x69,0x03,0x61,0x03,0x59,0xE3,0x50,0xC3,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x38,0x82,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x79,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x69,0xF2,0x89,0xEA,
-	0x48,0xEA,0x69,0xE2,0x69,0xE2,0x48,0xE2,0x48,0xDA,0x48,0xDA,0x28,0xDA,0x48,0xD2,0x48,0xD2,0x27,0xD2,0x28,0xCA,0x28,0xCA,0x07,0xC2,0x07,0xC2,0xE7,0xC1,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xC6,0xB1,0xC6,0xB1,0xC6,0xA9,0xC6,0xA9,0xC6,0xA1,0xA6,0xA1,0xA6,0x99,0xA6,0x99,0x85,0x91,0x85,0x89,0x65,0x89,0x65,0x81,0x44,0x79,0x24,0x71,
-	0x24,0x71,0x04,0x61,0x03,0x61,0xE3,0x58,0xE3,0x50,0xC3,0x48,0xA2,0x48,0xA2,0x40,0x82,0x38,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x14,0xED,0x5D,0xFF,0xDF,0xFF,0x1C,0xFF,0x14,0xED,0x89,0xFA,0x89,0xFA,0x14,0xED,0x1C,0xFF,0xDF,0xFF,0x5D,0xFF,0x14,0xED,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xEA,0x48,0xEA,0x48,0xE2,0x48,0xE2,0x48,0xDA,0x48,0xE2,0x28,0xDA,0x28,0xDA,0x27,0xD2,0x27,0xD2,0x27,0xD2,0x28,0xCA,0x28,0xCA,
-	0x07,0xC2,0xE7,0xC1,0xE7,0xC1,0xE7,0xB9,0xC6,0xB9,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xA9,0xA6,0xA9,0xC6,0xA1,0xA6,0xA1,0xA6,0x99,0xA6,0x99,0x85,0x91,0x65,0x91,0x65,0x89,0x44,0x81,0x44,0x79,0x24,0x71,0x03,0x69,0x04,0x61,0x03,0x61,0xE3,0x58,0xC2,0x50,0xC3,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x38,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xD2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x89,0xFA,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF5,0xF7,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xF6,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x68,0xF2,0x68,0xF2,0x69,0xF2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x27,0xD2,0x27,0xD2,0x07,0xD2,0xE7,0xC9,0xE7,0xC9,0xE7,0xC1,0xE7,0xC1,0xE7,0xC1,0xC6,0xB9,0xC6,0xB9,0xC6,0xB1,0xC6,0xB1,0xC6,0xA9,0xA6,0xA9,0xA6,0xA9,0x85,0xA1,0xA6,0xA1,
-	0x65,0xA1,0x85,0x91,0x65,0x91,0x65,0x89,0x65,0x89,0x44,0x79,0x44,0x79,0x04,0x71,0x03,0x69,0xE3,0x68,0xE3,0x60,0xE3,0x58,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x40,0x81,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x79,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x14,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xED,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x28,0xEA,0x48,0xE2,0x27,0xE2,0x27,0xE2,
-	0x28,0xDA,0x07,0xDA,0x07,0xDA,0x27,0xD2,0x07,0xD2,0x07,0xD2,0xE7,0xC9,0xE7,0xC9,0xE7,0xC9,0xE7,0xC1,0xC6,0xC1,0xC6,0xB9,0xC6,0xB9,0xC6,0xB1,0xA6,0xB1,0xA6,0xB1,0xA6,0xA9,0xA6,0xA9,0x85,0xA1,0x85,0xA1,0xA6,0x99,0x65,0x99,0x65,0x91,0x44,0x89,0x44,0x89,0x44,0x81,0x24,0x79,0x04,0x71,0x03,0x69,0xE3,0x68,0x03,0x61,0xE3,0x58,
-	0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x40,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x20,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x07,0xDA,0x07,0xDA,0x07,0xDA,0x07,0xD2,0x07,0xD2,0x07,0xD2,0xE7,0xC9,0xE7,0xC9,0xC6,0xC1,0xC6,0xC1,0xC6,0xC1,0xC6,0xB9,
-	0xC6,0xB9,0xA6,0xB9,0xA6,0xB1,0xA6,0xB1,0xA6,0xA9,0xA6,0xA9,0x85,0xA1,0x65,0xA1,0x65,0xA1,0x65,0x99,0x65,0x91,0x44,0x89,0x44,0x81,0x44,0x81,0x24,0x79,0x04,0x71,0x03,0x69,0xE3,0x60,0xE3,0x60,0xE3,0x58,0xC2,0x50,0xA2,0x48,0xA2,0x48,0x82,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xC9,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0x28,0xEA,
-	0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x07,0xEA,0x27,0xE2,0x27,0xE2,0x07,0xDA,0x07,0xDA,0x07,0xDA,0xE7,0xD9,0xC6,0xD1,0x07,0xD2,0xE7,0xC9,0xC6,0xC9,0xC6,0xC9,0xC6,0xC1,0xC6,0xC1,0xA6,0xC1,0xA6,0xB9,0xA6,0xB9,0xA6,0xB9,0xA6,0xB1,0xA6,0xB1,0xA6,0xA9,0x85,0xA1,0x65,0xA1,0x65,0xA1,0x65,0x99,0x65,0x99,0x44,0x91,0x44,0x89,
-	0x44,0x81,0x24,0x81,0x24,0x79,0x04,0x71,0x03,0x69,0xE3,0x68,0xE3,0x60,0xC2,0x58,0xC2,0x50,0xA2,0x48,0xA2,0x48,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x79,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x5D,0xFF,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x28,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xD9,0xE7,0xD9,0xC6,0xD1,0x07,0xD2,
-	0xC6,0xD1,0xC6,0xC9,0xC6,0xC9,0xC6,0xC9,0xC6,0xC1,0xA6,0xC1,0xA6,0xC1,0xA6,0xB9,0xA6,0xB9,0xA6,0xB9,0xA6,0xB1,0x65,0xB1,0x65,0xA9,0x85,0xA1,0x65,0xA1,0x65,0xA1,0x65,0x99,0x65,0x99,0x44,0x91,0x44,0x89,0x24,0x89,0x24,0x81,0x24,0x79,0x04,0x71,0xE3,0x68,0xE3,0x68,0xC2,0x60,0xC2,0x58,0xC2,0x50,0xA2,0x48,0xA2,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0xF7,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF5,0x07,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xD9,0xE7,0xD9,0xE7,0xD9,0xC6,0xD1,0xC6,0xD1,0xC6,0xD1,0xC6,0xC9,0xC6,0xC9,0xA5,0xC9,0xA6,0xC1,0xA6,0xC1,0xA6,0xC1,0xA6,0xB9,0xA6,0xB9,0x65,0xB1,0x65,0xB1,0x65,0xA9,
-	0x65,0xA9,0x65,0xA9,0x65,0xA1,0x65,0xA1,0x44,0x99,0x44,0x99,0x44,0x91,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x79,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xC2,0x60,0xC2,0x58,0xA2,0x50,0xA2,0x48,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xC9,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xCA,0xFA,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xAA,0xFA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE7,0xF1,0x07,0xEA,0x07,0xEA,0xE7,0xE9,0xE7,0xE9,0xE7,0xE9,
-	0xE7,0xE9,0xC6,0xE1,0xC6,0xE1,0xC6,0xD9,0xC6,0xD9,0xC6,0xD9,0xC6,0xD1,0xC6,0xD1,0xA6,0xD1,0xA6,0xD1,0xA5,0xC9,0xA5,0xC9,0x85,0xC1,0x85,0xC1,0xA6,0xC1,0x65,0xB9,0xA6,0xB9,0x65,0xB1,0x65,0xB1,0x65,0xA9,0x65,0xA9,0x65,0xA9,0x44,0xA1,0x44,0xA1,0x44,0x99,0x44,0x99,0x44,0x91,0x24,0x89,0x24,0x81,0x24,0x81,0xE3,0x78,0xE3,0x70,
-	0xC2,0x68,0xE3,0x68,0xC2,0x60,0xC2,0x58,0xA2,0x50,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x6C,0xEB,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x6C,0xEB,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE7,0xF1,0xE7,0xF1,0xE6,0xE9,0xE7,0xE9,0xE7,0xE9,0xE7,0xE9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xD9,0xC6,0xD9,0xC6,0xD9,0xA6,0xD9,0xA6,0xD1,0xA6,0xD1,0xA5,0xC9,0xA5,0xC9,0xA5,0xC9,
-	0x85,0xC1,0x85,0xC1,0x65,0xB9,0x65,0xB9,0x65,0xB1,0x65,0xB1,0x65,0xB1,0x65,0xA9,0x65,0xA9,0x44,0xA1,0x44,0xA1,0x44,0x99,0x44,0x99,0x44,0x99,0x24,0x91,0x24,0x89,0x03,0x81,0x24,0x81,0xE3,0x78,0xE3,0x70,0xE3,0x68,0xC2,0x68,0xC2,0x60,0xA2,0x58,0xA2,0x50,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xCA,0xFA,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xCA,0xF2,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE1,0xC6,0xE1,0xA6,0xE1,0xC6,0xD9,0xC6,0xD9,0xA6,0xD9,0xA6,0xD1,0xA6,0xD1,0xA6,0xD1,0xA5,0xC9,0xA5,0xC9,0x85,0xC1,0x85,0xC1,0x65,0xB9,0x65,0xB9,0x65,0xB9,0x65,0xB1,0x65,0xB1,0x65,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA1,0x44,0xA1,0x44,0xA1,
-	0x44,0x99,0x24,0x99,0x24,0x91,0x24,0x89,0x03,0x81,0xE3,0x80,0xE3,0x78,0xE3,0x70,0xC2,0x68,0xA2,0x60,0xC2,0x60,0xA2,0x58,0x81,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xC9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0x69,0xF2,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x1C,0xFF,0x48,0xF2,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0x85,0xD9,
-	0xA6,0xD9,0xA6,0xD9,0x85,0xD1,0x85,0xD1,0x85,0xD1,0x85,0xD1,0x65,0xC9,0x65,0xC9,0x85,0xC1,0x65,0xB9,0x65,0xB9,0x65,0xB9,0x44,0xB9,0x65,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA1,0x24,0xA1,0x24,0x99,0x24,0x99,0x24,0x99,0x24,0x91,0x03,0x89,0x03,0x81,0xE3,0x80,0xE3,0x78,0xE3,0x70,0xC2,0x68,0xA2,0x60,0xA2,0x60,0xA2,0x58,
-	0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x78,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0x07,0xF2,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xF6,0x07,0xF2,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD1,0x85,0xD1,0x85,0xD1,0x65,0xC9,0x65,0xC9,0x65,0xC9,0x65,0xC9,0x44,0xC1,0x65,0xB9,0x65,0xB9,
-	0x44,0xB9,0x44,0xB9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x24,0xA1,0x24,0xA1,0x24,0xA1,0x24,0x99,0x03,0x99,0x24,0x91,0x03,0x89,0x03,0x81,0xE3,0x80,0xC2,0x78,0xE3,0x70,0xC2,0x68,0xA2,0x60,0xA2,0x58,0x81,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xC6,0xF1,0xF7,0xF5,0xFF,0xFF,0xFF,0xFF,0xF7,0xF5,0xC6,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x65,0xE1,0x85,0xD9,0x85,0xD9,0x64,0xD9,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xC9,0x65,0xC9,0x65,0xC9,0x44,0xC1,0x65,0xB9,0x44,0xC1,0x44,0xB9,0x44,0xB9,0x44,0xB9,0x44,0xA9,0x44,0xA9,0x23,0xA9,0x24,0xA1,0x24,0xA1,0x24,0x99,0x03,0x99,0x03,0x99,0xE3,0x90,0x03,0x89,
-	0xE2,0x80,0xE3,0x80,0xC2,0x78,0xC2,0x70,0xA2,0x68,0xA2,0x60,0xA2,0x60,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xC9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x14,0xED,0x14,0xED,0xA5,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x65,0xE1,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x65,0xD1,0x65,0xD1,
-	0x44,0xC9,0x44,0xC9,0x44,0xC9,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB9,0x44,0xB9,0x44,0xB9,0x23,0xA9,0x23,0xA9,0x23,0xA9,0x24,0xA1,0x24,0xA1,0x03,0xA1,0x24,0x99,0x03,0x99,0x03,0x99,0xE3,0x90,0x03,0x89,0xE2,0x80,0xE3,0x80,0xC2,0x78,0xC2,0x70,0xA2,0x68,0xA2,0x60,0x41,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x78,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x65,0xE1,0x65,0xE1,0x65,0xE1,0x64,0xD9,0x64,0xD9,0x65,0xD1,0x44,0xD1,0x44,0xC9,0x44,0xC9,0x44,0xC9,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB9,0x44,0xB9,0x23,0xA9,0x23,0xA9,0x23,0xA9,
-	0x23,0xA9,0x03,0xA1,0x03,0xA1,0xE3,0x98,0x03,0x99,0x03,0x99,0xE3,0x90,0x03,0x89,0xE2,0x80,0xE2,0x80,0xC2,0x78,0xC2,0x70,0xA2,0x68,0xA2,0x60,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,
-	0x65,0xE1,0x65,0xE1,0x65,0xE1,0x64,0xD9,0x64,0xD9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xC9,0x44,0xC9,0x24,0xC9,0x44,0xC1,0x23,0xC1,0x44,0xC1,0x03,0xB9,0x44,0xB9,0x44,0xB9,0x23,0xA9,0x23,0xA9,0x23,0xA9,0x03,0xA1,0x03,0xA1,0x03,0xA1,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x90,0xC2,0x88,0xE2,0x80,0xC2,0x78,0xC2,0x78,0xA2,0x70,
-	0xA2,0x68,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xC9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xD9,0x44,0xD9,0x44,0xD9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x23,0xC1,
-	0x23,0xC1,0x03,0xB9,0x03,0xB9,0x44,0xB9,0x03,0xB1,0x03,0xB1,0x23,0xA9,0x23,0xA9,0x03,0xA1,0x03,0xA1,0x03,0xA1,0xE3,0x98,0xE3,0x98,0xE3,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x80,0xA2,0x78,0xC2,0x78,0xA2,0x70,0x61,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x78,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xD9,0x44,0xD9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x23,0xC1,0x23,0xC1,0x23,0xC1,0x03,0xB9,0x03,0xB9,0x03,0xB1,0x03,0xB1,0x23,0xA9,0x23,0xA9,0xE3,0xA8,0xE3,0xA8,0x03,0xA1,0xE2,0xA0,0xE3,0x98,
-	0xE3,0x98,0xE3,0x98,0xC2,0x90,0xC2,0x88,0xC2,0x80,0xA2,0x78,0xA2,0x78,0xA2,0x68,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0x44,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x44,0xE9,0x44,0xE9,0x44,0xE9,0x44,0xE1,0x44,0xE1,0x23,0xE1,0x44,0xD9,0x44,0xD9,0x44,0xD9,
-	0x23,0xD9,0x23,0xD9,0x23,0xD9,0x24,0xC9,0x03,0xC9,0x24,0xC9,0x23,0xC1,0x23,0xC1,0x03,0xB9,0x03,0xB9,0x03,0xB9,0x03,0xB1,0x03,0xB1,0x03,0xB1,0x03,0xB1,0xE3,0xA8,0xE3,0xA8,0x03,0xA1,0xE2,0xA0,0xE2,0xA0,0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x80,0xA2,0x78,0xA2,0x78,0x41,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0xD9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xE9,0x44,0xE9,0x44,0xE9,0x44,0xE9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x44,0xD9,0x23,0xD9,0x23,0xD9,0x23,0xD9,0x23,0xD9,0x03,0xC9,0x03,0xC9,0x03,0xC9,0x03,0xC9,0x23,0xC1,0x03,0xB9,0x03,0xB9,0x03,0xB9,0x03,0xB1,
-	0x03,0xB1,0x03,0xB1,0xE3,0xA8,0xE3,0xA8,0xE3,0xA8,0xE2,0xA0,0xE2,0xA0,0xE2,0xA0,0xE3,0x98,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x80,0xA2,0x78,0x81,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x40,0x23,0xD9,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x44,0xE9,
-	0x44,0xE9,0x44,0xE9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x44,0xD9,0x23,0xD9,0x23,0xD9,0x23,0xD9,0x03,0xC9,0x03,0xC9,0x03,0xC9,0x03,0xC9,0x03,0xC9,0x03,0xB9,0x03,0xB9,0x03,0xB9,0x03,0xB9,0x03,0xB1,0x03,0xB1,0x03,0xB1,0xE3,0xA8,0xE3,0xA8,0xE3,0xA8,0xE2,0xA0,0xE2,0xA0,0xE2,0xA0,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x88,
-	0xC2,0x80,0xA2,0x78,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x41,0x20,0x41,0x20,0x61,0x28,0x81,0x28,0x81,0x28,0x82,0x30,0x82,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0x03,0x59,0x04,0x61,0x24,0x69,0x24,0x69,0x24,0x71,0x45,0x71,0x65,0x79,0x65,0x81,0x85,0x89,0x85,0x89,0x86,0x91,0xA6,0x91,
-	0xC6,0x99,0xE7,0xA1,0xE7,0xA1,0xE7,0xA9,0x07,0xB2,0x07,0xB2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xD2,0x69,0xD2,0x69,0xD2,0x69,0xDA,0x89,0xE2,0x89,0xE2,0xAA,0xEA,0xAA,0xEA,0xAA,0xF2,0xCA,0xF2,0xCA,0xF2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xF2,0xE7,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x41,0x20,0x61,0x28,0x81,0x28,0x81,0x28,0x82,0x30,
-	0x82,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0x03,0x59,0x03,0x61,0x24,0x69,0x24,0x69,0x24,0x71,0x45,0x71,0x65,0x79,0x65,0x81,0x65,0x81,0x85,0x89,0x86,0x91,0xA6,0x91,0xC6,0x99,0xC6,0x99,0xE7,0xA1,0xE7,0xA9,0xE7,0xB1,0x07,0xB2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xCA,0x48,0xD2,0x69,0xDA,
-	0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0xAA,0xEA,0xAA,0xF2,0xAA,0xF2,0xAA,0xF2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0x65,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x20,0x61,0x28,0x81,0x28,0x81,0x28,0x82,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0x03,0x59,0x04,0x61,0x04,0x61,0x24,0x69,
-	0x24,0x71,0x45,0x71,0x45,0x71,0x65,0x81,0x65,0x81,0x85,0x89,0x86,0x91,0xA6,0x91,0xA6,0x91,0xC6,0xA1,0xE7,0xA1,0xE7,0xA9,0xE7,0xB1,0x07,0xB2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xCA,0x48,0xD2,0x69,0xD2,0x48,0xDA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xF2,0xAA,0xF2,0xAA,0xF2,0xAA,0xF2,0xAA,0xF2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0x28,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x41,0x20,0x61,0x28,0x81,0x28,0x82,0x30,0x82,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0x03,0x59,0x04,0x61,0x04,0x61,0x24,0x69,0x24,0x71,0x24,0x71,0x65,0x79,0x65,0x79,0x65,0x81,0x85,0x89,0x86,0x91,0xA6,0x91,0xA6,0x99,0xC6,0xA1,0xE7,0xA1,0xE7,0xA9,
-	0xE7,0xB1,0xE7,0xB9,0xE7,0xB9,0x28,0xC2,0x28,0xC2,0x48,0xCA,0x48,0xD2,0x69,0xD2,0x48,0xDA,0x69,0xE2,0x69,0xE2,0x89,0xEA,0x89,0xF2,0x89,0xF2,0xAA,0xF2,0xAA,0xF2,0xAA,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x81,0x28,0x81,0x28,0x82,0x30,0x82,0x38,0x82,0x38,0xA2,0x38,0xA2,0x40,
-	0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0x03,0x59,0x03,0x61,0x04,0x61,0x24,0x69,0x24,0x71,0x24,0x71,0x65,0x79,0x65,0x79,0x65,0x89,0x85,0x89,0x86,0x91,0x85,0x91,0xA6,0x99,0xA6,0xA1,0xC6,0xA1,0xC6,0xA9,0xE7,0xB1,0xE7,0xB9,0xE7,0xB9,0x07,0xC2,0x28,0xC2,0x2C,0xD3,0x9A,0xF6,0xDE,0xFF,0xF7,0xF5,0x89,0xE2,0x89,0xE2,0x89,0xEA,
-	0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x81,0x28,0x82,0x30,0x82,0x30,0x82,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0x03,0x59,0x03,0x61,0x04,0x61,0x24,0x69,0x24,0x71,0x24,0x71,0x44,0x79,0x65,0x79,
-	0x65,0x81,0x65,0x89,0x86,0x91,0x85,0x91,0xA6,0x99,0xA6,0xA1,0xC6,0xA1,0xC6,0xA9,0xC6,0xB1,0xE7,0xB1,0xE7,0xB9,0x07,0xC2,0x07,0xC2,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xED,0x69,0xE2,0x89,0xEA,0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x28,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x81,0x28,0x82,0x30,0x82,0x30,0x82,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x48,0xC3,0x48,0xC2,0x50,0xE3,0x50,0xE3,0x58,0x03,0x61,0x04,0x61,0x03,0x69,0x24,0x71,0x24,0x71,0x44,0x79,0x44,0x79,0x44,0x81,0x65,0x89,0x86,0x91,0x85,0x91,0xA6,0x99,0xA6,0x99,0xC6,0xA1,0xEB,0xC2,0xF7,0xF5,0x9A,0xF6,0x30,0xDC,0x28,0xC2,
-	0x07,0xC2,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF5,0x69,0xE2,0x48,0xEA,0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x82,0x30,0x82,0x30,0x82,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xE3,0x50,
-	0xE3,0x58,0x03,0x61,0x04,0x61,0x03,0x69,0x03,0x69,0x24,0x71,0x44,0x79,0x44,0x79,0x44,0x81,0x65,0x89,0x65,0x91,0x85,0x91,0x85,0x91,0x8D,0xCB,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x14,0xED,0xF7,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0xDC,0x48,0xEA,0x48,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x44,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x82,0x30,0x82,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xE3,0x58,0x03,0x61,0xE3,0x60,0x03,0x69,0x03,0x69,0x04,0x71,0x44,0x79,0x44,0x79,0x44,0x81,0x65,0x89,0x65,0x89,0x65,0x91,
-	0x30,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF5,0xF7,0xF5,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF5,0x14,0xED,0x30,0xDC,0x27,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xEA,0x48,0xEA,0x69,0xF2,0x68,0xF2,0x68,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x27,0xD2,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x20,0x82,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xE3,0x58,0xC2,0x60,0x04,0x61,0xE3,0x68,0x03,0x69,0x04,0x71,0x24,0x79,0x44,0x79,0x44,0x81,0x44,0x89,0x65,0x91,0x85,0x89,0x8D,0xCB,0x1C,0xFF,0x14,0xED,0x69,0xBA,0xC6,0xA9,0xA6,0xB1,0x8D,0xCB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x69,0xD2,
-	0xE7,0xD9,0x28,0xDA,0x27,0xE2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x82,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x28,0xA2,0x38,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xE3,0x58,0xC2,0x60,0xE3,0x60,0xE3,0x68,
-	0x03,0x69,0x04,0x71,0x24,0x79,0x24,0x79,0x44,0x81,0x44,0x89,0x44,0x89,0x65,0x91,0x86,0x91,0x85,0x91,0xA6,0x99,0xA6,0xA1,0xA6,0xB1,0x07,0xB2,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xED,0x07,0xDA,0x07,0xDA,0x27,0xE2,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x44,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x38,0xA2,0x40,0x81,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x58,0xC2,0x60,0xE3,0x60,0xE3,0x68,0x03,0x69,0x04,0x71,0x24,0x79,0x24,0x79,0x44,0x81,0x24,0x89,0x44,0x89,0x44,0x91,0x65,0x99,0x65,0xA1,0x65,0xA1,0xA6,0xA9,
-	0x07,0xB2,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x69,0xDA,0x48,0xDA,0x6C,0xEB,0xAA,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xA2,0x38,
-	0x81,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x58,0xC2,0x60,0xE3,0x60,0xE3,0x68,0x03,0x69,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x81,0x44,0x89,0x44,0x89,0x44,0x91,0x65,0x99,0x65,0xA1,0x65,0xA1,0xC6,0xA9,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0xDF,0xFF,0xFF,0xFF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,
-	0x07,0xEA,0x28,0xEA,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xA2,0x40,0xA2,0x48,0xA2,0x50,0xA2,0x50,0xC2,0x58,0xC2,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x70,0xE3,0x78,0x24,0x81,
-	0x24,0x81,0x24,0x89,0x44,0x89,0x44,0x91,0x44,0x99,0x65,0x99,0x44,0x99,0x14,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xF6,0xE7,0xC9,0x14,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x14,0xED,0xE7,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x44,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x81,0x48,0xA2,0x50,0xA2,0x50,0xC2,0x58,0xC2,0x58,0xA2,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x70,0xE3,0x78,0x24,0x79,0x24,0x81,0x24,0x81,0x24,0x89,0x44,0x91,0x44,0x99,0x44,0x99,0x65,0xA1,0x14,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x28,0xC2,0xA5,0xC9,0xA5,0xC9,0x30,0xDC,0x6C,0xEB,0x89,0xE2,0xC6,0xE1,0xE7,0xE9,0xE7,0xE9,0xE7,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE7,0xE1,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA2,0x48,0xA2,0x50,
-	0xA2,0x58,0xC2,0x60,0xC2,0x60,0xC2,0x68,0xE3,0x68,0xE3,0x70,0xE3,0x78,0xE3,0x78,0x24,0x81,0x03,0x81,0x24,0x91,0x24,0x91,0x44,0x99,0x44,0x99,0x44,0xA1,0x69,0xBA,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0xCB,0xA5,0xC9,0xA6,0xD1,0x85,0xD1,0xA6,0xD1,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xE7,0xE9,0xE7,0xE9,0xE7,0xF1,0xE7,0xF1,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xA2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA2,0x50,0xA2,0x58,0xC2,0x60,0xA2,0x60,0xC2,0x68,0xC2,0x68,0xE3,0x70,0xE3,0x78,0xE3,0x78,0xE3,0x80,0x03,0x81,0x24,0x89,0x24,0x91,
-	0x24,0x99,0x44,0x99,0x44,0xA1,0x44,0xA1,0x07,0xB2,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x28,0xCA,0xA5,0xC9,0xA6,0xD1,0xA6,0xD9,0xA6,0xD9,0xA6,0xE1,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE7,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0x44,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA2,0x50,0xA2,0x58,0xA2,0x60,0xC2,0x68,0xC2,0x68,0xC2,0x70,0xE3,0x78,0xE3,0x80,0xE3,0x80,0x03,0x81,0x03,0x89,0x24,0x91,0x24,0x99,0x24,0x99,0x24,0xA1,0x44,0xA9,0x44,0xA9,0xC6,0xB1,0x9A,0xF6,0xFF,0xFF,0xFF,0xFF,0x9A,0xF6,0x85,0xD1,0x85,0xD1,
-	0xA6,0xD9,0xA6,0xD9,0xA6,0xE1,0xA6,0xE1,0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xE9,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x82,0x50,0xA2,0x60,0xA2,0x60,
-	0xC2,0x68,0xC2,0x70,0xC2,0x78,0xE3,0x78,0xE3,0x80,0x03,0x81,0x03,0x89,0x24,0x91,0x03,0x99,0x24,0x99,0x24,0xA1,0x44,0xA9,0xA6,0xB1,0xEB,0xC2,0x14,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0xDC,0x85,0xD1,0x85,0xD9,0x85,0xD9,0xA6,0xE1,0xA6,0xE1,0xA6,0xE9,0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x82,0x50,0xA2,0x68,0xC2,0x68,0xC2,0x70,0xC2,0x78,0xC2,0x78,0xE2,0x80,0x03,0x81,0x03,0x89,0xE3,0x90,0x03,0x99,0x24,0x99,0x65,0xA9,0xF7,0xF5,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x8D,0xCB,0x64,0xD9,0x85,0xD1,0x85,0xD9,0x85,0xE1,0x85,0xE1,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xA9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x82,0x50,0xA2,0x68,0xC2,0x70,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0x03,0x89,0xE3,0x90,0x03,0x99,0x24,0x99,0x07,0xB2,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x9A,0xF6,0x14,0xED,0x14,0xED,0x14,0xED,0x44,0xC9,0x65,0xD1,0x64,0xD9,0x64,0xD9,0x65,0xE1,0x85,0xE1,
-	0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x48,0xC2,0x70,0xC2,0x78,0xC2,0x78,
-	0xE2,0x80,0xE2,0x80,0x03,0x89,0xE3,0x90,0x03,0x99,0x03,0x99,0x03,0xA1,0x07,0xB2,0x69,0xBA,0x23,0xA9,0x8D,0xCB,0xFF,0xFF,0xFF,0xFF,0x30,0xDC,0x44,0xC9,0x44,0xD1,0x64,0xD9,0x64,0xD9,0x65,0xE1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x40,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0xC2,0x88,0xE3,0x90,0xE3,0x98,0xE3,0x98,0x03,0xA1,0x03,0xA1,0x23,0xA9,0xA6,0xB9,0x5D,0xFF,0xFF,0xFF,
-	0xF7,0xF5,0x44,0xC1,0x44,0xC9,0x44,0xD1,0x44,0xD1,0x64,0xD9,0x65,0xE1,0x65,0xE1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x44,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x38,0xA2,0x78,0xC2,0x80,0xE2,0x80,0xC2,0x88,0xC2,0x90,0xE3,0x90,0xE3,0x98,0x03,0xA1,0x03,0xA1,0x23,0xA9,0x14,0xED,0xFF,0xFF,0x5D,0xFF,0xE7,0xC1,0x24,0xC9,0x24,0xC9,0x44,0xD1,0x44,0xD1,0x44,0xD9,0x44,0xD9,0x44,0xE1,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xE9,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xA2,0x78,0xC2,0x80,0xC2,0x88,0xC2,0x90,
-	0xE3,0x98,0xE3,0x98,0x03,0xA1,0xE3,0xA8,0x69,0xBA,0xFF,0xFF,0xFF,0xFF,0x2C,0xD3,0x23,0xC1,0x23,0xC1,0x24,0xC9,0x44,0xD1,0x44,0xD1,0x44,0xD9,0x44,0xD9,0x44,0xE1,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0xA2,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA2,0x68,0xC2,0x88,0xC2,0x90,0xC2,0x90,0xE3,0x98,0xE2,0xA0,0xE3,0xA8,0xE7,0xB1,0x1C,0xFF,0x14,0xED,0x03,0xB9,0x03,0xB9,0x23,0xC1,0x24,0xC9,0x03,0xC9,
-	0x23,0xD9,0x23,0xD9,0x44,0xD9,0x44,0xE1,0x44,0xE9,0x44,0xE9,0x44,0xE9,0x44,0xE9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x23,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x50,0xC2,0x90,0xC2,0x90,0xE2,0xA0,0xE2,0xA0,0xE3,0xA8,0xE3,0xA8,0xE3,0xA8,0x03,0xB1,0x03,0xB1,0x03,0xB9,0x23,0xC1,0x03,0xC9,0x03,0xC9,0x23,0xD9,0x23,0xD9,0x44,0xD9,0x23,0xE1,0x23,0xE1,0x44,0xE9,0x44,0xE9,0x44,0xE9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x23,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x38,0xC2,0x88,0xE2,0xA0,0xE2,0xA0,0xE3,0xA8,
-	0xE3,0xA8,0x03,0xB1,0x03,0xB1,0x03,0xB9,0x03,0xB9,0x03,0xC9,0x03,0xC9,0x03,0xC9,0x23,0xD9,0x23,0xD9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x44,0xE9,0x44,0xE9,0x44,0xE9,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x03,0xC9,
-	0x61,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_0_424_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 212,
-    .header.h = 57,
-    .data_size = sizeof(face_756_2_dial_img_0_424_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_756_2_dial_img_0_424_data_0};
-
-    
\ No newline at end of file
@@ -1,313 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2
-
-#include "../756_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_0[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x71,0xF4,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xFD,0xF3,0xFC,0xCA,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0xFB,0xFE,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x68,0xF2,0x28,0xE2,0x28,0xE2,0xB2,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xF3,0x07,0xE2,0x27,0xE2,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0x8D,0xEB,0x28,0xEA,0x28,0xEA,
-	0x28,0xEA,0x89,0xF2,0x5C,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0xF2,0x07,0xDA,0x07,0xE2,0x9E,0xFF,0xFF,0xFF,0x99,0xFE,0x07,0xE2,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x28,0xEA,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0x28,0xF2,0x07,0xE2,0x68,0xE2,0xFF,0xFF,0xFF,0xFF,0xD6,0xF5,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x27,0xEA,0x27,0xEA,0x9E,0xFF,0xFF,0xFF,
-	0x99,0xFE,0x27,0xF2,0xE6,0xD9,0x6D,0xEB,0xFF,0xFF,0xFF,0xFF,0xB2,0xF4,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x68,0xEA,0xFF,0xFF,0xFF,0xFF,0x75,0xFD,0x07,0xF2,0xE6,0xD9,0xF3,0xF4,0xFF,0xFF,0xFF,0xFF,0x6D,0xEB,0xE7,0xE9,0x07,0xE2,0xE7,0xE9,0x07,0xEA,0x8D,0xF3,0xFF,0xFF,0xFF,0xFF,0x91,0xF4,0x07,0xF2,0xC6,0xD9,0xB6,0xF5,
-	0xFF,0xFF,0xFF,0xFF,0x28,0xEA,0xE6,0xE1,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0x91,0xF4,0xFF,0xFF,0xFF,0xFF,0x8D,0xF3,0xE7,0xF1,0xC6,0xD9,0x79,0xF6,0xFF,0xFF,0x9E,0xFF,0xC6,0xE1,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0xE6,0xE9,0xB6,0xFD,0xFF,0xFF,0xFF,0xFF,0x48,0xF2,0xE6,0xF1,0xA5,0xD9,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xA6,0xE1,0xC6,0xE1,
-	0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0x79,0xFE,0xFF,0xFF,0x3C,0xFF,0xC6,0xF1,0xC6,0xF1,0x68,0xE2,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xA5,0xE1,0xA5,0xE1,0xA5,0xE9,0xA6,0xE9,0x69,0xEA,0xFF,0xFF,0xFF,0xFF,0x17,0xFE,0xC6,0xF1,0xC6,0xF1,0xCA,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xFE,0x79,0xFE,0x79,0xFE,0x79,0xFE,0x9E,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x0F,0xF4,0xA5,0xE9,0xA5,0xF1,0x85,0xD9,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xFE,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x64,0xD9,0x48,0xE2,0x75,0xF5,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x50,0xF4,0xE6,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_1[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xEA,0xCE,0xEB,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x48,0xE2,
-	0x48,0xEA,0x38,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x68,0xEA,0x68,0xEA,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xEA,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x28,0xEA,0x89,0xEA,0xFF,0xFF,0xFF,0xFF,
-	0xD6,0xFD,0x48,0xEA,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xDA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x8D,0xEB,0xFF,0xFF,0xFF,0xFF,0x14,0xF5,0x28,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0xB2,0xF4,0xFF,0xFF,0xFF,0xFF,0x8D,0xF3,0x27,0xEA,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0xE6,0xD9,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0x07,0xE2,0xD6,0xF5,0xFF,0xFF,0xFF,0xFF,0x68,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0x99,0xFE,0xFF,0xFF,0x9E,0xFF,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,
-	0xC6,0xE1,0xE6,0xE1,0xE6,0xE1,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xE6,0xE9,0xE6,0xE9,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0x89,0xEA,0xFF,0xFF,0xFF,0xFF,0x54,0xF5,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0xCE,0xEB,0xFF,0xFF,
-	0xFF,0xFF,0x0F,0xF4,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xD2,0xF4,0xFF,0xFF,0xFF,0xFF,0x4C,0xEB,0xA6,0xE9,0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0x85,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0xF7,0xFD,0xFF,0xFF,0xFF,0xFF,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,
-	0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x85,0xD9,0x85,0xD9,0x85,0xE1,0x85,0xE1,0xDA,0xFE,0xFF,0xFF,0x3C,0xFF,0x85,0xE9,0x85,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x64,0xD9,0x65,0xE1,0x65,0xE1,0x65,0xE1,0x59,0xFE,0x59,0xFE,0x34,0xF5,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_2[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0xD2,0xF4,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xFD,0x2C,0xF3,0x69,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x48,0xE2,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0xF4,0x68,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x4C,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x48,0xF2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,
-	0x28,0xEA,0x48,0xEA,0x5C,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0xF2,0x07,0xDA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x28,0xEA,0xFB,0xFE,0xFF,0xFF,0x9E,0xFF,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x69,0xEA,0x75,0xFD,0xFF,0xFF,0xFF,0xFF,
-	0x38,0xFE,0x27,0xF2,0xE6,0xD9,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0x07,0xE2,0x48,0xEA,0xEF,0xF3,0xD6,0xF5,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0xF3,0x07,0xF2,0xE6,0xD9,0xE6,0xE1,0xE6,0xE1,0x48,0xE2,0xB6,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x50,0xF4,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,
-	0x48,0xE2,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xFE,0x30,0xF4,0x48,0xF2,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xC6,0xD9,0xC6,0xD9,0xB6,0xF5,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x30,0xF4,0x28,0xEA,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0xA6,0xE1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x89,0xEA,
-	0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xCA,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA5,0xE1,0xA5,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0x85,0xD9,0x8E,0xEB,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x79,0xFE,0x79,0xFE,0x79,0xFE,0x79,0xFE,0x79,0xFE,
-	0x79,0xFE,0xEB,0xF2,0xA5,0xE9,0xA5,0xF1,0x85,0xD9,0xD2,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0xF2,0xA5,0xE9,0xA5,0xF1,0x64,0xD9,0x14,0xF5,0x59,0xF6,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x79,0xFE,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_3[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x0B,0xEB,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x91,0xF4,0xCA,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x0F,0xEC,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xCA,0xF2,0x68,0xF2,0x28,0xE2,0x28,0xE2,0x14,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xFD,0x48,0xF2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,
-	0x28,0xEA,0x38,0xFE,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,0x48,0xF2,0x07,0xDA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x75,0xFD,0xFF,0xFF,0xFF,0xFF,0xD6,0xFD,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xCA,0xEA,0x8D,0xEB,0x8D,0xEB,0x8D,0xEB,0x8D,0xF3,0x50,0xF4,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x50,0xF4,0x27,0xF2,0xE6,0xD9,0xE7,0xE1,0xE7,0xE1,0x38,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xE1,0xE6,0xE1,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xCA,0xF2,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,
-	0xC6,0xE1,0x6D,0xEB,0x6D,0xEB,0x6D,0xEB,0x6D,0xEB,0x91,0xF4,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xF5,0xE7,0xF1,0xE7,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0x30,0xF4,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0xC6,0xE1,
-	0xC6,0xE9,0xC6,0xE9,0x0F,0xF4,0xFF,0xFF,0xFF,0xFF,0xB6,0xFD,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE9,0x27,0xEA,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0xF4,0xC6,0xF1,0xC6,0xF1,0xCA,0xE2,0x79,0xF6,0x79,0xF6,0x79,0xFE,0x79,0xFE,0x79,0xFE,0x79,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9E,0xFF,0x07,0xEA,0xA5,0xE9,0xA5,0xF1,0xD2,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xCA,0xF2,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x50,0xEC,0x59,0xF6,0x59,0xF6,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x95,0xFD,0x48,0xEA,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_4[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xEA,0x68,0xEA,0x68,0xEA,0x68,0xEA,0x30,0xF4,0x34,0xF5,0x34,0xFD,0x34,0xFD,0xCE,0xF3,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x48,0xE2,
-	0x48,0xEA,0x48,0xEA,0x48,0xEA,0x71,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xFC,0x68,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xEA,0x28,0xEA,0x71,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xF3,0x48,0xF2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x28,0xEA,0x50,0xF4,0xFF,0xFF,0xFF,0xFF,
-	0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0xF2,0x48,0xF2,0x07,0xDA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x50,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0xF4,0xFF,0xFF,0xFF,0xFF,0x5C,0xFF,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x50,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0xF4,0xEF,0xF3,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,
-	0x27,0xF2,0x27,0xF2,0xE6,0xD9,0xE7,0xE1,0x50,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0xF4,0x07,0xEA,0x13,0xF5,0xFF,0xFF,0xFF,0xFF,0x13,0xF5,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0x50,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xF5,0xE7,0xE9,0xE7,0xE9,0x17,0xFE,0xFF,0xFF,0xFF,0xFF,0x50,0xF4,0x07,0xF2,0x07,0xF2,0x89,0xE2,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xB6,0xF5,0xE6,0xE1,0xE6,0xE9,0xE6,0xE9,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0x2B,0xF3,0xE7,0xF1,0xE7,0xF1,0x0F,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xF4,0xF3,0xF4,0xF3,0xF4,0xF3,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xF4,0xA9,0xF2,0xE6,0xF1,0xD2,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x27,0xF2,0xC6,0xF1,0x79,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xC6,0xF1,0xC6,0xF1,0x85,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xD2,0xF4,0xFF,0xFF,0xFF,0xFF,
-	0xD3,0xF4,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x85,0xD9,0x85,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE9,0x79,0xFE,0xFF,0xFF,0xFF,0xFF,0x2C,0xF3,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x64,0xD9,0x65,0xE1,0x65,0xE1,0x65,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0xF7,0xFD,0x59,0xFE,0x59,0xFE,0x68,0xEA,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_5[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x0B,0xEB,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xFD,0x34,0xFD,0x34,0xFD,0xCA,0xF2,0x28,0xE2,0x28,0xE2,0x0F,0xEC,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x68,0xF2,0x28,0xE2,0x28,0xE2,0x14,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xFE,0x48,0xF2,0x07,0xE2,0x27,0xE2,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0x8D,0xEB,0x28,0xEA,0x28,0xEA,
-	0x28,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xDA,0x07,0xE2,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0xEA,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0xEB,0x8D,0xEB,0x8D,0xF3,0x8D,0xF3,0x69,0xEA,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0xE6,0xD9,0x6D,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xFF,0xEF,0xF3,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0x91,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0xF2,0x07,0xF2,0xC6,0xD9,0x6D,0xEB,
-	0xF3,0xF4,0xF3,0xF4,0xF3,0xF4,0xF3,0xF4,0xF3,0xF4,0xF3,0xF4,0x54,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0xF3,0xE7,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0xE6,0xE9,0x79,0xFE,0xFF,0xFF,0xFF,0xFF,0x8D,0xF3,0xE6,0xF1,0xA5,0xD9,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0xC6,0xE1,
-	0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0x89,0xF2,0xC6,0xF1,0xA5,0xD9,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE9,0xA6,0xE9,0x71,0xF4,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xC6,0xF1,0xC6,0xF1,0xCA,0xE2,0x79,0xF6,0x79,0xF6,0x79,0xFE,0x79,0xFE,0x79,0xFE,0x79,0xFE,0xDA,0xFE,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xAE,0xF3,0xA5,0xE9,0xA5,0xF1,0xD2,0xEC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0xF5,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x50,0xEC,0x59,0xF6,0x59,0xF6,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x34,0xF5,0xCA,0xEA,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_5};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_6[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0xAA,0xEA,0x71,0xF4,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xFD,0x34,0xFD,0xCE,0xF3,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x0F,0xEC,
-	0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xF3,0x68,0xF2,0x28,0xE2,0x28,0xE2,0x4C,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xF2,0x48,0xF2,0x07,0xE2,0x27,0xE2,0xD6,0xF5,0xFF,0xFF,0xFF,0xFF,0xB2,0xF4,0x28,0xEA,0x28,0xEA,
-	0x28,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xDA,0x07,0xE2,0x9E,0xFF,0xFF,0xFF,0xFB,0xFE,0x07,0xE2,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0xCA,0xE2,0xFF,0xFF,0xFF,0xFF,0x38,0xF6,0xCA,0xEA,0x8D,0xEB,0x8D,0xF3,0x8D,0xF3,0x8D,0xF3,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0xE6,0xD9,0x6D,0xEB,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x2C,0xF3,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xF3,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xFD,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0x17,0xFE,
-	0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xF3,0xF4,0x6D,0xEB,0x30,0xF4,0x17,0xFE,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xE7,0xF1,0xE7,0xF1,0xC6,0xD9,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0x28,0xEA,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0x28,0xEA,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xA6,0xE1,0xC6,0xE1,
-	0xC6,0xE9,0xC6,0xE9,0x4C,0xEB,0xFF,0xFF,0xFF,0xFF,0x54,0xFD,0xC6,0xF1,0xC6,0xF1,0xCA,0xE2,0xFF,0xFF,0xFF,0xFF,0xDA,0xFE,0xA5,0xE1,0xA5,0xE1,0xA5,0xE9,0xA6,0xE9,0xD3,0xF4,0xFF,0xFF,0xFF,0xFF,0x0F,0xF4,0xC6,0xF1,0xC6,0xF1,0x2C,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x79,0xFE,0x79,0xFE,0xDA,0xFE,0xFF,0xFF,0xFF,0xFF,
-	0x9E,0xFF,0x07,0xEA,0xA5,0xE9,0xA5,0xF1,0x85,0xD9,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xF3,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x64,0xD9,0xAA,0xE2,0x59,0xF6,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x8D,0xF3,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_6 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_6),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_6};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_7[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x0B,0xEB,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xFD,0x34,0xFD,0x2C,0xF3,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x34,0xF5,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xF3,0x68,0xF2,0x28,0xE2,0x28,0xE2,0x75,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xF2,0x48,0xF2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,
-	0x71,0xF4,0xFF,0xFF,0xFF,0xFF,0x75,0xFD,0x48,0xF2,0x48,0xF2,0x07,0xDA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xEA,0x2C,0xF3,0x9E,0xFF,0xFF,0xFF,0xFB,0xFE,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x69,0xEA,0xFB,0xFE,0xFF,0xFF,0x9E,0xFF,0x2C,0xF3,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0xE6,0xD9,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0x07,0xE2,0x07,0xEA,0xD6,0xF5,0xFF,0xFF,0xFF,0xFF,0x50,0xF4,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0x30,0xF4,0xFF,0xFF,0xFF,0xFF,0xB6,0xFD,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,
-	0xC6,0xE1,0xE6,0xE1,0x0B,0xEB,0x9E,0xFF,0xFF,0xFF,0x3C,0xFF,0x48,0xEA,0xE6,0xE9,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,0x27,0xE2,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0x0B,0xEB,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0xA6,0xE1,0xA6,0xE1,0xB6,0xF5,0xFF,0xFF,0xFF,0xFF,
-	0x71,0xF4,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xE1,0x0F,0xEC,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xA5,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0x85,0xD9,0xCA,0xE2,0x9E,0xFF,0xFF,0xFF,0x9E,0xFF,0x07,0xEA,0xA5,0xE1,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,
-	0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xE6,0xD9,0xDA,0xFE,0xFF,0xFF,0xFF,0xFF,0x0B,0xEB,0x85,0xE1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x6D,0xEB,0x59,0xF6,0x59,0xF6,0xB2,0xF4,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_7 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_7),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_7};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_8[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x0B,0xEB,0x34,0xF5,0x38,0xFE,0x9A,0xFE,0x9A,0xFE,0x9A,0xFE,0x95,0xFD,0xCE,0xF3,0x69,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x71,0xF4,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0xF4,0x68,0xF2,0x28,0xE2,0x28,0xE2,0xEB,0xE2,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xFE,0x48,0xF2,0x07,0xE2,0x27,0xE2,0xB2,0xF4,0xFF,0xFF,0xFF,0xFF,0xD6,0xF5,0x28,0xEA,0x28,0xEA,
-	0x28,0xEA,0x0F,0xF4,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,0x48,0xF2,0x07,0xDA,0x07,0xE2,0x38,0xF6,0xFF,0xFF,0xFF,0xFF,0xCA,0xEA,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x2C,0xF3,0xFF,0xFF,0xFF,0xFF,0xD6,0xFD,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0x8D,0xEB,0x07,0xEA,0x07,0xEA,0x27,0xEA,0xD6,0xFD,0xFF,0xFF,0xFF,0xFF,
-	0x50,0xF4,0x27,0xF2,0xE6,0xD9,0xE7,0xE1,0xB6,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,0x99,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xE1,0xCE,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2B,0xF3,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0xCE,0xEB,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xF5,0xF3,0xF4,0xF3,0xF4,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xE7,0xF1,0xE7,0xF1,0xC6,0xD9,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0x0B,0xEB,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0x28,0xEA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xF1,0xE6,0xF1,0x07,0xE2,0xFF,0xFF,0xFF,0xFF,0xDA,0xFE,0xA6,0xE1,0xC6,0xE1,
-	0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xC6,0xF1,0xC6,0xF1,0x2C,0xE3,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x07,0xEA,0xA5,0xE1,0xA5,0xE9,0xA6,0xE9,0xB6,0xFD,0xFF,0xFF,0xFF,0xFF,0x17,0xFE,0xC6,0xF1,0xC6,0xF1,0x2C,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x34,0xF5,0xD2,0xF4,0xDA,0xFE,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x0F,0xF4,0xA5,0xE9,0xA5,0xF1,0x85,0xD9,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xFD,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x64,0xD9,0x48,0xE2,0x34,0xF5,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0xF7,0xFD,0xEF,0xF3,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_8 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_8),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_8};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_10_22752_data_9[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x68,0xE2,0x69,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0xCE,0xEB,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xF5,0x34,0xFD,0xF3,0xFC,0xCA,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x75,0xF5,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xFE,0x68,0xF2,0x28,0xE2,0x28,0xE2,0x8E,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0xF2,0x07,0xE2,0x27,0xE2,0x38,0xF6,0xFF,0xFF,0xFF,0xFF,0x75,0xF5,0x89,0xEA,0x28,0xEA,
-	0x28,0xEA,0x34,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x48,0xF2,0x07,0xDA,0x07,0xE2,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x07,0xE2,0x27,0xEA,0x27,0xEA,0x28,0xEA,0xEB,0xF2,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x28,0xF2,0x07,0xE2,0x6D,0xEB,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x27,0xEA,0x50,0xF4,0xFF,0xFF,0xFF,0xFF,
-	0x38,0xFE,0x27,0xF2,0xE6,0xD9,0x6D,0xEB,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xEF,0xF3,0x8D,0xEB,0x8D,0xEB,0x50,0xF4,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0xF5,0x07,0xF2,0xE6,0xD9,0x0B,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0xF3,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,
-	0x79,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xF2,0xE7,0xF1,0xC6,0xD9,0xC6,0xD9,0x27,0xE2,0x4C,0xEB,0x4C,0xEB,0x4C,0xEB,0x4C,0xEB,0x6D,0xEB,0x0B,0xEB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0xA6,0xE1,0xC6,0xE1,
-	0xC6,0xE9,0xC6,0xE9,0xEB,0xF2,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE1,0xA5,0xE9,0xA6,0xE9,0xD3,0xF4,0xFF,0xFF,0xFF,0xFF,0xF3,0xFC,0xC6,0xF1,0xC6,0xF1,0x85,0xD9,0x0F,0xEC,0x79,0xF6,0x79,0xFE,0x79,0xFE,0x79,0xFE,0x79,0xFE,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9E,0xFF,0x07,0xEA,0xA5,0xE9,0xA5,0xF1,0x85,0xD9,0x59,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xCA,0xF2,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0x64,0xD9,0x75,0xF5,0x59,0xF6,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x59,0xFE,0x95,0xFD,0xEF,0xF3,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xF1,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_10_22752_9 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 14,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_10_22752_data_9),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_10_22752_data_9};
-
-    
\ No newline at end of file
@@ -1,321 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2
-
-#include "../756_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_19_101998_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB1,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0xE3,0x58,0x65,0x81,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x28,0xCA,0xC7,0xB1,0xA6,0xA1,0x20,0x08,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0xC7,0xB1,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0x07,0xC2,0xC7,0xB1,0x65,0x81,0xA2,0x38,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0xA2,0x38,0xA2,0x38,0x07,0xC2,0x69,0xEA,0xC3,0x48,0xA2,0x38,0x61,0x28,0x04,0x69,0x69,0xEA,0x44,0x71,0x00,0x00,0x20,0x08,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,
-	0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xEA,0x07,0xC2,0x85,0x91,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x85,0x91,0x69,0xEA,0xA2,0x38,0x00,0x00,0x44,0x71,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x85,0x91,0x61,0x28,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x41,0x18,0xC7,0xB1,0x69,0xEA,0x41,0x18,0x00,0x00,0x04,0x69,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,
-	0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x20,0x08,0x00,0x00,0x00,0x00,0x65,0x81,0x69,0xEA,0xE3,0x58,0xE3,0x58,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x65,0x81,0x00,0x00,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0x65,0x81,0x69,0xEA,0x65,0x81,0x44,0x71,0x85,0x91,0x69,0xEA,0x65,0x81,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x04,0x69,0xC3,0x48,0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xE3,0x58,0x00,0x00,0x48,0xDA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x44,0x71,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x07,0xC2,0x00,0x00,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x44,0x71,0x44,0x71,0x44,0x71,0x48,0xDA,0xA2,0x38,0x07,0xC2,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xA2,0x38,0x00,0x00,0x20,0x08,0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_19_101998_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 33,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_19_101998_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_19_101998_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_19_101998_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,
-	0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB1,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0xE3,0x58,0x65,0x81,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x28,0xCA,0xC7,0xB1,0xA6,0xA1,0x20,0x08,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,
-	0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0xC7,0xB1,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0x07,0xC2,0xC7,0xB1,0x65,0x81,0xA2,0x38,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0xA2,0x38,0xA2,0x38,0x07,0xC2,0x69,0xEA,0xC3,0x48,0xA2,0x38,0x61,0x28,0x04,0x69,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xEA,0x07,0xC2,0x85,0x91,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x85,0x91,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x85,0x91,0x61,0x28,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x41,0x18,0xC7,0xB1,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x81,0x69,0xEA,0xE3,0x58,0xE3,0x58,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x65,0x81,0x00,0x00,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0x65,0x81,0x69,0xEA,0x65,0x81,0x44,0x71,0x85,0x91,0x69,0xEA,0x65,0x81,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x04,0x69,0xC3,0x48,0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,
-	0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x20,0x08,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xE3,0x58,0x00,0x00,0x48,0xDA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x44,0x71,0x69,0xEA,0x04,0x69,0x00,0x00,0x20,0x08,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x41,0x18,0x00,0x00,0xA2,0x38,0x69,0xEA,0x07,0xC2,0x00,0x00,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x44,0x71,0x44,0x71,0x44,0x71,0x48,0xDA,0xA2,0x38,0x07,0xC2,0x69,0xEA,0x61,0x28,0x00,0x00,0xA2,0x38,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xA2,0x38,0x00,0x00,0x20,0x08,0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_19_101998_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 33,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_19_101998_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_19_101998_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_19_101998_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB1,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0xA6,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0xE3,0x58,0x65,0x81,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x28,0xCA,0xC7,0xB1,0xA6,0xA1,0x20,0x08,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0xC7,0xB1,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0x07,0xC2,0xC7,0xB1,0x65,0x81,0xA2,0x38,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0xA2,0x38,0xA2,0x38,0x07,0xC2,0x69,0xEA,0xC3,0x48,0xA2,0x38,0x61,0x28,0x04,0x69,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xEA,0x07,0xC2,0x85,0x91,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x85,0x91,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x85,0x91,0x61,0x28,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x41,0x18,0xC7,0xB1,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x81,0x69,0xEA,0xE3,0x58,0xE3,0x58,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x65,0x81,0x00,0x00,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0x65,0x81,0x69,0xEA,0x65,0x81,0x44,0x71,0x85,0x91,0x69,0xEA,0x65,0x81,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x04,0x69,0xC3,0x48,0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xE3,0x58,0x00,0x00,0x48,0xDA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x44,0x71,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0x44,0x71,0x44,0x71,0x44,0x71,
-	0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0xE3,0x58,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x07,0xC2,0x00,0x00,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x44,0x71,0x44,0x71,0x44,0x71,0x48,0xDA,0xA2,0x38,0x07,0xC2,0x69,0xEA,0x61,0x28,0x00,0x00,0x41,0x18,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xA2,0x38,0x00,0x00,0x20,0x08,0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x41,0x18,0x44,0x71,
-	0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_19_101998_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 33,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_19_101998_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_19_101998_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_19_101998_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x61,0x28,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,
-	0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB1,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x00,0x00,0x00,0x00,0x41,0x18,0x69,0xEA,0x48,0xDA,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x48,0xDA,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0xC7,0xB1,
-	0xC7,0xB1,0x48,0xDA,0x69,0xEA,0xC3,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0xE3,0x58,0x65,0x81,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x28,0xCA,0xC7,0xB1,0xA6,0xA1,0x20,0x08,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x85,0x91,0x00,0x00,0xC3,0x48,0x69,0xEA,0x65,0x81,0x00,0x00,0x28,0xCA,0x48,0xDA,
-	0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0xC7,0xB1,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0x07,0xC2,0xC7,0xB1,0x65,0x81,0xA2,0x38,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0x04,0x69,0x00,0x00,0x44,0x71,0x69,0xEA,0xC3,0x48,0x00,0x00,0x69,0xEA,
-	0xC7,0xB1,0x00,0x00,0x00,0x00,0x69,0xEA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0xA2,0x38,0xA2,0x38,0x07,0xC2,0x69,0xEA,0xC3,0x48,0xA2,0x38,0x61,0x28,0x04,0x69,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0x00,0x00,0x07,0xC2,0x69,0xEA,0x20,0x08,0xA2,0x38,
-	0x69,0xEA,0x65,0x81,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xEA,0x07,0xC2,0x85,0x91,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x85,0x91,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x07,0xC2,0x69,0xEA,0x20,0x08,0x41,0x18,0x69,0xEA,0xA6,0xA1,0x00,0x00,
-	0xE3,0x58,0x69,0xEA,0xE3,0x58,0x00,0x00,0x04,0x69,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x85,0x91,0x61,0x28,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x41,0x18,0xC7,0xB1,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x69,0xEA,0x48,0xDA,0x20,0x08,0x07,0xC2,0x69,0xEA,0xA2,0x38,
-	0x00,0x00,0x44,0x71,0x69,0xEA,0x44,0x71,0xA2,0x38,0xA6,0xA1,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x81,0x69,0xEA,0xE3,0x58,0xE3,0x58,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x65,0x81,0x00,0x00,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x28,0xCA,0x07,0xC2,0x69,0xEA,0x85,0x91,
-	0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0x65,0x81,0x69,0xEA,0x65,0x81,0x44,0x71,0x85,0x91,0x69,0xEA,0x65,0x81,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0xE3,0x58,0x69,0xEA,0x44,0x71,0xC7,0xB1,0x65,0x81,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0x69,0xEA,0x69,0xEA,0x20,0x08,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x04,0x69,0xC3,0x48,0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0xE3,0x58,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xE3,0x58,0x00,0x00,0x48,0xDA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x44,0x71,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x07,0xC2,0x00,0x00,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x44,0x71,0x44,0x71,0x44,0x71,0x48,0xDA,0xA2,0x38,0x07,0xC2,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,
-	0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x28,0xCA,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xA2,0x38,0x00,0x00,0x20,0x08,0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,
-	0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0xC7,0xB1,0xC3,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_19_101998_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 33,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_19_101998_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_19_101998_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_19_101998_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB1,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x58,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x48,0xDA,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,
-	0xC7,0xB1,0xC7,0xB1,0x65,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0xE3,0x58,0x65,0x81,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x28,0xCA,0xC7,0xB1,0xA6,0xA1,0x20,0x08,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x81,0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0xC7,0xB1,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0x07,0xC2,0xC7,0xB1,0x65,0x81,0xA2,0x38,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0xA2,0x38,0xA2,0x38,0x07,0xC2,0x69,0xEA,0xC3,0x48,0xA2,0x38,0x61,0x28,0x04,0x69,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x44,0x71,0x44,0x71,0x65,0x81,0x69,0xEA,0x69,0xEA,0x44,0x71,
-	0x44,0x71,0x44,0x71,0x44,0x71,0xC3,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xEA,0x07,0xC2,0x85,0x91,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x85,0x91,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x58,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x85,0x91,0x61,0x28,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x41,0x18,0xC7,0xB1,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x44,0x71,0x44,0x71,0x69,0xEA,0x69,0xEA,
-	0x65,0x81,0x44,0x71,0x44,0x71,0x48,0xDA,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x81,0x69,0xEA,0xE3,0x58,0xE3,0x58,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x65,0x81,0x00,0x00,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,
-	0x28,0xCA,0x00,0x00,0x00,0x00,0x20,0x08,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0x65,0x81,0x69,0xEA,0x65,0x81,0x44,0x71,0x85,0x91,0x69,0xEA,0x65,0x81,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x81,
-	0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,0xE3,0x58,0x69,0xEA,0xA6,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x04,0x69,0xC3,0x48,0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x48,0xDA,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x85,0x91,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xE3,0x58,0x00,0x00,0x48,0xDA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x44,0x71,0x69,0xEA,0x04,0x69,0x00,0x00,0x20,0x08,0xA2,0x38,0xA2,0x38,0xA2,0x38,
-	0x04,0x69,0x69,0xEA,0x28,0xCA,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x28,0xCA,0x69,0xEA,0xE3,0x58,0xA2,0x38,0xA2,0x38,0x20,0x08,0x00,0x00,0xA2,0x38,0x69,0xEA,0x07,0xC2,0x00,0x00,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x44,0x71,0x44,0x71,0x44,0x71,0x48,0xDA,0xA2,0x38,0x07,0xC2,0x69,0xEA,0x61,0x28,0x00,0x00,0xA2,0x38,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xA2,0x38,0x00,0x00,0x20,0x08,0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0xC3,0x48,0xC7,0xB1,
-	0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_19_101998_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 33,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_19_101998_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_19_101998_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_19_101998_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x58,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB1,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x69,0xEA,0x48,0xDA,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0xE3,0x58,0x65,0x81,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x28,0xCA,0xC7,0xB1,0xA6,0xA1,0x20,0x08,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0xE3,0x58,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x07,0xC2,0x44,0x71,0x44,0x71,
-	0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0xC3,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0xC7,0xB1,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0x07,0xC2,0xC7,0xB1,0x65,0x81,0xA2,0x38,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0xA2,0x38,0xA2,0x38,0x07,0xC2,0x69,0xEA,0xC3,0x48,0xA2,0x38,0x61,0x28,0x04,0x69,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,
-	0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xEA,0x07,0xC2,0x85,0x91,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x85,0x91,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x85,0x91,0x61,0x28,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x41,0x18,0xC7,0xB1,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x28,0xCA,0x28,0xCA,0xA2,0x38,
-	0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x81,0x69,0xEA,0xE3,0x58,0xE3,0x58,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x65,0x81,0x00,0x00,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x91,0x69,0xEA,0x07,0xC2,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0x65,0x81,0x69,0xEA,0x65,0x81,0x44,0x71,0x85,0x91,0x69,0xEA,0x65,0x81,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x58,0x69,0xEA,0x48,0xDA,
-	0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x04,0x69,0xC3,0x48,0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,
-	0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xE3,0x58,0x00,0x00,0x48,0xDA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x44,0x71,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0x61,0x28,0x48,0xDA,0x69,0xEA,
-	0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x58,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x07,0xC2,0x00,0x00,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x44,0x71,0x44,0x71,0x44,0x71,0x48,0xDA,0xA2,0x38,0x07,0xC2,0x69,0xEA,0x61,0x28,0x00,0x00,0x61,0x28,0x48,0xDA,0x69,0xEA,
-	0xA6,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0xA6,0xA1,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xA2,0x38,0x00,0x00,0x20,0x08,0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x41,0x18,0x07,0xC2,
-	0x07,0xC2,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0xC7,0xB1,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_19_101998_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 33,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_19_101998_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_19_101998_data_5};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_19_101998_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,
-	0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB1,0xE3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,
-	0x28,0xCA,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0xE3,0x58,0x65,0x81,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x28,0xCA,0xC7,0xB1,0xA6,0xA1,0x20,0x08,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x69,0xEA,0x28,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x69,0xEA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xA2,0x38,0xC7,0xB1,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0x07,0xC2,0xC7,0xB1,0x65,0x81,0xA2,0x38,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x38,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0xA2,0x38,0xA2,0x38,0x07,0xC2,0x69,0xEA,0xC3,0x48,0xA2,0x38,0x61,0x28,0x04,0x69,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,0x85,0x91,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,
-	0xA2,0x38,0xA2,0x38,0x44,0x71,0x69,0xEA,0xA6,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xEA,0x07,0xC2,0x85,0x91,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xC7,0xB1,0x85,0x91,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x91,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x44,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x85,0x91,0x61,0x28,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x41,0x18,0xC7,0xB1,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB1,0x69,0xEA,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,
-	0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x48,0xDA,0x69,0xEA,0xC3,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x81,0x69,0xEA,0xE3,0x58,0xE3,0x58,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x65,0x81,0x00,0x00,0x69,0xEA,0x48,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xEA,0x69,0xEA,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xDA,0x69,0xEA,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x41,0x18,0x65,0x81,0x69,0xEA,0x65,0x81,0x44,0x71,0x85,0x91,0x69,0xEA,0x65,0x81,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x69,0xEA,0x07,0xC2,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x69,0xEA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0xC7,0xB1,0x69,0xEA,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x04,0x69,0xC3,0x48,0x69,0xEA,0x65,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0x69,0xEA,0x85,0x91,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0xC7,0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0x69,0xEA,0xE3,0x58,0x00,0x00,0x48,0xDA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xA2,0x38,0x44,0x71,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x71,0x69,0xEA,
-	0x28,0xCA,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0xC7,0xB1,0x07,0xC2,0x69,0xEA,0x85,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0x69,0xEA,0x07,0xC2,0x00,0x00,0x41,0x18,0x69,0xEA,0xC7,0xB1,0x44,0x71,0x44,0x71,0x44,0x71,0x48,0xDA,0xA2,0x38,0x07,0xC2,0x69,0xEA,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,
-	0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xA2,0x38,0x00,0x00,0x20,0x08,0xA2,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x28,0xCA,0x69,0xEA,0xC3,0x48,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x07,0xC2,0x69,0xEA,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x38,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x38,0xA2,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x38,0xA2,0x38,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_19_101998_6 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 33,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_19_101998_data_6),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_19_101998_data_6};
-
-    
\ No newline at end of file
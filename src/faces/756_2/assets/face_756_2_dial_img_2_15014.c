@@ -1,149 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2
-
-#include "../756_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_2_15014_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x99,0x81,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0x82,0xFA,0x42,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xB9,0x82,0xFA,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x82,0xFA,0xE2,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x42,0xDA,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFB,0xDE,0xF3,0x9C,0x82,0x10,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA0,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x89,0x82,0xFA,0xC2,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xCA,0x41,0x79,0x00,0x00,0x08,0x42,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x08,0x42,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x79,0xCE,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xCA,0x62,0xEA,0x82,0xFA,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x41,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xEA,0x82,0xFA,0x41,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,
-	0x82,0xFA,0x40,0x18,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x04,0x21,0x79,0xCE,0xFF,0xFF,0x04,0x21,0x08,0x42,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x82,0xFA,0x41,0x79,0x82,0xFA,
-	0xA0,0x38,0x00,0x00,0x00,0x00,0x60,0x28,0x82,0xFA,0x82,0xFA,0x81,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x82,0xFA,0x82,0xFA,0x41,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x89,0x02,0xCA,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x08,0x42,
-	0x8E,0x73,0xFF,0xFF,0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x89,0x62,0xEA,0x00,0x00,0x82,0xFA,0x41,0x79,0x00,0x00,0x00,0x00,0xA0,0x38,0x82,0xFA,0x62,0xEA,0xE2,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xB9,
-	0x62,0xEA,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xDA,0xE1,0x58,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x08,0x42,0x10,0x84,0xFF,0xFF,0x7D,0xEF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x7D,0xEF,0x7D,0xEF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xEA,0x81,0x99,0x00,0x00,0x62,0xEA,0x61,0x89,0x00,0x00,0x00,0x00,0x21,0x69,0x82,0xFA,0x81,0x99,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x82,0xFA,0x61,0x89,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x82,0xFA,0x20,0x10,0x00,0x00,0x00,0x00,0x75,0xAD,
-	0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0x00,0x00,0x75,0xAD,0xFB,0xDE,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x71,0x8C,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x82,0xFA,0x60,0x28,0x00,0x00,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x00,0x00,0x41,0x79,
-	0x82,0xFA,0xC0,0x48,0x82,0xFA,0x60,0x28,0x00,0x00,0x00,0x00,0x81,0x99,0x42,0xDA,0x41,0x79,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x99,0x81,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x7D,0xEF,0x75,0xAD,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x71,0x8C,0x7D,0xEF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0xF3,0x9C,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0xA9,0x42,0xDA,0x00,0x00,0x00,0x00,0xC2,0xA9,0x42,0xDA,0x00,0x00,0x00,0x00,0x81,0x99,0x42,0xDA,0x60,0x28,0x82,0xFA,0xC0,0x48,0x00,0x00,0x20,0x10,0x62,0xEA,0x41,0x79,0x41,0x79,0x82,0xFA,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0x62,0xEA,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xDE,0x7D,0xEF,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x00,0x00,0xFB,0xDE,0xF3,0x9C,0x8E,0x73,0xFF,0xFF,0x82,0x10,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x82,0xFA,
-	0x21,0x69,0x00,0x00,0x00,0x00,0x41,0x79,0x82,0xFA,0x00,0x00,0x00,0x00,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x82,0xFA,0x41,0x79,0x00,0x00,0xE1,0x58,0x82,0xFA,0x20,0x10,0xE2,0xB9,0x02,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x42,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7D,0xEF,0x0C,0x63,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0xF3,0x9C,0x79,0xCE,0x00,0x00,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x69,0x82,0xFA,0x02,0xCA,0xE2,0xB9,0xE2,0xB9,0x42,0xDA,0x82,0xFA,0x60,0x28,0x00,0x00,0x42,0xDA,0xC2,0xA9,0x00,0x00,0x02,0xCA,0xC2,0xA9,
-	0x00,0x00,0x02,0xCA,0x81,0x99,0x00,0x00,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xB9,0x61,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x71,0x8C,0x08,0x42,0x08,0x42,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x8E,0x73,0x82,0x10,0xFF,0xFF,0x8E,0x73,0x82,0x10,0xFF,0xFF,0x0C,0x63,
-	0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xCA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA0,0x38,0x00,0x00,0x82,0xFA,0x41,0x79,0x00,0x00,0x81,0x99,0x02,0xCA,0x60,0x28,0x82,0xFA,0xA0,0x38,0x00,0x00,0x82,0xFA,0x61,0x89,0x00,0x00,0x00,0x00,0x40,0x18,0x82,0xFA,0x40,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0xFB,0xDE,0x71,0x8C,0x8E,0x73,0x7D,0xEF,0x82,0x10,0x08,0x42,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x60,0x28,0x82,0xFA,0x41,0x79,0xA0,0x38,0xA0,0x38,0xA0,0x38,0xE1,0x58,
-	0x82,0xFA,0x41,0x79,0x20,0x10,0x82,0xFA,0x21,0x69,0x00,0x00,0x41,0x79,0x82,0xFA,0x81,0x99,0x42,0xDA,0x00,0x00,0x00,0x00,0x82,0xFA,0x41,0x79,0x00,0x00,0x00,0x00,0x41,0x79,0x02,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,
-	0xFF,0xFF,0x86,0x31,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0xFB,0xDE,0xF3,0x9C,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x61,0x89,0x82,0xFA,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x41,0x79,0xA0,0x38,0x82,0xFA,0xA0,0x38,0x00,0x00,0xA0,0x38,0x82,0xFA,0x82,0xFA,0x21,0x69,0x00,0x00,0x60,0x28,
-	0x82,0xFA,0xE1,0x58,0x00,0x00,0x00,0x00,0x42,0xDA,0xE1,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0xFF,0xFF,0x86,0x31,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x62,0xEA,0x81,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0xEA,0xE2,0xB9,0xC0,0x48,0x82,0xFA,0xA0,0x38,0x00,0x00,0x40,0x18,0x82,0xFA,0x82,0xFA,0x20,0x10,0x00,0x00,0xA0,0x38,0x82,0xFA,0xA0,0x38,0x00,0x00,0xA0,0x38,0x82,0xFA,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x79,0xCE,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x00,0x00,0xC0,0x48,0x82,0xFA,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xB9,0x02,0xCA,0x41,0x79,0x82,0xFA,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x81,0x99,0x00,0x00,0x00,0x00,0x21,0x69,0x82,0xFA,0x40,0x18,0x00,0x00,0x81,0x99,0x81,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x08,0x42,
-	0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x75,0xAD,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x62,0xEA,
-	0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x62,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,
-	0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_2_15014_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 52,
-    .header.h = 20,
-    .data_size = sizeof(face_756_2_dial_img_2_15014_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_2_15014_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_2_15014_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x99,0x81,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xFF,0xFF,0xFB,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0xFF,0xFF,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x42,0xDA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x42,0xDA,0x81,0x99,0x20,0x10,0x00,0x00,0x00,0x00,0x82,0xFA,0x42,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x82,0xFA,0x41,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xCA,0x41,0x79,0x00,0x00,0xA0,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xE2,0xB9,0x00,0x00,0xA0,0x38,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x02,0xCA,0x82,0xFA,0x21,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0x7D,0xEF,0xFF,0xFF,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,
-	0x82,0xFA,0x40,0x18,0x00,0x00,0xA0,0x38,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x40,0x18,0x02,0xCA,0x82,0xFA,0x40,0x18,0xA0,0x38,0x82,0xFA,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x82,0xFA,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0x10,0x84,0xFF,0xFF,
-	0x08,0x42,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x89,0x02,0xCA,0x00,0x00,0x00,0x00,0x21,0x69,0x82,0xFA,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x82,0xFA,0xA0,0x38,
-	0x21,0x69,0x82,0xFA,0x82,0xFA,0xE1,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x99,0x82,0xFA,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0x7D,0xEF,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x08,0x42,0xFF,0xFF,0x7D,0xEF,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,
-	0x7D,0xEF,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xDA,0xE1,0x58,0x00,0x00,0x00,0x00,0x41,0x79,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x82,0xFA,0xA0,0x38,0x41,0x79,0x82,0xFA,0x62,0xEA,0x41,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x62,0xEA,0x62,0xEA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0xF3,0x9C,0x00,0x00,0x7D,0xEF,0x71,0x8C,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0xF3,0x9C,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xFF,0xFF,0x71,0x8C,0xFF,0xFF,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x82,0xFA,0x20,0x10,0x00,0x00,0x00,0x00,0xC2,0xA9,
-	0x42,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x89,0x82,0xFA,0x00,0x00,0xC2,0xA9,0x42,0xDA,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x82,0xFA,0x61,0x89,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x86,0x31,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x10,0x84,
-	0xFF,0xFF,0x8A,0x52,0xFF,0xFF,0x86,0x31,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFB,0xDE,0x10,0x84,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x99,0x81,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x62,0xEA,0xC2,0xA9,0x00,0x00,0xE2,0xB9,0xE2,0xB9,0x61,0x89,0x62,0xEA,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xDA,0x81,0x99,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0xFB,0xDE,0x00,0x00,0x00,0x00,0x75,0xAD,0xFB,0xDE,0x00,0x00,0x00,0x00,0xF3,0x9C,0xFB,0xDE,0x86,0x31,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x82,0x10,0x7D,0xEF,0x10,0x84,0x10,0x84,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0x62,0xEA,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xDA,0x62,0xEA,0xE2,0xB9,0xE2,0xB9,0xE2,0xB9,0x82,0xFA,0x82,0xFA,0xA0,0x38,0x00,0x00,0x42,0xDA,0x81,0x99,0x21,0x69,0x82,0xFA,0x20,0x10,0x00,0x00,0xA0,0x38,0x82,0xFA,0xA0,0x38,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xFF,0xFF,
-	0x8E,0x73,0x00,0x00,0x00,0x00,0x10,0x84,0xFF,0xFF,0x00,0x00,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x0C,0x63,0xFF,0xFF,0x82,0x10,0xF7,0xBD,0x79,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x42,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x62,0xEA,0xE1,0x58,0x00,0x00,0x00,0x00,0x82,0xFA,0x41,0x79,0xA0,0x38,0x82,0xFA,0xA0,0x38,0x00,0x00,0x81,0x99,0x02,0xCA,0x00,0x00,0x82,0xFA,0x61,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x79,0xCE,0xF7,0xBD,0xF7,0xBD,0xFB,0xDE,0xFF,0xFF,0x86,0x31,0x00,0x00,0xFB,0xDE,0x75,0xAD,0x00,0x00,0x79,0xCE,0x75,0xAD,
-	0x00,0x00,0x79,0xCE,0xF3,0x9C,0x00,0x00,0xF7,0xBD,0xF7,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xB9,0x61,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x82,0xFA,0x61,0x89,0xA0,0x38,0xA0,0x38,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x82,0xFA,0x21,0x69,0x20,0x10,0x82,0xFA,0x21,0x69,0x20,0x10,0x82,0xFA,0xE1,0x58,
-	0x00,0x00,0x82,0xFA,0x41,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x08,0x42,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0xF3,0x9C,0x79,0xCE,0x86,0x31,0xFF,0xFF,0x08,0x42,0x00,0x00,0xFF,0xFF,0x71,0x8C,0x00,0x00,0x00,0x00,0x40,0x18,0x82,0xFA,0x40,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA0,0x38,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x38,0x82,0xFA,0xA0,0x38,0x00,0x00,0x42,0xDA,0x61,0x89,0x21,0x69,0x62,0xEA,0x20,0x10,0xA0,0x38,0x82,0xFA,0xC0,0x48,0x00,0x00,0x00,0x00,0x86,0x31,0xFF,0xFF,0x10,0x84,0x08,0x42,0x08,0x42,0x08,0x42,0x0C,0x63,
-	0xFF,0xFF,0x10,0x84,0x82,0x10,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x10,0x84,0xFF,0xFF,0xF3,0x9C,0xFB,0xDE,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x00,0x00,0x00,0x00,0x41,0x79,0x02,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x82,0xFA,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,
-	0x82,0xFA,0x60,0x28,0x00,0x00,0xE2,0xB9,0xE2,0xB9,0x42,0xDA,0x81,0x99,0x00,0x00,0xA0,0x38,0x82,0xFA,0xA0,0x38,0x00,0x00,0x00,0x00,0x71,0x8C,0xFF,0xFF,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x84,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0x08,0x42,0xFF,0xFF,0xFF,0xFF,0x8E,0x73,0x00,0x00,0x86,0x31,
-	0xFF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x42,0xDA,0xE1,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x79,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x79,0x82,0xFA,0x00,0x00,0x00,0x00,0x41,0x79,0x82,0xFA,0x82,0xFA,0x60,0x28,0x00,0x00,0x21,0x69,0x82,0xFA,0x40,0x18,0x00,0x00,
-	0x00,0x00,0x7D,0xEF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7D,0xEF,0xF7,0xBD,0x8A,0x52,0xFF,0xFF,0x08,0x42,0x00,0x00,0x04,0x21,0xFF,0xFF,0xFF,0xFF,0x82,0x10,0x00,0x00,0x08,0x42,0xFF,0xFF,0x08,0x42,0x00,0x00,0xA0,0x38,0x82,0xFA,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x89,0x82,0xFA,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x89,0x82,0xFA,0x00,0x00,0x00,0x00,0xE1,0x58,0x82,0xFA,0x02,0xCA,0x00,0x00,0x00,0x00,0x41,0x79,0x82,0xFA,0x00,0x00,0x00,0x00,0x8A,0x52,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x79,0xCE,0x10,0x84,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xF3,0x9C,0x00,0x00,0x00,0x00,0x8E,0x73,0xFF,0xFF,0x04,0x21,0x00,0x00,0x81,0x99,0x81,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xB9,0xE2,0xB9,0x00,0x00,0x00,0x00,0xA0,0x38,
-	0x82,0xFA,0xE1,0x58,0x00,0x00,0x00,0x00,0xC2,0xA9,0x42,0xDA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x62,0xEA,
-	0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0x58,0x62,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,
-	0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_2_15014_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 52,
-    .header.h = 20,
-    .data_size = sizeof(face_756_2_dial_img_2_15014_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_2_15014_data_1};
-
-    
\ No newline at end of file
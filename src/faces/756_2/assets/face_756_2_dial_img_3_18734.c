@@ -1,283 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2
-
-#include "../756_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_3_18734_data_0[] = {
-	//RGB565 data 
-	0xA0,0x40,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0xA0,0x40,
-	0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0xC0,0x48,0x42,0xE2,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xDA,0xC0,0x48,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_3_18734_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 34,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_3_18734_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_3_18734_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_3_18734_data_1[] = {
-	//RGB565 data 
-	0xA0,0x40,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0xA0,0x40,
-	0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0xC0,0x48,0x42,0xE2,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xDA,0xC0,0x48,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_3_18734_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 34,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_3_18734_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_3_18734_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_3_18734_data_2[] = {
-	//RGB565 data 
-	0xA0,0x40,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0xA0,0x40,
-	0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0xC0,0x48,0x42,0xE2,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xDA,0xC0,0x48,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_3_18734_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 34,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_3_18734_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_3_18734_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_3_18734_data_3[] = {
-	//RGB565 data 
-	0xA0,0x40,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0xA0,0x40,
-	0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0xC0,0x48,0x42,0xE2,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xDA,0xC0,0x48,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_3_18734_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 34,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_3_18734_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_3_18734_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_3_18734_data_4[] = {
-	//RGB565 data 
-	0xA0,0x40,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0xA0,0x40,
-	0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0xC0,0x48,0x42,0xE2,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xDA,0xC0,0x48,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_3_18734_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 34,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_3_18734_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_3_18734_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_3_18734_data_5[] = {
-	//RGB565 data 
-	0xA0,0x40,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0xA0,0x40,
-	0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,
-	0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x00,0x00,0x00,0x00,0x42,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xE2,0x00,0x00,0x00,0x00,0xC0,0x48,0x42,0xE2,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x42,0xDA,0xC0,0x48,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_3_18734_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 34,
-    .header.h = 16,
-    .data_size = sizeof(face_756_2_dial_img_3_18734_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_3_18734_data_5};
-
-    
\ No newline at end of file
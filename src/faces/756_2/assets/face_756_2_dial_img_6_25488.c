@@ -1,2823 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2
-
-#include "../756_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x40,0xC5,0x70,0xE5,0x78,
-	0xE5,0x78,0x27,0x99,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x27,0x99,0xE5,0x78,0xE5,0x78,0xA4,0x60,0x42,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xE5,0x78,
-	0x89,0xC9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x47,0xA9,0x83,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x62,0x40,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xAA,0xD9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x27,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x50,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x27,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0x27,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x50,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xAA,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x62,0x40,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x70,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x88,0xC9,0x06,0x89,0xE5,0x78,0xA4,0x58,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x83,0x48,0xE5,0x78,0x06,0x89,0xA9,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x26,0x99,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x83,0x48,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x88,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC4,0x68,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x06,0x89,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x58,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xA4,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x88,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x47,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xD9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x88,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x89,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA8,0xD9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x87,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0x45,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xA9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xA9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0xC9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0xD9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0x86,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x45,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x04,0x89,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x89,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xC3,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x61,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA6,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x68,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0x04,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC3,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA2,0x58,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xA6,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x85,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x44,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xC9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x68,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x44,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC5,0xE9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x68,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x44,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x48,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xA5,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xA5,0xD1,0x44,0xA9,
-	0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0x23,0x99,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x68,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE2,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC4,0xE1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x84,0xC1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x84,0xC1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x63,0xB9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x63,0xB9,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x02,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x58,0xA4,0xD1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x23,0x99,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0x02,0x89,0x84,0xC1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xA4,0xD1,0x23,0x99,0xC1,0x58,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x81,0x38,0xE2,0x68,0x02,0x79,
-	0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0xC1,0x58,0x81,0x38,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC5,0x70,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x27,0x99,0xC5,0x70,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x50,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x06,0x89,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x27,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x62,0x40,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xA4,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0x62,0x38,0x62,0x38,0x83,0x48,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x47,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x42,0x30,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0xD9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC9,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x89,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA8,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x87,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x45,0xA9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0xD9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x89,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x04,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC3,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA6,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x85,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x24,0x99,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xC2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xA5,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x78,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x99,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE2,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x48,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x48,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x02,0x79,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xA9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x02,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x40,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0x58,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x63,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x02,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x06,0x89,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,
-	0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x47,0xA9,0xE5,0x78,0xE5,0x78,0xE5,0x78,0x62,0x40,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x70,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x89,0xC9,
-	0x06,0x89,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x27,0x99,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0xC5,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x27,0x99,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x89,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x40,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0x27,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xC5,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x89,0xC9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xC4,0x70,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x58,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,
-	0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x83,0x48,0xE5,0x78,0x26,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,
-	0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA4,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0xD9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x88,0xC9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xC9,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xC9,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x62,0x38,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0x05,0x89,0xA8,0xD9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0x05,0x89,0xA8,0xD9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA8,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA3,0x58,0x46,0xA9,0xC8,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0x05,0x89,0xA7,0xD9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x46,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA3,0x58,0x25,0x99,0xC8,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0x25,0x99,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0x25,0x99,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xC8,0xE9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,
-	0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xC7,0xE9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0x25,0x99,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x66,0xB9,0xA3,0x58,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x86,0xC9,0xC3,0x68,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x86,0xC9,0xC3,0x68,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0xC3,0x68,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC7,0xE9,0x45,0xA9,0xA2,0x58,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA6,0xD9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA6,0xD9,0xC3,0x68,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xD9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA6,0xD9,0xA2,0x58,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0x04,0x89,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xD9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x44,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x58,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x85,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x44,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xC9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE9,0xE3,0x78,
-	0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,
-	0xE3,0x78,0xC2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x78,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x43,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE2,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x40,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x68,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x63,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x89,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xB9,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xA4,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,
-	0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,
-	0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x06,0x89,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,
-	0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x47,0xA9,0xE5,0x78,0xE5,0x78,0xE5,0x78,0xE5,0x78,0x62,0x40,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0x89,0xC9,0x06,0x89,0x83,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x27,0x99,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x27,0x99,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x83,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x40,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x83,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xC4,0x70,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x89,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,
-	0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x83,0x48,0xE5,0x78,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,
-	0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC9,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x67,0xB9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x18,0xE4,0x78,0xC9,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xA9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,
-	0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0xA8,0xD9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x89,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x46,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x46,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x66,0xB9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x46,0xA9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xC8,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x04,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,
-	0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x82,0x48,0xE4,0x78,0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE4,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0x86,0xC9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xD9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x89,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x48,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x23,0x99,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x99,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x44,0xA9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE3,0x78,0xC5,0xE9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,
-	0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0x44,0xA9,0xC5,0xE9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x43,0xA9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xE1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x63,0xB9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC4,0xE1,0xC1,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x23,0x99,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x43,0xA9,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xB9,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x63,0xB9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x84,0xC1,0x02,0x89,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x48,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,
-	0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0xC1,0x58,0x81,0x38,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x40,0xE5,0x78,0x27,0x99,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,
-	0x68,0xB9,0x68,0xB9,0x27,0x99,0xE5,0x78,0xE5,0x78,0xA4,0x60,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xAA,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x83,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x89,0xC9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x58,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x58,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x58,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,
-	0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC9,0xE9,0x67,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC9,0xE9,0x42,0x30,0x47,0xA9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC9,0xE9,0x42,0x30,0x00,0x00,0xA9,0xD9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0x83,0x48,0x00,0x00,0x00,0x00,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA9,0xD9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x89,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0x88,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x46,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xC8,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x62,0x38,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x48,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xA9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0x46,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0xD9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x86,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x89,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xE9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x89,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA3,0x58,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0x86,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x61,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x82,0x48,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,
-	0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x82,0x48,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC3,0x68,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE3,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x04,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC3,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xA6,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x65,0xB9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x85,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x58,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,
-	0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x84,0xC9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,0x64,0xB9,
-	0x81,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x03,0x89,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x99,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x18,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x48,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x78,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xA9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xC9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xA4,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x63,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC1,0x58,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x02,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC1,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xB9,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xB9,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xC4,0xE1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x48,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,
-	0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x06,0x89,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,
-	0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,
-	0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x47,0xA9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x47,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x41,0x20,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x40,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xC5,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xA9,0xD9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xC4,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x47,0xA9,0x83,0x48,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,
-	0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0xD9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x58,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x88,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,
-	0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0x67,0xB9,0xE4,0x78,0xE4,0x78,0xE4,0x78,0x62,0x38,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xA9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x46,0xA9,0xC4,0x68,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xD9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x46,0xA9,0x62,0x38,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x25,0x99,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x89,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xE9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC8,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,
-	0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xE4,0x78,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x86,0xC9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xA9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x68,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC7,0xE9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x24,0x99,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xC9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xC9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x23,0x99,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x99,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x84,0xC9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x23,0x99,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,
-	0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0xE3,0x78,0x23,0x99,0x84,0xC9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xA4,0xD1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC2,0x58,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC4,0xE1,0xC2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC4,0xE1,0x02,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x02,0x79,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x84,0xC1,0xE2,0x68,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xA4,0xD1,0x43,0xA9,0xE2,0x68,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,
-	0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0xC1,0x58,0x81,0x38,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_5};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x20,0x62,0x40,0xC5,0x70,0xE5,0x78,0xE5,0x78,0xE5,0x78,0x47,0xA9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,
-	0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x83,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xC5,0x70,0x68,0xB9,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC5,0x70,0xAA,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x27,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x27,0x99,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0x89,0xC9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x41,0x20,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x27,0x99,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x70,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xC5,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x50,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xA9,0xD9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x47,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x26,0x99,0xE5,0x78,0xA4,0x58,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,
-	0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x88,0xC9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x20,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xD9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x89,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC9,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC4,0x68,0x67,0xB9,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x67,0xB9,0x67,0xB9,0xE4,0x78,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x82,0x48,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0xE4,0x78,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xA8,0xD9,0x41,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xA9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x28,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x87,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x41,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0xD9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC3,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x68,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x66,0xB9,0x04,0x89,0xE4,0x78,0xE4,0x78,0x82,0x48,
-	0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0xC3,0x68,0xE4,0x78,0x45,0xA9,0xA7,0xD9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE4,0x78,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x89,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x45,0xA9,0x82,0x48,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0x66,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0x86,0xC9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x48,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC7,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE3,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xA9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0x85,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xC9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA6,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x45,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x44,0xA9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x65,0xB9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x68,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0xC5,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x85,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x64,0xB9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x81,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xA5,0xD1,0xC2,0x68,0x81,0x38,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xA2,0x58,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x78,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x03,0x89,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC4,0xE1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC4,0xE1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC4,0xE1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x99,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x84,0xC1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x99,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x02,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0x84,0xC1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x84,0xC1,0xE2,0x68,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xA1,0x48,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,
-	0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0xE2,0x68,0x81,0x38,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_6 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_6),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_6};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x50,0x47,0xA9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,
-	0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,
-	0x68,0xB9,0xE5,0x78,0x83,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x89,0xC9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xAA,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x40,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x41,0x20,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0xC9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xC5,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xA9,0xD9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,
-	0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0x62,0x38,0xA4,0x58,0xA9,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA9,0xD9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x26,0x99,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x88,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x58,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA4,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x26,0x99,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0x88,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x47,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC9,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xC9,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0x88,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC9,0xE9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xC8,0xE9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x10,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xC8,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x46,0xA9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xA7,0xD9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xC8,0xE9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x10,0x87,0xC9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC8,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x04,0x89,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xC7,0xE9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0x86,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x86,0xC9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x28,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA7,0xD9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x86,0xC9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC3,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xC7,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x85,0xC9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x04,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x85,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xC6,0xE9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xC6,0xE9,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x85,0xC9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0x85,0xC9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x85,0xC9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x44,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC5,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x84,0xC9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x68,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xC5,0xE9,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA4,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xA9,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x68,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA4,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x43,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xA9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xA4,0xD1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x68,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x02,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x63,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC1,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x81,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_7 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_7),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_7};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x62,0x40,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x42,0x30,0xC5,0x70,0x27,0x99,0x68,0xB9,0xAA,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x68,0xB9,0xE5,0x78,0x83,0x50,0x20,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x62,0x40,0x27,0x99,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x47,0xA9,0x83,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x60,0xAA,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xAA,0xD9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x40,0xAA,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x27,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x06,0x89,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x89,0xC9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x62,0x40,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA9,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x42,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0xD9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x26,0x99,0xE5,0x78,0x62,0x38,0x62,0x38,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0x62,0x38,0x62,0x38,0xE5,0x78,0x47,0xA9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x68,0xB9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x26,0x99,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x48,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x26,0x99,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0xA9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x06,0x89,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC9,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xE9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x05,0x89,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xD9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x88,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC9,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x28,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xC9,0xE9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x25,0x99,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x05,0x89,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x05,0x89,0x41,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x82,0x48,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x66,0xB9,0x05,0x89,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0x46,0xA9,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xA9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC8,0xE9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0x87,0xC9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x82,0x48,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE4,0x78,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE4,0x78,0xC8,0xE9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x86,0xC9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xA7,0xD9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC7,0xE9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x86,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,
-	0x66,0xB9,0x04,0x89,0xE4,0x78,0xE4,0x78,0xE4,0x78,0x04,0x89,0x66,0xB9,0xA7,0xD9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA3,0x58,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xC7,0xE9,0x24,0x99,0x82,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA3,0x58,0x66,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x45,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC7,0xE9,0xE4,0x78,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0x86,0xC9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x45,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC3,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x61,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC7,0xE9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x04,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x89,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xA9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA6,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xC6,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x89,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x03,0x89,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x64,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC5,0xE9,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x64,0xB9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x84,0xC9,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x23,0x99,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE9,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xC5,0xE9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xA5,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0x84,0xC9,0xA2,0x58,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x89,0xA5,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x64,0xB9,0x23,0x99,0xE2,0x78,0xE2,0x78,0xE2,0x78,0xE2,0x78,0xE2,0x78,0x03,0x89,0x64,0xB9,0xC5,0xE9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x78,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x68,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0xE1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE1,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x99,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0x81,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE2,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x23,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0xC1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC1,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x84,0xC1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xA4,0xD1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x79,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x02,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x23,0x99,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x84,0xC1,0xC1,0x58,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC1,0x58,0x43,0xA9,0xC4,0xE1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x43,0xA9,0xE2,0x68,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x81,0x38,0x02,0x79,
-	0x02,0x79,0x63,0xB9,0x63,0xB9,0x84,0xC1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x63,0xB9,0x63,0xB9,0x43,0xA9,0x02,0x79,0xE2,0x68,0x81,0x38,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_8 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_8),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_8};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_dial_img_6_25488_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x81,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x40,0xC5,0x70,0xE5,0x78,0x06,0x89,
-	0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0x68,0xB9,0xE5,0x78,0xE5,0x78,0xA4,0x60,0x41,0x20,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x50,0x47,0xA9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x89,0xC9,0xA4,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x62,0x40,0x89,0xC9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x68,0xB9,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x89,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x89,0xC9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x89,0xC9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x89,0xC9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xCA,0xE9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xA4,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC5,0x70,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x47,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x20,0xCA,0xE9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x41,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,
-	0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0xEB,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x47,0xA9,0xE5,0x78,0x62,0x38,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x62,0x38,0xA4,0x58,0x47,0xA9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0xE5,0x78,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x30,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC4,0x68,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x47,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xCA,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA9,0xD9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x26,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0x68,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x20,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0xC9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0x42,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA4,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xB9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xA9,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x83,0x48,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xD9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x67,0xB9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0x78,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0x88,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,
-	0xEA,0xF9,0xEA,0xF9,0xEA,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xA9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x46,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x83,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xD9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE5,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0x68,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x25,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x87,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x99,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0x87,0xC9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x38,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0xA3,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA3,0x58,0x66,0xB9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xC8,0xE9,0x66,0xB9,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0xE4,0x78,0x46,0xA9,0x87,0xC9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE4,0x78,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,
-	0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0xE9,0xF9,0x05,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x82,0x48,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xC4,0x68,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x28,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0x62,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0xE9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xA9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xA7,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x58,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x66,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC7,0xE9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE4,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE4,0x78,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x82,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC7,0xE9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,
-	0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0xE8,0xF9,0x41,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x48,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x86,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,
-	0xC7,0xE9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0x04,0x89,0x20,0x10,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE3,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA2,0x58,0x04,0x89,0x65,0xB9,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xC7,0xE9,0x65,0xB9,0xC3,0x68,0x41,0x18,0x00,0x00,0x61,0x28,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x58,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x78,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xC6,0xE9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0xB9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x65,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xD9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,
-	0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0xE7,0xF9,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xE6,0xF9,
-	0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xC3,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x68,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0xE6,0xF9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x99,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0x24,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA2,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xB9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x44,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0xC5,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x81,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA5,0xD9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x18,0x81,0x48,0x23,0x99,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xA2,0x58,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x48,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0xA9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x81,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0xD1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x03,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x81,0x38,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE1,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x58,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x78,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC5,0xE1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xB9,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x84,0xC9,
-	0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC4,0xE1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x43,0xA9,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xC4,0xE1,0xC1,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x38,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,
-	0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0xE5,0xF1,0x02,0x89,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE2,0x68,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xC4,0xE1,0x02,0x89,0x40,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x99,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x43,0xA9,0xC1,0x58,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xB9,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,
-	0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0xE4,0xF1,0x63,0xB9,0x02,0x89,0xA1,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA1,0x48,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,
-	0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x02,0x79,0x81,0x38,0x81,0x38,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_dial_img_6_25488_9 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 69,
-    .header.h = 81,
-    .data_size = sizeof(face_756_2_dial_img_6_25488_data_9),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_dial_img_6_25488_data_9};
-
-    
\ No newline at end of file
@@ -1,416 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#include "756_2_466.h"
-
-#ifdef ENABLE_FACE_756_2_466
-
-lv_obj_t *face_756_2_466;
-lv_obj_t *face_756_2_466_0_424;
-lv_obj_t *face_756_2_466_2_53268;
-lv_obj_t *face_756_2_466_3_60934;
-lv_obj_t *face_756_2_466_5_74432;
-lv_obj_t *face_756_2_466_6_75640;
-lv_obj_t *face_756_2_466_7_75640;
-lv_obj_t *face_756_2_466_8_284946;
-lv_obj_t *face_756_2_466_9_284946;
-lv_obj_t *face_756_2_466_10_360030;
-lv_obj_t *face_756_2_466_11_360030;
-lv_obj_t *face_756_2_466_12_360030;
-lv_obj_t *face_756_2_466_13_360030;
-lv_obj_t *face_756_2_466_14_360030;
-lv_obj_t *face_756_2_466_15_360030;
-lv_obj_t *face_756_2_466_16_360030;
-lv_obj_t *face_756_2_466_17_368896;
-lv_obj_t *face_756_2_466_18_368896;
-lv_obj_t *face_756_2_466_20_388522;
-
-
-#if LV_COLOR_DEPTH != 16
-#error "LV_COLOR_DEPTH should be 16bit for watchfaces"
-#endif
-
-const lv_img_dsc_t *face_756_2_466_dial_img_1_46130_group[] = {
-	&face_756_2_466_dial_img_1_46130_0,
-	&face_756_2_466_dial_img_1_46130_1,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_2_53268_group[] = {
-	&face_756_2_466_dial_img_2_53268_0,
-	&face_756_2_466_dial_img_2_53268_1,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_3_60934_group[] = {
-	&face_756_2_466_dial_img_3_60934_0,
-	&face_756_2_466_dial_img_3_60934_1,
-	&face_756_2_466_dial_img_3_60934_2,
-	&face_756_2_466_dial_img_3_60934_3,
-	&face_756_2_466_dial_img_3_60934_4,
-	&face_756_2_466_dial_img_3_60934_5,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_connection[] = {
-	&face_756_2_466_dial_img_4_73228_0,
-	&face_756_2_466_dial_img_5_74432_0,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_6_75640_group[] = {
-	&face_756_2_466_dial_img_6_75640_0,
-	&face_756_2_466_dial_img_6_75640_1,
-	&face_756_2_466_dial_img_6_75640_2,
-	&face_756_2_466_dial_img_6_75640_3,
-	&face_756_2_466_dial_img_6_75640_4,
-	&face_756_2_466_dial_img_6_75640_5,
-	&face_756_2_466_dial_img_6_75640_6,
-	&face_756_2_466_dial_img_6_75640_7,
-	&face_756_2_466_dial_img_6_75640_8,
-	&face_756_2_466_dial_img_6_75640_9,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_8_284946_group[] = {
-	&face_756_2_466_dial_img_8_284946_0,
-	&face_756_2_466_dial_img_8_284946_1,
-	&face_756_2_466_dial_img_8_284946_2,
-	&face_756_2_466_dial_img_8_284946_3,
-	&face_756_2_466_dial_img_8_284946_4,
-	&face_756_2_466_dial_img_8_284946_5,
-	&face_756_2_466_dial_img_8_284946_6,
-	&face_756_2_466_dial_img_8_284946_7,
-	&face_756_2_466_dial_img_8_284946_8,
-	&face_756_2_466_dial_img_8_284946_9,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_10_360030_group[] = {
-	&face_756_2_466_dial_img_10_360030_0,
-	&face_756_2_466_dial_img_10_360030_1,
-	&face_756_2_466_dial_img_10_360030_2,
-	&face_756_2_466_dial_img_10_360030_3,
-	&face_756_2_466_dial_img_10_360030_4,
-	&face_756_2_466_dial_img_10_360030_5,
-	&face_756_2_466_dial_img_10_360030_6,
-	&face_756_2_466_dial_img_10_360030_7,
-	&face_756_2_466_dial_img_10_360030_8,
-	&face_756_2_466_dial_img_10_360030_9,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_17_368896_group[] = {
-	&face_756_2_466_dial_img_17_368896_0,
-	&face_756_2_466_dial_img_17_368896_1,
-	&face_756_2_466_dial_img_17_368896_2,
-	&face_756_2_466_dial_img_17_368896_3,
-	&face_756_2_466_dial_img_17_368896_4,
-	&face_756_2_466_dial_img_17_368896_5,
-	&face_756_2_466_dial_img_17_368896_6,
-	&face_756_2_466_dial_img_17_368896_7,
-	&face_756_2_466_dial_img_17_368896_8,
-	&face_756_2_466_dial_img_17_368896_9,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_19_374600_group[] = {
-	&face_756_2_466_dial_img_19_374600_0,
-	&face_756_2_466_dial_img_19_374600_1,
-	&face_756_2_466_dial_img_19_374600_2,
-	&face_756_2_466_dial_img_19_374600_3,
-	&face_756_2_466_dial_img_19_374600_4,
-	&face_756_2_466_dial_img_19_374600_5,
-	&face_756_2_466_dial_img_19_374600_6,
-};
-const lv_img_dsc_t *face_756_2_466_dial_img_20_388522_group[] = {
-	&face_756_2_466_dial_img_20_388522_0,
-	&face_756_2_466_dial_img_20_388522_1,
-	&face_756_2_466_dial_img_20_388522_2,
-	&face_756_2_466_dial_img_20_388522_3,
-	&face_756_2_466_dial_img_20_388522_4,
-	&face_756_2_466_dial_img_20_388522_5,
-	&face_756_2_466_dial_img_20_388522_6,
-};
-
-
-
-
-#endif
-
-void init_face_756_2_466(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t **, lv_obj_t **)){
-#ifdef ENABLE_FACE_756_2_466
-    face_756_2_466 = lv_obj_create(NULL);
-    lv_obj_clear_flag(face_756_2_466, LV_OBJ_FLAG_SCROLLABLE);
-    lv_obj_set_style_bg_color(face_756_2_466, lv_color_hex(0x000000), LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_bg_opa(face_756_2_466, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_width(face_756_2_466, 0, LV_PART_MAIN| LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_left(face_756_2_466, 0, LV_PART_MAIN| LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_right(face_756_2_466, 0, LV_PART_MAIN| LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_top(face_756_2_466, 0, LV_PART_MAIN| LV_STATE_DEFAULT);
-    lv_obj_set_style_pad_bottom(face_756_2_466, 0, LV_PART_MAIN| LV_STATE_DEFAULT);
-
-    lv_obj_add_event_cb(face_756_2_466, onFaceEvent, LV_EVENT_ALL, NULL);
-
-    
-    face_756_2_466_0_424 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_0_424, &face_756_2_466_dial_img_0_424_0);
-    lv_obj_set_width(face_756_2_466_0_424, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_0_424, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_0_424, 27);
-    lv_obj_set_y(face_756_2_466_0_424, 310);
-    lv_obj_add_flag(face_756_2_466_0_424, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_0_424, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_2_53268 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_2_53268, &face_756_2_466_dial_img_2_53268_0);
-    lv_obj_set_width(face_756_2_466_2_53268, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_2_53268, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_2_53268, 223);
-    lv_obj_set_y(face_756_2_466_2_53268, 33);
-    lv_obj_add_flag(face_756_2_466_2_53268, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_2_53268, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_3_60934 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_3_60934, &face_756_2_466_dial_img_3_60934_0);
-    lv_obj_set_width(face_756_2_466_3_60934, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_3_60934, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_3_60934, 126);
-    lv_obj_set_y(face_756_2_466_3_60934, 34);
-    lv_obj_add_flag(face_756_2_466_3_60934, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_3_60934, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_5_74432 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_5_74432, &face_756_2_466_dial_img_5_74432_0);
-    lv_obj_set_width(face_756_2_466_5_74432, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_5_74432, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_5_74432, 359);
-    lv_obj_set_y(face_756_2_466_5_74432, 106);
-    lv_obj_add_flag(face_756_2_466_5_74432, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_5_74432, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_6_75640 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_6_75640, &face_756_2_466_dial_img_6_75640_0);
-    lv_obj_set_width(face_756_2_466_6_75640, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_6_75640, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_6_75640, 147);
-    lv_obj_set_y(face_756_2_466_6_75640, 116);
-    lv_obj_add_flag(face_756_2_466_6_75640, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_6_75640, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_7_75640 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_7_75640, &face_756_2_466_dial_img_6_75640_0);
-    lv_obj_set_width(face_756_2_466_7_75640, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_7_75640, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_7_75640, 13);
-    lv_obj_set_y(face_756_2_466_7_75640, 116);
-    lv_obj_add_flag(face_756_2_466_7_75640, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_7_75640, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_8_284946 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_8_284946, &face_756_2_466_dial_img_8_284946_0);
-    lv_obj_set_width(face_756_2_466_8_284946, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_8_284946, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_8_284946, 353);
-    lv_obj_set_y(face_756_2_466_8_284946, 194);
-    lv_obj_add_flag(face_756_2_466_8_284946, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_8_284946, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_9_284946 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_9_284946, &face_756_2_466_dial_img_8_284946_0);
-    lv_obj_set_width(face_756_2_466_9_284946, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_9_284946, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_9_284946, 273);
-    lv_obj_set_y(face_756_2_466_9_284946, 194);
-    lv_obj_add_flag(face_756_2_466_9_284946, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_9_284946, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_10_360030 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_10_360030, &face_756_2_466_dial_img_10_360030_0);
-    lv_obj_set_width(face_756_2_466_10_360030, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_10_360030, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_10_360030, 365);
-    lv_obj_set_y(face_756_2_466_10_360030, 320);
-    lv_obj_add_flag(face_756_2_466_10_360030, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_10_360030, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_11_360030 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_11_360030, &face_756_2_466_dial_img_10_360030_0);
-    lv_obj_set_width(face_756_2_466_11_360030, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_11_360030, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_11_360030, 337);
-    lv_obj_set_y(face_756_2_466_11_360030, 320);
-    lv_obj_add_flag(face_756_2_466_11_360030, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_11_360030, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_12_360030 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_12_360030, &face_756_2_466_dial_img_10_360030_0);
-    lv_obj_set_width(face_756_2_466_12_360030, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_12_360030, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_12_360030, 310);
-    lv_obj_set_y(face_756_2_466_12_360030, 320);
-    lv_obj_add_flag(face_756_2_466_12_360030, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_12_360030, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_13_360030 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_13_360030, &face_756_2_466_dial_img_10_360030_0);
-    lv_obj_set_width(face_756_2_466_13_360030, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_13_360030, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_13_360030, 217);
-    lv_obj_set_y(face_756_2_466_13_360030, 380);
-    lv_obj_add_flag(face_756_2_466_13_360030, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_13_360030, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_14_360030 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_14_360030, &face_756_2_466_dial_img_10_360030_0);
-    lv_obj_set_width(face_756_2_466_14_360030, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_14_360030, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_14_360030, 190);
-    lv_obj_set_y(face_756_2_466_14_360030, 380);
-    lv_obj_add_flag(face_756_2_466_14_360030, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_14_360030, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_15_360030 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_15_360030, &face_756_2_466_dial_img_10_360030_0);
-    lv_obj_set_width(face_756_2_466_15_360030, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_15_360030, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_15_360030, 163);
-    lv_obj_set_y(face_756_2_466_15_360030, 380);
-    lv_obj_add_flag(face_756_2_466_15_360030, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_15_360030, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_16_360030 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_16_360030, &face_756_2_466_dial_img_10_360030_0);
-    lv_obj_set_width(face_756_2_466_16_360030, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_16_360030, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_16_360030, 135);
-    lv_obj_set_y(face_756_2_466_16_360030, 380);
-    lv_obj_add_flag(face_756_2_466_16_360030, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_16_360030, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_17_368896 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_17_368896, &face_756_2_466_dial_img_17_368896_0);
-    lv_obj_set_width(face_756_2_466_17_368896, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_17_368896, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_17_368896, 190);
-    lv_obj_set_y(face_756_2_466_17_368896, 310);
-    lv_obj_add_flag(face_756_2_466_17_368896, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_17_368896, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_18_368896 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_18_368896, &face_756_2_466_dial_img_17_368896_0);
-    lv_obj_set_width(face_756_2_466_18_368896, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_18_368896, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_18_368896, 168);
-    lv_obj_set_y(face_756_2_466_18_368896, 310);
-    lv_obj_add_flag(face_756_2_466_18_368896, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_18_368896, LV_OBJ_FLAG_SCROLLABLE );
-
-    face_756_2_466_20_388522 = lv_img_create(face_756_2_466);
-    lv_img_set_src(face_756_2_466_20_388522, &face_756_2_466_dial_img_20_388522_0);
-    lv_obj_set_width(face_756_2_466_20_388522, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_756_2_466_20_388522, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_756_2_466_20_388522, 79);
-    lv_obj_set_y(face_756_2_466_20_388522, 310);
-    lv_obj_add_flag(face_756_2_466_20_388522, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_clear_flag(face_756_2_466_20_388522, LV_OBJ_FLAG_SCROLLABLE );
-
-
-    callback("Red", &face_756_2_466_dial_img_preview_0, &face_756_2_466, NULL);
-
-#endif
-}
-
-void update_time_756_2_466(int second, int minute, int hour, bool mode, bool am, int day, int month, int year, int weekday)
-{
-#ifdef ENABLE_FACE_756_2_466
-    if (!face_756_2_466)
-    {
-        return;
-    }
-	if (mode)
-	{
-		lv_obj_add_flag(face_756_2_466_2_53268, LV_OBJ_FLAG_HIDDEN);
-	} else {
-		lv_obj_clear_flag(face_756_2_466_2_53268, LV_OBJ_FLAG_HIDDEN);
-	}
-	lv_img_set_src(face_756_2_466_2_53268, face_756_2_466_dial_img_2_53268_group[(am ? 0 : 1) % 2]);
-	lv_img_set_src(face_756_2_466_6_75640, face_756_2_466_dial_img_6_75640_group[(hour / 1) % 10]);
-	lv_img_set_src(face_756_2_466_7_75640, face_756_2_466_dial_img_6_75640_group[(hour / 10) % 10]);
-	lv_img_set_src(face_756_2_466_8_284946, face_756_2_466_dial_img_8_284946_group[(minute / 1) % 10]);
-	lv_img_set_src(face_756_2_466_9_284946, face_756_2_466_dial_img_8_284946_group[(minute / 10) % 10]);
-	lv_img_set_src(face_756_2_466_17_368896, face_756_2_466_dial_img_17_368896_group[(day / 1) % 10]);
-	lv_img_set_src(face_756_2_466_18_368896, face_756_2_466_dial_img_17_368896_group[(day / 10) % 10]);
-	lv_img_set_src(face_756_2_466_20_388522, face_756_2_466_dial_img_20_388522_group[((weekday + 6) / 1) % 7]);
-
-#endif
-}
-
-void update_weather_756_2_466(int temp, int icon)
-{
-#ifdef ENABLE_FACE_756_2_466
-    if (!face_756_2_466)
-    {
-        return;
-    }
-
-#endif
-}
-
-void update_status_756_2_466(int battery, bool connection){
-#ifdef ENABLE_FACE_756_2_466
-    if (!face_756_2_466)
-    {
-        return;
-    }
-	lv_img_set_src(face_756_2_466_3_60934, face_756_2_466_dial_img_3_60934_group[(battery / (100 / 6)) % 6]);
-	lv_img_set_src(face_756_2_466_5_74432, face_756_2_466_dial_img_connection[(connection ? 0 : 1) % 2]);
-
-#endif
-}
-
-void update_activity_756_2_466(int steps, int distance, int kcal)
-{
-#ifdef ENABLE_FACE_756_2_466
-    if (!face_756_2_466)
-    {
-        return;
-    }
-	lv_img_set_src(face_756_2_466_13_360030, face_756_2_466_dial_img_10_360030_group[(steps / 1) % 10]);
-	lv_img_set_src(face_756_2_466_14_360030, face_756_2_466_dial_img_10_360030_group[(steps / 10) % 10]);
-	lv_img_set_src(face_756_2_466_15_360030, face_756_2_466_dial_img_10_360030_group[(steps / 100) % 10]);
-	lv_img_set_src(face_756_2_466_16_360030, face_756_2_466_dial_img_10_360030_group[(steps / 1000) % 10]);
-
-#endif
-}
-
-void update_health_756_2_466(int bpm, int oxygen)
-{
-#ifdef ENABLE_FACE_756_2_466
-    if (!face_756_2_466)
-    {
-        return;
-    }
-	lv_img_set_src(face_756_2_466_10_360030, face_756_2_466_dial_img_10_360030_group[(bpm / 1) % 10]);
-	lv_img_set_src(face_756_2_466_11_360030, face_756_2_466_dial_img_10_360030_group[(bpm / 10) % 10]);
-	lv_img_set_src(face_756_2_466_12_360030, face_756_2_466_dial_img_10_360030_group[(bpm / 100) % 10]);
-
-#endif
-}
-
-void update_all_756_2_466(int second, int minute, int hour, bool mode, bool am, int day, int month, int year, int weekday, 
-    int temp, int icon, int battery, bool connection, int steps, int distance, int kcal, int bpm, int oxygen)
-{
-#ifdef ENABLE_FACE_756_2_466
-    update_time_756_2_466(second, minute, hour, mode, am, day, month, year, weekday);
-    update_weather_756_2_466(temp, icon);
-    update_status_756_2_466(battery, connection);
-    update_activity_756_2_466(steps, distance, kcal);
-    update_health_756_2_466(bpm, oxygen);
-#endif
-}
-
-void update_check_756_2_466(lv_obj_t *root, int second, int minute, int hour, bool mode, bool am, int day, int month, int year, int weekday, 
-    int temp, int icon, int battery, bool connection, int steps, int distance, int kcal, int bpm, int oxygen)
-{
-#ifdef ENABLE_FACE_756_2_466
-    if (root != face_756_2_466)
-    {
-        return;
-    }
-    update_time_756_2_466(second, minute, hour, mode, am, day, month, year, weekday);
-    update_weather_756_2_466(temp, icon);
-    update_status_756_2_466(battery, connection);
-    update_activity_756_2_466(steps, distance, kcal);
-    update_health_756_2_466(bpm, oxygen);
-#endif
-}
-
-
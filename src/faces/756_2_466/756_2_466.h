@@ -1,132 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#ifndef _FACE_756_2_466_H
-#define _FACE_756_2_466_H
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-#include "lvgl.h"
-#include "app_hal.h"
-
-//#define ENABLE_FACE_756_2_466 // (Red) uncomment to enable or define it elsewhere
-
-#ifdef ENABLE_FACE_756_2_466
-    extern lv_obj_t *face_756_2_466;
-	extern lv_obj_t *face_756_2_466_0_424;
-	extern lv_obj_t *face_756_2_466_2_53268;
-	extern lv_obj_t *face_756_2_466_3_60934;
-	extern lv_obj_t *face_756_2_466_5_74432;
-	extern lv_obj_t *face_756_2_466_6_75640;
-	extern lv_obj_t *face_756_2_466_7_75640;
-	extern lv_obj_t *face_756_2_466_8_284946;
-	extern lv_obj_t *face_756_2_466_9_284946;
-	extern lv_obj_t *face_756_2_466_10_360030;
-	extern lv_obj_t *face_756_2_466_11_360030;
-	extern lv_obj_t *face_756_2_466_12_360030;
-	extern lv_obj_t *face_756_2_466_13_360030;
-	extern lv_obj_t *face_756_2_466_14_360030;
-	extern lv_obj_t *face_756_2_466_15_360030;
-	extern lv_obj_t *face_756_2_466_16_360030;
-	extern lv_obj_t *face_756_2_466_17_368896;
-	extern lv_obj_t *face_756_2_466_18_368896;
-	extern lv_obj_t *face_756_2_466_20_388522;
-
-
-	LV_IMG_DECLARE(face_756_2_466_dial_img_0_424_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_1_46130_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_1_46130_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_2_53268_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_2_53268_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_3_60934_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_3_60934_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_3_60934_2);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_3_60934_3);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_3_60934_4);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_3_60934_5);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_4_73228_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_5_74432_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_2);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_3);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_4);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_5);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_6);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_7);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_8);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_6_75640_9);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_2);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_3);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_4);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_5);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_6);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_7);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_8);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_8_284946_9);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_2);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_3);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_4);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_5);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_6);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_7);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_8);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_10_360030_9);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_2);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_3);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_4);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_5);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_6);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_7);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_8);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_17_368896_9);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_19_374600_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_19_374600_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_19_374600_2);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_19_374600_3);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_19_374600_4);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_19_374600_5);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_19_374600_6);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_20_388522_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_20_388522_1);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_20_388522_2);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_20_388522_3);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_20_388522_4);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_20_388522_5);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_20_388522_6);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_preview_0);
-	LV_IMG_DECLARE(face_756_2_466_dial_img_preview_0);
-
-
-#endif
-    void onFaceEvent(lv_event_t * e);
-
-    void init_face_756_2_466(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t **, lv_obj_t **));
-    void update_time_756_2_466(int second, int minute, int hour, bool mode, bool am, int day, int month, int year, int weekday);
-    void update_weather_756_2_466(int temp, int icon);
-    void update_status_756_2_466(int battery, bool connection);
-    void update_activity_756_2_466(int steps, int distance, int kcal);
-    void update_health_756_2_466(int bpm, int oxygen);
-    void update_all_756_2_466(int second, int minute, int hour, bool mode, bool am, int day, int month, int year, int weekday, 
-                int temp, int icon, int battery, bool connection, int steps, int distance, int kcal, int bpm, int oxygen);
-    void update_check_756_2_466(lv_obj_t *root, int second, int minute, int hour, bool mode, bool am, int day, int month, int year, int weekday, 
-                int temp, int icon, int battery, bool connection, int steps, int distance, int kcal, int bpm, int oxygen);
-
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
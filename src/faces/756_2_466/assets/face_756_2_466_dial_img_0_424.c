@@ -1,1445 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#include "../756_2_466.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_0_424_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x82,0x30,0x65,0x89,0x89,0xE2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,
-	0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x86,0x91,0x86,0x91,0x86,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,
-	0x65,0x81,0x44,0x71,0x44,0x71,0x44,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x82,0x30,0x82,0x30,0x61,0x28,0x61,0x28,0x61,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0x03,0x61,0xE7,0xB1,0x89,0xEA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,
-	0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,
-	0x28,0xC2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x86,0x91,0x86,0x91,0x86,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x65,0x81,0x44,0x71,0x44,0x71,0x44,0x71,0x24,0x71,
-	0x24,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x82,0x30,0x82,0x30,0x61,0x28,0x61,0x20,0x61,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x50,0x28,0xC2,
-	0x89,0xEA,0xAA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0x89,0xE2,0x89,0xE2,
-	0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,
-	0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x86,0x91,0x86,0x91,0x86,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x65,0x81,0x44,0x71,0x44,0x71,0x44,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x58,
-	0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x82,0x30,0x82,0x30,0x61,0x28,0x20,0x18,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0x89,0xE2,0xEA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xF2,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0x89,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,
-	0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,
-	0xE7,0xB1,0xE7,0xB1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x86,0x91,0x86,0x91,0x86,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x65,0x81,0x44,0x71,0x44,0x71,0x44,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,
-	0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x82,0x30,0x82,0x30,0x61,0x28,0x20,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x58,0x48,0xD2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xF2,0xAA,0xEA,0xAA,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,
-	0x69,0xDA,0x69,0xDA,0x69,0xDA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0xE6,0xC1,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,
-	0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x86,0x91,0x86,0x91,0x86,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x65,0x81,0x44,0x71,0x44,0x71,0x44,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,
-	0xA2,0x38,0xA2,0x38,0x82,0x30,0x82,0x30,0x61,0x28,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x48,0xE7,0xB1,0x89,0xE2,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x69,0xDA,0x48,0xD2,0x48,0xD2,0x48,0xD2,
-	0x48,0xD2,0x48,0xCA,0x48,0xCA,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0xE6,0xC1,0xE6,0xC1,0x07,0xB2,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x86,0x91,
-	0x86,0x91,0x86,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x65,0x81,0x44,0x71,0x44,0x71,0x44,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x82,0x30,0x82,0x30,0x61,0x20,
-	0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x30,0x65,0x81,0x28,0xC2,0xAA,0xFA,0xCA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xEA,0x89,0xEA,0x89,0xF2,0x89,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xDA,0x69,0xDA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x48,0xCA,0x28,0xC2,
-	0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x86,0x91,0x86,0x91,0x86,0x91,0x85,0x91,0x65,0x89,0x65,0x89,
-	0x65,0x81,0x65,0x81,0x65,0x81,0x44,0x71,0x44,0x71,0x44,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x82,0x30,0x61,0x30,0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0xE3,0x50,0xE7,0xB1,0xAA,0xFA,0xCA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,
-	0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x48,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,
-	0x28,0xC2,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xC6,0xB1,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x86,0x91,0x85,0x91,0x86,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x65,0x81,0x44,0x71,0x44,0x71,
-	0x44,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x82,0x30,0x61,0x28,0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x61,0x20,0x85,0x91,0xAA,0xFA,0xCA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xEA,
-	0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xCA,0x28,0xC2,0x28,0xC2,0x28,0xC2,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,
-	0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x65,0x91,0x85,0x91,0x85,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x65,0x81,0x44,0x71,0x04,0x71,0x04,0x71,0x04,0x71,0x24,0x71,0x24,0x71,0x03,0x61,
-	0xE3,0x60,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x61,0x30,0x61,0x20,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x44,0x71,0x89,0xEA,0xAA,0xFA,
-	0x89,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,
-	0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xC2,0x28,0xC2,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x07,0xB2,0xE7,0xB1,0xE7,0xB1,0xC6,0xB1,0xC6,0xB1,
-	0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x65,0x91,0x85,0x91,0x85,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x24,0x79,0x44,0x71,0x04,0x71,0x04,0x71,0x04,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,
-	0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0xA2,0x38,0xA2,0x38,0x61,0x30,0x20,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x58,0x28,0xCA,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,
-	0x48,0xE2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xCA,0x48,0xCA,0x28,0xCA,0x28,0xC2,0xE6,0xC1,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x07,0xB2,0xE7,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xC6,0xA1,
-	0xA6,0xA9,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x65,0x91,0x85,0x91,0x85,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x24,0x79,0x24,0x79,0x04,0x71,0x04,0x71,0x04,0x71,0x24,0x71,0x24,0x71,0x03,0x61,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,
-	0xA2,0x40,0xA2,0x38,0xA2,0x38,0x82,0x30,0x61,0x28,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xC6,0xA1,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x68,0xFA,0x48,0xFA,0x48,0xFA,0x27,0xFA,0x27,0xFA,0x27,0xFA,0x27,0xFA,0x48,0xFA,0x48,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x48,0xFA,0x48,0xFA,0x27,0xFA,0x27,0xFA,0x27,0xFA,0x27,0xFA,0x27,0xFA,0x48,0xFA,0x68,0xFA,0x69,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xF2,0x89,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,
-	0x48,0xD2,0x48,0xD2,0x28,0xCA,0x28,0xCA,0x48,0xCA,0x28,0xCA,0xE6,0xC9,0xE6,0xC1,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xC6,0xA1,0xA6,0xA9,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,
-	0xA6,0x99,0x65,0x91,0x65,0x91,0x85,0x91,0x85,0x91,0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x24,0x79,0x04,0x71,0x04,0x71,0x04,0x71,0x04,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0x82,0x30,0x61,0x30,0x61,0x20,
-	0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x30,0x24,0x79,0xE6,0xC1,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,
-	0x69,0xF2,0x69,0xF2,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xF2,0x48,0xF2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x48,0xEA,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x27,0xDA,0x27,0xDA,0x48,0xD2,0x48,0xCA,0x48,0xCA,
-	0x28,0xCA,0x28,0xC2,0xE6,0xC1,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xC6,0xA1,0xA6,0xA9,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x85,0x91,0x65,0x91,0x65,0x89,0x65,0x89,
-	0x65,0x89,0x65,0x89,0x65,0x81,0x65,0x81,0x24,0x79,0x24,0x79,0x04,0x71,0x04,0x71,0x04,0x71,0x24,0x71,0x03,0x61,0x03,0x61,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xE3,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0x82,0x30,0x61,0x20,0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA2,0x48,0xA6,0xA9,0x89,0xFA,0xA9,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x48,0xFA,0x89,0xFA,0x2C,0xFB,0x50,0xE4,0xF3,0xEC,
-	0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,0x50,0xE4,0x2C,0xFB,0x0B,0xFB,0x48,0xFA,0x27,0xFA,0x48,0xFA,0xEA,0xFA,0x2C,0xFB,0x50,0xE4,0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,0x50,0xE4,0x2C,0xFB,0xAA,0xFA,0x48,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xFA,0x69,0xFA,
-	0x69,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0x48,0xEA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x48,0xEA,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xCA,0x28,0xC2,0xE6,0xC1,0xE6,0xC9,0xE6,0xC9,
-	0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x85,0x91,0x65,0x91,0x65,0x91,0x65,0x89,0x65,0x89,0x65,0x89,0x65,0x81,0x24,0x81,0x24,0x79,
-	0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,0x03,0x61,0x03,0x61,0x03,0x61,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xE3,0x50,0xC2,0x50,0xC3,0x48,0xC3,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0x82,0x30,0x20,0x18,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0x65,0x91,0x89,0xFA,0xA9,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x2C,0xFB,0x50,0xE4,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xDB,0xFE,
-	0xB6,0xF5,0x50,0xE4,0xA9,0xFA,0x27,0xFA,0x89,0xFA,0x2C,0xFB,0xF3,0xEC,0x59,0xF6,0x3D,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0xF3,0xEC,0x2C,0xFB,0x89,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x68,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xEA,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x48,0xD2,0x48,0xCA,0x48,0xCA,0x28,0xCA,0x28,0xC2,0xE6,0xC1,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,
-	0x85,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x85,0x91,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x89,0x65,0x89,0x24,0x81,0x24,0x81,0x24,0x79,0x24,0x79,0x04,0x71,0x24,0x71,0xE3,0x68,0x03,0x61,
-	0x03,0x61,0x03,0x61,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC3,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0x82,0x30,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x10,0x24,0x79,0x48,0xF2,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x27,0xFA,0xCA,0xFA,0x50,0xE4,0xB6,0xF5,0x59,0xF6,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0xB6,0xF5,0x50,0xE4,0x50,0xE4,0x50,0xE4,
-	0xB6,0xF5,0xDB,0xFE,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xDB,0xFE,0xB6,0xF5,0x50,0xE4,0x0B,0xFB,0x27,0xFA,0x68,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,
-	0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xF2,0x69,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,
-	0x48,0xEA,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x27,0xDA,0xE6,0xD9,0xE6,0xD9,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0xE6,0xC9,0xE6,0xC1,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x85,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,
-	0xC6,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x65,0xA1,0x65,0xA1,0x86,0x91,0x85,0x91,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x89,0x65,0x89,0x65,0x89,0x24,0x81,0x24,0x79,0x24,0x79,0x24,0x79,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xE3,0x60,0xE3,0x60,0xE3,0x58,0xE3,0x58,
-	0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0x61,0x28,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x60,0xE6,0xD9,0x48,0xF2,0x69,0xF2,
-	0x69,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x68,0xF2,0x48,0xFA,0x2C,0xFB,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0xB6,0xF5,0x59,0xF6,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x59,0xF6,0x2C,0xFB,0x48,0xFA,0x48,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x69,0xFA,0x68,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x07,0xE2,0x07,0xE2,0x48,0xE2,0x48,0xE2,
-	0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xDA,0x27,0xDA,0x27,0xDA,0x27,0xDA,0xE6,0xD9,0xE6,0xD9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,
-	0xA6,0xA9,0x65,0xA1,0xA6,0xA9,0xA6,0xA9,0x65,0xA1,0x65,0xA1,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x89,0x65,0x89,0x65,0x89,0x65,0x89,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,
-	0xA2,0x48,0xA2,0x40,0xA2,0x38,0x61,0x30,0x61,0x20,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x48,0x65,0xA1,0x27,0xDA,0x68,0xF2,0x68,0xFA,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x48,0xF2,0x89,0xFA,0x2C,0xFB,0xF3,0xEC,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x3D,0xFF,0x3D,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x3D,0xFF,0xF3,0xEC,0x2C,0xFB,0xAA,0xFA,0x48,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x07,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xDA,0x27,0xDA,0x27,0xDA,
-	0x27,0xDA,0x27,0xDA,0xE6,0xD9,0xE6,0xD9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0x85,0xB1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x65,0xA1,0x65,0xA1,0x65,0xA1,0xA6,0x99,
-	0xA6,0x99,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x91,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x79,0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x38,0x61,0x20,0x20,0x10,
-	0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x30,0x04,0x71,0xE6,0xC1,0x68,0xF2,0x68,0xFA,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x27,0xF2,0xAA,0xFA,
-	0x50,0xE4,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x59,0xF6,0xF3,0xEC,0x2C,0xFB,
-	0x27,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x48,0xE2,0x48,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xDA,0x27,0xDA,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xC9,
-	0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0x85,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xC6,0xB1,0xC6,0xB1,0xC6,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x65,0xA1,0x65,0xA1,0x65,0xA1,0xA6,0x99,0xA6,0x99,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x91,
-	0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x38,0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA2,0x40,0xA6,0xA9,0x68,0xFA,0x68,0xFA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x06,0xF2,0xEA,0xFA,0xF3,0xEC,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xB6,0xF5,0x2C,0xFB,0x07,0xF2,0x27,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xEA,0x48,0xEA,0x07,0xE2,0x07,0xE2,0x48,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xDA,0x27,0xDA,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,
-	0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0x85,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0x91,0x65,0x91,0x65,0x91,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,
-	0x24,0x81,0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x60,0xE3,0x60,0xE3,0x60,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x38,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x24,0x89,0x48,0xF2,0x48,0xFA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0xE6,0xF1,0x0B,0xFB,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x2C,0xFB,0xE6,0xF1,0x27,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x48,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0x85,0xC1,0x85,0xC1,0x85,0xC1,0xE6,0xC9,0x85,0xC1,0xE6,0xC1,
-	0xE6,0xC1,0xE6,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0x91,0x65,0x91,0x65,0x91,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,
-	0xE3,0x68,0xE3,0x60,0xE3,0x60,0xE3,0x60,0xE3,0x60,0xE3,0x58,0xE3,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0xA2,0x40,0x61,0x30,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0x71,0x07,0xE2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0xE6,0xF1,0x2C,0xFB,0x59,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x2C,0xFB,0xE6,0xF1,0x27,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xE2,
-	0x07,0xE2,0x48,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,
-	0x85,0xB1,0x85,0xB1,0x85,0xB1,0xC6,0xB1,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0x91,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xE3,0x60,0xE3,0x60,
-	0xE3,0x58,0xC2,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x40,0x61,0x30,0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xE3,0x60,0x85,0xC1,0x07,0xF2,0x48,0xF2,0x48,0xFA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0xE6,0xF1,0x2C,0xFB,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x2C,0xFB,0xE6,0xF1,0x27,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,
-	0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xC9,0xE6,0xC9,0xE6,0xC9,0xA5,0xD1,0xA5,0xD1,0xE6,0xC9,0xE6,0xC9,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0xA6,0xA9,
-	0xA6,0xA9,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0x91,0x65,0x91,0x65,0x91,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xE3,0x60,0xC2,0x58,0xC2,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,
-	0xA2,0x48,0xA2,0x48,0xA2,0x40,0x61,0x20,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x44,0x99,0xE6,0xD9,0x28,0xF2,0x48,0xFA,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0xC6,0xF1,0x2C,0xFB,0x59,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x2C,0xFB,0xE6,0xF1,0x07,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xD9,0xE6,0xD9,
-	0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xC9,0xE6,0xC9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xE6,0xC9,0xE6,0xC9,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x44,0xB1,0x44,0xB1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,
-	0x65,0xA1,0x65,0xA1,0x65,0x91,0x65,0x91,0x65,0x91,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x40,0xA2,0x40,0xA2,0x38,0x20,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE3,0x70,0x85,0xC1,0x27,0xFA,0x48,0xFA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xF2,
-	0xC6,0xF1,0x0B,0xFB,0x59,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x59,0xF6,0x2C,0xFB,0xE6,0xF1,0x07,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xC6,0xE1,0x07,0xE2,0xC6,0xE1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xD9,0xA5,0xD1,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xA5,0xD1,0xA5,0xD1,
-	0xE6,0xC9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x44,0x99,0x65,0x91,0x44,0x99,
-	0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x79,0x04,0x71,0x04,0x71,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x50,0xC2,0x50,0xA2,0x48,0xA2,0x40,0xA2,0x38,0x61,0x28,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x38,0x65,0xA1,0x27,0xFA,0x27,0xFA,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0xC6,0xF1,0xAA,0xFA,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xB6,0xF5,0x2C,0xFB,0xC6,0xF1,0x06,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xD9,0xA5,0xD1,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xA5,0xD1,0xA5,0xD1,0xE6,0xC9,0xE6,0xC9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,
-	0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0x24,0x81,
-	0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x79,0x04,0x71,0xE3,0x70,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x40,0x61,0x30,0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x24,0x91,0x27,0xF2,0x07,0xFA,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0xE6,0xF1,0x89,0xFA,0x50,0xE4,0xB6,0xF5,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x59,0xF6,0xF3,0xEC,0xAA,0xFA,0xC6,0xF1,0x06,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xF1,0x07,0xE2,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xE6,0xD9,0xE6,0xD9,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xD9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,
-	0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xB1,0x44,0xB1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x79,0x04,0x71,
-	0xE3,0x70,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x60,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x40,0x61,0x20,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xE3,0x80,0xC6,0xE1,0x06,0xF2,0x27,0xF2,0x27,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xF1,0x27,0xF2,0xCA,0xFA,0x50,0xE4,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xF3,0xEC,0xCA,0xFA,0x28,0xF2,0xE6,0xF1,0x06,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xC6,0xF1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xE6,0xD9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xB1,
-	0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x81,0xE3,0x80,0xE3,0x70,0xE3,0x70,0xA2,0x70,0xA2,0x68,0xA2,0x68,0xE3,0x68,
-	0xE3,0x60,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x40,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x68,0x85,0xC1,0xC6,0xE1,0x07,0xFA,0x07,0xFA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xFA,0x2C,0xFB,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0x2C,0xFB,0x07,0xFA,0x07,0xFA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xF9,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xF1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,
-	0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x44,0xC1,0x44,0xB1,0x85,0xB1,0x85,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,
-	0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x81,0xE3,0x80,0xE3,0x70,0xE3,0x70,0xE3,0x68,0xA2,0x68,0xA2,0x68,0xE3,0x68,0xA2,0x68,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x50,
-	0xA2,0x48,0xA2,0x40,0x61,0x30,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x50,
-	0x24,0x91,0xA5,0xD1,0x07,0xFA,0x07,0xFA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xF9,0x68,0xF2,0x2C,0xFB,0xF3,0xEC,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xB6,0xF5,0x2C,0xFB,0x89,0xFA,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xF1,0x07,0xF2,0xE6,0xF1,0xC6,0xF1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,
-	0x85,0xD9,0x85,0xD9,0x85,0xD9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x44,0xA9,0x44,0xA9,0x44,0xA9,
-	0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0xE3,0x80,0xE3,0x80,0x24,0x81,0x24,0x81,0xE3,0x80,0xE3,0x70,0xE3,0x70,0xE3,0x70,0xE3,0x68,0xE3,0x68,0xA2,0x68,0xA2,0x68,0xC2,0x58,0xC2,0x58,0x81,0x58,0x81,0x58,0xA2,0x48,0x61,0x30,0x20,0x18,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x28,0xA2,0x68,0x85,0xC1,0x07,0xFA,0x07,0xFA,0x06,0xF2,
-	0x06,0xF2,0x06,0xF2,0x06,0xF2,0xE6,0xF1,0xE6,0xF1,0x06,0xF2,0x28,0xF2,0x2C,0xFB,0xB6,0xF5,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0x50,0xE4,
-	0x48,0xF2,0x06,0xF2,0xE6,0xF1,0xE6,0xF1,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,
-	0x06,0xF2,0x06,0xF2,0x06,0xF2,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xF1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xF1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,
-	0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0x99,0x44,0xA9,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,
-	0x44,0x99,0x44,0x99,0x24,0x91,0x24,0x91,0x24,0x89,0x24,0x89,0xE3,0x80,0xE3,0x80,0x24,0x81,0xE3,0x80,0xE3,0x80,0xE3,0x70,0xE3,0x70,0xE3,0x70,0xE3,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xC2,0x58,0xC2,0x58,0x81,0x58,0x81,0x58,0x81,0x50,0x20,0x28,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x30,0x44,0xA9,0xE6,0xF9,0xC6,0xF9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0x27,0xF2,0xEA,0xFA,0xF3,0xEC,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xF3,0xEC,0x2C,0xFB,0x48,0xF2,0xE6,0xF1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xE9,0x85,0xE9,0xC6,0xE1,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,
-	0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0x99,0x44,0x99,0x44,0x99,0x03,0x99,0x03,0x99,0x24,0x91,0x24,0x91,0x24,0x89,
-	0x24,0x89,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x70,0xE3,0x70,0xE3,0x68,0xA2,0x68,0xA2,0x68,0x81,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0x81,0x58,0x81,0x58,0x81,0x50,0x20,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x24,0x91,0xC6,0xF1,0xC6,0xF9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xF1,0xA5,0xF1,0xC6,0xF9,0x0B,0xFB,
-	0xF3,0xEC,0xDB,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0xB6,0xF5,0x2C,0xFB,0xE6,0xF1,0x85,0xF1,0xA5,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xC6,0xF1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xE9,0x85,0xE9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0x65,0xD1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x85,0xC1,0x44,0xC1,
-	0x44,0xB1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x03,0x99,0x03,0x99,0x24,0x91,0x24,0x91,0x24,0x89,0x03,0x89,0xE3,0x80,0xE3,0x80,0xE2,0x80,0xE3,0x80,
-	0xE3,0x80,0xE3,0x70,0xE3,0x70,0xE3,0x68,0xA2,0x68,0xA2,0x68,0x81,0x58,0x81,0x58,0xC2,0x58,0xC2,0x58,0x81,0x58,0x81,0x50,0x61,0x30,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xE3,0x80,0x85,0xD9,0xC6,0xF1,0xC6,0xF9,0xC6,0xF9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xF1,0xC6,0xF1,0xE6,0xF1,0x69,0xFA,0x50,0xE4,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xF3,0xEC,0x89,0xFA,0xE6,0xF1,0xC6,0xF1,0xA5,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x85,0xC1,0x85,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,
-	0x44,0xC1,0x44,0xB1,0x44,0xB1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x03,0xA1,0x03,0xA1,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x24,0x91,0x24,0x91,0x03,0x89,0x03,0x89,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x70,0xE3,0x70,0xE3,0x68,0xA2,0x68,
-	0xA2,0x68,0x81,0x58,0x81,0x58,0x81,0x58,0x81,0x58,0x81,0x58,0x61,0x38,0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x68,0x44,0xC1,0x85,0xE9,0xC6,0xF9,0xC6,0xF9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xAA,0xFA,0xF3,0xEC,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0xF3,0xEC,0x2C,0xFB,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,
-	0x85,0xE9,0x85,0xD9,0x64,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x85,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xB1,0x44,0xA9,
-	0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x03,0xA1,0x03,0xA1,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x24,0x91,0x24,0x91,0x03,0x89,0x03,0x89,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE2,0x80,0xE2,0x80,0xE3,0x70,0xE3,0x70,0xE3,0x68,0xA2,0x68,0xA2,0x68,0x81,0x58,0x81,0x58,0x81,0x58,0x81,0x58,
-	0x81,0x50,0x61,0x30,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x50,0xC2,0x90,0x65,0xD1,0xC6,0xF9,0xC6,0xF9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xF1,0xC6,0xF1,0x07,0xF2,0x50,0xE4,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,
-	0x50,0xE4,0x48,0xF2,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,
-	0x85,0xD9,0x85,0xD9,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x24,0xC9,0x24,0xC9,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,
-	0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0x99,0x03,0x99,0x03,0x99,0xE3,0x98,0x24,0x91,0x24,0x91,0x03,0x89,0x03,0x89,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE2,0x80,0xC2,0x78,0xA2,0x70,0xE3,0x70,0xE3,0x68,0xA2,0x68,0xA2,0x68,0x81,0x58,0x81,0x58,0x81,0x58,0x81,0x58,0x81,0x50,0x20,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x28,0x81,0x58,
-	0x44,0xC1,0xC6,0xF9,0xC6,0xF9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x84,0xF1,0x64,0xF1,0x68,0xF2,0x50,0xE4,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0x50,0xE4,0xAA,0xFA,0x64,0xF1,0x64,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x64,0xD9,0x64,0xD9,0x65,0xD1,0x65,0xD1,0x65,0xD1,
-	0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x24,0xC9,0x24,0xC9,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x23,0xB1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0x99,
-	0x03,0x99,0x03,0x99,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x03,0x89,0x03,0x89,0x03,0x89,0xE2,0x80,0xE2,0x80,0xE3,0x80,0xE2,0x80,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xA2,0x68,0xA2,0x68,0x81,0x58,0x81,0x58,0x81,0x58,0x81,0x50,0x61,0x30,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x30,0x23,0xB1,0xA5,0xF9,0xA5,0xF9,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x84,0xF1,0xA5,0xF1,0x2C,0xFB,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0x50,0xE4,0xE6,0xF1,0x84,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x64,0xD9,0x64,0xD9,0x44,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,
-	0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x24,0xC9,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xB1,0x44,0xA9,0x44,0xA9,0x44,0xA9,0x23,0xB1,0x23,0xB1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0x99,0x03,0x99,0x03,0x99,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,
-	0xE3,0x98,0x03,0x89,0x03,0x89,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xA2,0x68,0xA2,0x68,0x81,0x58,0xA2,0x68,0xA2,0x68,0x61,0x38,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0xE3,0x98,0x85,0xF1,0xA5,0xF9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x64,0xF1,0x43,0xF1,0x27,0xF2,0x2C,0xFB,0xF3,0xEC,0xDB,0xFE,0x3D,0xFF,0xDB,0xFE,0xB6,0xF5,0x50,0xE4,0x68,0xF2,0x44,0xF1,0x44,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x44,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xC1,
-	0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0x99,0x03,0x99,0x03,0x99,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xC2,0x90,0x03,0x89,0x03,0x89,0xE2,0x80,0xE2,0x80,
-	0xE2,0x80,0xE2,0x80,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xA2,0x68,0xA2,0x68,0x81,0x58,0x81,0x58,0x81,0x50,0x20,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xE2,0x80,0x64,0xD9,0x85,0xF1,0xA5,0xF9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0x84,0xF1,0x84,0xF1,0x2C,0xFB,0xF3,0xEC,0xB6,0xF5,0xF3,0xEC,0x2C,0xFB,0xA5,0xF1,0x64,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x65,0xD1,0x65,0xD1,0x65,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,
-	0x44,0xC1,0x44,0xC1,0x44,0xC1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0x03,0x99,0x03,0x99,0x03,0x99,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x03,0x89,0x03,0x89,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xC2,0x78,0xA2,0x70,0xA2,0x70,
-	0xA2,0x70,0xA2,0x68,0xA2,0x68,0xA2,0x68,0x81,0x50,0x61,0x30,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xA2,0x68,0xE2,0xB8,0x65,0xE9,0x85,0xF9,0x85,0xF9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x64,0xF1,0x43,0xF1,0x07,0xF2,
-	0x2C,0xFB,0x2C,0xFB,0x2C,0xFB,0x48,0xF2,0x44,0xF1,0x44,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,
-	0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x65,0xD1,0x65,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x23,0xB1,0x23,0xB1,
-	0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0x03,0x99,0x03,0x99,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x03,0x89,0x03,0x89,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xA2,0x68,0xA2,0x68,0xA2,0x68,0x81,0x50,
-	0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x38,0xC2,0x88,0x44,0xD1,0x85,0xF9,0x85,0xF9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,
-	0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x65,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,
-	0x23,0xB1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0xE2,0xA0,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x03,0x89,0x03,0x89,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xA2,0x68,0xA2,0x68,0xA2,0x68,0x61,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x18,0x81,0x58,0x44,0xC1,0x85,0xF9,0x85,0xF9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x64,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x64,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x44,0xD1,0x44,0xD1,0x44,0xD1,
-	0x44,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xC1,0x03,0xC1,0x03,0xC1,0x44,0xC1,0x44,0xC1,0x03,0xC1,0x03,0xC1,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0x03,0xA1,0xE2,0xA0,
-	0xE2,0xA0,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x03,0x89,0xC2,0x88,0xE2,0x80,0xE2,0x80,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xA2,0x70,0x81,0x58,0xA2,0x40,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x30,0x23,0xB1,
-	0x85,0xF9,0x85,0xF9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,
-	0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xC1,0x03,0xC1,0x03,0xC1,0x44,0xC1,0x44,0xC1,0xE2,0xB8,0xE2,0xB8,0x44,0xC1,0x44,0xC1,0x44,0xC1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0xE2,0xA0,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,
-	0xE3,0x98,0xE3,0x98,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xE2,0x80,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xA2,0x70,0x81,0x50,0x61,0x20,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x03,0x99,0x85,0xF1,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x03,0xC1,
-	0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0x44,0xC1,0x44,0xC1,0xE2,0xB8,0x23,0xB1,0xE2,0xB0,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x03,0xA1,0xE2,0xA0,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,
-	0xC2,0x88,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x68,0x61,0x38,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xE2,0x80,0x44,0xD1,0x64,0xF1,0x64,0xF9,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,
-	0xE2,0xB8,0xE2,0xB8,0x44,0xC1,0x44,0xC1,0x23,0xB1,0xE2,0xB0,0xE2,0xB0,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0xE2,0xA0,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,
-	0xC2,0x78,0xA2,0x70,0xA2,0x68,0x81,0x50,0x20,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xA2,0x68,0xE2,0xB0,0x44,0xE1,0x64,0xF9,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,
-	0x23,0xE9,0x23,0xE9,0x23,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,
-	0xE2,0xB0,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0xE2,0xA0,0xE2,0xA0,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xA2,0x70,0x81,0x58,0x20,0x28,0x00,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x38,0xC2,0x88,0x44,0xD1,0x64,0xF9,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x44,0xE1,0x44,0xE1,
-	0x44,0xE1,0x44,0xE1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0x23,0xB1,0x23,0xB1,0x23,0xB1,0x23,0xB1,0xE2,0xB0,
-	0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0xC2,0xA0,0xE2,0xA0,0xE2,0xA0,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xA2,0x70,0xA2,0x68,0x81,0x50,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x81,0x58,0x03,0xC1,0x64,0xF9,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x23,0xE1,0x23,0xE1,
-	0x23,0xE1,0x23,0xE1,0x44,0xD1,0x44,0xD1,0x24,0xC9,0x24,0xC9,0x02,0xC9,0x24,0xC9,0x24,0xC9,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0x23,0xB1,0x23,0xB1,0x23,0xB1,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0x03,0xA1,0x03,0xA1,
-	0xE2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xA0,0xE2,0xA0,0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xA2,0x70,0x81,0x50,0x20,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x30,0xE2,0xB8,0x43,0xF9,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x44,0xD1,0x24,0xC9,
-	0x02,0xC9,0x02,0xC9,0x24,0xC9,0x24,0xC9,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0x03,0xA1,0xE2,0xA0,0xE2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xA0,
-	0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0x81,0x58,0x61,0x30,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0xE2,0xB0,0x43,0xF9,
-	0x43,0xF9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,0x23,0xE1,0x23,0xE9,0x23,0xE1,0x23,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,
-	0x02,0xC9,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xA0,0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,
-	0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xA2,0x70,0x81,0x50,0x20,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC2,0x88,0x23,0xE1,0x44,0xF1,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,
-	0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,
-	0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x44,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,
-	0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xA0,0xE3,0x98,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x78,0xC2,0x78,
-	0xA2,0x70,0x81,0x58,0x61,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x38,0xC2,0x88,0x02,0xC9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,
-	0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,
-	0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF9,0x64,0xF9,0x64,0xF9,0x64,0xF9,0x64,0xF9,0x43,0xF9,0x43,0xF9,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x44,0xF1,0x64,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,0x44,0xF1,0x44,0xF1,0x23,0xE9,0x23,0xE9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x03,0xC1,0x03,0xC1,
-	0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xC2,0xA0,0xE2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xA2,0x68,0x61,0x30,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x61,0x38,0xC2,0x90,0x03,0xC1,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,
-	0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,
-	0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,
-	0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB0,0xE2,0xB0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xA0,0xC2,0x90,0xE2,0xA0,0xE2,0xA0,0xE2,0xA0,0xE2,0xA0,0xE2,0xA0,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,
-	0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x90,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x88,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xA2,0x68,0xA2,0x68,0x81,0x50,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x28,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,
-	0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,
-	0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x20,0x28,0x20,0x28,0x20,0x28,
-	0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,0x20,0x28,
-	0x20,0x28,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,
-	0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,
-	0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x82,0x30,0x82,0x30,0x82,0x30,
-	0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,
-	0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,
-	0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,
-	0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,
-	0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0x61,0x28,0x61,0x20,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x10,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x30,0x82,0x30,0xA2,0x38,
-	0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x58,0xE3,0x58,0xE3,0x58,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x65,0x81,0x65,0x81,
-	0x65,0x89,0x65,0x89,0x65,0x89,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xE7,0xB1,0xE7,0xB1,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xCA,
-	0x48,0xCA,0x48,0xCA,0x48,0xCA,0x48,0xCA,0x48,0xCA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,
-	0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,
-	0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,
-	0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,
-	0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x07,0xB2,0x86,0x91,0xE3,0x50,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x10,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x82,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x50,
-	0xE3,0x50,0xE3,0x58,0xE3,0x58,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x24,0x79,0x24,0x79,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x85,0x91,0x85,0x91,0x85,0x91,0x86,0x91,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xE7,0xB1,0xE7,0xB1,0x07,0xB2,0x07,0xB2,0x07,0xB2,
-	0x07,0xB2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xEA,0xFA,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,
-	0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,
-	0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,
-	0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,
-	0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,
-	0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0x0B,0xFB,0xAA,0xFA,0x48,0xD2,0x65,0x89,0x61,0x30,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x20,0x10,0x20,0x18,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x82,0x30,0x82,0x30,0x61,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x60,
-	0x03,0x61,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x04,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0xA6,0x99,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x07,0xB2,
-	0x28,0xC2,0x48,0xCA,0x28,0xCA,0x28,0xCA,0x28,0xCA,0x48,0xCA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x69,0xDA,0x89,0xE2,0x89,0xE2,0x89,0xEA,0x89,0xEA,0x89,0xEA,0x89,0xEA,0x89,0xEA,0x89,0xEA,0x89,0xEA,0xAA,0xEA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xAA,0xFA,0x28,0xC2,0x44,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x10,0x20,0x18,
-	0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x58,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,
-	0x24,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0xA6,0x99,0xA6,0x99,0xC6,0xA1,0xC6,0xA1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,
-	0x28,0xC2,0x48,0xCA,0x48,0xD2,0x48,0xD2,0x48,0xD2,0x69,0xDA,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xEA,0x89,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xEA,0xFA,0x89,0xE2,0xC6,0xA1,0xC3,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x10,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,
-	0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0x61,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x44,0x71,
-	0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0xA6,0x99,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xCA,0x48,0xD2,0x48,0xD2,0x48,0xD2,
-	0x69,0xDA,0x48,0xD2,0x48,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xF2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0x89,0xF2,0x28,0xC2,0x03,0x61,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0x82,0x30,
-	0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x04,0x71,0x44,0x71,0x44,0x71,0x44,0x71,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,
-	0x65,0x89,0x85,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0x86,0x91,0xA6,0x99,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0x07,0xB2,0x07,0xB2,0x07,0xB2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xCA,0x48,0xD2,0x27,0xDA,0x27,0xDA,0x48,0xD2,0x27,0xDA,0x27,0xDA,0x48,0xE2,0x89,0xE2,
-	0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xEA,0x89,0xF2,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,
-	0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xCA,0xFA,0xAA,0xFA,0x89,0xE2,0x24,0x79,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x20,0x18,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,
-	0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x04,0x71,0x24,0x71,0x44,0x71,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x86,0x91,0x86,0x91,
-	0x86,0x91,0xA6,0x99,0xA6,0x99,0xC6,0xA1,0xC6,0xA1,0xC6,0xA1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0x07,0xB2,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xCA,0x48,0xD2,0x27,0xDA,0x27,0xDA,0x48,0xD2,0x27,0xDA,0x27,0xDA,0x48,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xE2,0x89,0xEA,0x89,0xF2,0x89,0xF2,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xCA,0xFA,0xAA,0xFA,0x85,0x91,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x20,0x18,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0x61,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,
-	0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x04,0x71,0x04,0x71,0x44,0x71,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x85,0x91,0x85,0x91,0x86,0x91,0xA6,0x99,0xA6,0x99,0xC6,0xA1,0xC6,0xA1,
-	0xC6,0xA1,0xE7,0xB1,0xE7,0xB1,0xE7,0xB1,0x07,0xB2,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x28,0xC2,0x48,0xD2,0x4D,0xD3,0x4D,0xD3,0x50,0xE4,0x50,0xE4,0x50,0xE4,0x4D,0xD3,0xAA,0xEA,0x48,0xEA,0x48,0xEA,0x89,0xE2,0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xCA,0xFA,0xCA,0xFA,0xA6,0xA9,0xA2,0x38,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x20,0x18,0x61,0x20,0x61,0x28,0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x58,
-	0xE3,0x58,0xE3,0x60,0xE3,0x60,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x04,0x71,0x04,0x71,0x44,0x71,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x85,0x91,0x65,0x91,0x86,0x91,0xA6,0x99,0xA6,0x99,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xA6,0xA9,0xC6,0xB1,0xE7,0xB1,0x07,0xB2,
-	0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0x28,0xC2,0x28,0xC2,0x48,0xCA,0x69,0xDA,0x50,0xE4,0x59,0xF6,0x3D,0xFF,0xBE,0xFF,0xDB,0xFE,0xB6,0xF5,0x50,0xE4,0x89,0xE2,0x48,0xEA,0x89,0xE2,0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xCA,0xFA,0xAA,0xFA,0x28,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x61,0x20,0x61,0x28,0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0x82,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x60,0xE3,0x60,0x03,0x61,0x03,0x61,
-	0x03,0x61,0x24,0x71,0x24,0x71,0x04,0x71,0x04,0x71,0x44,0x71,0x24,0x79,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x85,0x91,0x65,0x91,0x86,0x91,0xA6,0x99,0xA6,0x99,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xA6,0xA9,0xA6,0xA9,0x85,0xB1,0x85,0xB1,0x85,0xB1,0x85,0xB1,0xC6,0xB1,0xE6,0xC1,0xE6,0xC1,
-	0xE6,0xC9,0xE6,0xC1,0x4D,0xD3,0x50,0xE4,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xF3,0xEC,0x2C,0xFB,0xAA,0xEA,0x89,0xE2,0x89,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0x99,0xC3,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
-	0x61,0x20,0x61,0x28,0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0x61,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x60,0xE3,0x60,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x04,0x71,0x04,0x71,
-	0x04,0x71,0x24,0x79,0x24,0x79,0x65,0x81,0x65,0x81,0x65,0x81,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x85,0x91,0x65,0x91,0x86,0x91,0xA6,0x99,0xA6,0x99,0xA6,0xA9,0xC6,0xA1,0xC6,0xA1,0xA6,0xA9,0xC6,0xB1,0x85,0xB1,0x85,0xB1,0xC6,0xB1,0xC6,0xB1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC1,0xE6,0xC9,0xE6,0xC1,0x4D,0xD3,0x59,0xF6,0xBE,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0xF3,0xEC,0x2C,0xFB,0x89,0xE2,0x48,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xF2,0x28,0xCA,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x20,0x18,0x61,0x28,0x61,0x28,0x61,0x30,
-	0x82,0x30,0x61,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xC3,0x48,0xC3,0x48,0xC3,0x48,0xC2,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x60,0xE3,0x60,0x03,0x61,0x03,0x61,0x03,0x61,0x24,0x71,0x24,0x71,0x24,0x71,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x65,0x81,
-	0x65,0x81,0x65,0x89,0x65,0x89,0x85,0x91,0x86,0x91,0x85,0x91,0x65,0x91,0x86,0x91,0xA6,0x99,0xA6,0x99,0xA6,0x99,0x44,0x99,0x65,0xA1,0xA6,0xA9,0x28,0xC2,0x4D,0xD3,0x4D,0xD3,0x50,0xE4,0x4D,0xD3,0x4D,0xD3,0x48,0xCA,0xE6,0xC1,0x85,0xC1,0x85,0xC1,0x4D,0xD3,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x3D,0xFF,0xB6,0xF5,0x50,0xE4,0x89,0xE2,0x48,0xEA,0x48,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xEA,0x24,0x79,0x00,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x61,0x20,0x61,0x28,0x61,0x30,0x82,0x30,0x61,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,
-	0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xC3,0x48,0xC3,0x48,0xC2,0x50,0xC2,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x60,0x03,0x61,0x03,0x61,0x03,0x61,0xE3,0x68,0xE3,0x68,0x24,0x71,0x24,0x71,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x65,0x89,0x85,0x91,0x86,0x91,
-	0x85,0x91,0x65,0x91,0x86,0x91,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xA6,0x99,0xE7,0xB1,0x28,0xC2,0x4D,0xD3,0xF3,0xEC,0x59,0xF6,0xDB,0xFE,0x59,0xF6,0xF3,0xEC,0x4D,0xD3,0x48,0xCA,0xE6,0xC1,0xE6,0xC1,0x4D,0xD3,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xB6,0xF5,0x50,0xE4,0x89,0xE2,0x48,0xEA,
-	0x48,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xA9,0xFA,0x89,0xFA,0x65,0x91,0x61,0x20,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x18,0x61,0x28,0x82,0x30,0x82,0x30,0x61,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,
-	0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xE3,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x60,0x03,0x61,0x03,0x61,0x03,0x61,0xE3,0x68,0xE3,0x68,0x24,0x71,0x24,0x71,0x24,0x71,0x44,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x65,0x89,0x85,0x91,0x85,0x91,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x91,0xC6,0xA1,
-	0x28,0xC2,0x4D,0xD3,0x50,0xE4,0xF3,0xEC,0xB6,0xF5,0xDB,0xFE,0xBE,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0xB6,0xF5,0xF3,0xEC,0x50,0xE4,0x4D,0xD3,0x50,0xE4,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0xF3,0xEC,0x4D,0xD3,0x48,0xEA,0x28,0xF2,0x48,0xF2,0x89,0xF2,0x89,0xF2,0x69,0xFA,0x69,0xFA,
-	0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xA9,0xFA,0x89,0xFA,0xC6,0xB1,0xC2,0x50,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x61,0x20,0x61,0x30,0x82,0x30,0x61,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xE3,0x50,
-	0xE3,0x50,0xE3,0x58,0xE3,0x58,0xE3,0x60,0x03,0x61,0x03,0x61,0x03,0x61,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0x24,0x71,0x44,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x65,0x89,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x91,0x65,0x91,0x86,0x91,0x28,0xC2,0x50,0xE4,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0xB6,0xF5,0xF3,0xEC,0xB6,0xF5,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xF6,0x50,0xE4,0xAA,0xEA,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x68,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xFA,0x69,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xE6,0xC9,0x24,0x79,0x61,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x61,0x20,0x61,0x28,0x82,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x60,0xE3,0x60,
-	0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x65,0x89,0x65,0x89,0x65,0x89,0x24,0x89,0x85,0x91,0x07,0xB2,0x4D,0xD3,0xF3,0xEC,0x59,0xF6,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x3D,0xFF,0x3D,0xFF,0xBE,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0xDB,0xFE,0xDB,0xFE,0xDB,0xFE,0xDB,0xFE,0xDB,0xFE,0xDB,0xFE,0x59,0xF6,0xB6,0xF5,0x50,0xE4,0xAA,0xEA,0x89,0xE2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x69,0xF2,0x69,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,
-	0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,
-	0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,
-	0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,
-	0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,
-	0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x69,0xFA,0x48,0xE2,0xC6,0xB1,0xC2,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x61,0x20,0x61,0x30,0x82,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xE3,0x50,0xE3,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,
-	0xE3,0x68,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x65,0x89,0x65,0x89,0x65,0x89,0x24,0x89,0x86,0x91,0x4D,0xD3,0xF3,0xEC,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0xB6,0xF5,0xB6,0xF5,0x59,0xF6,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0xB6,0xF5,0xF3,0xEC,0x50,0xE4,0x50,0xE4,0xAA,0xEA,0x07,0xE2,0x07,0xE2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x68,0xF2,0x69,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xFA,0x69,0xF2,0x68,0xF2,0x27,0xDA,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x20,0x10,0x61,0x28,0x61,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xE3,0x50,0xE3,0x58,0xC2,0x58,0xE3,0x60,0x03,0x61,0x03,0x61,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,
-	0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x24,0x89,0x65,0x89,0x65,0x91,0x24,0x89,0x86,0x91,0x48,0xCA,0x50,0xE4,0xDB,0xFE,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0xF3,0xEC,0x50,0xE4,0x4D,0xD3,0x4D,0xD3,0x4D,0xD3,0x4D,0xD3,0x50,0xE4,0xB6,0xF5,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0xF3,0xEC,0x4D,0xD3,
-	0x69,0xDA,0x69,0xDA,0x48,0xE2,0x07,0xE2,0x07,0xE2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xFA,
-	0x48,0xF2,0x24,0x79,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x18,0x61,0x28,
-	0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xE3,0x50,0xE3,0x58,0xC2,0x58,0xC2,0x58,0x03,0x61,0x03,0x61,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x24,0x89,
-	0x24,0x91,0x65,0x91,0x24,0x89,0x85,0x91,0x07,0xB2,0x4D,0xD3,0xB6,0xF5,0xDB,0xFE,0xB6,0xF5,0x50,0xE4,0x69,0xDA,0xE7,0xB1,0xA6,0xA9,0x65,0xA1,0x44,0xA9,0xC6,0xB1,0x4D,0xD3,0xF3,0xEC,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xF3,0xEC,0x69,0xDA,0xE6,0xD9,0xC6,0xE1,0x07,0xE2,0x48,0xE2,0x07,0xE2,
-	0x07,0xE2,0x48,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,
-	0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x68,0xF2,0x88,0xFA,0x68,0xF2,0x65,0x91,0x82,0x30,0x00,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x18,0x61,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x38,0xA2,0x40,
-	0xA2,0x40,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xE3,0x58,0xE3,0x58,0xC2,0x58,0xC2,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x85,0x91,0xC6,0xA1,
-	0x07,0xB2,0x4D,0xD3,0x4D,0xD3,0x4D,0xD3,0x28,0xC2,0xE7,0xB1,0xA6,0xA9,0xA6,0xA9,0x44,0xA9,0x03,0xA1,0x07,0xB2,0x50,0xE4,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xF6,0x50,0xE4,0x69,0xDA,0xC6,0xE1,0xE6,0xD9,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x68,0xFA,0x48,0xF2,0x85,0xB1,0xE3,0x60,0x61,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x61,0x20,0x61,0x30,0xA2,0x38,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,
-	0xC2,0x50,0xC2,0x50,0xC2,0x50,0xE3,0x50,0xE3,0x58,0xC2,0x58,0xC2,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x91,0x65,0x91,0x85,0x91,0x85,0x91,0x24,0x89,0x24,0x91,0x65,0x91,0x65,0x91,
-	0xA6,0x99,0xA6,0xA9,0x85,0xB1,0xC6,0xB1,0x07,0xB2,0x4D,0xD3,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xB6,0xF5,0x4D,0xD3,0x07,0xE2,0x85,0xD9,0x07,0xE2,0x07,0xE2,0x48,0xEA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xFA,0x48,0xF2,0xE6,0xC9,0x24,0x91,0x61,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x20,0xA2,0x38,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x81,0x50,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC2,0x58,
-	0xC2,0x58,0xC2,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x91,0x24,0x91,0x65,0x91,0x65,0x91,0x44,0x99,0x44,0x99,0x44,0x99,0x65,0xA1,0xA6,0xA9,0xA6,0xA9,0x44,0xA9,0x28,0xC2,0x50,0xE4,
-	0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x3D,0xFF,0x50,0xE4,0xE6,0xD9,0x65,0xD1,0x85,0xD9,0x48,0xEA,0x89,0xEA,0x48,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xFA,0x48,0xF2,0x48,0xEA,0x85,0xC1,0xC2,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x82,0x30,0xA2,0x38,0xA2,0x40,0x81,0x50,0x81,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x50,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x68,
-	0xE3,0x68,0xE3,0x68,0xE3,0x68,0x04,0x71,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x91,0x65,0x91,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0xC6,0xB1,0x07,0xB2,0x4D,0xD3,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xF5,0x4D,0xD3,0xAA,0xEA,0xAA,0xEA,0x2C,0xFB,0x50,0xE4,0x2C,0xFB,0x2C,0xFB,0x89,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xFA,0x07,0xE2,0xE3,0x60,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x61,0x28,0xA2,0x40,0xA2,0x40,0x81,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x50,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0x04,0x71,0x04,0x71,
-	0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x91,0x65,0x91,0x44,0x99,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x65,0xA1,0x03,0xA1,0x07,0xB2,0x50,0xE4,0x59,0xF6,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0x59,0xF6,0x59,0xF6,0xDB,0xFE,0xDB,0xFE,0xDB,0xFE,0x59,0xF6,0x2C,0xFB,0xE6,0xF1,0x07,0xF2,0x28,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xFA,0x28,0xF2,0x24,0x81,0x61,0x20,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x82,0x30,0x61,0x38,0x81,0x50,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x70,0x04,0x71,0x24,0x79,0x24,0x79,0x24,0x79,0x24,0x81,0x24,0x81,
-	0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x91,0x65,0x91,0x44,0x99,0x65,0xA1,0x65,0xA1,0x44,0x99,0x65,0xA1,0xC6,0xB1,0x4D,0xD3,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0xDB,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x50,0xE4,0xC6,0xF1,0xE6,0xF1,0x28,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xFA,0x28,0xF2,
-	0x65,0xA1,0xA2,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x20,0x10,0x61,0x30,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x70,0xE3,0x70,0xE3,0x70,0xE3,0x80,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,
-	0x24,0x91,0x24,0x91,0x44,0x99,0x44,0x99,0x44,0x99,0x03,0x99,0xA6,0xA9,0x4D,0xD3,0xF3,0xEC,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xB6,0xF5,0x4D,0xD3,0x50,0xE4,0xB6,0xF5,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xB6,0xF5,
-	0x2C,0xFB,0xC6,0xF1,0xC6,0xF1,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xFA,0x27,0xF2,0x85,0xC1,0xE3,0x80,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x20,0x61,0x38,0xA2,0x40,
-	0xA2,0x48,0xA2,0x48,0xA2,0x48,0xA2,0x48,0xC2,0x50,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xE3,0x60,0xE3,0x60,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x70,0xE3,0x70,0xC2,0x78,0xE3,0x80,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x89,0x24,0x91,0x24,0x91,0x44,0x99,0x44,0x99,0x44,0x99,
-	0xE3,0x98,0xC6,0xA1,0x50,0xE4,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0x59,0xF6,0x50,0xE4,0xA5,0xD1,0x48,0xD2,0x50,0xE4,0xB6,0xF5,0x3D,0xFF,0x3D,0xFF,0x3D,0xFF,0xDB,0xFE,0xDB,0xFE,0xDB,0xFE,0x59,0xF6,0xF3,0xEC,0x50,0xE4,0xAA,0xEA,0xC6,0xF1,0xC6,0xF1,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,
-	0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x07,0xFA,0x07,0xF2,0xE6,0xD9,0x44,0xA9,0x61,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x10,0x61,0x38,0x81,0x50,0x81,0x50,0xA2,0x48,0xA2,0x48,0xC2,0x50,
-	0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0x81,0x58,0xA2,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x70,0xE3,0x70,0xE3,0x80,0xE3,0x80,0x24,0x79,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x91,0x24,0x91,0x24,0x91,0x44,0x99,0x44,0x99,0x44,0x99,0x03,0x99,0xE7,0xB1,0x50,0xE4,0x59,0xF6,0xBE,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xF6,0x4D,0xD3,0xE6,0xC9,0xA5,0xD1,0xA5,0xD1,0xE6,0xD9,0x4D,0xD3,0xF3,0xEC,0xF3,0xEC,0x50,0xE4,0x50,0xE4,0x2C,0xFB,0x2C,0xFB,0xAA,0xEA,0x89,0xEA,0x89,0xF2,0x28,0xF2,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xA5,0xD1,0xC2,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x28,0x61,0x38,0xA2,0x48,0xC2,0x50,0xA2,0x48,0xC2,0x50,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0x81,0x58,
-	0xA2,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x70,0xE3,0x70,0xE3,0x80,0xE3,0x80,0x04,0x71,0x24,0x79,0x24,0x81,0x24,0x81,0x24,0x81,0x24,0x89,0x24,0x89,0x24,0x91,0x24,0x91,0x24,0x91,0x44,0x99,0x44,0x99,0x44,0x99,0x03,0x99,0xE7,0xB1,0x4D,0xD3,0xF3,0xEC,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x59,0xF6,0x69,0xDA,0x44,0xC1,0xA5,0xD1,0x24,0xC9,0x24,0xC9,0x48,0xD2,0x4D,0xD3,0x4D,0xD3,0x89,0xEA,0x48,0xEA,0x07,0xE2,0x85,0xD9,0x44,0xE1,0x65,0xE9,0xA5,0xF1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x27,0xFA,0x07,0xE2,0xE3,0x68,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x18,0x61,0x38,0xC2,0x50,0xA2,0x48,0xC2,0x50,0x81,0x58,0x81,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xE3,0x68,0xE3,0x68,
-	0xE3,0x70,0xE3,0x70,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0x24,0x81,0x24,0x81,0xE3,0x80,0x03,0x89,0x24,0x91,0x24,0x91,0x24,0x91,0x24,0x91,0x44,0x99,0x44,0x99,0x44,0x99,0x03,0x99,0x65,0xA1,0x07,0xB2,0x4D,0xD3,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xF6,0x4D,0xD3,0x28,0xC2,0xA5,0xD1,
-	0x65,0xD1,0xA5,0xD1,0xA5,0xD1,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xE6,0xD9,0xC6,0xE1,0xC6,0xE1,0x85,0xE9,0x85,0xE9,0xC6,0xE1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,
-	0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x27,0xFA,0xE6,0xF1,0x24,0x81,0x61,0x28,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x20,0x61,0x38,0xA2,0x48,0xC2,0x50,0x81,0x58,0x81,0x58,0xC2,0x58,0xC2,0x58,0xC2,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xE3,0x68,0xE3,0x68,0xE3,0x70,0xE3,0x70,0xE3,0x80,0xE2,0x80,0xE2,0x80,
-	0xE3,0x80,0x24,0x81,0xE3,0x80,0xE3,0x80,0x03,0x89,0x24,0x91,0x24,0x91,0x24,0x91,0x24,0x91,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0xA9,0x65,0xA1,0x28,0xC2,0x50,0xE4,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xF3,0xEC,0x4D,0xD3,0xE6,0xC9,0x65,0xD1,0xA5,0xD1,0x65,0xD1,0x44,0xD1,0x65,0xD1,
-	0x65,0xD1,0x85,0xD9,0x85,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,
-	0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,
-	0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,
-	0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,
-	0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,
-	0x06,0xF2,0x06,0xF2,0x07,0xFA,0xE6,0xF1,0x44,0xA9,0xC2,0x58,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x18,0xA2,0x40,0xC2,0x58,0x81,0x58,0x81,0x58,0xC2,0x58,0xC2,0x58,0x81,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xE3,0x70,0xE3,0x70,0xE3,0x80,0xE3,0x80,0xE3,0x70,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0x03,0x89,
-	0x24,0x89,0x24,0x91,0x24,0x91,0x24,0x91,0x03,0x99,0x44,0x99,0x44,0x99,0x44,0x99,0x44,0xA9,0x03,0xA1,0x65,0xA1,0x07,0xB2,0x4D,0xD3,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xF3,0xEC,0x48,0xCA,0x24,0xC9,0xA5,0xD1,0xA5,0xD1,0xA5,0xD1,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xE9,
-	0xC6,0xE1,0xC6,0xE1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xF9,0xE6,0xF1,0x85,0xC1,
-	0x03,0x89,0x61,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x28,0xA2,0x40,0xC2,0x50,0xC2,0x58,0xC2,0x58,0xC2,0x58,0x81,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x70,0xE3,0x70,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE2,0x80,0xE3,0x80,0xE3,0x80,0x03,0x89,0x24,0x89,0x24,0x91,0x24,0x91,0x24,0x91,0x03,0x99,
-	0x44,0x99,0x44,0x99,0x44,0x99,0x44,0xA9,0x03,0xA1,0x03,0xA1,0x03,0xA1,0x07,0xB2,0x50,0xE4,0x59,0xF6,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xF6,0x50,0xE4,0x69,0xDA,0x65,0xD1,0x65,0xD1,0xA5,0xD1,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xE9,0x85,0xE9,0xC6,0xE1,0xC6,0xF1,0xA5,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF9,0xC6,0xF1,0xC6,0xE1,0x44,0xB1,0x61,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x20,0x18,0xA2,0x40,0xC2,0x58,0x81,0x58,0x81,0x58,0x81,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x70,0xA2,0x70,0xE3,0x70,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0x03,0x89,0x03,0x89,0x03,0x89,0x24,0x91,0x24,0x91,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x44,0xA9,0x44,0xA9,
-	0x44,0xA9,0x44,0xA9,0x44,0xA9,0x85,0xB1,0x4D,0xD3,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0x50,0xE4,0xA5,0xD1,0x44,0xD1,0x65,0xD1,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF9,0x85,0xD9,0x81,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x28,0x61,0x38,0x81,0x50,
-	0x81,0x58,0x81,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x70,0xA2,0x70,0xC2,0x78,0xE2,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0x03,0x89,0x03,0x89,0x24,0x91,0x24,0x91,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0xA1,0x03,0xA1,0x23,0xB1,0x03,0xA1,0x23,0xB1,0x44,0xA9,0x48,0xCA,
-	0xF3,0xEC,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xB6,0xF5,0x69,0xDA,0xA5,0xD1,0x65,0xD1,0x65,0xD1,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF9,0x85,0xE9,0xA2,0x70,0x20,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x18,0x81,0x50,0x81,0x58,0x81,0x58,0x81,0x58,0x81,0x58,0xA2,0x68,
-	0xA2,0x68,0xA2,0x68,0xA2,0x70,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0xE3,0x80,0x03,0x89,0x03,0x89,0x24,0x91,0x24,0x91,0xE3,0x98,0xE3,0x98,0x03,0x99,0x03,0x99,0x03,0x99,0x03,0xA1,0x03,0xA1,0x23,0xB1,0x44,0xA9,0x85,0xB1,0x28,0xC2,0x4D,0xD3,0x50,0xE4,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x59,0xF6,0x50,0xE4,0x69,0xDA,0xA5,0xD1,0x44,0xD1,0x85,0xD9,0x64,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF9,0xA5,0xF1,0xE3,0x98,0x61,0x38,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x28,0x61,0x38,0x81,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x70,0xA2,0x70,0xC2,0x78,
-	0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0xE3,0x80,0xE3,0x80,0x03,0x89,0x03,0x89,0x03,0x89,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x03,0x99,0x03,0x99,0x03,0xA1,0xA6,0xA9,0x48,0xCA,0x4D,0xD3,0x50,0xE4,0x50,0xE4,0xF3,0xEC,0xB6,0xF5,0xB6,0xF5,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x50,0xE4,0x69,0xDA,
-	0x64,0xD9,0x44,0xD1,0x65,0xD1,0x64,0xD9,0x85,0xD9,0x85,0xD9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xC6,0xF9,0xA5,0xF1,0x44,0xB1,0xA2,0x68,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x18,0x81,0x50,0x81,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x68,0xA2,0x70,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,
-	0xE3,0x80,0x03,0x89,0x03,0x89,0x03,0x89,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x03,0x99,0x03,0x99,0x03,0xA1,0x07,0xB2,0x50,0xE4,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xF6,0x4D,0xD3,0x48,0xD2,0x64,0xD9,0x44,0xD1,0x65,0xD1,0x65,0xD1,0x85,0xD9,
-	0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF9,0x85,0xF1,0x65,0xD1,0x24,0x91,0x61,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x28,0x61,0x38,0x81,0x58,0xA2,0x68,0xA2,0x68,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0xE2,0x80,0x03,0x89,0x03,0x89,0x03,0x89,0xE3,0x98,
-	0xE3,0x98,0xE3,0x98,0x03,0x99,0x44,0x99,0x03,0xA1,0x28,0xC2,0x59,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xFF,0xDB,0xFE,0x59,0xF6,0x59,0xF6,0xDB,0xFE,0xDB,0xFE,0xF3,0xEC,0x69,0xDA,0xA5,0xD1,0x64,0xD9,0x44,0xD1,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF9,0x85,0xF1,0x85,0xF1,0x44,0xC1,
-	0x61,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x81,0x50,0x81,0x58,0xA2,0x68,0xA2,0x70,0xA2,0x70,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0xE2,0x80,0x03,0x89,0x03,0x89,0x03,0x89,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x44,0x99,0x44,0xA9,
-	0x4D,0xD3,0x59,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0x59,0xF6,0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,0x4D,0xD3,0x65,0xD1,0x02,0xC9,0x65,0xD1,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-	0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF9,0x64,0xD9,0x81,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x18,0x61,0x38,0x81,0x58,0xA2,0x68,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0xE2,0x80,0x03,0x89,0x03,0x89,0x03,0x89,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0x03,0x99,0x03,0xA1,0x07,0xB2,0x50,0xE4,0xF3,0xEC,0xF3,0xEC,0xF3,0xEC,
-	0x50,0xE4,0x50,0xE4,0x50,0xE4,0xF3,0xEC,0x59,0xF6,0x59,0xF6,0x59,0xF6,0x59,0xF6,0xF3,0xEC,0x4D,0xD3,0x24,0xC9,0x02,0xC9,0x44,0xD1,0x44,0xD1,0x64,0xD9,0x44,0xE1,0x64,0xD9,0x64,0xD9,0x65,0xE9,0x65,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF9,0x65,0xE9,0xC2,0x78,0x20,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0x61,0x38,0x81,0x58,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0xE2,0x80,0x03,0x89,0x03,0x89,0x03,0x89,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE2,0xA0,0x03,0xA1,0x85,0xB1,0x07,0xB2,0x28,0xC2,0x07,0xB2,0x23,0xB1,0x44,0xB1,0x69,0xDA,0xF3,0xEC,0xBE,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x50,0xE4,0x69,0xDA,0x24,0xC9,0x02,0xC9,0x44,0xD1,0x44,0xD1,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x64,0xD9,0x65,0xE9,0x65,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF9,0x65,0xE9,0xE2,0xA0,0x81,0x58,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x18,0x61,0x30,0x81,0x58,
-	0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xC2,0x88,0xC2,0x88,0x03,0x89,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE2,0xA0,0xE2,0xA0,0xE2,0xA0,0x03,0xA1,0x44,0xA9,0x44,0xA9,0x23,0xB1,0xC2,0xA0,0xC6,0xB1,0x50,0xE4,0x59,0xF6,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xB6,0xF5,0x69,0xDA,0xA5,0xD1,
-	0x24,0xC9,0x24,0xC9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xE1,0x64,0xD9,0x64,0xD9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF9,0x85,0xF1,0x44,0xC1,0xE2,0x80,0x20,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x30,0x81,0x58,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x78,
-	0xE2,0x80,0xE2,0x80,0xE2,0x80,0xC2,0x88,0xC2,0x88,0xC2,0x90,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE2,0xA0,0x03,0xA1,0xE2,0xA0,0xE2,0xA0,0xE2,0xA0,0x23,0xB1,0x44,0xB1,0x4D,0xD3,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x59,0xF6,0x50,0xE4,0x85,0xC1,0x03,0xC1,0x24,0xC9,0x24,0xC9,0x44,0xD1,0x44,0xD1,0x44,0xD1,
-	0x44,0xD1,0x64,0xD9,0x64,0xD9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,
-	0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF9,0x85,0xF1,0x64,0xD9,0x03,0xA1,0x61,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x61,0x30,0x81,0x50,0xA2,0x70,0xC2,0x78,0xC2,0x88,0xE2,0x80,0xE2,0x80,0xE2,0x80,0xC2,0x88,0xC2,0x88,
-	0xC2,0x90,0xC2,0x90,0xC2,0x90,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE2,0xA0,0x03,0xA1,0xE2,0xA0,0xE2,0xA0,0xC2,0xA0,0x44,0xB1,0x69,0xDA,0xF3,0xEC,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x50,0xE4,0x48,0xD2,0x24,0xC9,0x02,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,
-	0x65,0xE9,0x65,0xE9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x24,0xC9,0x61,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x28,0x81,0x50,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xE2,0x80,0xE2,0x80,0xC2,0x88,0xC2,0x88,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xE3,0x98,0xE3,0x98,
-	0xE3,0x98,0xE2,0xA0,0x03,0xA1,0x03,0xA1,0xE2,0xA0,0xC2,0xA0,0xE6,0xC1,0x50,0xE4,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0xBE,0xFF,0xB6,0xF5,0x28,0xCA,0x03,0xC1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x23,0xE9,0x44,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF9,0x44,0xE1,0x81,0x58,
-	0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x18,0x61,0x30,0x81,0x58,0xC2,0x88,0xC2,0x88,0xE2,0x80,0xC2,0x88,0xC2,0x88,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE2,0xA0,0x03,0xA1,0xE2,0xA0,0x03,0xA1,
-	0x44,0xB1,0x4D,0xD3,0x59,0xF6,0xBE,0xFF,0xFF,0xFF,0x3D,0xFF,0xB6,0xF5,0x4D,0xD3,0x85,0xC1,0xE2,0xB8,0x03,0xC1,0x24,0xC9,0x24,0xC9,0x24,0xC9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x23,0xE9,0x44,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF9,0x23,0xE9,0xC2,0x78,0x61,0x30,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x38,0xA2,0x70,0xC2,0x78,0xC2,0x78,0xC2,0x88,0xC2,0x88,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xE3,0x98,0xE3,0x98,0xE3,0x98,0xE2,0xA0,0xE2,0xA0,0xC2,0xA0,0x23,0xB1,0xC6,0xB1,0x4D,0xD3,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x59,0xF6,0x4D,0xD3,0xE6,0xC9,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x03,0xC1,0x24,0xC9,0x24,0xC9,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xD1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x23,0xE9,0x44,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF9,0x23,0xE9,0xE2,0xB0,0x81,0x58,0x20,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x61,0x30,0x81,0x58,0xC2,0x78,0xC2,0x88,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xE3,0x98,0xE3,0x98,0xE2,0xA0,0xC2,0xA0,0xC2,0xA0,0x23,0xB1,0x85,0xB1,0x4D,0xD3,0x3D,0xFF,0xFF,0xFF,0xDB,0xFE,0xF3,0xEC,0x28,0xCA,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,
-	0x03,0xC1,0x03,0xC1,0x24,0xC9,0x24,0xC9,0x02,0xC9,0x44,0xD1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x23,0xE9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x44,0xF1,0x24,0xC9,0xC2,0x88,0x20,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x30,0x81,0x58,0xA2,0x70,0xC2,0x88,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xC2,0x90,0xE2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xB0,0x44,0xA9,0x69,0xDA,0xB6,0xF5,0x59,0xF6,0xF3,0xEC,0x4D,0xD3,0x44,0xC1,0xE2,0xB0,0xE2,0xB8,0xE2,0xB8,0x03,0xC1,0x03,0xC1,0x24,0xC9,0x24,0xC9,0x02,0xC9,
-	0x02,0xC9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x44,0xE1,0x44,0xE1,0x23,0xE9,0x23,0xE9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF9,0x64,0xF1,0x23,0xE9,0xE2,0xB0,0x61,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x18,
-	0x61,0x38,0xA2,0x68,0xC2,0x88,0xC2,0xA0,0xC2,0x90,0xC2,0x90,0xE2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xB0,0xE2,0xB0,0x23,0xB1,0x85,0xB1,0x28,0xC2,0x48,0xCA,0x28,0xC2,0x85,0xC1,0xE2,0xB8,0xE2,0xB0,0xE2,0xB8,0xE2,0xB8,0x03,0xC1,0x03,0xC1,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x44,0xE1,
-	0x44,0xE1,0x44,0xE1,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x64,0xF9,0x64,0xF9,0x43,0xF9,0x03,0xC1,0x61,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x61,0x38,0xA2,0x68,0xC2,0x88,0xC2,0x88,
-	0xC2,0x90,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xC2,0xA0,0xC2,0xA0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB8,0xE2,0xB8,0x03,0xC1,0x03,0xC1,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x44,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE9,
-	0x23,0xE9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x23,0xE9,0x23,0xE1,0xC2,0xA0,0x20,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x10,0x61,0x30,0x81,0x50,0xA2,0x70,0xC2,0x90,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,
-	0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0x03,0xC1,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE9,0x23,0xE1,0x23,0xE9,0x23,0xE9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,
-	0x44,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,
-	0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x43,0xF1,0x23,0xE9,0x02,0xC9,0xC2,0x88,0x81,0x50,0x20,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x61,0x30,0xA2,0x68,0xC2,0x90,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xC2,0xA0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,0xE2,0xB0,
-	0xE2,0xB0,0xE2,0xB0,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0xE2,0xB8,0x03,0xC1,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x02,0xC9,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE1,0x23,0xE9,0x23,0xE9,0x23,0xE9,0x23,0xE1,0x23,0xE9,0x23,0xE9,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x44,0xF1,0x43,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,
-	0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,
-	0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,
-	0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,
-	0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,
-	0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x42,0xF1,0x23,0xE1,0xE2,0xB8,0x81,0x58,0x20,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_0_424_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 411,
-    .header.h = 110,
-    .data_size = sizeof(face_756_2_466_dial_img_0_424_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_756_2_466_dial_img_0_424_data_0};
-
-    
\ No newline at end of file
@@ -1,603 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#include "../756_2_466.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_0[] = {
-	//RGB565 data 
-	0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x68,0xE2,0x68,0xE2,0x68,0xEA,0x48,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,
-	0x48,0xE2,0x48,0xE2,0x89,0xEA,0xAA,0xEA,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0x0B,0xF3,0x0B,0xF3,0x0B,0xFB,0x0B,0xFB,0xEA,0xF2,0x89,0xF2,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0xE7,0xE1,0xA9,0xEA,0xCE,0xF3,0x30,0xFC,
-	0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x92,0xFC,0x92,0xFC,0x92,0xFC,0x0F,0xFC,0x0B,0xF3,0x48,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xE2,0x27,0xE2,0x89,0xEA,0x4C,0xEB,0x30,0xF4,0x55,0xFD,0xF7,0xFD,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,
-	0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0xB6,0xFD,0x91,0xFC,0x8D,0xFB,0xAA,0xF2,0x28,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x07,0xE2,0xE6,0xE1,0x6C,0xEB,0xD7,0xFD,0x1C,0xFF,0x9D,0xFF,0x9E,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,
-	0xBE,0xFF,0xBE,0xFF,0x9D,0xFF,0x1C,0xFF,0x96,0xFD,0x0B,0xFB,0xE6,0xF1,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0xA9,0xEA,0x71,0xF4,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBB,0xFE,
-	0xCE,0xF3,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x07,0xE2,0xCA,0xEA,0x0F,0xF4,0xB6,0xFD,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x91,0xFC,0x4C,0xF3,0x27,0xE2,0x07,0xE2,0xE7,0xE1,
-	0x0B,0xEB,0xF3,0xFC,0x99,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xBA,0xFE,0x38,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0xF7,0xFD,0x38,0xFE,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x91,0xFC,0x4C,0xF3,0x07,0xE2,0xE7,0xE1,0xE6,0xE1,0x4C,0xEB,0xD6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x59,0xFE,0x0F,0xF4,0x0B,0xEB,0x8A,0xF2,0x89,0xEA,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x89,0xF2,0x2C,0xFB,0xD6,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x30,0xFC,0x89,0xF2,0x07,0xE2,0xE6,0xE1,0xA5,0xE1,0x6C,0xEB,0x79,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x75,0xFD,0xCA,0xEA,0xE6,0xE9,0xC6,0xE9,
-	0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0x85,0xE9,0x48,0xF2,0x14,0xFD,0x3C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xCE,0xF3,0x28,0xF2,0x07,0xDA,0xE6,0xD9,0xA5,0xE1,0x8D,0xEB,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xFE,0xB2,0xF4,0x27,0xE2,0xC6,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x27,0xEA,0x27,0xEA,0xE7,0xE9,
-	0x89,0xEA,0xF3,0xFC,0xFB,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x8D,0xFB,0xC6,0xF1,0x07,0xE2,0xE6,0xE1,0xA5,0xE1,0xAE,0xF3,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x99,0xFE,0x30,0xF4,0x07,0xEA,0xA6,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x27,0xEA,0x27,0xEA,0xC6,0xE9,0x68,0xEA,0x14,0xFD,0x5D,0xFF,0xDF,0xFF,0xFF,0xFF,
-	0xBE,0xFF,0x99,0xFE,0x4C,0xF3,0xA5,0xF1,0xE7,0xE1,0xE7,0xE1,0xE6,0xE1,0xCE,0xEB,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x38,0xFE,0x30,0xF4,0x27,0xEA,0xC6,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xA5,0xE9,0x68,0xEA,0x96,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xD6,0xFD,0x0B,0xFB,0xA5,0xF1,0xE6,0xE1,
-	0xE7,0xE1,0x48,0xE2,0x30,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x96,0xF5,0xCE,0xEB,0x27,0xEA,0xC6,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xA5,0xE9,0x68,0xF2,0xD7,0xFD,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xFE,0x34,0xFD,0xEA,0xF2,0xC6,0xF1,0xA5,0xD9,0x07,0xE2,0xEA,0xEA,0xD3,0xF4,0x7D,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFB,0xFE,0x14,0xFD,0x6D,0xF3,0x27,0xEA,0xE6,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE6,0xE9,0xCA,0xF2,0x17,0xFE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x79,0xFE,0xB2,0xFC,0xAA,0xF2,0xC6,0xF1,0xA5,0xD9,0x48,0xE2,0x8D,0xEB,0x75,0xFD,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xFE,0x71,0xF4,0xEB,0xF2,0x07,0xF2,
-	0xE6,0xE9,0x07,0xEA,0x07,0xEA,0xE7,0xE9,0xE6,0xF1,0x07,0xEA,0x28,0xEA,0x4C,0xF3,0x38,0xFE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x18,0xFE,0x30,0xFC,0x89,0xF2,0xC6,0xF1,0xA5,0xD9,0x68,0xE2,0x30,0xF4,0x17,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xFE,0xCE,0xEB,0x89,0xEA,0xE7,0xE9,0xE6,0xE9,0x07,0xE2,0xE7,0xE9,0xE7,0xE9,0xE6,0xE9,
-	0x07,0xEA,0x89,0xF2,0xCE,0xF3,0x79,0xFE,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xB6,0xFD,0xCE,0xF3,0x69,0xF2,0xC6,0xF1,0x84,0xD9,0x68,0xE2,0xB2,0xF4,0x59,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xFE,0x0B,0xEB,0x07,0xEA,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xC5,0xE9,0xE6,0xF1,0xEA,0xF2,0x71,0xFC,0xBA,0xFE,0xFF,0xFF,
-	0xFF,0xFF,0x9D,0xFF,0x34,0xFD,0x6D,0xF3,0x48,0xF2,0xC6,0xF1,0x84,0xD9,0x68,0xE2,0xF3,0xF4,0xBA,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xFD,0x89,0xEA,0x85,0xE9,0xE6,0xE1,0xC6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xA5,0xE9,0xE6,0xF1,0x4C,0xF3,0xF3,0xFC,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xD2,0xFC,0xEA,0xF2,0x28,0xF2,
-	0xC6,0xF1,0x84,0xD9,0xA9,0xEA,0x54,0xF5,0xFB,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xF5,0x28,0xEA,0x64,0xE9,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xA5,0xE9,0xE6,0xF1,0xAE,0xF3,0x75,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x30,0xFC,0x48,0xF2,0xE6,0xF1,0xC6,0xF1,0x44,0xE1,0xCA,0xEA,0xB6,0xF5,0x5D,0xFF,
-	0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xFD,0x07,0xE2,0x44,0xE1,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0x85,0xF1,0xE6,0xF1,0x0F,0xFC,0x18,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xCE,0xF3,0xC6,0xF1,0xC6,0xF1,0xE6,0xF1,0x03,0xE1,0xEA,0xEA,0x59,0xFE,0xBE,0xFF,0xFF,0xFF,0xDF,0xFF,0x5D,0xFF,0xF3,0xF4,0x07,0xE2,
-	0x44,0xE1,0xC6,0xE1,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0x84,0xE9,0xE6,0xE9,0x30,0xFC,0x79,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x8D,0xFB,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x03,0xE1,0x0B,0xEB,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xBB,0xFE,0x91,0xF4,0xE6,0xE9,0x44,0xE1,0xC6,0xE1,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,
-	0xA6,0xE9,0x65,0xE9,0xE6,0xF1,0x91,0xFC,0xFB,0xFE,0xBE,0xFF,0xFF,0xFF,0xDF,0xFF,0x79,0xFE,0x2C,0xFB,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x84,0xD9,0x4C,0xEB,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xBB,0xFE,0x71,0xF4,0x85,0xE1,0x03,0xE1,0x44,0xE1,0x43,0xE9,0x43,0xE9,0x64,0xF1,0x64,0xF1,0x43,0xE9,0x07,0xEA,0x14,0xFD,0x9E,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xD7,0xFD,0x0B,0xFB,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x07,0xE2,0xAE,0xF3,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xFE,0xF3,0xFC,0x48,0xE2,0xC6,0xE1,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x27,0xEA,0x48,0xEA,0x0B,0xF3,0x17,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBB,0xFE,0x34,0xFD,0xCA,0xF2,
-	0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x48,0xE2,0x0F,0xF4,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xBA,0xFE,0x54,0xF5,0xD2,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xD2,0xFC,0xF3,0xFC,0x75,0xFD,0x38,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x18,0xFE,0x30,0xFC,0x48,0xF2,0x84,0xF1,0x85,0xF1,0xA5,0xF1,0x27,0xE2,0xCE,0xEB,
-	0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x5D,0xFF,0x1C,0xFF,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xFF,0x14,0xFD,0x0B,0xF3,0xE6,0xF1,0x84,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x0B,0xEB,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xCE,0xF3,0xC6,0xE9,0xA5,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x03,0xE1,0x68,0xE2,0x75,0xFD,0x3C,0xFF,0x9D,0xFF,0xBE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9E,0xFF,0x5D,0xFF,0xBA,0xFE,0x55,0xFD,0xCA,0xF2,0x43,0xE9,0x64,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0x03,0xE1,0xA5,0xE1,0xEA,0xEA,0x71,0xF4,0xD7,0xFD,0xBB,0xFE,0xFB,0xFE,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x3C,0xFF,0xFB,0xFE,
-	0x38,0xFE,0x14,0xFD,0xCE,0xF3,0x89,0xF2,0xC5,0xE9,0x64,0xF1,0x64,0xF1,0x65,0xE9,0x65,0xF1,0x65,0xF1,0x84,0xD9,0x84,0xD9,0xA5,0xE1,0xCA,0xEA,0x30,0xF4,0x14,0xFD,0x75,0xFD,0x96,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x96,0xFD,0x75,0xFD,0x91,0xFC,0x8D,0xF3,0x48,0xF2,0x85,0xF1,0x85,0xF1,
-	0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_1[] = {
-	//RGB565 data 
-	0x07,0xE2,0x07,0xE2,0x27,0xE2,0x48,0xE2,0xCA,0xEA,0x0B,0xEB,0x2C,0xEB,0x2C,0xEB,0x0B,0xF3,0x0B,0xF3,0x0B,0xF3,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0x0B,0xF3,0xEB,0xF2,0xEA,0xF2,0xAA,0xF2,0x69,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x27,0xE2,
-	0x27,0xE2,0x27,0xE2,0x07,0xE2,0x27,0xEA,0x28,0xEA,0x68,0xEA,0x89,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0x89,0xF2,0x48,0xF2,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x27,0xE2,0x28,0xE2,0x28,0xEA,0x28,0xEA,0x8A,0xF2,
-	0x4C,0xEB,0x0F,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0xB2,0xF4,0x91,0xF4,0x4C,0xF3,0x48,0xF2,0x48,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xEA,0x27,0xEA,0x0B,0xEB,0x71,0xF4,0x75,0xFD,0x38,0xFE,0x38,0xFE,0x38,0xFE,
-	0x59,0xFE,0x38,0xFE,0x0F,0xFC,0x48,0xF2,0x28,0xF2,0x68,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x07,0xEA,0x27,0xEA,0xAE,0xF3,0xD6,0xFD,0xFB,0xFE,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0x9E,0xFF,0x91,0xF4,0x27,0xEA,0x27,0xEA,
-	0x68,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x07,0xE2,0x07,0xEA,0x0F,0xFC,0x99,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x91,0xF4,0x27,0xEA,0x07,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,
-	0x48,0xF2,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0xE7,0xE9,0x07,0xEA,0x0F,0xFC,0x99,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x99,0xFE,0x0F,0xFC,0x27,0xEA,0x07,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x27,0xE2,0x27,0xE2,0x27,0xE2,
-	0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x07,0xE2,0x27,0xEA,0x4C,0xF3,0xF3,0xFC,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x18,0xFE,0xCE,0xF3,0x27,0xEA,0x07,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x07,0xEA,
-	0x27,0xEA,0x27,0xEA,0x8A,0xF2,0x14,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0xB6,0xFD,0xAE,0xF3,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x27,0xEA,0x07,0xEA,0x68,0xEA,0x14,0xF5,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x55,0xFD,0x8D,0xF3,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xDA,0x07,0xDA,0x07,0xE2,0x07,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE7,0xE1,0xE7,0xE1,0x48,0xE2,0x4C,0xEB,0x96,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xFE,0x14,0xFD,0x4C,0xEB,
-	0x27,0xEA,0x07,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE7,0xE1,0xE6,0xE9,0xA9,0xEA,0xCE,0xEB,0x17,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xFE,0x71,0xFC,0xEB,0xEA,0x07,0xF2,0x07,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xE9,0xE6,0xF1,0xEB,0xF2,0x71,0xFC,0x59,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xFD,0x6D,0xF3,0x89,0xF2,0x07,0xEA,0x07,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0xE6,0xE1,
-	0xE6,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE6,0xE9,0xE6,0xE9,0x2C,0xEB,0x14,0xFD,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0xFD,0xCA,0xF2,0x27,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,
-	0xE7,0xE1,0xC6,0xE1,0xE6,0xE1,0x6C,0xEB,0x96,0xF5,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xF4,0x27,0xEA,0xE6,0xE9,0x07,0xEA,0xE7,0xE9,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE6,0xE1,0xE6,0xE9,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xC6,0xE1,0xC6,0xE1,0x8D,0xEB,0xF7,0xFD,
-	0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xB2,0xFC,0xE6,0xF1,0xC6,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0x85,0xE1,0x85,0xE1,0xAE,0xF3,0x79,0xFE,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x91,0xF4,
-	0xE6,0xE9,0xC5,0xE9,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE9,0xC6,0xE1,0xE6,0xE1,0xE6,0xE1,0x85,0xE1,0x85,0xE1,0x0F,0xF4,0x3C,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xFE,0x30,0xFC,0xC6,0xE9,0xA5,0xE9,0xE6,0xF1,0xE6,0xF1,0xE7,0xF1,
-	0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xE6,0xE1,0x85,0xE1,0x85,0xE1,0x71,0xF4,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xFF,0x79,0xFE,0xCE,0xF3,0xC5,0xE9,0xA5,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xE9,0xE6,0xE9,0x91,0xF4,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xD6,0xFD,0x8D,0xF3,0xC5,0xE9,0xA5,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,
-	0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xE6,0xE9,0x68,0xEA,0xD3,0xF4,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xFE,0x14,0xFD,0x0B,0xF3,0xC5,0xE9,0xA5,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0xA5,0xD9,0xA5,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xE1,0x85,0xE1,0x07,0xE2,0x0B,0xF3,
-	0x54,0xF5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xFE,0x71,0xFC,0xCA,0xF2,0xA6,0xE9,0xA5,0xF1,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xD9,0x85,0xE1,0xA6,0xE9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x48,0xE2,0xAE,0xF3,0xB6,0xF5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xFE,
-	0xCE,0xF3,0x89,0xF2,0xA6,0xE9,0xA5,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xD9,0x85,0xE1,0x85,0xE9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x89,0xEA,0x0F,0xF4,0x17,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xFD,0x8D,0xEB,0x48,0xEA,0xA5,0xE9,0xA5,0xE9,0xA6,0xE9,
-	0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xD9,0x85,0xE1,0x85,0xE9,0x85,0xE1,0x64,0xE9,0x64,0xE9,0xA9,0xEA,0xB2,0xF4,0x79,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xF5,0x0B,0xF3,0xE7,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA6,0xE9,0xC5,0xE9,0xC5,0xE9,0xC5,0xE9,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0x84,0xD9,0x84,0xD9,0x85,0xE1,0x85,0xE9,0x85,0xE1,0x64,0xE9,0x64,0xE9,0xEB,0xEA,0x34,0xFD,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xFD,0x07,0xEA,0x84,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x84,0xD9,0x84,0xD9,
-	0x85,0xE1,0x85,0xE1,0x85,0xE1,0x64,0xE9,0x44,0xE1,0x0B,0xEB,0xD6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0xFC,0x64,0xF1,0x43,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0x84,0xD9,0x84,0xD9,0x84,0xD9,0x84,0xD9,0x85,0xE1,0x64,0xE9,0x44,0xE1,
-	0x4C,0xEB,0x58,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x91,0xFC,0x64,0xF1,0x43,0xE9,0x85,0xF1,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0x84,0xD9,0x84,0xD9,0x84,0xD9,0x84,0xD9,0x85,0xE1,0x43,0xE9,0x44,0xE1,0x6C,0xEB,0x99,0xFE,0xBE,0xFF,0xDF,0xFF,0xBE,0xFF,
-	0xFB,0xFE,0x30,0xFC,0x65,0xE9,0x43,0xE9,0x65,0xE9,0x84,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x64,0xE9,0x64,0xE9,0x43,0xE9,0x03,0xE1,0x6C,0xEB,0x99,0xFE,0x7D,0xFF,0x1C,0xFF,0xBB,0xFE,0xD7,0xFD,0x8D,0xF3,0x64,0xF1,0x43,0xE9,0x65,0xE9,
-	0x65,0xE9,0x84,0xE9,0x84,0xE9,0x84,0xE9,0x84,0xE9,0x84,0xE9,0x84,0xE9,0x65,0xE9,0x65,0xF1,0x65,0xF1,0x84,0xD9,0x84,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x0B,0xEB,0x55,0xFD,0xD7,0xFD,0x75,0xFD,0x34,0xFD,0x91,0xF4,0xEB,0xF2,0xA5,0xE9,0x65,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,
-	0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_2[] = {
-	//RGB565 data 
-	0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x28,0xE2,0xA9,0xEA,0xEB,0xF2,0x0B,0xF3,0xEB,0xF2,0xEB,0xEA,0xAA,0xEA,0x68,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xF2,0x27,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,
-	0x68,0xE2,0x68,0xE2,0x89,0xEA,0x8A,0xF2,0x8A,0xF2,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xEB,0xEA,0x0B,0xEB,0x0B,0xEB,0x0B,0xEB,0x0B,0xF3,0x0B,0xFB,0x2C,0xFB,0x0B,0xFB,0xCA,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xE2,0xEB,0xEA,0x0F,0xF4,0x71,0xFC,
-	0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0xB2,0xFC,0x91,0xFC,0x6D,0xF3,0x89,0xF2,0x69,0xF2,0x48,0xF2,0x69,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x07,0xE2,0x8D,0xEB,0x96,0xFD,0x18,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,
-	0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x58,0xFE,0xF7,0xFD,0x14,0xFD,0x30,0xFC,0x4C,0xF3,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x07,0xE2,0xE7,0xE1,0x30,0xF4,0x3C,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,
-	0xBE,0xFF,0x7D,0xFF,0xFB,0xFE,0xF3,0xFC,0x4C,0xF3,0x89,0xF2,0x28,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x27,0xE2,0x48,0xE2,0xB2,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0xFE,0x91,0xFC,
-	0xEA,0xF2,0x27,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0xEB,0xEA,0x14,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x38,0xFE,0x4C,0xF3,0xE6,0xF1,0x27,0xE2,0x27,0xE2,0x27,0xE2,
-	0x27,0xE2,0x07,0xE2,0x48,0xE2,0xCA,0xEA,0x0F,0xF4,0xD7,0xFD,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0xD7,0xFD,0x38,0xFE,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x8D,0xFB,0xC6,0xF1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x68,0xEA,
-	0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x68,0xEA,0x0B,0xF3,0xB6,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x8D,0xFB,0xC6,0xF1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xE9,0xC6,0xE9,0xA6,0xE9,0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,
-	0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0x64,0xE9,0xE7,0xE9,0x14,0xFD,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x8D,0xFB,0xC6,0xF1,0x07,0xDA,0x07,0xDA,0x07,0xE2,0x07,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x27,0xEA,0x27,0xEA,0xC6,0xE9,
-	0x68,0xEA,0x14,0xFD,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBB,0xFE,0x6D,0xF3,0xC6,0xF1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE7,0xE9,0xE7,0xE9,0xE6,0xF1,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0x07,0xF2,0x8A,0xF2,0xAE,0xF3,0xF7,0xFD,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xBE,0xFF,0x58,0xFE,0x4C,0xF3,0xA5,0xF1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE6,0xF1,0xE6,0xF1,0xE7,0xE9,0x68,0xEA,0x0F,0xFC,0x96,0xFD,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1C,0xFF,0x75,0xFD,0xEA,0xF2,0xC6,0xF1,0xE6,0xE1,
-	0xE6,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE6,0xE9,0xC6,0xE9,0xC5,0xE9,0xC6,0xE9,0x27,0xEA,0x8A,0xF2,0x0B,0xF3,0xAE,0xF3,0x30,0xF4,0xF3,0xF4,0xF7,0xFD,0xFB,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x18,0xFE,0x30,0xFC,0x89,0xF2,0xE6,0xF1,0xE6,0xD9,0xE6,0xD9,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,
-	0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0x07,0xEA,0x27,0xEA,0xEA,0xF2,0xCE,0xF3,0xD2,0xFC,0xB6,0xF5,0xDB,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xFF,0xF3,0xFC,0x0B,0xF3,0x28,0xF2,0xE6,0xF1,0xE6,0xD9,0xE6,0xD9,0xE6,0xE1,0xE6,0xE9,0xE6,0xE1,0xC6,0xE1,0xC6,0xE1,0x68,0xE2,0x8D,0xEB,0x71,0xF4,0x14,0xFD,
-	0x75,0xFD,0x18,0xFE,0xBA,0xFE,0x3C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xB6,0xFD,0x8D,0xFB,0x48,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE6,0xE1,0xE6,0xE1,0xC6,0xE1,0xE6,0xE1,0x27,0xE2,0x8D,0xEB,0x75,0xFD,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x75,0xFD,0xCE,0xF3,0x89,0xF2,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xE1,0xA9,0xEA,0x71,0xF4,0xD7,0xFD,0xFB,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xBA,0xFE,0xF7,0xFD,0x55,0xFD,0x91,0xFC,
-	0x8D,0xFB,0x89,0xF2,0x07,0xF2,0xC6,0xF1,0xE6,0xF1,0xE7,0xF1,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x07,0xE2,0xCE,0xEB,0xBA,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFB,0xFE,0xD6,0xFD,0xD2,0xFC,0xCE,0xF3,0xCA,0xF2,0x07,0xF2,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xC6,0xD9,0xC6,0xD9,0xA5,0xD9,0x48,0xE2,0xAE,0xF3,0x75,0xFD,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x17,0xFE,0x34,0xFD,0xB2,0xF4,0x0F,0xFC,0x6D,0xF3,0x0B,0xF3,0x89,0xF2,0xE6,0xF1,0xA5,0xF1,0xA5,0xF1,0xC6,0xF1,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xD9,0xA5,0xD9,0x84,0xD9,0xEA,0xEA,
-	0x54,0xF5,0xFB,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x1C,0xFF,0xB6,0xFD,0x0F,0xFC,0xCA,0xF2,0xE7,0xE9,0xA6,0xE9,0xA5,0xE9,0xA5,0xE9,0xC5,0xE9,0xC6,0xE9,0xC6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0x84,0xD9,0x44,0xE1,0x2C,0xEB,0x99,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x99,0xFE,0x91,0xF4,0x6C,0xEB,0x89,0xEA,0xE7,0xE9,0xA5,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xE9,0xA5,0xE9,0xC5,0xE9,0xC5,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0x84,0xD9,0x44,0xE1,0x8D,0xEB,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xF5,0x68,0xEA,0x85,0xE9,0x85,0xE1,0x85,0xE9,
-	0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0x84,0xD9,0xA5,0xD9,0xC6,0xE1,0x0F,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xF5,0x85,0xE9,0x03,0xE1,0x43,0xE9,0x43,0xE9,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,0x64,0xF1,
-	0x64,0xF1,0x64,0xF1,0x85,0xE9,0xA6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0x84,0xD9,0xC6,0xE1,0x48,0xE2,0x71,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xF5,0x27,0xE2,0x85,0xE9,0x07,0xF2,0x07,0xF2,0x27,0xEA,0x27,0xEA,0x27,0xEA,0x27,0xEA,0x27,0xEA,0x28,0xEA,0x28,0xEA,0x07,0xEA,0xE6,0xF1,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0x44,0xE1,0xC6,0xE1,0xCA,0xEA,0xB2,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x99,0xFE,0xF3,0xFC,0xB2,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0x14,0xFD,0xB2,0xFC,0x6D,0xF3,0x68,0xF2,0xE6,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0xC6,0xE1,
-	0x2C,0xEB,0x14,0xF5,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7D,0xFF,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0x3C,0xFF,0xBA,0xFE,0x30,0xFC,0x89,0xF2,0xC6,0xE9,0x84,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x07,0xE2,0xCE,0xEB,0xB6,0xF5,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0x5D,0xFF,0x30,0xFC,0xE6,0xF1,0xA5,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x27,0xE2,0x30,0xF4,0x17,0xFE,0x9D,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xCE,0xF3,0x65,0xF1,0x84,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x03,0xE1,0x27,0xE2,0x91,0xF4,0x38,0xFE,0xFB,0xFE,0x3C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,
-	0x1C,0xFF,0x1C,0xFF,0x7D,0xFF,0xBA,0xFE,0x4C,0xF3,0x43,0xE9,0x43,0xE9,0x65,0xE9,0x65,0xF1,0x65,0xF1,0x44,0xE1,0x27,0xE2,0x0F,0xF4,0x14,0xF5,0x75,0xFD,0x96,0xF5,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0xD7,0xFD,0x34,0xFD,0xEA,0xF2,
-	0x65,0xE9,0x85,0xF1,0xA6,0xE9,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_3[] = {
-	//RGB565 data 
-	0x07,0xE2,0x48,0xE2,0xCA,0xEA,0x0B,0xEB,0x0B,0xEB,0x0B,0xEB,0x0B,0xEB,0x0B,0xF3,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0x0B,0xF3,0x0B,0xF3,0x2C,0xFB,0x0B,0xFB,0x89,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x07,0xE2,0x27,0xE2,
-	0x48,0xE2,0xA9,0xEA,0xCA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xCA,0xF2,0xCA,0xF2,0xAA,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x48,0xE2,0xA9,0xEA,0x6C,0xEB,0x71,0xF4,0xB2,0xF4,0x91,0xF4,0x91,0xF4,
-	0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x30,0xFC,0xCE,0xF3,0xEA,0xF2,0x48,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xE2,0x27,0xE2,0x68,0xE2,0x0B,0xF3,0x30,0xF4,0xD7,0xFD,0x58,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,
-	0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0xD7,0xFD,0x75,0xFD,0x91,0xFC,0xCE,0xF3,0xCA,0xF2,0x48,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xE2,0x28,0xE2,0x07,0xE2,0x89,0xEA,0x6C,0xEB,0x14,0xF5,0x5D,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0x9E,0xFF,
-	0x9D,0xFF,0x5D,0xFF,0x38,0xFE,0xCE,0xF3,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x07,0xE2,0xCA,0xEA,0x0F,0xF4,0x17,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xF3,0xFC,0x0B,0xFB,
-	0x89,0xF2,0x28,0xF2,0x28,0xE2,0x27,0xE2,0x07,0xE2,0xEA,0xEA,0xB2,0xF4,0x59,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x38,0xFE,0x91,0xFC,0xEA,0xF2,0x07,0xF2,0x27,0xE2,0x07,0xE2,0x07,0xE2,
-	0xA9,0xEA,0xCE,0xEB,0xF3,0xF4,0xD7,0xFD,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0xD7,0xFD,0x17,0xFE,0xBB,0xFE,0x9D,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xFE,0x55,0xFD,0x0B,0xFB,0xE6,0xF1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xE2,0x48,0xE2,0x68,0xE2,0x89,0xEA,0x89,0xEA,
-	0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x68,0xEA,0xCA,0xF2,0xB2,0xFC,0xBA,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0xB6,0xFD,0x2C,0xFB,0xE6,0xF1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xE1,0xC6,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,
-	0xA5,0xE9,0xA6,0xE9,0x64,0xE9,0xC6,0xE9,0x0F,0xFC,0xF7,0xFD,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0x96,0xFD,0x0B,0xFB,0xE6,0xF1,0x07,0xDA,0x07,0xDA,0x07,0xE2,0x07,0xEA,0x07,0xE2,0x07,0xE2,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE6,0xE9,0x28,0xEA,0xCE,0xF3,
-	0xD6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBB,0xFE,0x14,0xFD,0xEA,0xF2,0xE6,0xF1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x28,0xEA,0x48,0xE2,0x68,0xE2,0x48,0xE2,0x68,0xEA,0x68,0xEA,0x68,0xF2,0x68,0xF2,0x68,0xF2,0xEB,0xF2,0xD2,0xFC,0x99,0xFE,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
-	0x38,0xFE,0x91,0xFC,0xCA,0xF2,0xE6,0xF1,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE7,0xE1,0xE7,0xE1,0x28,0xEA,0x89,0xEA,0x0B,0xF3,0x6C,0xEB,0x6C,0xEB,0x6C,0xEB,0x6C,0xEB,0x6C,0xEB,0x4C,0xF3,0x6D,0xF3,0x8D,0xF3,0x30,0xFC,0x38,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x96,0xFD,0xCE,0xF3,0x89,0xF2,0x06,0xF2,0xE6,0xE1,
-	0xE6,0xE1,0xE7,0xE1,0xE6,0xE1,0xE6,0xE1,0xCA,0xEA,0x0F,0xF4,0xF3,0xF4,0x96,0xF5,0xB6,0xF5,0xB6,0xF5,0xB6,0xF5,0xB6,0xF5,0x96,0xFD,0xB6,0xFD,0xD6,0xFD,0x38,0xFE,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x71,0xFC,0xAA,0xF2,0x27,0xF2,0x06,0xF2,0xE6,0xD9,0xE6,0xD9,0xE7,0xE1,0xE6,0xE1,0x85,0xE1,0x2C,0xEB,
-	0xB6,0xF5,0x3C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xF7,0xFD,0x4C,0xF3,0xC6,0xF1,0xE6,0xF1,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE6,0xE1,0xC6,0xE1,0x85,0xE1,0x8D,0xEB,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x96,0xFD,0x0F,0xFC,0x69,0xF2,0xC6,0xF1,0xE6,0xF1,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE6,0xE1,0x85,0xE1,0x85,0xE1,0x8D,0xEB,0xBA,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDB,0xFE,0x30,0xFC,0x69,0xF2,0x27,0xF2,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0x85,0xE1,0x85,0xE1,0xEB,0xEA,0x14,0xF5,0xB6,0xF5,0xB6,0xF5,0xB6,0xF5,0xB6,0xF5,0x96,0xF5,0xB6,0xF5,0xD7,0xFD,0x58,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,
-	0x14,0xFD,0x6D,0xF3,0x48,0xF2,0xC6,0xF1,0xE6,0xF1,0xE7,0xF1,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xE1,0x48,0xE2,0x2C,0xEB,0x6C,0xEB,0x4C,0xEB,0x4C,0xEB,0x4C,0xEB,0x2C,0xEB,0x4C,0xEB,0xAE,0xF3,0x71,0xFC,0x38,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x99,0xFE,0xD2,0xFC,0xCA,0xF2,0xC6,0xF1,0xC6,0xF1,
-	0xE6,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,0xA5,0xE1,0xC6,0xE1,0xE6,0xE9,0x28,0xE2,0x48,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xEA,0x48,0xEA,0xCA,0xF2,0x30,0xFC,0xD6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x96,0xFD,0x0B,0xF3,0xA5,0xF1,0xC6,0xF1,0xE6,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,
-	0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xA6,0xE9,0xA6,0xE9,0x85,0xF1,0xA6,0xE9,0xCA,0xF2,0x30,0xFC,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xD7,0xFD,0x0B,0xFB,0xA5,0xF1,0xA5,0xF1,0xE6,0xF1,0xA5,0xD9,0xA5,0xD9,0xA5,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,
-	0x85,0xE1,0xC6,0xE1,0xA6,0xE9,0xA6,0xE9,0x65,0xE9,0xA5,0xE9,0x68,0xF2,0xCE,0xF3,0x79,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1C,0xFF,0x75,0xFD,0xEA,0xF2,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0xC6,0xE1,0xA6,0xE9,0xA6,0xE9,0x85,0xE9,
-	0xC6,0xE9,0xEA,0xF2,0x71,0xFC,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBA,0xFE,0x14,0xFD,0xCA,0xF2,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x84,0xD9,0x84,0xD9,0x44,0xE1,0x43,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x43,0xE9,0x43,0xE9,0x43,0xE9,0xA5,0xE9,0xCE,0xF3,0x58,0xFE,0x7D,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xFF,0x38,0xFE,0x91,0xFC,0x89,0xF2,0x85,0xF1,0xA5,0xF1,0xC6,0xF1,0xA5,0xD9,0xC6,0xE1,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xF2,0x07,0xEA,0xCA,0xF2,0x34,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x96,0xFD,0xAE,0xF3,0x48,0xF2,
-	0x85,0xF1,0xA5,0xF1,0xC6,0xF1,0x07,0xE2,0xEA,0xEA,0x71,0xF4,0x14,0xF5,0xF3,0xF4,0xF3,0xF4,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xD2,0xFC,0xF3,0xFC,0x55,0xFD,0x17,0xFE,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x91,0xF4,0x48,0xEA,0xC5,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xCA,0xEA,0x0F,0xF4,
-	0x59,0xFE,0x3C,0xFF,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x99,0xFE,0x6D,0xF3,0x84,0xE9,0x84,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x0F,0xF4,0x14,0xF5,0x3C,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-	0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xFD,0xCE,0xF3,0x48,0xF2,0x84,0xE9,0x84,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0xB2,0xF4,0x96,0xF5,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBE,0xFF,0x5D,0xFF,0x99,0xFE,0xCE,0xF3,0xE6,0xF1,0x85,0xF1,0x84,0xE9,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x71,0xF4,0x14,0xF5,0xBA,0xFE,0x3C,0xFF,0x3C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0xDB,0xFE,0x38,0xFE,
-	0xB2,0xFC,0x4C,0xEB,0x27,0xEA,0x84,0xF1,0x64,0xF1,0x84,0xE9,0x84,0xE9,0x65,0xE9,0x65,0xF1,0x65,0xF1,0xCE,0xEB,0x30,0xF4,0x54,0xF5,0xB6,0xF5,0x96,0xF5,0x96,0xF5,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x96,0xFD,0x75,0xFD,0x34,0xFD,0x92,0xFC,0x0B,0xF3,0xC5,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xE9,
-	0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_4[] = {
-	//RGB565 data 
-	0xA9,0xEA,0xCA,0xEA,0x0B,0xEB,0x0B,0xEB,0x0B,0xEB,0x2C,0xEB,0x2C,0xEB,0x2C,0xEB,0x0B,0xF3,0x0B,0xF3,0x0B,0xF3,0x0B,0xF3,0x0B,0xF3,0x2C,0xEB,0x0B,0xF3,0x0B,0xEB,0xCA,0xF2,0x68,0xF2,0x07,0xF2,0x07,0xF2,0x27,0xF2,0x27,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x27,0xE2,0x07,0xE2,0x07,0xE2,0xE7,0xE1,0x07,0xE2,
-	0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xEA,0x27,0xEA,0x27,0xEA,0x27,0xEA,0x27,0xEA,0x07,0xEA,0x07,0xEA,0x48,0xEA,0x89,0xEA,0xEA,0xF2,0x0B,0xF3,0x2C,0xFB,0x2C,0xFB,0x2C,0xFB,0x0B,0xFB,0xEA,0xF2,0xCA,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x28,0xE2,0x28,0xEA,0x28,0xEA,0x28,0xEA,
-	0x48,0xEA,0x48,0xEA,0x48,0xEA,0x27,0xEA,0x27,0xEA,0xEB,0xEA,0xAE,0xF3,0x30,0xFC,0xB2,0xF4,0x92,0xFC,0x92,0xFC,0xB2,0xFC,0x91,0xFC,0xCE,0xF3,0x4C,0xF3,0xAA,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xEA,0x48,0xEA,0x48,0xEA,0x28,0xEA,0x28,0xEA,0x68,0xEA,0xCA,0xF2,
-	0x30,0xFC,0x55,0xFD,0xD7,0xFD,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0xF7,0xFD,0xF3,0xFC,0xCE,0xF3,0xCA,0xF2,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xEA,0x48,0xEA,0x48,0xEA,0x27,0xEA,0x27,0xEA,0xCA,0xF2,0x0F,0xFC,0x17,0xFE,0x9D,0xFF,0x9E,0xFF,0xBE,0xFF,0xBE,0xFF,
-	0xBE,0xFF,0xBE,0xFF,0x5D,0xFF,0xD7,0xFD,0x30,0xFC,0xEA,0xF2,0x27,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xEA,0x27,0xEA,0x27,0xEA,0x48,0xEA,0xCA,0xF2,0x30,0xFC,0xD6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xD7,0xFD,0x0F,0xFC,
-	0xCA,0xF2,0x27,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xEA,0x28,0xEA,0x07,0xF2,0x07,0xF2,0xCA,0xF2,0x0F,0xFC,0xF7,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x34,0xFD,0x6D,0xF3,0x89,0xF2,0x27,0xF2,0x27,0xE2,0x27,0xE2,0x27,0xE2,
-	0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x07,0xE2,0x27,0xEA,0x28,0xEA,0x8A,0xF2,0x0F,0xFC,0xD6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xB2,0xFC,0xCA,0xF2,0x48,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x07,0xEA,
-	0x07,0xEA,0x8A,0xF2,0xCE,0xF3,0xD6,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x30,0xFC,0x48,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xE1,0x07,0xEA,0x8A,0xF2,0x0F,0xFC,0xB6,0xFD,0x1C,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x79,0xFE,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0xCE,0xF3,0x07,0xF2,0x27,0xF2,0x28,0xF2,0x07,0xDA,0x07,0xDA,0x07,0xE2,0x07,0xEA,0x07,0xE2,0xE6,0xE1,0xE6,0xE1,0x89,0xEA,0xCE,0xF3,0xB6,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xFD,0x71,0xFC,0x79,0xFE,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBB,0xFE,0x8D,0xFB,0xE6,0xF1,0x07,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE7,0xE1,0xE6,0xE1,0x07,0xE2,0x89,0xEA,0x0F,0xF4,0xB6,0xFD,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x99,0xFE,0xB2,0xFC,0x0F,0xFC,0x38,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x79,0xFE,
-	0x8D,0xFB,0xC6,0xF1,0x07,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE7,0xE1,0xE6,0xE1,0x89,0xEA,0xCE,0xEB,0xB6,0xF5,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xFE,0x71,0xFC,0xAE,0xF3,0x0F,0xFC,0x58,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xF7,0xFD,0x4C,0xF3,0xE6,0xF1,0x06,0xF2,0x27,0xF2,0xE6,0xE1,
-	0xE6,0xE1,0xE6,0xE1,0x07,0xE2,0x89,0xEA,0xCE,0xEB,0xB6,0xF5,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x99,0xFE,0x91,0xFC,0xEB,0xF2,0x4C,0xF3,0x91,0xFC,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDB,0xFE,0x34,0xFD,0x0B,0xFB,0xE6,0xF1,0x06,0xF2,0x07,0xF2,0xE6,0xD9,0xC6,0xE1,0xC6,0xE1,0x68,0xE2,0xCE,0xEB,0x96,0xF5,
-	0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,0x71,0xFC,0xCA,0xF2,0x07,0xEA,0x6C,0xEB,0x14,0xFD,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x38,0xFE,0x91,0xFC,0xCA,0xF2,0xC6,0xF1,0xE6,0xF1,0x07,0xF2,0xA5,0xD9,0xE6,0xD9,0x68,0xE2,0xCE,0xEB,0xD7,0xFD,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xFE,
-	0x14,0xFD,0xEB,0xF2,0xE6,0xE9,0xE6,0xE9,0xAE,0xF3,0xB6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xD7,0xFD,0x30,0xFC,0x89,0xF2,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0xA5,0xD9,0x48,0xE2,0xAE,0xF3,0x96,0xF5,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x55,0xFD,0x8D,0xF3,0xE7,0xE9,0x65,0xE9,0xE7,0xE9,0x0F,0xFC,
-	0x38,0xFE,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xB6,0xFD,0xCE,0xF3,0x89,0xF2,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0xC6,0xE1,0x0B,0xEB,0x96,0xF5,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xFE,0x54,0xF5,0x4C,0xEB,0x27,0xEA,0x85,0xF1,0x43,0xE9,0xA6,0xE9,0x30,0xFC,0xBA,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,
-	0xF3,0xFC,0x0B,0xF3,0x28,0xF2,0xC6,0xF1,0xE6,0xF1,0xE7,0xF1,0x27,0xE2,0xCE,0xEB,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xD7,0xFD,0xCE,0xEB,0xE7,0xE1,0x85,0xE9,0xE6,0xF1,0xA5,0xE9,0xE6,0xF1,0x91,0xFC,0x1C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xB2,0xFC,0xAA,0xF2,0x27,0xF2,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0x0B,0xEB,0x71,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x54,0xF5,0x0F,0xF4,0x4C,0xEB,0x4C,0xEB,0x6D,0xF3,0x0B,0xF3,0x8D,0xF3,0xB6,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x55,0xFD,0x8D,0xFB,0xAA,0xF2,0x28,0xF2,0xE6,0xF1,0xC6,0xF1,0xCE,0xEB,0xF3,0xF4,0x5D,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x54,0xF5,0xF3,0xF4,0x34,0xFD,0x34,0xFD,0x34,0xFD,0x14,0xFD,0x34,0xFD,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x38,0xFE,0xB2,0xFC,0x4C,0xF3,0x48,0xF2,0x06,0xF2,0xC6,0xF1,0x30,0xF4,0x54,0xF5,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xDB,0xFE,
-	0xBA,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x79,0xFE,0x8D,0xFB,0x06,0xF2,0xC6,0xF1,0xC6,0xF1,0xB2,0xF4,0xB6,0xF5,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xCE,0xF3,0xA5,0xF1,0xA5,0xF1,0xC6,0xF1,0x38,0xFE,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x8D,0xFB,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x17,0xFE,0x59,0xFE,0x3C,0xFF,0x5D,0xFF,0x5D,0xFF,0x5D,0xFF,0x5D,0xFF,0x5D,0xFF,0x5D,0xFF,0x5D,0xFF,0x5D,0xFF,0x5D,0xFF,0x5D,0xFF,0x7D,0xFF,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x9E,0xFF,0x5D,0xFF,0xF7,0xFD,0x0B,0xF3,
-	0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x0B,0xEB,0x2C,0xEB,0x6C,0xEB,0x8D,0xEB,0x8D,0xEB,0x8D,0xEB,0x8D,0xEB,0x8D,0xEB,0x8D,0xEB,0x8D,0xEB,0x8D,0xEB,0x6C,0xEB,0x8D,0xEB,0x71,0xF4,0xB6,0xFD,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x96,0xFD,0x30,0xFC,0xEA,0xF2,0xE6,0xF1,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x44,0xE1,
-	0x03,0xE1,0x03,0xE1,0x03,0xE1,0x03,0xE1,0x03,0xE1,0x03,0xE1,0x43,0xE9,0x43,0xE9,0x43,0xE9,0x03,0xE1,0x43,0xE9,0xCA,0xF2,0xF3,0xFC,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x17,0xFE,0x0F,0xFC,0x27,0xEA,0x43,0xE9,0x64,0xF1,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x64,0xE9,0x64,0xE9,
-	0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x03,0xE1,0x43,0xE9,0x8D,0xF3,0x18,0xFE,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x55,0xFD,0x2C,0xFB,0xE6,0xF1,0x43,0xE9,0x84,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0x84,0xD9,0x84,0xD9,0x84,0xD9,0x84,0xD9,0x85,0xE1,0x85,0xE9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x43,0xE9,
-	0x65,0xE9,0x0F,0xFC,0xBA,0xFE,0x9E,0xFF,0xDF,0xFF,0xDF,0xFF,0x9D,0xFF,0xD2,0xFC,0x89,0xF2,0xC6,0xE9,0x84,0xE9,0x84,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x64,0xE9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x03,0xE1,0x64,0xE9,0xCE,0xF3,0x79,0xFE,0xFB,0xFE,0x1C,0xFF,
-	0x5D,0xFF,0xBB,0xFE,0x30,0xFC,0x27,0xEA,0x85,0xE9,0x64,0xF1,0x64,0xF1,0x65,0xE9,0x65,0xF1,0x65,0xF1,0x84,0xD9,0x84,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x64,0xE9,0x85,0xE9,0x6C,0xEB,0x34,0xFD,0x96,0xFD,0x75,0xFD,0xD6,0xFD,0x55,0xFD,0x8D,0xF3,0x07,0xEA,0xC5,0xE9,
-	0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_5[] = {
-	//RGB565 data 
-	0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xE2,0x27,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x89,0xEA,0xEB,0xF2,0x0B,0xF3,0xEB,0xF2,0x0B,0xF3,0x0B,0xF3,0x89,0xF2,0x28,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x89,0xEA,
-	0xCA,0xEA,0x0B,0xEB,0x2C,0xEB,0x0B,0xEB,0x0B,0xF3,0x0B,0xEB,0x0B,0xEB,0x0B,0xEB,0xEB,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xCA,0xF2,0xCA,0xF2,0xEA,0xF2,0x0B,0xFB,0x2C,0xFB,0x2C,0xFB,0x2C,0xFB,0x0B,0xFB,0xCA,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0xCA,0xEA,0x8D,0xEB,0x71,0xF4,0xD3,0xF4,0x91,0xF4,0x91,0xF4,
-	0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x92,0xFC,0x92,0xFC,0x92,0xFC,0x92,0xFC,0xD2,0xFC,0x30,0xFC,0x2C,0xFB,0x89,0xF2,0x48,0xE2,0x28,0xE2,0x27,0xE2,0x68,0xE2,0x0B,0xF3,0x30,0xF4,0xD7,0xFD,0x58,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,
-	0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x58,0xFE,0x96,0xFD,0x8D,0xFB,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x07,0xE2,0x89,0xEA,0x6C,0xEB,0x14,0xF5,0x5D,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,
-	0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xDB,0xFE,0x8D,0xFB,0x06,0xF2,0x28,0xE2,0x28,0xE2,0x07,0xE2,0xA9,0xEA,0xCE,0xEB,0xB6,0xF5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,
-	0x8D,0xFB,0xE6,0xF1,0x28,0xE2,0x27,0xE2,0x07,0xE2,0xEA,0xEA,0x91,0xF4,0x38,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x38,0xFE,0x4C,0xF3,0xE6,0xF1,0x27,0xE2,0x07,0xE2,0xE7,0xE1,
-	0x0B,0xEB,0x14,0xFD,0xBA,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x99,0xFE,0x38,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0xF7,0xFD,0x96,0xFD,0x91,0xFC,0xEA,0xF2,0x07,0xF2,0x07,0xE2,0xE7,0xE1,0xE6,0xE1,0x4C,0xEB,0xD6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x59,0xFE,0x0F,0xF4,0x0B,0xEB,0x8A,0xF2,0x89,0xEA,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0xCA,0xF2,0xCA,0xF2,0xCA,0xF2,0xAA,0xF2,0xAA,0xF2,0xAA,0xF2,0x89,0xF2,0x48,0xF2,0x28,0xF2,0x07,0xE2,0xE6,0xE1,0xC6,0xE1,0x4C,0xEB,0x38,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xFE,0x0B,0xEB,0xE7,0xE9,0xA6,0xE9,
-	0x85,0xE9,0xA6,0xE9,0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xE6,0xE9,0xE6,0xE9,0xC6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE7,0xF1,0x28,0xF2,0x48,0xF2,0x07,0xDA,0xE6,0xD9,0xA5,0xE1,0x6C,0xEB,0x99,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xFD,0xEB,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x27,0xEA,0x27,0xEA,0x27,0xEA,
-	0x27,0xEA,0x28,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0xC6,0xE1,0x85,0xE1,0x8D,0xEB,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xFD,0x0B,0xF3,0x48,0xEA,0x68,0xEA,0x68,0xEA,0x68,0xF2,0x89,0xF2,0x89,0xF2,0x28,0xEA,0xE7,0xE9,0xE6,0xE9,0xE6,0xF1,0x07,0xF2,0x07,0xF2,
-	0x27,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0xE6,0xE1,0x85,0xE1,0x8D,0xEB,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xFE,0x8D,0xEB,0x0B,0xEB,0x6C,0xEB,0x6D,0xF3,0x6D,0xF3,0x6D,0xF3,0x6D,0xF3,0xCA,0xF2,0x48,0xEA,0x07,0xF2,0x06,0xF2,0x06,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0xE6,0xE1,
-	0xE6,0xE1,0x27,0xE2,0x30,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0xB6,0xF5,0x75,0xFD,0xB6,0xF5,0xB6,0xFD,0xB6,0xFD,0xB6,0xFD,0xB6,0xFD,0x54,0xF5,0xF3,0xF4,0xB2,0xFC,0x30,0xFC,0x4C,0xF3,0x89,0xF2,0x27,0xF2,0x06,0xF2,0x07,0xF2,0x07,0xF2,0xA5,0xD9,0x07,0xE2,0xEA,0xEA,0xD3,0xF4,0x7D,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xFE,0x14,0xFD,0x8D,0xFB,0x69,0xF2,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0xA5,0xD9,0x48,0xE2,0x8D,0xEB,0x75,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBB,0xFE,0x75,0xFD,0x4C,0xF3,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xA5,0xD9,0x48,0xE2,0xCE,0xEB,0xB6,0xF5,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x30,0xFC,0x48,0xF2,0x07,0xF2,0xE6,0xF1,0xA5,0xD9,0x48,0xE2,0x8D,0xEB,0xF3,0xF4,0x58,0xFE,0xBA,0xFE,0x99,0xFE,0x99,0xFE,0x99,0xFE,0x99,0xFE,0x99,0xFE,0x99,0xFE,0x99,0xFE,0x99,0xFE,0x99,0xFE,0x99,0xFE,0xDB,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBE,0xFF,0xB2,0xFC,0xAA,0xF2,0x27,0xF2,0xE6,0xF1,0xA5,0xD9,0x07,0xE2,0x0B,0xEB,0xCE,0xEB,0xB2,0xF4,0xF3,0xF4,0xD3,0xF4,0xD3,0xF4,0xD3,0xF4,0xD3,0xF4,0xD3,0xF4,0xD3,0xF4,0xD3,0xF4,0xD2,0xFC,0xD3,0xF4,0xD3,0xF4,0x54,0xF5,0xDB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xF3,0xFC,0x0B,0xF3,0x28,0xF2,
-	0xC6,0xF1,0xC6,0xD9,0xE6,0xD9,0x48,0xE2,0xA9,0xEA,0xEA,0xEA,0x0B,0xF3,0xEB,0xEA,0xEB,0xEA,0xEB,0xEA,0xEB,0xEA,0xEB,0xEA,0xEB,0xEA,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xCA,0xF2,0x4C,0xF3,0x55,0xFD,0x1C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xFF,0xF3,0xFC,0x0B,0xF3,0x27,0xF2,0xA5,0xF1,0xC6,0xD9,0xC6,0xD9,0xA5,0xD9,0xA5,0xE1,
-	0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xE9,0x64,0xF1,0xE6,0xE9,0x71,0xFC,0xBB,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xD2,0xFC,0xEA,0xF2,0x07,0xF2,0xA5,0xF1,0xA5,0xD9,0xA5,0xD9,0xA5,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,
-	0x85,0xE1,0x85,0xE1,0x85,0xE9,0x85,0xE9,0xA5,0xE9,0x85,0xE9,0x43,0xE9,0x85,0xE9,0xB2,0xFC,0x7D,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x71,0xFC,0x69,0xF2,0xE6,0xF1,0xA5,0xF1,0xA5,0xD9,0xA5,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0xC6,0xE1,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,
-	0xA6,0xE9,0x84,0xE9,0x27,0xEA,0x55,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x0F,0xFC,0xE6,0xF1,0xC6,0xF1,0xA5,0xF1,0x84,0xD9,0x84,0xD9,0x44,0xE1,0x43,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x43,0xE9,0x43,0xE9,0x43,0xE9,0x64,0xF1,0x07,0xF2,0x8D,0xF3,0x38,0xFE,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x8D,0xFB,0x85,0xF1,0xA5,0xF1,0xC6,0xF1,0xA5,0xD9,0xC6,0xE1,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xF2,0xE6,0xF1,0x28,0xEA,0x8D,0xF3,0x14,0xFD,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x38,0xFE,0x0B,0xFB,
-	0x64,0xF1,0x85,0xF1,0xC6,0xF1,0x07,0xE2,0xEA,0xEA,0x71,0xF4,0x14,0xF5,0xF3,0xF4,0xF3,0xF4,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0x34,0xFD,0x38,0xFE,0x1C,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xFE,0x30,0xFC,0x68,0xF2,0x64,0xF1,0x85,0xF1,0xA5,0xF1,0xCA,0xEA,0x0F,0xF4,
-	0x59,0xFE,0x3C,0xFF,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0x1C,0xFF,0x3C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0xB2,0xFC,0xCA,0xF2,0xE6,0xE9,0x84,0xF1,0xA5,0xF1,0xA5,0xF1,0x0F,0xF4,0x14,0xF5,0x3C,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-	0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xD6,0xFD,0x4C,0xF3,0xC5,0xE9,0xA5,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xB2,0xF4,0x96,0xF5,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0x9E,0xFF,0x5D,0xFF,0xFB,0xFE,0xB6,0xF5,0x0F,0xF4,0x28,0xEA,0x43,0xE9,0x64,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0x71,0xF4,0x14,0xF5,0xBA,0xFE,0x3C,0xFF,0x3C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0xBA,0xFE,0x17,0xFE,
-	0xD3,0xF4,0xCE,0xEB,0xCA,0xF2,0x07,0xF2,0x85,0xE9,0x64,0xF1,0x64,0xF1,0x65,0xE9,0x65,0xF1,0x65,0xF1,0xCE,0xEB,0x30,0xF4,0x54,0xF5,0xB6,0xF5,0x96,0xF5,0x96,0xF5,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x14,0xFD,0x71,0xF4,0x2C,0xEB,0x27,0xEA,0x85,0xF1,0x64,0xF1,0x65,0xE9,
-	0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_5};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_6[] = {
-	//RGB565 data 
-	0xA9,0xEA,0xCA,0xEA,0x0B,0xEB,0x0B,0xEB,0x0B,0xEB,0x2C,0xEB,0x2C,0xEB,0x2C,0xEB,0x0B,0xF3,0x0B,0xF3,0xEB,0xF2,0x0B,0xF3,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xEA,0xAA,0xEA,0x68,0xF2,0x28,0xF2,0x27,0xF2,0x07,0xF2,0x27,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x27,0xE2,0x07,0xE2,0x07,0xE2,0xE7,0xE1,0x07,0xE2,
-	0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x48,0xEA,0x89,0xEA,0x8A,0xF2,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xCA,0xF2,0xEB,0xF2,0x0B,0xF3,0x0B,0xFB,0x2C,0xFB,0x2C,0xFB,0x0B,0xFB,0x0B,0xF3,0xCA,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x07,0xE2,0x28,0xEA,0xEB,0xEA,
-	0xCE,0xF3,0x30,0xFC,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x92,0xFC,0x92,0xFC,0xB2,0xFC,0x91,0xFC,0x0F,0xFC,0x4C,0xF3,0xAA,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xE2,0x27,0xE2,0x48,0xE2,0x89,0xEA,0x0B,0xEB,0x0F,0xF4,0xB2,0xF4,0x75,0xFD,0xF7,0xFD,0x38,0xFE,0x38,0xFE,0x38,0xFE,
-	0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0xD7,0xFD,0x92,0xFC,0x8D,0xF3,0xAA,0xF2,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x27,0xE2,0x27,0xE2,0x89,0xEA,0x4C,0xEB,0xF3,0xF4,0xDB,0xFE,0x7D,0xFF,0x9E,0xFF,0x9E,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,
-	0xBE,0xFF,0xBE,0xFF,0x3C,0xFF,0xF3,0xFC,0x6D,0xF3,0x89,0xF2,0x28,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0x4C,0xEB,0xF3,0xF4,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF3,0xFC,0xEA,0xF2,
-	0x69,0xF2,0x28,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0xCA,0xEA,0x91,0xF4,0x3C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x71,0xFC,0x48,0xF2,0x48,0xF2,0x28,0xF2,0x27,0xE2,0x07,0xE2,0x07,0xE2,
-	0x89,0xEA,0xAE,0xF3,0x96,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x1C,0xFF,0x99,0xFE,0x17,0xFE,0xF7,0xFD,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x96,0xFD,0x8D,0xFB,0x28,0xF2,0x28,0xF2,0x48,0xF2,0x07,0xE2,0xE7,0xE1,0xE6,0xE1,0x0B,0xEB,0xF3,0xF4,0x99,0xFE,0xDF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFB,0xFE,0x34,0xFD,0xCE,0xF3,0x8A,0xF2,0x89,0xEA,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0xCA,0xF2,0xCA,0xF2,0xCA,0xF2,0xAA,0xF2,0xAA,0xF2,0x69,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xE2,0xE6,0xE1,0xC6,0xE1,0x4C,0xEB,0x17,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x17,0xFE,0x8D,0xEB,0x68,0xEA,0xA6,0xE9,
-	0x85,0xE9,0xA6,0xE9,0xA6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0x27,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x07,0xDA,0xE6,0xD9,0xA5,0xE1,0x8D,0xEB,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xF3,0xF4,0x48,0xE2,0xC6,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x27,0xEA,0x27,0xEA,0x27,0xEA,
-	0x27,0xEA,0x27,0xEA,0x28,0xEA,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0xE6,0xE1,0xE6,0xE1,0xCE,0xEB,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0x91,0xF4,0x07,0xEA,0xE6,0xE9,0x68,0xEA,0x68,0xF2,0x68,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x07,0xF2,0xE6,0xF1,0x07,0xF2,0x27,0xF2,
-	0x28,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0xE7,0xE1,0x07,0xE2,0x48,0xE2,0x30,0xF4,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xFF,0x59,0xFE,0x91,0xF4,0xAA,0xEA,0xCA,0xEA,0x6C,0xEB,0x6D,0xF3,0x6D,0xF3,0x6D,0xF3,0x6D,0xF3,0x8D,0xFB,0x4C,0xF3,0x89,0xF2,0x06,0xF2,0x06,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0xE6,0xE1,
-	0x07,0xE2,0x89,0xEA,0x71,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xBA,0xFE,0xD7,0xFD,0x54,0xF5,0x54,0xF5,0xB6,0xF5,0xB6,0xFD,0xB6,0xFD,0xB6,0xFD,0xB6,0xFD,0xB6,0xFD,0x96,0xFD,0x14,0xFD,0x71,0xFC,0x0B,0xFB,0x48,0xF2,0x27,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xA5,0xD9,0x07,0xE2,0xEA,0xEA,0xD3,0xF4,0x7D,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBE,0xFF,0x3C,0xFF,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x92,0xFC,0xCA,0xF2,0x28,0xF2,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0xA5,0xD9,0x48,0xE2,0x8D,0xEB,0x75,0xFD,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xD7,0xFD,0x0F,0xFC,0x89,0xF2,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0xA5,0xD9,0x68,0xE2,0x30,0xF4,0x18,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBB,0xFE,0x34,0xFD,0xEA,0xF2,0xC6,0xF1,0xE6,0xF1,0x07,0xF2,0x84,0xD9,0x68,0xE2,0xD2,0xFC,0x99,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xBA,0xFE,0x17,0xFE,0xB6,0xF5,0xD6,0xFD,0x38,0xFE,0xBA,0xFE,0x3C,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x1C,0xFF,0xB6,0xFD,0x0B,0xFB,0xA5,0xF1,0xE6,0xF1,0xE7,0xF1,0x84,0xD9,0xA9,0xEA,0x34,0xFD,0xFB,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0x38,0xFE,0xF3,0xF4,0x0F,0xF4,0x4C,0xEB,0x8D,0xEB,0x0F,0xFC,0xF3,0xFC,0xF7,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xD7,0xFD,0x2C,0xFB,0xA5,0xF1,0xC6,0xF1,
-	0xE6,0xF1,0x44,0xE1,0xCA,0xEA,0x96,0xFD,0x5D,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xFE,0x91,0xF4,0x8D,0xEB,0x0B,0xF3,0x89,0xEA,0x28,0xEA,0x48,0xEA,0x8A,0xF2,0xEA,0xF2,0xCE,0xF3,0x58,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xF7,0xFD,0x0B,0xFB,0x85,0xF1,0xC6,0xF1,0xE6,0xF1,0x44,0xE1,0xEA,0xEA,0x17,0xFE,0xBE,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xFD,0x68,0xEA,0x85,0xE9,0x85,0xE1,0x85,0xE9,0xA6,0xE9,0xA5,0xE9,0xA5,0xE9,0x85,0xE9,0x48,0xEA,0x96,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xD6,0xFD,0x0B,0xFB,0xA5,0xF1,0xA5,0xF1,0xE6,0xF1,0x03,0xE1,0xEA,0xEA,0x99,0xFE,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0xF3,0xF4,0xE7,0xE9,
-	0x44,0xE1,0x85,0xE1,0x85,0xE9,0xA6,0xE9,0x85,0xE9,0xA5,0xE9,0xC6,0xE9,0xAA,0xEA,0xD7,0xFD,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDB,0xFE,0x34,0xFD,0xCA,0xF2,0x85,0xF1,0xA5,0xF1,0xC6,0xF1,0x44,0xE1,0x0B,0xEB,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0x91,0xF4,0xE6,0xE9,0x44,0xE1,0xC6,0xE1,0xA6,0xE9,0xA6,0xE9,0x85,0xE9,
-	0xA6,0xE9,0x68,0xEA,0xAE,0xF3,0x38,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x58,0xFE,0x92,0xFC,0x89,0xF2,0x85,0xF1,0xA5,0xF1,0xC6,0xF1,0xE6,0xE1,0x8D,0xEB,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xFE,0x71,0xFC,0x85,0xE1,0x03,0xE1,0x44,0xE1,0x43,0xE9,0x43,0xE9,0x43,0xE9,0x64,0xF1,0x8A,0xF2,0x71,0xF4,0x99,0xFE,0xFF,0xFF,
-	0xFF,0xFF,0xBE,0xFF,0xD7,0xFD,0x0F,0xFC,0x69,0xF2,0xA5,0xF1,0xA5,0xF1,0xC6,0xF1,0x68,0xE2,0x0F,0xF4,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0x14,0xFD,0x89,0xEA,0xC6,0xE1,0x07,0xEA,0x07,0xEA,0x07,0xF2,0xE6,0xF1,0x28,0xEA,0xAE,0xF3,0x75,0xFD,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x34,0xFD,0x4C,0xF3,0x28,0xF2,
-	0xA5,0xF1,0xA5,0xF1,0xC6,0xF1,0xEA,0xEA,0x30,0xF4,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xFE,0xD7,0xFD,0x54,0xF5,0xF3,0xFC,0xD2,0xFC,0xF3,0xFC,0xF3,0xFC,0x34,0xFD,0x38,0xFE,0x3C,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x71,0xFC,0x27,0xEA,0xC5,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xA9,0xEA,0x0F,0xF4,
-	0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0x1C,0xFF,0x3C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xBA,0xFE,0x8D,0xF3,0x84,0xE9,0x84,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x84,0xD9,0x4C,0xEB,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xFE,0x92,0xFC,0x89,0xF2,0x84,0xE9,0x84,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0x03,0xE1,0x68,0xE2,0xD7,0xFD,0x5D,0xFF,0xBE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9D,0xFF,0x1C,0xFF,0xF3,0xFC,0xEB,0xF2,0xE6,0xF1,0x84,0xE9,0x84,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x03,0xE1,0xC6,0xE1,0x2C,0xEB,0xF3,0xF4,0xBA,0xFE,0x5D,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x5D,0xFF,0xFB,0xFE,
-	0xD6,0xFD,0x71,0xFC,0xCA,0xF2,0xA6,0xE9,0x65,0xE9,0x64,0xF1,0x84,0xE9,0x65,0xE9,0x65,0xF1,0x65,0xF1,0x84,0xD9,0xA5,0xD9,0xE6,0xE1,0x2C,0xEB,0x14,0xF5,0xB6,0xF5,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x96,0xFD,0x55,0xFD,0x0F,0xFC,0xCA,0xF2,0xE6,0xF1,0x64,0xF1,0x65,0xE9,
-	0xA5,0xE9,0xA5,0xE9,0xA6,0xE9,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_6 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_6),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_6};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_7[] = {
-	//RGB565 data 
-	0x07,0xE2,0x27,0xE2,0x27,0xE2,0x68,0xE2,0xEA,0xEA,0x0B,0xEB,0x0B,0xEB,0x0B,0xF3,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0x0B,0xF3,0xEB,0xF2,0xAA,0xF2,0x48,0xF2,0x28,0xF2,0x07,0xF2,0x27,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x27,0xE2,
-	0x48,0xE2,0xA9,0xEA,0xCA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xEA,0xF2,0x0B,0xF3,0x0B,0xFB,0x2C,0xFB,0x2C,0xFB,0x0B,0xFB,0xEA,0xF2,0xAA,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x89,0xEA,0x4C,0xEB,0x71,0xF4,0xB2,0xF4,0x91,0xF4,0x91,0xF4,
-	0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x92,0xFC,0x92,0xFC,0xD2,0xFC,0x71,0xFC,0x8D,0xFB,0xEA,0xF2,0x89,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xE2,0x27,0xE2,0x89,0xEA,0x4C,0xEB,0x91,0xF4,0x17,0xFE,0x58,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,
-	0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x58,0xFE,0xD6,0xFD,0x30,0xFC,0x0B,0xF3,0x89,0xF2,0x48,0xF2,0x28,0xE2,0x27,0xE2,0x07,0xE2,0xEA,0xEA,0x71,0xF4,0x17,0xFE,0x7D,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,
-	0xBE,0xFF,0xBE,0xFF,0x3C,0xFF,0xF3,0xFC,0x4C,0xF3,0x89,0xF2,0x28,0xF2,0x28,0xE2,0x07,0xE2,0xE7,0xE1,0x0B,0xEB,0xF3,0xF4,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xF3,0xFC,0x0B,0xF3,
-	0x69,0xF2,0x28,0xF2,0x28,0xE2,0x07,0xE2,0xE7,0xE1,0x0B,0xEB,0x14,0xF5,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xFF,0x71,0xFC,0x69,0xF2,0x48,0xF2,0x28,0xF2,0x27,0xE2,0x07,0xE2,0x07,0xE2,
-	0xCA,0xEA,0x0F,0xF4,0xF3,0xF4,0xD7,0xFD,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x17,0xFE,0x38,0xFE,0xBA,0xFE,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xBA,0xFE,0xCE,0xF3,0x27,0xF2,0x28,0xF2,0x48,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x27,0xE2,0x48,0xE2,0x68,0xE2,0x89,0xEA,0x89,0xEA,
-	0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x8A,0xF2,0x89,0xEA,0x8A,0xF2,0x8D,0xF3,0xB2,0xFC,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBB,0xFE,0x34,0xFD,0x2C,0xFB,0x27,0xF2,0x28,0xF2,0x48,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0xE6,0xE1,0xC6,0xE1,0x85,0xE1,0x85,0xE1,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,
-	0xA5,0xE9,0x07,0xF2,0xAE,0xF3,0x96,0xFD,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x55,0xFD,0x8D,0xFB,0x89,0xF2,0x27,0xF2,0x28,0xF2,0x48,0xF2,0x07,0xDA,0x07,0xDA,0x07,0xE2,0x07,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x28,0xF2,0x0B,0xF3,0x75,0xFD,0xBE,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xFF,0xBA,0xFE,0xCE,0xF3,0x07,0xF2,0x07,0xF2,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE6,0xE9,0x07,0xEA,0x4C,0xF3,0xF3,0xFC,0xBB,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBA,0xFE,0xF3,0xFC,0xEA,0xF2,0xC6,0xF1,
-	0xE7,0xF1,0x28,0xF2,0x28,0xF2,0x28,0xF2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xE2,0x07,0xEA,0x07,0xEA,0xE6,0xF1,0x07,0xEA,0xE6,0xF1,0x48,0xEA,0x91,0xF4,0xFB,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xF3,0xFC,0x0B,0xF3,0x48,0xF2,0x07,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0x27,0xF2,0xE6,0xE1,
-	0xE6,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0x07,0xEA,0x07,0xEA,0xE6,0xE9,0xE6,0xE9,0x89,0xEA,0xCE,0xEB,0xD7,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xD7,0xFD,0xAE,0xF3,0x28,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,0xE7,0xE1,
-	0xE7,0xE1,0xE7,0xE1,0x07,0xE2,0xE6,0xE9,0xE6,0xF1,0x8D,0xF3,0xB6,0xF5,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFD,0x0F,0xFC,0xCA,0xF2,0xE6,0xE9,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE6,0xE1,0xE6,0xE9,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0x07,0xEA,0xCA,0xF2,
-	0xD2,0xFC,0x1C,0xFF,0xBE,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xFE,0xB2,0xFC,0xCA,0xF2,0x27,0xEA,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xE6,0xD9,0xE6,0xD9,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xE6,0xE1,0xC6,0xE1,0xC6,0xE1,0xA9,0xEA,0x0F,0xFC,0x18,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,
-	0x75,0xFD,0x6D,0xF3,0xE6,0xE9,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0x07,0xF2,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x07,0xEA,0xCE,0xEB,0x17,0xFE,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xD6,0xFD,0x8D,0xF3,0x48,0xF2,0xC5,0xE9,0xC6,0xF1,0xE7,0xF1,
-	0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xE7,0xF1,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x07,0xEA,0xEB,0xEA,0x14,0xF5,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x71,0xFC,0x07,0xEA,0xC5,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,
-	0xE6,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,0xC6,0xE1,0xC6,0xE1,0x85,0xE1,0x85,0xE1,0xEA,0xEA,0xF3,0xFC,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xFE,0xD3,0xF4,0x0B,0xF3,0xC5,0xE9,0xA5,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,
-	0xC6,0xE1,0xC6,0xE1,0x07,0xE2,0x0F,0xF4,0xBB,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x55,0xFD,0xAA,0xEA,0x07,0xEA,0xC6,0xE9,0xC5,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xA5,0xD9,0xA5,0xD9,0xA5,0xE1,0x85,0xE1,0x44,0xE1,0x28,0xE2,0xCE,0xEB,0xB6,0xF5,0x9E,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x18,0xFE,0xCE,0xF3,0xE7,0xE9,0xA5,0xE9,0xC5,0xE9,0xC5,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x0B,0xEB,0x96,0xF5,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xFE,0x30,0xFC,0x8A,0xF2,
-	0xA5,0xE9,0x85,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0x84,0xD9,0x85,0xE1,0xC6,0xE1,0x89,0xEA,0x71,0xF4,0xFB,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x14,0xFD,0x89,0xF2,0xA6,0xE9,0xA5,0xE9,0xA5,0xE9,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,
-	0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xE9,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xA5,0xD9,0x84,0xD9,0x85,0xE1,0x48,0xE2,0x0F,0xF4,0xD7,0xFD,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x38,0xFE,0xCE,0xF3,0x84,0xE9,0x43,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA6,0xE9,0xC5,0xE9,0xC5,0xE9,0xC5,0xE9,0xC6,0xF1,
-	0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0x84,0xD9,0x84,0xD9,0xC6,0xE1,0x4C,0xEB,0x17,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xFE,0x8D,0xF3,0x27,0xEA,0x85,0xE9,0x64,0xE9,0x85,0xE9,0xA5,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0xE6,0xD9,
-	0xCA,0xEA,0xB2,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x5D,0xFF,0xD3,0xF4,0xE6,0xE9,0x43,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x68,0xE2,0xF3,0xF4,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFB,0xFE,0xB2,0xF4,0xEB,0xEA,0x85,0xE9,0x64,0xE9,0x84,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0xC6,0xD9,0x2C,0xEB,0x38,0xFE,0xBE,0xFF,0xDF,0xFF,0xBE,0xFF,0x9E,0xFF,0xB6,0xF5,0xCA,0xF2,0xC6,0xE1,0x85,0xE1,0x64,0xE9,
-	0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,0x84,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0xEA,0xEA,0x0F,0xF4,0x58,0xFE,0x5D,0xFF,0x3C,0xFF,0xBA,0xFE,0xD7,0xFD,0x0F,0xF4,0xE6,0xE9,0x44,0xE1,0x85,0xE1,0x64,0xE9,0x85,0xE9,0x84,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xE9,
-	0x65,0xE9,0x84,0xE9,0x84,0xE9,0x84,0xE9,0x84,0xE9,0x84,0xE9,0x84,0xE9,0x65,0xE9,0x65,0xF1,0x65,0xF1,0x0B,0xEB,0xCE,0xEB,0x54,0xF5,0xB6,0xF5,0xB6,0xF5,0x14,0xF5,0x30,0xF4,0x0B,0xF3,0xA6,0xE9,0x64,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0x85,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,
-	0xA5,0xE9,0xA6,0xE9,0xA6,0xE9,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_7 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_7),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_7};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_8[] = {
-	//RGB565 data 
-	0x89,0xEA,0xA9,0xEA,0x0B,0xEB,0x0B,0xEB,0x0B,0xEB,0x0B,0xEB,0xEA,0xEA,0xA9,0xEA,0x48,0xEA,0x27,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE7,0xE9,0xE7,0xE9,0xE7,0xE9,0xE7,0xE9,0xE6,0xF1,0xE7,0xF1,0x07,0xF2,0x27,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x27,0xE2,0x27,0xE2,0x07,0xE2,0xE7,0xE1,0x07,0xE2,
-	0x07,0xE2,0x27,0xE2,0x48,0xE2,0x89,0xEA,0xCA,0xF2,0x0B,0xEB,0x4C,0xEB,0x6D,0xF3,0x6D,0xF3,0x8D,0xF3,0x8D,0xEB,0x8D,0xF3,0x8D,0xF3,0x8D,0xFB,0x4C,0xF3,0x2C,0xFB,0xEA,0xF2,0xAA,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x27,0xE2,0x89,0xEA,0x6C,0xEB,
-	0x91,0xF4,0x14,0xFD,0x75,0xFD,0xD6,0xFD,0xD7,0xFD,0xF7,0xFD,0xD7,0xFD,0xF7,0xFD,0xD7,0xFD,0x55,0xFD,0xB2,0xFC,0xCE,0xF3,0x0B,0xFB,0x89,0xF2,0x48,0xF2,0x69,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x48,0xE2,0xA9,0xEA,0x4C,0xEB,0x30,0xF4,0x14,0xF5,0x18,0xFE,0xBA,0xFE,0xFB,0xFE,0x3C,0xFF,0x7D,0xFF,
-	0x7D,0xFF,0x5D,0xFF,0x7D,0xFF,0x5D,0xFF,0xDB,0xFE,0x58,0xFE,0x75,0xFD,0x92,0xFC,0x6D,0xF3,0x89,0xF2,0x69,0xF2,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x27,0xE2,0x27,0xE2,0xA9,0xEA,0xAE,0xF3,0x55,0xFD,0x3C,0xFF,0x7D,0xFF,0xBE,0xFF,0xBE,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-	0xBE,0xFF,0x9D,0xFF,0xFB,0xFE,0xF3,0xFC,0x6D,0xF3,0x89,0xF2,0x28,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x27,0xE2,0x27,0xE2,0x4C,0xEB,0x14,0xFD,0xBB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xFE,0x30,0xFC,
-	0xCA,0xF2,0x27,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x68,0xE2,0x30,0xF4,0xFB,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x5D,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDB,0xFE,0x34,0xFD,0x0B,0xFB,0xE6,0xF1,0x27,0xE2,0x07,0xE2,0x07,0xE2,
-	0x48,0xE2,0x0B,0xEB,0x14,0xF5,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7D,0xFF,0xBA,0xFE,0x17,0xFE,0x96,0xFD,0x34,0xFD,0x75,0xFD,0xD7,0xFD,0x58,0xFE,0xBB,0xFE,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0xB6,0xFD,0x2C,0xFB,0xE6,0xF1,0x07,0xE2,0xE7,0xE1,0xE6,0xE1,0xA9,0xEA,0x0F,0xF4,0xD6,0xFD,0xBE,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x7D,0xFF,0x38,0xFE,0x71,0xF4,0x8A,0xF2,0x68,0xEA,0x89,0xEA,0x89,0xEA,0x8A,0xF2,0x6D,0xF3,0xB2,0xFC,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x5D,0xFF,0xD6,0xFD,0x2C,0xFB,0xE6,0xF1,0x07,0xE2,0xE6,0xE1,0xE6,0xE1,0xEA,0xEA,0xD3,0xF4,0x99,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xFE,0xB2,0xF4,0x0B,0xF3,0xC6,0xE9,
-	0xA5,0xE9,0xC6,0xE9,0xA6,0xE9,0xE6,0xE9,0x48,0xF2,0xAE,0xF3,0x79,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1C,0xFF,0x75,0xFD,0x0B,0xFB,0xE6,0xF1,0x07,0xDA,0xE6,0xD9,0xC6,0xE1,0x0B,0xEB,0x96,0xF5,0x1C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xFE,0x0B,0xEB,0x27,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x27,0xEA,0x28,0xEA,0x68,0xF2,
-	0x8D,0xFB,0x58,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBB,0xFE,0x14,0xFD,0xEA,0xF2,0xE6,0xF1,0x07,0xE2,0xE6,0xE1,0xC6,0xE1,0x2C,0xEB,0xD7,0xFD,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xFD,0xCA,0xF2,0xE6,0xE9,0xC6,0xE9,0xC5,0xE9,0xE6,0xE9,0xC5,0xE9,0xE6,0xF1,0xEA,0xF2,0x71,0xFC,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,
-	0x38,0xFE,0x91,0xFC,0xCA,0xF2,0xE6,0xF1,0x07,0xE2,0xE6,0xE1,0xC6,0xE1,0x4C,0xEB,0xF7,0xFD,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xFE,0x8D,0xEB,0x68,0xEA,0xE6,0xF1,0xE6,0xE9,0xE6,0xF1,0xC5,0xE9,0x07,0xEA,0x0F,0xFC,0xD7,0xFD,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x96,0xFD,0xCE,0xF3,0x89,0xF2,0x06,0xF2,0xE6,0xE1,
-	0xE6,0xE1,0xC6,0xE1,0x0B,0xEB,0xB6,0xFD,0x3C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0xB6,0xF5,0xB2,0xFC,0x0F,0xFC,0xCE,0xF3,0x0F,0xFC,0x30,0xFC,0xB2,0xFC,0xF7,0xFD,0x1C,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x71,0xFC,0xAA,0xF2,0x27,0xF2,0x06,0xF2,0xE6,0xD9,0xC6,0xE1,0xA5,0xE1,0xEB,0xEA,0x14,0xF5,0xBA,0xFE,
-	0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x99,0xFE,0x79,0xFE,0x99,0xFE,0x1C,0xFF,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x79,0xFE,0x6D,0xF3,0xA5,0xF1,0xE6,0xF1,0x07,0xF2,0xE6,0xD9,0xC6,0xE1,0x85,0xE1,0x48,0xE2,0xCE,0xEB,0xD7,0xFD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xF7,0xFD,0x30,0xFC,0x89,0xF2,0xC6,0xF1,0xE6,0xF1,0x07,0xF2,0xE6,0xD9,0xC6,0xE1,0xC6,0xE1,0x27,0xE2,0x4C,0xEB,0x54,0xF5,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xB2,0xFC,0xAA,0xF2,0x27,0xF2,0xE6,0xF1,0x07,0xF2,0x07,0xF2,0xA5,0xD9,0xE6,0xD9,0x48,0xE2,0x8D,0xEB,0x75,0xFD,0xBA,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1C,0xFF,0xBA,0xFE,0xBA,0xFE,0x99,0xFE,0xBA,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
-	0x38,0xFE,0x91,0xFC,0xCA,0xF2,0xC6,0xF1,0xE6,0xF1,0xE7,0xF1,0xA5,0xD9,0x27,0xE2,0x4C,0xEB,0x54,0xF5,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xFE,0xB6,0xF5,0x14,0xF5,0xD3,0xF4,0xB2,0xF4,0xD3,0xF4,0xF7,0xFD,0x1C,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xFE,0x6D,0xF3,0xA5,0xF1,0xC6,0xF1,
-	0xE6,0xF1,0x84,0xD9,0x68,0xE2,0xD3,0xF4,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x55,0xFD,0x30,0xF4,0x6C,0xEB,0x0B,0xF3,0xEB,0xF2,0xCA,0xF2,0xEB,0xF2,0x6D,0xF3,0x91,0xF4,0x99,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x8D,0xFB,0x65,0xF1,0xA5,0xF1,0xE6,0xF1,0x44,0xE1,0xEA,0xEA,0x38,0xFE,0xBE,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xFE,0x0B,0xEB,0xE7,0xE1,0x85,0xE1,0x85,0xE9,0xA5,0xE9,0xA5,0xE9,0xA5,0xE9,0x65,0xE9,0x28,0xEA,0x96,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x8D,0xFB,0x65,0xF1,0xA5,0xF1,0xE6,0xF1,0x44,0xE1,0x0B,0xEB,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x54,0xF5,0x28,0xEA,
-	0x64,0xE9,0x85,0xE1,0x85,0xE9,0x85,0xE9,0xA5,0xE9,0x85,0xE9,0x43,0xE9,0xA5,0xE9,0x54,0xF5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x8D,0xFB,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x85,0xE1,0x6C,0xEB,0xFB,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0xD3,0xF4,0xE6,0xE9,0x44,0xE1,0xC6,0xE1,0xA6,0xE9,0xA6,0xE9,0xA6,0xE9,
-	0xA6,0xE9,0x65,0xE9,0x28,0xEA,0x96,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xFE,0x4C,0xF3,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x68,0xE2,0x0F,0xF4,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x14,0xFD,0xC6,0xE9,0x03,0xE1,0x64,0xE9,0x64,0xE9,0x64,0xF1,0x43,0xE9,0x64,0xF1,0x89,0xF2,0x71,0xFC,0xBA,0xFE,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0x18,0xFE,0x0B,0xFB,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0xEA,0xEA,0x30,0xF4,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xFD,0xEB,0xEA,0xE7,0xE9,0xE6,0xE9,0xE6,0xE9,0xE6,0xE9,0xC6,0xE9,0x28,0xEA,0x30,0xFC,0x58,0xFE,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBB,0xFE,0x34,0xFD,0xCA,0xF2,
-	0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0x0B,0xEB,0x71,0xF4,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xD7,0xFD,0xB2,0xFC,0x0F,0xF4,0x8D,0xEB,0x8D,0xF3,0x30,0xFC,0x34,0xFD,0x99,0xFE,0x9D,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xFE,0x30,0xFC,0x48,0xF2,0x84,0xF1,0x85,0xF1,0xA5,0xF1,0xA9,0xEA,0x0F,0xF4,
-	0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xFE,0xD7,0xFD,0x55,0xFD,0x55,0xFD,0x58,0xFE,0x5D,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x14,0xFD,0x0B,0xF3,0x07,0xEA,0x84,0xF1,0xA5,0xF1,0xA5,0xF1,0x84,0xD9,0x2C,0xEB,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x9D,0xFF,0x5D,0xFF,0x5D,0xFF,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xF7,0xFD,0x8D,0xF3,0xE6,0xE9,0xA5,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x03,0xE1,0x68,0xE2,0x75,0xFD,0x3C,0xFF,0x9D,0xFF,0xBE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBE,0xFF,0x9D,0xFF,0x3C,0xFF,0xD7,0xFD,0x30,0xFC,0x48,0xF2,0x43,0xE9,0x64,0xF1,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0x03,0xE1,0xA5,0xE1,0xEA,0xEA,0x30,0xF4,0xB6,0xF5,0x99,0xFE,0xFB,0xFE,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0x1C,0xFF,0xFB,0xFE,0xBA,0xFE,
-	0xD6,0xFD,0xB2,0xFC,0x4C,0xF3,0x07,0xF2,0x85,0xE9,0x64,0xF1,0x64,0xF1,0x65,0xE9,0x65,0xF1,0x65,0xF1,0x84,0xD9,0x84,0xD9,0xA5,0xE1,0xA9,0xEA,0x0F,0xF4,0xF3,0xF4,0x75,0xFD,0x96,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x75,0xFD,0x55,0xFD,0x14,0xFD,0x30,0xFC,0x0B,0xF3,0xE6,0xF1,0x64,0xF1,0x65,0xE9,
-	0xA5,0xE9,0xA6,0xE9,0xA6,0xE9,0xA5,0xF1,0xA5,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_8 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_8),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_8};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_10_360030_data_9[] = {
-	//RGB565 data 
-	0x07,0xE2,0x07,0xE2,0x27,0xE2,0x48,0xE2,0xCA,0xEA,0x0B,0xEB,0x2C,0xEB,0x2C,0xEB,0x0B,0xF3,0x0B,0xF3,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xF2,0xEB,0xEA,0xAA,0xF2,0x69,0xF2,0x28,0xF2,0x07,0xF2,0x27,0xF2,0x28,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0x27,0xE2,
-	0x07,0xE2,0x07,0xE2,0x27,0xE2,0x48,0xEA,0x89,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xAA,0xEA,0xEA,0xF2,0xEA,0xF2,0x0B,0xFB,0x2C,0xFB,0x2C,0xFB,0x0B,0xF3,0xAA,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x27,0xE2,0xE7,0xE1,0x48,0xE2,0x0B,0xEB,0xCE,0xEB,
-	0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x91,0xF4,0x92,0xFC,0x92,0xFC,0x92,0xFC,0x30,0xFC,0x0B,0xF3,0x48,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xE2,0x27,0xE2,0x68,0xE2,0xEA,0xEA,0xCE,0xEB,0xD3,0xF4,0x96,0xF5,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,
-	0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0x38,0xFE,0xB6,0xFD,0x91,0xFC,0x6D,0xF3,0xAA,0xF2,0x48,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x07,0xE2,0x07,0xE2,0xEA,0xEA,0x91,0xF4,0x17,0xFE,0x5D,0xFF,0x9E,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,
-	0xBE,0xFF,0xBE,0xFF,0x7D,0xFF,0xBB,0xFE,0x55,0xFD,0x0B,0xFB,0x07,0xF2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x28,0xE2,0x48,0xE2,0xCE,0xEB,0x17,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x79,0xFE,
-	0x6D,0xF3,0xE6,0xF1,0x28,0xE2,0x28,0xE2,0x27,0xE2,0x68,0xEA,0xEB,0xEA,0xD3,0xF4,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xFE,0x8D,0xFB,0xC6,0xF1,0x27,0xE2,0x07,0xE2,0x07,0xE2,
-	0xCA,0xEA,0x0F,0xF4,0xD7,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x5D,0xFF,0xBA,0xFE,0x38,0xFE,0x17,0xFE,0x17,0xFE,0xD7,0xFD,0x17,0xFE,0xBA,0xFE,0x3C,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x8D,0xFB,0xC6,0xF1,0x07,0xE2,0xE7,0xE1,0xE6,0xE1,0x0B,0xEB,0x75,0xFD,0xFB,0xFE,0xDF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x3C,0xFF,0x17,0xFE,0x71,0xF4,0x0B,0xF3,0x8A,0xF2,0x8A,0xF2,0x68,0xEA,0xAA,0xEA,0x30,0xF4,0xD6,0xFD,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xFF,0x8D,0xFB,0xC6,0xF1,0x07,0xE2,0xE6,0xE1,0x85,0xE1,0x6C,0xEB,0x59,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x58,0xFE,0x30,0xF4,0xCA,0xF2,0x07,0xEA,
-	0xC5,0xE9,0xC6,0xE9,0xA5,0xE9,0xE6,0xE9,0xEB,0xEA,0x71,0xFC,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBA,0xFE,0x6D,0xF3,0xC6,0xF1,0x07,0xDA,0xE6,0xD9,0x85,0xE1,0x8D,0xEB,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x14,0xF5,0x48,0xE2,0xC6,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x28,0xEA,0x48,0xF2,
-	0x4C,0xF3,0x38,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x38,0xFE,0x4C,0xF3,0xC6,0xF1,0x07,0xE2,0x07,0xE2,0x27,0xE2,0x30,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1C,0xFF,0xB2,0xF4,0xE6,0xE9,0x85,0xE9,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0xE6,0xF1,0x07,0xF2,0x68,0xF2,0x8D,0xFB,0x58,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x7D,0xFF,0xD6,0xFD,0x0B,0xFB,0xC6,0xF1,0xE6,0xE1,0x27,0xE2,0xEB,0xEA,0xD3,0xF4,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xFE,0x91,0xFC,0x27,0xEA,0xA5,0xE9,0x07,0xEA,0x07,0xEA,0x07,0xEA,0xE6,0xE9,0x07,0xEA,0x0B,0xF3,0x71,0xFC,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1C,0xFF,0x75,0xFD,0xEA,0xF2,0xC6,0xF1,0xC6,0xE1,
-	0x27,0xE2,0x0B,0xF3,0xF3,0xF4,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xFF,0x34,0xFD,0xCA,0xF2,0x28,0xEA,0x68,0xEA,0x68,0xEA,0x68,0xEA,0x89,0xEA,0x0B,0xF3,0x91,0xFC,0x38,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBA,0xFE,0xF3,0xFC,0xCA,0xF2,0xC6,0xF1,0xA5,0xD9,0x07,0xE2,0xEA,0xEA,0xD3,0xF4,0x7D,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x38,0xFE,0x0F,0xFC,0x6D,0xF3,0x8D,0xEB,0x6C,0xEB,0x8D,0xEB,0xAE,0xF3,0x71,0xFC,0x58,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x38,0xFE,0x71,0xFC,0x89,0xF2,0xC6,0xF1,0xA5,0xD9,0x07,0xE2,0xCA,0xEA,0xB2,0xFC,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x38,0xFE,
-	0xD7,0xFD,0xD7,0xFD,0xD7,0xFD,0xD7,0xFD,0x17,0xFE,0x79,0xFE,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x75,0xFD,0xAE,0xF3,0x69,0xF2,0xC6,0xF1,0xA5,0xD9,0x07,0xE2,0x89,0xEA,0x71,0xFC,0x7D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xF3,0xFC,0xEA,0xF2,0x28,0xF2,0xE6,0xF1,0xC6,0xD9,0xC6,0xE1,0xE6,0xE9,0xAE,0xF3,0xBB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x7D,0xFF,0x91,0xFC,0x89,0xF2,0x07,0xF2,0xE6,0xF1,0xC6,0xD9,0xA5,0xD9,0x85,0xE1,0xEB,0xEA,0xB6,0xFD,0x3C,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0x30,0xFC,0x28,0xF2,0xE6,0xF1,
-	0xE6,0xF1,0xC6,0xD9,0xA5,0xD9,0xA5,0xD9,0x27,0xE2,0x8D,0xEB,0x91,0xF4,0x54,0xF5,0x75,0xFD,0x55,0xFD,0x54,0xF5,0x54,0xF5,0x54,0xF5,0x54,0xF5,0x75,0xFD,0x75,0xFD,0x14,0xF5,0x14,0xF5,0xBA,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xCE,0xF3,0xC6,0xF1,0xC6,0xF1,0xC6,0xF1,0xC6,0xD9,0xC6,0xD9,0xC6,0xD9,0xC6,0xE1,
-	0xE6,0xE1,0x48,0xE2,0xEB,0xEA,0x0B,0xEB,0x0B,0xF3,0x0B,0xF3,0x0B,0xF3,0x0B,0xF3,0x0B,0xF3,0x2C,0xEB,0x2C,0xEB,0x8A,0xF2,0x0B,0xF3,0xD7,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0x8D,0xFB,0x65,0xF1,0xA5,0xF1,0xE6,0xF1,0xA5,0xD9,0xA5,0xD9,0xA5,0xE1,0xA5,0xE1,0x85,0xE1,0xC6,0xE1,0x07,0xEA,0x07,0xE2,0x07,0xE2,
-	0x07,0xE2,0x07,0xE2,0x27,0xEA,0x27,0xEA,0x27,0xEA,0x27,0xEA,0x07,0xF2,0xCA,0xF2,0xD6,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x99,0xFE,0x2C,0xFB,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xD9,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE1,0x85,0xE9,0xA5,0xE9,0x85,0xE9,
-	0xA5,0xE9,0x07,0xF2,0x4C,0xF3,0x18,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xB6,0xFD,0xEA,0xF2,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xD9,0x85,0xE1,0x64,0xE9,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x44,0xE1,0x43,0xE9,0x43,0xE9,0x43,0xE9,0x43,0xE9,0x89,0xF2,0x30,0xFC,0x99,0xFE,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xFF,0xBA,0xFE,0x14,0xFD,0xCA,0xF2,0x65,0xF1,0xA5,0xF1,0xC6,0xF1,0xA5,0xD9,0xA5,0xD9,0xC6,0xE1,0xE6,0xE9,0x07,0xE2,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xEA,0x07,0xF2,0xE6,0xF1,0x28,0xEA,0xAE,0xF3,0x75,0xFD,0x1C,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xD7,0xFD,0x0F,0xFC,0x69,0xF2,
-	0x85,0xF1,0xA5,0xF1,0xC6,0xF1,0x84,0xD9,0xC6,0xE1,0xCA,0xEA,0xCE,0xEB,0xB2,0xF4,0x14,0xF5,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0xF3,0xFC,0x14,0xFD,0x75,0xFD,0x59,0xFE,0x3C,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x92,0xFC,0x68,0xF2,0xC6,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x07,0xE2,
-	0xCE,0xEB,0x75,0xFD,0xBA,0xFE,0x3C,0xFF,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0xFB,0xFE,0x5D,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0x99,0xFE,0x6D,0xF3,0x84,0xE9,0x84,0xE9,0x85,0xF1,0xA5,0xF1,0xA5,0xF1,0x44,0xE1,0x68,0xE2,0x14,0xF5,0xBA,0xFE,0xBE,0xFF,0xFF,0xFF,0xDF,0xFF,
-	0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x96,0xFD,0xCE,0xF3,0x48,0xF2,0x84,0xE9,0x84,0xE9,0xA5,0xE9,0xA5,0xF1,0xA5,0xF1,0x03,0xE1,0x68,0xE2,0x75,0xFD,0x3C,0xFF,0xBE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-	0xDF,0xFF,0xBE,0xFF,0x9E,0xFF,0x7D,0xFF,0x3C,0xFF,0xDB,0xFE,0xF7,0xFD,0xAE,0xF3,0xE6,0xF1,0x85,0xF1,0x84,0xE9,0xA5,0xE9,0x85,0xF1,0x85,0xF1,0xA5,0xF1,0x03,0xE1,0x48,0xE2,0xF3,0xF4,0x59,0xFE,0xBA,0xFE,0xDB,0xFE,0xBB,0xFE,0xBB,0xFE,0xBB,0xFE,0xBB,0xFE,0xBB,0xFE,0xDB,0xFE,0xBB,0xFE,0x99,0xFE,0x18,0xFE,0x75,0xFD,0xB2,0xFC,
-	0x8D,0xF3,0x89,0xF2,0xE6,0xF1,0x85,0xF1,0x85,0xF1,0x65,0xE9,0x84,0xE9,0x85,0xF1,0x85,0xF1,0x85,0xF1,0x03,0xE1,0x27,0xE2,0xB2,0xF4,0x17,0xFE,0x38,0xFE,0x59,0xFE,0x58,0xFE,0x58,0xFE,0x58,0xFE,0x58,0xFE,0x58,0xFE,0x79,0xFE,0x58,0xFE,0xF7,0xFD,0x34,0xFD,0x91,0xFC,0x8D,0xF3,0xE6,0xF1,0x03,0xE1,0x43,0xE9,0x64,0xF1,0x65,0xE9,
-	0x65,0xE9,0x65,0xE9,0x65,0xE9,0x65,0xF1,0x65,0xF1,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_10_360030_9 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 27,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_10_360030_data_9),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_10_360030_data_9};
-
-    
\ No newline at end of file
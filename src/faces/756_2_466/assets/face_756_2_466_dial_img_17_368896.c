@@ -1,463 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#include "../756_2_466.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0x85,0x99,0xA2,0x40,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0x85,0x99,0x07,0xCA,0x69,0xEA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x07,0xCA,0x85,0x99,0x04,0x69,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x07,0xCA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xF2,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x07,0xCA,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x69,0xEA,0xAA,0xFA,0x89,0xF2,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x00,0x00,0x61,0x28,
-	0x04,0x69,0xE7,0xB9,0x69,0xEA,0x89,0xFA,0x89,0xF2,0x07,0xCA,0x85,0x99,0x04,0x69,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x00,0x00,0x61,0x28,0x85,0x99,0x48,0xE2,0x69,0xEA,0x69,0xEA,0x07,0xCA,0x85,0x99,0xA2,0x40,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,
-	0x40,0x10,0x61,0x28,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x00,0x00,0x61,0x28,0xE7,0xB9,0x69,0xEA,0x69,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x00,0x00,0x61,0x28,0xE7,0xB9,
-	0x89,0xF2,0x89,0xF2,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x00,0x00,0x61,0x28,0x07,0xCA,0xAA,0xFA,0x89,0xF2,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x69,0xEA,0x07,0xCA,0xE7,0xB9,0x40,0x10,0xA2,0x40,0x07,0xCA,0xAA,0xFA,0x89,0xF2,0xE7,0xB9,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x07,0xCA,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x61,0x28,0x04,0x69,0x07,0xCA,0xAA,0xFA,
-	0x89,0xF2,0xE7,0xB9,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x99,0x48,0xE2,0x89,0xF2,0x48,0xE2,0x85,0x99,0x04,0x69,0xA2,0x40,0x04,0x69,0x07,0xCA,0xAA,0xFA,0x89,0xFA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x85,0x99,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x04,0x69,0x85,0x99,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0x85,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x85,0x99,0x89,0xFA,0xAA,0xFA,0x07,0xCA,0x04,0x69,0xA2,0x40,0x04,0x69,0x85,0x99,0x48,0xE2,0x89,0xFA,0x69,0xEA,
-	0x85,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x89,0xFA,0xAA,0xFA,0x07,0xCA,0x04,0x69,0xA2,0x40,0x04,0x69,0x85,0x99,0x48,0xE2,0x89,0xF2,0x48,0xE2,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0xE7,0xB9,
-	0x89,0xF2,0xAA,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x85,0x99,0xE7,0xB9,0x48,0xE2,0x69,0xEA,0x07,0xCA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x89,0xF2,0xAA,0xFA,0x07,0xCA,0xA2,0x40,0x40,0x10,0xE7,0xB9,0x07,0xCA,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0x04,0x69,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x89,0xF2,0xAA,0xFA,0x07,0xCA,0x61,0x28,0x00,0x00,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0x07,0xCA,0x89,0xF2,
-	0x69,0xF2,0xE7,0xB9,0x61,0x28,0x00,0x00,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xF2,0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x61,0x28,
-	0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x61,0x28,0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x07,0xCA,0x85,0x99,0x04,0x69,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x04,0x69,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x89,0xFA,0x48,0xE2,0xE7,0xB9,
-	0x04,0x69,0x40,0x10,0x00,0x00,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xF2,0xAA,0xFA,0x69,0xEA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x07,0xCA,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xEA,0x69,0xEA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x85,0x99,0x07,0xCA,0x89,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xF2,0x07,0xCA,0x85,0x99,0x04,0x69,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0xA2,0x40,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0x85,0x99,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x48,0xE2,0x69,0xF2,0x89,0xFA,
-	0x69,0xEA,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xEA,0x89,0xFA,0x69,0xEA,0x85,0x99,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x69,0xEA,0xAA,0xFA,0x69,0xEA,
-	0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,0x85,0x99,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0x04,0x69,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x69,0xF2,0x07,0xCA,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xEA,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x48,0xE2,0x69,0xEA,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x40,0x07,0xCA,0x69,0xF2,0x69,0xEA,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x04,0x69,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x69,0xEA,0xAA,0xFA,0x69,0xF2,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,
-	0x85,0x99,0x69,0xEA,0xAA,0xFA,0x48,0xE2,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x89,0xF2,0x48,0xE2,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xEA,0xE7,0xB9,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x48,0xE2,
-	0x69,0xF2,0x48,0xE2,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x07,0xCA,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x69,0xEA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xF2,0x48,0xE2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x69,0xEA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xEA,0x69,0xF2,0x07,0xCA,0x85,0x99,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x69,0xEA,0x89,0xF2,0x69,0xEA,0x07,0xCA,0xE7,0xB9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
-	0x40,0x10,0x40,0x10,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x48,0xE2,0x69,0xF2,0x69,0xEA,0x48,0xE2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x10,0x85,0x99,0x48,0xE2,0x69,0xEA,0x69,0xEA,0x07,0xCA,0x07,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,0xA2,0x40,0x04,0x69,0x85,0x99,0xE7,0xB9,0x69,0xEA,0x89,0xFA,0x69,0xEA,0xE7,0xB9,0x85,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0x04,0x69,0x85,0x99,0x07,0xCA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x04,0x69,0x04,0x69,0x85,0x99,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x69,0xF2,0xAA,0xFA,
-	0xAA,0xFA,0x69,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xEA,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x07,0xCA,0x85,0x99,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,
-	0x85,0x99,0x07,0xCA,0x69,0xEA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x07,0xCA,0xE7,0xB9,0x85,0x99,0x04,0x69,0x04,0x69,0xA2,0x40,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x07,0xCA,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x48,0xE2,0x07,0xCA,0x85,0x99,0x04,0x69,0xA2,0x40,0x40,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x48,0xE2,0xAA,0xFA,0x89,0xF2,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x04,0x69,0xA2,0x40,0xA2,0x40,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x89,0xFA,
-	0x69,0xF2,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x48,0xE2,0x69,0xEA,0x89,0xF2,0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE7,0xB9,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x07,0xCA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x07,0xCA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xCA,
-	0x04,0x69,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x07,0xCA,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x85,0x99,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,
-	0x40,0x10,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x07,0xCA,0x89,0xFA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0xE7,0xB9,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0xA2,0x40,0x04,0x69,0x07,0xCA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x89,0xF2,0x89,0xF2,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x69,0xEA,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x04,0x69,0x85,0x99,0x69,0xEA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x04,0x69,0x61,0x28,
-	0x00,0x00,0x00,0x00,0xA2,0x40,0x04,0x69,0xE7,0xB9,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_3[] = {
-	//RGB565 data 
-	0x40,0x10,0x40,0x10,0x61,0x28,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x85,0x99,0xA2,0x40,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x10,0xA2,0x40,0x85,0x99,0x89,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x85,0x99,0x04,0x69,0x61,0x28,0x40,0x10,0x00,0x00,0x40,0x10,0x04,0x69,0x85,0x99,0x69,0xF2,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x40,0x10,0xA2,0x40,0x04,0x69,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xEA,0x89,0xF2,0xAA,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x00,0x00,
-	0x40,0x10,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x85,0x99,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x85,0x99,0x85,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
-	0xA2,0x40,0x04,0x69,0x07,0xCA,0x89,0xF2,0x89,0xF2,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0xE7,0xB9,0x89,0xF2,0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,
-	0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x85,0x99,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x89,0xF2,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,
-	0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x07,0xCA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xF2,0x69,0xF2,
-	0x89,0xF2,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x07,0xCA,0x89,0xFA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,
-	0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x04,0x69,0x85,0x99,0x07,0xCA,0x69,0xF2,0x89,0xF2,
-	0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x40,0x10,0x61,0x28,0xA2,0x40,0x85,0x99,0x89,0xF2,0x89,0xFA,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xF2,0x89,0xFA,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xF2,0x89,0xFA,0x69,0xEA,
-	0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x89,0xF2,0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x40,0x10,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
-	0x40,0x10,0x40,0x10,0x40,0x10,0x61,0x28,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x04,0x69,0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x48,0xE2,0x04,0x69,
-	0x61,0x28,0x00,0x00,0x00,0x00,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x69,0xEA,0x89,0xF2,0x89,0xF2,0x69,0xEA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x07,0xCA,0x85,0x99,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_4[] = {
-	//RGB565 data 
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,
-	0xA2,0x40,0x85,0x99,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xF2,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xFA,
-	0x89,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x69,0xEA,0x69,0xEA,0x48,0xE2,0x07,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x07,0xCA,0xA2,0x40,
-	0x40,0x10,0x85,0x99,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xF2,0xAA,0xFA,0x69,0xF2,0xE7,0xB9,0x04,0x69,0x40,0x10,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,
-	0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x04,0x69,0x61,0x28,0x00,0x00,0x61,0x28,0x85,0x99,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xF2,0xAA,0xFA,0x89,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x61,0x28,
-	0x85,0x99,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0xE7,0xB9,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x69,0xF2,
-	0xAA,0xFA,0x89,0xF2,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x89,0xF2,0xAA,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x89,0xF2,0x69,0xEA,0x89,0xF2,0x89,0xF2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,
-	0x89,0xF2,0xAA,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x40,0x10,0xA2,0x40,0x07,0xCA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xEA,0xE7,0xB9,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x85,0x99,0xE7,0xB9,0x48,0xE2,0x69,0xF2,0x89,0xF2,0x48,0xE2,0x85,0x99,0x04,0x69,0x61,0x28,0x04,0x69,0x07,0xCA,0x89,0xFA,0x69,0xF2,0x69,0xEA,
-	0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x07,0xCA,0x07,0xCA,0xA2,0x40,0x85,0x99,0x48,0xE2,0xAA,0xFA,0x89,0xF2,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x04,0x69,0x85,0x99,0x07,0xCA,0x69,0xEA,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x48,0xE2,0x48,0xE2,0xA2,0x40,0x04,0x69,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,
-	0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x07,0xCA,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x07,0xCA,0xE7,0xB9,0x85,0x99,0x61,0x28,0xA2,0x40,0xA2,0x40,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0xA2,0x40,0x04,0x69,0xE7,0xB9,0x89,0xF2,0x89,0xF2,0x69,0xEA,0x07,0xCA,
-	0xE7,0xB9,0x04,0x69,0xA2,0x40,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0xA2,0x40,0x85,0x99,0x89,0xF2,0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0xE7,0xB9,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x85,0x99,0xA2,0x40,
-	0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0xE7,0xB9,0x07,0xCA,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x00,0x00,
-	0x40,0x10,0xA2,0x40,0x85,0x99,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xF2,0x69,0xF2,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x69,0xF2,0x07,0xCA,0xE7,0xB9,0x00,0x00,0x40,0x10,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x69,0xF2,0x48,0xE2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x04,0x69,0x00,0x00,0x61,0x28,
-	0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xFA,0x89,0xF2,0xE7,0xB9,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x69,0xEA,0x89,0xF2,0x69,0xEA,0x85,0x99,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
-	0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x61,0x28,0x85,0x99,0x48,0xE2,0x69,0xEA,0x69,0xF2,0x48,0xE2,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE7,0xB9,
-	0x69,0xF2,0x69,0xF2,0x69,0xEA,0x07,0xCA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xCA,0xAA,0xFA,0x89,0xF2,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x07,0xCA,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x85,0x99,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0xA2,0x40,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x07,0xCA,0x89,0xFA,
-	0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,
-	0x89,0xF2,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x61,0x28,0x00,0x00,0xA2,0x40,0x04,0x69,0x07,0xCA,0x89,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xFA,0x07,0xCA,0xA2,0x40,0x00,0x00,0x61,0x28,0xA2,0x40,0x04,0x69,0x85,0x99,0x85,0x99,
-	0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0xE7,0xB9,0x48,0xE2,0x69,0xEA,0x89,0xF2,0xAA,0xFA,0x48,0xE2,0x04,0x69,0x40,0x10,0x40,0x10,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x85,0x99,0x07,0xCA,0x48,0xE2,
-	0x69,0xF2,0x89,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xF2,0xAA,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x04,0x69,0x07,0xCA,0x89,0xF2,0xAA,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xF2,
-	0xAA,0xFA,0x07,0xCA,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x89,0xF2,0xE7,0xB9,0x61,0x28,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
-	0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x61,0x28,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xF2,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x04,0x69,0x85,0x99,0x07,0xCA,0x89,0xF2,0x89,0xFA,0x48,0xE2,0xE7,0xB9,
-	0x04,0x69,0x40,0x10,0x00,0x00,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xEA,0x89,0xF2,0xAA,0xFA,0x48,0xE2,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xEA,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x07,0xCA,0xE7,0xB9,0x04,0x69,0xA2,0x40,0x40,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_5};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_6[] = {
-	//RGB565 data 
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x04,0x69,0x85,0x99,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0xA2,0x40,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0x85,0x99,0xE7,0xB9,0x07,0xCA,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x48,0xE2,0x69,0xEA,0x69,0xEA,0x89,0xF2,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x07,0xCA,0x89,0xF2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x40,0x10,
-	0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xFA,0x89,0xF2,0x07,0xCA,0x85,0x99,0x04,0x69,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x69,0xF2,0x07,0xCA,0x85,0x99,0x04,0x69,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,
-	0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xE7,0xB9,
-	0x89,0xF2,0x89,0xF2,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x07,0xCA,0xAA,0xFA,0x89,0xF2,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x07,0xCA,0xAA,0xFA,0x89,0xF2,0x07,0xCA,0x85,0x99,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0x04,0x69,0xA2,0x40,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0x07,0xCA,0x89,0xFA,
-	0x69,0xF2,0x48,0xE2,0x07,0xCA,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0xA2,0x40,0x04,0x69,0x07,0xCA,0x89,0xFA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,
-	0x89,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x04,0x69,0x85,0x99,0x48,0xE2,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x89,0xF2,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x04,0x69,0x85,0x99,0x48,0xE2,0x89,0xF2,0x89,0xF2,
-	0x48,0xE2,0x07,0xCA,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x07,0xCA,0x69,0xEA,0x89,0xF2,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x85,0x99,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x89,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0x85,0x99,0x48,0xE2,0x69,0xF2,
-	0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x85,0x99,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x40,0x10,0x00,0x00,0x40,0x10,0x40,0x10,0x61,0x28,0x04,0x69,0x07,0xCA,0x69,0xEA,0x69,0xEA,0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,0xE7,0xB9,0x07,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xCA,0x04,0x69,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x48,0xE2,0x89,0xF2,0x48,0xE2,
-	0xE7,0xB9,0x04,0x69,0x40,0x10,0x00,0x00,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x85,0x99,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x61,0x28,
-	0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x61,0x28,0xA2,0x40,0xE7,0xB9,0x89,0xF2,0xAA,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x04,0x69,0x85,0x99,0x07,0xCA,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x04,0x69,
-	0x61,0x28,0x00,0x00,0x00,0x00,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x07,0xCA,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xCA,0x07,0xCA,0x69,0xEA,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x85,0x99,0x69,0xEA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xEA,0x07,0xCA,0x04,0x69,0xA2,0x40,0x40,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_6 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_6),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_6};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x89,0xF2,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x85,0x99,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x10,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x85,0x99,0x48,0xE2,0x69,0xEA,0x69,0xEA,0x07,0xCA,0x07,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
-	0x61,0x28,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xF2,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x89,0xF2,0xAA,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,
-	0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x07,0xCA,0x89,0xFA,0x69,0xF2,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x48,0xE2,0x89,0xF2,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x48,0xE2,
-	0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xEA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,0x85,0x99,0x48,0xE2,0x89,0xFA,0x89,0xF2,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x89,0xF2,0x48,0xE2,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,
-	0xA2,0x40,0x85,0x99,0x69,0xEA,0xAA,0xFA,0x69,0xEA,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x89,0xF2,0x89,0xF2,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0xE7,0xB9,0x69,0xEA,
-	0xAA,0xFA,0x69,0xF2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xEA,0x07,0xCA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x04,0x69,0x07,0xCA,0x89,0xFA,0x89,0xFA,0x07,0xCA,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x89,0xFA,0x69,0xEA,0x85,0x99,
-	0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0x07,0xCA,0x89,0xFA,0xAA,0xFA,0x69,0xEA,0xE7,0xB9,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x85,0x99,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_7 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_7),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_7};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,
-	0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x85,0x99,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0x85,0x99,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x07,0xCA,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x69,0xEA,0x07,0xCA,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x48,0xE2,0x69,0xEA,0x69,0xF2,0x89,0xF2,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xF2,0x07,0xCA,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x07,0xCA,0x89,0xF2,0x89,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x04,0x69,0xA2,0x40,0xA2,0x40,0x04,0x69,0x85,0x99,0x07,0xCA,0x89,0xF2,0x89,0xF2,0x48,0xE2,0xE7,0xB9,0xE7,0xB9,0x00,0x00,0x40,0x10,0x04,0x69,0x85,0x99,0x48,0xE2,0x89,0xFA,0x69,0xEA,0xE7,0xB9,0x04,0x69,0xA2,0x40,0x61,0x28,0x40,0x10,0x40,0x10,
-	0x61,0x28,0xA2,0x40,0xE7,0xB9,0x89,0xF2,0x89,0xF2,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x00,0x00,0x61,0x28,0x04,0x69,0xE7,0xB9,0x69,0xEA,0x69,0xF2,0x48,0xE2,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x85,0x99,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x61,0x28,0x85,0x99,
-	0x07,0xCA,0x69,0xEA,0x69,0xF2,0x07,0xCA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x85,0x99,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xEA,0x07,0xCA,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,
-	0xA2,0x40,0xE7,0xB9,0x89,0xF2,0xAA,0xFA,0x48,0xE2,0x04,0x69,0xA2,0x40,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x48,0xE2,0x85,0x99,0x04,0x69,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x04,0x69,0x85,0x99,0x07,0xCA,0x89,0xF2,0x89,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,
-	0x69,0xEA,0x89,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x85,0x99,0x48,0xE2,0x89,0xF2,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x89,0xFA,
-	0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0x07,0xCA,0x69,0xEA,
-	0x69,0xF2,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x40,0x10,0x00,0x00,0xA2,0x40,0x04,0x69,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0xE7,0xB9,0x85,0x99,0xA2,0x40,0xA2,0x40,0x61,0x28,0xA2,0x40,0x04,0x69,0xE7,0xB9,0x69,0xF2,0x89,0xF2,
-	0x69,0xEA,0x69,0xEA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x85,0x99,0xE7,0xB9,0x69,0xEA,0x89,0xFA,0x69,0xEA,0x85,0x99,0xA2,0x40,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x61,0x28,0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x89,0xFA,0x07,0xCA,0x61,0x28,0x00,0x00,0x07,0xCA,0x07,0xCA,0x69,0xEA,0x69,0xEA,0x48,0xE2,0x04,0x69,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0xAA,0xFA,0x07,0xCA,0x61,0x28,0x00,0x00,0x48,0xE2,0x69,0xEA,0x69,0xF2,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x07,0xCA,0x48,0xE2,0x69,0xF2,
-	0x89,0xF2,0xE7,0xB9,0x61,0x28,0x00,0x00,0x69,0xF2,0x69,0xF2,0x89,0xF2,0x48,0xE2,0xE7,0xB9,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x04,0x69,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x69,0xEA,0x07,0xCA,0x85,0x99,0x61,0x28,0x00,0x00,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xEA,0xE7,0xB9,0x04,0x69,0xA2,0x40,0x40,0x10,0x61,0x28,0xA2,0x40,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x89,0xFA,0x48,0xE2,0xE7,0xB9,
-	0x04,0x69,0x40,0x10,0x00,0x00,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x89,0xF2,0x89,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x85,0x99,0x07,0xCA,0x89,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0xA2,0x40,0x40,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_8 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_8),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_8};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_17_368896_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x04,0x69,0x85,0x99,0xE7,0xB9,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0xE7,0xB9,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x10,0xA2,0x40,0x85,0x99,0xE7,0xB9,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x07,0xCA,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,
-	0x89,0xF2,0x89,0xF2,0x89,0xF2,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xE7,0xB9,0xE7,0xB9,0x00,0x00,0x00,0x00,0x61,0x28,0x04,0x69,0x48,0xE2,0xAA,0xFA,0x89,0xF2,0x69,0xEA,0x48,0xE2,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x07,0xCA,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x00,0x00,0x40,0x10,
-	0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xFA,0x89,0xF2,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x85,0x99,0x04,0x69,0x85,0x99,0x85,0x99,0x85,0x99,0x07,0xCA,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x00,0x00,0x61,0x28,0x85,0x99,0x07,0xCA,0x69,0xEA,0x69,0xF2,0x48,0xE2,0xE7,0xB9,0x04,0x69,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,
-	0xA2,0x40,0x04,0x69,0xE7,0xB9,0x89,0xF2,0x89,0xF2,0x69,0xEA,0x48,0xE2,0x48,0xE2,0x00,0x00,0x61,0x28,0xE7,0xB9,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x85,0x99,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0x00,0x00,0xA2,0x40,0x07,0xCA,
-	0x89,0xFA,0x89,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x40,0x10,0xA2,0x40,0x07,0xCA,0xAA,0xFA,0x89,0xF2,0x07,0xCA,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x40,0x10,0x85,0x99,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xE7,0xB9,0x85,0x99,0x61,0x28,0x04,0x69,0x07,0xCA,0xAA,0xFA,0x89,0xF2,0x07,0xCA,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x40,0x10,0x00,0x00,0x40,0x10,0x61,0x28,0xA2,0x40,0xE7,0xB9,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x61,0x28,0x04,0x69,0x07,0xCA,0x89,0xFA,
-	0x89,0xF2,0x48,0xE2,0xE7,0xB9,0x04,0x69,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x89,0xF2,0x89,0xFA,0x48,0xE2,0x85,0x99,0x04,0x69,0x61,0x28,0x04,0x69,0x07,0xCA,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xCA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0xE7,0xB9,0x48,0xE2,
-	0x69,0xEA,0x69,0xF2,0x89,0xFA,0x07,0xCA,0x04,0x69,0xA2,0x40,0x40,0x10,0xA2,0x40,0x07,0xCA,0x89,0xFA,0x69,0xF2,0x69,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xFA,0x07,0xCA,0x04,0x69,0x61,0x28,0x00,0x00,0xA2,0x40,0x85,0x99,0x48,0xE2,0x89,0xF2,
-	0xAA,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x89,0xFA,0x07,0xCA,0xA2,0x40,0x40,0x10,0x00,0x00,0x40,0x10,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x48,0xE2,0x48,0xE2,0x48,0xE2,
-	0x69,0xF2,0xAA,0xFA,0x07,0xCA,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0x04,0x69,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x04,0x69,0x04,0x69,0x85,0x99,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x07,0xCA,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x40,0x10,0x61,0x28,0x04,0x69,0xE7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x07,0xCA,0x69,0xF2,0x69,0xEA,
-	0x48,0xE2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x85,0x99,0x69,0xEA,0x89,0xF2,0x69,0xEA,0xE7,0xB9,0x04,0x69,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,
-	0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x10,0xA2,0x40,0x04,0x69,0xE7,0xB9,0x69,0xF2,0xAA,0xFA,0x69,0xEA,0x85,0x99,0x04,0x69,0x40,0x10,0x00,0x00,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x85,0x99,0xE7,0xB9,0x48,0xE2,0x69,0xF2,0x89,0xF2,0x07,0xCA,0x04,0x69,
-	0x61,0x28,0x00,0x00,0x00,0x00,0x04,0x69,0x04,0x69,0xE7,0xB9,0x07,0xCA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x89,0xF2,0x89,0xF2,0x48,0xE2,0x85,0x99,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x85,0x99,0xE7,0xB9,0x69,0xEA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xF2,0x69,0xEA,0x48,0xE2,0x07,0xCA,0x85,0x99,0x04,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x99,0xE7,0xB9,0x69,0xEA,0x89,0xF2,0x89,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xCA,0x85,0x99,0x04,0x69,0xA2,0x40,0x40,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0xB9,0x07,0xCA,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xEA,0x69,0xF2,0x69,0xEA,0x48,0xE2,0xE7,0xB9,0x04,0x69,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_17_368896_9 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 21,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_17_368896_data_9),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_17_368896_data_9};
-
-    
\ No newline at end of file
@@ -1,804 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#include "../756_2_466.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_19_374600_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x49,0xEA,0x28,0xDA,0x45,0x81,0xA2,0x40,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x03,0x61,0xA2,0x40,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x49,0xEA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x03,0x61,0xA6,0xA9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x61,0x28,0x61,0x28,0xE7,0xB9,0x89,0xFA,0x08,0xD2,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x03,0x61,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0x61,0x28,0xA2,0x40,0x45,0x81,0x45,0x81,0x45,0x81,0xA6,0xA9,0x08,0xD2,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x85,0x99,0x41,0x18,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x85,0x99,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x45,0x81,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x28,0xDA,0x49,0xEA,0x45,0x81,0xA2,0x40,0x20,0x08,
-	0x00,0x00,0x61,0x28,0x03,0x61,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0xA2,0x40,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x49,0xEA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x20,0x08,0x03,0x61,0x85,0x99,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x03,0x61,0x45,0x81,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,
-	0x20,0x08,0x03,0x61,0x85,0x99,0x28,0xDA,0x69,0xF2,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x49,0xEA,0x49,0xEA,0x85,0x99,0x03,0x61,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x45,0x81,0x08,0xD2,0x69,0xF2,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x20,0x08,0xA2,0x40,0x45,0x81,0xA6,0xA9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x20,0x08,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0xA2,0x40,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0x03,0x61,0x45,0x81,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x61,0x28,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0xA6,0xA9,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x20,0x08,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0x85,0x99,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x45,0x81,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x45,0x81,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0xA2,0x40,0x45,0x81,0x28,0xDA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x03,0x61,0x69,0xF2,0x89,0xFA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x28,0xDA,0x28,0xDA,0x03,0x61,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x08,0xD2,0xA6,0xA9,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x45,0x81,0x03,0x61,0x85,0x99,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x61,0x45,0x81,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x45,0x81,0x49,0xEA,0x28,0xDA,0x08,0xD2,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x45,0x81,0xE7,0xB9,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x61,0x28,0xA2,0x40,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_19_374600_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 64,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_19_374600_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_19_374600_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_19_374600_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x49,0xEA,0x28,0xDA,0x45,0x81,0xA2,0x40,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x69,0xF2,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x49,0xEA,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x03,0x61,0xA2,0x40,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x61,0x28,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x49,0xEA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x03,0x61,0xA6,0xA9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x61,0x28,0x61,0x28,0xE7,0xB9,0x89,0xFA,0x08,0xD2,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA2,0x40,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x03,0x61,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0x61,0x28,0xA2,0x40,0x45,0x81,0x45,0x81,0x45,0x81,0xA6,0xA9,0x08,0xD2,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x85,0x99,0x41,0x18,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x85,0x99,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x45,0x81,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x28,0xDA,0x49,0xEA,0x45,0x81,0xA2,0x40,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x49,0xEA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x03,0x61,0x45,0x81,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x49,0xEA,0x49,0xEA,0x85,0x99,0x03,0x61,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x45,0x81,0x08,0xD2,0x69,0xF2,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x20,0x08,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0x03,0x61,0x45,0x81,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x61,0x28,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0xA6,0xA9,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x20,0x08,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0x85,0x99,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x45,0x81,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x20,0x08,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x45,0x81,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x85,0x99,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0xA2,0x40,0x45,0x81,0x28,0xDA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x08,0xD2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x03,0x61,0x69,0xF2,0x89,0xFA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x28,0xDA,0x28,0xDA,0x03,0x61,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x41,0x18,
-	0x03,0x61,0x49,0xEA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x49,0xEA,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x08,0xD2,0xA6,0xA9,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x45,0x81,0x03,0x61,0x85,0x99,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x41,0x18,
-	0x03,0x61,0xE7,0xB9,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x61,0x45,0x81,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x45,0x81,0x49,0xEA,0x28,0xDA,0x08,0xD2,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x45,0x81,0xE7,0xB9,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x61,0x28,0xA2,0x40,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_19_374600_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 64,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_19_374600_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_19_374600_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_19_374600_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0xA6,0xA9,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x49,0xEA,0x28,0xDA,0x45,0x81,0xA2,0x40,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0x45,0x81,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x03,0x61,0xA2,0x40,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x03,0x61,0x85,0x99,0xA6,0xA9,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0xA6,0xA9,0x85,0x99,0x45,0x81,0xA2,0x40,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x49,0xEA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x03,0x61,0xA6,0xA9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x61,0x28,0x61,0x28,0xE7,0xB9,0x89,0xFA,0x08,0xD2,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x03,0x61,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0x61,0x28,0xA2,0x40,0x45,0x81,0x45,0x81,0x45,0x81,0xA6,0xA9,0x08,0xD2,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x85,0x99,0x41,0x18,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x85,0x99,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x45,0x81,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x28,0xDA,0x49,0xEA,0x45,0x81,0xA2,0x40,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x49,0xEA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x03,0x61,0x45,0x81,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x49,0xEA,0x49,0xEA,0x85,0x99,0x03,0x61,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x45,0x81,0x08,0xD2,0x69,0xF2,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x20,0x08,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0x03,0x61,0x45,0x81,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x61,0x28,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0xA6,0xA9,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x20,0x08,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0x85,0x99,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x45,0x81,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x45,0x81,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0xA2,0x40,0x45,0x81,0x28,0xDA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x03,0x61,0x85,0x99,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x03,0x61,0x69,0xF2,0x89,0xFA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x28,0xDA,0x28,0xDA,0x03,0x61,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x08,0xD2,0xA6,0xA9,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x45,0x81,0x03,0x61,0x85,0x99,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0xE7,0xB9,0x89,0xFA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x08,0xD2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x61,0x45,0x81,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x45,0x81,0x49,0xEA,0x28,0xDA,0x08,0xD2,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0xA2,0x40,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x85,0x99,0x45,0x81,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x45,0x81,0xE7,0xB9,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x41,0x18,0xA2,0x40,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x61,0x28,0xA2,0x40,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_19_374600_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 64,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_19_374600_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_19_374600_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_19_374600_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x41,0x18,0x20,0x08,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA2,0x40,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0xE7,0xB9,0x45,0x81,0x03,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x49,0xEA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x03,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x49,0xEA,0x28,0xDA,0x45,0x81,0xA2,0x40,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xE7,0xB9,0x08,0xD2,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x49,0xEA,0x89,0xFA,0x28,0xDA,0x03,0x61,0xA2,0x40,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x03,0x61,0xA2,0x40,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0x08,0xD2,0xA6,0xA9,0x45,0x81,0x45,0x81,0x85,0x99,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0xE7,0xB9,0x85,0x99,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x03,0x61,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x49,0xEA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x49,0xEA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,0x20,0x08,0xA2,0x40,0x85,0x99,0x69,0xF2,0x08,0xD2,0x45,0x81,0xA2,0x40,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0x28,0xDA,0x03,0x61,0x20,0x08,0x20,0x08,0x41,0x18,0x85,0x99,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x03,0x61,0xA6,0xA9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x61,0x28,0x61,0x28,0xE7,0xB9,0x89,0xFA,0x08,0xD2,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x20,0x08,0x00,0x00,0x03,0x61,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x99,0x69,0xF2,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x03,0x61,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0x85,0x99,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x45,0x81,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0xA2,0x40,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA9,0x89,0xFA,0x89,0xFA,0x08,0xD2,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0x61,0x28,0xA2,0x40,0x45,0x81,0x45,0x81,0x45,0x81,0xA6,0xA9,0x08,0xD2,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x08,0xD2,0x03,0x61,0x41,0x18,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x69,0xF2,0x85,0x99,0x61,0x28,0x00,0x00,0x41,0x18,0x85,0x99,0x69,0xF2,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x69,0xF2,0xA6,0xA9,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x85,0x99,0x41,0x18,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x85,0x99,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x45,0x81,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x20,0x08,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x69,0xF2,0x45,0x81,0x20,0x08,0x00,0x00,0xA2,0x40,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x20,0x08,0xA2,0x40,0xE7,0xB9,0x89,0xFA,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x28,0xDA,0x49,0xEA,0x45,0x81,0xA2,0x40,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x89,0xFA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x03,0x61,0x08,0xD2,0x69,0xF2,0x28,0xDA,0x03,0x61,0x00,0x00,0x20,0x08,0xA2,0x40,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0x41,0x18,0x03,0x61,0x08,0xD2,0x69,0xF2,0x08,0xD2,0x45,0x81,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x49,0xEA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0x41,0x18,0x00,0x00,0x20,0x08,0x03,0x61,0x49,0xEA,0x49,0xEA,0xA6,0xA9,0xA2,0x40,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0xA2,0x40,0x45,0x81,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x03,0x61,0x45,0x81,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xE7,0xB9,0x89,0xFA,0x89,0xFA,0x85,0x99,0x00,0x00,0x20,0x08,0x03,0x61,0xE7,0xB9,0x89,0xFA,0x08,0xD2,0x03,0x61,0x61,0x28,0x00,0x00,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x41,0x18,0x20,0x08,0xA2,0x40,0x85,0x99,0x28,0xDA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x49,0xEA,0x49,0xEA,0x85,0x99,0x03,0x61,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x45,0x81,0x08,0xD2,0x69,0xF2,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x69,0xF2,0x85,0x99,0x20,0x08,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0xA2,0x40,0xA2,0x40,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x20,0x08,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x85,0x99,0x49,0xEA,0x69,0xF2,0x08,0xD2,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x69,0xF2,0x28,0xDA,0x45,0x81,0xA2,0x40,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0x03,0x61,0x45,0x81,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x08,0xD2,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x61,0x28,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x49,0xEA,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x08,0xD2,0xE7,0xB9,0x45,0x81,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x03,0x61,0x45,0x81,0x45,0x81,0x85,0x99,0x45,0x81,0x85,0x99,0x08,0xD2,0x89,0xFA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0xA6,0xA9,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x20,0x08,0xA2,0x40,0x45,0x81,0x49,0xEA,0x08,0xD2,0x45,0x81,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0x45,0x81,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0xA2,0x40,0xA6,0xA9,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x20,0x08,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0x85,0x99,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x03,0x61,0xA2,0x40,0xA2,0x40,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x45,0x81,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0x41,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x45,0x81,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0xA6,0xA9,0x28,0xDA,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0xA2,0x40,0x45,0x81,0x28,0xDA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x85,0x99,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x49,0xEA,0x08,0xD2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x03,0x61,0x69,0xF2,0x89,0xFA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x28,0xDA,0x28,0xDA,0x03,0x61,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x49,0xEA,0x49,0xEA,0x89,0xFA,0x49,0xEA,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x08,0xD2,0xA6,0xA9,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x45,0x81,0x03,0x61,0x85,0x99,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0xA6,0xA9,0x49,0xEA,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0xA6,0xA9,0x08,0xD2,0x49,0xEA,0x28,0xDA,0x85,0x99,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x61,0x45,0x81,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x45,0x81,0x49,0xEA,0x28,0xDA,0x08,0xD2,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0xA6,0xA9,0x28,0xDA,0xE7,0xB9,0x45,0x81,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x03,0x61,0x85,0x99,0x08,0xD2,0x08,0xD2,0x45,0x81,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x45,0x81,0xE7,0xB9,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x45,0x81,0x85,0x99,0x45,0x81,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x45,0x81,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x61,0x28,0xA2,0x40,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x18,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_19_374600_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 64,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_19_374600_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_19_374600_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_19_374600_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x45,0x81,0x08,0xD2,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xA6,0xA9,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0xA6,0xA9,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x49,0xEA,0x28,0xDA,0x45,0x81,0xA2,0x40,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA2,0x40,0x45,0x81,0xE7,0xB9,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x03,0x61,0xA2,0x40,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA2,0x40,0x03,0x61,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x45,0x81,0xA6,0xA9,0x08,0xD2,0x69,0xF2,0x49,0xEA,0xE7,0xB9,0x85,0x99,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x45,0x81,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x49,0xEA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xA2,0x40,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x08,0xD2,0x45,0x81,0xA2,0x40,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x03,0x61,0xA6,0xA9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x61,0x28,0x61,0x28,0xE7,0xB9,0x89,0xFA,0x08,0xD2,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x03,0x61,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x89,0xFA,0x69,0xF2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0x61,0x28,0xA2,0x40,0x45,0x81,0x45,0x81,0x45,0x81,0xA6,0xA9,0x08,0xD2,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x85,0x99,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x85,0x99,0x41,0x18,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x85,0x99,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x45,0x81,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x45,0x81,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0xA6,0xA9,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x28,0xDA,0x49,0xEA,0x45,0x81,0xA2,0x40,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x03,0x61,0xA6,0xA9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x28,0xDA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x49,0xEA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x03,0x61,0x45,0x81,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x45,0x81,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x28,0xDA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x28,0xDA,0x69,0xF2,0x89,0xFA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x49,0xEA,0x49,0xEA,0x85,0x99,0x03,0x61,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x45,0x81,0x08,0xD2,0x69,0xF2,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA2,0x40,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x20,0x08,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x85,0x99,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x85,0x99,0x69,0xF2,0x89,0xFA,0x28,0xDA,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0x03,0x61,0x45,0x81,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x61,0x28,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x49,0xEA,0xA6,0xA9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0xA6,0xA9,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x08,0xD2,0x45,0x81,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x08,0xD2,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x20,0x08,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0x85,0x99,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x45,0x81,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x45,0x81,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x85,0x99,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xA6,0xA9,0x28,0xDA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x45,0x81,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x41,0x18,0x61,0x28,0x45,0x81,0x49,0xEA,0x89,0xFA,0x28,0xDA,0x45,0x81,0x41,0x18,0x20,0x08,0x41,0x18,0x20,0x08,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x85,0x99,0xA2,0x40,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0xA2,0x40,0x45,0x81,0x28,0xDA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x28,0xDA,0x85,0x99,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x85,0x99,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x85,0x99,0x03,0x61,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x03,0x61,0x69,0xF2,0x89,0xFA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x28,0xDA,0x28,0xDA,0x03,0x61,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,
-	0xA2,0x40,0xA6,0xA9,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x28,0xDA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x28,0xDA,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x28,0xDA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x08,0xD2,0xA6,0xA9,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x45,0x81,0x03,0x61,0x85,0x99,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x41,0x18,
-	0x03,0x61,0x28,0xDA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x61,0x45,0x81,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x45,0x81,0x49,0xEA,0x28,0xDA,0x08,0xD2,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,
-	0x03,0x61,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x45,0x81,0xE7,0xB9,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,
-	0x03,0x61,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x61,0x28,0xA2,0x40,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_19_374600_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 64,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_19_374600_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_19_374600_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_19_374600_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x03,0x61,0x45,0x81,0x03,0x61,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x45,0x81,0xE7,0xB9,0x28,0xDA,0xA6,0xA9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x85,0x99,0x28,0xDA,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x69,0xF2,0x89,0xFA,0x49,0xEA,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x49,0xEA,0x28,0xDA,0x45,0x81,0xA2,0x40,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x69,0xF2,0x89,0xFA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x03,0x61,0xA2,0x40,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x45,0x81,0x49,0xEA,0x28,0xDA,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x49,0xEA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x85,0x99,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x03,0x61,0xA6,0xA9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x61,0x28,0x61,0x28,0xE7,0xB9,0x89,0xFA,0x08,0xD2,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0x03,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x03,0x61,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xE7,0xB9,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x03,0x61,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0x61,0x28,0xA2,0x40,0x45,0x81,0x45,0x81,0x45,0x81,0xA6,0xA9,0x08,0xD2,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0x08,0xD2,0xE7,0xB9,0x03,0x61,0xA2,0x40,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x85,0x99,0x41,0x18,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x85,0x99,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x45,0x81,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0xA2,0x40,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x28,0xDA,0x49,0xEA,0x45,0x81,0xA2,0x40,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x61,0x28,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x49,0xEA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x03,0x61,0x45,0x81,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA2,0x40,0x45,0x81,0x45,0x81,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x49,0xEA,0x49,0xEA,0x85,0x99,0x03,0x61,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x45,0x81,0x08,0xD2,0x69,0xF2,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x49,0xEA,0x45,0x81,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x20,0x08,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x45,0x81,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0x03,0x61,0x45,0x81,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x69,0xF2,0x08,0xD2,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x49,0xEA,0x69,0xF2,0x28,0xDA,0xA6,0xA9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x61,0x28,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0xE7,0xB9,0x89,0xFA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0xA6,0xA9,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA2,0x40,0x85,0x99,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x20,0x08,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0x85,0x99,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xA6,0xA9,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x45,0x81,0x28,0xDA,0x89,0xFA,0x49,0xEA,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x45,0x81,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x03,0x61,0x49,0xEA,0x89,0xFA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x49,0xEA,0x69,0xF2,0x28,0xDA,0xA6,0xA9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x45,0x81,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0xE7,0xB9,0x89,0xFA,0x69,0xF2,0x08,0xD2,0x45,0x81,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x45,0x81,0x08,0xD2,0x89,0xFA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0xA2,0x40,0x45,0x81,0x28,0xDA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x61,0x28,0x03,0x61,0x08,0xD2,0x89,0xFA,0x69,0xF2,0x08,0xD2,0x85,0x99,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x89,0xFA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x03,0x61,0x69,0xF2,0x89,0xFA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x28,0xDA,0x28,0xDA,0x03,0x61,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,
-	0xA2,0x40,0x45,0x81,0x08,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x85,0x99,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x85,0x99,0x49,0xEA,0x89,0xFA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x08,0xD2,0xA6,0xA9,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x45,0x81,0x03,0x61,0x85,0x99,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x08,
-	0xA2,0x40,0xE7,0xB9,0x89,0xFA,0x89,0xFA,0x28,0xDA,0x85,0x99,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x81,0x08,0xD2,0x49,0xEA,0x49,0xEA,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x61,0x45,0x81,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x45,0x81,0x49,0xEA,0x28,0xDA,0x08,0xD2,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0x85,0x99,0x08,0xD2,0x08,0xD2,0x45,0x81,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x45,0x81,0xE7,0xB9,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x45,0x81,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x45,0x81,0x45,0x81,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x61,0x28,0xA2,0x40,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_19_374600_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 64,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_19_374600_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_19_374600_data_5};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_19_374600_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA2,0x40,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x08,0xD2,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0x45,0x81,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x85,0x99,0x85,0x99,0xA6,0xA9,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x03,0x61,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0xE7,0xB9,0x28,0xDA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x49,0xEA,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x28,0xDA,0x69,0xF2,0x89,0xFA,0x49,0xEA,0x45,0x81,0xA2,0x40,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x49,0xEA,0x28,0xDA,0x45,0x81,0xA2,0x40,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x85,0x99,0x03,0x61,0x61,0x28,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x03,0x61,0xA2,0x40,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0xA2,0x40,0x85,0x99,0xE7,0xB9,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x69,0xF2,0x85,0x99,0x41,0x18,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x41,0x18,0x85,0x99,0x49,0xEA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x28,0xDA,0x49,0xEA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x45,0x81,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x03,0x61,0xA6,0xA9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0x85,0x99,0x61,0x28,0x61,0x28,0xE7,0xB9,0x89,0xFA,0x08,0xD2,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x69,0xF2,0xA6,0xA9,0xA2,0x40,0x03,0x61,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0x49,0xEA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0xE7,0xB9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0xA6,0xA9,0x61,0x28,0xA2,0x40,0x45,0x81,0x45,0x81,0x45,0x81,0xA6,0xA9,0x08,0xD2,0x69,0xF2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x45,0x81,0x49,0xEA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x85,0x99,0x41,0x18,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x85,0x99,0xA2,0x40,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x45,0x81,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x85,0x99,0x03,0x61,0xA2,0x40,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0xA2,0x40,0x45,0x81,0x08,0xD2,0x69,0xF2,0x08,0xD2,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x28,0xDA,0x49,0xEA,0x45,0x81,0xA2,0x40,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x49,0xEA,0xE7,0xB9,0xA6,0xA9,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0xA6,0xA9,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0x49,0xEA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x45,0x81,0x85,0x99,0x85,0x99,0x85,0x99,0x85,0x99,0x45,0x81,0x03,0x61,0x45,0x81,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x08,0xD2,0x49,0xEA,0x69,0xF2,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x49,0xEA,0x69,0xF2,0x89,0xFA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x49,0xEA,0x49,0xEA,0x85,0x99,0x03,0x61,0x61,0x28,0x61,0x28,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x45,0x81,0x08,0xD2,0x69,0xF2,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0xE7,0xB9,0x08,0xD2,0x49,0xEA,0x89,0xFA,0x28,0xDA,0x45,0x81,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x08,0xD2,0x45,0x81,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0x03,0x61,0x45,0x81,0x45,0x81,0x45,0x81,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x20,0x08,0x45,0x81,0x49,0xEA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0xA2,0x40,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0x03,0x61,0x45,0x81,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xA6,0xA9,0x45,0x81,0x41,0x18,0x20,0x08,0x85,0x99,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0x08,0xD2,0x89,0xFA,0x89,0xFA,0x85,0x99,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x81,0x49,0xEA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x28,0xDA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x61,0x28,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x08,0xD2,0xA6,0xA9,0x85,0x99,0x85,0x99,0xA6,0xA9,0xA6,0xA9,0x08,0xD2,0x28,0xDA,0xE7,0xB9,0x45,0x81,0x41,0x18,0x41,0x18,0xA6,0xA9,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x81,0x89,0xFA,0x89,0xFA,0x28,0xDA,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0xA6,0xA9,0x41,0x18,0x61,0x28,0x45,0x81,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x03,0x61,0x03,0x61,0x45,0x81,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x45,0x81,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x85,0x99,0x89,0xFA,0x89,0xFA,0x08,0xD2,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x20,0x08,0x61,0x28,0x85,0x99,0x28,0xDA,0x69,0xF2,0x85,0x99,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x03,0x61,0xA2,0x40,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0xE7,0xB9,0x45,0x81,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x45,0x81,0x28,0xDA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x89,0xFA,0x69,0xF2,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x61,0x28,0x45,0x81,0x28,0xDA,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x00,0x00,0x61,0x28,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x45,0x81,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0xA2,0x40,0x03,0x61,0xE7,0xB9,0x69,0xF2,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x45,0x81,0x49,0xEA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x28,0xDA,0x85,0x99,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x28,0xDA,0x85,0x99,0xA2,0x40,0x00,0x00,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x89,0xFA,0x08,0xD2,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xE7,0xB9,0x49,0xEA,0x49,0xEA,0x45,0x81,0xA2,0x40,0xA2,0x40,0x03,0x61,0x08,0xD2,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x85,0x99,0x49,0xEA,0x49,0xEA,0xE7,0xB9,0x85,0x99,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x45,0x81,0x85,0x99,0x08,0xD2,0x69,0xF2,0x08,0xD2,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x69,0xF2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0xA2,0x40,0x28,0xDA,0x89,0xFA,0x49,0xEA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x89,0xFA,0x49,0xEA,0x45,0x81,0x61,0x28,0xA2,0x40,0x45,0x81,0x28,0xDA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x69,0xF2,0x28,0xDA,0x08,0xD2,0x08,0xD2,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,0x08,0xD2,0x08,0xD2,0x49,0xEA,0x49,0xEA,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA2,0x40,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0xA6,0xA9,0x61,0x28,0x00,0x00,0x00,0x00,0x03,0x61,0x69,0xF2,0x89,0xFA,0x28,0xDA,0xE7,0xB9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0xA6,0xA9,0x28,0xDA,0x28,0xDA,0x03,0x61,0x61,0x28,0x03,0x61,0xE7,0xB9,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x45,0x81,0xE7,0xB9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x49,0xEA,0x89,0xFA,0x49,0xEA,0xA6,0xA9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x03,0x61,0x28,0xDA,0x89,0xFA,0x08,0xD2,0x03,0x61,0x20,0x08,0x00,0x00,0x20,0x08,0x03,0x61,0x08,0xD2,0x08,0xD2,0xA6,0xA9,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x28,0xDA,0x45,0x81,0x03,0x61,0x85,0x99,0x28,0xDA,0x89,0xFA,0x28,0xDA,0x03,0x61,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x28,0xDA,0x49,0xEA,0x69,0xF2,0x89,0xFA,0x49,0xEA,0x85,0x99,0xA2,0x40,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x61,0x45,0x81,0x69,0xF2,0x49,0xEA,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x03,0x61,0x03,0x61,0xA2,0x40,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x45,0x81,0x49,0xEA,0x28,0xDA,0x08,0xD2,0x49,0xEA,0x89,0xFA,0x89,0xFA,0xE7,0xB9,0xA2,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA9,0x69,0xF2,0x89,0xFA,0x28,0xDA,0x45,0x81,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA6,0xA9,0x49,0xEA,0x89,0xFA,0x69,0xF2,0x45,0x81,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x40,0x45,0x81,0xE7,0xB9,0xA6,0xA9,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x61,0xE7,0xB9,0x08,0xD2,0x28,0xDA,0x28,0xDA,0x08,0xD2,0xE7,0xB9,0x45,0x81,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x85,0x99,0x08,0xD2,0x28,0xDA,0x85,0x99,0xA2,0x40,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x03,0x61,0xA6,0xA9,0x08,0xD2,0xE7,0xB9,0x03,0x61,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x41,0x18,0xA2,0x40,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA2,0x40,0x03,0x61,0x03,0x61,0x03,0x61,0x03,0x61,0xA2,0x40,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0xA2,0x40,0x03,0x61,0x03,0x61,0xA2,0x40,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x03,0x61,0x03,0x61,0x03,0x61,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_19_374600_6 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 64,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_19_374600_data_6),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_19_374600_data_6};
-
-    
\ No newline at end of file
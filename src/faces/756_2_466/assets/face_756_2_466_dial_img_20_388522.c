@@ -1,846 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#include "../756_2_466.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_20_388522_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,
-	0xC7,0xB9,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x89,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x61,0x28,0x24,0x71,0x07,0xC2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,
-	0x07,0xC2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x07,0xC2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,
-	0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,
-	0xC7,0xB9,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0xAA,0xFA,0xC7,0xB9,0x41,0x18,0x00,0x00,0x20,0x08,0xC2,0x48,0x28,0xD2,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0xAA,0xFA,
-	0x28,0xD2,0xC2,0x48,0x20,0x08,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,
-	0x48,0xE2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,
-	0x28,0xD2,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x48,0xE2,0x69,0xF2,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x41,0x18,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x07,0xC2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,
-	0x28,0xD2,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x20,0x08,0x20,0x08,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x89,0xFA,0x28,0xD2,0x24,0x71,
-	0x61,0x28,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x07,0xC2,0x07,0xC2,0x28,0xD2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,
-	0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x20,0x08,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0xC2,0x48,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,
-	0x41,0x18,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xA6,0xA1,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,
-	0x07,0xC2,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x00,0x00,0x61,0x28,0x07,0xC2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x00,0x00,
-	0x61,0x28,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xA6,0xA1,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0xA6,0xA1,0xA6,0xA1,
-	0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x20,0x08,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x41,0x18,0x00,0x00,0x61,0x28,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0xA6,0xA1,0xA6,0xA1,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x20,0x08,0xC2,0x48,0xC7,0xB9,
-	0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0x89,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0xC7,0xB9,0xAA,0xFA,
-	0xAA,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x20,0x08,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x41,0x18,0x20,0x08,0xC2,0x48,0x28,0xD2,
-	0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x24,0x71,0xA6,0xA1,0xC7,0xB9,0x69,0xF2,0x69,0xF2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x24,0x71,0xC7,0xB9,0x28,0xD2,
-	0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0xC2,0x48,0xC7,0xB9,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x24,0x71,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x41,0x18,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x24,0x71,0x24,0x71,0xC7,0xB9,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0xAA,0xFA,
-	0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0xC2,0x48,0x07,0xC2,0x48,0xE2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,
-	0xC2,0x48,0x61,0x28,0xC2,0x48,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x20,0x08,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,
-	0xC7,0xB9,0x24,0x71,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,
-	0xC7,0xB9,0xC2,0x48,0x00,0x00,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0x24,0x71,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0x61,0x28,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x28,0xD2,0xC2,0x48,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0x61,0x28,0x20,0x08,
-	0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0xC7,0xB9,0x41,0x18,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x41,0x18,
-	0x41,0x18,0x24,0x71,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x00,0x00,0xC2,0x48,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x61,0x28,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,
-	0x61,0x28,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xC2,0x48,0x20,0x08,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0xAA,0xFA,0xC7,0xB9,0x41,0x18,0x20,0x08,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x41,0x18,0x20,0x08,0x24,0x71,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x20,0x08,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x00,0x00,0x24,0x71,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA6,0xA1,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0x20,0x08,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x07,0xC2,0x24,0x71,0x24,0x71,0x24,0x71,0xC7,0xB9,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x41,0x18,0x41,0x18,0x24,0x71,0x07,0xC2,
-	0x48,0xE2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x41,0x18,0x20,0x08,0x24,0x71,0x07,0xC2,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0x00,0x00,0x00,0x00,0xC2,0x48,
-	0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x41,0x18,0x24,0x71,0x48,0xE2,0x89,0xFA,0x48,0xE2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x24,0x71,0x20,0x08,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x24,0x71,0xA6,0xA1,0x07,0xC2,
-	0x69,0xF2,0x07,0xC2,0x24,0x71,0x41,0x18,0x20,0x08,0x24,0x71,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x20,0x08,0x41,0x18,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0xAA,0xFA,
-	0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x20,0x08,0x41,0x18,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x61,0x28,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0xC2,0x48,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC2,
-	0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x20,0x08,0x41,0x18,0x24,0x71,0x07,0xC2,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x20,0x08,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x20,0x08,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,
-	0xC7,0xB9,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x61,0x28,0xA6,0xA1,0x69,0xF2,
-	0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xD2,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x41,0x18,0x24,0x71,0xC7,0xB9,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x24,0x71,
-	0x61,0x28,0x00,0x00,0x41,0x18,0xA6,0xA1,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x00,0x00,0x61,0x28,0xC7,0xB9,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,
-	0x24,0x71,0x61,0x28,0x00,0x00,0x61,0x28,0xC7,0xB9,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x61,0x28,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xE2,0x48,0xE2,0x69,0xF2,
-	0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x61,0x28,0xC7,0xB9,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,
-	0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x20,0x08,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,
-	0xC7,0xB9,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,
-	0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0xC7,0xB9,0x61,0x28,0x00,0x00,
-	0x00,0x00,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x07,0xC2,0x24,0x71,
-	0x61,0x28,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x41,0x18,0xC2,0x48,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x07,0xC2,0x24,0x71,0x41,0x18,0x00,0x00,0x20,0x08,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,
-	0x48,0xE2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,
-	0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x41,0x18,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x61,0x28,0x24,0x71,
-	0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x20,0x08,0x00,0x00,
-	0x20,0x08,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x28,0xD2,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x48,0xE2,
-	0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC2,0x07,0xC2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x28,0xD2,
-	0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x07,0xC2,0x24,0x71,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,
-	0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xC2,0x48,0x24,0x71,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0x24,0x71,
-	0x24,0x71,0x24,0x71,0x24,0x71,0xC2,0x48,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x61,0x28,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,
-	0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_20_388522_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 79,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_20_388522_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_20_388522_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_20_388522_data_1[] = {
-	//RGB565 data 
-	0x24,0x71,0x24,0x71,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0x28,0xD2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xA6,0xA1,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xC7,0xB9,0x24,0x71,0xC2,0x48,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xD2,0x28,0xD2,
-	0x69,0xF2,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,
-	0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x61,0x28,0x24,0x71,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x07,0xC2,0x24,0x71,0x61,0x28,
-	0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x61,0x28,0x61,0x28,0xC2,0x48,0xC7,0xB9,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,
-	0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,
-	0x24,0x71,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xC7,0xB9,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x89,0xFA,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0x48,0xE2,
-	0xAA,0xFA,0x69,0xF2,0x24,0x71,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0xA6,0xA1,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x41,0x18,0x41,0x18,0x24,0x71,0x28,0xD2,
-	0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,
-	0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0xC2,0x48,
-	0x07,0xC2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x24,0x71,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,
-	0x24,0x71,0x00,0x00,0xC2,0x48,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x48,0xE2,
-	0x07,0xC2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,
-	0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,
-	0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x41,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,
-	0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0x24,0x71,0xC2,0x48,0x61,0x28,0xA6,0xA1,0x69,0xF2,
-	0x89,0xFA,0x69,0xF2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0xAA,0xFA,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x24,0x71,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0xC2,0x48,0x24,0x71,0x07,0xC2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x07,0xC2,0xC7,0xB9,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,
-	0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0x24,0x71,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,
-	0x69,0xF2,0x89,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0xC2,0x48,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,
-	0x48,0xE2,0x89,0xFA,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x07,0xC2,0xC2,0x48,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x89,0xFA,0x28,0xD2,
-	0xA6,0xA1,0xC2,0x48,0x00,0x00,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x69,0xF2,0x89,0xFA,
-	0x69,0xF2,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x20,0x08,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,
-	0xC2,0x48,0xC2,0x48,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x28,0xD2,
-	0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x28,0xD2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x20,0x08,
-	0x61,0x28,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,
-	0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xC7,0xB9,0x24,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,
-	0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,
-	0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,
-	0x07,0xC2,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x07,0xC2,
-	0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x28,0xD2,0xC7,0xB9,0x24,0x71,0x61,0x28,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,
-	0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_20_388522_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 79,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_20_388522_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_20_388522_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_20_388522_data_2[] = {
-	//RGB565 data 
-	0xC2,0x48,0x24,0x71,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0xC2,0x48,0xA6,0xA1,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,
-	0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x41,0x18,0x00,0x00,0x20,0x08,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,
-	0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,
-	0x24,0x71,0xC2,0x48,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,
-	0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,
-	0x48,0xE2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,
-	0x48,0xE2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC7,0xB9,
-	0xC2,0x48,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x07,0xC2,0x24,0x71,0xC2,0x48,0x24,0x71,
-	0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,
-	0xAA,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x89,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0x48,0xE2,0x89,0xFA,0x48,0xE2,
-	0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0xA6,0xA1,0x24,0x71,0x61,0x28,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x89,0xFA,
-	0x48,0xE2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,
-	0x20,0x08,0xC2,0x48,0xC7,0xB9,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x20,0x08,0x41,0x18,0x24,0x71,0x07,0xC2,0x48,0xE2,
-	0x69,0xF2,0x69,0xF2,0xC7,0xB9,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,
-	0x20,0x08,0x00,0x00,0x20,0x08,0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,
-	0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x41,0x18,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,
-	0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x00,0x00,0x41,0x18,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0xC2,0x48,0xA6,0xA1,
-	0x28,0xD2,0x89,0xFA,0x89,0xFA,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,
-	0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x00,0x00,
-	0xC2,0x48,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC7,0xB9,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x61,0x28,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x20,0x08,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x24,0x71,0x28,0xD2,0x69,0xF2,0x48,0xE2,
-	0x28,0xD2,0x24,0x71,0x41,0x18,0x00,0x00,0x20,0x08,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x41,0x18,0x20,0x08,0x00,0x00,0x61,0x28,0xC7,0xB9,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x61,0x28,0xA6,0xA1,0x28,0xD2,
-	0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x20,0x08,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x20,0x08,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x20,0x08,0xC2,0x48,0xC7,0xB9,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0xA6,0xA1,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0x61,0x28,0x41,0x18,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,
-	0x20,0x08,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x41,0x18,0x41,0x18,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x89,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0xC2,0x48,0x28,0xD2,0x89,0xFA,0x69,0xF2,0xC7,0xB9,
-	0x24,0x71,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x61,0x28,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x20,0x08,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0xAA,0xFA,0x48,0xE2,0xC2,0x48,0x20,0x08,0x61,0x28,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0x41,0x18,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x24,0x71,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x24,0x71,0x07,0xC2,0x89,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x41,0x18,
-	0xC2,0x48,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xC2,0x48,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x61,0x28,0x24,0x71,
-	0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0xA6,0xA1,
-	0x61,0x28,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x48,0xE2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x20,0x08,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0xA6,0xA1,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,
-	0x48,0xE2,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x20,0x08,0x20,0x08,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x48,0xE2,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xC2,0x48,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,
-	0x48,0xE2,0xA6,0xA1,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,
-	0x07,0xC2,0x48,0xE2,0x48,0xE2,0xC7,0xB9,0xA6,0xA1,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,
-	0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA6,0xA1,0x69,0xF2,
-	0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x48,0xE2,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,
-	0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,
-	0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,
-	0x48,0xE2,0x07,0xC2,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0x07,0xC2,0x48,0xE2,0x69,0xF2,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0x24,0x71,
-	0x41,0x18,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x00,0x00,0x41,0x18,0xA6,0xA1,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x20,0x08,0x41,0x18,0x41,0x18,0x20,0x08,0x41,0x18,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x48,0xE2,
-	0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x20,0x08,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x00,0x00,0x41,0x18,0xA6,0xA1,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,
-	0xC7,0xB9,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,
-	0x48,0xE2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x61,0x28,0xA6,0xA1,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x61,0x28,0x61,0x28,0xC7,0xB9,0xAA,0xFA,0x89,0xFA,0x48,0xE2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x89,0xFA,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0xA1,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xA6,0xA1,
-	0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC7,0xB9,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,
-	0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0x24,0x71,0x24,0x71,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x28,0xD2,0x07,0xC2,0x24,0x71,0xC2,0x48,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x28,0xD2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,
-	0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,
-	0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_20_388522_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 79,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_20_388522_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_20_388522_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_20_388522_data_3[] = {
-	//RGB565 data 
-	0x24,0x71,0xA6,0xA1,0xC7,0xB9,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0xC2,0x48,0x61,0x28,0x61,0x28,0x24,0x71,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xC7,0xB9,0x24,0x71,0xC2,0x48,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC7,0xB9,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xD2,0x28,0xD2,
-	0x69,0xF2,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,
-	0x24,0x71,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x07,0xC2,0x24,0x71,0x61,0x28,
-	0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,
-	0x24,0x71,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xC7,0xB9,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x41,0x18,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,
-	0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x61,0x28,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x41,0x18,0x20,0x08,0x24,0x71,0x07,0xC2,
-	0x48,0xE2,0x69,0xF2,0x69,0xF2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x41,0x18,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0xC2,0x48,
-	0x07,0xC2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x20,0x08,0x24,0x71,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x69,0xF2,
-	0x24,0x71,0x00,0x00,0xC2,0x48,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x48,0xE2,0x89,0xFA,0x48,0xE2,
-	0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0x89,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,
-	0x48,0xE2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,
-	0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC2,0x48,0x00,0x00,
-	0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0xA6,0xA1,
-	0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0x89,0xFA,0x89,0xFA,
-	0x28,0xD2,0xA6,0xA1,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,
-	0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA6,0xA1,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x24,0x71,0x61,0x28,0xA6,0xA1,0x69,0xF2,
-	0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xD2,
-	0x28,0xD2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,
-	0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x24,0x71,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x48,0xE2,
-	0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,
-	0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x24,0x71,0x07,0xC2,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0x24,0x71,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xC2,0x48,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,
-	0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,
-	0x48,0xE2,0xAA,0xFA,0x89,0xFA,0x24,0x71,0x20,0x08,0xC2,0x48,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0xA6,0xA1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,
-	0x28,0xD2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x00,0x00,0xC2,0x48,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,
-	0x28,0xD2,0x24,0x71,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x61,0x28,0x41,0x18,0x20,0x08,0x20,0x08,0x41,0x18,0xC2,0x48,0x24,0x71,0x07,0xC2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,
-	0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x07,0xC2,
-	0x48,0xE2,0x89,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x28,0xD2,
-	0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,
-	0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x28,0xD2,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x69,0xF2,0xC7,0xB9,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,
-	0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xD2,
-	0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,
-	0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x00,0x00,0x20,0x08,
-	0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xC7,0xB9,0x28,0xD2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_20_388522_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 79,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_20_388522_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_20_388522_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_20_388522_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,
-	0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xA6,0xA1,0x24,0x71,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,
-	0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x61,0x28,0x24,0x71,0x07,0xC2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x24,0x71,0x28,0xD2,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,
-	0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x07,0xC2,
-	0xA6,0xA1,0x24,0x71,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x61,0x28,0xA6,0xA1,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,
-	0x48,0xE2,0x89,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x89,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0x28,0xD2,
-	0x69,0xF2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x61,0x28,
-	0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,
-	0x07,0xC2,0x24,0x71,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0xC2,0x48,0xC7,0xB9,0x28,0xD2,0x69,0xF2,
-	0x69,0xF2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x48,0xE2,
-	0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x24,0x71,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,
-	0xC2,0x48,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x20,0x08,0x00,0x00,0x41,0x18,0xA6,0xA1,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,
-	0xA6,0xA1,0x24,0x71,0x41,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x61,0x28,0x24,0x71,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x20,0x08,0x24,0x71,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x20,0x08,0x61,0x28,0xC7,0xB9,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0xC2,0x48,0x61,0x28,0x61,0x28,
-	0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x41,0x18,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x07,0xC2,0xC7,0xB9,
-	0xA6,0xA1,0xA6,0xA1,0xA6,0xA1,0xA6,0xA1,0xA6,0xA1,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x24,0x71,0x61,0x28,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x24,0x71,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x20,0x08,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x69,0xF2,
-	0xAA,0xFA,0x48,0xE2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xC2,0x48,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x61,0x28,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,
-	0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,
-	0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA6,0xA1,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x41,0x18,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0x24,0x71,0xA6,0xA1,0xA6,0xA1,0xA6,0xA1,0xC7,0xB9,
-	0x48,0xE2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x24,0x71,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,0xC7,0xB9,0xC2,0x48,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC2,
-	0x28,0xD2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0xC2,0x48,0x07,0xC2,0x69,0xF2,
-	0x69,0xF2,0x89,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x08,0x24,0x71,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xE2,0x69,0xF2,0x69,0xF2,
-	0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0xAA,0xFA,
-	0x89,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,
-	0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0x00,0x00,0x20,0x08,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x07,0xC2,0x24,0x71,
-	0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,
-	0x61,0x28,0x20,0x08,0x61,0x28,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x07,0xC2,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,
-	0x28,0xD2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0xC2,0x48,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x20,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0x24,0x71,0xC2,0x48,
-	0x24,0x71,0xC7,0xB9,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC2,0x28,0xD2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x61,0x28,
-	0x61,0x28,0xC2,0x48,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_20_388522_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 79,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_20_388522_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_20_388522_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_20_388522_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,
-	0x24,0x71,0xA6,0xA1,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,
-	0x07,0xC2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x89,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,
-	0x28,0xD2,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0xAA,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,
-	0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x07,0xC2,
-	0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x07,0xC2,0x28,0xD2,
-	0x28,0xD2,0x28,0xD2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,
-	0x48,0xE2,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0xA6,0xA1,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x28,0xD2,0x28,0xD2,
-	0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0xA6,0xA1,0xA6,0xA1,0x24,0x71,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x24,0x71,0xA6,0xA1,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,
-	0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x28,0xD2,0x24,0x71,0x41,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x69,0xF2,
-	0xAA,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x20,0x08,0x00,0x00,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,
-	0x89,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x24,0x71,0x20,0x08,0x61,0x28,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0x69,0xF2,
-	0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x28,0xD2,0xAA,0xFA,0x89,0xFA,
-	0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xA6,0xA1,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x61,0x28,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,
-	0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,
-	0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x07,0xC2,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0x24,0x71,0xA6,0xA1,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x28,0xD2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0x07,0xC2,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x89,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,
-	0x69,0xF2,0x89,0xFA,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,
-	0xC7,0xB9,0xA6,0xA1,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x07,0xC2,
-	0xA6,0xA1,0x61,0x28,0x00,0x00,0x41,0x18,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x41,0x18,
-	0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x41,0x18,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0xC2,0x48,0x24,0x71,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,
-	0x41,0x18,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,
-	0x20,0x08,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,
-	0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x28,0xD2,0x24,0x71,0x20,0x08,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,
-	0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x20,0x08,0xC2,0x48,0xC7,0xB9,
-	0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,
-	0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,
-	0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,0xC7,0xB9,0x28,0xD2,0x28,0xD2,
-	0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,0x28,0xD2,0xA6,0xA1,
-	0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,
-	0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_20_388522_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 79,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_20_388522_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_20_388522_data_5};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_20_388522_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0x20,0x08,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xC7,0xB9,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x61,0x28,0x24,0x71,0x24,0x71,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xA6,0xA1,0xC7,0xB9,0x28,0xD2,
-	0x07,0xC2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA6,0xA1,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,0x24,0x71,0x41,0x18,0x41,0x18,0x24,0x71,0xA6,0xA1,0x07,0xC2,
-	0x48,0xE2,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0x89,0xFA,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0xC2,0x48,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0x24,0x71,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0x24,0x71,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x28,0xD2,0x07,0xC2,
-	0x24,0x71,0x61,0x28,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x89,0xFA,0xC7,0xB9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x41,0x18,0xC2,0x48,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,
-	0x48,0xE2,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,
-	0x48,0xE2,0x89,0xFA,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0xA6,0xA1,0xA6,0xA1,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0x24,0x71,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x41,0x18,0x00,0x00,0x20,0x08,0x24,0x71,0x07,0xC2,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x28,0x24,0x71,0xC7,0xB9,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x28,0xD2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x41,0x18,0x00,0x00,
-	0x00,0x00,0x41,0x18,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xC2,0x48,0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x28,0xD2,0x07,0xC2,0x07,0xC2,0x28,0xD2,0x69,0xF2,
-	0x48,0xE2,0xC7,0xB9,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0xC2,0x48,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x28,0xD2,0x24,0x71,0x41,0x18,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xA6,0xA1,
-	0x28,0xD2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC2,0x48,0x00,0x00,0x24,0x71,0x28,0xD2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x48,0xE2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,
-	0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x48,0xE2,0xC7,0xB9,0xA6,0xA1,0xA6,0xA1,0xC7,0xB9,0x48,0xE2,0x48,0xE2,0x28,0xD2,
-	0x24,0x71,0x20,0x08,0x00,0x00,0x41,0x18,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC7,0xB9,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0x24,0x71,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x28,0xD2,0x89,0xFA,0x69,0xF2,
-	0x48,0xE2,0xC7,0xB9,0x61,0x28,0x00,0x00,0x24,0x71,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0xA6,0xA1,0xC7,0xB9,0x48,0xE2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x20,0x08,0x00,0x00,0x61,0x28,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x61,0x28,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xC7,0xB9,0xAA,0xFA,
-	0xAA,0xFA,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0x61,0x28,0x41,0x18,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x24,0x71,0xA6,0xA1,0x48,0xE2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x20,0x08,
-	0x00,0x00,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC7,0xB9,0xA6,0xA1,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,
-	0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0x24,0x71,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0x69,0xF2,0xA6,0xA1,0x41,0x18,0x20,0x08,0x24,0x71,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x28,0xD2,0x07,0xC2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,
-	0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x41,0x18,0x20,0x08,0x24,0x71,
-	0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x61,0x28,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0xC2,0x48,0xC2,0x48,0x24,0x71,
-	0xC7,0xB9,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0x24,0x71,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x41,0x18,0xA6,0xA1,0x07,0xC2,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x61,0x28,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0x07,0xC2,0xC2,0x48,0x20,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xA6,0xA1,0x61,0x28,0xC2,0x48,0x24,0x71,0x07,0xC2,0x89,0xFA,0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x41,0x18,0xC2,0x48,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x41,0x18,0xA6,0xA1,0x28,0xD2,0x69,0xF2,
-	0x69,0xF2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0x24,0x71,0xA6,0xA1,0xA6,0xA1,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x28,0xD2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xC2,0x48,0x00,0x00,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x89,0xFA,0xAA,0xFA,0xC7,0xB9,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x69,0xF2,
-	0xAA,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x61,0x28,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xA6,0xA1,0x20,0x08,0x61,0x28,0xC7,0xB9,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x61,0x28,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x48,0xE2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x24,0x71,0xC7,0xB9,0x48,0xE2,0x89,0xFA,0x69,0xF2,0xC7,0xB9,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x07,0xC2,0x61,0x28,0x00,0x00,0x41,0x18,0x24,0x71,0x28,0xD2,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,0x61,0x28,0xC2,0x48,0x07,0xC2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,
-	0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC7,0xB9,0x48,0xE2,
-	0x69,0xF2,0x89,0xFA,0x07,0xC2,0xC2,0x48,0x00,0x00,0x24,0x71,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x00,0x00,0xC2,0x48,0x07,0xC2,0x48,0xE2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,
-	0x61,0x28,0x00,0x00,0x41,0x18,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0xC7,0xB9,0xC2,0x48,0x24,0x71,0x28,0xD2,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0x61,0x28,0x20,0x08,0x24,0x71,0x48,0xE2,0x69,0xF2,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x61,0x28,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x28,0xD2,0xC2,0x48,0x00,0x00,0x24,0x71,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0x24,0x71,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0x07,0xC2,0x24,0x71,0x61,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x69,0xF2,0x07,0xC2,
-	0xA6,0xA1,0x41,0x18,0x20,0x08,0xA6,0xA1,0x69,0xF2,0x89,0xFA,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x07,0xC2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x07,0xC2,0xC2,0x48,0x00,0x00,0x24,0x71,0x48,0xE2,0x89,0xFA,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,
-	0x41,0x18,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x07,0xC2,0x24,0x71,0xA6,0xA1,0x48,0xE2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x41,0x18,0x41,0x18,
-	0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x41,0x18,0x20,0x08,0x41,0x18,0x61,0x28,0xC2,0x48,0xA6,0xA1,0x69,0xF2,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x20,0x08,0x20,0x08,0xA6,0xA1,0xAA,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x41,0x18,0x20,0x08,0x20,0x08,0x61,0x28,0xC2,0x48,0xA6,0xA1,
-	0x48,0xE2,0x89,0xFA,0x69,0xF2,0x28,0xD2,0xA6,0xA1,0x61,0x28,0x00,0x00,0x24,0x71,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0xC2,0x48,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x28,0xD2,0xA6,0xA1,0xC7,0xB9,0x48,0xE2,0xAA,0xFA,0x89,0xFA,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x00,0x00,
-	0x20,0x08,0xA6,0xA1,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x89,0xFA,0x28,0xD2,0x24,0x71,0xC2,0x48,0xC2,0x48,0xC2,0x48,0xC2,0x48,0x24,0x71,0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x69,0xF2,0xC7,0xB9,0xC2,0x48,0x41,0x18,0x20,0x08,0x24,0x71,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x41,0x18,0x00,0x00,0x00,0x00,0x61,0x28,
-	0xC7,0xB9,0xAA,0xFA,0x89,0xFA,0x48,0xE2,0x07,0xC2,0x07,0xC2,0x48,0xE2,0x89,0xFA,0x89,0xFA,0xA6,0xA1,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,
-	0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x48,0xE2,0x89,0xFA,0x89,0xFA,0x28,0xD2,0x24,0x71,0x41,0x18,0x00,0x00,0x20,0x08,0x24,0x71,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x48,0xE2,0x07,0xC2,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0xC7,0xB9,0x07,0xC2,0x28,0xD2,0x69,0xF2,0x89,0xFA,0x89,0xFA,
-	0x48,0xE2,0x24,0x71,0x41,0x18,0x00,0x00,0x61,0x28,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0xA6,0xA1,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x61,0x28,0x07,0xC2,0xAA,0xFA,0x89,0xFA,0x48,0xE2,0x48,0xE2,0x48,0xE2,0x69,0xF2,0xAA,0xFA,0x89,0xFA,0xA6,0xA1,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xA6,0xA1,0xC2,0x48,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,
-	0xA6,0xA1,0x28,0xD2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x89,0xFA,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x00,0x00,0x20,0x08,0xC2,0x48,0xA6,0xA1,0x89,0xFA,0xAA,0xFA,0x48,0xE2,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x61,0x28,0xC7,0xB9,0x69,0xF2,
-	0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x69,0xF2,0x48,0xE2,0x28,0xD2,0x24,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,
-	0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0xC2,0x48,0xA6,0xA1,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x48,0xE2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0xC2,0x48,0x41,0x18,
-	0x00,0x00,0x61,0x28,0x24,0x71,0x07,0xC2,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x18,0x24,0x71,0x07,0xC2,0x69,0xF2,0xAA,0xFA,0xAA,0xFA,0xAA,0xFA,0x69,0xF2,0xC7,0xB9,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xA6,0xA1,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,
-	0x24,0x71,0xC7,0xB9,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0x07,0xC2,0xC7,0xB9,0xA6,0xA1,0x24,0x71,0x24,0x71,0x61,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x24,0x71,0xA6,0xA1,0x07,0xC2,0x28,0xD2,0xC7,0xB9,0xC2,0x48,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0xC2,0x48,0x24,0x71,0xC7,0xB9,0x28,0xD2,
-	0x07,0xC2,0x07,0xC2,0xC7,0xB9,0x24,0x71,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,
-	0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x41,0x18,0x20,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,
-	0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x08,0x41,0x18,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x61,0x28,0x41,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_20_388522_6 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 79,
-    .header.h = 27,
-    .data_size = sizeof(face_756_2_466_dial_img_20_388522_data_6),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_20_388522_data_6};
-
-    
\ No newline at end of file
@@ -1,407 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#include "../756_2_466.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_2_53268_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x20,0x60,0x28,0x60,0x28,0x40,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,
-	0x00,0x69,0x61,0x91,0x61,0x91,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0xC1,0xB9,0xE1,0xC1,0x61,0x91,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0x41,0xE2,0xE1,0xC1,0xC0,0x48,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,
-	0xE0,0x58,0xE0,0x58,0xC0,0x48,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0xC0,0x48,0xE0,0x58,0xC0,0x48,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x38,0xE0,0x58,0xE0,0x58,0x80,0x38,
-	0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x10,0x41,0x81,0x82,0xFA,0xC1,0xB9,0x60,0x28,0x00,0x08,0x00,0x00,0x24,0x21,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x69,0x4A,0xC7,0x39,0x24,0x21,0x40,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x0C,0x63,0x0C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x24,0x21,0x69,0x4A,0x0C,0x63,0xC7,0x39,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x81,0x82,0xFA,0x82,0xFA,0xE1,0xC1,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x41,0x81,0x22,0xCA,0x82,0xFA,0xE1,0xC1,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,
-	0x61,0x91,0x82,0xFA,0x41,0xE2,0xA1,0xA1,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x80,0x38,0x61,0x91,0x41,0xE2,0x61,0x91,0x00,0x08,0x00,0x00,0x00,0x00,0xCF,0x7B,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0xFB,0xDE,0x79,0xCE,0x54,0xA5,
-	0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xFB,0xDE,0x7D,0xEF,0xFB,0xDE,0xCF,0x7B,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xC7,0x39,0xCF,0x7B,0x79,0xCE,0x7D,0xEF,0x92,0x94,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x20,0x61,0x91,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xA1,0xA1,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC0,0x48,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x20,0xC0,0x48,0xE1,0xC1,0xA2,0xFA,0x82,0xFA,0xC1,0xB9,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x41,0x81,0xA1,0xA1,0xC1,0xB9,0x00,0x69,0x00,0x00,0x00,0x00,0xA2,0x18,0x92,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xF7,0xBD,0xCF,0x7B,0xC7,0x39,0x40,0x10,0x00,0x00,0xA2,0x18,0x0C,0x63,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x94,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x0C,0x63,0x54,0xA5,0xFF,0xFF,0xFF,0xFF,0x54,0xA5,0xCF,0x7B,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xC0,0x48,0xA1,0xA1,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xE1,0xC1,0xA2,0xFA,0xA2,0xFA,0xE1,0xC1,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x61,0x91,0x41,0xE2,0xA2,0xFA,0x41,0xE2,0x61,0x91,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0xC1,0xB9,0xE1,0xC1,0x61,0x91,0xC0,0x48,0x00,0x00,0x40,0x10,0xC7,0x39,0x54,0xA5,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xDE,0x92,0x94,0xA2,0x18,0x00,0x00,0x24,0x21,0xCF,0x7B,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0x54,0xA5,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xCF,0x7B,0xFB,0xDE,
-	0xFF,0xFF,0x7D,0xEF,0x92,0x94,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x61,0x91,0x22,0xCA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x41,0x81,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE1,0xC1,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0x41,0x81,
-	0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0xE1,0xC1,0x82,0xFA,0x82,0xFA,0xE1,0xC1,0x41,0x81,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x41,0xE2,0xE1,0xC1,0xE0,0x58,0x40,0x20,0x00,0x00,0x40,0x10,
-	0xC7,0x39,0x54,0xA5,0xFF,0xFF,0xFB,0xDE,0x54,0xA5,0x92,0x94,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0x92,0x94,0x54,0xA5,0xFB,0xDE,0xDF,0xFF,0xDF,0xFF,0xF7,0xBD,0xC7,0x39,0x00,0x08,0x24,0x21,0xCF,0x7B,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0x54,0xA5,0x24,0x21,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x24,0x21,0x54,0xA5,0xDF,0xFF,0xFF,0xFF,0xFB,0xDE,0xCF,0x7B,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0xE1,0xC1,0x41,0xE2,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0x41,0x81,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xE1,0xC1,
-	0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0x61,0x91,0xC0,0x48,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x81,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xB9,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xE0,0x58,0x82,0xFA,0xE1,0xC1,
-	0x60,0x28,0x00,0x00,0x00,0x00,0xA2,0x18,0xC7,0x39,0x54,0xA5,0xFF,0xFF,0x54,0xA5,0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xC7,0x39,0x92,0x94,0xFB,0xDE,0xFF,0xFF,0xFB,0xDE,0x69,0x4A,0xA2,0x18,0x24,0x21,0xCF,0x7B,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x69,0x4A,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x0C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x69,0x41,0xE2,0x41,0xE2,0xC1,0xB9,0x41,0xE2,0x82,0xFA,0x61,0x91,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x80,0x38,0xE1,0xC1,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xA1,0xA1,0xE0,0x58,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x61,0x91,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xB9,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,
-	0x80,0x38,0x61,0x91,0x41,0xE2,0xA1,0xA1,0x40,0x20,0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,0xF7,0xBD,0xFF,0xFF,0x92,0x94,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,0x54,0xA5,0xDF,0xFF,0xFB,0xDE,0x0C,0x63,0x24,0x21,0x69,0x4A,0x92,0x94,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x0C,0x63,
-	0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xCF,0x7B,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x0C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x61,0x91,0xA2,0xFA,0xE1,0xC1,0x00,0x69,0xE1,0xC1,0x82,0xFA,0x61,0x91,
-	0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0xE1,0xC1,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xB9,0x00,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0xC1,0xB9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xB9,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x41,0x81,0xC1,0xB9,0xE1,0xC1,0x41,0x81,0x00,0x08,0x00,0x00,0x00,0x00,0x24,0x21,0xCF,0x7B,0x79,0xCE,0xFF,0xFF,0x92,0x94,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xC7,0x39,0xCF,0x7B,0x7D,0xEF,0xFB,0xDE,0x0C,0x63,0xC7,0x39,0x0C,0x63,0x54,0xA5,0x7D,0xEF,
-	0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xCF,0x7B,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x0C,0x63,0xF7,0xBD,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x0C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0xC1,0xB9,0xA2,0xFA,0x61,0x91,
-	0x60,0x28,0x61,0x91,0xA2,0xFA,0xC1,0xB9,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC0,0x48,0xE1,0xC1,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xE1,0xC1,0x00,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x61,0x91,0x22,0xCA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x61,0x91,0x80,0x38,
-	0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xA1,0xA1,0xE1,0xC1,0x61,0x91,0xE0,0x58,0x00,0x08,0x00,0x00,0x00,0x00,0x24,0x21,0xCF,0x7B,0x79,0xCE,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x24,0x21,0xCF,0x7B,0xFB,0xDE,0x7D,0xEF,0x0C,0x63,
-	0x69,0x4A,0x0C,0x63,0x54,0xA5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xCF,0x7B,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xCF,0x7B,0xFB,0xDE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x69,0x4A,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,
-	0x61,0x91,0xE1,0xC1,0x41,0xE2,0x00,0x69,0x00,0x00,0x41,0x81,0xA2,0xFA,0xE1,0xC1,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0xE1,0xC1,0xA2,0xFA,0x82,0xFA,0x41,0xE2,0x22,0xCA,0x41,0x81,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0xE1,0xC1,0x41,0xE2,0x41,0xE2,
-	0x82,0xFA,0x82,0xFA,0x41,0x81,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x22,0xCA,0x22,0xCA,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xCF,0x7B,0xFB,0xDE,0xDF,0xFF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xC7,0x39,
-	0xCF,0x7B,0x7D,0xEF,0xFB,0xDE,0x0C,0x63,0xC7,0x39,0xCF,0x7B,0x54,0xA5,0x7D,0xEF,0xDF,0xFF,0x7D,0xEF,0x79,0xCE,0x92,0x94,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x54,0xA5,0xFF,0xFF,0x7D,0xEF,0x7D,0xEF,0xFF,0xFF,0xFB,0xDE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0xE1,0xC1,0x41,0xE2,0xE1,0xC1,0xC0,0x48,0x00,0x00,0x41,0x81,0x82,0xFA,0xE1,0xC1,0x41,0x81,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x38,0x41,0x81,0x41,0xE2,0x82,0xFA,0xE1,0xC1,0xE1,0xC1,0x82,0xFA,0xA1,0xA1,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x81,0x82,0xFA,0x22,0xCA,0xA1,0xA1,0x41,0xE2,0x82,0xFA,0x61,0x91,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x69,0x41,0xE2,0x22,0xCA,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x92,0x94,0xFB,0xDE,0x7D,0xEF,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x10,0x69,0x4A,0x92,0x94,0xDF,0xFF,0xFB,0xDE,0xC7,0x39,0x24,0x21,0xCF,0x7B,0xF7,0xBD,0xFB,0xDE,0x7D,0xEF,0x79,0xCE,0x79,0xCE,0x54,0xA5,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0xF7,0xBD,0xFF,0xFF,0x79,0xCE,0x54,0xA5,0xDF,0xFF,0xFB,0xDE,0xC7,0x39,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x69,0x82,0xFA,0x41,0xE2,0x61,0x91,0x60,0x28,0x00,0x00,0x00,0x69,0x41,0xE2,0xE1,0xC1,0x41,0x81,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0x61,0x91,0x41,0xE2,0x82,0xFA,0x61,0x91,0xA1,0xA1,0xA2,0xFA,0xE1,0xC1,0x40,0x20,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x20,0x61,0x91,0xA2,0xFA,0xE1,0xC1,0x41,0x81,0xE1,0xC1,0x82,0xFA,0x41,0x81,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x38,0x41,0x81,0x41,0xE2,0xC1,0xB9,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x54,0xA5,0xFB,0xDE,0xFB,0xDE,0x0C,0x63,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,0xF7,0xBD,0xDF,0xFF,0x79,0xCE,0x24,0x21,0xA2,0x18,0x92,0x94,0x79,0xCE,0xFB,0xDE,0x79,0xCE,0xF7,0xBD,0xF7,0xBD,0x79,0xCE,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xCF,0x7B,0x79,0xCE,0x7D,0xEF,0x54,0xA5,0x92,0x94,
-	0x7D,0xEF,0x79,0xCE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x41,0x81,0x82,0xFA,0xE1,0xC1,0xC0,0x48,0x00,0x08,0x00,0x00,0x00,0x69,0xE1,0xC1,0x22,0xCA,0xA1,0xA1,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0x61,0x91,0x82,0xFA,0x41,0xE2,0x00,0x69,0x41,0x81,0x82,0xFA,
-	0xE1,0xC1,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x00,0x69,0xC1,0xB9,0x82,0xFA,0xC1,0xB9,0x41,0x81,0xE1,0xC1,0x82,0xFA,0x00,0x69,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xE0,0x58,0xA1,0xA1,0xE1,0xC1,0x41,0x81,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,
-	0xF7,0xBD,0xFB,0xDE,0xF7,0xBD,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x54,0xA5,0x7D,0xEF,0xFB,0xDE,0x54,0xA5,0xA2,0x18,0xA2,0x18,0x92,0x94,0x79,0xCE,0x79,0xCE,0xF7,0xBD,0x92,0x94,0xF7,0xBD,0x7D,0xEF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,
-	0x79,0xCE,0xF7,0xBD,0x54,0xA5,0xF7,0xBD,0x79,0xCE,0x54,0xA5,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xC0,0x48,0xA1,0xA1,0x82,0xFA,0xA1,0xA1,0x40,0x20,0x00,0x00,0x00,0x00,0xE0,0x58,0xC1,0xB9,0x22,0xCA,0xC1,0xB9,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0xA1,0xA1,0x41,0xE2,
-	0x41,0xE2,0xE0,0x58,0xE0,0x58,0x41,0xE2,0xE1,0xC1,0xC0,0x48,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0xA1,0xA1,0xE1,0xC1,0xE1,0xC1,0x61,0x91,0x41,0x81,0xE1,0xC1,0x82,0xFA,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x61,0x91,0xC1,0xB9,0x61,0x91,0xE0,0x58,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xF7,0xBD,0xFB,0xDE,0xF7,0xBD,0xCF,0x7B,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0xC7,0x39,0x0C,0x63,0x79,0xCE,0xDF,0xFF,0xF7,0xBD,0x0C,0x63,0x40,0x10,0x24,0x21,0x54,0xA5,0x79,0xCE,0xF7,0xBD,0x54,0xA5,0xCF,0x7B,0xF7,0xBD,0xDF,0xFF,0x92,0x94,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x18,0x92,0x94,0x7D,0xEF,0xF7,0xBD,0x92,0x94,0x54,0xA5,0xF7,0xBD,0x79,0xCE,0x92,0x94,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x41,0x81,0x22,0xCA,0x82,0xFA,0x61,0x91,0x00,0x08,0x00,0x00,0x00,0x00,0xE0,0x58,0xC1,0xB9,0x41,0xE2,0xE1,0xC1,0xC0,0x48,0x00,0x00,0x00,0x00,
-	0x00,0x08,0xE0,0x58,0xA1,0xA1,0x41,0xE2,0xE1,0xC1,0xC0,0x48,0xE0,0x58,0x41,0xE2,0x41,0xE2,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x41,0xE2,0xE1,0xC1,0x61,0x91,0x00,0x69,0x41,0x81,0x22,0xCA,0x82,0xFA,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0xE1,0xC1,0xE1,0xC1,
-	0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,0x7D,0xEF,0xFB,0xDE,0xF7,0xBD,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xF7,0xBD,0xFB,0xDE,0xDF,0xFF,0x7D,0xEF,0x92,0x94,0xC7,0x39,0x00,0x00,0x24,0x21,0xF7,0xBD,0xFB,0xDE,0x54,0xA5,0x92,0x94,0xCF,0x7B,0xF7,0xBD,0xFF,0xFF,
-	0x54,0xA5,0x40,0x10,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0xF7,0xBD,0xFF,0xFF,0x92,0x94,0x69,0x4A,0x92,0x94,0xF7,0xBD,0x79,0xCE,0x54,0xA5,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0xC1,0xB9,0x41,0xE2,0xE1,0xC1,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0xA1,0xA1,0x41,0xE2,
-	0x41,0xE2,0xE0,0x58,0x00,0x00,0x00,0x00,0x40,0x10,0x00,0x69,0xC1,0xB9,0x41,0xE2,0xA1,0xA1,0x60,0x28,0xC0,0x48,0x41,0xE2,0x41,0xE2,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x00,0x40,0x10,0x41,0x81,0x82,0xFA,0xC1,0xB9,0xE0,0x58,0xE0,0x58,0x61,0x91,0x41,0xE2,0x41,0xE2,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0xC0,0x48,0x41,0xE2,0x22,0xCA,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFB,0xDE,0xFF,0xFF,0xDF,0xFF,0x7D,0xEF,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xF7,0xBD,0x69,0x4A,0xA2,0x18,0x00,0x00,0xC7,0x39,0x79,0xCE,0xFB,0xDE,0x54,0xA5,
-	0xCF,0x7B,0x0C,0x63,0x54,0xA5,0xFF,0xFF,0x54,0xA5,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0x79,0xCE,0xDF,0xFF,0xCF,0x7B,0x24,0x21,0x92,0x94,0x79,0xCE,0x79,0xCE,0x92,0x94,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0x41,0xE2,0x41,0xE2,0x41,0x81,0x80,0x38,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x60,0x28,0x41,0x81,0x41,0xE2,0x82,0xFA,0xE0,0x58,0x00,0x00,0x00,0x00,0x40,0x10,0x41,0x81,0xE1,0xC1,0x22,0xCA,0x61,0x91,0x40,0x20,0x80,0x38,0x41,0xE2,0x82,0xFA,0x61,0x91,0x80,0x38,0x00,0x00,0x00,0x08,0x80,0x38,0xA1,0xA1,0xA2,0xFA,0x61,0x91,0x40,0x20,0xE0,0x58,0xC1,0xB9,0x41,0xE2,0xE1,0xC1,0xC0,0x48,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x00,0x69,0x41,0xE2,0xC1,0xB9,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x54,0xA5,0x0C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,
-	0xC7,0x39,0xFB,0xDE,0x7D,0xEF,0x92,0x94,0x0C,0x63,0x69,0x4A,0x92,0x94,0xFF,0xFF,0xF7,0xBD,0xC7,0x39,0x40,0x10,0x00,0x00,0xC7,0x39,0x92,0x94,0x79,0xCE,0x79,0xCE,0x69,0x4A,0xA2,0x18,0x54,0xA5,0xDF,0xFF,0xF7,0xBD,0xCF,0x7B,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x20,0x41,0x81,0x82,0xFA,0x41,0xE2,
-	0x41,0x81,0xE0,0x58,0x80,0x38,0x80,0x38,0x80,0x38,0xE0,0x58,0x61,0x91,0x41,0xE2,0x82,0xFA,0x00,0x69,0x00,0x08,0x00,0x00,0x40,0x10,0x61,0x91,0x22,0xCA,0x22,0xCA,0x61,0x91,0x40,0x10,0x60,0x28,0xE1,0xC1,0x41,0xE2,0xA1,0xA1,0xC0,0x48,0x00,0x00,0x40,0x20,0x00,0x69,0xE1,0xC1,0x41,0xE2,0x00,0x69,0x00,0x00,0xE0,0x58,0xE1,0xC1,
-	0x41,0xE2,0xC1,0xB9,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xE0,0x58,0x61,0x91,0xE1,0xC1,0x61,0x91,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xCF,0x7B,0xDF,0xFF,0xDF,0xFF,0xFB,0xDE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0xF7,0xBD,0x92,0x94,0x0C,0x63,
-	0x24,0x21,0x00,0x08,0x00,0x00,0x00,0x00,0x69,0x4A,0xFB,0xDE,0x7D,0xEF,0x92,0x94,0x69,0x4A,0x24,0x21,0xCF,0x7B,0xDF,0xFF,0x79,0xCE,0x0C,0x63,0xA2,0x18,0x00,0x00,0x0C,0x63,0xF7,0xBD,0x79,0xCE,0x54,0xA5,0x24,0x21,0x00,0x08,0x54,0xA5,0xFF,0xFF,0xF7,0xBD,0x0C,0x63,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,
-	0xC0,0x48,0x61,0x91,0x82,0xFA,0x82,0xFA,0xE1,0xC1,0xC1,0xB9,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xC1,0xB9,0x22,0xCA,0xA2,0xFA,0x82,0xFA,0x41,0x81,0x40,0x10,0x00,0x00,0x40,0x20,0xA1,0xA1,0x41,0xE2,0x22,0xCA,0x41,0x81,0x40,0x10,0x60,0x28,0xC1,0xB9,0x41,0xE2,0xC1,0xB9,0xE0,0x58,0x00,0x00,0x80,0x38,0xC1,0xB9,0xE1,0xC1,0xA1,0xA1,
-	0xC0,0x48,0x00,0x00,0xE0,0x58,0xC1,0xB9,0x22,0xCA,0xC1,0xB9,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x41,0x81,0xC1,0xB9,0xA1,0xA1,0x00,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0xCF,0x7B,0xDF,0xFF,0xFB,0xDE,0x92,0x94,0xCF,0x7B,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x0C,0x63,
-	0x69,0x4A,0x24,0x21,0xA2,0x18,0x40,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x10,0x0C,0x63,0x7D,0xEF,0x7D,0xEF,0x92,0x94,0xC7,0x39,0xA2,0x18,0x0C,0x63,0xDF,0xFF,0xFB,0xDE,0xCF,0x7B,0x24,0x21,0x40,0x10,0x92,0x94,0xDF,0xFF,0xF7,0xBD,0x0C,0x63,0x40,0x10,0x40,0x10,0x54,0xA5,0xFF,0xFF,0xF7,0xBD,0x0C,0x63,0xA2,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x41,0x81,0xE1,0xC1,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0x41,0x81,0x40,0x20,0x00,0x00,0x40,0x20,0xA1,0xA1,0x82,0xFA,0xC1,0xB9,0x00,0x69,0x00,0x08,0x40,0x20,0x61,0x91,0xE1,0xC1,0xE1,0xC1,0x00,0x69,0x00,0x08,
-	0xE0,0x58,0x41,0xE2,0xE1,0xC1,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x69,0x41,0xE2,0x22,0xCA,0xA1,0xA1,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xC1,0xB9,0x22,0xCA,0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x24,0x21,0x92,0x94,0xFF,0xFF,0x79,0xCE,0x0C,0x63,0xC7,0x39,
-	0xA2,0x18,0xA2,0x18,0xA2,0x18,0x24,0x21,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,0x7D,0xEF,0xFB,0xDE,0xCF,0x7B,0x24,0x21,0x00,0x00,0x0C,0x63,0x7D,0xEF,0xFB,0xDE,0xCF,0x7B,0x69,0x4A,0xC7,0x39,0x54,0xA5,0xFF,0xFF,0x54,0xA5,0xC7,0x39,0x40,0x10,0x24,0x21,0xF7,0xBD,0xDF,0xFF,
-	0x54,0xA5,0x69,0x4A,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0xA1,0xA1,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x41,0x81,0x60,0x28,0x00,0x00,0x40,0x20,0xC1,0xB9,0x82,0xFA,0xA1,0xA1,0xE0,0x58,0x00,0x08,0x40,0x20,0x41,0x81,
-	0xC1,0xB9,0x22,0xCA,0x61,0x91,0x60,0x28,0x00,0x69,0x82,0xFA,0xE1,0xC1,0xC0,0x48,0x00,0x00,0x00,0x00,0x41,0x81,0x82,0xFA,0xE1,0xC1,0x41,0x81,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x41,0xE2,0x41,0xE2,0xC0,0x48,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0x54,0xA5,
-	0xFF,0xFF,0xF7,0xBD,0x69,0x4A,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x24,0x21,0xCF,0x7B,0x7D,0xEF,0xFB,0xDE,0x0C,0x63,0xA2,0x18,0x00,0x00,0x69,0x4A,0xFB,0xDE,0x79,0xCE,0x92,0x94,0x0C,0x63,0x0C,0x63,0xF7,0xBD,0x7D,0xEF,0xCF,0x7B,0x40,0x10,
-	0xA2,0x18,0x69,0x4A,0x79,0xCE,0xDF,0xFF,0x92,0x94,0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x22,0xCA,0x82,0xFA,0xE1,0xC1,0xC1,0xB9,0xC1,0xB9,0xA1,0xA1,0xC1,0xB9,0xC1,0xB9,0xC1,0xB9,0xC1,0xB9,0xE1,0xC1,0x41,0xE2,0x82,0xFA,0xA1,0xA1,0xC0,0x48,0x00,0x08,0x40,0x20,0xE1,0xC1,0xA2,0xFA,0xA1,0xA1,
-	0xC0,0x48,0x00,0x08,0x40,0x10,0x00,0x69,0xC1,0xB9,0x41,0xE2,0xC1,0xB9,0xE0,0x58,0x61,0x91,0x82,0xFA,0xA1,0xA1,0x40,0x20,0x00,0x00,0x00,0x00,0x61,0x91,0xA2,0xFA,0xE1,0xC1,0x41,0x81,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0x41,0xE2,0x22,0xCA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x18,0xC7,0x39,0x54,0xA5,0xFF,0xFF,0x54,0xA5,0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x24,0x21,0xCF,0x7B,0x7D,0xEF,0xFB,0xDE,0x69,0x4A,0x40,0x10,0x00,0x00,0x69,0x4A,0x79,0xCE,0x79,0xCE,0x54,0xA5,0x54,0xA5,0x54,0xA5,
-	0x79,0xCE,0x79,0xCE,0x0C,0x63,0x00,0x00,0xA2,0x18,0x69,0x4A,0x79,0xCE,0xDF,0xFF,0x92,0x94,0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x00,0x69,0x41,0xE2,0x41,0xE2,0x61,0x91,0xE0,0x58,0x80,0x38,0x80,0x38,0x80,0x38,0x80,0x38,0x80,0x38,0x80,0x38,0xE0,0x58,0xE1,0xC1,0xA2,0xFA,0xC1,0xB9,0x00,0x69,0x40,0x20,
-	0x60,0x28,0xE1,0xC1,0x82,0xFA,0x61,0x91,0xC0,0x48,0x00,0x08,0x40,0x10,0xE0,0x58,0xA1,0xA1,0x82,0xFA,0x41,0xE2,0xA1,0xA1,0xC1,0xB9,0x41,0xE2,0x41,0x81,0x00,0x08,0x00,0x00,0x00,0x00,0x61,0x91,0xA2,0xFA,0xE1,0xC1,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0x61,0x91,0xE1,0xC1,0xA1,0xA1,0x60,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x54,0xA5,0xFF,0xFF,0x54,0xA5,0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0x92,0x94,0x7D,0xEF,0x79,0xCE,0x69,0x4A,0x40,0x10,0x00,0x00,0x69,0x4A,0xF7,0xBD,
-	0x79,0xCE,0xF7,0xBD,0x79,0xCE,0xFB,0xDE,0x79,0xCE,0x92,0x94,0xC7,0x39,0x00,0x00,0xA2,0x18,0x69,0x4A,0x79,0xCE,0xDF,0xFF,0xCF,0x7B,0x24,0x21,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x38,0x61,0x91,0xA2,0xFA,0x22,0xCA,0xC0,0x48,0x40,0x20,0x40,0x10,0x00,0x08,0x40,0x10,0x00,0x08,0x40,0x10,0x40,0x10,0x60,0x28,0xA1,0xA1,
-	0xA2,0xFA,0xC1,0xB9,0x00,0x69,0x60,0x28,0x80,0x38,0xE1,0xC1,0x82,0xFA,0x41,0x81,0x60,0x28,0x00,0x08,0x00,0x08,0x80,0x38,0x61,0x91,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xE1,0xC1,0xC1,0xB9,0xE0,0x58,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x91,0xA2,0xFA,0xC1,0xB9,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,0x40,0x10,0x41,0x81,0xC1,0xB9,
-	0xA1,0xA1,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0xF7,0xBD,0xFF,0xFF,0x92,0x94,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x54,0xA5,0xDF,0xFF,0x79,0xCE,0xC7,0x39,
-	0x00,0x00,0x00,0x00,0xC7,0x39,0x92,0x94,0x79,0xCE,0xFB,0xDE,0x7D,0xEF,0xDF,0xFF,0xF7,0xBD,0x0C,0x63,0xA2,0x18,0x00,0x00,0x24,0x21,0x0C,0x63,0xFB,0xDE,0x7D,0xEF,0xCF,0x7B,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x69,0xE1,0xC1,0xA2,0xFA,0xC1,0xB9,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x91,0xA2,0xFA,0xC1,0xB9,0x00,0x69,0x80,0x38,0xC0,0x48,0xE1,0xC1,0x41,0xE2,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x69,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xE1,0xC1,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x00,0x60,0x28,0xA1,0xA1,0xA2,0xFA,0xC1,0xB9,0xC0,0x48,0x40,0x20,0x00,0x00,
-	0x00,0x00,0x40,0x20,0xA1,0xA1,0x41,0xE2,0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xCF,0x7B,0x79,0xCE,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,
-	0xF7,0xBD,0xFF,0xFF,0xF7,0xBD,0xA2,0x18,0x00,0x00,0x00,0x00,0x24,0x21,0xCF,0x7B,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x92,0x94,0x24,0x21,0x00,0x00,0x00,0x00,0xC7,0x39,0xCF,0x7B,0x7D,0xEF,0x7D,0xEF,0x0C,0x63,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xA1,0xA1,0x41,0xE2,0x41,0xE2,0x41,0x81,0x40,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x91,0xA2,0xFA,0x22,0xCA,0x61,0x91,0xC0,0x48,0xC0,0x48,0xE1,0xC1,0x41,0xE2,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x08,0xE0,0x58,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xC1,0xB9,0x80,0x38,0x40,0x10,0x00,0x00,0x00,0x08,0x60,0x28,0xA1,0xA1,0xA2,0xFA,
-	0xA1,0xA1,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x08,0x80,0x38,0xE1,0xC1,0x41,0xE2,0x00,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xCF,0x7B,0x79,0xCE,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,0xF7,0xBD,0xFF,0xFF,0xF7,0xBD,0xA2,0x18,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xCF,0x7B,0x40,0x10,0x00,0x00,0x00,0x00,0x69,0x4A,0x92,0x94,0x7D,0xEF,0x7D,0xEF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x22,0xCA,0x82,0xFA,
-	0xA1,0xA1,0xE0,0x58,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x81,0x82,0xFA,0x41,0xE2,0xC1,0xB9,0xE0,0x58,0xE0,0x58,0x41,0xE2,0x41,0xE2,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xA1,0xA1,0x40,0x20,0x00,0x00,0x00,0x00,
-	0x40,0x10,0x80,0x38,0xC1,0xB9,0xA2,0xFA,0x61,0x91,0x60,0x28,0x00,0x08,0x00,0x00,0x40,0x20,0xE0,0x58,0x41,0xE2,0x41,0xE2,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xCF,0x7B,0xFB,0xDE,0xFF,0xFF,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,0xF7,0xBD,0xFF,0xFF,0xF7,0xBD,0xA2,0x18,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x54,0xA5,0xFF,0xFF,0xDF,0xFF,0x79,0xCE,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x08,0x69,0x4A,0x92,0x94,0x7D,0xEF,0x7D,0xEF,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x60,0x28,0x00,0x69,0x82,0xFA,0x82,0xFA,0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x81,0x41,0xE2,0x41,0xE2,0x22,0xCA,0x41,0x81,0x41,0x81,0x82,0xFA,0x82,0xFA,0xE0,0x58,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x82,0xFA,0xA2,0xFA,0x41,0xE2,
-	0x41,0x81,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0xE1,0xC1,0xA2,0xFA,0x61,0x91,0x40,0x20,0x00,0x00,0x00,0x00,0xC0,0x48,0x41,0x81,0xE1,0xC1,0xA1,0xA1,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x54,0xA5,0xFB,0xDE,0x7D,0xEF,0xCF,0x7B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x92,0x94,0xFB,0xDE,0x7D,0xEF,0x54,0xA5,0xA2,0x18,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x54,0xA5,0xFF,0xFF,0x7D,0xEF,0x92,0x94,0xC7,0x39,0x00,0x00,0x00,0x00,0x40,0x10,0x0C,0x63,0xF7,0xBD,0xDF,0xFF,0xFB,0xDE,
-	0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x00,0x69,0x41,0xE2,0xE1,0xC1,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0xC1,0xB9,0xE1,0xC1,0xC1,0xB9,0x41,0x81,0x41,0x81,0x22,0xCA,0xE1,0xC1,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x80,0x38,0xE1,0xC1,0x41,0xE2,0x61,0x91,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xE0,0x58,0xC1,0xB9,0x41,0xE2,0x00,0x69,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x69,0xA1,0xA1,0xA1,0xA1,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x54,0xA5,0xF7,0xBD,
-	0x54,0xA5,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x92,0x94,0xF7,0xBD,0xF7,0xBD,0xCF,0x7B,0xA2,0x18,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0x92,0x94,0x7D,0xEF,0x54,0xA5,0x69,0x4A,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x08,
-	0x0C,0x63,0x54,0xA5,0x79,0xCE,0xF7,0xBD,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x60,0x28,0xC0,0x48,0x80,0x38,0x40,0x20,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x80,0x38,0x80,0x38,0x80,0x38,0x60,0x28,0x60,0x28,0xC0,0x48,0xC0,0x48,0x40,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC0,0x48,0xC0,0x48,0x60,0x28,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x20,0x80,0x38,0xC0,0x48,0x60,0x28,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x91,0x41,0xE2,0x61,0x91,0xC0,0x48,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x18,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0xC7,0x39,0xC7,0x39,0x24,0x21,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0xC7,0x39,0x69,0x4A,0xC7,0x39,0xA2,0x18,
-	0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xC7,0x39,0x69,0x4A,0xC7,0x39,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0xC1,0xB9,0x41,0xE2,0x41,0x81,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0x41,0xE2,0x82,0xFA,0xE0,0x58,0x00,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xE0,0x58,
-	0xA1,0xA1,0xC1,0xB9,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_2_53268_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 100,
-    .header.h = 38,
-    .data_size = sizeof(face_756_2_466_dial_img_2_53268_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_2_53268_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_2_53268_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x10,0x60,0x28,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x20,0x60,0x28,0x60,0x28,0x40,0x20,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,
-	0x00,0x69,0x61,0x91,0x61,0x91,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0xC1,0xB9,0xE1,0xC1,0x61,0x91,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0x41,0xE2,0xE1,0xC1,0xC0,0x48,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,
-	0x0C,0x63,0x0C,0x63,0x69,0x4A,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0x69,0x4A,0x0C,0x63,0x69,0x4A,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0x0C,0x63,0x0C,0x63,0xC7,0x39,
-	0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x10,0x41,0x81,0x82,0xFA,0xC1,0xB9,0x60,0x28,0x00,0x08,0x00,0x00,0x60,0x28,0xE0,0x58,0xE0,0x58,0xE0,0x58,0xE0,0x58,0xE0,0x58,0xE0,0x58,0xE0,0x58,0xE0,0x58,0xC0,0x48,0x80,0x38,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x20,0xC0,0x48,0xE0,0x58,0xE0,0x58,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x20,0xC0,0x48,0xE0,0x58,0x80,0x38,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x10,0xCF,0x7B,0x7D,0xEF,0x7D,0xEF,0x79,0xCE,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0xCF,0x7B,0x79,0xCE,0x7D,0xEF,0x79,0xCE,0xC7,0x39,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,
-	0x54,0xA5,0x7D,0xEF,0xFB,0xDE,0x54,0xA5,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x80,0x38,0x61,0x91,0x41,0xE2,0x61,0x91,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x69,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xE1,0xC1,0xA1,0xA1,
-	0x41,0x81,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x41,0xE2,0x82,0xFA,0x41,0xE2,0x41,0x81,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x00,0x69,0xE1,0xC1,0x41,0xE2,0x61,0x91,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x24,0x21,0x54,0xA5,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x54,0xA5,0xDF,0xFF,0xFF,0xFF,0xFB,0xDE,0x69,0x4A,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x79,0xCE,0xFF,0xFF,0xDF,0xFF,0xF7,0xBD,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x41,0x81,0xA1,0xA1,0xC1,0xB9,0x00,0x69,0x00,0x00,0x00,0x00,0x40,0x10,0x61,0x91,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xE1,0xC1,0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x08,0xE0,0x58,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0x61,0x91,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xE0,0x58,0xA1,0xA1,0x82,0xFA,0xA2,0xFA,0xA1,0xA1,0x00,0x69,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x0C,0x63,0x24,0x21,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x92,0x94,0xFB,0xDE,0xFF,0xFF,0xFB,0xDE,0x54,0xA5,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0xC1,0xB9,0xE1,0xC1,0x61,0x91,0xC0,0x48,0x00,0x00,0x00,0x00,0x60,0x28,0x61,0x91,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x22,0xCA,0x61,0x91,0x40,0x20,0x00,0x00,0x40,0x20,0x00,0x69,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xA1,0xA1,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x81,0x41,0xE2,
-	0xA2,0xFA,0x41,0xE2,0x61,0x91,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x92,0x94,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xCF,0x7B,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0xCF,0x7B,
-	0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,0x7D,0xEF,0xFF,0xFF,0x79,0xCE,0x92,0x94,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x41,0xE2,0xE1,0xC1,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x08,
-	0x80,0x38,0xA1,0xA1,0xA2,0xFA,0x22,0xCA,0x61,0x91,0x41,0x81,0x41,0x81,0x41,0x81,0x41,0x81,0x41,0x81,0x61,0x91,0x22,0xCA,0x82,0xFA,0x82,0xFA,0xC1,0xB9,0x60,0x28,0x00,0x00,0x40,0x20,0x00,0x69,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xA1,0xA1,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x20,0xA1,0xA1,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0x41,0x81,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,0x7D,0xEF,0x7D,0xEF,0xFF,0xFF,0xDF,0xFF,0x92,0x94,0x24,0x21,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xF7,0xBD,
-	0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x54,0xA5,0x69,0x4A,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBD,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xE0,0x58,0x82,0xFA,0xE1,0xC1,
-	0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x38,0xA1,0xA1,0xA2,0xFA,0xA1,0xA1,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x61,0x91,0x41,0xE2,0xA2,0xFA,0x22,0xCA,0x80,0x38,0x00,0x08,0x40,0x20,0x00,0x69,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xC1,0xB9,0xC0,0x48,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x38,0xC1,0xB9,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xE0,0x58,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0xCF,0x7B,0x7D,0xEF,0xFB,0xDE,0xF7,0xBD,0xFB,0xDE,0xDF,0xFF,0x92,0x94,0x24,0x21,0x40,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x10,0xC7,0x39,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x54,0xA5,0x0C,0x63,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0xC7,0x39,0x54,0xA5,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBD,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,
-	0x80,0x38,0x61,0x91,0x41,0xE2,0xA1,0xA1,0x40,0x20,0x00,0x00,0x00,0x00,0x40,0x20,0xC0,0x48,0xC1,0xB9,0xA2,0xFA,0x61,0x91,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xE0,0x58,0xA1,0xA1,0x82,0xFA,0x41,0xE2,0xC0,0x48,0x40,0x20,0x80,0x38,0x41,0x81,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xE1,0xC1,0xE0,0x58,
-	0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x00,0x69,0xE1,0xC1,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x24,0x21,0x92,0x94,0xFF,0xFF,0x79,0xCE,0xCF,0x7B,0xF7,0xBD,0xFF,0xFF,0x54,0xA5,
-	0xC7,0x39,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xF7,0xBD,0x0C,0x63,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBD,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x41,0x81,0xC1,0xB9,0xE1,0xC1,0x41,0x81,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x28,0x00,0x69,0xE1,0xC1,0xA2,0xFA,0x41,0x81,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x41,0x81,0x41,0xE2,0x41,0xE2,0xE0,0x58,0x80,0x38,0xE0,0x58,0x61,0x91,0x41,0xE2,
-	0xA2,0xFA,0xA2,0xFA,0xE1,0xC1,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xE0,0x58,0xC1,0xB9,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xE0,0x58,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0xF7,0xBD,0xFF,0xFF,0x92,0x94,
-	0x24,0x21,0x92,0x94,0xFF,0xFF,0xF7,0xBD,0x0C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xF7,0xBD,0xCF,0x7B,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x92,0x94,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x54,0xA5,0x69,0x4A,
-	0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xA1,0xA1,0xE1,0xC1,0x61,0x91,0xE0,0x58,0x00,0x08,0x00,0x00,0x00,0x00,0x60,0x28,0x00,0x69,0xE1,0xC1,0xA2,0xFA,0x41,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x69,0x41,0xE2,0x41,0xE2,0xE0,0x58,
-	0x80,0x38,0xE0,0x58,0xA1,0xA1,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xE1,0xC1,0x00,0x69,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x81,0x41,0xE2,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xC0,0x48,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,
-	0x92,0x94,0x79,0xCE,0x7D,0xEF,0x0C,0x63,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0x79,0xCE,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x08,0x24,0x21,0x0C,0x63,0xFB,0xDE,0xFF,0xFF,0x7D,0xEF,0xFB,0xDE,0xFB,0xDE,0x92,0x94,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,0xFB,0xDE,0x7D,0xEF,
-	0xDF,0xFF,0xDF,0xFF,0x92,0x94,0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x22,0xCA,0x22,0xCA,0x00,0x69,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x41,0x81,0xE1,0xC1,0x82,0xFA,0x41,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,
-	0x00,0x69,0x41,0xE2,0x41,0xE2,0xE0,0x58,0x60,0x28,0x00,0x69,0xA1,0xA1,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xE1,0xC1,0x61,0x91,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xA1,0xA1,0xA2,0xFA,0x82,0xFA,0x41,0xE2,0xA2,0xFA,0x41,0xE2,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x79,0xCE,0xFB,0xDE,0xF7,0xBD,0x69,0x4A,0x00,0x00,0xCF,0x7B,0xDF,0xFF,0x79,0xCE,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0xCF,0x7B,0xFB,0xDE,0xDF,0xFF,0x79,0xCE,0x79,0xCE,0x7D,0xEF,0x54,0xA5,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,
-	0xCF,0x7B,0x7D,0xEF,0x79,0xCE,0x54,0xA5,0xFB,0xDE,0xDF,0xFF,0x92,0x94,0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x69,0x41,0xE2,0x22,0xCA,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x61,0x91,0x41,0xE2,0x41,0xE2,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0x61,0x91,0x82,0xFA,0x41,0xE2,0x80,0x38,0x40,0x20,0x41,0x81,0xC1,0xB9,0x41,0xE2,0x41,0xE2,0x22,0xCA,0xE1,0xC1,0xA1,0xA1,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xC0,0x48,0xE1,0xC1,0xA2,0xFA,0xE1,0xC1,0xA1,0xA1,0x82,0xFA,0x41,0xE2,0x80,0x38,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x0C,0x63,0x7D,0xEF,0xFB,0xDE,0x92,0x94,0xC7,0x39,0x00,0x00,0xCF,0x7B,0x7D,0xEF,0x79,0xCE,0x92,0x94,0xC7,0x39,0x00,0x00,0x00,0x00,0x40,0x10,0x69,0x4A,0x92,0x94,0x7D,0xEF,0x7D,0xEF,0x54,0xA5,0x54,0xA5,0xFF,0xFF,0x79,0xCE,0x24,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x10,0x24,0x21,0x54,0xA5,0xFF,0xFF,0xF7,0xBD,0x92,0x94,0x79,0xCE,0xDF,0xFF,0x92,0x94,0x24,0x21,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x80,0x38,0x41,0x81,0x41,0xE2,0xC1,0xB9,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0xA1,0xA1,0x41,0xE2,0x22,0xCA,0x00,0x69,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x00,0x69,0xC1,0xB9,0x82,0xFA,0xE1,0xC1,0x40,0x20,0x40,0x10,0x61,0x91,0xE1,0xC1,0x22,0xCA,0x22,0xCA,0xC1,0xB9,0xE1,0xC1,0xE1,0xC1,0x00,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x41,0x81,0xE1,0xC1,0x82,0xFA,0xA1,0xA1,0x61,0x91,
-	0x41,0xE2,0x22,0xCA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x24,0x21,0x92,0x94,0xFF,0xFF,0x79,0xCE,0x69,0x4A,0x40,0x10,0x00,0x00,0x0C,0x63,0x79,0xCE,0x79,0xCE,0x54,0xA5,0xC7,0x39,0x00,0x00,0x00,0x00,0x40,0x10,0x69,0x4A,0x54,0xA5,0x7D,0xEF,0x7D,0xEF,0xCF,0x7B,0xCF,0x7B,0xDF,0xFF,
-	0x79,0xCE,0xC7,0x39,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xCF,0x7B,0xF7,0xBD,0x7D,0xEF,0xF7,0xBD,0xCF,0x7B,0x79,0xCE,0xDF,0xFF,0xCF,0x7B,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xE0,0x58,0xA1,0xA1,0xE1,0xC1,0x41,0x81,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,
-	0xC1,0xB9,0x22,0xCA,0xE1,0xC1,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xA1,0xA1,0x41,0xE2,0x41,0xE2,0xA1,0xA1,0x40,0x20,0x40,0x20,0x61,0x91,0xE1,0xC1,0xE1,0xC1,0xC1,0xB9,0x61,0x91,0xC1,0xB9,0x41,0xE2,0x41,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xE1,0xC1,
-	0xE1,0xC1,0xC1,0xB9,0xC1,0xB9,0xC1,0xB9,0x22,0xCA,0xA1,0xA1,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x54,0xA5,0xFF,0xFF,0x54,0xA5,0x24,0x21,0x00,0x00,0x00,0x00,0x0C,0x63,0xF7,0xBD,0xFB,0xDE,0xF7,0xBD,0x69,0x4A,0x00,0x00,0x00,0x00,0x40,0x10,0x0C,0x63,0x54,0xA5,0x7D,0xEF,
-	0xFB,0xDE,0x0C,0x63,0x0C,0x63,0x7D,0xEF,0xFB,0xDE,0x69,0x4A,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x54,0xA5,0x79,0xCE,0x79,0xCE,0x54,0xA5,0xCF,0x7B,0xFB,0xDE,0xDF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x61,0x91,0xC1,0xB9,0x61,0x91,0xE0,0x58,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0xE1,0xC1,0x41,0xE2,0xE1,0xC1,0x00,0x69,0x40,0x20,0x40,0x20,0x40,0x20,0x40,0x20,0x40,0x20,0x60,0x28,0xE0,0x58,0xE1,0xC1,0x82,0xFA,0xC1,0xB9,0x00,0x69,0x00,0x08,0x40,0x20,0xA1,0xA1,0x22,0xCA,0xC1,0xB9,0xA1,0xA1,0x41,0x81,0xC1,0xB9,0x82,0xFA,0x61,0x91,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x61,0x91,0x82,0xFA,0xC1,0xB9,0x41,0x81,0xA1,0xA1,0xE1,0xC1,0xE1,0xC1,0x61,0x91,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x92,0x94,0x79,0xCE,0x7D,0xEF,0x92,0x94,0x40,0x10,0x00,0x00,0x00,0x00,0x0C,0x63,0xF7,0xBD,0xFB,0xDE,0x79,0xCE,0x69,0x4A,0x00,0x00,0x00,0x00,
-	0xA2,0x18,0x0C,0x63,0x54,0xA5,0xFB,0xDE,0x79,0xCE,0x69,0x4A,0x0C,0x63,0x7D,0xEF,0xFB,0xDE,0x0C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFB,0xDE,0x79,0xCE,0x92,0x94,0xCF,0x7B,0xCF,0x7B,0xFB,0xDE,0xDF,0xFF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0xE1,0xC1,0xE1,0xC1,
-	0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0x22,0xCA,0x82,0xFA,0x41,0xE2,0xC1,0xB9,0x61,0x91,0x61,0x91,0x61,0x91,0x61,0x91,0x61,0x91,0xC1,0xB9,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0x41,0x81,0x60,0x28,0x00,0x00,0x60,0x28,0xC1,0xB9,0x41,0xE2,0xA1,0xA1,0x41,0x81,0x00,0x69,0xC1,0xB9,0xA2,0xFA,
-	0xA1,0xA1,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0xC1,0xB9,0xA2,0xFA,0x61,0x91,0xC0,0x48,0x61,0x91,0xE1,0xC1,0x22,0xCA,0xA1,0xA1,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0xF7,0xBD,0xFB,0xDE,0x79,0xCE,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x54,0xA5,0xFB,0xDE,
-	0xFB,0xDE,0x0C,0x63,0x00,0x00,0x00,0x00,0xA2,0x18,0xCF,0x7B,0xF7,0xBD,0xFB,0xDE,0x54,0xA5,0xC7,0x39,0x69,0x4A,0x7D,0xEF,0x7D,0xEF,0xCF,0x7B,0xC7,0x39,0x00,0x00,0x00,0x00,0xA2,0x18,0x92,0x94,0xDF,0xFF,0xF7,0xBD,0x0C,0x63,0x0C,0x63,0x92,0x94,0xFB,0xDE,0x7D,0xEF,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0xC0,0x48,0x41,0xE2,0x22,0xCA,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x58,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xB9,0xC0,0x48,0x00,0x08,0x00,0x00,0x80,0x38,0xE1,0xC1,0x41,0xE2,0xA1,0xA1,
-	0x00,0x69,0xE0,0x58,0xA1,0xA1,0xA2,0xFA,0xA1,0xA1,0x40,0x20,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0xE1,0xC1,0x82,0xFA,0x00,0x69,0x60,0x28,0x61,0x91,0x22,0xCA,0xE1,0xC1,0x61,0x91,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x7D,0xEF,0xFB,0xDE,0x92,0x94,0xC7,0x39,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC7,0x39,0x92,0x94,0xFB,0xDE,0x7D,0xEF,0x0C,0x63,0x00,0x00,0x00,0x00,0xA2,0x18,0xCF,0x7B,0x79,0xCE,0x79,0xCE,0x92,0x94,0xA2,0x18,0xC7,0x39,0xFB,0xDE,0x7D,0xEF,0x92,0x94,0x69,0x4A,0x00,0x00,0x40,0x10,0x69,0x4A,0x54,0xA5,0xFF,0xFF,0x92,0x94,0x24,0x21,0x0C,0x63,0xF7,0xBD,0xFB,0xDE,0x79,0xCE,0x69,0x4A,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x00,0x69,0x41,0xE2,0xC1,0xB9,0x60,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA1,0xA1,0xE0,0x58,0x40,0x20,0x00,0x00,0x00,0x00,
-	0x80,0x38,0x41,0xE2,0x41,0xE2,0x61,0x91,0xE0,0x58,0x80,0x38,0x61,0x91,0x82,0xFA,0xC1,0xB9,0x80,0x38,0x00,0x00,0x00,0x00,0x80,0x38,0x61,0x91,0xE1,0xC1,0x22,0xCA,0xC0,0x48,0x40,0x10,0xA1,0xA1,0x82,0xFA,0xE1,0xC1,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xA2,0x18,0xCF,0x7B,0xDF,0xFF,0x7D,0xEF,
-	0x92,0x94,0x0C,0x63,0xC7,0x39,0xC7,0x39,0xC7,0x39,0x0C,0x63,0x54,0xA5,0x7D,0xEF,0xDF,0xFF,0xCF,0x7B,0x40,0x10,0x00,0x00,0xA2,0x18,0x92,0x94,0xFB,0xDE,0x79,0xCE,0x92,0x94,0x40,0x10,0x24,0x21,0x79,0xCE,0x7D,0xEF,0x54,0xA5,0x69,0x4A,0x00,0x00,0x24,0x21,0xCF,0x7B,0x79,0xCE,0x7D,0xEF,0xCF,0x7B,0x00,0x00,0x0C,0x63,0xF7,0xBD,
-	0xFB,0xDE,0xF7,0xBD,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xE0,0x58,0x61,0x91,0xE1,0xC1,0x61,0x91,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xE1,0xC1,0xE1,0xC1,0xE1,0xC1,0xE1,0xC1,0xE1,0xC1,0xE1,0xC1,0xC1,0xB9,0x61,0x91,0xE0,0x58,
-	0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x41,0xE2,0x41,0xE2,0x61,0x91,0xC0,0x48,0x40,0x20,0x41,0x81,0x82,0xFA,0xE1,0xC1,0xC0,0x48,0x40,0x10,0x00,0x00,0xE0,0x58,0xE1,0xC1,0xE1,0xC1,0xA1,0xA1,0x60,0x28,0x00,0x08,0xA1,0xA1,0xA2,0xFA,0xC1,0xB9,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,
-	0x69,0x4A,0x54,0xA5,0xDF,0xFF,0xDF,0xFF,0x79,0xCE,0xF7,0xBD,0x54,0xA5,0x54,0xA5,0x54,0xA5,0xF7,0xBD,0xFB,0xDE,0xFF,0xFF,0xDF,0xFF,0xCF,0x7B,0xA2,0x18,0x00,0x00,0xA2,0x18,0x54,0xA5,0x7D,0xEF,0x79,0xCE,0x92,0x94,0xA2,0x18,0x24,0x21,0xF7,0xBD,0xFB,0xDE,0xF7,0xBD,0x0C,0x63,0x00,0x00,0xC7,0x39,0xF7,0xBD,0x79,0xCE,0x54,0xA5,
-	0x69,0x4A,0x00,0x00,0x0C,0x63,0xF7,0xBD,0xFB,0xDE,0xF7,0xBD,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x41,0x81,0xC1,0xB9,0xA1,0xA1,0x00,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x81,0x82,0xFA,0x41,0xE2,0x61,0x91,0x00,0x69,0xC0,0x48,0xC0,0x48,0xC0,0x48,0xC0,0x48,
-	0xC0,0x48,0x60,0x28,0x40,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x48,0x41,0xE2,0x41,0xE2,0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x69,0x82,0xFA,0x22,0xCA,0x00,0x69,0x40,0x20,0x00,0x08,0x41,0x81,0x82,0xFA,0xC1,0xB9,0xE0,0x58,0x00,0x08,0x00,0x08,0xA1,0xA1,0xA2,0xFA,0xC1,0xB9,0xE0,0x58,0x40,0x20,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xCF,0x7B,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0x7D,0xEF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x92,0x94,0x24,0x21,0x00,0x00,0xA2,0x18,0x54,0xA5,0x7D,0xEF,0xF7,0xBD,0xCF,0x7B,0x40,0x10,0x24,0x21,0x92,0x94,0x79,0xCE,0x79,0xCE,0xCF,0x7B,0xA2,0x18,
-	0x0C,0x63,0xFB,0xDE,0x79,0xCE,0xCF,0x7B,0x24,0x21,0x00,0x00,0x0C,0x63,0xFB,0xDE,0x79,0xCE,0x54,0xA5,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0xC1,0xB9,0x22,0xCA,0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x61,0x91,0x82,0xFA,0xE1,0xC1,0x00,0x69,0x60,0x28,
-	0x40,0x10,0x40,0x10,0x40,0x10,0x40,0x20,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xE0,0x58,0x41,0xE2,0x41,0xE2,0x00,0x69,0x60,0x28,0x00,0x00,0xE0,0x58,0x41,0xE2,0x22,0xCA,0x41,0x81,0x80,0x38,0x60,0x28,0xA1,0xA1,0xA2,0xFA,0x61,0x91,0x60,0x28,0x00,0x08,0x60,0x28,0xC1,0xB9,0x82,0xFA,
-	0xA1,0xA1,0xC0,0x48,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x54,0xA5,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x92,0x94,0x24,0x21,0x00,0x00,0xA2,0x18,0xF7,0xBD,0xFF,0xFF,0xF7,0xBD,0x0C,0x63,0x40,0x10,0xA2,0x18,0xCF,0x7B,
-	0xF7,0xBD,0x79,0xCE,0x92,0x94,0x24,0x21,0xCF,0x7B,0xDF,0xFF,0xF7,0xBD,0x69,0x4A,0x40,0x10,0x00,0x00,0x92,0x94,0xDF,0xFF,0x79,0xCE,0xCF,0x7B,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0x41,0xE2,0x41,0xE2,0xC0,0x48,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x61,0x91,
-	0xA2,0xFA,0xC1,0xB9,0x80,0x38,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x20,0x00,0x69,0x41,0xE2,0x41,0xE2,0xE0,0x58,0x40,0x10,0x00,0x00,0xC0,0x48,0x41,0xE2,0xE1,0xC1,0x61,0x91,0x00,0x69,0xE0,0x58,0xC1,0xB9,0x82,0xFA,0x00,0x69,0x00,0x08,
-	0x40,0x10,0xC0,0x48,0xE1,0xC1,0x82,0xFA,0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x69,0x4A,0x79,0xCE,0x7D,0xEF,0x79,0xCE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x7D,0xEF,0xDF,0xFF,0x54,0xA5,0x69,0x4A,0x40,0x10,0xA2,0x18,0xF7,0xBD,0xFF,0xFF,0x54,0xA5,
-	0x0C,0x63,0x40,0x10,0xA2,0x18,0xCF,0x7B,0xF7,0xBD,0x7D,0xEF,0xF7,0xBD,0x0C,0x63,0x92,0x94,0xDF,0xFF,0x54,0xA5,0x24,0x21,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0x79,0xCE,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0x41,0xE2,0x22,0xCA,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x80,0x38,0xA1,0xA1,0xA2,0xFA,0xA1,0xA1,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x00,0x69,0x82,0xFA,0x22,0xCA,0xC0,0x48,0x00,0x08,0x00,0x00,0xC0,0x48,0xE1,0xC1,0xE1,0xC1,0xA1,0xA1,0x61,0x91,0xA1,0xA1,
-	0xE1,0xC1,0xE1,0xC1,0xE0,0x58,0x00,0x00,0x00,0x08,0xC0,0x48,0xE1,0xC1,0x82,0xFA,0x41,0x81,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0xCF,0x7B,0x7D,0xEF,0x7D,0xEF,0x92,0x94,0x0C,0x63,0x69,0x4A,0xC7,0x39,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x0C,0x63,0x79,0xCE,0xFF,0xFF,0xF7,0xBD,0xCF,0x7B,0xA2,0x18,
-	0x24,0x21,0xF7,0xBD,0xDF,0xFF,0x54,0xA5,0x69,0x4A,0x40,0x10,0xA2,0x18,0x0C,0x63,0xF7,0xBD,0xDF,0xFF,0xFB,0xDE,0x54,0xA5,0xF7,0xBD,0xFB,0xDE,0x92,0x94,0x00,0x08,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0x79,0xCE,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0x61,0x91,0xE1,0xC1,0xA1,0xA1,0x60,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x80,0x38,0xA1,0xA1,0xA2,0xFA,0xA1,0xA1,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x41,0x81,0x82,0xFA,0xE1,0xC1,0xC0,0x48,0x00,0x00,0x00,0x00,0xC0,0x48,0xC1,0xB9,
-	0xE1,0xC1,0xC1,0xB9,0x22,0xCA,0x41,0xE2,0xE1,0xC1,0x61,0x91,0x80,0x38,0x00,0x00,0x00,0x08,0xC0,0x48,0xE1,0xC1,0x82,0xFA,0x41,0x81,0x40,0x20,0x00,0x08,0x00,0x00,0x00,0x00,0x40,0x10,0xC7,0x39,0x92,0x94,0xFF,0xFF,0xFB,0xDE,0x69,0x4A,0x24,0x21,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0xA2,0x18,0x24,0x21,0x54,0xA5,
-	0xFF,0xFF,0xF7,0xBD,0xCF,0x7B,0xC7,0x39,0xC7,0x39,0x79,0xCE,0xDF,0xFF,0x92,0x94,0xC7,0x39,0x00,0x08,0x40,0x10,0x69,0x4A,0x92,0x94,0xDF,0xFF,0xDF,0xFF,0xFB,0xDE,0x79,0xCE,0xF7,0xBD,0x0C,0x63,0x00,0x00,0x00,0x00,0xA2,0x18,0x92,0x94,0xFF,0xFF,0xF7,0xBD,0x0C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x40,0x10,0x41,0x81,0xC1,0xB9,
-	0xA1,0xA1,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0xC1,0xB9,0xA2,0xFA,0x61,0x91,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0x61,0x91,0x82,0xFA,0xE1,0xC1,0x60,0x28,
-	0x00,0x00,0x00,0x00,0x80,0x38,0x61,0x91,0xE1,0xC1,0x41,0xE2,0x41,0xE2,0x82,0xFA,0xC1,0xB9,0xE0,0x58,0x40,0x20,0x00,0x00,0x40,0x20,0xE0,0x58,0x41,0xE2,0x82,0xFA,0x00,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0xCF,0x7B,0xF7,0xBD,0xFF,0xFF,0xF7,0xBD,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xF7,0xBD,0xCF,0x7B,0x69,0x4A,0x69,0x4A,0xFB,0xDE,0x7D,0xEF,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0xCF,0x7B,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xCF,0x7B,0xC7,0x39,0x00,0x00,0x00,0x00,0xC7,0x39,0x54,0xA5,0xFF,0xFF,0xF7,0xBD,0x0C,0x63,0xA2,0x18,0x00,0x00,
-	0x00,0x00,0x40,0x20,0xA1,0xA1,0x41,0xE2,0x41,0x81,0x80,0x38,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x00,0x69,0xE1,0xC1,0xA2,0xFA,0x61,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0xE0,0x58,
-	0xA1,0xA1,0x82,0xFA,0xE1,0xC1,0x40,0x20,0x00,0x00,0x00,0x00,0x60,0x28,0x00,0x69,0xC1,0xB9,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0x61,0x91,0x40,0x20,0x00,0x00,0x00,0x00,0x80,0x38,0x41,0x81,0x41,0xE2,0x41,0xE2,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x54,0xA5,0xFB,0xDE,0xFB,0xDE,0x92,0x94,0xA2,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0xFF,0xFF,0xFB,0xDE,0x92,0x94,0x69,0x4A,0x0C,0x63,0xFB,0xDE,0x7D,0xEF,0xCF,0x7B,0x24,0x21,0x00,0x00,0x00,0x00,0xA2,0x18,0x0C,0x63,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xC7,0x39,0xA2,0x18,0x00,0x00,0x40,0x10,0xC7,0x39,0x54,0xA5,0xFF,0xFF,
-	0x54,0xA5,0x69,0x4A,0xA2,0x18,0x00,0x00,0x00,0x08,0x80,0x38,0xE1,0xC1,0x41,0xE2,0x00,0x69,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x41,0x81,0xE1,0xC1,0xA2,0xFA,0x61,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x10,0xE0,0x58,0xC1,0xB9,0xA2,0xFA,0xE1,0xC1,0x40,0x20,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0xC1,0xB9,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0x00,0x69,0x00,0x08,0x00,0x00,0x00,0x00,0x80,0x38,0x41,0x81,0x41,0xE2,0x41,0xE2,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x79,0xCE,0x7D,0xEF,
-	0x54,0xA5,0x0C,0x63,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x94,0x7D,0xEF,0xFB,0xDE,0xF7,0xBD,0x0C,0x63,0x0C,0x63,0xFB,0xDE,0x7D,0xEF,0xCF,0x7B,0x24,0x21,0x00,0x08,0x00,0x00,0x40,0x10,0x0C,0x63,0x7D,0xEF,0xFF,0xFF,0xDF,0xFF,0x54,0xA5,0xA2,0x18,0x00,0x00,0x00,0x00,
-	0xA2,0x18,0x69,0x4A,0xF7,0xBD,0xFF,0xFF,0x54,0xA5,0xC7,0x39,0x40,0x10,0x00,0x00,0x40,0x20,0xE0,0x58,0x41,0xE2,0x41,0xE2,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x41,0x81,0xE1,0xC1,0x82,0xFA,0x41,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x00,0x69,0xC1,0xB9,0x82,0xFA,0xC1,0xB9,0x40,0x20,0x00,0x00,0x00,0x00,0x40,0x20,0xC0,0x48,0xA1,0xA1,0x82,0xFA,0x82,0xFA,0xE1,0xC1,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x08,0xC0,0x48,0x61,0x91,0x41,0xE2,0x41,0xE2,0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x21,0x0C,0x63,0xDF,0xFF,0xDF,0xFF,0x92,0x94,0xC7,0x39,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0xFB,0xDE,0x7D,0xEF,0x79,0xCE,0x92,0x94,0x92,0x94,0xDF,0xFF,0xDF,0xFF,0x0C,0x63,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xDF,0xFF,0xFF,0xFF,0xFB,0xDE,
-	0xCF,0x7B,0x40,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0xFB,0xDE,0xFF,0xFF,0x92,0x94,0x24,0x21,0x00,0x00,0x00,0x00,0x80,0x38,0x41,0x81,0xE1,0xC1,0xA1,0xA1,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0xA1,0xA1,0x41,0xE2,0x41,0xE2,0x41,0x81,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x61,0x91,0x22,0xCA,0x41,0xE2,0xA1,0xA1,0x40,0x20,0x00,0x00,0x00,0x00,0x40,0x10,0x80,0x38,0xA1,0xA1,0xA2,0xFA,0x41,0xE2,0x41,0x81,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x08,0xE0,0x58,0xC1,0xB9,0x82,0xFA,0x41,0xE2,
-	0xC0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xCF,0x7B,0xFB,0xDE,0x79,0xCE,0x0C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x54,0xA5,0xF7,0xBD,0xF7,0xBD,0x92,0x94,0xCF,0x7B,0xFB,0xDE,0x79,0xCE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x69,0x4A,0x79,0xCE,0xFB,0xDE,0x92,0x94,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0xF7,0xBD,0x7D,0xEF,0xCF,0x7B,0xA2,0x18,0x00,0x00,0x00,0x08,0x00,0x69,0xA1,0xA1,0xA1,0xA1,0x00,0x69,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x38,0xA1,0xA1,0xE1,0xC1,
-	0xA1,0xA1,0xE0,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x61,0x91,0xC1,0xB9,0xC1,0xB9,0x41,0x81,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x41,0x81,0x41,0xE2,0xA1,0xA1,0xC0,0x48,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x08,
-	0xE0,0x58,0xA1,0xA1,0x22,0xCA,0xC1,0xB9,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x24,0x21,0x69,0x4A,0x69,0x4A,0xA2,0x18,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xC7,0x39,0xC7,0x39,0xC7,0x39,0x24,0x21,0x24,0x21,0x69,0x4A,0x69,0x4A,0xA2,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x18,0x69,0x4A,0x69,0x4A,0xC7,0x39,0xA2,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x10,0x24,0x21,0xC7,0x39,0x69,0x4A,0x24,0x21,0x00,0x08,0x00,0x00,0x40,0x10,0x61,0x91,0x41,0xE2,0x61,0x91,0xC0,0x48,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x40,0x10,0x80,0x38,0x80,0x38,0x80,0x38,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0x80,0x38,0x80,0x38,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0xC0,0x48,0x80,0x38,0x40,0x10,
-	0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x80,0x38,0xC0,0x48,0x80,0x38,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x60,0x28,0xC1,0xB9,0x41,0xE2,0x41,0x81,0x60,0x28,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0xE0,0x58,0xE1,0xC1,0x41,0xE2,0xC0,0x48,0x00,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x28,0x00,0x69,
-	0x22,0xCA,0x41,0xE2,0x80,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_2_53268_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 100,
-    .header.h = 38,
-    .data_size = sizeof(face_756_2_466_dial_img_2_53268_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_2_53268_data_1};
-
-    
\ No newline at end of file
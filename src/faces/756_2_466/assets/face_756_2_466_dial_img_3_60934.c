@@ -1,697 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 756_2_466
-
-#include "../756_2_466.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_3_60934_data_0[] = {
-	//RGB565 data 
-	0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,
-	0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,
-	0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,
-	0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_3_60934_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 66,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_3_60934_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_3_60934_data_0};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_3_60934_data_1[] = {
-	//RGB565 data 
-	0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,
-	0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,
-	0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,
-	0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,
-	0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_3_60934_1 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 66,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_3_60934_data_1),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_3_60934_data_1};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_3_60934_data_2[] = {
-	//RGB565 data 
-	0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,
-	0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,
-	0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,
-	0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,
-	0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,
-	0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,
-	0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_3_60934_2 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 66,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_3_60934_data_2),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_3_60934_data_2};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_3_60934_data_3[] = {
-	//RGB565 data 
-	0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,
-	0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,
-	0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,
-	0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,
-	0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,
-	0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,
-	0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,
-	0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,
-	0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_3_60934_3 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 66,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_3_60934_data_3),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_3_60934_data_3};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_3_60934_data_4[] = {
-	//RGB565 data 
-	0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,
-	0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,
-	0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,
-	0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,
-	0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,
-	0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,
-	0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,
-	0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,
-	0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,
-	0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,
-	0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_3_60934_4 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 66,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_3_60934_data_4),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_3_60934_data_4};
-
-    
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_756_2_466_dial_img_3_60934_data_5[] = {
-	//RGB565 data 
-	0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,
-	0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,
-	0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,
-	0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,
-	0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,
-	0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,
-	0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,
-	0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,
-	0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,
-	0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,
-	0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,
-	0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,
-	0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,
-	0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,
-	0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,
-	0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,
-	0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x82,0xFA,0xA2,0xFA,
-	0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x82,0xFA,
-	0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA0,0x48,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x20,0x10,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xC1,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0x41,0xE2,
-	0x41,0xE2,0x41,0xE2,0x41,0xE2,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x10,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x20,0x10,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0xA0,0x48,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,
-	0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0x20,0x10,0xA0,0x48,0xA0,0x48,0xC1,0xA9,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,
-	0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0xC1,0xA9,0x41,0xE2,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0x41,0xE2,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,
-	0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0xA2,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0x48,0xC1,0xA9,0x41,0xE2,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xC1,0xA9,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0xA0,0x48,0xC1,0xA9,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,
-	0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x82,0xFA,0x41,0xE2,0xA0,0x48,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-    };
-        
-
-
-const lv_img_dsc_t face_756_2_466_dial_img_3_60934_5 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 66,
-    .header.h = 31,
-    .data_size = sizeof(face_756_2_466_dial_img_3_60934_data_5),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_756_2_466_dial_img_3_60934_data_5};
-
-    
\ No newline at end of file
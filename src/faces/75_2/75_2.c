@@ -106,9 +106,10 @@ void init_face_75_2(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_add_flag(face_75_2_35_138999, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_75_2_35_138999, LV_OBJ_FLAG_SCROLLABLE );
 	lv_image_set_pivot(face_75_2_35_138999, 5, 108);
+	face_compositor_static(face_75_2_0_1024);
 
 
-    callback("Analog", &face_75_2_dial_img_preview_0, &face_75_2, &face_75_2_35_138999);
+    callback("Analog", NULL, &face_75_2, &face_75_2_35_138999);
 
 #endif
 }
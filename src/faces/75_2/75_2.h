@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_75_2 // (Analog) uncomment to enable or define it elsewhere
 
@@ -44,8 +45,6 @@ extern "C"
 	LV_IMG_DECLARE(face_75_2_dial_img_3_59132_0);
 	LV_IMG_DECLARE(face_75_2_dial_img_19_89191_0);
 	LV_IMG_DECLARE(face_75_2_dial_img_35_138999_0);
-	LV_IMG_DECLARE(face_75_2_dial_img_preview_0);
-	LV_IMG_DECLARE(face_75_2_dial_img_preview_0);
 
 
 #endif
@@ -5,6 +5,7 @@
 // Watchface: 75_2
 
 #include "../75_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,1813 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_0_1024_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x92,0x61,0xD4,0x71,0x87,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x59,0x79,0x8A,0xBB,0x92,0xBB,0x92,0xD6,0x79,0x87,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x28,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0x8A,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0x0C,0x41,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x38,0x37,0x82,
-	0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0xD6,0x79,0x1F,0xB3,0xFE,0xAA,0x91,0x59,0x0C,0x41,0xEC,0x40,0xBB,0x92,0x1F,0xB3,0xFE,0xAA,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x71,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x44,0x18,0x1F,0xB3,0x1F,0xB3,0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0x1F,0xB3,0x1F,0xB3,
-	0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x71,0x79,0x8A,
-	0x0C,0x41,0xEC,0x40,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xB3,0x1F,0xB3,0xD4,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x0C,0x41,0xD4,0x71,0xD4,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0x1F,0xB3,0x1F,0xB3,
-	0x2E,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x82,0x1F,0xB3,0xFE,0xAA,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0x37,0x82,0x1F,0xB3,0x1F,0xB3,0x91,0x59,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x38,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0xCA,0x38,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x82,0x1F,0xB3,0x1F,0xB3,0xD6,0x79,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0xD4,0x71,0x1F,0xB3,0x1F,0xB3,0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x44,0x18,0xFE,0xAA,0x1F,0xB3,0x79,0x8A,0x0C,0x41,0x0C,0x41,0x0C,0x41,0x0C,0x41,0x0C,0x41,0x0C,0x41,0x87,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x91,0x59,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,
-	0xD4,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xCA,0x38,0xBB,0x92,0xBB,0x92,0xCA,0x38,0x00,0x00,0x91,0x59,0x39,0x9A,0xBB,0x92,0xBB,0x92,0x39,0x9A,0xBB,0x92,0xBB,0x92,0x39,0x9A,0xBB,0x92,0xBB,0x92,0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,
-	0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,
-	0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,
-	0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x0C,0x63,
-	0x0C,0x63,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x42,0x08,0x42,0x08,0x62,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x21,0x00,0x42,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,
-	0x43,0x08,0x42,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x42,0x08,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x63,0x10,0x63,0x10,0x64,0x10,0x64,0x10,0x43,0x10,0x43,0x08,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x43,0x08,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x83,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x83,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x22,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x22,0x10,0x21,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,
-	0x83,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x00,0xA4,0x08,0xA3,0x00,0xA3,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x44,0x18,0x43,0x10,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xA3,0x00,0xA4,0x08,0xA3,0x00,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x44,0x18,0x22,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0xA4,0x08,0xA3,0x00,0x83,0x08,0xA3,0x00,0x83,0x08,0xA3,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x23,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x00,0xA3,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,
-	0x82,0x00,0x82,0x00,0x82,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x23,0x10,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC4,0x00,0xC4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x83,0x08,0x83,0x08,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x62,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x44,0x18,0x23,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x00,0x61,0x00,0x61,0x00,0x61,0x00,0xC4,0x00,0x26,0x09,0x26,0x09,0x05,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x05,0x09,0x05,0x09,0x05,0x09,0xC4,0x08,0xC4,0x08,0xA4,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x08,0x43,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x43,0x10,0x43,0x10,0x64,0x10,0x64,0x10,0x85,0x10,0x85,0x10,0x85,0x18,0x85,0x18,0x85,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0xA6,0x20,0xA7,0x20,0x85,0x18,0x42,0x08,0x42,0x08,0x42,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x00,0x61,0x00,
-	0x82,0x00,0xA3,0x00,0xA3,0x00,0xC4,0x00,0xA3,0x00,0xA3,0x00,0x05,0x09,0x47,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xC5,0x10,0xC4,0x08,0xA4,0x08,0x83,0x08,0x63,0x08,0x62,0x08,
-	0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x42,0x08,0x42,0x08,0x43,0x08,0x43,0x10,0x64,0x10,0x85,0x10,0x85,0x10,0x85,0x18,0xA6,0x18,0xA7,0x20,0xC7,0x18,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,
-	0xA6,0x20,0xA6,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,0xA7,0x20,0x64,0x10,0x63,0x08,0x64,0x10,0x63,0x10,0x63,0x10,0x42,0x08,0x42,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x00,0x82,0x00,0xA3,0x00,0xC4,0x00,0xC4,0x00,0xC4,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x82,0x00,0xC4,0x08,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xC5,0x10,0x85,0x10,0x83,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x42,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x42,0x08,0x42,0x08,0x63,0x10,0x64,0x10,
-	0x85,0x10,0x85,0x18,0xA6,0x18,0xC7,0x18,0xC7,0x18,0xC7,0x18,0xC7,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0xA7,0x20,0x66,0x20,0x63,0x10,0x42,0x08,0x43,0x08,0x63,0x10,0x63,0x10,
-	0x64,0x10,0x64,0x10,0x63,0x10,0x43,0x08,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x00,0xA2,0x00,0xA3,0x00,0xC4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0xA3,0x00,0x82,0x00,0x82,0x00,0x25,0x01,0x47,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xC5,0x10,0x85,0x10,0x63,0x10,0x63,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x43,0x08,0x63,0x10,0x85,0x10,0x85,0x10,0xA6,0x18,0xC7,0x18,0xC7,0x18,0xC7,0x18,0xC7,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0xA7,0x20,0x86,0x20,0x63,0x10,0x42,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x63,0x10,0x64,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xA2,0x00,0xA3,0x00,0xC4,0x00,0xC4,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x82,0x00,0x25,0x01,0x47,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0x63,0x10,0x64,0x10,0x64,0x10,0x63,0x10,0x85,0x10,0xA6,0x18,0xC7,0x18,0xC7,0x18,0xC7,0x18,0xA6,0x18,
-	0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,0x86,0x20,0x64,0x10,0x42,0x08,0x43,0x08,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x64,0x10,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xA3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0xA3,0x00,0x82,0x00,0x26,0x09,0x47,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0xC7,0x18,0x08,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0xC7,0x20,0xA6,0x18,0xC5,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,0x66,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x00,0xA3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x25,0x01,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x27,0x19,0x08,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x29,0x21,0x2A,0x31,0x29,0x21,0xC7,0x20,0xC7,0x18,0xA6,0x18,0xA6,0x18,
-	0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,0x86,0x20,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,
-	0xC4,0x00,0x46,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,
-	0xE6,0x10,0x27,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x08,0x21,0xC7,0x18,0xA6,0x18,0xC5,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,0x66,0x20,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0xC4,0x00,0x46,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x08,0x21,0x29,0x21,0x69,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,
-	0x08,0x21,0xC7,0x18,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,
-	0x85,0x18,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0xA3,0x00,0x26,0x09,
-	0x66,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x27,0x19,0x29,0x21,0x49,0x19,
-	0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x08,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x08,0x21,0xC7,0x18,0x85,0x18,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,0x44,0x18,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x64,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xA3,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0xA3,0x00,0x45,0x01,0x46,0x09,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xC5,0x10,0xC5,0x10,0x27,0x19,0x27,0x19,0x49,0x19,0x69,0x21,0x49,0x19,0x29,0x21,0x29,0x21,0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x08,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,
-	0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x08,0x21,0xC7,0x20,0xA6,0x18,0x85,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x87,0x28,0x64,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x45,0x01,0x66,0x01,0x45,0x01,
-	0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xC5,0x10,0x05,0x09,0x06,0x11,0x49,0x19,0x69,0x21,0x69,0x21,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,
-	0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0xC7,0x20,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,0x87,0x28,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xC4,0x00,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x05,0x09,0x06,0x11,0x27,0x19,0x69,0x21,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x29,0x21,0x49,0x19,0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x09,0x29,
-	0x09,0x29,0xE9,0x28,0x09,0x29,0xE9,0x28,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0xC7,0x20,0x85,0x18,0x85,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x87,0x28,0x66,0x20,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xA3,0x00,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,
-	0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x05,0x09,0x06,0x11,0x27,0x19,0x49,0x19,0x69,0x21,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x29,0x21,
-	0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x08,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0x09,0x29,0xE9,0x28,0xE9,0x28,0x09,0x29,0x09,0x29,0xE9,0x28,0xA7,0x20,0x85,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x67,0x28,0x44,0x18,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x25,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x05,0x09,0x05,0x09,0x06,0x11,0x49,0x19,0x69,0x21,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x08,0x21,0x49,0x19,0x08,0x21,0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x08,0x21,0x08,0x21,0x08,0x21,
-	0x08,0x21,0x08,0x21,0x08,0x21,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0x09,0x29,0x09,0x29,0xC7,0x20,0x85,0x18,0x85,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x87,0x28,0x66,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xC4,0x00,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,
-	0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x05,0x09,0x27,0x19,0x49,0x19,0x68,0x11,0x49,0x19,0x68,0x11,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x69,0x21,0x69,0x21,0x69,0x21,0x69,0x21,0x69,0x21,
-	0xAB,0x21,0x6B,0x29,0xAB,0x21,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x2A,0x31,0x2A,0x31,0x2A,0x31,0x2A,0x31,0x2A,0x31,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0x09,0x29,0xE9,0x28,0xE9,0x28,0xE9,0x28,0x09,0x29,0x87,0x28,0xA7,0x20,0x85,0x18,
-	0x85,0x18,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x86,0x20,0x67,0x28,0x66,0x20,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xA3,0x00,0x66,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0xC4,0x08,0x05,0x09,
-	0x06,0x11,0x68,0x11,0x69,0x21,0x69,0x21,0x69,0x21,0x69,0x21,0x69,0x21,0xAB,0x21,0xAB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,
-	0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x31,0x2B,0x31,0x2A,0x31,0x2A,0x31,0xCA,0x38,0x2A,0x31,0x09,0x29,0xE9,0x28,0xA6,0x20,0x85,0x18,0x85,0x18,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x44,0x18,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x45,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,
-	0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x05,0x09,0x05,0x09,0x05,0x09,0x06,0x09,0x26,0x09,0x68,0x11,0xCB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0x0C,0x22,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0xE9,0x28,0xA7,0x20,0x85,0x18,0xA6,0x20,0x85,0x18,0x85,0x18,0x85,0x18,0x66,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x87,0x28,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0xE3,0x00,0x66,0x01,0x45,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x05,0x09,0x05,0x09,0x46,0x09,0x47,0x09,0x67,0x09,0x67,0x09,0x67,0x09,0xA9,0x19,0x0C,0x22,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,
-	0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x41,0x0C,0x41,0x0C,0x39,0xE9,0x28,0x87,0x28,0x87,0x28,0x87,0x28,0xA7,0x20,0x85,0x18,0x85,0x18,0x85,0x18,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x87,0x28,0x66,0x20,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xA3,0x00,0x66,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,
-	0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x46,0x09,0x47,0x09,0x67,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0xCB,0x19,0xEB,0x19,0xCB,0x21,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x41,0x0C,0x39,0xCA,0x38,0xE9,0x28,0x09,0x29,0xA9,0x30,0xE9,0x28,0x87,0x28,0x87,0x28,0x86,0x20,0x66,0x20,0x66,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x44,0x18,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x25,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x46,0x09,0x47,0x09,0xA8,0x09,0xA8,0x09,0xC9,0x09,0xC9,0x09,0x88,0x11,0x67,0x09,0xA9,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,
-	0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x41,0x0C,0x41,0xCA,0x38,0xE9,0x28,0xE9,0x28,0xA9,0x30,0xCA,0x38,0x09,0x29,0xA9,0x30,0xE9,0x28,0x87,0x28,0x86,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x87,0x28,0x66,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xC3,0x00,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x46,0x09,
-	0x47,0x09,0xA8,0x09,0x88,0x11,0xC9,0x09,0xC9,0x09,0xA8,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0xA9,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x41,0xCB,0x40,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xA9,0x30,0xCA,0x38,0xA9,0x30,0xCA,0x38,0xA9,0x30,0x87,0x28,0x87,0x28,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x65,0x20,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x25,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x66,0x01,0x67,0x09,0xA8,0x01,0xC8,0x09,0xC9,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0x88,0x11,0x67,0x09,0x88,0x11,0xEB,0x19,0xEB,0x19,0x0C,0x22,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,
-	0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xCA,0x38,0xE9,0x28,0xA9,0x30,0xE9,0x28,0xA9,0x30,0xE9,0x28,0xA9,0x30,0xCA,0x38,
-	0xCA,0x38,0xA9,0x30,0x87,0x28,0x87,0x28,0x87,0x28,0x65,0x20,0x66,0x20,0x66,0x20,0x87,0x28,0x87,0x28,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xC4,0x00,0x66,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x66,0x01,0xA8,0x01,0xE9,0x09,0xC9,0x09,0xC9,0x09,0xC8,0x09,
-	0xC8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0xEB,0x19,0x0C,0x22,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCA,0x38,0xE9,0x28,0xA9,0x30,0xE9,0x28,0xA9,0x30,0xE9,0x28,0xA9,0x30,0xA9,0x30,0xCA,0x38,0xCA,0x38,0xCA,0x38,0xA9,0x30,0x87,0x28,0x87,0x28,0x66,0x20,0x66,0x20,0x67,0x28,0x65,0x20,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x25,0x01,0x66,0x01,0x66,0x01,0x87,0x01,0xC8,0x09,0xE9,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xC8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA9,0x19,0x0C,0x22,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,
-	0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x40,0xA9,0x30,0xE9,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,
-	0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xCA,0x38,0xA9,0x30,0x68,0x30,0x87,0x28,0x66,0x20,0x66,0x20,0x43,0x10,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,
-	0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xA3,0x00,0x66,0x01,0xA8,0x01,0xC8,0x09,0xE9,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xC8,0x09,
-	0xC8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA9,0x19,0x0C,0x22,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xA9,0x30,0xE9,0x28,0xE9,0x28,0xA9,0x30,0xE9,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xCA,0x38,0xCA,0x38,0xA9,0x30,0x68,0x30,0x44,0x18,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x22,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xA2,0x00,0xA2,0x00,0xA3,0x00,0x66,0x01,0x09,0x02,0xE9,0x09,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x0B,0x12,0xEB,0x19,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x29,0x6B,0x31,0x2B,0x31,
-	0x6B,0x31,0x4C,0x31,0x2B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCA,0x38,0x68,0x30,0xA9,0x30,
-	0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xCA,0x38,0xA9,0x30,0x44,0x18,0x42,0x08,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x64,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0xC3,0x00,0x25,0x01,0x66,0x01,0x09,0x02,0x09,0x02,0xE8,0x01,0xC8,0x09,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xC8,0x09,
-	0xA8,0x09,0xA8,0x09,0x0B,0x12,0x0C,0x22,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,
-	0x8B,0x29,0xAB,0x29,0xCD,0x29,0xAE,0x39,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0x4C,0x31,0x4C,0x31,0x6B,0x31,0x2B,0x31,0x2B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCA,0x38,0xE9,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x6A,0x40,0x68,0x30,0x85,0x18,0x64,0x10,0x43,0x08,
-	0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0xC3,0x00,
-	0x25,0x01,0x66,0x01,0x45,0x01,0xA8,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xC8,0x09,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xC8,0x09,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x21,0xAB,0x21,0x8B,0x29,0xCD,0x29,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xAE,0x39,0x8E,0x41,0x8E,0x41,
-	0x8E,0x41,0x8E,0x41,0x4C,0x31,0x2B,0x31,0x2B,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCA,0x38,
-	0xE9,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x87,0x28,0x86,0x20,0x66,0x20,0x44,0x18,0x43,0x08,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0xC3,0x00,0x25,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xC8,0x09,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xC9,0x09,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x21,0xAB,0x29,0xCD,0x29,0xED,0x31,0xED,0x31,0xED,0x31,
-	0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0x8E,0x41,0xAE,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x4C,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xE9,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xCA,0x38,0x87,0x28,0x66,0x20,0x87,0x28,
-	0x87,0x28,0x66,0x20,0x64,0x10,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0xE3,0x00,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x45,0x01,0x87,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x09,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xC9,0x09,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xAE,0x39,0x8E,0x41,0x8E,0x41,
-	0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,
-	0xCC,0x48,0xCB,0x40,0x68,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x69,0x38,0xA9,0x30,0x86,0x20,0x86,0x20,0x86,0x20,0x87,0x28,0x87,0x28,0x65,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0xC3,0x00,0x45,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0xE8,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xC9,0x09,0x0B,0x1A,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xCB,0x21,0xCD,0x29,0x2E,0x2A,0x2E,0x2A,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,
-	0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xAE,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x0C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x6A,0x40,0x87,0x28,0x66,0x20,
-	0x86,0x20,0x66,0x20,0x87,0x28,0x87,0x28,0x66,0x20,0x44,0x18,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0xE3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x45,0x01,0x87,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x09,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xC9,0x09,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCB,0x21,0x2E,0x2A,0x2E,0x2A,0xED,0x31,0xCD,0x29,0xED,0x31,0xCD,0x29,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xAE,0x39,
-	0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x0C,0x41,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x69,0x38,0x68,0x30,0x66,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x87,0x28,0x67,0x28,0x65,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0xC3,0x00,0x25,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x25,0x01,0xE8,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x09,0xE8,0x01,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xC9,0x09,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x19,0xCB,0x21,0xCB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCD,0x29,0x2E,0x2A,0x2E,0x2A,0x2E,0x2A,0x2E,0x2A,0x2E,0x2A,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,
-	0xED,0x31,0xED,0x31,0xAE,0x39,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xAE,0x39,0x8E,0x41,0xAE,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x2E,0x49,0x8E,0x41,0x2E,0x49,0x8E,0x41,0x0C,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,
-	0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xCA,0x38,0x87,0x28,
-	0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x66,0x20,0x64,0x10,0x42,0x08,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0x25,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,
-	0x87,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x09,0xE8,0x01,0xA8,0x01,0xC9,0x09,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xCB,0x19,0xCB,0x21,
-	0x0C,0x22,0x0C,0x22,0x4D,0x22,0xCD,0x29,0x2E,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x2E,0x49,0x8E,0x41,0x2E,0x49,0x0C,0x41,0x0C,0x41,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,
-	0xCC,0x48,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x6A,0x40,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x87,0x28,0x67,0x28,0x66,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA3,0x00,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xA8,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x09,0xA8,0x01,0xE9,0x09,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xCB,0x19,0xEB,0x19,0x0C,0x22,0x4D,0x22,0x4D,0x22,0x2E,0x2A,0x2E,0x2A,0x2E,0x2A,0x4D,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,
-	0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x2E,0x49,0x8E,0x41,0x2E,0x49,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x0C,0x41,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x69,0x38,0xA9,0x30,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x66,0x28,0x64,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,
-	0xE8,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xA8,0x01,0xE9,0x09,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xEB,0x19,0x0C,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,
-	0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xAE,0x39,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x4F,0x3A,0xD0,0x49,0xD0,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x2E,0x49,0x2E,0x49,0x8E,0x41,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0C,0x41,0xEC,0x40,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x67,0x28,0x44,0x18,0x42,0x08,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,
-	0xA3,0x00,0xA2,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xA8,0x01,0xE9,0x09,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0x0C,0x22,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x2E,0x2A,0x0C,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,
-	0x4F,0x3A,0x4F,0x3A,0xD0,0x49,0x4F,0x3A,0x4F,0x3A,0xD0,0x49,0x31,0x4A,0x31,0x4A,0x53,0x52,0x31,0x4A,0x31,0x4A,0x4F,0x3A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x2E,0x49,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0C,0x39,0xCB,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x50,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x6A,0x40,
-	0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x87,0x28,0x66,0x28,0x65,0x20,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0xE3,0x00,0x86,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x25,0x01,0x87,0x01,
-	0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE9,0x09,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xCB,0x19,0xEB,0x19,0x4D,0x22,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,
-	0x4D,0x22,0x2E,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0C,0x41,0xEC,0x40,0xCB,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x6A,0x40,0x68,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x69,0x38,0xA9,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x87,0x28,0x67,0x28,0x65,0x20,0x43,0x08,
-	0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,
-	0x25,0x01,0x86,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xE8,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0x0B,0x12,0x0C,0x22,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x2E,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,
-	0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x90,0x51,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0xEC,0x40,0xCB,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCA,0x38,0x68,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,
-	0x69,0x38,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x66,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x64,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x86,0x01,0x09,0x02,
-	0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0x0B,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,
-	0x6F,0x32,0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0xD0,0x49,0x31,0x4A,0x31,0x4A,0x31,0x4A,
-	0x31,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0C,0x41,0xCB,0x40,0xCB,0x40,0xEC,0x40,0xCC,0x48,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x8C,0x50,0xCA,0x38,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xCA,0x38,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,
-	0x67,0x28,0x64,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0x25,0x01,0x87,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x87,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x2B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x12,0x0B,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,
-	0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x53,0x52,0x53,0x52,0x53,0x52,0x53,0x52,0x53,0x52,0x53,0x52,0x53,0x52,0x53,0x52,0x31,0x4A,0x31,0x4A,0xD0,0x49,0x90,0x51,0x31,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x91,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0xED,0x48,0xCB,0x40,0xCC,0x48,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x50,0xAC,0x50,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,
-	0x69,0x38,0xA9,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x66,0x28,0x43,0x10,0x42,0x08,0x64,0x10,0x22,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xE8,0x01,0x09,0x02,
-	0xE8,0x01,0xE8,0x01,0xE8,0x01,0x0A,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x12,0x0B,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x2E,0x2A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xF3,0x3A,0xF3,0x3A,0xF4,0x4A,0xF5,0x5A,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x55,0x6A,0x55,0x6A,
-	0x53,0x52,0x53,0x52,0x91,0x59,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xED,0x48,0xCB,0x40,0xEC,0x40,
-	0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x50,0xAC,0x48,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x69,0x38,0x69,0x38,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x67,0x28,0x67,0x28,0x43,0x10,0x43,0x08,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x09,0x02,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x2E,0x2A,0x4F,0x3A,0xF3,0x3A,0xF4,0x4A,0x96,0x4B,0x77,0x5B,0xB9,0x63,
-	0xB9,0x63,0xB9,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x39,0x73,0x39,0x73,0x39,0x73,0xF9,0x7A,0xD8,0x72,0x18,0x73,0x55,0x6A,0x53,0x52,0x91,0x59,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x90,0x51,0x91,0x59,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEC,0x40,0xCB,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0xAB,0x48,0xA9,0x30,0xA9,0x30,
-	0xA9,0x30,0x6A,0x40,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x66,0x28,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x25,0x01,0x87,0x01,0x09,0x02,0xE8,0x01,
-	0xE8,0x01,0x09,0x02,0x6B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,0x0B,0x12,0x0C,0x22,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x6F,0x32,0xCF,0x22,0x6F,0x32,
-	0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x6F,0x32,0xF3,0x3A,0x96,0x4B,0xB7,0x53,0xB9,0x63,0xB9,0x63,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,
-	0x18,0x73,0xD8,0x72,0xF9,0x7A,0xF9,0x7A,0xF9,0x7A,0x97,0x7A,0x55,0x6A,0x91,0x59,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x30,0x59,0x90,0x51,0x90,0x51,0x30,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xCB,0x40,
-	0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0x8B,0x48,0x68,0x30,0xA9,0x30,0xCA,0x38,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x20,0x67,0x28,0x67,0x28,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x00,0x87,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xA8,0x01,0x09,0x02,0xE8,0x01,0xE8,0x01,0x6B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x12,
-	0x2B,0x12,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6D,0x1A,0xCF,0x22,0x6F,0x32,0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0xF1,0x2A,0x6F,0x32,0xF1,0x2A,0xF3,0x3A,0x96,0x4B,0xD8,0x53,0xB9,0x63,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xF9,0x7A,0xF9,0x7A,0xF9,0x7A,0x97,0x7A,0x55,0x6A,0x92,0x61,0xD0,0x49,0x91,0x59,0x91,0x59,0x91,0x59,0x90,0x51,0x90,0x51,
-	0x90,0x51,0x90,0x51,0x91,0x59,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0x6A,0x40,
-	0xA9,0x30,0x69,0x38,0x69,0x38,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x87,0x28,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x86,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,
-	0x4A,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x12,0x0B,0x1A,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0xCF,0x22,0x6F,0x32,0xCF,0x22,0x6F,0x32,
-	0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xF3,0x3A,0x96,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,
-	0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x82,0xB9,0x8A,0x98,0x7A,0x55,0x6A,0x91,0x59,0x91,0x59,0x92,0x61,0x92,0x61,0x91,0x59,0x91,0x59,0x30,0x59,0x90,0x51,0x30,0x59,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,
-	0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0x69,0x38,0xA9,0x30,0x6A,0x40,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x00,0x86,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0x09,0x02,0xE8,0x01,0x09,0x02,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,
-	0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6D,0x1A,0xCF,0x22,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xF1,0x2A,0x96,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x82,0xB9,0x8A,0x97,0x7A,0x92,0x61,0xD0,0x49,0x92,0x61,0x92,0x61,
-	0x92,0x61,0x92,0x61,0x91,0x59,0x91,0x59,0x30,0x59,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,
-	0xAB,0x48,0xA9,0x30,0x69,0x38,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x28,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xE3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x87,0x01,0xE8,0x01,0x09,0x02,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,
-	0xF1,0x2A,0x6F,0x32,0xF1,0x2A,0x96,0x4B,0xD8,0x53,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,
-	0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0xB9,0x8A,0x98,0x82,0xD4,0x71,0x90,0x51,0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x30,0x59,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,
-	0x0E,0x51,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0xAC,0x50,0x8B,0x48,0xA9,0x30,0xA9,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x25,0x01,0xA8,0x01,0x09,0x02,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,
-	0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x6D,0x1A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xF3,0x3A,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x18,0x73,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x98,0x82,0x79,0x8A,0x55,0x6A,0x91,0x59,
-	0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x90,0x51,0x0E,0x51,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x6A,0x40,0x68,0x30,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x20,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xE3,0x00,0xA2,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xA8,0x01,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x1A,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xCF,0x22,0xCF,0x22,0xF1,0x2A,0x31,0x23,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,
-	0x73,0x2B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,
-	0xD8,0x72,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x79,0x8A,0x37,0x82,0x91,0x59,0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x91,0x59,0x30,0x59,0x30,0x59,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,
-	0x0E,0x51,0xEE,0x58,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x20,0x03,0x10,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0x09,0x02,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x8C,0x12,0xAD,0x1A,0x6D,0x1A,
-	0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xCF,0x22,0xF0,0x22,0xCF,0x22,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xD5,0x33,0xF7,0x4B,0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x79,0x8A,
-	0x37,0x82,0x92,0x61,0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x90,0x51,0x30,0x59,0x30,0x59,0x0E,0x51,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x50,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x20,0x03,0x10,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x25,0x01,0xA8,0x01,0x8C,0x12,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xCF,0x22,0xF0,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF1,0x2A,0x31,0x23,0xF1,0x2A,0xF0,0x22,0xF1,0x2A,0x17,0x44,0x17,0x44,
-	0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,
-	0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x79,0x8A,0x58,0x8A,0x92,0x61,0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x91,0x59,0x90,0x51,0x91,0x59,0x91,0x59,0x30,0x59,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,
-	0x0E,0x51,0x0E,0x51,0x0E,0x51,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,
-	0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xEF,0x1A,0xF0,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x31,0x23,0xF1,0x2A,0xF1,0x2A,0xCF,0x22,0xD5,0x33,0x17,0x44,0x17,0x44,0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x79,0x8A,0x37,0x82,0x92,0x61,0x30,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x91,0x59,0x30,0x59,0x0E,0x51,0xEE,0x50,0x0E,0x51,0x0E,0x51,0xEE,0x58,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x25,0x01,0x66,0x01,0x4B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xF0,0x22,0xF0,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF1,0x2A,0x31,0x23,0xF1,0x2A,0xCF,0x22,0x73,0x2B,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,
-	0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x79,0x8A,0x37,0x82,0x91,0x59,0x91,0x59,0x52,0x69,0x92,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0xEE,0x50,
-	0xEE,0x50,0x0E,0x51,0xEE,0x58,0xEE,0x50,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xC8,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,
-	0xEF,0x1A,0xF0,0x22,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x31,0x23,0xF1,0x2A,0xF0,0x22,0x73,0x2B,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x39,0x9A,0xD6,0x79,0x91,0x59,0x92,0x61,0x52,0x69,0x91,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x0E,0x51,0xEE,0x50,0x0E,0x51,0x0E,0x51,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x25,0x01,0x87,0x01,0xC9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0xEF,0x1A,0xF0,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF0,0x22,0x31,0x23,0xF0,0x22,0xF1,0x2A,0x17,0x44,0x98,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,
-	0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x79,0x8A,0x39,0x9A,0xD4,0x71,0x30,0x59,0x92,0x61,0x91,0x59,0x90,0x51,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,
-	0x30,0x61,0x0E,0x51,0xEE,0x50,0x0E,0x51,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0xA9,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xA8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF0,0x22,0xF1,0x2A,0xF1,0x2A,0x57,0x3C,0x98,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0xB9,0x63,0x38,0x6B,0x9A,0x73,0x9A,0x73,0x9A,0x73,0x9A,0x73,0x39,0x73,0x39,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0xD4,0x71,0x91,0x59,0x92,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0x0E,0x51,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x20,0x04,0x20,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x31,0x23,0xF0,0x22,0xD5,0x33,0x98,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0xB9,0x63,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x7A,0x7B,0xF9,0x7A,
-	0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x39,0x9A,0x38,0x8A,0x92,0x61,0x30,0x61,0x91,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,
-	0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x59,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x6A,0x40,0x67,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x25,0x01,0x87,0x01,0xC9,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF0,0x22,0x73,0x2B,0x98,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0xB9,0x63,
-	0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x39,0x73,0xD8,0x72,0x97,0x7A,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x39,0x9A,0xD6,0x79,0x91,0x59,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x6A,0x40,0x69,0x38,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x46,0x28,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x8C,0x12,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xF0,0x22,0xF0,0x22,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB9,0x63,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,
-	0x5B,0x8B,0x5B,0x8B,0x1A,0x8B,0xD8,0x72,0x97,0x7A,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x39,0x9A,0xD4,0x71,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,
-	0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xCB,0x40,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x6A,0x40,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x66,0x20,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xA8,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x0B,0x12,0x2B,0x12,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x73,0x2B,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,
-	0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0xF9,0x7A,0x97,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x39,0x9A,0xD6,0x79,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0xED,0x48,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x65,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x86,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xD5,0x33,0x98,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0x96,0x4B,0xD8,0x53,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1A,0x8B,0x97,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x19,0x9A,0x52,0x69,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,
-	0x30,0x61,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x59,0xEE,0x58,0xED,0x48,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0xA9,0x30,0x69,0x38,0x6A,0x40,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xC3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xA8,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0x73,0x2B,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0x96,0x4B,0xB9,0x63,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1A,0x8B,0x97,0x7A,0x97,0x7A,0x98,0x82,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x39,0x9A,0xF7,0x89,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xCC,0x48,0xAB,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x67,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x87,0x28,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,
-	0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,
-	0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x87,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x0B,0x12,0x8C,0x12,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0x6D,0x1A,0xF0,0x22,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x96,0x4B,0xD8,0x53,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1A,0x8B,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x19,0x9A,0x18,0x92,0xD4,0x71,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,
-	0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x59,0xEE,0x50,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x20,0x04,0x20,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xA8,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x4B,0x12,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0x73,0x2B,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x96,0x4B,0xD8,0x53,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xB9,0x8A,0x97,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0xD6,0x79,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xED,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x67,0x28,0x66,0x20,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x6D,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xF0,0x22,0x73,0x2B,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x98,0x82,0x97,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x39,0x9A,0xF7,0x89,0x52,0x69,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,
-	0x30,0x61,0x30,0x61,0x30,0x59,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x68,0x30,0x65,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x28,0x03,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x25,0x01,0xA8,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xF0,0x22,0x31,0x23,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x96,0x4B,0xD8,0x53,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0x52,0x69,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x87,0x28,0x25,0x20,0x03,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x01,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0x31,0x23,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0xB9,0x8A,0x97,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0xD6,0x79,0x30,0x61,0x30,0x61,0x30,0x59,0x30,0x59,
-	0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x68,0x30,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x87,0x28,0x04,0x20,0x03,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x86,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x25,0x01,0xA8,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0xCF,0x22,0xF0,0x22,0xF0,0x22,0x73,0x2B,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0x96,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x98,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x39,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x23,0x18,0x03,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x28,0xD4,0x71,0xD4,0x71,0xD4,0x71,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0x31,0x23,0xF0,0x22,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xB9,0x8A,0x97,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0xF7,0x89,0x52,0x69,0x52,0x69,0x30,0x61,0x30,0x59,
-	0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x0E,0x51,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x68,0x30,0x65,0x20,
-	0x66,0x20,0x66,0x28,0x87,0x28,0x65,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x49,0xD4,0x71,0xD4,0x71,0xD4,0x71,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x79,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0x44,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x86,0x01,0x86,0x01,0x66,0x01,
-	0x66,0x01,0x87,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0xF0,0x22,0x31,0x23,0xF0,0x22,0xD5,0x33,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x9B,0x83,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x1B,0x93,0xBB,0x92,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0x19,0x9A,0x52,0x69,0x52,0x69,0x52,0x69,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x59,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x66,0x20,0x66,0x20,0x66,0x28,0x67,0x28,0x25,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x79,0x1F,0xB3,0x1F,0xB3,0x37,0x82,0xD4,0x71,0xD4,0x71,0xFE,0xAA,0x1F,0xB3,0xBB,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x66,0x01,0x86,0x01,0x66,0x01,0x66,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0x31,0x23,0x31,0x23,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0x17,0x44,0x96,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x98,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD4,0x71,0x30,0x61,0x52,0x69,0x30,0x61,
-	0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x68,0x30,
-	0x66,0x20,0x66,0x28,0x87,0x28,0x04,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xBB,0x92,0x1F,0xB3,0xFE,0xAA,0xD6,0x79,0xD4,0x71,0xD6,0x79,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x28,0x1F,0xB3,0x1F,0xB3,0x92,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x38,0xFE,0xAA,0x1F,0xB3,0x0C,0x41,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x86,0x01,0x66,0x01,
-	0x87,0x01,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xF0,0x22,0x31,0x23,0xF0,0x22,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0x17,0x44,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0xBB,0x92,0xB9,0x8A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD4,0x71,0x30,0x61,0x52,0x69,0x52,0x69,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x68,0x30,0x66,0x20,0x87,0x28,0x66,0x20,0x23,0x10,0x03,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x59,0x1F,0xB3,0xFE,0xAA,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x59,0x1F,0xB3,0x1F,0xB3,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x59,0x1F,0xB3,0x1F,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x82,0x1F,0xB3,0x37,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0x86,0x01,0x66,0x01,0x87,0x01,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0x31,0x23,0x31,0x23,0xF0,0x22,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x52,0x69,
-	0x30,0x61,0x30,0x59,0x30,0x61,0x0E,0x51,0xEE,0x50,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,
-	0x67,0x28,0x66,0x20,0x65,0x20,0x03,0x10,0x03,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x37,0x82,0x1F,0xB3,0x79,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x71,0x1F,0xB3,0xFE,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x71,0x1F,0xB3,0xBB,0x92,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0x25,0x01,0x87,0x01,
-	0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x6B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0x31,0x23,0x31,0x23,0xF0,0x22,0x73,0x2B,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0x17,0x44,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0xBB,0x92,0xBB,0x92,0x97,0x7A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x52,0x69,0x52,0x69,0x30,0x61,0x30,0x59,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x68,0x30,0x66,0x20,0x04,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x49,0x1F,0xB3,0xFE,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x49,0x1F,0xB3,0x1F,0xB3,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0xA8,0x01,0xC9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x6B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0xEF,0x1A,0x31,0x23,0x31,0x23,0x31,0x23,0xF0,0x22,0x73,0x2B,0x57,0x3C,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x52,0x69,
-	0x52,0x69,0x30,0x61,0xEE,0x58,0xEE,0x50,0x0E,0x51,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,
-	0x6A,0x40,0x46,0x28,0x03,0x10,0x03,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x38,0x0C,0x41,0x92,0x61,0xFE,0xAA,0x1F,0xB3,0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0x1F,0xB3,0x1F,0xB3,0x37,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x59,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0xE9,0x09,
-	0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x6B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0xEF,0x1A,0x31,0x23,
-	0x31,0x23,0x31,0x23,0xEF,0x1A,0x73,0x2B,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0x17,0x44,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0xBB,0x92,0xBB,0x92,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x52,0x69,0x52,0x69,0x52,0x69,0xEE,0x50,0x0E,0x51,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x26,0x28,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xD4,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0xBB,0x92,0xBB,0x92,0x1F,0xB3,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x6B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0xEF,0x1A,0x31,0x23,0x31,0x23,0x31,0x23,0xF0,0x22,0x73,0x2B,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0x96,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x1B,0x93,0xBB,0x92,0xBB,0x92,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x52,0x69,0x52,0x69,0x52,0x69,
-	0x52,0x69,0x30,0x61,0xEE,0x50,0x0E,0x51,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,
-	0x8B,0x48,0x26,0x28,0x02,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x59,0xD4,0x71,0x37,0x82,0xFE,0xAA,0x1F,0xB3,0x37,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0xFE,0xAA,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0xD4,0x71,0x91,0x59,0x1F,0xB3,0xBB,0x92,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0xC4,0x00,0xC8,0x09,
-	0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x6B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0xEF,0x1A,0x31,0x23,
-	0x31,0x23,0x31,0x23,0xF0,0x22,0x73,0x2B,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x1B,0x93,0xBB,0x92,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x52,0x69,0x52,0x69,0x52,0x69,0xEE,0x50,0xEE,0x50,0x0E,0x51,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x26,0x30,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x1F,0xB3,0x1F,0xB3,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x38,0x0C,0x41,0x00,0x00,0x00,0x00,0xD6,0x79,0x1F,0xB3,0x37,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC4,0x00,0x67,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x6B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xF0,0x22,0x31,0x23,0x31,0x23,0xF0,0x22,0x73,0x2B,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0x96,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x1B,0x93,0xBB,0x92,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x52,0x69,
-	0x52,0x69,0x30,0x61,0x30,0x59,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,
-	0x69,0x38,0x27,0x30,0x04,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xD4,0x71,0xD4,0x71,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0x1F,0xB3,0xD4,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0xD4,0x71,0xD4,0x71,0x87,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0x1F,0xB3,0x2E,0x49,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,
-	0xA8,0x01,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0x31,0x23,0x31,0x23,0xF0,0x22,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0x17,0x44,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x1B,0x93,0xBB,0x92,0xBB,0x92,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x52,0x69,0x30,0x61,0x30,0x61,0x30,0x61,0x0E,0x51,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x27,0x38,0x27,0x30,0x25,0x28,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0x92,0x1F,0xB3,0x37,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xB3,0x1F,0xB3,0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0x1F,0xB3,0x37,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x82,0x1F,0xB3,0xFE,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC4,0x00,0x26,0x09,0x05,0x09,0x47,0x09,0x09,0x02,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xF0,0x22,0x31,0x23,0x31,0x23,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x1B,0x93,0xB9,0x8A,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x52,0x69,
-	0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,
-	0x27,0x30,0x27,0x30,0x26,0x30,0x03,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x92,0x61,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x82,0x1F,0xB3,0x1F,0xB3,0x87,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0xBB,0x92,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x0C,0x41,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x26,0x09,0x05,0x09,
-	0x46,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xCF,0x22,0xEF,0x1A,0xEF,0x1A,
-	0xEF,0x1A,0x31,0x23,0x31,0x23,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0xBB,0x92,0xB9,0x8A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0x52,0x69,0x30,0x61,0x52,0x69,0x52,0x69,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0x8C,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x27,0x38,0x26,0x28,0x27,0x30,0x27,0x30,0x03,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0xBB,0x92,0xFE,0xAA,0x1F,0xB3,0x1F,0xB3,0xD6,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x71,0xFE,0xAA,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x46,0x09,0x26,0x09,0x05,0x09,0xA8,0x01,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0x31,0x23,0x31,0x23,0xF0,0x22,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0x17,0x44,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD4,0x71,0x30,0x61,0x52,0x69,0x30,0x61,
-	0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x59,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x27,0x30,
-	0x26,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x44,0x18,0x37,0x82,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0x92,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x0C,0x41,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC4,0x00,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x05,0x09,0x47,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x4B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xF0,0x22,0xEF,0x1A,0xEF,0x1A,
-	0xCF,0x22,0xF0,0x22,0x31,0x23,0xEF,0x1A,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0x17,0x44,0x96,0x4B,0x17,0x44,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0xBB,0x92,0x97,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0xF7,0x89,0x52,0x69,0x52,0x69,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x26,0x28,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x28,0x03,0x10,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0x0C,0x41,0x0C,0x41,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0xC8,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xEF,0x1A,0xF0,0x22,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0x31,0x23,0xF0,0x22,0x73,0x2B,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x1B,0x93,0xB9,0x8A,0x37,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0xF7,0x89,0x30,0x61,0x52,0x69,0x30,0x61,0x30,0x61,
-	0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x30,0x26,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x38,0x26,0x30,0x03,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0x05,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x05,0x09,0x46,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xCF,0x22,0xEF,0x1A,0xCF,0x22,0x31,0x23,0x31,0x23,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0x97,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x39,0x9A,0xD6,0x79,0x30,0x61,0x52,0x69,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x50,0x8C,0x50,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x26,0x28,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x04,0x20,0x03,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0xA8,0x01,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x6B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF0,0x22,0x31,0x23,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x98,0x82,0x97,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x19,0x9A,0xD4,0x71,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x61,
-	0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x30,0x26,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC4,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x05,0x09,0x47,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,
-	0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF0,0x22,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xB9,0x8A,0x97,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0xF7,0x89,0x52,0x69,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x28,0x03,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0xC8,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x73,0x2B,0x98,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x96,0x4B,0xD8,0x53,0x7A,0x5C,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0xF7,0x89,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,
-	0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x30,0x26,0x28,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x26,0x30,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x47,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x5B,0x8B,0x1A,0x8B,0x1B,0x93,0x1B,0x93,0x98,0x7A,0x97,0x7A,0x98,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0xD4,0x71,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xAC,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x26,0x28,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0x05,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x46,0x09,0xC8,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x6D,0x1A,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0x96,0x4B,0x96,0x4B,0x7A,0x5C,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,
-	0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0x98,0x82,0x97,0x7A,0x98,0x82,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x39,0x9A,0x18,0x92,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,
-	0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xED,0x48,0xAB,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x38,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x47,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0xAD,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x31,0x23,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1B,0x93,0xF9,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x19,0x9A,0xD4,0x71,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xAB,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x26,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,
-	0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0xC8,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x0B,0x12,0x8C,0x12,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0x96,0x4B,0x96,0x4B,0xB9,0x63,0x5A,0x64,0x5A,0x64,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,
-	0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x1B,0x93,0x1A,0x8B,0xD8,0x72,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x39,0x9A,0xF7,0x89,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x30,0x61,
-	0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x50,0xCC,0x48,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x30,0x26,0x28,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x28,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC4,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x47,0x09,0xE9,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0xAD,0x1A,0xF0,0x22,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,
-	0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF1,0x2A,0x57,0x3C,0x98,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB9,0x63,0x5A,0x64,0x5A,0x64,0x1A,0x6C,
-	0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x5B,0x8B,0x1A,0x8B,0xD8,0x72,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x39,0x9A,0xD6,0x79,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xCC,0x48,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0xCA,0x38,0x68,0x30,0x26,0x30,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x26,0x28,0x03,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x02,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x67,0x09,0xE9,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0xEF,0x1A,0xF0,0x22,0xEF,0x1A,0xEF,0x1A,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF0,0x22,0xD5,0x33,0x98,0x3C,0x57,0x3C,0x17,0x44,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB9,0x63,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,
-	0x5B,0x8B,0x1A,0x8B,0xD8,0x72,0x97,0x7A,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x39,0x9A,0xF7,0x89,0x52,0x69,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x30,0x61,
-	0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x50,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x30,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x26,0x30,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x46,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0xAD,0x1A,0xF0,0x22,0xEF,0x1A,0xEF,0x1A,
-	0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF0,0x22,0xF1,0x2A,0x17,0x44,0x98,0x3C,0x57,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0xB9,0x63,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0xBB,0x7B,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x9B,0x83,0x7A,0x7B,0x39,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x38,0x8A,0x39,0x9A,0xD4,0x71,0x30,0x61,0x91,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xAC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x68,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x05,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x67,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0x6D,0x1A,0xEF,0x1A,0xEF,0x1A,0xF0,0x22,0xCF,0x22,0xEF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF1,0x2A,0xCF,0x22,0xF1,0x2A,0x98,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0xB9,0x63,0xB9,0x63,0x9A,0x73,0xFB,0x73,0x9A,0x73,0xFB,0x73,0xBB,0x7B,0x7A,0x7B,0x7A,0x7B,0x7A,0x7B,0x7A,0x7B,0x39,0x73,0x18,0x73,0xD8,0x72,
-	0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x39,0x9A,0xD6,0x79,0x30,0x59,0x52,0x69,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x30,0x61,
-	0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x26,0x28,0x26,0x30,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0x26,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xEF,0x1A,
-	0xF0,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF1,0x2A,0xF0,0x22,0x73,0x2B,0x98,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x39,0x9A,0xD6,0x79,0x91,0x59,0x52,0x69,0x91,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0xA9,0x30,0x27,0x30,0x26,0x28,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xC3,0x00,0x05,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x05,0x09,0x26,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xCF,0x22,0xF0,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x6F,0x32,0xF0,0x22,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xD5,0x33,0x98,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,
-	0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x58,0x8A,0x38,0x8A,0x79,0x8A,0x58,0x8A,0x92,0x61,0x91,0x59,0x52,0x69,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,
-	0x30,0x59,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0xAB,0x48,0x68,0x30,0x26,0x28,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,
-	0x6D,0x1A,0xCF,0x22,0xF0,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xD5,0x33,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x79,0x8A,0x38,0x8A,0x52,0x69,0x91,0x59,0x52,0x69,0x52,0x69,0x91,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xEE,0x50,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xE3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x06,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xCF,0x22,0xF0,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF0,0x22,0xF1,0x2A,0xF1,0x2A,0xF0,0x22,0xF1,0x2A,0x17,0x44,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,
-	0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x58,0x8A,0x79,0x8A,0x38,0x8A,0xD4,0x71,0x91,0x59,0x92,0x61,0x52,0x69,0x92,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x0E,0x51,0xEE,0x50,
-	0x0E,0x51,0xEE,0x58,0xEE,0x58,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0xAC,0x50,0x69,0x38,0x25,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xC4,0x08,0xC8,0x09,0x8C,0x12,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,
-	0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0xF0,0x22,0xCF,0x22,0xCF,0x22,0x6F,0x32,0xCF,0x22,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xF1,0x2A,0x17,0x44,0x17,0x44,0x17,0x44,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x79,0x8A,0x79,0x8A,0xD4,0x71,0x30,0x59,0x92,0x61,0x92,0x61,0x52,0x69,0x91,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x0E,0x51,0xEE,0x50,0x0E,0x51,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xCC,0x48,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0x8C,0x50,0x8C,0x50,0xAC,0x50,0x8C,0x50,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xE3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x26,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF3,0x3A,0x17,0x44,
-	0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,
-	0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x78,0x82,0x79,0x8A,0x79,0x8A,0xD4,0x71,0x91,0x59,0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x59,0x0E,0x51,0xEE,0x50,0xEE,0x50,0x0E,0x51,0xEE,0x58,
-	0x0E,0x51,0xEE,0x58,0xEE,0x50,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0xAC,0x50,0x8C,0x50,0x69,0x38,0x25,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x10,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xE3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xC8,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0x6D,0x1A,0x6D,0x1A,
-	0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x0C,0x22,0x4D,0x22,0x4D,0x22,0xCF,0x22,0x6F,0x32,0xCF,0x22,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xF1,0x2A,0xF7,0x4B,0x17,0x44,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,0x79,0x8A,0x78,0x82,
-	0x92,0x61,0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x52,0x69,0x92,0x61,0x30,0x59,0x30,0x59,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x58,0x0E,0x51,0xEE,0x58,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x48,0xAC,0x48,0xAC,0x50,0x8B,0x48,0x27,0x30,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,0xC3,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0xC9,0x09,0x6B,0x0A,0x6B,0x0A,
-	0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x6D,0x1A,0x6F,0x32,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,
-	0x6F,0x32,0xD5,0x33,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,
-	0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x82,0x98,0x82,0xB9,0x8A,0x37,0x82,0x92,0x61,0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x30,0x59,0x30,0x59,0x2E,0x49,0x2E,0x49,0xEE,0x50,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x50,0x0E,0x51,
-	0xEE,0x58,0xEE,0x58,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0x8B,0x48,0x69,0x38,0x27,0x30,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x18,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0x6D,0x1A,
-	0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0xCF,0x22,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xD5,0x33,0xF7,0x4B,0xD8,0x53,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x82,0xB9,0x8A,0x37,0x82,0x91,0x59,0x91,0x59,
-	0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x52,0x69,0x91,0x59,0x2E,0x49,0x2E,0x49,0xED,0x48,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x58,0xEE,0x58,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,
-	0xAC,0x50,0xAB,0x48,0x6A,0x40,0x69,0x38,0x27,0x30,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x23,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xE3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x47,0x09,0xC9,0x09,0xA8,0x09,0x4A,0x0A,
-	0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x0C,0x22,0x6F,0x32,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,
-	0xF1,0x2A,0xF1,0x2A,0x6F,0x32,0xF3,0x3A,0xF7,0x4B,0xD8,0x53,0xF7,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,
-	0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0xD8,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x7A,0xB9,0x8A,0x79,0x8A,0x55,0x6A,0x90,0x51,0x91,0x59,0x92,0x61,0x92,0x61,0x92,0x61,0x92,0x61,0x91,0x59,0x91,0x59,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x50,0x0E,0x51,0x0E,0x51,
-	0xEE,0x58,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x6A,0x40,0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x28,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0x46,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x06,0x09,0xC9,0x09,0xA8,0x09,0xC8,0x09,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,
-	0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0xCF,0x22,0x6F,0x32,0x6F,0x32,0xF1,0x2A,0xF1,0x2A,0xF3,0x3A,0xF1,0x2A,0x6F,0x32,0xF1,0x2A,0x96,0x4B,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x18,0x73,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0x98,0x7A,0xB9,0x8A,0xB9,0x8A,0x97,0x7A,0x92,0x61,0x90,0x51,0x92,0x61,0x92,0x61,0x92,0x61,
-	0x91,0x59,0x91,0x59,0x91,0x59,0x30,0x59,0x0E,0x51,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x58,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,
-	0x8B,0x48,0x27,0x38,0x8B,0x48,0x27,0x38,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x09,0x47,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xA8,0x09,0xC9,0x09,0xA8,0x09,
-	0xC9,0x09,0x6B,0x0A,0x6B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x12,0x0C,0x22,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x32,0xCF,0x22,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x6F,0x32,0xF1,0x2A,0xF1,0x2A,0x4F,0x3A,0x6F,0x32,0xF3,0x3A,0x96,0x4B,0xD8,0x53,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,
-	0xD8,0x72,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x7A,0xF9,0x7A,0x98,0x82,0x97,0x7A,0x55,0x6A,0x92,0x61,0x90,0x51,0x92,0x61,0x91,0x59,0x91,0x59,0x91,0x59,0x90,0x51,0x90,0x51,0x30,0x59,0x30,0x59,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x58,0x0E,0x51,
-	0xCB,0x40,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0x8B,0x48,0x69,0x38,0x6A,0x40,0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x27,0x38,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x46,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x47,0x09,0xC9,0x09,0xA8,0x09,0x67,0x09,0x0A,0x0A,0x6B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x12,
-	0x0B,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x32,0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x2E,0x2A,0x6F,0x32,0x6F,0x32,0xF1,0x2A,0x4F,0x3A,0x6F,0x32,0xF3,0x3A,0x96,0x4B,0xD8,0x53,0xB9,0x63,0xB9,0x63,0xB7,0x53,0x77,0x5B,0x77,0x5B,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xF9,0x7A,0xF9,0x7A,0xF9,0x7A,0x97,0x7A,0x55,0x6A,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x30,0x59,0x90,0x51,0x91,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x58,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0xAC,0x48,0x69,0x38,
-	0x69,0x38,0x6A,0x40,0x69,0x38,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x83,0x08,0x26,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x26,0x09,0xC9,0x09,0xA8,0x09,
-	0xA8,0x09,0xA8,0x09,0x2B,0x12,0x6B,0x0A,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x12,0x0B,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x2E,0x2A,0x4F,0x3A,0xF3,0x3A,0xF4,0x4A,0x96,0x4B,0xB7,0x53,0xB9,0x63,0xB9,0x63,0xB9,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x6B,0x58,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0x39,0x73,0x39,0x73,
-	0x39,0x73,0xF9,0x7A,0xD8,0x72,0xD8,0x72,0x55,0x6A,0x55,0x6A,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x91,0x59,0x30,0x59,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xED,0x48,0xCB,0x40,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0xAC,0x48,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x83,0x08,0x83,0x08,0x26,0x09,0x46,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xA8,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x2B,0x12,0x6B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x12,0x0C,0x22,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x32,0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x2E,0x2A,0x6F,0x32,0x31,0x4A,0xF3,0x3A,0xF4,0x4A,0xF5,0x5A,
-	0x77,0x5B,0x77,0x5B,0x58,0x63,0xB9,0x63,0x38,0x6B,0xB9,0x63,0x38,0x6B,0x39,0x73,0x38,0x6B,0x39,0x73,0x39,0x73,0x39,0x73,0x39,0x73,0x39,0x73,0x18,0x73,0x18,0x73,0x55,0x6A,0x55,0x6A,0x53,0x52,0x53,0x52,0xD0,0x49,0xD0,0x49,0x8E,0x41,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x30,0x59,0x91,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x50,0xCB,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,
-	0x69,0x38,0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA4,0x08,0x62,0x08,0x83,0x08,0x26,0x09,0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0xC9,0x09,
-	0xA8,0x09,0xA8,0x09,0x67,0x09,0xA8,0x09,0x4B,0x12,0x6B,0x0A,0x2B,0x12,0x2B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x12,0x0C,0x22,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x32,
-	0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0xF3,0x3A,0x53,0x52,0xF4,0x4A,0xF5,0x5A,0xF5,0x5A,0xF5,0x5A,0xF5,0x5A,0xF5,0x5A,0xF5,0x5A,0xF5,0x5A,0x53,0x52,0x53,0x52,0x53,0x52,0x31,0x4A,
-	0x31,0x4A,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x30,0x59,0x90,0x51,0x91,0x59,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0xEE,0x50,0xEC,0x40,0xCB,0x40,0xEC,0x40,
-	0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xCC,0x48,0x6A,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x27,0x30,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x38,0x25,0x20,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x83,0x08,0x83,0x08,0x62,0x08,0x83,0x08,0x46,0x09,
-	0x46,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x47,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xC9,0x09,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x12,0x0C,0x22,0x6D,0x1A,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x32,0xCF,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,
-	0xF3,0x3A,0x31,0x4A,0x4F,0x3A,0x31,0x4A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0xD0,0x49,0x31,0x4A,0xD0,0x49,0x31,0x4A,0xD0,0x49,0xD0,0x49,0x31,0x4A,0x91,0x59,0x31,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,
-	0x30,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xCB,0x40,0xCB,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,
-	0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x25,0x28,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x83,0x08,0x05,0x09,0x47,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xA8,0x09,
-	0xC9,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x67,0x09,0xC9,0x09,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0x0B,0x1A,0x4D,0x22,0x6D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,
-	0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x53,0x52,0x31,0x4A,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0x0C,0x41,0xCB,0x40,0xCB,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x38,0x27,0x30,
-	0x25,0x20,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,
-	0x83,0x08,0x05,0x09,0x47,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0xC9,0x09,0x8C,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xCB,0x19,0xEB,0x19,0x0C,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0xCD,0x29,0x4D,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,
-	0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAB,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x6A,0x40,
-	0x6A,0x40,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0xC4,0x08,0x46,0x09,0x46,0x09,0x06,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x26,0x09,
-	0xC9,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0x88,0x11,0xC9,0x09,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x12,0xEB,0x19,0x0C,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x2E,0x2A,0x4D,0x22,
-	0x4D,0x22,0x2E,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x51,0x0E,0x51,0x0C,0x41,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,
-	0xCC,0x48,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x30,0x27,0x38,0x26,0x30,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x83,0x08,0x63,0x08,0x62,0x08,0xC4,0x08,0x46,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xA8,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0x88,0x11,0x0B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0x0C,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x2E,0x2A,0x4D,0x22,0xCD,0x29,0x4D,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,
-	0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x90,0x51,0x2E,0x49,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0xEC,0x40,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x6A,0x40,
-	0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x27,0x38,0x26,0x28,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0xA4,0x08,0x46,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,
-	0x67,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0xA8,0x09,0x88,0x11,0xA8,0x09,0x67,0x09,0x0B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xEB,0x19,0x0C,0x22,0x4D,0x22,0x2E,0x2A,0x4D,0x22,
-	0x2E,0x2A,0x2E,0x2A,0x2E,0x2A,0x2E,0x2A,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xD0,0x49,0x4F,0x3A,0xD0,0x49,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xD0,0x49,0x4F,0x3A,0xD0,0x49,0xD0,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0C,0x41,0xEC,0x40,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x26,0x28,0x46,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x30,0x27,0x30,0x27,0x38,0x25,0x28,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x83,0x08,0x05,0x09,0x47,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x47,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0xA8,0x09,0x88,0x11,0x88,0x11,0x0B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xCB,0x19,0xCB,0x21,0x0C,0x22,0x4D,0x22,0x4D,0x22,0x2E,0x2A,0x2E,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,
-	0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xED,0x31,0xAE,0x39,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0x8E,0x41,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x91,0x59,0x90,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,
-	0x0C,0x41,0x0C,0x41,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x69,0x38,
-	0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x27,0x30,0x27,0x30,0x25,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x63,0x08,0xC4,0x08,0x26,0x09,0x47,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0x88,0x11,0xA8,0x09,0x88,0x11,0x88,0x11,0x67,0x09,0x0B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xCB,0x19,
-	0xCB,0x19,0xAB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCD,0x29,0x2E,0x2A,0x6F,0x32,0x2E,0x2A,0x6F,0x32,0x2E,0x2A,0x2E,0x2A,0xED,0x31,0x2E,0x2A,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xCD,0x29,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,
-	0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0xD0,0x49,0x8E,0x41,0x90,0x51,0x8E,0x41,0x90,0x51,0x90,0x51,0x8E,0x41,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x27,0x30,0x27,0x30,0x25,0x28,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x42,0x08,0x83,0x08,0x05,0x09,0x47,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0xA8,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x67,0x09,0x0B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x1A,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xCB,0x19,0xAB,0x21,0xCD,0x29,0x2E,0x2A,0xCD,0x29,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,
-	0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x2E,0x49,0x8E,0x41,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x26,0x28,
-	0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x04,0x20,0x03,0x10,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x62,0x08,0xC4,0x08,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x05,0x09,0x06,0x09,0xC9,0x09,0xA8,0x09,0x88,0x11,0xA8,0x09,0x88,0x11,0xA8,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x0B,0x12,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xCB,0x19,0xAB,0x21,0xCD,0x29,0x2E,0x2A,0x2E,0x2A,0x2E,0x2A,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xAE,0x39,
-	0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x2E,0x49,0x8E,0x41,0x8E,0x41,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,
-	0xEC,0x40,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x27,0x38,0x25,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x27,0x30,0x26,0x28,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xA4,0x08,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0x83,0x08,0x05,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x11,0x05,0x09,0x67,0x09,0xC9,0x09,0xA8,0x09,0xA8,0x09,0x88,0x11,0xA8,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0x0B,0x12,0x2B,0x12,
-	0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCB,0x21,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,
-	0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xAE,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x0C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xEC,0x40,0xEC,0x40,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x26,0x28,0x26,0x28,
-	0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x25,0x20,0x03,0x10,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x63,0x08,0xA4,0x08,0x06,0x09,0x26,0x09,
-	0x26,0x09,0x05,0x09,0x47,0x09,0xC9,0x09,0xA8,0x09,0x88,0x11,0x88,0x11,0xA8,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0x88,0x11,0xA9,0x19,0x2B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0xED,0x31,0x2E,0x2A,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0x8E,0x41,0xAE,0x39,
-	0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x2B,0x39,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xEC,0x40,
-	0xEC,0x40,0x69,0x38,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x25,0x28,0x23,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0x63,0x08,0xC4,0x08,0x06,0x09,0x06,0x09,0x06,0x09,0xA8,0x09,0xC9,0x09,0xA8,0x09,0x88,0x11,0xA8,0x09,0xA8,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0x68,0x11,
-	0xA9,0x19,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x21,0xAB,0x21,0xAB,0x29,0xCD,0x29,0xED,0x31,0xED,0x31,
-	0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x4C,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x48,0xCB,0x40,0x69,0x38,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x27,0x30,0x26,0x28,0x26,0x28,
-	0x46,0x28,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,
-	0x63,0x08,0xC4,0x08,0x05,0x09,0x67,0x09,0xC9,0x09,0x88,0x11,0xA8,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0xA9,0x19,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0xCD,0x29,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x41,0xAE,0x39,0x8E,0x41,0xAE,0x39,0x8E,0x41,0xAE,0x39,
-	0x4C,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x40,0xA9,0x30,
-	0xA9,0x30,0xA9,0x30,0x69,0x38,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x26,0x28,0x25,0x28,0x04,0x20,0x03,0x10,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0x63,0x08,0xA4,0x08,0xA8,0x09,0xC9,0x09,0xA8,0x09,0x88,0x11,0xA8,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,
-	0x88,0x11,0x68,0x11,0xA9,0x19,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x6B,0x29,0x8B,0x29,0x8B,0x29,0xCD,0x29,0xCD,0x29,0xCD,0x29,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x4C,0x31,0x6B,0x31,0x6B,0x29,0x2B,0x31,0x2B,0x31,0x2B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x40,0x68,0x30,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x26,0x28,0x23,0x18,0x03,0x10,0x03,0x10,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0xA4,0x08,0x67,0x09,0x88,0x11,0xC9,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0x68,0x11,0x88,0x11,0xEB,0x19,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x2A,0x31,0x6B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,
-	0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCA,0x38,0xA9,0x30,0xA9,0x30,0x69,0x38,
-	0x69,0x38,0xA9,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x69,0x38,0x26,0x28,0x02,0x10,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xC4,0x08,0x46,0x09,0x67,0x09,0x88,0x11,0xC9,0x09,0xC9,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,
-	0x88,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0xEB,0x19,0x0C,0x22,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCA,0x38,0x68,0x30,0xA9,0x30,0xA9,0x30,0x69,0x38,0xA9,0x30,0x69,0x38,0xA9,0x30,0x69,0x38,0x69,0x38,0x6A,0x40,0x6A,0x40,0x6A,0x40,0x68,0x30,0x27,0x30,0x26,0x30,0x23,0x18,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x83,0x08,0x62,0x08,0xA4,0x08,0x26,0x09,0x05,0x09,0x06,0x09,0x47,0x09,0x67,0x09,0x88,0x11,0xA9,0x19,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0xA9,0x19,0x0C,0x22,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,
-	0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x41,0xEC,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,
-	0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x69,0x38,0x69,0x38,0x68,0x30,0x26,0x28,0x26,0x28,0x26,0x28,0x25,0x28,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x05,0x09,0x26,0x09,0x05,0x09,0x05,0x09,0x05,0x09,0x26,0x09,0x67,0x09,0x88,0x11,0x88,0x11,0xA9,0x19,
-	0xA9,0x19,0x68,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0xA9,0x19,0xEB,0x19,0x0C,0x22,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0xEC,0x40,0x0C,0x41,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x6A,0x40,0x69,0x38,0x69,0x38,0xA9,0x30,0x68,0x30,0x26,0x28,0x25,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x04,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xA4,0x08,0x46,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x05,0x09,0x06,0x09,0x26,0x09,0x67,0x09,0x68,0x11,0x88,0x11,0xA9,0x19,0x88,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0xCB,0x19,0x0C,0x22,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,
-	0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x41,0x0C,0x39,0xCA,0x38,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xCA,0x38,0x69,0x38,0x69,0x38,
-	0x68,0x30,0x67,0x28,0x67,0x28,0x25,0x28,0x26,0x28,0x46,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x25,0x28,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x42,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x05,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x05,0x09,
-	0x05,0x09,0x26,0x09,0x67,0x09,0x68,0x11,0x68,0x11,0xA9,0x19,0xA9,0x19,0x68,0x11,0x68,0x11,0x68,0x11,0xCB,0x19,0x0C,0x22,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x40,0x0C,0x39,0x0C,0x39,0xCA,0x38,0x68,0x30,0xA9,0x30,0xA9,0x30,0xCA,0x38,0xCA,0x38,0xA9,0x30,0x68,0x30,0x68,0x30,0x66,0x28,0x46,0x28,0x46,0x28,0x46,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x04,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xA4,0x08,0x46,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xC5,0x10,0x05,0x09,0x06,0x11,0x26,0x09,0x27,0x19,0x68,0x11,0x68,0x11,0xA9,0x19,0x68,0x11,0x68,0x11,0xA9,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x21,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,
-	0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x41,0xCA,0x38,0xA9,0x30,0xA9,0x30,0xCA,0x38,0xA9,0x30,0xA9,0x30,0x68,0x30,0x67,0x28,0x67,0x28,0x46,0x28,0x46,0x28,0x46,0x28,
-	0x66,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x25,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xC4,0x08,0x47,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x05,0x09,0x05,0x09,0x05,0x09,0x06,0x11,0x27,0x19,0x27,0x19,0x68,0x11,0x68,0x11,0x69,0x21,0xCB,0x21,0x0C,0x22,0xEB,0x19,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x41,0x0C,0x41,0xCA,0x38,0xA9,0x30,0xA9,0x30,0x68,0x30,0x87,0x28,0x87,0x28,0x66,0x20,0x66,0x20,0x46,0x28,0x46,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x23,0x18,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x83,0x08,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x05,0x09,0x05,0x09,0xC5,0x10,0x06,0x11,0x06,0x11,0x06,0x11,0x27,0x19,0xA9,0x19,0xCB,0x21,
-	0x0C,0x22,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,
-	0x4C,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x39,0x0C,0x41,0x2B,0x39,0xE9,0x28,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,
-	0x66,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x66,0x28,0x26,0x28,0x04,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xA4,0x08,0x47,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xC5,0x10,0xC5,0x10,0x05,0x09,0xC5,0x10,0xC5,0x10,0x27,0x19,0x68,0x11,0xCB,0x19,0xCB,0x19,0xAB,0x21,0xAB,0x21,0xAB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,
-	0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x31,0x2B,0x31,0x09,0x29,
-	0x87,0x28,0x66,0x20,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x46,0x28,0x03,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0xC4,0x08,0x47,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xC5,0x10,
-	0xC5,0x10,0xE6,0x10,0x68,0x11,0x49,0x19,0x68,0x11,0x49,0x19,0x49,0x19,0x69,0x21,0x69,0x21,0x69,0x21,0xAB,0x21,0x69,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,
-	0x6B,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x31,0x2A,0x31,0x2A,0x31,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0x87,0x28,0x66,0x20,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,
-	0x66,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x23,0x18,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x05,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0x06,0x11,0xE6,0x10,0xC5,0x10,0xC5,0x10,0x27,0x19,0x69,0x21,0x69,0x21,0x49,0x19,0x68,0x11,0x49,0x19,0x49,0x19,0x27,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x29,0x21,
-	0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0x08,0x21,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0x09,0x29,0xE9,0x28,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x66,0x28,0x26,0x28,0x04,0x20,0x22,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xA4,0x08,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0x06,0x11,0xE6,0x10,0xC5,0x10,0xC5,0x10,0x06,0x11,0x68,0x11,0x69,0x21,0x69,0x21,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,
-	0x09,0x29,0x09,0x29,0xE9,0x28,0x09,0x29,0xE9,0x28,0x09,0x29,0xE9,0x28,0xE9,0x28,0x09,0x29,0x09,0x29,0x09,0x29,0x87,0x28,0x86,0x20,0x66,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,
-	0x66,0x28,0x66,0x28,0x26,0x28,0x67,0x28,0x25,0x28,0x22,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x05,0x09,0x26,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0x06,0x11,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0x27,0x19,0x49,0x19,0x69,0x21,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,
-	0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x09,0x29,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0x09,0x29,0xE9,0x28,0xE9,0x28,0x09,0x29,0x09,0x29,0xE9,0x28,0x86,0x20,0x85,0x18,0x66,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x67,0x28,0x23,0x18,0x03,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x83,0x08,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x27,0x19,0x49,0x19,0x69,0x21,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x29,0x21,0x29,0x21,0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x08,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,
-	0x09,0x29,0xE9,0x28,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0xA7,0x20,0x85,0x18,0x85,0x18,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,
-	0x66,0x28,0x66,0x28,0x67,0x28,0x25,0x20,0x03,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xA4,0x08,0x26,0x09,0x26,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0x06,0x11,0x27,0x19,0x49,0x19,0x69,0x21,0x69,0x21,0x49,0x19,0x29,0x21,
-	0x49,0x19,0x49,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x08,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0xC7,0x20,0x85,0x18,0x85,0x18,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x25,0x28,0x22,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x23,0x18,0x23,0x18,0x03,0x18,0x04,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xA4,0x08,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0xE6,0x10,0x27,0x19,0x49,0x19,0x69,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,
-	0x09,0x29,0x09,0x29,0x09,0x29,0x08,0x21,0xA7,0x20,0x85,0x18,0x85,0x18,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,
-	0x67,0x28,0x25,0x28,0x03,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x04,0x20,0x04,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xC4,0x08,
-	0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x27,0x19,0x29,0x21,
-	0x69,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x08,0x21,0x29,0x21,0x09,0x29,0x09,0x29,0x29,0x21,0x09,0x29,0x2A,0x31,0x09,0x29,0x08,0x21,0xA7,0x20,0x85,0x18,0x85,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x66,0x28,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,
-	0x04,0x20,0x23,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
-	0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0xC4,0x08,0x26,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x27,0x19,0x49,0x19,0x29,0x21,0x29,0x21,0x49,0x19,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x29,0x21,0x09,0x29,0x29,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x08,0x21,
-	0xC7,0x18,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x67,0x28,
-	0x23,0x18,0x03,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x04,0x20,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x05,0x09,0x26,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,
-	0xC5,0x10,0xE6,0x10,0x27,0x19,0x08,0x21,0x29,0x21,0x69,0x21,0x29,0x21,0x08,0x21,0x29,0x21,0x29,0x21,0x09,0x29,0x09,0x29,0x08,0x21,0xC7,0x20,0xC7,0x18,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x23,0x18,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x04,0x20,0x23,0x18,0x01,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x00,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x63,0x08,0x26,0x09,0x26,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x08,0x21,0x29,0x21,0x2A,0x31,0x2A,0x31,0x09,0x29,0x29,0x21,0xC7,0x18,0xA6,0x18,0x85,0x18,0x85,0x18,0xA6,0x18,
-	0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x67,0x28,0x67,0x28,0x04,0x20,0x22,0x10,
-	0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x04,0x20,0x04,0x20,0x23,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x08,0x63,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x62,0x08,0x83,0x08,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,
-	0xE6,0x10,0xA6,0x18,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xA6,0x18,0xC5,0x10,0xE6,0x10,0xE6,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xC7,0x18,0xC7,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x67,0x28,0x67,0x28,0x65,0x20,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x23,0x18,0x04,0x20,0x44,0x18,0x03,0x10,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0x83,0x08,0x06,0x09,0x26,0x09,0x06,0x11,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0x85,0x10,0x63,0x10,0x42,0x08,0x42,0x08,0x42,0x08,0x62,0x08,0x63,0x10,0x85,0x10,0x85,0x18,0xC7,0x18,0xC7,0x18,0xC7,0x18,
-	0xC7,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x67,0x28,0x04,0x20,0x22,0x10,0x23,0x10,0x23,0x10,
-	0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x44,0x18,0x44,0x18,0x23,0x18,0x22,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x42,0x08,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0x83,0x08,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,
-	0xC5,0x10,0x85,0x10,0x63,0x10,0x63,0x08,0x42,0x08,0x42,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0x42,0x08,0x63,0x08,0x43,0x10,0x85,0x10,0x85,0x10,0x85,0x18,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA6,0x20,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x67,0x28,0x44,0x18,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x44,0x18,0x23,0x18,0x23,0x10,0x03,0x10,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x08,0x62,0x08,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x83,0x08,0x06,0x11,0x26,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0x85,0x10,0x83,0x08,0x83,0x08,0x42,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x42,0x08,0x42,0x08,
-	0x43,0x08,0x64,0x10,0x85,0x10,0x85,0x18,0x85,0x18,0xA6,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0xA7,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x67,0x28,0x44,0x18,0x22,0x10,0x23,0x10,0x43,0x10,0x44,0x18,0x23,0x10,
-	0x23,0x18,0x22,0x10,0x02,0x10,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x21,0x00,0x42,0x08,0x62,0x08,0x63,0x08,0x42,0x08,0x63,0x08,0x06,0x11,0x27,0x19,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xC4,0x08,0xC4,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0x62,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x43,0x08,0x43,0x10,0x64,0x10,0x85,0x10,0x85,0x18,0x85,0x18,0x85,0x18,0x66,0x20,0x86,0x20,0xA7,0x20,0x66,0x20,0xA7,0x20,
-	0x87,0x28,0x87,0x28,0x87,0x28,0x87,0x28,0x87,0x28,0x87,0x28,0x87,0x28,0x67,0x28,0x67,0x28,0x44,0x18,0x22,0x10,0x22,0x10,0x22,0x10,0x02,0x10,0x01,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xC4,0x00,0xC4,0x08,0xC4,0x08,0xC4,0x08,0xC4,0x08,0xC4,0x08,0xA4,0x08,0xC4,0x08,
-	0xA4,0x08,0xA4,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0x43,0x08,0x42,0x08,0x22,0x10,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x44,0x18,0x44,0x18,0x44,0x18,0x44,0x18,0x44,0x18,0x44,0x18,0x44,0x18,0x44,0x18,0x65,0x20,0x65,0x20,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x62,0x08,0x82,0x00,0x62,0x08,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x10,0x22,0x10,0x42,0x08,0x22,0x10,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x22,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xA3,0x00,0xA4,0x08,0x83,0x08,0xA3,0x00,0x83,0x08,
-	0xA3,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0xA4,0x08,0xA3,0x00,0x83,0x08,0xA3,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x23,0x10,0x44,0x18,0x23,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xA4,0x08,0xA4,0x08,
-	0x83,0x08,0xA3,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x44,0x18,0x22,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x00,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x00,0x83,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x22,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x82,0x00,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x83,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x62,0x08,0x83,0x08,0xA4,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,
-	0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x42,0x08,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,
-	0x43,0x08,0x63,0x10,0x43,0x10,0x64,0x10,0x64,0x10,0x43,0x10,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x08,0x62,0x08,0x63,0x08,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x63,0x10,0x64,0x10,0x64,0x10,0x63,0x10,0x42,0x08,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x42,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,
-	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x0C,0x63,
-	0x0C,0x63,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,
-	0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,
-	0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x0C,0x63,
-	0x0C,0x63,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x28,0xD4,0x71,0xD4,0x71,0xD4,0x71,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x79,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0x1F,0xB3,0x1F,0xB3,0xD6,0x79,0x2E,0x49,0xD6,0x79,0x1F,0xB3,0x1F,0xB3,0x37,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x44,0x18,0xFE,0xAA,0x1F,0xB3,0x2E,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0x1F,0xB3,0x1F,0xB3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0x1F,0xB3,0xBB,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0x0C,0x41,0x0C,0x41,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x79,0x8A,0x1F,0xB3,0xD4,0x71,0x00,0x00,0x0C,0x41,0xD4,0x71,0x92,0x61,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0x92,0x1F,0xB3,0x2E,0x49,0xBB,0x92,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0xFE,0xAA,0xD6,0x79,0xD4,0x71,0x37,0x82,0x1F,0xB3,0x1F,0xB3,0x58,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0x1F,0xB3,0x1F,0xB3,0x87,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFE,0xAA,0x1F,0xB3,0x79,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xB3,0x1F,0xB3,0x92,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBB,0x92,0x1F,0xB3,0xD4,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0x1F,0xB3,0xD4,0x71,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD4,0x71,0x1F,0xB3,0xBB,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0x1F,0xB3,0x1F,0xB3,0x2E,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x28,0x1F,0xB3,0x1F,0xB3,0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x82,0x1F,0xB3,0xFE,0xAA,0x44,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x71,0x1F,0xB3,0x1F,0xB3,0xBB,0x92,0xBB,0x92,0xFE,0xAA,0x1F,0xB3,0x1F,0xB3,0x91,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x61,0xFE,0xAA,0x1F,0xB3,0x1F,0xB3,0x1F,0xB3,0xFE,0xAA,0x2E,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x0C,0x41,0xCA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_75_2_dial_img_0_1024_data_0, "face_75_2_dial_img_0_1024_data_0.bin");
         
 
 
@@ -1826,7 +21,7 @@ const lv_img_dsc_t face_75_2_dial_img_0_1024_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 240,
-    .data_size = sizeof(face_75_2_dial_img_0_1024_data_0),
+    .data_size = 115200,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_75_2_dial_img_0_1024_data_0};
 
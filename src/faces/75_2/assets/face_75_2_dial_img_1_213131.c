@@ -5,6 +5,7 @@
 // Watchface: 75_2
 
 #include "../75_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,34 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_1_213131_data_0[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x21,0x7A,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x41,0xAE,0x39,0x8D,0x39,0x8D,0x39,0x4C,0x39,0x2B,0x31,
-	0x2B,0x31,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0x7B,0xCE,0xDC,0xDE,0x92,0x63,0x72,0x63,0x95,0x8C,0xFF,0xFF,0x72,0x6B,0x72,0x6B,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x41,
-	0x8E,0x41,0x8E,0x41,0x6D,0x41,0x4C,0x39,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x34,0x7C,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x7B,0xCE,0x7B,0xCE,0xF1,0x5A,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x72,0x63,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x90,0x52,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0E,0x2A,0xED,0x29,0xED,0x29,0x7B,0xCE,0x7B,0xCE,0xF6,0x9C,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,
-	0x14,0x84,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5B,0xCE,0x38,0xAD,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x34,0x84,
-	0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xF7,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7B,0xD6,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x9B,0xCE,0x9B,0xCE,0xF1,0x52,0x17,0x9D,0x17,0x9D,0x17,0x9D,
-	0xF7,0x9C,0xF6,0x9C,0xCD,0x31,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xAD,0x39,0xAD,0x39,0xAD,0x39,0xAD,0x39,0xAE,0x39,0xAE,0x41,0xCF,0x41,0xCF,0x41,0xCF,0x49,0xCF,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x9B,0xCE,0xDA,0xB5,0xB4,0x6B,
-	0xFF,0xFF,0x9B,0xCE,0x9B,0xCE,0x3D,0xE7,0xFF,0xFF,0xEF,0x39,0xFF,0xFF,0xF7,0x9C,0xAD,0x31,0xAD,0x31,0xAD,0x39,0xCE,0x39,0xCF,0x41,0xCF,0x41,0xF0,0x41,0xF0,0x49,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0xFF,0xFF,0x37,0x9D,0xB3,0x6B,0xFF,0xFF,0x2F,0x3A,0x2F,0x3A,0x18,0x9D,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0xF7,0xA4,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xF0,0x41,0xF0,0x41,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x14,0x74,0xFF,0xFF,0x14,0x74,0xB3,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0x18,0xA5,0x72,0x4A,0x72,0x4A,0x52,0x4A,0x11,0x4A,0xF0,0x41,0xCF,0x41,0xCF,0x41,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x9B,0xCE,0xBE,0xF7,0x90,0x42,0x90,0x42,0xB3,0x6B,0x93,0x6B,0x93,0x6B,0x93,0x6B,0x9C,0xCE,0x99,0xAD,0xFF,0xFF,0x77,0x8C,0x51,0x4A,0x52,0x4A,0x52,0x4A,0x52,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0xCF,0x41,0xCF,0x41,0xCF,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x37,0x9D,0x37,0x9D,0x4F,0x3A,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0x71,0x42,0xFA,0xBD,0x9C,0xD6,0x99,0xAD,0x92,0x52,0x51,0x4A,0x52,0x4A,0x52,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0xCF,0x49,0xCF,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_1_213131_data_0, "face_75_2_dial_img_1_213131_data_0.bin");
         
 
 
@@ -47,40 +21,13 @@ const lv_img_dsc_t face_75_2_dial_img_1_213131_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_1_213131_data_0),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_1_213131_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_1_213131_data_1[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x21,0x8B,0x21,0x7A,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x0F,0x4A,0x52,0x6B,0x52,0x73,0x52,0x73,0x52,0x73,0x32,0x6B,0x32,0x6B,0x11,0x6B,0xF1,0x6A,0xF1,0x6A,
-	0x0E,0x4A,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0xCD,0x29,0x7B,0xCE,0xDC,0xDE,0x72,0x63,0x72,0x63,0x95,0x8C,0xFF,0xFF,0x72,0x6B,0x52,0x6B,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0x9C,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x34,0x7C,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x7B,0xCE,0x7B,0xCE,0xF1,0x5A,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x70,0x52,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,
-	0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0xA4,0x32,0x73,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x32,0x0E,0x32,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0x72,0x63,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x90,0x52,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0E,0x2A,0xED,0x29,0xED,0x29,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0xF6,0x9C,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,
-	0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x8D,0x39,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x32,0x0E,0x32,0xEE,0x31,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,
-	0x14,0x84,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x8D,0x39,0x8D,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x9B,0xCE,0x9B,0xCE,0xF1,0x52,0x17,0x9D,0x17,0x9D,
-	0xF7,0x9C,0xF6,0x9C,0xF6,0x9C,0xCD,0x31,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xAD,0x39,0xAD,0x39,0xAD,0x39,0xAD,0x39,0xAE,0x39,0xAE,0x41,0xCF,0x41,0xCF,0x41,0xCF,0x49,0xCF,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x9B,0xCE,0xDA,0xB5,
-	0xB4,0x6B,0xFF,0xFF,0x9B,0xCE,0x9B,0xCE,0x3D,0xE7,0xFF,0xFF,0xCE,0x39,0xFF,0xFF,0xD6,0x9C,0xAD,0x31,0xAD,0x39,0xCE,0x39,0xCF,0x41,0xCF,0x41,0xF0,0x41,0xF0,0x49,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0x4F,0x3A,0xFF,0xFF,0x37,0x9D,0xB3,0x6B,0xFF,0xFF,0x2F,0x3A,0x30,0x3A,0x18,0x9D,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0xF7,0xA4,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xF0,0x41,0xF0,0x41,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x4F,0x32,0x14,0x74,0xFF,0xFF,0x14,0x74,0xB3,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x42,0xFF,0xFF,0x39,0xA5,0x72,0x4A,0x54,0x6B,0x9C,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x16,0x8C,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x9B,0xCE,0xBE,0xF7,0x90,0x42,0x90,0x42,0x93,0x6B,0x93,0x6B,0x93,0x6B,0xB4,0x73,0x9C,0xD6,0x99,0xAD,0xFF,0xFF,0x77,0x8C,0x52,0x4A,0x54,0x6B,0x9C,0xD6,0x9C,0xD6,0x7C,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x7B,0xD6,0x16,0x8C,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x37,0x9D,0x37,0x9D,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0x71,0x42,0x72,0x42,0xFA,0xBD,0x9C,0xD6,0x99,0xAD,0x92,0x52,0x52,0x4A,0x52,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0xCF,0x49,0xCF,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_1_213131_data_1, "face_75_2_dial_img_1_213131_data_1.bin");
         
 
 
@@ -88,40 +35,13 @@ const lv_img_dsc_t face_75_2_dial_img_1_213131_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_1_213131_data_1),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_1_213131_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_1_213131_data_2[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x21,0x8B,0x21,0x7A,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD6,0x9C,0xB6,0x9C,0xB6,0x9C,0x95,0x9C,
-	0xF4,0x83,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0xCD,0x29,0x7B,0xCE,0xDC,0xDE,0x72,0x63,0x72,0x63,0x95,0x8C,0xFF,0xFF,0x72,0x6B,0x52,0x6B,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xD7,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5A,0xCE,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x34,0x7C,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x7B,0xCE,0x7B,0xCE,0xF1,0x5A,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x32,0x0E,0x32,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0x72,0x63,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x90,0x52,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0E,0x2A,0xED,0x29,0xED,0x29,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0xF6,0x9C,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,
-	0xCE,0x39,0xCE,0x39,0xAE,0x39,0x14,0x84,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD6,0x9C,0xD7,0x9C,0x70,0x52,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x32,0x0E,0x32,0xEE,0x31,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,
-	0x14,0x84,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x7B,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x32,0x73,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x9B,0xCE,0x9B,0xCE,0xF1,0x52,0x17,0x9D,0x17,0x9D,
-	0xF7,0x9C,0xF6,0x9C,0xF6,0x9C,0xCD,0x31,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xAD,0x39,0xAD,0x39,0xAD,0x39,0xAD,0x39,0xAE,0x39,0xAE,0x41,0xCF,0x41,0xCF,0x41,0xCF,0x49,0xCF,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x9B,0xCE,0xDA,0xB5,
-	0xB4,0x6B,0xFF,0xFF,0x9B,0xCE,0x9B,0xCE,0x3D,0xE7,0xFF,0xFF,0xCE,0x39,0xFF,0xFF,0xD6,0x9C,0xAD,0x31,0xAD,0x39,0xCE,0x39,0xCF,0x41,0xCF,0x41,0xF0,0x41,0xF0,0x49,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0x4F,0x3A,0xFF,0xFF,0x37,0x9D,0xB3,0x6B,0xFF,0xFF,0x2F,0x3A,0x30,0x3A,0x18,0x9D,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0xF7,0xA4,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xF0,0x41,0xF0,0x41,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x4F,0x32,0x14,0x74,0xFF,0xFF,0x14,0x74,0xB3,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x42,0xFF,0xFF,0x39,0xA5,0x72,0x4A,0xF3,0x62,0x18,0xA5,0xF8,0xA4,0xF7,0xA4,0xF8,0xA4,0xF8,0xA4,0xF8,0xA4,0xF8,0xA4,0xF7,0xA4,0xF8,0xA4,0xF8,0xA4,0xF8,0xA4,0x54,0x7B,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x9B,0xCE,0xBE,0xF7,0x90,0x42,0x90,0x42,0x93,0x6B,0x93,0x6B,0x93,0x6B,0xB4,0x73,0x9C,0xD6,0x99,0xAD,0xFF,0xFF,0x77,0x8C,0x52,0x4A,0xB5,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xA4,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x37,0x9D,0x37,0x9D,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0x71,0x42,0x72,0x42,0xFA,0xBD,0x9C,0xD6,0x99,0xAD,0x92,0x52,0x52,0x4A,0x52,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0xCF,0x49,0xCF,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_1_213131_data_2, "face_75_2_dial_img_1_213131_data_2.bin");
         
 
 
@@ -129,40 +49,13 @@ const lv_img_dsc_t face_75_2_dial_img_1_213131_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_1_213131_data_2),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_1_213131_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_1_213131_data_3[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x21,0x8B,0x21,0x7A,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x38,0xAD,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xD6,0x7B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5A,0xCE,
-	0x5A,0xCE,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0xCD,0x29,0x7B,0xCE,0xDC,0xDE,0x72,0x63,0x72,0x63,0x95,0x8C,0xFF,0xFF,0x72,0x6B,0x52,0x6B,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x7B,0xCE,0x9E,0xF7,0x7B,0xCE,0x3D,0xEF,0x9E,0xF7,0x5B,0xCE,0x9E,0xF7,
-	0x9E,0xF7,0x7B,0xD6,0x3D,0xEF,0xFF,0xFF,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x34,0x7C,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x7B,0xCE,0x7B,0xCE,0xF1,0x5A,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x7B,0xCE,0x7B,0xCE,0xAE,0x39,0xD7,0x9C,
-	0x5B,0xCE,0xAE,0x39,0x5B,0xCE,0x5B,0xCE,0x8E,0x41,0xD7,0xA4,0xFF,0xFF,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x32,0x0E,0x32,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0x72,0x63,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x90,0x52,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x7B,0xCE,
-	0x7B,0xCE,0xAE,0x39,0xD7,0x9C,0x5B,0xCE,0xAE,0x39,0x5B,0xCE,0x5B,0xCE,0x8E,0x41,0xD7,0xA4,0xFF,0xFF,0x8E,0x41,0x8E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0E,0x2A,0xED,0x29,0xED,0x29,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0xF6,0x9C,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,
-	0xCE,0x39,0xCE,0x39,0x7B,0xCE,0x7B,0xCE,0xAE,0x39,0xFA,0xC5,0x5B,0xCE,0xAE,0x39,0x5B,0xCE,0x5B,0xCE,0x8D,0x39,0xD7,0x9C,0xFF,0xFF,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x32,0x0E,0x32,0xEE,0x31,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,
-	0x14,0x84,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x7B,0xCE,0x7B,0xCE,0xAE,0x39,0x3D,0xEF,0xFA,0xC5,0x8D,0x39,0x7B,0xCE,0x5B,0xCE,0x8E,0x41,0xD7,0xA4,0xFF,0xFF,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x9B,0xCE,0x9B,0xCE,0xF1,0x52,0x17,0x9D,0x17,0x9D,
-	0xF7,0x9C,0xF6,0x9C,0xF6,0x9C,0xCD,0x31,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xAD,0x39,0x7B,0xCE,0x7B,0xCE,0x99,0xB5,0xFF,0xFF,0x52,0x73,0xCF,0x41,0xB9,0xBD,0xFF,0xFF,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x9B,0xCE,0xDA,0xB5,
-	0xB4,0x6B,0xFF,0xFF,0x9B,0xCE,0x9B,0xCE,0x3D,0xE7,0xFF,0xFF,0xCE,0x39,0xFF,0xFF,0xD6,0x9C,0xAD,0x31,0xAD,0x39,0x7B,0xCE,0x9E,0xF7,0xFF,0xFF,0x59,0xAD,0xF0,0x49,0xF0,0x49,0xF3,0x6A,0x1B,0xC6,0x7B,0xD6,0x3D,0xEF,0xFF,0xFF,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0x4F,0x3A,0xFF,0xFF,0x37,0x9D,0xB3,0x6B,0xFF,0xFF,0x2F,0x3A,0x30,0x3A,0x18,0x9D,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0xF7,0xA4,0xEF,0x41,0xEF,0x41,0x7B,0xD6,0x7B,0xD6,0x74,0x73,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xCF,0x49,0xD0,0x49,0xF8,0xA4,0xFF,0xFF,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x4F,0x32,0x14,0x74,0xFF,0xFF,0x14,0x74,0xB3,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x42,0xFF,0xFF,0x39,0xA5,0x72,0x4A,0x52,0x4A,0x9C,0xD6,0xDC,0xDE,0x53,0x73,0x53,0x73,0x54,0x73,0x54,0x73,0x54,0x73,0x54,0x73,0x54,0x73,0xBA,0xBD,0xFF,0xFF,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x9B,0xCE,0xBE,0xF7,0x90,0x42,0x90,0x42,0x93,0x6B,0x93,0x6B,0x93,0x6B,0xB4,0x73,0x9C,0xD6,0x99,0xAD,0xFF,0xFF,0x77,0x8C,0x52,0x4A,0x52,0x4A,0x9C,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x49,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x37,0x9D,0x37,0x9D,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0x71,0x42,0x72,0x42,0xFA,0xBD,0x9C,0xD6,0x99,0xAD,0x92,0x52,0x52,0x4A,0x52,0x4A,0x54,0x6B,0xB5,0x7B,0xB5,0x7B,0xB5,0x7B,0xB5,0x7B,0x74,0x73,0x53,0x73,0x53,0x73,0x54,0x73,
-	0x54,0x7B,0x54,0x7B,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_1_213131_data_3, "face_75_2_dial_img_1_213131_data_3.bin");
         
 
 
@@ -170,40 +63,13 @@ const lv_img_dsc_t face_75_2_dial_img_1_213131_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_1_213131_data_3),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_1_213131_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_1_213131_data_4[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x21,0x8B,0x21,0x7A,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x38,0xAD,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x5B,0xCE,0x7B,0xD6,0x7B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5A,0xCE,
-	0x5A,0xCE,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0xCD,0x29,0x7B,0xCE,0xDC,0xDE,0x72,0x63,0x72,0x63,0x95,0x8C,0xFF,0xFF,0x72,0x6B,0x52,0x6B,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x38,0xAD,0x7B,0xCE,0x7B,0xCE,0x3D,0xEF,0xFF,0xFF,0xDC,0xDE,0x7B,0xD6,
-	0x7B,0xD6,0x7B,0xD6,0x5B,0xCE,0x5B,0xCE,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x34,0x7C,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x7B,0xCE,0x7B,0xCE,0xF1,0x5A,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xD7,0x9C,
-	0xFF,0xFF,0x0F,0x4A,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x32,0x0E,0x32,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0x72,0x63,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x90,0x52,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0xFA,0xC5,0x3D,0xEF,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0E,0x2A,0xED,0x29,0xED,0x29,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0xF6,0x9C,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,
-	0xCE,0x39,0xCE,0x39,0xD7,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5B,0xCE,0x8E,0x41,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x32,0x0E,0x32,0xEE,0x31,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,
-	0x14,0x84,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xD7,0x9C,0xD7,0x9C,0xFF,0xFF,0x7B,0xCE,0xD6,0x9C,0xD6,0x9C,0xD6,0x9C,0x9E,0xF7,0x7B,0xD6,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x9B,0xCE,0x9B,0xCE,0xF1,0x52,0x17,0x9D,0x17,0x9D,
-	0xF7,0x9C,0xF6,0x9C,0xF6,0x9C,0xCD,0x31,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xAD,0x39,0xAD,0x39,0xAD,0x39,0xF1,0x5A,0xFF,0xFF,0x14,0x84,0xCF,0x41,0xCF,0x41,0xCF,0x49,0xFF,0xFF,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x9B,0xCE,0xDA,0xB5,
-	0xB4,0x6B,0xFF,0xFF,0x9B,0xCE,0x9B,0xCE,0x3D,0xE7,0xFF,0xFF,0xCE,0x39,0xFF,0xFF,0xD6,0x9C,0xAD,0x31,0xAD,0x39,0xCE,0x39,0xCF,0x41,0x16,0x8C,0xFF,0xFF,0x74,0x73,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xFF,0xFF,0x59,0xB5,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0x4F,0x3A,0xFF,0xFF,0x37,0x9D,0xB3,0x6B,0xFF,0xFF,0x2F,0x3A,0x30,0x3A,0x18,0x9D,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0xF7,0xA4,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xF0,0x41,0xF8,0xA4,0xFF,0xFF,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xCF,0x49,0xFF,0xFF,0xF8,0xA4,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x4F,0x32,0x14,0x74,0xFF,0xFF,0x14,0x74,0xB3,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x42,0xFF,0xFF,0x39,0xA5,0x72,0x4A,0xF3,0x62,0x18,0xA5,0xF8,0xA4,0x3D,0xE7,0x9E,0xF7,0xF8,0xA4,0xF8,0xA4,0xF8,0xA4,0xF7,0xA4,0xFF,0xFF,0x7B,0xD6,0xF8,0xA4,0x54,0x7B,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x9B,0xCE,0xBE,0xF7,0x90,0x42,0x90,0x42,0x93,0x6B,0x93,0x6B,0x93,0x6B,0xB4,0x73,0x9C,0xD6,0x99,0xAD,0xFF,0xFF,0x77,0x8C,0x52,0x4A,0xB5,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0xA4,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x37,0x9D,0x37,0x9D,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0x71,0x42,0x72,0x42,0xFA,0xBD,0x9C,0xD6,0x99,0xAD,0x92,0x52,0x52,0x4A,0x52,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0xCF,0x49,0xCF,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_1_213131_data_4, "face_75_2_dial_img_1_213131_data_4.bin");
         
 
 
@@ -211,40 +77,13 @@ const lv_img_dsc_t face_75_2_dial_img_1_213131_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_1_213131_data_4),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_1_213131_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_1_213131_data_5[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0xF1,0x5A,0xF4,0x83,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x21,0x7A,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x76,0x94,0xFF,0xFF,0x32,0x6B,0x8D,0x39,0x8D,0x39,0x4C,0x39,0x2B,0x31,
-	0x2B,0x31,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0x7B,0xCE,0xDC,0xDE,0x92,0x63,0x72,0x63,0x95,0x8C,0xFF,0xFF,0x72,0x6B,0x72,0x6B,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x70,0x52,0xFF,0xFF,0xD7,0x9C,0xAE,0x41,
-	0x8E,0x41,0x8E,0x41,0x6D,0x41,0x4C,0x39,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x34,0x7C,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x7B,0xCE,0x7B,0xCE,0xF1,0x5A,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xF1,0x5A,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,
-	0xFF,0xFF,0x9E,0xF7,0x5B,0xCE,0x5B,0xCE,0x5B,0xCE,0x7B,0xD6,0x14,0x84,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x72,0x63,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x90,0x52,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xF1,0x5A,0x7B,0xCE,0x7B,0xCE,
-	0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5B,0xCE,0x7B,0xD6,0xF4,0x83,0x8E,0x41,0x8E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0E,0x2A,0xED,0x29,0xED,0x29,0x7B,0xCE,0x7B,0xCE,0xF6,0x9C,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,
-	0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0x70,0x52,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x0F,0x4A,0x8E,0x41,0x8D,0x39,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x34,0x84,
-	0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x70,0x52,0xFF,0xFF,0xD7,0x9C,0x8D,0x39,0x32,0x6B,0x9E,0xF7,0xD6,0x9C,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x9B,0xCE,0x9B,0xCE,0xF1,0x52,0x17,0x9D,0x17,0x9D,0x17,0x9D,
-	0xF7,0x9C,0xF6,0x9C,0xCD,0x31,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xAD,0x39,0xAD,0x39,0x99,0xB5,0xFF,0xFF,0x52,0x6B,0xAE,0x41,0xCF,0x41,0x7B,0xD6,0xFF,0xFF,0xF3,0x6A,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x9B,0xCE,0xDA,0xB5,0xB4,0x6B,
-	0xFF,0xFF,0x9B,0xCE,0x9B,0xCE,0x3D,0xE7,0xFF,0xFF,0xEF,0x39,0xFF,0xFF,0xF7,0x9C,0xAD,0x31,0xAD,0x31,0xAD,0x39,0x70,0x52,0xFF,0xFF,0x7B,0xD6,0xF0,0x41,0xF0,0x49,0xF0,0x49,0xF3,0x6A,0xFF,0xFF,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0xFF,0xFF,0x37,0x9D,0xB3,0x6B,0xFF,0xFF,0x2F,0x3A,0x2F,0x3A,0x18,0x9D,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0xF7,0xA4,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xB9,0xBD,0xFF,0xFF,0x74,0x73,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x59,0xB5,0xFF,0xFF,0x16,0x8C,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x14,0x74,0xFF,0xFF,0x14,0x74,0xB3,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0x18,0xA5,0x72,0x4A,0x72,0x4A,0xB5,0x7B,0xFF,0xFF,0xBA,0xBD,0xCF,0x41,0xCF,0x41,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x30,0x52,0x9E,0xF7,0x3D,0xEF,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x9B,0xCE,0xBE,0xF7,0x90,0x42,0x90,0x42,0xB3,0x6B,0x93,0x6B,0x93,0x6B,0x93,0x6B,0x9C,0xCE,0x99,0xAD,0xFF,0xFF,0x77,0x8C,0x51,0x4A,0x92,0x52,0x5E,0xEF,0xBF,0xF7,0x92,0x52,0x11,0x4A,0xF0,0x49,0xCF,0x41,0xCF,0x41,0xCF,0x49,0xCF,0x49,0xF8,0xA4,0xFF,0xFF,0x16,0x8C,0xD0,0x49,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x37,0x9D,0x37,0x9D,0x4F,0x3A,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0x71,0x42,0xFA,0xBD,0x9C,0xD6,0x99,0xAD,0x92,0x52,0x51,0x4A,0x52,0x4A,0xD8,0x9C,0x16,0x8C,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0xCF,0x49,0xCF,0x49,0x30,0x52,
-	0xF8,0xA4,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_1_213131_data_5, "face_75_2_dial_img_1_213131_data_5.bin");
         
 
 
@@ -252,40 +91,13 @@ const lv_img_dsc_t face_75_2_dial_img_1_213131_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_1_213131_data_5),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_1_213131_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_1_213131_data_6[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x21,0x8B,0x21,0x7A,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x38,0xAD,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xD6,0x7B,0xCE,0x5B,0xCE,0x5B,0xCE,0x5A,0xCE,
-	0x8F,0x5A,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0xCD,0x29,0x7B,0xCE,0xDC,0xDE,0x72,0x63,0x72,0x63,0x95,0x8C,0xFF,0xFF,0x72,0x6B,0x52,0x6B,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x7B,0xCE,0x9E,0xF7,0x7B,0xCE,0x5B,0xCE,0x5B,0xCE,0x7B,0xD6,
-	0x7B,0xD6,0xDC,0xDE,0xFF,0xFF,0xF1,0x6A,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x0E,0x32,0x7B,0xCE,0x7B,0xCE,0x34,0x7C,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x7B,0xCE,0x7B,0xCE,0xF1,0x5A,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x7B,0xCE,0x7B,0xCE,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x32,0x73,0xFF,0xFF,0x32,0x73,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x32,0x0E,0x32,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0x72,0x63,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x90,0x52,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,
-	0x7B,0xCE,0x7B,0xCE,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x41,0x32,0x73,0xFF,0xFF,0x32,0x73,0x8E,0x41,0x8E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0E,0x2A,0xED,0x29,0xED,0x29,0xED,0x31,0x7B,0xCE,0x7B,0xCE,0xF6,0x9C,0xF6,0x9C,0xB9,0xB5,0xFF,0xFF,0xF6,0x9C,0xF6,0x9C,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,
-	0xCE,0x39,0xCE,0x39,0xAE,0x39,0x7B,0xCE,0xDC,0xDE,0x32,0x6B,0x32,0x6B,0x32,0x6B,0x32,0x6B,0x32,0x73,0x76,0x94,0xFF,0xFF,0x32,0x73,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x32,0x0E,0x32,0xEE,0x31,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,
-	0x14,0x84,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x7B,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x32,0x73,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x9B,0xCE,0x9B,0xCE,0xF1,0x52,0x17,0x9D,0x17,0x9D,
-	0xF7,0x9C,0xF6,0x9C,0xF6,0x9C,0xCD,0x31,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xAD,0x39,0xAD,0x39,0x7B,0xCE,0xDC,0xDE,0x52,0x6B,0x52,0x73,0x53,0x73,0x53,0x73,0x53,0x73,0x77,0x9C,0xFF,0xFF,0x54,0x7B,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x9B,0xCE,0xDA,0xB5,
-	0xB4,0x6B,0xFF,0xFF,0x9B,0xCE,0x9B,0xCE,0x3D,0xE7,0xFF,0xFF,0xCE,0x39,0xFF,0xFF,0xD6,0x9C,0xAD,0x31,0xAD,0x39,0xCE,0x39,0x7B,0xCE,0x7B,0xD6,0xF0,0x41,0xF0,0x49,0xF0,0x49,0xD0,0x49,0xD0,0x49,0x54,0x7B,0xFF,0xFF,0x54,0x7B,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0x4F,0x3A,0xFF,0xFF,0x37,0x9D,0xB3,0x6B,0xFF,0xFF,0x2F,0x3A,0x30,0x3A,0x18,0x9D,0xFF,0xFF,0x0F,0x3A,0xFF,0xFF,0xF7,0xA4,0xEF,0x41,0xEF,0x41,0xEF,0x41,0x7B,0xD6,0x7C,0xD6,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xCF,0x49,0x54,0x73,0xFF,0xFF,0x54,0x7B,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x4F,0x32,0x14,0x74,0xFF,0xFF,0x14,0x74,0xB3,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x42,0xFF,0xFF,0x39,0xA5,0x72,0x4A,0x52,0x4A,0x11,0x4A,0x7B,0xD6,0xDC,0xDE,0x53,0x73,0x54,0x73,0x54,0x73,0x54,0x73,0x54,0x73,0x77,0x9C,0xFF,0xFF,0x54,0x7B,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x9B,0xCE,0xBE,0xF7,0x90,0x42,0x90,0x42,0x93,0x6B,0x93,0x6B,0x93,0x6B,0xB4,0x73,0x9C,0xD6,0x99,0xAD,0xFF,0xFF,0x77,0x8C,0x52,0x4A,0x52,0x4A,0x52,0x4A,0x9C,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0x7B,0xD0,0x49,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x37,0x9D,0x37,0x9D,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0x71,0x42,0x72,0x42,0xFA,0xBD,0x9C,0xD6,0x99,0xAD,0x92,0x52,0x52,0x4A,0x52,0x4A,0x32,0x4A,0x54,0x6B,0xB5,0x7B,0xB5,0x7B,0xB5,0x7B,0x74,0x73,0x53,0x73,0x53,0x73,0x54,0x73,
-	0x54,0x7B,0x30,0x52,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_1_213131_data_6, "face_75_2_dial_img_1_213131_data_6.bin");
         
 
 
@@ -293,7 +105,7 @@ const lv_img_dsc_t face_75_2_dial_img_1_213131_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_1_213131_data_6),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_1_213131_data_6};
 
@@ -5,6 +5,7 @@
 // Watchface: 75_2
 
 #include "../75_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,34 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_2_216824_data_0[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xF3,0x73,0x7A,0xCE,0x7A,0xCE,0x6E,0x42,0xAB,0x21,0x8B,0x21,0xAB,0x29,0xCD,0x29,0xCD,0x31,0xF6,0x9C,0x7B,0xCE,0x7B,0xCE,0xEE,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0x34,0x84,0x3D,0xE7,0xFF,0xFF,0xFF,0xFF,0xDC,0xDE,0xB3,0x7B,0xAE,0x39,0xAE,0x41,0xAE,0x39,0x8D,0x39,0x17,0xAD,0x5A,0xCE,0xD1,0x62,
-	0x2B,0x31,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x17,0xAD,0x17,0xAD,0xD5,0x94,0xFF,0xFF,0xFF,0xFF,0x34,0x84,0xAB,0x29,0xCD,0x29,0xED,0x31,0x0E,0x32,0xEE,0x31,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xB9,0xB5,0xFF,0xFF,0x7B,0xCE,0xF7,0x9C,0xD7,0x9C,0x3D,0xE7,0xFF,0xFF,0x34,0x84,0xAE,0x39,0xAE,0x39,0xAE,0x41,
-	0x5B,0xD6,0xFF,0xFF,0x3D,0xE7,0xCD,0x41,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x5A,0xCE,0x5A,0xCE,0xD5,0x94,0xFF,0xFF,0xFF,0xFF,0xDC,0xD6,0x0E,0x32,0x0E,0x32,0xED,0x31,0xED,0x31,0x34,0x84,0xFF,0xFF,0x9E,0xF7,0xFF,0xFF,0xCD,0x31,0xCD,0x31,0x52,0x6B,0xFF,0xFF,0x1A,0xC6,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x2F,0x42,0xDC,0xDE,0xFF,0xFF,
-	0x90,0x52,0xAE,0x39,0x8E,0x39,0x7B,0xCE,0xFF,0xFF,0xFF,0xFF,0x38,0xAD,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x5A,0xCE,0x5A,0xCE,0xD5,0x94,0xFF,0xFF,0x7B,0xCE,0xFF,0xFF,0x31,0x5B,0xED,0x31,0xED,0x31,0xED,0x31,0x1A,0xC6,0x3D,0xE7,0x7B,0xCE,0xFF,0xFF,0xCD,0x31,0xCD,0x31,0x1A,0xC6,0xFF,0xFF,0x90,0x52,0xCE,0x39,0xCE,0x39,0xAE,0x39,
-	0xAE,0x39,0xB3,0x7B,0xFF,0xFF,0x38,0xAD,0x8E,0x39,0x8E,0x39,0x7B,0xCE,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x32,0x73,0x6E,0x41,0x4C,0x39,0x5A,0xCE,0x5A,0xCE,0xD5,0x94,0xFF,0xFF,0x34,0x84,0xFF,0xFF,0x58,0xA5,0xED,0x29,0xED,0x29,0x4E,0x3A,0xFF,0xFF,0xF6,0x9C,0x7B,0xCE,0xFF,0xFF,0xCD,0x31,0xCD,0x31,0x9E,0xF7,0xDC,0xDE,0xCE,0x39,
-	0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0xAE,0x39,0x8E,0x39,0x7B,0xCE,0x7B,0xCE,0xD1,0x62,0xFF,0xFF,0x3D,0xE7,0x6E,0x41,0x6E,0x41,0x5B,0xCE,0x5A,0xCE,0x17,0x9D,0xFF,0xFF,0x92,0x63,0xDC,0xD6,0x3D,0xE7,0xED,0x31,0xED,0x31,0x34,0x84,0xFF,0xFF,0x90,0x52,0x7B,0xCE,0xFF,0xFF,0xCD,0x31,0xCD,0x31,
-	0xFF,0xFF,0x7B,0xCE,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0x8D,0x39,0x8D,0x39,0x7B,0xCE,0x7B,0xCE,0x8E,0x41,0xD6,0x9C,0xFF,0xFF,0xD7,0xA4,0x6E,0x41,0x5B,0xD6,0x5B,0xD6,0x37,0x9D,0xFF,0xFF,0xB3,0x6B,0xD6,0x8C,0xFF,0xFF,0x52,0x5B,0x4F,0x3A,0x3A,0xC6,0xFC,0xDE,0x0F,0x3A,0x7B,0xCE,
-	0xFF,0xFF,0xCD,0x31,0xAD,0x31,0xFF,0xFF,0x7B,0xCE,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0xAD,0x39,0xAD,0x39,0xFF,0xFF,0x7B,0xCE,0xCF,0x41,0xCF,0x41,0x7B,0xD6,0x7B,0xD6,0xCF,0x49,0xD0,0x49,0xDC,0xDE,0xFF,0xFF,0xF3,0x6A,0x7B,0xD6,0x7C,0xD6,0x37,0x9D,0xFF,0xFF,0xB3,0x6B,0x11,0x53,0xFF,0xFF,0x98,0xAD,0x11,0x53,0xFF,0xFF,
-	0xB7,0x94,0x2F,0x3A,0x9B,0xCE,0xFF,0xFF,0x0F,0x3A,0xEF,0x39,0xDC,0xDE,0x9E,0xF7,0xAD,0x31,0xAD,0x31,0xAD,0x39,0xCE,0x39,0xCF,0x41,0x92,0x62,0xFF,0xFF,0x1A,0xC6,0xF0,0x49,0xD0,0x49,0x7C,0xD6,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xF3,0x6A,0xFF,0xFF,0xDC,0xDE,0x7B,0xD6,0x7B,0xD6,0x37,0x9D,0xFF,0xFF,0xB3,0x6B,0x6F,0x32,0x3A,0xC6,
-	0xBE,0xF7,0xD6,0x8C,0xFF,0xFF,0x11,0x53,0x2F,0x3A,0x9B,0xCE,0xFF,0xFF,0x30,0x3A,0x30,0x42,0x17,0x9D,0xFF,0xFF,0x16,0x8C,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xF0,0x41,0xF8,0xA4,0xFF,0xFF,0x16,0x8C,0xD0,0x49,0xD0,0x49,0x7B,0xD6,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xF8,0xA4,0xFF,0xFF,0xFF,0xFF,0x7B,0xD6,0x37,0x9D,0xFF,0xFF,
-	0xB3,0x6B,0x4F,0x32,0x75,0x84,0xFF,0xFF,0xFF,0xFF,0x3A,0xC6,0x2F,0x3A,0x2F,0x3A,0x9B,0xCE,0xFF,0xFF,0x0F,0x3A,0x0F,0x3A,0x91,0x4A,0xBF,0xF7,0xBF,0xF7,0xB5,0x7B,0x52,0x4A,0x11,0x4A,0x97,0x9C,0xFF,0xFF,0xDC,0xDE,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x7B,0xD6,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xDC,0xDE,0xFF,0xFF,
-	0x7B,0xD6,0x37,0x9D,0xFF,0xFF,0xB3,0x6B,0x4F,0x32,0x90,0x42,0xFF,0xFF,0xFF,0xFF,0x75,0x84,0x2F,0x3A,0x2F,0x3A,0x9B,0xCE,0xFF,0xFF,0x30,0x42,0x71,0x42,0x72,0x4A,0x74,0x6B,0x5E,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xD6,0x30,0x52,0xCF,0x41,0xCF,0x41,0xCF,0x49,0x7B,0xD6,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,
-	0xB0,0x49,0xF3,0x6A,0xFF,0xFF,0x7B,0xD6,0x11,0x53,0xB3,0x6B,0x90,0x42,0x6F,0x32,0x4F,0x32,0x52,0x5B,0xB3,0x6B,0x90,0x42,0x2F,0x3A,0x30,0x3A,0x73,0x63,0xD5,0x73,0x72,0x42,0x72,0x4A,0x51,0x4A,0x51,0x4A,0x51,0x4A,0x16,0x8C,0x39,0xA5,0x39,0xA5,0xB5,0x7B,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0xCF,0x49,0xF2,0x62,0xF3,0x6A,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xF3,0x6A,0xF3,0x6A,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_2_216824_data_0, "face_75_2_dial_img_2_216824_data_0.bin");
         
 
 
@@ -47,40 +21,13 @@ const lv_img_dsc_t face_75_2_dial_img_2_216824_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_2_216824_data_0),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_2_216824_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_2_216824_data_1[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0x7A,0xCE,0x7A,0xCE,0x7A,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x58,0xA5,0xEE,0x31,0x34,0x84,0x7B,0xCE,0xF1,0x5A,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x34,0x84,0x7B,0xCE,0xD1,0x62,0xAE,0x39,0xAE,0x39,0x7B,0xCE,0x5B,0xCE,0x5A,0xCE,0x5A,0xCE,
-	0x5A,0xCE,0x5A,0xCE,0xD3,0x83,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xD5,0x94,0xF6,0x94,0xF6,0x9C,0xFF,0xFF,0x3D,0xE7,0xF6,0x9C,0xF6,0x9C,0x34,0x84,0xCD,0x31,0xF6,0x9C,0xFF,0xFF,0x52,0x6B,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xD7,0x9C,0xFF,0xFF,0x32,0x6B,0xAE,0x39,0xAE,0x39,0xFF,0xFF,
-	0x3D,0xE7,0xD7,0xA4,0xD6,0x9C,0xB6,0x9C,0xB6,0x9C,0xD1,0x62,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x0E,0x32,0xED,0x31,0xFF,0xFF,0x7B,0xCE,0xED,0x31,0xED,0x31,0xCD,0x31,0xCD,0x31,0xF6,0x9C,0xFF,0xFF,0x52,0x6B,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xD7,0x9C,0xFF,0xFF,0x32,0x6B,
-	0xAE,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x2A,0x0E,0x32,0xED,0x31,0xED,0x31,0xFF,0xFF,0x7B,0xCE,0xED,0x31,0xED,0x31,0xCD,0x31,0xCD,0x31,0xF6,0x9C,0xFF,0xFF,0x52,0x6B,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,
-	0xD7,0x9C,0xFF,0xFF,0x32,0x6B,0xAE,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0D,0x2A,0xED,0x29,0xED,0x29,0xED,0x29,0xED,0x29,0xFF,0xFF,0x7B,0xCE,0xED,0x31,0xED,0x31,0xCD,0x31,0xCD,0x31,0xF6,0x9C,0xFF,0xFF,0x52,0x6B,0xCE,0x39,
-	0xCE,0x39,0xCE,0x39,0xAE,0x39,0xD7,0x9C,0xFF,0xFF,0x32,0x6B,0xAE,0x39,0xAE,0x39,0xFF,0xFF,0xDC,0xDE,0x32,0x6B,0x32,0x73,0x32,0x73,0x32,0x73,0xEF,0x51,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x2A,0x0E,0x32,0xED,0x31,0xED,0x31,0xFF,0xFF,0x7B,0xCE,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xF6,0x9C,
-	0xFF,0xFF,0x52,0x6B,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xD7,0x9C,0xFF,0xFF,0x32,0x6B,0x8D,0x39,0x8D,0x39,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x32,0x73,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0xFF,0xFF,0x9B,0xCE,0x0F,0x3A,0x0E,0x3A,
-	0xEE,0x31,0xCD,0x31,0xF6,0x9C,0xFF,0xFF,0x52,0x6B,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0xD6,0x9C,0xFF,0xFF,0x32,0x6B,0xAE,0x41,0xCF,0x41,0xFF,0xFF,0xDC,0xDE,0x54,0x73,0x54,0x73,0x54,0x7B,0x54,0x7B,0x30,0x52,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xFF,0xFF,
-	0x9B,0xCE,0x2F,0x3A,0x30,0x3A,0x30,0x3A,0x0F,0x3A,0xF7,0x9C,0xFF,0xFF,0x52,0x6B,0xAD,0x31,0xAD,0x31,0xAD,0x39,0xCE,0x39,0xD7,0xA4,0xFF,0xFF,0x73,0x73,0xF0,0x49,0xF0,0x49,0xFF,0xFF,0x7C,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0x4F,0x3A,0x4F,0x3A,0xFF,0xFF,0x9B,0xCE,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x30,0x3A,0xF5,0x83,0xFF,0xFF,0x75,0x84,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xEF,0x41,0xBA,0xBD,0xFF,0xFF,0x13,0x6B,0xD0,0x49,0xD0,0x49,0xFF,0xFF,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0xFF,0xFF,0x9B,0xCE,0x2F,0x3A,0x2F,0x3A,0x2F,0x3A,0x0F,0x3A,0x0F,0x3A,0x5E,0xEF,0xBF,0xF7,0xB5,0x7B,0x72,0x4A,0x52,0x4A,0xB7,0x94,0xFF,0xFF,0x7B,0xD6,0xCF,0x41,0xD0,0x49,0xD0,0x49,0xFF,0xFF,0xDC,0xDE,0x54,0x73,0x54,0x7B,0x54,0x7B,0x54,0x7B,0x92,0x62,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0xFF,0xFF,0x9B,0xCE,0x2F,0x3A,0x0F,0x3A,0x2F,0x3A,0x30,0x42,0x71,0x42,0x74,0x6B,0x5E,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDD,0xDE,0xF2,0x62,0xF0,0x41,0xCF,0x41,0xCF,0x41,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xF8,0xA4,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x93,0x6B,0x52,0x5B,0x30,0x3A,0x50,0x3A,0x71,0x42,0x72,0x42,0x72,0x4A,0x51,0x4A,0x51,0x4A,0x16,0x8C,0x39,0xA5,0x39,0xA5,0x16,0x8C,0x52,0x4A,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0x54,0x73,0x54,0x73,0x54,0x73,
-	0x54,0x7B,0x54,0x7B,0x54,0x7B,0x92,0x62,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_2_216824_data_1, "face_75_2_dial_img_2_216824_data_1.bin");
         
 
 
@@ -88,40 +35,13 @@ const lv_img_dsc_t face_75_2_dial_img_2_216824_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_2_216824_data_1),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_2_216824_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_2_216824_data_2[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2C,0x32,0x7A,0xCE,0x37,0x9D,0xAB,0x29,0xAB,0x21,0x8B,0x21,0xAB,0x29,0x7B,0xCE,0x7B,0xCE,0xED,0x31,0xEE,0x31,0xEE,0x31,0xEE,0x31,0xB9,0xB5,0x1A,0xC6,0xCE,0x39,0xF1,0x5A,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0xD1,0x62,0x8E,0x39,0xD1,0x62,0x5B,0xCE,0x5A,0xCE,0x5A,0xCE,
-	0x5A,0xCE,0x5A,0xCE,0x17,0xAD,0xEF,0x51,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xDC,0xD6,0xFF,0xFF,0xAB,0x21,0xAB,0x29,0xCD,0x29,0x72,0x63,0xFF,0xFF,0xFF,0xFF,0x31,0x5B,0xED,0x31,0xCD,0x31,0xCD,0x31,0xFF,0xFF,0xB9,0xB5,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0x7B,0xCE,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0xD7,0x9C,0x90,0x52,0xAE,0x39,0x32,0x73,
-	0xFF,0xFF,0x5B,0xD6,0xD6,0x9C,0xB6,0x9C,0xBC,0xDE,0xFF,0xFF,0x9E,0xF7,0x90,0x52,0x2B,0x39,0xCB,0x21,0x37,0x9D,0xFF,0xFF,0xF1,0x5A,0x0E,0x32,0x0E,0x32,0xF6,0x9C,0x3D,0xE7,0xFF,0xFF,0x95,0x8C,0xED,0x31,0xCD,0x31,0x72,0x63,0xFF,0xFF,0x34,0x84,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0x32,0x6B,0xFF,0xFF,0xD6,0x9C,0x8E,0x41,0x8E,0x41,0x6D,0x41,0xD3,0x83,0xFF,0xFF,0x3D,0xE7,0x2B,0x39,0xAB,0x21,0x31,0x5B,0xFF,0xFF,0x95,0x8C,0x0E,0x32,0xED,0x31,0x7B,0xCE,0xB9,0xB5,0x7B,0xCE,0x1A,0xC6,0xED,0x31,0xCD,0x31,0xF6,0x9C,0xFF,0xFF,0x90,0x52,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xF7,0x9C,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x32,0x6B,0xFF,0xFF,0xD6,0x9C,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x79,0xB5,0xFF,0xFF,0xD1,0x62,0xCC,0x21,0x0D,0x2A,0xFF,0xFF,0xB9,0xB5,0xED,0x29,0x4E,0x3A,0xFF,0xFF,0x34,0x84,0xF6,0x9C,0x9E,0xF7,0xED,0x31,0xCD,0x31,0x7B,0xCE,0x3D,0xE7,0xCE,0x39,0xCE,0x39,0x52,0x6B,
-	0xFF,0xFF,0xB9,0xB5,0x52,0x6B,0x52,0x6B,0x52,0x6B,0x32,0x6B,0xAE,0x39,0xAE,0x39,0x32,0x6B,0xFF,0xFF,0xD6,0x9C,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x6E,0x41,0x32,0x73,0xFF,0xFF,0xB6,0x9C,0x2E,0x2A,0x0E,0x2A,0x7B,0xCE,0x3D,0xE7,0x0D,0x2A,0xF3,0x73,0xFF,0xFF,0x4E,0x3A,0x31,0x5B,0xFF,0xFF,0xF1,0x5A,0xCD,0x31,0x9E,0xF7,0xB9,0xB5,
-	0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x39,0x8D,0x39,0x32,0x6B,0xFF,0xFF,0xD6,0x9C,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x32,0x73,0xFF,0xFF,0xD6,0x9C,0x6F,0x32,0x6F,0x32,0x37,0x9D,0xFF,0xFF,0x11,0x53,0x98,0xAD,0xFC,0xDE,0x2F,0x3A,0x2F,0x3A,0x9E,0xF7,0x95,0x8C,
-	0x31,0x5B,0xFF,0xFF,0x34,0x84,0xAD,0x31,0xCD,0x39,0x52,0x6B,0xFF,0xFF,0xB9,0xB5,0x52,0x6B,0x52,0x6B,0x52,0x6B,0x32,0x6B,0xAE,0x41,0xCF,0x41,0x54,0x73,0xFF,0xFF,0xF8,0xA4,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0x54,0x7B,0xFF,0xFF,0xF8,0xA4,0x6F,0x32,0x6F,0x32,0xB3,0x6B,0xFF,0xFF,0x14,0x74,0xFC,0xDE,0x98,0xAD,0x4F,0x3A,
-	0x2F,0x3A,0x3A,0xC6,0x3A,0xC6,0xB7,0x94,0xFF,0xFF,0x2F,0x42,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xD6,0x9C,0xCE,0x39,0xCF,0x41,0xEF,0x41,0xF0,0x41,0xF0,0x49,0xF0,0x49,0x54,0x7B,0xFF,0xFF,0xF8,0xA4,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0x16,0x8C,0xFF,0xFF,0x16,0x8C,0x6F,0x32,0x6F,0x32,0x6F,0x32,0xBE,0xF7,0xB9,0xB5,
-	0xFF,0xFF,0x14,0x74,0x4F,0x3A,0x2F,0x3A,0xB7,0x94,0xFF,0xFF,0xBA,0xBD,0xFC,0xDE,0x30,0x42,0x2F,0x3A,0x0F,0x3A,0x73,0x73,0xFF,0xFF,0xF7,0x9C,0xEF,0x41,0xF0,0x41,0xF0,0x41,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x54,0x73,0xFF,0xFF,0xF8,0xA4,0xD0,0x49,0xD0,0x49,0xB0,0x49,0x30,0x52,0x3D,0xEF,0xFF,0xFF,0x30,0x52,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x3A,0xC6,0xFF,0xFF,0xFF,0xFF,0x90,0x42,0x4F,0x3A,0x2F,0x3A,0x52,0x5B,0xFF,0xFF,0xFF,0xFF,0x58,0xAD,0x0F,0x3A,0x30,0x42,0x51,0x4A,0xB5,0x7B,0xFF,0xFF,0xBA,0xBD,0x94,0x7B,0x73,0x73,0x73,0x73,0x73,0x73,0x30,0x52,0xD0,0x49,0x54,0x73,0xFF,0xFF,0xBA,0xBD,0x54,0x7B,0x54,0x7B,0xF5,0x83,0xDC,0xDE,0xFF,0xFF,0xF8,0xA4,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0xD6,0x8C,0xFF,0xFF,0x9B,0xCE,0x4F,0x3A,0x4F,0x3A,0x2F,0x3A,0x2F,0x3A,0x9E,0xF7,0xFF,0xFF,0xF5,0x83,0x71,0x42,0x72,0x4A,0x52,0x4A,0xB5,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x73,0x73,0xCF,0x41,0x54,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x9E,0xF7,0xF8,0xA4,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x90,0x42,0xB3,0x6B,0x11,0x53,0x4F,0x3A,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x73,0x63,0xD5,0x73,0xB2,0x52,0x72,0x4A,0x51,0x4A,0x51,0x4A,0xB2,0x52,0xB5,0x7B,0xB5,0x7B,0xB5,0x7B,0xB5,0x7B,0xB5,0x7B,0xB5,0x7B,0x72,0x5A,0xF0,0x49,0x30,0x52,0x54,0x73,0x54,0x73,
-	0x54,0x7B,0x54,0x7B,0x54,0x7B,0x30,0x52,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_2_216824_data_2, "face_75_2_dial_img_2_216824_data_2.bin");
         
 
 
@@ -129,40 +49,13 @@ const lv_img_dsc_t face_75_2_dial_img_2_216824_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_2_216824_data_2),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_2_216824_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_2_216824_data_3[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xCD,0x29,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0x8D,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x2B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0x7A,0xCE,0x7A,0xCE,0x7A,0xCE,0x7A,0xCE,0x7A,0xCE,0x7B,0xCE,0x7B,0xCE,0x58,0xA5,0xEE,0x31,0x31,0x5B,0x7B,0xCE,0x34,0x84,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xD1,0x62,0x7B,0xCE,0x34,0x84,0xAE,0x39,0xAE,0x39,0x7B,0xCE,0x38,0xAD,0x8D,0x39,0x4D,0x39,0x4C,0x39,0x2B,0x31,
-	0x2B,0x31,0x5A,0xCE,0x17,0xAD,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xD5,0x94,0xD5,0x94,0xD5,0x94,0xFF,0xFF,0x3D,0xE7,0x17,0x9D,0x17,0x9D,0x34,0x84,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xD7,0x9C,0xAE,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0xAE,0x41,
-	0x8E,0x41,0x8E,0x41,0x6D,0x41,0x4C,0x39,0xFF,0xFF,0x5A,0xCE,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0xFF,0xFF,0x7B,0xCE,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xD7,0x9C,0xAE,0x39,0xAE,0x39,
-	0xFF,0xFF,0x7B,0xCE,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0xFF,0xFF,0x5A,0xCE,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x2A,0x0E,0x32,0xFF,0xFF,0x7B,0xCE,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,
-	0xD7,0x9C,0xAE,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0xFF,0xFF,0x5B,0xD6,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0D,0x2A,0xED,0x29,0xED,0x29,0xFF,0xFF,0x7B,0xCE,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0x72,0x63,0xFF,0xFF,0xB9,0xB5,0x52,0x6B,0x52,0x6B,0x52,0x6B,
-	0x52,0x6B,0x75,0x94,0xFF,0xFF,0xD7,0x9C,0xAE,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0x8E,0x39,0x8E,0x41,0x6D,0x41,0x8E,0x41,0x8E,0x41,0xFF,0xFF,0x5B,0xD6,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x2A,0x0E,0x32,0xFF,0xFF,0x7B,0xCE,0xED,0x31,0xED,0x31,0xCD,0x31,0xCD,0x31,0x72,0x63,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x9C,0xAE,0x39,0xAD,0x39,0xFF,0xFF,0x7B,0xCE,0x8D,0x39,0x6D,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0xFF,0xFF,0x5B,0xD6,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0xFF,0xFF,0x9B,0xCE,0x2F,0x3A,0x2F,0x3A,0x0F,0x3A,0x0E,0x3A,
-	0x72,0x6B,0xFF,0xFF,0xB9,0xB5,0x72,0x63,0x52,0x6B,0x52,0x6B,0x52,0x6B,0x75,0x94,0xFF,0xFF,0xD6,0x9C,0xAD,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0xCF,0x41,0xCF,0x49,0xCF,0x49,0xCF,0x49,0xD0,0x49,0xFF,0xFF,0x7B,0xD6,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0xFF,0xFF,0x9B,0xCE,0x4F,0x3A,
-	0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x93,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCD,0x39,0xAD,0x31,0xAD,0x31,0x52,0x6B,0xFF,0xFF,0xD7,0xA4,0xEF,0x41,0xF0,0x41,0xFF,0xFF,0x7C,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xFF,0xFF,0x7B,0xD6,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0xFF,0xFF,0x9B,0xCE,0x4F,0x3A,0x2F,0x3A,0x2F,0x3A,0x2F,0x3A,0x93,0x6B,0xFF,0xFF,0x17,0x9D,0x0F,0x3A,0x0F,0x3A,0xEF,0x41,0xEF,0x41,0x73,0x73,0xFF,0xFF,0xF8,0xA4,0xF0,0x41,0xD0,0x49,0xDC,0xDE,0x3D,0xEF,0xD0,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0x92,0x62,0xFF,0xFF,0x1A,0xC6,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x4F,0x32,0xFF,0xFF,0x9B,0xCE,0x4F,0x3A,0x2F,0x3A,0x2F,0x3A,0x2F,0x3A,0x93,0x6B,0xFF,0xFF,0x17,0x9D,0x30,0x42,0x51,0x4A,0x72,0x4A,0x72,0x4A,0xB5,0x7B,0xFF,0xFF,0xF8,0xA4,0xEF,0x41,0xCF,0x41,0x16,0x8C,0xFF,0xFF,0xBA,0xBD,0x30,0x52,0xD0,0x49,0x92,0x62,0xDC,0xDE,0xFF,0xFF,0x54,0x7B,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0xFF,0xFF,0x9B,0xCE,0x4F,0x3A,0x2F,0x3A,0x2F,0x3A,0x0F,0x3A,0x93,0x6B,0xFF,0xFF,0x38,0xA5,0x72,0x4A,0x52,0x4A,0x51,0x4A,0x52,0x4A,0xB5,0x7B,0xFF,0xFF,0x39,0xA5,0x11,0x4A,0xF0,0x49,0xCF,0x41,0x58,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x97,0x9C,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0xB3,0x6B,0x52,0x5B,0x2F,0x3A,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0xB2,0x52,0xD5,0x73,0x13,0x63,0x51,0x4A,0x51,0x4A,0x51,0x4A,0x52,0x4A,0xB2,0x52,0xB5,0x7B,0x13,0x63,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xF0,0x49,0x92,0x62,0x76,0x9C,0xF8,0xA4,
-	0x97,0x9C,0x92,0x62,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_2_216824_data_3, "face_75_2_dial_img_2_216824_data_3.bin");
         
 
 
@@ -170,40 +63,13 @@ const lv_img_dsc_t face_75_2_dial_img_2_216824_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_2_216824_data_3),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_2_216824_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_2_216824_data_4[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x21,0x8B,0x21,0xAB,0x29,0xF1,0x5A,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0xCE,0x39,0xCE,0x39,0x58,0xA5,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x1A,0xC6,0xD1,0x62,0xAE,0x41,0xAE,0x39,0x8D,0x39,0x17,0xAD,0x5A,0xCE,0x2B,0x31,
-	0x2B,0x31,0x4B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0xCD,0x29,0xED,0x31,0x72,0x63,0xFF,0xFF,0x7B,0xCE,0xF6,0x9C,0xF6,0x9C,0xF6,0x9C,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0x7B,0xCE,0xFF,0xFF,0xF7,0x9C,0xD7,0x9C,0x38,0xAD,0x9E,0xF7,0x9E,0xF7,0x90,0x52,0xAE,0x39,0xAE,0x41,
-	0x5B,0xD6,0xFF,0xFF,0x6D,0x41,0x4C,0x39,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xCD,0x29,0x0E,0x32,0x0E,0x32,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xED,0x31,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0x7B,0xCE,0xFF,0xFF,0xCE,0x39,0xAE,0x39,0xAE,0x39,0x52,0x6B,0xFF,0xFF,
-	0x38,0xAD,0xAE,0x39,0x8E,0x39,0x7B,0xCE,0xFF,0xFF,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x0E,0x2A,0x0E,0x32,0xED,0x31,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xED,0x31,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0x7B,0xCE,0xFF,0xFF,0xCE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0xFF,0xFF,0x7B,0xCE,0xAE,0x39,0x8E,0x39,0x7B,0xCE,0xFF,0xFF,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0D,0x2A,0xED,0x29,0xED,0x29,0xED,0x29,0xED,0x29,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xED,0x31,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0x7B,0xCE,
-	0xFF,0xFF,0xCE,0x39,0xAE,0x39,0xAE,0x39,0x52,0x6B,0xFF,0xFF,0x38,0xAD,0xAE,0x39,0x8E,0x39,0x7B,0xCE,0xFF,0xFF,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x2A,0x0E,0x32,0xED,0x31,0xED,0x31,0x72,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7B,0xCE,
-	0xCE,0x39,0xCE,0x39,0x7B,0xCE,0xFF,0xFF,0xF7,0x9C,0xD7,0x9C,0xB9,0xB5,0x9E,0xF7,0x9E,0xF7,0x90,0x52,0x8D,0x39,0x8D,0x39,0x7B,0xCE,0xFF,0xFF,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x93,0x6B,0xFF,0xFF,0xB9,0xB5,0x72,0x6B,
-	0x72,0x6B,0x72,0x63,0xF1,0x5A,0xAD,0x31,0xCD,0x39,0x7B,0xCE,0xFF,0xFF,0x7B,0xCE,0x9E,0xF7,0xFF,0xFF,0x7B,0xCE,0xD1,0x62,0xAE,0x41,0xCF,0x41,0xCF,0x41,0x7B,0xD6,0xFF,0xFF,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xB3,0x6B,
-	0xFF,0xFF,0x17,0x9D,0x30,0x3A,0x30,0x3A,0x0F,0x3A,0xEF,0x39,0xCE,0x39,0xCE,0x39,0x7B,0xCE,0xFF,0xFF,0xAD,0x39,0xB3,0x7B,0xFF,0xFF,0xBA,0xBD,0xF0,0x41,0xF0,0x49,0xF0,0x49,0xD0,0x49,0x7C,0xD6,0xFF,0xFF,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,
-	0x4F,0x3A,0x4F,0x3A,0xB3,0x6B,0xFF,0xFF,0x17,0x9D,0x2F,0x3A,0x30,0x3A,0x30,0x3A,0x30,0x42,0x0F,0x3A,0x0F,0x3A,0x7B,0xD6,0xFF,0xFF,0xEF,0x41,0xEF,0x41,0x1A,0xC6,0xFF,0xFF,0xF5,0x83,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x7B,0xD6,0xFF,0xFF,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0xB3,0x6B,0xFF,0xFF,0x17,0x9D,0x2F,0x3A,0x2F,0x3A,0x0F,0x3A,0x0F,0x3A,0x30,0x42,0x51,0x4A,0x9C,0xD6,0xFF,0xFF,0x52,0x4A,0x11,0x4A,0x30,0x52,0x9E,0xF7,0x9E,0xF7,0x92,0x62,0xD0,0x49,0xD0,0x49,0x7B,0xD6,0xFF,0xFF,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0xB3,0x6B,0xFF,0xFF,0x17,0x9D,0x0F,0x3A,0x2F,0x3A,0x30,0x42,0x71,0x42,0x72,0x4A,0x52,0x4A,0x9C,0xD6,0xFF,0xFF,0x52,0x4A,0x52,0x4A,0x52,0x4A,0xF5,0x83,0xFF,0xFF,0xDC,0xDE,0xCF,0x41,0xCF,0x49,0x7B,0xD6,0xFF,0xFF,0xD0,0x49,0xD0,0x49,0xD0,0x49,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x90,0x42,0x93,0x6B,0x11,0x53,0x50,0x3A,0x71,0x42,0x72,0x42,0x72,0x4A,0x51,0x4A,0x51,0x4A,0x74,0x6B,0xB5,0x7B,0x52,0x4A,0x52,0x4A,0x32,0x4A,0x32,0x4A,0x34,0x73,0x94,0x7B,0x92,0x62,0xCF,0x49,0xF2,0x62,0x54,0x73,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_2_216824_data_4, "face_75_2_dial_img_2_216824_data_4.bin");
         
 
 
@@ -211,40 +77,13 @@ const lv_img_dsc_t face_75_2_dial_img_2_216824_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_2_216824_data_4),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_2_216824_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_2_216824_data_5[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0x31,0x5B,0xDC,0xD6,0xFF,0xFF,0xFF,0xFF,0x3D,0xE7,0x95,0x8C,0xEE,0x31,0xEE,0x31,0xEE,0x31,0xCE,0x39,0xCE,0x39,0x52,0x6B,0x7B,0xCE,0x7B,0xCE,0x2F,0x42,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x7B,0xCE,0x7B,0xCE,0x7B,0xCE,0x5B,0xCE,0x5A,0xCE,0x5A,0xCE,
-	0x5A,0xCE,0x17,0xAD,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0x6E,0x42,0x9E,0xF7,0x9E,0xF7,0xF6,0x9C,0x17,0x9D,0x7B,0xCE,0xFF,0xFF,0x95,0x8C,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xB9,0xB5,0x9E,0xF7,0xFF,0xFF,0x34,0x84,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xD6,0x9C,0xD6,0x9C,0xD7,0xA4,
-	0xFF,0xFF,0x3D,0xE7,0xD6,0x9C,0xB6,0x9C,0xD3,0x83,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xF6,0x94,0xFF,0xFF,0xF3,0x73,0xED,0x31,0xED,0x31,0xED,0x31,0x58,0xA5,0x72,0x63,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0x9E,0xF7,0x58,0xA5,0x3D,0xE7,0xDC,0xDE,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,
-	0xAE,0x39,0xAE,0x39,0x8E,0x39,0xFF,0xFF,0x7B,0xCE,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xED,0x29,0x17,0x9D,0xFF,0xFF,0xF3,0x73,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xB3,0x7B,0xFF,0xFF,0xB3,0x7B,0x58,0xA5,0xFF,0xFF,0x90,0x52,
-	0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0xFF,0xFF,0x7B,0xCE,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x0D,0x2A,0x72,0x63,0xFF,0xFF,0x9E,0xF7,0x95,0x8C,0x72,0x63,0xED,0x31,0xED,0x31,0xED,0x31,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xB9,0xB5,0x9E,0xF7,0xCE,0x39,
-	0xF1,0x5A,0xFF,0xFF,0x75,0x94,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0xFF,0xFF,0x7B,0xCE,0x8E,0x41,0x8E,0x41,0x6D,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0x0E,0x2A,0xF3,0x73,0x3D,0xE7,0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0xF6,0x9C,0xCD,0x31,0xCD,0x31,0xCD,0x31,0xCD,0x31,
-	0x9E,0xF7,0xB9,0xB5,0xCE,0x39,0xCE,0x39,0x3D,0xE7,0xDC,0xDE,0xAE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x8D,0x39,0xFF,0xFF,0x7B,0xCE,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x52,0x5B,0xD6,0x8C,0x5D,0xE7,0xFF,0xFF,0xF7,0x9C,
-	0xEE,0x31,0xCD,0x31,0xB3,0x7B,0xFF,0xFF,0xF6,0x9C,0x52,0x6B,0x52,0x6B,0x7B,0xCE,0xFF,0xFF,0x90,0x52,0xAD,0x39,0xAE,0x39,0xAE,0x41,0xCF,0x41,0xCF,0x41,0xFF,0xFF,0x7B,0xD6,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,
-	0x90,0x42,0x5D,0xE7,0x9E,0xF7,0x30,0x3A,0x0F,0x3A,0xB9,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x76,0x94,0xEF,0x41,0xF0,0x41,0xF0,0x49,0xF0,0x49,0xD0,0x49,0xFF,0xFF,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x52,0x5B,0x75,0x84,
-	0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x2F,0x3A,0x9B,0xCE,0xFF,0xFF,0x30,0x3A,0x91,0x4A,0xFF,0xFF,0x9B,0xCE,0x93,0x6B,0x73,0x73,0x73,0x73,0x73,0x73,0x9E,0xF7,0xDC,0xDE,0xF0,0x41,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xFF,0xFF,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x6F,0x32,0x9B,0xCE,0xBE,0xF7,0x75,0x84,0x4F,0x3A,0x4F,0x3A,0x93,0x6B,0xFF,0xFF,0x3A,0xC6,0x2F,0x3A,0x75,0x84,0xFF,0xFF,0x16,0x8C,0x51,0x4A,0x72,0x4A,0x72,0x4A,0x52,0x4A,0xBA,0xBD,0xFF,0xFF,0x12,0x63,0xCF,0x41,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xFF,0xFF,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x11,0x53,0xFC,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xDE,0x90,0x42,0x0F,0x3A,0x3A,0xC6,0xFF,0xFF,0xB2,0x52,0x52,0x4A,0x51,0x4A,0x52,0x4A,0x52,0x4A,0x16,0x8C,0xFF,0xFF,0x79,0xB5,0xF0,0x49,0xCF,0x41,0xCF,0x41,0xCF,0x49,0xFF,0xFF,0x7B,0xD6,0xD0,0x49,0xD0,0x49,0xD0,0x49,
-	0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x14,0x74,0x17,0x9D,0x17,0x9D,0x14,0x74,0x30,0x3A,0x50,0x3A,0x71,0x42,0xD5,0x73,0x74,0x6B,0x51,0x4A,0x51,0x4A,0x51,0x4A,0x52,0x4A,0x52,0x4A,0xB2,0x52,0xB5,0x7B,0x34,0x73,0x32,0x4A,0x11,0x4A,0xF0,0x49,0xCF,0x49,0x54,0x73,0xF3,0x6A,
-	0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_2_216824_data_5, "face_75_2_dial_img_2_216824_data_5.bin");
         
 
 
@@ -252,40 +91,13 @@ const lv_img_dsc_t face_75_2_dial_img_2_216824_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_2_216824_data_5),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_2_216824_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_2_216824_data_6[] = {
-	//RGB565 data 
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAB,0x29,0xAC,0x29,0xAD,0x31,0xCD,0x31,0xCD,0x31,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xAE,0x39,0xAD,0x39,0x8D,0x39,0x8D,0x39,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x39,0x4B,0x39,0x2B,0x39,
-	0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0xAB,0x21,0x31,0x5B,0xDC,0xD6,0xFF,0xFF,0xFF,0xFF,0x3D,0xE7,0x95,0x8C,0xED,0x31,0xEE,0x31,0x31,0x5B,0x7B,0xCE,0x34,0x84,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xD1,0x62,0x7B,0xCE,0x34,0x84,0xAE,0x39,0xAE,0x39,0x38,0xAD,0x7B,0xCE,0x32,0x6B,0x4D,0x39,0x4C,0x39,0x2B,0x31,
-	0x2B,0x31,0x17,0xAD,0x17,0xAD,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xCB,0x21,0x6E,0x42,0x9E,0xF7,0x9E,0xF7,0xF6,0x94,0xF6,0x9C,0x7B,0xCE,0xFF,0xFF,0x95,0x8C,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xD7,0x9C,0xAE,0x39,0xAE,0x39,0x7B,0xCE,0xFF,0xFF,0x3D,0xE7,
-	0xEF,0x51,0x8E,0x41,0x6D,0x41,0x6C,0x31,0x5A,0xCE,0x5A,0xCE,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xCB,0x21,0xAB,0x21,0xD5,0x94,0xFF,0xFF,0xF3,0x73,0x0E,0x32,0xED,0x31,0xED,0x31,0x58,0xA5,0x72,0x63,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xD7,0x9C,0xAE,0x39,0xAE,0x39,
-	0x7B,0xCE,0xFF,0xFF,0xFF,0xFF,0x38,0xAD,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x7B,0xCE,0x5A,0xCE,0x2B,0x39,0x2B,0x39,0x2B,0x39,0xAB,0x21,0xCB,0x21,0xF6,0x94,0xFF,0xFF,0xF3,0x73,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,
-	0xD7,0x9C,0xAE,0x39,0xAE,0x39,0x7B,0xCE,0x7B,0xCE,0xDC,0xDE,0xFF,0xFF,0x32,0x73,0x8E,0x41,0x8E,0x41,0x5B,0xD6,0x5B,0xD6,0x4C,0x39,0x2B,0x39,0x2B,0x39,0xCC,0x21,0x0D,0x2A,0x92,0x63,0xFF,0xFF,0x9E,0xF7,0x95,0x8C,0x72,0x63,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,0xCE,0x39,0xCE,0x39,0xCE,0x39,
-	0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xD7,0x9C,0xAE,0x39,0xAE,0x39,0x7B,0xCE,0x7B,0xCE,0xD1,0x62,0xFF,0xFF,0x3D,0xE7,0x8E,0x41,0x8E,0x41,0x7B,0xCE,0x5B,0xD6,0x6E,0x41,0x4D,0x39,0x2B,0x39,0x2E,0x2A,0x2E,0x2A,0x0E,0x2A,0xF3,0x73,0x3D,0xE7,0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0xF6,0x9C,0xCD,0x31,0xCD,0x31,0x72,0x63,0xFF,0xFF,0xF6,0x9C,
-	0xCE,0x39,0xCE,0x39,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xD7,0x9C,0xAE,0x39,0xAD,0x39,0x7B,0xCE,0x7B,0xCE,0x8D,0x39,0xD6,0x9C,0xFF,0xFF,0xD7,0xA4,0x8E,0x41,0x5B,0xD6,0x5B,0xD6,0x6E,0x41,0x8F,0x49,0x6E,0x41,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x52,0x5B,0xD6,0x8C,0x5D,0xE7,0xFF,0xFF,0xF7,0x9C,0x0E,0x3A,
-	0x72,0x6B,0xFF,0xFF,0xF6,0x9C,0xAD,0x31,0xCD,0x39,0xCE,0x39,0xCE,0x39,0x52,0x6B,0xFF,0xFF,0xD6,0x9C,0xAD,0x39,0xAE,0x39,0x7B,0xCE,0x7B,0xCE,0xCF,0x41,0xCF,0x49,0xDC,0xDE,0xFF,0xFF,0xF3,0x6A,0x7B,0xD6,0x7B,0xD6,0xB0,0x49,0xB0,0x49,0xB0,0x51,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x90,0x42,
-	0x5D,0xE7,0xBE,0xF7,0x30,0x3A,0x93,0x6B,0xFF,0xFF,0xF7,0x9C,0xCE,0x39,0xCE,0x39,0xAD,0x31,0xAD,0x31,0x52,0x6B,0xFF,0xFF,0xD7,0xA4,0xEF,0x41,0xF0,0x41,0x7C,0xD6,0x7C,0xD6,0xD0,0x49,0xD0,0x49,0xF3,0x6A,0xFF,0xFF,0xDC,0xDE,0x7B,0xD6,0x7B,0xD6,0xB0,0x49,0xB0,0x51,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x52,0x5B,0x75,0x84,0x4F,0x32,
-	0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x9B,0xCE,0xFF,0xFF,0x2F,0x3A,0x91,0x4A,0xFF,0xFF,0xBA,0xBD,0x0F,0x3A,0x0F,0x3A,0xEF,0x41,0xEF,0x41,0x16,0x8C,0xFF,0xFF,0x97,0x9C,0xF0,0x41,0xD0,0x49,0x7B,0xD6,0x7B,0xD6,0xD0,0x49,0xCF,0x49,0xD0,0x49,0xF8,0xA4,0xFF,0xFF,0xFF,0xFF,0x7B,0xD6,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,
-	0x9B,0xCE,0xBE,0xF7,0x75,0x84,0x4F,0x3A,0x4F,0x3A,0xB3,0x6B,0xFF,0xFF,0x3A,0xC6,0x2F,0x3A,0x2F,0x3A,0xB9,0xB5,0xFF,0xFF,0xB7,0x94,0x51,0x4A,0x72,0x4A,0xB5,0x7B,0xBF,0xF7,0x9E,0xF7,0x30,0x52,0xEF,0x41,0xCF,0x41,0x7B,0xD6,0x7B,0xD6,0xD0,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xDC,0xDE,0xFF,0xFF,0x7B,0xD6,0xB0,0x49,0xB0,0x49,
-	0xB0,0x49,0x6F,0x32,0x6F,0x32,0x11,0x53,0xFC,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0xDE,0x90,0x42,0x0F,0x3A,0x2F,0x3A,0x91,0x4A,0x9C,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xF7,0xB5,0x7B,0x52,0x4A,0x11,0x4A,0xF0,0x49,0x7B,0xD6,0x7B,0xD6,0xCF,0x49,0xCF,0x49,0xD0,0x49,0xD0,0x49,0xF3,0x6A,0xFF,0xFF,
-	0x7B,0xD6,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x14,0x74,0x17,0x9D,0x17,0x9D,0x14,0x74,0x2F,0x3A,0x30,0x3A,0x50,0x3A,0x71,0x42,0x72,0x42,0x72,0x4A,0x74,0x6B,0x39,0xA5,0x39,0xA5,0x76,0x94,0xB2,0x52,0x52,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x34,0x73,0x13,0x6B,0xCF,0x49,0xCF,0x49,0xD0,0x49,
-	0xD0,0x49,0xD0,0x49,0xF3,0x6A,0xF3,0x6A,0xB0,0x49,0xB0,0x49,0xB0,0x49,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_75_2_dial_img_2_216824_data_6, "face_75_2_dial_img_2_216824_data_6.bin");
         
 
 
@@ -293,7 +105,7 @@ const lv_img_dsc_t face_75_2_dial_img_2_216824_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 35,
     .header.h = 13,
-    .data_size = sizeof(face_75_2_dial_img_2_216824_data_6),
+    .data_size = 1365,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_75_2_dial_img_2_216824_data_6};
 
@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 75_2
-
-#include "../75_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_75_2_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x49,0xA7,0x28,0x00,0x00,0x00,0x00,0x43,0x10,0xB1,0x59,0xF4,0x69,0x71,0x59,0x44,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0xA7,0x28,0x58,0x82,0x1F,0xB3,0x90,0x59,0x00,0x00,0x44,0x10,0xBB,0x9A,0xBC,0x9A,0x9A,0x92,0xDD,0xA2,0x9A,0x92,0x64,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x49,0xDD,0xA2,0xDC,0x9A,0x1F,0xB3,0x90,0x59,0x00,0x00,0x16,0x7A,0xBC,0x9A,0xC8,0x28,0x43,0x10,0xA8,0x28,0x1F,0xB3,0xB2,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x39,0x90,0x59,0xEB,0x38,0x1F,0xB3,0x90,0x59,0x43,0x10,0x58,0x8A,0x16,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xB3,0xF5,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x30,0x1F,0xB3,0x90,0x59,0x00,0x00,0x64,0x18,0x43,0x10,0x00,0x00,0x00,0x00,0x4D,0x49,0xFE,0xAA,0x0C,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x30,0x1F,0xB3,0x90,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0x2D,0x49,0xDD,0xA2,0x57,0x82,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x30,0x1F,0xB3,0x90,0x59,0x00,0x00,0x00,0x00,0x43,0x10,0x36,0x82,0xFE,0xAA,0xB3,0x69,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x30,0x1F,0xB3,0x90,0x59,0x00,0x00,0x43,0x10,0x9A,0x92,0xBC,0xA2,0x0D,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x30,0x1F,0xB3,0x90,0x59,0x00,0x00,0x15,0x7A,0xFD,0xAA,0x70,0x59,0xC9,0x30,0xC9,0x30,0xC9,0x30,0x66,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0x28,0xFE,0xAA,0x70,0x59,0x64,0x10,0x7A,0x92,0xFE,0xAA,0xDD,0xAA,0xFE,0xAA,0xDD,0xAA,0xFE,0xAA,0x16,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x08,0xA6,0x20,0x43,0x10,0x01,0x00,0x85,0x20,0xA6,0x20,0x86,0x20,0xA6,0x20,0x86,0x20,0xA6,0x20,0x64,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x49,0x4A,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x0C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x0C,0x63,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x00,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x62,0x00,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x08,0x42,0x08,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x42,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x01,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,
-	0x83,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x00,0xA3,0x00,
-	0x83,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x23,0x10,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x83,0x00,0x82,0x00,0x82,0x00,
-	0x82,0x00,0x82,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xF3,0x9C,
-	0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0xA3,0x00,0x82,0x00,0x82,0x00,0x82,0x00,
-	0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x62,0x08,0x62,0x08,0x63,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x22,0x10,0x22,0x10,0x22,0x10,0x43,0x10,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x23,0x10,0x23,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0x5C,0xE7,
-	0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x00,0x61,0x00,0x81,0x00,0xE5,0x00,0x26,0x09,0x05,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x05,0x09,0x05,0x09,0xE5,0x08,0xC4,0x08,0xA4,0x08,0xA4,0x08,0x83,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x42,0x08,0x43,0x08,0x42,0x08,0x42,0x08,0x43,0x10,0x64,0x10,0x64,0x10,0x85,0x10,0x85,0x18,0x85,0x18,0x86,0x18,
-	0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x85,0x18,0x43,0x08,0x42,0x08,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x50,0x84,0x7D,0xEF,0x49,0x4A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x62,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x82,0x00,0x05,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE5,0x08,0xC5,0x08,0xA4,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x42,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0x42,0x08,0x43,0x08,0x64,0x08,0x64,0x10,0xA6,0x10,0xA6,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x18,0x63,0x10,0x42,0x08,0x43,0x08,0x43,0x08,0x43,0x08,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xBE,0xF7,0xEB,0x5A,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x00,0xA2,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0xA2,0x00,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0x84,0x10,0x63,0x08,0x42,0x08,0x42,0x08,0x43,0x08,0x64,0x10,0x85,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x63,0x10,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0xBE,0xF7,0x8E,0x73,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xA2,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x26,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xC6,0x18,0xE7,0x18,0xE7,0x18,0xC6,0x18,0xA5,0x10,0xA6,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x5C,0xE7,0x51,0x8C,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xC5,0x10,0x07,0x11,0x08,0x19,0x29,0x21,0x09,0x21,0x29,0x21,0x29,0x29,0x08,0x21,0xC7,0x18,0xA6,0x18,0xA6,0x18,0xA5,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0x5D,0xEF,0x14,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x05,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE7,0x18,0x48,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x21,0x29,0x21,0x09,0x21,0x09,0x29,0x08,0x21,0xE7,0x20,0xA6,0x10,0x85,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0x21,0x00,0x00,0x00,0x24,0x21,0xDA,0xD6,0xB6,0xB5,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC2,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0xE4,0x00,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0xE5,0x10,0xC5,0x10,0xC5,0x10,0x07,0x11,0x28,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x08,0x21,0x09,0x21,0x09,0x21,0x09,0x29,0x09,0x29,0x09,0x21,0x09,0x29,0x08,0x21,0xE7,0x18,0xA5,0x18,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x65,0x18,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0xE4,0x18,0x79,0xCE,0x38,0xC6,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xE3,0x00,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0xE5,0x08,0xE5,0x08,0x28,0x19,0x48,0x19,0x49,0x19,0x49,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x21,0x09,0x21,0x09,0x29,0x09,0x29,0x09,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x08,0x21,0xC8,0x20,0xA6,0x18,0x85,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0xA6,0x20,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x65,0x18,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0xE5,0x20,0x17,0xBE,0xBA,0xD6,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xA2,0x00,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x06,0x09,0x06,0x09,0x05,0x09,0x05,0x09,0x07,0x11,0x48,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x29,0x21,0x09,0x21,0x08,0x21,0x29,0x21,0x09,0x21,0x09,0x21,0x09,0x29,0x09,0x29,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xC7,0x20,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x20,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x44,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0xA4,0x18,0x34,0xA5,0x1B,0xDF,0x66,0x31,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x04,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,
-	0x05,0x09,0x05,0x09,0x06,0x11,0x48,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x28,0x19,0x28,0x19,0x28,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x21,0x08,0x21,0x09,0x21,0x09,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0x08,0x21,0xE8,0x20,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE8,0x28,0xC7,0x20,0x85,0x18,0x85,0x18,
-	0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x65,0x20,0x42,0x08,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x83,0x10,0x13,0x9D,0x3C,0xE7,0x09,0x42,0x43,0x10,0x43,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xC4,0x00,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x05,0x09,
-	0x05,0x09,0x27,0x11,0x48,0x19,0x48,0x19,0x68,0x11,0x49,0x19,0x69,0x19,0x69,0x21,0x69,0x21,0x69,0x21,0x69,0x21,0x6B,0x21,0x8B,0x21,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x4B,0x29,0x2A,0x31,0x2A,0x31,0x2A,0x31,0x09,0x29,0x09,0x29,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xA7,0x28,0xA6,0x18,
-	0x85,0x18,0x85,0x18,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x45,0x18,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x63,0x10,0xCE,0x73,0x5D,0xEF,0xAB,0x5A,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x05,0x09,0x05,0x09,0x05,0x09,0x26,0x09,0x68,0x11,
-	0x89,0x19,0xAA,0x19,0xCB,0x21,0xAA,0x21,0xAA,0x21,0xAB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x46,0x21,0x56,0xAD,0x56,0xAD,0x46,0x21,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x31,0x0B,0x31,0xEB,0x38,0x0B,0x31,0xEB,0x30,
-	0xE9,0x28,0xA6,0x20,0x85,0x18,0x85,0x18,0x85,0x18,0x65,0x18,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x43,0x10,0x42,0x08,0x43,0x10,0x42,0x08,0xEF,0x7B,0x7D,0xEF,0xCB,0x5A,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0x82,0x00,0x04,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x26,0x09,0x26,0x09,0x05,0x09,0x05,0x09,0x25,0x09,0x47,0x09,0x67,0x09,0x67,0x09,0xCA,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xD6,0xB5,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0xC9,0x28,0x87,0x28,0xA7,0x20,0x86,0x18,0x85,0x18,0x85,0x18,0x66,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x42,0x08,0x43,0x08,0xAA,0x52,0x5D,0xEF,0xEF,0x7B,0x42,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x0C,0x63,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0xC2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xE3,0x00,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x25,0x01,0x25,0x01,0x26,0x09,0x26,0x09,0x87,0x09,0x88,0x09,0xA8,0x09,0x67,0x09,0xA9,0x11,0xCA,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0B,0x39,0xCA,0x30,0xE9,0x28,0xA9,0x28,0xC9,0x30,0xA8,0x28,0xA7,0x20,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x44,0x18,0xAB,0x5A,0x7D,0xEF,0x0F,0x7C,0x63,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x21,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x0C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x0C,0x63,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x45,0x01,0x66,0x01,0x45,0x01,0x45,0x01,0x45,0x01,0x46,0x01,0x67,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x87,0x09,0x88,0x11,0xA9,0x11,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xCA,0x38,0xC9,0x28,0xC9,0x28,0xC9,0x30,0xA9,0x30,0xA9,0x30,0x87,0x28,0x87,0x20,0x66,0x20,0x66,0x20,0x65,0x20,0x66,0x20,0x0B,0x4A,0x1C,0xE7,0x14,0xA5,0x83,0x18,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x0C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0xE4,0x00,0x66,0x01,0x45,0x01,0x45,0x01,0x87,0x01,0xA8,0x09,0xA8,0x01,0xC8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x09,0x87,0x09,0xCA,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xCB,0x38,0xC9,0x30,0xA9,0x28,0xC9,0x28,0xC9,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA8,0x30,0x66,0x20,0x87,0x39,0x1B,0xDF,0x54,0xA5,0xA3,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xA3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0xA2,0x00,0x45,0x01,0x66,0x01,0xA7,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x11,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xCB,0x40,0xAA,0x30,0xC9,0x28,0xA9,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x69,0x39,0x99,0xCE,0x18,0xC6,0x08,0x31,0x43,0x10,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0x04,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0xC9,0x09,0xEA,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0xAC,0x29,0xAC,0x29,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x31,0x8C,0x31,0x6C,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x4B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCA,0x38,0x88,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xC5,0x20,0x18,0xC6,0x99,0xCE,0x6A,0x41,0xA9,0x30,0x66,0x20,0x42,0x08,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0xE3,0x00,0x25,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x09,0xA8,0x09,0xC9,0x09,0xEB,0x19,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0x8B,0x21,0xAF,0x4A,0xBB,0xD6,0x1A,0xBE,0x19,0xBE,0x19,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3A,0xC6,0x96,0x94,0xCE,0x41,0x8D,0x39,0xB8,0xBD,0x8F,0x5A,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCA,0x38,0xC9,0x28,0xA9,0x30,0xC6,0x28,0x96,0xB5,0xDA,0xD6,0x66,0x31,0xA9,0x30,0xA9,0x30,0x69,0x38,0x86,0x20,0x64,0x10,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0xE3,0x00,0x45,0x01,0x45,0x01,0x86,0x01,0xE8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xE9,0x11,0x0B,0x1A,0xEB,0x19,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x21,0xED,0x29,0xED,0x29,0x10,0x53,0x3D,0xE7,0x51,0x63,0x8F,0x4A,0x8F,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x62,0xFC,0xDE,0xD4,0x7B,0x8E,0x39,0xBC,0xD6,0x12,0x6B,0x6D,0x39,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x40,0xCB,0x40,0xA9,0x30,0x13,0x9D,0x5C,0xE7,0xC8,0x39,0xA8,0x28,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x87,0x28,0x66,0x20,0x66,0x20,0x44,0x10,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0xC2,0x00,0x04,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xA7,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x09,0xC8,0x09,0xA8,0x01,0xE9,0x09,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xCB,0x21,0xED,0x29,0xED,0x29,0xED,0x29,0x10,0x53,0x3C,0xE7,0xAF,0x4A,0xCD,0x31,0xCD,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x39,0x7B,0xCE,0xF7,0x9C,0x8E,0x39,0xDC,0xD6,0x12,0x6B,0x8E,0x41,0x6E,0x41,0x4C,0x39,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x40,0x0C,0x41,0x73,0x94,0x7D,0xEF,0x6A,0x52,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x89,0x30,0x89,0x30,0x86,0x20,0x86,0x20,0x66,0x20,0x65,0x20,0x43,0x10,0x42,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0xE3,0x00,0x65,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x09,0xA8,0x01,0xEA,0x11,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xCB,0x21,0x0D,0x2A,0x0D,0x2A,0xED,0x29,0xED,0x29,0x10,0x53,0xBE,0xF7,0x9B,0xCE,0x5A,0xC6,0x98,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xA5,0x5D,0xEF,0xD0,0x5A,0x8D,0x39,0xDC,0xD6,0x12,0x6B,0x8E,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x41,0x2B,0x39,0x0B,0x39,0x0B,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x40,0xB0,0x7B,0xBE,0xF7,0x0D,0x63,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x69,0x38,0x67,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x44,0x18,0x42,0x08,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x24,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xC7,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x01,0xC8,0x01,0xC8,0x01,0xA8,0x01,0xE9,0x09,0x2B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xCB,0x19,
-	0xCB,0x19,0xEB,0x19,0xCB,0x21,0xEC,0x21,0x0D,0x2A,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x32,0x5B,0x5D,0xE7,0xB3,0x73,0x11,0x5B,0xB0,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0xEF,0x73,0x73,0xAE,0x41,0xCF,0x41,0xDC,0xDE,0x53,0x73,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x2C,0x39,0x2B,0x39,0x0C,0x39,0x0B,0x39,
-	0x0B,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEB,0x38,0x0D,0x63,0xBE,0xF7,0xB0,0x7B,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x65,0x18,0x43,0x10,0x42,0x08,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0xC3,0x00,0xC3,0x00,
-	0xC3,0x00,0xC3,0x00,0xA2,0x00,0x04,0x01,0x45,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xC8,0x01,0xA8,0x01,0xEA,0x09,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xCB,0x19,0x0C,0x1A,0x2C,0x22,
-	0x0D,0x22,0x2D,0x22,0x2D,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x52,0x5B,0x3D,0xE7,0xD1,0x52,0x30,0x3A,0x0F,0x3A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBB,0xD6,0x76,0x8C,0xD0,0x49,0xD0,0x49,0xDC,0xDE,0x53,0x73,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x6F,0x51,0x4E,0x49,0x4D,0x41,0x0D,0x41,
-	0x0D,0x41,0x0C,0x41,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0x6A,0x52,0x5C,0xE7,0x93,0x94,0xEC,0x48,0xCC,0x48,0xCC,0x48,0xCB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x69,0x38,0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x44,0x18,0x42,0x08,0x43,0x10,0x43,0x10,
-	0x43,0x10,0x43,0x10,0x43,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,
-	0xA3,0x00,0xA2,0x00,0x04,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xA8,0x01,0x09,0x0A,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xCB,0x19,0x0B,0x1A,0x2C,0x22,0x4D,0x22,0x4D,0x22,
-	0x2D,0x22,0x4D,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x52,0x5B,0x3D,0xE7,0xD1,0x52,0x0F,0x3A,0x0F,0x3A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x53,0x73,0x5D,0xEF,0x33,0x73,0xCF,0x49,0xDC,0xDE,0x53,0x73,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x90,0x51,0x90,0x51,0x2E,0x49,0x4E,0x41,
-	0x2E,0x49,0x2E,0x49,0x0D,0x41,0xEC,0x40,0xEC,0x40,0xEB,0x38,0xCB,0x38,0xE8,0x41,0x5C,0xE7,0x13,0x9D,0xCC,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAB,0x40,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x87,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x45,0x18,0x42,0x08,0x43,0x08,
-	0x43,0x10,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x00,0xC3,0x00,0xA3,0x00,
-	0xA2,0x00,0x24,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x25,0x01,0x87,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x0A,0x0A,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xCB,0x19,0xEB,0x19,0x4C,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,
-	0x2D,0x22,0x4E,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0xB0,0x42,0x55,0x84,0x90,0x42,0x50,0x3A,0x71,0x42,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x52,0x4A,0xF5,0x83,0xD4,0x83,0xEF,0x49,0xF4,0x83,0x71,0x5A,0xD0,0x49,0xB0,0x49,0xB0,0x49,0xB0,0x49,0x90,0x51,0x90,0x51,0x6F,0x51,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2D,0x41,0xEC,0x40,0x67,0x31,0xDA,0xD6,0x96,0xB5,0x08,0x31,0xCC,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAB,0x40,0x68,0x30,0xA9,0x30,0xA9,0x30,0x89,0x30,0x88,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x43,0x08,
-	0x42,0x08,0x43,0x10,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xA2,0x00,0xC2,0x00,
-	0x45,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x09,0x02,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x11,0x0C,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,
-	0x4E,0x2A,0x6F,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x2F,0x3A,0x31,0x4A,0x31,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x11,0x4A,0x11,0x4A,0x10,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x49,0x90,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0x2E,0x49,0xAE,0x59,0x99,0xCE,0x38,0xC6,0xC6,0x28,0xEC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAA,0x40,0x88,0x30,0xA9,0x30,0xA9,0x30,0x89,0x30,0x67,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x43,0x10,0x42,0x08,0x43,0x10,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xA2,0x00,0xA2,0x00,0x46,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x09,0x0A,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x12,0x0B,0x1A,0x0B,0x12,0xEB,0x11,0x4C,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x8E,0x22,
-	0x6F,0x2A,0x6F,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x30,0x42,0x2F,0x3A,0x2F,0x3A,0x31,0x4A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x32,0x4A,0x31,0x4A,0x10,0x4A,0xB0,0x49,0xF0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0x90,0x49,0x90,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x70,0x51,0x2E,0x49,0x2E,0x49,0x2E,0x49,0xAE,0x51,0x18,0xC6,0x99,0xCE,0x8B,0x49,0xCC,0x40,0xCB,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAA,0x40,0xA9,0x30,0xA9,0x30,0x89,0x30,0x88,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x43,0x10,0x42,0x08,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC2,0x00,0x45,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xC7,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x2A,0x0A,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x12,0x4C,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6F,0x2A,
-	0x6F,0x2A,0x6F,0x2A,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x2E,0x32,0x4F,0x32,0x70,0x3A,0xF3,0x3A,0x14,0x43,0x15,0x53,0x57,0x5B,0x57,0x5B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x73,0x18,0x73,0x76,0x6A,0x74,0x5A,0x53,0x5A,0xF1,0x51,0xD0,0x49,0xD0,0x49,0x90,0x49,0x90,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x90,0x51,0x4F,0x49,0x2E,0x49,0x6D,0x49,0x54,0xA5,0x1B,0xDF,0xCB,0x49,0x0E,0x51,0xED,0x48,0xCB,0x40,0xCB,0x40,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAA,0x38,0xA9,0x30,0x89,0x30,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x67,0x28,0x43,0x10,0x42,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x45,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xE8,0x01,0xE8,0x01,0xE8,0x01,0x4A,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x12,0x2C,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x22,0x6E,0x2A,0x6F,0x2A,
-	0x8F,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0xD2,0x3A,0x75,0x4B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0x97,0x6A,0x34,0x62,0x90,0x51,0x90,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x50,0x51,
-	0x90,0x51,0x50,0x51,0x2C,0x41,0x34,0xA5,0x1C,0xE7,0x6F,0x62,0x0E,0x49,0x0E,0x49,0x0E,0x51,0xED,0x48,0xCB,0x40,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAB,0x48,0x8A,0x38,0x88,0x30,0x89,0x38,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x20,0x66,0x20,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xE8,0x01,0xE8,0x01,0x4A,0x02,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x2B,0x12,0x8D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x22,0x6D,0x1A,0xAF,0x22,0xAF,0x22,
-	0x8F,0x2A,0x8F,0x2A,0x8F,0x2A,0x90,0x32,0x12,0x33,0x76,0x43,0xB8,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x57,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x7A,0x77,0x7A,0xF4,0x69,0xD1,0x51,0x91,0x59,0x91,0x59,0x90,0x51,
-	0x70,0x51,0x6E,0x49,0xEF,0x7B,0x5D,0xEF,0x10,0x73,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0xEC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8B,0x48,0x89,0x30,0x69,0x30,0x67,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x67,0x28,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0x86,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x86,0x01,0xE8,0x01,0x09,0x02,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x8C,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x1A,0xAE,0x1A,0xD0,0x2A,0xD0,0x2A,
-	0xF1,0x2A,0x8F,0x2A,0xF1,0x2A,0x76,0x4B,0xB7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x57,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x6B,0x18,0x73,0x18,0x73,0xD8,0x72,0xF8,0x72,0xD8,0x72,0xD8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x77,0x7A,0xB2,0x61,0xB0,0x51,0x91,0x59,
-	0x4E,0x49,0xF0,0x83,0x5D,0xEF,0xCB,0x5A,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0x0E,0x51,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8A,0x40,0x89,0x30,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xC2,0x00,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xA7,0x01,0x09,0x02,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x4B,0x12,0xAD,0x1A,0x8D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x1A,0x8E,0x1A,0xF1,0x2A,0xF1,0x2A,0xF1,0x2A,
-	0xB0,0x2A,0xF1,0x32,0xB6,0x4B,0xD7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x73,0x18,0x73,0xF8,0x72,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x82,0xD4,0x69,0x91,0x59,
-	0xCB,0x5A,0x7D,0xEF,0x10,0x84,0x0D,0x49,0x2E,0x49,0x0E,0x49,0x2E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0x0E,0x51,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x48,0x8C,0x48,0x8A,0x40,0x88,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x04,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x00,0xA2,0x00,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xC8,0x01,0x4A,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x6D,0x1A,0x8D,0x1A,0x8D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xAE,0x1A,0xF1,0x22,0xF1,0x22,0xF1,0x2A,0x8F,0x2A,
-	0x53,0x2B,0xD6,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x57,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x73,0x18,0x73,0xF8,0x72,0xD8,0x72,0xF8,0x72,0xD8,0x72,0xB8,0x72,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x73,0x83,
-	0x5D,0xEF,0xEF,0x7B,0x6F,0x51,0x92,0x61,0x70,0x51,0x2F,0x51,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0x0E,0x51,0xEE,0x50,0xCC,0x40,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8B,0x48,0x6A,0x40,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x04,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0xA2,0x00,0xA2,0x00,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x66,0x01,0x2A,0x02,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x4C,0x12,0x8D,0x1A,0x8D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xAE,0x1A,0xCF,0x22,0xD0,0x22,0xF1,0x22,0xF0,0x22,0xD1,0x2A,0x94,0x33,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD7,0x4B,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x34,0x83,0x3C,0xE7,
-	0x35,0xA5,0x8F,0x51,0x91,0x59,0x92,0x61,0x91,0x59,0x50,0x51,0x2F,0x51,0x0E,0x51,0x0E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x67,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x04,0x18,0x03,0x10,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xC8,0x01,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6C,0x12,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0xAE,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x10,0x23,0xF1,0x22,0xCF,0x22,0xB4,0x33,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0x97,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x73,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x6F,0x62,0x1B,0xDF,0x54,0xA5,
-	0x55,0x7A,0x16,0x7A,0x71,0x59,0x71,0x59,0x92,0x61,0x50,0x59,0x30,0x59,0x30,0x59,0x50,0x51,0x0E,0x51,0xEE,0x50,0x0E,0x51,0xED,0x50,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x04,0x18,0x03,0x10,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x09,0x02,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x8C,0x12,0x8D,0x1A,0x6D,0x1A,0x8E,0x1A,0xCF,0x22,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0x11,0x23,0xF0,0x22,0x73,0x2B,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x57,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x6B,0x18,0x73,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x71,0x62,0x99,0xCE,0x39,0xC6,0xB6,0x7A,
-	0x58,0x8A,0x58,0x8A,0x16,0x7A,0x91,0x59,0x52,0x61,0x50,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x6B,0x48,0x66,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0x87,0x01,0x2A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x8D,0x1A,0x6D,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x1A,0xCF,0x22,0xF0,0x22,0xF0,0x22,0x32,0x2B,0x57,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x6B,0x18,0x73,0x18,0x73,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x98,0x72,0x98,0x7A,0x8C,0x41,0x38,0xC6,0x99,0xCE,0xD6,0x82,0x78,0x82,
-	0x58,0x8A,0x38,0x8A,0x58,0x8A,0xD4,0x71,0x50,0x59,0x91,0x59,0x50,0x51,0x30,0x59,0x30,0x59,0x30,0x59,0x2F,0x59,0x0E,0x51,0xEE,0x50,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x89,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0xF0,0x22,0x11,0x2B,0x57,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0x97,0x53,0x77,0x5B,0x77,0x5B,0x77,0x5B,0x78,0x63,0xB9,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x39,0x73,0x38,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x97,0x72,0xEF,0x51,0x96,0xB5,0xDA,0xD6,0xA9,0x41,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x18,0x92,0xD4,0x69,0x71,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0xEE,0x58,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x20,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x45,0x01,0xA8,0x01,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x4B,0x12,0xEE,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0x10,0x23,0x16,0x34,0x37,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0xB8,0x63,0xF9,0x63,0xFB,0x73,0xFB,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x7B,0x9B,0x83,0x7A,0x83,0x3A,0x83,0xF8,0x72,0xB7,0x72,0xD8,0x72,0x97,0x72,0x13,0x9D,0x5C,0xE7,0x2B,0x4A,0x56,0x7A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x17,0x8A,0x71,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x46,0x28,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x03,0x01,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0x87,0x01,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0xAD,0x12,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0x52,0x2B,0x77,0x3C,0x37,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xD8,0x53,0x39,0x64,0x1A,0x6C,0xFA,0x6B,0x1A,0x6C,0xFA,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x7B,0x9B,0x83,0x9B,0x83,0x5B,0x83,0x3A,0x8B,0xF9,0x7A,0xB7,0x72,0xD5,0x9C,0x5C,0xE7,0xAD,0x5A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0xD5,0x79,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x0E,0x59,0xCB,0x40,0xAB,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x66,0x01,0xA8,0x01,0xC8,0x09,0xE8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x4C,0x12,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0xF5,0x33,0x37,0x3C,0x37,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0x96,0x4B,0x18,0x5C,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFA,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x5B,0x8B,0x5B,0x8B,0x3B,0x8B,0x12,0x8C,0xBE,0xF7,0x4F,0x6B,0x76,0x72,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0xF8,0x91,0x31,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0xED,0x50,0xAB,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x89,0x30,0x69,0x38,0x67,0x28,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x45,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xE3,0x00,0x66,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0x87,0x01,0xC8,0x09,0xC8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x8D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xAE,0x1A,0x72,0x2B,0x77,0x3C,0x57,0x3C,0x37,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0x96,0x4B,0xF9,0x5B,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFB,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x7B,0x83,0x39,0x83,0x90,0x73,0xBE,0xF7,0x12,0x84,0x97,0x7A,0x97,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0xD5,0x79,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x0E,0x59,0xEE,0x50,0xCC,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x89,0x30,0x69,0x38,0x68,0x30,0x66,0x20,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x24,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC2,0x00,0x65,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x66,0x01,0x66,0x01,0xA8,0x01,0xC8,0x09,0xC8,0x09,0x09,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x8C,0x12,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0x15,0x34,0x77,0x3C,0x57,0x3C,0x17,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xB6,0x4B,0x19,0x54,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFB,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x7B,0x9B,0x83,0x9B,0x83,0x5B,0x83,0xEE,0x62,0x7D,0xEF,0xF6,0xA4,0x1A,0x8B,0xFA,0x8A,0x97,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0xF8,0x89,0x51,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x0E,0x59,0xEE,0x50,0xEE,0x50,0xCC,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x89,0x30,0x69,0x38,0x69,0x38,0x67,0x28,0x66,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x20,0x24,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x45,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x45,0x01,0x87,0x01,0xC8,0x09,0xC8,0x09,0xA8,0x09,0x09,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x6C,0x12,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0x11,0x23,0x56,0x34,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD6,0x4B,0xF8,0x4B,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x9B,0x7B,0x9B,0x83,0x59,0x7B,0x4B,0x4A,0x5C,0xE7,0xF3,0x9C,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0xB9,0x82,0x77,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x73,0x71,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xCD,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x68,0x30,0x65,0x20,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x28,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x66,0x01,0x66,0x01,
-	0x66,0x01,0x45,0x01,0xA8,0x01,0xC8,0x09,0xC8,0x09,0xA8,0x01,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0x6D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0xEF,0x1A,0x10,0x1B,0x72,0x23,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xD6,0x4B,0x59,0x54,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xF7,0xBD,0xFF,0xFF,0xFF,0xFF,0xD6,0xB5,0x9B,0x7B,0x9B,0x83,0x0A,0x42,0xDB,0xDE,0x96,0xB5,0x50,0x5A,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0xDB,0x92,0x98,0x82,0x77,0x7A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0xB6,0x79,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xED,0x50,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x67,0x28,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x66,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x65,0x18,0x65,0x18,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE3,0x00,0x66,0x01,0x66,0x01,
-	0x45,0x01,0x87,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x8D,0x1A,0xEE,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xF0,0x22,0xB4,0x2B,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0xD6,0x4B,0x39,0x54,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFB,0x73,0xEA,0x31,0xFA,0xBD,0xFA,0xBD,0xCA,0x39,0x9B,0x7B,0xB9,0x83,0x99,0xCE,0x18,0xC6,0xED,0x49,0x3B,0x8B,0x1B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBA,0x8A,0x77,0x7A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0xF7,0x81,0x30,0x61,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x68,0x30,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x45,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x65,0x18,0x65,0x18,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x10,0x36,0x82,0xBC,0xA2,0xBC,0xA2,0x58,0x8A,0xA7,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC2,0x00,0x86,0x01,0x66,0x01,
-	0x66,0x01,0xA8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xCE,0x1A,0xEF,0x1A,0xEF,0x1A,0xF0,0x1A,0xF0,0x22,0xF5,0x33,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0xF7,0x4B,0x59,0x54,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFB,0x73,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x36,0x6B,0xB6,0xB5,0x99,0xCE,0xF2,0x62,0x3B,0x8B,0x1B,0x8B,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0xDB,0x92,0xFA,0x92,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0xF8,0x91,0x52,0x69,0x31,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xCD,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x66,0x20,
-	0x66,0x20,0x66,0x28,0x24,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x28,0x79,0x8A,0xBC,0xA2,0xBC,0xA2,0x58,0x8A,0xA7,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x5A,0x92,0xBC,0xA2,0x90,0x59,0x4F,0x51,0x9A,0x92,0xDC,0x9A,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x65,0x01,0x66,0x01,
-	0x86,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x2A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x0A,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xCE,0x1A,0xEF,0x1A,0xEF,0x1A,0x31,0x23,0x31,0x23,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xD7,0x4B,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xB7,0x6B,0x9B,0x94,0x9B,0x94,0x97,0x73,0x9B,0x7B,0x8F,0x5A,0xD0,0x62,0x5B,0x8B,0x5B,0x8B,0x3B,0x8B,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xDB,0x92,0x99,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x93,0x69,0x31,0x61,0x30,0x61,0x30,0x59,0x0F,0x59,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x68,0x30,
-	0x66,0x20,0x66,0x20,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x10,0xDC,0x9A,0x9A,0x92,0x50,0x59,0x50,0x59,0xBC,0xA2,0xDC,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x38,0x1F,0xB3,0x0B,0x39,0x00,0x00,0x00,0x00,0xA8,0x28,0xDD,0xA2,0x6F,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x04,0x01,0x66,0x01,
-	0x87,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x8D,0x1A,0xCE,0x1A,0xEF,0x1A,0x10,0x1B,0x10,0x23,0x10,0x23,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x4B,0x17,0x4C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0x14,0x7C,0xBA,0xD6,0xBE,0xF7,0xBE,0xF7,0xBA,0xD6,0xF4,0x7B,0x9B,0x83,0x7B,0x83,0x5B,0x8B,0x5B,0x8B,0x3B,0x8B,0x1B,0x8B,0x1B,0x93,0x1B,0x93,0xDB,0x92,0xFB,0x92,0xBA,0x8A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x94,0x71,0x31,0x61,0x31,0x61,0x30,0x59,0x0F,0x59,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xAB,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,
-	0x66,0x20,0x65,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x59,0xFD,0xAA,0xC8,0x28,0x00,0x00,0x00,0x00,0x91,0x61,0x1F,0xB3,0xA7,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x49,0xFE,0xAA,0xC8,0x28,0x00,0x00,0x00,0x00,0x85,0x18,0xDC,0xA2,0x15,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xC3,0x00,0x66,0x01,
-	0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x0A,0x4B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x8D,0x1A,0x8D,0x1A,0xEF,0x1A,0x10,0x1B,0x10,0x23,0x52,0x23,0x77,0x3C,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0x38,0x4C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xD6,0x63,0xBA,0xD6,0xBF,0xF7,0x9E,0xDE,0x9E,0xDE,0xBF,0xF7,0xBA,0xD6,0x77,0x7B,0x7B,0x83,0xEA,0x41,0xF7,0xBD,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0x09,0x4A,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x44,0x10,0xF5,0x71,0xBB,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x18,0x1F,0xB3,0x15,0x7A,0x00,0x00,0x00,0x00,0x91,0x59,0xFE,0xAA,0x57,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x87,0x01,
-	0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x0A,0x4B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0x6D,0x1A,0xEF,0x1A,0x31,0x23,0x10,0x1B,0x52,0x23,0x77,0x3C,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0x38,0x4C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xDA,0x84,0xBE,0xF7,0x9E,0xDE,0x5E,0xA4,0x5E,0xA4,0x9E,0xDE,0xBE,0xF7,0x7B,0x9C,0xF6,0x6A,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x57,0x82,0x9B,0x9A,0xDC,0xA2,0xC8,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x59,0xFE,0xAA,0xFD,0xA2,0xBB,0x92,0x9B,0x9A,0xDD,0xA2,0x36,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0x87,0x01,
-	0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x0A,0x4B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x8D,0x1A,0x6D,0x1A,0xEF,0x1A,0x31,0x23,0x10,0x23,0x52,0x23,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xB6,0x43,0x59,0x54,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xBB,0x8C,0xBE,0xF7,0x9E,0xDE,0x5E,0xA4,0x5E,0xA4,0x9E,0xDE,0xBE,0xF7,0x7B,0x9C,0xD6,0x6A,0x96,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x41,0x90,0x59,0x9A,0x92,0x9A,0x92,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0xA6,0x20,0x6F,0x59,0xE9,0x30,0xC9,0x30,0xBC,0xA2,0xB2,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA2,0x00,0x46,0x01,
-	0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x0A,0x4B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x8D,0x1A,0x8D,0x1A,0xEF,0x1A,0x10,0x23,0x10,0x23,0x52,0x23,0x98,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xB6,0x43,0x59,0x54,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xD6,0x63,0xBA,0xD6,0xBF,0xF7,0x9E,0xDE,0x9E,0xDE,0xBF,0xF7,0xBA,0xD6,0x77,0x7B,0x9B,0x83,0xEA,0x41,0x18,0xC6,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x09,0x4A,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x39,0x2D,0x49,0x22,0x08,0x00,0x00,0x00,0x00,0xE9,0x30,0xFE,0xAA,0x2D,0x49,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x16,0x7A,0x2E,0x49,0x00,0x00,0x00,0x00,0x2B,0x41,0xFE,0xAA,0xA7,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC4,0x00,0x05,0x09,
-	0xA8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x0A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x8D,0x1A,0xCE,0x1A,0xEF,0x1A,0x10,0x1B,0x10,0x23,0x10,0x23,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0x17,0x4C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0x14,0x7C,0xBA,0xD6,0xBE,0xF7,0xBE,0xF7,0xBA,0xD6,0xD4,0x83,0x9B,0x83,0x7B,0x83,0x5B,0x83,0x5B,0x8B,0x3B,0x8B,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0xDB,0x92,0xFB,0x92,0xBA,0x8A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x94,0x71,0x31,0x61,0x31,0x61,0x30,0x61,0x0F,0x59,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xEE,0x58,0xAB,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,
-	0x27,0x30,0x25,0x28,0x03,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD2,0x61,0xDD,0xA2,0xC8,0x28,0x00,0x00,0x00,0x00,0x2C,0x41,0x1F,0xB3,0xEA,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x82,0xDD,0xA2,0xF4,0x69,0xF4,0x69,0xDD,0xA2,0xD4,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x05,0x01,0x05,0x09,
-	0x66,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xAE,0x1A,0xEF,0x1A,0xEF,0x1A,0x31,0x23,0x31,0x23,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0x17,0x4C,0x7A,0x5C,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFB,0x73,0xB7,0x6B,0x9B,0x94,0x9B,0x94,0x97,0x73,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x5B,0x83,0x5B,0x8B,0x3B,0x8B,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xBB,0x92,0xB9,0x8A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0x19,0x9A,0x52,0x69,0x31,0x61,0x31,0x61,0x30,0x59,0x0F,0x59,0xEE,0x50,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0x8B,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x48,0x38,
-	0x26,0x28,0x26,0x30,0x03,0x10,0x23,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x20,0xDC,0x9A,0xBB,0x9A,0xF4,0x69,0x36,0x7A,0xDD,0xA2,0x5A,0x92,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x10,0xF4,0x71,0x9A,0x92,0x79,0x92,0xD3,0x69,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA3,0x00,0x26,0x09,0x26,0x09,
-	0x25,0x01,0xC8,0x01,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x6D,0x1A,0xCE,0x1A,0xCF,0x1A,0xCF,0x1A,0x10,0x23,0xF0,0x1A,0xF5,0x33,0x57,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x43,0x59,0x54,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x9B,0x83,0x5B,0x83,0x5B,0x8B,0x1B,0x8B,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0xFB,0x92,0x98,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0xF8,0x91,0x92,0x69,0x31,0x61,0x30,0x61,0x30,0x61,0x30,0x59,0xEE,0x50,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xCD,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x30,
-	0x26,0x30,0x27,0x30,0x04,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x20,0x36,0x82,0x9A,0x92,0x79,0x92,0xF4,0x71,0x43,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x10,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE4,0x00,0x26,0x09,0x26,0x09,
-	0x05,0x09,0x87,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x2B,0x12,0x4B,0x12,0xAD,0x1A,0xAD,0x1A,0xAD,0x1A,0x8D,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xEF,0x22,0xF0,0x1A,0xB4,0x2B,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0xD6,0x4B,0x59,0x54,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x7B,0x83,0x5B,0x8B,0x5B,0x8B,0x1B,0x8B,0x1B,0x8B,0x1B,0x93,0xDB,0x92,0xDA,0x8A,0x57,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x18,0x92,0xF7,0x89,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xEE,0x58,0xAC,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x48,0x38,0x26,0x28,
-	0x27,0x30,0x27,0x30,0x05,0x28,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x10,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xE4,0x00,0x26,0x09,0x26,0x09,
-	0x05,0x09,0x25,0x09,0xC8,0x01,0xC8,0x09,0xC8,0x09,0xA8,0x01,0x0A,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0xAD,0x1A,0x8D,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0x10,0x23,0x72,0x23,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x37,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xD7,0x4B,0x7A,0x5C,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x5B,0x8B,0x5B,0x8B,0x3B,0x8B,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0x1B,0x93,0x99,0x82,0x77,0x7A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x19,0x9A,0xD6,0x79,0x30,0x61,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x47,0x30,0x26,0x28,
-	0x27,0x30,0x27,0x30,0x06,0x30,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x05,0x01,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x05,0x09,0x67,0x01,0xC8,0x09,0xC8,0x09,0xA8,0x01,0x09,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x8C,0x12,0xAD,0x1A,0x8D,0x1A,0xAD,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0x31,0x23,0x57,0x34,0x57,0x3C,0x57,0x3C,0x17,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0x18,0x54,0x7A,0x5C,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x5B,0x8B,0x5B,0x8B,0x3B,0x8B,0x3B,0x8B,0x1B,0x93,0x1B,0x93,0xD9,0x8A,0x77,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0xF8,0x91,0x93,0x71,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x58,0xCD,0x50,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x26,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x26,0x30,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC2,0x00,0x25,0x01,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x25,0x09,0xC8,0x09,0xC8,0x09,0xC8,0x09,0x09,0x0A,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x8D,0x1A,0x8D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xEF,0x22,0x36,0x34,0x77,0x3C,0x57,0x3C,0x37,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xB6,0x4B,0x39,0x54,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x7B,0x83,0x5B,0x8B,0x5B,0x8B,0x1B,0x8B,0x1B,0x93,0xFA,0x8A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0xF8,0x91,0x51,0x61,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x0E,0x59,0xEE,0x50,0xEE,0x58,0xCC,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x89,0x30,0x69,0x38,0x69,0x38,0x27,0x30,0x26,0x28,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x26,0x30,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0x05,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x05,0x09,0xA7,0x09,0xC8,0x09,0xC8,0x09,0xE9,0x09,0x6B,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x4B,0x12,0x8D,0x1A,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xAE,0x1A,0x93,0x2B,0x77,0x3C,0x57,0x3C,0x57,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xB6,0x4B,0x5A,0x5C,0x5A,0x64,0x5A,0x64,0x3A,0x64,0x1A,0x6C,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x9B,0x83,0x5B,0x83,0x5B,0x8B,0x1B,0x8B,0x3B,0x8B,0x1B,0x93,0x98,0x82,0x97,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0xD6,0x81,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x0E,0x59,0xEE,0x50,0xED,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x89,0x30,0x69,0x38,0x48,0x38,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x05,0x09,0x26,0x09,0xC8,0x09,0xC8,0x09,0xE8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x0B,0x12,0x6C,0x12,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0xF0,0x22,0x36,0x34,0x57,0x3C,0x37,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0x19,0x5C,0x5A,0x64,0x1A,0x64,0x1A,0x6C,0x1A,0x6C,0xFA,0x6B,0xFB,0x73,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x5B,0x83,0x5B,0x8B,0x3B,0x8B,0x1A,0x8B,0xD9,0x7A,0x97,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x18,0x92,0x72,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x0E,0x59,0xED,0x50,0xAB,0x48,0xAB,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x69,0x38,0x47,0x30,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x25,0x28,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xC4,0x00,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x87,0x09,0xC8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0xAD,0x1A,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x73,0x2B,0x77,0x3C,0x37,0x3C,0x17,0x3C,0x17,0x44,0x17,0x44,
-	0x17,0x44,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x4B,0xB7,0x53,0xF9,0x63,0x3A,0x64,0x1A,0x6C,0x1A,0x6C,0xFB,0x73,0xFB,0x73,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x7B,0x83,0x5B,0x83,0x5B,0x8B,0x1A,0x8B,0xD8,0x72,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0xF7,0x81,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0x0E,0x59,0xCC,0x48,0xAB,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x6A,0x40,0x69,0x38,0x68,0x30,0x26,0x30,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x26,0x28,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x25,0x01,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0xA8,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x4B,0x12,0xEF,0x1A,0xEF,0x1A,0xCF,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0x11,0x23,0x36,0x34,0x57,0x3C,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x98,0x5B,0xF9,0x63,0xFA,0x6B,0xFA,0x6B,0xFA,0x6B,0xFB,0x73,0xBB,0x73,0xBB,0x7B,0xBB,0x7B,0x9B,0x7B,0x9B,0x83,0x9B,0x83,0x5A,0x83,0xF9,0x7A,0xB7,0x72,0xD8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x8A,0x18,0x92,0x72,0x69,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x30,0x61,0xEE,0x50,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8C,0x50,0x69,0x38,0x69,0x38,0x27,0x30,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x26,0x30,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x00,0xC3,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0x05,0x01,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x05,0x09,0x66,0x09,0xC8,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x2B,0x12,0xCE,0x1A,0xEF,0x1A,0xCF,0x22,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xD0,0x22,0x11,0x2B,0x77,0x3C,0x17,0x44,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0x97,0x53,0x77,0x5B,0x77,0x5B,0x78,0x63,0xB9,0x63,0xBA,0x6B,0xDA,0x73,0xDA,0x73,0x9A,0x7B,0x7A,0x7B,0x7A,0x7B,0x59,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x38,0x8A,0x38,0x92,0xB5,0x79,0x51,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0x0F,0x59,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x69,0x38,0x48,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0xC3,0x00,0xC3,0x00,0xA3,0x00,0xA3,0x00,0x25,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0x4A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x6D,0x1A,0x6D,0x1A,0xCF,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xAF,0x22,0xCF,0x22,0xF0,0x22,0x73,0x2B,0x37,0x3C,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x57,0x5B,0x57,0x5B,0x58,0x63,0x38,0x63,0x38,0x6B,0x38,0x6B,0x18,0x6B,0x18,0x6B,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x38,0x8A,0x38,0x8A,0xD6,0x79,0x71,0x59,0x71,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0x30,0x61,0xEE,0x58,0xEE,0x50,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x89,0x30,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0x25,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x05,0x09,0x25,0x09,0x2A,0x0A,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x8D,0x1A,0x6D,0x1A,0x6D,0x1A,0xCF,0x22,0xCF,0x22,0xCF,0x22,0xAF,0x22,0xCF,0x22,0xF1,0x2A,0xD0,0x2A,0xB4,0x33,0x17,0x44,0x17,0x44,
-	0xF7,0x43,0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0x97,0x53,0x77,0x5B,0x77,0x5B,0x57,0x5B,0x57,0x5B,0x58,0x63,0x38,0x63,0x38,0x6B,0x38,0x6B,0x18,0x6B,0x18,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x58,0x8A,0x17,0x82,0x91,0x61,0x51,0x61,0x71,0x59,0x30,0x59,0x30,0x59,0x30,0x59,0x30,0x61,0xEE,0x58,0xEE,0x50,0xEE,0x50,0xAC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x47,0x30,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x04,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x02,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x00,0xC3,0x00,0xA2,0x00,0xA2,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0xC8,0x09,0x6B,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x6C,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0xAF,0x1A,0xCF,0x22,0xCF,0x22,0xAF,0x22,0xF0,0x22,0xF0,0x22,0xD0,0x2A,0xD5,0x3B,0x17,0x44,
-	0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x38,0x63,0x38,0x6B,0x38,0x6B,0x18,0x6B,0x18,0x6B,0x18,0x73,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x97,0x7A,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x8A,0x37,0x82,0x92,0x61,0x91,0x59,0x52,0x61,0x30,0x59,0x30,0x59,0x30,0x59,0x2F,0x59,0x0E,0x51,0xEE,0x50,0xEE,0x50,0xED,0x50,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x8B,0x48,0x26,0x28,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x04,0x18,0x03,0x10,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0xA2,0x00,0xA2,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x26,0x09,0x4A,0x0A,0x6B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x4C,0x12,0x8D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x8E,0x1A,0xCF,0x22,0xAF,0x22,0xD0,0x22,0xF1,0x2A,0xD0,0x2A,0xF1,0x2A,0xD6,0x3B,
-	0xF7,0x43,0xF7,0x4B,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x63,0x38,0x6B,0x18,0x6B,0x18,0x6B,0x18,0x73,0x18,0x73,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x78,0x82,
-	0x58,0x82,0xB2,0x61,0x71,0x59,0x92,0x61,0x71,0x61,0x30,0x59,0x30,0x59,0x0E,0x51,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xCD,0x50,0xAB,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8C,0x50,0x8C,0x50,0x48,0x38,0x25,0x28,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x04,0x18,0x03,0x10,0x03,0x18,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x00,0xA2,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0xC8,0x09,0x4A,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x2C,0x1A,0x4D,0x22,0x8E,0x22,0x8E,0x22,0xF1,0x2A,0xF1,0x2A,0xD0,0x2A,0xB0,0x2A,
-	0xB5,0x43,0xF6,0x43,0xF7,0x4B,0xF7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0x97,0x53,0x77,0x5B,0x77,0x5B,0x57,0x5B,0x58,0x63,0x58,0x63,0x38,0x63,0x38,0x6B,0x38,0x6B,0x18,0x6B,0x18,0x73,0x18,0x73,0xF8,0x72,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x97,0x72,0x98,0x7A,0x98,0x7A,0x78,0x7A,0x78,0x82,0x78,0x82,0x37,0x7A,
-	0x91,0x59,0x91,0x59,0x92,0x61,0x72,0x61,0x51,0x59,0x2F,0x51,0x0E,0x49,0x0E,0x49,0x0E,0x51,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xCC,0x40,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8A,0x40,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x04,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0xC3,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0x09,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x4B,0x12,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0xCF,0x22,0xF1,0x2A,0xF1,0x2A,0xD0,0x2A,
-	0xD0,0x2A,0x94,0x33,0xD7,0x4B,0xD7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x57,0x5B,0x58,0x63,0x58,0x63,0x58,0x63,0x38,0x63,0x38,0x6B,0x18,0x6B,0x18,0x6B,0x18,0x73,0xF8,0x72,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xD8,0x72,0x97,0x72,0x98,0x7A,0x98,0x7A,0x98,0x7A,0x98,0x82,0x16,0x7A,0x91,0x59,
-	0x91,0x59,0x92,0x61,0x72,0x61,0x71,0x59,0x2E,0x49,0x0D,0x49,0x0E,0x49,0x0E,0x51,0x0E,0x51,0xEE,0x50,0xEE,0x50,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8B,0x48,0x69,0x38,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x24,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x00,0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x47,0x09,0xA8,0x09,0x29,0x0A,0x4B,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x12,0x6C,0x1A,0x6D,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x22,0x2C,0x22,0xB0,0x2A,0xD0,0x2A,0xD0,0x2A,
-	0xF1,0x2A,0x90,0x2A,0xF2,0x3A,0xB7,0x4B,0xD7,0x4B,0xD8,0x53,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x38,0x63,0x38,0x6B,0x38,0x6B,0x18,0x6B,0x18,0x73,0x18,0x73,0xF8,0x72,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x98,0x72,0x98,0x7A,0x98,0x7A,0x98,0x82,0x14,0x6A,0x90,0x51,0x91,0x59,
-	0x91,0x59,0x91,0x59,0x70,0x59,0x2E,0x51,0x0E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xEE,0x50,0xEE,0x50,0xEE,0x50,0xCC,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8B,0x48,0x49,0x38,0x27,0x38,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x30,0x04,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x25,0x09,0x26,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x26,0x09,0xA8,0x09,0xA8,0x09,0x4A,0x0A,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0C,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x6E,0x2A,0x8F,0x22,0x6F,0x2A,
-	0x8F,0x2A,0xD0,0x2A,0xB0,0x2A,0x90,0x32,0x34,0x43,0xB7,0x4B,0xB7,0x53,0xB7,0x53,0xB7,0x53,0x77,0x53,0x77,0x5B,0x57,0x5B,0x58,0x63,0x58,0x63,0x38,0x63,0x38,0x6B,0x38,0x6B,0x18,0x6B,0x18,0x73,0x18,0x73,0xF8,0x72,0xD8,0x72,0xF8,0x72,0xD8,0x72,0xB8,0x72,0xB8,0x7A,0x97,0x7A,0x76,0x72,0xB2,0x61,0x91,0x59,0x91,0x59,0x91,0x59,
-	0x90,0x51,0x50,0x51,0x2F,0x51,0x2E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0x0E,0x51,0xEE,0x50,0xED,0x48,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8B,0x48,0x6A,0x40,0x49,0x38,0x27,0x38,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x27,0x30,0x27,0x38,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x08,0x25,0x09,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0xA8,0x09,0x87,0x09,0xC9,0x09,0x4B,0x0A,0x4B,0x12,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x12,0x4C,0x1A,0x6D,0x1A,0x6D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x6E,0x2A,0x6F,0x2A,
-	0x6F,0x32,0x4E,0x2A,0x6F,0x32,0xB0,0x2A,0x4F,0x32,0xB1,0x32,0x54,0x43,0x77,0x53,0x98,0x5B,0x97,0x5B,0x77,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x38,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0xF8,0x72,0xD8,0x72,0xD8,0x72,0xB8,0x72,0x76,0x72,0xF2,0x59,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x50,0x51,0x70,0x51,0x2E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0x0E,0x51,0x0E,0x51,0xED,0x50,0xCB,0x40,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0xAC,0x48,0x8A,0x40,0x69,0x38,0x69,0x38,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x26,0x30,0x05,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x08,0xA3,0x08,0x26,0x09,0x26,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x87,0x09,0xA8,0x09,0xA8,0x09,0xE9,0x09,0x4B,0x0A,0x4B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x12,0x4C,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x8F,0x22,
-	0x6F,0x32,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4E,0x32,0x4F,0x32,0x70,0x32,0xB2,0x42,0x15,0x4B,0x36,0x5B,0x77,0x5B,0x58,0x63,0x58,0x63,0x78,0x63,0x38,0x6B,0x38,0x6B,0x38,0x6B,0x18,0x73,0x18,0x73,0x18,0x73,0xB6,0x6A,0x75,0x62,0x74,0x5A,0xF1,0x51,0x8F,0x41,0x90,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x50,0x59,0x2F,0x49,0x2E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0x0E,0x51,0xEE,0x50,0xCC,0x40,0xCB,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAC,0x48,0x8A,0x40,0x69,0x38,0x69,0x38,0x49,0x38,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x27,0x30,0x27,0x30,0x05,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x62,0x08,0x83,0x08,0x25,0x09,
-	0x26,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x46,0x09,0xA8,0x09,0xA8,0x09,0x87,0x09,0x09,0x0A,0x4B,0x0A,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x12,0x0B,0x1A,0x4C,0x1A,0x4D,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4E,0x2A,
-	0x6F,0x2A,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x50,0x3A,0x31,0x42,0x92,0x3A,0x92,0x42,0xB4,0x52,0xB4,0x52,0xB4,0x52,0xB4,0x52,0x93,0x52,0x32,0x4A,0x32,0x4A,0x11,0x4A,0xD0,0x49,0xB0,0x49,0xB0,0x49,0x90,0x49,0x90,0x49,0x90,0x49,0x90,0x51,0x90,0x51,0x70,0x51,0x70,0x51,
-	0x70,0x51,0x2E,0x49,0x2E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0x0E,0x49,0x0E,0x51,0xCC,0x48,0xCB,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAC,0x48,0xAB,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x48,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x26,0x30,0x05,0x20,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x83,0x08,0x62,0x08,0xA3,0x08,
-	0x05,0x09,0x26,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x87,0x09,0xE9,0x09,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0xEB,0x11,0xEB,0x19,0x4C,0x1A,0x4D,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,
-	0x6F,0x2A,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x30,0x42,0x30,0x42,0x30,0x42,0x31,0x4A,0x31,0x4A,0x11,0x4A,0x11,0x4A,0x10,0x4A,0x10,0x4A,0x32,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0x90,0x49,0x90,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,
-	0x2E,0x49,0x2E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x49,0x0E,0x51,0x0D,0x49,0xEC,0x40,0xCB,0x40,0xEC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x8B,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x27,0x30,0x27,0x30,
-	0x05,0x20,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0x83,0x08,0x62,0x08,
-	0x83,0x08,0x05,0x09,0x26,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x67,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x09,0x2A,0x0A,0x2B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x11,0x0C,0x1A,0x4D,0x22,0x4D,0x22,0x4D,0x22,0x4D,0x22,0xED,0x21,
-	0x4D,0x22,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x2F,0x3A,0x30,0x42,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x10,0x4A,0x10,0x4A,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x70,0x51,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x49,0x0D,0x49,0x0D,0x49,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x40,0xEC,0x40,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xAB,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x49,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x28,0x04,0x20,
-	0x03,0x10,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x00,0x83,0x08,0x83,0x08,
-	0x63,0x08,0x62,0x08,0xE4,0x08,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x26,0x09,0xA8,0x09,0xA8,0x09,0xA8,0x09,0x88,0x09,0x88,0x09,0x0B,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x11,0xEB,0x19,0xEB,0x19,0x2C,0x22,0x4D,0x22,0x4D,0x22,0x2D,0x22,
-	0x2D,0x22,0x2D,0x22,0x6F,0x32,0x6F,0x32,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x2F,0x3A,0x31,0x4A,0x31,0x4A,0xF0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0x90,0x49,0x90,0x51,0x90,0x51,0x90,0x51,0x90,0x51,0x6F,0x51,0x2E,0x49,
-	0x2E,0x49,0x2E,0x49,0x2E,0x49,0x0E,0x49,0xEC,0x40,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x40,0xEC,0x40,0xCB,0x40,0xCC,0x48,0xCC,0x48,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x28,0x26,0x28,0x26,0x28,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x00,0x83,0x08,0x83,0x08,
-	0x83,0x08,0x63,0x08,0x62,0x08,0xE4,0x08,0x05,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0xA8,0x09,0xA8,0x09,0x88,0x09,0x88,0x09,0x88,0x09,0x88,0x09,0x2A,0x12,0x2B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xEB,0x19,0x0C,0x22,0x2C,0x22,
-	0x2D,0x22,0x2E,0x2A,0x2E,0x2A,0x6F,0x32,0x4F,0x32,0x4F,0x32,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0x4F,0x3A,0xEF,0x41,0xCF,0x41,0xAD,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xCF,0x41,0xCF,0x41,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xD0,0x49,0xB0,0x49,0xB0,0x49,0x90,0x49,0x90,0x49,0x90,0x51,0x6F,0x49,0x2E,0x49,0x2E,0x49,
-	0x0D,0x41,0x0D,0x41,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0xAB,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x27,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x30,0x26,0x30,0x26,0x30,0x26,0x28,0x03,0x10,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x83,0x08,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0xA3,0x08,0x05,0x09,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x87,0x09,0xA8,0x09,0xA8,0x09,0x88,0x09,0x88,0x09,0x88,0x11,0x88,0x09,0x0B,0x12,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,0xCB,0x19,0xCB,0x19,
-	0xCB,0x19,0xCB,0x21,0xEB,0x21,0xED,0x29,0x4E,0x2A,0x2E,0x2A,0x4E,0x32,0x2E,0x2A,0x0D,0x32,0x0D,0x32,0xED,0x31,0xCE,0x31,0xCD,0x29,0xAE,0x39,0xAD,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0xAE,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0xAF,0x41,0x8F,0x49,0x8E,0x41,0x90,0x51,0x6E,0x41,0x0C,0x39,0x0C,0x39,0x0C,0x39,
-	0x0B,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x48,0xCC,0x48,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x49,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x04,0x20,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x08,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x62,0x08,0xE4,0x08,0x26,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x26,0x09,0xA8,0x09,0x88,0x09,0x88,0x09,0x88,0x09,0x88,0x11,0x88,0x11,0x88,0x09,0x0A,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x19,0xAB,0x21,0xED,0x29,0xED,0x29,0xED,0x29,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xCD,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x6E,0x41,0x4D,0x41,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x0B,0x39,0x0B,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x40,0xCC,0x40,0xAB,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x48,0x38,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x05,0x28,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x62,0x08,0xA3,0x08,0x05,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x87,0x09,0xA8,0x09,0x88,0x09,0x88,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x0B,0x12,0x0B,0x12,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x19,0xAB,0x21,0xEC,0x21,0xED,0x29,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xED,0x31,0xCD,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x39,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x8E,0x41,0x6E,0x41,0x2C,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x40,0xCC,0x40,0xCC,0x40,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x6A,0x40,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x05,0x20,0x03,0x10,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x83,0x08,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x62,0x08,0x63,0x08,0xC4,0x08,0x05,0x09,0x05,0x09,0x47,0x09,0xA8,0x09,0x88,0x09,0x88,0x09,0x88,0x09,0x88,0x11,0x88,0x11,0x68,0x11,0x88,0x11,0xEA,0x11,0x0B,0x1A,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAC,0x21,0xEC,0x29,0xED,0x29,0xED,0x31,0xED,0x31,0xCD,0x31,0xCD,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x39,0x8E,0x39,0x8E,0x41,0x6D,0x39,0x4C,0x39,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCC,0x40,0xCB,0x40,0x89,0x38,0x89,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x38,0x26,0x28,0x26,0x28,0x05,0x20,0x03,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x00,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x82,0x08,0xC4,0x08,0x25,0x09,0xA8,0x09,0x88,0x09,0x88,0x09,0x88,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0x68,0x11,0xC9,0x19,0x0B,0x1A,0x0B,0x1A,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xCD,0x29,0xED,0x31,0xCD,0x31,0xAE,0x39,0xAE,0x39,0xAE,0x39,0x8E,0x39,0x8E,0x39,0x8E,0x39,0x8E,0x39,0x6C,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x40,0xA9,0x30,0xA9,0x30,0x69,0x30,0x69,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x27,0x28,0x05,0x20,0x04,0x18,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0x63,0x08,0x26,0x09,0xA8,0x09,0x88,0x09,0x88,0x09,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0xC9,0x11,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x8B,0x29,0xAC,0x29,0xAC,0x29,0x8D,0x31,0x8D,0x31,0x8D,0x31,0x6C,0x31,0x4B,0x31,0x4B,0x29,0x2B,0x31,0x2B,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xEC,0x40,0xCB,0x38,0x88,0x30,0x89,0x30,0x69,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x69,0x38,0x48,0x30,0x03,0x18,0x03,0x10,0x03,0x10,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x05,0x09,0x67,0x09,0x88,0x09,0xA8,0x09,0x88,0x11,0x88,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x89,0x11,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x4A,0x31,0x6B,0x31,0x4B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEC,0x40,0xEC,0x40,0xCA,0x38,0x88,0x30,0xA9,0x30,0x69,0x30,0x69,0x30,0x89,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x48,0x30,0x27,0x30,0x03,0x18,0x03,0x10,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,
-	0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x0C,0x63,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x42,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xA4,0x08,0x05,0x09,0x06,0x09,0x46,0x09,0x67,0x11,0x88,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0x88,0x11,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEC,0x38,0xEB,0x40,0xCA,0x38,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x89,0x30,0x69,0x38,0x69,0x38,0x69,0x38,0x48,0x30,0x26,0x28,0x26,0x28,0x05,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x0C,0x63,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x83,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x05,0x09,0x05,0x09,0x05,0x09,0x05,0x09,0x26,0x09,0x46,0x09,0x68,0x11,0x88,0x11,0x88,0x11,0x68,0x11,0x68,0x11,0x68,0x11,0xCA,0x19,0xEB,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0x0C,0x39,0xEC,0x38,0xEB,0x38,0xA9,0x30,0xA9,0x30,0xA9,0x30,0xA9,0x30,0x89,0x30,0x68,0x30,0x67,0x28,0x47,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x25,0x28,0x03,0x18,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x21,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0xC4,0x08,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x05,0x09,0x05,0x09,0x06,0x09,0x47,0x09,0x67,0x11,0x88,0x11,0x68,0x11,0x68,0x11,0xAA,0x19,0xEB,0x19,0xEB,0x19,0xCB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0xEB,0x38,0xEB,0x30,0xA9,0x30,0x88,0x30,0xA9,0x30,0xA9,0x30,0x88,0x28,0x47,0x28,0x46,0x28,0x46,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x05,0x20,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x49,0x4A,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xE5,0x08,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0xE5,0x08,0x06,0x09,0x05,0x09,0x05,0x09,0x26,0x11,0x27,0x11,0x68,0x11,0x89,0x19,0xCB,0x19,0xEB,0x19,
-	0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x2B,0x39,0x0C,0x39,0x0C,0x39,
-	0x0C,0x39,0x0C,0x39,0xCA,0x38,0xA9,0x30,0x68,0x28,0x87,0x28,0x66,0x20,0x46,0x20,0x46,0x28,0x46,0x28,0x46,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x26,0x28,0x03,0x18,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x83,0x08,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x05,0x09,0xE5,0x08,0xE5,0x10,0x05,0x09,0x26,0x11,0x89,0x19,
-	0xCB,0x19,0xCB,0x19,0xAB,0x21,0xAB,0x21,0xCB,0x21,0xCB,0x21,0xAB,0x21,0xAB,0x29,0xAB,0x29,0xAB,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x4B,0x31,0x4C,0x31,0x4C,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x39,0x0B,0x39,0x0B,0x39,0x0B,0x31,0x0B,0x31,
-	0xEA,0x38,0xC8,0x28,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x46,0x28,0x04,0x18,0x03,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xC4,0x08,0x26,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE5,0x10,0x05,0x09,0xE5,0x10,0xE5,0x10,
-	0xE6,0x10,0x68,0x11,0x69,0x19,0x69,0x19,0x69,0x19,0x69,0x21,0x89,0x21,0x89,0x21,0xAB,0x21,0xAB,0x21,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x8B,0x29,0x6B,0x29,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x6B,0x31,0x4B,0x31,0x2B,0x31,0x2B,0x31,0x2B,0x31,0x2A,0x31,0x09,0x29,0x09,0x29,0xE9,0x28,0xE9,0x28,0xE9,0x28,0x87,0x20,
-	0x65,0x20,0x65,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x26,0x28,0x25,0x20,0x03,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xE5,0x08,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,0xE6,0x10,
-	0xE5,0x10,0xC5,0x10,0x07,0x19,0x48,0x19,0x48,0x19,0x48,0x11,0x28,0x19,0x28,0x19,0x49,0x19,0x49,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x09,0x21,0x09,0x21,0x29,0x21,0x09,0x21,0x09,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0xE8,0x20,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE8,0x28,0xC8,0x20,0x66,0x20,0x66,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x25,0x28,0x03,0x18,0x22,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x83,0x08,0x05,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE5,0x10,0xC5,0x10,0xE6,0x10,0x27,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x49,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x29,0x09,0x29,0x09,0x29,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0xE9,0x28,0x86,0x20,0x65,0x18,0x66,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x26,0x28,0x24,0x18,0x02,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xE4,0x08,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0x06,0x11,0x28,0x19,0x48,0x19,0x49,0x19,0x49,0x19,0x29,0x21,0x29,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x08,0x21,0x09,0x21,0x09,0x21,0x09,0x29,0x08,0x21,0x09,0x29,0xE9,0x28,0x09,0x29,0x09,0x29,0xE8,0x20,0xC7,0x20,0x85,0x18,0x85,0x18,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x46,0x20,0x03,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xC4,0x08,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x27,0x19,0x49,0x19,0x29,0x21,0x29,0x19,0x29,0x21,0x29,0x21,0x29,0x21,0x29,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x08,0x21,0x09,0x29,0x09,0x29,0x08,0x21,0xA7,0x20,0x85,0x18,0x85,0x18,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x46,0x28,0x45,0x28,0x03,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x02,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x62,0x00,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0xE5,0x08,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0x06,0x11,0x28,0x19,0x28,0x19,0x29,0x21,0x29,0x19,0x29,0x21,0x09,0x21,0x08,0x21,0x08,0x21,0x09,0x21,0x09,0x21,0x09,0x29,0xE8,0x20,0xC7,0x18,0x85,0x18,0x85,0x18,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x20,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x05,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0x07,0x19,0x28,0x19,0x49,0x21,0x08,0x21,0x29,0x21,0x09,0x21,0x08,0x21,0xE7,0x20,0xC7,0x18,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x66,0x28,0x23,0x18,0x02,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x23,0x18,0x03,0x18,0x02,0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x62,0x00,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x83,0x08,0x05,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x10,0xC5,0x10,0xE7,0x18,0x08,0x21,0x08,0x21,0xE8,0x20,0xA6,0x18,0x85,0x18,0x85,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x66,0x28,0x24,0x18,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x10,0x23,0x18,0x03,0x18,0x03,0x18,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x62,0x08,0x83,0x08,0x06,0x09,0x06,0x09,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC6,0x10,0xE6,0x10,0xA5,0x10,0x63,0x10,0x63,0x08,0x63,0x08,0x63,0x10,0x85,0x10,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x18,0xA6,0x20,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x28,0x66,0x28,0x24,0x18,0x22,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x18,0x23,0x18,0x22,0x10,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x00,0x62,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0x83,0x08,0xE5,0x08,0x06,0x09,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x08,0xC5,0x08,0x84,0x08,0x62,0x08,0x42,0x08,0x42,0x08,0x63,0x08,0x63,0x08,0x42,0x08,0x42,0x08,0x43,0x08,0x64,0x08,0x64,0x10,0x86,0x18,0x86,0x18,0x86,0x18,0xA6,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x44,0x18,0x22,0x10,0x23,0x10,0x23,0x10,0x22,0x10,0x23,0x10,0x02,0x08,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x00,0x62,0x08,0x62,0x08,0x63,0x08,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0x06,0x11,0xE6,0x10,
-	0x06,0x11,0xE6,0x10,0xE6,0x10,0xC5,0x10,0xC5,0x08,0xC4,0x08,0xA4,0x08,0x83,0x08,0x63,0x08,0x62,0x08,0x63,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x42,0x08,0x43,0x08,0x42,0x08,0x42,0x08,0x43,0x08,0x64,0x10,0x85,0x10,0x85,0x18,0x85,0x18,0x66,0x20,0x86,0x20,0x86,0x20,
-	0x86,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x66,0x20,0x67,0x28,0x44,0x18,0x22,0x10,0x22,0x10,0x01,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,0xA3,0x00,
-	0x83,0x08,0x83,0x00,0x82,0x00,0x83,0x08,0x62,0x08,0x62,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x08,0x42,0x08,0x22,0x08,0x42,0x08,0x43,0x10,0x22,0x10,0x43,0x10,0x23,0x10,
-	0x23,0x10,0x23,0x10,0x23,0x10,0x23,0x10,0x44,0x18,0x02,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x83,0x00,0x82,0x00,0x82,0x00,
-	0x82,0x00,0x82,0x00,0x82,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x22,0x10,0x42,0x08,0x22,0x10,
-	0x22,0x10,0x22,0x10,0x22,0x10,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x83,0x00,0x83,0x00,
-	0x83,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x23,0x10,0x23,0x10,0x01,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x00,
-	0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,
-	0x42,0x08,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x00,0x63,0x00,0x82,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x08,0x21,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x62,0x00,0x83,0x08,0x83,0x08,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x43,0x10,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x62,0x00,0x83,0x08,0x83,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x43,0x10,0x43,0x10,0x43,0x10,0x42,0x08,0x43,0x08,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x42,0x08,0x62,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x43,0x08,0x43,0x08,0x42,0x08,0x42,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x41,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x42,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x0C,0x63,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x0C,0x63,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0x0C,0x63,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x0C,0x63,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x08,0x65,0x18,0x64,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x49,0x4A,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x41,0x79,0x92,0xBC,0xA2,0xBB,0x9A,0x15,0x72,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x20,0xBC,0xA2,0x38,0x82,0xEC,0x38,0xB3,0x69,0xFE,0xAA,0xD2,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x61,0xDC,0x9A,0x22,0x08,0x00,0x00,0x21,0x08,0x4E,0x51,0x2D,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9A,0x92,0xF5,0x79,0xE9,0x30,0xF5,0x71,0xD3,0x69,0xC8,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0x9B,0x9A,0xBC,0x9A,0x17,0x82,0x9A,0x92,0xFE,0xAA,0x4E,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0xDD,0xA2,0x65,0x20,0x00,0x00,0x43,0x10,0x9A,0x92,0x79,0x92,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0x9A,0x37,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x82,0xBC,0x9A,0x64,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x71,0xDC,0x9A,0x43,0x10,0x00,0x00,0x22,0x08,0x79,0x92,0x7A,0x92,0x22,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x28,0xDD,0xA2,0x79,0x8A,0xF4,0x69,0x58,0x8A,0xFE,0xAA,0x6F,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x30,0x57,0x82,0x9A,0x92,0x79,0x8A,0x2D,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x10,0x21,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_75_2_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_75_2_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_75_2_dial_img_preview_data_0};
-
-    
\ No newline at end of file
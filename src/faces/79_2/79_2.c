@@ -279,9 +279,11 @@ void init_face_79_2(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_t
     lv_obj_set_y(face_79_2_19_144206, 23);
     lv_obj_add_flag(face_79_2_19_144206, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_79_2_19_144206, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_79_2_0_404);
+	face_compositor_static(face_79_2_9_59456);
 
 
-    callback("Blue", &face_79_2_dial_img_preview_0, &face_79_2, NULL);
+    callback("Blue", NULL, &face_79_2, NULL);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_79_2 // (Blue) uncomment to enable or define it elsewhere
 
@@ -86,8 +87,6 @@ extern "C"
 	LV_IMG_DECLARE(face_79_2_dial_img_19_144206_4);
 	LV_IMG_DECLARE(face_79_2_dial_img_19_144206_5);
 	LV_IMG_DECLARE(face_79_2_dial_img_19_144206_6);
-	LV_IMG_DECLARE(face_79_2_dial_img_preview_0);
-	LV_IMG_DECLARE(face_79_2_dial_img_preview_0);
 
 
 #endif
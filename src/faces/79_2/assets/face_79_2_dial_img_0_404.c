@@ -5,6 +5,7 @@
 // Watchface: 79_2
 
 #include "../79_2.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,1813 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_79_2_dial_img_0_404_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x82,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0xC3,0x18,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x41,0x08,0x20,0x00,
-	0x82,0x10,0xC3,0x18,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,
-	0xA2,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xC3,0x18,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0xC3,0x18,0x41,0x08,0x20,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0x04,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x04,0x21,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x82,0x10,
-	0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x20,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x04,0x21,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0x04,0x21,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0xE3,0x18,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,
-	0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x24,0x21,0xE3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,
-	0x04,0x21,0x41,0x08,0x41,0x08,0x82,0x10,0x24,0x21,0x04,0x21,0xA2,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x04,0x21,0x04,0x21,0x61,0x08,0x20,0x00,0x82,0x10,0x24,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x61,0x08,0xA2,0x10,0x04,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xE3,0x18,0x24,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x04,0x21,0x41,0x08,0x20,0x00,0x82,0x10,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x04,0x21,0x61,0x08,0x20,0x00,0x61,0x08,0x24,0x21,0x04,0x21,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x24,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0xE3,0x18,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0xA2,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x45,0x29,0xC3,0x18,0x41,0x08,0x61,0x08,0x45,0x29,0x24,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x45,0x29,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x04,0x21,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,
-	0x41,0x08,0x61,0x08,0xE3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x04,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x04,0x21,
-	0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0x24,0x29,0x65,0x29,0xC3,0x18,0x41,0x08,0x20,0x00,0x04,0x21,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x04,0x21,0xC3,0x18,0x20,0x00,0x61,0x08,
-	0xE3,0x18,0x65,0x29,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x04,0x21,0x24,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x04,0x21,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x61,0x08,0x04,0x21,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x24,0x21,0x65,0x29,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0x65,0x29,0x45,0x29,0xA2,0x10,0x20,0x00,0x41,0x08,
-	0xC3,0x18,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x65,0x29,0x45,0x29,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x65,0x29,0x45,0x29,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x65,0x29,0x04,0x21,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x04,0x21,0x04,0x21,0x41,0x08,0x20,0x00,0x61,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0xA2,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0x04,0x21,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0x65,0x29,0xE3,0x18,0x61,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0xA6,0x31,0x24,0x29,0x82,0x10,0x20,0x00,0x04,0x21,0xC3,0x18,0x20,0x00,0xA2,0x10,0x65,0x29,0x86,0x31,0xE3,0x18,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x04,0x21,0x45,0x29,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,
-	0x61,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xE3,0x18,0xE3,0x18,0x41,0x08,0x20,0x00,0xA2,0x10,0x24,0x29,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x45,0x29,0x24,0x21,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x45,0x29,0xE3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0x65,0x29,
-	0xA6,0x31,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0x24,0x21,0xA6,0x31,0x45,0x29,0xC3,0x18,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0x04,0x21,0x45,0x29,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,
-	0x41,0x08,0x82,0x10,0x24,0x21,0x24,0x21,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x24,0x21,0x82,0x10,0x20,0x00,0x41,0x08,0x04,0x21,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0xE3,0x18,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x04,0x21,0x41,0x08,0x41,0x08,0x82,0x10,0x45,0x29,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0x65,0x29,0x86,0x31,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xA6,0x31,0x86,0x31,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0xE3,0x18,0x00,0x00,0x61,0x08,0x04,0x21,0xA6,0x31,0xA6,0x31,0x04,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x86,0x31,0x86,0x31,0xE3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x86,0x31,0x45,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x04,0x21,0x24,0x21,0x61,0x08,0x41,0x08,0x61,0x08,0x04,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xE3,0x18,0xC3,0x18,0x20,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x04,0x21,0x41,0x08,
-	0x20,0x00,0xA2,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x45,0x29,0xA2,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0x04,0x21,0x82,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x86,0x31,0xE3,0x18,0x82,0x10,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0x00,0x00,0xA2,0x10,0x24,0x21,0xC7,0x39,0x65,0x29,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0x86,0x31,0xC7,0x39,0x04,0x21,0x82,0x10,0x00,0x00,0xE3,0x18,0x82,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x24,0x21,0x86,0x31,0xC3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0x41,0x08,
-	0x41,0x08,0x82,0x10,0x04,0x21,0xE3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x45,0x29,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x82,0x10,0x20,0x00,0x41,0x08,0x04,0x21,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x04,0x21,0x41,0x08,0x20,0x00,0xC3,0x18,0x45,0x29,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x86,0x31,0x45,0x29,
-	0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x82,0x10,0xE3,0x18,0x86,0x31,0x04,0x21,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0x86,0x31,0xC7,0x39,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,
-	0x24,0x29,0xE7,0x39,0x65,0x29,0xC3,0x18,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x24,0x21,0x86,0x31,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x65,0x29,0x65,0x29,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x24,0x29,0x82,0x10,0x20,0x00,0x41,0x08,0x24,0x21,
-	0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x45,0x29,0x82,0x10,0x41,0x08,0x82,0x10,0x45,0x29,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0xA6,0x31,0xC7,0x39,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xE7,0x39,0xA6,0x31,0xE3,0x18,0x20,0x00,0x00,0x00,
-	0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x24,0x21,0x20,0x00,0x61,0x08,0xE3,0x18,0xE7,0x39,0xC7,0x39,0xE3,0x18,0x41,0x08,0x61,0x08,0x24,0x21,0x82,0x10,0x82,0x10,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0xC7,0x39,0xC7,0x39,0x04,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0xC7,0x39,0x86,0x31,
-	0xE3,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x24,0x29,0x41,0x08,0x41,0x08,0x82,0x10,0x65,0x29,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xE3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,
-	0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x04,0x21,0x61,0x08,0x20,0x00,0x82,0x10,0x45,0x29,0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x86,0x31,0xC3,0x18,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,
-	0x61,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x82,0x10,0x04,0x21,0x86,0x31,0xC3,0x18,0x82,0x10,0x41,0x08,0xE3,0x18,0xC3,0x18,0x61,0x08,0x41,0x08,0xC3,0x18,0xC3,0x18,0x00,0x00,0xA2,0x10,0x24,0x29,0x08,0x42,0x86,0x31,0x04,0x21,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x04,0x21,0xC7,0x39,0xE7,0x39,0x04,0x21,0x82,0x10,
-	0x00,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x61,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x82,0x10,0x04,0x21,0x86,0x31,0xC3,0x18,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x61,0x08,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x04,0x21,0xA6,0x31,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,
-	0x41,0x08,0x20,0x00,0x82,0x10,0x45,0x29,0x24,0x29,0x61,0x08,0x20,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,
-	0x82,0x10,0x86,0x31,0x65,0x29,0xA2,0x10,0x20,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xE7,0x39,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0x45,0x29,0xC7,0x39,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x04,0x21,0xC7,0x39,
-	0xE7,0x39,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0xE3,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0x45,0x29,0x08,0x42,0x86,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0x45,0x29,0xC7,0x39,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0xE3,0x18,0xA6,0x31,0xC7,0x39,0x04,0x21,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0x65,0x29,0x65,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,
-	0x82,0x10,0x04,0x21,0x82,0x10,0x20,0x00,0x82,0x10,0x24,0x29,0xE3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x86,0x31,0xA6,0x31,0xC3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0x61,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x20,0x00,
-	0x41,0x08,0xC3,0x18,0xA6,0x31,0xC7,0x39,0x04,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0xE7,0x39,0xA6,0x31,0xE3,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x45,0x29,0x20,0x00,0x61,0x08,0xE3,0x18,0x08,0x42,0xE7,0x39,0xE3,0x18,0x41,0x08,0x61,0x08,0x45,0x29,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0xC7,0x39,0xE7,0x39,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xE7,0x39,0x86,0x31,0xC3,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0xA2,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0xA6,0x31,0x86,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0xA2,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0x24,0x21,0x41,0x08,0x20,0x00,0xA2,0x10,0x04,0x21,0x61,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0x65,0x29,0xC3,0x18,0x41,0x08,0x41,0x08,0x45,0x29,0x24,0x21,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x86,0x31,0xE7,0x39,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x65,0x29,0x24,0x29,0x82,0x10,0x61,0x08,0xC3,0x18,0x45,0x29,0x82,0x10,0x82,0x10,0x82,0x10,0x45,0x29,0x04,0x21,0x82,0x10,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0xC3,0x18,0x65,0x29,0x28,0x42,0xA6,0x31,0x04,0x21,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x04,0x21,0xC7,0x39,0x28,0x42,0x24,0x21,0xA2,0x10,0x00,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0x82,0x10,0x24,0x29,0x24,0x29,0x61,0x08,0x82,0x10,0xA2,0x10,0x45,0x29,0x82,0x10,0x82,0x10,0x82,0x10,0x45,0x29,0x24,0x21,
-	0xA2,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0xE7,0x39,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x24,0x21,0x41,0x08,0x41,0x08,0xE3,0x18,0x65,0x29,0xA2,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0x65,0x29,0xA2,0x10,0x41,0x08,0x61,0x08,0x86,0x31,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0x04,0x21,0x08,0x42,0x86,0x31,
-	0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xA6,0x31,0x28,0x42,0x24,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0xE7,0x39,0x28,0x42,0x24,0x29,0xA2,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x04,0x21,0x04,0x21,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0xC3,0x18,
-	0x45,0x29,0x28,0x42,0xC7,0x39,0x04,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x08,0x42,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xA6,0x31,0xE7,0x39,0xC3,0x18,0x61,0x08,0x00,0x00,0xC3,0x18,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x86,0x31,
-	0x65,0x29,0x61,0x08,0x41,0x08,0xC3,0x18,0x65,0x29,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x24,0x21,0xA2,0x10,0x20,0x00,0x82,0x10,0x45,0x29,0xC3,0x18,0x41,0x08,0x20,0x00,0x04,0x21,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0x86,0x31,0xC3,0x18,0x61,0x08,0x82,0x10,0x86,0x31,0xC7,0x39,0xE3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0x65,0x29,0x82,0x10,0x82,0x10,0x82,0x10,0x86,0x31,0x86,0x31,0xC3,0x18,0x61,0x08,0x41,0x08,0x61,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0xE7,0x39,0x86,0x31,0xA2,0x10,0x41,0x08,0xA2,0x10,
-	0xE3,0x18,0x61,0x08,0x82,0x10,0x82,0x10,0x04,0x21,0x00,0x00,0x61,0x08,0x04,0x21,0x28,0x42,0x08,0x42,0x04,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x61,0x08,0x82,0x10,0x61,0x08,0x04,0x21,0x61,0x08,0x41,0x08,0xC3,0x18,0xA6,0x31,0xE7,0x39,0xE3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x86,0x31,0x45,0x29,
-	0x82,0x10,0x61,0x08,0xC3,0x18,0x65,0x29,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0xE7,0x39,0x65,0x29,0x82,0x10,0x41,0x08,0xE3,0x18,0x65,0x29,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x04,0x21,0xE3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,
-	0x24,0x21,0x41,0x08,0x20,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0x65,0x29,0x82,0x10,0x41,0x08,0xA2,0x10,0x86,0x31,0x04,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0x86,0x31,0x04,0x21,0x61,0x08,0x82,0x10,0x24,0x29,0xE7,0x39,0xE3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x04,0x21,0x08,0x42,0xC7,0x39,0xE3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0xE3,0x18,0xE7,0x39,0x86,0x31,0xC3,0x18,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x49,0x4A,0xA6,0x31,0x04,0x21,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x24,0x21,0xE7,0x39,0x49,0x4A,0x45,0x29,0xA2,0x10,
-	0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xA6,0x31,0xC7,0x39,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0xE3,0x18,0xE7,0x39,0xE7,0x39,0xE3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0xE7,0x39,0x04,0x21,0x82,0x10,0x41,0x08,0x24,0x29,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x45,0x29,0x86,0x31,0x82,0x10,0x41,0x08,0xA2,0x10,0x65,0x29,0xC3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0x24,0x21,0x41,0x08,0x61,0x08,0x04,0x21,0xE7,0x39,0x24,0x21,0x82,0x10,
-	0x00,0x00,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x86,0x31,0x82,0x10,0x82,0x10,0x82,0x10,0x86,0x31,0x04,0x21,0xA2,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x28,0x42,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0x08,0x42,
-	0x28,0x42,0x04,0x21,0x82,0x10,0x00,0x00,0xC3,0x18,0x82,0x10,0x82,0x10,0x61,0x08,0xE3,0x18,0xC3,0x18,0x61,0x08,0x82,0x10,0xA2,0x10,0xA2,0x10,0x00,0x00,0xA2,0x10,0x24,0x21,0x28,0x42,0xE7,0x39,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x86,0x31,0x49,0x4A,0xA6,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0xA2,0x10,0x24,0x21,0x65,0x29,0x61,0x08,0x82,0x10,0xA2,0x10,0xC7,0x39,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xA2,0x10,0x20,0x00,0xA2,0x10,0x65,0x29,0xC7,0x39,0xA2,0x10,0x41,0x08,0x61,0x08,0x24,0x29,0xE3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x20,0x00,0x04,0x21,0xE3,0x18,0x41,0x08,0x41,0x08,0x24,0x21,0xE3,0x18,0x41,0x08,
-	0x00,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0x20,0x00,0x61,0x08,0x04,0x21,0x08,0x42,0x65,0x29,0x82,0x10,0x20,0x00,0xA2,0x10,0x04,0x21,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x86,0x31,0x28,0x42,0x45,0x29,
-	0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,0xE3,0x18,0x24,0x29,0x82,0x10,0x82,0x10,0x82,0x10,0x65,0x29,0xE3,0x18,0x82,0x10,0x82,0x10,0x24,0x21,0x86,0x31,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x24,0x29,0x49,0x4A,0x28,0x42,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,
-	0xC3,0x18,0x86,0x31,0x04,0x21,0x82,0x10,0x82,0x10,0x04,0x21,0x65,0x29,0x82,0x10,0xA2,0x10,0x82,0x10,0x45,0x29,0xC3,0x18,0xA2,0x10,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0xC3,0x18,0x86,0x31,0x28,0x42,0x24,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0xA2,0x10,0xA6,0x31,
-	0xE7,0x39,0xC3,0x18,0x41,0x08,0x41,0x08,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0xE3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0xE3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x20,0x00,0xE3,0x18,0x04,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x86,0x31,0x82,0x10,0x41,0x08,0xC3,0x18,0xA6,0x31,0xE3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0x28,0x42,0xE7,0x39,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0x49,0x4A,0x08,0x42,0x24,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,0x49,0x4A,0xC7,0x39,0x04,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x04,0x21,0xA6,0x31,0x69,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0xC7,0x39,0x69,0x4A,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0xE7,0x39,0x49,0x4A,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0x28,0x42,0x28,0x42,
-	0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0x82,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xE3,0x18,0x08,0x42,0x08,0x42,0xC3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x86,0x31,0x82,0x10,0x41,0x08,0xA2,0x10,
-	0x86,0x31,0xC3,0x18,0x41,0x08,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x24,0x21,0x41,0x08,0x61,0x08,0x45,0x29,0xE7,0x39,0xC3,0x18,0x61,0x08,0x41,0x08,0x24,0x29,0xE3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0xE7,0x39,0x49,0x4A,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x24,0x21,0xA2,0x10,0x82,0x10,0xA2,0x10,0x65,0x29,0xE7,0x39,0xE3,0x18,0xA2,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0xC7,0x39,0xE7,0x39,0xA2,0x10,0x82,0x10,0x61,0x08,0x65,0x29,0xE3,0x18,0xA2,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x04,0x21,0x45,0x29,0x41,0x08,0x82,0x10,
-	0xC3,0x18,0xE7,0x39,0x86,0x31,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x04,0x21,0xE7,0x39,0x04,0x21,0xA2,0x10,0x61,0x08,0xE3,0x18,0x24,0x21,0xA2,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,0x49,0x4A,0xA6,0x31,0xA2,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x04,0x21,0x20,0x00,0x82,0x10,0x04,0x21,0xE7,0x39,0x04,0x21,0x61,0x08,0x41,0x08,0x45,0x29,0x24,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0x20,0x00,0x20,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xA2,0x10,0x20,0x00,0x82,0x10,0x86,0x31,0x08,0x42,0xC3,0x18,0x82,0x10,
-	0x61,0x08,0x65,0x29,0x45,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0xC3,0x18,0x41,0x08,0xA2,0x10,0x45,0x29,0x49,0x4A,0x65,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x28,0x42,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0xE3,0x18,0xE7,0x39,
-	0x08,0x42,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0x65,0x29,0x49,0x4A,0x28,0x42,0x45,0x29,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x28,0x42,0xA6,0x31,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0x24,0x21,0x28,0x42,0xA6,0x31,0xE3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0xE3,0x18,0xA6,0x31,0x28,0x42,0x04,0x21,0x82,0x10,0x41,0x08,0x04,0x21,0x04,0x21,0xA2,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0x45,0x29,0x41,0x08,0x82,0x10,0x24,0x21,0x08,0x42,0x24,0x21,0x61,0x08,0x00,0x00,0xE3,0x18,0xE3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x41,0x08,0x24,0x21,0xA2,0x10,0x20,0x00,0x82,0x10,0x65,0x29,0xA2,0x10,0x41,0x08,0xA2,0x10,0x86,0x31,0xC3,0x18,0x20,0x00,
-	0x82,0x10,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x28,0x42,0x04,0x21,0x82,0x10,0x61,0x08,0x65,0x29,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0xA6,0x31,0xA2,0x10,
-	0xA2,0x10,0x82,0x10,0x86,0x31,0x86,0x31,0xC3,0x18,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,0x69,0x4A,0xC7,0x39,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x28,0x42,0x24,0x29,0xA2,0x10,0x41,0x08,0x24,0x21,0x04,0x21,0x41,0x08,0xA2,0x10,0x86,0x31,0x28,0x42,0x45,0x29,0xA2,0x10,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x04,0x21,0x08,0x42,0x69,0x4A,0x24,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0xA6,0x31,0x65,0x29,0x82,0x10,0xA2,0x10,0xC3,0x18,0xA6,0x31,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x24,0x21,0x82,0x10,0xA2,0x10,0x45,0x29,
-	0x28,0x42,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0x24,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x65,0x29,0x61,0x08,0x41,0x08,0xC3,0x18,0x45,0x29,0x41,0x08,0x20,0x00,0xC3,0x18,0x04,0x21,0x20,0x00,0x20,0x00,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x24,0x21,0xE3,0x18,0x20,0x00,0x41,0x08,0x86,0x31,0x86,0x31,0x61,0x08,0x41,0x08,0x24,0x21,0xE7,0x39,0xC3,0x18,0x41,0x08,0x41,0x08,0x04,0x21,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x24,0x21,0x49,0x4A,0x86,0x31,0xA2,0x10,0x82,0x10,0x04,0x21,0x65,0x29,0xA2,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x49,0x4A,0xA6,0x31,0xE3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0xC3,0x18,0xC3,0x18,0x86,0x31,0xC3,0x18,0xA2,0x10,0x82,0x10,0xE3,0x18,
-	0xE3,0x18,0x61,0x08,0xA2,0x10,0x04,0x21,0x08,0x42,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x86,0x31,0xE7,0x39,0xC3,0x18,0x82,0x10,0x41,0x08,0x04,0x21,0xC3,0x18,0x82,0x10,0xA2,0x10,0x04,0x21,0x65,0x29,0xA2,0x10,0xA2,0x10,0x61,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0xE3,0x18,0x08,0x42,0x49,0x4A,
-	0x04,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x65,0x29,0xC3,0x18,0x82,0x10,0xA2,0x10,0xC7,0x39,0x28,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x04,0x21,0x20,0x00,0x41,0x08,0x04,0x21,0xE7,0x39,0xE3,0x18,0x41,0x08,0x82,0x10,
-	0xA6,0x31,0x24,0x21,0x41,0x08,0x20,0x00,0x04,0x21,0xE3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x86,0x31,0x04,0x21,0x41,0x08,0x82,0x10,0xA6,0x31,0x08,0x42,0xA2,0x10,0x61,0x08,0xA2,0x10,0xA6,0x31,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x49,0x4A,0x28,0x42,0xE3,0x18,0x82,0x10,0x41,0x08,0xE3,0x18,0xA2,0x10,
-	0xE3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0x08,0x42,0x69,0x4A,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x29,0x49,0x4A,0x49,0x4A,0x45,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x28,0x42,0x08,0x42,0x04,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0x45,0x29,0x69,0x4A,0x28,0x42,0x24,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0x69,0x4A,0xE7,0x39,0xC3,0x18,0x00,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0xE3,0x18,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0xE3,0x18,0x49,0x4A,0x08,0x42,0xC3,0x18,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0xC3,0x18,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x86,0x31,0x61,0x08,0x82,0x10,0xC3,0x18,0x28,0x42,0x65,0x29,0x82,0x10,0x41,0x08,0x24,0x21,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x20,0x00,0x61,0x08,0x24,0x21,0x61,0x08,0x00,0x00,0xC3,0x18,0x24,0x21,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xC7,0x39,0x08,0x42,0xA2,0x10,0x82,0x10,
-	0xA2,0x10,0xC7,0x39,0x65,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x41,0x08,0x20,0x00,0xC3,0x18,0xC7,0x39,0x8A,0x52,0x65,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0x24,0x21,0x24,0x21,0x82,0x10,0xC3,0x18,0xA2,0x10,0xA6,0x31,0x04,0x21,0xA2,0x10,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xA2,0x10,0xE3,0x18,0x86,0x31,0x82,0x10,0x82,0x10,0xA2,0x10,0xC7,0x39,0x86,0x31,0xA2,0x10,0x82,0x10,0xC3,0x18,0x86,0x31,0xA2,0x10,0xC3,0x18,0x41,0x08,0xC3,0x18,0x82,0x10,0x82,0x10,0xA2,0x10,0x45,0x29,0x86,0x31,0x82,0x10,0xC3,0x18,0x82,0x10,0x45,0x29,0x04,0x21,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,
-	0x00,0x00,0xC3,0x18,0xA6,0x31,0x8A,0x52,0x65,0x29,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0xA6,0x31,0xA6,0x31,0x82,0x10,0x82,0x10,0xC3,0x18,0x28,0x42,0x86,0x31,0x61,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0x20,0x00,0x20,0x00,0x04,0x21,0xC3,0x18,0x20,0x00,0x61,0x08,0x65,0x29,0xA2,0x10,0x41,0x08,0xC3,0x18,0xA6,0x31,0x82,0x10,0x41,0x08,0xE3,0x18,0xE7,0x39,0xA2,0x10,0x41,0x08,
-	0x82,0x10,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xA6,0x31,0x28,0x42,0xC3,0x18,0xA2,0x10,0x82,0x10,0xC7,0x39,0xC7,0x39,0xC3,0x18,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0xC3,0x18,0xE3,0x18,0x04,0x21,0x41,0x08,
-	0xA2,0x10,0xC3,0x18,0x28,0x42,0xE7,0x39,0xE3,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0x69,0x4A,0xA6,0x31,0xE3,0x18,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0xE3,0x18,0xA6,0x31,0x69,0x4A,0xA6,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xE7,0x39,0x69,0x4A,0x65,0x29,0xC3,0x18,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0xE7,0x39,0x69,0x4A,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x28,0x42,0x08,0x42,0xC3,0x18,0x82,0x10,0x41,0x08,0x04,0x21,0xC3,0x18,0xC3,0x18,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x86,0x31,0x61,0x08,0x82,0x10,0x24,0x21,
-	0x49,0x4A,0x45,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x65,0x29,0x61,0x08,0x41,0x08,0xE3,0x18,0xA6,0x31,0xA2,0x10,0x41,0x08,0xC3,0x18,0x86,0x31,0x82,0x10,0x20,0x00,0xC3,0x18,0x45,0x29,0x41,0x08,0x20,0x00,0xC3,0x18,
-	0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x65,0x29,0x04,0x21,0x20,0x00,0x61,0x08,0xA6,0x31,0xA6,0x31,0x82,0x10,0x61,0x08,0x45,0x29,0x28,0x42,0xA2,0x10,0x41,0x08,0x61,0x08,0x24,0x21,0xA2,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x04,0x21,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x24,0x29,0x69,0x4A,0x24,0x29,0xA2,0x10,0x82,0x10,0x45,0x29,0xE7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0xE7,0x39,0x04,0x21,0xA2,0x10,0xA2,0x10,0x04,0x21,0x86,0x31,0xA2,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x08,0x42,
-	0x08,0x42,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x86,0x31,0x65,0x29,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x28,0x42,0xC7,0x39,0xE3,0x18,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0x86,0x31,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x65,0x29,0xE7,0x39,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0xE7,0x39,0x04,0x21,0xA2,0x10,0xA2,0x10,0x86,0x31,0x69,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x04,0x21,0x41,0x08,0x41,0x08,0xE3,0x18,0x28,0x42,0x04,0x21,0x61,0x08,0x82,0x10,
-	0xC7,0x39,0x65,0x29,0x41,0x08,0x41,0x08,0x24,0x21,0x24,0x21,0x20,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xC7,0x39,0x04,0x21,0x41,0x08,0x82,0x10,0xC7,0x39,0x28,0x42,0xA2,0x10,0x61,0x08,0xA2,0x10,0xA6,0x31,0x04,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x69,0x4A,0xE7,0x39,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x65,0x29,0xC3,0x18,
-	0xC3,0x18,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x49,0x4A,0x49,0x4A,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0xC7,0x39,0xC7,0x39,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x49,0x4A,0x08,0x42,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,
-	0xC3,0x18,0xE7,0x39,0xA6,0x31,0xC3,0x18,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x29,0x69,0x4A,0x08,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0xC3,0x18,0x04,0x21,0x45,0x29,0x61,0x08,0xA2,0x10,0xC3,0x18,0x28,0x42,0x28,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x86,0x31,0x82,0x10,0x82,0x10,0xC3,0x18,0x69,0x4A,0x86,0x31,0x82,0x10,0x41,0x08,0x45,0x29,0xA6,0x31,0x61,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x20,0x00,0x04,0x21,0xC3,0x18,
-	0x20,0x00,0x82,0x10,0x45,0x29,0x41,0x08,0x00,0x00,0xC3,0x18,0x24,0x21,0x20,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x29,0x82,0x10,0x20,0x00,0x82,0x10,0xE7,0x39,0x28,0x42,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xE7,0x39,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x08,0x42,0x8A,0x52,0x04,0x21,0x82,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0xC3,0x18,0xA2,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x45,0x29,0x69,0x4A,0xA6,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0xC7,0x39,0x69,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x04,0x21,0xE7,0x39,0x69,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x49,0x4A,0x04,0x21,0x82,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x82,0x10,
-	0x41,0x08,0xA2,0x10,0x65,0x29,0x8A,0x52,0xA6,0x31,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0xA6,0x31,0x82,0x10,0xA2,0x10,0xC3,0x18,0x69,0x4A,0xA6,0x31,0x61,0x08,0x20,0x00,0xA2,0x10,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x82,0x10,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x20,0x00,0x45,0x29,0x04,0x21,0x41,0x08,0x82,0x10,0xA6,0x31,0xC3,0x18,0x41,0x08,0xC3,0x18,0xE7,0x39,0xC3,0x18,0x41,0x08,0xC3,0x18,0xE7,0x39,0xA2,0x10,0x20,0x00,
-	0x61,0x08,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0xC7,0x39,0x49,0x4A,0xC3,0x18,0xA2,0x10,0x82,0x10,0xC7,0x39,0xE7,0x39,0xA2,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xA2,0x10,0x82,0x10,0x20,0x00,
-	0x82,0x10,0x04,0x21,0x8A,0x52,0x08,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0xC3,0x18,0x24,0x21,0xE7,0x39,0x04,0x21,0xC3,0x18,0x82,0x10,0xC3,0x18,0xE3,0x18,0x82,0x10,0xC3,0x18,0xC3,0x18,0x86,0x31,0xC3,0x18,0xC3,0x18,0x41,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0xC3,0x18,0x04,0x21,0x86,0x31,0xA2,0x10,0xC3,0x18,
-	0x61,0x08,0xE3,0x18,0xA2,0x10,0x82,0x10,0xC3,0x18,0x24,0x29,0xE7,0x39,0xE3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x49,0x4A,0x69,0x4A,0xE3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0xA2,0x10,0xE3,0x18,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x08,0x42,0x86,0x31,0x82,0x10,0xA2,0x10,0x04,0x21,
-	0x69,0x4A,0x65,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x00,0x00,0x61,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0xC7,0x39,0xA2,0x10,0x41,0x08,0x04,0x21,0xC7,0x39,0x82,0x10,0x41,0x08,0x04,0x21,0x86,0x31,0x41,0x08,0x41,0x08,0x04,0x21,
-	0x04,0x21,0x20,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x20,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0xA6,0x31,0x45,0x29,0x41,0x08,0x82,0x10,0xC7,0x39,0x08,0x42,0x82,0x10,0x82,0x10,0x24,0x21,0x28,0x42,0xC3,0x18,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x04,0x21,
-	0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x69,0x4A,0x24,0x21,0xC3,0x18,0xA2,0x10,0x65,0x29,0x08,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x86,0x31,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x86,0x31,0x08,0x42,0xE3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x24,0x29,0x69,0x4A,
-	0x69,0x4A,0x45,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x45,0x29,0x69,0x4A,0x49,0x4A,0x24,0x29,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,0x69,0x4A,0x28,0x42,0x24,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x28,0x42,0x45,0x29,0xA2,0x10,0xA2,0x10,0xE3,0x18,0x86,0x31,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x08,0x42,0x24,0x21,0xA2,0x10,0xA2,0x10,0x86,0x31,0x69,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x28,0x42,0xE3,0x18,0x82,0x10,0x82,0x10,
-	0x28,0x42,0x65,0x29,0x82,0x10,0x41,0x08,0x86,0x31,0x65,0x29,0x41,0x08,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,
-	0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x28,0x42,0x65,0x29,0x82,0x10,0x82,0x10,0xA6,0x31,0x69,0x4A,0xC3,0x18,0x61,0x08,0x82,0x10,0x65,0x29,0xE3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x69,0x4A,0xE7,0x39,0xC3,0x18,0xA2,0x10,0xC3,0x18,0x86,0x31,0xE3,0x18,
-	0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x28,0x42,0x08,0x42,0xC3,0x18,0xA2,0x10,0x41,0x08,0xC3,0x18,0x82,0x10,0xC3,0x18,0x82,0x10,0xC3,0x18,0xC3,0x18,0x82,0x10,0xC3,0x18,0xE3,0x18,0xC7,0x39,0xC3,0x18,0xA2,0x10,0x82,0x10,0x04,0x21,0x04,0x21,0x82,0x10,0xA2,0x10,0x04,0x21,0xA6,0x31,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0xC3,0x18,0xC3,0x18,0xA2,0x10,0xC3,0x18,0xA2,0x10,0xC3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0x28,0x42,0xE7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x86,0x31,0x82,0x10,0xA2,0x10,0xA2,0x10,0x08,0x42,0x49,0x4A,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x20,0x00,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x24,0x29,0x41,0x08,0x82,0x10,0x04,0x21,0x8A,0x52,0x65,0x29,0xA2,0x10,0x61,0x08,0xA6,0x31,0xE7,0x39,0x82,0x10,0x00,0x00,0xA2,0x10,0x24,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x04,0x21,0xC3,0x18,
-	0x00,0x00,0x41,0x08,0x24,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0xC7,0x39,0x04,0x21,0x41,0x08,0xA2,0x10,0xE7,0x39,0x8A,0x52,0xC3,0x18,0xA2,0x10,
-	0x82,0x10,0xA6,0x31,0x45,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x08,0x42,0x8A,0x52,0x04,0x21,0xA2,0x10,0x41,0x08,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0xA6,0x31,0x8A,0x52,0xC7,0x39,0xE3,0x18,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0xE3,0x18,0xA6,0x31,0x69,0x4A,0x86,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x69,0x4A,0x65,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x08,0x42,0x8A,0x52,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0xC3,0x18,0xE3,0x18,0xA2,0x10,
-	0x41,0x08,0xA2,0x10,0x45,0x29,0x8A,0x52,0xC7,0x39,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x65,0x29,0x41,0x08,0xA2,0x10,0x04,0x21,0xAA,0x52,0x86,0x31,0x82,0x10,0x41,0x08,0x24,0x21,0xA6,0x31,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,
-	0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,
-	0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x20,0x00,0x04,0x21,0xE3,0x18,0x20,0x00,0xA2,0x10,0x65,0x29,0x82,0x10,0x41,0x08,0x45,0x29,0x65,0x29,0x41,0x08,0x61,0x08,0xC7,0x39,0x24,0x21,0x61,0x08,0xA2,0x10,0xE7,0x39,0x04,0x21,0x41,0x08,0x82,0x10,0xA6,0x31,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x82,0x10,0x20,0x00,0x82,0x10,0xA6,0x31,0x8A,0x52,0x04,0x21,0xC3,0x18,0x82,0x10,0x86,0x31,0xA6,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0xE3,0x18,0xA2,0x10,0x82,0x10,0x20,0x00,
-	0x82,0x10,0x24,0x29,0x8A,0x52,0x08,0x42,0xC3,0x18,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0xE3,0x18,0xC3,0x18,0x04,0x21,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA6,0x31,0xC7,0x39,0xC3,0x18,0x82,0x10,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0xE7,0x39,0xC7,0x39,0xC3,0x18,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0xA2,0x10,
-	0xC3,0x18,0xE7,0x39,0x65,0x29,0xA2,0x10,0xA2,0x10,0x82,0x10,0x04,0x21,0xA2,0x10,0xE3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0x49,0x4A,0x8A,0x52,0x04,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0x65,0x29,0x82,0x10,0xC3,0x18,0x45,0x29,
-	0xAA,0x52,0x24,0x29,0x61,0x08,0x00,0x00,0xC3,0x18,0x24,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x65,0x29,0x41,0x08,0x41,0x08,0x45,0x29,0xA6,0x31,0x61,0x08,0x61,0x08,0x65,0x29,0x86,0x31,0x41,0x08,0x41,0x08,0x65,0x29,
-	0x04,0x21,0x41,0x08,0x82,0x10,0x65,0x29,0x61,0x08,0x41,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,
-	0x20,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x20,0x00,0x20,0x00,0x65,0x29,0x86,0x31,0x41,0x08,0x61,0x08,0xA6,0x31,0x08,0x42,0x82,0x10,0x82,0x10,0x65,0x29,0x69,0x4A,0xA2,0x10,0x41,0x08,0xA2,0x10,0xA6,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,
-	0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0xAA,0x52,0x45,0x29,0xA2,0x10,0x82,0x10,0x24,0x21,0xE7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x24,0x21,0x82,0x10,0xA2,0x10,0xA2,0x10,0xE7,0x39,0x49,0x4A,0x24,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x28,0x42,
-	0x08,0x42,0x04,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x08,0x42,0xE7,0x39,0xE3,0x18,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x28,0x42,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x24,0x29,0x69,0x4A,0x86,0x31,0xA2,0x10,0x82,0x10,0xA2,0x10,0x24,0x21,
-	0xA2,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x04,0x21,0xA2,0x10,0xA2,0x10,0xA6,0x31,0x8A,0x52,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0x82,0x10,0x61,0x08,0xC3,0x18,
-	0x69,0x4A,0x04,0x21,0x82,0x10,0x82,0x10,0x28,0x42,0x45,0x29,0x61,0x08,0x82,0x10,0xA6,0x31,0xE3,0x18,0x20,0x00,0x41,0x08,0x45,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x61,0x08,0x00,0x00,0x61,0x08,
-	0xE7,0x39,0x24,0x21,0x41,0x08,0x82,0x10,0x08,0x42,0x28,0x42,0x82,0x10,0x82,0x10,0x24,0x21,0x69,0x4A,0xE3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x8A,0x52,0xE7,0x39,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x86,0x31,0xE3,0x18,
-	0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0xA6,0x31,0xA2,0x10,0xC3,0x18,0x82,0x10,0x65,0x29,0x04,0x21,0xC3,0x18,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0xA6,0x31,0x69,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xC7,0x39,0x69,0x4A,0x45,0x29,0xA2,0x10,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x24,0x21,0x65,0x29,0x82,0x10,0xC3,0x18,0xA2,0x10,0xE7,0x39,0xC7,0x39,0xC3,0x18,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x65,0x29,0x61,0x08,0xA2,0x10,0xC3,0x18,0x49,0x4A,0x69,0x4A,0xC3,0x18,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x00,0x00,
-	0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x21,0x49,0x4A,0xE3,0x18,0xA2,0x10,0xA2,0x10,0x69,0x4A,0xA6,0x31,0x82,0x10,0x41,0x08,0x65,0x29,0xC7,0x39,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0x49,0x4A,0xA6,0x31,0x82,0x10,0xA2,0x10,0x65,0x29,0xAA,0x52,0x04,0x21,0x41,0x08,
-	0x20,0x00,0xE3,0x18,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x08,0x42,0x8A,0x52,0x04,0x21,0xA2,0x10,0x41,0x08,0xC3,0x18,0xE3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0xA6,0x31,0x8A,0x52,0x86,0x31,0xC3,0x18,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x61,0x08,0xC3,0x18,0x04,0x21,0xC7,0x39,0xE3,0x18,0xC3,0x18,0x61,0x08,0xA2,0x10,0xA2,0x10,0x82,0x10,0xC3,0x18,0x04,0x21,0xC7,0x39,0xE3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0xE7,0x39,0x8A,0x52,0x65,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0xA2,0x10,
-	0x41,0x08,0xA2,0x10,0x45,0x29,0xAA,0x52,0xA6,0x31,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0x00,0x00,0xA2,0x10,0x24,0x21,0xC3,0x18,0x20,0x00,0x61,0x08,0x65,0x29,0xAA,0x52,0x04,0x21,0xC3,0x18,0x82,0x10,0xE7,0x39,0xE7,0x39,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x41,0x08,
-	0x20,0x00,0xC3,0x18,0x61,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x20,0x00,0x04,0x21,0xC3,0x18,0x20,0x00,0xE3,0x18,0x45,0x29,0x41,0x08,0x61,0x08,0x86,0x31,0xC3,0x18,0x41,0x08,0x04,0x21,0xC7,0x39,0x61,0x08,0x41,0x08,0x65,0x29,0x86,0x31,0x41,0x08,0x20,0x00,0x24,0x29,0x04,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xE7,0x39,0x45,0x29,0x61,0x08,0xA2,0x10,0x45,0x29,0xCB,0x5A,0x65,0x29,0x82,0x10,0x41,0x08,0x04,0x21,0x45,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,
-	0x82,0x10,0x24,0x21,0xAA,0x52,0x08,0x42,0xC3,0x18,0x20,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x82,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x28,0x42,0x28,0x42,0x04,0x21,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x69,0x4A,0x49,0x4A,0x24,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,
-	0x24,0x21,0x49,0x4A,0xE7,0x39,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0xE3,0x18,0x49,0x4A,0x8A,0x52,0xE3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0xE3,0x18,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,0xE3,0x18,0x41,0x08,0x82,0x10,0xA6,0x31,
-	0xAA,0x52,0xE3,0x18,0xA2,0x10,0x61,0x08,0x86,0x31,0x86,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x20,0x00,0xE3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x04,0x21,0x20,0x00,0x41,0x08,0xC7,0x39,0x04,0x21,0x41,0x08,0x82,0x10,0xC7,0x39,
-	0xC3,0x18,0x41,0x08,0x04,0x21,0x65,0x29,0x41,0x08,0x41,0x08,0x45,0x29,0xA2,0x10,0x20,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x24,0x21,0x00,0x00,
-	0x41,0x08,0x86,0x31,0x04,0x21,0x20,0x00,0x82,0x10,0x08,0x42,0xC3,0x18,0x82,0x10,0x04,0x21,0x49,0x4A,0xC3,0x18,0x82,0x10,0x04,0x21,0x69,0x4A,0xC3,0x18,0x61,0x08,0xA2,0x10,0xE7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,
-	0x45,0x29,0x04,0x21,0x41,0x08,0x82,0x10,0xE3,0x18,0xCB,0x5A,0xC7,0x39,0xA2,0x10,0x82,0x10,0xC3,0x18,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x24,0x21,0x82,0x10,0xA2,0x10,0xC3,0x18,0xE7,0x39,0x69,0x4A,0x24,0x21,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0xC7,0x39,
-	0x86,0x31,0xA2,0x10,0xC3,0x18,0x82,0x10,0x24,0x21,0x82,0x10,0xC3,0x18,0x82,0x10,0x04,0x21,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xC3,0x18,0x04,0x21,0x82,0x10,0xC3,0x18,0xA2,0x10,0xA6,0x31,0xA6,0x31,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x8A,0x52,0xA6,0x31,0xC3,0x18,0x82,0x10,0xA2,0x10,0x24,0x21,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x65,0x29,0xA2,0x10,0x82,0x10,0xA2,0x10,0x28,0x42,0x8A,0x52,0xC3,0x18,0x82,0x10,0x61,0x08,0x45,0x29,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x24,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,
-	0xA6,0x31,0x82,0x10,0x61,0x08,0x24,0x21,0x49,0x4A,0xC3,0x18,0x82,0x10,0x04,0x21,0x49,0x4A,0xA2,0x10,0x61,0x08,0x04,0x21,0xE7,0x39,0x61,0x08,0x20,0x00,0x24,0x21,0x45,0x29,0x20,0x00,0x41,0x08,0x24,0x29,0x61,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0x20,0x00,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0xC7,0x39,0x65,0x29,0x41,0x08,0x82,0x10,
-	0xE7,0x39,0x28,0x42,0x82,0x10,0xA2,0x10,0x65,0x29,0x8A,0x52,0xC3,0x18,0x41,0x08,0x82,0x10,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x04,0x21,0x41,0x08,0x82,0x10,0xC3,0x18,0x69,0x4A,0x49,0x4A,0xA2,0x10,0x82,0x10,0x82,0x10,0x24,0x21,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC7,0x39,0x65,0x29,0x82,0x10,0xC3,0x18,0xA2,0x10,0xC7,0x39,0x45,0x29,0xC3,0x18,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0x8A,0x52,0xA6,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x8A,0x52,0x86,0x31,0xA2,0x10,
-	0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0x86,0x31,0xA6,0x31,0x82,0x10,0xE3,0x18,0x82,0x10,0xA6,0x31,0xA6,0x31,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0x04,0x21,0x04,0x21,0x41,0x08,0x82,0x10,0xC3,0x18,0x8A,0x52,0x28,0x42,0xA2,0x10,0x61,0x08,0x82,0x10,0x24,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,
-	0x82,0x10,0x41,0x08,0x24,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x45,0x29,0x41,0x08,0x61,0x08,0x04,0x21,0x8A,0x52,0x04,0x21,0xA2,0x10,0xA2,0x10,0x69,0x4A,0x86,0x31,0x82,0x10,0x61,0x08,0xA6,0x31,0x65,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,
-	0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0x61,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0x24,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x28,0x42,0x65,0x29,0x61,0x08,0xA2,0x10,0xC7,0x39,0x8A,0x52,0xA2,0x10,0xA2,0x10,0xC3,0x18,0x08,0x42,0x24,0x29,0x00,0x00,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x82,0x10,0xE7,0x39,0xAA,0x52,0x24,0x21,0x82,0x10,0x41,0x08,0xA2,0x10,0xC3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0x69,0x4A,0x45,0x29,0xC3,0x18,0x41,0x08,0x82,0x10,
-	0xA2,0x10,0x82,0x10,0xC3,0x18,0x82,0x10,0xC3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0xC7,0x39,0x86,0x31,0xA2,0x10,0xA2,0x10,0x61,0x08,0xC3,0x18,0x82,0x10,0xE3,0x18,0x82,0x10,0xA2,0x10,0x82,0x10,0x82,0x10,0xC3,0x18,0xA6,0x31,0x69,0x4A,0x45,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0xC3,0x18,0xC3,0x18,0x82,0x10,
-	0x41,0x08,0xA2,0x10,0x86,0x31,0xCB,0x5A,0x65,0x29,0x82,0x10,0x41,0x08,0xA2,0x10,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0xA6,0x31,0xE7,0x39,0x82,0x10,0xA2,0x10,0xE3,0x18,0xCB,0x5A,0x65,0x29,0xA2,0x10,0x82,0x10,0xA6,0x31,0xC7,0x39,0x20,0x00,0x00,0x00,
-	0x82,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x61,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x61,0x08,
-	0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0xC3,0x18,0x24,0x21,0x20,0x00,0x41,0x08,0x65,0x29,0x61,0x08,0x20,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0x20,0x00,0x65,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,
-	0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0xC3,0x18,0x20,0x00,0x61,0x08,0xE7,0x39,0x69,0x4A,0xA2,0x10,0xC3,0x18,0xC3,0x18,0x49,0x4A,0xA6,0x31,0x41,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0xC3,0x18,0x24,0x21,0xC3,0x18,0x41,0x08,
-	0xA2,0x10,0x04,0x21,0x8A,0x52,0x08,0x42,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x69,0x4A,0x69,0x4A,0x24,0x21,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x28,0x42,0x08,0x42,0x04,0x21,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,
-	0x45,0x29,0x69,0x4A,0x28,0x42,0xC3,0x18,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0xE3,0x18,0x69,0x4A,0x69,0x4A,0xC3,0x18,0x82,0x10,0x41,0x08,0xE3,0x18,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x28,0x42,
-	0x08,0x42,0x82,0x10,0xC3,0x18,0xE3,0x18,0x8A,0x52,0x65,0x29,0x61,0x08,0x00,0x00,0xE3,0x18,0x45,0x29,0x20,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0x20,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,
-	0x00,0x00,0x20,0x00,0x65,0x29,0xC3,0x18,0x20,0x00,0x82,0x10,0x24,0x29,0x20,0x00,0x20,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x61,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0x24,0x21,0x61,0x08,0x20,0x00,0x45,0x29,0xC3,0x18,0x41,0x08,0x24,0x21,0x45,0x29,0x41,0x08,0x82,0x10,0xC7,0x39,0xC3,0x18,
-	0x61,0x08,0x45,0x29,0xE7,0x39,0x82,0x10,0x82,0x10,0xC7,0x39,0xC7,0x39,0x82,0x10,0x61,0x08,0xE7,0x39,0x86,0x31,0x41,0x08,0x20,0x00,0x65,0x29,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,
-	0x86,0x31,0x28,0x42,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x49,0x4A,0x28,0x42,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x65,0x29,0xA2,0x10,0xA2,0x10,0xC3,0x18,0xE7,0x39,0x69,0x4A,0x24,0x21,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x45,0x29,
-	0x04,0x21,0x82,0x10,0xC3,0x18,0xE3,0x18,0xE7,0x39,0x04,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0x65,0x29,0xE7,0x39,0xC3,0x18,0xC3,0x18,0x82,0x10,0x04,0x21,0x24,0x21,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x8A,0x52,0x86,0x31,0xC3,0x18,0xA2,0x10,0xC3,0x18,0x65,0x29,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x8A,0x52,0x08,0x42,0x82,0x10,0xC3,0x18,0x04,0x21,0x69,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x65,0x29,0x24,0x21,0x20,0x00,0x41,0x08,0xE7,0x39,0x86,0x31,0x61,0x08,0x82,0x10,0x08,0x42,0x86,0x31,0x82,0x10,0xA2,0x10,0x08,0x42,0xE3,0x18,0x61,0x08,0x04,0x21,0xA6,0x31,0x41,0x08,0x41,0x08,0x65,0x29,0xC3,0x18,0x20,0x00,0xE3,0x18,0x24,0x21,0x20,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x61,0x08,
-	0xC3,0x18,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,
-	0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x45,0x29,0xA2,0x10,0x00,0x00,0x61,0x08,0xE7,0x39,0xA2,0x10,0x41,0x08,0x04,0x21,0x49,0x4A,0xC3,0x18,0x82,0x10,0x24,0x21,0x8A,0x52,0xC3,0x18,0xA2,0x10,
-	0x04,0x21,0x8A,0x52,0x04,0x21,0x41,0x08,0x61,0x08,0x86,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x00,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0x08,0x42,0xC3,0x18,0xC3,0x18,0xA2,0x10,0xE7,0x39,0x8A,0x52,0xE3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,
-	0xE3,0x18,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0x86,0x31,0x82,0x10,0xC3,0x18,0xA2,0x10,0xE7,0x39,0x86,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0xC7,0x39,0x69,0x4A,0x45,0x29,0xC3,0x18,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x86,0x31,0x69,0x4A,0x65,0x29,0x82,0x10,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0xC7,0x39,0xA2,0x10,0xC3,0x18,0x82,0x10,0xA6,0x31,0xA6,0x31,0xA2,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x04,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0xCB,0x5A,0x86,0x31,0xA2,0x10,0xA2,0x10,0x04,0x21,0x28,0x42,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x24,0x29,0x45,0x29,0x41,0x08,0x61,0x08,0x65,0x29,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x24,0x21,0x8A,0x52,0xE3,0x18,0x82,0x10,0x04,0x21,0x49,0x4A,0xA2,0x10,0x41,0x08,0xE3,0x18,0xC7,0x39,0x41,0x08,0x00,0x00,0xE3,0x18,
-	0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x24,0x29,0x04,0x21,0x00,0x00,0x41,0x08,0xC7,0x39,0xE7,0x39,0x82,0x10,0xA2,0x10,0x86,0x31,0xAA,0x52,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x49,0x4A,0x24,0x21,0x20,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xE7,0x39,0x04,0x21,0x82,0x10,0xC3,0x18,0x65,0x29,0xAA,0x52,0x65,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x69,0x4A,0x24,0x21,0xA2,0x10,0x82,0x10,0xC3,0x18,
-	0x04,0x21,0xA2,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0x69,0x4A,0x28,0x42,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x04,0x21,0xA2,0x10,0x82,0x10,0xC3,0x18,0x86,0x31,0x69,0x4A,0x45,0x29,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x82,0x10,0xC7,0x39,0x8A,0x52,0x04,0x21,0xC3,0x18,0x82,0x10,0x45,0x29,0xC7,0x39,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0xE3,0x18,0x41,0x08,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0xA6,0x31,0x08,0x42,0x82,0x10,0xC3,0x18,0x04,0x21,0xCB,0x5A,0x24,0x21,0xA2,0x10,0x82,0x10,
-	0x28,0x42,0x65,0x29,0x20,0x00,0x20,0x00,0x24,0x21,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,
-	0xE3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0x65,0x29,0xC3,0x18,0x20,0x00,0x41,0x08,0xE7,0x39,0x28,0x42,0x82,0x10,0xC3,0x18,0x04,0x21,0xCB,0x5A,0x65,0x29,0x82,0x10,0x41,0x08,0x04,0x21,0x86,0x31,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x86,0x31,0x65,0x29,0x61,0x08,
-	0xC3,0x18,0xA2,0x10,0x69,0x4A,0x28,0x42,0xC3,0x18,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x24,0x21,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0x69,0x4A,0x69,0x4A,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0xA2,0x10,0x86,0x31,0x65,0x29,0xA2,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,
-	0x24,0x21,0x8A,0x52,0x49,0x4A,0xE3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x24,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x69,0x4A,0x28,0x42,0xA2,0x10,0xC3,0x18,0x82,0x10,0x86,0x31,0x45,0x29,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,
-	0xE3,0x18,0x41,0x08,0x82,0x10,0xC7,0x39,0x8A,0x52,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x69,0x4A,0x65,0x29,0x41,0x08,0x20,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0x04,0x21,0x04,0x21,0x41,0x08,0xE3,0x18,0x65,0x29,0x41,0x08,0x82,0x10,0xA6,0x31,0xA2,0x10,0x41,0x08,0x24,0x29,0xA6,0x31,
-	0x41,0x08,0x41,0x08,0xA6,0x31,0xE3,0x18,0x00,0x00,0x61,0x08,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x86,0x31,0x86,0x31,0x82,0x10,0xA2,0x10,
-	0xE3,0x18,0xCB,0x5A,0x86,0x31,0xA2,0x10,0x82,0x10,0x24,0x29,0x08,0x42,0xA2,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x86,0x31,0x69,0x4A,0x24,0x21,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0xE3,0x18,
-	0xA2,0x10,0x82,0x10,0xC3,0x18,0x45,0x29,0x69,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xC7,0x39,0x49,0x4A,0x04,0x21,0xA2,0x10,0x41,0x08,0xA2,0x10,0xE3,0x18,0xC3,0x18,0xA2,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x69,0x4A,0x45,0x29,0xC3,0x18,0xA2,0x10,0x04,0x21,0xE7,0x39,
-	0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x29,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x08,0x42,0x04,0x21,0xA2,0x10,0xA2,0x10,0xE7,0x39,0xAA,0x52,0xA2,0x10,0x82,0x10,0x82,0x10,0xC7,0x39,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x61,0x08,0x24,0x21,0x41,0x08,
-	0x82,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x65,0x29,0x20,0x00,0x00,0x00,0x45,0x29,0x65,0x29,0x20,0x00,0x41,0x08,0xC7,0x39,0xE3,0x18,0x41,0x08,0x04,0x21,0x86,0x31,0x41,0x08,0x41,0x08,0x65,0x29,0xA2,0x10,0x20,0x00,0x24,0x21,0xC3,0x18,0x20,0x00,0xE3,0x18,
-	0xC3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x61,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,
-	0x41,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0x24,0x29,0x82,0x10,0x20,0x00,0x45,0x29,0xE3,0x18,0x20,0x00,0x04,0x21,0x86,0x31,0x41,0x08,0x41,0x08,0xE7,0x39,0x04,0x21,0x61,0x08,0x24,0x21,0x28,0x42,0x82,0x10,0x82,0x10,0xC7,0x39,0x28,0x42,0x82,0x10,0x82,0x10,0xE7,0x39,0xE7,0x39,0x82,0x10,0x41,0x08,0x86,0x31,0xA6,0x31,0x20,0x00,
-	0x00,0x00,0xC3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x00,0x00,0x24,0x29,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x41,0x08,0x41,0x08,0xC3,0x18,0xAA,0x52,0xA6,0x31,0xA2,0x10,0xC3,0x18,0x04,0x21,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x24,0x29,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x08,0x42,0xA6,0x31,0x82,0x10,0xC3,0x18,0xA2,0x10,0xE7,0x39,0x86,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0x65,0x29,0x08,0x42,0xC3,0x18,0xC3,0x18,0x82,0x10,0x04,0x21,0xE3,0x18,0xA2,0x10,0xA2,0x10,0x04,0x21,0x08,0x42,0x24,0x21,0x82,0x10,
-	0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0xC7,0x39,0xC7,0x39,0xA2,0x10,0xE3,0x18,0xA2,0x10,0xE7,0x39,0xE7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x24,0x29,0x28,0x42,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x08,0x42,0x69,0x4A,0xA2,0x10,0x41,0x08,0x61,0x08,
-	0x24,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x08,0x42,0x65,0x29,0x41,0x08,0x82,0x10,0x49,0x4A,0xA6,0x31,0x82,0x10,0x82,0x10,0x49,0x4A,0x65,0x29,0x82,0x10,0xC3,0x18,0x28,0x42,
-	0xC3,0x18,0x61,0x08,0x65,0x29,0xA6,0x31,0x41,0x08,0x61,0x08,0x86,0x31,0xA2,0x10,0x20,0x00,0x04,0x21,0x04,0x21,0x20,0x00,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x61,0x08,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,
-	0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xA6,0x31,0xC3,0x18,0x20,0x00,0x82,0x10,0x28,0x42,0xE3,0x18,0x82,0x10,0xE3,0x18,0xAA,0x52,0x04,0x21,0xA2,0x10,0xE3,0x18,0xAA,0x52,0x45,0x29,0x82,0x10,0x82,0x10,0xE7,0x39,0x86,0x31,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x61,0x08,0x24,0x29,
-	0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0xE3,0x18,0xC3,0x18,0x28,0x42,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x86,0x31,0x69,0x4A,0x24,0x21,0xA2,0x10,0x82,0x10,0xE3,0x18,
-	0x45,0x29,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x24,0x29,0x69,0x4A,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x86,0x31,0x69,0x4A,0x45,0x29,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x04,0x21,0xC3,0x18,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x82,0x10,0xE7,0x39,0xE7,0x39,0x82,0x10,0xE3,0x18,0xA2,0x10,0x49,0x4A,0x08,0x42,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x04,0x21,0x61,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x24,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0xE7,0x39,0xA6,0x31,0x82,0x10,0x82,0x10,0xA6,0x31,
-	0x69,0x4A,0xA2,0x10,0x82,0x10,0x65,0x29,0x8A,0x52,0x82,0x10,0x82,0x10,0x24,0x21,0x28,0x42,0x41,0x08,0x20,0x00,0x04,0x21,0x86,0x31,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x20,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x24,0x21,0xA6,0x31,0x61,0x08,0x82,0x10,0x65,0x29,0xAA,0x52,0xC3,0x18,0xC3,0x18,0xE3,0x18,0xAA,0x52,0x86,0x31,0x82,0x10,0x41,0x08,0x45,0x29,0xA6,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0xA6,0x31,0x49,0x4A,0xA2,0x10,
-	0xC3,0x18,0x82,0x10,0xC7,0x39,0x28,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x24,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0x69,0x4A,0x69,0x4A,0xE3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,
-	0x04,0x21,0x69,0x4A,0x49,0x4A,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x24,0x21,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0x69,0x4A,0x86,0x31,0xA2,0x10,0xC3,0x18,0x04,0x21,0x69,0x4A,0x45,0x29,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0x82,0x10,
-	0x20,0x00,0x00,0x00,0x61,0x08,0xE7,0x39,0x04,0x21,0x61,0x08,0x82,0x10,0xE7,0x39,0x69,0x4A,0xA2,0x10,0xC3,0x18,0x04,0x21,0xCB,0x5A,0xE3,0x18,0x82,0x10,0x82,0x10,0xE7,0x39,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,
-	0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x45,0x29,0xC7,0x39,0x82,0x10,0x82,0x10,0xE3,0x18,0xCB,0x5A,0x65,0x29,0xA2,0x10,
-	0x82,0x10,0xA6,0x31,0x49,0x4A,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x24,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x69,0x4A,0x65,0x29,0xA2,0x10,0xA2,0x10,0x24,0x21,0x49,0x4A,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0xC3,0x18,
-	0x82,0x10,0x41,0x08,0xA2,0x10,0x65,0x29,0x8A,0x52,0xA6,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x8A,0x52,0x24,0x21,0xA2,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x28,0x42,0xE3,0x18,0xC3,0x18,0xA2,0x10,0xA6,0x31,0x69,0x4A,
-	0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x69,0x4A,0x65,0x29,0xA2,0x10,0xA2,0x10,0xA6,0x31,0xAA,0x52,0xA2,0x10,0x82,0x10,0xA2,0x10,0x08,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0xC3,0x18,0xE3,0x18,
-	0x20,0x00,0x04,0x21,0x24,0x21,0x41,0x08,0x04,0x21,0x65,0x29,0x41,0x08,0xA2,0x10,0xA6,0x31,0x82,0x10,0x41,0x08,0xA6,0x31,0x45,0x29,0x41,0x08,0x04,0x21,0x08,0x42,0x61,0x08,0x41,0x08,0x86,0x31,0xA6,0x31,0x20,0x00,0x20,0x00,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x24,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,
-	0x00,0x00,0x82,0x10,0x82,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0x8A,0x52,0x24,0x21,0xA2,0x10,0xA2,0x10,0xC7,0x39,0x8A,0x52,0xC3,0x18,0x41,0x08,0x41,0x08,0x04,0x21,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,
-	0x04,0x21,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x28,0x42,0x08,0x42,0x82,0x10,0xC3,0x18,0x82,0x10,0xA6,0x31,0x86,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0xC3,0x18,0x24,0x21,0x86,0x31,0x82,0x10,0xC3,0x18,0xA2,0x10,0xA6,0x31,0x86,0x31,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA6,0x31,0x04,0x21,0xA2,0x10,
-	0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC7,0x39,0x86,0x31,0x82,0x10,0xC3,0x18,0xA2,0x10,0x49,0x4A,0xE7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x20,0x00,0xA2,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0xE3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0xCB,0x5A,0x86,0x31,0xA2,0x10,0xA2,0x10,0x86,0x31,
-	0x8A,0x52,0xA2,0x10,0x20,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0x45,0x29,0x00,0x00,0x41,0x08,0xC7,0x39,0x24,0x21,
-	0x41,0x08,0xA2,0x10,0xE7,0x39,0xA2,0x10,0x41,0x08,0x86,0x31,0x65,0x29,0x41,0x08,0xC3,0x18,0x86,0x31,0x82,0x10,0x41,0x08,0x65,0x29,0xA2,0x10,0x41,0x08,0x24,0x21,0xC3,0x18,0x20,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x20,0x00,0x24,0x21,0xE3,0x18,0x20,0x00,0x04,0x21,0x65,0x29,0x41,0x08,0x82,0x10,0xC7,0x39,0x82,0x10,0x41,0x08,0xA6,0x31,0xA6,0x31,
-	0x61,0x08,0x82,0x10,0x49,0x4A,0x24,0x21,0xA2,0x10,0x45,0x29,0x69,0x4A,0xC3,0x18,0xA2,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0x65,0x29,0x28,0x42,0x41,0x08,0x20,0x00,0xC3,0x18,0xA6,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x28,0x42,0x04,0x21,0x82,0x10,0x82,0x10,0xA6,0x31,0xCB,0x5A,0xE3,0x18,0x82,0x10,0x41,0x08,0x24,0x21,0x65,0x29,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0xA2,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x8A,0x52,0x45,0x29,0xA2,0x10,0x82,0x10,0x04,0x21,
-	0x86,0x31,0xC3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x49,0x4A,0x28,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x86,0x31,0xC3,0x18,0xA2,0x10,0xC3,0x18,0xA6,0x31,0x8A,0x52,0x24,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x61,0x08,0x61,0x08,0x41,0x08,
-	0x00,0x00,0xA2,0x10,0x86,0x31,0x04,0x21,0x41,0x08,0x82,0x10,0x45,0x29,0xCB,0x5A,0x45,0x29,0xA2,0x10,0x61,0x08,0x65,0x29,0x08,0x42,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0xE3,0x18,0x41,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0xA6,0x31,
-	0xA2,0x10,0x20,0x00,0x82,0x10,0x69,0x4A,0x04,0x21,0x82,0x10,0xA2,0x10,0x8A,0x52,0x24,0x21,0xA2,0x10,0x04,0x21,0x69,0x4A,0xE3,0x18,0x82,0x10,0x86,0x31,0x28,0x42,0x82,0x10,0x82,0x10,0xC7,0x39,0x65,0x29,0x41,0x08,0xE3,0x18,0xA6,0x31,0x41,0x08,0x41,0x08,0x65,0x29,0xA2,0x10,0x20,0x00,0x04,0x21,0x04,0x21,0x20,0x00,0xC3,0x18,
-	0xE3,0x18,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x29,0x24,0x21,0x00,0x00,0x41,0x08,0x08,0x42,0x45,0x29,0x61,0x08,0x82,0x10,0x69,0x4A,0x86,0x31,0x82,0x10,
-	0xA2,0x10,0x69,0x4A,0xE7,0x39,0xA2,0x10,0x82,0x10,0xE7,0x39,0x08,0x42,0x61,0x08,0x20,0x00,0xC3,0x18,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x41,0x08,0x82,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x86,0x31,0x04,0x21,0x41,0x08,0x82,0x10,0x24,0x21,0xCB,0x5A,0x65,0x29,
-	0xA2,0x10,0x82,0x10,0x04,0x21,0xC7,0x39,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0x69,0x4A,0x49,0x4A,0xE3,0x18,0x82,0x10,0x41,0x08,0xC3,0x18,0xA2,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x41,0x08,0x82,0x10,
-	0x04,0x21,0x69,0x4A,0x28,0x42,0xC3,0x18,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xC7,0x39,0xCB,0x5A,0xE3,0x18,0x82,0x10,0x41,0x08,0x24,0x21,0x45,0x29,0x20,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x41,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0xA2,0x10,0x20,0x00,0x82,0x10,0x69,0x4A,0x86,0x31,0x82,0x10,0x82,0x10,0x28,0x42,0x28,0x42,0x82,0x10,0x82,0x10,0xE7,0x39,0x28,0x42,0x82,0x10,0x61,0x08,0x86,0x31,0xC7,0x39,0x20,0x00,0x00,0x00,0x65,0x29,0xC3,0x18,0x00,0x00,0x20,0x00,0x45,0x29,
-	0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,
-	0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0xC7,0x39,0x82,0x10,0x41,0x08,0xA2,0x10,0x8A,0x52,0x04,0x21,0xA2,0x10,0x82,0x10,0x8A,0x52,0xC7,0x39,0xA2,0x10,0x82,0x10,0x86,0x31,0x49,0x4A,0x82,0x10,
-	0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0xE3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x8A,0x52,0x08,0x42,0xA2,0x10,0xA2,0x10,0xC3,0x18,0xA6,0x31,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0x41,0x08,0xA2,0x10,0x86,0x31,0xAA,0x52,0xA6,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x8A,0x52,0x24,0x29,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x45,0x29,0x86,0x31,0x82,0x10,0xA2,0x10,0x82,0x10,0x49,0x4A,0x69,0x4A,
-	0xA2,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x45,0x29,0x61,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x69,0x4A,0x24,0x29,0x82,0x10,0x82,0x10,0x28,0x42,0x49,0x4A,0x82,0x10,0xA2,0x10,0x65,0x29,0x8A,0x52,0x82,0x10,0x41,0x08,0xA2,0x10,
-	0xE7,0x39,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x20,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0x41,0x08,
-	0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xA6,0x31,0x82,0x10,0x41,0x08,0xA2,0x10,0xAA,0x52,0x65,0x29,0xA2,0x10,0x82,0x10,0xE7,0x39,0x8A,0x52,0x82,0x10,0x82,0x10,0xA2,0x10,0xA6,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x24,0x21,0x20,0x00,0xA2,0x10,0x00,0x00,
-	0x20,0x00,0xA2,0x10,0xE3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x08,0x42,0x8A,0x52,0xE3,0x18,0xA2,0x10,0x41,0x08,0x65,0x29,0x86,0x31,0xA2,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0xC3,0x18,0x04,0x21,0x24,0x21,0x41,0x08,0xA2,0x10,0xC3,0x18,0x28,0x42,0xE7,0x39,0xA2,0x10,0x82,0x10,0x82,0x10,0x24,0x29,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x24,0x21,0x61,0x08,0xA2,0x10,0x04,0x21,0xAA,0x52,0xA6,0x31,0x82,0x10,0x20,0x00,0x61,0x08,0x04,0x21,0xC3,0x18,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x24,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x24,0x21,0x86,0x31,0x82,0x10,0x82,0x10,0xC3,0x18,0xCB,0x5A,
-	0x86,0x31,0xA2,0x10,0x82,0x10,0xC7,0x39,0x69,0x4A,0x82,0x10,0x41,0x08,0xA2,0x10,0xC7,0x39,0x41,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x61,0x08,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,
-	0x20,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0xC3,0x18,0x41,0x08,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x24,0x21,0x41,0x08,0x82,0x10,0x65,0x29,0x41,0x08,0x82,0x10,0x86,0x31,0xA2,0x10,0x61,0x08,0xA6,0x31,0x65,0x29,0x61,0x08,0x24,0x21,0xE7,0x39,0x41,0x08,0x61,0x08,0xE7,0x39,
-	0x24,0x29,0x41,0x08,0xC3,0x18,0xE7,0x39,0x41,0x08,0x00,0x00,0x04,0x21,0x65,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,
-	0x61,0x08,0x28,0x42,0x04,0x21,0x82,0x10,0xA2,0x10,0xE7,0x39,0x8A,0x52,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x08,0x42,0x86,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0xE3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x61,0x08,0x24,0x21,0xAA,0x52,0x86,0x31,0xA2,0x10,0x82,0x10,0xE3,0x18,
-	0x86,0x31,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0xE7,0x39,0xC7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x86,0x31,0xA2,0x10,0xA2,0x10,0xC3,0x18,0xE7,0x39,0xAA,0x52,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x20,0x00,
-	0x41,0x08,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0xE7,0x39,0xC7,0x39,0x82,0x10,0xC3,0x18,0xC3,0x18,0xCB,0x5A,0x86,0x31,0xA2,0x10,0x61,0x08,0x45,0x29,0x08,0x42,0x41,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,
-	0x20,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0xA6,0x31,0xC3,0x18,0x00,0x00,0x82,0x10,0xE7,0x39,0x82,0x10,0x41,0x08,0x86,0x31,0xA6,0x31,0x41,0x08,0x82,0x10,0xE7,0x39,0xC3,0x18,0x41,0x08,0x86,0x31,0x65,0x29,0x41,0x08,0x04,0x21,0x65,0x29,0x41,0x08,0x82,0x10,0x45,0x29,
-	0x41,0x08,0x61,0x08,0x04,0x21,0x41,0x08,0x61,0x08,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0xC3,0x18,0x04,0x21,
-	0x20,0x00,0xE3,0x18,0x24,0x21,0x20,0x00,0xC3,0x18,0x65,0x29,0x41,0x08,0x41,0x08,0xA6,0x31,0xA2,0x10,0x41,0x08,0xA6,0x31,0x86,0x31,0x61,0x08,0xE3,0x18,0x28,0x42,0xA2,0x10,0x82,0x10,0xE7,0x39,0x08,0x42,0x82,0x10,0xA2,0x10,0x69,0x4A,0x86,0x31,0xA2,0x10,0xC3,0x18,0x8A,0x52,0x04,0x21,0x82,0x10,0xC3,0x18,0x49,0x4A,0xC3,0x18,
-	0x20,0x00,0x82,0x10,0xA6,0x31,0x61,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x61,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x65,0x29,0xA2,0x10,0x20,0x00,0x41,0x08,0xA6,0x31,0x69,0x4A,0xC3,0x18,0xE3,0x18,0x82,0x10,0x28,0x42,0x28,0x42,
-	0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x69,0x4A,0x69,0x4A,0xE3,0x18,0x82,0x10,0x41,0x08,0x04,0x21,0xE3,0x18,0xC3,0x18,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0xC3,0x18,0x04,0x21,0xE3,0x18,0x41,0x08,0x82,0x10,
-	0x04,0x21,0x8A,0x52,0x28,0x42,0xA2,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0xC3,0x18,0x04,0x21,0xAA,0x52,0x24,0x21,0x41,0x08,0x00,0x00,0xC3,0x18,0x24,0x29,0x41,0x08,0x00,0x00,0x82,0x10,
-	0x82,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0x41,0x08,0x20,0x00,0x24,0x21,0x28,0x42,0xA2,0x10,0x82,0x10,0x86,0x31,0x69,0x4A,0xA2,0x10,0x82,0x10,0xE7,0x39,0x28,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0x86,0x31,
-	0x82,0x10,0x04,0x21,0x28,0x42,0x82,0x10,0x61,0x08,0xA6,0x31,0x65,0x29,0x41,0x08,0xE3,0x18,0x86,0x31,0x20,0x00,0x41,0x08,0x65,0x29,0x61,0x08,0x20,0x00,0x24,0x21,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x20,0x00,0xE3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,
-	0x00,0x00,0x00,0x00,0x65,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0xC7,0x39,0x61,0x08,0x20,0x00,0x45,0x29,0x08,0x42,0x61,0x08,0x82,0x10,0xC7,0x39,0x28,0x42,0x82,0x10,0xA2,0x10,0xC7,0x39,0x8A,0x52,0x82,0x10,0xA2,0x10,0x65,0x29,0x8A,0x52,0x82,0x10,0x41,0x08,0xA2,0x10,0xE7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0xA2,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x49,0x4A,0xE3,0x18,0xA2,0x10,0x82,0x10,0xE7,0x39,0x8A,0x52,0xC3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,
-	0x82,0x10,0x41,0x08,0xA2,0x10,0x86,0x31,0xAA,0x52,0x86,0x31,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0xE7,0x39,0xAA,0x52,0x24,0x21,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0xC3,0x18,0x20,0x00,0x61,0x08,0xE3,0x18,0xCB,0x5A,0xA6,0x31,
-	0xA2,0x10,0x82,0x10,0x24,0x21,0x69,0x4A,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x24,0x29,0x61,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC7,0x39,0x82,0x10,0x41,0x08,0xC3,0x18,0x8A,0x52,0x04,0x21,0xA2,0x10,0xC3,0x18,0xAA,0x52,
-	0x65,0x29,0xC3,0x18,0xA2,0x10,0x69,0x4A,0x65,0x29,0x82,0x10,0xA2,0x10,0x28,0x42,0xC3,0x18,0x20,0x00,0xA2,0x10,0xC7,0x39,0x20,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x20,0x00,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,
-	0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x24,0x29,0x82,0x10,0x00,0x00,
-	0x00,0x00,0xA6,0x31,0xE3,0x18,0x41,0x08,0x41,0x08,0x49,0x4A,0x86,0x31,0x82,0x10,0x82,0x10,0x08,0x42,0x69,0x4A,0x82,0x10,0xA2,0x10,0x45,0x29,0xAA,0x52,0xA2,0x10,0x41,0x08,0x61,0x08,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x00,0x00,0xA2,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0xE7,0x39,0x04,0x21,0x61,0x08,0xA2,0x10,0x86,0x31,0xCB,0x5A,0x24,0x21,0x82,0x10,0x41,0x08,0xE3,0x18,0x45,0x29,0xC3,0x18,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0xE3,0x18,0x41,0x08,0x82,0x10,0xE3,0x18,0x69,0x4A,0x28,0x42,0xC3,0x18,0x61,0x08,0x41,0x08,0x04,0x21,0xC3,0x18,0xC3,0x18,
-	0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x45,0x29,0xC3,0x18,0x61,0x08,0xA2,0x10,0x86,0x31,0xCB,0x5A,0x24,0x21,0xA2,0x10,0x41,0x08,0x24,0x29,0xE7,0x39,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0xA2,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x24,0x21,0x45,0x29,
-	0x41,0x08,0x41,0x08,0x04,0x21,0x8A,0x52,0xE3,0x18,0xC3,0x18,0xA2,0x10,0xAA,0x52,0xA6,0x31,0x82,0x10,0x82,0x10,0xE7,0x39,0xE7,0x39,0x41,0x08,0x20,0x00,0x24,0x21,0x65,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x20,0x00,
-	0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0x04,0x21,0x61,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0x82,0x10,0x00,0x00,0x41,0x08,0x28,0x42,0xA6,0x31,0x82,0x10,
-	0xA2,0x10,0x86,0x31,0xCB,0x5A,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x28,0x42,0x65,0x29,0x20,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x65,0x29,0x04,0x21,0x20,0x00,0x82,0x10,0xE3,0x18,0xAA,0x52,0xE7,0x39,0xA2,0x10,0x82,0x10,0xA2,0x10,
-	0x65,0x29,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x65,0x29,0x65,0x29,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x45,0x29,0x82,0x10,0x82,0x10,0xA2,0x10,0x49,0x4A,0x69,0x4A,0xC3,0x18,0x82,0x10,0x41,0x08,0x45,0x29,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,
-	0x04,0x21,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0xE7,0x39,0xE7,0x39,0x82,0x10,0xC3,0x18,0x04,0x21,0xCB,0x5A,0x24,0x21,0xC3,0x18,0x61,0x08,0xE7,0x39,0xC7,0x39,0x41,0x08,0x00,0x00,0xC3,0x18,0x65,0x29,0x00,0x00,0x00,0x00,0x61,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xE3,0x18,0x61,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0x20,0x00,
-	0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0xC3,0x18,0x20,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x04,0x21,0xE3,0x18,0x20,0x00,0x24,0x21,
-	0x04,0x21,0x41,0x08,0x45,0x29,0x24,0x21,0x41,0x08,0x24,0x29,0x86,0x31,0x41,0x08,0xC3,0x18,0xE7,0x39,0x61,0x08,0x41,0x08,0xC7,0x39,0x24,0x21,0x41,0x08,0x04,0x21,0xE7,0x39,0x20,0x00,0x00,0x00,0x65,0x29,0x24,0x21,0x00,0x00,0x20,0x00,0x65,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0x04,0x21,
-	0xA2,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0x61,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0xE3,0x18,0x20,0x00,0x41,0x08,0x86,0x31,0x69,0x4A,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x8A,0x52,0xE7,0x39,0x82,0x10,0x41,0x08,0xE3,0x18,0xC7,0x39,
-	0xA2,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x04,0x21,0x61,0x08,0x41,0x08,0xA2,0x10,0x49,0x4A,0x69,0x4A,0xE3,0x18,0x82,0x10,0x41,0x08,0x24,0x21,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0x24,0x21,0x04,0x21,0x41,0x08,0x82,0x10,
-	0x04,0x21,0xAA,0x52,0xE7,0x39,0xA2,0x10,0x41,0x08,0x82,0x10,0x24,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x24,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0xA2,0x10,0x61,0x08,0x82,0x10,0x49,0x4A,0x28,0x42,0xA2,0x10,0xC3,0x18,0xE3,0x18,0x8A,0x52,0x04,0x21,0x41,0x08,0x20,0x00,0x04,0x21,
-	0x24,0x29,0x00,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0xA2,0x10,0x00,0x00,0xA2,0x10,0x82,0x10,0x24,0x21,0x20,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x20,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x86,0x31,0x24,0x21,0x00,0x00,
-	0x61,0x08,0xE7,0x39,0xA2,0x10,0x41,0x08,0x86,0x31,0x86,0x31,0x41,0x08,0xA2,0x10,0xC7,0x39,0x82,0x10,0x41,0x08,0x86,0x31,0xE3,0x18,0x41,0x08,0x45,0x29,0x04,0x21,0x20,0x00,0x04,0x21,0x04,0x21,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0x24,0x21,0xA2,0x10,0x20,0x00,0x45,0x29,0xA2,0x10,0x20,0x00,0x65,0x29,0xC3,0x18,0x41,0x08,0x86,0x31,0x24,0x29,0x41,0x08,0x65,0x29,0xC7,0x39,0x82,0x10,0xC3,0x18,0x28,0x42,0xC3,0x18,0x82,0x10,0xE7,0x39,
-	0xE7,0x39,0x82,0x10,0xC3,0x18,0x69,0x4A,0x24,0x21,0xA2,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0xC7,0x39,0x28,0x42,0x82,0x10,0x61,0x08,0xA6,0x31,0xC7,0x39,0x20,0x00,0x00,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0xC3,0x18,0x00,0x00,0xA2,0x10,0x20,0x00,
-	0x24,0x29,0x61,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x82,0x10,0xA2,0x10,0xA2,0x10,0x8A,0x52,0x08,0x42,0xA2,0x10,0xA2,0x10,0x04,0x21,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,
-	0x82,0x10,0x41,0x08,0x82,0x10,0x86,0x31,0xAA,0x52,0x86,0x31,0xA2,0x10,0x61,0x08,0xC3,0x18,0xA2,0x10,0x61,0x08,0xC3,0x18,0xE7,0x39,0xAA,0x52,0x24,0x21,0x82,0x10,0x20,0x00,0xA2,0x10,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x45,0x29,0x08,0x42,0xC3,0x18,
-	0xC3,0x18,0xA2,0x10,0x69,0x4A,0x28,0x42,0x82,0x10,0x82,0x10,0xC3,0x18,0x08,0x42,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x24,0x21,0x20,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x86,0x31,0xE3,0x18,
-	0x00,0x00,0x41,0x08,0x08,0x42,0x65,0x29,0x61,0x08,0x82,0x10,0x69,0x4A,0x65,0x29,0xA2,0x10,0xC3,0x18,0x8A,0x52,0x04,0x21,0xA2,0x10,0x86,0x31,0x49,0x4A,0x82,0x10,0x82,0x10,0x28,0x42,0xA6,0x31,0x82,0x10,0x24,0x21,0x08,0x42,0x82,0x10,0x82,0x10,0xE7,0x39,0x04,0x21,0x41,0x08,0x65,0x29,0x45,0x29,0x20,0x00,0x04,0x21,0x45,0x29,
-	0x20,0x00,0xC3,0x18,0x24,0x21,0x20,0x00,0xC3,0x18,0xE3,0x18,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x20,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x61,0x08,0x24,0x21,0x00,0x00,0x00,0x00,0x65,0x29,0x82,0x10,0x00,0x00,0x82,0x10,0xA6,0x31,0x20,0x00,0x00,0x00,0xA6,0x31,0x86,0x31,0x41,0x08,0x61,0x08,0x49,0x4A,0x65,0x29,0x82,0x10,0xA2,0x10,0x8A,0x52,0x45,0x29,
-	0xC3,0x18,0xC3,0x18,0xAA,0x52,0x45,0x29,0xA2,0x10,0xA2,0x10,0x69,0x4A,0x45,0x29,0x61,0x08,0x61,0x08,0xA6,0x31,0x24,0x29,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x29,0x61,0x08,
-	0x20,0x00,0x82,0x10,0x49,0x4A,0x08,0x42,0x82,0x10,0xC3,0x18,0xC3,0x18,0x69,0x4A,0xA6,0x31,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0xC3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0xC3,0x18,0x20,0x00,0x61,0x08,0x04,0x21,0x8A,0x52,0x49,0x4A,0xE3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0xA2,0x10,
-	0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x28,0x42,0x28,0x42,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x69,0x4A,0xE7,0x39,0x61,0x08,0x20,0x00,0x82,0x10,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0x24,0x21,0x82,0x10,0x82,0x10,
-	0x00,0x00,0x41,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0xA6,0x31,0x65,0x29,0x41,0x08,0x61,0x08,0xC7,0x39,0x28,0x42,0x82,0x10,0xA2,0x10,0xA6,0x31,0x8A,0x52,0xA2,0x10,0xA2,0x10,0xA6,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0xA6,0x31,0x08,0x42,0x41,0x08,0x41,0x08,0xC7,0x39,0x45,0x29,0x00,0x00,0x41,0x08,0xA6,0x31,0x41,0x08,
-	0x00,0x00,0xC3,0x18,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x29,0x20,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xE3,0x18,
-	0x41,0x08,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x24,0x29,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0xE3,0x18,0xA6,0x31,0x41,0x08,0x41,0x08,0x45,0x29,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x24,0x21,0xCB,0x5A,0xE3,0x18,0xC3,0x18,0xC3,0x18,0x8A,0x52,0x65,0x29,
-	0x82,0x10,0x41,0x08,0x86,0x31,0xA6,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x61,0x08,0x00,0x00,0xE3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0x08,0x42,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x69,0x4A,0x49,0x4A,0xC3,0x18,0x41,0x08,0x82,0x10,
-	0x04,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xE3,0x18,0x04,0x21,0x41,0x08,0x41,0x08,0xE3,0x18,0x8A,0x52,0x08,0x42,0x82,0x10,0xC3,0x18,0xC3,0x18,0x28,0x42,0x24,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0xE3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0xC3,0x18,0xA2,0x10,0x61,0x08,0x61,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xE7,0x39,0x45,0x29,0x41,0x08,0x82,0x10,0xC7,0x39,0x49,0x4A,0xA2,0x10,0xC3,0x18,0x45,0x29,0xAA,0x52,0xC3,0x18,0xA2,0x10,0xC3,0x18,0x69,0x4A,0xC3,0x18,0x41,0x08,0x82,0x10,0xE7,0x39,
-	0x82,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x61,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,
-	0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x20,0x00,0x45,0x29,0x08,0x42,0x82,0x10,0xA2,0x10,0xE3,0x18,0xCB,0x5A,0x04,0x21,0xC3,0x18,0x82,0x10,0x28,0x42,0x08,0x42,0x82,0x10,0x41,0x08,0xE3,0x18,0xE7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,
-	0xC3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x24,0x29,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0xC7,0x39,0xC3,0x18,0x82,0x10,0xA2,0x10,0x08,0x42,0xAA,0x52,0xE3,0x18,0x82,0x10,0x41,0x08,0x24,0x21,0x24,0x29,0xC3,0x18,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0x04,0x21,0x41,0x08,0x82,0x10,
-	0x24,0x21,0xCB,0x5A,0xA6,0x31,0x82,0x10,0x82,0x10,0xE3,0x18,0xE7,0x39,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xC7,0x39,0xA2,0x10,0x61,0x08,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0xA2,0x10,0x86,0x31,0xAA,0x52,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x49,0x4A,0xC3,0x18,0x00,0x00,0x20,0x00,0x45,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x61,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,
-	0xE3,0x18,0x61,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0x20,0x00,0x00,0x00,0xE3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x61,0x08,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0x24,0x21,0x41,0x08,0x41,0x08,0x45,0x29,0x41,0x08,0x20,0x00,0x86,0x31,0x82,0x10,0x20,0x00,0x86,0x31,0xE3,0x18,0x20,0x00,0x24,0x29,0x65,0x29,0x00,0x00,0x82,0x10,0xA6,0x31,0x20,0x00,0x00,0x00,
-	0x24,0x29,0x04,0x21,0x00,0x00,0x20,0x00,0x86,0x31,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x00,0x00,0x82,0x10,0x61,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x20,0x00,0xE3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0xC3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0x49,0x4A,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x8A,0x52,0xE7,0x39,0xA2,0x10,0xA2,0x10,0x45,0x29,0x8A,0x52,0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x24,0x21,0x82,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,
-	0xC3,0x18,0x41,0x08,0x82,0x10,0x65,0x29,0xCB,0x5A,0x86,0x31,0xA2,0x10,0x61,0x08,0x04,0x21,0x04,0x21,0x82,0x10,0xA2,0x10,0xE7,0x39,0xAA,0x52,0x04,0x21,0x82,0x10,0x20,0x00,0xE3,0x18,0x45,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0xE3,0x18,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0xC3,0x18,0x00,0x00,
-	0x41,0x08,0x24,0x21,0x8A,0x52,0x04,0x21,0xC3,0x18,0x82,0x10,0x69,0x4A,0x28,0x42,0x82,0x10,0x82,0x10,0x04,0x21,0x69,0x4A,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,
-	0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x65,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x00,0x00,0x00,0x00,0x65,0x29,0xE3,0x18,0x00,0x00,0x82,0x10,0xA6,0x31,0x20,0x00,0x20,0x00,0x86,0x31,0xE3,0x18,0x20,0x00,0x45,0x29,0x45,0x29,0x20,0x00,0xE3,0x18,0x65,0x29,0x20,0x00,
-	0xA2,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x04,0x21,0xC3,0x18,0x41,0x08,0x24,0x21,0x61,0x08,0xA2,0x10,0x45,0x29,0x41,0x08,0xC3,0x18,
-	0x86,0x31,0x61,0x08,0xC3,0x18,0xA6,0x31,0x82,0x10,0x82,0x10,0xE7,0x39,0xC3,0x18,0x82,0x10,0xE7,0x39,0x86,0x31,0x82,0x10,0x86,0x31,0x28,0x42,0x82,0x10,0xA2,0x10,0x49,0x4A,0x65,0x29,0xA2,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0x08,0x42,0xE7,0x39,0x82,0x10,0x82,0x10,0x08,0x42,0x24,0x21,0x41,0x08,0x82,0x10,0xE7,0x39,
-	0x82,0x10,0x00,0x00,0x41,0x08,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x20,0x00,0x04,0x21,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x69,0x4A,0xA6,0x31,
-	0x82,0x10,0xA2,0x10,0x65,0x29,0xCB,0x5A,0x24,0x21,0x82,0x10,0x41,0x08,0x65,0x29,0xE7,0x39,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xE3,0x18,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x8A,0x52,0x69,0x4A,0xE3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x08,0x42,0x24,0x29,0x61,0x08,0x82,0x10,0x86,0x31,0xCB,0x5A,0x04,0x21,0xC3,0x18,0x82,0x10,0xE7,0x39,0xE7,0x39,0x61,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x61,0x08,
-	0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x20,0x00,0x00,0x00,0xC3,0x18,0xC7,0x39,0x41,0x08,0x41,0x08,0x86,0x31,0xE7,0x39,0x61,0x08,0x61,0x08,0x28,0x42,0xA6,0x31,0x82,0x10,0xC3,0x18,0x69,0x4A,0x04,0x21,0x82,0x10,
-	0xC7,0x39,0x28,0x42,0x82,0x10,0xA2,0x10,0x49,0x4A,0x24,0x21,0x82,0x10,0xC7,0x39,0xC7,0x39,0x82,0x10,0x24,0x29,0xC7,0x39,0x61,0x08,0xC3,0x18,0xA6,0x31,0x82,0x10,0x82,0x10,0x65,0x29,0x82,0x10,0x82,0x10,0x24,0x29,0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x61,0x08,0xC3,0x18,0x00,0x00,0x61,0x08,0x04,0x21,0x00,0x00,0x20,0x00,0x24,0x29,0x00,0x00,0x00,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x24,0x21,0x24,0x21,0x00,0x00,0x61,0x08,
-	0xC7,0x39,0x41,0x08,0x20,0x00,0xA6,0x31,0xA6,0x31,0x61,0x08,0x82,0x10,0x49,0x4A,0x24,0x21,0x82,0x10,0x24,0x21,0x69,0x4A,0xC3,0x18,0xA2,0x10,0xA6,0x31,0x69,0x4A,0xA2,0x10,0xA2,0x10,0xC7,0x39,0x69,0x4A,0x82,0x10,0x82,0x10,0x86,0x31,0x69,0x4A,0x61,0x08,0x41,0x08,0x04,0x21,0xE7,0x39,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,
-	0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0x24,0x21,0x41,0x08,0x82,0x10,0x04,0x21,0xCB,0x5A,0x45,0x29,0xC3,0x18,0x82,0x10,0xA6,0x31,0x69,0x4A,0xC3,0x18,0x20,0x00,0x20,0x00,
-	0xC3,0x18,0xC3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x8A,0x52,0x65,0x29,0x82,0x10,0xA2,0x10,0xA6,0x31,0xAA,0x52,0xC3,0x18,0x61,0x08,0x61,0x08,0x65,0x29,0x24,0x21,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0xA2,0x10,0x41,0x08,0xE3,0x18,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x08,0x42,0xC3,0x18,0x41,0x08,0x82,0x10,0x69,0x4A,0x24,0x21,0xA2,0x10,0xA2,0x10,0x8A,0x52,0x65,0x29,
-	0xC3,0x18,0xC3,0x18,0x8A,0x52,0x24,0x21,0xC3,0x18,0x04,0x21,0x8A,0x52,0xA2,0x10,0x82,0x10,0x86,0x31,0x28,0x42,0x41,0x08,0x41,0x08,0xE7,0x39,0x65,0x29,0x20,0x00,0xA2,0x10,0xC7,0x39,0x20,0x00,0x00,0x00,0x65,0x29,0xE3,0x18,0x00,0x00,0xA2,0x10,0x24,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,
-	0x00,0x00,0xE3,0x18,0x20,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x61,0x08,
-	0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x61,0x08,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x20,0x00,0x20,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0x65,0x29,0x04,0x21,
-	0x00,0x00,0x41,0x08,0xE7,0x39,0x24,0x29,0x61,0x08,0x61,0x08,0x69,0x4A,0x86,0x31,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0x08,0x42,0x49,0x4A,0x82,0x10,0x82,0x10,0x24,0x29,0x49,0x4A,0x82,0x10,0x00,0x00,0x61,0x08,0x65,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,
-	0x41,0x08,0x45,0x29,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x69,0x4A,0x45,0x29,0x82,0x10,0xA2,0x10,0x86,0x31,0xCB,0x5A,0x04,0x21,0x82,0x10,0x20,0x00,0x24,0x21,0x65,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0x04,0x21,0x41,0x08,0x82,0x10,
-	0x65,0x29,0xCB,0x5A,0x24,0x21,0xC3,0x18,0x82,0x10,0x86,0x31,0x69,0x4A,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x45,0x29,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x29,0x41,0x08,0x00,0x00,0xA2,0x10,0x69,0x4A,0xE3,0x18,
-	0x82,0x10,0x82,0x10,0x8A,0x52,0xA6,0x31,0xA2,0x10,0x82,0x10,0x49,0x4A,0x08,0x42,0x82,0x10,0x82,0x10,0xE7,0x39,0x08,0x42,0x61,0x08,0x41,0x08,0x86,0x31,0xA6,0x31,0x20,0x00,0x00,0x00,0x45,0x29,0x04,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,
-	0x41,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0x41,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xE3,0x18,0x20,0x00,0x20,0x00,0xE3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,
-	0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0xC3,0x18,0x61,0x08,0x61,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x61,0x08,0x00,0x00,0x61,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x86,0x31,0x61,0x08,0x00,0x00,0x61,0x08,0x28,0x42,0x04,0x21,
-	0x82,0x10,0x82,0x10,0x69,0x4A,0xC7,0x39,0x82,0x10,0xA2,0x10,0xE7,0x39,0x8A,0x52,0x82,0x10,0xA2,0x10,0x04,0x21,0x69,0x4A,0xE3,0x18,0x20,0x00,0x20,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0xC7,0x39,
-	0x24,0x21,0x41,0x08,0x82,0x10,0x24,0x29,0xCB,0x5A,0x86,0x31,0xA2,0x10,0x82,0x10,0x45,0x29,0x24,0x21,0x82,0x10,0xA2,0x10,0xE7,0x39,0xAA,0x52,0x04,0x21,0x82,0x10,0x41,0x08,0x65,0x29,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x61,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x45,0x29,0xE3,0x18,0x00,0x00,0x20,0x00,0x24,0x29,0x49,0x4A,0xC3,0x18,0xA2,0x10,0xC3,0x18,0xCB,0x5A,0x86,0x31,0xA2,0x10,0x82,0x10,0x28,0x42,0x28,0x42,0x82,0x10,0x61,0x08,0x45,0x29,0x08,0x42,0x41,0x08,0x00,0x00,0xA2,0x10,0x86,0x31,0x00,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,
-	0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x82,0x10,0x82,0x10,0xE3,0x18,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0x20,0x00,0x41,0x08,
-	0xC3,0x18,0x00,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,
-	0x41,0x08,0x04,0x21,0x00,0x00,0x20,0x00,0x24,0x29,0x00,0x00,0x00,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0x61,0x08,0x00,0x00,0x61,0x08,0x24,0x21,0x20,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,
-	0xA2,0x10,0xE3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xE7,0x39,0xE3,0x18,0x41,0x08,0x61,0x08,0x08,0x42,0x08,0x42,0x82,0x10,0xA2,0x10,0x45,0x29,0xCB,0x5A,
-	0x04,0x21,0xA2,0x10,0x82,0x10,0xE7,0x39,0xE7,0x39,0x61,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0x8A,0x52,0x69,0x4A,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0xC3,0x18,0x41,0x08,
-	0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0x28,0x42,0x86,0x31,0x61,0x08,0xA2,0x10,0x65,0x29,0xCB,0x5A,0xE3,0x18,0xC3,0x18,0xA2,0x10,0x69,0x4A,0xA6,0x31,0x41,0x08,0x41,0x08,0x24,0x21,0xC7,0x39,0x20,0x00,0x00,0x00,0x41,0x08,0x45,0x29,
-	0x41,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0xE3,0x18,0x00,0x00,0xA2,0x10,0x82,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0xA2,0x10,
-	0x04,0x21,0x00,0x00,0x00,0x00,0x65,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0xE3,0x18,0x00,0x00,0x82,0x10,0x24,0x29,0x00,0x00,0x20,0x00,0x45,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x82,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x04,0x21,0x82,0x10,0xA2,0x10,0x24,0x29,0x41,0x08,0x04,0x21,0x65,0x29,0x41,0x08,0x45,0x29,0x86,0x31,0x41,0x08,0x45,0x29,0xC7,0x39,0x61,0x08,0x04,0x21,0x08,0x42,0x82,0x10,0x82,0x10,0x08,0x42,0x24,0x21,0x82,0x10,0xE7,0x39,0xE7,0x39,0x82,0x10,
-	0xE3,0x18,0x49,0x4A,0xA2,0x10,0x82,0x10,0xC7,0x39,0xE7,0x39,0x41,0x08,0x61,0x08,0x08,0x42,0x04,0x21,0x20,0x00,0xA2,0x10,0xE7,0x39,0x20,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,
-	0x61,0x08,0xE3,0x18,0x41,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x86,0x31,0x24,0x29,0x20,0x00,0x61,0x08,0x24,0x21,0x8A,0x52,0xE3,0x18,0xC3,0x18,0x82,0x10,0x69,0x4A,0x28,0x42,0xA2,0x10,0x82,0x10,0x04,0x21,0x08,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0xC3,0x18,0x00,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0xE3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0x08,0x42,0xC3,0x18,0x82,0x10,0xA2,0x10,0x8A,0x52,0x08,0x42,0x82,0x10,0xA2,0x10,0x24,0x29,0xAA,0x52,0xC3,0x18,
-	0x41,0x08,0x41,0x08,0x65,0x29,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x20,0x00,0x24,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x45,0x29,0x61,0x08,0x00,0x00,
-	0x20,0x00,0x86,0x31,0x61,0x08,0x00,0x00,0x82,0x10,0xE7,0x39,0x61,0x08,0x20,0x00,0x65,0x29,0xE7,0x39,0x41,0x08,0x41,0x08,0x28,0x42,0x65,0x29,0x82,0x10,0x24,0x21,0x49,0x4A,0xA2,0x10,0x82,0x10,0x28,0x42,0x86,0x31,0x82,0x10,0x86,0x31,0x08,0x42,0x82,0x10,0xE3,0x18,0xE7,0x39,0xA2,0x10,0x82,0x10,0xC7,0x39,0xE3,0x18,0x61,0x08,
-	0x86,0x31,0xE3,0x18,0x41,0x08,0x65,0x29,0xA2,0x10,0x61,0x08,0x24,0x21,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0xC3,0x18,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x04,0x21,0x20,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0xE3,0x18,0x04,0x21,0x00,0x00,
-	0x04,0x21,0x04,0x21,0x00,0x00,0x24,0x21,0x45,0x29,0x20,0x00,0x04,0x21,0x86,0x31,0x20,0x00,0x82,0x10,0xE7,0x39,0x82,0x10,0x41,0x08,0xE7,0x39,0x45,0x29,0x61,0x08,0x45,0x29,0x08,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0x86,0x31,0xA2,0x10,0x24,0x21,0x69,0x4A,0xC3,0x18,0xA2,0x10,0xE7,0x39,0x69,0x4A,0x82,0x10,0x82,0x10,0x49,0x4A,
-	0x08,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0xA6,0x31,0x82,0x10,0x82,0x10,0x08,0x42,0x45,0x29,0x20,0x00,0x41,0x08,0x86,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x20,0x00,0x24,0x29,0x82,0x10,0x82,0x10,
-	0x00,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC7,0x39,0xA2,0x10,0x61,0x08,0x82,0x10,0x69,0x4A,0x08,0x42,0x82,0x10,0xA2,0x10,0x24,0x21,0xAA,0x52,0x65,0x29,0x82,0x10,0x20,0x00,0x04,0x21,0x65,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0xE3,0x18,0x20,0x00,0x82,0x10,
-	0xC7,0x39,0x8A,0x52,0xE3,0x18,0xA2,0x10,0xA2,0x10,0x69,0x4A,0x08,0x42,0x82,0x10,0x41,0x08,0xC3,0x18,0xE7,0x39,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x00,0x00,0x24,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x65,0x29,0x65,0x29,0x20,0x00,0x41,0x08,0xC7,0x39,0xE7,0x39,0x61,0x08,0x82,0x10,0x08,0x42,0x08,0x42,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0xA2,0x10,0xA2,0x10,0x8A,0x52,0x86,0x31,0xA2,0x10,0x24,0x21,0x69,0x4A,0xA2,0x10,0x82,0x10,0xE7,0x39,0x08,0x42,0x61,0x08,0xA2,0x10,
-	0x28,0x42,0xE3,0x18,0x61,0x08,0xA6,0x31,0xA6,0x31,0x41,0x08,0xC3,0x18,0xC7,0x39,0x41,0x08,0x20,0x00,0xA6,0x31,0xA2,0x10,0x20,0x00,0x65,0x29,0xC3,0x18,0x20,0x00,0x24,0x21,0xC3,0x18,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0xE3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,
-	0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x61,0x08,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x29,0x41,0x08,0x00,0x00,
-	0xC3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0xA2,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x86,0x31,0x04,0x21,0x00,0x00,0x41,0x08,0x08,0x42,0xC3,0x18,0x41,0x08,0xA2,0x10,0x69,0x4A,0xC3,0x18,0xA2,0x10,0x04,0x21,0x8A,0x52,0xC3,0x18,0xC3,0x18,0x24,0x21,0xAA,0x52,0xE3,0x18,0xC3,0x18,0x04,0x21,0xAA,0x52,
-	0x04,0x21,0xA2,0x10,0xA2,0x10,0x49,0x4A,0x24,0x21,0x41,0x08,0x41,0x08,0x86,0x31,0x24,0x29,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x24,0x21,0x00,0x00,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0xE7,0x39,
-	0xA6,0x31,0x61,0x08,0x82,0x10,0x04,0x21,0xCB,0x5A,0x86,0x31,0xA2,0x10,0x61,0x08,0x86,0x31,0x65,0x29,0x82,0x10,0xA2,0x10,0xE7,0x39,0xAA,0x52,0xC3,0x18,0x82,0x10,0x82,0x10,0xE7,0x39,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0x20,0x00,
-	0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x61,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0x24,0x21,0x20,0x00,0x41,0x08,0xA6,0x31,0x08,0x42,0x82,0x10,0x82,0x10,0x65,0x29,0x8A,0x52,0xC3,0x18,0xA2,0x10,0x24,0x29,0xAA,0x52,0xC3,0x18,0xA2,0x10,0x24,0x21,0x8A,0x52,0xA2,0x10,0x82,0x10,0x24,0x21,0x49,0x4A,0x61,0x08,
-	0x41,0x08,0x24,0x21,0xE7,0x39,0x20,0x00,0x00,0x00,0x45,0x29,0x24,0x21,0x00,0x00,0x00,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x20,0x00,0x24,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0x61,0x08,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0xA2,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,
-	0x82,0x10,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x82,0x10,0x61,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0xC3,0x18,0x04,0x21,
-	0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x45,0x29,0x20,0x00,0x20,0x00,0x86,0x31,0xE7,0x39,0x61,0x08,0x61,0x08,0x86,0x31,0x69,0x4A,0x82,0x10,0xC3,0x18,0x24,0x21,0xCB,0x5A,0x04,0x21,0xC3,0x18,0xA2,0x10,0x8A,0x52,0x86,0x31,0x82,0x10,0x61,0x08,0x86,0x31,
-	0xE7,0x39,0x41,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x69,0x4A,0x49,0x4A,0xC3,0x18,0x20,0x00,0x41,0x08,0x24,0x21,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x61,0x08,0x82,0x10,0x24,0x29,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x61,0x08,0x00,0x00,0x82,0x10,0x28,0x42,0x45,0x29,0x61,0x08,0x82,0x10,0x08,0x42,0x28,0x42,0x82,0x10,0xA2,0x10,0x65,0x29,0xCB,0x5A,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x8A,0x52,0x04,0x21,
-	0x82,0x10,0x82,0x10,0x08,0x42,0x04,0x21,0x00,0x00,0x20,0x00,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x24,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x41,0x08,
-	0x82,0x10,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x20,0x00,0xE3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0x24,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,
-	0x00,0x00,0x41,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0x82,0x10,
-	0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0x24,0x21,0x00,0x00,0x20,0x00,0x24,0x21,0x28,0x42,0x82,0x10,0x82,0x10,0xC3,0x18,0xCB,0x5A,0x24,0x21,0xA2,0x10,0x82,0x10,0x49,0x4A,0x28,0x42,0x82,0x10,0x82,0x10,0x45,0x29,0x69,0x4A,0xC3,0x18,0x20,0x00,0x41,0x08,0x24,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x04,0x21,0x00,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x69,0x4A,0x04,0x21,0xA2,0x10,0x82,0x10,0x8A,0x52,0xE7,0x39,0x82,0x10,
-	0xA2,0x10,0x86,0x31,0xAA,0x52,0xA2,0x10,0x82,0x10,0xC3,0x18,0x49,0x4A,0xC3,0x18,0x20,0x00,0x20,0x00,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,
-	0x61,0x08,0x82,0x10,0x20,0x00,0xE3,0x18,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x20,0x00,0x20,0x00,0x24,0x21,0x61,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x04,0x21,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x00,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x04,0x21,0x20,0x00,0xA2,0x10,0x24,0x29,0x20,0x00,0x04,0x21,0x45,0x29,
-	0x20,0x00,0x24,0x29,0x86,0x31,0x41,0x08,0x24,0x21,0xA6,0x31,0x41,0x08,0xE3,0x18,0xC7,0x39,0x41,0x08,0x61,0x08,0xE7,0x39,0xC3,0x18,0x41,0x08,0xA6,0x31,0x86,0x31,0x20,0x00,0xA2,0x10,0xE7,0x39,0x41,0x08,0x00,0x00,0x65,0x29,0x24,0x21,0x00,0x00,0x41,0x08,0xA6,0x31,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,
-	0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0xE3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xE7,0x39,0xA2,0x10,0x41,0x08,0x82,0x10,0x69,0x4A,0xA6,0x31,0x82,0x10,0x82,0x10,0xA6,0x31,0xAA,0x52,0xC3,0x18,0xA2,0x10,0xC3,0x18,0x49,0x4A,0x86,0x31,0x82,0x10,0x00,0x00,0xC3,0x18,0x65,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0xC3,0x18,0x00,0x00,0xA2,0x10,
-	0x08,0x42,0x08,0x42,0x82,0x10,0xA2,0x10,0x04,0x21,0xCB,0x5A,0x65,0x29,0x82,0x10,0x82,0x10,0xE7,0x39,0x28,0x42,0x82,0x10,0x41,0x08,0xC3,0x18,0xE7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0x41,0x08,
-	0xE3,0x18,0x41,0x08,0x82,0x10,0x20,0x00,0xE3,0x18,0x82,0x10,0x61,0x08,0x00,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x24,0x21,0x00,0x00,0x82,0x10,0xE7,0x39,
-	0x61,0x08,0x20,0x00,0xC7,0x39,0x65,0x29,0x41,0x08,0x24,0x21,0xE7,0x39,0x41,0x08,0x82,0x10,0xE7,0x39,0x82,0x10,0x41,0x08,0xA6,0x31,0xC3,0x18,0x41,0x08,0x86,0x31,0xE3,0x18,0x20,0x00,0x45,0x29,0xA2,0x10,0x20,0x00,0x24,0x21,0x41,0x08,0x61,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,
-	0x20,0x00,0xC3,0x18,0x82,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,0x04,0x21,0xA2,0x10,0x82,0x10,0x24,0x21,0x41,0x08,0x04,0x21,0x45,0x29,0x41,0x08,0x45,0x29,0x45,0x29,0x41,0x08,0x86,0x31,0x65,0x29,0x61,0x08,0x86,0x31,0xA6,0x31,0x61,0x08,0x86,0x31,0xE7,0x39,0x82,0x10,0x04,0x21,0x28,0x42,0xA2,0x10,0x82,0x10,0x28,0x42,0x86,0x31,
-	0x82,0x10,0xA6,0x31,0x49,0x4A,0x82,0x10,0xA2,0x10,0x69,0x4A,0x65,0x29,0xA2,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0x28,0x42,0x08,0x42,0x82,0x10,0xA2,0x10,0x69,0x4A,0x65,0x29,0x82,0x10,0xC3,0x18,0x69,0x4A,0xA2,0x10,0x41,0x08,0xC3,0x18,0x08,0x42,0x41,0x08,0x00,0x00,0xA2,0x10,0xC7,0x39,0x41,0x08,0x00,0x00,0x61,0x08,
-	0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0xA6,0x31,0xC3,0x18,0x00,0x00,0x61,0x08,0xA6,0x31,
-	0x28,0x42,0xA2,0x10,0xA2,0x10,0xC3,0x18,0xAA,0x52,0xC7,0x39,0xA2,0x10,0x82,0x10,0xA6,0x31,0x65,0x29,0x82,0x10,0xA2,0x10,0x28,0x42,0x8A,0x52,0xA2,0x10,0xA2,0x10,0xC3,0x18,0x69,0x4A,0x45,0x29,0x41,0x08,0x00,0x00,0x04,0x21,0x65,0x29,0x20,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,
-	0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x61,0x08,0x00,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0xA6,0x31,0x61,0x08,0x00,0x00,0xA2,0x10,0x08,0x42,0x82,0x10,0x41,0x08,0x24,0x21,0x28,0x42,0x82,0x10,0x82,0x10,
-	0xC7,0x39,0x28,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0xC7,0x39,0xA2,0x10,0xC3,0x18,0x69,0x4A,0x04,0x21,0xA2,0x10,0xE7,0x39,0x49,0x4A,0xA2,0x10,0xA2,0x10,0x69,0x4A,0x45,0x29,0xA2,0x10,0xE7,0x39,0x08,0x42,0x82,0x10,0x04,0x21,0x28,0x42,0xA2,0x10,0x82,0x10,0x08,0x42,0x24,0x21,0x61,0x08,0xC7,0x39,0x45,0x29,0x61,0x08,0x86,0x31,
-	0x45,0x29,0x41,0x08,0x65,0x29,0x04,0x21,0x41,0x08,0x24,0x21,0xA2,0x10,0x61,0x08,0x04,0x21,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x61,0x08,0x45,0x29,0x00,0x00,0x00,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x24,0x21,0x24,0x21,0x00,0x00,0x41,0x08,0xC7,0x39,0x41,0x08,0x00,0x00,0x65,0x29,0x86,0x31,0x20,0x00,0x41,0x08,0x08,0x42,0x04,0x21,0x61,0x08,0xE3,0x18,
-	0x69,0x4A,0xA2,0x10,0x82,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0xE7,0x39,0x49,0x4A,0x82,0x10,0x82,0x10,0x08,0x42,0x49,0x4A,0x82,0x10,0x82,0x10,0xE7,0x39,0x49,0x4A,0x82,0x10,0x82,0x10,0xA6,0x31,0x49,0x4A,0x82,0x10,0x41,0x08,0x24,0x21,0x28,0x42,0x61,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0x82,0x10,0x00,0x00,0x41,0x08,
-	0xE3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x61,0x08,0x00,0x00,0xE3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0x45,0x29,0x20,0x00,0x20,0x00,0x04,0x21,0x69,0x4A,0x49,0x4A,0xC3,0x18,0x20,0x00,0x61,0x08,0x65,0x29,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x45,0x29,0x41,0x08,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0x61,0x08,0x00,0x00,0x82,0x10,0x28,0x42,0xE3,0x18,0x61,0x08,0x82,0x10,0x69,0x4A,0x45,0x29,0x82,0x10,
-	0x82,0x10,0x8A,0x52,0x86,0x31,0xA2,0x10,0xA2,0x10,0x8A,0x52,0xA6,0x31,0xA2,0x10,0xA2,0x10,0x8A,0x52,0x86,0x31,0xA2,0x10,0xA2,0x10,0x69,0x4A,0x24,0x21,0x82,0x10,0x04,0x21,0x49,0x4A,0x82,0x10,0x61,0x08,0x86,0x31,0xE7,0x39,0x20,0x00,0x20,0x00,0xC7,0x39,0x04,0x21,0x00,0x00,0xA2,0x10,0xA6,0x31,0x00,0x00,0x00,0x00,0x65,0x29,
-	0xC3,0x18,0x00,0x00,0xA2,0x10,0x65,0x29,0x00,0x00,0x00,0x00,0x65,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0x61,0x08,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0x04,0x21,0x41,0x08,
-	0x20,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x45,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x65,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0xC7,0x39,0xC3,0x18,0x20,0x00,0x41,0x08,0x28,0x42,
-	0x04,0x21,0x61,0x08,0x82,0x10,0x69,0x4A,0x65,0x29,0x82,0x10,0x82,0x10,0x69,0x4A,0xC7,0x39,0xA2,0x10,0x82,0x10,0x28,0x42,0x28,0x42,0x82,0x10,0x82,0x10,0x86,0x31,0x8A,0x52,0x82,0x10,0x82,0x10,0xE3,0x18,0x49,0x4A,0xC3,0x18,0x20,0x00,0x41,0x08,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x24,0x21,0x41,0x08,0x61,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0xC3,0x18,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x04,0x21,0x61,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x21,0x24,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x28,0x42,0xA2,0x10,0x82,0x10,
-	0xC3,0x18,0xAA,0x52,0x24,0x29,0xA2,0x10,0x82,0x10,0x8A,0x52,0xC7,0x39,0xA2,0x10,0x82,0x10,0x28,0x42,0x28,0x42,0x82,0x10,0x82,0x10,0xA6,0x31,0x28,0x42,0x82,0x10,0x41,0x08,0x65,0x29,0x08,0x42,0x41,0x08,0x20,0x00,0x24,0x21,0x86,0x31,0x00,0x00,0x00,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,
-	0x20,0x00,0x24,0x29,0x82,0x10,0x00,0x00,0x61,0x08,0x24,0x29,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x61,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x61,0x08,0x04,0x21,0x41,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x61,0x08,
-	0x82,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xE3,0x18,0x20,0x00,0x20,0x00,
-	0xE3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0x20,0x00,0x20,0x00,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0xC3,0x18,0x41,0x08,0x82,0x10,0x61,0x08,0xA2,0x10,
-	0x61,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xE3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0x65,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0xE7,0x39,0xA2,0x10,0x20,0x00,0x82,0x10,0x49,0x4A,
-	0x45,0x29,0x82,0x10,0x82,0x10,0x28,0x42,0x08,0x42,0x82,0x10,0x82,0x10,0x86,0x31,0xCB,0x5A,0xC3,0x18,0xA2,0x10,0x04,0x21,0x8A,0x52,0x45,0x29,0x82,0x10,0x41,0x08,0xA6,0x31,0xE7,0x39,0x82,0x10,0x00,0x00,0xA2,0x10,0x45,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x45,0x29,0x82,0x10,0x00,0x00,0xA2,0x10,
-	0x28,0x42,0x65,0x29,0x41,0x08,0x82,0x10,0xC7,0x39,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x04,0x21,0xCB,0x5A,0x24,0x29,0xA2,0x10,0xA2,0x10,0x69,0x4A,0xC7,0x39,0x82,0x10,0x61,0x08,0xA6,0x31,0x08,0x42,0x61,0x08,0x20,0x00,0xE3,0x18,0xE7,0x39,0x41,0x08,0x00,0x00,0x61,0x08,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x61,0x08,
-	0x00,0x00,0x61,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,
-	0x41,0x08,0xE3,0x18,0x61,0x08,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x41,0x08,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x20,0x00,0x20,0x00,0xE3,0x18,0x00,0x00,0x20,0x00,0xC3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,
-	0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0xE3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x24,0x21,0x00,0x00,0x82,0x10,0x24,0x29,0x00,0x00,0x41,0x08,0x65,0x29,0x00,0x00,0x00,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x04,0x21,
-	0xE3,0x18,0x00,0x00,0x41,0x08,0x65,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x20,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0xC3,0x18,0x00,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0xC3,0x18,0x00,0x00,
-	0x82,0x10,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xE3,0x18,0x61,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xA6,0x31,0xE3,0x18,0x00,0x00,0x41,0x08,0xC7,0x39,0xE7,0x39,0x41,0x08,0x82,0x10,0x45,0x29,
-	0xAA,0x52,0x04,0x21,0xA2,0x10,0xA2,0x10,0x8A,0x52,0xE7,0x39,0x82,0x10,0x82,0x10,0xC7,0x39,0x86,0x31,0x82,0x10,0xA2,0x10,0x49,0x4A,0x49,0x4A,0x82,0x10,0x82,0x10,0x65,0x29,0xCB,0x5A,0xE3,0x18,0x82,0x10,0x82,0x10,0x08,0x42,0x45,0x29,0x20,0x00,0x00,0x00,0x24,0x21,0x65,0x29,0x00,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,
-	0x00,0x00,0x61,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0x20,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0x61,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,
-	0xC3,0x18,0x00,0x00,0x20,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x45,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x20,0x00,0x65,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0xA2,0x10,0x45,0x29,0x00,0x00,0x20,0x00,0x65,0x29,0x00,0x00,0x00,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x24,0x29,0x41,0x08,
-	0x00,0x00,0x04,0x21,0x20,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x82,0x10,0x04,0x21,0x41,0x08,0x24,0x21,0xC3,0x18,0x82,0x10,0x65,0x29,0x61,0x08,0x04,0x21,0x86,0x31,0x41,0x08,0x65,0x29,
-	0x86,0x31,0x41,0x08,0x86,0x31,0xA6,0x31,0x61,0x08,0x86,0x31,0xE7,0x39,0x82,0x10,0x65,0x29,0x08,0x42,0x82,0x10,0xE3,0x18,0x28,0x42,0xC3,0x18,0x82,0x10,0x28,0x42,0x86,0x31,0x82,0x10,0x86,0x31,0x28,0x42,0x82,0x10,0xA2,0x10,0x49,0x4A,0x45,0x29,0x82,0x10,0x65,0x29,0x28,0x42,0x61,0x08,0x82,0x10,0x08,0x42,0x86,0x31,0x41,0x08,
-	0xA2,0x10,0x28,0x42,0xA2,0x10,0x41,0x08,0xE3,0x18,0xE7,0x39,0x41,0x08,0x00,0x00,0x04,0x21,0xA6,0x31,0x00,0x00,0x00,0x00,0x04,0x21,0x24,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,
-	0x82,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x41,0x08,0x24,0x29,0x61,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0x41,0x08,0x20,0x00,0xE3,0x18,0x69,0x4A,0x49,0x4A,0xC3,0x18,0x20,0x00,0x82,0x10,0xA6,0x31,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x00,0x00,0x82,0x10,0x61,0x08,0x24,0x29,0x20,0x00,0x82,0x10,0x20,0x00,0x24,0x21,0x61,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x24,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x86,0x31,0xA2,0x10,0x00,0x00,0x20,0x00,0xC7,0x39,0xC3,0x18,0x20,0x00,0x82,0x10,0x08,0x42,0xA2,0x10,0x41,0x08,0x24,0x21,0x08,0x42,0x61,0x08,0x41,0x08,0xE7,0x39,0xA6,0x31,0x82,0x10,0x82,0x10,0x49,0x4A,0x04,0x21,0x82,0x10,0xC7,0x39,0x28,0x42,0x82,0x10,0xA2,0x10,0x49,0x4A,0x24,0x29,
-	0x82,0x10,0xE7,0x39,0x08,0x42,0x82,0x10,0x45,0x29,0x28,0x42,0xA2,0x10,0xA2,0x10,0x28,0x42,0x04,0x21,0x82,0x10,0xE7,0x39,0x45,0x29,0x82,0x10,0xC7,0x39,0x45,0x29,0x61,0x08,0x86,0x31,0x04,0x21,0x61,0x08,0x65,0x29,0xA2,0x10,0xA2,0x10,0x24,0x21,0x41,0x08,0xE3,0x18,0xC3,0x18,0x20,0x00,0xC3,0x18,0x41,0x08,0x82,0x10,0x82,0x10,
-	0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,
-	0xA2,0x10,0x00,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0xC3,0x18,0x00,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x24,0x21,0x20,0x00,0xC3,0x18,0x24,0x21,0x00,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0x45,0x29,0x24,0x29,0x00,0x00,0x45,0x29,0x65,0x29,0x20,0x00,0x24,0x29,0xA6,0x31,0x20,0x00,0xE3,0x18,0xE7,0x39,0x41,0x08,0x41,0x08,0xE7,0x39,
-	0x04,0x21,0x41,0x08,0xC7,0x39,0xC7,0x39,0x61,0x08,0xC3,0x18,0x49,0x4A,0xC3,0x18,0x82,0x10,0xE7,0x39,0xE7,0x39,0x82,0x10,0x82,0x10,0x69,0x4A,0x24,0x21,0xA2,0x10,0x65,0x29,0x69,0x4A,0xA2,0x10,0x82,0x10,0x08,0x42,0x28,0x42,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0xA2,0x10,0x82,0x10,0x69,0x4A,0x86,0x31,0xA2,0x10,0xC3,0x18,
-	0x8A,0x52,0x45,0x29,0x82,0x10,0xA2,0x10,0x69,0x4A,0x24,0x21,0x82,0x10,0x82,0x10,0x28,0x42,0x04,0x21,0x41,0x08,0x61,0x08,0xE7,0x39,0x04,0x21,0x00,0x00,0x20,0x00,0x45,0x29,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x24,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,
-	0x65,0x29,0x04,0x21,0x00,0x00,0x20,0x00,0x86,0x31,0x86,0x31,0x41,0x08,0x41,0x08,0x86,0x31,0x08,0x42,0x61,0x08,0x82,0x10,0xA6,0x31,0x28,0x42,0x82,0x10,0x82,0x10,0xC7,0x39,0x69,0x4A,0x82,0x10,0xA2,0x10,0xE7,0x39,0x49,0x4A,0x82,0x10,0x82,0x10,0x28,0x42,0x08,0x42,0xA2,0x10,0x82,0x10,0x69,0x4A,0xA6,0x31,0xA2,0x10,0xE3,0x18,
-	0x69,0x4A,0x04,0x21,0xA2,0x10,0xA6,0x31,0x49,0x4A,0x82,0x10,0x82,0x10,0x28,0x42,0x86,0x31,0x82,0x10,0x24,0x21,0x49,0x4A,0x82,0x10,0x61,0x08,0x08,0x42,0x65,0x29,0x41,0x08,0x65,0x29,0xE7,0x39,0x41,0x08,0x82,0x10,0xE7,0x39,0x61,0x08,0x41,0x08,0xC7,0x39,0xE3,0x18,0x20,0x00,0x86,0x31,0x04,0x21,0x00,0x00,0x65,0x29,0x04,0x21,
-	0x00,0x00,0x24,0x29,0xC3,0x18,0x00,0x00,0x24,0x21,0x61,0x08,0x41,0x08,0x04,0x21,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x61,0x08,0x24,0x21,0x00,0x00,0x20,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x00,0x00,0x00,0x00,
-	0xC3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x65,0x29,0xC3,0x18,0x00,0x00,0x20,0x00,0xC7,0x39,0x82,0x10,0x20,0x00,0x82,0x10,0x08,0x42,0x82,0x10,0x41,0x08,0x04,0x21,0x28,0x42,0x61,0x08,0x41,0x08,0x65,0x29,0x49,0x4A,0x82,0x10,0x82,0x10,0x65,0x29,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x65,0x29,0xAA,0x52,0xC3,0x18,0xA2,0x10,0x24,0x21,
-	0xCB,0x5A,0x04,0x21,0xA2,0x10,0xE3,0x18,0xAA,0x52,0x24,0x29,0xA2,0x10,0xA2,0x10,0x49,0x4A,0x86,0x31,0x82,0x10,0x41,0x08,0xA6,0x31,0xE7,0x39,0x82,0x10,0x00,0x00,0x04,0x21,0xC7,0x39,0x82,0x10,0x00,0x00,0x82,0x10,0x24,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,
-	0xE7,0x39,0xE3,0x18,0x20,0x00,0x82,0x10,0x28,0x42,0x86,0x31,0x41,0x08,0x82,0x10,0x08,0x42,0x08,0x42,0x82,0x10,0x82,0x10,0xA6,0x31,0x8A,0x52,0xA2,0x10,0xA2,0x10,0x45,0x29,0xCB,0x5A,0xE3,0x18,0xA2,0x10,0x04,0x21,0xCB,0x5A,0x04,0x21,0xA2,0x10,0xC3,0x18,0x8A,0x52,0x04,0x21,0xA2,0x10,0xC3,0x18,0x69,0x4A,0xE3,0x18,0x61,0x08,
-	0xA2,0x10,0x49,0x4A,0xA2,0x10,0x41,0x08,0xC3,0x18,0x08,0x42,0x41,0x08,0x20,0x00,0xC3,0x18,0xA6,0x31,0x00,0x00,0x00,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x65,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x65,0x29,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0x65,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,
-	0x00,0x00,0x61,0x08,0x45,0x29,0x00,0x00,0x00,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0x61,0x08,0x00,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0xA2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,
-	0x61,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x61,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0xE3,0x18,0x00,0x00,0x00,0x00,0x65,0x29,0x45,0x29,0x00,0x00,0x20,0x00,0x86,0x31,0xC7,0x39,0x41,0x08,0x61,0x08,0x65,0x29,0x49,0x4A,0x82,0x10,0x82,0x10,0x24,0x21,0xAA,0x52,0xE3,0x18,0x82,0x10,0xC3,0x18,
-	0xCB,0x5A,0x86,0x31,0x82,0x10,0x82,0x10,0x69,0x4A,0x28,0x42,0x82,0x10,0x61,0x08,0xE7,0x39,0x86,0x31,0x61,0x08,0xA2,0x10,0x8A,0x52,0x08,0x42,0x82,0x10,0x82,0x10,0xE7,0x39,0x8A,0x52,0xA2,0x10,0x82,0x10,0x45,0x29,0xCB,0x5A,0xC3,0x18,0x82,0x10,0xC3,0x18,0x69,0x4A,0xE3,0x18,0x41,0x08,0x82,0x10,0x08,0x42,0x04,0x21,0x20,0x00,
-	0x20,0x00,0x86,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x61,0x08,0x04,0x21,0xC3,0x18,0x00,0x00,0x82,0x10,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,
-	0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x61,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0xA2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,
-	0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x04,0x21,0x00,0x00,0x20,0x00,0x24,0x21,0x00,0x00,0x20,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x61,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,
-	0x00,0x00,0x61,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xE3,0x18,0x41,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x24,0x29,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x82,0x10,0x20,0x00,0xC3,0x18,0x69,0x4A,0x49,0x4A,0xA2,0x10,0x20,0x00,0xC3,0x18,0x08,0x42,0xA2,0x10,0x00,0x00,
-	0x41,0x08,0x65,0x29,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0xA2,0x10,
-	0x61,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x45,0x29,0x20,0x00,0x00,0x00,
-	0x24,0x21,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x41,0x08,0x24,0x21,0x00,0x00,0x20,0x00,0x24,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,
-	0x00,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x04,0x21,0x20,0x00,0xE3,0x18,0xE3,0x18,0x20,0x00,0x45,0x29,0x82,0x10,0x61,0x08,0x65,0x29,0x41,0x08,0xC3,0x18,0x86,0x31,0x20,0x00,0x04,0x21,0xA6,0x31,0x41,0x08,0xE3,0x18,0xC7,0x39,0x41,0x08,0xA2,0x10,0xE7,0x39,0x41,0x08,0x41,0x08,0xE7,0x39,0xE3,0x18,0x41,0x08,
-	0xA6,0x31,0x86,0x31,0x20,0x00,0x04,0x21,0xE7,0x39,0x20,0x00,0x20,0x00,0xE7,0x39,0x04,0x21,0x00,0x00,0xE3,0x18,0xC7,0x39,0x20,0x00,0x00,0x00,0x86,0x31,0x04,0x21,0x00,0x00,0x61,0x08,0xC7,0x39,0x41,0x08,0x00,0x00,0xC3,0x18,0x86,0x31,0x00,0x00,0x00,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0x82,0x10,0x00,0x00,
-	0x20,0x00,0x45,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x24,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x41,0x08,0x61,0x08,0x24,0x21,0x20,0x00,0x41,0x08,0x41,0x08,0x04,0x21,0x61,0x08,
-	0x41,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0xE3,0x18,0x41,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0xE3,0x18,
-	0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0xC3,0x18,0x00,0x00,0x20,0x00,0xA6,0x31,0x82,0x10,0x00,0x00,0x82,0x10,0xA6,0x31,
-	0x20,0x00,0x00,0x00,0x65,0x29,0x45,0x29,0x00,0x00,0x41,0x08,0xE7,0x39,0x82,0x10,0x00,0x00,0x65,0x29,0xA6,0x31,0x20,0x00,0x61,0x08,0x08,0x42,0x82,0x10,0x20,0x00,0xC7,0x39,0x65,0x29,0x20,0x00,0x45,0x29,0xC7,0x39,0x41,0x08,0xC3,0x18,0xE7,0x39,0x41,0x08,0x61,0x08,0xC7,0x39,0x82,0x10,0x41,0x08,0xA6,0x31,0x82,0x10,0x41,0x08,
-	0x86,0x31,0x41,0x08,0x82,0x10,0x45,0x29,0x20,0x00,0xC3,0x18,0x04,0x21,0x20,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0xA2,0x10,0x41,0x08,0xE3,0x18,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x04,0x21,0x41,0x08,0x04,0x21,0x04,0x21,0x41,0x08,0x65,0x29,0xA2,0x10,0xA2,0x10,0x86,0x31,0x82,0x10,
-	0x24,0x21,0xA6,0x31,0x61,0x08,0x65,0x29,0xC7,0x39,0x82,0x10,0x86,0x31,0xE7,0x39,0x82,0x10,0x45,0x29,0x28,0x42,0xA2,0x10,0xC3,0x18,0x49,0x4A,0x04,0x21,0x82,0x10,0x49,0x4A,0xA6,0x31,0xA2,0x10,0xC7,0x39,0x49,0x4A,0xA2,0x10,0xC3,0x18,0x69,0x4A,0x24,0x21,0xA2,0x10,0x08,0x42,0x28,0x42,0x82,0x10,0xA2,0x10,0x69,0x4A,0x45,0x29,
-	0xA2,0x10,0x86,0x31,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x49,0x4A,0x08,0x42,0xA2,0x10,0xA2,0x10,0x8A,0x52,0x65,0x29,0xA2,0x10,0x04,0x21,0x8A,0x52,0xE3,0x18,0xA2,0x10,0x65,0x29,0x8A,0x52,0xA2,0x10,0x82,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0x86,0x31,0x49,0x4A,0x82,0x10,0x61,0x08,0x86,0x31,0x28,0x42,0x82,0x10,0x41,0x08,
-	0x86,0x31,0x28,0x42,0x61,0x08,0x20,0x00,0x45,0x29,0x08,0x42,0x61,0x08,0x20,0x00,0x04,0x21,0xE7,0x39,0x82,0x10,0x00,0x00,0xC3,0x18,0xA6,0x31,0x82,0x10,0x00,0x00,0x82,0x10,0x65,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,
-	0x65,0x29,0x41,0x08,0x00,0x00,0xA2,0x10,0xA6,0x31,0x82,0x10,0x00,0x00,0x82,0x10,0xE7,0x39,0xC3,0x18,0x20,0x00,0x82,0x10,0x28,0x42,0x04,0x21,0x41,0x08,0x82,0x10,0x69,0x4A,0x24,0x21,0x61,0x08,0x82,0x10,0x69,0x4A,0x24,0x29,0x82,0x10,0x82,0x10,0x8A,0x52,0x45,0x29,0x82,0x10,0xA2,0x10,0x8A,0x52,0x24,0x21,0xA2,0x10,0xE3,0x18,
-	0x8A,0x52,0x04,0x21,0xA2,0x10,0x45,0x29,0x8A,0x52,0xA2,0x10,0x82,0x10,0xE7,0x39,0x69,0x4A,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0xA2,0x10,0xC3,0x18,0x8A,0x52,0x24,0x21,0xA2,0x10,0xC7,0x39,0x69,0x4A,0x82,0x10,0xA2,0x10,0x69,0x4A,0xA6,0x31,0xA2,0x10,0xA6,0x31,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x69,0x4A,0x65,0x29,0xA2,0x10,
-	0x08,0x42,0x08,0x42,0x82,0x10,0x65,0x29,0x49,0x4A,0xA2,0x10,0xE3,0x18,0x28,0x42,0xC3,0x18,0xA2,0x10,0x08,0x42,0x04,0x21,0x82,0x10,0xE7,0x39,0x04,0x21,0x82,0x10,0xA6,0x31,0xA2,0x10,0xA2,0x10,0x86,0x31,0x41,0x08,0xE3,0x18,0x24,0x21,0x41,0x08,0x04,0x21,0xC3,0x18,0x41,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x41,0x08,
-	0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0xC3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x61,0x08,0x04,0x21,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x61,0x08,0x45,0x29,0x00,0x00,0x20,0x00,0x86,0x31,0x00,0x00,0x00,0x00,
-	0x65,0x29,0x82,0x10,0x00,0x00,0x04,0x21,0x24,0x29,0x00,0x00,0x41,0x08,0xA6,0x31,0x20,0x00,0x00,0x00,0x65,0x29,0x04,0x21,0x00,0x00,0x41,0x08,0xC7,0x39,0x41,0x08,0x00,0x00,0x45,0x29,0x86,0x31,0x00,0x00,0x20,0x00,0xE7,0x39,0xE3,0x18,0x20,0x00,0xA2,0x10,0x08,0x42,0x82,0x10,0x41,0x08,0x45,0x29,0xE7,0x39,0x41,0x08,0x41,0x08,
-	0xC7,0x39,0xC7,0x39,0x41,0x08,0x61,0x08,0x28,0x42,0x86,0x31,0x61,0x08,0x82,0x10,0x69,0x4A,0x65,0x29,0x82,0x10,0x82,0x10,0x8A,0x52,0x65,0x29,0x82,0x10,0xA2,0x10,0x8A,0x52,0x65,0x29,0x82,0x10,0x82,0x10,0xAA,0x52,0x86,0x31,0x82,0x10,0xA2,0x10,0xAA,0x52,0xA6,0x31,0x82,0x10,0x82,0x10,0x8A,0x52,0xE7,0x39,0x82,0x10,0x82,0x10,
-	0x49,0x4A,0x28,0x42,0x82,0x10,0x82,0x10,0x08,0x42,0x69,0x4A,0x82,0x10,0x61,0x08,0xE7,0x39,0xA6,0x31,0x61,0x08,0xA2,0x10,0xAA,0x52,0xC7,0x39,0x82,0x10,0xA2,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0x49,0x4A,0x28,0x42,0x82,0x10,0x82,0x10,0x08,0x42,0x69,0x4A,0x82,0x10,0x82,0x10,0xE7,0x39,0x69,0x4A,0x82,0x10,0x82,0x10,
-	0xC7,0x39,0x69,0x4A,0x82,0x10,0x82,0x10,0xC7,0x39,0x49,0x4A,0x61,0x08,0x61,0x08,0xC7,0x39,0x28,0x42,0x61,0x08,0x61,0x08,0xE7,0x39,0xE7,0x39,0x41,0x08,0x61,0x08,0x08,0x42,0x65,0x29,0x41,0x08,0x82,0x10,0x08,0x42,0xC3,0x18,0x41,0x08,0xC3,0x18,0x08,0x42,0x41,0x08,0x20,0x00,0x45,0x29,0xA6,0x31,0x00,0x00,0x00,0x00,0xA6,0x31,
-	0xE3,0x18,0x00,0x00,0x82,0x10,0xC7,0x39,0x20,0x00,0x00,0x00,0x65,0x29,0x04,0x21,0x00,0x00,0x82,0x10,0xA6,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0xA2,0x10,0x00,0x00,0xE3,0x18,0x45,0x29,0x00,0x00,0x41,0x08,0x86,0x31,0x00,0x00,0x00,0x00,0x65,0x29,0x00,0x00,0x00,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x24,0x21,0x20,0x00,0x00,0x00,
-	0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x20,0x00,0x20,0x00,0xE3,0x18,0x20,0x00,
-	0x41,0x08,0xE3,0x18,0x41,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x61,0x08,0x24,0x21,0x41,0x08,0x41,0x08,0x24,0x21,0x61,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,
-	0x20,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x24,0x21,0x61,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x20,0x00,0x00,0x00,0x82,0x10,
-	0x24,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,0x20,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x41,0x08,0x00,0x00,0xC3,0x18,0xE7,0x39,0x82,0x10,0x20,0x00,0xC3,0x18,0x28,0x42,0xA2,0x10,0x20,0x00,0xC3,0x18,0x69,0x4A,0x28,0x42,0xA2,0x10,0x20,0x00,0x04,0x21,0x49,0x4A,0xA2,0x10,0x00,0x00,
-	0xC3,0x18,0x08,0x42,0x82,0x10,0x00,0x00,0x82,0x10,0xC7,0x39,0x82,0x10,0x00,0x00,0x61,0x08,0x86,0x31,0x82,0x10,0x00,0x00,0x41,0x08,0x65,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x24,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x00,0x00,
-	0xA2,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x61,0x08,0x24,0x21,0xA2,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x61,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,
-	0x82,0x10,0x04,0x21,0x20,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x20,0x00,0x24,0x21,0x41,0x08,0x20,0x00,0x04,0x21,0x41,0x08,0x20,0x00,0x04,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x61,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,
-	0x41,0x08,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x04,0x21,
-	0x20,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x61,0x08,0xE3,0x18,0x20,0x00,0x82,0x10,0x61,0x08,0xC3,0x18,0x41,0x08,0x61,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x61,0x08,0xE3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0xE3,0x18,0x41,0x08,0x61,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x61,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,
-	0x61,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,
-	0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x04,0x21,
-	0x41,0x08,0x00,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0x00,0x00,0x00,0x00,0x65,0x29,0x00,0x00,0x00,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0xA2,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0x86,0x31,0x00,0x00,0x00,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x65,0x29,0x00,0x00,0x00,0x00,0x04,0x21,
-	0xA2,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x20,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,
-	0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x45,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x65,0x29,
-	0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x29,0x00,0x00,0x00,0x00,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x65,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x20,0x00,0x65,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0x65,0x29,0x00,0x00,0x00,0x00,0x65,0x29,
-	0x41,0x08,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0xA2,0x10,0x24,0x21,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x41,0x08,0x24,0x21,0x00,0x00,0x61,0x08,0x04,0x21,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0xA2,0x10,0x20,0x00,
-	0xC3,0x18,0x41,0x08,0xC3,0x18,0xA2,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0x24,0x21,0xA2,0x10,0xA2,0x10,0x65,0x29,0x41,0x08,0x45,0x29,0x45,0x29,0x41,0x08,0xA6,0x31,0x24,0x21,0x82,0x10,0xE7,0x39,0xE3,0x18,0xA2,0x10,0x08,0x42,0xC3,0x18,0xA2,0x10,0x08,0x42,0xE3,0x18,0xA2,0x10,0x28,0x42,0x24,0x21,0x82,0x10,0x28,0x42,0x86,0x31,
-	0x82,0x10,0xE7,0x39,0x08,0x42,0x82,0x10,0x45,0x29,0x49,0x4A,0xA2,0x10,0xA2,0x10,0x49,0x4A,0x86,0x31,0x82,0x10,0xA6,0x31,0x49,0x4A,0x82,0x10,0xA2,0x10,0x69,0x4A,0x65,0x29,0x82,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0x49,0x4A,0xE7,0x39,0x82,0x10,0xC3,0x18,0x69,0x4A,0x04,0x21,0xA2,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,
-	0x82,0x10,0x08,0x42,0x28,0x42,0x61,0x08,0x82,0x10,0x69,0x4A,0xC7,0x39,0x82,0x10,0xA2,0x10,0x8A,0x52,0x65,0x29,0x82,0x10,0xE3,0x18,0x8A,0x52,0x04,0x21,0xA2,0x10,0x24,0x21,0x8A,0x52,0xA2,0x10,0xA2,0x10,0x65,0x29,0x8A,0x52,0x82,0x10,0x82,0x10,0x86,0x31,0x8A,0x52,0x82,0x10,0x82,0x10,0xA6,0x31,0x8A,0x52,0x82,0x10,0x82,0x10,
-	0xC7,0x39,0x8A,0x52,0x82,0x10,0x82,0x10,0xC7,0x39,0x8A,0x52,0x82,0x10,0xA2,0x10,0x65,0x29,0x65,0x29,0x82,0x10,0xA2,0x10,0xAA,0x52,0x65,0x29,0x82,0x10,0xA2,0x10,0xAA,0x52,0x45,0x29,0x82,0x10,0xA2,0x10,0xAA,0x52,0x24,0x29,0x82,0x10,0xC3,0x18,0xAA,0x52,0x24,0x21,0x82,0x10,0xE3,0x18,0xAA,0x52,0xE3,0x18,0x82,0x10,0x24,0x21,
-	0x8A,0x52,0xC3,0x18,0x82,0x10,0x86,0x31,0x8A,0x52,0xA2,0x10,0x82,0x10,0xC7,0x39,0x69,0x4A,0x82,0x10,0x61,0x08,0x28,0x42,0x08,0x42,0x82,0x10,0x82,0x10,0x69,0x4A,0xA6,0x31,0xA2,0x10,0xC3,0x18,0x69,0x4A,0x04,0x21,0x82,0x10,0x86,0x31,0x69,0x4A,0xA2,0x10,0x82,0x10,0x28,0x42,0xE7,0x39,0x82,0x10,0xC3,0x18,0x69,0x4A,0x04,0x21,
-	0x82,0x10,0xC7,0x39,0x49,0x4A,0x82,0x10,0x82,0x10,0x69,0x4A,0x45,0x29,0x82,0x10,0xE7,0x39,0x28,0x42,0x82,0x10,0x04,0x21,0x69,0x4A,0xC3,0x18,0x82,0x10,0x28,0x42,0x86,0x31,0x82,0x10,0xE7,0x39,0x08,0x42,0x82,0x10,0x86,0x31,0x08,0x42,0x82,0x10,0x45,0x29,0x08,0x42,0x82,0x10,0x24,0x29,0xE7,0x39,0x82,0x10,0x24,0x29,0xA6,0x31,
-	0x41,0x08,0x45,0x29,0x65,0x29,0x41,0x08,0x45,0x29,0x04,0x21,0x41,0x08,0x24,0x21,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0xE3,0x18,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x24,0x29,0x20,0x00,0x24,0x21,0x24,0x21,0x20,0x00,0x86,0x31,
-	0xE3,0x18,0x41,0x08,0xA6,0x31,0xA2,0x10,0x61,0x08,0xC7,0x39,0x82,0x10,0x61,0x08,0xE7,0x39,0xA2,0x10,0x41,0x08,0xE7,0x39,0xE3,0x18,0x41,0x08,0xE7,0x39,0x65,0x29,0x41,0x08,0x86,0x31,0xC7,0x39,0x41,0x08,0xE3,0x18,0x08,0x42,0x82,0x10,0x61,0x08,0x08,0x42,0x65,0x29,0x41,0x08,0x45,0x29,0x08,0x42,0x41,0x08,0x61,0x08,0x08,0x42,
-	0x45,0x29,0x41,0x08,0x04,0x21,0x28,0x42,0x61,0x08,0x61,0x08,0xC7,0x39,0xA6,0x31,0x41,0x08,0x82,0x10,0x28,0x42,0xE3,0x18,0x61,0x08,0x04,0x21,0x28,0x42,0x82,0x10,0x41,0x08,0x86,0x31,0xE7,0x39,0x41,0x08,0x61,0x08,0xE7,0x39,0xA6,0x31,0x41,0x08,0x82,0x10,0x08,0x42,0x45,0x29,0x41,0x08,0xA2,0x10,0x28,0x42,0x04,0x21,0x41,0x08,
-	0xE3,0x18,0x28,0x42,0xC3,0x18,0x41,0x08,0x04,0x21,0x49,0x4A,0xA2,0x10,0x41,0x08,0x24,0x21,0x28,0x42,0xA2,0x10,0x41,0x08,0x24,0x29,0x28,0x42,0xA2,0x10,0x41,0x08,0x45,0x29,0x28,0x42,0xA2,0x10,0x41,0x08,0x45,0x29,0x28,0x42,0xA2,0x10,0x41,0x08,0x24,0x29,0x04,0x21,0x41,0x08,0xC3,0x18,0x28,0x42,0x04,0x21,0x41,0x08,0xC3,0x18,
-	0x28,0x42,0x04,0x21,0x41,0x08,0xC3,0x18,0x28,0x42,0xE3,0x18,0x41,0x08,0xE3,0x18,0x28,0x42,0xC3,0x18,0x41,0x08,0x04,0x21,0x28,0x42,0xA2,0x10,0x41,0x08,0x24,0x21,0x08,0x42,0x82,0x10,0x41,0x08,0x65,0x29,0xE7,0x39,0x82,0x10,0x41,0x08,0xA6,0x31,0xC7,0x39,0x61,0x08,0x41,0x08,0xE7,0x39,0x86,0x31,0x41,0x08,0x61,0x08,0x28,0x42,
-	0x24,0x21,0x61,0x08,0xA2,0x10,0x28,0x42,0xC3,0x18,0x41,0x08,0x65,0x29,0x08,0x42,0x61,0x08,0x41,0x08,0xE7,0x39,0x86,0x31,0x41,0x08,0xA2,0x10,0x28,0x42,0xC3,0x18,0x41,0x08,0xA6,0x31,0xE7,0x39,0x61,0x08,0x82,0x10,0x28,0x42,0xE3,0x18,0x41,0x08,0xA6,0x31,0xC7,0x39,0x41,0x08,0xC3,0x18,0x28,0x42,0x82,0x10,0x41,0x08,0x08,0x42,
-	0x45,0x29,0x41,0x08,0xA6,0x31,0xA6,0x31,0x41,0x08,0x65,0x29,0xE7,0x39,0x41,0x08,0x04,0x21,0xE7,0x39,0x41,0x08,0x04,0x21,0xA6,0x31,0x41,0x08,0x04,0x21,0x86,0x31,0x20,0x00,0x04,0x21,0x24,0x29,0x20,0x00,0x24,0x21,0xC3,0x18,0x20,0x00,0x04,0x21,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,
-	0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,
-	0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x29,0x00,0x00,0x00,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x24,0x29,0x41,0x08,0x00,0x00,0x04,0x21,0xA2,0x10,
-	0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x20,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x24,0x29,0x61,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,
-	0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,
-	0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x61,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x61,0x08,0x45,0x29,0x00,0x00,0x00,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0x41,0x08,0xE3,0x18,
-	0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,
-	0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x61,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xC3,0x18,0x82,0x10,0x61,0x08,
-	0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0xE3,0x18,0x82,0x10,0x82,0x10,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,
-	0x82,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,
-	0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0xE3,0x18,0x41,0x08,0x82,0x10,0x82,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x82,0x10,0x82,0x10,0xC3,0x18,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,
-	0x61,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0xA2,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,0x61,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,
-	0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0xC3,0x18,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x41,0x08,0x45,0x29,0x00,0x00,0x00,0x00,
-	0x45,0x29,0x41,0x08,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x45,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x45,0x29,0x20,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x24,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x86,0x31,0x61,0x08,0x00,0x00,0x41,0x08,0xA6,0x31,0x61,0x08,0x00,0x00,0x82,0x10,0xE7,0x39,0x82,0x10,0x00,0x00,0xA2,0x10,0x08,0x42,0x82,0x10,0x20,0x00,0xC3,0x18,0x28,0x42,0xA2,0x10,0x41,0x08,0xC3,0x18,0x69,0x4A,0xE3,0x18,0x41,0x08,0xC3,0x18,
-	0x8A,0x52,0x04,0x21,0x41,0x08,0xC3,0x18,0xAA,0x52,0x65,0x29,0x61,0x08,0xA2,0x10,0x8A,0x52,0x49,0x4A,0x82,0x10,0x41,0x08,0xA6,0x31,0x69,0x4A,0xA2,0x10,0x41,0x08,0x65,0x29,0x8A,0x52,0x82,0x10,0x41,0x08,0x24,0x21,0x69,0x4A,0x82,0x10,0x41,0x08,0x04,0x21,0x49,0x4A,0x82,0x10,0x20,0x00,0xC3,0x18,0x08,0x42,0x61,0x08,0x00,0x00,
-	0xA2,0x10,0xE7,0x39,0x41,0x08,0x00,0x00,0xA2,0x10,0xA6,0x31,0x41,0x08,0x00,0x00,0xA2,0x10,0x86,0x31,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x29,0x00,0x00,0x00,0x00,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0x04,0x21,
-	0xA2,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x65,0x29,0x41,0x08,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x41,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x24,0x21,0x41,0x08,0x00,0x00,0x04,0x21,0x20,0x00,0x00,0x00,
-	0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x24,0x21,0x41,0x08,0x41,0x08,0x45,0x29,0x00,0x00,
-	0xC3,0x18,0x65,0x29,0x00,0x00,0x04,0x21,0x65,0x29,0x00,0x00,0x04,0x21,0x86,0x31,0x00,0x00,0xC3,0x18,0xA6,0x31,0x20,0x00,0x61,0x08,0xE7,0x39,0x41,0x08,0x20,0x00,0xE7,0x39,0x04,0x21,0x20,0x00,0x86,0x31,0xA6,0x31,0x41,0x08,0x82,0x10,0x08,0x42,0x82,0x10,0x41,0x08,0xC7,0x39,0xA6,0x31,0x41,0x08,0xA2,0x10,0x28,0x42,0xC3,0x18,
-	0x61,0x08,0xA6,0x31,0x08,0x42,0x82,0x10,0x61,0x08,0x28,0x42,0x65,0x29,0x82,0x10,0xC3,0x18,0x69,0x4A,0xE3,0x18,0x82,0x10,0x65,0x29,0x69,0x4A,0xA2,0x10,0x82,0x10,0xE7,0x39,0x49,0x4A,0x82,0x10,0x82,0x10,0x28,0x42,0x08,0x42,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,
-	0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0x69,0x4A,0x08,0x42,0x82,0x10,0x82,0x10,0x28,0x42,0x08,0x42,0x82,0x10,0x82,0x10,0xE7,0x39,0x49,0x4A,0x82,0x10,0x61,0x08,0xA6,0x31,0x69,0x4A,0x82,0x10,0x41,0x08,0x65,0x29,0x69,0x4A,0xC3,0x18,0x20,0x00,0x24,0x21,0x04,0x21,0x41,0x08,0xE3,0x18,0x69,0x4A,0x24,0x21,0x41,0x08,0xA2,0x10,
-	0x8A,0x52,0x65,0x29,0x61,0x08,0xA2,0x10,0x8A,0x52,0xA6,0x31,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0x69,0x4A,0x08,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0x08,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0x28,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0x08,0x42,0x82,0x10,0x82,0x10,0x69,0x4A,0xC7,0x39,0x82,0x10,0xA2,0x10,
-	0x69,0x4A,0x65,0x29,0xA2,0x10,0xC3,0x18,0x69,0x4A,0xE3,0x18,0x82,0x10,0x45,0x29,0x69,0x4A,0x82,0x10,0x82,0x10,0xC7,0x39,0x08,0x42,0x61,0x08,0x82,0x10,0x28,0x42,0x45,0x29,0x61,0x08,0x24,0x21,0x28,0x42,0x61,0x08,0x41,0x08,0xE7,0x39,0x86,0x31,0x41,0x08,0x04,0x21,0x08,0x42,0x41,0x08,0x41,0x08,0xE7,0x39,0x24,0x21,0x20,0x00,
-	0x65,0x29,0xA6,0x31,0x20,0x00,0xC3,0x18,0xC7,0x39,0x20,0x00,0x41,0x08,0xC7,0x39,0x61,0x08,0x20,0x00,0x86,0x31,0xA2,0x10,0x00,0x00,0x86,0x31,0x82,0x10,0x00,0x00,0x65,0x29,0x41,0x08,0x20,0x00,0x24,0x21,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0xA2,0x10,
-	0x41,0x08,0xE3,0x18,0x41,0x08,0xE3,0x18,0xC3,0x18,0x61,0x08,0x24,0x21,0x41,0x08,0x24,0x21,0x24,0x21,0x61,0x08,0x86,0x31,0xC3,0x18,0xC3,0x18,0xA6,0x31,0x82,0x10,0x24,0x29,0xC7,0x39,0x82,0x10,0x65,0x29,0xE7,0x39,0x82,0x10,0x86,0x31,0x08,0x42,0x82,0x10,0x45,0x29,0x28,0x42,0xA2,0x10,0xC3,0x18,0x49,0x4A,0x04,0x21,0x82,0x10,
-	0x28,0x42,0xC7,0x39,0x82,0x10,0xA6,0x31,0x49,0x4A,0x82,0x10,0xA2,0x10,0x69,0x4A,0x45,0x29,0x82,0x10,0xC7,0x39,0x28,0x42,0x82,0x10,0xA2,0x10,0x69,0x4A,0x65,0x29,0xA2,0x10,0x45,0x29,0x69,0x4A,0x82,0x10,0x82,0x10,0xE7,0x39,0x08,0x42,0x61,0x08,0x82,0x10,0x28,0x42,0x86,0x31,0x82,0x10,0xA2,0x10,0x49,0x4A,0xE3,0x18,0x61,0x08,
-	0xE3,0x18,0x49,0x4A,0x82,0x10,0x41,0x08,0x04,0x21,0x28,0x42,0x61,0x08,0x41,0x08,0x04,0x21,0x08,0x42,0x41,0x08,0x20,0x00,0xE3,0x18,0xE7,0x39,0x41,0x08,0x00,0x00,0xC3,0x18,0xA6,0x31,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x61,0x08,0x00,0x00,0x61,0x08,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x61,0x08,0x00,0x00,0x82,0x10,
-	0xC7,0x39,0x82,0x10,0x00,0x00,0x61,0x08,0xE7,0x39,0xA2,0x10,0x20,0x00,0x82,0x10,0x08,0x42,0xC3,0x18,0x41,0x08,0xA2,0x10,0x28,0x42,0xA2,0x10,0x41,0x08,0xE3,0x18,0x49,0x4A,0xA2,0x10,0x61,0x08,0x65,0x29,0x28,0x42,0x82,0x10,0x61,0x08,0xE7,0x39,0xE7,0x39,0x82,0x10,0x61,0x08,0x49,0x4A,0x86,0x31,0x82,0x10,0xE3,0x18,0x69,0x4A,
-	0xE3,0x18,0x82,0x10,0xE7,0x39,0x28,0x42,0xA2,0x10,0x82,0x10,0x69,0x4A,0x65,0x29,0x82,0x10,0xA6,0x31,0x49,0x4A,0x82,0x10,0xA2,0x10,0x69,0x4A,0x45,0x29,0x82,0x10,0x08,0x42,0xE7,0x39,0x82,0x10,0x86,0x31,0x49,0x4A,0xA2,0x10,0x04,0x21,0x28,0x42,0xC3,0x18,0xA2,0x10,0x08,0x42,0x04,0x21,0xA2,0x10,0xE7,0x39,0x04,0x21,0x82,0x10,
-	0xA6,0x31,0xC3,0x18,0xC3,0x18,0x65,0x29,0x61,0x08,0x04,0x21,0x24,0x21,0x41,0x08,0x04,0x21,0xC3,0x18,0x41,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0xC3,0x18,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x24,0x21,0x00,0x00,
-	0x41,0x08,0x24,0x29,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x61,0x08,0x65,0x29,0x00,0x00,0x20,0x00,0x86,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x82,0x10,0x00,0x00,0x24,0x21,0x04,0x21,0x00,0x00,0x61,0x08,0x86,0x31,0x00,0x00,0x00,0x00,0x45,0x29,0xA2,0x10,0x00,0x00,0x61,0x08,0x65,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,
-	0x00,0x00,0x20,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0x24,0x29,0x20,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,
-	0x82,0x10,0x61,0x08,0x24,0x21,0x20,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0x61,0x08,0xE3,0x18,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0x61,0x08,0x61,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x20,0x00,0x86,0x31,0x20,0x00,0x00,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x20,0x00,0x86,0x31,0x00,0x00,0x00,0x00,
-	0x45,0x29,0xC3,0x18,0x00,0x00,0xC3,0x18,0x65,0x29,0x00,0x00,0x61,0x08,0x86,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x00,0x00,0x00,0x00,0x45,0x29,0x20,0x00,0x00,0x00,0x24,0x29,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x20,0x00,0x20,0x00,0x24,0x21,0x20,0x00,0x20,0x00,0x24,0x21,0x41,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x20,0x00,
-	0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x61,0x08,0xE3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x82,0x10,0x82,0x10,
-	0x82,0x10,0x41,0x08,0xA2,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xE3,0x18,0x00,0x00,0x00,0x00,0x24,0x21,0x65,0x29,0x20,0x00,0x20,0x00,0x04,0x21,
-	0x08,0x42,0x82,0x10,0x41,0x08,0xE3,0x18,0x8A,0x52,0x04,0x21,0x61,0x08,0xC3,0x18,0x8A,0x52,0x49,0x4A,0xA2,0x10,0x41,0x08,0x65,0x29,0x8A,0x52,0xA2,0x10,0x41,0x08,0xC3,0x18,0x28,0x42,0xC3,0x18,0x00,0x00,0x41,0x08,0xA6,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xE3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0x04,0x21,0x61,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0x82,0x10,
-	0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x20,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x41,0x08,0x04,0x21,0x20,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x20,0x00,
-	0x04,0x21,0x00,0x00,0x20,0x00,0xC3,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,
-	0xE3,0x18,0xA2,0x10,0x00,0x00,0x61,0x08,0x24,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x00,0x00,0x24,0x29,0x45,0x29,0x00,0x00,0x20,0x00,0x86,0x31,0xA6,0x31,0x41,0x08,0x41,0x08,0xA6,0x31,
-	0x08,0x42,0x61,0x08,0x82,0x10,0x86,0x31,0x69,0x4A,0xA2,0x10,0x82,0x10,0x24,0x29,0xCB,0x5A,0x04,0x21,0xA2,0x10,0xC3,0x18,0xCB,0x5A,0x65,0x29,0xA2,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0xA2,0x10,0x61,0x08,0xA6,0x31,0x69,0x4A,0xC3,0x18,0x41,0x08,0x04,0x21,0x04,0x21,0x41,0x08,0xC3,0x18,0x8A,0x52,0x65,0x29,0x61,0x08,0xA2,0x10,
-	0x69,0x4A,0x08,0x42,0x82,0x10,0xA2,0x10,0xE7,0x39,0x8A,0x52,0x82,0x10,0xA2,0x10,0x65,0x29,0xCB,0x5A,0xC3,0x18,0x82,0x10,0xE3,0x18,0xAA,0x52,0x04,0x21,0x82,0x10,0x82,0x10,0x49,0x4A,0x24,0x21,0x41,0x08,0x41,0x08,0xE7,0x39,0x04,0x21,0x00,0x00,0x20,0x00,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x45,0x29,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x45,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x20,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x04,0x21,0xA2,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x61,0x08,0x04,0x21,0xA2,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,
-	0x20,0x00,0x61,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,
-	0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x41,0x08,0x45,0x29,0x00,0x00,0x00,0x00,0x65,0x29,
-	0x20,0x00,0x00,0x00,0x04,0x21,0xE3,0x18,0x00,0x00,0x41,0x08,0x86,0x31,0x00,0x00,0x00,0x00,0x45,0x29,0x04,0x21,0x00,0x00,0x41,0x08,0xC7,0x39,0x61,0x08,0x00,0x00,0x24,0x21,0xA6,0x31,0x20,0x00,0x20,0x00,0xE7,0x39,0x65,0x29,0x41,0x08,0x61,0x08,0x28,0x42,0x04,0x21,0x82,0x10,0xA2,0x10,0x69,0x4A,0xE3,0x18,0xA2,0x10,0x04,0x21,
-	0x8A,0x52,0xC3,0x18,0xA2,0x10,0x45,0x29,0xAA,0x52,0xC3,0x18,0xA2,0x10,0x24,0x21,0xCB,0x5A,0xE3,0x18,0xC3,0x18,0x04,0x21,0xAA,0x52,0xE3,0x18,0xA2,0x10,0xE3,0x18,0x8A,0x52,0x24,0x21,0x82,0x10,0xA2,0x10,0x28,0x42,0x65,0x29,0x41,0x08,0x41,0x08,0x86,0x31,0x86,0x31,0x41,0x08,0x00,0x00,0xE3,0x18,0x86,0x31,0x41,0x08,0x00,0x00,
-	0x82,0x10,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0xC3,0x18,0x00,0x00,0x61,0x08,0xE7,0x39,0x65,0x29,0x41,0x08,0x61,0x08,0xE7,0x39,0xE7,0x39,0x82,0x10,0x82,0x10,
-	0xA6,0x31,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x65,0x29,0xAA,0x52,0xC3,0x18,0xC3,0x18,0x24,0x29,0xAA,0x52,0xC3,0x18,0xA2,0x10,0x24,0x21,0xAA,0x52,0xC3,0x18,0xA2,0x10,0x24,0x21,0x8A,0x52,0xA2,0x10,0x82,0x10,0x45,0x29,0x69,0x4A,0x82,0x10,0x61,0x08,0x86,0x31,0x08,0x42,0x41,0x08,0x41,0x08,0xA6,0x31,0x86,0x31,0x20,0x00,0x41,0x08,
-	0xE7,0x39,0xA2,0x10,0x00,0x00,0xA2,0x10,0xA6,0x31,0x00,0x00,0x00,0x00,0x45,0x29,0x04,0x21,0x00,0x00,0x41,0x08,0x86,0x31,0x00,0x00,0x00,0x00,0x24,0x29,0xC3,0x18,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x65,0x29,0x00,0x00,0x00,0x00,0x24,0x29,0x41,0x08,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0xE3,0x18,0x82,0x10,
-	0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0xC3,0x18,0x82,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x65,0x29,0x41,0x08,0x04,0x21,0x65,0x29,0x41,0x08,0x65,0x29,
-	0x86,0x31,0x41,0x08,0x86,0x31,0x86,0x31,0x41,0x08,0x86,0x31,0xA6,0x31,0x61,0x08,0x86,0x31,0xE7,0x39,0x82,0x10,0x04,0x21,0x28,0x42,0xA2,0x10,0x82,0x10,0x28,0x42,0x65,0x29,0x82,0x10,0xE7,0x39,0x08,0x42,0xA2,0x10,0xC3,0x18,0x69,0x4A,0x04,0x21,0xA2,0x10,0xE7,0x39,0x28,0x42,0xA2,0x10,0xA2,0x10,0x69,0x4A,0x86,0x31,0xA2,0x10,
-	0x24,0x29,0x8A,0x52,0xA2,0x10,0xA2,0x10,0xC7,0x39,0x69,0x4A,0x82,0x10,0x82,0x10,0x08,0x42,0x08,0x42,0x82,0x10,0x82,0x10,0x28,0x42,0xA6,0x31,0x61,0x08,0x82,0x10,0x08,0x42,0x65,0x29,0x41,0x08,0x61,0x08,0xE7,0x39,0x24,0x21,0x00,0x00,0x20,0x00,0x86,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x00,0x00,0x61,0x08,0x41,0x08,0x45,0x29,0x61,0x08,0x61,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0x24,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x65,0x29,0x45,0x29,0x00,0x00,0x20,0x00,0x86,0x31,0xA6,0x31,0x41,0x08,0x41,0x08,
-	0xC7,0x39,0xC7,0x39,0x61,0x08,0x61,0x08,0x08,0x42,0xE7,0x39,0x82,0x10,0x82,0x10,0x49,0x4A,0xC7,0x39,0x82,0x10,0xA2,0x10,0x8A,0x52,0x65,0x29,0xA2,0x10,0x04,0x21,0x8A,0x52,0xC3,0x18,0xA2,0x10,0xE7,0x39,0x49,0x4A,0xA2,0x10,0xA2,0x10,0x69,0x4A,0x86,0x31,0xA2,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0xA2,0x10,0x49,0x4A,0x86,0x31,
-	0x82,0x10,0xC7,0x39,0x08,0x42,0x82,0x10,0x04,0x21,0x28,0x42,0x82,0x10,0x82,0x10,0x08,0x42,0x04,0x21,0x82,0x10,0xC7,0x39,0x45,0x29,0x41,0x08,0x86,0x31,0x24,0x21,0x41,0x08,0x65,0x29,0xE3,0x18,0x41,0x08,0x45,0x29,0x82,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,
-	0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,
-	0xA2,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0x04,0x21,0xC3,0x18,0x41,0x08,0x45,0x29,0x41,0x08,0xE3,0x18,0x65,0x29,0x41,0x08,0x24,0x29,0x86,0x31,0x41,0x08,0x65,0x29,0x86,0x31,0x41,0x08,0x65,0x29,0xC7,0x39,0x41,0x08,0x24,0x21,0xE7,0x39,0x41,0x08,0xA2,0x10,0x08,0x42,0xC3,0x18,0x61,0x08,0xE7,0x39,
-	0x86,0x31,0x41,0x08,0x24,0x21,0x08,0x42,0x41,0x08,0x41,0x08,0xE7,0x39,0x24,0x21,0x20,0x00,0xE3,0x18,0xE7,0x39,0x41,0x08,0x00,0x00,0x65,0x29,0x45,0x29,0x00,0x00,0x20,0x00,0xA6,0x31,0x82,0x10,0x00,0x00,0x41,0x08,0x86,0x31,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x41,0x08,0x82,0x10,0x20,0x00,0x24,0x21,0x61,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x61,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x45,0x29,
-	0x65,0x29,0x20,0x00,0x20,0x00,0x04,0x21,0x69,0x4A,0xE3,0x18,0x82,0x10,0xC3,0x18,0x8A,0x52,0x49,0x4A,0xA2,0x10,0x61,0x08,0x24,0x21,0x69,0x4A,0xC3,0x18,0x20,0x00,0x41,0x08,0x86,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0x24,0x29,
-	0x00,0x00,0x82,0x10,0x20,0x00,0x24,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0xE3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x86,0x31,0x20,0x00,0x00,0x00,0xC3,0x18,
-	0x65,0x29,0x00,0x00,0x00,0x00,0x86,0x31,0x04,0x21,0x00,0x00,0x61,0x08,0xE7,0x39,0x82,0x10,0x20,0x00,0x86,0x31,0xC7,0x39,0x41,0x08,0x82,0x10,0x08,0x42,0xC3,0x18,0x41,0x08,0xC7,0x39,0xA6,0x31,0x41,0x08,0x24,0x21,0x08,0x42,0x61,0x08,0x82,0x10,0xE7,0x39,0xC3,0x18,0x41,0x08,0xE7,0x39,0x04,0x21,0x41,0x08,0xA6,0x31,0x04,0x21,
-	0x41,0x08,0x65,0x29,0xC3,0x18,0x41,0x08,0x45,0x29,0x61,0x08,0x82,0x10,0x04,0x21,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x41,0x08,
-	0x04,0x21,0x00,0x00,0x61,0x08,0x04,0x21,0x00,0x00,0x41,0x08,0x24,0x21,0x00,0x00,0x20,0x00,0x45,0x29,0x00,0x00,0x00,0x00,0x24,0x29,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,
-	0x41,0x08,0xA2,0x10,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x61,0x08,0x04,0x21,0x20,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,
-	0x41,0x08,0x00,0x00,0x41,0x08,0xC7,0x39,0xC3,0x18,0x20,0x00,0x41,0x08,0x08,0x42,0xA6,0x31,0x41,0x08,0x82,0x10,0xA6,0x31,0x8A,0x52,0xC3,0x18,0xA2,0x10,0x04,0x21,0xCB,0x5A,0x86,0x31,0x82,0x10,0x82,0x10,0x08,0x42,0x28,0x42,0xA2,0x10,0x41,0x08,0x04,0x21,0xE3,0x18,0x41,0x08,0xC3,0x18,0x69,0x4A,0xA6,0x31,0x82,0x10,0x82,0x10,
-	0xE7,0x39,0x8A,0x52,0xA2,0x10,0xA2,0x10,0x04,0x21,0xAA,0x52,0x24,0x21,0x82,0x10,0x61,0x08,0xE7,0x39,0xA6,0x31,0x41,0x08,0x00,0x00,0x04,0x21,0x86,0x31,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x04,0x21,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,
-	0x00,0x00,0xA2,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x61,0x08,0x82,0x10,0x20,0x00,0xE3,0x18,0x82,0x10,0x61,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x61,0x08,0x45,0x29,0x20,0x00,
-	0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x20,0x00,0x24,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0xC3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0x61,0x08,0x20,0x00,0xC3,0x18,0x61,0x08,0x20,0x00,0xC3,0x18,0x61,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x61,0x08,0xA2,0x10,0x82,0x10,0x82,0x10,0x61,0x08,
-	0x82,0x10,0x82,0x10,0x61,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x86,0x31,0x61,0x08,0x00,0x00,0x61,0x08,0x08,0x42,0xC3,0x18,0x41,0x08,0x82,0x10,0x69,0x4A,0x45,0x29,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0xE7,0x39,0x8A,0x52,0x82,0x10,0xA2,0x10,0x24,0x21,0xAA,0x52,0xE3,0x18,0x82,0x10,0x82,0x10,0xE7,0x39,0x65,0x29,0x41,0x08,0x00,0x00,
-	0xE3,0x18,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,0xA2,0x10,0x00,0x00,0x61,0x08,0xE7,0x39,0xA6,0x31,0x41,0x08,0x82,0x10,0x45,0x29,0x8A,0x52,0xE3,0x18,0xA2,0x10,0xC3,0x18,0xCB,0x5A,0x65,0x29,0x82,0x10,
-	0x82,0x10,0x49,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0xA6,0x31,0x28,0x42,0x61,0x08,0x41,0x08,0x04,0x21,0xE7,0x39,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0x61,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,
-	0x61,0x08,0xA2,0x10,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0xC3,0x18,0x82,0x10,0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0xC3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,
-	0x41,0x08,0xC3,0x18,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x61,0x08,
-	0x20,0x00,0xE3,0x18,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x61,0x08,0x45,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x20,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x82,0x10,
-	0x65,0x29,0x00,0x00,0x00,0x00,0x24,0x21,0x65,0x29,0x00,0x00,0x20,0x00,0xC7,0x39,0x65,0x29,0x41,0x08,0x41,0x08,0x28,0x42,0x86,0x31,0x82,0x10,0x82,0x10,0x69,0x4A,0xA6,0x31,0x82,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0x28,0x42,0x28,0x42,0x82,0x10,0x82,0x10,0xA6,0x31,0x69,0x4A,0x82,0x10,0x61,0x08,0x04,0x21,
-	0x49,0x4A,0x82,0x10,0x20,0x00,0x61,0x08,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0xC3,0x18,
-	0x20,0x00,0x61,0x08,0x20,0x00,0x24,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x45,0x29,0x41,0x08,0x00,0x00,0xC3,0x18,0x28,0x42,0xC3,0x18,0x61,0x08,0xA2,0x10,0xAA,0x52,0x45,0x29,0x82,0x10,0x82,0x10,0x8A,0x52,0xC7,0x39,0x82,0x10,0x82,0x10,0x49,0x4A,0x08,0x42,0x82,0x10,
-	0x82,0x10,0x08,0x42,0x28,0x42,0x61,0x08,0x82,0x10,0xC7,0x39,0xE7,0x39,0x41,0x08,0x41,0x08,0xA6,0x31,0x86,0x31,0x00,0x00,0x20,0x00,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x86,0x31,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x65,0x29,0x20,0x00,0x00,0x00,0xE3,0x18,
-	0xA2,0x10,0x00,0x00,0x61,0x08,0x24,0x29,0x20,0x00,0x00,0x00,0x24,0x29,0x61,0x08,0x00,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,
-	0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0xC3,0x18,0x00,0x00,0xE3,0x18,0x41,0x08,0x41,0x08,0x04,0x21,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x04,0x21,0xE3,0x18,0x00,0x00,0x24,0x21,0xE3,0x18,0x00,0x00,0x24,0x21,0x04,0x21,0x00,0x00,0x04,0x21,0x65,0x29,0x00,0x00,0xA2,0x10,0xA6,0x31,0x20,0x00,0x20,0x00,0xE7,0x39,0xC3,0x18,
-	0x20,0x00,0x86,0x31,0xA6,0x31,0x41,0x08,0x82,0x10,0x28,0x42,0xC3,0x18,0x61,0x08,0xA6,0x31,0x08,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0x86,0x31,0xA2,0x10,0xE3,0x18,0x8A,0x52,0x04,0x21,0xC3,0x18,0x65,0x29,0x8A,0x52,0xA2,0x10,0xA2,0x10,0xA6,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0xA6,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0x65,0x29,
-	0x49,0x4A,0x41,0x08,0x41,0x08,0x04,0x21,0x08,0x42,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0x00,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x24,0x21,
-	0xC3,0x18,0x00,0x00,0x20,0x00,0x24,0x29,0x28,0x42,0xA2,0x10,0x82,0x10,0xC3,0x18,0x8A,0x52,0x49,0x4A,0xA2,0x10,0x82,0x10,0x04,0x21,0x49,0x4A,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x20,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x20,0x00,0x61,0x08,
-	0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x65,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0x08,0x42,0xC3,0x18,0x41,0x08,0x82,0x10,0x69,0x4A,0x04,0x21,0x82,0x10,0x82,0x10,0x8A,0x52,0x45,0x29,0xA2,0x10,0xA2,0x10,0x8A,0x52,0x45,0x29,0xC3,0x18,0x04,0x21,0x8A,0x52,0x04,0x21,0xC3,0x18,
-	0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0xE7,0x39,0x28,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0x45,0x29,0x82,0x10,0x24,0x29,0x28,0x42,0x41,0x08,0x41,0x08,0xE7,0x39,0x24,0x21,0x20,0x00,0x24,0x21,0xA6,0x31,0x20,0x00,0x41,0x08,0xA6,0x31,0x41,0x08,0x00,0x00,0x86,0x31,0xA2,0x10,0x00,0x00,0x24,0x29,0xE3,0x18,0x00,0x00,0x04,0x21,
-	0xC3,0x18,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0xE3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0x04,0x21,0xC3,0x18,0x82,0x10,0x45,0x29,0x61,0x08,0x04,0x21,0x65,0x29,0x41,0x08,0x65,0x29,0x86,0x31,
-	0x41,0x08,0x86,0x31,0xA6,0x31,0x61,0x08,0xA6,0x31,0xC7,0x39,0x82,0x10,0x86,0x31,0x08,0x42,0x82,0x10,0x04,0x21,0x49,0x4A,0xE3,0x18,0x82,0x10,0x28,0x42,0xA6,0x31,0x82,0x10,0x86,0x31,0x49,0x4A,0x82,0x10,0xA2,0x10,0x49,0x4A,0x86,0x31,0x82,0x10,0x24,0x21,0x49,0x4A,0x82,0x10,0x82,0x10,0xA6,0x31,0xE7,0x39,0x41,0x08,0x41,0x08,
-	0xE7,0x39,0x45,0x29,0x20,0x00,0x41,0x08,0xC7,0x39,0x82,0x10,0x00,0x00,0x41,0x08,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,
-	0x20,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x86,0x31,0x82,0x10,0x00,0x00,0x82,0x10,0x28,0x42,0xA6,0x31,0x61,0x08,0x82,0x10,0x86,0x31,0xCB,0x5A,0x04,0x21,0xA2,0x10,0xA2,0x10,0x28,0x42,0x08,0x42,0xA2,0x10,0x20,0x00,0xE3,0x18,0xC3,0x18,0x41,0x08,0xC3,0x18,0x69,0x4A,0xE7,0x39,0x82,0x10,0xA2,0x10,
-	0x65,0x29,0xCB,0x5A,0x04,0x21,0x82,0x10,0x82,0x10,0xE7,0x39,0xC7,0x39,0x41,0x08,0x00,0x00,0xA2,0x10,0x86,0x31,0x61,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,
-	0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x65,0x29,0x20,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0x20,0x00,0x20,0x00,0xA6,0x31,0xA6,0x31,0x41,0x08,0x41,0x08,0x28,0x42,0x65,0x29,0x82,0x10,0xE3,0x18,0x69,0x4A,0xC3,0x18,0x82,0x10,0xE7,0x39,0x08,0x42,0x82,0x10,0xC3,0x18,0x69,0x4A,
-	0x04,0x21,0x82,0x10,0xE7,0x39,0xE7,0x39,0x82,0x10,0x45,0x29,0x28,0x42,0xA2,0x10,0xA2,0x10,0x08,0x42,0x04,0x21,0x82,0x10,0xE7,0x39,0x45,0x29,0x61,0x08,0x86,0x31,0x24,0x21,0x41,0x08,0x65,0x29,0x04,0x21,0x41,0x08,0x24,0x21,0xA2,0x10,0x82,0x10,0x04,0x21,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,
-	0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,
-	0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x04,0x21,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0xA2,0x10,0x24,0x21,0x00,0x00,0xC3,0x18,0x45,0x29,0x00,0x00,0xC3,0x18,0x65,0x29,0x00,0x00,0x61,0x08,0x86,0x31,0x00,0x00,0x00,0x00,0x86,0x31,0x82,0x10,0x00,0x00,0x04,0x21,0x04,0x21,
-	0x00,0x00,0x20,0x00,0x86,0x31,0x00,0x00,0x00,0x00,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,
-	0x00,0x00,0xE3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x61,0x08,0x41,0x08,0xA2,0x10,0x8A,0x52,0x24,0x21,0x82,0x10,0x82,0x10,0x49,0x4A,0x49,0x4A,0x82,0x10,0xA2,0x10,0x24,0x29,0xAA,0x52,0x04,0x21,0x41,0x08,0x41,0x08,
-	0x86,0x31,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0x45,0x29,0x41,0x08,0x61,0x08,0x65,0x29,0x8A,0x52,0xE3,0x18,0xA2,0x10,0xA2,0x10,0x8A,0x52,0xE7,0x39,0xA2,0x10,0x82,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,
-	0x41,0x08,0x82,0x10,0xC7,0x39,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0xC3,0x18,0x41,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,
-	0x04,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x24,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x86,0x31,0x00,0x00,0x00,0x00,0x65,0x29,0xC3,0x18,0x00,0x00,0xC3,0x18,0x65,0x29,0x00,0x00,0x41,0x08,0x86,0x31,0x00,0x00,0x00,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x45,0x29,
-	0x82,0x10,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0xE3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xE3,0x18,0x20,0x00,0x20,0x00,0xE3,0x18,
-	0x20,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x20,0x00,0x04,0x21,0x20,0x00,0x20,0x00,0x24,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xE3,0x18,0x61,0x08,
-	0x82,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x24,0x29,0x24,0x21,0x00,0x00,0x20,0x00,0x65,0x29,0xE7,0x39,0x82,0x10,0x82,0x10,0x24,0x21,0xAA,0x52,0xE3,0x18,0xC3,0x18,0xA2,0x10,0xAA,0x52,
-	0xA6,0x31,0x82,0x10,0x82,0x10,0xA6,0x31,0x69,0x4A,0x82,0x10,0x41,0x08,0xA2,0x10,0xA6,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x29,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x24,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,
-	0x20,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x82,0x10,0x41,0x08,0xA2,0x10,0x8A,0x52,0x65,0x29,0x82,0x10,0x82,0x10,0x28,0x42,0x69,0x4A,0x82,0x10,0xA2,0x10,0x24,0x29,0xAA,0x52,0xC3,0x18,0x82,0x10,0xA2,0x10,0x28,0x42,0xE3,0x18,0x20,0x00,0x20,0x00,0x65,0x29,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x41,0x08,0x04,0x21,0x61,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x82,0x10,0xE3,0x18,0x41,0x08,0x20,0x00,
-	0xC3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x61,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0x24,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0x82,0x10,0x65,0x29,0x00,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x20,0x00,0x20,0x00,0x65,0x29,0x08,0x42,0x61,0x08,0x82,0x10,0x86,0x31,0x69,0x4A,
-	0x82,0x10,0xC3,0x18,0x45,0x29,0xAA,0x52,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xAA,0x52,0x45,0x29,0x82,0x10,0x82,0x10,0xE7,0x39,0xA6,0x31,0x41,0x08,0x00,0x00,0xC3,0x18,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0x00,0x00,0x20,0x00,0x45,0x29,0xE7,0x39,0xA2,0x10,0x82,0x10,0xC3,0x18,0x8A,0x52,0x49,0x4A,0xA2,0x10,0x82,0x10,0xE3,0x18,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x82,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x82,0x10,0x86,0x31,0xA2,0x10,0x00,0x00,0x61,0x08,0x08,0x42,0x86,0x31,0x61,0x08,0x82,0x10,0xA6,0x31,0x69,0x4A,0x82,0x10,0xC3,0x18,0x24,0x29,0xCB,0x5A,0xE3,0x18,0xC3,0x18,0xC3,0x18,0x8A,0x52,0x04,0x21,0x82,0x10,0x82,0x10,0x28,0x42,0xE3,0x18,0x20,0x00,0x41,0x08,0xC7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0x86,0x31,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x20,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x82,0x10,0x04,0x21,0x61,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x61,0x08,0xE3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x00,0x00,0x20,0x00,0x45,0x29,0x00,0x00,0x00,0x00,0x45,0x29,0x61,0x08,0x00,0x00,0xC3,0x18,0x24,0x29,0x00,0x00,0x00,0x00,0xA6,0x31,0xA2,0x10,0x00,0x00,0xE3,0x18,0xC7,0x39,0x41,0x08,0x41,0x08,0xE7,0x39,0x86,0x31,0x61,0x08,0x82,0x10,0x49,0x4A,
-	0x65,0x29,0x82,0x10,0xC3,0x18,0x8A,0x52,0x24,0x21,0xA2,0x10,0x04,0x21,0xAA,0x52,0x04,0x21,0xC3,0x18,0xE3,0x18,0x8A,0x52,0x04,0x21,0xA2,0x10,0xA2,0x10,0x49,0x4A,0x04,0x21,0x41,0x08,0x41,0x08,0x86,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xE3,0x18,0x00,0x00,0x82,0x10,
-	0x41,0x08,0x24,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xC7,0x39,0xC3,0x18,0x41,0x08,0x82,0x10,0xE7,0x39,0x69,0x4A,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x69,0x4A,0xE7,0x39,0xA2,0x10,0x41,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0xC3,0x18,0x49,0x4A,0x28,0x42,0x82,0x10,0xA2,0x10,
-	0x04,0x21,0x8A,0x52,0x86,0x31,0x82,0x10,0x41,0x08,0x04,0x21,0xA6,0x31,0x61,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x04,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x65,0x29,0x45,0x29,0x20,0x00,
-	0x41,0x08,0x86,0x31,0x08,0x42,0x82,0x10,0x82,0x10,0x86,0x31,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x86,0x31,0x8A,0x52,0xA2,0x10,0xA2,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0xA6,0x31,0x28,0x42,0x61,0x08,0x41,0x08,0xE7,0x39,0x86,0x31,0x41,0x08,0x61,0x08,0xE7,0x39,0x82,0x10,0x00,0x00,0xE3,0x18,0x86,0x31,0x00,0x00,0x00,0x00,
-	0x65,0x29,0x61,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0xE3,0x18,0x20,0x00,0x04,0x21,0xC3,0x18,0x41,0x08,0x24,0x21,0x41,0x08,0xC3,0x18,0x45,0x29,0x41,0x08,0x24,0x21,0x45,0x29,0x41,0x08,0x65,0x29,0x65,0x29,0x41,0x08,0x65,0x29,0xA6,0x31,0x41,0x08,0x24,0x29,0xE7,0x39,0x82,0x10,0xA2,0x10,0x28,0x42,0xE3,0x18,0x82,0x10,0x08,0x42,0xA6,0x31,0x82,0x10,
-	0x45,0x29,0x69,0x4A,0xA2,0x10,0x82,0x10,0x49,0x4A,0xE7,0x39,0xA2,0x10,0xE3,0x18,0x8A,0x52,0x04,0x21,0xA2,0x10,0x86,0x31,0x69,0x4A,0x82,0x10,0x82,0x10,0xE7,0x39,0x08,0x42,0x61,0x08,0x61,0x08,0xC7,0x39,0x86,0x31,0x20,0x00,0x20,0x00,0x65,0x29,0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0xC3,0x18,0x00,0x00,0x82,0x10,0x20,0x00,0x24,0x21,0x41,0x08,0xA2,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x24,0x21,0x20,0x00,0x20,0x00,0xC3,0x18,0x8A,0x52,0x24,0x21,0x82,0x10,0xA2,0x10,0x08,0x42,0x8A,0x52,0xA2,0x10,0x82,0x10,0xA2,0x10,
-	0xE7,0x39,0x65,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0xC7,0x39,0x82,0x10,0x82,0x10,0xE3,0x18,0xCB,0x5A,0xA6,0x31,0xA2,0x10,0x82,0x10,0x86,0x31,0x8A,0x52,0xA2,0x10,0x20,0x00,0x41,0x08,0x65,0x29,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x61,0x08,0x24,0x29,0x20,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x65,0x29,0x24,0x21,0x20,0x00,0x20,0x00,0xE7,0x39,0x86,0x31,0x61,0x08,
-	0x61,0x08,0x49,0x4A,0x86,0x31,0x82,0x10,0xA2,0x10,0x8A,0x52,0x24,0x21,0xA2,0x10,0x65,0x29,0x8A,0x52,0xA2,0x10,0x82,0x10,0x28,0x42,0x08,0x42,0xA2,0x10,0x04,0x21,0x69,0x4A,0xE3,0x18,0x82,0x10,0xE7,0x39,0xE7,0x39,0x82,0x10,0x45,0x29,0x08,0x42,0x61,0x08,0x82,0x10,0xE7,0x39,0xC3,0x18,0x41,0x08,0x86,0x31,0x04,0x21,0x41,0x08,
-	0x65,0x29,0xE3,0x18,0x41,0x08,0x24,0x21,0xC3,0x18,0x41,0x08,0x04,0x21,0x41,0x08,0x61,0x08,0xC3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x45,0x29,0x41,0x08,0xE3,0x18,0x65,0x29,0x41,0x08,
-	0x04,0x21,0x86,0x31,0x41,0x08,0x04,0x21,0xA6,0x31,0x41,0x08,0xA2,0x10,0xE7,0x39,0x82,0x10,0x61,0x08,0xE7,0x39,0x24,0x21,0x41,0x08,0x86,0x31,0xC7,0x39,0x20,0x00,0x82,0x10,0xE7,0x39,0x82,0x10,0x20,0x00,0x24,0x21,0x86,0x31,0x00,0x00,0x00,0x00,0x65,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x24,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0xA2,0x10,0x20,0x00,0x41,0x08,0xA6,0x31,0x08,0x42,
-	0x82,0x10,0xA2,0x10,0x04,0x21,0xCB,0x5A,0x65,0x29,0xA2,0x10,0x82,0x10,0xA6,0x31,0x69,0x4A,0xA2,0x10,0x20,0x00,0x61,0x08,0x24,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x24,0x21,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0x65,0x29,0x45,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x24,0x21,
-	0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0x04,0x21,0x41,0x08,0x20,0x00,0xC3,0x18,0x8A,0x52,0x65,0x29,0x82,0x10,0xA2,0x10,0xC7,0x39,0xAA,0x52,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x49,0x4A,0x45,0x29,0x20,0x00,0x00,0x00,0xE3,0x18,0x45,0x29,0x00,0x00,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x82,0x10,
-	0x24,0x21,0x00,0x00,0xA2,0x10,0x20,0x00,0x04,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x61,0x08,0x00,0x00,0x61,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0xC7,0x39,0xC3,0x18,0x20,0x00,0x04,0x21,
-	0xE7,0x39,0x41,0x08,0x41,0x08,0xE7,0x39,0x04,0x21,0x41,0x08,0x86,0x31,0xA6,0x31,0x61,0x08,0xE3,0x18,0xC7,0x39,0x61,0x08,0x61,0x08,0x86,0x31,0x82,0x10,0x41,0x08,0x65,0x29,0xA2,0x10,0x41,0x08,0x24,0x21,0x82,0x10,0x41,0x08,0xE3,0x18,0x20,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0x41,0x08,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x24,0x21,0x20,0x00,
-	0x00,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0xA2,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x20,0x00,
-	0x00,0x00,0x41,0x08,0xC7,0x39,0xA2,0x10,0x41,0x08,0x82,0x10,0x49,0x4A,0x86,0x31,0x82,0x10,0xA2,0x10,0xC7,0x39,0x8A,0x52,0xA2,0x10,0xC3,0x18,0xE3,0x18,0x8A,0x52,0x45,0x29,0x41,0x08,0x20,0x00,0x04,0x21,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x04,0x21,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0xC7,0x39,0x82,0x10,0x82,0x10,0xC3,0x18,0x69,0x4A,0x28,0x42,0xC3,0x18,0x82,0x10,0xC3,0x18,0xE7,0x39,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0xE3,0x18,0x41,0x08,
-	0x61,0x08,0xA6,0x31,0x49,0x4A,0xA2,0x10,0xA2,0x10,0xE3,0x18,0xCB,0x5A,0x65,0x29,0xA2,0x10,0x82,0x10,0xE7,0x39,0xE7,0x39,0x41,0x08,0x20,0x00,0xE3,0x18,0xC7,0x39,0x20,0x00,0x00,0x00,0x41,0x08,0x24,0x29,0x61,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x61,0x08,
-	0x04,0x21,0x41,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x45,0x29,0x20,0x00,0x00,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x00,0x00,
-	0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,
-	0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0x20,0x00,0xA6,0x31,0x82,0x10,0x00,0x00,0x41,0x08,0x28,0x42,0xE3,0x18,0x82,0x10,0x82,0x10,0x8A,0x52,0x86,0x31,0x82,0x10,0x82,0x10,0x28,0x42,0x28,0x42,0x82,0x10,0x82,0x10,0x65,0x29,0x8A,0x52,0xA2,0x10,0x41,0x08,0x82,0x10,0xA6,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x29,0x61,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x28,0x42,0xE7,0x39,0x82,0x10,0xC3,0x18,0xC3,0x18,0x69,0x4A,0xE7,0x39,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x49,0x4A,0x49,0x4A,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x28,0x42,0xC7,0x39,0x82,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x65,0x29,0x41,0x08,0x41,0x08,0xC3,0x18,0x8A,0x52,0x04,0x21,0xA2,0x10,0xA2,0x10,0x8A,0x52,0xC7,0x39,
-	0x82,0x10,0x82,0x10,0xE7,0x39,0x28,0x42,0x82,0x10,0x61,0x08,0x45,0x29,0x08,0x42,0x20,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0x00,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,
-	0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x61,0x08,0x04,0x21,0x00,0x00,0x20,0x00,0x24,0x21,0x20,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x61,0x08,
-	0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x86,0x31,0x20,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x20,0x00,0x20,0x00,0xA6,0x31,0xC7,0x39,0x61,0x08,0x61,0x08,0x28,0x42,0xE7,0x39,0x82,0x10,0x82,0x10,0x69,0x4A,0x08,0x42,0x82,0x10,0x82,0x10,0x08,0x42,0x49,0x4A,0x82,0x10,0x82,0x10,0x65,0x29,0x49,0x4A,
-	0x41,0x08,0x20,0x00,0xA2,0x10,0xA6,0x31,0x61,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0x82,0x10,0x82,0x10,0xA2,0x10,0x8A,0x52,0xE7,0x39,0xA2,0x10,0xA2,0x10,0x04,0x21,
-	0x69,0x4A,0x24,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x28,0x42,0xC3,0x18,0xA2,0x10,0x82,0x10,0x49,0x4A,0x49,0x4A,0xA2,0x10,0x61,0x08,0xA2,0x10,0xA6,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,
-	0xE3,0x18,0x00,0x00,0xA2,0x10,0x20,0x00,0x24,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0x82,0x10,0x20,0x00,0x82,0x10,0x69,0x4A,0x04,0x21,0x82,0x10,0x82,0x10,0x8A,0x52,0xA6,0x31,0xA2,0x10,0x82,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0x28,0x42,0xE7,0x39,
-	0x61,0x08,0x82,0x10,0x08,0x42,0x45,0x29,0x20,0x00,0x41,0x08,0xC7,0x39,0x82,0x10,0x00,0x00,0x82,0x10,0x86,0x31,0x00,0x00,0x00,0x00,0xE3,0x18,0xE3,0x18,0x00,0x00,0x20,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x20,0x00,0x00,0x00,0xE3,0x18,0x41,0x08,
-	0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x04,0x21,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0xC3,0x18,
-	0x24,0x29,0x00,0x00,0xA2,0x10,0x65,0x29,0x00,0x00,0x61,0x08,0x86,0x31,0x41,0x08,0x20,0x00,0xA6,0x31,0xE3,0x18,0x41,0x08,0x86,0x31,0xA6,0x31,0x41,0x08,0xA2,0x10,0x28,0x42,0xC3,0x18,0x82,0x10,0xE7,0x39,0x08,0x42,0x82,0x10,0x82,0x10,0x69,0x4A,0x86,0x31,0xA2,0x10,0x04,0x21,0x8A,0x52,0x04,0x21,0xA2,0x10,0x45,0x29,0x8A,0x52,
-	0xA2,0x10,0x82,0x10,0x45,0x29,0x69,0x4A,0x61,0x08,0x41,0x08,0xE3,0x18,0xE7,0x39,0x41,0x08,0x00,0x00,0x61,0x08,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,0x82,0x10,
-	0x00,0x00,0x41,0x08,0xE7,0x39,0x08,0x42,0x82,0x10,0xC3,0x18,0xC3,0x18,0xAA,0x52,0xC7,0x39,0x82,0x10,0x82,0x10,0x04,0x21,0xE7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x24,0x21,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x24,0x21,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0xC7,0x39,0xC3,0x18,0x82,0x10,0xA2,0x10,0x28,0x42,0x69,0x4A,0x82,0x10,0xC3,0x18,0xC3,0x18,0x49,0x4A,0x65,0x29,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x29,0x61,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x61,0x08,
-	0x00,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0xE7,0x39,0xA2,0x10,0x41,0x08,0xA2,0x10,0x69,0x4A,0x04,0x21,0x82,0x10,0x04,0x21,0x8A,0x52,0xE3,0x18,0xA2,0x10,0x65,0x29,0x8A,0x52,0xA2,0x10,0x82,0x10,0xE7,0x39,0x49,0x4A,0x82,0x10,0x82,0x10,0x49,0x4A,0x65,0x29,0x82,0x10,
-	0x24,0x21,0x08,0x42,0x41,0x08,0x41,0x08,0xC7,0x39,0x24,0x21,0x41,0x08,0x24,0x21,0x86,0x31,0x00,0x00,0x82,0x10,0x86,0x31,0x20,0x00,0x20,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0xE3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0x61,0x08,
-	0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,
-	0xA2,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0xE3,0x18,0x20,0x00,0x04,0x21,0xE3,0x18,0x41,0x08,0x45,0x29,0x82,0x10,0x82,0x10,0x65,0x29,0x61,0x08,0xC3,0x18,0x86,0x31,0x61,0x08,0xC3,0x18,0xC7,0x39,0xA2,0x10,0x82,0x10,0xE7,0x39,0x04,0x21,0x82,0x10,0xE7,0x39,0xA6,0x31,0x82,0x10,0x45,0x29,0x28,0x42,0x82,0x10,0x82,0x10,
-	0x28,0x42,0x86,0x31,0x61,0x08,0x04,0x21,0x28,0x42,0x82,0x10,0x41,0x08,0x86,0x31,0xA6,0x31,0x20,0x00,0x20,0x00,0x86,0x31,0xE3,0x18,0x00,0x00,0x20,0x00,0x45,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x82,0x10,0x00,0x00,
-	0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x28,0x42,0xE3,0x18,0x82,0x10,0x82,0x10,0x28,0x42,0x69,0x4A,0xA2,0x10,0xC3,0x18,0xE3,0x18,0x69,0x4A,0x45,0x29,0x41,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0x04,0x21,0x61,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0xA6,0x31,0x82,0x10,0xA2,0x10,0xC3,0x18,0x69,0x4A,0x08,0x42,0xA2,0x10,0x82,0x10,0xC3,0x18,0xE7,0x39,0x04,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x24,0x21,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xC7,0x39,0x49,0x4A,0xA2,0x10,
-	0xC3,0x18,0xA2,0x10,0x8A,0x52,0xC7,0x39,0x82,0x10,0x61,0x08,0x24,0x21,0x28,0x42,0x41,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x00,0x00,0x20,0x00,0xE7,0x39,0x24,0x21,0x41,0x08,0xA2,0x10,0x49,0x4A,0xA2,0x10,0x61,0x08,0xE7,0x39,0xE7,0x39,0x82,0x10,0xA2,0x10,0x28,0x42,0xE3,0x18,0x82,0x10,0xE7,0x39,0x86,0x31,0x61,0x08,0x45,0x29,0xA6,0x31,0x61,0x08,0xE3,0x18,0x86,0x31,0x61,0x08,
-	0xA2,0x10,0x65,0x29,0x61,0x08,0x82,0x10,0x24,0x21,0x41,0x08,0xA2,0x10,0xE3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x04,0x21,0x20,0x00,0x00,0x00,
-	0x04,0x21,0x20,0x00,0x00,0x00,0x24,0x29,0x41,0x08,0x00,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0xA2,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0x65,0x29,0x20,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x20,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,
-	0xC3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xC7,0x39,0x82,0x10,0x82,0x10,0xC3,0x18,0xCB,0x5A,0x45,0x29,0xC3,0x18,0x82,0x10,0x08,0x42,0x69,0x4A,0xA2,0x10,0x82,0x10,0xC3,0x18,0xE7,0x39,
-	0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x00,0x00,0xA2,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x28,0x42,0x86,0x31,0x82,0x10,0xC3,0x18,0xE3,0x18,0x8A,0x52,0xE7,0x39,0xA2,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0xC3,0x18,0x28,0x42,0x69,0x4A,0xA2,0x10,0xA2,0x10,
-	0x82,0x10,0xC7,0x39,0xE7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0xC7,0x39,0xA2,0x10,0x82,0x10,0xA2,0x10,0xAA,0x52,0xA6,0x31,0x82,0x10,0xA2,0x10,0x86,0x31,0x8A,0x52,0x82,0x10,0x82,0x10,0xA2,0x10,0xE7,0x39,
-	0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,
-	0x24,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x24,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0x41,0x08,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x61,0x08,0xE3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0xE7,0x39,0x82,0x10,0x82,0x10,0x24,0x29,0x8A,0x52,0xC3,0x18,
-	0xC3,0x18,0xC3,0x18,0xAA,0x52,0x86,0x31,0xA2,0x10,0x82,0x10,0x86,0x31,0x08,0x42,0x41,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x8A,0x52,0x65,0x29,0xA2,0x10,0xA2,0x10,0x65,0x29,
-	0x8A,0x52,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x65,0x29,0x8A,0x52,0x04,0x21,0xC3,0x18,0x82,0x10,0xA6,0x31,0x69,0x4A,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,
-	0x24,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x49,0x4A,0x45,0x29,0x82,0x10,0x82,0x10,0xE7,0x39,0x69,0x4A,0x82,0x10,0xC3,0x18,0x24,0x21,0xAA,0x52,0xC3,0x18,0x82,0x10,0x82,0x10,0x08,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0x24,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0xE3,0x18,
-	0xA2,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0xE3,0x18,0x00,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0xC3,0x18,
-	0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,0x20,0x00,0x20,0x00,0xE3,0x18,0x61,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x86,0x31,0x41,0x08,0x00,0x00,0x82,0x10,0xE7,0x39,0x82,0x10,
-	0x41,0x08,0x04,0x21,0x49,0x4A,0xA2,0x10,0xA2,0x10,0x24,0x21,0xAA,0x52,0xE3,0x18,0xC3,0x18,0xE3,0x18,0xAA,0x52,0x24,0x21,0x82,0x10,0x82,0x10,0xE7,0x39,0x65,0x29,0x20,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x82,0x10,0x65,0x29,0xC3,0x18,0x41,0x08,0x82,0x10,0x86,0x31,0xAA,0x52,0x04,0x21,0xA2,0x10,0x82,0x10,0xA6,0x31,0x49,0x4A,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0xC7,0x39,0xE3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x04,0x21,
-	0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0x69,0x4A,0x65,0x29,0xA2,0x10,0xA2,0x10,0x65,0x29,0xCB,0x5A,0x04,0x21,0x61,0x08,0x20,0x00,0xE3,0x18,0x45,0x29,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x82,0x10,
-	0x00,0x00,0x41,0x08,0xE7,0x39,0xA6,0x31,0x82,0x10,0x82,0x10,0xA6,0x31,0x8A,0x52,0xA2,0x10,0xC3,0x18,0x24,0x29,0xAA,0x52,0xC3,0x18,0x82,0x10,0x04,0x21,0x69,0x4A,0x82,0x10,0x41,0x08,0xA2,0x10,0xE7,0x39,0x41,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x20,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,
-	0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0x24,0x21,0x20,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x82,0x10,0x86,0x31,0x20,0x00,0x00,0x00,0xA6,0x31,
-	0x24,0x21,0x41,0x08,0xC3,0x18,0x28,0x42,0x82,0x10,0x61,0x08,0xC7,0x39,0x08,0x42,0x82,0x10,0x82,0x10,0x49,0x4A,0xE7,0x39,0xA2,0x10,0x82,0x10,0x69,0x4A,0xA6,0x31,0xA2,0x10,0xA2,0x10,0x49,0x4A,0x86,0x31,0x61,0x08,0x82,0x10,0xC7,0x39,0x45,0x29,0x00,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0xC3,0x18,0x00,0x00,0xA2,0x10,0x41,0x08,0x45,0x29,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x28,0x42,0xE3,0x18,0x82,0x10,0xA2,0x10,0xE7,0x39,0xAA,0x52,0xC3,0x18,0xA2,0x10,0x82,0x10,0xA6,0x31,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0xC7,0x39,0x82,0x10,0xA2,0x10,0xC3,0x18,0x28,0x42,0xE7,0x39,0xC3,0x18,0xA2,0x10,0xC3,0x18,0xE7,0x39,0x04,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x04,0x21,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0xE7,0x39,0x86,0x31,0x61,0x08,0xA2,0x10,0x04,0x21,0xCB,0x5A,0x86,0x31,
-	0xA2,0x10,0x61,0x08,0x24,0x21,0x28,0x42,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x04,0x21,0x20,0x00,0xA2,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0xA6,0x31,0x86,0x31,0x41,0x08,0x61,0x08,0xE7,0x39,0x08,0x42,
-	0x82,0x10,0x82,0x10,0x08,0x42,0x49,0x4A,0x82,0x10,0x82,0x10,0x28,0x42,0x08,0x42,0x82,0x10,0xA2,0x10,0x49,0x4A,0x65,0x29,0x82,0x10,0xE3,0x18,0x08,0x42,0x61,0x08,0x41,0x08,0x65,0x29,0x65,0x29,0x00,0x00,0x41,0x08,0x86,0x31,0x20,0x00,0x00,0x00,0x24,0x21,0xA2,0x10,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0xE3,0x18,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x61,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x04,0x21,0x04,0x21,0x41,0x08,0x45,0x29,0xE3,0x18,0x41,0x08,0x86,0x31,
-	0x04,0x21,0x41,0x08,0xA6,0x31,0x24,0x21,0x41,0x08,0xA6,0x31,0x86,0x31,0x82,0x10,0x65,0x29,0xE7,0x39,0x82,0x10,0xA2,0x10,0x28,0x42,0x04,0x21,0x82,0x10,0xC7,0x39,0x28,0x42,0x82,0x10,0xA2,0x10,0x49,0x4A,0x65,0x29,0x82,0x10,0x04,0x21,0x69,0x4A,0x82,0x10,0x41,0x08,0x24,0x21,0xE7,0x39,0x20,0x00,0x00,0x00,0xE3,0x18,0x65,0x29,
-	0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x20,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x24,0x21,0x04,0x21,0x20,0x00,0x41,0x08,0x04,0x21,0x8A,0x52,0x04,0x21,0xC3,0x18,0x82,0x10,0x08,0x42,0x69,0x4A,
-	0x82,0x10,0x61,0x08,0x82,0x10,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x29,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0xE7,0x39,0x65,0x29,0x82,0x10,0xC3,0x18,0x04,0x21,0x8A,0x52,0xC7,0x39,0xA2,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xE3,0x18,0x08,0x42,0x69,0x4A,0xC3,0x18,0xA2,0x10,
-	0x82,0x10,0x86,0x31,0xC7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x24,0x29,0x61,0x08,0x61,0x08,0xA2,0x10,0xAA,0x52,0xA6,0x31,0x82,0x10,0xA2,0x10,0x45,0x29,0xAA,0x52,0xC3,0x18,0x41,0x08,0x41,0x08,0x24,0x21,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0xC3,0x18,0x00,0x00,0xA2,0x10,0x41,0x08,0x24,0x29,0x41,0x08,0xA2,0x10,0x00,0x00,0xE3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x24,0x21,0x61,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x08,0x42,0xE3,0x18,0x41,0x08,0xE3,0x18,0x49,0x4A,0xA2,0x10,0x82,0x10,0xC7,0x39,0x08,0x42,0x82,0x10,
-	0x82,0x10,0x28,0x42,0x65,0x29,0x82,0x10,0x65,0x29,0xE7,0x39,0x82,0x10,0xA2,0x10,0xE7,0x39,0xE3,0x18,0x61,0x08,0x86,0x31,0x45,0x29,0x41,0x08,0x24,0x21,0x24,0x29,0x41,0x08,0x04,0x21,0x04,0x21,0x20,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x04,0x21,0x04,0x21,0x00,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0xE3,0x18,0x65,0x29,0x00,0x00,0x61,0x08,0xA6,0x31,0x41,0x08,0x00,0x00,0x45,0x29,0x04,0x21,0x00,0x00,0x61,0x08,
-	0x86,0x31,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0x41,0x08,0xA2,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x61,0x08,0x00,0x00,
-	0x20,0x00,0xE7,0x39,0xA6,0x31,0x82,0x10,0xA2,0x10,0x45,0x29,0xCB,0x5A,0x04,0x21,0xC3,0x18,0x82,0x10,0xE7,0x39,0x08,0x42,0x61,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x24,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x08,0x42,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xC7,0x39,
-	0x8A,0x52,0x24,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x65,0x29,0x8A,0x52,0x65,0x29,0xA2,0x10,0x82,0x10,0x24,0x21,0x28,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x49,0x4A,0x86,0x31,0x82,0x10,0xA2,0x10,0x65,0x29,0xCB,0x5A,0xE3,0x18,0xA2,0x10,0x82,0x10,0xE7,0x39,0x86,0x31,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x29,0x20,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0xA2,0x10,0x61,0x08,0x24,0x21,0x20,0x00,0x82,0x10,
-	0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x65,0x29,0x20,0x00,0x00,0x00,0x24,0x29,0x04,0x21,0x00,0x00,0x82,0x10,0x65,0x29,0x00,0x00,0x20,0x00,0x65,0x29,0x82,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,
-	0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x41,0x08,
-	0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x20,0x00,0x00,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,
-	0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x28,0x42,0x45,0x29,0x82,0x10,0x82,0x10,0x08,0x42,0x49,0x4A,0x82,0x10,0xA2,0x10,0x24,0x21,0xCB,0x5A,0xE3,0x18,0x61,0x08,0x61,0x08,0x45,0x29,0x24,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x20,0x00,
-	0x41,0x08,0xE3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xE7,0x39,0xE7,0x39,0x82,0x10,0xC3,0x18,0x82,0x10,0x28,0x42,0x28,0x42,0xC3,0x18,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0xE3,0x18,0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x28,0x42,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x04,0x21,
-	0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x69,0x4A,0xE7,0x39,0xA2,0x10,0xC3,0x18,0xC3,0x18,0x28,0x42,0x86,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0x24,0x21,0x41,0x08,0x61,0x08,0x65,0x29,0x8A,0x52,
-	0xE3,0x18,0xC3,0x18,0xA2,0x10,0x8A,0x52,0xA6,0x31,0x82,0x10,0x61,0x08,0x86,0x31,0xE7,0x39,0x20,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x00,0x00,0x00,0x00,0x61,0x08,0x04,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x82,0x10,0x20,0x00,
-	0xC3,0x18,0xA2,0x10,0x20,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x86,0x31,0x04,0x21,0x20,0x00,0x41,0x08,0x08,0x42,0x86,0x31,0x61,0x08,0x82,0x10,0x28,0x42,0x28,0x42,0x82,0x10,0xA2,0x10,0xA6,0x31,0xAA,0x52,0x82,0x10,0x82,0x10,0xC3,0x18,0x28,0x42,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x45,0x29,0x41,0x08,0xA2,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x8A,0x52,0xA6,0x31,0xA2,0x10,0xC3,0x18,0x04,0x21,0x69,0x4A,0x65,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0xE7,0x39,0xA2,0x10,0xC3,0x18,0xA2,0x10,0xE7,0x39,0xA6,0x31,0xA2,0x10,0xA2,0x10,0xE3,0x18,0xE7,0x39,0x24,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xE7,0x39,0x49,0x4A,0xC3,0x18,0xC3,0x18,0x82,0x10,0x08,0x42,0x49,0x4A,
-	0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x45,0x29,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0xA2,0x10,0x82,0x10,0xC3,0x18,0xCB,0x5A,0x45,0x29,0xC3,0x18,0xA2,0x10,0x69,0x4A,0xC7,0x39,0x82,0x10,0x61,0x08,0xE7,0x39,
-	0xC7,0x39,0x20,0x00,0x20,0x00,0x65,0x29,0x24,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x82,0x10,0xA2,0x10,0x00,0x00,0xC3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x20,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x24,0x29,0x82,0x10,0x00,0x00,0xA2,0x10,0x65,0x29,0x00,0x00,0x20,0x00,0xA6,0x31,0x24,0x21,0x41,0x08,0x82,0x10,0x28,0x42,0xC3,0x18,0x82,0x10,0x24,0x29,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x86,0x31,0x8A,0x52,0xA2,0x10,
-	0xA2,0x10,0x65,0x29,0x8A,0x52,0x82,0x10,0x82,0x10,0xE3,0x18,0x08,0x42,0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x24,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x29,0xE3,0x18,0x20,0x00,0x61,0x08,0x04,0x21,0xCB,0x5A,0x65,0x29,
-	0xC3,0x18,0xA2,0x10,0x65,0x29,0x69,0x4A,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xC7,0x39,0x24,0x21,0x82,0x10,0xC3,0x18,0x04,0x21,0x69,0x4A,0xA6,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0x08,0x42,0x69,0x4A,0xC3,0x18,0xC3,0x18,
-	0x82,0x10,0x65,0x29,0xA6,0x31,0xA2,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x69,0x4A,0x04,0x21,0xA2,0x10,0xA2,0x10,0xC7,0x39,0xAA,0x52,0xA2,0x10,0x41,0x08,0x41,0x08,0x24,0x21,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x24,0x21,0x00,0x00,0xA2,0x10,
-	0x00,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x08,0x42,0xA2,0x10,0x82,0x10,0xC3,0x18,0x8A,0x52,0x04,0x21,0xA2,0x10,0x04,0x21,0xAA,0x52,0x04,0x21,0xC3,0x18,0x04,0x21,0x8A,0x52,0xC3,0x18,0x82,0x10,0x24,0x21,0x28,0x42,0x41,0x08,0x20,0x00,0x65,0x29,0x65,0x29,
-	0x00,0x00,0x20,0x00,0x86,0x31,0x41,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0xA2,0x10,0x24,0x21,0x41,0x08,0x04,0x21,0x45,0x29,0x41,0x08,0x04,0x21,0x65,0x29,0x41,0x08,0xC3,0x18,0xA6,0x31,0x82,0x10,0x82,0x10,0xE7,0x39,0x04,0x21,0x61,0x08,0xA6,0x31,0xC7,0x39,0x82,0x10,0xC3,0x18,0x49,0x4A,
-	0x04,0x21,0x82,0x10,0x86,0x31,0x28,0x42,0x82,0x10,0x82,0x10,0x08,0x42,0xC7,0x39,0x82,0x10,0x82,0x10,0x08,0x42,0x24,0x21,0x20,0x00,0x41,0x08,0xA6,0x31,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x20,0x00,0x61,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x61,0x08,0x00,0x00,
-	0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0x08,0x42,0x65,0x29,0x61,0x08,0xA2,0x10,0x45,0x29,0xCB,0x5A,0x04,0x21,0xA2,0x10,0x82,0x10,0x65,0x29,0xE7,0x39,0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x86,0x31,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x08,0x42,
-	0x8A,0x52,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0xE3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x45,0x29,0x8A,0x52,0xA6,0x31,0xA2,0x10,0x82,0x10,0xC3,0x18,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0x08,0x42,0x24,0x21,0x82,0x10,0xA2,0x10,0x86,0x31,0xCB,0x5A,0xE3,0x18,0xA2,0x10,0x61,0x08,0x86,0x31,0xA6,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x61,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0x04,0x21,0x65,0x29,0x20,0x00,0x20,0x00,0xA6,0x31,0xE7,0x39,0x61,0x08,0x61,0x08,0x28,0x42,0xC7,0x39,0x82,0x10,0xA2,0x10,0x49,0x4A,0x24,0x29,0x82,0x10,0x65,0x29,0x08,0x42,0x82,0x10,0x61,0x08,0xE7,0x39,0x45,0x29,0x61,0x08,0x24,0x29,0x86,0x31,0x41,0x08,0xA2,0x10,0x65,0x29,0x61,0x08,0x41,0x08,0x24,0x29,
-	0x82,0x10,0x41,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x04,0x21,0x20,0x00,0x41,0x08,0x24,0x29,
-	0x41,0x08,0x41,0x08,0x65,0x29,0x61,0x08,0x41,0x08,0x86,0x31,0xC3,0x18,0x20,0x00,0x65,0x29,0x65,0x29,0x20,0x00,0xC3,0x18,0xC7,0x39,0x41,0x08,0x00,0x00,0x65,0x29,0x04,0x21,0x00,0x00,0x41,0x08,0x86,0x31,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,
-	0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x86,0x31,0x61,0x08,0x41,0x08,0x82,0x10,0x8A,0x52,0xA6,0x31,0x82,0x10,0xA2,0x10,0x65,0x29,0xCB,0x5A,0xE3,0x18,0x82,0x10,0x41,0x08,0x24,0x21,0x24,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,
-	0x04,0x21,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x24,0x21,0x41,0x08,0xA2,0x10,0xE3,0x18,0x8A,0x52,0x08,0x42,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x24,0x21,0x69,0x4A,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x04,0x21,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x49,0x4A,0x69,0x4A,0xC3,0x18,0xA2,0x10,0x61,0x08,0x45,0x29,0x65,0x29,0x61,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0xC3,0x18,0xE3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x65,0x29,0x04,0x21,0x41,0x08,0x61,0x08,0x24,0x21,0xCB,0x5A,0x24,0x21,0xC3,0x18,0x82,0x10,0xE7,0x39,
-	0x28,0x42,0x61,0x08,0x41,0x08,0x82,0x10,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x61,0x08,0xE3,0x18,0x41,0x08,0x82,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x00,0x00,
-	0x00,0x00,0x45,0x29,0x04,0x21,0x00,0x00,0x61,0x08,0xA6,0x31,0x61,0x08,0x20,0x00,0x65,0x29,0x04,0x21,0x20,0x00,0xE3,0x18,0x24,0x21,0x20,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x41,0x08,0xE3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,
-	0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0x61,0x08,0x41,0x08,0x04,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x41,0x08,0x20,0x00,0xA2,0x10,0x69,0x4A,0xE3,0x18,0xA2,0x10,0x82,0x10,0x8A,0x52,0xE7,0x39,0x82,0x10,
-	0xA2,0x10,0x45,0x29,0x69,0x4A,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x45,0x29,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA6,0x31,0xCB,0x5A,0x24,0x21,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x08,0x42,0xC3,0x18,0xC3,0x18,0x82,0x10,0x65,0x29,0x45,0x29,0x82,0x10,0xA2,0x10,0x04,0x21,0x28,0x42,0x24,0x29,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x86,0x31,0xCB,0x5A,0x45,0x29,0xA2,0x10,0x82,0x10,0x04,0x21,0xC7,0x39,
-	0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x69,0x4A,0x04,0x21,0xA2,0x10,0x82,0x10,0x69,0x4A,0x28,0x42,0x82,0x10,0x82,0x10,0x24,0x21,0x69,0x4A,0x61,0x08,0x20,0x00,0x41,0x08,0x65,0x29,0x61,0x08,0x00,0x00,0x41,0x08,
-	0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x61,0x08,0x04,0x21,0x41,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x20,0x00,0xE3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,
-	0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,
-	0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0xC7,0x39,0x82,0x10,0x20,0x00,
-	0xA2,0x10,0x69,0x4A,0x04,0x21,0x82,0x10,0xA2,0x10,0xAA,0x52,0x86,0x31,0xA2,0x10,0x82,0x10,0x08,0x42,0x28,0x42,0x61,0x08,0x41,0x08,0xC3,0x18,0xC7,0x39,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x45,0x29,0xE7,0x39,0xA2,0x10,
-	0xC3,0x18,0x82,0x10,0x28,0x42,0x69,0x4A,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0xC3,0x18,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x04,0x21,0x82,0x10,0xC3,0x18,0x04,0x21,0x49,0x4A,0x86,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x28,0x42,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0x45,0x29,0x86,0x31,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x20,0x00,0x41,0x08,0xE3,0x18,0xAA,0x52,0xE7,0x39,0x82,0x10,0xA2,0x10,0xC3,0x18,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0x00,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,
-	0x20,0x00,0x00,0x00,0x82,0x10,0xA6,0x31,0xA2,0x10,0x41,0x08,0x82,0x10,0x69,0x4A,0xA6,0x31,0x82,0x10,0xA2,0x10,0xE7,0x39,0x69,0x4A,0x82,0x10,0x82,0x10,0x45,0x29,0x49,0x4A,0x61,0x08,0x20,0x00,0xC3,0x18,0xA6,0x31,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x20,0x00,0xC3,0x18,
-	0xA2,0x10,0x00,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x82,0x10,
-	0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x20,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0xA2,0x10,
-	0x00,0x00,0x61,0x08,0xA6,0x31,0x41,0x08,0x20,0x00,0x65,0x29,0xC7,0x39,0x61,0x08,0x61,0x08,0x08,0x42,0xE7,0x39,0x82,0x10,0x82,0x10,0x49,0x4A,0xE7,0x39,0xA2,0x10,0x82,0x10,0x08,0x42,0x08,0x42,0x61,0x08,0x41,0x08,0x24,0x21,0xE7,0x39,0x20,0x00,0x00,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,
-	0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0x08,0x42,0xC7,0x39,0x82,0x10,0xC3,0x18,0xC3,0x18,0x8A,0x52,0xC7,0x39,0x82,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x20,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x24,0x21,0x61,0x08,0x82,0x10,0xA2,0x10,0x28,0x42,
-	0x69,0x4A,0x04,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0xE3,0x18,0xC3,0x18,0xA2,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x8A,0x52,0xE7,0x39,0xA2,0x10,0x82,0x10,0x82,0x10,0x24,0x29,0xC3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0xC3,0x18,0x41,0x08,
-	0x20,0x00,0x82,0x10,0x28,0x42,0x49,0x4A,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x08,0x42,0xA6,0x31,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0xA2,0x10,0xC3,0x18,0x61,0x08,0x61,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x08,0x42,0x04,0x21,0x41,0x08,0x82,0x10,0x69,0x4A,
-	0xA6,0x31,0x82,0x10,0x82,0x10,0x49,0x4A,0xE7,0x39,0x82,0x10,0x82,0x10,0x28,0x42,0xA6,0x31,0x61,0x08,0x82,0x10,0xE7,0x39,0x04,0x21,0x20,0x00,0x82,0x10,0xA6,0x31,0x20,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0xC3,0x18,0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0x04,0x21,0xE3,0x18,0x20,0x00,0x24,0x21,0xE3,0x18,
-	0x41,0x08,0x45,0x29,0x04,0x21,0x41,0x08,0x65,0x29,0x45,0x29,0x41,0x08,0x24,0x21,0xA6,0x31,0x61,0x08,0x82,0x10,0xE7,0x39,0x04,0x21,0x82,0x10,0xA6,0x31,0xE7,0x39,0x82,0x10,0x82,0x10,0x28,0x42,0x86,0x31,0x82,0x10,0xE3,0x18,0x69,0x4A,0xE3,0x18,0x61,0x08,0x04,0x21,0x49,0x4A,0x61,0x08,0x20,0x00,0xC3,0x18,0xC7,0x39,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x41,0x08,0x20,0x00,0xA2,0x10,0x8A,0x52,0xC7,0x39,0xA2,0x10,0xC3,0x18,0x24,0x21,0x8A,0x52,0x24,0x21,0x20,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0xE3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0x04,0x21,0xA2,0x10,0x41,0x08,0x82,0x10,0x24,0x21,0xAA,0x52,0xC7,0x39,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x21,0x69,0x4A,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x04,0x21,
-	0xA2,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x28,0x42,0x8A,0x52,0xE3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0x04,0x21,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x86,0x31,0x69,0x4A,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x08,0x42,0x28,0x42,0x82,0x10,0x20,0x00,0x61,0x08,
-	0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xC7,0x39,0x82,0x10,0x20,0x00,0xA2,0x10,0x28,0x42,0xC3,0x18,0x82,0x10,0x45,0x29,0x49,0x4A,0xA2,0x10,0x82,0x10,0xC7,0x39,0xE7,0x39,
-	0x82,0x10,0x82,0x10,0x08,0x42,0x24,0x21,0x61,0x08,0x24,0x21,0xA6,0x31,0x41,0x08,0x82,0x10,0x65,0x29,0xA2,0x10,0x41,0x08,0x24,0x21,0xE3,0x18,0x20,0x00,0xE3,0x18,0xE3,0x18,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x00,0x00,0xA2,0x10,0x04,0x21,0x20,0x00,0xC3,0x18,0x24,0x29,0x20,0x00,0xA2,0x10,0x65,0x29,0x20,0x00,0x41,0x08,0xA6,0x31,0x82,0x10,0x20,0x00,0x65,0x29,0x65,0x29,0x20,0x00,0x82,0x10,0xA6,0x31,
-	0x41,0x08,0x00,0x00,0xE3,0x18,0x45,0x29,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x82,0x10,0xA2,0x10,
-	0xA2,0x10,0xAA,0x52,0xC7,0x39,0x82,0x10,0xA2,0x10,0x45,0x29,0x49,0x4A,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0xE3,0x18,0x00,0x00,0xA2,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0x28,0x42,0x8A,0x52,0xE3,0x18,0x82,0x10,0x20,0x00,0xC3,0x18,0xE3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x00,0x00,0xA2,0x10,0xA6,0x31,0x49,0x4A,0x04,0x21,0xA2,0x10,0x61,0x08,0xE3,0x18,0xC3,0x18,0x82,0x10,0xC3,0x18,0x45,0x29,0x69,0x4A,0x65,0x29,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0x04,0x21,0xC3,0x18,0x41,0x08,0x82,0x10,0x24,0x21,0xAA,0x52,0xC7,0x39,0xA2,0x10,0x41,0x08,0x82,0x10,0x04,0x21,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0x49,0x4A,0x04,0x21,0xA2,0x10,0x82,0x10,0x28,0x42,0x69,0x4A,0x82,0x10,0x82,0x10,0xA2,0x10,0x08,0x42,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,0x41,0x08,
-	0x82,0x10,0x41,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x65,0x29,0x82,0x10,0x00,0x00,0x82,0x10,0x86,0x31,0x20,0x00,0x20,0x00,0x65,0x29,0xE3,0x18,0x20,0x00,0xC3,0x18,0x45,0x29,0x20,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x20,0x00,0x04,0x21,
-	0x61,0x08,0x00,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,
-	0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0x45,0x29,0x41,0x08,0x41,0x08,0x45,0x29,0x8A,0x52,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x8A,0x52,0xC7,0x39,0x82,0x10,0x41,0x08,0x04,0x21,0xA6,0x31,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x04,0x21,0xA2,0x10,0x20,0x00,
-	0x61,0x08,0xC3,0x18,0xAA,0x52,0xE7,0x39,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x45,0x29,0xC3,0x18,0x61,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xA6,0x31,0x24,0x21,0xA2,0x10,0xC3,0x18,0xE3,0x18,0x08,0x42,0x65,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x08,0x42,0xA2,0x10,0xC3,0x18,
-	0x82,0x10,0x65,0x29,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xE3,0x18,0x45,0x29,0x82,0x10,0xA2,0x10,0xC3,0x18,0x49,0x4A,0x8A,0x52,0xA2,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0xC7,0x39,
-	0xC3,0x18,0x61,0x08,0x82,0x10,0x28,0x42,0x49,0x4A,0xA2,0x10,0xA2,0x10,0x04,0x21,0xAA,0x52,0xE3,0x18,0x41,0x08,0x41,0x08,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,
-	0x41,0x08,0xC3,0x18,0x61,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x41,0x08,0x41,0x08,0x24,0x29,0x69,0x4A,0xA2,0x10,0xA2,0x10,0x04,0x21,0xCB,0x5A,0x24,0x21,0xA2,0x10,0x82,0x10,0x08,0x42,0x86,0x31,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x82,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0x45,0x29,0xA2,0x10,0x41,0x08,0x82,0x10,0x86,0x31,0xCB,0x5A,0x24,0x29,0xA2,0x10,0x41,0x08,0x04,0x21,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xC3,0x18,0xE3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0x28,0x42,
-	0x69,0x4A,0x24,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0x86,0x31,0x86,0x31,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x29,0x8A,0x52,0xE7,0x39,0xA2,0x10,0x82,0x10,0x82,0x10,0x04,0x21,0xA2,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x86,0x31,0xE3,0x18,
-	0x82,0x10,0xA2,0x10,0x86,0x31,0xCB,0x5A,0x24,0x21,0x82,0x10,0x20,0x00,0xC3,0x18,0x45,0x29,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x61,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x08,0x42,0xC7,0x39,0x82,0x10,0x82,0x10,0x86,0x31,0xAA,0x52,0xC3,0x18,0xA2,0x10,0xE3,0x18,
-	0x8A,0x52,0xC3,0x18,0x41,0x08,0x82,0x10,0xC7,0x39,0x82,0x10,0x00,0x00,0x20,0x00,0x24,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x61,0x08,0x20,0x00,0xC3,0x18,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,
-	0x20,0x00,0xC3,0x18,0x00,0x00,0x20,0x00,0xE3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x20,0x00,0x65,0x29,0x41,0x08,0x00,0x00,0x24,0x21,0x65,0x29,0x20,0x00,0x41,0x08,0x08,0x42,0x45,0x29,0x61,0x08,0x82,0x10,0x69,0x4A,0x45,0x29,0xA2,0x10,0xC3,0x18,0x8A,0x52,0x65,0x29,0xA2,0x10,
-	0x82,0x10,0x28,0x42,0x86,0x31,0x41,0x08,0x20,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0xA2,0x10,0x82,0x10,0xA2,0x10,0x28,0x42,0x8A,0x52,0xA2,0x10,0x82,0x10,0x82,0x10,0x45,0x29,0x24,0x21,
-	0x61,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x65,0x29,0xAA,0x52,0xA6,0x31,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x49,0x4A,0x28,0x42,0xE3,0x18,0x61,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x04,0x21,
-	0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x08,0x42,0xAA,0x52,0x04,0x21,0x61,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x61,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x24,0x21,0x41,0x08,0xA2,0x10,0xE3,0x18,0xCB,0x5A,0xC7,0x39,0xA2,0x10,0x41,0x08,0xC3,0x18,0xA6,0x31,0x82,0x10,0x00,0x00,0x20,0x00,
-	0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0xA2,0x10,0x00,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0xE3,0x18,0x20,0x00,0x41,0x08,0xE7,0x39,0xE7,0x39,0x82,0x10,0x82,0x10,0xC7,0x39,0x69,0x4A,0x82,0x10,0x82,0x10,0xA6,0x31,0x28,0x42,0x82,0x10,0x41,0x08,0x86,0x31,0xA6,0x31,0x41,0x08,0x20,0x00,0x86,0x31,
-	0xA2,0x10,0x00,0x00,0x82,0x10,0x24,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x24,0x21,0x82,0x10,0x41,0x08,0x45,0x29,0xA2,0x10,0x41,0x08,0x65,0x29,0xE3,0x18,0x41,0x08,0x65,0x29,0x65,0x29,0x41,0x08,0xE3,0x18,0xC7,0x39,0x82,0x10,0x61,0x08,0xE7,0x39,0x86,0x31,
-	0x82,0x10,0xE3,0x18,0x28,0x42,0xC3,0x18,0x82,0x10,0x45,0x29,0x28,0x42,0x82,0x10,0x41,0x08,0x45,0x29,0xE7,0x39,0x41,0x08,0x00,0x00,0xE3,0x18,0x45,0x29,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x61,0x08,0x24,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,
-	0x24,0x21,0x08,0x42,0xA2,0x10,0xA2,0x10,0x82,0x10,0x69,0x4A,0x49,0x4A,0x82,0x10,0x82,0x10,0xA2,0x10,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x49,0x4A,0x69,0x4A,0xC3,0x18,0xA2,0x10,0x41,0x08,0x04,0x21,0xE3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0x8A,0x52,0x65,0x29,0xA2,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0xA6,0x31,0x8A,0x52,0x86,0x31,0x82,0x10,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0x04,0x21,0xE3,0x18,0x41,0x08,0xA2,0x10,0xE3,0x18,0x8A,0x52,0x08,0x42,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,
-	0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x45,0x29,0x82,0x10,0x82,0x10,0xA2,0x10,0x8A,0x52,0x08,0x42,0xA2,0x10,0xA2,0x10,0xE3,0x18,0x28,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x29,0x41,0x08,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0xA2,0x10,0x00,0x00,0x41,0x08,0x08,0x42,0x04,0x21,0x41,0x08,0xA2,0x10,0x28,0x42,0x04,0x21,0x82,0x10,0x04,0x21,0x08,0x42,0x82,0x10,0x61,0x08,0x86,0x31,0x86,0x31,0x41,0x08,0xA2,0x10,0x86,0x31,0x82,0x10,0x41,0x08,0x24,0x21,0xE3,0x18,0x41,0x08,0xE3,0x18,0x04,0x21,0x20,0x00,0xA2,0x10,
-	0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,
-	0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0xC3,0x18,0x24,0x21,0x20,0x00,0x82,0x10,0x65,0x29,0x20,0x00,0x00,0x00,0x65,0x29,0xC3,0x18,0x00,0x00,0xC3,0x18,0x86,0x31,0x00,0x00,0x00,0x00,0x04,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x61,0x08,0x24,0x21,
-	0x41,0x08,0x82,0x10,0x00,0x00,0x04,0x21,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x45,0x29,0xA2,0x10,0x00,0x00,0x41,0x08,0x86,0x31,0x69,0x4A,0xC3,0x18,0xE3,0x18,0xA2,0x10,0x69,0x4A,0xE7,0x39,0x82,0x10,0x20,0x00,0x82,0x10,0x24,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x20,0x00,0x24,0x21,0x8A,0x52,0x86,0x31,0xA2,0x10,0xA2,0x10,0xE3,0x18,0xA6,0x31,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xE7,0x39,0x65,0x29,0xA2,0x10,0xC3,0x18,0xA2,0x10,0xA6,0x31,0x04,0x21,0xC3,0x18,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0x24,0x21,0x86,0x31,0x82,0x10,0xC3,0x18,
-	0x82,0x10,0x86,0x31,0xA6,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0xA6,0x31,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xC7,0x39,0x8A,0x52,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x82,0x10,0x49,0x4A,
-	0x28,0x42,0x82,0x10,0xC3,0x18,0x04,0x21,0x8A,0x52,0x04,0x21,0x20,0x00,0x20,0x00,0xE3,0x18,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0x61,0x08,0x61,0x08,0x00,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0x04,0x21,0xA2,0x10,
-	0x00,0x00,0x20,0x00,0x65,0x29,0x61,0x08,0x00,0x00,0xE3,0x18,0x04,0x21,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x24,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0xE7,0x39,0x86,0x31,0x41,0x08,0xA2,0x10,0x86,0x31,0xCB,0x5A,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x28,0x42,0x86,0x31,0x20,0x00,
-	0x00,0x00,0x61,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xE7,0x39,0x49,0x4A,0xC3,0x18,0xC3,0x18,0x82,0x10,0xA6,0x31,0xE7,0x39,0xA2,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0xE3,0x18,0xC3,0x18,0xE3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0x08,0x42,
-	0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x28,0x42,0x08,0x42,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x24,0x29,0x69,0x4A,0xC7,0x39,0xC3,0x18,0x82,0x10,0x82,0x10,0x04,0x21,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x08,0x42,0x65,0x29,
-	0x82,0x10,0xC3,0x18,0x04,0x21,0x69,0x4A,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0x61,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0xE7,0x39,0xE7,0x39,0x82,0x10,0xA2,0x10,0x24,0x21,0xCB,0x5A,0x24,0x21,0xA2,0x10,0x61,0x08,0xE7,0x39,0x86,0x31,0x00,0x00,0x00,0x00,
-	0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x61,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x00,0x00,0x20,0x00,0x86,0x31,0xA6,0x31,0x41,0x08,0x82,0x10,
-	0xA6,0x31,0x69,0x4A,0x82,0x10,0xC3,0x18,0x24,0x21,0xAA,0x52,0xE3,0x18,0x61,0x08,0x82,0x10,0x86,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x69,0x4A,0xC7,0x39,0x82,0x10,0xC3,0x18,0xE3,0x18,0x28,0x42,0x65,0x29,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0xAA,0x52,0xA6,0x31,0xA2,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0xE3,0x18,0xA2,0x10,0xE3,0x18,0x41,0x08,0xA2,0x10,0xA2,0x10,0xC7,0x39,0x86,0x31,0xA2,0x10,0xA2,0x10,0x82,0x10,0x04,0x21,0xA2,0x10,0xE3,0x18,
-	0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0x08,0x42,0xAA,0x52,0x24,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0x08,0x42,0xA2,0x10,0xC3,0x18,0x82,0x10,0x08,0x42,0x28,0x42,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,
-	0x82,0x10,0x20,0x00,0x24,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x65,0x29,0x45,0x29,0x41,0x08,0x82,0x10,0x45,0x29,0x8A,0x52,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x8A,0x52,0x24,0x21,0x82,0x10,0x82,0x10,0xE7,0x39,0x04,0x21,0x00,0x00,0x20,0x00,0x24,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0x20,0x00,0x61,0x08,0xE3,0x18,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0x20,0x00,0x24,0x21,0x20,0x00,0x00,0x00,0x24,0x21,0xC3,0x18,0x00,0x00,0x82,0x10,0x86,0x31,0x20,0x00,
-	0x20,0x00,0x86,0x31,0x45,0x29,0x41,0x08,0x82,0x10,0x28,0x42,0x24,0x21,0x82,0x10,0xC3,0x18,0x69,0x4A,0x04,0x21,0x82,0x10,0xE3,0x18,0x69,0x4A,0x04,0x21,0x82,0x10,0x82,0x10,0xE7,0x39,0x04,0x21,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x24,0x21,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,
-	0xE3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0xAA,0x52,0x65,0x29,0xA2,0x10,0xA2,0x10,0x45,0x29,0x49,0x4A,0xE3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x24,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x69,0x4A,0x28,0x42,0xC3,0x18,0xA2,0x10,0x41,0x08,0x04,0x21,0xC3,0x18,0xE3,0x18,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0xC3,0x18,0xE7,0x39,0x8A,0x52,0xA6,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x8A,0x52,0x86,0x31,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0xE3,0x18,0xE3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0x69,0x4A,0x28,0x42,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0x24,0x21,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x49,0x4A,0x04,0x21,0xC3,0x18,0xA2,0x10,0xA6,0x31,0x8A,0x52,0xC3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x45,0x29,0x61,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x65,0x29,
-	0xA6,0x31,0x61,0x08,0x82,0x10,0x86,0x31,0x28,0x42,0xA2,0x10,0x82,0x10,0x65,0x29,0x28,0x42,0x82,0x10,0x82,0x10,0x65,0x29,0xC7,0x39,0x41,0x08,0x41,0x08,0x65,0x29,0x24,0x21,0x20,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0x00,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0x82,0x10,
-	0x41,0x08,0x24,0x21,0x82,0x10,0x41,0x08,0x45,0x29,0xA2,0x10,0x41,0x08,0x65,0x29,0x24,0x21,0x41,0x08,0x04,0x21,0xA6,0x31,0x61,0x08,0x82,0x10,0xC7,0x39,0x24,0x21,0x61,0x08,0x04,0x21,0x08,0x42,0x82,0x10,0x41,0x08,0x45,0x29,0xE7,0x39,0x41,0x08,0x20,0x00,0x24,0x21,0x65,0x29,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,
-	0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x04,0x21,0x20,0x00,0x82,0x10,0x65,0x29,0xCB,0x5A,0x04,0x21,0xC3,0x18,0x82,0x10,0x86,0x31,0x08,0x42,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x41,0x08,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x24,0x21,0x49,0x4A,0x04,0x21,0xA2,0x10,0xA2,0x10,0x24,0x21,0xE7,0x39,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x08,0x42,0xC7,0x39,0xA2,0x10,0xA2,0x10,0x61,0x08,0x04,0x21,0x82,0x10,0xC3,0x18,0x82,0x10,0xC3,0x18,0xC3,0x18,0xA2,0x10,0xC3,0x18,0xA2,0x10,0xE3,0x18,0x41,0x08,0xC3,0x18,
-	0xC3,0x18,0xE7,0x39,0xE7,0x39,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0xE7,0x39,0xE3,0x18,0xC3,0x18,0xA2,0x10,0x65,0x29,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x24,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x28,0x42,0x45,0x29,0x82,0x10,0xA2,0x10,0x65,0x29,
-	0xCB,0x5A,0x04,0x21,0x61,0x08,0x41,0x08,0x24,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x00,0x00,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0x86,0x31,0xE3,0x18,0x20,0x00,0x61,0x08,0xE7,0x39,0x04,0x21,0x41,0x08,0xC3,0x18,0xC7,0x39,
-	0x82,0x10,0x41,0x08,0x45,0x29,0x65,0x29,0x41,0x08,0x82,0x10,0x65,0x29,0x82,0x10,0x20,0x00,0x04,0x21,0xE3,0x18,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x61,0x08,0x04,0x21,0x00,0x00,0x00,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,
-	0x00,0x00,0x00,0x00,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0x61,0x08,0x20,0x00,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x08,0x42,0x65,0x29,0x82,0x10,0xA2,0x10,0x86,0x31,0xCB,0x5A,0xE3,0x18,0xA2,0x10,
-	0x82,0x10,0x86,0x31,0x86,0x31,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x04,0x21,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0xC7,0x39,0xA6,0x31,0x82,0x10,0xC3,0x18,0x82,0x10,0x08,0x42,0x08,0x42,0xC3,0x18,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x04,0x21,0x61,0x08,0xC3,0x18,0xA2,0x10,0xE7,0x39,
-	0x08,0x42,0x04,0x21,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x24,0x29,0x69,0x4A,0x49,0x4A,0x24,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0x28,0x42,0x86,0x31,0xA2,0x10,0xA2,0x10,0x82,0x10,0x04,0x21,0xC3,0x18,0xC3,0x18,0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x28,0x42,0xE7,0x39,
-	0xA2,0x10,0xC3,0x18,0x82,0x10,0xE7,0x39,0x86,0x31,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0xC7,0x39,0x45,0x29,0x61,0x08,0xA2,0x10,0x45,0x29,0xCB,0x5A,0x24,0x21,0xA2,0x10,0x82,0x10,0xA6,0x31,0xA6,0x31,0x20,0x00,0x00,0x00,0x61,0x08,0x04,0x21,0x82,0x10,0x00,0x00,
-	0x61,0x08,0x82,0x10,0x04,0x21,0x20,0x00,0x61,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x20,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,
-	0xC7,0x39,0x04,0x21,0x41,0x08,0x82,0x10,0x08,0x42,0x08,0x42,0x82,0x10,0xA2,0x10,0x45,0x29,0xAA,0x52,0xE3,0x18,0x41,0x08,0x41,0x08,0x24,0x21,0xE3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x29,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x08,0x42,0x24,0x21,0xA2,0x10,0xA2,0x10,0x45,0x29,0x8A,0x52,0x45,0x29,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x86,0x31,0xAA,0x52,0xC7,0x39,0xC3,0x18,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0xC3,0x18,0x24,0x21,0xC7,0x39,0xC3,0x18,0xC3,0x18,0x82,0x10,0xE3,0x18,0xC3,0x18,0x82,0x10,0xA2,0x10,0x04,0x21,0xC7,0x39,0xE3,0x18,0xC3,0x18,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0x08,0x42,0x8A,0x52,0x45,0x29,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0x69,0x4A,0x04,0x21,0xC3,0x18,0x82,0x10,0x65,0x29,0xE7,0x39,0xA2,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x41,0x08,
-	0x82,0x10,0x00,0x00,0x41,0x08,0x24,0x29,0x04,0x21,0x20,0x00,0x41,0x08,0x45,0x29,0x8A,0x52,0x04,0x21,0xC3,0x18,0x82,0x10,0x49,0x4A,0xA6,0x31,0x82,0x10,0x41,0x08,0x24,0x21,0x86,0x31,0x20,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,
-	0x20,0x00,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x00,0x00,0x00,0x00,0x45,0x29,0x86,0x31,0x41,0x08,0x61,0x08,0xA6,0x31,0x08,0x42,0x82,0x10,0x82,0x10,0x86,0x31,0x69,0x4A,0xA2,0x10,0x82,0x10,0xC3,0x18,0x08,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x21,
-	0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x24,0x21,0xE7,0x39,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xE7,0x39,0x8A,0x52,0xE3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x24,0x21,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0x49,0x4A,0x28,0x42,0xC3,0x18,0xA2,0x10,0x41,0x08,0xC3,0x18,0xA2,0x10,0xE3,0x18,0x82,0x10,0x61,0x08,
-	0x41,0x08,0x20,0x00,0xA2,0x10,0x86,0x31,0x69,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x69,0x4A,0x45,0x29,0xA2,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0x69,0x4A,0x28,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x04,0x21,0xAA,0x52,0xA6,0x31,0xC3,0x18,0xA2,0x10,0x04,0x21,0x08,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x24,0x21,0xE7,0x39,0xA2,0x10,0x82,0x10,0xE3,0x18,
-	0x8A,0x52,0x04,0x21,0xA2,0x10,0x82,0x10,0x28,0x42,0x45,0x29,0x41,0x08,0x61,0x08,0x86,0x31,0xC3,0x18,0x00,0x00,0x41,0x08,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,
-	0x82,0x10,0x04,0x21,0x41,0x08,0x82,0x10,0x24,0x21,0x41,0x08,0x41,0x08,0x45,0x29,0x82,0x10,0x20,0x00,0x45,0x29,0x04,0x21,0x20,0x00,0xC3,0x18,0xA6,0x31,0x61,0x08,0x41,0x08,0xA6,0x31,0x86,0x31,0x61,0x08,0x82,0x10,0x08,0x42,0x24,0x29,0x82,0x10,0xC3,0x18,0x49,0x4A,0x04,0x21,0x61,0x08,0xA2,0x10,0x08,0x42,0xE3,0x18,0x00,0x00,
-	0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0x00,0x00,0xE3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0xA6,0x31,0xE7,0x39,0x82,0x10,0xC3,0x18,0xC3,0x18,0x49,0x4A,0x08,0x42,0xA2,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x00,0x00,
-	0x20,0x00,0x24,0x21,0x28,0x42,0x04,0x21,0xC3,0x18,0xA2,0x10,0x24,0x29,0xE7,0x39,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x04,0x21,0x49,0x4A,0x28,0x42,0x04,0x21,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0xE7,0x39,0xA6,0x31,0xC3,0x18,0x82,0x10,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,
-	0x04,0x21,0x49,0x4A,0x28,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0xE7,0x39,0x04,0x21,0xA2,0x10,0xA2,0x10,0x45,0x29,0x28,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0xE3,0x18,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0x69,0x4A,0x08,0x42,0xA2,0x10,0xC3,0x18,0xC3,0x18,
-	0x28,0x42,0x24,0x29,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x82,0x10,0x20,0x00,0xE3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x20,0x00,0x24,0x29,0xA6,0x31,0x82,0x10,0x61,0x08,0x65,0x29,0xE7,0x39,0x82,0x10,0x61,0x08,0x65,0x29,0xA6,0x31,0x61,0x08,0x41,0x08,0x65,0x29,
-	0x24,0x21,0x41,0x08,0x82,0x10,0x65,0x29,0x61,0x08,0x20,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x04,0x21,0xC3,0x18,0x20,0x00,0x04,0x21,0x04,0x21,0x20,0x00,0xA2,0x10,0x86,0x31,0x41,0x08,0x41,0x08,0x65,0x29,0x04,0x21,
-	0x20,0x00,0xA2,0x10,0xA6,0x31,0x61,0x08,0x00,0x00,0xC3,0x18,0x65,0x29,0x20,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x61,0x08,0x41,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0x08,0x42,0x08,0x42,0x82,0x10,0xC3,0x18,
-	0xE3,0x18,0x69,0x4A,0x86,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0x86,0x31,0x65,0x29,0x61,0x08,0xC3,0x18,0xC3,0x18,0x49,0x4A,0x08,0x42,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0xC3,0x18,0x04,0x21,0x86,0x31,0x82,0x10,0xC3,0x18,0xA2,0x10,0x86,0x31,
-	0xA6,0x31,0xC3,0x18,0xA2,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x28,0x42,0x08,0x42,0xE3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0xC3,0x18,0xC7,0x39,0x24,0x29,0xA2,0x10,0xA2,0x10,0xC3,0x18,0x86,0x31,0xC3,0x18,0xC3,0x18,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x28,0x42,0x08,0x42,
-	0xA2,0x10,0xC3,0x18,0x82,0x10,0x86,0x31,0x45,0x29,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x82,0x10,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x08,0x42,0x28,0x42,0xA2,0x10,0xC3,0x18,0xC3,0x18,0x69,0x4A,0xA6,0x31,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x41,0x08,
-	0x61,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x82,0x10,0x00,0x00,0x82,0x10,0x65,0x29,0x41,0x08,0x20,0x00,0x04,0x21,0x04,0x21,0x20,0x00,0x61,0x08,0x24,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x61,0x08,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,
-	0xE3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xE7,0x39,0x04,0x21,0x61,0x08,0x82,0x10,0x08,0x42,0x49,0x4A,0x82,0x10,0xA2,0x10,0xE3,0x18,0x28,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0xC3,0x18,0x82,0x10,0xA2,0x10,0xA6,0x31,0xAA,0x52,0x45,0x29,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x65,0x29,0x8A,0x52,0xC7,0x39,0xC3,0x18,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x69,0x4A,0x65,0x29,0xC3,0x18,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xE3,0x18,0xA6,0x31,0x69,0x4A,0x65,0x29,0xA2,0x10,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x08,0x42,0x8A,0x52,0x24,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0xA6,0x31,0x8A,0x52,0x45,0x29,0xA2,0x10,0x61,0x08,0xE3,0x18,0x65,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x04,0x21,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x86,0x31,0x08,0x42,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x8A,0x52,0xA6,0x31,0x82,0x10,0x41,0x08,0x24,0x21,0xC7,0x39,0x41,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,
-	0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0xA6,0x31,0x04,0x21,0x41,0x08,0x82,0x10,0x08,0x42,0xA6,0x31,0x82,0x10,0x82,0x10,0x86,0x31,0x69,0x4A,0xA2,0x10,0x61,0x08,0xA2,0x10,0xA6,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,
-	0x20,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x45,0x29,0x82,0x10,0x82,0x10,0xA2,0x10,0x49,0x4A,0x69,0x4A,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x69,0x4A,0x49,0x4A,0xE3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0xA2,0x10,0xC3,0x18,
-	0xA2,0x10,0x82,0x10,0xC3,0x18,0x04,0x21,0xE7,0x39,0x04,0x21,0xC3,0x18,0x61,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0xC3,0x18,0x24,0x29,0xE7,0x39,0xC3,0x18,0xA2,0x10,0x61,0x08,0xC3,0x18,0xC3,0x18,0xA2,0x10,0xC3,0x18,0x82,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x04,0x21,0x69,0x4A,0x28,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x8A,0x52,0x08,0x42,0xA2,0x10,0x82,0x10,0xA2,0x10,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x24,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0x82,0x10,0x61,0x08,0xE3,0x18,0x8A,0x52,0x45,0x29,0x82,0x10,0x82,0x10,
-	0xE7,0x39,0xA6,0x31,0x41,0x08,0x20,0x00,0x04,0x21,0x45,0x29,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0x20,0x00,
-	0x61,0x08,0xC3,0x18,0x00,0x00,0x61,0x08,0xE3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0x00,0x00,0x20,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0xC3,0x18,0x04,0x21,0x00,0x00,0x41,0x08,0x86,0x31,0xA2,0x10,0x20,0x00,0xA2,0x10,0xC7,0x39,0x82,0x10,0x41,0x08,0x24,0x21,0x08,0x42,0x82,0x10,0x82,0x10,0x45,0x29,0x49,0x4A,0xA2,0x10,0x61,0x08,
-	0xE3,0x18,0x08,0x42,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x65,0x29,0x45,0x29,0x41,0x08,0x82,0x10,0x04,0x21,0x8A,0x52,0xE7,0x39,0xA2,0x10,0x41,0x08,0x82,0x10,0xE3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,
-	0x41,0x08,0x24,0x21,0x08,0x42,0x04,0x21,0xC3,0x18,0xA2,0x10,0x24,0x21,0xA6,0x31,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x24,0x21,0x69,0x4A,0x49,0x4A,0x24,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x45,0x29,0x69,0x4A,0x49,0x4A,0x24,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,
-	0x45,0x29,0x69,0x4A,0x49,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0xA6,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0x45,0x29,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0xA2,0x10,0x28,0x42,0x69,0x4A,0xC3,0x18,0x82,0x10,0x61,0x08,
-	0x65,0x29,0x04,0x21,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x24,0x21,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0xA2,0x10,0x61,0x08,0xC3,0x18,0x28,0x42,0xE3,0x18,0x82,0x10,0xA2,0x10,0xE7,0x39,0xC3,0x18,0x41,0x08,0xA2,0x10,0x86,0x31,0x41,0x08,0x20,0x00,0xC3,0x18,
-	0x04,0x21,0x20,0x00,0x00,0x00,0xE3,0x18,0x61,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x04,0x21,0xA2,0x10,0x20,0x00,0x04,0x21,0xE3,0x18,0x20,0x00,0x04,0x21,0x45,0x29,0x41,0x08,0x82,0x10,0x86,0x31,0xA2,0x10,
-	0x41,0x08,0x24,0x21,0xA6,0x31,0x41,0x08,0x41,0x08,0x86,0x31,0x65,0x29,0x41,0x08,0x41,0x08,0x86,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0xE7,0x39,0x65,0x29,0x41,0x08,0xA2,0x10,
-	0x45,0x29,0xAA,0x52,0x65,0x29,0x82,0x10,0x20,0x00,0xA2,0x10,0x04,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0x65,0x29,0x45,0x29,0x41,0x08,0xC3,0x18,0xC3,0x18,0x28,0x42,0xE7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0x45,0x29,0x08,0x42,0x04,0x21,0xC3,0x18,0x82,0x10,0xC3,0x18,
-	0xE3,0x18,0x82,0x10,0xC3,0x18,0xA2,0x10,0x24,0x21,0x82,0x10,0xC3,0x18,0x82,0x10,0x04,0x21,0x04,0x21,0x82,0x10,0xA2,0x10,0xA2,0x10,0x24,0x21,0x82,0x10,0xC3,0x18,0x82,0x10,0xE3,0x18,0xA2,0x10,0x82,0x10,0xC3,0x18,0x45,0x29,0x08,0x42,0x04,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x28,0x42,0x08,0x42,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0x24,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x04,0x21,0xA2,0x10,0x41,0x08,0xA2,0x10,0xA6,0x31,0x8A,0x52,0xE3,0x18,0xA2,0x10,0x61,0x08,0x86,0x31,0xA6,0x31,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,
-	0x61,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x20,0x00,0x24,0x29,0x04,0x21,0x20,0x00,0x41,0x08,0x86,0x31,0x04,0x21,0x20,0x00,0x41,0x08,0x65,0x29,0xA2,0x10,0x41,0x08,0xC3,0x18,0x24,0x21,0x41,0x08,0x41,0x08,0xE3,0x18,0x82,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x00,0x00,0x00,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0xC3,0x18,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x28,0x42,0xA6,0x31,0x82,0x10,0xA2,0x10,0x65,0x29,0x8A,0x52,0x04,0x21,0x41,0x08,0x20,0x00,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0x82,0x10,0x61,0x08,0xA2,0x10,0xA6,0x31,0xAA,0x52,0x45,0x29,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0xC3,0x18,0x24,0x21,0x69,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x8A,0x52,0xA6,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0x8A,0x52,0x86,0x31,0xA2,0x10,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xE7,0x39,0x49,0x4A,0xE3,0x18,0xA2,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,0xE3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0xA6,0x31,0x8A,0x52,0x65,0x29,0xA2,0x10,0x41,0x08,0xC3,0x18,0x24,0x21,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,
-	0x82,0x10,0x00,0x00,0x61,0x08,0x65,0x29,0x69,0x4A,0x04,0x21,0xA2,0x10,0x82,0x10,0xE7,0x39,0xE7,0x39,0x61,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xE7,0x39,0x04,0x21,0x41,0x08,0x82,0x10,0x08,0x42,0x08,0x42,0x82,0x10,0x82,0x10,0x24,0x21,0x28,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0xA2,0x10,
-	0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0x41,0x08,0x61,0x08,0xC3,0x18,0x69,0x4A,0x49,0x4A,0xE3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0x69,0x4A,0x69,0x4A,0x04,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0xA6,0x31,
-	0x86,0x31,0xC3,0x18,0xA2,0x10,0x41,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0xC3,0x18,0xE7,0x39,0xC7,0x39,0xC3,0x18,0x82,0x10,0x61,0x08,0xC3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0xC7,0x39,0x86,0x31,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x45,0x29,0x69,0x4A,0x08,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x04,0x21,0xA2,0x10,0xA2,0x10,0x20,0x00,0x61,0x08,0x04,0x21,0x8A,0x52,0x28,0x42,0xA2,0x10,0x41,0x08,0x61,0x08,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x04,0x21,0x28,0x42,0xE3,0x18,0x82,0x10,0xA2,0x10,0x28,0x42,0xA6,0x31,0x82,0x10,0x41,0x08,
-	0x24,0x21,0x86,0x31,0x41,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,
-	0x41,0x08,0xC3,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x20,0x00,0x41,0x08,0x45,0x29,0x86,0x31,0x41,0x08,0x61,0x08,0x86,0x31,0xE7,0x39,0x82,0x10,0x61,0x08,
-	0x65,0x29,0x28,0x42,0xA2,0x10,0x41,0x08,0xA2,0x10,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0xC3,0x18,0x20,0x00,0x82,0x10,0x04,0x21,0x8A,0x52,0xA6,0x31,0xA2,0x10,0x41,0x08,0xA2,0x10,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,
-	0x41,0x08,0x45,0x29,0x49,0x4A,0x45,0x29,0xC3,0x18,0x82,0x10,0xC3,0x18,0x24,0x29,0xA2,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0x28,0x42,0x28,0x42,0x04,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0x08,0x42,0xE7,0x39,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,
-	0x24,0x21,0x49,0x4A,0xE7,0x39,0xC3,0x18,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0x45,0x29,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x86,0x31,0x28,0x42,0x04,0x21,0x20,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x04,0x21,0x82,0x10,0x82,0x10,0xA2,0x10,0x08,0x42,0x69,0x4A,0xE3,0x18,0x61,0x08,0x41,0x08,
-	0xE3,0x18,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0xE3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0x82,0x10,0x41,0x08,0xC3,0x18,0x08,0x42,0x04,0x21,0x82,0x10,0x82,0x10,0xE7,0x39,0x24,0x21,0x41,0x08,0x61,0x08,0x65,0x29,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,
-	0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x04,0x21,0xC3,0x18,0x20,0x00,0xE3,0x18,0x04,0x21,0x20,0x00,0x82,0x10,0x65,0x29,0x82,0x10,
-	0x41,0x08,0x24,0x29,0x65,0x29,0x41,0x08,0x61,0x08,0xA6,0x31,0x24,0x21,0x41,0x08,0x82,0x10,0xC7,0x39,0x04,0x21,0x41,0x08,0x61,0x08,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x86,0x31,0xE3,0x18,0x41,0x08,0x82,0x10,
-	0x65,0x29,0x8A,0x52,0x45,0x29,0x82,0x10,0x41,0x08,0x04,0x21,0x24,0x21,0xC3,0x18,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0xA2,0x10,0x65,0x29,0x65,0x29,0x82,0x10,0xC3,0x18,0xA2,0x10,0x08,0x42,0xC7,0x39,0xE3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0xA6,0x31,0x69,0x4A,0x86,0x31,0xC3,0x18,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0xC3,0x18,0x86,0x31,0x49,0x4A,0x86,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x21,0xA6,0x31,0x49,0x4A,0x24,0x21,0xA2,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0xE3,0x18,0xE7,0x39,0x69,0x4A,0x65,0x29,0x82,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x04,0x21,0xE7,0x39,0xE7,0x39,
-	0xA2,0x10,0xC3,0x18,0x82,0x10,0x86,0x31,0x24,0x21,0xA2,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0xC3,0x18,0x41,0x08,0xA2,0x10,0xA6,0x31,0x8A,0x52,0x04,0x21,0x82,0x10,0x41,0x08,0x04,0x21,0x45,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0xE3,0x18,0x24,0x21,0x20,0x00,0x41,0x08,0x24,0x21,0x65,0x29,0x41,0x08,0x41,0x08,0x24,0x21,0x24,0x21,0x41,0x08,0x41,0x08,0x24,0x21,0xC3,0x18,0x20,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0xE3,0x18,0x41,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,
-	0x41,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0xE7,0x39,0x45,0x29,0x61,0x08,0xA2,0x10,0x86,0x31,0x69,0x4A,0x04,0x21,0x61,0x08,0x20,0x00,0x04,0x21,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x24,0x29,0xA9,0x8B,0x61,0x08,0xA2,0x10,0xA6,0x31,0x8A,0x52,0x65,0x29,
-	0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0x45,0x29,0x24,0x21,0x82,0x10,0xC3,0x18,0xC3,0x18,0xC7,0x39,0x04,0x21,0xC3,0x18,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x24,0x29,0x08,0x42,0x04,0x21,0xA2,0x10,0x61,0x08,0x04,0x21,0xE3,0x18,0x61,0x08,0xC3,0x18,0x45,0x29,0x08,0x42,0x04,0x21,0xA2,0x10,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x65,0x29,0xA6,0x31,0xA2,0x10,0xC3,0x18,0x82,0x10,0x45,0x29,0x24,0x21,0xC3,0x18,0x82,0x10,0x41,0x08,0x43,0x31,0x2F,0xEE,0x49,0x83,0xA6,0x31,0x8A,0x52,0x45,0x29,0xA2,0x10,0x41,0x08,0xC3,0x18,0x24,0x21,0xA2,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,
-	0xE3,0x18,0x20,0x00,0x61,0x08,0x45,0x29,0x69,0x4A,0x24,0x21,0x82,0x10,0x41,0x08,0x65,0x29,0xA6,0x31,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,
-	0x00,0x00,0x20,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x65,0x29,0xA2,0x10,0x20,0x00,0x82,0x10,0x08,0x42,0xA6,0x31,0x61,0x08,0x82,0x10,0x45,0x29,0x49,0x4A,0xE3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0xE3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0xED,0xB4,0x4E,0xC5,0xE3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0x28,0x42,0x69,0x4A,0x45,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x24,0x21,0x49,0x4A,
-	0x49,0x4A,0x24,0x21,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x69,0x4A,0x28,0x42,0x45,0x29,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x69,0x4A,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x65,0x29,0x69,0x4A,0xE7,0x39,0xC3,0x18,0x86,0x62,0x6B,0xB4,0x49,0x83,
-	0x71,0xFE,0x6E,0xDD,0x82,0x10,0x82,0x10,0x61,0x10,0xC2,0x18,0x04,0x21,0x69,0x4A,0x08,0x42,0xA2,0x10,0x41,0x08,0x61,0x08,0xE3,0x18,0xA2,0x10,0x82,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x28,0x42,0x04,0x21,0x82,0x10,0x82,0x10,0xC7,0x39,0x86,0x31,0x61,0x08,0x20,0x00,
-	0xC3,0x18,0x24,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,
-	0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0xC3,0x18,0x00,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x00,0x00,0x20,0x00,0x04,0x21,0x24,0x21,0x20,0x00,0x41,0x08,0x86,0x31,0x86,0x31,0x41,0x08,0x82,0x10,
-	0x65,0x29,0x08,0x42,0x82,0x10,0x41,0x08,0xC3,0x18,0xC7,0x39,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0xC3,0x18,0x20,0x00,0x82,0x10,0x24,0x21,0x8A,0x52,0xC7,0x39,0xA2,0x10,0xCA,0x93,0x91,0xFE,0xAA,0x8B,0xA2,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0x00,0x00,
-	0x61,0x08,0x65,0x29,0x69,0x4A,0xC7,0x39,0xC3,0x18,0x41,0x08,0x61,0x08,0x82,0x10,0x82,0x10,0xC3,0x18,0xA2,0x10,0x24,0x29,0x82,0x10,0xA2,0x10,0x82,0x10,0x45,0x29,0x65,0x29,0x82,0x10,0xA2,0x10,0xA2,0x10,0x65,0x29,0xC3,0x18,0xA2,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,0x82,0x10,0xA2,0x10,0xE3,0x18,0x65,0x29,0x82,0x10,0xA2,0x10,
-	0x82,0x10,0x86,0x31,0x24,0x21,0xA2,0x10,0xA2,0x10,0xC3,0x18,0x24,0x21,0x82,0x10,0xC3,0x18,0x61,0x08,0x82,0x10,0x85,0x39,0x2E,0xD5,0x4C,0xAC,0x51,0xFE,0xCC,0x8B,0x51,0xFE,0x4C,0xB4,0x00,0x00,0x41,0x08,0x6E,0xDD,0x8F,0xE5,0xE3,0x20,0x47,0x5A,0x82,0x10,0x41,0x08,0xA2,0x10,0x08,0x42,0x69,0x4A,0xE3,0x18,0x41,0x08,0x41,0x08,
-	0xC3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x82,0x10,0x41,0x08,0xA2,0x10,0xE7,0x39,0x04,0x21,0x61,0x08,0x82,0x10,0x86,0x31,0x04,0x21,0x41,0x08,0x20,0x00,0x04,0x21,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0x61,0x08,0x45,0x29,0x82,0x10,
-	0x20,0x00,0x04,0x21,0x45,0x29,0x41,0x08,0x41,0x08,0x86,0x31,0x04,0x21,0x41,0x08,0x82,0x10,0xA6,0x31,0xE3,0x18,0x41,0x08,0x82,0x10,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0xE3,0x18,0x20,0x00,0x82,0x10,
-	0x65,0x29,0x69,0x4A,0x45,0x29,0x82,0x10,0x41,0x08,0x04,0x21,0x04,0x21,0xAA,0x93,0x51,0xFE,0x51,0xFE,0x05,0x52,0x00,0x00,0xA2,0x10,0x86,0x31,0xE7,0x39,0xA2,0x10,0xA2,0x10,0x82,0x10,0x86,0x31,0x65,0x29,0xC3,0x18,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x86,0x31,0x8A,0x52,0xE7,0x39,0x04,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x04,0x21,0xC7,0x39,0x69,0x4A,0x86,0x31,0xE3,0x18,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x04,0x21,0xE7,0x39,0x69,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x08,0x42,0x69,0x4A,0x24,0x29,0x82,0x10,0x00,0x00,0xC5,0x49,0xAA,0x93,0xB0,0xF5,0xA5,0x41,0x49,0x83,0x65,0x29,
-	0x47,0x5A,0x24,0x29,0xC3,0x18,0xE7,0x39,0x11,0xFE,0x11,0xFE,0xE8,0x7A,0x11,0xFE,0x05,0x52,0x05,0x52,0xA2,0x10,0x24,0x21,0xC3,0x18,0x41,0x08,0xA2,0x10,0xA6,0x31,0x69,0x4A,0x04,0x21,0x82,0x10,0x20,0x00,0x04,0x21,0x04,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x00,0x00,0x20,0x00,0xE3,0x18,0x24,0x21,0x41,0x08,0x41,0x08,0x04,0x21,0x45,0x29,0x41,0x08,0x41,0x08,0x04,0x21,0x04,0x21,0x20,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0x20,0x00,0x04,0x21,0x82,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0xA6,0x31,0x24,0x21,0x41,0x08,0x82,0x10,0x86,0x31,0x69,0x4A,0x04,0x21,0x61,0x08,0x20,0x00,0x04,0x21,0x04,0x21,0xA2,0x10,0x00,0x00,0x61,0x08,0xE8,0x7A,0x11,0xFE,0x11,0xFE,0x11,0xFE,0x85,0x39,0x61,0x08,0xA2,0x10,0x45,0x29,0x49,0x4A,0x65,0x29,
-	0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0xE7,0x39,0xE7,0x39,0xC3,0x18,0xA2,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0xA2,0x10,0xA2,0x10,0x86,0x31,0x86,0x31,0xC3,0x18,0x82,0x10,0x41,0x08,0xA2,0x10,0x00,0x00,0x82,0x10,0x04,0x21,0x49,0x4A,0x28,0x42,0x04,0x21,0x41,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0xA2,0x10,
-	0xC3,0x18,0xA6,0x31,0x45,0x29,0xA2,0x10,0x82,0x10,0x82,0x10,0xA2,0x10,0x41,0x08,0xA2,0x10,0xE3,0x18,0xEC,0x9B,0xEC,0xA3,0xC3,0x18,0xA2,0x18,0xA7,0x72,0xEB,0xA3,0x6A,0x93,0x64,0x31,0xA6,0x31,0x28,0x42,0xCB,0x9B,0xAE,0xCC,0xA5,0x41,0xAE,0xCC,0xEC,0xA3,0xEB,0xA3,0x03,0x29,0xA2,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,
-	0xE3,0x18,0x20,0x00,0x82,0x10,0x45,0x29,0x49,0x4A,0x04,0x21,0x82,0x10,0x41,0x08,0x45,0x29,0x65,0x29,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x45,0x29,0xA2,0x10,0x20,0x00,0x82,0x10,0xC7,0x39,0x86,0x31,0x61,0x08,0x82,0x10,0x45,0x29,0x28,0x42,0xE3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x4A,0x8B,0xD1,0xFD,0xD1,0xFD,0xD1,0xFD,0xB0,0xF5,0x49,0x4A,0x04,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x04,0x21,0x82,0x10,0x82,0x10,0xA2,0x10,0x86,0x31,0x08,0x42,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0x28,0x42,
-	0x28,0x42,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0xA2,0x10,0x86,0x31,0x65,0x29,0xA2,0x10,0x82,0x10,0x41,0x08,0x61,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x49,0x4A,0xE7,0x39,0x04,0x21,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0x04,0x21,0xEC,0xA3,0x86,0x39,0xEC,0xAB,0xB1,0xFD,0xB1,0xFD,0xB1,0xFD,
-	0xB1,0xFD,0x2C,0xB4,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x24,0x29,0x69,0x4A,0x07,0x42,0x03,0x21,0x8D,0xCC,0x67,0x62,0x24,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0xC3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x08,0x42,0xE3,0x18,0x82,0x10,0x61,0x08,0x86,0x31,0x65,0x29,0x41,0x08,0x00,0x00,
-	0xA2,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x61,0x08,
-	0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0x20,0x00,0x20,0x00,0xE3,0x18,0x24,0x21,0x20,0x00,0x41,0x08,0x45,0x29,0x86,0x31,0x41,0x08,0x61,0x08,
-	0x45,0x29,0xE7,0x39,0x82,0x10,0x41,0x08,0xC3,0x18,0xA6,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x04,0x21,0x41,0x08,0x61,0x08,0xC9,0x7A,0x91,0xFD,0x91,0xFD,0x91,0xFD,0x91,0xFD,0x4D,0xC4,0xA2,0x10,0x82,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x61,0x08,0x24,0x21,0x69,0x4A,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x28,0x42,0x86,0x31,0xE3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x69,0x4A,0xA6,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x29,0xE7,0x39,0x69,0x4A,0x45,0x29,0xC3,0x18,
-	0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0xC7,0x39,0x28,0x42,0x04,0x21,0x82,0x10,0x00,0x00,0x81,0x10,0xAE,0xD4,0x71,0xFD,0x71,0xFD,0x71,0xFD,0x71,0xFD,0x71,0xFD,0x4D,0xCC,0x00,0x00,0x41,0x08,0x03,0x29,0x4D,0xC4,0xEF,0xE4,0x4D,0xC4,0x09,0x8B,0x03,0x29,0x24,0x29,0xAE,0xD4,0x08,0x42,0xA2,0x10,0x41,0x08,0x61,0x08,
-	0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0xE3,0x18,0x65,0x29,0x61,0x08,0x41,0x08,0xC3,0x18,0xA6,0x31,0xC3,0x18,0x41,0x08,0x61,0x08,0x65,0x29,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,0x20,0x00,0x04,0x21,0xA2,0x10,
-	0x20,0x00,0xA2,0x10,0x24,0x21,0x41,0x08,0x41,0x08,0x24,0x21,0x24,0x21,0x41,0x08,0x61,0x08,0x65,0x29,0x04,0x21,0x41,0x08,0x41,0x08,0x65,0x29,0xE3,0x18,0x20,0x00,0x00,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x24,0x21,0x20,0x00,0x82,0x10,
-	0x24,0x21,0x49,0x4A,0x86,0x31,0x47,0x6A,0x51,0xFD,0x71,0xFD,0x51,0xFD,0x51,0xFD,0x51,0xFD,0x2A,0x9B,0x20,0x00,0x00,0x00,0xC3,0x18,0xA6,0x31,0x49,0x4A,0x24,0x21,0xA2,0x10,0x41,0x08,0xC3,0x18,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x41,0x08,0xA2,0x10,0xE3,0x18,0xE7,0x39,0x45,0x29,0xC3,0x18,0x41,0x08,0x82,0x10,
-	0xA2,0x10,0x41,0x08,0xA2,0x10,0xE3,0x18,0x86,0x31,0x82,0x10,0x82,0x10,0xA2,0x10,0xE7,0x39,0xC7,0x39,0xA2,0x10,0x61,0x08,0xC3,0x18,0x86,0x31,0xC3,0x18,0xA2,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0xC3,0x18,0x86,0x31,0xE7,0x39,0xC3,0x18,0xA2,0x10,0x41,0x08,0xA9,0x7A,0x51,0xFD,0x51,0xFD,0x51,0xFD,0x51,0xFD,0x51,0xFD,
-	0x51,0xFD,0xA9,0x7A,0x65,0x29,0x28,0x42,0xAC,0xA3,0x51,0xFD,0x51,0xFD,0x51,0xFD,0x51,0xFD,0x31,0xFD,0x0A,0x93,0xE3,0x20,0x82,0x10,0x20,0x00,0xA2,0x10,0xA6,0x31,0x28,0x42,0xC3,0x18,0x61,0x08,0x41,0x08,0x24,0x21,0x04,0x21,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x04,0x21,0x20,0x00,0x41,0x08,0x04,0x21,0x04,0x21,0x20,0x00,0x41,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x86,0x31,0x65,0x29,0x41,0x08,0x82,0x10,0x24,0x21,0x28,0x42,0x24,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x48,0x6A,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x11,0xFD,0xED,0xBB,0xEA,0x82,0x47,0x6A,0x48,0x6A,0x48,0x6A,0xA6,0x31,0x04,0x21,
-	0xA2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x08,0x42,0x69,0x4A,0x45,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0x28,0x42,0x49,0x4A,0x45,0x29,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xE7,0x39,0xE7,0x39,0x04,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,
-	0x65,0x29,0x69,0x4A,0x08,0x42,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x86,0x31,0xEE,0xB3,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x6B,0xAB,0xC3,0x18,0x24,0x29,0x86,0x31,0x0A,0x93,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x27,0x6A,0x41,0x08,0x41,0x08,0xA2,0x10,0xC3,0x18,
-	0x82,0x10,0x00,0x00,0x82,0x10,0x65,0x29,0xE7,0x39,0xC3,0x18,0x61,0x08,0x41,0x08,0x65,0x29,0x24,0x29,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x24,0x29,0xE3,0x18,0x20,0x00,0x61,0x08,0x86,0x31,0xA6,0x31,0x82,0x10,0x61,0x08,0xE3,0x18,0xE7,0x39,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0xC3,0x18,
-	0x20,0x00,0xA6,0x51,0xD1,0xFC,0xD1,0xFC,0xF1,0xFC,0xD1,0xFC,0xF1,0xFC,0xD1,0xFC,0xD1,0xFC,0xF1,0xFC,0xF1,0xFC,0xF1,0xFC,0xD1,0xFC,0x85,0x51,0x41,0x08,0x00,0x00,0x82,0x10,0x04,0x21,0xE7,0x39,0x65,0x29,0xA2,0x10,0x82,0x10,0xA2,0x10,0x04,0x21,0x82,0x10,0xA2,0x10,0x82,0x10,0x45,0x29,0xC3,0x18,0x82,0x10,0x82,0x10,0x04,0x21,
-	0x04,0x21,0x41,0x08,0xA2,0x10,0x04,0x21,0x08,0x42,0x86,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x21,0xA6,0x31,0x08,0x42,0xE3,0x18,0x82,0x10,0x41,0x08,0x24,0x21,0xC3,0x18,0x82,0x10,0x82,0x10,0x04,0x21,0x24,0x21,0x82,0x10,0xA2,0x10,0x82,0x10,0xCA,0x8A,0xD1,0xFC,0xD1,0xFC,0xD1,0xFC,0xD1,0xFC,0x90,0xEC,
-	0x04,0x21,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x20,0x90,0xF4,0xD1,0xFC,0xF1,0xFC,0xD1,0xFC,0xD1,0xFC,0xD1,0xFC,0x2F,0xDC,0x86,0x31,0xA2,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x24,0x21,0x86,0x31,0x82,0x10,0x41,0x08,0xA2,0x10,0x86,0x31,0x04,0x21,0x41,0x08,0x20,0x00,
-	0xE3,0x18,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x82,0x10,0x00,0x00,0x82,0x10,0x45,0x29,0x61,0x08,0x20,0x00,0xC3,0x18,0x86,0x31,0x82,0x10,0x41,0x08,
-	0xC3,0x18,0xA6,0x31,0xC3,0x18,0x41,0x08,0x41,0x08,0x45,0x29,0xC3,0x18,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x08,0x62,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x69,0x7A,0xC3,0x18,0x04,0x21,0x41,0x08,
-	0x82,0x10,0xC3,0x18,0xE7,0x39,0xC7,0x39,0x04,0x21,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,0x69,0x4A,0xE7,0x39,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x65,0x29,0x08,0x42,0x04,0x21,0x82,0x10,0x61,0x08,0x86,0x31,0x65,0x29,0x82,0x10,0x82,0x10,0x45,0x29,0x08,0x42,0x24,0x21,0xC3,0x18,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x04,0x21,0x08,0x42,0x49,0x4A,0x24,0x21,0x82,0x10,0x00,0x00,0x03,0x31,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x8D,0xBB,0xA2,0x10,0x82,0x10,0x82,0x10,0x04,0x21,0xA2,0x10,0x85,0x49,0x50,0xF4,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x91,0xFC,0x50,0xEC,0x86,0x31,0x82,0x10,0x41,0x08,0xC3,0x18,
-	0x86,0x31,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0x04,0x21,0x20,0x00,0x41,0x08,0xE3,0x18,0x65,0x29,0x82,0x10,0x20,0x00,0xA2,0x10,0x45,0x29,0x82,0x10,0x20,0x00,0x82,0x10,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,
-	0x20,0x00,0x41,0x08,0x04,0x21,0xA2,0x10,0x20,0x00,0xA2,0x10,0x24,0x21,0x41,0x08,0x20,0x00,0xE3,0x18,0x24,0x21,0x41,0x08,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x86,0x31,0x82,0x10,0x61,0x08,
-	0xE7,0x61,0xCB,0x82,0xAA,0x82,0x08,0x6A,0xA6,0x61,0x6D,0xCB,0x51,0xFC,0x51,0xFC,0x51,0xFC,0x51,0xFC,0x51,0xFC,0x69,0x8A,0xA2,0x10,0x86,0x31,0x49,0x4A,0x86,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0xC3,0x18,0x86,0x31,0xE7,0x39,0xE3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0xE3,0x18,0xC7,0x39,
-	0x08,0x42,0x24,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0x08,0x42,0xE7,0x39,0x24,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x29,0x08,0x42,0xA6,0x31,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0xA2,0x10,0x04,0x21,0xE7,0x39,0x6D,0xBB,0x71,0xFC,0x71,0xFC,0x71,0xFC,0x6D,0xBB,
-	0x00,0x00,0xE3,0x18,0xC7,0x39,0x28,0x42,0x24,0x21,0x82,0x10,0xE7,0x69,0x71,0xFC,0x71,0xFC,0x51,0xFC,0x51,0xFC,0x6D,0xBB,0x00,0x00,0x00,0x00,0xA2,0x10,0xA6,0x31,0xA6,0x31,0x82,0x10,0x61,0x08,0xA2,0x10,0x86,0x31,0xE3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,
-	0x41,0x08,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0xE3,0x18,0xA2,0x10,0x00,0x00,0x82,0x10,0x45,0x29,0xA6,0x31,0xA2,0x10,0x41,0x08,0xA2,0x10,0xA6,0x31,0x65,0x29,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x6E,0xD3,0x11,0xFC,0x11,0xFC,0x11,0xFC,0x11,0xFC,0x6E,0xBB,0x04,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x82,0x10,
-	0xA2,0x10,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0xA2,0x10,0x65,0x29,0xE7,0x39,0xE3,0x18,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0xA6,0x31,0xA6,0x31,0xA2,0x10,0x82,0x10,0xA2,0x10,0xA6,0x31,0x24,0x21,0xC3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x65,0x29,0x86,0x31,0x82,0x10,0x82,0x10,
-	0xA2,0x10,0xC7,0x39,0x65,0x29,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x24,0x21,0xE7,0x39,0x65,0x39,0xF0,0xEB,0x31,0xFC,0x31,0xFC,0x31,0xFC,0xE8,0x69,0x82,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0x82,0x10,0xA6,0x49,0x31,0xFC,0x31,0xFC,0x31,0xFC,0x31,0xFC,0xC7,0x69,0x61,0x08,0x82,0x10,0x82,0x10,0x61,0x08,
-	0x20,0x00,0x00,0x00,0xA2,0x10,0x65,0x29,0x65,0x29,0x61,0x08,0x41,0x08,0xA2,0x10,0x86,0x31,0xE3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0x45,0x29,0x61,0x08,0x41,0x08,0xE3,0x18,0xA6,0x31,0xE3,0x18,0x41,0x08,0x41,0x08,0x45,0x29,0x04,0x21,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,
-	0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0xE4,0x20,0xD1,0xFB,0xD1,0xFB,0xD1,0xFB,0xD1,0xFB,0xED,0xBA,0x45,0x29,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0x28,0x42,0x08,0x42,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0x28,0x42,0xC7,0x39,0x24,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0x28,0x42,0x45,0x29,0xA2,0x10,0x41,0x08,0x45,0x29,0x24,0x21,0x41,0x08,0xC3,0x18,0x86,0x31,0x28,0x42,0x65,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0xE7,0x39,0x08,0x42,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x61,0xF1,0xFB,0xF1,0xFB,0xF1,0xFB,
-	0xF1,0xFB,0xE8,0x79,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0xA7,0x59,0xF1,0xFB,0xF1,0xFB,0xF1,0xFB,0x8F,0xDB,0xC7,0x39,0xA6,0x31,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0x04,0x21,0x20,0x00,0x41,0x08,0xE3,0x18,0x65,0x29,0x82,0x10,0x20,0x00,0x82,0x10,
-	0x04,0x21,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x61,0x08,0xA2,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0x61,0x08,0x20,0x00,0xC3,0x18,0xE3,0x18,0x20,0x00,0x41,0x08,0x24,0x21,0xE3,0x18,0x20,0x00,0x41,0x08,0x45,0x29,0x04,0x21,0x41,0x08,
-	0x20,0x00,0x24,0x21,0x04,0x21,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0xE7,0x39,0x45,0x29,0x82,0x10,0xE4,0x30,0x91,0xFB,0x91,0xFB,0x91,0xFB,0xEE,0xD2,0x21,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x45,0x29,0xE7,0x39,0x24,0x29,
-	0xA2,0x10,0x20,0x00,0xC3,0x18,0xC3,0x18,0x61,0x08,0x82,0x10,0xC3,0x18,0x45,0x29,0x82,0x10,0x82,0x10,0x82,0x10,0x45,0x29,0xC3,0x18,0x61,0x08,0x82,0x10,0x65,0x29,0xA6,0x31,0xE3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0x45,0x29,0x08,0x42,0xE7,0x39,0x24,0x29,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,
-	0xE3,0x18,0xC7,0x39,0x24,0x21,0x82,0x10,0x41,0x08,0x04,0x21,0x24,0x29,0x61,0x08,0x82,0x10,0x82,0x10,0x24,0x21,0xA2,0x10,0x82,0x10,0x4F,0xDB,0xB1,0xFB,0xB1,0xFB,0xB1,0xFB,0xB1,0xFB,0xC7,0x51,0xE7,0x39,0x04,0x21,0xA3,0x20,0x2F,0xDB,0xB1,0xFB,0xB1,0xFB,0xB1,0xFB,0x87,0x59,0x65,0x29,0xC3,0x18,0x41,0x08,0x82,0x10,0x65,0x29,
-	0xA6,0x31,0xA2,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,0xE3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x61,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0xE3,0x18,0x00,0x00,0x41,0x08,0x04,0x21,0xC7,0x39,0x24,0x21,0x82,0x10,
-	0x20,0x00,0x04,0x21,0x45,0x29,0xA2,0x10,0x26,0x59,0x51,0xFB,0x51,0xFB,0xEF,0xDA,0xE4,0x28,0x45,0x29,0x65,0x29,0x82,0x10,0x82,0x10,0xA2,0x10,0xA6,0x31,0x24,0x29,0xA2,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xA6,0x31,0x28,0x42,0x45,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x04,0x21,0xE7,0x39,
-	0xE7,0x39,0xE3,0x18,0x61,0x08,0x41,0x08,0x65,0x29,0x04,0x21,0xA2,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0x45,0x29,0x20,0x00,0x82,0x10,0xE3,0x18,0x08,0x42,0xA6,0x31,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x08,0x42,0x65,0x29,0xC3,0x18,0xE9,0x89,0x91,0xFB,0x91,0xFB,
-	0x91,0xFB,0x91,0xFB,0x4A,0x82,0x86,0x31,0xA2,0x18,0x0E,0xD3,0x91,0xFB,0x91,0xFB,0x91,0xFB,0xEE,0xCA,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x24,0x29,0xC3,0x18,0x20,0x00,0x82,0x10,0x24,0x29,0x86,0x31,0xA2,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,
-	0x82,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x45,0x29,0x82,0x10,0x41,0x08,0xA2,0x10,0x86,0x31,0x24,0x21,0x82,0x10,0x00,0x00,0xC3,0x18,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xEA,0x89,0x31,0xFB,0xD0,0xEA,0xC3,0x30,0x82,0x10,0x24,0x29,0xE7,0x39,0x24,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xE3,0x18,0xE7,0x39,0xC7,0x39,0xE3,0x18,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0xE7,0x39,0xA6,0x31,0x04,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0x28,0x42,0x65,0x29,0xA2,0x10,0x41,0x08,0x24,0x29,0x04,0x21,0x41,0x08,0xC3,0x18,0xA6,0x31,0x28,0x42,0x45,0x29,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x04,0x21,0xA6,0x31,0xC7,0x39,0xC3,0x18,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x87,0x59,0x51,0xFB,0x51,0xFB,0x51,0xFB,0x51,0xFB,0x46,0x61,0x00,0x00,0xA8,0x79,0x51,0xFB,0x51,0xFB,0x51,0xFB,0x51,0xFB,0xA8,0x79,0x41,0x08,0x04,0x21,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x24,0x21,0x45,0x29,0x61,0x08,0x20,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,
-	0x20,0x00,0x20,0x00,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0xA2,0x10,0x00,0x00,0x61,0x08,0x24,0x21,0xC3,0x18,0x20,0x00,0x61,0x08,0x45,0x29,0x04,0x21,0x41,0x08,0x20,0x00,0x24,0x21,0x04,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,
-	0xA2,0x10,0x45,0x29,0xA2,0x10,0x20,0x00,0x4D,0xBA,0xD1,0xF2,0x09,0x62,0x04,0x21,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x65,0x29,0xA2,0x10,0x61,0x08,0x82,0x10,0x65,0x29,0x65,0x29,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0xC3,0x18,0xA6,0x31,0x45,0x29,0x82,0x10,0x41,0x08,0x04,0x21,
-	0x86,0x31,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x24,0x21,0xE7,0x39,0xE7,0x39,0x24,0x21,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x65,0x29,0xA2,0x10,0x61,0x08,0x82,0x10,0x65,0x29,0x86,0x31,0xA2,0x10,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x8D,0xAA,0x11,0xFB,
-	0x31,0xFB,0x4D,0xBA,0xE4,0x20,0x45,0x29,0x2C,0xAA,0x31,0xFB,0x11,0xFB,0x31,0xFB,0x31,0xFB,0x25,0x49,0xE3,0x18,0xA6,0x31,0x24,0x21,0x82,0x10,0x20,0x00,0xC3,0x18,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x04,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0xE3,0x18,
-	0xE3,0x18,0x41,0x08,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0xE3,0x18,0x61,0x08,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x65,0x29,0xA2,0x10,0x41,0x08,0x82,0x10,0x86,0x31,0x86,0x31,0xC3,0x18,0x6F,0xDA,0xC5,0x48,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0xE7,0x39,0x86,0x31,
-	0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0x08,0x42,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x04,0x21,0xC7,0x39,0xE7,0x39,0xE3,0x18,0x61,0x08,0x20,0x00,0x24,0x29,0x04,0x21,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x04,0x21,0x20,0x00,0x82,0x10,
-	0x04,0x21,0xE7,0x39,0x86,0x31,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x86,0x31,0xE7,0x39,0x45,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x41,0x18,0x62,0x18,0xE3,0x18,0x86,0x31,0xA6,0x31,0xEA,0x89,0xF1,0xFA,0xF1,0xFA,0xF1,0xFA,0xD0,0xF2,0x82,0x18,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0xC3,0x18,0x65,0x29,
-	0x24,0x21,0x41,0x08,0x41,0x08,0xC3,0x18,0x24,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x20,0x00,
-	0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0xA2,0x10,0x65,0x29,0xE3,0x18,0x41,0x08,0x41,0x08,0x45,0x29,0x45,0x29,0xA2,0x10,
-	0x00,0x00,0x00,0x00,0x41,0x08,0x62,0x10,0x48,0x69,0x82,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x65,0x29,0xE7,0x39,0x24,0x29,0xA2,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x65,0x29,0x65,0x29,0x82,0x10,0x61,0x08,0x61,0x08,0xE3,0x18,0x41,0x08,0x61,0x08,0xA2,0x10,0x86,0x31,0x86,0x31,0xC3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0x65,0x29,0x08,0x42,0x65,0x29,0x82,0x10,0x41,0x08,0x45,0x29,0x04,0x21,0x41,0x08,0xA2,0x10,0xA6,0x31,0xE7,0x39,0x24,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0x86,0x31,0x65,0x29,0xA2,0x10,0x41,0x08,0x61,0x08,0xE3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0x65,0x29,0x24,0x21,
-	0xA2,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x08,0xEB,0xA1,0xD0,0xEA,0x90,0xDA,0x87,0x59,0x82,0x10,0x00,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0xA2,0x10,0x24,0x21,0xE3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0x24,0x21,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,
-	0x61,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0x24,0x21,0x24,0x21,0x61,0x08,0x00,0x00,0xC3,0x18,0x04,0x21,0x82,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x65,0x29,0xA6,0x31,0xC3,0x18,0x61,0x08,0x00,0x00,0xA2,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0xC3,0x18,0x61,0x08,
-	0x41,0x08,0xA2,0x10,0x86,0x31,0xA6,0x31,0xC3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0xE3,0x18,0xA6,0x31,0x65,0x29,0x82,0x10,0x41,0x08,0xC3,0x18,0x65,0x29,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0x24,0x21,0xC7,0x39,0xC7,0x39,0x24,0x21,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x82,0x10,
-	0xC3,0x18,0x45,0x29,0x82,0x10,0x41,0x08,0x82,0x10,0x86,0x31,0x86,0x31,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xC3,0x18,0x86,0x31,0x45,0x29,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0xE3,0x18,0x86,0x31,0x24,0x21,0x82,0x10,0x00,0x00,0x41,0x08,
-	0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0x04,0x21,0xE3,0x18,0x20,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x61,0x08,0xE3,0x18,0x82,0x10,0x00,0x00,0x61,0x08,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x61,0x08,0x20,0x00,
-	0x82,0x10,0x65,0x29,0x65,0x29,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0xC7,0x39,0x86,0x31,0x04,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x45,0x29,0xE7,0x39,0x45,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x04,0x21,0xA6,0x31,
-	0xC7,0x39,0xE3,0x18,0x61,0x08,0x20,0x00,0x45,0x29,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x24,0x21,0x24,0x21,0x20,0x00,0x82,0x10,0x04,0x21,0xC7,0x39,0x65,0x29,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x65,0x29,0xC7,0x39,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xE3,0x18,0x86,0x31,0x86,0x31,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x45,0x29,0x04,0x21,0x61,0x08,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,
-	0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x04,0x21,0xC3,0x18,0x20,0x00,0x61,0x08,0x24,0x29,0x45,0x29,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0xA6,0x31,0x24,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x82,0x10,0x04,0x21,0x24,0x29,0x82,0x10,0x41,0x08,0x82,0x10,0x24,0x21,0x41,0x08,0x41,0x08,0x82,0x10,0x65,0x29,0x65,0x29,0xC3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x45,0x29,0xE7,0x39,0x24,0x29,0x82,0x10,0x41,0x08,0x65,0x29,0x45,0x29,0x41,0x08,0x82,0x10,0x65,0x29,0xC7,0x39,0x04,0x21,0xC3,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0x65,0x29,0x45,0x29,0x82,0x10,0x41,0x08,0x82,0x10,0x04,0x21,0x41,0x08,0x41,0x08,0x82,0x10,0x24,0x21,0xC3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x65,0x29,0xC3,0x18,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x24,0x21,0xE3,0x18,0x41,0x08,0x20,0x00,0xA2,0x10,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x20,0x00,0x41,0x08,0x04,0x21,0x04,0x21,0x41,0x08,0x20,0x00,0xC3,0x18,0x04,0x21,0x82,0x10,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x65,0x29,0xC3,0x18,0x41,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x65,0x29,0xA6,0x31,0xE3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x86,0x31,0x65,0x29,0x82,0x10,0x41,0x08,0xC3,0x18,
-	0x65,0x29,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xE3,0x18,0x86,0x31,0x86,0x31,0xE3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x45,0x29,0x82,0x10,0x41,0x08,0x82,0x10,0x65,0x29,0x65,0x29,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x86,0x31,0x24,0x21,
-	0x82,0x10,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x61,0x08,0xC3,0x18,0x45,0x29,0xE3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,
-	0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,
-	0x20,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x24,0x21,0x45,0x29,0x82,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0x86,0x31,0x86,0x31,
-	0xE3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0xA6,0x31,0x45,0x29,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x65,0x29,0xA6,0x31,0xC3,0x18,0x41,0x08,0x41,0x08,0x65,0x29,0x24,0x29,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x45,0x29,0x45,0x29,0x41,0x08,0x41,0x08,
-	0xE3,0x18,0xA6,0x31,0x45,0x29,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x45,0x29,0x86,0x31,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0x65,0x29,0x45,0x29,0xC3,0x18,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,
-	0xE3,0x18,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0xA2,0x10,0x00,0x00,0x41,0x08,0x04,0x21,0x24,0x21,0xA2,0x10,
-	0x41,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x65,0x29,0x24,0x21,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0x24,0x21,0x82,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0xA2,0x10,0x65,0x29,0x65,0x29,0xE3,0x18,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xC3,0x18,0x04,0x21,0xA6,0x31,0xC3,0x18,0x41,0x08,0x82,0x10,0x86,0x31,0x65,0x29,0x82,0x10,0x41,0x08,0x04,0x21,0x86,0x31,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x65,0x29,0x24,0x21,0x82,0x10,0x20,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x04,0x21,0xA2,0x10,
-	0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x04,0x21,0x24,0x29,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0xC3,0x18,0x41,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,
-	0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,0xC3,0x18,0xE3,0x18,0x61,0x08,0x20,0x00,0x82,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x45,0x29,0xC3,0x18,0x61,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,
-	0x00,0x00,0x82,0x10,0x24,0x21,0x86,0x31,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0x65,0x29,0x24,0x21,0x61,0x08,0x41,0x08,0x04,0x21,0x86,0x31,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,
-	0x04,0x21,0x65,0x29,0xA2,0x10,0x41,0x08,0x61,0x08,0x24,0x29,0x24,0x21,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0xE3,0x18,0x65,0x29,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0x24,0x21,0xA2,0x10,0x61,0x08,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x00,0x00,
-	0x82,0x10,0xE3,0x18,0x24,0x21,0xA2,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x45,0x29,0x65,0x29,0xC3,0x18,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x86,0x31,0x45,0x29,0xC3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0x24,0x21,
-	0x65,0x29,0x61,0x08,0x41,0x08,0xA2,0x10,0x86,0x31,0x45,0x29,0xE3,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0x65,0x29,0x65,0x29,0x82,0x10,0x41,0x08,0x82,0x10,0x65,0x29,0x04,0x21,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x45,0x29,0x65,0x29,0xC3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xC3,0x18,0x24,0x29,0x04,0x21,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0x45,0x29,0x24,0x21,0xA2,0x10,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x20,0x00,0x82,0x10,0xE3,0x18,0x24,0x29,0xA2,0x10,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x65,0x29,0x65,0x29,0xE3,0x18,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x24,0x21,0x41,0x08,0x41,0x08,0xC3,0x18,0x86,0x31,0x65,0x29,0xC3,0x18,0x20,0x00,0x82,0x10,0x24,0x21,0x82,0x10,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x65,0x29,0x24,0x29,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x04,0x21,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,
-	0x00,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x00,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0xA2,0x10,0x24,0x21,0xE3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x45,0x29,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0x24,0x21,
-	0x86,0x31,0x04,0x21,0xA2,0x10,0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0x04,0x21,0x65,0x29,0xE3,0x18,0x82,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x24,0x21,0x82,0x10,
-	0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xE3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x82,0x10,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x04,0x21,0x45,0x29,
-	0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x65,0x29,0x24,0x21,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x00,0x00,0x82,0x10,0xE3,0x18,0x65,0x29,0x24,0x21,0x82,0x10,0x20,0x00,0x04,0x21,0xE3,0x18,0x20,0x00,0x82,0x10,0x45,0x29,0x65,0x29,0xC3,0x18,0x61,0x08,
-	0x00,0x00,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0x24,0x21,0x24,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0xE3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x04,0x21,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x24,0x29,0xE3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xC3,0x18,0x45,0x29,0x45,0x29,0xC3,0x18,0x41,0x08,0x20,0x00,
-	0xA2,0x10,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x24,0x21,0x24,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x00,0x00,0x61,0x08,0xA2,0x10,0x45,0x29,0x04,0x21,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0x04,0x21,0xA2,0x10,
-	0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xC3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x04,0x21,0xE3,0x18,0xA2,0x10,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x04,0x21,
-	0x61,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x04,0x21,0x04,0x21,0x82,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0x04,0x21,0x45,0x29,0xA2,0x10,0x41,0x08,0x41,0x08,0x04,0x21,0x04,0x21,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x04,0x21,0x41,0x08,0x41,0x08,
-	0xC3,0x18,0x45,0x29,0xE3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xE3,0x18,0x41,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,
-	0x20,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x41,0x08,0xA2,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x04,0x21,0xC3,0x18,0x41,0x08,0x41,0x08,0xC3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0x82,0x10,0x41,0x08,0x82,0x10,0x45,0x29,0x24,0x21,0x82,0x10,0x20,0x00,0xA2,0x10,0x04,0x21,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x82,0x10,0x04,0x21,0xA2,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,
-	0x41,0x08,0x82,0x10,0xC3,0x18,0x61,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x10,0xA2,0x10,0x04,0x21,0xE3,0x18,0x82,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0xE3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0x24,0x21,0xC3,0x18,0x82,0x10,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0xA2,0x10,
-	0xE3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0x04,0x21,0xA2,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,
-	0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x24,0x21,0xE3,0x18,0x41,0x08,0x41,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x41,0x08,0x04,0x21,0x24,0x21,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0x04,0x21,0xE3,0x18,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xA2,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x82,0x10,0xA2,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,0x04,0x21,0x82,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x82,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x04,0x21,0xC3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,
-	0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x82,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,
-	0x04,0x21,0x82,0x10,0x41,0x08,0x61,0x08,0x04,0x21,0xE3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xE3,0x18,0xE3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x04,0x21,0xA2,0x10,0x82,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,
-	0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,
-	0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0xC3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0xA2,0x10,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,
-	0xE3,0x18,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,
-	0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0xC3,0x18,0xC3,0x18,0x61,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x82,0x10,
-	0xC3,0x18,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x61,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,
-	0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x61,0x08,
-	0xA2,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0xA2,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_79_2_dial_img_0_404_data_0, "face_79_2_dial_img_0_404_data_0.bin");
         
 
 
@@ -1826,7 +21,7 @@ const lv_img_dsc_t face_79_2_dial_img_0_404_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 240,
-    .data_size = sizeof(face_79_2_dial_img_0_404_data_0),
+    .data_size = 115200,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_79_2_dial_img_0_404_data_0};
 
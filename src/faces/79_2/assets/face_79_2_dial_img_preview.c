@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: 79_2
-
-#include "../79_2.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_79_2_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,
-	0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,
-	0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xC2,0x10,0x40,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x40,0x00,0x41,0x08,0x40,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,
-	0x00,0x00,0x61,0x08,0xC2,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,0x40,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x41,0x08,0x40,0x00,0x40,0x00,0x41,0x08,0x40,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x40,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0x82,0x10,
-	0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x81,0x08,0xC3,0x18,
-	0x61,0x08,0x20,0x00,0x40,0x00,0x40,0x00,0xA2,0x10,0xC2,0x10,0x61,0x08,0x40,0x00,0x40,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x40,0x00,0x61,0x08,0x40,0x00,0x82,0x10,0xE3,0x18,0x40,0x00,0x41,0x08,0xC2,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0xC2,0x10,0xC3,0x18,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x61,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x20,0x00,0x20,0x00,
-	0x0C,0x63,0x92,0x94,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x44,0x21,0x41,0x08,0xE3,0x18,0xC3,0x18,0x20,0x00,0x61,0x08,0x8A,0x52,0xAA,0x52,0x41,0x08,0x20,0x00,0x61,0x08,0xE3,0x18,0x82,0x10,0xCB,0x5A,0xCB,0x5A,0x41,0x08,0x82,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0xE3,0x18,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0xA2,0x10,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0xC2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x82,0x10,0x61,0x08,0x40,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0xE3,0x18,
-	0x92,0x94,0xCA,0x52,0xC6,0x31,0xA6,0x31,0x07,0x3A,0x44,0x21,0x61,0x08,0x20,0x00,0x40,0x00,0x82,0x10,0xE3,0x18,0xEB,0x5A,0xEB,0x5A,0xE3,0x18,0xC2,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x6D,0x6B,0x6D,0x6B,0x40,0x00,0x82,0x10,0xE3,0x18,0xA2,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0xC3,0x18,0xC3,0x18,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xE3,0x18,0x82,0x10,0x20,0x00,0x41,0x08,
-	0x71,0x8C,0x28,0x42,0x03,0x19,0x81,0x08,0x20,0x00,0x40,0x00,0xE3,0x18,0x28,0x42,0x0C,0x63,0x71,0x8C,0x61,0x08,0x86,0x31,0x08,0x42,0x82,0x10,0x81,0x10,0x49,0x4A,0x51,0x8C,0xCB,0x5A,0x0F,0x7C,0x6D,0x6B,0x40,0x00,0xC3,0x18,0xEB,0x5A,0x10,0x84,0xAE,0x73,0xA6,0x31,0x82,0x10,0x89,0x4A,0x24,0x21,0x61,0x08,0xE3,0x18,0xAA,0x52,
-	0x04,0x21,0x20,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x82,0x10,0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0xC2,0x10,0x61,0x08,0x40,0x00,0xC2,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0x24,0x21,
-	0xB2,0x94,0xEF,0x7B,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x44,0x21,0xC7,0x39,0xDA,0xD6,0x8D,0x6B,0x28,0x42,0x24,0x21,0x4D,0x6B,0x71,0x8C,0xA2,0x10,0x49,0x4A,0xD2,0x94,0x65,0x29,0xA6,0x31,0x38,0xC6,0x6D,0x6B,0x41,0x08,0x91,0x8C,0x30,0x84,0xC7,0x39,0x69,0x4A,0x55,0xAD,0x40,0x00,0x6D,0x6B,0xD2,0x94,0x41,0x08,0xC2,0x10,0x17,0xBE,
-	0xC3,0x18,0xE3,0x18,0xE3,0x18,0x40,0x00,0x20,0x00,0x20,0x00,0x81,0x08,0xC2,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0x61,0x08,0x00,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x81,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0x24,0x21,0x82,0x10,0x20,0x00,0x41,0x08,
-	0xD2,0x94,0x34,0xA5,0x71,0x8C,0x91,0x8C,0x71,0x8C,0x04,0x21,0xC7,0x39,0x54,0xA5,0x24,0x21,0x61,0x08,0x41,0x08,0x2C,0x63,0x91,0x8C,0x03,0x19,0x71,0x8C,0x48,0x42,0x45,0x29,0xE3,0x18,0x8E,0x73,0x6D,0x6B,0x81,0x08,0x86,0x31,0xC7,0x39,0x28,0x42,0xCB,0x5A,0xDA,0xD6,0x82,0x10,0x82,0x10,0x38,0xC6,0x24,0x21,0xAA,0x52,0x30,0x84,
-	0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x03,0x19,0xA2,0x10,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x03,0x19,0x82,0x10,0x40,0x00,0xC3,0x18,0x61,0x08,0x40,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0x45,0x29,
-	0x71,0x8C,0xA6,0x31,0x61,0x08,0x61,0x08,0x04,0x21,0x04,0x21,0xC7,0x39,0x71,0x8C,0x40,0x00,0x82,0x10,0x65,0x29,0x6D,0x6B,0x71,0x8C,0x82,0x10,0x71,0x8C,0xA6,0x31,0xA2,0x10,0x41,0x08,0x0B,0x5B,0x6D,0x6B,0x41,0x08,0x92,0x94,0x51,0x8C,0x89,0x4A,0x69,0x4A,0xDA,0xD6,0x40,0x00,0x03,0x19,0xCF,0x7B,0x28,0x42,0x91,0x8C,0xC6,0x31,
-	0x41,0x08,0x24,0x21,0x04,0x21,0x41,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0xC2,0x18,0x41,0x08,0x41,0x08,0x03,0x19,0x82,0x10,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0xC3,0x18,0x40,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0x61,0x08,0x82,0x10,0x24,0x21,0x82,0x10,0x00,0x00,0x20,0x00,
-	0x71,0x8C,0x89,0x4A,0x45,0x29,0x82,0x10,0x41,0x08,0x41,0x08,0xC7,0x39,0x71,0x8C,0x44,0x21,0x40,0x00,0x41,0x08,0x2C,0x63,0x91,0x94,0x24,0x21,0x8E,0x73,0x0B,0x5B,0x65,0x29,0x03,0x19,0xD3,0x9C,0x6D,0x6B,0xE3,0x18,0x79,0xCE,0x81,0x08,0x40,0x00,0x49,0x4A,0x3C,0xE7,0xA2,0x10,0x41,0x08,0xC7,0x39,0xF3,0x9C,0x17,0xBE,0x65,0x29,
-	0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x03,0x19,0xA2,0x10,0x41,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0xC2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0x40,0x00,0x41,0x08,0x44,0x21,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x03,0x19,0x65,0x29,
-	0x71,0x8C,0xA6,0x31,0x20,0x00,0x81,0x08,0x45,0x29,0x24,0x21,0xE7,0x39,0x71,0x8C,0x20,0x00,0xA2,0x10,0x86,0x31,0x6D,0x6B,0x71,0x8C,0x82,0x10,0xE3,0x18,0x95,0xAD,0x75,0xAD,0x95,0xAD,0x51,0x8C,0x6D,0x6B,0x61,0x08,0x71,0x8C,0xD7,0xBD,0x75,0xAD,0xD2,0x94,0xDB,0xDE,0x40,0x00,0x04,0x21,0x86,0x31,0x38,0xC6,0xEF,0x7B,0x20,0x00,
-	0x40,0x00,0x44,0x21,0x45,0x29,0x61,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x81,0x08,0x24,0x21,0x82,0x10,0x20,0x00,0xC3,0x18,0x40,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0xE3,0x20,0x41,0x08,0x61,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x41,0x08,0x20,0x00,0xC3,0x18,0x44,0x21,0x82,0x10,0x61,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,
-	0x61,0x08,0x45,0x29,0x65,0x29,0x61,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x85,0x29,0x44,0x21,0x40,0x00,0x61,0x08,0x20,0x00,0xA2,0x10,0x45,0x29,0x81,0x08,0xA2,0x10,0x45,0x29,0xE3,0x18,0x82,0x10,0x45,0x29,0xA2,0x10,0x41,0x08,0x04,0x21,0xC3,0x18,0x03,0x19,0xA6,0x31,0xC3,0x18,0x40,0x00,0xC3,0x18,0x38,0xC6,0x04,0x21,0x85,0x29,
-	0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0xC2,0x10,0x61,0x08,0x61,0x08,0x04,0x21,0x04,0x21,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0xC2,0x10,0xA2,0x10,0x40,0x00,0xC3,0x18,0x81,0x08,0x20,0x00,0xA2,0x10,0x40,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x81,0x08,0x41,0x08,0x61,0x08,0x24,0x21,0xA2,0x10,0x40,0x00,0x24,0x21,0xC3,0x18,0x00,0x00,0x20,0x00,0x41,0x08,0xC2,0x10,0xC2,0x10,0x61,0x08,0xE3,0x18,0x45,0x29,
-	0xA2,0x10,0x41,0x08,0x40,0x08,0x82,0x10,0x85,0x29,0x24,0x29,0x82,0x10,0x41,0x08,0x41,0x08,0xC2,0x10,0xA6,0x31,0x03,0x21,0x82,0x10,0xA2,0x10,0x82,0x10,0x61,0x08,0xC3,0x18,0x81,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0xE3,0x18,0xA6,0x31,0x03,0x19,0x40,0x00,0x41,0x08,0x40,0x00,0x24,0x21,0x28,0x42,0x71,0x8C,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x24,0x21,0x24,0x21,0x61,0x08,0x82,0x10,0xC3,0x18,0x81,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x24,0x21,0x61,0x08,0x61,0x08,0x24,0x21,0x82,0x10,0x20,0x00,0x81,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x00,
-	0x00,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x40,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x03,0x19,0x61,0x08,0x40,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x04,0x21,0x61,0x08,0xC3,0x18,0x86,0x31,0xA2,0x10,0x40,0x08,0x81,0x08,0x81,0x08,0xC2,0x10,0x82,0x10,
-	0x82,0x10,0x65,0x29,0x65,0x29,0x61,0x08,0x40,0x00,0x20,0x00,0xA2,0x10,0xA6,0x31,0x45,0x29,0x41,0x08,0x81,0x08,0x61,0x08,0xA2,0x10,0x24,0x21,0x61,0x08,0xA2,0x10,0xA6,0x31,0xE3,0x18,0x82,0x10,0x24,0x21,0x82,0x10,0x41,0x08,0xA2,0x10,0x41,0x08,0xE3,0x18,0xC6,0x31,0xC2,0x10,0x20,0x00,0xC3,0x18,0xC3,0x18,0xE3,0x18,0x65,0x29,
-	0x81,0x08,0x81,0x08,0xE3,0x18,0x81,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x65,0x29,0x24,0x21,0x41,0x08,0xC2,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x40,0x00,0xE3,0x18,0x61,0x08,0x61,0x08,0xE3,0x18,0x41,0x08,0x61,0x08,0xA2,0x10,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x61,0x08,0x40,0x00,0x03,0x19,0xA2,0x10,0x61,0x08,0x45,0x29,0xC3,0x18,0x20,0x00,0x82,0x10,0x81,0x08,0x41,0x08,0x41,0x08,0x40,0x00,0x44,0x29,0x45,0x29,0x81,0x08,0x82,0x10,0xC3,0x18,
-	0x81,0x08,0x82,0x10,0x61,0x08,0xA2,0x10,0x85,0x29,0x24,0x21,0x81,0x08,0x61,0x08,0x61,0x08,0xC2,0x10,0x86,0x31,0xE3,0x18,0x82,0x10,0xE3,0x18,0xC2,0x10,0x61,0x08,0xA2,0x10,0x61,0x08,0xA2,0x10,0x03,0x19,0x61,0x08,0xC2,0x10,0x86,0x31,0x03,0x19,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0xA6,0x31,0xC3,0x18,0x41,0x08,0xA2,0x10,
-	0x61,0x08,0xC2,0x10,0xE3,0x18,0x61,0x08,0x03,0x19,0x65,0x29,0x61,0x08,0x20,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0xC2,0x10,0x65,0x29,0x61,0x08,0x81,0x08,0x24,0x21,0x61,0x08,0x40,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x00,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xE3,0x18,0x41,0x08,0x82,0x10,0xC2,0x10,0x41,0x08,0xC3,0x18,0x81,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x86,0x31,0x82,0x10,0x81,0x08,0x24,0x21,0x82,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0x45,0x29,0x24,0x21,
-	0x81,0x08,0xC3,0x18,0xC3,0x18,0x81,0x08,0xA2,0x10,0x81,0x10,0x82,0x10,0x65,0x29,0xE3,0x18,0x61,0x08,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xE3,0x18,0x61,0x08,0xC2,0x18,0xC7,0x39,0x03,0x19,0x61,0x08,0xC3,0x18,0x81,0x08,0x82,0x10,0x04,0x21,0x82,0x10,0xC3,0x18,0x85,0x29,0xA2,0x10,0x61,0x08,0xE3,0x18,0x81,0x08,0xC2,0x10,0xE3,0x18,
-	0x82,0x10,0x04,0x21,0x65,0x29,0xA2,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x04,0x21,0xC3,0x18,0x61,0x08,0x65,0x29,0xE3,0x18,0x41,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0x20,0x00,0xA2,0x10,0xC2,0x10,0x20,0x00,0xC3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x03,0x19,0x03,0x19,0x41,0x08,0x04,0x21,0xE3,0x18,0x41,0x08,0xA2,0x18,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0xC3,0x18,0x61,0x08,0x44,0x21,0xA6,0x31,0x82,0x10,0x20,0x00,0x20,0x00,
-	0x82,0x10,0x44,0x21,0xE3,0x18,0x81,0x08,0x24,0x21,0xC3,0x18,0x81,0x08,0xC2,0x10,0x81,0x08,0x82,0x10,0x45,0x29,0xA2,0x10,0xA2,0x10,0x65,0x29,0xE3,0x18,0x41,0x08,0x61,0x08,0x40,0x00,0xC2,0x10,0x65,0x29,0x82,0x10,0x82,0x10,0x45,0x29,0xC3,0x18,0x82,0x10,0xC2,0x10,0x61,0x08,0xA2,0x10,0x44,0x21,0x82,0x10,0xA2,0x10,0x44,0x21,
-	0xA2,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x45,0x29,0x65,0x29,0x81,0x08,0xC3,0x18,0xE3,0x18,0x61,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0xC3,0x18,0x65,0x29,0x61,0x08,0xA2,0x10,0x04,0x21,0x20,0x00,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,
-	0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0xC2,0x10,0x20,0x00,0xA2,0x10,0x40,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x86,0x31,0x82,0x10,0x82,0x10,0x65,0x29,0xA2,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0xC2,0x10,0x81,0x08,0x81,0x08,0x65,0x29,0x65,0x29,
-	0x81,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x85,0x29,0xE3,0x18,0x81,0x08,0xC3,0x18,0x81,0x08,0xA2,0x10,0x65,0x29,0xE3,0x18,0x82,0x10,0x81,0x08,0x41,0x08,0xE3,0x18,0xE7,0x39,0x24,0x21,0x61,0x08,0x81,0x08,0x61,0x08,0xC2,0x10,0x85,0x29,0xC2,0x10,0x82,0x10,0xC3,0x18,0x61,0x08,0xC3,0x18,0x85,0x29,0xE3,0x18,0x41,0x08,0x61,0x08,
-	0x41,0x08,0x44,0x21,0xC6,0x31,0xA2,0x10,0x41,0x08,0xC3,0x18,0x61,0x08,0x61,0x08,0x40,0x00,0x81,0x08,0x65,0x29,0xA2,0x10,0x82,0x10,0x65,0x29,0xE3,0x18,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x82,0x10,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x03,0x19,0x61,0x08,0x61,0x08,0x65,0x29,0x61,0x08,0xA2,0x10,0x45,0x29,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x40,0x00,0x41,0x08,0xC2,0x10,0x82,0x10,0x20,0x00,0x24,0x21,0xA6,0x31,0x81,0x08,0xA2,0x10,0xE3,0x18,0x61,0x08,0x61,0x08,0x41,0x08,
-	0x82,0x10,0xC7,0x39,0x65,0x29,0x61,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0x86,0x31,0xE3,0x18,0x61,0x08,0xA2,0x10,0x61,0x08,0xC2,0x10,0xC7,0x39,0x24,0x21,0x40,0x00,0x41,0x08,0x20,0x00,0x03,0x19,0xC7,0x39,0xC3,0x18,0x41,0x08,0xA2,0x10,0x61,0x08,0xC3,0x18,0x85,0x29,0xA2,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x24,0x21,0x07,0x3A,
-	0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0x86,0x31,0x41,0x08,0x61,0x08,0xA2,0x10,0x81,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x04,0x21,0xE3,0x18,0x41,0x08,0x44,0x21,0xC2,0x10,0x41,0x08,0x03,0x19,0x40,0x00,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x61,0x08,
-	0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x85,0x29,0xC2,0x10,0x81,0x08,0x85,0x29,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0xA6,0x31,0x65,0x29,0x82,0x10,0xC3,0x18,0xE3,0x18,
-	0xA2,0x10,0x41,0x08,0x20,0x00,0xC2,0x10,0xC7,0x39,0x45,0x29,0x61,0x08,0x81,0x08,0x41,0x08,0xC2,0x18,0xC7,0x39,0x44,0x21,0x61,0x08,0x61,0x08,0x20,0x00,0xE3,0x18,0x07,0x3A,0x24,0x21,0x41,0x08,0x41,0x08,0x41,0x08,0xE3,0x18,0xE7,0x39,0x24,0x21,0x20,0x00,0x61,0x08,0x41,0x08,0x04,0x21,0x07,0x3A,0xE3,0x18,0x20,0x00,0x40,0x00,
-	0x81,0x08,0xE3,0x18,0x03,0x19,0x81,0x08,0xE3,0x18,0xA6,0x31,0x82,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x86,0x31,0xA2,0x10,0x82,0x10,0xA6,0x31,0xA2,0x10,0x61,0x08,0x03,0x19,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x81,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x61,0x08,
-	0x40,0x00,0xC3,0x18,0x20,0x00,0x03,0x19,0xA2,0x10,0x82,0x10,0x24,0x21,0x41,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x04,0x21,0x81,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0xC2,0x10,0xC2,0x10,0x20,0x00,0x24,0x21,0xC6,0x31,0xA2,0x10,0xA2,0x10,0x65,0x29,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,0x24,0x21,0xC2,0x10,
-	0x82,0x10,0x65,0x29,0x44,0x21,0x41,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0xE7,0x39,0x44,0x21,0x40,0x00,0x40,0x00,0x20,0x00,0xE3,0x18,0xE7,0x39,0x24,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0x24,0x21,0x07,0x3A,0x04,0x21,0x41,0x08,0x40,0x00,0x20,0x00,0x03,0x19,0x07,0x3A,0xE3,0x18,0x41,0x08,0x61,0x08,0x20,0x00,0x04,0x21,0x86,0x31,
-	0x82,0x10,0x82,0x10,0x45,0x29,0xC3,0x18,0x20,0x00,0x20,0x00,0x41,0x08,0x44,0x21,0xE3,0x18,0x61,0x08,0x65,0x29,0x45,0x29,0x41,0x08,0xA2,0x10,0xC2,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x03,0x19,0x40,0x00,0xA2,0x10,0x04,0x21,0x41,0x08,0xE3,0x18,0x82,0x10,0x41,0x08,0x04,0x21,0x20,0x00,0xA2,0x10,
-	0x81,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x03,0x19,0x40,0x00,0xA2,0x10,0x44,0x21,0x61,0x08,0x24,0x21,0x85,0x29,0x61,0x08,0xE3,0x18,0xC2,0x10,0x20,0x00,0x81,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x40,0x00,0x24,0x29,0x04,0x21,0x81,0x08,0x45,0x29,0x86,0x31,0x41,0x08,0x41,0x08,0x41,0x08,
-	0xA2,0x10,0x44,0x21,0xA2,0x10,0xA2,0x10,0x65,0x29,0xE3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0xC2,0x10,0xE7,0x39,0x24,0x21,0x61,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0xA6,0x31,0x03,0x19,0x61,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0xE7,0x39,0x04,0x21,0x40,0x00,0x40,0x00,0x41,0x08,0xC2,0x10,0x86,0x31,0xC2,0x10,0xA2,0x10,0x65,0x29,
-	0x82,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0x24,0x21,0x65,0x29,0xA2,0x10,0xE3,0x18,0xA6,0x31,0x61,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0xA2,0x10,0x24,0x21,0x61,0x08,0x03,0x19,0x45,0x29,0x61,0x08,0x24,0x21,0x03,0x19,0x20,0x00,0xE3,0x18,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x40,0x00,0x41,0x08,0x61,0x08,0x40,0x00,0xA2,0x10,
-	0x20,0x00,0xC3,0x18,0x20,0x00,0x61,0x08,0xC2,0x10,0x00,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0x40,0x00,0x61,0x08,0x24,0x29,0x61,0x08,0xC2,0x10,0xE7,0x39,0xA2,0x10,0x61,0x08,0x65,0x29,0x82,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0xE3,0x18,0x61,0x08,0x82,0x10,0xC7,0x39,0x45,0x29,
-	0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0xE3,0x18,0x82,0x10,0xA2,0x10,0xA6,0x31,0x24,0x21,0x41,0x08,0x61,0x08,0x41,0x08,0xE3,0x18,0xC6,0x31,0x04,0x21,0x61,0x08,0xA2,0x10,0x61,0x08,0xE3,0x18,0xC6,0x31,0x04,0x21,0x41,0x08,0x81,0x08,0x41,0x08,0x03,0x19,0xA6,0x31,0xA2,0x10,0x61,0x08,0xE3,0x18,0xC3,0x18,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x24,0x21,0xE7,0x39,0xA2,0x10,0x41,0x08,0xE3,0x18,0xA2,0x10,0x41,0x08,0x40,0x00,0x82,0x10,0x44,0x21,0x82,0x10,0xA2,0x10,0xC7,0x39,0x24,0x21,0x40,0x00,0x04,0x21,0xA2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xC2,0x10,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x40,0x00,
-	0x61,0x08,0xC3,0x18,0x41,0x08,0x24,0x21,0x61,0x08,0xA2,0x10,0x45,0x29,0x41,0x08,0x24,0x21,0xC3,0x18,0x41,0x08,0x45,0x29,0x61,0x08,0x40,0x00,0xC3,0x18,0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x44,0x21,0x65,0x29,0x81,0x08,0x04,0x21,0xC6,0x31,0x81,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,
-	0xA2,0x10,0xE7,0x39,0x65,0x29,0x41,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x44,0x21,0xA2,0x10,0xA2,0x10,0x24,0x21,0xC3,0x18,0xA2,0x10,0x04,0x21,0x82,0x10,0x82,0x10,0x03,0x19,0xA2,0x10,0xA2,0x10,0x04,0x21,0x81,0x08,0xA2,0x10,0x24,0x21,0xC2,0x10,0xA2,0x10,0x44,0x29,0xA2,0x10,0x41,0x08,0xA2,0x10,0x20,0x00,0x24,0x21,0x08,0x42,
-	0xC2,0x10,0x20,0x00,0x81,0x08,0xA2,0x10,0x81,0x08,0x61,0x08,0x41,0x08,0x86,0x31,0x65,0x29,0x81,0x08,0x04,0x21,0x45,0x29,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0xC2,0x10,0x61,0x08,0x41,0x08,0x24,0x21,0x61,0x08,0xA2,0x10,0x65,0x29,0x61,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x24,0x21,0x41,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x61,0x08,0x40,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0xC2,0x10,0x20,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x85,0x29,0x44,0x21,0x61,0x08,0x65,0x29,0x04,0x21,0x41,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0xC2,0x10,0x61,0x08,0x61,0x08,0xC6,0x31,0xA6,0x31,0x81,0x08,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0xE7,0x39,0x04,0x21,0x61,0x08,0x82,0x10,0x61,0x08,0xA2,0x10,0x24,0x21,0xC3,0x18,0xA2,0x10,0x24,0x21,0x82,0x10,0xA2,0x10,0x45,0x29,0xC3,0x18,0x81,0x08,0x24,0x21,0x82,0x10,0xA2,0x10,0x24,0x21,0xC3,0x18,0x82,0x10,0x82,0x10,0x41,0x08,0xC3,0x18,0x07,0x3A,0xE3,0x18,0x20,0x00,0x81,0x08,
-	0x41,0x08,0xC2,0x10,0x04,0x21,0x61,0x08,0x03,0x19,0xE7,0x39,0xA2,0x10,0x41,0x08,0xE3,0x18,0xC2,0x10,0x20,0x00,0x20,0x00,0x82,0x10,0xE3,0x20,0x41,0x08,0xC3,0x18,0xC7,0x39,0xA2,0x10,0xC3,0x18,0xA6,0x31,0x61,0x08,0xC2,0x10,0xE3,0x20,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x61,0x08,0x41,0x08,0x40,0x00,0x41,0x08,0x40,0x00,
-	0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0xC3,0x18,
-	0x20,0x00,0x03,0x21,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0xC3,0x18,0x61,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x45,0x29,0x41,0x08,0xE3,0x18,0xE7,0x39,0x82,0x10,0xC2,0x10,0xA6,0x31,0x82,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0xC6,0x31,0x04,0x21,
-	0x82,0x10,0x04,0x21,0x04,0x21,0x61,0x08,0x20,0x00,0x20,0x00,0xE3,0x18,0xE7,0x39,0x44,0x21,0x41,0x08,0x81,0x08,0x41,0x08,0xE3,0x18,0xA6,0x31,0x04,0x21,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0xC6,0x31,0xE3,0x18,0x41,0x08,0x82,0x10,0x20,0x00,0x04,0x21,0x08,0x42,0xE3,0x18,0x20,0x00,0x41,0x08,0x61,0x08,0xE3,0x18,0x24,0x21,
-	0x61,0x08,0xC3,0x18,0xE7,0x39,0xC3,0x18,0x20,0x00,0x41,0x08,0x82,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0x85,0x29,0xC2,0x18,0xA2,0x10,0xC7,0x39,0x24,0x21,0x41,0x08,0x03,0x19,0xA2,0x10,0x20,0x00,0x61,0x08,0x81,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0x40,0x00,0xC3,0x18,0x20,0x00,0x81,0x08,0xA2,0x10,0x20,0x00,0xE3,0x18,
-	0x40,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0xC2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x41,0x08,
-	0x61,0x08,0xA2,0x10,0x20,0x00,0x04,0x21,0x40,0x00,0xE3,0x18,0x45,0x29,0x61,0x08,0x85,0x29,0xE3,0x18,0x82,0x10,0xC6,0x31,0x81,0x08,0x61,0x08,0x24,0x21,0x41,0x08,0x20,0x00,0x82,0x10,0x81,0x08,0x61,0x08,0x20,0x00,0xE3,0x18,0xC3,0x18,0x41,0x08,0x65,0x29,0x86,0x31,0x81,0x08,0xC2,0x10,0x44,0x21,0x41,0x08,0x40,0x00,0x20,0x00,
-	0xA2,0x18,0x45,0x29,0xC3,0x18,0x81,0x08,0x85,0x29,0x24,0x21,0x40,0x00,0x82,0x10,0x20,0x00,0xC2,0x10,0x07,0x3A,0x24,0x21,0x41,0x08,0x20,0x00,0x20,0x00,0xC2,0x10,0xE7,0x39,0x04,0x21,0x41,0x08,0x40,0x00,0x20,0x00,0xC3,0x18,0x07,0x3A,0x24,0x21,0x20,0x00,0x82,0x10,0x40,0x00,0xC2,0x18,0xA6,0x31,0xA2,0x10,0xA2,0x10,0x65,0x29,
-	0xA2,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0xE3,0x18,0xE3,0x18,0x81,0x08,0x65,0x29,0xE7,0x39,0x61,0x08,0x82,0x10,0xE3,0x18,0x61,0x08,0x61,0x08,0x61,0x08,0x81,0x08,0x40,0x00,0x20,0x00,0xE3,0x18,0x82,0x10,0x61,0x08,0xA6,0x31,0xA2,0x10,0x82,0x10,0xA6,0x31,0x81,0x08,0xE3,0x18,0xE3,0x18,0x40,0x00,0x24,0x21,0x40,0x00,0x61,0x08,
-	0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,
-	0x41,0x08,0x40,0x00,0x41,0x08,0x41,0x08,0x40,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0xC2,0x10,0x20,0x00,0xC2,0x10,0x03,0x19,0x41,0x08,0x65,0x29,0x65,0x29,0x61,0x08,0x86,0x31,0x24,0x21,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0x41,0x08,0xC6,0x31,0x44,0x21,0xA2,0x10,0x24,0x21,0x24,0x21,
-	0x61,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x65,0x29,0xA2,0x10,0xA2,0x10,0x65,0x29,0x04,0x21,0x41,0x08,0x20,0x00,0x20,0x00,0xE3,0x18,0x07,0x3A,0x24,0x21,0x41,0x08,0x20,0x00,0x20,0x00,0x03,0x19,0x08,0x42,0x04,0x21,0x20,0x00,0x20,0x00,0x61,0x08,0xE3,0x18,0x85,0x29,0xA2,0x10,0x81,0x08,0x65,0x29,0xC3,0x18,0x20,0x00,0x61,0x08,
-	0x20,0x00,0x03,0x19,0x65,0x29,0xA2,0x10,0xE3,0x18,0xE7,0x39,0x82,0x10,0x20,0x00,0x81,0x08,0x81,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x03,0x19,0x41,0x08,0xC2,0x10,0xE7,0x39,0xA2,0x10,0xC3,0x18,0x86,0x31,0x61,0x08,0xE3,0x18,0x24,0x21,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x40,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0xC3,0x18,0x40,0x00,0xC2,0x10,0x61,0x08,0x81,0x08,0xE3,0x18,
-	0x41,0x08,0x45,0x29,0x41,0x08,0xC3,0x18,0x04,0x21,0x20,0x00,0xE3,0x18,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x81,0x08,0x40,0x00,0xA2,0x10,0xE3,0x18,0x41,0x08,0xC2,0x10,0xA6,0x31,0x81,0x08,0xE3,0x18,0x08,0x42,0xA2,0x10,0x61,0x08,0xE3,0x18,0x81,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x04,0x21,0x81,0x08,
-	0xA2,0x10,0xC7,0x39,0x65,0x29,0x41,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,0x81,0x08,0x82,0x10,0xA6,0x31,0x04,0x21,0x40,0x00,0x82,0x10,0x41,0x08,0xE3,0x18,0xE7,0x39,0x24,0x21,0x20,0x00,0x82,0x10,0x41,0x08,0xC2,0x10,0xA6,0x31,0xC3,0x18,0x82,0x10,0xE3,0x18,0xC2,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x24,0x21,0x07,0x3A,
-	0xA2,0x10,0x61,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0x40,0x00,0x41,0x08,0xE3,0x18,0xA2,0x10,0x61,0x08,0xA6,0x31,0x03,0x19,0x81,0x08,0x85,0x29,0x04,0x21,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x41,0x08,0x40,0x00,0x04,0x21,0x40,0x00,0xA2,0x10,0xE3,0x18,0x41,0x08,0x24,0x21,
-	0x61,0x08,0xC3,0x18,0xE3,0x18,0x41,0x08,0xE3,0x18,0x20,0x00,0xC2,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0xC3,0x18,0x20,0x00,0xA2,0x10,0x20,0x00,
-	0x82,0x10,0xE3,0x18,0x20,0x00,0x65,0x29,0x82,0x10,0xC3,0x18,0x86,0x31,0x61,0x08,0x65,0x29,0x03,0x19,0x81,0x08,0xA6,0x31,0x82,0x10,0x41,0x08,0x03,0x19,0x41,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x40,0x00,0xC3,0x18,0xA2,0x10,0x61,0x08,0x24,0x21,0xA6,0x31,0x82,0x10,0x04,0x21,0x65,0x29,0x41,0x08,0x41,0x08,0x41,0x08,
-	0xA2,0x10,0xE3,0x18,0x61,0x08,0xA2,0x10,0xE7,0x39,0x44,0x21,0x40,0x00,0x82,0x10,0x61,0x08,0x82,0x10,0x45,0x29,0xA2,0x10,0xC3,0x18,0x45,0x29,0xC3,0x18,0x61,0x08,0xC2,0x10,0x81,0x08,0xC2,0x10,0x45,0x29,0xC3,0x18,0x81,0x08,0x44,0x21,0xA2,0x10,0x61,0x08,0xA2,0x10,0x20,0x00,0xE3,0x18,0x28,0x42,0xE3,0x18,0x61,0x08,0xC3,0x18,
-	0x82,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0xE3,0x18,0x24,0x21,0x82,0x10,0x65,0x29,0xC7,0x39,0x61,0x08,0x61,0x08,0xE3,0x18,0x40,0x00,0x61,0x08,0x81,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0x61,0x08,0x41,0x08,0x86,0x31,0xA2,0x10,0xC2,0x10,0xC7,0x39,0x82,0x10,0x04,0x21,0xE3,0x18,0x61,0x08,0x65,0x29,0x41,0x08,0xA2,0x10,
-	0xE3,0x18,0x20,0x00,0xC2,0x18,0x20,0x00,0x81,0x08,0x40,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x40,0x00,0x40,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x81,0x08,0x41,0x08,0x61,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x85,0x29,0x65,0x29,0x81,0x08,0xA6,0x31,0x03,0x19,0x81,0x08,0x45,0x29,0xC2,0x18,0x00,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x24,0x21,0xC3,0x18,0x61,0x08,0xA6,0x31,0x45,0x29,
-	0x61,0x08,0x81,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x07,0x3A,0x24,0x21,0x41,0x08,0x61,0x08,0x61,0x08,0xC3,0x18,0x04,0x21,0xA2,0x10,0x82,0x10,0x45,0x29,0xA2,0x10,0xA2,0x10,0x04,0x21,0xC3,0x18,0x81,0x08,0x81,0x08,0x61,0x08,0xE3,0x18,0x07,0x3A,0xE3,0x18,0x20,0x00,0x82,0x10,0x81,0x08,0x82,0x10,0x82,0x10,
-	0x41,0x08,0x24,0x21,0x08,0x42,0xA2,0x10,0x82,0x10,0x44,0x21,0x82,0x10,0x41,0x08,0x81,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x65,0x29,0x61,0x08,0xC2,0x10,0x08,0x42,0xA2,0x10,0xE3,0x18,0xA6,0x31,0x20,0x00,0xC3,0x18,0x03,0x19,0x20,0x00,0xC2,0x10,0x82,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0x41,0x08,
-	0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0xE3,0x18,0x61,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0x04,0x21,
-	0x20,0x00,0x24,0x21,0x61,0x08,0x82,0x10,0x03,0x19,0x20,0x00,0xC2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x81,0x08,0x61,0x08,0x61,0x08,0x81,0x08,0x41,0x08,0x61,0x08,0x03,0x19,0x40,0x00,0xC2,0x10,0xC6,0x31,0x81,0x08,0xC3,0x18,0x07,0x3A,0xA2,0x10,0x41,0x08,0x04,0x21,0xA2,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,
-	0xA2,0x10,0xE7,0x39,0x65,0x29,0x41,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0x08,0x42,0x44,0x21,0x40,0x00,0xA2,0x10,0x41,0x08,0xA2,0x10,0xA6,0x31,0x04,0x21,0x40,0x00,0xA2,0x10,0x41,0x08,0xE3,0x18,0x07,0x3A,0x04,0x21,0x41,0x08,0x20,0x00,0x82,0x10,0xC2,0x10,0xA2,0x10,0x41,0x08,0x04,0x21,0x07,0x3A,
-	0xA2,0x10,0x41,0x08,0xC2,0x10,0xA2,0x10,0x40,0x00,0x20,0x00,0x61,0x08,0x03,0x19,0x82,0x10,0x61,0x08,0xE7,0x39,0x04,0x21,0x82,0x10,0xA6,0x31,0x03,0x19,0x20,0x00,0xC3,0x18,0x81,0x08,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x40,0x00,0xA2,0x10,0x61,0x08,0x61,0x08,0x03,0x19,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x24,0x21,
-	0x20,0x00,0x03,0x19,0xC2,0x10,0x61,0x08,0xE3,0x20,0x20,0x00,0xE3,0x18,0x20,0x00,0xA2,0x10,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0xC3,0x18,0x20,0x00,0xA2,0x10,0x61,0x08,
-	0x61,0x08,0x03,0x19,0x20,0x00,0x85,0x29,0xC2,0x10,0xA2,0x10,0xC7,0x39,0x82,0x10,0x24,0x21,0x24,0x21,0x81,0x08,0xA6,0x31,0xC3,0x18,0x40,0x00,0x24,0x21,0x61,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x24,0x21,0x45,0x29,0xA2,0x10,0x24,0x21,0xC6,0x31,0x61,0x08,0x20,0x00,0x82,0x10,
-	0xA2,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0xC7,0x39,0xE3,0x18,0x82,0x10,0x44,0x21,0x03,0x19,0x40,0x00,0x61,0x08,0x20,0x00,0xE3,0x18,0x07,0x3A,0x04,0x21,0x40,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0x07,0x3A,0x04,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0x45,0x29,0x81,0x08,0xA2,0x10,0xC6,0x31,0xE3,0x18,0x20,0x00,0x81,0x08,
-	0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x44,0x21,0x65,0x29,0x81,0x08,0x24,0x21,0xA6,0x31,0x41,0x08,0x61,0x08,0xC3,0x18,0x81,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x03,0x21,0x61,0x08,0xA2,0x10,0xA6,0x31,0x61,0x08,0x03,0x19,0xC7,0x39,0x81,0x08,0x65,0x29,0xE3,0x18,0x82,0x10,0x86,0x31,0x41,0x08,0xE3,0x18,
-	0xC2,0x10,0x20,0x00,0xE3,0x18,0x20,0x00,0xA2,0x10,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x40,0x00,0x41,0x08,0x41,0x08,0x40,0x00,
-	0x81,0x08,0x41,0x08,0x51,0x0C,0x51,0x0C,0x51,0x0C,0x51,0x0C,0xCF,0x0B,0x45,0x01,0xE3,0x20,0x20,0x00,0xA2,0x10,0x85,0x29,0x61,0x08,0x24,0x21,0xC6,0x31,0xA2,0x10,0x45,0x29,0x44,0x21,0x40,0x00,0xE3,0x18,0xE3,0x18,0x20,0x00,0x82,0x10,0xC2,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0x44,0x21,0xA2,0x10,0x82,0x10,0xA6,0x31,0x65,0x29,
-	0x61,0x08,0xA2,0x10,0xE3,0x18,0x81,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0xA6,0x31,0xC2,0x10,0x82,0x10,0x24,0x21,0xE3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0xC3,0x18,0x08,0x42,0x24,0x21,0x41,0x08,0x20,0x00,0x41,0x08,0xC2,0x10,0x29,0x1A,0x99,0x1E,0xBA,0x1E,0x2C,0x0B,0x25,0x19,0x20,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,
-	0x41,0x08,0x24,0x21,0xE7,0x39,0xA2,0x10,0x82,0x10,0x45,0x29,0x82,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xC2,0x10,0x04,0x21,0x41,0x08,0x24,0x21,0xC6,0x31,0xA2,0x10,0x24,0x21,0x65,0x29,0x61,0x08,0x65,0x29,0x03,0x19,0x20,0x00,0xE3,0x18,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x40,0x00,0xC3,0x18,0x61,0x08,0xC2,0x10,0x61,0x08,0xA2,0x10,0xC2,0x10,0x61,0x08,0x44,0x21,
-	0x41,0x08,0x04,0x21,0xDE,0x27,0xDE,0x27,0xDE,0x27,0xDE,0x27,0xBE,0x27,0xFB,0x1E,0xE8,0x09,0x82,0x10,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x03,0x19,0x41,0x08,0x82,0x10,0xA6,0x31,0xA2,0x10,0xA2,0x10,0x28,0x42,0xC2,0x10,0x82,0x10,0x65,0x29,0x81,0x08,0x20,0x00,0x41,0x08,0xC2,0x10,0x81,0x08,0x40,0x00,
-	0x61,0x08,0xA6,0x31,0x03,0x19,0x81,0x08,0x45,0x29,0x24,0x21,0x40,0x00,0x40,0x00,0x20,0x00,0xA2,0x10,0x24,0x21,0xC2,0x10,0xA2,0x10,0xA6,0x31,0x04,0x21,0x41,0x08,0x82,0x08,0x61,0x00,0xE3,0x18,0xA6,0x31,0xA2,0x10,0x6A,0x12,0xFB,0x1E,0xBE,0x27,0xDE,0x27,0xBD,0x1F,0xD3,0x14,0x04,0x19,0xA6,0x31,0xA2,0x10,0xE3,0x18,0xC6,0x31,
-	0x82,0x10,0x20,0x00,0xA2,0x10,0xC2,0x18,0x61,0x08,0x20,0x00,0x61,0x08,0x45,0x29,0xA2,0x10,0x81,0x08,0xE7,0x39,0xE3,0x18,0x82,0x10,0xA6,0x31,0xC3,0x18,0x20,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0x04,0x21,
-	0x20,0x00,0x24,0x21,0x81,0x08,0xA2,0x10,0xE3,0x18,0x41,0x08,0x03,0x19,0x20,0x00,0xE3,0x18,0x20,0x00,0xA2,0x10,0x20,0x00,0x81,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x40,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0x04,0x21,0x40,0x00,0x04,0x19,0xC7,0x11,0x69,0x12,0xCB,0x22,
-	0x48,0x12,0x4C,0x33,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0x96,0x25,0x85,0x29,0x40,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0xC2,0x10,0xA2,0x10,0x20,0x00,0x41,0x08,0xC2,0x18,0x61,0x08,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x04,0x21,0x65,0x29,0x81,0x08,0x24,0x21,0xC7,0x39,0x61,0x08,0x41,0x08,0xC3,0x18,
-	0xC2,0x18,0x41,0x08,0x00,0x00,0x81,0x08,0x85,0x29,0x82,0x10,0xA2,0x10,0xA6,0x31,0x24,0x21,0x40,0x00,0x61,0x08,0x40,0x00,0xA2,0x10,0x65,0x29,0x82,0x10,0xC3,0x08,0x10,0x14,0xE7,0x11,0x81,0x08,0x65,0x29,0x2C,0x1B,0x5C,0x1F,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0x79,0x1E,0x24,0x09,0x65,0x29,0xC3,0x18,0x20,0x00,0x20,0x00,
-	0x82,0x10,0xC2,0x10,0x82,0x10,0x20,0x00,0x44,0x29,0x45,0x29,0xA2,0x10,0x45,0x29,0xA6,0x31,0x41,0x08,0x81,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0xE3,0x18,0x41,0x08,0x82,0x10,0x24,0x21,0x20,0x00,0x65,0x29,0x45,0x29,0x61,0x08,0xE7,0x39,0xC3,0x18,0xC3,0x18,0x85,0x29,0x61,0x08,0x85,0x29,
-	0xA2,0x10,0xE3,0x18,0x24,0x21,0x40,0x00,0x24,0x21,0x20,0x00,0xC3,0x18,0x40,0x00,0x82,0x10,0x40,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x40,0x00,0x40,0x00,0x41,0x08,0x82,0x00,0xB3,0x14,0x1C,0x1F,0xBE,0x27,0xBE,0x27,
-	0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xBE,0x27,0xDA,0x1E,0x45,0x09,0x61,0x08,0xA6,0x31,0x82,0x10,0x03,0x19,0x07,0x3A,0xA2,0x10,0x03,0x19,0x86,0x31,0x61,0x08,0xC3,0x18,0x03,0x19,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0x40,0x00,0x03,0x19,0x82,0x10,0x41,0x08,0xA6,0x31,0x24,0x21,
-	0x82,0x10,0x24,0x21,0x65,0x29,0x41,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0xC3,0x18,0x40,0x00,0xA2,0x10,0x07,0x3A,0x24,0x21,0x41,0x08,0x41,0x08,0xA3,0x08,0xD3,0x14,0xCF,0x13,0xE3,0x10,0x82,0x10,0x2D,0x13,0x3C,0x1F,0x9E,0x27,0x9E,0x27,0x9E,0x27,0x9E,0x27,0x59,0x1E,0x08,0x0A,0x61,0x08,0x20,0x00,0x20,0x00,0x04,0x21,0x45,0x29,
-	0x81,0x08,0x04,0x21,0xE7,0x39,0x81,0x08,0x41,0x08,0xE3,0x18,0xA2,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xC2,0x10,0x04,0x21,0x41,0x08,0x65,0x29,0x85,0x29,0x82,0x10,0x86,0x31,0x24,0x21,0x82,0x10,0xA6,0x31,0x81,0x08,0x41,0x08,0x24,0x21,0x20,0x00,0x81,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x40,0x00,0x81,0x08,0x41,0x08,0x40,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x61,0x08,0x61,0x00,0xE8,0x09,0x79,0x16,0x9E,0x27,0x9E,0x27,0x9E,0x27,0x7E,0x27,
-	0x9E,0x27,0x9E,0x27,0x9E,0x27,0x9E,0x27,0x9E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x5D,0x1F,0xE7,0x09,0xA2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x24,0x21,0xA2,0x10,0x81,0x08,0xE7,0x39,0xE3,0x18,0x82,0x10,0xE7,0x39,0xE3,0x18,0x41,0x08,0x04,0x21,0x82,0x10,0x20,0x00,0x82,0x10,0xC2,0x10,0x61,0x08,0x00,0x00,
-	0x61,0x08,0xA6,0x31,0xE3,0x18,0x81,0x08,0x86,0x31,0x24,0x21,0x40,0x00,0xA2,0x10,0x81,0x08,0x81,0x08,0x82,0x10,0x41,0x08,0xC2,0x10,0x69,0x3A,0xF4,0x14,0xCB,0x0A,0x61,0x08,0x41,0x00,0x6D,0x0B,0x5D,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x18,0x1E,0xA6,0x11,0x41,0x00,0x03,0x19,0xE7,0x39,0xC3,0x18,0xA2,0x10,0xC6,0x31,
-	0xA2,0x10,0x00,0x00,0x61,0x08,0xC2,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x04,0x21,0x61,0x08,0x81,0x08,0x07,0x3A,0xE3,0x18,0xA2,0x10,0x07,0x3A,0x81,0x08,0x61,0x08,0x65,0x29,0x41,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x81,0x08,0x61,0x08,0x41,0x08,0xC2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,
-	0x20,0x00,0xE3,0x18,0x20,0x00,0xE3,0x18,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0xA2,0x10,0x40,0x00,0xC3,0x18,0x40,0x00,0xE3,0x18,0x40,0x00,0x85,0x19,0x14,0x15,0xFC,0x26,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,
-	0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x7E,0x27,0x8A,0x0A,0x41,0x08,0x82,0x10,0x04,0x21,0x20,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0xE3,0x18,0x86,0x31,0x82,0x10,0x04,0x21,0xE7,0x39,0x82,0x10,0x61,0x08,0x03,0x19,
-	0x82,0x10,0x40,0x00,0x41,0x08,0xC3,0x18,0xC3,0x18,0x41,0x08,0x82,0x10,0x07,0x3A,0x24,0x21,0x61,0x08,0xE3,0x18,0xA2,0x10,0x03,0x09,0x76,0x1D,0xCB,0x0A,0xC3,0x10,0xC7,0x31,0x30,0x14,0x5D,0x27,0x7E,0x2F,0x7E,0x2F,0x7E,0x2F,0x7E,0x2F,0x56,0x1D,0x86,0x19,0x08,0x42,0x10,0x14,0x4D,0x0B,0xC3,0x18,0xE3,0x18,0x40,0x00,0x41,0x08,
-	0x41,0x08,0x04,0x21,0xA2,0x10,0x61,0x08,0x65,0x29,0x45,0x29,0x81,0x08,0x65,0x29,0x86,0x31,0x20,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0xC2,0x10,0x20,0x00,0xA6,0x31,0xA2,0x10,0x81,0x08,0xC7,0x39,0x81,0x08,0x45,0x29,0x03,0x19,0xA2,0x10,0xC6,0x31,
-	0x61,0x08,0x65,0x29,0xE3,0x18,0xC3,0x18,0x44,0x21,0x41,0x08,0x24,0x21,0x40,0x00,0x04,0x21,0x41,0x08,0xC3,0x18,0x40,0x00,0xA2,0x10,0x40,0x00,0x82,0x10,0x20,0x00,0x81,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0xC3,0x10,0xD7,0x1D,0x5E,0x2F,0x5E,0x2F,0x7E,0x2F,0x5E,0x2F,0x7E,0x2F,0x5E,0x2F,
-	0x5E,0x2F,0x5E,0x2F,0x7E,0x2F,0x5E,0x2F,0x7E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x7E,0x2F,0x11,0x14,0x61,0x08,0xC6,0x31,0x44,0x21,0x82,0x10,0xE7,0x39,0xC2,0x10,0x61,0x08,0x65,0x29,0x41,0x08,0x61,0x08,0x03,0x19,0x20,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0x20,0x00,0x04,0x21,0xA2,0x10,0x61,0x08,0x65,0x29,0x65,0x29,
-	0x81,0x08,0x24,0x21,0x86,0x31,0x40,0x00,0x41,0x08,0x82,0x10,0xC2,0x10,0x61,0x08,0x00,0x00,0xA2,0x10,0xE7,0x39,0x03,0x19,0x65,0x11,0x6A,0x12,0xE3,0x18,0xE3,0x10,0x51,0x14,0x1D,0x27,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5D,0x2F,0xD4,0x1C,0x04,0x11,0x86,0x01,0x76,0x1D,0x5E,0x2F,0x55,0x1D,0x82,0x10,0x20,0x00,0xE3,0x18,0x65,0x29,
-	0x82,0x10,0x24,0x21,0xE7,0x39,0x81,0x08,0x61,0x08,0x03,0x19,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0xC3,0x18,0x82,0x10,0x20,0x00,0x65,0x29,0xC3,0x18,0x61,0x08,0x07,0x3A,0xC3,0x18,0xC3,0x18,0x07,0x3A,0x61,0x08,0x24,0x21,0x85,0x29,0x41,0x08,0x45,0x29,0x82,0x10,0x41,0x08,0xC3,0x18,0x00,0x00,0xC3,0x18,
-	0x41,0x08,0x41,0x08,0xA2,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0xD4,0x1C,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,
-	0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x5E,0x2F,0x11,0x14,0x41,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0xC3,0x18,0x04,0x21,0x61,0x08,0xE7,0x39,0x45,0x29,0x61,0x08,0xA6,0x31,0xE3,0x18,0x61,0x08,0x24,0x21,0xA2,0x10,0x20,0x00,0x41,0x08,0xC2,0x10,0x61,0x08,0x20,0x00,
-	0x40,0x00,0x24,0x21,0x82,0x10,0x61,0x08,0xC7,0x39,0x44,0x21,0x61,0x08,0xE3,0x18,0x03,0x19,0x41,0x08,0x40,0x00,0x20,0x00,0xC3,0x18,0x65,0x29,0xE3,0x10,0xD4,0x1C,0x3D,0x2F,0x3E,0x2F,0x3E,0x2F,0x3E,0x2F,0x1D,0x27,0x51,0x14,0xE4,0x08,0xAE,0x13,0xBB,0x26,0x3E,0x2F,0x3E,0x2F,0x39,0x26,0x08,0x42,0xC2,0x10,0x61,0x08,0x24,0x21,
-	0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0x24,0x21,0x61,0x08,0xA2,0x10,0x08,0x42,0xA2,0x10,0xE3,0x18,0x07,0x3A,0x61,0x08,0xC3,0x18,0x86,0x31,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x40,0x00,0x82,0x10,0x20,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0xC2,0x10,0x81,0x08,0xC3,0x18,0x8E,0x1B,0x1E,0x2F,0x3E,0x2F,0x3E,0x2F,0x1E,0x2F,0x3E,0x2F,0x1E,0x2F,
-	0x3E,0x2F,0x1E,0x2F,0x3E,0x2F,0x3E,0x2F,0x3E,0x2F,0x1E,0x2F,0x3E,0x2F,0x1E,0x2F,0x3E,0x2F,0x55,0x1D,0x82,0x10,0x41,0x08,0xC2,0x10,0x41,0x08,0x41,0x08,0x81,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0x85,0x29,0x82,0x10,0xE3,0x18,0xE7,0x39,0x81,0x08,0xC2,0x10,0xE7,0x39,0x81,0x08,0x41,0x08,0xE3,0x18,
-	0xA2,0x10,0x40,0x00,0x61,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0xC7,0x39,0x03,0x19,0x82,0x08,0x65,0x19,0x04,0x21,0x41,0x08,0xA3,0x08,0x52,0x14,0x1D,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0xFD,0x2E,0xD0,0x1B,0x66,0x11,0x93,0x1C,0x1D,0x2F,0x1E,0x2F,0x1D,0x2F,0xD7,0x1D,0xA6,0x01,0x82,0x10,0xA2,0x10,0x41,0x08,0x40,0x00,
-	0x61,0x08,0x03,0x19,0x82,0x10,0x41,0x08,0xC6,0x31,0x03,0x19,0xA2,0x10,0xC7,0x39,0x24,0x21,0x41,0x08,0x24,0x21,0xC3,0x18,0x00,0x00,0xA2,0x10,0x81,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0xE3,0x18,0x20,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0x85,0x29,0x61,0x08,0xE3,0x18,0x04,0x21,
-	0x82,0x10,0xA6,0x31,0x41,0x08,0x65,0x29,0xC2,0x10,0x04,0x21,0x24,0x21,0xA2,0x10,0x04,0x21,0x61,0x08,0x03,0x19,0x40,0x00,0xC3,0x18,0x40,0x00,0xA2,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x29,0x0A,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,
-	0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0x15,0x1D,0x82,0x10,0x24,0x21,0xC7,0x39,0x61,0x08,0x44,0x21,0xE3,0x18,0x41,0x08,0x44,0x21,0x61,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x40,0x00,0x61,0x08,0xC2,0x10,0x81,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x24,0x21,0x65,0x29,
-	0x81,0x08,0x24,0x21,0xC7,0x39,0x61,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x20,0x00,0xB0,0x13,0x2D,0x1B,0x82,0x10,0xE3,0x08,0xB4,0x1C,0xFD,0x2E,0x1E,0x2F,0x1E,0x2F,0x1E,0x2F,0xDD,0x2E,0x2D,0x13,0xC7,0x01,0xF8,0x25,0x1E,0x2F,0x1E,0x2F,0xDD,0x2E,0x4E,0x13,0xC3,0x00,0xA2,0x10,0x82,0x10,0x41,0x08,0x24,0x21,0x85,0x29,
-	0x81,0x08,0x24,0x21,0xC6,0x31,0x41,0x08,0x61,0x08,0xE3,0x18,0x41,0x08,0x81,0x08,0x81,0x10,0x61,0x08,0x61,0x08,0x40,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x45,0x29,0x41,0x08,0xA2,0x10,0xC7,0x39,0x81,0x08,0x24,0x21,0x65,0x29,0xA2,0x10,0xE7,0x39,0x03,0x19,0xC2,0x10,0xC6,0x31,0x41,0x08,0x24,0x21,0xA2,0x10,0x61,0x08,0x24,0x21,
-	0x20,0x00,0x04,0x21,0x41,0x08,0xA2,0x10,0xC2,0x10,0x20,0x00,0xE3,0x18,0x00,0x00,0xC2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x81,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x81,0x08,0xDD,0x2E,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,
-	0xFE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0x15,0x1D,0x00,0x00,0x24,0x21,0xA2,0x10,0x41,0x08,0xC7,0x39,0x82,0x10,0xC3,0x18,0xE7,0x39,0x61,0x08,0x44,0x21,0xE7,0x39,0x61,0x08,0xE3,0x18,0x03,0x19,0x20,0x00,0x82,0x10,0xC2,0x10,0x20,0x00,0x81,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,
-	0x41,0x08,0x44,0x21,0xA2,0x10,0x81,0x08,0xA6,0x31,0x44,0x21,0x61,0x08,0xC2,0x10,0x0D,0x13,0x53,0x24,0x40,0x00,0x82,0x00,0x32,0x1C,0xFD,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xDD,0x2E,0xD0,0x13,0x6A,0x0A,0x7B,0x2E,0xFE,0x36,0xFE,0x36,0x9B,0x2E,0x4E,0x23,0x44,0x21,0x81,0x08,0x04,0x21,0x08,0x42,0xA2,0x10,0x61,0x08,0x45,0x29,
-	0x82,0x10,0x40,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0xE3,0x18,0x45,0x29,0x61,0x08,0x24,0x21,0x65,0x29,0x82,0x10,0xC6,0x31,0x44,0x21,0x61,0x08,0x85,0x29,0xA2,0x10,0x40,0x00,0x24,0x21,0x20,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x82,0x10,
-	0x81,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x40,0x00,0xC2,0x10,0x40,0x00,0xE3,0x18,0x61,0x08,0x03,0x19,0x61,0x08,0x44,0x29,0xB9,0x2D,0xDE,0x36,0xDE,0x36,0xDE,0x36,0xDE,0x36,0xDE,0x36,
-	0xDE,0x36,0xDE,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xDE,0x36,0xFE,0x36,0xDE,0x36,0xBD,0x2E,0x8A,0x12,0xC2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0xC2,0x10,0x82,0x10,0x20,0x00,0x03,0x19,0x61,0x08,0x20,0x00,0x65,0x29,0x81,0x08,0x82,0x10,0x07,0x3A,0xC2,0x10,0x81,0x08,0xE7,0x39,0xC3,0x18,0x41,0x08,0x24,0x21,
-	0x81,0x08,0x20,0x00,0x61,0x08,0xC2,0x10,0x81,0x08,0x20,0x00,0xA3,0x08,0x52,0x1C,0x8F,0x13,0xC3,0x10,0xE7,0x31,0x93,0x24,0xDD,0x36,0xFE,0x36,0xFE,0x36,0xFE,0x36,0xBD,0x2E,0x2D,0x13,0xB0,0x13,0x9C,0x2E,0xFE,0x36,0xDE,0x36,0x5B,0x2E,0x49,0x12,0x81,0x08,0x44,0x21,0x81,0x08,0x00,0x00,0xA2,0x10,0xC2,0x10,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x24,0x21,0x61,0x08,0x61,0x08,0xE7,0x39,0xC2,0x10,0xC2,0x10,0x08,0x42,0xC3,0x18,0x41,0x08,0x65,0x29,0x61,0x08,0x40,0x00,0x03,0x19,0x61,0x08,0x81,0x08,0xC2,0x10,0x40,0x00,0x81,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0xC3,0x18,0x20,0x00,0x81,0x08,0xC3,0x18,0x00,0x00,0x44,0x21,0x40,0x00,
-	0xC2,0x10,0xC2,0x10,0x82,0x10,0x45,0x29,0x41,0x08,0x45,0x29,0x41,0x08,0x04,0x21,0x81,0x08,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x40,0x00,0xA2,0x10,0x41,0x08,0xA2,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0xC2,0x10,0x82,0x10,0x03,0x21,0x11,0x14,0xBD,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,
-	0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0x98,0x2D,0x07,0x2A,0x45,0x29,0x20,0x00,0x45,0x29,0x61,0x08,0x61,0x08,0x03,0x19,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x81,0x08,0xC2,0x18,0x41,0x08,0x40,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0xC2,0x10,0x24,0x21,0x61,0x08,0x03,0x19,0xC6,0x31,
-	0x81,0x08,0x24,0x21,0xE7,0x39,0x61,0x08,0x61,0x08,0x03,0x11,0xF1,0x1B,0xAF,0x13,0x40,0x00,0xE3,0x10,0x32,0x1C,0xBD,0x36,0xBE,0x36,0xBE,0x36,0xBE,0x36,0xBD,0x36,0x11,0x1C,0x32,0x1C,0xBE,0x36,0xBE,0x36,0xBE,0x36,0x3B,0x2E,0x6A,0x12,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0xE3,0x18,0x82,0x10,0x40,0x00,0x45,0x29,0x45,0x29,
-	0xA2,0x10,0x85,0x29,0x86,0x31,0x61,0x08,0xE3,0x18,0xE3,0x18,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0xC2,0x10,0x61,0x08,0x20,0x00,0xC3,0x18,0xC2,0x10,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x65,0x29,0x61,0x08,0xC2,0x10,0xA6,0x31,0x61,0x08,0xC6,0x31,0x44,0x21,0x82,0x10,0x08,0x42,0xA2,0x10,0x65,0x29,0xC3,0x18,
-	0xA2,0x10,0x85,0x29,0x81,0x08,0x86,0x31,0x61,0x08,0x44,0x21,0xA2,0x10,0xE3,0x18,0xE3,0x18,0xA2,0x10,0xE3,0x18,0x61,0x08,0xC2,0x10,0x61,0x08,0xA2,0x10,0x81,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x03,0x09,0xAB,0x12,0x56,0x25,0x9D,0x36,0x9E,0x3E,0xBE,0x3E,
-	0xBE,0x3E,0xBE,0x3E,0xBE,0x3E,0xBE,0x3E,0x9E,0x3E,0xBE,0x3E,0xBE,0x3E,0xBE,0x3E,0x32,0x24,0x45,0x29,0x41,0x08,0xA2,0x10,0x85,0x29,0x61,0x08,0x65,0x29,0x24,0x21,0xA2,0x10,0x08,0x42,0xC3,0x18,0x82,0x10,0xC7,0x39,0xA2,0x10,0x61,0x08,0x45,0x29,0x40,0x00,0x41,0x08,0xC2,0x10,0x41,0x08,0x61,0x08,0x81,0x08,0x82,0x10,0x61,0x08,
-	0x20,0x00,0x04,0x21,0x82,0x10,0x40,0x00,0x86,0x31,0x73,0x2C,0xAF,0x13,0xC6,0x31,0xE7,0x31,0x73,0x24,0x9D,0x36,0xBE,0x3E,0xBE,0x3E,0xBE,0x3E,0x9D,0x36,0x53,0x1C,0x94,0x24,0x9D,0x36,0xBE,0x3E,0xBE,0x3E,0x1B,0x36,0x49,0x12,0xA2,0x10,0x41,0x08,0x24,0x21,0xA6,0x31,0x61,0x08,0x03,0x19,0xC6,0x31,0x61,0x08,0x41,0x08,0xE3,0x18,
-	0x81,0x08,0x61,0x08,0x82,0x10,0x81,0x08,0x61,0x08,0x40,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x44,0x21,0xC3,0x18,0x61,0x08,0xA6,0x31,0xC3,0x18,0xC3,0x18,0x07,0x3A,0xA2,0x10,0xE3,0x18,0xE7,0x39,0x61,0x08,0x04,0x21,0xE3,0x18,0x40,0x00,0x44,0x21,0x41,0x08,0x61,0x08,0x24,0x21,0x20,0x00,0xE3,0x18,0x40,0x00,0x61,0x08,0xC2,0x10,
-	0x20,0x00,0xC2,0x10,0x40,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x81,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0xA2,0x10,0x81,0x08,0x61,0x08,0x24,0x19,0x74,0x24,0x7E,0x3E,0x9E,0x3E,
-	0x7E,0x3E,0x9E,0x3E,0x9E,0x3E,0x7E,0x3E,0x9E,0x3E,0x7E,0x3E,0x9E,0x3E,0x7E,0x3E,0xCD,0x1A,0x61,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0xE3,0x18,0x00,0x00,0xE3,0x18,0x45,0x29,0x61,0x08,0x24,0x21,0x24,0x21,0x82,0x10,0xC6,0x31,0x65,0x29,0x61,0x08,0x65,0x29,0xE3,0x18,0x20,0x00,0xC3,0x18,
-	0xA2,0x10,0x20,0x00,0x81,0x08,0xC2,0x18,0x25,0x09,0x26,0x09,0xA7,0x09,0x49,0x22,0x0E,0x13,0x7D,0x36,0x9E,0x3E,0x9E,0x3E,0x9E,0x3E,0x9E,0x3E,0x17,0x25,0x17,0x2D,0x9E,0x3E,0x9E,0x3E,0x9E,0x3E,0x1C,0x36,0x6A,0x12,0xC2,0x10,0x08,0x42,0xC3,0x18,0x61,0x08,0x44,0x21,0x81,0x08,0x00,0x00,0x61,0x08,0xC3,0x18,0x61,0x08,0x20,0x00,
-	0x82,0x10,0xE3,0x18,0x41,0x08,0x81,0x08,0xA6,0x31,0x81,0x08,0xE3,0x18,0x07,0x3A,0x81,0x08,0x03,0x19,0xC6,0x31,0x81,0x08,0xC3,0x18,0x04,0x21,0x00,0x00,0xC3,0x18,0x81,0x08,0x00,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0x82,0x10,0x82,0x10,0x41,0x08,
-	0xE3,0x18,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0x81,0x08,0x40,0x00,0xA2,0x10,0x20,0x00,0xC2,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0xC3,0x18,0x61,0x08,0x04,0x21,0x41,0x08,0x45,0x29,0x61,0x08,0x45,0x29,0x61,0x08,0x65,0x29,0xA2,0x10,0x65,0x29,0x24,0x21,0x25,0x09,0x5C,0x36,0x7E,0x3E,
-	0x7E,0x3E,0x7E,0x3E,0x7E,0x3E,0x7E,0x3E,0x7E,0x3E,0x7E,0x3E,0x7E,0x3E,0x7E,0x46,0x24,0x11,0x61,0x08,0x44,0x21,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0xA2,0x10,0x81,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0x82,0x10,0x81,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0x40,0x00,0x61,0x08,0x45,0x29,0x41,0x08,0xE3,0x18,0xE7,0x39,
-	0x82,0x10,0xE3,0x18,0xE7,0x39,0x0A,0x1A,0x54,0x2C,0x8B,0x1A,0x37,0x2D,0x12,0x24,0x3D,0x36,0x7E,0x3E,0x7E,0x3E,0x7E,0x3E,0x9E,0x3E,0x17,0x2D,0x58,0x2D,0x7D,0x3E,0x7E,0x3E,0x7E,0x3E,0x7E,0x3E,0x96,0x2C,0x25,0x11,0xB0,0x1B,0x53,0x2C,0x33,0x2C,0xE9,0x11,0x20,0x00,0x41,0x08,0x45,0x29,0xC2,0x18,0x61,0x08,0xA6,0x31,0x24,0x21,
-	0xA2,0x10,0xA6,0x31,0x65,0x29,0x20,0x00,0x24,0x21,0xA2,0x10,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x81,0x08,0x81,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x40,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0x00,0x00,0xE3,0x18,0x82,0x10,0x82,0x10,0x85,0x29,0x40,0x00,0x85,0x29,0x04,0x21,0xA2,0x10,0xC6,0x31,0x61,0x08,
-	0xA6,0x31,0xC2,0x10,0xE3,0x18,0x24,0x21,0xA2,0x10,0x86,0x31,0x82,0x10,0x86,0x31,0x61,0x08,0x65,0x29,0x61,0x08,0x24,0x21,0x61,0x08,0xE3,0x20,0x41,0x08,0xC2,0x10,0x40,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xC3,0x18,0x00,0x00,0xC3,0x18,0x00,0x00,0x03,0x19,0x20,0x00,0xC3,0x18,0xEF,0x22,0x3D,0x3E,
-	0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x9A,0x35,0x82,0x10,0x44,0x21,0xA6,0x31,0x81,0x08,0xC7,0x39,0xE3,0x18,0xC3,0x18,0x07,0x3A,0x61,0x08,0x04,0x21,0x85,0x29,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0xE3,0x18,0x82,0x10,0x41,0x08,0x82,0x10,0x81,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,
-	0x20,0x00,0x03,0x19,0x8B,0x22,0x54,0x24,0xED,0x12,0xBA,0x35,0x13,0x24,0x3D,0x3E,0x5E,0x46,0x5E,0x46,0x5E,0x46,0x5E,0x46,0x3D,0x3E,0x9A,0x35,0x5E,0x3E,0x5E,0x46,0x5E,0x46,0x5E,0x46,0x5E,0x46,0x96,0x2C,0xDB,0x35,0x5E,0x46,0x5E,0x46,0x5E,0x46,0xDB,0x35,0x4A,0x22,0x81,0x08,0x03,0x19,0xC7,0x39,0x61,0x08,0x81,0x08,0x03,0x19,
-	0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0x81,0x08,0x82,0x10,0x41,0x08,0x40,0x00,0xE3,0x18,0x40,0x00,0x61,0x08,0x44,0x21,0x41,0x08,0xE3,0x18,0x45,0x29,0x61,0x08,0xE7,0x31,0x69,0x3A,0xB3,0x64,0x3D,0x97,0x7F,0x9F,0x35,0x6D,0x86,0x21,0xA2,0x10,0xC7,0x39,0x81,0x08,0x04,0x21,0x85,0x29,0x20,0x00,0x85,0x29,0x61,0x08,
-	0xC2,0x10,0x82,0x10,0x41,0x08,0xE3,0x18,0x20,0x00,0xE3,0x20,0x85,0x19,0xE7,0x29,0xC7,0x21,0xAF,0x53,0x14,0x65,0x69,0x32,0x24,0x11,0xE3,0x18,0x00,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x40,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x08,0xF3,0x2B,
-	0x1E,0x46,0x1E,0x46,0x1E,0x46,0x3E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0xB7,0x2C,0x20,0x00,0xC3,0x18,0x61,0x08,0x61,0x08,0x04,0x21,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x65,0x29,0x82,0x10,0x41,0x08,0xE7,0x39,0xA2,0x10,0xE3,0x18,0xE7,0x39,0x81,0x08,0x44,0x21,0xC7,0x39,0x61,0x08,0x04,0x21,0x24,0x21,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x87,0x09,0x54,0x2C,0x0F,0x1B,0xBB,0x3D,0x96,0x34,0xFC,0x3D,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3D,0x46,0x3D,0x46,0x3E,0x46,0x5E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0x3E,0x46,0xBB,0x3D,0xC2,0x10,0x40,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,
-	0xA2,0x10,0xC3,0x18,0x00,0x00,0xC2,0x18,0x65,0x29,0x81,0x08,0x24,0x21,0x65,0x31,0x81,0x08,0xC6,0x31,0x85,0x29,0x61,0x08,0xA6,0x31,0xC2,0x10,0xC3,0x10,0xC3,0x10,0x6E,0x4B,0xF9,0x7D,0x1D,0x97,0x7F,0x9F,0x7F,0x9F,0x7F,0x9F,0x5E,0x9F,0xF8,0x7D,0xC3,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x24,0x11,0x49,0x32,0xD8,0x7D,0x7B,0x8E,0x1E,0x97,0x5F,0x9F,0x5F,0x9F,0x1D,0x9F,0x9B,0x8E,0xF9,0x85,0x86,0x21,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x40,0x00,0xC3,0x18,0x61,0x08,0xE3,0x18,0x41,0x08,0x03,0x21,0x20,0x00,0x24,0x21,0x20,0x00,0x24,0x21,0x41,0x08,0x03,0x19,0x6B,0x1A,
-	0x1E,0x46,0xFE,0x45,0x1E,0x46,0xFE,0x45,0x1E,0x46,0x1E,0x46,0x1E,0x4E,0xD2,0x23,0x03,0x19,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x44,0x21,0xA2,0x10,0x61,0x08,0xA6,0x31,0xA2,0x10,0xA2,0x10,0x08,0x42,
-	0x25,0x11,0xD2,0x23,0x6C,0x12,0xBC,0x3D,0xD8,0x34,0xBC,0x3D,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x34,0x2C,0x90,0x1B,0xDC,0x45,0xDC,0x3D,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0xFD,0x3D,0x62,0x08,0xE8,0x21,0x25,0x09,0x61,0x08,0xC7,0x39,0xC2,0x10,
-	0xA2,0x10,0x08,0x42,0xC3,0x18,0x81,0x08,0xC6,0x31,0x82,0x10,0x61,0x08,0x45,0x29,0x40,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0x61,0x08,0xE7,0x21,0xD0,0x53,0xB8,0x7D,0x3F,0xA7,0x3F,0xA7,0x5F,0xA7,0x3F,0xA7,0x3F,0xA7,0x5F,0xA7,0x3F,0xA7,0x3F,0xA7,0x93,0x64,0x61,0x08,0x41,0x08,0xE3,0x18,0x20,0x00,0x24,0x21,0x61,0x08,0x82,0x10,
-	0x04,0x21,0x20,0x00,0x65,0x21,0xA7,0x21,0x8E,0x4B,0xDD,0x9E,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x5B,0x8E,0x66,0x19,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x40,0x00,0xA2,0x10,0x40,0x00,0xC3,0x18,0x81,0x08,0xC3,0x18,0xA2,0x10,0xC3,0x18,0xC3,0x18,0xE3,0x18,0xE3,0x18,0x04,0x21,0xC3,0x18,0x45,0x29,0x61,0x08,0x86,0x31,0x61,0x08,0xC6,0x31,0x71,0x33,
-	0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xFE,0x4D,0x10,0x23,0xC6,0x31,0x61,0x08,0xC7,0x39,0xC3,0x18,0xC3,0x18,0x86,0x31,0x61,0x08,0x45,0x29,0xE3,0x18,0x20,0x00,0x24,0x21,0x41,0x08,0x40,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0x41,0x08,0x20,0x00,0xC3,0x18,0xE3,0x08,
-	0x56,0x34,0xB7,0x34,0xBC,0x45,0x18,0x3D,0x7A,0x3D,0xFE,0x45,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x1E,0x46,0x19,0x3D,0xC3,0x08,0x47,0x09,0xF8,0x3C,0x8C,0x1A,0xFD,0x45,0xFE,0x45,0x1E,0x46,0x1E,0x46,0x1E,0x46,0xD8,0x34,0xA8,0x19,0x9C,0x45,0x96,0x34,0x61,0x00,0x81,0x10,0xC3,0x18,
-	0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x81,0x08,0xC2,0x10,0x61,0x08,0x40,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0xA2,0x10,0x66,0x21,0x0C,0x43,0x56,0x75,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x3F,0xA7,0x1E,0x9F,0x1E,0x9F,0xD5,0x6C,0x04,0x21,0xA2,0x10,0x07,0x3A,0x81,0x08,0x85,0x29,0x85,0x29,0xA2,0x10,
-	0xC6,0x31,0x81,0x08,0x8A,0x3A,0xCF,0x53,0xDD,0x9E,0x1F,0xA7,0x1F,0xA7,0x1F,0xA7,0x1F,0xA7,0x1F,0xA7,0x1F,0xA7,0x1F,0xA7,0x1F,0xA7,0x1F,0xA7,0x1F,0xA7,0x3B,0x8E,0x04,0x11,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0xC2,0x10,0x20,0x00,0xC3,0x18,0x35,0x3C,
-	0xDE,0x4D,0xBE,0x4D,0xBE,0x4D,0xBE,0x4D,0xBE,0x4D,0xBE,0x4D,0xBE,0x4D,0x2A,0x1A,0xA2,0x10,0x41,0x08,0x65,0x29,0x41,0x08,0xE3,0x18,0xE3,0x18,0x82,0x10,0xC7,0x39,0x82,0x10,0xE3,0x18,0xE7,0x39,0xA2,0x10,0x65,0x29,0x44,0x21,0xA2,0x10,0xE7,0x39,0xC3,0x18,0x61,0x08,0xA6,0x31,0x61,0x08,0x61,0x08,0x04,0x21,0xC3,0x08,0x76,0x34,
-	0x3A,0x45,0x9C,0x45,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0x5A,0x3D,0x67,0x11,0x09,0x2A,0x2F,0x23,0x19,0x45,0xAB,0x42,0xB3,0x2B,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xBD,0x45,0x2A,0x22,0x51,0x23,0xDE,0x4D,0x3A,0x3D,0x25,0x11,0x82,0x10,0x20,0x00,
-	0xE3,0x18,0xA2,0x10,0x20,0x00,0x04,0x21,0xA2,0x10,0x20,0x00,0x85,0x29,0x82,0x10,0xA2,0x10,0xE7,0x39,0x82,0x10,0xE3,0x18,0x32,0x64,0xB4,0x74,0xFF,0xA6,0xFF,0xA6,0xFF,0xA6,0xFF,0xA6,0xFF,0xA6,0xFF,0xA6,0x1B,0x8E,0xD0,0x5B,0x65,0x19,0x57,0x7D,0x9C,0x9E,0xEC,0x4A,0xA2,0x10,0xE3,0x18,0x41,0x08,0x61,0x08,0xE3,0x18,0x00,0x00,
-	0xE3,0x18,0xCC,0x42,0x11,0x64,0x5C,0x9E,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xFF,0xAE,0xD5,0x6C,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x61,0x08,0x40,0x00,0x40,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x82,0x08,0xB9,0x3C,
-	0x9E,0x4D,0x9E,0x4D,0x9E,0x4D,0x9E,0x4D,0x9E,0x4D,0x9E,0x4D,0x9E,0x4D,0x88,0x19,0x81,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x40,0x00,0x03,0x19,0x41,0x08,0x41,0x08,0x04,0x21,0x20,0x00,0xE3,0x18,0x24,0x21,0x40,0x00,0x44,0x21,0x45,0x19,0x56,0x34,0x7C,0x45,
-	0x9D,0x45,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0x5B,0x3D,0x4C,0x1A,0x36,0x34,0x3B,0x45,0xBD,0x45,0xBD,0x45,0x3B,0x45,0x7C,0x45,0xDE,0x4D,0xDE,0x4D,0xDE,0x4D,0xBD,0x4D,0xFA,0x3C,0x7C,0x45,0xDE,0x4D,0xFA,0x3C,0x05,0x11,0x08,0x42,0xA2,0x10,
-	0xE3,0x18,0x28,0x42,0x81,0x08,0xE3,0x18,0xC7,0x39,0x61,0x08,0xC2,0x10,0x03,0x19,0x20,0x00,0xE3,0x18,0xA2,0x10,0xC7,0x29,0xFB,0x95,0xBD,0xA6,0xDF,0xAE,0xFF,0xAE,0xFF,0xAE,0xDF,0xAE,0xBD,0xA6,0xB0,0x5B,0x24,0x19,0x61,0x08,0x74,0x74,0x3C,0x9E,0xFF,0xAE,0x9D,0xA6,0x90,0x5B,0x40,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,
-	0x61,0x08,0xAB,0x3A,0xDA,0x8D,0xDF,0xAE,0xDF,0xAE,0xDF,0xAE,0xDF,0xAE,0xDF,0xAE,0x3B,0x96,0xB0,0x5B,0xCC,0x4A,0xDA,0x8D,0xDF,0xAE,0xDF,0xAE,0xDF,0xAE,0xDF,0xAE,0x5C,0x9E,0x66,0x21,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0xA2,0x10,0x40,0x00,0xA2,0x10,0x61,0x08,0x61,0x08,0xC3,0x18,0x61,0x08,0x24,0x21,0x61,0x08,0x44,0x29,0x82,0x10,0x44,0x21,0xA2,0x10,0x24,0x21,0xA2,0x10,0xE3,0x18,0x03,0x19,0x46,0x11,0x1B,0x45,
-	0x7E,0x55,0x7E,0x55,0x7E,0x55,0x7E,0x55,0x7E,0x55,0x7E,0x55,0x3C,0x4D,0x26,0x11,0x04,0x21,0x61,0x08,0x61,0x08,0xE3,0x18,0x20,0x00,0x03,0x19,0x81,0x08,0x41,0x08,0xE3,0x18,0x20,0x00,0x82,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0x82,0x10,0xC3,0x10,0xD3,0x33,0x9D,0x4D,0x7C,0x4D,
-	0xBE,0x4D,0x9E,0x4D,0x9E,0x4D,0xBE,0x4D,0x9E,0x4D,0x9E,0x4D,0xBE,0x4D,0xBE,0x4D,0x9E,0x4D,0x9E,0x4D,0xBE,0x4D,0xBE,0x4D,0x5C,0x45,0xB3,0x2B,0x7C,0x4D,0x9E,0x4D,0x9E,0x4D,0x9D,0x4D,0x9E,0x4D,0x9E,0x4D,0x9E,0x4D,0xBE,0x4D,0x9E,0x4D,0x9E,0x4D,0xBE,0x4D,0x9E,0x4D,0xBE,0x4D,0xBE,0x4D,0x14,0x3C,0x41,0x08,0xE3,0x18,0xC3,0x18,
-	0x00,0x00,0xA2,0x10,0x81,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x40,0x00,0x61,0x08,0x81,0x08,0x61,0x08,0x61,0x08,0x94,0x74,0x6F,0x53,0xBF,0xAE,0xBF,0xAE,0xBF,0xAE,0xBE,0xAE,0xB9,0x8D,0x09,0x3A,0xE3,0x18,0x20,0x00,0xE3,0x18,0x33,0x6C,0x58,0x85,0xBF,0xAE,0xBF,0xAE,0x78,0x8D,0x82,0x10,0x82,0x10,0x65,0x29,0x40,0x00,0xA6,0x31,
-	0x81,0x08,0x65,0x29,0x99,0x95,0x7D,0xA6,0xFB,0x95,0x5D,0xA6,0x3C,0x9E,0x6F,0x5B,0xC3,0x10,0x61,0x08,0x65,0x29,0x04,0x19,0xBF,0xAE,0xBF,0xAE,0xBF,0xAE,0xBF,0xAE,0xBF,0xAE,0x2A,0x32,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x40,0x00,0xC3,0x18,0x20,0x00,0xE3,0x18,0x40,0x00,0x03,0x19,0x41,0x08,0x03,0x19,0x61,0x08,0xC2,0x10,0x81,0x08,0x47,0x11,0x3D,0x4D,
-	0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x1C,0x4D,0x47,0x19,0xC7,0x39,0xA2,0x10,0x24,0x21,0x24,0x21,0xA2,0x10,0x28,0x42,0x82,0x10,0x45,0x29,0xC7,0x39,0x61,0x08,0xC7,0x39,0xE3,0x18,0xA2,0x10,0xE7,0x39,0x61,0x08,0x04,0x21,0x86,0x31,0x41,0x08,0x24,0x21,0xC3,0x18,0x10,0x23,0x7D,0x4D,0x9E,0x55,0x9E,0x55,
-	0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x1C,0x4D,0x99,0x44,0x5D,0x4D,0x9E,0x55,0x9E,0x55,0x1B,0x45,0x34,0x2C,0xDA,0x44,0x5C,0x4D,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0x9E,0x55,0xCE,0x22,0x81,0x08,0x61,0x08,0x20,0x00,
-	0xA2,0x10,0x40,0x00,0x41,0x08,0x04,0x21,0x40,0x00,0x61,0x08,0x85,0x29,0x61,0x08,0xE3,0x18,0x44,0x21,0xE4,0x18,0x6F,0x53,0x0E,0x53,0x9F,0xB6,0x9F,0xB6,0x9F,0xB6,0x95,0x7C,0xE7,0x39,0x82,0x10,0xE7,0x39,0xC3,0x18,0x04,0x21,0xD1,0x63,0xD7,0x84,0x9F,0xB6,0x9F,0xB6,0xBA,0x95,0x66,0x29,0x41,0x08,0x85,0x29,0x20,0x00,0x44,0x21,
-	0xA2,0x10,0xC2,0x10,0x86,0x29,0x66,0x21,0xA6,0x29,0x46,0x21,0xE7,0x31,0x20,0x00,0x03,0x19,0x40,0x00,0xE3,0x18,0xA7,0x29,0x9F,0xB6,0x9F,0xB6,0x9F,0xB6,0x9F,0xB6,0x9F,0xB6,0xCD,0x4A,0x61,0x08,0x61,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x40,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x81,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x6E,0x22,0x1E,0x5D,
-	0xBA,0x4C,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,0xDB,0x54,0x47,0x19,0xC3,0x18,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x00,0x00,0xE3,0x18,0x61,0x08,0x40,0x00,0x45,0x29,0x40,0x00,0xC2,0x10,0x04,0x21,0x41,0x08,0xA6,0x31,0xE3,0x18,0x61,0x08,0x07,0x3A,0x6E,0x2A,0x7E,0x55,0x7E,0x55,0x5E,0x55,0x5E,0x55,
-	0x5E,0x55,0x7E,0x55,0x7E,0x55,0x5E,0x55,0x5E,0x55,0x7E,0x55,0x7E,0x55,0x7E,0x55,0x7E,0x55,0x5E,0x55,0xFB,0x4C,0x99,0x44,0x7E,0x55,0x7E,0x55,0x7E,0x55,0xDB,0x44,0xC9,0x11,0x8F,0x2A,0xF6,0x3B,0x1C,0x4D,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x7E,0x55,0x7E,0x55,0x7E,0x55,0x7E,0x55,0x7E,0x55,0x89,0x11,0xC2,0x10,0xE7,0x39,0x82,0x10,
-	0x04,0x21,0x86,0x31,0x81,0x08,0xA6,0x31,0x65,0x29,0x61,0x08,0xC6,0x31,0xC3,0x18,0x82,0x10,0xA6,0x31,0x87,0x29,0x4A,0x42,0x59,0x95,0x7F,0xB6,0x7F,0xB6,0x3D,0xAE,0xA2,0x10,0xE3,0x18,0x00,0x00,0xA2,0x10,0x81,0x08,0x20,0x00,0x34,0x74,0x7A,0x95,0x7F,0xB6,0x7F,0xB6,0xDB,0x9D,0x66,0x29,0x20,0x00,0xC2,0x10,0x61,0x08,0x82,0x10,
-	0x82,0x10,0x61,0x08,0xA2,0x10,0x40,0x00,0xA2,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x50,0x63,0x7E,0xAE,0x7F,0xB6,0x7F,0xB6,0x7F,0xB6,0x7F,0xB6,0xCD,0x4A,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x00,0x00,0xC2,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0xE3,0x18,0x20,0x00,0xE3,0x20,0x00,0x00,0x03,0x19,0x00,0x00,0xE3,0x18,0x74,0x3B,0x1E,0x5D,
-	0xD0,0x2A,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0xBB,0x54,0xE5,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0xA2,0x10,0x67,0x19,0xDB,0x4C,0x3D,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,
-	0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x59,0x44,0x99,0x44,0x5D,0x55,0x5E,0x55,0x5E,0x55,0x99,0x44,0x67,0x11,0x45,0x29,0x93,0x3B,0x54,0x3B,0x1C,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x5E,0x55,0x25,0x19,0x20,0x00,0x04,0x21,0x82,0x10,
-	0x40,0x00,0x03,0x19,0x81,0x08,0x61,0x08,0xE3,0x18,0x20,0x00,0x81,0x08,0xC3,0x18,0x20,0x00,0x61,0x08,0x0A,0x3A,0xCD,0x52,0x5F,0xBE,0x5F,0xBE,0x5F,0xBE,0xB2,0x6B,0x82,0x10,0x40,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0xE3,0x18,0xDC,0xAD,0x3E,0xB6,0x5F,0xBE,0x5F,0xBE,0x5A,0x9D,0xA3,0x10,0xC3,0x18,0x20,0x00,0x81,0x08,0x41,0x08,
-	0x41,0x08,0xA2,0x10,0x20,0x00,0x03,0x19,0x00,0x00,0x03,0x19,0x00,0x00,0xE3,0x18,0x00,0x00,0xC3,0x18,0x25,0x21,0x4B,0x42,0x5E,0xB6,0x5F,0xBE,0x5F,0xBE,0x5F,0xBE,0x5F,0xBE,0x0A,0x3A,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x20,0x00,0xA2,0x10,0x61,0x08,0xC3,0x18,0xE3,0x18,0xA2,0x10,0x04,0x21,0x61,0x08,0x45,0x29,0x61,0x08,0x65,0x29,0x82,0x10,0x85,0x29,0x82,0x10,0xA6,0x31,0xA2,0x10,0xC6,0x31,0x81,0x08,0xC6,0x31,0x3B,0x54,0xFE,0x5C,
-	0x75,0x43,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0x7B,0x54,0x05,0x11,0xE3,0x18,0x86,0x31,0x61,0x08,0xC6,0x31,0x81,0x08,0xE3,0x18,0x85,0x29,0x20,0x00,0x65,0x29,0x82,0x10,0x61,0x08,0x44,0x29,0x20,0x00,0xE3,0x18,0xC2,0x10,0x20,0x00,0x03,0x19,0x83,0x08,0x39,0x4C,0x9B,0x4C,0xFC,0x4C,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,
-	0x1E,0x5D,0x3E,0x5D,0x1E,0x5D,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,0x1E,0x5D,0x9A,0x4C,0x9A,0x4C,0x1E,0x5D,0x3E,0x5D,0x1D,0x5D,0x38,0x44,0x05,0x09,0xA2,0x10,0xC7,0x39,0xB3,0x3B,0x95,0x3B,0x1C,0x55,0x3E,0x5D,0x1E,0x5D,0x1E,0x5D,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,0x3E,0x5D,0x61,0x08,0x81,0x08,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x04,0x21,0x41,0x08,0xEE,0x52,0xF3,0x73,0x3F,0xBE,0x3F,0xBE,0xFD,0xB5,0x66,0x29,0xA6,0x31,0x61,0x08,0xE3,0x18,0x24,0x21,0x81,0x08,0x2F,0x63,0x3F,0xBE,0x3F,0xBE,0x3F,0xBE,0x3F,0xBE,0x9B,0xA5,0x46,0x21,0xC6,0x31,0xE3,0x18,0xE3,0x18,0x65,0x31,
-	0xC3,0x18,0xE7,0x39,0x82,0x10,0xC6,0x31,0x81,0x08,0xA6,0x31,0xC3,0x18,0x65,0x29,0x04,0x21,0x24,0x21,0xE9,0x31,0x71,0x6B,0x3F,0xBE,0x3F,0xBE,0x3F,0xBE,0x3F,0xBE,0xDC,0xAD,0xA7,0x31,0x40,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xC2,0x10,0x20,0x00,0xA2,0x18,0x20,0x00,0xC3,0x18,0x20,0x00,0x03,0x19,0x20,0x00,0x67,0x11,0xBE,0x5C,0xDE,0x64,
-	0x7C,0x5C,0xBE,0x64,0xBE,0x64,0xBE,0x64,0xBE,0x64,0xBE,0x64,0x1A,0x54,0xA3,0x08,0x81,0x08,0xA2,0x10,0x41,0x08,0x44,0x21,0x20,0x00,0x24,0x21,0xC3,0x18,0x20,0x00,0xA6,0x31,0x61,0x08,0xE3,0x18,0x04,0x21,0x81,0x08,0xE7,0x39,0x81,0x08,0xE3,0x18,0xC7,0x39,0xF2,0x3A,0xBB,0x54,0x7B,0x54,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,
-	0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x9C,0x5C,0xF7,0x43,0xFD,0x54,0x1E,0x5D,0x1E,0x5D,0x74,0x3B,0xC4,0x10,0xC2,0x18,0x41,0x08,0x20,0x00,0xB5,0x3B,0xDC,0x54,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x1E,0x5D,0x61,0x08,0x44,0x21,0xA6,0x31,0x81,0x08,
-	0x86,0x31,0x04,0x21,0xA2,0x10,0x28,0x42,0xC2,0x10,0xC3,0x18,0x08,0x42,0xA2,0x10,0x45,0x29,0x04,0x21,0x50,0x63,0xF9,0x9C,0x1F,0xC6,0x1F,0xC6,0xF9,0x9C,0x82,0x10,0x44,0x21,0x82,0x10,0x61,0x08,0x44,0x21,0x82,0x08,0xD8,0x9C,0x1F,0xC6,0x1F,0xBE,0x1F,0xC6,0x1F,0xC6,0x19,0xA5,0xA3,0x10,0xA2,0x10,0x81,0x08,0x61,0x08,0x03,0x19,
-	0x20,0x00,0x24,0x21,0x00,0x00,0x04,0x21,0x20,0x00,0xE3,0x18,0x61,0x08,0xC2,0x10,0x61,0x08,0x87,0x29,0xE4,0x18,0xF9,0x9C,0x1F,0xBE,0x1F,0xBE,0x1F,0xBE,0x1F,0xBE,0x14,0x7C,0x81,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0xA2,0x10,0x41,0x08,0xA2,0x10,0x41,0x08,0xA2,0x10,0xED,0x29,0x9E,0x64,0x9E,0x64,
-	0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0xD9,0x53,0xA3,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0xA2,0x10,0xA2,0x10,0x40,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0x82,0x10,0x00,0x00,0x82,0x10,0xA9,0x21,0xBC,0x54,0x75,0x43,0xBC,0x54,0xDE,0x5C,0xFE,0x5C,0xDE,0x5C,0xDE,0x5C,
-	0xDE,0x5C,0xDE,0x5C,0xFE,0x5C,0xFE,0x5C,0xDE,0x5C,0xDE,0x5C,0xBC,0x54,0x19,0x4C,0xFE,0x5C,0xFE,0x5C,0xBC,0x54,0xB1,0x32,0x61,0x08,0xC7,0x39,0x65,0x29,0x61,0x08,0xE7,0x39,0x18,0x54,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0xDE,0x5C,0x5B,0x5C,0x05,0x11,0x27,0x19,0x4C,0x3A,0x4D,0x22,
-	0x06,0x11,0x05,0x19,0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0xC2,0x10,0x41,0x08,0x20,0x00,0xC8,0x39,0xCE,0x5A,0xDD,0xBD,0xDE,0xC5,0xDE,0xC5,0x34,0x7C,0x41,0x08,0x82,0x10,0xC2,0x10,0x41,0x08,0x82,0x10,0xC8,0x31,0x9D,0xBD,0xDE,0xC5,0xDE,0xC5,0xDE,0xC5,0xDE,0xC5,0x56,0x8C,0x61,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0x61,0x08,
-	0x82,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x0A,0x42,0xDD,0xBD,0xFE,0xC5,0xFE,0xC5,0xFE,0xC5,0x7C,0xB5,0xE4,0x18,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x40,0x00,0x40,0x00,0xC2,0x10,0x40,0x00,0xE3,0x18,0x41,0x08,0x03,0x19,0x61,0x08,0x04,0x21,0xA2,0x10,0x24,0x21,0x81,0x08,0x44,0x21,0x61,0x08,0x45,0x29,0xD2,0x3A,0x7E,0x64,0x36,0x4B,
-	0x7E,0x64,0x7E,0x64,0x7E,0x64,0x7E,0x64,0x7E,0x64,0x7E,0x64,0xB9,0x53,0x87,0x31,0x20,0x00,0xE3,0x18,0xA2,0x10,0x40,0x00,0x44,0x21,0x00,0x00,0xC3,0x18,0x61,0x08,0x20,0x00,0xE3,0x18,0x20,0x00,0xC3,0x18,0x61,0x08,0x20,0x00,0xE3,0x18,0x62,0x08,0xF9,0x4B,0xDE,0x5C,0x5B,0x5C,0xDE,0x64,0xBE,0x64,0xDE,0x64,0xDE,0x64,0xDE,0x64,
-	0xBE,0x64,0xDE,0x64,0xDE,0x64,0xDE,0x64,0xDE,0x64,0xDE,0x64,0xBD,0x5C,0xBD,0x5C,0xBD,0x5C,0xD7,0x4B,0x28,0x19,0x41,0x08,0x82,0x10,0xC2,0x10,0x20,0x00,0xA2,0x10,0xEB,0x29,0x19,0x54,0xDE,0x64,0xDE,0x64,0xBE,0x64,0xDE,0x64,0xBE,0x64,0xBE,0x64,0xDE,0x64,0xDE,0x64,0xDE,0x64,0x9D,0x5C,0x3A,0x54,0x7C,0x5C,0xBD,0x5C,0xDE,0x64,
-	0x9C,0x5C,0xEB,0x21,0xA2,0x10,0x61,0x08,0x40,0x00,0xC3,0x18,0x20,0x00,0x61,0x08,0xA2,0x10,0x10,0x6B,0x36,0x94,0xBE,0xCD,0xBE,0xCD,0xBE,0xCD,0x0B,0x4A,0xE3,0x18,0x82,0x10,0x40,0x00,0x24,0x21,0x41,0x08,0x98,0xA4,0xBE,0xCD,0xDE,0xC5,0xDE,0xCD,0xDE,0xCD,0xDE,0xC5,0x4C,0x4A,0xE3,0x18,0x03,0x19,0x41,0x08,0x65,0x29,0x20,0x00,
-	0x85,0x29,0x61,0x08,0x24,0x21,0x82,0x10,0xE3,0x18,0x82,0x10,0x61,0x08,0x82,0x10,0x82,0x10,0x87,0x31,0x5B,0xB5,0xDE,0xC5,0xDE,0xC5,0xDE,0xC5,0xBD,0xC5,0x2A,0x42,0xA2,0x10,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x81,0x08,0xA2,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0xE3,0x18,0x61,0x08,0x03,0x19,0x61,0x08,0x24,0x21,0xC2,0x10,0x24,0x21,0xE3,0x18,0x45,0x29,0x04,0x21,0x65,0x29,0xE3,0x18,0xA6,0x31,0x77,0x53,0x5D,0x64,0xEF,0x31,
-	0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0xB9,0x5B,0xC8,0x31,0x61,0x08,0xC6,0x31,0xE3,0x18,0x24,0x21,0xC6,0x31,0x81,0x08,0x08,0x42,0xC2,0x10,0x03,0x19,0x65,0x29,0xA2,0x10,0x08,0x42,0xA2,0x10,0x44,0x21,0xE7,0x39,0xB1,0x32,0xBE,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,
-	0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0xBE,0x64,0x7C,0x5C,0xB2,0x3A,0xB1,0x32,0x55,0x43,0x96,0x43,0xDA,0x53,0x7C,0x5C,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,
-	0xBE,0x64,0xB7,0x4B,0xE3,0x18,0x4E,0x3A,0x61,0x08,0xC7,0x39,0x24,0x21,0x81,0x08,0x08,0x42,0x98,0xA4,0x9E,0xCD,0x9E,0xCD,0x9E,0xCD,0x9E,0xCD,0xE4,0x20,0x45,0x29,0xC7,0x39,0x61,0x08,0x07,0x3A,0x0F,0x6B,0x9E,0xCD,0x9E,0xCD,0x9E,0xCD,0x9E,0xCD,0x9E,0xCD,0x1C,0xBD,0x61,0x08,0x24,0x21,0xC6,0x31,0x61,0x08,0xE7,0x39,0xA2,0x10,
-	0xC6,0x31,0xC3,0x18,0x45,0x29,0xE3,0x18,0xE3,0x18,0xA7,0x31,0x10,0x6B,0x87,0x31,0x2B,0x52,0x5C,0xBD,0xBE,0xCD,0xBE,0xCD,0xBE,0xCD,0x9E,0xCD,0xF4,0x83,0x61,0x08,0xC3,0x18,0x41,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x40,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x40,0x00,0xA2,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0xA2,0x10,0x61,0x08,0x47,0x21,0xBA,0x5B,0xFC,0x63,0xD2,0x3A,
-	0x3E,0x6C,0x3E,0x6C,0x3E,0x6C,0x3E,0x6C,0x3E,0x6C,0x3E,0x6C,0x58,0x53,0xA4,0x10,0x20,0x00,0x04,0x21,0x20,0x00,0xC2,0x10,0xA2,0x10,0x41,0x08,0x24,0x21,0x20,0x00,0xC2,0x10,0x61,0x08,0x41,0x08,0xE3,0x18,0x20,0x00,0xE3,0x18,0xA2,0x10,0x2F,0x32,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,
-	0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,0x9E,0x64,
-	0x9E,0x64,0x7D,0x64,0x6F,0x32,0x1A,0x5C,0x40,0x00,0x82,0x10,0x04,0x21,0x20,0x00,0xE3,0x18,0x57,0xA4,0x7E,0xD5,0x7E,0xD5,0x7E,0xD5,0x7E,0xD5,0x82,0x10,0x41,0x08,0x04,0x21,0x20,0x00,0x67,0x31,0x1C,0xC5,0x7E,0xD5,0x7E,0xD5,0x7E,0xD5,0x7E,0xD5,0x7E,0xD5,0x6C,0x5A,0xA2,0x10,0x41,0x08,0x03,0x19,0x00,0x00,0xE3,0x18,0x20,0x00,
-	0xA2,0x10,0x41,0x08,0x81,0x08,0x61,0x08,0xA8,0x39,0x8E,0x62,0x47,0x29,0x31,0x73,0x1B,0xBD,0x9E,0xCD,0x9E,0xCD,0x9E,0xCD,0x9E,0xCD,0x79,0xAC,0xA3,0x10,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x00,0x00,0x81,0x08,0x40,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0xE6,0x18,0xDC,0x6B,0x9B,0x63,0x18,0x5B,
-	0xFE,0x73,0x1E,0x74,0x1E,0x74,0xFE,0x73,0x1E,0x74,0xFE,0x73,0x16,0x53,0x41,0x08,0xC3,0x18,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x82,0x10,0x81,0x08,0x41,0x08,0xC2,0x10,0x40,0x00,0x82,0x10,0x14,0x43,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,
-	0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,
-	0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0xA2,0x10,0x82,0x10,0x40,0x00,0x82,0x10,0x61,0x08,0xD5,0x9B,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x61,0x08,0x82,0x10,0x20,0x00,0x05,0x21,0xDB,0xBC,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x99,0xB4,0xE4,0x18,0x41,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x41,0x08,0xE3,0x18,
-	0x41,0x08,0xA2,0x10,0x82,0x10,0xC9,0x41,0xEA,0x41,0x32,0x7B,0x3D,0xC5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0xDB,0xBC,0x26,0x29,0x20,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x40,0x00,0x41,0x08,0xA2,0x10,0x61,0x08,0xA2,0x10,0xC2,0x10,0x61,0x08,0x03,0x19,0x61,0x08,0x04,0x21,0x82,0x10,0x03,0x19,0xA2,0x10,0xE3,0x18,0xC3,0x18,0xE3,0x18,0xC3,0x18,0xE3,0x18,0x29,0x21,0xDD,0x6B,0x9C,0x6B,0x9B,0x63,
-	0xFE,0x73,0xFE,0x73,0xFE,0x73,0xFE,0x73,0xFE,0x73,0xFE,0x73,0x16,0x53,0x04,0x21,0xA6,0x31,0x61,0x08,0xC6,0x31,0x82,0x10,0x65,0x29,0xC3,0x18,0xC3,0x18,0xA6,0x31,0x61,0x08,0xA6,0x31,0xC3,0x18,0x03,0x19,0xA6,0x31,0x61,0x08,0x87,0x31,0x99,0x5B,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,
-	0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,
-	0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0x5E,0x6C,0xA2,0x10,0xC7,0x39,0x61,0x08,0x85,0x29,0x45,0x29,0x32,0x83,0x3E,0xD5,0x3E,0xD5,0x3E,0xD5,0x3E,0xDD,0x61,0x08,0xC7,0x39,0xC4,0x18,0xF7,0xA3,0x3E,0xDD,0x3E,0xDD,0x3E,0xDD,0x3E,0xDD,0x3E,0xDD,0x3E,0xDD,0xCF,0x6A,0x24,0x21,0xA2,0x10,0xC6,0x31,0x82,0x10,0xC6,0x31,0x82,0x10,0x85,0x29,
-	0x04,0x21,0x45,0x29,0x65,0x29,0x04,0x21,0xC9,0x41,0x1C,0xCD,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0x5E,0xD5,0xC9,0x41,0xE3,0x18,0xA2,0x10,0xC3,0x18,0x41,0x08,0xA2,0x10,0x40,0x00,0x40,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0xE3,0x18,0x40,0x00,0xE3,0x18,0x61,0x08,0xE3,0x18,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x52,0x42,0xBE,0x73,0xBE,0x73,0xBE,0x73,
-	0xBE,0x73,0xBE,0x73,0xDE,0x73,0xBE,0x73,0xBE,0x73,0xBE,0x73,0xD6,0x52,0xC3,0x18,0x65,0x29,0x40,0x00,0x86,0x31,0x61,0x08,0x04,0x21,0xC2,0x10,0x82,0x10,0x65,0x29,0x41,0x08,0x65,0x29,0xA2,0x10,0xA2,0x10,0x85,0x29,0x41,0x08,0x66,0x29,0xB3,0x42,0xDB,0x63,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,
-	0x1E,0x6C,0x1E,0x74,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x74,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,0x1E,0x6C,
-	0x1E,0x6C,0x1E,0x6C,0x1E,0x74,0x1E,0x74,0x82,0x10,0x65,0x29,0x40,0x00,0x45,0x29,0xE3,0x18,0xCA,0x49,0xFE,0xDC,0xFE,0xDC,0x1E,0xDD,0xFE,0xDC,0x46,0x31,0xC7,0x39,0x33,0x8B,0xFE,0xDC,0xFE,0xDC,0xFE,0xDC,0xFE,0xDC,0xFE,0xDC,0xFE,0xDC,0xB6,0xA3,0xC3,0x18,0x03,0x19,0x82,0x10,0x65,0x29,0x41,0x08,0x86,0x31,0x41,0x08,0x65,0x29,
-	0xC3,0x18,0x24,0x21,0x24,0x21,0x88,0x41,0xFC,0xCC,0x3E,0xDD,0x3E,0xDD,0x1E,0xDD,0x3E,0xDD,0x1E,0xDD,0x1D,0xD5,0x17,0xA4,0xF0,0x72,0x25,0x21,0x82,0x10,0xC3,0x18,0x20,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0xD8,0x5A,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,
-	0x9E,0x7B,0x9E,0x7B,0xBE,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x95,0x5A,0x61,0x08,0xA2,0x10,0x61,0x08,0x81,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x81,0x08,0x41,0x08,0x81,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x8A,0x29,0xFD,0x6B,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,
-	0x1E,0x74,0x1E,0x74,0xFE,0x73,0xFE,0x73,0xFE,0x73,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0xFE,0x73,0xFE,0x73,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0xFE,0x73,0x1E,0x74,0x1E,0x74,0x1E,0x74,0x1E,0x74,0xFE,0x73,0xFE,0x73,0x1E,0x74,0x1E,0x74,
-	0xFE,0x73,0x1E,0x74,0x1E,0x74,0xFE,0x73,0xA2,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0xE5,0x28,0xFE,0xE4,0xFE,0xDC,0xFE,0xE4,0xFE,0xDC,0xEA,0x51,0x75,0x9B,0xFE,0xDC,0xFE,0xDC,0xFE,0xDC,0xFE,0xDC,0xFE,0xDC,0xFE,0xDC,0x7A,0xC4,0x26,0x31,0xA2,0x10,0x61,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0xA2,0x10,0x61,0x08,0xA2,0x10,
-	0x41,0x08,0xA2,0x10,0xCA,0x49,0x17,0xAC,0x1E,0xDD,0x1E,0xDD,0x1E,0xDD,0xFE,0xDC,0x1E,0xDD,0x1E,0xDD,0xFD,0xD4,0x18,0xB4,0x18,0xB4,0x17,0xAC,0xD7,0xAB,0xB6,0xA3,0x47,0x31,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0xC3,0x18,0x41,0x08,0xC3,0x18,0x61,0x08,0xC3,0x18,0x61,0x08,0xC3,0x18,0x62,0x08,0x5D,0x73,0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,
-	0x7E,0x7B,0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,0xCF,0x41,0xE3,0x18,0x20,0x00,0x44,0x21,0x40,0x00,0xC2,0x10,0xC2,0x10,0x20,0x00,0x44,0x21,0x20,0x00,0xC3,0x18,0x81,0x10,0x41,0x08,0x24,0x21,0x20,0x00,0x03,0x19,0xC3,0x18,0x21,0x00,0x93,0x42,0xDD,0x6B,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,
-	0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,
-	0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0x41,0x08,0xC3,0x18,0x45,0x29,0x20,0x00,0x24,0x21,0x61,0x08,0xF8,0xB3,0x5B,0xCC,0xBE,0xE4,0xBE,0xE4,0x1A,0xCC,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0x9C,0xDC,0x0C,0x5A,0x24,0x21,0x20,0x00,0xC3,0x18,0xA2,0x10,0x41,0x08,0x24,0x21,0x20,0x00,0x04,0x21,0x20,0x00,
-	0xE5,0x20,0xD2,0x82,0xF8,0xB3,0xDD,0xDC,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xFE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0x7B,0xCC,0xAA,0x51,0x62,0x10,0x41,0x08,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x81,0x08,0xA2,0x10,0x61,0x08,0xA2,0x10,0x81,0x08,0x61,0x08,0x03,0x19,0x61,0x08,0x24,0x21,0xA2,0x10,0x44,0x21,0xE3,0x18,0x45,0x29,0x04,0x21,0x65,0x29,0x24,0x21,0x86,0x31,0xC9,0x20,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,
-	0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x08,0x29,0xE7,0x39,0x81,0x08,0xE7,0x39,0x03,0x19,0x24,0x21,0xC7,0x39,0x61,0x08,0xE7,0x39,0xC2,0x10,0xE3,0x18,0x86,0x31,0x82,0x10,0xE7,0x39,0xA2,0x10,0xE3,0x18,0xC7,0x39,0x8A,0x29,0xDF,0x7B,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,
-	0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,
-	0xDE,0x73,0xDE,0x73,0xDE,0x73,0xDE,0x73,0x40,0x00,0xA6,0x31,0xE3,0x18,0x81,0x08,0xE7,0x39,0x61,0x08,0xEC,0x61,0x35,0x9B,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0x9D,0xE4,0x4E,0x72,0xC2,0x10,0x07,0x3A,0x81,0x08,0xC6,0x31,0x24,0x21,0x24,0x21,0xC7,0x39,0x81,0x08,0x07,0x3A,0x05,0x29,
-	0xB7,0xAB,0x1A,0xC4,0xBE,0xE4,0xBE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xBE,0xE4,0xBE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xDE,0xE4,0xBC,0xD4,0xA2,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0xC3,0x18,0x00,0x00,0xC3,0x18,0x20,0x00,0xC3,0x18,0x41,0x08,0xE3,0x18,0x40,0x00,0x03,0x19,0xD0,0x41,0x3F,0x83,0x3F,0x83,0x3F,0x83,0x1F,0x83,
-	0x1F,0x83,0x3F,0x83,0x1F,0x83,0x1F,0x83,0x3F,0x83,0xBC,0x7A,0x20,0x00,0x03,0x19,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0x20,0x00,0x81,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x54,0x52,0xBE,0x7B,0x9E,0x7B,0x9F,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,
-	0x9F,0x7B,0x9F,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9F,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9F,0x7B,0x9F,0x7B,0x9F,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9F,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9E,0x7B,0x9F,0x7B,0x9F,0x7B,0x9F,0x7B,0x9E,0x7B,0x9F,0x7B,0x9E,0x73,0xB5,0x52,
-	0xAF,0x39,0xEF,0x41,0xAF,0x39,0xCF,0x39,0x41,0x08,0x81,0x08,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0xE4,0x20,0x27,0x31,0xFA,0xCB,0x77,0xB3,0x7D,0xE4,0x5C,0xDC,0x5C,0xDC,0x35,0xA3,0x2E,0x6A,0x97,0xB3,0x6F,0x7A,0x41,0x08,0x41,0x08,0xC3,0x18,0x00,0x00,0x04,0x21,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x04,0x21,0x00,0x00,
-	0xEA,0x51,0x7C,0xDC,0x9E,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0x9E,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0x9E,0xE4,0xBE,0xE4,0xBE,0xE4,0xBE,0xE4,0xF2,0x8A,0x61,0x08,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x81,0x08,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0x81,0x08,0x55,0x5A,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,
-	0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x16,0x5A,0xA2,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0xC2,0x10,0x41,0x08,0x61,0x08,0xC2,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x40,0x00,0xC3,0x18,0x00,0x00,0x96,0x5A,0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,0x7E,0x7B,0x7F,0x7B,0x7E,0x7B,0x7E,0x7B,0x7E,0x7B,
-	0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,0x7E,0x7B,0x7F,0x7B,0x7E,0x7B,0x7E,0x7B,0x7F,0x7B,0x7E,0x7B,0x7F,0x7B,0x7E,0x7B,0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,0x7E,0x7B,0x7E,0x7B,0x7E,0x7B,0x7F,0x7B,0x7E,0x7B,0x7E,0x7B,0x7F,0x7B,0x7E,0x7B,0x7E,0x7B,0x7E,0x7B,0x7F,0x7B,0x7F,0x7B,0x7F,0x7B,0x5D,0x7B,0x5D,0x73,0x7F,0x7B,0x95,0x52,0xA3,0x10,
-	0xC3,0x18,0x24,0x21,0x20,0x00,0x24,0x21,0xA2,0x10,0x20,0x00,0x24,0x21,0x41,0x08,0x41,0x08,0xC2,0x10,0x00,0x00,0xC3,0x18,0xCB,0x59,0x26,0x31,0x0D,0x62,0x77,0xB3,0x70,0x7A,0x48,0x39,0xA4,0x20,0xE4,0x20,0x40,0x00,0x82,0x10,0x82,0x10,0x61,0x08,0xC2,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0x81,0x08,0xA2,0x10,0x61,0x08,0xA3,0x18,
-	0xD9,0xC3,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x9E,0xEC,0x1A,0xCC,0xC5,0x28,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0xC2,0x10,0x20,0x00,0xC3,0x18,0x40,0x00,0xC3,0x18,0x41,0x08,0xE3,0x18,0x41,0x08,0xE3,0x18,0x42,0x08,0x59,0x6A,0xFF,0x8A,0xDF,0x8A,0xFF,0x8A,0xDF,0x8A,
-	0xFF,0x8A,0xFF,0x8A,0xFF,0x8A,0xDF,0x8A,0xDF,0x8A,0x6F,0x41,0x65,0x29,0x61,0x08,0xC2,0x10,0xE3,0x18,0x61,0x08,0xA6,0x31,0x40,0x00,0x65,0x29,0x44,0x21,0x61,0x08,0xE7,0x39,0xA2,0x10,0x03,0x19,0x65,0x29,0xA2,0x10,0x08,0x42,0xC3,0x18,0xCF,0x41,0xFA,0x6A,0x5E,0x7B,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,
-	0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5E,0x7B,0x3D,0x7B,0x3C,0x73,0x1C,0x73,0xDA,0x6A,0xDA,0x6A,0xB7,0x62,0x55,0x52,0x13,0x4A,0xF1,0x41,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x5F,0x83,0x3C,0x73,0x74,0x52,0x78,0x62,0x62,0x08,0x2C,0x31,0x24,0x21,0x61,0x08,
-	0x86,0x31,0xC3,0x18,0xA2,0x10,0xE7,0x39,0x82,0x10,0x03,0x21,0xC7,0x39,0x81,0x08,0x85,0x29,0x04,0x21,0xA2,0x10,0x08,0x42,0x81,0x08,0x24,0x21,0xC6,0x31,0x48,0x41,0x2D,0x62,0x47,0x39,0xA2,0x10,0x86,0x31,0x40,0x00,0xA6,0x31,0x81,0x08,0xC2,0x10,0x65,0x29,0x20,0x00,0x65,0x29,0x61,0x08,0xC3,0x18,0x82,0x10,0x61,0x08,0xF2,0x8A,
-	0xB9,0xC3,0x5D,0xE4,0x7E,0xEC,0x7E,0xEC,0x7E,0xEC,0x7E,0xEC,0x7E,0xEC,0x7E,0xEC,0x1B,0xD4,0xB9,0xC3,0x77,0xB3,0xF3,0x92,0x4F,0x72,0xEC,0x59,0xCB,0x59,0xAB,0x51,0x62,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x40,0x00,0xA2,0x10,0x82,0x10,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x04,0x21,0x61,0x08,0x44,0x21,0x81,0x10,0x65,0x29,0x82,0x10,0x65,0x29,0x82,0x10,0xA6,0x31,0xA6,0x18,0x7C,0x7A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,
-	0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xBD,0x82,0xC7,0x20,0x44,0x21,0xC2,0x10,0x81,0x08,0x65,0x29,0x20,0x00,0x65,0x29,0x61,0x08,0x82,0x10,0x45,0x29,0x20,0x00,0x04,0x21,0x61,0x08,0x41,0x08,0x04,0x21,0x00,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0xC5,0x18,0x4B,0x31,0xB8,0x62,0x3E,0x83,0x3F,0x83,0x3F,0x83,0x3F,0x83,0xFD,0x7A,
-	0xFB,0x6A,0x97,0x62,0x76,0x5A,0xB2,0x41,0x6F,0x39,0x09,0x29,0xC7,0x20,0x49,0x29,0xE6,0x18,0xA5,0x10,0x47,0x29,0x83,0x10,0x61,0x08,0xA6,0x31,0x82,0x10,0xC9,0x20,0x3F,0x83,0x3F,0x83,0x3F,0x83,0x3F,0x83,0x3F,0x83,0x3F,0x83,0x3F,0x83,0x3F,0x83,0x3F,0x83,0xDB,0x6A,0x61,0x08,0x84,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0xC2,0x18,
-	0x41,0x08,0x20,0x00,0xC2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0xE3,0x18,0x41,0x08,0x81,0x08,0xC2,0x10,0x20,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0x45,0x29,0x41,0x08,0xA2,0x10,0xC2,0x10,0x41,0x08,0x65,0x29,0x20,0x00,0x44,0x21,0x04,0x21,0x61,0x08,0xA6,0x31,0x61,0x08,0x86,0x31,0xA2,0x10,0xE3,0x18,0x24,0x21,
-	0xE4,0x20,0x4E,0x72,0xFA,0xCB,0x5E,0xEC,0x5E,0xEC,0x5E,0xEC,0x35,0xA3,0x8A,0x49,0x67,0x39,0x66,0x31,0xA3,0x18,0x04,0x21,0xA2,0x10,0x04,0x21,0x61,0x08,0xE3,0x18,0x40,0x00,0xA2,0x10,0x40,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0xC3,0x18,0x20,0x00,0xC3,0x18,0x20,0x00,0xC3,0x18,0xA6,0x20,0x9D,0x8A,0x9F,0x92,0x9F,0x92,0x9F,0x92,0x9F,0x92,
-	0x9F,0x92,0x9F,0x92,0x9F,0x92,0x9F,0x92,0x5C,0x82,0x85,0x18,0x61,0x08,0xA2,0x10,0x40,0x00,0xA2,0x10,0x61,0x08,0x81,0x08,0x82,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0x61,0x08,0x40,0x00,0xC3,0x18,0x41,0x08,0xA2,0x10,0xC3,0x18,0xEA,0x28,0x0A,0x29,0x2B,0x31,0x20,0x00,0x45,0x29,
-	0x82,0x10,0x41,0x08,0xA6,0x31,0x61,0x08,0xA2,0x10,0xC7,0x39,0x61,0x08,0x24,0x21,0x07,0x3A,0xA2,0x10,0x24,0x21,0xA6,0x31,0x61,0x08,0x45,0x29,0x85,0x29,0x0A,0x29,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x1F,0x83,0x56,0x5A,0x82,0x10,0xA6,0x31,0x24,0x21,0x20,0x00,0x65,0x29,0x81,0x08,
-	0x41,0x08,0x45,0x29,0x41,0x08,0x61,0x08,0x04,0x21,0x20,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0x81,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0x81,0x08,0xA2,0x10,0x20,0x00,0xC3,0x18,0x40,0x00,0xA2,0x10,0x61,0x08,
-	0x41,0x08,0x82,0x10,0x20,0x00,0xC4,0x20,0xE5,0x28,0x62,0x10,0x00,0x00,0xC2,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x40,0x00,0xA2,0x10,0x40,0x00,0xA2,0x10,0x41,0x08,0xED,0x40,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x9F,0x92,0x9F,0x92,
-	0x9F,0x92,0x7F,0x92,0x9F,0x92,0x7F,0x92,0xF9,0x71,0xC4,0x18,0x82,0x10,0x20,0x00,0xE3,0x18,0x00,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0x24,0x21,0x00,0x00,0x24,0x21,0xE3,0x18,0x41,0x08,0xA6,0x31,0x82,0x10,0xC3,0x18,0x85,0x29,0x61,0x08,0xA6,0x31,0x24,0x21,0x61,0x08,0x07,0x3A,0xC3,0x18,0xC3,0x18,0x07,0x3A,0x61,0x08,0x24,0x21,
-	0xC6,0x31,0x40,0x00,0x03,0x19,0xE3,0x18,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0xC2,0x10,0xC3,0x18,0x20,0x00,0x61,0x08,0xC3,0x18,0x61,0x08,0x20,0x00,0x2D,0x39,0x1F,0x83,0xFF,0x8A,0x1F,0x8B,0x1F,0x83,0x1F,0x83,0x1F,0x83,0xFF,0x82,0xFF,0x8A,0xFF,0x8A,0x56,0x62,0x81,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0x45,0x29,0x20,0x00,
-	0x04,0x21,0x45,0x29,0x61,0x08,0xE7,0x39,0x24,0x21,0x61,0x08,0x08,0x42,0xC3,0x18,0xC3,0x18,0xE7,0x39,0x61,0x08,0x45,0x29,0x85,0x29,0x61,0x08,0x65,0x29,0x82,0x10,0x61,0x08,0x45,0x29,0x00,0x00,0x03,0x19,0x82,0x10,0x20,0x00,0x04,0x21,0x00,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0xE3,0x18,0x40,0x00,0x82,0x10,
-	0x61,0x08,0x40,0x00,0xC2,0x18,0x20,0x00,0xC3,0x18,0x20,0x00,0xA2,0x10,0x41,0x08,0x81,0x08,0x41,0x08,0x81,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x81,0x08,0x41,0x08,0xA2,0x10,0x40,0x00,0x82,0x10,0x82,0x10,0x41,0x08,0xC2,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x24,0x21,0x41,0x08,0x44,0x21,0x61,0x08,0x76,0x69,0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,
-	0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,0xB4,0x59,0x24,0x21,0xA6,0x31,0x82,0x10,0xE7,0x39,0xC2,0x10,0x24,0x21,0x65,0x29,0xA2,0x10,0x08,0x42,0x81,0x08,0x04,0x21,0xA6,0x31,0x61,0x08,0x85,0x29,0xE3,0x18,0x82,0x10,0xA6,0x31,0x41,0x08,0xA2,0x10,0x45,0x29,0x20,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0xA2,0x10,0x81,0x08,0x41,0x08,
-	0x61,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0xE3,0x18,0x61,0x08,0x41,0x08,0x24,0x21,0x82,0x10,0x61,0x08,0xC6,0x39,0xE3,0x18,0x4F,0x49,0xFF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xDF,0x8A,0xD3,0x49,0xA2,0x10,0x61,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x61,0x08,
-	0x82,0x10,0x40,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0xE3,0x18,0x00,0x00,0xC3,0x18,0xE3,0x18,0x41,0x08,0xA6,0x31,0xA2,0x10,0x61,0x08,0xE7,0x39,0x82,0x10,0x03,0x19,0x45,0x29,0xA2,0x10,0xE7,0x39,0xC2,0x10,0x45,0x29,0xC6,0x31,0x61,0x08,0xE7,0x39,0xE3,0x18,0x04,0x21,0x65,0x29,0xA2,0x10,0xE7,0x39,0x41,0x08,0x86,0x31,
-	0xE3,0x18,0x03,0x19,0x44,0x21,0x61,0x08,0x65,0x29,0x20,0x00,0x65,0x29,0x41,0x08,0x24,0x29,0x41,0x08,0x04,0x21,0x41,0x08,0xE3,0x18,0x20,0x00,0xC2,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x81,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0xE3,0x18,0x41,0x08,0x04,0x21,0x61,0x08,0x04,0x21,0x61,0x08,0xDA,0x81,0x3F,0x9A,0x3F,0x9A,0x3F,0x9A,0x3F,0x9A,0x3F,0x9A,
-	0x3F,0x9A,0x3F,0x9A,0x3F,0x9A,0x3F,0x9A,0xEE,0x40,0x40,0x00,0x24,0x21,0x20,0x00,0xC2,0x10,0x82,0x10,0x41,0x08,0xE3,0x18,0x20,0x00,0xC2,0x10,0x82,0x10,0x41,0x08,0xC3,0x18,0x40,0x00,0x61,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x41,0x08,0x24,0x21,
-	0x40,0x00,0x81,0x08,0xC6,0x31,0x81,0x08,0xE3,0x18,0xE7,0x39,0x61,0x08,0x24,0x21,0x07,0x3A,0x61,0x08,0xE3,0x18,0x65,0x29,0x41,0x08,0x82,0x10,0xE3,0x18,0x14,0x5A,0xBF,0x8A,0xBF,0x8A,0xBF,0x8A,0xBF,0x8A,0xBF,0x8A,0xBF,0x8A,0xBF,0x8A,0xBF,0x8A,0xBF,0x8A,0x91,0x41,0x81,0x08,0xA6,0x31,0x65,0x29,0x61,0x08,0x65,0x29,0xE3,0x18,
-	0x41,0x08,0x24,0x21,0x61,0x08,0x00,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x00,0x00,0xE3,0x18,0x82,0x10,0x40,0x00,0x24,0x21,0x20,0x00,0xC3,0x18,0x81,0x08,0x61,0x08,0x03,0x19,0x20,0x00,0x65,0x29,
-	0x20,0x00,0x24,0x21,0xC3,0x18,0xA2,0x10,0x24,0x21,0x41,0x08,0x45,0x29,0x20,0x00,0x44,0x21,0x20,0x00,0x24,0x21,0x20,0x00,0xE3,0x18,0x20,0x00,0xC2,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x40,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0x40,0x00,0x41,0x08,0x41,0x08,0x63,0x10,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,
-	0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x46,0x18,0x61,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0x82,0x10,0x81,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0x20,0x00,0xC2,0x10,0xA2,0x10,0x20,0x00,0x24,0x21,0x61,0x08,0x61,0x08,0x65,0x29,0x20,0x00,0x03,0x19,0xA6,0x31,0x82,0x10,0x45,0x29,0x65,0x29,0x82,0x10,0xC6,0x31,
-	0x44,0x21,0x61,0x08,0x65,0x29,0xE3,0x18,0x41,0x08,0x04,0x21,0x81,0x08,0x00,0x00,0x81,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0xC3,0x18,0xA2,0x10,0x43,0x10,0x3A,0x72,0x9F,0x92,0x9F,0x92,0x9F,0x92,0x9F,0x92,0x9F,0x92,0x9F,0x92,0x9F,0x92,0x9F,0x92,0x9F,0x92,0xD6,0x61,0x61,0x08,0x24,0x21,0x41,0x08,0x81,0x08,0xC7,0x39,0x82,0x10,
-	0xE3,0x18,0xE7,0x39,0x61,0x08,0x24,0x21,0xE7,0x39,0x82,0x10,0x24,0x21,0x24,0x21,0x40,0x00,0x65,0x29,0xA2,0x10,0x20,0x00,0x04,0x21,0x41,0x08,0x61,0x08,0xC3,0x18,0x00,0x00,0xC2,0x10,0x82,0x10,0x41,0x08,0xC2,0x10,0x40,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x81,0x08,0x61,0x08,0xA2,0x10,
-	0x61,0x08,0xA2,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0xAC,0x38,0xFF,0x99,0xFF,0x99,0xFF,0x99,0xFF,0x99,0xFF,0x99,0xFF,0x99,
-	0xFF,0x99,0xFF,0x99,0xFF,0x99,0xDC,0x89,0x20,0x00,0x45,0x29,0x20,0x00,0x44,0x21,0x03,0x19,0x61,0x08,0xC7,0x39,0x82,0x10,0x04,0x21,0x24,0x21,0x82,0x10,0x07,0x3A,0xC2,0x10,0xE3,0x18,0x08,0x42,0xA2,0x10,0x24,0x21,0x24,0x21,0x61,0x08,0x65,0x29,0xC3,0x18,0x20,0x00,0x03,0x19,0x41,0x08,0x41,0x08,0xC2,0x10,0x81,0x08,0x61,0x08,
-	0xA2,0x10,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0x24,0x21,0x82,0x10,0x61,0x08,0xA6,0x31,0xC2,0x10,0x81,0x08,0xE7,0x39,0x89,0x39,0x3C,0x82,0x9F,0x92,0x7F,0x92,0x9F,0x92,0x9F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0x7F,0x92,0xD6,0x61,0x61,0x08,0x20,0x00,0x81,0x08,0x61,0x08,0x61,0x08,0x61,0x08,
-	0xC3,0x18,0x82,0x10,0x20,0x00,0xE3,0x18,0x61,0x08,0x41,0x08,0x24,0x21,0x41,0x08,0x61,0x08,0x86,0x31,0x41,0x08,0x04,0x21,0xC7,0x39,0x82,0x10,0x86,0x31,0x03,0x19,0xA2,0x10,0x08,0x42,0x81,0x08,0x03,0x19,0xA6,0x31,0x61,0x08,0x65,0x29,0xA2,0x10,0x82,0x10,0x65,0x29,0x20,0x00,0x44,0x21,0x61,0x08,0x82,0x10,0x04,0x21,0x00,0x00,
-	0x03,0x19,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x40,0x00,0xE3,0x18,0x41,0x08,0xE3,0x18,0x82,0x10,0x04,0x21,0xE3,0x18,0x04,0x21,0x03,0x19,0x24,0x21,0x03,0x19,0x44,0x21,0x44,0x10,0xCC,0x40,0x9A,0x89,0xDF,0xA1,0xDF,0xA1,0xDF,0xA1,0xDF,0xA1,
-	0xDF,0xA1,0xDF,0xA1,0xDF,0xA1,0x15,0x69,0x81,0x08,0xC7,0x39,0xC3,0x18,0x03,0x19,0xA6,0x31,0x61,0x08,0x85,0x31,0xA2,0x10,0x82,0x10,0x65,0x29,0x20,0x00,0xE3,0x18,0xA2,0x10,0x00,0x00,0xC2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x40,0x00,0x61,0x08,0x81,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0xC3,0x18,
-	0x20,0x00,0xC3,0x18,0x44,0x21,0x40,0x00,0x04,0x21,0xA6,0x31,0x81,0x08,0x45,0x29,0xC7,0x39,0x61,0x08,0xA2,0x10,0x24,0x21,0x61,0x08,0x40,0x00,0xA5,0x18,0xF9,0x79,0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,0x5F,0x92,0xB6,0x61,0x81,0x08,0x65,0x29,0xC7,0x39,0x40,0x00,0xE3,0x18,0xE3,0x18,
-	0x20,0x00,0xA2,0x10,0xC3,0x18,0x00,0x00,0x82,0x10,0xC2,0x18,0x20,0x00,0x41,0x08,0xC3,0x18,0x61,0x08,0x40,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0xC3,0x18,0x20,0x00,0x61,0x08,0x03,0x19,0x20,0x00,0x44,0x21,0x03,0x19,0x41,0x08,0xC7,0x39,0x82,0x10,0x03,0x19,0x24,0x21,0xA2,0x10,0xE7,0x39,0x61,0x08,0xA6,0x31,0x65,0x29,0xE3,0x18,
-	0xE7,0x39,0x82,0x10,0xC6,0x31,0xC2,0x10,0x65,0x29,0xC2,0x10,0xE3,0x18,0xE3,0x18,0x82,0x10,0x04,0x21,0x82,0x10,0xE3,0x18,0x61,0x08,0xC3,0x18,0x61,0x08,0x61,0x08,0x81,0x08,0x40,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xC2,0x10,0x20,0x00,0xE3,0x18,0x20,0x00,0xE3,0x18,0x20,0x00,0x03,0x19,0xAC,0x40,0xBF,0xA1,0xBF,0xA1,0xBF,0xA1,0xBF,0xA1,
-	0xBF,0xA1,0xBF,0xA1,0xBF,0xA1,0xD1,0x58,0x41,0x08,0xA2,0x10,0x82,0x10,0x41,0x08,0xA2,0x10,0x40,0x00,0x61,0x08,0xA2,0x18,0x41,0x08,0x41,0x08,0xC2,0x10,0x81,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0xC2,0x10,0x00,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x86,0x31,0x04,0x21,0x61,0x08,0xC7,0x39,0xE3,0x18,0xC2,0x10,0x08,0x42,
-	0xE3,0x18,0x41,0x08,0x65,0x29,0xA2,0x10,0x41,0x08,0xE3,0x18,0xA2,0x10,0x40,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0xA2,0x10,0x45,0x29,0x61,0x08,0xC6,0x20,0xFA,0x79,0x5F,0x9A,0x3F,0x9A,0x3F,0x9A,0x3F,0x9A,0x3F,0x9A,0x5F,0x92,0x5F,0x9A,0x3F,0x9A,0xB6,0x69,0x61,0x08,0xE3,0x18,0x61,0x08,0x61,0x08,0x85,0x29,0x82,0x10,
-	0xA2,0x10,0x08,0x42,0xA2,0x10,0xA2,0x10,0x08,0x42,0xA2,0x10,0xA2,0x10,0xA6,0x31,0x41,0x08,0xA2,0x10,0x24,0x21,0x00,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0x04,0x21,0x41,0x08,0xA2,0x10,
-	0xC3,0x18,0x20,0x00,0x24,0x21,0x20,0x00,0xE3,0x18,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x40,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0xF2,0x60,0x9E,0x99,0x9F,0xA1,0x9F,0xA1,
-	0x9F,0xA1,0x9F,0xA1,0x9F,0xA1,0xD1,0x58,0xA2,0x10,0x61,0x08,0x40,0x00,0xC3,0x18,0x00,0x00,0xE3,0x18,0xA2,0x10,0x40,0x00,0x45,0x29,0x41,0x08,0xA2,0x10,0x24,0x21,0x20,0x00,0xA6,0x31,0x03,0x19,0x82,0x10,0x08,0x42,0xC3,0x18,0xC2,0x10,0xE7,0x39,0x61,0x08,0xE3,0x18,0xA6,0x31,0x41,0x08,0xA2,0x10,0xE3,0x18,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x41,0x08,0x61,0x08,0xA2,0x18,0x82,0x10,0x41,0x08,0x41,0x08,0x24,0x21,0x82,0x10,0x61,0x08,0xE7,0x39,0x03,0x19,0xA2,0x10,0x85,0x29,0x45,0x29,0x40,0x00,0xC9,0x30,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0xB6,0x69,0x82,0x10,0x41,0x08,0xA2,0x10,0xA2,0x10,0x20,0x00,0x40,0x00,
-	0xA2,0x10,0x61,0x08,0x00,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0x04,0x21,0x04,0x21,0x81,0x08,0xC7,0x39,0x24,0x21,0x61,0x08,0xE7,0x39,0xC3,0x18,0xA2,0x10,0xC7,0x39,0x20,0x00,0xC3,0x18,0x24,0x21,0x20,0x00,0x03,0x19,0x61,0x08,0x41,0x08,0xE3,0x18,0x00,0x00,0xC3,0x18,0x82,0x10,0x61,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0x61,0x08,
-	0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x40,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x61,0x08,0x81,0x08,0xA2,0x10,0x41,0x08,0xC3,0x18,0x20,0x00,0xE3,0x18,0x20,0x00,0xE3,0x18,0x20,0x00,0x03,0x19,0x00,0x00,0x24,0x21,0x20,0x00,0x24,0x21,0xA3,0x10,0x14,0x69,0x7F,0xA9,0x7F,0xA9,
-	0x7F,0xA9,0x5C,0x91,0xF5,0x70,0x49,0x28,0xC3,0x18,0x65,0x29,0x82,0x10,0xE7,0x39,0xA2,0x10,0x24,0x21,0xE7,0x39,0x81,0x08,0xA6,0x31,0xE3,0x18,0x82,0x10,0xC6,0x31,0x41,0x08,0xA2,0x10,0x44,0x21,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x40,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0xA2,0x10,
-	0x20,0x00,0x45,0x29,0x45,0x29,0x82,0x10,0x24,0x21,0xA6,0x31,0x82,0x10,0x24,0x21,0x86,0x31,0x41,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0xCF,0x48,0x1F,0x9A,0xBB,0x89,0xBB,0x89,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x1F,0x9A,0x56,0x71,0x82,0x10,0x65,0x29,0xC6,0x31,0x82,0x10,0xE3,0x18,0x45,0x29,
-	0x40,0x00,0x61,0x08,0xC2,0x18,0x40,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0xA2,0x10,0x41,0x08,0x82,0x10,0xE3,0x18,0x20,0x00,0xC3,0x18,0xC3,0x18,0x20,0x00,0x86,0x31,0xC2,0x10,0x81,0x08,0x07,0x3A,0xA2,0x10,0x45,0x29,0x45,0x29,0xA2,0x10,0x08,0x42,0x81,0x08,0x44,0x21,0xA6,0x31,0x61,0x08,0xC6,0x31,0x82,0x10,
-	0x24,0x21,0xA2,0x10,0x82,0x10,0x24,0x21,0x61,0x08,0x45,0x29,0x00,0x00,0x24,0x21,0x20,0x00,0xE3,0x18,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x81,0x08,0x41,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xE3,0x18,0x61,0x08,0x04,0x21,0x61,0x08,0x24,0x21,0x61,0x08,0x45,0x29,0x81,0x08,0x65,0x29,0xC3,0x18,0x44,0x21,0x24,0x21,0xC3,0x18,0xCD,0x48,0x38,0x81,
-	0x3A,0x89,0x66,0x20,0x04,0x21,0xC3,0x18,0x61,0x08,0x65,0x29,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0xE3,0x18,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x81,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0x24,0x21,0x41,0x08,0x61,0x08,0xE7,0x39,0xA2,0x10,0xC3,0x18,0x28,0x42,
-	0xA2,0x10,0xA2,0x10,0xA6,0x31,0x82,0x10,0x20,0x00,0xC2,0x10,0x81,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0xC2,0x10,0x41,0x08,0x82,0x10,0xA6,0x31,0xC3,0x18,0x82,0x10,0xD1,0x58,0xDF,0xA1,0x79,0x79,0x9A,0x89,0xDF,0xA1,0xFF,0xA1,0xBD,0x99,0xDE,0x99,0xDE,0x99,0x12,0x61,0x41,0x08,0xC3,0x18,0x61,0x08,0x61,0x08,0x86,0x31,0xC2,0x10,
-	0x82,0x10,0xE7,0x39,0x24,0x21,0x61,0x08,0xA6,0x31,0xC2,0x10,0x40,0x00,0x24,0x21,0x61,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x40,0x00,0x61,0x08,0x04,0x21,0x00,0x00,0x44,0x21,0xA2,0x10,0x81,0x08,0x86,0x31,0x41,0x08,
-	0xA6,0x31,0xA2,0x10,0xE3,0x18,0xE3,0x18,0xA2,0x10,0x45,0x29,0x81,0x08,0x45,0x29,0x61,0x08,0x24,0x21,0x41,0x08,0x03,0x19,0x41,0x08,0xE3,0x18,0x41,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x81,0x08,0x20,0x00,0x81,0x10,0x41,0x08,0x81,0x08,0x81,0x08,0x41,0x08,0xC2,0x10,0x20,0x00,0xC2,0x10,0x42,0x10,
-	0x84,0x18,0x62,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x81,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0xC3,0x18,0x20,0x00,0x61,0x08,0x65,0x29,0x61,0x08,0xE3,0x18,0xA6,0x31,0x82,0x10,0x24,0x21,0x86,0x31,0x82,0x10,0x86,0x31,0x65,0x29,0x20,0x00,0xE3,0x18,0xC2,0x10,0x20,0x00,0x82,0x10,
-	0xA2,0x10,0x40,0x00,0x61,0x08,0x81,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0xA6,0x31,0xE3,0x18,0x81,0x08,0xC6,0x31,0x44,0x21,0x41,0x08,0xC3,0x18,0xE3,0x18,0x61,0x08,0xD1,0x58,0xDF,0xA1,0x15,0x69,0x78,0x79,0xDF,0xA1,0xDF,0xA1,0x16,0x71,0xBD,0x99,0x76,0x79,0xC7,0x39,0x82,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x20,0x00,
-	0xC2,0x10,0xC3,0x18,0x20,0x00,0x81,0x08,0x24,0x21,0x41,0x08,0xE3,0x18,0xA6,0x31,0x82,0x10,0x44,0x21,0xC6,0x31,0x82,0x10,0x24,0x21,0x24,0x21,0x61,0x08,0x45,0x29,0x82,0x10,0x00,0x00,0xE3,0x18,0x40,0x00,0x40,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x81,0x08,0x61,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0x61,0x08,
-	0x82,0x10,0x40,0x00,0x82,0x10,0x40,0x00,0x82,0x10,0x41,0x08,0x40,0x00,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x40,0x00,0x61,0x08,0x61,0x08,0x40,0x00,0xA2,0x10,0x20,0x00,0xC3,0x18,0x00,0x00,0x03,0x19,
-	0x61,0x08,0x81,0x08,0xE3,0x18,0x00,0x00,0x24,0x21,0x41,0x08,0x82,0x10,0xE3,0x18,0x40,0x00,0xA6,0x31,0xA2,0x10,0xC3,0x18,0xE7,0x39,0xA2,0x10,0x45,0x29,0x45,0x29,0x82,0x10,0xC6,0x31,0xE3,0x18,0x61,0x08,0x65,0x29,0x81,0x08,0x20,0x00,0xE3,0x18,0x41,0x08,0x41,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0xC2,0x10,0x81,0x08,
-	0x20,0x00,0x44,0x21,0x04,0x21,0x81,0x08,0x86,0x31,0x65,0x29,0x81,0x08,0x04,0x21,0x86,0x31,0x41,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0xA2,0x10,0xAF,0x48,0xBF,0xA1,0x13,0x69,0x56,0x71,0xBF,0xA1,0xBF,0xA1,0xF3,0x60,0x9D,0x99,0x30,0x59,0x44,0x21,0x81,0x08,0x44,0x21,0x08,0x42,0x81,0x08,0x82,0x10,0x45,0x29,
-	0x41,0x08,0x61,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,0x61,0x08,0x41,0x08,0x85,0x29,0xA2,0x10,0xA2,0x10,0xE7,0x39,0x81,0x08,0x04,0x21,0xE7,0x39,0x82,0x10,0x85,0x29,0xE3,0x18,0x61,0x08,0xA6,0x31,0x41,0x08,0xA2,0x10,0x24,0x21,0x20,0x00,0x04,0x21,0x41,0x08,0x61,0x08,0xA2,0x10,
-	0x20,0x00,0x03,0x19,0x20,0x00,0xC2,0x10,0x41,0x08,0x81,0x08,0x81,0x08,0x41,0x08,0xA2,0x10,0x00,0x00,0x81,0x08,0x00,0x00,0x81,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0x61,0x08,0xC3,0x18,0x61,0x08,0xC2,0x10,0x82,0x10,0xE3,0x18,0x82,0x10,0x03,0x19,0x82,0x10,0x45,0x29,0x82,0x10,0x85,0x29,0x61,0x08,0xA6,0x31,0xA2,0x10,0x65,0x29,
-	0x85,0x29,0x82,0x10,0xE7,0x39,0xA2,0x10,0x65,0x29,0xE3,0x18,0x82,0x10,0xC6,0x31,0x20,0x00,0xE3,0x18,0x24,0x21,0x20,0x00,0x04,0x21,0x61,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,0x61,0x08,0x82,0x10,0x40,0x00,0x81,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x61,0x08,0xE3,0x18,0x20,0x00,0xC3,0x18,0xA6,0x31,0xA2,0x10,0xE3,0x18,0x07,0x3A,
-	0x81,0x08,0xC2,0x10,0x65,0x29,0x41,0x08,0x41,0x08,0xA2,0x10,0xC2,0x18,0x41,0x08,0x00,0x00,0x81,0x08,0x65,0x29,0x82,0x10,0xC3,0x18,0x08,0x42,0x44,0x21,0x41,0x08,0x89,0x30,0x9F,0xA1,0x31,0x61,0x75,0x71,0x9F,0xA1,0x9F,0xA1,0xAE,0x48,0x37,0x79,0x46,0x18,0x40,0x00,0x82,0x10,0xA2,0x10,0x82,0x10,0x20,0x00,0x24,0x21,0xE3,0x18,
-	0x61,0x08,0xC6,0x31,0x65,0x29,0x61,0x08,0x44,0x21,0x04,0x21,0x20,0x00,0xC2,0x10,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0xC2,0x18,0x82,0x10,0x20,0x00,0xE3,0x18,0x82,0x10,0x20,0x00,0x24,0x21,0x41,0x08,0x82,0x10,0x24,0x21,0x20,0x00,0x86,0x31,0xE3,0x18,0xA2,0x10,0xE7,0x39,0x82,0x10,0xA6,0x31,0xC3,0x18,
-	0xC3,0x18,0x85,0x29,0x82,0x10,0xA6,0x31,0x61,0x08,0x65,0x29,0xA2,0x10,0x04,0x21,0xE3,0x18,0xA2,0x10,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x81,0x08,0x82,0x10,0x81,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xE3,0x18,0x20,0x00,0xE3,0x18,0x20,0x00,0x24,0x21,0x00,0x00,0x24,0x21,0x41,0x08,0xC3,0x18,0xA2,0x10,0x40,0x00,
-	0x04,0x21,0x00,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x24,0x21,0xA2,0x10,0x20,0x00,0xC6,0x31,0xE3,0x18,0xA2,0x10,0x08,0x42,0xE3,0x18,0x61,0x08,0x85,0x29,0xC3,0x18,0x00,0x00,0x82,0x10,
-	0x82,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x61,0x08,0xC6,0x31,0x03,0x19,0x81,0x08,0x86,0x31,0x44,0x21,0x41,0x08,0x40,0x00,0x61,0x08,0xA2,0x10,0xC7,0x28,0x5C,0x91,0xCE,0x48,0xAD,0x40,0x7F,0xA9,0x5C,0x99,0xC7,0x39,0xA2,0x10,0xC3,0x18,0xE7,0x39,0xA2,0x10,0x20,0x00,0xC2,0x10,0xC3,0x18,0x20,0x00,0x20,0x00,
-	0x61,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0xA6,0x31,0x82,0x10,0xA2,0x10,0x28,0x42,0xA2,0x10,0xA2,0x10,0xE7,0x39,0x81,0x08,0x61,0x08,0x24,0x29,0x20,0x00,0x81,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0xC2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,
-	0x81,0x08,0x61,0x08,0x41,0x08,0xE3,0x18,0x20,0x00,0x03,0x19,0x00,0x00,0xE3,0x18,0x41,0x08,0xA2,0x10,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,
-	0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0xC2,0x10,0x20,0x00,0x61,0x08,0x04,0x21,0x20,0x00,0x65,0x29,0xE3,0x18,0x61,0x08,0xE7,0x39,0xA2,0x10,0xC3,0x18,0x28,0x42,0x82,0x10,0xE3,0x18,0xC6,0x31,0x40,0x00,0x81,0x08,0xE3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x40,0x00,
-	0x20,0x00,0xA6,0x31,0x03,0x19,0x82,0x10,0x65,0x29,0x65,0x29,0x41,0x08,0x82,0x10,0xE3,0x18,0x81,0x08,0x40,0x00,0x20,0x00,0xC2,0x10,0x65,0x29,0x81,0x08,0xA2,0x10,0xC7,0x39,0xE8,0x30,0xA4,0x18,0x46,0x29,0x17,0x79,0x8C,0x40,0x61,0x08,0x61,0x08,0xC3,0x18,0xC2,0x10,0x41,0x08,0x45,0x29,0xE7,0x39,0xA2,0x10,0xA2,0x10,0xC7,0x39,
-	0x61,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0xC2,0x10,0xC3,0x18,0x20,0x00,0x24,0x21,0x24,0x21,0x82,0x10,0x08,0x42,0x24,0x21,0x81,0x08,0xE7,0x39,0xA2,0x10,0x82,0x10,0x86,0x31,0x20,0x00,0xE3,0x18,0xC3,0x18,0x00,0x00,0xC3,0x18,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x40,0x00,0x61,0x08,0x40,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0x40,0x00,0xA2,0x10,0x20,0x00,0xC2,0x10,0x40,0x00,0xA2,0x10,0x61,0x08,0x81,0x08,0x82,0x10,0x61,0x08,0xE3,0x18,0x41,0x08,0x65,0x29,
-	0x40,0x00,0x44,0x21,0x24,0x21,0x61,0x08,0xC7,0x39,0xA2,0x10,0x44,0x29,0x24,0x21,0xA2,0x10,0x08,0x42,0x81,0x08,0xE3,0x18,0xA6,0x31,0x61,0x08,0xE3,0x18,0xC3,0x18,0x00,0x00,0xA2,0x10,0x81,0x08,0x41,0x08,0x81,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0xE3,0x18,0xC3,0x18,0x20,0x00,0xE3,0x18,0x04,0x21,0x61,0x08,0x45,0x29,0xA6,0x31,
-	0xA2,0x10,0xE3,0x18,0xA6,0x31,0x61,0x08,0x00,0x00,0x61,0x08,0xC2,0x10,0xA2,0x10,0x20,0x00,0x81,0x08,0xA6,0x31,0xE3,0x18,0xA2,0x10,0x86,0x31,0x24,0x21,0x41,0x08,0x20,0x00,0x20,0x00,0x03,0x19,0xC6,0x31,0x82,0x10,0xA2,0x10,0xA6,0x31,0xE3,0x18,0x20,0x00,0x81,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x24,0x21,0x04,0x21,
-	0x81,0x08,0x86,0x31,0xC6,0x31,0x61,0x08,0xC3,0x18,0x24,0x21,0x20,0x00,0x81,0x08,0xE3,0x18,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x41,0x08,0xC2,0x10,0x20,0x00,0x81,0x08,0x45,0x29,0x61,0x08,0x04,0x21,0x04,0x21,0x82,0x10,0x07,0x3A,0xC2,0x10,0x04,0x21,0xE7,0x39,0x82,0x10,0x85,0x29,0xC2,0x10,0x81,0x08,0x65,0x29,
-	0x20,0x00,0x45,0x29,0x41,0x08,0xC3,0x18,0xC2,0x10,0x40,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x81,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x61,0x10,0xA2,0x10,0x82,0x10,0xA2,0x10,0xE3,0x18,0x81,0x08,0x45,0x29,0x61,0x08,0x86,0x31,0x41,0x08,0x44,0x21,
-	0xC3,0x18,0x61,0x08,0x45,0x29,0x20,0x00,0xE3,0x18,0x61,0x08,0x41,0x08,0xC3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x40,0x00,0x61,0x08,0x81,0x08,0x61,0x08,0x41,0x08,0xA2,0x10,0x40,0x00,0x41,0x08,0x04,0x21,0x41,0x08,0x61,0x08,0xE7,0x39,0x82,0x10,0xC2,0x10,0x28,0x42,0xA2,0x10,0x82,0x10,0x65,0x29,0x61,0x08,0x41,0x08,0xA2,0x10,
-	0xC3,0x18,0x41,0x08,0x40,0x00,0x81,0x08,0x24,0x21,0x61,0x08,0xA2,0x10,0xE7,0x39,0x65,0x29,0x40,0x00,0xC3,0x18,0xC2,0x10,0x81,0x08,0x20,0x00,0x20,0x00,0xC2,0x10,0xC7,0x39,0x24,0x21,0x20,0x00,0x20,0x00,0x41,0x08,0xA2,0x10,0xE3,0x18,0x40,0x00,0x04,0x21,0x08,0x42,0xA2,0x10,0x41,0x08,0x04,0x21,0xA2,0x10,0x20,0x00,0x20,0x00,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0x65,0x29,0xA2,0x10,0x81,0x08,0x08,0x42,0x04,0x21,0x61,0x08,0x85,0x29,0xC2,0x10,0x41,0x08,0x04,0x21,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0x81,0x08,0x61,0x08,0x41,0x08,0x81,0x08,0xA2,0x10,0x00,0x00,0xE3,0x18,0x82,0x10,0x40,0x00,0x45,0x29,0x41,0x08,0xC3,0x18,0xA2,0x10,
-	0x61,0x08,0x45,0x29,0x20,0x00,0x65,0x29,0x81,0x08,0x03,0x19,0xE3,0x18,0xA2,0x10,0xE3,0x18,0x61,0x08,0xC3,0x18,0x40,0x00,0xA2,0x10,0x20,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x81,0x08,0x61,0x08,0x61,0x08,
-	0x82,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0xC2,0x10,0x61,0x08,0x20,0x00,0x04,0x21,0x40,0x00,0x81,0x08,0x45,0x29,0x41,0x08,0x03,0x19,0x65,0x29,0x81,0x08,0xA6,0x31,0x85,0x29,0x61,0x08,0x24,0x21,0x03,0x19,0x00,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,
-	0x41,0x08,0xA6,0x31,0x04,0x21,0x81,0x08,0x85,0x29,0x44,0x21,0x61,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x82,0x10,0x20,0x00,0xC3,0x18,0xE7,0x39,0xE3,0x18,0x61,0x08,0x04,0x21,0x82,0x10,0xC2,0x10,0xE7,0x39,0xE3,0x18,0x20,0x00,0xA2,0x10,0x81,0x08,0x82,0x10,0x82,0x10,0x20,0x00,0x24,0x21,0xE7,0x39,0xA2,0x10,0xC3,0x18,0xA6,0x31,
-	0x81,0x08,0x20,0x00,0xC2,0x10,0xC2,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0xA2,0x10,0x00,0x00,0x82,0x10,0xA6,0x31,0x81,0x08,0xE3,0x18,0xE7,0x39,0x61,0x08,0x24,0x21,0xC6,0x31,0x40,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x03,0x19,0x81,0x08,0x61,0x08,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x40,0x00,0x61,0x08,0x82,0x10,0x41,0x08,
-	0x61,0x08,0x41,0x08,0x40,0x00,0x81,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x82,0x10,0x00,0x00,0x82,0x10,0x00,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0xA2,0x10,
-	0x20,0x00,0x24,0x21,0x20,0x00,0x03,0x19,0x24,0x21,0x41,0x08,0xA6,0x31,0xA2,0x10,0xE3,0x18,0xA6,0x31,0x81,0x08,0xA6,0x31,0x65,0x29,0x61,0x08,0x85,0x29,0xA2,0x10,0x41,0x08,0x24,0x21,0x61,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0x40,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,0x45,0x29,0x24,0x21,0x82,0x10,0x45,0x29,0xA6,0x31,
-	0x61,0x08,0xA2,0x10,0x04,0x21,0x61,0x08,0x40,0x00,0x41,0x08,0x82,0x10,0xE3,0x18,0x41,0x08,0x82,0x10,0x07,0x3A,0x24,0x21,0x40,0x00,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x81,0x08,0xC2,0x10,0xA2,0x10,0x41,0x08,0xE3,0x18,0x08,0x42,0xE3,0x18,0x61,0x08,0xC3,0x18,0x82,0x10,0x41,0x08,0x61,0x08,0x41,0x08,0xC2,0x10,0xC3,0x18,
-	0x40,0x00,0x65,0x29,0xC7,0x39,0x82,0x10,0xC2,0x10,0x65,0x29,0x40,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x81,0x08,0x20,0x00,0x24,0x21,0x61,0x08,0x41,0x08,0xC7,0x39,0x82,0x10,0xE3,0x18,0xE7,0x39,0x61,0x08,0x86,0x31,0x65,0x29,0x61,0x08,0xA6,0x31,0x82,0x10,0xA2,0x10,0x04,0x21,0x20,0x00,0x24,0x21,
-	0x20,0x00,0x81,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x40,0x00,0xC3,0x18,0x40,0x00,0xE3,0x18,0x61,0x08,0x04,0x21,0x61,0x08,0x24,0x21,0x81,0x08,0x04,0x21,0xA2,0x10,0xC2,0x10,0x44,0x21,0xA2,0x10,0xA6,0x31,
-	0x61,0x08,0x65,0x29,0x24,0x21,0x82,0x10,0xA6,0x31,0x61,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0x45,0x29,0x41,0x08,0x41,0x08,0xC2,0x10,0x41,0x08,0x61,0x08,0xC2,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0xC2,0x10,0x20,0x00,0x81,0x08,0x44,0x21,0x41,0x08,0x03,0x19,0xE7,0x39,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x81,0x08,0x20,0x00,0x82,0x10,
-	0xA2,0x10,0x61,0x08,0x20,0x00,0x82,0x10,0x44,0x21,0x82,0x10,0x82,0x10,0xC7,0x39,0x45,0x29,0x40,0x00,0x41,0x08,0x61,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0xC2,0x10,0xE7,0x39,0x24,0x21,0x20,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x61,0x08,0x41,0x08,0x04,0x21,0x08,0x42,0xA2,0x10,0x61,0x08,0x24,0x21,0xC3,0x18,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x65,0x29,0xE3,0x18,0x82,0x10,0xA6,0x31,0x85,0x29,0x40,0x00,0x03,0x19,0xC3,0x18,0x20,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x24,0x21,0x41,0x08,0x81,0x08,0x65,0x29,0x61,0x08,0x45,0x29,0xC3,0x18,0xA2,0x10,0x86,0x31,
-	0x61,0x08,0x86,0x31,0xC2,0x10,0xE3,0x18,0x24,0x21,0x61,0x08,0x24,0x21,0x41,0x08,0x03,0x19,0x40,0x00,0xE3,0x18,0x40,0x00,0xA2,0x10,0x20,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x40,0x00,0x41,0x08,0x40,0x00,0x41,0x08,0x82,0x10,0x20,0x00,0xE3,0x18,0x20,0x00,0xA2,0x10,
-	0x61,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x81,0x08,0x81,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0xC2,0x10,0xC3,0x18,0x41,0x08,0x65,0x29,0xE3,0x18,0x82,0x10,0xE7,0x39,0x24,0x21,0x61,0x08,0x65,0x29,0xA2,0x10,0x40,0x00,0xC3,0x18,0xA2,0x10,0x20,0x00,0x61,0x08,0x81,0x08,0xA2,0x10,0x20,0x00,
-	0x61,0x08,0xC7,0x39,0x44,0x21,0x82,0x10,0x24,0x21,0xE3,0x18,0x41,0x08,0x81,0x08,0x40,0x00,0x82,0x10,0x24,0x21,0x82,0x10,0xC3,0x18,0xC7,0x39,0x24,0x21,0x20,0x00,0x40,0x00,0x20,0x00,0xE3,0x18,0xE7,0x39,0xC2,0x10,0x61,0x08,0x24,0x21,0xC3,0x18,0x20,0x00,0x82,0x10,0x20,0x00,0xC3,0x18,0x65,0x29,0xA2,0x10,0xE3,0x18,0x08,0x42,
-	0x81,0x08,0x20,0x00,0xA2,0x10,0x81,0x08,0x40,0x00,0x20,0x00,0xA2,0x10,0xC2,0x10,0x40,0x00,0x61,0x08,0xA6,0x31,0x82,0x10,0xC3,0x18,0x08,0x42,0x81,0x08,0xA2,0x10,0xC6,0x31,0x41,0x08,0x61,0x08,0xC3,0x18,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x81,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,
-	0x20,0x00,0xA2,0x10,0x00,0x00,0xC2,0x10,0x40,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x40,0x00,0x61,0x08,0x40,0x00,0x82,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x81,0x08,0x40,0x00,
-	0x41,0x08,0xA2,0x10,0x20,0x00,0x04,0x21,0x41,0x08,0x61,0x08,0x24,0x21,0x20,0x00,0x04,0x21,0xE3,0x18,0x81,0x10,0xE7,0x39,0xC2,0x10,0xA2,0x10,0x08,0x42,0xA2,0x10,0xA2,0x10,0x65,0x29,0x41,0x08,0x61,0x08,0xC2,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x61,0x08,0x40,0x00,0x44,0x21,0xE3,0x18,0x61,0x08,0x86,0x31,0x65,0x31,
-	0x61,0x08,0xA2,0x10,0x03,0x19,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0x24,0x21,0x82,0x10,0x82,0x10,0xA6,0x31,0x24,0x21,0x20,0x00,0x40,0x00,0x20,0x00,0xC3,0x18,0xA6,0x31,0x03,0x19,0x61,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0xE7,0x39,0xC2,0x10,0xA2,0x10,0x45,0x29,0xA2,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0xC3,0x18,0xC3,0x18,
-	0x61,0x08,0x44,0x21,0x07,0x3A,0xA2,0x10,0x81,0x08,0x45,0x29,0x61,0x08,0x61,0x08,0xA2,0x10,0x82,0x10,0x40,0x00,0x40,0x00,0xA2,0x10,0xA2,0x10,0x20,0x00,0x45,0x29,0x24,0x21,0x61,0x08,0xA6,0x31,0x03,0x19,0xA2,0x10,0x08,0x42,0x82,0x10,0xA2,0x10,0x86,0x31,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0x04,0x21,0x20,0x00,0x82,0x10,
-	0x81,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x82,0x10,0x40,0x00,0xC2,0x10,0x41,0x08,0xE3,0x18,0x41,0x08,0xE3,0x18,0x41,0x08,0x04,0x21,0x41,0x08,0x44,0x21,0x61,0x08,0x03,0x19,0xA2,0x10,0xA2,0x10,0x45,0x29,
-	0x82,0x10,0xA6,0x31,0x82,0x10,0x24,0x21,0x85,0x29,0x41,0x08,0x86,0x31,0xA2,0x10,0x61,0x08,0x45,0x29,0x20,0x00,0xA2,0x10,0xE3,0x18,0x20,0x00,0xA2,0x10,0xC2,0x10,0x41,0x08,0x41,0x08,0xC2,0x10,0x81,0x08,0x00,0x00,0xC2,0x10,0x45,0x29,0x61,0x08,0xE3,0x18,0xE7,0x39,0x82,0x10,0xE3,0x18,0x65,0x29,0x41,0x08,0x41,0x08,0x61,0x08,
-	0xC2,0x10,0x61,0x08,0x00,0x00,0x82,0x10,0xC7,0x39,0xE3,0x18,0x82,0x10,0x24,0x21,0xE3,0x18,0x41,0x08,0x40,0x00,0x20,0x00,0x03,0x19,0xE7,0x39,0xE3,0x18,0x61,0x08,0xC3,0x18,0x81,0x08,0xC3,0x18,0xC7,0x39,0x04,0x21,0x41,0x08,0x41,0x08,0x40,0x00,0xE3,0x18,0x44,0x21,0x61,0x08,0xA2,0x10,0xE7,0x39,0xE3,0x18,0x20,0x00,0x61,0x08,
-	0xA2,0x10,0x61,0x08,0x82,0x10,0x41,0x08,0x03,0x19,0x04,0x21,0x82,0x10,0xA6,0x31,0x86,0x31,0x81,0x08,0xE3,0x18,0x03,0x19,0x20,0x00,0x61,0x08,0x82,0x10,0x41,0x08,0x61,0x08,0xA2,0x18,0x82,0x10,0x20,0x00,0xC2,0x10,0xC2,0x10,0x20,0x00,0x24,0x21,0xC3,0x18,0x41,0x08,0xC6,0x31,0x82,0x10,0xE3,0x18,0x65,0x29,0x82,0x10,0x86,0x31,
-	0x61,0x08,0x04,0x21,0x04,0x21,0x61,0x08,0x04,0x21,0x41,0x08,0xE3,0x18,0x41,0x08,0xA2,0x10,0x40,0x00,0x81,0x08,0x40,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x40,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0x20,0x00,0x24,0x21,
-	0x20,0x00,0xA2,0x10,0x82,0x10,0x00,0x00,0xC3,0x18,0x20,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x41,0x08,0xC2,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,0x81,0x08,0x20,0x00,0x45,0x29,0x61,0x08,0x82,0x10,0x07,0x3A,0xE3,0x18,0x81,0x08,0xC6,0x31,0xC3,0x18,0x20,0x00,0xC2,0x10,0x81,0x08,0x41,0x08,0x41,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,
-	0x61,0x08,0xE7,0x39,0x45,0x29,0x81,0x08,0xC2,0x10,0xC2,0x10,0x41,0x08,0x81,0x08,0x20,0x00,0xA2,0x10,0xC7,0x39,0xE3,0x18,0x82,0x10,0x24,0x21,0xA2,0x10,0x82,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x24,0x21,0x61,0x08,0xA2,0x10,0xA6,0x31,0xE3,0x18,0x20,0x00,0x82,0x10,0x41,0x08,0xA2,0x10,0x24,0x21,0x81,0x08,0xE3,0x18,0x28,0x42,
-	0xA2,0x10,0x41,0x08,0xC3,0x18,0xE3,0x18,0x20,0x00,0x20,0x00,0x41,0x08,0xC2,0x10,0x61,0x08,0x61,0x08,0xC7,0x39,0xA2,0x10,0xC3,0x18,0x08,0x42,0xA2,0x10,0x40,0x00,0x44,0x21,0x61,0x08,0x40,0x00,0xE3,0x18,0x61,0x08,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0xA2,0x10,
-	0x00,0x00,0xE3,0x18,0x20,0x00,0xA2,0x10,0x82,0x10,0x20,0x00,0xC2,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0x81,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x00,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x45,0x29,0x61,0x08,0xA2,0x10,0xC6,0x31,0x61,0x08,0x24,0x21,0xE7,0x39,0x81,0x08,0x04,0x21,0x24,0x21,0x20,0x00,0xA2,0x10,0xC3,0x18,0x20,0x00,0x61,0x08,0x81,0x08,0x82,0x10,0x20,0x00,0x41,0x08,0xA6,0x31,0x24,0x21,0x82,0x10,0x65,0x29,0x65,0x29,
-	0x41,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,0x00,0x00,0xC3,0x18,0xE7,0x39,0x24,0x21,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x41,0x08,0xA2,0x10,0xC7,0x39,0xE3,0x18,0x61,0x08,0xC3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0x41,0x08,0xE3,0x18,0x08,0x42,0xE3,0x18,0x20,0x00,0x41,0x08,0xA2,0x10,0xA2,0x10,0x82,0x10,
-	0x41,0x08,0x44,0x21,0xC7,0x39,0xA2,0x10,0xA2,0x10,0xA6,0x31,0x82,0x10,0x20,0x00,0x81,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0xE3,0x18,0xA2,0x10,0x20,0x00,0x03,0x19,0x45,0x29,0x82,0x10,0x65,0x29,0x45,0x29,0x82,0x10,0xA6,0x31,0xE3,0x18,0x61,0x08,0x65,0x29,0x41,0x08,0x40,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x20,0x00,
-	0x81,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0xA2,0x10,0x40,0x00,0xA2,0x10,0x61,0x08,0xC2,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0x03,0x19,0x20,0x00,0x04,0x21,0x41,0x08,0xC3,0x18,0xA2,0x10,
-	0x81,0x08,0x65,0x29,0x41,0x08,0x85,0x29,0x04,0x21,0x82,0x10,0xC6,0x31,0x82,0x10,0xE3,0x18,0x24,0x21,0x61,0x08,0x24,0x21,0xA2,0x10,0x00,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0xE3,0x18,0xE3,0x18,0x40,0x00,0x44,0x21,0xC6,0x31,0x81,0x08,0xC3,0x18,0x86,0x31,0x61,0x08,0x20,0x00,0x40,0x00,
-	0xC2,0x10,0xA2,0x10,0x20,0x00,0x82,0x10,0x07,0x3A,0x04,0x21,0x61,0x08,0xA2,0x10,0x82,0x10,0x81,0x08,0xA2,0x10,0x40,0x00,0xE3,0x18,0xE7,0x39,0x24,0x21,0x41,0x08,0x40,0x00,0x20,0x00,0x04,0x21,0xE7,0x39,0x04,0x21,0x41,0x08,0x82,0x10,0xA2,0x10,0x82,0x10,0xC2,0x10,0x41,0x08,0xC2,0x10,0x28,0x42,0xE3,0x18,0x20,0x00,0xA2,0x10,
-	0xC2,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x04,0x21,0x04,0x21,0x82,0x10,0x65,0x29,0xC7,0x39,0x61,0x08,0xA2,0x10,0xE3,0x18,0x20,0x00,0x82,0x10,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0x61,0x08,0x44,0x21,0x41,0x08,0x24,0x21,0x65,0x29,0x61,0x08,0x85,0x29,0xC2,0x10,0xA2,0x10,0x86,0x31,0x41,0x08,0x24,0x21,
-	0xC2,0x10,0x61,0x08,0x04,0x21,0x20,0x00,0xC3,0x18,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x41,0x08,0x61,0x08,0x81,0x08,0x41,0x08,0xE3,0x18,
-	0x20,0x00,0xE3,0x18,0x61,0x08,0x41,0x08,0xE3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0x40,0x00,0xA2,0x10,0x61,0x08,0x40,0x00,0xC2,0x10,0x41,0x08,0x41,0x08,0x85,0x29,0x82,0x10,0xC2,0x10,0x08,0x42,0xA2,0x10,0xA2,0x10,0xA6,0x31,0xA2,0x10,0x41,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,0x40,0x00,0x82,0x10,0x65,0x29,0xA2,0x10,
-	0x82,0x10,0xA6,0x31,0x86,0x31,0x41,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,0xA2,0x10,0xE7,0x39,0x24,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0xE7,0x39,0x24,0x21,0x20,0x00,0x61,0x08,0x20,0x00,0xC3,0x18,0xE7,0x39,0xE3,0x18,0x61,0x08,0xC3,0x18,0x82,0x10,0x61,0x08,0xA2,0x10,0x20,0x00,0x24,0x21,0xE7,0x39,
-	0xA2,0x10,0x61,0x08,0x65,0x29,0xA2,0x10,0x20,0x00,0x20,0x00,0xA2,0x10,0xA2,0x10,0x61,0x08,0x61,0x08,0xA6,0x31,0xC3,0x18,0xA2,0x10,0x08,0x42,0xE3,0x18,0x61,0x08,0x44,0x21,0x82,0x10,0x00,0x00,0xA2,0x10,0x81,0x08,0x40,0x00,0x82,0x10,0x61,0x08,0x41,0x08,0x81,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0xC3,0x18,
-	0x20,0x00,0xC2,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0xA2,0x10,0x00,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x40,0x00,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x81,0x08,0x41,0x08,0x41,0x08,0x81,0x08,0x00,0x00,0xC3,0x18,0x61,0x08,0x20,0x00,0x04,0x21,0x41,0x08,0xA2,0x10,0x65,0x29,0x61,0x08,0x65,0x29,0xA6,0x31,0x81,0x08,0x44,0x21,0x24,0x21,0x41,0x08,0xC2,0x10,0xA2,0x10,0x20,0x00,0x61,0x08,0xA2,0x18,0xA2,0x10,0x41,0x08,0x41,0x08,0xA6,0x31,0x44,0x21,0x81,0x08,0x24,0x21,0x45,0x29,
-	0x61,0x08,0x20,0x00,0x41,0x08,0xC2,0x10,0xE3,0x18,0x61,0x08,0xA2,0x10,0xE7,0x39,0x45,0x29,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0xC6,0x31,0xE3,0x18,0x61,0x08,0xA2,0x10,0x61,0x08,0xC2,0x10,0xC6,0x31,0xE3,0x18,0x40,0x00,0x20,0x00,0x20,0x00,0x04,0x21,0xE7,0x39,0xE3,0x18,0x41,0x08,0xC3,0x18,0xE3,0x18,0x61,0x08,0x41,0x08,
-	0x41,0x08,0x24,0x21,0x86,0x31,0xA2,0x10,0xE3,0x18,0xC6,0x31,0x81,0x08,0x40,0x00,0xC2,0x10,0xA2,0x10,0x41,0x08,0x40,0x00,0x82,0x10,0xE3,0x18,0x20,0x00,0xE3,0x18,0xA6,0x31,0xA2,0x10,0x04,0x21,0x85,0x29,0x61,0x08,0x24,0x21,0x04,0x21,0x20,0x00,0xE3,0x18,0x61,0x08,0x40,0x00,0xA2,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,
-	0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x81,0x08,0x41,0x08,0xA2,0x10,0x61,0x08,0xA2,0x10,0x61,0x08,0xC2,0x10,0x41,0x08,0xE3,0x18,0x20,0x00,0x04,0x21,0x40,0x00,0xE3,0x18,0x81,0x08,
-	0x82,0x10,0x44,0x21,0x41,0x08,0x65,0x29,0xA2,0x18,0xC3,0x18,0xC7,0x39,0x81,0x08,0x24,0x21,0x04,0x21,0x20,0x00,0x24,0x21,0x81,0x08,0x20,0x00,0xC2,0x10,0x81,0x08,0x40,0x00,0x40,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x24,0x21,0x24,0x21,0x82,0x10,0x24,0x21,0xC7,0x39,0x81,0x08,0x82,0x10,0x03,0x19,0x81,0x08,0x20,0x00,0x40,0x00,
-	0x81,0x08,0x65,0x29,0xA2,0x10,0xA2,0x10,0x85,0x31,0x24,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0xC6,0x31,0x03,0x19,0x61,0x08,0xC2,0x10,0x81,0x08,0x82,0x10,0x65,0x29,0xA2,0x10,0x82,0x10,0xC2,0x10,0x61,0x08,0xA2,0x10,0xC6,0x31,0x04,0x21,0x20,0x00,0x61,0x08,0x20,0x00,0xC2,0x10,0xC6,0x31,0xC3,0x18,0x82,0x10,0x65,0x29,
-	0xA2,0x10,0x20,0x00,0x41,0x08,0x81,0x08,0xC2,0x10,0xA2,0x10,0x41,0x08,0xA6,0x31,0xA6,0x31,0x82,0x10,0xC3,0x18,0x24,0x21,0x20,0x00,0x41,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0x81,0x08,0xC2,0x10,0x41,0x08,0x41,0x08,0x24,0x21,0x40,0x00,0xC2,0x18,0x85,0x29,0x61,0x08,0x44,0x21,0xE3,0x18,0x81,0x08,0x65,0x29,0x41,0x08,0xE3,0x18,
-	0xC3,0x18,0x41,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0x40,0x00,0x61,0x08,0x40,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xC3,0x18,0x40,0x00,0xC3,0x18,0x40,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0xE3,0x18,
-	0x20,0x00,0x24,0x21,0x41,0x08,0x61,0x08,0xE3,0x18,0x00,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x40,0x00,0x41,0x08,0xC3,0x18,0x41,0x08,0x61,0x08,0x24,0x21,0x41,0x08,0xC3,0x18,0xE7,0x39,0xA2,0x10,0xA2,0x10,0xA6,0x31,0xA2,0x10,0x00,0x00,0x61,0x08,0x82,0x10,0x81,0x08,0x41,0x08,0x81,0x08,0x86,0x31,0xE3,0x18,
-	0xA2,0x10,0x65,0x29,0x65,0x29,0x41,0x08,0x20,0x00,0x20,0x00,0xC3,0x18,0x86,0x31,0xC3,0x18,0x81,0x08,0x24,0x21,0xC2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xA2,0x10,0x86,0x31,0xE3,0x18,0x61,0x08,0xA2,0x10,0x81,0x08,0x82,0x10,0x44,0x29,0x81,0x10,0xC3,0x18,0x86,0x31,0xC3,0x18,0x20,0x00,0x20,0x00,0x20,0x00,0x24,0x21,0x86,0x31,
-	0x81,0x08,0xC3,0x18,0xA6,0x31,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x81,0x08,0x41,0x08,0x82,0x10,0xA6,0x31,0xC2,0x10,0xA2,0x10,0xE7,0x39,0x24,0x21,0x20,0x00,0x04,0x21,0xA2,0x10,0x20,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x41,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0x82,0x10,0x20,0x00,0xE3,0x18,
-	0x20,0x00,0xA2,0x10,0x82,0x10,0x40,0x00,0xA2,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0x81,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0xA2,0x10,0x41,0x08,0x40,0x00,0x24,0x21,0x41,0x08,0xC3,0x18,0x65,0x29,0x61,0x08,0x45,0x29,0xA6,0x31,0x61,0x08,0x24,0x21,0xE3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x40,0x00,0x61,0x08,0x61,0x08,0xC2,0x10,0x82,0x10,0x61,0x08,0xA6,0x31,0xA6,0x31,0x61,0x08,0xA2,0x10,0xC3,0x18,
-	0xA2,0x10,0x41,0x08,0x00,0x00,0xC3,0x18,0xE7,0x39,0xE3,0x18,0x81,0x08,0xE3,0x18,0xC3,0x18,0x81,0x08,0x82,0x10,0x61,0x08,0xC3,0x18,0xC6,0x31,0x04,0x21,0x61,0x08,0x61,0x08,0x41,0x08,0xE3,0x18,0xC6,0x39,0xC3,0x18,0x61,0x08,0xA2,0x10,0x81,0x08,0xC3,0x18,0xE3,0x18,0x61,0x08,0xA2,0x10,0xC6,0x31,0x03,0x19,0x20,0x00,0x20,0x00,
-	0x61,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x24,0x21,0xE7,0x39,0x81,0x08,0x61,0x08,0x03,0x19,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0xA2,0x10,0x20,0x00,0xA2,0x10,0x86,0x31,0x81,0x08,0x04,0x21,0x86,0x31,0x61,0x08,0x24,0x21,0x24,0x21,0x20,0x00,0xE3,0x18,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x40,0x00,0x82,0x10,0x40,0x00,0x82,0x10,0x40,0x00,0xA2,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0xE3,0x18,0x20,0x00,0xC3,0x18,0x61,0x08,
-	0x82,0x10,0x03,0x19,0x40,0x00,0x65,0x29,0x82,0x10,0xC2,0x10,0x86,0x31,0x61,0x08,0x24,0x21,0xE3,0x18,0x61,0x08,0x65,0x29,0x81,0x08,0x20,0x00,0x82,0x10,0x41,0x08,0x20,0x00,0x61,0x08,0xC3,0x18,0x82,0x10,0x20,0x00,0x04,0x21,0x45,0x29,0x82,0x10,0x04,0x21,0xC6,0x31,0x81,0x08,0x61,0x08,0xA2,0x10,0x81,0x08,0x61,0x08,0x20,0x00,
-	0x82,0x10,0xC7,0x39,0x04,0x21,0x81,0x08,0xE3,0x18,0xC2,0x10,0x61,0x08,0x82,0x10,0x41,0x08,0xC2,0x10,0xE7,0x39,0x24,0x21,0x40,0x00,0x61,0x08,0x20,0x00,0xE3,0x18,0x07,0x3A,0x24,0x21,0x20,0x00,0x61,0x08,0x41,0x08,0xE3,0x18,0xE7,0x39,0x24,0x21,0x20,0x00,0x82,0x10,0x41,0x08,0xA2,0x10,0x24,0x21,0x81,0x08,0xE3,0x18,0xE7,0x39,
-	0xA2,0x10,0x20,0x00,0xA2,0x10,0x81,0x08,0x81,0x08,0x81,0x08,0x41,0x08,0x85,0x29,0xA6,0x31,0x82,0x10,0xE3,0x18,0x24,0x21,0x20,0x00,0x81,0x08,0xC2,0x10,0x61,0x08,0x40,0x00,0x40,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x44,0x21,0x61,0x08,0xA2,0x10,0x65,0x29,0x61,0x08,0xE3,0x18,0xE3,0x18,0x61,0x08,0x44,0x21,0x20,0x00,0xA2,0x10,
-	0xA2,0x10,0x20,0x00,0xC2,0x10,0x20,0x00,0x81,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0xA2,0x10,
-	0x20,0x00,0xC3,0x18,0x40,0x00,0x61,0x08,0xC2,0x10,0x20,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x40,0x00,0x40,0x00,0xC3,0x18,0x20,0x00,0x61,0x08,0x86,0x31,0x82,0x10,0xC2,0x10,0x08,0x42,0xA2,0x10,0x61,0x08,0x03,0x19,0xA2,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0xC2,0x10,0x61,0x08,0x81,0x08,0xC6,0x31,0x45,0x29,
-	0x61,0x08,0x82,0x10,0xA2,0x10,0xA2,0x10,0x82,0x10,0x41,0x08,0xC3,0x18,0x07,0x3A,0x24,0x21,0x41,0x08,0x40,0x00,0x20,0x00,0x03,0x19,0x07,0x3A,0x24,0x21,0x41,0x08,0x41,0x08,0x20,0x00,0x04,0x21,0x07,0x3A,0x04,0x21,0x41,0x08,0x40,0x00,0x20,0x00,0x03,0x19,0x08,0x42,0xC3,0x18,0x41,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x40,0x00,0x24,0x21,0x07,0x3A,0xC2,0x10,0x41,0x08,0xC3,0x18,0x61,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x03,0x19,0x61,0x08,0xA2,0x10,0xE7,0x39,0x03,0x19,0x61,0x08,0x85,0x29,0xC2,0x10,0x20,0x00,0xA2,0x10,0x61,0x08,0x40,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x20,0x00,0x82,0x10,0x61,0x08,0x20,0x00,0xA2,0x10,
-	0x20,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x41,0x08,0x20,0x00,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x04,0x21,0x41,0x08,0xC3,0x18,0x65,0x29,0x61,0x08,0x45,0x29,0x86,0x31,0x61,0x08,0x03,0x19,0x03,0x19,0x20,0x00,0x41,0x08,0x81,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0xE3,0x18,0xC2,0x10,0x81,0x08,0xA6,0x31,0xA6,0x31,0x61,0x08,0x41,0x08,0x81,0x08,
-	0xC3,0x18,0xA2,0x10,0x41,0x08,0xA2,0x10,0x07,0x3A,0x24,0x21,0x61,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0xA6,0x31,0x04,0x21,0x61,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0xE7,0x39,0x04,0x21,0x61,0x08,0x82,0x10,0x41,0x08,0xC3,0x18,0xC7,0x39,0xE3,0x18,0x61,0x08,0x40,0x00,0x20,0x00,0xE3,0x18,0x07,0x3A,0x03,0x19,0x20,0x00,0xA2,0x10,
-	0x82,0x10,0x81,0x08,0x61,0x08,0x41,0x08,0x24,0x21,0xC7,0x39,0x81,0x08,0xA2,0x10,0x24,0x21,0x61,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x81,0x08,0x00,0x00,0xC2,0x10,0x65,0x29,0x61,0x08,0xE3,0x18,0x85,0x29,0x61,0x08,0x04,0x21,0x24,0x21,0x20,0x00,0xC2,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0xA2,0x10,0x20,0x00,0xC3,0x18,0x20,0x00,0xC3,0x18,0x40,0x00,0xA2,0x10,0x82,0x10,
-	0x61,0x10,0x04,0x21,0x40,0x00,0x44,0x21,0xA2,0x10,0x82,0x10,0x65,0x29,0x61,0x08,0xE3,0x18,0xE3,0x18,0x20,0x00,0xC3,0x18,0x81,0x08,0x20,0x00,0x82,0x10,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0xC3,0x18,0x41,0x08,0x04,0x21,0xC7,0x39,0xA2,0x10,0xA2,0x10,0x44,0x21,0x82,0x10,0x41,0x08,0x61,0x08,0x81,0x08,0x03,0x19,0x82,0x10,
-	0xA2,0x10,0xC6,0x31,0x65,0x29,0x41,0x08,0x41,0x08,0x40,0x00,0xC2,0x10,0xA6,0x31,0x04,0x21,0x61,0x08,0xA2,0x10,0x61,0x08,0xC3,0x18,0x86,0x31,0x04,0x21,0x61,0x08,0x82,0x10,0x61,0x08,0xE3,0x18,0xA6,0x31,0xC2,0x10,0x61,0x08,0xA2,0x10,0x41,0x08,0xE3,0x18,0xC6,0x31,0xE3,0x18,0x41,0x08,0x81,0x08,0x20,0x00,0x24,0x21,0xE7,0x39,
-	0xA2,0x10,0x61,0x08,0x24,0x21,0xA2,0x10,0x40,0x00,0x40,0x00,0x40,0x00,0x44,0x21,0xE3,0x18,0x81,0x08,0x85,0x29,0x44,0x21,0x61,0x08,0xA2,0x10,0xC3,0x18,0x20,0x00,0x41,0x08,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0x20,0x00,0xA2,0x10,0x03,0x19,0x41,0x08,0x03,0x19,0xA2,0x10,0x61,0x08,0x03,0x19,0x41,0x08,0xA2,0x10,
-	0x82,0x10,0x41,0x08,0xA2,0x10,0x20,0x00,0x82,0x10,0x20,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0xA2,0x10,
-	0x00,0x00,0xA2,0x10,0x20,0x00,0x20,0x00,0x81,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x40,0x00,0x20,0x00,0xE3,0x18,0x61,0x08,0x61,0x08,0xA6,0x31,0xC2,0x10,0xA2,0x10,0xC6,0x31,0xC3,0x18,0x20,0x00,0xC3,0x18,0x82,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0xA5,0x39,0x28,0x73,0x81,0x08,0x65,0x29,0x65,0x29,
-	0x61,0x08,0x40,0x00,0x20,0x00,0xA2,0x10,0x65,0x29,0xE3,0x18,0xA2,0x10,0x24,0x21,0xA2,0x10,0x81,0x08,0xC3,0x18,0x82,0x10,0xA2,0x10,0x65,0x29,0xA2,0x10,0x82,0x10,0x45,0x29,0xC2,0x10,0xA2,0x10,0x65,0x29,0xA2,0x10,0x61,0x08,0xC3,0x18,0xA2,0x10,0xA2,0x10,0x24,0x21,0x81,0x08,0xA2,0x10,0x65,0x29,0xE3,0x18,0x03,0x29,0xA4,0x41,
-	0x8E,0xD5,0xE6,0x41,0xC7,0x39,0xC2,0x10,0xA2,0x10,0x44,0x21,0x81,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0xC2,0x10,0x40,0x00,0xA2,0x10,0xC6,0x31,0xC2,0x10,0x61,0x08,0x85,0x29,0xA2,0x10,0x41,0x08,0xC2,0x10,0x61,0x08,0x41,0x08,0x81,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x82,0x10,
-	0x00,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,
-	0x40,0x00,0x40,0x00,0x20,0x00,0xA2,0x10,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0x44,0x21,0x61,0x08,0xA2,0x10,0x86,0x31,0x61,0x08,0xE3,0x18,0x65,0x29,0x41,0x08,0x61,0x08,0xC2,0x10,0x41,0x08,0x41,0x08,0x40,0x00,0xA2,0x10,0x82,0x10,0x61,0x08,0x44,0x21,0x86,0x31,0x23,0x21,0x4E,0xCD,0x28,0x73,0x81,0x08,0x20,0x00,0x20,0x00,
-	0xA2,0x10,0xA6,0x31,0x24,0x21,0x61,0x08,0xC3,0x18,0xC3,0x18,0x82,0x10,0xC2,0x18,0x61,0x08,0xA2,0x10,0x86,0x31,0xE3,0x18,0x81,0x08,0xE3,0x18,0x82,0x10,0x82,0x10,0x03,0x19,0xC3,0x18,0x81,0x08,0xE3,0x18,0x61,0x08,0xA2,0x10,0xA6,0x31,0xE3,0x18,0x81,0x08,0xC3,0x18,0x61,0x08,0xA2,0x10,0x24,0x21,0x69,0x8B,0x4B,0xAC,0x2C,0x9C,
-	0xCF,0xED,0x23,0x31,0x43,0x31,0x4B,0xAC,0x44,0x29,0x24,0x29,0x61,0x08,0x45,0x29,0xA6,0x31,0x61,0x08,0x41,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0xA2,0x10,0x20,0x00,0xE3,0x18,0xE3,0x18,0x41,0x08,0x44,0x21,0xE3,0x18,0x61,0x08,0x24,0x21,0x61,0x08,0x40,0x00,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x81,0x08,0x40,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,
-	0x40,0x00,0x04,0x21,0x41,0x08,0xE3,0x18,0xC3,0x18,0x41,0x08,0x24,0x21,0x61,0x08,0x82,0x10,0xC3,0x18,0x20,0x00,0x81,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x44,0x21,0x61,0x08,0xE3,0x18,0xC7,0x39,0xA2,0x10,0x41,0x08,0x44,0x29,0xAD,0xBC,0x31,0xFE,0x63,0x39,0x81,0x08,0x86,0x31,0x04,0x21,
-	0x81,0x08,0x04,0x21,0xE3,0x18,0x61,0x08,0x81,0x08,0x41,0x08,0xC2,0x10,0xC7,0x39,0x45,0x29,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0xC6,0x31,0x04,0x21,0x61,0x08,0xA2,0x10,0x61,0x08,0xE3,0x18,0xC6,0x31,0x04,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0x24,0x21,0xE7,0x39,0xC3,0x18,0x41,0x08,0xA7,0x6A,0x2C,0xB4,0xC5,0x49,0x47,0x52,
-	0x26,0x52,0x03,0x21,0xC9,0x62,0x90,0xED,0x49,0x8B,0x49,0x83,0x05,0x52,0xE3,0x18,0x82,0x10,0x81,0x08,0x86,0x31,0x04,0x21,0x61,0x08,0x04,0x21,0xC3,0x18,0x20,0x00,0x82,0x10,0xA2,0x10,0x40,0x00,0x20,0x00,0x40,0x00,0x81,0x08,0x00,0x00,0xA2,0x10,0xA2,0x10,0x41,0x08,0xE3,0x18,0x61,0x08,0x61,0x08,0xC3,0x18,0x20,0x00,0xC3,0x18,
-	0x41,0x08,0x61,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,
-	0x20,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0xE3,0x18,0xC3,0x18,0x82,0x10,0xA2,0x10,0x20,0x00,0x24,0x21,0xE3,0x18,0x61,0x08,0x65,0x29,0x03,0x19,0x41,0x08,0x03,0x19,0xA2,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x03,0x21,0x6D,0xBC,0xD1,0xFD,0xD0,0xF5,0xC6,0x39,0x61,0x08,0x61,0x08,0x82,0x10,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0xA2,0x10,0xA6,0x31,0x24,0x21,0x61,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0xE7,0x39,0x24,0x21,0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0xA6,0x31,0xE3,0x18,0x61,0x08,0x61,0x08,0x20,0x00,0xE3,0x18,0x07,0x3A,0x24,0x21,0x20,0x00,0x41,0x08,0x20,0x00,0xE3,0x18,0x6A,0x8B,0xC9,0x7A,0x8D,0xC4,0x2F,0xDD,
-	0xAE,0xCC,0x44,0x31,0xC2,0x18,0x43,0x31,0xA5,0x39,0x88,0x5A,0x26,0x5A,0x67,0x62,0xC2,0x10,0x61,0x08,0x41,0x08,0x61,0x08,0x65,0x29,0xE3,0x18,0x41,0x08,0xA2,0x10,0xA6,0x31,0x82,0x10,0x45,0x29,0xE3,0x18,0x41,0x08,0x61,0x08,0xA2,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x45,0x29,0x40,0x00,
-	0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,
-	0x40,0x00,0x82,0x10,0x20,0x00,0xC2,0x10,0x40,0x00,0x82,0x10,0x44,0x21,0xB2,0x94,0x14,0xA5,0x34,0xA5,0x71,0x8C,0x85,0x29,0x04,0x21,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x54,0xA5,0x04,0x21,0x81,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0x24,0x21,0xC2,0x18,0xEC,0xB3,0x71,0xFD,0x71,0xFD,0x4D,0xC4,0x61,0x08,0xA2,0x10,0xA2,0x10,0x61,0x08,
-	0x81,0x08,0xA6,0x31,0x86,0x31,0x41,0x08,0x20,0x00,0x20,0x00,0xC2,0x10,0xC7,0x39,0x45,0x29,0x41,0x08,0x41,0x08,0x20,0x00,0xE3,0x18,0xE7,0x39,0x24,0x21,0x41,0x08,0x61,0x08,0x20,0x00,0x04,0x21,0x07,0x3A,0x04,0x21,0x20,0x00,0x41,0x08,0x40,0x00,0x04,0x21,0xE7,0x39,0xC3,0x18,0x20,0x00,0xE6,0x51,0x30,0xF5,0x51,0xFD,0x51,0xFD,
-	0xEF,0xE4,0x24,0x31,0xE3,0x20,0xCB,0xAB,0xCF,0xE4,0xCB,0xAB,0xE6,0x51,0x29,0x8B,0x45,0x29,0x61,0x08,0xE7,0x39,0x95,0xAD,0xF3,0x9C,0xB2,0x94,0x82,0x10,0x61,0x08,0xE7,0x39,0x75,0xAD,0xD2,0x94,0x95,0xAD,0x24,0x21,0x24,0x21,0xD2,0x94,0x17,0xBE,0x18,0xC6,0xDA,0xD6,0x51,0x8C,0x82,0x10,0xE7,0x39,0x75,0xAD,0xD2,0x94,0xD6,0xB5,
-	0x24,0x21,0x00,0x00,0xAE,0x73,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0x69,0x4A,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0xA2,0x10,
-	0x20,0x00,0x82,0x10,0x41,0x08,0x40,0x00,0xA2,0x10,0x20,0x00,0xC6,0x31,0x6D,0x6B,0x20,0x00,0x81,0x08,0x10,0x84,0x85,0x29,0x04,0x21,0x10,0x84,0x20,0x00,0x61,0x08,0x24,0x21,0x61,0x08,0xA2,0x10,0xA6,0x31,0xC2,0x10,0x41,0x08,0x44,0x29,0xCC,0xB3,0x11,0xFD,0x11,0xFD,0x11,0xFD,0x0D,0xC4,0x07,0x5A,0xC6,0x51,0x07,0x52,0x24,0x21,
-	0x81,0x08,0x20,0x00,0x20,0x00,0xA2,0x10,0xA6,0x31,0x44,0x21,0x61,0x08,0x61,0x08,0x41,0x08,0xC2,0x10,0xC6,0x31,0x24,0x21,0x61,0x08,0x41,0x08,0x20,0x00,0xC3,0x18,0xE7,0x39,0x24,0x21,0x41,0x08,0x41,0x08,0x41,0x08,0xE3,0x18,0xC7,0x39,0x04,0x21,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0xED,0xBB,0x11,0xFD,0x11,0xFD,0x11,0xFD,
-	0x2A,0x9B,0x24,0x29,0x07,0x4A,0x8F,0xDC,0x11,0xFD,0x11,0xFD,0xF0,0xF4,0x88,0x7A,0x41,0x08,0x81,0x08,0x92,0x94,0x24,0x21,0xA2,0x10,0x30,0x84,0x2C,0x63,0x20,0x00,0xB2,0x94,0x65,0x29,0x20,0x00,0x6D,0x6B,0x10,0x84,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x75,0xAD,0x65,0x29,0x00,0x00,0xF3,0x9C,0x04,0x21,0x20,0x00,0x6D,0x6B,
-	0x30,0x84,0x41,0x08,0x10,0x84,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x44,0x21,0xB2,0x94,0xE7,0x39,0xA6,0x31,0xD3,0x9C,0x86,0x31,0x85,0x29,0x92,0x94,0x4D,0x6B,0xEF,0x7B,0x89,0x4A,0x24,0x21,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0xEA,0x9A,0xB1,0xFC,0xD1,0xFC,0xD1,0xFC,0xB1,0xFC,0xD1,0xFC,0xD1,0xFC,0x4F,0xE4,0x03,0x31,0x20,0x00,
-	0xA2,0x10,0xA6,0x31,0x44,0x21,0x81,0x08,0x81,0x08,0x61,0x08,0xA2,0x10,0x45,0x29,0xE3,0x18,0x61,0x08,0xC3,0x18,0x41,0x08,0xC2,0x10,0xC7,0x39,0x45,0x29,0x41,0x08,0x61,0x08,0x40,0x00,0x04,0x21,0xE7,0x39,0xC3,0x18,0x41,0x08,0xC2,0x10,0x61,0x08,0xC3,0x18,0x65,0x29,0xA2,0x10,0x61,0x08,0xEA,0x92,0xB1,0xFC,0xB1,0xFC,0x6F,0xE4,
-	0xC3,0x18,0x20,0x00,0x61,0x08,0xEA,0x9A,0xB0,0xF4,0xB1,0xFC,0xB1,0xFC,0x4F,0xE4,0x45,0x29,0x20,0x00,0x58,0xC6,0xA2,0x10,0x61,0x08,0x86,0x31,0x34,0xA5,0xC2,0x10,0xE7,0x39,0x61,0x08,0xE3,0x18,0x30,0x84,0x6D,0x6B,0xC2,0x10,0x82,0x10,0x20,0x00,0x65,0x29,0x92,0x94,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0xA6,0x31,0x91,0x8C,
-	0x69,0x4A,0x00,0x00,0xF3,0x9C,0x8E,0x73,0xAE,0x73,0x0C,0x63,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0xA2,0x10,
-	0x20,0x00,0xC3,0x18,0x61,0x08,0x82,0x10,0xC2,0x10,0x20,0x00,0x85,0x29,0x75,0xAD,0x4D,0x6B,0x6D,0x6B,0x95,0xAD,0x24,0x21,0x45,0x29,0x0C,0x63,0xE3,0x18,0x44,0x21,0xF3,0x9C,0x24,0x21,0xA2,0x10,0x24,0x21,0x61,0x08,0x85,0x49,0x2C,0x9B,0xCA,0x92,0xAA,0x9A,0x30,0xEC,0x51,0xFC,0x51,0xFC,0xEF,0xE3,0x85,0x49,0x65,0x29,0x65,0x29,
-	0x82,0x10,0x61,0x08,0x81,0x08,0x82,0x10,0x24,0x21,0xC3,0x18,0x81,0x08,0xC3,0x18,0x81,0x08,0x82,0x10,0x65,0x29,0x03,0x19,0x82,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0xC7,0x39,0x24,0x21,0x41,0x08,0x61,0x08,0x61,0x08,0xC3,0x18,0x65,0x29,0xC2,0x10,0x82,0x10,0xE3,0x18,0x61,0x08,0xA2,0x10,0x28,0x5A,0x30,0xEC,0x71,0xFC,0xAE,0xCB,
-	0x41,0x08,0x45,0x29,0xA6,0x31,0xC3,0x18,0xEB,0xA2,0x71,0xFC,0x51,0xFC,0xCE,0xD3,0x41,0x08,0x61,0x08,0x17,0xBE,0x82,0x10,0x41,0x08,0xA6,0x31,0x17,0xBE,0x20,0x00,0x40,0x00,0x61,0x08,0xAE,0x73,0x92,0x94,0xC2,0x10,0x82,0x10,0x20,0x00,0xA2,0x10,0x6D,0x6B,0x49,0x4A,0xC2,0x10,0x20,0x00,0x41,0x08,0xC3,0x18,0x2C,0x63,0x38,0xC6,
-	0xC7,0x39,0x41,0x08,0x8D,0x6B,0xA6,0x31,0xA2,0x10,0x0F,0x7C,0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x08,0x42,0x8A,0x52,0x40,0x00,0x20,0x00,0x0C,0x63,0x28,0x42,0x81,0x08,0x24,0x21,0xA2,0x10,0x61,0x08,0x8D,0x6B,0x69,0x4A,0x41,0x08,0x03,0x19,0xE3,0x18,0x20,0x00,0x20,0x00,0x61,0x08,0x45,0x41,0xD0,0xF3,0xF1,0xFB,0xD0,0xEB,0x69,0x72,0x82,0x10,0x20,0x00,0x61,0x08,
-	0x82,0x10,0x03,0x19,0xC3,0x18,0x81,0x08,0x24,0x21,0xC3,0x18,0x81,0x08,0xA2,0x10,0x81,0x08,0x81,0x08,0x24,0x21,0xA2,0x10,0xA2,0x10,0x85,0x29,0x03,0x19,0x40,0x00,0x41,0x08,0x20,0x00,0x03,0x19,0x86,0x31,0xA2,0x10,0x81,0x08,0x44,0x21,0xA2,0x10,0x82,0x10,0xC2,0x10,0x61,0x08,0xC2,0x10,0x44,0x29,0xCB,0x9A,0x11,0xFC,0x11,0xFC,
-	0x08,0x72,0x82,0x10,0x41,0x08,0x61,0x08,0x49,0x72,0x11,0xFC,0x10,0xF4,0x49,0x82,0xA2,0x10,0x61,0x08,0x17,0xBE,0xA2,0x10,0xA2,0x10,0x28,0x42,0x92,0x94,0xA2,0x10,0x65,0x29,0x71,0x8C,0x30,0x84,0xC3,0x18,0x20,0x00,0x40,0x00,0x41,0x08,0x41,0x08,0x54,0xA5,0xE3,0x18,0x00,0x00,0x20,0x00,0xA6,0x31,0x20,0x00,0x20,0x00,0xC7,0x39,
-	0x54,0xA5,0x00,0x00,0x24,0x21,0x00,0x00,0x00,0x00,0x86,0x31,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x82,0x10,
-	0x20,0x00,0x82,0x10,0x40,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x89,0x4A,0xCE,0x73,0x82,0x10,0xC3,0x18,0x71,0x8C,0x69,0x4A,0x07,0x3A,0x50,0x84,0xC2,0x10,0x81,0x08,0x54,0xA5,0x65,0x29,0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x65,0x29,0x82,0x10,0x87,0x59,0x91,0xFB,0x70,0xF3,0x66,0x59,0x41,0x08,0x81,0x08,0x04,0x21,0x03,0x21,
-	0x81,0x08,0xE3,0x18,0xE3,0x18,0x61,0x08,0xA2,0x10,0x82,0x10,0x82,0x10,0x45,0x29,0xE3,0x18,0x61,0x08,0x04,0x21,0xC2,0x10,0x82,0x10,0x81,0x08,0x61,0x08,0xE3,0x18,0xC7,0x39,0x04,0x21,0x61,0x08,0x81,0x08,0x61,0x08,0xA2,0x10,0x24,0x21,0x82,0x10,0xA2,0x10,0x45,0x29,0x81,0x08,0x61,0x08,0xC2,0x10,0xA2,0x18,0x6F,0xE3,0xB1,0xFB,
-	0x90,0xF3,0xC7,0x61,0x44,0x21,0xA2,0x18,0x0E,0xCB,0xB1,0xFB,0x4F,0xDB,0x86,0x39,0xC3,0x18,0x61,0x08,0xEF,0x7B,0xE7,0x39,0x61,0x08,0x54,0xA5,0x28,0x42,0x41,0x08,0xCF,0x7B,0xAA,0x52,0x82,0x10,0x40,0x00,0x61,0x08,0xC3,0x18,0x40,0x00,0xAA,0x52,0x50,0x84,0x20,0x00,0x82,0x10,0x40,0x00,0x54,0xA5,0x65,0x29,0x20,0x00,0x8D,0x6B,
-	0x30,0x84,0x41,0x08,0x14,0xA5,0x24,0x21,0x20,0x00,0x30,0x84,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x30,0x84,0x13,0x9D,0x13,0x9D,0xAE,0x73,0x61,0x08,0x20,0x00,0x8E,0x73,0x54,0xA5,0xB6,0xB5,0xCA,0x52,0x61,0x08,0x61,0x08,0x45,0x29,0xE3,0x18,0x20,0x00,0xC3,0x18,0xA2,0x10,0xC9,0x89,0x30,0xF3,0xE9,0x89,0x24,0x21,0x44,0x21,0x82,0x10,0xA2,0x10,0xE3,0x20,
-	0x61,0x08,0x81,0x08,0x61,0x08,0x82,0x10,0x45,0x29,0x24,0x21,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x65,0x29,0xC3,0x18,0x81,0x08,0x44,0x21,0xE3,0x18,0x40,0x00,0x61,0x08,0x41,0x08,0xC2,0x10,0x65,0x29,0x61,0x08,0xA2,0x10,0x65,0x29,0xE3,0x18,0x41,0x08,0x61,0x08,0x41,0x08,0x04,0x21,0x65,0x29,0xC3,0x18,0x2A,0x9A,0x71,0xFB,
-	0x71,0xFB,0x6B,0x9A,0x04,0x21,0x8C,0xB2,0x71,0xFB,0x71,0xFB,0xE9,0x89,0x20,0x00,0x40,0x00,0x41,0x08,0x65,0x31,0xF3,0x9C,0xF3,0x9C,0x4D,0x6B,0x61,0x08,0x40,0x00,0x54,0xA5,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x4D,0x6B,0x20,0x00,0x00,0x00,0x30,0x84,0x24,0x21,0x20,0x00,0x41,0x08,0x00,0x00,0x65,0x29,0x54,0xA5,0xB2,0x94,0x71,0x8C,
-	0x41,0x08,0x20,0x00,0x65,0x29,0x13,0x9D,0xD2,0x94,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0xA2,0x10,0x20,0x00,0x81,0x08,0xA2,0x10,0x20,0x00,0xE3,0x18,0xA2,0x10,0x40,0x00,0x04,0x21,0x82,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0xC3,0x18,0x20,0x00,0x4D,0xBA,0x4C,0x9A,0xC3,0x18,0x41,0x08,0x81,0x08,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0x61,0x08,0x44,0x21,0x44,0x21,0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x65,0x29,0x24,0x21,0x41,0x08,0xC3,0x18,0xA2,0x10,0x82,0x10,0xA2,0x10,0x61,0x08,0xC3,0x18,0xA6,0x31,0x04,0x21,0x61,0x08,0xA2,0x10,0x61,0x08,0x82,0x10,0xE3,0x18,0x61,0x08,0xC3,0x18,0x86,0x31,0x82,0x10,0x20,0x00,0x61,0x08,0x61,0x08,0x46,0x49,0xF0,0xEA,
-	0x10,0xEB,0x46,0x51,0x25,0x39,0xEF,0xE2,0x11,0xFB,0x31,0xFB,0x25,0x41,0x44,0x21,0xE3,0x18,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0xE3,0x18,0x61,0x08,0x41,0x08,0xC2,0x10,0x20,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x61,0x08,0x20,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x40,0x00,
-	0x00,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x81,0x08,0x40,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x24,0x21,0xA2,0x10,0x61,0x08,0x24,0x21,0xC3,0x18,0xCB,0x99,0x61,0x10,0x41,0x08,0xA2,0x10,0xC2,0x10,0x61,0x08,0xC3,0x18,0x24,0x21,
-	0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x45,0x29,0x44,0x21,0x82,0x10,0x41,0x08,0x61,0x08,0xA2,0x10,0x45,0x29,0xC3,0x18,0x81,0x08,0x24,0x21,0xE3,0x18,0x40,0x00,0x41,0x08,0x41,0x08,0xC2,0x10,0x24,0x21,0x61,0x08,0xA2,0x10,0x45,0x29,0xE3,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x24,0x21,0x65,0x29,0xA2,0x10,0x20,0x00,0x61,0x10,
-	0x82,0x10,0x04,0x21,0x45,0x31,0x4D,0xC2,0xD0,0xF2,0x8E,0xD2,0x61,0x10,0x41,0x08,0x20,0x00,0x82,0x10,0x03,0x19,0x61,0x08,0x61,0x08,0x03,0x19,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0x03,0x19,0x61,0x08,0x41,0x08,0xE3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x61,0x08,0x20,0x00,0xE3,0x20,0x44,0x21,0x82,0x10,0x61,0x08,0xC2,0x18,0x82,0x10,0x61,0x08,0x61,0x08,
-	0x41,0x08,0x44,0x21,0x45,0x29,0x61,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0x65,0x29,0x24,0x21,0x41,0x08,0xA2,0x10,0xA2,0x10,0x82,0x10,0x81,0x08,0x61,0x08,0xC3,0x18,0xA6,0x31,0x04,0x21,0x61,0x08,0x81,0x08,0x61,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0xC3,0x18,0x65,0x29,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0x45,0x29,
-	0x61,0x08,0x41,0x08,0x61,0x08,0x82,0x20,0xE5,0x40,0x82,0x20,0x82,0x10,0x04,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0x41,0x08,0x40,0x00,0x40,0x00,0x20,0x00,0xC2,0x10,0x82,0x10,0x40,0x00,0xC3,0x18,0x40,0x00,0x20,0x00,0x82,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x81,0x08,0x41,0x08,0x40,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xC2,0x18,0x81,0x08,0x61,0x08,0x03,0x19,0xC3,0x18,0x41,0x08,0x61,0x08,0x40,0x00,0x61,0x08,0x82,0x10,0x61,0x08,0xC3,0x18,0x45,0x29,
-	0xA2,0x10,0x40,0x00,0x40,0x08,0x82,0x10,0x24,0x21,0x24,0x21,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x44,0x21,0xC3,0x18,0x61,0x08,0x24,0x21,0xE3,0x18,0x20,0x00,0x41,0x08,0x41,0x08,0xC3,0x18,0x44,0x21,0x61,0x08,0xA2,0x10,0x44,0x21,0xC2,0x10,0x20,0x00,0x41,0x08,0x41,0x08,0x03,0x19,0x65,0x29,0x82,0x10,0x20,0x00,0x20,0x00,
-	0x61,0x08,0x24,0x21,0x04,0x21,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x00,0x00,0x61,0x08,0x04,0x21,0x61,0x08,0x41,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0xC3,0x18,0x41,0x08,0x61,0x08,0xE3,0x18,0x41,0x08,0x40,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0xA2,0x10,0x03,0x19,0x82,0x10,0x61,0x08,0x03,0x19,0x81,0x08,0x20,0x00,0x61,0x08,
-	0x40,0x00,0x24,0x21,0x44,0x29,0x82,0x10,0x20,0x00,0x20,0x00,0x61,0x08,0x45,0x29,0x24,0x21,0x41,0x08,0xA2,0x10,0xA2,0x10,0x82,0x10,0x61,0x08,0x61,0x08,0xA2,0x10,0x65,0x29,0xE3,0x18,0x61,0x08,0x61,0x08,0x41,0x08,0x82,0x10,0xC3,0x18,0x41,0x08,0xC3,0x18,0x45,0x29,0x81,0x08,0x20,0x00,0x40,0x00,0x41,0x08,0xE3,0x18,0x24,0x21,
-	0x61,0x08,0x41,0x08,0x40,0x00,0x41,0x08,0xC2,0x10,0x61,0x08,0x61,0x08,0xE3,0x18,0xA2,0x10,0x20,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x82,0x10,0x40,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x40,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x61,0x08,0xE3,0x18,0xA2,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x40,0x00,0x61,0x08,0x41,0x08,0xC3,0x18,0x45,0x29,
-	0x82,0x10,0x20,0x00,0x40,0x00,0x82,0x10,0x03,0x19,0x24,0x21,0x82,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x04,0x21,0xA2,0x10,0x61,0x08,0x24,0x21,0xE3,0x20,0x41,0x08,0x61,0x08,0x41,0x08,0xC3,0x18,0x45,0x29,0x61,0x08,0x82,0x10,0x24,0x21,0xC3,0x18,0x20,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0x24,0x21,0x82,0x10,0x20,0x00,0x20,0x00,
-	0x61,0x08,0x03,0x19,0xE3,0x18,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x81,0x08,0xE3,0x18,0x61,0x08,0x20,0x00,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x41,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x00,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x41,0x08,0xC3,0x18,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x81,0x08,0xE3,0x18,0x82,0x10,0x40,0x00,0xE3,0x18,0x61,0x08,0x20,0x00,0x61,0x08,
-	0x20,0x00,0xE3,0x18,0x44,0x21,0x82,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x24,0x21,0x03,0x19,0x41,0x08,0xC3,0x18,0xC2,0x10,0x82,0x10,0x61,0x08,0x20,0x00,0x81,0x08,0x24,0x21,0xE7,0x39,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0xE3,0x18,0x41,0x08,0xA2,0x10,0x24,0x21,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0xE3,0x18,0xE3,0x18,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0xC3,0x18,0x61,0x08,0x61,0x08,0xC2,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x41,0x08,0xA2,0x10,0x41,0x08,0x20,0x00,0x81,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x61,0x08,0x61,0x08,0x61,0x08,0xC2,0x10,0xA2,0x10,0x20,0x00,0x81,0x08,0x61,0x08,0x40,0x00,0x61,0x08,0x41,0x08,0xA2,0x10,0x04,0x21,
-	0x82,0x10,0x40,0x00,0x81,0x10,0xE7,0x39,0xCB,0x5A,0xC7,0x39,0x82,0x10,0x41,0x08,0x61,0x08,0x49,0x4A,0xEB,0x5A,0x85,0x29,0x61,0x08,0x24,0x21,0xE3,0x18,0x61,0x08,0xA6,0x31,0x2C,0x63,0xC2,0x10,0x44,0x21,0x04,0x21,0x24,0x21,0xE3,0x18,0xA2,0x10,0x20,0x00,0xE3,0x18,0x69,0x4A,0x69,0x4A,0x07,0x3A,0x82,0x10,0x20,0x00,0x20,0x00,
-	0x61,0x08,0xC3,0x18,0xA2,0x10,0x40,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x00,0x00,0x81,0x08,0xC3,0x18,0x41,0x08,0x40,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0xA2,0x10,0x61,0x08,0x20,0x00,0x40,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xC2,0x10,0xA2,0x10,0x41,0x08,0xA2,0x10,0x61,0x08,0x41,0x08,0x81,0x08,
-	0x20,0x00,0xA2,0x10,0x2C,0x63,0x2C,0x63,0xE7,0x39,0x95,0xAD,0x45,0x29,0xC3,0x18,0x30,0x84,0x0B,0x5B,0x69,0x4A,0x34,0xA5,0x45,0x29,0x61,0x08,0x61,0x08,0x61,0x08,0x2C,0x63,0xA6,0x31,0x61,0x08,0x2C,0x63,0xF7,0xBD,0x4C,0x63,0xE3,0x18,0x82,0x10,0xE3,0x18,0x34,0xA5,0x08,0x42,0x08,0x42,0x54,0xA5,0x04,0x21,0xC3,0x18,0xA2,0x10,
-	0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x82,0x10,0x40,0x00,0x81,0x08,0xC2,0x10,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x81,0x08,0x41,0x08,0x81,0x08,0xA2,0x10,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x82,0x10,0x40,0x00,0x82,0x10,0xE3,0x18,
-	0x61,0x08,0x41,0x08,0x54,0xA5,0x24,0x21,0xA2,0x10,0x0C,0x63,0x0F,0x7C,0x61,0x08,0x38,0xC6,0x82,0x10,0x81,0x08,0xAA,0x52,0x91,0x8C,0xE3,0x18,0xC2,0x10,0x61,0x08,0x34,0xA5,0x81,0x08,0xA2,0x10,0x8A,0x52,0xC6,0x31,0xEB,0x5A,0xA2,0x10,0x41,0x08,0x65,0x29,0x0C,0x63,0x40,0x00,0xC2,0x10,0xB2,0x94,0xA6,0x31,0x20,0x00,0x20,0x00,
-	0x81,0x08,0xA2,0x10,0x82,0x10,0x20,0x00,0x61,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x82,0x10,0x81,0x08,0x20,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x40,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0xC2,0x10,0xA2,0x10,0x40,0x00,0x41,0x08,0x40,0x00,0x61,0x08,0xA2,0x10,
-	0x40,0x00,0x61,0x08,0x38,0xC6,0x61,0x08,0x61,0x08,0xA6,0x31,0xB6,0xB5,0x61,0x08,0x17,0xBE,0x24,0x21,0xE3,0x18,0xEF,0x7B,0xD6,0xB5,0xA2,0x10,0xA2,0x10,0xEB,0x5A,0x4C,0x63,0x41,0x08,0x82,0x10,0xC3,0x18,0xA6,0x31,0xEB,0x5A,0x03,0x19,0x81,0x08,0x20,0x00,0x61,0x08,0x08,0x42,0xB2,0x94,0xB2,0x94,0x81,0x08,0x81,0x08,0x61,0x08,
-	0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x40,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,0x40,0x00,0x82,0x10,0x40,0x00,0x41,0x08,0x82,0x10,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0xC2,0x10,0x61,0x08,0x41,0x08,0xA2,0x10,
-	0x61,0x08,0x40,0x00,0x38,0xC6,0x61,0x08,0x61,0x08,0xA6,0x31,0xB6,0xB5,0xA2,0x10,0xCB,0x5A,0xD2,0x94,0x30,0x84,0x51,0x8C,0xB6,0xB5,0xA2,0x10,0x82,0x10,0x54,0xA5,0x82,0x10,0x82,0x10,0x40,0x00,0xA2,0x10,0xC6,0x31,0xEB,0x5A,0x20,0x00,0x61,0x08,0x82,0x10,0xA2,0x10,0xC2,0x10,0x08,0x42,0xB6,0xB5,0x24,0x21,0x61,0x08,0x40,0x00,
-	0x41,0x08,0x82,0x10,0x40,0x00,0x20,0x00,0xA2,0x10,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x81,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x61,0x08,0xA2,0x10,
-	0x61,0x08,0x40,0x00,0x54,0xA5,0x04,0x21,0x61,0x08,0x0B,0x5B,0x0F,0x7C,0x40,0x00,0x08,0x42,0x24,0x21,0x45,0x29,0x0C,0x63,0xAE,0x73,0xC2,0x10,0xC6,0x31,0x8D,0x6B,0xA2,0x10,0x41,0x08,0x61,0x08,0xE3,0x18,0xC6,0x31,0xEB,0x5A,0xA2,0x10,0x41,0x08,0x85,0x29,0xAA,0x52,0x41,0x08,0xA2,0x10,0x6D,0x6B,0xE7,0x39,0x20,0x00,0x20,0x00,
-	0x61,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x61,0x08,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x61,0x08,0x0C,0x63,0x2C,0x63,0xE7,0x39,0x95,0xAD,0x45,0x29,0xA2,0x10,0x30,0x84,0xCB,0x5A,0xE7,0x39,0x14,0xA5,0xA2,0x10,0x40,0x00,0xCB,0x5A,0xC7,0x39,0x82,0x10,0x61,0x08,0x41,0x08,0x40,0x00,0x86,0x31,0xEB,0x5A,0x82,0x10,0x61,0x08,0x44,0x21,0x13,0x9D,0x08,0x42,0x08,0x42,0xF3,0x9C,0x24,0x21,0xA2,0x10,0x61,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x82,0x10,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x40,0x00,0x61,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x82,0x10,
-	0x61,0x08,0x20,0x00,0xA2,0x10,0xE7,0x39,0xC7,0x39,0x65,0x29,0x41,0x08,0x61,0x08,0x03,0x19,0xE7,0x39,0x86,0x31,0x03,0x19,0x41,0x08,0x82,0x10,0x14,0xA5,0xC2,0x10,0xC2,0x10,0x61,0x08,0x40,0x00,0x82,0x10,0x82,0x10,0xE3,0x18,0x40,0x00,0x41,0x08,0x81,0x08,0x86,0x31,0xE7,0x39,0x08,0x42,0x65,0x29,0x20,0x00,0x61,0x08,0x20,0x00,
-	0x41,0x08,0x81,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x40,0x00,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x41,0x08,0x40,0x00,0x81,0x08,0x41,0x08,0x41,0x08,0x81,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x40,0x00,0x81,0x08,0x81,0x08,0x40,0x00,0x61,0x08,0x08,0x42,0x20,0x00,0x61,0x08,0x40,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x61,0x08,0xA2,0x10,0x41,0x08,0x40,0x00,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x41,0x08,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,
-	0x20,0x00,0x40,0x00,0x81,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x81,0x08,0x40,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x40,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,0x81,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x40,0x00,0x41,0x08,0x81,0x08,0x41,0x08,0x40,0x00,0x82,0x10,0x41,0x08,0x41,0x08,0x81,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x61,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x61,0x08,
-	0x61,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x81,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x81,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x40,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x40,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x40,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x20,0x00,
-	0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x61,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x40,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x61,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_79_2_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_79_2_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_79_2_dial_img_preview_data_0};
-
-    
\ No newline at end of file
@@ -0,0 +1,66 @@
+// Auto-generated by support/asset_pool.py
+// DO NOT EDIT this file
+// It will be overwritten
+// Image payloads used by more than one face asset, named with ASSET_POOL
+
+#include "../../common/asset_bin/asset_bin.h"
+
+// face_b_w_resized_dial_img_25_83598_data_9, face_b_w_resized_dial_img_26_97184_data_9
+ASSET_BIN(asset_pool_1bd0dc2eea8dce3e, "asset_pool_1bd0dc2eea8dce3e.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_2, face_b_w_resized_dial_img_3_64162_data_2
+ASSET_BIN(asset_pool_2bac83d071d22659, "asset_pool_2bac83d071d22659.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_9, face_b_w_resized_dial_img_3_64162_data_9
+ASSET_BIN(asset_pool_32e256f9e1f261c2, "asset_pool_32e256f9e1f261c2.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_6, face_b_w_resized_dial_img_26_97184_data_6
+ASSET_BIN(asset_pool_369ace2d4f3edd33, "asset_pool_369ace2d4f3edd33.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_5, face_b_w_resized_dial_img_3_64162_data_5
+ASSET_BIN(asset_pool_4be293a09c0f42f8, "asset_pool_4be293a09c0f42f8.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_4, face_b_w_resized_dial_img_3_64162_data_4
+ASSET_BIN(asset_pool_508866d554060b89, "asset_pool_508866d554060b89.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_6, face_b_w_resized_dial_img_3_64162_data_6
+ASSET_BIN(asset_pool_61e50feaa50b9f2d, "asset_pool_61e50feaa50b9f2d.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_8, face_b_w_resized_dial_img_26_97184_data_8
+ASSET_BIN(asset_pool_692fcc2edf91d72e, "asset_pool_692fcc2edf91d72e.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_1, face_b_w_resized_dial_img_3_64162_data_1
+ASSET_BIN(asset_pool_6d7c5c89de7be847, "asset_pool_6d7c5c89de7be847.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_3, face_b_w_resized_dial_img_26_97184_data_3
+ASSET_BIN(asset_pool_76b453f834f37238, "asset_pool_76b453f834f37238.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_3, face_b_w_resized_dial_img_3_64162_data_3
+ASSET_BIN(asset_pool_802c8ffc22ac75c6, "asset_pool_802c8ffc22ac75c6.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_0, face_b_w_resized_dial_img_3_64162_data_0
+ASSET_BIN(asset_pool_8c478f43439b5edd, "asset_pool_8c478f43439b5edd.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_4, face_b_w_resized_dial_img_26_97184_data_4
+ASSET_BIN(asset_pool_9e9cc4b8f6389f76, "asset_pool_9e9cc4b8f6389f76.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_8, face_b_w_resized_dial_img_3_64162_data_8
+ASSET_BIN(asset_pool_aaa3cca6df4ae6ee, "asset_pool_aaa3cca6df4ae6ee.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_5, face_b_w_resized_dial_img_26_97184_data_5
+ASSET_BIN(asset_pool_b52bcbcccfcb35c5, "asset_pool_b52bcbcccfcb35c5.bin");
+
+// face_b_w_resized_dial_img_20_82586_data_7, face_b_w_resized_dial_img_3_64162_data_7
+ASSET_BIN(asset_pool_c33a1d0b0935fa86, "asset_pool_c33a1d0b0935fa86.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_0, face_b_w_resized_dial_img_26_97184_data_0
+ASSET_BIN(asset_pool_c9904fdac0951ac4, "asset_pool_c9904fdac0951ac4.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_7, face_b_w_resized_dial_img_26_97184_data_7
+ASSET_BIN(asset_pool_d820e446dbb75216, "asset_pool_d820e446dbb75216.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_1, face_b_w_resized_dial_img_26_97184_data_1
+ASSET_BIN(asset_pool_e2126c0664e390c8, "asset_pool_e2126c0664e390c8.bin");
+
+// face_b_w_resized_dial_img_25_83598_data_2, face_b_w_resized_dial_img_26_97184_data_2
+ASSET_BIN(asset_pool_e9e36d1c841738bb, "asset_pool_e9e36d1c841738bb.bin");
@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,16 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_11_65808_data_0[] = {
-	//RGB565 data 
-	0x30,0x84,0x8A,0x52,0xCE,0x73,0x9A,0xD6,0x79,0xCE,0xCF,0x7B,0xB7,0xBD,0x7A,0xD6,0xEB,0x5A,0x79,0xCE,0x4D,0x6B,0xD7,0xBD,0x96,0xB5,0xEF,0x7B,0x9A,0xD6,0x79,0xCE,0xEB,0x5A,0x3C,0xE7,0x8E,0x73,0x96,0xB5,0xCF,0x7B,0xD7,0xBD,0x7A,0xD6,0x9A,0xD6,0xEB,0x5A,0x18,0xC6,0x4D,0x6B,0xD3,0x9C,0x30,0x84,0x72,0x94,0xEB,0x5A,0xB2,0x94,
-	0xD3,0x9C,0x0C,0x63,0x92,0x94,0x30,0x84,0xD3,0x9C,0x4C,0x63,0xF7,0xBD,0xEB,0x5A,0xDB,0xDE,0xBA,0xD6,0xF7,0xBD,0xEF,0x7B,0x96,0xB5,0x8D,0x6B,0x1C,0xE7,0xEB,0x5A,0xDB,0xDE,0xDB,0xDE,0x10,0x84,0xB6,0xB5,0xF7,0xBD,0x4D,0x6B,0x79,0xCE,0xEB,0x5A,0xFC,0xE6,0x18,0xC6,0x10,0x84,0xBA,0xD6,0xBA,0xD6,0xEF,0x7B,0xCB,0x5A,0x51,0x8C,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	
-    };
+ASSET_BIN(face_b_w_resized_dial_img_11_65808_data_0, "face_b_w_resized_dial_img_11_65808_data_0.bin");
         
 
 
@@ -29,7 +21,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_11_65808_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_11_65808_data_0),
+    .data_size = 192,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_11_65808_data_0};
 
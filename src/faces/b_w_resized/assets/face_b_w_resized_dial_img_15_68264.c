@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,59 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_0[] = {
-	//RGB565 data 
-	0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x55,0xAD,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x92,0x94,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x92,0x94,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0xCF,0x7B,0x30,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x0F,0x7C,0xCF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x10,0x84,0xEF,0x7B,0xEF,0x7B,0x0F,0x7C,0x6D,0x6B,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x0F,0x7C,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x0F,0x7C,0xCF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x6D,0x6B,0x10,0x84,0xEF,0x7B,0xEF,0x7B,0x0F,0x7C,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x0F,0x7C,0x0F,0x7C,0x0F,0x7C,0x0F,0x7C,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x14,0xA5,0x75,0xAD,0x55,0xAD,0x55,0xAD,0xF3,0x9C,0x6D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xEF,0x7B,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xEF,0x7B,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x34,0xA5,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x51,0x8C,0xB6,0xB5,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0x71,0x8C,0xD3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	0x91,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0xB6,0xB5,0x6D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x92,0x94,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x50,0x84,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,
-	0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x75,0xAD,0xF7,0xBD,0xB7,0xBD,0xB6,0xB5,0x55,0xAD,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0xD3,0x9C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x14,0xA5,0x18,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x4D,0x6B,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0xD3,0x9C,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xCF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0xB7,0xBD,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x71,0x8C,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x92,0x94,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xF3,0x9C,0xB6,0xB5,
-	0xB6,0xB5,0x96,0xB5,0x75,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x38,0xC6,0x18,0xC6,0x6D,0x6B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0C,0x63,0x4C,0x63,0xCF,0x7B,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x14,0xA5,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x51,0x8C,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xB6,0xB5,0x10,0x84,
-	0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_0, "face_b_w_resized_dial_img_15_68264_data_0.bin");
         
 
 
@@ -72,65 +21,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_0),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_1[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA2,0x10,0x24,0x21,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x92,0x94,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x51,0x8C,0xAE,0x73,0x4C,0x63,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0xCF,0x7B,0x10,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,
-	0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xF3,0x9C,0x6D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x50,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x8E,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0x71,0x8C,0xD3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	0x91,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x92,0x94,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x50,0x84,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,
-	0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB6,0xB5,0x55,0xAD,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x4D,0x6B,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0xD3,0x9C,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xCF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x92,0x94,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xF3,0x9C,0xB6,0xB5,
-	0xB6,0xB5,0x96,0xB5,0x75,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0xF7,0xBD,0xF3,0x9C,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x2C,0x63,0x2C,0x63,0x51,0x8C,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xB6,0xB5,0x10,0x84,
-	0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_1, "face_b_w_resized_dial_img_15_68264_data_1.bin");
         
 
 
@@ -138,65 +35,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_1),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_2[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA2,0x10,0x48,0x42,0x92,0x94,0x51,0x8C,0x71,0x8C,0x51,0x8C,0xAE,0x73,0x4C,0x63,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0xCF,0x7B,0x10,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,
-	0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x50,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x8E,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	0x91,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,
-	0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x35,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x75,0xAD,0xD3,0x9C,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xCF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB7,0xBD,
-	0xB6,0xB5,0x96,0xB5,0x75,0xAD,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x0C,0x63,0xF7,0xBD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,
-	0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_2, "face_b_w_resized_dial_img_15_68264_data_2.bin");
         
 
 
@@ -204,65 +49,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_2),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_3[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x71,0x8C,0x89,0x4A,0xC3,0x18,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,
-	0xC2,0x10,0x0C,0x63,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,
-	0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x6D,0x6B,0xA1,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x08,0x89,0x4A,0x51,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x50,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x8E,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	0x91,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0x14,0xA5,0xF3,0x9C,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,
-	0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x55,0xAD,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x51,0x8C,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xCF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB7,0xBD,
-	0xB6,0xB5,0x96,0xB5,0x55,0xAD,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x0C,0x63,0xF7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x89,0x4A,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x03,0x19,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x34,0xA5,0x4D,0x6B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_3, "face_b_w_resized_dial_img_15_68264_data_3.bin");
         
 
 
@@ -270,65 +63,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_3),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_4[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x71,0x8C,0x89,0x4A,0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x82,0x10,0x0B,0x5B,0x10,0x84,0x10,0x84,0x30,0x84,0x10,0x84,0x65,0x29,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA2,0x10,0x04,0x21,0xCF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,
-	0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x6D,0x6B,0xA1,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x71,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0x08,0x42,0x61,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x50,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x8E,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x4D,0x6B,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	0x91,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0x14,0xA5,0xF3,0x9C,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,
-	0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x55,0xAD,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,
-	0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x51,0x8C,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xCF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB7,0xBD,
-	0xB6,0xB5,0x96,0xB5,0x55,0xAD,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x0C,0x63,0xF7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x89,0x4A,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x03,0x19,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x55,0xAD,0xB2,0x94,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x2C,0x63,0x2C,0x63,
-	0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_4, "face_b_w_resized_dial_img_15_68264_data_4.bin");
         
 
 
@@ -336,65 +77,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_4),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_5[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x71,0x8C,0x89,0x4A,0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x82,0x10,0x0B,0x5B,0x10,0x84,0x10,0x84,0x30,0x84,0x10,0x84,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA2,0x10,0x08,0x42,0x10,0x84,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,
-	0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x6D,0x6B,0xA1,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x71,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x61,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x65,0x29,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x50,0x84,0x30,0x84,0x30,0x84,0x30,0x84,0x8E,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x4D,0x6B,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	0x91,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0x14,0xA5,0xF3,0x9C,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,
-	0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x55,0xAD,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,
-	0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x51,0x8C,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xCF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB7,0xBD,
-	0xB6,0xB5,0x96,0xB5,0x55,0xAD,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x76,0xB5,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x0C,0x63,0xF7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x89,0x4A,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x03,0x19,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xA2,0x10,
-	0x0B,0x5B,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x55,0xAD,0xEF,0x7B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_5, "face_b_w_resized_dial_img_15_68264_data_5.bin");
         
 
 
@@ -402,65 +91,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_5),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_6[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x71,0x8C,0x89,0x4A,0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x82,0x10,0x0B,0x5B,0x10,0x84,0x10,0x84,0x30,0x84,0x10,0x84,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC6,0x31,0xEF,0x7B,0xCF,0x7B,0x10,0x84,0x30,0x84,0x48,0x42,
-	0xC3,0x18,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0x0C,0x63,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x6D,0x6B,0xA1,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x71,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x10,0x84,0x50,0x84,0x30,0x84,0x51,0x8C,0x2C,0x63,0xA1,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x61,0x08,0x89,0x4A,0x51,0x8C,0x30,0x84,0x30,0x84,0x30,0x84,0x8E,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x4D,0x6B,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x51,0x8C,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,
-	0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0x14,0xA5,0xF3,0x9C,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,
-	0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB3,0x9C,0xB2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x55,0xAD,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,
-	0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x14,0xA5,0x2C,0x63,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x51,0x8C,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x30,0x84,0xC3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x0C,0x63,0x71,0x8C,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB7,0xBD,
-	0xB6,0xB5,0x96,0xB5,0x55,0xAD,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x76,0xB5,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x14,0xA5,0x86,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x0C,0x63,0xF7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x89,0x4A,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x03,0x19,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xA2,0x10,
-	0x0B,0x5B,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x89,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xE3,0x18,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x34,0xA5,0x4D,0x6B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0C,0x63,0x2C,0x63,0x8E,0x73,0x55,0xAD,0x75,0xAD,0x75,0xAD,0x96,0xB5,0xD3,0x9C,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_6, "face_b_w_resized_dial_img_15_68264_data_6.bin");
         
 
 
@@ -468,65 +105,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_6),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_7[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x71,0x8C,0x89,0x4A,0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x82,0x10,0x0B,0x5B,0x10,0x84,0x10,0x84,0x30,0x84,0x10,0x84,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC6,0x31,0xEF,0x7B,0xCF,0x7B,0x10,0x84,0x30,0x84,0x48,0x42,
-	0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0xCB,0x5A,0xEF,0x7B,0x0F,0x7C,0x10,0x84,0xEF,0x7B,0x65,0x29,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA2,0x10,0x04,0x21,0xCF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xEF,0x7B,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x6D,0x6B,0xA1,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x71,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x10,0x84,0x50,0x84,0x30,0x84,0x51,0x8C,0x2C,0x63,0x81,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x51,0x8C,0x30,0x84,0x30,0x84,0x30,0x84,0x08,0x42,0x61,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x30,0x84,0x10,0x84,0x4D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x4D,0x6B,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x51,0x8C,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,
-	0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x4C,0x63,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0x14,0xA5,0xF3,0x9C,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,
-	0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x30,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x55,0xAD,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,
-	0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x14,0xA5,0x2C,0x63,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xB3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x51,0x8C,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x30,0x84,0xC3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x14,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB7,0xBD,
-	0xB6,0xB5,0x96,0xB5,0x55,0xAD,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x76,0xB5,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x14,0xA5,0x86,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x51,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xB3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x0C,0x63,0xF7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x89,0x4A,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x03,0x19,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xA2,0x10,
-	0x0B,0x5B,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x89,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xE3,0x18,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x55,0xAD,0xB2,0x94,0x0B,0x5B,
-	0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x2C,0x63,0x2C,0x63,0x30,0x84,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_7, "face_b_w_resized_dial_img_15_68264_data_7.bin");
         
 
 
@@ -534,65 +119,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_7),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_8[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x71,0x8C,0x89,0x4A,0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x82,0x10,0x0B,0x5B,0x10,0x84,0x10,0x84,0x30,0x84,0x10,0x84,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC6,0x31,0xEF,0x7B,0xCF,0x7B,0x10,0x84,0x30,0x84,0x48,0x42,
-	0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0xCB,0x5A,0xEF,0x7B,0x0F,0x7C,0x10,0x84,0xEF,0x7B,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA2,0x10,
-	0x08,0x42,0x10,0x84,0xEF,0x7B,0x10,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x6D,0x6B,0xA1,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x71,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x10,0x84,0x50,0x84,0x30,0x84,0x51,0x8C,0x2C,0x63,0x81,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x51,0x8C,0x30,0x84,0x30,0x84,0x30,0x84,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x61,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x65,0x29,0x0F,0x7C,0x30,0x84,0x30,0x84,
-	0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x4D,0x6B,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x51,0x8C,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,
-	0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x4C,0x63,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0x14,0xA5,0xF3,0x9C,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,
-	0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x92,0x94,0xD2,0x94,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x55,0xAD,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,
-	0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x14,0xA5,0x2C,0x63,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xF3,0x9C,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x51,0x8C,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x30,0x84,0xC3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x34,0xA5,0xB2,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x35,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB7,0xBD,
-	0xB6,0xB5,0x96,0xB5,0x55,0xAD,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x76,0xB5,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x14,0xA5,0x86,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x76,0xB5,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x55,0xAD,0xAE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8E,0x73,0x34,0xA5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x0C,0x63,0xF7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x89,0x4A,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x03,0x19,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xA2,0x10,
-	0x0B,0x5B,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x89,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xE3,0x18,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0xA2,0x10,
-	0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xA2,0x10,0x0B,0x5B,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x55,0xAD,0xEF,0x7B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0C,0x63,0x2C,0x63,0x4C,0x63,0xF3,0x9C,0x96,0xB5,0x75,0xAD,0x75,0xAD,0x55,0xAD,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_8, "face_b_w_resized_dial_img_15_68264_data_8.bin");
         
 
 
@@ -600,65 +133,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_8),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_9[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x71,0x8C,0x89,0x4A,0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x82,0x10,0x0B,0x5B,0x10,0x84,0x10,0x84,0x30,0x84,0x10,0x84,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC6,0x31,0xEF,0x7B,0xCF,0x7B,0x10,0x84,0x30,0x84,0x48,0x42,
-	0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0xCB,0x5A,0xEF,0x7B,0x0F,0x7C,0x10,0x84,0xEF,0x7B,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0xC6,0x31,0xEF,0x7B,0xCF,0x7B,0x10,0x84,0x30,0x84,0x48,0x42,0xC3,0x18,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0x0C,0x63,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x10,0x84,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x6D,0x6B,0xA1,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x71,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x10,0x84,0x50,0x84,0x30,0x84,0x51,0x8C,0x2C,0x63,0x81,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x51,0x8C,0x30,0x84,0x30,0x84,0x30,0x84,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x10,0x84,0x50,0x84,0x30,0x84,
-	0x51,0x8C,0x2C,0x63,0xA1,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x08,0x89,0x4A,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x10,0x84,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x4D,0x6B,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x51,0x8C,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,
-	0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x4C,0x63,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x51,0x8C,0x03,0x19,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x10,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCF,0x7B,0x92,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0x14,0xA5,0xF3,0x9C,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,
-	0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x92,0x94,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xAE,0x73,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x55,0xAD,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,
-	0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x14,0xA5,0x2C,0x63,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x14,0xA5,0x2C,0x63,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x92,0x94,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x51,0x8C,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x30,0x84,0xC3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x30,0x84,0xC3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x35,0xAD,0x30,0x84,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0B,0x5B,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB7,0xBD,
-	0xB6,0xB5,0x96,0xB5,0x55,0xAD,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x76,0xB5,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x14,0xA5,0x86,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x76,0xB5,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x76,0xB5,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x14,0xA5,0x86,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0xF3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0x10,0x84,0x7A,0xD6,0x18,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0x18,0xC6,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x0C,0x63,0xF7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x89,0x4A,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x03,0x19,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xA2,0x10,
-	0x0B,0x5B,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x89,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xE3,0x18,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x14,0xA5,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x86,0x31,0x55,0xAD,0x96,0xB5,0x75,0xAD,0x75,0xAD,0xEF,0x7B,0xA2,0x10,
-	0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xA2,0x10,0x0B,0x5B,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x89,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xE3,0x18,0x51,0x8C,0xB6,0xB5,0x75,0xAD,0x55,0xAD,0x34,0xA5,0x4D,0x6B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0C,0x63,0x2C,0x63,0x6D,0x6B,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_9, "face_b_w_resized_dial_img_15_68264_data_9.bin");
         
 
 
@@ -666,65 +147,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_9),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_9};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_15_68264_data_10[] = {
-	//RGB565 data 
-	0x86,0x31,0xE3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0xF3,0x9C,0x14,0xA5,0x34,0xA5,0x55,0xAD,0x10,0x84,0x03,0x19,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x71,0x8C,0x89,0x4A,0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x82,0x10,0x0B,0x5B,0x10,0x84,0x10,0x84,0x30,0x84,0x10,0x84,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC6,0x31,0xEF,0x7B,0xCF,0x7B,0x10,0x84,0x30,0x84,0x48,0x42,
-	0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0xCB,0x5A,0xEF,0x7B,0x0F,0x7C,0x10,0x84,0xEF,0x7B,0x65,0x29,0xC3,0x18,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xAE,0x73,0xCF,0x7B,0x10,0x84,0x30,0x84,0x4D,0x6B,0x03,0x19,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0xC6,0x31,0xEF,0x7B,0xCF,0x7B,0x10,0x84,0x30,0x84,0x48,0x42,0xC3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0xCB,0x5A,0xEF,0x7B,0x0F,0x7C,0x30,0x84,0x0F,0x7C,0x65,0x29,0xC3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA2,0x10,0x04,0x21,0xEF,0x7B,0x10,0x84,0xCB,0x5A,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x71,0x8C,0x96,0xB5,0x55,0xAD,0x55,0xAD,0xD3,0x9C,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x6D,0x6B,0xA1,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x71,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x10,0x84,0x50,0x84,0x30,0x84,0x51,0x8C,0x2C,0x63,0x81,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x51,0x8C,0x30,0x84,0x30,0x84,0x30,0x84,0x08,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x30,0x84,0x50,0x84,0xCF,0x7B,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x10,0x84,0x50,0x84,0x30,0x84,
-	0x51,0x8C,0x2C,0x63,0xA1,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x71,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x08,0x42,0x61,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xA2,0x10,0x6D,0x6B,0x51,0x8C,0x51,0x8C,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0x2C,0x63,0xB7,0xBD,0x96,0xB5,0x75,0xAD,0x96,0xB5,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0xD3,0x9C,0x92,0x94,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x4D,0x6B,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x51,0x8C,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,
-	0x71,0x8C,0x92,0x94,0x92,0x94,0xB2,0x94,0x4C,0x63,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC3,0x18,0xAE,0x73,0x92,0x94,0x92,0x94,0x92,0x94,0x51,0x8C,0x03,0x19,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x4D,0x6B,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0xB2,0x94,0x55,0xAD,0x65,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x08,0x42,0xB7,0xBD,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0x8E,0x73,0xA1,0x08,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x2C,0x63,0x34,0xA5,0xF3,0x9C,0x14,0xA5,0xF3,0x9C,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,
-	0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xF3,0x9C,0x2C,0x63,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0xD3,0x9C,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x08,0x42,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0xC2,0x10,0x30,0x84,0xD3,0x9C,0xB2,0x94,0xD3,0x9C,0x10,0x84,0x04,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xC6,0x31,0xB2,0x94,0x7A,0xD6,0x48,0x42,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,0x14,0xA5,0xF7,0xBD,0xB7,0xBD,0xB7,0xBD,0xF3,0x9C,0xC2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0x34,0xA5,0x35,0xAD,0x34,0xA5,0x55,0xAD,0x4D,0x6B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,
-	0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x14,0xA5,0x2C,0x63,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x50,0x84,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x08,0x42,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x14,0xA5,0x2C,0x63,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0x14,0xA5,
-	0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x04,0x21,0x30,0x84,0x7A,0xD6,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x30,0x84,0x38,0xC6,0xF7,0xBD,0xF7,0xBD,0xB7,0xBD,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0x03,0x19,0x14,0xA5,0x75,0xAD,0x75,0xAD,0x96,0xB5,0x51,0x8C,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,
-	0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x30,0x84,0xC3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0x81,0x08,0xAE,0x73,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0xD3,0x9C,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x30,0x84,0xC3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x48,0x42,0x55,0xAD,0x34,0xA5,0x34,0xA5,0x55,0xAD,0xCB,0x5A,
-	0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xAE,0x73,0x7A,0xD6,0x34,0xA5,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x0C,0x63,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x4C,0x63,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x30,0x84,0xB6,0xB5,
-	0xB6,0xB5,0x96,0xB5,0x35,0xAD,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x75,0xAD,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x14,0xA5,0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x89,0x4A,0x75,0xAD,0x55,0xAD,
-	0x55,0xAD,0x75,0xAD,0x0B,0x5B,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0x0F,0x7C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x14,0xA5,0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0xF3,0x9C,0x75,0xAD,0x55,0xAD,0x75,0xAD,0x51,0x8C,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0x89,0x4A,0x7A,0xD6,0x38,0xC6,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x18,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x92,0x94,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x0B,0x5B,0xF7,0xBD,0xB6,0xB5,0xB6,0xB5,0xF7,0xBD,0x89,0x4A,
-	0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x51,0x8C,0xB6,0xB5,0x96,0xB5,0x96,0xB5,0x55,0xAD,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x75,0xAD,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0x10,0x84,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,
-	0xCB,0x5A,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0x89,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x51,0x8C,0xB6,0xB5,0x96,0xB5,0x96,0xB5,0x55,0xAD,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x86,0x31,0x75,0xAD,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0x10,0x84,0xA2,0x10,
-	0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCB,0x5A,0xB7,0xBD,0x96,0xB5,0x96,0xB5,0xB7,0xBD,0x89,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xC2,0x10,0x51,0x8C,0xB6,0xB5,0x96,0xB5,0x96,0xB5,0x55,0xAD,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x24,0x21,
-	
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_15_68264_data_10, "face_b_w_resized_dial_img_15_68264_data_10.bin");
         
 
 
@@ -732,7 +161,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_15_68264_10 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 124,
     .header.h = 8,
-    .data_size = sizeof(face_b_w_resized_dial_img_15_68264_data_10),
+    .data_size = 2976,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_15_68264_data_10};
 
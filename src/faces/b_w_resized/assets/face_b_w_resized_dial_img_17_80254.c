@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,14 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_0[] = {
-	//RGB565 data 
-	0x9A,0xD6,0x76,0xB5,0x71,0x8C,0x76,0xB5,0x9A,0xD6,0x92,0x94,0xE7,0x39,0xCB,0x5A,0xE7,0x39,0x92,0x94,0x28,0x42,0x10,0x84,0x9A,0xD6,0x10,0x84,0x28,0x42,0x85,0x29,0x55,0xAD,0x9A,0xD6,0x55,0xAD,0x85,0x29,0x45,0x29,0x96,0xB5,0x9A,0xD6,0x96,0xB5,0x45,0x29,0x65,0x29,0x96,0xB5,0xBA,0xD6,0x96,0xB5,0x65,0x29,0xA6,0x31,0x55,0xAD,
-	0xFB,0xDE,0x55,0xAD,0xA6,0x31,0x0C,0x63,0x2C,0x63,0x38,0xC6,0x2C,0x63,0x0C,0x63,0xF8,0xC5,0xCB,0x5A,0x49,0x4A,0xEB,0x5A,0xF7,0xBD,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_0, "face_b_w_resized_dial_img_17_80254_data_0.bin");
         
 
 
@@ -27,20 +21,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_0),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_1[] = {
-	//RGB565 data 
-	0x9A,0xD6,0x59,0xCE,0xF3,0x9C,0x96,0xB5,0x9A,0xD6,0x38,0xC6,0x92,0x94,0x24,0x21,0x2C,0x63,0x39,0xCE,0x38,0xC6,0x39,0xCE,0x30,0x84,0x6D,0x6B,0x59,0xCE,0x58,0xC6,0x79,0xCE,0x51,0x8C,0x6D,0x6B,0x79,0xCE,0x59,0xCE,0x9A,0xD6,0x72,0x94,0x8E,0x73,0x9A,0xD6,0x79,0xCE,0x9A,0xD6,0x72,0x94,0x8E,0x73,0x9A,0xD6,0x79,0xCE,0xBA,0xD6,
-	0x92,0x94,0x8E,0x73,0xBA,0xD6,0x79,0xCE,0x59,0xCE,0x30,0x84,0x4D,0x6B,0x59,0xCE,0xBA,0xD6,0xCF,0x7B,0xC6,0x31,0x86,0x31,0x2C,0x63,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_1, "face_b_w_resized_dial_img_17_80254_data_1.bin");
         
 
 
@@ -48,20 +35,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_1),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_2[] = {
-	//RGB565 data 
-	0x79,0xCE,0xD3,0x9C,0x30,0x84,0x75,0xAD,0x59,0xCE,0x0C,0x63,0x8A,0x52,0xEB,0x5A,0xE7,0x39,0xF4,0xA4,0x34,0xA5,0x18,0xC6,0x79,0xCE,0x2C,0x63,0xEB,0x5A,0x59,0xCE,0x59,0xCE,0x79,0xCE,0x8E,0x73,0xEB,0x5A,0x59,0xCE,0x79,0xCE,0x79,0xCE,0x49,0x4A,0x51,0x8C,0x79,0xCE,0x9A,0xD6,0x10,0x84,0x69,0x4A,0x38,0xC6,0xBA,0xD6,0x34,0xA5,
-	0xC7,0x39,0x96,0xB5,0xBA,0xD6,0x14,0xA5,0xE7,0x39,0x92,0x94,0x18,0xC6,0x18,0xC6,0xA6,0x31,0x65,0x29,0x8A,0x52,0x48,0x42,0x69,0x4A,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_2, "face_b_w_resized_dial_img_17_80254_data_2.bin");
         
 
 
@@ -69,20 +49,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_2),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_3[] = {
-	//RGB565 data 
-	0x18,0xC6,0xD3,0x9C,0x10,0x84,0xF4,0xA4,0x18,0xC6,0x6D,0x6B,0x8A,0x52,0x2C,0x63,0xC7,0x39,0x10,0x84,0xD7,0xBD,0x18,0xC6,0x9A,0xD6,0xEF,0x7B,0x07,0x3A,0x59,0xCE,0x38,0xC6,0xF7,0xBD,0xEB,0x5A,0x2C,0x63,0x9A,0xD6,0xB2,0x94,0x65,0x29,0xE7,0x39,0xF8,0xC5,0x79,0xCE,0xF8,0xC5,0x34,0xA5,0x0C,0x63,0x2C,0x63,0x9A,0xD6,0xBA,0xD6,
-	0xDB,0xDE,0x96,0xB5,0x24,0x21,0xEF,0x7B,0x75,0xAD,0x18,0xC6,0xEF,0x7B,0xC6,0x31,0xCF,0x7B,0x6A,0x52,0x49,0x4A,0xAA,0x52,0x55,0xAD,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_3, "face_b_w_resized_dial_img_17_80254_data_3.bin");
         
 
 
@@ -90,20 +63,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_3),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_4[] = {
-	//RGB565 data 
-	0x9A,0xD6,0x59,0xCE,0xF7,0xBD,0x34,0xA5,0x79,0xCE,0x18,0xC6,0x38,0xC6,0x8E,0x73,0x24,0x21,0x34,0xA5,0x59,0xCE,0x55,0xAD,0x49,0x4A,0x08,0x42,0x34,0xA5,0x59,0xCE,0x0B,0x5B,0x10,0x84,0x8A,0x52,0x34,0xA5,0xF4,0xA4,0xCB,0x5A,0x79,0xCE,0x6A,0x52,0x55,0xAD,0x28,0x42,0xCE,0x73,0x55,0xAD,0x08,0x42,0x51,0x8C,0xEB,0x5A,0xEB,0x5A,
-	0xEB,0x5A,0x45,0x29,0xAA,0x52,0x79,0xCE,0x79,0xCE,0x59,0xCE,0x69,0x4A,0x34,0xA5,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0x6D,0x6B,0xD7,0xBD,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_4, "face_b_w_resized_dial_img_17_80254_data_4.bin");
         
 
 
@@ -111,20 +77,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_4),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_5[] = {
-	//RGB565 data 
-	0x18,0xC6,0xB2,0x94,0x71,0x8C,0x51,0x8C,0x55,0xAD,0x10,0x84,0x85,0x29,0x0C,0x63,0xEB,0x5A,0x72,0x94,0xAE,0x73,0x2C,0x63,0x9A,0xD6,0x79,0xCE,0x59,0xCE,0x6D,0x6B,0x8A,0x52,0x10,0x84,0xD2,0x94,0x38,0xC6,0x92,0x94,0x0C,0x63,0xEF,0x7B,0xE7,0x39,0x6D,0x6B,0x79,0xCE,0x9A,0xD6,0xDB,0xDE,0x14,0xA5,0x65,0x29,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xB6,0xB5,0x45,0x29,0x10,0x84,0x75,0xAD,0x18,0xC6,0x4D,0x6B,0x49,0x4A,0xCE,0x73,0x6A,0x52,0x49,0x4A,0xAA,0x52,0xD7,0xBD,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_5, "face_b_w_resized_dial_img_17_80254_data_5.bin");
         
 
 
@@ -132,20 +91,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_5),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_6[] = {
-	//RGB565 data 
-	0xDB,0xDE,0xD7,0xBD,0x51,0x8C,0xB2,0x94,0x38,0xC6,0x55,0xAD,0x28,0x42,0x8A,0x52,0xAA,0x52,0x8E,0x73,0xCB,0x5A,0x4D,0x6B,0x79,0xCE,0x59,0xCE,0x18,0xC6,0xC7,0x39,0x14,0xA5,0x75,0xAD,0x96,0xB5,0x59,0xCE,0x65,0x29,0xEB,0x5A,0xCB,0x5A,0x08,0x42,0x30,0x84,0xE3,0x18,0xB2,0x94,0x9A,0xD6,0xF3,0x9C,0xA6,0x31,0xC6,0x31,0x75,0xAD,
-	0xDB,0xDE,0xF7,0xBD,0x86,0x31,0x2C,0x63,0x2C,0x63,0x58,0xC6,0x51,0x8C,0x28,0x42,0x59,0xCE,0x4D,0x6B,0x8A,0x52,0xCB,0x5A,0x96,0xB5,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_6, "face_b_w_resized_dial_img_17_80254_data_6.bin");
         
 
 
@@ -153,20 +105,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_6),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_7[] = {
-	//RGB565 data 
-	0xB2,0x94,0x71,0x8C,0x10,0x84,0x71,0x8C,0xB2,0x94,0x4D,0x6B,0x0B,0x5B,0x2C,0x63,0x08,0x42,0x65,0x29,0x59,0xCE,0x59,0xCE,0x38,0xC6,0xAA,0x52,0x71,0x8C,0x58,0xC6,0x79,0xCE,0x92,0x94,0x8A,0x52,0x59,0xCE,0x79,0xCE,0x79,0xCE,0xAA,0x52,0x51,0x8C,0x9A,0xD6,0x9A,0xD6,0xF7,0xBD,0xC7,0x39,0x96,0xB5,0x9A,0xD6,0xBA,0xD6,0x55,0xAD,
-	0xC6,0x31,0x18,0xC6,0x9A,0xD6,0xBA,0xD6,0x92,0x94,0x28,0x42,0x58,0xC6,0x9A,0xD6,0xBA,0xD6,0xD2,0x94,0x4D,0x6B,0xBA,0xD6,0x9A,0xD6,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_7, "face_b_w_resized_dial_img_17_80254_data_7.bin");
         
 
 
@@ -174,20 +119,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_7),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_8[] = {
-	//RGB565 data 
-	0x9A,0xD6,0x75,0xAD,0x71,0x8C,0x55,0xAD,0x9A,0xD6,0x92,0x94,0x48,0x42,0x8E,0x73,0x49,0x4A,0x10,0x84,0xAA,0x52,0x10,0x84,0xBB,0xDE,0xB2,0x94,0x49,0x4A,0xAE,0x73,0xEB,0x5A,0x38,0xC6,0x30,0x84,0xEB,0x5A,0xF8,0xC5,0xC7,0x39,0xE7,0x39,0x08,0x42,0xB6,0xB5,0x6D,0x6B,0x10,0x84,0x34,0xA5,0x49,0x4A,0x8E,0x73,0xC6,0x31,0xF7,0xBD,
-	0xFB,0xDE,0xB6,0xB5,0x65,0x29,0xE7,0x39,0x92,0x94,0x79,0xCE,0xB2,0x94,0xC7,0x39,0x14,0xA5,0xAA,0x52,0xCB,0x5A,0xCB,0x5A,0xF4,0xA4,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_8, "face_b_w_resized_dial_img_17_80254_data_8.bin");
         
 
 
@@ -195,20 +133,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_8),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_17_80254_data_9[] = {
-	//RGB565 data 
-	0xBA,0xD6,0x34,0xA5,0x10,0x84,0x76,0xB5,0xDB,0xDE,0xCF,0x7B,0x49,0x4A,0x2C,0x63,0x08,0x42,0xD2,0x94,0x86,0x31,0x14,0xA5,0x9A,0xD6,0x30,0x84,0x48,0x42,0x86,0x31,0xB6,0xB5,0x9A,0xD6,0x75,0xAD,0x86,0x31,0x28,0x42,0xEF,0x7B,0xD7,0xBD,0x8E,0x73,0xE3,0x18,0x75,0xAD,0xEB,0x5A,0xCB,0x5A,0xAE,0x73,0xC6,0x31,0xBA,0xD6,0xBA,0xD6,
-	0xDB,0xDE,0x14,0xA5,0x08,0x42,0x75,0xAD,0xB6,0xB5,0xD7,0xBD,0x49,0x4A,0x10,0x84,0x10,0x84,0x08,0x42,0xC7,0x39,0x6D,0x6B,0x59,0xCE,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_17_80254_data_9, "face_b_w_resized_dial_img_17_80254_data_9.bin");
         
 
 
@@ -216,7 +147,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_17_80254_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_17_80254_data_9),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_17_80254_data_9};
 
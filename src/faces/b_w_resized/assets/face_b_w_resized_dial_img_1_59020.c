@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,26 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_1_59020_data_0[] = {
-	//RGB565 data 
-	0x61,0x08,0x65,0x29,0xCB,0x5A,0xEB,0x5A,0xEB,0x5A,0xCB,0x5A,0xCB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0x8A,0x52,0xC3,0x18,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0xCF,0x7B,0x14,0xA5,0xCF,0x7B,0xCF,0x7B,0x30,0x84,
-	0x71,0x8C,0xCF,0x7B,0xCF,0x7B,0x10,0x84,0x96,0xB5,0x28,0x42,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x10,0x84,0xCB,0x5A,0xE3,0x18,0x65,0x29,0x0C,0x63,0x71,0x8C,0x85,0x29,0x65,0x29,0xA2,0x10,0x92,0x94,0x8A,0x52,
-	0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x10,0x84,0xCB,0x5A,0xAA,0x52,0x0F,0x7C,0xD3,0x9C,0x75,0xAD,0xEF,0x7B,0xCF,0x7B,0x24,0x21,0x71,0x8C,0x8A,0x52,0x61,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0xEF,0x7B,0xEB,0x5A,0xC3,0x18,0xE3,0x18,0xEB,0x5A,0x71,0x8C,0x04,0x21,0x04,0x21,0xE3,0x18,0x92,0x94,0x8A,0x52,0x61,0x08,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x41,0x08,0xEF,0x7B,0x2C,0x63,0xAE,0x73,0x92,0x94,0x92,0x94,0xB2,0x94,0x71,0x8C,0x71,0x8C,0x69,0x4A,0x71,0x8C,0x8A,0x52,0x20,0x00,0x08,0x42,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0xF3,0x9C,0x41,0x08,0x71,0x8C,0x69,0x4A,0xA2,0x10,
-	0x65,0x29,0x86,0x31,0x85,0x29,0x85,0x29,0x04,0x21,0xA2,0x10,0x92,0x94,0x8A,0x52,0x41,0x08,0xE3,0x18,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC7,0x39,0x86,0x31,0xA2,0x10,0x92,0x94,0xC7,0x39,0x28,0x42,0xF3,0x9C,0xEF,0x7B,0xEF,0x7B,0x71,0x8C,0x71,0x8C,0xC3,0x18,
-	0x92,0x94,0x8A,0x52,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x45,0x29,0xF3,0x9C,0x04,0x21,0x2C,0x63,0x2C,0x63,0x00,0x00,0x00,0x00,0x45,0x29,0xF3,0x9C,0x04,0x21,0x71,0x8C,0x8A,0x52,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,
-	0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x28,0x42,0xB2,0x94,0x61,0x08,0x2C,0x63,0xD3,0x9C,0x0C,0x63,0x0C,0x63,0xCF,0x7B,0xB2,0x94,0xE3,0x18,0x71,0x8C,0x8A,0x52,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,
-	0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x71,0x8C,0x2C,0x63,0x41,0x08,0xAA,0x52,0x30,0x84,0x8A,0x52,0xAA,0x52,0xAA,0x52,0x08,0x42,0x45,0x29,0xF3,0x9C,0x69,0x4A,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x10,0x84,0x04,0x21,
-	0x20,0x00,0x62,0x10,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0x0C,0x63,0xF3,0x9C,0x92,0x94,0x24,0x21,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_1_59020_data_0, "face_b_w_resized_dial_img_1_59020_data_0.bin");
         
 
 
@@ -39,32 +21,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_1_59020_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_1_59020_data_0),
+    .data_size = 936,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_1_59020_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_1_59020_data_1[] = {
-	//RGB565 data 
-	0x61,0x08,0x45,0x29,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0x0C,0x63,0x2C,0x63,0xAA,0x52,0xC3,0x18,0x61,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0xCF,0x7B,0x14,0xA5,0xCF,0x7B,0xCF,0x7B,0x30,0x84,
-	0x92,0x94,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0x96,0xB5,0x8A,0x52,0x41,0x08,0x61,0x08,0xA2,0x10,0xAA,0x52,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0x28,0x42,0x61,0x08,0x41,0x08,0x10,0x84,0xCB,0x5A,0xE3,0x18,0x65,0x29,0xEB,0x5A,0x71,0x8C,0x85,0x29,0x65,0x29,0x61,0x08,0x30,0x84,0x0C,0x63,
-	0x41,0x08,0x61,0x08,0xA2,0x10,0x4D,0x6B,0x0F,0x7C,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x10,0x84,0x0C,0x63,0x82,0x10,0x41,0x08,0x10,0x84,0xCB,0x5A,0xAA,0x52,0x0F,0x7C,0xD3,0x9C,0x75,0xAD,0x0F,0x7C,0xEF,0x7B,0x24,0x21,0x30,0x84,0xEB,0x5A,0x41,0x08,0x82,0x10,0x81,0x08,0x41,0x08,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x10,0x84,0xEB,0x5A,0xC3,0x18,0xE3,0x18,0xEB,0x5A,0x71,0x8C,0x04,0x21,0x04,0x21,0xA2,0x10,0x30,0x84,0xEB,0x5A,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x62,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x62,0x10,
-	0x82,0x10,0x82,0x10,0x41,0x08,0xEF,0x7B,0x4C,0x63,0xAE,0x73,0x92,0x94,0x92,0x94,0xB2,0x94,0x71,0x8C,0x92,0x94,0x8A,0x52,0x30,0x84,0xEB,0x5A,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x51,0x8C,0x8A,0x52,0x82,0x10,
-	0x65,0x29,0x86,0x31,0x85,0x29,0x85,0x29,0x04,0x21,0x81,0x08,0x51,0x8C,0xEB,0x5A,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x92,0x94,0xC7,0x39,0x28,0x42,0x14,0xA5,0xEF,0x7B,0xEF,0x7B,0x51,0x8C,0x71,0x8C,0xA2,0x10,
-	0x30,0x84,0xEB,0x5A,0x41,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x24,0x21,0xF3,0x9C,0x04,0x21,0x4C,0x63,0xAE,0x73,0x00,0x00,0x00,0x00,0x04,0x21,0xF3,0x9C,0xE3,0x18,0x30,0x84,0xEB,0x5A,0x41,0x08,0x61,0x08,0x61,0x08,0x82,0x10,
-	0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x61,0x08,0x28,0x42,0xD3,0x9C,0x61,0x08,0x2C,0x63,0xF3,0x9C,0x0C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0xA2,0x10,0x30,0x84,0xEB,0x5A,0x41,0x08,0x04,0x21,0xCF,0x7B,0x71,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,
-	0x51,0x8C,0x51,0x8C,0x51,0x8C,0xEF,0x7B,0x71,0x8C,0x2C,0x63,0x41,0x08,0xAA,0x52,0x30,0x84,0x8A,0x52,0xAA,0x52,0xAA,0x52,0x08,0x42,0x24,0x21,0x92,0x94,0xEB,0x5A,0x41,0x08,0xE3,0x18,0xAA,0x52,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAA,0x52,0x10,0x84,0x04,0x21,
-	0x20,0x00,0x61,0x08,0x82,0x10,0x20,0x00,0x20,0x00,0x20,0x00,0xEB,0x5A,0xF3,0x9C,0x92,0x94,0x65,0x29,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_1_59020_data_1, "face_b_w_resized_dial_img_1_59020_data_1.bin");
         
 
 
@@ -72,32 +35,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_1_59020_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_1_59020_data_1),
+    .data_size = 936,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_1_59020_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_1_59020_data_2[] = {
-	//RGB565 data 
-	0x61,0x08,0x45,0x29,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xEB,0x5A,0x2C,0x63,0xCB,0x5A,0xE3,0x18,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x41,0x08,0xCF,0x7B,0x14,0xA5,0xCF,0x7B,0xCF,0x7B,0x30,0x84,
-	0x92,0x94,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0x75,0xAD,0xEB,0x5A,0x41,0x08,0x61,0x08,0xE3,0x18,0x51,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x30,0x84,0x65,0x29,0x41,0x08,0x10,0x84,0xCB,0x5A,0xC3,0x18,0x65,0x29,0xAA,0x52,0xB2,0x94,0x86,0x31,0x85,0x29,0x41,0x08,0x0F,0x7C,0x8E,0x73,
-	0x41,0x08,0x61,0x08,0xA2,0x10,0x08,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x08,0x42,0xE3,0x18,0x41,0x08,0x10,0x84,0xCB,0x5A,0x8A,0x52,0x0F,0x7C,0x92,0x94,0x96,0xB5,0x10,0x84,0xEF,0x7B,0x24,0x21,0xEF,0x7B,0x6D,0x6B,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x10,0x84,0xEB,0x5A,0xC3,0x18,0xE3,0x18,0x69,0x4A,0xF3,0x9C,0x24,0x21,0x04,0x21,0x82,0x10,0x10,0x84,0x6D,0x6B,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x61,0x08,0x82,0x10,0x41,0x08,0xEF,0x7B,0x4D,0x6B,0xAE,0x73,0x92,0x94,0x92,0x94,0xB2,0x94,0x71,0x8C,0x92,0x94,0xAA,0x52,0xEF,0x7B,0x6D,0x6B,0x41,0x08,0x82,0x10,0x61,0x08,0x04,0x21,0x0C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x2C,0x63,0xE3,0x18,0x61,0x08,0x41,0x08,0x30,0x84,0x8A,0x52,0xA2,0x10,
-	0x65,0x29,0x86,0x31,0x85,0x29,0x85,0x29,0x24,0x21,0x41,0x08,0x10,0x84,0x6D,0x6B,0x41,0x08,0x82,0x10,0x61,0x08,0x24,0x21,0x6D,0x6B,0xCF,0x7B,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xCF,0x7B,0x8E,0x73,0xE3,0x18,0x61,0x08,0x82,0x10,0x92,0x94,0xC7,0x39,0x08,0x42,0x14,0xA5,0xEF,0x7B,0xEF,0x7B,0x51,0x8C,0x92,0x94,0x82,0x10,
-	0x0F,0x7C,0x6D,0x6B,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x82,0x10,0x24,0x21,0xF3,0x9C,0x04,0x21,0xCB,0x5A,0xAE,0x73,0x00,0x00,0x00,0x00,0xE3,0x18,0x92,0x94,0xC3,0x18,0xEF,0x7B,0x6D,0x6B,0x41,0x08,0x82,0x10,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x28,0x42,0xD3,0x9C,0x61,0x08,0xAA,0x52,0x14,0xA5,0x0C,0x63,0x2C,0x63,0xAE,0x73,0xF3,0x9C,0x82,0x10,0xEF,0x7B,0x6D,0x6B,0x41,0x08,0x82,0x10,0xA2,0x10,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,
-	0xE3,0x18,0xE3,0x18,0xE3,0x18,0xA2,0x10,0x71,0x8C,0x4C,0x63,0x41,0x08,0x69,0x4A,0x51,0x8C,0x8A,0x52,0xAA,0x52,0xAA,0x52,0x28,0x42,0x04,0x21,0x71,0x8C,0x4D,0x6B,0x41,0x08,0xA2,0x10,0xEF,0x7B,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x92,0x94,0x10,0x84,0x04,0x21,
-	0x20,0x00,0x61,0x08,0xA2,0x10,0x20,0x00,0x20,0x00,0x00,0x00,0xAA,0x52,0xF3,0x9C,0xB2,0x94,0xA6,0x31,0x61,0x08,0x61,0x08,0x45,0x29,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x45,0x29,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_1_59020_data_2, "face_b_w_resized_dial_img_1_59020_data_2.bin");
         
 
 
@@ -105,32 +49,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_1_59020_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_1_59020_data_2),
+    .data_size = 936,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_1_59020_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_1_59020_data_3[] = {
-	//RGB565 data 
-	0x82,0x10,0x45,0x29,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xEB,0x5A,0x2C,0x63,0xEB,0x5A,0x24,0x21,0x61,0x08,0x82,0x10,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0xCF,0x7B,0x55,0xAD,0xCF,0x7B,0xCF,0x7B,0x10,0x84,
-	0x92,0x94,0xEF,0x7B,0xCF,0x7B,0xCF,0x7B,0x55,0xAD,0x6D,0x6B,0x41,0x08,0x61,0x08,0x08,0x42,0xB2,0x94,0x92,0x94,0x92,0x94,0xF3,0x9C,0xB2,0x94,0x92,0x94,0xF3,0x9C,0x92,0x94,0x92,0x94,0xB2,0x94,0x30,0x84,0x41,0x08,0x30,0x84,0x2C,0x63,0xC3,0x18,0x65,0x29,0x8A,0x52,0xF3,0x9C,0xA6,0x31,0x65,0x29,0x61,0x08,0x8E,0x73,0xAE,0x73,
-	0x41,0x08,0x41,0x08,0x6D,0x6B,0xB2,0x94,0x86,0x31,0xC7,0x39,0x55,0xAD,0xEB,0x5A,0x28,0x42,0xF7,0xBD,0x69,0x4A,0xA6,0x31,0xAA,0x52,0xF7,0xBD,0x41,0x08,0x10,0x84,0x0C,0x63,0x69,0x4A,0x0F,0x7C,0x92,0x94,0xF7,0xBD,0x10,0x84,0x0F,0x7C,0x86,0x31,0x8E,0x73,0xAE,0x73,0x41,0x08,0x41,0x08,0x6D,0x6B,0x10,0x84,0x20,0x00,0xC3,0x18,
-	0xD3,0x9C,0x65,0x29,0xE3,0x18,0x75,0xAD,0x24,0x21,0x20,0x00,0x65,0x29,0x96,0xB5,0x41,0x08,0x10,0x84,0x4C,0x63,0xC3,0x18,0xE3,0x18,0x69,0x4A,0x14,0xA5,0x45,0x29,0x04,0x21,0xA2,0x10,0xAE,0x73,0xAE,0x73,0x41,0x08,0x41,0x08,0x6D,0x6B,0x10,0x84,0x20,0x00,0xA6,0x31,0xF3,0x9C,0xA2,0x10,0x24,0x21,0x75,0xAD,0x45,0x29,0x41,0x08,
-	0x86,0x31,0x96,0xB5,0x41,0x08,0xEF,0x7B,0x4C,0x63,0xAE,0x73,0x92,0x94,0x92,0x94,0xD3,0x9C,0x71,0x8C,0x92,0x94,0x0C,0x63,0x6D,0x6B,0xAE,0x73,0x41,0x08,0x41,0x08,0x6D,0x6B,0x10,0x84,0x00,0x00,0x2C,0x63,0x30,0x84,0x41,0x08,0x24,0x21,0x75,0xAD,0x04,0x21,0xC3,0x18,0x51,0x8C,0x96,0xB5,0x41,0x08,0x30,0x84,0xCB,0x5A,0x82,0x10,
-	0x65,0x29,0x86,0x31,0x85,0x29,0x86,0x31,0x24,0x21,0x61,0x08,0xAE,0x73,0xAE,0x73,0x41,0x08,0x41,0x08,0x6D,0x6B,0xEF,0x7B,0x86,0x31,0x55,0xAD,0xC7,0x39,0x41,0x08,0x04,0x21,0xF3,0x9C,0xEF,0x7B,0xEF,0x7B,0xF3,0x9C,0x75,0xAD,0x62,0x10,0x92,0x94,0x28,0x42,0xC7,0x39,0x14,0xA5,0xEF,0x7B,0xEF,0x7B,0x30,0x84,0xF3,0x9C,0xC3,0x18,
-	0x8E,0x73,0xAE,0x73,0x41,0x08,0x41,0x08,0x6D,0x6B,0x10,0x84,0xAE,0x73,0xAA,0x52,0x61,0x08,0x61,0x08,0x61,0x08,0x65,0x29,0xAA,0x52,0x69,0x4A,0x08,0x42,0x96,0xB5,0x24,0x21,0xF3,0x9C,0x24,0x21,0xCB,0x5A,0xEF,0x7B,0x00,0x00,0x00,0x00,0xA2,0x10,0x14,0xA5,0x04,0x21,0x8E,0x73,0xAE,0x73,0x41,0x08,0x41,0x08,0x6D,0x6B,0x0F,0x7C,
-	0x61,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x65,0x29,0x96,0xB5,0x28,0x42,0xD3,0x9C,0x61,0x08,0xAA,0x52,0x14,0xA5,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x55,0xAD,0xE3,0x18,0x8E,0x73,0xAE,0x73,0x41,0x08,0x41,0x08,0x4D,0x6B,0xB2,0x94,0x08,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0x42,
-	0x28,0x42,0x08,0x42,0xEB,0x5A,0xF7,0xBD,0x71,0x8C,0x4C,0x63,0x41,0x08,0x28,0x42,0x71,0x8C,0xAA,0x52,0xAA,0x52,0xAA,0x52,0x28,0x42,0x04,0x21,0x10,0x84,0xCF,0x7B,0x41,0x08,0x41,0x08,0x4D,0x6B,0x96,0xB5,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0xEF,0x7B,0x71,0x8C,0xF7,0xBD,0x10,0x84,0x04,0x21,
-	0x20,0x00,0x61,0x08,0xA2,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x69,0x4A,0xD3,0x9C,0xD3,0x9C,0x28,0x42,0x61,0x08,0x61,0x08,0xC7,0x39,0x69,0x4A,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0xAA,0x52,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_1_59020_data_3, "face_b_w_resized_dial_img_1_59020_data_3.bin");
         
 
 
@@ -138,32 +63,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_1_59020_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_1_59020_data_3),
+    .data_size = 936,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_1_59020_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_1_59020_data_4[] = {
-	//RGB565 data 
-	0x61,0x08,0x45,0x29,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xEB,0x5A,0x2C,0x63,0xAA,0x52,0xC3,0x18,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xCF,0x7B,0x14,0xA5,0xCF,0x7B,0xCF,0x7B,0x30,0x84,
-	0x92,0x94,0xCF,0x7B,0xCF,0x7B,0xCF,0x7B,0x96,0xB5,0x8A,0x52,0x41,0x08,0x61,0x08,0x65,0x29,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0xB2,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xAE,0x73,0xE3,0x18,0x41,0x08,0x10,0x84,0xCB,0x5A,0xE3,0x18,0x65,0x29,0x0C,0x63,0x71,0x8C,0x85,0x29,0x65,0x29,0x61,0x08,0x30,0x84,0x0C,0x63,
-	0x41,0x08,0x61,0x08,0xC3,0x18,0x28,0x42,0x28,0x42,0x28,0x42,0x51,0x8C,0xF3,0x9C,0x28,0x42,0x28,0x42,0x28,0x42,0x28,0x42,0xC7,0x39,0x82,0x10,0x41,0x08,0x10,0x84,0xCB,0x5A,0xAA,0x52,0x0F,0x7C,0xD3,0x9C,0x75,0xAD,0x0F,0x7C,0xEF,0x7B,0x04,0x21,0x30,0x84,0xEB,0x5A,0x41,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,
-	0x10,0x84,0x4D,0x6B,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x61,0x08,0x82,0x10,0x41,0x08,0x10,0x84,0xEB,0x5A,0xC3,0x18,0xE3,0x18,0xEB,0x5A,0x71,0x8C,0x04,0x21,0x04,0x21,0xA2,0x10,0x30,0x84,0xEB,0x5A,0x41,0x08,0x82,0x10,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xF3,0x9C,0xAA,0x52,0x61,0x08,0xA2,0x10,0xA2,0x10,0x82,0x10,
-	0x82,0x10,0x82,0x10,0x41,0x08,0xEF,0x7B,0x4C,0x63,0xAE,0x73,0x92,0x94,0x92,0x94,0xB2,0x94,0x71,0x8C,0x92,0x94,0x8A,0x52,0x30,0x84,0xEB,0x5A,0x41,0x08,0x61,0x08,0x82,0x10,0x0C,0x63,0xF3,0x9C,0xF3,0x9C,0xF7,0xBD,0x14,0xA5,0xD3,0x9C,0xD3,0x9C,0x14,0xA5,0x2C,0x63,0x61,0x08,0x82,0x10,0x41,0x08,0x51,0x8C,0x8A,0x52,0xA2,0x10,
-	0x65,0x29,0x86,0x31,0x85,0x29,0x85,0x29,0x04,0x21,0x81,0x08,0x51,0x8C,0xEB,0x5A,0x41,0x08,0x82,0x10,0x82,0x10,0x24,0x21,0x86,0x31,0x0C,0x63,0x55,0xAD,0xA6,0x31,0xA6,0x31,0x85,0x29,0x4C,0x63,0xB2,0x94,0xA2,0x10,0x61,0x08,0x82,0x10,0x92,0x94,0xC7,0x39,0x28,0x42,0x14,0xA5,0xEF,0x7B,0xEF,0x7B,0x51,0x8C,0x71,0x8C,0xA2,0x10,
-	0x30,0x84,0xEB,0x5A,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x20,0x00,0xEB,0x5A,0x71,0x8C,0x41,0x08,0x41,0x08,0x20,0x00,0x69,0x4A,0x92,0x94,0xA2,0x10,0x61,0x08,0x24,0x21,0xF3,0x9C,0x04,0x21,0x4C,0x63,0xAE,0x73,0x00,0x00,0x00,0x00,0x04,0x21,0xF3,0x9C,0xE3,0x18,0x30,0x84,0xEB,0x5A,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,
-	0x82,0x10,0x30,0x84,0x4C,0x63,0x41,0x08,0x82,0x10,0x41,0x08,0x69,0x4A,0x92,0x94,0xA2,0x10,0x61,0x08,0x28,0x42,0xD3,0x9C,0x61,0x08,0x2C,0x63,0xF3,0x9C,0x0C,0x63,0x2C,0x63,0xAE,0x73,0xD3,0x9C,0xA2,0x10,0x30,0x84,0x0C,0x63,0x41,0x08,0x82,0x10,0x61,0x08,0x61,0x08,0xE3,0x18,0x55,0xAD,0xC7,0x39,0x41,0x08,0x61,0x08,0x41,0x08,
-	0x69,0x4A,0x92,0x94,0x82,0x10,0x61,0x08,0x71,0x8C,0x2C,0x63,0x41,0x08,0xAA,0x52,0x30,0x84,0x8A,0x52,0xAA,0x52,0xAA,0x52,0x08,0x42,0x04,0x21,0x92,0x94,0xEB,0x5A,0x41,0x08,0x04,0x21,0xCF,0x7B,0x30,0x84,0x71,0x8C,0xF7,0xBD,0x92,0x94,0x30,0x84,0x30,0x84,0x30,0x84,0xF3,0x9C,0x96,0xB5,0x51,0x8C,0xCF,0x7B,0x10,0x84,0x24,0x21,
-	0x61,0x08,0xA2,0x10,0xC3,0x18,0x41,0x08,0x41,0x08,0x41,0x08,0x2C,0x63,0x14,0xA5,0xD3,0x9C,0x65,0x29,0x61,0x08,0xC3,0x18,0x28,0x42,0x8A,0x52,0x69,0x4A,0x28,0x42,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x69,0x4A,0x28,0x42,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_1_59020_data_4, "face_b_w_resized_dial_img_1_59020_data_4.bin");
         
 
 
@@ -171,32 +77,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_1_59020_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_1_59020_data_4),
+    .data_size = 936,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_1_59020_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_1_59020_data_5[] = {
-	//RGB565 data 
-	0x82,0x10,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0xE3,0x18,0x04,0x21,0xC3,0x18,0x61,0x08,0x82,0x10,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x65,0x29,0x24,0x21,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xAA,0x52,0xB2,0x94,0x71,0x8C,0x71,0x8C,0x71,0x8C,
-	0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0xB2,0x94,0xC7,0x39,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0xEF,0x7B,0x6D,0x6B,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x41,0x08,0x10,0x84,0x8E,0x73,0x24,0x21,0x45,0x29,0x69,0x4A,0xCF,0x7B,0x65,0x29,0x45,0x29,0x24,0x21,0x92,0x94,0x0C,0x63,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0xAE,0x73,0x4D,0x6B,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x10,0x84,0xAA,0x52,0x28,0x42,0x4D,0x6B,0x71,0x8C,0x75,0xAD,0x6D,0x6B,0x4D,0x6B,0xC3,0x18,0xEF,0x7B,0x0C,0x63,0x41,0x08,0xC3,0x18,0xCB,0x5A,0x4D,0x6B,0x4C,0x63,0x4C,0x63,
-	0x4C,0x63,0x14,0xA5,0xF3,0x9C,0x2C,0x63,0x4C,0x63,0x4C,0x63,0x4D,0x6B,0xEB,0x5A,0x41,0x08,0x10,0x84,0xEB,0x5A,0x04,0x21,0xA6,0x31,0x4D,0x6B,0xF3,0x9C,0x08,0x42,0xC7,0x39,0x82,0x10,0xEF,0x7B,0x0C,0x63,0x41,0x08,0xC3,0x18,0xAA,0x52,0x2C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0xEB,0x5A,0xEB,0x5A,0x0C,0x63,0x0C,0x63,0x0C,0x63,
-	0x0C,0x63,0xEB,0x5A,0x41,0x08,0xEF,0x7B,0x4C,0x63,0x0C,0x63,0xCF,0x7B,0x71,0x8C,0x14,0xA5,0xCF,0x7B,0xCF,0x7B,0x08,0x42,0xEF,0x7B,0x0C,0x63,0x41,0x08,0x61,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x20,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x30,0x84,0xCB,0x5A,0x45,0x29,
-	0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0xC7,0x39,0xE3,0x18,0xEF,0x7B,0x0C,0x63,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x04,0x21,0xAE,0x73,0x04,0x21,0x61,0x08,0x61,0x08,0x04,0x21,0x6D,0x6B,0xE3,0x18,0x61,0x08,0x82,0x10,0x61,0x08,0x71,0x8C,0x28,0x42,0x85,0x29,0x30,0x84,0xAE,0x73,0xAE,0x73,0xEF,0x7B,0x8E,0x73,0x61,0x08,
-	0xEF,0x7B,0x0C,0x63,0x41,0x08,0x82,0x10,0x82,0x10,0x41,0x08,0xAE,0x73,0xF3,0x9C,0xC3,0x18,0x61,0x08,0x61,0x08,0x82,0x10,0x92,0x94,0x10,0x84,0x61,0x08,0x61,0x08,0x04,0x21,0xD3,0x9C,0x24,0x21,0xCB,0x5A,0x0F,0x7C,0xA2,0x10,0xC3,0x18,0xA6,0x31,0xF3,0x9C,0xC3,0x18,0xEF,0x7B,0x0C,0x63,0x41,0x08,0x82,0x10,0x41,0x08,0x85,0x29,
-	0x96,0xB5,0x28,0x42,0x41,0x08,0x82,0x10,0x82,0x10,0x61,0x08,0x65,0x29,0x75,0xAD,0x8A,0x52,0x41,0x08,0x08,0x42,0xD3,0x9C,0x61,0x08,0xAA,0x52,0xD3,0x9C,0x8A,0x52,0xAA,0x52,0x4D,0x6B,0xF3,0x9C,0xA2,0x10,0xEF,0x7B,0x0C,0x63,0x41,0x08,0x61,0x08,0xA2,0x10,0xD3,0x9C,0x30,0x84,0x41,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,
-	0x41,0x08,0xEB,0x5A,0x55,0xAD,0x24,0x21,0x51,0x8C,0x4C,0x63,0x41,0x08,0x69,0x4A,0x71,0x8C,0xEB,0x5A,0xEB,0x5A,0x0C,0x63,0x28,0x42,0xC3,0x18,0x51,0x8C,0x0C,0x63,0x41,0x08,0x82,0x10,0xEF,0x7B,0x14,0xA5,0x04,0x21,0x61,0x08,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x61,0x08,0xA2,0x10,0xF3,0x9C,0x0F,0x7C,0x30,0x84,0x04,0x21,
-	0x20,0x00,0x82,0x10,0xA2,0x10,0x00,0x00,0x20,0x00,0x20,0x00,0xAA,0x52,0x92,0x94,0x92,0x94,0x85,0x29,0x41,0x08,0xC3,0x18,0x4C,0x63,0xA6,0x31,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0xA6,0x31,0x0C,0x63,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_1_59020_data_5, "face_b_w_resized_dial_img_1_59020_data_5.bin");
         
 
 
@@ -204,32 +91,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_1_59020_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_1_59020_data_5),
+    .data_size = 936,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_1_59020_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_1_59020_data_6[] = {
-	//RGB565 data 
-	0x82,0x10,0x04,0x21,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0x0C,0x63,0x2C,0x63,0x0C,0x63,0x08,0x42,0xA2,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x04,0x21,0xAA,0x52,0xCB,0x5A,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0x08,0x42,0x41,0x08,0x4D,0x6B,0x55,0xAD,0xCF,0x7B,0xCF,0x7B,0xEF,0x7B,
-	0x92,0x94,0x10,0x84,0xCF,0x7B,0xCF,0x7B,0x30,0x84,0x75,0xAD,0x85,0x29,0x61,0x08,0x82,0x10,0x41,0x08,0x4D,0x6B,0x96,0xB5,0xEF,0x7B,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0xEF,0x7B,0x92,0x94,0xF7,0xBD,0x41,0x08,0xAE,0x73,0x8E,0x73,0x81,0x08,0x65,0x29,0xC7,0x39,0x14,0xA5,0x28,0x42,0x65,0x29,0x04,0x21,0xE3,0x18,0x75,0xAD,
-	0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,0xCF,0x7B,0x10,0x84,0x41,0x08,0x41,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x20,0x00,0xA6,0x31,0xF7,0xBD,0x41,0x08,0xAE,0x73,0x8E,0x73,0xC7,0x39,0x0F,0x7C,0x30,0x84,0xF7,0xBD,0x71,0x8C,0x0F,0x7C,0x0C,0x63,0xE3,0x18,0x55,0xAD,0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,0xAE,0x73,0x10,0x84,
-	0x41,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x41,0x08,0xA6,0x31,0xF7,0xBD,0x41,0x08,0xAE,0x73,0xAE,0x73,0xA2,0x10,0xE3,0x18,0x85,0x29,0x96,0xB5,0x08,0x42,0xE3,0x18,0xE3,0x18,0x04,0x21,0x55,0xAD,0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,0xAE,0x73,0x30,0x84,0x82,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x82,0x10,
-	0xC7,0x39,0xF7,0xBD,0x41,0x08,0xAE,0x73,0x6D,0x6B,0x4D,0x6B,0x92,0x94,0x71,0x8C,0xD3,0x9C,0x92,0x94,0x71,0x8C,0x30,0x84,0x08,0x42,0x55,0xAD,0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,0x8E,0x73,0xF7,0xBD,0xD3,0x9C,0xD3,0x9C,0xD3,0x9C,0xD3,0x9C,0xD3,0x9C,0xB2,0x94,0x14,0xA5,0xF7,0xBD,0x41,0x08,0xEF,0x7B,0x2C,0x63,0x61,0x08,
-	0x45,0x29,0x86,0x31,0x85,0x29,0x86,0x31,0x65,0x29,0xC3,0x18,0x04,0x21,0x75,0xAD,0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,0xAE,0x73,0x92,0x94,0x86,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0xA6,0x31,0x86,0x31,0xAA,0x52,0xF7,0xBD,0x41,0x08,0x71,0x8C,0xAA,0x52,0x04,0x21,0x14,0xA5,0x10,0x84,0xEF,0x7B,0xEF,0x7B,0x14,0xA5,0xAA,0x52,
-	0xE3,0x18,0x75,0xAD,0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,0xAE,0x73,0x0F,0x7C,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x86,0x31,0xF7,0xBD,0xE3,0x18,0xF3,0x9C,0xA6,0x31,0xA6,0x31,0xB2,0x94,0x81,0x08,0x20,0x00,0x00,0x00,0xAE,0x73,0xCF,0x7B,0xE3,0x18,0x75,0xAD,0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,
-	0xAE,0x73,0x0F,0x7C,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x86,0x31,0xF7,0xBD,0x08,0x42,0x14,0xA5,0xA2,0x10,0xA6,0x31,0x96,0xB5,0x4D,0x6B,0x2C,0x63,0x0C,0x63,0xF3,0x9C,0x2C,0x63,0xC3,0x18,0x75,0xAD,0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,0xAE,0x73,0xF3,0x9C,0x8A,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,
-	0xAA,0x52,0x8A,0x52,0x4D,0x6B,0xF7,0xBD,0x71,0x8C,0x8E,0x73,0x41,0x08,0x65,0x29,0xB2,0x94,0xCB,0x5A,0xAA,0x52,0xAA,0x52,0xAA,0x52,0x85,0x29,0xA6,0x31,0x75,0xAD,0xA6,0x31,0x41,0x08,0x82,0x10,0x41,0x08,0xAE,0x73,0xF7,0xBD,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0x92,0x94,0xF3,0x9C,0xF7,0xBD,0x71,0x8C,0x65,0x29,
-	0x41,0x08,0xA2,0x10,0xE3,0x18,0x61,0x08,0x41,0x08,0x41,0x08,0x45,0x29,0xF3,0x9C,0x55,0xAD,0x30,0x84,0xE3,0x18,0x61,0x08,0x82,0x10,0x61,0x08,0xC7,0x39,0x08,0x42,0x20,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0xC3,0x18,0xAA,0x52,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_1_59020_data_6, "face_b_w_resized_dial_img_1_59020_data_6.bin");
         
 
 
@@ -237,7 +105,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_1_59020_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_1_59020_data_6),
+    .data_size = 936,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_1_59020_data_6};
 
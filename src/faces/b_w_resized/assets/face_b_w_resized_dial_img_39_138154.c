@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,28 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_39_138154_data_0[] = {
-	//RGB565 data 
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x79,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x79,0xCE,0x59,0xCE,0x7A,0xD6,0x18,0xC6,0xF7,0xBD,0x7A,0xD6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x59,0xCE,0x54,0xA5,0x99,0xCE,0xBA,0xD6,0xD7,0xBD,0x96,0xB5,0x9A,0xD6,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x79,0xCE,0x9A,0xD6,0x9A,0xD6,0xBA,0xD6,0xD7,0xBD,0x30,0x84,0x0C,0x63,0x0C,0x63,0x92,0x94,0x9A,0xD6,0xBB,0xDE,0xBA,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x39,0xCE,0x9A,0xD6,0x38,0xC6,0x69,0x4A,0x81,0x08,
-	0x40,0x00,0x61,0x08,0xA2,0x10,0x0C,0x63,0x59,0xCE,0x96,0xB5,0x7A,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBB,0xDE,0x55,0xAD,0xF7,0xBD,0x8E,0x73,0x40,0x00,0xA1,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0x81,0x08,0x50,0x84,0x38,0xC6,0xFB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0x79,0xCE,0xC6,0x31,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0xCA,0x52,0x30,0x84,0x38,0xC6,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0x79,0xCE,0x65,0x29,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x61,0x08,0x61,0x08,0xE7,0x39,0x18,0xC6,0xDB,0xDE,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFB,0xDE,0x69,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x40,0x00,0x0C,0x63,0xFB,0xDE,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0x99,0xCE,0x34,0xA5,0x54,0xA5,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0x61,0x08,0xC6,0x31,0xDA,0xD6,0xFB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xC6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x03,0x19,0x50,0x84,0xDB,0xDE,0xDA,0xD6,0xBA,0xD6,0xFB,0xDE,0x54,0xA5,0x03,0x19,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x82,0x10,0x92,0x94,0x1C,0xE7,0xBA,0xD6,0xFB,0xDE,0x8E,0x73,0x40,0x00,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x40,0x00,0x69,0x4A,0x1C,0xE7,0xBA,0xD6,0xFB,0xDE,0x50,0x84,0x61,0x08,
-	0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x40,0x00,0x0C,0x63,0xFB,0xDE,0xBA,0xD6,0xDB,0xDE,0x59,0xCE,0x69,0x4A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x08,0x82,0x10,0xE7,0x39,0xD7,0xBD,0xDB,0xDE,
-	0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0x9A,0xD6,0x96,0xB5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x55,0xAD,0x7A,0xD6,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_39_138154_data_0, "face_b_w_resized_dial_img_39_138154_data_0.bin");
         
 
 
@@ -41,7 +21,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_39_138154_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 18,
     .header.h = 18,
-    .data_size = sizeof(face_b_w_resized_dial_img_39_138154_data_0),
+    .data_size = 972,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_39_138154_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,16 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x86,0x31,0x69,0x4A,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x4D,0x6B,0x00,0x00,0x08,0x42,0x38,0xC6,0x4D,0x6B,0xA2,0x10,0x4D,0x6B,0x38,0xC6,0x08,0x42,0x51,0x8C,0x96,0xB5,0x20,0x00,0x00,0x00,0x20,0x00,0xB6,0xB5,0x30,0x84,0x96,0xB5,0x71,0x8C,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x92,0x94,0x96,0xB5,0x38,0xC6,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0x38,0xC6,0x79,0xCE,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0x79,0xCE,0xF7,0xBD,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xF7,0xBD,0x34,0xA5,0xF3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x14,0xA5,0x6D,0x6B,
-	0x18,0xC6,0x04,0x21,0x00,0x00,0x04,0x21,0x18,0xC6,0x6D,0x6B,0x24,0x21,0x96,0xB5,0x14,0xA5,0x8A,0x52,0x14,0xA5,0x96,0xB5,0x04,0x21,0x00,0x00,0x86,0x31,0xD3,0x9C,0xD7,0xBD,0x92,0x94,0x65,0x29,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_0, asset_pool_8c478f43439b5edd);
         
 
 
@@ -29,22 +21,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_0),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x41,0x08,0x08,0x42,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0x55,0xAD,0x38,0xC6,0xD3,0x9C,0x41,0x08,0x00,0x00,0x00,0x00,0xAA,0x52,0x0F,0x7C,0xF7,0xBD,0x14,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0x14,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x55,0xAD,
-	0x14,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x55,0xAD,0x14,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x55,0xAD,0x14,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x55,0xAD,0x14,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x55,0xAD,0x14,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x55,0xAD,0x14,0xA5,0x20,0x00,0x00,0x00,0x82,0x10,0x8A,0x52,0x2C,0x63,0xD7,0xBD,0xB6,0xB5,0x2C,0x63,0x49,0x4A,0x45,0x29,0x96,0xB5,0xF7,0xBD,0xB6,0xB5,0xD7,0xBD,0x38,0xC6,0x55,0xAD,
-
-	// Alpha Channel 
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_1, asset_pool_6d7c5c89de7be847);
         
 
 
@@ -52,22 +35,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_1),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0xC3,0x18,0x49,0x4A,0x8A,0x52,0x86,0x31,0x20,0x00,0x20,0x00,0x08,0x42,0x55,0xAD,0xD7,0xBD,0x18,0xC6,0xD7,0xBD,0xEB,0x5A,0x00,0x00,0xEF,0x7B,0x0F,0x7C,0x45,0x29,0x45,0x29,0xB2,0x94,0x18,0xC6,0x65,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x59,0xCE,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x86,0x31,0x38,0xC6,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x18,0xC6,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x96,0xB5,0x92,0x94,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x7C,0x38,0xC6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x59,0xCE,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xEB,0x5A,0x59,0xCE,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x38,0xC6,0x96,0xB5,0x0C,0x63,0x0C,0x63,0x2C,0x63,0x69,0x4A,0x75,0xAD,0xF7,0xBD,0xB6,0xB5,0xD7,0xBD,0xF7,0xBD,0x38,0xC6,0x34,0xA5,
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_2, asset_pool_2bac83d071d22659);
         
 
 
@@ -75,22 +49,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_2),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_3[] = {
-	//RGB565 data 
-	0x20,0x00,0xC3,0x18,0x49,0x4A,0x8A,0x52,0xA6,0x31,0x61,0x08,0x20,0x00,0xE7,0x39,0x34,0xA5,0xB6,0xB5,0xD7,0xBD,0xF7,0xBD,0x0F,0x7C,0x82,0x10,0x49,0x4A,0xAE,0x73,0x45,0x29,0xA2,0x10,0xAE,0x73,0x79,0xCE,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x18,0xC6,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xAA,0x52,0x79,0xCE,0x8A,0x52,0x00,0x00,0x20,0x00,0x8A,0x52,0x71,0x8C,0xF7,0xBD,0x4D,0x6B,0x20,0x00,0x00,0x00,0x41,0x08,0xEF,0x7B,0xB6,0xB5,0x18,0xC6,0x4D,0x6B,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x49,0x4A,0x38,0xC6,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD3,0x9C,0x18,0xC6,0x65,0x29,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x41,0x08,0x55,0xAD,0xD7,0xBD,0x75,0xAD,0x75,0xAD,0x2C,0x63,0xEB,0x5A,0xD3,0x9C,0x59,0xCE,0x0C,0x63,0x65,0x29,0x0F,0x7C,0xB6,0xB5,0xD7,0xBD,0xB2,0x94,0x49,0x4A,0x20,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_3, asset_pool_802c8ffc22ac75c6);
         
 
 
@@ -98,22 +63,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_3),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x41,0x08,0x82,0x10,0x28,0x42,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0x79,0xCE,0x51,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x96,0xB5,0xF7,0xBD,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0x14,0xA5,0x71,0x8C,0xB2,0x94,0x00,0x00,0x00,0x00,0x65,0x29,0x38,0xC6,0x28,0x42,
-	0x30,0x84,0xD3,0x9C,0x00,0x00,0x20,0x00,0x71,0x8C,0x71,0x8C,0x41,0x08,0x51,0x8C,0xD3,0x9C,0x00,0x00,0x28,0x42,0xB6,0xB5,0x04,0x21,0x00,0x00,0x30,0x84,0xB2,0x94,0x00,0x00,0x34,0xA5,0x75,0xAD,0xAA,0x52,0xAA,0x52,0x34,0xA5,0x75,0xAD,0x49,0x4A,0x14,0xA5,0x75,0xAD,0x96,0xB5,0xB6,0xB5,0x18,0xC6,0x38,0xC6,0xF3,0x9C,0x00,0x00,
-	0x41,0x08,0x20,0x00,0x41,0x08,0x71,0x8C,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0x6D,0x6B,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_4, asset_pool_508866d554060b89);
         
 
 
@@ -121,22 +77,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_4),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0xA6,0x31,0x49,0x4A,0x49,0x4A,0x69,0x4A,0x69,0x4A,0xA2,0x10,0x04,0x21,0x96,0xB5,0x79,0xCE,0x18,0xC6,0x18,0xC6,0x38,0xC6,0x49,0x4A,0x86,0x31,0xF7,0xBD,0x6D,0x6B,0x24,0x21,0x24,0x21,0x04,0x21,0x41,0x08,0xA6,0x31,0xF7,0xBD,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x18,0xC6,0x0C,0x63,0x8A,0x52,
-	0xE7,0x39,0x41,0x08,0x00,0x00,0x08,0x42,0x38,0xC6,0x34,0xA5,0x14,0xA5,0x18,0xC6,0xF3,0x9C,0x24,0x21,0x61,0x08,0xA6,0x31,0xC3,0x18,0x82,0x10,0x8A,0x52,0x59,0xCE,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF3,0x9C,0x18,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x38,0xC6,0x65,0x29,
-	0x61,0x08,0x00,0x00,0x00,0x00,0xE3,0x18,0xF7,0xBD,0xD3,0x9C,0x55,0xAD,0x75,0xAD,0x2C,0x63,0x0C,0x63,0x75,0xAD,0x18,0xC6,0xE7,0x39,0x45,0x29,0xEF,0x7B,0x96,0xB5,0xB6,0xB5,0x92,0x94,0xA6,0x31,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_5, asset_pool_4be293a09c0f42f8);
         
 
 
@@ -144,22 +91,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_5),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0xE3,0x18,0x49,0x4A,0x49,0x4A,0xC3,0x18,0x00,0x00,0x00,0x00,0xA6,0x31,0x75,0xAD,0xF7,0xBD,0xD7,0xBD,0xB6,0xB5,0x28,0x42,0x04,0x21,0xB6,0xB5,0x34,0xA5,0xA6,0x31,0xE3,0x18,0xEB,0x5A,0x65,0x29,0x6D,0x6B,0x18,0xC6,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xD3,0x9C,0x00,0x00,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0xF7,0xBD,0x30,0x84,0x6D,0x6B,0xB6,0xB5,0xF7,0xBD,0xAE,0x73,0x82,0x10,0x38,0xC6,0xD7,0xBD,0xCF,0x7B,0xE7,0x39,0x0C,0x63,0x38,0xC6,0xAE,0x73,0x18,0xC6,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xF7,0xBD,0x34,0xA5,0xD3,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0x59,0xCE,0x4D,0x6B,
-	0xF7,0xBD,0x04,0x21,0x00,0x00,0x00,0x00,0xD3,0x9C,0x75,0xAD,0xE3,0x18,0x55,0xAD,0x34,0xA5,0x69,0x4A,0xCF,0x7B,0x38,0xC6,0xAA,0x52,0x00,0x00,0xE3,0x18,0x30,0x84,0xB6,0xB5,0x55,0xAD,0x49,0x4A,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_6, asset_pool_61e50feaa50b9f2d);
         
 
 
@@ -167,22 +105,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_6),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_7[] = {
-	//RGB565 data 
-	0xE7,0x39,0x49,0x4A,0x69,0x4A,0x8A,0x52,0x8A,0x52,0x28,0x42,0x08,0x42,0x75,0xAD,0x38,0xC6,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x79,0xCE,0xD7,0xBD,0xC3,0x18,0x45,0x29,0x24,0x21,0x24,0x21,0x69,0x4A,0x18,0xC6,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xD3,0x9C,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,
-	0x38,0xC6,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0x14,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xD7,0xBD,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x18,0xC6,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x63,0xF7,0xBD,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x30,0x84,0xB6,0xB5,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xB2,0x94,0x96,0xB5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_7, asset_pool_c33a1d0b0935fa86);
         
 
 
@@ -190,22 +119,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_7),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0xA6,0x31,0x49,0x4A,0xA6,0x31,0x00,0x00,0x00,0x00,0x20,0x00,0xAE,0x73,0xD7,0xBD,0x96,0xB5,0xD7,0xBD,0xEF,0x7B,0x41,0x08,0x28,0x42,0x38,0xC6,0x8A,0x52,0x00,0x00,0xE7,0x39,0x38,0xC6,0x8A,0x52,0x2C,0x63,0xF7,0xBD,0x61,0x08,0x00,0x00,0x00,0x00,0x75,0xAD,0xAE,0x73,0x28,0x42,0x38,0xC6,0x8A,0x52,0x00,0x00,
-	0x82,0x10,0xD7,0xBD,0x8A,0x52,0x00,0x00,0xAE,0x73,0x59,0xCE,0xEF,0x7B,0x30,0x84,0x30,0x84,0x61,0x08,0x41,0x08,0xAE,0x73,0x14,0xA5,0x75,0xAD,0x79,0xCE,0xCF,0x7B,0x20,0x00,0x6D,0x6B,0x75,0xAD,0x82,0x10,0x61,0x08,0x2C,0x63,0x38,0xC6,0x4D,0x6B,0xF7,0xBD,0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xD7,0xBD,0x38,0xC6,
-	0x0F,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xF7,0xBD,0x6D,0x6B,0x38,0xC6,0x6D,0x6B,0xA6,0x31,0x2C,0x63,0x38,0xC6,0x6D,0x6B,0x41,0x08,0xAA,0x52,0xF3,0x9C,0xB6,0xB5,0x14,0xA5,0xEB,0x5A,0x41,0x08,
-
-	// Alpha Channel 
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_8, asset_pool_aaa3cca6df4ae6ee);
         
 
 
@@ -213,22 +133,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_8),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_3_64162_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x20,0x00,0x28,0x42,0x8A,0x52,0x45,0x29,0x00,0x00,0x00,0x00,0xC3,0x18,0x71,0x8C,0x18,0xC6,0xD7,0xBD,0xB6,0xB5,0xAA,0x52,0x00,0x00,0xEF,0x7B,0x38,0xC6,0xE7,0x39,0xA2,0x10,0xAE,0x73,0x18,0xC6,0xE7,0x39,0xF7,0xBD,0x30,0x84,0x00,0x00,0x00,0x00,0x41,0x08,0x96,0xB5,0x30,0x84,0x59,0xCE,0xCF,0x7B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x30,0x84,0xB6,0xB5,0x55,0xAD,0x34,0xA5,0x41,0x08,0x00,0x00,0xC3,0x18,0x34,0xA5,0x38,0xC6,0x69,0x4A,0x18,0xC6,0x14,0xA5,0x30,0x84,0xF3,0x9C,0x55,0xAD,0x38,0xC6,0x00,0x00,0xA6,0x31,0xEF,0x7B,0xEF,0x7B,0x65,0x29,0xEF,0x7B,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0x71,0x8C,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x4A,0x38,0xC6,0x69,0x4A,0x8A,0x52,0xF3,0x9C,0xEB,0x5A,0x6D,0x6B,0x18,0xC6,0x51,0x8C,0x41,0x08,0x24,0x21,0x51,0x8C,0x18,0xC6,0xF7,0xBD,0xEF,0x7B,0x82,0x10,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    };
+ASSET_POOL(face_b_w_resized_dial_img_3_64162_data_9, asset_pool_32e256f9e1f261c2);
         
 
 
@@ -236,7 +147,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_3_64162_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 12,
-    .data_size = sizeof(face_b_w_resized_dial_img_3_64162_data_9),
+    .data_size = 252,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_3_64162_data_9};
 
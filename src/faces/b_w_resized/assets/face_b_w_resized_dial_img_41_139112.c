@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,28 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_41_139112_data_0[] = {
-	//RGB565 data 
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x79,0xCE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x7A,0xD6,0x59,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x7A,0xD6,0x9A,0xD6,0x9A,0xD6,0x39,0xCE,0xB2,0x94,0x10,0x84,0x71,0x8C,0xF8,0xC5,0xBA,0xD6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x9A,0xD6,0x18,0xC6,0xB6,0xB5,0x34,0xA5,0x08,0x42,0xA2,0x10,
-	0x61,0x08,0x81,0x08,0x65,0x29,0x34,0xA5,0xBB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x79,0xCE,0x79,0xCE,0x9A,0xD6,0xBA,0xD6,0x34,0xA5,0x65,0x29,0x81,0x08,0xC2,0x10,0x61,0x08,0x81,0x08,0xA2,0x10,0x81,0x08,0x61,0x08,0x03,0x19,0xD7,0xBD,0xBB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xBB,0xDE,0x39,0xCE,0x65,0x29,0x61,0x08,
-	0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xCF,0x7B,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x9A,0xD6,0xBB,0xDE,0xBB,0xDE,0xB2,0x94,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x8A,0x52,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xDB,0xDE,0x38,0xC6,
-	0x8A,0x52,0xC2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x8A,0x52,0x58,0xC6,0xDB,0xDE,0xFB,0xDE,0x8D,0x6B,0x60,0x00,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x40,0x00,
-	0x8D,0x6B,0xFB,0xDE,0xFB,0xDE,0x69,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0x69,0x4A,0xFB,0xDE,0xFB,0xDE,0xCF,0x7B,0x61,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x81,0x08,0x40,0x00,0xCF,0x7B,0x1C,0xE7,0xDB,0xDE,0x79,0xCE,0xEB,0x5A,0x03,0x19,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0x03,0x19,0xEB,0x5A,0x79,0xCE,0xDB,0xDE,0xBA,0xD6,0xDB,0xDE,0xBA,0xD6,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x34,0xA5,0x95,0xAD,
-	0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xF8,0xC5,0xDB,0xDE,0xFB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0xDB,0xDE,0xFB,0xDE,0x79,0xCE,0x8A,0x52,0x71,0x8C,0x1C,0xE7,0xFB,0xDE,0x9A,0xD6,0xF8,0xC5,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xDB,0xDE,0x59,0xCE,0x8D,0x6B,0xB2,0x94,0xDB,0xDE,0xDB,0xDE,0xCF,0x7B,0x08,0x42,0x18,0xC6,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0xBA,0xD6,0xDA,0xD6,0xBA,0xD6,0xDB,0xDE,0x95,0xAD,0x71,0x8C,0x79,0xCE,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_41_139112_data_0, "face_b_w_resized_dial_img_41_139112_data_0.bin");
         
 
 
@@ -41,7 +21,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_41_139112_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 18,
     .header.h = 18,
-    .data_size = sizeof(face_b_w_resized_dial_img_41_139112_data_0),
+    .data_size = 972,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_41_139112_data_0};
 
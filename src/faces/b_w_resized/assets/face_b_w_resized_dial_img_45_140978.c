@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,28 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_45_140978_data_0[] = {
-	//RGB565 data 
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x79,0xCE,0x7A,0xD6,0x9A,0xD6,0x9A,0xD6,0x7A,0xD6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x9A,0xD6,0x7A,0xD6,0x9A,0xD6,0xD7,0xBD,0x8A,0x52,0x8A,0x52,
-	0x96,0xB5,0x9A,0xD6,0x99,0xCE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x79,0xCE,0x79,0xCE,0x9A,0xD6,0x9A,0xD6,0x55,0xAD,0x71,0x8C,0xFB,0xDE,0x6E,0x73,0x40,0x00,0x40,0x00,0xCB,0x5A,0xBB,0xDE,0x9A,0xD6,0xBB,0xDE,0xDB,0xDE,0xBB,0xDE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xBA,0xD6,0xDB,0xDE,0x13,0x9D,0x2C,0x63,0xD7,0xBD,
-	0x55,0xAD,0x85,0x29,0x40,0x00,0x61,0x08,0xAE,0x73,0xBB,0xDE,0xBB,0xDE,0x18,0xC6,0x55,0xAD,0xD7,0xBD,0xBB,0xDE,0xBA,0xD6,0xBB,0xDE,0x18,0xC6,0x30,0x84,0xD7,0xBD,0xD7,0xBD,0x6D,0x6B,0x03,0x19,0x45,0x29,0xAA,0x52,0x30,0x84,0x79,0xCE,0xFB,0xDE,0x18,0xC6,0xE7,0x39,0x61,0x08,0x44,0x21,0x55,0xAD,0xDB,0xDE,0xDA,0xD6,0x59,0xCE,
-	0xD6,0xB5,0xF7,0xBD,0xCF,0x7B,0x30,0x84,0xB6,0xB5,0x99,0xCE,0xFB,0xDE,0x3C,0xE7,0x9A,0xD6,0x18,0xC6,0x6D,0x6B,0x61,0x08,0xA2,0x10,0x40,0x00,0x8A,0x52,0xFB,0xDE,0xBA,0xD6,0xDB,0xDE,0xFB,0xDE,0x7A,0xD6,0xBA,0xD6,0x9A,0xD6,0x18,0xC6,0x13,0x9D,0x0F,0x7C,0xCB,0x5A,0xE7,0x39,0x45,0x29,0xA2,0x10,0x61,0x08,0x61,0x08,0x40,0x00,
-	0x2C,0x63,0xFB,0xDE,0xDA,0xD6,0x79,0xCE,0xD6,0xB5,0x13,0x9D,0xAE,0x73,0x8A,0x52,0xE7,0x39,0xA6,0x31,0x85,0x29,0x45,0x29,0x45,0x29,0x65,0x29,0x85,0x29,0x85,0x29,0xA6,0x31,0xAA,0x52,0x18,0xC6,0xDB,0xDE,0xDA,0xD6,0x99,0xCE,0xF7,0xBD,0xD6,0xB5,0xD7,0xBD,0x18,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x59,0xCE,0x59,0xCE,
-	0x59,0xCE,0x18,0xC6,0x38,0xC6,0xDB,0xDE,0xFB,0xDE,0xDB,0xDE,0xBA,0xD6,0xDA,0xD6,0xFB,0xDE,0xFB,0xDE,0x79,0xCE,0x54,0xA5,0x13,0x9D,0x34,0xA5,0x34,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x75,0xAD,0xBB,0xDE,0xFB,0xDE,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0xB6,0xB5,0x75,0xAD,0x18,0xC6,0xB6,0xB5,0xCF,0x7B,0x48,0x42,
-	0x44,0x21,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x03,0x19,0x6D,0x6B,0xBB,0xDE,0xFB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xDB,0xDE,0x96,0xB5,0xAE,0x73,0x6E,0x73,0x71,0x8C,0xDB,0xDE,0x9A,0xD6,0x75,0xAD,0x0F,0x7C,0x45,0x29,0x61,0x08,0x61,0x08,0xC3,0x18,0x18,0xC6,0xFB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,
-	0x38,0xC6,0xD7,0xBD,0xBA,0xD6,0x71,0x8C,0x55,0xAD,0x3C,0xE7,0x30,0x84,0x61,0x08,0x40,0x00,0x48,0x42,0x79,0xCE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0x79,0xCE,0x58,0xC6,0xDB,0xDE,0x9A,0xD6,0x71,0x8C,0xCF,0x7B,0xD7,0xBD,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0xDB,0xDE,0xBA,0xD6,0xDA,0xD6,0xFB,0xDE,0xFB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_45_140978_data_0, "face_b_w_resized_dial_img_45_140978_data_0.bin");
         
 
 
@@ -41,7 +21,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_45_140978_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 18,
     .header.h = 18,
-    .data_size = sizeof(face_b_w_resized_dial_img_45_140978_data_0),
+    .data_size = 972,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_45_140978_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,13 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_7_65174_data_0[] = {
-	//RGB565 data 
-	0xD7,0xBD,0xD7,0xBD,0xD7,0xBD,0xD7,0xBD,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_7_65174_data_0, "face_b_w_resized_dial_img_7_65174_data_0.bin");
         
 
 
@@ -26,7 +21,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_7_65174_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 4,
     .header.h = 1,
-    .data_size = sizeof(face_b_w_resized_dial_img_7_65174_data_0),
+    .data_size = 12,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_7_65174_data_0};
 
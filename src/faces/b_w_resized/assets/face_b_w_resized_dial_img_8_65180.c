@@ -5,6 +5,7 @@
 // Watchface: B_W_RESIZED
 
 #include "../b_w_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,14 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_0[] = {
-	//RGB565 data 
-	0xFC,0xE6,0xB6,0xB5,0x71,0x8C,0xB6,0xB5,0xFC,0xE6,0x55,0xAD,0x28,0x42,0x2C,0x63,0x28,0x42,0x55,0xAD,0x69,0x4A,0x71,0x8C,0x5D,0xEF,0x71,0x8C,0x69,0x4A,0xA6,0x31,0xD7,0xBD,0x3D,0xEF,0xD7,0xBD,0xA6,0x31,0x65,0x29,0x18,0xC6,0x1C,0xE7,0xF8,0xC5,0x65,0x29,0x86,0x31,0xF8,0xC5,0x3C,0xE7,0xF8,0xC5,0x86,0x31,0xA6,0x31,0x96,0xB5,
-	0x5D,0xEF,0x96,0xB5,0xA6,0x31,0x4C,0x63,0x4D,0x6B,0x9A,0xD6,0x4D,0x6B,0x4C,0x63,0x59,0xCE,0xEB,0x5A,0x69,0x4A,0xEB,0x5A,0x59,0xCE,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_0, "face_b_w_resized_dial_img_8_65180_data_0.bin");
         
 
 
@@ -27,20 +21,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_0),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_1[] = {
-	//RGB565 data 
-	0xFC,0xE6,0x9A,0xD6,0xD3,0x9C,0xB6,0xB5,0x1C,0xE7,0xFC,0xE6,0x55,0xAD,0x65,0x29,0x8E,0x73,0x1C,0xE7,0xDB,0xDE,0xFC,0xE6,0xB2,0x94,0xAE,0x73,0x1C,0xE7,0xDB,0xDE,0x1C,0xE7,0xD3,0x9C,0xAE,0x73,0x1C,0xE7,0xDB,0xDE,0x1C,0xE7,0xD3,0x9C,0xAE,0x73,0x1C,0xE7,0xDB,0xDE,0x1C,0xE7,0xD3,0x9C,0xAE,0x73,0x1C,0xE7,0xDB,0xDE,0x1C,0xE7,
-	0xD3,0x9C,0xCE,0x73,0x1C,0xE7,0xFB,0xDE,0xBB,0xDE,0x51,0x8C,0x6D,0x6B,0x9A,0xD6,0x1C,0xE7,0x30,0x84,0x49,0x4A,0x08,0x42,0x8E,0x73,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_1, "face_b_w_resized_dial_img_8_65180_data_1.bin");
         
 
 
@@ -48,20 +35,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_1),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_2[] = {
-	//RGB565 data 
-	0xBB,0xDE,0xD3,0x9C,0x10,0x84,0x75,0xAD,0x9A,0xD6,0x6D,0x6B,0x0C,0x63,0x6D,0x6B,0x08,0x42,0x96,0xB5,0xF8,0xC5,0xDB,0xDE,0x3C,0xE7,0xAE,0x73,0x2C,0x63,0xFC,0xE6,0xFB,0xDE,0x1C,0xE7,0xEF,0x7B,0x4C,0x63,0xDB,0xDE,0xFB,0xDE,0xDB,0xDE,0x49,0x4A,0xD3,0x9C,0xDB,0xDE,0x1C,0xE7,0x30,0x84,0xAA,0x52,0xBB,0xDE,0x1C,0xE7,0x34,0xA5,
-	0x08,0x42,0x18,0xC6,0x1C,0xE7,0x34,0xA5,0xC6,0x31,0x92,0x94,0x38,0xC6,0x38,0xC6,0x08,0x42,0xC7,0x39,0xEB,0x5A,0x69,0x4A,0xAA,0x52,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_2, "face_b_w_resized_dial_img_8_65180_data_2.bin");
         
 
 
@@ -69,20 +49,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_2),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_3[] = {
-	//RGB565 data 
-	0x7A,0xD6,0x14,0xA5,0x30,0x84,0x55,0xAD,0x9A,0xD6,0x10,0x84,0xEB,0x5A,0xAE,0x73,0x08,0x42,0xB2,0x94,0x7A,0xD6,0xBB,0xDE,0x5D,0xEF,0x51,0x8C,0x49,0x4A,0xFB,0xDE,0xDB,0xDE,0x9A,0xD6,0x2C,0x63,0x6D,0x6B,0x1C,0xE7,0x14,0xA5,0x86,0x31,0x08,0x42,0x59,0xCE,0xFB,0xDE,0x7A,0xD6,0x96,0xB5,0x2C,0x63,0x4D,0x6B,0xFC,0xE6,0x1C,0xE7,
-	0x5D,0xEF,0xD7,0xBD,0x24,0x21,0x10,0x84,0xB6,0xB5,0x7A,0xD6,0x10,0x84,0xC7,0x39,0xEF,0x7B,0x8A,0x52,0x69,0x4A,0xAA,0x52,0x96,0xB5,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_3, "face_b_w_resized_dial_img_8_65180_data_3.bin");
         
 
 
@@ -90,20 +63,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_3),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_4[] = {
-	//RGB565 data 
-	0xFC,0xE6,0x9A,0xD6,0x38,0xC6,0x34,0xA5,0xDB,0xDE,0xFB,0xDE,0x1C,0xE7,0x10,0x84,0x65,0x29,0xD7,0xBD,0x1C,0xE7,0xF8,0xC5,0x89,0x4A,0x28,0x42,0xB6,0xB5,0xFC,0xE6,0x4D,0x6B,0x71,0x8C,0xCB,0x5A,0x96,0xB5,0x55,0xAD,0xEB,0x5A,0xFC,0xE6,0xAA,0x52,0xB6,0xB5,0x49,0x4A,0x10,0x84,0xB6,0xB5,0x28,0x42,0x92,0x94,0x0C,0x63,0xEB,0x5A,
-	0xEB,0x5A,0x65,0x29,0xEB,0x5A,0xDB,0xDE,0xDB,0xDE,0xBB,0xDE,0x89,0x4A,0x96,0xB5,0xFC,0xE6,0x3C,0xE7,0x1C,0xE7,0x8E,0x73,0x18,0xC6,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_4, "face_b_w_resized_dial_img_8_65180_data_4.bin");
         
 
 
@@ -111,20 +77,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_4),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_5[] = {
-	//RGB565 data 
-	0x7A,0xD6,0xD3,0x9C,0x71,0x8C,0x51,0x8C,0x96,0xB5,0xB2,0x94,0xA6,0x31,0x4D,0x6B,0x2C,0x63,0x14,0xA5,0x10,0x84,0x6D,0x6B,0x5D,0xEF,0x1C,0xE7,0xFC,0xE6,0xAE,0x73,0xAA,0x52,0x71,0x8C,0x35,0xAD,0xDB,0xDE,0xD3,0x9C,0x4D,0x6B,0x30,0x84,0x07,0x3A,0xAE,0x73,0xDB,0xDE,0xFC,0xE6,0x5D,0xEF,0x75,0xAD,0x65,0x29,0x1C,0xE7,0x1C,0xE7,
-	0x1C,0xE7,0xF8,0xC5,0x65,0x29,0x30,0x84,0xD7,0xBD,0x59,0xCE,0x6D,0x6B,0x69,0x4A,0xEF,0x7B,0x8A,0x52,0x69,0x4A,0xCB,0x5A,0x18,0xC6,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_5, "face_b_w_resized_dial_img_8_65180_data_5.bin");
         
 
 
@@ -132,20 +91,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_5),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_6[] = {
-	//RGB565 data 
-	0x3C,0xE7,0x18,0xC6,0x51,0x8C,0xD3,0x9C,0x7A,0xD6,0x18,0xC6,0x89,0x4A,0xEB,0x5A,0x0C,0x63,0x10,0x84,0x2C,0x63,0xAE,0x73,0x3D,0xEF,0x1C,0xE7,0xDB,0xDE,0xE7,0x39,0x96,0xB5,0xF8,0xC5,0x18,0xC6,0xFC,0xE6,0x65,0x29,0x2C,0x63,0xEB,0x5A,0x28,0x42,0x92,0x94,0x24,0x21,0x34,0xA5,0x1C,0xE7,0x55,0xAD,0xC6,0x31,0xE7,0x39,0xD7,0xBD,
-	0x5D,0xEF,0x38,0xC6,0xA6,0x31,0x6D,0x6B,0x4D,0x6B,0x9A,0xD6,0x92,0x94,0x49,0x4A,0xBB,0xDE,0x6D,0x6B,0xAA,0x52,0xEB,0x5A,0xF8,0xC5,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_6, "face_b_w_resized_dial_img_8_65180_data_6.bin");
         
 
 
@@ -153,20 +105,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_6),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_7[] = {
-	//RGB565 data 
-	0xB2,0x94,0x71,0x8C,0x10,0x84,0x51,0x8C,0xD3,0x9C,0xAE,0x73,0x4D,0x6B,0x6D,0x6B,0x69,0x4A,0x86,0x31,0xFC,0xE6,0xFC,0xE6,0xFC,0xE6,0x0C,0x63,0xD3,0x9C,0xDB,0xDE,0x1C,0xE7,0x14,0xA5,0xCB,0x5A,0xFC,0xE6,0xFB,0xDE,0xFB,0xDE,0xEB,0x5A,0xB2,0x94,0x1C,0xE7,0xFC,0xE6,0x59,0xCE,0xE7,0x39,0x18,0xC6,0xFC,0xE6,0x1C,0xE7,0xB6,0xB5,
-	0xC7,0x39,0x7A,0xD6,0xFC,0xE6,0x1C,0xE7,0xD3,0x9C,0x28,0x42,0xBB,0xDE,0xFC,0xE6,0x1C,0xE7,0x14,0xA5,0x8E,0x73,0x1C,0xE7,0xFC,0xE6,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_7, "face_b_w_resized_dial_img_8_65180_data_7.bin");
         
 
 
@@ -174,20 +119,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_7),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_8[] = {
-	//RGB565 data 
-	0xFC,0xE6,0x96,0xB5,0x71,0x8C,0x96,0xB5,0xFB,0xDE,0x34,0xA5,0x89,0x4A,0x10,0x84,0x8A,0x52,0xB2,0x94,0xEB,0x5A,0x92,0x94,0x5D,0xEF,0x35,0xAD,0x89,0x4A,0xEF,0x7B,0x2C,0x63,0xDB,0xDE,0xB2,0x94,0x2C,0x63,0x7A,0xD6,0xE7,0x39,0x08,0x42,0x28,0x42,0x18,0xC6,0xAE,0x73,0x51,0x8C,0x96,0xB5,0x89,0x4A,0xCE,0x73,0xC6,0x31,0x38,0xC6,
-	0x5D,0xEF,0x18,0xC6,0x86,0x31,0x07,0x3A,0xD3,0x9C,0xFB,0xDE,0xD3,0x9C,0xE7,0x39,0x75,0xAD,0xEB,0x5A,0x0C,0x63,0xEB,0x5A,0x35,0xAD,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_8, "face_b_w_resized_dial_img_8_65180_data_8.bin");
         
 
 
@@ -195,20 +133,13 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_8),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_8_65180_data_9[] = {
-	//RGB565 data 
-	0x1C,0xE7,0x55,0xAD,0x10,0x84,0xB6,0xB5,0x1C,0xE7,0x51,0x8C,0x69,0x4A,0x8E,0x73,0x28,0x42,0x75,0xAD,0xC6,0x31,0x96,0xB5,0x5D,0xEF,0xB2,0x94,0x69,0x4A,0xC6,0x31,0x38,0xC6,0x3D,0xEF,0x18,0xC6,0xA6,0x31,0x28,0x42,0x10,0x84,0x38,0xC6,0xEF,0x7B,0x24,0x21,0xD7,0xBD,0x2C,0x63,0xEB,0x5A,0xEF,0x7B,0xC7,0x39,0x1C,0xE7,0x3C,0xE7,
-	0x5D,0xEF,0x75,0xAD,0x28,0x42,0xD7,0xBD,0xF8,0xC5,0x18,0xC6,0x8A,0x52,0x51,0x8C,0x51,0x8C,0x28,0x42,0xC7,0x39,0xAE,0x73,0xBB,0xDE,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_b_w_resized_dial_img_8_65180_data_9, "face_b_w_resized_dial_img_8_65180_data_9.bin");
         
 
 
@@ -216,7 +147,7 @@ const lv_img_dsc_t face_b_w_resized_dial_img_8_65180_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 5,
     .header.h = 9,
-    .data_size = sizeof(face_b_w_resized_dial_img_8_65180_data_9),
+    .data_size = 135,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_b_w_resized_dial_img_8_65180_data_9};
 
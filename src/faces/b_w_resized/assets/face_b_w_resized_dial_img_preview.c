@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: B_W_RESIZED
-
-#include "../b_w_resized.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_b_w_resized_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xD7,0xBD,0xD7,0xBD,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD7,0xBD,0xD7,0xBD,0xD7,0xBD,0xD6,0xB5,0xB5,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,
-	0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,
-	0xD7,0xBD,0x95,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0xD6,0xB5,0xD7,0xBD,
-	0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,
-	0xD7,0xBD,0xD6,0xB5,0xF7,0xBD,0xD6,0xB5,0xB5,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xD6,0xB5,0xD7,0xBD,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x59,0xCE,0x58,0xC6,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,
-	0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x59,0xCE,0x59,0xCE,0x18,0xC6,0x38,0xC6,0x79,0xCE,0xB6,0xB5,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF6,0xB5,0xD6,0xB5,0xD7,0xBD,0xD6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xAD,0x96,0xB5,0xB6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,
-	0x58,0xC6,0x79,0xCE,0x79,0xCE,0x7A,0xD6,0x18,0xC6,0xAE,0x73,0x49,0x4A,0x4C,0x63,0xD7,0xBD,0x79,0xCE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,
-	0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0x13,0x9D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xA5,0x95,0xAD,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x59,0xCE,0xF7,0xBD,0x4D,0x6B,0xA1,0x08,0x81,0x08,0x81,0x08,0x07,0x3A,0xB6,0xB5,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF6,0xB5,0xD6,0xB5,0xD6,0xB5,0x75,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xA5,0x54,0xA5,0x75,0xAD,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,
-	0x99,0xCE,0x99,0xCE,0xBA,0xD6,0x79,0xCE,0x44,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xE6,0x31,0xAE,0x73,0x38,0xC6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0xD2,0x94,0x54,0xA5,0x54,0xA5,0x75,0xAD,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xA6,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x81,0x08,0xEB,0x5A,0xDA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0x95,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0xF3,0x9C,0x54,0xA5,0x75,0xAD,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xD7,0xBD,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0xB9,0xCE,0xD6,0xB5,0x30,0x84,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x44,0x21,0x58,0xC6,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xF3,0x9C,0x54,0xA5,0x75,0xAD,0x96,0xB5,0xB6,0xB5,0xD7,0xBD,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xF6,0xB5,0xA6,0x31,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x08,0x49,0x4A,0x79,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xF6,0xB5,0xD6,0xB5,0xD6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x3A,0x13,0x9D,0x74,0xA5,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0xBA,0xD6,0x91,0x8C,0x60,0x00,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xF7,0xBD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0x13,0x9D,0x75,0xAD,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x37,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0xBA,0xD6,0x17,0xBE,0x85,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x08,0x81,0x08,0x69,0x4A,0x59,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0x74,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0xF3,0x9C,0x74,0xA5,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xD7,0xBD,0x17,0xBE,0x37,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0x79,0xCE,0xB6,0xB5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0xB6,0xB5,0x9A,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x51,0x8C,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0xF3,0x9C,0x54,0xA5,0x95,0xAD,0x96,0xB5,0xB6,0xB5,0xF7,0xBD,0x17,0xBE,0x37,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x33,0x9D,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x61,0x08,0x44,0x21,0x69,0x4A,0x4D,0x6B,0xCE,0x73,0xAE,0x73,0x2C,0x63,0x28,0x42,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x13,0x9D,0x54,0xA5,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,
-	0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x78,0xC6,0x58,0xC6,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0xAA,0x52,0xF3,0x9C,0xD6,0xB5,0x37,0xBE,0x37,0xBE,0xF6,0xB5,0xF6,0xB5,0x38,0xC6,0x17,0xBE,0x95,0xAD,0x70,0x84,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x3A,0x13,0x9D,0x54,0xA5,0x75,0xAD,0x96,0xB5,0xB6,0xB5,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,
-	0x58,0xC6,0x37,0xBE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x38,0xC6,0x59,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x38,0xC6,0x59,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0xB2,0x94,0xCE,0x73,0xEF,0x7B,0xAE,0x73,0x18,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0x95,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,
-	0x71,0x8C,0x37,0xBE,0x95,0xAD,0x50,0x84,0x69,0x4A,0x45,0x29,0x03,0x19,0x03,0x19,0x86,0x31,0x0B,0x5B,0xD2,0x94,0xF6,0xB5,0xF6,0xB5,0x4C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x89,0x4A,0x13,0x9D,0x54,0xA5,0x74,0xA5,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x37,0xBE,
-	0xF7,0xBD,0x54,0xA5,0x17,0xBE,0x38,0xC6,0x37,0xBE,0xD6,0xB5,0x75,0xAD,0x37,0xBE,0x58,0xC6,0x37,0xBE,0x95,0xAD,0xF6,0xB5,0x58,0xC6,0x58,0xC6,0x37,0xBE,0x74,0xA5,0x37,0xBE,0x58,0xC6,0x58,0xC6,0xD6,0xB5,0x75,0xAD,0x58,0xC6,0x58,0xC6,0x58,0xC6,0xB5,0xAD,0xF6,0xB5,0x58,0xC6,0x58,0xC6,0x17,0xBE,0x75,0xAD,0x37,0xBE,0x58,0xC6,
-	0x58,0xC6,0xD6,0xB5,0x95,0xAD,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x59,0xCE,0x50,0x84,0x54,0xA5,0xD7,0xBD,0xCF,0x7B,0xB6,0xB5,0xD6,0xB5,0xF3,0x9C,0x75,0xAD,0x18,0xC6,0xF3,0x9C,0x13,0x9D,0xD6,0xB5,0x95,0xAD,0xF3,0x9C,0xB6,0xB5,0x17,0xBE,0xF3,0x9C,0xD2,0x94,0x95,0xAD,0xB5,0xAD,0xD2,0x94,0x13,0x9D,0xB5,0xAD,0xB6,0xB5,
-	0x96,0xB5,0x95,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x54,0xA5,
-	0x17,0xBE,0xAE,0x73,0x03,0x19,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC7,0x39,0xD2,0x94,0x17,0xBE,0x91,0x8C,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x07,0x3A,0xF2,0x94,0x54,0xA5,0x74,0xA5,0x75,0xAD,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xD7,0xBD,0xD6,0xB5,
-	0x33,0x9D,0xB5,0xAD,0x17,0xBE,0x38,0xC6,0xB6,0xB5,0x54,0xA5,0x17,0xBE,0x38,0xC6,0x37,0xBE,0x74,0xA5,0x95,0xAD,0x37,0xBE,0x38,0xC6,0x17,0xBE,0x54,0xA5,0xD6,0xB5,0x38,0xC6,0x38,0xC6,0xD6,0xB5,0x74,0xA5,0x37,0xBE,0x38,0xC6,0x37,0xBE,0x74,0xA5,0x75,0xAD,0x37,0xBE,0x38,0xC6,0x17,0xBE,0x54,0xA5,0xF6,0xB5,0x38,0xC6,0x38,0xC6,
-	0xD6,0xB5,0x54,0xA5,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x50,0x84,0x95,0xAD,0x17,0xBE,0xCF,0x7B,0x54,0xA5,0xCE,0x73,0xD2,0x94,0xAE,0x73,0x13,0x9D,0xAE,0x73,0x34,0xA5,0x74,0xA5,0xAE,0x73,0xF3,0x9C,0xCF,0x7B,0x34,0xA5,0x6D,0x6B,0xCE,0x73,0xB2,0x94,0x71,0x8C,0x91,0x8C,0x8E,0x73,0x34,0xA5,0xF6,0xB5,
-	0xB6,0xB5,0xD6,0xB5,0x95,0xAD,0xF2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x75,0xAD,0xD6,0xB5,
-	0xAA,0x52,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x0F,0x7C,0x17,0xBE,0x50,0x84,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0x70,0x84,0x33,0x9D,0x54,0xA5,0x54,0xA5,0x95,0xAD,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,
-	0x33,0x9D,0x74,0xA5,0xF6,0xB5,0xF7,0xBD,0xD6,0xB5,0x33,0x9D,0xD6,0xB5,0x17,0xBE,0x17,0xBE,0x95,0xAD,0x53,0x9D,0xF6,0xB5,0x17,0xBE,0x17,0xBE,0x74,0xA5,0x95,0xAD,0x17,0xBE,0x17,0xBE,0xD6,0xB5,0x34,0xA5,0xD6,0xB5,0x17,0xBE,0x17,0xBE,0x74,0xA5,0x54,0xA5,0xF6,0xB5,0x17,0xBE,0xF7,0xBD,0x54,0xA5,0x95,0xAD,0x17,0xBE,0x17,0xBE,
-	0xD6,0xB5,0x53,0x9D,0xD6,0xB5,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0x30,0x84,0x75,0xAD,0xF6,0xB5,0xCF,0x7B,0x13,0x9D,0xCE,0x73,0x38,0xC6,0x50,0x84,0x30,0x84,0x30,0x84,0x58,0xC6,0xF3,0x9C,0x50,0x84,0x38,0xC6,0xEF,0x7B,0xB1,0x8C,0x0F,0x7C,0x50,0x84,0xB2,0x94,0xF2,0x94,0xCF,0x7B,0x2C,0x63,0x13,0x9D,0xF7,0xBD,
-	0xD6,0xB5,0xD6,0xB5,0xB5,0xAD,0x54,0xA5,0x54,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0xD2,0x94,0xF6,0xB5,0x49,0x4A,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xCF,0x7B,0x37,0xBE,0x4D,0x6B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x2C,0x63,0x33,0x9D,0x54,0xA5,0x54,0xA5,0x75,0xAD,0x75,0xAD,0x95,0xAD,
-	0x95,0xAD,0x13,0x9D,0x95,0xAD,0xD6,0xB5,0xD6,0xB5,0x95,0xAD,0x33,0x9D,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0x74,0xA5,0x74,0xA5,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0x53,0x9D,0xB5,0xAD,0xF7,0xBD,0xF7,0xBD,0xB5,0xAD,0x53,0x9D,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x74,0xA5,0x74,0xA5,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0x53,0x9D,0xB6,0xB5,0xF7,0xBD,
-	0xF7,0xBD,0xB5,0xAD,0x53,0x9D,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x30,0x84,0x55,0xAD,0xD6,0xB5,0xCF,0x7B,0x54,0xA5,0xAE,0x73,0x34,0xA5,0xAE,0x73,0xB2,0x94,0x0F,0x7C,0x17,0xBE,0x54,0xA5,0xAE,0x73,0x34,0xA5,0x8D,0x6B,0xAE,0x73,0x30,0x84,0x0F,0x7C,0x71,0x8C,0xAE,0x73,0x92,0x94,0x6D,0x6B,0xF3,0x9C,0xD6,0xB5,
-	0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x54,0xA5,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x4A,0x17,0xBE,0xCE,0x73,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x33,0x9D,0xB5,0xAD,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0xEE,0x73,0xF2,0x94,0x33,0x9D,0x54,0xA5,0x54,0xA5,
-	0x74,0xA5,0x75,0xAD,0x75,0xAD,0x95,0xAD,0x95,0xAD,0xB5,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x96,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xD6,0xB5,0x91,0x8C,0x54,0xA5,0xB6,0xB5,0x50,0x84,0x75,0xAD,0xF2,0x94,0xAE,0x73,0x71,0x8C,0x75,0xAD,0x51,0x8C,0xD6,0xB5,0xF6,0xB5,0x92,0x94,0xAE,0x73,0x50,0x84,0x4C,0x63,0xAE,0x73,0x8D,0x6B,0x8D,0x6B,0xD2,0x94,0x8D,0x6B,0xAE,0x73,0xF3,0x9C,0xB5,0xAD,
-	0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x34,0xA5,0x33,0x9D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x54,0xA5,0x95,0xAD,0xC3,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0x03,0x19,0x00,0x00,0x00,0x00,0x28,0x42,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x37,0xBE,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x24,0x21,0xEB,0x5A,0x91,0x8C,0x33,0x9D,
-	0x33,0x9D,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,
-	0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x95,0xAD,0x95,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x95,0xAD,0x96,0xB5,0x75,0xAD,0x13,0x9D,0x51,0x8C,0x75,0xAD,0x54,0xA5,0x0F,0x7C,0x75,0xAD,0x54,0xA5,0x75,0xAD,0x54,0xA5,0x54,0xA5,
-	0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x13,0x9D,0x13,0x9D,0x12,0x95,0x4C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x3A,0x37,0xBE,0x6C,0x63,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA6,0x31,0xEB,0x5A,0x2C,0x63,0x89,0x4A,0x2C,0x63,0x8A,0x52,0xAE,0x73,0xAA,0x52,0x0B,0x5B,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x54,0xA5,0x54,0xA5,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,
-	0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,
-	0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,0x24,0x21,
-	0x24,0x21,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0xE3,0x18,0x03,0x19,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0x17,0xBE,0x85,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xAE,0x73,0xE3,0x18,0x49,0x4A,0x65,0x29,0xA2,0x10,0x82,0x10,0xCB,0x5A,0x44,0x21,0xC6,0x31,0x89,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x37,0xBE,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x71,0x8C,0xB5,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xEF,0x7B,0xA6,0x31,0x65,0x29,0x65,0x29,0x45,0x29,0x45,0x29,0x65,0x29,0x45,0x29,0x48,0x42,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x42,0x37,0xBE,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xD2,0x94,0x74,0xA5,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0F,0x7C,0x08,0x42,0x07,0x3A,0xC6,0x31,0x07,0x3A,0xE7,0x39,0xE7,0x39,0x07,0x3A,0xCA,0x52,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0x16,0xB6,0x0B,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xD2,0x94,0x74,0xA5,0xA2,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x8E,0x73,0xA2,0x10,0xD2,0x94,0xA2,0x10,0xAE,0x73,0xC7,0x39,0xE7,0x39,0x8D,0x6B,0x24,0x21,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0x31,0x16,0xB6,0x0B,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x50,0x84,0xB5,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xAE,0x73,0x61,0x08,0xE3,0x18,0x20,0x00,0xA2,0x10,0x41,0x08,0x41,0x08,0xA2,0x10,0x24,0x21,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x42,0x37,0xBE,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0x17,0xBE,0xA6,0x31,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xAE,0x73,0xA2,0x10,0xEE,0x73,0x82,0x10,0x0B,0x5B,0x86,0x31,0x00,0x00,0x00,0x00,0x24,0x21,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x6B,0x37,0xBE,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x61,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x24,0x21,0x85,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x04,0x21,0x04,0x21,0x04,0x21,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x37,0xBE,0x8D,0x6B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xCF,0x7B,0xE3,0x18,0x28,0x42,0x81,0x08,0xA6,0x31,0xE3,0x18,0x40,0x00,0x40,0x00,0x85,0x29,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x75,0xAD,0x34,0xA5,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0xD3,0x9C,0xD3,0x9C,
-	0xC7,0x39,0x00,0x00,0x44,0x21,0x92,0x94,0xD3,0x9C,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xD3,0x9C,0x0C,0x63,0x00,0x00,0x61,0x08,0x6D,0x6B,0xD3,0x9C,0xD3,0x9C,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xAA,0x52,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xF7,0xBD,0xF3,0x9C,0xB2,0x94,0xB2,0x94,0xF3,0x9C,0xD6,0xB5,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0x50,0x84,0x0C,0x63,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x13,0x9D,0xB5,0xAD,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE7,0x39,0xCE,0x73,0xAE,0x73,0xCE,0x73,0xAE,0x73,0xAE,0x73,0xCE,0x73,0xCE,0x73,0x8D,0x6B,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x37,0xBE,0x0B,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x34,0xA5,0xE7,0x39,0xE7,0x39,
-	0x34,0xA5,0xA2,0x10,0xB2,0x94,0x69,0x4A,0x03,0x19,0x14,0xA5,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x13,0x9D,0xCF,0x7B,0x00,0x00,0x61,0x08,0x69,0x4A,0xC3,0x18,0x69,0x4A,0x95,0xAD,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x8A,0x52,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x9A,0xD6,0xA2,0x10,0x04,0x21,0x65,0x29,0x45,0x29,0x65,0x29,0x44,0x21,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x91,0x8C,0x51,0x8C,0x30,0x84,0x2C,0x63,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x42,0x17,0xBE,0x0F,0x7C,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x54,0xA5,0x95,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xD2,0x94,0x00,0x00,0x00,0x00,
-	0xF3,0x9C,0x45,0x29,0x96,0xB5,0xE3,0x18,0x00,0x00,0x6D,0x6B,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x75,0xAD,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x8A,0x52,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x9A,0xD6,0xA2,0x10,0xAE,0x73,0x13,0x9D,0xDB,0xDE,0x34,0xA5,0x30,0x84,0x81,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x94,0xB2,0x94,0xB2,0x94,0x71,0x8C,0x50,0x84,0x10,0x84,0x0B,0x5B,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x91,0x8C,0xF6,0xB5,0x8A,0x52,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x2F,0x7C,0x37,0xBE,0x0B,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x71,0x8C,0x00,0x00,0x00,0x00,
-	0x71,0x8C,0x86,0x31,0xD2,0x94,0x69,0x4A,0x24,0x21,0x51,0x8C,0x92,0x94,0x00,0x00,0x41,0x08,0x24,0x21,0x65,0x29,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xCF,0x7B,0x00,0x00,0x00,0x00,0x20,0x00,0x4D,0x6B,0x96,0xB5,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x8A,0x52,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x9A,0xD6,0xA2,0x10,0x00,0x00,0x61,0x08,0x38,0xC6,0x44,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x95,0xF2,0x94,0xD2,0x94,0xB2,0x94,0x91,0x8C,0x51,0x8C,0x30,0x84,0xEF,0x7B,0x2C,0x63,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x54,0xA5,0xF6,0xB5,
-	0x0C,0x63,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x70,0x84,0x17,0xBE,0x0F,0x7C,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0x91,0x8C,0x00,0x00,0x00,0x00,
-	0x91,0x8C,0x85,0x29,0x24,0x21,0xCE,0x73,0x8D,0x6B,0xAE,0x73,0x50,0x84,0x00,0x00,0xCB,0x5A,0x38,0xC6,0x79,0xCE,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xCB,0x5A,0xD2,0x94,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x8A,0x52,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x9A,0xD6,0xA2,0x10,0x00,0x00,0x62,0x10,0x38,0xC6,0x44,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x9D,0x13,0x9D,0x12,0x95,0xD2,0x94,0xB2,0x94,0x91,0x8C,0x30,0x84,0x10,0x84,0xCF,0x7B,0x4D,0x6B,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x33,0x9D,
-	0x37,0xBE,0x0F,0x7C,0x44,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x07,0x3A,0x34,0xA5,0x17,0xBE,0x50,0x84,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x13,0x9D,0x20,0x00,0x20,0x00,
-	0x13,0x9D,0x24,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x50,0x84,0xEB,0x5A,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0xCF,0x7B,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x8A,0x52,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x9A,0xD6,0xA2,0x10,0x00,0x00,0x62,0x10,0x38,0xC6,0x44,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x33,0x9D,0x12,0x95,0xD2,0x94,0xB2,0x94,0x71,0x8C,0x30,0x84,0xEF,0x7B,0xAE,0x73,0x2C,0x63,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,
-	0x0F,0x7C,0x17,0xBE,0xD6,0xB5,0x91,0x8C,0xEB,0x5A,0xA6,0x31,0x45,0x29,0x45,0x29,0xE7,0x39,0x8D,0x6B,0xF3,0x9C,0xF7,0xBD,0xD6,0xB5,0xCA,0x52,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xB2,0x94,0x6D,0x6B,0x6D,0x6B,
-	0xB2,0x94,0x61,0x08,0x49,0x4A,0x89,0x4A,0x2C,0x63,0xD3,0x9C,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x07,0x3A,0xD3,0x9C,0xB2,0x94,0xE7,0x39,0x04,0x21,0x30,0x84,0x48,0x42,0x4D,0x6B,0x75,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x8A,0x52,0x2C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xC3,0x18,0x00,0x00,0x00,0x00,0xE3,0x18,0x9A,0xD6,0xA2,0x10,0x00,0x00,0x62,0x10,0x38,0xC6,0x45,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x33,0x9D,0x12,0x95,0xD2,0x94,0x91,0x8C,0x51,0x8C,0x0F,0x7C,0xCF,0x7B,0xAE,0x73,0x4D,0x6B,0x85,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x28,0x42,0xB2,0x94,0xB5,0xAD,0x37,0xBE,0x58,0xC6,0x37,0xBE,0x17,0xBE,0x37,0xBE,0x16,0xB6,0x74,0xA5,0x0F,0x7C,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xCF,0x7B,0xAE,0x73,
-	0xC2,0x10,0x00,0x00,0x65,0x29,0x30,0x84,0x0F,0x7C,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x30,0x84,0x50,0x84,0x71,0x8C,0x10,0x84,0x41,0x08,0x89,0x4A,0x50,0x84,0xAE,0x73,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xAA,0x52,0x4C,0x63,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x10,0x84,0x61,0x08,0x00,0x00,0x00,0x00,0x81,0x08,0x10,0x84,0x61,0x08,0x00,0x00,0x41,0x08,0x8E,0x73,0x24,0x21,0x82,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x91,0x8C,0x50,0x84,0x0F,0x7C,0xCF,0x7B,0x8E,0x73,0x2C,0x63,0x08,0x42,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0x07,0x3A,0xCA,0x52,0x91,0x8C,0x17,0xBE,0x17,0xBE,0xEF,0x7B,0xC3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xC7,0x39,0x8A,0x52,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x33,0x9D,0x13,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x51,0x8C,0x0F,0x7C,0xCE,0x73,0x8D,0x6B,0x6D,0x6B,0x49,0x4A,0x81,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xEB,0x5A,0x95,0xAD,0x17,0xBE,0x2F,0x7C,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x33,0x9D,0x13,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x30,0x84,0x0F,0x7C,0xCE,0x73,0x8D,0x6B,0x4C,0x63,0xAA,0x52,0x04,0x21,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x2F,0x7C,0x37,0xBE,0x95,0xAD,0xEB,0x5A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x96,0xB5,0x74,0xA5,0x6C,0x63,0x13,0x9D,0x13,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x30,0x84,0x0F,0x7C,0xCE,0x73,0x8E,0x73,0x4D,0x6B,0x0C,0x63,0x45,0x29,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x4A,0x74,0xA5,0x17,0xBE,0x50,0x84,0x44,0x21,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0xD7,0xBD,0xD6,0xB5,0xF6,0xB5,0xCE,0x73,0x44,0x21,0x34,0xA5,0x33,0x9D,0x13,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x30,0x84,0x0F,0x7C,0xCF,0x7B,0x8E,0x73,0x6D,0x6B,0x2C,0x63,
-	0x28,0x42,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xCE,0x73,0x17,0xBE,0xB5,0xAD,0x71,0x8C,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,
-	0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,
-	0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,
-	0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x50,0x84,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x70,0x84,0x81,0x08,0x08,0x42,0xB6,0xB5,0x74,0xA5,0x33,0x9D,0x12,0x95,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x51,0x8C,0x0F,0x7C,0xCF,0x7B,0xAE,0x73,0x6D,0x6B,
-	0x4D,0x6B,0xAA,0x52,0x04,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x28,0x42,0x33,0x9D,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,
-	0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,
-	0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,
-	0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0xB5,0xAD,0x95,0xAD,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x13,0x9D,0xE3,0x18,0x00,0x00,0xE7,0x39,0x10,0x84,0x0F,0x7C,0x54,0xA5,0x54,0xA5,0x13,0x9D,0xF2,0x94,0xB2,0x94,0x91,0x8C,0x50,0x84,0x0F,0x7C,0xCF,0x7B,0xAE,0x73,
-	0x8E,0x73,0x4D,0x6B,0x0C,0x63,0x28,0x42,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,
-	0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,
-	0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,
-	0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC3,0x18,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xD6,0xB5,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x38,0xC6,0x0B,0x5B,0xA6,0x31,0xE2,0x10,0x00,0x00,0x20,0x00,0xEB,0x5A,0x95,0xAD,0x54,0xA5,0x33,0x9D,0x13,0x9D,0xF2,0x94,0xD2,0x94,0x91,0x8C,0x71,0x8C,0x30,0x84,0xEF,0x7B,
-	0xCE,0x73,0x8E,0x73,0x6D,0x6B,0x4D,0x6B,0xEB,0x5A,0x45,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x78,0xC6,0xAA,0x52,0x00,0x00,0x89,0x4A,0xB5,0xAD,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0x33,0x9D,0x12,0x95,0xD2,0x94,0xB1,0x8C,0x71,0x8C,0x30,0x84,
-	0x0F,0x7C,0xCF,0x7B,0xAE,0x73,0x6D,0x6B,0x6D,0x6B,0x2C,0x63,0xAA,0x52,0x44,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x98,0xC6,0xC7,0x39,0x08,0x42,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x33,0x9D,0x12,0x95,0xD2,0x94,0xB2,0x94,0x91,0x8C,
-	0x50,0x84,0x30,0x84,0xEF,0x7B,0xCF,0x7B,0xAE,0x73,0x6D,0x6B,0x4D,0x6B,0x2C,0x63,0xAA,0x52,0x65,0x29,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x38,0xC6,0xAA,0x52,0xB6,0xB5,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x33,0x9D,0x13,0x9D,0xF2,0x94,0xD2,0x94,
-	0x91,0x8C,0x71,0x8C,0x30,0x84,0x0F,0x7C,0xEF,0x7B,0xCE,0x73,0x8E,0x73,0x6D,0x6B,0x4D,0x6B,0x2C,0x63,0xEB,0x5A,0x69,0x4A,0xC7,0x39,0x44,0x21,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,
-	0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x38,0xC6,0xF7,0xBD,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xD6,0xB5,0xD6,0xB5,0xB5,0xAD,0x95,0xAD,0x74,0xA5,0x54,0xA5,0x33,0x9D,0xF2,0x94,
-	0xD2,0x94,0xB2,0x94,0x91,0x8C,0x51,0x8C,0x30,0x84,0xEF,0x7B,0xEF,0x7B,0xAE,0x73,0xAE,0x73,0x6D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xCA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,
-	0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,0xAA,0x52,
-	0xCA,0x52,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,
-	0x0B,0x5B,0x0B,0x5B,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xAA,0x52,0xAA,0x52,0x69,0x4A,0x28,0x42,0xA6,0x31,0xC3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x37,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF6,0xB5,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x74,0xA5,0x54,0xA5,0x33,0x9D,
-	0x13,0x9D,0xF2,0x94,0xD2,0x94,0xB2,0x94,0x71,0x8C,0x50,0x84,0x30,0x84,0x0F,0x7C,0xEF,0x7B,0xCE,0x73,0xAE,0x73,0xAE,0x73,0x8D,0x6B,0x6D,0x6B,0x6D,0x6B,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEB,0x5A,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0xCB,0x5A,0xCA,0x52,0xAA,0x52,0xAA,0x52,0x49,0x4A,0xC7,0x39,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x96,0xB5,0x75,0xAD,0x54,0xA5,
-	0x54,0xA5,0x33,0x9D,0xF2,0x94,0xD2,0x94,0xB2,0x94,0xB2,0x94,0x91,0x8C,0x51,0x8C,0x50,0x84,0x10,0x84,0xEF,0x7B,0xEF,0x7B,0xCF,0x7B,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x8E,0x73,0x8E,0x73,0x8E,0x73,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,
-	0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,
-	0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,
-	0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x0C,0x63,0xEB,0x5A,0xEB,0x5A,0xAA,0x52,0xAA,0x52,0x8A,0x52,0xC6,0x31,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x9A,0xD6,0x95,0xAD,0x75,0xAD,0xBA,0xD6,0x79,0xCE,0x34,0xA5,0xD3,0x9C,0xF7,0xBD,0x99,0xCE,0x71,0x8C,0x30,0x84,0x79,0xCE,0xF3,0x9C,0xF7,0xBD,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0x96,0xB5,0x71,0x8C,
-	0xAE,0x73,0xAE,0x73,0xAD,0x6B,0x8D,0x6B,0x0F,0x7C,0x14,0xA5,0x13,0x9D,0xB2,0x94,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x30,0x84,0x30,0x84,0x30,0x84,0x8D,0x6B,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x8E,0x73,0xEF,0x7B,0xEF,0x7B,0xCF,0x7B,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0xCE,0x73,0xCE,0x73,
-	0xEE,0x73,0x6D,0x6B,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x8D,0x6B,0xCF,0x7B,0xCE,0x73,0x8D,0x6B,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0xCE,0x73,0xCE,0x73,0xCE,0x73,0x4D,0x6B,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0xAE,0x73,0xCE,0x73,0xEE,0x73,0x8E,0x73,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x6D,0x6B,
-	0xEF,0x7B,0xCE,0x73,0xCE,0x73,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0xAE,0x73,0xEE,0x73,0xEE,0x73,0x8D,0x6B,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x4C,0x63,0x8D,0x6B,0xEF,0x7B,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,
-	0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x8E,0x73,0x8E,0x73,0x8E,0x73,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x4D,0x6B,0x2C,0x63,0x0C,0x63,0x0B,0x5B,0xEB,0x5A,0xCA,0x52,0xAA,0x52,0x69,0x4A,0x65,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0x17,0xBE,0x37,0xBE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0xF3,0x9C,0x4C,0x63,0x6D,0x6B,0xB2,0x94,0xF3,0x9C,0x8A,0x52,0x30,0x84,0xB6,0xB5,0x99,0xCE,0xCE,0x73,0x30,0x84,0x96,0xB5,0x91,0x8C,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD2,0x94,
-	0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8D,0x6B,0x54,0xA5,0x55,0xAD,0x13,0x9D,0x6D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0x92,0x94,0x92,0x94,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x51,0x8C,0x51,0x8C,0x30,0x84,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xEF,0x7B,0x30,0x84,
-	0x30,0x84,0xAE,0x73,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8D,0x6B,0x30,0x84,0x30,0x84,0x0F,0x7C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0x0F,0x7C,0x30,0x84,0x30,0x84,0x8D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xAE,0x73,0x30,0x84,0x30,0x84,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,
-	0x30,0x84,0x30,0x84,0x30,0x84,0x6C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCE,0x73,0x51,0x8C,0x51,0x8C,0xEF,0x7B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x30,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0xEF,0x7B,0x6D,0x6B,0x8D,0x6B,0xEF,0x7B,0x10,0x84,0x10,0x84,
-	0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x0F,0x7C,0xEF,0x7B,0xEF,0x7B,0xCF,0x7B,0xCE,0x73,0xAE,0x73,0xAE,0x73,0x8E,0x73,0x6D,0x6B,0x4D,0x6B,0x2C,0x63,0x0C,0x63,0xEB,0x5A,0xAA,0x52,0x8A,0x52,0xC6,0x31,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x50,0x84,0x50,0x84,0x34,0xA5,0xCE,0x73,0x71,0x8C,0x6D,0x6B,0x75,0xAD,0xBA,0xD6,0x99,0xCE,0xAE,0x73,0x10,0x84,0xB2,0x94,0x92,0x94,0x10,0x84,0x17,0xBE,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xB5,0xAD,
-	0x4C,0x63,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0x35,0xAD,0x96,0xB5,0x95,0xAD,0x10,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xEF,0x7B,0xF3,0x9C,0xD3,0x9C,0x71,0x8C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x92,0x94,0xB2,0x94,0xB2,0x94,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x92,0x94,
-	0xB2,0x94,0x30,0x84,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x92,0x94,0x92,0x94,0x91,0x8C,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xB2,0x94,0xB2,0x94,0x10,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x8D,0x6B,0x92,0x94,0x92,0x94,0x92,0x94,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,
-	0x30,0x84,0xB2,0x94,0x92,0x94,0xCE,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8D,0x6B,0xB2,0x94,0xB2,0x94,0x71,0x8C,0x4C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x50,0x84,0x50,0x84,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x4D,0x6B,0xCF,0x7B,0x8D,0x6B,0xAE,0x73,0x70,0x84,0x0F,0x7C,
-	0x30,0x84,0x50,0x84,0x30,0x84,0x0F,0x7C,0x2F,0x7C,0x50,0x84,0x30,0x84,0x0F,0x7C,0x0F,0x7C,0x50,0x84,0x0F,0x7C,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0xCE,0x73,0x8E,0x73,0x4D,0x6B,0x2C,0x63,0x0C,0x63,0x0B,0x5B,0xCA,0x52,0xAA,0x52,0xE7,0x39,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF6,0xB5,0x17,0xBE,0x38,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0xB7,0xBD,0x89,0x4A,0x49,0x4A,0xB6,0xB5,0x95,0xAD,0x51,0x8C,0x4D,0x6B,0xEF,0x7B,0x99,0xCE,0xF3,0x9C,0xB2,0x94,0x50,0x84,0xAE,0x73,0x55,0xAD,0x95,0xAD,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x59,0xCE,
-	0xEF,0x7B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xD2,0x94,0xD7,0xBD,0xB6,0xB5,0xD3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x6D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x50,0x84,0xF3,0x9C,0xF3,0x9C,0x0F,0x7C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x8E,0x73,0xD3,0x9C,
-	0xF3,0x9C,0xD3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x91,0x8C,0xF3,0x9C,0xF3,0x9C,0xEF,0x7B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xCE,0x73,0xF3,0x9C,0xF3,0x9C,0xB2,0x94,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0x8E,0x73,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0xEF,0x7B,0xF3,0x9C,0xF3,0x9C,0x71,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0xB2,0x94,0xF3,0x9C,0xF3,0x9C,0x8D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x30,0x84,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xD2,0x94,0xB2,0x94,0xD2,0x94,0xD2,0x94,0x91,0x8C,0x50,0x84,0xAE,0x73,0xCE,0x73,0x10,0x84,0x6D,0x6B,
-	0x4C,0x63,0x71,0x8C,0x2C,0x63,0x6D,0x6B,0x2C,0x63,0x30,0x84,0x2C,0x63,0x6D,0x6B,0x2C,0x63,0xB1,0x8C,0x4D,0x6B,0x4C,0x63,0x2C,0x63,0x70,0x84,0x51,0x8C,0xEF,0x7B,0x8E,0x73,0x4D,0x6B,0x4D,0x6B,0x2D,0x6B,0x0B,0x5B,0xEB,0x5A,0xAA,0x52,0xC7,0x39,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x2C,0x63,0xF7,0xBD,0x75,0xAD,0x2C,0x63,0xDA,0xD6,0x1C,0xE7,0x18,0xC6,0xAA,0x52,0x99,0xCE,0xDB,0xDE,0x14,0xA5,0x54,0xA5,0xEF,0x7B,0xB6,0xB5,0x95,0xAD,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x59,0xCE,
-	0xD3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x30,0x84,0x18,0xC6,0xF7,0xBD,0x96,0xB5,0x4D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x34,0xA5,0x95,0xAD,0x75,0xAD,0xEF,0x7B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xEF,0x7B,0x54,0xA5,0x54,0xA5,0xD3,0x9C,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x13,0x9D,
-	0x34,0xA5,0x54,0xA5,0xCF,0x7B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x51,0x8C,0x54,0xA5,0x54,0xA5,0xB2,0x94,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x6D,0x6B,0x34,0xA5,0x54,0xA5,0x34,0xA5,0x8D,0x6B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x71,0x8C,0x54,0xA5,0x54,0xA5,0x71,0x8C,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,
-	0x8E,0x73,0x34,0xA5,0x54,0xA5,0x34,0xA5,0x6D,0x6B,0x0C,0x63,0x2C,0x63,0x2C,0x63,0x2C,0x63,0xD2,0x94,0x54,0xA5,0x55,0xAD,0x50,0x84,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0xCF,0x7B,0xF2,0x94,0xF2,0x94,0xF2,0x94,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x30,0x84,0x4D,0x6B,0x0F,0x7C,0x71,0x8C,0xAE,0x73,
-	0x2C,0x63,0x70,0x84,0x6D,0x6B,0xF2,0x94,0xEF,0x7B,0x0F,0x7C,0x2C,0x63,0x0F,0x7C,0x4C,0x63,0x13,0x9D,0x6D,0x6B,0xB2,0x94,0x4D,0x6B,0xD2,0x94,0xB1,0x8C,0x30,0x84,0xCF,0x7B,0xAE,0x73,0x8D,0x6B,0x6D,0x6B,0x4C,0x63,0x0C,0x63,0xEB,0x5A,0xAA,0x52,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0xAE,0x73,0x91,0x8C,0xB2,0x94,0x8E,0x73,0xB2,0x94,0x14,0xA5,0xCF,0x7B,0x10,0x84,0xBA,0xD6,0xBA,0xD6,0x14,0xA5,0x99,0xCE,0x13,0x9D,0xEF,0x7B,0x17,0xBE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,
-	0x96,0xB5,0xEE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0x30,0x84,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0x30,0x84,0xCE,0x73,0xCE,0x73,0xAE,0x73,0xAE,0x73,0xD3,0x9C,0x96,0xB5,0x95,0xAD,0xB2,0x94,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x0F,0x7C,0x55,0xAD,0x55,0xAD,0x55,0xAD,0xCE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xF3,0x9C,
-	0x55,0xAD,0x75,0xAD,0x92,0x94,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x30,0x84,0x75,0xAD,0x55,0xAD,0x34,0xA5,0xCF,0x7B,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x14,0xA5,0x75,0xAD,0x55,0xAD,0x30,0x84,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x51,0x8C,0x55,0xAD,0x75,0xAD,0x14,0xA5,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,
-	0xCF,0x7B,0x34,0xA5,0x55,0xAD,0x75,0xAD,0x30,0x84,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xB2,0x94,0x75,0xAD,0x55,0xAD,0xF3,0x9C,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xCE,0x73,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x2F,0x7C,0x13,0x9D,0x91,0x8C,0xCE,0x73,0xCE,0x73,0x50,0x84,
-	0xCE,0x73,0x92,0x94,0x6D,0x6B,0x13,0x9D,0xEF,0x7B,0xB2,0x94,0x6D,0x6B,0xCE,0x73,0x4D,0x6B,0xF3,0x9C,0x6D,0x6B,0xF2,0x94,0x6D,0x6B,0x13,0x9D,0xF3,0x9C,0x71,0x8C,0x0F,0x7C,0xEF,0x7B,0xCE,0x73,0xAE,0x73,0x8D,0x6B,0x4D,0x6B,0x0C,0x63,0xEB,0x5A,0x8A,0x52,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x58,0xC6,0xB6,0xB5,0xB6,0xB5,0x58,0xC6,0x38,0xC6,0xB6,0xB5,0xB6,0xB5,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,
-	0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x96,0xB5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,
-	0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,
-	0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x95,0xAD,0x71,0x8C,0x6D,0x6B,0x6D,0x6B,0xF3,0x9C,0x71,0x8C,0x6D,0x6B,
-	0x4D,0x6B,0xB2,0x94,0x4D,0x6B,0x4D,0x6B,0xAE,0x73,0x91,0x8C,0xAE,0x73,0x54,0xA5,0x8D,0x6B,0xAE,0x73,0x0B,0x5B,0x6D,0x6B,0x0B,0x5B,0xD3,0x9C,0x33,0x9D,0xB2,0x94,0x50,0x84,0x0F,0x7C,0x0F,0x7C,0x0F,0x7C,0xCE,0x73,0x8E,0x73,0x4D,0x6B,0x0C,0x63,0xEB,0x5A,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x96,0xB5,0x96,0xB5,0xB6,0xB5,0xB6,0xB5,0x96,0xB5,
-	0xB6,0xB5,0x95,0xAD,0x8D,0x6B,0x54,0xA5,0xB6,0xB5,0x96,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0xAE,0x73,0x14,0xA5,0x95,0xAD,0x30,0x84,0xD3,0x9C,0x54,0xA5,0xF3,0x9C,0xB1,0x8C,0x71,0x8C,0x51,0x8C,0x51,0x8C,0x0F,0x7C,0xCF,0x7B,0x8D,0x6B,0x4C,0x63,0x0C,0x63,0xCB,0x5A,0xE3,0x18,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,
-	0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,
-	0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,
-	0xD6,0xB5,0xD6,0xB5,0x13,0x9D,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x54,0xA5,0x95,0xAD,0xB6,0xB5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xD2,0x94,0xB2,0x94,0x71,0x8C,0x50,0x84,0x10,0x84,0xCE,0x73,0x8D,0x6B,0x2C,0x63,0x0B,0x5B,0x07,0x3A,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x78,0xC6,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,
-	0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,
-	0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,
-	0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x33,0x9D,0x13,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x30,0x84,0x0F,0x7C,0xAE,0x73,0x6D,0x6B,0x2C,0x63,0xAA,0x52,0x61,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD7,0xBD,0xD7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0xD2,0x94,0xF3,0x9C,0x78,0xC6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x95,0xAD,0x54,0xA5,0x33,0x9D,0x13,0x9D,0xF2,0x94,0xB2,0x94,0x51,0x8C,0x30,0x84,0xEF,0x7B,0xAE,0x73,0x4D,0x6B,0x0B,0x5B,0xE3,0x18,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x38,0xC6,0x38,0xC6,0xD2,0x94,0x50,0x84,0x50,0x84,0xF2,0x94,0x78,0xC6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,
-	0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,
-	0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,
-	0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD7,0xBD,0xD6,0xB5,0xB6,0xB5,0x75,0xAD,0x54,0xA5,0x33,0x9D,0x12,0x95,0xD2,0x94,0x92,0x94,0x50,0x84,0x0F,0x7C,0xCE,0x73,0x6D,0x6B,0x2C,0x63,0xC6,0x31,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x37,0xBE,0xD2,0x94,0x71,0x8C,0x17,0xBE,0x17,0xBE,0x71,0x8C,0xD2,0x94,0x9A,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0x96,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xD2,0x94,0x91,0x8C,0x50,0x84,0xEF,0x7B,0xAE,0x73,0x4D,0x6B,0x69,0x4A,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x37,0xBE,0x13,0x9D,0x17,0xBE,0x99,0xCE,0x99,0xCE,0x37,0xBE,0x13,0x9D,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xFB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,
-	0x51,0x8C,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0xAE,0x73,0x14,0xA5,0x79,0xCE,0x7A,0xD6,0x9A,0xD6,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0xD6,0xB5,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x6D,0x6B,0x14,0xA5,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x91,0x8C,0x6D,0x6B,
-	0x8D,0x6B,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0xDB,0xDE,0x59,0xCE,0x92,0x94,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,
-	0xCE,0x73,0x34,0xA5,0x9A,0xD6,0xBA,0xD6,0x79,0xCE,0x79,0xCE,0xD6,0xB5,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0xAE,0x73,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x0F,0x7C,0xD7,0xBD,0x9A,0xD6,0x9A,0xD6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0x96,0xB5,0x75,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB1,0x8C,0x51,0x8C,0x0F,0x7C,0xCF,0x7B,0x6D,0x6B,0x0B,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x99,0xCE,0x17,0xBE,0x38,0xC6,0xBA,0xD6,0x9A,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x1C,0xE7,
-	0x07,0x3A,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xC2,0x10,0x4C,0x63,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x13,0x9D,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x61,0x08,0xAE,0x73,0xBA,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xDA,0xD6,0xCA,0x52,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x17,0xBE,0xE7,0x39,0xA1,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0xC2,0x10,0xCA,0x52,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x34,0xA5,0xA1,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x44,0x21,0x71,0x8C,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0x12,0x95,0xB2,0x94,0x71,0x8C,0x30,0x84,0xEF,0x7B,0x8E,0x73,0x4D,0x6B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0xF7,0xBD,0x71,0x8C,0x71,0x8C,0x38,0xC6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x1C,0xE7,
-	0x07,0x3A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x81,0x08,0x71,0x8C,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x13,0x9D,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xAE,0x73,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x58,0xC6,0x69,0x4A,0x61,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x51,0x8C,0x99,0xCE,0x99,0xCE,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x44,0x21,0xD7,0xBD,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x75,0xAD,0x54,0xA5,0x13,0x9D,0xF2,0x94,0xB2,0x94,0x50,0x84,0x10,0x84,0xAE,0x73,0x4D,0x6B,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0xF7,0xBD,0x50,0x84,0xD2,0x94,0xD2,0x94,0x71,0x8C,0x17,0xBE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x1C,0xE7,
-	0x07,0x3A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x07,0x3A,0x9A,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x13,0x9D,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xAE,0x73,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x95,0xAD,0x03,0x19,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0x07,0x3A,0x99,0xCE,0x99,0xCE,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCF,0x7B,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x10,0x84,0xCE,0x73,0x8D,0x6B,0x03,0x19,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF7,0xBD,0x17,0xBE,0x58,0xC6,0x58,0xC6,0x91,0x8C,0xF2,0x94,0x78,0xC6,0x78,0xC6,0xF2,0x94,0x91,0x8C,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x1C,0xE7,
-	0x68,0x42,0xE3,0x18,0xE3,0x18,0xA2,0x10,0x81,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x59,0xCE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x61,0x08,0xAE,0x73,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDA,0xD6,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x54,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE2,0x10,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x75,0xAD,0x24,0x21,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x37,0xBE,0x17,0xBE,0xD6,0xB5,0xB6,0xB5,0x75,0xAD,0x54,0xA5,0x12,0x95,0xB2,0x94,0x71,0x8C,0x30,0x84,0xCF,0x7B,0xAE,0x73,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x58,0xC6,0x78,0xC6,0xF6,0xB5,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x17,0xBE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x8A,0x52,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xF3,0x9C,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD7,0xBD,0xAD,0x6B,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xBA,0xD6,0xBA,0xD6,0x79,0xCE,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0x0C,0x63,0x81,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x91,0x8C,0x50,0x84,0x0F,0x7C,0xCE,0x73,0x65,0x29,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0xD7,0xBD,0xF7,0xBD,0x17,0xBE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x74,0xA5,0xB5,0xAD,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xF7,0xBD,0xFB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x78,0xC6,0x58,0xC6,0x37,0xBE,0xF7,0xBD,0xD6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x51,0x8C,0x0F,0x7C,0xCF,0x7B,0x86,0x31,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x00,0x00,0xD7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x34,0xA5,0x30,0x84,0x30,0x84,0x95,0xAD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x58,0xC6,0x34,0xA5,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xD3,0x9C,0xD2,0x94,0xD2,0x94,0x95,0xAD,0x17,0xBE,0xD6,0xB5,0x96,0xB5,0x75,0xAD,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x30,0x84,0xEF,0x7B,0xA6,0x31,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0xD7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x54,0xA5,0x30,0x84,0x95,0xAD,0x54,0xA5,0x50,0x84,0x95,0xAD,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xF7,0xBD,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x91,0x8C,0xD7,0xBD,0xB6,0xB5,0x75,0xAD,0x33,0x9D,0xF2,0x94,0xD2,0x94,0x71,0x8C,0x30,0x84,0xEF,0x7B,0xE7,0x39,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x38,0xC6,0x91,0x8C,0xB6,0xB5,0x99,0xCE,0x99,0xCE,0xB6,0xB5,0xB2,0x94,0x79,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x30,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0xD6,0xB5,0xB6,0xB5,0x75,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x91,0x8C,0x30,0x84,0xEF,0x7B,0xE7,0x39,0x00,0x00,0x00,0x00,0x82,0x10,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0x8E,0x73,0x81,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x8D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x21,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x92,0x94,0x30,0x84,0xEF,0x7B,0xE7,0x39,0x00,0x00,0x00,0x00,0x61,0x08,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBB,0xDE,0xBB,0xDE,0xBB,0xDE,0xBB,0xDE,0xBB,0xDE,0xBA,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xDB,0xDE,0x6D,0x6B,0x81,0x08,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x21,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x92,0x94,0x30,0x84,0x10,0x84,0x49,0x4A,0x00,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x54,0xA5,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x03,0x19,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x8A,0x52,0x41,0x08,0x82,0x10,0xEB,0x5A,0x24,0x21,0x20,0x00,0x07,0x3A,0xAA,0x52,0x41,0x08,0x00,0x00,0x00,0x00,0x44,0x21,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0x92,0x94,0x30,0x84,0x10,0x84,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x95,0xAD,0x28,0x42,0x28,0x42,0x28,0x42,0x4C,0x63,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x8D,0x6B,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x8E,0x73,0x00,0x00,0x00,0x00,0x81,0x08,0xD6,0xB5,0xBA,0xD6,0xE7,0x39,0x4D,0x6B,0xBA,0xD6,0x92,0x94,0xC2,0x10,0xB6,0xB5,0x59,0xCE,0x86,0x31,0x00,0x00,0x00,0x00,0x44,0x21,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x30,0x84,0x10,0x84,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xB6,0xB5,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xCE,0x73,0xFB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x28,0x42,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xE3,0x18,0x75,0xAD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0x63,0x91,0x8C,0x82,0x10,0x65,0x29,0xD2,0x94,0x49,0x4A,0x41,0x08,0x8D,0x6B,0x50,0x84,0x82,0x10,0x00,0x00,0x00,0x00,0x44,0x21,0xD6,0xB5,0xD6,0xB5,0x95,0xAD,0x74,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x50,0x84,0x10,0x84,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x60,0x00,0xAE,0x73,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x28,0x42,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA1,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xAE,0x73,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x21,0xD6,0xB5,0xD6,0xB5,0x95,0xAD,0x74,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x50,0x84,0x10,0x84,0x8A,0x52,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x33,0x9D,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x28,0x42,0x27,0x3A,0x27,0x3A,0x27,0x3A,0x27,0x3A,0x27,0x3A,0x27,0x3A,0x27,0x3A,0x28,0x42,0x24,0x21,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0x81,0x08,0x81,0x08,0x81,0x08,0x07,0x3A,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0x07,0x3A,0xAA,0x52,0xD2,0x94,0xFB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x21,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x10,0x84,0x8A,0x52,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x55,0xAD,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xF7,0xBD,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x50,0x84,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x99,0xCE,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xEF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x0F,0x7C,0xCB,0x5A,0x20,0x00,0x00,0x00,0x61,0x08,
-	0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0xF7,0xBD,0x38,0xC6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x17,0xBE,0x86,0x31,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0xBB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xD7,0xBD,0x86,0x31,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xC3,0x18,0x30,0x84,0x17,0xBE,0xD6,0xB5,0xB6,0xB5,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x10,0x84,0xCB,0x5A,0x20,0x00,0x00,0x00,0x82,0x10,
-	0x00,0x00,0xD7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0xD6,0xB5,0x30,0x84,0x71,0x8C,0xF7,0xBD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x14,0xA5,0xE3,0x18,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0xBB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x38,0xC6,0x34,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xD2,0x94,0x85,0x29,0x00,0x00,0x20,0x00,0x0F,0x7C,0xD3,0x9C,0xD2,0x94,0x75,0xAD,0x38,0xC6,0x17,0xBE,0xD6,0xB5,0xB6,0xB5,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x30,0x84,0xCB,0x5A,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0xD7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0xD6,0xB5,0x50,0x84,0xF3,0x9C,0xF3,0x9C,0x51,0x8C,0xF7,0xBD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFB,0xDE,0x75,0xAD,0x69,0x4A,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0x64,0x21,0xE2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0xBB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x37,0xBE,0x49,0x4A,0x40,0x00,0x75,0xAD,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x17,0xBE,0x17,0xBE,0xD6,0xB5,0xB6,0xB5,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x10,0x84,0xCB,0x5A,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0xD7,0xBD,0xF7,0xBD,0x17,0xBE,0x58,0xC6,0x37,0xBE,0x91,0x8C,0x33,0x9D,0x79,0xCE,0x78,0xC6,0x34,0xA5,0x71,0x8C,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,
-	0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0x38,0xC6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x9A,0xD6,0xAA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0xBB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x58,0xC6,0xCE,0x73,0xB6,0xB5,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x17,0xBE,0x17,0xBE,0xD6,0xB5,0xB6,0xB5,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0xEF,0x7B,0xCB,0x5A,0x20,0x00,0x00,0x00,0x61,0x08,
-	0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x58,0xC6,0x58,0xC6,0x17,0xBE,0x99,0xCE,0x98,0xC6,0x98,0xC6,0x99,0xCE,0x38,0xC6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,
-	0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xEB,0x5A,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x44,0x21,0xF7,0xBD,0x9A,0xD6,0x9A,0xD6,0x9A,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xA1,0x08,0xD7,0xBD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x51,0x8C,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x65,0x29,0x9A,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x17,0xBE,0x17,0xBE,0xD6,0xB5,0x96,0xB5,0x74,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x50,0x84,0xEF,0x7B,0x8A,0x52,0x20,0x00,0x00,0x00,0x20,0x00,
-	0x00,0x00,0xB5,0xAD,0xF7,0xBD,0x17,0xBE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x54,0xA5,0x75,0xAD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x9A,0xD6,0xEB,0x5A,
-	0xE7,0x39,0xE7,0x39,0xE7,0x39,0x24,0x21,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xC2,0x10,0xC6,0x31,0xE7,0x39,0xE7,0x39,0x2C,0x63,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA1,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x48,0x42,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0xC6,0x31,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0xE2,0x10,0x69,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0x89,0x4A,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0x95,0xAD,0x74,0xA5,0x33,0x9D,0xF2,0x94,0x92,0x94,0x30,0x84,0x10,0x84,0x49,0x4A,0x00,0x00,0x00,0x00,0x40,0x00,
-	0x00,0x00,0xB6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x34,0xA5,0x30,0x84,0x30,0x84,0x55,0xAD,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x9A,0xD6,0xE7,0x39,
-	0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x07,0x3A,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x58,0xC6,0x54,0xA5,0x54,0xA5,0x54,0xA5,0xB6,0xB5,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x75,0xAD,0xC2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0x45,0x29,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0x92,0x94,0x30,0x84,0x10,0x84,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x34,0xA5,0x30,0x84,0xB6,0xB5,0x95,0xAD,0x30,0x84,0x34,0xA5,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x9A,0xD6,0xE7,0x39,
-	0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x28,0x42,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xC2,0x10,0xC2,0x10,0xC2,0x10,0x48,0x42,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x17,0xBE,0x85,0x29,0x81,0x08,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,
-	0xA2,0x10,0xA2,0x10,0x81,0x08,0x4C,0x63,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xA2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x92,0x94,0x30,0x84,0xEF,0x7B,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x37,0xBE,0xB2,0x94,0xB6,0xB5,0x99,0xCE,0x99,0xCE,0xB6,0xB5,0xB2,0x94,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0x9A,0xD6,0xE7,0x39,
-	0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x07,0x3A,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xFB,0xDE,0xCA,0x52,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x28,0x42,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x91,0x8C,0xC2,0x10,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,
-	0x81,0x08,0x81,0x08,0x85,0x29,0xF7,0xBD,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x91,0x8C,0x30,0x84,0xCF,0x7B,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x78,0xC6,0x78,0xC6,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xDB,0xDE,0xCA,0x52,
-	0xC6,0x31,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xC6,0x31,0x85,0x29,0x65,0x29,0x65,0x29,0xCA,0x52,0xBA,0xD6,0xBA,0xD6,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0xFB,0xDE,0x1C,0xE7,0x2C,0x63,0xE3,0x18,
-	0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x28,0x42,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xF3,0x9C,0xE7,0x39,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE2,0x10,0xC2,0x10,0xC2,0x10,
-	0x03,0x19,0xCB,0x5A,0xD7,0xBD,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xC2,0x10,0xC2,0x10,0xC2,0x10,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xD7,0xBD,0xB6,0xB5,0x75,0xAD,0x34,0xA5,0x13,0x9D,0xD2,0x94,0x71,0x8C,0x30,0x84,0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x38,0xC6,0x79,0xCE,0x58,0xC6,0xB2,0x94,0xF2,0x94,0x78,0xC6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x34,0xA5,0xA2,0x10,0xA2,0x10,0xA2,0x10,0x28,0x42,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xD6,0xB5,0x96,0xB5,0x75,0xAD,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x10,0x84,0x49,0x4A,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x91,0x8C,0x71,0x8C,0x71,0x8C,0xB2,0x94,0x79,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x79,0xCE,0x96,0xB5,0x96,0xB5,0x96,0xB5,0xD7,0xBD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x37,0xBE,0xF7,0xBD,0xD6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB1,0x8C,0x51,0x8C,0xEF,0x7B,0x44,0x21,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xD7,0xBD,0xD7,0xBD,0x17,0xBE,0x17,0xBE,0xB1,0x8C,0x91,0x8C,0x38,0xC6,0x37,0xBE,0x92,0x94,0xD2,0x94,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xF6,0xB5,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x91,0x8C,0x50,0x84,0x6D,0x6B,0x61,0x08,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x95,0xAD,0xD6,0xB5,0x17,0xBE,0x17,0xBE,0x75,0xAD,0x18,0xC6,0x99,0xCE,0x99,0xCE,0x58,0xC6,0x95,0xAD,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x17,0xBE,0x17,0xBE,0xF6,0xB5,0x96,0xB5,0x74,0xA5,0x54,0xA5,0x12,0x95,0xB2,0x94,0x71,0x8C,0x30,0x84,0x48,0x42,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xD2,0x94,0xB2,0x94,0x50,0x84,0xAE,0x73,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xDB,0xDE,0xDB,0xDE,0xDB,0xDE,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x91,0x8C,0x30,0x84,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xB5,0xAD,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,
-	0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x98,0xC6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0x95,0xAD,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x71,0x8C,0x4C,0x63,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xDB,0xDE,0xB6,0xB5,0xB6,0xB5,0xDB,0xDE,0x95,0xAD,0xF3,0x9C,0xD3,0x9C,0x96,0xB5,0xBA,0xD6,0x14,0xA5,0x75,0xAD,0x9A,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x30,0x84,
-	0xC7,0x39,0xC7,0x39,0xC7,0x39,0xC6,0x31,0x0B,0x5B,0x78,0xC6,0x99,0xCE,0x58,0xC6,0xE7,0x39,0xC6,0x31,0xC6,0x31,0xC6,0x31,0x08,0x42,0xB5,0xAD,0x99,0xCE,0x99,0xCE,0x10,0x84,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xAE,0x73,0x99,0xCE,0x99,0xCE,0xD6,0xB5,0x28,0x42,0xC6,0x31,0xC6,0x31,0xC6,0x31,0x07,0x3A,0xD7,0xBD,0x99,0xCE,
-	0x79,0xCE,0x0B,0x5B,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xC6,0x31,0xEF,0x7B,0x79,0xCE,0x99,0xCE,0x17,0xBE,0xD3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x34,0xA5,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x54,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF7,0xBD,0x99,0xCE,0x99,0xCE,0x17,0xBE,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x54,0xA5,
-	0x99,0xCE,0x99,0xCE,0x79,0xCE,0x14,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF7,0xBD,0x99,0xCE,0x99,0xCE,0xB6,0xB5,0xD3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x74,0xA5,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x17,0xBE,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x17,0xBE,0x79,0xCE,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x75,0xAD,0x54,0xA5,0x12,0x95,0xD2,0x94,0x91,0x8C,0x0F,0x7C,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x13,0x9D,0x0B,0x5B,0x0B,0x5B,0x14,0xA5,0x13,0x9D,0x30,0x84,0xEB,0x5A,0x6D,0x6B,0xB2,0x94,0x10,0x84,0xEB,0x5A,0x55,0xAD,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xB2,0x94,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xF7,0xBD,0x99,0xCE,0x99,0xCE,0x85,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0x99,0xCE,0x99,0xCE,0x50,0x84,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x79,0xCE,0x79,0xCE,0xF7,0xBD,0x03,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x8C,0x79,0xCE,
-	0x79,0xCE,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0x59,0xCE,0x79,0xCE,0x38,0xC6,0x91,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x71,0x8C,0x18,0xC6,0x79,0xCE,0x79,0xCE,0x54,0xA5,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x54,0xA5,0x79,0xCE,0x79,0xCE,0x17,0xBE,0x71,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x71,0x8C,
-	0x38,0xC6,0x79,0xCE,0x79,0xCE,0xF3,0x9C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x75,0xAD,0x79,0xCE,0x79,0xCE,0xD6,0xB5,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x92,0x94,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0xF3,0x9C,0xEF,0x7B,0x92,0x94,0x2C,0x63,0x13,0x9D,0x38,0xC6,
-	0x79,0xCE,0x38,0xC6,0x58,0xC6,0x18,0xC6,0x18,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x59,0xCE,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x38,0xC6,0xF7,0xBD,0xD7,0xBD,0xB6,0xB5,0x54,0xA5,0x33,0x9D,0xF2,0x94,0xB2,0x94,0x30,0x84,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF6,0xB5,0x17,0xBE,0x38,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x0B,0x5B,0xD7,0xBD,0xD7,0xBD,0x0B,0x5B,0xDB,0xDE,0x9A,0xD6,0x6E,0x73,0x79,0xCE,0xBA,0xD6,0xFB,0xDE,0xB2,0x94,0x0F,0x7C,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x37,0xBE,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x34,0xA5,0x99,0xCE,0x99,0xCE,0x4C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x99,0xCE,0x79,0xCE,0x75,0xAD,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x74,0xA5,0x79,0xCE,0x58,0xC6,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x58,0xC6,
-	0x79,0xCE,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xD6,0xB5,0x79,0xCE,0x79,0xCE,0xD3,0x9C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x95,0xAD,0x79,0xCE,0x79,0xCE,0xD6,0xB5,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xB2,0x94,0x58,0xC6,0x79,0xCE,0x38,0xC6,0x92,0x94,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,
-	0xB5,0xAD,0x79,0xCE,0x79,0xCE,0x75,0xAD,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xD2,0x94,0x58,0xC6,0x79,0xCE,0x58,0xC6,0x71,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x71,0x8C,0xF6,0xB5,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x13,0x9D,0x34,0xA5,0x79,0xCE,0x0F,0x7C,0x92,0x94,0x30,0x84,
-	0x18,0xC6,0x10,0x84,0xF7,0xBD,0xCE,0x73,0xEF,0x7B,0x71,0x8C,0x91,0x8C,0xF7,0xBD,0x79,0xCE,0x58,0xC6,0x50,0x84,0xEF,0x7B,0x30,0x84,0xF6,0xB5,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x96,0xB5,0x54,0xA5,0xF2,0x94,0xD2,0x94,0x71,0x8C,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0xAA,0x52,0x59,0xCE,0x39,0xCE,0xAA,0x52,0xDB,0xDE,0xB6,0xB5,0x71,0x8C,0xFB,0xDE,0xBA,0xD6,0xBA,0xD6,0x4D,0x6B,0x96,0xB5,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x07,0x3A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x73,0x99,0xCE,0x99,0xCE,0xB2,0x94,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x17,0xBE,0x58,0xC6,0xF7,0xBD,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0x7B,0x58,0xC6,0x58,0xC6,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x21,0x17,0xBE,
-	0x58,0xC6,0xD6,0xB5,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xD2,0x94,0x58,0xC6,0x38,0xC6,0x75,0xAD,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x13,0x9D,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x91,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xF7,0xBD,0x38,0xC6,0x37,0xBE,0x13,0x9D,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,
-	0x14,0xA5,0x38,0xC6,0x38,0xC6,0xD6,0xB5,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x91,0x8C,0x17,0xBE,0x38,0xC6,0x58,0xC6,0xF3,0x9C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x75,0xAD,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0xF3,0x9C,0x13,0x9D,0x58,0xC6,0xEF,0x7B,0xD2,0x94,0xAE,0x73,
-	0xF3,0x9C,0x91,0x8C,0xF7,0xBD,0x0F,0x7C,0x74,0xA5,0x30,0x84,0x30,0x84,0x10,0x84,0xB2,0x94,0x75,0xAD,0xAE,0x73,0xD6,0xB5,0x71,0x8C,0x96,0xB5,0xB6,0xB5,0xB6,0xB5,0x75,0xAD,0x54,0xA5,0x13,0x9D,0xD2,0x94,0x30,0x84,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD7,0xBD,0x17,0xBE,0x37,0xBE,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0xCA,0x52,0x18,0xC6,0x18,0xC6,0xCB,0x5A,0xFB,0xDE,0xD2,0x94,0x34,0xA5,0xDB,0xDE,0xFB,0xDE,0xD3,0x9C,0x91,0x8C,0xDB,0xDE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x3A,0x99,0xCE,0x58,0xC6,0x95,0xAD,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xF3,0x9C,0x38,0xC6,0x37,0xBE,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x18,0xC6,0x38,0xC6,0xF3,0x9C,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x75,0xAD,
-	0x38,0xC6,0x58,0xC6,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0x58,0xC6,0x38,0xC6,0xB6,0xB5,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x92,0x94,0x17,0xBE,0x38,0xC6,0x17,0xBE,0xB2,0x94,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x74,0xA5,0x38,0xC6,0x38,0xC6,0x74,0xA5,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,
-	0xB2,0x94,0x37,0xBE,0x38,0xC6,0x17,0xBE,0x91,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xB6,0xB5,0x38,0xC6,0x38,0xC6,0x54,0xA5,0x51,0x8C,0x51,0x8C,0x51,0x8C,0x51,0x8C,0xF2,0x94,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0xD2,0x94,0x13,0x9D,0x38,0xC6,0xEF,0x7B,0xD2,0x94,0x92,0x94,
-	0x2C,0x63,0x54,0xA5,0x95,0xAD,0x30,0x84,0x74,0xA5,0x30,0x84,0x30,0x84,0x34,0xA5,0x30,0x84,0x91,0x8C,0xAE,0x73,0xD6,0xB5,0xF3,0x9C,0xB5,0xAD,0xB6,0xB5,0x75,0xAD,0x34,0xA5,0xF3,0x9C,0xD2,0x94,0x8D,0x6B,0xE2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0xB1,0x8C,0xCE,0x73,0xCE,0x73,0xB2,0x94,0xFB,0xDE,0x30,0x84,0xB6,0xB5,0xDB,0xDE,0xF3,0x9C,0x48,0x42,0xF3,0x9C,0x95,0xAD,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,
-	0x13,0x9D,0xC3,0x18,0x82,0x10,0x82,0x10,0x82,0x10,0x24,0x21,0xD6,0xB5,0x58,0xC6,0x17,0xBE,0xA6,0x31,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x8D,0x6B,0x17,0xBE,0x17,0xBE,0xCF,0x7B,0x82,0x10,0x82,0x10,0x82,0x10,0x82,0x10,0x65,0x29,0xB6,0xB5,0x17,0xBE,0xD6,0xB5,0x45,0x29,0x61,0x08,0x61,0x08,0x61,0x08,0xA2,0x10,0x71,0x8C,
-	0x17,0xBE,0x17,0xBE,0xAE,0x73,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x28,0x42,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0x92,0x94,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0xB5,0xAD,0x17,0xBE,0x17,0xBE,0x13,0x9D,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0xF3,0x9C,0xF7,0xBD,0x17,0xBE,0xB5,0xAD,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,
-	0x91,0x8C,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x13,0x9D,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x34,0xA5,0x17,0xBE,0x17,0xBE,0x95,0xAD,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x92,0x94,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF6,0xB5,0xD2,0x94,0x13,0x9D,0x17,0xBE,0x0F,0x7C,0xD2,0x94,0x95,0xAD,
-	0x2C,0x63,0xB6,0xB5,0x50,0x84,0xB2,0x94,0x54,0xA5,0x30,0x84,0x30,0x84,0xEF,0x7B,0xCF,0x7B,0x54,0xA5,0xEF,0x7B,0xCE,0x73,0xEF,0x7B,0x96,0xB5,0x95,0xAD,0x33,0x9D,0xF2,0x94,0x30,0x84,0x69,0x4A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0xD6,0xB5,0xF7,0xBD,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x79,0xCE,0x95,0xAD,0xB6,0xB5,0x99,0xCE,0xBA,0xD6,0x38,0xC6,0x99,0xCE,0xBA,0xD6,0xD6,0xB5,0x74,0xA5,0x95,0xAD,0xD6,0xB5,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,
-	0x58,0xC6,0x95,0xAD,0x75,0xAD,0x74,0xA5,0x75,0xAD,0x55,0xAD,0x17,0xBE,0x38,0xC6,0x17,0xBE,0x74,0xA5,0x34,0xA5,0x34,0xA5,0x34,0xA5,0x14,0xA5,0x75,0xAD,0xD7,0xBD,0xD6,0xB5,0xB6,0xB5,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x14,0xA5,0x34,0xA5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0x34,0xA5,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x75,0xAD,
-	0xD6,0xB5,0xD6,0xB5,0x95,0xAD,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0xF3,0x9C,0x33,0x9D,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0xB5,0xAD,0xD6,0xB5,0xD6,0xB5,0xB5,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,
-	0x95,0xAD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB5,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0xB5,0xAD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0x75,0xAD,0x95,0xAD,0xB2,0x94,
-	0xEF,0x7B,0xB6,0xB5,0x75,0xAD,0xB5,0xAD,0xB5,0xAD,0x75,0xAD,0x95,0xAD,0x54,0xA5,0x75,0xAD,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x95,0xAD,0xB6,0xB5,0x34,0xA5,0x0F,0x7C,0x28,0x42,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0xBA,0xD6,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,
-	0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x96,0xB5,
-	0x96,0xB5,0x96,0xB5,0x96,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x75,0xAD,0x10,0x84,
-	0x34,0xA5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0x75,0xAD,0x54,0xA5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x34,0xA5,0x91,0x8C,0xAE,0x73,0xC7,0x39,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0xB9,0xCE,0xB9,0xCE,0xBA,0xD6,0xBA,0xD6,0xB9,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x58,0xC6,
-	0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x74,0xA5,0xF3,0x9C,0xD2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,
-	0xB2,0x94,0xB2,0x94,0xB2,0x94,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,
-	0x50,0x84,0x50,0x84,0x50,0x84,0x50,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0x10,0x84,0xEF,0x7B,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xCE,0x73,0xAE,0x73,0x8D,0x6B,0x8D,0x6B,0xAE,0x73,0x8D,0x6B,0x8E,0x73,
-	0xAE,0x73,0xAE,0x73,0x6D,0x6B,0x2C,0x63,0x0C,0x63,0x0B,0x5B,0x0C,0x63,0x0C,0x63,0x0B,0x5B,0xAA,0x52,0xA6,0x31,0xE3,0x18,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x9D,0xD6,0xB5,0x17,0xBE,0x37,0xBE,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0x99,0xCE,0x99,0xCE,0x17,0xBE,0x34,0xA5,0xD7,0xBD,0x79,0xCE,0x95,0xAD,0x95,0xAD,0x58,0xC6,0x99,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,
-	0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x91,0x8C,0x4C,0x63,0xE7,0x39,0x03,0x19,0xA2,0x10,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,0x61,0x08,
-	0x61,0x08,0x61,0x08,0x41,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x99,0xCE,0xF7,0xBD,0x65,0x29,0x61,0x08,0x03,0x19,0x07,0x3A,0xA2,0x10,0x82,0x10,0xCB,0x5A,0x58,0xC6,0x79,0xCE,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,
-	0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x96,0xB5,0xB6,0xB5,0x13,0x9D,0xEB,0x5A,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x99,0xCE,0x8D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x00,0x00,0x00,0x00,0xA2,0x10,0x96,0xB5,0x79,0xCE,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,
-	0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0xB2,0x94,0x89,0x4A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,
-	0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,
-	0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,
-	0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0x03,0x19,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x79,0xCE,0x6D,0x6B,0x00,0x00,0x41,0x08,0x44,0x21,0x8D,0x6B,0x00,0x00,0x00,0x00,0x82,0x10,0x95,0xAD,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,
-	0x95,0xAD,0x95,0xAD,0xF3,0x9C,0x69,0x4A,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x8D,0x6B,0x95,0xAD,0xD5,0xAD,0xD5,0xAD,0xD6,0xB5,0xB6,0xB5,0x0F,0x7C,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,
-	0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,
-	0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0xEF,0x7B,0xB5,0xAD,0xD5,0xAD,0xD5,0xAD,
-	0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0xD5,0xAD,0x13,0x9D,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xD6,0xB5,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x78,0xC6,0x0F,0x7C,0x04,0x21,0x49,0x4A,0xB2,0x94,0xB1,0x8C,0xA2,0x10,0x04,0x21,0x28,0x42,0x17,0xBE,0x38,0xC6,0x17,0xBE,0x17,0xBE,0xF6,0xB5,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x95,0xAD,
-	0x34,0xA5,0xAD,0x6B,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xA6,0x31,0x13,0x9D,0x17,0xBE,0x13,0x9D,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x0B,0x5B,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,
-	0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,
-	0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x8A,0x52,0x0B,0x5B,0x50,0x84,0x70,0x84,0x70,0x84,
-	0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x70,0x84,0x8D,0x6B,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x18,0xC6,0x30,0x84,0xA6,0x31,0x8A,0x52,0x69,0x4A,0xAE,0x73,0xEB,0x5A,0xCE,0x73,0xD2,0x94,0x17,0xBE,0x17,0xBE,0xF6,0xB5,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0xD2,0x94,
-	0xC7,0x39,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xEF,0x7B,0xF6,0xB5,0xF6,0xB5,0x2C,0x63,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x78,0xC6,0x75,0xAD,0x86,0x31,0x00,0x00,0x41,0x08,0x85,0x29,0x50,0x84,0xF7,0xBD,0xF6,0xB5,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0xB5,0xAD,0x75,0xAD,0x54,0xA5,0xEE,0x73,0xC2,0x10,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x07,0x3A,0x54,0xA5,0x17,0xBE,0xB1,0x8C,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xD6,0xB5,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x58,0xC6,0x58,0xC6,0xF7,0xBD,0xEB,0x5A,0x65,0x29,0x34,0xA5,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0x34,0xA5,0x8A,0x52,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x30,0x84,0xF7,0xBD,0xB5,0xAD,0xAA,0x52,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0xF7,0xBD,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0xF3,0x9C,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x04,0x21,0xE7,0x39,0x0B,0x5B,0x75,0xAD,0x17,0xBE,0xD5,0xAD,0x49,0x4A,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0xF7,0xBD,0xD6,0xB5,0xB6,0xB5,0x96,0xB5,0x95,0xAD,0x75,0xAD,0xB1,0x8C,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x89,0x4A,0xD2,0x94,0xD6,0xB5,0x37,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x37,0xBE,0xD6,0xB5,0xF2,0x94,0xEB,0x5A,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD7,0xBD,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x71,0x8C,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x45,0x29,0xD2,0x94,0x37,0xBE,0xB5,0xAD,0x70,0x84,0xEB,0x5A,0x07,0x3A,0xA6,0x31,0xC7,0x39,0xCA,0x52,0x2F,0x7C,0x95,0xAD,0x37,0xBE,0x13,0x9D,0xA6,0x31,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x45,0x29,0x0C,0x63,0x28,0x42,0x20,0x00,0x20,0x00,0x86,0x31,0x2C,0x63,0xCB,0x5A,0xA2,0x10,0x00,0x00,0x00,0x00,0x07,0x3A,0x4C,0x63,0x4D,0x6B,0x4D,0x6B,0x0B,0x5B,0x20,0x00,0x85,0x29,0x2C,0x63,0xCB,0x5A,0x03,0x19,0x00,0x00,0xC3,0x18,0x2C,0x63,0x2C,0x63,0x4C,0x63,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x95,0xAD,0x74,0xA5,0x54,0xA5,0x30,0x84,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x49,0x4A,0x95,0xAD,0x17,0xBE,0x8D,0x6B,0x04,0x21,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x0B,0x5B,0xD6,0xB5,0xD6,0xB5,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x24,0x21,0x13,0x9D,0x69,0x4A,0x51,0x8C,0x69,0x4A,0xC3,0x18,0x0F,0x7C,0x69,0x4A,0x50,0x84,0x30,0x84,0x41,0x08,0x00,0x00,0x65,0x29,0x69,0x4A,0x49,0x4A,0x0F,0x7C,0x30,0x84,0x82,0x10,0x8D,0x6B,0x48,0x42,0xAE,0x73,0xF3,0x9C,0x82,0x10,0x69,0x4A,0x91,0x8C,0x49,0x4A,0x49,0x4A,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x86,0x31,0x20,0x00,0xC3,0x18,0x24,0x21,0x00,0x00,0x86,0x31,0x61,0x08,0x00,0x00,0xE3,0x18,0x86,0x31,0x00,0x00,0x20,0x00,0xC6,0x31,0xC7,0x39,0xC7,0x39,0x45,0x29,0xA6,0x31,0x81,0x08,0x00,0x00,0x04,0x21,0x03,0x19,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xAD,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x96,0xB5,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x33,0x9D,0x30,0x84,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xC6,0x31,0xD6,0xB5,0x95,0xAD,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x74,0xA5,0x17,0xBE,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x6D,0x6B,0xEF,0x7B,0x00,0x00,0x65,0x29,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x55,0xAD,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x71,0x8C,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x75,0xAD,0xE3,0x18,0xCA,0x52,0x2C,0x63,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE7,0x39,0x40,0x00,0x03,0x19,0xA6,0x31,0x00,0x00,0x08,0x42,0x82,0x10,0x00,0x00,0xC7,0x39,0x49,0x4A,0x61,0x08,0x41,0x08,0x28,0x42,0xA2,0x10,0x40,0x00,0x20,0x00,0x08,0x42,0xA2,0x10,0x61,0x08,0x8A,0x52,0x65,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x75,0xAD,0x55,0xAD,0x54,0xA5,0x54,0xA5,0x30,0x84,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,
-	0x75,0xAD,0xB6,0xB5,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x95,0xAD,0x95,0xAD,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x71,0x8C,0x0B,0x5B,0x00,0x00,0x04,0x21,0x95,0xAD,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x13,0x9D,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0x30,0x84,0x20,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xB2,0x94,0x2C,0x63,0x20,0x00,0x0C,0x63,0xF3,0x9C,0x92,0x94,0x0F,0x7C,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE7,0x39,0x40,0x00,0x03,0x19,0xA6,0x31,0x00,0x00,0x08,0x42,0x82,0x10,0x61,0x08,0xC7,0x39,0x24,0x21,0xE3,0x18,0x41,0x08,0x28,0x42,0x61,0x08,0x00,0x00,0x00,0x00,0x08,0x42,0xC2,0x10,0xE7,0x39,0xC7,0x39,0x45,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x33,0x9D,0x50,0x84,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xEF,0x7B,
-	0x17,0xBE,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x17,0xBE,0x50,0x84,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xB2,0x94,0xEB,0x5A,0x00,0x00,0x03,0x19,0xB6,0xB5,0x00,0x00,0x00,0x00,0x61,0x08,0xB2,0x94,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xB2,0x94,0x28,0x42,0x00,0x00,0x00,0x00,0x20,0x00,0x4C,0x63,0xF3,0x9C,0x4D,0x6B,0x41,0x08,0x81,0x08,0xA2,0x10,0xC3,0x18,0xF3,0x9C,0x8E,0x73,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE7,0x39,0x40,0x00,0x03,0x19,0xA6,0x31,0x00,0x00,0x08,0x42,0x82,0x10,0x03,0x19,0xE7,0x39,0x24,0x21,0xE7,0x39,0x41,0x08,0x28,0x42,0x61,0x08,0x00,0x00,0x00,0x00,0x08,0x42,0x86,0x31,0xC7,0x39,0xC3,0x18,0x45,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x7C,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x33,0x9D,0x50,0x84,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xB6,0xB5,
-	0xB2,0x94,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x13,0x9D,0xD6,0xB5,0x50,0x84,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x0F,0x7C,0x17,0xBE,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0F,0x7C,0x8D,0x6B,0x00,0x00,0x24,0x21,0x14,0xA5,0x00,0x00,0x00,0x00,0x2C,0x63,0x0F,0x7C,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x34,0xA5,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x34,0xA5,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x6B,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE7,0x39,0x20,0x00,0x03,0x19,0xA6,0x31,0x00,0x00,0x08,0x42,0x82,0x10,0xE7,0x39,0x86,0x31,0x65,0x29,0x49,0x4A,0xA2,0x10,0x28,0x42,0x61,0x08,0x00,0x00,0x00,0x00,0x07,0x3A,0x69,0x4A,0x82,0x10,0xC3,0x18,0x45,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x13,0x9D,0x12,0x95,0xF2,0x94,0x70,0x84,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,0x37,0xBE,
-	0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xAA,0x52,0xCA,0x52,0xA2,0x10,0x00,0x00,0x69,0x4A,0x58,0xC6,0x58,0xC6,0x78,0xC6,0x4C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xF6,0xB5,0xEF,0x7B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x28,0x42,0xF3,0x9C,0xE3,0x18,0xEB,0x5A,0x8E,0x73,0x20,0x00,0xEB,0x5A,0x55,0xAD,0x65,0x29,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x54,0xA5,0x61,0x08,0x00,0x00,0x82,0x10,0xC6,0x31,0xC3,0x18,0x24,0x21,0x75,0xAD,0x45,0x29,0x28,0x42,0x03,0x19,0x04,0x21,0xF3,0x9C,0x0C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE7,0x39,0xC7,0x39,0x07,0x3A,0x28,0x42,0xC7,0x39,0x28,0x42,0xC2,0x10,0xE7,0x39,0x20,0x00,0x00,0x00,0x45,0x29,0x65,0x29,0xE7,0x39,0x61,0x08,0x00,0x00,0x00,0x00,0xC7,0x39,0x65,0x29,0x00,0x00,0xC2,0x10,0x24,0x21,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x94,0xD2,0x94,0x91,0x8C,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x8C,0xD6,0xB5,
-	0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xB2,0x94,0x58,0xC6,0x58,0xC6,0x30,0x84,0x41,0x08,0xAA,0x52,0x38,0xC6,0x58,0xC6,0x58,0xC6,0xD2,0x94,0x41,0x08,0x00,0x00,0x00,0x00,0x82,0x10,0x34,0xA5,0x33,0x9D,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x0C,0x63,0xF3,0x9C,0x10,0x84,0xC3,0x18,0x24,0x21,0xB6,0xB5,0x75,0xAD,0x34,0xA5,0x34,0xA5,0x24,0x21,0x00,0x00,0x00,0x00,0x03,0x19,0x30,0x84,0x00,0x00,0x00,0x00,0x82,0x10,0xCE,0x73,0x13,0x9D,0xD2,0x94,0xAA,0x52,0x20,0x00,0xCA,0x52,0xD2,0x94,0xF3,0x9C,0x2C,0x63,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x20,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x8C,0x48,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x74,0xA5,0xB2,0x94,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x33,0x9D,0x61,0x08,0xA6,0x31,0x38,0xC6,0x58,0xC6,0x58,0xC6,0xB2,0x94,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x51,0x8C,0xB5,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xD6,0xB5,0xEF,0x7B,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x4A,0x58,0xC6,0x58,0xC6,0x58,0xC6,0xB2,0x94,0x41,0x08,0xC3,0x18,0xB5,0xAD,0x58,0xC6,0x78,0xC6,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xAE,0x73,0xF6,0xB5,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0xF6,0xB5,0xEF,0x7B,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x38,0xC6,0x58,0xC6,0x78,0xC6,0x0C,0x63,0x00,0x00,0x20,0x00,0xEE,0x73,0xB5,0xAD,0x95,0xAD,0x89,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x73,0xF6,0xB5,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x95,0xAD,0x71,0x8C,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0x38,0xC6,0x79,0xCE,0x17,0xBE,0xC3,0x18,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xA2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x30,0x84,0xD5,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD2,0x94,0xB5,0xAD,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x0C,0x63,0x8D,0x6B,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x95,0xAD,0xF6,0xB5,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x13,0x9D,0x54,0xA5,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x37,0xBE,
-	0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0x13,0x9D,0xD2,0x94,0x03,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x99,0xCE,0x78,0xC6,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xD6,0xB5,0x2F,0x7C,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xF6,0xB5,
-	0x50,0x84,0x41,0x08,0x00,0x00,0x00,0x00,0x48,0x42,0x58,0xC6,0xF6,0xB5,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x4C,0x63,0xEB,0x5A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6D,0x6B,0x37,0xBE,0x48,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x71,0x8C,
-	0xF6,0xB5,0xE7,0x39,0x00,0x00,0x00,0x00,0x82,0x10,0x2C,0x63,0x49,0x4A,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0xF6,0xB5,0xF2,0x94,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,
-	0xD6,0xB5,0x54,0xA5,0x03,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x13,0x9D,0xD6,0xB5,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x61,0x08,0xC3,0x18,0xE3,0x18,
-	0x45,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,
-	0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,
-	0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0x65,0x29,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x69,0x4A,0xF7,0xBD,0x33,0x9D,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xD2,0x94,0x17,0xBE,0x4C,0x63,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC7,0x39,0x28,0x42,0x89,0x4A,0xAA,0x52,0xAA,0x52,
-	0xCB,0x5A,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,
-	0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0xEB,0x5A,0x0B,0x5B,0xEB,0x5A,0xEB,0x5A,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,
-	0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0x0B,0x5B,0xE7,0x39,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x4C,0x63,0xF6,0xB5,0x95,0xAD,0x69,0x4A,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x07,0x3A,0x54,0xA5,0xF7,0xBD,0x8D,0x6B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x19,0x48,0x42,0xCB,0x5A,0xCB,0x5A,0xEB,0x5A,0x0B,0x5B,0x0C,0x63,0x0C,0x63,
-	0xEB,0x5A,0x0C,0x63,0x2C,0x63,0x4C,0x63,0x2C,0x63,0x0B,0x5B,0x4D,0x6B,0x4D,0x6B,0x4C,0x63,0xEB,0x5A,0x2C,0x63,0x4D,0x6B,0x4D,0x6B,0x2C,0x63,0x0B,0x5B,0x2C,0x63,0x4D,0x6B,0x4D,0x6B,0x2C,0x63,0x0B,0x5B,0x4D,0x6B,0x4D,0x6B,0x4C,0x63,0xEB,0x5A,0x2C,0x63,0x4D,0x6B,0x4D,0x6B,0x2C,0x63,0xEB,0x5A,0x2C,0x63,0x4D,0x6B,0x4D,0x6B,
-	0x2C,0x63,0x0B,0x5B,0x4D,0x6B,0x4D,0x6B,0x2C,0x63,0x0B,0x5B,0x4D,0x6B,0x4D,0x6B,0x4C,0x63,0x0B,0x5B,0x2C,0x63,0x4D,0x6B,0x4D,0x6B,0x4D,0x6B,0x2C,0x63,0xCB,0x5A,0x2C,0x63,0xCB,0x5A,0xEB,0x5A,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x2C,0x63,0x0C,0x63,0x0C,0x63,0x2C,0x63,
-	0x2C,0x63,0x2C,0x63,0x2C,0x63,0x0C,0x63,0x0C,0x63,0x0C,0x63,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x28,0x42,0x95,0xAD,0x17,0xBE,0x13,0x9D,0x4C,0x63,0xC7,0x39,0xC2,0x10,0x41,0x08,0xA2,0x10,0xA6,0x31,0x2C,0x63,0xF3,0x9C,0x17,0xBE,0xD6,0xB5,0x8A,0x52,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x10,0x28,0x42,0xCA,0x52,0xEB,0x5A,0x0B,0x5B,0x0B,0x5B,0x2C,0x63,0x2C,0x63,0x2C,0x63,0x6D,0x6B,
-	0x2C,0x63,0x0B,0x5B,0x6D,0x6B,0x8D,0x6B,0x8D,0x6B,0x2C,0x63,0x4C,0x63,0x8D,0x6B,0x8D,0x6B,0x6D,0x6B,0x0B,0x5B,0x6D,0x6B,0x8D,0x6B,0xAE,0x73,0x4C,0x63,0x2C,0x63,0x8E,0x73,0xAE,0x73,0x8E,0x73,0x0C,0x63,0x4C,0x63,0xAE,0x73,0xAE,0x73,0x6D,0x6B,0x0B,0x5B,0x6D,0x6B,0xAE,0x73,0xAE,0x73,0x4C,0x63,0x2C,0x63,0x8E,0x73,0xAE,0x73,
-	0xAE,0x73,0x0C,0x63,0x4C,0x63,0xAE,0x73,0x8E,0x73,0x0C,0x63,0x4C,0x63,0xAE,0x73,0xAE,0x73,0x6D,0x6B,0x0C,0x63,0x8D,0x6B,0xAE,0x73,0x8E,0x73,0x6D,0x6B,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0x4C,0x63,0x0B,0x5B,0x0C,0x63,0xEB,0x5A,0x0C,0x63,0xEB,0x5A,0xEB,0x5A,0x0B,0x5B,0x2C,0x63,0xEB,0x5A,0xEB,0x5A,0xEB,0x5A,0x6D,0x6B,0x4D,0x6B,
-	0x4D,0x6B,0x6D,0x6B,0x6D,0x6B,0x4D,0x6B,0x4C,0x63,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xAE,0x73,0x74,0xA5,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF6,0xB5,0xF6,0xB5,0x17,0xBE,0x17,0xBE,0x95,0xAD,0xEF,0x7B,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xAA,0x52,0xEB,0x5A,0x0B,0x5B,0x2C,0x63,0x2C,0x63,0x4D,0x6B,0x6D,0x6B,0x8E,0x73,0x8E,0x73,0xAE,0x73,
-	0xAE,0x73,0x2C,0x63,0x8E,0x73,0xCF,0x7B,0xCF,0x7B,0xAE,0x73,0x4C,0x63,0xCE,0x73,0xEF,0x7B,0xEF,0x7B,0x8E,0x73,0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0xCF,0x7B,0x4C,0x63,0xAE,0x73,0xEF,0x7B,0xEF,0x7B,0xAE,0x73,0x4C,0x63,0xEE,0x73,0xEF,0x7B,0xEF,0x7B,0x8D,0x6B,0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0xCF,0x7B,0x4C,0x63,0xAE,0x73,0xEF,0x7B,
-	0xEF,0x7B,0xAE,0x73,0x4C,0x63,0xCE,0x73,0xEF,0x7B,0x8E,0x73,0x6D,0x6B,0xEF,0x7B,0xEF,0x7B,0xEF,0x7B,0x8D,0x6B,0x8E,0x73,0xEF,0x7B,0xEF,0x7B,0xCE,0x73,0xEB,0x5A,0xEB,0x5A,0x8D,0x6B,0xEF,0x7B,0x2C,0x63,0xEB,0x5A,0x4C,0x63,0xAE,0x73,0x2C,0x63,0x0B,0x5B,0xEB,0x5A,0x6D,0x6B,0xEB,0x5A,0x6D,0x6B,0x0C,0x63,0xAE,0x73,0xAE,0x73,
-	0x8E,0x73,0xAE,0x73,0xAE,0x73,0x8D,0x6B,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xC6,0x31,0x2C,0x63,0x0F,0x7C,0x50,0x84,0x0F,0x7C,0x2C,0x63,0xE7,0x39,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xCB,0x5A,0x0C,0x63,0x2C,0x63,0x4C,0x63,0x6D,0x6B,0x8D,0x6B,0xAE,0x73,0xCE,0x73,0xCF,0x7B,0xEF,0x7B,0xEF,0x7B,
-	0x8E,0x73,0xAE,0x73,0x2F,0x7C,0x30,0x84,0x0F,0x7C,0x8E,0x73,0x0F,0x7C,0x30,0x84,0x30,0x84,0xCF,0x7B,0xAE,0x73,0x30,0x84,0x30,0x84,0x30,0x84,0xCF,0x7B,0xEF,0x7B,0x30,0x84,0x30,0x84,0x10,0x84,0xAE,0x73,0x2F,0x7C,0x50,0x84,0x30,0x84,0xEF,0x7B,0xAE,0x73,0x30,0x84,0x30,0x84,0x30,0x84,0xAE,0x73,0xEF,0x7B,0x50,0x84,0x30,0x84,
-	0x30,0x84,0xAE,0x73,0x0F,0x7C,0x30,0x84,0x0F,0x7C,0xAE,0x73,0x30,0x84,0x30,0x84,0x30,0x84,0xCE,0x73,0xCF,0x7B,0x30,0x84,0x30,0x84,0x30,0x84,0x10,0x84,0x2C,0x63,0xEE,0x73,0x2C,0x63,0x50,0x84,0x6D,0x6B,0x2C,0x63,0x6D,0x6B,0x10,0x84,0x2C,0x63,0xAE,0x73,0x0C,0x63,0xCF,0x7B,0x0C,0x63,0x0F,0x7C,0x2D,0x6B,0x0F,0x7C,0xEF,0x7B,
-	0xCE,0x73,0xCF,0x7B,0x8D,0x6B,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA6,0x31,0x0C,0x63,0x2C,0x63,0x4D,0x6B,0x6D,0x6B,0x8E,0x73,0xCE,0x73,0xCF,0x7B,0xEF,0x7B,0x10,0x84,0x30,0x84,0x50,0x84,0x51,0x8C,
-	0x30,0x84,0x71,0x8C,0x71,0x8C,0x91,0x8C,0x71,0x8C,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x50,0x84,0x71,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x50,0x84,0x91,0x8C,0x92,0x94,0x92,0x94,0x91,0x8C,0x51,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x50,0x84,0x91,0x8C,0x92,0x94,0x92,0x94,0x92,0x94,0x50,0x84,0x91,0x8C,0x92,0x94,0x92,0x94,
-	0x91,0x8C,0x71,0x8C,0x92,0x94,0x92,0x94,0x71,0x8C,0x91,0x8C,0x92,0x94,0x92,0x94,0x91,0x8C,0x70,0x84,0x92,0x94,0x92,0x94,0x91,0x8C,0x71,0x8C,0x91,0x8C,0x4C,0x63,0x91,0x8C,0xAE,0x73,0x8D,0x6B,0x8D,0x6B,0x0F,0x7C,0x4D,0x6B,0xCE,0x73,0x4C,0x63,0x4C,0x63,0x2C,0x63,0xAE,0x73,0x8D,0x6B,0x50,0x84,0x6D,0x6B,0x30,0x84,0x0F,0x7C,
-	0x0F,0x7C,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x0B,0x5B,0x4C,0x63,0x6D,0x6B,0x8E,0x73,0xCE,0x73,0xEF,0x7B,0x0F,0x7C,0x30,0x84,0x30,0x84,0x71,0x8C,0x71,0x8C,0x91,0x8C,0x91,0x8C,
-	0xB2,0x94,0xB2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,
-	0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xD1,0x8C,0x91,0x8C,0xD2,0x94,0xD1,0x8C,0x91,0x8C,0xB1,0x8C,0xB1,0x8C,0xB1,0x8C,0x91,0x8C,0x91,0x8C,0x70,0x84,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x71,0x8C,0x30,0x84,0x51,0x8C,0x50,0x84,
-	0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x08,0x42,0x4D,0x6B,0x4D,0x6B,0x8E,0x73,0xAE,0x73,0xCF,0x7B,0x0F,0x7C,0x30,0x84,0x51,0x8C,0x71,0x8C,0xB2,0x94,0xB2,0x94,0xD2,0x94,0xD2,0x94,0xF2,0x94,
-	0xF2,0x94,0xF2,0x94,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x33,0x9D,0x13,0x9D,0x13,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,
-	0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x12,0x95,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xD2,0x94,0xD2,0x94,0xD2,0x94,0xB2,0x94,0xB2,0x94,0xB2,0x94,0x30,0x84,0x08,0x42,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x28,0x42,0x2C,0x63,0x6D,0x6B,0x8E,0x73,0xCE,0x73,0x0F,0x7C,0x30,0x84,0x50,0x84,0x71,0x8C,0x92,0x94,0xD2,0x94,0xD2,0x94,0xF2,0x94,0xF2,0x94,0x13,0x9D,0x33,0x9D,
-	0x33,0x9D,0x33,0x9D,0x33,0x9D,0x54,0xA5,0x54,0xA5,0x13,0x9D,0x4D,0x6B,0x33,0x9D,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,
-	0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x33,0x9D,0x33,0x9D,0x13,0x9D,0x13,0x9D,0xF2,0x94,0xF2,0x94,0xF2,0x94,0xD2,0x94,0xD2,0x94,0x8E,0x73,0x03,0x19,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x49,0x4A,0x4D,0x6B,0x6D,0x6B,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x50,0x84,0x71,0x8C,0x91,0x8C,0xB2,0x94,0xD2,0x94,0xF2,0x94,0x13,0x9D,0x33,0x9D,0x34,0xA5,0x54,0xA5,0x54,0xA5,
-	0x54,0xA5,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x95,0xAD,0xB2,0x94,0x41,0x08,0x0C,0x63,0x75,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,
-	0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x75,0xAD,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x33,0x9D,0x13,0x9D,0x13,0x9D,0x13,0x9D,0x91,0x8C,0xAA,0x52,0x41,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x69,0x4A,0x2C,0x63,0x6D,0x6B,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x50,0x84,0x71,0x8C,0xB2,0x94,0xD2,0x94,0xF2,0x94,0x12,0x95,0x33,0x9D,0x54,0xA5,0x54,0xA5,0x75,0xAD,0x75,0xAD,0x95,0xAD,
-	0x95,0xAD,0x96,0xB5,0x96,0xB5,0xB6,0xB5,0x75,0xAD,0xAA,0x52,0x00,0x00,0x61,0x08,0x4C,0x63,0xB1,0x8C,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x38,0xC6,0x55,0xAD,0x55,0xAD,0x38,0xC6,0xB6,0xB5,0x58,0xC6,0x54,0xA5,0xD6,0xB5,0xF6,0xB5,0xF7,0xBD,0xF7,0xBD,0xB2,0x94,0xB6,0xB5,0xD6,0xB5,0x34,0xA5,0x92,0x94,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x96,0xB5,0x96,0xB5,0x96,0xB5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x75,0xAD,0x55,0xAD,0x55,0xAD,0x54,0xA5,0x54,0xA5,0x54,0xA5,0x33,0x9D,0x33,0x9D,0xCE,0x73,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x89,0x4A,0x4D,0x6B,0x6D,0x6B,0xAE,0x73,0xEF,0x7B,0x10,0x84,0x50,0x84,0x71,0x8C,0xB2,0x94,0xD2,0x94,0x12,0x95,0x33,0x9D,0x33,0x9D,0x54,0xA5,0x75,0xAD,0x95,0xAD,0x96,0xB5,0xB6,0xB5,0xB6,0xB5,
-	0xD6,0xB5,0xD6,0xB5,0xD7,0xBD,0xF3,0x9C,0x28,0x42,0x82,0x10,0x61,0x08,0x00,0x00,0x20,0x00,0xA6,0x31,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x71,0x8C,0xCA,0x52,0xCA,0x52,0x71,0x8C,0xF7,0xBD,0xD7,0xBD,0xAA,0x52,0xEF,0x7B,0xF7,0xBD,0x95,0xAD,0xEB,0x5A,0x8D,0x6B,0xEF,0x7B,0x75,0xAD,0x8E,0x73,0xAE,0x73,0x2C,0x63,0xF7,0xBD,0xF7,0xBD,
-	0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD7,0xBD,0xD7,0xBD,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x96,0xB5,0x96,0xB5,0x95,0xAD,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x54,0xA5,0x54,0xA5,0xB2,0x94,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xC2,0x10,0xAA,0x52,0x2C,0x63,0x4D,0x6B,0x8E,0x73,0xCE,0x73,0x0F,0x7C,0x50,0x84,0x71,0x8C,0xB2,0x94,0xD2,0x94,0x12,0x95,0x33,0x9D,0x54,0xA5,0x54,0xA5,0x95,0xAD,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,
-	0xF6,0xB5,0xF7,0xBD,0xF7,0xBD,0x8A,0x52,0x00,0x00,0x61,0x08,0xAA,0x52,0x49,0x4A,0x00,0x00,0x20,0x00,0x13,0x9D,0x37,0xBE,0x17,0xBE,0xCA,0x52,0x55,0xAD,0x55,0xAD,0xCA,0x52,0x17,0xBE,0x58,0xC6,0xD2,0x94,0x30,0x84,0x38,0xC6,0x13,0x9D,0xEF,0x7B,0xB6,0xB5,0x18,0xC6,0x18,0xC6,0x18,0xC6,0x54,0xA5,0x0B,0x5B,0x17,0xBE,0x17,0xBE,
-	0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x75,0xAD,0x54,0xA5,0x33,0x9D,0x0B,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8A,0x52,0x2C,0x63,0x4D,0x6B,0x8D,0x6B,0xCE,0x73,0xEF,0x7B,0x30,0x84,0x71,0x8C,0x92,0x94,0xD2,0x94,0x12,0x95,0x33,0x9D,0x54,0xA5,0x54,0xA5,0x75,0xAD,0x96,0xB5,0xB6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,
-	0x17,0xBE,0x17,0xBE,0xF7,0xBD,0x04,0x21,0x20,0x00,0x8D,0x6B,0xF3,0x9C,0xF7,0xBD,0x04,0x21,0x00,0x00,0xF2,0x94,0x38,0xC6,0x38,0xC6,0x89,0x4A,0xD7,0xBD,0xD7,0xBD,0x89,0x4A,0x38,0xC6,0x59,0xCE,0xF4,0xA4,0x51,0x8C,0x58,0xC6,0xF3,0x9C,0xCA,0x52,0x6D,0x6B,0x4C,0x63,0x58,0xC6,0x55,0xAD,0x48,0x42,0x71,0x8C,0x38,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x95,0xAD,0x95,0xAD,0x34,0xA5,0xCE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x8D,0x6B,0xAE,0x73,0xCF,0x7B,0x30,0x84,0x51,0x8C,0x91,0x8C,0xB2,0x94,0xF2,0x94,0x13,0x9D,0x54,0xA5,0x54,0xA5,0x75,0xAD,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xD7,0xBD,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,
-	0x38,0xC6,0x38,0xC6,0x17,0xBE,0x85,0x29,0xE3,0x18,0xD6,0xB5,0x38,0xC6,0x78,0xC6,0xAA,0x52,0x24,0x21,0x17,0xBE,0x58,0xC6,0x58,0xC6,0xCA,0x52,0xB6,0xB5,0xB6,0xB5,0xCA,0x52,0x58,0xC6,0x79,0xCE,0x14,0xA5,0x51,0x8C,0x58,0xC6,0x13,0x9D,0x50,0x84,0x79,0xCE,0x8A,0x52,0x58,0xC6,0x79,0xCE,0xF7,0xBD,0x69,0x4A,0x58,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0xB5,0xAD,0x75,0xAD,0xAE,0x73,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x52,0xCE,0x73,0x50,0x84,0x71,0x8C,0xB2,0x94,0xD2,0x94,0xF2,0x94,0x33,0x9D,0x54,0xA5,0x54,0xA5,0x95,0xAD,0x95,0xAD,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0xF3,0x9C,0xA6,0x31,0x74,0xA5,0x58,0xC6,0xD6,0xB5,0xE7,0x39,0x13,0x9D,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x71,0x8C,0x8D,0x6B,0x8D,0x6B,0x71,0x8C,0x58,0xC6,0x58,0xC6,0x10,0x84,0x8D,0x6B,0x17,0xBE,0xB5,0xAD,0x4D,0x6B,0xF3,0x9C,0x2C,0x63,0xB5,0xAD,0x71,0x8C,0xB2,0x94,0xEA,0x52,0x58,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB5,0xAD,0x34,0xA5,0xCE,0x73,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x10,0x84,0xB2,0x94,0xD2,0x94,0x13,0x9D,0x33,0x9D,0x54,0xA5,0x55,0xAD,0x95,0xAD,0x95,0xAD,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,
-	0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0xB6,0xB5,0xB6,0xB5,0x58,0xC6,0xB5,0xAD,0x95,0xAD,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x54,0xA5,0x74,0xA5,0x38,0xC6,0x58,0xC6,0x37,0xBE,0x54,0xA5,0x33,0x9D,0x17,0xBE,0x58,0xC6,0xB6,0xB5,0x54,0xA5,0xF6,0xB5,0x17,0xBE,0x74,0xA5,0x54,0xA5,0xD6,0xB5,0x38,0xC6,0x38,0xC6,
-	0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xF3,0x9C,0x0B,0x5B,0x03,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xCE,0x73,0xD2,0x94,0x13,0x9D,0x54,0xA5,0x54,0xA5,0x75,0xAD,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,
-	0x17,0xBE,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,
-	0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB6,0xB5,0x54,0xA5,0x50,0x84,0x69,0x4A,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x84,0x54,0xA5,0x95,0xAD,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,
-	0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x58,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x37,0xBE,0x17,0xBE,0x17,0xBE,
-	0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB5,0xAD,0xB2,0x94,0xAA,0x52,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x8C,0x33,0x9D,0x95,0xAD,0xB6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,
-	0xD6,0xB5,0xD7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x38,0xC6,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD7,0xBD,0xD6,0xB5,
-	0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB5,0xAD,0x54,0xA5,0x91,0x8C,0x2C,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0x91,0x8C,0x95,0xAD,0xD6,0xB5,
-	0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0x17,0xBE,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xF7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,
-	0xD6,0xB5,0x95,0xAD,0xB2,0x94,0x6D,0x6B,0xC6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,
-	0x2C,0x63,0x30,0x84,0xB2,0x94,0x34,0xA5,0x75,0xAD,0x96,0xB5,0xB5,0xAD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xD7,0xBD,0xD6,0xB5,0xD6,0xB5,0xD6,0xB5,0xB5,0xAD,0x96,0xB5,0x75,0xAD,0x34,0xA5,0xB2,0x94,0x30,0x84,0x2C,0x63,
-	0xE7,0x39,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0xCE,0x73,0x50,0x84,0x92,0x94,0x54,0xA5,0x95,0xAD,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0xB6,0xB5,0x95,0xAD,0x54,0xA5,0x92,0x94,0x50,0x84,0xCE,0x73,0xEB,0x5A,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_b_w_resized_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_b_w_resized_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_b_w_resized_dial_img_preview_data_0};
-
-    
\ No newline at end of file
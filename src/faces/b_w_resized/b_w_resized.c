@@ -545,9 +545,13 @@ void init_face_b_w_resized(void (*callback)(const char*, const lv_img_dsc_t *, l
     lv_obj_set_y(face_b_w_resized_39_138154, 5);
     lv_obj_add_flag(face_b_w_resized_39_138154, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_b_w_resized_39_138154, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_b_w_resized_0_984);
+	face_compositor_static(face_b_w_resized_7_65174);
+	face_compositor_static(face_b_w_resized_11_65808);
+	face_compositor_static(face_b_w_resized_29_137888);
 
 
-    callback("B & W", &face_b_w_resized_dial_img_preview_0, &face_b_w_resized, NULL);
+    callback("B & W", NULL, &face_b_w_resized, NULL);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_B_W_RESIZED // (B & W) uncomment to enable or define it elsewhere
 
@@ -229,8 +230,6 @@ extern "C"
 	LV_IMG_DECLARE(face_b_w_resized_dial_img_45_140978_0);
 	LV_IMG_DECLARE(face_b_w_resized_dial_img_46_141488_0);
 	LV_IMG_DECLARE(face_b_w_resized_dial_img_47_141944_0);
-	LV_IMG_DECLARE(face_b_w_resized_dial_img_preview_0);
-	LV_IMG_DECLARE(face_b_w_resized_dial_img_preview_0);
 
 
 #endif
@@ -36,6 +36,7 @@ import java.awt.Graphics2D
 import java.awt.RenderingHints
 import java.awt.image.BufferedImage
 import java.awt.image.DataBufferInt
+import java.io.ByteArrayOutputStream
 import java.io.File
 import java.util.Calendar
 import java.util.Random
@@ -204,7 +205,21 @@ fun main(args: Array<String>) {
             } else {
                 false
             }
-            extractComponents(data, nm, faceName, binary)
+
+            // dial sides to build assets for, e.g. 240,466 (see common/face_res/face_res.h)
+            val sides = if (args.size > 3) {
+                args[3].split(",").mapNotNull { it.trim().toIntOrNull() }.filter { it > 0 }
+            } else {
+                listOf()
+            }
+
+            // side of the source dial, faces made for 466 screens need 466
+            val source = if (args.size > 4) {
+                args[4].toIntOrNull() ?: 240
+            } else {
+                240
+            }
+            extractComponents(data, nm, faceName, binary, source, source, sides)
 
             println("-----Done-------")
         } else {
@@ -215,7 +230,7 @@ fun main(args: Array<String>) {
     }
 }
 
-fun extractComponents(data: ByteArray, name: String, faceName: String, binary: Boolean, wd: Int = 240, ht: Int = 240,) {
+fun extractComponents(data: ByteArray, name: String, faceName: String, binary: Boolean, wd: Int = 240, ht: Int = 240, sides: List<Int> = listOf()) {
     val no =
             (data[3].toPInt() * 256 * 256 * 256) +
                     (data[2].toPInt() * 256 * 256) +
@@ -260,6 +275,19 @@ fun extractComponents(data: ByteArray, name: String, faceName: String, binary: B
     }
     var rPrefix = "S:" // lvgl drive letter path for image bin files
 
+    // positions relative to the dial, assets pre-scaled for every side
+    val multiRes = sides.isNotEmpty() && !use_raw
+    if (sides.isNotEmpty() && use_raw) {
+        println("Targets are only used for compiled faces, exporting at the source size")
+    }
+    if (multiRes) {
+        if (wd != ht) {
+            println("Targets need a square dial, this one is ${wd}x${ht}, exiting")
+            return
+        }
+        println("Watchface assets will be scaled from $wd to ${sides.joinToString(", ")}")
+    }
+
     var extern = ""
     var objects = ""
     var declare = ""
@@ -272,6 +300,7 @@ fun extractComponents(data: ByteArray, name: String, faceName: String, binary: B
     var lvUpdateActivity = ""
     var lvUpdateHealth = ""
     var secondsType = "NULL"
+    val children = arrayListOf<String>()
 
     var weatherIc = "const lv_img_dsc_t *face_${name}_dial_img_weather[] = {\n"
     var weatherPathIc = "const char *face_${name}_dial_img_weather[] = {\n"
@@ -429,16 +458,30 @@ fun extractComponents(data: ByteArray, name: String, faceName: String, binary: B
                     rscPathArray += rscPathArr
                 }
 
-                saveAsset(
-                        output,
-                        xSz,
-                        ySz / cmp,
-                        !(x == 0 && (id == 0x09 || id == 0x19)),
-                        cmp,
-                        name,
-                        "${x}_${clt}",
-                        use_raw
-                )
+                if (multiRes) {
+                    saveScaledAsset(
+                            output,
+                            xSz,
+                            ySz / cmp,
+                            !(x == 0 && (id == 0x09 || id == 0x19)),
+                            cmp,
+                            name,
+                            "${x}_${clt}",
+                            wd,
+                            sides
+                    )
+                } else {
+                    saveAsset(
+                            output,
+                            xSz,
+                            ySz / cmp,
+                            !(x == 0 && (id == 0x09 || id == 0x19)),
+                            cmp,
+                            name,
+                            "${x}_${clt}",
+                            use_raw
+                    )
+                }
 
                 if (id == 0x1E) {} else {
 
@@ -447,16 +490,30 @@ fun extractComponents(data: ByteArray, name: String, faceName: String, binary: B
             } else if (id == 0x16 && id2 == 0x00) {
                 
 
-                saveAsset(
-                        output,
-                        xSz,
-                        ySz / cmp,
-                        !(x == 0 && (id == 0x09 || id == 0x19)),
-                        cmp,
-                        name,
-                        "${x}_${clt}",
-                        use_raw
-                )
+                if (multiRes) {
+                    saveScaledAsset(
+                            output,
+                            xSz,
+                            ySz / cmp,
+                            !(x == 0 && (id == 0x09 || id == 0x19)),
+                            cmp,
+                            name,
+                            "${x}_${clt}",
+                            wd,
+                            sides
+                    )
+                } else {
+                    saveAsset(
+                            output,
+                            xSz,
+                            ySz / cmp,
+                            !(x == 0 && (id == 0x09 || id == 0x19)),
+                            cmp,
+                            name,
+                            "${x}_${clt}",
+                            use_raw
+                    )
+                }
                 rscJson = "["
                 for (aa in 0 until cmp) {
                     rscJson +=  "\"${rPrefix}${name}_${z}_${clt}_${aa}.bin\", "
@@ -516,6 +573,7 @@ fun extractComponents(data: ByteArray, name: String, faceName: String, binary: B
                 // extern lv_obj_t *face_{{name}};
                 extern += "\textern lv_obj_t *face_${name}_${x}_${clt};\n"
                 objects += "lv_obj_t *face_${name}_${x}_${clt};\n"
+                children.add("face_${name}_${x}_${clt}")
 
                 elements += jsonElem.replace("{{id}}", "$id")
                                     .replace("{{sub}}", "$id")
@@ -529,13 +587,17 @@ fun extractComponents(data: ByteArray, name: String, faceName: String, binary: B
                 faceItems +=
                         lvItem.replace("{{PARENT}}", "face_${name}")
                                 .replace("{{CHILD}}", "face_${name}_${x}_${clt}")
-                                .replace("{{CHILD_X}}", "$xOff")
-                                .replace("{{CHILD_Y}}", "$yOff")
+                                .replace("{{CHILD_X}}", if (multiRes) {"FACE_X(${norm(xOff, wd)})"} else {"$xOff"})
+                                .replace("{{CHILD_Y}}", if (multiRes) {"FACE_Y(${norm(yOff, wd)})"} else {"$yOff"})
                                 .replace("{{RESOURCE}}", if (use_raw) {"\"${rPrefix}${name}_${z}_${clt}_0.bin\""} else {"&face_${name}_dial_img_${z}_${clt}_0"})
 
                 if (id == 0x0d) {
                     faceItems +=
-                            "\tlv_img_set_pivot(face_${name}_${x}_${clt}, $aOff, ${ySz - aOff});\n"
+                            if (multiRes) {
+                                "\tlv_img_set_pivot(face_${name}_${x}_${clt}, FACE_SCALE(${norm(aOff, wd)}), FACE_SCALE(${norm(ySz - aOff, wd)}));\n"
+                            } else {
+                                "\tlv_img_set_pivot(face_${name}_${x}_${clt}, $aOff, ${ySz - aOff});\n"
+                            }
                     if (lan == 1) {
                         // hour hand
                         lvUpdateTime +=
@@ -673,18 +735,31 @@ fun extractComponents(data: ByteArray, name: String, faceName: String, binary: B
     g2d.drawImage(mask, 0, 0, null)
     g2d.dispose()
 
-    saveAsset(bufferBytes(scaledCanvas), 160, 160, false, 1, name, "preview", false)
-
-    declare += "\tLV_IMG_DECLARE(face_${name}_dial_img_preview_0);\n"
-
+    // compiled faces get their picker preview rendered on the watch
     if (use_raw) {
+        saveAsset(bufferBytes(scaledCanvas), 160, 160, false, 1, name, "preview", false)
         declare = "LV_IMG_DECLARE(face_${name}_dial_img_preview_0);\n"
-    } else { 
-        declare += "\tLV_IMG_DECLARE(face_${name}_dial_img_preview_0);\n"
+    }
+
+    // children no update touches go into the compositor's background layer
+    val updates = lvUpdateTime + lvUpdateWeather + lvUpdateStatus + lvUpdateActivity + lvUpdateHealth
+    for (child in children) {
+        if (!Regex("\\b$child\\b").containsMatchIn(updates) && secondsType != "&$child") {
+            faceItems += "\tface_compositor_static($child);\n"
+        }
+    }
+
+    val resInclude = if (multiRes) "#include \"../../common/face_res/face_res.h\"\n" else ""
+    val resCheck = if (multiRes) {
+        "#if " + sides.joinToString(" && ") { "FACE_SIDE != $it" } +
+                "\n#error \"${name} has no assets for this screen, add its side to the targets\"\n#endif\n"
+    } else {
+        ""
     }
 
     h_file =
             h_file.replace("{{NAME}}", name.uppercase())
+                    .replace("{{RES_INCLUDE}}", resInclude)
                     .replace("{{name}}", name.lowercase())
                     .replace("{{EXTERN}}", extern)
                     .replace("{{DECLARE}}", declare)
@@ -693,6 +768,7 @@ fun extractComponents(data: ByteArray, name: String, faceName: String, binary: B
             c_file.replace("{{NAME}}", name.uppercase())
                     .replace("{{name}}", name.lowercase())
                     .replace("{{OBJECTS}}", objects)
+                    .replace("{{RES_CHECK}}", resCheck)
                     .replace("{{ITEMS}}", faceItems)
                     .replace("{{RSC_ARR}}", if (use_raw) { "" } else { rscArray })
                     .replace("{{RSC_PATH_ARR}}", if (use_raw) { rscPathArray } else { ""})
@@ -836,23 +912,24 @@ fun saveAsset(
 
     var text =
             asset_header.replace("{{NAME}}", name.uppercase()).replace("{{name}}", name.lowercase())
-    
+    val dirA = File(dir, "assets")
+    if (!binary && !dirA.exists()) {
+        dirA.mkdirs()
+        println("Created assets folder")
+    }
 
     for (a in 0 until amount) {
         var data_raw = byteArrayOfInts()
 
-        var dat =
+        val dat =
                 """
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_${name}_dial_img_${asset}_data_${a}[] = {
-{{BYTES}}
-    };
+ASSET_BIN(face_${name}_dial_img_${asset}_data_${a}, "face_${name}_dial_img_${asset}_data_${a}.bin");
         
 """
-        var bts = "\t//RGB565 data \n\t"
-        var btsA = "\n\n\t// Alpha Channel \n\t"
-        var z = 1
-        var zA = 1
+        // the payload for ASSET_BIN, RGB565 plane then the alpha plane
+        val bts = ByteArrayOutputStream()
+        val btsA = ByteArrayOutputStream()
         for (y in 0 until height) {
             for (x in 0 until width) {
                 // val i = y * width + x
@@ -866,33 +943,21 @@ const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_${name}_dial_img_${asset}_data_${a}[]
                 // Set the alpha channel to 0 for black color
                 val alpha = if (r == 0 && g == 0 && b == 0 && tr) 0 else 255
 
-                var hex =
-                        String.format(
-                                "0x%02X,0x%02X,",
-                                rgb565[j * 2].toInt() and 0xFF,
-                                rgb565[j * 2 + 1].toInt() and 0xFF
-                        )
+                bts.write(rgb565[j * 2].toInt() and 0xFF)
+                bts.write(rgb565[j * 2 + 1].toInt() and 0xFF)
                 data_raw += (rgb565[j * 2 + 1]).toByte()
                 data_raw += (rgb565[j * 2]).toByte()
                 if (tr) {
-                    btsA += String.format("0x%02X,", alpha and 0xFF)
-                    if (zA % 64 == 0 && zA != 0) {
-                        btsA += "\n\t"
-                    }
-                    zA++
+                    btsA.write(alpha and 0xFF)
                     data_raw += (alpha).toByte()
                 }
-                if (z % 32 == 0 && z != 0) {
-                    hex += "\n\t"
-                }
-                bts += hex
-                z++
             }
         }
 
-        bts = bts + btsA
-
-        dat = dat.replace("{{BYTES}}", bts)
+        val payload = bts.toByteArray() + btsA.toByteArray()
+        if (!binary) {
+            File(dirA, "face_${name}_dial_img_${asset}_data_${a}.bin").writeBytes(payload)
+        }
 
         text += dat + "\n"
 
@@ -909,7 +974,7 @@ const lv_img_dsc_t face_${name}_dial_img_${asset}_${a} = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = $width,
     .header.h = $height,
-    .data_size = sizeof(face_${name}_dial_img_${asset}_data_${a}),
+    .data_size = ${payload.size},
     .header.cf = $color,
     .data = face_${name}_dial_img_${asset}_data_${a}};
 
@@ -932,11 +997,154 @@ const lv_img_dsc_t face_${name}_dial_img_${asset}_${a} = {
     }
 
     if (!binary){
-        val dirA = File(dir, "assets")
+        val fl = File(dirA, "face_${name}_dial_img_${asset}.c")
+        fl.writeText(text)
+    }
+}
+
+// position in 1/4096 of the dial side, FACE_NORM in face_res.h
+fun norm(value: Int, side: Int): Int {
+    return Math.round(value * 4096.0 / side).toInt()
+}
+
+fun scaledSize(value: Int, from: Int, to: Int): Int {
+    return maxOf(1, Math.round(value.toDouble() * to / from).toInt())
+}
+
+// averages the source area under each output pixel, with premultiplied alpha
+// so transparent (black) pixels do not darken the edges
+fun scaleImage(image: BufferedImage, width: Int, height: Int): BufferedImage {
+    val sw = image.width
+    val sh = image.height
+    val out = BufferedImage(width, height, BufferedImage.TYPE_INT_ARGB)
+
+    if (width > sw || height > sh) {
+        // upscaling, nothing to average
+        val g2d = out.createGraphics()
+        g2d.setRenderingHint(RenderingHints.KEY_INTERPOLATION, RenderingHints.VALUE_INTERPOLATION_BICUBIC)
+        g2d.setRenderingHint(RenderingHints.KEY_RENDERING, RenderingHints.VALUE_RENDER_QUALITY)
+        g2d.drawImage(image, 0, 0, width, height, null)
+        g2d.dispose()
+        return out
+    }
+
+    val src = IntArray(sw * sh)
+    image.getRGB(0, 0, sw, sh, src, 0, sw)
+    val fx = sw.toDouble() / width
+    val fy = sh.toDouble() / height
+
+    for (y in 0 until height) {
+        val y0 = y * fy
+        val y1 = y0 + fy
+        for (x in 0 until width) {
+            val x0 = x * fx
+            val x1 = x0 + fx
+            var a = 0.0
+            var r = 0.0
+            var g = 0.0
+            var b = 0.0
+            var sy = y0.toInt()
+            while (sy < y1 && sy < sh) {
+                val wy = minOf(y1, sy + 1.0) - maxOf(y0, sy.toDouble())
+                var sx = x0.toInt()
+                while (sx < x1 && sx < sw) {
+                    val w = wy * (minOf(x1, sx + 1.0) - maxOf(x0, sx.toDouble()))
+                    val p = src[sy * sw + sx]
+                    val pa = ((p ushr 24) and 0xFF) * w
+                    a += pa
+                    r += ((p shr 16) and 0xFF) * pa
+                    g += ((p shr 8) and 0xFF) * pa
+                    b += (p and 0xFF) * pa
+                    sx++
+                }
+                sy++
+            }
+            val area = fx * fy
+            val oa = Math.round(a / area).toInt().coerceIn(0, 255)
+            val argb = if (a > 0) {
+                val cr = Math.round(r / a).toInt().coerceIn(0, 255)
+                val cg = Math.round(g / a).toInt().coerceIn(0, 255)
+                val cb = Math.round(b / a).toInt().coerceIn(0, 255)
+                (oa shl 24) or (cr shl 16) or (cg shl 8) or cb
+            } else {
+                0
+            }
+            out.setRGB(x, y, argb)
+        }
+    }
+    return out
+}
+
+// one asset file per dial side, assets/<side>/, only the one for FACE_SIDE is compiled
+fun saveScaledAsset(
+        rgb565: ByteArray,
+        width: Int,
+        height: Int,
+        tr: Boolean = true,
+        amount: Int,
+        name: String,
+        asset: String,
+        source: Int,
+        sides: List<Int>
+) {
+    for (side in sides) {
+        val dirA = File(File(name, "assets"), "$side")
         if (!dirA.exists()) {
             dirA.mkdirs()
-            println("Created assets folder")
+            println("Created assets/$side folder")
+        }
+
+        val w = scaledSize(width, source, side)
+        val h = scaledSize(height, source, side)
+
+        var text =
+                scaled_asset_header.replace("{{NAME}}", name.uppercase())
+                        .replace("{{name}}", name.lowercase())
+                        .replace("{{SIDE}}", "$side")
+
+        for (a in 0 until amount) {
+            val image = scaleImage(getImage(rgb565, width, height, tr, a), w, h)
+
+            val bts = ByteArrayOutputStream()
+            val btsA = ByteArrayOutputStream()
+            for (y in 0 until h) {
+                for (x in 0 until w) {
+                    val p = image.getRGB(x, y)
+                    val alpha = if (tr) (p ushr 24) and 0xFF else 255
+                    // getImage keeps the RGB565 bits at the top of each channel
+                    val r = if (alpha == 0) 0 else minOf(31, (((p shr 16) and 0xFF) + 4) shr 3)
+                    val g = if (alpha == 0) 0 else minOf(63, (((p shr 8) and 0xFF) + 2) shr 2)
+                    val b = if (alpha == 0) 0 else minOf(31, ((p and 0xFF) + 4) shr 3)
+                    val px = (r shl 11) or (g shl 5) or b
+
+                    bts.write(px and 0xFF)
+                    bts.write((px shr 8) and 0xFF)
+                    if (tr) {
+                        btsA.write(alpha)
+                    }
+                }
+            }
+            val payload = bts.toByteArray() + btsA.toByteArray()
+            File(dirA, "face_${name}_dial_img_${asset}_data_${a}.bin").writeBytes(payload)
+
+            text += """
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from $source to $side
+ASSET_BIN(face_${name}_dial_img_${asset}_data_${a}, "face_${name}_dial_img_${asset}_data_${a}.bin");
+
+"""
+            val color = if (tr) "LV_COLOR_FORMAT_NATIVE_WITH_ALPHA" else "LV_COLOR_FORMAT_NATIVE"
+            text += """
+const lv_img_dsc_t face_${name}_dial_img_${asset}_${a} = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = $w,
+    .header.h = $h,
+    .data_size = ${payload.size},
+    .header.cf = $color,
+    .data = face_${name}_dial_img_${asset}_data_${a}};
+
+    """
         }
+        text += "\n#endif\n"
 
         val fl = File(dirA, "face_${name}_dial_img_${asset}.c")
         fl.writeText(text)
@@ -993,7 +1201,9 @@ extern "C"
 #endif
 
 #include "lvgl.h"
-
+#include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
+{{RES_INCLUDE}}
 //#define ENABLE_FACE_{{NAME}} // ({{FACE_NAME}}) uncomment to enable or define it elsewhere
 
 #ifdef ENABLE_FACE_{{NAME}}
@@ -1041,7 +1251,7 @@ lv_obj_t *face_{{name}};
 #if LV_COLOR_DEPTH != 16
 #error "LV_COLOR_DEPTH should be 16bit for watchfaces"
 #endif
-
+{{RES_CHECK}}
 {{RSC_ARR}}
 
 {{RSC_PATH_ARR}}
@@ -1064,7 +1274,7 @@ void init_face_{{name}}(void (*callback)(const char*, const lv_img_dsc_t *, lv_o
 
     {{ITEMS}}
 
-    callback("{{FACE_NAME}}", &face_{{name}}_dial_img_preview_0, &face_{{name}}, {{SECOND}});
+    callback("{{FACE_NAME}}", NULL, &face_{{name}}, {{SECOND}});
 
 #endif
 }
@@ -1162,9 +1372,28 @@ var asset_header =
 // Watchface: {{NAME}}
 
 #include "../{{name}}.h"
+#include "../../../common/asset_bin/asset_bin.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+"""
+
+var scaled_asset_header =
+        """
+// File generated by bin2lvgl
+// developed by fbiego. 
+// https://github.com/fbiego
+// Watchface: {{NAME}}
+
+#include "../../{{name}}.h"
+#include "../../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
+#if defined(ENABLE_FACE_{{NAME}}) && FACE_SIDE == {{SIDE}}
+
 """
@@ -4,63 +4,19 @@
 // Project name: SquareLine_Project
 
 #include "../elecrow.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets\01 Clockwise update.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_146052295_data[] = {
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD9,0x24,0x5C,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x56,0x24,0xDE,0x25,0x1F,0x26,0x97,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x24,0x1F,0x26,0x1F,0x26,0x9D,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x77,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xB8,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xDE,0x25,0x56,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB8,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xF9,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x56,0x24,0xBD,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xDE,0x25,0x77,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1A,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x77,0x24,0xDE,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x77,0x24,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x3B,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x5C,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x97,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xB8,0x24,0xFF,0xFF,0xFF,0xFF,0x9D,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xBD,0x25,0xFF,0xFF,
-0xD9,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xD9,0x24,0xDE,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xDE,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,
-0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,
-0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x5C,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x5C,0x25,0x5C,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x5C,0x25,
-0x5C,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x5C,0x25,0x5C,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x5C,0x25,0x5C,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x5C,0x25,
-0xF9,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xF9,0x24,0xF9,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xF9,0x24,0x77,0x24,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x77,0x24,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,
-0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,
-0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,
-0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,
-0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,
-0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,
-0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAF,0xEF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFE,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0xFF,0xFF,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x57,0xFF,0xFF,0xFF,0xFF,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xFE,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x1F,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0x00,0x00,0x00,0x00,0x00,0x3C,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x57,0x00,0x00,0x00,0x00,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x00,0x00,0x00,0x70,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x87,0x00,0x00,0xF6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x00,
-0xAF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,
-0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,
-0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,
-0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,
-0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,
-0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,
-0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,
-0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,
-0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x70,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x70,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0xB0,0xFF,0xFF,0x00,0x00,0x00,
-0x00,0x00,0x00,0xD0,0xFF,0xFF,0x80,0x10,0x10,0x80,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xF0,0xFF,0xFF,0xF0,0x80,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_146052295_data, "ui_img_146052295_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_146052295 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 16,
     .header.h = 82,
-    .data_size = sizeof(ui_img_146052295_data),
+    .data_size = 3936,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = ui_img_146052295_data
 };
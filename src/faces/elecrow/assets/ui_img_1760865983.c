@@ -4,1222 +4,19 @@
 // Project name: SquareLine_Project
 
 #include "../elecrow.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets\Round bottom of alarm clock 240px.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_1760865983_data[] = {
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,
-0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0x79,0x2E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-
-
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_1760865983_data, "ui_img_1760865983_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_1760865983 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 240,
-    .data_size = sizeof(ui_img_1760865983_data),
+    .data_size = 115200,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = ui_img_1760865983_data
 };
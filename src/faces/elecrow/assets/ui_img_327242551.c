@@ -4,54 +4,19 @@
 // Project name: SquareLine_Project
 
 #include "../elecrow.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets\01 Minute hand updating.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_327242551_data[] = {
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x24,0xF9,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0x25,0xBD,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x97,0x24,0x1F,0x26,0x1F,0x26,0x97,0x24,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1A,0x25,0x1F,0x26,0x1F,0x26,0x1A,0x25,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x56,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x56,0x24,0xFF,0xFF,0xFF,0xFF,0xB8,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xB8,0x24,0xFF,0xFF,
-0xFF,0xFF,0x9D,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x9D,0x25,0xFF,0xFF,0x77,0x24,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x77,0x24,0x1A,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1A,0x25,0xDE,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0xDE,0x25,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,
-0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,
-0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,
-0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,
-0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,
-0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,0x1F,0x26,
-0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x3B,0x25,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0xFF,0xFF,0xFF,0xFF,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,0x8D,0x2A,
-
-
-0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xFB,0x00,0x00,0x00,0x00,0x00,0x70,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0xDC,0xFF,0xFF,0xDC,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0x9C,0xFF,0xFF,0xFF,0xFF,0x9C,0x00,0x00,0xF6,0xFF,0xFF,0xFF,0xFF,0xF6,0x00,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x57,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x80,0x80,0xF0,0xFF,0xFF,0xFF,0xF0,0x10,0x00,0x00,0x10,0xF0,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x90,0xFF,
-0xFF,0x90,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0xF0,0x30,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xF0,0x90,0x90,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_327242551_data, "ui_img_327242551_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_327242551 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 8,
     .header.h = 126,
-    .data_size = sizeof(ui_img_327242551_data),
+    .data_size = 3024,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = ui_img_327242551_data
 };
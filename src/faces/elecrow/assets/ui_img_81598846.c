@@ -4,83 +4,18 @@
 // Project name: SquareLine_Project
 
 #include "../elecrow.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets\elecrow_logo_100-20px.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_81598846_data[] = {
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0xD8,0x3C,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6E,0xA4,0x05,0xF4,0x70,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x6F,0x8C,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xD8,0x34,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xD7,0x44,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,
-0x05,0xF4,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,
-0xFF,0xFF,0x1E,0x05,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,
-0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,
-0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x05,0xF4,0x05,0xF4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0x1E,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x50,0x80,0x60,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x10,0x80,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x50,0x00,0x00,0x30,0xE0,0xFF,0xFF,0xF0,0xC0,0xC0,0xF0,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x30,0x30,0xF0,0xFF,0xA0,0x30,0x00,0x00,0x00,0x00,0x30,0xB0,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x7E,0xF0,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0xE0,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xF0,0x71,0xF0,0x60,0x00,0x60,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x60,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x60,0x80,0x80,0x40,0x00,0x00,0x00,0x00,0x40,0x80,0x80,0x80,0x80,0x80,0x80,0x30,0x00,0x00,0x00,0x40,0x80,0x80,0x70,0x30,0x00,0x00,0x00,0x60,0x80,0x80,0x80,0x80,0x80,0x60,0x10,0x00,0x00,0x00,
-0x00,0x10,0x60,0x80,0x4C,0x80,0x80,0x30,0x00,0x10,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x60,0x80,0x00,0x00,0x00,0x00,0x80,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xFF,0x50,0x60,0xFF,0x80,0x10,0x90,0xC0,0x70,0x30,0x00,0x00,0x30,0xD0,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x90,0x80,0x80,0x80,0x00,0xC0,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xC0,0x80,0x80,0x80,0x20,0x00,0x30,0xC0,0xFF,0xF0,0xA0,0xFF,0xFF,0xD0,0x00,0x00,0xE0,0xFF,0xFF,0x80,0xC0,0xFF,0xFF,
-0xD0,0x00,0x00,0x00,0x80,0xF0,0xFF,0xD0,0x3D,0x90,0xFF,0xFF,0x80,0x00,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x20,0xFF,0xFF,0x20,0x00,0x00,0x60,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0xFF,0x40,0x00,0xA0,0xFF,0xC0,0x20,0x40,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x20,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x10,0xF0,0xFF,0xF0,0x20,0x00,0x90,0xFF,0xFF,0x60,0x00,0xFF,0xFF,0xFF,
-0x20,0x40,0xFF,0xFF,0xFF,0x00,0x00,0x80,0xFF,0xFF,0x90,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x20,0xC0,0xFF,0xFF,0x80,0x00,0x00,0xA0,0xFF,0xFF,0x50,0x00,0x00,0xE0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x40,0x00,0x00,0xA0,0xFF,0xF0,0x70,0x00,0x60,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0x40,0x00,0x00,0x40,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x10,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0x90,0x00,0x00,0x80,0xFF,0xFF,0x80,
-0x30,0xFF,0xFF,0xFF,0x00,0x50,0xFF,0xFF,0xD0,0x00,0x10,0xF0,0xFF,0xFF,0x10,0x00,0x00,0x00,0x80,0xFF,0xFF,0x70,0x90,0xFF,0xFF,0xB0,0x00,0x20,0xFF,0xFF,0xFF,0x80,0x00,0x50,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x60,0x00,0x00,0x20,0xA0,0xFF,0xFF,0xE0,0x60,0x00,0x20,0x70,0x80,0x80,0x60,0x00,0xC0,0x00,0x00,0x80,0xFF,0xFF,0xD0,0x40,0x40,0x40,0x00,0x40,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x10,0xFF,0xFF,0xFF,0x40,0x40,0x40,0x10,0x00,0xD0,0xFF,0xFF,0x40,0x00,0x00,
-0x00,0x00,0x00,0x00,0x50,0xFF,0xFF,0xC0,0x30,0xD0,0xFF,0xF0,0x40,0x00,0x60,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0x80,0x50,0xFF,0xFF,0xE0,0x00,0xB0,0xE0,0xFF,0xFF,0xC0,0x00,0xC0,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0xFF,0xB0,0x00,0x00,0x30,0x80,0x70,0xFF,0xFF,0xFF,0xF0,0x90,0x50,0x20,0x00,0x50,0xC0,0xFF,0x00,0x00,0xA0,0xFF,0xFF,0xE0,0xC0,0xC0,0x90,0x00,0x70,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xF0,0xC0,0xC0,0xC0,0x30,0x00,0xFF,0xFF,
-0xFF,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x30,0x00,0x00,0x80,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x50,0x20,0xFF,0xFF,0xFF,0x50,0xF0,0x40,0xFF,0xFF,0xF0,0x40,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xFF,0xFF,0x30,0x00,0x00,0xC0,0x60,0x40,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0xC0,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x60,0xFF,0xFF,0xC0,0x00,0x00,0x00,
-0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0xB0,0xFF,0xFF,0x80,0x50,0xFF,0xFF,0xF0,0x00,0x00,0x80,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x10,0x00,0xF0,0xFF,0xFF,0xF0,0x80,0x00,0xFF,0xFF,0xFF,0xD0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFF,0xFF,0xD0,0x10,0x00,0x30,0xFF,0x90,0x10,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,
-0x90,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x20,0xFF,0xFF,0xC0,0x00,0xD0,0xFF,0xFF,0x40,0x00,0xFF,0xFF,0xFF,0x10,0x00,0x80,0xFF,0xFF,0x80,0x00,0x00,0x00,0x50,0xFF,0xFF,0xA0,0x00,0x00,0xB0,0xFF,0xFF,0xF0,0x10,0x00,0xC0,0xFF,0xFF,0xF0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0xD0,0x10,0x00,0x60,0xFF,0xC0,0x20,0x20,0xA0,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x10,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0x40,0x00,0x00,0x00,
-0x00,0xC0,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0xB0,0xFF,0xFF,0x30,0x10,0xA0,0xFF,0xFF,0x40,0x00,0xFF,0xFF,0xFF,0x30,0x00,0xE0,0xFF,0xFF,0x40,0x00,0x20,0xFF,0xFF,0xE0,0x10,0x00,0x40,0xD0,0xFF,0xF0,0x20,0x00,0x00,0x80,0xFF,0xFF,0x70,0x00,0x00,0x90,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xF0,0xFF,0xFF,0xF0,0x80,0x30,0xA0,0xFF,0xF0,0x80,0x10,0x00,0x40,0x40,0x30,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xC0,0xC0,0xC0,0x90,0x00,0xFF,0xFF,0xFF,
-0xD0,0xC0,0xC0,0xC0,0x00,0xE0,0xFF,0xFF,0xD0,0xC0,0xC0,0xC0,0x20,0x00,0x10,0xC0,0xFF,0xFF,0xF0,0xFF,0xE0,0x50,0x00,0x20,0xFF,0xFF,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0x40,0x00,0x00,0x50,0xE0,0xFF,0xA0,0xD0,0xFF,0xFF,0xA0,0x10,0x00,0x00,0x00,0x40,0xFF,0xE0,0x00,0x00,0x00,0x50,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xA0,0x50,0x40,0x00,0x00,0x00,0x00,0x10,0x40,0x40,0x40,0x40,0x40,0x40,0x30,
-0x10,0x40,0x40,0x40,0x40,0x40,0x40,0x30,0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x00,0x00,0x00,0x00,0x20,0x40,0x40,0x20,0x00,0x00,0x00,0x10,0x40,0x40,0x40,0x00,0x00,0x30,0x40,0x40,0x10,0x00,0x00,0x00,0x00,0x30,0x20,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0x20,0x00,0x00,0x00,0x10,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x80,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xA0,0x20,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x50,0x80,0x60,0x40,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_81598846_data, "ui_img_81598846_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_81598846 = {
    .header.magic = LV_IMAGE_HEADER_MAGIC,
    .header.w = 100,
    .header.h = 20,
-   .data_size = sizeof(ui_img_81598846_data),
+   .data_size = 6000,
    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
    .data = ui_img_81598846_data};
@@ -4,135 +4,19 @@
 // Project name: SquareLine_Project
 
 #include "../elecrow.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
 // IMAGE DATA: assets\logo 60px.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_logo_60px_png_data[] = {
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,
-0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0x06,0xFC,0x06,0xFC,
-0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,
-0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,
-0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,
-0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0x06,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,
-0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0x9F,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x60,0x80,0xB0,0xC0,0xC0,0xC0,0xC0,0xC0,0xA0,0x80,0x60,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x60,0xB0,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xA0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xA0,0x20,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x90,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0xA0,0x80,0x70,0x40,0x40,0x40,0x70,0x80,0x90,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD0,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xA0,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x50,0xA0,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xE0,0x30,0x00,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x60,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x80,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xF0,0x30,0x00,0x00,0x00,0x90,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0xE0,0x10,0x00,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xE0,0xD0,0x10,0x10,0xC0,0xFF,0xFF,0xFF,0xD0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xFF,0xD0,0x10,0x00,0xA0,0xFF,0xD0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xFF,0xD0,0x10,0x00,0x90,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFF,0xE0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xD0,0xFF,0xF0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD0,0x10,0x00,0x30,0xF0,0xFF,0xF0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xD0,0x10,0x00,0x40,0xFF,
-0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xD0,0x10,0x00,0x70,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x20,0xC0,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0xA0,0xFF,0xFF,0xFF,0xA0,0x10,0x00,0x00,0x00,0x00,0x10,0xA0,0xF0,0xA0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xD0,0x20,0x00,0x00,0x00,0x00,0x00,
-0x70,0xF0,0xFF,0xD0,0x70,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x10,0xD0,0xFF,0xFF,0xFF,0xF0,0x50,0x00,0x00,0x00,0x00,0x00,0x20,0xC0,0xFF,0xFF,0xFF,0xD0,0x80,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,
-0x00,0x00,0x00,0x20,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x10,0xE0,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0xA0,0x80,0x70,0x40,0x40,0x70,0x80,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xD0,0x30,0x00,0x00,0x00,0x00,0x00,0x20,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xF0,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x30,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x90,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x30,0x00,0x00,0x00,0x20,0x80,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xA0,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x20,0x00,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x70,0x90,0xC0,0xC0,0xFF,0xE0,0xC0,0x90,0x30,0x00,0x00,0x00,0x00,0x00,0x10,0xF0,0x80,
-0x00,0x00,0x00,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0xFF,0x80,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x50,0x00,0x00,0x20,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,
-0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xFF,0xFF,0x80,0x00,0x00,0x00,0x70,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xF0,0x30,0x00,0x00,0x10,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x90,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xB0,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA0,0xE0,0x10,0x00,0x00,0x00,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x90,0x50,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x80,0xF0,0xFF,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x10,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFF,0xD0,0x10,0x00,0x00,0x00,0x60,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xC0,0xA0,0x80,
-0x80,0x80,0xC0,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xD0,0x10,0x00,0x00,0x00,0x30,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFF,0xFF,
-0xD0,0x10,0x00,0x00,0x00,0x10,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x00,0x00,0x00,0x00,0x00,0x30,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0xFF,0xFF,0xD0,0x10,0x00,0x00,0x00,0x00,0x50,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x20,0x00,
-0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xE0,0xFF,0xFF,0xE0,0x30,0x00,0x00,0x00,0x00,0x10,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xF0,0x50,0x00,0x00,0x00,0x00,0x00,0x40,0xC0,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xD0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xC0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xD0,0xFF,0xFF,0xFF,0xFF,0xF0,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xA0,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x80,0xC0,0xF0,0xFF,0xFF,0xFF,0xFF,0xD0,0x90,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x40,0x00,0x00,0x00,
-0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD0,0x70,0x20,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xC0,0x80,0x80,0x80,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x70,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xF0,0xA0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x90,0x50,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x40,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xD0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xD0,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x90,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xB0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB0,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x60,0xB0,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xE0,0xA0,0x60,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0x50,0x80,0x80,0x80,0x80,0x80,0x50,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-}; // LVGL_9 compatible
+ASSET_BIN(ui_img_logo_60px_png_data, "ui_img_logo_60px_png_data.bin"); // LVGL_9 compatible
 const lv_img_dsc_t ui_img_logo_60px_png = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 60,
     .header.h = 60,
-    .data_size = sizeof(ui_img_logo_60px_png_data),
+    .data_size = 10800,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = ui_img_logo_60px_png_data
 };
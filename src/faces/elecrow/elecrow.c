@@ -141,8 +141,11 @@ void init_face_elecrow(void (*callback)(const char *, const lv_img_dsc_t *, lv_o
     lv_obj_add_flag(face_elecrow_second, LV_OBJ_FLAG_ADV_HITTEST);     /// Flags
     lv_obj_remove_flag(face_elecrow_second, LV_OBJ_FLAG_SCROLLABLE);      /// Flags
     lv_image_set_pivot(face_elecrow_second, 5,120 );//119
+	face_compositor_static(face_elecrow_bg);
+	face_compositor_static(face_elecrow_logo);
 
-    callback("Elecrow", &ui_img_elecrow_png, &face_elecrow, &face_elecrow_second);
+
+    callback("Elecrow", NULL, &face_elecrow, &face_elecrow_second);
 
 
 #endif
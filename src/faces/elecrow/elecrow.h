@@ -10,6 +10,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 #ifdef ENABLE_FACE_ELECROW
 
@@ -30,7 +31,6 @@ LV_IMG_DECLARE(ui_img_1304719198);    // assets\minute hand.png
 LV_IMG_DECLARE(ui_img_1608590414);    // assets\hour hand.png
 // LV_IMG_DECLARE(ui_img_1760865983);    // assets\Round bottom of alarm clock 240px.png
 LV_IMG_DECLARE(ui_img_01_png); 
-LV_IMG_DECLARE(ui_img_elecrow_png); 
 
 #endif
 
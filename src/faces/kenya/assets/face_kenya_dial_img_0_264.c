@@ -5,6 +5,7 @@
 // Watchface: KENYA
 
 #include "../kenya.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,1813 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_kenya_dial_img_0_264_data_0[] = {
-	//RGB565 data 
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,
-	0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0xE3,0x18,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x00,0xE3,0x18,0xE3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x4D,0x6B,0x45,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0xE7,0x39,0xCF,0x7B,0xE3,0x18,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x41,0x08,0x55,0xAD,0x18,0xC6,0x45,0x29,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0xE7,0x39,0xFB,0xDE,0x91,0x94,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xCF,0x7B,0xFF,0xFF,0x18,0xC6,0x45,0x29,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x8A,0x52,0xFB,0xDE,0xFF,0xFF,0x4D,0x6B,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x8A,0x52,0x9D,0xEF,0xFF,0xFF,0x99,0xD6,0xE7,0x39,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x8A,0x52,0x3C,0xE7,0xFF,0xFF,0x9D,0xEF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x8A,0x52,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x4D,0x6B,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x45,0x29,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xE3,0x18,0x18,0xC6,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x3C,0xE7,0x8A,0x52,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x4D,0x6B,0x9D,0xEF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x55,0xAD,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x3C,0xE7,0x8A,0x52,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x4D,0x6B,0x9D,0xEF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x91,0x94,0x41,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x41,0x08,0xCF,0x7B,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x3C,0xE7,0x8A,0x52,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x4D,0x6B,0x9D,0xEF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x4D,0x6B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x8A,0x52,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFB,0xDE,0xE7,0x39,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x8A,0x52,0x9D,0xEF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x9D,0xEF,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x99,0xD6,0xE7,0x39,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x41,0x08,0x8A,0x52,0x3C,0xE7,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x99,0xD6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x55,0xAD,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x18,0xC6,0x45,0x29,0x41,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0xE7,0x39,0xFB,0xDE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x91,0x94,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xAD,0xE3,0x18,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x41,0x08,0x45,0x29,0x99,0xD6,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x91,0x94,0x41,0x08,
-	0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x30,0x41,0xA0,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE3,0x18,0x55,0xAD,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x3C,0xE7,0xE7,0x39,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x18,0xC6,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x9D,0xEF,0x4D,0x6B,0x41,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x30,0x61,0x90,0x21,0xB8,0x21,0xB8,0x61,0x90,0x00,0x30,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,
-	0xCF,0x7B,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0xCF,0x7B,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x3C,0xE7,
-	0xE7,0x39,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x30,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x30,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x8A,0x52,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE7,0x39,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xAD,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x30,0x61,0x90,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x99,0xD6,
-	0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x4D,0x6B,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x30,0x61,0x90,0x21,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x61,0x90,0x00,0x30,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x91,0x94,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x99,0xD6,0x45,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x61,0x90,0x00,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE7,0x39,0x3C,0xE7,0xFF,0xFF,
-	0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0x4D,0x6B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,
-	0xDF,0xF7,0xFF,0xFF,0xCF,0x7B,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x78,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x21,0x78,0x00,0x18,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x91,0x94,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x91,0x94,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0x45,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x18,
-	0x21,0x78,0x42,0xB0,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x42,0xB0,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x42,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x21,0xB8,0x21,0x78,0x00,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x7B,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE7,0x39,0x3C,0xE7,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x08,0x41,0x60,0x42,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x20,0xA8,0x6D,0xCB,0x69,0xC2,0x20,0xA8,0x00,0xB0,0x69,0xC2,0x6D,0xCB,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,
-	0x41,0x60,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0x45,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x41,0x08,0x91,0x94,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x60,0x42,0xB0,
-	0x00,0xB0,0x00,0xB8,0x00,0xC0,0x20,0xA8,0xC7,0xB1,0xBA,0xEE,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x69,0xC2,0x1B,0xF7,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x42,0xB0,0x41,0x60,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x45,0x29,0x99,0xD6,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xE7,0x39,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0x21,0x48,0x42,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x55,0xDD,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0x55,0xDD,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0x00,0xB8,0x21,0xB8,0x41,0x60,0x20,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x8A,0x52,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x4D,0x6B,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x21,0x48,0x41,0xA0,0x00,0xB8,0x00,0xB0,
-	0x00,0xB0,0x00,0xB8,0x00,0xB0,0xC7,0xB1,0x7C,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0x7C,0xFF,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x21,0x48,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x9D,0xEF,0x8A,0x52,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE3,0x18,0x55,0xAD,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xCF,0x7B,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x71,0xD4,0xFE,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFE,0xFF,0x71,0xD4,0x41,0xA0,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x00,0xB0,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x20,0x00,0x00,0x00,0xCF,0x7B,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x91,0x94,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x41,0x08,0x45,0x29,0x18,0xC6,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xCF,0x7B,0x20,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x78,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,
-	0x00,0xB0,0x00,0xB0,0xC7,0xB1,0x1B,0xF7,0xFE,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFE,0xFF,0x1B,0xF7,0xC7,0xB1,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0xCF,0x7B,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xAD,0xE3,0x18,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xE7,0x39,0x99,0xD6,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0x4D,0x6B,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x78,0x21,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x20,0xA8,0x6D,0xCB,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x6D,0xCB,0x20,0xA8,0x00,0xB0,
-	0x00,0xB0,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x21,0xB8,0x21,0x78,0x00,0x18,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x4D,0x6B,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x18,0xC6,0x45,0x29,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x8A,0x52,0x3C,0xE7,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x9D,0xEF,0x8A,0x52,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0x00,0xB8,0x41,0xA0,0x55,0xDD,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xDD,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x21,0xB8,0x41,0x60,0x00,0x08,0x20,0x00,0x20,0x00,0x20,0x00,0x8A,0x52,0xDF,0xF7,0xDE,0xFF,0xDF,0xF7,0xDF,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0xE7,0x39,0x41,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x99,0xD6,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x45,0x29,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x04,0xA1,0x38,0xEE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0xBA,0xEE,0x04,0xA1,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x08,0xE7,0x39,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0xAD,0x45,0x29,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,
-	0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,
-	0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,
-	0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0xCF,0x7B,0x18,0xC6,0x3C,0xE7,0xFF,0xFF,0x9D,0xEF,0x8A,0x52,0x00,0x18,0x45,0x29,0x45,0x29,0x21,0x78,0x42,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,
-	0x00,0xB0,0x29,0xC2,0x7C,0xFF,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0xDF,0xF7,0xDE,0xFF,0x7C,0xFF,0x29,0xC2,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x42,0xB0,0x21,0x78,0x45,0x29,0x45,0x29,0x00,0x18,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0x91,0x94,
-	0x8A,0x52,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,
-	0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,
-	0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,0x45,0x29,
-	0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,
-	0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,
-	0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x18,0xC6,0x4D,0x6B,
-	0xE7,0x39,0xE7,0x39,0xFB,0xDE,0xFF,0xFF,0x55,0xAD,0x45,0x29,0x99,0xD6,0x55,0xDD,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0xDF,0xF7,0xDE,0xFF,0xFF,0xFF,0x6D,0xCB,0x20,0xA8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x55,0xDD,0x18,0xC6,0x45,0x29,0x18,0xC6,0xFF,0xFF,0x99,0xD6,0x45,0x29,0xE7,0x39,0xCF,0x7B,0x99,0xD6,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,
-	0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,
-	0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,
-	0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x8A,0x52,0x4D,0x6B,0xFF,0xFF,0xDE,0xFF,0x8A,0x52,0xCF,0x7B,0x69,0xC2,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x20,0xA8,0x71,0xD4,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFF,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0xFF,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x29,0xC2,0x8A,0x52,0x4D,0x6B,0xFF,0xFF,0xFF,0xFF,0x8A,0x52,0x4D,0x6B,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,
-	0xFF,0xFF,0x18,0xC6,0x45,0x29,0x99,0xD6,0xFF,0xFF,0x18,0xC6,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x55,0xDD,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFF,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0xFF,0xFF,0x55,0xDD,0x20,0xA8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0x78,0x99,0xD6,0xFF,0xFF,0x55,0xAD,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x4D,0x6B,0x8A,0x52,0xFF,0xFF,0xBA,0xEE,0x24,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0x42,0xB0,0x38,0xEE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x38,0xEE,0x24,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x24,0xB1,0xBA,0xEE,0xFF,0xFF,0xE7,0x39,0x91,0x94,0xFF,0xFF,0xDF,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xDF,0xF7,0xFF,0xFF,0xFB,0xDE,0x45,0x29,0x55,0xAD,0x6D,0xCB,0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x24,0xB1,0xBA,0xEE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x1B,0xF7,0x24,0xB1,
-	0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x6D,0xCB,0x91,0x94,0xE7,0x39,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x94,0x82,0x71,0x24,0xB1,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0xC7,0xB1,0x7C,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xDE,0xFF,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x41,0x60,0x55,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xF7,0x04,0xA1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x20,0xA8,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xDE,0xFF,0x69,0xC2,
-	0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x04,0xA1,0x1B,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0xFE,0xFF,0x71,0xD4,0x41,0xA0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,
-	0xAA,0xC2,0xDE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x71,0xD4,0xFE,0xFF,0xDF,0xF7,0xDF,0xF7,
-	0xDF,0xF7,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0xDE,0xFF,0xDE,0xFF,
-	0xDF,0xF7,0xFF,0xFF,0x1B,0xF7,0x04,0xA1,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0xAA,0xC2,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,
-	0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x04,0xA1,0xBA,0xEE,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,
-	0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x6D,0xCB,0xFE,0xFF,0xDF,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,
-	0xFF,0xFF,0xBA,0xEE,0x04,0xA1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,
-	0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x04,0xA1,0x38,0xEE,0xFE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,0x20,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,
-	0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0xA8,0x00,0xB8,0x20,0xA8,0x6D,0xCB,0x7C,0xFF,
-	0xDE,0xFF,0xDE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,
-	0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,
-	0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0xAA,0xC2,0xAA,0xC2,0x69,0xC2,0xAA,0xC2,
-	0x69,0xC2,0x42,0xB0,0x00,0xC0,0x00,0xB0,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,
-	0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x42,0xB0,0x29,0xC2,0xAA,0xC2,0x69,0xC2,0x69,0xC2,0xAA,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,
-	0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,
-	0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,
-	0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x61,0x90,0x20,0xA8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,
-	0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0xA8,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x41,0xA0,0x41,0x60,
-	0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x42,0xB0,
-	0x00,0x30,0x21,0x78,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0xA8,0xAA,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x6D,0xCB,
-	0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xC0,0x21,0x78,0x00,0x18,0x61,0x90,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0x78,0x00,0x08,0x21,0x48,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0xA8,
-	0x69,0xC2,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x21,0xB8,0x21,0x48,0x00,0x00,
-	0x41,0x60,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x00,0x30,
-	0x00,0x00,0x00,0x30,0x20,0xA8,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xDE,0xFF,0x69,0xC2,
-	0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x21,0x78,0x00,0x08,0x20,0x00,0x00,0x08,0x21,0x78,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0xC7,0xB1,0x7C,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x7C,0xFF,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x21,0x78,0x00,0x08,0x20,0x00,
-	0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x21,0x48,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x48,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x24,0xB1,0xBA,0xEE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x1B,0xF7,0x24,0xB1,
-	0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x42,0xB0,0x38,0xEE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x38,0xEE,0x24,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,
-	0x20,0x00,0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0x48,0x20,0x00,0x41,0x08,
-	0x00,0x00,0x20,0x00,0x00,0x18,0x21,0x78,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x55,0xDD,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xDD,0x41,0xA0,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x21,0x78,0x00,0x18,0x00,0x00,0x00,0x08,0x41,0x08,0x20,0x00,0x00,0x30,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x41,0xA0,0x00,0x18,0x20,0x00,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x20,0xA8,0x71,0xD4,0xFE,0xFF,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x41,0x60,0x00,0x00,0x20,0x00,0x00,0x00,
-	0x00,0x08,0x20,0x00,0x00,0x08,0x21,0x78,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x21,0x78,0x00,0x08,0x20,0x00,0x00,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xAA,0xC2,0xFE,0xFF,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0x6D,0xCB,0x20,0xA8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x21,0x48,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB0,0xC7,0xB1,0x1B,0xF7,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xFF,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x08,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x38,0xEE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x38,0xEE,0x24,0xB1,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x18,0x00,0x00,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x20,0x00,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x20,0xA8,0x71,0xD4,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x60,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x21,0x48,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x69,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xDE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x42,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x04,0xA1,0x38,0xEE,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xBA,0xEE,0x24,0xB1,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x6D,0xCB,0xFE,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDF,0xF7,0xFE,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x21,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB0,0x24,0xB1,0xBA,0xEE,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB8,0x29,0xC2,0xDF,0xF7,0x1B,0xF7,0x24,0xB1,0x00,0xB0,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x71,0xD4,0xFE,0xFF,0x69,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xFE,0xFF,0x71,0xD4,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x04,0xA1,0x38,0xEE,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x69,0xC2,0x38,0xEE,0x04,0xA1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x29,0xC2,0x29,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x08,0x61,0x90,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x18,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x08,0x21,0x78,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x08,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0xB8,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x21,0x48,0x21,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x42,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x42,0xB0,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x21,0x48,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x41,0xA0,0x41,0xA0,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x24,0xB1,0x6D,0xCB,0x38,0xEE,0x38,0xEE,0x71,0xD4,0x24,0xB1,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xC0,0x41,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x04,0xA1,0x55,0xDD,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x38,0xEE,0x04,0xA1,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xC0,0x20,0xA8,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x61,0x90,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x41,0xA0,0x71,0xD4,0xFE,0xFF,0xDF,0xF7,0xDE,0xFF,0xDE,0xFF,0x9D,0xEF,0xFF,0xFF,0x55,0xDD,0x41,0xA0,0x00,0xC0,0x00,0xB8,0x00,0xB0,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xC0,0x41,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x78,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC7,0xB1,0x1B,0xF7,0xFE,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x7C,0xFF,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x6D,0xCB,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x20,0xA8,0x55,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xEE,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x38,0xEE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xEE,0x04,0xA1,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x04,0xA1,0x38,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xF7,0x04,0xA1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0x78,0x00,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x38,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xEE,0x04,0xA1,0x00,0xB0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x20,0xA8,0x55,0xDD,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0xFE,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x38,0xEE,0x42,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x20,0xA8,0x6D,0xCB,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0x9D,0xEF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB0,0xC7,0xB1,0x7C,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0x7C,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x55,0xDD,0xFF,0xFF,0x9D,0xEF,0xDF,0xF7,0xDE,0xFF,0x9D,0xEF,0xDF,0xF7,0x55,0xDD,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x24,0xB1,0x38,0xEE,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xBA,0xEE,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0xC7,0xB1,0x55,0xDD,0x1B,0xF7,0x1B,0xF7,0x55,0xDD,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x20,0xA8,0x61,0x90,0x24,0xB1,0xC7,0xB1,0x41,0xA0,0x20,0xA8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x18,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xC0,0x41,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x42,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x42,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x20,0xA8,0x20,0xA8,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x21,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x21,0xB8,0x20,0xA8,0x20,0xA8,0x21,0xB8,0x42,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x41,0xA0,0xAA,0xC2,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x69,0xC2,0xAA,0xC2,0x41,0xA0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x78,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x42,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x04,0xA1,0xBA,0xEE,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x69,0xC2,0xBA,0xEE,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x21,0x78,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x21,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x71,0xD4,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0x55,0xDD,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0xB8,0x61,0x90,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x21,0x48,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC7,0xB1,0x7C,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0x7C,0xFF,0xC7,0xB1,0x00,0xB0,0x00,0xB0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xC0,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x08,0x21,0x78,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB0,0x00,0xB8,0x20,0xA8,0x71,0xD4,0xFE,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x08,0x61,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x24,0xB1,0xBA,0xEE,0xFE,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFE,0xFF,0x1B,0xF7,0xC7,0xB1,0x00,0xB0,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xC0,0x20,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x18,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB0,0x00,0xB0,0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0x6D,0xCB,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x30,0x20,0xA8,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x42,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x71,0xD4,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x69,0xC2,0x00,0xB0,0x20,0xA8,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xDD,0x20,0xA8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x21,0x78,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x00,0x20,0x00,0x00,0x08,0x41,0x60,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x21,0x78,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x04,0xA1,0x38,0xEE,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0xBA,0xEE,0x04,0xA1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x61,0x90,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x18,0x21,0x78,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x61,0x90,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x00,0x00,0x00,0x21,0x78,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xC7,0xB1,0x7C,0xFF,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0xDF,0xF7,0xDE,0xFF,0x7C,0xFF,0x29,0xC2,0x00,0xB0,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x41,0xA0,0x00,0x18,0x00,0x00,0x00,0x08,0x00,0x08,0x20,0x00,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x20,0xA8,0x6D,0xCB,0xFE,0xFF,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xDE,0xFF,0xFE,0xFF,0x6D,0xCB,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x21,0x48,0x00,0x00,0x00,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x08,0x20,0x00,0x00,0x00,0x21,0x48,0x21,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0x60,0x00,0x08,0x20,0x00,0x00,0x00,
-	0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x41,0xA0,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x71,0xD4,0xFF,0xFF,0xFE,0xFF,0xDE,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xDE,0xFF,0xFE,0xFF,0xFF,0xFF,0x71,0xD4,0x20,0xA8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0xB8,0x41,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x42,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x20,0xA8,0x55,0xDD,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0x55,0xDD,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x78,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x00,0x18,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x38,0xEE,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xDE,0xFF,0xFF,0xFF,0x38,0xEE,0x24,0xB1,
-	0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x41,0xA0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x48,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x41,0x60,0x00,0x08,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0x24,0xB1,0xBA,0xEE,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0xDF,0xF7,0xDE,0xFF,0xFF,0xFF,0x1B,0xF7,0x24,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x42,0xB0,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x21,0x78,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x30,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x24,0xB1,0x7C,0xFF,0xFF,0xFF,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0x7C,0xFF,0xC7,0xB1,
-	0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x41,0x60,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x21,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x60,0x21,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,
-	0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0xDF,0xF7,0xDE,0xFF,0xDF,0xF7,0xDE,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x21,0xB8,0x61,0x90,0x00,0x18,0x00,0x00,0x20,0x00,
-	0x00,0x00,0x41,0x60,0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x21,0xB8,0x21,0x78,0x00,0x08,
-	0x20,0x00,0x00,0x00,0x00,0x08,0x21,0x78,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0xAA,0xC2,0xDE,0xFF,0xDF,0xF7,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,
-	0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x21,0x48,0x00,0x00,0x20,0x00,0x00,0x08,0x21,0x78,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x30,0x20,0x00,0x20,0x00,0x00,0x30,0x61,0x90,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,
-	0xAA,0xC2,0xDE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0x60,0x20,0x00,0x20,0x00,
-	0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x41,0x60,
-	0x00,0x08,0x00,0x00,0x21,0x48,0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,
-	0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x00,0x18,0x00,0x08,0x41,0x60,0x21,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x00,0x18,0x00,0x00,0x41,0x60,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,
-	0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x00,0x30,0x00,0x18,
-	0x61,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x20,0xA8,0x00,0xB0,0x00,0xB0,
-	0x21,0x48,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0x6D,0xCB,
-	0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB8,0x41,0x60,0x00,0x30,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,
-	0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,
-	0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,
-	0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0xC7,0xB1,0x82,0x71,0x41,0x60,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,
-	0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x61,0x90,0x41,0x60,
-	0xC7,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,
-	0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,
-	0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,0x24,0xB1,
-	0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,
-	0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,
-	0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,
-	0x4D,0x6B,0x41,0x60,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x6D,0xCB,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x6D,0xCB,
-	0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x04,0xA1,0x45,0x29,0x55,0xAD,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,
-	0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,
-	0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,
-	0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xBA,0xEE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0xE7,0x39,0xAA,0xC2,0x20,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0xAA,0xC2,0xDE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0x6D,0xCB,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x71,0xD4,0x4D,0x6B,
-	0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0x8A,0x52,
-	0x4D,0x6B,0x1B,0xF7,0xC7,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x69,0xC2,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDE,0xFF,0xDF,0xF7,0xDE,0xFF,0xAA,0xC2,
-	0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x04,0xA1,0xBA,0xEE,0x99,0xD6,0xE3,0x18,0x55,0xAD,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0x9D,0xEF,0xFF,0xFF,0x55,0xAD,0x45,0x29,0xFB,0xDE,0x7C,0xFF,0x82,0x71,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDE,0xFF,0x69,0xC2,0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x41,0x60,0x91,0x94,0xFF,0xFF,
-	0xCF,0x7B,0xE7,0x39,0x9D,0xEF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x9D,0xEF,0xE7,0x39,0x91,0x94,
-	0xFF,0xFF,0x91,0x94,0xE7,0x39,0xC7,0xB1,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xC7,0xB1,0x7C,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0x7C,0xFF,0xC7,0xB1,
-	0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xC7,0xB1,0x55,0xAD,0xE7,0x39,0xFB,0xDE,0x9D,0xEF,0x45,0x29,0x91,0x94,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x91,0x94,0xE7,0x39,0xDF,0xF7,0x3C,0xE7,0x45,0x29,0x55,0xAD,0x38,0xEE,0x41,0xA0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,
-	0x24,0xB1,0xBA,0xEE,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0x1B,0xF7,0x24,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xA0,0x55,0xDD,0xFF,0xFF,0x4D,0x6B,0x4D,0x6B,
-	0xFF,0xFF,0x91,0x94,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x45,0x29,0x55,0xAD,0xFF,0xFF,
-	0x4D,0x6B,0x8A,0x52,0xFF,0xFF,0xDE,0xFF,0xAA,0xC2,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x42,0xB0,0x38,0xEE,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x38,0xEE,0x24,0xB1,
-	0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x41,0xA0,0xAA,0xC2,0x7C,0xFF,0xFF,0xFF,0x99,0xD6,0x45,0x29,0x18,0xC6,0xFF,0xFF,0xE7,0x39,0x4D,0x6B,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x6B,0x8A,0x52,0xFF,0xFF,0x99,0xD6,0x45,0x29,0x18,0xC6,0xFF,0xFF,0xFF,0xFF,0x38,0xEE,0x04,0xA1,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x20,0xA8,0x55,0xDD,0xFF,0xFF,0xFE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xDD,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x04,0xA1,0x38,0xEE,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xCF,0x7B,
-	0x8A,0x52,0xFF,0xFF,0x18,0xC6,0x45,0x29,0x99,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0x45,0x29,0x18,0xC6,0xFF,0xFF,0x8A,0x52,
-	0x4D,0x6B,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0x71,0xD4,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x71,0xD4,0xFF,0xFF,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0x71,0xD4,0x20,0xA8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x71,0xD4,0xFE,0xFF,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0x3C,0xE7,0xE7,0x39,0x55,0xAD,0xFF,0xFF,0x4D,0x6B,0x8A,0x52,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0x8A,0x52,0x4D,0x6B,0xFF,0xFF,0x55,0xAD,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0x7C,0xFF,0x29,0xC2,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x20,0xA8,0x6D,0xCB,0xFE,0xFF,0xDE,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0x6D,0xCB,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0xC7,0xB1,0x1B,0xF7,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xFE,0xFF,0xFF,0xFF,
-	0x91,0x94,0xE7,0x39,0xDE,0xFF,0x99,0xD6,0x45,0x29,0x55,0xAD,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0x55,0xAD,0x45,0x29,0xFB,0xDE,0xDE,0xFF,0xE7,0x39,0x91,0x94,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x38,0xEE,0x42,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xC7,0xB1,0x7C,0xFF,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xFF,0x29,0xC2,0x00,0xB0,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x42,0xB0,0x55,0xDD,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xE7,0x39,0x91,0x94,0xFF,0xFF,0xCF,0x7B,0xE7,0x39,0x9D,0xEF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x3C,0xE7,0xE7,0x39,0x91,0x94,0xFF,0xFF,0x91,0x94,0x45,0x29,0xFB,0xDE,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x6D,0xCB,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x42,0xB0,0x38,0xEE,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x38,0xEE,0x24,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0xAA,0xC2,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0x9D,0xEF,0x55,0xAD,0xE7,0x39,0x3C,0xE7,0x9D,0xEF,0x45,0x29,0x91,0x94,0x9D,0xEF,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,
-	0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,
-	0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xE7,0x39,0xE7,0x39,0x9D,0xEF,0x3C,0xE7,0xE7,0x39,0x21,0x0A,0xA6,0x3B,
-	0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0x61,0x90,0x00,0xC0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x71,0xD4,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xDF,0xF7,0xFF,0xFF,0x71,0xD4,0x20,0xA8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xC0,0x61,0x90,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0x41,0x09,0xCF,0x7B,0xFF,0xFF,0x55,0xAD,0xE3,0x18,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,
-	0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,
-	0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,
-	0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xA6,0x3B,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,
-	0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,
-	0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,
-	0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0x21,0x0A,0x41,0x09,0x55,0xAD,0xFF,0xFF,0xCF,0x7B,0x41,0x09,0xE2,0x12,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0x40,0x42,0x41,0xA0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB0,0xAA,0xC2,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0xFE,0xFF,0xDE,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x20,0xA8,0x40,0x42,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0x20,0x03,0xE0,0x02,0xE0,0x02,
-	0xE0,0x02,0xE0,0x02,0x21,0x0A,0x45,0x29,0x99,0xD6,0xFF,0xFF,0x8A,0x52,0x41,0x09,0xE2,0x12,0xE0,0x02,0x20,0x03,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,
-	0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,
-	0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,0xE0,0x02,
-	0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,
-	0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,
-	0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0xE2,0x12,0x41,0x09,0x8A,0x52,0xFF,0xFF,0x99,0xD6,0x45,0x29,0x21,0x0A,0x41,0x0B,0x40,0x03,
-	0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0xE2,0x12,0x82,0x71,0x20,0xA8,0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x04,0xA1,0x38,0xEE,0xFF,0xFF,0xFE,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFE,0xFF,0xBA,0xEE,0x04,0xA1,0x00,0xB0,0x00,0xB8,
-	0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x20,0xA8,0x82,0x71,0xE2,0x12,0x20,0x03,0x40,0x03,0x20,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x20,0x03,0x40,0x03,0x40,0x03,0x41,0x0B,0x41,0x09,0x4D,0x6B,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0xE2,0x12,0x41,0x0B,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,
-	0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,
-	0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,
-	0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0xE2,0x12,0xE3,0x18,0x18,0xC6,0xFF,0xFF,0x4D,0x6B,0x41,0x09,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x40,0x42,0x61,0x90,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x41,0xA0,0x71,0xD4,0xFF,0xFF,0xDE,0xFF,0xAA,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xDE,0xFF,0xFF,0xFF,0x71,0xD4,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x61,0x90,0x40,0x42,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x40,0x03,0x41,0x0B,0xE2,0x12,0x41,0x09,0x18,0xC6,0xFF,0xFF,0x4D,0x6B,0x41,0x09,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x41,0x09,0x4D,0x6B,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0xE2,0x12,0xE2,0x12,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x40,0x42,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x24,0xB1,0x1B,0xF7,0xFF,0xFF,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xDE,0xFF,0x7C,0xFF,0xC7,0xB1,0x20,0xA8,0x00,0xB8,0x00,0xC0,
-	0x00,0xB0,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x61,0x90,0x40,0x42,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x21,0x0A,0x8A,0x52,0x9D,0xEF,0x99,0xD6,0x45,0x29,0x21,0x0A,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x21,0x0A,0x45,0x29,0xFB,0xDE,0xDF,0xF7,0x8A,0x52,0x21,0x0A,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE0,0x02,0x40,0x42,0x41,0xA0,0x00,0xC0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB8,0x00,0xB0,0x00,0xB0,0x20,0xA8,0x71,0xD4,0xFF,0xFF,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x29,0xC2,0xFE,0xFF,0x71,0xD4,0x41,0xA0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x41,0xA0,0x40,0x42,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x41,0x09,0x55,0xAD,0xFF,0xFF,0xCF,0x7B,0x41,0x09,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0xE2,0x12,0x41,0x09,0x91,0x94,0xFF,0xFF,0x55,0xAD,0x41,0x09,0xE2,0x12,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x42,0x41,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x04,0xA1,0xBA,0xEE,0xAA,0xC2,0x00,0xB0,0x00,0xB0,0x69,0xC2,0xBA,0xEE,0x04,0xA1,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB8,0x20,0xA8,0x40,0x42,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x21,0x0A,0xE7,0x39,0x9D,0xEF,0x9C,0xE7,0xE7,0x39,0x21,0x0A,0x41,0x0B,0x40,0x03,0x40,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x21,0x0A,0xE7,0x39,0x9D,0xEF,0x9D,0xEF,0xE7,0x39,0x21,0x0A,0x41,0x0B,0x20,0x03,0x20,0x03,0x40,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x40,0x42,0x41,0xA0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA8,0xAA,0xC2,0x29,0xC2,0x00,0xB8,0x00,0xB8,0x29,0xC2,0xAA,0xC2,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x41,0xA0,0x40,0x42,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x41,0x09,0x91,0x94,0xFF,0xFF,0x55,0xAD,0xE3,0x18,0xE2,0x12,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x41,0x09,0x55,0xAD,0xFF,0xFF,0x91,0x94,0x41,0x09,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x40,0x42,0x61,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xC0,0x00,0xB8,0x00,0xB0,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x21,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xC0,0x00,0xB0,0x00,0xB8,0x00,0xB8,
-	0x41,0xA0,0x40,0x42,0x20,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x21,0x0A,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0x8A,0x52,0x41,0x09,0x41,0x0B,0xE0,0x02,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x41,0x09,0x8A,0x52,0xFF,0xFF,0xFB,0xDE,0x45,0x29,0x21,0x0A,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE0,0x02,0x40,0x03,0x40,0x03,0x40,0x42,
-	0x61,0x90,0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0xA8,0x61,0x90,0x40,0x42,0x40,0x03,0x40,0x03,0xE0,0x02,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0xE2,0x12,0x41,0x09,0x4D,0x6B,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0xE2,0x12,0xE2,0x12,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0xE0,0x02,0xE3,0x18,0x18,0xC6,0xFF,0xFF,0x4D,0x6B,0x41,0x09,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x82,0x71,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x82,0x71,0x40,0x42,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0xE2,0x12,0xE2,0x12,0xE3,0x18,0x18,0xC6,0xFF,0xFF,0x4D,0x6B,0x41,0x09,0xE2,0x12,0x20,0x03,0x20,0x03,
-	0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,
-	0x20,0x03,0x20,0x03,0x41,0x0B,0x41,0x09,0x4D,0x6B,0xFF,0xFF,0x18,0xC6,0xE3,0x18,0x21,0x0A,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0xE2,0x12,0x82,0x71,0x41,0xA0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x82,0x71,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE0,0x02,0x40,0x03,0x41,0x0B,0x41,0x09,0x8A,0x52,0xDF,0xF7,0xFB,0xDE,0x45,0x29,0x21,0x0A,0x41,0x0B,0x40,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x21,0x0A,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0x8A,0x52,0x41,0x09,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x40,0x42,0x41,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x20,0xA8,0x82,0x71,0xE2,0x12,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x40,0x03,0xE2,0x12,0xE3,0x18,0x55,0xAD,0xFF,0xFF,0x91,0x94,0x41,0x09,0xE2,0x12,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x40,0x03,0xE2,0x12,0x41,0x09,0x91,0x94,0xFF,0xFF,0x55,0xAD,0x41,0x09,0xE2,0x12,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x40,0x42,0x82,0x71,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x61,0x90,0x40,0x42,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x21,0x0A,0xE7,0x39,0x9D,0xEF,0x3C,0xE7,0xE7,0x39,0x21,0x0A,0x41,0x0B,0x40,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x21,0x0A,0xE7,0x39,0x9D,0xEF,0x9D,0xEF,0xE7,0x39,0x21,0x0A,0xE2,0x12,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x82,0x71,0x20,0xA8,0x20,0xA8,0x82,0x71,0xE2,0x12,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x41,0x09,0x91,0x94,0xFF,0xFF,0x55,0xAD,0xE3,0x18,0xE2,0x12,
-	0x40,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0xE2,0x12,0x20,0x03,
-	0xE2,0x12,0x41,0x09,0x55,0xAD,0xFF,0xFF,0x91,0x94,0x41,0x09,0xE2,0x12,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,0x20,0x03,0xE2,0x12,0x40,0x42,0x40,0x42,0xE2,0x12,0x20,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x41,0x0B,0x21,0x0A,0x45,0x29,0xFB,0xDE,0xFF,0xFF,0x8A,0x52,0x41,0x09,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE0,0x02,0xE2,0x12,0x41,0x09,0x8A,0x52,0xFF,0xFF,0xFB,0xDE,0x45,0x29,0x21,0x0A,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,0x40,0x03,0x40,0x03,0xE0,0x02,0xE0,0x02,0x40,0x03,0x40,0x03,0x20,0x03,0xE0,0x02,0x40,0x03,0x40,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x41,0x09,0xCF,0x7B,0xFF,0xFF,0x18,0xC6,0xE3,0x18,
-	0x21,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0xE2,0x12,
-	0xE3,0x18,0x55,0xAD,0xFF,0xFF,0xCF,0x7B,0x41,0x09,0xE2,0x12,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x41,0x0B,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x21,0x0A,0x45,0x29,0x99,0xD6,0x9C,0xE7,0x8A,0x52,0x41,0x09,0xE2,0x12,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0xE0,0x02,0x41,0x09,0xE7,0x39,0x4D,0x6B,0x45,0x29,0x21,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,0x41,0x09,0xE7,0x39,0xE7,0x39,0x41,0x09,
-	0x21,0x0A,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE2,0x12,
-	0xE2,0x12,0x21,0x0A,0x41,0x09,0x21,0x0A,0xE2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0xE2,0x12,0x21,0x0A,0x21,0x0A,0xE2,0x12,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x41,0x0B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0xE2,0x12,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x40,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,
-	0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,
-	0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,
-	0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,
-	0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,
-	0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,
-	0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,
-	0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,
-	0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,0x41,0x0B,
-	
-
-	// Alpha Channel 
-	
-    };
+ASSET_BIN(face_kenya_dial_img_0_264_data_0, "face_kenya_dial_img_0_264_data_0.bin");
         
 
 
@@ -1826,7 +21,7 @@ const lv_img_dsc_t face_kenya_dial_img_0_264_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 240,
     .header.h = 240,
-    .data_size = sizeof(face_kenya_dial_img_0_264_data_0),
+    .data_size = 115200,
     .header.cf = LV_COLOR_FORMAT_NATIVE,
     .data = face_kenya_dial_img_0_264_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: KENYA
 
 #include "../kenya.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,13 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_kenya_dial_img_1_58372_data_0[] = {
-	//RGB565 data 
-	0xAE,0x73,0xD7,0xBD,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x9C,0xFF,0xFF,0xAE,0x73,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_kenya_dial_img_1_58372_data_0, "face_kenya_dial_img_1_58372_data_0.bin");
         
 
 
@@ -26,7 +21,7 @@ const lv_img_dsc_t face_kenya_dial_img_1_58372_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 3,
     .header.h = 3,
-    .data_size = sizeof(face_kenya_dial_img_1_58372_data_0),
+    .data_size = 27,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_kenya_dial_img_1_58372_data_0};
 
@@ -1,833 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: KENYA
-
-#include "../kenya.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_kenya_dial_img_preview_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x24,0x21,0x00,0x00,0x61,0x08,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0x44,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x7D,0xEF,0xDA,0xD6,0xDA,0xD6,0xDA,0xD6,0xDA,0xD6,0x34,0xA5,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xDA,0xD6,0xDA,0xD6,0xDB,0xDE,0x7D,0xEF,0xBA,0xD6,0x86,0x31,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x14,0xA5,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xA2,0x10,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xE3,0x18,0xE3,0x18,0xE3,0x18,0x65,0x29,0x38,0xC6,0x17,0xBE,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0x6B,0xDE,0xF7,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x55,0xAD,0x86,0x31,0x86,0x31,0x86,0x31,0x86,0x31,0xC3,0x18,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xF7,0xBD,0xD6,0xB5,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x7D,0xEF,0xDA,0xD6,0xDA,0xD6,0xDA,0xD6,0xDA,0xD6,0xCF,0x7B,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x59,0xCE,0x59,0xCE,0x59,0xCE,0x7D,0xEF,0xDA,0xD6,0x04,0x21,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0x14,0xA5,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0x82,0x10,0x00,0x00,0xE7,0x39,0xFF,0xFF,0xE7,0x39,0xE7,0x39,0x28,0x42,0x30,0x84,0x7D,0xEF,0x6D,0x6B,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xAD,0x17,0xBE,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCE,0x73,0xBA,0xD6,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCA,0x52,0xDE,0xF7,0xA2,0x10,0x00,0x00,0xB2,0x94,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xE7,0x39,0xA2,0x10,0x00,0x00,0x24,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xCB,0x5A,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x4C,0x6B,0x85,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0x9A,0xD6,0xEF,0x7B,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA2,0x10,0xB2,0x94,0xBA,0xD6,0x03,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x37,0xBE,0xBD,0xF7,0x0F,0x7C,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0xB2,0x94,0xDE,0xF7,0x17,0xBE,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x13,0x9D,0xDF,0xF7,0xBE,0xF7,0xF3,0x9C,0xA2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0x75,0xAD,0xDE,0xF7,0xDF,0xF7,0xF3,0x9C,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xAE,0x73,0xDF,0xF7,0xDF,0xF7,0xBE,0xF7,0x92,0x94,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0xC3,0x18,0x34,0xA5,0xDE,0xF7,0xDF,0xF7,0xDF,0xF7,0x2C,0x63,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x42,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xBE,0xF7,0xB2,0x94,0x82,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0xA2,0x10,0x54,0xA5,0xDE,0xF7,0xDF,0xF7,0xDF,0xF7,0xBD,0xEF,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xDA,0xD6,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0x9D,0xEF,0xEF,0x7B,0x61,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x82,0x10,0x91,0x8C,0xBE,0xF7,0xDF,0xF7,0xFF,0xFF,0xDF,0xF7,0x79,0xCE,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xDF,0xF7,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0x9D,0xEF,0x6D,0x6B,0x41,0x08,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x61,0x08,0x50,0x8C,0xBE,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xB2,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x5B,0xBE,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0x3C,0xE7,0x08,0x42,
-	0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x88,0x20,0x88,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,
-	0xAA,0x52,0x7D,0xEF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0x9D,0xEF,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x21,0x1B,0xDF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDE,0xF7,0x99,0xCE,
-	0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0x80,0x00,0xB0,0x00,0xB0,0x40,0x80,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x86,0x31,
-	0xFA,0xD6,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDB,0xDE,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xD6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,
-	0xD3,0x9C,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x40,0x80,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x40,0x80,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xB5,0xB5,
-	0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xAD,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,
-	0x5C,0xEF,0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x80,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x40,0x80,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xAA,0x52,0x9D,0xEF,
-	0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xCB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xBA,0xD6,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,
-	0xDF,0xF7,0x54,0xAD,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x21,0x70,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0x70,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xD6,0xBD,0xDF,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xCE,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xAE,0x73,0xBE,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xBD,0xF7,0xA6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x60,0x00,0xA8,0x00,0xB8,0x00,0xA8,0x69,0xC2,0x81,0xB0,0x61,0xB0,0x69,0xC2,0x00,0xA8,0x00,0xB8,0x00,0xB0,0x20,0x60,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xBE,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBD,0xF7,0x2C,0x63,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x21,0x99,0xD6,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x71,0x8C,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x58,0x21,0xB0,0x00,0xB0,0x00,0xB8,0x08,0xB2,0xF7,0xE5,0xA2,0xB0,0x82,0xB0,0x17,0xE6,0x08,0xB2,0x00,0xB0,0x00,0xB0,0x21,0xB0,0x20,0x60,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0x14,0xA5,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x2C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xF7,0x99,0xCE,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x48,0x00,0xA8,0x00,0xB0,0x00,0xB0,0x41,0xB0,0x75,0xDD,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0x75,0xDD,0x41,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x20,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xBA,0xD6,0xDF,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xBD,0xEF,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x14,0xA5,0xBE,0xF7,0xDF,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xF7,0xDB,0xDE,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x21,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0xA6,0xB1,0x3B,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0x3B,0xF7,0xA6,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x20,0xA8,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xDB,0xDE,0xDF,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0xDF,0xF7,0xBE,0xEF,0x91,0x8C,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0xF6,0xBD,0xDF,0xF7,0xDF,0xF7,
-	0xFF,0xFF,0xDE,0xF7,0xDA,0xD6,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x20,0x21,0x90,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x30,0xCC,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDE,0xF7,0x30,0xCC,0x00,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x21,0x98,0x00,0x20,0x00,0x00,0x00,0x00,0xE3,0x18,0xDA,0xD6,0xDE,0xF7,0xFF,0xFF,
-	0xDF,0xF7,0xDF,0xF7,0x75,0xAD,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x58,0xC6,0xBE,0xF7,
-	0xDF,0xF7,0xDF,0xF7,0x17,0xBE,0xA2,0x10,0x00,0x00,0x00,0x08,0x21,0x80,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x41,0xA0,0x18,0xE6,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDF,0xF7,0x38,0xE6,0x41,0xA0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x21,0x80,0x00,0x08,0x00,0x00,0xA2,0x10,0x59,0xC6,0xDE,0xF7,0xDF,0xF7,
-	0xBE,0xF7,0xB6,0xB5,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,
-	0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xA6,0x31,0x30,0x84,
-	0xBA,0xD6,0xDE,0xF7,0x17,0xBE,0x82,0x20,0xE3,0x18,0x41,0x50,0x21,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x65,0xB1,0x5B,0xF7,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x78,0xEE,0xDE,0xF7,0x5C,0xF7,0x65,0xB1,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x21,0xA8,0x41,0x50,0xE3,0x18,0xA2,0x20,0x99,0xCE,0xBD,0xF7,0xB6,0xB5,
-	0x6D,0x6B,0x86,0x31,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,
-	0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,
-	0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x1C,0xE7,0xF3,0x9C,
-	0xEB,0x5A,0x13,0x9D,0x7D,0xEF,0xAA,0x52,0x95,0xC5,0x45,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xCA,0xC2,0xFE,0xFF,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x78,0xEE,0xDE,0xF7,0xDE,0xFF,0xCA,0xC2,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x45,0xB1,0xF3,0xB4,0xEB,0x5A,0x9D,0xEF,0x91,0x94,0xEB,0x5A,
-	0x54,0xAD,0x3C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,
-	0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x5C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,
-	0x3C,0xE7,0x8A,0x52,0x1B,0xE7,0xD7,0xBD,0x04,0x79,0x20,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xCF,0xCB,0xFE,0xFF,0xDE,0xF7,0x99,0xEE,0x82,0xB0,0x82,0xB0,0x58,0xEE,0xDE,0xF7,0xFE,0xFF,0xCF,0xCB,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0xA3,0x80,0x58,0xC6,0x79,0xCE,0xAA,0x52,0x7D,0xEF,
-	0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xDF,0xF7,0x14,0xA5,0x6D,0x6B,0x38,0xE6,0xA2,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0xD3,0xDC,0xFE,0xFF,0xFE,0xFF,0x98,0xEE,0x82,0xB0,0x82,0xB0,0x58,0xEE,0xFE,0xFF,0xFE,0xFF,0x13,0xDD,0x41,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xA2,0xB0,0x38,0xE6,0x2C,0x63,0xF6,0xBD,0xDF,0xF7,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xDF,0xF7,0xBE,0xF7,0x6C,0x7B,0xE6,0xA9,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0xB0,0xD6,0xE5,0xDF,0xF7,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDF,0xF7,0xDF,0xF7,0x17,0xE6,0x61,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x04,0xA1,0xAE,0x83,0xDE,0xF7,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,
-	0xDF,0xF7,0xFE,0xFF,0xF3,0xD4,0x20,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0xB0,0x78,0xEE,0xDE,0xF7,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xDF,0xF7,0xDE,0xF7,0x78,0xEE,0xA2,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x20,0xA8,0xF3,0xD4,0xFE,0xFF,0xDF,0xF7,
-	0xDF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xDE,0xF7,0xDF,0xF7,0xDE,0xF7,0xDE,0xF7,
-	0xDF,0xF7,0x7C,0xF7,0x65,0xA9,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xA2,0xB0,0x99,0xEE,0xFE,0xFF,0xFE,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFF,0xFF,0xFE,0xFF,0xB9,0xEE,0xE3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x65,0xA9,0x3C,0xEF,0xDF,0xF7,
-	0xDE,0xF7,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,0xFF,0xDE,0xF7,
-	0xBE,0xF7,0x91,0xD4,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC3,0xB0,0xD9,0xEE,0xFE,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFF,0xFF,0xFE,0xFF,0xD9,0xEE,0xE3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xA8,0xEF,0xCB,0xBE,0xF7,
-	0xDE,0xFF,0xDF,0xF7,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,0xF7,
-	0xFA,0xEE,0x44,0xB1,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC3,0xB0,0xD9,0xEE,0xFE,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFF,0xFF,0xFE,0xFF,0xD9,0xEE,0xE3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0xB0,0x44,0xB1,0xB9,0xEE,
-	0xDE,0xFF,0xDE,0xFF,0xDE,0xF7,0xDE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,
-	0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,
-	0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xE7,0xB9,0xE7,0xB9,0xE7,0xB9,
-	0x65,0xB1,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC3,0xB0,0xD9,0xEE,0xFE,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFE,0xFF,0xFE,0xFF,0xD9,0xEE,0xC3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x45,0xA9,
-	0xE7,0xB9,0xC6,0xB9,0xE7,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,
-	0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0xC6,0xB9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x21,0xB0,
-	0x00,0x50,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xC2,0xB0,0xB9,0xEE,0xFE,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB8,0x82,0xB8,0x79,0xEE,0xFF,0xFF,0xDE,0xF7,0xDA,0xEE,0xE3,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0x40,
-	0x40,0x98,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0x78,
-	0x00,0x10,0x00,0x98,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xA2,0xB0,0x78,0xEE,0xFF,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB8,0x82,0xB8,0x78,0xEE,0xFF,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x21,0x90,0x00,0x10,
-	0x20,0x60,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0x28,
-	0x00,0x00,0x00,0x68,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x61,0xB0,0x17,0xE6,0xDF,0xF7,0xDF,0xF7,0x99,0xEE,0xA2,0xB8,0x82,0xB8,0x58,0xEE,0xDF,0xF7,0xDF,0xF7,0x17,0xE6,0x61,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0x60,0x00,0x00,
-	0x00,0x20,0x20,0xA0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x21,0x90,0x00,0x08,
-	0x00,0x00,0x00,0x30,0x00,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0x14,0xDD,0xDF,0xF7,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB8,0x58,0xEE,0xDF,0xF7,0xDF,0xF7,0x74,0xDD,0x41,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x20,0xB0,0x00,0x30,0x00,0x00,
-	0x00,0x08,0x20,0x70,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0x40,0x20,0x00,
-	0x00,0x00,0x00,0x10,0x20,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x30,0xCC,0xDF,0xF7,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDF,0xF7,0xDF,0xF7,0x30,0xCC,0x20,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0x90,0x00,0x10,0x00,0x00,
-	0x20,0x00,0x00,0x28,0x21,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x81,0xA0,0xE7,0xC1,0xE7,0xC9,0xE7,0xC9,0xE7,0xC9,0xA2,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xB0,0xC7,0xC1,0xE7,0xC9,0xE7,0xC9,0xE7,0xC9,0xE7,0xC9,0x61,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA0,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x21,0x70,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xEB,0xC2,0xDE,0xFF,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB8,0x58,0xEE,0xDE,0xFF,0xDE,0xFF,0x2C,0xC3,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x21,0x70,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x80,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA8,0x69,0x6A,0x13,0x9D,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xB6,0xB5,0x30,0x84,0xC7,0xA1,0x61,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x98,0x24,0xA9,0xCA,0x7A,0xF3,0x9C,0x18,0xC6,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xF7,0xBD,0x30,0x84,0x08,0x62,0xA2,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0xA8,0x95,0xBD,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x8D,0x93,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0x68,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x65,0xB1,0x7C,0xF7,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xFF,0xFF,0x9D,0xFF,0xA6,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0x50,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x50,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0x98,0x8E,0x9B,0xDB,0xDE,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xF7,0xC5,0xA6,0x61,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xA2,0xA8,0xF3,0xA4,0x1B,0xDF,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0xAE,0xA3,0x61,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x45,0xB1,0xD7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x28,0x62,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xB0,0x58,0xEE,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDF,0xF7,0x58,0xEE,0xA2,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0x20,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x28,0x00,0xA0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0xA8,0x34,0xA5,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x2C,0x83,0x20,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x86,0x51,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xAD,0xE3,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x8D,0x8B,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x04,0xA9,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x10,0x21,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x0F,0xD4,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDE,0xF7,0x50,0xD4,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x21,0x98,0x00,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x10,0x21,0x98,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x81,0xA0,0x95,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xEB,0x7A,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x08,0x62,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xCE,0xC3,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0xA2,0x98,0x69,0xB2,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0xA0,0x95,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0x90,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x68,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xE7,0xB1,0x5C,0xF7,0x99,0xEE,0xA2,0xB8,0x82,0xB8,0x59,0xEE,0x7D,0xF7,0x28,0xBA,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x20,0x78,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x80,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x8E,0x73,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBA,0xD6,0x17,0xCE,0xF7,0xED,0x38,0xC6,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xA6,0x61,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x04,0x51,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xDA,0xD6,0x58,0xD6,0xF7,0xED,0x17,0xE6,0x99,0xCE,0x3C,0xE7,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x8C,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0x98,0x86,0x59,0x10,0xA4,0x79,0xCE,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0x98,0xD2,0xA4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x40,0x70,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0xB0,0xB5,0xDD,0x99,0xEE,0xA2,0xB0,0x82,0xB8,0x59,0xE6,0xF6,0xE5,0x81,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0x58,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x50,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC6,0x81,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xAA,0x72,0xC3,0xA0,0x00,0x98,0x00,0xB8,0x41,0x90,0x24,0xA9,0x91,0x8C,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xCE,0x82,0xA8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0x98,0x75,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xE7,0x61,0xE3,0xA0,0x61,0xA0,0x00,0xB8,0x00,0xB0,0x82,0x98,0x45,0xB1,0xEF,0x9B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xC6,0x81,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x8A,0xBA,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x21,0xB0,0x20,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x38,0x21,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xAA,0xBA,0x37,0xE6,0xA2,0xB8,0x82,0xB8,0x37,0xE6,0xAA,0xBA,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x20,0xB0,0x95,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xA6,0x51,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0x98,0xB2,0xA4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x69,0xB2,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0x91,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xC5,0x82,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x8E,0x93,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x51,0xBC,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC6,0x81,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x21,0xA8,0x20,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x21,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0xA8,0xEB,0xCA,0x82,0xB0,0x82,0xB0,0x0B,0xCB,0x20,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x40,0x98,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x85,0xB9,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x93,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0x98,0xD7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xCE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0x24,0x51,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xCE,0x20,0x98,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0xEB,0x7A,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC3,0x80,0x59,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xAA,0x72,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA0,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x98,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xA0,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x90,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xAE,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x41,0x58,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x08,0x62,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0x61,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x94,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x98,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x82,0x98,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x50,0x84,0x04,0xA9,0x00,0xA8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xF3,0x9C,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xEB,0x5A,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0x88,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x78,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0x88,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB8,0x00,0xB0,0x00,0xB8,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x51,0x8C,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC3,0xA0,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0xC4,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0xB2,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xF7,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x82,0x98,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0x98,0x38,0xC6,0xBA,0xD6,0x91,0xB4,0x24,0x71,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0xAE,0x93,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xA4,0x41,0x98,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x21,0x60,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x68,0x00,0xB0,0x00,0xB8,0x24,0x51,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xC7,0xC1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x95,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xC6,0x61,0x90,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x24,0x71,0xF7,0xED,0xF7,0xED,0xF7,0xED,0xF7,0xED,0xB6,0xE5,0x45,0xB9,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0xF7,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xD6,0x61,0xA0,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0x45,0xB1,0xC2,0xA0,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC7,0x59,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0xBD,0x81,0xA0,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x21,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0xB0,0x00,0xB8,0xAA,0x7A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x24,0xA9,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x6D,0x9B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0xE3,0xA0,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xA2,0x98,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0xCD,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC3,0xA8,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xDE,0x24,0xA9,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x61,0xB0,0x85,0xB1,0x86,0xB1,0x81,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x21,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xB0,0x00,0xB0,0x92,0xBC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x69,0x7A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x86,0xB9,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xAA,0xBA,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xC7,0x61,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0xA8,0xD6,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x72,0x00,0xA8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x82,0xA8,0xD3,0xD4,0x5C,0xF7,0x5C,0xF7,0x75,0xDD,0x82,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0xB0,0x00,0xB0,0xB6,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x82,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x86,0x59,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xE7,0xC1,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0x98,0x2C,0x93,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x94,0x00,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x98,0xEF,0x7B,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xCF,0x9B,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB8,0xEF,0xCB,0xDE,0xF7,0xDE,0xF7,0xBE,0xF7,0xDE,0xF7,0x91,0xD4,0x20,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA8,0x20,0xB0,0x17,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0xB2,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0xA6,0xB9,0xE7,0xC9,0xE7,0xC9,0xAA,0x52,0x30,0x84,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x96,0xBD,0x82,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x0C,0x93,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xB5,0x61,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x21,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC2,0xB0,0x98,0xEE,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xD9,0xEE,0x03,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0xA8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x6B,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x4D,0x6B,0x82,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x86,0x99,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0xC3,0x68,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x85,0xB1,0x5C,0xF7,0x9E,0xEF,0x3C,0xE7,0x1B,0xDF,0xFF,0xFF,0x7D,0xF7,0xE7,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0xA8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x6B,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xC6,0xA6,0x59,0x20,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x41,0x58,0x99,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xE7,0xA1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x28,0xB2,0x7D,0xF7,0x9E,0xEF,0x3C,0xE7,0x1B,0xDF,0xFF,0xFF,0xBE,0xF7,0x69,0xB2,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0xA8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x6B,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0xD3,0xBC,0xC3,0x68,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x41,0xB0,0x55,0xCD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xCE,0xA3,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x20,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xA6,0xB1,0x7D,0xF7,0x5C,0xE7,0x5C,0xE7,0x75,0xAD,0xDF,0xF7,0x9D,0xF7,0x49,0xB2,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0xA8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x6B,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0xA0,0xD3,0xC4,0xF7,0xED,0xF7,0xED,0x79,0xCE,0xBA,0xD6,0x5C,0xE7,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0xA6,0x99,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x2C,0x83,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x94,0x20,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x03,0xB1,0xFB,0xEE,0xDF,0xF7,0xDE,0xF7,0xBD,0xEF,0xDF,0xF7,0x3C,0xF7,0x45,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0xA8,0x82,0x98,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x6B,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0x98,0xC3,0xA0,0x65,0x91,0x0F,0x7C,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x65,0x79,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x08,0x6A,
-	0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xCE,0xA2,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xB0,0x75,0xDD,0xDE,0xF7,0xDE,0xF7,0xDE,0xF7,0xDE,0xF7,0xB5,0xE5,0x82,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA8,0x00,0xB0,0xF7,0xED,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xE6,0x20,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0xA0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xC9,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x69,0x6A,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0x41,0x90,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xB6,0xDD,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x65,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xA6,0xB1,0xFB,0xEE,0xDE,0xF7,0xDE,0xF7,0x3C,0xEF,0x08,0xBA,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xA8,0x00,0xB0,0x55,0xD5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x82,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x86,0x59,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xC7,0xC1,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0x51,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x65,0xB1,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xF7,0xED,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xAD,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0x0F,0x7C,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x8C,0x8D,0x6B,0x8D,0x6B,0x8D,0x6B,0xAA,0x82,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x21,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x08,0xB2,0x34,0xDD,0x54,0xDD,0x08,0xB2,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0xA8,0x00,0xB0,0x10,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0xE3,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xCB,0x82,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x45,0xB1,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x86,0x59,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0xB2,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xF7,0xED,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB0,0x00,0xB0,0x00,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x21,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xA8,0x40,0xB0,0x41,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0xB0,0x00,0xB0,0x8A,0x7A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0x45,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x10,0xAC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0xC3,0xA0,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0xA0,0xD3,0xC4,0xF7,0xED,0xF7,0xED,0xF7,0xED,0xF7,0xED,0xD3,0xC4,0x61,0xA0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x98,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x6B,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xF7,0xED,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB0,0x00,0xB0,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0xB0,0x00,0xB0,0x82,0x60,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x69,0xB2,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0x17,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xC5,0x20,0x98,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xD6,0xE5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xCE,0xA2,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8D,0x6B,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xF7,0xED,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xED,0x00,0xB0,0x00,0xB8,0x21,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xA8,0x00,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x21,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x70,0x00,0xB0,0x00,0xB0,0x00,0xB8,0xB6,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0xA5,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x04,0xA9,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0xA3,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xB2,0xC4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0x24,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC3,0x68,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x5A,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xD3,0xC4,
-	0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x79,0xCE,0x9A,0xD6,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x79,0xCE,0x79,0xCE,0x79,0xCE,0xD3,0xC4,0x00,0xB8,0x00,0xB8,0x21,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC3,0xB0,0x40,0xA8,0x40,0xA8,0xC3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x78,0x00,0xB0,0x00,0xB8,0x00,0xB8,0xCA,0x7A,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x48,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x0C,0x63,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xC3,0x68,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x49,0x72,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEB,0x5A,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x6D,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xA6,0xC1,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x61,0xA0,
-	0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x82,0x98,0x65,0x91,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x62,0x82,0x98,0x82,0x98,0x82,0x98,0x61,0xA0,0x00,0xB0,0x00,0xB8,0x20,0xA0,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xA2,0xA0,0xF3,0xD4,0xA2,0xB0,0x82,0xB0,0xD2,0xD4,0x04,0xA9,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,0x90,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x04,0xA9,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xB5,0x41,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xC3,0x68,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0x9D,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0x98,0x5C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0xC3,0x68,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA8,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xD6,0xE3,0xA0,0x00,0xB8,0x00,0xB8,
-	0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x68,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0xB0,0xEF,0xD3,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0x91,0xD4,0x20,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x41,0x98,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x20,0xA8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0x98,0x91,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x4D,0x6B,0x41,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x24,0x89,0x79,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xC7,0x59,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x0F,0x7C,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0x65,0x91,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x04,0xA9,0x95,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xA4,0x00,0x98,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x80,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x03,0xB1,0xD9,0xEE,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xDA,0xEE,0x03,0xB1,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0xA0,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x82,0xA8,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x96,0xBD,0x69,0x7A,0x41,0x58,0x00,0xB8,0xC3,0x40,0x2C,0x93,0xDA,0xD6,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xBC,0x20,0xB0,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x24,0x89,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x1B,0xDF,0x91,0xBC,0xE7,0x61,0x00,0xB8,0x00,0xB8,0x20,0x98,0xE7,0x69,0x30,0xAC,0xFB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xE7,0xE3,0x48,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x40,0x78,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x98,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x0B,0xC3,0xBD,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xBD,0xF7,0x6D,0xC3,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0xB0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0x40,0x78,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x28,0x62,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xCE,0x82,0x60,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x0C,0x93,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xEB,0x7A,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x20,0x98,0x00,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x21,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xA8,0x13,0xDD,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDF,0xF7,0x96,0xDD,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x21,0xB0,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x18,0x00,0x98,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0x6D,0x8B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xDF,0x65,0x91,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x98,0x2C,0x63,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x8B,0x20,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xA8,0x00,0x30,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x48,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA8,0xDA,0xEE,0xDF,0xF7,0x99,0xEE,0x82,0xB0,0x82,0xB0,0x78,0xEE,0xDF,0xF7,0x1B,0xEF,0xE4,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x40,0x70,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x08,0x00,0x00,0x00,0x30,0x00,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x4C,0x83,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x38,0xC6,0x24,0x71,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x98,0xCB,0x82,0xDA,0xD6,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x79,0xCE,0x28,0x62,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x65,0xB9,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAA,0x82,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x21,0x58,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x48,0xBA,0xDD,0xFF,0xDE,0xF7,0x99,0xEE,0x82,0xB0,0x82,0xB0,0x78,0xEE,0xDE,0xF7,0xDD,0xFF,0x49,0xBA,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x20,0x88,0x00,0x08,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x58,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x24,0xB1,0xF3,0x9C,0x9D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xD6,0x0B,0x83,0x82,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0xE3,0xA0,0xAE,0x93,0xBA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xCE,0xCB,0x5A,0xA2,0xA0,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0x78,0x00,0x08,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x08,0x21,0x80,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x6D,0xCB,0xFE,0xFF,0xDE,0xF7,0x99,0xEE,0xA2,0xB8,0x82,0xB8,0x58,0xEE,0xDE,0xFF,0xFE,0xFF,0x8D,0xC3,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0xA0,0x00,0x18,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x08,0x20,0x90,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x82,0x60,0x0B,0x8B,0x30,0xB4,0xF7,0xED,0xF7,0xED,0x95,0xDD,0x10,0xAC,0x28,0x72,0x20,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x98,0xC7,0x61,0x6D,0x9B,0xB2,0xC4,0xF7,0xED,0xF7,0xED,0xD6,0xE5,0xB2,0xC4,0x4D,0x9B,0x86,0x59,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x21,0xA8,0x00,0x28,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x10,0x21,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x91,0xD4,0xFE,0xFF,0xDE,0xF7,0x98,0xEE,0xA2,0xB0,0x82,0xB8,0x58,0xEE,0xDE,0xF7,0xDE,0xFF,0xB2,0xD4,0x20,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0x40,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x28,0x20,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0x50,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x38,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xB0,0x74,0xDD,0xFE,0xFF,0xDE,0xF7,0x98,0xEE,0x82,0xB0,0x82,0xB0,0x78,0xEE,0xDE,0xF7,0xDE,0xFF,0xB5,0xE5,0x41,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x21,0x60,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x60,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0x88,0x00,0x10,
-	0x00,0x00,0x00,0x00,0x20,0x68,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x62,0xB0,0x38,0xEE,0xDE,0xF7,0xDE,0xF7,0x98,0xEE,0x82,0xB0,0x82,0xB0,0x78,0xEE,0xDE,0xF7,0xDE,0xF7,0x58,0xEE,0x82,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x41,0x90,0x00,0x08,0x00,0x00,
-	0x00,0x10,0x20,0x90,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x20,0xA8,0x00,0x28,
-	0x00,0x00,0x00,0x08,0x21,0x88,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xA2,0xB0,0x79,0xEE,0xDE,0xF7,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFE,0xFF,0xDE,0xF7,0xB9,0xEE,0xC2,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x21,0xB0,0x20,0x38,0x00,0x00,
-	0x00,0x28,0x20,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x20,0x68,
-	0x00,0x00,0x00,0x30,0x20,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC3,0xB0,0xB9,0xEE,0xFE,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFF,0xFF,0xFE,0xFF,0xD9,0xEE,0xC3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x40,0x68,0x00,0x08,
-	0x20,0x68,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,
-	0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x20,0xA8,
-	0x00,0x18,0x20,0x50,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC3,0xB0,0xD9,0xEE,0xFE,0xFF,0xFE,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFF,0xFF,0xDE,0xFF,0xD9,0xEE,0xC3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0x88,0x00,0x20,
-	0x40,0x98,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,
-	0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,
-	0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xE3,0xA8,0x24,0xB1,
-	0xE1,0x60,0x00,0x98,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC3,0xB0,0xD9,0xEE,0xFE,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFF,0xFF,0xDE,0xFF,0xD9,0xEE,0xC3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x20,0xB0,0x20,0x60,
-	0x44,0xA9,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,
-	0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0xC3,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,
-	0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0x9A,0xE6,
-	0x69,0x62,0x40,0xA0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xC3,0xB0,0xB9,0xEE,0xFE,0xFF,0xFF,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x79,0xEE,0xFE,0xFF,0xDE,0xF7,0xD9,0xEE,0xE3,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x81,0xB0,0xC7,0x51,
-	0x34,0xAD,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,
-	0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0xFB,0xEE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0x91,0x8C,
-	0xAE,0x7B,0x89,0xBA,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0xA2,0xB0,0x78,0xEE,0xFE,0xFF,0xDE,0xFF,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDE,0xFF,0xDE,0xF7,0x99,0xEE,0xC2,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x08,0xB2,0xD6,0xC5,
-	0x69,0x4A,0x7D,0xEF,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xBD,0xEF,0xFB,0xDE,0xAA,0x52,
-	0x1B,0xE7,0xE8,0x82,0x61,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x82,0xB0,0x58,0xEE,0xFE,0xFF,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDF,0xF7,0xDF,0xF7,0x58,0xEE,0xA2,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x62,0xB0,0x08,0x72,0xBA,0xD6,
-	0xEF,0x7B,0x95,0xAD,0xDF,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDE,0xF7,0x70,0x8C,0xB6,0xB5,
-	0x17,0xBE,0xCF,0x7B,0xCF,0xCB,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x41,0xB0,0x75,0xDD,0xFE,0xFF,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x78,0xEE,0xDF,0xF7,0xDF,0xF7,0xB5,0xE5,0x41,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x4D,0xC3,0x38,0xC6,0xCF,0x7B,
-	0xDA,0xD6,0x69,0x4A,0x5C,0xE7,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xCE,0xAA,0x52,0x3C,0xE7,
-	0xEB,0x5A,0xDA,0xD6,0xBA,0xEE,0x24,0xA9,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x91,0xD4,0xFE,0xFF,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDF,0xF7,0xDF,0xF7,0xB2,0xD4,0x20,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x24,0xA9,0x99,0xEE,0x9D,0xEF,0x2C,0x63,
-	0xD7,0xBD,0x30,0x84,0xEF,0x7B,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xEF,0xEB,0x5A,0xD7,0xBD,0x92,0x94,
-	0xEF,0x7B,0xBE,0xF7,0xBE,0xF7,0x91,0xD4,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x6D,0xCB,0xDE,0xFF,0xDE,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDE,0xFF,0xDE,0xFF,0x8D,0xC3,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x91,0xD4,0xBE,0xF7,0xDE,0xF7,0xBA,0xD6,
-	0x0B,0x5B,0x1B,0xDF,0xEB,0x5A,0xDA,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xDF,0xF7,0xF7,0xBD,0xAE,0x73,0x1B,0xDF,0xAA,0x52,
-	0x5C,0xE7,0xDF,0xF7,0xDF,0xF7,0x9D,0xF7,0x69,0xC2,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x48,0xBA,0xDD,0xFF,0xDE,0xF7,0x99,0xEE,0xA2,0xB8,0x82,0xB8,0x58,0xEE,0xDE,0xFF,0xDD,0xFF,0x49,0xBA,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x08,0xBA,0x7C,0xF7,0xDF,0xF7,0xDE,0xF7,0xFE,0xFF,
-	0x70,0x8C,0xB5,0xB5,0x95,0xB5,0xCF,0x7B,0xDE,0xF7,0xDF,0xF7,0xDF,0xF7,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x7C,0xE7,0xEB,0x5A,0xBA,0xD6,0x50,0x8C,0x13,0xA5,
-	0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x16,0xDE,0xA2,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x62,0xB0,0xDA,0xEE,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDF,0xF7,0xDA,0xEE,0x04,0xB1,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x82,0xB0,0xB5,0xD5,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0xBA,0xD6,0x0B,0x5B,0x3C,0xE7,0xAA,0x52,0xD6,0xBD,0x9C,0xEF,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,
-	0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x9C,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,
-	0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x05,0x2A,0xEF,0x7B,0xBA,0xD6,0xE4,0x21,0x23,0x23,
-	0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x81,0x69,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0xF3,0xD4,0xDF,0xF7,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x58,0xEE,0xDE,0xF7,0xF3,0xD4,0x00,0xA8,0x00,0xB8,0x00,0xB8,0x00,0xB8,0x00,0xB0,0x00,0xB8,0x81,0x69,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x84,0x2B,0x64,0x2B,
-	0x64,0x2B,0xE1,0x11,0x30,0x84,0x59,0xCE,0xA4,0x29,0x45,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,
-	0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x64,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x81,0x0A,0x06,0x32,0x3C,0xE7,0x2C,0x63,0x21,0x0A,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x20,0x03,0xC1,0x12,0xE1,0x88,0x00,0xA8,0x00,0xB0,0x00,0xB8,0x00,0xB8,0x00,0xB0,0xAA,0xBA,0x9D,0xF7,0x99,0xEE,0xA2,0xB8,0x82,0xB8,0x58,0xEE,0xBD,0xF7,0xCA,0xBA,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xA8,0xE1,0x88,0xC1,0x12,0x20,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x00,0x03,
-	0x20,0x03,0x00,0x03,0xE5,0x29,0xFB,0xDE,0x10,0x84,0x62,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE1,0x0A,0x22,0x12,0x34,0xA5,0x38,0xC6,0xE3,0x19,0xE1,0x0A,0x20,0x03,
-	0x20,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x42,0x40,0x98,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x04,0xA9,0xBA,0xEE,0x99,0xEE,0xA2,0xB8,0x82,0xB8,0x58,0xEE,0xDA,0xEE,0x04,0xA9,0x00,0xB8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x40,0x98,0x00,0x42,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x81,0x0A,0x2F,0x7C,0xDA,0xDE,0xE5,0x29,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x81,0x0A,0x68,0x42,0x5D,0xE7,0x0A,0x53,0xC1,0x0A,0x00,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x00,0x42,0x20,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xA8,0xEE,0xCB,0x99,0xEE,0xA2,0xB0,0x82,0xB0,0x78,0xEE,0x0F,0xCC,0x20,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x20,0xA8,0x00,0x42,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x00,0x03,0xC2,0x11,0x58,0xC6,0x30,0x84,0xC1,0x09,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xA2,0x11,0xF6,0xBD,0x54,0xA5,0xC1,0x09,0x00,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x42,0x40,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x82,0xA0,0xD3,0xD4,0xA2,0xB0,0x82,0xB0,0xD2,0xD4,0x82,0xA0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x20,0xA8,0x00,0x4A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x81,0x0A,0xEA,0x52,0x7C,0xE7,0x88,0x42,0xC1,0x0A,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x81,0x0A,0xAD,0x6B,0x3B,0xE7,0x66,0x3A,0xC1,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x42,0x20,0xA0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xA2,0xB0,0x20,0xB0,0x20,0xB8,0xA2,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x20,0xA8,0x00,0x42,0x00,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x21,0x0B,0xE2,0x11,0xF7,0xBD,0xF7,0xBD,0xC3,0x19,0x20,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xA4,0x21,0xDA,0xD6,0xD2,0x94,0x02,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x20,0x03,0x00,0x42,0x80,0x90,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x00,0xB0,0x80,0x90,0x00,0x42,0x20,0x03,0x00,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x81,0x0A,0x68,0x42,0x3C,0xE7,0xAA,0x52,0x81,0x0A,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x02,0xCF,0x7B,0xBA,0xD6,0x84,0x21,0xC1,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xA1,0x1A,0xE1,0x88,0x00,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB8,0x00,0xB0,0x00,0xB0,0xE1,0x88,0xA1,0x22,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x20,0x03,0xA1,0x09,0x71,0x8C,0x79,0xCE,0x83,0x19,0x00,0x03,0x20,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC1,0x0A,0x06,0x32,0x3C,0xE7,0x6D,0x6B,0xE1,0x09,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC1,0x12,0x20,0x71,0x40,0xA8,0x00,0xB0,0x00,0xB0,0x00,0xB0,0xE0,0x80,0xA1,0x1A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE1,0x0A,0x06,0x32,0xFB,0xDE,0x2F,0x84,0x62,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x22,0x12,0x94,0xAD,0x78,0xC6,0x23,0x1A,0xE1,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE0,0x0A,0x21,0x3A,0x40,0xA0,0x40,0xA0,0xE1,0x41,0xE0,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x62,0x12,0x4F,0x84,0xFB,0xDE,0x06,0x32,0x01,0x0B,0x40,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE1,0x0A,0xA1,0x0A,0xA8,0x42,0x3C,0xE7,0x2A,0x5B,0x81,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x00,0x03,0x20,0x03,0x00,0x03,0x80,0x22,0xA0,0x22,0x00,0x03,0x20,0x03,0x00,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x83,0x19,0x99,0xCE,0x91,0x8C,0x81,0x09,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x01,0x0B,0x62,0x11,0x75,0xAD,0x75,0xAD,0xA2,0x11,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x02,0x2C,0x63,0x1A,0xDF,0xE6,0x31,0x81,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE1,0x09,0x26,0x32,0xC5,0x29,0x81,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x01,0x0B,0xA2,0x11,0xE5,0x29,0xC1,0x09,0xE0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0xE1,0x0A,0xC0,0x02,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0xC1,0x0A,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xA0,0x02,0xC8,0x43,0xD7,0xBD,0x29,0x4B,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x41,0x0B,0x4E,0x74,0x3C,0xE7,0x7D,0xEF,0x1B,0xDF,0x4D,0x6B,0xC1,0x0A,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xAC,0x63,0xFB,0xDE,0x9D,0xEF,0x58,0xC6,0x66,0x33,0x20,0x03,0x20,0x03,
-	0x42,0x12,0x30,0x84,0x3C,0xE7,0x7D,0xEF,0x38,0xC6,0xA7,0x3B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x63,0x1B,0xB5,0xAD,0x7D,0xEF,0xFF,0xFF,0xCC,0x63,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x0D,0x6C,0x7D,0xEF,0x4A,0x53,0xC5,0x2B,0x6D,0x6B,0x9D,0xEF,0xCB,0x5B,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC8,0x42,0x9D,0xEF,0xED,0x6B,0xE6,0x33,0xD3,0x9C,0x3C,0xE7,0xE2,0x11,0x20,0x03,
-	0xB2,0x94,0xFB,0xDE,0x09,0x4B,0xC5,0x2B,0x30,0x84,0x3C,0xE7,0x84,0x22,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x06,0x34,0x58,0xC6,0x4E,0x74,0x7D,0xEF,0xCC,0x63,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x54,0xA5,0x30,0x84,0x20,0x03,0x20,0x03,0xE2,0x12,0x99,0xCE,0x92,0x95,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x17,0xBE,0x34,0xA5,0x20,0x03,0x20,0x03,0x64,0x23,0xFB,0xDE,0xCF,0x7C,0xA0,0x02,
-	0x9D,0xEF,0xAC,0x63,0x20,0x03,0x20,0x03,0x23,0x1B,0xBA,0xD6,0xF0,0x84,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC1,0x0A,0xC5,0x2B,0x7D,0xEF,0xCC,0x63,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x23,0x1B,0xC1,0x0A,0x20,0x03,0x20,0x03,0x26,0x32,0x5C,0xE7,0x2D,0x6C,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xBE,0xF7,0xAA,0x52,0x20,0x03,0x20,0x03,0x81,0x0A,0x38,0xC6,0x96,0xB6,0x41,0x09,
-	0xFF,0xFF,0xC8,0x42,0x20,0x03,0x20,0x03,0xC2,0x12,0x79,0xCE,0x96,0xB6,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC5,0x2B,0x7D,0xEF,0xCC,0x63,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xE6,0x33,0x79,0xCE,0x9D,0xEF,0xF3,0x9C,0xA0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x04,0x22,0xFF,0xFF,0x47,0x3C,0x20,0x03,0x20,0x03,0x20,0x03,0xB7,0xBE,0x58,0xC6,0xC1,0x0A,
-	0xFB,0xDE,0x75,0xAD,0x03,0x1B,0xC1,0x0A,0xE8,0x43,0x5C,0xE7,0x79,0xCE,0xC2,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC5,0x2B,0x7D,0xEF,0xCC,0x63,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x62,0x13,0x47,0x3C,0xAE,0x73,0xFB,0xDE,0xEC,0x63,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xA3,0x19,0xFF,0xFF,0x47,0x3C,0x20,0x03,0x20,0x03,0x20,0x03,0xB7,0xBE,0x38,0xC6,0xA1,0x0A,
-	0xE8,0x43,0x5C,0xE7,0xBA,0xD6,0x79,0xCE,0x58,0xC6,0xFB,0xDE,0xB7,0xBE,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC5,0x2B,0x7D,0xEF,0xCC,0x63,0x20,0x03,
-	0x20,0x03,0xA0,0x02,0x47,0x3C,0x02,0x13,0x20,0x03,0x20,0x03,0xA0,0x02,0x58,0xC6,0x38,0xC6,0x80,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x9D,0xEF,0x0C,0x63,0x20,0x03,0x20,0x03,0xC1,0x0A,0x79,0xCE,0x76,0xB6,0x20,0x03,
-	0x20,0x03,0x84,0x22,0x0D,0x6C,0x0D,0x6C,0x63,0x19,0x38,0xC6,0xF4,0xA5,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC5,0x2B,0x7D,0xEF,0xCC,0x63,0x20,0x03,
-	0x20,0x03,0xA0,0x02,0x5C,0xE7,0x30,0x84,0x20,0x03,0x20,0x03,0xE1,0x0A,0x78,0xC6,0xB7,0xBE,0x00,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x34,0xA5,0xD7,0xBD,0x20,0x03,0x20,0x03,0xA5,0x2B,0x3C,0xE7,0xEC,0x63,0x20,0x03,
-	0x92,0x95,0xEC,0x63,0x20,0x03,0x20,0x03,0x85,0x2B,0x3C,0xE7,0x6A,0x53,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0xC5,0x2B,0x7D,0xEF,0xCC,0x63,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x4E,0x74,0xBE,0xF7,0x10,0x84,0x49,0x4A,0x14,0xA5,0x7D,0xEF,0x4A,0x53,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x47,0x3A,0x5C,0xE7,0xF3,0x9C,0xAA,0x52,0x38,0xC6,0x79,0xCE,0xA1,0x09,0x20,0x03,
-	0x0D,0x6C,0x7D,0xEF,0xED,0x6B,0x2A,0x53,0x17,0xBE,0x95,0xAD,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x43,0x1B,0xB2,0x94,0xA7,0x3A,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x41,0x0B,0x8B,0x5B,0xD6,0xB5,0x79,0xCE,0x34,0xA5,0xC8,0x43,0xA0,0x02,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x03,0xA8,0x42,0x95,0xAD,0x79,0xCE,0x92,0x94,0xA3,0x1A,0x20,0x03,0x20,0x03,
-	0x41,0x0B,0x0D,0x6C,0x17,0xBE,0x79,0xCE,0xEF,0x7B,0x42,0x12,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,
-	0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x20,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	
-
-	// Alpha Channel 
-	
-    };
-        
-
-
-const lv_img_dsc_t face_kenya_dial_img_preview_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 160,
-    .header.h = 160,
-    .data_size = sizeof(face_kenya_dial_img_preview_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE,
-    .data = face_kenya_dial_img_preview_data_0};
-
-    
\ No newline at end of file
@@ -189,9 +189,11 @@ void init_face_kenya(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_
     lv_obj_set_y(face_kenya_12_85153, 25);
     lv_obj_add_flag(face_kenya_12_85153, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_kenya_12_85153, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_kenya_0_264);
+	face_compositor_static(face_kenya_1_58372);
 
 
-    callback("Kenya", &face_kenya_dial_img_preview_0, &face_kenya, NULL);
+    callback("Kenya", NULL, &face_kenya, NULL);
 
 #endif
 }
@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_KENYA // (Kenya) uncomment to enable or define it elsewhere
 
@@ -68,8 +69,6 @@ extern "C"
 	LV_IMG_DECLARE(face_kenya_dial_img_12_85153_4);
 	LV_IMG_DECLARE(face_kenya_dial_img_12_85153_5);
 	LV_IMG_DECLARE(face_kenya_dial_img_12_85153_6);
-	LV_IMG_DECLARE(face_kenya_dial_img_preview_0);
-	LV_IMG_DECLARE(face_kenya_dial_img_preview_0);
 
 
 #endif
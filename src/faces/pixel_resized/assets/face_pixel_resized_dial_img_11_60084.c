@@ -5,6 +5,7 @@
 // Watchface: PIXEL_RESIZED
 
 #include "../pixel_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,35 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_11_60084_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x41,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x75,0xAD,0xA6,0x31,0x00,0x00,0x00,0x00,0x50,0x84,0x6D,0x6B,0x00,0x00,0x00,0x00,0x08,0x42,0x34,0xA5,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x79,0xCE,0x08,0x42,0x00,0x00,0x00,0x00,0xD3,0x9C,0xEF,0x7B,0x00,0x00,0x00,0x00,0x69,0x4A,0x18,0xC6,0x03,0x19,0x00,0x00,0x82,0x10,
-	0x24,0x21,0x24,0x21,0x41,0x08,0x00,0x00,0x20,0x00,0xC2,0x10,0x03,0x19,0x24,0x21,0xA2,0x10,0x20,0x00,0x81,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0xC2,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x59,0xCE,0xE7,0x39,0x00,0x00,0x00,0x00,0xB2,0x94,0xEF,0x7B,0x00,0x00,0x00,0x00,
-	0x49,0x4A,0xF7,0xBD,0xE3,0x18,0x61,0x08,0x92,0x94,0x55,0xAD,0xB6,0xB5,0xF3,0x9C,0xA2,0x10,0x45,0x29,0xF7,0xBD,0xB6,0xB5,0x96,0xB5,0x8E,0x73,0x69,0x4A,0x71,0x8C,0x20,0x00,0x00,0x00,0xCB,0x5A,0x9A,0xD6,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x59,0xCE,0xE7,0x39,0x00,0x00,
-	0x00,0x00,0xB2,0x94,0xEF,0x7B,0x00,0x00,0x00,0x00,0x49,0x4A,0xF7,0xBD,0xE3,0x18,0x20,0x00,0x04,0x21,0x81,0x08,0x24,0x21,0xB6,0xB5,0x8A,0x52,0xA6,0x31,0xF8,0xC5,0xA6,0x31,0xC3,0x18,0x82,0x10,0xCB,0x5A,0x55,0xAD,0x20,0x00,0x65,0x29,0xB6,0xB5,0x7A,0xD6,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xA2,0x10,0x59,0xCE,0xE7,0x39,0x00,0x00,0x00,0x00,0xB2,0x94,0xEF,0x7B,0x00,0x00,0x00,0x00,0x49,0x4A,0xF7,0xBD,0xE3,0x18,0x20,0x00,0x28,0x42,0xAE,0x73,0x30,0x84,0x79,0xCE,0xEB,0x5A,0xA6,0x31,0xD7,0xBD,0xE4,0x20,0x00,0x00,0x00,0x00,0xCB,0x5A,0x34,0xA5,0x81,0x08,0xD3,0x9C,0xAE,0x73,0x14,0xA5,0xAA,0x52,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x59,0xCE,0xE7,0x39,0x00,0x00,0x00,0x00,0xB2,0x94,0xEF,0x7B,0x00,0x00,0x00,0x00,0x49,0x4A,0xF7,0xBD,0xE3,0x18,0x8E,0x73,0x96,0xB5,0xAA,0x52,0xE7,0x39,0xB6,0xB5,0xEB,0x5A,0xA6,0x31,0xD7,0xBD,0x04,0x21,0x00,0x00,0x00,0x00,0xCB,0x5A,0xF3,0x9C,0x2C,0x63,
-	0xF4,0xA4,0xE3,0x18,0x34,0xA5,0x8A,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x59,0xCE,0x28,0x42,0x20,0x00,0x41,0x08,0xF3,0x9C,0x30,0x84,0x40,0x00,0x20,0x00,0x8A,0x52,0x18,0xC6,0x65,0x29,0x55,0xAD,0xAE,0x73,0x00,0x00,0x44,0x21,0x59,0xCE,0x0C,0x63,0xA6,0x31,0xD7,0xBD,0x24,0x21,
-	0x00,0x00,0x00,0x00,0xAA,0x52,0x79,0xCE,0xD7,0xBD,0x65,0x29,0x41,0x08,0x75,0xAD,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x39,0xCE,0x18,0xC6,0x95,0xAD,0x96,0xB5,0xBA,0xD6,0x59,0xCE,0x95,0xAD,0x95,0xAD,0x38,0xC6,0x96,0xB5,0xA2,0x10,0x2C,0x63,0x18,0xC6,0xD3,0x9C,0xB2,0x94,
-	0x75,0xAD,0x8A,0x52,0x85,0x29,0x34,0xA5,0x04,0x21,0x00,0x00,0x00,0x00,0x49,0x4A,0xBB,0xDE,0x2C,0x63,0x00,0x00,0x61,0x08,0xF3,0x9C,0x49,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xC7,0x39,0xC7,0x39,0xC7,0x39,0xA6,0x31,0xA6,0x31,0xC7,0x39,0xC7,0x39,0xC7,0x39,0x24,0x21,
-	0x00,0x00,0x00,0x00,0x86,0x31,0x48,0x42,0xE3,0x18,0xA2,0x10,0x81,0x08,0x41,0x08,0x24,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x45,0x29,0x40,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x81,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,
-	0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_11_60084_data_0, "face_pixel_resized_dial_img_11_60084_data_0.bin");
         
 
 
@@ -48,7 +21,7 @@ const lv_img_dsc_t face_pixel_resized_dial_img_11_60084_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 37,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_11_60084_data_0),
+    .data_size = 1443,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_11_60084_data_0};
 
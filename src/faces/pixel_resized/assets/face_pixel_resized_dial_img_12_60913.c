@@ -5,6 +5,7 @@
 // Watchface: PIXEL_RESIZED
 
 #include "../pixel_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,35 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_12_60913_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x44,0x21,0x03,0x19,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x4C,0x63,0x96,0xB5,0x14,0xA5,0xD7,0xBD,0x92,0x94,0x61,0x08,0x00,0x00,0xE7,0x39,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0xD7,0xBD,0xA6,0x31,0x61,0x08,0x24,0x21,0xEB,0x5A,0x82,0x10,0x24,0x21,0xD7,0xBD,0x4C,0x63,0x03,0x19,0x40,0x00,0x00,0x00,0x61,0x08,0x85,0x29,
-	0x44,0x21,0x61,0x08,0x00,0x00,0x20,0x00,0x82,0x10,0x61,0x08,0x44,0x21,0x44,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x85,0x29,0x44,0x21,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x31,0x79,0xCE,0x85,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xAE,0x73,0x79,0xCE,0x96,0xB5,
-	0x92,0x94,0x24,0x21,0x24,0x21,0x14,0xA5,0x14,0xA5,0x55,0xAD,0x92,0x94,0x82,0x10,0x85,0x29,0x75,0xAD,0x92,0x94,0xF3,0x9C,0xD7,0xBD,0x10,0x84,0x61,0x08,0x24,0x21,0x14,0xA5,0xF3,0x9C,0x55,0xAD,0xAE,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xAE,0x73,0xD7,0xBD,0xD3,0x9C,0x4C,0x63,
-	0x03,0x19,0x00,0x00,0xC3,0x18,0x96,0xB5,0x89,0x4A,0x61,0x08,0x61,0x08,0xF3,0x9C,0xAE,0x73,0x20,0x00,0xA2,0x10,0x14,0xA5,0xEB,0x5A,0xA6,0x31,0x79,0xCE,0xEB,0x5A,0x61,0x08,0x44,0x21,0x96,0xB5,0xEB,0x5A,0xEB,0x5A,0x55,0xAD,0x61,0x08,0x61,0x08,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x85,0x29,0x4C,0x63,0x55,0xAD,0xD7,0xBD,0x44,0x21,0x61,0x08,0x96,0xB5,0x28,0x42,0x00,0x00,0xC2,0x10,0x79,0xCE,0xF3,0x9C,0xAE,0x73,0xAE,0x73,0xD7,0xBD,0xAE,0x73,0xA6,0x31,0x96,0xB5,0xC2,0x10,0x00,0x00,0x00,0x00,0xAE,0x73,0x92,0x94,0x85,0x29,0xD7,0xBD,0xD3,0x9C,0xEB,0x5A,0xC2,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x14,0xA5,0xAE,0x73,0xA2,0x10,0x75,0xAD,0x28,0x42,0x00,0x00,0xC3,0x18,0x79,0xCE,0xAE,0x73,0x28,0x42,0x89,0x4A,0x89,0x4A,0xC3,0x18,0xE7,0x39,0x96,0xB5,0xC2,0x10,0x00,0x00,0x00,0x00,0xAE,0x73,0xD3,0x9C,0x00,0x00,0xC2,0x10,
-	0xEB,0x5A,0xD3,0x9C,0x55,0xAD,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x92,0x94,0xC3,0x18,0x00,0x00,0x82,0x10,0x55,0xAD,0x4C,0x63,0x61,0x08,0xD7,0xBD,0x89,0x4A,0x00,0x00,0x61,0x08,0x55,0xAD,0xAE,0x73,0x00,0x00,0x00,0x00,0x28,0x42,0x44,0x21,0xE7,0x39,0x79,0xCE,0x89,0x4A,0x00,0x00,
-	0xA2,0x10,0x55,0xAD,0x4C,0x63,0x85,0x29,0xA6,0x31,0x00,0x00,0xC3,0x18,0xD7,0xBD,0xE7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0xD3,0x9C,0xD7,0xBD,0xF3,0x9C,0x75,0xAD,0xD3,0x9C,0xA2,0x10,0x00,0x00,0xAE,0x73,0x96,0xB5,0xD3,0x9C,0x85,0x29,0xA6,0x31,0x75,0xAD,0x14,0xA5,0x14,0xA5,0x55,0xAD,
-	0x24,0x21,0xA6,0x31,0x79,0xCE,0xF3,0x9C,0xD3,0x9C,0x75,0xAD,0x92,0x94,0x61,0x08,0x89,0x4A,0xD7,0xBD,0xD3,0x9C,0x55,0xAD,0x92,0x94,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x29,0x28,0x42,0xA6,0x31,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xE7,0x39,0xE7,0x39,0x61,0x08,
-	0x00,0x00,0xA2,0x10,0x28,0x42,0x28,0x42,0xA2,0x10,0x00,0x00,0xE7,0x39,0x55,0xAD,0x24,0x21,0x28,0x42,0xE7,0x39,0x40,0x00,0x00,0x00,0x00,0x00,0x03,0x19,0x28,0x42,0xE7,0x39,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x39,0x75,0xAD,0xC2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x21,0xEB,0x5A,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,
-	0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_12_60913_data_0, "face_pixel_resized_dial_img_12_60913_data_0.bin");
         
 
 
@@ -48,7 +21,7 @@ const lv_img_dsc_t face_pixel_resized_dial_img_12_60913_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 37,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_12_60913_data_0),
+    .data_size = 1443,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_12_60913_data_0};
 
@@ -5,6 +5,7 @@
 // Watchface: PIXEL_RESIZED
 
 #include "../pixel_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,19 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_19_61460_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x08,0x00,0x00,0x00,0x00,0x28,0x42,0x55,0xAD,0x35,0xAD,0xCF,0x7B,0x00,0x00,0x00,0x00,0x0C,0x63,0x50,0x84,0x00,0x00,0x00,0x00,0x34,0xA5,0x8A,0x52,
-	0x61,0x08,0xD7,0xBD,0xA2,0x10,0x04,0x21,0xD7,0xBD,0x45,0x29,0x00,0x00,0x00,0x00,0x76,0xB5,0xE8,0x41,0x00,0x00,0x96,0xB5,0x04,0x21,0x55,0xAD,0x69,0x4A,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x6B,0xF3,0x9C,0xCF,0x7B,0xB2,0x94,0x6D,0x6B,0x51,0x8C,0x66,0x31,0x89,0x4A,0x61,0x08,0x00,0x00,0x20,0x00,0x8A,0x52,0x4D,0x6B,0x49,0x4A,
-	0x76,0xB5,0xCB,0x5A,0x75,0xAD,0x50,0x84,0xD3,0x9C,0x61,0x08,0x00,0x00,0x00,0x00,0x20,0x00,0x75,0xAD,0xE7,0x39,0x92,0x94,0x8A,0x52,0x00,0x00,0x75,0xAD,0xA7,0x39,0x00,0x00,0x00,0x00,0x30,0x84,0x10,0x84,0x00,0x00,0xD2,0x94,0xCB,0x5A,0x00,0x00,0x96,0xB5,0xA6,0x31,0x00,0x00,0xE7,0x39,0x34,0xA5,0x61,0x08,0x00,0x00,0x08,0x42,
-	0x96,0xB5,0xB3,0x9C,0x71,0x8C,0x20,0x00,0x00,0x00,0xC3,0x18,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x28,0x42,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_19_61460_data_0, "face_pixel_resized_dial_img_19_61460_data_0.bin");
         
 
 
@@ -32,7 +21,7 @@ const lv_img_dsc_t face_pixel_resized_dial_img_19_61460_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 10,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_19_61460_data_0),
+    .data_size = 390,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_19_61460_data_0};
 
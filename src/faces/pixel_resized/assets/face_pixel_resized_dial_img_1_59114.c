@@ -5,6 +5,7 @@
 // Watchface: PIXEL_RESIZED
 
 #include "../pixel_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,16 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0x59,0xCE,0xF7,0xBD,0x38,0xC6,0xC7,0x39,0x00,0x00,0xC7,0x39,0x38,0xC6,0x65,0x29,0x82,0x10,0x69,0x4A,0xF7,0xBD,0xE3,0x18,0x71,0x8C,0xCF,0x7B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x75,0xAD,0xEB,0x5A,0x75,0xAD,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xCF,0x7B,0xB6,0xB5,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xCF,0x7B,0xD3,0x9C,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xAD,0xEB,0x5A,0x69,0x4A,0x38,0xC6,0xC3,0x18,0x00,0x00,0xC7,0x39,0x59,0xCE,0x24,0x21,0x00,0x00,
-	0xCF,0x7B,0xF7,0xBD,0x75,0xAD,0x38,0xC6,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0x69,0x4A,0xE3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_0, "face_pixel_resized_dial_img_1_59114_data_0.bin");
         
 
 
@@ -29,22 +21,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_0),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x08,0x42,0xD3,0x9C,0x38,0xC6,0xE3,0x18,0x00,0x00,0x00,0x00,0xA2,0x10,0x71,0x8C,0x6D,0x6B,0x38,0xC6,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xD7,0xBD,
-	0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xD7,0xBD,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xD7,0xBD,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xD7,0xBD,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0xF7,0xBD,0x24,0x21,0x00,0x00,0x00,0x00,0xC3,0x18,
-	0xD3,0x9C,0x75,0xAD,0x9A,0xD6,0xB6,0xB5,0x71,0x8C,0x61,0x08,0x20,0x00,0x86,0x31,0xC7,0x39,0x86,0x31,0xC7,0x39,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_1, "face_pixel_resized_dial_img_1_59114_data_1.bin");
         
 
 
@@ -52,22 +35,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_1),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xCF,0x7B,0x59,0xCE,0xD7,0xBD,0xD7,0xBD,0x65,0x29,0x00,0x00,0x65,0x29,0xD3,0x9C,0x04,0x21,0x61,0x08,0xCF,0x7B,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x69,0x4A,0xB6,0xB5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x75,0xAD,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x65,0x29,0xB6,0xB5,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x59,0xCE,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x21,0x9A,0xD6,0xC7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,
-	0x9A,0xD6,0x34,0xA5,0x34,0xA5,0x75,0xAD,0xCF,0x7B,0x00,0x00,0x61,0x08,0x86,0x31,0xC7,0x39,0xC7,0x39,0xC7,0x39,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_2, "face_pixel_resized_dial_img_1_59114_data_2.bin");
         
 
 
@@ -75,22 +49,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_2),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x61,0x08,0xCF,0x7B,0x38,0xC6,0xB6,0xB5,0xB6,0xB5,0x24,0x21,0x00,0x00,0xA2,0x10,0x6D,0x6B,0xE3,0x18,0x61,0x08,0x71,0x8C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xCF,0x7B,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0x34,0xA5,0xB6,0xB5,0xA2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x6D,0x6B,0x34,0xA5,0xCF,0x7B,0x00,0x00,0x61,0x08,0x82,0x10,0x00,0x00,0x00,0x00,0x65,0x29,0x38,0xC6,0xC3,0x18,0x69,0x4A,0x75,0xAD,0x20,0x00,0x00,0x00,0x69,0x4A,0x38,0xC6,0x61,0x08,0x61,0x08,
-	0xD3,0x9C,0xD7,0xBD,0x34,0xA5,0x59,0xCE,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x69,0x4A,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_3, "face_pixel_resized_dial_img_1_59114_data_3.bin");
         
 
 
@@ -98,22 +63,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_3),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x7B,0x59,0xCE,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x59,0xCE,0x59,0xCE,0xA2,0x10,0x00,0x00,0x00,0x00,0x20,0x00,0x75,0xAD,0xEB,0x5A,
-	0xB6,0xB5,0xC3,0x18,0x00,0x00,0x00,0x00,0xCF,0x7B,0xD3,0x9C,0xE3,0x18,0xF7,0xBD,0xC3,0x18,0x00,0x00,0x86,0x31,0xD7,0xBD,0xA2,0x10,0xC3,0x18,0xF7,0xBD,0xA2,0x10,0x00,0x00,0x71,0x8C,0x59,0xCE,0x71,0x8C,0x34,0xA5,0x9A,0xD6,0xD3,0x9C,0x65,0x29,0x65,0x29,0x08,0x42,0x69,0x4A,0xEB,0x5A,0x9A,0xD6,0xAA,0x52,0xA2,0x10,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xA2,0x10,0x75,0xAD,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-	0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_4, "face_pixel_resized_dial_img_1_59114_data_4.bin");
         
 
 
@@ -121,22 +77,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_4),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0xC3,0x18,0xC3,0x18,0xC3,0x18,0x61,0x08,0x00,0x00,0x61,0x08,0x75,0xAD,0xD7,0xBD,0x75,0xAD,0xB6,0xB5,0x6D,0x6B,0x00,0x00,0xA2,0x10,0xB6,0xB5,0xE3,0x18,0x61,0x08,0x82,0x10,0x61,0x08,0x00,0x00,0xE3,0x18,0x75,0xAD,0x65,0x29,0xEB,0x5A,
-	0x86,0x31,0x00,0x00,0x00,0x00,0x04,0x21,0x9A,0xD6,0xD3,0x9C,0x71,0x8C,0x59,0xCE,0xEB,0x5A,0x00,0x00,0x61,0x08,0xAA,0x52,0x82,0x10,0x00,0x00,0x08,0x42,0x38,0xC6,0x61,0x08,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x18,0x38,0xC6,0x04,0x21,0xC7,0x39,0x34,0xA5,0x61,0x08,0x00,0x00,0xAA,0x52,0xD7,0xBD,0x61,0x08,0x20,0x00,
-	0x71,0x8C,0xF7,0xBD,0x34,0xA5,0x59,0xCE,0x08,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x69,0x4A,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_5, "face_pixel_resized_dial_img_1_59114_data_5.bin");
         
 
 
@@ -144,22 +91,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_5),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,0x24,0x21,0xC3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xD7,0xBD,0xD7,0xBD,0x59,0xCE,0xCF,0x7B,0x00,0x00,0x82,0x10,0xB6,0xB5,0xEB,0x5A,0x20,0x00,0xE3,0x18,0x08,0x42,0x00,0x00,0x69,0x4A,0xB6,0xB5,0x82,0x10,0x69,0x4A,
-	0xC7,0x39,0x00,0x00,0x00,0x00,0xEB,0x5A,0xD7,0xBD,0x71,0x8C,0xD3,0x9C,0xF7,0xBD,0xCF,0x7B,0x00,0x00,0xEB,0x5A,0x9A,0xD6,0x86,0x31,0x00,0x00,0xC3,0x18,0x59,0xCE,0x86,0x31,0x69,0x4A,0x9A,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,0xB6,0xB5,0x69,0x4A,0xC3,0x18,0x59,0xCE,0x08,0x42,0x00,0x00,0x24,0x21,0x59,0xCE,0x86,0x31,0x00,0x00,
-	0x69,0x4A,0x59,0xCE,0x75,0xAD,0x38,0xC6,0x6D,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x69,0x4A,0x86,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_6, "face_pixel_resized_dial_img_1_59114_data_6.bin");
         
 
 
@@ -167,22 +105,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_6),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_6};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_7[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0xC3,0x18,0xC3,0x18,0xA2,0x10,0x61,0x08,0x00,0x00,0xE3,0x18,0x34,0xA5,0xB6,0xB5,0x75,0xAD,0x38,0xC6,0x34,0xA5,0x00,0x00,0x00,0x00,0xA2,0x10,0xA2,0x10,0x82,0x10,0x71,0x8C,0x71,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x08,
-	0xF7,0xBD,0x65,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x4A,0x34,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xA5,0xAA,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x31,0xD7,0xBD,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8C,0xCF,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x82,0x10,0xB6,0xB5,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_7, "face_pixel_resized_dial_img_1_59114_data_7.bin");
         
 
 
@@ -190,22 +119,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_7 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_7),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_7};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_8[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA2,0x10,0x24,0x21,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xEB,0x5A,0x38,0xC6,0x75,0xAD,0xB6,0xB5,0x65,0x29,0x00,0x00,0xC3,0x18,0x38,0xC6,0x86,0x31,0x20,0x00,0xCF,0x7B,0xD3,0x9C,0x00,0x00,0xA2,0x10,0xB6,0xB5,0xE3,0x18,0x00,0x00,
-	0x6D,0x6B,0x71,0x8C,0x00,0x00,0x00,0x00,0xAA,0x52,0x9A,0xD6,0x34,0xA5,0x59,0xCE,0x04,0x21,0x00,0x00,0xE3,0x18,0x75,0xAD,0xCF,0x7B,0xAA,0x52,0xD3,0x9C,0x71,0x8C,0x00,0x00,0x6D,0x6B,0x34,0xA5,0x00,0x00,0x00,0x00,0x82,0x10,0x59,0xCE,0x24,0x21,0xEB,0x5A,0xF7,0xBD,0x20,0x00,0x00,0x00,0xC7,0x39,0x59,0xCE,0xE3,0x18,0x61,0x08,
-	0xD3,0x9C,0xD7,0xBD,0x34,0xA5,0x38,0xC6,0xEB,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x69,0x4A,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_8, "face_pixel_resized_dial_img_1_59114_data_8.bin");
         
 
 
@@ -213,22 +133,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_8 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_8),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_8};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_1_59114_data_9[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE3,0x18,0x04,0x21,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xCF,0x7B,0x59,0xCE,0xD7,0xBD,0x75,0xAD,0x04,0x21,0x00,0x00,0x69,0x4A,0x38,0xC6,0xE3,0x18,0x82,0x10,0x71,0x8C,0x75,0xAD,0x00,0x00,0xCF,0x7B,0x71,0x8C,0x00,0x00,0x00,0x00,
-	0x65,0x29,0x59,0xCE,0x04,0x21,0xEB,0x5A,0xB6,0xB5,0x20,0x00,0x00,0x00,0xEB,0x5A,0x9A,0xD6,0x86,0x31,0x82,0x10,0x34,0xA5,0xB6,0xB5,0xD3,0x9C,0x71,0x8C,0x59,0xCE,0xC7,0x39,0x00,0x00,0x82,0x10,0x08,0x42,0x08,0x42,0xE3,0x18,0xF7,0xBD,0x04,0x21,0xC7,0x39,0xD3,0x9C,0x00,0x00,0x00,0x00,0xCF,0x7B,0x34,0xA5,0x00,0x00,0x82,0x10,
-	0x34,0xA5,0xF7,0xBD,0x75,0xAD,0xD7,0xBD,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xC7,0x39,0x08,0x42,0x61,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0x00,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_1_59114_data_9, "face_pixel_resized_dial_img_1_59114_data_9.bin");
         
 
 
@@ -236,7 +147,7 @@ const lv_img_dsc_t face_pixel_resized_dial_img_1_59114_9 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 7,
     .header.h = 13,
-    .data_size = sizeof(face_pixel_resized_dial_img_1_59114_data_9),
+    .data_size = 273,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_1_59114_data_9};
 
@@ -5,6 +5,7 @@
 // Watchface: PIXEL_RESIZED
 
 #include "../pixel_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,37 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_20_61728_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x09,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0x23,0x12,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xC8,0x2C,0x4A,0x35,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xC8,0x2C,0x2A,0x35,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x6A,0x35,0x05,0x1B,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x09,0x6A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x05,0x1B,0x62,0x09,0x00,0x00,0x00,0x00,0x21,0x09,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0x2A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,
-	0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,
-	0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x62,0x09,0x80,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x6A,0x35,0xA6,0x23,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x12,0x4A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x23,0x6A,0x35,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,
-	0x6A,0x35,0xA6,0x23,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x23,0x12,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x23,0x12,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_20_61728_data_0, "face_pixel_resized_dial_img_20_61728_data_0.bin");
         
 
 
@@ -50,43 +21,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_20_61728_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 20,
-    .data_size = sizeof(face_pixel_resized_dial_img_20_61728_data_0),
+    .data_size = 1560,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_20_61728_data_0};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_20_61728_data_1[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1B,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x2A,0x35,0x6A,0x35,
-	0x4A,0x35,0x4A,0x35,0x6A,0x35,0xA6,0x23,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0xA6,0x23,0x4A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0xA6,0x23,0x23,0x12,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,
-	0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0xA6,0x23,0x23,0x12,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x2A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0xA6,0x23,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,
-	0xA6,0x23,0x4A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x12,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x4A,0x35,0x4A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x4A,0x35,0x4A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_20_61728_data_1, "face_pixel_resized_dial_img_20_61728_data_1.bin");
         
 
 
@@ -94,43 +35,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_20_61728_1 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 20,
-    .data_size = sizeof(face_pixel_resized_dial_img_20_61728_data_1),
+    .data_size = 1560,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_20_61728_data_1};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_20_61728_data_2[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,
-	0x21,0x09,0x21,0x09,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1B,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x4A,0x35,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0x4A,0x35,0xA6,0x23,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0xA6,0x23,0x62,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x05,0x1B,0x6A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x62,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0xA6,0x23,0x23,0x12,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,
-	0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0xA6,0x23,0x23,0x12,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x62,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x6A,0x35,0x62,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xC8,0x2C,0x6A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0xA6,0x23,0x23,0x12,0x23,0x12,0x23,0x12,
-	0x23,0x12,0x23,0x12,0x23,0x12,0x23,0x12,0x23,0x12,0x23,0x12,0xA6,0x23,0x2A,0x35,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x12,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,0x2A,0x35,
-	0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_20_61728_data_2, "face_pixel_resized_dial_img_20_61728_data_2.bin");
         
 
 
@@ -138,43 +49,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_20_61728_2 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 20,
-    .data_size = sizeof(face_pixel_resized_dial_img_20_61728_data_2),
+    .data_size = 1560,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_20_61728_data_2};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_20_61728_data_3[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,
-	0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x12,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0x2A,0x35,0x2A,0x35,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0x2A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x2A,0x35,0x6A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x05,0x1B,0x62,0x09,0x23,0x12,0x23,0x12,0x23,0x12,0x23,0x12,0x62,0x09,0xA6,0x23,0x4A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x2A,0x35,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0xA6,0x23,0x23,0x12,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0x2A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,
-	0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0xC8,0x2C,0x23,0x12,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x2A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x23,0x12,
-	0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x21,0x09,0x05,0x1B,0x6A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1B,0x2A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x4A,0x35,0x2A,0x35,0x4A,0x35,0x2A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_20_61728_data_3, "face_pixel_resized_dial_img_20_61728_data_3.bin");
         
 
 
@@ -182,43 +63,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_20_61728_3 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 20,
-    .data_size = sizeof(face_pixel_resized_dial_img_20_61728_data_3),
+    .data_size = 1560,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_20_61728_data_3};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_20_61728_data_4[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x05,0x1B,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0x62,0x09,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xC8,0x2C,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x4A,0x35,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0x2A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x62,0x09,0x6A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x23,0x12,0x21,0x09,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,
-	0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x23,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x23,0x12,0x21,0x09,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x12,0x6A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC8,0x2C,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x4A,0x35,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,0xC8,0x2C,
-	0x6A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_20_61728_data_4, "face_pixel_resized_dial_img_20_61728_data_4.bin");
         
 
 
@@ -226,43 +77,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_20_61728_4 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 20,
-    .data_size = sizeof(face_pixel_resized_dial_img_20_61728_data_4),
+    .data_size = 1560,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_20_61728_data_4};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_20_61728_data_5[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x23,0x12,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0xA6,0x23,0xA6,0x23,0x05,0x1B,0x62,0x09,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xC8,0x2C,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0xC8,0x2C,0xA6,0x23,0x2A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0xA6,0x23,0x80,0x00,0x00,0x00,0x62,0x09,0x6A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x62,0x09,0x21,0x09,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,
-	0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x6A,0x35,0xA6,0x23,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x62,0x09,0x23,0x12,0x21,0x09,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0xA6,0x23,0x00,0x00,0x00,0x00,0x62,0x09,0x6A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xC8,0x2C,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0xA6,0x23,0xA6,0x23,
-	0x2A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x05,0x1B,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0x62,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_20_61728_data_5, "face_pixel_resized_dial_img_20_61728_data_5.bin");
         
 
 
@@ -270,43 +91,13 @@ const lv_img_dsc_t face_pixel_resized_dial_img_20_61728_5 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 20,
-    .data_size = sizeof(face_pixel_resized_dial_img_20_61728_data_5),
+    .data_size = 1560,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_20_61728_data_5};
 
     
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_20_61728_data_6[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x05,0x1B,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0xA6,0x23,0x05,0x1B,0x62,0x09,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xC8,0x2C,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x62,0x09,0x23,0x12,0x21,0x09,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x23,0x12,0xC8,0x2C,0x05,0x1B,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x62,0x09,0x23,0x12,0x21,0x09,0x00,0x00,0x00,0x00,0x21,0x09,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,
-	0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x4A,0x35,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x23,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,0x6A,0x35,
-	0x6A,0x35,0xC8,0x2C,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x23,0x12,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x05,0x1B,0x21,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_20_61728_data_6, "face_pixel_resized_dial_img_20_61728_data_6.bin");
         
 
 
@@ -314,7 +105,7 @@ const lv_img_dsc_t face_pixel_resized_dial_img_20_61728_6 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 20,
-    .data_size = sizeof(face_pixel_resized_dial_img_20_61728_data_6),
+    .data_size = 1560,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_20_61728_data_6};
 
@@ -5,6 +5,7 @@
 // Watchface: PIXEL_RESIZED
 
 #include "../pixel_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,13 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_32_65535_data_0[] = {
-	//RGB565 data 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_32_65535_data_0, "face_pixel_resized_dial_img_32_65535_data_0.bin");
         
 
 
@@ -26,7 +21,7 @@ const lv_img_dsc_t face_pixel_resized_dial_img_32_65535_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 6,
     .header.h = 1,
-    .data_size = sizeof(face_pixel_resized_dial_img_32_65535_data_0),
+    .data_size = 18,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_32_65535_data_0};
 
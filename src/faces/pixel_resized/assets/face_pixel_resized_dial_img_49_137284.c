@@ -5,6 +5,7 @@
 // Watchface: PIXEL_RESIZED
 
 #include "../pixel_resized.h"
+#include "../../../common/asset_bin/asset_bin.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
@@ -12,37 +13,7 @@
 
 
 // LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_pixel_resized_dial_img_49_137284_data_0[] = {
-	//RGB565 data 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x42,0x00,0x84,0x08,0x84,0x08,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x84,0x08,0x30,0x22,0x78,0x33,0xDB,0x3B,0xBB,0x3B,0x37,0x2B,0xEE,0x19,0x62,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6A,0x11,0xDC,0x3B,0x7F,0x44,0x7F,0x44,0x7F,0x44,0x5F,0x44,0x5F,0x44,0x7F,0x44,0xBA,0x33,0x07,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x11,0x1D,0x3C,0x5F,0x44,0x3E,0x44,0xF5,0x2A,0xB3,0x22,0x1D,0x3C,0x5F,0x44,0x3E,0x44,0x5F,0x44,0xDC,0x3B,0xE7,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x07,0x11,0xED,0x19,0x0F,0x1A,0xBB,0x3B,0x5F,0x44,0x7F,0x44,0x30,0x22,0x28,0x11,0x8B,0x19,0x8C,0x11,0x5F,0x44,0x3E,0x44,0x3E,0x44,0x5F,0x44,0x78,0x33,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x08,0xF4,0x2A,0x3E,0x3C,0x5F,0x44,0x5F,0x44,0x5F,0x44,0x5F,0x44,
-	0xDB,0x3B,0xE7,0x08,0xDB,0x3B,0x7F,0x44,0x07,0x11,0xF5,0x2A,0x5F,0x44,0x3E,0x44,0x3E,0x44,0x5F,0x44,0x6A,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x78,0x33,0x7F,0x44,0x3F,0x44,0x3E,0x44,0x3E,0x44,0x3E,0x44,0x5F,0x44,0xAC,0x19,0x71,0x22,0x36,0x2B,0xD4,0x2A,0x37,0x33,0x08,0x11,
-	0x1E,0x3C,0x5F,0x44,0x3E,0x44,0x7F,0x44,0x92,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x1A,0x7F,0x44,0x3E,0x44,0x3E,0x44,0x3E,0x44,0x3E,0x44,0x5F,0x44,0x37,0x2B,0xE7,0x08,0x3E,0x44,0xAB,0x19,0xE6,0x08,0x5E,0x3C,0x8A,0x11,0x72,0x22,0x7F,0x44,0x3E,0x44,0x7F,0x44,0x16,0x2B,0x20,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x58,0x2B,0x5F,0x44,0x3E,0x44,0x3E,0x44,0x3E,0x44,0x3E,0x44,0x5F,0x44,0x49,0x11,0xB3,0x2A,0x9F,0x44,0xED,0x19,0x28,0x11,0x7F,0x44,0x79,0x33,0xC6,0x08,0xFC,0x3B,0x3F,0x44,0x3E,0x44,0x3E,0x44,0x9A,0x33,0x2F,0x1A,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,
-	0x79,0x33,0x5F,0x44,0x3E,0x44,0x3E,0x44,0x3E,0x44,0x7F,0x44,0xD4,0x2A,0x49,0x11,0x3E,0x44,0x7F,0x44,0x15,0x2B,0x93,0x22,0x5F,0x44,0x5F,0x44,0xCD,0x19,0xEE,0x19,0x7F,0x44,0x3E,0x44,0x3F,0x44,0x5F,0x44,0x7F,0x44,0x2F,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x58,0x33,0x5F,0x44,0x3E,0x44,0x3E,0x44,0x3E,0x44,0x1D,0x3C,
-	0x08,0x11,0x57,0x33,0x5F,0x44,0x5F,0x44,0x16,0x2B,0x92,0x22,0x5F,0x44,0x3F,0x44,0xDB,0x3B,0xC5,0x08,0x9A,0x33,0x5F,0x44,0x3E,0x44,0x3E,0x44,0x5F,0x44,0xFC,0x3B,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD4,0x2A,0x5F,0x44,0x3E,0x44,0x3E,0x44,0x5F,0x44,0xBA,0x33,0x07,0x09,0x1D,0x3C,0x5E,0x44,0x5F,0x44,0x58,0x33,0xF5,0x2A,
-	0x5F,0x44,0x3E,0x44,0x7F,0x44,0x6A,0x11,0xD5,0x2A,0x7F,0x44,0x3E,0x44,0x3E,0x44,0x3F,0x44,0x1E,0x44,0xA4,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x11,0x1E,0x44,0x3F,0x44,0x3E,0x44,0x3E,0x44,0x3E,0x3C,0xCC,0x19,0x6B,0x11,0x0F,0x1A,0x0F,0x1A,0x0F,0x1A,0x10,0x1A,0x0F,0x1A,0x0F,0x1A,0xAC,0x19,0x29,0x11,0xDC,0x3B,0x5F,0x44,
-	0x3E,0x44,0x3E,0x44,0x3F,0x44,0xFD,0x3B,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEE,0x19,0x5F,0x44,0x7F,0x44,0x5F,0x44,0x5F,0x44,0x3E,0x3C,0xBA,0x33,0xBA,0x33,0xBA,0x33,0xBA,0x33,0xBA,0x33,0xBA,0x33,0xBA,0x33,0x99,0x33,0x1D,0x3C,0x5F,0x44,0x3F,0x44,0x3F,0x44,0x5F,0x44,0x7F,0x44,0x71,0x22,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x11,0xF5,0x2A,0xBA,0x3B,0xBB,0x3B,0xDB,0x3B,0xFC,0x3B,0xDB,0x3B,0xDB,0x3B,0xDB,0x3B,0xDB,0x3B,0xDB,0x3B,0xDB,0x3B,0xFC,0x3B,0xDB,0x3B,0xBB,0x3B,0xBB,0x3B,0xBB,0x3B,0xBA,0x33,0x30,0x22,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x63,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x84,0x08,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-	// Alpha Channel 
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    };
+ASSET_BIN(face_pixel_resized_dial_img_49_137284_data_0, "face_pixel_resized_dial_img_49_137284_data_0.bin");
         
 
 
@@ -50,7 +21,7 @@ const lv_img_dsc_t face_pixel_resized_dial_img_49_137284_0 = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.w = 26,
     .header.h = 20,
-    .data_size = sizeof(face_pixel_resized_dial_img_49_137284_data_0),
+    .data_size = 1560,
     .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
     .data = face_pixel_resized_dial_img_49_137284_data_0};
 
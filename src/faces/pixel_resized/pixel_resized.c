@@ -445,9 +445,13 @@ void init_face_pixel_resized(void (*callback)(const char*, const lv_img_dsc_t *,
     lv_obj_set_y(face_pixel_resized_41_130994, 146);
     lv_obj_add_flag(face_pixel_resized_41_130994, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_pixel_resized_41_130994, LV_OBJ_FLAG_SCROLLABLE );
+	face_compositor_static(face_pixel_resized_0_1004);
+	face_compositor_static(face_pixel_resized_12_60913);
+	face_compositor_static(face_pixel_resized_19_61460);
+	face_compositor_static(face_pixel_resized_36_130812);
 
 
-    callback("Pixel", &face_pixel_resized_dial_img_preview_0, &face_pixel_resized, NULL);
+    callback("Pixel", NULL, &face_pixel_resized, NULL);
 
 #endif
 }
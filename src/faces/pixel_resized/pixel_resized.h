@@ -14,6 +14,7 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
 
 //#define ENABLE_FACE_PIXEL_RESIZED // (Pixel) uncomment to enable or define it elsewhere
 
@@ -133,8 +134,6 @@ extern "C"
 	LV_IMG_DECLARE(face_pixel_resized_dial_img_47_135702_0);
 	LV_IMG_DECLARE(face_pixel_resized_dial_img_48_136588_0);
 	LV_IMG_DECLARE(face_pixel_resized_dial_img_49_137284_0);
-	LV_IMG_DECLARE(face_pixel_resized_dial_img_preview_0);
-	LV_IMG_DECLARE(face_pixel_resized_dial_img_preview_0);
 
 
 #endif
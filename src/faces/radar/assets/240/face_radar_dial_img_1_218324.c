@@ -0,0 +1,30 @@
+
+// File generated by bin2lvgl
+// developed by fbiego.
+// https://github.com/fbiego
+// Watchface: RADAR
+
+#include "../../radar.h"
+#include "../../../../common/asset_bin/asset_bin.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#if defined(ENABLE_FACE_RADAR) && FACE_SIDE == 240
+
+
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 240
+ASSET_BIN(face_radar_dial_img_1_218324_data_0, "face_radar_dial_img_1_218324_data_0.bin");
+
+
+const lv_img_dsc_t face_radar_dial_img_1_218324_0 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 26,
+    .header.h = 88,
+    .data_size = 6864,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_radar_dial_img_1_218324_data_0};
+
+    
+#endif
@@ -0,0 +1,30 @@
+
+// File generated by bin2lvgl
+// developed by fbiego.
+// https://github.com/fbiego
+// Watchface: RADAR
+
+#include "../../radar.h"
+#include "../../../../common/asset_bin/asset_bin.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#if defined(ENABLE_FACE_RADAR) && FACE_SIDE == 466
+
+
+// LVGL 9 format (RGB565) // LVGL_9 compatible, scaled from 466 to 466
+ASSET_BIN(face_radar_dial_img_33_792136_data_0, "face_radar_dial_img_33_792136_data_0.bin");
+
+
+const lv_img_dsc_t face_radar_dial_img_33_792136_0 = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.w = 3,
+    .header.h = 236,
+    .data_size = 2124,
+    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
+    .data = face_radar_dial_img_33_792136_data_0};
+
+    
+#endif
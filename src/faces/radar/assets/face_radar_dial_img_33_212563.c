@@ -1,43 +0,0 @@
-
-// File generated by bin2lvgl
-// developed by fbiego. 
-// https://github.com/fbiego
-// Watchface: RADAR
-
-#include "../radar.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-
-// LVGL 9 format (RGB565) // LVGL_9 compatible 
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t face_radar_dial_img_33_212563_data_0[] = {
-	//RGB565 data 
-	0x80,0x00,0x80,0x03,0xC0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,
-	0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,
-	0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,
-	0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,
-	0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,
-	0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,
-	0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,
-	0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xE0,0x03,0xE0,0x07,0xC0,0x03,0xE0,0x07,
-
-	// Alpha Channel 
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    };
-        
-
-
-const lv_img_dsc_t face_radar_dial_img_33_212563_0 = {
-    .header.magic = LV_IMAGE_HEADER_MAGIC,
-    .header.w = 2,
-    .header.h = 122,
-    .data_size = sizeof(face_radar_dial_img_33_212563_data_0),
-    .header.cf = LV_COLOR_FORMAT_NATIVE_WITH_ALPHA,
-    .data = face_radar_dial_img_33_212563_data_0};
-
-    
\ No newline at end of file
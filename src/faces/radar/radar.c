@@ -10,14 +10,17 @@
 
 lv_obj_t *face_radar;
 lv_obj_t *face_radar_0_984;
-lv_obj_t *face_radar_1_58768;
-lv_obj_t *face_radar_17_119773;
-lv_obj_t *face_radar_33_212563;
+lv_obj_t *face_radar_1_218324;
+lv_obj_t *face_radar_17_445412;
+lv_obj_t *face_radar_33_792136;
 
 
 #if LV_COLOR_DEPTH != 16
 #error "LV_COLOR_DEPTH should be 16bit for watchfaces"
 #endif
+#if FACE_SIDE != 240 && FACE_SIDE != 466
+#error "radar has no assets for this screen, add its side to the targets"
+#endif
 
 
 
@@ -44,43 +47,44 @@ void init_face_radar(void (*callback)(const char*, const lv_img_dsc_t *, lv_obj_
     lv_image_set_src(face_radar_0_984, &face_radar_dial_img_0_984_0);
     lv_obj_set_width(face_radar_0_984, LV_SIZE_CONTENT);
     lv_obj_set_height(face_radar_0_984, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_radar_0_984, 0);
-    lv_obj_set_y(face_radar_0_984, 0);
+    lv_obj_set_x(face_radar_0_984, FACE_X(0));
+    lv_obj_set_y(face_radar_0_984, FACE_Y(0));
     lv_obj_add_flag(face_radar_0_984, LV_OBJ_FLAG_ADV_HITTEST );
     lv_obj_remove_flag(face_radar_0_984, LV_OBJ_FLAG_SCROLLABLE );
 
-    face_radar_1_58768 = lv_image_create(face_radar);
-    lv_image_set_src(face_radar_1_58768, &face_radar_dial_img_1_58768_0);
-    lv_obj_set_width(face_radar_1_58768, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_radar_1_58768, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_radar_1_58768, 107);
-    lv_obj_set_y(face_radar_1_58768, 45);
-    lv_obj_add_flag(face_radar_1_58768, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_radar_1_58768, LV_OBJ_FLAG_SCROLLABLE );
-	lv_image_set_pivot(face_radar_1_58768, 13, 75);
-
-    face_radar_17_119773 = lv_image_create(face_radar);
-    lv_image_set_src(face_radar_17_119773, &face_radar_dial_img_17_119773_0);
-    lv_obj_set_width(face_radar_17_119773, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_radar_17_119773, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_radar_17_119773, 110);
-    lv_obj_set_y(face_radar_17_119773, 10);
-    lv_obj_add_flag(face_radar_17_119773, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_radar_17_119773, LV_OBJ_FLAG_SCROLLABLE );
-	lv_image_set_pivot(face_radar_17_119773, 10, 110);
-
-    face_radar_33_212563 = lv_image_create(face_radar);
-    lv_image_set_src(face_radar_33_212563, &face_radar_dial_img_33_212563_0);
-    lv_obj_set_width(face_radar_33_212563, LV_SIZE_CONTENT);
-    lv_obj_set_height(face_radar_33_212563, LV_SIZE_CONTENT);
-    lv_obj_set_x(face_radar_33_212563, 119);
-    lv_obj_set_y(face_radar_33_212563, -1);
-    lv_obj_add_flag(face_radar_33_212563, LV_OBJ_FLAG_ADV_HITTEST );
-    lv_obj_remove_flag(face_radar_33_212563, LV_OBJ_FLAG_SCROLLABLE );
-	lv_image_set_pivot(face_radar_33_212563, 1, 121);
-
-
-    callback("Radar", &face_radar_dial_img_preview_0, &face_radar, &face_radar_33_212563);
+    face_radar_1_218324 = lv_image_create(face_radar);
+    lv_image_set_src(face_radar_1_218324, &face_radar_dial_img_1_218324_0);
+    lv_obj_set_width(face_radar_1_218324, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_radar_1_218324, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_radar_1_218324, FACE_X(1934));
+    lv_obj_set_y(face_radar_1_218324, FACE_Y(668));
+    lv_obj_add_flag(face_radar_1_218324, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_radar_1_218324, LV_OBJ_FLAG_SCROLLABLE );
+	lv_image_set_pivot(face_radar_1_218324, FACE_SCALE(114), FACE_SCALE(1380));
+
+    face_radar_17_445412 = lv_image_create(face_radar);
+    lv_image_set_src(face_radar_17_445412, &face_radar_dial_img_17_445412_0);
+    lv_obj_set_width(face_radar_17_445412, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_radar_17_445412, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_radar_17_445412, FACE_X(1960));
+    lv_obj_set_y(face_radar_17_445412, FACE_Y(88));
+    lv_obj_add_flag(face_radar_17_445412, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_radar_17_445412, LV_OBJ_FLAG_SCROLLABLE );
+	lv_image_set_pivot(face_radar_17_445412, FACE_SCALE(88), FACE_SCALE(1960));
+
+    face_radar_33_792136 = lv_image_create(face_radar);
+    lv_image_set_src(face_radar_33_792136, &face_radar_dial_img_33_792136_0);
+    lv_obj_set_width(face_radar_33_792136, LV_SIZE_CONTENT);
+    lv_obj_set_height(face_radar_33_792136, LV_SIZE_CONTENT);
+    lv_obj_set_x(face_radar_33_792136, FACE_X(2039));
+    lv_obj_set_y(face_radar_33_792136, FACE_Y(-18));
+    lv_obj_add_flag(face_radar_33_792136, LV_OBJ_FLAG_ADV_HITTEST );
+    lv_obj_remove_flag(face_radar_33_792136, LV_OBJ_FLAG_SCROLLABLE );
+	lv_image_set_pivot(face_radar_33_792136, FACE_SCALE(9), FACE_SCALE(2066));
+	face_compositor_static(face_radar_0_984);
+
+
+    callback("Radar", NULL, &face_radar, &face_radar_33_792136);
 
 #endif
 }
@@ -92,9 +96,9 @@ void update_time_radar(int second, int minute, int hour, bool mode, bool am, int
     {
         return;
     }
-	lv_image_set_rotation(face_radar_1_58768, hour * 300 + (minute * 5) + (second * (5 / 60)));
-	lv_image_set_rotation(face_radar_17_119773, (minute * 60) + second);
-	// lv_image_set_rotation(face_radar_33_212563, second * 60);
+	lv_image_set_rotation(face_radar_1_218324, hour * 300 + (minute * 5) + (second * (5 / 60)));
+	lv_image_set_rotation(face_radar_17_445412, (minute * 60) + second);
+	// lv_image_set_rotation(face_radar_33_792136, second * 60);
 
 #endif
 }
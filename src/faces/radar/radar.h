@@ -14,23 +14,23 @@ extern "C"
 
 #include "lvgl.h"
 #include "app_hal.h"
+#include "../../common/face_compositor/face_compositor.h"
+#include "../../common/face_res/face_res.h"
 
 //#define ENABLE_FACE_RADAR // (Radar) uncomment to enable or define it elsewhere
 
 #ifdef ENABLE_FACE_RADAR
     extern lv_obj_t *face_radar;
 	extern lv_obj_t *face_radar_0_984;
-	extern lv_obj_t *face_radar_1_58768;
-	extern lv_obj_t *face_radar_17_119773;
-	extern lv_obj_t *face_radar_33_212563;
+	extern lv_obj_t *face_radar_1_218324;
+	extern lv_obj_t *face_radar_17_445412;
+	extern lv_obj_t *face_radar_33_792136;
 
 
 	LV_IMG_DECLARE(face_radar_dial_img_0_984_0);
-	LV_IMG_DECLARE(face_radar_dial_img_1_58768_0);
-	LV_IMG_DECLARE(face_radar_dial_img_17_119773_0);
-	LV_IMG_DECLARE(face_radar_dial_img_33_212563_0);
-	LV_IMG_DECLARE(face_radar_dial_img_preview_0);
-	LV_IMG_DECLARE(face_radar_dial_img_preview_0);
+	LV_IMG_DECLARE(face_radar_dial_img_1_218324_0);
+	LV_IMG_DECLARE(face_radar_dial_img_17_445412_0);
+	LV_IMG_DECLARE(face_radar_dial_img_33_792136_0);
 
 
 #endif